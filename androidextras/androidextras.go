@@ -8,7 +8,6 @@ package androidextras
 //#include "androidextras_android.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"unsafe"
 )
@@ -60,7 +59,7 @@ func NewQAndroidActivityResultReceiverFromPointer(ptr unsafe.Pointer) *QAndroidA
 func (ptr *QAndroidActivityResultReceiver) DestroyQAndroidActivityResultReceiver() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
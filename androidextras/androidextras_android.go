@@ -9,7 +9,6 @@ package androidextras
 import "C"
 import (
 	"errors"
-	"fmt"
 	"github.com/therecipe/qt"
 	"runtime"
 	"unsafe"
@@ -21,6 +20,43 @@ func cGoUnpackString(s C.struct_QtAndroidExtras_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtAndroidExtras_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtAndroidExtras_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 func QAndroidJniEnvironment_ExceptionCatch() error {
 	var err error
 	if QAndroidJniEnvironment_ExceptionCheck() {
@@ -78,14 +114,14 @@ func NewQAndroidActivityResultReceiverFromPointer(ptr unsafe.Pointer) *QAndroidA
 func (ptr *QAndroidActivityResultReceiver) DestroyQAndroidActivityResultReceiver() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAndroidActivityResultReceiver_HandleActivityResult
 func callbackQAndroidActivityResultReceiver_HandleActivityResult(ptr unsafe.Pointer, receiverRequestCode C.int, resultCode C.int, data unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "handleActivityResult"); signal != nil {
+	if signal := qt.GetSignal(ptr, "handleActivityResult"); signal != nil {
 		signal.(func(int, int, *QAndroidJniObject))(int(int32(receiverRequestCode)), int(int32(resultCode)), NewQAndroidJniObjectFromPointer(data))
 	}
 
@@ -94,14 +130,14 @@ func callbackQAndroidActivityResultReceiver_HandleActivityResult(ptr unsafe.Poin
 func (ptr *QAndroidActivityResultReceiver) ConnectHandleActivityResult(f func(receiverRequestCode int, resultCode int, data *QAndroidJniObject)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "handleActivityResult", f)
+		qt.ConnectSignal(ptr.Pointer(), "handleActivityResult", f)
 	}
 }
 
 func (ptr *QAndroidActivityResultReceiver) DisconnectHandleActivityResult() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "handleActivityResult")
+		qt.DisconnectSignal(ptr.Pointer(), "handleActivityResult")
 	}
 }
 
@@ -82,6 +82,76 @@
 #include <QWidget>
 #include <QXYLegendMarker>
 #include <QXYSeries>
+#include <QStringList>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 typedef QtCharts::QAbstractAxis QAbstractAxis;
 typedef QtCharts::QAbstractBarSeries QAbstractBarSeries;
@@ -1746,7 +1816,7 @@ void* QBarCategoryAxis_NewQBarCategoryAxis(void* parent)
 
 struct QtCharts_PackedString QBarCategoryAxis_Categories(void* ptr)
 {
-	return ({ QByteArray tcc0bf4 = static_cast<QBarCategoryAxis*>(ptr)->categories().join("|").toUtf8(); QtCharts_PackedString { const_cast<char*>(tcc0bf4.prepend("WHITESPACE").constData()+10), tcc0bf4.size()-10 }; });
+	return ({ long long tcc0bf4len; char* tcc0bf4 = goPackStringList(static_cast<QBarCategoryAxis*>(ptr)->categories(), &tcc0bf4len); QtCharts_PackedString { tcc0bf4, tcc0bf4len }; });
 }
 
 void QBarCategoryAxis_Append2(void* ptr, char* category)
@@ -1756,7 +1826,7 @@ void QBarCategoryAxis_Append2(void* ptr, char* category)
 
 void QBarCategoryAxis_Append(void* ptr, char* categories)
 {
-	static_cast<QBarCategoryAxis*>(ptr)->append(QString(categories).split("|", QString::SkipEmptyParts));
+	static_cast<QBarCategoryAxis*>(ptr)->append(goUnpackStringList(categories));
 }
 
 void QBarCategoryAxis_ConnectCategoriesChanged(void* ptr)
@@ -1856,7 +1926,7 @@ void QBarCategoryAxis_Replace(void* ptr, char* oldCategory, char* newCategory)
 
 void QBarCategoryAxis_SetCategories(void* ptr, char* categories)
 {
-	static_cast<QBarCategoryAxis*>(ptr)->setCategories(QString(categories).split("|", QString::SkipEmptyParts));
+	static_cast<QBarCategoryAxis*>(ptr)->setCategories(goUnpackStringList(categories));
 }
 
 void QBarCategoryAxis_SetMax(void* ptr, char* max)
@@ -2371,6 +2441,16 @@ void* QBarSet___append_values_newList2(void* ptr)
 	return new QList<qreal>;
 }
 
+void* QBarSet___append_values_newListBuffer2(void* ptr, void* data, int count)
+{
+	return ({ QList<qreal>* tmpList = new QList<qreal>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<double*>(data)[i]); tmpList; });
+}
+
+void QBarSet___append_values_fillList2(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<qreal>*>(ptr)->size(); i++) static_cast<double*>(data)[i] = static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
 class MyQBoxPlotLegendMarker: public QBoxPlotLegendMarker
 {
 public:
@@ -3020,6 +3100,16 @@ void* QBoxSet___append_values_newList2(void* ptr)
 	return new QList<qreal>;
 }
 
+void* QBoxSet___append_values_newListBuffer2(void* ptr, void* data, int count)
+{
+	return ({ QList<qreal>* tmpList = new QList<qreal>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<double*>(data)[i]); tmpList; });
+}
+
+void QBoxSet___append_values_fillList2(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<qreal>*>(ptr)->size(); i++) static_cast<double*>(data)[i] = static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
 class MyQCandlestickLegendMarker: public QCandlestickLegendMarker
 {
 public:
@@ -4026,7 +4116,7 @@ void* QCategoryAxis_NewQCategoryAxis(void* parent)
 
 struct QtCharts_PackedString QCategoryAxis_CategoriesLabels(void* ptr)
 {
-	return ({ QByteArray t6d5777 = static_cast<QCategoryAxis*>(ptr)->categoriesLabels().join("|").toUtf8(); QtCharts_PackedString { const_cast<char*>(t6d5777.prepend("WHITESPACE").constData()+10), t6d5777.size()-10 }; });
+	return ({ long long t6d5777len; char* t6d5777 = goPackStringList(static_cast<QCategoryAxis*>(ptr)->categoriesLabels(), &t6d5777len); QtCharts_PackedString { t6d5777, t6d5777len }; });
 }
 
 void QCategoryAxis_Append(void* ptr, char* categoryLabel, double categoryEndValue)
@@ -9041,6 +9131,16 @@ void* QXYSeries___append_points_newList3(void* ptr)
 	return new QList<QPointF>;
 }
 
+void* QXYSeries___append_points_newListBuffer3(void* ptr, void* data, int count)
+{
+	return ({ QList<QPointF>* tmpList = new QList<QPointF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPointF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QXYSeries___append_points_fillList3(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<QPointF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPointF(static_cast<QList<QPointF>*>(ptr)->at(i));
+}
+
 void* QXYSeries___replace_points_atList5(void* ptr, int i)
 {
 	return ({ QPointF tmpValue = static_cast<QList<QPointF>*>(ptr)->at(i); new QPointF(tmpValue.x(), tmpValue.y()); });
@@ -9056,6 +9156,16 @@ void* QXYSeries___replace_points_newList5(void* ptr)
 	return new QList<QPointF>;
 }
 
+void* QXYSeries___replace_points_newListBuffer5(void* ptr, void* data, int count)
+{
+	return ({ QList<QPointF>* tmpList = new QList<QPointF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPointF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QXYSeries___replace_points_fillList5(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<QPointF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPointF(static_cast<QList<QPointF>*>(ptr)->at(i));
+}
+
 void* QXYSeries___replace_points_atList6(void* ptr, int i)
 {
 	return ({ QPointF tmpValue = static_cast<QVector<QPointF>*>(ptr)->at(i); new QPointF(tmpValue.x(), tmpValue.y()); });
@@ -9071,6 +9181,16 @@ void* QXYSeries___replace_points_newList6(void* ptr)
 	return new QVector<QPointF>;
 }
 
+void* QXYSeries___replace_points_newListBuffer6(void* ptr, void* data, int count)
+{
+	return ({ QVector<QPointF>* tmpList = new QVector<QPointF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPointF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QXYSeries___replace_points_fillList6(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<QPointF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPointF(static_cast<QVector<QPointF>*>(ptr)->at(i));
+}
+
 void* QXYSeries___points_atList(void* ptr, int i)
 {
 	return ({ QPointF tmpValue = static_cast<QList<QPointF>*>(ptr)->at(i); new QPointF(tmpValue.x(), tmpValue.y()); });
@@ -9086,6 +9206,16 @@ void* QXYSeries___points_newList(void* ptr)
 	return new QList<QPointF>;
 }
 
+void* QXYSeries___points_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<QPointF>* tmpList = new QList<QPointF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPointF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QXYSeries___points_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<QPointF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPointF(static_cast<QList<QPointF>*>(ptr)->at(i));
+}
+
 void* QXYSeries___pointsVector_atList(void* ptr, int i)
 {
 	return ({ QPointF tmpValue = static_cast<QVector<QPointF>*>(ptr)->at(i); new QPointF(tmpValue.x(), tmpValue.y()); });
@@ -9101,3 +9231,13 @@ void* QXYSeries___pointsVector_newList(void* ptr)
 	return new QVector<QPointF>;
 }
 
+void* QXYSeries___pointsVector_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<QPointF>* tmpList = new QVector<QPointF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPointF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QXYSeries___pointsVector_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<QPointF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPointF(static_cast<QVector<QPointF>*>(ptr)->at(i));
+}
+
@@ -8,13 +8,11 @@ package charts
 //#include "charts.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"github.com/therecipe/qt/gui"
 	"github.com/therecipe/qt/widgets"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -24,6 +22,43 @@ func cGoUnpackString(s C.struct_QtCharts_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtCharts_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtCharts_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QAbstractAxis struct {
 	ptr unsafe.Pointer
@@ -96,7 +131,7 @@ func (ptr *QAbstractAxis) MinorGridLineColor() *gui.QColor {
 
 //export callbackQAbstractAxis_ColorChanged
 func callbackQAbstractAxis_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -105,14 +140,14 @@ func callbackQAbstractAxis_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer
 func (ptr *QAbstractAxis) ConnectColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorChanged")
 	}
 }
 
@@ -124,7 +159,7 @@ func (ptr *QAbstractAxis) ColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAbstractAxis_GridLineColorChanged
 func callbackQAbstractAxis_GridLineColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "gridLineColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "gridLineColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -133,14 +168,14 @@ func callbackQAbstractAxis_GridLineColorChanged(ptr unsafe.Pointer, color unsafe
 func (ptr *QAbstractAxis) ConnectGridLineColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectGridLineColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "gridLineColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "gridLineColorChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectGridLineColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectGridLineColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "gridLineColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "gridLineColorChanged")
 	}
 }
 
@@ -152,7 +187,7 @@ func (ptr *QAbstractAxis) GridLineColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAbstractAxis_GridLinePenChanged
 func callbackQAbstractAxis_GridLinePenChanged(ptr unsafe.Pointer, pen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "gridLinePenChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "gridLinePenChanged"); signal != nil {
 		signal.(func(*gui.QPen))(gui.NewQPenFromPointer(pen))
 	}
 
@@ -161,14 +196,14 @@ func callbackQAbstractAxis_GridLinePenChanged(ptr unsafe.Pointer, pen unsafe.Poi
 func (ptr *QAbstractAxis) ConnectGridLinePenChanged(f func(pen *gui.QPen)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectGridLinePenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "gridLinePenChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "gridLinePenChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectGridLinePenChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectGridLinePenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "gridLinePenChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "gridLinePenChanged")
 	}
 }
 
@@ -180,7 +215,7 @@ func (ptr *QAbstractAxis) GridLinePenChanged(pen gui.QPen_ITF) {
 
 //export callbackQAbstractAxis_GridVisibleChanged
 func callbackQAbstractAxis_GridVisibleChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "gridVisibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "gridVisibleChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -189,14 +224,14 @@ func callbackQAbstractAxis_GridVisibleChanged(ptr unsafe.Pointer, visible C.char
 func (ptr *QAbstractAxis) ConnectGridVisibleChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectGridVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "gridVisibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "gridVisibleChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectGridVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectGridVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "gridVisibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "gridVisibleChanged")
 	}
 }
 
@@ -214,7 +249,7 @@ func (ptr *QAbstractAxis) Hide() {
 
 //export callbackQAbstractAxis_LabelsAngleChanged
 func callbackQAbstractAxis_LabelsAngleChanged(ptr unsafe.Pointer, angle C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsAngleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsAngleChanged"); signal != nil {
 		signal.(func(int))(int(int32(angle)))
 	}
 
@@ -223,14 +258,14 @@ func callbackQAbstractAxis_LabelsAngleChanged(ptr unsafe.Pointer, angle C.int) {
 func (ptr *QAbstractAxis) ConnectLabelsAngleChanged(f func(angle int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectLabelsAngleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsAngleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsAngleChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectLabelsAngleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectLabelsAngleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsAngleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsAngleChanged")
 	}
 }
 
@@ -242,7 +277,7 @@ func (ptr *QAbstractAxis) LabelsAngleChanged(angle int) {
 
 //export callbackQAbstractAxis_LabelsBrushChanged
 func callbackQAbstractAxis_LabelsBrushChanged(ptr unsafe.Pointer, brush unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsBrushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsBrushChanged"); signal != nil {
 		signal.(func(*gui.QBrush))(gui.NewQBrushFromPointer(brush))
 	}
 
@@ -251,14 +286,14 @@ func callbackQAbstractAxis_LabelsBrushChanged(ptr unsafe.Pointer, brush unsafe.P
 func (ptr *QAbstractAxis) ConnectLabelsBrushChanged(f func(brush *gui.QBrush)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectLabelsBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsBrushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsBrushChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectLabelsBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectLabelsBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsBrushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsBrushChanged")
 	}
 }
 
@@ -270,7 +305,7 @@ func (ptr *QAbstractAxis) LabelsBrushChanged(brush gui.QBrush_ITF) {
 
 //export callbackQAbstractAxis_LabelsColorChanged
 func callbackQAbstractAxis_LabelsColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -279,14 +314,14 @@ func callbackQAbstractAxis_LabelsColorChanged(ptr unsafe.Pointer, color unsafe.P
 func (ptr *QAbstractAxis) ConnectLabelsColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectLabelsColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsColorChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectLabelsColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectLabelsColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsColorChanged")
 	}
 }
 
@@ -298,7 +333,7 @@ func (ptr *QAbstractAxis) LabelsColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAbstractAxis_LabelsFontChanged
 func callbackQAbstractAxis_LabelsFontChanged(ptr unsafe.Pointer, font unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsFontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsFontChanged"); signal != nil {
 		signal.(func(*gui.QFont))(gui.NewQFontFromPointer(font))
 	}
 
@@ -307,14 +342,14 @@ func callbackQAbstractAxis_LabelsFontChanged(ptr unsafe.Pointer, font unsafe.Poi
 func (ptr *QAbstractAxis) ConnectLabelsFontChanged(f func(font *gui.QFont)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectLabelsFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsFontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsFontChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectLabelsFontChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectLabelsFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsFontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsFontChanged")
 	}
 }
 
@@ -326,7 +361,7 @@ func (ptr *QAbstractAxis) LabelsFontChanged(font gui.QFont_ITF) {
 
 //export callbackQAbstractAxis_LabelsVisibleChanged
 func callbackQAbstractAxis_LabelsVisibleChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsVisibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsVisibleChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -335,14 +370,14 @@ func callbackQAbstractAxis_LabelsVisibleChanged(ptr unsafe.Pointer, visible C.ch
 func (ptr *QAbstractAxis) ConnectLabelsVisibleChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectLabelsVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsVisibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsVisibleChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectLabelsVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectLabelsVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsVisibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsVisibleChanged")
 	}
 }
 
@@ -354,7 +389,7 @@ func (ptr *QAbstractAxis) LabelsVisibleChanged(visible bool) {
 
 //export callbackQAbstractAxis_LinePenChanged
 func callbackQAbstractAxis_LinePenChanged(ptr unsafe.Pointer, pen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "linePenChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "linePenChanged"); signal != nil {
 		signal.(func(*gui.QPen))(gui.NewQPenFromPointer(pen))
 	}
 
@@ -363,14 +398,14 @@ func callbackQAbstractAxis_LinePenChanged(ptr unsafe.Pointer, pen unsafe.Pointer
 func (ptr *QAbstractAxis) ConnectLinePenChanged(f func(pen *gui.QPen)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectLinePenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "linePenChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "linePenChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectLinePenChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectLinePenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "linePenChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "linePenChanged")
 	}
 }
 
@@ -382,7 +417,7 @@ func (ptr *QAbstractAxis) LinePenChanged(pen gui.QPen_ITF) {
 
 //export callbackQAbstractAxis_LineVisibleChanged
 func callbackQAbstractAxis_LineVisibleChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lineVisibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lineVisibleChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -391,14 +426,14 @@ func callbackQAbstractAxis_LineVisibleChanged(ptr unsafe.Pointer, visible C.char
 func (ptr *QAbstractAxis) ConnectLineVisibleChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectLineVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lineVisibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lineVisibleChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectLineVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectLineVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lineVisibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lineVisibleChanged")
 	}
 }
 
@@ -410,7 +445,7 @@ func (ptr *QAbstractAxis) LineVisibleChanged(visible bool) {
 
 //export callbackQAbstractAxis_MinorGridLineColorChanged
 func callbackQAbstractAxis_MinorGridLineColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minorGridLineColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minorGridLineColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -419,14 +454,14 @@ func callbackQAbstractAxis_MinorGridLineColorChanged(ptr unsafe.Pointer, color u
 func (ptr *QAbstractAxis) ConnectMinorGridLineColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectMinorGridLineColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minorGridLineColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minorGridLineColorChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectMinorGridLineColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectMinorGridLineColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minorGridLineColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minorGridLineColorChanged")
 	}
 }
 
@@ -438,7 +473,7 @@ func (ptr *QAbstractAxis) MinorGridLineColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAbstractAxis_MinorGridLinePenChanged
 func callbackQAbstractAxis_MinorGridLinePenChanged(ptr unsafe.Pointer, pen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minorGridLinePenChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minorGridLinePenChanged"); signal != nil {
 		signal.(func(*gui.QPen))(gui.NewQPenFromPointer(pen))
 	}
 
@@ -447,14 +482,14 @@ func callbackQAbstractAxis_MinorGridLinePenChanged(ptr unsafe.Pointer, pen unsaf
 func (ptr *QAbstractAxis) ConnectMinorGridLinePenChanged(f func(pen *gui.QPen)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectMinorGridLinePenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minorGridLinePenChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minorGridLinePenChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectMinorGridLinePenChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectMinorGridLinePenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minorGridLinePenChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minorGridLinePenChanged")
 	}
 }
 
@@ -466,7 +501,7 @@ func (ptr *QAbstractAxis) MinorGridLinePenChanged(pen gui.QPen_ITF) {
 
 //export callbackQAbstractAxis_MinorGridVisibleChanged
 func callbackQAbstractAxis_MinorGridVisibleChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minorGridVisibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minorGridVisibleChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -475,14 +510,14 @@ func callbackQAbstractAxis_MinorGridVisibleChanged(ptr unsafe.Pointer, visible C
 func (ptr *QAbstractAxis) ConnectMinorGridVisibleChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectMinorGridVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minorGridVisibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minorGridVisibleChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectMinorGridVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectMinorGridVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minorGridVisibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minorGridVisibleChanged")
 	}
 }
 
@@ -494,7 +529,7 @@ func (ptr *QAbstractAxis) MinorGridVisibleChanged(visible bool) {
 
 //export callbackQAbstractAxis_ReverseChanged
 func callbackQAbstractAxis_ReverseChanged(ptr unsafe.Pointer, reverse C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reverseChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reverseChanged"); signal != nil {
 		signal.(func(bool))(int8(reverse) != 0)
 	}
 
@@ -503,14 +538,14 @@ func callbackQAbstractAxis_ReverseChanged(ptr unsafe.Pointer, reverse C.char) {
 func (ptr *QAbstractAxis) ConnectReverseChanged(f func(reverse bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectReverseChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reverseChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "reverseChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectReverseChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectReverseChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reverseChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "reverseChanged")
 	}
 }
 
@@ -692,7 +727,7 @@ func (ptr *QAbstractAxis) SetVisible(visible bool) {
 
 //export callbackQAbstractAxis_ShadesBorderColorChanged
 func callbackQAbstractAxis_ShadesBorderColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shadesBorderColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shadesBorderColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -701,14 +736,14 @@ func callbackQAbstractAxis_ShadesBorderColorChanged(ptr unsafe.Pointer, color un
 func (ptr *QAbstractAxis) ConnectShadesBorderColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectShadesBorderColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shadesBorderColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "shadesBorderColorChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectShadesBorderColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectShadesBorderColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shadesBorderColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "shadesBorderColorChanged")
 	}
 }
 
@@ -720,7 +755,7 @@ func (ptr *QAbstractAxis) ShadesBorderColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAbstractAxis_ShadesBrushChanged
 func callbackQAbstractAxis_ShadesBrushChanged(ptr unsafe.Pointer, brush unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shadesBrushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shadesBrushChanged"); signal != nil {
 		signal.(func(*gui.QBrush))(gui.NewQBrushFromPointer(brush))
 	}
 
@@ -729,14 +764,14 @@ func callbackQAbstractAxis_ShadesBrushChanged(ptr unsafe.Pointer, brush unsafe.P
 func (ptr *QAbstractAxis) ConnectShadesBrushChanged(f func(brush *gui.QBrush)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectShadesBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shadesBrushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "shadesBrushChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectShadesBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectShadesBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shadesBrushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "shadesBrushChanged")
 	}
 }
 
@@ -748,7 +783,7 @@ func (ptr *QAbstractAxis) ShadesBrushChanged(brush gui.QBrush_ITF) {
 
 //export callbackQAbstractAxis_ShadesColorChanged
 func callbackQAbstractAxis_ShadesColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shadesColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shadesColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -757,14 +792,14 @@ func callbackQAbstractAxis_ShadesColorChanged(ptr unsafe.Pointer, color unsafe.P
 func (ptr *QAbstractAxis) ConnectShadesColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectShadesColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shadesColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "shadesColorChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectShadesColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectShadesColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shadesColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "shadesColorChanged")
 	}
 }
 
@@ -776,7 +811,7 @@ func (ptr *QAbstractAxis) ShadesColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAbstractAxis_ShadesPenChanged
 func callbackQAbstractAxis_ShadesPenChanged(ptr unsafe.Pointer, pen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shadesPenChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shadesPenChanged"); signal != nil {
 		signal.(func(*gui.QPen))(gui.NewQPenFromPointer(pen))
 	}
 
@@ -785,14 +820,14 @@ func callbackQAbstractAxis_ShadesPenChanged(ptr unsafe.Pointer, pen unsafe.Point
 func (ptr *QAbstractAxis) ConnectShadesPenChanged(f func(pen *gui.QPen)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectShadesPenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shadesPenChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "shadesPenChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectShadesPenChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectShadesPenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shadesPenChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "shadesPenChanged")
 	}
 }
 
@@ -804,7 +839,7 @@ func (ptr *QAbstractAxis) ShadesPenChanged(pen gui.QPen_ITF) {
 
 //export callbackQAbstractAxis_ShadesVisibleChanged
 func callbackQAbstractAxis_ShadesVisibleChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shadesVisibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shadesVisibleChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -813,14 +848,14 @@ func callbackQAbstractAxis_ShadesVisibleChanged(ptr unsafe.Pointer, visible C.ch
 func (ptr *QAbstractAxis) ConnectShadesVisibleChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectShadesVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shadesVisibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "shadesVisibleChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectShadesVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectShadesVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shadesVisibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "shadesVisibleChanged")
 	}
 }
 
@@ -838,7 +873,7 @@ func (ptr *QAbstractAxis) Show() {
 
 //export callbackQAbstractAxis_TitleBrushChanged
 func callbackQAbstractAxis_TitleBrushChanged(ptr unsafe.Pointer, brush unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "titleBrushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "titleBrushChanged"); signal != nil {
 		signal.(func(*gui.QBrush))(gui.NewQBrushFromPointer(brush))
 	}
 
@@ -847,14 +882,14 @@ func callbackQAbstractAxis_TitleBrushChanged(ptr unsafe.Pointer, brush unsafe.Po
 func (ptr *QAbstractAxis) ConnectTitleBrushChanged(f func(brush *gui.QBrush)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectTitleBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "titleBrushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "titleBrushChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectTitleBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectTitleBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "titleBrushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "titleBrushChanged")
 	}
 }
 
@@ -866,7 +901,7 @@ func (ptr *QAbstractAxis) TitleBrushChanged(brush gui.QBrush_ITF) {
 
 //export callbackQAbstractAxis_TitleFontChanged
 func callbackQAbstractAxis_TitleFontChanged(ptr unsafe.Pointer, font unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "titleFontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "titleFontChanged"); signal != nil {
 		signal.(func(*gui.QFont))(gui.NewQFontFromPointer(font))
 	}
 
@@ -875,14 +910,14 @@ func callbackQAbstractAxis_TitleFontChanged(ptr unsafe.Pointer, font unsafe.Poin
 func (ptr *QAbstractAxis) ConnectTitleFontChanged(f func(font *gui.QFont)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectTitleFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "titleFontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "titleFontChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectTitleFontChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectTitleFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "titleFontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "titleFontChanged")
 	}
 }
 
@@ -894,7 +929,7 @@ func (ptr *QAbstractAxis) TitleFontChanged(font gui.QFont_ITF) {
 
 //export callbackQAbstractAxis_TitleTextChanged
 func callbackQAbstractAxis_TitleTextChanged(ptr unsafe.Pointer, text C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "titleTextChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "titleTextChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(text))
 	}
 
@@ -903,14 +938,14 @@ func callbackQAbstractAxis_TitleTextChanged(ptr unsafe.Pointer, text C.struct_Qt
 func (ptr *QAbstractAxis) ConnectTitleTextChanged(f func(text string)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectTitleTextChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "titleTextChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "titleTextChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectTitleTextChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectTitleTextChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "titleTextChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "titleTextChanged")
 	}
 }
 
@@ -924,7 +959,7 @@ func (ptr *QAbstractAxis) TitleTextChanged(text string) {
 
 //export callbackQAbstractAxis_TitleVisibleChanged
 func callbackQAbstractAxis_TitleVisibleChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "titleVisibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "titleVisibleChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -933,14 +968,14 @@ func callbackQAbstractAxis_TitleVisibleChanged(ptr unsafe.Pointer, visible C.cha
 func (ptr *QAbstractAxis) ConnectTitleVisibleChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectTitleVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "titleVisibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "titleVisibleChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectTitleVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectTitleVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "titleVisibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "titleVisibleChanged")
 	}
 }
 
@@ -952,7 +987,7 @@ func (ptr *QAbstractAxis) TitleVisibleChanged(visible bool) {
 
 //export callbackQAbstractAxis_VisibleChanged
 func callbackQAbstractAxis_VisibleChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibleChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -961,14 +996,14 @@ func callbackQAbstractAxis_VisibleChanged(ptr unsafe.Pointer, visible C.char) {
 func (ptr *QAbstractAxis) ConnectVisibleChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_ConnectVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "visibleChanged", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DisconnectVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "visibleChanged")
 	}
 }
 
@@ -981,14 +1016,14 @@ func (ptr *QAbstractAxis) VisibleChanged(visible bool) {
 func (ptr *QAbstractAxis) DestroyQAbstractAxis() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAxis_DestroyQAbstractAxis(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractAxis_Type
 func callbackQAbstractAxis_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractAxis__AxisType)())
 	}
 
@@ -998,14 +1033,14 @@ func callbackQAbstractAxis_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QAbstractAxis) ConnectType(f func() QAbstractAxis__AxisType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QAbstractAxis) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -1309,7 +1344,7 @@ func (ptr *QAbstractBarSeries) Take(set QBarSet_ITF) bool {
 
 //export callbackQAbstractBarSeries_BarsetsAdded
 func callbackQAbstractBarSeries_BarsetsAdded(ptr unsafe.Pointer, sets C.struct_QtCharts_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "barsetsAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "barsetsAdded"); signal != nil {
 		signal.(func([]*QBarSet))(func(l C.struct_QtCharts_PackedList) []*QBarSet {
 			var out = make([]*QBarSet, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -1324,14 +1359,14 @@ func callbackQAbstractBarSeries_BarsetsAdded(ptr unsafe.Pointer, sets C.struct_Q
 func (ptr *QAbstractBarSeries) ConnectBarsetsAdded(f func(sets []*QBarSet)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectBarsetsAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "barsetsAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "barsetsAdded", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectBarsetsAdded() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectBarsetsAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "barsetsAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "barsetsAdded")
 	}
 }
 
@@ -1349,7 +1384,7 @@ func (ptr *QAbstractBarSeries) BarsetsAdded(sets []*QBarSet) {
 
 //export callbackQAbstractBarSeries_BarsetsRemoved
 func callbackQAbstractBarSeries_BarsetsRemoved(ptr unsafe.Pointer, sets C.struct_QtCharts_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "barsetsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "barsetsRemoved"); signal != nil {
 		signal.(func([]*QBarSet))(func(l C.struct_QtCharts_PackedList) []*QBarSet {
 			var out = make([]*QBarSet, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -1364,14 +1399,14 @@ func callbackQAbstractBarSeries_BarsetsRemoved(ptr unsafe.Pointer, sets C.struct
 func (ptr *QAbstractBarSeries) ConnectBarsetsRemoved(f func(sets []*QBarSet)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectBarsetsRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "barsetsRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "barsetsRemoved", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectBarsetsRemoved() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectBarsetsRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "barsetsRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "barsetsRemoved")
 	}
 }
 
@@ -1395,7 +1430,7 @@ func (ptr *QAbstractBarSeries) Clear() {
 
 //export callbackQAbstractBarSeries_Clicked
 func callbackQAbstractBarSeries_Clicked(ptr unsafe.Pointer, index C.int, barset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func(int, *QBarSet))(int(int32(index)), NewQBarSetFromPointer(barset))
 	}
 
@@ -1404,14 +1439,14 @@ func callbackQAbstractBarSeries_Clicked(ptr unsafe.Pointer, index C.int, barset
 func (ptr *QAbstractBarSeries) ConnectClicked(f func(index int, barset *QBarSet)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -1423,7 +1458,7 @@ func (ptr *QAbstractBarSeries) Clicked(index int, barset QBarSet_ITF) {
 
 //export callbackQAbstractBarSeries_CountChanged
 func callbackQAbstractBarSeries_CountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "countChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "countChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1432,14 +1467,14 @@ func callbackQAbstractBarSeries_CountChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstractBarSeries) ConnectCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "countChanged", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "countChanged")
 	}
 }
 
@@ -1451,7 +1486,7 @@ func (ptr *QAbstractBarSeries) CountChanged() {
 
 //export callbackQAbstractBarSeries_DoubleClicked
 func callbackQAbstractBarSeries_DoubleClicked(ptr unsafe.Pointer, index C.int, barset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func(int, *QBarSet))(int(int32(index)), NewQBarSetFromPointer(barset))
 	}
 
@@ -1460,14 +1495,14 @@ func callbackQAbstractBarSeries_DoubleClicked(ptr unsafe.Pointer, index C.int, b
 func (ptr *QAbstractBarSeries) ConnectDoubleClicked(f func(index int, barset *QBarSet)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -1479,7 +1514,7 @@ func (ptr *QAbstractBarSeries) DoubleClicked(index int, barset QBarSet_ITF) {
 
 //export callbackQAbstractBarSeries_Hovered
 func callbackQAbstractBarSeries_Hovered(ptr unsafe.Pointer, status C.char, index C.int, barset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(bool, int, *QBarSet))(int8(status) != 0, int(int32(index)), NewQBarSetFromPointer(barset))
 	}
 
@@ -1488,14 +1523,14 @@ func callbackQAbstractBarSeries_Hovered(ptr unsafe.Pointer, status C.char, index
 func (ptr *QAbstractBarSeries) ConnectHovered(f func(status bool, index int, barset *QBarSet)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -1507,7 +1542,7 @@ func (ptr *QAbstractBarSeries) Hovered(status bool, index int, barset QBarSet_IT
 
 //export callbackQAbstractBarSeries_LabelsAngleChanged
 func callbackQAbstractBarSeries_LabelsAngleChanged(ptr unsafe.Pointer, angle C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsAngleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsAngleChanged"); signal != nil {
 		signal.(func(float64))(float64(angle))
 	}
 
@@ -1516,14 +1551,14 @@ func callbackQAbstractBarSeries_LabelsAngleChanged(ptr unsafe.Pointer, angle C.d
 func (ptr *QAbstractBarSeries) ConnectLabelsAngleChanged(f func(angle float64)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectLabelsAngleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsAngleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsAngleChanged", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectLabelsAngleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectLabelsAngleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsAngleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsAngleChanged")
 	}
 }
 
@@ -1535,7 +1570,7 @@ func (ptr *QAbstractBarSeries) LabelsAngleChanged(angle float64) {
 
 //export callbackQAbstractBarSeries_LabelsFormatChanged
 func callbackQAbstractBarSeries_LabelsFormatChanged(ptr unsafe.Pointer, format C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsFormatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsFormatChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(format))
 	}
 
@@ -1544,14 +1579,14 @@ func callbackQAbstractBarSeries_LabelsFormatChanged(ptr unsafe.Pointer, format C
 func (ptr *QAbstractBarSeries) ConnectLabelsFormatChanged(f func(format string)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectLabelsFormatChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsFormatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsFormatChanged", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectLabelsFormatChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectLabelsFormatChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsFormatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsFormatChanged")
 	}
 }
 
@@ -1565,7 +1600,7 @@ func (ptr *QAbstractBarSeries) LabelsFormatChanged(format string) {
 
 //export callbackQAbstractBarSeries_LabelsPositionChanged
 func callbackQAbstractBarSeries_LabelsPositionChanged(ptr unsafe.Pointer, position C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsPositionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsPositionChanged"); signal != nil {
 		signal.(func(QAbstractBarSeries__LabelsPosition))(QAbstractBarSeries__LabelsPosition(position))
 	}
 
@@ -1574,14 +1609,14 @@ func callbackQAbstractBarSeries_LabelsPositionChanged(ptr unsafe.Pointer, positi
 func (ptr *QAbstractBarSeries) ConnectLabelsPositionChanged(f func(position QAbstractBarSeries__LabelsPosition)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectLabelsPositionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsPositionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsPositionChanged", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectLabelsPositionChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectLabelsPositionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsPositionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsPositionChanged")
 	}
 }
 
@@ -1593,7 +1628,7 @@ func (ptr *QAbstractBarSeries) LabelsPositionChanged(position QAbstractBarSeries
 
 //export callbackQAbstractBarSeries_LabelsVisibleChanged
 func callbackQAbstractBarSeries_LabelsVisibleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsVisibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsVisibleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1602,14 +1637,14 @@ func callbackQAbstractBarSeries_LabelsVisibleChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstractBarSeries) ConnectLabelsVisibleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectLabelsVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsVisibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsVisibleChanged", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectLabelsVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectLabelsVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsVisibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsVisibleChanged")
 	}
 }
 
@@ -1621,7 +1656,7 @@ func (ptr *QAbstractBarSeries) LabelsVisibleChanged() {
 
 //export callbackQAbstractBarSeries_Pressed
 func callbackQAbstractBarSeries_Pressed(ptr unsafe.Pointer, index C.int, barset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func(int, *QBarSet))(int(int32(index)), NewQBarSetFromPointer(barset))
 	}
 
@@ -1630,14 +1665,14 @@ func callbackQAbstractBarSeries_Pressed(ptr unsafe.Pointer, index C.int, barset
 func (ptr *QAbstractBarSeries) ConnectPressed(f func(index int, barset *QBarSet)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -1649,7 +1684,7 @@ func (ptr *QAbstractBarSeries) Pressed(index int, barset QBarSet_ITF) {
 
 //export callbackQAbstractBarSeries_Released
 func callbackQAbstractBarSeries_Released(ptr unsafe.Pointer, index C.int, barset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func(int, *QBarSet))(int(int32(index)), NewQBarSetFromPointer(barset))
 	}
 
@@ -1658,14 +1693,14 @@ func callbackQAbstractBarSeries_Released(ptr unsafe.Pointer, index C.int, barset
 func (ptr *QAbstractBarSeries) ConnectReleased(f func(index int, barset *QBarSet)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -1709,7 +1744,7 @@ func (ptr *QAbstractBarSeries) SetLabelsVisible(visible bool) {
 
 //export callbackQAbstractBarSeries_DestroyQAbstractBarSeries
 func callbackQAbstractBarSeries_DestroyQAbstractBarSeries(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractBarSeries"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractBarSeries"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractBarSeriesFromPointer(ptr).DestroyQAbstractBarSeriesDefault()
@@ -1719,21 +1754,21 @@ func callbackQAbstractBarSeries_DestroyQAbstractBarSeries(ptr unsafe.Pointer) {
 func (ptr *QAbstractBarSeries) ConnectDestroyQAbstractBarSeries(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractBarSeries", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractBarSeries", f)
 	}
 }
 
 func (ptr *QAbstractBarSeries) DisconnectDestroyQAbstractBarSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractBarSeries")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractBarSeries")
 	}
 }
 
 func (ptr *QAbstractBarSeries) DestroyQAbstractBarSeries() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DestroyQAbstractBarSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1741,7 +1776,7 @@ func (ptr *QAbstractBarSeries) DestroyQAbstractBarSeries() {
 func (ptr *QAbstractBarSeries) DestroyQAbstractBarSeriesDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractBarSeries_DestroyQAbstractBarSeriesDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1962,7 +1997,7 @@ func (ptr *QAbstractSeries) Hide() {
 
 //export callbackQAbstractSeries_NameChanged
 func callbackQAbstractSeries_NameChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nameChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1971,14 +2006,14 @@ func callbackQAbstractSeries_NameChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstractSeries) ConnectNameChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSeries_ConnectNameChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nameChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "nameChanged", f)
 	}
 }
 
 func (ptr *QAbstractSeries) DisconnectNameChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSeries_DisconnectNameChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nameChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "nameChanged")
 	}
 }
 
@@ -1990,7 +2025,7 @@ func (ptr *QAbstractSeries) NameChanged() {
 
 //export callbackQAbstractSeries_OpacityChanged
 func callbackQAbstractSeries_OpacityChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "opacityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "opacityChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1999,14 +2034,14 @@ func callbackQAbstractSeries_OpacityChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstractSeries) ConnectOpacityChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSeries_ConnectOpacityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "opacityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "opacityChanged", f)
 	}
 }
 
 func (ptr *QAbstractSeries) DisconnectOpacityChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSeries_DisconnectOpacityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "opacityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "opacityChanged")
 	}
 }
 
@@ -2050,7 +2085,7 @@ func (ptr *QAbstractSeries) Show() {
 
 //export callbackQAbstractSeries_UseOpenGLChanged
 func callbackQAbstractSeries_UseOpenGLChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "useOpenGLChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "useOpenGLChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -2059,14 +2094,14 @@ func callbackQAbstractSeries_UseOpenGLChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstractSeries) ConnectUseOpenGLChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSeries_ConnectUseOpenGLChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "useOpenGLChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "useOpenGLChanged", f)
 	}
 }
 
 func (ptr *QAbstractSeries) DisconnectUseOpenGLChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSeries_DisconnectUseOpenGLChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "useOpenGLChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "useOpenGLChanged")
 	}
 }
 
@@ -2078,7 +2113,7 @@ func (ptr *QAbstractSeries) UseOpenGLChanged() {
 
 //export callbackQAbstractSeries_VisibleChanged
 func callbackQAbstractSeries_VisibleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -2087,14 +2122,14 @@ func callbackQAbstractSeries_VisibleChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstractSeries) ConnectVisibleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSeries_ConnectVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "visibleChanged", f)
 	}
 }
 
 func (ptr *QAbstractSeries) DisconnectVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSeries_DisconnectVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "visibleChanged")
 	}
 }
 
@@ -2107,7 +2142,7 @@ func (ptr *QAbstractSeries) VisibleChanged() {
 func (ptr *QAbstractSeries) DestroyQAbstractSeries() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSeries_DestroyQAbstractSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2128,7 +2163,7 @@ func (ptr *QAbstractSeries) Name() string {
 
 //export callbackQAbstractSeries_Type
 func callbackQAbstractSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -2138,14 +2173,14 @@ func callbackQAbstractSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QAbstractSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QAbstractSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -2234,7 +2269,7 @@ func NewQAreaLegendMarkerFromPointer(ptr unsafe.Pointer) *QAreaLegendMarker {
 
 //export callbackQAreaLegendMarker_Series
 func callbackQAreaLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "series"); signal != nil {
+	if signal := qt.GetSignal(ptr, "series"); signal != nil {
 		return PointerFromQAreaSeries(signal.(func() *QAreaSeries)())
 	}
 
@@ -2244,14 +2279,14 @@ func callbackQAreaLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QAreaLegendMarker) ConnectSeries(f func() *QAreaSeries) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "series", f)
+		qt.ConnectSignal(ptr.Pointer(), "series", f)
 	}
 }
 
 func (ptr *QAreaLegendMarker) DisconnectSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "series")
+		qt.DisconnectSignal(ptr.Pointer(), "series")
 	}
 }
 
@@ -2271,7 +2306,7 @@ func (ptr *QAreaLegendMarker) SeriesDefault() *QAreaSeries {
 
 //export callbackQAreaLegendMarker_DestroyQAreaLegendMarker
 func callbackQAreaLegendMarker_DestroyQAreaLegendMarker(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAreaLegendMarker"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAreaLegendMarker"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAreaLegendMarkerFromPointer(ptr).DestroyQAreaLegendMarkerDefault()
@@ -2281,21 +2316,21 @@ func callbackQAreaLegendMarker_DestroyQAreaLegendMarker(ptr unsafe.Pointer) {
 func (ptr *QAreaLegendMarker) ConnectDestroyQAreaLegendMarker(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAreaLegendMarker", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAreaLegendMarker", f)
 	}
 }
 
 func (ptr *QAreaLegendMarker) DisconnectDestroyQAreaLegendMarker() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAreaLegendMarker")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAreaLegendMarker")
 	}
 }
 
 func (ptr *QAreaLegendMarker) DestroyQAreaLegendMarker() {
 	if ptr.Pointer() != nil {
 		C.QAreaLegendMarker_DestroyQAreaLegendMarker(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2303,7 +2338,7 @@ func (ptr *QAreaLegendMarker) DestroyQAreaLegendMarker() {
 func (ptr *QAreaLegendMarker) DestroyQAreaLegendMarkerDefault() {
 	if ptr.Pointer() != nil {
 		C.QAreaLegendMarker_DestroyQAreaLegendMarkerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2355,7 +2390,7 @@ func NewQAreaSeries(parent core.QObject_ITF) *QAreaSeries {
 
 //export callbackQAreaSeries_BorderColorChanged
 func callbackQAreaSeries_BorderColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "borderColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "borderColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -2364,14 +2399,14 @@ func callbackQAreaSeries_BorderColorChanged(ptr unsafe.Pointer, color unsafe.Poi
 func (ptr *QAreaSeries) ConnectBorderColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectBorderColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "borderColorChanged", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectBorderColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectBorderColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "borderColorChanged")
 	}
 }
 
@@ -2383,7 +2418,7 @@ func (ptr *QAreaSeries) BorderColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAreaSeries_Clicked
 func callbackQAreaSeries_Clicked(ptr unsafe.Pointer, point unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func(*core.QPointF))(core.NewQPointFFromPointer(point))
 	}
 
@@ -2392,14 +2427,14 @@ func callbackQAreaSeries_Clicked(ptr unsafe.Pointer, point unsafe.Pointer) {
 func (ptr *QAreaSeries) ConnectClicked(f func(point *core.QPointF)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -2411,7 +2446,7 @@ func (ptr *QAreaSeries) Clicked(point core.QPointF_ITF) {
 
 //export callbackQAreaSeries_ColorChanged
 func callbackQAreaSeries_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -2420,14 +2455,14 @@ func callbackQAreaSeries_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer)
 func (ptr *QAreaSeries) ConnectColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorChanged", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorChanged")
 	}
 }
 
@@ -2439,7 +2474,7 @@ func (ptr *QAreaSeries) ColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAreaSeries_DoubleClicked
 func callbackQAreaSeries_DoubleClicked(ptr unsafe.Pointer, point unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func(*core.QPointF))(core.NewQPointFFromPointer(point))
 	}
 
@@ -2448,14 +2483,14 @@ func callbackQAreaSeries_DoubleClicked(ptr unsafe.Pointer, point unsafe.Pointer)
 func (ptr *QAreaSeries) ConnectDoubleClicked(f func(point *core.QPointF)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -2467,7 +2502,7 @@ func (ptr *QAreaSeries) DoubleClicked(point core.QPointF_ITF) {
 
 //export callbackQAreaSeries_Hovered
 func callbackQAreaSeries_Hovered(ptr unsafe.Pointer, point unsafe.Pointer, state C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(*core.QPointF, bool))(core.NewQPointFFromPointer(point), int8(state) != 0)
 	}
 
@@ -2476,14 +2511,14 @@ func callbackQAreaSeries_Hovered(ptr unsafe.Pointer, point unsafe.Pointer, state
 func (ptr *QAreaSeries) ConnectHovered(f func(point *core.QPointF, state bool)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -2495,7 +2530,7 @@ func (ptr *QAreaSeries) Hovered(point core.QPointF_ITF, state bool) {
 
 //export callbackQAreaSeries_PointLabelsClippingChanged
 func callbackQAreaSeries_PointLabelsClippingChanged(ptr unsafe.Pointer, clipping C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsClippingChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsClippingChanged"); signal != nil {
 		signal.(func(bool))(int8(clipping) != 0)
 	}
 
@@ -2504,14 +2539,14 @@ func callbackQAreaSeries_PointLabelsClippingChanged(ptr unsafe.Pointer, clipping
 func (ptr *QAreaSeries) ConnectPointLabelsClippingChanged(f func(clipping bool)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectPointLabelsClippingChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsClippingChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsClippingChanged", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectPointLabelsClippingChanged() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectPointLabelsClippingChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsClippingChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsClippingChanged")
 	}
 }
 
@@ -2523,7 +2558,7 @@ func (ptr *QAreaSeries) PointLabelsClippingChanged(clipping bool) {
 
 //export callbackQAreaSeries_PointLabelsColorChanged
 func callbackQAreaSeries_PointLabelsColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -2532,14 +2567,14 @@ func callbackQAreaSeries_PointLabelsColorChanged(ptr unsafe.Pointer, color unsaf
 func (ptr *QAreaSeries) ConnectPointLabelsColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectPointLabelsColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsColorChanged", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectPointLabelsColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectPointLabelsColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsColorChanged")
 	}
 }
 
@@ -2551,7 +2586,7 @@ func (ptr *QAreaSeries) PointLabelsColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAreaSeries_PointLabelsFontChanged
 func callbackQAreaSeries_PointLabelsFontChanged(ptr unsafe.Pointer, font unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsFontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsFontChanged"); signal != nil {
 		signal.(func(*gui.QFont))(gui.NewQFontFromPointer(font))
 	}
 
@@ -2560,14 +2595,14 @@ func callbackQAreaSeries_PointLabelsFontChanged(ptr unsafe.Pointer, font unsafe.
 func (ptr *QAreaSeries) ConnectPointLabelsFontChanged(f func(font *gui.QFont)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectPointLabelsFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsFontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsFontChanged", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectPointLabelsFontChanged() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectPointLabelsFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsFontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsFontChanged")
 	}
 }
 
@@ -2579,7 +2614,7 @@ func (ptr *QAreaSeries) PointLabelsFontChanged(font gui.QFont_ITF) {
 
 //export callbackQAreaSeries_PointLabelsFormatChanged
 func callbackQAreaSeries_PointLabelsFormatChanged(ptr unsafe.Pointer, format C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsFormatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsFormatChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(format))
 	}
 
@@ -2588,14 +2623,14 @@ func callbackQAreaSeries_PointLabelsFormatChanged(ptr unsafe.Pointer, format C.s
 func (ptr *QAreaSeries) ConnectPointLabelsFormatChanged(f func(format string)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectPointLabelsFormatChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsFormatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsFormatChanged", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectPointLabelsFormatChanged() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectPointLabelsFormatChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsFormatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsFormatChanged")
 	}
 }
 
@@ -2609,7 +2644,7 @@ func (ptr *QAreaSeries) PointLabelsFormatChanged(format string) {
 
 //export callbackQAreaSeries_PointLabelsVisibilityChanged
 func callbackQAreaSeries_PointLabelsVisibilityChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsVisibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsVisibilityChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -2618,14 +2653,14 @@ func callbackQAreaSeries_PointLabelsVisibilityChanged(ptr unsafe.Pointer, visibl
 func (ptr *QAreaSeries) ConnectPointLabelsVisibilityChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectPointLabelsVisibilityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsVisibilityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsVisibilityChanged", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectPointLabelsVisibilityChanged() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectPointLabelsVisibilityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsVisibilityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsVisibilityChanged")
 	}
 }
 
@@ -2637,7 +2672,7 @@ func (ptr *QAreaSeries) PointLabelsVisibilityChanged(visible bool) {
 
 //export callbackQAreaSeries_Pressed
 func callbackQAreaSeries_Pressed(ptr unsafe.Pointer, point unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func(*core.QPointF))(core.NewQPointFFromPointer(point))
 	}
 
@@ -2646,14 +2681,14 @@ func callbackQAreaSeries_Pressed(ptr unsafe.Pointer, point unsafe.Pointer) {
 func (ptr *QAreaSeries) ConnectPressed(f func(point *core.QPointF)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -2665,7 +2700,7 @@ func (ptr *QAreaSeries) Pressed(point core.QPointF_ITF) {
 
 //export callbackQAreaSeries_Released
 func callbackQAreaSeries_Released(ptr unsafe.Pointer, point unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func(*core.QPointF))(core.NewQPointFFromPointer(point))
 	}
 
@@ -2674,14 +2709,14 @@ func callbackQAreaSeries_Released(ptr unsafe.Pointer, point unsafe.Pointer) {
 func (ptr *QAreaSeries) ConnectReleased(f func(point *core.QPointF)) {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -2768,14 +2803,14 @@ func (ptr *QAreaSeries) SetUpperSeries(series QLineSeries_ITF) {
 func (ptr *QAreaSeries) DestroyQAreaSeries() {
 	if ptr.Pointer() != nil {
 		C.QAreaSeries_DestroyQAreaSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAreaSeries_Type
 func callbackQAreaSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -2785,14 +2820,14 @@ func callbackQAreaSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QAreaSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QAreaSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -2949,7 +2984,7 @@ func NewQBarCategoryAxis(parent core.QObject_ITF) *QBarCategoryAxis {
 
 func (ptr *QBarCategoryAxis) Categories() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QBarCategoryAxis_Categories(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QBarCategoryAxis_Categories(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -2964,7 +2999,7 @@ func (ptr *QBarCategoryAxis) Append2(category string) {
 
 func (ptr *QBarCategoryAxis) Append(categories []string) {
 	if ptr.Pointer() != nil {
-		var categoriesC = C.CString(strings.Join(categories, "|"))
+		var categoriesC = cGoPackStringList(categories)
 		defer C.free(unsafe.Pointer(categoriesC))
 		C.QBarCategoryAxis_Append(ptr.Pointer(), categoriesC)
 	}
@@ -2972,7 +3007,7 @@ func (ptr *QBarCategoryAxis) Append(categories []string) {
 
 //export callbackQBarCategoryAxis_CategoriesChanged
 func callbackQBarCategoryAxis_CategoriesChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "categoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "categoriesChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -2981,14 +3016,14 @@ func callbackQBarCategoryAxis_CategoriesChanged(ptr unsafe.Pointer) {
 func (ptr *QBarCategoryAxis) ConnectCategoriesChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_ConnectCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "categoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "categoriesChanged", f)
 	}
 }
 
 func (ptr *QBarCategoryAxis) DisconnectCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_DisconnectCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "categoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "categoriesChanged")
 	}
 }
 
@@ -3006,7 +3041,7 @@ func (ptr *QBarCategoryAxis) Clear() {
 
 //export callbackQBarCategoryAxis_CountChanged
 func callbackQBarCategoryAxis_CountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "countChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "countChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3015,14 +3050,14 @@ func callbackQBarCategoryAxis_CountChanged(ptr unsafe.Pointer) {
 func (ptr *QBarCategoryAxis) ConnectCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_ConnectCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "countChanged", f)
 	}
 }
 
 func (ptr *QBarCategoryAxis) DisconnectCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_DisconnectCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "countChanged")
 	}
 }
 
@@ -3042,7 +3077,7 @@ func (ptr *QBarCategoryAxis) Insert(index int, category string) {
 
 //export callbackQBarCategoryAxis_MaxChanged
 func callbackQBarCategoryAxis_MaxChanged(ptr unsafe.Pointer, max C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maxChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maxChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(max))
 	}
 
@@ -3051,14 +3086,14 @@ func callbackQBarCategoryAxis_MaxChanged(ptr unsafe.Pointer, max C.struct_QtChar
 func (ptr *QBarCategoryAxis) ConnectMaxChanged(f func(max string)) {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_ConnectMaxChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maxChanged", f)
 	}
 }
 
 func (ptr *QBarCategoryAxis) DisconnectMaxChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_DisconnectMaxChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maxChanged")
 	}
 }
 
@@ -3072,7 +3107,7 @@ func (ptr *QBarCategoryAxis) MaxChanged(max string) {
 
 //export callbackQBarCategoryAxis_MinChanged
 func callbackQBarCategoryAxis_MinChanged(ptr unsafe.Pointer, min C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(min))
 	}
 
@@ -3081,14 +3116,14 @@ func callbackQBarCategoryAxis_MinChanged(ptr unsafe.Pointer, min C.struct_QtChar
 func (ptr *QBarCategoryAxis) ConnectMinChanged(f func(min string)) {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_ConnectMinChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minChanged", f)
 	}
 }
 
 func (ptr *QBarCategoryAxis) DisconnectMinChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_DisconnectMinChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minChanged")
 	}
 }
 
@@ -3102,7 +3137,7 @@ func (ptr *QBarCategoryAxis) MinChanged(min string) {
 
 //export callbackQBarCategoryAxis_RangeChanged
 func callbackQBarCategoryAxis_RangeChanged(ptr unsafe.Pointer, min C.struct_QtCharts_PackedString, max C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rangeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rangeChanged"); signal != nil {
 		signal.(func(string, string))(cGoUnpackString(min), cGoUnpackString(max))
 	}
 
@@ -3111,14 +3146,14 @@ func callbackQBarCategoryAxis_RangeChanged(ptr unsafe.Pointer, min C.struct_QtCh
 func (ptr *QBarCategoryAxis) ConnectRangeChanged(f func(min string, max string)) {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_ConnectRangeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rangeChanged", f)
 	}
 }
 
 func (ptr *QBarCategoryAxis) DisconnectRangeChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_DisconnectRangeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rangeChanged")
 	}
 }
 
@@ -3152,7 +3187,7 @@ func (ptr *QBarCategoryAxis) Replace(oldCategory string, newCategory string) {
 
 func (ptr *QBarCategoryAxis) SetCategories(categories []string) {
 	if ptr.Pointer() != nil {
-		var categoriesC = C.CString(strings.Join(categories, "|"))
+		var categoriesC = cGoPackStringList(categories)
 		defer C.free(unsafe.Pointer(categoriesC))
 		C.QBarCategoryAxis_SetCategories(ptr.Pointer(), categoriesC)
 	}
@@ -3187,7 +3222,7 @@ func (ptr *QBarCategoryAxis) SetRange(minCategory string, maxCategory string) {
 func (ptr *QBarCategoryAxis) DestroyQBarCategoryAxis() {
 	if ptr.Pointer() != nil {
 		C.QBarCategoryAxis_DestroyQBarCategoryAxis(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3260,7 +3295,7 @@ func NewQBarLegendMarkerFromPointer(ptr unsafe.Pointer) *QBarLegendMarker {
 
 //export callbackQBarLegendMarker_Series
 func callbackQBarLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "series"); signal != nil {
+	if signal := qt.GetSignal(ptr, "series"); signal != nil {
 		return PointerFromQAbstractBarSeries(signal.(func() *QAbstractBarSeries)())
 	}
 
@@ -3270,14 +3305,14 @@ func callbackQBarLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QBarLegendMarker) ConnectSeries(f func() *QAbstractBarSeries) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "series", f)
+		qt.ConnectSignal(ptr.Pointer(), "series", f)
 	}
 }
 
 func (ptr *QBarLegendMarker) DisconnectSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "series")
+		qt.DisconnectSignal(ptr.Pointer(), "series")
 	}
 }
 
@@ -3304,7 +3339,7 @@ func (ptr *QBarLegendMarker) Barset() *QBarSet {
 
 //export callbackQBarLegendMarker_DestroyQBarLegendMarker
 func callbackQBarLegendMarker_DestroyQBarLegendMarker(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QBarLegendMarker"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QBarLegendMarker"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQBarLegendMarkerFromPointer(ptr).DestroyQBarLegendMarkerDefault()
@@ -3314,21 +3349,21 @@ func callbackQBarLegendMarker_DestroyQBarLegendMarker(ptr unsafe.Pointer) {
 func (ptr *QBarLegendMarker) ConnectDestroyQBarLegendMarker(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QBarLegendMarker", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QBarLegendMarker", f)
 	}
 }
 
 func (ptr *QBarLegendMarker) DisconnectDestroyQBarLegendMarker() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QBarLegendMarker")
+		qt.DisconnectSignal(ptr.Pointer(), "~QBarLegendMarker")
 	}
 }
 
 func (ptr *QBarLegendMarker) DestroyQBarLegendMarker() {
 	if ptr.Pointer() != nil {
 		C.QBarLegendMarker_DestroyQBarLegendMarker(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3336,7 +3371,7 @@ func (ptr *QBarLegendMarker) DestroyQBarLegendMarker() {
 func (ptr *QBarLegendMarker) DestroyQBarLegendMarkerDefault() {
 	if ptr.Pointer() != nil {
 		C.QBarLegendMarker_DestroyQBarLegendMarkerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3385,14 +3420,14 @@ func NewQBarSeries(parent core.QObject_ITF) *QBarSeries {
 func (ptr *QBarSeries) DestroyQBarSeries() {
 	if ptr.Pointer() != nil {
 		C.QBarSeries_DestroyQBarSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQBarSeries_Type
 func callbackQBarSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -3402,14 +3437,14 @@ func callbackQBarSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QBarSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QBarSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -3499,13 +3534,13 @@ func (ptr *QBarSet) LabelColor() *gui.QColor {
 
 func (ptr *QBarSet) Append2(values []float64) {
 	if ptr.Pointer() != nil {
-		C.QBarSet_Append2(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQBarSetFromPointer(NewQBarSetFromPointer(nil).__append_values_newList2())
-			for _, v := range values {
-				tmpList.__append_values_setList2(v)
+		C.QBarSet_Append2(ptr.Pointer(), func(l []float64) unsafe.Pointer {
+			var tmpList = make([]C.double, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.double(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQBarSetFromPointer(nil).__append_values_newListBuffer2(unsafe.Pointer(&tmpList[0]), len(l))
+		}(values))
 	}
 }
 
@@ -3517,7 +3552,7 @@ func (ptr *QBarSet) Append(value float64) {
 
 //export callbackQBarSet_BorderColorChanged
 func callbackQBarSet_BorderColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "borderColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "borderColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3526,14 +3561,14 @@ func callbackQBarSet_BorderColorChanged(ptr unsafe.Pointer, color unsafe.Pointer
 func (ptr *QBarSet) ConnectBorderColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectBorderColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "borderColorChanged", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectBorderColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectBorderColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "borderColorChanged")
 	}
 }
 
@@ -3545,7 +3580,7 @@ func (ptr *QBarSet) BorderColorChanged(color gui.QColor_ITF) {
 
 //export callbackQBarSet_BrushChanged
 func callbackQBarSet_BrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "brushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "brushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3554,14 +3589,14 @@ func callbackQBarSet_BrushChanged(ptr unsafe.Pointer) {
 func (ptr *QBarSet) ConnectBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "brushChanged", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "brushChanged")
 	}
 }
 
@@ -3573,7 +3608,7 @@ func (ptr *QBarSet) BrushChanged() {
 
 //export callbackQBarSet_Clicked
 func callbackQBarSet_Clicked(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -3582,14 +3617,14 @@ func callbackQBarSet_Clicked(ptr unsafe.Pointer, index C.int) {
 func (ptr *QBarSet) ConnectClicked(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -3601,7 +3636,7 @@ func (ptr *QBarSet) Clicked(index int) {
 
 //export callbackQBarSet_ColorChanged
 func callbackQBarSet_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3610,14 +3645,14 @@ func callbackQBarSet_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
 func (ptr *QBarSet) ConnectColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorChanged", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorChanged")
 	}
 }
 
@@ -3629,7 +3664,7 @@ func (ptr *QBarSet) ColorChanged(color gui.QColor_ITF) {
 
 //export callbackQBarSet_DoubleClicked
 func callbackQBarSet_DoubleClicked(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -3638,14 +3673,14 @@ func callbackQBarSet_DoubleClicked(ptr unsafe.Pointer, index C.int) {
 func (ptr *QBarSet) ConnectDoubleClicked(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -3657,7 +3692,7 @@ func (ptr *QBarSet) DoubleClicked(index int) {
 
 //export callbackQBarSet_Hovered
 func callbackQBarSet_Hovered(ptr unsafe.Pointer, status C.char, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(bool, int))(int8(status) != 0, int(int32(index)))
 	}
 
@@ -3666,14 +3701,14 @@ func callbackQBarSet_Hovered(ptr unsafe.Pointer, status C.char, index C.int) {
 func (ptr *QBarSet) ConnectHovered(f func(status bool, index int)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -3691,7 +3726,7 @@ func (ptr *QBarSet) Insert(index int, value float64) {
 
 //export callbackQBarSet_LabelBrushChanged
 func callbackQBarSet_LabelBrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelBrushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelBrushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3700,14 +3735,14 @@ func callbackQBarSet_LabelBrushChanged(ptr unsafe.Pointer) {
 func (ptr *QBarSet) ConnectLabelBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectLabelBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelBrushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelBrushChanged", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectLabelBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectLabelBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelBrushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelBrushChanged")
 	}
 }
 
@@ -3719,7 +3754,7 @@ func (ptr *QBarSet) LabelBrushChanged() {
 
 //export callbackQBarSet_LabelChanged
 func callbackQBarSet_LabelChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3728,14 +3763,14 @@ func callbackQBarSet_LabelChanged(ptr unsafe.Pointer) {
 func (ptr *QBarSet) ConnectLabelChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectLabelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelChanged", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectLabelChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectLabelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelChanged")
 	}
 }
 
@@ -3747,7 +3782,7 @@ func (ptr *QBarSet) LabelChanged() {
 
 //export callbackQBarSet_LabelColorChanged
 func callbackQBarSet_LabelColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3756,14 +3791,14 @@ func callbackQBarSet_LabelColorChanged(ptr unsafe.Pointer, color unsafe.Pointer)
 func (ptr *QBarSet) ConnectLabelColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectLabelColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelColorChanged", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectLabelColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectLabelColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelColorChanged")
 	}
 }
 
@@ -3775,7 +3810,7 @@ func (ptr *QBarSet) LabelColorChanged(color gui.QColor_ITF) {
 
 //export callbackQBarSet_LabelFontChanged
 func callbackQBarSet_LabelFontChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelFontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelFontChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3784,14 +3819,14 @@ func callbackQBarSet_LabelFontChanged(ptr unsafe.Pointer) {
 func (ptr *QBarSet) ConnectLabelFontChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectLabelFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelFontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelFontChanged", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectLabelFontChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectLabelFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelFontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelFontChanged")
 	}
 }
 
@@ -3803,7 +3838,7 @@ func (ptr *QBarSet) LabelFontChanged() {
 
 //export callbackQBarSet_PenChanged
 func callbackQBarSet_PenChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "penChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "penChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3812,14 +3847,14 @@ func callbackQBarSet_PenChanged(ptr unsafe.Pointer) {
 func (ptr *QBarSet) ConnectPenChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectPenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "penChanged", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectPenChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectPenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "penChanged")
 	}
 }
 
@@ -3831,7 +3866,7 @@ func (ptr *QBarSet) PenChanged() {
 
 //export callbackQBarSet_Pressed
 func callbackQBarSet_Pressed(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -3840,14 +3875,14 @@ func callbackQBarSet_Pressed(ptr unsafe.Pointer, index C.int) {
 func (ptr *QBarSet) ConnectPressed(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -3859,7 +3894,7 @@ func (ptr *QBarSet) Pressed(index int) {
 
 //export callbackQBarSet_Released
 func callbackQBarSet_Released(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -3868,14 +3903,14 @@ func callbackQBarSet_Released(ptr unsafe.Pointer, index C.int) {
 func (ptr *QBarSet) ConnectReleased(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -3949,7 +3984,7 @@ func (ptr *QBarSet) SetPen(pen gui.QPen_ITF) {
 
 //export callbackQBarSet_ValueChanged
 func callbackQBarSet_ValueChanged(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueChanged"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -3958,14 +3993,14 @@ func callbackQBarSet_ValueChanged(ptr unsafe.Pointer, index C.int) {
 func (ptr *QBarSet) ConnectValueChanged(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectValueChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueChanged", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectValueChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectValueChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valueChanged")
 	}
 }
 
@@ -3977,7 +4012,7 @@ func (ptr *QBarSet) ValueChanged(index int) {
 
 //export callbackQBarSet_ValuesAdded
 func callbackQBarSet_ValuesAdded(ptr unsafe.Pointer, index C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valuesAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valuesAdded"); signal != nil {
 		signal.(func(int, int))(int(int32(index)), int(int32(count)))
 	}
 
@@ -3986,14 +4021,14 @@ func callbackQBarSet_ValuesAdded(ptr unsafe.Pointer, index C.int, count C.int) {
 func (ptr *QBarSet) ConnectValuesAdded(f func(index int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectValuesAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valuesAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "valuesAdded", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectValuesAdded() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectValuesAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valuesAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "valuesAdded")
 	}
 }
 
@@ -4005,7 +4040,7 @@ func (ptr *QBarSet) ValuesAdded(index int, count int) {
 
 //export callbackQBarSet_ValuesRemoved
 func callbackQBarSet_ValuesRemoved(ptr unsafe.Pointer, index C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valuesRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valuesRemoved"); signal != nil {
 		signal.(func(int, int))(int(int32(index)), int(int32(count)))
 	}
 
@@ -4014,14 +4049,14 @@ func callbackQBarSet_ValuesRemoved(ptr unsafe.Pointer, index C.int, count C.int)
 func (ptr *QBarSet) ConnectValuesRemoved(f func(index int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QBarSet_ConnectValuesRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valuesRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "valuesRemoved", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectValuesRemoved() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DisconnectValuesRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valuesRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "valuesRemoved")
 	}
 }
 
@@ -4033,7 +4068,7 @@ func (ptr *QBarSet) ValuesRemoved(index int, count int) {
 
 //export callbackQBarSet_DestroyQBarSet
 func callbackQBarSet_DestroyQBarSet(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QBarSet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QBarSet"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQBarSetFromPointer(ptr).DestroyQBarSetDefault()
@@ -4043,21 +4078,21 @@ func callbackQBarSet_DestroyQBarSet(ptr unsafe.Pointer) {
 func (ptr *QBarSet) ConnectDestroyQBarSet(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QBarSet", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QBarSet", f)
 	}
 }
 
 func (ptr *QBarSet) DisconnectDestroyQBarSet() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QBarSet")
+		qt.DisconnectSignal(ptr.Pointer(), "~QBarSet")
 	}
 }
 
 func (ptr *QBarSet) DestroyQBarSet() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DestroyQBarSet(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4065,7 +4100,7 @@ func (ptr *QBarSet) DestroyQBarSet() {
 func (ptr *QBarSet) DestroyQBarSetDefault() {
 	if ptr.Pointer() != nil {
 		C.QBarSet_DestroyQBarSetDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4151,6 +4186,16 @@ func (ptr *QBarSet) __append_values_newList2() unsafe.Pointer {
 	return unsafe.Pointer(C.QBarSet___append_values_newList2(ptr.Pointer()))
 }
 
+func (ptr *QBarSet) __append_values_newListBuffer2(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QBarSet___append_values_newListBuffer2(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QBarSet) __append_values_fillList2(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QBarSet___append_values_fillList2(ptr.Pointer(), data)
+	}
+}
+
 type QBoxPlotLegendMarker struct {
 	ptr unsafe.Pointer
 }
@@ -4191,7 +4236,7 @@ func NewQBoxPlotLegendMarkerFromPointer(ptr unsafe.Pointer) *QBoxPlotLegendMarke
 
 //export callbackQBoxPlotLegendMarker_Series
 func callbackQBoxPlotLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "series"); signal != nil {
+	if signal := qt.GetSignal(ptr, "series"); signal != nil {
 		return PointerFromQBoxPlotSeries(signal.(func() *QBoxPlotSeries)())
 	}
 
@@ -4201,14 +4246,14 @@ func callbackQBoxPlotLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QBoxPlotLegendMarker) ConnectSeries(f func() *QBoxPlotSeries) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "series", f)
+		qt.ConnectSignal(ptr.Pointer(), "series", f)
 	}
 }
 
 func (ptr *QBoxPlotLegendMarker) DisconnectSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "series")
+		qt.DisconnectSignal(ptr.Pointer(), "series")
 	}
 }
 
@@ -4228,7 +4273,7 @@ func (ptr *QBoxPlotLegendMarker) SeriesDefault() *QBoxPlotSeries {
 
 //export callbackQBoxPlotLegendMarker_DestroyQBoxPlotLegendMarker
 func callbackQBoxPlotLegendMarker_DestroyQBoxPlotLegendMarker(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QBoxPlotLegendMarker"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QBoxPlotLegendMarker"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQBoxPlotLegendMarkerFromPointer(ptr).DestroyQBoxPlotLegendMarkerDefault()
@@ -4238,21 +4283,21 @@ func callbackQBoxPlotLegendMarker_DestroyQBoxPlotLegendMarker(ptr unsafe.Pointer
 func (ptr *QBoxPlotLegendMarker) ConnectDestroyQBoxPlotLegendMarker(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QBoxPlotLegendMarker", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QBoxPlotLegendMarker", f)
 	}
 }
 
 func (ptr *QBoxPlotLegendMarker) DisconnectDestroyQBoxPlotLegendMarker() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QBoxPlotLegendMarker")
+		qt.DisconnectSignal(ptr.Pointer(), "~QBoxPlotLegendMarker")
 	}
 }
 
 func (ptr *QBoxPlotLegendMarker) DestroyQBoxPlotLegendMarker() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotLegendMarker_DestroyQBoxPlotLegendMarker(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4260,7 +4305,7 @@ func (ptr *QBoxPlotLegendMarker) DestroyQBoxPlotLegendMarker() {
 func (ptr *QBoxPlotLegendMarker) DestroyQBoxPlotLegendMarkerDefault() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotLegendMarker_DestroyQBoxPlotLegendMarkerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4363,7 +4408,7 @@ func (ptr *QBoxPlotSeries) BoxWidth() float64 {
 
 //export callbackQBoxPlotSeries_BoxOutlineVisibilityChanged
 func callbackQBoxPlotSeries_BoxOutlineVisibilityChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "boxOutlineVisibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "boxOutlineVisibilityChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4372,14 +4417,14 @@ func callbackQBoxPlotSeries_BoxOutlineVisibilityChanged(ptr unsafe.Pointer) {
 func (ptr *QBoxPlotSeries) ConnectBoxOutlineVisibilityChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectBoxOutlineVisibilityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "boxOutlineVisibilityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "boxOutlineVisibilityChanged", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectBoxOutlineVisibilityChanged() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectBoxOutlineVisibilityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "boxOutlineVisibilityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "boxOutlineVisibilityChanged")
 	}
 }
 
@@ -4391,7 +4436,7 @@ func (ptr *QBoxPlotSeries) BoxOutlineVisibilityChanged() {
 
 //export callbackQBoxPlotSeries_BoxWidthChanged
 func callbackQBoxPlotSeries_BoxWidthChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "boxWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "boxWidthChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4400,14 +4445,14 @@ func callbackQBoxPlotSeries_BoxWidthChanged(ptr unsafe.Pointer) {
 func (ptr *QBoxPlotSeries) ConnectBoxWidthChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectBoxWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "boxWidthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "boxWidthChanged", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectBoxWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectBoxWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "boxWidthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "boxWidthChanged")
 	}
 }
 
@@ -4419,7 +4464,7 @@ func (ptr *QBoxPlotSeries) BoxWidthChanged() {
 
 //export callbackQBoxPlotSeries_BoxsetsAdded
 func callbackQBoxPlotSeries_BoxsetsAdded(ptr unsafe.Pointer, sets C.struct_QtCharts_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "boxsetsAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "boxsetsAdded"); signal != nil {
 		signal.(func([]*QBoxSet))(func(l C.struct_QtCharts_PackedList) []*QBoxSet {
 			var out = make([]*QBoxSet, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -4434,14 +4479,14 @@ func callbackQBoxPlotSeries_BoxsetsAdded(ptr unsafe.Pointer, sets C.struct_QtCha
 func (ptr *QBoxPlotSeries) ConnectBoxsetsAdded(f func(sets []*QBoxSet)) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectBoxsetsAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "boxsetsAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "boxsetsAdded", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectBoxsetsAdded() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectBoxsetsAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "boxsetsAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "boxsetsAdded")
 	}
 }
 
@@ -4459,7 +4504,7 @@ func (ptr *QBoxPlotSeries) BoxsetsAdded(sets []*QBoxSet) {
 
 //export callbackQBoxPlotSeries_BoxsetsRemoved
 func callbackQBoxPlotSeries_BoxsetsRemoved(ptr unsafe.Pointer, sets C.struct_QtCharts_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "boxsetsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "boxsetsRemoved"); signal != nil {
 		signal.(func([]*QBoxSet))(func(l C.struct_QtCharts_PackedList) []*QBoxSet {
 			var out = make([]*QBoxSet, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -4474,14 +4519,14 @@ func callbackQBoxPlotSeries_BoxsetsRemoved(ptr unsafe.Pointer, sets C.struct_QtC
 func (ptr *QBoxPlotSeries) ConnectBoxsetsRemoved(f func(sets []*QBoxSet)) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectBoxsetsRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "boxsetsRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "boxsetsRemoved", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectBoxsetsRemoved() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectBoxsetsRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "boxsetsRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "boxsetsRemoved")
 	}
 }
 
@@ -4499,7 +4544,7 @@ func (ptr *QBoxPlotSeries) BoxsetsRemoved(sets []*QBoxSet) {
 
 //export callbackQBoxPlotSeries_BrushChanged
 func callbackQBoxPlotSeries_BrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "brushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "brushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4508,14 +4553,14 @@ func callbackQBoxPlotSeries_BrushChanged(ptr unsafe.Pointer) {
 func (ptr *QBoxPlotSeries) ConnectBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "brushChanged", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "brushChanged")
 	}
 }
 
@@ -4533,7 +4578,7 @@ func (ptr *QBoxPlotSeries) Clear() {
 
 //export callbackQBoxPlotSeries_Clicked
 func callbackQBoxPlotSeries_Clicked(ptr unsafe.Pointer, boxset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func(*QBoxSet))(NewQBoxSetFromPointer(boxset))
 	}
 
@@ -4542,14 +4587,14 @@ func callbackQBoxPlotSeries_Clicked(ptr unsafe.Pointer, boxset unsafe.Pointer) {
 func (ptr *QBoxPlotSeries) ConnectClicked(f func(boxset *QBoxSet)) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -4561,7 +4606,7 @@ func (ptr *QBoxPlotSeries) Clicked(boxset QBoxSet_ITF) {
 
 //export callbackQBoxPlotSeries_CountChanged
 func callbackQBoxPlotSeries_CountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "countChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "countChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4570,14 +4615,14 @@ func callbackQBoxPlotSeries_CountChanged(ptr unsafe.Pointer) {
 func (ptr *QBoxPlotSeries) ConnectCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "countChanged", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "countChanged")
 	}
 }
 
@@ -4589,7 +4634,7 @@ func (ptr *QBoxPlotSeries) CountChanged() {
 
 //export callbackQBoxPlotSeries_DoubleClicked
 func callbackQBoxPlotSeries_DoubleClicked(ptr unsafe.Pointer, boxset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func(*QBoxSet))(NewQBoxSetFromPointer(boxset))
 	}
 
@@ -4598,14 +4643,14 @@ func callbackQBoxPlotSeries_DoubleClicked(ptr unsafe.Pointer, boxset unsafe.Poin
 func (ptr *QBoxPlotSeries) ConnectDoubleClicked(f func(boxset *QBoxSet)) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -4617,7 +4662,7 @@ func (ptr *QBoxPlotSeries) DoubleClicked(boxset QBoxSet_ITF) {
 
 //export callbackQBoxPlotSeries_Hovered
 func callbackQBoxPlotSeries_Hovered(ptr unsafe.Pointer, status C.char, boxset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(bool, *QBoxSet))(int8(status) != 0, NewQBoxSetFromPointer(boxset))
 	}
 
@@ -4626,14 +4671,14 @@ func callbackQBoxPlotSeries_Hovered(ptr unsafe.Pointer, status C.char, boxset un
 func (ptr *QBoxPlotSeries) ConnectHovered(f func(status bool, boxset *QBoxSet)) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -4645,7 +4690,7 @@ func (ptr *QBoxPlotSeries) Hovered(status bool, boxset QBoxSet_ITF) {
 
 //export callbackQBoxPlotSeries_PenChanged
 func callbackQBoxPlotSeries_PenChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "penChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "penChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4654,14 +4699,14 @@ func callbackQBoxPlotSeries_PenChanged(ptr unsafe.Pointer) {
 func (ptr *QBoxPlotSeries) ConnectPenChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectPenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "penChanged", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectPenChanged() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectPenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "penChanged")
 	}
 }
 
@@ -4673,7 +4718,7 @@ func (ptr *QBoxPlotSeries) PenChanged() {
 
 //export callbackQBoxPlotSeries_Pressed
 func callbackQBoxPlotSeries_Pressed(ptr unsafe.Pointer, boxset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func(*QBoxSet))(NewQBoxSetFromPointer(boxset))
 	}
 
@@ -4682,14 +4727,14 @@ func callbackQBoxPlotSeries_Pressed(ptr unsafe.Pointer, boxset unsafe.Pointer) {
 func (ptr *QBoxPlotSeries) ConnectPressed(f func(boxset *QBoxSet)) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -4701,7 +4746,7 @@ func (ptr *QBoxPlotSeries) Pressed(boxset QBoxSet_ITF) {
 
 //export callbackQBoxPlotSeries_Released
 func callbackQBoxPlotSeries_Released(ptr unsafe.Pointer, boxset unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func(*QBoxSet))(NewQBoxSetFromPointer(boxset))
 	}
 
@@ -4710,14 +4755,14 @@ func callbackQBoxPlotSeries_Released(ptr unsafe.Pointer, boxset unsafe.Pointer)
 func (ptr *QBoxPlotSeries) ConnectReleased(f func(boxset *QBoxSet)) {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -4754,14 +4799,14 @@ func (ptr *QBoxPlotSeries) SetPen(pen gui.QPen_ITF) {
 func (ptr *QBoxPlotSeries) DestroyQBoxPlotSeries() {
 	if ptr.Pointer() != nil {
 		C.QBoxPlotSeries_DestroyQBoxPlotSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQBoxPlotSeries_Type
 func callbackQBoxPlotSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -4771,14 +4816,14 @@ func callbackQBoxPlotSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QBoxPlotSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QBoxPlotSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -4966,13 +5011,13 @@ func NewQBoxSet2(le float64, lq float64, m float64, uq float64, ue float64, labe
 
 func (ptr *QBoxSet) Append2(values []float64) {
 	if ptr.Pointer() != nil {
-		C.QBoxSet_Append2(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQBoxSetFromPointer(NewQBoxSetFromPointer(nil).__append_values_newList2())
-			for _, v := range values {
-				tmpList.__append_values_setList2(v)
+		C.QBoxSet_Append2(ptr.Pointer(), func(l []float64) unsafe.Pointer {
+			var tmpList = make([]C.double, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.double(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQBoxSetFromPointer(nil).__append_values_newListBuffer2(unsafe.Pointer(&tmpList[0]), len(l))
+		}(values))
 	}
 }
 
@@ -4984,7 +5029,7 @@ func (ptr *QBoxSet) Append(value float64) {
 
 //export callbackQBoxSet_BrushChanged
 func callbackQBoxSet_BrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "brushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "brushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4993,14 +5038,14 @@ func callbackQBoxSet_BrushChanged(ptr unsafe.Pointer) {
 func (ptr *QBoxSet) ConnectBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "brushChanged", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "brushChanged")
 	}
 }
 
@@ -5018,7 +5063,7 @@ func (ptr *QBoxSet) Clear() {
 
 //export callbackQBoxSet_Cleared
 func callbackQBoxSet_Cleared(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cleared"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cleared"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5027,14 +5072,14 @@ func callbackQBoxSet_Cleared(ptr unsafe.Pointer) {
 func (ptr *QBoxSet) ConnectCleared(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectCleared(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cleared", f)
+		qt.ConnectSignal(ptr.Pointer(), "cleared", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectCleared() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectCleared(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cleared")
+		qt.DisconnectSignal(ptr.Pointer(), "cleared")
 	}
 }
 
@@ -5046,7 +5091,7 @@ func (ptr *QBoxSet) Cleared() {
 
 //export callbackQBoxSet_Clicked
 func callbackQBoxSet_Clicked(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5055,14 +5100,14 @@ func callbackQBoxSet_Clicked(ptr unsafe.Pointer) {
 func (ptr *QBoxSet) ConnectClicked(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -5074,7 +5119,7 @@ func (ptr *QBoxSet) Clicked() {
 
 //export callbackQBoxSet_DoubleClicked
 func callbackQBoxSet_DoubleClicked(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5083,14 +5128,14 @@ func callbackQBoxSet_DoubleClicked(ptr unsafe.Pointer) {
 func (ptr *QBoxSet) ConnectDoubleClicked(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -5102,7 +5147,7 @@ func (ptr *QBoxSet) DoubleClicked() {
 
 //export callbackQBoxSet_Hovered
 func callbackQBoxSet_Hovered(ptr unsafe.Pointer, status C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(bool))(int8(status) != 0)
 	}
 
@@ -5111,14 +5156,14 @@ func callbackQBoxSet_Hovered(ptr unsafe.Pointer, status C.char) {
 func (ptr *QBoxSet) ConnectHovered(f func(status bool)) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -5130,7 +5175,7 @@ func (ptr *QBoxSet) Hovered(status bool) {
 
 //export callbackQBoxSet_PenChanged
 func callbackQBoxSet_PenChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "penChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "penChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5139,14 +5184,14 @@ func callbackQBoxSet_PenChanged(ptr unsafe.Pointer) {
 func (ptr *QBoxSet) ConnectPenChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectPenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "penChanged", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectPenChanged() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectPenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "penChanged")
 	}
 }
 
@@ -5158,7 +5203,7 @@ func (ptr *QBoxSet) PenChanged() {
 
 //export callbackQBoxSet_Pressed
 func callbackQBoxSet_Pressed(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5167,14 +5212,14 @@ func callbackQBoxSet_Pressed(ptr unsafe.Pointer) {
 func (ptr *QBoxSet) ConnectPressed(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -5186,7 +5231,7 @@ func (ptr *QBoxSet) Pressed() {
 
 //export callbackQBoxSet_Released
 func callbackQBoxSet_Released(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5195,14 +5240,14 @@ func callbackQBoxSet_Released(ptr unsafe.Pointer) {
 func (ptr *QBoxSet) ConnectReleased(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -5240,7 +5285,7 @@ func (ptr *QBoxSet) SetValue(index int, value float64) {
 
 //export callbackQBoxSet_ValueChanged
 func callbackQBoxSet_ValueChanged(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueChanged"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -5249,14 +5294,14 @@ func callbackQBoxSet_ValueChanged(ptr unsafe.Pointer, index C.int) {
 func (ptr *QBoxSet) ConnectValueChanged(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectValueChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueChanged", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectValueChanged() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectValueChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valueChanged")
 	}
 }
 
@@ -5268,7 +5313,7 @@ func (ptr *QBoxSet) ValueChanged(index int) {
 
 //export callbackQBoxSet_ValuesChanged
 func callbackQBoxSet_ValuesChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valuesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valuesChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5277,14 +5322,14 @@ func callbackQBoxSet_ValuesChanged(ptr unsafe.Pointer) {
 func (ptr *QBoxSet) ConnectValuesChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_ConnectValuesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valuesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valuesChanged", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectValuesChanged() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DisconnectValuesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valuesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valuesChanged")
 	}
 }
 
@@ -5296,7 +5341,7 @@ func (ptr *QBoxSet) ValuesChanged() {
 
 //export callbackQBoxSet_DestroyQBoxSet
 func callbackQBoxSet_DestroyQBoxSet(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QBoxSet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QBoxSet"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQBoxSetFromPointer(ptr).DestroyQBoxSetDefault()
@@ -5306,21 +5351,21 @@ func callbackQBoxSet_DestroyQBoxSet(ptr unsafe.Pointer) {
 func (ptr *QBoxSet) ConnectDestroyQBoxSet(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QBoxSet", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QBoxSet", f)
 	}
 }
 
 func (ptr *QBoxSet) DisconnectDestroyQBoxSet() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QBoxSet")
+		qt.DisconnectSignal(ptr.Pointer(), "~QBoxSet")
 	}
 }
 
 func (ptr *QBoxSet) DestroyQBoxSet() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DestroyQBoxSet(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5328,7 +5373,7 @@ func (ptr *QBoxSet) DestroyQBoxSet() {
 func (ptr *QBoxSet) DestroyQBoxSetDefault() {
 	if ptr.Pointer() != nil {
 		C.QBoxSet_DestroyQBoxSetDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5389,6 +5434,16 @@ func (ptr *QBoxSet) __append_values_newList2() unsafe.Pointer {
 	return unsafe.Pointer(C.QBoxSet___append_values_newList2(ptr.Pointer()))
 }
 
+func (ptr *QBoxSet) __append_values_newListBuffer2(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QBoxSet___append_values_newListBuffer2(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QBoxSet) __append_values_fillList2(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QBoxSet___append_values_fillList2(ptr.Pointer(), data)
+	}
+}
+
 type QCandlestickLegendMarker struct {
 	ptr unsafe.Pointer
 }
@@ -5429,7 +5484,7 @@ func NewQCandlestickLegendMarkerFromPointer(ptr unsafe.Pointer) *QCandlestickLeg
 
 //export callbackQCandlestickLegendMarker_Series
 func callbackQCandlestickLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "series"); signal != nil {
+	if signal := qt.GetSignal(ptr, "series"); signal != nil {
 		return PointerFromQCandlestickSeries(signal.(func() *QCandlestickSeries)())
 	}
 
@@ -5439,14 +5494,14 @@ func callbackQCandlestickLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer
 func (ptr *QCandlestickLegendMarker) ConnectSeries(f func() *QCandlestickSeries) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "series", f)
+		qt.ConnectSignal(ptr.Pointer(), "series", f)
 	}
 }
 
 func (ptr *QCandlestickLegendMarker) DisconnectSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "series")
+		qt.DisconnectSignal(ptr.Pointer(), "series")
 	}
 }
 
@@ -5466,7 +5521,7 @@ func (ptr *QCandlestickLegendMarker) SeriesDefault() *QCandlestickSeries {
 
 //export callbackQCandlestickLegendMarker_DestroyQCandlestickLegendMarker
 func callbackQCandlestickLegendMarker_DestroyQCandlestickLegendMarker(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QCandlestickLegendMarker"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QCandlestickLegendMarker"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQCandlestickLegendMarkerFromPointer(ptr).DestroyQCandlestickLegendMarkerDefault()
@@ -5476,21 +5531,21 @@ func callbackQCandlestickLegendMarker_DestroyQCandlestickLegendMarker(ptr unsafe
 func (ptr *QCandlestickLegendMarker) ConnectDestroyQCandlestickLegendMarker(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QCandlestickLegendMarker", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QCandlestickLegendMarker", f)
 	}
 }
 
 func (ptr *QCandlestickLegendMarker) DisconnectDestroyQCandlestickLegendMarker() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QCandlestickLegendMarker")
+		qt.DisconnectSignal(ptr.Pointer(), "~QCandlestickLegendMarker")
 	}
 }
 
 func (ptr *QCandlestickLegendMarker) DestroyQCandlestickLegendMarker() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickLegendMarker_DestroyQCandlestickLegendMarker(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5498,7 +5553,7 @@ func (ptr *QCandlestickLegendMarker) DestroyQCandlestickLegendMarker() {
 func (ptr *QCandlestickLegendMarker) DestroyQCandlestickLegendMarkerDefault() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickLegendMarker_DestroyQCandlestickLegendMarkerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5544,7 +5599,7 @@ func NewQCandlestickModelMapperFromPointer(ptr unsafe.Pointer) *QCandlestickMode
 func (ptr *QCandlestickModelMapper) DestroyQCandlestickModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5555,7 +5610,7 @@ func NewQCandlestickModelMapper(parent core.QObject_ITF) *QCandlestickModelMappe
 
 //export callbackQCandlestickModelMapper_ModelReplaced
 func callbackQCandlestickModelMapper_ModelReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5564,14 +5619,14 @@ func callbackQCandlestickModelMapper_ModelReplaced(ptr unsafe.Pointer) {
 func (ptr *QCandlestickModelMapper) ConnectModelReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickModelMapper_ConnectModelReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReplaced", f)
 	}
 }
 
 func (ptr *QCandlestickModelMapper) DisconnectModelReplaced() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickModelMapper_DisconnectModelReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReplaced")
 	}
 }
 
@@ -5583,7 +5638,7 @@ func (ptr *QCandlestickModelMapper) ModelReplaced() {
 
 //export callbackQCandlestickModelMapper_SeriesReplaced
 func callbackQCandlestickModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5592,14 +5647,14 @@ func callbackQCandlestickModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
 func (ptr *QCandlestickModelMapper) ConnectSeriesReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickModelMapper_ConnectSeriesReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesReplaced", f)
 	}
 }
 
 func (ptr *QCandlestickModelMapper) DisconnectSeriesReplaced() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickModelMapper_DisconnectSeriesReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesReplaced")
 	}
 }
 
@@ -5666,7 +5721,7 @@ func (ptr *QCandlestickModelMapper) SetTimestamp(timestamp int) {
 func (ptr *QCandlestickModelMapper) Model() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QCandlestickModelMapper_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5683,7 +5738,7 @@ func (ptr *QCandlestickModelMapper) Series() *QCandlestickSeries {
 
 //export callbackQCandlestickModelMapper_Orientation
 func callbackQCandlestickModelMapper_Orientation(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "orientation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "orientation"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__Orientation)())
 	}
 
@@ -5693,14 +5748,14 @@ func callbackQCandlestickModelMapper_Orientation(ptr unsafe.Pointer) C.longlong
 func (ptr *QCandlestickModelMapper) ConnectOrientation(f func() core.Qt__Orientation) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "orientation", f)
+		qt.ConnectSignal(ptr.Pointer(), "orientation", f)
 	}
 }
 
 func (ptr *QCandlestickModelMapper) DisconnectOrientation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "orientation")
+		qt.DisconnectSignal(ptr.Pointer(), "orientation")
 	}
 }
 
@@ -5857,7 +5912,7 @@ func (ptr *QCandlestickSeries) Take(set QCandlestickSet_ITF) bool {
 
 //export callbackQCandlestickSeries_BodyOutlineVisibilityChanged
 func callbackQCandlestickSeries_BodyOutlineVisibilityChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bodyOutlineVisibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bodyOutlineVisibilityChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5866,14 +5921,14 @@ func callbackQCandlestickSeries_BodyOutlineVisibilityChanged(ptr unsafe.Pointer)
 func (ptr *QCandlestickSeries) ConnectBodyOutlineVisibilityChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectBodyOutlineVisibilityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "bodyOutlineVisibilityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "bodyOutlineVisibilityChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectBodyOutlineVisibilityChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectBodyOutlineVisibilityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "bodyOutlineVisibilityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "bodyOutlineVisibilityChanged")
 	}
 }
 
@@ -5885,7 +5940,7 @@ func (ptr *QCandlestickSeries) BodyOutlineVisibilityChanged() {
 
 //export callbackQCandlestickSeries_BodyWidthChanged
 func callbackQCandlestickSeries_BodyWidthChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bodyWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bodyWidthChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5894,14 +5949,14 @@ func callbackQCandlestickSeries_BodyWidthChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectBodyWidthChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectBodyWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "bodyWidthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "bodyWidthChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectBodyWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectBodyWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "bodyWidthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "bodyWidthChanged")
 	}
 }
 
@@ -5913,7 +5968,7 @@ func (ptr *QCandlestickSeries) BodyWidthChanged() {
 
 //export callbackQCandlestickSeries_BrushChanged
 func callbackQCandlestickSeries_BrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "brushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "brushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5922,14 +5977,14 @@ func callbackQCandlestickSeries_BrushChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "brushChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "brushChanged")
 	}
 }
 
@@ -5941,7 +5996,7 @@ func (ptr *QCandlestickSeries) BrushChanged() {
 
 //export callbackQCandlestickSeries_CandlestickSetsAdded
 func callbackQCandlestickSeries_CandlestickSetsAdded(ptr unsafe.Pointer, sets C.struct_QtCharts_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "candlestickSetsAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "candlestickSetsAdded"); signal != nil {
 		signal.(func([]*QCandlestickSet))(func(l C.struct_QtCharts_PackedList) []*QCandlestickSet {
 			var out = make([]*QCandlestickSet, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -5956,14 +6011,14 @@ func callbackQCandlestickSeries_CandlestickSetsAdded(ptr unsafe.Pointer, sets C.
 func (ptr *QCandlestickSeries) ConnectCandlestickSetsAdded(f func(sets []*QCandlestickSet)) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectCandlestickSetsAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "candlestickSetsAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "candlestickSetsAdded", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectCandlestickSetsAdded() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectCandlestickSetsAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "candlestickSetsAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "candlestickSetsAdded")
 	}
 }
 
@@ -5981,7 +6036,7 @@ func (ptr *QCandlestickSeries) CandlestickSetsAdded(sets []*QCandlestickSet) {
 
 //export callbackQCandlestickSeries_CandlestickSetsRemoved
 func callbackQCandlestickSeries_CandlestickSetsRemoved(ptr unsafe.Pointer, sets C.struct_QtCharts_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "candlestickSetsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "candlestickSetsRemoved"); signal != nil {
 		signal.(func([]*QCandlestickSet))(func(l C.struct_QtCharts_PackedList) []*QCandlestickSet {
 			var out = make([]*QCandlestickSet, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -5996,14 +6051,14 @@ func callbackQCandlestickSeries_CandlestickSetsRemoved(ptr unsafe.Pointer, sets
 func (ptr *QCandlestickSeries) ConnectCandlestickSetsRemoved(f func(sets []*QCandlestickSet)) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectCandlestickSetsRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "candlestickSetsRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "candlestickSetsRemoved", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectCandlestickSetsRemoved() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectCandlestickSetsRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "candlestickSetsRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "candlestickSetsRemoved")
 	}
 }
 
@@ -6021,7 +6076,7 @@ func (ptr *QCandlestickSeries) CandlestickSetsRemoved(sets []*QCandlestickSet) {
 
 //export callbackQCandlestickSeries_CapsVisibilityChanged
 func callbackQCandlestickSeries_CapsVisibilityChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "capsVisibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "capsVisibilityChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6030,14 +6085,14 @@ func callbackQCandlestickSeries_CapsVisibilityChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectCapsVisibilityChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectCapsVisibilityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "capsVisibilityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "capsVisibilityChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectCapsVisibilityChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectCapsVisibilityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "capsVisibilityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "capsVisibilityChanged")
 	}
 }
 
@@ -6049,7 +6104,7 @@ func (ptr *QCandlestickSeries) CapsVisibilityChanged() {
 
 //export callbackQCandlestickSeries_CapsWidthChanged
 func callbackQCandlestickSeries_CapsWidthChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "capsWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "capsWidthChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6058,14 +6113,14 @@ func callbackQCandlestickSeries_CapsWidthChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectCapsWidthChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectCapsWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "capsWidthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "capsWidthChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectCapsWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectCapsWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "capsWidthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "capsWidthChanged")
 	}
 }
 
@@ -6083,7 +6138,7 @@ func (ptr *QCandlestickSeries) Clear() {
 
 //export callbackQCandlestickSeries_Clicked
 func callbackQCandlestickSeries_Clicked(ptr unsafe.Pointer, set unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func(*QCandlestickSet))(NewQCandlestickSetFromPointer(set))
 	}
 
@@ -6092,14 +6147,14 @@ func callbackQCandlestickSeries_Clicked(ptr unsafe.Pointer, set unsafe.Pointer)
 func (ptr *QCandlestickSeries) ConnectClicked(f func(set *QCandlestickSet)) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -6111,7 +6166,7 @@ func (ptr *QCandlestickSeries) Clicked(set QCandlestickSet_ITF) {
 
 //export callbackQCandlestickSeries_CountChanged
 func callbackQCandlestickSeries_CountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "countChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "countChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6120,14 +6175,14 @@ func callbackQCandlestickSeries_CountChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "countChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "countChanged")
 	}
 }
 
@@ -6139,7 +6194,7 @@ func (ptr *QCandlestickSeries) CountChanged() {
 
 //export callbackQCandlestickSeries_DecreasingColorChanged
 func callbackQCandlestickSeries_DecreasingColorChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "decreasingColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "decreasingColorChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6148,14 +6203,14 @@ func callbackQCandlestickSeries_DecreasingColorChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectDecreasingColorChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectDecreasingColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "decreasingColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "decreasingColorChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectDecreasingColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectDecreasingColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "decreasingColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "decreasingColorChanged")
 	}
 }
 
@@ -6167,7 +6222,7 @@ func (ptr *QCandlestickSeries) DecreasingColorChanged() {
 
 //export callbackQCandlestickSeries_DoubleClicked
 func callbackQCandlestickSeries_DoubleClicked(ptr unsafe.Pointer, set unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func(*QCandlestickSet))(NewQCandlestickSetFromPointer(set))
 	}
 
@@ -6176,14 +6231,14 @@ func callbackQCandlestickSeries_DoubleClicked(ptr unsafe.Pointer, set unsafe.Poi
 func (ptr *QCandlestickSeries) ConnectDoubleClicked(f func(set *QCandlestickSet)) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -6195,7 +6250,7 @@ func (ptr *QCandlestickSeries) DoubleClicked(set QCandlestickSet_ITF) {
 
 //export callbackQCandlestickSeries_Hovered
 func callbackQCandlestickSeries_Hovered(ptr unsafe.Pointer, status C.char, set unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(bool, *QCandlestickSet))(int8(status) != 0, NewQCandlestickSetFromPointer(set))
 	}
 
@@ -6204,14 +6259,14 @@ func callbackQCandlestickSeries_Hovered(ptr unsafe.Pointer, status C.char, set u
 func (ptr *QCandlestickSeries) ConnectHovered(f func(status bool, set *QCandlestickSet)) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -6223,7 +6278,7 @@ func (ptr *QCandlestickSeries) Hovered(status bool, set QCandlestickSet_ITF) {
 
 //export callbackQCandlestickSeries_IncreasingColorChanged
 func callbackQCandlestickSeries_IncreasingColorChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "increasingColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "increasingColorChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6232,14 +6287,14 @@ func callbackQCandlestickSeries_IncreasingColorChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectIncreasingColorChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectIncreasingColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "increasingColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "increasingColorChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectIncreasingColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectIncreasingColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "increasingColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "increasingColorChanged")
 	}
 }
 
@@ -6251,7 +6306,7 @@ func (ptr *QCandlestickSeries) IncreasingColorChanged() {
 
 //export callbackQCandlestickSeries_MaximumColumnWidthChanged
 func callbackQCandlestickSeries_MaximumColumnWidthChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maximumColumnWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maximumColumnWidthChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6260,14 +6315,14 @@ func callbackQCandlestickSeries_MaximumColumnWidthChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectMaximumColumnWidthChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectMaximumColumnWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maximumColumnWidthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maximumColumnWidthChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectMaximumColumnWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectMaximumColumnWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maximumColumnWidthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maximumColumnWidthChanged")
 	}
 }
 
@@ -6279,7 +6334,7 @@ func (ptr *QCandlestickSeries) MaximumColumnWidthChanged() {
 
 //export callbackQCandlestickSeries_MinimumColumnWidthChanged
 func callbackQCandlestickSeries_MinimumColumnWidthChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumColumnWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumColumnWidthChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6288,14 +6343,14 @@ func callbackQCandlestickSeries_MinimumColumnWidthChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectMinimumColumnWidthChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectMinimumColumnWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minimumColumnWidthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minimumColumnWidthChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectMinimumColumnWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectMinimumColumnWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minimumColumnWidthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minimumColumnWidthChanged")
 	}
 }
 
@@ -6307,7 +6362,7 @@ func (ptr *QCandlestickSeries) MinimumColumnWidthChanged() {
 
 //export callbackQCandlestickSeries_PenChanged
 func callbackQCandlestickSeries_PenChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "penChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "penChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6316,14 +6371,14 @@ func callbackQCandlestickSeries_PenChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSeries) ConnectPenChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectPenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "penChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectPenChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectPenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "penChanged")
 	}
 }
 
@@ -6335,7 +6390,7 @@ func (ptr *QCandlestickSeries) PenChanged() {
 
 //export callbackQCandlestickSeries_Pressed
 func callbackQCandlestickSeries_Pressed(ptr unsafe.Pointer, set unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func(*QCandlestickSet))(NewQCandlestickSetFromPointer(set))
 	}
 
@@ -6344,14 +6399,14 @@ func callbackQCandlestickSeries_Pressed(ptr unsafe.Pointer, set unsafe.Pointer)
 func (ptr *QCandlestickSeries) ConnectPressed(f func(set *QCandlestickSet)) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -6363,7 +6418,7 @@ func (ptr *QCandlestickSeries) Pressed(set QCandlestickSet_ITF) {
 
 //export callbackQCandlestickSeries_Released
 func callbackQCandlestickSeries_Released(ptr unsafe.Pointer, set unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func(*QCandlestickSet))(NewQCandlestickSetFromPointer(set))
 	}
 
@@ -6372,14 +6427,14 @@ func callbackQCandlestickSeries_Released(ptr unsafe.Pointer, set unsafe.Pointer)
 func (ptr *QCandlestickSeries) ConnectReleased(f func(set *QCandlestickSet)) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -6452,14 +6507,14 @@ func (ptr *QCandlestickSeries) SetPen(pen gui.QPen_ITF) {
 func (ptr *QCandlestickSeries) DestroyQCandlestickSeries() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSeries_DestroyQCandlestickSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQCandlestickSeries_Type
 func callbackQCandlestickSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -6469,14 +6524,14 @@ func callbackQCandlestickSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QCandlestickSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QCandlestickSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -6724,7 +6779,7 @@ func NewQCandlestickSet(timestamp float64, parent core.QObject_ITF) *QCandlestic
 
 //export callbackQCandlestickSet_BrushChanged
 func callbackQCandlestickSet_BrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "brushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "brushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6733,14 +6788,14 @@ func callbackQCandlestickSet_BrushChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "brushChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "brushChanged")
 	}
 }
 
@@ -6752,7 +6807,7 @@ func (ptr *QCandlestickSet) BrushChanged() {
 
 //export callbackQCandlestickSet_Clicked
 func callbackQCandlestickSet_Clicked(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6761,14 +6816,14 @@ func callbackQCandlestickSet_Clicked(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectClicked(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -6780,7 +6835,7 @@ func (ptr *QCandlestickSet) Clicked() {
 
 //export callbackQCandlestickSet_CloseChanged
 func callbackQCandlestickSet_CloseChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6789,14 +6844,14 @@ func callbackQCandlestickSet_CloseChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectCloseChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectCloseChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "closeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "closeChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectCloseChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectCloseChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "closeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "closeChanged")
 	}
 }
 
@@ -6808,7 +6863,7 @@ func (ptr *QCandlestickSet) CloseChanged() {
 
 //export callbackQCandlestickSet_DoubleClicked
 func callbackQCandlestickSet_DoubleClicked(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6817,14 +6872,14 @@ func callbackQCandlestickSet_DoubleClicked(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectDoubleClicked(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -6836,7 +6891,7 @@ func (ptr *QCandlestickSet) DoubleClicked() {
 
 //export callbackQCandlestickSet_HighChanged
 func callbackQCandlestickSet_HighChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "highChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "highChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6845,14 +6900,14 @@ func callbackQCandlestickSet_HighChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectHighChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectHighChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "highChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "highChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectHighChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectHighChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "highChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "highChanged")
 	}
 }
 
@@ -6864,7 +6919,7 @@ func (ptr *QCandlestickSet) HighChanged() {
 
 //export callbackQCandlestickSet_Hovered
 func callbackQCandlestickSet_Hovered(ptr unsafe.Pointer, status C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(bool))(int8(status) != 0)
 	}
 
@@ -6873,14 +6928,14 @@ func callbackQCandlestickSet_Hovered(ptr unsafe.Pointer, status C.char) {
 func (ptr *QCandlestickSet) ConnectHovered(f func(status bool)) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -6892,7 +6947,7 @@ func (ptr *QCandlestickSet) Hovered(status bool) {
 
 //export callbackQCandlestickSet_LowChanged
 func callbackQCandlestickSet_LowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6901,14 +6956,14 @@ func callbackQCandlestickSet_LowChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectLowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectLowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lowChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectLowChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectLowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lowChanged")
 	}
 }
 
@@ -6920,7 +6975,7 @@ func (ptr *QCandlestickSet) LowChanged() {
 
 //export callbackQCandlestickSet_OpenChanged
 func callbackQCandlestickSet_OpenChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "openChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "openChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6929,14 +6984,14 @@ func callbackQCandlestickSet_OpenChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectOpenChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectOpenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "openChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "openChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectOpenChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectOpenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "openChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "openChanged")
 	}
 }
 
@@ -6948,7 +7003,7 @@ func (ptr *QCandlestickSet) OpenChanged() {
 
 //export callbackQCandlestickSet_PenChanged
 func callbackQCandlestickSet_PenChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "penChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "penChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6957,14 +7012,14 @@ func callbackQCandlestickSet_PenChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectPenChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectPenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "penChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectPenChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectPenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "penChanged")
 	}
 }
 
@@ -6976,7 +7031,7 @@ func (ptr *QCandlestickSet) PenChanged() {
 
 //export callbackQCandlestickSet_Pressed
 func callbackQCandlestickSet_Pressed(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6985,14 +7040,14 @@ func callbackQCandlestickSet_Pressed(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectPressed(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -7004,7 +7059,7 @@ func (ptr *QCandlestickSet) Pressed() {
 
 //export callbackQCandlestickSet_Released
 func callbackQCandlestickSet_Released(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7013,14 +7068,14 @@ func callbackQCandlestickSet_Released(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectReleased(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -7074,7 +7129,7 @@ func (ptr *QCandlestickSet) SetTimestamp(timestamp float64) {
 
 //export callbackQCandlestickSet_TimestampChanged
 func callbackQCandlestickSet_TimestampChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timestampChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timestampChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7083,14 +7138,14 @@ func callbackQCandlestickSet_TimestampChanged(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectTimestampChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_ConnectTimestampChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "timestampChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "timestampChanged", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectTimestampChanged() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DisconnectTimestampChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "timestampChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "timestampChanged")
 	}
 }
 
@@ -7102,7 +7157,7 @@ func (ptr *QCandlestickSet) TimestampChanged() {
 
 //export callbackQCandlestickSet_DestroyQCandlestickSet
 func callbackQCandlestickSet_DestroyQCandlestickSet(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QCandlestickSet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QCandlestickSet"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQCandlestickSetFromPointer(ptr).DestroyQCandlestickSetDefault()
@@ -7112,21 +7167,21 @@ func callbackQCandlestickSet_DestroyQCandlestickSet(ptr unsafe.Pointer) {
 func (ptr *QCandlestickSet) ConnectDestroyQCandlestickSet(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QCandlestickSet", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QCandlestickSet", f)
 	}
 }
 
 func (ptr *QCandlestickSet) DisconnectDestroyQCandlestickSet() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QCandlestickSet")
+		qt.DisconnectSignal(ptr.Pointer(), "~QCandlestickSet")
 	}
 }
 
 func (ptr *QCandlestickSet) DestroyQCandlestickSet() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DestroyQCandlestickSet(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7134,7 +7189,7 @@ func (ptr *QCandlestickSet) DestroyQCandlestickSet() {
 func (ptr *QCandlestickSet) DestroyQCandlestickSetDefault() {
 	if ptr.Pointer() != nil {
 		C.QCandlestickSet_DestroyQCandlestickSetDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7245,7 +7300,7 @@ func NewQCategoryAxis(parent core.QObject_ITF) *QCategoryAxis {
 
 func (ptr *QCategoryAxis) CategoriesLabels() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QCategoryAxis_CategoriesLabels(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QCategoryAxis_CategoriesLabels(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -7260,7 +7315,7 @@ func (ptr *QCategoryAxis) Append(categoryLabel string, categoryEndValue float64)
 
 //export callbackQCategoryAxis_CategoriesChanged
 func callbackQCategoryAxis_CategoriesChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "categoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "categoriesChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7269,14 +7324,14 @@ func callbackQCategoryAxis_CategoriesChanged(ptr unsafe.Pointer) {
 func (ptr *QCategoryAxis) ConnectCategoriesChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCategoryAxis_ConnectCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "categoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "categoriesChanged", f)
 	}
 }
 
 func (ptr *QCategoryAxis) DisconnectCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QCategoryAxis_DisconnectCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "categoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "categoriesChanged")
 	}
 }
 
@@ -7288,7 +7343,7 @@ func (ptr *QCategoryAxis) CategoriesChanged() {
 
 //export callbackQCategoryAxis_LabelsPositionChanged
 func callbackQCategoryAxis_LabelsPositionChanged(ptr unsafe.Pointer, position C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsPositionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsPositionChanged"); signal != nil {
 		signal.(func(QCategoryAxis__AxisLabelsPosition))(QCategoryAxis__AxisLabelsPosition(position))
 	}
 
@@ -7297,14 +7352,14 @@ func callbackQCategoryAxis_LabelsPositionChanged(ptr unsafe.Pointer, position C.
 func (ptr *QCategoryAxis) ConnectLabelsPositionChanged(f func(position QCategoryAxis__AxisLabelsPosition)) {
 	if ptr.Pointer() != nil {
 		C.QCategoryAxis_ConnectLabelsPositionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsPositionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsPositionChanged", f)
 	}
 }
 
 func (ptr *QCategoryAxis) DisconnectLabelsPositionChanged() {
 	if ptr.Pointer() != nil {
 		C.QCategoryAxis_DisconnectLabelsPositionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsPositionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsPositionChanged")
 	}
 }
 
@@ -7347,7 +7402,7 @@ func (ptr *QCategoryAxis) SetStartValue(min float64) {
 func (ptr *QCategoryAxis) DestroyQCategoryAxis() {
 	if ptr.Pointer() != nil {
 		C.QCategoryAxis_DestroyQCategoryAxis(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7513,7 +7568,7 @@ func (ptr *QChart) CreateDefaultAxes() {
 
 //export callbackQChart_PlotAreaChanged
 func callbackQChart_PlotAreaChanged(ptr unsafe.Pointer, plotArea unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "plotAreaChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "plotAreaChanged"); signal != nil {
 		signal.(func(*core.QRectF))(core.NewQRectFFromPointer(plotArea))
 	}
 
@@ -7522,14 +7577,14 @@ func callbackQChart_PlotAreaChanged(ptr unsafe.Pointer, plotArea unsafe.Pointer)
 func (ptr *QChart) ConnectPlotAreaChanged(f func(plotArea *core.QRectF)) {
 	if ptr.Pointer() != nil {
 		C.QChart_ConnectPlotAreaChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "plotAreaChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "plotAreaChanged", f)
 	}
 }
 
 func (ptr *QChart) DisconnectPlotAreaChanged() {
 	if ptr.Pointer() != nil {
 		C.QChart_DisconnectPlotAreaChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "plotAreaChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "plotAreaChanged")
 	}
 }
 
@@ -7712,7 +7767,7 @@ func (ptr *QChart) ZoomReset() {
 func (ptr *QChart) DestroyQChart() {
 	if ptr.Pointer() != nil {
 		C.QChart_DestroyQChart(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8119,7 +8174,7 @@ func NewQDateTimeAxis(parent core.QObject_ITF) *QDateTimeAxis {
 
 //export callbackQDateTimeAxis_FormatChanged
 func callbackQDateTimeAxis_FormatChanged(ptr unsafe.Pointer, format C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formatChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(format))
 	}
 
@@ -8128,14 +8183,14 @@ func callbackQDateTimeAxis_FormatChanged(ptr unsafe.Pointer, format C.struct_QtC
 func (ptr *QDateTimeAxis) ConnectFormatChanged(f func(format string)) {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_ConnectFormatChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "formatChanged", f)
 	}
 }
 
 func (ptr *QDateTimeAxis) DisconnectFormatChanged() {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_DisconnectFormatChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "formatChanged")
 	}
 }
 
@@ -8149,7 +8204,7 @@ func (ptr *QDateTimeAxis) FormatChanged(format string) {
 
 //export callbackQDateTimeAxis_MaxChanged
 func callbackQDateTimeAxis_MaxChanged(ptr unsafe.Pointer, max unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maxChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maxChanged"); signal != nil {
 		signal.(func(*core.QDateTime))(core.NewQDateTimeFromPointer(max))
 	}
 
@@ -8158,14 +8213,14 @@ func callbackQDateTimeAxis_MaxChanged(ptr unsafe.Pointer, max unsafe.Pointer) {
 func (ptr *QDateTimeAxis) ConnectMaxChanged(f func(max *core.QDateTime)) {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_ConnectMaxChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maxChanged", f)
 	}
 }
 
 func (ptr *QDateTimeAxis) DisconnectMaxChanged() {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_DisconnectMaxChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maxChanged")
 	}
 }
 
@@ -8177,7 +8232,7 @@ func (ptr *QDateTimeAxis) MaxChanged(max core.QDateTime_ITF) {
 
 //export callbackQDateTimeAxis_MinChanged
 func callbackQDateTimeAxis_MinChanged(ptr unsafe.Pointer, min unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minChanged"); signal != nil {
 		signal.(func(*core.QDateTime))(core.NewQDateTimeFromPointer(min))
 	}
 
@@ -8186,14 +8241,14 @@ func callbackQDateTimeAxis_MinChanged(ptr unsafe.Pointer, min unsafe.Pointer) {
 func (ptr *QDateTimeAxis) ConnectMinChanged(f func(min *core.QDateTime)) {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_ConnectMinChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minChanged", f)
 	}
 }
 
 func (ptr *QDateTimeAxis) DisconnectMinChanged() {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_DisconnectMinChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minChanged")
 	}
 }
 
@@ -8205,7 +8260,7 @@ func (ptr *QDateTimeAxis) MinChanged(min core.QDateTime_ITF) {
 
 //export callbackQDateTimeAxis_RangeChanged
 func callbackQDateTimeAxis_RangeChanged(ptr unsafe.Pointer, min unsafe.Pointer, max unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rangeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rangeChanged"); signal != nil {
 		signal.(func(*core.QDateTime, *core.QDateTime))(core.NewQDateTimeFromPointer(min), core.NewQDateTimeFromPointer(max))
 	}
 
@@ -8214,14 +8269,14 @@ func callbackQDateTimeAxis_RangeChanged(ptr unsafe.Pointer, min unsafe.Pointer,
 func (ptr *QDateTimeAxis) ConnectRangeChanged(f func(min *core.QDateTime, max *core.QDateTime)) {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_ConnectRangeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rangeChanged", f)
 	}
 }
 
 func (ptr *QDateTimeAxis) DisconnectRangeChanged() {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_DisconnectRangeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rangeChanged")
 	}
 }
 
@@ -8265,7 +8320,7 @@ func (ptr *QDateTimeAxis) SetTickCount(count int) {
 
 //export callbackQDateTimeAxis_TickCountChanged
 func callbackQDateTimeAxis_TickCountChanged(ptr unsafe.Pointer, tickCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tickCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tickCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(tickCount)))
 	}
 
@@ -8274,14 +8329,14 @@ func callbackQDateTimeAxis_TickCountChanged(ptr unsafe.Pointer, tickCount C.int)
 func (ptr *QDateTimeAxis) ConnectTickCountChanged(f func(tickCount int)) {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_ConnectTickCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "tickCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "tickCountChanged", f)
 	}
 }
 
 func (ptr *QDateTimeAxis) DisconnectTickCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_DisconnectTickCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "tickCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "tickCountChanged")
 	}
 }
 
@@ -8294,7 +8349,7 @@ func (ptr *QDateTimeAxis) TickCountChanged(tickCount int) {
 func (ptr *QDateTimeAxis) DestroyQDateTimeAxis() {
 	if ptr.Pointer() != nil {
 		C.QDateTimeAxis_DestroyQDateTimeAxis(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8372,7 +8427,7 @@ func NewQHBarModelMapperFromPointer(ptr unsafe.Pointer) *QHBarModelMapper {
 func (ptr *QHBarModelMapper) DestroyQHBarModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8383,7 +8438,7 @@ func NewQHBarModelMapper(parent core.QObject_ITF) *QHBarModelMapper {
 
 //export callbackQHBarModelMapper_ColumnCountChanged
 func callbackQHBarModelMapper_ColumnCountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCountChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8392,14 +8447,14 @@ func callbackQHBarModelMapper_ColumnCountChanged(ptr unsafe.Pointer) {
 func (ptr *QHBarModelMapper) ConnectColumnCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_ConnectColumnCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCountChanged", f)
 	}
 }
 
 func (ptr *QHBarModelMapper) DisconnectColumnCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_DisconnectColumnCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCountChanged")
 	}
 }
 
@@ -8411,7 +8466,7 @@ func (ptr *QHBarModelMapper) ColumnCountChanged() {
 
 //export callbackQHBarModelMapper_FirstBarSetRowChanged
 func callbackQHBarModelMapper_FirstBarSetRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstBarSetRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstBarSetRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8420,14 +8475,14 @@ func callbackQHBarModelMapper_FirstBarSetRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHBarModelMapper) ConnectFirstBarSetRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_ConnectFirstBarSetRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstBarSetRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstBarSetRowChanged", f)
 	}
 }
 
 func (ptr *QHBarModelMapper) DisconnectFirstBarSetRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_DisconnectFirstBarSetRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstBarSetRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstBarSetRowChanged")
 	}
 }
 
@@ -8439,7 +8494,7 @@ func (ptr *QHBarModelMapper) FirstBarSetRowChanged() {
 
 //export callbackQHBarModelMapper_FirstColumnChanged
 func callbackQHBarModelMapper_FirstColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8448,14 +8503,14 @@ func callbackQHBarModelMapper_FirstColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QHBarModelMapper) ConnectFirstColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_ConnectFirstColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstColumnChanged", f)
 	}
 }
 
 func (ptr *QHBarModelMapper) DisconnectFirstColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_DisconnectFirstColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstColumnChanged")
 	}
 }
 
@@ -8467,7 +8522,7 @@ func (ptr *QHBarModelMapper) FirstColumnChanged() {
 
 //export callbackQHBarModelMapper_LastBarSetRowChanged
 func callbackQHBarModelMapper_LastBarSetRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lastBarSetRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lastBarSetRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8476,14 +8531,14 @@ func callbackQHBarModelMapper_LastBarSetRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHBarModelMapper) ConnectLastBarSetRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_ConnectLastBarSetRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lastBarSetRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lastBarSetRowChanged", f)
 	}
 }
 
 func (ptr *QHBarModelMapper) DisconnectLastBarSetRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_DisconnectLastBarSetRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lastBarSetRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lastBarSetRowChanged")
 	}
 }
 
@@ -8495,7 +8550,7 @@ func (ptr *QHBarModelMapper) LastBarSetRowChanged() {
 
 //export callbackQHBarModelMapper_ModelReplaced
 func callbackQHBarModelMapper_ModelReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8504,14 +8559,14 @@ func callbackQHBarModelMapper_ModelReplaced(ptr unsafe.Pointer) {
 func (ptr *QHBarModelMapper) ConnectModelReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_ConnectModelReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReplaced", f)
 	}
 }
 
 func (ptr *QHBarModelMapper) DisconnectModelReplaced() {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_DisconnectModelReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReplaced")
 	}
 }
 
@@ -8523,7 +8578,7 @@ func (ptr *QHBarModelMapper) ModelReplaced() {
 
 //export callbackQHBarModelMapper_SeriesReplaced
 func callbackQHBarModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8532,14 +8587,14 @@ func callbackQHBarModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
 func (ptr *QHBarModelMapper) ConnectSeriesReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_ConnectSeriesReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesReplaced", f)
 	}
 }
 
 func (ptr *QHBarModelMapper) DisconnectSeriesReplaced() {
 	if ptr.Pointer() != nil {
 		C.QHBarModelMapper_DisconnectSeriesReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesReplaced")
 	}
 }
 
@@ -8595,7 +8650,7 @@ func (ptr *QHBarModelMapper) Series() *QAbstractBarSeries {
 func (ptr *QHBarModelMapper) Model() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QHBarModelMapper_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8672,7 +8727,7 @@ func NewQHBoxPlotModelMapperFromPointer(ptr unsafe.Pointer) *QHBoxPlotModelMappe
 func (ptr *QHBoxPlotModelMapper) DestroyQHBoxPlotModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8683,7 +8738,7 @@ func NewQHBoxPlotModelMapper(parent core.QObject_ITF) *QHBoxPlotModelMapper {
 
 //export callbackQHBoxPlotModelMapper_ColumnCountChanged
 func callbackQHBoxPlotModelMapper_ColumnCountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCountChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8692,14 +8747,14 @@ func callbackQHBoxPlotModelMapper_ColumnCountChanged(ptr unsafe.Pointer) {
 func (ptr *QHBoxPlotModelMapper) ConnectColumnCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_ConnectColumnCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCountChanged", f)
 	}
 }
 
 func (ptr *QHBoxPlotModelMapper) DisconnectColumnCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_DisconnectColumnCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCountChanged")
 	}
 }
 
@@ -8711,7 +8766,7 @@ func (ptr *QHBoxPlotModelMapper) ColumnCountChanged() {
 
 //export callbackQHBoxPlotModelMapper_FirstBoxSetRowChanged
 func callbackQHBoxPlotModelMapper_FirstBoxSetRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstBoxSetRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstBoxSetRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8720,14 +8775,14 @@ func callbackQHBoxPlotModelMapper_FirstBoxSetRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHBoxPlotModelMapper) ConnectFirstBoxSetRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_ConnectFirstBoxSetRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstBoxSetRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstBoxSetRowChanged", f)
 	}
 }
 
 func (ptr *QHBoxPlotModelMapper) DisconnectFirstBoxSetRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_DisconnectFirstBoxSetRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstBoxSetRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstBoxSetRowChanged")
 	}
 }
 
@@ -8739,7 +8794,7 @@ func (ptr *QHBoxPlotModelMapper) FirstBoxSetRowChanged() {
 
 //export callbackQHBoxPlotModelMapper_FirstColumnChanged
 func callbackQHBoxPlotModelMapper_FirstColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8748,14 +8803,14 @@ func callbackQHBoxPlotModelMapper_FirstColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QHBoxPlotModelMapper) ConnectFirstColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_ConnectFirstColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstColumnChanged", f)
 	}
 }
 
 func (ptr *QHBoxPlotModelMapper) DisconnectFirstColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_DisconnectFirstColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstColumnChanged")
 	}
 }
 
@@ -8767,7 +8822,7 @@ func (ptr *QHBoxPlotModelMapper) FirstColumnChanged() {
 
 //export callbackQHBoxPlotModelMapper_LastBoxSetRowChanged
 func callbackQHBoxPlotModelMapper_LastBoxSetRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lastBoxSetRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lastBoxSetRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8776,14 +8831,14 @@ func callbackQHBoxPlotModelMapper_LastBoxSetRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHBoxPlotModelMapper) ConnectLastBoxSetRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_ConnectLastBoxSetRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lastBoxSetRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lastBoxSetRowChanged", f)
 	}
 }
 
 func (ptr *QHBoxPlotModelMapper) DisconnectLastBoxSetRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_DisconnectLastBoxSetRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lastBoxSetRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lastBoxSetRowChanged")
 	}
 }
 
@@ -8795,7 +8850,7 @@ func (ptr *QHBoxPlotModelMapper) LastBoxSetRowChanged() {
 
 //export callbackQHBoxPlotModelMapper_ModelReplaced
 func callbackQHBoxPlotModelMapper_ModelReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8804,14 +8859,14 @@ func callbackQHBoxPlotModelMapper_ModelReplaced(ptr unsafe.Pointer) {
 func (ptr *QHBoxPlotModelMapper) ConnectModelReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_ConnectModelReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReplaced", f)
 	}
 }
 
 func (ptr *QHBoxPlotModelMapper) DisconnectModelReplaced() {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_DisconnectModelReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReplaced")
 	}
 }
 
@@ -8823,7 +8878,7 @@ func (ptr *QHBoxPlotModelMapper) ModelReplaced() {
 
 //export callbackQHBoxPlotModelMapper_SeriesReplaced
 func callbackQHBoxPlotModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8832,14 +8887,14 @@ func callbackQHBoxPlotModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
 func (ptr *QHBoxPlotModelMapper) ConnectSeriesReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_ConnectSeriesReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesReplaced", f)
 	}
 }
 
 func (ptr *QHBoxPlotModelMapper) DisconnectSeriesReplaced() {
 	if ptr.Pointer() != nil {
 		C.QHBoxPlotModelMapper_DisconnectSeriesReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesReplaced")
 	}
 }
 
@@ -8888,7 +8943,7 @@ func (ptr *QHBoxPlotModelMapper) SetSeries(series QBoxPlotSeries_ITF) {
 func (ptr *QHBoxPlotModelMapper) Model() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QHBoxPlotModelMapper_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8972,7 +9027,7 @@ func NewQHCandlestickModelMapperFromPointer(ptr unsafe.Pointer) *QHCandlestickMo
 func (ptr *QHCandlestickModelMapper) DestroyQHCandlestickModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8983,7 +9038,7 @@ func NewQHCandlestickModelMapper(parent core.QObject_ITF) *QHCandlestickModelMap
 
 //export callbackQHCandlestickModelMapper_CloseColumnChanged
 func callbackQHCandlestickModelMapper_CloseColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8992,14 +9047,14 @@ func callbackQHCandlestickModelMapper_CloseColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QHCandlestickModelMapper) ConnectCloseColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_ConnectCloseColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "closeColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "closeColumnChanged", f)
 	}
 }
 
 func (ptr *QHCandlestickModelMapper) DisconnectCloseColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_DisconnectCloseColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "closeColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "closeColumnChanged")
 	}
 }
 
@@ -9011,7 +9066,7 @@ func (ptr *QHCandlestickModelMapper) CloseColumnChanged() {
 
 //export callbackQHCandlestickModelMapper_FirstSetRowChanged
 func callbackQHCandlestickModelMapper_FirstSetRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstSetRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstSetRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9020,14 +9075,14 @@ func callbackQHCandlestickModelMapper_FirstSetRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHCandlestickModelMapper) ConnectFirstSetRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_ConnectFirstSetRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstSetRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstSetRowChanged", f)
 	}
 }
 
 func (ptr *QHCandlestickModelMapper) DisconnectFirstSetRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_DisconnectFirstSetRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstSetRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstSetRowChanged")
 	}
 }
 
@@ -9039,7 +9094,7 @@ func (ptr *QHCandlestickModelMapper) FirstSetRowChanged() {
 
 //export callbackQHCandlestickModelMapper_HighColumnChanged
 func callbackQHCandlestickModelMapper_HighColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "highColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "highColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9048,14 +9103,14 @@ func callbackQHCandlestickModelMapper_HighColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QHCandlestickModelMapper) ConnectHighColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_ConnectHighColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "highColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "highColumnChanged", f)
 	}
 }
 
 func (ptr *QHCandlestickModelMapper) DisconnectHighColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_DisconnectHighColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "highColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "highColumnChanged")
 	}
 }
 
@@ -9067,7 +9122,7 @@ func (ptr *QHCandlestickModelMapper) HighColumnChanged() {
 
 //export callbackQHCandlestickModelMapper_LastSetRowChanged
 func callbackQHCandlestickModelMapper_LastSetRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lastSetRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lastSetRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9076,14 +9131,14 @@ func callbackQHCandlestickModelMapper_LastSetRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHCandlestickModelMapper) ConnectLastSetRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_ConnectLastSetRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lastSetRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lastSetRowChanged", f)
 	}
 }
 
 func (ptr *QHCandlestickModelMapper) DisconnectLastSetRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_DisconnectLastSetRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lastSetRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lastSetRowChanged")
 	}
 }
 
@@ -9095,7 +9150,7 @@ func (ptr *QHCandlestickModelMapper) LastSetRowChanged() {
 
 //export callbackQHCandlestickModelMapper_LowColumnChanged
 func callbackQHCandlestickModelMapper_LowColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lowColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lowColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9104,14 +9159,14 @@ func callbackQHCandlestickModelMapper_LowColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QHCandlestickModelMapper) ConnectLowColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_ConnectLowColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lowColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lowColumnChanged", f)
 	}
 }
 
 func (ptr *QHCandlestickModelMapper) DisconnectLowColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_DisconnectLowColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lowColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lowColumnChanged")
 	}
 }
 
@@ -9123,7 +9178,7 @@ func (ptr *QHCandlestickModelMapper) LowColumnChanged() {
 
 //export callbackQHCandlestickModelMapper_OpenColumnChanged
 func callbackQHCandlestickModelMapper_OpenColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "openColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "openColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9132,14 +9187,14 @@ func callbackQHCandlestickModelMapper_OpenColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QHCandlestickModelMapper) ConnectOpenColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_ConnectOpenColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "openColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "openColumnChanged", f)
 	}
 }
 
 func (ptr *QHCandlestickModelMapper) DisconnectOpenColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_DisconnectOpenColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "openColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "openColumnChanged")
 	}
 }
 
@@ -9193,7 +9248,7 @@ func (ptr *QHCandlestickModelMapper) SetTimestampColumn(timestampColumn int) {
 
 //export callbackQHCandlestickModelMapper_TimestampColumnChanged
 func callbackQHCandlestickModelMapper_TimestampColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timestampColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timestampColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9202,14 +9257,14 @@ func callbackQHCandlestickModelMapper_TimestampColumnChanged(ptr unsafe.Pointer)
 func (ptr *QHCandlestickModelMapper) ConnectTimestampColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_ConnectTimestampColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "timestampColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "timestampColumnChanged", f)
 	}
 }
 
 func (ptr *QHCandlestickModelMapper) DisconnectTimestampColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QHCandlestickModelMapper_DisconnectTimestampColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "timestampColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "timestampColumnChanged")
 	}
 }
 
@@ -9221,7 +9276,7 @@ func (ptr *QHCandlestickModelMapper) TimestampColumnChanged() {
 
 //export callbackQHCandlestickModelMapper_Orientation
 func callbackQHCandlestickModelMapper_Orientation(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "orientation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "orientation"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__Orientation)())
 	}
 
@@ -9231,14 +9286,14 @@ func callbackQHCandlestickModelMapper_Orientation(ptr unsafe.Pointer) C.longlong
 func (ptr *QHCandlestickModelMapper) ConnectOrientation(f func() core.Qt__Orientation) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "orientation", f)
+		qt.ConnectSignal(ptr.Pointer(), "orientation", f)
 	}
 }
 
 func (ptr *QHCandlestickModelMapper) DisconnectOrientation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "orientation")
+		qt.DisconnectSignal(ptr.Pointer(), "orientation")
 	}
 }
 
@@ -9346,7 +9401,7 @@ func NewQHPieModelMapperFromPointer(ptr unsafe.Pointer) *QHPieModelMapper {
 func (ptr *QHPieModelMapper) DestroyQHPieModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9357,7 +9412,7 @@ func NewQHPieModelMapper(parent core.QObject_ITF) *QHPieModelMapper {
 
 //export callbackQHPieModelMapper_ColumnCountChanged
 func callbackQHPieModelMapper_ColumnCountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCountChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9366,14 +9421,14 @@ func callbackQHPieModelMapper_ColumnCountChanged(ptr unsafe.Pointer) {
 func (ptr *QHPieModelMapper) ConnectColumnCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_ConnectColumnCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCountChanged", f)
 	}
 }
 
 func (ptr *QHPieModelMapper) DisconnectColumnCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_DisconnectColumnCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCountChanged")
 	}
 }
 
@@ -9385,7 +9440,7 @@ func (ptr *QHPieModelMapper) ColumnCountChanged() {
 
 //export callbackQHPieModelMapper_FirstColumnChanged
 func callbackQHPieModelMapper_FirstColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9394,14 +9449,14 @@ func callbackQHPieModelMapper_FirstColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QHPieModelMapper) ConnectFirstColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_ConnectFirstColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstColumnChanged", f)
 	}
 }
 
 func (ptr *QHPieModelMapper) DisconnectFirstColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_DisconnectFirstColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstColumnChanged")
 	}
 }
 
@@ -9413,7 +9468,7 @@ func (ptr *QHPieModelMapper) FirstColumnChanged() {
 
 //export callbackQHPieModelMapper_LabelsRowChanged
 func callbackQHPieModelMapper_LabelsRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9422,14 +9477,14 @@ func callbackQHPieModelMapper_LabelsRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHPieModelMapper) ConnectLabelsRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_ConnectLabelsRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsRowChanged", f)
 	}
 }
 
 func (ptr *QHPieModelMapper) DisconnectLabelsRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_DisconnectLabelsRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsRowChanged")
 	}
 }
 
@@ -9441,7 +9496,7 @@ func (ptr *QHPieModelMapper) LabelsRowChanged() {
 
 //export callbackQHPieModelMapper_ModelReplaced
 func callbackQHPieModelMapper_ModelReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9450,14 +9505,14 @@ func callbackQHPieModelMapper_ModelReplaced(ptr unsafe.Pointer) {
 func (ptr *QHPieModelMapper) ConnectModelReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_ConnectModelReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReplaced", f)
 	}
 }
 
 func (ptr *QHPieModelMapper) DisconnectModelReplaced() {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_DisconnectModelReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReplaced")
 	}
 }
 
@@ -9469,7 +9524,7 @@ func (ptr *QHPieModelMapper) ModelReplaced() {
 
 //export callbackQHPieModelMapper_SeriesReplaced
 func callbackQHPieModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9478,14 +9533,14 @@ func callbackQHPieModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
 func (ptr *QHPieModelMapper) ConnectSeriesReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_ConnectSeriesReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesReplaced", f)
 	}
 }
 
 func (ptr *QHPieModelMapper) DisconnectSeriesReplaced() {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_DisconnectSeriesReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesReplaced")
 	}
 }
 
@@ -9533,7 +9588,7 @@ func (ptr *QHPieModelMapper) SetValuesRow(valuesRow int) {
 
 //export callbackQHPieModelMapper_ValuesRowChanged
 func callbackQHPieModelMapper_ValuesRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valuesRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valuesRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9542,14 +9597,14 @@ func callbackQHPieModelMapper_ValuesRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHPieModelMapper) ConnectValuesRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_ConnectValuesRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valuesRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valuesRowChanged", f)
 	}
 }
 
 func (ptr *QHPieModelMapper) DisconnectValuesRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHPieModelMapper_DisconnectValuesRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valuesRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valuesRowChanged")
 	}
 }
 
@@ -9562,7 +9617,7 @@ func (ptr *QHPieModelMapper) ValuesRowChanged() {
 func (ptr *QHPieModelMapper) Model() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QHPieModelMapper_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9646,7 +9701,7 @@ func NewQHXYModelMapperFromPointer(ptr unsafe.Pointer) *QHXYModelMapper {
 func (ptr *QHXYModelMapper) DestroyQHXYModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9657,7 +9712,7 @@ func NewQHXYModelMapper(parent core.QObject_ITF) *QHXYModelMapper {
 
 //export callbackQHXYModelMapper_ColumnCountChanged
 func callbackQHXYModelMapper_ColumnCountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCountChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9666,14 +9721,14 @@ func callbackQHXYModelMapper_ColumnCountChanged(ptr unsafe.Pointer) {
 func (ptr *QHXYModelMapper) ConnectColumnCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_ConnectColumnCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCountChanged", f)
 	}
 }
 
 func (ptr *QHXYModelMapper) DisconnectColumnCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_DisconnectColumnCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCountChanged")
 	}
 }
 
@@ -9685,7 +9740,7 @@ func (ptr *QHXYModelMapper) ColumnCountChanged() {
 
 //export callbackQHXYModelMapper_FirstColumnChanged
 func callbackQHXYModelMapper_FirstColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9694,14 +9749,14 @@ func callbackQHXYModelMapper_FirstColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QHXYModelMapper) ConnectFirstColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_ConnectFirstColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstColumnChanged", f)
 	}
 }
 
 func (ptr *QHXYModelMapper) DisconnectFirstColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_DisconnectFirstColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstColumnChanged")
 	}
 }
 
@@ -9713,7 +9768,7 @@ func (ptr *QHXYModelMapper) FirstColumnChanged() {
 
 //export callbackQHXYModelMapper_ModelReplaced
 func callbackQHXYModelMapper_ModelReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9722,14 +9777,14 @@ func callbackQHXYModelMapper_ModelReplaced(ptr unsafe.Pointer) {
 func (ptr *QHXYModelMapper) ConnectModelReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_ConnectModelReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReplaced", f)
 	}
 }
 
 func (ptr *QHXYModelMapper) DisconnectModelReplaced() {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_DisconnectModelReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReplaced")
 	}
 }
 
@@ -9741,7 +9796,7 @@ func (ptr *QHXYModelMapper) ModelReplaced() {
 
 //export callbackQHXYModelMapper_SeriesReplaced
 func callbackQHXYModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9750,14 +9805,14 @@ func callbackQHXYModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
 func (ptr *QHXYModelMapper) ConnectSeriesReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_ConnectSeriesReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesReplaced", f)
 	}
 }
 
 func (ptr *QHXYModelMapper) DisconnectSeriesReplaced() {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_DisconnectSeriesReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesReplaced")
 	}
 }
 
@@ -9805,7 +9860,7 @@ func (ptr *QHXYModelMapper) SetYRow(yRow int) {
 
 //export callbackQHXYModelMapper_XRowChanged
 func callbackQHXYModelMapper_XRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9814,14 +9869,14 @@ func callbackQHXYModelMapper_XRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHXYModelMapper) ConnectXRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_ConnectXRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xRowChanged", f)
 	}
 }
 
 func (ptr *QHXYModelMapper) DisconnectXRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_DisconnectXRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xRowChanged")
 	}
 }
 
@@ -9833,7 +9888,7 @@ func (ptr *QHXYModelMapper) XRowChanged() {
 
 //export callbackQHXYModelMapper_YRowChanged
 func callbackQHXYModelMapper_YRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9842,14 +9897,14 @@ func callbackQHXYModelMapper_YRowChanged(ptr unsafe.Pointer) {
 func (ptr *QHXYModelMapper) ConnectYRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_ConnectYRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yRowChanged", f)
 	}
 }
 
 func (ptr *QHXYModelMapper) DisconnectYRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QHXYModelMapper_DisconnectYRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yRowChanged")
 	}
 }
 
@@ -9862,7 +9917,7 @@ func (ptr *QHXYModelMapper) YRowChanged() {
 func (ptr *QHXYModelMapper) Model() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QHXYModelMapper_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9949,14 +10004,14 @@ func NewQHorizontalBarSeries(parent core.QObject_ITF) *QHorizontalBarSeries {
 func (ptr *QHorizontalBarSeries) DestroyQHorizontalBarSeries() {
 	if ptr.Pointer() != nil {
 		C.QHorizontalBarSeries_DestroyQHorizontalBarSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHorizontalBarSeries_Type
 func callbackQHorizontalBarSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -9966,14 +10021,14 @@ func callbackQHorizontalBarSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QHorizontalBarSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QHorizontalBarSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -10035,14 +10090,14 @@ func NewQHorizontalPercentBarSeries(parent core.QObject_ITF) *QHorizontalPercent
 func (ptr *QHorizontalPercentBarSeries) DestroyQHorizontalPercentBarSeries() {
 	if ptr.Pointer() != nil {
 		C.QHorizontalPercentBarSeries_DestroyQHorizontalPercentBarSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHorizontalPercentBarSeries_Type
 func callbackQHorizontalPercentBarSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -10052,14 +10107,14 @@ func callbackQHorizontalPercentBarSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QHorizontalPercentBarSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QHorizontalPercentBarSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -10121,14 +10176,14 @@ func NewQHorizontalStackedBarSeries(parent core.QObject_ITF) *QHorizontalStacked
 func (ptr *QHorizontalStackedBarSeries) DestroyQHorizontalStackedBarSeries() {
 	if ptr.Pointer() != nil {
 		C.QHorizontalStackedBarSeries_DestroyQHorizontalStackedBarSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHorizontalStackedBarSeries_Type
 func callbackQHorizontalStackedBarSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -10138,14 +10193,14 @@ func callbackQHorizontalStackedBarSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QHorizontalStackedBarSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QHorizontalStackedBarSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -10240,7 +10295,7 @@ func (ptr *QLegend) AttachToChart() {
 
 //export callbackQLegend_BackgroundVisibleChanged
 func callbackQLegend_BackgroundVisibleChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "backgroundVisibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "backgroundVisibleChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -10249,14 +10304,14 @@ func callbackQLegend_BackgroundVisibleChanged(ptr unsafe.Pointer, visible C.char
 func (ptr *QLegend) ConnectBackgroundVisibleChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QLegend_ConnectBackgroundVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundVisibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "backgroundVisibleChanged", f)
 	}
 }
 
 func (ptr *QLegend) DisconnectBackgroundVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegend_DisconnectBackgroundVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundVisibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "backgroundVisibleChanged")
 	}
 }
 
@@ -10268,7 +10323,7 @@ func (ptr *QLegend) BackgroundVisibleChanged(visible bool) {
 
 //export callbackQLegend_BorderColorChanged
 func callbackQLegend_BorderColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "borderColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "borderColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -10277,14 +10332,14 @@ func callbackQLegend_BorderColorChanged(ptr unsafe.Pointer, color unsafe.Pointer
 func (ptr *QLegend) ConnectBorderColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QLegend_ConnectBorderColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "borderColorChanged", f)
 	}
 }
 
 func (ptr *QLegend) DisconnectBorderColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegend_DisconnectBorderColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "borderColorChanged")
 	}
 }
 
@@ -10296,7 +10351,7 @@ func (ptr *QLegend) BorderColorChanged(color gui.QColor_ITF) {
 
 //export callbackQLegend_ColorChanged
 func callbackQLegend_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -10305,14 +10360,14 @@ func callbackQLegend_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
 func (ptr *QLegend) ConnectColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QLegend_ConnectColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorChanged", f)
 	}
 }
 
 func (ptr *QLegend) DisconnectColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegend_DisconnectColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorChanged")
 	}
 }
 
@@ -10330,7 +10385,7 @@ func (ptr *QLegend) DetachFromChart() {
 
 //export callbackQLegend_FontChanged
 func callbackQLegend_FontChanged(ptr unsafe.Pointer, font unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fontChanged"); signal != nil {
 		signal.(func(*gui.QFont))(gui.NewQFontFromPointer(font))
 	}
 
@@ -10339,14 +10394,14 @@ func callbackQLegend_FontChanged(ptr unsafe.Pointer, font unsafe.Pointer) {
 func (ptr *QLegend) ConnectFontChanged(f func(font *gui.QFont)) {
 	if ptr.Pointer() != nil {
 		C.QLegend_ConnectFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "fontChanged", f)
 	}
 }
 
 func (ptr *QLegend) DisconnectFontChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegend_DisconnectFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "fontChanged")
 	}
 }
 
@@ -10358,7 +10413,7 @@ func (ptr *QLegend) FontChanged(font gui.QFont_ITF) {
 
 //export callbackQLegend_LabelColorChanged
 func callbackQLegend_LabelColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -10367,14 +10422,14 @@ func callbackQLegend_LabelColorChanged(ptr unsafe.Pointer, color unsafe.Pointer)
 func (ptr *QLegend) ConnectLabelColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QLegend_ConnectLabelColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelColorChanged", f)
 	}
 }
 
 func (ptr *QLegend) DisconnectLabelColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegend_DisconnectLabelColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelColorChanged")
 	}
 }
 
@@ -10386,7 +10441,7 @@ func (ptr *QLegend) LabelColorChanged(color gui.QColor_ITF) {
 
 //export callbackQLegend_ReverseMarkersChanged
 func callbackQLegend_ReverseMarkersChanged(ptr unsafe.Pointer, reverseMarkers C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reverseMarkersChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reverseMarkersChanged"); signal != nil {
 		signal.(func(bool))(int8(reverseMarkers) != 0)
 	}
 
@@ -10395,14 +10450,14 @@ func callbackQLegend_ReverseMarkersChanged(ptr unsafe.Pointer, reverseMarkers C.
 func (ptr *QLegend) ConnectReverseMarkersChanged(f func(reverseMarkers bool)) {
 	if ptr.Pointer() != nil {
 		C.QLegend_ConnectReverseMarkersChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reverseMarkersChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "reverseMarkersChanged", f)
 	}
 }
 
 func (ptr *QLegend) DisconnectReverseMarkersChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegend_DisconnectReverseMarkersChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reverseMarkersChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "reverseMarkersChanged")
 	}
 }
 
@@ -10480,7 +10535,7 @@ func (ptr *QLegend) SetShowToolTips(show bool) {
 
 //export callbackQLegend_ShowToolTipsChanged
 func callbackQLegend_ShowToolTipsChanged(ptr unsafe.Pointer, showToolTips C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showToolTipsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showToolTipsChanged"); signal != nil {
 		signal.(func(bool))(int8(showToolTips) != 0)
 	}
 
@@ -10489,14 +10544,14 @@ func callbackQLegend_ShowToolTipsChanged(ptr unsafe.Pointer, showToolTips C.char
 func (ptr *QLegend) ConnectShowToolTipsChanged(f func(showToolTips bool)) {
 	if ptr.Pointer() != nil {
 		C.QLegend_ConnectShowToolTipsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "showToolTipsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "showToolTipsChanged", f)
 	}
 }
 
 func (ptr *QLegend) DisconnectShowToolTipsChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegend_DisconnectShowToolTipsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "showToolTipsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "showToolTipsChanged")
 	}
 }
 
@@ -10509,7 +10564,7 @@ func (ptr *QLegend) ShowToolTipsChanged(showToolTips bool) {
 func (ptr *QLegend) DestroyQLegend() {
 	if ptr.Pointer() != nil {
 		C.QLegend_DestroyQLegend(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10663,7 +10718,7 @@ const (
 
 //export callbackQLegendMarker_Type
 func callbackQLegendMarker_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QLegendMarker__LegendMarkerType)())
 	}
 
@@ -10673,14 +10728,14 @@ func callbackQLegendMarker_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QLegendMarker) ConnectType(f func() QLegendMarker__LegendMarkerType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -10693,7 +10748,7 @@ func (ptr *QLegendMarker) Type() QLegendMarker__LegendMarkerType {
 
 //export callbackQLegendMarker_Series
 func callbackQLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "series"); signal != nil {
+	if signal := qt.GetSignal(ptr, "series"); signal != nil {
 		return PointerFromQAbstractSeries(signal.(func() *QAbstractSeries)())
 	}
 
@@ -10703,14 +10758,14 @@ func callbackQLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QLegendMarker) ConnectSeries(f func() *QAbstractSeries) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "series", f)
+		qt.ConnectSignal(ptr.Pointer(), "series", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "series")
+		qt.DisconnectSignal(ptr.Pointer(), "series")
 	}
 }
 
@@ -10723,7 +10778,7 @@ func (ptr *QLegendMarker) Series() *QAbstractSeries {
 
 //export callbackQLegendMarker_BrushChanged
 func callbackQLegendMarker_BrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "brushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "brushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10732,14 +10787,14 @@ func callbackQLegendMarker_BrushChanged(ptr unsafe.Pointer) {
 func (ptr *QLegendMarker) ConnectBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_ConnectBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "brushChanged", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DisconnectBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "brushChanged")
 	}
 }
 
@@ -10751,7 +10806,7 @@ func (ptr *QLegendMarker) BrushChanged() {
 
 //export callbackQLegendMarker_Clicked
 func callbackQLegendMarker_Clicked(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10760,14 +10815,14 @@ func callbackQLegendMarker_Clicked(ptr unsafe.Pointer) {
 func (ptr *QLegendMarker) ConnectClicked(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -10779,7 +10834,7 @@ func (ptr *QLegendMarker) Clicked() {
 
 //export callbackQLegendMarker_FontChanged
 func callbackQLegendMarker_FontChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fontChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10788,14 +10843,14 @@ func callbackQLegendMarker_FontChanged(ptr unsafe.Pointer) {
 func (ptr *QLegendMarker) ConnectFontChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_ConnectFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "fontChanged", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectFontChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DisconnectFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "fontChanged")
 	}
 }
 
@@ -10807,7 +10862,7 @@ func (ptr *QLegendMarker) FontChanged() {
 
 //export callbackQLegendMarker_Hovered
 func callbackQLegendMarker_Hovered(ptr unsafe.Pointer, status C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(bool))(int8(status) != 0)
 	}
 
@@ -10816,14 +10871,14 @@ func callbackQLegendMarker_Hovered(ptr unsafe.Pointer, status C.char) {
 func (ptr *QLegendMarker) ConnectHovered(f func(status bool)) {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -10835,7 +10890,7 @@ func (ptr *QLegendMarker) Hovered(status bool) {
 
 //export callbackQLegendMarker_LabelBrushChanged
 func callbackQLegendMarker_LabelBrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelBrushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelBrushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10844,14 +10899,14 @@ func callbackQLegendMarker_LabelBrushChanged(ptr unsafe.Pointer) {
 func (ptr *QLegendMarker) ConnectLabelBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_ConnectLabelBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelBrushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelBrushChanged", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectLabelBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DisconnectLabelBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelBrushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelBrushChanged")
 	}
 }
 
@@ -10863,7 +10918,7 @@ func (ptr *QLegendMarker) LabelBrushChanged() {
 
 //export callbackQLegendMarker_LabelChanged
 func callbackQLegendMarker_LabelChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10872,14 +10927,14 @@ func callbackQLegendMarker_LabelChanged(ptr unsafe.Pointer) {
 func (ptr *QLegendMarker) ConnectLabelChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_ConnectLabelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelChanged", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectLabelChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DisconnectLabelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelChanged")
 	}
 }
 
@@ -10891,7 +10946,7 @@ func (ptr *QLegendMarker) LabelChanged() {
 
 //export callbackQLegendMarker_PenChanged
 func callbackQLegendMarker_PenChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "penChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "penChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10900,14 +10955,14 @@ func callbackQLegendMarker_PenChanged(ptr unsafe.Pointer) {
 func (ptr *QLegendMarker) ConnectPenChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_ConnectPenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "penChanged", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectPenChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DisconnectPenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "penChanged")
 	}
 }
 
@@ -10957,7 +11012,7 @@ func (ptr *QLegendMarker) SetVisible(visible bool) {
 
 //export callbackQLegendMarker_VisibleChanged
 func callbackQLegendMarker_VisibleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10966,14 +11021,14 @@ func callbackQLegendMarker_VisibleChanged(ptr unsafe.Pointer) {
 func (ptr *QLegendMarker) ConnectVisibleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_ConnectVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "visibleChanged", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DisconnectVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "visibleChanged")
 	}
 }
 
@@ -10985,7 +11040,7 @@ func (ptr *QLegendMarker) VisibleChanged() {
 
 //export callbackQLegendMarker_DestroyQLegendMarker
 func callbackQLegendMarker_DestroyQLegendMarker(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QLegendMarker"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QLegendMarker"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQLegendMarkerFromPointer(ptr).DestroyQLegendMarkerDefault()
@@ -10995,21 +11050,21 @@ func callbackQLegendMarker_DestroyQLegendMarker(ptr unsafe.Pointer) {
 func (ptr *QLegendMarker) ConnectDestroyQLegendMarker(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QLegendMarker", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QLegendMarker", f)
 	}
 }
 
 func (ptr *QLegendMarker) DisconnectDestroyQLegendMarker() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QLegendMarker")
+		qt.DisconnectSignal(ptr.Pointer(), "~QLegendMarker")
 	}
 }
 
 func (ptr *QLegendMarker) DestroyQLegendMarker() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DestroyQLegendMarker(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11017,7 +11072,7 @@ func (ptr *QLegendMarker) DestroyQLegendMarker() {
 func (ptr *QLegendMarker) DestroyQLegendMarkerDefault() {
 	if ptr.Pointer() != nil {
 		C.QLegendMarker_DestroyQLegendMarkerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11116,14 +11171,14 @@ func NewQLineSeries(parent core.QObject_ITF) *QLineSeries {
 func (ptr *QLineSeries) DestroyQLineSeries() {
 	if ptr.Pointer() != nil {
 		C.QLineSeries_DestroyQLineSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQLineSeries_Type
 func callbackQLineSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -11133,14 +11188,14 @@ func callbackQLineSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QLineSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QLineSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -11201,7 +11256,7 @@ func NewQLogValueAxis(parent core.QObject_ITF) *QLogValueAxis {
 
 //export callbackQLogValueAxis_BaseChanged
 func callbackQLogValueAxis_BaseChanged(ptr unsafe.Pointer, base C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "baseChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "baseChanged"); signal != nil {
 		signal.(func(float64))(float64(base))
 	}
 
@@ -11210,14 +11265,14 @@ func callbackQLogValueAxis_BaseChanged(ptr unsafe.Pointer, base C.double) {
 func (ptr *QLogValueAxis) ConnectBaseChanged(f func(base float64)) {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_ConnectBaseChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "baseChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "baseChanged", f)
 	}
 }
 
 func (ptr *QLogValueAxis) DisconnectBaseChanged() {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_DisconnectBaseChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "baseChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "baseChanged")
 	}
 }
 
@@ -11229,7 +11284,7 @@ func (ptr *QLogValueAxis) BaseChanged(base float64) {
 
 //export callbackQLogValueAxis_LabelFormatChanged
 func callbackQLogValueAxis_LabelFormatChanged(ptr unsafe.Pointer, format C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelFormatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelFormatChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(format))
 	}
 
@@ -11238,14 +11293,14 @@ func callbackQLogValueAxis_LabelFormatChanged(ptr unsafe.Pointer, format C.struc
 func (ptr *QLogValueAxis) ConnectLabelFormatChanged(f func(format string)) {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_ConnectLabelFormatChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelFormatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelFormatChanged", f)
 	}
 }
 
 func (ptr *QLogValueAxis) DisconnectLabelFormatChanged() {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_DisconnectLabelFormatChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelFormatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelFormatChanged")
 	}
 }
 
@@ -11259,7 +11314,7 @@ func (ptr *QLogValueAxis) LabelFormatChanged(format string) {
 
 //export callbackQLogValueAxis_MaxChanged
 func callbackQLogValueAxis_MaxChanged(ptr unsafe.Pointer, max C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maxChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maxChanged"); signal != nil {
 		signal.(func(float64))(float64(max))
 	}
 
@@ -11268,14 +11323,14 @@ func callbackQLogValueAxis_MaxChanged(ptr unsafe.Pointer, max C.double) {
 func (ptr *QLogValueAxis) ConnectMaxChanged(f func(max float64)) {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_ConnectMaxChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maxChanged", f)
 	}
 }
 
 func (ptr *QLogValueAxis) DisconnectMaxChanged() {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_DisconnectMaxChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maxChanged")
 	}
 }
 
@@ -11287,7 +11342,7 @@ func (ptr *QLogValueAxis) MaxChanged(max float64) {
 
 //export callbackQLogValueAxis_MinChanged
 func callbackQLogValueAxis_MinChanged(ptr unsafe.Pointer, min C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minChanged"); signal != nil {
 		signal.(func(float64))(float64(min))
 	}
 
@@ -11296,14 +11351,14 @@ func callbackQLogValueAxis_MinChanged(ptr unsafe.Pointer, min C.double) {
 func (ptr *QLogValueAxis) ConnectMinChanged(f func(min float64)) {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_ConnectMinChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minChanged", f)
 	}
 }
 
 func (ptr *QLogValueAxis) DisconnectMinChanged() {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_DisconnectMinChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minChanged")
 	}
 }
 
@@ -11315,7 +11370,7 @@ func (ptr *QLogValueAxis) MinChanged(min float64) {
 
 //export callbackQLogValueAxis_RangeChanged
 func callbackQLogValueAxis_RangeChanged(ptr unsafe.Pointer, min C.double, max C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rangeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rangeChanged"); signal != nil {
 		signal.(func(float64, float64))(float64(min), float64(max))
 	}
 
@@ -11324,14 +11379,14 @@ func callbackQLogValueAxis_RangeChanged(ptr unsafe.Pointer, min C.double, max C.
 func (ptr *QLogValueAxis) ConnectRangeChanged(f func(min float64, max float64)) {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_ConnectRangeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rangeChanged", f)
 	}
 }
 
 func (ptr *QLogValueAxis) DisconnectRangeChanged() {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_DisconnectRangeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rangeChanged")
 	}
 }
 
@@ -11376,7 +11431,7 @@ func (ptr *QLogValueAxis) SetRange(min float64, max float64) {
 func (ptr *QLogValueAxis) DestroyQLogValueAxis() {
 	if ptr.Pointer() != nil {
 		C.QLogValueAxis_DestroyQLogValueAxis(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11453,14 +11508,14 @@ func NewQPercentBarSeries(parent core.QObject_ITF) *QPercentBarSeries {
 func (ptr *QPercentBarSeries) DestroyQPercentBarSeries() {
 	if ptr.Pointer() != nil {
 		C.QPercentBarSeries_DestroyQPercentBarSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPercentBarSeries_Type
 func callbackQPercentBarSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -11470,14 +11525,14 @@ func callbackQPercentBarSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QPercentBarSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QPercentBarSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -11535,7 +11590,7 @@ func NewQPieLegendMarkerFromPointer(ptr unsafe.Pointer) *QPieLegendMarker {
 
 //export callbackQPieLegendMarker_Series
 func callbackQPieLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "series"); signal != nil {
+	if signal := qt.GetSignal(ptr, "series"); signal != nil {
 		return PointerFromQPieSeries(signal.(func() *QPieSeries)())
 	}
 
@@ -11545,14 +11600,14 @@ func callbackQPieLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QPieLegendMarker) ConnectSeries(f func() *QPieSeries) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "series", f)
+		qt.ConnectSignal(ptr.Pointer(), "series", f)
 	}
 }
 
 func (ptr *QPieLegendMarker) DisconnectSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "series")
+		qt.DisconnectSignal(ptr.Pointer(), "series")
 	}
 }
 
@@ -11579,7 +11634,7 @@ func (ptr *QPieLegendMarker) Slice() *QPieSlice {
 
 //export callbackQPieLegendMarker_DestroyQPieLegendMarker
 func callbackQPieLegendMarker_DestroyQPieLegendMarker(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QPieLegendMarker"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QPieLegendMarker"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPieLegendMarkerFromPointer(ptr).DestroyQPieLegendMarkerDefault()
@@ -11589,21 +11644,21 @@ func callbackQPieLegendMarker_DestroyQPieLegendMarker(ptr unsafe.Pointer) {
 func (ptr *QPieLegendMarker) ConnectDestroyQPieLegendMarker(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QPieLegendMarker", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QPieLegendMarker", f)
 	}
 }
 
 func (ptr *QPieLegendMarker) DisconnectDestroyQPieLegendMarker() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QPieLegendMarker")
+		qt.DisconnectSignal(ptr.Pointer(), "~QPieLegendMarker")
 	}
 }
 
 func (ptr *QPieLegendMarker) DestroyQPieLegendMarker() {
 	if ptr.Pointer() != nil {
 		C.QPieLegendMarker_DestroyQPieLegendMarker(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11611,7 +11666,7 @@ func (ptr *QPieLegendMarker) DestroyQPieLegendMarker() {
 func (ptr *QPieLegendMarker) DestroyQPieLegendMarkerDefault() {
 	if ptr.Pointer() != nil {
 		C.QPieLegendMarker_DestroyQPieLegendMarkerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11709,7 +11764,7 @@ func (ptr *QPieSeries) Take(slice QPieSlice_ITF) bool {
 
 //export callbackQPieSeries_Added
 func callbackQPieSeries_Added(ptr unsafe.Pointer, slices C.struct_QtCharts_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "added"); signal != nil {
+	if signal := qt.GetSignal(ptr, "added"); signal != nil {
 		signal.(func([]*QPieSlice))(func(l C.struct_QtCharts_PackedList) []*QPieSlice {
 			var out = make([]*QPieSlice, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -11724,14 +11779,14 @@ func callbackQPieSeries_Added(ptr unsafe.Pointer, slices C.struct_QtCharts_Packe
 func (ptr *QPieSeries) ConnectAdded(f func(slices []*QPieSlice)) {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_ConnectAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "added", f)
+		qt.ConnectSignal(ptr.Pointer(), "added", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectAdded() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DisconnectAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "added")
+		qt.DisconnectSignal(ptr.Pointer(), "added")
 	}
 }
 
@@ -11755,7 +11810,7 @@ func (ptr *QPieSeries) Clear() {
 
 //export callbackQPieSeries_Clicked
 func callbackQPieSeries_Clicked(ptr unsafe.Pointer, slice unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func(*QPieSlice))(NewQPieSliceFromPointer(slice))
 	}
 
@@ -11764,14 +11819,14 @@ func callbackQPieSeries_Clicked(ptr unsafe.Pointer, slice unsafe.Pointer) {
 func (ptr *QPieSeries) ConnectClicked(f func(slice *QPieSlice)) {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -11783,7 +11838,7 @@ func (ptr *QPieSeries) Clicked(slice QPieSlice_ITF) {
 
 //export callbackQPieSeries_CountChanged
 func callbackQPieSeries_CountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "countChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "countChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -11792,14 +11847,14 @@ func callbackQPieSeries_CountChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSeries) ConnectCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_ConnectCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "countChanged", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DisconnectCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "countChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "countChanged")
 	}
 }
 
@@ -11811,7 +11866,7 @@ func (ptr *QPieSeries) CountChanged() {
 
 //export callbackQPieSeries_DoubleClicked
 func callbackQPieSeries_DoubleClicked(ptr unsafe.Pointer, slice unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func(*QPieSlice))(NewQPieSliceFromPointer(slice))
 	}
 
@@ -11820,14 +11875,14 @@ func callbackQPieSeries_DoubleClicked(ptr unsafe.Pointer, slice unsafe.Pointer)
 func (ptr *QPieSeries) ConnectDoubleClicked(f func(slice *QPieSlice)) {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -11839,7 +11894,7 @@ func (ptr *QPieSeries) DoubleClicked(slice QPieSlice_ITF) {
 
 //export callbackQPieSeries_Hovered
 func callbackQPieSeries_Hovered(ptr unsafe.Pointer, slice unsafe.Pointer, state C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(*QPieSlice, bool))(NewQPieSliceFromPointer(slice), int8(state) != 0)
 	}
 
@@ -11848,14 +11903,14 @@ func callbackQPieSeries_Hovered(ptr unsafe.Pointer, slice unsafe.Pointer, state
 func (ptr *QPieSeries) ConnectHovered(f func(slice *QPieSlice, state bool)) {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -11867,7 +11922,7 @@ func (ptr *QPieSeries) Hovered(slice QPieSlice_ITF, state bool) {
 
 //export callbackQPieSeries_Pressed
 func callbackQPieSeries_Pressed(ptr unsafe.Pointer, slice unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func(*QPieSlice))(NewQPieSliceFromPointer(slice))
 	}
 
@@ -11876,14 +11931,14 @@ func callbackQPieSeries_Pressed(ptr unsafe.Pointer, slice unsafe.Pointer) {
 func (ptr *QPieSeries) ConnectPressed(f func(slice *QPieSlice)) {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -11895,7 +11950,7 @@ func (ptr *QPieSeries) Pressed(slice QPieSlice_ITF) {
 
 //export callbackQPieSeries_Released
 func callbackQPieSeries_Released(ptr unsafe.Pointer, slice unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func(*QPieSlice))(NewQPieSliceFromPointer(slice))
 	}
 
@@ -11904,14 +11959,14 @@ func callbackQPieSeries_Released(ptr unsafe.Pointer, slice unsafe.Pointer) {
 func (ptr *QPieSeries) ConnectReleased(f func(slice *QPieSlice)) {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -11923,7 +11978,7 @@ func (ptr *QPieSeries) Released(slice QPieSlice_ITF) {
 
 //export callbackQPieSeries_Removed
 func callbackQPieSeries_Removed(ptr unsafe.Pointer, slices C.struct_QtCharts_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removed"); signal != nil {
 		signal.(func([]*QPieSlice))(func(l C.struct_QtCharts_PackedList) []*QPieSlice {
 			var out = make([]*QPieSlice, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -11938,14 +11993,14 @@ func callbackQPieSeries_Removed(ptr unsafe.Pointer, slices C.struct_QtCharts_Pac
 func (ptr *QPieSeries) ConnectRemoved(f func(slices []*QPieSlice)) {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_ConnectRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "removed", f)
+		qt.ConnectSignal(ptr.Pointer(), "removed", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectRemoved() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DisconnectRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "removed")
+		qt.DisconnectSignal(ptr.Pointer(), "removed")
 	}
 }
 
@@ -12011,7 +12066,7 @@ func (ptr *QPieSeries) SetVerticalPosition(relativePosition float64) {
 
 //export callbackQPieSeries_SumChanged
 func callbackQPieSeries_SumChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sumChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sumChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12020,14 +12075,14 @@ func callbackQPieSeries_SumChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSeries) ConnectSumChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_ConnectSumChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sumChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sumChanged", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectSumChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DisconnectSumChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sumChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sumChanged")
 	}
 }
 
@@ -12039,7 +12094,7 @@ func (ptr *QPieSeries) SumChanged() {
 
 //export callbackQPieSeries_DestroyQPieSeries
 func callbackQPieSeries_DestroyQPieSeries(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QPieSeries"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QPieSeries"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPieSeriesFromPointer(ptr).DestroyQPieSeriesDefault()
@@ -12049,21 +12104,21 @@ func callbackQPieSeries_DestroyQPieSeries(ptr unsafe.Pointer) {
 func (ptr *QPieSeries) ConnectDestroyQPieSeries(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QPieSeries", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QPieSeries", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectDestroyQPieSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QPieSeries")
+		qt.DisconnectSignal(ptr.Pointer(), "~QPieSeries")
 	}
 }
 
 func (ptr *QPieSeries) DestroyQPieSeries() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DestroyQPieSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12071,14 +12126,14 @@ func (ptr *QPieSeries) DestroyQPieSeries() {
 func (ptr *QPieSeries) DestroyQPieSeriesDefault() {
 	if ptr.Pointer() != nil {
 		C.QPieSeries_DestroyQPieSeriesDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPieSeries_Type
 func callbackQPieSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -12088,14 +12143,14 @@ func callbackQPieSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QPieSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QPieSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -12359,7 +12414,7 @@ func (ptr *QPieSlice) BorderWidth() int {
 
 //export callbackQPieSlice_AngleSpanChanged
 func callbackQPieSlice_AngleSpanChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "angleSpanChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "angleSpanChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12368,14 +12423,14 @@ func callbackQPieSlice_AngleSpanChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectAngleSpanChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectAngleSpanChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "angleSpanChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "angleSpanChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectAngleSpanChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectAngleSpanChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "angleSpanChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "angleSpanChanged")
 	}
 }
 
@@ -12387,7 +12442,7 @@ func (ptr *QPieSlice) AngleSpanChanged() {
 
 //export callbackQPieSlice_BorderColorChanged
 func callbackQPieSlice_BorderColorChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "borderColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "borderColorChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12396,14 +12451,14 @@ func callbackQPieSlice_BorderColorChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectBorderColorChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectBorderColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "borderColorChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectBorderColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectBorderColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "borderColorChanged")
 	}
 }
 
@@ -12415,7 +12470,7 @@ func (ptr *QPieSlice) BorderColorChanged() {
 
 //export callbackQPieSlice_BorderWidthChanged
 func callbackQPieSlice_BorderWidthChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "borderWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "borderWidthChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12424,14 +12479,14 @@ func callbackQPieSlice_BorderWidthChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectBorderWidthChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectBorderWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "borderWidthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "borderWidthChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectBorderWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectBorderWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "borderWidthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "borderWidthChanged")
 	}
 }
 
@@ -12443,7 +12498,7 @@ func (ptr *QPieSlice) BorderWidthChanged() {
 
 //export callbackQPieSlice_BrushChanged
 func callbackQPieSlice_BrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "brushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "brushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12452,14 +12507,14 @@ func callbackQPieSlice_BrushChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "brushChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "brushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "brushChanged")
 	}
 }
 
@@ -12471,7 +12526,7 @@ func (ptr *QPieSlice) BrushChanged() {
 
 //export callbackQPieSlice_Clicked
 func callbackQPieSlice_Clicked(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12480,14 +12535,14 @@ func callbackQPieSlice_Clicked(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectClicked(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -12499,7 +12554,7 @@ func (ptr *QPieSlice) Clicked() {
 
 //export callbackQPieSlice_ColorChanged
 func callbackQPieSlice_ColorChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12508,14 +12563,14 @@ func callbackQPieSlice_ColorChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectColorChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorChanged")
 	}
 }
 
@@ -12527,7 +12582,7 @@ func (ptr *QPieSlice) ColorChanged() {
 
 //export callbackQPieSlice_DoubleClicked
 func callbackQPieSlice_DoubleClicked(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12536,14 +12591,14 @@ func callbackQPieSlice_DoubleClicked(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectDoubleClicked(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -12555,7 +12610,7 @@ func (ptr *QPieSlice) DoubleClicked() {
 
 //export callbackQPieSlice_Hovered
 func callbackQPieSlice_Hovered(ptr unsafe.Pointer, state C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(bool))(int8(state) != 0)
 	}
 
@@ -12564,14 +12619,14 @@ func callbackQPieSlice_Hovered(ptr unsafe.Pointer, state C.char) {
 func (ptr *QPieSlice) ConnectHovered(f func(state bool)) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -12583,7 +12638,7 @@ func (ptr *QPieSlice) Hovered(state bool) {
 
 //export callbackQPieSlice_LabelBrushChanged
 func callbackQPieSlice_LabelBrushChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelBrushChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelBrushChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12592,14 +12647,14 @@ func callbackQPieSlice_LabelBrushChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectLabelBrushChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectLabelBrushChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelBrushChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelBrushChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectLabelBrushChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectLabelBrushChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelBrushChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelBrushChanged")
 	}
 }
 
@@ -12611,7 +12666,7 @@ func (ptr *QPieSlice) LabelBrushChanged() {
 
 //export callbackQPieSlice_LabelChanged
 func callbackQPieSlice_LabelChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12620,14 +12675,14 @@ func callbackQPieSlice_LabelChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectLabelChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectLabelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectLabelChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectLabelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelChanged")
 	}
 }
 
@@ -12639,7 +12694,7 @@ func (ptr *QPieSlice) LabelChanged() {
 
 //export callbackQPieSlice_LabelColorChanged
 func callbackQPieSlice_LabelColorChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelColorChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12648,14 +12703,14 @@ func callbackQPieSlice_LabelColorChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectLabelColorChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectLabelColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelColorChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectLabelColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectLabelColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelColorChanged")
 	}
 }
 
@@ -12667,7 +12722,7 @@ func (ptr *QPieSlice) LabelColorChanged() {
 
 //export callbackQPieSlice_LabelFontChanged
 func callbackQPieSlice_LabelFontChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelFontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelFontChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12676,14 +12731,14 @@ func callbackQPieSlice_LabelFontChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectLabelFontChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectLabelFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelFontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelFontChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectLabelFontChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectLabelFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelFontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelFontChanged")
 	}
 }
 
@@ -12695,7 +12750,7 @@ func (ptr *QPieSlice) LabelFontChanged() {
 
 //export callbackQPieSlice_LabelVisibleChanged
 func callbackQPieSlice_LabelVisibleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelVisibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelVisibleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12704,14 +12759,14 @@ func callbackQPieSlice_LabelVisibleChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectLabelVisibleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectLabelVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelVisibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelVisibleChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectLabelVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectLabelVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelVisibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelVisibleChanged")
 	}
 }
 
@@ -12723,7 +12778,7 @@ func (ptr *QPieSlice) LabelVisibleChanged() {
 
 //export callbackQPieSlice_PenChanged
 func callbackQPieSlice_PenChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "penChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "penChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12732,14 +12787,14 @@ func callbackQPieSlice_PenChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectPenChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectPenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "penChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectPenChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectPenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "penChanged")
 	}
 }
 
@@ -12751,7 +12806,7 @@ func (ptr *QPieSlice) PenChanged() {
 
 //export callbackQPieSlice_PercentageChanged
 func callbackQPieSlice_PercentageChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "percentageChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "percentageChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12760,14 +12815,14 @@ func callbackQPieSlice_PercentageChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectPercentageChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectPercentageChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "percentageChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "percentageChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectPercentageChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectPercentageChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "percentageChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "percentageChanged")
 	}
 }
 
@@ -12779,7 +12834,7 @@ func (ptr *QPieSlice) PercentageChanged() {
 
 //export callbackQPieSlice_Pressed
 func callbackQPieSlice_Pressed(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12788,14 +12843,14 @@ func callbackQPieSlice_Pressed(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectPressed(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -12807,7 +12862,7 @@ func (ptr *QPieSlice) Pressed() {
 
 //export callbackQPieSlice_Released
 func callbackQPieSlice_Released(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12816,14 +12871,14 @@ func callbackQPieSlice_Released(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectReleased(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -12927,7 +12982,7 @@ func (ptr *QPieSlice) SetValue(value float64) {
 
 //export callbackQPieSlice_StartAngleChanged
 func callbackQPieSlice_StartAngleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startAngleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startAngleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12936,14 +12991,14 @@ func callbackQPieSlice_StartAngleChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectStartAngleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectStartAngleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startAngleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "startAngleChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectStartAngleChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectStartAngleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startAngleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "startAngleChanged")
 	}
 }
 
@@ -12955,7 +13010,7 @@ func (ptr *QPieSlice) StartAngleChanged() {
 
 //export callbackQPieSlice_ValueChanged
 func callbackQPieSlice_ValueChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12964,14 +13019,14 @@ func callbackQPieSlice_ValueChanged(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectValueChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_ConnectValueChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueChanged", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectValueChanged() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DisconnectValueChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valueChanged")
 	}
 }
 
@@ -12983,7 +13038,7 @@ func (ptr *QPieSlice) ValueChanged() {
 
 //export callbackQPieSlice_DestroyQPieSlice
 func callbackQPieSlice_DestroyQPieSlice(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QPieSlice"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QPieSlice"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPieSliceFromPointer(ptr).DestroyQPieSliceDefault()
@@ -12993,21 +13048,21 @@ func callbackQPieSlice_DestroyQPieSlice(ptr unsafe.Pointer) {
 func (ptr *QPieSlice) ConnectDestroyQPieSlice(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QPieSlice", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QPieSlice", f)
 	}
 }
 
 func (ptr *QPieSlice) DisconnectDestroyQPieSlice() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QPieSlice")
+		qt.DisconnectSignal(ptr.Pointer(), "~QPieSlice")
 	}
 }
 
 func (ptr *QPieSlice) DestroyQPieSlice() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DestroyQPieSlice(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13015,7 +13070,7 @@ func (ptr *QPieSlice) DestroyQPieSlice() {
 func (ptr *QPieSlice) DestroyQPieSliceDefault() {
 	if ptr.Pointer() != nil {
 		C.QPieSlice_DestroyQPieSliceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13292,7 +13347,7 @@ func NewQScatterSeries(parent core.QObject_ITF) *QScatterSeries {
 
 //export callbackQScatterSeries_BorderColorChanged
 func callbackQScatterSeries_BorderColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "borderColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "borderColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -13301,14 +13356,14 @@ func callbackQScatterSeries_BorderColorChanged(ptr unsafe.Pointer, color unsafe.
 func (ptr *QScatterSeries) ConnectBorderColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QScatterSeries_ConnectBorderColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "borderColorChanged", f)
 	}
 }
 
 func (ptr *QScatterSeries) DisconnectBorderColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatterSeries_DisconnectBorderColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "borderColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "borderColorChanged")
 	}
 }
 
@@ -13320,7 +13375,7 @@ func (ptr *QScatterSeries) BorderColorChanged(color gui.QColor_ITF) {
 
 //export callbackQScatterSeries_ColorChanged
 func callbackQScatterSeries_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -13329,14 +13384,14 @@ func callbackQScatterSeries_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointe
 func (ptr *QScatterSeries) ConnectColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QScatterSeries_ConnectColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorChanged", f)
 	}
 }
 
 func (ptr *QScatterSeries) DisconnectColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatterSeries_DisconnectColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorChanged")
 	}
 }
 
@@ -13348,7 +13403,7 @@ func (ptr *QScatterSeries) ColorChanged(color gui.QColor_ITF) {
 
 //export callbackQScatterSeries_MarkerShapeChanged
 func callbackQScatterSeries_MarkerShapeChanged(ptr unsafe.Pointer, shape C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "markerShapeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "markerShapeChanged"); signal != nil {
 		signal.(func(QScatterSeries__MarkerShape))(QScatterSeries__MarkerShape(shape))
 	}
 
@@ -13357,14 +13412,14 @@ func callbackQScatterSeries_MarkerShapeChanged(ptr unsafe.Pointer, shape C.longl
 func (ptr *QScatterSeries) ConnectMarkerShapeChanged(f func(shape QScatterSeries__MarkerShape)) {
 	if ptr.Pointer() != nil {
 		C.QScatterSeries_ConnectMarkerShapeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "markerShapeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "markerShapeChanged", f)
 	}
 }
 
 func (ptr *QScatterSeries) DisconnectMarkerShapeChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatterSeries_DisconnectMarkerShapeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "markerShapeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "markerShapeChanged")
 	}
 }
 
@@ -13376,7 +13431,7 @@ func (ptr *QScatterSeries) MarkerShapeChanged(shape QScatterSeries__MarkerShape)
 
 //export callbackQScatterSeries_MarkerSizeChanged
 func callbackQScatterSeries_MarkerSizeChanged(ptr unsafe.Pointer, size C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "markerSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "markerSizeChanged"); signal != nil {
 		signal.(func(float64))(float64(size))
 	}
 
@@ -13385,14 +13440,14 @@ func callbackQScatterSeries_MarkerSizeChanged(ptr unsafe.Pointer, size C.double)
 func (ptr *QScatterSeries) ConnectMarkerSizeChanged(f func(size float64)) {
 	if ptr.Pointer() != nil {
 		C.QScatterSeries_ConnectMarkerSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "markerSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "markerSizeChanged", f)
 	}
 }
 
 func (ptr *QScatterSeries) DisconnectMarkerSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatterSeries_DisconnectMarkerSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "markerSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "markerSizeChanged")
 	}
 }
 
@@ -13410,7 +13465,7 @@ func (ptr *QScatterSeries) SetBorderColor(color gui.QColor_ITF) {
 
 //export callbackQScatterSeries_SetBrush
 func callbackQScatterSeries_SetBrush(ptr unsafe.Pointer, brush unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setBrush"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setBrush"); signal != nil {
 		signal.(func(*gui.QBrush))(gui.NewQBrushFromPointer(brush))
 	} else {
 		NewQScatterSeriesFromPointer(ptr).SetBrushDefault(gui.NewQBrushFromPointer(brush))
@@ -13420,14 +13475,14 @@ func callbackQScatterSeries_SetBrush(ptr unsafe.Pointer, brush unsafe.Pointer) {
 func (ptr *QScatterSeries) ConnectSetBrush(f func(brush *gui.QBrush)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setBrush", f)
+		qt.ConnectSignal(ptr.Pointer(), "setBrush", f)
 	}
 }
 
 func (ptr *QScatterSeries) DisconnectSetBrush() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setBrush")
+		qt.DisconnectSignal(ptr.Pointer(), "setBrush")
 	}
 }
 
@@ -13445,7 +13500,7 @@ func (ptr *QScatterSeries) SetBrushDefault(brush gui.QBrush_ITF) {
 
 //export callbackQScatterSeries_SetColor
 func callbackQScatterSeries_SetColor(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setColor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setColor"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	} else {
 		NewQScatterSeriesFromPointer(ptr).SetColorDefault(gui.NewQColorFromPointer(color))
@@ -13455,14 +13510,14 @@ func callbackQScatterSeries_SetColor(ptr unsafe.Pointer, color unsafe.Pointer) {
 func (ptr *QScatterSeries) ConnectSetColor(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setColor", f)
+		qt.ConnectSignal(ptr.Pointer(), "setColor", f)
 	}
 }
 
 func (ptr *QScatterSeries) DisconnectSetColor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setColor")
+		qt.DisconnectSignal(ptr.Pointer(), "setColor")
 	}
 }
 
@@ -13492,7 +13547,7 @@ func (ptr *QScatterSeries) SetMarkerSize(size float64) {
 
 //export callbackQScatterSeries_SetPen
 func callbackQScatterSeries_SetPen(ptr unsafe.Pointer, pen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPen"); signal != nil {
 		signal.(func(*gui.QPen))(gui.NewQPenFromPointer(pen))
 	} else {
 		NewQScatterSeriesFromPointer(ptr).SetPenDefault(gui.NewQPenFromPointer(pen))
@@ -13502,14 +13557,14 @@ func callbackQScatterSeries_SetPen(ptr unsafe.Pointer, pen unsafe.Pointer) {
 func (ptr *QScatterSeries) ConnectSetPen(f func(pen *gui.QPen)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPen", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPen", f)
 	}
 }
 
 func (ptr *QScatterSeries) DisconnectSetPen() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPen")
+		qt.DisconnectSignal(ptr.Pointer(), "setPen")
 	}
 }
 
@@ -13528,7 +13583,7 @@ func (ptr *QScatterSeries) SetPenDefault(pen gui.QPen_ITF) {
 func (ptr *QScatterSeries) DestroyQScatterSeries() {
 	if ptr.Pointer() != nil {
 		C.QScatterSeries_DestroyQScatterSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13542,7 +13597,7 @@ func (ptr *QScatterSeries) MarkerShape() QScatterSeries__MarkerShape {
 
 //export callbackQScatterSeries_Type
 func callbackQScatterSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -13552,14 +13607,14 @@ func callbackQScatterSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QScatterSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QScatterSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -13588,7 +13643,7 @@ func (ptr *QScatterSeries) Brush() *gui.QBrush {
 
 //export callbackQScatterSeries_Color
 func callbackQScatterSeries_Color(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "color"); signal != nil {
+	if signal := qt.GetSignal(ptr, "color"); signal != nil {
 		return gui.PointerFromQColor(signal.(func() *gui.QColor)())
 	}
 
@@ -13598,14 +13653,14 @@ func callbackQScatterSeries_Color(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QScatterSeries) ConnectColor(f func() *gui.QColor) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "color", f)
+		qt.ConnectSignal(ptr.Pointer(), "color", f)
 	}
 }
 
 func (ptr *QScatterSeries) DisconnectColor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "color")
+		qt.DisconnectSignal(ptr.Pointer(), "color")
 	}
 }
 
@@ -13678,14 +13733,14 @@ func NewQSplineSeries(parent core.QObject_ITF) *QSplineSeries {
 func (ptr *QSplineSeries) DestroyQSplineSeries() {
 	if ptr.Pointer() != nil {
 		C.QSplineSeries_DestroyQSplineSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSplineSeries_Type
 func callbackQSplineSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -13695,14 +13750,14 @@ func callbackQSplineSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QSplineSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QSplineSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -13764,14 +13819,14 @@ func NewQStackedBarSeries(parent core.QObject_ITF) *QStackedBarSeries {
 func (ptr *QStackedBarSeries) DestroyQStackedBarSeries() {
 	if ptr.Pointer() != nil {
 		C.QStackedBarSeries_DestroyQStackedBarSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQStackedBarSeries_Type
 func callbackQStackedBarSeries_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QAbstractSeries__SeriesType)())
 	}
 
@@ -13781,14 +13836,14 @@ func callbackQStackedBarSeries_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QStackedBarSeries) ConnectType(f func() QAbstractSeries__SeriesType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QStackedBarSeries) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -13847,7 +13902,7 @@ func NewQVBarModelMapperFromPointer(ptr unsafe.Pointer) *QVBarModelMapper {
 func (ptr *QVBarModelMapper) DestroyQVBarModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13858,7 +13913,7 @@ func NewQVBarModelMapper(parent core.QObject_ITF) *QVBarModelMapper {
 
 //export callbackQVBarModelMapper_FirstBarSetColumnChanged
 func callbackQVBarModelMapper_FirstBarSetColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstBarSetColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstBarSetColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13867,14 +13922,14 @@ func callbackQVBarModelMapper_FirstBarSetColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QVBarModelMapper) ConnectFirstBarSetColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_ConnectFirstBarSetColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstBarSetColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstBarSetColumnChanged", f)
 	}
 }
 
 func (ptr *QVBarModelMapper) DisconnectFirstBarSetColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_DisconnectFirstBarSetColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstBarSetColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstBarSetColumnChanged")
 	}
 }
 
@@ -13886,7 +13941,7 @@ func (ptr *QVBarModelMapper) FirstBarSetColumnChanged() {
 
 //export callbackQVBarModelMapper_FirstRowChanged
 func callbackQVBarModelMapper_FirstRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13895,14 +13950,14 @@ func callbackQVBarModelMapper_FirstRowChanged(ptr unsafe.Pointer) {
 func (ptr *QVBarModelMapper) ConnectFirstRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_ConnectFirstRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstRowChanged", f)
 	}
 }
 
 func (ptr *QVBarModelMapper) DisconnectFirstRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_DisconnectFirstRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstRowChanged")
 	}
 }
 
@@ -13914,7 +13969,7 @@ func (ptr *QVBarModelMapper) FirstRowChanged() {
 
 //export callbackQVBarModelMapper_LastBarSetColumnChanged
 func callbackQVBarModelMapper_LastBarSetColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lastBarSetColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lastBarSetColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13923,14 +13978,14 @@ func callbackQVBarModelMapper_LastBarSetColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QVBarModelMapper) ConnectLastBarSetColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_ConnectLastBarSetColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lastBarSetColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lastBarSetColumnChanged", f)
 	}
 }
 
 func (ptr *QVBarModelMapper) DisconnectLastBarSetColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_DisconnectLastBarSetColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lastBarSetColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lastBarSetColumnChanged")
 	}
 }
 
@@ -13942,7 +13997,7 @@ func (ptr *QVBarModelMapper) LastBarSetColumnChanged() {
 
 //export callbackQVBarModelMapper_ModelReplaced
 func callbackQVBarModelMapper_ModelReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13951,14 +14006,14 @@ func callbackQVBarModelMapper_ModelReplaced(ptr unsafe.Pointer) {
 func (ptr *QVBarModelMapper) ConnectModelReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_ConnectModelReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReplaced", f)
 	}
 }
 
 func (ptr *QVBarModelMapper) DisconnectModelReplaced() {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_DisconnectModelReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReplaced")
 	}
 }
 
@@ -13970,7 +14025,7 @@ func (ptr *QVBarModelMapper) ModelReplaced() {
 
 //export callbackQVBarModelMapper_RowCountChanged
 func callbackQVBarModelMapper_RowCountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCountChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13979,14 +14034,14 @@ func callbackQVBarModelMapper_RowCountChanged(ptr unsafe.Pointer) {
 func (ptr *QVBarModelMapper) ConnectRowCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_ConnectRowCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCountChanged", f)
 	}
 }
 
 func (ptr *QVBarModelMapper) DisconnectRowCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_DisconnectRowCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCountChanged")
 	}
 }
 
@@ -13998,7 +14053,7 @@ func (ptr *QVBarModelMapper) RowCountChanged() {
 
 //export callbackQVBarModelMapper_SeriesReplaced
 func callbackQVBarModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14007,14 +14062,14 @@ func callbackQVBarModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
 func (ptr *QVBarModelMapper) ConnectSeriesReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_ConnectSeriesReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesReplaced", f)
 	}
 }
 
 func (ptr *QVBarModelMapper) DisconnectSeriesReplaced() {
 	if ptr.Pointer() != nil {
 		C.QVBarModelMapper_DisconnectSeriesReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesReplaced")
 	}
 }
 
@@ -14070,7 +14125,7 @@ func (ptr *QVBarModelMapper) Series() *QAbstractBarSeries {
 func (ptr *QVBarModelMapper) Model() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QVBarModelMapper_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14147,7 +14202,7 @@ func NewQVBoxPlotModelMapperFromPointer(ptr unsafe.Pointer) *QVBoxPlotModelMappe
 func (ptr *QVBoxPlotModelMapper) DestroyQVBoxPlotModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14158,7 +14213,7 @@ func NewQVBoxPlotModelMapper(parent core.QObject_ITF) *QVBoxPlotModelMapper {
 
 //export callbackQVBoxPlotModelMapper_FirstBoxSetColumnChanged
 func callbackQVBoxPlotModelMapper_FirstBoxSetColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstBoxSetColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstBoxSetColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14167,14 +14222,14 @@ func callbackQVBoxPlotModelMapper_FirstBoxSetColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QVBoxPlotModelMapper) ConnectFirstBoxSetColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_ConnectFirstBoxSetColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstBoxSetColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstBoxSetColumnChanged", f)
 	}
 }
 
 func (ptr *QVBoxPlotModelMapper) DisconnectFirstBoxSetColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_DisconnectFirstBoxSetColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstBoxSetColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstBoxSetColumnChanged")
 	}
 }
 
@@ -14186,7 +14241,7 @@ func (ptr *QVBoxPlotModelMapper) FirstBoxSetColumnChanged() {
 
 //export callbackQVBoxPlotModelMapper_FirstRowChanged
 func callbackQVBoxPlotModelMapper_FirstRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14195,14 +14250,14 @@ func callbackQVBoxPlotModelMapper_FirstRowChanged(ptr unsafe.Pointer) {
 func (ptr *QVBoxPlotModelMapper) ConnectFirstRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_ConnectFirstRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstRowChanged", f)
 	}
 }
 
 func (ptr *QVBoxPlotModelMapper) DisconnectFirstRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_DisconnectFirstRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstRowChanged")
 	}
 }
 
@@ -14214,7 +14269,7 @@ func (ptr *QVBoxPlotModelMapper) FirstRowChanged() {
 
 //export callbackQVBoxPlotModelMapper_LastBoxSetColumnChanged
 func callbackQVBoxPlotModelMapper_LastBoxSetColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lastBoxSetColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lastBoxSetColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14223,14 +14278,14 @@ func callbackQVBoxPlotModelMapper_LastBoxSetColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QVBoxPlotModelMapper) ConnectLastBoxSetColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_ConnectLastBoxSetColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lastBoxSetColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lastBoxSetColumnChanged", f)
 	}
 }
 
 func (ptr *QVBoxPlotModelMapper) DisconnectLastBoxSetColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_DisconnectLastBoxSetColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lastBoxSetColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lastBoxSetColumnChanged")
 	}
 }
 
@@ -14242,7 +14297,7 @@ func (ptr *QVBoxPlotModelMapper) LastBoxSetColumnChanged() {
 
 //export callbackQVBoxPlotModelMapper_ModelReplaced
 func callbackQVBoxPlotModelMapper_ModelReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14251,14 +14306,14 @@ func callbackQVBoxPlotModelMapper_ModelReplaced(ptr unsafe.Pointer) {
 func (ptr *QVBoxPlotModelMapper) ConnectModelReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_ConnectModelReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReplaced", f)
 	}
 }
 
 func (ptr *QVBoxPlotModelMapper) DisconnectModelReplaced() {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_DisconnectModelReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReplaced")
 	}
 }
 
@@ -14270,7 +14325,7 @@ func (ptr *QVBoxPlotModelMapper) ModelReplaced() {
 
 //export callbackQVBoxPlotModelMapper_RowCountChanged
 func callbackQVBoxPlotModelMapper_RowCountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCountChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14279,14 +14334,14 @@ func callbackQVBoxPlotModelMapper_RowCountChanged(ptr unsafe.Pointer) {
 func (ptr *QVBoxPlotModelMapper) ConnectRowCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_ConnectRowCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCountChanged", f)
 	}
 }
 
 func (ptr *QVBoxPlotModelMapper) DisconnectRowCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_DisconnectRowCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCountChanged")
 	}
 }
 
@@ -14298,7 +14353,7 @@ func (ptr *QVBoxPlotModelMapper) RowCountChanged() {
 
 //export callbackQVBoxPlotModelMapper_SeriesReplaced
 func callbackQVBoxPlotModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14307,14 +14362,14 @@ func callbackQVBoxPlotModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
 func (ptr *QVBoxPlotModelMapper) ConnectSeriesReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_ConnectSeriesReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesReplaced", f)
 	}
 }
 
 func (ptr *QVBoxPlotModelMapper) DisconnectSeriesReplaced() {
 	if ptr.Pointer() != nil {
 		C.QVBoxPlotModelMapper_DisconnectSeriesReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesReplaced")
 	}
 }
 
@@ -14363,7 +14418,7 @@ func (ptr *QVBoxPlotModelMapper) SetSeries(series QBoxPlotSeries_ITF) {
 func (ptr *QVBoxPlotModelMapper) Model() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QVBoxPlotModelMapper_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14447,7 +14502,7 @@ func NewQVCandlestickModelMapperFromPointer(ptr unsafe.Pointer) *QVCandlestickMo
 func (ptr *QVCandlestickModelMapper) DestroyQVCandlestickModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14458,7 +14513,7 @@ func NewQVCandlestickModelMapper(parent core.QObject_ITF) *QVCandlestickModelMap
 
 //export callbackQVCandlestickModelMapper_CloseRowChanged
 func callbackQVCandlestickModelMapper_CloseRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14467,14 +14522,14 @@ func callbackQVCandlestickModelMapper_CloseRowChanged(ptr unsafe.Pointer) {
 func (ptr *QVCandlestickModelMapper) ConnectCloseRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_ConnectCloseRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "closeRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "closeRowChanged", f)
 	}
 }
 
 func (ptr *QVCandlestickModelMapper) DisconnectCloseRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_DisconnectCloseRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "closeRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "closeRowChanged")
 	}
 }
 
@@ -14486,7 +14541,7 @@ func (ptr *QVCandlestickModelMapper) CloseRowChanged() {
 
 //export callbackQVCandlestickModelMapper_FirstSetColumnChanged
 func callbackQVCandlestickModelMapper_FirstSetColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstSetColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstSetColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14495,14 +14550,14 @@ func callbackQVCandlestickModelMapper_FirstSetColumnChanged(ptr unsafe.Pointer)
 func (ptr *QVCandlestickModelMapper) ConnectFirstSetColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_ConnectFirstSetColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstSetColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstSetColumnChanged", f)
 	}
 }
 
 func (ptr *QVCandlestickModelMapper) DisconnectFirstSetColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_DisconnectFirstSetColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstSetColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstSetColumnChanged")
 	}
 }
 
@@ -14514,7 +14569,7 @@ func (ptr *QVCandlestickModelMapper) FirstSetColumnChanged() {
 
 //export callbackQVCandlestickModelMapper_HighRowChanged
 func callbackQVCandlestickModelMapper_HighRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "highRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "highRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14523,14 +14578,14 @@ func callbackQVCandlestickModelMapper_HighRowChanged(ptr unsafe.Pointer) {
 func (ptr *QVCandlestickModelMapper) ConnectHighRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_ConnectHighRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "highRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "highRowChanged", f)
 	}
 }
 
 func (ptr *QVCandlestickModelMapper) DisconnectHighRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_DisconnectHighRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "highRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "highRowChanged")
 	}
 }
 
@@ -14542,7 +14597,7 @@ func (ptr *QVCandlestickModelMapper) HighRowChanged() {
 
 //export callbackQVCandlestickModelMapper_LastSetColumnChanged
 func callbackQVCandlestickModelMapper_LastSetColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lastSetColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lastSetColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14551,14 +14606,14 @@ func callbackQVCandlestickModelMapper_LastSetColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QVCandlestickModelMapper) ConnectLastSetColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_ConnectLastSetColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lastSetColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lastSetColumnChanged", f)
 	}
 }
 
 func (ptr *QVCandlestickModelMapper) DisconnectLastSetColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_DisconnectLastSetColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lastSetColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lastSetColumnChanged")
 	}
 }
 
@@ -14570,7 +14625,7 @@ func (ptr *QVCandlestickModelMapper) LastSetColumnChanged() {
 
 //export callbackQVCandlestickModelMapper_LowRowChanged
 func callbackQVCandlestickModelMapper_LowRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lowRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lowRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14579,14 +14634,14 @@ func callbackQVCandlestickModelMapper_LowRowChanged(ptr unsafe.Pointer) {
 func (ptr *QVCandlestickModelMapper) ConnectLowRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_ConnectLowRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lowRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lowRowChanged", f)
 	}
 }
 
 func (ptr *QVCandlestickModelMapper) DisconnectLowRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_DisconnectLowRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lowRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lowRowChanged")
 	}
 }
 
@@ -14598,7 +14653,7 @@ func (ptr *QVCandlestickModelMapper) LowRowChanged() {
 
 //export callbackQVCandlestickModelMapper_OpenRowChanged
 func callbackQVCandlestickModelMapper_OpenRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "openRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "openRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14607,14 +14662,14 @@ func callbackQVCandlestickModelMapper_OpenRowChanged(ptr unsafe.Pointer) {
 func (ptr *QVCandlestickModelMapper) ConnectOpenRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_ConnectOpenRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "openRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "openRowChanged", f)
 	}
 }
 
 func (ptr *QVCandlestickModelMapper) DisconnectOpenRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_DisconnectOpenRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "openRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "openRowChanged")
 	}
 }
 
@@ -14668,7 +14723,7 @@ func (ptr *QVCandlestickModelMapper) SetTimestampRow(timestampRow int) {
 
 //export callbackQVCandlestickModelMapper_TimestampRowChanged
 func callbackQVCandlestickModelMapper_TimestampRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timestampRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timestampRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14677,14 +14732,14 @@ func callbackQVCandlestickModelMapper_TimestampRowChanged(ptr unsafe.Pointer) {
 func (ptr *QVCandlestickModelMapper) ConnectTimestampRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_ConnectTimestampRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "timestampRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "timestampRowChanged", f)
 	}
 }
 
 func (ptr *QVCandlestickModelMapper) DisconnectTimestampRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QVCandlestickModelMapper_DisconnectTimestampRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "timestampRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "timestampRowChanged")
 	}
 }
 
@@ -14696,7 +14751,7 @@ func (ptr *QVCandlestickModelMapper) TimestampRowChanged() {
 
 //export callbackQVCandlestickModelMapper_Orientation
 func callbackQVCandlestickModelMapper_Orientation(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "orientation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "orientation"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__Orientation)())
 	}
 
@@ -14706,14 +14761,14 @@ func callbackQVCandlestickModelMapper_Orientation(ptr unsafe.Pointer) C.longlong
 func (ptr *QVCandlestickModelMapper) ConnectOrientation(f func() core.Qt__Orientation) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "orientation", f)
+		qt.ConnectSignal(ptr.Pointer(), "orientation", f)
 	}
 }
 
 func (ptr *QVCandlestickModelMapper) DisconnectOrientation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "orientation")
+		qt.DisconnectSignal(ptr.Pointer(), "orientation")
 	}
 }
 
@@ -14821,7 +14876,7 @@ func NewQVPieModelMapperFromPointer(ptr unsafe.Pointer) *QVPieModelMapper {
 func (ptr *QVPieModelMapper) DestroyQVPieModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14832,7 +14887,7 @@ func NewQVPieModelMapper(parent core.QObject_ITF) *QVPieModelMapper {
 
 //export callbackQVPieModelMapper_FirstRowChanged
 func callbackQVPieModelMapper_FirstRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14841,14 +14896,14 @@ func callbackQVPieModelMapper_FirstRowChanged(ptr unsafe.Pointer) {
 func (ptr *QVPieModelMapper) ConnectFirstRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_ConnectFirstRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstRowChanged", f)
 	}
 }
 
 func (ptr *QVPieModelMapper) DisconnectFirstRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_DisconnectFirstRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstRowChanged")
 	}
 }
 
@@ -14860,7 +14915,7 @@ func (ptr *QVPieModelMapper) FirstRowChanged() {
 
 //export callbackQVPieModelMapper_LabelsColumnChanged
 func callbackQVPieModelMapper_LabelsColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14869,14 +14924,14 @@ func callbackQVPieModelMapper_LabelsColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QVPieModelMapper) ConnectLabelsColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_ConnectLabelsColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsColumnChanged", f)
 	}
 }
 
 func (ptr *QVPieModelMapper) DisconnectLabelsColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_DisconnectLabelsColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsColumnChanged")
 	}
 }
 
@@ -14888,7 +14943,7 @@ func (ptr *QVPieModelMapper) LabelsColumnChanged() {
 
 //export callbackQVPieModelMapper_ModelReplaced
 func callbackQVPieModelMapper_ModelReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14897,14 +14952,14 @@ func callbackQVPieModelMapper_ModelReplaced(ptr unsafe.Pointer) {
 func (ptr *QVPieModelMapper) ConnectModelReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_ConnectModelReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReplaced", f)
 	}
 }
 
 func (ptr *QVPieModelMapper) DisconnectModelReplaced() {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_DisconnectModelReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReplaced")
 	}
 }
 
@@ -14916,7 +14971,7 @@ func (ptr *QVPieModelMapper) ModelReplaced() {
 
 //export callbackQVPieModelMapper_RowCountChanged
 func callbackQVPieModelMapper_RowCountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCountChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14925,14 +14980,14 @@ func callbackQVPieModelMapper_RowCountChanged(ptr unsafe.Pointer) {
 func (ptr *QVPieModelMapper) ConnectRowCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_ConnectRowCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCountChanged", f)
 	}
 }
 
 func (ptr *QVPieModelMapper) DisconnectRowCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_DisconnectRowCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCountChanged")
 	}
 }
 
@@ -14944,7 +14999,7 @@ func (ptr *QVPieModelMapper) RowCountChanged() {
 
 //export callbackQVPieModelMapper_SeriesReplaced
 func callbackQVPieModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14953,14 +15008,14 @@ func callbackQVPieModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
 func (ptr *QVPieModelMapper) ConnectSeriesReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_ConnectSeriesReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesReplaced", f)
 	}
 }
 
 func (ptr *QVPieModelMapper) DisconnectSeriesReplaced() {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_DisconnectSeriesReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesReplaced")
 	}
 }
 
@@ -15008,7 +15063,7 @@ func (ptr *QVPieModelMapper) SetValuesColumn(valuesColumn int) {
 
 //export callbackQVPieModelMapper_ValuesColumnChanged
 func callbackQVPieModelMapper_ValuesColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valuesColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valuesColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15017,14 +15072,14 @@ func callbackQVPieModelMapper_ValuesColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QVPieModelMapper) ConnectValuesColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_ConnectValuesColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valuesColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valuesColumnChanged", f)
 	}
 }
 
 func (ptr *QVPieModelMapper) DisconnectValuesColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVPieModelMapper_DisconnectValuesColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valuesColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valuesColumnChanged")
 	}
 }
 
@@ -15037,7 +15092,7 @@ func (ptr *QVPieModelMapper) ValuesColumnChanged() {
 func (ptr *QVPieModelMapper) Model() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QVPieModelMapper_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -15121,7 +15176,7 @@ func NewQVXYModelMapperFromPointer(ptr unsafe.Pointer) *QVXYModelMapper {
 func (ptr *QVXYModelMapper) DestroyQVXYModelMapper() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15132,7 +15187,7 @@ func NewQVXYModelMapper(parent core.QObject_ITF) *QVXYModelMapper {
 
 //export callbackQVXYModelMapper_FirstRowChanged
 func callbackQVXYModelMapper_FirstRowChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "firstRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "firstRowChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15141,14 +15196,14 @@ func callbackQVXYModelMapper_FirstRowChanged(ptr unsafe.Pointer) {
 func (ptr *QVXYModelMapper) ConnectFirstRowChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_ConnectFirstRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "firstRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "firstRowChanged", f)
 	}
 }
 
 func (ptr *QVXYModelMapper) DisconnectFirstRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_DisconnectFirstRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "firstRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "firstRowChanged")
 	}
 }
 
@@ -15160,7 +15215,7 @@ func (ptr *QVXYModelMapper) FirstRowChanged() {
 
 //export callbackQVXYModelMapper_ModelReplaced
 func callbackQVXYModelMapper_ModelReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15169,14 +15224,14 @@ func callbackQVXYModelMapper_ModelReplaced(ptr unsafe.Pointer) {
 func (ptr *QVXYModelMapper) ConnectModelReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_ConnectModelReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReplaced", f)
 	}
 }
 
 func (ptr *QVXYModelMapper) DisconnectModelReplaced() {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_DisconnectModelReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReplaced")
 	}
 }
 
@@ -15188,7 +15243,7 @@ func (ptr *QVXYModelMapper) ModelReplaced() {
 
 //export callbackQVXYModelMapper_RowCountChanged
 func callbackQVXYModelMapper_RowCountChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCountChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15197,14 +15252,14 @@ func callbackQVXYModelMapper_RowCountChanged(ptr unsafe.Pointer) {
 func (ptr *QVXYModelMapper) ConnectRowCountChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_ConnectRowCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCountChanged", f)
 	}
 }
 
 func (ptr *QVXYModelMapper) DisconnectRowCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_DisconnectRowCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCountChanged")
 	}
 }
 
@@ -15216,7 +15271,7 @@ func (ptr *QVXYModelMapper) RowCountChanged() {
 
 //export callbackQVXYModelMapper_SeriesReplaced
 func callbackQVXYModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15225,14 +15280,14 @@ func callbackQVXYModelMapper_SeriesReplaced(ptr unsafe.Pointer) {
 func (ptr *QVXYModelMapper) ConnectSeriesReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_ConnectSeriesReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesReplaced", f)
 	}
 }
 
 func (ptr *QVXYModelMapper) DisconnectSeriesReplaced() {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_DisconnectSeriesReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesReplaced")
 	}
 }
 
@@ -15280,7 +15335,7 @@ func (ptr *QVXYModelMapper) SetYColumn(yColumn int) {
 
 //export callbackQVXYModelMapper_XColumnChanged
 func callbackQVXYModelMapper_XColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15289,14 +15344,14 @@ func callbackQVXYModelMapper_XColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QVXYModelMapper) ConnectXColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_ConnectXColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xColumnChanged", f)
 	}
 }
 
 func (ptr *QVXYModelMapper) DisconnectXColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_DisconnectXColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xColumnChanged")
 	}
 }
 
@@ -15308,7 +15363,7 @@ func (ptr *QVXYModelMapper) XColumnChanged() {
 
 //export callbackQVXYModelMapper_YColumnChanged
 func callbackQVXYModelMapper_YColumnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yColumnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15317,14 +15372,14 @@ func callbackQVXYModelMapper_YColumnChanged(ptr unsafe.Pointer) {
 func (ptr *QVXYModelMapper) ConnectYColumnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_ConnectYColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yColumnChanged", f)
 	}
 }
 
 func (ptr *QVXYModelMapper) DisconnectYColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QVXYModelMapper_DisconnectYColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yColumnChanged")
 	}
 }
 
@@ -15337,7 +15392,7 @@ func (ptr *QVXYModelMapper) YColumnChanged() {
 func (ptr *QVXYModelMapper) Model() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QVXYModelMapper_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -15423,7 +15478,7 @@ func NewQValueAxis(parent core.QObject_ITF) *QValueAxis {
 
 //export callbackQValueAxis_ApplyNiceNumbers
 func callbackQValueAxis_ApplyNiceNumbers(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "applyNiceNumbers"); signal != nil {
+	if signal := qt.GetSignal(ptr, "applyNiceNumbers"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQValueAxisFromPointer(ptr).ApplyNiceNumbersDefault()
@@ -15433,14 +15488,14 @@ func callbackQValueAxis_ApplyNiceNumbers(ptr unsafe.Pointer) {
 func (ptr *QValueAxis) ConnectApplyNiceNumbers(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "applyNiceNumbers", f)
+		qt.ConnectSignal(ptr.Pointer(), "applyNiceNumbers", f)
 	}
 }
 
 func (ptr *QValueAxis) DisconnectApplyNiceNumbers() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "applyNiceNumbers")
+		qt.DisconnectSignal(ptr.Pointer(), "applyNiceNumbers")
 	}
 }
 
@@ -15458,7 +15513,7 @@ func (ptr *QValueAxis) ApplyNiceNumbersDefault() {
 
 //export callbackQValueAxis_LabelFormatChanged
 func callbackQValueAxis_LabelFormatChanged(ptr unsafe.Pointer, format C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelFormatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelFormatChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(format))
 	}
 
@@ -15467,14 +15522,14 @@ func callbackQValueAxis_LabelFormatChanged(ptr unsafe.Pointer, format C.struct_Q
 func (ptr *QValueAxis) ConnectLabelFormatChanged(f func(format string)) {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_ConnectLabelFormatChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelFormatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelFormatChanged", f)
 	}
 }
 
 func (ptr *QValueAxis) DisconnectLabelFormatChanged() {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_DisconnectLabelFormatChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelFormatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelFormatChanged")
 	}
 }
 
@@ -15488,7 +15543,7 @@ func (ptr *QValueAxis) LabelFormatChanged(format string) {
 
 //export callbackQValueAxis_MaxChanged
 func callbackQValueAxis_MaxChanged(ptr unsafe.Pointer, max C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maxChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maxChanged"); signal != nil {
 		signal.(func(float64))(float64(max))
 	}
 
@@ -15497,14 +15552,14 @@ func callbackQValueAxis_MaxChanged(ptr unsafe.Pointer, max C.double) {
 func (ptr *QValueAxis) ConnectMaxChanged(f func(max float64)) {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_ConnectMaxChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maxChanged", f)
 	}
 }
 
 func (ptr *QValueAxis) DisconnectMaxChanged() {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_DisconnectMaxChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maxChanged")
 	}
 }
 
@@ -15516,7 +15571,7 @@ func (ptr *QValueAxis) MaxChanged(max float64) {
 
 //export callbackQValueAxis_MinChanged
 func callbackQValueAxis_MinChanged(ptr unsafe.Pointer, min C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minChanged"); signal != nil {
 		signal.(func(float64))(float64(min))
 	}
 
@@ -15525,14 +15580,14 @@ func callbackQValueAxis_MinChanged(ptr unsafe.Pointer, min C.double) {
 func (ptr *QValueAxis) ConnectMinChanged(f func(min float64)) {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_ConnectMinChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minChanged", f)
 	}
 }
 
 func (ptr *QValueAxis) DisconnectMinChanged() {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_DisconnectMinChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minChanged")
 	}
 }
 
@@ -15544,7 +15599,7 @@ func (ptr *QValueAxis) MinChanged(min float64) {
 
 //export callbackQValueAxis_MinorTickCountChanged
 func callbackQValueAxis_MinorTickCountChanged(ptr unsafe.Pointer, minorTickCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minorTickCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minorTickCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(minorTickCount)))
 	}
 
@@ -15553,14 +15608,14 @@ func callbackQValueAxis_MinorTickCountChanged(ptr unsafe.Pointer, minorTickCount
 func (ptr *QValueAxis) ConnectMinorTickCountChanged(f func(minorTickCount int)) {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_ConnectMinorTickCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minorTickCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minorTickCountChanged", f)
 	}
 }
 
 func (ptr *QValueAxis) DisconnectMinorTickCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_DisconnectMinorTickCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minorTickCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minorTickCountChanged")
 	}
 }
 
@@ -15572,7 +15627,7 @@ func (ptr *QValueAxis) MinorTickCountChanged(minorTickCount int) {
 
 //export callbackQValueAxis_RangeChanged
 func callbackQValueAxis_RangeChanged(ptr unsafe.Pointer, min C.double, max C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rangeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rangeChanged"); signal != nil {
 		signal.(func(float64, float64))(float64(min), float64(max))
 	}
 
@@ -15581,14 +15636,14 @@ func callbackQValueAxis_RangeChanged(ptr unsafe.Pointer, min C.double, max C.dou
 func (ptr *QValueAxis) ConnectRangeChanged(f func(min float64, max float64)) {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_ConnectRangeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rangeChanged", f)
 	}
 }
 
 func (ptr *QValueAxis) DisconnectRangeChanged() {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_DisconnectRangeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rangeChanged")
 	}
 }
 
@@ -15638,7 +15693,7 @@ func (ptr *QValueAxis) SetTickCount(count int) {
 
 //export callbackQValueAxis_TickCountChanged
 func callbackQValueAxis_TickCountChanged(ptr unsafe.Pointer, tickCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tickCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tickCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(tickCount)))
 	}
 
@@ -15647,14 +15702,14 @@ func callbackQValueAxis_TickCountChanged(ptr unsafe.Pointer, tickCount C.int) {
 func (ptr *QValueAxis) ConnectTickCountChanged(f func(tickCount int)) {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_ConnectTickCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "tickCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "tickCountChanged", f)
 	}
 }
 
 func (ptr *QValueAxis) DisconnectTickCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_DisconnectTickCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "tickCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "tickCountChanged")
 	}
 }
 
@@ -15667,7 +15722,7 @@ func (ptr *QValueAxis) TickCountChanged(tickCount int) {
 func (ptr *QValueAxis) DestroyQValueAxis() {
 	if ptr.Pointer() != nil {
 		C.QValueAxis_DestroyQValueAxis(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15747,7 +15802,7 @@ func NewQXYLegendMarkerFromPointer(ptr unsafe.Pointer) *QXYLegendMarker {
 
 //export callbackQXYLegendMarker_Series
 func callbackQXYLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "series"); signal != nil {
+	if signal := qt.GetSignal(ptr, "series"); signal != nil {
 		return PointerFromQXYSeries(signal.(func() *QXYSeries)())
 	}
 
@@ -15757,14 +15812,14 @@ func callbackQXYLegendMarker_Series(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXYLegendMarker) ConnectSeries(f func() *QXYSeries) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "series", f)
+		qt.ConnectSignal(ptr.Pointer(), "series", f)
 	}
 }
 
 func (ptr *QXYLegendMarker) DisconnectSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "series")
+		qt.DisconnectSignal(ptr.Pointer(), "series")
 	}
 }
 
@@ -15784,7 +15839,7 @@ func (ptr *QXYLegendMarker) SeriesDefault() *QXYSeries {
 
 //export callbackQXYLegendMarker_DestroyQXYLegendMarker
 func callbackQXYLegendMarker_DestroyQXYLegendMarker(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXYLegendMarker"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXYLegendMarker"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXYLegendMarkerFromPointer(ptr).DestroyQXYLegendMarkerDefault()
@@ -15794,21 +15849,21 @@ func callbackQXYLegendMarker_DestroyQXYLegendMarker(ptr unsafe.Pointer) {
 func (ptr *QXYLegendMarker) ConnectDestroyQXYLegendMarker(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXYLegendMarker", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXYLegendMarker", f)
 	}
 }
 
 func (ptr *QXYLegendMarker) DisconnectDestroyQXYLegendMarker() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXYLegendMarker")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXYLegendMarker")
 	}
 }
 
 func (ptr *QXYLegendMarker) DestroyQXYLegendMarker() {
 	if ptr.Pointer() != nil {
 		C.QXYLegendMarker_DestroyQXYLegendMarker(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15816,7 +15871,7 @@ func (ptr *QXYLegendMarker) DestroyQXYLegendMarker() {
 func (ptr *QXYLegendMarker) DestroyQXYLegendMarkerDefault() {
 	if ptr.Pointer() != nil {
 		C.QXYLegendMarker_DestroyQXYLegendMarkerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15860,13 +15915,13 @@ func NewQXYSeriesFromPointer(ptr unsafe.Pointer) *QXYSeries {
 }
 func (ptr *QXYSeries) Append3(points []*core.QPointF) {
 	if ptr.Pointer() != nil {
-		C.QXYSeries_Append3(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQXYSeriesFromPointer(NewQXYSeriesFromPointer(nil).__append_points_newList3())
-			for _, v := range points {
-				tmpList.__append_points_setList3(v)
+		C.QXYSeries_Append3(ptr.Pointer(), func(l []*core.QPointF) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQPointF(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQXYSeriesFromPointer(nil).__append_points_newListBuffer3(unsafe.Pointer(&tmpList[0]), len(l))
+		}(points))
 	}
 }
 
@@ -15890,7 +15945,7 @@ func (ptr *QXYSeries) Clear() {
 
 //export callbackQXYSeries_Clicked
 func callbackQXYSeries_Clicked(ptr unsafe.Pointer, point unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func(*core.QPointF))(core.NewQPointFFromPointer(point))
 	}
 
@@ -15899,14 +15954,14 @@ func callbackQXYSeries_Clicked(ptr unsafe.Pointer, point unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectClicked(f func(point *core.QPointF)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "clicked", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectClicked() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clicked")
+		qt.DisconnectSignal(ptr.Pointer(), "clicked")
 	}
 }
 
@@ -15918,7 +15973,7 @@ func (ptr *QXYSeries) Clicked(point core.QPointF_ITF) {
 
 //export callbackQXYSeries_ColorChanged
 func callbackQXYSeries_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -15927,14 +15982,14 @@ func callbackQXYSeries_ColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorChanged", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorChanged")
 	}
 }
 
@@ -15946,7 +16001,7 @@ func (ptr *QXYSeries) ColorChanged(color gui.QColor_ITF) {
 
 //export callbackQXYSeries_DoubleClicked
 func callbackQXYSeries_DoubleClicked(ptr unsafe.Pointer, point unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func(*core.QPointF))(core.NewQPointFFromPointer(point))
 	}
 
@@ -15955,14 +16010,14 @@ func callbackQXYSeries_DoubleClicked(ptr unsafe.Pointer, point unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectDoubleClicked(f func(point *core.QPointF)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectDoubleClicked(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked", f)
+		qt.ConnectSignal(ptr.Pointer(), "doubleClicked", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectDoubleClicked() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectDoubleClicked(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doubleClicked")
+		qt.DisconnectSignal(ptr.Pointer(), "doubleClicked")
 	}
 }
 
@@ -15974,7 +16029,7 @@ func (ptr *QXYSeries) DoubleClicked(point core.QPointF_ITF) {
 
 //export callbackQXYSeries_Hovered
 func callbackQXYSeries_Hovered(ptr unsafe.Pointer, point unsafe.Pointer, state C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hovered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hovered"); signal != nil {
 		signal.(func(*core.QPointF, bool))(core.NewQPointFFromPointer(point), int8(state) != 0)
 	}
 
@@ -15983,14 +16038,14 @@ func callbackQXYSeries_Hovered(ptr unsafe.Pointer, point unsafe.Pointer, state C
 func (ptr *QXYSeries) ConnectHovered(f func(point *core.QPointF, state bool)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectHovered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hovered", f)
+		qt.ConnectSignal(ptr.Pointer(), "hovered", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectHovered() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectHovered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hovered")
+		qt.DisconnectSignal(ptr.Pointer(), "hovered")
 	}
 }
 
@@ -16008,7 +16063,7 @@ func (ptr *QXYSeries) Insert(index int, point core.QPointF_ITF) {
 
 //export callbackQXYSeries_PenChanged
 func callbackQXYSeries_PenChanged(ptr unsafe.Pointer, pen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "penChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "penChanged"); signal != nil {
 		signal.(func(*gui.QPen))(gui.NewQPenFromPointer(pen))
 	}
 
@@ -16017,14 +16072,14 @@ func callbackQXYSeries_PenChanged(ptr unsafe.Pointer, pen unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectPenChanged(f func(pen *gui.QPen)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "penChanged", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPenChanged() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "penChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "penChanged")
 	}
 }
 
@@ -16036,7 +16091,7 @@ func (ptr *QXYSeries) PenChanged(pen gui.QPen_ITF) {
 
 //export callbackQXYSeries_PointAdded
 func callbackQXYSeries_PointAdded(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointAdded"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -16045,14 +16100,14 @@ func callbackQXYSeries_PointAdded(ptr unsafe.Pointer, index C.int) {
 func (ptr *QXYSeries) ConnectPointAdded(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointAdded", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointAdded() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "pointAdded")
 	}
 }
 
@@ -16064,7 +16119,7 @@ func (ptr *QXYSeries) PointAdded(index int) {
 
 //export callbackQXYSeries_PointLabelsClippingChanged
 func callbackQXYSeries_PointLabelsClippingChanged(ptr unsafe.Pointer, clipping C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsClippingChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsClippingChanged"); signal != nil {
 		signal.(func(bool))(int8(clipping) != 0)
 	}
 
@@ -16073,14 +16128,14 @@ func callbackQXYSeries_PointLabelsClippingChanged(ptr unsafe.Pointer, clipping C
 func (ptr *QXYSeries) ConnectPointLabelsClippingChanged(f func(clipping bool)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointLabelsClippingChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsClippingChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsClippingChanged", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointLabelsClippingChanged() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointLabelsClippingChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsClippingChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsClippingChanged")
 	}
 }
 
@@ -16092,7 +16147,7 @@ func (ptr *QXYSeries) PointLabelsClippingChanged(clipping bool) {
 
 //export callbackQXYSeries_PointLabelsColorChanged
 func callbackQXYSeries_PointLabelsColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -16101,14 +16156,14 @@ func callbackQXYSeries_PointLabelsColorChanged(ptr unsafe.Pointer, color unsafe.
 func (ptr *QXYSeries) ConnectPointLabelsColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointLabelsColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsColorChanged", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointLabelsColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointLabelsColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsColorChanged")
 	}
 }
 
@@ -16120,7 +16175,7 @@ func (ptr *QXYSeries) PointLabelsColorChanged(color gui.QColor_ITF) {
 
 //export callbackQXYSeries_PointLabelsFontChanged
 func callbackQXYSeries_PointLabelsFontChanged(ptr unsafe.Pointer, font unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsFontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsFontChanged"); signal != nil {
 		signal.(func(*gui.QFont))(gui.NewQFontFromPointer(font))
 	}
 
@@ -16129,14 +16184,14 @@ func callbackQXYSeries_PointLabelsFontChanged(ptr unsafe.Pointer, font unsafe.Po
 func (ptr *QXYSeries) ConnectPointLabelsFontChanged(f func(font *gui.QFont)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointLabelsFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsFontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsFontChanged", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointLabelsFontChanged() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointLabelsFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsFontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsFontChanged")
 	}
 }
 
@@ -16148,7 +16203,7 @@ func (ptr *QXYSeries) PointLabelsFontChanged(font gui.QFont_ITF) {
 
 //export callbackQXYSeries_PointLabelsFormatChanged
 func callbackQXYSeries_PointLabelsFormatChanged(ptr unsafe.Pointer, format C.struct_QtCharts_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsFormatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsFormatChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(format))
 	}
 
@@ -16157,14 +16212,14 @@ func callbackQXYSeries_PointLabelsFormatChanged(ptr unsafe.Pointer, format C.str
 func (ptr *QXYSeries) ConnectPointLabelsFormatChanged(f func(format string)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointLabelsFormatChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsFormatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsFormatChanged", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointLabelsFormatChanged() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointLabelsFormatChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsFormatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsFormatChanged")
 	}
 }
 
@@ -16178,7 +16233,7 @@ func (ptr *QXYSeries) PointLabelsFormatChanged(format string) {
 
 //export callbackQXYSeries_PointLabelsVisibilityChanged
 func callbackQXYSeries_PointLabelsVisibilityChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointLabelsVisibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointLabelsVisibilityChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -16187,14 +16242,14 @@ func callbackQXYSeries_PointLabelsVisibilityChanged(ptr unsafe.Pointer, visible
 func (ptr *QXYSeries) ConnectPointLabelsVisibilityChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointLabelsVisibilityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsVisibilityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointLabelsVisibilityChanged", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointLabelsVisibilityChanged() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointLabelsVisibilityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointLabelsVisibilityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pointLabelsVisibilityChanged")
 	}
 }
 
@@ -16206,7 +16261,7 @@ func (ptr *QXYSeries) PointLabelsVisibilityChanged(visible bool) {
 
 //export callbackQXYSeries_PointRemoved
 func callbackQXYSeries_PointRemoved(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointRemoved"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -16215,14 +16270,14 @@ func callbackQXYSeries_PointRemoved(ptr unsafe.Pointer, index C.int) {
 func (ptr *QXYSeries) ConnectPointRemoved(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointRemoved", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointRemoved() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "pointRemoved")
 	}
 }
 
@@ -16234,7 +16289,7 @@ func (ptr *QXYSeries) PointRemoved(index int) {
 
 //export callbackQXYSeries_PointReplaced
 func callbackQXYSeries_PointReplaced(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointReplaced"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -16243,14 +16298,14 @@ func callbackQXYSeries_PointReplaced(ptr unsafe.Pointer, index C.int) {
 func (ptr *QXYSeries) ConnectPointReplaced(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointReplaced", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointReplaced() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "pointReplaced")
 	}
 }
 
@@ -16262,7 +16317,7 @@ func (ptr *QXYSeries) PointReplaced(index int) {
 
 //export callbackQXYSeries_PointsRemoved
 func callbackQXYSeries_PointsRemoved(ptr unsafe.Pointer, index C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointsRemoved"); signal != nil {
 		signal.(func(int, int))(int(int32(index)), int(int32(count)))
 	}
 
@@ -16271,14 +16326,14 @@ func callbackQXYSeries_PointsRemoved(ptr unsafe.Pointer, index C.int, count C.in
 func (ptr *QXYSeries) ConnectPointsRemoved(f func(index int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointsRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointsRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointsRemoved", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointsRemoved() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointsRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointsRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "pointsRemoved")
 	}
 }
 
@@ -16290,7 +16345,7 @@ func (ptr *QXYSeries) PointsRemoved(index int, count int) {
 
 //export callbackQXYSeries_PointsReplaced
 func callbackQXYSeries_PointsReplaced(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pointsReplaced"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pointsReplaced"); signal != nil {
 		signal.(func())()
 	}
 
@@ -16299,14 +16354,14 @@ func callbackQXYSeries_PointsReplaced(ptr unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectPointsReplaced(f func()) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPointsReplaced(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pointsReplaced", f)
+		qt.ConnectSignal(ptr.Pointer(), "pointsReplaced", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPointsReplaced() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPointsReplaced(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pointsReplaced")
+		qt.DisconnectSignal(ptr.Pointer(), "pointsReplaced")
 	}
 }
 
@@ -16318,7 +16373,7 @@ func (ptr *QXYSeries) PointsReplaced() {
 
 //export callbackQXYSeries_Pressed
 func callbackQXYSeries_Pressed(ptr unsafe.Pointer, point unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func(*core.QPointF))(core.NewQPointFFromPointer(point))
 	}
 
@@ -16327,14 +16382,14 @@ func callbackQXYSeries_Pressed(ptr unsafe.Pointer, point unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectPressed(f func(point *core.QPointF)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectPressed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pressed", f)
+		qt.ConnectSignal(ptr.Pointer(), "pressed", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectPressed() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectPressed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pressed")
+		qt.DisconnectSignal(ptr.Pointer(), "pressed")
 	}
 }
 
@@ -16346,7 +16401,7 @@ func (ptr *QXYSeries) Pressed(point core.QPointF_ITF) {
 
 //export callbackQXYSeries_Released
 func callbackQXYSeries_Released(ptr unsafe.Pointer, point unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "released"); signal != nil {
+	if signal := qt.GetSignal(ptr, "released"); signal != nil {
 		signal.(func(*core.QPointF))(core.NewQPointFFromPointer(point))
 	}
 
@@ -16355,14 +16410,14 @@ func callbackQXYSeries_Released(ptr unsafe.Pointer, point unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectReleased(f func(point *core.QPointF)) {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_ConnectReleased(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "released", f)
+		qt.ConnectSignal(ptr.Pointer(), "released", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectReleased() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DisconnectReleased(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "released")
+		qt.DisconnectSignal(ptr.Pointer(), "released")
 	}
 }
 
@@ -16398,25 +16453,25 @@ func (ptr *QXYSeries) RemovePoints(index int, count int) {
 
 func (ptr *QXYSeries) Replace5(points []*core.QPointF) {
 	if ptr.Pointer() != nil {
-		C.QXYSeries_Replace5(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQXYSeriesFromPointer(NewQXYSeriesFromPointer(nil).__replace_points_newList5())
-			for _, v := range points {
-				tmpList.__replace_points_setList5(v)
+		C.QXYSeries_Replace5(ptr.Pointer(), func(l []*core.QPointF) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQPointF(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQXYSeriesFromPointer(nil).__replace_points_newListBuffer5(unsafe.Pointer(&tmpList[0]), len(l))
+		}(points))
 	}
 }
 
 func (ptr *QXYSeries) Replace6(points []*core.QPointF) {
 	if ptr.Pointer() != nil {
-		C.QXYSeries_Replace6(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQXYSeriesFromPointer(NewQXYSeriesFromPointer(nil).__replace_points_newList6())
-			for _, v := range points {
-				tmpList.__replace_points_setList6(v)
+		C.QXYSeries_Replace6(ptr.Pointer(), func(l []*core.QPointF) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQPointF(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQXYSeriesFromPointer(nil).__replace_points_newListBuffer6(unsafe.Pointer(&tmpList[0]), len(l))
+		}(points))
 	}
 }
 
@@ -16446,7 +16501,7 @@ func (ptr *QXYSeries) Replace(oldX float64, oldY float64, newX float64, newY flo
 
 //export callbackQXYSeries_SetBrush
 func callbackQXYSeries_SetBrush(ptr unsafe.Pointer, brush unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setBrush"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setBrush"); signal != nil {
 		signal.(func(*gui.QBrush))(gui.NewQBrushFromPointer(brush))
 	} else {
 		NewQXYSeriesFromPointer(ptr).SetBrushDefault(gui.NewQBrushFromPointer(brush))
@@ -16456,14 +16511,14 @@ func callbackQXYSeries_SetBrush(ptr unsafe.Pointer, brush unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectSetBrush(f func(brush *gui.QBrush)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setBrush", f)
+		qt.ConnectSignal(ptr.Pointer(), "setBrush", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectSetBrush() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setBrush")
+		qt.DisconnectSignal(ptr.Pointer(), "setBrush")
 	}
 }
 
@@ -16481,7 +16536,7 @@ func (ptr *QXYSeries) SetBrushDefault(brush gui.QBrush_ITF) {
 
 //export callbackQXYSeries_SetColor
 func callbackQXYSeries_SetColor(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setColor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setColor"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	} else {
 		NewQXYSeriesFromPointer(ptr).SetColorDefault(gui.NewQColorFromPointer(color))
@@ -16491,14 +16546,14 @@ func callbackQXYSeries_SetColor(ptr unsafe.Pointer, color unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectSetColor(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setColor", f)
+		qt.ConnectSignal(ptr.Pointer(), "setColor", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectSetColor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setColor")
+		qt.DisconnectSignal(ptr.Pointer(), "setColor")
 	}
 }
 
@@ -16516,7 +16571,7 @@ func (ptr *QXYSeries) SetColorDefault(color gui.QColor_ITF) {
 
 //export callbackQXYSeries_SetPen
 func callbackQXYSeries_SetPen(ptr unsafe.Pointer, pen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPen"); signal != nil {
 		signal.(func(*gui.QPen))(gui.NewQPenFromPointer(pen))
 	} else {
 		NewQXYSeriesFromPointer(ptr).SetPenDefault(gui.NewQPenFromPointer(pen))
@@ -16526,14 +16581,14 @@ func callbackQXYSeries_SetPen(ptr unsafe.Pointer, pen unsafe.Pointer) {
 func (ptr *QXYSeries) ConnectSetPen(f func(pen *gui.QPen)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPen", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPen", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectSetPen() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPen")
+		qt.DisconnectSignal(ptr.Pointer(), "setPen")
 	}
 }
 
@@ -16590,7 +16645,7 @@ func (ptr *QXYSeries) SetPointsVisible(visible bool) {
 func (ptr *QXYSeries) DestroyQXYSeries() {
 	if ptr.Pointer() != nil {
 		C.QXYSeries_DestroyQXYSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -16606,7 +16661,7 @@ func (ptr *QXYSeries) Brush() *gui.QBrush {
 
 //export callbackQXYSeries_Color
 func callbackQXYSeries_Color(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "color"); signal != nil {
+	if signal := qt.GetSignal(ptr, "color"); signal != nil {
 		return gui.PointerFromQColor(signal.(func() *gui.QColor)())
 	}
 
@@ -16616,14 +16671,14 @@ func callbackQXYSeries_Color(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXYSeries) ConnectColor(f func() *gui.QColor) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "color", f)
+		qt.ConnectSignal(ptr.Pointer(), "color", f)
 	}
 }
 
 func (ptr *QXYSeries) DisconnectColor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "color")
+		qt.DisconnectSignal(ptr.Pointer(), "color")
 	}
 }
 
@@ -16667,8 +16722,11 @@ func (ptr *QXYSeries) Points() []*core.QPointF {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtCharts_PackedList) []*core.QPointF {
 			var out = make([]*core.QPointF, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQXYSeriesFromPointer(l.data).__points_atList(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQXYSeriesFromPointer(l.data).__points_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = core.NewQPointFFromPointer(v)
+				runtime.SetFinalizer(out[i], (*core.QPointF).DestroyQPointF)
 			}
 			return out
 		}(C.QXYSeries_Points(ptr.Pointer()))
@@ -16696,8 +16754,11 @@ func (ptr *QXYSeries) PointsVector() []*core.QPointF {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtCharts_PackedList) []*core.QPointF {
 			var out = make([]*core.QPointF, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQXYSeriesFromPointer(l.data).__pointsVector_atList(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQXYSeriesFromPointer(l.data).__pointsVector_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = core.NewQPointFFromPointer(v)
+				runtime.SetFinalizer(out[i], (*core.QPointF).DestroyQPointF)
 			}
 			return out
 		}(C.QXYSeries_PointsVector(ptr.Pointer()))
@@ -16759,6 +16820,16 @@ func (ptr *QXYSeries) __append_points_newList3() unsafe.Pointer {
 	return unsafe.Pointer(C.QXYSeries___append_points_newList3(ptr.Pointer()))
 }
 
+func (ptr *QXYSeries) __append_points_newListBuffer3(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QXYSeries___append_points_newListBuffer3(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QXYSeries) __append_points_fillList3(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QXYSeries___append_points_fillList3(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QXYSeries) __replace_points_atList5(i int) *core.QPointF {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPointFFromPointer(C.QXYSeries___replace_points_atList5(ptr.Pointer(), C.int(int32(i))))
@@ -16778,6 +16849,16 @@ func (ptr *QXYSeries) __replace_points_newList5() unsafe.Pointer {
 	return unsafe.Pointer(C.QXYSeries___replace_points_newList5(ptr.Pointer()))
 }
 
+func (ptr *QXYSeries) __replace_points_newListBuffer5(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QXYSeries___replace_points_newListBuffer5(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QXYSeries) __replace_points_fillList5(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QXYSeries___replace_points_fillList5(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QXYSeries) __replace_points_atList6(i int) *core.QPointF {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPointFFromPointer(C.QXYSeries___replace_points_atList6(ptr.Pointer(), C.int(int32(i))))
@@ -16797,6 +16878,16 @@ func (ptr *QXYSeries) __replace_points_newList6() unsafe.Pointer {
 	return unsafe.Pointer(C.QXYSeries___replace_points_newList6(ptr.Pointer()))
 }
 
+func (ptr *QXYSeries) __replace_points_newListBuffer6(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QXYSeries___replace_points_newListBuffer6(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QXYSeries) __replace_points_fillList6(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QXYSeries___replace_points_fillList6(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QXYSeries) __points_atList(i int) *core.QPointF {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPointFFromPointer(C.QXYSeries___points_atList(ptr.Pointer(), C.int(int32(i))))
@@ -16816,6 +16907,16 @@ func (ptr *QXYSeries) __points_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QXYSeries___points_newList(ptr.Pointer()))
 }
 
+func (ptr *QXYSeries) __points_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QXYSeries___points_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QXYSeries) __points_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QXYSeries___points_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QXYSeries) __pointsVector_atList(i int) *core.QPointF {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPointFFromPointer(C.QXYSeries___pointsVector_atList(ptr.Pointer(), C.int(int32(i))))
@@ -16834,3 +16935,13 @@ func (ptr *QXYSeries) __pointsVector_setList(i core.QPointF_ITF) {
 func (ptr *QXYSeries) __pointsVector_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QXYSeries___pointsVector_newList(ptr.Pointer()))
 }
+
+func (ptr *QXYSeries) __pointsVector_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QXYSeries___pointsVector_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QXYSeries) __pointsVector_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QXYSeries___pointsVector_fillList(ptr.Pointer(), data)
+	}
+}
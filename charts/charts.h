@@ -434,6 +434,8 @@ double QBarSet_Sum(void* ptr);
 double QBarSet___append_values_atList2(void* ptr, int i);
 void QBarSet___append_values_setList2(void* ptr, double i);
 void* QBarSet___append_values_newList2(void* ptr);
+void* QBarSet___append_values_newListBuffer2(void* ptr, void* data, int count);
+void QBarSet___append_values_fillList2(void* ptr, void* data);
 void* QBoxPlotLegendMarker_Series(void* ptr);
 void* QBoxPlotLegendMarker_SeriesDefault(void* ptr);
 void QBoxPlotLegendMarker_DestroyQBoxPlotLegendMarker(void* ptr);
@@ -555,6 +557,8 @@ double QBoxSet_At(void* ptr, int index);
 double QBoxSet___append_values_atList2(void* ptr, int i);
 void QBoxSet___append_values_setList2(void* ptr, double i);
 void* QBoxSet___append_values_newList2(void* ptr);
+void* QBoxSet___append_values_newListBuffer2(void* ptr, void* data, int count);
+void QBoxSet___append_values_fillList2(void* ptr, void* data);
 void* QCandlestickLegendMarker_Series(void* ptr);
 void* QCandlestickLegendMarker_SeriesDefault(void* ptr);
 void QCandlestickLegendMarker_DestroyQCandlestickLegendMarker(void* ptr);
@@ -1677,18 +1681,28 @@ int QXYSeries_Count(void* ptr);
 void* QXYSeries___append_points_atList3(void* ptr, int i);
 void QXYSeries___append_points_setList3(void* ptr, void* i);
 void* QXYSeries___append_points_newList3(void* ptr);
+void* QXYSeries___append_points_newListBuffer3(void* ptr, void* data, int count);
+void QXYSeries___append_points_fillList3(void* ptr, void* data);
 void* QXYSeries___replace_points_atList5(void* ptr, int i);
 void QXYSeries___replace_points_setList5(void* ptr, void* i);
 void* QXYSeries___replace_points_newList5(void* ptr);
+void* QXYSeries___replace_points_newListBuffer5(void* ptr, void* data, int count);
+void QXYSeries___replace_points_fillList5(void* ptr, void* data);
 void* QXYSeries___replace_points_atList6(void* ptr, int i);
 void QXYSeries___replace_points_setList6(void* ptr, void* i);
 void* QXYSeries___replace_points_newList6(void* ptr);
+void* QXYSeries___replace_points_newListBuffer6(void* ptr, void* data, int count);
+void QXYSeries___replace_points_fillList6(void* ptr, void* data);
 void* QXYSeries___points_atList(void* ptr, int i);
 void QXYSeries___points_setList(void* ptr, void* i);
 void* QXYSeries___points_newList(void* ptr);
+void* QXYSeries___points_newListBuffer(void* ptr, void* data, int count);
+void QXYSeries___points_fillList(void* ptr, void* data);
 void* QXYSeries___pointsVector_atList(void* ptr, int i);
 void QXYSeries___pointsVector_setList(void* ptr, void* i);
 void* QXYSeries___pointsVector_newList(void* ptr);
+void* QXYSeries___pointsVector_newListBuffer(void* ptr, void* data, int count);
+void QXYSeries___pointsVector_fillList(void* ptr, void* data);
 
 #ifdef __cplusplus
 }
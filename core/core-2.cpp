@@ -0,0 +1,11406 @@
+// +build !minimal
+
+#define protected public
+#define private public
+
+#include "core.h"
+#include "_cgo_export.h"
+
+#include <QAbstractAnimation>
+#include <QAbstractEventDispatcher>
+#include <QAbstractItemModel>
+#include <QAbstractListModel>
+#include <QAbstractProxyModel>
+#include <QAbstractState>
+#include <QAbstractTableModel>
+#include <QAbstractTransition>
+#include <QAnimationGroup>
+#include <QBitArray>
+#include <QBuffer>
+#include <QByteArray>
+#include <QChar>
+#include <QChildEvent>
+#include <QColor>
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QDate>
+#include <QDateTime>
+#include <QDir>
+#include <QEasingCurve>
+#include <QEvent>
+#include <QEventLoop>
+#include <QEventTransition>
+#include <QFile>
+#include <QFileDevice>
+#include <QFileSelector>
+#include <QFileSystemWatcher>
+#include <QFinalState>
+#include <QFont>
+#include <QHash>
+#include <QHistoryState>
+#include <QIODevice>
+#include <QIdentityProxyModel>
+#include <QImage>
+#include <QItemSelection>
+#include <QItemSelectionModel>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QLatin1String>
+#include <QLibrary>
+#include <QLine>
+#include <QLineF>
+#include <QList>
+#include <QLocale>
+#include <QMap>
+#include <QMargins>
+#include <QMarginsF>
+#include <QMetaMethod>
+#include <QMetaObject>
+#include <QMimeData>
+#include <QModelIndex>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QObject>
+#include <QObjectCleanupHandler>
+#include <QParallelAnimationGroup>
+#include <QPauseAnimation>
+#include <QPersistentModelIndex>
+#include <QPluginLoader>
+#include <QPoint>
+#include <QPointF>
+#include <QPropertyAnimation>
+#include <QReadLocker>
+#include <QReadWriteLock>
+#include <QRect>
+#include <QRectF>
+#include <QRegExp>
+#include <QRegularExpression>
+#include <QRegularExpressionMatch>
+#include <QRegularExpressionMatchIterator>
+#include <QResource>
+#include <QRunnable>
+#include <QSaveFile>
+#include <QSemaphore>
+#include <QSequentialAnimationGroup>
+#include <QSequentialIterable>
+#include <QSet>
+#include <QSettings>
+#include <QSharedData>
+#include <QSharedMemory>
+#include <QSignalBlocker>
+#include <QSignalMapper>
+#include <QSignalTransition>
+#include <QSize>
+#include <QSizeF>
+#include <QSocketNotifier>
+#include <QSortFilterProxyModel>
+#include <QStandardPaths>
+#include <QState>
+#include <QStateMachine>
+#include <QStaticPlugin>
+#include <QStorageInfo>
+#include <QString>
+#include <QStringList>
+#include <QStringListModel>
+#include <QStringMatcher>
+#include <QStringRef>
+#include <QSysInfo>
+#include <QSystemSemaphore>
+#include <QTemporaryDir>
+#include <QTemporaryFile>
+#include <QTextBoundaryFinder>
+#include <QTextCodec>
+#include <QTextDecoder>
+#include <QTextEncoder>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+#include <QTime>
+#include <QTimeLine>
+#include <QTimeZone>
+#include <QTimer>
+#include <QTimerEvent>
+#include <QTranslator>
+#include <QUnhandledException>
+#include <QUrl>
+#include <QUrlQuery>
+#include <QUuid>
+#include <QVariant>
+#include <QVariantAnimation>
+#include <QVector>
+#include <QVersionNumber>
+#include <QWaitCondition>
+#include <QWidget>
+#include <QWriteLocker>
+#include <QXmlStreamAttribute>
+#include <QXmlStreamAttributes>
+#include <QXmlStreamEntityDeclaration>
+#include <QXmlStreamEntityResolver>
+#include <QXmlStreamNamespaceDeclaration>
+#include <QXmlStreamNotationDeclaration>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+#include <QTextDocument>
+#include "utils-core.h"
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+char QMutex_TryLock(void* ptr, int timeout)
+{
+	return static_cast<QMutex*>(ptr)->tryLock(timeout);
+}
+
+void QMutex_Lock(void* ptr)
+{
+	static_cast<QMutex*>(ptr)->lock();
+}
+
+void* QMutex_NewQMutex(long long mode)
+{
+	return new QMutex(static_cast<QMutex::RecursionMode>(mode));
+}
+
+void* QMutex_NewQMutexInArena(void* arena, long long mode)
+{
+	return new (goArenaAlloc<QMutex>(arena)) QMutex(static_cast<QMutex::RecursionMode>(mode));
+}
+
+char QMutex_Try_lock(void* ptr)
+{
+	return static_cast<QMutex*>(ptr)->try_lock();
+}
+
+void QMutex_Unlock(void* ptr)
+{
+	static_cast<QMutex*>(ptr)->unlock();
+}
+
+char QMutex_IsRecursive(void* ptr)
+{
+	return static_cast<QMutex*>(ptr)->isRecursive();
+}
+
+void* QMutexLocker_NewQMutexLocker(void* mutex)
+{
+	return new QMutexLocker(static_cast<QMutex*>(mutex));
+}
+
+void* QMutexLocker_NewQMutexLockerInArena(void* arena, void* mutex)
+{
+	return new (goArenaAlloc<QMutexLocker>(arena)) QMutexLocker(static_cast<QMutex*>(mutex));
+}
+
+void QMutexLocker_Relock(void* ptr)
+{
+	static_cast<QMutexLocker*>(ptr)->relock();
+}
+
+void QMutexLocker_Unlock(void* ptr)
+{
+	static_cast<QMutexLocker*>(ptr)->unlock();
+}
+
+void QMutexLocker_DestroyQMutexLocker(void* ptr)
+{
+	static_cast<QMutexLocker*>(ptr)->~QMutexLocker();
+}
+
+void* QMutexLocker_Mutex(void* ptr)
+{
+	return static_cast<QMutexLocker*>(ptr)->mutex();
+}
+
+class MyQObject: public QObject
+{
+public:
+	MyQObject(QObject *parent) : QObject(parent) {};
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	 ~MyQObject() { callbackQObject_DestroyQObject(this); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QObject_NewQObject(void* parent)
+{
+	return new MyQObject(static_cast<QObject*>(parent));
+}
+
+struct QtCore_PackedString QObject_QObject_Tr(char* sourceText, char* disambiguation, int n)
+{
+	return ({ QByteArray te5b32b = QObject::tr(const_cast<const char*>(sourceText), const_cast<const char*>(disambiguation), n).toUtf8(); QtCore_PackedString { const_cast<char*>(te5b32b.prepend("WHITESPACE").constData()+10), te5b32b.size()-10 }; });
+}
+
+char QObject_BlockSignals(void* ptr, char block)
+{
+	return static_cast<QObject*>(ptr)->blockSignals(block != 0);
+}
+
+char QObject_QObject_Disconnect2(void* sender, void* sign, void* receiver, void* method)
+{
+	return QObject::disconnect(static_cast<QObject*>(sender), *static_cast<QMetaMethod*>(sign), static_cast<QObject*>(receiver), *static_cast<QMetaMethod*>(method));
+}
+
+char QObject_QObject_Disconnect(void* sender, char* sign, void* receiver, char* method)
+{
+	return QObject::disconnect(static_cast<QObject*>(sender), const_cast<const char*>(sign), static_cast<QObject*>(receiver), const_cast<const char*>(method));
+}
+
+char QObject_Event(void* ptr, void* e)
+{
+	return static_cast<QObject*>(ptr)->event(static_cast<QEvent*>(e));
+}
+
+char QObject_EventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QTimeLine*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTimeLine*>(ptr)->QTimeLine::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QThreadPool*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QThreadPool*>(ptr)->QThreadPool::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QThread*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QThread*>(ptr)->QThread::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QSignalTransition*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSignalTransition*>(ptr)->QSignalTransition::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QEventTransition*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QEventTransition*>(ptr)->QEventTransition::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QAbstractTransition*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractTransition*>(ptr)->QAbstractTransition::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStateMachine*>(ptr)->QStateMachine::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QState*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QState*>(ptr)->QState::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QHistoryState*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHistoryState*>(ptr)->QHistoryState::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QFinalState*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFinalState*>(ptr)->QFinalState::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QAbstractState*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractState*>(ptr)->QAbstractState::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QPluginLoader*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPluginLoader*>(ptr)->QPluginLoader::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QLibrary*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLibrary*>(ptr)->QLibrary::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QTranslator*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTranslator*>(ptr)->QTranslator::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QTimer*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTimer*>(ptr)->QTimer::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QSocketNotifier*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QSignalMapper*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSignalMapper*>(ptr)->QSignalMapper::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QSharedMemory*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSharedMemory*>(ptr)->QSharedMemory::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QObjectCleanupHandler*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QObjectCleanupHandler*>(ptr)->QObjectCleanupHandler::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QMimeData*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QMimeData*>(ptr)->QMimeData::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QEventLoop*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QEventLoop*>(ptr)->QEventLoop::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QCoreApplication*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QCoreApplication*>(ptr)->QCoreApplication::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QAbstractEventDispatcher*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractEventDispatcher*>(ptr)->QAbstractEventDispatcher::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QItemSelectionModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QItemSelectionModel*>(ptr)->QItemSelectionModel::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QSortFilterProxyModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QIdentityProxyModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QIdentityProxyModel*>(ptr)->QIdentityProxyModel::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QAbstractProxyModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractProxyModel*>(ptr)->QAbstractProxyModel::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QAbstractTableModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractTableModel*>(ptr)->QAbstractTableModel::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QStringListModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStringListModel*>(ptr)->QStringListModel::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QAbstractListModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractListModel*>(ptr)->QAbstractListModel::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QAbstractItemModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractItemModel*>(ptr)->QAbstractItemModel::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QSettings*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSettings*>(ptr)->QSettings::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QSaveFile*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSaveFile*>(ptr)->QSaveFile::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QTemporaryFile*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTemporaryFile*>(ptr)->QTemporaryFile::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QFile*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFile*>(ptr)->QFile::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QFileDevice*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFileDevice*>(ptr)->QFileDevice::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QBuffer*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBuffer*>(ptr)->QBuffer::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QIODevice*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QIODevice*>(ptr)->QIODevice::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QFileSystemWatcher*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFileSystemWatcher*>(ptr)->QFileSystemWatcher::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QFileSelector*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFileSelector*>(ptr)->QFileSelector::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QVariantAnimation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QPauseAnimation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QSequentialAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QParallelAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAnimationGroup*>(ptr)->QAnimationGroup::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QAbstractAnimation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractAnimation*>(ptr)->QAbstractAnimation::event(static_cast<QEvent*>(e));
+	} else {
+		return static_cast<QObject*>(ptr)->QObject::event(static_cast<QEvent*>(e));
+	}
+}
+
+char QObject_EventFilter(void* ptr, void* watched, void* event)
+{
+	return static_cast<QObject*>(ptr)->eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+}
+
+char QObject_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QTimeLine*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTimeLine*>(ptr)->QTimeLine::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QThreadPool*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QThreadPool*>(ptr)->QThreadPool::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QThread*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QThread*>(ptr)->QThread::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSignalTransition*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSignalTransition*>(ptr)->QSignalTransition::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QEventTransition*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QEventTransition*>(ptr)->QEventTransition::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractTransition*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractTransition*>(ptr)->QAbstractTransition::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStateMachine*>(ptr)->QStateMachine::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QState*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QState*>(ptr)->QState::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QHistoryState*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHistoryState*>(ptr)->QHistoryState::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFinalState*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFinalState*>(ptr)->QFinalState::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractState*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractState*>(ptr)->QAbstractState::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPluginLoader*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPluginLoader*>(ptr)->QPluginLoader::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLibrary*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLibrary*>(ptr)->QLibrary::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTranslator*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTranslator*>(ptr)->QTranslator::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTimer*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTimer*>(ptr)->QTimer::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSocketNotifier*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSignalMapper*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSignalMapper*>(ptr)->QSignalMapper::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSharedMemory*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSharedMemory*>(ptr)->QSharedMemory::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QObjectCleanupHandler*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QObjectCleanupHandler*>(ptr)->QObjectCleanupHandler::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QMimeData*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QMimeData*>(ptr)->QMimeData::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QEventLoop*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QEventLoop*>(ptr)->QEventLoop::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QCoreApplication*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QCoreApplication*>(ptr)->QCoreApplication::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractEventDispatcher*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractEventDispatcher*>(ptr)->QAbstractEventDispatcher::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QItemSelectionModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QItemSelectionModel*>(ptr)->QItemSelectionModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSortFilterProxyModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QIdentityProxyModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QIdentityProxyModel*>(ptr)->QIdentityProxyModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractProxyModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractProxyModel*>(ptr)->QAbstractProxyModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractTableModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractTableModel*>(ptr)->QAbstractTableModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QStringListModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStringListModel*>(ptr)->QStringListModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractListModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractListModel*>(ptr)->QAbstractListModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractItemModel*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractItemModel*>(ptr)->QAbstractItemModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSettings*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSettings*>(ptr)->QSettings::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSaveFile*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSaveFile*>(ptr)->QSaveFile::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTemporaryFile*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTemporaryFile*>(ptr)->QTemporaryFile::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFile*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFile*>(ptr)->QFile::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFileDevice*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFileDevice*>(ptr)->QFileDevice::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QBuffer*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBuffer*>(ptr)->QBuffer::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QIODevice*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QIODevice*>(ptr)->QIODevice::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFileSystemWatcher*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFileSystemWatcher*>(ptr)->QFileSystemWatcher::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFileSelector*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFileSelector*>(ptr)->QFileSelector::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QVariantAnimation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPauseAnimation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSequentialAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QParallelAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAnimationGroup*>(ptr)->QAnimationGroup::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractAnimation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractAnimation*>(ptr)->QAbstractAnimation::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QObject*>(ptr)->QObject::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+char QObject_SetProperty(void* ptr, char* name, void* value)
+{
+	return static_cast<QObject*>(ptr)->setProperty(const_cast<const char*>(name), *static_cast<QVariant*>(value));
+}
+
+int QObject_StartTimer(void* ptr, int interval, long long timerType)
+{
+	return static_cast<QObject*>(ptr)->startTimer(interval, static_cast<Qt::TimerType>(timerType));
+}
+
+void QObject_ChildEvent(void* ptr, void* event)
+{
+	static_cast<QObject*>(ptr)->childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QObject_ChildEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QTimeLine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimeLine*>(ptr)->QTimeLine::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QThreadPool*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThreadPool*>(ptr)->QThreadPool::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QThread*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThread*>(ptr)->QThread::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QSignalTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalTransition*>(ptr)->QSignalTransition::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QEventTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventTransition*>(ptr)->QEventTransition::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QAbstractTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTransition*>(ptr)->QAbstractTransition::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStateMachine*>(ptr)->QStateMachine::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QState*>(ptr)->QState::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QHistoryState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHistoryState*>(ptr)->QHistoryState::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QFinalState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFinalState*>(ptr)->QFinalState::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QAbstractState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractState*>(ptr)->QAbstractState::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QPluginLoader*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPluginLoader*>(ptr)->QPluginLoader::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QLibrary*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLibrary*>(ptr)->QLibrary::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QTranslator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTranslator*>(ptr)->QTranslator::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QTimer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimer*>(ptr)->QTimer::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QSocketNotifier*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QSignalMapper*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalMapper*>(ptr)->QSignalMapper::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QSharedMemory*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSharedMemory*>(ptr)->QSharedMemory::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QObjectCleanupHandler*>(static_cast<QObject*>(ptr))) {
+		static_cast<QObjectCleanupHandler*>(ptr)->QObjectCleanupHandler::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QMimeData*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMimeData*>(ptr)->QMimeData::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QEventLoop*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventLoop*>(ptr)->QEventLoop::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QCoreApplication*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCoreApplication*>(ptr)->QCoreApplication::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QAbstractEventDispatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractEventDispatcher*>(ptr)->QAbstractEventDispatcher::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QItemSelectionModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QItemSelectionModel*>(ptr)->QItemSelectionModel::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QSortFilterProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QIdentityProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIdentityProxyModel*>(ptr)->QIdentityProxyModel::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QAbstractProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractProxyModel*>(ptr)->QAbstractProxyModel::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QAbstractTableModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTableModel*>(ptr)->QAbstractTableModel::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QStringListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStringListModel*>(ptr)->QStringListModel::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QAbstractListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractListModel*>(ptr)->QAbstractListModel::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QAbstractItemModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractItemModel*>(ptr)->QAbstractItemModel::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QSettings*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSettings*>(ptr)->QSettings::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QSaveFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSaveFile*>(ptr)->QSaveFile::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QTemporaryFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTemporaryFile*>(ptr)->QTemporaryFile::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFile*>(ptr)->QFile::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QFileDevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDevice*>(ptr)->QFileDevice::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QBuffer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBuffer*>(ptr)->QBuffer::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QIODevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIODevice*>(ptr)->QIODevice::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QFileSystemWatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSystemWatcher*>(ptr)->QFileSystemWatcher::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QFileSelector*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSelector*>(ptr)->QFileSelector::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QVariantAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QPauseAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QSequentialAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QParallelAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAnimationGroup*>(ptr)->QAnimationGroup::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QAbstractAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractAnimation*>(ptr)->QAbstractAnimation::childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QObject*>(ptr)->QObject::childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QObject_ConnectNotify(void* ptr, void* sign)
+{
+	static_cast<QObject*>(ptr)->connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QObject_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QTimeLine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimeLine*>(ptr)->QTimeLine::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QThreadPool*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThreadPool*>(ptr)->QThreadPool::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QThread*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThread*>(ptr)->QThread::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSignalTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalTransition*>(ptr)->QSignalTransition::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QEventTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventTransition*>(ptr)->QEventTransition::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTransition*>(ptr)->QAbstractTransition::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStateMachine*>(ptr)->QStateMachine::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QState*>(ptr)->QState::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QHistoryState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHistoryState*>(ptr)->QHistoryState::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFinalState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFinalState*>(ptr)->QFinalState::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractState*>(ptr)->QAbstractState::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPluginLoader*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPluginLoader*>(ptr)->QPluginLoader::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QLibrary*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLibrary*>(ptr)->QLibrary::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTranslator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTranslator*>(ptr)->QTranslator::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTimer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimer*>(ptr)->QTimer::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSocketNotifier*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSignalMapper*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalMapper*>(ptr)->QSignalMapper::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSharedMemory*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSharedMemory*>(ptr)->QSharedMemory::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QObjectCleanupHandler*>(static_cast<QObject*>(ptr))) {
+		static_cast<QObjectCleanupHandler*>(ptr)->QObjectCleanupHandler::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QMimeData*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMimeData*>(ptr)->QMimeData::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QEventLoop*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventLoop*>(ptr)->QEventLoop::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QCoreApplication*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCoreApplication*>(ptr)->QCoreApplication::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractEventDispatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractEventDispatcher*>(ptr)->QAbstractEventDispatcher::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QItemSelectionModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QItemSelectionModel*>(ptr)->QItemSelectionModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSortFilterProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QIdentityProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIdentityProxyModel*>(ptr)->QIdentityProxyModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractProxyModel*>(ptr)->QAbstractProxyModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractTableModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTableModel*>(ptr)->QAbstractTableModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QStringListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStringListModel*>(ptr)->QStringListModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractListModel*>(ptr)->QAbstractListModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractItemModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractItemModel*>(ptr)->QAbstractItemModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSettings*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSettings*>(ptr)->QSettings::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSaveFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSaveFile*>(ptr)->QSaveFile::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTemporaryFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTemporaryFile*>(ptr)->QTemporaryFile::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFile*>(ptr)->QFile::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFileDevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDevice*>(ptr)->QFileDevice::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QBuffer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBuffer*>(ptr)->QBuffer::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QIODevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIODevice*>(ptr)->QIODevice::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFileSystemWatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSystemWatcher*>(ptr)->QFileSystemWatcher::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFileSelector*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSelector*>(ptr)->QFileSelector::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QVariantAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPauseAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSequentialAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QParallelAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAnimationGroup*>(ptr)->QAnimationGroup::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractAnimation*>(ptr)->QAbstractAnimation::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QObject*>(ptr)->QObject::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QObject_CustomEvent(void* ptr, void* event)
+{
+	static_cast<QObject*>(ptr)->customEvent(static_cast<QEvent*>(event));
+}
+
+void QObject_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QTimeLine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimeLine*>(ptr)->QTimeLine::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QThreadPool*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThreadPool*>(ptr)->QThreadPool::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QThread*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThread*>(ptr)->QThread::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSignalTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalTransition*>(ptr)->QSignalTransition::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QEventTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventTransition*>(ptr)->QEventTransition::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTransition*>(ptr)->QAbstractTransition::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStateMachine*>(ptr)->QStateMachine::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QState*>(ptr)->QState::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QHistoryState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHistoryState*>(ptr)->QHistoryState::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFinalState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFinalState*>(ptr)->QFinalState::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractState*>(ptr)->QAbstractState::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPluginLoader*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPluginLoader*>(ptr)->QPluginLoader::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLibrary*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLibrary*>(ptr)->QLibrary::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTranslator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTranslator*>(ptr)->QTranslator::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTimer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimer*>(ptr)->QTimer::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSocketNotifier*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSignalMapper*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalMapper*>(ptr)->QSignalMapper::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSharedMemory*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSharedMemory*>(ptr)->QSharedMemory::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QObjectCleanupHandler*>(static_cast<QObject*>(ptr))) {
+		static_cast<QObjectCleanupHandler*>(ptr)->QObjectCleanupHandler::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QMimeData*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMimeData*>(ptr)->QMimeData::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QEventLoop*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventLoop*>(ptr)->QEventLoop::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QCoreApplication*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCoreApplication*>(ptr)->QCoreApplication::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractEventDispatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractEventDispatcher*>(ptr)->QAbstractEventDispatcher::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QItemSelectionModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QItemSelectionModel*>(ptr)->QItemSelectionModel::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSortFilterProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QIdentityProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIdentityProxyModel*>(ptr)->QIdentityProxyModel::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractProxyModel*>(ptr)->QAbstractProxyModel::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractTableModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTableModel*>(ptr)->QAbstractTableModel::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QStringListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStringListModel*>(ptr)->QStringListModel::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractListModel*>(ptr)->QAbstractListModel::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractItemModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractItemModel*>(ptr)->QAbstractItemModel::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSettings*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSettings*>(ptr)->QSettings::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSaveFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSaveFile*>(ptr)->QSaveFile::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTemporaryFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTemporaryFile*>(ptr)->QTemporaryFile::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFile*>(ptr)->QFile::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFileDevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDevice*>(ptr)->QFileDevice::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QBuffer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBuffer*>(ptr)->QBuffer::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QIODevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIODevice*>(ptr)->QIODevice::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFileSystemWatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSystemWatcher*>(ptr)->QFileSystemWatcher::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFileSelector*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSelector*>(ptr)->QFileSelector::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QVariantAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPauseAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSequentialAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QParallelAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAnimationGroup*>(ptr)->QAnimationGroup::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractAnimation*>(ptr)->QAbstractAnimation::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QObject*>(ptr)->QObject::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QObject_DeleteLater(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QObject*>(ptr), "deleteLater");
+}
+
+void QObject_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QTimeLine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimeLine*>(ptr)->QTimeLine::deleteLater();
+	} else if (dynamic_cast<QThreadPool*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThreadPool*>(ptr)->QThreadPool::deleteLater();
+	} else if (dynamic_cast<QThread*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThread*>(ptr)->QThread::deleteLater();
+	} else if (dynamic_cast<QSignalTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalTransition*>(ptr)->QSignalTransition::deleteLater();
+	} else if (dynamic_cast<QEventTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventTransition*>(ptr)->QEventTransition::deleteLater();
+	} else if (dynamic_cast<QAbstractTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTransition*>(ptr)->QAbstractTransition::deleteLater();
+	} else if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStateMachine*>(ptr)->QStateMachine::deleteLater();
+	} else if (dynamic_cast<QState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QState*>(ptr)->QState::deleteLater();
+	} else if (dynamic_cast<QHistoryState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHistoryState*>(ptr)->QHistoryState::deleteLater();
+	} else if (dynamic_cast<QFinalState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFinalState*>(ptr)->QFinalState::deleteLater();
+	} else if (dynamic_cast<QAbstractState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractState*>(ptr)->QAbstractState::deleteLater();
+	} else if (dynamic_cast<QPluginLoader*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPluginLoader*>(ptr)->QPluginLoader::deleteLater();
+	} else if (dynamic_cast<QLibrary*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLibrary*>(ptr)->QLibrary::deleteLater();
+	} else if (dynamic_cast<QTranslator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTranslator*>(ptr)->QTranslator::deleteLater();
+	} else if (dynamic_cast<QTimer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimer*>(ptr)->QTimer::deleteLater();
+	} else if (dynamic_cast<QSocketNotifier*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::deleteLater();
+	} else if (dynamic_cast<QSignalMapper*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalMapper*>(ptr)->QSignalMapper::deleteLater();
+	} else if (dynamic_cast<QSharedMemory*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSharedMemory*>(ptr)->QSharedMemory::deleteLater();
+	} else if (dynamic_cast<QObjectCleanupHandler*>(static_cast<QObject*>(ptr))) {
+		static_cast<QObjectCleanupHandler*>(ptr)->QObjectCleanupHandler::deleteLater();
+	} else if (dynamic_cast<QMimeData*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMimeData*>(ptr)->QMimeData::deleteLater();
+	} else if (dynamic_cast<QEventLoop*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventLoop*>(ptr)->QEventLoop::deleteLater();
+	} else if (dynamic_cast<QCoreApplication*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCoreApplication*>(ptr)->QCoreApplication::deleteLater();
+	} else if (dynamic_cast<QAbstractEventDispatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractEventDispatcher*>(ptr)->QAbstractEventDispatcher::deleteLater();
+	} else if (dynamic_cast<QItemSelectionModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QItemSelectionModel*>(ptr)->QItemSelectionModel::deleteLater();
+	} else if (dynamic_cast<QSortFilterProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::deleteLater();
+	} else if (dynamic_cast<QIdentityProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIdentityProxyModel*>(ptr)->QIdentityProxyModel::deleteLater();
+	} else if (dynamic_cast<QAbstractProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractProxyModel*>(ptr)->QAbstractProxyModel::deleteLater();
+	} else if (dynamic_cast<QAbstractTableModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTableModel*>(ptr)->QAbstractTableModel::deleteLater();
+	} else if (dynamic_cast<QStringListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStringListModel*>(ptr)->QStringListModel::deleteLater();
+	} else if (dynamic_cast<QAbstractListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractListModel*>(ptr)->QAbstractListModel::deleteLater();
+	} else if (dynamic_cast<QAbstractItemModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractItemModel*>(ptr)->QAbstractItemModel::deleteLater();
+	} else if (dynamic_cast<QSettings*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSettings*>(ptr)->QSettings::deleteLater();
+	} else if (dynamic_cast<QSaveFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSaveFile*>(ptr)->QSaveFile::deleteLater();
+	} else if (dynamic_cast<QTemporaryFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTemporaryFile*>(ptr)->QTemporaryFile::deleteLater();
+	} else if (dynamic_cast<QFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFile*>(ptr)->QFile::deleteLater();
+	} else if (dynamic_cast<QFileDevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDevice*>(ptr)->QFileDevice::deleteLater();
+	} else if (dynamic_cast<QBuffer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBuffer*>(ptr)->QBuffer::deleteLater();
+	} else if (dynamic_cast<QIODevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIODevice*>(ptr)->QIODevice::deleteLater();
+	} else if (dynamic_cast<QFileSystemWatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSystemWatcher*>(ptr)->QFileSystemWatcher::deleteLater();
+	} else if (dynamic_cast<QFileSelector*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSelector*>(ptr)->QFileSelector::deleteLater();
+	} else if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::deleteLater();
+	} else if (dynamic_cast<QVariantAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::deleteLater();
+	} else if (dynamic_cast<QPauseAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::deleteLater();
+	} else if (dynamic_cast<QSequentialAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::deleteLater();
+	} else if (dynamic_cast<QParallelAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::deleteLater();
+	} else if (dynamic_cast<QAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAnimationGroup*>(ptr)->QAnimationGroup::deleteLater();
+	} else if (dynamic_cast<QAbstractAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractAnimation*>(ptr)->QAbstractAnimation::deleteLater();
+	} else {
+		static_cast<QObject*>(ptr)->QObject::deleteLater();
+	}
+}
+
+void QObject_ConnectDestroyed(void* ptr)
+{
+	QObject::connect(static_cast<QObject*>(ptr), static_cast<void (QObject::*)(QObject *)>(&QObject::destroyed), static_cast<MyQObject*>(ptr), static_cast<void (MyQObject::*)(QObject *)>(&MyQObject::Signal_Destroyed));
+}
+
+void QObject_DisconnectDestroyed(void* ptr)
+{
+	QObject::disconnect(static_cast<QObject*>(ptr), static_cast<void (QObject::*)(QObject *)>(&QObject::destroyed), static_cast<MyQObject*>(ptr), static_cast<void (MyQObject::*)(QObject *)>(&MyQObject::Signal_Destroyed));
+}
+
+void QObject_Destroyed(void* ptr, void* obj)
+{
+	static_cast<QObject*>(ptr)->destroyed(static_cast<QObject*>(obj));
+}
+
+void QObject_DisconnectNotify(void* ptr, void* sign)
+{
+	static_cast<QObject*>(ptr)->disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QObject_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QTimeLine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimeLine*>(ptr)->QTimeLine::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QThreadPool*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThreadPool*>(ptr)->QThreadPool::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QThread*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThread*>(ptr)->QThread::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSignalTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalTransition*>(ptr)->QSignalTransition::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QEventTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventTransition*>(ptr)->QEventTransition::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTransition*>(ptr)->QAbstractTransition::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStateMachine*>(ptr)->QStateMachine::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QState*>(ptr)->QState::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QHistoryState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHistoryState*>(ptr)->QHistoryState::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFinalState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFinalState*>(ptr)->QFinalState::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractState*>(ptr)->QAbstractState::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPluginLoader*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPluginLoader*>(ptr)->QPluginLoader::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QLibrary*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLibrary*>(ptr)->QLibrary::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTranslator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTranslator*>(ptr)->QTranslator::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTimer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimer*>(ptr)->QTimer::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSocketNotifier*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSignalMapper*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalMapper*>(ptr)->QSignalMapper::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSharedMemory*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSharedMemory*>(ptr)->QSharedMemory::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QObjectCleanupHandler*>(static_cast<QObject*>(ptr))) {
+		static_cast<QObjectCleanupHandler*>(ptr)->QObjectCleanupHandler::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QMimeData*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMimeData*>(ptr)->QMimeData::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QEventLoop*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventLoop*>(ptr)->QEventLoop::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QCoreApplication*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCoreApplication*>(ptr)->QCoreApplication::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractEventDispatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractEventDispatcher*>(ptr)->QAbstractEventDispatcher::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QItemSelectionModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QItemSelectionModel*>(ptr)->QItemSelectionModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSortFilterProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QIdentityProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIdentityProxyModel*>(ptr)->QIdentityProxyModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractProxyModel*>(ptr)->QAbstractProxyModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractTableModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTableModel*>(ptr)->QAbstractTableModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QStringListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStringListModel*>(ptr)->QStringListModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractListModel*>(ptr)->QAbstractListModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractItemModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractItemModel*>(ptr)->QAbstractItemModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSettings*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSettings*>(ptr)->QSettings::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSaveFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSaveFile*>(ptr)->QSaveFile::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTemporaryFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTemporaryFile*>(ptr)->QTemporaryFile::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFile*>(ptr)->QFile::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFileDevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDevice*>(ptr)->QFileDevice::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QBuffer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBuffer*>(ptr)->QBuffer::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QIODevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIODevice*>(ptr)->QIODevice::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFileSystemWatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSystemWatcher*>(ptr)->QFileSystemWatcher::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFileSelector*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSelector*>(ptr)->QFileSelector::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QVariantAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPauseAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSequentialAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QParallelAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAnimationGroup*>(ptr)->QAnimationGroup::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QAbstractAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractAnimation*>(ptr)->QAbstractAnimation::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QObject*>(ptr)->QObject::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QObject_DumpObjectInfo(void* ptr)
+{
+	static_cast<QObject*>(ptr)->dumpObjectInfo();
+}
+
+void QObject_DumpObjectTree(void* ptr)
+{
+	static_cast<QObject*>(ptr)->dumpObjectTree();
+}
+
+void QObject_InstallEventFilter(void* ptr, void* filterObj)
+{
+	static_cast<QObject*>(ptr)->installEventFilter(static_cast<QObject*>(filterObj));
+}
+
+void QObject_KillTimer(void* ptr, int id)
+{
+	static_cast<QObject*>(ptr)->killTimer(id);
+}
+
+void QObject_MoveToThread(void* ptr, void* targetThread)
+{
+	static_cast<QObject*>(ptr)->moveToThread(static_cast<QThread*>(targetThread));
+}
+
+void QObject_ConnectObjectNameChanged(void* ptr)
+{
+	QObject::connect(static_cast<QObject*>(ptr), &QObject::objectNameChanged, static_cast<MyQObject*>(ptr), static_cast<void (MyQObject::*)(const QString &)>(&MyQObject::Signal_ObjectNameChanged));
+}
+
+void QObject_DisconnectObjectNameChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QObject*>(ptr), &QObject::objectNameChanged, static_cast<MyQObject*>(ptr), static_cast<void (MyQObject::*)(const QString &)>(&MyQObject::Signal_ObjectNameChanged));
+}
+
+void QObject_RemoveEventFilter(void* ptr, void* obj)
+{
+	static_cast<QObject*>(ptr)->removeEventFilter(static_cast<QObject*>(obj));
+}
+
+void QObject_SetObjectName(void* ptr, char* name)
+{
+	static_cast<QObject*>(ptr)->setObjectName(QString(name));
+}
+
+void QObject_SetParent(void* ptr, void* parent)
+{
+	static_cast<QObject*>(ptr)->setParent(static_cast<QObject*>(parent));
+}
+
+void QObject_TimerEvent(void* ptr, void* event)
+{
+	static_cast<QObject*>(ptr)->timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void QObject_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QTimeLine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimeLine*>(ptr)->QTimeLine::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QThreadPool*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThreadPool*>(ptr)->QThreadPool::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QThread*>(static_cast<QObject*>(ptr))) {
+		static_cast<QThread*>(ptr)->QThread::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QSignalTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalTransition*>(ptr)->QSignalTransition::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QEventTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventTransition*>(ptr)->QEventTransition::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QAbstractTransition*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTransition*>(ptr)->QAbstractTransition::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStateMachine*>(ptr)->QStateMachine::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QState*>(ptr)->QState::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QHistoryState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHistoryState*>(ptr)->QHistoryState::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QFinalState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFinalState*>(ptr)->QFinalState::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QAbstractState*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractState*>(ptr)->QAbstractState::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QPluginLoader*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPluginLoader*>(ptr)->QPluginLoader::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QLibrary*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLibrary*>(ptr)->QLibrary::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QTranslator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTranslator*>(ptr)->QTranslator::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QTimer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTimer*>(ptr)->QTimer::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QSocketNotifier*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QSignalMapper*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSignalMapper*>(ptr)->QSignalMapper::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QSharedMemory*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSharedMemory*>(ptr)->QSharedMemory::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QObjectCleanupHandler*>(static_cast<QObject*>(ptr))) {
+		static_cast<QObjectCleanupHandler*>(ptr)->QObjectCleanupHandler::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QMimeData*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMimeData*>(ptr)->QMimeData::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QEventLoop*>(static_cast<QObject*>(ptr))) {
+		static_cast<QEventLoop*>(ptr)->QEventLoop::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QCoreApplication*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCoreApplication*>(ptr)->QCoreApplication::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QAbstractEventDispatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractEventDispatcher*>(ptr)->QAbstractEventDispatcher::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QItemSelectionModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QItemSelectionModel*>(ptr)->QItemSelectionModel::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QSortFilterProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QIdentityProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIdentityProxyModel*>(ptr)->QIdentityProxyModel::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QAbstractProxyModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractProxyModel*>(ptr)->QAbstractProxyModel::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QAbstractTableModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractTableModel*>(ptr)->QAbstractTableModel::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QStringListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStringListModel*>(ptr)->QStringListModel::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QAbstractListModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractListModel*>(ptr)->QAbstractListModel::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QAbstractItemModel*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractItemModel*>(ptr)->QAbstractItemModel::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QSettings*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSettings*>(ptr)->QSettings::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QSaveFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSaveFile*>(ptr)->QSaveFile::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QTemporaryFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTemporaryFile*>(ptr)->QTemporaryFile::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QFile*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFile*>(ptr)->QFile::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QFileDevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDevice*>(ptr)->QFileDevice::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QBuffer*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBuffer*>(ptr)->QBuffer::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QIODevice*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIODevice*>(ptr)->QIODevice::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QFileSystemWatcher*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSystemWatcher*>(ptr)->QFileSystemWatcher::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QFileSelector*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileSelector*>(ptr)->QFileSelector::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QVariantAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QPauseAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QSequentialAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QParallelAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAnimationGroup*>(ptr)->QAnimationGroup::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QAbstractAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractAnimation*>(ptr)->QAbstractAnimation::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QObject*>(ptr)->QObject::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void QObject_DestroyQObject(void* ptr)
+{
+	static_cast<QObject*>(ptr)->~QObject();
+}
+
+void QObject_DestroyQObjectDefault(void* ptr)
+{
+
+}
+
+struct QtCore_PackedString QObject_DynamicPropertyNames(void* ptr)
+{
+	return ({ long long t9188e5len; char* t9188e5 = goPackStringList(static_cast<QObject*>(ptr)->dynamicPropertyNames(), &t9188e5len); QtCore_PackedString { t9188e5, t9188e5len }; });
+}
+
+struct QtCore_PackedList QObject_FindChildren2(void* ptr, void* regExp, long long options)
+{
+	return ({ QList<QObject*>* tmpValue = new QList<QObject*>(static_cast<QObject*>(ptr)->findChildren<QObject*>(*static_cast<QRegExp*>(regExp), static_cast<Qt::FindChildOption>(options))); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtCore_PackedList QObject_FindChildren3(void* ptr, void* re, long long options)
+{
+	return ({ QList<QObject*>* tmpValue = new QList<QObject*>(static_cast<QObject*>(ptr)->findChildren<QObject*>(*static_cast<QRegularExpression*>(re), static_cast<Qt::FindChildOption>(options))); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtCore_PackedList QObject_FindChildren(void* ptr, char* name, long long options)
+{
+	return ({ QList<QObject*>* tmpValue = new QList<QObject*>(static_cast<QObject*>(ptr)->findChildren<QObject*>(QString(name), static_cast<Qt::FindChildOption>(options))); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QObject_Parent(void* ptr)
+{
+	return static_cast<QObject*>(ptr)->parent();
+}
+
+void* QObject_Sender(void* ptr)
+{
+	return static_cast<QObject*>(ptr)->sender();
+}
+
+struct QtCore_PackedString QObject_ObjectName(void* ptr)
+{
+	return ({ QByteArray te77be1 = static_cast<QObject*>(ptr)->objectName().toUtf8(); QtCore_PackedString { const_cast<char*>(te77be1.prepend("WHITESPACE").constData()+10), te77be1.size()-10 }; });
+}
+
+void* QObject_Thread(void* ptr)
+{
+	return static_cast<QObject*>(ptr)->thread();
+}
+
+void* QObject_Property(void* ptr, char* name)
+{
+	return new QVariant(static_cast<QObject*>(ptr)->property(const_cast<const char*>(name)));
+}
+
+void* QObject_FindChild(void* ptr, char* name, long long options)
+{
+	return static_cast<QObject*>(ptr)->findChild<QObject*>(QString(name), static_cast<Qt::FindChildOption>(options));
+}
+
+char QObject_Disconnect4(void* ptr, void* receiver, char* method)
+{
+	return static_cast<QObject*>(ptr)->disconnect(static_cast<QObject*>(receiver), const_cast<const char*>(method));
+}
+
+char QObject_Disconnect3(void* ptr, char* sign, void* receiver, char* method)
+{
+	return static_cast<QObject*>(ptr)->disconnect(const_cast<const char*>(sign), static_cast<QObject*>(receiver), const_cast<const char*>(method));
+}
+
+char QObject_Inherits(void* ptr, char* className)
+{
+	return static_cast<QObject*>(ptr)->inherits(const_cast<const char*>(className));
+}
+
+char QObject_IsSignalConnected(void* ptr, void* sign)
+{
+	return static_cast<QObject*>(ptr)->isSignalConnected(*static_cast<QMetaMethod*>(sign));
+}
+
+char QObject_IsWidgetType(void* ptr)
+{
+	return static_cast<QObject*>(ptr)->isWidgetType();
+}
+
+char QObject_IsWindowType(void* ptr)
+{
+	return static_cast<QObject*>(ptr)->isWindowType();
+}
+
+char QObject_SignalsBlocked(void* ptr)
+{
+	return static_cast<QObject*>(ptr)->signalsBlocked();
+}
+
+void* QObject_MetaObject(void* ptr)
+{
+	return const_cast<QMetaObject*>(static_cast<QObject*>(ptr)->metaObject());
+}
+
+void* QObject_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QTimeLine*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTimeLine*>(ptr)->QTimeLine::metaObject());
+	} else if (dynamic_cast<QThreadPool*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QThreadPool*>(ptr)->QThreadPool::metaObject());
+	} else if (dynamic_cast<QThread*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QThread*>(ptr)->QThread::metaObject());
+	} else if (dynamic_cast<QSignalTransition*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QSignalTransition*>(ptr)->QSignalTransition::metaObject());
+	} else if (dynamic_cast<QEventTransition*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QEventTransition*>(ptr)->QEventTransition::metaObject());
+	} else if (dynamic_cast<QAbstractTransition*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QAbstractTransition*>(ptr)->QAbstractTransition::metaObject());
+	} else if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QStateMachine*>(ptr)->QStateMachine::metaObject());
+	} else if (dynamic_cast<QState*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QState*>(ptr)->QState::metaObject());
+	} else if (dynamic_cast<QHistoryState*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QHistoryState*>(ptr)->QHistoryState::metaObject());
+	} else if (dynamic_cast<QFinalState*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QFinalState*>(ptr)->QFinalState::metaObject());
+	} else if (dynamic_cast<QAbstractState*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QAbstractState*>(ptr)->QAbstractState::metaObject());
+	} else if (dynamic_cast<QPluginLoader*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QPluginLoader*>(ptr)->QPluginLoader::metaObject());
+	} else if (dynamic_cast<QLibrary*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QLibrary*>(ptr)->QLibrary::metaObject());
+	} else if (dynamic_cast<QTranslator*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTranslator*>(ptr)->QTranslator::metaObject());
+	} else if (dynamic_cast<QTimer*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTimer*>(ptr)->QTimer::metaObject());
+	} else if (dynamic_cast<QSocketNotifier*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::metaObject());
+	} else if (dynamic_cast<QSignalMapper*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QSignalMapper*>(ptr)->QSignalMapper::metaObject());
+	} else if (dynamic_cast<QSharedMemory*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QSharedMemory*>(ptr)->QSharedMemory::metaObject());
+	} else if (dynamic_cast<QObjectCleanupHandler*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QObjectCleanupHandler*>(ptr)->QObjectCleanupHandler::metaObject());
+	} else if (dynamic_cast<QMimeData*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QMimeData*>(ptr)->QMimeData::metaObject());
+	} else if (dynamic_cast<QEventLoop*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QEventLoop*>(ptr)->QEventLoop::metaObject());
+	} else if (dynamic_cast<QCoreApplication*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QCoreApplication*>(ptr)->QCoreApplication::metaObject());
+	} else if (dynamic_cast<QAbstractEventDispatcher*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QAbstractEventDispatcher*>(ptr)->QAbstractEventDispatcher::metaObject());
+	} else if (dynamic_cast<QItemSelectionModel*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QItemSelectionModel*>(ptr)->QItemSelectionModel::metaObject());
+	} else if (dynamic_cast<QSortFilterProxyModel*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::metaObject());
+	} else if (dynamic_cast<QIdentityProxyModel*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QIdentityProxyModel*>(ptr)->QIdentityProxyModel::metaObject());
+	} else if (dynamic_cast<QAbstractProxyModel*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QAbstractProxyModel*>(ptr)->QAbstractProxyModel::metaObject());
+	} else if (dynamic_cast<QAbstractTableModel*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QAbstractTableModel*>(ptr)->QAbstractTableModel::metaObject());
+	} else if (dynamic_cast<QStringListModel*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QStringListModel*>(ptr)->QStringListModel::metaObject());
+	} else if (dynamic_cast<QAbstractListModel*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QAbstractListModel*>(ptr)->QAbstractListModel::metaObject());
+	} else if (dynamic_cast<QAbstractItemModel*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QAbstractItemModel*>(ptr)->QAbstractItemModel::metaObject());
+	} else if (dynamic_cast<QSettings*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QSettings*>(ptr)->QSettings::metaObject());
+	} else if (dynamic_cast<QSaveFile*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QSaveFile*>(ptr)->QSaveFile::metaObject());
+	} else if (dynamic_cast<QTemporaryFile*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTemporaryFile*>(ptr)->QTemporaryFile::metaObject());
+	} else if (dynamic_cast<QFile*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QFile*>(ptr)->QFile::metaObject());
+	} else if (dynamic_cast<QFileDevice*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QFileDevice*>(ptr)->QFileDevice::metaObject());
+	} else if (dynamic_cast<QBuffer*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QBuffer*>(ptr)->QBuffer::metaObject());
+	} else if (dynamic_cast<QIODevice*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QIODevice*>(ptr)->QIODevice::metaObject());
+	} else if (dynamic_cast<QFileSystemWatcher*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QFileSystemWatcher*>(ptr)->QFileSystemWatcher::metaObject());
+	} else if (dynamic_cast<QFileSelector*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QFileSelector*>(ptr)->QFileSelector::metaObject());
+	} else if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::metaObject());
+	} else if (dynamic_cast<QVariantAnimation*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::metaObject());
+	} else if (dynamic_cast<QPauseAnimation*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::metaObject());
+	} else if (dynamic_cast<QSequentialAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::metaObject());
+	} else if (dynamic_cast<QParallelAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::metaObject());
+	} else if (dynamic_cast<QAnimationGroup*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QAnimationGroup*>(ptr)->QAnimationGroup::metaObject());
+	} else if (dynamic_cast<QAbstractAnimation*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QAbstractAnimation*>(ptr)->QAbstractAnimation::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QObject*>(ptr)->QObject::metaObject());
+	}
+}
+
+struct QtCore_PackedList QObject_Children(void* ptr)
+{
+	return ({ QList<QObject *>* tmpValue = new QList<QObject *>(static_cast<QObject*>(ptr)->children()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+int QObject_Receivers(void* ptr, char* sign)
+{
+	return static_cast<QObject*>(ptr)->receivers(const_cast<const char*>(sign));
+}
+
+int QObject_SenderSignalIndex(void* ptr)
+{
+	return static_cast<QObject*>(ptr)->senderSignalIndex();
+}
+
+void* QObject_ToVariant(void* ptr)
+{
+	return new QVariant(QVariant::fromValue(static_cast<QObject*>(ptr)));
+}
+
+void* QObject___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QObject___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QObject___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QObject___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QObject___findChildren_setList2(void* ptr, void* i)
+{
+	static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+}
+
+void* QObject___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QObject___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QObject___findChildren_setList3(void* ptr, void* i)
+{
+	static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+}
+
+void* QObject___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QObject___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QObject___findChildren_setList(void* ptr, void* i)
+{
+	static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+}
+
+void* QObject___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QObject___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QObject___children_setList(void* ptr, void* i)
+{
+	static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+}
+
+void* QObject___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+class MyQObjectCleanupHandler: public QObjectCleanupHandler
+{
+public:
+	MyQObjectCleanupHandler() : QObjectCleanupHandler() {};
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QObjectCleanupHandler_Add(void* ptr, void* object)
+{
+	return static_cast<QObjectCleanupHandler*>(ptr)->add(static_cast<QObject*>(object));
+}
+
+void* QObjectCleanupHandler_NewQObjectCleanupHandler()
+{
+	return new MyQObjectCleanupHandler();
+}
+
+void QObjectCleanupHandler_Clear(void* ptr)
+{
+	static_cast<QObjectCleanupHandler*>(ptr)->clear();
+}
+
+void QObjectCleanupHandler_Remove(void* ptr, void* object)
+{
+	static_cast<QObjectCleanupHandler*>(ptr)->remove(static_cast<QObject*>(object));
+}
+
+void QObjectCleanupHandler_DestroyQObjectCleanupHandler(void* ptr)
+{
+	static_cast<QObjectCleanupHandler*>(ptr)->~QObjectCleanupHandler();
+}
+
+char QObjectCleanupHandler_IsEmpty(void* ptr)
+{
+	return static_cast<QObjectCleanupHandler*>(ptr)->isEmpty();
+}
+
+class MyQParallelAnimationGroup: public QParallelAnimationGroup
+{
+public:
+	MyQParallelAnimationGroup(QObject *parent) : QParallelAnimationGroup(parent) {};
+	bool event(QEvent * event) { return callbackQObject_Event(this, event) != 0; };
+	void updateCurrentTime(int currentTime) { callbackQParallelAnimationGroup_UpdateCurrentTime(this, currentTime); };
+	void updateDirection(QAbstractAnimation::Direction direction) { callbackQAbstractAnimation_UpdateDirection(this, direction); };
+	void updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_UpdateState(this, newState, oldState); };
+	int duration() const { return callbackQParallelAnimationGroup_Duration(const_cast<void*>(static_cast<const void*>(this))); };
+	void Signal_Finished() { callbackQAbstractAnimation_Finished(this); };
+	void setCurrentTime(int msecs) { callbackQAbstractAnimation_SetCurrentTime(this, msecs); };
+	void Signal_CurrentLoopChanged(int currentLoop) { callbackQAbstractAnimation_CurrentLoopChanged(this, currentLoop); };
+	void Signal_DirectionChanged(QAbstractAnimation::Direction newDirection) { callbackQAbstractAnimation_DirectionChanged(this, newDirection); };
+	void pause() { callbackQAbstractAnimation_Pause(this); };
+	void resume() { callbackQAbstractAnimation_Resume(this); };
+	void setPaused(bool paused) { callbackQAbstractAnimation_SetPaused(this, paused); };
+	void start(QAbstractAnimation::DeletionPolicy policy) { callbackQAbstractAnimation_Start(this, policy); };
+	void Signal_StateChanged(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_StateChanged(this, newState, oldState); };
+	void stop() { callbackQAbstractAnimation_Stop(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QParallelAnimationGroup_NewQParallelAnimationGroup(void* parent)
+{
+	return new MyQParallelAnimationGroup(static_cast<QObject*>(parent));
+}
+
+void QParallelAnimationGroup_UpdateCurrentTime(void* ptr, int currentTime)
+{
+	static_cast<QParallelAnimationGroup*>(ptr)->updateCurrentTime(currentTime);
+}
+
+void QParallelAnimationGroup_UpdateCurrentTimeDefault(void* ptr, int currentTime)
+{
+		static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::updateCurrentTime(currentTime);
+}
+
+void QParallelAnimationGroup_DestroyQParallelAnimationGroup(void* ptr)
+{
+	static_cast<QParallelAnimationGroup*>(ptr)->~QParallelAnimationGroup();
+}
+
+int QParallelAnimationGroup_Duration(void* ptr)
+{
+	return static_cast<QParallelAnimationGroup*>(ptr)->duration();
+}
+
+int QParallelAnimationGroup_DurationDefault(void* ptr)
+{
+		return static_cast<QParallelAnimationGroup*>(ptr)->QParallelAnimationGroup::duration();
+}
+
+class MyQPauseAnimation: public QPauseAnimation
+{
+public:
+	MyQPauseAnimation(QObject *parent) : QPauseAnimation(parent) {};
+	MyQPauseAnimation(int msecs, QObject *parent) : QPauseAnimation(msecs, parent) {};
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	void updateCurrentTime(int vin) { callbackQPauseAnimation_UpdateCurrentTime(this, vin); };
+	int duration() const { return callbackQPauseAnimation_Duration(const_cast<void*>(static_cast<const void*>(this))); };
+	void Signal_Finished() { callbackQAbstractAnimation_Finished(this); };
+	void setCurrentTime(int msecs) { callbackQAbstractAnimation_SetCurrentTime(this, msecs); };
+	void Signal_CurrentLoopChanged(int currentLoop) { callbackQAbstractAnimation_CurrentLoopChanged(this, currentLoop); };
+	void Signal_DirectionChanged(QAbstractAnimation::Direction newDirection) { callbackQAbstractAnimation_DirectionChanged(this, newDirection); };
+	void pause() { callbackQAbstractAnimation_Pause(this); };
+	void resume() { callbackQAbstractAnimation_Resume(this); };
+	void setPaused(bool paused) { callbackQAbstractAnimation_SetPaused(this, paused); };
+	void start(QAbstractAnimation::DeletionPolicy policy) { callbackQAbstractAnimation_Start(this, policy); };
+	void Signal_StateChanged(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_StateChanged(this, newState, oldState); };
+	void stop() { callbackQAbstractAnimation_Stop(this); };
+	void updateDirection(QAbstractAnimation::Direction direction) { callbackQAbstractAnimation_UpdateDirection(this, direction); };
+	void updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_UpdateState(this, newState, oldState); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QPauseAnimation_NewQPauseAnimation(void* parent)
+{
+	return new MyQPauseAnimation(static_cast<QObject*>(parent));
+}
+
+void* QPauseAnimation_NewQPauseAnimation2(int msecs, void* parent)
+{
+	return new MyQPauseAnimation(msecs, static_cast<QObject*>(parent));
+}
+
+void QPauseAnimation_SetDuration(void* ptr, int msecs)
+{
+	static_cast<QPauseAnimation*>(ptr)->setDuration(msecs);
+}
+
+void QPauseAnimation_UpdateCurrentTime(void* ptr, int vin)
+{
+	static_cast<QPauseAnimation*>(ptr)->updateCurrentTime(vin);
+}
+
+void QPauseAnimation_UpdateCurrentTimeDefault(void* ptr, int vin)
+{
+		static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::updateCurrentTime(vin);
+}
+
+void QPauseAnimation_DestroyQPauseAnimation(void* ptr)
+{
+	static_cast<QPauseAnimation*>(ptr)->~QPauseAnimation();
+}
+
+int QPauseAnimation_Duration(void* ptr)
+{
+	return static_cast<QPauseAnimation*>(ptr)->duration();
+}
+
+int QPauseAnimation_DurationDefault(void* ptr)
+{
+		return static_cast<QPauseAnimation*>(ptr)->QPauseAnimation::duration();
+}
+
+void* QPersistentModelIndex_NewQPersistentModelIndex4(void* other)
+{
+	return new QPersistentModelIndex(*static_cast<QPersistentModelIndex*>(other));
+}
+
+void* QPersistentModelIndex_NewQPersistentModelIndex4InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QPersistentModelIndex>(arena)) QPersistentModelIndex(*static_cast<QPersistentModelIndex*>(other));
+}
+
+void* QPersistentModelIndex_NewQPersistentModelIndex(void* index)
+{
+	return new QPersistentModelIndex(*static_cast<QModelIndex*>(index));
+}
+
+void* QPersistentModelIndex_NewQPersistentModelIndexInArena(void* arena, void* index)
+{
+	return new (goArenaAlloc<QPersistentModelIndex>(arena)) QPersistentModelIndex(*static_cast<QModelIndex*>(index));
+}
+
+void* QPersistentModelIndex_NewQPersistentModelIndex3(void* other)
+{
+	return new QPersistentModelIndex(*static_cast<QPersistentModelIndex*>(other));
+}
+
+void* QPersistentModelIndex_NewQPersistentModelIndex3InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QPersistentModelIndex>(arena)) QPersistentModelIndex(*static_cast<QPersistentModelIndex*>(other));
+}
+
+void QPersistentModelIndex_Swap(void* ptr, void* other)
+{
+	static_cast<QPersistentModelIndex*>(ptr)->swap(*static_cast<QPersistentModelIndex*>(other));
+}
+
+void* QPersistentModelIndex_Parent(void* ptr)
+{
+	return new QModelIndex(static_cast<QPersistentModelIndex*>(ptr)->parent());
+}
+
+void* QPersistentModelIndex_Sibling(void* ptr, int row, int column)
+{
+	return new QModelIndex(static_cast<QPersistentModelIndex*>(ptr)->sibling(row, column));
+}
+
+void* QPersistentModelIndex_Data(void* ptr, int role)
+{
+	return new QVariant(static_cast<QPersistentModelIndex*>(ptr)->data(role));
+}
+
+long long QPersistentModelIndex_Flags(void* ptr)
+{
+	return static_cast<QPersistentModelIndex*>(ptr)->flags();
+}
+
+char QPersistentModelIndex_IsValid(void* ptr)
+{
+	return static_cast<QPersistentModelIndex*>(ptr)->isValid();
+}
+
+void* QPersistentModelIndex_Model(void* ptr)
+{
+	return const_cast<QAbstractItemModel*>(static_cast<QPersistentModelIndex*>(ptr)->model());
+}
+
+int QPersistentModelIndex_Column(void* ptr)
+{
+	return static_cast<QPersistentModelIndex*>(ptr)->column();
+}
+
+int QPersistentModelIndex_Row(void* ptr)
+{
+	return static_cast<QPersistentModelIndex*>(ptr)->row();
+}
+
+class MyQPluginLoader: public QPluginLoader
+{
+public:
+	MyQPluginLoader(QObject *parent) : QPluginLoader(parent) {};
+	MyQPluginLoader(const QString &fileName, QObject *parent) : QPluginLoader(fileName, parent) {};
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QPluginLoader_Instance(void* ptr)
+{
+	return static_cast<QPluginLoader*>(ptr)->instance();
+}
+
+struct QtCore_PackedList QPluginLoader_QPluginLoader_StaticInstances()
+{
+	return ({ QList<QObject *>* tmpValue = new QList<QObject *>(QPluginLoader::staticInstances()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QPluginLoader_NewQPluginLoader(void* parent)
+{
+	return new MyQPluginLoader(static_cast<QObject*>(parent));
+}
+
+void* QPluginLoader_NewQPluginLoader2(char* fileName, void* parent)
+{
+	return new MyQPluginLoader(QString(fileName), static_cast<QObject*>(parent));
+}
+
+char QPluginLoader_Load(void* ptr)
+{
+	return static_cast<QPluginLoader*>(ptr)->load();
+}
+
+char QPluginLoader_Unload(void* ptr)
+{
+	return static_cast<QPluginLoader*>(ptr)->unload();
+}
+
+void QPluginLoader_SetFileName(void* ptr, char* fileName)
+{
+	static_cast<QPluginLoader*>(ptr)->setFileName(QString(fileName));
+}
+
+void QPluginLoader_SetLoadHints(void* ptr, long long loadHints)
+{
+	static_cast<QPluginLoader*>(ptr)->setLoadHints(static_cast<QLibrary::LoadHint>(loadHints));
+}
+
+void QPluginLoader_DestroyQPluginLoader(void* ptr)
+{
+	static_cast<QPluginLoader*>(ptr)->~QPluginLoader();
+}
+
+void* QPluginLoader_MetaData(void* ptr)
+{
+	return new QJsonObject(static_cast<QPluginLoader*>(ptr)->metaData());
+}
+
+long long QPluginLoader_LoadHints(void* ptr)
+{
+	return static_cast<QPluginLoader*>(ptr)->loadHints();
+}
+
+struct QtCore_PackedString QPluginLoader_ErrorString(void* ptr)
+{
+	return ({ QByteArray tc09de6 = static_cast<QPluginLoader*>(ptr)->errorString().toUtf8(); QtCore_PackedString { const_cast<char*>(tc09de6.prepend("WHITESPACE").constData()+10), tc09de6.size()-10 }; });
+}
+
+struct QtCore_PackedString QPluginLoader_FileName(void* ptr)
+{
+	return ({ QByteArray t54ffa7 = static_cast<QPluginLoader*>(ptr)->fileName().toUtf8(); QtCore_PackedString { const_cast<char*>(t54ffa7.prepend("WHITESPACE").constData()+10), t54ffa7.size()-10 }; });
+}
+
+char QPluginLoader_IsLoaded(void* ptr)
+{
+	return static_cast<QPluginLoader*>(ptr)->isLoaded();
+}
+
+void* QPluginLoader___staticInstances_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QPluginLoader___staticInstances_setList(void* ptr, void* i)
+{
+	static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+}
+
+void* QPluginLoader___staticInstances_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+void QPluginLoader___staticPlugins_setList(void* ptr, void* i)
+{
+	static_cast<QVector<QStaticPlugin>*>(ptr)->append(*static_cast<QStaticPlugin*>(i));
+}
+
+void* QPluginLoader___staticPlugins_newList(void* ptr)
+{
+	return new QVector<QStaticPlugin>;
+}
+
+void* QPoint_NewQPoint()
+{
+	return new QPoint();
+}
+
+void* QPoint_NewQPointInArena(void* arena)
+{
+	return new (goArenaAlloc<QPoint>(arena)) QPoint();
+}
+
+void* QPoint_NewQPoint2(int xpos, int ypos)
+{
+	return new QPoint(xpos, ypos);
+}
+
+void* QPoint_NewQPoint2InArena(void* arena, int xpos, int ypos)
+{
+	return new (goArenaAlloc<QPoint>(arena)) QPoint(xpos, ypos);
+}
+
+int QPoint_Rx(void* ptr)
+{
+	return static_cast<QPoint*>(ptr)->rx();
+}
+
+int QPoint_Ry(void* ptr)
+{
+	return static_cast<QPoint*>(ptr)->ry();
+}
+
+int QPoint_QPoint_DotProduct(void* p1, void* p2)
+{
+	return QPoint::dotProduct(*static_cast<QPoint*>(p1), *static_cast<QPoint*>(p2));
+}
+
+void QPoint_SetX(void* ptr, int x)
+{
+	static_cast<QPoint*>(ptr)->setX(x);
+}
+
+void QPoint_SetY(void* ptr, int y)
+{
+	static_cast<QPoint*>(ptr)->setY(y);
+}
+
+char QPoint_IsNull(void* ptr)
+{
+	return static_cast<QPoint*>(ptr)->isNull();
+}
+
+int QPoint_ManhattanLength(void* ptr)
+{
+	return static_cast<QPoint*>(ptr)->manhattanLength();
+}
+
+int QPoint_X(void* ptr)
+{
+	return static_cast<QPoint*>(ptr)->x();
+}
+
+int QPoint_Y(void* ptr)
+{
+	return static_cast<QPoint*>(ptr)->y();
+}
+
+void* QPointF_NewQPointF()
+{
+	return new QPointF();
+}
+
+void* QPointF_NewQPointFInArena(void* arena)
+{
+	return new (goArenaAlloc<QPointF>(arena)) QPointF();
+}
+
+void* QPointF_NewQPointF2(void* point)
+{
+	return new QPointF(*static_cast<QPoint*>(point));
+}
+
+void* QPointF_NewQPointF2InArena(void* arena, void* point)
+{
+	return new (goArenaAlloc<QPointF>(arena)) QPointF(*static_cast<QPoint*>(point));
+}
+
+void* QPointF_NewQPointF3(double xpos, double ypos)
+{
+	return new QPointF(xpos, ypos);
+}
+
+void* QPointF_NewQPointF3InArena(void* arena, double xpos, double ypos)
+{
+	return new (goArenaAlloc<QPointF>(arena)) QPointF(xpos, ypos);
+}
+
+double QPointF_Rx(void* ptr)
+{
+	return static_cast<QPointF*>(ptr)->rx();
+}
+
+double QPointF_Ry(void* ptr)
+{
+	return static_cast<QPointF*>(ptr)->ry();
+}
+
+double QPointF_QPointF_DotProduct(void* p1, void* p2)
+{
+	return QPointF::dotProduct(*static_cast<QPointF*>(p1), *static_cast<QPointF*>(p2));
+}
+
+void QPointF_SetX(void* ptr, double x)
+{
+	static_cast<QPointF*>(ptr)->setX(x);
+}
+
+void QPointF_SetY(void* ptr, double y)
+{
+	static_cast<QPointF*>(ptr)->setY(y);
+}
+
+void* QPointF_ToPoint(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QPointF*>(ptr)->toPoint(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+char QPointF_IsNull(void* ptr)
+{
+	return static_cast<QPointF*>(ptr)->isNull();
+}
+
+double QPointF_ManhattanLength(void* ptr)
+{
+	return static_cast<QPointF*>(ptr)->manhattanLength();
+}
+
+double QPointF_X(void* ptr)
+{
+	return static_cast<QPointF*>(ptr)->x();
+}
+
+double QPointF_Y(void* ptr)
+{
+	return static_cast<QPointF*>(ptr)->y();
+}
+
+class MyQPropertyAnimation: public QPropertyAnimation
+{
+public:
+	MyQPropertyAnimation(QObject *parent) : QPropertyAnimation(parent) {};
+	MyQPropertyAnimation(QObject *target, const QByteArray &propertyName, QObject *parent) : QPropertyAnimation(target, propertyName, parent) {};
+	bool event(QEvent * event) { return callbackQObject_Event(this, event) != 0; };
+	void updateCurrentValue(const QVariant & value) { callbackQVariantAnimation_UpdateCurrentValue(this, const_cast<QVariant*>(&value)); };
+	void updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_UpdateState(this, newState, oldState); };
+	void updateCurrentTime(int vin) { callbackQVariantAnimation_UpdateCurrentTime(this, vin); };
+	void Signal_ValueChanged(const QVariant & value) { callbackQVariantAnimation_ValueChanged(this, const_cast<QVariant*>(&value)); };
+	QVariant interpolated(const QVariant & from, const QVariant & to, qreal progress) const { return *static_cast<QVariant*>(callbackQVariantAnimation_Interpolated(const_cast<void*>(static_cast<const void*>(this)), const_cast<QVariant*>(&from), const_cast<QVariant*>(&to), progress)); };
+	int duration() const { return callbackQVariantAnimation_Duration(const_cast<void*>(static_cast<const void*>(this))); };
+	void Signal_Finished() { callbackQAbstractAnimation_Finished(this); };
+	void setCurrentTime(int msecs) { callbackQAbstractAnimation_SetCurrentTime(this, msecs); };
+	void Signal_CurrentLoopChanged(int currentLoop) { callbackQAbstractAnimation_CurrentLoopChanged(this, currentLoop); };
+	void Signal_DirectionChanged(QAbstractAnimation::Direction newDirection) { callbackQAbstractAnimation_DirectionChanged(this, newDirection); };
+	void pause() { callbackQAbstractAnimation_Pause(this); };
+	void resume() { callbackQAbstractAnimation_Resume(this); };
+	void setPaused(bool paused) { callbackQAbstractAnimation_SetPaused(this, paused); };
+	void start(QAbstractAnimation::DeletionPolicy policy) { callbackQAbstractAnimation_Start(this, policy); };
+	void Signal_StateChanged(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_StateChanged(this, newState, oldState); };
+	void stop() { callbackQAbstractAnimation_Stop(this); };
+	void updateDirection(QAbstractAnimation::Direction direction) { callbackQAbstractAnimation_UpdateDirection(this, direction); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QPropertyAnimation_NewQPropertyAnimation(void* parent)
+{
+	return new MyQPropertyAnimation(static_cast<QObject*>(parent));
+}
+
+void* QPropertyAnimation_NewQPropertyAnimation2(void* target, void* propertyName, void* parent)
+{
+	return new MyQPropertyAnimation(static_cast<QObject*>(target), *static_cast<QByteArray*>(propertyName), static_cast<QObject*>(parent));
+}
+
+void QPropertyAnimation_SetPropertyName(void* ptr, void* propertyName)
+{
+	static_cast<QPropertyAnimation*>(ptr)->setPropertyName(*static_cast<QByteArray*>(propertyName));
+}
+
+void QPropertyAnimation_SetTargetObject(void* ptr, void* target)
+{
+	static_cast<QPropertyAnimation*>(ptr)->setTargetObject(static_cast<QObject*>(target));
+}
+
+void QPropertyAnimation_DestroyQPropertyAnimation(void* ptr)
+{
+	static_cast<QPropertyAnimation*>(ptr)->~QPropertyAnimation();
+}
+
+void* QPropertyAnimation_PropertyName(void* ptr)
+{
+	return new QByteArray(static_cast<QPropertyAnimation*>(ptr)->propertyName());
+}
+
+void* QPropertyAnimation_TargetObject(void* ptr)
+{
+	return static_cast<QPropertyAnimation*>(ptr)->targetObject();
+}
+
+void* QReadLocker_NewQReadLocker(void* lock)
+{
+	return new QReadLocker(static_cast<QReadWriteLock*>(lock));
+}
+
+void* QReadLocker_NewQReadLockerInArena(void* arena, void* lock)
+{
+	return new (goArenaAlloc<QReadLocker>(arena)) QReadLocker(static_cast<QReadWriteLock*>(lock));
+}
+
+void QReadLocker_Relock(void* ptr)
+{
+	static_cast<QReadLocker*>(ptr)->relock();
+}
+
+void QReadLocker_Unlock(void* ptr)
+{
+	static_cast<QReadLocker*>(ptr)->unlock();
+}
+
+void QReadLocker_DestroyQReadLocker(void* ptr)
+{
+	static_cast<QReadLocker*>(ptr)->~QReadLocker();
+}
+
+void* QReadLocker_ReadWriteLock(void* ptr)
+{
+	return static_cast<QReadLocker*>(ptr)->readWriteLock();
+}
+
+void* QReadWriteLock_NewQReadWriteLock(long long recursionMode)
+{
+	return new QReadWriteLock(static_cast<QReadWriteLock::RecursionMode>(recursionMode));
+}
+
+void* QReadWriteLock_NewQReadWriteLockInArena(void* arena, long long recursionMode)
+{
+	return new (goArenaAlloc<QReadWriteLock>(arena)) QReadWriteLock(static_cast<QReadWriteLock::RecursionMode>(recursionMode));
+}
+
+char QReadWriteLock_TryLockForRead(void* ptr)
+{
+	return static_cast<QReadWriteLock*>(ptr)->tryLockForRead();
+}
+
+char QReadWriteLock_TryLockForRead2(void* ptr, int timeout)
+{
+	return static_cast<QReadWriteLock*>(ptr)->tryLockForRead(timeout);
+}
+
+char QReadWriteLock_TryLockForWrite(void* ptr)
+{
+	return static_cast<QReadWriteLock*>(ptr)->tryLockForWrite();
+}
+
+char QReadWriteLock_TryLockForWrite2(void* ptr, int timeout)
+{
+	return static_cast<QReadWriteLock*>(ptr)->tryLockForWrite(timeout);
+}
+
+void QReadWriteLock_LockForRead(void* ptr)
+{
+	static_cast<QReadWriteLock*>(ptr)->lockForRead();
+}
+
+void QReadWriteLock_LockForWrite(void* ptr)
+{
+	static_cast<QReadWriteLock*>(ptr)->lockForWrite();
+}
+
+void QReadWriteLock_Unlock(void* ptr)
+{
+	static_cast<QReadWriteLock*>(ptr)->unlock();
+}
+
+void QReadWriteLock_DestroyQReadWriteLock(void* ptr)
+{
+	static_cast<QReadWriteLock*>(ptr)->~QReadWriteLock();
+}
+
+void* QRect_NewQRect()
+{
+	return new QRect();
+}
+
+void* QRect_NewQRectInArena(void* arena)
+{
+	return new (goArenaAlloc<QRect>(arena)) QRect();
+}
+
+void* QRect_NewQRect2(void* topLeft, void* bottomRight)
+{
+	return new QRect(*static_cast<QPoint*>(topLeft), *static_cast<QPoint*>(bottomRight));
+}
+
+void* QRect_NewQRect2InArena(void* arena, void* topLeft, void* bottomRight)
+{
+	return new (goArenaAlloc<QRect>(arena)) QRect(*static_cast<QPoint*>(topLeft), *static_cast<QPoint*>(bottomRight));
+}
+
+void* QRect_NewQRect3(void* topLeft, void* size)
+{
+	return new QRect(*static_cast<QPoint*>(topLeft), *static_cast<QSize*>(size));
+}
+
+void* QRect_NewQRect3InArena(void* arena, void* topLeft, void* size)
+{
+	return new (goArenaAlloc<QRect>(arena)) QRect(*static_cast<QPoint*>(topLeft), *static_cast<QSize*>(size));
+}
+
+void* QRect_NewQRect4(int x, int y, int width, int height)
+{
+	return new QRect(x, y, width, height);
+}
+
+void* QRect_NewQRect4InArena(void* arena, int x, int y, int width, int height)
+{
+	return new (goArenaAlloc<QRect>(arena)) QRect(x, y, width, height);
+}
+
+void QRect_Adjust(void* ptr, int dx1, int dy1, int dx2, int dy2)
+{
+	static_cast<QRect*>(ptr)->adjust(dx1, dy1, dx2, dy2);
+}
+
+void QRect_MoveBottom(void* ptr, int y)
+{
+	static_cast<QRect*>(ptr)->moveBottom(y);
+}
+
+void QRect_MoveBottomLeft(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->moveBottomLeft(*static_cast<QPoint*>(position));
+}
+
+void QRect_MoveBottomRight(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->moveBottomRight(*static_cast<QPoint*>(position));
+}
+
+void QRect_MoveCenter(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->moveCenter(*static_cast<QPoint*>(position));
+}
+
+void QRect_MoveLeft(void* ptr, int x)
+{
+	static_cast<QRect*>(ptr)->moveLeft(x);
+}
+
+void QRect_MoveRight(void* ptr, int x)
+{
+	static_cast<QRect*>(ptr)->moveRight(x);
+}
+
+void QRect_MoveTo2(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->moveTo(*static_cast<QPoint*>(position));
+}
+
+void QRect_MoveTo(void* ptr, int x, int y)
+{
+	static_cast<QRect*>(ptr)->moveTo(x, y);
+}
+
+void QRect_MoveTop(void* ptr, int y)
+{
+	static_cast<QRect*>(ptr)->moveTop(y);
+}
+
+void QRect_MoveTopLeft(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->moveTopLeft(*static_cast<QPoint*>(position));
+}
+
+void QRect_MoveTopRight(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->moveTopRight(*static_cast<QPoint*>(position));
+}
+
+void QRect_SetBottom(void* ptr, int y)
+{
+	static_cast<QRect*>(ptr)->setBottom(y);
+}
+
+void QRect_SetBottomLeft(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->setBottomLeft(*static_cast<QPoint*>(position));
+}
+
+void QRect_SetBottomRight(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->setBottomRight(*static_cast<QPoint*>(position));
+}
+
+void QRect_SetCoords(void* ptr, int x1, int y1, int x2, int y2)
+{
+	static_cast<QRect*>(ptr)->setCoords(x1, y1, x2, y2);
+}
+
+void QRect_SetHeight(void* ptr, int height)
+{
+	static_cast<QRect*>(ptr)->setHeight(height);
+}
+
+void QRect_SetLeft(void* ptr, int x)
+{
+	static_cast<QRect*>(ptr)->setLeft(x);
+}
+
+void QRect_SetRect(void* ptr, int x, int y, int width, int height)
+{
+	static_cast<QRect*>(ptr)->setRect(x, y, width, height);
+}
+
+void QRect_SetRight(void* ptr, int x)
+{
+	static_cast<QRect*>(ptr)->setRight(x);
+}
+
+void QRect_SetSize(void* ptr, void* size)
+{
+	static_cast<QRect*>(ptr)->setSize(*static_cast<QSize*>(size));
+}
+
+void QRect_SetTop(void* ptr, int y)
+{
+	static_cast<QRect*>(ptr)->setTop(y);
+}
+
+void QRect_SetTopLeft(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->setTopLeft(*static_cast<QPoint*>(position));
+}
+
+void QRect_SetTopRight(void* ptr, void* position)
+{
+	static_cast<QRect*>(ptr)->setTopRight(*static_cast<QPoint*>(position));
+}
+
+void QRect_SetWidth(void* ptr, int width)
+{
+	static_cast<QRect*>(ptr)->setWidth(width);
+}
+
+void QRect_SetX(void* ptr, int x)
+{
+	static_cast<QRect*>(ptr)->setX(x);
+}
+
+void QRect_SetY(void* ptr, int y)
+{
+	static_cast<QRect*>(ptr)->setY(y);
+}
+
+void QRect_Translate2(void* ptr, void* offset)
+{
+	static_cast<QRect*>(ptr)->translate(*static_cast<QPoint*>(offset));
+}
+
+void QRect_Translate(void* ptr, int dx, int dy)
+{
+	static_cast<QRect*>(ptr)->translate(dx, dy);
+}
+
+void* QRect_BottomLeft(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QRect*>(ptr)->bottomLeft(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRect_BottomRight(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QRect*>(ptr)->bottomRight(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRect_Center(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QRect*>(ptr)->center(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRect_TopLeft(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QRect*>(ptr)->topLeft(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRect_TopRight(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QRect*>(ptr)->topRight(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRect_Adjusted(void* ptr, int dx1, int dy1, int dx2, int dy2)
+{
+	return ({ QRect tmpValue = static_cast<QRect*>(ptr)->adjusted(dx1, dy1, dx2, dy2); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRect_Intersected(void* ptr, void* rectangle)
+{
+	return ({ QRect tmpValue = static_cast<QRect*>(ptr)->intersected(*static_cast<QRect*>(rectangle)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRect_MarginsAdded(void* ptr, void* margins)
+{
+	return ({ QRect tmpValue = static_cast<QRect*>(ptr)->marginsAdded(*static_cast<QMargins*>(margins)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRect_MarginsRemoved(void* ptr, void* margins)
+{
+	return ({ QRect tmpValue = static_cast<QRect*>(ptr)->marginsRemoved(*static_cast<QMargins*>(margins)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRect_Normalized(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QRect*>(ptr)->normalized(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRect_Translated2(void* ptr, void* offset)
+{
+	return ({ QRect tmpValue = static_cast<QRect*>(ptr)->translated(*static_cast<QPoint*>(offset)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRect_Translated(void* ptr, int dx, int dy)
+{
+	return ({ QRect tmpValue = static_cast<QRect*>(ptr)->translated(dx, dy); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRect_Transposed(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QRect*>(ptr)->transposed(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRect_United(void* ptr, void* rectangle)
+{
+	return ({ QRect tmpValue = static_cast<QRect*>(ptr)->united(*static_cast<QRect*>(rectangle)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRect_Size(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QRect*>(ptr)->size(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+char QRect_Contains(void* ptr, void* point, char proper)
+{
+	return static_cast<QRect*>(ptr)->contains(*static_cast<QPoint*>(point), proper != 0);
+}
+
+char QRect_Contains2(void* ptr, void* rectangle, char proper)
+{
+	return static_cast<QRect*>(ptr)->contains(*static_cast<QRect*>(rectangle), proper != 0);
+}
+
+char QRect_Contains3(void* ptr, int x, int y)
+{
+	return static_cast<QRect*>(ptr)->contains(x, y);
+}
+
+char QRect_Contains4(void* ptr, int x, int y, char proper)
+{
+	return static_cast<QRect*>(ptr)->contains(x, y, proper != 0);
+}
+
+char QRect_Intersects(void* ptr, void* rectangle)
+{
+	return static_cast<QRect*>(ptr)->intersects(*static_cast<QRect*>(rectangle));
+}
+
+char QRect_IsEmpty(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->isEmpty();
+}
+
+char QRect_IsNull(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->isNull();
+}
+
+char QRect_IsValid(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->isValid();
+}
+
+int QRect_Bottom(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->bottom();
+}
+
+int QRect_Height(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->height();
+}
+
+int QRect_Left(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->left();
+}
+
+int QRect_Right(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->right();
+}
+
+int QRect_Top(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->top();
+}
+
+int QRect_Width(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->width();
+}
+
+int QRect_X(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->x();
+}
+
+int QRect_Y(void* ptr)
+{
+	return static_cast<QRect*>(ptr)->y();
+}
+
+void QRect_GetCoords(void* ptr, int x1, int y1, int x2, int y2)
+{
+	static_cast<QRect*>(ptr)->getCoords(&x1, &y1, &x2, &y2);
+}
+
+void QRect_GetRect(void* ptr, int x, int y, int width, int height)
+{
+	static_cast<QRect*>(ptr)->getRect(&x, &y, &width, &height);
+}
+
+void* QRectF_NewQRectF()
+{
+	return new QRectF();
+}
+
+void* QRectF_NewQRectFInArena(void* arena)
+{
+	return new (goArenaAlloc<QRectF>(arena)) QRectF();
+}
+
+void* QRectF_NewQRectF3(void* topLeft, void* bottomRight)
+{
+	return new QRectF(*static_cast<QPointF*>(topLeft), *static_cast<QPointF*>(bottomRight));
+}
+
+void* QRectF_NewQRectF3InArena(void* arena, void* topLeft, void* bottomRight)
+{
+	return new (goArenaAlloc<QRectF>(arena)) QRectF(*static_cast<QPointF*>(topLeft), *static_cast<QPointF*>(bottomRight));
+}
+
+void* QRectF_NewQRectF2(void* topLeft, void* size)
+{
+	return new QRectF(*static_cast<QPointF*>(topLeft), *static_cast<QSizeF*>(size));
+}
+
+void* QRectF_NewQRectF2InArena(void* arena, void* topLeft, void* size)
+{
+	return new (goArenaAlloc<QRectF>(arena)) QRectF(*static_cast<QPointF*>(topLeft), *static_cast<QSizeF*>(size));
+}
+
+void* QRectF_NewQRectF5(void* rectangle)
+{
+	return new QRectF(*static_cast<QRect*>(rectangle));
+}
+
+void* QRectF_NewQRectF5InArena(void* arena, void* rectangle)
+{
+	return new (goArenaAlloc<QRectF>(arena)) QRectF(*static_cast<QRect*>(rectangle));
+}
+
+void* QRectF_NewQRectF4(double x, double y, double width, double height)
+{
+	return new QRectF(x, y, width, height);
+}
+
+void* QRectF_NewQRectF4InArena(void* arena, double x, double y, double width, double height)
+{
+	return new (goArenaAlloc<QRectF>(arena)) QRectF(x, y, width, height);
+}
+
+void QRectF_Adjust(void* ptr, double dx1, double dy1, double dx2, double dy2)
+{
+	static_cast<QRectF*>(ptr)->adjust(dx1, dy1, dx2, dy2);
+}
+
+void QRectF_MoveBottom(void* ptr, double y)
+{
+	static_cast<QRectF*>(ptr)->moveBottom(y);
+}
+
+void QRectF_MoveBottomLeft(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->moveBottomLeft(*static_cast<QPointF*>(position));
+}
+
+void QRectF_MoveBottomRight(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->moveBottomRight(*static_cast<QPointF*>(position));
+}
+
+void QRectF_MoveCenter(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->moveCenter(*static_cast<QPointF*>(position));
+}
+
+void QRectF_MoveLeft(void* ptr, double x)
+{
+	static_cast<QRectF*>(ptr)->moveLeft(x);
+}
+
+void QRectF_MoveRight(void* ptr, double x)
+{
+	static_cast<QRectF*>(ptr)->moveRight(x);
+}
+
+void QRectF_MoveTo2(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->moveTo(*static_cast<QPointF*>(position));
+}
+
+void QRectF_MoveTo(void* ptr, double x, double y)
+{
+	static_cast<QRectF*>(ptr)->moveTo(x, y);
+}
+
+void QRectF_MoveTop(void* ptr, double y)
+{
+	static_cast<QRectF*>(ptr)->moveTop(y);
+}
+
+void QRectF_MoveTopLeft(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->moveTopLeft(*static_cast<QPointF*>(position));
+}
+
+void QRectF_MoveTopRight(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->moveTopRight(*static_cast<QPointF*>(position));
+}
+
+void QRectF_SetBottom(void* ptr, double y)
+{
+	static_cast<QRectF*>(ptr)->setBottom(y);
+}
+
+void QRectF_SetBottomLeft(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->setBottomLeft(*static_cast<QPointF*>(position));
+}
+
+void QRectF_SetBottomRight(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->setBottomRight(*static_cast<QPointF*>(position));
+}
+
+void QRectF_SetCoords(void* ptr, double x1, double y1, double x2, double y2)
+{
+	static_cast<QRectF*>(ptr)->setCoords(x1, y1, x2, y2);
+}
+
+void QRectF_SetHeight(void* ptr, double height)
+{
+	static_cast<QRectF*>(ptr)->setHeight(height);
+}
+
+void QRectF_SetLeft(void* ptr, double x)
+{
+	static_cast<QRectF*>(ptr)->setLeft(x);
+}
+
+void QRectF_SetRect(void* ptr, double x, double y, double width, double height)
+{
+	static_cast<QRectF*>(ptr)->setRect(x, y, width, height);
+}
+
+void QRectF_SetRight(void* ptr, double x)
+{
+	static_cast<QRectF*>(ptr)->setRight(x);
+}
+
+void QRectF_SetSize(void* ptr, void* size)
+{
+	static_cast<QRectF*>(ptr)->setSize(*static_cast<QSizeF*>(size));
+}
+
+void QRectF_SetTop(void* ptr, double y)
+{
+	static_cast<QRectF*>(ptr)->setTop(y);
+}
+
+void QRectF_SetTopLeft(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->setTopLeft(*static_cast<QPointF*>(position));
+}
+
+void QRectF_SetTopRight(void* ptr, void* position)
+{
+	static_cast<QRectF*>(ptr)->setTopRight(*static_cast<QPointF*>(position));
+}
+
+void QRectF_SetWidth(void* ptr, double width)
+{
+	static_cast<QRectF*>(ptr)->setWidth(width);
+}
+
+void QRectF_SetX(void* ptr, double x)
+{
+	static_cast<QRectF*>(ptr)->setX(x);
+}
+
+void QRectF_SetY(void* ptr, double y)
+{
+	static_cast<QRectF*>(ptr)->setY(y);
+}
+
+void QRectF_Translate2(void* ptr, void* offset)
+{
+	static_cast<QRectF*>(ptr)->translate(*static_cast<QPointF*>(offset));
+}
+
+void QRectF_Translate(void* ptr, double dx, double dy)
+{
+	static_cast<QRectF*>(ptr)->translate(dx, dy);
+}
+
+void* QRectF_BottomLeft(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QRectF*>(ptr)->bottomLeft(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRectF_BottomRight(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QRectF*>(ptr)->bottomRight(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRectF_Center(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QRectF*>(ptr)->center(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRectF_TopLeft(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QRectF*>(ptr)->topLeft(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRectF_TopRight(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QRectF*>(ptr)->topRight(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRectF_ToAlignedRect(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QRectF*>(ptr)->toAlignedRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_ToRect(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QRectF*>(ptr)->toRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_Adjusted(void* ptr, double dx1, double dy1, double dx2, double dy2)
+{
+	return ({ QRectF tmpValue = static_cast<QRectF*>(ptr)->adjusted(dx1, dy1, dx2, dy2); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_Intersected(void* ptr, void* rectangle)
+{
+	return ({ QRectF tmpValue = static_cast<QRectF*>(ptr)->intersected(*static_cast<QRectF*>(rectangle)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_MarginsAdded(void* ptr, void* margins)
+{
+	return ({ QRectF tmpValue = static_cast<QRectF*>(ptr)->marginsAdded(*static_cast<QMarginsF*>(margins)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_MarginsRemoved(void* ptr, void* margins)
+{
+	return ({ QRectF tmpValue = static_cast<QRectF*>(ptr)->marginsRemoved(*static_cast<QMarginsF*>(margins)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_Normalized(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QRectF*>(ptr)->normalized(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_Translated2(void* ptr, void* offset)
+{
+	return ({ QRectF tmpValue = static_cast<QRectF*>(ptr)->translated(*static_cast<QPointF*>(offset)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_Translated(void* ptr, double dx, double dy)
+{
+	return ({ QRectF tmpValue = static_cast<QRectF*>(ptr)->translated(dx, dy); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_Transposed(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QRectF*>(ptr)->transposed(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_United(void* ptr, void* rectangle)
+{
+	return ({ QRectF tmpValue = static_cast<QRectF*>(ptr)->united(*static_cast<QRectF*>(rectangle)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRectF_Size(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QRectF*>(ptr)->size(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+char QRectF_Contains(void* ptr, void* point)
+{
+	return static_cast<QRectF*>(ptr)->contains(*static_cast<QPointF*>(point));
+}
+
+char QRectF_Contains2(void* ptr, void* rectangle)
+{
+	return static_cast<QRectF*>(ptr)->contains(*static_cast<QRectF*>(rectangle));
+}
+
+char QRectF_Contains3(void* ptr, double x, double y)
+{
+	return static_cast<QRectF*>(ptr)->contains(x, y);
+}
+
+char QRectF_Intersects(void* ptr, void* rectangle)
+{
+	return static_cast<QRectF*>(ptr)->intersects(*static_cast<QRectF*>(rectangle));
+}
+
+char QRectF_IsEmpty(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->isEmpty();
+}
+
+char QRectF_IsNull(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->isNull();
+}
+
+char QRectF_IsValid(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->isValid();
+}
+
+double QRectF_Bottom(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->bottom();
+}
+
+double QRectF_Height(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->height();
+}
+
+double QRectF_Left(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->left();
+}
+
+double QRectF_Right(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->right();
+}
+
+double QRectF_Top(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->top();
+}
+
+double QRectF_Width(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->width();
+}
+
+double QRectF_X(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->x();
+}
+
+double QRectF_Y(void* ptr)
+{
+	return static_cast<QRectF*>(ptr)->y();
+}
+
+void QRectF_GetCoords(void* ptr, double x1, double y1, double x2, double y2)
+{
+	static_cast<QRectF*>(ptr)->getCoords(&x1, &y1, &x2, &y2);
+}
+
+void QRectF_GetRect(void* ptr, double x, double y, double width, double height)
+{
+	static_cast<QRectF*>(ptr)->getRect(&x, &y, &width, &height);
+}
+
+void* QRegExp_NewQRegExp()
+{
+	return new QRegExp();
+}
+
+void* QRegExp_NewQRegExpInArena(void* arena)
+{
+	return new (goArenaAlloc<QRegExp>(arena)) QRegExp();
+}
+
+void* QRegExp_NewQRegExp3(void* rx)
+{
+	return new QRegExp(*static_cast<QRegExp*>(rx));
+}
+
+void* QRegExp_NewQRegExp3InArena(void* arena, void* rx)
+{
+	return new (goArenaAlloc<QRegExp>(arena)) QRegExp(*static_cast<QRegExp*>(rx));
+}
+
+void* QRegExp_NewQRegExp2(char* pattern, long long cs, long long syntax)
+{
+	return new QRegExp(QString(pattern), static_cast<Qt::CaseSensitivity>(cs), static_cast<QRegExp::PatternSyntax>(syntax));
+}
+
+void* QRegExp_NewQRegExp2InArena(void* arena, char* pattern, long long cs, long long syntax)
+{
+	return new (goArenaAlloc<QRegExp>(arena)) QRegExp(QString(pattern), static_cast<Qt::CaseSensitivity>(cs), static_cast<QRegExp::PatternSyntax>(syntax));
+}
+
+struct QtCore_PackedString QRegExp_QRegExp_Escape(char* str)
+{
+	return ({ QByteArray t41bd01 = QRegExp::escape(QString(str)).toUtf8(); QtCore_PackedString { const_cast<char*>(t41bd01.prepend("WHITESPACE").constData()+10), t41bd01.size()-10 }; });
+}
+
+void QRegExp_SetCaseSensitivity(void* ptr, long long cs)
+{
+	static_cast<QRegExp*>(ptr)->setCaseSensitivity(static_cast<Qt::CaseSensitivity>(cs));
+}
+
+void QRegExp_SetMinimal(void* ptr, char minimal)
+{
+	static_cast<QRegExp*>(ptr)->setMinimal(minimal != 0);
+}
+
+void QRegExp_SetPattern(void* ptr, char* pattern)
+{
+	static_cast<QRegExp*>(ptr)->setPattern(QString(pattern));
+}
+
+void QRegExp_SetPatternSyntax(void* ptr, long long syntax)
+{
+	static_cast<QRegExp*>(ptr)->setPatternSyntax(static_cast<QRegExp::PatternSyntax>(syntax));
+}
+
+void QRegExp_Swap(void* ptr, void* other)
+{
+	static_cast<QRegExp*>(ptr)->swap(*static_cast<QRegExp*>(other));
+}
+
+void QRegExp_DestroyQRegExp(void* ptr)
+{
+	static_cast<QRegExp*>(ptr)->~QRegExp();
+}
+
+long long QRegExp_PatternSyntax(void* ptr)
+{
+	return static_cast<QRegExp*>(ptr)->patternSyntax();
+}
+
+struct QtCore_PackedString QRegExp_Cap(void* ptr, int nth)
+{
+	return ({ QByteArray t6327b9 = static_cast<QRegExp*>(ptr)->cap(nth).toUtf8(); QtCore_PackedString { const_cast<char*>(t6327b9.prepend("WHITESPACE").constData()+10), t6327b9.size()-10 }; });
+}
+
+struct QtCore_PackedString QRegExp_ErrorString(void* ptr)
+{
+	return ({ QByteArray t53d00c = static_cast<QRegExp*>(ptr)->errorString().toUtf8(); QtCore_PackedString { const_cast<char*>(t53d00c.prepend("WHITESPACE").constData()+10), t53d00c.size()-10 }; });
+}
+
+struct QtCore_PackedString QRegExp_Pattern(void* ptr)
+{
+	return ({ QByteArray t70b801 = static_cast<QRegExp*>(ptr)->pattern().toUtf8(); QtCore_PackedString { const_cast<char*>(t70b801.prepend("WHITESPACE").constData()+10), t70b801.size()-10 }; });
+}
+
+struct QtCore_PackedString QRegExp_CapturedTexts(void* ptr)
+{
+	return ({ long long t69e4cflen; char* t69e4cf = goPackStringList(static_cast<QRegExp*>(ptr)->capturedTexts(), &t69e4cflen); QtCore_PackedString { t69e4cf, t69e4cflen }; });
+}
+
+long long QRegExp_CaseSensitivity(void* ptr)
+{
+	return static_cast<QRegExp*>(ptr)->caseSensitivity();
+}
+
+char QRegExp_ExactMatch(void* ptr, char* str)
+{
+	return static_cast<QRegExp*>(ptr)->exactMatch(QString(str));
+}
+
+char QRegExp_IsEmpty(void* ptr)
+{
+	return static_cast<QRegExp*>(ptr)->isEmpty();
+}
+
+char QRegExp_IsMinimal(void* ptr)
+{
+	return static_cast<QRegExp*>(ptr)->isMinimal();
+}
+
+char QRegExp_IsValid(void* ptr)
+{
+	return static_cast<QRegExp*>(ptr)->isValid();
+}
+
+int QRegExp_CaptureCount(void* ptr)
+{
+	return static_cast<QRegExp*>(ptr)->captureCount();
+}
+
+int QRegExp_IndexIn(void* ptr, char* str, int offset, long long caretMode)
+{
+	return static_cast<QRegExp*>(ptr)->indexIn(QString(str), offset, static_cast<QRegExp::CaretMode>(caretMode));
+}
+
+int QRegExp_LastIndexIn(void* ptr, char* str, int offset, long long caretMode)
+{
+	return static_cast<QRegExp*>(ptr)->lastIndexIn(QString(str), offset, static_cast<QRegExp::CaretMode>(caretMode));
+}
+
+int QRegExp_MatchedLength(void* ptr)
+{
+	return static_cast<QRegExp*>(ptr)->matchedLength();
+}
+
+int QRegExp_Pos(void* ptr, int nth)
+{
+	return static_cast<QRegExp*>(ptr)->pos(nth);
+}
+
+void* QRegularExpression_NewQRegularExpression()
+{
+	return new QRegularExpression();
+}
+
+void* QRegularExpression_NewQRegularExpressionInArena(void* arena)
+{
+	return new (goArenaAlloc<QRegularExpression>(arena)) QRegularExpression();
+}
+
+void* QRegularExpression_NewQRegularExpression3(void* re)
+{
+	return new QRegularExpression(*static_cast<QRegularExpression*>(re));
+}
+
+void* QRegularExpression_NewQRegularExpression3InArena(void* arena, void* re)
+{
+	return new (goArenaAlloc<QRegularExpression>(arena)) QRegularExpression(*static_cast<QRegularExpression*>(re));
+}
+
+void* QRegularExpression_NewQRegularExpression2(char* pattern, long long options)
+{
+	return new QRegularExpression(QString(pattern), static_cast<QRegularExpression::PatternOption>(options));
+}
+
+void* QRegularExpression_NewQRegularExpression2InArena(void* arena, char* pattern, long long options)
+{
+	return new (goArenaAlloc<QRegularExpression>(arena)) QRegularExpression(QString(pattern), static_cast<QRegularExpression::PatternOption>(options));
+}
+
+struct QtCore_PackedString QRegularExpression_QRegularExpression_Escape(char* str)
+{
+	return ({ QByteArray t3e4dec = QRegularExpression::escape(QString(str)).toUtf8(); QtCore_PackedString { const_cast<char*>(t3e4dec.prepend("WHITESPACE").constData()+10), t3e4dec.size()-10 }; });
+}
+
+void QRegularExpression_SetPattern(void* ptr, char* pattern)
+{
+	static_cast<QRegularExpression*>(ptr)->setPattern(QString(pattern));
+}
+
+void QRegularExpression_SetPatternOptions(void* ptr, long long options)
+{
+	static_cast<QRegularExpression*>(ptr)->setPatternOptions(static_cast<QRegularExpression::PatternOption>(options));
+}
+
+void QRegularExpression_Swap(void* ptr, void* other)
+{
+	static_cast<QRegularExpression*>(ptr)->swap(*static_cast<QRegularExpression*>(other));
+}
+
+void QRegularExpression_DestroyQRegularExpression(void* ptr)
+{
+	static_cast<QRegularExpression*>(ptr)->~QRegularExpression();
+}
+
+long long QRegularExpression_PatternOptions(void* ptr)
+{
+	return static_cast<QRegularExpression*>(ptr)->patternOptions();
+}
+
+void* QRegularExpression_Match(void* ptr, char* subject, int offset, long long matchType, long long matchOptions)
+{
+	return new QRegularExpressionMatch(static_cast<QRegularExpression*>(ptr)->match(QString(subject), offset, static_cast<QRegularExpression::MatchType>(matchType), static_cast<QRegularExpression::MatchOption>(matchOptions)));
+}
+
+void* QRegularExpression_Match2(void* ptr, void* subjectRef, int offset, long long matchType, long long matchOptions)
+{
+	return new QRegularExpressionMatch(static_cast<QRegularExpression*>(ptr)->match(*static_cast<QStringRef*>(subjectRef), offset, static_cast<QRegularExpression::MatchType>(matchType), static_cast<QRegularExpression::MatchOption>(matchOptions)));
+}
+
+void* QRegularExpression_GlobalMatch(void* ptr, char* subject, int offset, long long matchType, long long matchOptions)
+{
+	return new QRegularExpressionMatchIterator(static_cast<QRegularExpression*>(ptr)->globalMatch(QString(subject), offset, static_cast<QRegularExpression::MatchType>(matchType), static_cast<QRegularExpression::MatchOption>(matchOptions)));
+}
+
+void* QRegularExpression_GlobalMatch2(void* ptr, void* subjectRef, int offset, long long matchType, long long matchOptions)
+{
+	return new QRegularExpressionMatchIterator(static_cast<QRegularExpression*>(ptr)->globalMatch(*static_cast<QStringRef*>(subjectRef), offset, static_cast<QRegularExpression::MatchType>(matchType), static_cast<QRegularExpression::MatchOption>(matchOptions)));
+}
+
+struct QtCore_PackedString QRegularExpression_ErrorString(void* ptr)
+{
+	return ({ QByteArray t85aa6b = static_cast<QRegularExpression*>(ptr)->errorString().toUtf8(); QtCore_PackedString { const_cast<char*>(t85aa6b.prepend("WHITESPACE").constData()+10), t85aa6b.size()-10 }; });
+}
+
+struct QtCore_PackedString QRegularExpression_Pattern(void* ptr)
+{
+	return ({ QByteArray t585ea0 = static_cast<QRegularExpression*>(ptr)->pattern().toUtf8(); QtCore_PackedString { const_cast<char*>(t585ea0.prepend("WHITESPACE").constData()+10), t585ea0.size()-10 }; });
+}
+
+struct QtCore_PackedString QRegularExpression_NamedCaptureGroups(void* ptr)
+{
+	return ({ long long t5a80a4len; char* t5a80a4 = goPackStringList(static_cast<QRegularExpression*>(ptr)->namedCaptureGroups(), &t5a80a4len); QtCore_PackedString { t5a80a4, t5a80a4len }; });
+}
+
+char QRegularExpression_IsValid(void* ptr)
+{
+	return static_cast<QRegularExpression*>(ptr)->isValid();
+}
+
+int QRegularExpression_CaptureCount(void* ptr)
+{
+	return static_cast<QRegularExpression*>(ptr)->captureCount();
+}
+
+int QRegularExpression_PatternErrorOffset(void* ptr)
+{
+	return static_cast<QRegularExpression*>(ptr)->patternErrorOffset();
+}
+
+void QRegularExpression_Optimize(void* ptr)
+{
+	static_cast<QRegularExpression*>(ptr)->optimize();
+}
+
+void* QRegularExpressionMatch_NewQRegularExpressionMatch()
+{
+	return new QRegularExpressionMatch();
+}
+
+void* QRegularExpressionMatch_NewQRegularExpressionMatchInArena(void* arena)
+{
+	return new (goArenaAlloc<QRegularExpressionMatch>(arena)) QRegularExpressionMatch();
+}
+
+void* QRegularExpressionMatch_NewQRegularExpressionMatch2(void* match)
+{
+	return new QRegularExpressionMatch(*static_cast<QRegularExpressionMatch*>(match));
+}
+
+void* QRegularExpressionMatch_NewQRegularExpressionMatch2InArena(void* arena, void* match)
+{
+	return new (goArenaAlloc<QRegularExpressionMatch>(arena)) QRegularExpressionMatch(*static_cast<QRegularExpressionMatch*>(match));
+}
+
+void QRegularExpressionMatch_Swap(void* ptr, void* other)
+{
+	static_cast<QRegularExpressionMatch*>(ptr)->swap(*static_cast<QRegularExpressionMatch*>(other));
+}
+
+void QRegularExpressionMatch_DestroyQRegularExpressionMatch(void* ptr)
+{
+	static_cast<QRegularExpressionMatch*>(ptr)->~QRegularExpressionMatch();
+}
+
+void* QRegularExpressionMatch_RegularExpression(void* ptr)
+{
+	return new QRegularExpression(static_cast<QRegularExpressionMatch*>(ptr)->regularExpression());
+}
+
+long long QRegularExpressionMatch_MatchOptions(void* ptr)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->matchOptions();
+}
+
+long long QRegularExpressionMatch_MatchType(void* ptr)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->matchType();
+}
+
+struct QtCore_PackedString QRegularExpressionMatch_Captured2(void* ptr, char* name)
+{
+	return ({ QByteArray tec1278 = static_cast<QRegularExpressionMatch*>(ptr)->captured(QString(name)).toUtf8(); QtCore_PackedString { const_cast<char*>(tec1278.prepend("WHITESPACE").constData()+10), tec1278.size()-10 }; });
+}
+
+struct QtCore_PackedString QRegularExpressionMatch_Captured(void* ptr, int nth)
+{
+	return ({ QByteArray t5bb134 = static_cast<QRegularExpressionMatch*>(ptr)->captured(nth).toUtf8(); QtCore_PackedString { const_cast<char*>(t5bb134.prepend("WHITESPACE").constData()+10), t5bb134.size()-10 }; });
+}
+
+struct QtCore_PackedString QRegularExpressionMatch_CapturedTexts(void* ptr)
+{
+	return ({ long long t75c0a9len; char* t75c0a9 = goPackStringList(static_cast<QRegularExpressionMatch*>(ptr)->capturedTexts(), &t75c0a9len); QtCore_PackedString { t75c0a9, t75c0a9len }; });
+}
+
+void* QRegularExpressionMatch_CapturedRef2(void* ptr, char* name)
+{
+	return new QStringRef(static_cast<QRegularExpressionMatch*>(ptr)->capturedRef(QString(name)));
+}
+
+void* QRegularExpressionMatch_CapturedRef(void* ptr, int nth)
+{
+	return new QStringRef(static_cast<QRegularExpressionMatch*>(ptr)->capturedRef(nth));
+}
+
+char QRegularExpressionMatch_HasMatch(void* ptr)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->hasMatch();
+}
+
+char QRegularExpressionMatch_HasPartialMatch(void* ptr)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->hasPartialMatch();
+}
+
+char QRegularExpressionMatch_IsValid(void* ptr)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->isValid();
+}
+
+int QRegularExpressionMatch_CapturedEnd2(void* ptr, char* name)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->capturedEnd(QString(name));
+}
+
+int QRegularExpressionMatch_CapturedEnd(void* ptr, int nth)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->capturedEnd(nth);
+}
+
+int QRegularExpressionMatch_CapturedLength2(void* ptr, char* name)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->capturedLength(QString(name));
+}
+
+int QRegularExpressionMatch_CapturedLength(void* ptr, int nth)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->capturedLength(nth);
+}
+
+int QRegularExpressionMatch_CapturedStart2(void* ptr, char* name)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->capturedStart(QString(name));
+}
+
+int QRegularExpressionMatch_CapturedStart(void* ptr, int nth)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->capturedStart(nth);
+}
+
+int QRegularExpressionMatch_LastCapturedIndex(void* ptr)
+{
+	return static_cast<QRegularExpressionMatch*>(ptr)->lastCapturedIndex();
+}
+
+void* QResource_NewQResource(char* file, void* locale)
+{
+	return new QResource(QString(file), *static_cast<QLocale*>(locale));
+}
+
+void* QResource_NewQResourceInArena(void* arena, char* file, void* locale)
+{
+	return new (goArenaAlloc<QResource>(arena)) QResource(QString(file), *static_cast<QLocale*>(locale));
+}
+
+char QResource_QResource_RegisterResource(char* rccFileName, char* mapRoot)
+{
+	return QResource::registerResource(QString(rccFileName), QString(mapRoot));
+}
+
+char QResource_QResource_RegisterResource2(char* rccData, char* mapRoot)
+{
+	return QResource::registerResource(const_cast<const uchar*>(static_cast<uchar*>(static_cast<void*>(rccData))), QString(mapRoot));
+}
+
+char QResource_QResource_UnregisterResource(char* rccFileName, char* mapRoot)
+{
+	return QResource::unregisterResource(QString(rccFileName), QString(mapRoot));
+}
+
+char QResource_QResource_UnregisterResource2(char* rccData, char* mapRoot)
+{
+	return QResource::unregisterResource(const_cast<const uchar*>(static_cast<uchar*>(static_cast<void*>(rccData))), QString(mapRoot));
+}
+
+void QResource_SetFileName(void* ptr, char* file)
+{
+	static_cast<QResource*>(ptr)->setFileName(QString(file));
+}
+
+void QResource_SetLocale(void* ptr, void* locale)
+{
+	static_cast<QResource*>(ptr)->setLocale(*static_cast<QLocale*>(locale));
+}
+
+void QResource_DestroyQResource(void* ptr)
+{
+	static_cast<QResource*>(ptr)->~QResource();
+}
+
+void* QResource_LastModified(void* ptr)
+{
+	return new QDateTime(static_cast<QResource*>(ptr)->lastModified());
+}
+
+void* QResource_Locale(void* ptr)
+{
+	return new QLocale(static_cast<QResource*>(ptr)->locale());
+}
+
+struct QtCore_PackedString QResource_AbsoluteFilePath(void* ptr)
+{
+	return ({ QByteArray t1066ec = static_cast<QResource*>(ptr)->absoluteFilePath().toUtf8(); QtCore_PackedString { const_cast<char*>(t1066ec.prepend("WHITESPACE").constData()+10), t1066ec.size()-10 }; });
+}
+
+struct QtCore_PackedString QResource_FileName(void* ptr)
+{
+	return ({ QByteArray t28de69 = static_cast<QResource*>(ptr)->fileName().toUtf8(); QtCore_PackedString { const_cast<char*>(t28de69.prepend("WHITESPACE").constData()+10), t28de69.size()-10 }; });
+}
+
+struct QtCore_PackedString QResource_Children(void* ptr)
+{
+	return ({ long long t6aef35len; char* t6aef35 = goPackStringList(static_cast<QResource*>(ptr)->children(), &t6aef35len); QtCore_PackedString { t6aef35, t6aef35len }; });
+}
+
+char QResource_IsCompressed(void* ptr)
+{
+	return static_cast<QResource*>(ptr)->isCompressed();
+}
+
+char QResource_IsDir(void* ptr)
+{
+	return static_cast<QResource*>(ptr)->isDir();
+}
+
+char QResource_IsFile(void* ptr)
+{
+	return static_cast<QResource*>(ptr)->isFile();
+}
+
+char QResource_IsValid(void* ptr)
+{
+	return static_cast<QResource*>(ptr)->isValid();
+}
+
+struct QtCore_PackedString QResource_Data(void* ptr)
+{
+	return ({ char* t4b0f0d = static_cast<char*>(static_cast<void*>(const_cast<uchar*>(static_cast<QResource*>(ptr)->data()))); QtCore_PackedString { t4b0f0d, -1 }; });
+}
+
+long long QResource_Size(void* ptr)
+{
+	return static_cast<QResource*>(ptr)->size();
+}
+
+class MyQRunnable: public QRunnable
+{
+public:
+	MyQRunnable() : QRunnable() {};
+	void run() { callbackQRunnable_Run(this); };
+	 ~MyQRunnable() { callbackQRunnable_DestroyQRunnable(this); };
+};
+
+void* QRunnable_NewQRunnable()
+{
+	return new MyQRunnable();
+}
+
+void QRunnable_Run(void* ptr)
+{
+	static_cast<QRunnable*>(ptr)->run();
+}
+
+void QRunnable_SetAutoDelete(void* ptr, char autoDelete)
+{
+	static_cast<QRunnable*>(ptr)->setAutoDelete(autoDelete != 0);
+}
+
+void QRunnable_DestroyQRunnable(void* ptr)
+{
+	static_cast<QRunnable*>(ptr)->~QRunnable();
+}
+
+void QRunnable_DestroyQRunnableDefault(void* ptr)
+{
+
+}
+
+char QRunnable_AutoDelete(void* ptr)
+{
+	return static_cast<QRunnable*>(ptr)->autoDelete();
+}
+
+class MyQSaveFile: public QSaveFile
+{
+public:
+	MyQSaveFile(QObject *parent) : QSaveFile(parent) {};
+	MyQSaveFile(const QString &name) : QSaveFile(name) {};
+	MyQSaveFile(const QString &name, QObject *parent) : QSaveFile(name, parent) {};
+	bool open(QIODevice::OpenMode mode) { return callbackQIODevice_Open(this, mode) != 0; };
+	qint64 writeData(const char * data, qint64 len) { QtCore_PackedString dataPacked = { const_cast<char*>(data), len };return callbackQFileDevice_WriteData(this, dataPacked, len); };
+	QString fileName() const { return QString(callbackQFileDevice_FileName(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool resize(qint64 sz) { return callbackQFileDevice_Resize(this, sz) != 0; };
+	bool seek(qint64 pos) { return callbackQIODevice_Seek(this, pos) != 0; };
+	bool setPermissions(QFileDevice::Permissions permissions) { return callbackQFileDevice_SetPermissions(this, permissions) != 0; };
+	qint64 readData(char * data, qint64 len) { QtCore_PackedString dataPacked = { data, len };return callbackQFileDevice_ReadData(this, dataPacked, len); };
+	qint64 readLineData(char * data, qint64 maxlen) { QtCore_PackedString dataPacked = { data, maxlen };return callbackQIODevice_ReadLineData(this, dataPacked, maxlen); };
+	void close() { callbackQIODevice_Close(this); };
+	Permissions permissions() const { return static_cast<QFileDevice::Permission>(callbackQFileDevice_Permissions(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool atEnd() const { return callbackQIODevice_AtEnd(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	bool isSequential() const { return callbackQIODevice_IsSequential(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	qint64 pos() const { return callbackQIODevice_Pos(const_cast<void*>(static_cast<const void*>(this))); };
+	qint64 size() const { return callbackQIODevice_Size(const_cast<void*>(static_cast<const void*>(this))); };
+	bool reset() { return callbackQIODevice_Reset(this) != 0; };
+	bool waitForBytesWritten(int msecs) { return callbackQIODevice_WaitForBytesWritten(this, msecs) != 0; };
+	bool waitForReadyRead(int msecs) { return callbackQIODevice_WaitForReadyRead(this, msecs) != 0; };
+	void Signal_AboutToClose() { callbackQIODevice_AboutToClose(this); };
+	void Signal_BytesWritten(qint64 bytes) { callbackQIODevice_BytesWritten(this, bytes); };
+	void Signal_ChannelBytesWritten(int channel, qint64 bytes) { callbackQIODevice_ChannelBytesWritten(this, channel, bytes); };
+	void Signal_ChannelReadyRead(int channel) { callbackQIODevice_ChannelReadyRead(this, channel); };
+	void Signal_ReadChannelFinished() { callbackQIODevice_ReadChannelFinished(this); };
+	void Signal_ReadyRead() { callbackQIODevice_ReadyRead(this); };
+	bool canReadLine() const { return callbackQIODevice_CanReadLine(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	qint64 bytesAvailable() const { return callbackQIODevice_BytesAvailable(const_cast<void*>(static_cast<const void*>(this))); };
+	qint64 bytesToWrite() const { return callbackQIODevice_BytesToWrite(const_cast<void*>(static_cast<const void*>(this))); };
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSaveFile_NewQSaveFile2(void* parent)
+{
+	return new MyQSaveFile(static_cast<QObject*>(parent));
+}
+
+void* QSaveFile_NewQSaveFile(char* name)
+{
+	return new MyQSaveFile(QString(name));
+}
+
+void* QSaveFile_NewQSaveFile3(char* name, void* parent)
+{
+	return new MyQSaveFile(QString(name), static_cast<QObject*>(parent));
+}
+
+char QSaveFile_Commit(void* ptr)
+{
+	return static_cast<QSaveFile*>(ptr)->commit();
+}
+
+void QSaveFile_CancelWriting(void* ptr)
+{
+	static_cast<QSaveFile*>(ptr)->cancelWriting();
+}
+
+void QSaveFile_SetDirectWriteFallback(void* ptr, char enabled)
+{
+	static_cast<QSaveFile*>(ptr)->setDirectWriteFallback(enabled != 0);
+}
+
+void QSaveFile_SetFileName(void* ptr, char* name)
+{
+	static_cast<QSaveFile*>(ptr)->setFileName(QString(name));
+}
+
+void QSaveFile_DestroyQSaveFile(void* ptr)
+{
+	static_cast<QSaveFile*>(ptr)->~QSaveFile();
+}
+
+char QSaveFile_DirectWriteFallback(void* ptr)
+{
+	return static_cast<QSaveFile*>(ptr)->directWriteFallback();
+}
+
+void* QSemaphore_NewQSemaphore(int n)
+{
+	return new QSemaphore(n);
+}
+
+void* QSemaphore_NewQSemaphoreInArena(void* arena, int n)
+{
+	return new (goArenaAlloc<QSemaphore>(arena)) QSemaphore(n);
+}
+
+char QSemaphore_TryAcquire(void* ptr, int n)
+{
+	return static_cast<QSemaphore*>(ptr)->tryAcquire(n);
+}
+
+char QSemaphore_TryAcquire2(void* ptr, int n, int timeout)
+{
+	return static_cast<QSemaphore*>(ptr)->tryAcquire(n, timeout);
+}
+
+void QSemaphore_Acquire(void* ptr, int n)
+{
+	static_cast<QSemaphore*>(ptr)->acquire(n);
+}
+
+void QSemaphore_Release(void* ptr, int n)
+{
+	static_cast<QSemaphore*>(ptr)->release(n);
+}
+
+void QSemaphore_DestroyQSemaphore(void* ptr)
+{
+	static_cast<QSemaphore*>(ptr)->~QSemaphore();
+}
+
+int QSemaphore_Available(void* ptr)
+{
+	return static_cast<QSemaphore*>(ptr)->available();
+}
+
+class MyQSequentialAnimationGroup: public QSequentialAnimationGroup
+{
+public:
+	MyQSequentialAnimationGroup(QObject *parent) : QSequentialAnimationGroup(parent) {};
+	bool event(QEvent * event) { return callbackQObject_Event(this, event) != 0; };
+	void Signal_CurrentAnimationChanged(QAbstractAnimation * current) { callbackQSequentialAnimationGroup_CurrentAnimationChanged(this, current); };
+	void updateCurrentTime(int currentTime) { callbackQSequentialAnimationGroup_UpdateCurrentTime(this, currentTime); };
+	void updateDirection(QAbstractAnimation::Direction direction) { callbackQAbstractAnimation_UpdateDirection(this, direction); };
+	void updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_UpdateState(this, newState, oldState); };
+	int duration() const { return callbackQSequentialAnimationGroup_Duration(const_cast<void*>(static_cast<const void*>(this))); };
+	void Signal_Finished() { callbackQAbstractAnimation_Finished(this); };
+	void setCurrentTime(int msecs) { callbackQAbstractAnimation_SetCurrentTime(this, msecs); };
+	void Signal_CurrentLoopChanged(int currentLoop) { callbackQAbstractAnimation_CurrentLoopChanged(this, currentLoop); };
+	void Signal_DirectionChanged(QAbstractAnimation::Direction newDirection) { callbackQAbstractAnimation_DirectionChanged(this, newDirection); };
+	void pause() { callbackQAbstractAnimation_Pause(this); };
+	void resume() { callbackQAbstractAnimation_Resume(this); };
+	void setPaused(bool paused) { callbackQAbstractAnimation_SetPaused(this, paused); };
+	void start(QAbstractAnimation::DeletionPolicy policy) { callbackQAbstractAnimation_Start(this, policy); };
+	void Signal_StateChanged(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_StateChanged(this, newState, oldState); };
+	void stop() { callbackQAbstractAnimation_Stop(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSequentialAnimationGroup_AddPause(void* ptr, int msecs)
+{
+	return static_cast<QSequentialAnimationGroup*>(ptr)->addPause(msecs);
+}
+
+void* QSequentialAnimationGroup_InsertPause(void* ptr, int index, int msecs)
+{
+	return static_cast<QSequentialAnimationGroup*>(ptr)->insertPause(index, msecs);
+}
+
+void* QSequentialAnimationGroup_NewQSequentialAnimationGroup(void* parent)
+{
+	return new MyQSequentialAnimationGroup(static_cast<QObject*>(parent));
+}
+
+void QSequentialAnimationGroup_ConnectCurrentAnimationChanged(void* ptr)
+{
+	QObject::connect(static_cast<QSequentialAnimationGroup*>(ptr), static_cast<void (QSequentialAnimationGroup::*)(QAbstractAnimation *)>(&QSequentialAnimationGroup::currentAnimationChanged), static_cast<MyQSequentialAnimationGroup*>(ptr), static_cast<void (MyQSequentialAnimationGroup::*)(QAbstractAnimation *)>(&MyQSequentialAnimationGroup::Signal_CurrentAnimationChanged));
+}
+
+void QSequentialAnimationGroup_DisconnectCurrentAnimationChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QSequentialAnimationGroup*>(ptr), static_cast<void (QSequentialAnimationGroup::*)(QAbstractAnimation *)>(&QSequentialAnimationGroup::currentAnimationChanged), static_cast<MyQSequentialAnimationGroup*>(ptr), static_cast<void (MyQSequentialAnimationGroup::*)(QAbstractAnimation *)>(&MyQSequentialAnimationGroup::Signal_CurrentAnimationChanged));
+}
+
+void QSequentialAnimationGroup_CurrentAnimationChanged(void* ptr, void* current)
+{
+	static_cast<QSequentialAnimationGroup*>(ptr)->currentAnimationChanged(static_cast<QAbstractAnimation*>(current));
+}
+
+void QSequentialAnimationGroup_UpdateCurrentTime(void* ptr, int currentTime)
+{
+	static_cast<QSequentialAnimationGroup*>(ptr)->updateCurrentTime(currentTime);
+}
+
+void QSequentialAnimationGroup_UpdateCurrentTimeDefault(void* ptr, int currentTime)
+{
+		static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::updateCurrentTime(currentTime);
+}
+
+void QSequentialAnimationGroup_DestroyQSequentialAnimationGroup(void* ptr)
+{
+	static_cast<QSequentialAnimationGroup*>(ptr)->~QSequentialAnimationGroup();
+}
+
+void* QSequentialAnimationGroup_CurrentAnimation(void* ptr)
+{
+	return static_cast<QSequentialAnimationGroup*>(ptr)->currentAnimation();
+}
+
+int QSequentialAnimationGroup_Duration(void* ptr)
+{
+	return static_cast<QSequentialAnimationGroup*>(ptr)->duration();
+}
+
+int QSequentialAnimationGroup_DurationDefault(void* ptr)
+{
+		return static_cast<QSequentialAnimationGroup*>(ptr)->QSequentialAnimationGroup::duration();
+}
+
+void* QSequentialIterable_At(void* ptr, int idx)
+{
+	return new QVariant(static_cast<QSequentialIterable*>(ptr)->at(idx));
+}
+
+char QSequentialIterable_CanReverseIterate(void* ptr)
+{
+	return static_cast<QSequentialIterable*>(ptr)->canReverseIterate();
+}
+
+int QSequentialIterable_Size(void* ptr)
+{
+	return static_cast<QSequentialIterable*>(ptr)->size();
+}
+
+class MyQSettings: public QSettings
+{
+public:
+	MyQSettings(Format format, Scope scope, const QString &organization, const QString &application, QObject *parent) : QSettings(format, scope, organization, application, parent) {};
+	MyQSettings(QObject *parent) : QSettings(parent) {};
+	MyQSettings(Scope scope, const QString &organization, const QString &application, QObject *parent) : QSettings(scope, organization, application, parent) {};
+	MyQSettings(const QString &fileName, Format format, QObject *parent) : QSettings(fileName, format, parent) {};
+	MyQSettings(const QString &organization, const QString &application, QObject *parent) : QSettings(organization, application, parent) {};
+	bool event(QEvent * event) { return callbackQObject_Event(this, event) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+long long QSettings_QSettings_DefaultFormat()
+{
+	return QSettings::defaultFormat();
+}
+
+void* QSettings_NewQSettings3(long long format, long long scope, char* organization, char* application, void* parent)
+{
+	return new MyQSettings(static_cast<QSettings::Format>(format), static_cast<QSettings::Scope>(scope), QString(organization), QString(application), static_cast<QObject*>(parent));
+}
+
+void* QSettings_NewQSettings5(void* parent)
+{
+	return new MyQSettings(static_cast<QObject*>(parent));
+}
+
+void* QSettings_NewQSettings2(long long scope, char* organization, char* application, void* parent)
+{
+	return new MyQSettings(static_cast<QSettings::Scope>(scope), QString(organization), QString(application), static_cast<QObject*>(parent));
+}
+
+void* QSettings_NewQSettings4(char* fileName, long long format, void* parent)
+{
+	return new MyQSettings(QString(fileName), static_cast<QSettings::Format>(format), static_cast<QObject*>(parent));
+}
+
+void* QSettings_NewQSettings(char* organization, char* application, void* parent)
+{
+	return new MyQSettings(QString(organization), QString(application), static_cast<QObject*>(parent));
+}
+
+int QSettings_BeginReadArray(void* ptr, char* prefix)
+{
+	return static_cast<QSettings*>(ptr)->beginReadArray(QString(prefix));
+}
+
+void QSettings_BeginGroup(void* ptr, char* prefix)
+{
+	static_cast<QSettings*>(ptr)->beginGroup(QString(prefix));
+}
+
+void QSettings_BeginWriteArray(void* ptr, char* prefix, int size)
+{
+	static_cast<QSettings*>(ptr)->beginWriteArray(QString(prefix), size);
+}
+
+void QSettings_Clear(void* ptr)
+{
+	static_cast<QSettings*>(ptr)->clear();
+}
+
+void QSettings_EndArray(void* ptr)
+{
+	static_cast<QSettings*>(ptr)->endArray();
+}
+
+void QSettings_EndGroup(void* ptr)
+{
+	static_cast<QSettings*>(ptr)->endGroup();
+}
+
+void QSettings_Remove(void* ptr, char* key)
+{
+	static_cast<QSettings*>(ptr)->remove(QString(key));
+}
+
+void QSettings_SetArrayIndex(void* ptr, int i)
+{
+	static_cast<QSettings*>(ptr)->setArrayIndex(i);
+}
+
+void QSettings_QSettings_SetDefaultFormat(long long format)
+{
+	QSettings::setDefaultFormat(static_cast<QSettings::Format>(format));
+}
+
+void QSettings_SetFallbacksEnabled(void* ptr, char b)
+{
+	static_cast<QSettings*>(ptr)->setFallbacksEnabled(b != 0);
+}
+
+void QSettings_SetIniCodec(void* ptr, void* codec)
+{
+	static_cast<QSettings*>(ptr)->setIniCodec(static_cast<QTextCodec*>(codec));
+}
+
+void QSettings_SetIniCodec2(void* ptr, char* codecName)
+{
+	static_cast<QSettings*>(ptr)->setIniCodec(const_cast<const char*>(codecName));
+}
+
+void QSettings_QSettings_SetPath(long long format, long long scope, char* path)
+{
+	QSettings::setPath(static_cast<QSettings::Format>(format), static_cast<QSettings::Scope>(scope), QString(path));
+}
+
+void QSettings_SetValue(void* ptr, char* key, void* value)
+{
+	static_cast<QSettings*>(ptr)->setValue(QString(key), *static_cast<QVariant*>(value));
+}
+
+void QSettings_Sync(void* ptr)
+{
+	static_cast<QSettings*>(ptr)->sync();
+}
+
+void QSettings_DestroyQSettings(void* ptr)
+{
+	static_cast<QSettings*>(ptr)->~QSettings();
+}
+
+long long QSettings_Format(void* ptr)
+{
+	return static_cast<QSettings*>(ptr)->format();
+}
+
+struct QtCore_PackedString QSettings_ApplicationName(void* ptr)
+{
+	return ({ QByteArray tbe59f0 = static_cast<QSettings*>(ptr)->applicationName().toUtf8(); QtCore_PackedString { const_cast<char*>(tbe59f0.prepend("WHITESPACE").constData()+10), tbe59f0.size()-10 }; });
+}
+
+struct QtCore_PackedString QSettings_FileName(void* ptr)
+{
+	return ({ QByteArray tb2013f = static_cast<QSettings*>(ptr)->fileName().toUtf8(); QtCore_PackedString { const_cast<char*>(tb2013f.prepend("WHITESPACE").constData()+10), tb2013f.size()-10 }; });
+}
+
+struct QtCore_PackedString QSettings_Group(void* ptr)
+{
+	return ({ QByteArray t8d2697 = static_cast<QSettings*>(ptr)->group().toUtf8(); QtCore_PackedString { const_cast<char*>(t8d2697.prepend("WHITESPACE").constData()+10), t8d2697.size()-10 }; });
+}
+
+struct QtCore_PackedString QSettings_OrganizationName(void* ptr)
+{
+	return ({ QByteArray t43251f = static_cast<QSettings*>(ptr)->organizationName().toUtf8(); QtCore_PackedString { const_cast<char*>(t43251f.prepend("WHITESPACE").constData()+10), t43251f.size()-10 }; });
+}
+
+struct QtCore_PackedString QSettings_AllKeys(void* ptr)
+{
+	return ({ long long t39d6f3len; char* t39d6f3 = goPackStringList(static_cast<QSettings*>(ptr)->allKeys(), &t39d6f3len); QtCore_PackedString { t39d6f3, t39d6f3len }; });
+}
+
+struct QtCore_PackedString QSettings_ChildGroups(void* ptr)
+{
+	return ({ long long t85b658len; char* t85b658 = goPackStringList(static_cast<QSettings*>(ptr)->childGroups(), &t85b658len); QtCore_PackedString { t85b658, t85b658len }; });
+}
+
+struct QtCore_PackedString QSettings_ChildKeys(void* ptr)
+{
+	return ({ long long t28840dlen; char* t28840d = goPackStringList(static_cast<QSettings*>(ptr)->childKeys(), &t28840dlen); QtCore_PackedString { t28840d, t28840dlen }; });
+}
+
+void* QSettings_IniCodec(void* ptr)
+{
+	return static_cast<QSettings*>(ptr)->iniCodec();
+}
+
+void* QSettings_Value(void* ptr, char* key, void* defaultValue)
+{
+	return new QVariant(static_cast<QSettings*>(ptr)->value(QString(key), *static_cast<QVariant*>(defaultValue)));
+}
+
+long long QSettings_Scope(void* ptr)
+{
+	return static_cast<QSettings*>(ptr)->scope();
+}
+
+long long QSettings_Status(void* ptr)
+{
+	return static_cast<QSettings*>(ptr)->status();
+}
+
+char QSettings_Contains(void* ptr, char* key)
+{
+	return static_cast<QSettings*>(ptr)->contains(QString(key));
+}
+
+char QSettings_FallbacksEnabled(void* ptr)
+{
+	return static_cast<QSettings*>(ptr)->fallbacksEnabled();
+}
+
+char QSettings_IsWritable(void* ptr)
+{
+	return static_cast<QSettings*>(ptr)->isWritable();
+}
+
+void* QSharedData_NewQSharedData()
+{
+	return new QSharedData();
+}
+
+void* QSharedData_NewQSharedDataInArena(void* arena)
+{
+	return new (goArenaAlloc<QSharedData>(arena)) QSharedData();
+}
+
+void* QSharedData_NewQSharedData2(void* other)
+{
+	return new QSharedData(*static_cast<QSharedData*>(other));
+}
+
+void* QSharedData_NewQSharedData2InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QSharedData>(arena)) QSharedData(*static_cast<QSharedData*>(other));
+}
+
+class MyQSharedMemory: public QSharedMemory
+{
+public:
+	MyQSharedMemory(QObject *parent) : QSharedMemory(parent) {};
+	MyQSharedMemory(const QString &key, QObject *parent) : QSharedMemory(key, parent) {};
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSharedMemory_NewQSharedMemory2(void* parent)
+{
+	return new MyQSharedMemory(static_cast<QObject*>(parent));
+}
+
+void* QSharedMemory_NewQSharedMemory(char* key, void* parent)
+{
+	return new MyQSharedMemory(QString(key), static_cast<QObject*>(parent));
+}
+
+char QSharedMemory_Attach(void* ptr, long long mode)
+{
+	return static_cast<QSharedMemory*>(ptr)->attach(static_cast<QSharedMemory::AccessMode>(mode));
+}
+
+char QSharedMemory_Create(void* ptr, int size, long long mode)
+{
+	return static_cast<QSharedMemory*>(ptr)->create(size, static_cast<QSharedMemory::AccessMode>(mode));
+}
+
+char QSharedMemory_Detach(void* ptr)
+{
+	return static_cast<QSharedMemory*>(ptr)->detach();
+}
+
+char QSharedMemory_Lock(void* ptr)
+{
+	return static_cast<QSharedMemory*>(ptr)->lock();
+}
+
+char QSharedMemory_Unlock(void* ptr)
+{
+	return static_cast<QSharedMemory*>(ptr)->unlock();
+}
+
+void* QSharedMemory_Data(void* ptr)
+{
+	return static_cast<QSharedMemory*>(ptr)->data();
+}
+
+void QSharedMemory_SetKey(void* ptr, char* key)
+{
+	static_cast<QSharedMemory*>(ptr)->setKey(QString(key));
+}
+
+void QSharedMemory_SetNativeKey(void* ptr, char* key)
+{
+	static_cast<QSharedMemory*>(ptr)->setNativeKey(QString(key));
+}
+
+void QSharedMemory_DestroyQSharedMemory(void* ptr)
+{
+	static_cast<QSharedMemory*>(ptr)->~QSharedMemory();
+}
+
+struct QtCore_PackedString QSharedMemory_ErrorString(void* ptr)
+{
+	return ({ QByteArray t1fb547 = static_cast<QSharedMemory*>(ptr)->errorString().toUtf8(); QtCore_PackedString { const_cast<char*>(t1fb547.prepend("WHITESPACE").constData()+10), t1fb547.size()-10 }; });
+}
+
+struct QtCore_PackedString QSharedMemory_Key(void* ptr)
+{
+	return ({ QByteArray t0bb3c9 = static_cast<QSharedMemory*>(ptr)->key().toUtf8(); QtCore_PackedString { const_cast<char*>(t0bb3c9.prepend("WHITESPACE").constData()+10), t0bb3c9.size()-10 }; });
+}
+
+struct QtCore_PackedString QSharedMemory_NativeKey(void* ptr)
+{
+	return ({ QByteArray t971b81 = static_cast<QSharedMemory*>(ptr)->nativeKey().toUtf8(); QtCore_PackedString { const_cast<char*>(t971b81.prepend("WHITESPACE").constData()+10), t971b81.size()-10 }; });
+}
+
+long long QSharedMemory_Error(void* ptr)
+{
+	return static_cast<QSharedMemory*>(ptr)->error();
+}
+
+char QSharedMemory_IsAttached(void* ptr)
+{
+	return static_cast<QSharedMemory*>(ptr)->isAttached();
+}
+
+void* QSharedMemory_ConstData(void* ptr)
+{
+	return const_cast<void*>(static_cast<QSharedMemory*>(ptr)->constData());
+}
+
+void* QSharedMemory_Data2(void* ptr)
+{
+	return const_cast<void*>(static_cast<QSharedMemory*>(ptr)->data());
+}
+
+int QSharedMemory_Size(void* ptr)
+{
+	return static_cast<QSharedMemory*>(ptr)->size();
+}
+
+void* QSignalBlocker_NewQSignalBlocker2(void* object)
+{
+	return new QSignalBlocker(*static_cast<QObject*>(object));
+}
+
+void* QSignalBlocker_NewQSignalBlocker2InArena(void* arena, void* object)
+{
+	return new (goArenaAlloc<QSignalBlocker>(arena)) QSignalBlocker(*static_cast<QObject*>(object));
+}
+
+void* QSignalBlocker_NewQSignalBlocker(void* object)
+{
+	return new QSignalBlocker(static_cast<QObject*>(object));
+}
+
+void* QSignalBlocker_NewQSignalBlockerInArena(void* arena, void* object)
+{
+	return new (goArenaAlloc<QSignalBlocker>(arena)) QSignalBlocker(static_cast<QObject*>(object));
+}
+
+void QSignalBlocker_Reblock(void* ptr)
+{
+	static_cast<QSignalBlocker*>(ptr)->reblock();
+}
+
+void QSignalBlocker_Unblock(void* ptr)
+{
+	static_cast<QSignalBlocker*>(ptr)->unblock();
+}
+
+void QSignalBlocker_DestroyQSignalBlocker(void* ptr)
+{
+	static_cast<QSignalBlocker*>(ptr)->~QSignalBlocker();
+}
+
+class MyQSignalMapper: public QSignalMapper
+{
+public:
+	MyQSignalMapper(QObject *parent) : QSignalMapper(parent) {};
+	void map() { callbackQSignalMapper_Map(this); };
+	void map(QObject * sender) { callbackQSignalMapper_Map2(this, sender); };
+	void Signal_Mapped4(QObject * object) { callbackQSignalMapper_Mapped4(this, object); };
+	void Signal_Mapped3(QWidget * widget) { callbackQSignalMapper_Mapped3(this, widget); };
+	void Signal_Mapped2(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtCore_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQSignalMapper_Mapped2(this, textPacked); };
+	void Signal_Mapped(int i) { callbackQSignalMapper_Mapped(this, i); };
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSignalMapper_NewQSignalMapper(void* parent)
+{
+	return new MyQSignalMapper(static_cast<QObject*>(parent));
+}
+
+void QSignalMapper_Map(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QSignalMapper*>(ptr), "map");
+}
+
+void QSignalMapper_MapDefault(void* ptr)
+{
+		static_cast<QSignalMapper*>(ptr)->QSignalMapper::map();
+}
+
+void QSignalMapper_Map2(void* ptr, void* sender)
+{
+	QMetaObject::invokeMethod(static_cast<QSignalMapper*>(ptr), "map", Q_ARG(QObject*, static_cast<QObject*>(sender)));
+}
+
+void QSignalMapper_Map2Default(void* ptr, void* sender)
+{
+		static_cast<QSignalMapper*>(ptr)->QSignalMapper::map(static_cast<QObject*>(sender));
+}
+
+void QSignalMapper_ConnectMapped4(void* ptr)
+{
+	QObject::connect(static_cast<QSignalMapper*>(ptr), static_cast<void (QSignalMapper::*)(QObject *)>(&QSignalMapper::mapped), static_cast<MyQSignalMapper*>(ptr), static_cast<void (MyQSignalMapper::*)(QObject *)>(&MyQSignalMapper::Signal_Mapped4));
+}
+
+void QSignalMapper_DisconnectMapped4(void* ptr)
+{
+	QObject::disconnect(static_cast<QSignalMapper*>(ptr), static_cast<void (QSignalMapper::*)(QObject *)>(&QSignalMapper::mapped), static_cast<MyQSignalMapper*>(ptr), static_cast<void (MyQSignalMapper::*)(QObject *)>(&MyQSignalMapper::Signal_Mapped4));
+}
+
+void QSignalMapper_Mapped4(void* ptr, void* object)
+{
+	static_cast<QSignalMapper*>(ptr)->mapped(static_cast<QObject*>(object));
+}
+
+void QSignalMapper_ConnectMapped3(void* ptr)
+{
+	QObject::connect(static_cast<QSignalMapper*>(ptr), static_cast<void (QSignalMapper::*)(QWidget *)>(&QSignalMapper::mapped), static_cast<MyQSignalMapper*>(ptr), static_cast<void (MyQSignalMapper::*)(QWidget *)>(&MyQSignalMapper::Signal_Mapped3));
+}
+
+void QSignalMapper_DisconnectMapped3(void* ptr)
+{
+	QObject::disconnect(static_cast<QSignalMapper*>(ptr), static_cast<void (QSignalMapper::*)(QWidget *)>(&QSignalMapper::mapped), static_cast<MyQSignalMapper*>(ptr), static_cast<void (MyQSignalMapper::*)(QWidget *)>(&MyQSignalMapper::Signal_Mapped3));
+}
+
+void QSignalMapper_Mapped3(void* ptr, void* widget)
+{
+	static_cast<QSignalMapper*>(ptr)->mapped(static_cast<QWidget*>(widget));
+}
+
+void QSignalMapper_ConnectMapped2(void* ptr)
+{
+	QObject::connect(static_cast<QSignalMapper*>(ptr), static_cast<void (QSignalMapper::*)(const QString &)>(&QSignalMapper::mapped), static_cast<MyQSignalMapper*>(ptr), static_cast<void (MyQSignalMapper::*)(const QString &)>(&MyQSignalMapper::Signal_Mapped2));
+}
+
+void QSignalMapper_DisconnectMapped2(void* ptr)
+{
+	QObject::disconnect(static_cast<QSignalMapper*>(ptr), static_cast<void (QSignalMapper::*)(const QString &)>(&QSignalMapper::mapped), static_cast<MyQSignalMapper*>(ptr), static_cast<void (MyQSignalMapper::*)(const QString &)>(&MyQSignalMapper::Signal_Mapped2));
+}
+
+void QSignalMapper_Mapped2(void* ptr, char* text)
+{
+	static_cast<QSignalMapper*>(ptr)->mapped(QString(text));
+}
+
+void QSignalMapper_ConnectMapped(void* ptr)
+{
+	QObject::connect(static_cast<QSignalMapper*>(ptr), static_cast<void (QSignalMapper::*)(int)>(&QSignalMapper::mapped), static_cast<MyQSignalMapper*>(ptr), static_cast<void (MyQSignalMapper::*)(int)>(&MyQSignalMapper::Signal_Mapped));
+}
+
+void QSignalMapper_DisconnectMapped(void* ptr)
+{
+	QObject::disconnect(static_cast<QSignalMapper*>(ptr), static_cast<void (QSignalMapper::*)(int)>(&QSignalMapper::mapped), static_cast<MyQSignalMapper*>(ptr), static_cast<void (MyQSignalMapper::*)(int)>(&MyQSignalMapper::Signal_Mapped));
+}
+
+void QSignalMapper_Mapped(void* ptr, int i)
+{
+	static_cast<QSignalMapper*>(ptr)->mapped(i);
+}
+
+void QSignalMapper_RemoveMappings(void* ptr, void* sender)
+{
+	static_cast<QSignalMapper*>(ptr)->removeMappings(static_cast<QObject*>(sender));
+}
+
+void QSignalMapper_SetMapping4(void* ptr, void* sender, void* object)
+{
+	static_cast<QSignalMapper*>(ptr)->setMapping(static_cast<QObject*>(sender), static_cast<QObject*>(object));
+}
+
+void QSignalMapper_SetMapping3(void* ptr, void* sender, void* widget)
+{
+	static_cast<QSignalMapper*>(ptr)->setMapping(static_cast<QObject*>(sender), static_cast<QWidget*>(widget));
+}
+
+void QSignalMapper_SetMapping2(void* ptr, void* sender, char* text)
+{
+	static_cast<QSignalMapper*>(ptr)->setMapping(static_cast<QObject*>(sender), QString(text));
+}
+
+void QSignalMapper_SetMapping(void* ptr, void* sender, int id)
+{
+	static_cast<QSignalMapper*>(ptr)->setMapping(static_cast<QObject*>(sender), id);
+}
+
+void QSignalMapper_DestroyQSignalMapper(void* ptr)
+{
+	static_cast<QSignalMapper*>(ptr)->~QSignalMapper();
+}
+
+void* QSignalMapper_Mapping4(void* ptr, void* object)
+{
+	return static_cast<QSignalMapper*>(ptr)->mapping(static_cast<QObject*>(object));
+}
+
+void* QSignalMapper_Mapping3(void* ptr, void* widget)
+{
+	return static_cast<QSignalMapper*>(ptr)->mapping(static_cast<QWidget*>(widget));
+}
+
+void* QSignalMapper_Mapping2(void* ptr, char* id)
+{
+	return static_cast<QSignalMapper*>(ptr)->mapping(QString(id));
+}
+
+void* QSignalMapper_Mapping(void* ptr, int id)
+{
+	return static_cast<QSignalMapper*>(ptr)->mapping(id);
+}
+
+class MyQSignalTransition: public QSignalTransition
+{
+public:
+	MyQSignalTransition(QState *sourceState) : QSignalTransition(sourceState) {};
+	MyQSignalTransition(const QObject *sender, const char *signal, QState *sourceState) : QSignalTransition(sender, signal, sourceState) {};
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventTest(QEvent * event) { return callbackQSignalTransition_EventTest(this, event) != 0; };
+	void onTransition(QEvent * event) { callbackQSignalTransition_OnTransition(this, event); };
+	void Signal_SenderObjectChanged() { callbackQSignalTransition_SenderObjectChanged(this); };
+	void Signal_SignalChanged() { callbackQSignalTransition_SignalChanged(this); };
+	void Signal_TargetStateChanged() { callbackQAbstractTransition_TargetStateChanged(this); };
+	void Signal_TargetStatesChanged() { callbackQAbstractTransition_TargetStatesChanged(this); };
+	void Signal_Triggered() { callbackQAbstractTransition_Triggered(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSignalTransition_NewQSignalTransition(void* sourceState)
+{
+	return new MyQSignalTransition(static_cast<QState*>(sourceState));
+}
+
+void* QSignalTransition_NewQSignalTransition2(void* sender, char* sign, void* sourceState)
+{
+	return new MyQSignalTransition(static_cast<QObject*>(sender), const_cast<const char*>(sign), static_cast<QState*>(sourceState));
+}
+
+char QSignalTransition_EventTest(void* ptr, void* event)
+{
+	return static_cast<QSignalTransition*>(ptr)->eventTest(static_cast<QEvent*>(event));
+}
+
+char QSignalTransition_EventTestDefault(void* ptr, void* event)
+{
+		return static_cast<QSignalTransition*>(ptr)->QSignalTransition::eventTest(static_cast<QEvent*>(event));
+}
+
+void QSignalTransition_OnTransition(void* ptr, void* event)
+{
+	static_cast<QSignalTransition*>(ptr)->onTransition(static_cast<QEvent*>(event));
+}
+
+void QSignalTransition_OnTransitionDefault(void* ptr, void* event)
+{
+		static_cast<QSignalTransition*>(ptr)->QSignalTransition::onTransition(static_cast<QEvent*>(event));
+}
+
+void QSignalTransition_ConnectSenderObjectChanged(void* ptr)
+{
+	QObject::connect(static_cast<QSignalTransition*>(ptr), &QSignalTransition::senderObjectChanged, static_cast<MyQSignalTransition*>(ptr), static_cast<void (MyQSignalTransition::*)()>(&MyQSignalTransition::Signal_SenderObjectChanged));
+}
+
+void QSignalTransition_DisconnectSenderObjectChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QSignalTransition*>(ptr), &QSignalTransition::senderObjectChanged, static_cast<MyQSignalTransition*>(ptr), static_cast<void (MyQSignalTransition::*)()>(&MyQSignalTransition::Signal_SenderObjectChanged));
+}
+
+void QSignalTransition_SetSenderObject(void* ptr, void* sender)
+{
+	static_cast<QSignalTransition*>(ptr)->setSenderObject(static_cast<QObject*>(sender));
+}
+
+void QSignalTransition_SetSignal(void* ptr, void* sign)
+{
+	static_cast<QSignalTransition*>(ptr)->setSignal(*static_cast<QByteArray*>(sign));
+}
+
+void QSignalTransition_ConnectSignalChanged(void* ptr)
+{
+	QObject::connect(static_cast<QSignalTransition*>(ptr), &QSignalTransition::signalChanged, static_cast<MyQSignalTransition*>(ptr), static_cast<void (MyQSignalTransition::*)()>(&MyQSignalTransition::Signal_SignalChanged));
+}
+
+void QSignalTransition_DisconnectSignalChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QSignalTransition*>(ptr), &QSignalTransition::signalChanged, static_cast<MyQSignalTransition*>(ptr), static_cast<void (MyQSignalTransition::*)()>(&MyQSignalTransition::Signal_SignalChanged));
+}
+
+void QSignalTransition_DestroyQSignalTransition(void* ptr)
+{
+	static_cast<QSignalTransition*>(ptr)->~QSignalTransition();
+}
+
+void* QSignalTransition_Signal(void* ptr)
+{
+	return new QByteArray(static_cast<QSignalTransition*>(ptr)->signal());
+}
+
+void* QSignalTransition_SenderObject(void* ptr)
+{
+	return static_cast<QSignalTransition*>(ptr)->senderObject();
+}
+
+void* QSize_NewQSize()
+{
+	return new QSize();
+}
+
+void* QSize_NewQSizeInArena(void* arena)
+{
+	return new (goArenaAlloc<QSize>(arena)) QSize();
+}
+
+void* QSize_NewQSize2(int width, int height)
+{
+	return new QSize(width, height);
+}
+
+void* QSize_NewQSize2InArena(void* arena, int width, int height)
+{
+	return new (goArenaAlloc<QSize>(arena)) QSize(width, height);
+}
+
+int QSize_Rheight(void* ptr)
+{
+	return static_cast<QSize*>(ptr)->rheight();
+}
+
+int QSize_Rwidth(void* ptr)
+{
+	return static_cast<QSize*>(ptr)->rwidth();
+}
+
+void QSize_Scale2(void* ptr, void* size, long long mode)
+{
+	static_cast<QSize*>(ptr)->scale(*static_cast<QSize*>(size), static_cast<Qt::AspectRatioMode>(mode));
+}
+
+void QSize_Scale(void* ptr, int width, int height, long long mode)
+{
+	static_cast<QSize*>(ptr)->scale(width, height, static_cast<Qt::AspectRatioMode>(mode));
+}
+
+void QSize_SetHeight(void* ptr, int height)
+{
+	static_cast<QSize*>(ptr)->setHeight(height);
+}
+
+void QSize_SetWidth(void* ptr, int width)
+{
+	static_cast<QSize*>(ptr)->setWidth(width);
+}
+
+void QSize_Transpose(void* ptr)
+{
+	static_cast<QSize*>(ptr)->transpose();
+}
+
+void* QSize_BoundedTo(void* ptr, void* otherSize)
+{
+	return ({ QSize tmpValue = static_cast<QSize*>(ptr)->boundedTo(*static_cast<QSize*>(otherSize)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSize_ExpandedTo(void* ptr, void* otherSize)
+{
+	return ({ QSize tmpValue = static_cast<QSize*>(ptr)->expandedTo(*static_cast<QSize*>(otherSize)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSize_Scaled2(void* ptr, void* s, long long mode)
+{
+	return ({ QSize tmpValue = static_cast<QSize*>(ptr)->scaled(*static_cast<QSize*>(s), static_cast<Qt::AspectRatioMode>(mode)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSize_Scaled(void* ptr, int width, int height, long long mode)
+{
+	return ({ QSize tmpValue = static_cast<QSize*>(ptr)->scaled(width, height, static_cast<Qt::AspectRatioMode>(mode)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSize_Transposed(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QSize*>(ptr)->transposed(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+char QSize_IsEmpty(void* ptr)
+{
+	return static_cast<QSize*>(ptr)->isEmpty();
+}
+
+char QSize_IsNull(void* ptr)
+{
+	return static_cast<QSize*>(ptr)->isNull();
+}
+
+char QSize_IsValid(void* ptr)
+{
+	return static_cast<QSize*>(ptr)->isValid();
+}
+
+int QSize_Height(void* ptr)
+{
+	return static_cast<QSize*>(ptr)->height();
+}
+
+int QSize_Width(void* ptr)
+{
+	return static_cast<QSize*>(ptr)->width();
+}
+
+void* QSizeF_NewQSizeF()
+{
+	return new QSizeF();
+}
+
+void* QSizeF_NewQSizeFInArena(void* arena)
+{
+	return new (goArenaAlloc<QSizeF>(arena)) QSizeF();
+}
+
+void* QSizeF_NewQSizeF2(void* size)
+{
+	return new QSizeF(*static_cast<QSize*>(size));
+}
+
+void* QSizeF_NewQSizeF2InArena(void* arena, void* size)
+{
+	return new (goArenaAlloc<QSizeF>(arena)) QSizeF(*static_cast<QSize*>(size));
+}
+
+void* QSizeF_NewQSizeF3(double width, double height)
+{
+	return new QSizeF(width, height);
+}
+
+void* QSizeF_NewQSizeF3InArena(void* arena, double width, double height)
+{
+	return new (goArenaAlloc<QSizeF>(arena)) QSizeF(width, height);
+}
+
+double QSizeF_Rheight(void* ptr)
+{
+	return static_cast<QSizeF*>(ptr)->rheight();
+}
+
+double QSizeF_Rwidth(void* ptr)
+{
+	return static_cast<QSizeF*>(ptr)->rwidth();
+}
+
+void QSizeF_Scale2(void* ptr, void* size, long long mode)
+{
+	static_cast<QSizeF*>(ptr)->scale(*static_cast<QSizeF*>(size), static_cast<Qt::AspectRatioMode>(mode));
+}
+
+void QSizeF_Scale(void* ptr, double width, double height, long long mode)
+{
+	static_cast<QSizeF*>(ptr)->scale(width, height, static_cast<Qt::AspectRatioMode>(mode));
+}
+
+void QSizeF_SetHeight(void* ptr, double height)
+{
+	static_cast<QSizeF*>(ptr)->setHeight(height);
+}
+
+void QSizeF_SetWidth(void* ptr, double width)
+{
+	static_cast<QSizeF*>(ptr)->setWidth(width);
+}
+
+void QSizeF_Transpose(void* ptr)
+{
+	static_cast<QSizeF*>(ptr)->transpose();
+}
+
+void* QSizeF_ToSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QSizeF*>(ptr)->toSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSizeF_BoundedTo(void* ptr, void* otherSize)
+{
+	return ({ QSizeF tmpValue = static_cast<QSizeF*>(ptr)->boundedTo(*static_cast<QSizeF*>(otherSize)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSizeF_ExpandedTo(void* ptr, void* otherSize)
+{
+	return ({ QSizeF tmpValue = static_cast<QSizeF*>(ptr)->expandedTo(*static_cast<QSizeF*>(otherSize)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSizeF_Scaled2(void* ptr, void* s, long long mode)
+{
+	return ({ QSizeF tmpValue = static_cast<QSizeF*>(ptr)->scaled(*static_cast<QSizeF*>(s), static_cast<Qt::AspectRatioMode>(mode)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSizeF_Scaled(void* ptr, double width, double height, long long mode)
+{
+	return ({ QSizeF tmpValue = static_cast<QSizeF*>(ptr)->scaled(width, height, static_cast<Qt::AspectRatioMode>(mode)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSizeF_Transposed(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QSizeF*>(ptr)->transposed(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+char QSizeF_IsEmpty(void* ptr)
+{
+	return static_cast<QSizeF*>(ptr)->isEmpty();
+}
+
+char QSizeF_IsNull(void* ptr)
+{
+	return static_cast<QSizeF*>(ptr)->isNull();
+}
+
+char QSizeF_IsValid(void* ptr)
+{
+	return static_cast<QSizeF*>(ptr)->isValid();
+}
+
+double QSizeF_Height(void* ptr)
+{
+	return static_cast<QSizeF*>(ptr)->height();
+}
+
+double QSizeF_Width(void* ptr)
+{
+	return static_cast<QSizeF*>(ptr)->width();
+}
+
+class MyQSocketNotifier: public QSocketNotifier
+{
+public:
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	void Signal_Activated(int socket) { callbackQSocketNotifier_Activated(this, socket); };
+	void setEnabled(bool enable) { callbackQSocketNotifier_SetEnabled(this, enable); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QSocketNotifier_ConnectActivated(void* ptr)
+{
+	QObject::connect(static_cast<QSocketNotifier*>(ptr), &QSocketNotifier::activated, static_cast<MyQSocketNotifier*>(ptr), static_cast<void (MyQSocketNotifier::*)(int)>(&MyQSocketNotifier::Signal_Activated));
+}
+
+void QSocketNotifier_DisconnectActivated(void* ptr)
+{
+	QObject::disconnect(static_cast<QSocketNotifier*>(ptr), &QSocketNotifier::activated, static_cast<MyQSocketNotifier*>(ptr), static_cast<void (MyQSocketNotifier::*)(int)>(&MyQSocketNotifier::Signal_Activated));
+}
+
+void QSocketNotifier_SetEnabled(void* ptr, char enable)
+{
+	QMetaObject::invokeMethod(static_cast<QSocketNotifier*>(ptr), "setEnabled", Q_ARG(bool, enable != 0));
+}
+
+void QSocketNotifier_SetEnabledDefault(void* ptr, char enable)
+{
+		static_cast<QSocketNotifier*>(ptr)->QSocketNotifier::setEnabled(enable != 0);
+}
+
+void QSocketNotifier_DestroyQSocketNotifier(void* ptr)
+{
+	static_cast<QSocketNotifier*>(ptr)->~QSocketNotifier();
+}
+
+long long QSocketNotifier_Type(void* ptr)
+{
+	return static_cast<QSocketNotifier*>(ptr)->type();
+}
+
+char QSocketNotifier_IsEnabled(void* ptr)
+{
+	return static_cast<QSocketNotifier*>(ptr)->isEnabled();
+}
+
+class MyQSortFilterProxyModel: public QSortFilterProxyModel
+{
+public:
+	MyQSortFilterProxyModel(QObject *parent) : QSortFilterProxyModel(parent) {};
+	bool dropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) { return callbackQAbstractItemModel_DropMimeData(this, const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool insertColumns(int column, int count, const QModelIndex & parent) { return callbackQAbstractItemModel_InsertColumns(this, column, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool insertRows(int row, int count, const QModelIndex & parent) { return callbackQAbstractItemModel_InsertRows(this, row, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool removeColumns(int column, int count, const QModelIndex & parent) { return callbackQAbstractItemModel_RemoveColumns(this, column, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool removeRows(int row, int count, const QModelIndex & parent) { return callbackQAbstractItemModel_RemoveRows(this, row, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool setData(const QModelIndex & index, const QVariant & value, int role) { return callbackQAbstractItemModel_SetData(this, const_cast<QModelIndex*>(&index), const_cast<QVariant*>(&value), role) != 0; };
+	bool setHeaderData(int section, Qt::Orientation orientation, const QVariant & value, int role) { return callbackQAbstractItemModel_SetHeaderData(this, section, orientation, const_cast<QVariant*>(&value), role) != 0; };
+	void fetchMore(const QModelIndex & parent) { callbackQAbstractItemModel_FetchMore(this, const_cast<QModelIndex*>(&parent)); };
+	void invalidate() { callbackQSortFilterProxyModel_Invalidate(this); };
+	void setFilterFixedString(const QString & pattern) { QByteArray t91cc2e = pattern.toUtf8(); QtCore_PackedString patternPacked = { const_cast<char*>(t91cc2e.prepend("WHITESPACE").constData()+10), t91cc2e.size()-10 };callbackQSortFilterProxyModel_SetFilterFixedString(this, patternPacked); };
+	void setFilterRegExp(const QString & pattern) { QByteArray t91cc2e = pattern.toUtf8(); QtCore_PackedString patternPacked = { const_cast<char*>(t91cc2e.prepend("WHITESPACE").constData()+10), t91cc2e.size()-10 };callbackQSortFilterProxyModel_SetFilterRegExp2(this, patternPacked); };
+	void setFilterWildcard(const QString & pattern) { QByteArray t91cc2e = pattern.toUtf8(); QtCore_PackedString patternPacked = { const_cast<char*>(t91cc2e.prepend("WHITESPACE").constData()+10), t91cc2e.size()-10 };callbackQSortFilterProxyModel_SetFilterWildcard(this, patternPacked); };
+	void setSourceModel(QAbstractItemModel * sourceModel) { callbackQAbstractProxyModel_SetSourceModel(this, sourceModel); };
+	void sort(int column, Qt::SortOrder order) { callbackQAbstractItemModel_Sort(this, column, order); };
+	QItemSelection mapSelectionFromSource(const QItemSelection & sourceSelection) const { return *static_cast<QItemSelection*>(callbackQAbstractProxyModel_MapSelectionFromSource(const_cast<void*>(static_cast<const void*>(this)), const_cast<QItemSelection*>(&sourceSelection))); };
+	QItemSelection mapSelectionToSource(const QItemSelection & proxySelection) const { return *static_cast<QItemSelection*>(callbackQAbstractProxyModel_MapSelectionToSource(const_cast<void*>(static_cast<const void*>(this)), const_cast<QItemSelection*>(&proxySelection))); };
+	QMimeData * mimeData(const QModelIndexList & indexes) const { return static_cast<QMimeData*>(callbackQAbstractItemModel_MimeData(const_cast<void*>(static_cast<const void*>(this)), ({ QList<QModelIndex>* tmpValue = new QList<QModelIndex>(indexes); QtCore_PackedList { tmpValue, tmpValue->size() }; }))); };
+	QModelIndex buddy(const QModelIndex & index) const { return *static_cast<QModelIndex*>(callbackQAbstractItemModel_Buddy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QModelIndex index(int row, int column, const QModelIndex & parent) const { return *static_cast<QModelIndex*>(callbackQSortFilterProxyModel_Index(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&parent))); };
+	QModelIndex mapFromSource(const QModelIndex & sourceIndex) const { return *static_cast<QModelIndex*>(callbackQSortFilterProxyModel_MapFromSource(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&sourceIndex))); };
+	QModelIndex mapToSource(const QModelIndex & proxyIndex) const { return *static_cast<QModelIndex*>(callbackQSortFilterProxyModel_MapToSource(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&proxyIndex))); };
+	QModelIndex parent(const QModelIndex & child) const { return *static_cast<QModelIndex*>(callbackQSortFilterProxyModel_Parent(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&child))); };
+	QModelIndex sibling(int row, int column, const QModelIndex & idx) const { return *static_cast<QModelIndex*>(callbackQAbstractItemModel_Sibling(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&idx))); };
+	QList<QModelIndex> match(const QModelIndex & start, int role, const QVariant & value, int hits, Qt::MatchFlags flags) const { return *static_cast<QList<QModelIndex>*>(callbackQAbstractItemModel_Match(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&start), role, const_cast<QVariant*>(&value), hits, flags)); };
+	QSize span(const QModelIndex & index) const { return *static_cast<QSize*>(callbackQAbstractItemModel_Span(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QStringList mimeTypes() const { char* tmp = callbackQAbstractItemModel_MimeTypes(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
+	QVariant data(const QModelIndex & index, int role) const { QVariant ret; callbackQAbstractProxyModel_Data(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), role, &ret); return ret; };
+	QVariant headerData(int section, Qt::Orientation orientation, int role) const { return *static_cast<QVariant*>(callbackQAbstractItemModel_HeaderData(const_cast<void*>(static_cast<const void*>(this)), section, orientation, role)); };
+	Qt::DropActions supportedDropActions() const { return static_cast<Qt::DropAction>(callbackQAbstractItemModel_SupportedDropActions(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::ItemFlags flags(const QModelIndex & index) const { return static_cast<Qt::ItemFlag>(callbackQAbstractItemModel_Flags(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	bool canFetchMore(const QModelIndex & parent) const { return callbackQAbstractItemModel_CanFetchMore(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)) != 0; };
+	bool filterAcceptsColumn(int source_column, const QModelIndex & source_parent) const { return callbackQSortFilterProxyModel_FilterAcceptsColumn(const_cast<void*>(static_cast<const void*>(this)), source_column, const_cast<QModelIndex*>(&source_parent)) != 0; };
+	bool filterAcceptsRow(int source_row, const QModelIndex & source_parent) const { return callbackQSortFilterProxyModel_FilterAcceptsRow(const_cast<void*>(static_cast<const void*>(this)), source_row, const_cast<QModelIndex*>(&source_parent)) != 0; };
+	bool hasChildren(const QModelIndex & parent) const { return callbackQAbstractItemModel_HasChildren(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)) != 0; };
+	bool lessThan(const QModelIndex & source_left, const QModelIndex & source_right) const { return callbackQSortFilterProxyModel_LessThan(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&source_left), const_cast<QModelIndex*>(&source_right)) != 0; };
+	int columnCount(const QModelIndex & parent) const { return callbackQSortFilterProxyModel_ColumnCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
+	int rowCount(const QModelIndex & parent) const { return callbackQSortFilterProxyModel_RowCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
+	bool setItemData(const QModelIndex & index, const QMap<int, QVariant> & roles) { return callbackQAbstractItemModel_SetItemData(this, const_cast<QModelIndex*>(&index), ({ QMap<int, QVariant>* tmpValue = const_cast<QMap<int, QVariant>*>(&roles); QtCore_PackedList { tmpValue, tmpValue->size() }; })) != 0; };
+	bool submit() { return callbackQAbstractProxyModel_Submit(this) != 0; };
+	void resetInternalData() { callbackQAbstractItemModel_ResetInternalData(this); };
+	void revert() { callbackQAbstractProxyModel_Revert(this); };
+	void Signal_SourceModelChanged() { callbackQAbstractProxyModel_SourceModelChanged(this); };
+	QMap<int, QVariant> itemData(const QModelIndex & proxyIndex) const { return *static_cast<QMap<int, QVariant>*>(callbackQAbstractItemModel_ItemData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&proxyIndex))); };
+	Qt::DropActions supportedDragActions() const { return static_cast<Qt::DropAction>(callbackQAbstractItemModel_SupportedDragActions(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool canDropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) const { return callbackQAbstractItemModel_CanDropMimeData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool moveColumns(const QModelIndex & sourceParent, int sourceColumn, int count, const QModelIndex & destinationParent, int destinationChild) { return callbackQAbstractItemModel_MoveColumns(this, const_cast<QModelIndex*>(&sourceParent), sourceColumn, count, const_cast<QModelIndex*>(&destinationParent), destinationChild) != 0; };
+	bool moveRows(const QModelIndex & sourceParent, int sourceRow, int count, const QModelIndex & destinationParent, int destinationChild) { return callbackQAbstractItemModel_MoveRows(this, const_cast<QModelIndex*>(&sourceParent), sourceRow, count, const_cast<QModelIndex*>(&destinationParent), destinationChild) != 0; };
+	void Signal_ColumnsAboutToBeInserted(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_ColumnsAboutToBeInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsAboutToBeMoved(const QModelIndex & sourceParent, int sourceStart, int sourceEnd, const QModelIndex & destinationParent, int destinationColumn) { callbackQAbstractItemModel_ColumnsAboutToBeMoved(this, const_cast<QModelIndex*>(&sourceParent), sourceStart, sourceEnd, const_cast<QModelIndex*>(&destinationParent), destinationColumn); };
+	void Signal_ColumnsAboutToBeRemoved(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_ColumnsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsInserted(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_ColumnsInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsMoved(const QModelIndex & parent, int start, int end, const QModelIndex & destination, int column) { callbackQAbstractItemModel_ColumnsMoved(this, const_cast<QModelIndex*>(&parent), start, end, const_cast<QModelIndex*>(&destination), column); };
+	void Signal_ColumnsRemoved(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_ColumnsRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_DataChanged(const QModelIndex & topLeft, const QModelIndex & bottomRight, const QVector<int> & roles) { callbackQAbstractItemModel_DataChanged(this, const_cast<QModelIndex*>(&topLeft), const_cast<QModelIndex*>(&bottomRight), ({ QVector<int>* tmpValue = const_cast<QVector<int>*>(&roles); QtCore_PackedList { tmpValue, tmpValue->size() }; })); };
+	void Signal_HeaderDataChanged(Qt::Orientation orientation, int first, int last) { callbackQAbstractItemModel_HeaderDataChanged(this, orientation, first, last); };
+	void Signal_LayoutAboutToBeChanged(const QList<QPersistentModelIndex> & parents, QAbstractItemModel::LayoutChangeHint hint) { callbackQAbstractItemModel_LayoutAboutToBeChanged(this, ({ QList<QPersistentModelIndex>* tmpValue = const_cast<QList<QPersistentModelIndex>*>(&parents); QtCore_PackedList { tmpValue, tmpValue->size() }; }), hint); };
+	void Signal_LayoutChanged(const QList<QPersistentModelIndex> & parents, QAbstractItemModel::LayoutChangeHint hint) { callbackQAbstractItemModel_LayoutChanged(this, ({ QList<QPersistentModelIndex>* tmpValue = const_cast<QList<QPersistentModelIndex>*>(&parents); QtCore_PackedList { tmpValue, tmpValue->size() }; }), hint); };
+	void Signal_ModelAboutToBeReset() { callbackQAbstractItemModel_ModelAboutToBeReset(this); };
+	void Signal_ModelReset() { callbackQAbstractItemModel_ModelReset(this); };
+	void Signal_RowsAboutToBeInserted(const QModelIndex & parent, int start, int end) { callbackQAbstractItemModel_RowsAboutToBeInserted(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void Signal_RowsAboutToBeMoved(const QModelIndex & sourceParent, int sourceStart, int sourceEnd, const QModelIndex & destinationParent, int destinationRow) { callbackQAbstractItemModel_RowsAboutToBeMoved(this, const_cast<QModelIndex*>(&sourceParent), sourceStart, sourceEnd, const_cast<QModelIndex*>(&destinationParent), destinationRow); };
+	void Signal_RowsAboutToBeRemoved(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_RowsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_RowsInserted(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_RowsInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_RowsMoved(const QModelIndex & parent, int start, int end, const QModelIndex & destination, int row) { callbackQAbstractItemModel_RowsMoved(this, const_cast<QModelIndex*>(&parent), start, end, const_cast<QModelIndex*>(&destination), row); };
+	void Signal_RowsRemoved(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_RowsRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	QHash<int, QByteArray> roleNames() const { return *static_cast<QHash<int, QByteArray>*>(callbackQAbstractItemModel_RoleNames(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSortFilterProxyModel_NewQSortFilterProxyModel(void* parent)
+{
+	return new MyQSortFilterProxyModel(static_cast<QObject*>(parent));
+}
+
+void QSortFilterProxyModel_Invalidate(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QSortFilterProxyModel*>(ptr), "invalidate");
+}
+
+void QSortFilterProxyModel_InvalidateDefault(void* ptr)
+{
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::invalidate();
+}
+
+void QSortFilterProxyModel_InvalidateFilter(void* ptr)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->invalidateFilter();
+}
+
+void QSortFilterProxyModel_SetDynamicSortFilter(void* ptr, char enable)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->setDynamicSortFilter(enable != 0);
+}
+
+void QSortFilterProxyModel_SetFilterCaseSensitivity(void* ptr, long long cs)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->setFilterCaseSensitivity(static_cast<Qt::CaseSensitivity>(cs));
+}
+
+void QSortFilterProxyModel_SetFilterFixedString(void* ptr, char* pattern)
+{
+	QMetaObject::invokeMethod(static_cast<QSortFilterProxyModel*>(ptr), "setFilterFixedString", Q_ARG(QString, QString(pattern)));
+}
+
+void QSortFilterProxyModel_SetFilterFixedStringDefault(void* ptr, char* pattern)
+{
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::setFilterFixedString(QString(pattern));
+}
+
+void QSortFilterProxyModel_SetFilterKeyColumn(void* ptr, int column)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->setFilterKeyColumn(column);
+}
+
+void QSortFilterProxyModel_SetFilterRegExp(void* ptr, void* regExp)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->setFilterRegExp(*static_cast<QRegExp*>(regExp));
+}
+
+void QSortFilterProxyModel_SetFilterRegExp2(void* ptr, char* pattern)
+{
+	QMetaObject::invokeMethod(static_cast<QSortFilterProxyModel*>(ptr), "setFilterRegExp", Q_ARG(QString, QString(pattern)));
+}
+
+void QSortFilterProxyModel_SetFilterRegExp2Default(void* ptr, char* pattern)
+{
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::setFilterRegExp(QString(pattern));
+}
+
+void QSortFilterProxyModel_SetFilterRole(void* ptr, int role)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->setFilterRole(role);
+}
+
+void QSortFilterProxyModel_SetFilterWildcard(void* ptr, char* pattern)
+{
+	QMetaObject::invokeMethod(static_cast<QSortFilterProxyModel*>(ptr), "setFilterWildcard", Q_ARG(QString, QString(pattern)));
+}
+
+void QSortFilterProxyModel_SetFilterWildcardDefault(void* ptr, char* pattern)
+{
+		static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::setFilterWildcard(QString(pattern));
+}
+
+void QSortFilterProxyModel_SetSortCaseSensitivity(void* ptr, long long cs)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->setSortCaseSensitivity(static_cast<Qt::CaseSensitivity>(cs));
+}
+
+void QSortFilterProxyModel_SetSortLocaleAware(void* ptr, char on)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->setSortLocaleAware(on != 0);
+}
+
+void QSortFilterProxyModel_SetSortRole(void* ptr, int role)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->setSortRole(role);
+}
+
+void QSortFilterProxyModel_DestroyQSortFilterProxyModel(void* ptr)
+{
+	static_cast<QSortFilterProxyModel*>(ptr)->~QSortFilterProxyModel();
+}
+
+void* QSortFilterProxyModel_Index(void* ptr, int row, int column, void* parent)
+{
+	return new QModelIndex(static_cast<QSortFilterProxyModel*>(ptr)->index(row, column, *static_cast<QModelIndex*>(parent)));
+}
+
+void* QSortFilterProxyModel_IndexDefault(void* ptr, int row, int column, void* parent)
+{
+		return new QModelIndex(static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::index(row, column, *static_cast<QModelIndex*>(parent)));
+}
+
+void* QSortFilterProxyModel_MapFromSource(void* ptr, void* sourceIndex)
+{
+	return new QModelIndex(static_cast<QSortFilterProxyModel*>(ptr)->mapFromSource(*static_cast<QModelIndex*>(sourceIndex)));
+}
+
+void* QSortFilterProxyModel_MapFromSourceDefault(void* ptr, void* sourceIndex)
+{
+		return new QModelIndex(static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::mapFromSource(*static_cast<QModelIndex*>(sourceIndex)));
+}
+
+void* QSortFilterProxyModel_MapToSource(void* ptr, void* proxyIndex)
+{
+	return new QModelIndex(static_cast<QSortFilterProxyModel*>(ptr)->mapToSource(*static_cast<QModelIndex*>(proxyIndex)));
+}
+
+void* QSortFilterProxyModel_MapToSourceDefault(void* ptr, void* proxyIndex)
+{
+		return new QModelIndex(static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::mapToSource(*static_cast<QModelIndex*>(proxyIndex)));
+}
+
+void* QSortFilterProxyModel_Parent(void* ptr, void* child)
+{
+	return new QModelIndex(static_cast<QSortFilterProxyModel*>(ptr)->parent(*static_cast<QModelIndex*>(child)));
+}
+
+void* QSortFilterProxyModel_ParentDefault(void* ptr, void* child)
+{
+		return new QModelIndex(static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::parent(*static_cast<QModelIndex*>(child)));
+}
+
+void* QSortFilterProxyModel_FilterRegExp(void* ptr)
+{
+	return new QRegExp(static_cast<QSortFilterProxyModel*>(ptr)->filterRegExp());
+}
+
+long long QSortFilterProxyModel_FilterCaseSensitivity(void* ptr)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->filterCaseSensitivity();
+}
+
+long long QSortFilterProxyModel_SortCaseSensitivity(void* ptr)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->sortCaseSensitivity();
+}
+
+long long QSortFilterProxyModel_SortOrder(void* ptr)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->sortOrder();
+}
+
+char QSortFilterProxyModel_DynamicSortFilter(void* ptr)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->dynamicSortFilter();
+}
+
+char QSortFilterProxyModel_FilterAcceptsColumn(void* ptr, int source_column, void* source_parent)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->filterAcceptsColumn(source_column, *static_cast<QModelIndex*>(source_parent));
+}
+
+char QSortFilterProxyModel_FilterAcceptsColumnDefault(void* ptr, int source_column, void* source_parent)
+{
+		return static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::filterAcceptsColumn(source_column, *static_cast<QModelIndex*>(source_parent));
+}
+
+char QSortFilterProxyModel_FilterAcceptsRow(void* ptr, int source_row, void* source_parent)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->filterAcceptsRow(source_row, *static_cast<QModelIndex*>(source_parent));
+}
+
+char QSortFilterProxyModel_FilterAcceptsRowDefault(void* ptr, int source_row, void* source_parent)
+{
+		return static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::filterAcceptsRow(source_row, *static_cast<QModelIndex*>(source_parent));
+}
+
+char QSortFilterProxyModel_IsSortLocaleAware(void* ptr)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->isSortLocaleAware();
+}
+
+char QSortFilterProxyModel_LessThan(void* ptr, void* source_left, void* source_right)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->lessThan(*static_cast<QModelIndex*>(source_left), *static_cast<QModelIndex*>(source_right));
+}
+
+char QSortFilterProxyModel_LessThanDefault(void* ptr, void* source_left, void* source_right)
+{
+		return static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::lessThan(*static_cast<QModelIndex*>(source_left), *static_cast<QModelIndex*>(source_right));
+}
+
+int QSortFilterProxyModel_ColumnCount(void* ptr, void* parent)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->columnCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QSortFilterProxyModel_ColumnCountDefault(void* ptr, void* parent)
+{
+		return static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::columnCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QSortFilterProxyModel_FilterKeyColumn(void* ptr)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->filterKeyColumn();
+}
+
+int QSortFilterProxyModel_FilterRole(void* ptr)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->filterRole();
+}
+
+int QSortFilterProxyModel_RowCount(void* ptr, void* parent)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->rowCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QSortFilterProxyModel_RowCountDefault(void* ptr, void* parent)
+{
+		return static_cast<QSortFilterProxyModel*>(ptr)->QSortFilterProxyModel::rowCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QSortFilterProxyModel_SortColumn(void* ptr)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->sortColumn();
+}
+
+int QSortFilterProxyModel_SortRole(void* ptr)
+{
+	return static_cast<QSortFilterProxyModel*>(ptr)->sortRole();
+}
+
+struct QtCore_PackedString QStandardPaths_QStandardPaths_DisplayName(long long ty)
+{
+	return ({ QByteArray t0e52e2 = QStandardPaths::displayName(static_cast<QStandardPaths::StandardLocation>(ty)).toUtf8(); QtCore_PackedString { const_cast<char*>(t0e52e2.prepend("WHITESPACE").constData()+10), t0e52e2.size()-10 }; });
+}
+
+struct QtCore_PackedString QStandardPaths_QStandardPaths_FindExecutable(char* executableName, char* paths)
+{
+	return ({ QByteArray t83f92c = QStandardPaths::findExecutable(QString(executableName), goUnpackStringList(paths)).toUtf8(); QtCore_PackedString { const_cast<char*>(t83f92c.prepend("WHITESPACE").constData()+10), t83f92c.size()-10 }; });
+}
+
+struct QtCore_PackedString QStandardPaths_QStandardPaths_Locate(long long ty, char* fileName, long long options)
+{
+	return ({ QByteArray t784fbe = QStandardPaths::locate(static_cast<QStandardPaths::StandardLocation>(ty), QString(fileName), static_cast<QStandardPaths::LocateOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(t784fbe.prepend("WHITESPACE").constData()+10), t784fbe.size()-10 }; });
+}
+
+struct QtCore_PackedString QStandardPaths_QStandardPaths_WritableLocation(long long ty)
+{
+	return ({ QByteArray t06b5c0 = QStandardPaths::writableLocation(static_cast<QStandardPaths::StandardLocation>(ty)).toUtf8(); QtCore_PackedString { const_cast<char*>(t06b5c0.prepend("WHITESPACE").constData()+10), t06b5c0.size()-10 }; });
+}
+
+struct QtCore_PackedString QStandardPaths_QStandardPaths_LocateAll(long long ty, char* fileName, long long options)
+{
+	return ({ long long t559df1len; char* t559df1 = goPackStringList(QStandardPaths::locateAll(static_cast<QStandardPaths::StandardLocation>(ty), QString(fileName), static_cast<QStandardPaths::LocateOption>(options)), &t559df1len); QtCore_PackedString { t559df1, t559df1len }; });
+}
+
+struct QtCore_PackedString QStandardPaths_QStandardPaths_StandardLocations(long long ty)
+{
+	return ({ long long t70622alen; char* t70622a = goPackStringList(QStandardPaths::standardLocations(static_cast<QStandardPaths::StandardLocation>(ty)), &t70622alen); QtCore_PackedString { t70622a, t70622alen }; });
+}
+
+void QStandardPaths_QStandardPaths_SetTestModeEnabled(char testMode)
+{
+	QStandardPaths::setTestModeEnabled(testMode != 0);
+}
+
+class MyQState: public QState
+{
+public:
+	MyQState(ChildMode childMode, QState *parent) : QState(childMode, parent) {};
+	MyQState(QState *parent) : QState(parent) {};
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	void Signal_ChildModeChanged() { callbackQState_ChildModeChanged(this); };
+	void Signal_ErrorStateChanged() { callbackQState_ErrorStateChanged(this); };
+	void Signal_Finished() { callbackQState_Finished(this); };
+	void Signal_InitialStateChanged() { callbackQState_InitialStateChanged(this); };
+	void onEntry(QEvent * event) { callbackQState_OnEntry(this, event); };
+	void onExit(QEvent * event) { callbackQState_OnExit(this, event); };
+	void Signal_PropertiesAssigned() { callbackQState_PropertiesAssigned(this); };
+	void Signal_ActiveChanged(bool active) { callbackQAbstractState_ActiveChanged(this, active); };
+	void Signal_Entered() { callbackQAbstractState_Entered(this); };
+	void Signal_Exited() { callbackQAbstractState_Exited(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QState_AddTransition4(void* ptr, void* target)
+{
+	return static_cast<QState*>(ptr)->addTransition(static_cast<QAbstractState*>(target));
+}
+
+void* QState_AddTransition2(void* ptr, void* sender, char* sign, void* target)
+{
+	return static_cast<QState*>(ptr)->addTransition(static_cast<QObject*>(sender), const_cast<const char*>(sign), static_cast<QAbstractState*>(target));
+}
+
+void* QState_NewQState2(long long childMode, void* parent)
+{
+	return new MyQState(static_cast<QState::ChildMode>(childMode), static_cast<QState*>(parent));
+}
+
+void* QState_NewQState(void* parent)
+{
+	return new MyQState(static_cast<QState*>(parent));
+}
+
+void QState_AddTransition(void* ptr, void* transition)
+{
+	static_cast<QState*>(ptr)->addTransition(static_cast<QAbstractTransition*>(transition));
+}
+
+void QState_AssignProperty(void* ptr, void* object, char* name, void* value)
+{
+	static_cast<QState*>(ptr)->assignProperty(static_cast<QObject*>(object), const_cast<const char*>(name), *static_cast<QVariant*>(value));
+}
+
+void QState_ConnectChildModeChanged(void* ptr)
+{
+	QObject::connect(static_cast<QState*>(ptr), &QState::childModeChanged, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_ChildModeChanged));
+}
+
+void QState_DisconnectChildModeChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QState*>(ptr), &QState::childModeChanged, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_ChildModeChanged));
+}
+
+void QState_ConnectErrorStateChanged(void* ptr)
+{
+	QObject::connect(static_cast<QState*>(ptr), &QState::errorStateChanged, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_ErrorStateChanged));
+}
+
+void QState_DisconnectErrorStateChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QState*>(ptr), &QState::errorStateChanged, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_ErrorStateChanged));
+}
+
+void QState_ConnectFinished(void* ptr)
+{
+	QObject::connect(static_cast<QState*>(ptr), &QState::finished, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_Finished));
+}
+
+void QState_DisconnectFinished(void* ptr)
+{
+	QObject::disconnect(static_cast<QState*>(ptr), &QState::finished, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_Finished));
+}
+
+void QState_ConnectInitialStateChanged(void* ptr)
+{
+	QObject::connect(static_cast<QState*>(ptr), &QState::initialStateChanged, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_InitialStateChanged));
+}
+
+void QState_DisconnectInitialStateChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QState*>(ptr), &QState::initialStateChanged, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_InitialStateChanged));
+}
+
+void QState_OnEntry(void* ptr, void* event)
+{
+	static_cast<QState*>(ptr)->onEntry(static_cast<QEvent*>(event));
+}
+
+void QState_OnEntryDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStateMachine*>(ptr)->QStateMachine::onEntry(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QState*>(ptr)->QState::onEntry(static_cast<QEvent*>(event));
+	}
+}
+
+void QState_OnExit(void* ptr, void* event)
+{
+	static_cast<QState*>(ptr)->onExit(static_cast<QEvent*>(event));
+}
+
+void QState_OnExitDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QStateMachine*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStateMachine*>(ptr)->QStateMachine::onExit(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QState*>(ptr)->QState::onExit(static_cast<QEvent*>(event));
+	}
+}
+
+void QState_ConnectPropertiesAssigned(void* ptr)
+{
+	QObject::connect(static_cast<QState*>(ptr), &QState::propertiesAssigned, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_PropertiesAssigned));
+}
+
+void QState_DisconnectPropertiesAssigned(void* ptr)
+{
+	QObject::disconnect(static_cast<QState*>(ptr), &QState::propertiesAssigned, static_cast<MyQState*>(ptr), static_cast<void (MyQState::*)()>(&MyQState::Signal_PropertiesAssigned));
+}
+
+void QState_RemoveTransition(void* ptr, void* transition)
+{
+	static_cast<QState*>(ptr)->removeTransition(static_cast<QAbstractTransition*>(transition));
+}
+
+void QState_SetChildMode(void* ptr, long long mode)
+{
+	static_cast<QState*>(ptr)->setChildMode(static_cast<QState::ChildMode>(mode));
+}
+
+void QState_SetErrorState(void* ptr, void* state)
+{
+	static_cast<QState*>(ptr)->setErrorState(static_cast<QAbstractState*>(state));
+}
+
+void QState_SetInitialState(void* ptr, void* state)
+{
+	static_cast<QState*>(ptr)->setInitialState(static_cast<QAbstractState*>(state));
+}
+
+void QState_DestroyQState(void* ptr)
+{
+	static_cast<QState*>(ptr)->~QState();
+}
+
+long long QState_ChildMode(void* ptr)
+{
+	return static_cast<QState*>(ptr)->childMode();
+}
+
+void* QState_ErrorState(void* ptr)
+{
+	return static_cast<QState*>(ptr)->errorState();
+}
+
+void* QState_InitialState(void* ptr)
+{
+	return static_cast<QState*>(ptr)->initialState();
+}
+
+struct QtCore_PackedList QState_Transitions(void* ptr)
+{
+	return ({ QList<QAbstractTransition *>* tmpValue = new QList<QAbstractTransition *>(static_cast<QState*>(ptr)->transitions()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QState___transitions_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractTransition*>(static_cast<QList<QAbstractTransition *>*>(ptr)->at(i));
+}
+
+void QState___transitions_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractTransition *>*>(ptr)->append(static_cast<QAbstractTransition*>(i));
+}
+
+void* QState___transitions_newList(void* ptr)
+{
+	return new QList<QAbstractTransition *>;
+}
+
+class MyQStateMachine: public QStateMachine
+{
+public:
+	MyQStateMachine(QObject *parent) : QStateMachine(parent) {};
+	MyQStateMachine(QState::ChildMode childMode, QObject *parent) : QStateMachine(childMode, parent) {};
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void onEntry(QEvent * event) { callbackQState_OnEntry(this, event); };
+	void onExit(QEvent * event) { callbackQState_OnExit(this, event); };
+	void Signal_RunningChanged(bool running) { callbackQStateMachine_RunningChanged(this, running); };
+	void setRunning(bool running) { callbackQStateMachine_SetRunning(this, running); };
+	void start() { callbackQStateMachine_Start(this); };
+	void Signal_Started() { callbackQStateMachine_Started(this); };
+	void stop() { callbackQStateMachine_Stop(this); };
+	void Signal_Stopped() { callbackQStateMachine_Stopped(this); };
+	void Signal_ChildModeChanged() { callbackQState_ChildModeChanged(this); };
+	void Signal_ErrorStateChanged() { callbackQState_ErrorStateChanged(this); };
+	void Signal_Finished() { callbackQState_Finished(this); };
+	void Signal_InitialStateChanged() { callbackQState_InitialStateChanged(this); };
+	void Signal_PropertiesAssigned() { callbackQState_PropertiesAssigned(this); };
+	void Signal_ActiveChanged(bool active) { callbackQAbstractState_ActiveChanged(this, active); };
+	void Signal_Entered() { callbackQAbstractState_Entered(this); };
+	void Signal_Exited() { callbackQAbstractState_Exited(this); };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QStateMachine_NewQStateMachine(void* parent)
+{
+	return new MyQStateMachine(static_cast<QObject*>(parent));
+}
+
+void* QStateMachine_NewQStateMachine2(long long childMode, void* parent)
+{
+	return new MyQStateMachine(static_cast<QState::ChildMode>(childMode), static_cast<QObject*>(parent));
+}
+
+char QStateMachine_CancelDelayedEvent(void* ptr, int id)
+{
+	return static_cast<QStateMachine*>(ptr)->cancelDelayedEvent(id);
+}
+
+int QStateMachine_PostDelayedEvent(void* ptr, void* event, int delay)
+{
+	return static_cast<QStateMachine*>(ptr)->postDelayedEvent(static_cast<QEvent*>(event), delay);
+}
+
+void QStateMachine_AddDefaultAnimation(void* ptr, void* animation)
+{
+	static_cast<QStateMachine*>(ptr)->addDefaultAnimation(static_cast<QAbstractAnimation*>(animation));
+}
+
+void QStateMachine_AddState(void* ptr, void* state)
+{
+	static_cast<QStateMachine*>(ptr)->addState(static_cast<QAbstractState*>(state));
+}
+
+void QStateMachine_ClearError(void* ptr)
+{
+	static_cast<QStateMachine*>(ptr)->clearError();
+}
+
+void QStateMachine_PostEvent(void* ptr, void* event, long long priority)
+{
+	static_cast<QStateMachine*>(ptr)->postEvent(static_cast<QEvent*>(event), static_cast<QStateMachine::EventPriority>(priority));
+}
+
+void QStateMachine_RemoveDefaultAnimation(void* ptr, void* animation)
+{
+	static_cast<QStateMachine*>(ptr)->removeDefaultAnimation(static_cast<QAbstractAnimation*>(animation));
+}
+
+void QStateMachine_RemoveState(void* ptr, void* state)
+{
+	static_cast<QStateMachine*>(ptr)->removeState(static_cast<QAbstractState*>(state));
+}
+
+void QStateMachine_ConnectRunningChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStateMachine*>(ptr), static_cast<void (QStateMachine::*)(bool)>(&QStateMachine::runningChanged), static_cast<MyQStateMachine*>(ptr), static_cast<void (MyQStateMachine::*)(bool)>(&MyQStateMachine::Signal_RunningChanged));
+}
+
+void QStateMachine_DisconnectRunningChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStateMachine*>(ptr), static_cast<void (QStateMachine::*)(bool)>(&QStateMachine::runningChanged), static_cast<MyQStateMachine*>(ptr), static_cast<void (MyQStateMachine::*)(bool)>(&MyQStateMachine::Signal_RunningChanged));
+}
+
+void QStateMachine_RunningChanged(void* ptr, char running)
+{
+	static_cast<QStateMachine*>(ptr)->runningChanged(running != 0);
+}
+
+void QStateMachine_SetAnimated(void* ptr, char enabled)
+{
+	static_cast<QStateMachine*>(ptr)->setAnimated(enabled != 0);
+}
+
+void QStateMachine_SetGlobalRestorePolicy(void* ptr, long long restorePolicy)
+{
+	static_cast<QStateMachine*>(ptr)->setGlobalRestorePolicy(static_cast<QState::RestorePolicy>(restorePolicy));
+}
+
+void QStateMachine_SetRunning(void* ptr, char running)
+{
+	QMetaObject::invokeMethod(static_cast<QStateMachine*>(ptr), "setRunning", Q_ARG(bool, running != 0));
+}
+
+void QStateMachine_SetRunningDefault(void* ptr, char running)
+{
+		static_cast<QStateMachine*>(ptr)->QStateMachine::setRunning(running != 0);
+}
+
+void QStateMachine_Start(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QStateMachine*>(ptr), "start");
+}
+
+void QStateMachine_StartDefault(void* ptr)
+{
+		static_cast<QStateMachine*>(ptr)->QStateMachine::start();
+}
+
+void QStateMachine_ConnectStarted(void* ptr)
+{
+	QObject::connect(static_cast<QStateMachine*>(ptr), &QStateMachine::started, static_cast<MyQStateMachine*>(ptr), static_cast<void (MyQStateMachine::*)()>(&MyQStateMachine::Signal_Started));
+}
+
+void QStateMachine_DisconnectStarted(void* ptr)
+{
+	QObject::disconnect(static_cast<QStateMachine*>(ptr), &QStateMachine::started, static_cast<MyQStateMachine*>(ptr), static_cast<void (MyQStateMachine::*)()>(&MyQStateMachine::Signal_Started));
+}
+
+void QStateMachine_Stop(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QStateMachine*>(ptr), "stop");
+}
+
+void QStateMachine_StopDefault(void* ptr)
+{
+		static_cast<QStateMachine*>(ptr)->QStateMachine::stop();
+}
+
+void QStateMachine_ConnectStopped(void* ptr)
+{
+	QObject::connect(static_cast<QStateMachine*>(ptr), &QStateMachine::stopped, static_cast<MyQStateMachine*>(ptr), static_cast<void (MyQStateMachine::*)()>(&MyQStateMachine::Signal_Stopped));
+}
+
+void QStateMachine_DisconnectStopped(void* ptr)
+{
+	QObject::disconnect(static_cast<QStateMachine*>(ptr), &QStateMachine::stopped, static_cast<MyQStateMachine*>(ptr), static_cast<void (MyQStateMachine::*)()>(&MyQStateMachine::Signal_Stopped));
+}
+
+void QStateMachine_DestroyQStateMachine(void* ptr)
+{
+	static_cast<QStateMachine*>(ptr)->~QStateMachine();
+}
+
+long long QStateMachine_Error(void* ptr)
+{
+	return static_cast<QStateMachine*>(ptr)->error();
+}
+
+struct QtCore_PackedList QStateMachine_DefaultAnimations(void* ptr)
+{
+	return ({ QList<QAbstractAnimation *>* tmpValue = new QList<QAbstractAnimation *>(static_cast<QStateMachine*>(ptr)->defaultAnimations()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+long long QStateMachine_GlobalRestorePolicy(void* ptr)
+{
+	return static_cast<QStateMachine*>(ptr)->globalRestorePolicy();
+}
+
+struct QtCore_PackedString QStateMachine_ErrorString(void* ptr)
+{
+	return ({ QByteArray tb4aee6 = static_cast<QStateMachine*>(ptr)->errorString().toUtf8(); QtCore_PackedString { const_cast<char*>(tb4aee6.prepend("WHITESPACE").constData()+10), tb4aee6.size()-10 }; });
+}
+
+char QStateMachine_IsAnimated(void* ptr)
+{
+	return static_cast<QStateMachine*>(ptr)->isAnimated();
+}
+
+char QStateMachine_IsRunning(void* ptr)
+{
+	return static_cast<QStateMachine*>(ptr)->isRunning();
+}
+
+void* QStateMachine___defaultAnimations_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractAnimation*>(static_cast<QList<QAbstractAnimation *>*>(ptr)->at(i));
+}
+
+void QStateMachine___defaultAnimations_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractAnimation *>*>(ptr)->append(static_cast<QAbstractAnimation*>(i));
+}
+
+void* QStateMachine___defaultAnimations_newList(void* ptr)
+{
+	return new QList<QAbstractAnimation *>;
+}
+
+void* QStaticPlugin_Instance(void* ptr)
+{
+	return static_cast<QStaticPlugin*>(ptr)->instance();
+}
+
+struct QtCore_PackedString QStaticPlugin_RawMetaData(void* ptr)
+{
+	return QtCore_PackedString { const_cast<char*>(static_cast<QStaticPlugin*>(ptr)->rawMetaData()), -1 };
+}
+
+void* QStaticPlugin_MetaData(void* ptr)
+{
+	return new QJsonObject(static_cast<QStaticPlugin*>(ptr)->metaData());
+}
+
+struct QtCore_PackedList QStorageInfo_QStorageInfo_MountedVolumes()
+{
+	return ({ QList<QStorageInfo>* tmpValue = new QList<QStorageInfo>(QStorageInfo::mountedVolumes()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStorageInfo_QStorageInfo_Root()
+{
+	return new QStorageInfo(QStorageInfo::root());
+}
+
+void* QStorageInfo_NewQStorageInfo()
+{
+	return new QStorageInfo();
+}
+
+void* QStorageInfo_NewQStorageInfoInArena(void* arena)
+{
+	return new (goArenaAlloc<QStorageInfo>(arena)) QStorageInfo();
+}
+
+void* QStorageInfo_NewQStorageInfo3(void* dir)
+{
+	return new QStorageInfo(*static_cast<QDir*>(dir));
+}
+
+void* QStorageInfo_NewQStorageInfo3InArena(void* arena, void* dir)
+{
+	return new (goArenaAlloc<QStorageInfo>(arena)) QStorageInfo(*static_cast<QDir*>(dir));
+}
+
+void* QStorageInfo_NewQStorageInfo4(void* other)
+{
+	return new QStorageInfo(*static_cast<QStorageInfo*>(other));
+}
+
+void* QStorageInfo_NewQStorageInfo4InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QStorageInfo>(arena)) QStorageInfo(*static_cast<QStorageInfo*>(other));
+}
+
+void* QStorageInfo_NewQStorageInfo2(char* path)
+{
+	return new QStorageInfo(QString(path));
+}
+
+void* QStorageInfo_NewQStorageInfo2InArena(void* arena, char* path)
+{
+	return new (goArenaAlloc<QStorageInfo>(arena)) QStorageInfo(QString(path));
+}
+
+void QStorageInfo_Refresh(void* ptr)
+{
+	static_cast<QStorageInfo*>(ptr)->refresh();
+}
+
+void QStorageInfo_SetPath(void* ptr, char* path)
+{
+	static_cast<QStorageInfo*>(ptr)->setPath(QString(path));
+}
+
+void QStorageInfo_Swap(void* ptr, void* other)
+{
+	static_cast<QStorageInfo*>(ptr)->swap(*static_cast<QStorageInfo*>(other));
+}
+
+void QStorageInfo_DestroyQStorageInfo(void* ptr)
+{
+	static_cast<QStorageInfo*>(ptr)->~QStorageInfo();
+}
+
+void* QStorageInfo_Device(void* ptr)
+{
+	return new QByteArray(static_cast<QStorageInfo*>(ptr)->device());
+}
+
+void* QStorageInfo_FileSystemType(void* ptr)
+{
+	return new QByteArray(static_cast<QStorageInfo*>(ptr)->fileSystemType());
+}
+
+struct QtCore_PackedString QStorageInfo_DisplayName(void* ptr)
+{
+	return ({ QByteArray t7b3b54 = static_cast<QStorageInfo*>(ptr)->displayName().toUtf8(); QtCore_PackedString { const_cast<char*>(t7b3b54.prepend("WHITESPACE").constData()+10), t7b3b54.size()-10 }; });
+}
+
+struct QtCore_PackedString QStorageInfo_Name(void* ptr)
+{
+	return ({ QByteArray t4fa869 = static_cast<QStorageInfo*>(ptr)->name().toUtf8(); QtCore_PackedString { const_cast<char*>(t4fa869.prepend("WHITESPACE").constData()+10), t4fa869.size()-10 }; });
+}
+
+struct QtCore_PackedString QStorageInfo_RootPath(void* ptr)
+{
+	return ({ QByteArray t0ec510 = static_cast<QStorageInfo*>(ptr)->rootPath().toUtf8(); QtCore_PackedString { const_cast<char*>(t0ec510.prepend("WHITESPACE").constData()+10), t0ec510.size()-10 }; });
+}
+
+char QStorageInfo_IsReadOnly(void* ptr)
+{
+	return static_cast<QStorageInfo*>(ptr)->isReadOnly();
+}
+
+char QStorageInfo_IsReady(void* ptr)
+{
+	return static_cast<QStorageInfo*>(ptr)->isReady();
+}
+
+char QStorageInfo_IsRoot(void* ptr)
+{
+	return static_cast<QStorageInfo*>(ptr)->isRoot();
+}
+
+char QStorageInfo_IsValid(void* ptr)
+{
+	return static_cast<QStorageInfo*>(ptr)->isValid();
+}
+
+int QStorageInfo_BlockSize(void* ptr)
+{
+	return static_cast<QStorageInfo*>(ptr)->blockSize();
+}
+
+long long QStorageInfo_BytesAvailable(void* ptr)
+{
+	return static_cast<QStorageInfo*>(ptr)->bytesAvailable();
+}
+
+long long QStorageInfo_BytesFree(void* ptr)
+{
+	return static_cast<QStorageInfo*>(ptr)->bytesFree();
+}
+
+long long QStorageInfo_BytesTotal(void* ptr)
+{
+	return static_cast<QStorageInfo*>(ptr)->bytesTotal();
+}
+
+void* QStorageInfo___mountedVolumes_atList(void* ptr, int i)
+{
+	return new QStorageInfo(static_cast<QList<QStorageInfo>*>(ptr)->at(i));
+}
+
+void QStorageInfo___mountedVolumes_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStorageInfo>*>(ptr)->append(*static_cast<QStorageInfo*>(i));
+}
+
+void* QStorageInfo___mountedVolumes_newList(void* ptr)
+{
+	return new QList<QStorageInfo>;
+}
+
+class MyQStringListModel: public QStringListModel
+{
+public:
+	MyQStringListModel(QObject *parent) : QStringListModel(parent) {};
+	MyQStringListModel(const QStringList &strings, QObject *parent) : QStringListModel(strings, parent) {};
+	bool insertRows(int row, int count, const QModelIndex & parent) { return callbackQAbstractItemModel_InsertRows(this, row, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool removeRows(int row, int count, const QModelIndex & parent) { return callbackQAbstractItemModel_RemoveRows(this, row, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool setData(const QModelIndex & index, const QVariant & value, int role) { return callbackQAbstractItemModel_SetData(this, const_cast<QModelIndex*>(&index), const_cast<QVariant*>(&value), role) != 0; };
+	void sort(int column, Qt::SortOrder order) { callbackQAbstractItemModel_Sort(this, column, order); };
+	QModelIndex sibling(int row, int column, const QModelIndex & idx) const { return *static_cast<QModelIndex*>(callbackQAbstractItemModel_Sibling(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&idx))); };
+	QVariant data(const QModelIndex & index, int role) const { QVariant ret; callbackQStringListModel_Data(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), role, &ret); return ret; };
+	Qt::DropActions supportedDropActions() const { return static_cast<Qt::DropAction>(callbackQAbstractItemModel_SupportedDropActions(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::ItemFlags flags(const QModelIndex & index) const { return static_cast<Qt::ItemFlag>(callbackQAbstractItemModel_Flags(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	int rowCount(const QModelIndex & parent) const { return callbackQStringListModel_RowCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
+	bool dropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) { return callbackQAbstractItemModel_DropMimeData(this, const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
+	QModelIndex index(int row, int column, const QModelIndex & parent) const { return *static_cast<QModelIndex*>(callbackQAbstractListModel_Index(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&parent))); };
+	bool insertColumns(int column, int count, const QModelIndex & parent) { return callbackQAbstractItemModel_InsertColumns(this, column, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool moveColumns(const QModelIndex & sourceParent, int sourceColumn, int count, const QModelIndex & destinationParent, int destinationChild) { return callbackQAbstractItemModel_MoveColumns(this, const_cast<QModelIndex*>(&sourceParent), sourceColumn, count, const_cast<QModelIndex*>(&destinationParent), destinationChild) != 0; };
+	bool moveRows(const QModelIndex & sourceParent, int sourceRow, int count, const QModelIndex & destinationParent, int destinationChild) { return callbackQAbstractItemModel_MoveRows(this, const_cast<QModelIndex*>(&sourceParent), sourceRow, count, const_cast<QModelIndex*>(&destinationParent), destinationChild) != 0; };
+	bool removeColumns(int column, int count, const QModelIndex & parent) { return callbackQAbstractItemModel_RemoveColumns(this, column, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool setHeaderData(int section, Qt::Orientation orientation, const QVariant & value, int role) { return callbackQAbstractItemModel_SetHeaderData(this, section, orientation, const_cast<QVariant*>(&value), role) != 0; };
+	bool setItemData(const QModelIndex & index, const QMap<int, QVariant> & roles) { return callbackQAbstractItemModel_SetItemData(this, const_cast<QModelIndex*>(&index), ({ QMap<int, QVariant>* tmpValue = const_cast<QMap<int, QVariant>*>(&roles); QtCore_PackedList { tmpValue, tmpValue->size() }; })) != 0; };
+	bool submit() { return callbackQAbstractItemModel_Submit(this) != 0; };
+	void Signal_ColumnsAboutToBeInserted(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_ColumnsAboutToBeInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsAboutToBeMoved(const QModelIndex & sourceParent, int sourceStart, int sourceEnd, const QModelIndex & destinationParent, int destinationColumn) { callbackQAbstractItemModel_ColumnsAboutToBeMoved(this, const_cast<QModelIndex*>(&sourceParent), sourceStart, sourceEnd, const_cast<QModelIndex*>(&destinationParent), destinationColumn); };
+	void Signal_ColumnsAboutToBeRemoved(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_ColumnsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsInserted(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_ColumnsInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsMoved(const QModelIndex & parent, int start, int end, const QModelIndex & destination, int column) { callbackQAbstractItemModel_ColumnsMoved(this, const_cast<QModelIndex*>(&parent), start, end, const_cast<QModelIndex*>(&destination), column); };
+	void Signal_ColumnsRemoved(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_ColumnsRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_DataChanged(const QModelIndex & topLeft, const QModelIndex & bottomRight, const QVector<int> & roles) { callbackQAbstractItemModel_DataChanged(this, const_cast<QModelIndex*>(&topLeft), const_cast<QModelIndex*>(&bottomRight), ({ QVector<int>* tmpValue = const_cast<QVector<int>*>(&roles); QtCore_PackedList { tmpValue, tmpValue->size() }; })); };
+	void fetchMore(const QModelIndex & parent) { callbackQAbstractItemModel_FetchMore(this, const_cast<QModelIndex*>(&parent)); };
+	void Signal_HeaderDataChanged(Qt::Orientation orientation, int first, int last) { callbackQAbstractItemModel_HeaderDataChanged(this, orientation, first, last); };
+	void Signal_LayoutAboutToBeChanged(const QList<QPersistentModelIndex> & parents, QAbstractItemModel::LayoutChangeHint hint) { callbackQAbstractItemModel_LayoutAboutToBeChanged(this, ({ QList<QPersistentModelIndex>* tmpValue = const_cast<QList<QPersistentModelIndex>*>(&parents); QtCore_PackedList { tmpValue, tmpValue->size() }; }), hint); };
+	void Signal_LayoutChanged(const QList<QPersistentModelIndex> & parents, QAbstractItemModel::LayoutChangeHint hint) { callbackQAbstractItemModel_LayoutChanged(this, ({ QList<QPersistentModelIndex>* tmpValue = const_cast<QList<QPersistentModelIndex>*>(&parents); QtCore_PackedList { tmpValue, tmpValue->size() }; }), hint); };
+	void Signal_ModelAboutToBeReset() { callbackQAbstractItemModel_ModelAboutToBeReset(this); };
+	void Signal_ModelReset() { callbackQAbstractItemModel_ModelReset(this); };
+	void resetInternalData() { callbackQAbstractItemModel_ResetInternalData(this); };
+	void revert() { callbackQAbstractItemModel_Revert(this); };
+	void Signal_RowsAboutToBeInserted(const QModelIndex & parent, int start, int end) { callbackQAbstractItemModel_RowsAboutToBeInserted(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void Signal_RowsAboutToBeMoved(const QModelIndex & sourceParent, int sourceStart, int sourceEnd, const QModelIndex & destinationParent, int destinationRow) { callbackQAbstractItemModel_RowsAboutToBeMoved(this, const_cast<QModelIndex*>(&sourceParent), sourceStart, sourceEnd, const_cast<QModelIndex*>(&destinationParent), destinationRow); };
+	void Signal_RowsAboutToBeRemoved(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_RowsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_RowsInserted(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_RowsInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_RowsMoved(const QModelIndex & parent, int start, int end, const QModelIndex & destination, int row) { callbackQAbstractItemModel_RowsMoved(this, const_cast<QModelIndex*>(&parent), start, end, const_cast<QModelIndex*>(&destination), row); };
+	void Signal_RowsRemoved(const QModelIndex & parent, int first, int last) { callbackQAbstractItemModel_RowsRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	QHash<int, QByteArray> roleNames() const { return *static_cast<QHash<int, QByteArray>*>(callbackQAbstractItemModel_RoleNames(const_cast<void*>(static_cast<const void*>(this)))); };
+	QMap<int, QVariant> itemData(const QModelIndex & index) const { return *static_cast<QMap<int, QVariant>*>(callbackQAbstractItemModel_ItemData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QMimeData * mimeData(const QModelIndexList & indexes) const { return static_cast<QMimeData*>(callbackQAbstractItemModel_MimeData(const_cast<void*>(static_cast<const void*>(this)), ({ QList<QModelIndex>* tmpValue = new QList<QModelIndex>(indexes); QtCore_PackedList { tmpValue, tmpValue->size() }; }))); };
+	QModelIndex buddy(const QModelIndex & index) const { return *static_cast<QModelIndex*>(callbackQAbstractItemModel_Buddy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QModelIndex parent(const QModelIndex & index) const { return *static_cast<QModelIndex*>(callbackQAbstractListModel_Parent(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QList<QModelIndex> match(const QModelIndex & start, int role, const QVariant & value, int hits, Qt::MatchFlags flags) const { return *static_cast<QList<QModelIndex>*>(callbackQAbstractItemModel_Match(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&start), role, const_cast<QVariant*>(&value), hits, flags)); };
+	QSize span(const QModelIndex & index) const { return *static_cast<QSize*>(callbackQAbstractItemModel_Span(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QStringList mimeTypes() const { char* tmp = callbackQAbstractItemModel_MimeTypes(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
+	QVariant headerData(int section, Qt::Orientation orientation, int role) const { return *static_cast<QVariant*>(callbackQAbstractItemModel_HeaderData(const_cast<void*>(static_cast<const void*>(this)), section, orientation, role)); };
+	Qt::DropActions supportedDragActions() const { return static_cast<Qt::DropAction>(callbackQAbstractItemModel_SupportedDragActions(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool canDropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) const { return callbackQAbstractItemModel_CanDropMimeData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool canFetchMore(const QModelIndex & parent) const { return callbackQAbstractItemModel_CanFetchMore(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)) != 0; };
+	bool hasChildren(const QModelIndex & parent) const { return callbackQAbstractItemModel_HasChildren(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)) != 0; };
+	int columnCount(const QModelIndex & parent) const { return callbackQAbstractListModel_ColumnCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QStringListModel_NewQStringListModel(void* parent)
+{
+	return new MyQStringListModel(static_cast<QObject*>(parent));
+}
+
+void* QStringListModel_NewQStringListModel2(char* strin, void* parent)
+{
+	return new MyQStringListModel(goUnpackStringList(strin), static_cast<QObject*>(parent));
+}
+
+void QStringListModel_SetStringList(void* ptr, char* strin)
+{
+	static_cast<QStringListModel*>(ptr)->setStringList(goUnpackStringList(strin));
+}
+
+struct QtCore_PackedString QStringListModel_StringList(void* ptr)
+{
+	return ({ long long t02c9edlen; char* t02c9ed = goPackStringList(static_cast<QStringListModel*>(ptr)->stringList(), &t02c9edlen); QtCore_PackedString { t02c9ed, t02c9edlen }; });
+}
+
+void* QStringListModel_Data(void* ptr, void* index, int role)
+{
+	return new QVariant(static_cast<QStringListModel*>(ptr)->data(*static_cast<QModelIndex*>(index), role));
+}
+
+void* QStringListModel_DataDefault(void* ptr, void* index, int role)
+{
+		return new QVariant(static_cast<QStringListModel*>(ptr)->QStringListModel::data(*static_cast<QModelIndex*>(index), role));
+}
+
+void QStringListModel_DataDefaultInto(void* ptr, void* index, int role, void* ret)
+{
+		*static_cast<QVariant*>(ret) = QVariant(static_cast<QStringListModel*>(ptr)->QStringListModel::data(*static_cast<QModelIndex*>(index), role));
+}
+
+int QStringListModel_RowCount(void* ptr, void* parent)
+{
+	return static_cast<QStringListModel*>(ptr)->rowCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QStringListModel_RowCountDefault(void* ptr, void* parent)
+{
+		return static_cast<QStringListModel*>(ptr)->QStringListModel::rowCount(*static_cast<QModelIndex*>(parent));
+}
+
+void* QStringMatcher_NewQStringMatcher()
+{
+	return new QStringMatcher();
+}
+
+void* QStringMatcher_NewQStringMatcherInArena(void* arena)
+{
+	return new (goArenaAlloc<QStringMatcher>(arena)) QStringMatcher();
+}
+
+void* QStringMatcher_NewQStringMatcher3(void* uc, int length, long long cs)
+{
+	return new QStringMatcher(static_cast<QChar*>(uc), length, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+void* QStringMatcher_NewQStringMatcher3InArena(void* arena, void* uc, int length, long long cs)
+{
+	return new (goArenaAlloc<QStringMatcher>(arena)) QStringMatcher(static_cast<QChar*>(uc), length, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+void* QStringMatcher_NewQStringMatcher2(char* pattern, long long cs)
+{
+	return new QStringMatcher(QString(pattern), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+void* QStringMatcher_NewQStringMatcher2InArena(void* arena, char* pattern, long long cs)
+{
+	return new (goArenaAlloc<QStringMatcher>(arena)) QStringMatcher(QString(pattern), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+void* QStringMatcher_NewQStringMatcher4(void* other)
+{
+	return new QStringMatcher(*static_cast<QStringMatcher*>(other));
+}
+
+void* QStringMatcher_NewQStringMatcher4InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QStringMatcher>(arena)) QStringMatcher(*static_cast<QStringMatcher*>(other));
+}
+
+void QStringMatcher_SetCaseSensitivity(void* ptr, long long cs)
+{
+	static_cast<QStringMatcher*>(ptr)->setCaseSensitivity(static_cast<Qt::CaseSensitivity>(cs));
+}
+
+void QStringMatcher_SetPattern(void* ptr, char* pattern)
+{
+	static_cast<QStringMatcher*>(ptr)->setPattern(QString(pattern));
+}
+
+void QStringMatcher_DestroyQStringMatcher(void* ptr)
+{
+	static_cast<QStringMatcher*>(ptr)->~QStringMatcher();
+}
+
+struct QtCore_PackedString QStringMatcher_Pattern(void* ptr)
+{
+	return ({ QByteArray ta9f593 = static_cast<QStringMatcher*>(ptr)->pattern().toUtf8(); QtCore_PackedString { const_cast<char*>(ta9f593.prepend("WHITESPACE").constData()+10), ta9f593.size()-10 }; });
+}
+
+long long QStringMatcher_CaseSensitivity(void* ptr)
+{
+	return static_cast<QStringMatcher*>(ptr)->caseSensitivity();
+}
+
+int QStringMatcher_IndexIn2(void* ptr, void* str, int length, int from)
+{
+	return static_cast<QStringMatcher*>(ptr)->indexIn(static_cast<QChar*>(str), length, from);
+}
+
+int QStringMatcher_IndexIn(void* ptr, char* str, int from)
+{
+	return static_cast<QStringMatcher*>(ptr)->indexIn(QString(str), from);
+}
+
+void* QStringRef_NewQStringRef()
+{
+	return new QStringRef();
+}
+
+void* QStringRef_NewQStringRefInArena(void* arena)
+{
+	return new (goArenaAlloc<QStringRef>(arena)) QStringRef();
+}
+
+void* QStringRef_NewQStringRef5(void* other)
+{
+	return new QStringRef(*static_cast<QStringRef*>(other));
+}
+
+void* QStringRef_NewQStringRef5InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QStringRef>(arena)) QStringRef(*static_cast<QStringRef*>(other));
+}
+
+void* QStringRef_NewQStringRef3(char* stri)
+{
+	return new QStringRef(new QString(stri));
+}
+
+void* QStringRef_NewQStringRef3InArena(void* arena, char* stri)
+{
+	return new (goArenaAlloc<QStringRef>(arena)) QStringRef(new QString(stri));
+}
+
+void* QStringRef_NewQStringRef2(char* stri, int position, int length)
+{
+	return new QStringRef(new QString(stri), position, length);
+}
+
+void* QStringRef_NewQStringRef2InArena(void* arena, char* stri, int position, int length)
+{
+	return new (goArenaAlloc<QStringRef>(arena)) QStringRef(new QString(stri), position, length);
+}
+
+void* QStringRef_NewQStringRef4(void* other)
+{
+	return new QStringRef(*static_cast<QStringRef*>(other));
+}
+
+void* QStringRef_NewQStringRef4InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QStringRef>(arena)) QStringRef(*static_cast<QStringRef*>(other));
+}
+
+int QStringRef_QStringRef_Compare7(void* s1, void* s2, long long cs)
+{
+	return QStringRef::compare(*static_cast<QStringRef*>(s1), *static_cast<QLatin1String*>(s2), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_QStringRef_Compare(void* s1, char* s2, long long cs)
+{
+	return QStringRef::compare(*static_cast<QStringRef*>(s1), QString(s2), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_QStringRef_Compare6(void* s1, void* s2, long long cs)
+{
+	return QStringRef::compare(*static_cast<QStringRef*>(s1), *static_cast<QStringRef*>(s2), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_QStringRef_LocaleAwareCompare(void* s1, char* s2)
+{
+	return QStringRef::localeAwareCompare(*static_cast<QStringRef*>(s1), QString(s2));
+}
+
+int QStringRef_QStringRef_LocaleAwareCompare4(void* s1, void* s2)
+{
+	return QStringRef::localeAwareCompare(*static_cast<QStringRef*>(s1), *static_cast<QStringRef*>(s2));
+}
+
+void QStringRef_Chop(void* ptr, int n)
+{
+	static_cast<QStringRef*>(ptr)->chop(n);
+}
+
+void QStringRef_Clear(void* ptr)
+{
+	static_cast<QStringRef*>(ptr)->clear();
+}
+
+void QStringRef_Truncate(void* ptr, int position)
+{
+	static_cast<QStringRef*>(ptr)->truncate(position);
+}
+
+void QStringRef_DestroyQStringRef(void* ptr)
+{
+	static_cast<QStringRef*>(ptr)->~QStringRef();
+}
+
+void* QStringRef_ToLatin1(void* ptr)
+{
+	return new QByteArray(static_cast<QStringRef*>(ptr)->toLatin1());
+}
+
+void* QStringRef_ToLocal8Bit(void* ptr)
+{
+	return new QByteArray(static_cast<QStringRef*>(ptr)->toLocal8Bit());
+}
+
+void* QStringRef_ToUtf8(void* ptr)
+{
+	return new QByteArray(static_cast<QStringRef*>(ptr)->toUtf8());
+}
+
+struct QtCore_PackedString QStringRef_ToString(void* ptr)
+{
+	return ({ QByteArray t336448 = static_cast<QStringRef*>(ptr)->toString().toUtf8(); QtCore_PackedString { const_cast<char*>(t336448.prepend("WHITESPACE").constData()+10), t336448.size()-10 }; });
+}
+
+void* QStringRef_AppendTo(void* ptr, char* stri)
+{
+	return new QStringRef(static_cast<QStringRef*>(ptr)->appendTo(new QString(stri)));
+}
+
+void* QStringRef_Left(void* ptr, int n)
+{
+	return new QStringRef(static_cast<QStringRef*>(ptr)->left(n));
+}
+
+void* QStringRef_Mid(void* ptr, int position, int n)
+{
+	return new QStringRef(static_cast<QStringRef*>(ptr)->mid(position, n));
+}
+
+void* QStringRef_Right(void* ptr, int n)
+{
+	return new QStringRef(static_cast<QStringRef*>(ptr)->right(n));
+}
+
+void* QStringRef_Trimmed(void* ptr)
+{
+	return new QStringRef(static_cast<QStringRef*>(ptr)->trimmed());
+}
+
+struct QtCore_PackedList QStringRef_Split2(void* ptr, void* sep, long long behavior, long long cs)
+{
+	return ({ QVector<QStringRef>* tmpValue = new QVector<QStringRef>(static_cast<QStringRef*>(ptr)->split(*static_cast<QChar*>(sep), static_cast<QString::SplitBehavior>(behavior), static_cast<Qt::CaseSensitivity>(cs))); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtCore_PackedList QStringRef_Split(void* ptr, char* sep, long long behavior, long long cs)
+{
+	return ({ QVector<QStringRef>* tmpValue = new QVector<QStringRef>(static_cast<QStringRef*>(ptr)->split(QString(sep), static_cast<QString::SplitBehavior>(behavior), static_cast<Qt::CaseSensitivity>(cs))); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtCore_PackedList QStringRef_ToUcs4(void* ptr)
+{
+	return ({ QVector<uint>* tmpValue = new QVector<uint>(static_cast<QStringRef*>(ptr)->toUcs4()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+char QStringRef_Contains2(void* ptr, void* ch, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->contains(*static_cast<QChar*>(ch), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_Contains3(void* ptr, void* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->contains(*static_cast<QLatin1String*>(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_Contains(void* ptr, char* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->contains(QString(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_Contains4(void* ptr, void* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->contains(*static_cast<QStringRef*>(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_EndsWith3(void* ptr, void* ch, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->endsWith(*static_cast<QChar*>(ch), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_EndsWith2(void* ptr, void* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->endsWith(*static_cast<QLatin1String*>(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_EndsWith(void* ptr, char* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->endsWith(QString(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_EndsWith4(void* ptr, void* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->endsWith(*static_cast<QStringRef*>(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_IsEmpty(void* ptr)
+{
+	return static_cast<QStringRef*>(ptr)->isEmpty();
+}
+
+char QStringRef_IsNull(void* ptr)
+{
+	return static_cast<QStringRef*>(ptr)->isNull();
+}
+
+char QStringRef_StartsWith3(void* ptr, void* ch, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->startsWith(*static_cast<QChar*>(ch), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_StartsWith2(void* ptr, void* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->startsWith(*static_cast<QLatin1String*>(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_StartsWith(void* ptr, char* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->startsWith(QString(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+char QStringRef_StartsWith4(void* ptr, void* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->startsWith(*static_cast<QStringRef*>(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+void* QStringRef_ConstData(void* ptr)
+{
+	return const_cast<QChar*>(static_cast<QStringRef*>(ptr)->constData());
+}
+
+void* QStringRef_Data(void* ptr)
+{
+	return const_cast<QChar*>(static_cast<QStringRef*>(ptr)->data());
+}
+
+void* QStringRef_Unicode(void* ptr)
+{
+	return const_cast<QChar*>(static_cast<QStringRef*>(ptr)->unicode());
+}
+
+void* QStringRef_At(void* ptr, int position)
+{
+	return new QChar(static_cast<QStringRef*>(ptr)->at(position));
+}
+
+struct QtCore_PackedString QStringRef_String(void* ptr)
+{
+	return ({ QByteArray t75a779 = static_cast<QStringRef*>(ptr)->string()->toUtf8(); QtCore_PackedString { const_cast<char*>(t75a779.prepend("WHITESPACE").constData()+10), t75a779.size()-10 }; });
+}
+
+double QStringRef_ToDouble(void* ptr, char ok)
+{
+	return static_cast<QStringRef*>(ptr)->toDouble(NULL);
+}
+
+float QStringRef_ToFloat(void* ptr, char ok)
+{
+	return static_cast<QStringRef*>(ptr)->toFloat(NULL);
+}
+
+int QStringRef_Compare3(void* ptr, void* other, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->compare(*static_cast<QLatin1String*>(other), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_Compare4(void* ptr, void* other, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->compare(*static_cast<QByteArray*>(other), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_Compare5(void* ptr, char* other, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->compare(QString(other), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_Compare2(void* ptr, void* other, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->compare(*static_cast<QStringRef*>(other), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_Count(void* ptr)
+{
+	return static_cast<QStringRef*>(ptr)->count();
+}
+
+int QStringRef_Count3(void* ptr, void* ch, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->count(*static_cast<QChar*>(ch), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_Count2(void* ptr, char* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->count(QString(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_Count4(void* ptr, void* str, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->count(*static_cast<QStringRef*>(str), static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_IndexOf2(void* ptr, void* ch, int from, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->indexOf(*static_cast<QChar*>(ch), from, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_IndexOf3(void* ptr, void* str, int from, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->indexOf(*static_cast<QLatin1String*>(str), from, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_IndexOf(void* ptr, char* str, int from, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->indexOf(QString(str), from, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_IndexOf4(void* ptr, void* str, int from, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->indexOf(*static_cast<QStringRef*>(str), from, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_LastIndexOf2(void* ptr, void* ch, int from, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->lastIndexOf(*static_cast<QChar*>(ch), from, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_LastIndexOf3(void* ptr, void* str, int from, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->lastIndexOf(*static_cast<QLatin1String*>(str), from, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_LastIndexOf(void* ptr, char* str, int from, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->lastIndexOf(QString(str), from, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_LastIndexOf4(void* ptr, void* str, int from, long long cs)
+{
+	return static_cast<QStringRef*>(ptr)->lastIndexOf(*static_cast<QStringRef*>(str), from, static_cast<Qt::CaseSensitivity>(cs));
+}
+
+int QStringRef_Length(void* ptr)
+{
+	return static_cast<QStringRef*>(ptr)->length();
+}
+
+int QStringRef_LocaleAwareCompare3(void* ptr, char* other)
+{
+	return static_cast<QStringRef*>(ptr)->localeAwareCompare(QString(other));
+}
+
+int QStringRef_LocaleAwareCompare2(void* ptr, void* other)
+{
+	return static_cast<QStringRef*>(ptr)->localeAwareCompare(*static_cast<QStringRef*>(other));
+}
+
+int QStringRef_Position(void* ptr)
+{
+	return static_cast<QStringRef*>(ptr)->position();
+}
+
+int QStringRef_Size(void* ptr)
+{
+	return static_cast<QStringRef*>(ptr)->size();
+}
+
+int QStringRef_ToInt(void* ptr, char ok, int base)
+{
+	return static_cast<QStringRef*>(ptr)->toInt(NULL, base);
+}
+
+long QStringRef_ToLong(void* ptr, char ok, int base)
+{
+	return static_cast<QStringRef*>(ptr)->toLong(NULL, base);
+}
+
+long long QStringRef_ToLongLong(void* ptr, char ok, int base)
+{
+	return static_cast<QStringRef*>(ptr)->toLongLong(NULL, base);
+}
+
+unsigned long long QStringRef_ToULongLong(void* ptr, char ok, int base)
+{
+	return static_cast<QStringRef*>(ptr)->toULongLong(NULL, base);
+}
+
+short QStringRef_ToShort(void* ptr, char ok, int base)
+{
+	return static_cast<QStringRef*>(ptr)->toShort(NULL, base);
+}
+
+unsigned int QStringRef_ToUInt(void* ptr, char ok, int base)
+{
+	return static_cast<QStringRef*>(ptr)->toUInt(NULL, base);
+}
+
+unsigned long QStringRef_ToULong(void* ptr, char ok, int base)
+{
+	return static_cast<QStringRef*>(ptr)->toULong(NULL, base);
+}
+
+unsigned short QStringRef_ToUShort(void* ptr, char ok, int base)
+{
+	return static_cast<QStringRef*>(ptr)->toUShort(NULL, base);
+}
+
+void* QStringRef___split_atList2(void* ptr, int i)
+{
+	return new QStringRef(static_cast<QVector<QStringRef>*>(ptr)->at(i));
+}
+
+void QStringRef___split_setList2(void* ptr, void* i)
+{
+	static_cast<QVector<QStringRef>*>(ptr)->append(*static_cast<QStringRef*>(i));
+}
+
+void* QStringRef___split_newList2(void* ptr)
+{
+	return new QVector<QStringRef>;
+}
+
+void* QStringRef___split_atList(void* ptr, int i)
+{
+	return new QStringRef(static_cast<QVector<QStringRef>*>(ptr)->at(i));
+}
+
+void QStringRef___split_setList(void* ptr, void* i)
+{
+	static_cast<QVector<QStringRef>*>(ptr)->append(*static_cast<QStringRef*>(i));
+}
+
+void* QStringRef___split_newList(void* ptr)
+{
+	return new QVector<QStringRef>;
+}
+
+unsigned int QStringRef___toUcs4_atList(void* ptr, int i)
+{
+	return static_cast<QVector<uint>*>(ptr)->at(i);
+}
+
+void QStringRef___toUcs4_setList(void* ptr, unsigned int i)
+{
+	static_cast<QVector<uint>*>(ptr)->append(i);
+}
+
+void* QStringRef___toUcs4_newList(void* ptr)
+{
+	return new QVector<uint>;
+}
+
+int QSysInfo_MV_9_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_9;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_1_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_1;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_2_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_2;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_3_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_3;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_4_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_4;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_5_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_5;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_6_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_6;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_7_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_7;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_8_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_8;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_9_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_9;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_10_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_10;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_11_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_11;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_10_12_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_10_12;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_4_3_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_4_3;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_5_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_5_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_5_1_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_5_1;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_6_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_6_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_6_1_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_6_1;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_7_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_7_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_7_1_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_7_1;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_8_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_8_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_8_1_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_8_1;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_8_2_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_8_2;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_8_3_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_8_3;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_8_4_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_8_4;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_9_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_9_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_9_1_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_9_1;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_9_2_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_9_2;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_9_3_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_9_3;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_IOS_10_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_IOS_10_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_TVOS_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_TVOS;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_TVOS_9_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_TVOS_9_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_TVOS_9_1_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_TVOS_9_1;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_TVOS_9_2_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_TVOS_9_2;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_TVOS_10_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_TVOS_10_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_WATCHOS_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_WATCHOS;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_WATCHOS_2_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_WATCHOS_2_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_WATCHOS_2_1_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_WATCHOS_2_1;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_WATCHOS_2_2_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_WATCHOS_2_2;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_MV_WATCHOS_3_0_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QSysInfo::MV_WATCHOS_3_0;
+	#else
+		return 0;
+	#endif
+}
+
+int QSysInfo_WordSize_Type()
+{
+	return QSysInfo::WordSize;
+}
+
+long long QSysInfo_QSysInfo_MacVersion()
+{
+	return QSysInfo::macVersion();
+}
+
+struct QtCore_PackedString QSysInfo_QSysInfo_BuildAbi()
+{
+	return ({ QByteArray t231d28 = QSysInfo::buildAbi().toUtf8(); QtCore_PackedString { const_cast<char*>(t231d28.prepend("WHITESPACE").constData()+10), t231d28.size()-10 }; });
+}
+
+struct QtCore_PackedString QSysInfo_QSysInfo_BuildCpuArchitecture()
+{
+	return ({ QByteArray t3eb43d = QSysInfo::buildCpuArchitecture().toUtf8(); QtCore_PackedString { const_cast<char*>(t3eb43d.prepend("WHITESPACE").constData()+10), t3eb43d.size()-10 }; });
+}
+
+struct QtCore_PackedString QSysInfo_QSysInfo_CurrentCpuArchitecture()
+{
+	return ({ QByteArray t58cec8 = QSysInfo::currentCpuArchitecture().toUtf8(); QtCore_PackedString { const_cast<char*>(t58cec8.prepend("WHITESPACE").constData()+10), t58cec8.size()-10 }; });
+}
+
+struct QtCore_PackedString QSysInfo_QSysInfo_KernelType()
+{
+	return ({ QByteArray t17bcdb = QSysInfo::kernelType().toUtf8(); QtCore_PackedString { const_cast<char*>(t17bcdb.prepend("WHITESPACE").constData()+10), t17bcdb.size()-10 }; });
+}
+
+struct QtCore_PackedString QSysInfo_QSysInfo_KernelVersion()
+{
+	return ({ QByteArray t25443e = QSysInfo::kernelVersion().toUtf8(); QtCore_PackedString { const_cast<char*>(t25443e.prepend("WHITESPACE").constData()+10), t25443e.size()-10 }; });
+}
+
+struct QtCore_PackedString QSysInfo_QSysInfo_MachineHostName()
+{
+	return ({ QByteArray t05046f = QSysInfo::machineHostName().toUtf8(); QtCore_PackedString { const_cast<char*>(t05046f.prepend("WHITESPACE").constData()+10), t05046f.size()-10 }; });
+}
+
+struct QtCore_PackedString QSysInfo_QSysInfo_PrettyProductName()
+{
+	return ({ QByteArray t377223 = QSysInfo::prettyProductName().toUtf8(); QtCore_PackedString { const_cast<char*>(t377223.prepend("WHITESPACE").constData()+10), t377223.size()-10 }; });
+}
+
+struct QtCore_PackedString QSysInfo_QSysInfo_ProductType()
+{
+	return ({ QByteArray t2dc849 = QSysInfo::productType().toUtf8(); QtCore_PackedString { const_cast<char*>(t2dc849.prepend("WHITESPACE").constData()+10), t2dc849.size()-10 }; });
+}
+
+struct QtCore_PackedString QSysInfo_QSysInfo_ProductVersion()
+{
+	return ({ QByteArray tf9eb38 = QSysInfo::productVersion().toUtf8(); QtCore_PackedString { const_cast<char*>(tf9eb38.prepend("WHITESPACE").constData()+10), tf9eb38.size()-10 }; });
+}
+
+long long QSysInfo_QSysInfo_WindowsVersion()
+{
+	return QSysInfo::windowsVersion();
+}
+
+long long QSysInfo_QSysInfo_MacintoshVersion()
+{
+	return QSysInfo::MacintoshVersion;
+}
+
+void* QSystemSemaphore_NewQSystemSemaphore(char* key, int initialValue, long long mode)
+{
+	return new QSystemSemaphore(QString(key), initialValue, static_cast<QSystemSemaphore::AccessMode>(mode));
+}
+
+void* QSystemSemaphore_NewQSystemSemaphoreInArena(void* arena, char* key, int initialValue, long long mode)
+{
+	return new (goArenaAlloc<QSystemSemaphore>(arena)) QSystemSemaphore(QString(key), initialValue, static_cast<QSystemSemaphore::AccessMode>(mode));
+}
+
+char QSystemSemaphore_Acquire(void* ptr)
+{
+	return static_cast<QSystemSemaphore*>(ptr)->acquire();
+}
+
+char QSystemSemaphore_Release(void* ptr, int n)
+{
+	return static_cast<QSystemSemaphore*>(ptr)->release(n);
+}
+
+void QSystemSemaphore_SetKey(void* ptr, char* key, int initialValue, long long mode)
+{
+	static_cast<QSystemSemaphore*>(ptr)->setKey(QString(key), initialValue, static_cast<QSystemSemaphore::AccessMode>(mode));
+}
+
+void QSystemSemaphore_DestroyQSystemSemaphore(void* ptr)
+{
+	static_cast<QSystemSemaphore*>(ptr)->~QSystemSemaphore();
+}
+
+struct QtCore_PackedString QSystemSemaphore_ErrorString(void* ptr)
+{
+	return ({ QByteArray te02386 = static_cast<QSystemSemaphore*>(ptr)->errorString().toUtf8(); QtCore_PackedString { const_cast<char*>(te02386.prepend("WHITESPACE").constData()+10), te02386.size()-10 }; });
+}
+
+struct QtCore_PackedString QSystemSemaphore_Key(void* ptr)
+{
+	return ({ QByteArray tdbcddf = static_cast<QSystemSemaphore*>(ptr)->key().toUtf8(); QtCore_PackedString { const_cast<char*>(tdbcddf.prepend("WHITESPACE").constData()+10), tdbcddf.size()-10 }; });
+}
+
+long long QSystemSemaphore_Error(void* ptr)
+{
+	return static_cast<QSystemSemaphore*>(ptr)->error();
+}
+
+void* QTemporaryDir_NewQTemporaryDir()
+{
+	return new QTemporaryDir();
+}
+
+void* QTemporaryDir_NewQTemporaryDirInArena(void* arena)
+{
+	return new (goArenaAlloc<QTemporaryDir>(arena)) QTemporaryDir();
+}
+
+void* QTemporaryDir_NewQTemporaryDir2(char* templatePath)
+{
+	return new QTemporaryDir(QString(templatePath));
+}
+
+void* QTemporaryDir_NewQTemporaryDir2InArena(void* arena, char* templatePath)
+{
+	return new (goArenaAlloc<QTemporaryDir>(arena)) QTemporaryDir(QString(templatePath));
+}
+
+char QTemporaryDir_Remove(void* ptr)
+{
+	return static_cast<QTemporaryDir*>(ptr)->remove();
+}
+
+void QTemporaryDir_SetAutoRemove(void* ptr, char b)
+{
+	static_cast<QTemporaryDir*>(ptr)->setAutoRemove(b != 0);
+}
+
+void QTemporaryDir_DestroyQTemporaryDir(void* ptr)
+{
+	static_cast<QTemporaryDir*>(ptr)->~QTemporaryDir();
+}
+
+struct QtCore_PackedString QTemporaryDir_ErrorString(void* ptr)
+{
+	return ({ QByteArray t501345 = static_cast<QTemporaryDir*>(ptr)->errorString().toUtf8(); QtCore_PackedString { const_cast<char*>(t501345.prepend("WHITESPACE").constData()+10), t501345.size()-10 }; });
+}
+
+struct QtCore_PackedString QTemporaryDir_Path(void* ptr)
+{
+	return ({ QByteArray tec09d2 = static_cast<QTemporaryDir*>(ptr)->path().toUtf8(); QtCore_PackedString { const_cast<char*>(tec09d2.prepend("WHITESPACE").constData()+10), tec09d2.size()-10 }; });
+}
+
+char QTemporaryDir_AutoRemove(void* ptr)
+{
+	return static_cast<QTemporaryDir*>(ptr)->autoRemove();
+}
+
+char QTemporaryDir_IsValid(void* ptr)
+{
+	return static_cast<QTemporaryDir*>(ptr)->isValid();
+}
+
+class MyQTemporaryFile: public QTemporaryFile
+{
+public:
+	MyQTemporaryFile() : QTemporaryFile() {};
+	MyQTemporaryFile(QObject *parent) : QTemporaryFile(parent) {};
+	MyQTemporaryFile(const QString &templateName) : QTemporaryFile(templateName) {};
+	MyQTemporaryFile(const QString &templateName, QObject *parent) : QTemporaryFile(templateName, parent) {};
+	QString fileName() const { return QString(callbackQFileDevice_FileName(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool open(QIODevice::OpenMode mode) { return callbackQIODevice_Open(this, mode) != 0; };
+	bool resize(qint64 sz) { return callbackQFileDevice_Resize(this, sz) != 0; };
+	bool setPermissions(QFileDevice::Permissions permissions) { return callbackQFileDevice_SetPermissions(this, permissions) != 0; };
+	Permissions permissions() const { return static_cast<QFileDevice::Permission>(callbackQFileDevice_Permissions(const_cast<void*>(static_cast<const void*>(this)))); };
+	qint64 size() const { return callbackQIODevice_Size(const_cast<void*>(static_cast<const void*>(this))); };
+	bool seek(qint64 pos) { return callbackQIODevice_Seek(this, pos) != 0; };
+	qint64 readData(char * data, qint64 len) { QtCore_PackedString dataPacked = { data, len };return callbackQFileDevice_ReadData(this, dataPacked, len); };
+	qint64 readLineData(char * data, qint64 maxlen) { QtCore_PackedString dataPacked = { data, maxlen };return callbackQIODevice_ReadLineData(this, dataPacked, maxlen); };
+	qint64 writeData(const char * data, qint64 len) { QtCore_PackedString dataPacked = { const_cast<char*>(data), len };return callbackQFileDevice_WriteData(this, dataPacked, len); };
+	void close() { callbackQIODevice_Close(this); };
+	bool atEnd() const { return callbackQIODevice_AtEnd(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	bool isSequential() const { return callbackQIODevice_IsSequential(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	qint64 pos() const { return callbackQIODevice_Pos(const_cast<void*>(static_cast<const void*>(this))); };
+	bool reset() { return callbackQIODevice_Reset(this) != 0; };
+	bool waitForBytesWritten(int msecs) { return callbackQIODevice_WaitForBytesWritten(this, msecs) != 0; };
+	bool waitForReadyRead(int msecs) { return callbackQIODevice_WaitForReadyRead(this, msecs) != 0; };
+	void Signal_AboutToClose() { callbackQIODevice_AboutToClose(this); };
+	void Signal_BytesWritten(qint64 bytes) { callbackQIODevice_BytesWritten(this, bytes); };
+	void Signal_ChannelBytesWritten(int channel, qint64 bytes) { callbackQIODevice_ChannelBytesWritten(this, channel, bytes); };
+	void Signal_ChannelReadyRead(int channel) { callbackQIODevice_ChannelReadyRead(this, channel); };
+	void Signal_ReadChannelFinished() { callbackQIODevice_ReadChannelFinished(this); };
+	void Signal_ReadyRead() { callbackQIODevice_ReadyRead(this); };
+	bool canReadLine() const { return callbackQIODevice_CanReadLine(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	qint64 bytesAvailable() const { return callbackQIODevice_BytesAvailable(const_cast<void*>(static_cast<const void*>(this))); };
+	qint64 bytesToWrite() const { return callbackQIODevice_BytesToWrite(const_cast<void*>(static_cast<const void*>(this))); };
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QTemporaryFile_QTemporaryFile_CreateNativeFile(void* file)
+{
+	return QTemporaryFile::createNativeFile(*static_cast<QFile*>(file));
+}
+
+void* QTemporaryFile_QTemporaryFile_CreateNativeFile2(char* fileName)
+{
+	return QTemporaryFile::createNativeFile(QString(fileName));
+}
+
+void* QTemporaryFile_NewQTemporaryFile()
+{
+	return new MyQTemporaryFile();
+}
+
+void* QTemporaryFile_NewQTemporaryFile3(void* parent)
+{
+	return new MyQTemporaryFile(static_cast<QObject*>(parent));
+}
+
+void* QTemporaryFile_NewQTemporaryFile2(char* templateName)
+{
+	return new MyQTemporaryFile(QString(templateName));
+}
+
+void* QTemporaryFile_NewQTemporaryFile4(char* templateName, void* parent)
+{
+	return new MyQTemporaryFile(QString(templateName), static_cast<QObject*>(parent));
+}
+
+char QTemporaryFile_Open(void* ptr)
+{
+	return static_cast<QTemporaryFile*>(ptr)->open();
+}
+
+void QTemporaryFile_SetAutoRemove(void* ptr, char b)
+{
+	static_cast<QTemporaryFile*>(ptr)->setAutoRemove(b != 0);
+}
+
+void QTemporaryFile_SetFileTemplate(void* ptr, char* name)
+{
+	static_cast<QTemporaryFile*>(ptr)->setFileTemplate(QString(name));
+}
+
+void QTemporaryFile_DestroyQTemporaryFile(void* ptr)
+{
+	static_cast<QTemporaryFile*>(ptr)->~QTemporaryFile();
+}
+
+struct QtCore_PackedString QTemporaryFile_FileTemplate(void* ptr)
+{
+	return ({ QByteArray t23cbd0 = static_cast<QTemporaryFile*>(ptr)->fileTemplate().toUtf8(); QtCore_PackedString { const_cast<char*>(t23cbd0.prepend("WHITESPACE").constData()+10), t23cbd0.size()-10 }; });
+}
+
+char QTemporaryFile_AutoRemove(void* ptr)
+{
+	return static_cast<QTemporaryFile*>(ptr)->autoRemove();
+}
+
+void* QTextBoundaryFinder_NewQTextBoundaryFinder()
+{
+	return new QTextBoundaryFinder();
+}
+
+void* QTextBoundaryFinder_NewQTextBoundaryFinderInArena(void* arena)
+{
+	return new (goArenaAlloc<QTextBoundaryFinder>(arena)) QTextBoundaryFinder();
+}
+
+void* QTextBoundaryFinder_NewQTextBoundaryFinder3(long long ty, char* stri)
+{
+	return new QTextBoundaryFinder(static_cast<QTextBoundaryFinder::BoundaryType>(ty), QString(stri));
+}
+
+void* QTextBoundaryFinder_NewQTextBoundaryFinder3InArena(void* arena, long long ty, char* stri)
+{
+	return new (goArenaAlloc<QTextBoundaryFinder>(arena)) QTextBoundaryFinder(static_cast<QTextBoundaryFinder::BoundaryType>(ty), QString(stri));
+}
+
+void* QTextBoundaryFinder_NewQTextBoundaryFinder2(void* other)
+{
+	return new QTextBoundaryFinder(*static_cast<QTextBoundaryFinder*>(other));
+}
+
+void* QTextBoundaryFinder_NewQTextBoundaryFinder2InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QTextBoundaryFinder>(arena)) QTextBoundaryFinder(*static_cast<QTextBoundaryFinder*>(other));
+}
+
+int QTextBoundaryFinder_ToNextBoundary(void* ptr)
+{
+	return static_cast<QTextBoundaryFinder*>(ptr)->toNextBoundary();
+}
+
+int QTextBoundaryFinder_ToPreviousBoundary(void* ptr)
+{
+	return static_cast<QTextBoundaryFinder*>(ptr)->toPreviousBoundary();
+}
+
+void QTextBoundaryFinder_SetPosition(void* ptr, int position)
+{
+	static_cast<QTextBoundaryFinder*>(ptr)->setPosition(position);
+}
+
+void QTextBoundaryFinder_ToEnd(void* ptr)
+{
+	static_cast<QTextBoundaryFinder*>(ptr)->toEnd();
+}
+
+void QTextBoundaryFinder_ToStart(void* ptr)
+{
+	static_cast<QTextBoundaryFinder*>(ptr)->toStart();
+}
+
+void QTextBoundaryFinder_DestroyQTextBoundaryFinder(void* ptr)
+{
+	static_cast<QTextBoundaryFinder*>(ptr)->~QTextBoundaryFinder();
+}
+
+long long QTextBoundaryFinder_BoundaryReasons(void* ptr)
+{
+	return static_cast<QTextBoundaryFinder*>(ptr)->boundaryReasons();
+}
+
+long long QTextBoundaryFinder_Type(void* ptr)
+{
+	return static_cast<QTextBoundaryFinder*>(ptr)->type();
+}
+
+struct QtCore_PackedString QTextBoundaryFinder_String(void* ptr)
+{
+	return ({ QByteArray t2d3858 = static_cast<QTextBoundaryFinder*>(ptr)->string().toUtf8(); QtCore_PackedString { const_cast<char*>(t2d3858.prepend("WHITESPACE").constData()+10), t2d3858.size()-10 }; });
+}
+
+char QTextBoundaryFinder_IsAtBoundary(void* ptr)
+{
+	return static_cast<QTextBoundaryFinder*>(ptr)->isAtBoundary();
+}
+
+char QTextBoundaryFinder_IsValid(void* ptr)
+{
+	return static_cast<QTextBoundaryFinder*>(ptr)->isValid();
+}
+
+int QTextBoundaryFinder_Position(void* ptr)
+{
+	return static_cast<QTextBoundaryFinder*>(ptr)->position();
+}
+
+class MyQTextCodec: public QTextCodec
+{
+public:
+	 ~MyQTextCodec() { callbackQTextCodec_DestroyQTextCodec(this); };
+	QByteArray name() const { return *static_cast<QByteArray*>(callbackQTextCodec_Name(const_cast<void*>(static_cast<const void*>(this)))); };
+	QList<QByteArray> aliases() const { return *static_cast<QList<QByteArray>*>(callbackQTextCodec_Aliases(const_cast<void*>(static_cast<const void*>(this)))); };
+	
+	int mibEnum() const { return callbackQTextCodec_MibEnum(const_cast<void*>(static_cast<const void*>(this))); };
+};
+
+struct QtCore_PackedString QTextCodec_QTextCodec_AvailableCodecs()
+{
+	return ({ long long t6a90cdlen; char* t6a90cd = goPackStringList(QTextCodec::availableCodecs(), &t6a90cdlen); QtCore_PackedString { t6a90cd, t6a90cdlen }; });
+}
+
+struct QtCore_PackedList QTextCodec_QTextCodec_AvailableMibs()
+{
+	return ({ QList<int>* tmpValue = new QList<int>(QTextCodec::availableMibs()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QTextCodec_QTextCodec_CodecForHtml2(void* ba)
+{
+	return QTextCodec::codecForHtml(*static_cast<QByteArray*>(ba));
+}
+
+void* QTextCodec_QTextCodec_CodecForHtml(void* ba, void* defaultCodec)
+{
+	return QTextCodec::codecForHtml(*static_cast<QByteArray*>(ba), static_cast<QTextCodec*>(defaultCodec));
+}
+
+void* QTextCodec_QTextCodec_CodecForLocale()
+{
+	return QTextCodec::codecForLocale();
+}
+
+void* QTextCodec_QTextCodec_CodecForMib(int mib)
+{
+	return QTextCodec::codecForMib(mib);
+}
+
+void* QTextCodec_QTextCodec_CodecForName(void* name)
+{
+	return QTextCodec::codecForName(*static_cast<QByteArray*>(name));
+}
+
+void* QTextCodec_QTextCodec_CodecForName2(char* name)
+{
+	return QTextCodec::codecForName(const_cast<const char*>(name));
+}
+
+void* QTextCodec_QTextCodec_CodecForUtfText2(void* ba)
+{
+	return QTextCodec::codecForUtfText(*static_cast<QByteArray*>(ba));
+}
+
+void* QTextCodec_QTextCodec_CodecForUtfText(void* ba, void* defaultCodec)
+{
+	return QTextCodec::codecForUtfText(*static_cast<QByteArray*>(ba), static_cast<QTextCodec*>(defaultCodec));
+}
+
+void QTextCodec_QTextCodec_SetCodecForLocale(void* c)
+{
+	QTextCodec::setCodecForLocale(static_cast<QTextCodec*>(c));
+}
+
+void QTextCodec_DestroyQTextCodec(void* ptr)
+{
+	static_cast<QTextCodec*>(ptr)->~QTextCodec();
+}
+
+void QTextCodec_DestroyQTextCodecDefault(void* ptr)
+{
+
+}
+
+void* QTextCodec_FromUnicode(void* ptr, char* str)
+{
+	return new QByteArray(static_cast<QTextCodec*>(ptr)->fromUnicode(QString(str)));
+}
+
+void* QTextCodec_Name(void* ptr)
+{
+	return new QByteArray(static_cast<QTextCodec*>(ptr)->name());
+}
+
+struct QtCore_PackedString QTextCodec_Aliases(void* ptr)
+{
+	return ({ long long tb6774elen; char* tb6774e = goPackStringList(static_cast<QTextCodec*>(ptr)->aliases(), &tb6774elen); QtCore_PackedString { tb6774e, tb6774elen }; });
+}
+
+struct QtCore_PackedString QTextCodec_AliasesDefault(void* ptr)
+{
+		return ({ long long te659ddlen; char* te659dd = goPackStringList(static_cast<QTextCodec*>(ptr)->QTextCodec::aliases(), &te659ddlen); QtCore_PackedString { te659dd, te659ddlen }; });
+}
+
+struct QtCore_PackedString QTextCodec_ToUnicode(void* ptr, void* a)
+{
+	return ({ QByteArray te3183b = static_cast<QTextCodec*>(ptr)->toUnicode(*static_cast<QByteArray*>(a)).toUtf8(); QtCore_PackedString { const_cast<char*>(te3183b.prepend("WHITESPACE").constData()+10), te3183b.size()-10 }; });
+}
+
+struct QtCore_PackedString QTextCodec_ToUnicode2(void* ptr, char* chars)
+{
+	return ({ QByteArray t6b92b5 = static_cast<QTextCodec*>(ptr)->toUnicode(const_cast<const char*>(chars)).toUtf8(); QtCore_PackedString { const_cast<char*>(t6b92b5.prepend("WHITESPACE").constData()+10), t6b92b5.size()-10 }; });
+}
+
+void* QTextCodec_MakeDecoder(void* ptr, long long flags)
+{
+	return static_cast<QTextCodec*>(ptr)->makeDecoder(static_cast<QTextCodec::ConversionFlag>(flags));
+}
+
+void* QTextCodec_MakeEncoder(void* ptr, long long flags)
+{
+	return static_cast<QTextCodec*>(ptr)->makeEncoder(static_cast<QTextCodec::ConversionFlag>(flags));
+}
+
+char QTextCodec_CanEncode(void* ptr, void* ch)
+{
+	return static_cast<QTextCodec*>(ptr)->canEncode(*static_cast<QChar*>(ch));
+}
+
+char QTextCodec_CanEncode2(void* ptr, char* s)
+{
+	return static_cast<QTextCodec*>(ptr)->canEncode(QString(s));
+}
+
+int QTextCodec_MibEnum(void* ptr)
+{
+	return static_cast<QTextCodec*>(ptr)->mibEnum();
+}
+
+void* QTextCodec___availableCodecs_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTextCodec___availableCodecs_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTextCodec___availableCodecs_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+int QTextCodec___availableMibs_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QTextCodec___availableMibs_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QTextCodec___availableMibs_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QTextCodec___availableMibs_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QTextCodec___availableMibs_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void* QTextCodec___aliases_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTextCodec___aliases_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTextCodec___aliases_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+struct QtCore_PackedString QTextDecoder_ToUnicode2(void* ptr, void* ba)
+{
+	return ({ QByteArray t597c34 = static_cast<QTextDecoder*>(ptr)->toUnicode(*static_cast<QByteArray*>(ba)).toUtf8(); QtCore_PackedString { const_cast<char*>(t597c34.prepend("WHITESPACE").constData()+10), t597c34.size()-10 }; });
+}
+
+struct QtCore_PackedString QTextDecoder_ToUnicode(void* ptr, char* chars, int len)
+{
+	return ({ QByteArray tc008d9 = static_cast<QTextDecoder*>(ptr)->toUnicode(const_cast<const char*>(chars), len).toUtf8(); QtCore_PackedString { const_cast<char*>(tc008d9.prepend("WHITESPACE").constData()+10), tc008d9.size()-10 }; });
+}
+
+void* QTextDecoder_NewQTextDecoder(void* codec)
+{
+	return new QTextDecoder(static_cast<QTextCodec*>(codec));
+}
+
+void* QTextDecoder_NewQTextDecoderInArena(void* arena, void* codec)
+{
+	return new (goArenaAlloc<QTextDecoder>(arena)) QTextDecoder(static_cast<QTextCodec*>(codec));
+}
+
+void* QTextDecoder_NewQTextDecoder2(void* codec, long long flags)
+{
+	return new QTextDecoder(static_cast<QTextCodec*>(codec), static_cast<QTextCodec::ConversionFlag>(flags));
+}
+
+void* QTextDecoder_NewQTextDecoder2InArena(void* arena, void* codec, long long flags)
+{
+	return new (goArenaAlloc<QTextDecoder>(arena)) QTextDecoder(static_cast<QTextCodec*>(codec), static_cast<QTextCodec::ConversionFlag>(flags));
+}
+
+void QTextDecoder_ToUnicode3(void* ptr, char* target, char* chars, int len)
+{
+	static_cast<QTextDecoder*>(ptr)->toUnicode(new QString(target), const_cast<const char*>(chars), len);
+}
+
+void QTextDecoder_DestroyQTextDecoder(void* ptr)
+{
+	static_cast<QTextDecoder*>(ptr)->~QTextDecoder();
+}
+
+void* QTextEncoder_FromUnicode2(void* ptr, void* uc, int len)
+{
+	return new QByteArray(static_cast<QTextEncoder*>(ptr)->fromUnicode(static_cast<QChar*>(uc), len));
+}
+
+void* QTextEncoder_FromUnicode(void* ptr, char* str)
+{
+	return new QByteArray(static_cast<QTextEncoder*>(ptr)->fromUnicode(QString(str)));
+}
+
+void* QTextEncoder_NewQTextEncoder(void* codec)
+{
+	return new QTextEncoder(static_cast<QTextCodec*>(codec));
+}
+
+void* QTextEncoder_NewQTextEncoderInArena(void* arena, void* codec)
+{
+	return new (goArenaAlloc<QTextEncoder>(arena)) QTextEncoder(static_cast<QTextCodec*>(codec));
+}
+
+void* QTextEncoder_NewQTextEncoder2(void* codec, long long flags)
+{
+	return new QTextEncoder(static_cast<QTextCodec*>(codec), static_cast<QTextCodec::ConversionFlag>(flags));
+}
+
+void* QTextEncoder_NewQTextEncoder2InArena(void* arena, void* codec, long long flags)
+{
+	return new (goArenaAlloc<QTextEncoder>(arena)) QTextEncoder(static_cast<QTextCodec*>(codec), static_cast<QTextCodec::ConversionFlag>(flags));
+}
+
+void QTextEncoder_DestroyQTextEncoder(void* ptr)
+{
+	static_cast<QTextEncoder*>(ptr)->~QTextEncoder();
+}
+
+class MyQTextStream: public QTextStream
+{
+public:
+	MyQTextStream() : QTextStream() {};
+	MyQTextStream(QByteArray *array, QIODevice::OpenMode openMode) : QTextStream(array, openMode) {};
+	MyQTextStream(QIODevice *device) : QTextStream(device) {};
+	MyQTextStream(QString *string, QIODevice::OpenMode openMode) : QTextStream(string, openMode) {};
+	MyQTextStream(const QByteArray &array, QIODevice::OpenMode openMode) : QTextStream(array, openMode) {};
+	 ~MyQTextStream() { callbackQTextStream_DestroyQTextStream(this); };
+};
+
+struct QtCore_PackedString QTextStream_Read(void* ptr, long long maxlen)
+{
+	return ({ QByteArray t1ba29b = static_cast<QTextStream*>(ptr)->read(maxlen).toUtf8(); QtCore_PackedString { const_cast<char*>(t1ba29b.prepend("WHITESPACE").constData()+10), t1ba29b.size()-10 }; });
+}
+
+struct QtCore_PackedString QTextStream_ReadAll(void* ptr)
+{
+	return ({ QByteArray t3976a4 = static_cast<QTextStream*>(ptr)->readAll().toUtf8(); QtCore_PackedString { const_cast<char*>(t3976a4.prepend("WHITESPACE").constData()+10), t3976a4.size()-10 }; });
+}
+
+struct QtCore_PackedString QTextStream_ReadLine(void* ptr, long long maxlen)
+{
+	return ({ QByteArray t7fab2e = static_cast<QTextStream*>(ptr)->readLine(maxlen).toUtf8(); QtCore_PackedString { const_cast<char*>(t7fab2e.prepend("WHITESPACE").constData()+10), t7fab2e.size()-10 }; });
+}
+
+void* QTextStream_NewQTextStream()
+{
+	return new MyQTextStream();
+}
+
+void* QTextStream_NewQTextStream5(void* array, long long openMode)
+{
+	return new MyQTextStream(static_cast<QByteArray*>(array), static_cast<QIODevice::OpenModeFlag>(openMode));
+}
+
+void* QTextStream_NewQTextStream2(void* device)
+{
+	return new MyQTextStream(static_cast<QIODevice*>(device));
+}
+
+void* QTextStream_NewQTextStream4(char* stri, long long openMode)
+{
+	return new MyQTextStream(new QString(stri), static_cast<QIODevice::OpenModeFlag>(openMode));
+}
+
+void* QTextStream_NewQTextStream6(void* array, long long openMode)
+{
+	return new MyQTextStream(*static_cast<QByteArray*>(array), static_cast<QIODevice::OpenModeFlag>(openMode));
+}
+
+char QTextStream_ReadLineInto(void* ptr, char* line, long long maxlen)
+{
+	return static_cast<QTextStream*>(ptr)->readLineInto(new QString(line), maxlen);
+}
+
+char QTextStream_Seek(void* ptr, long long pos)
+{
+	return static_cast<QTextStream*>(ptr)->seek(pos);
+}
+
+void QTextStream_Flush(void* ptr)
+{
+	static_cast<QTextStream*>(ptr)->flush();
+}
+
+void QTextStream_Reset(void* ptr)
+{
+	static_cast<QTextStream*>(ptr)->reset();
+}
+
+void QTextStream_ResetStatus(void* ptr)
+{
+	static_cast<QTextStream*>(ptr)->resetStatus();
+}
+
+void QTextStream_SetAutoDetectUnicode(void* ptr, char enabled)
+{
+	static_cast<QTextStream*>(ptr)->setAutoDetectUnicode(enabled != 0);
+}
+
+void QTextStream_SetCodec(void* ptr, void* codec)
+{
+	static_cast<QTextStream*>(ptr)->setCodec(static_cast<QTextCodec*>(codec));
+}
+
+void QTextStream_SetCodec2(void* ptr, char* codecName)
+{
+	static_cast<QTextStream*>(ptr)->setCodec(const_cast<const char*>(codecName));
+}
+
+void QTextStream_SetDevice(void* ptr, void* device)
+{
+	static_cast<QTextStream*>(ptr)->setDevice(static_cast<QIODevice*>(device));
+}
+
+void QTextStream_SetFieldAlignment(void* ptr, long long mode)
+{
+	static_cast<QTextStream*>(ptr)->setFieldAlignment(static_cast<QTextStream::FieldAlignment>(mode));
+}
+
+void QTextStream_SetFieldWidth(void* ptr, int width)
+{
+	static_cast<QTextStream*>(ptr)->setFieldWidth(width);
+}
+
+void QTextStream_SetGenerateByteOrderMark(void* ptr, char generate)
+{
+	static_cast<QTextStream*>(ptr)->setGenerateByteOrderMark(generate != 0);
+}
+
+void QTextStream_SetIntegerBase(void* ptr, int base)
+{
+	static_cast<QTextStream*>(ptr)->setIntegerBase(base);
+}
+
+void QTextStream_SetLocale(void* ptr, void* locale)
+{
+	static_cast<QTextStream*>(ptr)->setLocale(*static_cast<QLocale*>(locale));
+}
+
+void QTextStream_SetNumberFlags(void* ptr, long long flags)
+{
+	static_cast<QTextStream*>(ptr)->setNumberFlags(static_cast<QTextStream::NumberFlag>(flags));
+}
+
+void QTextStream_SetPadChar(void* ptr, void* ch)
+{
+	static_cast<QTextStream*>(ptr)->setPadChar(*static_cast<QChar*>(ch));
+}
+
+void QTextStream_SetRealNumberNotation(void* ptr, long long notation)
+{
+	static_cast<QTextStream*>(ptr)->setRealNumberNotation(static_cast<QTextStream::RealNumberNotation>(notation));
+}
+
+void QTextStream_SetRealNumberPrecision(void* ptr, int precision)
+{
+	static_cast<QTextStream*>(ptr)->setRealNumberPrecision(precision);
+}
+
+void QTextStream_SetStatus(void* ptr, long long status)
+{
+	static_cast<QTextStream*>(ptr)->setStatus(static_cast<QTextStream::Status>(status));
+}
+
+void QTextStream_SetString(void* ptr, char* stri, long long openMode)
+{
+	static_cast<QTextStream*>(ptr)->setString(new QString(stri), static_cast<QIODevice::OpenModeFlag>(openMode));
+}
+
+void QTextStream_SkipWhiteSpace(void* ptr)
+{
+	static_cast<QTextStream*>(ptr)->skipWhiteSpace();
+}
+
+void QTextStream_DestroyQTextStream(void* ptr)
+{
+	static_cast<QTextStream*>(ptr)->~QTextStream();
+}
+
+void QTextStream_DestroyQTextStreamDefault(void* ptr)
+{
+
+}
+
+long long QTextStream_FieldAlignment(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->fieldAlignment();
+}
+
+long long QTextStream_NumberFlags(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->numberFlags();
+}
+
+void* QTextStream_PadChar(void* ptr)
+{
+	return new QChar(static_cast<QTextStream*>(ptr)->padChar());
+}
+
+void* QTextStream_Device(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->device();
+}
+
+void* QTextStream_Locale(void* ptr)
+{
+	return new QLocale(static_cast<QTextStream*>(ptr)->locale());
+}
+
+struct QtCore_PackedString QTextStream_String(void* ptr)
+{
+	return ({ QByteArray t586a42 = static_cast<QTextStream*>(ptr)->string()->toUtf8(); QtCore_PackedString { const_cast<char*>(t586a42.prepend("WHITESPACE").constData()+10), t586a42.size()-10 }; });
+}
+
+void* QTextStream_Codec(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->codec();
+}
+
+long long QTextStream_RealNumberNotation(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->realNumberNotation();
+}
+
+long long QTextStream_Status(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->status();
+}
+
+char QTextStream_AtEnd(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->atEnd();
+}
+
+char QTextStream_AutoDetectUnicode(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->autoDetectUnicode();
+}
+
+char QTextStream_GenerateByteOrderMark(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->generateByteOrderMark();
+}
+
+int QTextStream_FieldWidth(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->fieldWidth();
+}
+
+int QTextStream_IntegerBase(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->integerBase();
+}
+
+int QTextStream_RealNumberPrecision(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->realNumberPrecision();
+}
+
+long long QTextStream_Pos(void* ptr)
+{
+	return static_cast<QTextStream*>(ptr)->pos();
+}
+
+class MyQThread: public QThread
+{
+public:
+	MyQThread(QObject *parent) : QThread(parent) {};
+	bool event(QEvent * event) { return callbackQObject_Event(this, event) != 0; };
+	void Signal_Finished() { callbackQThread_Finished(this); };
+	void quit() { callbackQThread_Quit(this); };
+	void run() { callbackQThread_Run(this); };
+	void start() { callbackQThread_Start(this); };
+	void Signal_Started() { callbackQThread_Started(this); };
+	void terminate() { callbackQThread_Terminate(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+char QThread_Wait(void* ptr, unsigned long time)
+{
+	return static_cast<QThread*>(ptr)->wait(time);
+}
+
+int QThread_QThread_IdealThreadCount()
+{
+	return QThread::idealThreadCount();
+}
+
+void QThread_QThread_Msleep(unsigned long msecs)
+{
+	QThread::msleep(msecs);
+}
+
+void QThread_SetPriority(void* ptr, long long priority)
+{
+	static_cast<QThread*>(ptr)->setPriority(static_cast<QThread::Priority>(priority));
+}
+
+void* QThread_QThread_CurrentThread()
+{
+	return QThread::currentThread();
+}
+
+void* QThread_NewQThread(void* parent)
+{
+	return new MyQThread(static_cast<QObject*>(parent));
+}
+
+int QThread_Exec(void* ptr)
+{
+	return static_cast<QThread*>(ptr)->exec();
+}
+
+void QThread_Exit(void* ptr, int returnCode)
+{
+	static_cast<QThread*>(ptr)->exit(returnCode);
+}
+
+void QThread_ConnectFinished(void* ptr)
+{
+	QObject::connect(static_cast<QThread*>(ptr), &QThread::finished, static_cast<MyQThread*>(ptr), static_cast<void (MyQThread::*)()>(&MyQThread::Signal_Finished));
+}
+
+void QThread_DisconnectFinished(void* ptr)
+{
+	QObject::disconnect(static_cast<QThread*>(ptr), &QThread::finished, static_cast<MyQThread*>(ptr), static_cast<void (MyQThread::*)()>(&MyQThread::Signal_Finished));
+}
+
+void QThread_Quit(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QThread*>(ptr), "quit");
+}
+
+void QThread_QuitDefault(void* ptr)
+{
+		static_cast<QThread*>(ptr)->QThread::quit();
+}
+
+void QThread_RequestInterruption(void* ptr)
+{
+	static_cast<QThread*>(ptr)->requestInterruption();
+}
+
+void QThread_Run(void* ptr)
+{
+	static_cast<QThread*>(ptr)->run();
+}
+
+void QThread_RunDefault(void* ptr)
+{
+		static_cast<QThread*>(ptr)->QThread::run();
+}
+
+void QThread_SetEventDispatcher(void* ptr, void* eventDispatcher)
+{
+	static_cast<QThread*>(ptr)->setEventDispatcher(static_cast<QAbstractEventDispatcher*>(eventDispatcher));
+}
+
+void QThread_SetStackSize(void* ptr, unsigned int stackSize)
+{
+	static_cast<QThread*>(ptr)->setStackSize(stackSize);
+}
+
+void QThread_QThread_SetTerminationEnabled(char enabled)
+{
+	QThread::setTerminationEnabled(enabled != 0);
+}
+
+void QThread_QThread_Sleep(unsigned long secs)
+{
+	QThread::sleep(secs);
+}
+
+void QThread_Start(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QThread*>(ptr), "start");
+}
+
+void QThread_StartDefault(void* ptr)
+{
+		static_cast<QThread*>(ptr)->QThread::start();
+}
+
+void QThread_ConnectStarted(void* ptr)
+{
+	QObject::connect(static_cast<QThread*>(ptr), &QThread::started, static_cast<MyQThread*>(ptr), static_cast<void (MyQThread::*)()>(&MyQThread::Signal_Started));
+}
+
+void QThread_DisconnectStarted(void* ptr)
+{
+	QObject::disconnect(static_cast<QThread*>(ptr), &QThread::started, static_cast<MyQThread*>(ptr), static_cast<void (MyQThread::*)()>(&MyQThread::Signal_Started));
+}
+
+void QThread_Terminate(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QThread*>(ptr), "terminate");
+}
+
+void QThread_TerminateDefault(void* ptr)
+{
+		static_cast<QThread*>(ptr)->QThread::terminate();
+}
+
+void QThread_QThread_Usleep(unsigned long usecs)
+{
+	QThread::usleep(usecs);
+}
+
+void QThread_QThread_YieldCurrentThread()
+{
+	QThread::yieldCurrentThread();
+}
+
+void QThread_DestroyQThread(void* ptr)
+{
+	static_cast<QThread*>(ptr)->~QThread();
+}
+
+long long QThread_Priority(void* ptr)
+{
+	return static_cast<QThread*>(ptr)->priority();
+}
+
+void* QThread_EventDispatcher(void* ptr)
+{
+	return static_cast<QThread*>(ptr)->eventDispatcher();
+}
+
+char QThread_IsFinished(void* ptr)
+{
+	return static_cast<QThread*>(ptr)->isFinished();
+}
+
+char QThread_IsInterruptionRequested(void* ptr)
+{
+	return static_cast<QThread*>(ptr)->isInterruptionRequested();
+}
+
+char QThread_IsRunning(void* ptr)
+{
+	return static_cast<QThread*>(ptr)->isRunning();
+}
+
+int QThread_LoopLevel(void* ptr)
+{
+	return static_cast<QThread*>(ptr)->loopLevel();
+}
+
+unsigned int QThread_StackSize(void* ptr)
+{
+	return static_cast<QThread*>(ptr)->stackSize();
+}
+
+class MyQThreadPool: public QThreadPool
+{
+public:
+	MyQThreadPool(QObject *parent) : QThreadPool(parent) {};
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QThreadPool_QThreadPool_GlobalInstance()
+{
+	return QThreadPool::globalInstance();
+}
+
+void* QThreadPool_NewQThreadPool(void* parent)
+{
+	return new MyQThreadPool(static_cast<QObject*>(parent));
+}
+
+char QThreadPool_TryStart(void* ptr, void* runnable)
+{
+	return static_cast<QThreadPool*>(ptr)->tryStart(static_cast<QRunnable*>(runnable));
+}
+
+char QThreadPool_WaitForDone(void* ptr, int msecs)
+{
+	return static_cast<QThreadPool*>(ptr)->waitForDone(msecs);
+}
+
+void QThreadPool_Cancel(void* ptr, void* runnable)
+{
+	static_cast<QThreadPool*>(ptr)->cancel(static_cast<QRunnable*>(runnable));
+}
+
+void QThreadPool_Clear(void* ptr)
+{
+	static_cast<QThreadPool*>(ptr)->clear();
+}
+
+void QThreadPool_ReleaseThread(void* ptr)
+{
+	static_cast<QThreadPool*>(ptr)->releaseThread();
+}
+
+void QThreadPool_ReserveThread(void* ptr)
+{
+	static_cast<QThreadPool*>(ptr)->reserveThread();
+}
+
+void QThreadPool_SetExpiryTimeout(void* ptr, int expiryTimeout)
+{
+	static_cast<QThreadPool*>(ptr)->setExpiryTimeout(expiryTimeout);
+}
+
+void QThreadPool_SetMaxThreadCount(void* ptr, int maxThreadCount)
+{
+	static_cast<QThreadPool*>(ptr)->setMaxThreadCount(maxThreadCount);
+}
+
+void QThreadPool_Start(void* ptr, void* runnable, int priority)
+{
+	static_cast<QThreadPool*>(ptr)->start(static_cast<QRunnable*>(runnable), priority);
+}
+
+void QThreadPool_DestroyQThreadPool(void* ptr)
+{
+	static_cast<QThreadPool*>(ptr)->~QThreadPool();
+}
+
+int QThreadPool_ActiveThreadCount(void* ptr)
+{
+	return static_cast<QThreadPool*>(ptr)->activeThreadCount();
+}
+
+int QThreadPool_ExpiryTimeout(void* ptr)
+{
+	return static_cast<QThreadPool*>(ptr)->expiryTimeout();
+}
+
+int QThreadPool_MaxThreadCount(void* ptr)
+{
+	return static_cast<QThreadPool*>(ptr)->maxThreadCount();
+}
+
+void* QTime_QTime_CurrentTime()
+{
+	return new QTime(QTime::currentTime());
+}
+
+void* QTime_QTime_FromMSecsSinceStartOfDay(int msecs)
+{
+	return new QTime(QTime::fromMSecsSinceStartOfDay(msecs));
+}
+
+void* QTime_QTime_FromString(char* stri, long long format)
+{
+	return new QTime(QTime::fromString(QString(stri), static_cast<Qt::DateFormat>(format)));
+}
+
+void* QTime_QTime_FromString2(char* stri, char* format)
+{
+	return new QTime(QTime::fromString(QString(stri), QString(format)));
+}
+
+void* QTime_NewQTime()
+{
+	return new QTime();
+}
+
+void* QTime_NewQTimeInArena(void* arena)
+{
+	return new (goArenaAlloc<QTime>(arena)) QTime();
+}
+
+void* QTime_NewQTime3(int h, int m, int s, int ms)
+{
+	return new QTime(h, m, s, ms);
+}
+
+void* QTime_NewQTime3InArena(void* arena, int h, int m, int s, int ms)
+{
+	return new (goArenaAlloc<QTime>(arena)) QTime(h, m, s, ms);
+}
+
+char QTime_QTime_IsValid2(int h, int m, int s, int ms)
+{
+	return QTime::isValid(h, m, s, ms);
+}
+
+char QTime_SetHMS(void* ptr, int h, int m, int s, int ms)
+{
+	return static_cast<QTime*>(ptr)->setHMS(h, m, s, ms);
+}
+
+int QTime_Restart(void* ptr)
+{
+	return static_cast<QTime*>(ptr)->restart();
+}
+
+void QTime_Start(void* ptr)
+{
+	static_cast<QTime*>(ptr)->start();
+}
+
+struct QtCore_PackedString QTime_ToString2(void* ptr, long long format)
+{
+	return ({ QByteArray tb222d7 = static_cast<QTime*>(ptr)->toString(static_cast<Qt::DateFormat>(format)).toUtf8(); QtCore_PackedString { const_cast<char*>(tb222d7.prepend("WHITESPACE").constData()+10), tb222d7.size()-10 }; });
+}
+
+struct QtCore_PackedString QTime_ToString(void* ptr, char* format)
+{
+	return ({ QByteArray t5fbabb = static_cast<QTime*>(ptr)->toString(QString(format)).toUtf8(); QtCore_PackedString { const_cast<char*>(t5fbabb.prepend("WHITESPACE").constData()+10), t5fbabb.size()-10 }; });
+}
+
+void* QTime_AddMSecs(void* ptr, int ms)
+{
+	return new QTime(static_cast<QTime*>(ptr)->addMSecs(ms));
+}
+
+void* QTime_AddSecs(void* ptr, int s)
+{
+	return new QTime(static_cast<QTime*>(ptr)->addSecs(s));
+}
+
+char QTime_IsNull(void* ptr)
+{
+	return static_cast<QTime*>(ptr)->isNull();
+}
+
+char QTime_IsValid(void* ptr)
+{
+	return static_cast<QTime*>(ptr)->isValid();
+}
+
+int QTime_Elapsed(void* ptr)
+{
+	return static_cast<QTime*>(ptr)->elapsed();
+}
+
+int QTime_Hour(void* ptr)
+{
+	return static_cast<QTime*>(ptr)->hour();
+}
+
+int QTime_Minute(void* ptr)
+{
+	return static_cast<QTime*>(ptr)->minute();
+}
+
+int QTime_Msec(void* ptr)
+{
+	return static_cast<QTime*>(ptr)->msec();
+}
+
+int QTime_MsecsSinceStartOfDay(void* ptr)
+{
+	return static_cast<QTime*>(ptr)->msecsSinceStartOfDay();
+}
+
+int QTime_MsecsTo(void* ptr, void* t)
+{
+	return static_cast<QTime*>(ptr)->msecsTo(*static_cast<QTime*>(t));
+}
+
+int QTime_Second(void* ptr)
+{
+	return static_cast<QTime*>(ptr)->second();
+}
+
+int QTime_SecsTo(void* ptr, void* t)
+{
+	return static_cast<QTime*>(ptr)->secsTo(*static_cast<QTime*>(t));
+}
+
+class MyQTimeLine: public QTimeLine
+{
+public:
+	MyQTimeLine(int duration, QObject *parent) : QTimeLine(duration, parent) {};
+	void setCurrentTime(int msec) { callbackQTimeLine_SetCurrentTime(this, msec); };
+	void Signal_Finished() { callbackQTimeLine_Finished(this); };
+	void Signal_FrameChanged(int frame) { callbackQTimeLine_FrameChanged(this, frame); };
+	void resume() { callbackQTimeLine_Resume(this); };
+	void setPaused(bool paused) { callbackQTimeLine_SetPaused(this, paused); };
+	void start() { callbackQTimeLine_Start(this); };
+	void Signal_StateChanged(QTimeLine::State newState) { callbackQTimeLine_StateChanged(this, newState); };
+	void stop() { callbackQTimeLine_Stop(this); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	void toggleDirection() { callbackQTimeLine_ToggleDirection(this); };
+	void Signal_ValueChanged(qreal value) { callbackQTimeLine_ValueChanged(this, value); };
+	 ~MyQTimeLine() { callbackQTimeLine_DestroyQTimeLine(this); };
+	qreal valueForTime(int msec) const { return callbackQTimeLine_ValueForTime(const_cast<void*>(static_cast<const void*>(this)), msec); };
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QTimeLine_SetCurrentTime(void* ptr, int msec)
+{
+	QMetaObject::invokeMethod(static_cast<QTimeLine*>(ptr), "setCurrentTime", Q_ARG(int, msec));
+}
+
+void QTimeLine_SetCurrentTimeDefault(void* ptr, int msec)
+{
+		static_cast<QTimeLine*>(ptr)->QTimeLine::setCurrentTime(msec);
+}
+
+void* QTimeLine_NewQTimeLine(int duration, void* parent)
+{
+	return new MyQTimeLine(duration, static_cast<QObject*>(parent));
+}
+
+void QTimeLine_ConnectFinished(void* ptr)
+{
+	QObject::connect(static_cast<QTimeLine*>(ptr), &QTimeLine::finished, static_cast<MyQTimeLine*>(ptr), static_cast<void (MyQTimeLine::*)()>(&MyQTimeLine::Signal_Finished));
+}
+
+void QTimeLine_DisconnectFinished(void* ptr)
+{
+	QObject::disconnect(static_cast<QTimeLine*>(ptr), &QTimeLine::finished, static_cast<MyQTimeLine*>(ptr), static_cast<void (MyQTimeLine::*)()>(&MyQTimeLine::Signal_Finished));
+}
+
+void QTimeLine_ConnectFrameChanged(void* ptr)
+{
+	QObject::connect(static_cast<QTimeLine*>(ptr), &QTimeLine::frameChanged, static_cast<MyQTimeLine*>(ptr), static_cast<void (MyQTimeLine::*)(int)>(&MyQTimeLine::Signal_FrameChanged));
+}
+
+void QTimeLine_DisconnectFrameChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QTimeLine*>(ptr), &QTimeLine::frameChanged, static_cast<MyQTimeLine*>(ptr), static_cast<void (MyQTimeLine::*)(int)>(&MyQTimeLine::Signal_FrameChanged));
+}
+
+void QTimeLine_Resume(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QTimeLine*>(ptr), "resume");
+}
+
+void QTimeLine_ResumeDefault(void* ptr)
+{
+		static_cast<QTimeLine*>(ptr)->QTimeLine::resume();
+}
+
+void QTimeLine_SetCurveShape(void* ptr, long long shape)
+{
+	static_cast<QTimeLine*>(ptr)->setCurveShape(static_cast<QTimeLine::CurveShape>(shape));
+}
+
+void QTimeLine_SetDirection(void* ptr, long long direction)
+{
+	static_cast<QTimeLine*>(ptr)->setDirection(static_cast<QTimeLine::Direction>(direction));
+}
+
+void QTimeLine_SetDuration(void* ptr, int duration)
+{
+	static_cast<QTimeLine*>(ptr)->setDuration(duration);
+}
+
+void QTimeLine_SetEasingCurve(void* ptr, void* curve)
+{
+	static_cast<QTimeLine*>(ptr)->setEasingCurve(*static_cast<QEasingCurve*>(curve));
+}
+
+void QTimeLine_SetEndFrame(void* ptr, int frame)
+{
+	static_cast<QTimeLine*>(ptr)->setEndFrame(frame);
+}
+
+void QTimeLine_SetFrameRange(void* ptr, int startFrame, int endFrame)
+{
+	static_cast<QTimeLine*>(ptr)->setFrameRange(startFrame, endFrame);
+}
+
+void QTimeLine_SetLoopCount(void* ptr, int count)
+{
+	static_cast<QTimeLine*>(ptr)->setLoopCount(count);
+}
+
+void QTimeLine_SetPaused(void* ptr, char paused)
+{
+	QMetaObject::invokeMethod(static_cast<QTimeLine*>(ptr), "setPaused", Q_ARG(bool, paused != 0));
+}
+
+void QTimeLine_SetPausedDefault(void* ptr, char paused)
+{
+		static_cast<QTimeLine*>(ptr)->QTimeLine::setPaused(paused != 0);
+}
+
+void QTimeLine_SetStartFrame(void* ptr, int frame)
+{
+	static_cast<QTimeLine*>(ptr)->setStartFrame(frame);
+}
+
+void QTimeLine_SetUpdateInterval(void* ptr, int interval)
+{
+	static_cast<QTimeLine*>(ptr)->setUpdateInterval(interval);
+}
+
+void QTimeLine_Start(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QTimeLine*>(ptr), "start");
+}
+
+void QTimeLine_StartDefault(void* ptr)
+{
+		static_cast<QTimeLine*>(ptr)->QTimeLine::start();
+}
+
+void QTimeLine_ConnectStateChanged(void* ptr)
+{
+	QObject::connect(static_cast<QTimeLine*>(ptr), &QTimeLine::stateChanged, static_cast<MyQTimeLine*>(ptr), static_cast<void (MyQTimeLine::*)(QTimeLine::State)>(&MyQTimeLine::Signal_StateChanged));
+}
+
+void QTimeLine_DisconnectStateChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QTimeLine*>(ptr), &QTimeLine::stateChanged, static_cast<MyQTimeLine*>(ptr), static_cast<void (MyQTimeLine::*)(QTimeLine::State)>(&MyQTimeLine::Signal_StateChanged));
+}
+
+void QTimeLine_Stop(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QTimeLine*>(ptr), "stop");
+}
+
+void QTimeLine_StopDefault(void* ptr)
+{
+		static_cast<QTimeLine*>(ptr)->QTimeLine::stop();
+}
+
+void QTimeLine_ToggleDirection(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QTimeLine*>(ptr), "toggleDirection");
+}
+
+void QTimeLine_ToggleDirectionDefault(void* ptr)
+{
+		static_cast<QTimeLine*>(ptr)->QTimeLine::toggleDirection();
+}
+
+void QTimeLine_ConnectValueChanged(void* ptr)
+{
+	QObject::connect(static_cast<QTimeLine*>(ptr), &QTimeLine::valueChanged, static_cast<MyQTimeLine*>(ptr), static_cast<void (MyQTimeLine::*)(qreal)>(&MyQTimeLine::Signal_ValueChanged));
+}
+
+void QTimeLine_DisconnectValueChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QTimeLine*>(ptr), &QTimeLine::valueChanged, static_cast<MyQTimeLine*>(ptr), static_cast<void (MyQTimeLine::*)(qreal)>(&MyQTimeLine::Signal_ValueChanged));
+}
+
+void QTimeLine_DestroyQTimeLine(void* ptr)
+{
+	static_cast<QTimeLine*>(ptr)->~QTimeLine();
+}
+
+void QTimeLine_DestroyQTimeLineDefault(void* ptr)
+{
+
+}
+
+long long QTimeLine_CurveShape(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->curveShape();
+}
+
+long long QTimeLine_Direction(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->direction();
+}
+
+void* QTimeLine_EasingCurve(void* ptr)
+{
+	return new QEasingCurve(static_cast<QTimeLine*>(ptr)->easingCurve());
+}
+
+long long QTimeLine_State(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->state();
+}
+
+int QTimeLine_CurrentFrame(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->currentFrame();
+}
+
+int QTimeLine_CurrentTime(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->currentTime();
+}
+
+int QTimeLine_Duration(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->duration();
+}
+
+int QTimeLine_EndFrame(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->endFrame();
+}
+
+int QTimeLine_FrameForTime(void* ptr, int msec)
+{
+	return static_cast<QTimeLine*>(ptr)->frameForTime(msec);
+}
+
+int QTimeLine_LoopCount(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->loopCount();
+}
+
+int QTimeLine_StartFrame(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->startFrame();
+}
+
+int QTimeLine_UpdateInterval(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->updateInterval();
+}
+
+double QTimeLine_CurrentValue(void* ptr)
+{
+	return static_cast<QTimeLine*>(ptr)->currentValue();
+}
+
+double QTimeLine_ValueForTime(void* ptr, int msec)
+{
+	return static_cast<QTimeLine*>(ptr)->valueForTime(msec);
+}
+
+double QTimeLine_ValueForTimeDefault(void* ptr, int msec)
+{
+		return static_cast<QTimeLine*>(ptr)->QTimeLine::valueForTime(msec);
+}
+
+void* QTimeZone_QTimeZone_IanaIdToWindowsId(void* ianaId)
+{
+	return new QByteArray(QTimeZone::ianaIdToWindowsId(*static_cast<QByteArray*>(ianaId)));
+}
+
+void* QTimeZone_QTimeZone_SystemTimeZoneId()
+{
+	return new QByteArray(QTimeZone::systemTimeZoneId());
+}
+
+void* QTimeZone_QTimeZone_WindowsIdToDefaultIanaId(void* windowsId)
+{
+	return new QByteArray(QTimeZone::windowsIdToDefaultIanaId(*static_cast<QByteArray*>(windowsId)));
+}
+
+void* QTimeZone_QTimeZone_WindowsIdToDefaultIanaId2(void* windowsId, long long country)
+{
+	return new QByteArray(QTimeZone::windowsIdToDefaultIanaId(*static_cast<QByteArray*>(windowsId), static_cast<QLocale::Country>(country)));
+}
+
+struct QtCore_PackedString QTimeZone_QTimeZone_AvailableTimeZoneIds()
+{
+	return ({ long long t9dfc57len; char* t9dfc57 = goPackStringList(QTimeZone::availableTimeZoneIds(), &t9dfc57len); QtCore_PackedString { t9dfc57, t9dfc57len }; });
+}
+
+struct QtCore_PackedString QTimeZone_QTimeZone_AvailableTimeZoneIds2(long long country)
+{
+	return ({ long long tb51557len; char* tb51557 = goPackStringList(QTimeZone::availableTimeZoneIds(static_cast<QLocale::Country>(country)), &tb51557len); QtCore_PackedString { tb51557, tb51557len }; });
+}
+
+struct QtCore_PackedString QTimeZone_QTimeZone_AvailableTimeZoneIds3(int offsetSeconds)
+{
+	return ({ long long t137a2alen; char* t137a2a = goPackStringList(QTimeZone::availableTimeZoneIds(offsetSeconds), &t137a2alen); QtCore_PackedString { t137a2a, t137a2alen }; });
+}
+
+struct QtCore_PackedString QTimeZone_QTimeZone_WindowsIdToIanaIds(void* windowsId)
+{
+	return ({ long long t7576fclen; char* t7576fc = goPackStringList(QTimeZone::windowsIdToIanaIds(*static_cast<QByteArray*>(windowsId)), &t7576fclen); QtCore_PackedString { t7576fc, t7576fclen }; });
+}
+
+struct QtCore_PackedString QTimeZone_QTimeZone_WindowsIdToIanaIds2(void* windowsId, long long country)
+{
+	return ({ long long t5be00alen; char* t5be00a = goPackStringList(QTimeZone::windowsIdToIanaIds(*static_cast<QByteArray*>(windowsId), static_cast<QLocale::Country>(country)), &t5be00alen); QtCore_PackedString { t5be00a, t5be00alen }; });
+}
+
+void* QTimeZone_QTimeZone_SystemTimeZone()
+{
+	return new QTimeZone(QTimeZone::systemTimeZone());
+}
+
+void* QTimeZone_QTimeZone_Utc()
+{
+	return new QTimeZone(QTimeZone::utc());
+}
+
+void* QTimeZone_NewQTimeZone()
+{
+	return new QTimeZone();
+}
+
+void* QTimeZone_NewQTimeZoneInArena(void* arena)
+{
+	return new (goArenaAlloc<QTimeZone>(arena)) QTimeZone();
+}
+
+void* QTimeZone_NewQTimeZone2(void* ianaId)
+{
+	return new QTimeZone(*static_cast<QByteArray*>(ianaId));
+}
+
+void* QTimeZone_NewQTimeZone2InArena(void* arena, void* ianaId)
+{
+	return new (goArenaAlloc<QTimeZone>(arena)) QTimeZone(*static_cast<QByteArray*>(ianaId));
+}
+
+void* QTimeZone_NewQTimeZone4(void* ianaId, int offsetSeconds, char* name, char* abbreviation, long long country, char* comment)
+{
+	return new QTimeZone(*static_cast<QByteArray*>(ianaId), offsetSeconds, QString(name), QString(abbreviation), static_cast<QLocale::Country>(country), QString(comment));
+}
+
+void* QTimeZone_NewQTimeZone4InArena(void* arena, void* ianaId, int offsetSeconds, char* name, char* abbreviation, long long country, char* comment)
+{
+	return new (goArenaAlloc<QTimeZone>(arena)) QTimeZone(*static_cast<QByteArray*>(ianaId), offsetSeconds, QString(name), QString(abbreviation), static_cast<QLocale::Country>(country), QString(comment));
+}
+
+void* QTimeZone_NewQTimeZone5(void* other)
+{
+	return new QTimeZone(*static_cast<QTimeZone*>(other));
+}
+
+void* QTimeZone_NewQTimeZone5InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QTimeZone>(arena)) QTimeZone(*static_cast<QTimeZone*>(other));
+}
+
+void* QTimeZone_NewQTimeZone3(int offsetSeconds)
+{
+	return new QTimeZone(offsetSeconds);
+}
+
+void* QTimeZone_NewQTimeZone3InArena(void* arena, int offsetSeconds)
+{
+	return new (goArenaAlloc<QTimeZone>(arena)) QTimeZone(offsetSeconds);
+}
+
+char QTimeZone_QTimeZone_IsTimeZoneIdAvailable(void* ianaId)
+{
+	return QTimeZone::isTimeZoneIdAvailable(*static_cast<QByteArray*>(ianaId));
+}
+
+void QTimeZone_Swap(void* ptr, void* other)
+{
+	static_cast<QTimeZone*>(ptr)->swap(*static_cast<QTimeZone*>(other));
+}
+
+void QTimeZone_DestroyQTimeZone(void* ptr)
+{
+	static_cast<QTimeZone*>(ptr)->~QTimeZone();
+}
+
+void* QTimeZone_Id(void* ptr)
+{
+	return new QByteArray(static_cast<QTimeZone*>(ptr)->id());
+}
+
+long long QTimeZone_Country(void* ptr)
+{
+	return static_cast<QTimeZone*>(ptr)->country();
+}
+
+struct QtCore_PackedString QTimeZone_Abbreviation(void* ptr, void* atDateTime)
+{
+	return ({ QByteArray t82ae84 = static_cast<QTimeZone*>(ptr)->abbreviation(*static_cast<QDateTime*>(atDateTime)).toUtf8(); QtCore_PackedString { const_cast<char*>(t82ae84.prepend("WHITESPACE").constData()+10), t82ae84.size()-10 }; });
+}
+
+struct QtCore_PackedString QTimeZone_Comment(void* ptr)
+{
+	return ({ QByteArray t2b73f6 = static_cast<QTimeZone*>(ptr)->comment().toUtf8(); QtCore_PackedString { const_cast<char*>(t2b73f6.prepend("WHITESPACE").constData()+10), t2b73f6.size()-10 }; });
+}
+
+struct QtCore_PackedString QTimeZone_DisplayName2(void* ptr, long long timeType, long long nameType, void* locale)
+{
+	return ({ QByteArray tc6cf47 = static_cast<QTimeZone*>(ptr)->displayName(static_cast<QTimeZone::TimeType>(timeType), static_cast<QTimeZone::NameType>(nameType), *static_cast<QLocale*>(locale)).toUtf8(); QtCore_PackedString { const_cast<char*>(tc6cf47.prepend("WHITESPACE").constData()+10), tc6cf47.size()-10 }; });
+}
+
+struct QtCore_PackedString QTimeZone_DisplayName(void* ptr, void* atDateTime, long long nameType, void* locale)
+{
+	return ({ QByteArray t168cd9 = static_cast<QTimeZone*>(ptr)->displayName(*static_cast<QDateTime*>(atDateTime), static_cast<QTimeZone::NameType>(nameType), *static_cast<QLocale*>(locale)).toUtf8(); QtCore_PackedString { const_cast<char*>(t168cd9.prepend("WHITESPACE").constData()+10), t168cd9.size()-10 }; });
+}
+
+char QTimeZone_HasDaylightTime(void* ptr)
+{
+	return static_cast<QTimeZone*>(ptr)->hasDaylightTime();
+}
+
+char QTimeZone_HasTransitions(void* ptr)
+{
+	return static_cast<QTimeZone*>(ptr)->hasTransitions();
+}
+
+char QTimeZone_IsDaylightTime(void* ptr, void* atDateTime)
+{
+	return static_cast<QTimeZone*>(ptr)->isDaylightTime(*static_cast<QDateTime*>(atDateTime));
+}
+
+char QTimeZone_IsValid(void* ptr)
+{
+	return static_cast<QTimeZone*>(ptr)->isValid();
+}
+
+int QTimeZone_DaylightTimeOffset(void* ptr, void* atDateTime)
+{
+	return static_cast<QTimeZone*>(ptr)->daylightTimeOffset(*static_cast<QDateTime*>(atDateTime));
+}
+
+int QTimeZone_OffsetFromUtc(void* ptr, void* atDateTime)
+{
+	return static_cast<QTimeZone*>(ptr)->offsetFromUtc(*static_cast<QDateTime*>(atDateTime));
+}
+
+int QTimeZone_StandardTimeOffset(void* ptr, void* atDateTime)
+{
+	return static_cast<QTimeZone*>(ptr)->standardTimeOffset(*static_cast<QDateTime*>(atDateTime));
+}
+
+void* QTimeZone___availableTimeZoneIds_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTimeZone___availableTimeZoneIds_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTimeZone___availableTimeZoneIds_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QTimeZone___availableTimeZoneIds_atList2(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTimeZone___availableTimeZoneIds_setList2(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTimeZone___availableTimeZoneIds_newList2(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QTimeZone___availableTimeZoneIds_atList3(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTimeZone___availableTimeZoneIds_setList3(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTimeZone___availableTimeZoneIds_newList3(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QTimeZone___windowsIdToIanaIds_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTimeZone___windowsIdToIanaIds_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTimeZone___windowsIdToIanaIds_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QTimeZone___windowsIdToIanaIds_atList2(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTimeZone___windowsIdToIanaIds_setList2(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTimeZone___windowsIdToIanaIds_newList2(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+class MyQTimer: public QTimer
+{
+public:
+	MyQTimer(QObject *parent) : QTimer(parent) {};
+	void start() { callbackQTimer_Start2(this); };
+	void start(int msec) { callbackQTimer_Start(this, msec); };
+	void stop() { callbackQTimer_Stop(this); };
+	void Signal_Timeout() { callbackQTimer_Timeout(this); };
+	void timerEvent(QTimerEvent * e) { callbackQObject_TimerEvent(this, e); };
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QTimer_NewQTimer(void* parent)
+{
+	return new MyQTimer(static_cast<QObject*>(parent));
+}
+
+void QTimer_SetInterval(void* ptr, int msec)
+{
+	static_cast<QTimer*>(ptr)->setInterval(msec);
+}
+
+void QTimer_SetSingleShot(void* ptr, char singleShot)
+{
+	static_cast<QTimer*>(ptr)->setSingleShot(singleShot != 0);
+}
+
+void QTimer_SetTimerType(void* ptr, long long atype)
+{
+	static_cast<QTimer*>(ptr)->setTimerType(static_cast<Qt::TimerType>(atype));
+}
+
+void QTimer_QTimer_SingleShot2(int msec, long long timerType, void* receiver, char* member)
+{
+	QTimer::singleShot(msec, static_cast<Qt::TimerType>(timerType), static_cast<QObject*>(receiver), const_cast<const char*>(member));
+}
+
+void QTimer_QTimer_SingleShot(int msec, void* receiver, char* member)
+{
+	QTimer::singleShot(msec, static_cast<QObject*>(receiver), const_cast<const char*>(member));
+}
+
+void QTimer_Start2(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QTimer*>(ptr), "start");
+}
+
+void QTimer_Start2Default(void* ptr)
+{
+		static_cast<QTimer*>(ptr)->QTimer::start();
+}
+
+void QTimer_Start(void* ptr, int msec)
+{
+	QMetaObject::invokeMethod(static_cast<QTimer*>(ptr), "start", Q_ARG(int, msec));
+}
+
+void QTimer_StartDefault(void* ptr, int msec)
+{
+		static_cast<QTimer*>(ptr)->QTimer::start(msec);
+}
+
+void QTimer_Stop(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QTimer*>(ptr), "stop");
+}
+
+void QTimer_StopDefault(void* ptr)
+{
+		static_cast<QTimer*>(ptr)->QTimer::stop();
+}
+
+void QTimer_ConnectTimeout(void* ptr)
+{
+	QObject::connect(static_cast<QTimer*>(ptr), &QTimer::timeout, static_cast<MyQTimer*>(ptr), static_cast<void (MyQTimer::*)()>(&MyQTimer::Signal_Timeout));
+}
+
+void QTimer_DisconnectTimeout(void* ptr)
+{
+	QObject::disconnect(static_cast<QTimer*>(ptr), &QTimer::timeout, static_cast<MyQTimer*>(ptr), static_cast<void (MyQTimer::*)()>(&MyQTimer::Signal_Timeout));
+}
+
+void QTimer_DestroyQTimer(void* ptr)
+{
+	static_cast<QTimer*>(ptr)->~QTimer();
+}
+
+long long QTimer_TimerType(void* ptr)
+{
+	return static_cast<QTimer*>(ptr)->timerType();
+}
+
+char QTimer_IsActive(void* ptr)
+{
+	return static_cast<QTimer*>(ptr)->isActive();
+}
+
+char QTimer_IsSingleShot(void* ptr)
+{
+	return static_cast<QTimer*>(ptr)->isSingleShot();
+}
+
+int QTimer_Interval(void* ptr)
+{
+	return static_cast<QTimer*>(ptr)->interval();
+}
+
+int QTimer_RemainingTime(void* ptr)
+{
+	return static_cast<QTimer*>(ptr)->remainingTime();
+}
+
+int QTimer_TimerId(void* ptr)
+{
+	return static_cast<QTimer*>(ptr)->timerId();
+}
+
+class MyQTimerEvent: public QTimerEvent
+{
+public:
+	MyQTimerEvent(int timerId) : QTimerEvent(timerId) {};
+};
+
+void* QTimerEvent_NewQTimerEvent(int timerId)
+{
+	return new MyQTimerEvent(timerId);
+}
+
+int QTimerEvent_TimerId(void* ptr)
+{
+	return static_cast<QTimerEvent*>(ptr)->timerId();
+}
+
+int QTimerEvent_Id(void* ptr)
+{
+	return static_cast<QTimerEvent*>(ptr)->id;
+}
+
+void QTimerEvent_SetId(void* ptr, int vin)
+{
+	static_cast<QTimerEvent*>(ptr)->id = vin;
+}
+
+class MyQTranslator: public QTranslator
+{
+public:
+	MyQTranslator(QObject *parent) : QTranslator(parent) {};
+	QString translate(const char * context, const char * sourceText, const char * disambiguation, int n) const { QtCore_PackedString contextPacked = { const_cast<char*>(context), n };QtCore_PackedString sourceTextPacked = { const_cast<char*>(sourceText), n };QtCore_PackedString disambiguationPacked = { const_cast<char*>(disambiguation), n };return QString(callbackQTranslator_Translate(const_cast<void*>(static_cast<const void*>(this)), contextPacked, sourceTextPacked, disambiguationPacked, n)); };
+	bool isEmpty() const { return callbackQTranslator_IsEmpty(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	bool event(QEvent * e) { return callbackQObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QTranslator_NewQTranslator(void* parent)
+{
+	return new MyQTranslator(static_cast<QObject*>(parent));
+}
+
+char QTranslator_Load2(void* ptr, void* locale, char* filename, char* prefix, char* directory, char* suffix)
+{
+	return static_cast<QTranslator*>(ptr)->load(*static_cast<QLocale*>(locale), QString(filename), QString(prefix), QString(directory), QString(suffix));
+}
+
+char QTranslator_Load(void* ptr, char* filename, char* directory, char* search_delimiters, char* suffix)
+{
+	return static_cast<QTranslator*>(ptr)->load(QString(filename), QString(directory), QString(search_delimiters), QString(suffix));
+}
+
+char QTranslator_Load3(void* ptr, char* data, int len, char* directory)
+{
+	return static_cast<QTranslator*>(ptr)->load(const_cast<const uchar*>(static_cast<uchar*>(static_cast<void*>(data))), len, QString(directory));
+}
+
+void QTranslator_DestroyQTranslator(void* ptr)
+{
+	static_cast<QTranslator*>(ptr)->~QTranslator();
+}
+
+struct QtCore_PackedString QTranslator_Translate(void* ptr, char* context, char* sourceText, char* disambiguation, int n)
+{
+	return ({ QByteArray tb6b80e = static_cast<QTranslator*>(ptr)->translate(const_cast<const char*>(context), const_cast<const char*>(sourceText), const_cast<const char*>(disambiguation), n).toUtf8(); QtCore_PackedString { const_cast<char*>(tb6b80e.prepend("WHITESPACE").constData()+10), tb6b80e.size()-10 }; });
+}
+
+struct QtCore_PackedString QTranslator_TranslateDefault(void* ptr, char* context, char* sourceText, char* disambiguation, int n)
+{
+		return ({ QByteArray t5511a2 = static_cast<QTranslator*>(ptr)->QTranslator::translate(const_cast<const char*>(context), const_cast<const char*>(sourceText), const_cast<const char*>(disambiguation), n).toUtf8(); QtCore_PackedString { const_cast<char*>(t5511a2.prepend("WHITESPACE").constData()+10), t5511a2.size()-10 }; });
+}
+
+char QTranslator_IsEmpty(void* ptr)
+{
+	return static_cast<QTranslator*>(ptr)->isEmpty();
+}
+
+char QTranslator_IsEmptyDefault(void* ptr)
+{
+		return static_cast<QTranslator*>(ptr)->QTranslator::isEmpty();
+}
+
+class MyQUnhandledException: public QUnhandledException
+{
+public:
+};
+
+struct QtCore_PackedList QUrl_QUrl_FromStringList(char* urls, long long mode)
+{
+	return ({ QList<QUrl>* tmpValue = new QList<QUrl>(QUrl::fromStringList(goUnpackStringList(urls), static_cast<QUrl::ParsingMode>(mode))); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtCore_PackedString QUrl_QUrl_FromPercentEncoding(void* input)
+{
+	return ({ QByteArray t95c42a = QUrl::fromPercentEncoding(*static_cast<QByteArray*>(input)).toUtf8(); QtCore_PackedString { const_cast<char*>(t95c42a.prepend("WHITESPACE").constData()+10), t95c42a.size()-10 }; });
+}
+
+void* QUrl_QUrl_FromEncoded(void* input, long long parsingMode)
+{
+	return new QUrl(QUrl::fromEncoded(*static_cast<QByteArray*>(input), static_cast<QUrl::ParsingMode>(parsingMode)));
+}
+
+void* QUrl_QUrl_ToAce(char* domain)
+{
+	return new QByteArray(QUrl::toAce(QString(domain)));
+}
+
+void* QUrl_QUrl_ToPercentEncoding(char* input, void* exclude, void* include)
+{
+	return new QByteArray(QUrl::toPercentEncoding(QString(input), *static_cast<QByteArray*>(exclude), *static_cast<QByteArray*>(include)));
+}
+
+struct QtCore_PackedString QUrl_QUrl_FromAce(void* domain)
+{
+	return ({ QByteArray t0cf8b9 = QUrl::fromAce(*static_cast<QByteArray*>(domain)).toUtf8(); QtCore_PackedString { const_cast<char*>(t0cf8b9.prepend("WHITESPACE").constData()+10), t0cf8b9.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_QUrl_IdnWhitelist()
+{
+	return ({ long long t7d801dlen; char* t7d801d = goPackStringList(QUrl::idnWhitelist(), &t7d801dlen); QtCore_PackedString { t7d801d, t7d801dlen }; });
+}
+
+struct QtCore_PackedString QUrl_QUrl_ToStringList(void* urls, long long options)
+{
+	return ({ long long tc32440len; char* tc32440 = goPackStringList(QUrl::toStringList(*static_cast<QList<QUrl>*>(urls), static_cast<QUrl::UrlFormattingOption>(options)), &tc32440len); QtCore_PackedString { tc32440, tc32440len }; });
+}
+
+void* QUrl_QUrl_FromLocalFile(char* localFile)
+{
+	return new QUrl(QUrl::fromLocalFile(QString(localFile)));
+}
+
+void* QUrl_QUrl_FromUserInput(char* userInput)
+{
+	return new QUrl(QUrl::fromUserInput(QString(userInput)));
+}
+
+void* QUrl_QUrl_FromUserInput2(char* userInput, char* workingDirectory, long long options)
+{
+	return new QUrl(QUrl::fromUserInput(QString(userInput), QString(workingDirectory), static_cast<QUrl::UserInputResolutionOption>(options)));
+}
+
+void* QUrl_NewQUrl()
+{
+	return new QUrl();
+}
+
+void* QUrl_NewQUrlInArena(void* arena)
+{
+	return new (goArenaAlloc<QUrl>(arena)) QUrl();
+}
+
+void* QUrl_NewQUrl4(void* other)
+{
+	return new QUrl(*static_cast<QUrl*>(other));
+}
+
+void* QUrl_NewQUrl4InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QUrl>(arena)) QUrl(*static_cast<QUrl*>(other));
+}
+
+void* QUrl_NewQUrl3(char* url, long long parsingMode)
+{
+	return new QUrl(QString(url), static_cast<QUrl::ParsingMode>(parsingMode));
+}
+
+void* QUrl_NewQUrl3InArena(void* arena, char* url, long long parsingMode)
+{
+	return new (goArenaAlloc<QUrl>(arena)) QUrl(QString(url), static_cast<QUrl::ParsingMode>(parsingMode));
+}
+
+void* QUrl_NewQUrl2(void* other)
+{
+	return new QUrl(*static_cast<QUrl*>(other));
+}
+
+void* QUrl_NewQUrl2InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QUrl>(arena)) QUrl(*static_cast<QUrl*>(other));
+}
+
+void QUrl_Clear(void* ptr)
+{
+	static_cast<QUrl*>(ptr)->clear();
+}
+
+void QUrl_SetAuthority(void* ptr, char* authority, long long mode)
+{
+	static_cast<QUrl*>(ptr)->setAuthority(QString(authority), static_cast<QUrl::ParsingMode>(mode));
+}
+
+void QUrl_SetFragment(void* ptr, char* fragment, long long mode)
+{
+	static_cast<QUrl*>(ptr)->setFragment(QString(fragment), static_cast<QUrl::ParsingMode>(mode));
+}
+
+void QUrl_SetHost(void* ptr, char* host, long long mode)
+{
+	static_cast<QUrl*>(ptr)->setHost(QString(host), static_cast<QUrl::ParsingMode>(mode));
+}
+
+void QUrl_QUrl_SetIdnWhitelist(char* list)
+{
+	QUrl::setIdnWhitelist(goUnpackStringList(list));
+}
+
+void QUrl_SetPassword(void* ptr, char* password, long long mode)
+{
+	static_cast<QUrl*>(ptr)->setPassword(QString(password), static_cast<QUrl::ParsingMode>(mode));
+}
+
+void QUrl_SetPath(void* ptr, char* path, long long mode)
+{
+	static_cast<QUrl*>(ptr)->setPath(QString(path), static_cast<QUrl::ParsingMode>(mode));
+}
+
+void QUrl_SetPort(void* ptr, int port)
+{
+	static_cast<QUrl*>(ptr)->setPort(port);
+}
+
+void QUrl_SetQuery(void* ptr, char* query, long long mode)
+{
+	static_cast<QUrl*>(ptr)->setQuery(QString(query), static_cast<QUrl::ParsingMode>(mode));
+}
+
+void QUrl_SetQuery2(void* ptr, void* query)
+{
+	static_cast<QUrl*>(ptr)->setQuery(*static_cast<QUrlQuery*>(query));
+}
+
+void QUrl_SetScheme(void* ptr, char* scheme)
+{
+	static_cast<QUrl*>(ptr)->setScheme(QString(scheme));
+}
+
+void QUrl_SetUrl(void* ptr, char* url, long long parsingMode)
+{
+	static_cast<QUrl*>(ptr)->setUrl(QString(url), static_cast<QUrl::ParsingMode>(parsingMode));
+}
+
+void QUrl_SetUserInfo(void* ptr, char* userInfo, long long mode)
+{
+	static_cast<QUrl*>(ptr)->setUserInfo(QString(userInfo), static_cast<QUrl::ParsingMode>(mode));
+}
+
+void QUrl_SetUserName(void* ptr, char* userName, long long mode)
+{
+	static_cast<QUrl*>(ptr)->setUserName(QString(userName), static_cast<QUrl::ParsingMode>(mode));
+}
+
+void QUrl_Swap(void* ptr, void* other)
+{
+	static_cast<QUrl*>(ptr)->swap(*static_cast<QUrl*>(other));
+}
+
+void QUrl_DestroyQUrl(void* ptr)
+{
+	static_cast<QUrl*>(ptr)->~QUrl();
+}
+
+void* QUrl_ToEncoded(void* ptr, long long options)
+{
+	return new QByteArray(static_cast<QUrl*>(ptr)->toEncoded(static_cast<QUrl::UrlFormattingOption>(options)));
+}
+
+struct QtCore_PackedString QUrl_Authority(void* ptr, long long options)
+{
+	return ({ QByteArray t5a26fa = static_cast<QUrl*>(ptr)->authority(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(t5a26fa.prepend("WHITESPACE").constData()+10), t5a26fa.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_ErrorString(void* ptr)
+{
+	return ({ QByteArray t35c6dc = static_cast<QUrl*>(ptr)->errorString().toUtf8(); QtCore_PackedString { const_cast<char*>(t35c6dc.prepend("WHITESPACE").constData()+10), t35c6dc.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_FileName(void* ptr, long long options)
+{
+	return ({ QByteArray t4c468f = static_cast<QUrl*>(ptr)->fileName(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(t4c468f.prepend("WHITESPACE").constData()+10), t4c468f.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_Fragment(void* ptr, long long options)
+{
+	return ({ QByteArray t754185 = static_cast<QUrl*>(ptr)->fragment(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(t754185.prepend("WHITESPACE").constData()+10), t754185.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_Host(void* ptr, long long options)
+{
+	return ({ QByteArray tf93546 = static_cast<QUrl*>(ptr)->host(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(tf93546.prepend("WHITESPACE").constData()+10), tf93546.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_Password(void* ptr, long long options)
+{
+	return ({ QByteArray t55f068 = static_cast<QUrl*>(ptr)->password(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(t55f068.prepend("WHITESPACE").constData()+10), t55f068.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_Path(void* ptr, long long options)
+{
+	return ({ QByteArray t70ef65 = static_cast<QUrl*>(ptr)->path(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(t70ef65.prepend("WHITESPACE").constData()+10), t70ef65.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_Query(void* ptr, long long options)
+{
+	return ({ QByteArray t911c73 = static_cast<QUrl*>(ptr)->query(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(t911c73.prepend("WHITESPACE").constData()+10), t911c73.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_Scheme(void* ptr)
+{
+	return ({ QByteArray t862954 = static_cast<QUrl*>(ptr)->scheme().toUtf8(); QtCore_PackedString { const_cast<char*>(t862954.prepend("WHITESPACE").constData()+10), t862954.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_ToDisplayString(void* ptr, long long options)
+{
+	return ({ QByteArray tb72fa5 = static_cast<QUrl*>(ptr)->toDisplayString(static_cast<QUrl::UrlFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(tb72fa5.prepend("WHITESPACE").constData()+10), tb72fa5.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_ToLocalFile(void* ptr)
+{
+	return ({ QByteArray tdd5812 = static_cast<QUrl*>(ptr)->toLocalFile().toUtf8(); QtCore_PackedString { const_cast<char*>(tdd5812.prepend("WHITESPACE").constData()+10), tdd5812.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_ToString(void* ptr, long long options)
+{
+	return ({ QByteArray tc0d7b7 = static_cast<QUrl*>(ptr)->toString(static_cast<QUrl::UrlFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(tc0d7b7.prepend("WHITESPACE").constData()+10), tc0d7b7.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_TopLevelDomain(void* ptr, long long options)
+{
+	return ({ QByteArray t06da8f = static_cast<QUrl*>(ptr)->topLevelDomain(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(t06da8f.prepend("WHITESPACE").constData()+10), t06da8f.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_Url(void* ptr, long long options)
+{
+	return ({ QByteArray t2ea726 = static_cast<QUrl*>(ptr)->url(static_cast<QUrl::UrlFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(t2ea726.prepend("WHITESPACE").constData()+10), t2ea726.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_UserInfo(void* ptr, long long options)
+{
+	return ({ QByteArray tff62a1 = static_cast<QUrl*>(ptr)->userInfo(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(tff62a1.prepend("WHITESPACE").constData()+10), tff62a1.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrl_UserName(void* ptr, long long options)
+{
+	return ({ QByteArray tb9c277 = static_cast<QUrl*>(ptr)->userName(static_cast<QUrl::ComponentFormattingOption>(options)).toUtf8(); QtCore_PackedString { const_cast<char*>(tb9c277.prepend("WHITESPACE").constData()+10), tb9c277.size()-10 }; });
+}
+
+void* QUrl_Adjusted(void* ptr, long long options)
+{
+	return new QUrl(static_cast<QUrl*>(ptr)->adjusted(static_cast<QUrl::UrlFormattingOption>(options)));
+}
+
+void* QUrl_Resolved(void* ptr, void* relative)
+{
+	return new QUrl(static_cast<QUrl*>(ptr)->resolved(*static_cast<QUrl*>(relative)));
+}
+
+char QUrl_HasFragment(void* ptr)
+{
+	return static_cast<QUrl*>(ptr)->hasFragment();
+}
+
+char QUrl_HasQuery(void* ptr)
+{
+	return static_cast<QUrl*>(ptr)->hasQuery();
+}
+
+char QUrl_IsEmpty(void* ptr)
+{
+	return static_cast<QUrl*>(ptr)->isEmpty();
+}
+
+char QUrl_IsLocalFile(void* ptr)
+{
+	return static_cast<QUrl*>(ptr)->isLocalFile();
+}
+
+char QUrl_IsParentOf(void* ptr, void* childUrl)
+{
+	return static_cast<QUrl*>(ptr)->isParentOf(*static_cast<QUrl*>(childUrl));
+}
+
+char QUrl_IsRelative(void* ptr)
+{
+	return static_cast<QUrl*>(ptr)->isRelative();
+}
+
+char QUrl_IsValid(void* ptr)
+{
+	return static_cast<QUrl*>(ptr)->isValid();
+}
+
+char QUrl_Matches(void* ptr, void* url, long long options)
+{
+	return static_cast<QUrl*>(ptr)->matches(*static_cast<QUrl*>(url), static_cast<QUrl::UrlFormattingOption>(options));
+}
+
+int QUrl_Port(void* ptr, int defaultPort)
+{
+	return static_cast<QUrl*>(ptr)->port(defaultPort);
+}
+
+void* QUrl___fromStringList_atList(void* ptr, int i)
+{
+	return new QUrl(static_cast<QList<QUrl>*>(ptr)->at(i));
+}
+
+void QUrl___fromStringList_setList(void* ptr, void* i)
+{
+	static_cast<QList<QUrl>*>(ptr)->append(*static_cast<QUrl*>(i));
+}
+
+void* QUrl___fromStringList_newList(void* ptr)
+{
+	return new QList<QUrl>;
+}
+
+void* QUrl___toStringList_urls_atList(void* ptr, int i)
+{
+	return new QUrl(static_cast<QList<QUrl>*>(ptr)->at(i));
+}
+
+void QUrl___toStringList_urls_setList(void* ptr, void* i)
+{
+	static_cast<QList<QUrl>*>(ptr)->append(*static_cast<QUrl*>(i));
+}
+
+void* QUrl___toStringList_urls_newList(void* ptr)
+{
+	return new QList<QUrl>;
+}
+
+void* QUrl___allEncodedQueryItemValues_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QUrl___allEncodedQueryItemValues_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QUrl___allEncodedQueryItemValues_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QUrlQuery_QUrlQuery_DefaultQueryPairDelimiter()
+{
+	return new QChar(QUrlQuery::defaultQueryPairDelimiter());
+}
+
+void* QUrlQuery_QUrlQuery_DefaultQueryValueDelimiter()
+{
+	return new QChar(QUrlQuery::defaultQueryValueDelimiter());
+}
+
+void* QUrlQuery_NewQUrlQuery()
+{
+	return new QUrlQuery();
+}
+
+void* QUrlQuery_NewQUrlQueryInArena(void* arena)
+{
+	return new (goArenaAlloc<QUrlQuery>(arena)) QUrlQuery();
+}
+
+void* QUrlQuery_NewQUrlQuery3(char* queryString)
+{
+	return new QUrlQuery(QString(queryString));
+}
+
+void* QUrlQuery_NewQUrlQuery3InArena(void* arena, char* queryString)
+{
+	return new (goArenaAlloc<QUrlQuery>(arena)) QUrlQuery(QString(queryString));
+}
+
+void* QUrlQuery_NewQUrlQuery2(void* url)
+{
+	return new QUrlQuery(*static_cast<QUrl*>(url));
+}
+
+void* QUrlQuery_NewQUrlQuery2InArena(void* arena, void* url)
+{
+	return new (goArenaAlloc<QUrlQuery>(arena)) QUrlQuery(*static_cast<QUrl*>(url));
+}
+
+void* QUrlQuery_NewQUrlQuery4(void* other)
+{
+	return new QUrlQuery(*static_cast<QUrlQuery*>(other));
+}
+
+void* QUrlQuery_NewQUrlQuery4InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QUrlQuery>(arena)) QUrlQuery(*static_cast<QUrlQuery*>(other));
+}
+
+void QUrlQuery_AddQueryItem(void* ptr, char* key, char* value)
+{
+	static_cast<QUrlQuery*>(ptr)->addQueryItem(QString(key), QString(value));
+}
+
+void QUrlQuery_Clear(void* ptr)
+{
+	static_cast<QUrlQuery*>(ptr)->clear();
+}
+
+void QUrlQuery_RemoveAllQueryItems(void* ptr, char* key)
+{
+	static_cast<QUrlQuery*>(ptr)->removeAllQueryItems(QString(key));
+}
+
+void QUrlQuery_RemoveQueryItem(void* ptr, char* key)
+{
+	static_cast<QUrlQuery*>(ptr)->removeQueryItem(QString(key));
+}
+
+void QUrlQuery_SetQuery(void* ptr, char* queryString)
+{
+	static_cast<QUrlQuery*>(ptr)->setQuery(QString(queryString));
+}
+
+void QUrlQuery_SetQueryDelimiters(void* ptr, void* valueDelimiter, void* pairDelimiter)
+{
+	static_cast<QUrlQuery*>(ptr)->setQueryDelimiters(*static_cast<QChar*>(valueDelimiter), *static_cast<QChar*>(pairDelimiter));
+}
+
+void QUrlQuery_Swap(void* ptr, void* other)
+{
+	static_cast<QUrlQuery*>(ptr)->swap(*static_cast<QUrlQuery*>(other));
+}
+
+void QUrlQuery_DestroyQUrlQuery(void* ptr)
+{
+	static_cast<QUrlQuery*>(ptr)->~QUrlQuery();
+}
+
+void* QUrlQuery_QueryPairDelimiter(void* ptr)
+{
+	return new QChar(static_cast<QUrlQuery*>(ptr)->queryPairDelimiter());
+}
+
+void* QUrlQuery_QueryValueDelimiter(void* ptr)
+{
+	return new QChar(static_cast<QUrlQuery*>(ptr)->queryValueDelimiter());
+}
+
+struct QtCore_PackedString QUrlQuery_Query(void* ptr, long long encoding)
+{
+	return ({ QByteArray tc70807 = static_cast<QUrlQuery*>(ptr)->query(static_cast<QUrl::ComponentFormattingOption>(encoding)).toUtf8(); QtCore_PackedString { const_cast<char*>(tc70807.prepend("WHITESPACE").constData()+10), tc70807.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrlQuery_QueryItemValue(void* ptr, char* key, long long encoding)
+{
+	return ({ QByteArray tee0580 = static_cast<QUrlQuery*>(ptr)->queryItemValue(QString(key), static_cast<QUrl::ComponentFormattingOption>(encoding)).toUtf8(); QtCore_PackedString { const_cast<char*>(tee0580.prepend("WHITESPACE").constData()+10), tee0580.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrlQuery_ToString(void* ptr, long long encoding)
+{
+	return ({ QByteArray t13eb00 = static_cast<QUrlQuery*>(ptr)->toString(static_cast<QUrl::ComponentFormattingOption>(encoding)).toUtf8(); QtCore_PackedString { const_cast<char*>(t13eb00.prepend("WHITESPACE").constData()+10), t13eb00.size()-10 }; });
+}
+
+struct QtCore_PackedString QUrlQuery_AllQueryItemValues(void* ptr, char* key, long long encoding)
+{
+	return ({ long long t2eae46len; char* t2eae46 = goPackStringList(static_cast<QUrlQuery*>(ptr)->allQueryItemValues(QString(key), static_cast<QUrl::ComponentFormattingOption>(encoding)), &t2eae46len); QtCore_PackedString { t2eae46, t2eae46len }; });
+}
+
+char QUrlQuery_HasQueryItem(void* ptr, char* key)
+{
+	return static_cast<QUrlQuery*>(ptr)->hasQueryItem(QString(key));
+}
+
+char QUrlQuery_IsEmpty(void* ptr)
+{
+	return static_cast<QUrlQuery*>(ptr)->isEmpty();
+}
+
+void* QUuid_QUuid_CreateUuid()
+{
+	return new QUuid(QUuid::createUuid());
+}
+
+void* QUuid_QUuid_CreateUuidV3(void* ns, void* baseData)
+{
+	return new QUuid(QUuid::createUuidV3(*static_cast<QUuid*>(ns), *static_cast<QByteArray*>(baseData)));
+}
+
+void* QUuid_QUuid_CreateUuidV5(void* ns, void* baseData)
+{
+	return new QUuid(QUuid::createUuidV5(*static_cast<QUuid*>(ns), *static_cast<QByteArray*>(baseData)));
+}
+
+void* QUuid_QUuid_CreateUuidV32(void* ns, char* baseData)
+{
+	return new QUuid(QUuid::createUuidV3(*static_cast<QUuid*>(ns), QString(baseData)));
+}
+
+void* QUuid_QUuid_CreateUuidV52(void* ns, char* baseData)
+{
+	return new QUuid(QUuid::createUuidV5(*static_cast<QUuid*>(ns), QString(baseData)));
+}
+
+void* QUuid_QUuid_FromRfc4122(void* bytes)
+{
+	return new QUuid(QUuid::fromRfc4122(*static_cast<QByteArray*>(bytes)));
+}
+
+void* QUuid_NewQUuid()
+{
+	return new QUuid();
+}
+
+void* QUuid_NewQUuidInArena(void* arena)
+{
+	return new (goArenaAlloc<QUuid>(arena)) QUuid();
+}
+
+void* QUuid_NewQUuid5(void* text)
+{
+	return new QUuid(*static_cast<QByteArray*>(text));
+}
+
+void* QUuid_NewQUuid5InArena(void* arena, void* text)
+{
+	return new (goArenaAlloc<QUuid>(arena)) QUuid(*static_cast<QByteArray*>(text));
+}
+
+void* QUuid_NewQUuid3(char* text)
+{
+	return new QUuid(QString(text));
+}
+
+void* QUuid_NewQUuid3InArena(void* arena, char* text)
+{
+	return new (goArenaAlloc<QUuid>(arena)) QUuid(QString(text));
+}
+
+void* QUuid_NewQUuid2(unsigned int l, unsigned short w1, unsigned short w2, char* b1, char* b2, char* b3, char* b4, char* b5, char* b6, char* b7, char* b8)
+{
+	return new QUuid(l, w1, w2, *static_cast<uchar*>(static_cast<void*>(b1)), *static_cast<uchar*>(static_cast<void*>(b2)), *static_cast<uchar*>(static_cast<void*>(b3)), *static_cast<uchar*>(static_cast<void*>(b4)), *static_cast<uchar*>(static_cast<void*>(b5)), *static_cast<uchar*>(static_cast<void*>(b6)), *static_cast<uchar*>(static_cast<void*>(b7)), *static_cast<uchar*>(static_cast<void*>(b8)));
+}
+
+void* QUuid_NewQUuid2InArena(void* arena, unsigned int l, unsigned short w1, unsigned short w2, char* b1, char* b2, char* b3, char* b4, char* b5, char* b6, char* b7, char* b8)
+{
+	return new (goArenaAlloc<QUuid>(arena)) QUuid(l, w1, w2, *static_cast<uchar*>(static_cast<void*>(b1)), *static_cast<uchar*>(static_cast<void*>(b2)), *static_cast<uchar*>(static_cast<void*>(b3)), *static_cast<uchar*>(static_cast<void*>(b4)), *static_cast<uchar*>(static_cast<void*>(b5)), *static_cast<uchar*>(static_cast<void*>(b6)), *static_cast<uchar*>(static_cast<void*>(b7)), *static_cast<uchar*>(static_cast<void*>(b8)));
+}
+
+void* QUuid_ToByteArray(void* ptr)
+{
+	return new QByteArray(static_cast<QUuid*>(ptr)->toByteArray());
+}
+
+void* QUuid_ToRfc4122(void* ptr)
+{
+	return new QByteArray(static_cast<QUuid*>(ptr)->toRfc4122());
+}
+
+struct QtCore_PackedString QUuid_ToString(void* ptr)
+{
+	return ({ QByteArray t6f28ec = static_cast<QUuid*>(ptr)->toString().toUtf8(); QtCore_PackedString { const_cast<char*>(t6f28ec.prepend("WHITESPACE").constData()+10), t6f28ec.size()-10 }; });
+}
+
+long long QUuid_Variant(void* ptr)
+{
+	return static_cast<QUuid*>(ptr)->variant();
+}
+
+long long QUuid_Version(void* ptr)
+{
+	return static_cast<QUuid*>(ptr)->version();
+}
+
+char QUuid_IsNull(void* ptr)
+{
+	return static_cast<QUuid*>(ptr)->isNull();
+}
+
+unsigned int QUuid_Data1(void* ptr)
+{
+	return static_cast<QUuid*>(ptr)->data1;
+}
+
+void QUuid_SetData1(void* ptr, unsigned int vui)
+{
+	static_cast<QUuid*>(ptr)->data1 = vui;
+}
+
+unsigned short QUuid_Data2(void* ptr)
+{
+	return static_cast<QUuid*>(ptr)->data2;
+}
+
+void QUuid_SetData2(void* ptr, unsigned short vus)
+{
+	static_cast<QUuid*>(ptr)->data2 = vus;
+}
+
+unsigned short QUuid_Data3(void* ptr)
+{
+	return static_cast<QUuid*>(ptr)->data3;
+}
+
+void QUuid_SetData3(void* ptr, unsigned short vus)
+{
+	static_cast<QUuid*>(ptr)->data3 = vus;
+}
+
+void* QVariant_NewQVariant20(void* c)
+{
+	return new QVariant(*static_cast<QChar*>(c));
+}
+
+void* QVariant_NewQVariant20InArena(void* arena, void* c)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QChar*>(c));
+}
+
+void* QVariant_NewQVariant()
+{
+	return new QVariant();
+}
+
+void* QVariant_NewQVariantInArena(void* arena)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant();
+}
+
+void* QVariant_NewQVariant6(void* s)
+{
+	return new QVariant(*static_cast<QDataStream*>(s));
+}
+
+void* QVariant_NewQVariant6InArena(void* arena, void* s)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QDataStream*>(s));
+}
+
+void* QVariant_NewQVariant18(void* val)
+{
+	return new QVariant(*static_cast<QLatin1String*>(val));
+}
+
+void* QVariant_NewQVariant18InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QLatin1String*>(val));
+}
+
+void* QVariant_NewQVariant47(void* other)
+{
+	return new QVariant(*static_cast<QVariant*>(other));
+}
+
+void* QVariant_NewQVariant47InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QVariant*>(other));
+}
+
+void* QVariant_NewQVariant11(char val)
+{
+	return new QVariant(val != 0);
+}
+
+void* QVariant_NewQVariant11InArena(void* arena, char val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(val != 0);
+}
+
+void* QVariant_NewQVariant16(void* val)
+{
+	return new QVariant(*static_cast<QBitArray*>(val));
+}
+
+void* QVariant_NewQVariant16InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QBitArray*>(val));
+}
+
+void* QVariant_NewQVariant15(void* val)
+{
+	return new QVariant(*static_cast<QByteArray*>(val));
+}
+
+void* QVariant_NewQVariant15InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QByteArray*>(val));
+}
+
+void* QVariant_NewQVariant21(void* val)
+{
+	return new QVariant(*static_cast<QDate*>(val));
+}
+
+void* QVariant_NewQVariant21InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QDate*>(val));
+}
+
+void* QVariant_NewQVariant23(void* val)
+{
+	return new QVariant(*static_cast<QDateTime*>(val));
+}
+
+void* QVariant_NewQVariant23InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QDateTime*>(val));
+}
+
+void* QVariant_NewQVariant39(void* val)
+{
+	return new QVariant(*static_cast<QEasingCurve*>(val));
+}
+
+void* QVariant_NewQVariant39InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QEasingCurve*>(val));
+}
+
+void* QVariant_NewQVariant26(void* val)
+{
+	return new QVariant(*static_cast<QHash<QString, QVariant>*>(val));
+}
+
+void* QVariant_NewQVariant26InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QHash<QString, QVariant>*>(val));
+}
+
+void* QVariant_NewQVariant45(void* val)
+{
+	return new QVariant(*static_cast<QJsonArray*>(val));
+}
+
+void* QVariant_NewQVariant45InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QJsonArray*>(val));
+}
+
+void* QVariant_NewQVariant46(void* val)
+{
+	return new QVariant(*static_cast<QJsonDocument*>(val));
+}
+
+void* QVariant_NewQVariant46InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QJsonDocument*>(val));
+}
+
+void* QVariant_NewQVariant44(void* val)
+{
+	return new QVariant(*static_cast<QJsonObject*>(val));
+}
+
+void* QVariant_NewQVariant44InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QJsonObject*>(val));
+}
+
+void* QVariant_NewQVariant43(void* val)
+{
+	return new QVariant(*static_cast<QJsonValue*>(val));
+}
+
+void* QVariant_NewQVariant43InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QJsonValue*>(val));
+}
+
+void* QVariant_NewQVariant31(void* val)
+{
+	return new QVariant(*static_cast<QLine*>(val));
+}
+
+void* QVariant_NewQVariant31InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QLine*>(val));
+}
+
+void* QVariant_NewQVariant32(void* val)
+{
+	return new QVariant(*static_cast<QLineF*>(val));
+}
+
+void* QVariant_NewQVariant32InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QLineF*>(val));
+}
+
+void* QVariant_NewQVariant24(void* val)
+{
+	return new QVariant(*static_cast<QList<QVariant>*>(val));
+}
+
+void* QVariant_NewQVariant24InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QList<QVariant>*>(val));
+}
+
+void* QVariant_NewQVariant35(void* l)
+{
+	return new QVariant(*static_cast<QLocale*>(l));
+}
+
+void* QVariant_NewQVariant35InArena(void* arena, void* l)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QLocale*>(l));
+}
+
+void* QVariant_NewQVariant25(void* val)
+{
+	return new QVariant(*static_cast<QMap<QString, QVariant>*>(val));
+}
+
+void* QVariant_NewQVariant25InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QMap<QString, QVariant>*>(val));
+}
+
+void* QVariant_NewQVariant41(void* val)
+{
+	return new QVariant(*static_cast<QModelIndex*>(val));
+}
+
+void* QVariant_NewQVariant41InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QModelIndex*>(val));
+}
+
+void* QVariant_NewQVariant42(void* val)
+{
+	return new QVariant(*static_cast<QPersistentModelIndex*>(val));
+}
+
+void* QVariant_NewQVariant42InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QPersistentModelIndex*>(val));
+}
+
+void* QVariant_NewQVariant29(void* val)
+{
+	return new QVariant(*static_cast<QPoint*>(val));
+}
+
+void* QVariant_NewQVariant29InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QPoint*>(val));
+}
+
+void* QVariant_NewQVariant30(void* val)
+{
+	return new QVariant(*static_cast<QPointF*>(val));
+}
+
+void* QVariant_NewQVariant30InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QPointF*>(val));
+}
+
+void* QVariant_NewQVariant33(void* val)
+{
+	return new QVariant(*static_cast<QRect*>(val));
+}
+
+void* QVariant_NewQVariant33InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QRect*>(val));
+}
+
+void* QVariant_NewQVariant34(void* val)
+{
+	return new QVariant(*static_cast<QRectF*>(val));
+}
+
+void* QVariant_NewQVariant34InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QRectF*>(val));
+}
+
+void* QVariant_NewQVariant36(void* regExp)
+{
+	return new QVariant(*static_cast<QRegExp*>(regExp));
+}
+
+void* QVariant_NewQVariant36InArena(void* arena, void* regExp)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QRegExp*>(regExp));
+}
+
+void* QVariant_NewQVariant37(void* re)
+{
+	return new QVariant(*static_cast<QRegularExpression*>(re));
+}
+
+void* QVariant_NewQVariant37InArena(void* arena, void* re)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QRegularExpression*>(re));
+}
+
+void* QVariant_NewQVariant27(void* val)
+{
+	return new QVariant(*static_cast<QSize*>(val));
+}
+
+void* QVariant_NewQVariant27InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QSize*>(val));
+}
+
+void* QVariant_NewQVariant28(void* val)
+{
+	return new QVariant(*static_cast<QSizeF*>(val));
+}
+
+void* QVariant_NewQVariant28InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QSizeF*>(val));
+}
+
+void* QVariant_NewQVariant17(char* val)
+{
+	return new QVariant(QString(val));
+}
+
+void* QVariant_NewQVariant17InArena(void* arena, char* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(QString(val));
+}
+
+void* QVariant_NewQVariant19(char* val)
+{
+	return new QVariant(goUnpackStringList(val));
+}
+
+void* QVariant_NewQVariant19InArena(void* arena, char* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(goUnpackStringList(val));
+}
+
+void* QVariant_NewQVariant22(void* val)
+{
+	return new QVariant(*static_cast<QTime*>(val));
+}
+
+void* QVariant_NewQVariant22InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QTime*>(val));
+}
+
+void* QVariant_NewQVariant38(void* val)
+{
+	return new QVariant(*static_cast<QUrl*>(val));
+}
+
+void* QVariant_NewQVariant38InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QUrl*>(val));
+}
+
+void* QVariant_NewQVariant40(void* val)
+{
+	return new QVariant(*static_cast<QUuid*>(val));
+}
+
+void* QVariant_NewQVariant40InArena(void* arena, void* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QUuid*>(val));
+}
+
+void* QVariant_NewQVariant5(void* p)
+{
+	return new QVariant(*static_cast<QVariant*>(p));
+}
+
+void* QVariant_NewQVariant5InArena(void* arena, void* p)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(*static_cast<QVariant*>(p));
+}
+
+void* QVariant_NewQVariant14(char* val)
+{
+	return new QVariant(const_cast<const char*>(val));
+}
+
+void* QVariant_NewQVariant14InArena(void* arena, char* val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(const_cast<const char*>(val));
+}
+
+void* QVariant_NewQVariant12(double val)
+{
+	return new QVariant(val);
+}
+
+void* QVariant_NewQVariant12InArena(void* arena, double val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(val);
+}
+
+void* QVariant_NewQVariant13(float val)
+{
+	return new QVariant(val);
+}
+
+void* QVariant_NewQVariant13InArena(void* arena, float val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(val);
+}
+
+void* QVariant_NewQVariant3(int typeId, void* copy)
+{
+	return new QVariant(typeId, copy);
+}
+
+void* QVariant_NewQVariant3InArena(void* arena, int typeId, void* copy)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(typeId, copy);
+}
+
+void* QVariant_NewQVariant7(int val)
+{
+	return new QVariant(val);
+}
+
+void* QVariant_NewQVariant7InArena(void* arena, int val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(val);
+}
+
+void* QVariant_NewQVariant9(long long val)
+{
+	return new QVariant(val);
+}
+
+void* QVariant_NewQVariant9InArena(void* arena, long long val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(val);
+}
+
+void* QVariant_NewQVariant10(unsigned long long val)
+{
+	return new QVariant(val);
+}
+
+void* QVariant_NewQVariant10InArena(void* arena, unsigned long long val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(val);
+}
+
+void* QVariant_NewQVariant8(unsigned int val)
+{
+	return new QVariant(val);
+}
+
+void* QVariant_NewQVariant8InArena(void* arena, unsigned int val)
+{
+	return new (goArenaAlloc<QVariant>(arena)) QVariant(val);
+}
+
+char QVariant_Convert(void* ptr, int targetTypeId)
+{
+	return static_cast<QVariant*>(ptr)->convert(targetTypeId);
+}
+
+struct QtCore_PackedString QVariant_QVariant_TypeToName(int typeId)
+{
+	return QtCore_PackedString { const_cast<char*>(QVariant::typeToName(typeId)), typeId };
+}
+
+void QVariant_Clear(void* ptr)
+{
+	static_cast<QVariant*>(ptr)->clear();
+}
+
+void QVariant_Swap(void* ptr, void* other)
+{
+	static_cast<QVariant*>(ptr)->swap(*static_cast<QVariant*>(other));
+}
+
+void QVariant_DestroyQVariant(void* ptr)
+{
+	static_cast<QVariant*>(ptr)->~QVariant();
+}
+
+void* QVariant_ToBitArray(void* ptr)
+{
+	return new QBitArray(static_cast<QVariant*>(ptr)->toBitArray());
+}
+
+void* QVariant_ToByteArray(void* ptr)
+{
+	return new QByteArray(static_cast<QVariant*>(ptr)->toByteArray());
+}
+
+void* QVariant_ToChar(void* ptr)
+{
+	return new QChar(static_cast<QVariant*>(ptr)->toChar());
+}
+
+void* QVariant_ToDate(void* ptr)
+{
+	return new QDate(static_cast<QVariant*>(ptr)->toDate());
+}
+
+void* QVariant_ToDateTime(void* ptr)
+{
+	return new QDateTime(static_cast<QVariant*>(ptr)->toDateTime());
+}
+
+void* QVariant_ToEasingCurve(void* ptr)
+{
+	return new QEasingCurve(static_cast<QVariant*>(ptr)->toEasingCurve());
+}
+
+struct QtCore_PackedList QVariant_ToHash(void* ptr)
+{
+	return ({ QHash<QString, QVariant>* tmpValue = new QHash<QString, QVariant>(static_cast<QVariant*>(ptr)->toHash()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QVariant_ToJsonArray(void* ptr)
+{
+	return new QJsonArray(static_cast<QVariant*>(ptr)->toJsonArray());
+}
+
+void* QVariant_ToJsonDocument(void* ptr)
+{
+	return new QJsonDocument(static_cast<QVariant*>(ptr)->toJsonDocument());
+}
+
+void* QVariant_ToJsonObject(void* ptr)
+{
+	return new QJsonObject(static_cast<QVariant*>(ptr)->toJsonObject());
+}
+
+void* QVariant_ToJsonValue(void* ptr)
+{
+	return new QJsonValue(static_cast<QVariant*>(ptr)->toJsonValue());
+}
+
+void* QVariant_ToLine(void* ptr)
+{
+	return ({ QLine tmpValue = static_cast<QVariant*>(ptr)->toLine(); new QLine(tmpValue.p1(), tmpValue.p2()); });
+}
+
+void* QVariant_ToLineF(void* ptr)
+{
+	return ({ QLineF tmpValue = static_cast<QVariant*>(ptr)->toLineF(); new QLineF(tmpValue.p1(), tmpValue.p2()); });
+}
+
+struct QtCore_PackedList QVariant_ToList(void* ptr)
+{
+	return ({ QList<QVariant>* tmpValue = new QList<QVariant>(static_cast<QVariant*>(ptr)->toList()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QVariant_ToLocale(void* ptr)
+{
+	return new QLocale(static_cast<QVariant*>(ptr)->toLocale());
+}
+
+struct QtCore_PackedList QVariant_ToMap(void* ptr)
+{
+	return ({ QMap<QString, QVariant>* tmpValue = new QMap<QString, QVariant>(static_cast<QVariant*>(ptr)->toMap()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QVariant_ToModelIndex(void* ptr)
+{
+	return new QModelIndex(static_cast<QVariant*>(ptr)->toModelIndex());
+}
+
+void* QVariant_ToPersistentModelIndex(void* ptr)
+{
+	return new QPersistentModelIndex(static_cast<QVariant*>(ptr)->toPersistentModelIndex());
+}
+
+void* QVariant_ToPoint(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QVariant*>(ptr)->toPoint(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QVariant_ToPointF(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QVariant*>(ptr)->toPointF(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QVariant_ToRect(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QVariant*>(ptr)->toRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QVariant_ToRectF(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QVariant*>(ptr)->toRectF(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QVariant_ToRegExp(void* ptr)
+{
+	return new QRegExp(static_cast<QVariant*>(ptr)->toRegExp());
+}
+
+void* QVariant_ToRegularExpression(void* ptr)
+{
+	return new QRegularExpression(static_cast<QVariant*>(ptr)->toRegularExpression());
+}
+
+void* QVariant_ToSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QVariant*>(ptr)->toSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QVariant_ToSizeF(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QVariant*>(ptr)->toSizeF(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtCore_PackedString QVariant_ToString(void* ptr)
+{
+	return ({ QByteArray tf9e1e4 = static_cast<QVariant*>(ptr)->toString().toUtf8(); QtCore_PackedString { const_cast<char*>(tf9e1e4.prepend("WHITESPACE").constData()+10), tf9e1e4.size()-10 }; });
+}
+
+struct QtCore_PackedString QVariant_ToStringList(void* ptr)
+{
+	return ({ long long tf99cb6len; char* tf99cb6 = goPackStringList(static_cast<QVariant*>(ptr)->toStringList(), &tf99cb6len); QtCore_PackedString { tf99cb6, tf99cb6len }; });
+}
+
+void* QVariant_ToTime(void* ptr)
+{
+	return new QTime(static_cast<QVariant*>(ptr)->toTime());
+}
+
+void* QVariant_ToUrl(void* ptr)
+{
+	return new QUrl(static_cast<QVariant*>(ptr)->toUrl());
+}
+
+void* QVariant_ToUuid(void* ptr)
+{
+	return new QUuid(static_cast<QVariant*>(ptr)->toUuid());
+}
+
+char QVariant_IsNull(void* ptr)
+{
+	return static_cast<QVariant*>(ptr)->isNull();
+}
+
+char QVariant_IsValid(void* ptr)
+{
+	return static_cast<QVariant*>(ptr)->isValid();
+}
+
+char QVariant_ToBool(void* ptr)
+{
+	return static_cast<QVariant*>(ptr)->toBool();
+}
+
+struct QtCore_PackedString QVariant_TypeName(void* ptr)
+{
+	return QtCore_PackedString { const_cast<char*>(static_cast<QVariant*>(ptr)->typeName()), -1 };
+}
+
+double QVariant_ToDouble(void* ptr, char ok)
+{
+	return static_cast<QVariant*>(ptr)->toDouble(NULL);
+}
+
+float QVariant_ToFloat(void* ptr, char ok)
+{
+	return static_cast<QVariant*>(ptr)->toFloat(NULL);
+}
+
+int QVariant_ToInt(void* ptr, char ok)
+{
+	return static_cast<QVariant*>(ptr)->toInt(NULL);
+}
+
+int QVariant_UserType(void* ptr)
+{
+	return static_cast<QVariant*>(ptr)->userType();
+}
+
+long long QVariant_ToLongLong(void* ptr, char ok)
+{
+	return static_cast<QVariant*>(ptr)->toLongLong(NULL);
+}
+
+double QVariant_ToReal(void* ptr, char ok)
+{
+	return static_cast<QVariant*>(ptr)->toReal(NULL);
+}
+
+unsigned long long QVariant_ToULongLong(void* ptr, char ok)
+{
+	return static_cast<QVariant*>(ptr)->toULongLong(NULL);
+}
+
+unsigned int QVariant_ToUInt(void* ptr, char ok)
+{
+	return static_cast<QVariant*>(ptr)->toUInt(NULL);
+}
+
+void* QVariant_ToColor(void* ptr)
+{
+	return new QColor(qvariant_cast<QColor>(*static_cast<QVariant*>(ptr)));
+}
+
+void* QVariant_ToFont(void* ptr)
+{
+	return new QFont(qvariant_cast<QFont>(*static_cast<QVariant*>(ptr)));
+}
+
+void* QVariant_ToImage(void* ptr)
+{
+	return new QImage(qvariant_cast<QImage>(*static_cast<QVariant*>(ptr)));
+}
+
+void* QVariant_ToObject(void* ptr)
+{
+	return qvariant_cast<QObject*>(*static_cast<QVariant*>(ptr));
+}
+
+void* QVariant___QVariant_val_atList26(void* ptr, char* i)
+{
+	return new QVariant(static_cast<QHash<QString, QVariant>*>(ptr)->value(QString(i)));
+}
+
+void QVariant___QVariant_val_setList26(void* ptr, char* key, void* i)
+{
+	static_cast<QHash<QString, QVariant>*>(ptr)->insert(QString(key), *static_cast<QVariant*>(i));
+}
+
+void* QVariant___QVariant_val_newList26(void* ptr)
+{
+	return new QHash<QString, QVariant>;
+}
+
+struct QtCore_PackedList QVariant___QVariant_keyList26(void* ptr)
+{
+	return ({ QList<QString>* tmpValue = new QList<QString>(static_cast<QHash<QString, QVariant>*>(ptr)->keys()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QVariant___QVariant_val_atList24(void* ptr, int i)
+{
+	return new QVariant(static_cast<QList<QVariant>*>(ptr)->at(i));
+}
+
+void QVariant___QVariant_val_setList24(void* ptr, void* i)
+{
+	static_cast<QList<QVariant>*>(ptr)->append(*static_cast<QVariant*>(i));
+}
+
+void* QVariant___QVariant_val_newList24(void* ptr)
+{
+	return new QList<QVariant>;
+}
+
+void* QVariant___QVariant_val_atList25(void* ptr, char* i)
+{
+	return new QVariant(static_cast<QMap<QString, QVariant>*>(ptr)->value(QString(i)));
+}
+
+void QVariant___QVariant_val_setList25(void* ptr, char* key, void* i)
+{
+	static_cast<QMap<QString, QVariant>*>(ptr)->insert(QString(key), *static_cast<QVariant*>(i));
+}
+
+void* QVariant___QVariant_val_newList25(void* ptr)
+{
+	return new QMap<QString, QVariant>;
+}
+
+struct QtCore_PackedList QVariant___QVariant_keyList25(void* ptr)
+{
+	return ({ QList<QString>* tmpValue = new QList<QString>(static_cast<QMap<QString, QVariant>*>(ptr)->keys()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QVariant___toHash_atList(void* ptr, char* i)
+{
+	return new QVariant(static_cast<QHash<QString, QVariant>*>(ptr)->value(QString(i)));
+}
+
+void QVariant___toHash_setList(void* ptr, char* key, void* i)
+{
+	static_cast<QHash<QString, QVariant>*>(ptr)->insert(QString(key), *static_cast<QVariant*>(i));
+}
+
+void* QVariant___toHash_newList(void* ptr)
+{
+	return new QHash<QString, QVariant>;
+}
+
+struct QtCore_PackedList QVariant___toHash_keyList(void* ptr)
+{
+	return ({ QList<QString>* tmpValue = new QList<QString>(static_cast<QHash<QString, QVariant>*>(ptr)->keys()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QVariant___toList_atList(void* ptr, int i)
+{
+	return new QVariant(static_cast<QList<QVariant>*>(ptr)->at(i));
+}
+
+void QVariant___toList_setList(void* ptr, void* i)
+{
+	static_cast<QList<QVariant>*>(ptr)->append(*static_cast<QVariant*>(i));
+}
+
+void* QVariant___toList_newList(void* ptr)
+{
+	return new QList<QVariant>;
+}
+
+void* QVariant___toMap_atList(void* ptr, char* i)
+{
+	return new QVariant(static_cast<QMap<QString, QVariant>*>(ptr)->value(QString(i)));
+}
+
+void QVariant___toMap_setList(void* ptr, char* key, void* i)
+{
+	static_cast<QMap<QString, QVariant>*>(ptr)->insert(QString(key), *static_cast<QVariant*>(i));
+}
+
+void* QVariant___toMap_newList(void* ptr)
+{
+	return new QMap<QString, QVariant>;
+}
+
+struct QtCore_PackedList QVariant___toMap_keyList(void* ptr)
+{
+	return ({ QList<QString>* tmpValue = new QList<QString>(static_cast<QMap<QString, QVariant>*>(ptr)->keys()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtCore_PackedString QVariant_____QVariant_keyList_atList26(void* ptr, int i)
+{
+	return ({ QByteArray t29def6 = static_cast<QList<QString>*>(ptr)->at(i).toUtf8(); QtCore_PackedString { const_cast<char*>(t29def6.prepend("WHITESPACE").constData()+10), t29def6.size()-10 }; });
+}
+
+void QVariant_____QVariant_keyList_setList26(void* ptr, char* i)
+{
+	static_cast<QList<QString>*>(ptr)->append(QString(i));
+}
+
+void* QVariant_____QVariant_keyList_newList26(void* ptr)
+{
+	return new QList<QString>;
+}
+
+struct QtCore_PackedString QVariant_____QVariant_keyList_atList25(void* ptr, int i)
+{
+	return ({ QByteArray t29def6 = static_cast<QList<QString>*>(ptr)->at(i).toUtf8(); QtCore_PackedString { const_cast<char*>(t29def6.prepend("WHITESPACE").constData()+10), t29def6.size()-10 }; });
+}
+
+void QVariant_____QVariant_keyList_setList25(void* ptr, char* i)
+{
+	static_cast<QList<QString>*>(ptr)->append(QString(i));
+}
+
+void* QVariant_____QVariant_keyList_newList25(void* ptr)
+{
+	return new QList<QString>;
+}
+
+struct QtCore_PackedString QVariant_____toHash_keyList_atList(void* ptr, int i)
+{
+	return ({ QByteArray t29def6 = static_cast<QList<QString>*>(ptr)->at(i).toUtf8(); QtCore_PackedString { const_cast<char*>(t29def6.prepend("WHITESPACE").constData()+10), t29def6.size()-10 }; });
+}
+
+void QVariant_____toHash_keyList_setList(void* ptr, char* i)
+{
+	static_cast<QList<QString>*>(ptr)->append(QString(i));
+}
+
+void* QVariant_____toHash_keyList_newList(void* ptr)
+{
+	return new QList<QString>;
+}
+
+struct QtCore_PackedString QVariant_____toMap_keyList_atList(void* ptr, int i)
+{
+	return ({ QByteArray t29def6 = static_cast<QList<QString>*>(ptr)->at(i).toUtf8(); QtCore_PackedString { const_cast<char*>(t29def6.prepend("WHITESPACE").constData()+10), t29def6.size()-10 }; });
+}
+
+void QVariant_____toMap_keyList_setList(void* ptr, char* i)
+{
+	static_cast<QList<QString>*>(ptr)->append(QString(i));
+}
+
+void* QVariant_____toMap_keyList_newList(void* ptr)
+{
+	return new QList<QString>;
+}
+
+class MyQVariantAnimation: public QVariantAnimation
+{
+public:
+	MyQVariantAnimation(QObject *parent) : QVariantAnimation(parent) {};
+	bool event(QEvent * event) { return callbackQObject_Event(this, event) != 0; };
+	void updateCurrentTime(int vin) { callbackQVariantAnimation_UpdateCurrentTime(this, vin); };
+	void updateCurrentValue(const QVariant & value) { callbackQVariantAnimation_UpdateCurrentValue(this, const_cast<QVariant*>(&value)); };
+	void updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_UpdateState(this, newState, oldState); };
+	void Signal_ValueChanged(const QVariant & value) { callbackQVariantAnimation_ValueChanged(this, const_cast<QVariant*>(&value)); };
+	QVariant interpolated(const QVariant & from, const QVariant & to, qreal progress) const { return *static_cast<QVariant*>(callbackQVariantAnimation_Interpolated(const_cast<void*>(static_cast<const void*>(this)), const_cast<QVariant*>(&from), const_cast<QVariant*>(&to), progress)); };
+	int duration() const { return callbackQVariantAnimation_Duration(const_cast<void*>(static_cast<const void*>(this))); };
+	void Signal_Finished() { callbackQAbstractAnimation_Finished(this); };
+	void setCurrentTime(int msecs) { callbackQAbstractAnimation_SetCurrentTime(this, msecs); };
+	void Signal_CurrentLoopChanged(int currentLoop) { callbackQAbstractAnimation_CurrentLoopChanged(this, currentLoop); };
+	void Signal_DirectionChanged(QAbstractAnimation::Direction newDirection) { callbackQAbstractAnimation_DirectionChanged(this, newDirection); };
+	void pause() { callbackQAbstractAnimation_Pause(this); };
+	void resume() { callbackQAbstractAnimation_Resume(this); };
+	void setPaused(bool paused) { callbackQAbstractAnimation_SetPaused(this, paused); };
+	void start(QAbstractAnimation::DeletionPolicy policy) { callbackQAbstractAnimation_Start(this, policy); };
+	void Signal_StateChanged(QAbstractAnimation::State newState, QAbstractAnimation::State oldState) { callbackQAbstractAnimation_StateChanged(this, newState, oldState); };
+	void stop() { callbackQAbstractAnimation_Stop(this); };
+	void updateDirection(QAbstractAnimation::Direction direction) { callbackQAbstractAnimation_UpdateDirection(this, direction); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtCore_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QVariantAnimation_SetEndValue(void* ptr, void* value)
+{
+	static_cast<QVariantAnimation*>(ptr)->setEndValue(*static_cast<QVariant*>(value));
+}
+
+void QVariantAnimation_SetStartValue(void* ptr, void* value)
+{
+	static_cast<QVariantAnimation*>(ptr)->setStartValue(*static_cast<QVariant*>(value));
+}
+
+void* QVariantAnimation_NewQVariantAnimation(void* parent)
+{
+	return new MyQVariantAnimation(static_cast<QObject*>(parent));
+}
+
+void QVariantAnimation_SetDuration(void* ptr, int msecs)
+{
+	static_cast<QVariantAnimation*>(ptr)->setDuration(msecs);
+}
+
+void QVariantAnimation_SetEasingCurve(void* ptr, void* easing)
+{
+	static_cast<QVariantAnimation*>(ptr)->setEasingCurve(*static_cast<QEasingCurve*>(easing));
+}
+
+void QVariantAnimation_SetKeyValueAt(void* ptr, double step, void* value)
+{
+	static_cast<QVariantAnimation*>(ptr)->setKeyValueAt(step, *static_cast<QVariant*>(value));
+}
+
+void QVariantAnimation_UpdateCurrentTime(void* ptr, int vin)
+{
+	static_cast<QVariantAnimation*>(ptr)->updateCurrentTime(vin);
+}
+
+void QVariantAnimation_UpdateCurrentTimeDefault(void* ptr, int vin)
+{
+	if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::updateCurrentTime(vin);
+	} else {
+		static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::updateCurrentTime(vin);
+	}
+}
+
+void QVariantAnimation_UpdateCurrentValue(void* ptr, void* value)
+{
+	static_cast<QVariantAnimation*>(ptr)->updateCurrentValue(*static_cast<QVariant*>(value));
+}
+
+void QVariantAnimation_UpdateCurrentValueDefault(void* ptr, void* value)
+{
+	if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::updateCurrentValue(*static_cast<QVariant*>(value));
+	} else {
+		static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::updateCurrentValue(*static_cast<QVariant*>(value));
+	}
+}
+
+void QVariantAnimation_ConnectValueChanged(void* ptr)
+{
+	QObject::connect(static_cast<QVariantAnimation*>(ptr), static_cast<void (QVariantAnimation::*)(const QVariant &)>(&QVariantAnimation::valueChanged), static_cast<MyQVariantAnimation*>(ptr), static_cast<void (MyQVariantAnimation::*)(const QVariant &)>(&MyQVariantAnimation::Signal_ValueChanged));
+}
+
+void QVariantAnimation_DisconnectValueChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QVariantAnimation*>(ptr), static_cast<void (QVariantAnimation::*)(const QVariant &)>(&QVariantAnimation::valueChanged), static_cast<MyQVariantAnimation*>(ptr), static_cast<void (MyQVariantAnimation::*)(const QVariant &)>(&MyQVariantAnimation::Signal_ValueChanged));
+}
+
+void QVariantAnimation_ValueChanged(void* ptr, void* value)
+{
+	static_cast<QVariantAnimation*>(ptr)->valueChanged(*static_cast<QVariant*>(value));
+}
+
+void QVariantAnimation_DestroyQVariantAnimation(void* ptr)
+{
+	static_cast<QVariantAnimation*>(ptr)->~QVariantAnimation();
+}
+
+void* QVariantAnimation_EasingCurve(void* ptr)
+{
+	return new QEasingCurve(static_cast<QVariantAnimation*>(ptr)->easingCurve());
+}
+
+void* QVariantAnimation_CurrentValue(void* ptr)
+{
+	return new QVariant(static_cast<QVariantAnimation*>(ptr)->currentValue());
+}
+
+void* QVariantAnimation_EndValue(void* ptr)
+{
+	return new QVariant(static_cast<QVariantAnimation*>(ptr)->endValue());
+}
+
+void* QVariantAnimation_Interpolated(void* ptr, void* from, void* to, double progress)
+{
+	return new QVariant(static_cast<QVariantAnimation*>(ptr)->interpolated(*static_cast<QVariant*>(from), *static_cast<QVariant*>(to), progress));
+}
+
+void* QVariantAnimation_InterpolatedDefault(void* ptr, void* from, void* to, double progress)
+{
+	if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::interpolated(*static_cast<QVariant*>(from), *static_cast<QVariant*>(to), progress));
+	} else {
+		return new QVariant(static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::interpolated(*static_cast<QVariant*>(from), *static_cast<QVariant*>(to), progress));
+	}
+}
+
+void* QVariantAnimation_KeyValueAt(void* ptr, double step)
+{
+	return new QVariant(static_cast<QVariantAnimation*>(ptr)->keyValueAt(step));
+}
+
+void* QVariantAnimation_StartValue(void* ptr)
+{
+	return new QVariant(static_cast<QVariantAnimation*>(ptr)->startValue());
+}
+
+int QVariantAnimation_Duration(void* ptr)
+{
+	return static_cast<QVariantAnimation*>(ptr)->duration();
+}
+
+int QVariantAnimation_DurationDefault(void* ptr)
+{
+	if (dynamic_cast<QPropertyAnimation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPropertyAnimation*>(ptr)->QPropertyAnimation::duration();
+	} else {
+		return static_cast<QVariantAnimation*>(ptr)->QVariantAnimation::duration();
+	}
+}
+
+void* QVersionNumber_QVersionNumber_CommonPrefix(void* v1, void* v2)
+{
+	return new QVersionNumber(QVersionNumber::commonPrefix(*static_cast<QVersionNumber*>(v1), *static_cast<QVersionNumber*>(v2)));
+}
+
+void* QVersionNumber_QVersionNumber_FromString(char* stri, int suffixIndex)
+{
+	return new QVersionNumber(QVersionNumber::fromString(QString(stri), &suffixIndex));
+}
+
+struct QtCore_PackedString QVersionNumber_ToString(void* ptr)
+{
+	return ({ QByteArray t62e3a8 = static_cast<QVersionNumber*>(ptr)->toString().toUtf8(); QtCore_PackedString { const_cast<char*>(t62e3a8.prepend("WHITESPACE").constData()+10), t62e3a8.size()-10 }; });
+}
+
+void* QVersionNumber_NewQVersionNumber()
+{
+	return new QVersionNumber();
+}
+
+void* QVersionNumber_NewQVersionNumberInArena(void* arena)
+{
+	return new (goArenaAlloc<QVersionNumber>(arena)) QVersionNumber();
+}
+
+void* QVersionNumber_NewQVersionNumber3(void* seg)
+{
+	return new QVersionNumber(*static_cast<QVector<int>*>(seg));
+}
+
+void* QVersionNumber_NewQVersionNumber3InArena(void* arena, void* seg)
+{
+	return new (goArenaAlloc<QVersionNumber>(arena)) QVersionNumber(*static_cast<QVector<int>*>(seg));
+}
+
+void* QVersionNumber_NewQVersionNumber2(void* seg)
+{
+	return new QVersionNumber(*static_cast<QVector<int>*>(seg));
+}
+
+void* QVersionNumber_NewQVersionNumber2InArena(void* arena, void* seg)
+{
+	return new (goArenaAlloc<QVersionNumber>(arena)) QVersionNumber(*static_cast<QVector<int>*>(seg));
+}
+
+void* QVersionNumber_NewQVersionNumber5(int maj)
+{
+	return new QVersionNumber(maj);
+}
+
+void* QVersionNumber_NewQVersionNumber5InArena(void* arena, int maj)
+{
+	return new (goArenaAlloc<QVersionNumber>(arena)) QVersionNumber(maj);
+}
+
+void* QVersionNumber_NewQVersionNumber6(int maj, int min)
+{
+	return new QVersionNumber(maj, min);
+}
+
+void* QVersionNumber_NewQVersionNumber6InArena(void* arena, int maj, int min)
+{
+	return new (goArenaAlloc<QVersionNumber>(arena)) QVersionNumber(maj, min);
+}
+
+void* QVersionNumber_NewQVersionNumber7(int maj, int min, int mic)
+{
+	return new QVersionNumber(maj, min, mic);
+}
+
+void* QVersionNumber_NewQVersionNumber7InArena(void* arena, int maj, int min, int mic)
+{
+	return new (goArenaAlloc<QVersionNumber>(arena)) QVersionNumber(maj, min, mic);
+}
+
+int QVersionNumber_QVersionNumber_Compare(void* v1, void* v2)
+{
+	return QVersionNumber::compare(*static_cast<QVersionNumber*>(v1), *static_cast<QVersionNumber*>(v2));
+}
+
+struct QtCore_PackedList QVersionNumber_Segments(void* ptr)
+{
+	return ({ QVector<int>* tmpValue = new QVector<int>(static_cast<QVersionNumber*>(ptr)->segments()); QtCore_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QVersionNumber_Normalized(void* ptr)
+{
+	return new QVersionNumber(static_cast<QVersionNumber*>(ptr)->normalized());
+}
+
+char QVersionNumber_IsNormalized(void* ptr)
+{
+	return static_cast<QVersionNumber*>(ptr)->isNormalized();
+}
+
+char QVersionNumber_IsNull(void* ptr)
+{
+	return static_cast<QVersionNumber*>(ptr)->isNull();
+}
+
+char QVersionNumber_IsPrefixOf(void* ptr, void* other)
+{
+	return static_cast<QVersionNumber*>(ptr)->isPrefixOf(*static_cast<QVersionNumber*>(other));
+}
+
+int QVersionNumber_MajorVersion(void* ptr)
+{
+	return static_cast<QVersionNumber*>(ptr)->majorVersion();
+}
+
+int QVersionNumber_MicroVersion(void* ptr)
+{
+	return static_cast<QVersionNumber*>(ptr)->microVersion();
+}
+
+int QVersionNumber_MinorVersion(void* ptr)
+{
+	return static_cast<QVersionNumber*>(ptr)->minorVersion();
+}
+
+int QVersionNumber_SegmentAt(void* ptr, int index)
+{
+	return static_cast<QVersionNumber*>(ptr)->segmentAt(index);
+}
+
+int QVersionNumber_SegmentCount(void* ptr)
+{
+	return static_cast<QVersionNumber*>(ptr)->segmentCount();
+}
+
+int QVersionNumber___QVersionNumber_seg_atList3(void* ptr, int i)
+{
+	return static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+void QVersionNumber___QVersionNumber_seg_setList3(void* ptr, int i)
+{
+	static_cast<QVector<int>*>(ptr)->append(i);
+}
+
+void* QVersionNumber___QVersionNumber_seg_newList3(void* ptr)
+{
+	return new QVector<int>;
+}
+
+void* QVersionNumber___QVersionNumber_seg_newListBuffer3(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QVersionNumber___QVersionNumber_seg_fillList3(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+int QVersionNumber___QVersionNumber_seg_atList2(void* ptr, int i)
+{
+	return static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+void QVersionNumber___QVersionNumber_seg_setList2(void* ptr, int i)
+{
+	static_cast<QVector<int>*>(ptr)->append(i);
+}
+
+void* QVersionNumber___QVersionNumber_seg_newList2(void* ptr)
+{
+	return new QVector<int>;
+}
+
+void* QVersionNumber___QVersionNumber_seg_newListBuffer2(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QVersionNumber___QVersionNumber_seg_fillList2(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+int QVersionNumber___segments_atList(void* ptr, int i)
+{
+	return static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+void QVersionNumber___segments_setList(void* ptr, int i)
+{
+	static_cast<QVector<int>*>(ptr)->append(i);
+}
+
+void* QVersionNumber___segments_newList(void* ptr)
+{
+	return new QVector<int>;
+}
+
+void* QVersionNumber___segments_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QVersionNumber___segments_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+void* QWaitCondition_NewQWaitCondition()
+{
+	return new QWaitCondition();
+}
+
+void* QWaitCondition_NewQWaitConditionInArena(void* arena)
+{
+	return new (goArenaAlloc<QWaitCondition>(arena)) QWaitCondition();
+}
+
+char QWaitCondition_Wait(void* ptr, void* lockedMutex, unsigned long time)
+{
+	return static_cast<QWaitCondition*>(ptr)->wait(static_cast<QMutex*>(lockedMutex), time);
+}
+
+char QWaitCondition_Wait2(void* ptr, void* lockedReadWriteLock, unsigned long time)
+{
+	return static_cast<QWaitCondition*>(ptr)->wait(static_cast<QReadWriteLock*>(lockedReadWriteLock), time);
+}
+
+void QWaitCondition_Notify_all(void* ptr)
+{
+	static_cast<QWaitCondition*>(ptr)->notify_all();
+}
+
+void QWaitCondition_Notify_one(void* ptr)
+{
+	static_cast<QWaitCondition*>(ptr)->notify_one();
+}
+
+void QWaitCondition_WakeAll(void* ptr)
+{
+	static_cast<QWaitCondition*>(ptr)->wakeAll();
+}
+
+void QWaitCondition_WakeOne(void* ptr)
+{
+	static_cast<QWaitCondition*>(ptr)->wakeOne();
+}
+
+void QWaitCondition_DestroyQWaitCondition(void* ptr)
+{
+	static_cast<QWaitCondition*>(ptr)->~QWaitCondition();
+}
+
+void* QWriteLocker_NewQWriteLocker(void* lock)
+{
+	return new QWriteLocker(static_cast<QReadWriteLock*>(lock));
+}
+
+void* QWriteLocker_NewQWriteLockerInArena(void* arena, void* lock)
+{
+	return new (goArenaAlloc<QWriteLocker>(arena)) QWriteLocker(static_cast<QReadWriteLock*>(lock));
+}
+
+void QWriteLocker_Relock(void* ptr)
+{
+	static_cast<QWriteLocker*>(ptr)->relock();
+}
+
+void QWriteLocker_Unlock(void* ptr)
+{
+	static_cast<QWriteLocker*>(ptr)->unlock();
+}
+
+void QWriteLocker_DestroyQWriteLocker(void* ptr)
+{
+	static_cast<QWriteLocker*>(ptr)->~QWriteLocker();
+}
+
+void* QWriteLocker_ReadWriteLock(void* ptr)
+{
+	return static_cast<QWriteLocker*>(ptr)->readWriteLock();
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttribute()
+{
+	return new QXmlStreamAttribute();
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttributeInArena(void* arena)
+{
+	return new (goArenaAlloc<QXmlStreamAttribute>(arena)) QXmlStreamAttribute();
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttribute5(void* other)
+{
+	return new QXmlStreamAttribute(*static_cast<QXmlStreamAttribute*>(other));
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttribute5InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QXmlStreamAttribute>(arena)) QXmlStreamAttribute(*static_cast<QXmlStreamAttribute*>(other));
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttribute3(char* namespaceUri, char* name, char* value)
+{
+	return new QXmlStreamAttribute(QString(namespaceUri), QString(name), QString(value));
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttribute3InArena(void* arena, char* namespaceUri, char* name, char* value)
+{
+	return new (goArenaAlloc<QXmlStreamAttribute>(arena)) QXmlStreamAttribute(QString(namespaceUri), QString(name), QString(value));
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttribute2(char* qualifiedName, char* value)
+{
+	return new QXmlStreamAttribute(QString(qualifiedName), QString(value));
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttribute2InArena(void* arena, char* qualifiedName, char* value)
+{
+	return new (goArenaAlloc<QXmlStreamAttribute>(arena)) QXmlStreamAttribute(QString(qualifiedName), QString(value));
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttribute4(void* other)
+{
+	return new QXmlStreamAttribute(*static_cast<QXmlStreamAttribute*>(other));
+}
+
+void* QXmlStreamAttribute_NewQXmlStreamAttribute4InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QXmlStreamAttribute>(arena)) QXmlStreamAttribute(*static_cast<QXmlStreamAttribute*>(other));
+}
+
+void QXmlStreamAttribute_DestroyQXmlStreamAttribute(void* ptr)
+{
+	static_cast<QXmlStreamAttribute*>(ptr)->~QXmlStreamAttribute();
+}
+
+void* QXmlStreamAttribute_Name(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamAttribute*>(ptr)->name());
+}
+
+void* QXmlStreamAttribute_NamespaceUri(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamAttribute*>(ptr)->namespaceUri());
+}
+
+void* QXmlStreamAttribute_Prefix(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamAttribute*>(ptr)->prefix());
+}
+
+void* QXmlStreamAttribute_QualifiedName(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamAttribute*>(ptr)->qualifiedName());
+}
+
+void* QXmlStreamAttribute_Value(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamAttribute*>(ptr)->value());
+}
+
+char QXmlStreamAttribute_IsDefault(void* ptr)
+{
+	return static_cast<QXmlStreamAttribute*>(ptr)->isDefault();
+}
+
+void* QXmlStreamAttributes_NewQXmlStreamAttributes()
+{
+	return new QXmlStreamAttributes();
+}
+
+void* QXmlStreamAttributes_NewQXmlStreamAttributesInArena(void* arena)
+{
+	return new (goArenaAlloc<QXmlStreamAttributes>(arena)) QXmlStreamAttributes();
+}
+
+void QXmlStreamAttributes_Append(void* ptr, char* namespaceUri, char* name, char* value)
+{
+	static_cast<QXmlStreamAttributes*>(ptr)->append(QString(namespaceUri), QString(name), QString(value));
+}
+
+void QXmlStreamAttributes_Append2(void* ptr, char* qualifiedName, char* value)
+{
+	static_cast<QXmlStreamAttributes*>(ptr)->append(QString(qualifiedName), QString(value));
+}
+
+void* QXmlStreamAttributes_Value3(void* ptr, void* namespaceUri, void* name)
+{
+	return new QStringRef(static_cast<QXmlStreamAttributes*>(ptr)->value(*static_cast<QLatin1String*>(namespaceUri), *static_cast<QLatin1String*>(name)));
+}
+
+void* QXmlStreamAttributes_Value5(void* ptr, void* qualifiedName)
+{
+	return new QStringRef(static_cast<QXmlStreamAttributes*>(ptr)->value(*static_cast<QLatin1String*>(qualifiedName)));
+}
+
+void* QXmlStreamAttributes_Value2(void* ptr, char* namespaceUri, void* name)
+{
+	return new QStringRef(static_cast<QXmlStreamAttributes*>(ptr)->value(QString(namespaceUri), *static_cast<QLatin1String*>(name)));
+}
+
+void* QXmlStreamAttributes_Value(void* ptr, char* namespaceUri, char* name)
+{
+	return new QStringRef(static_cast<QXmlStreamAttributes*>(ptr)->value(QString(namespaceUri), QString(name)));
+}
+
+void* QXmlStreamAttributes_Value4(void* ptr, char* qualifiedName)
+{
+	return new QStringRef(static_cast<QXmlStreamAttributes*>(ptr)->value(QString(qualifiedName)));
+}
+
+char QXmlStreamAttributes_HasAttribute2(void* ptr, void* qualifiedName)
+{
+	return static_cast<QXmlStreamAttributes*>(ptr)->hasAttribute(*static_cast<QLatin1String*>(qualifiedName));
+}
+
+char QXmlStreamAttributes_HasAttribute3(void* ptr, char* namespaceUri, char* name)
+{
+	return static_cast<QXmlStreamAttributes*>(ptr)->hasAttribute(QString(namespaceUri), QString(name));
+}
+
+char QXmlStreamAttributes_HasAttribute(void* ptr, char* qualifiedName)
+{
+	return static_cast<QXmlStreamAttributes*>(ptr)->hasAttribute(QString(qualifiedName));
+}
+
+void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration()
+{
+	return new QXmlStreamEntityDeclaration();
+}
+
+void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclarationInArena(void* arena)
+{
+	return new (goArenaAlloc<QXmlStreamEntityDeclaration>(arena)) QXmlStreamEntityDeclaration();
+}
+
+void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration3(void* other)
+{
+	return new QXmlStreamEntityDeclaration(*static_cast<QXmlStreamEntityDeclaration*>(other));
+}
+
+void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration3InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QXmlStreamEntityDeclaration>(arena)) QXmlStreamEntityDeclaration(*static_cast<QXmlStreamEntityDeclaration*>(other));
+}
+
+void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration2(void* other)
+{
+	return new QXmlStreamEntityDeclaration(*static_cast<QXmlStreamEntityDeclaration*>(other));
+}
+
+void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration2InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QXmlStreamEntityDeclaration>(arena)) QXmlStreamEntityDeclaration(*static_cast<QXmlStreamEntityDeclaration*>(other));
+}
+
+void QXmlStreamEntityDeclaration_DestroyQXmlStreamEntityDeclaration(void* ptr)
+{
+	static_cast<QXmlStreamEntityDeclaration*>(ptr)->~QXmlStreamEntityDeclaration();
+}
+
+void* QXmlStreamEntityDeclaration_Name(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamEntityDeclaration*>(ptr)->name());
+}
+
+void* QXmlStreamEntityDeclaration_NotationName(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamEntityDeclaration*>(ptr)->notationName());
+}
+
+void* QXmlStreamEntityDeclaration_PublicId(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamEntityDeclaration*>(ptr)->publicId());
+}
+
+void* QXmlStreamEntityDeclaration_SystemId(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamEntityDeclaration*>(ptr)->systemId());
+}
+
+void* QXmlStreamEntityDeclaration_Value(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamEntityDeclaration*>(ptr)->value());
+}
+
+class MyQXmlStreamEntityResolver: public QXmlStreamEntityResolver
+{
+public:
+	QString resolveUndeclaredEntity(const QString & name) { QByteArray t6ae999 = name.toUtf8(); QtCore_PackedString namePacked = { const_cast<char*>(t6ae999.prepend("WHITESPACE").constData()+10), t6ae999.size()-10 };return QString(callbackQXmlStreamEntityResolver_ResolveUndeclaredEntity(this, namePacked)); };
+	 ~MyQXmlStreamEntityResolver() { callbackQXmlStreamEntityResolver_DestroyQXmlStreamEntityResolver(this); };
+};
+
+struct QtCore_PackedString QXmlStreamEntityResolver_ResolveUndeclaredEntity(void* ptr, char* name)
+{
+	return ({ QByteArray tda2d63 = static_cast<QXmlStreamEntityResolver*>(ptr)->resolveUndeclaredEntity(QString(name)).toUtf8(); QtCore_PackedString { const_cast<char*>(tda2d63.prepend("WHITESPACE").constData()+10), tda2d63.size()-10 }; });
+}
+
+struct QtCore_PackedString QXmlStreamEntityResolver_ResolveUndeclaredEntityDefault(void* ptr, char* name)
+{
+		return ({ QByteArray tdf0a3f = static_cast<QXmlStreamEntityResolver*>(ptr)->QXmlStreamEntityResolver::resolveUndeclaredEntity(QString(name)).toUtf8(); QtCore_PackedString { const_cast<char*>(tdf0a3f.prepend("WHITESPACE").constData()+10), tdf0a3f.size()-10 }; });
+}
+
+void QXmlStreamEntityResolver_DestroyQXmlStreamEntityResolver(void* ptr)
+{
+	static_cast<QXmlStreamEntityResolver*>(ptr)->~QXmlStreamEntityResolver();
+}
+
+void QXmlStreamEntityResolver_DestroyQXmlStreamEntityResolverDefault(void* ptr)
+{
+
+}
+
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration()
+{
+	return new QXmlStreamNamespaceDeclaration();
+}
+
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclarationInArena(void* arena)
+{
+	return new (goArenaAlloc<QXmlStreamNamespaceDeclaration>(arena)) QXmlStreamNamespaceDeclaration();
+}
+
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration3(void* other)
+{
+	return new QXmlStreamNamespaceDeclaration(*static_cast<QXmlStreamNamespaceDeclaration*>(other));
+}
+
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration3InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QXmlStreamNamespaceDeclaration>(arena)) QXmlStreamNamespaceDeclaration(*static_cast<QXmlStreamNamespaceDeclaration*>(other));
+}
+
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration4(char* prefix, char* namespaceUri)
+{
+	return new QXmlStreamNamespaceDeclaration(QString(prefix), QString(namespaceUri));
+}
+
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration4InArena(void* arena, char* prefix, char* namespaceUri)
+{
+	return new (goArenaAlloc<QXmlStreamNamespaceDeclaration>(arena)) QXmlStreamNamespaceDeclaration(QString(prefix), QString(namespaceUri));
+}
+
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration2(void* other)
+{
+	return new QXmlStreamNamespaceDeclaration(*static_cast<QXmlStreamNamespaceDeclaration*>(other));
+}
+
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration2InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QXmlStreamNamespaceDeclaration>(arena)) QXmlStreamNamespaceDeclaration(*static_cast<QXmlStreamNamespaceDeclaration*>(other));
+}
+
+void QXmlStreamNamespaceDeclaration_DestroyQXmlStreamNamespaceDeclaration(void* ptr)
+{
+	static_cast<QXmlStreamNamespaceDeclaration*>(ptr)->~QXmlStreamNamespaceDeclaration();
+}
+
+void* QXmlStreamNamespaceDeclaration_NamespaceUri(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamNamespaceDeclaration*>(ptr)->namespaceUri());
+}
+
+void* QXmlStreamNamespaceDeclaration_Prefix(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamNamespaceDeclaration*>(ptr)->prefix());
+}
+
+void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration()
+{
+	return new QXmlStreamNotationDeclaration();
+}
+
+void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclarationInArena(void* arena)
+{
+	return new (goArenaAlloc<QXmlStreamNotationDeclaration>(arena)) QXmlStreamNotationDeclaration();
+}
+
+void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration3(void* other)
+{
+	return new QXmlStreamNotationDeclaration(*static_cast<QXmlStreamNotationDeclaration*>(other));
+}
+
+void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration3InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QXmlStreamNotationDeclaration>(arena)) QXmlStreamNotationDeclaration(*static_cast<QXmlStreamNotationDeclaration*>(other));
+}
+
+void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration2(void* other)
+{
+	return new QXmlStreamNotationDeclaration(*static_cast<QXmlStreamNotationDeclaration*>(other));
+}
+
+void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration2InArena(void* arena, void* other)
+{
+	return new (goArenaAlloc<QXmlStreamNotationDeclaration>(arena)) QXmlStreamNotationDeclaration(*static_cast<QXmlStreamNotationDeclaration*>(other));
+}
+
+void QXmlStreamNotationDeclaration_DestroyQXmlStreamNotationDeclaration(void* ptr)
+{
+	static_cast<QXmlStreamNotationDeclaration*>(ptr)->~QXmlStreamNotationDeclaration();
+}
+
+void* QXmlStreamNotationDeclaration_Name(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamNotationDeclaration*>(ptr)->name());
+}
+
+void* QXmlStreamNotationDeclaration_PublicId(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamNotationDeclaration*>(ptr)->publicId());
+}
+
+void* QXmlStreamNotationDeclaration_SystemId(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamNotationDeclaration*>(ptr)->systemId());
+}
+
+struct QtCore_PackedString QXmlStreamReader_ReadElementText(void* ptr, long long behaviour)
+{
+	return ({ QByteArray tbe9d44 = static_cast<QXmlStreamReader*>(ptr)->readElementText(static_cast<QXmlStreamReader::ReadElementTextBehaviour>(behaviour)).toUtf8(); QtCore_PackedString { const_cast<char*>(tbe9d44.prepend("WHITESPACE").constData()+10), tbe9d44.size()-10 }; });
+}
+
+void* QXmlStreamReader_NewQXmlStreamReader()
+{
+	return new QXmlStreamReader();
+}
+
+void* QXmlStreamReader_NewQXmlStreamReaderInArena(void* arena)
+{
+	return new (goArenaAlloc<QXmlStreamReader>(arena)) QXmlStreamReader();
+}
+
+void* QXmlStreamReader_NewQXmlStreamReader2(void* device)
+{
+	return new QXmlStreamReader(static_cast<QIODevice*>(device));
+}
+
+void* QXmlStreamReader_NewQXmlStreamReader2InArena(void* arena, void* device)
+{
+	return new (goArenaAlloc<QXmlStreamReader>(arena)) QXmlStreamReader(static_cast<QIODevice*>(device));
+}
+
+void* QXmlStreamReader_NewQXmlStreamReader3(void* data)
+{
+	return new QXmlStreamReader(*static_cast<QByteArray*>(data));
+}
+
+void* QXmlStreamReader_NewQXmlStreamReader3InArena(void* arena, void* data)
+{
+	return new (goArenaAlloc<QXmlStreamReader>(arena)) QXmlStreamReader(*static_cast<QByteArray*>(data));
+}
+
+void* QXmlStreamReader_NewQXmlStreamReader4(char* data)
+{
+	return new QXmlStreamReader(QString(data));
+}
+
+void* QXmlStreamReader_NewQXmlStreamReader4InArena(void* arena, char* data)
+{
+	return new (goArenaAlloc<QXmlStreamReader>(arena)) QXmlStreamReader(QString(data));
+}
+
+void* QXmlStreamReader_NewQXmlStreamReader5(char* data)
+{
+	return new QXmlStreamReader(const_cast<const char*>(data));
+}
+
+void* QXmlStreamReader_NewQXmlStreamReader5InArena(void* arena, char* data)
+{
+	return new (goArenaAlloc<QXmlStreamReader>(arena)) QXmlStreamReader(const_cast<const char*>(data));
+}
+
+long long QXmlStreamReader_ReadNext(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->readNext();
+}
+
+char QXmlStreamReader_ReadNextStartElement(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->readNextStartElement();
+}
+
+void QXmlStreamReader_AddData(void* ptr, void* data)
+{
+	static_cast<QXmlStreamReader*>(ptr)->addData(*static_cast<QByteArray*>(data));
+}
+
+void QXmlStreamReader_AddData2(void* ptr, char* data)
+{
+	static_cast<QXmlStreamReader*>(ptr)->addData(QString(data));
+}
+
+void QXmlStreamReader_AddData3(void* ptr, char* data)
+{
+	static_cast<QXmlStreamReader*>(ptr)->addData(const_cast<const char*>(data));
+}
+
+void QXmlStreamReader_AddExtraNamespaceDeclaration(void* ptr, void* extraNamespaceDeclaration)
+{
+	static_cast<QXmlStreamReader*>(ptr)->addExtraNamespaceDeclaration(*static_cast<QXmlStreamNamespaceDeclaration*>(extraNamespaceDeclaration));
+}
+
+void QXmlStreamReader_Clear(void* ptr)
+{
+	static_cast<QXmlStreamReader*>(ptr)->clear();
+}
+
+void QXmlStreamReader_RaiseError(void* ptr, char* message)
+{
+	static_cast<QXmlStreamReader*>(ptr)->raiseError(QString(message));
+}
+
+void QXmlStreamReader_SetDevice(void* ptr, void* device)
+{
+	static_cast<QXmlStreamReader*>(ptr)->setDevice(static_cast<QIODevice*>(device));
+}
+
+void QXmlStreamReader_SetEntityResolver(void* ptr, void* resolver)
+{
+	static_cast<QXmlStreamReader*>(ptr)->setEntityResolver(static_cast<QXmlStreamEntityResolver*>(resolver));
+}
+
+void QXmlStreamReader_SetNamespaceProcessing(void* ptr, char vbo)
+{
+	static_cast<QXmlStreamReader*>(ptr)->setNamespaceProcessing(vbo != 0);
+}
+
+void QXmlStreamReader_SkipCurrentElement(void* ptr)
+{
+	static_cast<QXmlStreamReader*>(ptr)->skipCurrentElement();
+}
+
+void QXmlStreamReader_DestroyQXmlStreamReader(void* ptr)
+{
+	static_cast<QXmlStreamReader*>(ptr)->~QXmlStreamReader();
+}
+
+long long QXmlStreamReader_Error(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->error();
+}
+
+void* QXmlStreamReader_Device(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->device();
+}
+
+struct QtCore_PackedString QXmlStreamReader_ErrorString(void* ptr)
+{
+	return ({ QByteArray td9cec5 = static_cast<QXmlStreamReader*>(ptr)->errorString().toUtf8(); QtCore_PackedString { const_cast<char*>(td9cec5.prepend("WHITESPACE").constData()+10), td9cec5.size()-10 }; });
+}
+
+struct QtCore_PackedString QXmlStreamReader_TokenString(void* ptr)
+{
+	return ({ QByteArray t5e8d05 = static_cast<QXmlStreamReader*>(ptr)->tokenString().toUtf8(); QtCore_PackedString { const_cast<char*>(t5e8d05.prepend("WHITESPACE").constData()+10), t5e8d05.size()-10 }; });
+}
+
+void* QXmlStreamReader_DocumentEncoding(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->documentEncoding());
+}
+
+void* QXmlStreamReader_DocumentVersion(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->documentVersion());
+}
+
+void* QXmlStreamReader_DtdName(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->dtdName());
+}
+
+void* QXmlStreamReader_DtdPublicId(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->dtdPublicId());
+}
+
+void* QXmlStreamReader_DtdSystemId(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->dtdSystemId());
+}
+
+void* QXmlStreamReader_Name(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->name());
+}
+
+void* QXmlStreamReader_NamespaceUri(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->namespaceUri());
+}
+
+void* QXmlStreamReader_Prefix(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->prefix());
+}
+
+void* QXmlStreamReader_ProcessingInstructionData(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->processingInstructionData());
+}
+
+void* QXmlStreamReader_ProcessingInstructionTarget(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->processingInstructionTarget());
+}
+
+void* QXmlStreamReader_QualifiedName(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->qualifiedName());
+}
+
+void* QXmlStreamReader_Text(void* ptr)
+{
+	return new QStringRef(static_cast<QXmlStreamReader*>(ptr)->text());
+}
+
+void* QXmlStreamReader_EntityResolver(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->entityResolver();
+}
+
+long long QXmlStreamReader_TokenType(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->tokenType();
+}
+
+char QXmlStreamReader_AtEnd(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->atEnd();
+}
+
+char QXmlStreamReader_HasError(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->hasError();
+}
+
+char QXmlStreamReader_IsCDATA(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isCDATA();
+}
+
+char QXmlStreamReader_IsCharacters(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isCharacters();
+}
+
+char QXmlStreamReader_IsComment(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isComment();
+}
+
+char QXmlStreamReader_IsDTD(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isDTD();
+}
+
+char QXmlStreamReader_IsEndDocument(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isEndDocument();
+}
+
+char QXmlStreamReader_IsEndElement(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isEndElement();
+}
+
+char QXmlStreamReader_IsEntityReference(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isEntityReference();
+}
+
+char QXmlStreamReader_IsProcessingInstruction(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isProcessingInstruction();
+}
+
+char QXmlStreamReader_IsStandaloneDocument(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isStandaloneDocument();
+}
+
+char QXmlStreamReader_IsStartDocument(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isStartDocument();
+}
+
+char QXmlStreamReader_IsStartElement(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isStartElement();
+}
+
+char QXmlStreamReader_IsWhitespace(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->isWhitespace();
+}
+
+char QXmlStreamReader_NamespaceProcessing(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->namespaceProcessing();
+}
+
+long long QXmlStreamReader_CharacterOffset(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->characterOffset();
+}
+
+long long QXmlStreamReader_ColumnNumber(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->columnNumber();
+}
+
+long long QXmlStreamReader_LineNumber(void* ptr)
+{
+	return static_cast<QXmlStreamReader*>(ptr)->lineNumber();
+}
+
+void* QXmlStreamWriter_NewQXmlStreamWriter()
+{
+	return new QXmlStreamWriter();
+}
+
+void* QXmlStreamWriter_NewQXmlStreamWriterInArena(void* arena)
+{
+	return new (goArenaAlloc<QXmlStreamWriter>(arena)) QXmlStreamWriter();
+}
+
+void* QXmlStreamWriter_NewQXmlStreamWriter3(void* array)
+{
+	return new QXmlStreamWriter(static_cast<QByteArray*>(array));
+}
+
+void* QXmlStreamWriter_NewQXmlStreamWriter3InArena(void* arena, void* array)
+{
+	return new (goArenaAlloc<QXmlStreamWriter>(arena)) QXmlStreamWriter(static_cast<QByteArray*>(array));
+}
+
+void* QXmlStreamWriter_NewQXmlStreamWriter2(void* device)
+{
+	return new QXmlStreamWriter(static_cast<QIODevice*>(device));
+}
+
+void* QXmlStreamWriter_NewQXmlStreamWriter2InArena(void* arena, void* device)
+{
+	return new (goArenaAlloc<QXmlStreamWriter>(arena)) QXmlStreamWriter(static_cast<QIODevice*>(device));
+}
+
+void* QXmlStreamWriter_NewQXmlStreamWriter4(char* stri)
+{
+	return new QXmlStreamWriter(new QString(stri));
+}
+
+void* QXmlStreamWriter_NewQXmlStreamWriter4InArena(void* arena, char* stri)
+{
+	return new (goArenaAlloc<QXmlStreamWriter>(arena)) QXmlStreamWriter(new QString(stri));
+}
+
+void QXmlStreamWriter_SetAutoFormatting(void* ptr, char enable)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->setAutoFormatting(enable != 0);
+}
+
+void QXmlStreamWriter_SetAutoFormattingIndent(void* ptr, int spacesOrTabs)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->setAutoFormattingIndent(spacesOrTabs);
+}
+
+void QXmlStreamWriter_SetCodec(void* ptr, void* codec)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->setCodec(static_cast<QTextCodec*>(codec));
+}
+
+void QXmlStreamWriter_SetCodec2(void* ptr, char* codecName)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->setCodec(const_cast<const char*>(codecName));
+}
+
+void QXmlStreamWriter_SetDevice(void* ptr, void* device)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->setDevice(static_cast<QIODevice*>(device));
+}
+
+void QXmlStreamWriter_WriteAttribute(void* ptr, char* namespaceUri, char* name, char* value)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeAttribute(QString(namespaceUri), QString(name), QString(value));
+}
+
+void QXmlStreamWriter_WriteAttribute2(void* ptr, char* qualifiedName, char* value)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeAttribute(QString(qualifiedName), QString(value));
+}
+
+void QXmlStreamWriter_WriteAttribute3(void* ptr, void* attribute)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeAttribute(*static_cast<QXmlStreamAttribute*>(attribute));
+}
+
+void QXmlStreamWriter_WriteAttributes(void* ptr, void* attributes)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeAttributes(*static_cast<QXmlStreamAttributes*>(attributes));
+}
+
+void QXmlStreamWriter_WriteCDATA(void* ptr, char* text)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeCDATA(QString(text));
+}
+
+void QXmlStreamWriter_WriteCharacters(void* ptr, char* text)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeCharacters(QString(text));
+}
+
+void QXmlStreamWriter_WriteComment(void* ptr, char* text)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeComment(QString(text));
+}
+
+void QXmlStreamWriter_WriteCurrentToken(void* ptr, void* reader)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeCurrentToken(*static_cast<QXmlStreamReader*>(reader));
+}
+
+void QXmlStreamWriter_WriteDTD(void* ptr, char* dtd)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeDTD(QString(dtd));
+}
+
+void QXmlStreamWriter_WriteDefaultNamespace(void* ptr, char* namespaceUri)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeDefaultNamespace(QString(namespaceUri));
+}
+
+void QXmlStreamWriter_WriteEmptyElement(void* ptr, char* namespaceUri, char* name)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeEmptyElement(QString(namespaceUri), QString(name));
+}
+
+void QXmlStreamWriter_WriteEmptyElement2(void* ptr, char* qualifiedName)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeEmptyElement(QString(qualifiedName));
+}
+
+void QXmlStreamWriter_WriteEndDocument(void* ptr)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeEndDocument();
+}
+
+void QXmlStreamWriter_WriteEndElement(void* ptr)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeEndElement();
+}
+
+void QXmlStreamWriter_WriteEntityReference(void* ptr, char* name)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeEntityReference(QString(name));
+}
+
+void QXmlStreamWriter_WriteNamespace(void* ptr, char* namespaceUri, char* prefix)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeNamespace(QString(namespaceUri), QString(prefix));
+}
+
+void QXmlStreamWriter_WriteProcessingInstruction(void* ptr, char* target, char* data)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeProcessingInstruction(QString(target), QString(data));
+}
+
+void QXmlStreamWriter_WriteStartDocument2(void* ptr)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeStartDocument();
+}
+
+void QXmlStreamWriter_WriteStartDocument(void* ptr, char* version)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeStartDocument(QString(version));
+}
+
+void QXmlStreamWriter_WriteStartDocument3(void* ptr, char* version, char standalone)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeStartDocument(QString(version), standalone != 0);
+}
+
+void QXmlStreamWriter_WriteStartElement(void* ptr, char* namespaceUri, char* name)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeStartElement(QString(namespaceUri), QString(name));
+}
+
+void QXmlStreamWriter_WriteStartElement2(void* ptr, char* qualifiedName)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeStartElement(QString(qualifiedName));
+}
+
+void QXmlStreamWriter_WriteTextElement(void* ptr, char* namespaceUri, char* name, char* text)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeTextElement(QString(namespaceUri), QString(name), QString(text));
+}
+
+void QXmlStreamWriter_WriteTextElement2(void* ptr, char* qualifiedName, char* text)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->writeTextElement(QString(qualifiedName), QString(text));
+}
+
+void QXmlStreamWriter_DestroyQXmlStreamWriter(void* ptr)
+{
+	static_cast<QXmlStreamWriter*>(ptr)->~QXmlStreamWriter();
+}
+
+void* QXmlStreamWriter_Device(void* ptr)
+{
+	return static_cast<QXmlStreamWriter*>(ptr)->device();
+}
+
+void* QXmlStreamWriter_Codec(void* ptr)
+{
+	return static_cast<QXmlStreamWriter*>(ptr)->codec();
+}
+
+char QXmlStreamWriter_AutoFormatting(void* ptr)
+{
+	return static_cast<QXmlStreamWriter*>(ptr)->autoFormatting();
+}
+
+char QXmlStreamWriter_HasError(void* ptr)
+{
+	return static_cast<QXmlStreamWriter*>(ptr)->hasError();
+}
+
+int QXmlStreamWriter_AutoFormattingIndent(void* ptr)
+{
+	return static_cast<QXmlStreamWriter*>(ptr)->autoFormattingIndent();
+}
+
+int Qt_LocaleDate_Type()
+{
+	return Qt::LocaleDate;
+}
+
+int Qt_SystemLocaleShortDate_Type()
+{
+	return Qt::SystemLocaleShortDate;
+}
+
+int Qt_SystemLocaleLongDate_Type()
+{
+	return Qt::SystemLocaleLongDate;
+}
+
+int Qt_DefaultLocaleShortDate_Type()
+{
+	return Qt::DefaultLocaleShortDate;
+}
+
+int Qt_DefaultLocaleLongDate_Type()
+{
+	return Qt::DefaultLocaleLongDate;
+}
+
+int Qt_RFC2822Date_Type()
+{
+	return Qt::RFC2822Date;
+}
+
+int Qt_ISODateWithMs_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return Qt::ISODateWithMs;
+	#else
+		return 0;
+	#endif
+}
+
+int Qt_LastGestureType_Type()
+{
+	return Qt::LastGestureType;
+}
+
+struct QtCore_PackedString Qt_Qt_ConvertFromPlainText(char* plain, long long mode)
+{
+	return ({ QByteArray t446f97 = Qt::convertFromPlainText(QString(plain), static_cast<Qt::WhiteSpaceMode>(mode)).toUtf8(); QtCore_PackedString { const_cast<char*>(t446f97.prepend("WHITESPACE").constData()+10), t446f97.size()-10 }; });
+}
+
+char Qt_Qt_MightBeRichText(char* text)
+{
+	return Qt::mightBeRichText(QString(text));
+}
+
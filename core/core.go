@@ -8,7 +8,6 @@ package core
 //#include "core.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"runtime"
 	"strings"
@@ -21,6 +20,43 @@ func cGoUnpackString(s C.struct_QtCore_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtCore_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtCore_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QAbstractAnimation struct {
 	QObject
@@ -97,7 +133,7 @@ func (ptr *QAbstractAnimation) SetDirection(direction QAbstractAnimation__Direct
 
 //export callbackQAbstractAnimation_Finished
 func callbackQAbstractAnimation_Finished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -106,14 +142,14 @@ func callbackQAbstractAnimation_Finished(ptr unsafe.Pointer) {
 func (ptr *QAbstractAnimation) ConnectFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
@@ -125,7 +161,7 @@ func (ptr *QAbstractAnimation) Finished() {
 
 //export callbackQAbstractAnimation_SetCurrentTime
 func callbackQAbstractAnimation_SetCurrentTime(ptr unsafe.Pointer, msecs C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCurrentTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCurrentTime"); signal != nil {
 		signal.(func(int))(int(int32(msecs)))
 	} else {
 		NewQAbstractAnimationFromPointer(ptr).SetCurrentTimeDefault(int(int32(msecs)))
@@ -135,14 +171,14 @@ func callbackQAbstractAnimation_SetCurrentTime(ptr unsafe.Pointer, msecs C.int)
 func (ptr *QAbstractAnimation) ConnectSetCurrentTime(f func(msecs int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentTime", f)
+		qt.ConnectSignal(ptr.Pointer(), "setCurrentTime", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectSetCurrentTime() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentTime")
+		qt.DisconnectSignal(ptr.Pointer(), "setCurrentTime")
 	}
 }
 
@@ -166,7 +202,7 @@ func (ptr *QAbstractAnimation) SetLoopCount(loopCount int) {
 
 func NewQAbstractAnimation(parent QObject_ITF) *QAbstractAnimation {
 	var tmpValue = NewQAbstractAnimationFromPointer(C.QAbstractAnimation_NewQAbstractAnimation(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -174,7 +210,7 @@ func NewQAbstractAnimation(parent QObject_ITF) *QAbstractAnimation {
 
 //export callbackQAbstractAnimation_CurrentLoopChanged
 func callbackQAbstractAnimation_CurrentLoopChanged(ptr unsafe.Pointer, currentLoop C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentLoopChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentLoopChanged"); signal != nil {
 		signal.(func(int))(int(int32(currentLoop)))
 	}
 
@@ -183,14 +219,14 @@ func callbackQAbstractAnimation_CurrentLoopChanged(ptr unsafe.Pointer, currentLo
 func (ptr *QAbstractAnimation) ConnectCurrentLoopChanged(f func(currentLoop int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_ConnectCurrentLoopChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentLoopChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentLoopChanged", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectCurrentLoopChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_DisconnectCurrentLoopChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentLoopChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "currentLoopChanged")
 	}
 }
 
@@ -202,7 +238,7 @@ func (ptr *QAbstractAnimation) CurrentLoopChanged(currentLoop int) {
 
 //export callbackQAbstractAnimation_DirectionChanged
 func callbackQAbstractAnimation_DirectionChanged(ptr unsafe.Pointer, newDirection C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "directionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "directionChanged"); signal != nil {
 		signal.(func(QAbstractAnimation__Direction))(QAbstractAnimation__Direction(newDirection))
 	}
 
@@ -211,14 +247,14 @@ func callbackQAbstractAnimation_DirectionChanged(ptr unsafe.Pointer, newDirectio
 func (ptr *QAbstractAnimation) ConnectDirectionChanged(f func(newDirection QAbstractAnimation__Direction)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_ConnectDirectionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "directionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "directionChanged", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectDirectionChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_DisconnectDirectionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "directionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "directionChanged")
 	}
 }
 
@@ -230,7 +266,7 @@ func (ptr *QAbstractAnimation) DirectionChanged(newDirection QAbstractAnimation_
 
 //export callbackQAbstractAnimation_Pause
 func callbackQAbstractAnimation_Pause(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pause"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pause"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractAnimationFromPointer(ptr).PauseDefault()
@@ -240,14 +276,14 @@ func callbackQAbstractAnimation_Pause(ptr unsafe.Pointer) {
 func (ptr *QAbstractAnimation) ConnectPause(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pause", f)
+		qt.ConnectSignal(ptr.Pointer(), "pause", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectPause() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pause")
+		qt.DisconnectSignal(ptr.Pointer(), "pause")
 	}
 }
 
@@ -265,7 +301,7 @@ func (ptr *QAbstractAnimation) PauseDefault() {
 
 //export callbackQAbstractAnimation_Resume
 func callbackQAbstractAnimation_Resume(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resume"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resume"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractAnimationFromPointer(ptr).ResumeDefault()
@@ -275,14 +311,14 @@ func callbackQAbstractAnimation_Resume(ptr unsafe.Pointer) {
 func (ptr *QAbstractAnimation) ConnectResume(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resume", f)
+		qt.ConnectSignal(ptr.Pointer(), "resume", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectResume() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resume")
+		qt.DisconnectSignal(ptr.Pointer(), "resume")
 	}
 }
 
@@ -300,7 +336,7 @@ func (ptr *QAbstractAnimation) ResumeDefault() {
 
 //export callbackQAbstractAnimation_SetPaused
 func callbackQAbstractAnimation_SetPaused(ptr unsafe.Pointer, paused C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPaused"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPaused"); signal != nil {
 		signal.(func(bool))(int8(paused) != 0)
 	} else {
 		NewQAbstractAnimationFromPointer(ptr).SetPausedDefault(int8(paused) != 0)
@@ -310,14 +346,14 @@ func callbackQAbstractAnimation_SetPaused(ptr unsafe.Pointer, paused C.char) {
 func (ptr *QAbstractAnimation) ConnectSetPaused(f func(paused bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPaused", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPaused", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectSetPaused() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPaused")
+		qt.DisconnectSignal(ptr.Pointer(), "setPaused")
 	}
 }
 
@@ -335,7 +371,7 @@ func (ptr *QAbstractAnimation) SetPausedDefault(paused bool) {
 
 //export callbackQAbstractAnimation_Start
 func callbackQAbstractAnimation_Start(ptr unsafe.Pointer, policy C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		signal.(func(QAbstractAnimation__DeletionPolicy))(QAbstractAnimation__DeletionPolicy(policy))
 	} else {
 		NewQAbstractAnimationFromPointer(ptr).StartDefault(QAbstractAnimation__DeletionPolicy(policy))
@@ -345,14 +381,14 @@ func callbackQAbstractAnimation_Start(ptr unsafe.Pointer, policy C.longlong) {
 func (ptr *QAbstractAnimation) ConnectStart(f func(policy QAbstractAnimation__DeletionPolicy)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -370,7 +406,7 @@ func (ptr *QAbstractAnimation) StartDefault(policy QAbstractAnimation__DeletionP
 
 //export callbackQAbstractAnimation_StateChanged
 func callbackQAbstractAnimation_StateChanged(ptr unsafe.Pointer, newState C.longlong, oldState C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stateChanged"); signal != nil {
 		signal.(func(QAbstractAnimation__State, QAbstractAnimation__State))(QAbstractAnimation__State(newState), QAbstractAnimation__State(oldState))
 	}
 
@@ -379,14 +415,14 @@ func callbackQAbstractAnimation_StateChanged(ptr unsafe.Pointer, newState C.long
 func (ptr *QAbstractAnimation) ConnectStateChanged(f func(newState QAbstractAnimation__State, oldState QAbstractAnimation__State)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_ConnectStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "stateChanged", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_DisconnectStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "stateChanged")
 	}
 }
 
@@ -398,7 +434,7 @@ func (ptr *QAbstractAnimation) StateChanged(newState QAbstractAnimation__State,
 
 //export callbackQAbstractAnimation_Stop
 func callbackQAbstractAnimation_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractAnimationFromPointer(ptr).StopDefault()
@@ -408,14 +444,14 @@ func callbackQAbstractAnimation_Stop(ptr unsafe.Pointer) {
 func (ptr *QAbstractAnimation) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -433,7 +469,7 @@ func (ptr *QAbstractAnimation) StopDefault() {
 
 //export callbackQAbstractAnimation_UpdateCurrentTime
 func callbackQAbstractAnimation_UpdateCurrentTime(ptr unsafe.Pointer, currentTime C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateCurrentTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateCurrentTime"); signal != nil {
 		signal.(func(int))(int(int32(currentTime)))
 	}
 
@@ -442,14 +478,14 @@ func callbackQAbstractAnimation_UpdateCurrentTime(ptr unsafe.Pointer, currentTim
 func (ptr *QAbstractAnimation) ConnectUpdateCurrentTime(f func(currentTime int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateCurrentTime", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectUpdateCurrentTime() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime")
+		qt.DisconnectSignal(ptr.Pointer(), "updateCurrentTime")
 	}
 }
 
@@ -461,7 +497,7 @@ func (ptr *QAbstractAnimation) UpdateCurrentTime(currentTime int) {
 
 //export callbackQAbstractAnimation_UpdateDirection
 func callbackQAbstractAnimation_UpdateDirection(ptr unsafe.Pointer, direction C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateDirection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateDirection"); signal != nil {
 		signal.(func(QAbstractAnimation__Direction))(QAbstractAnimation__Direction(direction))
 	} else {
 		NewQAbstractAnimationFromPointer(ptr).UpdateDirectionDefault(QAbstractAnimation__Direction(direction))
@@ -471,14 +507,14 @@ func callbackQAbstractAnimation_UpdateDirection(ptr unsafe.Pointer, direction C.
 func (ptr *QAbstractAnimation) ConnectUpdateDirection(f func(direction QAbstractAnimation__Direction)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateDirection", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateDirection", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectUpdateDirection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateDirection")
+		qt.DisconnectSignal(ptr.Pointer(), "updateDirection")
 	}
 }
 
@@ -496,7 +532,7 @@ func (ptr *QAbstractAnimation) UpdateDirectionDefault(direction QAbstractAnimati
 
 //export callbackQAbstractAnimation_UpdateState
 func callbackQAbstractAnimation_UpdateState(ptr unsafe.Pointer, newState C.longlong, oldState C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateState"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateState"); signal != nil {
 		signal.(func(QAbstractAnimation__State, QAbstractAnimation__State))(QAbstractAnimation__State(newState), QAbstractAnimation__State(oldState))
 	} else {
 		NewQAbstractAnimationFromPointer(ptr).UpdateStateDefault(QAbstractAnimation__State(newState), QAbstractAnimation__State(oldState))
@@ -506,14 +542,14 @@ func callbackQAbstractAnimation_UpdateState(ptr unsafe.Pointer, newState C.longl
 func (ptr *QAbstractAnimation) ConnectUpdateState(f func(newState QAbstractAnimation__State, oldState QAbstractAnimation__State)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateState", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateState", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectUpdateState() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateState")
+		qt.DisconnectSignal(ptr.Pointer(), "updateState")
 	}
 }
 
@@ -531,7 +567,7 @@ func (ptr *QAbstractAnimation) UpdateStateDefault(newState QAbstractAnimation__S
 
 //export callbackQAbstractAnimation_DestroyQAbstractAnimation
 func callbackQAbstractAnimation_DestroyQAbstractAnimation(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractAnimation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractAnimation"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractAnimationFromPointer(ptr).DestroyQAbstractAnimationDefault()
@@ -541,21 +577,21 @@ func callbackQAbstractAnimation_DestroyQAbstractAnimation(ptr unsafe.Pointer) {
 func (ptr *QAbstractAnimation) ConnectDestroyQAbstractAnimation(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractAnimation", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractAnimation", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectDestroyQAbstractAnimation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractAnimation")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractAnimation")
 	}
 }
 
 func (ptr *QAbstractAnimation) DestroyQAbstractAnimation() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_DestroyQAbstractAnimation(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -563,7 +599,7 @@ func (ptr *QAbstractAnimation) DestroyQAbstractAnimation() {
 func (ptr *QAbstractAnimation) DestroyQAbstractAnimationDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractAnimation_DestroyQAbstractAnimationDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -578,7 +614,7 @@ func (ptr *QAbstractAnimation) Direction() QAbstractAnimation__Direction {
 func (ptr *QAbstractAnimation) Group() *QAnimationGroup {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAnimationGroupFromPointer(C.QAbstractAnimation_Group(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -616,7 +652,7 @@ func (ptr *QAbstractAnimation) CurrentTime() int {
 
 //export callbackQAbstractAnimation_Duration
 func callbackQAbstractAnimation_Duration(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "duration"); signal != nil {
+	if signal := qt.GetSignal(ptr, "duration"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -626,14 +662,14 @@ func callbackQAbstractAnimation_Duration(ptr unsafe.Pointer) C.int {
 func (ptr *QAbstractAnimation) ConnectDuration(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "duration", f)
+		qt.ConnectSignal(ptr.Pointer(), "duration", f)
 	}
 }
 
 func (ptr *QAbstractAnimation) DisconnectDuration() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "duration")
+		qt.DisconnectSignal(ptr.Pointer(), "duration")
 	}
 }
 
@@ -698,7 +734,7 @@ func NewQAbstractEventDispatcherFromPointer(ptr unsafe.Pointer) *QAbstractEventD
 }
 func QAbstractEventDispatcher_Instance(thread QThread_ITF) *QAbstractEventDispatcher {
 	var tmpValue = NewQAbstractEventDispatcherFromPointer(C.QAbstractEventDispatcher_QAbstractEventDispatcher_Instance(PointerFromQThread(thread)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -706,7 +742,7 @@ func QAbstractEventDispatcher_Instance(thread QThread_ITF) *QAbstractEventDispat
 
 func (ptr *QAbstractEventDispatcher) Instance(thread QThread_ITF) *QAbstractEventDispatcher {
 	var tmpValue = NewQAbstractEventDispatcherFromPointer(C.QAbstractEventDispatcher_QAbstractEventDispatcher_Instance(PointerFromQThread(thread)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -721,7 +757,7 @@ func (ptr *QAbstractEventDispatcher) FilterNativeEvent(eventType QByteArray_ITF,
 
 //export callbackQAbstractEventDispatcher_ProcessEvents
 func callbackQAbstractEventDispatcher_ProcessEvents(ptr unsafe.Pointer, flags C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "processEvents"); signal != nil {
+	if signal := qt.GetSignal(ptr, "processEvents"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(QEventLoop__ProcessEventsFlag) bool)(QEventLoop__ProcessEventsFlag(flags)))))
 	}
 
@@ -731,14 +767,14 @@ func callbackQAbstractEventDispatcher_ProcessEvents(ptr unsafe.Pointer, flags C.
 func (ptr *QAbstractEventDispatcher) ConnectProcessEvents(f func(flags QEventLoop__ProcessEventsFlag) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "processEvents", f)
+		qt.ConnectSignal(ptr.Pointer(), "processEvents", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectProcessEvents() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "processEvents")
+		qt.DisconnectSignal(ptr.Pointer(), "processEvents")
 	}
 }
 
@@ -751,7 +787,7 @@ func (ptr *QAbstractEventDispatcher) ProcessEvents(flags QEventLoop__ProcessEven
 
 //export callbackQAbstractEventDispatcher_RegisterEventNotifier
 func callbackQAbstractEventDispatcher_RegisterEventNotifier(ptr unsafe.Pointer, notifier unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "registerEventNotifier"); signal != nil {
+	if signal := qt.GetSignal(ptr, "registerEventNotifier"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QWinEventNotifier) bool)(NewQWinEventNotifierFromPointer(notifier)))))
 	}
 
@@ -761,14 +797,14 @@ func callbackQAbstractEventDispatcher_RegisterEventNotifier(ptr unsafe.Pointer,
 func (ptr *QAbstractEventDispatcher) ConnectRegisterEventNotifier(f func(notifier *QWinEventNotifier) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "registerEventNotifier", f)
+		qt.ConnectSignal(ptr.Pointer(), "registerEventNotifier", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectRegisterEventNotifier() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "registerEventNotifier")
+		qt.DisconnectSignal(ptr.Pointer(), "registerEventNotifier")
 	}
 }
 
@@ -781,7 +817,7 @@ func (ptr *QAbstractEventDispatcher) RegisterEventNotifier(notifier QWinEventNot
 
 //export callbackQAbstractEventDispatcher_UnregisterTimer
 func callbackQAbstractEventDispatcher_UnregisterTimer(ptr unsafe.Pointer, timerId C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unregisterTimer"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unregisterTimer"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(timerId))))))
 	}
 
@@ -791,14 +827,14 @@ func callbackQAbstractEventDispatcher_UnregisterTimer(ptr unsafe.Pointer, timerI
 func (ptr *QAbstractEventDispatcher) ConnectUnregisterTimer(f func(timerId int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterTimer", f)
+		qt.ConnectSignal(ptr.Pointer(), "unregisterTimer", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectUnregisterTimer() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterTimer")
+		qt.DisconnectSignal(ptr.Pointer(), "unregisterTimer")
 	}
 }
 
@@ -811,7 +847,7 @@ func (ptr *QAbstractEventDispatcher) UnregisterTimer(timerId int) bool {
 
 //export callbackQAbstractEventDispatcher_UnregisterTimers
 func callbackQAbstractEventDispatcher_UnregisterTimers(ptr unsafe.Pointer, object unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unregisterTimers"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unregisterTimers"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QObject) bool)(NewQObjectFromPointer(object)))))
 	}
 
@@ -821,14 +857,14 @@ func callbackQAbstractEventDispatcher_UnregisterTimers(ptr unsafe.Pointer, objec
 func (ptr *QAbstractEventDispatcher) ConnectUnregisterTimers(f func(object *QObject) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterTimers", f)
+		qt.ConnectSignal(ptr.Pointer(), "unregisterTimers", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectUnregisterTimers() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterTimers")
+		qt.DisconnectSignal(ptr.Pointer(), "unregisterTimers")
 	}
 }
 
@@ -848,7 +884,7 @@ func (ptr *QAbstractEventDispatcher) RegisterTimer(interval int, timerType Qt__T
 
 //export callbackQAbstractEventDispatcher_RemainingTime
 func callbackQAbstractEventDispatcher_RemainingTime(ptr unsafe.Pointer, timerId C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "remainingTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "remainingTime"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(timerId)))))
 	}
 
@@ -858,14 +894,14 @@ func callbackQAbstractEventDispatcher_RemainingTime(ptr unsafe.Pointer, timerId
 func (ptr *QAbstractEventDispatcher) ConnectRemainingTime(f func(timerId int) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "remainingTime", f)
+		qt.ConnectSignal(ptr.Pointer(), "remainingTime", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectRemainingTime() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "remainingTime")
+		qt.DisconnectSignal(ptr.Pointer(), "remainingTime")
 	}
 }
 
@@ -878,7 +914,7 @@ func (ptr *QAbstractEventDispatcher) RemainingTime(timerId int) int {
 
 //export callbackQAbstractEventDispatcher_AboutToBlock
 func callbackQAbstractEventDispatcher_AboutToBlock(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aboutToBlock"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aboutToBlock"); signal != nil {
 		signal.(func())()
 	}
 
@@ -887,14 +923,14 @@ func callbackQAbstractEventDispatcher_AboutToBlock(ptr unsafe.Pointer) {
 func (ptr *QAbstractEventDispatcher) ConnectAboutToBlock(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractEventDispatcher_ConnectAboutToBlock(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "aboutToBlock", f)
+		qt.ConnectSignal(ptr.Pointer(), "aboutToBlock", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectAboutToBlock() {
 	if ptr.Pointer() != nil {
 		C.QAbstractEventDispatcher_DisconnectAboutToBlock(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "aboutToBlock")
+		qt.DisconnectSignal(ptr.Pointer(), "aboutToBlock")
 	}
 }
 
@@ -906,7 +942,7 @@ func (ptr *QAbstractEventDispatcher) AboutToBlock() {
 
 //export callbackQAbstractEventDispatcher_Awake
 func callbackQAbstractEventDispatcher_Awake(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "awake"); signal != nil {
+	if signal := qt.GetSignal(ptr, "awake"); signal != nil {
 		signal.(func())()
 	}
 
@@ -915,14 +951,14 @@ func callbackQAbstractEventDispatcher_Awake(ptr unsafe.Pointer) {
 func (ptr *QAbstractEventDispatcher) ConnectAwake(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractEventDispatcher_ConnectAwake(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "awake", f)
+		qt.ConnectSignal(ptr.Pointer(), "awake", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectAwake() {
 	if ptr.Pointer() != nil {
 		C.QAbstractEventDispatcher_DisconnectAwake(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "awake")
+		qt.DisconnectSignal(ptr.Pointer(), "awake")
 	}
 }
 
@@ -934,7 +970,7 @@ func (ptr *QAbstractEventDispatcher) Awake() {
 
 //export callbackQAbstractEventDispatcher_Flush
 func callbackQAbstractEventDispatcher_Flush(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flush"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flush"); signal != nil {
 		signal.(func())()
 	}
 
@@ -943,14 +979,14 @@ func callbackQAbstractEventDispatcher_Flush(ptr unsafe.Pointer) {
 func (ptr *QAbstractEventDispatcher) ConnectFlush(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "flush", f)
+		qt.ConnectSignal(ptr.Pointer(), "flush", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectFlush() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "flush")
+		qt.DisconnectSignal(ptr.Pointer(), "flush")
 	}
 }
 
@@ -968,7 +1004,7 @@ func (ptr *QAbstractEventDispatcher) InstallNativeEventFilter(filterObj QAbstrac
 
 //export callbackQAbstractEventDispatcher_Interrupt
 func callbackQAbstractEventDispatcher_Interrupt(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "interrupt"); signal != nil {
+	if signal := qt.GetSignal(ptr, "interrupt"); signal != nil {
 		signal.(func())()
 	}
 
@@ -977,14 +1013,14 @@ func callbackQAbstractEventDispatcher_Interrupt(ptr unsafe.Pointer) {
 func (ptr *QAbstractEventDispatcher) ConnectInterrupt(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "interrupt", f)
+		qt.ConnectSignal(ptr.Pointer(), "interrupt", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectInterrupt() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "interrupt")
+		qt.DisconnectSignal(ptr.Pointer(), "interrupt")
 	}
 }
 
@@ -996,7 +1032,7 @@ func (ptr *QAbstractEventDispatcher) Interrupt() {
 
 //export callbackQAbstractEventDispatcher_RegisterSocketNotifier
 func callbackQAbstractEventDispatcher_RegisterSocketNotifier(ptr unsafe.Pointer, notifier unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "registerSocketNotifier"); signal != nil {
+	if signal := qt.GetSignal(ptr, "registerSocketNotifier"); signal != nil {
 		signal.(func(*QSocketNotifier))(NewQSocketNotifierFromPointer(notifier))
 	}
 
@@ -1005,14 +1041,14 @@ func callbackQAbstractEventDispatcher_RegisterSocketNotifier(ptr unsafe.Pointer,
 func (ptr *QAbstractEventDispatcher) ConnectRegisterSocketNotifier(f func(notifier *QSocketNotifier)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "registerSocketNotifier", f)
+		qt.ConnectSignal(ptr.Pointer(), "registerSocketNotifier", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectRegisterSocketNotifier() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "registerSocketNotifier")
+		qt.DisconnectSignal(ptr.Pointer(), "registerSocketNotifier")
 	}
 }
 
@@ -1024,7 +1060,7 @@ func (ptr *QAbstractEventDispatcher) RegisterSocketNotifier(notifier QSocketNoti
 
 //export callbackQAbstractEventDispatcher_RegisterTimer4
 func callbackQAbstractEventDispatcher_RegisterTimer4(ptr unsafe.Pointer, timerId C.int, interval C.int, timerType C.longlong, object unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "registerTimer4"); signal != nil {
+	if signal := qt.GetSignal(ptr, "registerTimer4"); signal != nil {
 		signal.(func(int, int, Qt__TimerType, *QObject))(int(int32(timerId)), int(int32(interval)), Qt__TimerType(timerType), NewQObjectFromPointer(object))
 	}
 
@@ -1033,14 +1069,14 @@ func callbackQAbstractEventDispatcher_RegisterTimer4(ptr unsafe.Pointer, timerId
 func (ptr *QAbstractEventDispatcher) ConnectRegisterTimer4(f func(timerId int, interval int, timerType Qt__TimerType, object *QObject)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "registerTimer4", f)
+		qt.ConnectSignal(ptr.Pointer(), "registerTimer4", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectRegisterTimer4() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "registerTimer4")
+		qt.DisconnectSignal(ptr.Pointer(), "registerTimer4")
 	}
 }
 
@@ -1058,7 +1094,7 @@ func (ptr *QAbstractEventDispatcher) RemoveNativeEventFilter(filter QAbstractNat
 
 //export callbackQAbstractEventDispatcher_UnregisterEventNotifier
 func callbackQAbstractEventDispatcher_UnregisterEventNotifier(ptr unsafe.Pointer, notifier unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unregisterEventNotifier"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unregisterEventNotifier"); signal != nil {
 		signal.(func(*QWinEventNotifier))(NewQWinEventNotifierFromPointer(notifier))
 	}
 
@@ -1067,14 +1103,14 @@ func callbackQAbstractEventDispatcher_UnregisterEventNotifier(ptr unsafe.Pointer
 func (ptr *QAbstractEventDispatcher) ConnectUnregisterEventNotifier(f func(notifier *QWinEventNotifier)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterEventNotifier", f)
+		qt.ConnectSignal(ptr.Pointer(), "unregisterEventNotifier", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectUnregisterEventNotifier() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterEventNotifier")
+		qt.DisconnectSignal(ptr.Pointer(), "unregisterEventNotifier")
 	}
 }
 
@@ -1086,7 +1122,7 @@ func (ptr *QAbstractEventDispatcher) UnregisterEventNotifier(notifier QWinEventN
 
 //export callbackQAbstractEventDispatcher_UnregisterSocketNotifier
 func callbackQAbstractEventDispatcher_UnregisterSocketNotifier(ptr unsafe.Pointer, notifier unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unregisterSocketNotifier"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unregisterSocketNotifier"); signal != nil {
 		signal.(func(*QSocketNotifier))(NewQSocketNotifierFromPointer(notifier))
 	}
 
@@ -1095,14 +1131,14 @@ func callbackQAbstractEventDispatcher_UnregisterSocketNotifier(ptr unsafe.Pointe
 func (ptr *QAbstractEventDispatcher) ConnectUnregisterSocketNotifier(f func(notifier *QSocketNotifier)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterSocketNotifier", f)
+		qt.ConnectSignal(ptr.Pointer(), "unregisterSocketNotifier", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectUnregisterSocketNotifier() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterSocketNotifier")
+		qt.DisconnectSignal(ptr.Pointer(), "unregisterSocketNotifier")
 	}
 }
 
@@ -1114,7 +1150,7 @@ func (ptr *QAbstractEventDispatcher) UnregisterSocketNotifier(notifier QSocketNo
 
 //export callbackQAbstractEventDispatcher_WakeUp
 func callbackQAbstractEventDispatcher_WakeUp(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wakeUp"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wakeUp"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1123,14 +1159,14 @@ func callbackQAbstractEventDispatcher_WakeUp(ptr unsafe.Pointer) {
 func (ptr *QAbstractEventDispatcher) ConnectWakeUp(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "wakeUp", f)
+		qt.ConnectSignal(ptr.Pointer(), "wakeUp", f)
 	}
 }
 
 func (ptr *QAbstractEventDispatcher) DisconnectWakeUp() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "wakeUp")
+		qt.DisconnectSignal(ptr.Pointer(), "wakeUp")
 	}
 }
 
@@ -1143,7 +1179,7 @@ func (ptr *QAbstractEventDispatcher) WakeUp() {
 func (ptr *QAbstractEventDispatcher) DestroyQAbstractEventDispatcher() {
 	if ptr.Pointer() != nil {
 		C.QAbstractEventDispatcher_DestroyQAbstractEventDispatcher(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1199,7 +1235,7 @@ const (
 
 func NewQAbstractItemModel(parent QObject_ITF) *QAbstractItemModel {
 	var tmpValue = NewQAbstractItemModelFromPointer(C.QAbstractItemModel_NewQAbstractItemModel(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1221,7 +1257,7 @@ func (ptr *QAbstractItemModel) BeginMoveRows(sourceParent QModelIndex_ITF, sourc
 
 //export callbackQAbstractItemModel_DropMimeData
 func callbackQAbstractItemModel_DropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QMimeData, Qt__DropAction, int, int, *QModelIndex) bool)(NewQMimeDataFromPointer(data), Qt__DropAction(action), int(int32(row)), int(int32(column)), NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -1231,14 +1267,14 @@ func callbackQAbstractItemModel_DropMimeData(ptr unsafe.Pointer, data unsafe.Poi
 func (ptr *QAbstractItemModel) ConnectDropMimeData(f func(data *QMimeData, action Qt__DropAction, row int, column int, parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dropMimeData", f)
+		qt.ConnectSignal(ptr.Pointer(), "dropMimeData", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectDropMimeData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dropMimeData")
+		qt.DisconnectSignal(ptr.Pointer(), "dropMimeData")
 	}
 }
 
@@ -1265,7 +1301,7 @@ func (ptr *QAbstractItemModel) InsertColumn(column int, parent QModelIndex_ITF)
 
 //export callbackQAbstractItemModel_InsertColumns
 func callbackQAbstractItemModel_InsertColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *QModelIndex) bool)(int(int32(column)), int(int32(count)), NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -1275,14 +1311,14 @@ func callbackQAbstractItemModel_InsertColumns(ptr unsafe.Pointer, column C.int,
 func (ptr *QAbstractItemModel) ConnectInsertColumns(f func(column int, count int, parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "insertColumns", f)
+		qt.ConnectSignal(ptr.Pointer(), "insertColumns", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectInsertColumns() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "insertColumns")
+		qt.DisconnectSignal(ptr.Pointer(), "insertColumns")
 	}
 }
 
@@ -1309,7 +1345,7 @@ func (ptr *QAbstractItemModel) InsertRow(row int, parent QModelIndex_ITF) bool {
 
 //export callbackQAbstractItemModel_InsertRows
 func callbackQAbstractItemModel_InsertRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *QModelIndex) bool)(int(int32(row)), int(int32(count)), NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -1319,14 +1355,14 @@ func callbackQAbstractItemModel_InsertRows(ptr unsafe.Pointer, row C.int, count
 func (ptr *QAbstractItemModel) ConnectInsertRows(f func(row int, count int, parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "insertRows", f)
+		qt.ConnectSignal(ptr.Pointer(), "insertRows", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectInsertRows() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "insertRows")
+		qt.DisconnectSignal(ptr.Pointer(), "insertRows")
 	}
 }
 
@@ -1353,7 +1389,7 @@ func (ptr *QAbstractItemModel) MoveColumn(sourceParent QModelIndex_ITF, sourceCo
 
 //export callbackQAbstractItemModel_MoveColumns
 func callbackQAbstractItemModel_MoveColumns(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceColumn C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QModelIndex, int, int, *QModelIndex, int) bool)(NewQModelIndexFromPointer(sourceParent), int(int32(sourceColumn)), int(int32(count)), NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -1363,14 +1399,14 @@ func callbackQAbstractItemModel_MoveColumns(ptr unsafe.Pointer, sourceParent uns
 func (ptr *QAbstractItemModel) ConnectMoveColumns(f func(sourceParent *QModelIndex, sourceColumn int, count int, destinationParent *QModelIndex, destinationChild int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "moveColumns", f)
+		qt.ConnectSignal(ptr.Pointer(), "moveColumns", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectMoveColumns() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "moveColumns")
+		qt.DisconnectSignal(ptr.Pointer(), "moveColumns")
 	}
 }
 
@@ -1397,7 +1433,7 @@ func (ptr *QAbstractItemModel) MoveRow(sourceParent QModelIndex_ITF, sourceRow i
 
 //export callbackQAbstractItemModel_MoveRows
 func callbackQAbstractItemModel_MoveRows(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceRow C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QModelIndex, int, int, *QModelIndex, int) bool)(NewQModelIndexFromPointer(sourceParent), int(int32(sourceRow)), int(int32(count)), NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -1407,14 +1443,14 @@ func callbackQAbstractItemModel_MoveRows(ptr unsafe.Pointer, sourceParent unsafe
 func (ptr *QAbstractItemModel) ConnectMoveRows(f func(sourceParent *QModelIndex, sourceRow int, count int, destinationParent *QModelIndex, destinationChild int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "moveRows", f)
+		qt.ConnectSignal(ptr.Pointer(), "moveRows", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectMoveRows() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "moveRows")
+		qt.DisconnectSignal(ptr.Pointer(), "moveRows")
 	}
 }
 
@@ -1441,7 +1477,7 @@ func (ptr *QAbstractItemModel) RemoveColumn(column int, parent QModelIndex_ITF)
 
 //export callbackQAbstractItemModel_RemoveColumns
 func callbackQAbstractItemModel_RemoveColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *QModelIndex) bool)(int(int32(column)), int(int32(count)), NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -1451,14 +1487,14 @@ func callbackQAbstractItemModel_RemoveColumns(ptr unsafe.Pointer, column C.int,
 func (ptr *QAbstractItemModel) ConnectRemoveColumns(f func(column int, count int, parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "removeColumns", f)
+		qt.ConnectSignal(ptr.Pointer(), "removeColumns", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRemoveColumns() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "removeColumns")
+		qt.DisconnectSignal(ptr.Pointer(), "removeColumns")
 	}
 }
 
@@ -1485,7 +1521,7 @@ func (ptr *QAbstractItemModel) RemoveRow(row int, parent QModelIndex_ITF) bool {
 
 //export callbackQAbstractItemModel_RemoveRows
 func callbackQAbstractItemModel_RemoveRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *QModelIndex) bool)(int(int32(row)), int(int32(count)), NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -1495,14 +1531,14 @@ func callbackQAbstractItemModel_RemoveRows(ptr unsafe.Pointer, row C.int, count
 func (ptr *QAbstractItemModel) ConnectRemoveRows(f func(row int, count int, parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "removeRows", f)
+		qt.ConnectSignal(ptr.Pointer(), "removeRows", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRemoveRows() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "removeRows")
+		qt.DisconnectSignal(ptr.Pointer(), "removeRows")
 	}
 }
 
@@ -1522,7 +1558,7 @@ func (ptr *QAbstractItemModel) RemoveRowsDefault(row int, count int, parent QMod
 
 //export callbackQAbstractItemModel_SetData
 func callbackQAbstractItemModel_SetData(ptr unsafe.Pointer, index unsafe.Pointer, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QModelIndex, *QVariant, int) bool)(NewQModelIndexFromPointer(index), NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -1532,14 +1568,14 @@ func callbackQAbstractItemModel_SetData(ptr unsafe.Pointer, index unsafe.Pointer
 func (ptr *QAbstractItemModel) ConnectSetData(f func(index *QModelIndex, value *QVariant, role int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setData", f)
+		qt.ConnectSignal(ptr.Pointer(), "setData", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectSetData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setData")
+		qt.DisconnectSignal(ptr.Pointer(), "setData")
 	}
 }
 
@@ -1559,7 +1595,7 @@ func (ptr *QAbstractItemModel) SetDataDefault(index QModelIndex_ITF, value QVari
 
 //export callbackQAbstractItemModel_SetHeaderData
 func callbackQAbstractItemModel_SetHeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHeaderData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHeaderData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, Qt__Orientation, *QVariant, int) bool)(int(int32(section)), Qt__Orientation(orientation), NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -1569,14 +1605,14 @@ func callbackQAbstractItemModel_SetHeaderData(ptr unsafe.Pointer, section C.int,
 func (ptr *QAbstractItemModel) ConnectSetHeaderData(f func(section int, orientation Qt__Orientation, value *QVariant, role int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setHeaderData", f)
+		qt.ConnectSignal(ptr.Pointer(), "setHeaderData", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectSetHeaderData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setHeaderData")
+		qt.DisconnectSignal(ptr.Pointer(), "setHeaderData")
 	}
 }
 
@@ -1596,7 +1632,7 @@ func (ptr *QAbstractItemModel) SetHeaderDataDefault(section int, orientation Qt_
 
 //export callbackQAbstractItemModel_SetItemData
 func callbackQAbstractItemModel_SetItemData(ptr unsafe.Pointer, index unsafe.Pointer, roles C.struct_QtCore_PackedList) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setItemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setItemData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QModelIndex, map[int]*QVariant) bool)(NewQModelIndexFromPointer(index), func(l C.struct_QtCore_PackedList) map[int]*QVariant {
 			var out = make(map[int]*QVariant, int(l.len))
 			for _, i := range NewQAbstractItemModelFromPointer(l.data).__setItemData_keyList() {
@@ -1618,14 +1654,14 @@ func callbackQAbstractItemModel_SetItemData(ptr unsafe.Pointer, index unsafe.Poi
 func (ptr *QAbstractItemModel) ConnectSetItemData(f func(index *QModelIndex, roles map[int]*QVariant) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setItemData", f)
+		qt.ConnectSignal(ptr.Pointer(), "setItemData", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectSetItemData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setItemData")
+		qt.DisconnectSignal(ptr.Pointer(), "setItemData")
 	}
 }
 
@@ -1657,7 +1693,7 @@ func (ptr *QAbstractItemModel) SetItemDataDefault(index QModelIndex_ITF, roles m
 
 //export callbackQAbstractItemModel_Submit
 func callbackQAbstractItemModel_Submit(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "submit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "submit"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1667,14 +1703,14 @@ func callbackQAbstractItemModel_Submit(ptr unsafe.Pointer) C.char {
 func (ptr *QAbstractItemModel) ConnectSubmit(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "submit", f)
+		qt.ConnectSignal(ptr.Pointer(), "submit", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectSubmit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "submit")
+		qt.DisconnectSignal(ptr.Pointer(), "submit")
 	}
 }
 
@@ -1748,7 +1784,7 @@ func (ptr *QAbstractItemModel) ChangePersistentIndexList(from []*QModelIndex, to
 
 //export callbackQAbstractItemModel_ColumnsAboutToBeInserted
 func callbackQAbstractItemModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeInserted"); signal != nil {
 		signal.(func(*QModelIndex, int, int))(NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1757,20 +1793,20 @@ func callbackQAbstractItemModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, par
 func (ptr *QAbstractItemModel) ConnectColumnsAboutToBeInserted(f func(parent *QModelIndex, first int, last int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectColumnsAboutToBeInserted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnsAboutToBeInserted", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnsAboutToBeInserted", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectColumnsAboutToBeInserted() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectColumnsAboutToBeInserted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnsAboutToBeInserted")
+		qt.DisconnectSignal(ptr.Pointer(), "columnsAboutToBeInserted")
 	}
 }
 
 //export callbackQAbstractItemModel_ColumnsAboutToBeMoved
 func callbackQAbstractItemModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationColumn C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeMoved"); signal != nil {
 		signal.(func(*QModelIndex, int, int, *QModelIndex, int))(NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), NewQModelIndexFromPointer(destinationParent), int(int32(destinationColumn)))
 	}
 
@@ -1779,20 +1815,20 @@ func callbackQAbstractItemModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, source
 func (ptr *QAbstractItemModel) ConnectColumnsAboutToBeMoved(f func(sourceParent *QModelIndex, sourceStart int, sourceEnd int, destinationParent *QModelIndex, destinationColumn int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectColumnsAboutToBeMoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnsAboutToBeMoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnsAboutToBeMoved", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectColumnsAboutToBeMoved() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectColumnsAboutToBeMoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnsAboutToBeMoved")
+		qt.DisconnectSignal(ptr.Pointer(), "columnsAboutToBeMoved")
 	}
 }
 
 //export callbackQAbstractItemModel_ColumnsAboutToBeRemoved
 func callbackQAbstractItemModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeRemoved"); signal != nil {
 		signal.(func(*QModelIndex, int, int))(NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1801,20 +1837,20 @@ func callbackQAbstractItemModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, pare
 func (ptr *QAbstractItemModel) ConnectColumnsAboutToBeRemoved(f func(parent *QModelIndex, first int, last int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectColumnsAboutToBeRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnsAboutToBeRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnsAboutToBeRemoved", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectColumnsAboutToBeRemoved() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectColumnsAboutToBeRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnsAboutToBeRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "columnsAboutToBeRemoved")
 	}
 }
 
 //export callbackQAbstractItemModel_ColumnsInserted
 func callbackQAbstractItemModel_ColumnsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsInserted"); signal != nil {
 		signal.(func(*QModelIndex, int, int))(NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1823,20 +1859,20 @@ func callbackQAbstractItemModel_ColumnsInserted(ptr unsafe.Pointer, parent unsaf
 func (ptr *QAbstractItemModel) ConnectColumnsInserted(f func(parent *QModelIndex, first int, last int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectColumnsInserted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnsInserted", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnsInserted", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectColumnsInserted() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectColumnsInserted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnsInserted")
+		qt.DisconnectSignal(ptr.Pointer(), "columnsInserted")
 	}
 }
 
 //export callbackQAbstractItemModel_ColumnsMoved
 func callbackQAbstractItemModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, column C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsMoved"); signal != nil {
 		signal.(func(*QModelIndex, int, int, *QModelIndex, int))(NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), NewQModelIndexFromPointer(destination), int(int32(column)))
 	}
 
@@ -1845,20 +1881,20 @@ func callbackQAbstractItemModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.P
 func (ptr *QAbstractItemModel) ConnectColumnsMoved(f func(parent *QModelIndex, start int, end int, destination *QModelIndex, column int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectColumnsMoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnsMoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnsMoved", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectColumnsMoved() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectColumnsMoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnsMoved")
+		qt.DisconnectSignal(ptr.Pointer(), "columnsMoved")
 	}
 }
 
 //export callbackQAbstractItemModel_ColumnsRemoved
 func callbackQAbstractItemModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsRemoved"); signal != nil {
 		signal.(func(*QModelIndex, int, int))(NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1867,24 +1903,26 @@ func callbackQAbstractItemModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe
 func (ptr *QAbstractItemModel) ConnectColumnsRemoved(f func(parent *QModelIndex, first int, last int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectColumnsRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnsRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnsRemoved", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectColumnsRemoved() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectColumnsRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnsRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "columnsRemoved")
 	}
 }
 
 //export callbackQAbstractItemModel_DataChanged
 func callbackQAbstractItemModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Pointer, bottomRight unsafe.Pointer, roles C.struct_QtCore_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataChanged"); signal != nil {
 		signal.(func(*QModelIndex, *QModelIndex, []int))(NewQModelIndexFromPointer(topLeft), NewQModelIndexFromPointer(bottomRight), func(l C.struct_QtCore_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQAbstractItemModelFromPointer(l.data).__dataChanged_roles_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQAbstractItemModelFromPointer(l.data).__dataChanged_roles_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(roles))
@@ -1895,26 +1933,26 @@ func callbackQAbstractItemModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.P
 func (ptr *QAbstractItemModel) ConnectDataChanged(f func(topLeft *QModelIndex, bottomRight *QModelIndex, roles []int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectDataChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dataChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "dataChanged", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectDataChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectDataChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dataChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "dataChanged")
 	}
 }
 
 func (ptr *QAbstractItemModel) DataChanged(topLeft QModelIndex_ITF, bottomRight QModelIndex_ITF, roles []int) {
 	if ptr.Pointer() != nil {
-		C.QAbstractItemModel_DataChanged(ptr.Pointer(), PointerFromQModelIndex(topLeft), PointerFromQModelIndex(bottomRight), func() unsafe.Pointer {
-			var tmpList = NewQAbstractItemModelFromPointer(NewQAbstractItemModelFromPointer(nil).__dataChanged_roles_newList())
-			for _, v := range roles {
-				tmpList.__dataChanged_roles_setList(v)
+		C.QAbstractItemModel_DataChanged(ptr.Pointer(), PointerFromQModelIndex(topLeft), PointerFromQModelIndex(bottomRight), func(l []int) unsafe.Pointer {
+			var tmpList = make([]C.int, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.int(int32(v))
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQAbstractItemModelFromPointer(nil).__dataChanged_roles_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(roles))
 	}
 }
 
@@ -1962,7 +2000,7 @@ func (ptr *QAbstractItemModel) EndResetModel() {
 
 //export callbackQAbstractItemModel_FetchMore
 func callbackQAbstractItemModel_FetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchMore"); signal != nil {
 		signal.(func(*QModelIndex))(NewQModelIndexFromPointer(parent))
 	} else {
 		NewQAbstractItemModelFromPointer(ptr).FetchMoreDefault(NewQModelIndexFromPointer(parent))
@@ -1972,14 +2010,14 @@ func callbackQAbstractItemModel_FetchMore(ptr unsafe.Pointer, parent unsafe.Poin
 func (ptr *QAbstractItemModel) ConnectFetchMore(f func(parent *QModelIndex)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fetchMore", f)
+		qt.ConnectSignal(ptr.Pointer(), "fetchMore", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectFetchMore() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fetchMore")
+		qt.DisconnectSignal(ptr.Pointer(), "fetchMore")
 	}
 }
 
@@ -1997,7 +2035,7 @@ func (ptr *QAbstractItemModel) FetchMoreDefault(parent QModelIndex_ITF) {
 
 //export callbackQAbstractItemModel_HeaderDataChanged
 func callbackQAbstractItemModel_HeaderDataChanged(ptr unsafe.Pointer, orientation C.longlong, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerDataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerDataChanged"); signal != nil {
 		signal.(func(Qt__Orientation, int, int))(Qt__Orientation(orientation), int(int32(first)), int(int32(last)))
 	}
 
@@ -2006,14 +2044,14 @@ func callbackQAbstractItemModel_HeaderDataChanged(ptr unsafe.Pointer, orientatio
 func (ptr *QAbstractItemModel) ConnectHeaderDataChanged(f func(orientation Qt__Orientation, first int, last int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectHeaderDataChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "headerDataChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "headerDataChanged", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectHeaderDataChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectHeaderDataChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "headerDataChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "headerDataChanged")
 	}
 }
 
@@ -2025,7 +2063,7 @@ func (ptr *QAbstractItemModel) HeaderDataChanged(orientation Qt__Orientation, fi
 
 //export callbackQAbstractItemModel_LayoutAboutToBeChanged
 func callbackQAbstractItemModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, parents C.struct_QtCore_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutAboutToBeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutAboutToBeChanged"); signal != nil {
 		signal.(func([]*QPersistentModelIndex, QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtCore_PackedList) []*QPersistentModelIndex {
 			var out = make([]*QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -2040,14 +2078,14 @@ func callbackQAbstractItemModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, paren
 func (ptr *QAbstractItemModel) ConnectLayoutAboutToBeChanged(f func(parents []*QPersistentModelIndex, hint QAbstractItemModel__LayoutChangeHint)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectLayoutAboutToBeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "layoutAboutToBeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "layoutAboutToBeChanged", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectLayoutAboutToBeChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectLayoutAboutToBeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "layoutAboutToBeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "layoutAboutToBeChanged")
 	}
 }
 
@@ -2065,7 +2103,7 @@ func (ptr *QAbstractItemModel) LayoutAboutToBeChanged(parents []*QPersistentMode
 
 //export callbackQAbstractItemModel_LayoutChanged
 func callbackQAbstractItemModel_LayoutChanged(ptr unsafe.Pointer, parents C.struct_QtCore_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutChanged"); signal != nil {
 		signal.(func([]*QPersistentModelIndex, QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtCore_PackedList) []*QPersistentModelIndex {
 			var out = make([]*QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -2080,14 +2118,14 @@ func callbackQAbstractItemModel_LayoutChanged(ptr unsafe.Pointer, parents C.stru
 func (ptr *QAbstractItemModel) ConnectLayoutChanged(f func(parents []*QPersistentModelIndex, hint QAbstractItemModel__LayoutChangeHint)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectLayoutChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "layoutChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "layoutChanged", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectLayoutChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectLayoutChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "layoutChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "layoutChanged")
 	}
 }
 
@@ -2105,7 +2143,7 @@ func (ptr *QAbstractItemModel) LayoutChanged(parents []*QPersistentModelIndex, h
 
 //export callbackQAbstractItemModel_ModelAboutToBeReset
 func callbackQAbstractItemModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelAboutToBeReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelAboutToBeReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -2114,20 +2152,20 @@ func callbackQAbstractItemModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
 func (ptr *QAbstractItemModel) ConnectModelAboutToBeReset(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectModelAboutToBeReset(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelAboutToBeReset", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelAboutToBeReset", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectModelAboutToBeReset() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectModelAboutToBeReset(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelAboutToBeReset")
+		qt.DisconnectSignal(ptr.Pointer(), "modelAboutToBeReset")
 	}
 }
 
 //export callbackQAbstractItemModel_ModelReset
 func callbackQAbstractItemModel_ModelReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -2136,20 +2174,20 @@ func callbackQAbstractItemModel_ModelReset(ptr unsafe.Pointer) {
 func (ptr *QAbstractItemModel) ConnectModelReset(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectModelReset(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelReset", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelReset", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectModelReset() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectModelReset(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelReset")
+		qt.DisconnectSignal(ptr.Pointer(), "modelReset")
 	}
 }
 
 //export callbackQAbstractItemModel_ResetInternalData
 func callbackQAbstractItemModel_ResetInternalData(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resetInternalData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resetInternalData"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractItemModelFromPointer(ptr).ResetInternalDataDefault()
@@ -2159,14 +2197,14 @@ func callbackQAbstractItemModel_ResetInternalData(ptr unsafe.Pointer) {
 func (ptr *QAbstractItemModel) ConnectResetInternalData(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resetInternalData", f)
+		qt.ConnectSignal(ptr.Pointer(), "resetInternalData", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectResetInternalData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resetInternalData")
+		qt.DisconnectSignal(ptr.Pointer(), "resetInternalData")
 	}
 }
 
@@ -2184,7 +2222,7 @@ func (ptr *QAbstractItemModel) ResetInternalDataDefault() {
 
 //export callbackQAbstractItemModel_Revert
 func callbackQAbstractItemModel_Revert(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "revert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "revert"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractItemModelFromPointer(ptr).RevertDefault()
@@ -2194,14 +2232,14 @@ func callbackQAbstractItemModel_Revert(ptr unsafe.Pointer) {
 func (ptr *QAbstractItemModel) ConnectRevert(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "revert", f)
+		qt.ConnectSignal(ptr.Pointer(), "revert", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRevert() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "revert")
+		qt.DisconnectSignal(ptr.Pointer(), "revert")
 	}
 }
 
@@ -2219,7 +2257,7 @@ func (ptr *QAbstractItemModel) RevertDefault() {
 
 //export callbackQAbstractItemModel_RowsAboutToBeInserted
 func callbackQAbstractItemModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeInserted"); signal != nil {
 		signal.(func(*QModelIndex, int, int))(NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	}
 
@@ -2228,20 +2266,20 @@ func callbackQAbstractItemModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent
 func (ptr *QAbstractItemModel) ConnectRowsAboutToBeInserted(f func(parent *QModelIndex, start int, end int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectRowsAboutToBeInserted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAboutToBeInserted", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsAboutToBeInserted", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRowsAboutToBeInserted() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectRowsAboutToBeInserted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAboutToBeInserted")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsAboutToBeInserted")
 	}
 }
 
 //export callbackQAbstractItemModel_RowsAboutToBeMoved
 func callbackQAbstractItemModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationRow C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeMoved"); signal != nil {
 		signal.(func(*QModelIndex, int, int, *QModelIndex, int))(NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), NewQModelIndexFromPointer(destinationParent), int(int32(destinationRow)))
 	}
 
@@ -2250,20 +2288,20 @@ func callbackQAbstractItemModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourcePar
 func (ptr *QAbstractItemModel) ConnectRowsAboutToBeMoved(f func(sourceParent *QModelIndex, sourceStart int, sourceEnd int, destinationParent *QModelIndex, destinationRow int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectRowsAboutToBeMoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAboutToBeMoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsAboutToBeMoved", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRowsAboutToBeMoved() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectRowsAboutToBeMoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAboutToBeMoved")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsAboutToBeMoved")
 	}
 }
 
 //export callbackQAbstractItemModel_RowsAboutToBeRemoved
 func callbackQAbstractItemModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeRemoved"); signal != nil {
 		signal.(func(*QModelIndex, int, int))(NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -2272,20 +2310,20 @@ func callbackQAbstractItemModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent
 func (ptr *QAbstractItemModel) ConnectRowsAboutToBeRemoved(f func(parent *QModelIndex, first int, last int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectRowsAboutToBeRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAboutToBeRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsAboutToBeRemoved", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRowsAboutToBeRemoved() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectRowsAboutToBeRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAboutToBeRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsAboutToBeRemoved")
 	}
 }
 
 //export callbackQAbstractItemModel_RowsInserted
 func callbackQAbstractItemModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsInserted"); signal != nil {
 		signal.(func(*QModelIndex, int, int))(NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -2294,20 +2332,20 @@ func callbackQAbstractItemModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.P
 func (ptr *QAbstractItemModel) ConnectRowsInserted(f func(parent *QModelIndex, first int, last int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectRowsInserted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsInserted", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsInserted", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRowsInserted() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectRowsInserted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsInserted")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsInserted")
 	}
 }
 
 //export callbackQAbstractItemModel_RowsMoved
 func callbackQAbstractItemModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, row C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsMoved"); signal != nil {
 		signal.(func(*QModelIndex, int, int, *QModelIndex, int))(NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), NewQModelIndexFromPointer(destination), int(int32(row)))
 	}
 
@@ -2316,20 +2354,20 @@ func callbackQAbstractItemModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Poin
 func (ptr *QAbstractItemModel) ConnectRowsMoved(f func(parent *QModelIndex, start int, end int, destination *QModelIndex, row int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectRowsMoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsMoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsMoved", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRowsMoved() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectRowsMoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsMoved")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsMoved")
 	}
 }
 
 //export callbackQAbstractItemModel_RowsRemoved
 func callbackQAbstractItemModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsRemoved"); signal != nil {
 		signal.(func(*QModelIndex, int, int))(NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -2338,20 +2376,20 @@ func callbackQAbstractItemModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Po
 func (ptr *QAbstractItemModel) ConnectRowsRemoved(f func(parent *QModelIndex, first int, last int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_ConnectRowsRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsRemoved", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRowsRemoved() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DisconnectRowsRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsRemoved")
 	}
 }
 
 //export callbackQAbstractItemModel_Sort
 func callbackQAbstractItemModel_Sort(ptr unsafe.Pointer, column C.int, order C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sort"); signal != nil {
 		signal.(func(int, Qt__SortOrder))(int(int32(column)), Qt__SortOrder(order))
 	} else {
 		NewQAbstractItemModelFromPointer(ptr).SortDefault(int(int32(column)), Qt__SortOrder(order))
@@ -2361,14 +2399,14 @@ func callbackQAbstractItemModel_Sort(ptr unsafe.Pointer, column C.int, order C.l
 func (ptr *QAbstractItemModel) ConnectSort(f func(column int, order Qt__SortOrder)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sort", f)
+		qt.ConnectSignal(ptr.Pointer(), "sort", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectSort() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sort")
+		qt.DisconnectSignal(ptr.Pointer(), "sort")
 	}
 }
 
@@ -2386,7 +2424,7 @@ func (ptr *QAbstractItemModel) SortDefault(column int, order Qt__SortOrder) {
 
 //export callbackQAbstractItemModel_DestroyQAbstractItemModel
 func callbackQAbstractItemModel_DestroyQAbstractItemModel(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractItemModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractItemModel"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractItemModelFromPointer(ptr).DestroyQAbstractItemModelDefault()
@@ -2396,21 +2434,21 @@ func callbackQAbstractItemModel_DestroyQAbstractItemModel(ptr unsafe.Pointer) {
 func (ptr *QAbstractItemModel) ConnectDestroyQAbstractItemModel(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractItemModel", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractItemModel", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectDestroyQAbstractItemModel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractItemModel")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractItemModel")
 	}
 }
 
 func (ptr *QAbstractItemModel) DestroyQAbstractItemModel() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DestroyQAbstractItemModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2418,14 +2456,14 @@ func (ptr *QAbstractItemModel) DestroyQAbstractItemModel() {
 func (ptr *QAbstractItemModel) DestroyQAbstractItemModelDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractItemModel_DestroyQAbstractItemModelDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractItemModel_RoleNames
 func callbackQAbstractItemModel_RoleNames(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "roleNames"); signal != nil {
+	if signal := qt.GetSignal(ptr, "roleNames"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQAbstractItemModelFromPointer(NewQAbstractItemModelFromPointer(nil).__roleNames_newList())
 			for k, v := range signal.(func() map[int]*QByteArray)() {
@@ -2447,14 +2485,14 @@ func callbackQAbstractItemModel_RoleNames(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QAbstractItemModel) ConnectRoleNames(f func() map[int]*QByteArray) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "roleNames", f)
+		qt.ConnectSignal(ptr.Pointer(), "roleNames", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRoleNames() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "roleNames")
+		qt.DisconnectSignal(ptr.Pointer(), "roleNames")
 	}
 }
 
@@ -2486,7 +2524,7 @@ func (ptr *QAbstractItemModel) RoleNamesDefault() map[int]*QByteArray {
 
 //export callbackQAbstractItemModel_ItemData
 func callbackQAbstractItemModel_ItemData(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemData"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQAbstractItemModelFromPointer(NewQAbstractItemModelFromPointer(nil).__itemData_newList())
 			for k, v := range signal.(func(*QModelIndex) map[int]*QVariant)(NewQModelIndexFromPointer(index)) {
@@ -2508,14 +2546,14 @@ func callbackQAbstractItemModel_ItemData(ptr unsafe.Pointer, index unsafe.Pointe
 func (ptr *QAbstractItemModel) ConnectItemData(f func(index *QModelIndex) map[int]*QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemData", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemData", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectItemData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemData")
+		qt.DisconnectSignal(ptr.Pointer(), "itemData")
 	}
 }
 
@@ -2547,7 +2585,7 @@ func (ptr *QAbstractItemModel) ItemDataDefault(index QModelIndex_ITF) map[int]*Q
 
 //export callbackQAbstractItemModel_MimeData
 func callbackQAbstractItemModel_MimeData(ptr unsafe.Pointer, indexes C.struct_QtCore_PackedList) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mimeData"); signal != nil {
 		return PointerFromQMimeData(signal.(func([]*QModelIndex) *QMimeData)(func(l C.struct_QtCore_PackedList) []*QModelIndex {
 			var out = make([]*QModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -2569,14 +2607,14 @@ func callbackQAbstractItemModel_MimeData(ptr unsafe.Pointer, indexes C.struct_Qt
 func (ptr *QAbstractItemModel) ConnectMimeData(f func(indexes []*QModelIndex) *QMimeData) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mimeData", f)
+		qt.ConnectSignal(ptr.Pointer(), "mimeData", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectMimeData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mimeData")
+		qt.DisconnectSignal(ptr.Pointer(), "mimeData")
 	}
 }
 
@@ -2589,7 +2627,7 @@ func (ptr *QAbstractItemModel) MimeData(indexes []*QModelIndex) *QMimeData {
 			}
 			return tmpList.Pointer()
 		}()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2606,7 +2644,7 @@ func (ptr *QAbstractItemModel) MimeDataDefault(indexes []*QModelIndex) *QMimeDat
 			}
 			return tmpList.Pointer()
 		}()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2616,7 +2654,7 @@ func (ptr *QAbstractItemModel) MimeDataDefault(indexes []*QModelIndex) *QMimeDat
 
 //export callbackQAbstractItemModel_Buddy
 func callbackQAbstractItemModel_Buddy(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buddy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buddy"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(index)))
 	}
 
@@ -2626,14 +2664,14 @@ func callbackQAbstractItemModel_Buddy(ptr unsafe.Pointer, index unsafe.Pointer)
 func (ptr *QAbstractItemModel) ConnectBuddy(f func(index *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buddy", f)
+		qt.ConnectSignal(ptr.Pointer(), "buddy", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectBuddy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buddy")
+		qt.DisconnectSignal(ptr.Pointer(), "buddy")
 	}
 }
 
@@ -2675,7 +2713,7 @@ func (ptr *QAbstractItemModel) CreateIndex(row int, column int, p unsafe.Pointer
 
 //export callbackQAbstractItemModel_Index
 func callbackQAbstractItemModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(int, int, *QModelIndex) *QModelIndex)(int(int32(row)), int(int32(column)), NewQModelIndexFromPointer(parent)))
 	}
 
@@ -2685,14 +2723,14 @@ func callbackQAbstractItemModel_Index(ptr unsafe.Pointer, row C.int, column C.in
 func (ptr *QAbstractItemModel) ConnectIndex(f func(row int, column int, parent *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "index", f)
+		qt.ConnectSignal(ptr.Pointer(), "index", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "index")
+		qt.DisconnectSignal(ptr.Pointer(), "index")
 	}
 }
 
@@ -2707,7 +2745,7 @@ func (ptr *QAbstractItemModel) Index(row int, column int, parent QModelIndex_ITF
 
 //export callbackQAbstractItemModel_Parent
 func callbackQAbstractItemModel_Parent(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(index)))
 	}
 
@@ -2717,14 +2755,14 @@ func callbackQAbstractItemModel_Parent(ptr unsafe.Pointer, index unsafe.Pointer)
 func (ptr *QAbstractItemModel) ConnectParent(f func(index *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parent", f)
+		qt.ConnectSignal(ptr.Pointer(), "parent", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectParent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parent")
+		qt.DisconnectSignal(ptr.Pointer(), "parent")
 	}
 }
 
@@ -2739,7 +2777,7 @@ func (ptr *QAbstractItemModel) Parent(index QModelIndex_ITF) *QModelIndex {
 
 //export callbackQAbstractItemModel_Sibling
 func callbackQAbstractItemModel_Sibling(ptr unsafe.Pointer, row C.int, column C.int, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sibling"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sibling"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(int, int, *QModelIndex) *QModelIndex)(int(int32(row)), int(int32(column)), NewQModelIndexFromPointer(index)))
 	}
 
@@ -2749,14 +2787,14 @@ func callbackQAbstractItemModel_Sibling(ptr unsafe.Pointer, row C.int, column C.
 func (ptr *QAbstractItemModel) ConnectSibling(f func(row int, column int, index *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sibling", f)
+		qt.ConnectSignal(ptr.Pointer(), "sibling", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectSibling() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sibling")
+		qt.DisconnectSignal(ptr.Pointer(), "sibling")
 	}
 }
 
@@ -2780,7 +2818,7 @@ func (ptr *QAbstractItemModel) SiblingDefault(row int, column int, index QModelI
 
 //export callbackQAbstractItemModel_Match
 func callbackQAbstractItemModel_Match(ptr unsafe.Pointer, start unsafe.Pointer, role C.int, value unsafe.Pointer, hits C.int, flags C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "match"); signal != nil {
+	if signal := qt.GetSignal(ptr, "match"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQAbstractItemModelFromPointer(NewQAbstractItemModelFromPointer(nil).__match_newList())
 			for _, v := range signal.(func(*QModelIndex, int, *QVariant, int, Qt__MatchFlag) []*QModelIndex)(NewQModelIndexFromPointer(start), int(int32(role)), NewQVariantFromPointer(value), int(int32(hits)), Qt__MatchFlag(flags)) {
@@ -2802,14 +2840,14 @@ func callbackQAbstractItemModel_Match(ptr unsafe.Pointer, start unsafe.Pointer,
 func (ptr *QAbstractItemModel) ConnectMatch(f func(start *QModelIndex, role int, value *QVariant, hits int, flags Qt__MatchFlag) []*QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "match", f)
+		qt.ConnectSignal(ptr.Pointer(), "match", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectMatch() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "match")
+		qt.DisconnectSignal(ptr.Pointer(), "match")
 	}
 }
 
@@ -2854,7 +2892,7 @@ func (ptr *QAbstractItemModel) PersistentIndexList() []*QModelIndex {
 
 //export callbackQAbstractItemModel_Span
 func callbackQAbstractItemModel_Span(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "span"); signal != nil {
+	if signal := qt.GetSignal(ptr, "span"); signal != nil {
 		return PointerFromQSize(signal.(func(*QModelIndex) *QSize)(NewQModelIndexFromPointer(index)))
 	}
 
@@ -2864,14 +2902,14 @@ func callbackQAbstractItemModel_Span(ptr unsafe.Pointer, index unsafe.Pointer) u
 func (ptr *QAbstractItemModel) ConnectSpan(f func(index *QModelIndex) *QSize) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "span", f)
+		qt.ConnectSignal(ptr.Pointer(), "span", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectSpan() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "span")
+		qt.DisconnectSignal(ptr.Pointer(), "span")
 	}
 }
 
@@ -2895,61 +2933,65 @@ func (ptr *QAbstractItemModel) SpanDefault(index QModelIndex_ITF) *QSize {
 
 //export callbackQAbstractItemModel_MimeTypes
 func callbackQAbstractItemModel_MimeTypes(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeTypes"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "mimeTypes"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(NewQAbstractItemModelFromPointer(ptr).MimeTypesDefault(), "|"))
+	return cGoPackStringList(NewQAbstractItemModelFromPointer(ptr).MimeTypesDefault())
 }
 
 func (ptr *QAbstractItemModel) ConnectMimeTypes(f func() []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mimeTypes", f)
+		qt.ConnectSignal(ptr.Pointer(), "mimeTypes", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectMimeTypes() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mimeTypes")
+		qt.DisconnectSignal(ptr.Pointer(), "mimeTypes")
 	}
 }
 
 func (ptr *QAbstractItemModel) MimeTypes() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QAbstractItemModel_MimeTypes(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QAbstractItemModel_MimeTypes(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QAbstractItemModel) MimeTypesDefault() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QAbstractItemModel_MimeTypesDefault(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QAbstractItemModel_MimeTypesDefault(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQAbstractItemModel_Data
-func callbackQAbstractItemModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
-		return PointerFromQVariant(signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(index), int(int32(role))))
+func callbackQAbstractItemModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int, ret unsafe.Pointer) {
+	if signal := qt.GetSignal(ptr, "dataInto"); signal != nil {
+		signal.(func(*QModelIndex, int, *QVariant))(NewQModelIndexFromPointer(index), int(int32(role)), NewQVariantFromPointer(ret))
+		return
+	}
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
+		var tmpValue = signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(index), int(int32(role)))
+		NewQVariantFromPointer(ret).Assign(tmpValue)
+		return
 	}
-
-	return PointerFromQVariant(NewQVariant())
 }
 
 func (ptr *QAbstractItemModel) ConnectData(f func(index *QModelIndex, role int) *QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
@@ -2964,7 +3006,7 @@ func (ptr *QAbstractItemModel) Data(index QModelIndex_ITF, role int) *QVariant {
 
 //export callbackQAbstractItemModel_HeaderData
 func callbackQAbstractItemModel_HeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerData"); signal != nil {
 		return PointerFromQVariant(signal.(func(int, Qt__Orientation, int) *QVariant)(int(int32(section)), Qt__Orientation(orientation), int(int32(role))))
 	}
 
@@ -2974,14 +3016,14 @@ func callbackQAbstractItemModel_HeaderData(ptr unsafe.Pointer, section C.int, or
 func (ptr *QAbstractItemModel) ConnectHeaderData(f func(section int, orientation Qt__Orientation, role int) *QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "headerData", f)
+		qt.ConnectSignal(ptr.Pointer(), "headerData", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectHeaderData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "headerData")
+		qt.DisconnectSignal(ptr.Pointer(), "headerData")
 	}
 }
 
@@ -3005,7 +3047,7 @@ func (ptr *QAbstractItemModel) HeaderDataDefault(section int, orientation Qt__Or
 
 //export callbackQAbstractItemModel_SupportedDragActions
 func callbackQAbstractItemModel_SupportedDragActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDragActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDragActions"); signal != nil {
 		return C.longlong(signal.(func() Qt__DropAction)())
 	}
 
@@ -3015,14 +3057,14 @@ func callbackQAbstractItemModel_SupportedDragActions(ptr unsafe.Pointer) C.longl
 func (ptr *QAbstractItemModel) ConnectSupportedDragActions(f func() Qt__DropAction) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "supportedDragActions", f)
+		qt.ConnectSignal(ptr.Pointer(), "supportedDragActions", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectSupportedDragActions() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "supportedDragActions")
+		qt.DisconnectSignal(ptr.Pointer(), "supportedDragActions")
 	}
 }
 
@@ -3042,7 +3084,7 @@ func (ptr *QAbstractItemModel) SupportedDragActionsDefault() Qt__DropAction {
 
 //export callbackQAbstractItemModel_SupportedDropActions
 func callbackQAbstractItemModel_SupportedDropActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDropActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDropActions"); signal != nil {
 		return C.longlong(signal.(func() Qt__DropAction)())
 	}
 
@@ -3052,14 +3094,14 @@ func callbackQAbstractItemModel_SupportedDropActions(ptr unsafe.Pointer) C.longl
 func (ptr *QAbstractItemModel) ConnectSupportedDropActions(f func() Qt__DropAction) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "supportedDropActions", f)
+		qt.ConnectSignal(ptr.Pointer(), "supportedDropActions", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectSupportedDropActions() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "supportedDropActions")
+		qt.DisconnectSignal(ptr.Pointer(), "supportedDropActions")
 	}
 }
 
@@ -3079,7 +3121,7 @@ func (ptr *QAbstractItemModel) SupportedDropActionsDefault() Qt__DropAction {
 
 //export callbackQAbstractItemModel_Flags
 func callbackQAbstractItemModel_Flags(ptr unsafe.Pointer, index unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flags"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flags"); signal != nil {
 		return C.longlong(signal.(func(*QModelIndex) Qt__ItemFlag)(NewQModelIndexFromPointer(index)))
 	}
 
@@ -3089,14 +3131,14 @@ func callbackQAbstractItemModel_Flags(ptr unsafe.Pointer, index unsafe.Pointer)
 func (ptr *QAbstractItemModel) ConnectFlags(f func(index *QModelIndex) Qt__ItemFlag) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "flags", f)
+		qt.ConnectSignal(ptr.Pointer(), "flags", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectFlags() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "flags")
+		qt.DisconnectSignal(ptr.Pointer(), "flags")
 	}
 }
 
@@ -3116,7 +3158,7 @@ func (ptr *QAbstractItemModel) FlagsDefault(index QModelIndex_ITF) Qt__ItemFlag
 
 //export callbackQAbstractItemModel_CanDropMimeData
 func callbackQAbstractItemModel_CanDropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canDropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canDropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QMimeData, Qt__DropAction, int, int, *QModelIndex) bool)(NewQMimeDataFromPointer(data), Qt__DropAction(action), int(int32(row)), int(int32(column)), NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -3126,14 +3168,14 @@ func callbackQAbstractItemModel_CanDropMimeData(ptr unsafe.Pointer, data unsafe.
 func (ptr *QAbstractItemModel) ConnectCanDropMimeData(f func(data *QMimeData, action Qt__DropAction, row int, column int, parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "canDropMimeData", f)
+		qt.ConnectSignal(ptr.Pointer(), "canDropMimeData", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectCanDropMimeData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "canDropMimeData")
+		qt.DisconnectSignal(ptr.Pointer(), "canDropMimeData")
 	}
 }
 
@@ -3153,7 +3195,7 @@ func (ptr *QAbstractItemModel) CanDropMimeDataDefault(data QMimeData_ITF, action
 
 //export callbackQAbstractItemModel_CanFetchMore
 func callbackQAbstractItemModel_CanFetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canFetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canFetchMore"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QModelIndex) bool)(NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -3163,14 +3205,14 @@ func callbackQAbstractItemModel_CanFetchMore(ptr unsafe.Pointer, parent unsafe.P
 func (ptr *QAbstractItemModel) ConnectCanFetchMore(f func(parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "canFetchMore", f)
+		qt.ConnectSignal(ptr.Pointer(), "canFetchMore", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectCanFetchMore() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "canFetchMore")
+		qt.DisconnectSignal(ptr.Pointer(), "canFetchMore")
 	}
 }
 
@@ -3190,7 +3232,7 @@ func (ptr *QAbstractItemModel) CanFetchMoreDefault(parent QModelIndex_ITF) bool
 
 //export callbackQAbstractItemModel_HasChildren
 func callbackQAbstractItemModel_HasChildren(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasChildren"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasChildren"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QModelIndex) bool)(NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -3200,14 +3242,14 @@ func callbackQAbstractItemModel_HasChildren(ptr unsafe.Pointer, parent unsafe.Po
 func (ptr *QAbstractItemModel) ConnectHasChildren(f func(parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasChildren", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasChildren", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectHasChildren() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasChildren")
+		qt.DisconnectSignal(ptr.Pointer(), "hasChildren")
 	}
 }
 
@@ -3234,7 +3276,7 @@ func (ptr *QAbstractItemModel) HasIndex(row int, column int, parent QModelIndex_
 
 //export callbackQAbstractItemModel_ColumnCount
 func callbackQAbstractItemModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -3244,14 +3286,14 @@ func callbackQAbstractItemModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Po
 func (ptr *QAbstractItemModel) ConnectColumnCount(f func(parent *QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCount", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectColumnCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCount")
 	}
 }
 
@@ -3264,7 +3306,7 @@ func (ptr *QAbstractItemModel) ColumnCount(parent QModelIndex_ITF) int {
 
 //export callbackQAbstractItemModel_RowCount
 func callbackQAbstractItemModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -3274,14 +3316,14 @@ func callbackQAbstractItemModel_RowCount(ptr unsafe.Pointer, parent unsafe.Point
 func (ptr *QAbstractItemModel) ConnectRowCount(f func(parent *QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCount", f)
 	}
 }
 
 func (ptr *QAbstractItemModel) DisconnectRowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCount")
 	}
 }
 
@@ -3315,8 +3357,10 @@ func (ptr *QAbstractItemModel) __setItemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtCore_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQAbstractItemModelFromPointer(l.data).____setItemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQAbstractItemModelFromPointer(l.data).____setItemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QAbstractItemModel___setItemData_keyList(ptr.Pointer()))
@@ -3379,6 +3423,16 @@ func (ptr *QAbstractItemModel) __dataChanged_roles_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QAbstractItemModel___dataChanged_roles_newList(ptr.Pointer()))
 }
 
+func (ptr *QAbstractItemModel) __dataChanged_roles_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QAbstractItemModel___dataChanged_roles_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QAbstractItemModel) __dataChanged_roles_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QAbstractItemModel___dataChanged_roles_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QAbstractItemModel) __doSetRoleNames_roleNames_atList(i int) *QByteArray {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQByteArrayFromPointer(C.QAbstractItemModel___doSetRoleNames_roleNames_atList(ptr.Pointer(), C.int(int32(i))))
@@ -3402,8 +3456,10 @@ func (ptr *QAbstractItemModel) __doSetRoleNames_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtCore_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQAbstractItemModelFromPointer(l.data).____doSetRoleNames_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQAbstractItemModelFromPointer(l.data).____doSetRoleNames_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QAbstractItemModel___doSetRoleNames_keyList(ptr.Pointer()))
@@ -3472,8 +3528,10 @@ func (ptr *QAbstractItemModel) __setRoleNames_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtCore_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQAbstractItemModelFromPointer(l.data).____setRoleNames_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQAbstractItemModelFromPointer(l.data).____setRoleNames_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QAbstractItemModel___setRoleNames_keyList(ptr.Pointer()))
@@ -3504,8 +3562,10 @@ func (ptr *QAbstractItemModel) __roleNames_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtCore_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQAbstractItemModelFromPointer(l.data).____roleNames_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQAbstractItemModelFromPointer(l.data).____roleNames_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QAbstractItemModel___roleNames_keyList(ptr.Pointer()))
@@ -3536,8 +3596,10 @@ func (ptr *QAbstractItemModel) __itemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtCore_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQAbstractItemModelFromPointer(l.data).____itemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQAbstractItemModelFromPointer(l.data).____itemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QAbstractItemModel___itemData_keyList(ptr.Pointer()))
@@ -3638,6 +3700,16 @@ func (ptr *QAbstractItemModel) ____setItemData_keyList_newList() unsafe.Pointer
 	return unsafe.Pointer(C.QAbstractItemModel_____setItemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QAbstractItemModel) ____setItemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QAbstractItemModel_____setItemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QAbstractItemModel) ____setItemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QAbstractItemModel_____setItemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QAbstractItemModel) ____doSetRoleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QAbstractItemModel_____doSetRoleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -3655,6 +3727,16 @@ func (ptr *QAbstractItemModel) ____doSetRoleNames_keyList_newList() unsafe.Point
 	return unsafe.Pointer(C.QAbstractItemModel_____doSetRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QAbstractItemModel) ____doSetRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QAbstractItemModel_____doSetRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QAbstractItemModel) ____doSetRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QAbstractItemModel_____doSetRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QAbstractItemModel) ____setRoleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QAbstractItemModel_____setRoleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -3672,6 +3754,16 @@ func (ptr *QAbstractItemModel) ____setRoleNames_keyList_newList() unsafe.Pointer
 	return unsafe.Pointer(C.QAbstractItemModel_____setRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QAbstractItemModel) ____setRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QAbstractItemModel_____setRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QAbstractItemModel) ____setRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QAbstractItemModel_____setRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QAbstractItemModel) ____roleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QAbstractItemModel_____roleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -3689,6 +3781,16 @@ func (ptr *QAbstractItemModel) ____roleNames_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QAbstractItemModel_____roleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QAbstractItemModel) ____roleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QAbstractItemModel_____roleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QAbstractItemModel) ____roleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QAbstractItemModel_____roleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QAbstractItemModel) ____itemData_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QAbstractItemModel_____itemData_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -3706,6 +3808,16 @@ func (ptr *QAbstractItemModel) ____itemData_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QAbstractItemModel_____itemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QAbstractItemModel) ____itemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QAbstractItemModel_____itemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QAbstractItemModel) ____itemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QAbstractItemModel_____itemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QAbstractListModel struct {
 	QAbstractItemModel
 }
@@ -3746,7 +3858,7 @@ func NewQAbstractListModelFromPointer(ptr unsafe.Pointer) *QAbstractListModel {
 }
 func NewQAbstractListModel(parent QObject_ITF) *QAbstractListModel {
 	var tmpValue = NewQAbstractListModelFromPointer(C.QAbstractListModel_NewQAbstractListModel(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3755,14 +3867,14 @@ func NewQAbstractListModel(parent QObject_ITF) *QAbstractListModel {
 func (ptr *QAbstractListModel) DestroyQAbstractListModel() {
 	if ptr.Pointer() != nil {
 		C.QAbstractListModel_DestroyQAbstractListModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractListModel_Index
 func callbackQAbstractListModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(int, int, *QModelIndex) *QModelIndex)(int(int32(row)), int(int32(column)), NewQModelIndexFromPointer(parent)))
 	}
 
@@ -3772,14 +3884,14 @@ func callbackQAbstractListModel_Index(ptr unsafe.Pointer, row C.int, column C.in
 func (ptr *QAbstractListModel) ConnectIndex(f func(row int, column int, parent *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "index", f)
+		qt.ConnectSignal(ptr.Pointer(), "index", f)
 	}
 }
 
 func (ptr *QAbstractListModel) DisconnectIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "index")
+		qt.DisconnectSignal(ptr.Pointer(), "index")
 	}
 }
 
@@ -3803,7 +3915,7 @@ func (ptr *QAbstractListModel) IndexDefault(row int, column int, parent QModelIn
 
 //export callbackQAbstractListModel_Parent
 func callbackQAbstractListModel_Parent(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(index)))
 	}
 
@@ -3829,12 +3941,18 @@ func (ptr *QAbstractListModel) ParentDefault(index QModelIndex_ITF) *QModelIndex
 }
 
 //export callbackQAbstractListModel_Data
-func callbackQAbstractListModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
-		return PointerFromQVariant(signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(index), int(int32(role))))
+func callbackQAbstractListModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int, ret unsafe.Pointer) {
+	if signal := qt.GetSignal(ptr, "dataInto"); signal != nil {
+		signal.(func(*QModelIndex, int, *QVariant))(NewQModelIndexFromPointer(index), int(int32(role)), NewQVariantFromPointer(ret))
+		return
+	}
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
+		var tmpValue = signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(index), int(int32(role)))
+		NewQVariantFromPointer(ret).Assign(tmpValue)
+		return
 	}
 
-	return PointerFromQVariant(NewQAbstractListModelFromPointer(ptr).DataDefault(NewQModelIndexFromPointer(index), int(int32(role))))
+	C.QAbstractListModel_DataDefaultInto(ptr, index, role, ret)
 }
 
 func (ptr *QAbstractListModel) Data(index QModelIndex_ITF, role int) *QVariant {
@@ -3857,7 +3975,7 @@ func (ptr *QAbstractListModel) DataDefault(index QModelIndex_ITF, role int) *QVa
 
 //export callbackQAbstractListModel_ColumnCount
 func callbackQAbstractListModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -3880,7 +3998,7 @@ func (ptr *QAbstractListModel) ColumnCountDefault(parent QModelIndex_ITF) int {
 
 //export callbackQAbstractListModel_RowCount
 func callbackQAbstractListModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -3944,7 +4062,7 @@ func NewQAbstractNativeEventFilter() *QAbstractNativeEventFilter {
 
 //export callbackQAbstractNativeEventFilter_NativeEventFilter
 func callbackQAbstractNativeEventFilter_NativeEventFilter(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QByteArray, unsafe.Pointer, int) bool)(NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -3954,14 +4072,14 @@ func callbackQAbstractNativeEventFilter_NativeEventFilter(ptr unsafe.Pointer, ev
 func (ptr *QAbstractNativeEventFilter) ConnectNativeEventFilter(f func(eventType *QByteArray, message unsafe.Pointer, result int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nativeEventFilter", f)
+		qt.ConnectSignal(ptr.Pointer(), "nativeEventFilter", f)
 	}
 }
 
 func (ptr *QAbstractNativeEventFilter) DisconnectNativeEventFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nativeEventFilter")
+		qt.DisconnectSignal(ptr.Pointer(), "nativeEventFilter")
 	}
 }
 
@@ -3974,7 +4092,7 @@ func (ptr *QAbstractNativeEventFilter) NativeEventFilter(eventType QByteArray_IT
 
 //export callbackQAbstractNativeEventFilter_DestroyQAbstractNativeEventFilter
 func callbackQAbstractNativeEventFilter_DestroyQAbstractNativeEventFilter(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractNativeEventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractNativeEventFilter"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractNativeEventFilterFromPointer(ptr).DestroyQAbstractNativeEventFilterDefault()
@@ -3984,21 +4102,21 @@ func callbackQAbstractNativeEventFilter_DestroyQAbstractNativeEventFilter(ptr un
 func (ptr *QAbstractNativeEventFilter) ConnectDestroyQAbstractNativeEventFilter(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractNativeEventFilter", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractNativeEventFilter", f)
 	}
 }
 
 func (ptr *QAbstractNativeEventFilter) DisconnectDestroyQAbstractNativeEventFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractNativeEventFilter")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractNativeEventFilter")
 	}
 }
 
 func (ptr *QAbstractNativeEventFilter) DestroyQAbstractNativeEventFilter() {
 	if ptr.Pointer() != nil {
 		C.QAbstractNativeEventFilter_DestroyQAbstractNativeEventFilter(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4006,7 +4124,7 @@ func (ptr *QAbstractNativeEventFilter) DestroyQAbstractNativeEventFilter() {
 func (ptr *QAbstractNativeEventFilter) DestroyQAbstractNativeEventFilterDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractNativeEventFilter_DestroyQAbstractNativeEventFilterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4051,7 +4169,7 @@ func NewQAbstractProxyModelFromPointer(ptr unsafe.Pointer) *QAbstractProxyModel
 }
 func NewQAbstractProxyModel(parent QObject_ITF) *QAbstractProxyModel {
 	var tmpValue = NewQAbstractProxyModelFromPointer(C.QAbstractProxyModel_NewQAbstractProxyModel(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4059,7 +4177,7 @@ func NewQAbstractProxyModel(parent QObject_ITF) *QAbstractProxyModel {
 
 //export callbackQAbstractProxyModel_Submit
 func callbackQAbstractProxyModel_Submit(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "submit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "submit"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -4069,14 +4187,14 @@ func callbackQAbstractProxyModel_Submit(ptr unsafe.Pointer) C.char {
 func (ptr *QAbstractProxyModel) ConnectSubmit(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "submit", f)
+		qt.ConnectSignal(ptr.Pointer(), "submit", f)
 	}
 }
 
 func (ptr *QAbstractProxyModel) DisconnectSubmit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "submit")
+		qt.DisconnectSignal(ptr.Pointer(), "submit")
 	}
 }
 
@@ -4096,7 +4214,7 @@ func (ptr *QAbstractProxyModel) SubmitDefault() bool {
 
 //export callbackQAbstractProxyModel_Revert
 func callbackQAbstractProxyModel_Revert(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "revert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "revert"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractProxyModelFromPointer(ptr).RevertDefault()
@@ -4106,14 +4224,14 @@ func callbackQAbstractProxyModel_Revert(ptr unsafe.Pointer) {
 func (ptr *QAbstractProxyModel) ConnectRevert(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "revert", f)
+		qt.ConnectSignal(ptr.Pointer(), "revert", f)
 	}
 }
 
 func (ptr *QAbstractProxyModel) DisconnectRevert() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "revert")
+		qt.DisconnectSignal(ptr.Pointer(), "revert")
 	}
 }
 
@@ -4131,7 +4249,7 @@ func (ptr *QAbstractProxyModel) RevertDefault() {
 
 //export callbackQAbstractProxyModel_SetSourceModel
 func callbackQAbstractProxyModel_SetSourceModel(ptr unsafe.Pointer, sourceModel unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSourceModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSourceModel"); signal != nil {
 		signal.(func(*QAbstractItemModel))(NewQAbstractItemModelFromPointer(sourceModel))
 	} else {
 		NewQAbstractProxyModelFromPointer(ptr).SetSourceModelDefault(NewQAbstractItemModelFromPointer(sourceModel))
@@ -4141,14 +4259,14 @@ func callbackQAbstractProxyModel_SetSourceModel(ptr unsafe.Pointer, sourceModel
 func (ptr *QAbstractProxyModel) ConnectSetSourceModel(f func(sourceModel *QAbstractItemModel)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSourceModel", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSourceModel", f)
 	}
 }
 
 func (ptr *QAbstractProxyModel) DisconnectSetSourceModel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSourceModel")
+		qt.DisconnectSignal(ptr.Pointer(), "setSourceModel")
 	}
 }
 
@@ -4166,7 +4284,7 @@ func (ptr *QAbstractProxyModel) SetSourceModelDefault(sourceModel QAbstractItemM
 
 //export callbackQAbstractProxyModel_SourceModelChanged
 func callbackQAbstractProxyModel_SourceModelChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sourceModelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sourceModelChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4175,21 +4293,21 @@ func callbackQAbstractProxyModel_SourceModelChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstractProxyModel) ConnectSourceModelChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractProxyModel_ConnectSourceModelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sourceModelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sourceModelChanged", f)
 	}
 }
 
 func (ptr *QAbstractProxyModel) DisconnectSourceModelChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractProxyModel_DisconnectSourceModelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sourceModelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sourceModelChanged")
 	}
 }
 
 func (ptr *QAbstractProxyModel) DestroyQAbstractProxyModel() {
 	if ptr.Pointer() != nil {
 		C.QAbstractProxyModel_DestroyQAbstractProxyModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4197,7 +4315,7 @@ func (ptr *QAbstractProxyModel) DestroyQAbstractProxyModel() {
 func (ptr *QAbstractProxyModel) SourceModel() *QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractItemModelFromPointer(C.QAbstractProxyModel_SourceModel(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4207,7 +4325,7 @@ func (ptr *QAbstractProxyModel) SourceModel() *QAbstractItemModel {
 
 //export callbackQAbstractProxyModel_MapSelectionFromSource
 func callbackQAbstractProxyModel_MapSelectionFromSource(ptr unsafe.Pointer, sourceSelection unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapSelectionFromSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapSelectionFromSource"); signal != nil {
 		return PointerFromQItemSelection(signal.(func(*QItemSelection) *QItemSelection)(NewQItemSelectionFromPointer(sourceSelection)))
 	}
 
@@ -4217,14 +4335,14 @@ func callbackQAbstractProxyModel_MapSelectionFromSource(ptr unsafe.Pointer, sour
 func (ptr *QAbstractProxyModel) ConnectMapSelectionFromSource(f func(sourceSelection *QItemSelection) *QItemSelection) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapSelectionFromSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapSelectionFromSource", f)
 	}
 }
 
 func (ptr *QAbstractProxyModel) DisconnectMapSelectionFromSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapSelectionFromSource")
+		qt.DisconnectSignal(ptr.Pointer(), "mapSelectionFromSource")
 	}
 }
 
@@ -4248,7 +4366,7 @@ func (ptr *QAbstractProxyModel) MapSelectionFromSourceDefault(sourceSelection QI
 
 //export callbackQAbstractProxyModel_MapSelectionToSource
 func callbackQAbstractProxyModel_MapSelectionToSource(ptr unsafe.Pointer, proxySelection unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapSelectionToSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapSelectionToSource"); signal != nil {
 		return PointerFromQItemSelection(signal.(func(*QItemSelection) *QItemSelection)(NewQItemSelectionFromPointer(proxySelection)))
 	}
 
@@ -4258,14 +4376,14 @@ func callbackQAbstractProxyModel_MapSelectionToSource(ptr unsafe.Pointer, proxyS
 func (ptr *QAbstractProxyModel) ConnectMapSelectionToSource(f func(proxySelection *QItemSelection) *QItemSelection) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapSelectionToSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapSelectionToSource", f)
 	}
 }
 
 func (ptr *QAbstractProxyModel) DisconnectMapSelectionToSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapSelectionToSource")
+		qt.DisconnectSignal(ptr.Pointer(), "mapSelectionToSource")
 	}
 }
 
@@ -4289,7 +4407,7 @@ func (ptr *QAbstractProxyModel) MapSelectionToSourceDefault(proxySelection QItem
 
 //export callbackQAbstractProxyModel_MapFromSource
 func callbackQAbstractProxyModel_MapFromSource(ptr unsafe.Pointer, sourceIndex unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapFromSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapFromSource"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(sourceIndex)))
 	}
 
@@ -4299,14 +4417,14 @@ func callbackQAbstractProxyModel_MapFromSource(ptr unsafe.Pointer, sourceIndex u
 func (ptr *QAbstractProxyModel) ConnectMapFromSource(f func(sourceIndex *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapFromSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapFromSource", f)
 	}
 }
 
 func (ptr *QAbstractProxyModel) DisconnectMapFromSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapFromSource")
+		qt.DisconnectSignal(ptr.Pointer(), "mapFromSource")
 	}
 }
 
@@ -4321,7 +4439,7 @@ func (ptr *QAbstractProxyModel) MapFromSource(sourceIndex QModelIndex_ITF) *QMod
 
 //export callbackQAbstractProxyModel_MapToSource
 func callbackQAbstractProxyModel_MapToSource(ptr unsafe.Pointer, proxyIndex unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapToSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapToSource"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(proxyIndex)))
 	}
 
@@ -4331,14 +4449,14 @@ func callbackQAbstractProxyModel_MapToSource(ptr unsafe.Pointer, proxyIndex unsa
 func (ptr *QAbstractProxyModel) ConnectMapToSource(f func(proxyIndex *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapToSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapToSource", f)
 	}
 }
 
 func (ptr *QAbstractProxyModel) DisconnectMapToSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapToSource")
+		qt.DisconnectSignal(ptr.Pointer(), "mapToSource")
 	}
 }
 
@@ -4352,25 +4470,31 @@ func (ptr *QAbstractProxyModel) MapToSource(proxyIndex QModelIndex_ITF) *QModelI
 }
 
 //export callbackQAbstractProxyModel_Data
-func callbackQAbstractProxyModel_Data(ptr unsafe.Pointer, proxyIndex unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
-		return PointerFromQVariant(signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(proxyIndex), int(int32(role))))
+func callbackQAbstractProxyModel_Data(ptr unsafe.Pointer, proxyIndex unsafe.Pointer, role C.int, ret unsafe.Pointer) {
+	if signal := qt.GetSignal(ptr, "dataInto"); signal != nil {
+		signal.(func(*QModelIndex, int, *QVariant))(NewQModelIndexFromPointer(proxyIndex), int(int32(role)), NewQVariantFromPointer(ret))
+		return
+	}
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
+		var tmpValue = signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(proxyIndex), int(int32(role)))
+		NewQVariantFromPointer(ret).Assign(tmpValue)
+		return
 	}
 
-	return PointerFromQVariant(NewQAbstractProxyModelFromPointer(ptr).DataDefault(NewQModelIndexFromPointer(proxyIndex), int(int32(role))))
+	C.QAbstractProxyModel_DataDefaultInto(ptr, proxyIndex, role, ret)
 }
 
 func (ptr *QAbstractProxyModel) ConnectData(f func(proxyIndex *QModelIndex, role int) *QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QAbstractProxyModel) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
@@ -4394,7 +4518,7 @@ func (ptr *QAbstractProxyModel) DataDefault(proxyIndex QModelIndex_ITF, role int
 
 //export callbackQAbstractProxyModel_Index
 func callbackQAbstractProxyModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(int, int, *QModelIndex) *QModelIndex)(int(int32(row)), int(int32(column)), NewQModelIndexFromPointer(parent)))
 	}
 
@@ -4421,7 +4545,7 @@ func (ptr *QAbstractProxyModel) IndexDefault(row int, column int, parent QModelI
 
 //export callbackQAbstractProxyModel_Parent
 func callbackQAbstractProxyModel_Parent(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(index)))
 	}
 
@@ -4448,7 +4572,7 @@ func (ptr *QAbstractProxyModel) ParentDefault(index QModelIndex_ITF) *QModelInde
 
 //export callbackQAbstractProxyModel_ColumnCount
 func callbackQAbstractProxyModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -4471,7 +4595,7 @@ func (ptr *QAbstractProxyModel) ColumnCountDefault(parent QModelIndex_ITF) int {
 
 //export callbackQAbstractProxyModel_RowCount
 func callbackQAbstractProxyModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -4532,7 +4656,7 @@ func NewQAbstractStateFromPointer(ptr unsafe.Pointer) *QAbstractState {
 }
 func NewQAbstractState(parent QState_ITF) *QAbstractState {
 	var tmpValue = NewQAbstractStateFromPointer(C.QAbstractState_NewQAbstractState(PointerFromQState(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4540,7 +4664,7 @@ func NewQAbstractState(parent QState_ITF) *QAbstractState {
 
 //export callbackQAbstractState_ActiveChanged
 func callbackQAbstractState_ActiveChanged(ptr unsafe.Pointer, active C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeChanged"); signal != nil {
 		signal.(func(bool))(int8(active) != 0)
 	}
 
@@ -4549,14 +4673,14 @@ func callbackQAbstractState_ActiveChanged(ptr unsafe.Pointer, active C.char) {
 func (ptr *QAbstractState) ConnectActiveChanged(f func(active bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractState_ConnectActiveChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeChanged", f)
 	}
 }
 
 func (ptr *QAbstractState) DisconnectActiveChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractState_DisconnectActiveChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "activeChanged")
 	}
 }
 
@@ -4568,7 +4692,7 @@ func (ptr *QAbstractState) ActiveChanged(active bool) {
 
 //export callbackQAbstractState_Entered
 func callbackQAbstractState_Entered(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "entered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "entered"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4577,20 +4701,20 @@ func callbackQAbstractState_Entered(ptr unsafe.Pointer) {
 func (ptr *QAbstractState) ConnectEntered(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractState_ConnectEntered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "entered", f)
+		qt.ConnectSignal(ptr.Pointer(), "entered", f)
 	}
 }
 
 func (ptr *QAbstractState) DisconnectEntered() {
 	if ptr.Pointer() != nil {
 		C.QAbstractState_DisconnectEntered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "entered")
+		qt.DisconnectSignal(ptr.Pointer(), "entered")
 	}
 }
 
 //export callbackQAbstractState_Exited
 func callbackQAbstractState_Exited(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "exited"); signal != nil {
+	if signal := qt.GetSignal(ptr, "exited"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4599,20 +4723,20 @@ func callbackQAbstractState_Exited(ptr unsafe.Pointer) {
 func (ptr *QAbstractState) ConnectExited(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractState_ConnectExited(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "exited", f)
+		qt.ConnectSignal(ptr.Pointer(), "exited", f)
 	}
 }
 
 func (ptr *QAbstractState) DisconnectExited() {
 	if ptr.Pointer() != nil {
 		C.QAbstractState_DisconnectExited(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "exited")
+		qt.DisconnectSignal(ptr.Pointer(), "exited")
 	}
 }
 
 //export callbackQAbstractState_OnEntry
 func callbackQAbstractState_OnEntry(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onEntry"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onEntry"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	}
 
@@ -4621,14 +4745,14 @@ func callbackQAbstractState_OnEntry(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QAbstractState) ConnectOnEntry(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onEntry", f)
+		qt.ConnectSignal(ptr.Pointer(), "onEntry", f)
 	}
 }
 
 func (ptr *QAbstractState) DisconnectOnEntry() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onEntry")
+		qt.DisconnectSignal(ptr.Pointer(), "onEntry")
 	}
 }
 
@@ -4640,7 +4764,7 @@ func (ptr *QAbstractState) OnEntry(event QEvent_ITF) {
 
 //export callbackQAbstractState_OnExit
 func callbackQAbstractState_OnExit(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onExit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onExit"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	}
 
@@ -4649,14 +4773,14 @@ func callbackQAbstractState_OnExit(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QAbstractState) ConnectOnExit(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onExit", f)
+		qt.ConnectSignal(ptr.Pointer(), "onExit", f)
 	}
 }
 
 func (ptr *QAbstractState) DisconnectOnExit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onExit")
+		qt.DisconnectSignal(ptr.Pointer(), "onExit")
 	}
 }
 
@@ -4669,7 +4793,7 @@ func (ptr *QAbstractState) OnExit(event QEvent_ITF) {
 func (ptr *QAbstractState) DestroyQAbstractState() {
 	if ptr.Pointer() != nil {
 		C.QAbstractState_DestroyQAbstractState(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4677,7 +4801,7 @@ func (ptr *QAbstractState) DestroyQAbstractState() {
 func (ptr *QAbstractState) ParentState() *QState {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQStateFromPointer(C.QAbstractState_ParentState(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4688,7 +4812,7 @@ func (ptr *QAbstractState) ParentState() *QState {
 func (ptr *QAbstractState) Machine() *QStateMachine {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQStateMachineFromPointer(C.QAbstractState_Machine(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4743,7 +4867,7 @@ func NewQAbstractTableModelFromPointer(ptr unsafe.Pointer) *QAbstractTableModel
 }
 func NewQAbstractTableModel(parent QObject_ITF) *QAbstractTableModel {
 	var tmpValue = NewQAbstractTableModelFromPointer(C.QAbstractTableModel_NewQAbstractTableModel(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4752,14 +4876,14 @@ func NewQAbstractTableModel(parent QObject_ITF) *QAbstractTableModel {
 func (ptr *QAbstractTableModel) DestroyQAbstractTableModel() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTableModel_DestroyQAbstractTableModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractTableModel_Index
 func callbackQAbstractTableModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(int, int, *QModelIndex) *QModelIndex)(int(int32(row)), int(int32(column)), NewQModelIndexFromPointer(parent)))
 	}
 
@@ -4769,14 +4893,14 @@ func callbackQAbstractTableModel_Index(ptr unsafe.Pointer, row C.int, column C.i
 func (ptr *QAbstractTableModel) ConnectIndex(f func(row int, column int, parent *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "index", f)
+		qt.ConnectSignal(ptr.Pointer(), "index", f)
 	}
 }
 
 func (ptr *QAbstractTableModel) DisconnectIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "index")
+		qt.DisconnectSignal(ptr.Pointer(), "index")
 	}
 }
 
@@ -4800,7 +4924,7 @@ func (ptr *QAbstractTableModel) IndexDefault(row int, column int, parent QModelI
 
 //export callbackQAbstractTableModel_Parent
 func callbackQAbstractTableModel_Parent(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(index)))
 	}
 
@@ -4826,12 +4950,18 @@ func (ptr *QAbstractTableModel) ParentDefault(index QModelIndex_ITF) *QModelInde
 }
 
 //export callbackQAbstractTableModel_Data
-func callbackQAbstractTableModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
-		return PointerFromQVariant(signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(index), int(int32(role))))
+func callbackQAbstractTableModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int, ret unsafe.Pointer) {
+	if signal := qt.GetSignal(ptr, "dataInto"); signal != nil {
+		signal.(func(*QModelIndex, int, *QVariant))(NewQModelIndexFromPointer(index), int(int32(role)), NewQVariantFromPointer(ret))
+		return
+	}
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
+		var tmpValue = signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(index), int(int32(role)))
+		NewQVariantFromPointer(ret).Assign(tmpValue)
+		return
 	}
 
-	return PointerFromQVariant(NewQAbstractTableModelFromPointer(ptr).DataDefault(NewQModelIndexFromPointer(index), int(int32(role))))
+	C.QAbstractTableModel_DataDefaultInto(ptr, index, role, ret)
 }
 
 func (ptr *QAbstractTableModel) Data(index QModelIndex_ITF, role int) *QVariant {
@@ -4854,7 +4984,7 @@ func (ptr *QAbstractTableModel) DataDefault(index QModelIndex_ITF, role int) *QV
 
 //export callbackQAbstractTableModel_ColumnCount
 func callbackQAbstractTableModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -4877,7 +5007,7 @@ func (ptr *QAbstractTableModel) ColumnCountDefault(parent QModelIndex_ITF) int {
 
 //export callbackQAbstractTableModel_RowCount
 func callbackQAbstractTableModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -4948,7 +5078,7 @@ const (
 
 func NewQAbstractTransition(sourceState QState_ITF) *QAbstractTransition {
 	var tmpValue = NewQAbstractTransitionFromPointer(C.QAbstractTransition_NewQAbstractTransition(PointerFromQState(sourceState)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4956,7 +5086,7 @@ func NewQAbstractTransition(sourceState QState_ITF) *QAbstractTransition {
 
 //export callbackQAbstractTransition_EventTest
 func callbackQAbstractTransition_EventTest(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventTest"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventTest"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QEvent) bool)(NewQEventFromPointer(event)))))
 	}
 
@@ -4966,14 +5096,14 @@ func callbackQAbstractTransition_EventTest(ptr unsafe.Pointer, event unsafe.Poin
 func (ptr *QAbstractTransition) ConnectEventTest(f func(event *QEvent) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "eventTest", f)
+		qt.ConnectSignal(ptr.Pointer(), "eventTest", f)
 	}
 }
 
 func (ptr *QAbstractTransition) DisconnectEventTest() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "eventTest")
+		qt.DisconnectSignal(ptr.Pointer(), "eventTest")
 	}
 }
 
@@ -4992,7 +5122,7 @@ func (ptr *QAbstractTransition) AddAnimation(animation QAbstractAnimation_ITF) {
 
 //export callbackQAbstractTransition_OnTransition
 func callbackQAbstractTransition_OnTransition(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onTransition"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onTransition"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	}
 
@@ -5001,14 +5131,14 @@ func callbackQAbstractTransition_OnTransition(ptr unsafe.Pointer, event unsafe.P
 func (ptr *QAbstractTransition) ConnectOnTransition(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onTransition", f)
+		qt.ConnectSignal(ptr.Pointer(), "onTransition", f)
 	}
 }
 
 func (ptr *QAbstractTransition) DisconnectOnTransition() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onTransition")
+		qt.DisconnectSignal(ptr.Pointer(), "onTransition")
 	}
 }
 
@@ -5050,7 +5180,7 @@ func (ptr *QAbstractTransition) SetTransitionType(ty QAbstractTransition__Transi
 
 //export callbackQAbstractTransition_TargetStateChanged
 func callbackQAbstractTransition_TargetStateChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "targetStateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "targetStateChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5059,20 +5189,20 @@ func callbackQAbstractTransition_TargetStateChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstractTransition) ConnectTargetStateChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractTransition_ConnectTargetStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "targetStateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "targetStateChanged", f)
 	}
 }
 
 func (ptr *QAbstractTransition) DisconnectTargetStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTransition_DisconnectTargetStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "targetStateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "targetStateChanged")
 	}
 }
 
 //export callbackQAbstractTransition_TargetStatesChanged
 func callbackQAbstractTransition_TargetStatesChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "targetStatesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "targetStatesChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5081,20 +5211,20 @@ func callbackQAbstractTransition_TargetStatesChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstractTransition) ConnectTargetStatesChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractTransition_ConnectTargetStatesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "targetStatesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "targetStatesChanged", f)
 	}
 }
 
 func (ptr *QAbstractTransition) DisconnectTargetStatesChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTransition_DisconnectTargetStatesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "targetStatesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "targetStatesChanged")
 	}
 }
 
 //export callbackQAbstractTransition_Triggered
 func callbackQAbstractTransition_Triggered(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "triggered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "triggered"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5103,20 +5233,20 @@ func callbackQAbstractTransition_Triggered(ptr unsafe.Pointer) {
 func (ptr *QAbstractTransition) ConnectTriggered(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractTransition_ConnectTriggered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "triggered", f)
+		qt.ConnectSignal(ptr.Pointer(), "triggered", f)
 	}
 }
 
 func (ptr *QAbstractTransition) DisconnectTriggered() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTransition_DisconnectTriggered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "triggered")
+		qt.DisconnectSignal(ptr.Pointer(), "triggered")
 	}
 }
 
 //export callbackQAbstractTransition_DestroyQAbstractTransition
 func callbackQAbstractTransition_DestroyQAbstractTransition(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractTransition"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractTransition"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractTransitionFromPointer(ptr).DestroyQAbstractTransitionDefault()
@@ -5126,21 +5256,21 @@ func callbackQAbstractTransition_DestroyQAbstractTransition(ptr unsafe.Pointer)
 func (ptr *QAbstractTransition) ConnectDestroyQAbstractTransition(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractTransition", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractTransition", f)
 	}
 }
 
 func (ptr *QAbstractTransition) DisconnectDestroyQAbstractTransition() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractTransition")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractTransition")
 	}
 }
 
 func (ptr *QAbstractTransition) DestroyQAbstractTransition() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTransition_DestroyQAbstractTransition(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5148,7 +5278,7 @@ func (ptr *QAbstractTransition) DestroyQAbstractTransition() {
 func (ptr *QAbstractTransition) DestroyQAbstractTransitionDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTransition_DestroyQAbstractTransitionDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5156,7 +5286,7 @@ func (ptr *QAbstractTransition) DestroyQAbstractTransitionDefault() {
 func (ptr *QAbstractTransition) TargetState() *QAbstractState {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractStateFromPointer(C.QAbstractTransition_TargetState(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5193,7 +5323,7 @@ func (ptr *QAbstractTransition) TargetStates() []*QAbstractState {
 func (ptr *QAbstractTransition) SourceState() *QState {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQStateFromPointer(C.QAbstractTransition_SourceState(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5204,7 +5334,7 @@ func (ptr *QAbstractTransition) SourceState() *QState {
 func (ptr *QAbstractTransition) Machine() *QStateMachine {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQStateMachineFromPointer(C.QAbstractTransition_Machine(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5222,7 +5352,7 @@ func (ptr *QAbstractTransition) TransitionType() QAbstractTransition__Transition
 func (ptr *QAbstractTransition) __setTargetStates_targets_atList(i int) *QAbstractState {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractStateFromPointer(C.QAbstractTransition___setTargetStates_targets_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5243,7 +5373,7 @@ func (ptr *QAbstractTransition) __setTargetStates_targets_newList() unsafe.Point
 func (ptr *QAbstractTransition) __animations_atList(i int) *QAbstractAnimation {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractAnimationFromPointer(C.QAbstractTransition___animations_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5264,7 +5394,7 @@ func (ptr *QAbstractTransition) __animations_newList() unsafe.Pointer {
 func (ptr *QAbstractTransition) __targetStates_atList(i int) *QAbstractState {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractStateFromPointer(C.QAbstractTransition___targetStates_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5323,7 +5453,7 @@ func NewQAnimationGroupFromPointer(ptr unsafe.Pointer) *QAnimationGroup {
 func (ptr *QAnimationGroup) TakeAnimation(index int) *QAbstractAnimation {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractAnimationFromPointer(C.QAnimationGroup_TakeAnimation(ptr.Pointer(), C.int(int32(index))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5333,7 +5463,7 @@ func (ptr *QAnimationGroup) TakeAnimation(index int) *QAbstractAnimation {
 
 func NewQAnimationGroup(parent QObject_ITF) *QAnimationGroup {
 	var tmpValue = NewQAnimationGroupFromPointer(C.QAnimationGroup_NewQAnimationGroup(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5366,7 +5496,7 @@ func (ptr *QAnimationGroup) RemoveAnimation(animation QAbstractAnimation_ITF) {
 func (ptr *QAnimationGroup) DestroyQAnimationGroup() {
 	if ptr.Pointer() != nil {
 		C.QAnimationGroup_DestroyQAnimationGroup(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5374,7 +5504,7 @@ func (ptr *QAnimationGroup) DestroyQAnimationGroup() {
 func (ptr *QAnimationGroup) AnimationAt(index int) *QAbstractAnimation {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractAnimationFromPointer(C.QAnimationGroup_AnimationAt(ptr.Pointer(), C.int(int32(index))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5398,7 +5528,7 @@ func (ptr *QAnimationGroup) IndexOfAnimation(animation QAbstractAnimation_ITF) i
 
 //export callbackQAnimationGroup_UpdateCurrentTime
 func callbackQAnimationGroup_UpdateCurrentTime(ptr unsafe.Pointer, currentTime C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateCurrentTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateCurrentTime"); signal != nil {
 		signal.(func(int))(int(int32(currentTime)))
 	} else {
 		NewQAnimationGroupFromPointer(ptr).UpdateCurrentTimeDefault(int(int32(currentTime)))
@@ -5419,7 +5549,7 @@ func (ptr *QAnimationGroup) UpdateCurrentTimeDefault(currentTime int) {
 
 //export callbackQAnimationGroup_Duration
 func callbackQAnimationGroup_Duration(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "duration"); signal != nil {
+	if signal := qt.GetSignal(ptr, "duration"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -5680,6 +5810,10 @@ func NewQBasicTimer() *QBasicTimer {
 	return tmpValue
 }
 
+func (arena *Arena) NewQBasicTimer() *QBasicTimer {
+	return NewQBasicTimerFromPointer(C.QBasicTimer_NewQBasicTimerInArena(arena.Pointer()))
+}
+
 func (ptr *QBasicTimer) Start(msec int, object QObject_ITF) {
 	if ptr.Pointer() != nil {
 		C.QBasicTimer_Start(ptr.Pointer(), C.int(int32(msec)), PointerFromQObject(object))
@@ -5770,24 +5904,40 @@ func NewQBitArray() *QBitArray {
 	return tmpValue
 }
 
+func (arena *Arena) NewQBitArray() *QBitArray {
+	return NewQBitArrayFromPointer(C.QBitArray_NewQBitArrayInArena(arena.Pointer()))
+}
+
 func NewQBitArray4(other QBitArray_ITF) *QBitArray {
 	var tmpValue = NewQBitArrayFromPointer(C.QBitArray_NewQBitArray4(PointerFromQBitArray(other)))
 	runtime.SetFinalizer(tmpValue, (*QBitArray).DestroyQBitArray)
 	return tmpValue
 }
 
+func (arena *Arena) NewQBitArray4(other QBitArray_ITF) *QBitArray {
+	return NewQBitArrayFromPointer(C.QBitArray_NewQBitArray4InArena(arena.Pointer(), PointerFromQBitArray(other)))
+}
+
 func NewQBitArray3(other QBitArray_ITF) *QBitArray {
 	var tmpValue = NewQBitArrayFromPointer(C.QBitArray_NewQBitArray3(PointerFromQBitArray(other)))
 	runtime.SetFinalizer(tmpValue, (*QBitArray).DestroyQBitArray)
 	return tmpValue
 }
 
+func (arena *Arena) NewQBitArray3(other QBitArray_ITF) *QBitArray {
+	return NewQBitArrayFromPointer(C.QBitArray_NewQBitArray3InArena(arena.Pointer(), PointerFromQBitArray(other)))
+}
+
 func NewQBitArray2(size int, value bool) *QBitArray {
 	var tmpValue = NewQBitArrayFromPointer(C.QBitArray_NewQBitArray2(C.int(int32(size)), C.char(int8(qt.GoBoolToInt(value)))))
 	runtime.SetFinalizer(tmpValue, (*QBitArray).DestroyQBitArray)
 	return tmpValue
 }
 
+func (arena *Arena) NewQBitArray2(size int, value bool) *QBitArray {
+	return NewQBitArrayFromPointer(C.QBitArray_NewQBitArray2InArena(arena.Pointer(), C.int(int32(size)), C.char(int8(qt.GoBoolToInt(value)))))
+}
+
 func (ptr *QBitArray) Fill(value bool, size int) bool {
 	if ptr.Pointer() != nil {
 		return C.QBitArray_Fill(ptr.Pointer(), C.char(int8(qt.GoBoolToInt(value))), C.int(int32(size))) != 0
@@ -5939,7 +6089,7 @@ func NewQBufferFromPointer(ptr unsafe.Pointer) *QBuffer {
 }
 func NewQBuffer2(byteArray QByteArray_ITF, parent QObject_ITF) *QBuffer {
 	var tmpValue = NewQBufferFromPointer(C.QBuffer_NewQBuffer2(PointerFromQByteArray(byteArray), PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5947,7 +6097,7 @@ func NewQBuffer2(byteArray QByteArray_ITF, parent QObject_ITF) *QBuffer {
 
 func NewQBuffer(parent QObject_ITF) *QBuffer {
 	var tmpValue = NewQBufferFromPointer(C.QBuffer_NewQBuffer(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5964,18 +6114,21 @@ func (ptr *QBuffer) Buffer() *QByteArray {
 
 //export callbackQBuffer_ReadData
 func callbackQBuffer_ReadData(ptr unsafe.Pointer, data C.struct_QtCore_PackedString, len C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "readData"); signal != nil {
 		var retS = cGoUnpackString(data)
 		var ret = C.longlong(signal.(func(*string, int64) int64)(&retS, int64(len)))
 		if ret > 0 {
-			C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+			copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 		}
 		return ret
 	}
 	var retS = cGoUnpackString(data)
 	var ret = C.longlong(NewQBufferFromPointer(ptr).ReadDataDefault(&retS, int64(len)))
 	if ret > 0 {
-		C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+		copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 	}
 	return ret
 }
@@ -5983,14 +6136,14 @@ func callbackQBuffer_ReadData(ptr unsafe.Pointer, data C.struct_QtCore_PackedStr
 func (ptr *QBuffer) ConnectReadData(f func(data *string, len int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readData", f)
+		qt.ConnectSignal(ptr.Pointer(), "readData", f)
 	}
 }
 
 func (ptr *QBuffer) DisconnectReadData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readData")
+		qt.DisconnectSignal(ptr.Pointer(), "readData")
 	}
 }
 
@@ -6022,7 +6175,10 @@ func (ptr *QBuffer) ReadDataDefault(data *string, len int64) int64 {
 
 //export callbackQBuffer_WriteData
 func callbackQBuffer_WriteData(ptr unsafe.Pointer, data C.struct_QtCore_PackedString, len C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "writeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "writeDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "writeData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(len)))
 	}
 
@@ -6032,14 +6188,14 @@ func callbackQBuffer_WriteData(ptr unsafe.Pointer, data C.struct_QtCore_PackedSt
 func (ptr *QBuffer) ConnectWriteData(f func(data string, len int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "writeData", f)
+		qt.ConnectSignal(ptr.Pointer(), "writeData", f)
 	}
 }
 
 func (ptr *QBuffer) DisconnectWriteData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "writeData")
+		qt.DisconnectSignal(ptr.Pointer(), "writeData")
 	}
 }
 
@@ -6084,7 +6240,7 @@ func (ptr *QBuffer) SetData2(data string, size int) {
 func (ptr *QBuffer) DestroyQBuffer() {
 	if ptr.Pointer() != nil {
 		C.QBuffer_DestroyQBuffer(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6740,18 +6896,30 @@ func NewQByteArray() *QByteArray {
 	return tmpValue
 }
 
+func (arena *Arena) NewQByteArray() *QByteArray {
+	return NewQByteArrayFromPointer(C.QByteArray_NewQByteArrayInArena(arena.Pointer()))
+}
+
 func NewQByteArray6(other QByteArray_ITF) *QByteArray {
 	var tmpValue = NewQByteArrayFromPointer(C.QByteArray_NewQByteArray6(PointerFromQByteArray(other)))
 	runtime.SetFinalizer(tmpValue, (*QByteArray).DestroyQByteArray)
 	return tmpValue
 }
 
+func (arena *Arena) NewQByteArray6(other QByteArray_ITF) *QByteArray {
+	return NewQByteArrayFromPointer(C.QByteArray_NewQByteArray6InArena(arena.Pointer(), PointerFromQByteArray(other)))
+}
+
 func NewQByteArray5(other QByteArray_ITF) *QByteArray {
 	var tmpValue = NewQByteArrayFromPointer(C.QByteArray_NewQByteArray5(PointerFromQByteArray(other)))
 	runtime.SetFinalizer(tmpValue, (*QByteArray).DestroyQByteArray)
 	return tmpValue
 }
 
+func (arena *Arena) NewQByteArray5(other QByteArray_ITF) *QByteArray {
+	return NewQByteArrayFromPointer(C.QByteArray_NewQByteArray5InArena(arena.Pointer(), PointerFromQByteArray(other)))
+}
+
 func NewQByteArray2(data string, size int) *QByteArray {
 	var dataC = C.CString(data)
 	defer C.free(unsafe.Pointer(dataC))
@@ -6760,6 +6928,12 @@ func NewQByteArray2(data string, size int) *QByteArray {
 	return tmpValue
 }
 
+func (arena *Arena) NewQByteArray2(data string, size int) *QByteArray {
+	var dataC = C.CString(data)
+	defer C.free(unsafe.Pointer(dataC))
+	return NewQByteArrayFromPointer(C.QByteArray_NewQByteArray2InArena(arena.Pointer(), dataC, C.int(int32(size))))
+}
+
 func NewQByteArray3(size int, ch string) *QByteArray {
 	var chC = C.CString(ch)
 	defer C.free(unsafe.Pointer(chC))
@@ -6768,6 +6942,12 @@ func NewQByteArray3(size int, ch string) *QByteArray {
 	return tmpValue
 }
 
+func (arena *Arena) NewQByteArray3(size int, ch string) *QByteArray {
+	var chC = C.CString(ch)
+	defer C.free(unsafe.Pointer(chC))
+	return NewQByteArrayFromPointer(C.QByteArray_NewQByteArray3InArena(arena.Pointer(), C.int(int32(size)), chC))
+}
+
 func (ptr *QByteArray) Data() string {
 	if ptr.Pointer() != nil {
 		return cGoUnpackString(C.QByteArray_Data(ptr.Pointer()))
@@ -7004,13 +7184,13 @@ func (ptr *QByteArray) Split(sep string) []*QByteArray {
 	if ptr.Pointer() != nil {
 		var sepC = C.CString(sep)
 		defer C.free(unsafe.Pointer(sepC))
-		return func(l C.struct_QtCore_PackedList) []*QByteArray {
-			var out = make([]*QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQByteArrayFromPointer(l.data).__split_atList(i)
+		return func(l []string) []*QByteArray {
+			var out = make([]*QByteArray, len(l))
+			for i, v := range l {
+				out[i] = NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QByteArray_Split(ptr.Pointer(), sepC))
+		}(cGoUnpackStringListAndFree(C.QByteArray_Split(ptr.Pointer(), sepC)))
 	}
 	return make([]*QByteArray, 0)
 }
@@ -7453,18 +7633,30 @@ func NewQByteArrayMatcher() *QByteArrayMatcher {
 	return tmpValue
 }
 
+func (arena *Arena) NewQByteArrayMatcher() *QByteArrayMatcher {
+	return NewQByteArrayMatcherFromPointer(C.QByteArrayMatcher_NewQByteArrayMatcherInArena(arena.Pointer()))
+}
+
 func NewQByteArrayMatcher2(pattern QByteArray_ITF) *QByteArrayMatcher {
 	var tmpValue = NewQByteArrayMatcherFromPointer(C.QByteArrayMatcher_NewQByteArrayMatcher2(PointerFromQByteArray(pattern)))
 	runtime.SetFinalizer(tmpValue, (*QByteArrayMatcher).DestroyQByteArrayMatcher)
 	return tmpValue
 }
 
+func (arena *Arena) NewQByteArrayMatcher2(pattern QByteArray_ITF) *QByteArrayMatcher {
+	return NewQByteArrayMatcherFromPointer(C.QByteArrayMatcher_NewQByteArrayMatcher2InArena(arena.Pointer(), PointerFromQByteArray(pattern)))
+}
+
 func NewQByteArrayMatcher4(other QByteArrayMatcher_ITF) *QByteArrayMatcher {
 	var tmpValue = NewQByteArrayMatcherFromPointer(C.QByteArrayMatcher_NewQByteArrayMatcher4(PointerFromQByteArrayMatcher(other)))
 	runtime.SetFinalizer(tmpValue, (*QByteArrayMatcher).DestroyQByteArrayMatcher)
 	return tmpValue
 }
 
+func (arena *Arena) NewQByteArrayMatcher4(other QByteArrayMatcher_ITF) *QByteArrayMatcher {
+	return NewQByteArrayMatcherFromPointer(C.QByteArrayMatcher_NewQByteArrayMatcher4InArena(arena.Pointer(), PointerFromQByteArrayMatcher(other)))
+}
+
 func NewQByteArrayMatcher3(pattern string, length int) *QByteArrayMatcher {
 	var patternC = C.CString(pattern)
 	defer C.free(unsafe.Pointer(patternC))
@@ -7473,6 +7665,12 @@ func NewQByteArrayMatcher3(pattern string, length int) *QByteArrayMatcher {
 	return tmpValue
 }
 
+func (arena *Arena) NewQByteArrayMatcher3(pattern string, length int) *QByteArrayMatcher {
+	var patternC = C.CString(pattern)
+	defer C.free(unsafe.Pointer(patternC))
+	return NewQByteArrayMatcherFromPointer(C.QByteArrayMatcher_NewQByteArrayMatcher3InArena(arena.Pointer(), patternC, C.int(int32(length))))
+}
+
 func (ptr *QByteArrayMatcher) SetPattern(pattern QByteArray_ITF) {
 	if ptr.Pointer() != nil {
 		C.QByteArrayMatcher_SetPattern(ptr.Pointer(), PointerFromQByteArray(pattern))
@@ -7939,18 +8137,30 @@ func NewQChar() *QChar {
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar() *QChar {
+	return NewQCharFromPointer(C.QChar_NewQCharInArena(arena.Pointer()))
+}
+
 func NewQChar8(ch QLatin1Char_ITF) *QChar {
 	var tmpValue = NewQCharFromPointer(C.QChar_NewQChar8(PointerFromQLatin1Char(ch)))
 	runtime.SetFinalizer(tmpValue, (*QChar).DestroyQChar)
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar8(ch QLatin1Char_ITF) *QChar {
+	return NewQCharFromPointer(C.QChar_NewQChar8InArena(arena.Pointer(), PointerFromQLatin1Char(ch)))
+}
+
 func NewQChar7(ch QChar__SpecialCharacter) *QChar {
 	var tmpValue = NewQCharFromPointer(C.QChar_NewQChar7(C.longlong(ch)))
 	runtime.SetFinalizer(tmpValue, (*QChar).DestroyQChar)
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar7(ch QChar__SpecialCharacter) *QChar {
+	return NewQCharFromPointer(C.QChar_NewQChar7InArena(arena.Pointer(), C.longlong(ch)))
+}
+
 func NewQChar9(ch string) *QChar {
 	var chC = C.CString(ch)
 	defer C.free(unsafe.Pointer(chC))
@@ -7959,18 +8169,32 @@ func NewQChar9(ch string) *QChar {
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar9(ch string) *QChar {
+	var chC = C.CString(ch)
+	defer C.free(unsafe.Pointer(chC))
+	return NewQCharFromPointer(C.QChar_NewQChar9InArena(arena.Pointer(), chC))
+}
+
 func NewQChar6(code int) *QChar {
 	var tmpValue = NewQCharFromPointer(C.QChar_NewQChar6(C.int(int32(code))))
 	runtime.SetFinalizer(tmpValue, (*QChar).DestroyQChar)
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar6(code int) *QChar {
+	return NewQCharFromPointer(C.QChar_NewQChar6InArena(arena.Pointer(), C.int(int32(code))))
+}
+
 func NewQChar4(code int16) *QChar {
 	var tmpValue = NewQCharFromPointer(C.QChar_NewQChar4(C.short(code)))
 	runtime.SetFinalizer(tmpValue, (*QChar).DestroyQChar)
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar4(code int16) *QChar {
+	return NewQCharFromPointer(C.QChar_NewQChar4InArena(arena.Pointer(), C.short(code)))
+}
+
 func NewQChar3(cell string, row string) *QChar {
 	var cellC = C.CString(cell)
 	defer C.free(unsafe.Pointer(cellC))
@@ -7981,6 +8205,14 @@ func NewQChar3(cell string, row string) *QChar {
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar3(cell string, row string) *QChar {
+	var cellC = C.CString(cell)
+	defer C.free(unsafe.Pointer(cellC))
+	var rowC = C.CString(row)
+	defer C.free(unsafe.Pointer(rowC))
+	return NewQCharFromPointer(C.QChar_NewQChar3InArena(arena.Pointer(), cellC, rowC))
+}
+
 func NewQChar10(ch string) *QChar {
 	var chC = C.CString(ch)
 	defer C.free(unsafe.Pointer(chC))
@@ -7989,18 +8221,32 @@ func NewQChar10(ch string) *QChar {
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar10(ch string) *QChar {
+	var chC = C.CString(ch)
+	defer C.free(unsafe.Pointer(chC))
+	return NewQCharFromPointer(C.QChar_NewQChar10InArena(arena.Pointer(), chC))
+}
+
 func NewQChar5(code uint) *QChar {
 	var tmpValue = NewQCharFromPointer(C.QChar_NewQChar5(C.uint(uint32(code))))
 	runtime.SetFinalizer(tmpValue, (*QChar).DestroyQChar)
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar5(code uint) *QChar {
+	return NewQCharFromPointer(C.QChar_NewQChar5InArena(arena.Pointer(), C.uint(uint32(code))))
+}
+
 func NewQChar2(code uint16) *QChar {
 	var tmpValue = NewQCharFromPointer(C.QChar_NewQChar2(C.ushort(code)))
 	runtime.SetFinalizer(tmpValue, (*QChar).DestroyQChar)
 	return tmpValue
 }
 
+func (arena *Arena) NewQChar2(code uint16) *QChar {
+	return NewQCharFromPointer(C.QChar_NewQChar2InArena(arena.Pointer(), C.ushort(code)))
+}
+
 func QChar_Decomposition2(ucs4 uint) string {
 	return cGoUnpackString(C.QChar_QChar_Decomposition2(C.uint(uint32(ucs4))))
 }
@@ -8561,7 +8807,7 @@ func NewQChildEventFromPointer(ptr unsafe.Pointer) *QChildEvent {
 func (ptr *QChildEvent) DestroyQChildEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8573,7 +8819,7 @@ func NewQChildEvent(ty QEvent__Type, child QObject_ITF) *QChildEvent {
 func (ptr *QChildEvent) Child() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QChildEvent_Child(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8605,7 +8851,7 @@ func (ptr *QChildEvent) Removed() bool {
 func (ptr *QChildEvent) C() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QChildEvent_C(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8662,18 +8908,30 @@ func NewQCollator3(other QCollator_ITF) *QCollator {
 	return tmpValue
 }
 
+func (arena *Arena) NewQCollator3(other QCollator_ITF) *QCollator {
+	return NewQCollatorFromPointer(C.QCollator_NewQCollator3InArena(arena.Pointer(), PointerFromQCollator(other)))
+}
+
 func NewQCollator2(other QCollator_ITF) *QCollator {
 	var tmpValue = NewQCollatorFromPointer(C.QCollator_NewQCollator2(PointerFromQCollator(other)))
 	runtime.SetFinalizer(tmpValue, (*QCollator).DestroyQCollator)
 	return tmpValue
 }
 
+func (arena *Arena) NewQCollator2(other QCollator_ITF) *QCollator {
+	return NewQCollatorFromPointer(C.QCollator_NewQCollator2InArena(arena.Pointer(), PointerFromQCollator(other)))
+}
+
 func NewQCollator(locale QLocale_ITF) *QCollator {
 	var tmpValue = NewQCollatorFromPointer(C.QCollator_NewQCollator(PointerFromQLocale(locale)))
 	runtime.SetFinalizer(tmpValue, (*QCollator).DestroyQCollator)
 	return tmpValue
 }
 
+func (arena *Arena) NewQCollator(locale QLocale_ITF) *QCollator {
+	return NewQCollatorFromPointer(C.QCollator_NewQCollatorInArena(arena.Pointer(), PointerFromQLocale(locale)))
+}
+
 func (ptr *QCollator) SetCaseSensitivity(sensitivity Qt__CaseSensitivity) {
 	if ptr.Pointer() != nil {
 		C.QCollator_SetCaseSensitivity(ptr.Pointer(), C.longlong(sensitivity))
@@ -8820,6 +9078,10 @@ func NewQCollatorSortKey(other QCollatorSortKey_ITF) *QCollatorSortKey {
 	return tmpValue
 }
 
+func (arena *Arena) NewQCollatorSortKey(other QCollatorSortKey_ITF) *QCollatorSortKey {
+	return NewQCollatorSortKeyFromPointer(C.QCollatorSortKey_NewQCollatorSortKeyInArena(arena.Pointer(), PointerFromQCollatorSortKey(other)))
+}
+
 func (ptr *QCollatorSortKey) Swap(other QCollatorSortKey_ITF) {
 	if ptr.Pointer() != nil {
 		C.QCollatorSortKey_Swap(ptr.Pointer(), PointerFromQCollatorSortKey(other))
@@ -8893,6 +9155,10 @@ func NewQCommandLineOption5(other QCommandLineOption_ITF) *QCommandLineOption {
 	return tmpValue
 }
 
+func (arena *Arena) NewQCommandLineOption5(other QCommandLineOption_ITF) *QCommandLineOption {
+	return NewQCommandLineOptionFromPointer(C.QCommandLineOption_NewQCommandLineOption5InArena(arena.Pointer(), PointerFromQCommandLineOption(other)))
+}
+
 func NewQCommandLineOption(name string) *QCommandLineOption {
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
@@ -8901,6 +9167,12 @@ func NewQCommandLineOption(name string) *QCommandLineOption {
 	return tmpValue
 }
 
+func (arena *Arena) NewQCommandLineOption(name string) *QCommandLineOption {
+	var nameC = C.CString(name)
+	defer C.free(unsafe.Pointer(nameC))
+	return NewQCommandLineOptionFromPointer(C.QCommandLineOption_NewQCommandLineOptionInArena(arena.Pointer(), nameC))
+}
+
 func NewQCommandLineOption3(name string, description string, valueName string, defaultValue string) *QCommandLineOption {
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
@@ -8915,16 +9187,34 @@ func NewQCommandLineOption3(name string, description string, valueName string, d
 	return tmpValue
 }
 
+func (arena *Arena) NewQCommandLineOption3(name string, description string, valueName string, defaultValue string) *QCommandLineOption {
+	var nameC = C.CString(name)
+	defer C.free(unsafe.Pointer(nameC))
+	var descriptionC = C.CString(description)
+	defer C.free(unsafe.Pointer(descriptionC))
+	var valueNameC = C.CString(valueName)
+	defer C.free(unsafe.Pointer(valueNameC))
+	var defaultValueC = C.CString(defaultValue)
+	defer C.free(unsafe.Pointer(defaultValueC))
+	return NewQCommandLineOptionFromPointer(C.QCommandLineOption_NewQCommandLineOption3InArena(arena.Pointer(), nameC, descriptionC, valueNameC, defaultValueC))
+}
+
 func NewQCommandLineOption2(names []string) *QCommandLineOption {
-	var namesC = C.CString(strings.Join(names, "|"))
+	var namesC = cGoPackStringList(names)
 	defer C.free(unsafe.Pointer(namesC))
 	var tmpValue = NewQCommandLineOptionFromPointer(C.QCommandLineOption_NewQCommandLineOption2(namesC))
 	runtime.SetFinalizer(tmpValue, (*QCommandLineOption).DestroyQCommandLineOption)
 	return tmpValue
 }
 
+func (arena *Arena) NewQCommandLineOption2(names []string) *QCommandLineOption {
+	var namesC = cGoPackStringList(names)
+	defer C.free(unsafe.Pointer(namesC))
+	return NewQCommandLineOptionFromPointer(C.QCommandLineOption_NewQCommandLineOption2InArena(arena.Pointer(), namesC))
+}
+
 func NewQCommandLineOption4(names []string, description string, valueName string, defaultValue string) *QCommandLineOption {
-	var namesC = C.CString(strings.Join(names, "|"))
+	var namesC = cGoPackStringList(names)
 	defer C.free(unsafe.Pointer(namesC))
 	var descriptionC = C.CString(description)
 	defer C.free(unsafe.Pointer(descriptionC))
@@ -8937,6 +9227,18 @@ func NewQCommandLineOption4(names []string, description string, valueName string
 	return tmpValue
 }
 
+func (arena *Arena) NewQCommandLineOption4(names []string, description string, valueName string, defaultValue string) *QCommandLineOption {
+	var namesC = cGoPackStringList(names)
+	defer C.free(unsafe.Pointer(namesC))
+	var descriptionC = C.CString(description)
+	defer C.free(unsafe.Pointer(descriptionC))
+	var valueNameC = C.CString(valueName)
+	defer C.free(unsafe.Pointer(valueNameC))
+	var defaultValueC = C.CString(defaultValue)
+	defer C.free(unsafe.Pointer(defaultValueC))
+	return NewQCommandLineOptionFromPointer(C.QCommandLineOption_NewQCommandLineOption4InArena(arena.Pointer(), namesC, descriptionC, valueNameC, defaultValueC))
+}
+
 func (ptr *QCommandLineOption) SetDefaultValue(defaultValue string) {
 	if ptr.Pointer() != nil {
 		var defaultValueC = C.CString(defaultValue)
@@ -8947,7 +9249,7 @@ func (ptr *QCommandLineOption) SetDefaultValue(defaultValue string) {
 
 func (ptr *QCommandLineOption) SetDefaultValues(defaultValues []string) {
 	if ptr.Pointer() != nil {
-		var defaultValuesC = C.CString(strings.Join(defaultValues, "|"))
+		var defaultValuesC = cGoPackStringList(defaultValues)
 		defer C.free(unsafe.Pointer(defaultValuesC))
 		C.QCommandLineOption_SetDefaultValues(ptr.Pointer(), defaultValuesC)
 	}
@@ -9011,14 +9313,14 @@ func (ptr *QCommandLineOption) ValueName() string {
 
 func (ptr *QCommandLineOption) DefaultValues() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QCommandLineOption_DefaultValues(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QCommandLineOption_DefaultValues(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QCommandLineOption) Names() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QCommandLineOption_Names(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QCommandLineOption_Names(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -9103,6 +9405,10 @@ func NewQCommandLineParser() *QCommandLineParser {
 	return tmpValue
 }
 
+func (arena *Arena) NewQCommandLineParser() *QCommandLineParser {
+	return NewQCommandLineParserFromPointer(C.QCommandLineParser_NewQCommandLineParserInArena(arena.Pointer()))
+}
+
 func (ptr *QCommandLineParser) AddOption(option QCommandLineOption_ITF) bool {
 	if ptr.Pointer() != nil {
 		return C.QCommandLineParser_AddOption(ptr.Pointer(), PointerFromQCommandLineOption(option)) != 0
@@ -9125,7 +9431,7 @@ func (ptr *QCommandLineParser) AddOptions(options []*QCommandLineOption) bool {
 
 func (ptr *QCommandLineParser) Parse(arguments []string) bool {
 	if ptr.Pointer() != nil {
-		var argumentsC = C.CString(strings.Join(arguments, "|"))
+		var argumentsC = cGoPackStringList(arguments)
 		defer C.free(unsafe.Pointer(argumentsC))
 		return C.QCommandLineParser_Parse(ptr.Pointer(), argumentsC) != 0
 	}
@@ -9158,7 +9464,7 @@ func (ptr *QCommandLineParser) Process2(app QCoreApplication_ITF) {
 
 func (ptr *QCommandLineParser) Process(arguments []string) {
 	if ptr.Pointer() != nil {
-		var argumentsC = C.CString(strings.Join(arguments, "|"))
+		var argumentsC = cGoPackStringList(arguments)
 		defer C.free(unsafe.Pointer(argumentsC))
 		C.QCommandLineParser_Process(ptr.Pointer(), argumentsC)
 	}
@@ -9242,28 +9548,28 @@ func (ptr *QCommandLineParser) Value(optionName string) string {
 
 func (ptr *QCommandLineParser) OptionNames() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QCommandLineParser_OptionNames(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QCommandLineParser_OptionNames(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QCommandLineParser) PositionalArguments() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QCommandLineParser_PositionalArguments(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QCommandLineParser_PositionalArguments(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QCommandLineParser) UnknownOptionNames() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QCommandLineParser_UnknownOptionNames(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QCommandLineParser_UnknownOptionNames(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QCommandLineParser) Values2(option QCommandLineOption_ITF) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QCommandLineParser_Values2(ptr.Pointer(), PointerFromQCommandLineOption(option))), "|")
+		return cGoUnpackStringListAndFree(C.QCommandLineParser_Values2(ptr.Pointer(), PointerFromQCommandLineOption(option)))
 	}
 	return make([]string, 0)
 }
@@ -9272,7 +9578,7 @@ func (ptr *QCommandLineParser) Values(optionName string) []string {
 	if ptr.Pointer() != nil {
 		var optionNameC = C.CString(optionName)
 		defer C.free(unsafe.Pointer(optionNameC))
-		return strings.Split(cGoUnpackString(C.QCommandLineParser_Values(ptr.Pointer(), optionNameC)), "|")
+		return cGoUnpackStringListAndFree(C.QCommandLineParser_Values(ptr.Pointer(), optionNameC))
 	}
 	return make([]string, 0)
 }
@@ -9398,7 +9704,7 @@ func (ptr *QCoreApplication) OrganizationDomain() string {
 
 func QCoreApplication_EventDispatcher() *QAbstractEventDispatcher {
 	var tmpValue = NewQAbstractEventDispatcherFromPointer(C.QCoreApplication_QCoreApplication_EventDispatcher())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -9406,7 +9712,7 @@ func QCoreApplication_EventDispatcher() *QAbstractEventDispatcher {
 
 func (ptr *QCoreApplication) EventDispatcher() *QAbstractEventDispatcher {
 	var tmpValue = NewQAbstractEventDispatcherFromPointer(C.QCoreApplication_QCoreApplication_EventDispatcher())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -9414,7 +9720,7 @@ func (ptr *QCoreApplication) EventDispatcher() *QAbstractEventDispatcher {
 
 func QCoreApplication_Instance() *QCoreApplication {
 	var tmpValue = NewQCoreApplicationFromPointer(C.QCoreApplication_QCoreApplication_Instance())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -9422,17 +9728,17 @@ func QCoreApplication_Instance() *QCoreApplication {
 
 func (ptr *QCoreApplication) Instance() *QCoreApplication {
 	var tmpValue = NewQCoreApplicationFromPointer(C.QCoreApplication_QCoreApplication_Instance())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
 }
 
 func NewQCoreApplication(argc int, argv []string) *QCoreApplication {
-	var argvC = C.CString(strings.Join(argv, "|"))
+	var argvC = cGoPackStringList(argv)
 	defer C.free(unsafe.Pointer(argvC))
 	var tmpValue = NewQCoreApplicationFromPointer(C.QCoreApplication_NewQCoreApplication(C.int(int32(argc)), argvC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -9499,19 +9805,19 @@ func (ptr *QCoreApplication) Translate(context string, sourceText string, disamb
 }
 
 func QCoreApplication_Arguments() []string {
-	return strings.Split(cGoUnpackString(C.QCoreApplication_QCoreApplication_Arguments()), "|")
+	return cGoUnpackStringListAndFree(C.QCoreApplication_QCoreApplication_Arguments())
 }
 
 func (ptr *QCoreApplication) Arguments() []string {
-	return strings.Split(cGoUnpackString(C.QCoreApplication_QCoreApplication_Arguments()), "|")
+	return cGoUnpackStringListAndFree(C.QCoreApplication_QCoreApplication_Arguments())
 }
 
 func QCoreApplication_LibraryPaths() []string {
-	return strings.Split(cGoUnpackString(C.QCoreApplication_QCoreApplication_LibraryPaths()), "|")
+	return cGoUnpackStringListAndFree(C.QCoreApplication_QCoreApplication_LibraryPaths())
 }
 
 func (ptr *QCoreApplication) LibraryPaths() []string {
-	return strings.Split(cGoUnpackString(C.QCoreApplication_QCoreApplication_LibraryPaths()), "|")
+	return cGoUnpackStringListAndFree(C.QCoreApplication_QCoreApplication_LibraryPaths())
 }
 
 func QCoreApplication_ClosingDown() bool {
@@ -9596,7 +9902,7 @@ func (ptr *QCoreApplication) ApplicationPid() int64 {
 
 //export callbackQCoreApplication_AboutToQuit
 func callbackQCoreApplication_AboutToQuit(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aboutToQuit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aboutToQuit"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9605,14 +9911,14 @@ func callbackQCoreApplication_AboutToQuit(ptr unsafe.Pointer) {
 func (ptr *QCoreApplication) ConnectAboutToQuit(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCoreApplication_ConnectAboutToQuit(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "aboutToQuit", f)
+		qt.ConnectSignal(ptr.Pointer(), "aboutToQuit", f)
 	}
 }
 
 func (ptr *QCoreApplication) DisconnectAboutToQuit() {
 	if ptr.Pointer() != nil {
 		C.QCoreApplication_DisconnectAboutToQuit(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "aboutToQuit")
+		qt.DisconnectSignal(ptr.Pointer(), "aboutToQuit")
 	}
 }
 
@@ -9676,7 +9982,7 @@ func (ptr *QCoreApplication) ProcessEvents2(flags QEventLoop__ProcessEventsFlag,
 
 //export callbackQCoreApplication_Quit
 func callbackQCoreApplication_Quit(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "quit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "quit"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQCoreApplicationFromPointer(ptr).QuitDefault()
@@ -9686,14 +9992,14 @@ func callbackQCoreApplication_Quit(ptr unsafe.Pointer) {
 func (ptr *QCoreApplication) ConnectQuit(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "quit", f)
+		qt.ConnectSignal(ptr.Pointer(), "quit", f)
 	}
 }
 
 func (ptr *QCoreApplication) DisconnectQuit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "quit")
+		qt.DisconnectSignal(ptr.Pointer(), "quit")
 	}
 }
 
@@ -9784,13 +10090,13 @@ func (ptr *QCoreApplication) SetEventDispatcher(eventDispatcher QAbstractEventDi
 }
 
 func QCoreApplication_SetLibraryPaths(paths []string) {
-	var pathsC = C.CString(strings.Join(paths, "|"))
+	var pathsC = cGoPackStringList(paths)
 	defer C.free(unsafe.Pointer(pathsC))
 	C.QCoreApplication_QCoreApplication_SetLibraryPaths(pathsC)
 }
 
 func (ptr *QCoreApplication) SetLibraryPaths(paths []string) {
-	var pathsC = C.CString(strings.Join(paths, "|"))
+	var pathsC = cGoPackStringList(paths)
 	defer C.free(unsafe.Pointer(pathsC))
 	C.QCoreApplication_QCoreApplication_SetLibraryPaths(pathsC)
 }
@@ -9838,7 +10144,7 @@ func (ptr *QCoreApplication) SetSetuidAllowed(allow bool) {
 func (ptr *QCoreApplication) DestroyQCoreApplication() {
 	if ptr.Pointer() != nil {
 		C.QCoreApplication_DestroyQCoreApplication(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9925,6 +10231,10 @@ func NewQCryptographicHash(method QCryptographicHash__Algorithm) *QCryptographic
 	return tmpValue
 }
 
+func (arena *Arena) NewQCryptographicHash(method QCryptographicHash__Algorithm) *QCryptographicHash {
+	return NewQCryptographicHashFromPointer(C.QCryptographicHash_NewQCryptographicHashInArena(arena.Pointer(), C.longlong(method)))
+}
+
 func (ptr *QCryptographicHash) AddData3(device QIODevice_ITF) bool {
 	if ptr.Pointer() != nil {
 		return C.QCryptographicHash_AddData3(ptr.Pointer(), PointerFromQIODevice(device)) != 0
@@ -10074,24 +10384,40 @@ func NewQDataStream() *QDataStream {
 	return tmpValue
 }
 
+func (arena *Arena) NewQDataStream() *QDataStream {
+	return NewQDataStreamFromPointer(C.QDataStream_NewQDataStreamInArena(arena.Pointer()))
+}
+
 func NewQDataStream3(a QByteArray_ITF, mode QIODevice__OpenModeFlag) *QDataStream {
 	var tmpValue = NewQDataStreamFromPointer(C.QDataStream_NewQDataStream3(PointerFromQByteArray(a), C.longlong(mode)))
 	runtime.SetFinalizer(tmpValue, (*QDataStream).DestroyQDataStream)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDataStream3(a QByteArray_ITF, mode QIODevice__OpenModeFlag) *QDataStream {
+	return NewQDataStreamFromPointer(C.QDataStream_NewQDataStream3InArena(arena.Pointer(), PointerFromQByteArray(a), C.longlong(mode)))
+}
+
 func NewQDataStream2(d QIODevice_ITF) *QDataStream {
 	var tmpValue = NewQDataStreamFromPointer(C.QDataStream_NewQDataStream2(PointerFromQIODevice(d)))
 	runtime.SetFinalizer(tmpValue, (*QDataStream).DestroyQDataStream)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDataStream2(d QIODevice_ITF) *QDataStream {
+	return NewQDataStreamFromPointer(C.QDataStream_NewQDataStream2InArena(arena.Pointer(), PointerFromQIODevice(d)))
+}
+
 func NewQDataStream4(a QByteArray_ITF) *QDataStream {
 	var tmpValue = NewQDataStreamFromPointer(C.QDataStream_NewQDataStream4(PointerFromQByteArray(a)))
 	runtime.SetFinalizer(tmpValue, (*QDataStream).DestroyQDataStream)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDataStream4(a QByteArray_ITF) *QDataStream {
+	return NewQDataStreamFromPointer(C.QDataStream_NewQDataStream4InArena(arena.Pointer(), PointerFromQByteArray(a)))
+}
+
 func (ptr *QDataStream) CommitTransaction() bool {
 	if ptr.Pointer() != nil {
 		return C.QDataStream_CommitTransaction(ptr.Pointer()) != 0
@@ -10202,7 +10528,7 @@ func (ptr *QDataStream) FloatingPointPrecision() QDataStream__FloatingPointPreci
 func (ptr *QDataStream) Device() *QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQIODeviceFromPointer(C.QDataStream_Device(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10351,12 +10677,20 @@ func NewQDate() *QDate {
 	return tmpValue
 }
 
+func (arena *Arena) NewQDate() *QDate {
+	return NewQDateFromPointer(C.QDate_NewQDateInArena(arena.Pointer()))
+}
+
 func NewQDate3(y int, m int, d int) *QDate {
 	var tmpValue = NewQDateFromPointer(C.QDate_NewQDate3(C.int(int32(y)), C.int(int32(m)), C.int(int32(d))))
 	runtime.SetFinalizer(tmpValue, (*QDate).DestroyQDate)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDate3(y int, m int, d int) *QDate {
+	return NewQDateFromPointer(C.QDate_NewQDate3InArena(arena.Pointer(), C.int(int32(y)), C.int(int32(m)), C.int(int32(d))))
+}
+
 func QDate_LongDayName(weekday int, ty QDate__MonthNameType) string {
 	return cGoUnpackString(C.QDate_QDate_LongDayName(C.int(int32(weekday)), C.longlong(ty)))
 }
@@ -10708,42 +11042,70 @@ func NewQDateTime() *QDateTime {
 	return tmpValue
 }
 
+func (arena *Arena) NewQDateTime() *QDateTime {
+	return NewQDateTimeFromPointer(C.QDateTime_NewQDateTimeInArena(arena.Pointer()))
+}
+
 func NewQDateTime7(other QDateTime_ITF) *QDateTime {
 	var tmpValue = NewQDateTimeFromPointer(C.QDateTime_NewQDateTime7(PointerFromQDateTime(other)))
 	runtime.SetFinalizer(tmpValue, (*QDateTime).DestroyQDateTime)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDateTime7(other QDateTime_ITF) *QDateTime {
+	return NewQDateTimeFromPointer(C.QDateTime_NewQDateTime7InArena(arena.Pointer(), PointerFromQDateTime(other)))
+}
+
 func NewQDateTime2(date QDate_ITF) *QDateTime {
 	var tmpValue = NewQDateTimeFromPointer(C.QDateTime_NewQDateTime2(PointerFromQDate(date)))
 	runtime.SetFinalizer(tmpValue, (*QDateTime).DestroyQDateTime)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDateTime2(date QDate_ITF) *QDateTime {
+	return NewQDateTimeFromPointer(C.QDateTime_NewQDateTime2InArena(arena.Pointer(), PointerFromQDate(date)))
+}
+
 func NewQDateTime3(date QDate_ITF, time QTime_ITF, spec Qt__TimeSpec) *QDateTime {
 	var tmpValue = NewQDateTimeFromPointer(C.QDateTime_NewQDateTime3(PointerFromQDate(date), PointerFromQTime(time), C.longlong(spec)))
 	runtime.SetFinalizer(tmpValue, (*QDateTime).DestroyQDateTime)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDateTime3(date QDate_ITF, time QTime_ITF, spec Qt__TimeSpec) *QDateTime {
+	return NewQDateTimeFromPointer(C.QDateTime_NewQDateTime3InArena(arena.Pointer(), PointerFromQDate(date), PointerFromQTime(time), C.longlong(spec)))
+}
+
 func NewQDateTime4(date QDate_ITF, time QTime_ITF, spec Qt__TimeSpec, offsetSeconds int) *QDateTime {
 	var tmpValue = NewQDateTimeFromPointer(C.QDateTime_NewQDateTime4(PointerFromQDate(date), PointerFromQTime(time), C.longlong(spec), C.int(int32(offsetSeconds))))
 	runtime.SetFinalizer(tmpValue, (*QDateTime).DestroyQDateTime)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDateTime4(date QDate_ITF, time QTime_ITF, spec Qt__TimeSpec, offsetSeconds int) *QDateTime {
+	return NewQDateTimeFromPointer(C.QDateTime_NewQDateTime4InArena(arena.Pointer(), PointerFromQDate(date), PointerFromQTime(time), C.longlong(spec), C.int(int32(offsetSeconds))))
+}
+
 func NewQDateTime5(date QDate_ITF, time QTime_ITF, timeZone QTimeZone_ITF) *QDateTime {
 	var tmpValue = NewQDateTimeFromPointer(C.QDateTime_NewQDateTime5(PointerFromQDate(date), PointerFromQTime(time), PointerFromQTimeZone(timeZone)))
 	runtime.SetFinalizer(tmpValue, (*QDateTime).DestroyQDateTime)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDateTime5(date QDate_ITF, time QTime_ITF, timeZone QTimeZone_ITF) *QDateTime {
+	return NewQDateTimeFromPointer(C.QDateTime_NewQDateTime5InArena(arena.Pointer(), PointerFromQDate(date), PointerFromQTime(time), PointerFromQTimeZone(timeZone)))
+}
+
 func NewQDateTime6(other QDateTime_ITF) *QDateTime {
 	var tmpValue = NewQDateTimeFromPointer(C.QDateTime_NewQDateTime6(PointerFromQDateTime(other)))
 	runtime.SetFinalizer(tmpValue, (*QDateTime).DestroyQDateTime)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDateTime6(other QDateTime_ITF) *QDateTime {
+	return NewQDateTimeFromPointer(C.QDateTime_NewQDateTime6InArena(arena.Pointer(), PointerFromQDateTime(other)))
+}
+
 func QDateTime_CurrentMSecsSinceEpoch() int64 {
 	return int64(C.QDateTime_QDateTime_CurrentMSecsSinceEpoch())
 }
@@ -11084,18 +11446,30 @@ func NewQDeadlineTimer2(foreverConstant QDeadlineTimer__ForeverConstant, timerTy
 	return tmpValue
 }
 
+func (arena *Arena) NewQDeadlineTimer2(foreverConstant QDeadlineTimer__ForeverConstant, timerType Qt__TimerType) *QDeadlineTimer {
+	return NewQDeadlineTimerFromPointer(C.QDeadlineTimer_NewQDeadlineTimer2InArena(arena.Pointer(), C.longlong(foreverConstant), C.longlong(timerType)))
+}
+
 func NewQDeadlineTimer(timerType Qt__TimerType) *QDeadlineTimer {
 	var tmpValue = NewQDeadlineTimerFromPointer(C.QDeadlineTimer_NewQDeadlineTimer(C.longlong(timerType)))
 	runtime.SetFinalizer(tmpValue, (*QDeadlineTimer).DestroyQDeadlineTimer)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDeadlineTimer(timerType Qt__TimerType) *QDeadlineTimer {
+	return NewQDeadlineTimerFromPointer(C.QDeadlineTimer_NewQDeadlineTimerInArena(arena.Pointer(), C.longlong(timerType)))
+}
+
 func NewQDeadlineTimer3(msecs int64, ty Qt__TimerType) *QDeadlineTimer {
 	var tmpValue = NewQDeadlineTimerFromPointer(C.QDeadlineTimer_NewQDeadlineTimer3(C.longlong(msecs), C.longlong(ty)))
 	runtime.SetFinalizer(tmpValue, (*QDeadlineTimer).DestroyQDeadlineTimer)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDeadlineTimer3(msecs int64, ty Qt__TimerType) *QDeadlineTimer {
+	return NewQDeadlineTimerFromPointer(C.QDeadlineTimer_NewQDeadlineTimer3InArena(arena.Pointer(), C.longlong(msecs), C.longlong(ty)))
+}
+
 func (ptr *QDeadlineTimer) SetDeadline(msecs int64, timerType Qt__TimerType) {
 	if ptr.Pointer() != nil {
 		C.QDeadlineTimer_SetDeadline(ptr.Pointer(), C.longlong(msecs), C.longlong(timerType))
@@ -11289,6 +11663,10 @@ func NewQDebug(device QIODevice_ITF) *QDebug {
 	return tmpValue
 }
 
+func (arena *Arena) NewQDebug(device QIODevice_ITF) *QDebug {
+	return NewQDebugFromPointer(C.QDebug_NewQDebugInArena(arena.Pointer(), PointerFromQIODevice(device)))
+}
+
 func NewQDebug2(stri string) *QDebug {
 	var striC = C.CString(stri)
 	defer C.free(unsafe.Pointer(striC))
@@ -11297,12 +11675,22 @@ func NewQDebug2(stri string) *QDebug {
 	return tmpValue
 }
 
+func (arena *Arena) NewQDebug2(stri string) *QDebug {
+	var striC = C.CString(stri)
+	defer C.free(unsafe.Pointer(striC))
+	return NewQDebugFromPointer(C.QDebug_NewQDebug2InArena(arena.Pointer(), striC))
+}
+
 func NewQDebug4(other QDebug_ITF) *QDebug {
 	var tmpValue = NewQDebugFromPointer(C.QDebug_NewQDebug4(PointerFromQDebug(other)))
 	runtime.SetFinalizer(tmpValue, (*QDebug).DestroyQDebug)
 	return tmpValue
 }
 
+func (arena *Arena) NewQDebug4(other QDebug_ITF) *QDebug {
+	return NewQDebugFromPointer(C.QDebug_NewQDebug4InArena(arena.Pointer(), PointerFromQDebug(other)))
+}
+
 func (ptr *QDebug) SetAutoInsertSpaces(b bool) {
 	if ptr.Pointer() != nil {
 		C.QDebug_SetAutoInsertSpaces(ptr.Pointer(), C.char(int8(qt.GoBoolToInt(b))))
@@ -11385,6 +11773,10 @@ func NewQDebugStateSaver(dbg QDebug_ITF) *QDebugStateSaver {
 	return tmpValue
 }
 
+func (arena *Arena) NewQDebugStateSaver(dbg QDebug_ITF) *QDebugStateSaver {
+	return NewQDebugStateSaverFromPointer(C.QDebugStateSaver_NewQDebugStateSaverInArena(arena.Pointer(), PointerFromQDebug(dbg)))
+}
+
 func (ptr *QDebugStateSaver) DestroyQDebugStateSaver() {
 	if ptr.Pointer() != nil {
 		C.QDebugStateSaver_DestroyQDebugStateSaver(ptr.Pointer())
@@ -11554,6 +11946,10 @@ func NewQDir(dir QDir_ITF) *QDir {
 	return tmpValue
 }
 
+func (arena *Arena) NewQDir(dir QDir_ITF) *QDir {
+	return NewQDirFromPointer(C.QDir_NewQDirInArena(arena.Pointer(), PointerFromQDir(dir)))
+}
+
 func NewQDir2(path string) *QDir {
 	var pathC = C.CString(path)
 	defer C.free(unsafe.Pointer(pathC))
@@ -11562,6 +11958,12 @@ func NewQDir2(path string) *QDir {
 	return tmpValue
 }
 
+func (arena *Arena) NewQDir2(path string) *QDir {
+	var pathC = C.CString(path)
+	defer C.free(unsafe.Pointer(pathC))
+	return NewQDirFromPointer(C.QDir_NewQDir2InArena(arena.Pointer(), pathC))
+}
+
 func NewQDir3(path string, nameFilter string, sort QDir__SortFlag, filters QDir__Filter) *QDir {
 	var pathC = C.CString(path)
 	defer C.free(unsafe.Pointer(pathC))
@@ -11572,6 +11974,14 @@ func NewQDir3(path string, nameFilter string, sort QDir__SortFlag, filters QDir_
 	return tmpValue
 }
 
+func (arena *Arena) NewQDir3(path string, nameFilter string, sort QDir__SortFlag, filters QDir__Filter) *QDir {
+	var pathC = C.CString(path)
+	defer C.free(unsafe.Pointer(pathC))
+	var nameFilterC = C.CString(nameFilter)
+	defer C.free(unsafe.Pointer(nameFilterC))
+	return NewQDirFromPointer(C.QDir_NewQDir3InArena(arena.Pointer(), pathC, nameFilterC, C.longlong(sort), C.longlong(filters)))
+}
+
 func QDir_Drives() []*QFileInfo {
 	return func(l C.struct_QtCore_PackedList) []*QFileInfo {
 		var out = make([]*QFileInfo, int(l.len))
@@ -11663,13 +12073,13 @@ func (ptr *QDir) ToNativeSeparators(pathName string) string {
 func QDir_SearchPaths(prefix string) []string {
 	var prefixC = C.CString(prefix)
 	defer C.free(unsafe.Pointer(prefixC))
-	return strings.Split(cGoUnpackString(C.QDir_QDir_SearchPaths(prefixC)), "|")
+	return cGoUnpackStringListAndFree(C.QDir_QDir_SearchPaths(prefixC))
 }
 
 func (ptr *QDir) SearchPaths(prefix string) []string {
 	var prefixC = C.CString(prefix)
 	defer C.free(unsafe.Pointer(prefixC))
-	return strings.Split(cGoUnpackString(C.QDir_QDir_SearchPaths(prefixC)), "|")
+	return cGoUnpackStringListAndFree(C.QDir_QDir_SearchPaths(prefixC))
 }
 
 func (ptr *QDir) Cd(dirName string) bool {
@@ -11736,7 +12146,7 @@ func (ptr *QDir) Match(filter string, fileName string) bool {
 }
 
 func QDir_Match2(filters []string, fileName string) bool {
-	var filtersC = C.CString(strings.Join(filters, "|"))
+	var filtersC = cGoPackStringList(filters)
 	defer C.free(unsafe.Pointer(filtersC))
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
@@ -11744,7 +12154,7 @@ func QDir_Match2(filters []string, fileName string) bool {
 }
 
 func (ptr *QDir) Match2(filters []string, fileName string) bool {
-	var filtersC = C.CString(strings.Join(filters, "|"))
+	var filtersC = cGoPackStringList(filters)
 	defer C.free(unsafe.Pointer(filtersC))
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
@@ -11814,7 +12224,7 @@ func (ptr *QDir) SetFilter(filters QDir__Filter) {
 
 func (ptr *QDir) SetNameFilters(nameFilters []string) {
 	if ptr.Pointer() != nil {
-		var nameFiltersC = C.CString(strings.Join(nameFilters, "|"))
+		var nameFiltersC = cGoPackStringList(nameFilters)
 		defer C.free(unsafe.Pointer(nameFiltersC))
 		C.QDir_SetNameFilters(ptr.Pointer(), nameFiltersC)
 	}
@@ -11831,7 +12241,7 @@ func (ptr *QDir) SetPath(path string) {
 func QDir_SetSearchPaths(prefix string, searchPaths []string) {
 	var prefixC = C.CString(prefix)
 	defer C.free(unsafe.Pointer(prefixC))
-	var searchPathsC = C.CString(strings.Join(searchPaths, "|"))
+	var searchPathsC = cGoPackStringList(searchPaths)
 	defer C.free(unsafe.Pointer(searchPathsC))
 	C.QDir_QDir_SetSearchPaths(prefixC, searchPathsC)
 }
@@ -11839,7 +12249,7 @@ func QDir_SetSearchPaths(prefix string, searchPaths []string) {
 func (ptr *QDir) SetSearchPaths(prefix string, searchPaths []string) {
 	var prefixC = C.CString(prefix)
 	defer C.free(unsafe.Pointer(prefixC))
-	var searchPathsC = C.CString(strings.Join(searchPaths, "|"))
+	var searchPathsC = cGoPackStringList(searchPaths)
 	defer C.free(unsafe.Pointer(searchPathsC))
 	C.QDir_QDir_SetSearchPaths(prefixC, searchPathsC)
 }
@@ -11885,7 +12295,7 @@ func (ptr *QDir) EntryInfoList2(filters QDir__Filter, sort QDir__SortFlag) []*QF
 
 func (ptr *QDir) EntryInfoList(nameFilters []string, filters QDir__Filter, sort QDir__SortFlag) []*QFileInfo {
 	if ptr.Pointer() != nil {
-		var nameFiltersC = C.CString(strings.Join(nameFilters, "|"))
+		var nameFiltersC = cGoPackStringList(nameFilters)
 		defer C.free(unsafe.Pointer(nameFiltersC))
 		return func(l C.struct_QtCore_PackedList) []*QFileInfo {
 			var out = make([]*QFileInfo, int(l.len))
@@ -11955,23 +12365,23 @@ func (ptr *QDir) RelativeFilePath(fileName string) string {
 
 func (ptr *QDir) EntryList2(filters QDir__Filter, sort QDir__SortFlag) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QDir_EntryList2(ptr.Pointer(), C.longlong(filters), C.longlong(sort))), "|")
+		return cGoUnpackStringListAndFree(C.QDir_EntryList2(ptr.Pointer(), C.longlong(filters), C.longlong(sort)))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QDir) EntryList(nameFilters []string, filters QDir__Filter, sort QDir__SortFlag) []string {
 	if ptr.Pointer() != nil {
-		var nameFiltersC = C.CString(strings.Join(nameFilters, "|"))
+		var nameFiltersC = cGoPackStringList(nameFilters)
 		defer C.free(unsafe.Pointer(nameFiltersC))
-		return strings.Split(cGoUnpackString(C.QDir_EntryList(ptr.Pointer(), nameFiltersC, C.longlong(filters), C.longlong(sort))), "|")
+		return cGoUnpackStringListAndFree(C.QDir_EntryList(ptr.Pointer(), nameFiltersC, C.longlong(filters), C.longlong(sort)))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QDir) NameFilters() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QDir_NameFilters(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QDir_NameFilters(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -12223,7 +12633,7 @@ func NewQDynamicPropertyChangeEventFromPointer(ptr unsafe.Pointer) *QDynamicProp
 func (ptr *QDynamicPropertyChangeEvent) DestroyQDynamicPropertyChangeEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12341,18 +12751,30 @@ func NewQEasingCurve3(other QEasingCurve_ITF) *QEasingCurve {
 	return tmpValue
 }
 
+func (arena *Arena) NewQEasingCurve3(other QEasingCurve_ITF) *QEasingCurve {
+	return NewQEasingCurveFromPointer(C.QEasingCurve_NewQEasingCurve3InArena(arena.Pointer(), PointerFromQEasingCurve(other)))
+}
+
 func NewQEasingCurve(ty QEasingCurve__Type) *QEasingCurve {
 	var tmpValue = NewQEasingCurveFromPointer(C.QEasingCurve_NewQEasingCurve(C.longlong(ty)))
 	runtime.SetFinalizer(tmpValue, (*QEasingCurve).DestroyQEasingCurve)
 	return tmpValue
 }
 
+func (arena *Arena) NewQEasingCurve(ty QEasingCurve__Type) *QEasingCurve {
+	return NewQEasingCurveFromPointer(C.QEasingCurve_NewQEasingCurveInArena(arena.Pointer(), C.longlong(ty)))
+}
+
 func NewQEasingCurve2(other QEasingCurve_ITF) *QEasingCurve {
 	var tmpValue = NewQEasingCurveFromPointer(C.QEasingCurve_NewQEasingCurve2(PointerFromQEasingCurve(other)))
 	runtime.SetFinalizer(tmpValue, (*QEasingCurve).DestroyQEasingCurve)
 	return tmpValue
 }
 
+func (arena *Arena) NewQEasingCurve2(other QEasingCurve_ITF) *QEasingCurve {
+	return NewQEasingCurveFromPointer(C.QEasingCurve_NewQEasingCurve2InArena(arena.Pointer(), PointerFromQEasingCurve(other)))
+}
+
 func (ptr *QEasingCurve) AddCubicBezierSegment(c1 QPointF_ITF, c2 QPointF_ITF, endPoint QPointF_ITF) {
 	if ptr.Pointer() != nil {
 		C.QEasingCurve_AddCubicBezierSegment(ptr.Pointer(), PointerFromQPointF(c1), PointerFromQPointF(c2), PointerFromQPointF(endPoint))
@@ -12406,8 +12828,11 @@ func (ptr *QEasingCurve) ToCubicSpline() []*QPointF {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtCore_PackedList) []*QPointF {
 			var out = make([]*QPointF, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQEasingCurveFromPointer(l.data).__toCubicSpline_atList(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQEasingCurveFromPointer(l.data).__toCubicSpline_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = NewQPointFFromPointer(v)
+				runtime.SetFinalizer(out[i], (*QPointF).DestroyQPointF)
 			}
 			return out
 		}(C.QEasingCurve_ToCubicSpline(ptr.Pointer()))
@@ -12469,6 +12894,16 @@ func (ptr *QEasingCurve) __cubicBezierSpline_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QEasingCurve___cubicBezierSpline_newList(ptr.Pointer()))
 }
 
+func (ptr *QEasingCurve) __cubicBezierSpline_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QEasingCurve___cubicBezierSpline_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QEasingCurve) __cubicBezierSpline_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QEasingCurve___cubicBezierSpline_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QEasingCurve) __toCubicSpline_atList(i int) *QPointF {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQPointFFromPointer(C.QEasingCurve___toCubicSpline_atList(ptr.Pointer(), C.int(int32(i))))
@@ -12488,6 +12923,16 @@ func (ptr *QEasingCurve) __toCubicSpline_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QEasingCurve___toCubicSpline_newList(ptr.Pointer()))
 }
 
+func (ptr *QEasingCurve) __toCubicSpline_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QEasingCurve___toCubicSpline_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QEasingCurve) __toCubicSpline_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QEasingCurve___toCubicSpline_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QElapsedTimer struct {
 	ptr unsafe.Pointer
 }
@@ -12559,6 +13004,10 @@ func NewQElapsedTimer() *QElapsedTimer {
 	return tmpValue
 }
 
+func (arena *Arena) NewQElapsedTimer() *QElapsedTimer {
+	return NewQElapsedTimerFromPointer(C.QElapsedTimer_NewQElapsedTimerInArena(arena.Pointer()))
+}
+
 func QElapsedTimer_IsMonotonic() bool {
 	return C.QElapsedTimer_QElapsedTimer_IsMonotonic() != 0
 }
@@ -12930,7 +13379,7 @@ func (ptr *QEvent) SetAccepted(accepted bool) {
 
 //export callbackQEvent_DestroyQEvent
 func callbackQEvent_DestroyQEvent(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QEvent"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQEventFromPointer(ptr).DestroyQEventDefault()
@@ -12940,21 +13389,21 @@ func callbackQEvent_DestroyQEvent(ptr unsafe.Pointer) {
 func (ptr *QEvent) ConnectDestroyQEvent(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QEvent", f)
 	}
 }
 
 func (ptr *QEvent) DisconnectDestroyQEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "~QEvent")
 	}
 }
 
 func (ptr *QEvent) DestroyQEvent() {
 	if ptr.Pointer() != nil {
 		C.QEvent_DestroyQEvent(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12962,7 +13411,7 @@ func (ptr *QEvent) DestroyQEvent() {
 func (ptr *QEvent) DestroyQEventDefault() {
 	if ptr.Pointer() != nil {
 		C.QEvent_DestroyQEventDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13056,7 +13505,7 @@ const (
 
 func NewQEventLoop(parent QObject_ITF) *QEventLoop {
 	var tmpValue = NewQEventLoopFromPointer(C.QEventLoop_NewQEventLoop(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -13090,7 +13539,7 @@ func (ptr *QEventLoop) ProcessEvents2(flags QEventLoop__ProcessEventsFlag, maxTi
 
 //export callbackQEventLoop_Quit
 func callbackQEventLoop_Quit(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "quit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "quit"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQEventLoopFromPointer(ptr).QuitDefault()
@@ -13100,14 +13549,14 @@ func callbackQEventLoop_Quit(ptr unsafe.Pointer) {
 func (ptr *QEventLoop) ConnectQuit(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "quit", f)
+		qt.ConnectSignal(ptr.Pointer(), "quit", f)
 	}
 }
 
 func (ptr *QEventLoop) DisconnectQuit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "quit")
+		qt.DisconnectSignal(ptr.Pointer(), "quit")
 	}
 }
 
@@ -13132,7 +13581,7 @@ func (ptr *QEventLoop) WakeUp() {
 func (ptr *QEventLoop) DestroyQEventLoop() {
 	if ptr.Pointer() != nil {
 		C.QEventLoop_DestroyQEventLoop(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13187,18 +13636,30 @@ func NewQEventLoopLocker() *QEventLoopLocker {
 	return tmpValue
 }
 
+func (arena *Arena) NewQEventLoopLocker() *QEventLoopLocker {
+	return NewQEventLoopLockerFromPointer(C.QEventLoopLocker_NewQEventLoopLockerInArena(arena.Pointer()))
+}
+
 func NewQEventLoopLocker2(loop QEventLoop_ITF) *QEventLoopLocker {
 	var tmpValue = NewQEventLoopLockerFromPointer(C.QEventLoopLocker_NewQEventLoopLocker2(PointerFromQEventLoop(loop)))
 	runtime.SetFinalizer(tmpValue, (*QEventLoopLocker).DestroyQEventLoopLocker)
 	return tmpValue
 }
 
+func (arena *Arena) NewQEventLoopLocker2(loop QEventLoop_ITF) *QEventLoopLocker {
+	return NewQEventLoopLockerFromPointer(C.QEventLoopLocker_NewQEventLoopLocker2InArena(arena.Pointer(), PointerFromQEventLoop(loop)))
+}
+
 func NewQEventLoopLocker3(thread QThread_ITF) *QEventLoopLocker {
 	var tmpValue = NewQEventLoopLockerFromPointer(C.QEventLoopLocker_NewQEventLoopLocker3(PointerFromQThread(thread)))
 	runtime.SetFinalizer(tmpValue, (*QEventLoopLocker).DestroyQEventLoopLocker)
 	return tmpValue
 }
 
+func (arena *Arena) NewQEventLoopLocker3(thread QThread_ITF) *QEventLoopLocker {
+	return NewQEventLoopLockerFromPointer(C.QEventLoopLocker_NewQEventLoopLocker3InArena(arena.Pointer(), PointerFromQThread(thread)))
+}
+
 func (ptr *QEventLoopLocker) DestroyQEventLoopLocker() {
 	if ptr.Pointer() != nil {
 		C.QEventLoopLocker_DestroyQEventLoopLocker(ptr.Pointer())
@@ -13246,7 +13707,7 @@ func NewQEventTransitionFromPointer(ptr unsafe.Pointer) *QEventTransition {
 }
 func NewQEventTransition2(object QObject_ITF, ty QEvent__Type, sourceState QState_ITF) *QEventTransition {
 	var tmpValue = NewQEventTransitionFromPointer(C.QEventTransition_NewQEventTransition2(PointerFromQObject(object), C.longlong(ty), PointerFromQState(sourceState)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -13254,7 +13715,7 @@ func NewQEventTransition2(object QObject_ITF, ty QEvent__Type, sourceState QStat
 
 func NewQEventTransition(sourceState QState_ITF) *QEventTransition {
 	var tmpValue = NewQEventTransitionFromPointer(C.QEventTransition_NewQEventTransition(PointerFromQState(sourceState)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -13262,7 +13723,7 @@ func NewQEventTransition(sourceState QState_ITF) *QEventTransition {
 
 //export callbackQEventTransition_EventTest
 func callbackQEventTransition_EventTest(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventTest"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventTest"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QEvent) bool)(NewQEventFromPointer(event)))))
 	}
 
@@ -13272,14 +13733,14 @@ func callbackQEventTransition_EventTest(ptr unsafe.Pointer, event unsafe.Pointer
 func (ptr *QEventTransition) ConnectEventTest(f func(event *QEvent) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "eventTest", f)
+		qt.ConnectSignal(ptr.Pointer(), "eventTest", f)
 	}
 }
 
 func (ptr *QEventTransition) DisconnectEventTest() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "eventTest")
+		qt.DisconnectSignal(ptr.Pointer(), "eventTest")
 	}
 }
 
@@ -13299,7 +13760,7 @@ func (ptr *QEventTransition) EventTestDefault(event QEvent_ITF) bool {
 
 //export callbackQEventTransition_OnTransition
 func callbackQEventTransition_OnTransition(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onTransition"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onTransition"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	} else {
 		NewQEventTransitionFromPointer(ptr).OnTransitionDefault(NewQEventFromPointer(event))
@@ -13309,14 +13770,14 @@ func callbackQEventTransition_OnTransition(ptr unsafe.Pointer, event unsafe.Poin
 func (ptr *QEventTransition) ConnectOnTransition(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onTransition", f)
+		qt.ConnectSignal(ptr.Pointer(), "onTransition", f)
 	}
 }
 
 func (ptr *QEventTransition) DisconnectOnTransition() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onTransition")
+		qt.DisconnectSignal(ptr.Pointer(), "onTransition")
 	}
 }
 
@@ -13347,7 +13808,7 @@ func (ptr *QEventTransition) SetEventType(ty QEvent__Type) {
 func (ptr *QEventTransition) DestroyQEventTransition() {
 	if ptr.Pointer() != nil {
 		C.QEventTransition_DestroyQEventTransition(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13362,7 +13823,7 @@ func (ptr *QEventTransition) EventType() QEvent__Type {
 func (ptr *QEventTransition) EventSource() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QEventTransition_EventSource(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13411,7 +13872,7 @@ func NewQExceptionFromPointer(ptr unsafe.Pointer) *QException {
 func (ptr *QException) DestroyQException() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13522,7 +13983,7 @@ func (ptr *QFile) EncodeName(fileName string) *QByteArray {
 
 func NewQFile() *QFile {
 	var tmpValue = NewQFileFromPointer(C.QFile_NewQFile())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -13530,7 +13991,7 @@ func NewQFile() *QFile {
 
 func NewQFile3(parent QObject_ITF) *QFile {
 	var tmpValue = NewQFileFromPointer(C.QFile_NewQFile3(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -13540,7 +14001,7 @@ func NewQFile2(name string) *QFile {
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
 	var tmpValue = NewQFileFromPointer(C.QFile_NewQFile2(nameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -13550,7 +14011,7 @@ func NewQFile4(name string, parent QObject_ITF) *QFile {
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
 	var tmpValue = NewQFileFromPointer(C.QFile_NewQFile4(nameC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -13736,7 +14197,7 @@ func (ptr *QFile) SetFileName(name string) {
 func (ptr *QFile) DestroyQFile() {
 	if ptr.Pointer() != nil {
 		C.QFile_DestroyQFile(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13862,7 +14323,7 @@ func (ptr *QFileDevice) Flush() bool {
 
 //export callbackQFileDevice_Resize
 func callbackQFileDevice_Resize(ptr unsafe.Pointer, sz C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resize"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int64) bool)(int64(sz)))))
 	}
 
@@ -13872,14 +14333,14 @@ func callbackQFileDevice_Resize(ptr unsafe.Pointer, sz C.longlong) C.char {
 func (ptr *QFileDevice) ConnectResize(f func(sz int64) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resize", f)
+		qt.ConnectSignal(ptr.Pointer(), "resize", f)
 	}
 }
 
 func (ptr *QFileDevice) DisconnectResize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resize")
+		qt.DisconnectSignal(ptr.Pointer(), "resize")
 	}
 }
 
@@ -13899,7 +14360,7 @@ func (ptr *QFileDevice) ResizeDefault(sz int64) bool {
 
 //export callbackQFileDevice_SetPermissions
 func callbackQFileDevice_SetPermissions(ptr unsafe.Pointer, permissions C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPermissions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPermissions"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(QFileDevice__Permission) bool)(QFileDevice__Permission(permissions)))))
 	}
 
@@ -13909,14 +14370,14 @@ func callbackQFileDevice_SetPermissions(ptr unsafe.Pointer, permissions C.longlo
 func (ptr *QFileDevice) ConnectSetPermissions(f func(permissions QFileDevice__Permission) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPermissions", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPermissions", f)
 	}
 }
 
 func (ptr *QFileDevice) DisconnectSetPermissions() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPermissions")
+		qt.DisconnectSignal(ptr.Pointer(), "setPermissions")
 	}
 }
 
@@ -13945,18 +14406,21 @@ func (ptr *QFileDevice) Unmap(address string) bool {
 
 //export callbackQFileDevice_ReadData
 func callbackQFileDevice_ReadData(ptr unsafe.Pointer, data C.struct_QtCore_PackedString, len C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "readData"); signal != nil {
 		var retS = cGoUnpackString(data)
 		var ret = C.longlong(signal.(func(*string, int64) int64)(&retS, int64(len)))
 		if ret > 0 {
-			C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+			copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 		}
 		return ret
 	}
 	var retS = cGoUnpackString(data)
 	var ret = C.longlong(NewQFileDeviceFromPointer(ptr).ReadDataDefault(&retS, int64(len)))
 	if ret > 0 {
-		C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+		copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 	}
 	return ret
 }
@@ -13964,14 +14428,14 @@ func callbackQFileDevice_ReadData(ptr unsafe.Pointer, data C.struct_QtCore_Packe
 func (ptr *QFileDevice) ConnectReadData(f func(data *string, len int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readData", f)
+		qt.ConnectSignal(ptr.Pointer(), "readData", f)
 	}
 }
 
 func (ptr *QFileDevice) DisconnectReadData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readData")
+		qt.DisconnectSignal(ptr.Pointer(), "readData")
 	}
 }
 
@@ -14003,7 +14467,10 @@ func (ptr *QFileDevice) ReadDataDefault(data *string, len int64) int64 {
 
 //export callbackQFileDevice_WriteData
 func callbackQFileDevice_WriteData(ptr unsafe.Pointer, data C.struct_QtCore_PackedString, len C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "writeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "writeDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "writeData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(len)))
 	}
 
@@ -14013,14 +14480,14 @@ func callbackQFileDevice_WriteData(ptr unsafe.Pointer, data C.struct_QtCore_Pack
 func (ptr *QFileDevice) ConnectWriteData(f func(data string, len int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "writeData", f)
+		qt.ConnectSignal(ptr.Pointer(), "writeData", f)
 	}
 }
 
 func (ptr *QFileDevice) DisconnectWriteData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "writeData")
+		qt.DisconnectSignal(ptr.Pointer(), "writeData")
 	}
 }
 
@@ -14058,7 +14525,7 @@ func (ptr *QFileDevice) UnsetError() {
 func (ptr *QFileDevice) DestroyQFileDevice() {
 	if ptr.Pointer() != nil {
 		C.QFileDevice_DestroyQFileDevice(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14072,7 +14539,7 @@ func (ptr *QFileDevice) Error() QFileDevice__FileError {
 
 //export callbackQFileDevice_Permissions
 func callbackQFileDevice_Permissions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "permissions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "permissions"); signal != nil {
 		return C.longlong(signal.(func() QFileDevice__Permission)())
 	}
 
@@ -14082,14 +14549,14 @@ func callbackQFileDevice_Permissions(ptr unsafe.Pointer) C.longlong {
 func (ptr *QFileDevice) ConnectPermissions(f func() QFileDevice__Permission) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "permissions", f)
+		qt.ConnectSignal(ptr.Pointer(), "permissions", f)
 	}
 }
 
 func (ptr *QFileDevice) DisconnectPermissions() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "permissions")
+		qt.DisconnectSignal(ptr.Pointer(), "permissions")
 	}
 }
 
@@ -14109,7 +14576,7 @@ func (ptr *QFileDevice) PermissionsDefault() QFileDevice__Permission {
 
 //export callbackQFileDevice_FileName
 func callbackQFileDevice_FileName(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fileName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fileName"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -14119,14 +14586,14 @@ func callbackQFileDevice_FileName(ptr unsafe.Pointer) *C.char {
 func (ptr *QFileDevice) ConnectFileName(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fileName", f)
+		qt.ConnectSignal(ptr.Pointer(), "fileName", f)
 	}
 }
 
 func (ptr *QFileDevice) DisconnectFileName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fileName")
+		qt.DisconnectSignal(ptr.Pointer(), "fileName")
 	}
 }
 
@@ -14194,6 +14661,10 @@ func NewQFileInfo() *QFileInfo {
 	return tmpValue
 }
 
+func (arena *Arena) NewQFileInfo() *QFileInfo {
+	return NewQFileInfoFromPointer(C.QFileInfo_NewQFileInfoInArena(arena.Pointer()))
+}
+
 func NewQFileInfo5(dir QDir_ITF, file string) *QFileInfo {
 	var fileC = C.CString(file)
 	defer C.free(unsafe.Pointer(fileC))
@@ -14202,18 +14673,32 @@ func NewQFileInfo5(dir QDir_ITF, file string) *QFileInfo {
 	return tmpValue
 }
 
+func (arena *Arena) NewQFileInfo5(dir QDir_ITF, file string) *QFileInfo {
+	var fileC = C.CString(file)
+	defer C.free(unsafe.Pointer(fileC))
+	return NewQFileInfoFromPointer(C.QFileInfo_NewQFileInfo5InArena(arena.Pointer(), PointerFromQDir(dir), fileC))
+}
+
 func NewQFileInfo4(file QFile_ITF) *QFileInfo {
 	var tmpValue = NewQFileInfoFromPointer(C.QFileInfo_NewQFileInfo4(PointerFromQFile(file)))
 	runtime.SetFinalizer(tmpValue, (*QFileInfo).DestroyQFileInfo)
 	return tmpValue
 }
 
+func (arena *Arena) NewQFileInfo4(file QFile_ITF) *QFileInfo {
+	return NewQFileInfoFromPointer(C.QFileInfo_NewQFileInfo4InArena(arena.Pointer(), PointerFromQFile(file)))
+}
+
 func NewQFileInfo6(fileinfo QFileInfo_ITF) *QFileInfo {
 	var tmpValue = NewQFileInfoFromPointer(C.QFileInfo_NewQFileInfo6(PointerFromQFileInfo(fileinfo)))
 	runtime.SetFinalizer(tmpValue, (*QFileInfo).DestroyQFileInfo)
 	return tmpValue
 }
 
+func (arena *Arena) NewQFileInfo6(fileinfo QFileInfo_ITF) *QFileInfo {
+	return NewQFileInfoFromPointer(C.QFileInfo_NewQFileInfo6InArena(arena.Pointer(), PointerFromQFileInfo(fileinfo)))
+}
+
 func NewQFileInfo3(file string) *QFileInfo {
 	var fileC = C.CString(file)
 	defer C.free(unsafe.Pointer(fileC))
@@ -14222,6 +14707,12 @@ func NewQFileInfo3(file string) *QFileInfo {
 	return tmpValue
 }
 
+func (arena *Arena) NewQFileInfo3(file string) *QFileInfo {
+	var fileC = C.CString(file)
+	defer C.free(unsafe.Pointer(fileC))
+	return NewQFileInfoFromPointer(C.QFileInfo_NewQFileInfo3InArena(arena.Pointer(), fileC))
+}
+
 func QFileInfo_Exists2(file string) bool {
 	var fileC = C.CString(file)
 	defer C.free(unsafe.Pointer(fileC))
@@ -14597,7 +15088,7 @@ func NewQFileSelectorFromPointer(ptr unsafe.Pointer) *QFileSelector {
 }
 func NewQFileSelector(parent QObject_ITF) *QFileSelector {
 	var tmpValue = NewQFileSelectorFromPointer(C.QFileSelector_NewQFileSelector(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -14605,7 +15096,7 @@ func NewQFileSelector(parent QObject_ITF) *QFileSelector {
 
 func (ptr *QFileSelector) SetExtraSelectors(list []string) {
 	if ptr.Pointer() != nil {
-		var listC = C.CString(strings.Join(list, "|"))
+		var listC = cGoPackStringList(list)
 		defer C.free(unsafe.Pointer(listC))
 		C.QFileSelector_SetExtraSelectors(ptr.Pointer(), listC)
 	}
@@ -14614,7 +15105,7 @@ func (ptr *QFileSelector) SetExtraSelectors(list []string) {
 func (ptr *QFileSelector) DestroyQFileSelector() {
 	if ptr.Pointer() != nil {
 		C.QFileSelector_DestroyQFileSelector(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14630,14 +15121,14 @@ func (ptr *QFileSelector) Select(filePath string) string {
 
 func (ptr *QFileSelector) AllSelectors() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QFileSelector_AllSelectors(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QFileSelector_AllSelectors(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QFileSelector) ExtraSelectors() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QFileSelector_ExtraSelectors(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QFileSelector_ExtraSelectors(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -14691,17 +15182,17 @@ func NewQFileSystemWatcherFromPointer(ptr unsafe.Pointer) *QFileSystemWatcher {
 }
 func NewQFileSystemWatcher(parent QObject_ITF) *QFileSystemWatcher {
 	var tmpValue = NewQFileSystemWatcherFromPointer(C.QFileSystemWatcher_NewQFileSystemWatcher(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
 }
 
 func NewQFileSystemWatcher2(paths []string, parent QObject_ITF) *QFileSystemWatcher {
-	var pathsC = C.CString(strings.Join(paths, "|"))
+	var pathsC = cGoPackStringList(paths)
 	defer C.free(unsafe.Pointer(pathsC))
 	var tmpValue = NewQFileSystemWatcherFromPointer(C.QFileSystemWatcher_NewQFileSystemWatcher2(pathsC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -14709,18 +15200,18 @@ func NewQFileSystemWatcher2(paths []string, parent QObject_ITF) *QFileSystemWatc
 
 func (ptr *QFileSystemWatcher) AddPaths(paths []string) []string {
 	if ptr.Pointer() != nil {
-		var pathsC = C.CString(strings.Join(paths, "|"))
+		var pathsC = cGoPackStringList(paths)
 		defer C.free(unsafe.Pointer(pathsC))
-		return strings.Split(cGoUnpackString(C.QFileSystemWatcher_AddPaths(ptr.Pointer(), pathsC)), "|")
+		return cGoUnpackStringListAndFree(C.QFileSystemWatcher_AddPaths(ptr.Pointer(), pathsC))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QFileSystemWatcher) RemovePaths(paths []string) []string {
 	if ptr.Pointer() != nil {
-		var pathsC = C.CString(strings.Join(paths, "|"))
+		var pathsC = cGoPackStringList(paths)
 		defer C.free(unsafe.Pointer(pathsC))
-		return strings.Split(cGoUnpackString(C.QFileSystemWatcher_RemovePaths(ptr.Pointer(), pathsC)), "|")
+		return cGoUnpackStringListAndFree(C.QFileSystemWatcher_RemovePaths(ptr.Pointer(), pathsC))
 	}
 	return make([]string, 0)
 }
@@ -14745,7 +15236,7 @@ func (ptr *QFileSystemWatcher) RemovePath(path string) bool {
 
 //export callbackQFileSystemWatcher_DirectoryChanged
 func callbackQFileSystemWatcher_DirectoryChanged(ptr unsafe.Pointer, path C.struct_QtCore_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "directoryChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "directoryChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(path))
 	}
 
@@ -14754,20 +15245,20 @@ func callbackQFileSystemWatcher_DirectoryChanged(ptr unsafe.Pointer, path C.stru
 func (ptr *QFileSystemWatcher) ConnectDirectoryChanged(f func(path string)) {
 	if ptr.Pointer() != nil {
 		C.QFileSystemWatcher_ConnectDirectoryChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "directoryChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "directoryChanged", f)
 	}
 }
 
 func (ptr *QFileSystemWatcher) DisconnectDirectoryChanged() {
 	if ptr.Pointer() != nil {
 		C.QFileSystemWatcher_DisconnectDirectoryChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "directoryChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "directoryChanged")
 	}
 }
 
 //export callbackQFileSystemWatcher_FileChanged
 func callbackQFileSystemWatcher_FileChanged(ptr unsafe.Pointer, path C.struct_QtCore_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fileChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fileChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(path))
 	}
 
@@ -14776,35 +15267,35 @@ func callbackQFileSystemWatcher_FileChanged(ptr unsafe.Pointer, path C.struct_Qt
 func (ptr *QFileSystemWatcher) ConnectFileChanged(f func(path string)) {
 	if ptr.Pointer() != nil {
 		C.QFileSystemWatcher_ConnectFileChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fileChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "fileChanged", f)
 	}
 }
 
 func (ptr *QFileSystemWatcher) DisconnectFileChanged() {
 	if ptr.Pointer() != nil {
 		C.QFileSystemWatcher_DisconnectFileChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fileChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "fileChanged")
 	}
 }
 
 func (ptr *QFileSystemWatcher) DestroyQFileSystemWatcher() {
 	if ptr.Pointer() != nil {
 		C.QFileSystemWatcher_DestroyQFileSystemWatcher(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func (ptr *QFileSystemWatcher) Directories() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QFileSystemWatcher_Directories(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QFileSystemWatcher_Directories(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QFileSystemWatcher) Files() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QFileSystemWatcher_Files(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QFileSystemWatcher_Files(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -14849,7 +15340,7 @@ func NewQFinalStateFromPointer(ptr unsafe.Pointer) *QFinalState {
 }
 func NewQFinalState(parent QState_ITF) *QFinalState {
 	var tmpValue = NewQFinalStateFromPointer(C.QFinalState_NewQFinalState(PointerFromQState(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -14857,7 +15348,7 @@ func NewQFinalState(parent QState_ITF) *QFinalState {
 
 //export callbackQFinalState_OnEntry
 func callbackQFinalState_OnEntry(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onEntry"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onEntry"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	} else {
 		NewQFinalStateFromPointer(ptr).OnEntryDefault(NewQEventFromPointer(event))
@@ -14867,14 +15358,14 @@ func callbackQFinalState_OnEntry(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QFinalState) ConnectOnEntry(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onEntry", f)
+		qt.ConnectSignal(ptr.Pointer(), "onEntry", f)
 	}
 }
 
 func (ptr *QFinalState) DisconnectOnEntry() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onEntry")
+		qt.DisconnectSignal(ptr.Pointer(), "onEntry")
 	}
 }
 
@@ -14892,7 +15383,7 @@ func (ptr *QFinalState) OnEntryDefault(event QEvent_ITF) {
 
 //export callbackQFinalState_OnExit
 func callbackQFinalState_OnExit(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onExit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onExit"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	} else {
 		NewQFinalStateFromPointer(ptr).OnExitDefault(NewQEventFromPointer(event))
@@ -14902,14 +15393,14 @@ func callbackQFinalState_OnExit(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QFinalState) ConnectOnExit(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onExit", f)
+		qt.ConnectSignal(ptr.Pointer(), "onExit", f)
 	}
 }
 
 func (ptr *QFinalState) DisconnectOnExit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onExit")
+		qt.DisconnectSignal(ptr.Pointer(), "onExit")
 	}
 }
 
@@ -14928,7 +15419,7 @@ func (ptr *QFinalState) OnExitDefault(event QEvent_ITF) {
 func (ptr *QFinalState) DestroyQFinalState() {
 	if ptr.Pointer() != nil {
 		C.QFinalState_DestroyQFinalState(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14984,24 +15475,40 @@ func NewQFlag(value int) *QFlag {
 	return tmpValue
 }
 
+func (arena *Arena) NewQFlag(value int) *QFlag {
+	return NewQFlagFromPointer(C.QFlag_NewQFlagInArena(arena.Pointer(), C.int(int32(value))))
+}
+
 func NewQFlag3(value int16) *QFlag {
 	var tmpValue = NewQFlagFromPointer(C.QFlag_NewQFlag3(C.short(value)))
 	runtime.SetFinalizer(tmpValue, (*QFlag).DestroyQFlag)
 	return tmpValue
 }
 
+func (arena *Arena) NewQFlag3(value int16) *QFlag {
+	return NewQFlagFromPointer(C.QFlag_NewQFlag3InArena(arena.Pointer(), C.short(value)))
+}
+
 func NewQFlag2(value uint) *QFlag {
 	var tmpValue = NewQFlagFromPointer(C.QFlag_NewQFlag2(C.uint(uint32(value))))
 	runtime.SetFinalizer(tmpValue, (*QFlag).DestroyQFlag)
 	return tmpValue
 }
 
+func (arena *Arena) NewQFlag2(value uint) *QFlag {
+	return NewQFlagFromPointer(C.QFlag_NewQFlag2InArena(arena.Pointer(), C.uint(uint32(value))))
+}
+
 func NewQFlag4(value uint16) *QFlag {
 	var tmpValue = NewQFlagFromPointer(C.QFlag_NewQFlag4(C.ushort(value)))
 	runtime.SetFinalizer(tmpValue, (*QFlag).DestroyQFlag)
 	return tmpValue
 }
 
+func (arena *Arena) NewQFlag4(value uint16) *QFlag {
+	return NewQFlagFromPointer(C.QFlag_NewQFlag4InArena(arena.Pointer(), C.ushort(value)))
+}
+
 type QFlags struct {
 	ptr unsafe.Pointer
 }
@@ -15267,6 +15774,12 @@ func NewQGenericArgument(name string, data unsafe.Pointer) *QGenericArgument {
 	return tmpValue
 }
 
+func (arena *Arena) NewQGenericArgument(name string, data unsafe.Pointer) *QGenericArgument {
+	var nameC = C.CString(name)
+	defer C.free(unsafe.Pointer(nameC))
+	return NewQGenericArgumentFromPointer(C.QGenericArgument_NewQGenericArgumentInArena(arena.Pointer(), nameC, data))
+}
+
 func (ptr *QGenericArgument) Name() string {
 	if ptr.Pointer() != nil {
 		return cGoUnpackString(C.QGenericArgument_Name(ptr.Pointer()))
@@ -15335,6 +15848,12 @@ func NewQGenericReturnArgument(name string, data unsafe.Pointer) *QGenericReturn
 	return tmpValue
 }
 
+func (arena *Arena) NewQGenericReturnArgument(name string, data unsafe.Pointer) *QGenericReturnArgument {
+	var nameC = C.CString(name)
+	defer C.free(unsafe.Pointer(nameC))
+	return NewQGenericReturnArgumentFromPointer(C.QGenericReturnArgument_NewQGenericReturnArgumentInArena(arena.Pointer(), nameC, data))
+}
+
 type QGlobalStatic struct {
 	ptr unsafe.Pointer
 }
@@ -15513,7 +16032,7 @@ const (
 
 func NewQHistoryState2(ty QHistoryState__HistoryType, parent QState_ITF) *QHistoryState {
 	var tmpValue = NewQHistoryStateFromPointer(C.QHistoryState_NewQHistoryState2(C.longlong(ty), PointerFromQState(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -15521,7 +16040,7 @@ func NewQHistoryState2(ty QHistoryState__HistoryType, parent QState_ITF) *QHisto
 
 func NewQHistoryState(parent QState_ITF) *QHistoryState {
 	var tmpValue = NewQHistoryStateFromPointer(C.QHistoryState_NewQHistoryState(PointerFromQState(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -15529,7 +16048,7 @@ func NewQHistoryState(parent QState_ITF) *QHistoryState {
 
 //export callbackQHistoryState_DefaultStateChanged
 func callbackQHistoryState_DefaultStateChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "defaultStateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "defaultStateChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15538,20 +16057,20 @@ func callbackQHistoryState_DefaultStateChanged(ptr unsafe.Pointer) {
 func (ptr *QHistoryState) ConnectDefaultStateChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHistoryState_ConnectDefaultStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "defaultStateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "defaultStateChanged", f)
 	}
 }
 
 func (ptr *QHistoryState) DisconnectDefaultStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QHistoryState_DisconnectDefaultStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "defaultStateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "defaultStateChanged")
 	}
 }
 
 //export callbackQHistoryState_DefaultTransitionChanged
 func callbackQHistoryState_DefaultTransitionChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "defaultTransitionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "defaultTransitionChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15560,20 +16079,20 @@ func callbackQHistoryState_DefaultTransitionChanged(ptr unsafe.Pointer) {
 func (ptr *QHistoryState) ConnectDefaultTransitionChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHistoryState_ConnectDefaultTransitionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "defaultTransitionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "defaultTransitionChanged", f)
 	}
 }
 
 func (ptr *QHistoryState) DisconnectDefaultTransitionChanged() {
 	if ptr.Pointer() != nil {
 		C.QHistoryState_DisconnectDefaultTransitionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "defaultTransitionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "defaultTransitionChanged")
 	}
 }
 
 //export callbackQHistoryState_HistoryTypeChanged
 func callbackQHistoryState_HistoryTypeChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "historyTypeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "historyTypeChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15582,20 +16101,20 @@ func callbackQHistoryState_HistoryTypeChanged(ptr unsafe.Pointer) {
 func (ptr *QHistoryState) ConnectHistoryTypeChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHistoryState_ConnectHistoryTypeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "historyTypeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "historyTypeChanged", f)
 	}
 }
 
 func (ptr *QHistoryState) DisconnectHistoryTypeChanged() {
 	if ptr.Pointer() != nil {
 		C.QHistoryState_DisconnectHistoryTypeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "historyTypeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "historyTypeChanged")
 	}
 }
 
 //export callbackQHistoryState_OnEntry
 func callbackQHistoryState_OnEntry(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onEntry"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onEntry"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	} else {
 		NewQHistoryStateFromPointer(ptr).OnEntryDefault(NewQEventFromPointer(event))
@@ -15605,14 +16124,14 @@ func callbackQHistoryState_OnEntry(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QHistoryState) ConnectOnEntry(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onEntry", f)
+		qt.ConnectSignal(ptr.Pointer(), "onEntry", f)
 	}
 }
 
 func (ptr *QHistoryState) DisconnectOnEntry() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onEntry")
+		qt.DisconnectSignal(ptr.Pointer(), "onEntry")
 	}
 }
 
@@ -15630,7 +16149,7 @@ func (ptr *QHistoryState) OnEntryDefault(event QEvent_ITF) {
 
 //export callbackQHistoryState_OnExit
 func callbackQHistoryState_OnExit(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onExit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onExit"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	} else {
 		NewQHistoryStateFromPointer(ptr).OnExitDefault(NewQEventFromPointer(event))
@@ -15640,14 +16159,14 @@ func callbackQHistoryState_OnExit(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QHistoryState) ConnectOnExit(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onExit", f)
+		qt.ConnectSignal(ptr.Pointer(), "onExit", f)
 	}
 }
 
 func (ptr *QHistoryState) DisconnectOnExit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onExit")
+		qt.DisconnectSignal(ptr.Pointer(), "onExit")
 	}
 }
 
@@ -15684,7 +16203,7 @@ func (ptr *QHistoryState) SetHistoryType(ty QHistoryState__HistoryType) {
 func (ptr *QHistoryState) DestroyQHistoryState() {
 	if ptr.Pointer() != nil {
 		C.QHistoryState_DestroyQHistoryState(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15699,7 +16218,7 @@ func (ptr *QHistoryState) HistoryType() QHistoryState__HistoryType {
 func (ptr *QHistoryState) DefaultState() *QAbstractState {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractStateFromPointer(C.QHistoryState_DefaultState(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -15710,7 +16229,7 @@ func (ptr *QHistoryState) DefaultState() *QAbstractState {
 func (ptr *QHistoryState) DefaultTransition() *QAbstractTransition {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractTransitionFromPointer(C.QHistoryState_DefaultTransition(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -15861,7 +16380,7 @@ func (ptr *QIODevice) ReadLine2(maxSize int64) *QByteArray {
 
 func NewQIODevice2(parent QObject_ITF) *QIODevice {
 	var tmpValue = NewQIODeviceFromPointer(C.QIODevice_NewQIODevice2(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -15887,7 +16406,7 @@ func (ptr *QIODevice) Peek2(maxSize int64) *QByteArray {
 
 func NewQIODevice() *QIODevice {
 	var tmpValue = NewQIODeviceFromPointer(C.QIODevice_NewQIODevice())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -15895,7 +16414,7 @@ func NewQIODevice() *QIODevice {
 
 //export callbackQIODevice_Open
 func callbackQIODevice_Open(ptr unsafe.Pointer, mode C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "open"); signal != nil {
+	if signal := qt.GetSignal(ptr, "open"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(QIODevice__OpenModeFlag) bool)(QIODevice__OpenModeFlag(mode)))))
 	}
 
@@ -15905,14 +16424,14 @@ func callbackQIODevice_Open(ptr unsafe.Pointer, mode C.longlong) C.char {
 func (ptr *QIODevice) ConnectOpen(f func(mode QIODevice__OpenModeFlag) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "open", f)
+		qt.ConnectSignal(ptr.Pointer(), "open", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectOpen() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "open")
+		qt.DisconnectSignal(ptr.Pointer(), "open")
 	}
 }
 
@@ -15941,7 +16460,7 @@ func (ptr *QIODevice) PutChar(c string) bool {
 
 //export callbackQIODevice_Reset
 func callbackQIODevice_Reset(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -15951,14 +16470,14 @@ func callbackQIODevice_Reset(ptr unsafe.Pointer) C.char {
 func (ptr *QIODevice) ConnectReset(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reset", f)
+		qt.ConnectSignal(ptr.Pointer(), "reset", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectReset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reset")
+		qt.DisconnectSignal(ptr.Pointer(), "reset")
 	}
 }
 
@@ -15978,7 +16497,7 @@ func (ptr *QIODevice) ResetDefault() bool {
 
 //export callbackQIODevice_Seek
 func callbackQIODevice_Seek(ptr unsafe.Pointer, pos C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seek"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seek"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int64) bool)(int64(pos)))))
 	}
 
@@ -15988,14 +16507,14 @@ func callbackQIODevice_Seek(ptr unsafe.Pointer, pos C.longlong) C.char {
 func (ptr *QIODevice) ConnectSeek(f func(pos int64) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seek", f)
+		qt.ConnectSignal(ptr.Pointer(), "seek", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectSeek() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seek")
+		qt.DisconnectSignal(ptr.Pointer(), "seek")
 	}
 }
 
@@ -16015,7 +16534,7 @@ func (ptr *QIODevice) SeekDefault(pos int64) bool {
 
 //export callbackQIODevice_WaitForBytesWritten
 func callbackQIODevice_WaitForBytesWritten(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForBytesWritten"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -16025,14 +16544,14 @@ func callbackQIODevice_WaitForBytesWritten(ptr unsafe.Pointer, msecs C.int) C.ch
 func (ptr *QIODevice) ConnectWaitForBytesWritten(f func(msecs int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "waitForBytesWritten", f)
+		qt.ConnectSignal(ptr.Pointer(), "waitForBytesWritten", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectWaitForBytesWritten() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "waitForBytesWritten")
+		qt.DisconnectSignal(ptr.Pointer(), "waitForBytesWritten")
 	}
 }
 
@@ -16052,7 +16571,7 @@ func (ptr *QIODevice) WaitForBytesWrittenDefault(msecs int) bool {
 
 //export callbackQIODevice_WaitForReadyRead
 func callbackQIODevice_WaitForReadyRead(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForReadyRead"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -16062,14 +16581,14 @@ func callbackQIODevice_WaitForReadyRead(ptr unsafe.Pointer, msecs C.int) C.char
 func (ptr *QIODevice) ConnectWaitForReadyRead(f func(msecs int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "waitForReadyRead", f)
+		qt.ConnectSignal(ptr.Pointer(), "waitForReadyRead", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectWaitForReadyRead() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "waitForReadyRead")
+		qt.DisconnectSignal(ptr.Pointer(), "waitForReadyRead")
 	}
 }
 
@@ -16107,11 +16626,14 @@ func (ptr *QIODevice) Read(data string, maxSize int64) int64 {
 
 //export callbackQIODevice_ReadData
 func callbackQIODevice_ReadData(ptr unsafe.Pointer, data C.struct_QtCore_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "readData"); signal != nil {
 		var retS = cGoUnpackString(data)
 		var ret = C.longlong(signal.(func(*string, int64) int64)(&retS, int64(maxSize)))
 		if ret > 0 {
-			C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+			copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 		}
 		return ret
 	}
@@ -16122,14 +16644,14 @@ func callbackQIODevice_ReadData(ptr unsafe.Pointer, data C.struct_QtCore_PackedS
 func (ptr *QIODevice) ConnectReadData(f func(data *string, maxSize int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readData", f)
+		qt.ConnectSignal(ptr.Pointer(), "readData", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectReadData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readData")
+		qt.DisconnectSignal(ptr.Pointer(), "readData")
 	}
 }
 
@@ -16157,7 +16679,7 @@ func (ptr *QIODevice) ReadLine(data string, maxSize int64) int64 {
 
 //export callbackQIODevice_ReadLineData
 func callbackQIODevice_ReadLineData(ptr unsafe.Pointer, data C.struct_QtCore_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readLineData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readLineData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(maxSize)))
 	}
 
@@ -16167,14 +16689,14 @@ func callbackQIODevice_ReadLineData(ptr unsafe.Pointer, data C.struct_QtCore_Pac
 func (ptr *QIODevice) ConnectReadLineData(f func(data string, maxSize int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readLineData", f)
+		qt.ConnectSignal(ptr.Pointer(), "readLineData", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectReadLineData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readLineData")
+		qt.DisconnectSignal(ptr.Pointer(), "readLineData")
 	}
 }
 
@@ -16223,7 +16745,10 @@ func (ptr *QIODevice) Write(data string, maxSize int64) int64 {
 
 //export callbackQIODevice_WriteData
 func callbackQIODevice_WriteData(ptr unsafe.Pointer, data C.struct_QtCore_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "writeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "writeDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "writeData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(maxSize)))
 	}
 
@@ -16233,14 +16758,14 @@ func callbackQIODevice_WriteData(ptr unsafe.Pointer, data C.struct_QtCore_Packed
 func (ptr *QIODevice) ConnectWriteData(f func(data string, maxSize int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "writeData", f)
+		qt.ConnectSignal(ptr.Pointer(), "writeData", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectWriteData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "writeData")
+		qt.DisconnectSignal(ptr.Pointer(), "writeData")
 	}
 }
 
@@ -16255,7 +16780,7 @@ func (ptr *QIODevice) WriteData(data string, maxSize int64) int64 {
 
 //export callbackQIODevice_AboutToClose
 func callbackQIODevice_AboutToClose(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aboutToClose"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aboutToClose"); signal != nil {
 		signal.(func())()
 	}
 
@@ -16264,14 +16789,14 @@ func callbackQIODevice_AboutToClose(ptr unsafe.Pointer) {
 func (ptr *QIODevice) ConnectAboutToClose(f func()) {
 	if ptr.Pointer() != nil {
 		C.QIODevice_ConnectAboutToClose(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "aboutToClose", f)
+		qt.ConnectSignal(ptr.Pointer(), "aboutToClose", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectAboutToClose() {
 	if ptr.Pointer() != nil {
 		C.QIODevice_DisconnectAboutToClose(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "aboutToClose")
+		qt.DisconnectSignal(ptr.Pointer(), "aboutToClose")
 	}
 }
 
@@ -16283,7 +16808,7 @@ func (ptr *QIODevice) AboutToClose() {
 
 //export callbackQIODevice_BytesWritten
 func callbackQIODevice_BytesWritten(ptr unsafe.Pointer, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesWritten"); signal != nil {
 		signal.(func(int64))(int64(bytes))
 	}
 
@@ -16292,14 +16817,14 @@ func callbackQIODevice_BytesWritten(ptr unsafe.Pointer, bytes C.longlong) {
 func (ptr *QIODevice) ConnectBytesWritten(f func(bytes int64)) {
 	if ptr.Pointer() != nil {
 		C.QIODevice_ConnectBytesWritten(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "bytesWritten", f)
+		qt.ConnectSignal(ptr.Pointer(), "bytesWritten", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectBytesWritten() {
 	if ptr.Pointer() != nil {
 		C.QIODevice_DisconnectBytesWritten(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "bytesWritten")
+		qt.DisconnectSignal(ptr.Pointer(), "bytesWritten")
 	}
 }
 
@@ -16311,7 +16836,7 @@ func (ptr *QIODevice) BytesWritten(bytes int64) {
 
 //export callbackQIODevice_ChannelBytesWritten
 func callbackQIODevice_ChannelBytesWritten(ptr unsafe.Pointer, channel C.int, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelBytesWritten"); signal != nil {
 		signal.(func(int, int64))(int(int32(channel)), int64(bytes))
 	}
 
@@ -16320,14 +16845,14 @@ func callbackQIODevice_ChannelBytesWritten(ptr unsafe.Pointer, channel C.int, by
 func (ptr *QIODevice) ConnectChannelBytesWritten(f func(channel int, bytes int64)) {
 	if ptr.Pointer() != nil {
 		C.QIODevice_ConnectChannelBytesWritten(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "channelBytesWritten", f)
+		qt.ConnectSignal(ptr.Pointer(), "channelBytesWritten", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectChannelBytesWritten() {
 	if ptr.Pointer() != nil {
 		C.QIODevice_DisconnectChannelBytesWritten(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "channelBytesWritten")
+		qt.DisconnectSignal(ptr.Pointer(), "channelBytesWritten")
 	}
 }
 
@@ -16339,7 +16864,7 @@ func (ptr *QIODevice) ChannelBytesWritten(channel int, bytes int64) {
 
 //export callbackQIODevice_ChannelReadyRead
 func callbackQIODevice_ChannelReadyRead(ptr unsafe.Pointer, channel C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelReadyRead"); signal != nil {
 		signal.(func(int))(int(int32(channel)))
 	}
 
@@ -16348,14 +16873,14 @@ func callbackQIODevice_ChannelReadyRead(ptr unsafe.Pointer, channel C.int) {
 func (ptr *QIODevice) ConnectChannelReadyRead(f func(channel int)) {
 	if ptr.Pointer() != nil {
 		C.QIODevice_ConnectChannelReadyRead(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "channelReadyRead", f)
+		qt.ConnectSignal(ptr.Pointer(), "channelReadyRead", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectChannelReadyRead() {
 	if ptr.Pointer() != nil {
 		C.QIODevice_DisconnectChannelReadyRead(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "channelReadyRead")
+		qt.DisconnectSignal(ptr.Pointer(), "channelReadyRead")
 	}
 }
 
@@ -16367,7 +16892,7 @@ func (ptr *QIODevice) ChannelReadyRead(channel int) {
 
 //export callbackQIODevice_Close
 func callbackQIODevice_Close(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQIODeviceFromPointer(ptr).CloseDefault()
@@ -16377,14 +16902,14 @@ func callbackQIODevice_Close(ptr unsafe.Pointer) {
 func (ptr *QIODevice) ConnectClose(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "close", f)
+		qt.ConnectSignal(ptr.Pointer(), "close", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectClose() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "close")
+		qt.DisconnectSignal(ptr.Pointer(), "close")
 	}
 }
 
@@ -16408,7 +16933,7 @@ func (ptr *QIODevice) CommitTransaction() {
 
 //export callbackQIODevice_ReadChannelFinished
 func callbackQIODevice_ReadChannelFinished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readChannelFinished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readChannelFinished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -16417,14 +16942,14 @@ func callbackQIODevice_ReadChannelFinished(ptr unsafe.Pointer) {
 func (ptr *QIODevice) ConnectReadChannelFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QIODevice_ConnectReadChannelFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readChannelFinished", f)
+		qt.ConnectSignal(ptr.Pointer(), "readChannelFinished", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectReadChannelFinished() {
 	if ptr.Pointer() != nil {
 		C.QIODevice_DisconnectReadChannelFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readChannelFinished")
+		qt.DisconnectSignal(ptr.Pointer(), "readChannelFinished")
 	}
 }
 
@@ -16436,7 +16961,7 @@ func (ptr *QIODevice) ReadChannelFinished() {
 
 //export callbackQIODevice_ReadyRead
 func callbackQIODevice_ReadyRead(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readyRead"); signal != nil {
 		signal.(func())()
 	}
 
@@ -16445,14 +16970,14 @@ func callbackQIODevice_ReadyRead(ptr unsafe.Pointer) {
 func (ptr *QIODevice) ConnectReadyRead(f func()) {
 	if ptr.Pointer() != nil {
 		C.QIODevice_ConnectReadyRead(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readyRead", f)
+		qt.ConnectSignal(ptr.Pointer(), "readyRead", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectReadyRead() {
 	if ptr.Pointer() != nil {
 		C.QIODevice_DisconnectReadyRead(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readyRead")
+		qt.DisconnectSignal(ptr.Pointer(), "readyRead")
 	}
 }
 
@@ -16516,7 +17041,7 @@ func (ptr *QIODevice) UngetChar(c string) {
 
 //export callbackQIODevice_DestroyQIODevice
 func callbackQIODevice_DestroyQIODevice(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QIODevice"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QIODevice"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQIODeviceFromPointer(ptr).DestroyQIODeviceDefault()
@@ -16526,21 +17051,21 @@ func callbackQIODevice_DestroyQIODevice(ptr unsafe.Pointer) {
 func (ptr *QIODevice) ConnectDestroyQIODevice(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QIODevice", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QIODevice", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectDestroyQIODevice() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QIODevice")
+		qt.DisconnectSignal(ptr.Pointer(), "~QIODevice")
 	}
 }
 
 func (ptr *QIODevice) DestroyQIODevice() {
 	if ptr.Pointer() != nil {
 		C.QIODevice_DestroyQIODevice(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -16548,7 +17073,7 @@ func (ptr *QIODevice) DestroyQIODevice() {
 func (ptr *QIODevice) DestroyQIODeviceDefault() {
 	if ptr.Pointer() != nil {
 		C.QIODevice_DestroyQIODeviceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -16569,7 +17094,7 @@ func (ptr *QIODevice) ErrorString() string {
 
 //export callbackQIODevice_AtEnd
 func callbackQIODevice_AtEnd(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "atEnd"); signal != nil {
+	if signal := qt.GetSignal(ptr, "atEnd"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -16579,14 +17104,14 @@ func callbackQIODevice_AtEnd(ptr unsafe.Pointer) C.char {
 func (ptr *QIODevice) ConnectAtEnd(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "atEnd", f)
+		qt.ConnectSignal(ptr.Pointer(), "atEnd", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectAtEnd() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "atEnd")
+		qt.DisconnectSignal(ptr.Pointer(), "atEnd")
 	}
 }
 
@@ -16606,7 +17131,7 @@ func (ptr *QIODevice) AtEndDefault() bool {
 
 //export callbackQIODevice_CanReadLine
 func callbackQIODevice_CanReadLine(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canReadLine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canReadLine"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -16616,14 +17141,14 @@ func callbackQIODevice_CanReadLine(ptr unsafe.Pointer) C.char {
 func (ptr *QIODevice) ConnectCanReadLine(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "canReadLine", f)
+		qt.ConnectSignal(ptr.Pointer(), "canReadLine", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectCanReadLine() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "canReadLine")
+		qt.DisconnectSignal(ptr.Pointer(), "canReadLine")
 	}
 }
 
@@ -16657,7 +17182,7 @@ func (ptr *QIODevice) IsReadable() bool {
 
 //export callbackQIODevice_IsSequential
 func callbackQIODevice_IsSequential(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isSequential"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isSequential"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -16667,14 +17192,14 @@ func callbackQIODevice_IsSequential(ptr unsafe.Pointer) C.char {
 func (ptr *QIODevice) ConnectIsSequential(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isSequential", f)
+		qt.ConnectSignal(ptr.Pointer(), "isSequential", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectIsSequential() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isSequential")
+		qt.DisconnectSignal(ptr.Pointer(), "isSequential")
 	}
 }
 
@@ -16743,7 +17268,7 @@ func (ptr *QIODevice) WriteChannelCount() int {
 
 //export callbackQIODevice_BytesAvailable
 func callbackQIODevice_BytesAvailable(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesAvailable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesAvailable"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -16753,14 +17278,14 @@ func callbackQIODevice_BytesAvailable(ptr unsafe.Pointer) C.longlong {
 func (ptr *QIODevice) ConnectBytesAvailable(f func() int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "bytesAvailable", f)
+		qt.ConnectSignal(ptr.Pointer(), "bytesAvailable", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectBytesAvailable() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "bytesAvailable")
+		qt.DisconnectSignal(ptr.Pointer(), "bytesAvailable")
 	}
 }
 
@@ -16780,7 +17305,7 @@ func (ptr *QIODevice) BytesAvailableDefault() int64 {
 
 //export callbackQIODevice_BytesToWrite
 func callbackQIODevice_BytesToWrite(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesToWrite"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesToWrite"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -16790,14 +17315,14 @@ func callbackQIODevice_BytesToWrite(ptr unsafe.Pointer) C.longlong {
 func (ptr *QIODevice) ConnectBytesToWrite(f func() int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "bytesToWrite", f)
+		qt.ConnectSignal(ptr.Pointer(), "bytesToWrite", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectBytesToWrite() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "bytesToWrite")
+		qt.DisconnectSignal(ptr.Pointer(), "bytesToWrite")
 	}
 }
 
@@ -16817,7 +17342,7 @@ func (ptr *QIODevice) BytesToWriteDefault() int64 {
 
 //export callbackQIODevice_Pos
 func callbackQIODevice_Pos(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pos"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pos"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -16827,14 +17352,14 @@ func callbackQIODevice_Pos(ptr unsafe.Pointer) C.longlong {
 func (ptr *QIODevice) ConnectPos(f func() int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pos", f)
+		qt.ConnectSignal(ptr.Pointer(), "pos", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectPos() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pos")
+		qt.DisconnectSignal(ptr.Pointer(), "pos")
 	}
 }
 
@@ -16854,7 +17379,7 @@ func (ptr *QIODevice) PosDefault() int64 {
 
 //export callbackQIODevice_Size
 func callbackQIODevice_Size(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -16864,14 +17389,14 @@ func callbackQIODevice_Size(ptr unsafe.Pointer) C.longlong {
 func (ptr *QIODevice) ConnectSize(f func() int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "size", f)
+		qt.ConnectSignal(ptr.Pointer(), "size", f)
 	}
 }
 
 func (ptr *QIODevice) DisconnectSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "size")
+		qt.DisconnectSignal(ptr.Pointer(), "size")
 	}
 }
 
@@ -16929,7 +17454,7 @@ func NewQIdentityProxyModelFromPointer(ptr unsafe.Pointer) *QIdentityProxyModel
 }
 func NewQIdentityProxyModel(parent QObject_ITF) *QIdentityProxyModel {
 	var tmpValue = NewQIdentityProxyModelFromPointer(C.QIdentityProxyModel_NewQIdentityProxyModel(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -16938,14 +17463,14 @@ func NewQIdentityProxyModel(parent QObject_ITF) *QIdentityProxyModel {
 func (ptr *QIdentityProxyModel) DestroyQIdentityProxyModel() {
 	if ptr.Pointer() != nil {
 		C.QIdentityProxyModel_DestroyQIdentityProxyModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQIdentityProxyModel_Index
 func callbackQIdentityProxyModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(int, int, *QModelIndex) *QModelIndex)(int(int32(row)), int(int32(column)), NewQModelIndexFromPointer(parent)))
 	}
 
@@ -16955,14 +17480,14 @@ func callbackQIdentityProxyModel_Index(ptr unsafe.Pointer, row C.int, column C.i
 func (ptr *QIdentityProxyModel) ConnectIndex(f func(row int, column int, parent *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "index", f)
+		qt.ConnectSignal(ptr.Pointer(), "index", f)
 	}
 }
 
 func (ptr *QIdentityProxyModel) DisconnectIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "index")
+		qt.DisconnectSignal(ptr.Pointer(), "index")
 	}
 }
 
@@ -16986,7 +17511,7 @@ func (ptr *QIdentityProxyModel) IndexDefault(row int, column int, parent QModelI
 
 //export callbackQIdentityProxyModel_MapFromSource
 func callbackQIdentityProxyModel_MapFromSource(ptr unsafe.Pointer, sourceIndex unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapFromSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapFromSource"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(sourceIndex)))
 	}
 
@@ -16996,14 +17521,14 @@ func callbackQIdentityProxyModel_MapFromSource(ptr unsafe.Pointer, sourceIndex u
 func (ptr *QIdentityProxyModel) ConnectMapFromSource(f func(sourceIndex *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapFromSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapFromSource", f)
 	}
 }
 
 func (ptr *QIdentityProxyModel) DisconnectMapFromSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapFromSource")
+		qt.DisconnectSignal(ptr.Pointer(), "mapFromSource")
 	}
 }
 
@@ -17027,7 +17552,7 @@ func (ptr *QIdentityProxyModel) MapFromSourceDefault(sourceIndex QModelIndex_ITF
 
 //export callbackQIdentityProxyModel_MapToSource
 func callbackQIdentityProxyModel_MapToSource(ptr unsafe.Pointer, proxyIndex unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapToSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapToSource"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(proxyIndex)))
 	}
 
@@ -17037,14 +17562,14 @@ func callbackQIdentityProxyModel_MapToSource(ptr unsafe.Pointer, proxyIndex unsa
 func (ptr *QIdentityProxyModel) ConnectMapToSource(f func(proxyIndex *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapToSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapToSource", f)
 	}
 }
 
 func (ptr *QIdentityProxyModel) DisconnectMapToSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapToSource")
+		qt.DisconnectSignal(ptr.Pointer(), "mapToSource")
 	}
 }
 
@@ -17068,7 +17593,7 @@ func (ptr *QIdentityProxyModel) MapToSourceDefault(proxyIndex QModelIndex_ITF) *
 
 //export callbackQIdentityProxyModel_Parent
 func callbackQIdentityProxyModel_Parent(ptr unsafe.Pointer, child unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(child)))
 	}
 
@@ -17078,14 +17603,14 @@ func callbackQIdentityProxyModel_Parent(ptr unsafe.Pointer, child unsafe.Pointer
 func (ptr *QIdentityProxyModel) ConnectParent(f func(child *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parent", f)
+		qt.ConnectSignal(ptr.Pointer(), "parent", f)
 	}
 }
 
 func (ptr *QIdentityProxyModel) DisconnectParent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parent")
+		qt.DisconnectSignal(ptr.Pointer(), "parent")
 	}
 }
 
@@ -17109,7 +17634,7 @@ func (ptr *QIdentityProxyModel) ParentDefault(child QModelIndex_ITF) *QModelInde
 
 //export callbackQIdentityProxyModel_ColumnCount
 func callbackQIdentityProxyModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -17119,14 +17644,14 @@ func callbackQIdentityProxyModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.P
 func (ptr *QIdentityProxyModel) ConnectColumnCount(f func(parent *QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCount", f)
 	}
 }
 
 func (ptr *QIdentityProxyModel) DisconnectColumnCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCount")
 	}
 }
 
@@ -17146,7 +17671,7 @@ func (ptr *QIdentityProxyModel) ColumnCountDefault(parent QModelIndex_ITF) int {
 
 //export callbackQIdentityProxyModel_RowCount
 func callbackQIdentityProxyModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -17156,14 +17681,14 @@ func callbackQIdentityProxyModel_RowCount(ptr unsafe.Pointer, parent unsafe.Poin
 func (ptr *QIdentityProxyModel) ConnectRowCount(f func(parent *QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCount", f)
 	}
 }
 
 func (ptr *QIdentityProxyModel) DisconnectRowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCount")
 	}
 }
 
@@ -17233,12 +17758,20 @@ func NewQItemSelection() *QItemSelection {
 	return tmpValue
 }
 
+func (arena *Arena) NewQItemSelection() *QItemSelection {
+	return NewQItemSelectionFromPointer(C.QItemSelection_NewQItemSelectionInArena(arena.Pointer()))
+}
+
 func NewQItemSelection2(topLeft QModelIndex_ITF, bottomRight QModelIndex_ITF) *QItemSelection {
 	var tmpValue = NewQItemSelectionFromPointer(C.QItemSelection_NewQItemSelection2(PointerFromQModelIndex(topLeft), PointerFromQModelIndex(bottomRight)))
 	runtime.SetFinalizer(tmpValue, (*QItemSelection).DestroyQItemSelection)
 	return tmpValue
 }
 
+func (arena *Arena) NewQItemSelection2(topLeft QModelIndex_ITF, bottomRight QModelIndex_ITF) *QItemSelection {
+	return NewQItemSelectionFromPointer(C.QItemSelection_NewQItemSelection2InArena(arena.Pointer(), PointerFromQModelIndex(topLeft), PointerFromQModelIndex(bottomRight)))
+}
+
 func (ptr *QItemSelection) Merge(other QItemSelection_ITF, command QItemSelectionModel__SelectionFlag) {
 	if ptr.Pointer() != nil {
 		C.QItemSelection_Merge(ptr.Pointer(), PointerFromQItemSelection(other), C.longlong(command))
@@ -17358,7 +17891,7 @@ const (
 func (ptr *QItemSelectionModel) Model2() *QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractItemModelFromPointer(C.QItemSelectionModel_Model2(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -17368,7 +17901,7 @@ func (ptr *QItemSelectionModel) Model2() *QAbstractItemModel {
 
 func NewQItemSelectionModel(model QAbstractItemModel_ITF) *QItemSelectionModel {
 	var tmpValue = NewQItemSelectionModelFromPointer(C.QItemSelectionModel_NewQItemSelectionModel(PointerFromQAbstractItemModel(model)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -17376,7 +17909,7 @@ func NewQItemSelectionModel(model QAbstractItemModel_ITF) *QItemSelectionModel {
 
 func NewQItemSelectionModel2(model QAbstractItemModel_ITF, parent QObject_ITF) *QItemSelectionModel {
 	var tmpValue = NewQItemSelectionModelFromPointer(C.QItemSelectionModel_NewQItemSelectionModel2(PointerFromQAbstractItemModel(model), PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -17384,7 +17917,7 @@ func NewQItemSelectionModel2(model QAbstractItemModel_ITF, parent QObject_ITF) *
 
 //export callbackQItemSelectionModel_Clear
 func callbackQItemSelectionModel_Clear(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clear"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clear"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQItemSelectionModelFromPointer(ptr).ClearDefault()
@@ -17394,14 +17927,14 @@ func callbackQItemSelectionModel_Clear(ptr unsafe.Pointer) {
 func (ptr *QItemSelectionModel) ConnectClear(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clear", f)
+		qt.ConnectSignal(ptr.Pointer(), "clear", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectClear() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clear")
+		qt.DisconnectSignal(ptr.Pointer(), "clear")
 	}
 }
 
@@ -17419,7 +17952,7 @@ func (ptr *QItemSelectionModel) ClearDefault() {
 
 //export callbackQItemSelectionModel_ClearCurrentIndex
 func callbackQItemSelectionModel_ClearCurrentIndex(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clearCurrentIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clearCurrentIndex"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQItemSelectionModelFromPointer(ptr).ClearCurrentIndexDefault()
@@ -17429,14 +17962,14 @@ func callbackQItemSelectionModel_ClearCurrentIndex(ptr unsafe.Pointer) {
 func (ptr *QItemSelectionModel) ConnectClearCurrentIndex(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clearCurrentIndex", f)
+		qt.ConnectSignal(ptr.Pointer(), "clearCurrentIndex", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectClearCurrentIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clearCurrentIndex")
+		qt.DisconnectSignal(ptr.Pointer(), "clearCurrentIndex")
 	}
 }
 
@@ -17454,7 +17987,7 @@ func (ptr *QItemSelectionModel) ClearCurrentIndexDefault() {
 
 //export callbackQItemSelectionModel_ClearSelection
 func callbackQItemSelectionModel_ClearSelection(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clearSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clearSelection"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQItemSelectionModelFromPointer(ptr).ClearSelectionDefault()
@@ -17464,14 +17997,14 @@ func callbackQItemSelectionModel_ClearSelection(ptr unsafe.Pointer) {
 func (ptr *QItemSelectionModel) ConnectClearSelection(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clearSelection", f)
+		qt.ConnectSignal(ptr.Pointer(), "clearSelection", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectClearSelection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clearSelection")
+		qt.DisconnectSignal(ptr.Pointer(), "clearSelection")
 	}
 }
 
@@ -17489,7 +18022,7 @@ func (ptr *QItemSelectionModel) ClearSelectionDefault() {
 
 //export callbackQItemSelectionModel_CurrentChanged
 func callbackQItemSelectionModel_CurrentChanged(ptr unsafe.Pointer, current unsafe.Pointer, previous unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentChanged"); signal != nil {
 		signal.(func(*QModelIndex, *QModelIndex))(NewQModelIndexFromPointer(current), NewQModelIndexFromPointer(previous))
 	}
 
@@ -17498,14 +18031,14 @@ func callbackQItemSelectionModel_CurrentChanged(ptr unsafe.Pointer, current unsa
 func (ptr *QItemSelectionModel) ConnectCurrentChanged(f func(current *QModelIndex, previous *QModelIndex)) {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_ConnectCurrentChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentChanged", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectCurrentChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_DisconnectCurrentChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "currentChanged")
 	}
 }
 
@@ -17517,7 +18050,7 @@ func (ptr *QItemSelectionModel) CurrentChanged(current QModelIndex_ITF, previous
 
 //export callbackQItemSelectionModel_CurrentColumnChanged
 func callbackQItemSelectionModel_CurrentColumnChanged(ptr unsafe.Pointer, current unsafe.Pointer, previous unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentColumnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentColumnChanged"); signal != nil {
 		signal.(func(*QModelIndex, *QModelIndex))(NewQModelIndexFromPointer(current), NewQModelIndexFromPointer(previous))
 	}
 
@@ -17526,14 +18059,14 @@ func callbackQItemSelectionModel_CurrentColumnChanged(ptr unsafe.Pointer, curren
 func (ptr *QItemSelectionModel) ConnectCurrentColumnChanged(f func(current *QModelIndex, previous *QModelIndex)) {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_ConnectCurrentColumnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentColumnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentColumnChanged", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectCurrentColumnChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_DisconnectCurrentColumnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentColumnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "currentColumnChanged")
 	}
 }
 
@@ -17545,7 +18078,7 @@ func (ptr *QItemSelectionModel) CurrentColumnChanged(current QModelIndex_ITF, pr
 
 //export callbackQItemSelectionModel_CurrentRowChanged
 func callbackQItemSelectionModel_CurrentRowChanged(ptr unsafe.Pointer, current unsafe.Pointer, previous unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentRowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentRowChanged"); signal != nil {
 		signal.(func(*QModelIndex, *QModelIndex))(NewQModelIndexFromPointer(current), NewQModelIndexFromPointer(previous))
 	}
 
@@ -17554,14 +18087,14 @@ func callbackQItemSelectionModel_CurrentRowChanged(ptr unsafe.Pointer, current u
 func (ptr *QItemSelectionModel) ConnectCurrentRowChanged(f func(current *QModelIndex, previous *QModelIndex)) {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_ConnectCurrentRowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentRowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentRowChanged", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectCurrentRowChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_DisconnectCurrentRowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentRowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "currentRowChanged")
 	}
 }
 
@@ -17579,7 +18112,7 @@ func (ptr *QItemSelectionModel) EmitSelectionChanged(newSelection QItemSelection
 
 //export callbackQItemSelectionModel_ModelChanged
 func callbackQItemSelectionModel_ModelChanged(ptr unsafe.Pointer, model unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelChanged"); signal != nil {
 		signal.(func(*QAbstractItemModel))(NewQAbstractItemModelFromPointer(model))
 	}
 
@@ -17588,14 +18121,14 @@ func callbackQItemSelectionModel_ModelChanged(ptr unsafe.Pointer, model unsafe.P
 func (ptr *QItemSelectionModel) ConnectModelChanged(f func(model *QAbstractItemModel)) {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_ConnectModelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelChanged", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectModelChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_DisconnectModelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "modelChanged")
 	}
 }
 
@@ -17607,7 +18140,7 @@ func (ptr *QItemSelectionModel) ModelChanged(model QAbstractItemModel_ITF) {
 
 //export callbackQItemSelectionModel_Reset
 func callbackQItemSelectionModel_Reset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQItemSelectionModelFromPointer(ptr).ResetDefault()
@@ -17617,14 +18150,14 @@ func callbackQItemSelectionModel_Reset(ptr unsafe.Pointer) {
 func (ptr *QItemSelectionModel) ConnectReset(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reset", f)
+		qt.ConnectSignal(ptr.Pointer(), "reset", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectReset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reset")
+		qt.DisconnectSignal(ptr.Pointer(), "reset")
 	}
 }
 
@@ -17642,7 +18175,7 @@ func (ptr *QItemSelectionModel) ResetDefault() {
 
 //export callbackQItemSelectionModel_Select2
 func callbackQItemSelectionModel_Select2(ptr unsafe.Pointer, selection unsafe.Pointer, command C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "select2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "select2"); signal != nil {
 		signal.(func(*QItemSelection, QItemSelectionModel__SelectionFlag))(NewQItemSelectionFromPointer(selection), QItemSelectionModel__SelectionFlag(command))
 	} else {
 		NewQItemSelectionModelFromPointer(ptr).Select2Default(NewQItemSelectionFromPointer(selection), QItemSelectionModel__SelectionFlag(command))
@@ -17652,14 +18185,14 @@ func callbackQItemSelectionModel_Select2(ptr unsafe.Pointer, selection unsafe.Po
 func (ptr *QItemSelectionModel) ConnectSelect2(f func(selection *QItemSelection, command QItemSelectionModel__SelectionFlag)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "select2", f)
+		qt.ConnectSignal(ptr.Pointer(), "select2", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectSelect2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "select2")
+		qt.DisconnectSignal(ptr.Pointer(), "select2")
 	}
 }
 
@@ -17677,7 +18210,7 @@ func (ptr *QItemSelectionModel) Select2Default(selection QItemSelection_ITF, com
 
 //export callbackQItemSelectionModel_Select
 func callbackQItemSelectionModel_Select(ptr unsafe.Pointer, index unsafe.Pointer, command C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "select"); signal != nil {
+	if signal := qt.GetSignal(ptr, "select"); signal != nil {
 		signal.(func(*QModelIndex, QItemSelectionModel__SelectionFlag))(NewQModelIndexFromPointer(index), QItemSelectionModel__SelectionFlag(command))
 	} else {
 		NewQItemSelectionModelFromPointer(ptr).SelectDefault(NewQModelIndexFromPointer(index), QItemSelectionModel__SelectionFlag(command))
@@ -17687,14 +18220,14 @@ func callbackQItemSelectionModel_Select(ptr unsafe.Pointer, index unsafe.Pointer
 func (ptr *QItemSelectionModel) ConnectSelect(f func(index *QModelIndex, command QItemSelectionModel__SelectionFlag)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "select", f)
+		qt.ConnectSignal(ptr.Pointer(), "select", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectSelect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "select")
+		qt.DisconnectSignal(ptr.Pointer(), "select")
 	}
 }
 
@@ -17712,7 +18245,7 @@ func (ptr *QItemSelectionModel) SelectDefault(index QModelIndex_ITF, command QIt
 
 //export callbackQItemSelectionModel_SelectionChanged
 func callbackQItemSelectionModel_SelectionChanged(ptr unsafe.Pointer, selected unsafe.Pointer, deselected unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionChanged"); signal != nil {
 		signal.(func(*QItemSelection, *QItemSelection))(NewQItemSelectionFromPointer(selected), NewQItemSelectionFromPointer(deselected))
 	}
 
@@ -17721,14 +18254,14 @@ func callbackQItemSelectionModel_SelectionChanged(ptr unsafe.Pointer, selected u
 func (ptr *QItemSelectionModel) ConnectSelectionChanged(f func(selected *QItemSelection, deselected *QItemSelection)) {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_ConnectSelectionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectionChanged", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectSelectionChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_DisconnectSelectionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectionChanged")
 	}
 }
 
@@ -17740,7 +18273,7 @@ func (ptr *QItemSelectionModel) SelectionChanged(selected QItemSelection_ITF, de
 
 //export callbackQItemSelectionModel_SetCurrentIndex
 func callbackQItemSelectionModel_SetCurrentIndex(ptr unsafe.Pointer, index unsafe.Pointer, command C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCurrentIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCurrentIndex"); signal != nil {
 		signal.(func(*QModelIndex, QItemSelectionModel__SelectionFlag))(NewQModelIndexFromPointer(index), QItemSelectionModel__SelectionFlag(command))
 	} else {
 		NewQItemSelectionModelFromPointer(ptr).SetCurrentIndexDefault(NewQModelIndexFromPointer(index), QItemSelectionModel__SelectionFlag(command))
@@ -17750,14 +18283,14 @@ func callbackQItemSelectionModel_SetCurrentIndex(ptr unsafe.Pointer, index unsaf
 func (ptr *QItemSelectionModel) ConnectSetCurrentIndex(f func(index *QModelIndex, command QItemSelectionModel__SelectionFlag)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentIndex", f)
+		qt.ConnectSignal(ptr.Pointer(), "setCurrentIndex", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectSetCurrentIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentIndex")
+		qt.DisconnectSignal(ptr.Pointer(), "setCurrentIndex")
 	}
 }
 
@@ -17781,7 +18314,7 @@ func (ptr *QItemSelectionModel) SetModel(model QAbstractItemModel_ITF) {
 
 //export callbackQItemSelectionModel_DestroyQItemSelectionModel
 func callbackQItemSelectionModel_DestroyQItemSelectionModel(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QItemSelectionModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QItemSelectionModel"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQItemSelectionModelFromPointer(ptr).DestroyQItemSelectionModelDefault()
@@ -17791,21 +18324,21 @@ func callbackQItemSelectionModel_DestroyQItemSelectionModel(ptr unsafe.Pointer)
 func (ptr *QItemSelectionModel) ConnectDestroyQItemSelectionModel(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QItemSelectionModel", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QItemSelectionModel", f)
 	}
 }
 
 func (ptr *QItemSelectionModel) DisconnectDestroyQItemSelectionModel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QItemSelectionModel")
+		qt.DisconnectSignal(ptr.Pointer(), "~QItemSelectionModel")
 	}
 }
 
 func (ptr *QItemSelectionModel) DestroyQItemSelectionModel() {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_DestroyQItemSelectionModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -17813,7 +18346,7 @@ func (ptr *QItemSelectionModel) DestroyQItemSelectionModel() {
 func (ptr *QItemSelectionModel) DestroyQItemSelectionModelDefault() {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionModel_DestroyQItemSelectionModelDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -17911,7 +18444,7 @@ func (ptr *QItemSelectionModel) RowIntersectsSelection(row int, parent QModelInd
 func (ptr *QItemSelectionModel) Model() *QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractItemModelFromPointer(C.QItemSelectionModel_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -18036,30 +18569,50 @@ func NewQItemSelectionRange() *QItemSelectionRange {
 	return tmpValue
 }
 
+func (arena *Arena) NewQItemSelectionRange() *QItemSelectionRange {
+	return NewQItemSelectionRangeFromPointer(C.QItemSelectionRange_NewQItemSelectionRangeInArena(arena.Pointer()))
+}
+
 func NewQItemSelectionRange3(other QItemSelectionRange_ITF) *QItemSelectionRange {
 	var tmpValue = NewQItemSelectionRangeFromPointer(C.QItemSelectionRange_NewQItemSelectionRange3(PointerFromQItemSelectionRange(other)))
 	runtime.SetFinalizer(tmpValue, (*QItemSelectionRange).DestroyQItemSelectionRange)
 	return tmpValue
 }
 
+func (arena *Arena) NewQItemSelectionRange3(other QItemSelectionRange_ITF) *QItemSelectionRange {
+	return NewQItemSelectionRangeFromPointer(C.QItemSelectionRange_NewQItemSelectionRange3InArena(arena.Pointer(), PointerFromQItemSelectionRange(other)))
+}
+
 func NewQItemSelectionRange2(other QItemSelectionRange_ITF) *QItemSelectionRange {
 	var tmpValue = NewQItemSelectionRangeFromPointer(C.QItemSelectionRange_NewQItemSelectionRange2(PointerFromQItemSelectionRange(other)))
 	runtime.SetFinalizer(tmpValue, (*QItemSelectionRange).DestroyQItemSelectionRange)
 	return tmpValue
 }
 
+func (arena *Arena) NewQItemSelectionRange2(other QItemSelectionRange_ITF) *QItemSelectionRange {
+	return NewQItemSelectionRangeFromPointer(C.QItemSelectionRange_NewQItemSelectionRange2InArena(arena.Pointer(), PointerFromQItemSelectionRange(other)))
+}
+
 func NewQItemSelectionRange5(index QModelIndex_ITF) *QItemSelectionRange {
 	var tmpValue = NewQItemSelectionRangeFromPointer(C.QItemSelectionRange_NewQItemSelectionRange5(PointerFromQModelIndex(index)))
 	runtime.SetFinalizer(tmpValue, (*QItemSelectionRange).DestroyQItemSelectionRange)
 	return tmpValue
 }
 
+func (arena *Arena) NewQItemSelectionRange5(index QModelIndex_ITF) *QItemSelectionRange {
+	return NewQItemSelectionRangeFromPointer(C.QItemSelectionRange_NewQItemSelectionRange5InArena(arena.Pointer(), PointerFromQModelIndex(index)))
+}
+
 func NewQItemSelectionRange4(topLeft QModelIndex_ITF, bottomRight QModelIndex_ITF) *QItemSelectionRange {
 	var tmpValue = NewQItemSelectionRangeFromPointer(C.QItemSelectionRange_NewQItemSelectionRange4(PointerFromQModelIndex(topLeft), PointerFromQModelIndex(bottomRight)))
 	runtime.SetFinalizer(tmpValue, (*QItemSelectionRange).DestroyQItemSelectionRange)
 	return tmpValue
 }
 
+func (arena *Arena) NewQItemSelectionRange4(topLeft QModelIndex_ITF, bottomRight QModelIndex_ITF) *QItemSelectionRange {
+	return NewQItemSelectionRangeFromPointer(C.QItemSelectionRange_NewQItemSelectionRange4InArena(arena.Pointer(), PointerFromQModelIndex(topLeft), PointerFromQModelIndex(bottomRight)))
+}
+
 func (ptr *QItemSelectionRange) Swap(other QItemSelectionRange_ITF) {
 	if ptr.Pointer() != nil {
 		C.QItemSelectionRange_Swap(ptr.Pointer(), PointerFromQItemSelectionRange(other))
@@ -18135,7 +18688,7 @@ func (ptr *QItemSelectionRange) IsValid() bool {
 func (ptr *QItemSelectionRange) Model() *QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractItemModelFromPointer(C.QItemSelectionRange_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -18256,7 +18809,7 @@ func NewQJsonArrayFromPointer(ptr unsafe.Pointer) *QJsonArray {
 	return n
 }
 func QJsonArray_FromStringList(list []string) *QJsonArray {
-	var listC = C.CString(strings.Join(list, "|"))
+	var listC = cGoPackStringList(list)
 	defer C.free(unsafe.Pointer(listC))
 	var tmpValue = NewQJsonArrayFromPointer(C.QJsonArray_QJsonArray_FromStringList(listC))
 	runtime.SetFinalizer(tmpValue, (*QJsonArray).DestroyQJsonArray)
@@ -18264,7 +18817,7 @@ func QJsonArray_FromStringList(list []string) *QJsonArray {
 }
 
 func (ptr *QJsonArray) FromStringList(list []string) *QJsonArray {
-	var listC = C.CString(strings.Join(list, "|"))
+	var listC = cGoPackStringList(list)
 	defer C.free(unsafe.Pointer(listC))
 	var tmpValue = NewQJsonArrayFromPointer(C.QJsonArray_QJsonArray_FromStringList(listC))
 	runtime.SetFinalizer(tmpValue, (*QJsonArray).DestroyQJsonArray)
@@ -18301,12 +18854,20 @@ func NewQJsonArray() *QJsonArray {
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonArray() *QJsonArray {
+	return NewQJsonArrayFromPointer(C.QJsonArray_NewQJsonArrayInArena(arena.Pointer()))
+}
+
 func NewQJsonArray3(other QJsonArray_ITF) *QJsonArray {
 	var tmpValue = NewQJsonArrayFromPointer(C.QJsonArray_NewQJsonArray3(PointerFromQJsonArray(other)))
 	runtime.SetFinalizer(tmpValue, (*QJsonArray).DestroyQJsonArray)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonArray3(other QJsonArray_ITF) *QJsonArray {
+	return NewQJsonArrayFromPointer(C.QJsonArray_NewQJsonArray3InArena(arena.Pointer(), PointerFromQJsonArray(other)))
+}
+
 func (ptr *QJsonArray) TakeAt(i int) *QJsonValue {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQJsonValueFromPointer(C.QJsonArray_TakeAt(ptr.Pointer(), C.int(int32(i))))
@@ -18616,24 +19177,40 @@ func NewQJsonDocument() *QJsonDocument {
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonDocument() *QJsonDocument {
+	return NewQJsonDocumentFromPointer(C.QJsonDocument_NewQJsonDocumentInArena(arena.Pointer()))
+}
+
 func NewQJsonDocument3(array QJsonArray_ITF) *QJsonDocument {
 	var tmpValue = NewQJsonDocumentFromPointer(C.QJsonDocument_NewQJsonDocument3(PointerFromQJsonArray(array)))
 	runtime.SetFinalizer(tmpValue, (*QJsonDocument).DestroyQJsonDocument)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonDocument3(array QJsonArray_ITF) *QJsonDocument {
+	return NewQJsonDocumentFromPointer(C.QJsonDocument_NewQJsonDocument3InArena(arena.Pointer(), PointerFromQJsonArray(array)))
+}
+
 func NewQJsonDocument4(other QJsonDocument_ITF) *QJsonDocument {
 	var tmpValue = NewQJsonDocumentFromPointer(C.QJsonDocument_NewQJsonDocument4(PointerFromQJsonDocument(other)))
 	runtime.SetFinalizer(tmpValue, (*QJsonDocument).DestroyQJsonDocument)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonDocument4(other QJsonDocument_ITF) *QJsonDocument {
+	return NewQJsonDocumentFromPointer(C.QJsonDocument_NewQJsonDocument4InArena(arena.Pointer(), PointerFromQJsonDocument(other)))
+}
+
 func NewQJsonDocument2(object QJsonObject_ITF) *QJsonDocument {
 	var tmpValue = NewQJsonDocumentFromPointer(C.QJsonDocument_NewQJsonDocument2(PointerFromQJsonObject(object)))
 	runtime.SetFinalizer(tmpValue, (*QJsonDocument).DestroyQJsonDocument)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonDocument2(object QJsonObject_ITF) *QJsonDocument {
+	return NewQJsonDocumentFromPointer(C.QJsonDocument_NewQJsonDocument2InArena(arena.Pointer(), PointerFromQJsonObject(object)))
+}
+
 func (ptr *QJsonDocument) SetArray(array QJsonArray_ITF) {
 	if ptr.Pointer() != nil {
 		C.QJsonDocument_SetArray(ptr.Pointer(), PointerFromQJsonArray(array))
@@ -18800,12 +19377,20 @@ func NewQJsonObject() *QJsonObject {
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonObject() *QJsonObject {
+	return NewQJsonObjectFromPointer(C.QJsonObject_NewQJsonObjectInArena(arena.Pointer()))
+}
+
 func NewQJsonObject3(other QJsonObject_ITF) *QJsonObject {
 	var tmpValue = NewQJsonObjectFromPointer(C.QJsonObject_NewQJsonObject3(PointerFromQJsonObject(other)))
 	runtime.SetFinalizer(tmpValue, (*QJsonObject).DestroyQJsonObject)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonObject3(other QJsonObject_ITF) *QJsonObject {
+	return NewQJsonObjectFromPointer(C.QJsonObject_NewQJsonObject3InArena(arena.Pointer(), PointerFromQJsonObject(other)))
+}
+
 func (ptr *QJsonObject) Take(key string) *QJsonValue {
 	if ptr.Pointer() != nil {
 		var keyC = C.CString(key)
@@ -18854,7 +19439,7 @@ func (ptr *QJsonObject) Value(key string) *QJsonValue {
 
 func (ptr *QJsonObject) Keys() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QJsonObject_Keys(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QJsonObject_Keys(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -19290,36 +19875,60 @@ func NewQJsonValue7(s QLatin1String_ITF) *QJsonValue {
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue7(s QLatin1String_ITF) *QJsonValue {
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue7InArena(arena.Pointer(), PointerFromQLatin1String(s)))
+}
+
 func NewQJsonValue(ty QJsonValue__Type) *QJsonValue {
 	var tmpValue = NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue(C.longlong(ty)))
 	runtime.SetFinalizer(tmpValue, (*QJsonValue).DestroyQJsonValue)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue(ty QJsonValue__Type) *QJsonValue {
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValueInArena(arena.Pointer(), C.longlong(ty)))
+}
+
 func NewQJsonValue2(b bool) *QJsonValue {
 	var tmpValue = NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue2(C.char(int8(qt.GoBoolToInt(b)))))
 	runtime.SetFinalizer(tmpValue, (*QJsonValue).DestroyQJsonValue)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue2(b bool) *QJsonValue {
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue2InArena(arena.Pointer(), C.char(int8(qt.GoBoolToInt(b)))))
+}
+
 func NewQJsonValue9(a QJsonArray_ITF) *QJsonValue {
 	var tmpValue = NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue9(PointerFromQJsonArray(a)))
 	runtime.SetFinalizer(tmpValue, (*QJsonValue).DestroyQJsonValue)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue9(a QJsonArray_ITF) *QJsonValue {
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue9InArena(arena.Pointer(), PointerFromQJsonArray(a)))
+}
+
 func NewQJsonValue10(o QJsonObject_ITF) *QJsonValue {
 	var tmpValue = NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue10(PointerFromQJsonObject(o)))
 	runtime.SetFinalizer(tmpValue, (*QJsonValue).DestroyQJsonValue)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue10(o QJsonObject_ITF) *QJsonValue {
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue10InArena(arena.Pointer(), PointerFromQJsonObject(o)))
+}
+
 func NewQJsonValue11(other QJsonValue_ITF) *QJsonValue {
 	var tmpValue = NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue11(PointerFromQJsonValue(other)))
 	runtime.SetFinalizer(tmpValue, (*QJsonValue).DestroyQJsonValue)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue11(other QJsonValue_ITF) *QJsonValue {
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue11InArena(arena.Pointer(), PointerFromQJsonValue(other)))
+}
+
 func NewQJsonValue6(s string) *QJsonValue {
 	var sC = C.CString(s)
 	defer C.free(unsafe.Pointer(sC))
@@ -19328,6 +19937,12 @@ func NewQJsonValue6(s string) *QJsonValue {
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue6(s string) *QJsonValue {
+	var sC = C.CString(s)
+	defer C.free(unsafe.Pointer(sC))
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue6InArena(arena.Pointer(), sC))
+}
+
 func NewQJsonValue8(s string) *QJsonValue {
 	var sC = C.CString(s)
 	defer C.free(unsafe.Pointer(sC))
@@ -19336,24 +19951,42 @@ func NewQJsonValue8(s string) *QJsonValue {
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue8(s string) *QJsonValue {
+	var sC = C.CString(s)
+	defer C.free(unsafe.Pointer(sC))
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue8InArena(arena.Pointer(), sC))
+}
+
 func NewQJsonValue3(n float64) *QJsonValue {
 	var tmpValue = NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue3(C.double(n)))
 	runtime.SetFinalizer(tmpValue, (*QJsonValue).DestroyQJsonValue)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue3(n float64) *QJsonValue {
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue3InArena(arena.Pointer(), C.double(n)))
+}
+
 func NewQJsonValue4(n int) *QJsonValue {
 	var tmpValue = NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue4(C.int(int32(n))))
 	runtime.SetFinalizer(tmpValue, (*QJsonValue).DestroyQJsonValue)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue4(n int) *QJsonValue {
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue4InArena(arena.Pointer(), C.int(int32(n))))
+}
+
 func NewQJsonValue5(n int64) *QJsonValue {
 	var tmpValue = NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue5(C.longlong(n)))
 	runtime.SetFinalizer(tmpValue, (*QJsonValue).DestroyQJsonValue)
 	return tmpValue
 }
 
+func (arena *Arena) NewQJsonValue5(n int64) *QJsonValue {
+	return NewQJsonValueFromPointer(C.QJsonValue_NewQJsonValue5InArena(arena.Pointer(), C.longlong(n)))
+}
+
 func (ptr *QJsonValue) DestroyQJsonValue() {
 	if ptr.Pointer() != nil {
 		C.QJsonValue_DestroyQJsonValue(ptr.Pointer())
@@ -19552,6 +20185,12 @@ func NewQLatin1Char(c string) *QLatin1Char {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLatin1Char(c string) *QLatin1Char {
+	var cC = C.CString(c)
+	defer C.free(unsafe.Pointer(cC))
+	return NewQLatin1CharFromPointer(C.QLatin1Char_NewQLatin1CharInArena(arena.Pointer(), cC))
+}
+
 func (ptr *QLatin1Char) ToLatin1() string {
 	if ptr.Pointer() != nil {
 		return cGoUnpackString(C.QLatin1Char_ToLatin1(ptr.Pointer()))
@@ -19617,12 +20256,20 @@ func NewQLatin1String() *QLatin1String {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLatin1String() *QLatin1String {
+	return NewQLatin1StringFromPointer(C.QLatin1String_NewQLatin1StringInArena(arena.Pointer()))
+}
+
 func NewQLatin1String4(str QByteArray_ITF) *QLatin1String {
 	var tmpValue = NewQLatin1StringFromPointer(C.QLatin1String_NewQLatin1String4(PointerFromQByteArray(str)))
 	runtime.SetFinalizer(tmpValue, (*QLatin1String).DestroyQLatin1String)
 	return tmpValue
 }
 
+func (arena *Arena) NewQLatin1String4(str QByteArray_ITF) *QLatin1String {
+	return NewQLatin1StringFromPointer(C.QLatin1String_NewQLatin1String4InArena(arena.Pointer(), PointerFromQByteArray(str)))
+}
+
 func NewQLatin1String2(str string) *QLatin1String {
 	var strC = C.CString(str)
 	defer C.free(unsafe.Pointer(strC))
@@ -19631,6 +20278,12 @@ func NewQLatin1String2(str string) *QLatin1String {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLatin1String2(str string) *QLatin1String {
+	var strC = C.CString(str)
+	defer C.free(unsafe.Pointer(strC))
+	return NewQLatin1StringFromPointer(C.QLatin1String_NewQLatin1String2InArena(arena.Pointer(), strC))
+}
+
 func NewQLatin1String3(str string, size int) *QLatin1String {
 	var strC = C.CString(str)
 	defer C.free(unsafe.Pointer(strC))
@@ -19639,6 +20292,12 @@ func NewQLatin1String3(str string, size int) *QLatin1String {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLatin1String3(str string, size int) *QLatin1String {
+	var strC = C.CString(str)
+	defer C.free(unsafe.Pointer(strC))
+	return NewQLatin1StringFromPointer(C.QLatin1String_NewQLatin1String3InArena(arena.Pointer(), strC, C.int(int32(size))))
+}
+
 func (ptr *QLatin1String) Left(length int) *QLatin1String {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQLatin1StringFromPointer(C.QLatin1String_Left(ptr.Pointer(), C.int(int32(length))))
@@ -19749,7 +20408,7 @@ const (
 
 func NewQLibrary(parent QObject_ITF) *QLibrary {
 	var tmpValue = NewQLibraryFromPointer(C.QLibrary_NewQLibrary(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -19759,7 +20418,7 @@ func NewQLibrary2(fileName string, parent QObject_ITF) *QLibrary {
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQLibraryFromPointer(C.QLibrary_NewQLibrary2(fileNameC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -19771,7 +20430,7 @@ func NewQLibrary4(fileName string, version string, parent QObject_ITF) *QLibrary
 	var versionC = C.CString(version)
 	defer C.free(unsafe.Pointer(versionC))
 	var tmpValue = NewQLibraryFromPointer(C.QLibrary_NewQLibrary4(fileNameC, versionC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -19781,7 +20440,7 @@ func NewQLibrary3(fileName string, verNum int, parent QObject_ITF) *QLibrary {
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQLibraryFromPointer(C.QLibrary_NewQLibrary3(fileNameC, C.int(int32(verNum)), PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -19848,7 +20507,7 @@ func (ptr *QLibrary) SetLoadHints(hints QLibrary__LoadHint) {
 func (ptr *QLibrary) DestroyQLibrary() {
 	if ptr.Pointer() != nil {
 		C.QLibrary_DestroyQLibrary(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -20027,18 +20686,30 @@ func NewQLine() *QLine {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLine() *QLine {
+	return NewQLineFromPointer(C.QLine_NewQLineInArena(arena.Pointer()))
+}
+
 func NewQLine2(p1 QPoint_ITF, p2 QPoint_ITF) *QLine {
 	var tmpValue = NewQLineFromPointer(C.QLine_NewQLine2(PointerFromQPoint(p1), PointerFromQPoint(p2)))
 	runtime.SetFinalizer(tmpValue, (*QLine).DestroyQLine)
 	return tmpValue
 }
 
+func (arena *Arena) NewQLine2(p1 QPoint_ITF, p2 QPoint_ITF) *QLine {
+	return NewQLineFromPointer(C.QLine_NewQLine2InArena(arena.Pointer(), PointerFromQPoint(p1), PointerFromQPoint(p2)))
+}
+
 func NewQLine3(x1 int, y1 int, x2 int, y2 int) *QLine {
 	var tmpValue = NewQLineFromPointer(C.QLine_NewQLine3(C.int(int32(x1)), C.int(int32(y1)), C.int(int32(x2)), C.int(int32(y2))))
 	runtime.SetFinalizer(tmpValue, (*QLine).DestroyQLine)
 	return tmpValue
 }
 
+func (arena *Arena) NewQLine3(x1 int, y1 int, x2 int, y2 int) *QLine {
+	return NewQLineFromPointer(C.QLine_NewQLine3InArena(arena.Pointer(), C.int(int32(x1)), C.int(int32(y1)), C.int(int32(x2)), C.int(int32(y2))))
+}
+
 func (ptr *QLine) SetLine(x1 int, y1 int, x2 int, y2 int) {
 	if ptr.Pointer() != nil {
 		C.QLine_SetLine(ptr.Pointer(), C.int(int32(x1)), C.int(int32(y1)), C.int(int32(x2)), C.int(int32(y2)))
@@ -20255,24 +20926,40 @@ func NewQLineF() *QLineF {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLineF() *QLineF {
+	return NewQLineFFromPointer(C.QLineF_NewQLineFInArena(arena.Pointer()))
+}
+
 func NewQLineF4(line QLine_ITF) *QLineF {
 	var tmpValue = NewQLineFFromPointer(C.QLineF_NewQLineF4(PointerFromQLine(line)))
 	runtime.SetFinalizer(tmpValue, (*QLineF).DestroyQLineF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQLineF4(line QLine_ITF) *QLineF {
+	return NewQLineFFromPointer(C.QLineF_NewQLineF4InArena(arena.Pointer(), PointerFromQLine(line)))
+}
+
 func NewQLineF2(p1 QPointF_ITF, p2 QPointF_ITF) *QLineF {
 	var tmpValue = NewQLineFFromPointer(C.QLineF_NewQLineF2(PointerFromQPointF(p1), PointerFromQPointF(p2)))
 	runtime.SetFinalizer(tmpValue, (*QLineF).DestroyQLineF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQLineF2(p1 QPointF_ITF, p2 QPointF_ITF) *QLineF {
+	return NewQLineFFromPointer(C.QLineF_NewQLineF2InArena(arena.Pointer(), PointerFromQPointF(p1), PointerFromQPointF(p2)))
+}
+
 func NewQLineF3(x1 float64, y1 float64, x2 float64, y2 float64) *QLineF {
 	var tmpValue = NewQLineFFromPointer(C.QLineF_NewQLineF3(C.double(x1), C.double(y1), C.double(x2), C.double(y2)))
 	runtime.SetFinalizer(tmpValue, (*QLineF).DestroyQLineF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQLineF3(x1 float64, y1 float64, x2 float64, y2 float64) *QLineF {
+	return NewQLineFFromPointer(C.QLineF_NewQLineF3InArena(arena.Pointer(), C.double(x1), C.double(y1), C.double(x2), C.double(y2)))
+}
+
 func (ptr *QLineF) SetAngle(angle float64) {
 	if ptr.Pointer() != nil {
 		C.QLineF_SetAngle(ptr.Pointer(), C.double(angle))
@@ -21590,24 +22277,40 @@ func NewQLocale() *QLocale {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLocale() *QLocale {
+	return NewQLocaleFromPointer(C.QLocale_NewQLocaleInArena(arena.Pointer()))
+}
+
 func NewQLocale3(language QLocale__Language, country QLocale__Country) *QLocale {
 	var tmpValue = NewQLocaleFromPointer(C.QLocale_NewQLocale3(C.longlong(language), C.longlong(country)))
 	runtime.SetFinalizer(tmpValue, (*QLocale).DestroyQLocale)
 	return tmpValue
 }
 
+func (arena *Arena) NewQLocale3(language QLocale__Language, country QLocale__Country) *QLocale {
+	return NewQLocaleFromPointer(C.QLocale_NewQLocale3InArena(arena.Pointer(), C.longlong(language), C.longlong(country)))
+}
+
 func NewQLocale4(language QLocale__Language, script QLocale__Script, country QLocale__Country) *QLocale {
 	var tmpValue = NewQLocaleFromPointer(C.QLocale_NewQLocale4(C.longlong(language), C.longlong(script), C.longlong(country)))
 	runtime.SetFinalizer(tmpValue, (*QLocale).DestroyQLocale)
 	return tmpValue
 }
 
+func (arena *Arena) NewQLocale4(language QLocale__Language, script QLocale__Script, country QLocale__Country) *QLocale {
+	return NewQLocaleFromPointer(C.QLocale_NewQLocale4InArena(arena.Pointer(), C.longlong(language), C.longlong(script), C.longlong(country)))
+}
+
 func NewQLocale5(other QLocale_ITF) *QLocale {
 	var tmpValue = NewQLocaleFromPointer(C.QLocale_NewQLocale5(PointerFromQLocale(other)))
 	runtime.SetFinalizer(tmpValue, (*QLocale).DestroyQLocale)
 	return tmpValue
 }
 
+func (arena *Arena) NewQLocale5(other QLocale_ITF) *QLocale {
+	return NewQLocaleFromPointer(C.QLocale_NewQLocale5InArena(arena.Pointer(), PointerFromQLocale(other)))
+}
+
 func NewQLocale2(name string) *QLocale {
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
@@ -21616,6 +22319,12 @@ func NewQLocale2(name string) *QLocale {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLocale2(name string) *QLocale {
+	var nameC = C.CString(name)
+	defer C.free(unsafe.Pointer(nameC))
+	return NewQLocaleFromPointer(C.QLocale_NewQLocale2InArena(arena.Pointer(), nameC))
+}
+
 func QLocale_CountryToString(country QLocale__Country) string {
 	return cGoUnpackString(C.QLocale_QLocale_CountryToString(C.longlong(country)))
 }
@@ -21835,7 +22544,7 @@ func (ptr *QLocale) Bcp47Name() string {
 
 func (ptr *QLocale) CreateSeparatedList(list []string) string {
 	if ptr.Pointer() != nil {
-		var listC = C.CString(strings.Join(list, "|"))
+		var listC = cGoPackStringList(list)
 		defer C.free(unsafe.Pointer(listC))
 		return cGoUnpackString(C.QLocale_CreateSeparatedList(ptr.Pointer(), listC))
 	}
@@ -22160,7 +22869,7 @@ func (ptr *QLocale) ToUpper(str string) string {
 
 func (ptr *QLocale) UiLanguages() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QLocale_UiLanguages(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QLocale_UiLanguages(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -22431,6 +23140,12 @@ func NewQLockFile(fileName string) *QLockFile {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLockFile(fileName string) *QLockFile {
+	var fileNameC = C.CString(fileName)
+	defer C.free(unsafe.Pointer(fileNameC))
+	return NewQLockFileFromPointer(C.QLockFile_NewQLockFileInArena(arena.Pointer(), fileNameC))
+}
+
 func (ptr *QLockFile) Lock() bool {
 	if ptr.Pointer() != nil {
 		return C.QLockFile_Lock(ptr.Pointer()) != 0
@@ -22556,6 +23271,12 @@ func NewQLoggingCategory(category string) *QLoggingCategory {
 	return tmpValue
 }
 
+func (arena *Arena) NewQLoggingCategory(category string) *QLoggingCategory {
+	var categoryC = C.CString(category)
+	defer C.free(unsafe.Pointer(categoryC))
+	return NewQLoggingCategoryFromPointer(C.QLoggingCategory_NewQLoggingCategoryInArena(arena.Pointer(), categoryC))
+}
+
 func QLoggingCategory_SetFilterRules(rules string) {
 	var rulesC = C.CString(rules)
 	defer C.free(unsafe.Pointer(rulesC))
@@ -22744,12 +23465,20 @@ func NewQMargins() *QMargins {
 	return tmpValue
 }
 
+func (arena *Arena) NewQMargins() *QMargins {
+	return NewQMarginsFromPointer(C.QMargins_NewQMarginsInArena(arena.Pointer()))
+}
+
 func NewQMargins2(left int, top int, right int, bottom int) *QMargins {
 	var tmpValue = NewQMarginsFromPointer(C.QMargins_NewQMargins2(C.int(int32(left)), C.int(int32(top)), C.int(int32(right)), C.int(int32(bottom))))
 	runtime.SetFinalizer(tmpValue, (*QMargins).DestroyQMargins)
 	return tmpValue
 }
 
+func (arena *Arena) NewQMargins2(left int, top int, right int, bottom int) *QMargins {
+	return NewQMarginsFromPointer(C.QMargins_NewQMargins2InArena(arena.Pointer(), C.int(int32(left)), C.int(int32(top)), C.int(int32(right)), C.int(int32(bottom))))
+}
+
 func (ptr *QMargins) SetBottom(bottom int) {
 	if ptr.Pointer() != nil {
 		C.QMargins_SetBottom(ptr.Pointer(), C.int(int32(bottom)))
@@ -22860,18 +23589,30 @@ func NewQMarginsF() *QMarginsF {
 	return tmpValue
 }
 
+func (arena *Arena) NewQMarginsF() *QMarginsF {
+	return NewQMarginsFFromPointer(C.QMarginsF_NewQMarginsFInArena(arena.Pointer()))
+}
+
 func NewQMarginsF3(margins QMargins_ITF) *QMarginsF {
 	var tmpValue = NewQMarginsFFromPointer(C.QMarginsF_NewQMarginsF3(PointerFromQMargins(margins)))
 	runtime.SetFinalizer(tmpValue, (*QMarginsF).DestroyQMarginsF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQMarginsF3(margins QMargins_ITF) *QMarginsF {
+	return NewQMarginsFFromPointer(C.QMarginsF_NewQMarginsF3InArena(arena.Pointer(), PointerFromQMargins(margins)))
+}
+
 func NewQMarginsF2(left float64, top float64, right float64, bottom float64) *QMarginsF {
 	var tmpValue = NewQMarginsFFromPointer(C.QMarginsF_NewQMarginsF2(C.double(left), C.double(top), C.double(right), C.double(bottom)))
 	runtime.SetFinalizer(tmpValue, (*QMarginsF).DestroyQMarginsF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQMarginsF2(left float64, top float64, right float64, bottom float64) *QMarginsF {
+	return NewQMarginsFFromPointer(C.QMarginsF_NewQMarginsF2InArena(arena.Pointer(), C.double(left), C.double(top), C.double(right), C.double(bottom)))
+}
+
 func (ptr *QMarginsF) SetBottom(bottom float64) {
 	if ptr.Pointer() != nil {
 		C.QMarginsF_SetBottom(ptr.Pointer(), C.double(bottom))
@@ -22995,6 +23736,10 @@ func NewQMessageAuthenticationCode(method QCryptographicHash__Algorithm, key QBy
 	return tmpValue
 }
 
+func (arena *Arena) NewQMessageAuthenticationCode(method QCryptographicHash__Algorithm, key QByteArray_ITF) *QMessageAuthenticationCode {
+	return NewQMessageAuthenticationCodeFromPointer(C.QMessageAuthenticationCode_NewQMessageAuthenticationCodeInArena(arena.Pointer(), C.longlong(method), PointerFromQByteArray(key)))
+}
+
 func (ptr *QMessageAuthenticationCode) AddData3(device QIODevice_ITF) bool {
 	if ptr.Pointer() != nil {
 		return C.QMessageAuthenticationCode_AddData3(ptr.Pointer(), PointerFromQIODevice(device)) != 0
@@ -23187,6 +23932,10 @@ func NewQMessageLogger() *QMessageLogger {
 	return tmpValue
 }
 
+func (arena *Arena) NewQMessageLogger() *QMessageLogger {
+	return NewQMessageLoggerFromPointer(C.QMessageLogger_NewQMessageLoggerInArena(arena.Pointer()))
+}
+
 func NewQMessageLogger2(file string, line int, function string) *QMessageLogger {
 	var fileC = C.CString(file)
 	defer C.free(unsafe.Pointer(fileC))
@@ -23197,6 +23946,14 @@ func NewQMessageLogger2(file string, line int, function string) *QMessageLogger
 	return tmpValue
 }
 
+func (arena *Arena) NewQMessageLogger2(file string, line int, function string) *QMessageLogger {
+	var fileC = C.CString(file)
+	defer C.free(unsafe.Pointer(fileC))
+	var functionC = C.CString(function)
+	defer C.free(unsafe.Pointer(functionC))
+	return NewQMessageLoggerFromPointer(C.QMessageLogger_NewQMessageLogger2InArena(arena.Pointer(), fileC, C.int(int32(line)), functionC))
+}
+
 func NewQMessageLogger3(file string, line int, function string, category string) *QMessageLogger {
 	var fileC = C.CString(file)
 	defer C.free(unsafe.Pointer(fileC))
@@ -23209,6 +23966,16 @@ func NewQMessageLogger3(file string, line int, function string, category string)
 	return tmpValue
 }
 
+func (arena *Arena) NewQMessageLogger3(file string, line int, function string, category string) *QMessageLogger {
+	var fileC = C.CString(file)
+	defer C.free(unsafe.Pointer(fileC))
+	var functionC = C.CString(function)
+	defer C.free(unsafe.Pointer(functionC))
+	var categoryC = C.CString(category)
+	defer C.free(unsafe.Pointer(categoryC))
+	return NewQMessageLoggerFromPointer(C.QMessageLogger_NewQMessageLogger3InArena(arena.Pointer(), fileC, C.int(int32(line)), functionC, categoryC))
+}
+
 func (ptr *QMessageLogger) Critical4() *QDebug {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDebugFromPointer(C.QMessageLogger_Critical4(ptr.Pointer()))
@@ -23575,26 +24342,26 @@ func (ptr *QMetaMethod) Name() *QByteArray {
 
 func (ptr *QMetaMethod) ParameterNames() []*QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtCore_PackedList) []*QByteArray {
-			var out = make([]*QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQMetaMethodFromPointer(l.data).__parameterNames_atList(i)
+		return func(l []string) []*QByteArray {
+			var out = make([]*QByteArray, len(l))
+			for i, v := range l {
+				out[i] = NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QMetaMethod_ParameterNames(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QMetaMethod_ParameterNames(ptr.Pointer())))
 	}
 	return make([]*QByteArray, 0)
 }
 
 func (ptr *QMetaMethod) ParameterTypes() []*QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtCore_PackedList) []*QByteArray {
-			var out = make([]*QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQMetaMethodFromPointer(l.data).__parameterTypes_atList(i)
+		return func(l []string) []*QByteArray {
+			var out = make([]*QByteArray, len(l))
+			for i, v := range l {
+				out[i] = NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QMetaMethod_ParameterTypes(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QMetaMethod_ParameterTypes(ptr.Pointer())))
 	}
 	return make([]*QByteArray, 0)
 }
@@ -23913,7 +24680,7 @@ func (ptr *QMetaObject) Method(index int) *QMetaMethod {
 func (ptr *QMetaObject) NewInstance(val0 QGenericArgument_ITF, val1 QGenericArgument_ITF, val2 QGenericArgument_ITF, val3 QGenericArgument_ITF, val4 QGenericArgument_ITF, val5 QGenericArgument_ITF, val6 QGenericArgument_ITF, val7 QGenericArgument_ITF, val8 QGenericArgument_ITF, val9 QGenericArgument_ITF) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QMetaObject_NewInstance(ptr.Pointer(), PointerFromQGenericArgument(val0), PointerFromQGenericArgument(val1), PointerFromQGenericArgument(val2), PointerFromQGenericArgument(val3), PointerFromQGenericArgument(val4), PointerFromQGenericArgument(val5), PointerFromQGenericArgument(val6), PointerFromQGenericArgument(val7), PointerFromQGenericArgument(val8), PointerFromQGenericArgument(val9)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -24445,6 +25212,10 @@ func NewQMetaType(typeId int) *QMetaType {
 	return tmpValue
 }
 
+func (arena *Arena) NewQMetaType(typeId int) *QMetaType {
+	return NewQMetaTypeFromPointer(C.QMetaType_NewQMetaTypeInArena(arena.Pointer(), C.int(int32(typeId))))
+}
+
 func QMetaType_TypeFlags(ty int) QMetaType__TypeFlag {
 	return QMetaType__TypeFlag(C.QMetaType_QMetaType_TypeFlags(C.int(int32(ty))))
 }
@@ -24693,7 +25464,7 @@ func NewQMimeDataFromPointer(ptr unsafe.Pointer) *QMimeData {
 }
 func NewQMimeData() *QMimeData {
 	var tmpValue = NewQMimeDataFromPointer(C.QMimeData_NewQMimeData())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -24764,7 +25535,7 @@ func (ptr *QMimeData) SetUrls(urls []*QUrl) {
 func (ptr *QMimeData) DestroyQMimeData() {
 	if ptr.Pointer() != nil {
 		C.QMimeData_DestroyQMimeData(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -24834,7 +25605,7 @@ func (ptr *QMimeData) HasColor() bool {
 
 //export callbackQMimeData_HasFormat
 func callbackQMimeData_HasFormat(ptr unsafe.Pointer, mimeType C.struct_QtCore_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasFormat"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasFormat"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(mimeType)))))
 	}
 
@@ -24844,14 +25615,14 @@ func callbackQMimeData_HasFormat(ptr unsafe.Pointer, mimeType C.struct_QtCore_Pa
 func (ptr *QMimeData) ConnectHasFormat(f func(mimeType string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasFormat", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasFormat", f)
 	}
 }
 
 func (ptr *QMimeData) DisconnectHasFormat() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasFormat")
+		qt.DisconnectSignal(ptr.Pointer(), "hasFormat")
 	}
 }
 
@@ -24993,6 +25764,10 @@ func NewQMimeDatabase() *QMimeDatabase {
 	return tmpValue
 }
 
+func (arena *Arena) NewQMimeDatabase() *QMimeDatabase {
+	return NewQMimeDatabaseFromPointer(C.QMimeDatabase_NewQMimeDatabaseInArena(arena.Pointer()))
+}
+
 func (ptr *QMimeDatabase) DestroyQMimeDatabase() {
 	if ptr.Pointer() != nil {
 		C.QMimeDatabase_DestroyQMimeDatabase(ptr.Pointer())
@@ -25198,12 +25973,20 @@ func NewQMimeType() *QMimeType {
 	return tmpValue
 }
 
+func (arena *Arena) NewQMimeType() *QMimeType {
+	return NewQMimeTypeFromPointer(C.QMimeType_NewQMimeTypeInArena(arena.Pointer()))
+}
+
 func NewQMimeType2(other QMimeType_ITF) *QMimeType {
 	var tmpValue = NewQMimeTypeFromPointer(C.QMimeType_NewQMimeType2(PointerFromQMimeType(other)))
 	runtime.SetFinalizer(tmpValue, (*QMimeType).DestroyQMimeType)
 	return tmpValue
 }
 
+func (arena *Arena) NewQMimeType2(other QMimeType_ITF) *QMimeType {
+	return NewQMimeTypeFromPointer(C.QMimeType_NewQMimeType2InArena(arena.Pointer(), PointerFromQMimeType(other)))
+}
+
 func (ptr *QMimeType) Swap(other QMimeType_ITF) {
 	if ptr.Pointer() != nil {
 		C.QMimeType_Swap(ptr.Pointer(), PointerFromQMimeType(other))
@@ -25261,35 +26044,35 @@ func (ptr *QMimeType) PreferredSuffix() string {
 
 func (ptr *QMimeType) Aliases() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QMimeType_Aliases(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QMimeType_Aliases(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QMimeType) AllAncestors() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QMimeType_AllAncestors(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QMimeType_AllAncestors(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QMimeType) GlobPatterns() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QMimeType_GlobPatterns(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QMimeType_GlobPatterns(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QMimeType) ParentMimeTypes() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QMimeType_ParentMimeTypes(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QMimeType_ParentMimeTypes(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QMimeType) Suffixes() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QMimeType_Suffixes(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QMimeType_Suffixes(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -25368,6 +26151,10 @@ func NewQModelIndex() *QModelIndex {
 	return tmpValue
 }
 
+func (arena *Arena) NewQModelIndex() *QModelIndex {
+	return NewQModelIndexFromPointer(C.QModelIndex_NewQModelIndexInArena(arena.Pointer()))
+}
+
 func (ptr *QModelIndex) Parent() *QModelIndex {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQModelIndexFromPointer(C.QModelIndex_Parent(ptr.Pointer()))
@@ -25412,7 +26199,7 @@ func (ptr *QModelIndex) IsValid() bool {
 func (ptr *QModelIndex) Model() *QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractItemModelFromPointer(C.QModelIndex_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -25883,6 +26670,10 @@ func NewQMutex(mode QMutex__RecursionMode) *QMutex {
 	return tmpValue
 }
 
+func (arena *Arena) NewQMutex(mode QMutex__RecursionMode) *QMutex {
+	return NewQMutexFromPointer(C.QMutex_NewQMutexInArena(arena.Pointer(), C.longlong(mode)))
+}
+
 func (ptr *QMutex) Try_lock() bool {
 	if ptr.Pointer() != nil {
 		return C.QMutex_Try_lock(ptr.Pointer()) != 0
@@ -25946,6 +26737,10 @@ func NewQMutexLocker(mutex QMutex_ITF) *QMutexLocker {
 	return tmpValue
 }
 
+func (arena *Arena) NewQMutexLocker(mutex QMutex_ITF) *QMutexLocker {
+	return NewQMutexLockerFromPointer(C.QMutexLocker_NewQMutexLockerInArena(arena.Pointer(), PointerFromQMutex(mutex)))
+}
+
 func (ptr *QMutexLocker) Relock() {
 	if ptr.Pointer() != nil {
 		C.QMutexLocker_Relock(ptr.Pointer())
@@ -26011,7 +26806,7 @@ func NewQObjectFromPointer(ptr unsafe.Pointer) *QObject {
 }
 func NewQObject(parent QObject_ITF) *QObject {
 	var tmpValue = NewQObjectFromPointer(C.QObject_NewQObject(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -26066,7 +26861,7 @@ func (ptr *QObject) Disconnect(sender QObject_ITF, sign string, receiver QObject
 
 //export callbackQObject_Event
 func callbackQObject_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QEvent) bool)(NewQEventFromPointer(e)))))
 	}
 
@@ -26076,14 +26871,14 @@ func callbackQObject_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
 func (ptr *QObject) ConnectEvent(f func(e *QEvent) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "event", f)
+		qt.ConnectSignal(ptr.Pointer(), "event", f)
 	}
 }
 
 func (ptr *QObject) DisconnectEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "event")
+		qt.DisconnectSignal(ptr.Pointer(), "event")
 	}
 }
 
@@ -26103,7 +26898,7 @@ func (ptr *QObject) EventDefault(e QEvent_ITF) bool {
 
 //export callbackQObject_EventFilter
 func callbackQObject_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QObject, *QEvent) bool)(NewQObjectFromPointer(watched), NewQEventFromPointer(event)))))
 	}
 
@@ -26113,14 +26908,14 @@ func callbackQObject_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, eve
 func (ptr *QObject) ConnectEventFilter(f func(watched *QObject, event *QEvent) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "eventFilter", f)
+		qt.ConnectSignal(ptr.Pointer(), "eventFilter", f)
 	}
 }
 
 func (ptr *QObject) DisconnectEventFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "eventFilter")
+		qt.DisconnectSignal(ptr.Pointer(), "eventFilter")
 	}
 }
 
@@ -26156,7 +26951,7 @@ func (ptr *QObject) StartTimer(interval int, timerType Qt__TimerType) int {
 
 //export callbackQObject_ChildEvent
 func callbackQObject_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*QChildEvent))(NewQChildEventFromPointer(event))
 	} else {
 		NewQObjectFromPointer(ptr).ChildEventDefault(NewQChildEventFromPointer(event))
@@ -26166,14 +26961,14 @@ func callbackQObject_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QObject) ConnectChildEvent(f func(event *QChildEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "childEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "childEvent", f)
 	}
 }
 
 func (ptr *QObject) DisconnectChildEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "childEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "childEvent")
 	}
 }
 
@@ -26191,7 +26986,7 @@ func (ptr *QObject) ChildEventDefault(event QChildEvent_ITF) {
 
 //export callbackQObject_ConnectNotify
 func callbackQObject_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*QMetaMethod))(NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQObjectFromPointer(ptr).ConnectNotifyDefault(NewQMetaMethodFromPointer(sign))
@@ -26201,14 +26996,14 @@ func callbackQObject_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
 func (ptr *QObject) ConnectConnectNotify(f func(sign *QMetaMethod)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "connectNotify", f)
+		qt.ConnectSignal(ptr.Pointer(), "connectNotify", f)
 	}
 }
 
 func (ptr *QObject) DisconnectConnectNotify() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "connectNotify")
+		qt.DisconnectSignal(ptr.Pointer(), "connectNotify")
 	}
 }
 
@@ -26226,7 +27021,7 @@ func (ptr *QObject) ConnectNotifyDefault(sign QMetaMethod_ITF) {
 
 //export callbackQObject_CustomEvent
 func callbackQObject_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	} else {
 		NewQObjectFromPointer(ptr).CustomEventDefault(NewQEventFromPointer(event))
@@ -26236,14 +27031,14 @@ func callbackQObject_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QObject) ConnectCustomEvent(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "customEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "customEvent", f)
 	}
 }
 
 func (ptr *QObject) DisconnectCustomEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "customEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "customEvent")
 	}
 }
 
@@ -26261,7 +27056,7 @@ func (ptr *QObject) CustomEventDefault(event QEvent_ITF) {
 
 //export callbackQObject_DeleteLater
 func callbackQObject_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQObjectFromPointer(ptr).DeleteLaterDefault()
@@ -26271,21 +27066,21 @@ func callbackQObject_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QObject) ConnectDeleteLater(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "deleteLater", f)
+		qt.ConnectSignal(ptr.Pointer(), "deleteLater", f)
 	}
 }
 
 func (ptr *QObject) DisconnectDeleteLater() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "deleteLater")
+		qt.DisconnectSignal(ptr.Pointer(), "deleteLater")
 	}
 }
 
 func (ptr *QObject) DeleteLater() {
 	if ptr.Pointer() != nil {
 		C.QObject_DeleteLater(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -26293,14 +27088,14 @@ func (ptr *QObject) DeleteLater() {
 func (ptr *QObject) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QObject_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQObject_Destroyed
 func callbackQObject_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*QObject))(NewQObjectFromPointer(obj))
 	}
 
@@ -26309,28 +27104,28 @@ func callbackQObject_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 func (ptr *QObject) ConnectDestroyed(f func(obj *QObject)) {
 	if ptr.Pointer() != nil {
 		C.QObject_ConnectDestroyed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "destroyed", f)
+		qt.ConnectSignal(ptr.Pointer(), "destroyed", f)
 	}
 }
 
 func (ptr *QObject) DisconnectDestroyed() {
 	if ptr.Pointer() != nil {
 		C.QObject_DisconnectDestroyed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "destroyed")
+		qt.DisconnectSignal(ptr.Pointer(), "destroyed")
 	}
 }
 
 func (ptr *QObject) Destroyed(obj QObject_ITF) {
 	if ptr.Pointer() != nil {
 		C.QObject_Destroyed(ptr.Pointer(), PointerFromQObject(obj))
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQObject_DisconnectNotify
 func callbackQObject_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*QMetaMethod))(NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQObjectFromPointer(ptr).DisconnectNotifyDefault(NewQMetaMethodFromPointer(sign))
@@ -26340,14 +27135,14 @@ func callbackQObject_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
 func (ptr *QObject) ConnectDisconnectNotify(f func(sign *QMetaMethod)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "disconnectNotify", f)
+		qt.ConnectSignal(ptr.Pointer(), "disconnectNotify", f)
 	}
 }
 
 func (ptr *QObject) DisconnectDisconnectNotify() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "disconnectNotify")
+		qt.DisconnectSignal(ptr.Pointer(), "disconnectNotify")
 	}
 }
 
@@ -26395,7 +27190,7 @@ func (ptr *QObject) MoveToThread(targetThread QThread_ITF) {
 
 //export callbackQObject_ObjectNameChanged
 func callbackQObject_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtCore_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -26404,14 +27199,14 @@ func callbackQObject_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_Q
 func (ptr *QObject) ConnectObjectNameChanged(f func(objectName string)) {
 	if ptr.Pointer() != nil {
 		C.QObject_ConnectObjectNameChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "objectNameChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "objectNameChanged", f)
 	}
 }
 
 func (ptr *QObject) DisconnectObjectNameChanged() {
 	if ptr.Pointer() != nil {
 		C.QObject_DisconnectObjectNameChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "objectNameChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "objectNameChanged")
 	}
 }
 
@@ -26437,7 +27232,7 @@ func (ptr *QObject) SetParent(parent QObject_ITF) {
 
 //export callbackQObject_TimerEvent
 func callbackQObject_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*QTimerEvent))(NewQTimerEventFromPointer(event))
 	} else {
 		NewQObjectFromPointer(ptr).TimerEventDefault(NewQTimerEventFromPointer(event))
@@ -26447,14 +27242,14 @@ func callbackQObject_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QObject) ConnectTimerEvent(f func(event *QTimerEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "timerEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "timerEvent", f)
 	}
 }
 
 func (ptr *QObject) DisconnectTimerEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "timerEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "timerEvent")
 	}
 }
 
@@ -26472,7 +27267,7 @@ func (ptr *QObject) TimerEventDefault(event QTimerEvent_ITF) {
 
 //export callbackQObject_DestroyQObject
 func callbackQObject_DestroyQObject(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QObject"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQObjectFromPointer(ptr).DestroyQObjectDefault()
@@ -26482,21 +27277,21 @@ func callbackQObject_DestroyQObject(ptr unsafe.Pointer) {
 func (ptr *QObject) ConnectDestroyQObject(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QObject", f)
 	}
 }
 
 func (ptr *QObject) DisconnectDestroyQObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QObject")
+		qt.DisconnectSignal(ptr.Pointer(), "~QObject")
 	}
 }
 
 func (ptr *QObject) DestroyQObject() {
 	if ptr.Pointer() != nil {
 		C.QObject_DestroyQObject(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -26504,20 +27299,20 @@ func (ptr *QObject) DestroyQObject() {
 func (ptr *QObject) DestroyQObjectDefault() {
 	if ptr.Pointer() != nil {
 		C.QObject_DestroyQObjectDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func (ptr *QObject) DynamicPropertyNames() []*QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtCore_PackedList) []*QByteArray {
-			var out = make([]*QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQObjectFromPointer(l.data).__dynamicPropertyNames_atList(i)
+		return func(l []string) []*QByteArray {
+			var out = make([]*QByteArray, len(l))
+			for i, v := range l {
+				out[i] = NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QObject_DynamicPropertyNames(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QObject_DynamicPropertyNames(ptr.Pointer())))
 	}
 	return make([]*QByteArray, 0)
 }
@@ -26566,7 +27361,7 @@ func (ptr *QObject) FindChildren(name string, options Qt__FindChildOption) []*QO
 func (ptr *QObject) Parent() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QObject_Parent(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -26577,7 +27372,7 @@ func (ptr *QObject) Parent() *QObject {
 func (ptr *QObject) Sender() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QObject_Sender(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -26595,7 +27390,7 @@ func (ptr *QObject) ObjectName() string {
 func (ptr *QObject) Thread() *QThread {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQThreadFromPointer(C.QObject_Thread(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -26619,7 +27414,7 @@ func (ptr *QObject) FindChild(name string, options Qt__FindChildOption) *QObject
 		var nameC = C.CString(name)
 		defer C.free(unsafe.Pointer(nameC))
 		var tmpValue = NewQObjectFromPointer(C.QObject_FindChild(ptr.Pointer(), nameC, C.longlong(options)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -26686,7 +27481,7 @@ func (ptr *QObject) SignalsBlocked() bool {
 
 //export callbackQObject_MetaObject
 func callbackQObject_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return PointerFromQMetaObject(signal.(func() *QMetaObject)())
 	}
 
@@ -26696,14 +27491,14 @@ func callbackQObject_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QObject) ConnectMetaObject(f func() *QMetaObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "metaObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "metaObject", f)
 	}
 }
 
 func (ptr *QObject) DisconnectMetaObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "metaObject")
+		qt.DisconnectSignal(ptr.Pointer(), "metaObject")
 	}
 }
 
@@ -26781,7 +27576,7 @@ func (ptr *QObject) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QObject) __findChildren_atList2(i int) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QObject___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -26802,7 +27597,7 @@ func (ptr *QObject) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QObject) __findChildren_atList3(i int) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QObject___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -26823,7 +27618,7 @@ func (ptr *QObject) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QObject) __findChildren_atList(i int) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QObject___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -26844,7 +27639,7 @@ func (ptr *QObject) __findChildren_newList() unsafe.Pointer {
 func (ptr *QObject) __children_atList(i int) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QObject___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -26903,7 +27698,7 @@ func NewQObjectCleanupHandlerFromPointer(ptr unsafe.Pointer) *QObjectCleanupHand
 func (ptr *QObjectCleanupHandler) Add(object QObject_ITF) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QObjectCleanupHandler_Add(ptr.Pointer(), PointerFromQObject(object)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -26913,7 +27708,7 @@ func (ptr *QObjectCleanupHandler) Add(object QObject_ITF) *QObject {
 
 func NewQObjectCleanupHandler() *QObjectCleanupHandler {
 	var tmpValue = NewQObjectCleanupHandlerFromPointer(C.QObjectCleanupHandler_NewQObjectCleanupHandler())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -26934,7 +27729,7 @@ func (ptr *QObjectCleanupHandler) Remove(object QObject_ITF) {
 func (ptr *QObjectCleanupHandler) DestroyQObjectCleanupHandler() {
 	if ptr.Pointer() != nil {
 		C.QObjectCleanupHandler_DestroyQObjectCleanupHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -27031,7 +27826,7 @@ func NewQParallelAnimationGroupFromPointer(ptr unsafe.Pointer) *QParallelAnimati
 }
 func NewQParallelAnimationGroup(parent QObject_ITF) *QParallelAnimationGroup {
 	var tmpValue = NewQParallelAnimationGroupFromPointer(C.QParallelAnimationGroup_NewQParallelAnimationGroup(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -27039,7 +27834,7 @@ func NewQParallelAnimationGroup(parent QObject_ITF) *QParallelAnimationGroup {
 
 //export callbackQParallelAnimationGroup_UpdateCurrentTime
 func callbackQParallelAnimationGroup_UpdateCurrentTime(ptr unsafe.Pointer, currentTime C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateCurrentTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateCurrentTime"); signal != nil {
 		signal.(func(int))(int(int32(currentTime)))
 	} else {
 		NewQParallelAnimationGroupFromPointer(ptr).UpdateCurrentTimeDefault(int(int32(currentTime)))
@@ -27049,14 +27844,14 @@ func callbackQParallelAnimationGroup_UpdateCurrentTime(ptr unsafe.Pointer, curre
 func (ptr *QParallelAnimationGroup) ConnectUpdateCurrentTime(f func(currentTime int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateCurrentTime", f)
 	}
 }
 
 func (ptr *QParallelAnimationGroup) DisconnectUpdateCurrentTime() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime")
+		qt.DisconnectSignal(ptr.Pointer(), "updateCurrentTime")
 	}
 }
 
@@ -27075,14 +27870,14 @@ func (ptr *QParallelAnimationGroup) UpdateCurrentTimeDefault(currentTime int) {
 func (ptr *QParallelAnimationGroup) DestroyQParallelAnimationGroup() {
 	if ptr.Pointer() != nil {
 		C.QParallelAnimationGroup_DestroyQParallelAnimationGroup(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQParallelAnimationGroup_Duration
 func callbackQParallelAnimationGroup_Duration(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "duration"); signal != nil {
+	if signal := qt.GetSignal(ptr, "duration"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -27092,14 +27887,14 @@ func callbackQParallelAnimationGroup_Duration(ptr unsafe.Pointer) C.int {
 func (ptr *QParallelAnimationGroup) ConnectDuration(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "duration", f)
+		qt.ConnectSignal(ptr.Pointer(), "duration", f)
 	}
 }
 
 func (ptr *QParallelAnimationGroup) DisconnectDuration() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "duration")
+		qt.DisconnectSignal(ptr.Pointer(), "duration")
 	}
 }
 
@@ -27157,7 +27952,7 @@ func NewQPauseAnimationFromPointer(ptr unsafe.Pointer) *QPauseAnimation {
 }
 func NewQPauseAnimation(parent QObject_ITF) *QPauseAnimation {
 	var tmpValue = NewQPauseAnimationFromPointer(C.QPauseAnimation_NewQPauseAnimation(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -27165,7 +27960,7 @@ func NewQPauseAnimation(parent QObject_ITF) *QPauseAnimation {
 
 func NewQPauseAnimation2(msecs int, parent QObject_ITF) *QPauseAnimation {
 	var tmpValue = NewQPauseAnimationFromPointer(C.QPauseAnimation_NewQPauseAnimation2(C.int(int32(msecs)), PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -27179,7 +27974,7 @@ func (ptr *QPauseAnimation) SetDuration(msecs int) {
 
 //export callbackQPauseAnimation_UpdateCurrentTime
 func callbackQPauseAnimation_UpdateCurrentTime(ptr unsafe.Pointer, vin C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateCurrentTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateCurrentTime"); signal != nil {
 		signal.(func(int))(int(int32(vin)))
 	} else {
 		NewQPauseAnimationFromPointer(ptr).UpdateCurrentTimeDefault(int(int32(vin)))
@@ -27189,14 +27984,14 @@ func callbackQPauseAnimation_UpdateCurrentTime(ptr unsafe.Pointer, vin C.int) {
 func (ptr *QPauseAnimation) ConnectUpdateCurrentTime(f func(vin int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateCurrentTime", f)
 	}
 }
 
 func (ptr *QPauseAnimation) DisconnectUpdateCurrentTime() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime")
+		qt.DisconnectSignal(ptr.Pointer(), "updateCurrentTime")
 	}
 }
 
@@ -27215,14 +28010,14 @@ func (ptr *QPauseAnimation) UpdateCurrentTimeDefault(vin int) {
 func (ptr *QPauseAnimation) DestroyQPauseAnimation() {
 	if ptr.Pointer() != nil {
 		C.QPauseAnimation_DestroyQPauseAnimation(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPauseAnimation_Duration
 func callbackQPauseAnimation_Duration(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "duration"); signal != nil {
+	if signal := qt.GetSignal(ptr, "duration"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -27232,14 +28027,14 @@ func callbackQPauseAnimation_Duration(ptr unsafe.Pointer) C.int {
 func (ptr *QPauseAnimation) ConnectDuration(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "duration", f)
+		qt.ConnectSignal(ptr.Pointer(), "duration", f)
 	}
 }
 
 func (ptr *QPauseAnimation) DisconnectDuration() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "duration")
+		qt.DisconnectSignal(ptr.Pointer(), "duration")
 	}
 }
 
@@ -27308,18 +28103,30 @@ func NewQPersistentModelIndex4(other QPersistentModelIndex_ITF) *QPersistentMode
 	return tmpValue
 }
 
+func (arena *Arena) NewQPersistentModelIndex4(other QPersistentModelIndex_ITF) *QPersistentModelIndex {
+	return NewQPersistentModelIndexFromPointer(C.QPersistentModelIndex_NewQPersistentModelIndex4InArena(arena.Pointer(), PointerFromQPersistentModelIndex(other)))
+}
+
 func NewQPersistentModelIndex(index QModelIndex_ITF) *QPersistentModelIndex {
 	var tmpValue = NewQPersistentModelIndexFromPointer(C.QPersistentModelIndex_NewQPersistentModelIndex(PointerFromQModelIndex(index)))
 	runtime.SetFinalizer(tmpValue, (*QPersistentModelIndex).DestroyQPersistentModelIndex)
 	return tmpValue
 }
 
+func (arena *Arena) NewQPersistentModelIndex(index QModelIndex_ITF) *QPersistentModelIndex {
+	return NewQPersistentModelIndexFromPointer(C.QPersistentModelIndex_NewQPersistentModelIndexInArena(arena.Pointer(), PointerFromQModelIndex(index)))
+}
+
 func NewQPersistentModelIndex3(other QPersistentModelIndex_ITF) *QPersistentModelIndex {
 	var tmpValue = NewQPersistentModelIndexFromPointer(C.QPersistentModelIndex_NewQPersistentModelIndex3(PointerFromQPersistentModelIndex(other)))
 	runtime.SetFinalizer(tmpValue, (*QPersistentModelIndex).DestroyQPersistentModelIndex)
 	return tmpValue
 }
 
+func (arena *Arena) NewQPersistentModelIndex3(other QPersistentModelIndex_ITF) *QPersistentModelIndex {
+	return NewQPersistentModelIndexFromPointer(C.QPersistentModelIndex_NewQPersistentModelIndex3InArena(arena.Pointer(), PointerFromQPersistentModelIndex(other)))
+}
+
 func (ptr *QPersistentModelIndex) Swap(other QPersistentModelIndex_ITF) {
 	if ptr.Pointer() != nil {
 		C.QPersistentModelIndex_Swap(ptr.Pointer(), PointerFromQPersistentModelIndex(other))
@@ -27370,7 +28177,7 @@ func (ptr *QPersistentModelIndex) IsValid() bool {
 func (ptr *QPersistentModelIndex) Model() *QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractItemModelFromPointer(C.QPersistentModelIndex_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -27433,7 +28240,7 @@ func NewQPluginLoaderFromPointer(ptr unsafe.Pointer) *QPluginLoader {
 func (ptr *QPluginLoader) Instance() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QPluginLoader_Instance(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -27463,7 +28270,7 @@ func (ptr *QPluginLoader) StaticInstances() []*QObject {
 
 func NewQPluginLoader(parent QObject_ITF) *QPluginLoader {
 	var tmpValue = NewQPluginLoaderFromPointer(C.QPluginLoader_NewQPluginLoader(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -27473,7 +28280,7 @@ func NewQPluginLoader2(fileName string, parent QObject_ITF) *QPluginLoader {
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQPluginLoaderFromPointer(C.QPluginLoader_NewQPluginLoader2(fileNameC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -27510,7 +28317,7 @@ func (ptr *QPluginLoader) SetLoadHints(loadHints QLibrary__LoadHint) {
 func (ptr *QPluginLoader) DestroyQPluginLoader() {
 	if ptr.Pointer() != nil {
 		C.QPluginLoader_DestroyQPluginLoader(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -27555,7 +28362,7 @@ func (ptr *QPluginLoader) IsLoaded() bool {
 func (ptr *QPluginLoader) __staticInstances_atList(i int) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QPluginLoader___staticInstances_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -27634,12 +28441,20 @@ func NewQPoint() *QPoint {
 	return tmpValue
 }
 
+func (arena *Arena) NewQPoint() *QPoint {
+	return NewQPointFromPointer(C.QPoint_NewQPointInArena(arena.Pointer()))
+}
+
 func NewQPoint2(xpos int, ypos int) *QPoint {
 	var tmpValue = NewQPointFromPointer(C.QPoint_NewQPoint2(C.int(int32(xpos)), C.int(int32(ypos))))
 	runtime.SetFinalizer(tmpValue, (*QPoint).DestroyQPoint)
 	return tmpValue
 }
 
+func (arena *Arena) NewQPoint2(xpos int, ypos int) *QPoint {
+	return NewQPointFromPointer(C.QPoint_NewQPoint2InArena(arena.Pointer(), C.int(int32(xpos)), C.int(int32(ypos))))
+}
+
 func (ptr *QPoint) Rx() int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QPoint_Rx(ptr.Pointer())))
@@ -27753,18 +28568,30 @@ func NewQPointF() *QPointF {
 	return tmpValue
 }
 
+func (arena *Arena) NewQPointF() *QPointF {
+	return NewQPointFFromPointer(C.QPointF_NewQPointFInArena(arena.Pointer()))
+}
+
 func NewQPointF2(point QPoint_ITF) *QPointF {
 	var tmpValue = NewQPointFFromPointer(C.QPointF_NewQPointF2(PointerFromQPoint(point)))
 	runtime.SetFinalizer(tmpValue, (*QPointF).DestroyQPointF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQPointF2(point QPoint_ITF) *QPointF {
+	return NewQPointFFromPointer(C.QPointF_NewQPointF2InArena(arena.Pointer(), PointerFromQPoint(point)))
+}
+
 func NewQPointF3(xpos float64, ypos float64) *QPointF {
 	var tmpValue = NewQPointFFromPointer(C.QPointF_NewQPointF3(C.double(xpos), C.double(ypos)))
 	runtime.SetFinalizer(tmpValue, (*QPointF).DestroyQPointF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQPointF3(xpos float64, ypos float64) *QPointF {
+	return NewQPointFFromPointer(C.QPointF_NewQPointF3InArena(arena.Pointer(), C.double(xpos), C.double(ypos)))
+}
+
 func (ptr *QPointF) Rx() float64 {
 	if ptr.Pointer() != nil {
 		return float64(C.QPointF_Rx(ptr.Pointer()))
@@ -28053,7 +28880,7 @@ func NewQPropertyAnimationFromPointer(ptr unsafe.Pointer) *QPropertyAnimation {
 }
 func NewQPropertyAnimation(parent QObject_ITF) *QPropertyAnimation {
 	var tmpValue = NewQPropertyAnimationFromPointer(C.QPropertyAnimation_NewQPropertyAnimation(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -28061,7 +28888,7 @@ func NewQPropertyAnimation(parent QObject_ITF) *QPropertyAnimation {
 
 func NewQPropertyAnimation2(target QObject_ITF, propertyName QByteArray_ITF, parent QObject_ITF) *QPropertyAnimation {
 	var tmpValue = NewQPropertyAnimationFromPointer(C.QPropertyAnimation_NewQPropertyAnimation2(PointerFromQObject(target), PointerFromQByteArray(propertyName), PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -28082,7 +28909,7 @@ func (ptr *QPropertyAnimation) SetTargetObject(target QObject_ITF) {
 func (ptr *QPropertyAnimation) DestroyQPropertyAnimation() {
 	if ptr.Pointer() != nil {
 		C.QPropertyAnimation_DestroyQPropertyAnimation(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -28099,7 +28926,7 @@ func (ptr *QPropertyAnimation) PropertyName() *QByteArray {
 func (ptr *QPropertyAnimation) TargetObject() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QPropertyAnimation_TargetObject(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -28196,6 +29023,10 @@ func NewQReadLocker(lock QReadWriteLock_ITF) *QReadLocker {
 	return tmpValue
 }
 
+func (arena *Arena) NewQReadLocker(lock QReadWriteLock_ITF) *QReadLocker {
+	return NewQReadLockerFromPointer(C.QReadLocker_NewQReadLockerInArena(arena.Pointer(), PointerFromQReadWriteLock(lock)))
+}
+
 func (ptr *QReadLocker) Relock() {
 	if ptr.Pointer() != nil {
 		C.QReadLocker_Relock(ptr.Pointer())
@@ -28275,6 +29106,10 @@ func NewQReadWriteLock(recursionMode QReadWriteLock__RecursionMode) *QReadWriteL
 	return tmpValue
 }
 
+func (arena *Arena) NewQReadWriteLock(recursionMode QReadWriteLock__RecursionMode) *QReadWriteLock {
+	return NewQReadWriteLockFromPointer(C.QReadWriteLock_NewQReadWriteLockInArena(arena.Pointer(), C.longlong(recursionMode)))
+}
+
 func (ptr *QReadWriteLock) TryLockForRead() bool {
 	if ptr.Pointer() != nil {
 		return C.QReadWriteLock_TryLockForRead(ptr.Pointer()) != 0
@@ -28379,24 +29214,40 @@ func NewQRect() *QRect {
 	return tmpValue
 }
 
+func (arena *Arena) NewQRect() *QRect {
+	return NewQRectFromPointer(C.QRect_NewQRectInArena(arena.Pointer()))
+}
+
 func NewQRect2(topLeft QPoint_ITF, bottomRight QPoint_ITF) *QRect {
 	var tmpValue = NewQRectFromPointer(C.QRect_NewQRect2(PointerFromQPoint(topLeft), PointerFromQPoint(bottomRight)))
 	runtime.SetFinalizer(tmpValue, (*QRect).DestroyQRect)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRect2(topLeft QPoint_ITF, bottomRight QPoint_ITF) *QRect {
+	return NewQRectFromPointer(C.QRect_NewQRect2InArena(arena.Pointer(), PointerFromQPoint(topLeft), PointerFromQPoint(bottomRight)))
+}
+
 func NewQRect3(topLeft QPoint_ITF, size QSize_ITF) *QRect {
 	var tmpValue = NewQRectFromPointer(C.QRect_NewQRect3(PointerFromQPoint(topLeft), PointerFromQSize(size)))
 	runtime.SetFinalizer(tmpValue, (*QRect).DestroyQRect)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRect3(topLeft QPoint_ITF, size QSize_ITF) *QRect {
+	return NewQRectFromPointer(C.QRect_NewQRect3InArena(arena.Pointer(), PointerFromQPoint(topLeft), PointerFromQSize(size)))
+}
+
 func NewQRect4(x int, y int, width int, height int) *QRect {
 	var tmpValue = NewQRectFromPointer(C.QRect_NewQRect4(C.int(int32(x)), C.int(int32(y)), C.int(int32(width)), C.int(int32(height))))
 	runtime.SetFinalizer(tmpValue, (*QRect).DestroyQRect)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRect4(x int, y int, width int, height int) *QRect {
+	return NewQRectFromPointer(C.QRect_NewQRect4InArena(arena.Pointer(), C.int(int32(x)), C.int(int32(y)), C.int(int32(width)), C.int(int32(height))))
+}
+
 func (ptr *QRect) Adjust(dx1 int, dy1 int, dx2 int, dy2 int) {
 	if ptr.Pointer() != nil {
 		C.QRect_Adjust(ptr.Pointer(), C.int(int32(dx1)), C.int(int32(dy1)), C.int(int32(dx2)), C.int(int32(dy2)))
@@ -28881,30 +29732,50 @@ func NewQRectF() *QRectF {
 	return tmpValue
 }
 
+func (arena *Arena) NewQRectF() *QRectF {
+	return NewQRectFFromPointer(C.QRectF_NewQRectFInArena(arena.Pointer()))
+}
+
 func NewQRectF3(topLeft QPointF_ITF, bottomRight QPointF_ITF) *QRectF {
 	var tmpValue = NewQRectFFromPointer(C.QRectF_NewQRectF3(PointerFromQPointF(topLeft), PointerFromQPointF(bottomRight)))
 	runtime.SetFinalizer(tmpValue, (*QRectF).DestroyQRectF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRectF3(topLeft QPointF_ITF, bottomRight QPointF_ITF) *QRectF {
+	return NewQRectFFromPointer(C.QRectF_NewQRectF3InArena(arena.Pointer(), PointerFromQPointF(topLeft), PointerFromQPointF(bottomRight)))
+}
+
 func NewQRectF2(topLeft QPointF_ITF, size QSizeF_ITF) *QRectF {
 	var tmpValue = NewQRectFFromPointer(C.QRectF_NewQRectF2(PointerFromQPointF(topLeft), PointerFromQSizeF(size)))
 	runtime.SetFinalizer(tmpValue, (*QRectF).DestroyQRectF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRectF2(topLeft QPointF_ITF, size QSizeF_ITF) *QRectF {
+	return NewQRectFFromPointer(C.QRectF_NewQRectF2InArena(arena.Pointer(), PointerFromQPointF(topLeft), PointerFromQSizeF(size)))
+}
+
 func NewQRectF5(rectangle QRect_ITF) *QRectF {
 	var tmpValue = NewQRectFFromPointer(C.QRectF_NewQRectF5(PointerFromQRect(rectangle)))
 	runtime.SetFinalizer(tmpValue, (*QRectF).DestroyQRectF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRectF5(rectangle QRect_ITF) *QRectF {
+	return NewQRectFFromPointer(C.QRectF_NewQRectF5InArena(arena.Pointer(), PointerFromQRect(rectangle)))
+}
+
 func NewQRectF4(x float64, y float64, width float64, height float64) *QRectF {
 	var tmpValue = NewQRectFFromPointer(C.QRectF_NewQRectF4(C.double(x), C.double(y), C.double(width), C.double(height)))
 	runtime.SetFinalizer(tmpValue, (*QRectF).DestroyQRectF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRectF4(x float64, y float64, width float64, height float64) *QRectF {
+	return NewQRectFFromPointer(C.QRectF_NewQRectF4InArena(arena.Pointer(), C.double(x), C.double(y), C.double(width), C.double(height)))
+}
+
 func (ptr *QRectF) Adjust(dx1 float64, dy1 float64, dx2 float64, dy2 float64) {
 	if ptr.Pointer() != nil {
 		C.QRectF_Adjust(ptr.Pointer(), C.double(dx1), C.double(dy1), C.double(dx2), C.double(dy2))
@@ -29416,12 +30287,20 @@ func NewQRegExp() *QRegExp {
 	return tmpValue
 }
 
+func (arena *Arena) NewQRegExp() *QRegExp {
+	return NewQRegExpFromPointer(C.QRegExp_NewQRegExpInArena(arena.Pointer()))
+}
+
 func NewQRegExp3(rx QRegExp_ITF) *QRegExp {
 	var tmpValue = NewQRegExpFromPointer(C.QRegExp_NewQRegExp3(PointerFromQRegExp(rx)))
 	runtime.SetFinalizer(tmpValue, (*QRegExp).DestroyQRegExp)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRegExp3(rx QRegExp_ITF) *QRegExp {
+	return NewQRegExpFromPointer(C.QRegExp_NewQRegExp3InArena(arena.Pointer(), PointerFromQRegExp(rx)))
+}
+
 func NewQRegExp2(pattern string, cs Qt__CaseSensitivity, syntax QRegExp__PatternSyntax) *QRegExp {
 	var patternC = C.CString(pattern)
 	defer C.free(unsafe.Pointer(patternC))
@@ -29430,6 +30309,12 @@ func NewQRegExp2(pattern string, cs Qt__CaseSensitivity, syntax QRegExp__Pattern
 	return tmpValue
 }
 
+func (arena *Arena) NewQRegExp2(pattern string, cs Qt__CaseSensitivity, syntax QRegExp__PatternSyntax) *QRegExp {
+	var patternC = C.CString(pattern)
+	defer C.free(unsafe.Pointer(patternC))
+	return NewQRegExpFromPointer(C.QRegExp_NewQRegExp2InArena(arena.Pointer(), patternC, C.longlong(cs), C.longlong(syntax)))
+}
+
 func QRegExp_Escape(str string) string {
 	var strC = C.CString(str)
 	defer C.free(unsafe.Pointer(strC))
@@ -29511,7 +30396,7 @@ func (ptr *QRegExp) Pattern() string {
 
 func (ptr *QRegExp) CapturedTexts() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QRegExp_CapturedTexts(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QRegExp_CapturedTexts(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -29674,12 +30559,20 @@ func NewQRegularExpression() *QRegularExpression {
 	return tmpValue
 }
 
+func (arena *Arena) NewQRegularExpression() *QRegularExpression {
+	return NewQRegularExpressionFromPointer(C.QRegularExpression_NewQRegularExpressionInArena(arena.Pointer()))
+}
+
 func NewQRegularExpression3(re QRegularExpression_ITF) *QRegularExpression {
 	var tmpValue = NewQRegularExpressionFromPointer(C.QRegularExpression_NewQRegularExpression3(PointerFromQRegularExpression(re)))
 	runtime.SetFinalizer(tmpValue, (*QRegularExpression).DestroyQRegularExpression)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRegularExpression3(re QRegularExpression_ITF) *QRegularExpression {
+	return NewQRegularExpressionFromPointer(C.QRegularExpression_NewQRegularExpression3InArena(arena.Pointer(), PointerFromQRegularExpression(re)))
+}
+
 func NewQRegularExpression2(pattern string, options QRegularExpression__PatternOption) *QRegularExpression {
 	var patternC = C.CString(pattern)
 	defer C.free(unsafe.Pointer(patternC))
@@ -29688,6 +30581,12 @@ func NewQRegularExpression2(pattern string, options QRegularExpression__PatternO
 	return tmpValue
 }
 
+func (arena *Arena) NewQRegularExpression2(pattern string, options QRegularExpression__PatternOption) *QRegularExpression {
+	var patternC = C.CString(pattern)
+	defer C.free(unsafe.Pointer(patternC))
+	return NewQRegularExpressionFromPointer(C.QRegularExpression_NewQRegularExpression2InArena(arena.Pointer(), patternC, C.longlong(options)))
+}
+
 func QRegularExpression_Escape(str string) string {
 	var strC = C.CString(str)
 	defer C.free(unsafe.Pointer(strC))
@@ -29786,7 +30685,7 @@ func (ptr *QRegularExpression) Pattern() string {
 
 func (ptr *QRegularExpression) NamedCaptureGroups() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QRegularExpression_NamedCaptureGroups(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QRegularExpression_NamedCaptureGroups(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -29861,12 +30760,20 @@ func NewQRegularExpressionMatch() *QRegularExpressionMatch {
 	return tmpValue
 }
 
+func (arena *Arena) NewQRegularExpressionMatch() *QRegularExpressionMatch {
+	return NewQRegularExpressionMatchFromPointer(C.QRegularExpressionMatch_NewQRegularExpressionMatchInArena(arena.Pointer()))
+}
+
 func NewQRegularExpressionMatch2(match QRegularExpressionMatch_ITF) *QRegularExpressionMatch {
 	var tmpValue = NewQRegularExpressionMatchFromPointer(C.QRegularExpressionMatch_NewQRegularExpressionMatch2(PointerFromQRegularExpressionMatch(match)))
 	runtime.SetFinalizer(tmpValue, (*QRegularExpressionMatch).DestroyQRegularExpressionMatch)
 	return tmpValue
 }
 
+func (arena *Arena) NewQRegularExpressionMatch2(match QRegularExpressionMatch_ITF) *QRegularExpressionMatch {
+	return NewQRegularExpressionMatchFromPointer(C.QRegularExpressionMatch_NewQRegularExpressionMatch2InArena(arena.Pointer(), PointerFromQRegularExpressionMatch(match)))
+}
+
 func (ptr *QRegularExpressionMatch) Swap(other QRegularExpressionMatch_ITF) {
 	if ptr.Pointer() != nil {
 		C.QRegularExpressionMatch_Swap(ptr.Pointer(), PointerFromQRegularExpressionMatch(other))
@@ -29921,7 +30828,7 @@ func (ptr *QRegularExpressionMatch) Captured(nth int) string {
 
 func (ptr *QRegularExpressionMatch) CapturedTexts() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QRegularExpressionMatch_CapturedTexts(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QRegularExpressionMatch_CapturedTexts(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -30105,6 +31012,12 @@ func NewQResource(file string, locale QLocale_ITF) *QResource {
 	return tmpValue
 }
 
+func (arena *Arena) NewQResource(file string, locale QLocale_ITF) *QResource {
+	var fileC = C.CString(file)
+	defer C.free(unsafe.Pointer(fileC))
+	return NewQResourceFromPointer(C.QResource_NewQResourceInArena(arena.Pointer(), fileC, PointerFromQLocale(locale)))
+}
+
 func QResource_RegisterResource(rccFileName string, mapRoot string) bool {
 	var rccFileNameC = C.CString(rccFileName)
 	defer C.free(unsafe.Pointer(rccFileNameC))
@@ -30224,7 +31137,7 @@ func (ptr *QResource) FileName() string {
 
 func (ptr *QResource) Children() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QResource_Children(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QResource_Children(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -30314,7 +31227,7 @@ func NewQRunnable() *QRunnable {
 
 //export callbackQRunnable_Run
 func callbackQRunnable_Run(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "run"); signal != nil {
+	if signal := qt.GetSignal(ptr, "run"); signal != nil {
 		signal.(func())()
 	}
 
@@ -30323,14 +31236,14 @@ func callbackQRunnable_Run(ptr unsafe.Pointer) {
 func (ptr *QRunnable) ConnectRun(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "run", f)
+		qt.ConnectSignal(ptr.Pointer(), "run", f)
 	}
 }
 
 func (ptr *QRunnable) DisconnectRun() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "run")
+		qt.DisconnectSignal(ptr.Pointer(), "run")
 	}
 }
 
@@ -30348,7 +31261,7 @@ func (ptr *QRunnable) SetAutoDelete(autoDelete bool) {
 
 //export callbackQRunnable_DestroyQRunnable
 func callbackQRunnable_DestroyQRunnable(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QRunnable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QRunnable"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQRunnableFromPointer(ptr).DestroyQRunnableDefault()
@@ -30358,21 +31271,21 @@ func callbackQRunnable_DestroyQRunnable(ptr unsafe.Pointer) {
 func (ptr *QRunnable) ConnectDestroyQRunnable(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QRunnable", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QRunnable", f)
 	}
 }
 
 func (ptr *QRunnable) DisconnectDestroyQRunnable() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QRunnable")
+		qt.DisconnectSignal(ptr.Pointer(), "~QRunnable")
 	}
 }
 
 func (ptr *QRunnable) DestroyQRunnable() {
 	if ptr.Pointer() != nil {
 		C.QRunnable_DestroyQRunnable(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -30380,7 +31293,7 @@ func (ptr *QRunnable) DestroyQRunnable() {
 func (ptr *QRunnable) DestroyQRunnableDefault() {
 	if ptr.Pointer() != nil {
 		C.QRunnable_DestroyQRunnableDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -30432,7 +31345,7 @@ func NewQSaveFileFromPointer(ptr unsafe.Pointer) *QSaveFile {
 }
 func NewQSaveFile2(parent QObject_ITF) *QSaveFile {
 	var tmpValue = NewQSaveFileFromPointer(C.QSaveFile_NewQSaveFile2(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -30442,7 +31355,7 @@ func NewQSaveFile(name string) *QSaveFile {
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
 	var tmpValue = NewQSaveFileFromPointer(C.QSaveFile_NewQSaveFile(nameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -30452,7 +31365,7 @@ func NewQSaveFile3(name string, parent QObject_ITF) *QSaveFile {
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
 	var tmpValue = NewQSaveFileFromPointer(C.QSaveFile_NewQSaveFile3(nameC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -30488,7 +31401,7 @@ func (ptr *QSaveFile) SetFileName(name string) {
 func (ptr *QSaveFile) DestroyQSaveFile() {
 	if ptr.Pointer() != nil {
 		C.QSaveFile_DestroyQSaveFile(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -30665,6 +31578,10 @@ func NewQSemaphore(n int) *QSemaphore {
 	return tmpValue
 }
 
+func (arena *Arena) NewQSemaphore(n int) *QSemaphore {
+	return NewQSemaphoreFromPointer(C.QSemaphore_NewQSemaphoreInArena(arena.Pointer(), C.int(int32(n))))
+}
+
 func (ptr *QSemaphore) TryAcquire(n int) bool {
 	if ptr.Pointer() != nil {
 		return C.QSemaphore_TryAcquire(ptr.Pointer(), C.int(int32(n))) != 0
@@ -30746,7 +31663,7 @@ func NewQSequentialAnimationGroupFromPointer(ptr unsafe.Pointer) *QSequentialAni
 func (ptr *QSequentialAnimationGroup) AddPause(msecs int) *QPauseAnimation {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQPauseAnimationFromPointer(C.QSequentialAnimationGroup_AddPause(ptr.Pointer(), C.int(int32(msecs))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -30757,7 +31674,7 @@ func (ptr *QSequentialAnimationGroup) AddPause(msecs int) *QPauseAnimation {
 func (ptr *QSequentialAnimationGroup) InsertPause(index int, msecs int) *QPauseAnimation {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQPauseAnimationFromPointer(C.QSequentialAnimationGroup_InsertPause(ptr.Pointer(), C.int(int32(index)), C.int(int32(msecs))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -30767,7 +31684,7 @@ func (ptr *QSequentialAnimationGroup) InsertPause(index int, msecs int) *QPauseA
 
 func NewQSequentialAnimationGroup(parent QObject_ITF) *QSequentialAnimationGroup {
 	var tmpValue = NewQSequentialAnimationGroupFromPointer(C.QSequentialAnimationGroup_NewQSequentialAnimationGroup(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -30775,7 +31692,7 @@ func NewQSequentialAnimationGroup(parent QObject_ITF) *QSequentialAnimationGroup
 
 //export callbackQSequentialAnimationGroup_CurrentAnimationChanged
 func callbackQSequentialAnimationGroup_CurrentAnimationChanged(ptr unsafe.Pointer, current unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentAnimationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentAnimationChanged"); signal != nil {
 		signal.(func(*QAbstractAnimation))(NewQAbstractAnimationFromPointer(current))
 	}
 
@@ -30784,14 +31701,14 @@ func callbackQSequentialAnimationGroup_CurrentAnimationChanged(ptr unsafe.Pointe
 func (ptr *QSequentialAnimationGroup) ConnectCurrentAnimationChanged(f func(current *QAbstractAnimation)) {
 	if ptr.Pointer() != nil {
 		C.QSequentialAnimationGroup_ConnectCurrentAnimationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentAnimationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentAnimationChanged", f)
 	}
 }
 
 func (ptr *QSequentialAnimationGroup) DisconnectCurrentAnimationChanged() {
 	if ptr.Pointer() != nil {
 		C.QSequentialAnimationGroup_DisconnectCurrentAnimationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentAnimationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "currentAnimationChanged")
 	}
 }
 
@@ -30803,7 +31720,7 @@ func (ptr *QSequentialAnimationGroup) CurrentAnimationChanged(current QAbstractA
 
 //export callbackQSequentialAnimationGroup_UpdateCurrentTime
 func callbackQSequentialAnimationGroup_UpdateCurrentTime(ptr unsafe.Pointer, currentTime C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateCurrentTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateCurrentTime"); signal != nil {
 		signal.(func(int))(int(int32(currentTime)))
 	} else {
 		NewQSequentialAnimationGroupFromPointer(ptr).UpdateCurrentTimeDefault(int(int32(currentTime)))
@@ -30813,14 +31730,14 @@ func callbackQSequentialAnimationGroup_UpdateCurrentTime(ptr unsafe.Pointer, cur
 func (ptr *QSequentialAnimationGroup) ConnectUpdateCurrentTime(f func(currentTime int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateCurrentTime", f)
 	}
 }
 
 func (ptr *QSequentialAnimationGroup) DisconnectUpdateCurrentTime() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime")
+		qt.DisconnectSignal(ptr.Pointer(), "updateCurrentTime")
 	}
 }
 
@@ -30839,7 +31756,7 @@ func (ptr *QSequentialAnimationGroup) UpdateCurrentTimeDefault(currentTime int)
 func (ptr *QSequentialAnimationGroup) DestroyQSequentialAnimationGroup() {
 	if ptr.Pointer() != nil {
 		C.QSequentialAnimationGroup_DestroyQSequentialAnimationGroup(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -30847,7 +31764,7 @@ func (ptr *QSequentialAnimationGroup) DestroyQSequentialAnimationGroup() {
 func (ptr *QSequentialAnimationGroup) CurrentAnimation() *QAbstractAnimation {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractAnimationFromPointer(C.QSequentialAnimationGroup_CurrentAnimation(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -30857,7 +31774,7 @@ func (ptr *QSequentialAnimationGroup) CurrentAnimation() *QAbstractAnimation {
 
 //export callbackQSequentialAnimationGroup_Duration
 func callbackQSequentialAnimationGroup_Duration(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "duration"); signal != nil {
+	if signal := qt.GetSignal(ptr, "duration"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -30867,14 +31784,14 @@ func callbackQSequentialAnimationGroup_Duration(ptr unsafe.Pointer) C.int {
 func (ptr *QSequentialAnimationGroup) ConnectDuration(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "duration", f)
+		qt.ConnectSignal(ptr.Pointer(), "duration", f)
 	}
 }
 
 func (ptr *QSequentialAnimationGroup) DisconnectDuration() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "duration")
+		qt.DisconnectSignal(ptr.Pointer(), "duration")
 	}
 }
 
@@ -31150,7 +32067,7 @@ func NewQSettings3(format QSettings__Format, scope QSettings__Scope, organizatio
 	var applicationC = C.CString(application)
 	defer C.free(unsafe.Pointer(applicationC))
 	var tmpValue = NewQSettingsFromPointer(C.QSettings_NewQSettings3(C.longlong(format), C.longlong(scope), organizationC, applicationC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -31158,7 +32075,7 @@ func NewQSettings3(format QSettings__Format, scope QSettings__Scope, organizatio
 
 func NewQSettings5(parent QObject_ITF) *QSettings {
 	var tmpValue = NewQSettingsFromPointer(C.QSettings_NewQSettings5(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -31170,7 +32087,7 @@ func NewQSettings2(scope QSettings__Scope, organization string, application stri
 	var applicationC = C.CString(application)
 	defer C.free(unsafe.Pointer(applicationC))
 	var tmpValue = NewQSettingsFromPointer(C.QSettings_NewQSettings2(C.longlong(scope), organizationC, applicationC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -31180,7 +32097,7 @@ func NewQSettings4(fileName string, format QSettings__Format, parent QObject_ITF
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQSettingsFromPointer(C.QSettings_NewQSettings4(fileNameC, C.longlong(format), PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -31192,7 +32109,7 @@ func NewQSettings(organization string, application string, parent QObject_ITF) *
 	var applicationC = C.CString(application)
 	defer C.free(unsafe.Pointer(applicationC))
 	var tmpValue = NewQSettingsFromPointer(C.QSettings_NewQSettings(organizationC, applicationC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -31312,7 +32229,7 @@ func (ptr *QSettings) Sync() {
 func (ptr *QSettings) DestroyQSettings() {
 	if ptr.Pointer() != nil {
 		C.QSettings_DestroyQSettings(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -31354,21 +32271,21 @@ func (ptr *QSettings) OrganizationName() string {
 
 func (ptr *QSettings) AllKeys() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSettings_AllKeys(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSettings_AllKeys(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSettings) ChildGroups() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSettings_ChildGroups(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSettings_ChildGroups(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSettings) ChildKeys() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSettings_ChildKeys(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSettings_ChildKeys(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -31479,12 +32396,20 @@ func NewQSharedData() *QSharedData {
 	return tmpValue
 }
 
+func (arena *Arena) NewQSharedData() *QSharedData {
+	return NewQSharedDataFromPointer(C.QSharedData_NewQSharedDataInArena(arena.Pointer()))
+}
+
 func NewQSharedData2(other QSharedData_ITF) *QSharedData {
 	var tmpValue = NewQSharedDataFromPointer(C.QSharedData_NewQSharedData2(PointerFromQSharedData(other)))
 	runtime.SetFinalizer(tmpValue, (*QSharedData).DestroyQSharedData)
 	return tmpValue
 }
 
+func (arena *Arena) NewQSharedData2(other QSharedData_ITF) *QSharedData {
+	return NewQSharedDataFromPointer(C.QSharedData_NewQSharedData2InArena(arena.Pointer(), PointerFromQSharedData(other)))
+}
+
 type QSharedDataPointer struct {
 	ptr unsafe.Pointer
 }
@@ -31589,7 +32514,7 @@ const (
 
 func NewQSharedMemory2(parent QObject_ITF) *QSharedMemory {
 	var tmpValue = NewQSharedMemoryFromPointer(C.QSharedMemory_NewQSharedMemory2(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -31599,7 +32524,7 @@ func NewQSharedMemory(key string, parent QObject_ITF) *QSharedMemory {
 	var keyC = C.CString(key)
 	defer C.free(unsafe.Pointer(keyC))
 	var tmpValue = NewQSharedMemoryFromPointer(C.QSharedMemory_NewQSharedMemory(keyC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -31666,7 +32591,7 @@ func (ptr *QSharedMemory) SetNativeKey(key string) {
 func (ptr *QSharedMemory) DestroyQSharedMemory() {
 	if ptr.Pointer() != nil {
 		C.QSharedMemory_DestroyQSharedMemory(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -31808,12 +32733,20 @@ func NewQSignalBlocker2(object QObject_ITF) *QSignalBlocker {
 	return tmpValue
 }
 
+func (arena *Arena) NewQSignalBlocker2(object QObject_ITF) *QSignalBlocker {
+	return NewQSignalBlockerFromPointer(C.QSignalBlocker_NewQSignalBlocker2InArena(arena.Pointer(), PointerFromQObject(object)))
+}
+
 func NewQSignalBlocker(object QObject_ITF) *QSignalBlocker {
 	var tmpValue = NewQSignalBlockerFromPointer(C.QSignalBlocker_NewQSignalBlocker(PointerFromQObject(object)))
 	runtime.SetFinalizer(tmpValue, (*QSignalBlocker).DestroyQSignalBlocker)
 	return tmpValue
 }
 
+func (arena *Arena) NewQSignalBlocker(object QObject_ITF) *QSignalBlocker {
+	return NewQSignalBlockerFromPointer(C.QSignalBlocker_NewQSignalBlockerInArena(arena.Pointer(), PointerFromQObject(object)))
+}
+
 func (ptr *QSignalBlocker) Reblock() {
 	if ptr.Pointer() != nil {
 		C.QSignalBlocker_Reblock(ptr.Pointer())
@@ -31873,7 +32806,7 @@ func NewQSignalMapperFromPointer(ptr unsafe.Pointer) *QSignalMapper {
 }
 func NewQSignalMapper(parent QObject_ITF) *QSignalMapper {
 	var tmpValue = NewQSignalMapperFromPointer(C.QSignalMapper_NewQSignalMapper(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -31881,7 +32814,7 @@ func NewQSignalMapper(parent QObject_ITF) *QSignalMapper {
 
 //export callbackQSignalMapper_Map
 func callbackQSignalMapper_Map(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "map"); signal != nil {
+	if signal := qt.GetSignal(ptr, "map"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSignalMapperFromPointer(ptr).MapDefault()
@@ -31891,14 +32824,14 @@ func callbackQSignalMapper_Map(ptr unsafe.Pointer) {
 func (ptr *QSignalMapper) ConnectMap(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "map", f)
+		qt.ConnectSignal(ptr.Pointer(), "map", f)
 	}
 }
 
 func (ptr *QSignalMapper) DisconnectMap() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "map")
+		qt.DisconnectSignal(ptr.Pointer(), "map")
 	}
 }
 
@@ -31916,7 +32849,7 @@ func (ptr *QSignalMapper) MapDefault() {
 
 //export callbackQSignalMapper_Map2
 func callbackQSignalMapper_Map2(ptr unsafe.Pointer, sender unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "map2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "map2"); signal != nil {
 		signal.(func(*QObject))(NewQObjectFromPointer(sender))
 	} else {
 		NewQSignalMapperFromPointer(ptr).Map2Default(NewQObjectFromPointer(sender))
@@ -31926,14 +32859,14 @@ func callbackQSignalMapper_Map2(ptr unsafe.Pointer, sender unsafe.Pointer) {
 func (ptr *QSignalMapper) ConnectMap2(f func(sender *QObject)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "map2", f)
+		qt.ConnectSignal(ptr.Pointer(), "map2", f)
 	}
 }
 
 func (ptr *QSignalMapper) DisconnectMap2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "map2")
+		qt.DisconnectSignal(ptr.Pointer(), "map2")
 	}
 }
 
@@ -31951,7 +32884,7 @@ func (ptr *QSignalMapper) Map2Default(sender QObject_ITF) {
 
 //export callbackQSignalMapper_Mapped4
 func callbackQSignalMapper_Mapped4(ptr unsafe.Pointer, object unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapped4"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapped4"); signal != nil {
 		signal.(func(*QObject))(NewQObjectFromPointer(object))
 	}
 
@@ -31960,14 +32893,14 @@ func callbackQSignalMapper_Mapped4(ptr unsafe.Pointer, object unsafe.Pointer) {
 func (ptr *QSignalMapper) ConnectMapped4(f func(object *QObject)) {
 	if ptr.Pointer() != nil {
 		C.QSignalMapper_ConnectMapped4(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapped4", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapped4", f)
 	}
 }
 
 func (ptr *QSignalMapper) DisconnectMapped4() {
 	if ptr.Pointer() != nil {
 		C.QSignalMapper_DisconnectMapped4(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapped4")
+		qt.DisconnectSignal(ptr.Pointer(), "mapped4")
 	}
 }
 
@@ -31979,7 +32912,7 @@ func (ptr *QSignalMapper) Mapped4(object QObject_ITF) {
 
 //export callbackQSignalMapper_Mapped3
 func callbackQSignalMapper_Mapped3(ptr unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapped3"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapped3"); signal != nil {
 		signal.(func(unsafe.Pointer))(unsafe.Pointer(widget))
 	}
 
@@ -31988,14 +32921,14 @@ func callbackQSignalMapper_Mapped3(ptr unsafe.Pointer, widget unsafe.Pointer) {
 func (ptr *QSignalMapper) ConnectMapped3(f func(widget unsafe.Pointer)) {
 	if ptr.Pointer() != nil {
 		C.QSignalMapper_ConnectMapped3(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapped3", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapped3", f)
 	}
 }
 
 func (ptr *QSignalMapper) DisconnectMapped3() {
 	if ptr.Pointer() != nil {
 		C.QSignalMapper_DisconnectMapped3(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapped3")
+		qt.DisconnectSignal(ptr.Pointer(), "mapped3")
 	}
 }
 
@@ -32007,7 +32940,7 @@ func (ptr *QSignalMapper) Mapped3(widget unsafe.Pointer) {
 
 //export callbackQSignalMapper_Mapped2
 func callbackQSignalMapper_Mapped2(ptr unsafe.Pointer, text C.struct_QtCore_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapped2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapped2"); signal != nil {
 		signal.(func(string))(cGoUnpackString(text))
 	}
 
@@ -32016,14 +32949,14 @@ func callbackQSignalMapper_Mapped2(ptr unsafe.Pointer, text C.struct_QtCore_Pack
 func (ptr *QSignalMapper) ConnectMapped2(f func(text string)) {
 	if ptr.Pointer() != nil {
 		C.QSignalMapper_ConnectMapped2(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapped2", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapped2", f)
 	}
 }
 
 func (ptr *QSignalMapper) DisconnectMapped2() {
 	if ptr.Pointer() != nil {
 		C.QSignalMapper_DisconnectMapped2(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapped2")
+		qt.DisconnectSignal(ptr.Pointer(), "mapped2")
 	}
 }
 
@@ -32037,7 +32970,7 @@ func (ptr *QSignalMapper) Mapped2(text string) {
 
 //export callbackQSignalMapper_Mapped
 func callbackQSignalMapper_Mapped(ptr unsafe.Pointer, i C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapped"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapped"); signal != nil {
 		signal.(func(int))(int(int32(i)))
 	}
 
@@ -32046,14 +32979,14 @@ func callbackQSignalMapper_Mapped(ptr unsafe.Pointer, i C.int) {
 func (ptr *QSignalMapper) ConnectMapped(f func(i int)) {
 	if ptr.Pointer() != nil {
 		C.QSignalMapper_ConnectMapped(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapped", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapped", f)
 	}
 }
 
 func (ptr *QSignalMapper) DisconnectMapped() {
 	if ptr.Pointer() != nil {
 		C.QSignalMapper_DisconnectMapped(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapped")
+		qt.DisconnectSignal(ptr.Pointer(), "mapped")
 	}
 }
 
@@ -32098,7 +33031,7 @@ func (ptr *QSignalMapper) SetMapping(sender QObject_ITF, id int) {
 func (ptr *QSignalMapper) DestroyQSignalMapper() {
 	if ptr.Pointer() != nil {
 		C.QSignalMapper_DestroyQSignalMapper(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -32106,7 +33039,7 @@ func (ptr *QSignalMapper) DestroyQSignalMapper() {
 func (ptr *QSignalMapper) Mapping4(object QObject_ITF) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QSignalMapper_Mapping4(ptr.Pointer(), PointerFromQObject(object)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32117,7 +33050,7 @@ func (ptr *QSignalMapper) Mapping4(object QObject_ITF) *QObject {
 func (ptr *QSignalMapper) Mapping3(widget unsafe.Pointer) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QSignalMapper_Mapping3(ptr.Pointer(), widget))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32130,7 +33063,7 @@ func (ptr *QSignalMapper) Mapping2(id string) *QObject {
 		var idC = C.CString(id)
 		defer C.free(unsafe.Pointer(idC))
 		var tmpValue = NewQObjectFromPointer(C.QSignalMapper_Mapping2(ptr.Pointer(), idC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32141,7 +33074,7 @@ func (ptr *QSignalMapper) Mapping2(id string) *QObject {
 func (ptr *QSignalMapper) Mapping(id int) *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QSignalMapper_Mapping(ptr.Pointer(), C.int(int32(id))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32189,7 +33122,7 @@ func NewQSignalTransitionFromPointer(ptr unsafe.Pointer) *QSignalTransition {
 }
 func NewQSignalTransition(sourceState QState_ITF) *QSignalTransition {
 	var tmpValue = NewQSignalTransitionFromPointer(C.QSignalTransition_NewQSignalTransition(PointerFromQState(sourceState)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -32199,7 +33132,7 @@ func NewQSignalTransition2(sender QObject_ITF, sign string, sourceState QState_I
 	var signC = C.CString(sign)
 	defer C.free(unsafe.Pointer(signC))
 	var tmpValue = NewQSignalTransitionFromPointer(C.QSignalTransition_NewQSignalTransition2(PointerFromQObject(sender), signC, PointerFromQState(sourceState)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -32207,7 +33140,7 @@ func NewQSignalTransition2(sender QObject_ITF, sign string, sourceState QState_I
 
 //export callbackQSignalTransition_EventTest
 func callbackQSignalTransition_EventTest(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventTest"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventTest"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QEvent) bool)(NewQEventFromPointer(event)))))
 	}
 
@@ -32217,14 +33150,14 @@ func callbackQSignalTransition_EventTest(ptr unsafe.Pointer, event unsafe.Pointe
 func (ptr *QSignalTransition) ConnectEventTest(f func(event *QEvent) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "eventTest", f)
+		qt.ConnectSignal(ptr.Pointer(), "eventTest", f)
 	}
 }
 
 func (ptr *QSignalTransition) DisconnectEventTest() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "eventTest")
+		qt.DisconnectSignal(ptr.Pointer(), "eventTest")
 	}
 }
 
@@ -32244,7 +33177,7 @@ func (ptr *QSignalTransition) EventTestDefault(event QEvent_ITF) bool {
 
 //export callbackQSignalTransition_OnTransition
 func callbackQSignalTransition_OnTransition(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onTransition"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onTransition"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	} else {
 		NewQSignalTransitionFromPointer(ptr).OnTransitionDefault(NewQEventFromPointer(event))
@@ -32254,14 +33187,14 @@ func callbackQSignalTransition_OnTransition(ptr unsafe.Pointer, event unsafe.Poi
 func (ptr *QSignalTransition) ConnectOnTransition(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onTransition", f)
+		qt.ConnectSignal(ptr.Pointer(), "onTransition", f)
 	}
 }
 
 func (ptr *QSignalTransition) DisconnectOnTransition() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onTransition")
+		qt.DisconnectSignal(ptr.Pointer(), "onTransition")
 	}
 }
 
@@ -32279,7 +33212,7 @@ func (ptr *QSignalTransition) OnTransitionDefault(event QEvent_ITF) {
 
 //export callbackQSignalTransition_SenderObjectChanged
 func callbackQSignalTransition_SenderObjectChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "senderObjectChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "senderObjectChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -32288,14 +33221,14 @@ func callbackQSignalTransition_SenderObjectChanged(ptr unsafe.Pointer) {
 func (ptr *QSignalTransition) ConnectSenderObjectChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSignalTransition_ConnectSenderObjectChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "senderObjectChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "senderObjectChanged", f)
 	}
 }
 
 func (ptr *QSignalTransition) DisconnectSenderObjectChanged() {
 	if ptr.Pointer() != nil {
 		C.QSignalTransition_DisconnectSenderObjectChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "senderObjectChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "senderObjectChanged")
 	}
 }
 
@@ -32313,7 +33246,7 @@ func (ptr *QSignalTransition) SetSignal(sign QByteArray_ITF) {
 
 //export callbackQSignalTransition_SignalChanged
 func callbackQSignalTransition_SignalChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "signalChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "signalChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -32322,21 +33255,21 @@ func callbackQSignalTransition_SignalChanged(ptr unsafe.Pointer) {
 func (ptr *QSignalTransition) ConnectSignalChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSignalTransition_ConnectSignalChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "signalChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "signalChanged", f)
 	}
 }
 
 func (ptr *QSignalTransition) DisconnectSignalChanged() {
 	if ptr.Pointer() != nil {
 		C.QSignalTransition_DisconnectSignalChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "signalChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "signalChanged")
 	}
 }
 
 func (ptr *QSignalTransition) DestroyQSignalTransition() {
 	if ptr.Pointer() != nil {
 		C.QSignalTransition_DestroyQSignalTransition(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -32353,7 +33286,7 @@ func (ptr *QSignalTransition) Signal() *QByteArray {
 func (ptr *QSignalTransition) SenderObject() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QSignalTransition_SenderObject(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32412,12 +33345,20 @@ func NewQSize() *QSize {
 	return tmpValue
 }
 
+func (arena *Arena) NewQSize() *QSize {
+	return NewQSizeFromPointer(C.QSize_NewQSizeInArena(arena.Pointer()))
+}
+
 func NewQSize2(width int, height int) *QSize {
 	var tmpValue = NewQSizeFromPointer(C.QSize_NewQSize2(C.int(int32(width)), C.int(int32(height))))
 	runtime.SetFinalizer(tmpValue, (*QSize).DestroyQSize)
 	return tmpValue
 }
 
+func (arena *Arena) NewQSize2(width int, height int) *QSize {
+	return NewQSizeFromPointer(C.QSize_NewQSize2InArena(arena.Pointer(), C.int(int32(width)), C.int(int32(height))))
+}
+
 func (ptr *QSize) Rheight() int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QSize_Rheight(ptr.Pointer())))
@@ -32593,18 +33534,30 @@ func NewQSizeF() *QSizeF {
 	return tmpValue
 }
 
+func (arena *Arena) NewQSizeF() *QSizeF {
+	return NewQSizeFFromPointer(C.QSizeF_NewQSizeFInArena(arena.Pointer()))
+}
+
 func NewQSizeF2(size QSize_ITF) *QSizeF {
 	var tmpValue = NewQSizeFFromPointer(C.QSizeF_NewQSizeF2(PointerFromQSize(size)))
 	runtime.SetFinalizer(tmpValue, (*QSizeF).DestroyQSizeF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQSizeF2(size QSize_ITF) *QSizeF {
+	return NewQSizeFFromPointer(C.QSizeF_NewQSizeF2InArena(arena.Pointer(), PointerFromQSize(size)))
+}
+
 func NewQSizeF3(width float64, height float64) *QSizeF {
 	var tmpValue = NewQSizeFFromPointer(C.QSizeF_NewQSizeF3(C.double(width), C.double(height)))
 	runtime.SetFinalizer(tmpValue, (*QSizeF).DestroyQSizeF)
 	return tmpValue
 }
 
+func (arena *Arena) NewQSizeF3(width float64, height float64) *QSizeF {
+	return NewQSizeFFromPointer(C.QSizeF_NewQSizeF3InArena(arena.Pointer(), C.double(width), C.double(height)))
+}
+
 func (ptr *QSizeF) Rheight() float64 {
 	if ptr.Pointer() != nil {
 		return float64(C.QSizeF_Rheight(ptr.Pointer()))
@@ -32789,7 +33742,7 @@ const (
 
 //export callbackQSocketNotifier_Activated
 func callbackQSocketNotifier_Activated(ptr unsafe.Pointer, socket C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activated"); signal != nil {
 		signal.(func(int))(int(int32(socket)))
 	}
 
@@ -32798,20 +33751,20 @@ func callbackQSocketNotifier_Activated(ptr unsafe.Pointer, socket C.int) {
 func (ptr *QSocketNotifier) ConnectActivated(f func(socket int)) {
 	if ptr.Pointer() != nil {
 		C.QSocketNotifier_ConnectActivated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activated", f)
+		qt.ConnectSignal(ptr.Pointer(), "activated", f)
 	}
 }
 
 func (ptr *QSocketNotifier) DisconnectActivated() {
 	if ptr.Pointer() != nil {
 		C.QSocketNotifier_DisconnectActivated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activated")
+		qt.DisconnectSignal(ptr.Pointer(), "activated")
 	}
 }
 
 //export callbackQSocketNotifier_SetEnabled
 func callbackQSocketNotifier_SetEnabled(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	} else {
 		NewQSocketNotifierFromPointer(ptr).SetEnabledDefault(int8(enable) != 0)
@@ -32821,14 +33774,14 @@ func callbackQSocketNotifier_SetEnabled(ptr unsafe.Pointer, enable C.char) {
 func (ptr *QSocketNotifier) ConnectSetEnabled(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setEnabled", f)
+		qt.ConnectSignal(ptr.Pointer(), "setEnabled", f)
 	}
 }
 
 func (ptr *QSocketNotifier) DisconnectSetEnabled() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setEnabled")
+		qt.DisconnectSignal(ptr.Pointer(), "setEnabled")
 	}
 }
 
@@ -32847,7 +33800,7 @@ func (ptr *QSocketNotifier) SetEnabledDefault(enable bool) {
 func (ptr *QSocketNotifier) DestroyQSocketNotifier() {
 	if ptr.Pointer() != nil {
 		C.QSocketNotifier_DestroyQSocketNotifier(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -32906,7 +33859,7 @@ func NewQSortFilterProxyModelFromPointer(ptr unsafe.Pointer) *QSortFilterProxyMo
 }
 func NewQSortFilterProxyModel(parent QObject_ITF) *QSortFilterProxyModel {
 	var tmpValue = NewQSortFilterProxyModelFromPointer(C.QSortFilterProxyModel_NewQSortFilterProxyModel(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -32914,7 +33867,7 @@ func NewQSortFilterProxyModel(parent QObject_ITF) *QSortFilterProxyModel {
 
 //export callbackQSortFilterProxyModel_Invalidate
 func callbackQSortFilterProxyModel_Invalidate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "invalidate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "invalidate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSortFilterProxyModelFromPointer(ptr).InvalidateDefault()
@@ -32924,14 +33877,14 @@ func callbackQSortFilterProxyModel_Invalidate(ptr unsafe.Pointer) {
 func (ptr *QSortFilterProxyModel) ConnectInvalidate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "invalidate", f)
+		qt.ConnectSignal(ptr.Pointer(), "invalidate", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectInvalidate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "invalidate")
+		qt.DisconnectSignal(ptr.Pointer(), "invalidate")
 	}
 }
 
@@ -32967,7 +33920,7 @@ func (ptr *QSortFilterProxyModel) SetFilterCaseSensitivity(cs Qt__CaseSensitivit
 
 //export callbackQSortFilterProxyModel_SetFilterFixedString
 func callbackQSortFilterProxyModel_SetFilterFixedString(ptr unsafe.Pointer, pattern C.struct_QtCore_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFilterFixedString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFilterFixedString"); signal != nil {
 		signal.(func(string))(cGoUnpackString(pattern))
 	} else {
 		NewQSortFilterProxyModelFromPointer(ptr).SetFilterFixedStringDefault(cGoUnpackString(pattern))
@@ -32977,14 +33930,14 @@ func callbackQSortFilterProxyModel_SetFilterFixedString(ptr unsafe.Pointer, patt
 func (ptr *QSortFilterProxyModel) ConnectSetFilterFixedString(f func(pattern string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFilterFixedString", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFilterFixedString", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectSetFilterFixedString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFilterFixedString")
+		qt.DisconnectSignal(ptr.Pointer(), "setFilterFixedString")
 	}
 }
 
@@ -33018,7 +33971,7 @@ func (ptr *QSortFilterProxyModel) SetFilterRegExp(regExp QRegExp_ITF) {
 
 //export callbackQSortFilterProxyModel_SetFilterRegExp2
 func callbackQSortFilterProxyModel_SetFilterRegExp2(ptr unsafe.Pointer, pattern C.struct_QtCore_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFilterRegExp2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFilterRegExp2"); signal != nil {
 		signal.(func(string))(cGoUnpackString(pattern))
 	} else {
 		NewQSortFilterProxyModelFromPointer(ptr).SetFilterRegExp2Default(cGoUnpackString(pattern))
@@ -33028,14 +33981,14 @@ func callbackQSortFilterProxyModel_SetFilterRegExp2(ptr unsafe.Pointer, pattern
 func (ptr *QSortFilterProxyModel) ConnectSetFilterRegExp2(f func(pattern string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFilterRegExp2", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFilterRegExp2", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectSetFilterRegExp2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFilterRegExp2")
+		qt.DisconnectSignal(ptr.Pointer(), "setFilterRegExp2")
 	}
 }
 
@@ -33063,7 +34016,7 @@ func (ptr *QSortFilterProxyModel) SetFilterRole(role int) {
 
 //export callbackQSortFilterProxyModel_SetFilterWildcard
 func callbackQSortFilterProxyModel_SetFilterWildcard(ptr unsafe.Pointer, pattern C.struct_QtCore_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFilterWildcard"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFilterWildcard"); signal != nil {
 		signal.(func(string))(cGoUnpackString(pattern))
 	} else {
 		NewQSortFilterProxyModelFromPointer(ptr).SetFilterWildcardDefault(cGoUnpackString(pattern))
@@ -33073,14 +34026,14 @@ func callbackQSortFilterProxyModel_SetFilterWildcard(ptr unsafe.Pointer, pattern
 func (ptr *QSortFilterProxyModel) ConnectSetFilterWildcard(f func(pattern string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFilterWildcard", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFilterWildcard", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectSetFilterWildcard() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFilterWildcard")
+		qt.DisconnectSignal(ptr.Pointer(), "setFilterWildcard")
 	}
 }
 
@@ -33121,14 +34074,14 @@ func (ptr *QSortFilterProxyModel) SetSortRole(role int) {
 func (ptr *QSortFilterProxyModel) DestroyQSortFilterProxyModel() {
 	if ptr.Pointer() != nil {
 		C.QSortFilterProxyModel_DestroyQSortFilterProxyModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSortFilterProxyModel_Index
 func callbackQSortFilterProxyModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(int, int, *QModelIndex) *QModelIndex)(int(int32(row)), int(int32(column)), NewQModelIndexFromPointer(parent)))
 	}
 
@@ -33138,14 +34091,14 @@ func callbackQSortFilterProxyModel_Index(ptr unsafe.Pointer, row C.int, column C
 func (ptr *QSortFilterProxyModel) ConnectIndex(f func(row int, column int, parent *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "index", f)
+		qt.ConnectSignal(ptr.Pointer(), "index", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "index")
+		qt.DisconnectSignal(ptr.Pointer(), "index")
 	}
 }
 
@@ -33169,7 +34122,7 @@ func (ptr *QSortFilterProxyModel) IndexDefault(row int, column int, parent QMode
 
 //export callbackQSortFilterProxyModel_MapFromSource
 func callbackQSortFilterProxyModel_MapFromSource(ptr unsafe.Pointer, sourceIndex unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapFromSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapFromSource"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(sourceIndex)))
 	}
 
@@ -33179,14 +34132,14 @@ func callbackQSortFilterProxyModel_MapFromSource(ptr unsafe.Pointer, sourceIndex
 func (ptr *QSortFilterProxyModel) ConnectMapFromSource(f func(sourceIndex *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapFromSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapFromSource", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectMapFromSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapFromSource")
+		qt.DisconnectSignal(ptr.Pointer(), "mapFromSource")
 	}
 }
 
@@ -33210,7 +34163,7 @@ func (ptr *QSortFilterProxyModel) MapFromSourceDefault(sourceIndex QModelIndex_I
 
 //export callbackQSortFilterProxyModel_MapToSource
 func callbackQSortFilterProxyModel_MapToSource(ptr unsafe.Pointer, proxyIndex unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mapToSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mapToSource"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(proxyIndex)))
 	}
 
@@ -33220,14 +34173,14 @@ func callbackQSortFilterProxyModel_MapToSource(ptr unsafe.Pointer, proxyIndex un
 func (ptr *QSortFilterProxyModel) ConnectMapToSource(f func(proxyIndex *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mapToSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "mapToSource", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectMapToSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mapToSource")
+		qt.DisconnectSignal(ptr.Pointer(), "mapToSource")
 	}
 }
 
@@ -33251,7 +34204,7 @@ func (ptr *QSortFilterProxyModel) MapToSourceDefault(proxyIndex QModelIndex_ITF)
 
 //export callbackQSortFilterProxyModel_Parent
 func callbackQSortFilterProxyModel_Parent(ptr unsafe.Pointer, child unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return PointerFromQModelIndex(signal.(func(*QModelIndex) *QModelIndex)(NewQModelIndexFromPointer(child)))
 	}
 
@@ -33261,14 +34214,14 @@ func callbackQSortFilterProxyModel_Parent(ptr unsafe.Pointer, child unsafe.Point
 func (ptr *QSortFilterProxyModel) ConnectParent(f func(child *QModelIndex) *QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parent", f)
+		qt.ConnectSignal(ptr.Pointer(), "parent", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectParent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parent")
+		qt.DisconnectSignal(ptr.Pointer(), "parent")
 	}
 }
 
@@ -33329,7 +34282,7 @@ func (ptr *QSortFilterProxyModel) DynamicSortFilter() bool {
 
 //export callbackQSortFilterProxyModel_FilterAcceptsColumn
 func callbackQSortFilterProxyModel_FilterAcceptsColumn(ptr unsafe.Pointer, source_column C.int, source_parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filterAcceptsColumn"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filterAcceptsColumn"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, *QModelIndex) bool)(int(int32(source_column)), NewQModelIndexFromPointer(source_parent)))))
 	}
 
@@ -33339,14 +34292,14 @@ func callbackQSortFilterProxyModel_FilterAcceptsColumn(ptr unsafe.Pointer, sourc
 func (ptr *QSortFilterProxyModel) ConnectFilterAcceptsColumn(f func(source_column int, source_parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filterAcceptsColumn", f)
+		qt.ConnectSignal(ptr.Pointer(), "filterAcceptsColumn", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectFilterAcceptsColumn() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filterAcceptsColumn")
+		qt.DisconnectSignal(ptr.Pointer(), "filterAcceptsColumn")
 	}
 }
 
@@ -33366,7 +34319,7 @@ func (ptr *QSortFilterProxyModel) FilterAcceptsColumnDefault(source_column int,
 
 //export callbackQSortFilterProxyModel_FilterAcceptsRow
 func callbackQSortFilterProxyModel_FilterAcceptsRow(ptr unsafe.Pointer, source_row C.int, source_parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filterAcceptsRow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filterAcceptsRow"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, *QModelIndex) bool)(int(int32(source_row)), NewQModelIndexFromPointer(source_parent)))))
 	}
 
@@ -33376,14 +34329,14 @@ func callbackQSortFilterProxyModel_FilterAcceptsRow(ptr unsafe.Pointer, source_r
 func (ptr *QSortFilterProxyModel) ConnectFilterAcceptsRow(f func(source_row int, source_parent *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filterAcceptsRow", f)
+		qt.ConnectSignal(ptr.Pointer(), "filterAcceptsRow", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectFilterAcceptsRow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filterAcceptsRow")
+		qt.DisconnectSignal(ptr.Pointer(), "filterAcceptsRow")
 	}
 }
 
@@ -33410,7 +34363,7 @@ func (ptr *QSortFilterProxyModel) IsSortLocaleAware() bool {
 
 //export callbackQSortFilterProxyModel_LessThan
 func callbackQSortFilterProxyModel_LessThan(ptr unsafe.Pointer, source_left unsafe.Pointer, source_right unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lessThan"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lessThan"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QModelIndex, *QModelIndex) bool)(NewQModelIndexFromPointer(source_left), NewQModelIndexFromPointer(source_right)))))
 	}
 
@@ -33420,14 +34373,14 @@ func callbackQSortFilterProxyModel_LessThan(ptr unsafe.Pointer, source_left unsa
 func (ptr *QSortFilterProxyModel) ConnectLessThan(f func(source_left *QModelIndex, source_right *QModelIndex) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lessThan", f)
+		qt.ConnectSignal(ptr.Pointer(), "lessThan", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectLessThan() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lessThan")
+		qt.DisconnectSignal(ptr.Pointer(), "lessThan")
 	}
 }
 
@@ -33447,7 +34400,7 @@ func (ptr *QSortFilterProxyModel) LessThanDefault(source_left QModelIndex_ITF, s
 
 //export callbackQSortFilterProxyModel_ColumnCount
 func callbackQSortFilterProxyModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -33457,14 +34410,14 @@ func callbackQSortFilterProxyModel_ColumnCount(ptr unsafe.Pointer, parent unsafe
 func (ptr *QSortFilterProxyModel) ConnectColumnCount(f func(parent *QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCount", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectColumnCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCount")
 	}
 }
 
@@ -33498,7 +34451,7 @@ func (ptr *QSortFilterProxyModel) FilterRole() int {
 
 //export callbackQSortFilterProxyModel_RowCount
 func callbackQSortFilterProxyModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -33508,14 +34461,14 @@ func callbackQSortFilterProxyModel_RowCount(ptr unsafe.Pointer, parent unsafe.Po
 func (ptr *QSortFilterProxyModel) ConnectRowCount(f func(parent *QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCount", f)
 	}
 }
 
 func (ptr *QSortFilterProxyModel) DisconnectRowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCount")
 	}
 }
 
@@ -33685,7 +34638,7 @@ func (ptr *QStandardPaths) DisplayName(ty QStandardPaths__StandardLocation) stri
 func QStandardPaths_FindExecutable(executableName string, paths []string) string {
 	var executableNameC = C.CString(executableName)
 	defer C.free(unsafe.Pointer(executableNameC))
-	var pathsC = C.CString(strings.Join(paths, "|"))
+	var pathsC = cGoPackStringList(paths)
 	defer C.free(unsafe.Pointer(pathsC))
 	return cGoUnpackString(C.QStandardPaths_QStandardPaths_FindExecutable(executableNameC, pathsC))
 }
@@ -33693,7 +34646,7 @@ func QStandardPaths_FindExecutable(executableName string, paths []string) string
 func (ptr *QStandardPaths) FindExecutable(executableName string, paths []string) string {
 	var executableNameC = C.CString(executableName)
 	defer C.free(unsafe.Pointer(executableNameC))
-	var pathsC = C.CString(strings.Join(paths, "|"))
+	var pathsC = cGoPackStringList(paths)
 	defer C.free(unsafe.Pointer(pathsC))
 	return cGoUnpackString(C.QStandardPaths_QStandardPaths_FindExecutable(executableNameC, pathsC))
 }
@@ -33721,21 +34674,21 @@ func (ptr *QStandardPaths) WritableLocation(ty QStandardPaths__StandardLocation)
 func QStandardPaths_LocateAll(ty QStandardPaths__StandardLocation, fileName string, options QStandardPaths__LocateOption) []string {
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
-	return strings.Split(cGoUnpackString(C.QStandardPaths_QStandardPaths_LocateAll(C.longlong(ty), fileNameC, C.longlong(options))), "|")
+	return cGoUnpackStringListAndFree(C.QStandardPaths_QStandardPaths_LocateAll(C.longlong(ty), fileNameC, C.longlong(options)))
 }
 
 func (ptr *QStandardPaths) LocateAll(ty QStandardPaths__StandardLocation, fileName string, options QStandardPaths__LocateOption) []string {
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
-	return strings.Split(cGoUnpackString(C.QStandardPaths_QStandardPaths_LocateAll(C.longlong(ty), fileNameC, C.longlong(options))), "|")
+	return cGoUnpackStringListAndFree(C.QStandardPaths_QStandardPaths_LocateAll(C.longlong(ty), fileNameC, C.longlong(options)))
 }
 
 func QStandardPaths_StandardLocations(ty QStandardPaths__StandardLocation) []string {
-	return strings.Split(cGoUnpackString(C.QStandardPaths_QStandardPaths_StandardLocations(C.longlong(ty))), "|")
+	return cGoUnpackStringListAndFree(C.QStandardPaths_QStandardPaths_StandardLocations(C.longlong(ty)))
 }
 
 func (ptr *QStandardPaths) StandardLocations(ty QStandardPaths__StandardLocation) []string {
-	return strings.Split(cGoUnpackString(C.QStandardPaths_QStandardPaths_StandardLocations(C.longlong(ty))), "|")
+	return cGoUnpackStringListAndFree(C.QStandardPaths_QStandardPaths_StandardLocations(C.longlong(ty)))
 }
 
 func QStandardPaths_SetTestModeEnabled(testMode bool) {
@@ -33806,7 +34759,7 @@ const (
 func (ptr *QState) AddTransition4(target QAbstractState_ITF) *QAbstractTransition {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractTransitionFromPointer(C.QState_AddTransition4(ptr.Pointer(), PointerFromQAbstractState(target)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33819,7 +34772,7 @@ func (ptr *QState) AddTransition2(sender QObject_ITF, sign string, target QAbstr
 		var signC = C.CString(sign)
 		defer C.free(unsafe.Pointer(signC))
 		var tmpValue = NewQSignalTransitionFromPointer(C.QState_AddTransition2(ptr.Pointer(), PointerFromQObject(sender), signC, PointerFromQAbstractState(target)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33829,7 +34782,7 @@ func (ptr *QState) AddTransition2(sender QObject_ITF, sign string, target QAbstr
 
 func NewQState2(childMode QState__ChildMode, parent QState_ITF) *QState {
 	var tmpValue = NewQStateFromPointer(C.QState_NewQState2(C.longlong(childMode), PointerFromQState(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -33837,7 +34790,7 @@ func NewQState2(childMode QState__ChildMode, parent QState_ITF) *QState {
 
 func NewQState(parent QState_ITF) *QState {
 	var tmpValue = NewQStateFromPointer(C.QState_NewQState(PointerFromQState(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -33859,7 +34812,7 @@ func (ptr *QState) AssignProperty(object QObject_ITF, name string, value QVarian
 
 //export callbackQState_ChildModeChanged
 func callbackQState_ChildModeChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childModeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childModeChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -33868,20 +34821,20 @@ func callbackQState_ChildModeChanged(ptr unsafe.Pointer) {
 func (ptr *QState) ConnectChildModeChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QState_ConnectChildModeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "childModeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "childModeChanged", f)
 	}
 }
 
 func (ptr *QState) DisconnectChildModeChanged() {
 	if ptr.Pointer() != nil {
 		C.QState_DisconnectChildModeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "childModeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "childModeChanged")
 	}
 }
 
 //export callbackQState_ErrorStateChanged
 func callbackQState_ErrorStateChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorStateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorStateChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -33890,20 +34843,20 @@ func callbackQState_ErrorStateChanged(ptr unsafe.Pointer) {
 func (ptr *QState) ConnectErrorStateChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QState_ConnectErrorStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorStateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorStateChanged", f)
 	}
 }
 
 func (ptr *QState) DisconnectErrorStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QState_DisconnectErrorStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorStateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "errorStateChanged")
 	}
 }
 
 //export callbackQState_Finished
 func callbackQState_Finished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -33912,20 +34865,20 @@ func callbackQState_Finished(ptr unsafe.Pointer) {
 func (ptr *QState) ConnectFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QState_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QState) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QState_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
 //export callbackQState_InitialStateChanged
 func callbackQState_InitialStateChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "initialStateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "initialStateChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -33934,20 +34887,20 @@ func callbackQState_InitialStateChanged(ptr unsafe.Pointer) {
 func (ptr *QState) ConnectInitialStateChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QState_ConnectInitialStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "initialStateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "initialStateChanged", f)
 	}
 }
 
 func (ptr *QState) DisconnectInitialStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QState_DisconnectInitialStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "initialStateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "initialStateChanged")
 	}
 }
 
 //export callbackQState_OnEntry
 func callbackQState_OnEntry(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onEntry"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onEntry"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	} else {
 		NewQStateFromPointer(ptr).OnEntryDefault(NewQEventFromPointer(event))
@@ -33957,14 +34910,14 @@ func callbackQState_OnEntry(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QState) ConnectOnEntry(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onEntry", f)
+		qt.ConnectSignal(ptr.Pointer(), "onEntry", f)
 	}
 }
 
 func (ptr *QState) DisconnectOnEntry() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onEntry")
+		qt.DisconnectSignal(ptr.Pointer(), "onEntry")
 	}
 }
 
@@ -33982,7 +34935,7 @@ func (ptr *QState) OnEntryDefault(event QEvent_ITF) {
 
 //export callbackQState_OnExit
 func callbackQState_OnExit(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onExit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onExit"); signal != nil {
 		signal.(func(*QEvent))(NewQEventFromPointer(event))
 	} else {
 		NewQStateFromPointer(ptr).OnExitDefault(NewQEventFromPointer(event))
@@ -33992,14 +34945,14 @@ func callbackQState_OnExit(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QState) ConnectOnExit(f func(event *QEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onExit", f)
+		qt.ConnectSignal(ptr.Pointer(), "onExit", f)
 	}
 }
 
 func (ptr *QState) DisconnectOnExit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onExit")
+		qt.DisconnectSignal(ptr.Pointer(), "onExit")
 	}
 }
 
@@ -34017,7 +34970,7 @@ func (ptr *QState) OnExitDefault(event QEvent_ITF) {
 
 //export callbackQState_PropertiesAssigned
 func callbackQState_PropertiesAssigned(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "propertiesAssigned"); signal != nil {
+	if signal := qt.GetSignal(ptr, "propertiesAssigned"); signal != nil {
 		signal.(func())()
 	}
 
@@ -34026,14 +34979,14 @@ func callbackQState_PropertiesAssigned(ptr unsafe.Pointer) {
 func (ptr *QState) ConnectPropertiesAssigned(f func()) {
 	if ptr.Pointer() != nil {
 		C.QState_ConnectPropertiesAssigned(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "propertiesAssigned", f)
+		qt.ConnectSignal(ptr.Pointer(), "propertiesAssigned", f)
 	}
 }
 
 func (ptr *QState) DisconnectPropertiesAssigned() {
 	if ptr.Pointer() != nil {
 		C.QState_DisconnectPropertiesAssigned(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "propertiesAssigned")
+		qt.DisconnectSignal(ptr.Pointer(), "propertiesAssigned")
 	}
 }
 
@@ -34064,7 +35017,7 @@ func (ptr *QState) SetInitialState(state QAbstractState_ITF) {
 func (ptr *QState) DestroyQState() {
 	if ptr.Pointer() != nil {
 		C.QState_DestroyQState(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -34079,7 +35032,7 @@ func (ptr *QState) ChildMode() QState__ChildMode {
 func (ptr *QState) ErrorState() *QAbstractState {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractStateFromPointer(C.QState_ErrorState(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -34090,7 +35043,7 @@ func (ptr *QState) ErrorState() *QAbstractState {
 func (ptr *QState) InitialState() *QAbstractState {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractStateFromPointer(C.QState_InitialState(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -34114,7 +35067,7 @@ func (ptr *QState) Transitions() []*QAbstractTransition {
 func (ptr *QState) __transitions_atList(i int) *QAbstractTransition {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractTransitionFromPointer(C.QState___transitions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -34193,7 +35146,7 @@ const (
 
 func NewQStateMachine(parent QObject_ITF) *QStateMachine {
 	var tmpValue = NewQStateMachineFromPointer(C.QStateMachine_NewQStateMachine(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -34201,7 +35154,7 @@ func NewQStateMachine(parent QObject_ITF) *QStateMachine {
 
 func NewQStateMachine2(childMode QState__ChildMode, parent QObject_ITF) *QStateMachine {
 	var tmpValue = NewQStateMachineFromPointer(C.QStateMachine_NewQStateMachine2(C.longlong(childMode), PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -34259,7 +35212,7 @@ func (ptr *QStateMachine) RemoveState(state QAbstractState_ITF) {
 
 //export callbackQStateMachine_RunningChanged
 func callbackQStateMachine_RunningChanged(ptr unsafe.Pointer, running C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "runningChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "runningChanged"); signal != nil {
 		signal.(func(bool))(int8(running) != 0)
 	}
 
@@ -34268,14 +35221,14 @@ func callbackQStateMachine_RunningChanged(ptr unsafe.Pointer, running C.char) {
 func (ptr *QStateMachine) ConnectRunningChanged(f func(running bool)) {
 	if ptr.Pointer() != nil {
 		C.QStateMachine_ConnectRunningChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "runningChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "runningChanged", f)
 	}
 }
 
 func (ptr *QStateMachine) DisconnectRunningChanged() {
 	if ptr.Pointer() != nil {
 		C.QStateMachine_DisconnectRunningChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "runningChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "runningChanged")
 	}
 }
 
@@ -34299,7 +35252,7 @@ func (ptr *QStateMachine) SetGlobalRestorePolicy(restorePolicy QState__RestorePo
 
 //export callbackQStateMachine_SetRunning
 func callbackQStateMachine_SetRunning(ptr unsafe.Pointer, running C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRunning"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRunning"); signal != nil {
 		signal.(func(bool))(int8(running) != 0)
 	} else {
 		NewQStateMachineFromPointer(ptr).SetRunningDefault(int8(running) != 0)
@@ -34309,14 +35262,14 @@ func callbackQStateMachine_SetRunning(ptr unsafe.Pointer, running C.char) {
 func (ptr *QStateMachine) ConnectSetRunning(f func(running bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setRunning", f)
+		qt.ConnectSignal(ptr.Pointer(), "setRunning", f)
 	}
 }
 
 func (ptr *QStateMachine) DisconnectSetRunning() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setRunning")
+		qt.DisconnectSignal(ptr.Pointer(), "setRunning")
 	}
 }
 
@@ -34334,7 +35287,7 @@ func (ptr *QStateMachine) SetRunningDefault(running bool) {
 
 //export callbackQStateMachine_Start
 func callbackQStateMachine_Start(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQStateMachineFromPointer(ptr).StartDefault()
@@ -34344,14 +35297,14 @@ func callbackQStateMachine_Start(ptr unsafe.Pointer) {
 func (ptr *QStateMachine) ConnectStart(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QStateMachine) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -34369,7 +35322,7 @@ func (ptr *QStateMachine) StartDefault() {
 
 //export callbackQStateMachine_Started
 func callbackQStateMachine_Started(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "started"); signal != nil {
+	if signal := qt.GetSignal(ptr, "started"); signal != nil {
 		signal.(func())()
 	}
 
@@ -34378,20 +35331,20 @@ func callbackQStateMachine_Started(ptr unsafe.Pointer) {
 func (ptr *QStateMachine) ConnectStarted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QStateMachine_ConnectStarted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "started", f)
+		qt.ConnectSignal(ptr.Pointer(), "started", f)
 	}
 }
 
 func (ptr *QStateMachine) DisconnectStarted() {
 	if ptr.Pointer() != nil {
 		C.QStateMachine_DisconnectStarted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "started")
+		qt.DisconnectSignal(ptr.Pointer(), "started")
 	}
 }
 
 //export callbackQStateMachine_Stop
 func callbackQStateMachine_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQStateMachineFromPointer(ptr).StopDefault()
@@ -34401,14 +35354,14 @@ func callbackQStateMachine_Stop(ptr unsafe.Pointer) {
 func (ptr *QStateMachine) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QStateMachine) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -34426,7 +35379,7 @@ func (ptr *QStateMachine) StopDefault() {
 
 //export callbackQStateMachine_Stopped
 func callbackQStateMachine_Stopped(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stopped"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stopped"); signal != nil {
 		signal.(func())()
 	}
 
@@ -34435,21 +35388,21 @@ func callbackQStateMachine_Stopped(ptr unsafe.Pointer) {
 func (ptr *QStateMachine) ConnectStopped(f func()) {
 	if ptr.Pointer() != nil {
 		C.QStateMachine_ConnectStopped(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stopped", f)
+		qt.ConnectSignal(ptr.Pointer(), "stopped", f)
 	}
 }
 
 func (ptr *QStateMachine) DisconnectStopped() {
 	if ptr.Pointer() != nil {
 		C.QStateMachine_DisconnectStopped(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stopped")
+		qt.DisconnectSignal(ptr.Pointer(), "stopped")
 	}
 }
 
 func (ptr *QStateMachine) DestroyQStateMachine() {
 	if ptr.Pointer() != nil {
 		C.QStateMachine_DestroyQStateMachine(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -34505,7 +35458,7 @@ func (ptr *QStateMachine) IsRunning() bool {
 func (ptr *QStateMachine) __defaultAnimations_atList(i int) *QAbstractAnimation {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractAnimationFromPointer(C.QStateMachine___defaultAnimations_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -34571,7 +35524,7 @@ func (ptr *QStaticPlugin) DestroyQStaticPlugin() {
 func (ptr *QStaticPlugin) Instance() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QStaticPlugin_Instance(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -34670,18 +35623,30 @@ func NewQStorageInfo() *QStorageInfo {
 	return tmpValue
 }
 
+func (arena *Arena) NewQStorageInfo() *QStorageInfo {
+	return NewQStorageInfoFromPointer(C.QStorageInfo_NewQStorageInfoInArena(arena.Pointer()))
+}
+
 func NewQStorageInfo3(dir QDir_ITF) *QStorageInfo {
 	var tmpValue = NewQStorageInfoFromPointer(C.QStorageInfo_NewQStorageInfo3(PointerFromQDir(dir)))
 	runtime.SetFinalizer(tmpValue, (*QStorageInfo).DestroyQStorageInfo)
 	return tmpValue
 }
 
+func (arena *Arena) NewQStorageInfo3(dir QDir_ITF) *QStorageInfo {
+	return NewQStorageInfoFromPointer(C.QStorageInfo_NewQStorageInfo3InArena(arena.Pointer(), PointerFromQDir(dir)))
+}
+
 func NewQStorageInfo4(other QStorageInfo_ITF) *QStorageInfo {
 	var tmpValue = NewQStorageInfoFromPointer(C.QStorageInfo_NewQStorageInfo4(PointerFromQStorageInfo(other)))
 	runtime.SetFinalizer(tmpValue, (*QStorageInfo).DestroyQStorageInfo)
 	return tmpValue
 }
 
+func (arena *Arena) NewQStorageInfo4(other QStorageInfo_ITF) *QStorageInfo {
+	return NewQStorageInfoFromPointer(C.QStorageInfo_NewQStorageInfo4InArena(arena.Pointer(), PointerFromQStorageInfo(other)))
+}
+
 func NewQStorageInfo2(path string) *QStorageInfo {
 	var pathC = C.CString(path)
 	defer C.free(unsafe.Pointer(pathC))
@@ -34690,6 +35655,12 @@ func NewQStorageInfo2(path string) *QStorageInfo {
 	return tmpValue
 }
 
+func (arena *Arena) NewQStorageInfo2(path string) *QStorageInfo {
+	var pathC = C.CString(path)
+	defer C.free(unsafe.Pointer(pathC))
+	return NewQStorageInfoFromPointer(C.QStorageInfo_NewQStorageInfo2InArena(arena.Pointer(), pathC))
+}
+
 func (ptr *QStorageInfo) Refresh() {
 	if ptr.Pointer() != nil {
 		C.QStorageInfo_Refresh(ptr.Pointer())
@@ -34989,24 +35960,24 @@ func NewQStringListModelFromPointer(ptr unsafe.Pointer) *QStringListModel {
 func (ptr *QStringListModel) DestroyQStringListModel() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func NewQStringListModel(parent QObject_ITF) *QStringListModel {
 	var tmpValue = NewQStringListModelFromPointer(C.QStringListModel_NewQStringListModel(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
 }
 
 func NewQStringListModel2(strin []string, parent QObject_ITF) *QStringListModel {
-	var strinC = C.CString(strings.Join(strin, "|"))
+	var strinC = cGoPackStringList(strin)
 	defer C.free(unsafe.Pointer(strinC))
 	var tmpValue = NewQStringListModelFromPointer(C.QStringListModel_NewQStringListModel2(strinC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -35014,7 +35985,7 @@ func NewQStringListModel2(strin []string, parent QObject_ITF) *QStringListModel
 
 func (ptr *QStringListModel) SetStringList(strin []string) {
 	if ptr.Pointer() != nil {
-		var strinC = C.CString(strings.Join(strin, "|"))
+		var strinC = cGoPackStringList(strin)
 		defer C.free(unsafe.Pointer(strinC))
 		C.QStringListModel_SetStringList(ptr.Pointer(), strinC)
 	}
@@ -35022,31 +35993,37 @@ func (ptr *QStringListModel) SetStringList(strin []string) {
 
 func (ptr *QStringListModel) StringList() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QStringListModel_StringList(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QStringListModel_StringList(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQStringListModel_Data
-func callbackQStringListModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
-		return PointerFromQVariant(signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(index), int(int32(role))))
+func callbackQStringListModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int, ret unsafe.Pointer) {
+	if signal := qt.GetSignal(ptr, "dataInto"); signal != nil {
+		signal.(func(*QModelIndex, int, *QVariant))(NewQModelIndexFromPointer(index), int(int32(role)), NewQVariantFromPointer(ret))
+		return
+	}
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
+		var tmpValue = signal.(func(*QModelIndex, int) *QVariant)(NewQModelIndexFromPointer(index), int(int32(role)))
+		NewQVariantFromPointer(ret).Assign(tmpValue)
+		return
 	}
 
-	return PointerFromQVariant(NewQStringListModelFromPointer(ptr).DataDefault(NewQModelIndexFromPointer(index), int(int32(role))))
+	C.QStringListModel_DataDefaultInto(ptr, index, role, ret)
 }
 
 func (ptr *QStringListModel) ConnectData(f func(index *QModelIndex, role int) *QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QStringListModel) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
@@ -35070,7 +36047,7 @@ func (ptr *QStringListModel) DataDefault(index QModelIndex_ITF, role int) *QVari
 
 //export callbackQStringListModel_RowCount
 func callbackQStringListModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*QModelIndex) int)(NewQModelIndexFromPointer(parent))))
 	}
 
@@ -35080,14 +36057,14 @@ func callbackQStringListModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer
 func (ptr *QStringListModel) ConnectRowCount(f func(parent *QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCount", f)
 	}
 }
 
 func (ptr *QStringListModel) DisconnectRowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCount")
 	}
 }
 
@@ -35148,12 +36125,20 @@ func NewQStringMatcher() *QStringMatcher {
 	return tmpValue
 }
 
+func (arena *Arena) NewQStringMatcher() *QStringMatcher {
+	return NewQStringMatcherFromPointer(C.QStringMatcher_NewQStringMatcherInArena(arena.Pointer()))
+}
+
 func NewQStringMatcher3(uc QChar_ITF, length int, cs Qt__CaseSensitivity) *QStringMatcher {
 	var tmpValue = NewQStringMatcherFromPointer(C.QStringMatcher_NewQStringMatcher3(PointerFromQChar(uc), C.int(int32(length)), C.longlong(cs)))
 	runtime.SetFinalizer(tmpValue, (*QStringMatcher).DestroyQStringMatcher)
 	return tmpValue
 }
 
+func (arena *Arena) NewQStringMatcher3(uc QChar_ITF, length int, cs Qt__CaseSensitivity) *QStringMatcher {
+	return NewQStringMatcherFromPointer(C.QStringMatcher_NewQStringMatcher3InArena(arena.Pointer(), PointerFromQChar(uc), C.int(int32(length)), C.longlong(cs)))
+}
+
 func NewQStringMatcher2(pattern string, cs Qt__CaseSensitivity) *QStringMatcher {
 	var patternC = C.CString(pattern)
 	defer C.free(unsafe.Pointer(patternC))
@@ -35162,12 +36147,22 @@ func NewQStringMatcher2(pattern string, cs Qt__CaseSensitivity) *QStringMatcher
 	return tmpValue
 }
 
+func (arena *Arena) NewQStringMatcher2(pattern string, cs Qt__CaseSensitivity) *QStringMatcher {
+	var patternC = C.CString(pattern)
+	defer C.free(unsafe.Pointer(patternC))
+	return NewQStringMatcherFromPointer(C.QStringMatcher_NewQStringMatcher2InArena(arena.Pointer(), patternC, C.longlong(cs)))
+}
+
 func NewQStringMatcher4(other QStringMatcher_ITF) *QStringMatcher {
 	var tmpValue = NewQStringMatcherFromPointer(C.QStringMatcher_NewQStringMatcher4(PointerFromQStringMatcher(other)))
 	runtime.SetFinalizer(tmpValue, (*QStringMatcher).DestroyQStringMatcher)
 	return tmpValue
 }
 
+func (arena *Arena) NewQStringMatcher4(other QStringMatcher_ITF) *QStringMatcher {
+	return NewQStringMatcherFromPointer(C.QStringMatcher_NewQStringMatcher4InArena(arena.Pointer(), PointerFromQStringMatcher(other)))
+}
+
 func (ptr *QStringMatcher) SetCaseSensitivity(cs Qt__CaseSensitivity) {
 	if ptr.Pointer() != nil {
 		C.QStringMatcher_SetCaseSensitivity(ptr.Pointer(), C.longlong(cs))
@@ -35262,12 +36257,20 @@ func NewQStringRef() *QStringRef {
 	return tmpValue
 }
 
+func (arena *Arena) NewQStringRef() *QStringRef {
+	return NewQStringRefFromPointer(C.QStringRef_NewQStringRefInArena(arena.Pointer()))
+}
+
 func NewQStringRef5(other QStringRef_ITF) *QStringRef {
 	var tmpValue = NewQStringRefFromPointer(C.QStringRef_NewQStringRef5(PointerFromQStringRef(other)))
 	runtime.SetFinalizer(tmpValue, (*QStringRef).DestroyQStringRef)
 	return tmpValue
 }
 
+func (arena *Arena) NewQStringRef5(other QStringRef_ITF) *QStringRef {
+	return NewQStringRefFromPointer(C.QStringRef_NewQStringRef5InArena(arena.Pointer(), PointerFromQStringRef(other)))
+}
+
 func NewQStringRef3(stri string) *QStringRef {
 	var striC = C.CString(stri)
 	defer C.free(unsafe.Pointer(striC))
@@ -35276,6 +36279,12 @@ func NewQStringRef3(stri string) *QStringRef {
 	return tmpValue
 }
 
+func (arena *Arena) NewQStringRef3(stri string) *QStringRef {
+	var striC = C.CString(stri)
+	defer C.free(unsafe.Pointer(striC))
+	return NewQStringRefFromPointer(C.QStringRef_NewQStringRef3InArena(arena.Pointer(), striC))
+}
+
 func NewQStringRef2(stri string, position int, length int) *QStringRef {
 	var striC = C.CString(stri)
 	defer C.free(unsafe.Pointer(striC))
@@ -35284,12 +36293,22 @@ func NewQStringRef2(stri string, position int, length int) *QStringRef {
 	return tmpValue
 }
 
+func (arena *Arena) NewQStringRef2(stri string, position int, length int) *QStringRef {
+	var striC = C.CString(stri)
+	defer C.free(unsafe.Pointer(striC))
+	return NewQStringRefFromPointer(C.QStringRef_NewQStringRef2InArena(arena.Pointer(), striC, C.int(int32(position)), C.int(int32(length))))
+}
+
 func NewQStringRef4(other QStringRef_ITF) *QStringRef {
 	var tmpValue = NewQStringRefFromPointer(C.QStringRef_NewQStringRef4(PointerFromQStringRef(other)))
 	runtime.SetFinalizer(tmpValue, (*QStringRef).DestroyQStringRef)
 	return tmpValue
 }
 
+func (arena *Arena) NewQStringRef4(other QStringRef_ITF) *QStringRef {
+	return NewQStringRefFromPointer(C.QStringRef_NewQStringRef4InArena(arena.Pointer(), PointerFromQStringRef(other)))
+}
+
 func QStringRef_Compare7(s1 QStringRef_ITF, s2 QLatin1String_ITF, cs Qt__CaseSensitivity) int {
 	return int(int32(C.QStringRef_QStringRef_Compare7(PointerFromQStringRef(s1), PointerFromQLatin1String(s2), C.longlong(cs))))
 }
@@ -36236,6 +37255,12 @@ func NewQSystemSemaphore(key string, initialValue int, mode QSystemSemaphore__Ac
 	return tmpValue
 }
 
+func (arena *Arena) NewQSystemSemaphore(key string, initialValue int, mode QSystemSemaphore__AccessMode) *QSystemSemaphore {
+	var keyC = C.CString(key)
+	defer C.free(unsafe.Pointer(keyC))
+	return NewQSystemSemaphoreFromPointer(C.QSystemSemaphore_NewQSystemSemaphoreInArena(arena.Pointer(), keyC, C.int(int32(initialValue)), C.longlong(mode)))
+}
+
 func (ptr *QSystemSemaphore) Acquire() bool {
 	if ptr.Pointer() != nil {
 		return C.QSystemSemaphore_Acquire(ptr.Pointer()) != 0
@@ -36329,6 +37354,10 @@ func NewQTemporaryDir() *QTemporaryDir {
 	return tmpValue
 }
 
+func (arena *Arena) NewQTemporaryDir() *QTemporaryDir {
+	return NewQTemporaryDirFromPointer(C.QTemporaryDir_NewQTemporaryDirInArena(arena.Pointer()))
+}
+
 func NewQTemporaryDir2(templatePath string) *QTemporaryDir {
 	var templatePathC = C.CString(templatePath)
 	defer C.free(unsafe.Pointer(templatePathC))
@@ -36337,6 +37366,12 @@ func NewQTemporaryDir2(templatePath string) *QTemporaryDir {
 	return tmpValue
 }
 
+func (arena *Arena) NewQTemporaryDir2(templatePath string) *QTemporaryDir {
+	var templatePathC = C.CString(templatePath)
+	defer C.free(unsafe.Pointer(templatePathC))
+	return NewQTemporaryDirFromPointer(C.QTemporaryDir_NewQTemporaryDir2InArena(arena.Pointer(), templatePathC))
+}
+
 func (ptr *QTemporaryDir) Remove() bool {
 	if ptr.Pointer() != nil {
 		return C.QTemporaryDir_Remove(ptr.Pointer()) != 0
@@ -36425,7 +37460,7 @@ func NewQTemporaryFileFromPointer(ptr unsafe.Pointer) *QTemporaryFile {
 }
 func QTemporaryFile_CreateNativeFile(file QFile_ITF) *QTemporaryFile {
 	var tmpValue = NewQTemporaryFileFromPointer(C.QTemporaryFile_QTemporaryFile_CreateNativeFile(PointerFromQFile(file)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -36433,7 +37468,7 @@ func QTemporaryFile_CreateNativeFile(file QFile_ITF) *QTemporaryFile {
 
 func (ptr *QTemporaryFile) CreateNativeFile(file QFile_ITF) *QTemporaryFile {
 	var tmpValue = NewQTemporaryFileFromPointer(C.QTemporaryFile_QTemporaryFile_CreateNativeFile(PointerFromQFile(file)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -36443,7 +37478,7 @@ func QTemporaryFile_CreateNativeFile2(fileName string) *QTemporaryFile {
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQTemporaryFileFromPointer(C.QTemporaryFile_QTemporaryFile_CreateNativeFile2(fileNameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -36453,7 +37488,7 @@ func (ptr *QTemporaryFile) CreateNativeFile2(fileName string) *QTemporaryFile {
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQTemporaryFileFromPointer(C.QTemporaryFile_QTemporaryFile_CreateNativeFile2(fileNameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -36461,7 +37496,7 @@ func (ptr *QTemporaryFile) CreateNativeFile2(fileName string) *QTemporaryFile {
 
 func NewQTemporaryFile() *QTemporaryFile {
 	var tmpValue = NewQTemporaryFileFromPointer(C.QTemporaryFile_NewQTemporaryFile())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -36469,7 +37504,7 @@ func NewQTemporaryFile() *QTemporaryFile {
 
 func NewQTemporaryFile3(parent QObject_ITF) *QTemporaryFile {
 	var tmpValue = NewQTemporaryFileFromPointer(C.QTemporaryFile_NewQTemporaryFile3(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -36479,7 +37514,7 @@ func NewQTemporaryFile2(templateName string) *QTemporaryFile {
 	var templateNameC = C.CString(templateName)
 	defer C.free(unsafe.Pointer(templateNameC))
 	var tmpValue = NewQTemporaryFileFromPointer(C.QTemporaryFile_NewQTemporaryFile2(templateNameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -36489,7 +37524,7 @@ func NewQTemporaryFile4(templateName string, parent QObject_ITF) *QTemporaryFile
 	var templateNameC = C.CString(templateName)
 	defer C.free(unsafe.Pointer(templateNameC))
 	var tmpValue = NewQTemporaryFileFromPointer(C.QTemporaryFile_NewQTemporaryFile4(templateNameC, PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -36519,7 +37554,7 @@ func (ptr *QTemporaryFile) SetFileTemplate(name string) {
 func (ptr *QTemporaryFile) DestroyQTemporaryFile() {
 	if ptr.Pointer() != nil {
 		C.QTemporaryFile_DestroyQTemporaryFile(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -36606,6 +37641,10 @@ func NewQTextBoundaryFinder() *QTextBoundaryFinder {
 	return tmpValue
 }
 
+func (arena *Arena) NewQTextBoundaryFinder() *QTextBoundaryFinder {
+	return NewQTextBoundaryFinderFromPointer(C.QTextBoundaryFinder_NewQTextBoundaryFinderInArena(arena.Pointer()))
+}
+
 func NewQTextBoundaryFinder3(ty QTextBoundaryFinder__BoundaryType, stri string) *QTextBoundaryFinder {
 	var striC = C.CString(stri)
 	defer C.free(unsafe.Pointer(striC))
@@ -36614,12 +37653,22 @@ func NewQTextBoundaryFinder3(ty QTextBoundaryFinder__BoundaryType, stri string)
 	return tmpValue
 }
 
+func (arena *Arena) NewQTextBoundaryFinder3(ty QTextBoundaryFinder__BoundaryType, stri string) *QTextBoundaryFinder {
+	var striC = C.CString(stri)
+	defer C.free(unsafe.Pointer(striC))
+	return NewQTextBoundaryFinderFromPointer(C.QTextBoundaryFinder_NewQTextBoundaryFinder3InArena(arena.Pointer(), C.longlong(ty), striC))
+}
+
 func NewQTextBoundaryFinder2(other QTextBoundaryFinder_ITF) *QTextBoundaryFinder {
 	var tmpValue = NewQTextBoundaryFinderFromPointer(C.QTextBoundaryFinder_NewQTextBoundaryFinder2(PointerFromQTextBoundaryFinder(other)))
 	runtime.SetFinalizer(tmpValue, (*QTextBoundaryFinder).DestroyQTextBoundaryFinder)
 	return tmpValue
 }
 
+func (arena *Arena) NewQTextBoundaryFinder2(other QTextBoundaryFinder_ITF) *QTextBoundaryFinder {
+	return NewQTextBoundaryFinderFromPointer(C.QTextBoundaryFinder_NewQTextBoundaryFinder2InArena(arena.Pointer(), PointerFromQTextBoundaryFinder(other)))
+}
+
 func (ptr *QTextBoundaryFinder) ToNextBoundary() int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QTextBoundaryFinder_ToNextBoundary(ptr.Pointer())))
@@ -36751,30 +37800,32 @@ const (
 )
 
 func QTextCodec_AvailableCodecs() []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTextCodecFromPointer(l.data).__availableCodecs_atList(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTextCodec_QTextCodec_AvailableCodecs())
+	}(cGoUnpackStringListAndFree(C.QTextCodec_QTextCodec_AvailableCodecs()))
 }
 
 func (ptr *QTextCodec) AvailableCodecs() []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTextCodecFromPointer(l.data).__availableCodecs_atList(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTextCodec_QTextCodec_AvailableCodecs())
+	}(cGoUnpackStringListAndFree(C.QTextCodec_QTextCodec_AvailableCodecs()))
 }
 
 func QTextCodec_AvailableMibs() []int {
 	return func(l C.struct_QtCore_PackedList) []int {
 		var out = make([]int, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTextCodecFromPointer(l.data).__availableMibs_atList(i)
+		var tmpList = make([]C.int, int(l.len)+1)
+		NewQTextCodecFromPointer(l.data).__availableMibs_fillList(unsafe.Pointer(&tmpList[0]))
+		for i, v := range tmpList[:len(out)] {
+			out[i] = int(int32(v))
 		}
 		return out
 	}(C.QTextCodec_QTextCodec_AvailableMibs())
@@ -36783,8 +37834,10 @@ func QTextCodec_AvailableMibs() []int {
 func (ptr *QTextCodec) AvailableMibs() []int {
 	return func(l C.struct_QtCore_PackedList) []int {
 		var out = make([]int, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTextCodecFromPointer(l.data).__availableMibs_atList(i)
+		var tmpList = make([]C.int, int(l.len)+1)
+		NewQTextCodecFromPointer(l.data).__availableMibs_fillList(unsafe.Pointer(&tmpList[0]))
+		for i, v := range tmpList[:len(out)] {
+			out[i] = int(int32(v))
 		}
 		return out
 	}(C.QTextCodec_QTextCodec_AvailableMibs())
@@ -36868,7 +37921,7 @@ func (ptr *QTextCodec) SetCodecForLocale(c QTextCodec_ITF) {
 
 //export callbackQTextCodec_DestroyQTextCodec
 func callbackQTextCodec_DestroyQTextCodec(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTextCodec"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTextCodec"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextCodecFromPointer(ptr).DestroyQTextCodecDefault()
@@ -36878,21 +37931,21 @@ func callbackQTextCodec_DestroyQTextCodec(ptr unsafe.Pointer) {
 func (ptr *QTextCodec) ConnectDestroyQTextCodec(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextCodec", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTextCodec", f)
 	}
 }
 
 func (ptr *QTextCodec) DisconnectDestroyQTextCodec() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextCodec")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTextCodec")
 	}
 }
 
 func (ptr *QTextCodec) DestroyQTextCodec() {
 	if ptr.Pointer() != nil {
 		C.QTextCodec_DestroyQTextCodec(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -36900,7 +37953,7 @@ func (ptr *QTextCodec) DestroyQTextCodec() {
 func (ptr *QTextCodec) DestroyQTextCodecDefault() {
 	if ptr.Pointer() != nil {
 		C.QTextCodec_DestroyQTextCodecDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -36918,7 +37971,7 @@ func (ptr *QTextCodec) FromUnicode(str string) *QByteArray {
 
 //export callbackQTextCodec_Name
 func callbackQTextCodec_Name(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "name"); signal != nil {
+	if signal := qt.GetSignal(ptr, "name"); signal != nil {
 		return PointerFromQByteArray(signal.(func() *QByteArray)())
 	}
 
@@ -36928,14 +37981,14 @@ func callbackQTextCodec_Name(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QTextCodec) ConnectName(f func() *QByteArray) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "name", f)
+		qt.ConnectSignal(ptr.Pointer(), "name", f)
 	}
 }
 
 func (ptr *QTextCodec) DisconnectName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "name")
+		qt.DisconnectSignal(ptr.Pointer(), "name")
 	}
 }
 
@@ -36950,7 +38003,7 @@ func (ptr *QTextCodec) Name() *QByteArray {
 
 //export callbackQTextCodec_Aliases
 func callbackQTextCodec_Aliases(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aliases"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aliases"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQTextCodecFromPointer(NewQTextCodecFromPointer(nil).__aliases_newList())
 			for _, v := range signal.(func() []*QByteArray)() {
@@ -36972,39 +38025,39 @@ func callbackQTextCodec_Aliases(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QTextCodec) ConnectAliases(f func() []*QByteArray) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "aliases", f)
+		qt.ConnectSignal(ptr.Pointer(), "aliases", f)
 	}
 }
 
 func (ptr *QTextCodec) DisconnectAliases() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "aliases")
+		qt.DisconnectSignal(ptr.Pointer(), "aliases")
 	}
 }
 
 func (ptr *QTextCodec) Aliases() []*QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtCore_PackedList) []*QByteArray {
-			var out = make([]*QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQTextCodecFromPointer(l.data).__aliases_atList(i)
+		return func(l []string) []*QByteArray {
+			var out = make([]*QByteArray, len(l))
+			for i, v := range l {
+				out[i] = NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QTextCodec_Aliases(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QTextCodec_Aliases(ptr.Pointer())))
 	}
 	return make([]*QByteArray, 0)
 }
 
 func (ptr *QTextCodec) AliasesDefault() []*QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtCore_PackedList) []*QByteArray {
-			var out = make([]*QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQTextCodecFromPointer(l.data).__aliases_atList(i)
+		return func(l []string) []*QByteArray {
+			var out = make([]*QByteArray, len(l))
+			for i, v := range l {
+				out[i] = NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QTextCodec_AliasesDefault(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QTextCodec_AliasesDefault(ptr.Pointer())))
 	}
 	return make([]*QByteArray, 0)
 }
@@ -37057,7 +38110,7 @@ func (ptr *QTextCodec) CanEncode2(s string) bool {
 
 //export callbackQTextCodec_MibEnum
 func callbackQTextCodec_MibEnum(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mibEnum"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mibEnum"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -37067,14 +38120,14 @@ func callbackQTextCodec_MibEnum(ptr unsafe.Pointer) C.int {
 func (ptr *QTextCodec) ConnectMibEnum(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mibEnum", f)
+		qt.ConnectSignal(ptr.Pointer(), "mibEnum", f)
 	}
 }
 
 func (ptr *QTextCodec) DisconnectMibEnum() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mibEnum")
+		qt.DisconnectSignal(ptr.Pointer(), "mibEnum")
 	}
 }
 
@@ -37121,6 +38174,16 @@ func (ptr *QTextCodec) __availableMibs_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QTextCodec___availableMibs_newList(ptr.Pointer()))
 }
 
+func (ptr *QTextCodec) __availableMibs_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QTextCodec___availableMibs_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QTextCodec) __availableMibs_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QTextCodec___availableMibs_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QTextCodec) __aliases_atList(i int) *QByteArray {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQByteArrayFromPointer(C.QTextCodec___aliases_atList(ptr.Pointer(), C.int(int32(i))))
@@ -37199,12 +38262,20 @@ func NewQTextDecoder(codec QTextCodec_ITF) *QTextDecoder {
 	return tmpValue
 }
 
+func (arena *Arena) NewQTextDecoder(codec QTextCodec_ITF) *QTextDecoder {
+	return NewQTextDecoderFromPointer(C.QTextDecoder_NewQTextDecoderInArena(arena.Pointer(), PointerFromQTextCodec(codec)))
+}
+
 func NewQTextDecoder2(codec QTextCodec_ITF, flags QTextCodec__ConversionFlag) *QTextDecoder {
 	var tmpValue = NewQTextDecoderFromPointer(C.QTextDecoder_NewQTextDecoder2(PointerFromQTextCodec(codec), C.longlong(flags)))
 	runtime.SetFinalizer(tmpValue, (*QTextDecoder).DestroyQTextDecoder)
 	return tmpValue
 }
 
+func (arena *Arena) NewQTextDecoder2(codec QTextCodec_ITF, flags QTextCodec__ConversionFlag) *QTextDecoder {
+	return NewQTextDecoderFromPointer(C.QTextDecoder_NewQTextDecoder2InArena(arena.Pointer(), PointerFromQTextCodec(codec), C.longlong(flags)))
+}
+
 func (ptr *QTextDecoder) ToUnicode3(target string, chars string, len int) {
 	if ptr.Pointer() != nil {
 		var targetC = C.CString(target)
@@ -37285,12 +38356,20 @@ func NewQTextEncoder(codec QTextCodec_ITF) *QTextEncoder {
 	return tmpValue
 }
 
+func (arena *Arena) NewQTextEncoder(codec QTextCodec_ITF) *QTextEncoder {
+	return NewQTextEncoderFromPointer(C.QTextEncoder_NewQTextEncoderInArena(arena.Pointer(), PointerFromQTextCodec(codec)))
+}
+
 func NewQTextEncoder2(codec QTextCodec_ITF, flags QTextCodec__ConversionFlag) *QTextEncoder {
 	var tmpValue = NewQTextEncoderFromPointer(C.QTextEncoder_NewQTextEncoder2(PointerFromQTextCodec(codec), C.longlong(flags)))
 	runtime.SetFinalizer(tmpValue, (*QTextEncoder).DestroyQTextEncoder)
 	return tmpValue
 }
 
+func (arena *Arena) NewQTextEncoder2(codec QTextCodec_ITF, flags QTextCodec__ConversionFlag) *QTextEncoder {
+	return NewQTextEncoderFromPointer(C.QTextEncoder_NewQTextEncoder2InArena(arena.Pointer(), PointerFromQTextCodec(codec), C.longlong(flags)))
+}
+
 func (ptr *QTextEncoder) DestroyQTextEncoder() {
 	if ptr.Pointer() != nil {
 		C.QTextEncoder_DestroyQTextEncoder(ptr.Pointer())
@@ -37559,7 +38638,7 @@ func (ptr *QTextStream) SkipWhiteSpace() {
 
 //export callbackQTextStream_DestroyQTextStream
 func callbackQTextStream_DestroyQTextStream(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTextStream"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTextStream"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextStreamFromPointer(ptr).DestroyQTextStreamDefault()
@@ -37569,21 +38648,21 @@ func callbackQTextStream_DestroyQTextStream(ptr unsafe.Pointer) {
 func (ptr *QTextStream) ConnectDestroyQTextStream(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextStream", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTextStream", f)
 	}
 }
 
 func (ptr *QTextStream) DisconnectDestroyQTextStream() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextStream")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTextStream")
 	}
 }
 
 func (ptr *QTextStream) DestroyQTextStream() {
 	if ptr.Pointer() != nil {
 		C.QTextStream_DestroyQTextStream(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -37591,7 +38670,7 @@ func (ptr *QTextStream) DestroyQTextStream() {
 func (ptr *QTextStream) DestroyQTextStreamDefault() {
 	if ptr.Pointer() != nil {
 		C.QTextStream_DestroyQTextStreamDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -37622,7 +38701,7 @@ func (ptr *QTextStream) PadChar() *QChar {
 func (ptr *QTextStream) Device() *QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQIODeviceFromPointer(C.QTextStream_Device(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -37801,7 +38880,7 @@ func (ptr *QThread) SetPriority(priority QThread__Priority) {
 
 func QThread_CurrentThread() *QThread {
 	var tmpValue = NewQThreadFromPointer(C.QThread_QThread_CurrentThread())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -37809,7 +38888,7 @@ func QThread_CurrentThread() *QThread {
 
 func (ptr *QThread) CurrentThread() *QThread {
 	var tmpValue = NewQThreadFromPointer(C.QThread_QThread_CurrentThread())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -37817,7 +38896,7 @@ func (ptr *QThread) CurrentThread() *QThread {
 
 func NewQThread(parent QObject_ITF) *QThread {
 	var tmpValue = NewQThreadFromPointer(C.QThread_NewQThread(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -37838,7 +38917,7 @@ func (ptr *QThread) Exit(returnCode int) {
 
 //export callbackQThread_Finished
 func callbackQThread_Finished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -37847,20 +38926,20 @@ func callbackQThread_Finished(ptr unsafe.Pointer) {
 func (ptr *QThread) ConnectFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QThread_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QThread) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QThread_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
 //export callbackQThread_Quit
 func callbackQThread_Quit(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "quit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "quit"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQThreadFromPointer(ptr).QuitDefault()
@@ -37870,14 +38949,14 @@ func callbackQThread_Quit(ptr unsafe.Pointer) {
 func (ptr *QThread) ConnectQuit(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "quit", f)
+		qt.ConnectSignal(ptr.Pointer(), "quit", f)
 	}
 }
 
 func (ptr *QThread) DisconnectQuit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "quit")
+		qt.DisconnectSignal(ptr.Pointer(), "quit")
 	}
 }
 
@@ -37901,7 +38980,7 @@ func (ptr *QThread) RequestInterruption() {
 
 //export callbackQThread_Run
 func callbackQThread_Run(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "run"); signal != nil {
+	if signal := qt.GetSignal(ptr, "run"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQThreadFromPointer(ptr).RunDefault()
@@ -37911,14 +38990,14 @@ func callbackQThread_Run(ptr unsafe.Pointer) {
 func (ptr *QThread) ConnectRun(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "run", f)
+		qt.ConnectSignal(ptr.Pointer(), "run", f)
 	}
 }
 
 func (ptr *QThread) DisconnectRun() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "run")
+		qt.DisconnectSignal(ptr.Pointer(), "run")
 	}
 }
 
@@ -37964,7 +39043,7 @@ func (ptr *QThread) Sleep(secs uint) {
 
 //export callbackQThread_Start
 func callbackQThread_Start(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQThreadFromPointer(ptr).StartDefault()
@@ -37974,14 +39053,14 @@ func callbackQThread_Start(ptr unsafe.Pointer) {
 func (ptr *QThread) ConnectStart(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QThread) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -37999,7 +39078,7 @@ func (ptr *QThread) StartDefault() {
 
 //export callbackQThread_Started
 func callbackQThread_Started(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "started"); signal != nil {
+	if signal := qt.GetSignal(ptr, "started"); signal != nil {
 		signal.(func())()
 	}
 
@@ -38008,20 +39087,20 @@ func callbackQThread_Started(ptr unsafe.Pointer) {
 func (ptr *QThread) ConnectStarted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QThread_ConnectStarted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "started", f)
+		qt.ConnectSignal(ptr.Pointer(), "started", f)
 	}
 }
 
 func (ptr *QThread) DisconnectStarted() {
 	if ptr.Pointer() != nil {
 		C.QThread_DisconnectStarted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "started")
+		qt.DisconnectSignal(ptr.Pointer(), "started")
 	}
 }
 
 //export callbackQThread_Terminate
 func callbackQThread_Terminate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "terminate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "terminate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQThreadFromPointer(ptr).TerminateDefault()
@@ -38031,14 +39110,14 @@ func callbackQThread_Terminate(ptr unsafe.Pointer) {
 func (ptr *QThread) ConnectTerminate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "terminate", f)
+		qt.ConnectSignal(ptr.Pointer(), "terminate", f)
 	}
 }
 
 func (ptr *QThread) DisconnectTerminate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "terminate")
+		qt.DisconnectSignal(ptr.Pointer(), "terminate")
 	}
 }
 
@@ -38073,7 +39152,7 @@ func (ptr *QThread) YieldCurrentThread() {
 func (ptr *QThread) DestroyQThread() {
 	if ptr.Pointer() != nil {
 		C.QThread_DestroyQThread(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -38088,7 +39167,7 @@ func (ptr *QThread) Priority() QThread__Priority {
 func (ptr *QThread) EventDispatcher() *QAbstractEventDispatcher {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractEventDispatcherFromPointer(C.QThread_EventDispatcher(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -38171,7 +39250,7 @@ func NewQThreadPoolFromPointer(ptr unsafe.Pointer) *QThreadPool {
 }
 func QThreadPool_GlobalInstance() *QThreadPool {
 	var tmpValue = NewQThreadPoolFromPointer(C.QThreadPool_QThreadPool_GlobalInstance())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -38179,7 +39258,7 @@ func QThreadPool_GlobalInstance() *QThreadPool {
 
 func (ptr *QThreadPool) GlobalInstance() *QThreadPool {
 	var tmpValue = NewQThreadPoolFromPointer(C.QThreadPool_QThreadPool_GlobalInstance())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -38187,7 +39266,7 @@ func (ptr *QThreadPool) GlobalInstance() *QThreadPool {
 
 func NewQThreadPool(parent QObject_ITF) *QThreadPool {
 	var tmpValue = NewQThreadPoolFromPointer(C.QThreadPool_NewQThreadPool(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -38252,7 +39331,7 @@ func (ptr *QThreadPool) Start(runnable QRunnable_ITF, priority int) {
 func (ptr *QThreadPool) DestroyQThreadPool() {
 	if ptr.Pointer() != nil {
 		C.QThreadPool_DestroyQThreadPool(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -38427,12 +39506,20 @@ func NewQTime() *QTime {
 	return tmpValue
 }
 
+func (arena *Arena) NewQTime() *QTime {
+	return NewQTimeFromPointer(C.QTime_NewQTimeInArena(arena.Pointer()))
+}
+
 func NewQTime3(h int, m int, s int, ms int) *QTime {
 	var tmpValue = NewQTimeFromPointer(C.QTime_NewQTime3(C.int(int32(h)), C.int(int32(m)), C.int(int32(s)), C.int(int32(ms))))
 	runtime.SetFinalizer(tmpValue, (*QTime).DestroyQTime)
 	return tmpValue
 }
 
+func (arena *Arena) NewQTime3(h int, m int, s int, ms int) *QTime {
+	return NewQTimeFromPointer(C.QTime_NewQTime3InArena(arena.Pointer(), C.int(int32(h)), C.int(int32(m)), C.int(int32(s)), C.int(int32(ms))))
+}
+
 func QTime_IsValid2(h int, m int, s int, ms int) bool {
 	return C.QTime_QTime_IsValid2(C.int(int32(h)), C.int(int32(m)), C.int(int32(s)), C.int(int32(ms))) != 0
 }
@@ -38638,7 +39725,7 @@ const (
 
 //export callbackQTimeLine_SetCurrentTime
 func callbackQTimeLine_SetCurrentTime(ptr unsafe.Pointer, msec C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCurrentTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCurrentTime"); signal != nil {
 		signal.(func(int))(int(int32(msec)))
 	} else {
 		NewQTimeLineFromPointer(ptr).SetCurrentTimeDefault(int(int32(msec)))
@@ -38648,14 +39735,14 @@ func callbackQTimeLine_SetCurrentTime(ptr unsafe.Pointer, msec C.int) {
 func (ptr *QTimeLine) ConnectSetCurrentTime(f func(msec int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentTime", f)
+		qt.ConnectSignal(ptr.Pointer(), "setCurrentTime", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectSetCurrentTime() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentTime")
+		qt.DisconnectSignal(ptr.Pointer(), "setCurrentTime")
 	}
 }
 
@@ -38673,7 +39760,7 @@ func (ptr *QTimeLine) SetCurrentTimeDefault(msec int) {
 
 func NewQTimeLine(duration int, parent QObject_ITF) *QTimeLine {
 	var tmpValue = NewQTimeLineFromPointer(C.QTimeLine_NewQTimeLine(C.int(int32(duration)), PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -38681,7 +39768,7 @@ func NewQTimeLine(duration int, parent QObject_ITF) *QTimeLine {
 
 //export callbackQTimeLine_Finished
 func callbackQTimeLine_Finished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -38690,20 +39777,20 @@ func callbackQTimeLine_Finished(ptr unsafe.Pointer) {
 func (ptr *QTimeLine) ConnectFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
 //export callbackQTimeLine_FrameChanged
 func callbackQTimeLine_FrameChanged(ptr unsafe.Pointer, frame C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "frameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "frameChanged"); signal != nil {
 		signal.(func(int))(int(int32(frame)))
 	}
 
@@ -38712,20 +39799,20 @@ func callbackQTimeLine_FrameChanged(ptr unsafe.Pointer, frame C.int) {
 func (ptr *QTimeLine) ConnectFrameChanged(f func(frame int)) {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_ConnectFrameChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "frameChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "frameChanged", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectFrameChanged() {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_DisconnectFrameChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "frameChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "frameChanged")
 	}
 }
 
 //export callbackQTimeLine_Resume
 func callbackQTimeLine_Resume(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resume"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resume"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTimeLineFromPointer(ptr).ResumeDefault()
@@ -38735,14 +39822,14 @@ func callbackQTimeLine_Resume(ptr unsafe.Pointer) {
 func (ptr *QTimeLine) ConnectResume(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resume", f)
+		qt.ConnectSignal(ptr.Pointer(), "resume", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectResume() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resume")
+		qt.DisconnectSignal(ptr.Pointer(), "resume")
 	}
 }
 
@@ -38802,7 +39889,7 @@ func (ptr *QTimeLine) SetLoopCount(count int) {
 
 //export callbackQTimeLine_SetPaused
 func callbackQTimeLine_SetPaused(ptr unsafe.Pointer, paused C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPaused"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPaused"); signal != nil {
 		signal.(func(bool))(int8(paused) != 0)
 	} else {
 		NewQTimeLineFromPointer(ptr).SetPausedDefault(int8(paused) != 0)
@@ -38812,14 +39899,14 @@ func callbackQTimeLine_SetPaused(ptr unsafe.Pointer, paused C.char) {
 func (ptr *QTimeLine) ConnectSetPaused(f func(paused bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPaused", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPaused", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectSetPaused() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPaused")
+		qt.DisconnectSignal(ptr.Pointer(), "setPaused")
 	}
 }
 
@@ -38849,7 +39936,7 @@ func (ptr *QTimeLine) SetUpdateInterval(interval int) {
 
 //export callbackQTimeLine_Start
 func callbackQTimeLine_Start(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTimeLineFromPointer(ptr).StartDefault()
@@ -38859,14 +39946,14 @@ func callbackQTimeLine_Start(ptr unsafe.Pointer) {
 func (ptr *QTimeLine) ConnectStart(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -38884,7 +39971,7 @@ func (ptr *QTimeLine) StartDefault() {
 
 //export callbackQTimeLine_StateChanged
 func callbackQTimeLine_StateChanged(ptr unsafe.Pointer, newState C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stateChanged"); signal != nil {
 		signal.(func(QTimeLine__State))(QTimeLine__State(newState))
 	}
 
@@ -38893,20 +39980,20 @@ func callbackQTimeLine_StateChanged(ptr unsafe.Pointer, newState C.longlong) {
 func (ptr *QTimeLine) ConnectStateChanged(f func(newState QTimeLine__State)) {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_ConnectStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "stateChanged", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_DisconnectStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "stateChanged")
 	}
 }
 
 //export callbackQTimeLine_Stop
 func callbackQTimeLine_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTimeLineFromPointer(ptr).StopDefault()
@@ -38916,14 +40003,14 @@ func callbackQTimeLine_Stop(ptr unsafe.Pointer) {
 func (ptr *QTimeLine) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -38941,7 +40028,7 @@ func (ptr *QTimeLine) StopDefault() {
 
 //export callbackQTimeLine_ToggleDirection
 func callbackQTimeLine_ToggleDirection(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "toggleDirection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "toggleDirection"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTimeLineFromPointer(ptr).ToggleDirectionDefault()
@@ -38951,14 +40038,14 @@ func callbackQTimeLine_ToggleDirection(ptr unsafe.Pointer) {
 func (ptr *QTimeLine) ConnectToggleDirection(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "toggleDirection", f)
+		qt.ConnectSignal(ptr.Pointer(), "toggleDirection", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectToggleDirection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "toggleDirection")
+		qt.DisconnectSignal(ptr.Pointer(), "toggleDirection")
 	}
 }
 
@@ -38976,7 +40063,7 @@ func (ptr *QTimeLine) ToggleDirectionDefault() {
 
 //export callbackQTimeLine_ValueChanged
 func callbackQTimeLine_ValueChanged(ptr unsafe.Pointer, value C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueChanged"); signal != nil {
 		signal.(func(float64))(float64(value))
 	}
 
@@ -38985,20 +40072,20 @@ func callbackQTimeLine_ValueChanged(ptr unsafe.Pointer, value C.double) {
 func (ptr *QTimeLine) ConnectValueChanged(f func(value float64)) {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_ConnectValueChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueChanged", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectValueChanged() {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_DisconnectValueChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valueChanged")
 	}
 }
 
 //export callbackQTimeLine_DestroyQTimeLine
 func callbackQTimeLine_DestroyQTimeLine(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTimeLine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTimeLine"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTimeLineFromPointer(ptr).DestroyQTimeLineDefault()
@@ -39008,21 +40095,21 @@ func callbackQTimeLine_DestroyQTimeLine(ptr unsafe.Pointer) {
 func (ptr *QTimeLine) ConnectDestroyQTimeLine(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTimeLine", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTimeLine", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectDestroyQTimeLine() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTimeLine")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTimeLine")
 	}
 }
 
 func (ptr *QTimeLine) DestroyQTimeLine() {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_DestroyQTimeLine(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -39030,7 +40117,7 @@ func (ptr *QTimeLine) DestroyQTimeLine() {
 func (ptr *QTimeLine) DestroyQTimeLineDefault() {
 	if ptr.Pointer() != nil {
 		C.QTimeLine_DestroyQTimeLineDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -39130,7 +40217,7 @@ func (ptr *QTimeLine) CurrentValue() float64 {
 
 //export callbackQTimeLine_ValueForTime
 func callbackQTimeLine_ValueForTime(ptr unsafe.Pointer, msec C.int) C.double {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueForTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueForTime"); signal != nil {
 		return C.double(signal.(func(int) float64)(int(int32(msec))))
 	}
 
@@ -39140,14 +40227,14 @@ func callbackQTimeLine_ValueForTime(ptr unsafe.Pointer, msec C.int) C.double {
 func (ptr *QTimeLine) ConnectValueForTime(f func(msec int) float64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueForTime", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueForTime", f)
 	}
 }
 
 func (ptr *QTimeLine) DisconnectValueForTime() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueForTime")
+		qt.DisconnectSignal(ptr.Pointer(), "valueForTime")
 	}
 }
 
@@ -39273,103 +40360,103 @@ func (ptr *QTimeZone) WindowsIdToDefaultIanaId2(windowsId QByteArray_ITF, countr
 }
 
 func QTimeZone_AvailableTimeZoneIds() []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__availableTimeZoneIds_atList(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_AvailableTimeZoneIds())
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_AvailableTimeZoneIds()))
 }
 
 func (ptr *QTimeZone) AvailableTimeZoneIds() []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__availableTimeZoneIds_atList(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_AvailableTimeZoneIds())
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_AvailableTimeZoneIds()))
 }
 
 func QTimeZone_AvailableTimeZoneIds2(country QLocale__Country) []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__availableTimeZoneIds_atList2(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_AvailableTimeZoneIds2(C.longlong(country)))
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_AvailableTimeZoneIds2(C.longlong(country))))
 }
 
 func (ptr *QTimeZone) AvailableTimeZoneIds2(country QLocale__Country) []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__availableTimeZoneIds_atList2(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_AvailableTimeZoneIds2(C.longlong(country)))
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_AvailableTimeZoneIds2(C.longlong(country))))
 }
 
 func QTimeZone_AvailableTimeZoneIds3(offsetSeconds int) []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__availableTimeZoneIds_atList3(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_AvailableTimeZoneIds3(C.int(int32(offsetSeconds))))
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_AvailableTimeZoneIds3(C.int(int32(offsetSeconds)))))
 }
 
 func (ptr *QTimeZone) AvailableTimeZoneIds3(offsetSeconds int) []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__availableTimeZoneIds_atList3(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_AvailableTimeZoneIds3(C.int(int32(offsetSeconds))))
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_AvailableTimeZoneIds3(C.int(int32(offsetSeconds)))))
 }
 
 func QTimeZone_WindowsIdToIanaIds(windowsId QByteArray_ITF) []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__windowsIdToIanaIds_atList(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_WindowsIdToIanaIds(PointerFromQByteArray(windowsId)))
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_WindowsIdToIanaIds(PointerFromQByteArray(windowsId))))
 }
 
 func (ptr *QTimeZone) WindowsIdToIanaIds(windowsId QByteArray_ITF) []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__windowsIdToIanaIds_atList(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_WindowsIdToIanaIds(PointerFromQByteArray(windowsId)))
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_WindowsIdToIanaIds(PointerFromQByteArray(windowsId))))
 }
 
 func QTimeZone_WindowsIdToIanaIds2(windowsId QByteArray_ITF, country QLocale__Country) []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__windowsIdToIanaIds_atList2(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_WindowsIdToIanaIds2(PointerFromQByteArray(windowsId), C.longlong(country)))
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_WindowsIdToIanaIds2(PointerFromQByteArray(windowsId), C.longlong(country))))
 }
 
 func (ptr *QTimeZone) WindowsIdToIanaIds2(windowsId QByteArray_ITF, country QLocale__Country) []*QByteArray {
-	return func(l C.struct_QtCore_PackedList) []*QByteArray {
-		var out = make([]*QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTimeZoneFromPointer(l.data).__windowsIdToIanaIds_atList2(i)
+	return func(l []string) []*QByteArray {
+		var out = make([]*QByteArray, len(l))
+		for i, v := range l {
+			out[i] = NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTimeZone_QTimeZone_WindowsIdToIanaIds2(PointerFromQByteArray(windowsId), C.longlong(country)))
+	}(cGoUnpackStringListAndFree(C.QTimeZone_QTimeZone_WindowsIdToIanaIds2(PointerFromQByteArray(windowsId), C.longlong(country))))
 }
 
 func QTimeZone_SystemTimeZone() *QTimeZone {
@@ -39402,12 +40489,20 @@ func NewQTimeZone() *QTimeZone {
 	return tmpValue
 }
 
+func (arena *Arena) NewQTimeZone() *QTimeZone {
+	return NewQTimeZoneFromPointer(C.QTimeZone_NewQTimeZoneInArena(arena.Pointer()))
+}
+
 func NewQTimeZone2(ianaId QByteArray_ITF) *QTimeZone {
 	var tmpValue = NewQTimeZoneFromPointer(C.QTimeZone_NewQTimeZone2(PointerFromQByteArray(ianaId)))
 	runtime.SetFinalizer(tmpValue, (*QTimeZone).DestroyQTimeZone)
 	return tmpValue
 }
 
+func (arena *Arena) NewQTimeZone2(ianaId QByteArray_ITF) *QTimeZone {
+	return NewQTimeZoneFromPointer(C.QTimeZone_NewQTimeZone2InArena(arena.Pointer(), PointerFromQByteArray(ianaId)))
+}
+
 func NewQTimeZone4(ianaId QByteArray_ITF, offsetSeconds int, name string, abbreviation string, country QLocale__Country, comment string) *QTimeZone {
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
@@ -39420,18 +40515,36 @@ func NewQTimeZone4(ianaId QByteArray_ITF, offsetSeconds int, name string, abbrev
 	return tmpValue
 }
 
+func (arena *Arena) NewQTimeZone4(ianaId QByteArray_ITF, offsetSeconds int, name string, abbreviation string, country QLocale__Country, comment string) *QTimeZone {
+	var nameC = C.CString(name)
+	defer C.free(unsafe.Pointer(nameC))
+	var abbreviationC = C.CString(abbreviation)
+	defer C.free(unsafe.Pointer(abbreviationC))
+	var commentC = C.CString(comment)
+	defer C.free(unsafe.Pointer(commentC))
+	return NewQTimeZoneFromPointer(C.QTimeZone_NewQTimeZone4InArena(arena.Pointer(), PointerFromQByteArray(ianaId), C.int(int32(offsetSeconds)), nameC, abbreviationC, C.longlong(country), commentC))
+}
+
 func NewQTimeZone5(other QTimeZone_ITF) *QTimeZone {
 	var tmpValue = NewQTimeZoneFromPointer(C.QTimeZone_NewQTimeZone5(PointerFromQTimeZone(other)))
 	runtime.SetFinalizer(tmpValue, (*QTimeZone).DestroyQTimeZone)
 	return tmpValue
 }
 
+func (arena *Arena) NewQTimeZone5(other QTimeZone_ITF) *QTimeZone {
+	return NewQTimeZoneFromPointer(C.QTimeZone_NewQTimeZone5InArena(arena.Pointer(), PointerFromQTimeZone(other)))
+}
+
 func NewQTimeZone3(offsetSeconds int) *QTimeZone {
 	var tmpValue = NewQTimeZoneFromPointer(C.QTimeZone_NewQTimeZone3(C.int(int32(offsetSeconds))))
 	runtime.SetFinalizer(tmpValue, (*QTimeZone).DestroyQTimeZone)
 	return tmpValue
 }
 
+func (arena *Arena) NewQTimeZone3(offsetSeconds int) *QTimeZone {
+	return NewQTimeZoneFromPointer(C.QTimeZone_NewQTimeZone3InArena(arena.Pointer(), C.int(int32(offsetSeconds))))
+}
+
 func QTimeZone_IsTimeZoneIdAvailable(ianaId QByteArray_ITF) bool {
 	return C.QTimeZone_QTimeZone_IsTimeZoneIdAvailable(PointerFromQByteArray(ianaId)) != 0
 }
@@ -39681,7 +40794,7 @@ func NewQTimerFromPointer(ptr unsafe.Pointer) *QTimer {
 }
 func NewQTimer(parent QObject_ITF) *QTimer {
 	var tmpValue = NewQTimerFromPointer(C.QTimer_NewQTimer(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -39731,7 +40844,7 @@ func (ptr *QTimer) SingleShot(msec int, receiver QObject_ITF, member string) {
 
 //export callbackQTimer_Start2
 func callbackQTimer_Start2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTimerFromPointer(ptr).Start2Default()
@@ -39741,14 +40854,14 @@ func callbackQTimer_Start2(ptr unsafe.Pointer) {
 func (ptr *QTimer) ConnectStart2(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start2", f)
+		qt.ConnectSignal(ptr.Pointer(), "start2", f)
 	}
 }
 
 func (ptr *QTimer) DisconnectStart2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start2")
+		qt.DisconnectSignal(ptr.Pointer(), "start2")
 	}
 }
 
@@ -39766,7 +40879,7 @@ func (ptr *QTimer) Start2Default() {
 
 //export callbackQTimer_Start
 func callbackQTimer_Start(ptr unsafe.Pointer, msec C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		signal.(func(int))(int(int32(msec)))
 	} else {
 		NewQTimerFromPointer(ptr).StartDefault(int(int32(msec)))
@@ -39776,14 +40889,14 @@ func callbackQTimer_Start(ptr unsafe.Pointer, msec C.int) {
 func (ptr *QTimer) ConnectStart(f func(msec int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QTimer) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -39801,7 +40914,7 @@ func (ptr *QTimer) StartDefault(msec int) {
 
 //export callbackQTimer_Stop
 func callbackQTimer_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTimerFromPointer(ptr).StopDefault()
@@ -39811,14 +40924,14 @@ func callbackQTimer_Stop(ptr unsafe.Pointer) {
 func (ptr *QTimer) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QTimer) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -39836,7 +40949,7 @@ func (ptr *QTimer) StopDefault() {
 
 //export callbackQTimer_Timeout
 func callbackQTimer_Timeout(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timeout"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timeout"); signal != nil {
 		signal.(func())()
 	}
 
@@ -39845,21 +40958,21 @@ func callbackQTimer_Timeout(ptr unsafe.Pointer) {
 func (ptr *QTimer) ConnectTimeout(f func()) {
 	if ptr.Pointer() != nil {
 		C.QTimer_ConnectTimeout(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "timeout", f)
+		qt.ConnectSignal(ptr.Pointer(), "timeout", f)
 	}
 }
 
 func (ptr *QTimer) DisconnectTimeout() {
 	if ptr.Pointer() != nil {
 		C.QTimer_DisconnectTimeout(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "timeout")
+		qt.DisconnectSignal(ptr.Pointer(), "timeout")
 	}
 }
 
 func (ptr *QTimer) DestroyQTimer() {
 	if ptr.Pointer() != nil {
 		C.QTimer_DestroyQTimer(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -39948,7 +41061,7 @@ func NewQTimerEventFromPointer(ptr unsafe.Pointer) *QTimerEvent {
 func (ptr *QTimerEvent) DestroyQTimerEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -40017,7 +41130,7 @@ func NewQTranslatorFromPointer(ptr unsafe.Pointer) *QTranslator {
 }
 func NewQTranslator(parent QObject_ITF) *QTranslator {
 	var tmpValue = NewQTranslatorFromPointer(C.QTranslator_NewQTranslator(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -40067,14 +41180,14 @@ func (ptr *QTranslator) Load3(data string, len int, directory string) bool {
 func (ptr *QTranslator) DestroyQTranslator() {
 	if ptr.Pointer() != nil {
 		C.QTranslator_DestroyQTranslator(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQTranslator_Translate
 func callbackQTranslator_Translate(ptr unsafe.Pointer, context C.struct_QtCore_PackedString, sourceText C.struct_QtCore_PackedString, disambiguation C.struct_QtCore_PackedString, n C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "translate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "translate"); signal != nil {
 		return C.CString(signal.(func(string, string, string, int) string)(cGoUnpackString(context), cGoUnpackString(sourceText), cGoUnpackString(disambiguation), int(int32(n))))
 	}
 
@@ -40084,14 +41197,14 @@ func callbackQTranslator_Translate(ptr unsafe.Pointer, context C.struct_QtCore_P
 func (ptr *QTranslator) ConnectTranslate(f func(context string, sourceText string, disambiguation string, n int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "translate", f)
+		qt.ConnectSignal(ptr.Pointer(), "translate", f)
 	}
 }
 
 func (ptr *QTranslator) DisconnectTranslate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "translate")
+		qt.DisconnectSignal(ptr.Pointer(), "translate")
 	}
 }
 
@@ -40123,7 +41236,7 @@ func (ptr *QTranslator) TranslateDefault(context string, sourceText string, disa
 
 //export callbackQTranslator_IsEmpty
 func callbackQTranslator_IsEmpty(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isEmpty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isEmpty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -40133,14 +41246,14 @@ func callbackQTranslator_IsEmpty(ptr unsafe.Pointer) C.char {
 func (ptr *QTranslator) ConnectIsEmpty(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isEmpty", f)
+		qt.ConnectSignal(ptr.Pointer(), "isEmpty", f)
 	}
 }
 
 func (ptr *QTranslator) DisconnectIsEmpty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isEmpty")
+		qt.DisconnectSignal(ptr.Pointer(), "isEmpty")
 	}
 }
 
@@ -40200,7 +41313,7 @@ func NewQUnhandledExceptionFromPointer(ptr unsafe.Pointer) *QUnhandledException
 func (ptr *QUnhandledException) DestroyQUnhandledException() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -40509,7 +41622,7 @@ const (
 )
 
 func QUrl_FromStringList(urls []string, mode QUrl__ParsingMode) []*QUrl {
-	var urlsC = C.CString(strings.Join(urls, "|"))
+	var urlsC = cGoPackStringList(urls)
 	defer C.free(unsafe.Pointer(urlsC))
 	return func(l C.struct_QtCore_PackedList) []*QUrl {
 		var out = make([]*QUrl, int(l.len))
@@ -40521,7 +41634,7 @@ func QUrl_FromStringList(urls []string, mode QUrl__ParsingMode) []*QUrl {
 }
 
 func (ptr *QUrl) FromStringList(urls []string, mode QUrl__ParsingMode) []*QUrl {
-	var urlsC = C.CString(strings.Join(urls, "|"))
+	var urlsC = cGoPackStringList(urls)
 	defer C.free(unsafe.Pointer(urlsC))
 	return func(l C.struct_QtCore_PackedList) []*QUrl {
 		var out = make([]*QUrl, int(l.len))
@@ -40593,31 +41706,31 @@ func (ptr *QUrl) FromAce(domain QByteArray_ITF) string {
 }
 
 func QUrl_IdnWhitelist() []string {
-	return strings.Split(cGoUnpackString(C.QUrl_QUrl_IdnWhitelist()), "|")
+	return cGoUnpackStringListAndFree(C.QUrl_QUrl_IdnWhitelist())
 }
 
 func (ptr *QUrl) IdnWhitelist() []string {
-	return strings.Split(cGoUnpackString(C.QUrl_QUrl_IdnWhitelist()), "|")
+	return cGoUnpackStringListAndFree(C.QUrl_QUrl_IdnWhitelist())
 }
 
 func QUrl_ToStringList(urls []*QUrl, options QUrl__UrlFormattingOption) []string {
-	return strings.Split(cGoUnpackString(C.QUrl_QUrl_ToStringList(func() unsafe.Pointer {
+	return cGoUnpackStringListAndFree(C.QUrl_QUrl_ToStringList(func() unsafe.Pointer {
 		var tmpList = NewQUrlFromPointer(NewQUrlFromPointer(nil).__toStringList_urls_newList())
 		for _, v := range urls {
 			tmpList.__toStringList_urls_setList(v)
 		}
 		return tmpList.Pointer()
-	}(), C.longlong(options))), "|")
+	}(), C.longlong(options)))
 }
 
 func (ptr *QUrl) ToStringList(urls []*QUrl, options QUrl__UrlFormattingOption) []string {
-	return strings.Split(cGoUnpackString(C.QUrl_QUrl_ToStringList(func() unsafe.Pointer {
+	return cGoUnpackStringListAndFree(C.QUrl_QUrl_ToStringList(func() unsafe.Pointer {
 		var tmpList = NewQUrlFromPointer(NewQUrlFromPointer(nil).__toStringList_urls_newList())
 		for _, v := range urls {
 			tmpList.__toStringList_urls_setList(v)
 		}
 		return tmpList.Pointer()
-	}(), C.longlong(options))), "|")
+	}(), C.longlong(options)))
 }
 
 func QUrl_FromLocalFile(localFile string) *QUrl {
@@ -40678,12 +41791,20 @@ func NewQUrl() *QUrl {
 	return tmpValue
 }
 
+func (arena *Arena) NewQUrl() *QUrl {
+	return NewQUrlFromPointer(C.QUrl_NewQUrlInArena(arena.Pointer()))
+}
+
 func NewQUrl4(other QUrl_ITF) *QUrl {
 	var tmpValue = NewQUrlFromPointer(C.QUrl_NewQUrl4(PointerFromQUrl(other)))
 	runtime.SetFinalizer(tmpValue, (*QUrl).DestroyQUrl)
 	return tmpValue
 }
 
+func (arena *Arena) NewQUrl4(other QUrl_ITF) *QUrl {
+	return NewQUrlFromPointer(C.QUrl_NewQUrl4InArena(arena.Pointer(), PointerFromQUrl(other)))
+}
+
 func NewQUrl3(url string, parsingMode QUrl__ParsingMode) *QUrl {
 	var urlC = C.CString(url)
 	defer C.free(unsafe.Pointer(urlC))
@@ -40692,12 +41813,22 @@ func NewQUrl3(url string, parsingMode QUrl__ParsingMode) *QUrl {
 	return tmpValue
 }
 
+func (arena *Arena) NewQUrl3(url string, parsingMode QUrl__ParsingMode) *QUrl {
+	var urlC = C.CString(url)
+	defer C.free(unsafe.Pointer(urlC))
+	return NewQUrlFromPointer(C.QUrl_NewQUrl3InArena(arena.Pointer(), urlC, C.longlong(parsingMode)))
+}
+
 func NewQUrl2(other QUrl_ITF) *QUrl {
 	var tmpValue = NewQUrlFromPointer(C.QUrl_NewQUrl2(PointerFromQUrl(other)))
 	runtime.SetFinalizer(tmpValue, (*QUrl).DestroyQUrl)
 	return tmpValue
 }
 
+func (arena *Arena) NewQUrl2(other QUrl_ITF) *QUrl {
+	return NewQUrlFromPointer(C.QUrl_NewQUrl2InArena(arena.Pointer(), PointerFromQUrl(other)))
+}
+
 func (ptr *QUrl) Clear() {
 	if ptr.Pointer() != nil {
 		C.QUrl_Clear(ptr.Pointer())
@@ -40729,13 +41860,13 @@ func (ptr *QUrl) SetHost(host string, mode QUrl__ParsingMode) {
 }
 
 func QUrl_SetIdnWhitelist(list []string) {
-	var listC = C.CString(strings.Join(list, "|"))
+	var listC = cGoPackStringList(list)
 	defer C.free(unsafe.Pointer(listC))
 	C.QUrl_QUrl_SetIdnWhitelist(listC)
 }
 
 func (ptr *QUrl) SetIdnWhitelist(list []string) {
-	var listC = C.CString(strings.Join(list, "|"))
+	var listC = cGoPackStringList(list)
 	defer C.free(unsafe.Pointer(listC))
 	C.QUrl_QUrl_SetIdnWhitelist(listC)
 }
@@ -41147,6 +42278,10 @@ func NewQUrlQuery() *QUrlQuery {
 	return tmpValue
 }
 
+func (arena *Arena) NewQUrlQuery() *QUrlQuery {
+	return NewQUrlQueryFromPointer(C.QUrlQuery_NewQUrlQueryInArena(arena.Pointer()))
+}
+
 func NewQUrlQuery3(queryString string) *QUrlQuery {
 	var queryStringC = C.CString(queryString)
 	defer C.free(unsafe.Pointer(queryStringC))
@@ -41155,18 +42290,32 @@ func NewQUrlQuery3(queryString string) *QUrlQuery {
 	return tmpValue
 }
 
+func (arena *Arena) NewQUrlQuery3(queryString string) *QUrlQuery {
+	var queryStringC = C.CString(queryString)
+	defer C.free(unsafe.Pointer(queryStringC))
+	return NewQUrlQueryFromPointer(C.QUrlQuery_NewQUrlQuery3InArena(arena.Pointer(), queryStringC))
+}
+
 func NewQUrlQuery2(url QUrl_ITF) *QUrlQuery {
 	var tmpValue = NewQUrlQueryFromPointer(C.QUrlQuery_NewQUrlQuery2(PointerFromQUrl(url)))
 	runtime.SetFinalizer(tmpValue, (*QUrlQuery).DestroyQUrlQuery)
 	return tmpValue
 }
 
+func (arena *Arena) NewQUrlQuery2(url QUrl_ITF) *QUrlQuery {
+	return NewQUrlQueryFromPointer(C.QUrlQuery_NewQUrlQuery2InArena(arena.Pointer(), PointerFromQUrl(url)))
+}
+
 func NewQUrlQuery4(other QUrlQuery_ITF) *QUrlQuery {
 	var tmpValue = NewQUrlQueryFromPointer(C.QUrlQuery_NewQUrlQuery4(PointerFromQUrlQuery(other)))
 	runtime.SetFinalizer(tmpValue, (*QUrlQuery).DestroyQUrlQuery)
 	return tmpValue
 }
 
+func (arena *Arena) NewQUrlQuery4(other QUrlQuery_ITF) *QUrlQuery {
+	return NewQUrlQueryFromPointer(C.QUrlQuery_NewQUrlQuery4InArena(arena.Pointer(), PointerFromQUrlQuery(other)))
+}
+
 func (ptr *QUrlQuery) AddQueryItem(key string, value string) {
 	if ptr.Pointer() != nil {
 		var keyC = C.CString(key)
@@ -41271,7 +42420,7 @@ func (ptr *QUrlQuery) AllQueryItemValues(key string, encoding QUrl__ComponentFor
 	if ptr.Pointer() != nil {
 		var keyC = C.CString(key)
 		defer C.free(unsafe.Pointer(keyC))
-		return strings.Split(cGoUnpackString(C.QUrlQuery_AllQueryItemValues(ptr.Pointer(), keyC, C.longlong(encoding))), "|")
+		return cGoUnpackStringListAndFree(C.QUrlQuery_AllQueryItemValues(ptr.Pointer(), keyC, C.longlong(encoding)))
 	}
 	return make([]string, 0)
 }
@@ -41449,12 +42598,20 @@ func NewQUuid() *QUuid {
 	return tmpValue
 }
 
+func (arena *Arena) NewQUuid() *QUuid {
+	return NewQUuidFromPointer(C.QUuid_NewQUuidInArena(arena.Pointer()))
+}
+
 func NewQUuid5(text QByteArray_ITF) *QUuid {
 	var tmpValue = NewQUuidFromPointer(C.QUuid_NewQUuid5(PointerFromQByteArray(text)))
 	runtime.SetFinalizer(tmpValue, (*QUuid).DestroyQUuid)
 	return tmpValue
 }
 
+func (arena *Arena) NewQUuid5(text QByteArray_ITF) *QUuid {
+	return NewQUuidFromPointer(C.QUuid_NewQUuid5InArena(arena.Pointer(), PointerFromQByteArray(text)))
+}
+
 func NewQUuid3(text string) *QUuid {
 	var textC = C.CString(text)
 	defer C.free(unsafe.Pointer(textC))
@@ -41463,6 +42620,12 @@ func NewQUuid3(text string) *QUuid {
 	return tmpValue
 }
 
+func (arena *Arena) NewQUuid3(text string) *QUuid {
+	var textC = C.CString(text)
+	defer C.free(unsafe.Pointer(textC))
+	return NewQUuidFromPointer(C.QUuid_NewQUuid3InArena(arena.Pointer(), textC))
+}
+
 func NewQUuid2(l uint, w1 uint16, w2 uint16, b1 string, b2 string, b3 string, b4 string, b5 string, b6 string, b7 string, b8 string) *QUuid {
 	var b1C = C.CString(b1)
 	defer C.free(unsafe.Pointer(b1C))
@@ -41485,6 +42648,26 @@ func NewQUuid2(l uint, w1 uint16, w2 uint16, b1 string, b2 string, b3 string, b4
 	return tmpValue
 }
 
+func (arena *Arena) NewQUuid2(l uint, w1 uint16, w2 uint16, b1 string, b2 string, b3 string, b4 string, b5 string, b6 string, b7 string, b8 string) *QUuid {
+	var b1C = C.CString(b1)
+	defer C.free(unsafe.Pointer(b1C))
+	var b2C = C.CString(b2)
+	defer C.free(unsafe.Pointer(b2C))
+	var b3C = C.CString(b3)
+	defer C.free(unsafe.Pointer(b3C))
+	var b4C = C.CString(b4)
+	defer C.free(unsafe.Pointer(b4C))
+	var b5C = C.CString(b5)
+	defer C.free(unsafe.Pointer(b5C))
+	var b6C = C.CString(b6)
+	defer C.free(unsafe.Pointer(b6C))
+	var b7C = C.CString(b7)
+	defer C.free(unsafe.Pointer(b7C))
+	var b8C = C.CString(b8)
+	defer C.free(unsafe.Pointer(b8C))
+	return NewQUuidFromPointer(C.QUuid_NewQUuid2InArena(arena.Pointer(), C.uint(uint32(l)), C.ushort(w1), C.ushort(w2), b1C, b2C, b3C, b4C, b5C, b6C, b7C, b8C))
+}
+
 func (ptr *QUuid) ToByteArray() *QByteArray {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQByteArrayFromPointer(C.QUuid_ToByteArray(ptr.Pointer()))
@@ -41651,66 +42834,110 @@ func NewQVariant20(c QChar_ITF) *QVariant {
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant20(c QChar_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant20InArena(arena.Pointer(), PointerFromQChar(c)))
+}
+
 func NewQVariant() *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant())
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant() *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariantInArena(arena.Pointer()))
+}
+
 func NewQVariant6(s QDataStream_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant6(PointerFromQDataStream(s)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant6(s QDataStream_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant6InArena(arena.Pointer(), PointerFromQDataStream(s)))
+}
+
 func NewQVariant18(val QLatin1String_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant18(PointerFromQLatin1String(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant18(val QLatin1String_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant18InArena(arena.Pointer(), PointerFromQLatin1String(val)))
+}
+
 func NewQVariant47(other QVariant_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant47(PointerFromQVariant(other)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant47(other QVariant_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant47InArena(arena.Pointer(), PointerFromQVariant(other)))
+}
+
 func NewQVariant11(val bool) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant11(C.char(int8(qt.GoBoolToInt(val)))))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant11(val bool) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant11InArena(arena.Pointer(), C.char(int8(qt.GoBoolToInt(val)))))
+}
+
 func NewQVariant16(val QBitArray_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant16(PointerFromQBitArray(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant16(val QBitArray_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant16InArena(arena.Pointer(), PointerFromQBitArray(val)))
+}
+
 func NewQVariant15(val QByteArray_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant15(PointerFromQByteArray(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant15(val QByteArray_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant15InArena(arena.Pointer(), PointerFromQByteArray(val)))
+}
+
 func NewQVariant21(val QDate_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant21(PointerFromQDate(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant21(val QDate_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant21InArena(arena.Pointer(), PointerFromQDate(val)))
+}
+
 func NewQVariant23(val QDateTime_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant23(PointerFromQDateTime(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant23(val QDateTime_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant23InArena(arena.Pointer(), PointerFromQDateTime(val)))
+}
+
 func NewQVariant39(val QEasingCurve_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant39(PointerFromQEasingCurve(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant39(val QEasingCurve_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant39InArena(arena.Pointer(), PointerFromQEasingCurve(val)))
+}
+
 func NewQVariant26(val map[string]*QVariant) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant26(func() unsafe.Pointer {
 		var tmpList = NewQVariantFromPointer(NewQVariantFromPointer(nil).__QVariant_val_newList26())
@@ -41723,42 +42950,76 @@ func NewQVariant26(val map[string]*QVariant) *QVariant {
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant26(val map[string]*QVariant) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant26InArena(arena.Pointer(), func() unsafe.Pointer {
+		var tmpList = NewQVariantFromPointer(NewQVariantFromPointer(nil).__QVariant_val_newList26())
+		for k, v := range val {
+			tmpList.__QVariant_val_setList26(k, v)
+		}
+		return tmpList.Pointer()
+	}()))
+}
+
 func NewQVariant45(val QJsonArray_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant45(PointerFromQJsonArray(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant45(val QJsonArray_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant45InArena(arena.Pointer(), PointerFromQJsonArray(val)))
+}
+
 func NewQVariant46(val QJsonDocument_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant46(PointerFromQJsonDocument(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant46(val QJsonDocument_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant46InArena(arena.Pointer(), PointerFromQJsonDocument(val)))
+}
+
 func NewQVariant44(val QJsonObject_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant44(PointerFromQJsonObject(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant44(val QJsonObject_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant44InArena(arena.Pointer(), PointerFromQJsonObject(val)))
+}
+
 func NewQVariant43(val QJsonValue_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant43(PointerFromQJsonValue(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant43(val QJsonValue_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant43InArena(arena.Pointer(), PointerFromQJsonValue(val)))
+}
+
 func NewQVariant31(val QLine_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant31(PointerFromQLine(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant31(val QLine_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant31InArena(arena.Pointer(), PointerFromQLine(val)))
+}
+
 func NewQVariant32(val QLineF_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant32(PointerFromQLineF(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant32(val QLineF_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant32InArena(arena.Pointer(), PointerFromQLineF(val)))
+}
+
 func NewQVariant24(val []*QVariant) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant24(func() unsafe.Pointer {
 		var tmpList = NewQVariantFromPointer(NewQVariantFromPointer(nil).__QVariant_val_newList24())
@@ -41771,12 +43032,26 @@ func NewQVariant24(val []*QVariant) *QVariant {
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant24(val []*QVariant) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant24InArena(arena.Pointer(), func() unsafe.Pointer {
+		var tmpList = NewQVariantFromPointer(NewQVariantFromPointer(nil).__QVariant_val_newList24())
+		for _, v := range val {
+			tmpList.__QVariant_val_setList24(v)
+		}
+		return tmpList.Pointer()
+	}()))
+}
+
 func NewQVariant35(l QLocale_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant35(PointerFromQLocale(l)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant35(l QLocale_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant35InArena(arena.Pointer(), PointerFromQLocale(l)))
+}
+
 func NewQVariant25(val map[string]*QVariant) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant25(func() unsafe.Pointer {
 		var tmpList = NewQVariantFromPointer(NewQVariantFromPointer(nil).__QVariant_val_newList25())
@@ -41789,66 +43064,116 @@ func NewQVariant25(val map[string]*QVariant) *QVariant {
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant25(val map[string]*QVariant) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant25InArena(arena.Pointer(), func() unsafe.Pointer {
+		var tmpList = NewQVariantFromPointer(NewQVariantFromPointer(nil).__QVariant_val_newList25())
+		for k, v := range val {
+			tmpList.__QVariant_val_setList25(k, v)
+		}
+		return tmpList.Pointer()
+	}()))
+}
+
 func NewQVariant41(val QModelIndex_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant41(PointerFromQModelIndex(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant41(val QModelIndex_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant41InArena(arena.Pointer(), PointerFromQModelIndex(val)))
+}
+
 func NewQVariant42(val QPersistentModelIndex_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant42(PointerFromQPersistentModelIndex(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant42(val QPersistentModelIndex_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant42InArena(arena.Pointer(), PointerFromQPersistentModelIndex(val)))
+}
+
 func NewQVariant29(val QPoint_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant29(PointerFromQPoint(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant29(val QPoint_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant29InArena(arena.Pointer(), PointerFromQPoint(val)))
+}
+
 func NewQVariant30(val QPointF_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant30(PointerFromQPointF(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant30(val QPointF_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant30InArena(arena.Pointer(), PointerFromQPointF(val)))
+}
+
 func NewQVariant33(val QRect_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant33(PointerFromQRect(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant33(val QRect_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant33InArena(arena.Pointer(), PointerFromQRect(val)))
+}
+
 func NewQVariant34(val QRectF_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant34(PointerFromQRectF(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant34(val QRectF_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant34InArena(arena.Pointer(), PointerFromQRectF(val)))
+}
+
 func NewQVariant36(regExp QRegExp_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant36(PointerFromQRegExp(regExp)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant36(regExp QRegExp_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant36InArena(arena.Pointer(), PointerFromQRegExp(regExp)))
+}
+
 func NewQVariant37(re QRegularExpression_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant37(PointerFromQRegularExpression(re)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant37(re QRegularExpression_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant37InArena(arena.Pointer(), PointerFromQRegularExpression(re)))
+}
+
 func NewQVariant27(val QSize_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant27(PointerFromQSize(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant27(val QSize_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant27InArena(arena.Pointer(), PointerFromQSize(val)))
+}
+
 func NewQVariant28(val QSizeF_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant28(PointerFromQSizeF(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant28(val QSizeF_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant28InArena(arena.Pointer(), PointerFromQSizeF(val)))
+}
+
 func NewQVariant17(val string) *QVariant {
 	var valC = C.CString(val)
 	defer C.free(unsafe.Pointer(valC))
@@ -41857,38 +43182,66 @@ func NewQVariant17(val string) *QVariant {
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant17(val string) *QVariant {
+	var valC = C.CString(val)
+	defer C.free(unsafe.Pointer(valC))
+	return NewQVariantFromPointer(C.QVariant_NewQVariant17InArena(arena.Pointer(), valC))
+}
+
 func NewQVariant19(val []string) *QVariant {
-	var valC = C.CString(strings.Join(val, "|"))
+	var valC = cGoPackStringList(val)
 	defer C.free(unsafe.Pointer(valC))
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant19(valC))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant19(val []string) *QVariant {
+	var valC = cGoPackStringList(val)
+	defer C.free(unsafe.Pointer(valC))
+	return NewQVariantFromPointer(C.QVariant_NewQVariant19InArena(arena.Pointer(), valC))
+}
+
 func NewQVariant22(val QTime_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant22(PointerFromQTime(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant22(val QTime_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant22InArena(arena.Pointer(), PointerFromQTime(val)))
+}
+
 func NewQVariant38(val QUrl_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant38(PointerFromQUrl(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant38(val QUrl_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant38InArena(arena.Pointer(), PointerFromQUrl(val)))
+}
+
 func NewQVariant40(val QUuid_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant40(PointerFromQUuid(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant40(val QUuid_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant40InArena(arena.Pointer(), PointerFromQUuid(val)))
+}
+
 func NewQVariant5(p QVariant_ITF) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant5(PointerFromQVariant(p)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant5(p QVariant_ITF) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant5InArena(arena.Pointer(), PointerFromQVariant(p)))
+}
+
 func NewQVariant14(val string) *QVariant {
 	var valC = C.CString(val)
 	defer C.free(unsafe.Pointer(valC))
@@ -41897,48 +43250,82 @@ func NewQVariant14(val string) *QVariant {
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant14(val string) *QVariant {
+	var valC = C.CString(val)
+	defer C.free(unsafe.Pointer(valC))
+	return NewQVariantFromPointer(C.QVariant_NewQVariant14InArena(arena.Pointer(), valC))
+}
+
 func NewQVariant12(val float64) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant12(C.double(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant12(val float64) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant12InArena(arena.Pointer(), C.double(val)))
+}
+
 func NewQVariant13(val float32) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant13(C.float(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant13(val float32) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant13InArena(arena.Pointer(), C.float(val)))
+}
+
 func NewQVariant3(typeId int, copy unsafe.Pointer) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant3(C.int(int32(typeId)), copy))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant3(typeId int, copy unsafe.Pointer) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant3InArena(arena.Pointer(), C.int(int32(typeId)), copy))
+}
+
 func NewQVariant7(val int) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant7(C.int(int32(val))))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant7(val int) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant7InArena(arena.Pointer(), C.int(int32(val))))
+}
+
 func NewQVariant9(val int64) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant9(C.longlong(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant9(val int64) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant9InArena(arena.Pointer(), C.longlong(val)))
+}
+
 func NewQVariant10(val uint64) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant10(C.ulonglong(val)))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant10(val uint64) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant10InArena(arena.Pointer(), C.ulonglong(val)))
+}
+
 func NewQVariant8(val uint) *QVariant {
 	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariant8(C.uint(uint32(val))))
 	runtime.SetFinalizer(tmpValue, (*QVariant).DestroyQVariant)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVariant8(val uint) *QVariant {
+	return NewQVariantFromPointer(C.QVariant_NewQVariant8InArena(arena.Pointer(), C.uint(uint32(val))))
+}
+
 func (ptr *QVariant) Convert(targetTypeId int) bool {
 	if ptr.Pointer() != nil {
 		return C.QVariant_Convert(ptr.Pointer(), C.int(int32(targetTypeId))) != 0
@@ -42228,7 +43615,7 @@ func (ptr *QVariant) ToString() string {
 
 func (ptr *QVariant) ToStringList() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QVariant_ToStringList(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QVariant_ToStringList(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -42368,7 +43755,7 @@ func (ptr *QVariant) ToImage() unsafe.Pointer {
 func (ptr *QVariant) ToObject() *QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQObjectFromPointer(C.QVariant_ToObject(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -42686,7 +44073,7 @@ func (ptr *QVariantAnimation) SetStartValue(value QVariant_ITF) {
 
 func NewQVariantAnimation(parent QObject_ITF) *QVariantAnimation {
 	var tmpValue = NewQVariantAnimationFromPointer(C.QVariantAnimation_NewQVariantAnimation(PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -42712,7 +44099,7 @@ func (ptr *QVariantAnimation) SetKeyValueAt(step float64, value QVariant_ITF) {
 
 //export callbackQVariantAnimation_UpdateCurrentTime
 func callbackQVariantAnimation_UpdateCurrentTime(ptr unsafe.Pointer, vin C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateCurrentTime"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateCurrentTime"); signal != nil {
 		signal.(func(int))(int(int32(vin)))
 	} else {
 		NewQVariantAnimationFromPointer(ptr).UpdateCurrentTimeDefault(int(int32(vin)))
@@ -42722,14 +44109,14 @@ func callbackQVariantAnimation_UpdateCurrentTime(ptr unsafe.Pointer, vin C.int)
 func (ptr *QVariantAnimation) ConnectUpdateCurrentTime(f func(vin int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateCurrentTime", f)
 	}
 }
 
 func (ptr *QVariantAnimation) DisconnectUpdateCurrentTime() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentTime")
+		qt.DisconnectSignal(ptr.Pointer(), "updateCurrentTime")
 	}
 }
 
@@ -42747,7 +44134,7 @@ func (ptr *QVariantAnimation) UpdateCurrentTimeDefault(vin int) {
 
 //export callbackQVariantAnimation_UpdateCurrentValue
 func callbackQVariantAnimation_UpdateCurrentValue(ptr unsafe.Pointer, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateCurrentValue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateCurrentValue"); signal != nil {
 		signal.(func(*QVariant))(NewQVariantFromPointer(value))
 	} else {
 		NewQVariantAnimationFromPointer(ptr).UpdateCurrentValueDefault(NewQVariantFromPointer(value))
@@ -42757,14 +44144,14 @@ func callbackQVariantAnimation_UpdateCurrentValue(ptr unsafe.Pointer, value unsa
 func (ptr *QVariantAnimation) ConnectUpdateCurrentValue(f func(value *QVariant)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentValue", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateCurrentValue", f)
 	}
 }
 
 func (ptr *QVariantAnimation) DisconnectUpdateCurrentValue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateCurrentValue")
+		qt.DisconnectSignal(ptr.Pointer(), "updateCurrentValue")
 	}
 }
 
@@ -42782,7 +44169,7 @@ func (ptr *QVariantAnimation) UpdateCurrentValueDefault(value QVariant_ITF) {
 
 //export callbackQVariantAnimation_ValueChanged
 func callbackQVariantAnimation_ValueChanged(ptr unsafe.Pointer, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueChanged"); signal != nil {
 		signal.(func(*QVariant))(NewQVariantFromPointer(value))
 	}
 
@@ -42791,14 +44178,14 @@ func callbackQVariantAnimation_ValueChanged(ptr unsafe.Pointer, value unsafe.Poi
 func (ptr *QVariantAnimation) ConnectValueChanged(f func(value *QVariant)) {
 	if ptr.Pointer() != nil {
 		C.QVariantAnimation_ConnectValueChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueChanged", f)
 	}
 }
 
 func (ptr *QVariantAnimation) DisconnectValueChanged() {
 	if ptr.Pointer() != nil {
 		C.QVariantAnimation_DisconnectValueChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valueChanged")
 	}
 }
 
@@ -42811,7 +44198,7 @@ func (ptr *QVariantAnimation) ValueChanged(value QVariant_ITF) {
 func (ptr *QVariantAnimation) DestroyQVariantAnimation() {
 	if ptr.Pointer() != nil {
 		C.QVariantAnimation_DestroyQVariantAnimation(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -42845,7 +44232,7 @@ func (ptr *QVariantAnimation) EndValue() *QVariant {
 
 //export callbackQVariantAnimation_Interpolated
 func callbackQVariantAnimation_Interpolated(ptr unsafe.Pointer, from unsafe.Pointer, to unsafe.Pointer, progress C.double) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "interpolated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "interpolated"); signal != nil {
 		return PointerFromQVariant(signal.(func(*QVariant, *QVariant, float64) *QVariant)(NewQVariantFromPointer(from), NewQVariantFromPointer(to), float64(progress)))
 	}
 
@@ -42855,14 +44242,14 @@ func callbackQVariantAnimation_Interpolated(ptr unsafe.Pointer, from unsafe.Poin
 func (ptr *QVariantAnimation) ConnectInterpolated(f func(from *QVariant, to *QVariant, progress float64) *QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "interpolated", f)
+		qt.ConnectSignal(ptr.Pointer(), "interpolated", f)
 	}
 }
 
 func (ptr *QVariantAnimation) DisconnectInterpolated() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "interpolated")
+		qt.DisconnectSignal(ptr.Pointer(), "interpolated")
 	}
 }
 
@@ -42904,7 +44291,7 @@ func (ptr *QVariantAnimation) StartValue() *QVariant {
 
 //export callbackQVariantAnimation_Duration
 func callbackQVariantAnimation_Duration(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "duration"); signal != nil {
+	if signal := qt.GetSignal(ptr, "duration"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -42914,14 +44301,14 @@ func callbackQVariantAnimation_Duration(ptr unsafe.Pointer) C.int {
 func (ptr *QVariantAnimation) ConnectDuration(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "duration", f)
+		qt.ConnectSignal(ptr.Pointer(), "duration", f)
 	}
 }
 
 func (ptr *QVariantAnimation) DisconnectDuration() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "duration")
+		qt.DisconnectSignal(ptr.Pointer(), "duration")
 	}
 }
 
@@ -43108,48 +44495,84 @@ func NewQVersionNumber() *QVersionNumber {
 	return tmpValue
 }
 
+func (arena *Arena) NewQVersionNumber() *QVersionNumber {
+	return NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumberInArena(arena.Pointer()))
+}
+
 func NewQVersionNumber3(seg []int) *QVersionNumber {
-	var tmpValue = NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber3(func() unsafe.Pointer {
-		var tmpList = NewQVersionNumberFromPointer(NewQVersionNumberFromPointer(nil).__QVersionNumber_seg_newList3())
-		for _, v := range seg {
-			tmpList.__QVersionNumber_seg_setList3(v)
+	var tmpValue = NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber3(func(l []int) unsafe.Pointer {
+		var tmpList = make([]C.int, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = C.int(int32(v))
 		}
-		return tmpList.Pointer()
-	}()))
+		return NewQVersionNumberFromPointer(nil).__QVersionNumber_seg_newListBuffer3(unsafe.Pointer(&tmpList[0]), len(l))
+	}(seg)))
 	runtime.SetFinalizer(tmpValue, (*QVersionNumber).DestroyQVersionNumber)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVersionNumber3(seg []int) *QVersionNumber {
+	return NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber3InArena(arena.Pointer(), func(l []int) unsafe.Pointer {
+		var tmpList = make([]C.int, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = C.int(int32(v))
+		}
+		return NewQVersionNumberFromPointer(nil).__QVersionNumber_seg_newListBuffer3(unsafe.Pointer(&tmpList[0]), len(l))
+	}(seg)))
+}
+
 func NewQVersionNumber2(seg []int) *QVersionNumber {
-	var tmpValue = NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber2(func() unsafe.Pointer {
-		var tmpList = NewQVersionNumberFromPointer(NewQVersionNumberFromPointer(nil).__QVersionNumber_seg_newList2())
-		for _, v := range seg {
-			tmpList.__QVersionNumber_seg_setList2(v)
+	var tmpValue = NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber2(func(l []int) unsafe.Pointer {
+		var tmpList = make([]C.int, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = C.int(int32(v))
 		}
-		return tmpList.Pointer()
-	}()))
+		return NewQVersionNumberFromPointer(nil).__QVersionNumber_seg_newListBuffer2(unsafe.Pointer(&tmpList[0]), len(l))
+	}(seg)))
 	runtime.SetFinalizer(tmpValue, (*QVersionNumber).DestroyQVersionNumber)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVersionNumber2(seg []int) *QVersionNumber {
+	return NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber2InArena(arena.Pointer(), func(l []int) unsafe.Pointer {
+		var tmpList = make([]C.int, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = C.int(int32(v))
+		}
+		return NewQVersionNumberFromPointer(nil).__QVersionNumber_seg_newListBuffer2(unsafe.Pointer(&tmpList[0]), len(l))
+	}(seg)))
+}
+
 func NewQVersionNumber5(maj int) *QVersionNumber {
 	var tmpValue = NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber5(C.int(int32(maj))))
 	runtime.SetFinalizer(tmpValue, (*QVersionNumber).DestroyQVersionNumber)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVersionNumber5(maj int) *QVersionNumber {
+	return NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber5InArena(arena.Pointer(), C.int(int32(maj))))
+}
+
 func NewQVersionNumber6(maj int, min int) *QVersionNumber {
 	var tmpValue = NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber6(C.int(int32(maj)), C.int(int32(min))))
 	runtime.SetFinalizer(tmpValue, (*QVersionNumber).DestroyQVersionNumber)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVersionNumber6(maj int, min int) *QVersionNumber {
+	return NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber6InArena(arena.Pointer(), C.int(int32(maj)), C.int(int32(min))))
+}
+
 func NewQVersionNumber7(maj int, min int, mic int) *QVersionNumber {
 	var tmpValue = NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber7(C.int(int32(maj)), C.int(int32(min)), C.int(int32(mic))))
 	runtime.SetFinalizer(tmpValue, (*QVersionNumber).DestroyQVersionNumber)
 	return tmpValue
 }
 
+func (arena *Arena) NewQVersionNumber7(maj int, min int, mic int) *QVersionNumber {
+	return NewQVersionNumberFromPointer(C.QVersionNumber_NewQVersionNumber7InArena(arena.Pointer(), C.int(int32(maj)), C.int(int32(min)), C.int(int32(mic))))
+}
+
 func QVersionNumber_Compare(v1 QVersionNumber_ITF, v2 QVersionNumber_ITF) int {
 	return int(int32(C.QVersionNumber_QVersionNumber_Compare(PointerFromQVersionNumber(v1), PointerFromQVersionNumber(v2))))
 }
@@ -43162,8 +44585,10 @@ func (ptr *QVersionNumber) Segments() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtCore_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQVersionNumberFromPointer(l.data).__segments_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQVersionNumberFromPointer(l.data).__segments_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QVersionNumber_Segments(ptr.Pointer()))
@@ -43253,6 +44678,16 @@ func (ptr *QVersionNumber) __QVersionNumber_seg_newList3() unsafe.Pointer {
 	return unsafe.Pointer(C.QVersionNumber___QVersionNumber_seg_newList3(ptr.Pointer()))
 }
 
+func (ptr *QVersionNumber) __QVersionNumber_seg_newListBuffer3(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QVersionNumber___QVersionNumber_seg_newListBuffer3(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QVersionNumber) __QVersionNumber_seg_fillList3(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QVersionNumber___QVersionNumber_seg_fillList3(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QVersionNumber) __QVersionNumber_seg_atList2(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QVersionNumber___QVersionNumber_seg_atList2(ptr.Pointer(), C.int(int32(i)))))
@@ -43270,6 +44705,16 @@ func (ptr *QVersionNumber) __QVersionNumber_seg_newList2() unsafe.Pointer {
 	return unsafe.Pointer(C.QVersionNumber___QVersionNumber_seg_newList2(ptr.Pointer()))
 }
 
+func (ptr *QVersionNumber) __QVersionNumber_seg_newListBuffer2(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QVersionNumber___QVersionNumber_seg_newListBuffer2(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QVersionNumber) __QVersionNumber_seg_fillList2(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QVersionNumber___QVersionNumber_seg_fillList2(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QVersionNumber) __segments_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QVersionNumber___segments_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -43287,6 +44732,16 @@ func (ptr *QVersionNumber) __segments_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QVersionNumber___segments_newList(ptr.Pointer()))
 }
 
+func (ptr *QVersionNumber) __segments_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QVersionNumber___segments_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QVersionNumber) __segments_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QVersionNumber___segments_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QWaitCondition struct {
 	ptr unsafe.Pointer
 }
@@ -43330,6 +44785,10 @@ func NewQWaitCondition() *QWaitCondition {
 	return tmpValue
 }
 
+func (arena *Arena) NewQWaitCondition() *QWaitCondition {
+	return NewQWaitConditionFromPointer(C.QWaitCondition_NewQWaitConditionInArena(arena.Pointer()))
+}
+
 func (ptr *QWaitCondition) Wait(lockedMutex QMutex_ITF, time uint) bool {
 	if ptr.Pointer() != nil {
 		return C.QWaitCondition_Wait(ptr.Pointer(), PointerFromQMutex(lockedMutex), C.ulong(uint32(time))) != 0
@@ -43495,6 +44954,10 @@ func NewQWriteLocker(lock QReadWriteLock_ITF) *QWriteLocker {
 	return tmpValue
 }
 
+func (arena *Arena) NewQWriteLocker(lock QReadWriteLock_ITF) *QWriteLocker {
+	return NewQWriteLockerFromPointer(C.QWriteLocker_NewQWriteLockerInArena(arena.Pointer(), PointerFromQReadWriteLock(lock)))
+}
+
 func (ptr *QWriteLocker) Relock() {
 	if ptr.Pointer() != nil {
 		C.QWriteLocker_Relock(ptr.Pointer())
@@ -43564,12 +45027,20 @@ func NewQXmlStreamAttribute() *QXmlStreamAttribute {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamAttribute() *QXmlStreamAttribute {
+	return NewQXmlStreamAttributeFromPointer(C.QXmlStreamAttribute_NewQXmlStreamAttributeInArena(arena.Pointer()))
+}
+
 func NewQXmlStreamAttribute5(other QXmlStreamAttribute_ITF) *QXmlStreamAttribute {
 	var tmpValue = NewQXmlStreamAttributeFromPointer(C.QXmlStreamAttribute_NewQXmlStreamAttribute5(PointerFromQXmlStreamAttribute(other)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamAttribute).DestroyQXmlStreamAttribute)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamAttribute5(other QXmlStreamAttribute_ITF) *QXmlStreamAttribute {
+	return NewQXmlStreamAttributeFromPointer(C.QXmlStreamAttribute_NewQXmlStreamAttribute5InArena(arena.Pointer(), PointerFromQXmlStreamAttribute(other)))
+}
+
 func NewQXmlStreamAttribute3(namespaceUri string, name string, value string) *QXmlStreamAttribute {
 	var namespaceUriC = C.CString(namespaceUri)
 	defer C.free(unsafe.Pointer(namespaceUriC))
@@ -43582,6 +45053,16 @@ func NewQXmlStreamAttribute3(namespaceUri string, name string, value string) *QX
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamAttribute3(namespaceUri string, name string, value string) *QXmlStreamAttribute {
+	var namespaceUriC = C.CString(namespaceUri)
+	defer C.free(unsafe.Pointer(namespaceUriC))
+	var nameC = C.CString(name)
+	defer C.free(unsafe.Pointer(nameC))
+	var valueC = C.CString(value)
+	defer C.free(unsafe.Pointer(valueC))
+	return NewQXmlStreamAttributeFromPointer(C.QXmlStreamAttribute_NewQXmlStreamAttribute3InArena(arena.Pointer(), namespaceUriC, nameC, valueC))
+}
+
 func NewQXmlStreamAttribute2(qualifiedName string, value string) *QXmlStreamAttribute {
 	var qualifiedNameC = C.CString(qualifiedName)
 	defer C.free(unsafe.Pointer(qualifiedNameC))
@@ -43592,12 +45073,24 @@ func NewQXmlStreamAttribute2(qualifiedName string, value string) *QXmlStreamAttr
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamAttribute2(qualifiedName string, value string) *QXmlStreamAttribute {
+	var qualifiedNameC = C.CString(qualifiedName)
+	defer C.free(unsafe.Pointer(qualifiedNameC))
+	var valueC = C.CString(value)
+	defer C.free(unsafe.Pointer(valueC))
+	return NewQXmlStreamAttributeFromPointer(C.QXmlStreamAttribute_NewQXmlStreamAttribute2InArena(arena.Pointer(), qualifiedNameC, valueC))
+}
+
 func NewQXmlStreamAttribute4(other QXmlStreamAttribute_ITF) *QXmlStreamAttribute {
 	var tmpValue = NewQXmlStreamAttributeFromPointer(C.QXmlStreamAttribute_NewQXmlStreamAttribute4(PointerFromQXmlStreamAttribute(other)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamAttribute).DestroyQXmlStreamAttribute)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamAttribute4(other QXmlStreamAttribute_ITF) *QXmlStreamAttribute {
+	return NewQXmlStreamAttributeFromPointer(C.QXmlStreamAttribute_NewQXmlStreamAttribute4InArena(arena.Pointer(), PointerFromQXmlStreamAttribute(other)))
+}
+
 func (ptr *QXmlStreamAttribute) DestroyQXmlStreamAttribute() {
 	if ptr.Pointer() != nil {
 		C.QXmlStreamAttribute_DestroyQXmlStreamAttribute(ptr.Pointer())
@@ -43709,6 +45202,10 @@ func NewQXmlStreamAttributes() *QXmlStreamAttributes {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamAttributes() *QXmlStreamAttributes {
+	return NewQXmlStreamAttributesFromPointer(C.QXmlStreamAttributes_NewQXmlStreamAttributesInArena(arena.Pointer()))
+}
+
 func (ptr *QXmlStreamAttributes) Append(namespaceUri string, name string, value string) {
 	if ptr.Pointer() != nil {
 		var namespaceUriC = C.CString(namespaceUri)
@@ -43854,18 +45351,30 @@ func NewQXmlStreamEntityDeclaration() *QXmlStreamEntityDeclaration {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamEntityDeclaration() *QXmlStreamEntityDeclaration {
+	return NewQXmlStreamEntityDeclarationFromPointer(C.QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclarationInArena(arena.Pointer()))
+}
+
 func NewQXmlStreamEntityDeclaration3(other QXmlStreamEntityDeclaration_ITF) *QXmlStreamEntityDeclaration {
 	var tmpValue = NewQXmlStreamEntityDeclarationFromPointer(C.QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration3(PointerFromQXmlStreamEntityDeclaration(other)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamEntityDeclaration).DestroyQXmlStreamEntityDeclaration)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamEntityDeclaration3(other QXmlStreamEntityDeclaration_ITF) *QXmlStreamEntityDeclaration {
+	return NewQXmlStreamEntityDeclarationFromPointer(C.QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration3InArena(arena.Pointer(), PointerFromQXmlStreamEntityDeclaration(other)))
+}
+
 func NewQXmlStreamEntityDeclaration2(other QXmlStreamEntityDeclaration_ITF) *QXmlStreamEntityDeclaration {
 	var tmpValue = NewQXmlStreamEntityDeclarationFromPointer(C.QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration2(PointerFromQXmlStreamEntityDeclaration(other)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamEntityDeclaration).DestroyQXmlStreamEntityDeclaration)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamEntityDeclaration2(other QXmlStreamEntityDeclaration_ITF) *QXmlStreamEntityDeclaration {
+	return NewQXmlStreamEntityDeclarationFromPointer(C.QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration2InArena(arena.Pointer(), PointerFromQXmlStreamEntityDeclaration(other)))
+}
+
 func (ptr *QXmlStreamEntityDeclaration) DestroyQXmlStreamEntityDeclaration() {
 	if ptr.Pointer() != nil {
 		C.QXmlStreamEntityDeclaration_DestroyQXmlStreamEntityDeclaration(ptr.Pointer())
@@ -43958,7 +45467,7 @@ func NewQXmlStreamEntityResolverFromPointer(ptr unsafe.Pointer) *QXmlStreamEntit
 
 //export callbackQXmlStreamEntityResolver_ResolveUndeclaredEntity
 func callbackQXmlStreamEntityResolver_ResolveUndeclaredEntity(ptr unsafe.Pointer, name C.struct_QtCore_PackedString) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resolveUndeclaredEntity"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resolveUndeclaredEntity"); signal != nil {
 		return C.CString(signal.(func(string) string)(cGoUnpackString(name)))
 	}
 
@@ -43968,14 +45477,14 @@ func callbackQXmlStreamEntityResolver_ResolveUndeclaredEntity(ptr unsafe.Pointer
 func (ptr *QXmlStreamEntityResolver) ConnectResolveUndeclaredEntity(f func(name string) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resolveUndeclaredEntity", f)
+		qt.ConnectSignal(ptr.Pointer(), "resolveUndeclaredEntity", f)
 	}
 }
 
 func (ptr *QXmlStreamEntityResolver) DisconnectResolveUndeclaredEntity() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resolveUndeclaredEntity")
+		qt.DisconnectSignal(ptr.Pointer(), "resolveUndeclaredEntity")
 	}
 }
 
@@ -43999,7 +45508,7 @@ func (ptr *QXmlStreamEntityResolver) ResolveUndeclaredEntityDefault(name string)
 
 //export callbackQXmlStreamEntityResolver_DestroyQXmlStreamEntityResolver
 func callbackQXmlStreamEntityResolver_DestroyQXmlStreamEntityResolver(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlStreamEntityResolver"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlStreamEntityResolver"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlStreamEntityResolverFromPointer(ptr).DestroyQXmlStreamEntityResolverDefault()
@@ -44009,21 +45518,21 @@ func callbackQXmlStreamEntityResolver_DestroyQXmlStreamEntityResolver(ptr unsafe
 func (ptr *QXmlStreamEntityResolver) ConnectDestroyQXmlStreamEntityResolver(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlStreamEntityResolver", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlStreamEntityResolver", f)
 	}
 }
 
 func (ptr *QXmlStreamEntityResolver) DisconnectDestroyQXmlStreamEntityResolver() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlStreamEntityResolver")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlStreamEntityResolver")
 	}
 }
 
 func (ptr *QXmlStreamEntityResolver) DestroyQXmlStreamEntityResolver() {
 	if ptr.Pointer() != nil {
 		C.QXmlStreamEntityResolver_DestroyQXmlStreamEntityResolver(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -44031,7 +45540,7 @@ func (ptr *QXmlStreamEntityResolver) DestroyQXmlStreamEntityResolver() {
 func (ptr *QXmlStreamEntityResolver) DestroyQXmlStreamEntityResolverDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlStreamEntityResolver_DestroyQXmlStreamEntityResolverDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -44079,12 +45588,20 @@ func NewQXmlStreamNamespaceDeclaration() *QXmlStreamNamespaceDeclaration {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamNamespaceDeclaration() *QXmlStreamNamespaceDeclaration {
+	return NewQXmlStreamNamespaceDeclarationFromPointer(C.QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclarationInArena(arena.Pointer()))
+}
+
 func NewQXmlStreamNamespaceDeclaration3(other QXmlStreamNamespaceDeclaration_ITF) *QXmlStreamNamespaceDeclaration {
 	var tmpValue = NewQXmlStreamNamespaceDeclarationFromPointer(C.QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration3(PointerFromQXmlStreamNamespaceDeclaration(other)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamNamespaceDeclaration).DestroyQXmlStreamNamespaceDeclaration)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamNamespaceDeclaration3(other QXmlStreamNamespaceDeclaration_ITF) *QXmlStreamNamespaceDeclaration {
+	return NewQXmlStreamNamespaceDeclarationFromPointer(C.QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration3InArena(arena.Pointer(), PointerFromQXmlStreamNamespaceDeclaration(other)))
+}
+
 func NewQXmlStreamNamespaceDeclaration4(prefix string, namespaceUri string) *QXmlStreamNamespaceDeclaration {
 	var prefixC = C.CString(prefix)
 	defer C.free(unsafe.Pointer(prefixC))
@@ -44095,12 +45612,24 @@ func NewQXmlStreamNamespaceDeclaration4(prefix string, namespaceUri string) *QXm
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamNamespaceDeclaration4(prefix string, namespaceUri string) *QXmlStreamNamespaceDeclaration {
+	var prefixC = C.CString(prefix)
+	defer C.free(unsafe.Pointer(prefixC))
+	var namespaceUriC = C.CString(namespaceUri)
+	defer C.free(unsafe.Pointer(namespaceUriC))
+	return NewQXmlStreamNamespaceDeclarationFromPointer(C.QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration4InArena(arena.Pointer(), prefixC, namespaceUriC))
+}
+
 func NewQXmlStreamNamespaceDeclaration2(other QXmlStreamNamespaceDeclaration_ITF) *QXmlStreamNamespaceDeclaration {
 	var tmpValue = NewQXmlStreamNamespaceDeclarationFromPointer(C.QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration2(PointerFromQXmlStreamNamespaceDeclaration(other)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamNamespaceDeclaration).DestroyQXmlStreamNamespaceDeclaration)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamNamespaceDeclaration2(other QXmlStreamNamespaceDeclaration_ITF) *QXmlStreamNamespaceDeclaration {
+	return NewQXmlStreamNamespaceDeclarationFromPointer(C.QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration2InArena(arena.Pointer(), PointerFromQXmlStreamNamespaceDeclaration(other)))
+}
+
 func (ptr *QXmlStreamNamespaceDeclaration) DestroyQXmlStreamNamespaceDeclaration() {
 	if ptr.Pointer() != nil {
 		C.QXmlStreamNamespaceDeclaration_DestroyQXmlStreamNamespaceDeclaration(ptr.Pointer())
@@ -44169,18 +45698,30 @@ func NewQXmlStreamNotationDeclaration() *QXmlStreamNotationDeclaration {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamNotationDeclaration() *QXmlStreamNotationDeclaration {
+	return NewQXmlStreamNotationDeclarationFromPointer(C.QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclarationInArena(arena.Pointer()))
+}
+
 func NewQXmlStreamNotationDeclaration3(other QXmlStreamNotationDeclaration_ITF) *QXmlStreamNotationDeclaration {
 	var tmpValue = NewQXmlStreamNotationDeclarationFromPointer(C.QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration3(PointerFromQXmlStreamNotationDeclaration(other)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamNotationDeclaration).DestroyQXmlStreamNotationDeclaration)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamNotationDeclaration3(other QXmlStreamNotationDeclaration_ITF) *QXmlStreamNotationDeclaration {
+	return NewQXmlStreamNotationDeclarationFromPointer(C.QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration3InArena(arena.Pointer(), PointerFromQXmlStreamNotationDeclaration(other)))
+}
+
 func NewQXmlStreamNotationDeclaration2(other QXmlStreamNotationDeclaration_ITF) *QXmlStreamNotationDeclaration {
 	var tmpValue = NewQXmlStreamNotationDeclarationFromPointer(C.QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration2(PointerFromQXmlStreamNotationDeclaration(other)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamNotationDeclaration).DestroyQXmlStreamNotationDeclaration)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamNotationDeclaration2(other QXmlStreamNotationDeclaration_ITF) *QXmlStreamNotationDeclaration {
+	return NewQXmlStreamNotationDeclarationFromPointer(C.QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration2InArena(arena.Pointer(), PointerFromQXmlStreamNotationDeclaration(other)))
+}
+
 func (ptr *QXmlStreamNotationDeclaration) DestroyQXmlStreamNotationDeclaration() {
 	if ptr.Pointer() != nil {
 		C.QXmlStreamNotationDeclaration_DestroyQXmlStreamNotationDeclaration(ptr.Pointer())
@@ -44306,18 +45847,30 @@ func NewQXmlStreamReader() *QXmlStreamReader {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamReader() *QXmlStreamReader {
+	return NewQXmlStreamReaderFromPointer(C.QXmlStreamReader_NewQXmlStreamReaderInArena(arena.Pointer()))
+}
+
 func NewQXmlStreamReader2(device QIODevice_ITF) *QXmlStreamReader {
 	var tmpValue = NewQXmlStreamReaderFromPointer(C.QXmlStreamReader_NewQXmlStreamReader2(PointerFromQIODevice(device)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamReader).DestroyQXmlStreamReader)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamReader2(device QIODevice_ITF) *QXmlStreamReader {
+	return NewQXmlStreamReaderFromPointer(C.QXmlStreamReader_NewQXmlStreamReader2InArena(arena.Pointer(), PointerFromQIODevice(device)))
+}
+
 func NewQXmlStreamReader3(data QByteArray_ITF) *QXmlStreamReader {
 	var tmpValue = NewQXmlStreamReaderFromPointer(C.QXmlStreamReader_NewQXmlStreamReader3(PointerFromQByteArray(data)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamReader).DestroyQXmlStreamReader)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamReader3(data QByteArray_ITF) *QXmlStreamReader {
+	return NewQXmlStreamReaderFromPointer(C.QXmlStreamReader_NewQXmlStreamReader3InArena(arena.Pointer(), PointerFromQByteArray(data)))
+}
+
 func NewQXmlStreamReader4(data string) *QXmlStreamReader {
 	var dataC = C.CString(data)
 	defer C.free(unsafe.Pointer(dataC))
@@ -44326,6 +45879,12 @@ func NewQXmlStreamReader4(data string) *QXmlStreamReader {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamReader4(data string) *QXmlStreamReader {
+	var dataC = C.CString(data)
+	defer C.free(unsafe.Pointer(dataC))
+	return NewQXmlStreamReaderFromPointer(C.QXmlStreamReader_NewQXmlStreamReader4InArena(arena.Pointer(), dataC))
+}
+
 func NewQXmlStreamReader5(data string) *QXmlStreamReader {
 	var dataC = C.CString(data)
 	defer C.free(unsafe.Pointer(dataC))
@@ -44334,6 +45893,12 @@ func NewQXmlStreamReader5(data string) *QXmlStreamReader {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamReader5(data string) *QXmlStreamReader {
+	var dataC = C.CString(data)
+	defer C.free(unsafe.Pointer(dataC))
+	return NewQXmlStreamReaderFromPointer(C.QXmlStreamReader_NewQXmlStreamReader5InArena(arena.Pointer(), dataC))
+}
+
 func (ptr *QXmlStreamReader) ReadNext() QXmlStreamReader__TokenType {
 	if ptr.Pointer() != nil {
 		return QXmlStreamReader__TokenType(C.QXmlStreamReader_ReadNext(ptr.Pointer()))
@@ -44431,7 +45996,7 @@ func (ptr *QXmlStreamReader) Error() QXmlStreamReader__Error {
 func (ptr *QXmlStreamReader) Device() *QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQIODeviceFromPointer(C.QXmlStreamReader_Device(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -44744,18 +46309,30 @@ func NewQXmlStreamWriter() *QXmlStreamWriter {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamWriter() *QXmlStreamWriter {
+	return NewQXmlStreamWriterFromPointer(C.QXmlStreamWriter_NewQXmlStreamWriterInArena(arena.Pointer()))
+}
+
 func NewQXmlStreamWriter3(array QByteArray_ITF) *QXmlStreamWriter {
 	var tmpValue = NewQXmlStreamWriterFromPointer(C.QXmlStreamWriter_NewQXmlStreamWriter3(PointerFromQByteArray(array)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamWriter).DestroyQXmlStreamWriter)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamWriter3(array QByteArray_ITF) *QXmlStreamWriter {
+	return NewQXmlStreamWriterFromPointer(C.QXmlStreamWriter_NewQXmlStreamWriter3InArena(arena.Pointer(), PointerFromQByteArray(array)))
+}
+
 func NewQXmlStreamWriter2(device QIODevice_ITF) *QXmlStreamWriter {
 	var tmpValue = NewQXmlStreamWriterFromPointer(C.QXmlStreamWriter_NewQXmlStreamWriter2(PointerFromQIODevice(device)))
 	runtime.SetFinalizer(tmpValue, (*QXmlStreamWriter).DestroyQXmlStreamWriter)
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamWriter2(device QIODevice_ITF) *QXmlStreamWriter {
+	return NewQXmlStreamWriterFromPointer(C.QXmlStreamWriter_NewQXmlStreamWriter2InArena(arena.Pointer(), PointerFromQIODevice(device)))
+}
+
 func NewQXmlStreamWriter4(stri string) *QXmlStreamWriter {
 	var striC = C.CString(stri)
 	defer C.free(unsafe.Pointer(striC))
@@ -44764,6 +46341,12 @@ func NewQXmlStreamWriter4(stri string) *QXmlStreamWriter {
 	return tmpValue
 }
 
+func (arena *Arena) NewQXmlStreamWriter4(stri string) *QXmlStreamWriter {
+	var striC = C.CString(stri)
+	defer C.free(unsafe.Pointer(striC))
+	return NewQXmlStreamWriterFromPointer(C.QXmlStreamWriter_NewQXmlStreamWriter4InArena(arena.Pointer(), striC))
+}
+
 func (ptr *QXmlStreamWriter) SetAutoFormatting(enable bool) {
 	if ptr.Pointer() != nil {
 		C.QXmlStreamWriter_SetAutoFormatting(ptr.Pointer(), C.char(int8(qt.GoBoolToInt(enable))))
@@ -45006,7 +46589,7 @@ func (ptr *QXmlStreamWriter) DestroyQXmlStreamWriter() {
 func (ptr *QXmlStreamWriter) Device() *QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQIODeviceFromPointer(C.QXmlStreamWriter_Device(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
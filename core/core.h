@@ -227,6 +227,8 @@ void* QAbstractItemModel___changePersistentIndexList_to_newList(void* ptr);
 int QAbstractItemModel___dataChanged_roles_atList(void* ptr, int i);
 void QAbstractItemModel___dataChanged_roles_setList(void* ptr, int i);
 void* QAbstractItemModel___dataChanged_roles_newList(void* ptr);
+void* QAbstractItemModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count);
+void QAbstractItemModel___dataChanged_roles_fillList(void* ptr, void* data);
 void* QAbstractItemModel___doSetRoleNames_roleNames_atList(void* ptr, int i);
 void QAbstractItemModel___doSetRoleNames_roleNames_setList(void* ptr, int key, void* i);
 void* QAbstractItemModel___doSetRoleNames_roleNames_newList(void* ptr);
@@ -264,18 +266,28 @@ void* QAbstractItemModel___encodeData_indexes_newList(void* ptr);
 int QAbstractItemModel_____setItemData_keyList_atList(void* ptr, int i);
 void QAbstractItemModel_____setItemData_keyList_setList(void* ptr, int i);
 void* QAbstractItemModel_____setItemData_keyList_newList(void* ptr);
+void* QAbstractItemModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QAbstractItemModel_____setItemData_keyList_fillList(void* ptr, void* data);
 int QAbstractItemModel_____doSetRoleNames_keyList_atList(void* ptr, int i);
 void QAbstractItemModel_____doSetRoleNames_keyList_setList(void* ptr, int i);
 void* QAbstractItemModel_____doSetRoleNames_keyList_newList(void* ptr);
+void* QAbstractItemModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QAbstractItemModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data);
 int QAbstractItemModel_____setRoleNames_keyList_atList(void* ptr, int i);
 void QAbstractItemModel_____setRoleNames_keyList_setList(void* ptr, int i);
 void* QAbstractItemModel_____setRoleNames_keyList_newList(void* ptr);
+void* QAbstractItemModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QAbstractItemModel_____setRoleNames_keyList_fillList(void* ptr, void* data);
 int QAbstractItemModel_____roleNames_keyList_atList(void* ptr, int i);
 void QAbstractItemModel_____roleNames_keyList_setList(void* ptr, int i);
 void* QAbstractItemModel_____roleNames_keyList_newList(void* ptr);
+void* QAbstractItemModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QAbstractItemModel_____roleNames_keyList_fillList(void* ptr, void* data);
 int QAbstractItemModel_____itemData_keyList_atList(void* ptr, int i);
 void QAbstractItemModel_____itemData_keyList_setList(void* ptr, int i);
 void* QAbstractItemModel_____itemData_keyList_newList(void* ptr);
+void* QAbstractItemModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QAbstractItemModel_____itemData_keyList_fillList(void* ptr, void* data);
 void* QAbstractListModel_NewQAbstractListModel(void* parent);
 void QAbstractListModel_DestroyQAbstractListModel(void* ptr);
 void* QAbstractListModel_Index(void* ptr, int row, int column, void* parent);
@@ -284,6 +296,7 @@ void* QAbstractListModel_Parent(void* ptr, void* index);
 void* QAbstractListModel_ParentDefault(void* ptr, void* index);
 void* QAbstractListModel_Data(void* ptr, void* index, int role);
 void* QAbstractListModel_DataDefault(void* ptr, void* index, int role);
+void QAbstractListModel_DataDefaultInto(void* ptr, void* index, int role, void* ret);
 int QAbstractListModel_ColumnCount(void* ptr, void* parent);
 int QAbstractListModel_ColumnCountDefault(void* ptr, void* parent);
 int QAbstractListModel_RowCount(void* ptr, void* parent);
@@ -311,6 +324,7 @@ void* QAbstractProxyModel_MapFromSource(void* ptr, void* sourceIndex);
 void* QAbstractProxyModel_MapToSource(void* ptr, void* proxyIndex);
 void* QAbstractProxyModel_Data(void* ptr, void* proxyIndex, int role);
 void* QAbstractProxyModel_DataDefault(void* ptr, void* proxyIndex, int role);
+void QAbstractProxyModel_DataDefaultInto(void* ptr, void* proxyIndex, int role, void* ret);
 void* QAbstractProxyModel_Index(void* ptr, int row, int column, void* parent);
 void* QAbstractProxyModel_IndexDefault(void* ptr, int row, int column, void* parent);
 void* QAbstractProxyModel_Parent(void* ptr, void* index);
@@ -341,6 +355,7 @@ void* QAbstractTableModel_Parent(void* ptr, void* index);
 void* QAbstractTableModel_ParentDefault(void* ptr, void* index);
 void* QAbstractTableModel_Data(void* ptr, void* index, int role);
 void* QAbstractTableModel_DataDefault(void* ptr, void* index, int role);
+void QAbstractTableModel_DataDefaultInto(void* ptr, void* index, int role, void* ret);
 int QAbstractTableModel_ColumnCount(void* ptr, void* parent);
 int QAbstractTableModel_ColumnCountDefault(void* ptr, void* parent);
 int QAbstractTableModel_RowCount(void* ptr, void* parent);
@@ -393,6 +408,7 @@ int QAnimationGroup_DurationDefault(void* ptr);
 void* QAssociativeIterable_Value(void* ptr, void* key);
 int QAssociativeIterable_Size(void* ptr);
 void* QBasicTimer_NewQBasicTimer();
+void* QBasicTimer_NewQBasicTimerInArena(void* arena);
 void QBasicTimer_Start(void* ptr, int msec, void* object);
 void QBasicTimer_Start2(void* ptr, int msec, long long timerType, void* obj);
 void QBasicTimer_Stop(void* ptr);
@@ -400,9 +416,13 @@ void QBasicTimer_DestroyQBasicTimer(void* ptr);
 char QBasicTimer_IsActive(void* ptr);
 int QBasicTimer_TimerId(void* ptr);
 void* QBitArray_NewQBitArray();
+void* QBitArray_NewQBitArrayInArena(void* arena);
 void* QBitArray_NewQBitArray4(void* other);
+void* QBitArray_NewQBitArray4InArena(void* arena, void* other);
 void* QBitArray_NewQBitArray3(void* other);
+void* QBitArray_NewQBitArray3InArena(void* arena, void* other);
 void* QBitArray_NewQBitArray2(int size, char value);
+void* QBitArray_NewQBitArray2InArena(void* arena, int size, char value);
 char QBitArray_Fill(void* ptr, char value, int size);
 char QBitArray_ToggleBit(void* ptr, int i);
 void QBitArray_Clear(void* ptr);
@@ -486,10 +506,15 @@ void* QByteArray_QByteArray_Number3(long long n, int base);
 void* QByteArray_QByteArray_Number4(unsigned long long n, int base);
 void* QByteArray_QByteArray_Number2(unsigned int n, int base);
 void* QByteArray_NewQByteArray();
+void* QByteArray_NewQByteArrayInArena(void* arena);
 void* QByteArray_NewQByteArray6(void* other);
+void* QByteArray_NewQByteArray6InArena(void* arena, void* other);
 void* QByteArray_NewQByteArray5(void* other);
+void* QByteArray_NewQByteArray5InArena(void* arena, void* other);
 void* QByteArray_NewQByteArray2(char* data, int size);
+void* QByteArray_NewQByteArray2InArena(void* arena, char* data, int size);
 void* QByteArray_NewQByteArray3(int size, char* ch);
+void* QByteArray_NewQByteArray3InArena(void* arena, int size, char* ch);
 struct QtCore_PackedString QByteArray_Data(void* ptr);
 void QByteArray_Chop(void* ptr, int n);
 void QByteArray_Clear(void* ptr);
@@ -519,7 +544,7 @@ void* QByteArray_ToLower(void* ptr);
 void* QByteArray_ToPercentEncoding(void* ptr, void* exclude, void* include, char* percent);
 void* QByteArray_ToUpper(void* ptr);
 void* QByteArray_Trimmed(void* ptr);
-struct QtCore_PackedList QByteArray_Split(void* ptr, char* sep);
+struct QtCore_PackedString QByteArray_Split(void* ptr, char* sep);
 char QByteArray_Contains3(void* ptr, char* ch);
 char QByteArray_Contains(void* ptr, void* ba);
 char QByteArray_Contains2(void* ptr, char* str);
@@ -566,9 +591,13 @@ void* QByteArrayList_Join(void* ptr);
 void* QByteArrayList_Join3(void* ptr, char* separator);
 void* QByteArrayList_Join2(void* ptr, void* separator);
 void* QByteArrayMatcher_NewQByteArrayMatcher();
+void* QByteArrayMatcher_NewQByteArrayMatcherInArena(void* arena);
 void* QByteArrayMatcher_NewQByteArrayMatcher2(void* pattern);
+void* QByteArrayMatcher_NewQByteArrayMatcher2InArena(void* arena, void* pattern);
 void* QByteArrayMatcher_NewQByteArrayMatcher4(void* other);
+void* QByteArrayMatcher_NewQByteArrayMatcher4InArena(void* arena, void* other);
 void* QByteArrayMatcher_NewQByteArrayMatcher3(char* pattern, int length);
+void* QByteArrayMatcher_NewQByteArrayMatcher3InArena(void* arena, char* pattern, int length);
 void QByteArrayMatcher_SetPattern(void* ptr, void* pattern);
 void QByteArrayMatcher_DestroyQByteArrayMatcher(void* ptr);
 void* QByteArrayMatcher_Pattern(void* ptr);
@@ -580,15 +609,25 @@ long long QChar_QChar_Direction2(unsigned int ucs4);
 long long QChar_QChar_JoiningType2(unsigned int ucs4);
 void* QChar_QChar_FromLatin1(char* c);
 void* QChar_NewQChar();
+void* QChar_NewQCharInArena(void* arena);
 void* QChar_NewQChar8(void* ch);
+void* QChar_NewQChar8InArena(void* arena, void* ch);
 void* QChar_NewQChar7(long long ch);
+void* QChar_NewQChar7InArena(void* arena, long long ch);
 void* QChar_NewQChar9(char* ch);
+void* QChar_NewQChar9InArena(void* arena, char* ch);
 void* QChar_NewQChar6(int code);
+void* QChar_NewQChar6InArena(void* arena, int code);
 void* QChar_NewQChar4(short code);
+void* QChar_NewQChar4InArena(void* arena, short code);
 void* QChar_NewQChar3(char* cell, char* row);
+void* QChar_NewQChar3InArena(void* arena, char* cell, char* row);
 void* QChar_NewQChar10(char* ch);
+void* QChar_NewQChar10InArena(void* arena, char* ch);
 void* QChar_NewQChar5(unsigned int code);
+void* QChar_NewQChar5InArena(void* arena, unsigned int code);
 void* QChar_NewQChar2(unsigned short code);
+void* QChar_NewQChar2InArena(void* arena, unsigned short code);
 struct QtCore_PackedString QChar_QChar_Decomposition2(unsigned int ucs4);
 long long QChar_QChar_Script2(unsigned int ucs4);
 long long QChar_QChar_CurrentUnicodeVersion();
@@ -665,8 +704,11 @@ char QChildEvent_Removed(void* ptr);
 void* QChildEvent_C(void* ptr);
 void QChildEvent_SetC(void* ptr, void* vqo);
 void* QCollator_NewQCollator3(void* other);
+void* QCollator_NewQCollator3InArena(void* arena, void* other);
 void* QCollator_NewQCollator2(void* other);
+void* QCollator_NewQCollator2InArena(void* arena, void* other);
 void* QCollator_NewQCollator(void* locale);
+void* QCollator_NewQCollatorInArena(void* arena, void* locale);
 void QCollator_SetCaseSensitivity(void* ptr, long long sensitivity);
 void QCollator_SetIgnorePunctuation(void* ptr, char on);
 void QCollator_SetLocale(void* ptr, void* locale);
@@ -682,14 +724,20 @@ int QCollator_Compare3(void* ptr, void* s1, int len1, void* s2, int len2);
 int QCollator_Compare(void* ptr, char* s1, char* s2);
 int QCollator_Compare2(void* ptr, void* s1, void* s2);
 void* QCollatorSortKey_NewQCollatorSortKey(void* other);
+void* QCollatorSortKey_NewQCollatorSortKeyInArena(void* arena, void* other);
 void QCollatorSortKey_Swap(void* ptr, void* other);
 void QCollatorSortKey_DestroyQCollatorSortKey(void* ptr);
 int QCollatorSortKey_Compare(void* ptr, void* otherKey);
 void* QCommandLineOption_NewQCommandLineOption5(void* other);
+void* QCommandLineOption_NewQCommandLineOption5InArena(void* arena, void* other);
 void* QCommandLineOption_NewQCommandLineOption(char* name);
+void* QCommandLineOption_NewQCommandLineOptionInArena(void* arena, char* name);
 void* QCommandLineOption_NewQCommandLineOption3(char* name, char* description, char* valueName, char* defaultValue);
+void* QCommandLineOption_NewQCommandLineOption3InArena(void* arena, char* name, char* description, char* valueName, char* defaultValue);
 void* QCommandLineOption_NewQCommandLineOption2(char* names);
+void* QCommandLineOption_NewQCommandLineOption2InArena(void* arena, char* names);
 void* QCommandLineOption_NewQCommandLineOption4(char* names, char* description, char* valueName, char* defaultValue);
+void* QCommandLineOption_NewQCommandLineOption4InArena(void* arena, char* names, char* description, char* valueName, char* defaultValue);
 void QCommandLineOption_SetDefaultValue(void* ptr, char* defaultValue);
 void QCommandLineOption_SetDefaultValues(void* ptr, char* defaultValues);
 void QCommandLineOption_SetDescription(void* ptr, char* description);
@@ -705,6 +753,7 @@ struct QtCore_PackedString QCommandLineOption_Names(void* ptr);
 void* QCommandLineParser_AddHelpOption(void* ptr);
 void* QCommandLineParser_AddVersionOption(void* ptr);
 void* QCommandLineParser_NewQCommandLineParser();
+void* QCommandLineParser_NewQCommandLineParserInArena(void* arena);
 char QCommandLineParser_AddOption(void* ptr, void* option);
 char QCommandLineParser_AddOptions(void* ptr, void* options);
 char QCommandLineParser_Parse(void* ptr, char* arguments);
@@ -783,6 +832,7 @@ void QCoreApplication_DestroyQCoreApplication(void* ptr);
 int QCoreApplication_QCoreApplication_ApplicationFlags();
 void* QCryptographicHash_QCryptographicHash_Hash(void* data, long long method);
 void* QCryptographicHash_NewQCryptographicHash(long long method);
+void* QCryptographicHash_NewQCryptographicHashInArena(void* arena, long long method);
 char QCryptographicHash_AddData3(void* ptr, void* device);
 void QCryptographicHash_AddData2(void* ptr, void* data);
 void QCryptographicHash_AddData(void* ptr, char* data, int length);
@@ -790,9 +840,13 @@ void QCryptographicHash_Reset(void* ptr);
 void QCryptographicHash_DestroyQCryptographicHash(void* ptr);
 void* QCryptographicHash_Result(void* ptr);
 void* QDataStream_NewQDataStream();
+void* QDataStream_NewQDataStreamInArena(void* arena);
 void* QDataStream_NewQDataStream3(void* a, long long mode);
+void* QDataStream_NewQDataStream3InArena(void* arena, void* a, long long mode);
 void* QDataStream_NewQDataStream2(void* d);
+void* QDataStream_NewQDataStream2InArena(void* arena, void* d);
 void* QDataStream_NewQDataStream4(void* a);
+void* QDataStream_NewQDataStream4InArena(void* arena, void* a);
 char QDataStream_CommitTransaction(void* ptr);
 int QDataStream_ReadRawData(void* ptr, char* s, int len);
 int QDataStream_SkipRawData(void* ptr, int len);
@@ -818,7 +872,9 @@ void* QDate_QDate_FromJulianDay(long long jd);
 void* QDate_QDate_FromString(char* stri, long long format);
 void* QDate_QDate_FromString2(char* stri, char* format);
 void* QDate_NewQDate();
+void* QDate_NewQDateInArena(void* arena);
 void* QDate_NewQDate3(int y, int m, int d);
+void* QDate_NewQDate3InArena(void* arena, int y, int m, int d);
 struct QtCore_PackedString QDate_QDate_LongDayName(int weekday, long long ty);
 struct QtCore_PackedString QDate_QDate_LongMonthName(int month, long long ty);
 struct QtCore_PackedString QDate_QDate_ShortDayName(int weekday, long long ty);
@@ -854,12 +910,19 @@ void* QDateTime_QDateTime_FromSecsSinceEpoch2(long long secs, void* timeZone);
 void* QDateTime_QDateTime_FromString(char* stri, long long format);
 void* QDateTime_QDateTime_FromString2(char* stri, char* format);
 void* QDateTime_NewQDateTime();
+void* QDateTime_NewQDateTimeInArena(void* arena);
 void* QDateTime_NewQDateTime7(void* other);
+void* QDateTime_NewQDateTime7InArena(void* arena, void* other);
 void* QDateTime_NewQDateTime2(void* date);
+void* QDateTime_NewQDateTime2InArena(void* arena, void* date);
 void* QDateTime_NewQDateTime3(void* date, void* time, long long spec);
+void* QDateTime_NewQDateTime3InArena(void* arena, void* date, void* time, long long spec);
 void* QDateTime_NewQDateTime4(void* date, void* time, long long spec, int offsetSeconds);
+void* QDateTime_NewQDateTime4InArena(void* arena, void* date, void* time, long long spec, int offsetSeconds);
 void* QDateTime_NewQDateTime5(void* date, void* time, void* timeZone);
+void* QDateTime_NewQDateTime5InArena(void* arena, void* date, void* time, void* timeZone);
 void* QDateTime_NewQDateTime6(void* other);
+void* QDateTime_NewQDateTime6InArena(void* arena, void* other);
 long long QDateTime_QDateTime_CurrentMSecsSinceEpoch();
 long long QDateTime_QDateTime_CurrentSecsSinceEpoch();
 void QDateTime_SetDate(void* ptr, void* date);
@@ -898,8 +961,11 @@ long long QDateTime_SecsTo(void* ptr, void* other);
 long long QDateTime_ToMSecsSinceEpoch(void* ptr);
 long long QDateTime_ToSecsSinceEpoch(void* ptr);
 void* QDeadlineTimer_NewQDeadlineTimer2(long long foreverConstant, long long timerType);
+void* QDeadlineTimer_NewQDeadlineTimer2InArena(void* arena, long long foreverConstant, long long timerType);
 void* QDeadlineTimer_NewQDeadlineTimer(long long timerType);
+void* QDeadlineTimer_NewQDeadlineTimerInArena(void* arena, long long timerType);
 void* QDeadlineTimer_NewQDeadlineTimer3(long long msecs, long long ty);
+void* QDeadlineTimer_NewQDeadlineTimer3InArena(void* arena, long long msecs, long long ty);
 void QDeadlineTimer_SetDeadline(void* ptr, long long msecs, long long timerType);
 void QDeadlineTimer_SetPreciseDeadline(void* ptr, long long secs, long long nsecs, long long timerType);
 void QDeadlineTimer_SetPreciseRemainingTime(void* ptr, long long secs, long long nsecs, long long timerType);
@@ -921,8 +987,11 @@ void* QDebug_Quote(void* ptr);
 void* QDebug_ResetFormat(void* ptr);
 void* QDebug_Space(void* ptr);
 void* QDebug_NewQDebug(void* device);
+void* QDebug_NewQDebugInArena(void* arena, void* device);
 void* QDebug_NewQDebug2(char* stri);
+void* QDebug_NewQDebug2InArena(void* arena, char* stri);
 void* QDebug_NewQDebug4(void* other);
+void* QDebug_NewQDebug4InArena(void* arena, void* other);
 void QDebug_SetAutoInsertSpaces(void* ptr, char b);
 void QDebug_SetVerbosity(void* ptr, int verbosityLevel);
 void QDebug_Swap(void* ptr, void* other);
@@ -930,6 +999,7 @@ void QDebug_DestroyQDebug(void* ptr);
 char QDebug_AutoInsertSpaces(void* ptr);
 int QDebug_Verbosity(void* ptr);
 void* QDebugStateSaver_NewQDebugStateSaver(void* dbg);
+void* QDebugStateSaver_NewQDebugStateSaverInArena(void* arena, void* dbg);
 void QDebugStateSaver_DestroyQDebugStateSaver(void* ptr);
 void* QDir_QDir_ListSeparator();
 void* QDir_QDir_Separator();
@@ -938,8 +1008,11 @@ void* QDir_QDir_Home();
 void* QDir_QDir_Root();
 void* QDir_QDir_Temp();
 void* QDir_NewQDir(void* dir);
+void* QDir_NewQDirInArena(void* arena, void* dir);
 void* QDir_NewQDir2(char* path);
+void* QDir_NewQDir2InArena(void* arena, char* path);
 void* QDir_NewQDir3(char* path, char* nameFilter, long long sort, long long filters);
+void* QDir_NewQDir3InArena(void* arena, char* path, char* nameFilter, long long sort, long long filters);
 struct QtCore_PackedList QDir_QDir_Drives();
 struct QtCore_PackedString QDir_QDir_CleanPath(char* path);
 struct QtCore_PackedString QDir_QDir_CurrentPath();
@@ -1006,8 +1079,11 @@ void* QDir___entryInfoList_newList(void* ptr);
 void* QDynamicPropertyChangeEvent_NewQDynamicPropertyChangeEvent(void* name);
 void* QDynamicPropertyChangeEvent_PropertyName(void* ptr);
 void* QEasingCurve_NewQEasingCurve3(void* other);
+void* QEasingCurve_NewQEasingCurve3InArena(void* arena, void* other);
 void* QEasingCurve_NewQEasingCurve(long long ty);
+void* QEasingCurve_NewQEasingCurveInArena(void* arena, long long ty);
 void* QEasingCurve_NewQEasingCurve2(void* other);
+void* QEasingCurve_NewQEasingCurve2InArena(void* arena, void* other);
 void QEasingCurve_AddCubicBezierSegment(void* ptr, void* c1, void* c2, void* endPoint);
 void QEasingCurve_AddTCBSegment(void* ptr, void* nextPoint, double t, double c, double b);
 void QEasingCurve_SetAmplitude(void* ptr, double amplitude);
@@ -1025,11 +1101,16 @@ double QEasingCurve_ValueForProgress(void* ptr, double progress);
 void* QEasingCurve___cubicBezierSpline_atList(void* ptr, int i);
 void QEasingCurve___cubicBezierSpline_setList(void* ptr, void* i);
 void* QEasingCurve___cubicBezierSpline_newList(void* ptr);
+void* QEasingCurve___cubicBezierSpline_newListBuffer(void* ptr, void* data, int count);
+void QEasingCurve___cubicBezierSpline_fillList(void* ptr, void* data);
 void* QEasingCurve___toCubicSpline_atList(void* ptr, int i);
 void QEasingCurve___toCubicSpline_setList(void* ptr, void* i);
 void* QEasingCurve___toCubicSpline_newList(void* ptr);
+void* QEasingCurve___toCubicSpline_newListBuffer(void* ptr, void* data, int count);
+void QEasingCurve___toCubicSpline_fillList(void* ptr, void* data);
 long long QElapsedTimer_QElapsedTimer_ClockType();
 void* QElapsedTimer_NewQElapsedTimer();
+void* QElapsedTimer_NewQElapsedTimerInArena(void* arena);
 char QElapsedTimer_QElapsedTimer_IsMonotonic();
 long long QElapsedTimer_Restart(void* ptr);
 void QElapsedTimer_Invalidate(void* ptr);
@@ -1064,8 +1145,11 @@ void QEventLoop_WakeUp(void* ptr);
 void QEventLoop_DestroyQEventLoop(void* ptr);
 char QEventLoop_IsRunning(void* ptr);
 void* QEventLoopLocker_NewQEventLoopLocker();
+void* QEventLoopLocker_NewQEventLoopLockerInArena(void* arena);
 void* QEventLoopLocker_NewQEventLoopLocker2(void* loop);
+void* QEventLoopLocker_NewQEventLoopLocker2InArena(void* arena, void* loop);
 void* QEventLoopLocker_NewQEventLoopLocker3(void* thread);
+void* QEventLoopLocker_NewQEventLoopLocker3InArena(void* arena, void* thread);
 void QEventLoopLocker_DestroyQEventLoopLocker(void* ptr);
 void* QEventTransition_NewQEventTransition2(void* object, long long ty, void* sourceState);
 void* QEventTransition_NewQEventTransition(void* sourceState);
@@ -1123,10 +1207,15 @@ struct QtCore_PackedString QFileDevice_FileName(void* ptr);
 struct QtCore_PackedString QFileDevice_FileNameDefault(void* ptr);
 int QFileDevice_Handle(void* ptr);
 void* QFileInfo_NewQFileInfo();
+void* QFileInfo_NewQFileInfoInArena(void* arena);
 void* QFileInfo_NewQFileInfo5(void* dir, char* file);
+void* QFileInfo_NewQFileInfo5InArena(void* arena, void* dir, char* file);
 void* QFileInfo_NewQFileInfo4(void* file);
+void* QFileInfo_NewQFileInfo4InArena(void* arena, void* file);
 void* QFileInfo_NewQFileInfo6(void* fileinfo);
+void* QFileInfo_NewQFileInfo6InArena(void* arena, void* fileinfo);
 void* QFileInfo_NewQFileInfo3(char* file);
+void* QFileInfo_NewQFileInfo3InArena(void* arena, char* file);
 char QFileInfo_QFileInfo_Exists2(char* file);
 char QFileInfo_MakeAbsolute(void* ptr);
 void QFileInfo_Refresh(void* ptr);
@@ -1200,13 +1289,19 @@ void QFinalState_OnExit(void* ptr, void* event);
 void QFinalState_OnExitDefault(void* ptr, void* event);
 void QFinalState_DestroyQFinalState(void* ptr);
 void* QFlag_NewQFlag(int value);
+void* QFlag_NewQFlagInArena(void* arena, int value);
 void* QFlag_NewQFlag3(short value);
+void* QFlag_NewQFlag3InArena(void* arena, short value);
 void* QFlag_NewQFlag2(unsigned int value);
+void* QFlag_NewQFlag2InArena(void* arena, unsigned int value);
 void* QFlag_NewQFlag4(unsigned short value);
+void* QFlag_NewQFlag4InArena(void* arena, unsigned short value);
 void* QGenericArgument_NewQGenericArgument(char* name, void* data);
+void* QGenericArgument_NewQGenericArgumentInArena(void* arena, char* name, void* data);
 struct QtCore_PackedString QGenericArgument_Name(void* ptr);
 void* QGenericArgument_Data(void* ptr);
 void* QGenericReturnArgument_NewQGenericReturnArgument(char* name, void* data);
+void* QGenericReturnArgument_NewQGenericReturnArgumentInArena(void* arena, char* name, void* data);
 void* QHistoryState_NewQHistoryState2(long long ty, void* parent);
 void* QHistoryState_NewQHistoryState(void* parent);
 void QHistoryState_ConnectDefaultStateChanged(void* ptr);
@@ -1325,7 +1420,9 @@ int QIdentityProxyModel_ColumnCountDefault(void* ptr, void* parent);
 int QIdentityProxyModel_RowCount(void* ptr, void* parent);
 int QIdentityProxyModel_RowCountDefault(void* ptr, void* parent);
 void* QItemSelection_NewQItemSelection();
+void* QItemSelection_NewQItemSelectionInArena(void* arena);
 void* QItemSelection_NewQItemSelection2(void* topLeft, void* bottomRight);
+void* QItemSelection_NewQItemSelection2InArena(void* arena, void* topLeft, void* bottomRight);
 void QItemSelection_Merge(void* ptr, void* other, long long command);
 void QItemSelection_Select(void* ptr, void* topLeft, void* bottomRight);
 void QItemSelection_QItemSelection_Split(void* ran, void* other, void* result);
@@ -1392,10 +1489,15 @@ void* QItemSelectionModel___selectedRows_atList(void* ptr, int i);
 void QItemSelectionModel___selectedRows_setList(void* ptr, void* i);
 void* QItemSelectionModel___selectedRows_newList(void* ptr);
 void* QItemSelectionRange_NewQItemSelectionRange();
+void* QItemSelectionRange_NewQItemSelectionRangeInArena(void* arena);
 void* QItemSelectionRange_NewQItemSelectionRange3(void* other);
+void* QItemSelectionRange_NewQItemSelectionRange3InArena(void* arena, void* other);
 void* QItemSelectionRange_NewQItemSelectionRange2(void* other);
+void* QItemSelectionRange_NewQItemSelectionRange2InArena(void* arena, void* other);
 void* QItemSelectionRange_NewQItemSelectionRange5(void* index);
+void* QItemSelectionRange_NewQItemSelectionRange5InArena(void* arena, void* index);
 void* QItemSelectionRange_NewQItemSelectionRange4(void* topLeft, void* bottomRight);
+void* QItemSelectionRange_NewQItemSelectionRange4InArena(void* arena, void* topLeft, void* bottomRight);
 void QItemSelectionRange_Swap(void* ptr, void* other);
 void* QItemSelectionRange_Intersected(void* ptr, void* other);
 void* QItemSelectionRange_Parent(void* ptr);
@@ -1420,7 +1522,9 @@ void* QItemSelectionRange___indexes_newList(void* ptr);
 void* QJsonArray_QJsonArray_FromStringList(char* list);
 void* QJsonArray_QJsonArray_FromVariantList(void* list);
 void* QJsonArray_NewQJsonArray();
+void* QJsonArray_NewQJsonArrayInArena(void* arena);
 void* QJsonArray_NewQJsonArray3(void* other);
+void* QJsonArray_NewQJsonArray3InArena(void* arena, void* other);
 void* QJsonArray_TakeAt(void* ptr, int i);
 void QJsonArray_Append(void* ptr, void* value);
 void QJsonArray_Insert(void* ptr, int i, void* value);
@@ -1454,9 +1558,13 @@ void* QJsonDocument_QJsonDocument_FromJson(void* json, void* error);
 void* QJsonDocument_QJsonDocument_FromRawData(char* data, int size, long long validation);
 void* QJsonDocument_QJsonDocument_FromVariant(void* variant);
 void* QJsonDocument_NewQJsonDocument();
+void* QJsonDocument_NewQJsonDocumentInArena(void* arena);
 void* QJsonDocument_NewQJsonDocument3(void* array);
+void* QJsonDocument_NewQJsonDocument3InArena(void* arena, void* array);
 void* QJsonDocument_NewQJsonDocument4(void* other);
+void* QJsonDocument_NewQJsonDocument4InArena(void* arena, void* other);
 void* QJsonDocument_NewQJsonDocument2(void* object);
+void* QJsonDocument_NewQJsonDocument2InArena(void* arena, void* object);
 void QJsonDocument_SetArray(void* ptr, void* array);
 void QJsonDocument_SetObject(void* ptr, void* object);
 void QJsonDocument_DestroyQJsonDocument(void* ptr);
@@ -1472,7 +1580,9 @@ char QJsonDocument_IsObject(void* ptr);
 struct QtCore_PackedString QJsonDocument_RawData(void* ptr, int size);
 void* QJsonObject_QJsonObject_FromVariantHash(void* hash);
 void* QJsonObject_NewQJsonObject();
+void* QJsonObject_NewQJsonObjectInArena(void* arena);
 void* QJsonObject_NewQJsonObject3(void* other);
+void* QJsonObject_NewQJsonObject3InArena(void* arena, void* other);
 void* QJsonObject_Take(void* ptr, char* key);
 void QJsonObject_Remove(void* ptr, char* key);
 void QJsonObject_DestroyQJsonObject(void* ptr);
@@ -1519,16 +1629,27 @@ int QJsonParseError_Offset(void* ptr);
 void QJsonParseError_SetOffset(void* ptr, int vin);
 void* QJsonValue_QJsonValue_FromVariant(void* variant);
 void* QJsonValue_NewQJsonValue7(void* s);
+void* QJsonValue_NewQJsonValue7InArena(void* arena, void* s);
 void* QJsonValue_NewQJsonValue(long long ty);
+void* QJsonValue_NewQJsonValueInArena(void* arena, long long ty);
 void* QJsonValue_NewQJsonValue2(char b);
+void* QJsonValue_NewQJsonValue2InArena(void* arena, char b);
 void* QJsonValue_NewQJsonValue9(void* a);
+void* QJsonValue_NewQJsonValue9InArena(void* arena, void* a);
 void* QJsonValue_NewQJsonValue10(void* o);
+void* QJsonValue_NewQJsonValue10InArena(void* arena, void* o);
 void* QJsonValue_NewQJsonValue11(void* other);
+void* QJsonValue_NewQJsonValue11InArena(void* arena, void* other);
 void* QJsonValue_NewQJsonValue6(char* s);
+void* QJsonValue_NewQJsonValue6InArena(void* arena, char* s);
 void* QJsonValue_NewQJsonValue8(char* s);
+void* QJsonValue_NewQJsonValue8InArena(void* arena, char* s);
 void* QJsonValue_NewQJsonValue3(double n);
+void* QJsonValue_NewQJsonValue3InArena(void* arena, double n);
 void* QJsonValue_NewQJsonValue4(int n);
+void* QJsonValue_NewQJsonValue4InArena(void* arena, int n);
 void* QJsonValue_NewQJsonValue5(long long n);
+void* QJsonValue_NewQJsonValue5InArena(void* arena, long long n);
 void QJsonValue_DestroyQJsonValue(void* ptr);
 void* QJsonValue_ToArray2(void* ptr);
 void* QJsonValue_ToArray(void* ptr, void* defaultValue);
@@ -1549,12 +1670,17 @@ char QJsonValue_ToBool(void* ptr, char defaultValue);
 double QJsonValue_ToDouble(void* ptr, double defaultValue);
 int QJsonValue_ToInt(void* ptr, int defaultValue);
 void* QLatin1Char_NewQLatin1Char(char* c);
+void* QLatin1Char_NewQLatin1CharInArena(void* arena, char* c);
 struct QtCore_PackedString QLatin1Char_ToLatin1(void* ptr);
 unsigned short QLatin1Char_Unicode(void* ptr);
 void* QLatin1String_NewQLatin1String();
+void* QLatin1String_NewQLatin1StringInArena(void* arena);
 void* QLatin1String_NewQLatin1String4(void* str);
+void* QLatin1String_NewQLatin1String4InArena(void* arena, void* str);
 void* QLatin1String_NewQLatin1String2(char* str);
+void* QLatin1String_NewQLatin1String2InArena(void* arena, char* str);
 void* QLatin1String_NewQLatin1String3(char* str, int size);
+void* QLatin1String_NewQLatin1String3InArena(void* arena, char* str, int size);
 void* QLatin1String_Left(void* ptr, int length);
 void* QLatin1String_Mid(void* ptr, int start);
 void* QLatin1String_Mid2(void* ptr, int start, int length);
@@ -1582,8 +1708,11 @@ struct QtCore_PackedString QLibraryInfo_QLibraryInfo_Location(long long loc);
 void* QLibraryInfo_QLibraryInfo_Version();
 char QLibraryInfo_QLibraryInfo_IsDebugBuild();
 void* QLine_NewQLine();
+void* QLine_NewQLineInArena(void* arena);
 void* QLine_NewQLine2(void* p1, void* p2);
+void* QLine_NewQLine2InArena(void* arena, void* p1, void* p2);
 void* QLine_NewQLine3(int x1, int y1, int x2, int y2);
+void* QLine_NewQLine3InArena(void* arena, int x1, int y1, int x2, int y2);
 void QLine_SetLine(void* ptr, int x1, int y1, int x2, int y2);
 void QLine_SetP1(void* ptr, void* p1);
 void QLine_SetP2(void* ptr, void* p2);
@@ -1606,9 +1735,13 @@ void QLineF_SetLength(void* ptr, double length);
 long long QLineF_Intersect(void* ptr, void* line, void* intersectionPoint);
 void* QLineF_QLineF_FromPolar(double length, double angle);
 void* QLineF_NewQLineF();
+void* QLineF_NewQLineFInArena(void* arena);
 void* QLineF_NewQLineF4(void* line);
+void* QLineF_NewQLineF4InArena(void* arena, void* line);
 void* QLineF_NewQLineF2(void* p1, void* p2);
+void* QLineF_NewQLineF2InArena(void* arena, void* p1, void* p2);
 void* QLineF_NewQLineF3(double x1, double y1, double x2, double y2);
+void* QLineF_NewQLineF3InArena(void* arena, double x1, double y1, double x2, double y2);
 void QLineF_SetAngle(void* ptr, double angle);
 void QLineF_SetLine(void* ptr, double x1, double y1, double x2, double y2);
 void QLineF_SetP1(void* ptr, void* p1);
@@ -1639,10 +1772,15 @@ struct QtCore_PackedList QLocale_QLocale_MatchingLocales(long long language, lon
 void* QLocale_QLocale_C();
 void* QLocale_QLocale_System();
 void* QLocale_NewQLocale();
+void* QLocale_NewQLocaleInArena(void* arena);
 void* QLocale_NewQLocale3(long long language, long long country);
+void* QLocale_NewQLocale3InArena(void* arena, long long language, long long country);
 void* QLocale_NewQLocale4(long long language, long long script, long long country);
+void* QLocale_NewQLocale4InArena(void* arena, long long language, long long script, long long country);
 void* QLocale_NewQLocale5(void* other);
+void* QLocale_NewQLocale5InArena(void* arena, void* other);
 void* QLocale_NewQLocale2(char* name);
+void* QLocale_NewQLocale2InArena(void* arena, char* name);
 struct QtCore_PackedString QLocale_QLocale_CountryToString(long long country);
 struct QtCore_PackedString QLocale_QLocale_LanguageToString(long long language);
 struct QtCore_PackedString QLocale_QLocale_ScriptToString(long long script);
@@ -1738,6 +1876,7 @@ long long QLocale___weekdays_atList(void* ptr, int i);
 void QLocale___weekdays_setList(void* ptr, long long i);
 void* QLocale___weekdays_newList(void* ptr);
 void* QLockFile_NewQLockFile(char* fileName);
+void* QLockFile_NewQLockFileInArena(void* arena, char* fileName);
 char QLockFile_Lock(void* ptr);
 char QLockFile_RemoveStaleLockFile(void* ptr);
 char QLockFile_TryLock(void* ptr, int timeout);
@@ -1750,6 +1889,7 @@ char QLockFile_IsLocked(void* ptr);
 int QLockFile_StaleLockTime(void* ptr);
 void* QLoggingCategory_QLoggingCategory_DefaultCategory();
 void* QLoggingCategory_NewQLoggingCategory(char* category);
+void* QLoggingCategory_NewQLoggingCategoryInArena(void* arena, char* category);
 void QLoggingCategory_QLoggingCategory_SetFilterRules(char* rules);
 void QLoggingCategory_DestroyQLoggingCategory(void* ptr);
 char QLoggingCategory_IsCriticalEnabled(void* ptr);
@@ -1758,7 +1898,9 @@ char QLoggingCategory_IsInfoEnabled(void* ptr);
 char QLoggingCategory_IsWarningEnabled(void* ptr);
 struct QtCore_PackedString QLoggingCategory_CategoryName(void* ptr);
 void* QMargins_NewQMargins();
+void* QMargins_NewQMarginsInArena(void* arena);
 void* QMargins_NewQMargins2(int left, int top, int right, int bottom);
+void* QMargins_NewQMargins2InArena(void* arena, int left, int top, int right, int bottom);
 void QMargins_SetBottom(void* ptr, int bottom);
 void QMargins_SetLeft(void* ptr, int left);
 void QMargins_SetRight(void* ptr, int right);
@@ -1769,8 +1911,11 @@ int QMargins_Left(void* ptr);
 int QMargins_Right(void* ptr);
 int QMargins_Top(void* ptr);
 void* QMarginsF_NewQMarginsF();
+void* QMarginsF_NewQMarginsFInArena(void* arena);
 void* QMarginsF_NewQMarginsF3(void* margins);
+void* QMarginsF_NewQMarginsF3InArena(void* arena, void* margins);
 void* QMarginsF_NewQMarginsF2(double left, double top, double right, double bottom);
+void* QMarginsF_NewQMarginsF2InArena(void* arena, double left, double top, double right, double bottom);
 void QMarginsF_SetBottom(void* ptr, double bottom);
 void QMarginsF_SetLeft(void* ptr, double left);
 void QMarginsF_SetRight(void* ptr, double right);
@@ -1783,6 +1928,7 @@ double QMarginsF_Right(void* ptr);
 double QMarginsF_Top(void* ptr);
 void* QMessageAuthenticationCode_QMessageAuthenticationCode_Hash(void* message, void* key, long long method);
 void* QMessageAuthenticationCode_NewQMessageAuthenticationCode(long long method, void* key);
+void* QMessageAuthenticationCode_NewQMessageAuthenticationCodeInArena(void* arena, long long method, void* key);
 char QMessageAuthenticationCode_AddData3(void* ptr, void* device);
 void QMessageAuthenticationCode_AddData2(void* ptr, void* data);
 void QMessageAuthenticationCode_AddData(void* ptr, char* data, int length);
@@ -1798,8 +1944,11 @@ void QMessageLogContext_SetLine(void* ptr, int vin);
 int QMessageLogContext_Version(void* ptr);
 void QMessageLogContext_SetVersion(void* ptr, int vin);
 void* QMessageLogger_NewQMessageLogger();
+void* QMessageLogger_NewQMessageLoggerInArena(void* arena);
 void* QMessageLogger_NewQMessageLogger2(char* file, int line, char* function);
+void* QMessageLogger_NewQMessageLogger2InArena(void* arena, char* file, int line, char* function);
 void* QMessageLogger_NewQMessageLogger3(char* file, int line, char* function, char* category);
+void* QMessageLogger_NewQMessageLogger3InArena(void* arena, char* file, int line, char* function, char* category);
 void* QMessageLogger_Critical4(void* ptr);
 void* QMessageLogger_Critical5(void* ptr, void* cat);
 void* QMessageLogger_Debug4(void* ptr);
@@ -1826,8 +1975,8 @@ long long QMetaMethod_Access(void* ptr);
 long long QMetaMethod_MethodType(void* ptr);
 void* QMetaMethod_MethodSignature(void* ptr);
 void* QMetaMethod_Name(void* ptr);
-struct QtCore_PackedList QMetaMethod_ParameterNames(void* ptr);
-struct QtCore_PackedList QMetaMethod_ParameterTypes(void* ptr);
+struct QtCore_PackedString QMetaMethod_ParameterNames(void* ptr);
+struct QtCore_PackedString QMetaMethod_ParameterTypes(void* ptr);
 char QMetaMethod_Invoke4(void* ptr, void* object, void* val0, void* val1, void* val2, void* val3, void* val4, void* val5, void* val6, void* val7, void* val8, void* val9);
 char QMetaMethod_Invoke2(void* ptr, void* object, void* returnValue, void* val0, void* val1, void* val2, void* val3, void* val4, void* val5, void* val6, void* val7, void* val8, void* val9);
 char QMetaMethod_Invoke3(void* ptr, void* object, long long connectionType, void* val0, void* val1, void* val2, void* val3, void* val4, void* val5, void* val6, void* val7, void* val8, void* val9);
@@ -1906,6 +2055,7 @@ int QMetaProperty_PropertyIndex(void* ptr);
 int QMetaProperty_Revision(void* ptr);
 int QMetaProperty_UserType(void* ptr);
 void* QMetaType_NewQMetaType(int typeId);
+void* QMetaType_NewQMetaTypeInArena(void* arena, int typeId);
 long long QMetaType_QMetaType_TypeFlags(int ty);
 char QMetaType_QMetaType_Compare(void* lhs, void* rhs, int typeId, int result);
 char QMetaType_QMetaType_Convert(void* from, int fromTypeId, void* to, int toTypeId);
@@ -1963,6 +2113,7 @@ void* QMimeData___urls_atList(void* ptr, int i);
 void QMimeData___urls_setList(void* ptr, void* i);
 void* QMimeData___urls_newList(void* ptr);
 void* QMimeDatabase_NewQMimeDatabase();
+void* QMimeDatabase_NewQMimeDatabaseInArena(void* arena);
 void QMimeDatabase_DestroyQMimeDatabase(void* ptr);
 void* QMimeDatabase_MimeTypeForName(void* ptr, char* nameOrAlias);
 struct QtCore_PackedList QMimeDatabase_AllMimeTypes(void* ptr);
@@ -1982,7 +2133,9 @@ void* QMimeDatabase___mimeTypesForFileName_atList(void* ptr, int i);
 void QMimeDatabase___mimeTypesForFileName_setList(void* ptr, void* i);
 void* QMimeDatabase___mimeTypesForFileName_newList(void* ptr);
 void* QMimeType_NewQMimeType();
+void* QMimeType_NewQMimeTypeInArena(void* arena);
 void* QMimeType_NewQMimeType2(void* other);
+void* QMimeType_NewQMimeType2InArena(void* arena, void* other);
 void QMimeType_Swap(void* ptr, void* other);
 void QMimeType_DestroyQMimeType(void* ptr);
 struct QtCore_PackedString QMimeType_Comment(void* ptr);
@@ -2000,6 +2153,7 @@ char QMimeType_Inherits(void* ptr, char* mimeTypeName);
 char QMimeType_IsDefault(void* ptr);
 char QMimeType_IsValid(void* ptr);
 void* QModelIndex_NewQModelIndex();
+void* QModelIndex_NewQModelIndexInArena(void* arena);
 void* QModelIndex_Parent(void* ptr);
 void* QModelIndex_Sibling(void* ptr, int row, int column);
 void* QModelIndex_Data(void* ptr, int role);
@@ -2013,10 +2167,12 @@ void* QModelIndex_InternalPointer(void* ptr);
 char QMutex_TryLock(void* ptr, int timeout);
 void QMutex_Lock(void* ptr);
 void* QMutex_NewQMutex(long long mode);
+void* QMutex_NewQMutexInArena(void* arena, long long mode);
 char QMutex_Try_lock(void* ptr);
 void QMutex_Unlock(void* ptr);
 char QMutex_IsRecursive(void* ptr);
 void* QMutexLocker_NewQMutexLocker(void* mutex);
+void* QMutexLocker_NewQMutexLockerInArena(void* arena, void* mutex);
 void QMutexLocker_Relock(void* ptr);
 void QMutexLocker_Unlock(void* ptr);
 void QMutexLocker_DestroyQMutexLocker(void* ptr);
@@ -2059,7 +2215,7 @@ void QObject_TimerEvent(void* ptr, void* event);
 void QObject_TimerEventDefault(void* ptr, void* event);
 void QObject_DestroyQObject(void* ptr);
 void QObject_DestroyQObjectDefault(void* ptr);
-struct QtCore_PackedList QObject_DynamicPropertyNames(void* ptr);
+struct QtCore_PackedString QObject_DynamicPropertyNames(void* ptr);
 struct QtCore_PackedList QObject_FindChildren2(void* ptr, void* regExp, long long options);
 struct QtCore_PackedList QObject_FindChildren3(void* ptr, void* re, long long options);
 struct QtCore_PackedList QObject_FindChildren(void* ptr, char* name, long long options);
@@ -2118,8 +2274,11 @@ void QPauseAnimation_DestroyQPauseAnimation(void* ptr);
 int QPauseAnimation_Duration(void* ptr);
 int QPauseAnimation_DurationDefault(void* ptr);
 void* QPersistentModelIndex_NewQPersistentModelIndex4(void* other);
+void* QPersistentModelIndex_NewQPersistentModelIndex4InArena(void* arena, void* other);
 void* QPersistentModelIndex_NewQPersistentModelIndex(void* index);
+void* QPersistentModelIndex_NewQPersistentModelIndexInArena(void* arena, void* index);
 void* QPersistentModelIndex_NewQPersistentModelIndex3(void* other);
+void* QPersistentModelIndex_NewQPersistentModelIndex3InArena(void* arena, void* other);
 void QPersistentModelIndex_Swap(void* ptr, void* other);
 void* QPersistentModelIndex_Parent(void* ptr);
 void* QPersistentModelIndex_Sibling(void* ptr, int row, int column);
@@ -2149,7 +2308,9 @@ void* QPluginLoader___staticInstances_newList(void* ptr);
 void QPluginLoader___staticPlugins_setList(void* ptr, void* i);
 void* QPluginLoader___staticPlugins_newList(void* ptr);
 void* QPoint_NewQPoint();
+void* QPoint_NewQPointInArena(void* arena);
 void* QPoint_NewQPoint2(int xpos, int ypos);
+void* QPoint_NewQPoint2InArena(void* arena, int xpos, int ypos);
 int QPoint_Rx(void* ptr);
 int QPoint_Ry(void* ptr);
 int QPoint_QPoint_DotProduct(void* p1, void* p2);
@@ -2160,8 +2321,11 @@ int QPoint_ManhattanLength(void* ptr);
 int QPoint_X(void* ptr);
 int QPoint_Y(void* ptr);
 void* QPointF_NewQPointF();
+void* QPointF_NewQPointFInArena(void* arena);
 void* QPointF_NewQPointF2(void* point);
+void* QPointF_NewQPointF2InArena(void* arena, void* point);
 void* QPointF_NewQPointF3(double xpos, double ypos);
+void* QPointF_NewQPointF3InArena(void* arena, double xpos, double ypos);
 double QPointF_Rx(void* ptr);
 double QPointF_Ry(void* ptr);
 double QPointF_QPointF_DotProduct(void* p1, void* p2);
@@ -2180,11 +2344,13 @@ void QPropertyAnimation_DestroyQPropertyAnimation(void* ptr);
 void* QPropertyAnimation_PropertyName(void* ptr);
 void* QPropertyAnimation_TargetObject(void* ptr);
 void* QReadLocker_NewQReadLocker(void* lock);
+void* QReadLocker_NewQReadLockerInArena(void* arena, void* lock);
 void QReadLocker_Relock(void* ptr);
 void QReadLocker_Unlock(void* ptr);
 void QReadLocker_DestroyQReadLocker(void* ptr);
 void* QReadLocker_ReadWriteLock(void* ptr);
 void* QReadWriteLock_NewQReadWriteLock(long long recursionMode);
+void* QReadWriteLock_NewQReadWriteLockInArena(void* arena, long long recursionMode);
 char QReadWriteLock_TryLockForRead(void* ptr);
 char QReadWriteLock_TryLockForRead2(void* ptr, int timeout);
 char QReadWriteLock_TryLockForWrite(void* ptr);
@@ -2194,9 +2360,13 @@ void QReadWriteLock_LockForWrite(void* ptr);
 void QReadWriteLock_Unlock(void* ptr);
 void QReadWriteLock_DestroyQReadWriteLock(void* ptr);
 void* QRect_NewQRect();
+void* QRect_NewQRectInArena(void* arena);
 void* QRect_NewQRect2(void* topLeft, void* bottomRight);
+void* QRect_NewQRect2InArena(void* arena, void* topLeft, void* bottomRight);
 void* QRect_NewQRect3(void* topLeft, void* size);
+void* QRect_NewQRect3InArena(void* arena, void* topLeft, void* size);
 void* QRect_NewQRect4(int x, int y, int width, int height);
+void* QRect_NewQRect4InArena(void* arena, int x, int y, int width, int height);
 void QRect_Adjust(void* ptr, int dx1, int dy1, int dx2, int dy2);
 void QRect_MoveBottom(void* ptr, int y);
 void QRect_MoveBottomLeft(void* ptr, void* position);
@@ -2260,10 +2430,15 @@ int QRect_Y(void* ptr);
 void QRect_GetCoords(void* ptr, int x1, int y1, int x2, int y2);
 void QRect_GetRect(void* ptr, int x, int y, int width, int height);
 void* QRectF_NewQRectF();
+void* QRectF_NewQRectFInArena(void* arena);
 void* QRectF_NewQRectF3(void* topLeft, void* bottomRight);
+void* QRectF_NewQRectF3InArena(void* arena, void* topLeft, void* bottomRight);
 void* QRectF_NewQRectF2(void* topLeft, void* size);
+void* QRectF_NewQRectF2InArena(void* arena, void* topLeft, void* size);
 void* QRectF_NewQRectF5(void* rectangle);
+void* QRectF_NewQRectF5InArena(void* arena, void* rectangle);
 void* QRectF_NewQRectF4(double x, double y, double width, double height);
+void* QRectF_NewQRectF4InArena(void* arena, double x, double y, double width, double height);
 void QRectF_Adjust(void* ptr, double dx1, double dy1, double dx2, double dy2);
 void QRectF_MoveBottom(void* ptr, double y);
 void QRectF_MoveBottomLeft(void* ptr, void* position);
@@ -2328,8 +2503,11 @@ double QRectF_Y(void* ptr);
 void QRectF_GetCoords(void* ptr, double x1, double y1, double x2, double y2);
 void QRectF_GetRect(void* ptr, double x, double y, double width, double height);
 void* QRegExp_NewQRegExp();
+void* QRegExp_NewQRegExpInArena(void* arena);
 void* QRegExp_NewQRegExp3(void* rx);
+void* QRegExp_NewQRegExp3InArena(void* arena, void* rx);
 void* QRegExp_NewQRegExp2(char* pattern, long long cs, long long syntax);
+void* QRegExp_NewQRegExp2InArena(void* arena, char* pattern, long long cs, long long syntax);
 struct QtCore_PackedString QRegExp_QRegExp_Escape(char* str);
 void QRegExp_SetCaseSensitivity(void* ptr, long long cs);
 void QRegExp_SetMinimal(void* ptr, char minimal);
@@ -2353,8 +2531,11 @@ int QRegExp_LastIndexIn(void* ptr, char* str, int offset, long long caretMode);
 int QRegExp_MatchedLength(void* ptr);
 int QRegExp_Pos(void* ptr, int nth);
 void* QRegularExpression_NewQRegularExpression();
+void* QRegularExpression_NewQRegularExpressionInArena(void* arena);
 void* QRegularExpression_NewQRegularExpression3(void* re);
+void* QRegularExpression_NewQRegularExpression3InArena(void* arena, void* re);
 void* QRegularExpression_NewQRegularExpression2(char* pattern, long long options);
+void* QRegularExpression_NewQRegularExpression2InArena(void* arena, char* pattern, long long options);
 struct QtCore_PackedString QRegularExpression_QRegularExpression_Escape(char* str);
 void QRegularExpression_SetPattern(void* ptr, char* pattern);
 void QRegularExpression_SetPatternOptions(void* ptr, long long options);
@@ -2373,7 +2554,9 @@ int QRegularExpression_CaptureCount(void* ptr);
 int QRegularExpression_PatternErrorOffset(void* ptr);
 void QRegularExpression_Optimize(void* ptr);
 void* QRegularExpressionMatch_NewQRegularExpressionMatch();
+void* QRegularExpressionMatch_NewQRegularExpressionMatchInArena(void* arena);
 void* QRegularExpressionMatch_NewQRegularExpressionMatch2(void* match);
+void* QRegularExpressionMatch_NewQRegularExpressionMatch2InArena(void* arena, void* match);
 void QRegularExpressionMatch_Swap(void* ptr, void* other);
 void QRegularExpressionMatch_DestroyQRegularExpressionMatch(void* ptr);
 void* QRegularExpressionMatch_RegularExpression(void* ptr);
@@ -2395,6 +2578,7 @@ int QRegularExpressionMatch_CapturedStart2(void* ptr, char* name);
 int QRegularExpressionMatch_CapturedStart(void* ptr, int nth);
 int QRegularExpressionMatch_LastCapturedIndex(void* ptr);
 void* QResource_NewQResource(char* file, void* locale);
+void* QResource_NewQResourceInArena(void* arena, char* file, void* locale);
 char QResource_QResource_RegisterResource(char* rccFileName, char* mapRoot);
 char QResource_QResource_RegisterResource2(char* rccData, char* mapRoot);
 char QResource_QResource_UnregisterResource(char* rccFileName, char* mapRoot);
@@ -2429,6 +2613,7 @@ void QSaveFile_SetFileName(void* ptr, char* name);
 void QSaveFile_DestroyQSaveFile(void* ptr);
 char QSaveFile_DirectWriteFallback(void* ptr);
 void* QSemaphore_NewQSemaphore(int n);
+void* QSemaphore_NewQSemaphoreInArena(void* arena, int n);
 char QSemaphore_TryAcquire(void* ptr, int n);
 char QSemaphore_TryAcquire2(void* ptr, int n, int timeout);
 void QSemaphore_Acquire(void* ptr, int n);
@@ -2488,7 +2673,9 @@ char QSettings_Contains(void* ptr, char* key);
 char QSettings_FallbacksEnabled(void* ptr);
 char QSettings_IsWritable(void* ptr);
 void* QSharedData_NewQSharedData();
+void* QSharedData_NewQSharedDataInArena(void* arena);
 void* QSharedData_NewQSharedData2(void* other);
+void* QSharedData_NewQSharedData2InArena(void* arena, void* other);
 void* QSharedMemory_NewQSharedMemory2(void* parent);
 void* QSharedMemory_NewQSharedMemory(char* key, void* parent);
 char QSharedMemory_Attach(void* ptr, long long mode);
@@ -2509,7 +2696,9 @@ void* QSharedMemory_ConstData(void* ptr);
 void* QSharedMemory_Data2(void* ptr);
 int QSharedMemory_Size(void* ptr);
 void* QSignalBlocker_NewQSignalBlocker2(void* object);
+void* QSignalBlocker_NewQSignalBlocker2InArena(void* arena, void* object);
 void* QSignalBlocker_NewQSignalBlocker(void* object);
+void* QSignalBlocker_NewQSignalBlockerInArena(void* arena, void* object);
 void QSignalBlocker_Reblock(void* ptr);
 void QSignalBlocker_Unblock(void* ptr);
 void QSignalBlocker_DestroyQSignalBlocker(void* ptr);
@@ -2556,7 +2745,9 @@ void QSignalTransition_DestroyQSignalTransition(void* ptr);
 void* QSignalTransition_Signal(void* ptr);
 void* QSignalTransition_SenderObject(void* ptr);
 void* QSize_NewQSize();
+void* QSize_NewQSizeInArena(void* arena);
 void* QSize_NewQSize2(int width, int height);
+void* QSize_NewQSize2InArena(void* arena, int width, int height);
 int QSize_Rheight(void* ptr);
 int QSize_Rwidth(void* ptr);
 void QSize_Scale2(void* ptr, void* size, long long mode);
@@ -2575,8 +2766,11 @@ char QSize_IsValid(void* ptr);
 int QSize_Height(void* ptr);
 int QSize_Width(void* ptr);
 void* QSizeF_NewQSizeF();
+void* QSizeF_NewQSizeFInArena(void* arena);
 void* QSizeF_NewQSizeF2(void* size);
+void* QSizeF_NewQSizeF2InArena(void* arena, void* size);
 void* QSizeF_NewQSizeF3(double width, double height);
+void* QSizeF_NewQSizeF3InArena(void* arena, double width, double height);
 double QSizeF_Rheight(void* ptr);
 double QSizeF_Rwidth(void* ptr);
 void QSizeF_Scale2(void* ptr, void* size, long long mode);
@@ -2729,9 +2923,13 @@ void* QStaticPlugin_MetaData(void* ptr);
 struct QtCore_PackedList QStorageInfo_QStorageInfo_MountedVolumes();
 void* QStorageInfo_QStorageInfo_Root();
 void* QStorageInfo_NewQStorageInfo();
+void* QStorageInfo_NewQStorageInfoInArena(void* arena);
 void* QStorageInfo_NewQStorageInfo3(void* dir);
+void* QStorageInfo_NewQStorageInfo3InArena(void* arena, void* dir);
 void* QStorageInfo_NewQStorageInfo4(void* other);
+void* QStorageInfo_NewQStorageInfo4InArena(void* arena, void* other);
 void* QStorageInfo_NewQStorageInfo2(char* path);
+void* QStorageInfo_NewQStorageInfo2InArena(void* arena, char* path);
 void QStorageInfo_Refresh(void* ptr);
 void QStorageInfo_SetPath(void* ptr, char* path);
 void QStorageInfo_Swap(void* ptr, void* other);
@@ -2758,12 +2956,17 @@ void QStringListModel_SetStringList(void* ptr, char* strin);
 struct QtCore_PackedString QStringListModel_StringList(void* ptr);
 void* QStringListModel_Data(void* ptr, void* index, int role);
 void* QStringListModel_DataDefault(void* ptr, void* index, int role);
+void QStringListModel_DataDefaultInto(void* ptr, void* index, int role, void* ret);
 int QStringListModel_RowCount(void* ptr, void* parent);
 int QStringListModel_RowCountDefault(void* ptr, void* parent);
 void* QStringMatcher_NewQStringMatcher();
+void* QStringMatcher_NewQStringMatcherInArena(void* arena);
 void* QStringMatcher_NewQStringMatcher3(void* uc, int length, long long cs);
+void* QStringMatcher_NewQStringMatcher3InArena(void* arena, void* uc, int length, long long cs);
 void* QStringMatcher_NewQStringMatcher2(char* pattern, long long cs);
+void* QStringMatcher_NewQStringMatcher2InArena(void* arena, char* pattern, long long cs);
 void* QStringMatcher_NewQStringMatcher4(void* other);
+void* QStringMatcher_NewQStringMatcher4InArena(void* arena, void* other);
 void QStringMatcher_SetCaseSensitivity(void* ptr, long long cs);
 void QStringMatcher_SetPattern(void* ptr, char* pattern);
 void QStringMatcher_DestroyQStringMatcher(void* ptr);
@@ -2772,10 +2975,15 @@ long long QStringMatcher_CaseSensitivity(void* ptr);
 int QStringMatcher_IndexIn2(void* ptr, void* str, int length, int from);
 int QStringMatcher_IndexIn(void* ptr, char* str, int from);
 void* QStringRef_NewQStringRef();
+void* QStringRef_NewQStringRefInArena(void* arena);
 void* QStringRef_NewQStringRef5(void* other);
+void* QStringRef_NewQStringRef5InArena(void* arena, void* other);
 void* QStringRef_NewQStringRef3(char* stri);
+void* QStringRef_NewQStringRef3InArena(void* arena, char* stri);
 void* QStringRef_NewQStringRef2(char* stri, int position, int length);
+void* QStringRef_NewQStringRef2InArena(void* arena, char* stri, int position, int length);
 void* QStringRef_NewQStringRef4(void* other);
+void* QStringRef_NewQStringRef4InArena(void* arena, void* other);
 int QStringRef_QStringRef_Compare7(void* s1, void* s2, long long cs);
 int QStringRef_QStringRef_Compare(void* s1, char* s2, long long cs);
 int QStringRef_QStringRef_Compare6(void* s1, void* s2, long long cs);
@@ -2912,6 +3120,7 @@ struct QtCore_PackedString QSysInfo_QSysInfo_ProductVersion();
 long long QSysInfo_QSysInfo_WindowsVersion();
 long long QSysInfo_QSysInfo_MacintoshVersion();
 void* QSystemSemaphore_NewQSystemSemaphore(char* key, int initialValue, long long mode);
+void* QSystemSemaphore_NewQSystemSemaphoreInArena(void* arena, char* key, int initialValue, long long mode);
 char QSystemSemaphore_Acquire(void* ptr);
 char QSystemSemaphore_Release(void* ptr, int n);
 void QSystemSemaphore_SetKey(void* ptr, char* key, int initialValue, long long mode);
@@ -2920,7 +3129,9 @@ struct QtCore_PackedString QSystemSemaphore_ErrorString(void* ptr);
 struct QtCore_PackedString QSystemSemaphore_Key(void* ptr);
 long long QSystemSemaphore_Error(void* ptr);
 void* QTemporaryDir_NewQTemporaryDir();
+void* QTemporaryDir_NewQTemporaryDirInArena(void* arena);
 void* QTemporaryDir_NewQTemporaryDir2(char* templatePath);
+void* QTemporaryDir_NewQTemporaryDir2InArena(void* arena, char* templatePath);
 char QTemporaryDir_Remove(void* ptr);
 void QTemporaryDir_SetAutoRemove(void* ptr, char b);
 void QTemporaryDir_DestroyQTemporaryDir(void* ptr);
@@ -2941,8 +3152,11 @@ void QTemporaryFile_DestroyQTemporaryFile(void* ptr);
 struct QtCore_PackedString QTemporaryFile_FileTemplate(void* ptr);
 char QTemporaryFile_AutoRemove(void* ptr);
 void* QTextBoundaryFinder_NewQTextBoundaryFinder();
+void* QTextBoundaryFinder_NewQTextBoundaryFinderInArena(void* arena);
 void* QTextBoundaryFinder_NewQTextBoundaryFinder3(long long ty, char* stri);
+void* QTextBoundaryFinder_NewQTextBoundaryFinder3InArena(void* arena, long long ty, char* stri);
 void* QTextBoundaryFinder_NewQTextBoundaryFinder2(void* other);
+void* QTextBoundaryFinder_NewQTextBoundaryFinder2InArena(void* arena, void* other);
 int QTextBoundaryFinder_ToNextBoundary(void* ptr);
 int QTextBoundaryFinder_ToPreviousBoundary(void* ptr);
 void QTextBoundaryFinder_SetPosition(void* ptr, int position);
@@ -2955,7 +3169,7 @@ struct QtCore_PackedString QTextBoundaryFinder_String(void* ptr);
 char QTextBoundaryFinder_IsAtBoundary(void* ptr);
 char QTextBoundaryFinder_IsValid(void* ptr);
 int QTextBoundaryFinder_Position(void* ptr);
-struct QtCore_PackedList QTextCodec_QTextCodec_AvailableCodecs();
+struct QtCore_PackedString QTextCodec_QTextCodec_AvailableCodecs();
 struct QtCore_PackedList QTextCodec_QTextCodec_AvailableMibs();
 void* QTextCodec_QTextCodec_CodecForHtml2(void* ba);
 void* QTextCodec_QTextCodec_CodecForHtml(void* ba, void* defaultCodec);
@@ -2970,8 +3184,8 @@ void QTextCodec_DestroyQTextCodec(void* ptr);
 void QTextCodec_DestroyQTextCodecDefault(void* ptr);
 void* QTextCodec_FromUnicode(void* ptr, char* str);
 void* QTextCodec_Name(void* ptr);
-struct QtCore_PackedList QTextCodec_Aliases(void* ptr);
-struct QtCore_PackedList QTextCodec_AliasesDefault(void* ptr);
+struct QtCore_PackedString QTextCodec_Aliases(void* ptr);
+struct QtCore_PackedString QTextCodec_AliasesDefault(void* ptr);
 struct QtCore_PackedString QTextCodec_ToUnicode(void* ptr, void* a);
 struct QtCore_PackedString QTextCodec_ToUnicode2(void* ptr, char* chars);
 void* QTextCodec_MakeDecoder(void* ptr, long long flags);
@@ -2985,19 +3199,25 @@ void* QTextCodec___availableCodecs_newList(void* ptr);
 int QTextCodec___availableMibs_atList(void* ptr, int i);
 void QTextCodec___availableMibs_setList(void* ptr, int i);
 void* QTextCodec___availableMibs_newList(void* ptr);
+void* QTextCodec___availableMibs_newListBuffer(void* ptr, void* data, int count);
+void QTextCodec___availableMibs_fillList(void* ptr, void* data);
 void* QTextCodec___aliases_atList(void* ptr, int i);
 void QTextCodec___aliases_setList(void* ptr, void* i);
 void* QTextCodec___aliases_newList(void* ptr);
 struct QtCore_PackedString QTextDecoder_ToUnicode2(void* ptr, void* ba);
 struct QtCore_PackedString QTextDecoder_ToUnicode(void* ptr, char* chars, int len);
 void* QTextDecoder_NewQTextDecoder(void* codec);
+void* QTextDecoder_NewQTextDecoderInArena(void* arena, void* codec);
 void* QTextDecoder_NewQTextDecoder2(void* codec, long long flags);
+void* QTextDecoder_NewQTextDecoder2InArena(void* arena, void* codec, long long flags);
 void QTextDecoder_ToUnicode3(void* ptr, char* target, char* chars, int len);
 void QTextDecoder_DestroyQTextDecoder(void* ptr);
 void* QTextEncoder_FromUnicode2(void* ptr, void* uc, int len);
 void* QTextEncoder_FromUnicode(void* ptr, char* str);
 void* QTextEncoder_NewQTextEncoder(void* codec);
+void* QTextEncoder_NewQTextEncoderInArena(void* arena, void* codec);
 void* QTextEncoder_NewQTextEncoder2(void* codec, long long flags);
+void* QTextEncoder_NewQTextEncoder2InArena(void* arena, void* codec, long long flags);
 void QTextEncoder_DestroyQTextEncoder(void* ptr);
 struct QtCore_PackedString QTextStream_Read(void* ptr, long long maxlen);
 struct QtCore_PackedString QTextStream_ReadAll(void* ptr);
@@ -3101,7 +3321,9 @@ void* QTime_QTime_FromMSecsSinceStartOfDay(int msecs);
 void* QTime_QTime_FromString(char* stri, long long format);
 void* QTime_QTime_FromString2(char* stri, char* format);
 void* QTime_NewQTime();
+void* QTime_NewQTimeInArena(void* arena);
 void* QTime_NewQTime3(int h, int m, int s, int ms);
+void* QTime_NewQTime3InArena(void* arena, int h, int m, int s, int ms);
 char QTime_QTime_IsValid2(int h, int m, int s, int ms);
 char QTime_SetHMS(void* ptr, int h, int m, int s, int ms);
 int QTime_Restart(void* ptr);
@@ -3171,18 +3393,23 @@ void* QTimeZone_QTimeZone_IanaIdToWindowsId(void* ianaId);
 void* QTimeZone_QTimeZone_SystemTimeZoneId();
 void* QTimeZone_QTimeZone_WindowsIdToDefaultIanaId(void* windowsId);
 void* QTimeZone_QTimeZone_WindowsIdToDefaultIanaId2(void* windowsId, long long country);
-struct QtCore_PackedList QTimeZone_QTimeZone_AvailableTimeZoneIds();
-struct QtCore_PackedList QTimeZone_QTimeZone_AvailableTimeZoneIds2(long long country);
-struct QtCore_PackedList QTimeZone_QTimeZone_AvailableTimeZoneIds3(int offsetSeconds);
-struct QtCore_PackedList QTimeZone_QTimeZone_WindowsIdToIanaIds(void* windowsId);
-struct QtCore_PackedList QTimeZone_QTimeZone_WindowsIdToIanaIds2(void* windowsId, long long country);
+struct QtCore_PackedString QTimeZone_QTimeZone_AvailableTimeZoneIds();
+struct QtCore_PackedString QTimeZone_QTimeZone_AvailableTimeZoneIds2(long long country);
+struct QtCore_PackedString QTimeZone_QTimeZone_AvailableTimeZoneIds3(int offsetSeconds);
+struct QtCore_PackedString QTimeZone_QTimeZone_WindowsIdToIanaIds(void* windowsId);
+struct QtCore_PackedString QTimeZone_QTimeZone_WindowsIdToIanaIds2(void* windowsId, long long country);
 void* QTimeZone_QTimeZone_SystemTimeZone();
 void* QTimeZone_QTimeZone_Utc();
 void* QTimeZone_NewQTimeZone();
+void* QTimeZone_NewQTimeZoneInArena(void* arena);
 void* QTimeZone_NewQTimeZone2(void* ianaId);
+void* QTimeZone_NewQTimeZone2InArena(void* arena, void* ianaId);
 void* QTimeZone_NewQTimeZone4(void* ianaId, int offsetSeconds, char* name, char* abbreviation, long long country, char* comment);
+void* QTimeZone_NewQTimeZone4InArena(void* arena, void* ianaId, int offsetSeconds, char* name, char* abbreviation, long long country, char* comment);
 void* QTimeZone_NewQTimeZone5(void* other);
+void* QTimeZone_NewQTimeZone5InArena(void* arena, void* other);
 void* QTimeZone_NewQTimeZone3(int offsetSeconds);
+void* QTimeZone_NewQTimeZone3InArena(void* arena, int offsetSeconds);
 char QTimeZone_QTimeZone_IsTimeZoneIdAvailable(void* ianaId);
 void QTimeZone_Swap(void* ptr, void* other);
 void QTimeZone_DestroyQTimeZone(void* ptr);
@@ -3260,9 +3487,13 @@ void* QUrl_QUrl_FromLocalFile(char* localFile);
 void* QUrl_QUrl_FromUserInput(char* userInput);
 void* QUrl_QUrl_FromUserInput2(char* userInput, char* workingDirectory, long long options);
 void* QUrl_NewQUrl();
+void* QUrl_NewQUrlInArena(void* arena);
 void* QUrl_NewQUrl4(void* other);
+void* QUrl_NewQUrl4InArena(void* arena, void* other);
 void* QUrl_NewQUrl3(char* url, long long parsingMode);
+void* QUrl_NewQUrl3InArena(void* arena, char* url, long long parsingMode);
 void* QUrl_NewQUrl2(void* other);
+void* QUrl_NewQUrl2InArena(void* arena, void* other);
 void QUrl_Clear(void* ptr);
 void QUrl_SetAuthority(void* ptr, char* authority, long long mode);
 void QUrl_SetFragment(void* ptr, char* fragment, long long mode);
@@ -3319,9 +3550,13 @@ void* QUrl___allEncodedQueryItemValues_newList(void* ptr);
 void* QUrlQuery_QUrlQuery_DefaultQueryPairDelimiter();
 void* QUrlQuery_QUrlQuery_DefaultQueryValueDelimiter();
 void* QUrlQuery_NewQUrlQuery();
+void* QUrlQuery_NewQUrlQueryInArena(void* arena);
 void* QUrlQuery_NewQUrlQuery3(char* queryString);
+void* QUrlQuery_NewQUrlQuery3InArena(void* arena, char* queryString);
 void* QUrlQuery_NewQUrlQuery2(void* url);
+void* QUrlQuery_NewQUrlQuery2InArena(void* arena, void* url);
 void* QUrlQuery_NewQUrlQuery4(void* other);
+void* QUrlQuery_NewQUrlQuery4InArena(void* arena, void* other);
 void QUrlQuery_AddQueryItem(void* ptr, char* key, char* value);
 void QUrlQuery_Clear(void* ptr);
 void QUrlQuery_RemoveAllQueryItems(void* ptr, char* key);
@@ -3345,9 +3580,13 @@ void* QUuid_QUuid_CreateUuidV32(void* ns, char* baseData);
 void* QUuid_QUuid_CreateUuidV52(void* ns, char* baseData);
 void* QUuid_QUuid_FromRfc4122(void* bytes);
 void* QUuid_NewQUuid();
+void* QUuid_NewQUuidInArena(void* arena);
 void* QUuid_NewQUuid5(void* text);
+void* QUuid_NewQUuid5InArena(void* arena, void* text);
 void* QUuid_NewQUuid3(char* text);
+void* QUuid_NewQUuid3InArena(void* arena, char* text);
 void* QUuid_NewQUuid2(unsigned int l, unsigned short w1, unsigned short w2, char* b1, char* b2, char* b3, char* b4, char* b5, char* b6, char* b7, char* b8);
+void* QUuid_NewQUuid2InArena(void* arena, unsigned int l, unsigned short w1, unsigned short w2, char* b1, char* b2, char* b3, char* b4, char* b5, char* b6, char* b7, char* b8);
 void* QUuid_ToByteArray(void* ptr);
 void* QUuid_ToRfc4122(void* ptr);
 struct QtCore_PackedString QUuid_ToString(void* ptr);
@@ -3361,50 +3600,95 @@ void QUuid_SetData2(void* ptr, unsigned short vus);
 unsigned short QUuid_Data3(void* ptr);
 void QUuid_SetData3(void* ptr, unsigned short vus);
 void* QVariant_NewQVariant20(void* c);
+void* QVariant_NewQVariant20InArena(void* arena, void* c);
 void* QVariant_NewQVariant();
+void* QVariant_NewQVariantInArena(void* arena);
 void* QVariant_NewQVariant6(void* s);
+void* QVariant_NewQVariant6InArena(void* arena, void* s);
 void* QVariant_NewQVariant18(void* val);
+void* QVariant_NewQVariant18InArena(void* arena, void* val);
 void* QVariant_NewQVariant47(void* other);
+void* QVariant_NewQVariant47InArena(void* arena, void* other);
 void* QVariant_NewQVariant11(char val);
+void* QVariant_NewQVariant11InArena(void* arena, char val);
 void* QVariant_NewQVariant16(void* val);
+void* QVariant_NewQVariant16InArena(void* arena, void* val);
 void* QVariant_NewQVariant15(void* val);
+void* QVariant_NewQVariant15InArena(void* arena, void* val);
 void* QVariant_NewQVariant21(void* val);
+void* QVariant_NewQVariant21InArena(void* arena, void* val);
 void* QVariant_NewQVariant23(void* val);
+void* QVariant_NewQVariant23InArena(void* arena, void* val);
 void* QVariant_NewQVariant39(void* val);
+void* QVariant_NewQVariant39InArena(void* arena, void* val);
 void* QVariant_NewQVariant26(void* val);
+void* QVariant_NewQVariant26InArena(void* arena, void* val);
 void* QVariant_NewQVariant45(void* val);
+void* QVariant_NewQVariant45InArena(void* arena, void* val);
 void* QVariant_NewQVariant46(void* val);
+void* QVariant_NewQVariant46InArena(void* arena, void* val);
 void* QVariant_NewQVariant44(void* val);
+void* QVariant_NewQVariant44InArena(void* arena, void* val);
 void* QVariant_NewQVariant43(void* val);
+void* QVariant_NewQVariant43InArena(void* arena, void* val);
 void* QVariant_NewQVariant31(void* val);
+void* QVariant_NewQVariant31InArena(void* arena, void* val);
 void* QVariant_NewQVariant32(void* val);
+void* QVariant_NewQVariant32InArena(void* arena, void* val);
 void* QVariant_NewQVariant24(void* val);
+void* QVariant_NewQVariant24InArena(void* arena, void* val);
 void* QVariant_NewQVariant35(void* l);
+void* QVariant_NewQVariant35InArena(void* arena, void* l);
 void* QVariant_NewQVariant25(void* val);
+void* QVariant_NewQVariant25InArena(void* arena, void* val);
 void* QVariant_NewQVariant41(void* val);
+void* QVariant_NewQVariant41InArena(void* arena, void* val);
 void* QVariant_NewQVariant42(void* val);
+void* QVariant_NewQVariant42InArena(void* arena, void* val);
 void* QVariant_NewQVariant29(void* val);
+void* QVariant_NewQVariant29InArena(void* arena, void* val);
 void* QVariant_NewQVariant30(void* val);
+void* QVariant_NewQVariant30InArena(void* arena, void* val);
 void* QVariant_NewQVariant33(void* val);
+void* QVariant_NewQVariant33InArena(void* arena, void* val);
 void* QVariant_NewQVariant34(void* val);
+void* QVariant_NewQVariant34InArena(void* arena, void* val);
 void* QVariant_NewQVariant36(void* regExp);
+void* QVariant_NewQVariant36InArena(void* arena, void* regExp);
 void* QVariant_NewQVariant37(void* re);
+void* QVariant_NewQVariant37InArena(void* arena, void* re);
 void* QVariant_NewQVariant27(void* val);
+void* QVariant_NewQVariant27InArena(void* arena, void* val);
 void* QVariant_NewQVariant28(void* val);
+void* QVariant_NewQVariant28InArena(void* arena, void* val);
 void* QVariant_NewQVariant17(char* val);
+void* QVariant_NewQVariant17InArena(void* arena, char* val);
 void* QVariant_NewQVariant19(char* val);
+void* QVariant_NewQVariant19InArena(void* arena, char* val);
 void* QVariant_NewQVariant22(void* val);
+void* QVariant_NewQVariant22InArena(void* arena, void* val);
 void* QVariant_NewQVariant38(void* val);
+void* QVariant_NewQVariant38InArena(void* arena, void* val);
 void* QVariant_NewQVariant40(void* val);
+void* QVariant_NewQVariant40InArena(void* arena, void* val);
 void* QVariant_NewQVariant5(void* p);
+void* QVariant_NewQVariant5InArena(void* arena, void* p);
 void* QVariant_NewQVariant14(char* val);
+void* QVariant_NewQVariant14InArena(void* arena, char* val);
 void* QVariant_NewQVariant12(double val);
+void* QVariant_NewQVariant12InArena(void* arena, double val);
 void* QVariant_NewQVariant13(float val);
+void* QVariant_NewQVariant13InArena(void* arena, float val);
 void* QVariant_NewQVariant3(int typeId, void* copy);
+void* QVariant_NewQVariant3InArena(void* arena, int typeId, void* copy);
 void* QVariant_NewQVariant7(int val);
+void* QVariant_NewQVariant7InArena(void* arena, int val);
 void* QVariant_NewQVariant9(long long val);
+void* QVariant_NewQVariant9InArena(void* arena, long long val);
 void* QVariant_NewQVariant10(unsigned long long val);
+void* QVariant_NewQVariant10InArena(void* arena, unsigned long long val);
 void* QVariant_NewQVariant8(unsigned int val);
+void* QVariant_NewQVariant8InArena(void* arena, unsigned int val);
 char QVariant_Convert(void* ptr, int targetTypeId);
 struct QtCore_PackedString QVariant_QVariant_TypeToName(int typeId);
 void QVariant_Clear(void* ptr);
@@ -3518,11 +3802,17 @@ void* QVersionNumber_QVersionNumber_CommonPrefix(void* v1, void* v2);
 void* QVersionNumber_QVersionNumber_FromString(char* stri, int suffixIndex);
 struct QtCore_PackedString QVersionNumber_ToString(void* ptr);
 void* QVersionNumber_NewQVersionNumber();
+void* QVersionNumber_NewQVersionNumberInArena(void* arena);
 void* QVersionNumber_NewQVersionNumber3(void* seg);
+void* QVersionNumber_NewQVersionNumber3InArena(void* arena, void* seg);
 void* QVersionNumber_NewQVersionNumber2(void* seg);
+void* QVersionNumber_NewQVersionNumber2InArena(void* arena, void* seg);
 void* QVersionNumber_NewQVersionNumber5(int maj);
+void* QVersionNumber_NewQVersionNumber5InArena(void* arena, int maj);
 void* QVersionNumber_NewQVersionNumber6(int maj, int min);
+void* QVersionNumber_NewQVersionNumber6InArena(void* arena, int maj, int min);
 void* QVersionNumber_NewQVersionNumber7(int maj, int min, int mic);
+void* QVersionNumber_NewQVersionNumber7InArena(void* arena, int maj, int min, int mic);
 int QVersionNumber_QVersionNumber_Compare(void* v1, void* v2);
 struct QtCore_PackedList QVersionNumber_Segments(void* ptr);
 void* QVersionNumber_Normalized(void* ptr);
@@ -3537,13 +3827,20 @@ int QVersionNumber_SegmentCount(void* ptr);
 int QVersionNumber___QVersionNumber_seg_atList3(void* ptr, int i);
 void QVersionNumber___QVersionNumber_seg_setList3(void* ptr, int i);
 void* QVersionNumber___QVersionNumber_seg_newList3(void* ptr);
+void* QVersionNumber___QVersionNumber_seg_newListBuffer3(void* ptr, void* data, int count);
+void QVersionNumber___QVersionNumber_seg_fillList3(void* ptr, void* data);
 int QVersionNumber___QVersionNumber_seg_atList2(void* ptr, int i);
 void QVersionNumber___QVersionNumber_seg_setList2(void* ptr, int i);
 void* QVersionNumber___QVersionNumber_seg_newList2(void* ptr);
+void* QVersionNumber___QVersionNumber_seg_newListBuffer2(void* ptr, void* data, int count);
+void QVersionNumber___QVersionNumber_seg_fillList2(void* ptr, void* data);
 int QVersionNumber___segments_atList(void* ptr, int i);
 void QVersionNumber___segments_setList(void* ptr, int i);
 void* QVersionNumber___segments_newList(void* ptr);
+void* QVersionNumber___segments_newListBuffer(void* ptr, void* data, int count);
+void QVersionNumber___segments_fillList(void* ptr, void* data);
 void* QWaitCondition_NewQWaitCondition();
+void* QWaitCondition_NewQWaitConditionInArena(void* arena);
 char QWaitCondition_Wait(void* ptr, void* lockedMutex, unsigned long time);
 char QWaitCondition_Wait2(void* ptr, void* lockedReadWriteLock, unsigned long time);
 void QWaitCondition_Notify_all(void* ptr);
@@ -3552,15 +3849,21 @@ void QWaitCondition_WakeAll(void* ptr);
 void QWaitCondition_WakeOne(void* ptr);
 void QWaitCondition_DestroyQWaitCondition(void* ptr);
 void* QWriteLocker_NewQWriteLocker(void* lock);
+void* QWriteLocker_NewQWriteLockerInArena(void* arena, void* lock);
 void QWriteLocker_Relock(void* ptr);
 void QWriteLocker_Unlock(void* ptr);
 void QWriteLocker_DestroyQWriteLocker(void* ptr);
 void* QWriteLocker_ReadWriteLock(void* ptr);
 void* QXmlStreamAttribute_NewQXmlStreamAttribute();
+void* QXmlStreamAttribute_NewQXmlStreamAttributeInArena(void* arena);
 void* QXmlStreamAttribute_NewQXmlStreamAttribute5(void* other);
+void* QXmlStreamAttribute_NewQXmlStreamAttribute5InArena(void* arena, void* other);
 void* QXmlStreamAttribute_NewQXmlStreamAttribute3(char* namespaceUri, char* name, char* value);
+void* QXmlStreamAttribute_NewQXmlStreamAttribute3InArena(void* arena, char* namespaceUri, char* name, char* value);
 void* QXmlStreamAttribute_NewQXmlStreamAttribute2(char* qualifiedName, char* value);
+void* QXmlStreamAttribute_NewQXmlStreamAttribute2InArena(void* arena, char* qualifiedName, char* value);
 void* QXmlStreamAttribute_NewQXmlStreamAttribute4(void* other);
+void* QXmlStreamAttribute_NewQXmlStreamAttribute4InArena(void* arena, void* other);
 void QXmlStreamAttribute_DestroyQXmlStreamAttribute(void* ptr);
 void* QXmlStreamAttribute_Name(void* ptr);
 void* QXmlStreamAttribute_NamespaceUri(void* ptr);
@@ -3569,6 +3872,7 @@ void* QXmlStreamAttribute_QualifiedName(void* ptr);
 void* QXmlStreamAttribute_Value(void* ptr);
 char QXmlStreamAttribute_IsDefault(void* ptr);
 void* QXmlStreamAttributes_NewQXmlStreamAttributes();
+void* QXmlStreamAttributes_NewQXmlStreamAttributesInArena(void* arena);
 void QXmlStreamAttributes_Append(void* ptr, char* namespaceUri, char* name, char* value);
 void QXmlStreamAttributes_Append2(void* ptr, char* qualifiedName, char* value);
 void* QXmlStreamAttributes_Value3(void* ptr, void* namespaceUri, void* name);
@@ -3580,8 +3884,11 @@ char QXmlStreamAttributes_HasAttribute2(void* ptr, void* qualifiedName);
 char QXmlStreamAttributes_HasAttribute3(void* ptr, char* namespaceUri, char* name);
 char QXmlStreamAttributes_HasAttribute(void* ptr, char* qualifiedName);
 void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration();
+void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclarationInArena(void* arena);
 void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration3(void* other);
+void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration3InArena(void* arena, void* other);
 void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration2(void* other);
+void* QXmlStreamEntityDeclaration_NewQXmlStreamEntityDeclaration2InArena(void* arena, void* other);
 void QXmlStreamEntityDeclaration_DestroyQXmlStreamEntityDeclaration(void* ptr);
 void* QXmlStreamEntityDeclaration_Name(void* ptr);
 void* QXmlStreamEntityDeclaration_NotationName(void* ptr);
@@ -3593,25 +3900,37 @@ struct QtCore_PackedString QXmlStreamEntityResolver_ResolveUndeclaredEntityDefau
 void QXmlStreamEntityResolver_DestroyQXmlStreamEntityResolver(void* ptr);
 void QXmlStreamEntityResolver_DestroyQXmlStreamEntityResolverDefault(void* ptr);
 void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration();
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclarationInArena(void* arena);
 void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration3(void* other);
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration3InArena(void* arena, void* other);
 void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration4(char* prefix, char* namespaceUri);
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration4InArena(void* arena, char* prefix, char* namespaceUri);
 void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration2(void* other);
+void* QXmlStreamNamespaceDeclaration_NewQXmlStreamNamespaceDeclaration2InArena(void* arena, void* other);
 void QXmlStreamNamespaceDeclaration_DestroyQXmlStreamNamespaceDeclaration(void* ptr);
 void* QXmlStreamNamespaceDeclaration_NamespaceUri(void* ptr);
 void* QXmlStreamNamespaceDeclaration_Prefix(void* ptr);
 void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration();
+void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclarationInArena(void* arena);
 void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration3(void* other);
+void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration3InArena(void* arena, void* other);
 void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration2(void* other);
+void* QXmlStreamNotationDeclaration_NewQXmlStreamNotationDeclaration2InArena(void* arena, void* other);
 void QXmlStreamNotationDeclaration_DestroyQXmlStreamNotationDeclaration(void* ptr);
 void* QXmlStreamNotationDeclaration_Name(void* ptr);
 void* QXmlStreamNotationDeclaration_PublicId(void* ptr);
 void* QXmlStreamNotationDeclaration_SystemId(void* ptr);
 struct QtCore_PackedString QXmlStreamReader_ReadElementText(void* ptr, long long behaviour);
 void* QXmlStreamReader_NewQXmlStreamReader();
+void* QXmlStreamReader_NewQXmlStreamReaderInArena(void* arena);
 void* QXmlStreamReader_NewQXmlStreamReader2(void* device);
+void* QXmlStreamReader_NewQXmlStreamReader2InArena(void* arena, void* device);
 void* QXmlStreamReader_NewQXmlStreamReader3(void* data);
+void* QXmlStreamReader_NewQXmlStreamReader3InArena(void* arena, void* data);
 void* QXmlStreamReader_NewQXmlStreamReader4(char* data);
+void* QXmlStreamReader_NewQXmlStreamReader4InArena(void* arena, char* data);
 void* QXmlStreamReader_NewQXmlStreamReader5(char* data);
+void* QXmlStreamReader_NewQXmlStreamReader5InArena(void* arena, char* data);
 long long QXmlStreamReader_ReadNext(void* ptr);
 char QXmlStreamReader_ReadNextStartElement(void* ptr);
 void QXmlStreamReader_AddData(void* ptr, void* data);
@@ -3662,9 +3981,13 @@ long long QXmlStreamReader_CharacterOffset(void* ptr);
 long long QXmlStreamReader_ColumnNumber(void* ptr);
 long long QXmlStreamReader_LineNumber(void* ptr);
 void* QXmlStreamWriter_NewQXmlStreamWriter();
+void* QXmlStreamWriter_NewQXmlStreamWriterInArena(void* arena);
 void* QXmlStreamWriter_NewQXmlStreamWriter3(void* array);
+void* QXmlStreamWriter_NewQXmlStreamWriter3InArena(void* arena, void* array);
 void* QXmlStreamWriter_NewQXmlStreamWriter2(void* device);
+void* QXmlStreamWriter_NewQXmlStreamWriter2InArena(void* arena, void* device);
 void* QXmlStreamWriter_NewQXmlStreamWriter4(char* stri);
+void* QXmlStreamWriter_NewQXmlStreamWriter4InArena(void* arena, char* stri);
 void QXmlStreamWriter_SetAutoFormatting(void* ptr, char enable);
 void QXmlStreamWriter_SetAutoFormattingIndent(void* ptr, int spacesOrTabs);
 void QXmlStreamWriter_SetCodec(void* ptr, void* codec);
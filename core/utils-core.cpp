@@ -0,0 +1,1430 @@
+#include "utils-core.h"
+#include "_cgo_export.h"
+
+#include <QAbstractProxyModel>
+#include <QAbstractTableModel>
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QEvent>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QMetaMethod>
+#include <QMetaProperty>
+#include <QPair>
+#include <QPointer>
+#include <QRect>
+#include <QRegularExpression>
+#include <QSemaphore>
+#include <QString>
+#include <QStringList>
+#include <QThread>
+#include <QVariant>
+#include <QVector>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+void QVariant_Assign(void* ptr, void* other)
+{
+	*static_cast<QVariant*>(ptr) = *static_cast<QVariant*>(other);
+}
+
+void QVariant_DeleteQVariant(void* ptr)
+{
+	delete static_cast<QVariant*>(ptr);
+}
+
+void QVariant_SetBool(void* ptr, char v)
+{
+	static_cast<QVariant*>(ptr)->setValue(v != 0);
+}
+
+void QVariant_SetInt(void* ptr, int v)
+{
+	static_cast<QVariant*>(ptr)->setValue(v);
+}
+
+void QVariant_SetFloat(void* ptr, double v)
+{
+	static_cast<QVariant*>(ptr)->setValue(v);
+}
+
+void QVariant_SetString(void* ptr, char* v, int len)
+{
+	static_cast<QVariant*>(ptr)->setValue(QString::fromUtf8(v, len));
+}
+
+//the packed value format shared with utils-core.go, every value starts with its tag,
+//numbers are stored in host byte order and strings as utf8 prefixed with their qint32 length
+enum GoValueTag { GoValueNil, GoValueBool, GoValueInt, GoValueUint, GoValueFloat, GoValueString, GoValueBytes, GoValueList, GoValueMap, GoValueObject, GoValueOther };
+
+class GoValueWriter
+{
+public:
+	QByteArray out;
+
+	void tag(GoValueTag t) { out.append(char(t)); };
+	template <typename T> void put(T v) { out.append(reinterpret_cast<const char*>(&v), sizeof(T)); };
+	void bytes(const QByteArray& b) { put<qint32>(b.size()); out.append(b); };
+	void string(const QString& s) { bytes(s.toUtf8()); };
+
+	void variant(const QVariant& v)
+	{
+		switch (v.userType()) {
+		case QMetaType::UnknownType: tag(GoValueNil); return;
+		case QMetaType::Bool: tag(GoValueBool); put<char>(v.toBool()); return;
+		case QMetaType::Int: case QMetaType::LongLong: case QMetaType::Long: case QMetaType::Short: case QMetaType::SChar: case QMetaType::Char:
+			tag(GoValueInt); put<qint64>(v.toLongLong()); return;
+		case QMetaType::UInt: case QMetaType::ULongLong: case QMetaType::ULong: case QMetaType::UShort: case QMetaType::UChar:
+			tag(GoValueUint); put<quint64>(v.toULongLong()); return;
+		case QMetaType::Double: case QMetaType::Float: tag(GoValueFloat); put<double>(v.toDouble()); return;
+		case QMetaType::QString: tag(GoValueString); string(v.toString()); return;
+		case QMetaType::QByteArray: tag(GoValueBytes); bytes(v.toByteArray()); return;
+		case QMetaType::QObjectStar: tag(GoValueObject); put<quint64>(reinterpret_cast<quintptr>(v.value<QObject*>())); return;
+		case QMetaType::QStringList:
+			{
+				const QStringList l = v.toStringList();
+				tag(GoValueList); put<qint32>(l.size());
+				for (int i = 0; i < l.size(); i++) { tag(GoValueString); string(l.at(i)); }
+				return;
+			}
+		case QMetaType::QVariantList: list(v.toList()); return;
+		case QMetaType::QVariantMap: map(v.toMap()); return;
+		case QMetaType::QVariantHash: map(v.toHash()); return;
+		}
+		//pointers to QObject subclasses and types that Qt knows how to iterate, like QJsonObject and QJsonArray
+		if (QMetaType::typeFlags(v.userType()) & QMetaType::PointerToQObject) {
+			tag(GoValueObject); put<quint64>(reinterpret_cast<quintptr>(v.value<QObject*>()));
+		} else if (v.canConvert<QVariantMap>()) {
+			map(v.toMap());
+		} else if (v.canConvert<QVariantList>()) {
+			list(v.toList());
+		} else {
+			tag(GoValueOther); put<quint64>(reinterpret_cast<quintptr>(new QVariant(v)));
+		}
+	};
+
+	void list(const QVariantList& l)
+	{
+		tag(GoValueList); put<qint32>(l.size());
+		for (int i = 0; i < l.size(); i++) { variant(l.at(i)); }
+	};
+
+	template <typename T> void map(const T& m)
+	{
+		tag(GoValueMap); put<qint32>(m.size());
+		for (typename T::const_iterator it = m.constBegin(); it != m.constEnd(); ++it) { string(it.key()); variant(it.value()); }
+	};
+};
+
+class GoValueReader
+{
+public:
+	GoValueReader(const char* data) : p(data) {};
+
+	template <typename T> T get() { T v; memcpy(&v, p, sizeof(T)); p += sizeof(T); return v; };
+	QByteArray bytes() { qint32 n = get<qint32>(); QByteArray b(p, n); p += n; return b; };
+	QString string() { qint32 n = get<qint32>(); QString s = QString::fromUtf8(p, n); p += n; return s; };
+
+	//ints that fit are stored as int, so that qml sees them as plain numbers
+	QVariant variant()
+	{
+		switch (get<char>()) {
+		case GoValueBool: return get<char>() != 0;
+		case GoValueInt: { qint64 v = get<qint64>(); if (v == qint64(int(v))) { return int(v); } return v; }
+		case GoValueUint: { quint64 v = get<quint64>(); if (v == quint64(uint(v))) { return uint(v); } return v; }
+		case GoValueFloat: return get<double>();
+		case GoValueString: return string();
+		case GoValueBytes: return bytes();
+		case GoValueObject: return QVariant::fromValue(reinterpret_cast<QObject*>(quintptr(get<quint64>())));
+		case GoValueOther: return *reinterpret_cast<QVariant*>(quintptr(get<quint64>()));
+		case GoValueList:
+			{
+				qint32 n = get<qint32>();
+				QVariantList l;
+				l.reserve(n);
+				for (int i = 0; i < n; i++) { l.append(variant()); }
+				return l;
+			}
+		case GoValueMap:
+			{
+				qint32 n = get<qint32>();
+				QVariantMap m;
+				for (int i = 0; i < n; i++) { QString k = string(); m.insert(k, variant()); }
+				return m;
+			}
+		}
+		return QVariant();
+	};
+
+	//the same tree as json, byte arrays are base64 encoded like encoding/json does
+	QJsonValue json()
+	{
+		switch (get<char>()) {
+		case GoValueBool: return get<char>() != 0;
+		case GoValueInt: return double(get<qint64>());
+		case GoValueUint: return double(get<quint64>());
+		case GoValueFloat: return get<double>();
+		case GoValueString: return string();
+		case GoValueBytes: return QString::fromLatin1(bytes().toBase64());
+		case GoValueObject: get<quint64>(); break;
+		case GoValueOther: return QJsonValue::fromVariant(*reinterpret_cast<QVariant*>(quintptr(get<quint64>())));
+		case GoValueList:
+			{
+				qint32 n = get<qint32>();
+				QJsonArray a;
+				for (int i = 0; i < n; i++) { a.append(json()); }
+				return a;
+			}
+		case GoValueMap:
+			{
+				qint32 n = get<qint32>();
+				QJsonObject o;
+				for (int i = 0; i < n; i++) { QString k = string(); o.insert(k, json()); }
+				return o;
+			}
+		}
+		return QJsonValue();
+	};
+
+private:
+	const char* p;
+};
+
+void* QVariant_ToGo(void* ptr, char** data, long long* len)
+{
+	GoValueWriter w;
+	w.variant(*static_cast<QVariant*>(ptr));
+	QByteArray* out = new QByteArray(w.out);
+	*data = const_cast<char*>(out->constData());
+	*len = out->size();
+	return out;
+}
+
+void* QVariant_NewQVariantFromGo(char* data)
+{
+	return new QVariant(GoValueReader(data).variant());
+}
+
+void* QString_NewQStringFromUTF8(char* data, int len)
+{
+	return new QString(QString::fromUtf8(data, len));
+}
+
+void* QString_NewQStringFromUTF16(void* data, int len)
+{
+	return new QString(QString::fromUtf16(static_cast<ushort*>(data), len));
+}
+
+void* QString_NewQStringFromRawUTF16(void* data, int len)
+{
+	return new QString(QString::fromRawData(static_cast<QChar*>(data), len));
+}
+
+void QString_DeleteQString(void* ptr)
+{
+	delete static_cast<QString*>(ptr);
+}
+
+void* QString_UTF16(void* ptr, int* len)
+{
+	*len = static_cast<QString*>(ptr)->size();
+	return const_cast<ushort*>(static_cast<QString*>(ptr)->utf16());
+}
+
+void QVariant_SetQString(void* ptr, void* str)
+{
+	static_cast<QVariant*>(ptr)->setValue(*static_cast<QString*>(str));
+}
+
+static void* goByteBuffer(const QByteArray& b, char** data, long long* len)
+{
+	QByteArray* out = new QByteArray(b);
+	*data = const_cast<char*>(out->constData());
+	*len = out->size();
+	return out;
+}
+
+void* QJsonDocument_ToJSON(void* ptr, char** data, long long* len)
+{
+	return goByteBuffer(static_cast<QJsonDocument*>(ptr)->toJson(QJsonDocument::Compact), data, len);
+}
+
+void* QJsonObject_ToJSON(void* ptr, char** data, long long* len)
+{
+	return goByteBuffer(QJsonDocument(*static_cast<QJsonObject*>(ptr)).toJson(QJsonDocument::Compact), data, len);
+}
+
+void* QJsonArray_ToJSON(void* ptr, char** data, long long* len)
+{
+	return goByteBuffer(QJsonDocument(*static_cast<QJsonArray*>(ptr)).toJson(QJsonDocument::Compact), data, len);
+}
+
+void* QJsonValue_ToJSON(void* ptr, char** data, long long* len)
+{
+	QJsonValue* v = static_cast<QJsonValue*>(ptr);
+	if (v->isObject()) {
+		return goByteBuffer(QJsonDocument(v->toObject()).toJson(QJsonDocument::Compact), data, len);
+	}
+	if (v->isArray()) {
+		return goByteBuffer(QJsonDocument(v->toArray()).toJson(QJsonDocument::Compact), data, len);
+	}
+	//documents only hold objects and arrays, so a scalar is serialized as the only element of an array
+	QByteArray a = QJsonDocument(QJsonArray() << *v).toJson(QJsonDocument::Compact);
+	return goByteBuffer(a.mid(1, a.size() - 2), data, len);
+}
+
+void* QJsonDocument_NewQJsonDocumentFromGo(char* data)
+{
+	QJsonValue v = GoValueReader(data).json();
+	return new QJsonDocument(v.isArray() ? QJsonDocument(v.toArray()) : QJsonDocument(v.toObject()));
+}
+
+void* QJsonDocument_NewQJsonDocumentFromJSON(char* data, int len)
+{
+	return new QJsonDocument(QJsonDocument::fromJson(QByteArray::fromRawData(data, len)));
+}
+
+void* QByteArray_NewQByteArrayFromBytes(char* data, int size)
+{
+	return new QByteArray(data, size);
+}
+
+void* QByteArray_NewQByteArrayFromRawData(char* data, int size)
+{
+	return new QByteArray(QByteArray::fromRawData(data, size));
+}
+
+void QByteArray_DeleteQByteArray(void* ptr)
+{
+	delete static_cast<QByteArray*>(ptr);
+}
+
+char* QByteArray_View(void* ptr, long long* len)
+{
+	*len = static_cast<QByteArray*>(ptr)->size();
+	return const_cast<char*>(static_cast<QByteArray*>(ptr)->constData());
+}
+
+char* QByteArray_MutableView(void* ptr, long long* len)
+{
+	*len = static_cast<QByteArray*>(ptr)->size();
+	return static_cast<QByteArray*>(ptr)->data();
+}
+
+class GoColumnTableModel: public QAbstractTableModel
+{
+public:
+	struct Column { qint64 kind; QString header; QVector<qint64> ints; QVector<double> floats; QVector<QString> strings; };
+
+	GoColumnTableModel(QObject *parent) : QAbstractTableModel(parent), rows(0), pendingRows(0), batches(0), dirtyTop(-1), dirtyLeft(0), dirtyBottom(0), dirtyRight(0) {};
+
+	int rowCount(const QModelIndex & parent) const { return parent.isValid() ? 0 : rows; };
+	int columnCount(const QModelIndex & parent) const { return parent.isValid() ? 0 : columns.size(); };
+
+	QVariant data(const QModelIndex & index, int role) const
+	{
+		if (!index.isValid() || index.row() >= rows || (role != Qt::DisplayRole && role != Qt::EditRole)) {
+			return QVariant();
+		}
+		const Column& c = columns.at(index.column());
+		switch (c.kind) {
+			case 0: return c.ints.at(index.row());
+			case 1: return c.floats.at(index.row());
+			default: return c.strings.at(index.row());
+		}
+	};
+
+	QVariant headerData(int section, Qt::Orientation orientation, int role) const
+	{
+		if (orientation == Qt::Horizontal && role == Qt::DisplayRole && section >= 0 && section < columns.size()) {
+			return columns.at(section).header;
+		}
+		return QAbstractTableModel::headerData(section, orientation, role);
+	};
+
+	int addColumn(qint64 kind, const QString& header)
+	{
+		Column c;
+		c.kind = kind;
+		c.header = header;
+		resize(c, rows + pendingRows);
+		beginInsertColumns(QModelIndex(), columns.size(), columns.size());
+		columns.append(c);
+		endInsertColumns();
+		return columns.size() - 1;
+	};
+
+	void appendRows(int count)
+	{
+		if (count <= 0) {
+			return;
+		}
+		for (int i = 0; i < columns.size(); i++) {
+			resize(columns[i], rows + pendingRows + count);
+		}
+		pendingRows += count;
+		if (batches == 0) {
+			flushRows();
+		}
+	};
+
+	void removeRows(int row, int count)
+	{
+		flush();
+		if (row < 0 || count <= 0 || row + count > rows) {
+			return;
+		}
+		beginRemoveRows(QModelIndex(), row, row + count - 1);
+		for (int i = 0; i < columns.size(); i++) {
+			switch (columns.at(i).kind) {
+				case 0: columns[i].ints.remove(row, count); break;
+				case 1: columns[i].floats.remove(row, count); break;
+				default: columns[i].strings.remove(row, count);
+			}
+		}
+		rows -= count;
+		endRemoveRows();
+	};
+
+	void clear()
+	{
+		beginResetModel();
+		for (int i = 0; i < columns.size(); i++) {
+			resize(columns[i], 0);
+		}
+		rows = pendingRows = 0;
+		dirtyTop = -1;
+		endResetModel();
+	};
+
+	template <typename T> bool set(int column, int row, int count, qint64 kind, T fn)
+	{
+		if (column < 0 || column >= columns.size() || columns.at(column).kind != kind || row < 0 || count <= 0 || row + count > rows + pendingRows) {
+			return false;
+		}
+		fn(columns[column]);
+		if (row < rows) {
+			markDirty(column, row, qMin(row + count, rows) - 1);
+		}
+		return true;
+	};
+
+	void beginBatch() { batches++; };
+
+	void endBatch()
+	{
+		if (batches > 0 && --batches == 0) {
+			flush();
+		}
+	};
+
+private:
+	QVector<Column> columns;
+	int rows;
+	int pendingRows;
+	int batches;
+	int dirtyTop, dirtyLeft, dirtyBottom, dirtyRight;
+
+	static void resize(Column& c, int size)
+	{
+		switch (c.kind) {
+			case 0: c.ints.resize(size); break;
+			case 1: c.floats.resize(size); break;
+			default: c.strings.resize(size);
+		}
+	};
+
+	void markDirty(int column, int top, int bottom)
+	{
+		if (dirtyTop < 0) {
+			dirtyTop = top; dirtyBottom = bottom; dirtyLeft = dirtyRight = column;
+		} else {
+			dirtyTop = qMin(dirtyTop, top); dirtyBottom = qMax(dirtyBottom, bottom);
+			dirtyLeft = qMin(dirtyLeft, column); dirtyRight = qMax(dirtyRight, column);
+		}
+		if (batches == 0) {
+			flushData();
+		}
+	};
+
+	void flushRows()
+	{
+		if (pendingRows > 0) {
+			beginInsertRows(QModelIndex(), rows, rows + pendingRows - 1);
+			rows += pendingRows;
+			pendingRows = 0;
+			endInsertRows();
+		}
+	};
+
+	void flushData()
+	{
+		if (dirtyTop >= 0) {
+			QModelIndex topLeft = index(dirtyTop, dirtyLeft);
+			QModelIndex bottomRight = index(dirtyBottom, dirtyRight);
+			dirtyTop = -1;
+			emit dataChanged(topLeft, bottomRight, QVector<int>() << Qt::DisplayRole << Qt::EditRole);
+		}
+	};
+
+	void flush()
+	{
+		flushData();
+		flushRows();
+	};
+};
+
+void* ColumnTableModel_NewColumnTableModel(void* parent)
+{
+	return new GoColumnTableModel(static_cast<QObject*>(parent));
+}
+
+int ColumnTableModel_AddColumn(void* ptr, long long kind, char* header, int len)
+{
+	return static_cast<GoColumnTableModel*>(ptr)->addColumn(kind, QString::fromUtf8(header, len));
+}
+
+void ColumnTableModel_AppendRows(void* ptr, int count)
+{
+	static_cast<GoColumnTableModel*>(ptr)->appendRows(count);
+}
+
+void ColumnTableModel_RemoveRows(void* ptr, int row, int count)
+{
+	static_cast<GoColumnTableModel*>(ptr)->removeRows(row, count);
+}
+
+void ColumnTableModel_Clear(void* ptr)
+{
+	static_cast<GoColumnTableModel*>(ptr)->clear();
+}
+
+char ColumnTableModel_SetInt64s(void* ptr, int column, int row, void* data, int count)
+{
+	return static_cast<GoColumnTableModel*>(ptr)->set(column, row, count, 0, [=](GoColumnTableModel::Column& c) { memcpy(c.ints.data() + row, data, count * sizeof(qint64)); });
+}
+
+char ColumnTableModel_SetFloat64s(void* ptr, int column, int row, void* data, int count)
+{
+	return static_cast<GoColumnTableModel*>(ptr)->set(column, row, count, 1, [=](GoColumnTableModel::Column& c) { memcpy(c.floats.data() + row, data, count * sizeof(double)); });
+}
+
+char ColumnTableModel_SetStrings(void* ptr, int column, int row, char* data, void* lens, int count)
+{
+	return static_cast<GoColumnTableModel*>(ptr)->set(column, row, count, 2, [=](GoColumnTableModel::Column& c) {
+		QString* out = c.strings.data() + row;
+		const char* in = data;
+		for (int i = 0; i < count; i++) {
+			out[i] = QString::fromUtf8(in, static_cast<int*>(lens)[i]);
+			in += static_cast<int*>(lens)[i];
+		}
+	});
+}
+
+void ColumnTableModel_BeginBatch(void* ptr)
+{
+	static_cast<GoColumnTableModel*>(ptr)->beginBatch();
+}
+
+void ColumnTableModel_EndBatch(void* ptr)
+{
+	static_cast<GoColumnTableModel*>(ptr)->endBatch();
+}
+
+//a proxy for flat list and table models that filters and sorts on keys declared up front,
+//so neither the filter nor the comparisons ever call into Go.
+//the sort keys of the accepted rows are extracted once into vectors indexed by source row and sorted in parallel.
+class GoSortFilterProxyModel: public QAbstractProxyModel
+{
+public:
+	enum FilterKind { Contains, Equals, RegExp, Range };
+	enum KeyKind { String, CaseInsensitive, Number };
+
+	struct Filter { int column; int role; qint64 kind; QString text; QRegularExpression re; double min; double max; };
+	struct Key { int column; int role; qint64 kind; bool descending; QVector<QString> strings; QVector<double> numbers; };
+
+	GoSortFilterProxyModel(QObject *parent) : QAbstractProxyModel(parent), pendingReset(false) {};
+
+	void setSourceModel(QAbstractItemModel* model)
+	{
+		if (model == sourceModel()) {
+			return;
+		}
+		beginResetModel();
+		if (sourceModel()) {
+			disconnect(sourceModel(), 0, this, 0);
+		}
+		QAbstractProxyModel::setSourceModel(model);
+		if (model) {
+			connect(model, &QAbstractItemModel::dataChanged, this, &GoSortFilterProxyModel::sourceDataChanged);
+			connect(model, &QAbstractItemModel::rowsInserted, this, &GoSortFilterProxyModel::sourceRowsInserted);
+			connect(model, &QAbstractItemModel::rowsAboutToBeRemoved, this, &GoSortFilterProxyModel::sourceRowsAboutToBeRemoved);
+			connect(model, &QAbstractItemModel::rowsRemoved, this, &GoSortFilterProxyModel::sourceRowsRemoved);
+			connect(model, &QAbstractItemModel::modelAboutToBeReset, this, [this]() { beginResetModel(); });
+			connect(model, &QAbstractItemModel::modelReset, this, [this]() { recompute(); endResetModel(); });
+			connect(model, &QAbstractItemModel::layoutChanged, this, [this]() { invalidate(); });
+			connect(model, &QAbstractItemModel::rowsMoved, this, [this]() { invalidate(); });
+			connect(model, &QAbstractItemModel::columnsInserted, this, [this]() { invalidate(); });
+			connect(model, &QAbstractItemModel::columnsRemoved, this, [this]() { invalidate(); });
+			connect(model, &QAbstractItemModel::columnsMoved, this, [this]() { invalidate(); });
+			connect(model, &QObject::destroyed, this, [this]() { invalidate(); });
+			connect(model, &QAbstractItemModel::headerDataChanged, this, &QAbstractItemModel::headerDataChanged);
+		}
+		recompute();
+		endResetModel();
+	};
+
+	QModelIndex mapToSource(const QModelIndex& proxyIndex) const
+	{
+		if (!proxyIndex.isValid() || !sourceModel() || proxyIndex.row() >= rows.size()) {
+			return QModelIndex();
+		}
+		return sourceModel()->index(rows.at(proxyIndex.row()), proxyIndex.column());
+	};
+
+	QModelIndex mapFromSource(const QModelIndex& sourceIndex) const
+	{
+		if (!sourceIndex.isValid() || sourceIndex.parent().isValid() || sourceIndex.row() >= proxyRows.size() || proxyRows.at(sourceIndex.row()) < 0) {
+			return QModelIndex();
+		}
+		return index(proxyRows.at(sourceIndex.row()), sourceIndex.column());
+	};
+
+	QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const
+	{
+		if (parent.isValid() || row < 0 || row >= rows.size() || column < 0 || column >= columnCount()) {
+			return QModelIndex();
+		}
+		return createIndex(row, column);
+	};
+
+	QModelIndex parent(const QModelIndex&) const { return QModelIndex(); };
+	int rowCount(const QModelIndex& parent = QModelIndex()) const { return parent.isValid() ? 0 : rows.size(); };
+	int columnCount(const QModelIndex& parent = QModelIndex()) const { return parent.isValid() || !sourceModel() ? 0 : sourceModel()->columnCount(); };
+
+	//called by views with sorting enabled, the column replaces the sort keys and is compared by its display role
+	void sort(int column, Qt::SortOrder order)
+	{
+		keys.clear();
+		if (column >= 0 && sourceModel()) {
+			QVariant v = rows.isEmpty() ? QVariant() : sourceModel()->index(rows.first(), column).data();
+			Key k = { column, Qt::DisplayRole, v.userType() != QMetaType::QString && v.canConvert<double>() ? Number : String, order == Qt::DescendingOrder, QVector<QString>(), QVector<double>() };
+			keys.append(k);
+		}
+		resort();
+	};
+
+	void clearFilters() { filters.clear(); };
+
+	void addFilter(int column, int role, qint64 kind, const QString& text, double min, double max)
+	{
+		Filter f = { column, role, kind, text, QRegularExpression(), min, max };
+		if (kind == RegExp) {
+			f.re.setPattern(text);
+			f.re.optimize();
+		}
+		filters.append(f);
+	};
+
+	void clearSortKeys() { keys.clear(); };
+
+	void addSortKey(int column, int role, qint64 kind, bool descending)
+	{
+		Key k = { column, role, kind, descending, QVector<QString>(), QVector<double>() };
+		keys.append(k);
+	};
+
+	//filters and sorts everything again, views are reset
+	void invalidate()
+	{
+		beginResetModel();
+		recompute();
+		endResetModel();
+	};
+
+	//sorts the accepted rows again without a reset, so selections and the current index survive
+	void resort()
+	{
+		emit layoutAboutToBeChanged();
+		QModelIndexList from = persistentIndexList();
+		QVector<QPair<int, int> > sources;
+		for (int i = 0; i < from.size(); i++) {
+			sources.append(qMakePair(rows.value(from.at(i).row(), -1), from.at(i).column()));
+		}
+
+		for (int k = 0; k < keys.size(); k++) {
+			resizeKey(keys[k], proxyRows.size());
+		}
+		for (int i = 0; i < rows.size(); i++) {
+			extract(rows.at(i));
+		}
+		sortRows();
+
+		QModelIndexList to;
+		for (int i = 0; i < sources.size(); i++) {
+			to.append(sources.at(i).first >= 0 ? index(proxyRows.at(sources.at(i).first), sources.at(i).second) : QModelIndex());
+		}
+		changePersistentIndexList(from, to);
+		emit layoutChanged();
+	};
+
+private:
+	QVector<Filter> filters;
+	QVector<Key> keys;
+	QVector<int> rows;      //the source row of every proxy row
+	QVector<int> proxyRows; //the proxy row of every source row, -1 if it's filtered out
+	bool pendingReset;
+
+	bool accepts(int row) const
+	{
+		for (int i = 0; i < filters.size(); i++) {
+			const Filter& f = filters.at(i);
+			QVariant v = sourceModel()->index(row, f.column).data(f.role);
+			bool ok;
+			switch (f.kind) {
+				case Contains: ok = v.toString().contains(f.text, Qt::CaseInsensitive); break;
+				case Equals: ok = v.toString() == f.text; break;
+				case RegExp: ok = f.re.match(v.toString()).hasMatch(); break;
+				default: { double d = v.toDouble(); ok = d >= f.min && d <= f.max; }
+			}
+			if (!ok) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	static void resizeKey(Key& k, int size)
+	{
+		if (k.kind == Number) {
+			k.numbers.resize(size);
+		} else {
+			k.strings.resize(size);
+		}
+	};
+
+	void extract(int row)
+	{
+		for (int i = 0; i < keys.size(); i++) {
+			Key& k = keys[i];
+			QVariant v = sourceModel()->index(row, k.column).data(k.role);
+			switch (k.kind) {
+				case Number: k.numbers[row] = v.toDouble(); break;
+				case CaseInsensitive: k.strings[row] = v.toString().toCaseFolded(); break;
+				default: k.strings[row] = v.toString();
+			}
+		}
+	};
+
+	//orders source rows by their extracted keys and by their source position on ties,
+	//it only reads, so the sort threads can share it
+	bool less(int a, int b) const
+	{
+		for (int i = 0; i < keys.size(); i++) {
+			const Key& k = keys.at(i);
+			int c;
+			if (k.kind == Number) {
+				double x = k.numbers.at(a), y = k.numbers.at(b);
+				c = x < y ? -1 : (y < x ? 1 : 0);
+			} else {
+				c = k.strings.at(a).compare(k.strings.at(b));
+			}
+			if (c != 0) {
+				return k.descending ? c > 0 : c < 0;
+			}
+		}
+		return a < b;
+	};
+
+	//a merge sort that sorts one chunk per core and then merges the chunks pairwise, small inputs are sorted on the calling thread
+	void sortRows()
+	{
+		auto cmp = [this](int a, int b) { return less(a, b); };
+		int threads = qMin(QThread::idealThreadCount(), rows.size() / 16384);
+		if (threads < 2) {
+			std::sort(rows.begin(), rows.end(), cmp);
+		} else {
+			QVector<int*> bounds;
+			for (int i = 0; i <= threads; i++) {
+				bounds.append(rows.data() + qint64(rows.size()) * i / threads);
+			}
+			std::vector<std::thread> workers;
+			for (int i = 0; i < threads; i++) {
+				workers.push_back(std::thread([&bounds, &cmp, i]() { std::sort(bounds.at(i), bounds.at(i + 1), cmp); }));
+			}
+			for (size_t i = 0; i < workers.size(); i++) {
+				workers[i].join();
+			}
+			for (int width = 1; width < threads; width *= 2) {
+				workers.clear();
+				for (int i = 0; i + width < threads; i += 2 * width) {
+					int end = qMin(i + 2 * width, threads);
+					workers.push_back(std::thread([&bounds, &cmp, i, width, end]() { std::inplace_merge(bounds.at(i), bounds.at(i + width), bounds.at(end), cmp); }));
+				}
+				for (size_t i = 0; i < workers.size(); i++) {
+					workers[i].join();
+				}
+			}
+		}
+		updateProxyRows(0);
+	};
+
+	void updateProxyRows(int from)
+	{
+		for (int i = from; i < rows.size(); i++) {
+			proxyRows[rows.at(i)] = i;
+		}
+	};
+
+	//the proxy row a source row with extracted keys belongs at
+	int position(int row) const
+	{
+		return std::lower_bound(rows.begin(), rows.end(), row, [this](int a, int b) { return less(a, b); }) - rows.begin();
+	};
+
+	void recompute()
+	{
+		int sourceRows = sourceModel() ? sourceModel()->rowCount() : 0;
+		rows.clear();
+		proxyRows.fill(-1, sourceRows);
+		for (int k = 0; k < keys.size(); k++) {
+			keys[k].strings.clear();
+			keys[k].numbers.clear();
+			resizeKey(keys[k], sourceRows);
+		}
+		for (int row = 0; row < sourceRows; row++) {
+			if (accepts(row)) {
+				extract(row);
+				rows.append(row);
+			}
+		}
+		sortRows();
+	};
+
+	template <typename T> static bool affected(const QVector<T>& v, int left, int right, const QVector<int>& roles)
+	{
+		for (int i = 0; i < v.size(); i++) {
+			if (v.at(i).column >= left && v.at(i).column <= right && (roles.isEmpty() || roles.contains(v.at(i).role))) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+	void insertRow(int row)
+	{
+		extract(row);
+		int p = position(row);
+		beginInsertRows(QModelIndex(), p, p);
+		rows.insert(p, row);
+		updateProxyRows(p);
+		endInsertRows();
+	};
+
+	void removeRow(int p)
+	{
+		beginRemoveRows(QModelIndex(), p, p);
+		proxyRows[rows.at(p)] = -1;
+		rows.remove(p);
+		updateProxyRows(p);
+		endRemoveRows();
+	};
+
+	void moveRow(int row)
+	{
+		int p = proxyRows.at(row);
+		extract(row);
+		rows.remove(p);
+		int q = position(row);
+		rows.insert(p, row);
+		if (q != p && beginMoveRows(QModelIndex(), p, p, QModelIndex(), q > p ? q + 1 : q)) {
+			rows.remove(p);
+			rows.insert(q, row);
+			updateProxyRows(qMin(p, q));
+			endMoveRows();
+		}
+	};
+
+	//only the changed rows are filtered again, a single changed row is moved to its new position
+	//and larger changes of a sort column sort again
+	void sourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles)
+	{
+		if (topLeft.parent().isValid()) {
+			return;
+		}
+		int top = topLeft.row(), bottom = bottomRight.row();
+		bool filtered = affected(filters, topLeft.column(), bottomRight.column(), roles);
+		bool sorted = affected(keys, topLeft.column(), bottomRight.column(), roles);
+		if ((filtered || sorted) && bottom - top >= 1024) {
+			invalidate();
+			return;
+		}
+
+		if (filtered || sorted) {
+			QVector<int> accepted;
+			for (int row = top; row <= bottom; row++) {
+				int p = proxyRows.at(row);
+				bool ok = accepts(row);
+				if (!ok && p >= 0) {
+					removeRow(p);
+				} else if (ok && p < 0) {
+					accepted.append(row);
+				} else if (ok && sorted && top == bottom) {
+					moveRow(row);
+				}
+			}
+			if (sorted && top != bottom) {
+				resort();
+			}
+			for (int i = 0; i < accepted.size(); i++) {
+				insertRow(accepted.at(i));
+			}
+		}
+
+		int first = rows.size(), last = -1;
+		for (int row = top; row <= bottom; row++) {
+			int p = proxyRows.at(row);
+			if (p >= 0) {
+				first = qMin(first, p);
+				last = qMax(last, p);
+			}
+		}
+		if (last >= 0) {
+			emit dataChanged(index(first, topLeft.column()), index(last, bottomRight.column()), roles);
+		}
+	};
+
+	void sourceRowsInserted(const QModelIndex& parent, int first, int last)
+	{
+		if (parent.isValid()) {
+			return;
+		}
+		int count = last - first + 1;
+		if (!keys.isEmpty() && count >= 1024) {
+			invalidate();
+			return;
+		}
+
+		for (int i = 0; i < rows.size(); i++) {
+			if (rows.at(i) >= first) {
+				rows[i] += count;
+			}
+		}
+		proxyRows.insert(first, count, -1);
+		updateProxyRows(0);
+		for (int k = 0; k < keys.size(); k++) {
+			if (keys.at(k).kind == Number) {
+				keys[k].numbers.insert(first, count, 0);
+			} else {
+				keys[k].strings.insert(first, count, QString());
+			}
+		}
+
+		if (!keys.isEmpty()) {
+			for (int row = first; row <= last; row++) {
+				if (accepts(row)) {
+					insertRow(row);
+				}
+			}
+			return;
+		}
+		//unsorted rows keep the source order, so the accepted ones are inserted as one block
+		QVector<int> accepted;
+		for (int row = first; row <= last; row++) {
+			if (accepts(row)) {
+				accepted.append(row);
+			}
+		}
+		if (!accepted.isEmpty()) {
+			int p = position(first);
+			beginInsertRows(QModelIndex(), p, p + accepted.size() - 1);
+			for (int i = 0; i < accepted.size(); i++) {
+				rows.insert(p + i, accepted.at(i));
+			}
+			updateProxyRows(p);
+			endInsertRows();
+		}
+	};
+
+	void sourceRowsAboutToBeRemoved(const QModelIndex& parent, int first, int last)
+	{
+		if (parent.isValid()) {
+			return;
+		}
+		if (!keys.isEmpty() && last - first >= 1024) {
+			pendingReset = true;
+			beginResetModel();
+			return;
+		}
+		if (!keys.isEmpty()) {
+			for (int row = first; row <= last; row++) {
+				if (proxyRows.at(row) >= 0) {
+					removeRow(proxyRows.at(row));
+				}
+			}
+			return;
+		}
+		int p = position(first), q = position(last + 1);
+		if (q > p) {
+			beginRemoveRows(QModelIndex(), p, q - 1);
+			for (int row = first; row <= last; row++) {
+				proxyRows[row] = -1;
+			}
+			rows.remove(p, q - p);
+			updateProxyRows(p);
+			endRemoveRows();
+		}
+	};
+
+	void sourceRowsRemoved(const QModelIndex& parent, int first, int last)
+	{
+		if (parent.isValid()) {
+			return;
+		}
+		if (pendingReset) {
+			pendingReset = false;
+			recompute();
+			endResetModel();
+			return;
+		}
+		int count = last - first + 1;
+		for (int i = 0; i < rows.size(); i++) {
+			if (rows.at(i) > last) {
+				rows[i] -= count;
+			}
+		}
+		proxyRows.remove(first, count);
+		for (int k = 0; k < keys.size(); k++) {
+			if (keys.at(k).kind == Number) {
+				keys[k].numbers.remove(first, count);
+			} else {
+				keys[k].strings.remove(first, count);
+			}
+		}
+	};
+};
+
+void* SortFilterProxyModel_NewSortFilterProxyModel(void* parent)
+{
+	return new GoSortFilterProxyModel(static_cast<QObject*>(parent));
+}
+
+void SortFilterProxyModel_ClearFilters(void* ptr)
+{
+	static_cast<GoSortFilterProxyModel*>(ptr)->clearFilters();
+}
+
+void SortFilterProxyModel_AddFilter(void* ptr, int column, int role, long long kind, char* text, int len, double min, double max)
+{
+	static_cast<GoSortFilterProxyModel*>(ptr)->addFilter(column, role, kind, QString::fromUtf8(text, len), min, max);
+}
+
+void SortFilterProxyModel_ClearSortKeys(void* ptr)
+{
+	static_cast<GoSortFilterProxyModel*>(ptr)->clearSortKeys();
+}
+
+void SortFilterProxyModel_AddSortKey(void* ptr, int column, int role, long long kind, char descending)
+{
+	static_cast<GoSortFilterProxyModel*>(ptr)->addSortKey(column, role, kind, descending != 0);
+}
+
+void SortFilterProxyModel_Invalidate(void* ptr)
+{
+	static_cast<GoSortFilterProxyModel*>(ptr)->invalidate();
+}
+
+void SortFilterProxyModel_Resort(void* ptr)
+{
+	static_cast<GoSortFilterProxyModel*>(ptr)->resort();
+}
+
+//a property or method name that is resolved once per meta object,
+//the meta object of the last call is checked first, so repeated calls on objects of one class skip the hash lookup
+class GoMetaHandle
+{
+public:
+	GoMetaHandle(const QByteArray& n, bool method) : method(method), parameters(0), last(0), lastIndex(-1)
+	{
+		if (method) {
+			QByteArray full = n;
+			if (!full.contains('(')) {
+				full.append("()");
+			}
+			signature = QMetaObject::normalizedSignature(full.constData());
+			name = signature.left(signature.indexOf('('));
+			parameters = signature.count(',') + (signature.endsWith("()") ? 0 : 1);
+		} else {
+			name = n;
+		}
+	};
+
+	int resolve(QObject* object)
+	{
+		//the meta objects of qml items are created and freed with them, so a cached index is only used if it still matches.
+		//misses are cached as -1 and trusted, so names that don't exist on a class aren't looked up again on every call
+		const QMetaObject* meta = object->metaObject();
+		if (meta == last && (lastIndex < 0 || matches(meta, lastIndex))) {
+			return lastIndex;
+		}
+		QHash<const QMetaObject*, int>::const_iterator it = indexes.constFind(meta);
+		int index;
+		if (it != indexes.constEnd() && (it.value() < 0 || matches(meta, it.value()))) {
+			index = it.value();
+		} else {
+			index = method ? meta->indexOfMethod(signature.constData()) : meta->indexOfProperty(name.constData());
+			indexes.insert(meta, index);
+		}
+		last = meta;
+		lastIndex = index;
+		return index;
+	};
+
+	QMetaProperty property(QObject* object) { int i = resolve(object); return i < 0 ? QMetaProperty() : last->property(i); };
+
+	bool invoke(QObject* object, QGenericArgument arg = QGenericArgument())
+	{
+		int i = resolve(object);
+		return i >= 0 && last->method(i).invoke(object, Qt::AutoConnection, arg);
+	};
+
+private:
+	bool matches(const QMetaObject* meta, int index)
+	{
+		if (method) {
+			QMetaMethod m = meta->method(index);
+			return m.parameterCount() == parameters && m.name() == name;
+		}
+		return qstrcmp(meta->property(index).name(), name.constData()) == 0;
+	};
+
+	bool method;
+	QByteArray name;
+	QByteArray signature;
+	int parameters;
+	const QMetaObject* last;
+	int lastIndex;
+	QHash<const QMetaObject*, int> indexes;
+};
+
+void* MetaHandle_NewMetaHandle(char* name, int len, char method)
+{
+	return new GoMetaHandle(QByteArray(name, len), method != 0);
+}
+
+void MetaHandle_DestroyMetaHandle(void* ptr)
+{
+	delete static_cast<GoMetaHandle*>(ptr);
+}
+
+char MetaHandle_IsValid(void* ptr, void* object)
+{
+	return static_cast<GoMetaHandle*>(ptr)->resolve(static_cast<QObject*>(object)) >= 0;
+}
+
+void* MetaProperty_Read(void* ptr, void* object)
+{
+	return new QVariant(static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).read(static_cast<QObject*>(object)));
+}
+
+long long MetaProperty_ReadInt(void* ptr, void* object)
+{
+	return static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).read(static_cast<QObject*>(object)).toLongLong();
+}
+
+double MetaProperty_ReadFloat(void* ptr, void* object)
+{
+	return static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).read(static_cast<QObject*>(object)).toDouble();
+}
+
+char MetaProperty_ReadBool(void* ptr, void* object)
+{
+	return static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).read(static_cast<QObject*>(object)).toBool();
+}
+
+void* MetaProperty_ReadString(void* ptr, void* object, char** data, long long* len)
+{
+	return goByteBuffer(static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).read(static_cast<QObject*>(object)).toString().toUtf8(), data, len);
+}
+
+char MetaProperty_Write(void* ptr, void* object, void* value)
+{
+	return static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).write(static_cast<QObject*>(object), *static_cast<QVariant*>(value));
+}
+
+char MetaProperty_WriteInt(void* ptr, void* object, long long v)
+{
+	return static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).write(static_cast<QObject*>(object), v == qint64(int(v)) ? QVariant(int(v)) : QVariant(v));
+}
+
+char MetaProperty_WriteFloat(void* ptr, void* object, double v)
+{
+	return static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).write(static_cast<QObject*>(object), v);
+}
+
+char MetaProperty_WriteBool(void* ptr, void* object, char v)
+{
+	return static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).write(static_cast<QObject*>(object), v != 0);
+}
+
+char MetaProperty_WriteString(void* ptr, void* object, char* v, int len)
+{
+	return static_cast<GoMetaHandle*>(ptr)->property(static_cast<QObject*>(object)).write(static_cast<QObject*>(object), QString::fromUtf8(v, len));
+}
+
+char MetaMethod_Invoke(void* ptr, void* object)
+{
+	return static_cast<GoMetaHandle*>(ptr)->invoke(static_cast<QObject*>(object));
+}
+
+char MetaMethod_InvokeInt(void* ptr, void* object, int v)
+{
+	return static_cast<GoMetaHandle*>(ptr)->invoke(static_cast<QObject*>(object), Q_ARG(int, v));
+}
+
+char MetaMethod_InvokeFloat(void* ptr, void* object, double v)
+{
+	return static_cast<GoMetaHandle*>(ptr)->invoke(static_cast<QObject*>(object), Q_ARG(double, v));
+}
+
+char MetaMethod_InvokeBool(void* ptr, void* object, char v)
+{
+	bool b = v != 0;
+	return static_cast<GoMetaHandle*>(ptr)->invoke(static_cast<QObject*>(object), Q_ARG(bool, b));
+}
+
+char MetaMethod_InvokeString(void* ptr, void* object, char* v, int len)
+{
+	QString s = QString::fromUtf8(v, len);
+	return static_cast<GoMetaHandle*>(ptr)->invoke(static_cast<QObject*>(object), Q_ARG(QString, s));
+}
+
+char MetaMethod_InvokeVariant(void* ptr, void* object, void* v)
+{
+	return static_cast<GoMetaHandle*>(ptr)->invoke(static_cast<QObject*>(object), Q_ARG(QVariant, *static_cast<QVariant*>(v)));
+}
+
+class GoArena
+{
+public:
+	struct Block { char* data; size_t size; };
+	struct Object { void (*destructor)(void*); void* ptr; };
+
+	GoArena() : current(0), offset(0) {};
+	~GoArena() { reset(); for (int i = 0; i < blocks.size(); i++) free(blocks.at(i).data); };
+
+	void* alloc(size_t size, size_t align, void (*destructor)(void*))
+	{
+		offset = (offset + align - 1) & ~(align - 1);
+		while (current < blocks.size() && offset + size > blocks.at(current).size) {
+			current++;
+			offset = 0;
+		}
+		if (current == blocks.size()) {
+			Block b = { static_cast<char*>(malloc(qMax<size_t>(size, 4096))), qMax<size_t>(size, 4096) };
+			blocks.append(b);
+		}
+		void* ptr = blocks.at(current).data + offset;
+		offset += size;
+		if (destructor) {
+			Object o = { destructor, ptr };
+			objects.append(o);
+		}
+		return ptr;
+	};
+
+	void reset()
+	{
+		for (int i = objects.size() - 1; i >= 0; i--) {
+			objects.at(i).destructor(objects.at(i).ptr);
+		}
+		objects.clear();
+		current = 0;
+		offset = 0;
+	};
+
+private:
+	QVector<Block> blocks;
+	QVector<Object> objects;
+	int current;
+	size_t offset;
+};
+
+void* GoArena_New()
+{
+	return new GoArena();
+}
+
+void* GoArena_Alloc(void* ptr, long long size, long long align, void (*destructor)(void*))
+{
+	return static_cast<GoArena*>(ptr)->alloc(size, align, destructor);
+}
+
+void GoArena_Reset(void* ptr)
+{
+	static_cast<GoArena*>(ptr)->reset();
+}
+
+void GoArena_Free(void* ptr)
+{
+	delete static_cast<GoArena*>(ptr);
+}
+
+class GoCommandBuffer
+{
+public:
+	enum Op { SetInt, SetFloat, SetBool, SetString, SetRect, Invoke };
+
+	~GoCommandBuffer() { qDeleteAll(properties); qDeleteAll(methods); };
+
+	int addName(const QByteArray& name)
+	{
+		properties.append(new GoMetaHandle(name, false));
+		methods.append(new GoMetaHandle(name, true));
+		return properties.size() - 1;
+	};
+
+	void flush(GoCommand* cmds, int count, const char* strs)
+	{
+		//the objects have to be alive when the flush starts, but a command can still delete the object of a later one
+		QVector<QPointer<QObject> > objects(count);
+		for (int i = 0; i < count; i++) {
+			objects[i] = reinterpret_cast<QObject*>(cmds[i].object);
+		}
+
+		for (int i = 0; i < count; i++) {
+			const GoCommand& c = cmds[i];
+			QObject* object = objects.at(i).data();
+			if (!object) {
+				continue;
+			}
+			//the handles re-check cached indexes, as the meta objects of qml items can be freed and their address reused
+			GoMetaHandle* handle = c.op == Invoke ? methods.at(c.name) : properties.at(c.name);
+			int index = handle->resolve(object);
+			if (index < 0) {
+				continue;
+			}
+			if (c.op == Invoke) {
+				object->metaObject()->method(index).invoke(object, Qt::DirectConnection);
+				continue;
+			}
+			QVariant v;
+			switch (c.op) {
+			case SetInt: v = c.v[0]; break;
+			case SetFloat: v = c.f; break;
+			case SetBool: v = c.v[0] != 0; break;
+			case SetString: v = QString::fromUtf8(strs + c.v[0], c.v[1]); break;
+			case SetRect: v = QRect(c.v[0], c.v[1], c.v[2], c.v[3]); break;
+			}
+			object->metaObject()->property(index).write(object, v);
+		}
+	};
+
+private:
+	//one handle per name and kind, they are created with the name and resolved per class
+	QVector<GoMetaHandle*> properties;
+	QVector<GoMetaHandle*> methods;
+};
+
+class GoCommandEvent: public QEvent
+{
+public:
+	GoCommandEvent(GoCommandBuffer* buffer, GoCommand* cmds, int count, const char* strs, QSemaphore* done) : QEvent(QEvent::User), buffer(buffer), cmds(cmds), count(count), strs(strs), done(done) {};
+
+	GoCommandBuffer* buffer;
+	GoCommand* cmds;
+	int count;
+	const char* strs;
+	QSemaphore* done;
+};
+
+class GoCommandReceiver: public QObject
+{
+public:
+	bool event(QEvent* e)
+	{
+		if (e->type() != QEvent::User) {
+			return QObject::event(e);
+		}
+		GoCommandEvent* c = static_cast<GoCommandEvent*>(e);
+		c->buffer->flush(c->cmds, c->count, c->strs);
+		c->done->release();
+		return true;
+	};
+};
+
+void* CommandBuffer_NewCommandBuffer()
+{
+	return new GoCommandBuffer();
+}
+
+int CommandBuffer_AddName(void* ptr, char* name, int len)
+{
+	return static_cast<GoCommandBuffer*>(ptr)->addName(QByteArray(name, len));
+}
+
+void CommandBuffer_Flush(void* ptr, struct GoCommand* cmds, int count, char* strs)
+{
+	QCoreApplication* app = QCoreApplication::instance();
+	if (!app || app->thread() == QThread::currentThread()) {
+		static_cast<GoCommandBuffer*>(ptr)->flush(cmds, count, strs);
+		return;
+	}
+
+	//replay on the gui thread and block until it is done, the commands live in go memory of the caller
+	static GoCommandReceiver* receiver = [app]() { GoCommandReceiver* r = new GoCommandReceiver(); r->moveToThread(app->thread()); return r; }();
+	QSemaphore done;
+	QCoreApplication::postEvent(receiver, new GoCommandEvent(static_cast<GoCommandBuffer*>(ptr), cmds, count, strs, &done));
+	done.acquire();
+}
+
+void CommandBuffer_DestroyCommandBuffer(void* ptr)
+{
+	delete static_cast<GoCommandBuffer*>(ptr);
+}
+
+class GoMainQueueReceiver: public QObject
+{
+public:
+	static QEvent::Type type() { static QEvent::Type t = static_cast<QEvent::Type>(QEvent::registerEventType()); return t; };
+
+	bool event(QEvent* e)
+	{
+		if (e->type() != type()) {
+			return QObject::event(e);
+		}
+		callbackGoMainQueue();
+		return true;
+	};
+};
+
+void GoMainQueue_Wakeup()
+{
+	QCoreApplication* app = QCoreApplication::instance();
+	if (!app) {
+		return;
+	}
+	static GoMainQueueReceiver* receiver = [app]() { GoMainQueueReceiver* r = new GoMainQueueReceiver(); r->moveToThread(app->thread()); return r; }();
+	QCoreApplication::postEvent(receiver, new QEvent(GoMainQueueReceiver::type()));
+}
+
+//without an application there is no main thread yet, so functions get queued until its event loop starts
+char GoMainQueue_IsMainThread()
+{
+	QCoreApplication* app = QCoreApplication::instance();
+	return app && app->thread() == QThread::currentThread();
+}
+
+//functions queued before the application existed run once its event loop starts
+static void goMainQueueStartup()
+{
+	GoMainQueue_Wakeup();
+}
+Q_COREAPP_STARTUP_FUNCTION(goMainQueueStartup)
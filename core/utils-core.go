@@ -0,0 +1,1150 @@
+package core
+
+//#include <stdint.h>
+//#include <stdlib.h>
+//#include "utils-core.h"
+import "C"
+import (
+	"encoding/binary"
+	"encoding/json"
+	"errors"
+	"github.com/therecipe/qt"
+	"math"
+	"reflect"
+	"runtime"
+	"sync"
+	"unicode/utf16"
+	"unsafe"
+)
+
+//ConnectReadDataBuffer overrides readData with a callback that fills data directly.
+//data aliases the destination buffer of the C++ caller and is only valid during the call,
+//f has to return the number of bytes written to it or -1 on error.
+//It takes precedence over ConnectReadData.
+func (ptr *QIODevice) ConnectReadDataBuffer(f func(data []byte) int64) {
+	if ptr.Pointer() != nil {
+
+		qt.ConnectSignal(ptr.Pointer(), "readDataBuffer", f)
+	}
+}
+
+func (ptr *QIODevice) DisconnectReadDataBuffer() {
+	if ptr.Pointer() != nil {
+
+		qt.DisconnectSignal(ptr.Pointer(), "readDataBuffer")
+	}
+}
+
+//ConnectWriteDataBuffer overrides writeData with a callback that reads data directly.
+//data aliases the source buffer of the C++ caller, it must not be modified and is only valid during the call,
+//f has to return the number of bytes consumed or -1 on error.
+//It takes precedence over ConnectWriteData.
+func (ptr *QIODevice) ConnectWriteDataBuffer(f func(data []byte) int64) {
+	if ptr.Pointer() != nil {
+
+		qt.ConnectSignal(ptr.Pointer(), "writeDataBuffer", f)
+	}
+}
+
+func (ptr *QIODevice) DisconnectWriteDataBuffer() {
+	if ptr.Pointer() != nil {
+
+		qt.DisconnectSignal(ptr.Pointer(), "writeDataBuffer")
+	}
+}
+
+//ConnectDataInto overrides data with a callback that stores the value in ret,
+//ret is owned by the C++ caller, so it doesn't need to be destroyed and must not be used after the call.
+//Leaving ret untouched returns an invalid QVariant.
+//It takes precedence over ConnectData and avoids allocating a QVariant for every call.
+//ConnectData on the other hand copies the variant its callback returns,
+//which stays owned by the callback (or its finalizer), so it may be cached and returned again.
+func (ptr *QAbstractItemModel) ConnectDataInto(f func(index *QModelIndex, role int, ret *QVariant)) {
+	if ptr.Pointer() != nil {
+
+		qt.ConnectSignal(ptr.Pointer(), "dataInto", f)
+	}
+}
+
+func (ptr *QAbstractItemModel) DisconnectDataInto() {
+	if ptr.Pointer() != nil {
+
+		qt.DisconnectSignal(ptr.Pointer(), "dataInto")
+	}
+}
+
+//Assign copies the value of other into the variant.
+func (ptr *QVariant) Assign(other QVariant_ITF) {
+	if ptr.Pointer() != nil && PointerFromQVariant(other) != nil {
+		C.QVariant_Assign(ptr.Pointer(), PointerFromQVariant(other))
+		runtime.KeepAlive(other)
+	}
+}
+
+//DeleteQVariant destroys and frees a heap allocated QVariant, unlike DestroyQVariant which only destroys it.
+//It must not be used on variants owned by an Arena or by C++.
+func (ptr *QVariant) DeleteQVariant() {
+	if ptr.Pointer() != nil {
+		C.QVariant_DeleteQVariant(ptr.Pointer())
+		ptr.SetPointer(nil)
+	}
+}
+
+func (ptr *QVariant) SetBool(v bool) {
+	if ptr.Pointer() != nil {
+		C.QVariant_SetBool(ptr.Pointer(), C.char(int8(qt.GoBoolToInt(v))))
+	}
+}
+
+func (ptr *QVariant) SetInt(v int) {
+	if ptr.Pointer() != nil {
+		C.QVariant_SetInt(ptr.Pointer(), C.int(int32(v)))
+	}
+}
+
+func (ptr *QVariant) SetFloat(v float64) {
+	if ptr.Pointer() != nil {
+		C.QVariant_SetFloat(ptr.Pointer(), C.double(v))
+	}
+}
+
+//SetString converts v to a QString without copying it to C memory first.
+func (ptr *QVariant) SetString(v string) {
+	if ptr.Pointer() != nil {
+		C.QVariant_SetString(ptr.Pointer(), (*C.char)(unsafe.Pointer((*reflect.StringHeader)(unsafe.Pointer(&v)).Data)), C.int(int32(len(v))))
+	}
+}
+
+//the tags of the packed value format of GoValueWriter and GoValueReader in utils-core.cpp,
+//numbers are little endian like on every supported target and strings are utf8 prefixed with their int32 length
+const (
+	goValueNil = iota
+	goValueBool
+	goValueInt
+	goValueUint
+	goValueFloat
+	goValueString
+	goValueBytes
+	goValueList
+	goValueMap
+	goValueObject
+	goValueOther
+)
+
+func appendGoValueUint(b []byte, v uint64) []byte {
+	return append(b, byte(v), byte(v>>8), byte(v>>16), byte(v>>24), byte(v>>32), byte(v>>40), byte(v>>48), byte(v>>56))
+}
+
+func appendGoValueString(b []byte, v string) []byte {
+	var n = uint32(len(v))
+	return append(append(b, byte(n), byte(n>>8), byte(n>>16), byte(n>>24)), v...)
+}
+
+func appendGoValueLen(b []byte, tag byte, n int) []byte {
+	return append(b, tag, byte(n), byte(n>>8), byte(n>>16), byte(n>>24))
+}
+
+func appendGoValue(b []byte, v interface{}) []byte {
+	switch v := v.(type) {
+	case nil:
+		return append(b, goValueNil)
+	case bool:
+		return append(b, goValueBool, byte(qt.GoBoolToInt(v)))
+	case int:
+		return appendGoValueUint(append(b, goValueInt), uint64(v))
+	case int64:
+		return appendGoValueUint(append(b, goValueInt), uint64(v))
+	case int32:
+		return appendGoValueUint(append(b, goValueInt), uint64(v))
+	case uint:
+		return appendGoValueUint(append(b, goValueUint), uint64(v))
+	case uint64:
+		return appendGoValueUint(append(b, goValueUint), v)
+	case float64:
+		return appendGoValueUint(append(b, goValueFloat), math.Float64bits(v))
+	case float32:
+		return appendGoValueUint(append(b, goValueFloat), math.Float64bits(float64(v)))
+	case string:
+		return appendGoValueString(append(b, goValueString), v)
+	case []byte:
+		return appendGoValueString(append(b, goValueBytes), string(v))
+	case []interface{}:
+		b = appendGoValueLen(b, goValueList, len(v))
+		for _, v := range v {
+			b = appendGoValue(b, v)
+		}
+		return b
+	case []string:
+		b = appendGoValueLen(b, goValueList, len(v))
+		for _, v := range v {
+			b = appendGoValueString(append(b, goValueString), v)
+		}
+		return b
+	case map[string]interface{}:
+		b = appendGoValueLen(b, goValueMap, len(v))
+		for k, v := range v {
+			b = appendGoValue(appendGoValueString(b, k), v)
+		}
+		return b
+	case *QVariant:
+		if v.Pointer() == nil {
+			return append(b, goValueNil)
+		}
+		return appendGoValueUint(append(b, goValueOther), uint64(uintptr(v.Pointer())))
+	case QObject_ITF:
+		return appendGoValueUint(append(b, goValueObject), uint64(uintptr(PointerFromQObject(v))))
+	}
+
+	var rv = reflect.ValueOf(v)
+	switch rv.Kind() {
+	case reflect.Int, reflect.Int8, reflect.Int16, reflect.Int32, reflect.Int64:
+		return appendGoValueUint(append(b, goValueInt), uint64(rv.Int()))
+	case reflect.Uint, reflect.Uint8, reflect.Uint16, reflect.Uint32, reflect.Uint64, reflect.Uintptr:
+		return appendGoValueUint(append(b, goValueUint), rv.Uint())
+	case reflect.Float32, reflect.Float64:
+		return appendGoValueUint(append(b, goValueFloat), math.Float64bits(rv.Float()))
+	case reflect.Bool:
+		return append(b, goValueBool, byte(qt.GoBoolToInt(rv.Bool())))
+	case reflect.String:
+		return appendGoValueString(append(b, goValueString), rv.String())
+	case reflect.Slice, reflect.Array:
+		b = appendGoValueLen(b, goValueList, rv.Len())
+		for i := 0; i < rv.Len(); i++ {
+			b = appendGoValue(b, rv.Index(i).Interface())
+		}
+		return b
+	case reflect.Map:
+		if rv.Type().Key().Kind() == reflect.String {
+			b = appendGoValueLen(b, goValueMap, rv.Len())
+			for _, k := range rv.MapKeys() {
+				b = appendGoValue(appendGoValueString(b, k.String()), rv.MapIndex(k).Interface())
+			}
+			return b
+		}
+	case reflect.Ptr, reflect.Interface:
+		if !rv.IsNil() {
+			return appendGoValue(b, rv.Elem().Interface())
+		}
+	}
+	return append(b, goValueNil)
+}
+
+type goValueDecoder struct {
+	b []byte
+	i int
+}
+
+func (d *goValueDecoder) uint64() uint64 {
+	var v = binary.LittleEndian.Uint64(d.b[d.i:])
+	d.i += 8
+	return v
+}
+
+func (d *goValueDecoder) len() int {
+	var v = int(int32(binary.LittleEndian.Uint32(d.b[d.i:])))
+	d.i += 4
+	return v
+}
+
+func (d *goValueDecoder) string() string {
+	var n = d.len()
+	d.i += n
+	return string(d.b[d.i-n : d.i])
+}
+
+//pointers are stored as 64 bit values, on 32 bit targets the pointer is the first half of them
+func (d *goValueDecoder) pointer() unsafe.Pointer {
+	var p = *(*unsafe.Pointer)(unsafe.Pointer(&d.b[d.i]))
+	d.i += 8
+	return p
+}
+
+func (d *goValueDecoder) value() interface{} {
+	var tag = d.b[d.i]
+	d.i++
+	switch tag {
+	case goValueBool:
+		d.i++
+		return d.b[d.i-1] != 0
+	case goValueInt:
+		var v = int64(d.uint64())
+		if int64(int(v)) == v {
+			return int(v)
+		}
+		return v
+	case goValueUint:
+		var v = d.uint64()
+		if uint64(uint(v)) == v {
+			return uint(v)
+		}
+		return v
+	case goValueFloat:
+		return math.Float64frombits(d.uint64())
+	case goValueString:
+		return d.string()
+	case goValueBytes:
+		return []byte(d.string())
+	case goValueList:
+		var out = make([]interface{}, d.len())
+		for i := range out {
+			out[i] = d.value()
+		}
+		return out
+	case goValueMap:
+		var n = d.len()
+		var out = make(map[string]interface{}, n)
+		for i := 0; i < n; i++ {
+			var k = d.string()
+			out[k] = d.value()
+		}
+		return out
+	case goValueObject:
+		if p := d.pointer(); p != nil {
+			return NewQObjectFromPointer(p)
+		}
+	case goValueOther:
+		var tmpValue = NewQVariantFromPointer(d.pointer())
+		runtime.SetFinalizer(tmpValue, (*QVariant).DeleteQVariant)
+		return tmpValue
+	}
+	return nil
+}
+
+//ToGo converts the variant and everything nested in it with a single call into C++.
+//Lists become []interface{}, maps and hashes map[string]interface{}, integers int or uint
+//(int64 and uint64 if they don't fit), floating point numbers float64, strings string and byte arrays []byte.
+//QObject pointers become *QObject and any other value a copy of it as *QVariant.
+func (ptr *QVariant) ToGo() interface{} {
+	if ptr.Pointer() != nil {
+		var (
+			data *C.char
+			l    C.longlong
+		)
+		var buf = C.QVariant_ToGo(ptr.Pointer(), &data, &l)
+		defer C.QByteArray_DeleteQByteArray(buf)
+		return (&goValueDecoder{b: qt.UnsafeBytes(unsafe.Pointer(data), int(l))}).value()
+	}
+	return nil
+}
+
+//NewQVariantFromGo is the reverse of ToGo, it builds the whole variant with a single call into C++.
+//It takes the types returned by ToGo, any other slice, array, string keyed map or pointer to them
+//and QObjects, integers that fit into an int are stored as int.
+//Values it can't convert become invalid variants.
+func NewQVariantFromGo(v interface{}) *QVariant {
+	var b = appendGoValue(make([]byte, 0, 64), v)
+	var tmpValue = NewQVariantFromPointer(C.QVariant_NewQVariantFromGo((*C.char)(unsafe.Pointer(&b[0]))))
+	runtime.KeepAlive(v)
+	runtime.SetFinalizer(tmpValue, (*QVariant).DeleteQVariant)
+	return tmpValue
+}
+
+//decodeJSON unmarshals the json text in buf straight from C++ memory and frees it afterwards
+func decodeJSON(buf unsafe.Pointer, data *C.char, l C.longlong, v interface{}) error {
+	defer C.QByteArray_DeleteQByteArray(buf)
+	return json.Unmarshal(qt.UnsafeBytes(unsafe.Pointer(data), int(l)), v)
+}
+
+//Decode unmarshals the document into v like json.Unmarshal.
+//The document is serialized with a single call into C++, no QJsonObject or QJsonValue is created on the way.
+func (ptr *QJsonDocument) Decode(v interface{}) error {
+	if ptr.Pointer() != nil {
+		var (
+			data *C.char
+			l    C.longlong
+		)
+		return decodeJSON(C.QJsonDocument_ToJSON(ptr.Pointer(), &data, &l), data, l, v)
+	}
+	return nil
+}
+
+//Decode is the QJsonObject version of QJsonDocument.Decode, for example for QWebChannel messages.
+func (ptr *QJsonObject) Decode(v interface{}) error {
+	if ptr.Pointer() != nil {
+		var (
+			data *C.char
+			l    C.longlong
+		)
+		return decodeJSON(C.QJsonObject_ToJSON(ptr.Pointer(), &data, &l), data, l, v)
+	}
+	return nil
+}
+
+func (ptr *QJsonArray) Decode(v interface{}) error {
+	if ptr.Pointer() != nil {
+		var (
+			data *C.char
+			l    C.longlong
+		)
+		return decodeJSON(C.QJsonArray_ToJSON(ptr.Pointer(), &data, &l), data, l, v)
+	}
+	return nil
+}
+
+func (ptr *QJsonValue) Decode(v interface{}) error {
+	if ptr.Pointer() != nil {
+		var (
+			data *C.char
+			l    C.longlong
+		)
+		return decodeJSON(C.QJsonValue_ToJSON(ptr.Pointer(), &data, &l), data, l, v)
+	}
+	return nil
+}
+
+//DecodeJSON unmarshals the json text in the byte array into v without copying it to Go first,
+//like the body of a QNetworkReply returned by ReadAll.
+func (ptr *QByteArray) DecodeJSON(v interface{}) error {
+	if ptr.Pointer() != nil {
+		return json.Unmarshal(ptr.View(), v)
+	}
+	return nil
+}
+
+var errJsonDocumentValue = errors.New("core: a QJsonDocument can only hold an object or an array")
+
+//NewQJsonDocumentFromGo builds a document with a single call into C++.
+//Maps and slices of the types supported by NewQVariantFromGo are packed into a tag stream
+//that C++ turns into the document directly, other values like structs are marshalled with encoding/json first.
+//v has to encode to an object or an array, anything else (including nil maps and slices) returns an error.
+func NewQJsonDocumentFromGo(v interface{}) (*QJsonDocument, error) {
+	var ptr unsafe.Pointer
+	switch vt := v.(type) {
+	case map[string]interface{}, []interface{}:
+		if reflect.ValueOf(vt).IsNil() {
+			return nil, errJsonDocumentValue
+		}
+		var b = appendGoValue(make([]byte, 0, 64), v)
+		ptr = C.QJsonDocument_NewQJsonDocumentFromGo((*C.char)(unsafe.Pointer(&b[0])))
+		runtime.KeepAlive(v)
+
+	default:
+		var b, err = json.Marshal(v)
+		if err != nil {
+			return nil, err
+		}
+		//json.Marshal doesn't indent, so the first byte tells the kind of value
+		if b[0] != '{' && b[0] != '[' {
+			return nil, errJsonDocumentValue
+		}
+		ptr = C.QJsonDocument_NewQJsonDocumentFromJSON((*C.char)(unsafe.Pointer(&b[0])), C.int(int32(len(b))))
+	}
+	var tmpValue = NewQJsonDocumentFromPointer(ptr)
+	runtime.SetFinalizer(tmpValue, (*QJsonDocument).DestroyQJsonDocument)
+	return tmpValue, nil
+}
+
+//QStringHandle is a QString that lives in C++, so it can be handed to C++ again and again
+//without being converted from UTF-8 every time.
+type QStringHandle struct {
+	ptr unsafe.Pointer
+}
+
+func (h *QStringHandle) Pointer() unsafe.Pointer {
+	if h == nil {
+		return nil
+	}
+	return h.ptr
+}
+
+func newQStringHandle(ptr unsafe.Pointer) *QStringHandle {
+	var h = &QStringHandle{ptr}
+	runtime.SetFinalizer(h, (*QStringHandle).DeleteQStringHandle)
+	return h
+}
+
+//NewQStringHandle converts s once, without copying it to C memory first.
+func NewQStringHandle(s string) *QStringHandle {
+	return newQStringHandle(C.QString_NewQStringFromUTF8((*C.char)(unsafe.Pointer((*reflect.StringHeader)(unsafe.Pointer(&s)).Data)), C.int(int32(len(s)))))
+}
+
+//NewQStringHandleFromUTF16 copies s into a new QString, there is nothing to decode as QString is UTF-16 too.
+func NewQStringHandleFromUTF16(s []uint16) *QStringHandle {
+	var data unsafe.Pointer
+	if len(s) > 0 {
+		data = unsafe.Pointer(&s[0])
+	}
+	return newQStringHandle(C.QString_NewQStringFromUTF16(data, C.int(int32(len(s)))))
+}
+
+//WithQStringFromRawUTF16 runs f with a QString that uses s as its storage, like QString::fromRawData.
+//Nothing is copied unless the QString gets modified, the same rules as for WithQByteArrayFromRawData apply:
+//s must not be allocated by the Go runtime, use the UTF16 of another QStringHandle or C memory instead,
+//NewQStringHandleFromUTF16 copies Go memory.
+func WithQStringFromRawUTF16(s []uint16, f func(*QStringHandle)) {
+	var data unsafe.Pointer
+	if len(s) > 0 {
+		data = unsafe.Pointer(&s[0])
+	}
+	var h = &QStringHandle{C.QString_NewQStringFromRawUTF16(data, C.int(int32(len(s))))}
+	defer h.DeleteQStringHandle()
+	f(h)
+}
+
+func (h *QStringHandle) DeleteQStringHandle() {
+	if h.Pointer() != nil {
+		C.QString_DeleteQString(h.Pointer())
+		h.ptr = nil
+	}
+}
+
+//UTF16 returns the content of the QString without copying it,
+//the slice must not be modified and is only valid as long as the handle.
+func (h *QStringHandle) UTF16() []uint16 {
+	if h.Pointer() != nil {
+		var l C.int
+		var data = C.QString_UTF16(h.Pointer(), &l)
+		if l > 0 {
+			return (*[1 << 29]uint16)(data)[:int(l):int(l)]
+		}
+	}
+	return nil
+}
+
+func (h *QStringHandle) String() string {
+	return string(utf16.Decode(h.UTF16()))
+}
+
+var (
+	internedQStrings      = make(map[string]*QStringHandle)
+	internedQStringsMutex = new(sync.RWMutex)
+)
+
+//InternQString returns the QString for s, which is only converted the first time.
+//It's meant for strings that are used over and over, like role, property and object names,
+//interned strings are never freed and must not be deleted.
+func InternQString(s string) *QStringHandle {
+	internedQStringsMutex.RLock()
+	var h = internedQStrings[s]
+	internedQStringsMutex.RUnlock()
+	if h != nil {
+		return h
+	}
+
+	internedQStringsMutex.Lock()
+	defer internedQStringsMutex.Unlock()
+	if h = internedQStrings[s]; h == nil {
+		h = &QStringHandle{C.QString_NewQStringFromUTF8((*C.char)(unsafe.Pointer((*reflect.StringHeader)(unsafe.Pointer(&s)).Data)), C.int(int32(len(s))))}
+		internedQStrings[s] = h
+	}
+	return h
+}
+
+//SetQString stores a shallow copy of the QString, so the text isn't converted or copied.
+func (ptr *QVariant) SetQString(v *QStringHandle) {
+	if ptr.Pointer() != nil && v.Pointer() != nil {
+		C.QVariant_SetQString(ptr.Pointer(), v.Pointer())
+	}
+}
+
+//ColumnTableModel is a table model that keeps its data in typed columns on the C++ side,
+//so views never have to call into Go to paint it.
+//Rows are appended and updated in batches, and the changes are announced with as few signals as possible.
+//Like every model it must only be used from the thread it lives in.
+type ColumnTableModel struct {
+	QAbstractTableModel
+}
+
+type ColumnTableModel__ColumnType int64
+
+const (
+	ColumnTableModel__Int64   ColumnTableModel__ColumnType = ColumnTableModel__ColumnType(0)
+	ColumnTableModel__Float64 ColumnTableModel__ColumnType = ColumnTableModel__ColumnType(1)
+	ColumnTableModel__String  ColumnTableModel__ColumnType = ColumnTableModel__ColumnType(2)
+)
+
+func NewColumnTableModelFromPointer(ptr unsafe.Pointer) *ColumnTableModel {
+	var n = new(ColumnTableModel)
+	n.SetPointer(ptr)
+	return n
+}
+
+func NewColumnTableModel(parent QObject_ITF) *ColumnTableModel {
+	var tmpValue = NewColumnTableModelFromPointer(C.ColumnTableModel_NewColumnTableModel(PointerFromQObject(parent)))
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
+		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
+	}
+	return tmpValue
+}
+
+//AddColumn appends a column of the given type and returns its index.
+func (ptr *ColumnTableModel) AddColumn(kind ColumnTableModel__ColumnType, header string) int {
+	if ptr.Pointer() != nil && kind >= ColumnTableModel__Int64 && kind <= ColumnTableModel__String {
+		var headerC = C.CString(header)
+		defer C.free(unsafe.Pointer(headerC))
+		return int(int32(C.ColumnTableModel_AddColumn(ptr.Pointer(), C.longlong(kind), headerC, C.int(int32(len(header))))))
+	}
+	return -1
+}
+
+//AppendRows appends count zero valued rows, which can be filled with the Set functions afterwards.
+func (ptr *ColumnTableModel) AppendRows(count int) {
+	if ptr.Pointer() != nil {
+		C.ColumnTableModel_AppendRows(ptr.Pointer(), C.int(int32(count)))
+	}
+}
+
+func (ptr *ColumnTableModel) RemoveRows(row int, count int) {
+	if ptr.Pointer() != nil {
+		C.ColumnTableModel_RemoveRows(ptr.Pointer(), C.int(int32(row)), C.int(int32(count)))
+	}
+}
+
+//Clear removes all rows but keeps the columns.
+func (ptr *ColumnTableModel) Clear() {
+	if ptr.Pointer() != nil {
+		C.ColumnTableModel_Clear(ptr.Pointer())
+	}
+}
+
+//SetInt64s overwrites the rows starting at row of an Int64 column with values.
+//It returns false if the column has another type or the rows don't exist.
+func (ptr *ColumnTableModel) SetInt64s(column int, row int, values []int64) bool {
+	if ptr.Pointer() != nil && len(values) > 0 {
+		return C.ColumnTableModel_SetInt64s(ptr.Pointer(), C.int(int32(column)), C.int(int32(row)), unsafe.Pointer(&values[0]), C.int(int32(len(values)))) != 0
+	}
+	return false
+}
+
+//SetFloat64s is the Float64 column version of SetInt64s.
+func (ptr *ColumnTableModel) SetFloat64s(column int, row int, values []float64) bool {
+	if ptr.Pointer() != nil && len(values) > 0 {
+		return C.ColumnTableModel_SetFloat64s(ptr.Pointer(), C.int(int32(column)), C.int(int32(row)), unsafe.Pointer(&values[0]), C.int(int32(len(values)))) != 0
+	}
+	return false
+}
+
+//SetStrings is the String column version of SetInt64s.
+func (ptr *ColumnTableModel) SetStrings(column int, row int, values []string) bool {
+	if ptr.Pointer() != nil && len(values) > 0 {
+		var (
+			lens = make([]C.int, len(values))
+			size int
+		)
+		for i, v := range values {
+			lens[i] = C.int(int32(len(v)))
+			size += len(v)
+		}
+		var data = make([]byte, 0, size+1)
+		for _, v := range values {
+			data = append(data, v...)
+		}
+		data = append(data, 0)
+		return C.ColumnTableModel_SetStrings(ptr.Pointer(), C.int(int32(column)), C.int(int32(row)), (*C.char)(unsafe.Pointer(&data[0])), unsafe.Pointer(&lens[0]), C.int(int32(len(values)))) != 0
+	}
+	return false
+}
+
+//BeginBatch defers the change notifications until the matching EndBatch,
+//which then emits a single rowsInserted for all appended rows and a single dataChanged for all updated cells.
+func (ptr *ColumnTableModel) BeginBatch() {
+	if ptr.Pointer() != nil {
+		C.ColumnTableModel_BeginBatch(ptr.Pointer())
+	}
+}
+
+func (ptr *ColumnTableModel) EndBatch() {
+	if ptr.Pointer() != nil {
+		C.ColumnTableModel_EndBatch(ptr.Pointer())
+	}
+}
+
+//SortFilterProxyModel is a proxy for flat list and table models whose filters and sort keys are declared from Go
+//and evaluated on the C++ side, so filtering and sorting never call back into Go per row or per comparison.
+//Rows are filtered again when the source reports them as changed, large sorts run on several threads.
+//The source has to be set with SetSourceModel, SetSourceModelDefault would skip the bookkeeping.
+type SortFilterProxyModel struct {
+	QAbstractProxyModel
+}
+
+type SortFilterProxyModel__FilterKind int64
+
+const (
+	SortFilterProxyModel__Contains SortFilterProxyModel__FilterKind = SortFilterProxyModel__FilterKind(0)
+	SortFilterProxyModel__Equals   SortFilterProxyModel__FilterKind = SortFilterProxyModel__FilterKind(1)
+	SortFilterProxyModel__RegExp   SortFilterProxyModel__FilterKind = SortFilterProxyModel__FilterKind(2)
+	SortFilterProxyModel__Range    SortFilterProxyModel__FilterKind = SortFilterProxyModel__FilterKind(3)
+)
+
+type SortFilterProxyModel__KeyKind int64
+
+const (
+	SortFilterProxyModel__String          SortFilterProxyModel__KeyKind = SortFilterProxyModel__KeyKind(0)
+	SortFilterProxyModel__CaseInsensitive SortFilterProxyModel__KeyKind = SortFilterProxyModel__KeyKind(1)
+	SortFilterProxyModel__Number          SortFilterProxyModel__KeyKind = SortFilterProxyModel__KeyKind(2)
+)
+
+//SortFilterProxyModelFilter accepts the rows whose value of Role in Column
+//contains Text case insensitively, equals Text, matches the regular expression Text or lies within [Min, Max].
+type SortFilterProxyModelFilter struct {
+	Column int
+	Role   int
+	Kind   SortFilterProxyModel__FilterKind
+	Text   string
+	Min    float64
+	Max    float64
+}
+
+//SortFilterProxyModelKey orders the rows by the value of Role in Column,
+//later keys only decide between rows that are equal in the earlier ones.
+type SortFilterProxyModelKey struct {
+	Column     int
+	Role       int
+	Kind       SortFilterProxyModel__KeyKind
+	Descending bool
+}
+
+func NewSortFilterProxyModelFromPointer(ptr unsafe.Pointer) *SortFilterProxyModel {
+	var n = new(SortFilterProxyModel)
+	n.SetPointer(ptr)
+	return n
+}
+
+func NewSortFilterProxyModel(parent QObject_ITF) *SortFilterProxyModel {
+	var tmpValue = NewSortFilterProxyModelFromPointer(C.SortFilterProxyModel_NewSortFilterProxyModel(PointerFromQObject(parent)))
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
+		tmpValue.ConnectDestroyed(func(*QObject) { tmpValue.SetPointer(nil) })
+	}
+	return tmpValue
+}
+
+//SetFilters replaces the filters, a row is accepted if it passes all of them.
+//The rows are filtered and sorted again once and views are reset.
+func (ptr *SortFilterProxyModel) SetFilters(filters ...SortFilterProxyModelFilter) {
+	if ptr.Pointer() != nil {
+		C.SortFilterProxyModel_ClearFilters(ptr.Pointer())
+		for _, f := range filters {
+			var textC = C.CString(f.Text)
+			C.SortFilterProxyModel_AddFilter(ptr.Pointer(), C.int(int32(f.Column)), C.int(int32(f.Role)), C.longlong(f.Kind), textC, C.int(int32(len(f.Text))), C.double(f.Min), C.double(f.Max))
+			C.free(unsafe.Pointer(textC))
+		}
+		C.SortFilterProxyModel_Invalidate(ptr.Pointer())
+	}
+}
+
+//SetSortKeys replaces the sort keys, without keys the rows keep the source order.
+//Unlike SetFilters it keeps the selections and the current index of attached views.
+func (ptr *SortFilterProxyModel) SetSortKeys(keys ...SortFilterProxyModelKey) {
+	if ptr.Pointer() != nil {
+		C.SortFilterProxyModel_ClearSortKeys(ptr.Pointer())
+		for _, k := range keys {
+			C.SortFilterProxyModel_AddSortKey(ptr.Pointer(), C.int(int32(k.Column)), C.int(int32(k.Role)), C.longlong(k.Kind), C.char(int8(qt.GoBoolToInt(k.Descending))))
+		}
+		C.SortFilterProxyModel_Resort(ptr.Pointer())
+	}
+}
+
+//Invalidate filters and sorts all rows again,
+//it's only needed if the source changed without emitting the matching signals.
+func (ptr *SortFilterProxyModel) Invalidate() {
+	if ptr.Pointer() != nil {
+		C.SortFilterProxyModel_Invalidate(ptr.Pointer())
+	}
+}
+
+//NewQByteArrayFromBytes copies data into a new QByteArray,
+//unlike NewQByteArray2 it copies once and doesn't go through a C string.
+func NewQByteArrayFromBytes(data []byte) *QByteArray {
+	var ptr unsafe.Pointer
+	if len(data) > 0 {
+		ptr = C.QByteArray_NewQByteArrayFromBytes((*C.char)(unsafe.Pointer(&data[0])), C.int(int32(len(data))))
+	} else {
+		ptr = C.QByteArray_NewQByteArrayFromBytes(nil, 0)
+	}
+	var tmpValue = NewQByteArrayFromPointer(ptr)
+	runtime.SetFinalizer(tmpValue, (*QByteArray).DeleteQByteArray)
+	return tmpValue
+}
+
+//DeleteQByteArray destroys and frees a QByteArray created by NewQByteArrayFromBytes.
+func (ptr *QByteArray) DeleteQByteArray() {
+	if ptr.Pointer() != nil {
+		C.QByteArray_DeleteQByteArray(ptr.Pointer())
+		ptr.SetPointer(nil)
+	}
+}
+
+//WithQByteArrayFromRawData runs f with a QByteArray that uses data as its storage, like QByteArray::fromRawData.
+//Nothing is copied unless the QByteArray gets modified, which detaches it first.
+//Because C++ keeps using the memory after the call returns, data must not be allocated by the Go runtime,
+//use the View of another QByteArray or memory from C.malloc or syscall.Mmap instead, NewQByteArrayFromBytes copies Go memory.
+//The QByteArray is freed once f returns, but data has to outlive any shallow copy C++ made of it.
+func WithQByteArrayFromRawData(data []byte, f func(*QByteArray)) {
+	var ptr unsafe.Pointer
+	if len(data) > 0 {
+		ptr = C.QByteArray_NewQByteArrayFromRawData((*C.char)(unsafe.Pointer(&data[0])), C.int(int32(len(data))))
+	} else {
+		ptr = C.QByteArray_NewQByteArrayFromBytes(nil, 0)
+	}
+	var tmpValue = NewQByteArrayFromPointer(ptr)
+	defer tmpValue.DeleteQByteArray()
+	f(tmpValue)
+}
+
+//View returns the content of the QByteArray without copying it.
+//The slice must not be modified and is only valid until the QByteArray gets modified or destroyed.
+func (ptr *QByteArray) View() []byte {
+	if ptr.Pointer() != nil {
+		var l C.longlong
+		var data = C.QByteArray_View(ptr.Pointer(), &l)
+		return qt.UnsafeBytes(unsafe.Pointer(data), int(l))
+	}
+	return nil
+}
+
+//MutableView is like View, but the slice may be written to.
+//A QByteArray that shares its data with others is detached first, which copies it once.
+func (ptr *QByteArray) MutableView() []byte {
+	if ptr.Pointer() != nil {
+		var l C.longlong
+		var data = C.QByteArray_MutableView(ptr.Pointer(), &l)
+		return qt.UnsafeBytes(unsafe.Pointer(data), int(l))
+	}
+	return nil
+}
+
+//MetaProperty is a property name that is looked up through the meta object system once per class,
+//instead of on every call like QObject.Property and SetProperty do.
+//It works for every QObject, including qml items and subclasses defined in Go.
+//The typed Read and Write functions don't create a QVariant on the Go side.
+//A MetaProperty is not safe for concurrent use and the objects have to be used from their own thread.
+type MetaProperty struct {
+	ptr unsafe.Pointer
+}
+
+func newMetaHandle(name string, method bool) unsafe.Pointer {
+	var nameC = C.CString(name)
+	defer C.free(unsafe.Pointer(nameC))
+	return C.MetaHandle_NewMetaHandle(nameC, C.int(int32(len(name))), C.char(int8(qt.GoBoolToInt(method))))
+}
+
+func NewMetaProperty(name string) *MetaProperty {
+	var p = &MetaProperty{newMetaHandle(name, false)}
+	runtime.SetFinalizer(p, (*MetaProperty).DestroyMetaProperty)
+	return p
+}
+
+func (p *MetaProperty) DestroyMetaProperty() {
+	if p.ptr != nil {
+		C.MetaHandle_DestroyMetaHandle(p.ptr)
+		p.ptr = nil
+	}
+}
+
+//IsValid reports whether the object has the property.
+func (p *MetaProperty) IsValid(object QObject_ITF) bool {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaHandle_IsValid(p.ptr, PointerFromQObject(object)) != 0
+	}
+	return false
+}
+
+func (p *MetaProperty) Read(object QObject_ITF) *QVariant {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		var tmpValue = NewQVariantFromPointer(C.MetaProperty_Read(p.ptr, PointerFromQObject(object)))
+		runtime.SetFinalizer(tmpValue, (*QVariant).DeleteQVariant)
+		return tmpValue
+	}
+	return nil
+}
+
+func (p *MetaProperty) ReadInt(object QObject_ITF) int {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		return int(int64(C.MetaProperty_ReadInt(p.ptr, PointerFromQObject(object))))
+	}
+	return 0
+}
+
+func (p *MetaProperty) ReadFloat(object QObject_ITF) float64 {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		return float64(C.MetaProperty_ReadFloat(p.ptr, PointerFromQObject(object)))
+	}
+	return 0
+}
+
+func (p *MetaProperty) ReadBool(object QObject_ITF) bool {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaProperty_ReadBool(p.ptr, PointerFromQObject(object)) != 0
+	}
+	return false
+}
+
+func (p *MetaProperty) ReadString(object QObject_ITF) string {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		var (
+			data *C.char
+			l    C.longlong
+		)
+		var buf = C.MetaProperty_ReadString(p.ptr, PointerFromQObject(object), &data, &l)
+		defer C.QByteArray_DeleteQByteArray(buf)
+		return C.GoStringN(data, C.int(l))
+	}
+	return ""
+}
+
+//Write sets the property, it returns false if the object doesn't have it or the value can't be converted to its type.
+func (p *MetaProperty) Write(object QObject_ITF, value QVariant_ITF) bool {
+	if p.ptr != nil && PointerFromQObject(object) != nil && PointerFromQVariant(value) != nil {
+		defer runtime.KeepAlive(value)
+		return C.MetaProperty_Write(p.ptr, PointerFromQObject(object), PointerFromQVariant(value)) != 0
+	}
+	return false
+}
+
+func (p *MetaProperty) WriteInt(object QObject_ITF, v int) bool {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaProperty_WriteInt(p.ptr, PointerFromQObject(object), C.longlong(v)) != 0
+	}
+	return false
+}
+
+func (p *MetaProperty) WriteFloat(object QObject_ITF, v float64) bool {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaProperty_WriteFloat(p.ptr, PointerFromQObject(object), C.double(v)) != 0
+	}
+	return false
+}
+
+func (p *MetaProperty) WriteBool(object QObject_ITF, v bool) bool {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaProperty_WriteBool(p.ptr, PointerFromQObject(object), C.char(int8(qt.GoBoolToInt(v)))) != 0
+	}
+	return false
+}
+
+//WriteString converts v to a QString without copying it to C memory first.
+func (p *MetaProperty) WriteString(object QObject_ITF, v string) bool {
+	if p.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaProperty_WriteString(p.ptr, PointerFromQObject(object), (*C.char)(unsafe.Pointer((*reflect.StringHeader)(unsafe.Pointer(&v)).Data)), C.int(int32(len(v)))) != 0
+	}
+	return false
+}
+
+//MetaMethod is the MetaProperty counterpart for slots, signals and invokable methods.
+//It's created with a signature like "update" or "setValue(int)", a name alone means no arguments.
+//Calls on objects of another thread are queued like QMetaObject::invokeMethod does.
+type MetaMethod struct {
+	ptr unsafe.Pointer
+}
+
+func NewMetaMethod(signature string) *MetaMethod {
+	var m = &MetaMethod{newMetaHandle(signature, true)}
+	runtime.SetFinalizer(m, (*MetaMethod).DestroyMetaMethod)
+	return m
+}
+
+func (m *MetaMethod) DestroyMetaMethod() {
+	if m.ptr != nil {
+		C.MetaHandle_DestroyMetaHandle(m.ptr)
+		m.ptr = nil
+	}
+}
+
+//IsValid reports whether the object has the method.
+func (m *MetaMethod) IsValid(object QObject_ITF) bool {
+	if m.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaHandle_IsValid(m.ptr, PointerFromQObject(object)) != 0
+	}
+	return false
+}
+
+func (m *MetaMethod) Invoke(object QObject_ITF) bool {
+	if m.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaMethod_Invoke(m.ptr, PointerFromQObject(object)) != 0
+	}
+	return false
+}
+
+//InvokeInt calls a method that takes a single int, like "setValue(int)".
+func (m *MetaMethod) InvokeInt(object QObject_ITF, v int) bool {
+	if m.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaMethod_InvokeInt(m.ptr, PointerFromQObject(object), C.int(int32(v))) != 0
+	}
+	return false
+}
+
+func (m *MetaMethod) InvokeFloat(object QObject_ITF, v float64) bool {
+	if m.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaMethod_InvokeFloat(m.ptr, PointerFromQObject(object), C.double(v)) != 0
+	}
+	return false
+}
+
+func (m *MetaMethod) InvokeBool(object QObject_ITF, v bool) bool {
+	if m.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaMethod_InvokeBool(m.ptr, PointerFromQObject(object), C.char(int8(qt.GoBoolToInt(v)))) != 0
+	}
+	return false
+}
+
+func (m *MetaMethod) InvokeString(object QObject_ITF, v string) bool {
+	if m.ptr != nil && PointerFromQObject(object) != nil {
+		return C.MetaMethod_InvokeString(m.ptr, PointerFromQObject(object), (*C.char)(unsafe.Pointer((*reflect.StringHeader)(unsafe.Pointer(&v)).Data)), C.int(int32(len(v)))) != 0
+	}
+	return false
+}
+
+//InvokeVariant calls a method that takes a single QVariant, like a function declared in qml.
+func (m *MetaMethod) InvokeVariant(object QObject_ITF, v QVariant_ITF) bool {
+	if m.ptr != nil && PointerFromQObject(object) != nil && PointerFromQVariant(v) != nil {
+		defer runtime.KeepAlive(v)
+		return C.MetaMethod_InvokeVariant(m.ptr, PointerFromQObject(object), PointerFromQVariant(v)) != 0
+	}
+	return false
+}
+
+//Arena owns the value objects created through its New methods, they are placed in bulk allocated
+//C++ memory without a finalizer and released all at once by Reset or Free.
+//Objects of an arena must not be destroyed on their own or used after the arena was reset.
+//An arena is not safe for concurrent use.
+type Arena struct {
+	ptr unsafe.Pointer
+}
+
+func NewArena() *Arena {
+	var a = &Arena{C.GoArena_New()}
+	runtime.SetFinalizer(a, (*Arena).Free)
+	return a
+}
+
+func (a *Arena) Pointer() unsafe.Pointer {
+	if a == nil {
+		return nil
+	}
+	return a.ptr
+}
+
+//Reset destroys all objects of the arena, but keeps its memory for reuse.
+func (a *Arena) Reset() {
+	if a.Pointer() != nil {
+		C.GoArena_Reset(a.Pointer())
+	}
+}
+
+func (a *Arena) Free() {
+	if a.Pointer() != nil {
+		C.GoArena_Free(a.Pointer())
+		a.ptr = nil
+	}
+}
+
+var arenaPool = sync.Pool{New: func() interface{} { return NewArena() }}
+
+//WithArena runs f with a pooled arena and resets it after f returned,
+//so none of the objects created in f may escape it.
+func WithArena(f func(a *Arena)) {
+	var a = arenaPool.Get().(*Arena)
+	defer func() {
+		a.Reset()
+		arenaPool.Put(a)
+	}()
+	f(a)
+}
+
+//CommandBuffer records property writes and argument less slot calls on QObjects
+//and replays all of them with a single call into C++ once Flush is called.
+//Properties and slots are looked up through the meta object system by name,
+//so it works for every QObject, including subclasses defined in Go.
+//A CommandBuffer is not safe for concurrent use.
+type CommandBuffer struct {
+	ptr   unsafe.Pointer
+	names map[string]C.int
+	cmds  []C.struct_GoCommand
+	strs  []byte
+}
+
+//the ops of GoCommandBuffer::Op
+const (
+	commandSetInt = iota
+	commandSetFloat
+	commandSetBool
+	commandSetString
+	commandSetRect
+	commandInvoke
+)
+
+func NewCommandBuffer() *CommandBuffer {
+	var b = &CommandBuffer{ptr: C.CommandBuffer_NewCommandBuffer(), names: make(map[string]C.int)}
+	runtime.SetFinalizer(b, (*CommandBuffer).DestroyCommandBuffer)
+	return b
+}
+
+func (b *CommandBuffer) DestroyCommandBuffer() {
+	if b.ptr != nil {
+		C.CommandBuffer_DestroyCommandBuffer(b.ptr)
+		b.ptr = nil
+	}
+}
+
+func (b *CommandBuffer) name(name string) C.int {
+	if id, ok := b.names[name]; ok {
+		return id
+	}
+	var nameC = C.CString(name)
+	defer C.free(unsafe.Pointer(nameC))
+	var id = C.CommandBuffer_AddName(b.ptr, nameC, C.int(int32(len(name))))
+	b.names[name] = id
+	return id
+}
+
+func (b *CommandBuffer) add(object QObject_ITF, op int, name string) *C.struct_GoCommand {
+	b.cmds = append(b.cmds, C.struct_GoCommand{object: C.uintptr_t(uintptr(PointerFromQObject(object))), op: C.int(op), name: b.name(name)})
+	return &b.cmds[len(b.cmds)-1]
+}
+
+func (b *CommandBuffer) SetInt(object QObject_ITF, property string, v int) {
+	b.add(object, commandSetInt, property).v[0] = C.longlong(v)
+}
+
+func (b *CommandBuffer) SetFloat(object QObject_ITF, property string, v float64) {
+	b.add(object, commandSetFloat, property).f = C.double(v)
+}
+
+func (b *CommandBuffer) SetBool(object QObject_ITF, property string, v bool) {
+	b.add(object, commandSetBool, property).v[0] = C.longlong(qt.GoBoolToInt(v))
+}
+
+func (b *CommandBuffer) SetString(object QObject_ITF, property string, v string) {
+	var c = b.add(object, commandSetString, property)
+	c.v[0], c.v[1] = C.longlong(len(b.strs)), C.longlong(len(v))
+	b.strs = append(b.strs, v...)
+}
+
+func (b *CommandBuffer) SetRect(object QObject_ITF, property string, x int, y int, width int, height int) {
+	var c = b.add(object, commandSetRect, property)
+	c.v[0], c.v[1], c.v[2], c.v[3] = C.longlong(x), C.longlong(y), C.longlong(width), C.longlong(height)
+}
+
+//Invoke records a call of the slot or invokable method without arguments, like "update".
+func (b *CommandBuffer) Invoke(object QObject_ITF, method string) {
+	b.add(object, commandInvoke, method)
+}
+
+func (b *CommandBuffer) Len() int {
+	return len(b.cmds)
+}
+
+//Flush replays the recorded commands in order and clears the buffer.
+//Called from another thread than the one of the QCoreApplication, it blocks until the gui thread replayed them.
+//The objects of the commands have to be alive until the replay starts,
+//objects deleted by an earlier command of the same flush are skipped.
+func (b *CommandBuffer) Flush() {
+	if b.ptr == nil || len(b.cmds) == 0 {
+		return
+	}
+	var strs *C.char
+	if len(b.strs) > 0 {
+		strs = (*C.char)(unsafe.Pointer(&b.strs[0]))
+	}
+	C.CommandBuffer_Flush(b.ptr, &b.cmds[0], C.int(int32(len(b.cmds))), strs)
+	b.cmds, b.strs = b.cmds[:0], b.strs[:0]
+}
+
+func init() {
+	qt.SetMainDispatcher(func() { C.GoMainQueue_Wakeup() }, func() bool { return C.GoMainQueue_IsMainThread() != 0 })
+}
+
+//export callbackGoMainQueue
+func callbackGoMainQueue() {
+	qt.RunMainQueue()
+}
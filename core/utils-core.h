@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef GO_QTCORE_UTILS_H
+#define GO_QTCORE_UTILS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void QVariant_Assign(void* ptr, void* other);
+void QVariant_DeleteQVariant(void* ptr);
+void QVariant_SetBool(void* ptr, char v);
+void QVariant_SetInt(void* ptr, int v);
+void QVariant_SetFloat(void* ptr, double v);
+void QVariant_SetString(void* ptr, char* v, int len);
+void* QVariant_ToGo(void* ptr, char** data, long long* len);
+void* QVariant_NewQVariantFromGo(char* data);
+
+void* QJsonDocument_ToJSON(void* ptr, char** data, long long* len);
+void* QJsonObject_ToJSON(void* ptr, char** data, long long* len);
+void* QJsonArray_ToJSON(void* ptr, char** data, long long* len);
+void* QJsonValue_ToJSON(void* ptr, char** data, long long* len);
+void* QJsonDocument_NewQJsonDocumentFromGo(char* data);
+void* QJsonDocument_NewQJsonDocumentFromJSON(char* data, int len);
+
+void* QString_NewQStringFromUTF8(char* data, int len);
+void* QString_NewQStringFromUTF16(void* data, int len);
+void* QString_NewQStringFromRawUTF16(void* data, int len);
+void QString_DeleteQString(void* ptr);
+void* QString_UTF16(void* ptr, int* len);
+void QVariant_SetQString(void* ptr, void* str);
+
+void* QByteArray_NewQByteArrayFromBytes(char* data, int size);
+void* QByteArray_NewQByteArrayFromRawData(char* data, int size);
+void QByteArray_DeleteQByteArray(void* ptr);
+char* QByteArray_View(void* ptr, long long* len);
+char* QByteArray_MutableView(void* ptr, long long* len);
+
+void* ColumnTableModel_NewColumnTableModel(void* parent);
+int ColumnTableModel_AddColumn(void* ptr, long long kind, char* header, int len);
+void ColumnTableModel_AppendRows(void* ptr, int count);
+void ColumnTableModel_RemoveRows(void* ptr, int row, int count);
+void ColumnTableModel_Clear(void* ptr);
+char ColumnTableModel_SetInt64s(void* ptr, int column, int row, void* data, int count);
+char ColumnTableModel_SetFloat64s(void* ptr, int column, int row, void* data, int count);
+char ColumnTableModel_SetStrings(void* ptr, int column, int row, char* data, void* lens, int count);
+void ColumnTableModel_BeginBatch(void* ptr);
+void ColumnTableModel_EndBatch(void* ptr);
+
+void* SortFilterProxyModel_NewSortFilterProxyModel(void* parent);
+void SortFilterProxyModel_ClearFilters(void* ptr);
+void SortFilterProxyModel_AddFilter(void* ptr, int column, int role, long long kind, char* text, int len, double min, double max);
+void SortFilterProxyModel_ClearSortKeys(void* ptr);
+void SortFilterProxyModel_AddSortKey(void* ptr, int column, int role, long long kind, char descending);
+void SortFilterProxyModel_Invalidate(void* ptr);
+void SortFilterProxyModel_Resort(void* ptr);
+
+void* MetaHandle_NewMetaHandle(char* name, int len, char method);
+void MetaHandle_DestroyMetaHandle(void* ptr);
+char MetaHandle_IsValid(void* ptr, void* object);
+void* MetaProperty_Read(void* ptr, void* object);
+long long MetaProperty_ReadInt(void* ptr, void* object);
+double MetaProperty_ReadFloat(void* ptr, void* object);
+char MetaProperty_ReadBool(void* ptr, void* object);
+void* MetaProperty_ReadString(void* ptr, void* object, char** data, long long* len);
+char MetaProperty_Write(void* ptr, void* object, void* value);
+char MetaProperty_WriteInt(void* ptr, void* object, long long v);
+char MetaProperty_WriteFloat(void* ptr, void* object, double v);
+char MetaProperty_WriteBool(void* ptr, void* object, char v);
+char MetaProperty_WriteString(void* ptr, void* object, char* v, int len);
+char MetaMethod_Invoke(void* ptr, void* object);
+char MetaMethod_InvokeInt(void* ptr, void* object, int v);
+char MetaMethod_InvokeFloat(void* ptr, void* object, double v);
+char MetaMethod_InvokeBool(void* ptr, void* object, char v);
+char MetaMethod_InvokeString(void* ptr, void* object, char* v, int len);
+char MetaMethod_InvokeVariant(void* ptr, void* object, void* v);
+
+void* GoArena_New();
+void* GoArena_Alloc(void* ptr, long long size, long long align, void (*destructor)(void*));
+void GoArena_Reset(void* ptr);
+void GoArena_Free(void* ptr);
+
+struct GoCommand { uintptr_t object; int op; int name; long long v[4]; double f; };
+
+void* CommandBuffer_NewCommandBuffer();
+int CommandBuffer_AddName(void* ptr, char* name, int len);
+void CommandBuffer_Flush(void* ptr, struct GoCommand* cmds, int count, char* strs);
+void CommandBuffer_DestroyCommandBuffer(void* ptr);
+
+void GoMainQueue_Wakeup();
+char GoMainQueue_IsMainThread();
+
+#ifdef __cplusplus
+}
+
+#include <new>
+#include <type_traits>
+
+template <typename T> void goArenaDestroy(void* ptr) { static_cast<T*>(ptr)->~T(); }
+
+//storage for a placement new of T, the destructor only gets registered if T needs one
+template <typename T> void* goArenaAlloc(void* arena) { return GoArena_Alloc(arena, sizeof(T), alignof(T), std::is_trivially_destructible<T>::value ? 0 : &goArenaDestroy<T>); }
+#endif
+
+#endif
@@ -67,6 +67,75 @@
 #include <QVector3D>
 #include <QWheelEvent>
 #include <QWindow>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 typedef QtDataVisualization::Q3DBars Q3DBars;
 typedef QtDataVisualization::Q3DCamera Q3DCamera;
@@ -2492,7 +2561,7 @@ void QAbstract3DAxis_SetLabelAutoRotation(void* ptr, float angle)
 
 void QAbstract3DAxis_SetLabels(void* ptr, char* labels)
 {
-	static_cast<QAbstract3DAxis*>(ptr)->setLabels(QString(labels).split("|", QString::SkipEmptyParts));
+	static_cast<QAbstract3DAxis*>(ptr)->setLabels(goUnpackStringList(labels));
 }
 
 void QAbstract3DAxis_SetMax(void* ptr, float max)
@@ -2592,7 +2661,7 @@ struct QtDataVisualization_PackedString QAbstract3DAxis_Title(void* ptr)
 
 struct QtDataVisualization_PackedString QAbstract3DAxis_Labels(void* ptr)
 {
-	return ({ QByteArray t7dab2f = static_cast<QAbstract3DAxis*>(ptr)->labels().join("|").toUtf8(); QtDataVisualization_PackedString { const_cast<char*>(t7dab2f.prepend("WHITESPACE").constData()+10), t7dab2f.size()-10 }; });
+	return ({ long long t7dab2flen; char* t7dab2f = goPackStringList(static_cast<QAbstract3DAxis*>(ptr)->labels(), &t7dab2flen); QtDataVisualization_PackedString { t7dab2f, t7dab2flen }; });
 }
 
 char QAbstract3DAxis_IsAutoAdjustRange(void* ptr)
@@ -4234,7 +4303,7 @@ void QBarDataProxy_SeriesChanged(void* ptr, void* series)
 
 void QBarDataProxy_SetColumnLabels(void* ptr, char* labels)
 {
-	static_cast<QBarDataProxy*>(ptr)->setColumnLabels(QString(labels).split("|", QString::SkipEmptyParts));
+	static_cast<QBarDataProxy*>(ptr)->setColumnLabels(goUnpackStringList(labels));
 }
 
 void QBarDataProxy_SetItem2(void* ptr, void* position, void* item)
@@ -4249,7 +4318,7 @@ void QBarDataProxy_SetItem(void* ptr, int rowIndex, int columnIndex, void* item)
 
 void QBarDataProxy_SetRowLabels(void* ptr, char* labels)
 {
-	static_cast<QBarDataProxy*>(ptr)->setRowLabels(QString(labels).split("|", QString::SkipEmptyParts));
+	static_cast<QBarDataProxy*>(ptr)->setRowLabels(goUnpackStringList(labels));
 }
 
 void QBarDataProxy_DestroyQBarDataProxy(void* ptr)
@@ -4269,12 +4338,12 @@ void* QBarDataProxy_Series(void* ptr)
 
 struct QtDataVisualization_PackedString QBarDataProxy_ColumnLabels(void* ptr)
 {
-	return ({ QByteArray t7f1685 = static_cast<QBarDataProxy*>(ptr)->columnLabels().join("|").toUtf8(); QtDataVisualization_PackedString { const_cast<char*>(t7f1685.prepend("WHITESPACE").constData()+10), t7f1685.size()-10 }; });
+	return ({ long long t7f1685len; char* t7f1685 = goPackStringList(static_cast<QBarDataProxy*>(ptr)->columnLabels(), &t7f1685len); QtDataVisualization_PackedString { t7f1685, t7f1685len }; });
 }
 
 struct QtDataVisualization_PackedString QBarDataProxy_RowLabels(void* ptr)
 {
-	return ({ QByteArray t0565e1 = static_cast<QBarDataProxy*>(ptr)->rowLabels().join("|").toUtf8(); QtDataVisualization_PackedString { const_cast<char*>(t0565e1.prepend("WHITESPACE").constData()+10), t0565e1.size()-10 }; });
+	return ({ long long t0565e1len; char* t0565e1 = goPackStringList(static_cast<QBarDataProxy*>(ptr)->rowLabels(), &t0565e1len); QtDataVisualization_PackedString { t0565e1, t0565e1len }; });
 }
 
 void* QBarDataProxy_ItemAt2(void* ptr, void* position)
@@ -4322,7 +4391,7 @@ void QCategory3DAxis_LabelsChanged(void* ptr)
 
 void QCategory3DAxis_SetLabels(void* ptr, char* labels)
 {
-	static_cast<QCategory3DAxis*>(ptr)->setLabels(QString(labels).split("|", QString::SkipEmptyParts));
+	static_cast<QCategory3DAxis*>(ptr)->setLabels(goUnpackStringList(labels));
 }
 
 void QCategory3DAxis_DestroyQCategory3DAxis(void* ptr)
@@ -4337,7 +4406,7 @@ void QCategory3DAxis_DestroyQCategory3DAxisDefault(void* ptr)
 
 struct QtDataVisualization_PackedString QCategory3DAxis_Labels(void* ptr)
 {
-	return ({ QByteArray t2a027f = static_cast<QCategory3DAxis*>(ptr)->labels().join("|").toUtf8(); QtDataVisualization_PackedString { const_cast<char*>(t2a027f.prepend("WHITESPACE").constData()+10), t2a027f.size()-10 }; });
+	return ({ long long t2a027flen; char* t2a027f = goPackStringList(static_cast<QCategory3DAxis*>(ptr)->labels(), &t2a027flen); QtDataVisualization_PackedString { t2a027f, t2a027flen }; });
 }
 
 class MyQCustom3DItem: public QCustom3DItem
@@ -5560,12 +5629,12 @@ void* QItemModelBarDataProxy_NewQItemModelBarDataProxy5(void* itemModel, char* r
 
 void* QItemModelBarDataProxy_NewQItemModelBarDataProxy7(void* itemModel, char* rowRole, char* columnRole, char* valueRole, char* rotationRole, char* rowCategories, char* columnCategories, void* parent)
 {
-	return new MyQItemModelBarDataProxy(static_cast<QAbstractItemModel*>(itemModel), QString(rowRole), QString(columnRole), QString(valueRole), QString(rotationRole), QString(rowCategories).split("|", QString::SkipEmptyParts), QString(columnCategories).split("|", QString::SkipEmptyParts), static_cast<QObject*>(parent));
+	return new MyQItemModelBarDataProxy(static_cast<QAbstractItemModel*>(itemModel), QString(rowRole), QString(columnRole), QString(valueRole), QString(rotationRole), goUnpackStringList(rowCategories), goUnpackStringList(columnCategories), static_cast<QObject*>(parent));
 }
 
 void* QItemModelBarDataProxy_NewQItemModelBarDataProxy6(void* itemModel, char* rowRole, char* columnRole, char* valueRole, char* rowCategories, char* columnCategories, void* parent)
 {
-	return new MyQItemModelBarDataProxy(static_cast<QAbstractItemModel*>(itemModel), QString(rowRole), QString(columnRole), QString(valueRole), QString(rowCategories).split("|", QString::SkipEmptyParts), QString(columnCategories).split("|", QString::SkipEmptyParts), static_cast<QObject*>(parent));
+	return new MyQItemModelBarDataProxy(static_cast<QAbstractItemModel*>(itemModel), QString(rowRole), QString(columnRole), QString(valueRole), goUnpackStringList(rowCategories), goUnpackStringList(columnCategories), static_cast<QObject*>(parent));
 }
 
 void* QItemModelBarDataProxy_NewQItemModelBarDataProxy3(void* itemModel, char* valueRole, void* parent)
@@ -5710,7 +5779,7 @@ void QItemModelBarDataProxy_MultiMatchBehaviorChanged(void* ptr, long long behav
 
 void QItemModelBarDataProxy_Remap(void* ptr, char* rowRole, char* columnRole, char* valueRole, char* rotationRole, char* rowCategories, char* columnCategories)
 {
-	static_cast<QItemModelBarDataProxy*>(ptr)->remap(QString(rowRole), QString(columnRole), QString(valueRole), QString(rotationRole), QString(rowCategories).split("|", QString::SkipEmptyParts), QString(columnCategories).split("|", QString::SkipEmptyParts));
+	static_cast<QItemModelBarDataProxy*>(ptr)->remap(QString(rowRole), QString(columnRole), QString(valueRole), QString(rotationRole), goUnpackStringList(rowCategories), goUnpackStringList(columnCategories));
 }
 
 void QItemModelBarDataProxy_ConnectRotationRoleChanged(void* ptr)
@@ -5830,7 +5899,7 @@ void QItemModelBarDataProxy_SetAutoRowCategories(void* ptr, char enable)
 
 void QItemModelBarDataProxy_SetColumnCategories(void* ptr, char* categories)
 {
-	static_cast<QItemModelBarDataProxy*>(ptr)->setColumnCategories(QString(categories).split("|", QString::SkipEmptyParts));
+	static_cast<QItemModelBarDataProxy*>(ptr)->setColumnCategories(goUnpackStringList(categories));
 }
 
 void QItemModelBarDataProxy_SetColumnRole(void* ptr, char* role)
@@ -5875,7 +5944,7 @@ void QItemModelBarDataProxy_SetRotationRoleReplace(void* ptr, char* replace)
 
 void QItemModelBarDataProxy_SetRowCategories(void* ptr, char* categories)
 {
-	static_cast<QItemModelBarDataProxy*>(ptr)->setRowCategories(QString(categories).split("|", QString::SkipEmptyParts));
+	static_cast<QItemModelBarDataProxy*>(ptr)->setRowCategories(goUnpackStringList(categories));
 }
 
 void QItemModelBarDataProxy_SetRowRole(void* ptr, char* role)
@@ -6055,12 +6124,12 @@ struct QtDataVisualization_PackedString QItemModelBarDataProxy_ValueRoleReplace(
 
 struct QtDataVisualization_PackedString QItemModelBarDataProxy_ColumnCategories(void* ptr)
 {
-	return ({ QByteArray t86b84b = static_cast<QItemModelBarDataProxy*>(ptr)->columnCategories().join("|").toUtf8(); QtDataVisualization_PackedString { const_cast<char*>(t86b84b.prepend("WHITESPACE").constData()+10), t86b84b.size()-10 }; });
+	return ({ long long t86b84blen; char* t86b84b = goPackStringList(static_cast<QItemModelBarDataProxy*>(ptr)->columnCategories(), &t86b84blen); QtDataVisualization_PackedString { t86b84b, t86b84blen }; });
 }
 
 struct QtDataVisualization_PackedString QItemModelBarDataProxy_RowCategories(void* ptr)
 {
-	return ({ QByteArray t50f4e1 = static_cast<QItemModelBarDataProxy*>(ptr)->rowCategories().join("|").toUtf8(); QtDataVisualization_PackedString { const_cast<char*>(t50f4e1.prepend("WHITESPACE").constData()+10), t50f4e1.size()-10 }; });
+	return ({ long long t50f4e1len; char* t50f4e1 = goPackStringList(static_cast<QItemModelBarDataProxy*>(ptr)->rowCategories(), &t50f4e1len); QtDataVisualization_PackedString { t50f4e1, t50f4e1len }; });
 }
 
 char QItemModelBarDataProxy_AutoColumnCategories(void* ptr)
@@ -6508,7 +6577,7 @@ void* QItemModelSurfaceDataProxy_NewQItemModelSurfaceDataProxy5(void* itemModel,
 
 void* QItemModelSurfaceDataProxy_NewQItemModelSurfaceDataProxy7(void* itemModel, char* rowRole, char* columnRole, char* xPosRole, char* yPosRole, char* zPosRole, char* rowCategories, char* columnCategories, void* parent)
 {
-	return new MyQItemModelSurfaceDataProxy(static_cast<QAbstractItemModel*>(itemModel), QString(rowRole), QString(columnRole), QString(xPosRole), QString(yPosRole), QString(zPosRole), QString(rowCategories).split("|", QString::SkipEmptyParts), QString(columnCategories).split("|", QString::SkipEmptyParts), static_cast<QObject*>(parent));
+	return new MyQItemModelSurfaceDataProxy(static_cast<QAbstractItemModel*>(itemModel), QString(rowRole), QString(columnRole), QString(xPosRole), QString(yPosRole), QString(zPosRole), goUnpackStringList(rowCategories), goUnpackStringList(columnCategories), static_cast<QObject*>(parent));
 }
 
 void* QItemModelSurfaceDataProxy_NewQItemModelSurfaceDataProxy4(void* itemModel, char* rowRole, char* columnRole, char* yPosRole, void* parent)
@@ -6518,7 +6587,7 @@ void* QItemModelSurfaceDataProxy_NewQItemModelSurfaceDataProxy4(void* itemModel,
 
 void* QItemModelSurfaceDataProxy_NewQItemModelSurfaceDataProxy6(void* itemModel, char* rowRole, char* columnRole, char* yPosRole, char* rowCategories, char* columnCategories, void* parent)
 {
-	return new MyQItemModelSurfaceDataProxy(static_cast<QAbstractItemModel*>(itemModel), QString(rowRole), QString(columnRole), QString(yPosRole), QString(rowCategories).split("|", QString::SkipEmptyParts), QString(columnCategories).split("|", QString::SkipEmptyParts), static_cast<QObject*>(parent));
+	return new MyQItemModelSurfaceDataProxy(static_cast<QAbstractItemModel*>(itemModel), QString(rowRole), QString(columnRole), QString(yPosRole), goUnpackStringList(rowCategories), goUnpackStringList(columnCategories), static_cast<QObject*>(parent));
 }
 
 void* QItemModelSurfaceDataProxy_NewQItemModelSurfaceDataProxy3(void* itemModel, char* yPosRole, void* parent)
@@ -6663,7 +6732,7 @@ void QItemModelSurfaceDataProxy_MultiMatchBehaviorChanged(void* ptr, long long b
 
 void QItemModelSurfaceDataProxy_Remap(void* ptr, char* rowRole, char* columnRole, char* xPosRole, char* yPosRole, char* zPosRole, char* rowCategories, char* columnCategories)
 {
-	static_cast<QItemModelSurfaceDataProxy*>(ptr)->remap(QString(rowRole), QString(columnRole), QString(xPosRole), QString(yPosRole), QString(zPosRole), QString(rowCategories).split("|", QString::SkipEmptyParts), QString(columnCategories).split("|", QString::SkipEmptyParts));
+	static_cast<QItemModelSurfaceDataProxy*>(ptr)->remap(QString(rowRole), QString(columnRole), QString(xPosRole), QString(yPosRole), QString(zPosRole), goUnpackStringList(rowCategories), goUnpackStringList(columnCategories));
 }
 
 void QItemModelSurfaceDataProxy_ConnectRowCategoriesChanged(void* ptr)
@@ -6738,7 +6807,7 @@ void QItemModelSurfaceDataProxy_SetAutoRowCategories(void* ptr, char enable)
 
 void QItemModelSurfaceDataProxy_SetColumnCategories(void* ptr, char* categories)
 {
-	static_cast<QItemModelSurfaceDataProxy*>(ptr)->setColumnCategories(QString(categories).split("|", QString::SkipEmptyParts));
+	static_cast<QItemModelSurfaceDataProxy*>(ptr)->setColumnCategories(goUnpackStringList(categories));
 }
 
 void QItemModelSurfaceDataProxy_SetColumnRole(void* ptr, char* role)
@@ -6768,7 +6837,7 @@ void QItemModelSurfaceDataProxy_SetMultiMatchBehavior(void* ptr, long long behav
 
 void QItemModelSurfaceDataProxy_SetRowCategories(void* ptr, char* categories)
 {
-	static_cast<QItemModelSurfaceDataProxy*>(ptr)->setRowCategories(QString(categories).split("|", QString::SkipEmptyParts));
+	static_cast<QItemModelSurfaceDataProxy*>(ptr)->setRowCategories(goUnpackStringList(categories));
 }
 
 void QItemModelSurfaceDataProxy_SetRowRole(void* ptr, char* role)
@@ -7083,12 +7152,12 @@ struct QtDataVisualization_PackedString QItemModelSurfaceDataProxy_ZPosRoleRepla
 
 struct QtDataVisualization_PackedString QItemModelSurfaceDataProxy_ColumnCategories(void* ptr)
 {
-	return ({ QByteArray tb94ba4 = static_cast<QItemModelSurfaceDataProxy*>(ptr)->columnCategories().join("|").toUtf8(); QtDataVisualization_PackedString { const_cast<char*>(tb94ba4.prepend("WHITESPACE").constData()+10), tb94ba4.size()-10 }; });
+	return ({ long long tb94ba4len; char* tb94ba4 = goPackStringList(static_cast<QItemModelSurfaceDataProxy*>(ptr)->columnCategories(), &tb94ba4len); QtDataVisualization_PackedString { tb94ba4, tb94ba4len }; });
 }
 
 struct QtDataVisualization_PackedString QItemModelSurfaceDataProxy_RowCategories(void* ptr)
 {
-	return ({ QByteArray t02a480 = static_cast<QItemModelSurfaceDataProxy*>(ptr)->rowCategories().join("|").toUtf8(); QtDataVisualization_PackedString { const_cast<char*>(t02a480.prepend("WHITESPACE").constData()+10), t02a480.size()-10 }; });
+	return ({ long long t02a480len; char* t02a480 = goPackStringList(static_cast<QItemModelSurfaceDataProxy*>(ptr)->rowCategories(), &t02a480len); QtDataVisualization_PackedString { t02a480, t02a480len }; });
 }
 
 char QItemModelSurfaceDataProxy_AutoColumnCategories(void* ptr)
@@ -8297,7 +8366,7 @@ struct QtDataVisualization_PackedString QValue3DAxisFormatter_StringForValueDefa
 
 struct QtDataVisualization_PackedString QValue3DAxisFormatter_LabelStrings(void* ptr)
 {
-	return ({ QByteArray td5e8ca = static_cast<QValue3DAxisFormatter*>(ptr)->labelStrings().join("|").toUtf8(); QtDataVisualization_PackedString { const_cast<char*>(td5e8ca.prepend("WHITESPACE").constData()+10), td5e8ca.size()-10 }; });
+	return ({ long long td5e8calen; char* td5e8ca = goPackStringList(static_cast<QValue3DAxisFormatter*>(ptr)->labelStrings(), &td5e8calen); QtDataVisualization_PackedString { td5e8ca, td5e8calen }; });
 }
 
 void* QValue3DAxisFormatter_Axis(void* ptr)
@@ -8385,6 +8454,16 @@ void* QValue3DAxisFormatter___gridPositions_newList(void* ptr)
 	return new QVector<float>;
 }
 
+void* QValue3DAxisFormatter___gridPositions_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<float>* tmpList = new QVector<float>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<float*>(data)[i]); tmpList; });
+}
+
+void QValue3DAxisFormatter___gridPositions_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<float>*>(ptr)->size(); i++) static_cast<float*>(data)[i] = static_cast<QVector<float>*>(ptr)->at(i);
+}
+
 float QValue3DAxisFormatter___labelPositions_atList(void* ptr, int i)
 {
 	return static_cast<QVector<float>*>(ptr)->at(i);
@@ -8400,6 +8479,16 @@ void* QValue3DAxisFormatter___labelPositions_newList(void* ptr)
 	return new QVector<float>;
 }
 
+void* QValue3DAxisFormatter___labelPositions_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<float>* tmpList = new QVector<float>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<float*>(data)[i]); tmpList; });
+}
+
+void QValue3DAxisFormatter___labelPositions_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<float>*>(ptr)->size(); i++) static_cast<float*>(data)[i] = static_cast<QVector<float>*>(ptr)->at(i);
+}
+
 float QValue3DAxisFormatter___subGridPositions_atList(void* ptr, int i)
 {
 	return static_cast<QVector<float>*>(ptr)->at(i);
@@ -8415,3 +8504,13 @@ void* QValue3DAxisFormatter___subGridPositions_newList(void* ptr)
 	return new QVector<float>;
 }
 
+void* QValue3DAxisFormatter___subGridPositions_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<float>* tmpList = new QVector<float>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<float*>(data)[i]); tmpList; });
+}
+
+void QValue3DAxisFormatter___subGridPositions_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<float>*>(ptr)->size(); i++) static_cast<float*>(data)[i] = static_cast<QVector<float>*>(ptr)->at(i);
+}
+
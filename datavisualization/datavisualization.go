@@ -8,12 +8,10 @@ package datavisualization
 //#include "datavisualization.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"github.com/therecipe/qt/gui"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -23,6 +21,43 @@ func cGoUnpackString(s C.struct_QtDataVisualization_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtDataVisualization_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtDataVisualization_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type Q3DBars struct {
 	ptr unsafe.Pointer
@@ -79,7 +114,7 @@ func (ptr *Q3DBars) AddSeries(series QBar3DSeries_ITF) {
 
 //export callbackQ3DBars_BarSpacingChanged
 func callbackQ3DBars_BarSpacingChanged(ptr unsafe.Pointer, spacing unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "barSpacingChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "barSpacingChanged"); signal != nil {
 		signal.(func(*core.QSizeF))(core.NewQSizeFFromPointer(spacing))
 	}
 
@@ -88,14 +123,14 @@ func callbackQ3DBars_BarSpacingChanged(ptr unsafe.Pointer, spacing unsafe.Pointe
 func (ptr *Q3DBars) ConnectBarSpacingChanged(f func(spacing *core.QSizeF)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectBarSpacingChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "barSpacingChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "barSpacingChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectBarSpacingChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectBarSpacingChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "barSpacingChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "barSpacingChanged")
 	}
 }
 
@@ -107,7 +142,7 @@ func (ptr *Q3DBars) BarSpacingChanged(spacing core.QSizeF_ITF) {
 
 //export callbackQ3DBars_BarSpacingRelativeChanged
 func callbackQ3DBars_BarSpacingRelativeChanged(ptr unsafe.Pointer, relative C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "barSpacingRelativeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "barSpacingRelativeChanged"); signal != nil {
 		signal.(func(bool))(int8(relative) != 0)
 	}
 
@@ -116,14 +151,14 @@ func callbackQ3DBars_BarSpacingRelativeChanged(ptr unsafe.Pointer, relative C.ch
 func (ptr *Q3DBars) ConnectBarSpacingRelativeChanged(f func(relative bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectBarSpacingRelativeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "barSpacingRelativeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "barSpacingRelativeChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectBarSpacingRelativeChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectBarSpacingRelativeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "barSpacingRelativeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "barSpacingRelativeChanged")
 	}
 }
 
@@ -135,7 +170,7 @@ func (ptr *Q3DBars) BarSpacingRelativeChanged(relative bool) {
 
 //export callbackQ3DBars_BarThicknessChanged
 func callbackQ3DBars_BarThicknessChanged(ptr unsafe.Pointer, thicknessRatio C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "barThicknessChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "barThicknessChanged"); signal != nil {
 		signal.(func(float32))(float32(thicknessRatio))
 	}
 
@@ -144,14 +179,14 @@ func callbackQ3DBars_BarThicknessChanged(ptr unsafe.Pointer, thicknessRatio C.fl
 func (ptr *Q3DBars) ConnectBarThicknessChanged(f func(thicknessRatio float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectBarThicknessChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "barThicknessChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "barThicknessChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectBarThicknessChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectBarThicknessChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "barThicknessChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "barThicknessChanged")
 	}
 }
 
@@ -163,7 +198,7 @@ func (ptr *Q3DBars) BarThicknessChanged(thicknessRatio float32) {
 
 //export callbackQ3DBars_ColumnAxisChanged
 func callbackQ3DBars_ColumnAxisChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnAxisChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnAxisChanged"); signal != nil {
 		signal.(func(*QCategory3DAxis))(NewQCategory3DAxisFromPointer(axis))
 	}
 
@@ -172,14 +207,14 @@ func callbackQ3DBars_ColumnAxisChanged(ptr unsafe.Pointer, axis unsafe.Pointer)
 func (ptr *Q3DBars) ConnectColumnAxisChanged(f func(axis *QCategory3DAxis)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectColumnAxisChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnAxisChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnAxisChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectColumnAxisChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectColumnAxisChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnAxisChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnAxisChanged")
 	}
 }
 
@@ -191,7 +226,7 @@ func (ptr *Q3DBars) ColumnAxisChanged(axis QCategory3DAxis_ITF) {
 
 //export callbackQ3DBars_FloorLevelChanged
 func callbackQ3DBars_FloorLevelChanged(ptr unsafe.Pointer, level C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "floorLevelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "floorLevelChanged"); signal != nil {
 		signal.(func(float32))(float32(level))
 	}
 
@@ -200,14 +235,14 @@ func callbackQ3DBars_FloorLevelChanged(ptr unsafe.Pointer, level C.float) {
 func (ptr *Q3DBars) ConnectFloorLevelChanged(f func(level float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectFloorLevelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "floorLevelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "floorLevelChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectFloorLevelChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectFloorLevelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "floorLevelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "floorLevelChanged")
 	}
 }
 
@@ -225,7 +260,7 @@ func (ptr *Q3DBars) InsertSeries(index int, series QBar3DSeries_ITF) {
 
 //export callbackQ3DBars_MultiSeriesUniformChanged
 func callbackQ3DBars_MultiSeriesUniformChanged(ptr unsafe.Pointer, uniform C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "multiSeriesUniformChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "multiSeriesUniformChanged"); signal != nil {
 		signal.(func(bool))(int8(uniform) != 0)
 	}
 
@@ -234,14 +269,14 @@ func callbackQ3DBars_MultiSeriesUniformChanged(ptr unsafe.Pointer, uniform C.cha
 func (ptr *Q3DBars) ConnectMultiSeriesUniformChanged(f func(uniform bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectMultiSeriesUniformChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "multiSeriesUniformChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "multiSeriesUniformChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectMultiSeriesUniformChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectMultiSeriesUniformChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "multiSeriesUniformChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "multiSeriesUniformChanged")
 	}
 }
 
@@ -253,7 +288,7 @@ func (ptr *Q3DBars) MultiSeriesUniformChanged(uniform bool) {
 
 //export callbackQ3DBars_PrimarySeriesChanged
 func callbackQ3DBars_PrimarySeriesChanged(ptr unsafe.Pointer, series unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "primarySeriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "primarySeriesChanged"); signal != nil {
 		signal.(func(*QBar3DSeries))(NewQBar3DSeriesFromPointer(series))
 	}
 
@@ -262,14 +297,14 @@ func callbackQ3DBars_PrimarySeriesChanged(ptr unsafe.Pointer, series unsafe.Poin
 func (ptr *Q3DBars) ConnectPrimarySeriesChanged(f func(series *QBar3DSeries)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectPrimarySeriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "primarySeriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "primarySeriesChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectPrimarySeriesChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectPrimarySeriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "primarySeriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "primarySeriesChanged")
 	}
 }
 
@@ -293,7 +328,7 @@ func (ptr *Q3DBars) RemoveSeries(series QBar3DSeries_ITF) {
 
 //export callbackQ3DBars_RowAxisChanged
 func callbackQ3DBars_RowAxisChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowAxisChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowAxisChanged"); signal != nil {
 		signal.(func(*QCategory3DAxis))(NewQCategory3DAxisFromPointer(axis))
 	}
 
@@ -302,14 +337,14 @@ func callbackQ3DBars_RowAxisChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
 func (ptr *Q3DBars) ConnectRowAxisChanged(f func(axis *QCategory3DAxis)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectRowAxisChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowAxisChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowAxisChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectRowAxisChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectRowAxisChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowAxisChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowAxisChanged")
 	}
 }
 
@@ -321,7 +356,7 @@ func (ptr *Q3DBars) RowAxisChanged(axis QCategory3DAxis_ITF) {
 
 //export callbackQ3DBars_SelectedSeriesChanged
 func callbackQ3DBars_SelectedSeriesChanged(ptr unsafe.Pointer, series unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedSeriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedSeriesChanged"); signal != nil {
 		signal.(func(*QBar3DSeries))(NewQBar3DSeriesFromPointer(series))
 	}
 
@@ -330,14 +365,14 @@ func callbackQ3DBars_SelectedSeriesChanged(ptr unsafe.Pointer, series unsafe.Poi
 func (ptr *Q3DBars) ConnectSelectedSeriesChanged(f func(series *QBar3DSeries)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectSelectedSeriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedSeriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedSeriesChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectSelectedSeriesChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectSelectedSeriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedSeriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedSeriesChanged")
 	}
 }
 
@@ -403,7 +438,7 @@ func (ptr *Q3DBars) SetValueAxis(axis QValue3DAxis_ITF) {
 
 //export callbackQ3DBars_ValueAxisChanged
 func callbackQ3DBars_ValueAxisChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueAxisChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueAxisChanged"); signal != nil {
 		signal.(func(*QValue3DAxis))(NewQValue3DAxisFromPointer(axis))
 	}
 
@@ -412,14 +447,14 @@ func callbackQ3DBars_ValueAxisChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
 func (ptr *Q3DBars) ConnectValueAxisChanged(f func(axis *QValue3DAxis)) {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_ConnectValueAxisChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueAxisChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueAxisChanged", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectValueAxisChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DisconnectValueAxisChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueAxisChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valueAxisChanged")
 	}
 }
 
@@ -431,7 +466,7 @@ func (ptr *Q3DBars) ValueAxisChanged(axis QValue3DAxis_ITF) {
 
 //export callbackQ3DBars_DestroyQ3DBars
 func callbackQ3DBars_DestroyQ3DBars(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~Q3DBars"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~Q3DBars"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQ3DBarsFromPointer(ptr).DestroyQ3DBarsDefault()
@@ -441,21 +476,21 @@ func callbackQ3DBars_DestroyQ3DBars(ptr unsafe.Pointer) {
 func (ptr *Q3DBars) ConnectDestroyQ3DBars(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DBars", f)
+		qt.ConnectSignal(ptr.Pointer(), "~Q3DBars", f)
 	}
 }
 
 func (ptr *Q3DBars) DisconnectDestroyQ3DBars() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DBars")
+		qt.DisconnectSignal(ptr.Pointer(), "~Q3DBars")
 	}
 }
 
 func (ptr *Q3DBars) DestroyQ3DBars() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DestroyQ3DBars(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -463,7 +498,7 @@ func (ptr *Q3DBars) DestroyQ3DBars() {
 func (ptr *Q3DBars) DestroyQ3DBarsDefault() {
 	if ptr.Pointer() != nil {
 		C.Q3DBars_DestroyQ3DBarsDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -688,7 +723,7 @@ func NewQ3DCamera(parent core.QObject_ITF) *Q3DCamera {
 
 //export callbackQ3DCamera_CameraPresetChanged
 func callbackQ3DCamera_CameraPresetChanged(ptr unsafe.Pointer, preset C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cameraPresetChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cameraPresetChanged"); signal != nil {
 		signal.(func(Q3DCamera__CameraPreset))(Q3DCamera__CameraPreset(preset))
 	}
 
@@ -697,14 +732,14 @@ func callbackQ3DCamera_CameraPresetChanged(ptr unsafe.Pointer, preset C.longlong
 func (ptr *Q3DCamera) ConnectCameraPresetChanged(f func(preset Q3DCamera__CameraPreset)) {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_ConnectCameraPresetChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cameraPresetChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "cameraPresetChanged", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectCameraPresetChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DisconnectCameraPresetChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cameraPresetChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "cameraPresetChanged")
 	}
 }
 
@@ -716,7 +751,7 @@ func (ptr *Q3DCamera) CameraPresetChanged(preset Q3DCamera__CameraPreset) {
 
 //export callbackQ3DCamera_CopyValuesFrom
 func callbackQ3DCamera_CopyValuesFrom(ptr unsafe.Pointer, source unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "copyValuesFrom"); signal != nil {
+	if signal := qt.GetSignal(ptr, "copyValuesFrom"); signal != nil {
 		signal.(func(*Q3DObject))(NewQ3DObjectFromPointer(source))
 	} else {
 		NewQ3DCameraFromPointer(ptr).CopyValuesFromDefault(NewQ3DObjectFromPointer(source))
@@ -726,14 +761,14 @@ func callbackQ3DCamera_CopyValuesFrom(ptr unsafe.Pointer, source unsafe.Pointer)
 func (ptr *Q3DCamera) ConnectCopyValuesFrom(f func(source *Q3DObject)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "copyValuesFrom", f)
+		qt.ConnectSignal(ptr.Pointer(), "copyValuesFrom", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectCopyValuesFrom() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "copyValuesFrom")
+		qt.DisconnectSignal(ptr.Pointer(), "copyValuesFrom")
 	}
 }
 
@@ -751,7 +786,7 @@ func (ptr *Q3DCamera) CopyValuesFromDefault(source Q3DObject_ITF) {
 
 //export callbackQ3DCamera_MaxZoomLevelChanged
 func callbackQ3DCamera_MaxZoomLevelChanged(ptr unsafe.Pointer, zoomLevel C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maxZoomLevelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maxZoomLevelChanged"); signal != nil {
 		signal.(func(float32))(float32(zoomLevel))
 	}
 
@@ -760,14 +795,14 @@ func callbackQ3DCamera_MaxZoomLevelChanged(ptr unsafe.Pointer, zoomLevel C.float
 func (ptr *Q3DCamera) ConnectMaxZoomLevelChanged(f func(zoomLevel float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_ConnectMaxZoomLevelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maxZoomLevelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maxZoomLevelChanged", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectMaxZoomLevelChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DisconnectMaxZoomLevelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maxZoomLevelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maxZoomLevelChanged")
 	}
 }
 
@@ -779,7 +814,7 @@ func (ptr *Q3DCamera) MaxZoomLevelChanged(zoomLevel float32) {
 
 //export callbackQ3DCamera_MinZoomLevelChanged
 func callbackQ3DCamera_MinZoomLevelChanged(ptr unsafe.Pointer, zoomLevel C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minZoomLevelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minZoomLevelChanged"); signal != nil {
 		signal.(func(float32))(float32(zoomLevel))
 	}
 
@@ -788,14 +823,14 @@ func callbackQ3DCamera_MinZoomLevelChanged(ptr unsafe.Pointer, zoomLevel C.float
 func (ptr *Q3DCamera) ConnectMinZoomLevelChanged(f func(zoomLevel float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_ConnectMinZoomLevelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minZoomLevelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minZoomLevelChanged", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectMinZoomLevelChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DisconnectMinZoomLevelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minZoomLevelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minZoomLevelChanged")
 	}
 }
 
@@ -855,7 +890,7 @@ func (ptr *Q3DCamera) SetZoomLevel(zoomLevel float32) {
 
 //export callbackQ3DCamera_TargetChanged
 func callbackQ3DCamera_TargetChanged(ptr unsafe.Pointer, target unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "targetChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "targetChanged"); signal != nil {
 		signal.(func(*gui.QVector3D))(gui.NewQVector3DFromPointer(target))
 	}
 
@@ -864,14 +899,14 @@ func callbackQ3DCamera_TargetChanged(ptr unsafe.Pointer, target unsafe.Pointer)
 func (ptr *Q3DCamera) ConnectTargetChanged(f func(target *gui.QVector3D)) {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_ConnectTargetChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "targetChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "targetChanged", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectTargetChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DisconnectTargetChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "targetChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "targetChanged")
 	}
 }
 
@@ -883,7 +918,7 @@ func (ptr *Q3DCamera) TargetChanged(target gui.QVector3D_ITF) {
 
 //export callbackQ3DCamera_WrapXRotationChanged
 func callbackQ3DCamera_WrapXRotationChanged(ptr unsafe.Pointer, isEnabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wrapXRotationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wrapXRotationChanged"); signal != nil {
 		signal.(func(bool))(int8(isEnabled) != 0)
 	}
 
@@ -892,14 +927,14 @@ func callbackQ3DCamera_WrapXRotationChanged(ptr unsafe.Pointer, isEnabled C.char
 func (ptr *Q3DCamera) ConnectWrapXRotationChanged(f func(isEnabled bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_ConnectWrapXRotationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "wrapXRotationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "wrapXRotationChanged", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectWrapXRotationChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DisconnectWrapXRotationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "wrapXRotationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "wrapXRotationChanged")
 	}
 }
 
@@ -911,7 +946,7 @@ func (ptr *Q3DCamera) WrapXRotationChanged(isEnabled bool) {
 
 //export callbackQ3DCamera_WrapYRotationChanged
 func callbackQ3DCamera_WrapYRotationChanged(ptr unsafe.Pointer, isEnabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wrapYRotationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wrapYRotationChanged"); signal != nil {
 		signal.(func(bool))(int8(isEnabled) != 0)
 	}
 
@@ -920,14 +955,14 @@ func callbackQ3DCamera_WrapYRotationChanged(ptr unsafe.Pointer, isEnabled C.char
 func (ptr *Q3DCamera) ConnectWrapYRotationChanged(f func(isEnabled bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_ConnectWrapYRotationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "wrapYRotationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "wrapYRotationChanged", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectWrapYRotationChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DisconnectWrapYRotationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "wrapYRotationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "wrapYRotationChanged")
 	}
 }
 
@@ -939,7 +974,7 @@ func (ptr *Q3DCamera) WrapYRotationChanged(isEnabled bool) {
 
 //export callbackQ3DCamera_XRotationChanged
 func callbackQ3DCamera_XRotationChanged(ptr unsafe.Pointer, rotation C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xRotationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xRotationChanged"); signal != nil {
 		signal.(func(float32))(float32(rotation))
 	}
 
@@ -948,14 +983,14 @@ func callbackQ3DCamera_XRotationChanged(ptr unsafe.Pointer, rotation C.float) {
 func (ptr *Q3DCamera) ConnectXRotationChanged(f func(rotation float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_ConnectXRotationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xRotationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xRotationChanged", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectXRotationChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DisconnectXRotationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xRotationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xRotationChanged")
 	}
 }
 
@@ -967,7 +1002,7 @@ func (ptr *Q3DCamera) XRotationChanged(rotation float32) {
 
 //export callbackQ3DCamera_YRotationChanged
 func callbackQ3DCamera_YRotationChanged(ptr unsafe.Pointer, rotation C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yRotationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yRotationChanged"); signal != nil {
 		signal.(func(float32))(float32(rotation))
 	}
 
@@ -976,14 +1011,14 @@ func callbackQ3DCamera_YRotationChanged(ptr unsafe.Pointer, rotation C.float) {
 func (ptr *Q3DCamera) ConnectYRotationChanged(f func(rotation float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_ConnectYRotationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yRotationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yRotationChanged", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectYRotationChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DisconnectYRotationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yRotationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yRotationChanged")
 	}
 }
 
@@ -995,7 +1030,7 @@ func (ptr *Q3DCamera) YRotationChanged(rotation float32) {
 
 //export callbackQ3DCamera_ZoomLevelChanged
 func callbackQ3DCamera_ZoomLevelChanged(ptr unsafe.Pointer, zoomLevel C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zoomLevelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zoomLevelChanged"); signal != nil {
 		signal.(func(float32))(float32(zoomLevel))
 	}
 
@@ -1004,14 +1039,14 @@ func callbackQ3DCamera_ZoomLevelChanged(ptr unsafe.Pointer, zoomLevel C.float) {
 func (ptr *Q3DCamera) ConnectZoomLevelChanged(f func(zoomLevel float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_ConnectZoomLevelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zoomLevelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "zoomLevelChanged", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectZoomLevelChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DisconnectZoomLevelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zoomLevelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "zoomLevelChanged")
 	}
 }
 
@@ -1023,7 +1058,7 @@ func (ptr *Q3DCamera) ZoomLevelChanged(zoomLevel float32) {
 
 //export callbackQ3DCamera_DestroyQ3DCamera
 func callbackQ3DCamera_DestroyQ3DCamera(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~Q3DCamera"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~Q3DCamera"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQ3DCameraFromPointer(ptr).DestroyQ3DCameraDefault()
@@ -1033,21 +1068,21 @@ func callbackQ3DCamera_DestroyQ3DCamera(ptr unsafe.Pointer) {
 func (ptr *Q3DCamera) ConnectDestroyQ3DCamera(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DCamera", f)
+		qt.ConnectSignal(ptr.Pointer(), "~Q3DCamera", f)
 	}
 }
 
 func (ptr *Q3DCamera) DisconnectDestroyQ3DCamera() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DCamera")
+		qt.DisconnectSignal(ptr.Pointer(), "~Q3DCamera")
 	}
 }
 
 func (ptr *Q3DCamera) DestroyQ3DCamera() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DestroyQ3DCamera(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1055,7 +1090,7 @@ func (ptr *Q3DCamera) DestroyQ3DCamera() {
 func (ptr *Q3DCamera) DestroyQ3DCameraDefault() {
 	if ptr.Pointer() != nil {
 		C.Q3DCamera_DestroyQ3DCameraDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1168,7 +1203,7 @@ func NewQ3DInputHandler(parent core.QObject_ITF) *Q3DInputHandler {
 
 //export callbackQ3DInputHandler_MouseMoveEvent
 func callbackQ3DInputHandler_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer, mousePos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent, *core.QPoint))(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
 	} else {
 		NewQ3DInputHandlerFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
@@ -1178,14 +1213,14 @@ func callbackQ3DInputHandler_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Poi
 func (ptr *Q3DInputHandler) ConnectMouseMoveEvent(f func(event *gui.QMouseEvent, mousePos *core.QPoint)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseMoveEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseMoveEvent", f)
 	}
 }
 
 func (ptr *Q3DInputHandler) DisconnectMouseMoveEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseMoveEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseMoveEvent")
 	}
 }
 
@@ -1203,7 +1238,7 @@ func (ptr *Q3DInputHandler) MouseMoveEventDefault(event gui.QMouseEvent_ITF, mou
 
 //export callbackQ3DInputHandler_MousePressEvent
 func callbackQ3DInputHandler_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer, mousePos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent, *core.QPoint))(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
 	} else {
 		NewQ3DInputHandlerFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
@@ -1213,14 +1248,14 @@ func callbackQ3DInputHandler_MousePressEvent(ptr unsafe.Pointer, event unsafe.Po
 func (ptr *Q3DInputHandler) ConnectMousePressEvent(f func(event *gui.QMouseEvent, mousePos *core.QPoint)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mousePressEvent", f)
 	}
 }
 
 func (ptr *Q3DInputHandler) DisconnectMousePressEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mousePressEvent")
 	}
 }
 
@@ -1238,7 +1273,7 @@ func (ptr *Q3DInputHandler) MousePressEventDefault(event gui.QMouseEvent_ITF, mo
 
 //export callbackQ3DInputHandler_MouseReleaseEvent
 func callbackQ3DInputHandler_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer, mousePos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent, *core.QPoint))(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
 	} else {
 		NewQ3DInputHandlerFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
@@ -1248,14 +1283,14 @@ func callbackQ3DInputHandler_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.
 func (ptr *Q3DInputHandler) ConnectMouseReleaseEvent(f func(event *gui.QMouseEvent, mousePos *core.QPoint)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseReleaseEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseReleaseEvent", f)
 	}
 }
 
 func (ptr *Q3DInputHandler) DisconnectMouseReleaseEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseReleaseEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseReleaseEvent")
 	}
 }
 
@@ -1273,7 +1308,7 @@ func (ptr *Q3DInputHandler) MouseReleaseEventDefault(event gui.QMouseEvent_ITF,
 
 //export callbackQ3DInputHandler_RotationEnabledChanged
 func callbackQ3DInputHandler_RotationEnabledChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rotationEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rotationEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -1282,14 +1317,14 @@ func callbackQ3DInputHandler_RotationEnabledChanged(ptr unsafe.Pointer, enable C
 func (ptr *Q3DInputHandler) ConnectRotationEnabledChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_ConnectRotationEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rotationEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rotationEnabledChanged", f)
 	}
 }
 
 func (ptr *Q3DInputHandler) DisconnectRotationEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_DisconnectRotationEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rotationEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rotationEnabledChanged")
 	}
 }
 
@@ -1301,7 +1336,7 @@ func (ptr *Q3DInputHandler) RotationEnabledChanged(enable bool) {
 
 //export callbackQ3DInputHandler_SelectionEnabledChanged
 func callbackQ3DInputHandler_SelectionEnabledChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -1310,14 +1345,14 @@ func callbackQ3DInputHandler_SelectionEnabledChanged(ptr unsafe.Pointer, enable
 func (ptr *Q3DInputHandler) ConnectSelectionEnabledChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_ConnectSelectionEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectionEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectionEnabledChanged", f)
 	}
 }
 
 func (ptr *Q3DInputHandler) DisconnectSelectionEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_DisconnectSelectionEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectionEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectionEnabledChanged")
 	}
 }
 
@@ -1353,7 +1388,7 @@ func (ptr *Q3DInputHandler) SetZoomEnabled(enable bool) {
 
 //export callbackQ3DInputHandler_WheelEvent
 func callbackQ3DInputHandler_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQ3DInputHandlerFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -1363,14 +1398,14 @@ func callbackQ3DInputHandler_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer
 func (ptr *Q3DInputHandler) ConnectWheelEvent(f func(event *gui.QWheelEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "wheelEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "wheelEvent", f)
 	}
 }
 
 func (ptr *Q3DInputHandler) DisconnectWheelEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "wheelEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "wheelEvent")
 	}
 }
 
@@ -1388,7 +1423,7 @@ func (ptr *Q3DInputHandler) WheelEventDefault(event gui.QWheelEvent_ITF) {
 
 //export callbackQ3DInputHandler_ZoomAtTargetEnabledChanged
 func callbackQ3DInputHandler_ZoomAtTargetEnabledChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zoomAtTargetEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zoomAtTargetEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -1397,14 +1432,14 @@ func callbackQ3DInputHandler_ZoomAtTargetEnabledChanged(ptr unsafe.Pointer, enab
 func (ptr *Q3DInputHandler) ConnectZoomAtTargetEnabledChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_ConnectZoomAtTargetEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zoomAtTargetEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "zoomAtTargetEnabledChanged", f)
 	}
 }
 
 func (ptr *Q3DInputHandler) DisconnectZoomAtTargetEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_DisconnectZoomAtTargetEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zoomAtTargetEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "zoomAtTargetEnabledChanged")
 	}
 }
 
@@ -1416,7 +1451,7 @@ func (ptr *Q3DInputHandler) ZoomAtTargetEnabledChanged(enable bool) {
 
 //export callbackQ3DInputHandler_ZoomEnabledChanged
 func callbackQ3DInputHandler_ZoomEnabledChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zoomEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zoomEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -1425,14 +1460,14 @@ func callbackQ3DInputHandler_ZoomEnabledChanged(ptr unsafe.Pointer, enable C.cha
 func (ptr *Q3DInputHandler) ConnectZoomEnabledChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_ConnectZoomEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zoomEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "zoomEnabledChanged", f)
 	}
 }
 
 func (ptr *Q3DInputHandler) DisconnectZoomEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_DisconnectZoomEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zoomEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "zoomEnabledChanged")
 	}
 }
 
@@ -1444,7 +1479,7 @@ func (ptr *Q3DInputHandler) ZoomEnabledChanged(enable bool) {
 
 //export callbackQ3DInputHandler_DestroyQ3DInputHandler
 func callbackQ3DInputHandler_DestroyQ3DInputHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~Q3DInputHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~Q3DInputHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQ3DInputHandlerFromPointer(ptr).DestroyQ3DInputHandlerDefault()
@@ -1454,21 +1489,21 @@ func callbackQ3DInputHandler_DestroyQ3DInputHandler(ptr unsafe.Pointer) {
 func (ptr *Q3DInputHandler) ConnectDestroyQ3DInputHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DInputHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~Q3DInputHandler", f)
 	}
 }
 
 func (ptr *Q3DInputHandler) DisconnectDestroyQ3DInputHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DInputHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~Q3DInputHandler")
 	}
 }
 
 func (ptr *Q3DInputHandler) DestroyQ3DInputHandler() {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_DestroyQ3DInputHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1476,7 +1511,7 @@ func (ptr *Q3DInputHandler) DestroyQ3DInputHandler() {
 func (ptr *Q3DInputHandler) DestroyQ3DInputHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.Q3DInputHandler_DestroyQ3DInputHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1552,7 +1587,7 @@ func NewQ3DLight(parent core.QObject_ITF) *Q3DLight {
 
 //export callbackQ3DLight_DestroyQ3DLight
 func callbackQ3DLight_DestroyQ3DLight(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~Q3DLight"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~Q3DLight"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQ3DLightFromPointer(ptr).DestroyQ3DLightDefault()
@@ -1562,21 +1597,21 @@ func callbackQ3DLight_DestroyQ3DLight(ptr unsafe.Pointer) {
 func (ptr *Q3DLight) ConnectDestroyQ3DLight(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DLight", f)
+		qt.ConnectSignal(ptr.Pointer(), "~Q3DLight", f)
 	}
 }
 
 func (ptr *Q3DLight) DisconnectDestroyQ3DLight() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DLight")
+		qt.DisconnectSignal(ptr.Pointer(), "~Q3DLight")
 	}
 }
 
 func (ptr *Q3DLight) DestroyQ3DLight() {
 	if ptr.Pointer() != nil {
 		C.Q3DLight_DestroyQ3DLight(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1584,7 +1619,7 @@ func (ptr *Q3DLight) DestroyQ3DLight() {
 func (ptr *Q3DLight) DestroyQ3DLightDefault() {
 	if ptr.Pointer() != nil {
 		C.Q3DLight_DestroyQ3DLightDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1639,7 +1674,7 @@ func (ptr *Q3DObject) ParentScene() *Q3DScene {
 
 //export callbackQ3DObject_CopyValuesFrom
 func callbackQ3DObject_CopyValuesFrom(ptr unsafe.Pointer, source unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "copyValuesFrom"); signal != nil {
+	if signal := qt.GetSignal(ptr, "copyValuesFrom"); signal != nil {
 		signal.(func(*Q3DObject))(NewQ3DObjectFromPointer(source))
 	} else {
 		NewQ3DObjectFromPointer(ptr).CopyValuesFromDefault(NewQ3DObjectFromPointer(source))
@@ -1649,14 +1684,14 @@ func callbackQ3DObject_CopyValuesFrom(ptr unsafe.Pointer, source unsafe.Pointer)
 func (ptr *Q3DObject) ConnectCopyValuesFrom(f func(source *Q3DObject)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "copyValuesFrom", f)
+		qt.ConnectSignal(ptr.Pointer(), "copyValuesFrom", f)
 	}
 }
 
 func (ptr *Q3DObject) DisconnectCopyValuesFrom() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "copyValuesFrom")
+		qt.DisconnectSignal(ptr.Pointer(), "copyValuesFrom")
 	}
 }
 
@@ -1674,7 +1709,7 @@ func (ptr *Q3DObject) CopyValuesFromDefault(source Q3DObject_ITF) {
 
 //export callbackQ3DObject_PositionChanged
 func callbackQ3DObject_PositionChanged(ptr unsafe.Pointer, position unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "positionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "positionChanged"); signal != nil {
 		signal.(func(*gui.QVector3D))(gui.NewQVector3DFromPointer(position))
 	}
 
@@ -1683,14 +1718,14 @@ func callbackQ3DObject_PositionChanged(ptr unsafe.Pointer, position unsafe.Point
 func (ptr *Q3DObject) ConnectPositionChanged(f func(position *gui.QVector3D)) {
 	if ptr.Pointer() != nil {
 		C.Q3DObject_ConnectPositionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "positionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "positionChanged", f)
 	}
 }
 
 func (ptr *Q3DObject) DisconnectPositionChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DObject_DisconnectPositionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "positionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "positionChanged")
 	}
 }
 
@@ -1714,7 +1749,7 @@ func (ptr *Q3DObject) SetPosition(position gui.QVector3D_ITF) {
 
 //export callbackQ3DObject_DestroyQ3DObject
 func callbackQ3DObject_DestroyQ3DObject(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~Q3DObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~Q3DObject"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQ3DObjectFromPointer(ptr).DestroyQ3DObjectDefault()
@@ -1724,21 +1759,21 @@ func callbackQ3DObject_DestroyQ3DObject(ptr unsafe.Pointer) {
 func (ptr *Q3DObject) ConnectDestroyQ3DObject(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "~Q3DObject", f)
 	}
 }
 
 func (ptr *Q3DObject) DisconnectDestroyQ3DObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DObject")
+		qt.DisconnectSignal(ptr.Pointer(), "~Q3DObject")
 	}
 }
 
 func (ptr *Q3DObject) DestroyQ3DObject() {
 	if ptr.Pointer() != nil {
 		C.Q3DObject_DestroyQ3DObject(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1746,7 +1781,7 @@ func (ptr *Q3DObject) DestroyQ3DObject() {
 func (ptr *Q3DObject) DestroyQ3DObjectDefault() {
 	if ptr.Pointer() != nil {
 		C.Q3DObject_DestroyQ3DObjectDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1822,7 +1857,7 @@ func (ptr *Q3DScatter) AddSeries(series QScatter3DSeries_ITF) {
 
 //export callbackQ3DScatter_AxisXChanged
 func callbackQ3DScatter_AxisXChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisXChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisXChanged"); signal != nil {
 		signal.(func(*QValue3DAxis))(NewQValue3DAxisFromPointer(axis))
 	}
 
@@ -1831,14 +1866,14 @@ func callbackQ3DScatter_AxisXChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
 func (ptr *Q3DScatter) ConnectAxisXChanged(f func(axis *QValue3DAxis)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_ConnectAxisXChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisXChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisXChanged", f)
 	}
 }
 
 func (ptr *Q3DScatter) DisconnectAxisXChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_DisconnectAxisXChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisXChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisXChanged")
 	}
 }
 
@@ -1850,7 +1885,7 @@ func (ptr *Q3DScatter) AxisXChanged(axis QValue3DAxis_ITF) {
 
 //export callbackQ3DScatter_AxisYChanged
 func callbackQ3DScatter_AxisYChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisYChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisYChanged"); signal != nil {
 		signal.(func(*QValue3DAxis))(NewQValue3DAxisFromPointer(axis))
 	}
 
@@ -1859,14 +1894,14 @@ func callbackQ3DScatter_AxisYChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
 func (ptr *Q3DScatter) ConnectAxisYChanged(f func(axis *QValue3DAxis)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_ConnectAxisYChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisYChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisYChanged", f)
 	}
 }
 
 func (ptr *Q3DScatter) DisconnectAxisYChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_DisconnectAxisYChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisYChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisYChanged")
 	}
 }
 
@@ -1878,7 +1913,7 @@ func (ptr *Q3DScatter) AxisYChanged(axis QValue3DAxis_ITF) {
 
 //export callbackQ3DScatter_AxisZChanged
 func callbackQ3DScatter_AxisZChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisZChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisZChanged"); signal != nil {
 		signal.(func(*QValue3DAxis))(NewQValue3DAxisFromPointer(axis))
 	}
 
@@ -1887,14 +1922,14 @@ func callbackQ3DScatter_AxisZChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
 func (ptr *Q3DScatter) ConnectAxisZChanged(f func(axis *QValue3DAxis)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_ConnectAxisZChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisZChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisZChanged", f)
 	}
 }
 
 func (ptr *Q3DScatter) DisconnectAxisZChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_DisconnectAxisZChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisZChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisZChanged")
 	}
 }
 
@@ -1918,7 +1953,7 @@ func (ptr *Q3DScatter) RemoveSeries(series QScatter3DSeries_ITF) {
 
 //export callbackQ3DScatter_SelectedSeriesChanged
 func callbackQ3DScatter_SelectedSeriesChanged(ptr unsafe.Pointer, series unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedSeriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedSeriesChanged"); signal != nil {
 		signal.(func(*QScatter3DSeries))(NewQScatter3DSeriesFromPointer(series))
 	}
 
@@ -1927,14 +1962,14 @@ func callbackQ3DScatter_SelectedSeriesChanged(ptr unsafe.Pointer, series unsafe.
 func (ptr *Q3DScatter) ConnectSelectedSeriesChanged(f func(series *QScatter3DSeries)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_ConnectSelectedSeriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedSeriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedSeriesChanged", f)
 	}
 }
 
 func (ptr *Q3DScatter) DisconnectSelectedSeriesChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_DisconnectSelectedSeriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedSeriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedSeriesChanged")
 	}
 }
 
@@ -1964,7 +1999,7 @@ func (ptr *Q3DScatter) SetAxisZ(axis QValue3DAxis_ITF) {
 
 //export callbackQ3DScatter_DestroyQ3DScatter
 func callbackQ3DScatter_DestroyQ3DScatter(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~Q3DScatter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~Q3DScatter"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQ3DScatterFromPointer(ptr).DestroyQ3DScatterDefault()
@@ -1974,21 +2009,21 @@ func callbackQ3DScatter_DestroyQ3DScatter(ptr unsafe.Pointer) {
 func (ptr *Q3DScatter) ConnectDestroyQ3DScatter(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DScatter", f)
+		qt.ConnectSignal(ptr.Pointer(), "~Q3DScatter", f)
 	}
 }
 
 func (ptr *Q3DScatter) DisconnectDestroyQ3DScatter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DScatter")
+		qt.DisconnectSignal(ptr.Pointer(), "~Q3DScatter")
 	}
 }
 
 func (ptr *Q3DScatter) DestroyQ3DScatter() {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_DestroyQ3DScatter(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1996,7 +2031,7 @@ func (ptr *Q3DScatter) DestroyQ3DScatter() {
 func (ptr *Q3DScatter) DestroyQ3DScatterDefault() {
 	if ptr.Pointer() != nil {
 		C.Q3DScatter_DestroyQ3DScatterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2158,7 +2193,7 @@ func (ptr *Q3DScene) IsPointInSecondarySubView(point core.QPoint_ITF) bool {
 
 //export callbackQ3DScene_ActiveCameraChanged
 func callbackQ3DScene_ActiveCameraChanged(ptr unsafe.Pointer, camera unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeCameraChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeCameraChanged"); signal != nil {
 		signal.(func(*Q3DCamera))(NewQ3DCameraFromPointer(camera))
 	}
 
@@ -2167,14 +2202,14 @@ func callbackQ3DScene_ActiveCameraChanged(ptr unsafe.Pointer, camera unsafe.Poin
 func (ptr *Q3DScene) ConnectActiveCameraChanged(f func(camera *Q3DCamera)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectActiveCameraChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeCameraChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeCameraChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectActiveCameraChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectActiveCameraChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeCameraChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "activeCameraChanged")
 	}
 }
 
@@ -2186,7 +2221,7 @@ func (ptr *Q3DScene) ActiveCameraChanged(camera Q3DCamera_ITF) {
 
 //export callbackQ3DScene_ActiveLightChanged
 func callbackQ3DScene_ActiveLightChanged(ptr unsafe.Pointer, light unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeLightChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeLightChanged"); signal != nil {
 		signal.(func(*Q3DLight))(NewQ3DLightFromPointer(light))
 	}
 
@@ -2195,14 +2230,14 @@ func callbackQ3DScene_ActiveLightChanged(ptr unsafe.Pointer, light unsafe.Pointe
 func (ptr *Q3DScene) ConnectActiveLightChanged(f func(light *Q3DLight)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectActiveLightChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeLightChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeLightChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectActiveLightChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectActiveLightChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeLightChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "activeLightChanged")
 	}
 }
 
@@ -2214,7 +2249,7 @@ func (ptr *Q3DScene) ActiveLightChanged(light Q3DLight_ITF) {
 
 //export callbackQ3DScene_DevicePixelRatioChanged
 func callbackQ3DScene_DevicePixelRatioChanged(ptr unsafe.Pointer, pixelRatio C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "devicePixelRatioChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "devicePixelRatioChanged"); signal != nil {
 		signal.(func(float32))(float32(pixelRatio))
 	}
 
@@ -2223,14 +2258,14 @@ func callbackQ3DScene_DevicePixelRatioChanged(ptr unsafe.Pointer, pixelRatio C.f
 func (ptr *Q3DScene) ConnectDevicePixelRatioChanged(f func(pixelRatio float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectDevicePixelRatioChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "devicePixelRatioChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "devicePixelRatioChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectDevicePixelRatioChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectDevicePixelRatioChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "devicePixelRatioChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "devicePixelRatioChanged")
 	}
 }
 
@@ -2242,7 +2277,7 @@ func (ptr *Q3DScene) DevicePixelRatioChanged(pixelRatio float32) {
 
 //export callbackQ3DScene_GraphPositionQueryChanged
 func callbackQ3DScene_GraphPositionQueryChanged(ptr unsafe.Pointer, position unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "graphPositionQueryChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "graphPositionQueryChanged"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(position))
 	}
 
@@ -2251,14 +2286,14 @@ func callbackQ3DScene_GraphPositionQueryChanged(ptr unsafe.Pointer, position uns
 func (ptr *Q3DScene) ConnectGraphPositionQueryChanged(f func(position *core.QPoint)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectGraphPositionQueryChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "graphPositionQueryChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "graphPositionQueryChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectGraphPositionQueryChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectGraphPositionQueryChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "graphPositionQueryChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "graphPositionQueryChanged")
 	}
 }
 
@@ -2270,7 +2305,7 @@ func (ptr *Q3DScene) GraphPositionQueryChanged(position core.QPoint_ITF) {
 
 //export callbackQ3DScene_PrimarySubViewportChanged
 func callbackQ3DScene_PrimarySubViewportChanged(ptr unsafe.Pointer, subViewport unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "primarySubViewportChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "primarySubViewportChanged"); signal != nil {
 		signal.(func(*core.QRect))(core.NewQRectFromPointer(subViewport))
 	}
 
@@ -2279,14 +2314,14 @@ func callbackQ3DScene_PrimarySubViewportChanged(ptr unsafe.Pointer, subViewport
 func (ptr *Q3DScene) ConnectPrimarySubViewportChanged(f func(subViewport *core.QRect)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectPrimarySubViewportChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "primarySubViewportChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "primarySubViewportChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectPrimarySubViewportChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectPrimarySubViewportChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "primarySubViewportChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "primarySubViewportChanged")
 	}
 }
 
@@ -2298,7 +2333,7 @@ func (ptr *Q3DScene) PrimarySubViewportChanged(subViewport core.QRect_ITF) {
 
 //export callbackQ3DScene_SecondarySubViewportChanged
 func callbackQ3DScene_SecondarySubViewportChanged(ptr unsafe.Pointer, subViewport unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "secondarySubViewportChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "secondarySubViewportChanged"); signal != nil {
 		signal.(func(*core.QRect))(core.NewQRectFromPointer(subViewport))
 	}
 
@@ -2307,14 +2342,14 @@ func callbackQ3DScene_SecondarySubViewportChanged(ptr unsafe.Pointer, subViewpor
 func (ptr *Q3DScene) ConnectSecondarySubViewportChanged(f func(subViewport *core.QRect)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectSecondarySubViewportChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "secondarySubViewportChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "secondarySubViewportChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectSecondarySubViewportChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectSecondarySubViewportChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "secondarySubViewportChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "secondarySubViewportChanged")
 	}
 }
 
@@ -2326,7 +2361,7 @@ func (ptr *Q3DScene) SecondarySubViewportChanged(subViewport core.QRect_ITF) {
 
 //export callbackQ3DScene_SecondarySubviewOnTopChanged
 func callbackQ3DScene_SecondarySubviewOnTopChanged(ptr unsafe.Pointer, isSecondaryOnTop C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "secondarySubviewOnTopChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "secondarySubviewOnTopChanged"); signal != nil {
 		signal.(func(bool))(int8(isSecondaryOnTop) != 0)
 	}
 
@@ -2335,14 +2370,14 @@ func callbackQ3DScene_SecondarySubviewOnTopChanged(ptr unsafe.Pointer, isSeconda
 func (ptr *Q3DScene) ConnectSecondarySubviewOnTopChanged(f func(isSecondaryOnTop bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectSecondarySubviewOnTopChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "secondarySubviewOnTopChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "secondarySubviewOnTopChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectSecondarySubviewOnTopChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectSecondarySubviewOnTopChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "secondarySubviewOnTopChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "secondarySubviewOnTopChanged")
 	}
 }
 
@@ -2354,7 +2389,7 @@ func (ptr *Q3DScene) SecondarySubviewOnTopChanged(isSecondaryOnTop bool) {
 
 //export callbackQ3DScene_SelectionQueryPositionChanged
 func callbackQ3DScene_SelectionQueryPositionChanged(ptr unsafe.Pointer, position unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionQueryPositionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionQueryPositionChanged"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(position))
 	}
 
@@ -2363,14 +2398,14 @@ func callbackQ3DScene_SelectionQueryPositionChanged(ptr unsafe.Pointer, position
 func (ptr *Q3DScene) ConnectSelectionQueryPositionChanged(f func(position *core.QPoint)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectSelectionQueryPositionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectionQueryPositionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectionQueryPositionChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectSelectionQueryPositionChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectSelectionQueryPositionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectionQueryPositionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectionQueryPositionChanged")
 	}
 }
 
@@ -2436,7 +2471,7 @@ func (ptr *Q3DScene) SetSlicingActive(isSlicing bool) {
 
 //export callbackQ3DScene_SlicingActiveChanged
 func callbackQ3DScene_SlicingActiveChanged(ptr unsafe.Pointer, isSlicingActive C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "slicingActiveChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "slicingActiveChanged"); signal != nil {
 		signal.(func(bool))(int8(isSlicingActive) != 0)
 	}
 
@@ -2445,14 +2480,14 @@ func callbackQ3DScene_SlicingActiveChanged(ptr unsafe.Pointer, isSlicingActive C
 func (ptr *Q3DScene) ConnectSlicingActiveChanged(f func(isSlicingActive bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectSlicingActiveChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "slicingActiveChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "slicingActiveChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectSlicingActiveChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectSlicingActiveChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "slicingActiveChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "slicingActiveChanged")
 	}
 }
 
@@ -2464,7 +2499,7 @@ func (ptr *Q3DScene) SlicingActiveChanged(isSlicingActive bool) {
 
 //export callbackQ3DScene_ViewportChanged
 func callbackQ3DScene_ViewportChanged(ptr unsafe.Pointer, viewport unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "viewportChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "viewportChanged"); signal != nil {
 		signal.(func(*core.QRect))(core.NewQRectFromPointer(viewport))
 	}
 
@@ -2473,14 +2508,14 @@ func callbackQ3DScene_ViewportChanged(ptr unsafe.Pointer, viewport unsafe.Pointe
 func (ptr *Q3DScene) ConnectViewportChanged(f func(viewport *core.QRect)) {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_ConnectViewportChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "viewportChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "viewportChanged", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectViewportChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DisconnectViewportChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "viewportChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "viewportChanged")
 	}
 }
 
@@ -2492,7 +2527,7 @@ func (ptr *Q3DScene) ViewportChanged(viewport core.QRect_ITF) {
 
 //export callbackQ3DScene_DestroyQ3DScene
 func callbackQ3DScene_DestroyQ3DScene(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~Q3DScene"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~Q3DScene"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQ3DSceneFromPointer(ptr).DestroyQ3DSceneDefault()
@@ -2502,21 +2537,21 @@ func callbackQ3DScene_DestroyQ3DScene(ptr unsafe.Pointer) {
 func (ptr *Q3DScene) ConnectDestroyQ3DScene(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DScene", f)
+		qt.ConnectSignal(ptr.Pointer(), "~Q3DScene", f)
 	}
 }
 
 func (ptr *Q3DScene) DisconnectDestroyQ3DScene() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DScene")
+		qt.DisconnectSignal(ptr.Pointer(), "~Q3DScene")
 	}
 }
 
 func (ptr *Q3DScene) DestroyQ3DScene() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DestroyQ3DScene(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2524,7 +2559,7 @@ func (ptr *Q3DScene) DestroyQ3DScene() {
 func (ptr *Q3DScene) DestroyQ3DSceneDefault() {
 	if ptr.Pointer() != nil {
 		C.Q3DScene_DestroyQ3DSceneDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2664,7 +2699,7 @@ func (ptr *Q3DSurface) AddSeries(series QSurface3DSeries_ITF) {
 
 //export callbackQ3DSurface_AxisXChanged
 func callbackQ3DSurface_AxisXChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisXChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisXChanged"); signal != nil {
 		signal.(func(*QValue3DAxis))(NewQValue3DAxisFromPointer(axis))
 	}
 
@@ -2673,14 +2708,14 @@ func callbackQ3DSurface_AxisXChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
 func (ptr *Q3DSurface) ConnectAxisXChanged(f func(axis *QValue3DAxis)) {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_ConnectAxisXChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisXChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisXChanged", f)
 	}
 }
 
 func (ptr *Q3DSurface) DisconnectAxisXChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_DisconnectAxisXChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisXChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisXChanged")
 	}
 }
 
@@ -2692,7 +2727,7 @@ func (ptr *Q3DSurface) AxisXChanged(axis QValue3DAxis_ITF) {
 
 //export callbackQ3DSurface_AxisYChanged
 func callbackQ3DSurface_AxisYChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisYChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisYChanged"); signal != nil {
 		signal.(func(*QValue3DAxis))(NewQValue3DAxisFromPointer(axis))
 	}
 
@@ -2701,14 +2736,14 @@ func callbackQ3DSurface_AxisYChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
 func (ptr *Q3DSurface) ConnectAxisYChanged(f func(axis *QValue3DAxis)) {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_ConnectAxisYChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisYChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisYChanged", f)
 	}
 }
 
 func (ptr *Q3DSurface) DisconnectAxisYChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_DisconnectAxisYChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisYChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisYChanged")
 	}
 }
 
@@ -2720,7 +2755,7 @@ func (ptr *Q3DSurface) AxisYChanged(axis QValue3DAxis_ITF) {
 
 //export callbackQ3DSurface_AxisZChanged
 func callbackQ3DSurface_AxisZChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisZChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisZChanged"); signal != nil {
 		signal.(func(*QValue3DAxis))(NewQValue3DAxisFromPointer(axis))
 	}
 
@@ -2729,14 +2764,14 @@ func callbackQ3DSurface_AxisZChanged(ptr unsafe.Pointer, axis unsafe.Pointer) {
 func (ptr *Q3DSurface) ConnectAxisZChanged(f func(axis *QValue3DAxis)) {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_ConnectAxisZChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisZChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisZChanged", f)
 	}
 }
 
 func (ptr *Q3DSurface) DisconnectAxisZChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_DisconnectAxisZChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisZChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisZChanged")
 	}
 }
 
@@ -2748,7 +2783,7 @@ func (ptr *Q3DSurface) AxisZChanged(axis QValue3DAxis_ITF) {
 
 //export callbackQ3DSurface_FlipHorizontalGridChanged
 func callbackQ3DSurface_FlipHorizontalGridChanged(ptr unsafe.Pointer, flip C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flipHorizontalGridChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flipHorizontalGridChanged"); signal != nil {
 		signal.(func(bool))(int8(flip) != 0)
 	}
 
@@ -2757,14 +2792,14 @@ func callbackQ3DSurface_FlipHorizontalGridChanged(ptr unsafe.Pointer, flip C.cha
 func (ptr *Q3DSurface) ConnectFlipHorizontalGridChanged(f func(flip bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_ConnectFlipHorizontalGridChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "flipHorizontalGridChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "flipHorizontalGridChanged", f)
 	}
 }
 
 func (ptr *Q3DSurface) DisconnectFlipHorizontalGridChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_DisconnectFlipHorizontalGridChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "flipHorizontalGridChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "flipHorizontalGridChanged")
 	}
 }
 
@@ -2788,7 +2823,7 @@ func (ptr *Q3DSurface) RemoveSeries(series QSurface3DSeries_ITF) {
 
 //export callbackQ3DSurface_SelectedSeriesChanged
 func callbackQ3DSurface_SelectedSeriesChanged(ptr unsafe.Pointer, series unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedSeriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedSeriesChanged"); signal != nil {
 		signal.(func(*QSurface3DSeries))(NewQSurface3DSeriesFromPointer(series))
 	}
 
@@ -2797,14 +2832,14 @@ func callbackQ3DSurface_SelectedSeriesChanged(ptr unsafe.Pointer, series unsafe.
 func (ptr *Q3DSurface) ConnectSelectedSeriesChanged(f func(series *QSurface3DSeries)) {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_ConnectSelectedSeriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedSeriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedSeriesChanged", f)
 	}
 }
 
 func (ptr *Q3DSurface) DisconnectSelectedSeriesChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_DisconnectSelectedSeriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedSeriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedSeriesChanged")
 	}
 }
 
@@ -2840,7 +2875,7 @@ func (ptr *Q3DSurface) SetFlipHorizontalGrid(flip bool) {
 
 //export callbackQ3DSurface_DestroyQ3DSurface
 func callbackQ3DSurface_DestroyQ3DSurface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~Q3DSurface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~Q3DSurface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQ3DSurfaceFromPointer(ptr).DestroyQ3DSurfaceDefault()
@@ -2850,21 +2885,21 @@ func callbackQ3DSurface_DestroyQ3DSurface(ptr unsafe.Pointer) {
 func (ptr *Q3DSurface) ConnectDestroyQ3DSurface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DSurface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~Q3DSurface", f)
 	}
 }
 
 func (ptr *Q3DSurface) DisconnectDestroyQ3DSurface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DSurface")
+		qt.DisconnectSignal(ptr.Pointer(), "~Q3DSurface")
 	}
 }
 
 func (ptr *Q3DSurface) DestroyQ3DSurface() {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_DestroyQ3DSurface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2872,7 +2907,7 @@ func (ptr *Q3DSurface) DestroyQ3DSurface() {
 func (ptr *Q3DSurface) DestroyQ3DSurfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.Q3DSurface_DestroyQ3DSurfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3046,7 +3081,7 @@ func NewQ3DTheme2(themeType Q3DTheme__Theme, parent core.QObject_ITF) *Q3DTheme
 
 //export callbackQ3DTheme_AmbientLightStrengthChanged
 func callbackQ3DTheme_AmbientLightStrengthChanged(ptr unsafe.Pointer, strength C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "ambientLightStrengthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "ambientLightStrengthChanged"); signal != nil {
 		signal.(func(float32))(float32(strength))
 	}
 
@@ -3055,14 +3090,14 @@ func callbackQ3DTheme_AmbientLightStrengthChanged(ptr unsafe.Pointer, strength C
 func (ptr *Q3DTheme) ConnectAmbientLightStrengthChanged(f func(strength float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectAmbientLightStrengthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "ambientLightStrengthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "ambientLightStrengthChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectAmbientLightStrengthChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectAmbientLightStrengthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "ambientLightStrengthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "ambientLightStrengthChanged")
 	}
 }
 
@@ -3074,7 +3109,7 @@ func (ptr *Q3DTheme) AmbientLightStrengthChanged(strength float32) {
 
 //export callbackQ3DTheme_BackgroundColorChanged
 func callbackQ3DTheme_BackgroundColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "backgroundColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "backgroundColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3083,14 +3118,14 @@ func callbackQ3DTheme_BackgroundColorChanged(ptr unsafe.Pointer, color unsafe.Po
 func (ptr *Q3DTheme) ConnectBackgroundColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectBackgroundColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "backgroundColorChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectBackgroundColorChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectBackgroundColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "backgroundColorChanged")
 	}
 }
 
@@ -3102,7 +3137,7 @@ func (ptr *Q3DTheme) BackgroundColorChanged(color gui.QColor_ITF) {
 
 //export callbackQ3DTheme_BackgroundEnabledChanged
 func callbackQ3DTheme_BackgroundEnabledChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "backgroundEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "backgroundEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -3111,14 +3146,14 @@ func callbackQ3DTheme_BackgroundEnabledChanged(ptr unsafe.Pointer, enabled C.cha
 func (ptr *Q3DTheme) ConnectBackgroundEnabledChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectBackgroundEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "backgroundEnabledChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectBackgroundEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectBackgroundEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "backgroundEnabledChanged")
 	}
 }
 
@@ -3130,7 +3165,7 @@ func (ptr *Q3DTheme) BackgroundEnabledChanged(enabled bool) {
 
 //export callbackQ3DTheme_BaseColorsChanged
 func callbackQ3DTheme_BaseColorsChanged(ptr unsafe.Pointer, colors C.struct_QtDataVisualization_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "baseColorsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "baseColorsChanged"); signal != nil {
 		signal.(func([]*gui.QColor))(func(l C.struct_QtDataVisualization_PackedList) []*gui.QColor {
 			var out = make([]*gui.QColor, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -3145,14 +3180,14 @@ func callbackQ3DTheme_BaseColorsChanged(ptr unsafe.Pointer, colors C.struct_QtDa
 func (ptr *Q3DTheme) ConnectBaseColorsChanged(f func(colors []*gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectBaseColorsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "baseColorsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "baseColorsChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectBaseColorsChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectBaseColorsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "baseColorsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "baseColorsChanged")
 	}
 }
 
@@ -3170,7 +3205,7 @@ func (ptr *Q3DTheme) BaseColorsChanged(colors []*gui.QColor) {
 
 //export callbackQ3DTheme_BaseGradientsChanged
 func callbackQ3DTheme_BaseGradientsChanged(ptr unsafe.Pointer, gradients C.struct_QtDataVisualization_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "baseGradientsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "baseGradientsChanged"); signal != nil {
 		signal.(func([]*gui.QLinearGradient))(func(l C.struct_QtDataVisualization_PackedList) []*gui.QLinearGradient {
 			var out = make([]*gui.QLinearGradient, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -3185,14 +3220,14 @@ func callbackQ3DTheme_BaseGradientsChanged(ptr unsafe.Pointer, gradients C.struc
 func (ptr *Q3DTheme) ConnectBaseGradientsChanged(f func(gradients []*gui.QLinearGradient)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectBaseGradientsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "baseGradientsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "baseGradientsChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectBaseGradientsChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectBaseGradientsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "baseGradientsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "baseGradientsChanged")
 	}
 }
 
@@ -3210,7 +3245,7 @@ func (ptr *Q3DTheme) BaseGradientsChanged(gradients []*gui.QLinearGradient) {
 
 //export callbackQ3DTheme_ColorStyleChanged
 func callbackQ3DTheme_ColorStyleChanged(ptr unsafe.Pointer, style C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorStyleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorStyleChanged"); signal != nil {
 		signal.(func(Q3DTheme__ColorStyle))(Q3DTheme__ColorStyle(style))
 	}
 
@@ -3219,14 +3254,14 @@ func callbackQ3DTheme_ColorStyleChanged(ptr unsafe.Pointer, style C.longlong) {
 func (ptr *Q3DTheme) ConnectColorStyleChanged(f func(style Q3DTheme__ColorStyle)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectColorStyleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorStyleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorStyleChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectColorStyleChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectColorStyleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorStyleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorStyleChanged")
 	}
 }
 
@@ -3238,7 +3273,7 @@ func (ptr *Q3DTheme) ColorStyleChanged(style Q3DTheme__ColorStyle) {
 
 //export callbackQ3DTheme_FontChanged
 func callbackQ3DTheme_FontChanged(ptr unsafe.Pointer, font unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fontChanged"); signal != nil {
 		signal.(func(*gui.QFont))(gui.NewQFontFromPointer(font))
 	}
 
@@ -3247,14 +3282,14 @@ func callbackQ3DTheme_FontChanged(ptr unsafe.Pointer, font unsafe.Pointer) {
 func (ptr *Q3DTheme) ConnectFontChanged(f func(font *gui.QFont)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "fontChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectFontChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "fontChanged")
 	}
 }
 
@@ -3266,7 +3301,7 @@ func (ptr *Q3DTheme) FontChanged(font gui.QFont_ITF) {
 
 //export callbackQ3DTheme_GridEnabledChanged
 func callbackQ3DTheme_GridEnabledChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "gridEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "gridEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -3275,14 +3310,14 @@ func callbackQ3DTheme_GridEnabledChanged(ptr unsafe.Pointer, enabled C.char) {
 func (ptr *Q3DTheme) ConnectGridEnabledChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectGridEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "gridEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "gridEnabledChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectGridEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectGridEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "gridEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "gridEnabledChanged")
 	}
 }
 
@@ -3294,7 +3329,7 @@ func (ptr *Q3DTheme) GridEnabledChanged(enabled bool) {
 
 //export callbackQ3DTheme_GridLineColorChanged
 func callbackQ3DTheme_GridLineColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "gridLineColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "gridLineColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3303,14 +3338,14 @@ func callbackQ3DTheme_GridLineColorChanged(ptr unsafe.Pointer, color unsafe.Poin
 func (ptr *Q3DTheme) ConnectGridLineColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectGridLineColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "gridLineColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "gridLineColorChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectGridLineColorChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectGridLineColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "gridLineColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "gridLineColorChanged")
 	}
 }
 
@@ -3322,7 +3357,7 @@ func (ptr *Q3DTheme) GridLineColorChanged(color gui.QColor_ITF) {
 
 //export callbackQ3DTheme_HighlightLightStrengthChanged
 func callbackQ3DTheme_HighlightLightStrengthChanged(ptr unsafe.Pointer, strength C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "highlightLightStrengthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "highlightLightStrengthChanged"); signal != nil {
 		signal.(func(float32))(float32(strength))
 	}
 
@@ -3331,14 +3366,14 @@ func callbackQ3DTheme_HighlightLightStrengthChanged(ptr unsafe.Pointer, strength
 func (ptr *Q3DTheme) ConnectHighlightLightStrengthChanged(f func(strength float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectHighlightLightStrengthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "highlightLightStrengthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "highlightLightStrengthChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectHighlightLightStrengthChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectHighlightLightStrengthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "highlightLightStrengthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "highlightLightStrengthChanged")
 	}
 }
 
@@ -3350,7 +3385,7 @@ func (ptr *Q3DTheme) HighlightLightStrengthChanged(strength float32) {
 
 //export callbackQ3DTheme_LabelBackgroundColorChanged
 func callbackQ3DTheme_LabelBackgroundColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelBackgroundColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelBackgroundColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3359,14 +3394,14 @@ func callbackQ3DTheme_LabelBackgroundColorChanged(ptr unsafe.Pointer, color unsa
 func (ptr *Q3DTheme) ConnectLabelBackgroundColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectLabelBackgroundColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelBackgroundColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelBackgroundColorChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectLabelBackgroundColorChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectLabelBackgroundColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelBackgroundColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelBackgroundColorChanged")
 	}
 }
 
@@ -3378,7 +3413,7 @@ func (ptr *Q3DTheme) LabelBackgroundColorChanged(color gui.QColor_ITF) {
 
 //export callbackQ3DTheme_LabelBackgroundEnabledChanged
 func callbackQ3DTheme_LabelBackgroundEnabledChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelBackgroundEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelBackgroundEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -3387,14 +3422,14 @@ func callbackQ3DTheme_LabelBackgroundEnabledChanged(ptr unsafe.Pointer, enabled
 func (ptr *Q3DTheme) ConnectLabelBackgroundEnabledChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectLabelBackgroundEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelBackgroundEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelBackgroundEnabledChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectLabelBackgroundEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectLabelBackgroundEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelBackgroundEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelBackgroundEnabledChanged")
 	}
 }
 
@@ -3406,7 +3441,7 @@ func (ptr *Q3DTheme) LabelBackgroundEnabledChanged(enabled bool) {
 
 //export callbackQ3DTheme_LabelBorderEnabledChanged
 func callbackQ3DTheme_LabelBorderEnabledChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelBorderEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelBorderEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -3415,14 +3450,14 @@ func callbackQ3DTheme_LabelBorderEnabledChanged(ptr unsafe.Pointer, enabled C.ch
 func (ptr *Q3DTheme) ConnectLabelBorderEnabledChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectLabelBorderEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelBorderEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelBorderEnabledChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectLabelBorderEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectLabelBorderEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelBorderEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelBorderEnabledChanged")
 	}
 }
 
@@ -3434,7 +3469,7 @@ func (ptr *Q3DTheme) LabelBorderEnabledChanged(enabled bool) {
 
 //export callbackQ3DTheme_LabelTextColorChanged
 func callbackQ3DTheme_LabelTextColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelTextColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelTextColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3443,14 +3478,14 @@ func callbackQ3DTheme_LabelTextColorChanged(ptr unsafe.Pointer, color unsafe.Poi
 func (ptr *Q3DTheme) ConnectLabelTextColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectLabelTextColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelTextColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelTextColorChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectLabelTextColorChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectLabelTextColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelTextColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelTextColorChanged")
 	}
 }
 
@@ -3462,7 +3497,7 @@ func (ptr *Q3DTheme) LabelTextColorChanged(color gui.QColor_ITF) {
 
 //export callbackQ3DTheme_LightColorChanged
 func callbackQ3DTheme_LightColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lightColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lightColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3471,14 +3506,14 @@ func callbackQ3DTheme_LightColorChanged(ptr unsafe.Pointer, color unsafe.Pointer
 func (ptr *Q3DTheme) ConnectLightColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectLightColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lightColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lightColorChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectLightColorChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectLightColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lightColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lightColorChanged")
 	}
 }
 
@@ -3490,7 +3525,7 @@ func (ptr *Q3DTheme) LightColorChanged(color gui.QColor_ITF) {
 
 //export callbackQ3DTheme_LightStrengthChanged
 func callbackQ3DTheme_LightStrengthChanged(ptr unsafe.Pointer, strength C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lightStrengthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lightStrengthChanged"); signal != nil {
 		signal.(func(float32))(float32(strength))
 	}
 
@@ -3499,14 +3534,14 @@ func callbackQ3DTheme_LightStrengthChanged(ptr unsafe.Pointer, strength C.float)
 func (ptr *Q3DTheme) ConnectLightStrengthChanged(f func(strength float32)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectLightStrengthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lightStrengthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "lightStrengthChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectLightStrengthChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectLightStrengthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lightStrengthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "lightStrengthChanged")
 	}
 }
 
@@ -3518,7 +3553,7 @@ func (ptr *Q3DTheme) LightStrengthChanged(strength float32) {
 
 //export callbackQ3DTheme_MultiHighlightColorChanged
 func callbackQ3DTheme_MultiHighlightColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "multiHighlightColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "multiHighlightColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3527,14 +3562,14 @@ func callbackQ3DTheme_MultiHighlightColorChanged(ptr unsafe.Pointer, color unsaf
 func (ptr *Q3DTheme) ConnectMultiHighlightColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectMultiHighlightColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "multiHighlightColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "multiHighlightColorChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectMultiHighlightColorChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectMultiHighlightColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "multiHighlightColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "multiHighlightColorChanged")
 	}
 }
 
@@ -3546,7 +3581,7 @@ func (ptr *Q3DTheme) MultiHighlightColorChanged(color gui.QColor_ITF) {
 
 //export callbackQ3DTheme_MultiHighlightGradientChanged
 func callbackQ3DTheme_MultiHighlightGradientChanged(ptr unsafe.Pointer, gradient unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "multiHighlightGradientChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "multiHighlightGradientChanged"); signal != nil {
 		signal.(func(*gui.QLinearGradient))(gui.NewQLinearGradientFromPointer(gradient))
 	}
 
@@ -3555,14 +3590,14 @@ func callbackQ3DTheme_MultiHighlightGradientChanged(ptr unsafe.Pointer, gradient
 func (ptr *Q3DTheme) ConnectMultiHighlightGradientChanged(f func(gradient *gui.QLinearGradient)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectMultiHighlightGradientChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "multiHighlightGradientChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "multiHighlightGradientChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectMultiHighlightGradientChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectMultiHighlightGradientChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "multiHighlightGradientChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "multiHighlightGradientChanged")
 	}
 }
 
@@ -3718,7 +3753,7 @@ func (ptr *Q3DTheme) SetWindowColor(color gui.QColor_ITF) {
 
 //export callbackQ3DTheme_SingleHighlightColorChanged
 func callbackQ3DTheme_SingleHighlightColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "singleHighlightColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "singleHighlightColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3727,14 +3762,14 @@ func callbackQ3DTheme_SingleHighlightColorChanged(ptr unsafe.Pointer, color unsa
 func (ptr *Q3DTheme) ConnectSingleHighlightColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectSingleHighlightColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "singleHighlightColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "singleHighlightColorChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectSingleHighlightColorChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectSingleHighlightColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "singleHighlightColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "singleHighlightColorChanged")
 	}
 }
 
@@ -3746,7 +3781,7 @@ func (ptr *Q3DTheme) SingleHighlightColorChanged(color gui.QColor_ITF) {
 
 //export callbackQ3DTheme_SingleHighlightGradientChanged
 func callbackQ3DTheme_SingleHighlightGradientChanged(ptr unsafe.Pointer, gradient unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "singleHighlightGradientChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "singleHighlightGradientChanged"); signal != nil {
 		signal.(func(*gui.QLinearGradient))(gui.NewQLinearGradientFromPointer(gradient))
 	}
 
@@ -3755,14 +3790,14 @@ func callbackQ3DTheme_SingleHighlightGradientChanged(ptr unsafe.Pointer, gradien
 func (ptr *Q3DTheme) ConnectSingleHighlightGradientChanged(f func(gradient *gui.QLinearGradient)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectSingleHighlightGradientChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "singleHighlightGradientChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "singleHighlightGradientChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectSingleHighlightGradientChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectSingleHighlightGradientChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "singleHighlightGradientChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "singleHighlightGradientChanged")
 	}
 }
 
@@ -3774,7 +3809,7 @@ func (ptr *Q3DTheme) SingleHighlightGradientChanged(gradient gui.QLinearGradient
 
 //export callbackQ3DTheme_TypeChanged
 func callbackQ3DTheme_TypeChanged(ptr unsafe.Pointer, themeType C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "typeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "typeChanged"); signal != nil {
 		signal.(func(Q3DTheme__Theme))(Q3DTheme__Theme(themeType))
 	}
 
@@ -3783,14 +3818,14 @@ func callbackQ3DTheme_TypeChanged(ptr unsafe.Pointer, themeType C.longlong) {
 func (ptr *Q3DTheme) ConnectTypeChanged(f func(themeType Q3DTheme__Theme)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectTypeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "typeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "typeChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectTypeChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectTypeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "typeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "typeChanged")
 	}
 }
 
@@ -3802,7 +3837,7 @@ func (ptr *Q3DTheme) TypeChanged(themeType Q3DTheme__Theme) {
 
 //export callbackQ3DTheme_WindowColorChanged
 func callbackQ3DTheme_WindowColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -3811,14 +3846,14 @@ func callbackQ3DTheme_WindowColorChanged(ptr unsafe.Pointer, color unsafe.Pointe
 func (ptr *Q3DTheme) ConnectWindowColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_ConnectWindowColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "windowColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "windowColorChanged", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectWindowColorChanged() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DisconnectWindowColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "windowColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "windowColorChanged")
 	}
 }
 
@@ -3830,7 +3865,7 @@ func (ptr *Q3DTheme) WindowColorChanged(color gui.QColor_ITF) {
 
 //export callbackQ3DTheme_DestroyQ3DTheme
 func callbackQ3DTheme_DestroyQ3DTheme(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~Q3DTheme"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~Q3DTheme"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQ3DThemeFromPointer(ptr).DestroyQ3DThemeDefault()
@@ -3840,21 +3875,21 @@ func callbackQ3DTheme_DestroyQ3DTheme(ptr unsafe.Pointer) {
 func (ptr *Q3DTheme) ConnectDestroyQ3DTheme(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DTheme", f)
+		qt.ConnectSignal(ptr.Pointer(), "~Q3DTheme", f)
 	}
 }
 
 func (ptr *Q3DTheme) DisconnectDestroyQ3DTheme() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~Q3DTheme")
+		qt.DisconnectSignal(ptr.Pointer(), "~Q3DTheme")
 	}
 }
 
 func (ptr *Q3DTheme) DestroyQ3DTheme() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DestroyQ3DTheme(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3862,7 +3897,7 @@ func (ptr *Q3DTheme) DestroyQ3DTheme() {
 func (ptr *Q3DTheme) DestroyQ3DThemeDefault() {
 	if ptr.Pointer() != nil {
 		C.Q3DTheme_DestroyQ3DThemeDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4230,7 +4265,7 @@ const (
 
 //export callbackQAbstract3DAxis_RangeChanged
 func callbackQAbstract3DAxis_RangeChanged(ptr unsafe.Pointer, min C.float, max C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rangeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rangeChanged"); signal != nil {
 		signal.(func(float32, float32))(float32(min), float32(max))
 	}
 
@@ -4239,14 +4274,14 @@ func callbackQAbstract3DAxis_RangeChanged(ptr unsafe.Pointer, min C.float, max C
 func (ptr *QAbstract3DAxis) ConnectRangeChanged(f func(min float32, max float32)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectRangeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rangeChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectRangeChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectRangeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rangeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rangeChanged")
 	}
 }
 
@@ -4264,7 +4299,7 @@ func (ptr *QAbstract3DAxis) SetTitleFixed(fixed bool) {
 
 //export callbackQAbstract3DAxis_AutoAdjustRangeChanged
 func callbackQAbstract3DAxis_AutoAdjustRangeChanged(ptr unsafe.Pointer, autoAdjust C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "autoAdjustRangeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "autoAdjustRangeChanged"); signal != nil {
 		signal.(func(bool))(int8(autoAdjust) != 0)
 	}
 
@@ -4273,14 +4308,14 @@ func callbackQAbstract3DAxis_AutoAdjustRangeChanged(ptr unsafe.Pointer, autoAdju
 func (ptr *QAbstract3DAxis) ConnectAutoAdjustRangeChanged(f func(autoAdjust bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectAutoAdjustRangeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "autoAdjustRangeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "autoAdjustRangeChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectAutoAdjustRangeChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectAutoAdjustRangeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "autoAdjustRangeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "autoAdjustRangeChanged")
 	}
 }
 
@@ -4292,7 +4327,7 @@ func (ptr *QAbstract3DAxis) AutoAdjustRangeChanged(autoAdjust bool) {
 
 //export callbackQAbstract3DAxis_LabelAutoRotationChanged
 func callbackQAbstract3DAxis_LabelAutoRotationChanged(ptr unsafe.Pointer, angle C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelAutoRotationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelAutoRotationChanged"); signal != nil {
 		signal.(func(float32))(float32(angle))
 	}
 
@@ -4301,14 +4336,14 @@ func callbackQAbstract3DAxis_LabelAutoRotationChanged(ptr unsafe.Pointer, angle
 func (ptr *QAbstract3DAxis) ConnectLabelAutoRotationChanged(f func(angle float32)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectLabelAutoRotationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelAutoRotationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelAutoRotationChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectLabelAutoRotationChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectLabelAutoRotationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelAutoRotationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelAutoRotationChanged")
 	}
 }
 
@@ -4320,7 +4355,7 @@ func (ptr *QAbstract3DAxis) LabelAutoRotationChanged(angle float32) {
 
 //export callbackQAbstract3DAxis_LabelsChanged
 func callbackQAbstract3DAxis_LabelsChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4329,14 +4364,14 @@ func callbackQAbstract3DAxis_LabelsChanged(ptr unsafe.Pointer) {
 func (ptr *QAbstract3DAxis) ConnectLabelsChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectLabelsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectLabelsChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectLabelsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsChanged")
 	}
 }
 
@@ -4348,7 +4383,7 @@ func (ptr *QAbstract3DAxis) LabelsChanged() {
 
 //export callbackQAbstract3DAxis_MaxChanged
 func callbackQAbstract3DAxis_MaxChanged(ptr unsafe.Pointer, value C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maxChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maxChanged"); signal != nil {
 		signal.(func(float32))(float32(value))
 	}
 
@@ -4357,14 +4392,14 @@ func callbackQAbstract3DAxis_MaxChanged(ptr unsafe.Pointer, value C.float) {
 func (ptr *QAbstract3DAxis) ConnectMaxChanged(f func(value float32)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectMaxChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maxChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectMaxChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectMaxChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maxChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maxChanged")
 	}
 }
 
@@ -4376,7 +4411,7 @@ func (ptr *QAbstract3DAxis) MaxChanged(value float32) {
 
 //export callbackQAbstract3DAxis_MinChanged
 func callbackQAbstract3DAxis_MinChanged(ptr unsafe.Pointer, value C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minChanged"); signal != nil {
 		signal.(func(float32))(float32(value))
 	}
 
@@ -4385,14 +4420,14 @@ func callbackQAbstract3DAxis_MinChanged(ptr unsafe.Pointer, value C.float) {
 func (ptr *QAbstract3DAxis) ConnectMinChanged(f func(value float32)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectMinChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectMinChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectMinChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minChanged")
 	}
 }
 
@@ -4404,7 +4439,7 @@ func (ptr *QAbstract3DAxis) MinChanged(value float32) {
 
 //export callbackQAbstract3DAxis_OrientationChanged
 func callbackQAbstract3DAxis_OrientationChanged(ptr unsafe.Pointer, orientation C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "orientationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "orientationChanged"); signal != nil {
 		signal.(func(QAbstract3DAxis__AxisOrientation))(QAbstract3DAxis__AxisOrientation(orientation))
 	}
 
@@ -4413,14 +4448,14 @@ func callbackQAbstract3DAxis_OrientationChanged(ptr unsafe.Pointer, orientation
 func (ptr *QAbstract3DAxis) ConnectOrientationChanged(f func(orientation QAbstract3DAxis__AxisOrientation)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectOrientationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "orientationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "orientationChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectOrientationChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectOrientationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "orientationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "orientationChanged")
 	}
 }
 
@@ -4444,7 +4479,7 @@ func (ptr *QAbstract3DAxis) SetLabelAutoRotation(angle float32) {
 
 func (ptr *QAbstract3DAxis) SetLabels(labels []string) {
 	if ptr.Pointer() != nil {
-		var labelsC = C.CString(strings.Join(labels, "|"))
+		var labelsC = cGoPackStringList(labels)
 		defer C.free(unsafe.Pointer(labelsC))
 		C.QAbstract3DAxis_SetLabels(ptr.Pointer(), labelsC)
 	}
@@ -4484,7 +4519,7 @@ func (ptr *QAbstract3DAxis) SetTitleVisible(visible bool) {
 
 //export callbackQAbstract3DAxis_TitleChanged
 func callbackQAbstract3DAxis_TitleChanged(ptr unsafe.Pointer, newTitle C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "titleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "titleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(newTitle))
 	}
 
@@ -4493,14 +4528,14 @@ func callbackQAbstract3DAxis_TitleChanged(ptr unsafe.Pointer, newTitle C.struct_
 func (ptr *QAbstract3DAxis) ConnectTitleChanged(f func(newTitle string)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectTitleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "titleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "titleChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectTitleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectTitleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "titleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "titleChanged")
 	}
 }
 
@@ -4514,7 +4549,7 @@ func (ptr *QAbstract3DAxis) TitleChanged(newTitle string) {
 
 //export callbackQAbstract3DAxis_TitleFixedChanged
 func callbackQAbstract3DAxis_TitleFixedChanged(ptr unsafe.Pointer, fixed C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "titleFixedChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "titleFixedChanged"); signal != nil {
 		signal.(func(bool))(int8(fixed) != 0)
 	}
 
@@ -4523,14 +4558,14 @@ func callbackQAbstract3DAxis_TitleFixedChanged(ptr unsafe.Pointer, fixed C.char)
 func (ptr *QAbstract3DAxis) ConnectTitleFixedChanged(f func(fixed bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectTitleFixedChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "titleFixedChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "titleFixedChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectTitleFixedChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectTitleFixedChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "titleFixedChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "titleFixedChanged")
 	}
 }
 
@@ -4542,7 +4577,7 @@ func (ptr *QAbstract3DAxis) TitleFixedChanged(fixed bool) {
 
 //export callbackQAbstract3DAxis_TitleVisibilityChanged
 func callbackQAbstract3DAxis_TitleVisibilityChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "titleVisibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "titleVisibilityChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -4551,14 +4586,14 @@ func callbackQAbstract3DAxis_TitleVisibilityChanged(ptr unsafe.Pointer, visible
 func (ptr *QAbstract3DAxis) ConnectTitleVisibilityChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_ConnectTitleVisibilityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "titleVisibilityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "titleVisibilityChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectTitleVisibilityChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DisconnectTitleVisibilityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "titleVisibilityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "titleVisibilityChanged")
 	}
 }
 
@@ -4570,7 +4605,7 @@ func (ptr *QAbstract3DAxis) TitleVisibilityChanged(visible bool) {
 
 //export callbackQAbstract3DAxis_DestroyQAbstract3DAxis
 func callbackQAbstract3DAxis_DestroyQAbstract3DAxis(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstract3DAxis"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstract3DAxis"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstract3DAxisFromPointer(ptr).DestroyQAbstract3DAxisDefault()
@@ -4580,21 +4615,21 @@ func callbackQAbstract3DAxis_DestroyQAbstract3DAxis(ptr unsafe.Pointer) {
 func (ptr *QAbstract3DAxis) ConnectDestroyQAbstract3DAxis(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstract3DAxis", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstract3DAxis", f)
 	}
 }
 
 func (ptr *QAbstract3DAxis) DisconnectDestroyQAbstract3DAxis() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstract3DAxis")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstract3DAxis")
 	}
 }
 
 func (ptr *QAbstract3DAxis) DestroyQAbstract3DAxis() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DestroyQAbstract3DAxis(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4602,7 +4637,7 @@ func (ptr *QAbstract3DAxis) DestroyQAbstract3DAxis() {
 func (ptr *QAbstract3DAxis) DestroyQAbstract3DAxisDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DAxis_DestroyQAbstract3DAxisDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4630,7 +4665,7 @@ func (ptr *QAbstract3DAxis) Title() string {
 
 func (ptr *QAbstract3DAxis) Labels() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QAbstract3DAxis_Labels(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QAbstract3DAxis_Labels(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -4786,7 +4821,7 @@ func (ptr *QAbstract3DGraph) AddCustomItem(item QCustom3DItem_ITF) int {
 
 //export callbackQAbstract3DGraph_ActiveInputHandlerChanged
 func callbackQAbstract3DGraph_ActiveInputHandlerChanged(ptr unsafe.Pointer, inputHandler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeInputHandlerChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeInputHandlerChanged"); signal != nil {
 		signal.(func(*QAbstract3DInputHandler))(NewQAbstract3DInputHandlerFromPointer(inputHandler))
 	}
 
@@ -4795,14 +4830,14 @@ func callbackQAbstract3DGraph_ActiveInputHandlerChanged(ptr unsafe.Pointer, inpu
 func (ptr *QAbstract3DGraph) ConnectActiveInputHandlerChanged(f func(inputHandler *QAbstract3DInputHandler)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectActiveInputHandlerChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeInputHandlerChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeInputHandlerChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectActiveInputHandlerChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectActiveInputHandlerChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeInputHandlerChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "activeInputHandlerChanged")
 	}
 }
 
@@ -4814,7 +4849,7 @@ func (ptr *QAbstract3DGraph) ActiveInputHandlerChanged(inputHandler QAbstract3DI
 
 //export callbackQAbstract3DGraph_ActiveThemeChanged
 func callbackQAbstract3DGraph_ActiveThemeChanged(ptr unsafe.Pointer, theme unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeThemeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeThemeChanged"); signal != nil {
 		signal.(func(*Q3DTheme))(NewQ3DThemeFromPointer(theme))
 	}
 
@@ -4823,14 +4858,14 @@ func callbackQAbstract3DGraph_ActiveThemeChanged(ptr unsafe.Pointer, theme unsaf
 func (ptr *QAbstract3DGraph) ConnectActiveThemeChanged(f func(theme *Q3DTheme)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectActiveThemeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeThemeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeThemeChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectActiveThemeChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectActiveThemeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeThemeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "activeThemeChanged")
 	}
 }
 
@@ -4854,7 +4889,7 @@ func (ptr *QAbstract3DGraph) AddTheme(theme Q3DTheme_ITF) {
 
 //export callbackQAbstract3DGraph_AspectRatioChanged
 func callbackQAbstract3DGraph_AspectRatioChanged(ptr unsafe.Pointer, ratio C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aspectRatioChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aspectRatioChanged"); signal != nil {
 		signal.(func(float64))(float64(ratio))
 	}
 
@@ -4863,14 +4898,14 @@ func callbackQAbstract3DGraph_AspectRatioChanged(ptr unsafe.Pointer, ratio C.dou
 func (ptr *QAbstract3DGraph) ConnectAspectRatioChanged(f func(ratio float64)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectAspectRatioChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "aspectRatioChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "aspectRatioChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectAspectRatioChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectAspectRatioChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "aspectRatioChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "aspectRatioChanged")
 	}
 }
 
@@ -4888,7 +4923,7 @@ func (ptr *QAbstract3DGraph) ClearSelection() {
 
 //export callbackQAbstract3DGraph_CurrentFpsChanged
 func callbackQAbstract3DGraph_CurrentFpsChanged(ptr unsafe.Pointer, fps C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentFpsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentFpsChanged"); signal != nil {
 		signal.(func(float64))(float64(fps))
 	}
 
@@ -4897,14 +4932,14 @@ func callbackQAbstract3DGraph_CurrentFpsChanged(ptr unsafe.Pointer, fps C.double
 func (ptr *QAbstract3DGraph) ConnectCurrentFpsChanged(f func(fps float64)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectCurrentFpsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentFpsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentFpsChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectCurrentFpsChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectCurrentFpsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentFpsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "currentFpsChanged")
 	}
 }
 
@@ -4916,7 +4951,7 @@ func (ptr *QAbstract3DGraph) CurrentFpsChanged(fps float64) {
 
 //export callbackQAbstract3DGraph_HorizontalAspectRatioChanged
 func callbackQAbstract3DGraph_HorizontalAspectRatioChanged(ptr unsafe.Pointer, ratio C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "horizontalAspectRatioChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "horizontalAspectRatioChanged"); signal != nil {
 		signal.(func(float64))(float64(ratio))
 	}
 
@@ -4925,14 +4960,14 @@ func callbackQAbstract3DGraph_HorizontalAspectRatioChanged(ptr unsafe.Pointer, r
 func (ptr *QAbstract3DGraph) ConnectHorizontalAspectRatioChanged(f func(ratio float64)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectHorizontalAspectRatioChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "horizontalAspectRatioChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "horizontalAspectRatioChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectHorizontalAspectRatioChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectHorizontalAspectRatioChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "horizontalAspectRatioChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "horizontalAspectRatioChanged")
 	}
 }
 
@@ -4944,7 +4979,7 @@ func (ptr *QAbstract3DGraph) HorizontalAspectRatioChanged(ratio float64) {
 
 //export callbackQAbstract3DGraph_LocaleChanged
 func callbackQAbstract3DGraph_LocaleChanged(ptr unsafe.Pointer, locale unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "localeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "localeChanged"); signal != nil {
 		signal.(func(*core.QLocale))(core.NewQLocaleFromPointer(locale))
 	}
 
@@ -4953,14 +4988,14 @@ func callbackQAbstract3DGraph_LocaleChanged(ptr unsafe.Pointer, locale unsafe.Po
 func (ptr *QAbstract3DGraph) ConnectLocaleChanged(f func(locale *core.QLocale)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectLocaleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "localeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "localeChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectLocaleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectLocaleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "localeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "localeChanged")
 	}
 }
 
@@ -4972,7 +5007,7 @@ func (ptr *QAbstract3DGraph) LocaleChanged(locale core.QLocale_ITF) {
 
 //export callbackQAbstract3DGraph_MarginChanged
 func callbackQAbstract3DGraph_MarginChanged(ptr unsafe.Pointer, margin C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "marginChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "marginChanged"); signal != nil {
 		signal.(func(float64))(float64(margin))
 	}
 
@@ -4981,14 +5016,14 @@ func callbackQAbstract3DGraph_MarginChanged(ptr unsafe.Pointer, margin C.double)
 func (ptr *QAbstract3DGraph) ConnectMarginChanged(f func(margin float64)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectMarginChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "marginChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "marginChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectMarginChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectMarginChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "marginChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "marginChanged")
 	}
 }
 
@@ -5000,7 +5035,7 @@ func (ptr *QAbstract3DGraph) MarginChanged(margin float64) {
 
 //export callbackQAbstract3DGraph_MeasureFpsChanged
 func callbackQAbstract3DGraph_MeasureFpsChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "measureFpsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "measureFpsChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -5009,14 +5044,14 @@ func callbackQAbstract3DGraph_MeasureFpsChanged(ptr unsafe.Pointer, enabled C.ch
 func (ptr *QAbstract3DGraph) ConnectMeasureFpsChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectMeasureFpsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "measureFpsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "measureFpsChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectMeasureFpsChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectMeasureFpsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "measureFpsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "measureFpsChanged")
 	}
 }
 
@@ -5028,7 +5063,7 @@ func (ptr *QAbstract3DGraph) MeasureFpsChanged(enabled bool) {
 
 //export callbackQAbstract3DGraph_OptimizationHintsChanged
 func callbackQAbstract3DGraph_OptimizationHintsChanged(ptr unsafe.Pointer, hints C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "optimizationHintsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "optimizationHintsChanged"); signal != nil {
 		signal.(func(QAbstract3DGraph__OptimizationHint))(QAbstract3DGraph__OptimizationHint(hints))
 	}
 
@@ -5037,14 +5072,14 @@ func callbackQAbstract3DGraph_OptimizationHintsChanged(ptr unsafe.Pointer, hints
 func (ptr *QAbstract3DGraph) ConnectOptimizationHintsChanged(f func(hints QAbstract3DGraph__OptimizationHint)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectOptimizationHintsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "optimizationHintsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "optimizationHintsChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectOptimizationHintsChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectOptimizationHintsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "optimizationHintsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "optimizationHintsChanged")
 	}
 }
 
@@ -5056,7 +5091,7 @@ func (ptr *QAbstract3DGraph) OptimizationHintsChanged(hints QAbstract3DGraph__Op
 
 //export callbackQAbstract3DGraph_OrthoProjectionChanged
 func callbackQAbstract3DGraph_OrthoProjectionChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "orthoProjectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "orthoProjectionChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -5065,14 +5100,14 @@ func callbackQAbstract3DGraph_OrthoProjectionChanged(ptr unsafe.Pointer, enabled
 func (ptr *QAbstract3DGraph) ConnectOrthoProjectionChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectOrthoProjectionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "orthoProjectionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "orthoProjectionChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectOrthoProjectionChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectOrthoProjectionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "orthoProjectionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "orthoProjectionChanged")
 	}
 }
 
@@ -5084,7 +5119,7 @@ func (ptr *QAbstract3DGraph) OrthoProjectionChanged(enabled bool) {
 
 //export callbackQAbstract3DGraph_PolarChanged
 func callbackQAbstract3DGraph_PolarChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "polarChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "polarChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -5093,14 +5128,14 @@ func callbackQAbstract3DGraph_PolarChanged(ptr unsafe.Pointer, enabled C.char) {
 func (ptr *QAbstract3DGraph) ConnectPolarChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectPolarChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "polarChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "polarChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectPolarChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectPolarChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "polarChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "polarChanged")
 	}
 }
 
@@ -5112,7 +5147,7 @@ func (ptr *QAbstract3DGraph) PolarChanged(enabled bool) {
 
 //export callbackQAbstract3DGraph_QueriedGraphPositionChanged
 func callbackQAbstract3DGraph_QueriedGraphPositionChanged(ptr unsafe.Pointer, data unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "queriedGraphPositionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "queriedGraphPositionChanged"); signal != nil {
 		signal.(func(*gui.QVector3D))(gui.NewQVector3DFromPointer(data))
 	}
 
@@ -5121,14 +5156,14 @@ func callbackQAbstract3DGraph_QueriedGraphPositionChanged(ptr unsafe.Pointer, da
 func (ptr *QAbstract3DGraph) ConnectQueriedGraphPositionChanged(f func(data *gui.QVector3D)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectQueriedGraphPositionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "queriedGraphPositionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "queriedGraphPositionChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectQueriedGraphPositionChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectQueriedGraphPositionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "queriedGraphPositionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "queriedGraphPositionChanged")
 	}
 }
 
@@ -5140,7 +5175,7 @@ func (ptr *QAbstract3DGraph) QueriedGraphPositionChanged(data gui.QVector3D_ITF)
 
 //export callbackQAbstract3DGraph_RadialLabelOffsetChanged
 func callbackQAbstract3DGraph_RadialLabelOffsetChanged(ptr unsafe.Pointer, offset C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "radialLabelOffsetChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "radialLabelOffsetChanged"); signal != nil {
 		signal.(func(float32))(float32(offset))
 	}
 
@@ -5149,14 +5184,14 @@ func callbackQAbstract3DGraph_RadialLabelOffsetChanged(ptr unsafe.Pointer, offse
 func (ptr *QAbstract3DGraph) ConnectRadialLabelOffsetChanged(f func(offset float32)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectRadialLabelOffsetChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "radialLabelOffsetChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "radialLabelOffsetChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectRadialLabelOffsetChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectRadialLabelOffsetChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "radialLabelOffsetChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "radialLabelOffsetChanged")
 	}
 }
 
@@ -5168,7 +5203,7 @@ func (ptr *QAbstract3DGraph) RadialLabelOffsetChanged(offset float32) {
 
 //export callbackQAbstract3DGraph_ReflectionChanged
 func callbackQAbstract3DGraph_ReflectionChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reflectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reflectionChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -5177,14 +5212,14 @@ func callbackQAbstract3DGraph_ReflectionChanged(ptr unsafe.Pointer, enabled C.ch
 func (ptr *QAbstract3DGraph) ConnectReflectionChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectReflectionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reflectionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "reflectionChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectReflectionChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectReflectionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reflectionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "reflectionChanged")
 	}
 }
 
@@ -5196,7 +5231,7 @@ func (ptr *QAbstract3DGraph) ReflectionChanged(enabled bool) {
 
 //export callbackQAbstract3DGraph_ReflectivityChanged
 func callbackQAbstract3DGraph_ReflectivityChanged(ptr unsafe.Pointer, reflectivity C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reflectivityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reflectivityChanged"); signal != nil {
 		signal.(func(float64))(float64(reflectivity))
 	}
 
@@ -5205,14 +5240,14 @@ func callbackQAbstract3DGraph_ReflectivityChanged(ptr unsafe.Pointer, reflectivi
 func (ptr *QAbstract3DGraph) ConnectReflectivityChanged(f func(reflectivity float64)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectReflectivityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reflectivityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "reflectivityChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectReflectivityChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectReflectivityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reflectivityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "reflectivityChanged")
 	}
 }
 
@@ -5260,7 +5295,7 @@ func (ptr *QAbstract3DGraph) RemoveCustomItems() {
 
 //export callbackQAbstract3DGraph_SelectedElementChanged
 func callbackQAbstract3DGraph_SelectedElementChanged(ptr unsafe.Pointer, ty C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedElementChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedElementChanged"); signal != nil {
 		signal.(func(QAbstract3DGraph__ElementType))(QAbstract3DGraph__ElementType(ty))
 	}
 
@@ -5269,14 +5304,14 @@ func callbackQAbstract3DGraph_SelectedElementChanged(ptr unsafe.Pointer, ty C.lo
 func (ptr *QAbstract3DGraph) ConnectSelectedElementChanged(f func(ty QAbstract3DGraph__ElementType)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectSelectedElementChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedElementChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedElementChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectSelectedElementChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectSelectedElementChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedElementChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedElementChanged")
 	}
 }
 
@@ -5288,7 +5323,7 @@ func (ptr *QAbstract3DGraph) SelectedElementChanged(ty QAbstract3DGraph__Element
 
 //export callbackQAbstract3DGraph_SelectionModeChanged
 func callbackQAbstract3DGraph_SelectionModeChanged(ptr unsafe.Pointer, mode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionModeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionModeChanged"); signal != nil {
 		signal.(func(QAbstract3DGraph__SelectionFlag))(QAbstract3DGraph__SelectionFlag(mode))
 	}
 
@@ -5297,14 +5332,14 @@ func callbackQAbstract3DGraph_SelectionModeChanged(ptr unsafe.Pointer, mode C.lo
 func (ptr *QAbstract3DGraph) ConnectSelectionModeChanged(f func(mode QAbstract3DGraph__SelectionFlag)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectSelectionModeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectionModeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectionModeChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectSelectionModeChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectSelectionModeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectionModeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectionModeChanged")
 	}
 }
 
@@ -5406,7 +5441,7 @@ func (ptr *QAbstract3DGraph) SetShadowQuality(quality QAbstract3DGraph__ShadowQu
 
 //export callbackQAbstract3DGraph_ShadowQualityChanged
 func callbackQAbstract3DGraph_ShadowQualityChanged(ptr unsafe.Pointer, quality C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shadowQualityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shadowQualityChanged"); signal != nil {
 		signal.(func(QAbstract3DGraph__ShadowQuality))(QAbstract3DGraph__ShadowQuality(quality))
 	}
 
@@ -5415,14 +5450,14 @@ func callbackQAbstract3DGraph_ShadowQualityChanged(ptr unsafe.Pointer, quality C
 func (ptr *QAbstract3DGraph) ConnectShadowQualityChanged(f func(quality QAbstract3DGraph__ShadowQuality)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_ConnectShadowQualityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shadowQualityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "shadowQualityChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectShadowQualityChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DisconnectShadowQualityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shadowQualityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "shadowQualityChanged")
 	}
 }
 
@@ -5434,7 +5469,7 @@ func (ptr *QAbstract3DGraph) ShadowQualityChanged(quality QAbstract3DGraph__Shad
 
 //export callbackQAbstract3DGraph_DestroyQAbstract3DGraph
 func callbackQAbstract3DGraph_DestroyQAbstract3DGraph(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstract3DGraph"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstract3DGraph"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstract3DGraphFromPointer(ptr).DestroyQAbstract3DGraphDefault()
@@ -5444,21 +5479,21 @@ func callbackQAbstract3DGraph_DestroyQAbstract3DGraph(ptr unsafe.Pointer) {
 func (ptr *QAbstract3DGraph) ConnectDestroyQAbstract3DGraph(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstract3DGraph", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstract3DGraph", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectDestroyQAbstract3DGraph() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstract3DGraph")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstract3DGraph")
 	}
 }
 
 func (ptr *QAbstract3DGraph) DestroyQAbstract3DGraph() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DestroyQAbstract3DGraph(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5466,7 +5501,7 @@ func (ptr *QAbstract3DGraph) DestroyQAbstract3DGraph() {
 func (ptr *QAbstract3DGraph) DestroyQAbstract3DGraphDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DGraph_DestroyQAbstract3DGraphDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5628,7 +5663,7 @@ func (ptr *QAbstract3DGraph) MeasureFps() bool {
 
 //export callbackQAbstract3DGraph_ShadowsSupported
 func callbackQAbstract3DGraph_ShadowsSupported(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shadowsSupported"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shadowsSupported"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5638,14 +5673,14 @@ func callbackQAbstract3DGraph_ShadowsSupported(ptr unsafe.Pointer) C.char {
 func (ptr *QAbstract3DGraph) ConnectShadowsSupported(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shadowsSupported", f)
+		qt.ConnectSignal(ptr.Pointer(), "shadowsSupported", f)
 	}
 }
 
 func (ptr *QAbstract3DGraph) DisconnectShadowsSupported() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shadowsSupported")
+		qt.DisconnectSignal(ptr.Pointer(), "shadowsSupported")
 	}
 }
 
@@ -5843,7 +5878,7 @@ func NewQAbstract3DInputHandler(parent core.QObject_ITF) *QAbstract3DInputHandle
 
 //export callbackQAbstract3DInputHandler_InputViewChanged
 func callbackQAbstract3DInputHandler_InputViewChanged(ptr unsafe.Pointer, view C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputViewChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputViewChanged"); signal != nil {
 		signal.(func(QAbstract3DInputHandler__InputView))(QAbstract3DInputHandler__InputView(view))
 	}
 
@@ -5852,14 +5887,14 @@ func callbackQAbstract3DInputHandler_InputViewChanged(ptr unsafe.Pointer, view C
 func (ptr *QAbstract3DInputHandler) ConnectInputViewChanged(f func(view QAbstract3DInputHandler__InputView)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DInputHandler_ConnectInputViewChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "inputViewChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "inputViewChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectInputViewChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DInputHandler_DisconnectInputViewChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "inputViewChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "inputViewChanged")
 	}
 }
 
@@ -5871,7 +5906,7 @@ func (ptr *QAbstract3DInputHandler) InputViewChanged(view QAbstract3DInputHandle
 
 //export callbackQAbstract3DInputHandler_MouseDoubleClickEvent
 func callbackQAbstract3DInputHandler_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQAbstract3DInputHandlerFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -5881,14 +5916,14 @@ func callbackQAbstract3DInputHandler_MouseDoubleClickEvent(ptr unsafe.Pointer, e
 func (ptr *QAbstract3DInputHandler) ConnectMouseDoubleClickEvent(f func(event *gui.QMouseEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseDoubleClickEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseDoubleClickEvent", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectMouseDoubleClickEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseDoubleClickEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseDoubleClickEvent")
 	}
 }
 
@@ -5906,7 +5941,7 @@ func (ptr *QAbstract3DInputHandler) MouseDoubleClickEventDefault(event gui.QMous
 
 //export callbackQAbstract3DInputHandler_MouseMoveEvent
 func callbackQAbstract3DInputHandler_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer, mousePos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent, *core.QPoint))(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
 	} else {
 		NewQAbstract3DInputHandlerFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
@@ -5916,14 +5951,14 @@ func callbackQAbstract3DInputHandler_MouseMoveEvent(ptr unsafe.Pointer, event un
 func (ptr *QAbstract3DInputHandler) ConnectMouseMoveEvent(f func(event *gui.QMouseEvent, mousePos *core.QPoint)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseMoveEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseMoveEvent", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectMouseMoveEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseMoveEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseMoveEvent")
 	}
 }
 
@@ -5941,7 +5976,7 @@ func (ptr *QAbstract3DInputHandler) MouseMoveEventDefault(event gui.QMouseEvent_
 
 //export callbackQAbstract3DInputHandler_MousePressEvent
 func callbackQAbstract3DInputHandler_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer, mousePos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent, *core.QPoint))(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
 	} else {
 		NewQAbstract3DInputHandlerFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
@@ -5951,14 +5986,14 @@ func callbackQAbstract3DInputHandler_MousePressEvent(ptr unsafe.Pointer, event u
 func (ptr *QAbstract3DInputHandler) ConnectMousePressEvent(f func(event *gui.QMouseEvent, mousePos *core.QPoint)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mousePressEvent", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectMousePressEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mousePressEvent")
 	}
 }
 
@@ -5976,7 +6011,7 @@ func (ptr *QAbstract3DInputHandler) MousePressEventDefault(event gui.QMouseEvent
 
 //export callbackQAbstract3DInputHandler_MouseReleaseEvent
 func callbackQAbstract3DInputHandler_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer, mousePos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent, *core.QPoint))(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
 	} else {
 		NewQAbstract3DInputHandlerFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event), core.NewQPointFromPointer(mousePos))
@@ -5986,14 +6021,14 @@ func callbackQAbstract3DInputHandler_MouseReleaseEvent(ptr unsafe.Pointer, event
 func (ptr *QAbstract3DInputHandler) ConnectMouseReleaseEvent(f func(event *gui.QMouseEvent, mousePos *core.QPoint)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseReleaseEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseReleaseEvent", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectMouseReleaseEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseReleaseEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseReleaseEvent")
 	}
 }
 
@@ -6011,7 +6046,7 @@ func (ptr *QAbstract3DInputHandler) MouseReleaseEventDefault(event gui.QMouseEve
 
 //export callbackQAbstract3DInputHandler_PositionChanged
 func callbackQAbstract3DInputHandler_PositionChanged(ptr unsafe.Pointer, position unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "positionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "positionChanged"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(position))
 	}
 
@@ -6020,14 +6055,14 @@ func callbackQAbstract3DInputHandler_PositionChanged(ptr unsafe.Pointer, positio
 func (ptr *QAbstract3DInputHandler) ConnectPositionChanged(f func(position *core.QPoint)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DInputHandler_ConnectPositionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "positionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "positionChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectPositionChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DInputHandler_DisconnectPositionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "positionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "positionChanged")
 	}
 }
 
@@ -6039,7 +6074,7 @@ func (ptr *QAbstract3DInputHandler) PositionChanged(position core.QPoint_ITF) {
 
 //export callbackQAbstract3DInputHandler_SceneChanged
 func callbackQAbstract3DInputHandler_SceneChanged(ptr unsafe.Pointer, scene unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneChanged"); signal != nil {
 		signal.(func(*Q3DScene))(NewQ3DSceneFromPointer(scene))
 	}
 
@@ -6048,14 +6083,14 @@ func callbackQAbstract3DInputHandler_SceneChanged(ptr unsafe.Pointer, scene unsa
 func (ptr *QAbstract3DInputHandler) ConnectSceneChanged(f func(scene *Q3DScene)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DInputHandler_ConnectSceneChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sceneChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sceneChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectSceneChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DInputHandler_DisconnectSceneChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sceneChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sceneChanged")
 	}
 }
 
@@ -6085,7 +6120,7 @@ func (ptr *QAbstract3DInputHandler) SetScene(scene Q3DScene_ITF) {
 
 //export callbackQAbstract3DInputHandler_TouchEvent
 func callbackQAbstract3DInputHandler_TouchEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "touchEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "touchEvent"); signal != nil {
 		signal.(func(*gui.QTouchEvent))(gui.NewQTouchEventFromPointer(event))
 	} else {
 		NewQAbstract3DInputHandlerFromPointer(ptr).TouchEventDefault(gui.NewQTouchEventFromPointer(event))
@@ -6095,14 +6130,14 @@ func callbackQAbstract3DInputHandler_TouchEvent(ptr unsafe.Pointer, event unsafe
 func (ptr *QAbstract3DInputHandler) ConnectTouchEvent(f func(event *gui.QTouchEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "touchEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "touchEvent", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectTouchEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "touchEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "touchEvent")
 	}
 }
 
@@ -6120,7 +6155,7 @@ func (ptr *QAbstract3DInputHandler) TouchEventDefault(event gui.QTouchEvent_ITF)
 
 //export callbackQAbstract3DInputHandler_WheelEvent
 func callbackQAbstract3DInputHandler_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQAbstract3DInputHandlerFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -6130,14 +6165,14 @@ func callbackQAbstract3DInputHandler_WheelEvent(ptr unsafe.Pointer, event unsafe
 func (ptr *QAbstract3DInputHandler) ConnectWheelEvent(f func(event *gui.QWheelEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "wheelEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "wheelEvent", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectWheelEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "wheelEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "wheelEvent")
 	}
 }
 
@@ -6155,7 +6190,7 @@ func (ptr *QAbstract3DInputHandler) WheelEventDefault(event gui.QWheelEvent_ITF)
 
 //export callbackQAbstract3DInputHandler_DestroyQAbstract3DInputHandler
 func callbackQAbstract3DInputHandler_DestroyQAbstract3DInputHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstract3DInputHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstract3DInputHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstract3DInputHandlerFromPointer(ptr).DestroyQAbstract3DInputHandlerDefault()
@@ -6165,21 +6200,21 @@ func callbackQAbstract3DInputHandler_DestroyQAbstract3DInputHandler(ptr unsafe.P
 func (ptr *QAbstract3DInputHandler) ConnectDestroyQAbstract3DInputHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstract3DInputHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstract3DInputHandler", f)
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DisconnectDestroyQAbstract3DInputHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstract3DInputHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstract3DInputHandler")
 	}
 }
 
 func (ptr *QAbstract3DInputHandler) DestroyQAbstract3DInputHandler() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DInputHandler_DestroyQAbstract3DInputHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6187,7 +6222,7 @@ func (ptr *QAbstract3DInputHandler) DestroyQAbstract3DInputHandler() {
 func (ptr *QAbstract3DInputHandler) DestroyQAbstract3DInputHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DInputHandler_DestroyQAbstract3DInputHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6294,7 +6329,7 @@ const (
 
 //export callbackQAbstract3DSeries_MultiHighlightGradientChanged
 func callbackQAbstract3DSeries_MultiHighlightGradientChanged(ptr unsafe.Pointer, gradient unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "multiHighlightGradientChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "multiHighlightGradientChanged"); signal != nil {
 		signal.(func(*gui.QLinearGradient))(gui.NewQLinearGradientFromPointer(gradient))
 	}
 
@@ -6303,14 +6338,14 @@ func callbackQAbstract3DSeries_MultiHighlightGradientChanged(ptr unsafe.Pointer,
 func (ptr *QAbstract3DSeries) ConnectMultiHighlightGradientChanged(f func(gradient *gui.QLinearGradient)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectMultiHighlightGradientChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "multiHighlightGradientChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "multiHighlightGradientChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectMultiHighlightGradientChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectMultiHighlightGradientChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "multiHighlightGradientChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "multiHighlightGradientChanged")
 	}
 }
 
@@ -6328,7 +6363,7 @@ func (ptr *QAbstract3DSeries) SetMeshRotation(rotation gui.QQuaternion_ITF) {
 
 //export callbackQAbstract3DSeries_BaseColorChanged
 func callbackQAbstract3DSeries_BaseColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "baseColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "baseColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -6337,14 +6372,14 @@ func callbackQAbstract3DSeries_BaseColorChanged(ptr unsafe.Pointer, color unsafe
 func (ptr *QAbstract3DSeries) ConnectBaseColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectBaseColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "baseColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "baseColorChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectBaseColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectBaseColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "baseColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "baseColorChanged")
 	}
 }
 
@@ -6356,7 +6391,7 @@ func (ptr *QAbstract3DSeries) BaseColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAbstract3DSeries_BaseGradientChanged
 func callbackQAbstract3DSeries_BaseGradientChanged(ptr unsafe.Pointer, gradient unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "baseGradientChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "baseGradientChanged"); signal != nil {
 		signal.(func(*gui.QLinearGradient))(gui.NewQLinearGradientFromPointer(gradient))
 	}
 
@@ -6365,14 +6400,14 @@ func callbackQAbstract3DSeries_BaseGradientChanged(ptr unsafe.Pointer, gradient
 func (ptr *QAbstract3DSeries) ConnectBaseGradientChanged(f func(gradient *gui.QLinearGradient)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectBaseGradientChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "baseGradientChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "baseGradientChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectBaseGradientChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectBaseGradientChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "baseGradientChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "baseGradientChanged")
 	}
 }
 
@@ -6384,7 +6419,7 @@ func (ptr *QAbstract3DSeries) BaseGradientChanged(gradient gui.QLinearGradient_I
 
 //export callbackQAbstract3DSeries_ColorStyleChanged
 func callbackQAbstract3DSeries_ColorStyleChanged(ptr unsafe.Pointer, style C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorStyleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorStyleChanged"); signal != nil {
 		signal.(func(Q3DTheme__ColorStyle))(Q3DTheme__ColorStyle(style))
 	}
 
@@ -6393,14 +6428,14 @@ func callbackQAbstract3DSeries_ColorStyleChanged(ptr unsafe.Pointer, style C.lon
 func (ptr *QAbstract3DSeries) ConnectColorStyleChanged(f func(style Q3DTheme__ColorStyle)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectColorStyleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorStyleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorStyleChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectColorStyleChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectColorStyleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorStyleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorStyleChanged")
 	}
 }
 
@@ -6412,7 +6447,7 @@ func (ptr *QAbstract3DSeries) ColorStyleChanged(style Q3DTheme__ColorStyle) {
 
 //export callbackQAbstract3DSeries_ItemLabelChanged
 func callbackQAbstract3DSeries_ItemLabelChanged(ptr unsafe.Pointer, label C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemLabelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemLabelChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(label))
 	}
 
@@ -6421,14 +6456,14 @@ func callbackQAbstract3DSeries_ItemLabelChanged(ptr unsafe.Pointer, label C.stru
 func (ptr *QAbstract3DSeries) ConnectItemLabelChanged(f func(label string)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectItemLabelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemLabelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemLabelChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectItemLabelChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectItemLabelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemLabelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemLabelChanged")
 	}
 }
 
@@ -6442,7 +6477,7 @@ func (ptr *QAbstract3DSeries) ItemLabelChanged(label string) {
 
 //export callbackQAbstract3DSeries_ItemLabelFormatChanged
 func callbackQAbstract3DSeries_ItemLabelFormatChanged(ptr unsafe.Pointer, format C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemLabelFormatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemLabelFormatChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(format))
 	}
 
@@ -6451,14 +6486,14 @@ func callbackQAbstract3DSeries_ItemLabelFormatChanged(ptr unsafe.Pointer, format
 func (ptr *QAbstract3DSeries) ConnectItemLabelFormatChanged(f func(format string)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectItemLabelFormatChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemLabelFormatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemLabelFormatChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectItemLabelFormatChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectItemLabelFormatChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemLabelFormatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemLabelFormatChanged")
 	}
 }
 
@@ -6472,7 +6507,7 @@ func (ptr *QAbstract3DSeries) ItemLabelFormatChanged(format string) {
 
 //export callbackQAbstract3DSeries_ItemLabelVisibilityChanged
 func callbackQAbstract3DSeries_ItemLabelVisibilityChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemLabelVisibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemLabelVisibilityChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -6481,14 +6516,14 @@ func callbackQAbstract3DSeries_ItemLabelVisibilityChanged(ptr unsafe.Pointer, vi
 func (ptr *QAbstract3DSeries) ConnectItemLabelVisibilityChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectItemLabelVisibilityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemLabelVisibilityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemLabelVisibilityChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectItemLabelVisibilityChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectItemLabelVisibilityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemLabelVisibilityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemLabelVisibilityChanged")
 	}
 }
 
@@ -6500,7 +6535,7 @@ func (ptr *QAbstract3DSeries) ItemLabelVisibilityChanged(visible bool) {
 
 //export callbackQAbstract3DSeries_MeshChanged
 func callbackQAbstract3DSeries_MeshChanged(ptr unsafe.Pointer, mesh C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "meshChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "meshChanged"); signal != nil {
 		signal.(func(QAbstract3DSeries__Mesh))(QAbstract3DSeries__Mesh(mesh))
 	}
 
@@ -6509,14 +6544,14 @@ func callbackQAbstract3DSeries_MeshChanged(ptr unsafe.Pointer, mesh C.longlong)
 func (ptr *QAbstract3DSeries) ConnectMeshChanged(f func(mesh QAbstract3DSeries__Mesh)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectMeshChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "meshChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "meshChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectMeshChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectMeshChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "meshChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "meshChanged")
 	}
 }
 
@@ -6528,7 +6563,7 @@ func (ptr *QAbstract3DSeries) MeshChanged(mesh QAbstract3DSeries__Mesh) {
 
 //export callbackQAbstract3DSeries_MeshRotationChanged
 func callbackQAbstract3DSeries_MeshRotationChanged(ptr unsafe.Pointer, rotation unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "meshRotationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "meshRotationChanged"); signal != nil {
 		signal.(func(*gui.QQuaternion))(gui.NewQQuaternionFromPointer(rotation))
 	}
 
@@ -6537,14 +6572,14 @@ func callbackQAbstract3DSeries_MeshRotationChanged(ptr unsafe.Pointer, rotation
 func (ptr *QAbstract3DSeries) ConnectMeshRotationChanged(f func(rotation *gui.QQuaternion)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectMeshRotationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "meshRotationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "meshRotationChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectMeshRotationChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectMeshRotationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "meshRotationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "meshRotationChanged")
 	}
 }
 
@@ -6556,7 +6591,7 @@ func (ptr *QAbstract3DSeries) MeshRotationChanged(rotation gui.QQuaternion_ITF)
 
 //export callbackQAbstract3DSeries_MeshSmoothChanged
 func callbackQAbstract3DSeries_MeshSmoothChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "meshSmoothChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "meshSmoothChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -6565,14 +6600,14 @@ func callbackQAbstract3DSeries_MeshSmoothChanged(ptr unsafe.Pointer, enabled C.c
 func (ptr *QAbstract3DSeries) ConnectMeshSmoothChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectMeshSmoothChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "meshSmoothChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "meshSmoothChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectMeshSmoothChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectMeshSmoothChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "meshSmoothChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "meshSmoothChanged")
 	}
 }
 
@@ -6584,7 +6619,7 @@ func (ptr *QAbstract3DSeries) MeshSmoothChanged(enabled bool) {
 
 //export callbackQAbstract3DSeries_MultiHighlightColorChanged
 func callbackQAbstract3DSeries_MultiHighlightColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "multiHighlightColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "multiHighlightColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -6593,14 +6628,14 @@ func callbackQAbstract3DSeries_MultiHighlightColorChanged(ptr unsafe.Pointer, co
 func (ptr *QAbstract3DSeries) ConnectMultiHighlightColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectMultiHighlightColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "multiHighlightColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "multiHighlightColorChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectMultiHighlightColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectMultiHighlightColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "multiHighlightColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "multiHighlightColorChanged")
 	}
 }
 
@@ -6612,7 +6647,7 @@ func (ptr *QAbstract3DSeries) MultiHighlightColorChanged(color gui.QColor_ITF) {
 
 //export callbackQAbstract3DSeries_NameChanged
 func callbackQAbstract3DSeries_NameChanged(ptr unsafe.Pointer, name C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(name))
 	}
 
@@ -6621,14 +6656,14 @@ func callbackQAbstract3DSeries_NameChanged(ptr unsafe.Pointer, name C.struct_QtD
 func (ptr *QAbstract3DSeries) ConnectNameChanged(f func(name string)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectNameChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nameChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "nameChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectNameChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectNameChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nameChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "nameChanged")
 	}
 }
 
@@ -6738,7 +6773,7 @@ func (ptr *QAbstract3DSeries) SetVisible(visible bool) {
 
 //export callbackQAbstract3DSeries_SingleHighlightColorChanged
 func callbackQAbstract3DSeries_SingleHighlightColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "singleHighlightColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "singleHighlightColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -6747,14 +6782,14 @@ func callbackQAbstract3DSeries_SingleHighlightColorChanged(ptr unsafe.Pointer, c
 func (ptr *QAbstract3DSeries) ConnectSingleHighlightColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectSingleHighlightColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "singleHighlightColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "singleHighlightColorChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectSingleHighlightColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectSingleHighlightColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "singleHighlightColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "singleHighlightColorChanged")
 	}
 }
 
@@ -6766,7 +6801,7 @@ func (ptr *QAbstract3DSeries) SingleHighlightColorChanged(color gui.QColor_ITF)
 
 //export callbackQAbstract3DSeries_SingleHighlightGradientChanged
 func callbackQAbstract3DSeries_SingleHighlightGradientChanged(ptr unsafe.Pointer, gradient unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "singleHighlightGradientChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "singleHighlightGradientChanged"); signal != nil {
 		signal.(func(*gui.QLinearGradient))(gui.NewQLinearGradientFromPointer(gradient))
 	}
 
@@ -6775,14 +6810,14 @@ func callbackQAbstract3DSeries_SingleHighlightGradientChanged(ptr unsafe.Pointer
 func (ptr *QAbstract3DSeries) ConnectSingleHighlightGradientChanged(f func(gradient *gui.QLinearGradient)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectSingleHighlightGradientChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "singleHighlightGradientChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "singleHighlightGradientChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectSingleHighlightGradientChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectSingleHighlightGradientChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "singleHighlightGradientChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "singleHighlightGradientChanged")
 	}
 }
 
@@ -6794,7 +6829,7 @@ func (ptr *QAbstract3DSeries) SingleHighlightGradientChanged(gradient gui.QLinea
 
 //export callbackQAbstract3DSeries_UserDefinedMeshChanged
 func callbackQAbstract3DSeries_UserDefinedMeshChanged(ptr unsafe.Pointer, fileName C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "userDefinedMeshChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "userDefinedMeshChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(fileName))
 	}
 
@@ -6803,14 +6838,14 @@ func callbackQAbstract3DSeries_UserDefinedMeshChanged(ptr unsafe.Pointer, fileNa
 func (ptr *QAbstract3DSeries) ConnectUserDefinedMeshChanged(f func(fileName string)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectUserDefinedMeshChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "userDefinedMeshChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "userDefinedMeshChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectUserDefinedMeshChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectUserDefinedMeshChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "userDefinedMeshChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "userDefinedMeshChanged")
 	}
 }
 
@@ -6824,7 +6859,7 @@ func (ptr *QAbstract3DSeries) UserDefinedMeshChanged(fileName string) {
 
 //export callbackQAbstract3DSeries_VisibilityChanged
 func callbackQAbstract3DSeries_VisibilityChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibilityChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -6833,14 +6868,14 @@ func callbackQAbstract3DSeries_VisibilityChanged(ptr unsafe.Pointer, visible C.c
 func (ptr *QAbstract3DSeries) ConnectVisibilityChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_ConnectVisibilityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "visibilityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "visibilityChanged", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectVisibilityChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DisconnectVisibilityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "visibilityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "visibilityChanged")
 	}
 }
 
@@ -6852,7 +6887,7 @@ func (ptr *QAbstract3DSeries) VisibilityChanged(visible bool) {
 
 //export callbackQAbstract3DSeries_DestroyQAbstract3DSeries
 func callbackQAbstract3DSeries_DestroyQAbstract3DSeries(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstract3DSeries"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstract3DSeries"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstract3DSeriesFromPointer(ptr).DestroyQAbstract3DSeriesDefault()
@@ -6862,21 +6897,21 @@ func callbackQAbstract3DSeries_DestroyQAbstract3DSeries(ptr unsafe.Pointer) {
 func (ptr *QAbstract3DSeries) ConnectDestroyQAbstract3DSeries(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstract3DSeries", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstract3DSeries", f)
 	}
 }
 
 func (ptr *QAbstract3DSeries) DisconnectDestroyQAbstract3DSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstract3DSeries")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstract3DSeries")
 	}
 }
 
 func (ptr *QAbstract3DSeries) DestroyQAbstract3DSeries() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DestroyQAbstract3DSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6884,7 +6919,7 @@ func (ptr *QAbstract3DSeries) DestroyQAbstract3DSeries() {
 func (ptr *QAbstract3DSeries) DestroyQAbstract3DSeriesDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstract3DSeries_DestroyQAbstract3DSeriesDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7080,7 +7115,7 @@ func (ptr *QAbstractDataProxy) Type() QAbstractDataProxy__DataType {
 
 //export callbackQAbstractDataProxy_DestroyQAbstractDataProxy
 func callbackQAbstractDataProxy_DestroyQAbstractDataProxy(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractDataProxy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractDataProxy"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractDataProxyFromPointer(ptr).DestroyQAbstractDataProxyDefault()
@@ -7090,21 +7125,21 @@ func callbackQAbstractDataProxy_DestroyQAbstractDataProxy(ptr unsafe.Pointer) {
 func (ptr *QAbstractDataProxy) ConnectDestroyQAbstractDataProxy(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractDataProxy", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractDataProxy", f)
 	}
 }
 
 func (ptr *QAbstractDataProxy) DisconnectDestroyQAbstractDataProxy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractDataProxy")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractDataProxy")
 	}
 }
 
 func (ptr *QAbstractDataProxy) DestroyQAbstractDataProxy() {
 	if ptr.Pointer() != nil {
 		C.QAbstractDataProxy_DestroyQAbstractDataProxy(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7112,7 +7147,7 @@ func (ptr *QAbstractDataProxy) DestroyQAbstractDataProxy() {
 func (ptr *QAbstractDataProxy) DestroyQAbstractDataProxyDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractDataProxy_DestroyQAbstractDataProxyDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7176,7 +7211,7 @@ func (ptr *QBar3DSeries) InvalidSelectionPosition() *core.QPoint {
 
 //export callbackQBar3DSeries_DataProxyChanged
 func callbackQBar3DSeries_DataProxyChanged(ptr unsafe.Pointer, proxy unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataProxyChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataProxyChanged"); signal != nil {
 		signal.(func(*QBarDataProxy))(NewQBarDataProxyFromPointer(proxy))
 	}
 
@@ -7185,14 +7220,14 @@ func callbackQBar3DSeries_DataProxyChanged(ptr unsafe.Pointer, proxy unsafe.Poin
 func (ptr *QBar3DSeries) ConnectDataProxyChanged(f func(proxy *QBarDataProxy)) {
 	if ptr.Pointer() != nil {
 		C.QBar3DSeries_ConnectDataProxyChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dataProxyChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "dataProxyChanged", f)
 	}
 }
 
 func (ptr *QBar3DSeries) DisconnectDataProxyChanged() {
 	if ptr.Pointer() != nil {
 		C.QBar3DSeries_DisconnectDataProxyChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dataProxyChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "dataProxyChanged")
 	}
 }
 
@@ -7204,7 +7239,7 @@ func (ptr *QBar3DSeries) DataProxyChanged(proxy QBarDataProxy_ITF) {
 
 //export callbackQBar3DSeries_MeshAngleChanged
 func callbackQBar3DSeries_MeshAngleChanged(ptr unsafe.Pointer, angle C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "meshAngleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "meshAngleChanged"); signal != nil {
 		signal.(func(float32))(float32(angle))
 	}
 
@@ -7213,14 +7248,14 @@ func callbackQBar3DSeries_MeshAngleChanged(ptr unsafe.Pointer, angle C.float) {
 func (ptr *QBar3DSeries) ConnectMeshAngleChanged(f func(angle float32)) {
 	if ptr.Pointer() != nil {
 		C.QBar3DSeries_ConnectMeshAngleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "meshAngleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "meshAngleChanged", f)
 	}
 }
 
 func (ptr *QBar3DSeries) DisconnectMeshAngleChanged() {
 	if ptr.Pointer() != nil {
 		C.QBar3DSeries_DisconnectMeshAngleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "meshAngleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "meshAngleChanged")
 	}
 }
 
@@ -7232,7 +7267,7 @@ func (ptr *QBar3DSeries) MeshAngleChanged(angle float32) {
 
 //export callbackQBar3DSeries_SelectedBarChanged
 func callbackQBar3DSeries_SelectedBarChanged(ptr unsafe.Pointer, position unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedBarChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedBarChanged"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(position))
 	}
 
@@ -7241,14 +7276,14 @@ func callbackQBar3DSeries_SelectedBarChanged(ptr unsafe.Pointer, position unsafe
 func (ptr *QBar3DSeries) ConnectSelectedBarChanged(f func(position *core.QPoint)) {
 	if ptr.Pointer() != nil {
 		C.QBar3DSeries_ConnectSelectedBarChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedBarChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedBarChanged", f)
 	}
 }
 
 func (ptr *QBar3DSeries) DisconnectSelectedBarChanged() {
 	if ptr.Pointer() != nil {
 		C.QBar3DSeries_DisconnectSelectedBarChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedBarChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedBarChanged")
 	}
 }
 
@@ -7278,7 +7313,7 @@ func (ptr *QBar3DSeries) SetSelectedBar(position core.QPoint_ITF) {
 
 //export callbackQBar3DSeries_DestroyQBar3DSeries
 func callbackQBar3DSeries_DestroyQBar3DSeries(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QBar3DSeries"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QBar3DSeries"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQBar3DSeriesFromPointer(ptr).DestroyQBar3DSeriesDefault()
@@ -7288,21 +7323,21 @@ func callbackQBar3DSeries_DestroyQBar3DSeries(ptr unsafe.Pointer) {
 func (ptr *QBar3DSeries) ConnectDestroyQBar3DSeries(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QBar3DSeries", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QBar3DSeries", f)
 	}
 }
 
 func (ptr *QBar3DSeries) DisconnectDestroyQBar3DSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QBar3DSeries")
+		qt.DisconnectSignal(ptr.Pointer(), "~QBar3DSeries")
 	}
 }
 
 func (ptr *QBar3DSeries) DestroyQBar3DSeries() {
 	if ptr.Pointer() != nil {
 		C.QBar3DSeries_DestroyQBar3DSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7310,7 +7345,7 @@ func (ptr *QBar3DSeries) DestroyQBar3DSeries() {
 func (ptr *QBar3DSeries) DestroyQBar3DSeriesDefault() {
 	if ptr.Pointer() != nil {
 		C.QBar3DSeries_DestroyQBar3DSeriesDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7475,7 +7510,7 @@ func NewQBarDataProxy(parent core.QObject_ITF) *QBarDataProxy {
 
 //export callbackQBarDataProxy_ArrayReset
 func callbackQBarDataProxy_ArrayReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "arrayReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "arrayReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7484,14 +7519,14 @@ func callbackQBarDataProxy_ArrayReset(ptr unsafe.Pointer) {
 func (ptr *QBarDataProxy) ConnectArrayReset(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectArrayReset(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "arrayReset", f)
+		qt.ConnectSignal(ptr.Pointer(), "arrayReset", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectArrayReset() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectArrayReset(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "arrayReset")
+		qt.DisconnectSignal(ptr.Pointer(), "arrayReset")
 	}
 }
 
@@ -7503,7 +7538,7 @@ func (ptr *QBarDataProxy) ArrayReset() {
 
 //export callbackQBarDataProxy_ColumnLabelsChanged
 func callbackQBarDataProxy_ColumnLabelsChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnLabelsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnLabelsChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7512,14 +7547,14 @@ func callbackQBarDataProxy_ColumnLabelsChanged(ptr unsafe.Pointer) {
 func (ptr *QBarDataProxy) ConnectColumnLabelsChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectColumnLabelsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnLabelsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnLabelsChanged", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectColumnLabelsChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectColumnLabelsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnLabelsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnLabelsChanged")
 	}
 }
 
@@ -7531,7 +7566,7 @@ func (ptr *QBarDataProxy) ColumnLabelsChanged() {
 
 //export callbackQBarDataProxy_ItemChanged
 func callbackQBarDataProxy_ItemChanged(ptr unsafe.Pointer, rowIndex C.int, columnIndex C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemChanged"); signal != nil {
 		signal.(func(int, int))(int(int32(rowIndex)), int(int32(columnIndex)))
 	}
 
@@ -7540,14 +7575,14 @@ func callbackQBarDataProxy_ItemChanged(ptr unsafe.Pointer, rowIndex C.int, colum
 func (ptr *QBarDataProxy) ConnectItemChanged(f func(rowIndex int, columnIndex int)) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectItemChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemChanged", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectItemChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectItemChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemChanged")
 	}
 }
 
@@ -7571,7 +7606,7 @@ func (ptr *QBarDataProxy) ResetArray() {
 
 //export callbackQBarDataProxy_RowCountChanged
 func callbackQBarDataProxy_RowCountChanged(ptr unsafe.Pointer, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(count)))
 	}
 
@@ -7580,14 +7615,14 @@ func callbackQBarDataProxy_RowCountChanged(ptr unsafe.Pointer, count C.int) {
 func (ptr *QBarDataProxy) ConnectRowCountChanged(f func(count int)) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectRowCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCountChanged", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectRowCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectRowCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCountChanged")
 	}
 }
 
@@ -7599,7 +7634,7 @@ func (ptr *QBarDataProxy) RowCountChanged(count int) {
 
 //export callbackQBarDataProxy_RowLabelsChanged
 func callbackQBarDataProxy_RowLabelsChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowLabelsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowLabelsChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7608,14 +7643,14 @@ func callbackQBarDataProxy_RowLabelsChanged(ptr unsafe.Pointer) {
 func (ptr *QBarDataProxy) ConnectRowLabelsChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectRowLabelsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowLabelsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowLabelsChanged", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectRowLabelsChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectRowLabelsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowLabelsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowLabelsChanged")
 	}
 }
 
@@ -7627,7 +7662,7 @@ func (ptr *QBarDataProxy) RowLabelsChanged() {
 
 //export callbackQBarDataProxy_RowsAdded
 func callbackQBarDataProxy_RowsAdded(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAdded"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -7636,14 +7671,14 @@ func callbackQBarDataProxy_RowsAdded(ptr unsafe.Pointer, startIndex C.int, count
 func (ptr *QBarDataProxy) ConnectRowsAdded(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectRowsAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsAdded", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectRowsAdded() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectRowsAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsAdded")
 	}
 }
 
@@ -7655,7 +7690,7 @@ func (ptr *QBarDataProxy) RowsAdded(startIndex int, count int) {
 
 //export callbackQBarDataProxy_RowsChanged
 func callbackQBarDataProxy_RowsChanged(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsChanged"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -7664,14 +7699,14 @@ func callbackQBarDataProxy_RowsChanged(ptr unsafe.Pointer, startIndex C.int, cou
 func (ptr *QBarDataProxy) ConnectRowsChanged(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectRowsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsChanged", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectRowsChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectRowsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsChanged")
 	}
 }
 
@@ -7683,7 +7718,7 @@ func (ptr *QBarDataProxy) RowsChanged(startIndex int, count int) {
 
 //export callbackQBarDataProxy_RowsInserted
 func callbackQBarDataProxy_RowsInserted(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsInserted"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -7692,14 +7727,14 @@ func callbackQBarDataProxy_RowsInserted(ptr unsafe.Pointer, startIndex C.int, co
 func (ptr *QBarDataProxy) ConnectRowsInserted(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectRowsInserted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsInserted", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsInserted", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectRowsInserted() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectRowsInserted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsInserted")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsInserted")
 	}
 }
 
@@ -7711,7 +7746,7 @@ func (ptr *QBarDataProxy) RowsInserted(startIndex int, count int) {
 
 //export callbackQBarDataProxy_RowsRemoved
 func callbackQBarDataProxy_RowsRemoved(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsRemoved"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -7720,14 +7755,14 @@ func callbackQBarDataProxy_RowsRemoved(ptr unsafe.Pointer, startIndex C.int, cou
 func (ptr *QBarDataProxy) ConnectRowsRemoved(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectRowsRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsRemoved", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectRowsRemoved() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectRowsRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsRemoved")
 	}
 }
 
@@ -7739,7 +7774,7 @@ func (ptr *QBarDataProxy) RowsRemoved(startIndex int, count int) {
 
 //export callbackQBarDataProxy_SeriesChanged
 func callbackQBarDataProxy_SeriesChanged(ptr unsafe.Pointer, series unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesChanged"); signal != nil {
 		signal.(func(*QBar3DSeries))(NewQBar3DSeriesFromPointer(series))
 	}
 
@@ -7748,14 +7783,14 @@ func callbackQBarDataProxy_SeriesChanged(ptr unsafe.Pointer, series unsafe.Point
 func (ptr *QBarDataProxy) ConnectSeriesChanged(f func(series *QBar3DSeries)) {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_ConnectSeriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesChanged", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectSeriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DisconnectSeriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesChanged")
 	}
 }
 
@@ -7767,7 +7802,7 @@ func (ptr *QBarDataProxy) SeriesChanged(series QBar3DSeries_ITF) {
 
 func (ptr *QBarDataProxy) SetColumnLabels(labels []string) {
 	if ptr.Pointer() != nil {
-		var labelsC = C.CString(strings.Join(labels, "|"))
+		var labelsC = cGoPackStringList(labels)
 		defer C.free(unsafe.Pointer(labelsC))
 		C.QBarDataProxy_SetColumnLabels(ptr.Pointer(), labelsC)
 	}
@@ -7787,7 +7822,7 @@ func (ptr *QBarDataProxy) SetItem(rowIndex int, columnIndex int, item QBarDataIt
 
 func (ptr *QBarDataProxy) SetRowLabels(labels []string) {
 	if ptr.Pointer() != nil {
-		var labelsC = C.CString(strings.Join(labels, "|"))
+		var labelsC = cGoPackStringList(labels)
 		defer C.free(unsafe.Pointer(labelsC))
 		C.QBarDataProxy_SetRowLabels(ptr.Pointer(), labelsC)
 	}
@@ -7795,7 +7830,7 @@ func (ptr *QBarDataProxy) SetRowLabels(labels []string) {
 
 //export callbackQBarDataProxy_DestroyQBarDataProxy
 func callbackQBarDataProxy_DestroyQBarDataProxy(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QBarDataProxy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QBarDataProxy"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQBarDataProxyFromPointer(ptr).DestroyQBarDataProxyDefault()
@@ -7805,21 +7840,21 @@ func callbackQBarDataProxy_DestroyQBarDataProxy(ptr unsafe.Pointer) {
 func (ptr *QBarDataProxy) ConnectDestroyQBarDataProxy(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QBarDataProxy", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QBarDataProxy", f)
 	}
 }
 
 func (ptr *QBarDataProxy) DisconnectDestroyQBarDataProxy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QBarDataProxy")
+		qt.DisconnectSignal(ptr.Pointer(), "~QBarDataProxy")
 	}
 }
 
 func (ptr *QBarDataProxy) DestroyQBarDataProxy() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DestroyQBarDataProxy(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7827,7 +7862,7 @@ func (ptr *QBarDataProxy) DestroyQBarDataProxy() {
 func (ptr *QBarDataProxy) DestroyQBarDataProxyDefault() {
 	if ptr.Pointer() != nil {
 		C.QBarDataProxy_DestroyQBarDataProxyDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7841,14 +7876,14 @@ func (ptr *QBarDataProxy) Series() *QBar3DSeries {
 
 func (ptr *QBarDataProxy) ColumnLabels() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QBarDataProxy_ColumnLabels(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QBarDataProxy_ColumnLabels(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QBarDataProxy) RowLabels() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QBarDataProxy_RowLabels(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QBarDataProxy_RowLabels(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -7917,7 +7952,7 @@ func NewQCategory3DAxis(parent core.QObject_ITF) *QCategory3DAxis {
 
 //export callbackQCategory3DAxis_LabelsChanged
 func callbackQCategory3DAxis_LabelsChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelsChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7926,14 +7961,14 @@ func callbackQCategory3DAxis_LabelsChanged(ptr unsafe.Pointer) {
 func (ptr *QCategory3DAxis) ConnectLabelsChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCategory3DAxis_ConnectLabelsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelsChanged", f)
 	}
 }
 
 func (ptr *QCategory3DAxis) DisconnectLabelsChanged() {
 	if ptr.Pointer() != nil {
 		C.QCategory3DAxis_DisconnectLabelsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelsChanged")
 	}
 }
 
@@ -7945,7 +7980,7 @@ func (ptr *QCategory3DAxis) LabelsChanged() {
 
 func (ptr *QCategory3DAxis) SetLabels(labels []string) {
 	if ptr.Pointer() != nil {
-		var labelsC = C.CString(strings.Join(labels, "|"))
+		var labelsC = cGoPackStringList(labels)
 		defer C.free(unsafe.Pointer(labelsC))
 		C.QCategory3DAxis_SetLabels(ptr.Pointer(), labelsC)
 	}
@@ -7953,7 +7988,7 @@ func (ptr *QCategory3DAxis) SetLabels(labels []string) {
 
 //export callbackQCategory3DAxis_DestroyQCategory3DAxis
 func callbackQCategory3DAxis_DestroyQCategory3DAxis(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QCategory3DAxis"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QCategory3DAxis"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQCategory3DAxisFromPointer(ptr).DestroyQCategory3DAxisDefault()
@@ -7963,21 +7998,21 @@ func callbackQCategory3DAxis_DestroyQCategory3DAxis(ptr unsafe.Pointer) {
 func (ptr *QCategory3DAxis) ConnectDestroyQCategory3DAxis(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QCategory3DAxis", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QCategory3DAxis", f)
 	}
 }
 
 func (ptr *QCategory3DAxis) DisconnectDestroyQCategory3DAxis() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QCategory3DAxis")
+		qt.DisconnectSignal(ptr.Pointer(), "~QCategory3DAxis")
 	}
 }
 
 func (ptr *QCategory3DAxis) DestroyQCategory3DAxis() {
 	if ptr.Pointer() != nil {
 		C.QCategory3DAxis_DestroyQCategory3DAxis(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7985,14 +8020,14 @@ func (ptr *QCategory3DAxis) DestroyQCategory3DAxis() {
 func (ptr *QCategory3DAxis) DestroyQCategory3DAxisDefault() {
 	if ptr.Pointer() != nil {
 		C.QCategory3DAxis_DestroyQCategory3DAxisDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func (ptr *QCategory3DAxis) Labels() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QCategory3DAxis_Labels(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QCategory3DAxis_Labels(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -8055,7 +8090,7 @@ func (ptr *QCustom3DItem) Rotation() *gui.QQuaternion {
 
 //export callbackQCustom3DItem_MeshFileChanged
 func callbackQCustom3DItem_MeshFileChanged(ptr unsafe.Pointer, meshFile C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "meshFileChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "meshFileChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(meshFile))
 	}
 
@@ -8064,14 +8099,14 @@ func callbackQCustom3DItem_MeshFileChanged(ptr unsafe.Pointer, meshFile C.struct
 func (ptr *QCustom3DItem) ConnectMeshFileChanged(f func(meshFile string)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_ConnectMeshFileChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "meshFileChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "meshFileChanged", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectMeshFileChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DisconnectMeshFileChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "meshFileChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "meshFileChanged")
 	}
 }
 
@@ -8085,7 +8120,7 @@ func (ptr *QCustom3DItem) MeshFileChanged(meshFile string) {
 
 //export callbackQCustom3DItem_PositionAbsoluteChanged
 func callbackQCustom3DItem_PositionAbsoluteChanged(ptr unsafe.Pointer, positionAbsolute C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "positionAbsoluteChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "positionAbsoluteChanged"); signal != nil {
 		signal.(func(bool))(int8(positionAbsolute) != 0)
 	}
 
@@ -8094,14 +8129,14 @@ func callbackQCustom3DItem_PositionAbsoluteChanged(ptr unsafe.Pointer, positionA
 func (ptr *QCustom3DItem) ConnectPositionAbsoluteChanged(f func(positionAbsolute bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_ConnectPositionAbsoluteChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "positionAbsoluteChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "positionAbsoluteChanged", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectPositionAbsoluteChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DisconnectPositionAbsoluteChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "positionAbsoluteChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "positionAbsoluteChanged")
 	}
 }
 
@@ -8113,7 +8148,7 @@ func (ptr *QCustom3DItem) PositionAbsoluteChanged(positionAbsolute bool) {
 
 //export callbackQCustom3DItem_PositionChanged
 func callbackQCustom3DItem_PositionChanged(ptr unsafe.Pointer, position unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "positionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "positionChanged"); signal != nil {
 		signal.(func(*gui.QVector3D))(gui.NewQVector3DFromPointer(position))
 	}
 
@@ -8122,14 +8157,14 @@ func callbackQCustom3DItem_PositionChanged(ptr unsafe.Pointer, position unsafe.P
 func (ptr *QCustom3DItem) ConnectPositionChanged(f func(position *gui.QVector3D)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_ConnectPositionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "positionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "positionChanged", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectPositionChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DisconnectPositionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "positionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "positionChanged")
 	}
 }
 
@@ -8141,7 +8176,7 @@ func (ptr *QCustom3DItem) PositionChanged(position gui.QVector3D_ITF) {
 
 //export callbackQCustom3DItem_RotationChanged
 func callbackQCustom3DItem_RotationChanged(ptr unsafe.Pointer, rotation unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rotationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rotationChanged"); signal != nil {
 		signal.(func(*gui.QQuaternion))(gui.NewQQuaternionFromPointer(rotation))
 	}
 
@@ -8150,14 +8185,14 @@ func callbackQCustom3DItem_RotationChanged(ptr unsafe.Pointer, rotation unsafe.P
 func (ptr *QCustom3DItem) ConnectRotationChanged(f func(rotation *gui.QQuaternion)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_ConnectRotationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rotationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rotationChanged", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectRotationChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DisconnectRotationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rotationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rotationChanged")
 	}
 }
 
@@ -8169,7 +8204,7 @@ func (ptr *QCustom3DItem) RotationChanged(rotation gui.QQuaternion_ITF) {
 
 //export callbackQCustom3DItem_ScalingAbsoluteChanged
 func callbackQCustom3DItem_ScalingAbsoluteChanged(ptr unsafe.Pointer, scalingAbsolute C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scalingAbsoluteChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scalingAbsoluteChanged"); signal != nil {
 		signal.(func(bool))(int8(scalingAbsolute) != 0)
 	}
 
@@ -8178,14 +8213,14 @@ func callbackQCustom3DItem_ScalingAbsoluteChanged(ptr unsafe.Pointer, scalingAbs
 func (ptr *QCustom3DItem) ConnectScalingAbsoluteChanged(f func(scalingAbsolute bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_ConnectScalingAbsoluteChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "scalingAbsoluteChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "scalingAbsoluteChanged", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectScalingAbsoluteChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DisconnectScalingAbsoluteChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "scalingAbsoluteChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "scalingAbsoluteChanged")
 	}
 }
 
@@ -8197,7 +8232,7 @@ func (ptr *QCustom3DItem) ScalingAbsoluteChanged(scalingAbsolute bool) {
 
 //export callbackQCustom3DItem_ScalingChanged
 func callbackQCustom3DItem_ScalingChanged(ptr unsafe.Pointer, scaling unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scalingChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scalingChanged"); signal != nil {
 		signal.(func(*gui.QVector3D))(gui.NewQVector3DFromPointer(scaling))
 	}
 
@@ -8206,14 +8241,14 @@ func callbackQCustom3DItem_ScalingChanged(ptr unsafe.Pointer, scaling unsafe.Poi
 func (ptr *QCustom3DItem) ConnectScalingChanged(f func(scaling *gui.QVector3D)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_ConnectScalingChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "scalingChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "scalingChanged", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectScalingChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DisconnectScalingChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "scalingChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "scalingChanged")
 	}
 }
 
@@ -8295,7 +8330,7 @@ func (ptr *QCustom3DItem) SetVisible(visible bool) {
 
 //export callbackQCustom3DItem_ShadowCastingChanged
 func callbackQCustom3DItem_ShadowCastingChanged(ptr unsafe.Pointer, shadowCasting C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shadowCastingChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shadowCastingChanged"); signal != nil {
 		signal.(func(bool))(int8(shadowCasting) != 0)
 	}
 
@@ -8304,14 +8339,14 @@ func callbackQCustom3DItem_ShadowCastingChanged(ptr unsafe.Pointer, shadowCastin
 func (ptr *QCustom3DItem) ConnectShadowCastingChanged(f func(shadowCasting bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_ConnectShadowCastingChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shadowCastingChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "shadowCastingChanged", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectShadowCastingChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DisconnectShadowCastingChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shadowCastingChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "shadowCastingChanged")
 	}
 }
 
@@ -8323,7 +8358,7 @@ func (ptr *QCustom3DItem) ShadowCastingChanged(shadowCasting bool) {
 
 //export callbackQCustom3DItem_TextureFileChanged
 func callbackQCustom3DItem_TextureFileChanged(ptr unsafe.Pointer, textureFile C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureFileChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureFileChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(textureFile))
 	}
 
@@ -8332,14 +8367,14 @@ func callbackQCustom3DItem_TextureFileChanged(ptr unsafe.Pointer, textureFile C.
 func (ptr *QCustom3DItem) ConnectTextureFileChanged(f func(textureFile string)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_ConnectTextureFileChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureFileChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureFileChanged", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectTextureFileChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DisconnectTextureFileChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureFileChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureFileChanged")
 	}
 }
 
@@ -8353,7 +8388,7 @@ func (ptr *QCustom3DItem) TextureFileChanged(textureFile string) {
 
 //export callbackQCustom3DItem_VisibleChanged
 func callbackQCustom3DItem_VisibleChanged(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibleChanged"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	}
 
@@ -8362,14 +8397,14 @@ func callbackQCustom3DItem_VisibleChanged(ptr unsafe.Pointer, visible C.char) {
 func (ptr *QCustom3DItem) ConnectVisibleChanged(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_ConnectVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "visibleChanged", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DisconnectVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "visibleChanged")
 	}
 }
 
@@ -8381,7 +8416,7 @@ func (ptr *QCustom3DItem) VisibleChanged(visible bool) {
 
 //export callbackQCustom3DItem_DestroyQCustom3DItem
 func callbackQCustom3DItem_DestroyQCustom3DItem(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QCustom3DItem"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QCustom3DItem"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQCustom3DItemFromPointer(ptr).DestroyQCustom3DItemDefault()
@@ -8391,21 +8426,21 @@ func callbackQCustom3DItem_DestroyQCustom3DItem(ptr unsafe.Pointer) {
 func (ptr *QCustom3DItem) ConnectDestroyQCustom3DItem(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QCustom3DItem", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QCustom3DItem", f)
 	}
 }
 
 func (ptr *QCustom3DItem) DisconnectDestroyQCustom3DItem() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QCustom3DItem")
+		qt.DisconnectSignal(ptr.Pointer(), "~QCustom3DItem")
 	}
 }
 
 func (ptr *QCustom3DItem) DestroyQCustom3DItem() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DestroyQCustom3DItem(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8413,7 +8448,7 @@ func (ptr *QCustom3DItem) DestroyQCustom3DItem() {
 func (ptr *QCustom3DItem) DestroyQCustom3DItemDefault() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DItem_DestroyQCustom3DItemDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8527,7 +8562,7 @@ func NewQCustom3DLabel2(text string, font gui.QFont_ITF, position gui.QVector3D_
 
 //export callbackQCustom3DLabel_BackgroundColorChanged
 func callbackQCustom3DLabel_BackgroundColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "backgroundColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "backgroundColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -8536,14 +8571,14 @@ func callbackQCustom3DLabel_BackgroundColorChanged(ptr unsafe.Pointer, color uns
 func (ptr *QCustom3DLabel) ConnectBackgroundColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_ConnectBackgroundColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "backgroundColorChanged", f)
 	}
 }
 
 func (ptr *QCustom3DLabel) DisconnectBackgroundColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_DisconnectBackgroundColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "backgroundColorChanged")
 	}
 }
 
@@ -8555,7 +8590,7 @@ func (ptr *QCustom3DLabel) BackgroundColorChanged(color gui.QColor_ITF) {
 
 //export callbackQCustom3DLabel_BackgroundEnabledChanged
 func callbackQCustom3DLabel_BackgroundEnabledChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "backgroundEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "backgroundEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -8564,14 +8599,14 @@ func callbackQCustom3DLabel_BackgroundEnabledChanged(ptr unsafe.Pointer, enabled
 func (ptr *QCustom3DLabel) ConnectBackgroundEnabledChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_ConnectBackgroundEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "backgroundEnabledChanged", f)
 	}
 }
 
 func (ptr *QCustom3DLabel) DisconnectBackgroundEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_DisconnectBackgroundEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "backgroundEnabledChanged")
 	}
 }
 
@@ -8583,7 +8618,7 @@ func (ptr *QCustom3DLabel) BackgroundEnabledChanged(enabled bool) {
 
 //export callbackQCustom3DLabel_BorderEnabledChanged
 func callbackQCustom3DLabel_BorderEnabledChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "borderEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "borderEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -8592,14 +8627,14 @@ func callbackQCustom3DLabel_BorderEnabledChanged(ptr unsafe.Pointer, enabled C.c
 func (ptr *QCustom3DLabel) ConnectBorderEnabledChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_ConnectBorderEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "borderEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "borderEnabledChanged", f)
 	}
 }
 
 func (ptr *QCustom3DLabel) DisconnectBorderEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_DisconnectBorderEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "borderEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "borderEnabledChanged")
 	}
 }
 
@@ -8611,7 +8646,7 @@ func (ptr *QCustom3DLabel) BorderEnabledChanged(enabled bool) {
 
 //export callbackQCustom3DLabel_FacingCameraChanged
 func callbackQCustom3DLabel_FacingCameraChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "facingCameraChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "facingCameraChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -8620,14 +8655,14 @@ func callbackQCustom3DLabel_FacingCameraChanged(ptr unsafe.Pointer, enabled C.ch
 func (ptr *QCustom3DLabel) ConnectFacingCameraChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_ConnectFacingCameraChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "facingCameraChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "facingCameraChanged", f)
 	}
 }
 
 func (ptr *QCustom3DLabel) DisconnectFacingCameraChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_DisconnectFacingCameraChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "facingCameraChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "facingCameraChanged")
 	}
 }
 
@@ -8639,7 +8674,7 @@ func (ptr *QCustom3DLabel) FacingCameraChanged(enabled bool) {
 
 //export callbackQCustom3DLabel_FontChanged
 func callbackQCustom3DLabel_FontChanged(ptr unsafe.Pointer, font unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fontChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fontChanged"); signal != nil {
 		signal.(func(*gui.QFont))(gui.NewQFontFromPointer(font))
 	}
 
@@ -8648,14 +8683,14 @@ func callbackQCustom3DLabel_FontChanged(ptr unsafe.Pointer, font unsafe.Pointer)
 func (ptr *QCustom3DLabel) ConnectFontChanged(f func(font *gui.QFont)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_ConnectFontChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fontChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "fontChanged", f)
 	}
 }
 
 func (ptr *QCustom3DLabel) DisconnectFontChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_DisconnectFontChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fontChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "fontChanged")
 	}
 }
 
@@ -8711,7 +8746,7 @@ func (ptr *QCustom3DLabel) SetTextColor(color gui.QColor_ITF) {
 
 //export callbackQCustom3DLabel_TextChanged
 func callbackQCustom3DLabel_TextChanged(ptr unsafe.Pointer, text C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(text))
 	}
 
@@ -8720,14 +8755,14 @@ func callbackQCustom3DLabel_TextChanged(ptr unsafe.Pointer, text C.struct_QtData
 func (ptr *QCustom3DLabel) ConnectTextChanged(f func(text string)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_ConnectTextChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textChanged", f)
 	}
 }
 
 func (ptr *QCustom3DLabel) DisconnectTextChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_DisconnectTextChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textChanged")
 	}
 }
 
@@ -8741,7 +8776,7 @@ func (ptr *QCustom3DLabel) TextChanged(text string) {
 
 //export callbackQCustom3DLabel_TextColorChanged
 func callbackQCustom3DLabel_TextColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -8750,14 +8785,14 @@ func callbackQCustom3DLabel_TextColorChanged(ptr unsafe.Pointer, color unsafe.Po
 func (ptr *QCustom3DLabel) ConnectTextColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_ConnectTextColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textColorChanged", f)
 	}
 }
 
 func (ptr *QCustom3DLabel) DisconnectTextColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_DisconnectTextColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textColorChanged")
 	}
 }
 
@@ -8769,7 +8804,7 @@ func (ptr *QCustom3DLabel) TextColorChanged(color gui.QColor_ITF) {
 
 //export callbackQCustom3DLabel_DestroyQCustom3DLabel
 func callbackQCustom3DLabel_DestroyQCustom3DLabel(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QCustom3DLabel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QCustom3DLabel"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQCustom3DLabelFromPointer(ptr).DestroyQCustom3DLabelDefault()
@@ -8779,21 +8814,21 @@ func callbackQCustom3DLabel_DestroyQCustom3DLabel(ptr unsafe.Pointer) {
 func (ptr *QCustom3DLabel) ConnectDestroyQCustom3DLabel(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QCustom3DLabel", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QCustom3DLabel", f)
 	}
 }
 
 func (ptr *QCustom3DLabel) DisconnectDestroyQCustom3DLabel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QCustom3DLabel")
+		qt.DisconnectSignal(ptr.Pointer(), "~QCustom3DLabel")
 	}
 }
 
 func (ptr *QCustom3DLabel) DestroyQCustom3DLabel() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_DestroyQCustom3DLabel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8801,7 +8836,7 @@ func (ptr *QCustom3DLabel) DestroyQCustom3DLabel() {
 func (ptr *QCustom3DLabel) DestroyQCustom3DLabelDefault() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DLabel_DestroyQCustom3DLabelDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8913,7 +8948,7 @@ func (ptr *QCustom3DVolume) RenderSlice(axis core.Qt__Axis, index int) *gui.QIma
 
 //export callbackQCustom3DVolume_AlphaMultiplierChanged
 func callbackQCustom3DVolume_AlphaMultiplierChanged(ptr unsafe.Pointer, mult C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "alphaMultiplierChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "alphaMultiplierChanged"); signal != nil {
 		signal.(func(float32))(float32(mult))
 	}
 
@@ -8922,14 +8957,14 @@ func callbackQCustom3DVolume_AlphaMultiplierChanged(ptr unsafe.Pointer, mult C.f
 func (ptr *QCustom3DVolume) ConnectAlphaMultiplierChanged(f func(mult float32)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectAlphaMultiplierChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "alphaMultiplierChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "alphaMultiplierChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectAlphaMultiplierChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectAlphaMultiplierChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "alphaMultiplierChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "alphaMultiplierChanged")
 	}
 }
 
@@ -8941,7 +8976,7 @@ func (ptr *QCustom3DVolume) AlphaMultiplierChanged(mult float32) {
 
 //export callbackQCustom3DVolume_ColorTableChanged
 func callbackQCustom3DVolume_ColorTableChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorTableChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorTableChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8950,14 +8985,14 @@ func callbackQCustom3DVolume_ColorTableChanged(ptr unsafe.Pointer) {
 func (ptr *QCustom3DVolume) ConnectColorTableChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectColorTableChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorTableChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorTableChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectColorTableChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectColorTableChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorTableChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorTableChanged")
 	}
 }
 
@@ -8969,7 +9004,7 @@ func (ptr *QCustom3DVolume) ColorTableChanged() {
 
 //export callbackQCustom3DVolume_DrawSliceFramesChanged
 func callbackQCustom3DVolume_DrawSliceFramesChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawSliceFramesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawSliceFramesChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -8978,14 +9013,14 @@ func callbackQCustom3DVolume_DrawSliceFramesChanged(ptr unsafe.Pointer, enabled
 func (ptr *QCustom3DVolume) ConnectDrawSliceFramesChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectDrawSliceFramesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawSliceFramesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawSliceFramesChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectDrawSliceFramesChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectDrawSliceFramesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawSliceFramesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "drawSliceFramesChanged")
 	}
 }
 
@@ -8997,7 +9032,7 @@ func (ptr *QCustom3DVolume) DrawSliceFramesChanged(enabled bool) {
 
 //export callbackQCustom3DVolume_DrawSlicesChanged
 func callbackQCustom3DVolume_DrawSlicesChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawSlicesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawSlicesChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -9006,14 +9041,14 @@ func callbackQCustom3DVolume_DrawSlicesChanged(ptr unsafe.Pointer, enabled C.cha
 func (ptr *QCustom3DVolume) ConnectDrawSlicesChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectDrawSlicesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawSlicesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawSlicesChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectDrawSlicesChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectDrawSlicesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawSlicesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "drawSlicesChanged")
 	}
 }
 
@@ -9025,7 +9060,7 @@ func (ptr *QCustom3DVolume) DrawSlicesChanged(enabled bool) {
 
 //export callbackQCustom3DVolume_PreserveOpacityChanged
 func callbackQCustom3DVolume_PreserveOpacityChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "preserveOpacityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "preserveOpacityChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -9034,14 +9069,14 @@ func callbackQCustom3DVolume_PreserveOpacityChanged(ptr unsafe.Pointer, enabled
 func (ptr *QCustom3DVolume) ConnectPreserveOpacityChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectPreserveOpacityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "preserveOpacityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "preserveOpacityChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectPreserveOpacityChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectPreserveOpacityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "preserveOpacityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "preserveOpacityChanged")
 	}
 }
 
@@ -9175,7 +9210,7 @@ func (ptr *QCustom3DVolume) SetUseHighDefShader(enable bool) {
 
 //export callbackQCustom3DVolume_SliceFrameColorChanged
 func callbackQCustom3DVolume_SliceFrameColorChanged(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sliceFrameColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sliceFrameColorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -9184,14 +9219,14 @@ func callbackQCustom3DVolume_SliceFrameColorChanged(ptr unsafe.Pointer, color un
 func (ptr *QCustom3DVolume) ConnectSliceFrameColorChanged(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectSliceFrameColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sliceFrameColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sliceFrameColorChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectSliceFrameColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectSliceFrameColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sliceFrameColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sliceFrameColorChanged")
 	}
 }
 
@@ -9203,7 +9238,7 @@ func (ptr *QCustom3DVolume) SliceFrameColorChanged(color gui.QColor_ITF) {
 
 //export callbackQCustom3DVolume_SliceFrameGapsChanged
 func callbackQCustom3DVolume_SliceFrameGapsChanged(ptr unsafe.Pointer, values unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sliceFrameGapsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sliceFrameGapsChanged"); signal != nil {
 		signal.(func(*gui.QVector3D))(gui.NewQVector3DFromPointer(values))
 	}
 
@@ -9212,14 +9247,14 @@ func callbackQCustom3DVolume_SliceFrameGapsChanged(ptr unsafe.Pointer, values un
 func (ptr *QCustom3DVolume) ConnectSliceFrameGapsChanged(f func(values *gui.QVector3D)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectSliceFrameGapsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sliceFrameGapsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sliceFrameGapsChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectSliceFrameGapsChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectSliceFrameGapsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sliceFrameGapsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sliceFrameGapsChanged")
 	}
 }
 
@@ -9231,7 +9266,7 @@ func (ptr *QCustom3DVolume) SliceFrameGapsChanged(values gui.QVector3D_ITF) {
 
 //export callbackQCustom3DVolume_SliceFrameThicknessesChanged
 func callbackQCustom3DVolume_SliceFrameThicknessesChanged(ptr unsafe.Pointer, values unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sliceFrameThicknessesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sliceFrameThicknessesChanged"); signal != nil {
 		signal.(func(*gui.QVector3D))(gui.NewQVector3DFromPointer(values))
 	}
 
@@ -9240,14 +9275,14 @@ func callbackQCustom3DVolume_SliceFrameThicknessesChanged(ptr unsafe.Pointer, va
 func (ptr *QCustom3DVolume) ConnectSliceFrameThicknessesChanged(f func(values *gui.QVector3D)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectSliceFrameThicknessesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sliceFrameThicknessesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sliceFrameThicknessesChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectSliceFrameThicknessesChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectSliceFrameThicknessesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sliceFrameThicknessesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sliceFrameThicknessesChanged")
 	}
 }
 
@@ -9259,7 +9294,7 @@ func (ptr *QCustom3DVolume) SliceFrameThicknessesChanged(values gui.QVector3D_IT
 
 //export callbackQCustom3DVolume_SliceFrameWidthsChanged
 func callbackQCustom3DVolume_SliceFrameWidthsChanged(ptr unsafe.Pointer, values unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sliceFrameWidthsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sliceFrameWidthsChanged"); signal != nil {
 		signal.(func(*gui.QVector3D))(gui.NewQVector3DFromPointer(values))
 	}
 
@@ -9268,14 +9303,14 @@ func callbackQCustom3DVolume_SliceFrameWidthsChanged(ptr unsafe.Pointer, values
 func (ptr *QCustom3DVolume) ConnectSliceFrameWidthsChanged(f func(values *gui.QVector3D)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectSliceFrameWidthsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sliceFrameWidthsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sliceFrameWidthsChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectSliceFrameWidthsChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectSliceFrameWidthsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sliceFrameWidthsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sliceFrameWidthsChanged")
 	}
 }
 
@@ -9287,7 +9322,7 @@ func (ptr *QCustom3DVolume) SliceFrameWidthsChanged(values gui.QVector3D_ITF) {
 
 //export callbackQCustom3DVolume_SliceIndexXChanged
 func callbackQCustom3DVolume_SliceIndexXChanged(ptr unsafe.Pointer, value C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sliceIndexXChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sliceIndexXChanged"); signal != nil {
 		signal.(func(int))(int(int32(value)))
 	}
 
@@ -9296,14 +9331,14 @@ func callbackQCustom3DVolume_SliceIndexXChanged(ptr unsafe.Pointer, value C.int)
 func (ptr *QCustom3DVolume) ConnectSliceIndexXChanged(f func(value int)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectSliceIndexXChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sliceIndexXChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sliceIndexXChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectSliceIndexXChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectSliceIndexXChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sliceIndexXChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sliceIndexXChanged")
 	}
 }
 
@@ -9315,7 +9350,7 @@ func (ptr *QCustom3DVolume) SliceIndexXChanged(value int) {
 
 //export callbackQCustom3DVolume_SliceIndexYChanged
 func callbackQCustom3DVolume_SliceIndexYChanged(ptr unsafe.Pointer, value C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sliceIndexYChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sliceIndexYChanged"); signal != nil {
 		signal.(func(int))(int(int32(value)))
 	}
 
@@ -9324,14 +9359,14 @@ func callbackQCustom3DVolume_SliceIndexYChanged(ptr unsafe.Pointer, value C.int)
 func (ptr *QCustom3DVolume) ConnectSliceIndexYChanged(f func(value int)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectSliceIndexYChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sliceIndexYChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sliceIndexYChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectSliceIndexYChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectSliceIndexYChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sliceIndexYChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sliceIndexYChanged")
 	}
 }
 
@@ -9343,7 +9378,7 @@ func (ptr *QCustom3DVolume) SliceIndexYChanged(value int) {
 
 //export callbackQCustom3DVolume_SliceIndexZChanged
 func callbackQCustom3DVolume_SliceIndexZChanged(ptr unsafe.Pointer, value C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sliceIndexZChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sliceIndexZChanged"); signal != nil {
 		signal.(func(int))(int(int32(value)))
 	}
 
@@ -9352,14 +9387,14 @@ func callbackQCustom3DVolume_SliceIndexZChanged(ptr unsafe.Pointer, value C.int)
 func (ptr *QCustom3DVolume) ConnectSliceIndexZChanged(f func(value int)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectSliceIndexZChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sliceIndexZChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sliceIndexZChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectSliceIndexZChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectSliceIndexZChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sliceIndexZChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sliceIndexZChanged")
 	}
 }
 
@@ -9371,7 +9406,7 @@ func (ptr *QCustom3DVolume) SliceIndexZChanged(value int) {
 
 //export callbackQCustom3DVolume_TextureDepthChanged
 func callbackQCustom3DVolume_TextureDepthChanged(ptr unsafe.Pointer, value C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureDepthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureDepthChanged"); signal != nil {
 		signal.(func(int))(int(int32(value)))
 	}
 
@@ -9380,14 +9415,14 @@ func callbackQCustom3DVolume_TextureDepthChanged(ptr unsafe.Pointer, value C.int
 func (ptr *QCustom3DVolume) ConnectTextureDepthChanged(f func(value int)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectTextureDepthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureDepthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureDepthChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectTextureDepthChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectTextureDepthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureDepthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureDepthChanged")
 	}
 }
 
@@ -9399,7 +9434,7 @@ func (ptr *QCustom3DVolume) TextureDepthChanged(value int) {
 
 //export callbackQCustom3DVolume_TextureFormatChanged
 func callbackQCustom3DVolume_TextureFormatChanged(ptr unsafe.Pointer, format C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureFormatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureFormatChanged"); signal != nil {
 		signal.(func(gui.QImage__Format))(gui.QImage__Format(format))
 	}
 
@@ -9408,14 +9443,14 @@ func callbackQCustom3DVolume_TextureFormatChanged(ptr unsafe.Pointer, format C.l
 func (ptr *QCustom3DVolume) ConnectTextureFormatChanged(f func(format gui.QImage__Format)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectTextureFormatChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureFormatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureFormatChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectTextureFormatChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectTextureFormatChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureFormatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureFormatChanged")
 	}
 }
 
@@ -9427,7 +9462,7 @@ func (ptr *QCustom3DVolume) TextureFormatChanged(format gui.QImage__Format) {
 
 //export callbackQCustom3DVolume_TextureHeightChanged
 func callbackQCustom3DVolume_TextureHeightChanged(ptr unsafe.Pointer, value C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureHeightChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureHeightChanged"); signal != nil {
 		signal.(func(int))(int(int32(value)))
 	}
 
@@ -9436,14 +9471,14 @@ func callbackQCustom3DVolume_TextureHeightChanged(ptr unsafe.Pointer, value C.in
 func (ptr *QCustom3DVolume) ConnectTextureHeightChanged(f func(value int)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectTextureHeightChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureHeightChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureHeightChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectTextureHeightChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectTextureHeightChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureHeightChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureHeightChanged")
 	}
 }
 
@@ -9455,7 +9490,7 @@ func (ptr *QCustom3DVolume) TextureHeightChanged(value int) {
 
 //export callbackQCustom3DVolume_TextureWidthChanged
 func callbackQCustom3DVolume_TextureWidthChanged(ptr unsafe.Pointer, value C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureWidthChanged"); signal != nil {
 		signal.(func(int))(int(int32(value)))
 	}
 
@@ -9464,14 +9499,14 @@ func callbackQCustom3DVolume_TextureWidthChanged(ptr unsafe.Pointer, value C.int
 func (ptr *QCustom3DVolume) ConnectTextureWidthChanged(f func(value int)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectTextureWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureWidthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureWidthChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectTextureWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectTextureWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureWidthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureWidthChanged")
 	}
 }
 
@@ -9483,7 +9518,7 @@ func (ptr *QCustom3DVolume) TextureWidthChanged(value int) {
 
 //export callbackQCustom3DVolume_UseHighDefShaderChanged
 func callbackQCustom3DVolume_UseHighDefShaderChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "useHighDefShaderChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "useHighDefShaderChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -9492,14 +9527,14 @@ func callbackQCustom3DVolume_UseHighDefShaderChanged(ptr unsafe.Pointer, enabled
 func (ptr *QCustom3DVolume) ConnectUseHighDefShaderChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_ConnectUseHighDefShaderChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "useHighDefShaderChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "useHighDefShaderChanged", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectUseHighDefShaderChanged() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DisconnectUseHighDefShaderChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "useHighDefShaderChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "useHighDefShaderChanged")
 	}
 }
 
@@ -9511,7 +9546,7 @@ func (ptr *QCustom3DVolume) UseHighDefShaderChanged(enabled bool) {
 
 //export callbackQCustom3DVolume_DestroyQCustom3DVolume
 func callbackQCustom3DVolume_DestroyQCustom3DVolume(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QCustom3DVolume"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QCustom3DVolume"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQCustom3DVolumeFromPointer(ptr).DestroyQCustom3DVolumeDefault()
@@ -9521,21 +9556,21 @@ func callbackQCustom3DVolume_DestroyQCustom3DVolume(ptr unsafe.Pointer) {
 func (ptr *QCustom3DVolume) ConnectDestroyQCustom3DVolume(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QCustom3DVolume", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QCustom3DVolume", f)
 	}
 }
 
 func (ptr *QCustom3DVolume) DisconnectDestroyQCustom3DVolume() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QCustom3DVolume")
+		qt.DisconnectSignal(ptr.Pointer(), "~QCustom3DVolume")
 	}
 }
 
 func (ptr *QCustom3DVolume) DestroyQCustom3DVolume() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DestroyQCustom3DVolume(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9543,7 +9578,7 @@ func (ptr *QCustom3DVolume) DestroyQCustom3DVolume() {
 func (ptr *QCustom3DVolume) DestroyQCustom3DVolumeDefault() {
 	if ptr.Pointer() != nil {
 		C.QCustom3DVolume_DestroyQCustom3DVolumeDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9733,7 +9768,7 @@ func NewQHeightMapSurfaceDataProxy3(filename string, parent core.QObject_ITF) *Q
 
 //export callbackQHeightMapSurfaceDataProxy_HeightMapChanged
 func callbackQHeightMapSurfaceDataProxy_HeightMapChanged(ptr unsafe.Pointer, image unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightMapChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightMapChanged"); signal != nil {
 		signal.(func(*gui.QImage))(gui.NewQImageFromPointer(image))
 	}
 
@@ -9742,14 +9777,14 @@ func callbackQHeightMapSurfaceDataProxy_HeightMapChanged(ptr unsafe.Pointer, ima
 func (ptr *QHeightMapSurfaceDataProxy) ConnectHeightMapChanged(f func(image *gui.QImage)) {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_ConnectHeightMapChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "heightMapChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "heightMapChanged", f)
 	}
 }
 
 func (ptr *QHeightMapSurfaceDataProxy) DisconnectHeightMapChanged() {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_DisconnectHeightMapChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "heightMapChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "heightMapChanged")
 	}
 }
 
@@ -9761,7 +9796,7 @@ func (ptr *QHeightMapSurfaceDataProxy) HeightMapChanged(image gui.QImage_ITF) {
 
 //export callbackQHeightMapSurfaceDataProxy_HeightMapFileChanged
 func callbackQHeightMapSurfaceDataProxy_HeightMapFileChanged(ptr unsafe.Pointer, filename C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightMapFileChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightMapFileChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(filename))
 	}
 
@@ -9770,14 +9805,14 @@ func callbackQHeightMapSurfaceDataProxy_HeightMapFileChanged(ptr unsafe.Pointer,
 func (ptr *QHeightMapSurfaceDataProxy) ConnectHeightMapFileChanged(f func(filename string)) {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_ConnectHeightMapFileChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "heightMapFileChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "heightMapFileChanged", f)
 	}
 }
 
 func (ptr *QHeightMapSurfaceDataProxy) DisconnectHeightMapFileChanged() {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_DisconnectHeightMapFileChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "heightMapFileChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "heightMapFileChanged")
 	}
 }
 
@@ -9791,7 +9826,7 @@ func (ptr *QHeightMapSurfaceDataProxy) HeightMapFileChanged(filename string) {
 
 //export callbackQHeightMapSurfaceDataProxy_MaxXValueChanged
 func callbackQHeightMapSurfaceDataProxy_MaxXValueChanged(ptr unsafe.Pointer, value C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maxXValueChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maxXValueChanged"); signal != nil {
 		signal.(func(float32))(float32(value))
 	}
 
@@ -9800,14 +9835,14 @@ func callbackQHeightMapSurfaceDataProxy_MaxXValueChanged(ptr unsafe.Pointer, val
 func (ptr *QHeightMapSurfaceDataProxy) ConnectMaxXValueChanged(f func(value float32)) {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_ConnectMaxXValueChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maxXValueChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maxXValueChanged", f)
 	}
 }
 
 func (ptr *QHeightMapSurfaceDataProxy) DisconnectMaxXValueChanged() {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_DisconnectMaxXValueChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maxXValueChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maxXValueChanged")
 	}
 }
 
@@ -9819,7 +9854,7 @@ func (ptr *QHeightMapSurfaceDataProxy) MaxXValueChanged(value float32) {
 
 //export callbackQHeightMapSurfaceDataProxy_MaxZValueChanged
 func callbackQHeightMapSurfaceDataProxy_MaxZValueChanged(ptr unsafe.Pointer, value C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maxZValueChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maxZValueChanged"); signal != nil {
 		signal.(func(float32))(float32(value))
 	}
 
@@ -9828,14 +9863,14 @@ func callbackQHeightMapSurfaceDataProxy_MaxZValueChanged(ptr unsafe.Pointer, val
 func (ptr *QHeightMapSurfaceDataProxy) ConnectMaxZValueChanged(f func(value float32)) {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_ConnectMaxZValueChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maxZValueChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maxZValueChanged", f)
 	}
 }
 
 func (ptr *QHeightMapSurfaceDataProxy) DisconnectMaxZValueChanged() {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_DisconnectMaxZValueChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maxZValueChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maxZValueChanged")
 	}
 }
 
@@ -9847,7 +9882,7 @@ func (ptr *QHeightMapSurfaceDataProxy) MaxZValueChanged(value float32) {
 
 //export callbackQHeightMapSurfaceDataProxy_MinXValueChanged
 func callbackQHeightMapSurfaceDataProxy_MinXValueChanged(ptr unsafe.Pointer, value C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minXValueChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minXValueChanged"); signal != nil {
 		signal.(func(float32))(float32(value))
 	}
 
@@ -9856,14 +9891,14 @@ func callbackQHeightMapSurfaceDataProxy_MinXValueChanged(ptr unsafe.Pointer, val
 func (ptr *QHeightMapSurfaceDataProxy) ConnectMinXValueChanged(f func(value float32)) {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_ConnectMinXValueChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minXValueChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minXValueChanged", f)
 	}
 }
 
 func (ptr *QHeightMapSurfaceDataProxy) DisconnectMinXValueChanged() {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_DisconnectMinXValueChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minXValueChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minXValueChanged")
 	}
 }
 
@@ -9875,7 +9910,7 @@ func (ptr *QHeightMapSurfaceDataProxy) MinXValueChanged(value float32) {
 
 //export callbackQHeightMapSurfaceDataProxy_MinZValueChanged
 func callbackQHeightMapSurfaceDataProxy_MinZValueChanged(ptr unsafe.Pointer, value C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minZValueChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minZValueChanged"); signal != nil {
 		signal.(func(float32))(float32(value))
 	}
 
@@ -9884,14 +9919,14 @@ func callbackQHeightMapSurfaceDataProxy_MinZValueChanged(ptr unsafe.Pointer, val
 func (ptr *QHeightMapSurfaceDataProxy) ConnectMinZValueChanged(f func(value float32)) {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_ConnectMinZValueChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minZValueChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minZValueChanged", f)
 	}
 }
 
 func (ptr *QHeightMapSurfaceDataProxy) DisconnectMinZValueChanged() {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_DisconnectMinZValueChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minZValueChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minZValueChanged")
 	}
 }
 
@@ -9947,7 +9982,7 @@ func (ptr *QHeightMapSurfaceDataProxy) SetValueRanges(minX float32, maxX float32
 
 //export callbackQHeightMapSurfaceDataProxy_DestroyQHeightMapSurfaceDataProxy
 func callbackQHeightMapSurfaceDataProxy_DestroyQHeightMapSurfaceDataProxy(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QHeightMapSurfaceDataProxy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QHeightMapSurfaceDataProxy"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHeightMapSurfaceDataProxyFromPointer(ptr).DestroyQHeightMapSurfaceDataProxyDefault()
@@ -9957,21 +9992,21 @@ func callbackQHeightMapSurfaceDataProxy_DestroyQHeightMapSurfaceDataProxy(ptr un
 func (ptr *QHeightMapSurfaceDataProxy) ConnectDestroyQHeightMapSurfaceDataProxy(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QHeightMapSurfaceDataProxy", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QHeightMapSurfaceDataProxy", f)
 	}
 }
 
 func (ptr *QHeightMapSurfaceDataProxy) DisconnectDestroyQHeightMapSurfaceDataProxy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QHeightMapSurfaceDataProxy")
+		qt.DisconnectSignal(ptr.Pointer(), "~QHeightMapSurfaceDataProxy")
 	}
 }
 
 func (ptr *QHeightMapSurfaceDataProxy) DestroyQHeightMapSurfaceDataProxy() {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_DestroyQHeightMapSurfaceDataProxy(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9979,7 +10014,7 @@ func (ptr *QHeightMapSurfaceDataProxy) DestroyQHeightMapSurfaceDataProxy() {
 func (ptr *QHeightMapSurfaceDataProxy) DestroyQHeightMapSurfaceDataProxyDefault() {
 	if ptr.Pointer() != nil {
 		C.QHeightMapSurfaceDataProxy_DestroyQHeightMapSurfaceDataProxyDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10112,9 +10147,9 @@ func NewQItemModelBarDataProxy7(itemModel core.QAbstractItemModel_ITF, rowRole s
 	defer C.free(unsafe.Pointer(valueRoleC))
 	var rotationRoleC = C.CString(rotationRole)
 	defer C.free(unsafe.Pointer(rotationRoleC))
-	var rowCategoriesC = C.CString(strings.Join(rowCategories, "|"))
+	var rowCategoriesC = cGoPackStringList(rowCategories)
 	defer C.free(unsafe.Pointer(rowCategoriesC))
-	var columnCategoriesC = C.CString(strings.Join(columnCategories, "|"))
+	var columnCategoriesC = cGoPackStringList(columnCategories)
 	defer C.free(unsafe.Pointer(columnCategoriesC))
 	return NewQItemModelBarDataProxyFromPointer(C.QItemModelBarDataProxy_NewQItemModelBarDataProxy7(core.PointerFromQAbstractItemModel(itemModel), rowRoleC, columnRoleC, valueRoleC, rotationRoleC, rowCategoriesC, columnCategoriesC, core.PointerFromQObject(parent)))
 }
@@ -10126,9 +10161,9 @@ func NewQItemModelBarDataProxy6(itemModel core.QAbstractItemModel_ITF, rowRole s
 	defer C.free(unsafe.Pointer(columnRoleC))
 	var valueRoleC = C.CString(valueRole)
 	defer C.free(unsafe.Pointer(valueRoleC))
-	var rowCategoriesC = C.CString(strings.Join(rowCategories, "|"))
+	var rowCategoriesC = cGoPackStringList(rowCategories)
 	defer C.free(unsafe.Pointer(rowCategoriesC))
-	var columnCategoriesC = C.CString(strings.Join(columnCategories, "|"))
+	var columnCategoriesC = cGoPackStringList(columnCategories)
 	defer C.free(unsafe.Pointer(columnCategoriesC))
 	return NewQItemModelBarDataProxyFromPointer(C.QItemModelBarDataProxy_NewQItemModelBarDataProxy6(core.PointerFromQAbstractItemModel(itemModel), rowRoleC, columnRoleC, valueRoleC, rowCategoriesC, columnCategoriesC, core.PointerFromQObject(parent)))
 }
@@ -10163,7 +10198,7 @@ func (ptr *QItemModelBarDataProxy) RowCategoryIndex(category string) int {
 
 //export callbackQItemModelBarDataProxy_AutoColumnCategoriesChanged
 func callbackQItemModelBarDataProxy_AutoColumnCategoriesChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "autoColumnCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "autoColumnCategoriesChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -10172,14 +10207,14 @@ func callbackQItemModelBarDataProxy_AutoColumnCategoriesChanged(ptr unsafe.Point
 func (ptr *QItemModelBarDataProxy) ConnectAutoColumnCategoriesChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectAutoColumnCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "autoColumnCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "autoColumnCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectAutoColumnCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectAutoColumnCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "autoColumnCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "autoColumnCategoriesChanged")
 	}
 }
 
@@ -10191,7 +10226,7 @@ func (ptr *QItemModelBarDataProxy) AutoColumnCategoriesChanged(enable bool) {
 
 //export callbackQItemModelBarDataProxy_AutoRowCategoriesChanged
 func callbackQItemModelBarDataProxy_AutoRowCategoriesChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "autoRowCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "autoRowCategoriesChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -10200,14 +10235,14 @@ func callbackQItemModelBarDataProxy_AutoRowCategoriesChanged(ptr unsafe.Pointer,
 func (ptr *QItemModelBarDataProxy) ConnectAutoRowCategoriesChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectAutoRowCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "autoRowCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "autoRowCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectAutoRowCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectAutoRowCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "autoRowCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "autoRowCategoriesChanged")
 	}
 }
 
@@ -10219,7 +10254,7 @@ func (ptr *QItemModelBarDataProxy) AutoRowCategoriesChanged(enable bool) {
 
 //export callbackQItemModelBarDataProxy_ColumnCategoriesChanged
 func callbackQItemModelBarDataProxy_ColumnCategoriesChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCategoriesChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10228,14 +10263,14 @@ func callbackQItemModelBarDataProxy_ColumnCategoriesChanged(ptr unsafe.Pointer)
 func (ptr *QItemModelBarDataProxy) ConnectColumnCategoriesChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectColumnCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectColumnCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectColumnCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCategoriesChanged")
 	}
 }
 
@@ -10247,7 +10282,7 @@ func (ptr *QItemModelBarDataProxy) ColumnCategoriesChanged() {
 
 //export callbackQItemModelBarDataProxy_ColumnRoleChanged
 func callbackQItemModelBarDataProxy_ColumnRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -10256,14 +10291,14 @@ func callbackQItemModelBarDataProxy_ColumnRoleChanged(ptr unsafe.Pointer, role C
 func (ptr *QItemModelBarDataProxy) ConnectColumnRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectColumnRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectColumnRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectColumnRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnRoleChanged")
 	}
 }
 
@@ -10277,7 +10312,7 @@ func (ptr *QItemModelBarDataProxy) ColumnRoleChanged(role string) {
 
 //export callbackQItemModelBarDataProxy_ColumnRolePatternChanged
 func callbackQItemModelBarDataProxy_ColumnRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -10286,14 +10321,14 @@ func callbackQItemModelBarDataProxy_ColumnRolePatternChanged(ptr unsafe.Pointer,
 func (ptr *QItemModelBarDataProxy) ConnectColumnRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectColumnRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectColumnRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectColumnRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnRolePatternChanged")
 	}
 }
 
@@ -10305,7 +10340,7 @@ func (ptr *QItemModelBarDataProxy) ColumnRolePatternChanged(pattern core.QRegExp
 
 //export callbackQItemModelBarDataProxy_ColumnRoleReplaceChanged
 func callbackQItemModelBarDataProxy_ColumnRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -10314,14 +10349,14 @@ func callbackQItemModelBarDataProxy_ColumnRoleReplaceChanged(ptr unsafe.Pointer,
 func (ptr *QItemModelBarDataProxy) ConnectColumnRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectColumnRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectColumnRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectColumnRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnRoleReplaceChanged")
 	}
 }
 
@@ -10335,7 +10370,7 @@ func (ptr *QItemModelBarDataProxy) ColumnRoleReplaceChanged(replace string) {
 
 //export callbackQItemModelBarDataProxy_ItemModelChanged
 func callbackQItemModelBarDataProxy_ItemModelChanged(ptr unsafe.Pointer, itemModel unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemModelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemModelChanged"); signal != nil {
 		signal.(func(*core.QAbstractItemModel))(core.NewQAbstractItemModelFromPointer(itemModel))
 	}
 
@@ -10344,14 +10379,14 @@ func callbackQItemModelBarDataProxy_ItemModelChanged(ptr unsafe.Pointer, itemMod
 func (ptr *QItemModelBarDataProxy) ConnectItemModelChanged(f func(itemModel *core.QAbstractItemModel)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectItemModelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemModelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemModelChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectItemModelChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectItemModelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemModelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemModelChanged")
 	}
 }
 
@@ -10363,7 +10398,7 @@ func (ptr *QItemModelBarDataProxy) ItemModelChanged(itemModel core.QAbstractItem
 
 //export callbackQItemModelBarDataProxy_MultiMatchBehaviorChanged
 func callbackQItemModelBarDataProxy_MultiMatchBehaviorChanged(ptr unsafe.Pointer, behavior C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "multiMatchBehaviorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "multiMatchBehaviorChanged"); signal != nil {
 		signal.(func(QItemModelBarDataProxy__MultiMatchBehavior))(QItemModelBarDataProxy__MultiMatchBehavior(behavior))
 	}
 
@@ -10372,14 +10407,14 @@ func callbackQItemModelBarDataProxy_MultiMatchBehaviorChanged(ptr unsafe.Pointer
 func (ptr *QItemModelBarDataProxy) ConnectMultiMatchBehaviorChanged(f func(behavior QItemModelBarDataProxy__MultiMatchBehavior)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectMultiMatchBehaviorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "multiMatchBehaviorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "multiMatchBehaviorChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectMultiMatchBehaviorChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectMultiMatchBehaviorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "multiMatchBehaviorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "multiMatchBehaviorChanged")
 	}
 }
 
@@ -10399,9 +10434,9 @@ func (ptr *QItemModelBarDataProxy) Remap(rowRole string, columnRole string, valu
 		defer C.free(unsafe.Pointer(valueRoleC))
 		var rotationRoleC = C.CString(rotationRole)
 		defer C.free(unsafe.Pointer(rotationRoleC))
-		var rowCategoriesC = C.CString(strings.Join(rowCategories, "|"))
+		var rowCategoriesC = cGoPackStringList(rowCategories)
 		defer C.free(unsafe.Pointer(rowCategoriesC))
-		var columnCategoriesC = C.CString(strings.Join(columnCategories, "|"))
+		var columnCategoriesC = cGoPackStringList(columnCategories)
 		defer C.free(unsafe.Pointer(columnCategoriesC))
 		C.QItemModelBarDataProxy_Remap(ptr.Pointer(), rowRoleC, columnRoleC, valueRoleC, rotationRoleC, rowCategoriesC, columnCategoriesC)
 	}
@@ -10409,7 +10444,7 @@ func (ptr *QItemModelBarDataProxy) Remap(rowRole string, columnRole string, valu
 
 //export callbackQItemModelBarDataProxy_RotationRoleChanged
 func callbackQItemModelBarDataProxy_RotationRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rotationRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rotationRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -10418,14 +10453,14 @@ func callbackQItemModelBarDataProxy_RotationRoleChanged(ptr unsafe.Pointer, role
 func (ptr *QItemModelBarDataProxy) ConnectRotationRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectRotationRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rotationRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectRotationRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectRotationRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rotationRoleChanged")
 	}
 }
 
@@ -10439,7 +10474,7 @@ func (ptr *QItemModelBarDataProxy) RotationRoleChanged(role string) {
 
 //export callbackQItemModelBarDataProxy_RotationRolePatternChanged
 func callbackQItemModelBarDataProxy_RotationRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rotationRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rotationRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -10448,14 +10483,14 @@ func callbackQItemModelBarDataProxy_RotationRolePatternChanged(ptr unsafe.Pointe
 func (ptr *QItemModelBarDataProxy) ConnectRotationRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectRotationRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rotationRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectRotationRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectRotationRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rotationRolePatternChanged")
 	}
 }
 
@@ -10467,7 +10502,7 @@ func (ptr *QItemModelBarDataProxy) RotationRolePatternChanged(pattern core.QRegE
 
 //export callbackQItemModelBarDataProxy_RotationRoleReplaceChanged
 func callbackQItemModelBarDataProxy_RotationRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rotationRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rotationRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -10476,14 +10511,14 @@ func callbackQItemModelBarDataProxy_RotationRoleReplaceChanged(ptr unsafe.Pointe
 func (ptr *QItemModelBarDataProxy) ConnectRotationRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectRotationRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rotationRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectRotationRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectRotationRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rotationRoleReplaceChanged")
 	}
 }
 
@@ -10497,7 +10532,7 @@ func (ptr *QItemModelBarDataProxy) RotationRoleReplaceChanged(replace string) {
 
 //export callbackQItemModelBarDataProxy_RowCategoriesChanged
 func callbackQItemModelBarDataProxy_RowCategoriesChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCategoriesChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10506,14 +10541,14 @@ func callbackQItemModelBarDataProxy_RowCategoriesChanged(ptr unsafe.Pointer) {
 func (ptr *QItemModelBarDataProxy) ConnectRowCategoriesChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectRowCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectRowCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectRowCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCategoriesChanged")
 	}
 }
 
@@ -10525,7 +10560,7 @@ func (ptr *QItemModelBarDataProxy) RowCategoriesChanged() {
 
 //export callbackQItemModelBarDataProxy_RowRoleChanged
 func callbackQItemModelBarDataProxy_RowRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -10534,14 +10569,14 @@ func callbackQItemModelBarDataProxy_RowRoleChanged(ptr unsafe.Pointer, role C.st
 func (ptr *QItemModelBarDataProxy) ConnectRowRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectRowRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectRowRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectRowRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowRoleChanged")
 	}
 }
 
@@ -10555,7 +10590,7 @@ func (ptr *QItemModelBarDataProxy) RowRoleChanged(role string) {
 
 //export callbackQItemModelBarDataProxy_RowRolePatternChanged
 func callbackQItemModelBarDataProxy_RowRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -10564,14 +10599,14 @@ func callbackQItemModelBarDataProxy_RowRolePatternChanged(ptr unsafe.Pointer, pa
 func (ptr *QItemModelBarDataProxy) ConnectRowRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectRowRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectRowRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectRowRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowRolePatternChanged")
 	}
 }
 
@@ -10583,7 +10618,7 @@ func (ptr *QItemModelBarDataProxy) RowRolePatternChanged(pattern core.QRegExp_IT
 
 //export callbackQItemModelBarDataProxy_RowRoleReplaceChanged
 func callbackQItemModelBarDataProxy_RowRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -10592,14 +10627,14 @@ func callbackQItemModelBarDataProxy_RowRoleReplaceChanged(ptr unsafe.Pointer, re
 func (ptr *QItemModelBarDataProxy) ConnectRowRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectRowRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectRowRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectRowRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowRoleReplaceChanged")
 	}
 }
 
@@ -10625,7 +10660,7 @@ func (ptr *QItemModelBarDataProxy) SetAutoRowCategories(enable bool) {
 
 func (ptr *QItemModelBarDataProxy) SetColumnCategories(categories []string) {
 	if ptr.Pointer() != nil {
-		var categoriesC = C.CString(strings.Join(categories, "|"))
+		var categoriesC = cGoPackStringList(categories)
 		defer C.free(unsafe.Pointer(categoriesC))
 		C.QItemModelBarDataProxy_SetColumnCategories(ptr.Pointer(), categoriesC)
 	}
@@ -10689,7 +10724,7 @@ func (ptr *QItemModelBarDataProxy) SetRotationRoleReplace(replace string) {
 
 func (ptr *QItemModelBarDataProxy) SetRowCategories(categories []string) {
 	if ptr.Pointer() != nil {
-		var categoriesC = C.CString(strings.Join(categories, "|"))
+		var categoriesC = cGoPackStringList(categories)
 		defer C.free(unsafe.Pointer(categoriesC))
 		C.QItemModelBarDataProxy_SetRowCategories(ptr.Pointer(), categoriesC)
 	}
@@ -10747,7 +10782,7 @@ func (ptr *QItemModelBarDataProxy) SetValueRoleReplace(replace string) {
 
 //export callbackQItemModelBarDataProxy_UseModelCategoriesChanged
 func callbackQItemModelBarDataProxy_UseModelCategoriesChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "useModelCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "useModelCategoriesChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -10756,14 +10791,14 @@ func callbackQItemModelBarDataProxy_UseModelCategoriesChanged(ptr unsafe.Pointer
 func (ptr *QItemModelBarDataProxy) ConnectUseModelCategoriesChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectUseModelCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "useModelCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "useModelCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectUseModelCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectUseModelCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "useModelCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "useModelCategoriesChanged")
 	}
 }
 
@@ -10775,7 +10810,7 @@ func (ptr *QItemModelBarDataProxy) UseModelCategoriesChanged(enable bool) {
 
 //export callbackQItemModelBarDataProxy_ValueRoleChanged
 func callbackQItemModelBarDataProxy_ValueRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -10784,14 +10819,14 @@ func callbackQItemModelBarDataProxy_ValueRoleChanged(ptr unsafe.Pointer, role C.
 func (ptr *QItemModelBarDataProxy) ConnectValueRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectValueRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectValueRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectValueRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valueRoleChanged")
 	}
 }
 
@@ -10805,7 +10840,7 @@ func (ptr *QItemModelBarDataProxy) ValueRoleChanged(role string) {
 
 //export callbackQItemModelBarDataProxy_ValueRolePatternChanged
 func callbackQItemModelBarDataProxy_ValueRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -10814,14 +10849,14 @@ func callbackQItemModelBarDataProxy_ValueRolePatternChanged(ptr unsafe.Pointer,
 func (ptr *QItemModelBarDataProxy) ConnectValueRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectValueRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectValueRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectValueRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valueRolePatternChanged")
 	}
 }
 
@@ -10833,7 +10868,7 @@ func (ptr *QItemModelBarDataProxy) ValueRolePatternChanged(pattern core.QRegExp_
 
 //export callbackQItemModelBarDataProxy_ValueRoleReplaceChanged
 func callbackQItemModelBarDataProxy_ValueRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -10842,14 +10877,14 @@ func callbackQItemModelBarDataProxy_ValueRoleReplaceChanged(ptr unsafe.Pointer,
 func (ptr *QItemModelBarDataProxy) ConnectValueRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_ConnectValueRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectValueRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DisconnectValueRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "valueRoleReplaceChanged")
 	}
 }
 
@@ -10863,7 +10898,7 @@ func (ptr *QItemModelBarDataProxy) ValueRoleReplaceChanged(replace string) {
 
 //export callbackQItemModelBarDataProxy_DestroyQItemModelBarDataProxy
 func callbackQItemModelBarDataProxy_DestroyQItemModelBarDataProxy(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QItemModelBarDataProxy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QItemModelBarDataProxy"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQItemModelBarDataProxyFromPointer(ptr).DestroyQItemModelBarDataProxyDefault()
@@ -10873,21 +10908,21 @@ func callbackQItemModelBarDataProxy_DestroyQItemModelBarDataProxy(ptr unsafe.Poi
 func (ptr *QItemModelBarDataProxy) ConnectDestroyQItemModelBarDataProxy(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QItemModelBarDataProxy", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QItemModelBarDataProxy", f)
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DisconnectDestroyQItemModelBarDataProxy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QItemModelBarDataProxy")
+		qt.DisconnectSignal(ptr.Pointer(), "~QItemModelBarDataProxy")
 	}
 }
 
 func (ptr *QItemModelBarDataProxy) DestroyQItemModelBarDataProxy() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DestroyQItemModelBarDataProxy(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10895,7 +10930,7 @@ func (ptr *QItemModelBarDataProxy) DestroyQItemModelBarDataProxy() {
 func (ptr *QItemModelBarDataProxy) DestroyQItemModelBarDataProxyDefault() {
 	if ptr.Pointer() != nil {
 		C.QItemModelBarDataProxy_DestroyQItemModelBarDataProxyDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10910,7 +10945,7 @@ func (ptr *QItemModelBarDataProxy) MultiMatchBehavior() QItemModelBarDataProxy__
 func (ptr *QItemModelBarDataProxy) ItemModel() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QItemModelBarDataProxy_ItemModel(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11012,14 +11047,14 @@ func (ptr *QItemModelBarDataProxy) ValueRoleReplace() string {
 
 func (ptr *QItemModelBarDataProxy) ColumnCategories() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QItemModelBarDataProxy_ColumnCategories(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QItemModelBarDataProxy_ColumnCategories(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QItemModelBarDataProxy) RowCategories() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QItemModelBarDataProxy_RowCategories(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QItemModelBarDataProxy_RowCategories(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -11114,7 +11149,7 @@ func NewQItemModelScatterDataProxy(parent core.QObject_ITF) *QItemModelScatterDa
 
 //export callbackQItemModelScatterDataProxy_ItemModelChanged
 func callbackQItemModelScatterDataProxy_ItemModelChanged(ptr unsafe.Pointer, itemModel unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemModelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemModelChanged"); signal != nil {
 		signal.(func(*core.QAbstractItemModel))(core.NewQAbstractItemModelFromPointer(itemModel))
 	}
 
@@ -11123,14 +11158,14 @@ func callbackQItemModelScatterDataProxy_ItemModelChanged(ptr unsafe.Pointer, ite
 func (ptr *QItemModelScatterDataProxy) ConnectItemModelChanged(f func(itemModel *core.QAbstractItemModel)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectItemModelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemModelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemModelChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectItemModelChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectItemModelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemModelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemModelChanged")
 	}
 }
 
@@ -11156,7 +11191,7 @@ func (ptr *QItemModelScatterDataProxy) Remap(xPosRole string, yPosRole string, z
 
 //export callbackQItemModelScatterDataProxy_RotationRoleChanged
 func callbackQItemModelScatterDataProxy_RotationRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rotationRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rotationRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -11165,14 +11200,14 @@ func callbackQItemModelScatterDataProxy_RotationRoleChanged(ptr unsafe.Pointer,
 func (ptr *QItemModelScatterDataProxy) ConnectRotationRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectRotationRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rotationRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectRotationRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectRotationRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rotationRoleChanged")
 	}
 }
 
@@ -11186,7 +11221,7 @@ func (ptr *QItemModelScatterDataProxy) RotationRoleChanged(role string) {
 
 //export callbackQItemModelScatterDataProxy_RotationRolePatternChanged
 func callbackQItemModelScatterDataProxy_RotationRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rotationRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rotationRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -11195,14 +11230,14 @@ func callbackQItemModelScatterDataProxy_RotationRolePatternChanged(ptr unsafe.Po
 func (ptr *QItemModelScatterDataProxy) ConnectRotationRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectRotationRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rotationRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectRotationRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectRotationRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rotationRolePatternChanged")
 	}
 }
 
@@ -11214,7 +11249,7 @@ func (ptr *QItemModelScatterDataProxy) RotationRolePatternChanged(pattern core.Q
 
 //export callbackQItemModelScatterDataProxy_RotationRoleReplaceChanged
 func callbackQItemModelScatterDataProxy_RotationRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rotationRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rotationRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -11223,14 +11258,14 @@ func callbackQItemModelScatterDataProxy_RotationRoleReplaceChanged(ptr unsafe.Po
 func (ptr *QItemModelScatterDataProxy) ConnectRotationRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectRotationRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rotationRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectRotationRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectRotationRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rotationRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rotationRoleReplaceChanged")
 	}
 }
 
@@ -11338,7 +11373,7 @@ func (ptr *QItemModelScatterDataProxy) SetZPosRoleReplace(replace string) {
 
 //export callbackQItemModelScatterDataProxy_XPosRoleChanged
 func callbackQItemModelScatterDataProxy_XPosRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xPosRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xPosRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -11347,14 +11382,14 @@ func callbackQItemModelScatterDataProxy_XPosRoleChanged(ptr unsafe.Pointer, role
 func (ptr *QItemModelScatterDataProxy) ConnectXPosRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectXPosRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xPosRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectXPosRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectXPosRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xPosRoleChanged")
 	}
 }
 
@@ -11368,7 +11403,7 @@ func (ptr *QItemModelScatterDataProxy) XPosRoleChanged(role string) {
 
 //export callbackQItemModelScatterDataProxy_XPosRolePatternChanged
 func callbackQItemModelScatterDataProxy_XPosRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xPosRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xPosRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -11377,14 +11412,14 @@ func callbackQItemModelScatterDataProxy_XPosRolePatternChanged(ptr unsafe.Pointe
 func (ptr *QItemModelScatterDataProxy) ConnectXPosRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectXPosRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xPosRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectXPosRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectXPosRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xPosRolePatternChanged")
 	}
 }
 
@@ -11396,7 +11431,7 @@ func (ptr *QItemModelScatterDataProxy) XPosRolePatternChanged(pattern core.QRegE
 
 //export callbackQItemModelScatterDataProxy_XPosRoleReplaceChanged
 func callbackQItemModelScatterDataProxy_XPosRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xPosRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xPosRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -11405,14 +11440,14 @@ func callbackQItemModelScatterDataProxy_XPosRoleReplaceChanged(ptr unsafe.Pointe
 func (ptr *QItemModelScatterDataProxy) ConnectXPosRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectXPosRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xPosRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectXPosRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectXPosRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xPosRoleReplaceChanged")
 	}
 }
 
@@ -11426,7 +11461,7 @@ func (ptr *QItemModelScatterDataProxy) XPosRoleReplaceChanged(replace string) {
 
 //export callbackQItemModelScatterDataProxy_YPosRoleChanged
 func callbackQItemModelScatterDataProxy_YPosRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yPosRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yPosRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -11435,14 +11470,14 @@ func callbackQItemModelScatterDataProxy_YPosRoleChanged(ptr unsafe.Pointer, role
 func (ptr *QItemModelScatterDataProxy) ConnectYPosRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectYPosRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yPosRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectYPosRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectYPosRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yPosRoleChanged")
 	}
 }
 
@@ -11456,7 +11491,7 @@ func (ptr *QItemModelScatterDataProxy) YPosRoleChanged(role string) {
 
 //export callbackQItemModelScatterDataProxy_YPosRolePatternChanged
 func callbackQItemModelScatterDataProxy_YPosRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yPosRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yPosRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -11465,14 +11500,14 @@ func callbackQItemModelScatterDataProxy_YPosRolePatternChanged(ptr unsafe.Pointe
 func (ptr *QItemModelScatterDataProxy) ConnectYPosRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectYPosRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yPosRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectYPosRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectYPosRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yPosRolePatternChanged")
 	}
 }
 
@@ -11484,7 +11519,7 @@ func (ptr *QItemModelScatterDataProxy) YPosRolePatternChanged(pattern core.QRegE
 
 //export callbackQItemModelScatterDataProxy_YPosRoleReplaceChanged
 func callbackQItemModelScatterDataProxy_YPosRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yPosRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yPosRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -11493,14 +11528,14 @@ func callbackQItemModelScatterDataProxy_YPosRoleReplaceChanged(ptr unsafe.Pointe
 func (ptr *QItemModelScatterDataProxy) ConnectYPosRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectYPosRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yPosRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectYPosRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectYPosRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yPosRoleReplaceChanged")
 	}
 }
 
@@ -11514,7 +11549,7 @@ func (ptr *QItemModelScatterDataProxy) YPosRoleReplaceChanged(replace string) {
 
 //export callbackQItemModelScatterDataProxy_ZPosRoleChanged
 func callbackQItemModelScatterDataProxy_ZPosRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zPosRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zPosRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -11523,14 +11558,14 @@ func callbackQItemModelScatterDataProxy_ZPosRoleChanged(ptr unsafe.Pointer, role
 func (ptr *QItemModelScatterDataProxy) ConnectZPosRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectZPosRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "zPosRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectZPosRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectZPosRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "zPosRoleChanged")
 	}
 }
 
@@ -11544,7 +11579,7 @@ func (ptr *QItemModelScatterDataProxy) ZPosRoleChanged(role string) {
 
 //export callbackQItemModelScatterDataProxy_ZPosRolePatternChanged
 func callbackQItemModelScatterDataProxy_ZPosRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zPosRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zPosRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -11553,14 +11588,14 @@ func callbackQItemModelScatterDataProxy_ZPosRolePatternChanged(ptr unsafe.Pointe
 func (ptr *QItemModelScatterDataProxy) ConnectZPosRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectZPosRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "zPosRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectZPosRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectZPosRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "zPosRolePatternChanged")
 	}
 }
 
@@ -11572,7 +11607,7 @@ func (ptr *QItemModelScatterDataProxy) ZPosRolePatternChanged(pattern core.QRegE
 
 //export callbackQItemModelScatterDataProxy_ZPosRoleReplaceChanged
 func callbackQItemModelScatterDataProxy_ZPosRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zPosRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zPosRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -11581,14 +11616,14 @@ func callbackQItemModelScatterDataProxy_ZPosRoleReplaceChanged(ptr unsafe.Pointe
 func (ptr *QItemModelScatterDataProxy) ConnectZPosRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_ConnectZPosRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "zPosRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectZPosRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DisconnectZPosRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "zPosRoleReplaceChanged")
 	}
 }
 
@@ -11602,7 +11637,7 @@ func (ptr *QItemModelScatterDataProxy) ZPosRoleReplaceChanged(replace string) {
 
 //export callbackQItemModelScatterDataProxy_DestroyQItemModelScatterDataProxy
 func callbackQItemModelScatterDataProxy_DestroyQItemModelScatterDataProxy(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QItemModelScatterDataProxy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QItemModelScatterDataProxy"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQItemModelScatterDataProxyFromPointer(ptr).DestroyQItemModelScatterDataProxyDefault()
@@ -11612,21 +11647,21 @@ func callbackQItemModelScatterDataProxy_DestroyQItemModelScatterDataProxy(ptr un
 func (ptr *QItemModelScatterDataProxy) ConnectDestroyQItemModelScatterDataProxy(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QItemModelScatterDataProxy", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QItemModelScatterDataProxy", f)
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DisconnectDestroyQItemModelScatterDataProxy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QItemModelScatterDataProxy")
+		qt.DisconnectSignal(ptr.Pointer(), "~QItemModelScatterDataProxy")
 	}
 }
 
 func (ptr *QItemModelScatterDataProxy) DestroyQItemModelScatterDataProxy() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DestroyQItemModelScatterDataProxy(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11634,7 +11669,7 @@ func (ptr *QItemModelScatterDataProxy) DestroyQItemModelScatterDataProxy() {
 func (ptr *QItemModelScatterDataProxy) DestroyQItemModelScatterDataProxyDefault() {
 	if ptr.Pointer() != nil {
 		C.QItemModelScatterDataProxy_DestroyQItemModelScatterDataProxyDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11642,7 +11677,7 @@ func (ptr *QItemModelScatterDataProxy) DestroyQItemModelScatterDataProxyDefault(
 func (ptr *QItemModelScatterDataProxy) ItemModel() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QItemModelScatterDataProxy_ItemModel(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11820,9 +11855,9 @@ func NewQItemModelSurfaceDataProxy7(itemModel core.QAbstractItemModel_ITF, rowRo
 	defer C.free(unsafe.Pointer(yPosRoleC))
 	var zPosRoleC = C.CString(zPosRole)
 	defer C.free(unsafe.Pointer(zPosRoleC))
-	var rowCategoriesC = C.CString(strings.Join(rowCategories, "|"))
+	var rowCategoriesC = cGoPackStringList(rowCategories)
 	defer C.free(unsafe.Pointer(rowCategoriesC))
-	var columnCategoriesC = C.CString(strings.Join(columnCategories, "|"))
+	var columnCategoriesC = cGoPackStringList(columnCategories)
 	defer C.free(unsafe.Pointer(columnCategoriesC))
 	return NewQItemModelSurfaceDataProxyFromPointer(C.QItemModelSurfaceDataProxy_NewQItemModelSurfaceDataProxy7(core.PointerFromQAbstractItemModel(itemModel), rowRoleC, columnRoleC, xPosRoleC, yPosRoleC, zPosRoleC, rowCategoriesC, columnCategoriesC, core.PointerFromQObject(parent)))
 }
@@ -11844,9 +11879,9 @@ func NewQItemModelSurfaceDataProxy6(itemModel core.QAbstractItemModel_ITF, rowRo
 	defer C.free(unsafe.Pointer(columnRoleC))
 	var yPosRoleC = C.CString(yPosRole)
 	defer C.free(unsafe.Pointer(yPosRoleC))
-	var rowCategoriesC = C.CString(strings.Join(rowCategories, "|"))
+	var rowCategoriesC = cGoPackStringList(rowCategories)
 	defer C.free(unsafe.Pointer(rowCategoriesC))
-	var columnCategoriesC = C.CString(strings.Join(columnCategories, "|"))
+	var columnCategoriesC = cGoPackStringList(columnCategories)
 	defer C.free(unsafe.Pointer(columnCategoriesC))
 	return NewQItemModelSurfaceDataProxyFromPointer(C.QItemModelSurfaceDataProxy_NewQItemModelSurfaceDataProxy6(core.PointerFromQAbstractItemModel(itemModel), rowRoleC, columnRoleC, yPosRoleC, rowCategoriesC, columnCategoriesC, core.PointerFromQObject(parent)))
 }
@@ -11881,7 +11916,7 @@ func (ptr *QItemModelSurfaceDataProxy) RowCategoryIndex(category string) int {
 
 //export callbackQItemModelSurfaceDataProxy_AutoColumnCategoriesChanged
 func callbackQItemModelSurfaceDataProxy_AutoColumnCategoriesChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "autoColumnCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "autoColumnCategoriesChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -11890,14 +11925,14 @@ func callbackQItemModelSurfaceDataProxy_AutoColumnCategoriesChanged(ptr unsafe.P
 func (ptr *QItemModelSurfaceDataProxy) ConnectAutoColumnCategoriesChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectAutoColumnCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "autoColumnCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "autoColumnCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectAutoColumnCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectAutoColumnCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "autoColumnCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "autoColumnCategoriesChanged")
 	}
 }
 
@@ -11909,7 +11944,7 @@ func (ptr *QItemModelSurfaceDataProxy) AutoColumnCategoriesChanged(enable bool)
 
 //export callbackQItemModelSurfaceDataProxy_AutoRowCategoriesChanged
 func callbackQItemModelSurfaceDataProxy_AutoRowCategoriesChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "autoRowCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "autoRowCategoriesChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -11918,14 +11953,14 @@ func callbackQItemModelSurfaceDataProxy_AutoRowCategoriesChanged(ptr unsafe.Poin
 func (ptr *QItemModelSurfaceDataProxy) ConnectAutoRowCategoriesChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectAutoRowCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "autoRowCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "autoRowCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectAutoRowCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectAutoRowCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "autoRowCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "autoRowCategoriesChanged")
 	}
 }
 
@@ -11937,7 +11972,7 @@ func (ptr *QItemModelSurfaceDataProxy) AutoRowCategoriesChanged(enable bool) {
 
 //export callbackQItemModelSurfaceDataProxy_ColumnCategoriesChanged
 func callbackQItemModelSurfaceDataProxy_ColumnCategoriesChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCategoriesChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -11946,14 +11981,14 @@ func callbackQItemModelSurfaceDataProxy_ColumnCategoriesChanged(ptr unsafe.Point
 func (ptr *QItemModelSurfaceDataProxy) ConnectColumnCategoriesChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectColumnCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectColumnCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectColumnCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCategoriesChanged")
 	}
 }
 
@@ -11965,7 +12000,7 @@ func (ptr *QItemModelSurfaceDataProxy) ColumnCategoriesChanged() {
 
 //export callbackQItemModelSurfaceDataProxy_ColumnRoleChanged
 func callbackQItemModelSurfaceDataProxy_ColumnRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -11974,14 +12009,14 @@ func callbackQItemModelSurfaceDataProxy_ColumnRoleChanged(ptr unsafe.Pointer, ro
 func (ptr *QItemModelSurfaceDataProxy) ConnectColumnRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectColumnRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectColumnRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectColumnRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnRoleChanged")
 	}
 }
 
@@ -11995,7 +12030,7 @@ func (ptr *QItemModelSurfaceDataProxy) ColumnRoleChanged(role string) {
 
 //export callbackQItemModelSurfaceDataProxy_ColumnRolePatternChanged
 func callbackQItemModelSurfaceDataProxy_ColumnRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -12004,14 +12039,14 @@ func callbackQItemModelSurfaceDataProxy_ColumnRolePatternChanged(ptr unsafe.Poin
 func (ptr *QItemModelSurfaceDataProxy) ConnectColumnRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectColumnRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectColumnRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectColumnRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnRolePatternChanged")
 	}
 }
 
@@ -12023,7 +12058,7 @@ func (ptr *QItemModelSurfaceDataProxy) ColumnRolePatternChanged(pattern core.QRe
 
 //export callbackQItemModelSurfaceDataProxy_ColumnRoleReplaceChanged
 func callbackQItemModelSurfaceDataProxy_ColumnRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -12032,14 +12067,14 @@ func callbackQItemModelSurfaceDataProxy_ColumnRoleReplaceChanged(ptr unsafe.Poin
 func (ptr *QItemModelSurfaceDataProxy) ConnectColumnRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectColumnRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectColumnRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectColumnRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnRoleReplaceChanged")
 	}
 }
 
@@ -12053,7 +12088,7 @@ func (ptr *QItemModelSurfaceDataProxy) ColumnRoleReplaceChanged(replace string)
 
 //export callbackQItemModelSurfaceDataProxy_ItemModelChanged
 func callbackQItemModelSurfaceDataProxy_ItemModelChanged(ptr unsafe.Pointer, itemModel unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemModelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemModelChanged"); signal != nil {
 		signal.(func(*core.QAbstractItemModel))(core.NewQAbstractItemModelFromPointer(itemModel))
 	}
 
@@ -12062,14 +12097,14 @@ func callbackQItemModelSurfaceDataProxy_ItemModelChanged(ptr unsafe.Pointer, ite
 func (ptr *QItemModelSurfaceDataProxy) ConnectItemModelChanged(f func(itemModel *core.QAbstractItemModel)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectItemModelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemModelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemModelChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectItemModelChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectItemModelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemModelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemModelChanged")
 	}
 }
 
@@ -12081,7 +12116,7 @@ func (ptr *QItemModelSurfaceDataProxy) ItemModelChanged(itemModel core.QAbstract
 
 //export callbackQItemModelSurfaceDataProxy_MultiMatchBehaviorChanged
 func callbackQItemModelSurfaceDataProxy_MultiMatchBehaviorChanged(ptr unsafe.Pointer, behavior C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "multiMatchBehaviorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "multiMatchBehaviorChanged"); signal != nil {
 		signal.(func(QItemModelSurfaceDataProxy__MultiMatchBehavior))(QItemModelSurfaceDataProxy__MultiMatchBehavior(behavior))
 	}
 
@@ -12090,14 +12125,14 @@ func callbackQItemModelSurfaceDataProxy_MultiMatchBehaviorChanged(ptr unsafe.Poi
 func (ptr *QItemModelSurfaceDataProxy) ConnectMultiMatchBehaviorChanged(f func(behavior QItemModelSurfaceDataProxy__MultiMatchBehavior)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectMultiMatchBehaviorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "multiMatchBehaviorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "multiMatchBehaviorChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectMultiMatchBehaviorChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectMultiMatchBehaviorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "multiMatchBehaviorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "multiMatchBehaviorChanged")
 	}
 }
 
@@ -12119,9 +12154,9 @@ func (ptr *QItemModelSurfaceDataProxy) Remap(rowRole string, columnRole string,
 		defer C.free(unsafe.Pointer(yPosRoleC))
 		var zPosRoleC = C.CString(zPosRole)
 		defer C.free(unsafe.Pointer(zPosRoleC))
-		var rowCategoriesC = C.CString(strings.Join(rowCategories, "|"))
+		var rowCategoriesC = cGoPackStringList(rowCategories)
 		defer C.free(unsafe.Pointer(rowCategoriesC))
-		var columnCategoriesC = C.CString(strings.Join(columnCategories, "|"))
+		var columnCategoriesC = cGoPackStringList(columnCategories)
 		defer C.free(unsafe.Pointer(columnCategoriesC))
 		C.QItemModelSurfaceDataProxy_Remap(ptr.Pointer(), rowRoleC, columnRoleC, xPosRoleC, yPosRoleC, zPosRoleC, rowCategoriesC, columnCategoriesC)
 	}
@@ -12129,7 +12164,7 @@ func (ptr *QItemModelSurfaceDataProxy) Remap(rowRole string, columnRole string,
 
 //export callbackQItemModelSurfaceDataProxy_RowCategoriesChanged
 func callbackQItemModelSurfaceDataProxy_RowCategoriesChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCategoriesChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12138,14 +12173,14 @@ func callbackQItemModelSurfaceDataProxy_RowCategoriesChanged(ptr unsafe.Pointer)
 func (ptr *QItemModelSurfaceDataProxy) ConnectRowCategoriesChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectRowCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectRowCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectRowCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCategoriesChanged")
 	}
 }
 
@@ -12157,7 +12192,7 @@ func (ptr *QItemModelSurfaceDataProxy) RowCategoriesChanged() {
 
 //export callbackQItemModelSurfaceDataProxy_RowRoleChanged
 func callbackQItemModelSurfaceDataProxy_RowRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -12166,14 +12201,14 @@ func callbackQItemModelSurfaceDataProxy_RowRoleChanged(ptr unsafe.Pointer, role
 func (ptr *QItemModelSurfaceDataProxy) ConnectRowRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectRowRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectRowRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectRowRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowRoleChanged")
 	}
 }
 
@@ -12187,7 +12222,7 @@ func (ptr *QItemModelSurfaceDataProxy) RowRoleChanged(role string) {
 
 //export callbackQItemModelSurfaceDataProxy_RowRolePatternChanged
 func callbackQItemModelSurfaceDataProxy_RowRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -12196,14 +12231,14 @@ func callbackQItemModelSurfaceDataProxy_RowRolePatternChanged(ptr unsafe.Pointer
 func (ptr *QItemModelSurfaceDataProxy) ConnectRowRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectRowRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectRowRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectRowRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowRolePatternChanged")
 	}
 }
 
@@ -12215,7 +12250,7 @@ func (ptr *QItemModelSurfaceDataProxy) RowRolePatternChanged(pattern core.QRegEx
 
 //export callbackQItemModelSurfaceDataProxy_RowRoleReplaceChanged
 func callbackQItemModelSurfaceDataProxy_RowRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -12224,14 +12259,14 @@ func callbackQItemModelSurfaceDataProxy_RowRoleReplaceChanged(ptr unsafe.Pointer
 func (ptr *QItemModelSurfaceDataProxy) ConnectRowRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectRowRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectRowRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectRowRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowRoleReplaceChanged")
 	}
 }
 
@@ -12257,7 +12292,7 @@ func (ptr *QItemModelSurfaceDataProxy) SetAutoRowCategories(enable bool) {
 
 func (ptr *QItemModelSurfaceDataProxy) SetColumnCategories(categories []string) {
 	if ptr.Pointer() != nil {
-		var categoriesC = C.CString(strings.Join(categories, "|"))
+		var categoriesC = cGoPackStringList(categories)
 		defer C.free(unsafe.Pointer(categoriesC))
 		C.QItemModelSurfaceDataProxy_SetColumnCategories(ptr.Pointer(), categoriesC)
 	}
@@ -12299,7 +12334,7 @@ func (ptr *QItemModelSurfaceDataProxy) SetMultiMatchBehavior(behavior QItemModel
 
 func (ptr *QItemModelSurfaceDataProxy) SetRowCategories(categories []string) {
 	if ptr.Pointer() != nil {
-		var categoriesC = C.CString(strings.Join(categories, "|"))
+		var categoriesC = cGoPackStringList(categories)
 		defer C.free(unsafe.Pointer(categoriesC))
 		C.QItemModelSurfaceDataProxy_SetRowCategories(ptr.Pointer(), categoriesC)
 	}
@@ -12401,7 +12436,7 @@ func (ptr *QItemModelSurfaceDataProxy) SetZPosRoleReplace(replace string) {
 
 //export callbackQItemModelSurfaceDataProxy_UseModelCategoriesChanged
 func callbackQItemModelSurfaceDataProxy_UseModelCategoriesChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "useModelCategoriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "useModelCategoriesChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -12410,14 +12445,14 @@ func callbackQItemModelSurfaceDataProxy_UseModelCategoriesChanged(ptr unsafe.Poi
 func (ptr *QItemModelSurfaceDataProxy) ConnectUseModelCategoriesChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectUseModelCategoriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "useModelCategoriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "useModelCategoriesChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectUseModelCategoriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectUseModelCategoriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "useModelCategoriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "useModelCategoriesChanged")
 	}
 }
 
@@ -12429,7 +12464,7 @@ func (ptr *QItemModelSurfaceDataProxy) UseModelCategoriesChanged(enable bool) {
 
 //export callbackQItemModelSurfaceDataProxy_XPosRoleChanged
 func callbackQItemModelSurfaceDataProxy_XPosRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xPosRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xPosRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -12438,14 +12473,14 @@ func callbackQItemModelSurfaceDataProxy_XPosRoleChanged(ptr unsafe.Pointer, role
 func (ptr *QItemModelSurfaceDataProxy) ConnectXPosRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectXPosRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xPosRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectXPosRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectXPosRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xPosRoleChanged")
 	}
 }
 
@@ -12459,7 +12494,7 @@ func (ptr *QItemModelSurfaceDataProxy) XPosRoleChanged(role string) {
 
 //export callbackQItemModelSurfaceDataProxy_XPosRolePatternChanged
 func callbackQItemModelSurfaceDataProxy_XPosRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xPosRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xPosRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -12468,14 +12503,14 @@ func callbackQItemModelSurfaceDataProxy_XPosRolePatternChanged(ptr unsafe.Pointe
 func (ptr *QItemModelSurfaceDataProxy) ConnectXPosRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectXPosRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xPosRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectXPosRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectXPosRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xPosRolePatternChanged")
 	}
 }
 
@@ -12487,7 +12522,7 @@ func (ptr *QItemModelSurfaceDataProxy) XPosRolePatternChanged(pattern core.QRegE
 
 //export callbackQItemModelSurfaceDataProxy_XPosRoleReplaceChanged
 func callbackQItemModelSurfaceDataProxy_XPosRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xPosRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xPosRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -12496,14 +12531,14 @@ func callbackQItemModelSurfaceDataProxy_XPosRoleReplaceChanged(ptr unsafe.Pointe
 func (ptr *QItemModelSurfaceDataProxy) ConnectXPosRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectXPosRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xPosRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectXPosRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectXPosRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xPosRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xPosRoleReplaceChanged")
 	}
 }
 
@@ -12517,7 +12552,7 @@ func (ptr *QItemModelSurfaceDataProxy) XPosRoleReplaceChanged(replace string) {
 
 //export callbackQItemModelSurfaceDataProxy_YPosRoleChanged
 func callbackQItemModelSurfaceDataProxy_YPosRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yPosRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yPosRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -12526,14 +12561,14 @@ func callbackQItemModelSurfaceDataProxy_YPosRoleChanged(ptr unsafe.Pointer, role
 func (ptr *QItemModelSurfaceDataProxy) ConnectYPosRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectYPosRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yPosRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectYPosRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectYPosRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yPosRoleChanged")
 	}
 }
 
@@ -12547,7 +12582,7 @@ func (ptr *QItemModelSurfaceDataProxy) YPosRoleChanged(role string) {
 
 //export callbackQItemModelSurfaceDataProxy_YPosRolePatternChanged
 func callbackQItemModelSurfaceDataProxy_YPosRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yPosRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yPosRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -12556,14 +12591,14 @@ func callbackQItemModelSurfaceDataProxy_YPosRolePatternChanged(ptr unsafe.Pointe
 func (ptr *QItemModelSurfaceDataProxy) ConnectYPosRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectYPosRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yPosRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectYPosRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectYPosRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yPosRolePatternChanged")
 	}
 }
 
@@ -12575,7 +12610,7 @@ func (ptr *QItemModelSurfaceDataProxy) YPosRolePatternChanged(pattern core.QRegE
 
 //export callbackQItemModelSurfaceDataProxy_YPosRoleReplaceChanged
 func callbackQItemModelSurfaceDataProxy_YPosRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yPosRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yPosRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -12584,14 +12619,14 @@ func callbackQItemModelSurfaceDataProxy_YPosRoleReplaceChanged(ptr unsafe.Pointe
 func (ptr *QItemModelSurfaceDataProxy) ConnectYPosRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectYPosRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yPosRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectYPosRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectYPosRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yPosRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yPosRoleReplaceChanged")
 	}
 }
 
@@ -12605,7 +12640,7 @@ func (ptr *QItemModelSurfaceDataProxy) YPosRoleReplaceChanged(replace string) {
 
 //export callbackQItemModelSurfaceDataProxy_ZPosRoleChanged
 func callbackQItemModelSurfaceDataProxy_ZPosRoleChanged(ptr unsafe.Pointer, role C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zPosRoleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zPosRoleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(role))
 	}
 
@@ -12614,14 +12649,14 @@ func callbackQItemModelSurfaceDataProxy_ZPosRoleChanged(ptr unsafe.Pointer, role
 func (ptr *QItemModelSurfaceDataProxy) ConnectZPosRoleChanged(f func(role string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectZPosRoleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRoleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "zPosRoleChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectZPosRoleChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectZPosRoleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRoleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "zPosRoleChanged")
 	}
 }
 
@@ -12635,7 +12670,7 @@ func (ptr *QItemModelSurfaceDataProxy) ZPosRoleChanged(role string) {
 
 //export callbackQItemModelSurfaceDataProxy_ZPosRolePatternChanged
 func callbackQItemModelSurfaceDataProxy_ZPosRolePatternChanged(ptr unsafe.Pointer, pattern unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zPosRolePatternChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zPosRolePatternChanged"); signal != nil {
 		signal.(func(*core.QRegExp))(core.NewQRegExpFromPointer(pattern))
 	}
 
@@ -12644,14 +12679,14 @@ func callbackQItemModelSurfaceDataProxy_ZPosRolePatternChanged(ptr unsafe.Pointe
 func (ptr *QItemModelSurfaceDataProxy) ConnectZPosRolePatternChanged(f func(pattern *core.QRegExp)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectZPosRolePatternChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRolePatternChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "zPosRolePatternChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectZPosRolePatternChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectZPosRolePatternChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRolePatternChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "zPosRolePatternChanged")
 	}
 }
 
@@ -12663,7 +12698,7 @@ func (ptr *QItemModelSurfaceDataProxy) ZPosRolePatternChanged(pattern core.QRegE
 
 //export callbackQItemModelSurfaceDataProxy_ZPosRoleReplaceChanged
 func callbackQItemModelSurfaceDataProxy_ZPosRoleReplaceChanged(ptr unsafe.Pointer, replace C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zPosRoleReplaceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zPosRoleReplaceChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(replace))
 	}
 
@@ -12672,14 +12707,14 @@ func callbackQItemModelSurfaceDataProxy_ZPosRoleReplaceChanged(ptr unsafe.Pointe
 func (ptr *QItemModelSurfaceDataProxy) ConnectZPosRoleReplaceChanged(f func(replace string)) {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_ConnectZPosRoleReplaceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRoleReplaceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "zPosRoleReplaceChanged", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectZPosRoleReplaceChanged() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DisconnectZPosRoleReplaceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zPosRoleReplaceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "zPosRoleReplaceChanged")
 	}
 }
 
@@ -12693,7 +12728,7 @@ func (ptr *QItemModelSurfaceDataProxy) ZPosRoleReplaceChanged(replace string) {
 
 //export callbackQItemModelSurfaceDataProxy_DestroyQItemModelSurfaceDataProxy
 func callbackQItemModelSurfaceDataProxy_DestroyQItemModelSurfaceDataProxy(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QItemModelSurfaceDataProxy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QItemModelSurfaceDataProxy"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQItemModelSurfaceDataProxyFromPointer(ptr).DestroyQItemModelSurfaceDataProxyDefault()
@@ -12703,21 +12738,21 @@ func callbackQItemModelSurfaceDataProxy_DestroyQItemModelSurfaceDataProxy(ptr un
 func (ptr *QItemModelSurfaceDataProxy) ConnectDestroyQItemModelSurfaceDataProxy(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QItemModelSurfaceDataProxy", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QItemModelSurfaceDataProxy", f)
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DisconnectDestroyQItemModelSurfaceDataProxy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QItemModelSurfaceDataProxy")
+		qt.DisconnectSignal(ptr.Pointer(), "~QItemModelSurfaceDataProxy")
 	}
 }
 
 func (ptr *QItemModelSurfaceDataProxy) DestroyQItemModelSurfaceDataProxy() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DestroyQItemModelSurfaceDataProxy(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12725,7 +12760,7 @@ func (ptr *QItemModelSurfaceDataProxy) DestroyQItemModelSurfaceDataProxy() {
 func (ptr *QItemModelSurfaceDataProxy) DestroyQItemModelSurfaceDataProxyDefault() {
 	if ptr.Pointer() != nil {
 		C.QItemModelSurfaceDataProxy_DestroyQItemModelSurfaceDataProxyDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12740,7 +12775,7 @@ func (ptr *QItemModelSurfaceDataProxy) MultiMatchBehavior() QItemModelSurfaceDat
 func (ptr *QItemModelSurfaceDataProxy) ItemModel() *core.QAbstractItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQAbstractItemModelFromPointer(C.QItemModelSurfaceDataProxy_ItemModel(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12865,14 +12900,14 @@ func (ptr *QItemModelSurfaceDataProxy) ZPosRoleReplace() string {
 
 func (ptr *QItemModelSurfaceDataProxy) ColumnCategories() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QItemModelSurfaceDataProxy_ColumnCategories(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QItemModelSurfaceDataProxy_ColumnCategories(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QItemModelSurfaceDataProxy) RowCategories() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QItemModelSurfaceDataProxy_RowCategories(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QItemModelSurfaceDataProxy_RowCategories(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -12941,7 +12976,7 @@ func NewQLogValue3DAxisFormatter(parent core.QObject_ITF) *QLogValue3DAxisFormat
 
 //export callbackQLogValue3DAxisFormatter_AutoSubGridChanged
 func callbackQLogValue3DAxisFormatter_AutoSubGridChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "autoSubGridChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "autoSubGridChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -12950,14 +12985,14 @@ func callbackQLogValue3DAxisFormatter_AutoSubGridChanged(ptr unsafe.Pointer, ena
 func (ptr *QLogValue3DAxisFormatter) ConnectAutoSubGridChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QLogValue3DAxisFormatter_ConnectAutoSubGridChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "autoSubGridChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "autoSubGridChanged", f)
 	}
 }
 
 func (ptr *QLogValue3DAxisFormatter) DisconnectAutoSubGridChanged() {
 	if ptr.Pointer() != nil {
 		C.QLogValue3DAxisFormatter_DisconnectAutoSubGridChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "autoSubGridChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "autoSubGridChanged")
 	}
 }
 
@@ -12969,7 +13004,7 @@ func (ptr *QLogValue3DAxisFormatter) AutoSubGridChanged(enabled bool) {
 
 //export callbackQLogValue3DAxisFormatter_BaseChanged
 func callbackQLogValue3DAxisFormatter_BaseChanged(ptr unsafe.Pointer, base C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "baseChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "baseChanged"); signal != nil {
 		signal.(func(float64))(float64(base))
 	}
 
@@ -12978,14 +13013,14 @@ func callbackQLogValue3DAxisFormatter_BaseChanged(ptr unsafe.Pointer, base C.dou
 func (ptr *QLogValue3DAxisFormatter) ConnectBaseChanged(f func(base float64)) {
 	if ptr.Pointer() != nil {
 		C.QLogValue3DAxisFormatter_ConnectBaseChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "baseChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "baseChanged", f)
 	}
 }
 
 func (ptr *QLogValue3DAxisFormatter) DisconnectBaseChanged() {
 	if ptr.Pointer() != nil {
 		C.QLogValue3DAxisFormatter_DisconnectBaseChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "baseChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "baseChanged")
 	}
 }
 
@@ -13015,7 +13050,7 @@ func (ptr *QLogValue3DAxisFormatter) SetShowEdgeLabels(enabled bool) {
 
 //export callbackQLogValue3DAxisFormatter_ShowEdgeLabelsChanged
 func callbackQLogValue3DAxisFormatter_ShowEdgeLabelsChanged(ptr unsafe.Pointer, enabled C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEdgeLabelsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEdgeLabelsChanged"); signal != nil {
 		signal.(func(bool))(int8(enabled) != 0)
 	}
 
@@ -13024,14 +13059,14 @@ func callbackQLogValue3DAxisFormatter_ShowEdgeLabelsChanged(ptr unsafe.Pointer,
 func (ptr *QLogValue3DAxisFormatter) ConnectShowEdgeLabelsChanged(f func(enabled bool)) {
 	if ptr.Pointer() != nil {
 		C.QLogValue3DAxisFormatter_ConnectShowEdgeLabelsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "showEdgeLabelsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "showEdgeLabelsChanged", f)
 	}
 }
 
 func (ptr *QLogValue3DAxisFormatter) DisconnectShowEdgeLabelsChanged() {
 	if ptr.Pointer() != nil {
 		C.QLogValue3DAxisFormatter_DisconnectShowEdgeLabelsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "showEdgeLabelsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "showEdgeLabelsChanged")
 	}
 }
 
@@ -13043,7 +13078,7 @@ func (ptr *QLogValue3DAxisFormatter) ShowEdgeLabelsChanged(enabled bool) {
 
 //export callbackQLogValue3DAxisFormatter_DestroyQLogValue3DAxisFormatter
 func callbackQLogValue3DAxisFormatter_DestroyQLogValue3DAxisFormatter(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QLogValue3DAxisFormatter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QLogValue3DAxisFormatter"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQLogValue3DAxisFormatterFromPointer(ptr).DestroyQLogValue3DAxisFormatterDefault()
@@ -13053,21 +13088,21 @@ func callbackQLogValue3DAxisFormatter_DestroyQLogValue3DAxisFormatter(ptr unsafe
 func (ptr *QLogValue3DAxisFormatter) ConnectDestroyQLogValue3DAxisFormatter(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QLogValue3DAxisFormatter", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QLogValue3DAxisFormatter", f)
 	}
 }
 
 func (ptr *QLogValue3DAxisFormatter) DisconnectDestroyQLogValue3DAxisFormatter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QLogValue3DAxisFormatter")
+		qt.DisconnectSignal(ptr.Pointer(), "~QLogValue3DAxisFormatter")
 	}
 }
 
 func (ptr *QLogValue3DAxisFormatter) DestroyQLogValue3DAxisFormatter() {
 	if ptr.Pointer() != nil {
 		C.QLogValue3DAxisFormatter_DestroyQLogValue3DAxisFormatter(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13075,7 +13110,7 @@ func (ptr *QLogValue3DAxisFormatter) DestroyQLogValue3DAxisFormatter() {
 func (ptr *QLogValue3DAxisFormatter) DestroyQLogValue3DAxisFormatterDefault() {
 	if ptr.Pointer() != nil {
 		C.QLogValue3DAxisFormatter_DestroyQLogValue3DAxisFormatterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13156,7 +13191,7 @@ func (ptr *QScatter3DSeries) InvalidSelectionIndex() int {
 
 //export callbackQScatter3DSeries_DataProxyChanged
 func callbackQScatter3DSeries_DataProxyChanged(ptr unsafe.Pointer, proxy unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataProxyChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataProxyChanged"); signal != nil {
 		signal.(func(*QScatterDataProxy))(NewQScatterDataProxyFromPointer(proxy))
 	}
 
@@ -13165,14 +13200,14 @@ func callbackQScatter3DSeries_DataProxyChanged(ptr unsafe.Pointer, proxy unsafe.
 func (ptr *QScatter3DSeries) ConnectDataProxyChanged(f func(proxy *QScatterDataProxy)) {
 	if ptr.Pointer() != nil {
 		C.QScatter3DSeries_ConnectDataProxyChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dataProxyChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "dataProxyChanged", f)
 	}
 }
 
 func (ptr *QScatter3DSeries) DisconnectDataProxyChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatter3DSeries_DisconnectDataProxyChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dataProxyChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "dataProxyChanged")
 	}
 }
 
@@ -13184,7 +13219,7 @@ func (ptr *QScatter3DSeries) DataProxyChanged(proxy QScatterDataProxy_ITF) {
 
 //export callbackQScatter3DSeries_ItemSizeChanged
 func callbackQScatter3DSeries_ItemSizeChanged(ptr unsafe.Pointer, size C.float) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemSizeChanged"); signal != nil {
 		signal.(func(float32))(float32(size))
 	}
 
@@ -13193,14 +13228,14 @@ func callbackQScatter3DSeries_ItemSizeChanged(ptr unsafe.Pointer, size C.float)
 func (ptr *QScatter3DSeries) ConnectItemSizeChanged(f func(size float32)) {
 	if ptr.Pointer() != nil {
 		C.QScatter3DSeries_ConnectItemSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemSizeChanged", f)
 	}
 }
 
 func (ptr *QScatter3DSeries) DisconnectItemSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatter3DSeries_DisconnectItemSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemSizeChanged")
 	}
 }
 
@@ -13212,7 +13247,7 @@ func (ptr *QScatter3DSeries) ItemSizeChanged(size float32) {
 
 //export callbackQScatter3DSeries_SelectedItemChanged
 func callbackQScatter3DSeries_SelectedItemChanged(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedItemChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedItemChanged"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -13221,14 +13256,14 @@ func callbackQScatter3DSeries_SelectedItemChanged(ptr unsafe.Pointer, index C.in
 func (ptr *QScatter3DSeries) ConnectSelectedItemChanged(f func(index int)) {
 	if ptr.Pointer() != nil {
 		C.QScatter3DSeries_ConnectSelectedItemChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedItemChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedItemChanged", f)
 	}
 }
 
 func (ptr *QScatter3DSeries) DisconnectSelectedItemChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatter3DSeries_DisconnectSelectedItemChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedItemChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedItemChanged")
 	}
 }
 
@@ -13258,7 +13293,7 @@ func (ptr *QScatter3DSeries) SetSelectedItem(index int) {
 
 //export callbackQScatter3DSeries_DestroyQScatter3DSeries
 func callbackQScatter3DSeries_DestroyQScatter3DSeries(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QScatter3DSeries"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QScatter3DSeries"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScatter3DSeriesFromPointer(ptr).DestroyQScatter3DSeriesDefault()
@@ -13268,21 +13303,21 @@ func callbackQScatter3DSeries_DestroyQScatter3DSeries(ptr unsafe.Pointer) {
 func (ptr *QScatter3DSeries) ConnectDestroyQScatter3DSeries(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QScatter3DSeries", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QScatter3DSeries", f)
 	}
 }
 
 func (ptr *QScatter3DSeries) DisconnectDestroyQScatter3DSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QScatter3DSeries")
+		qt.DisconnectSignal(ptr.Pointer(), "~QScatter3DSeries")
 	}
 }
 
 func (ptr *QScatter3DSeries) DestroyQScatter3DSeries() {
 	if ptr.Pointer() != nil {
 		C.QScatter3DSeries_DestroyQScatter3DSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13290,7 +13325,7 @@ func (ptr *QScatter3DSeries) DestroyQScatter3DSeries() {
 func (ptr *QScatter3DSeries) DestroyQScatter3DSeriesDefault() {
 	if ptr.Pointer() != nil {
 		C.QScatter3DSeries_DestroyQScatter3DSeriesDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13503,7 +13538,7 @@ func (ptr *QScatterDataProxy) AddItem(item QScatterDataItem_ITF) int {
 
 //export callbackQScatterDataProxy_ArrayReset
 func callbackQScatterDataProxy_ArrayReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "arrayReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "arrayReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13512,14 +13547,14 @@ func callbackQScatterDataProxy_ArrayReset(ptr unsafe.Pointer) {
 func (ptr *QScatterDataProxy) ConnectArrayReset(f func()) {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_ConnectArrayReset(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "arrayReset", f)
+		qt.ConnectSignal(ptr.Pointer(), "arrayReset", f)
 	}
 }
 
 func (ptr *QScatterDataProxy) DisconnectArrayReset() {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_DisconnectArrayReset(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "arrayReset")
+		qt.DisconnectSignal(ptr.Pointer(), "arrayReset")
 	}
 }
 
@@ -13537,7 +13572,7 @@ func (ptr *QScatterDataProxy) InsertItem(index int, item QScatterDataItem_ITF) {
 
 //export callbackQScatterDataProxy_ItemCountChanged
 func callbackQScatterDataProxy_ItemCountChanged(ptr unsafe.Pointer, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(count)))
 	}
 
@@ -13546,14 +13581,14 @@ func callbackQScatterDataProxy_ItemCountChanged(ptr unsafe.Pointer, count C.int)
 func (ptr *QScatterDataProxy) ConnectItemCountChanged(f func(count int)) {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_ConnectItemCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemCountChanged", f)
 	}
 }
 
 func (ptr *QScatterDataProxy) DisconnectItemCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_DisconnectItemCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemCountChanged")
 	}
 }
 
@@ -13565,7 +13600,7 @@ func (ptr *QScatterDataProxy) ItemCountChanged(count int) {
 
 //export callbackQScatterDataProxy_ItemsAdded
 func callbackQScatterDataProxy_ItemsAdded(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemsAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemsAdded"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -13574,14 +13609,14 @@ func callbackQScatterDataProxy_ItemsAdded(ptr unsafe.Pointer, startIndex C.int,
 func (ptr *QScatterDataProxy) ConnectItemsAdded(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_ConnectItemsAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemsAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemsAdded", f)
 	}
 }
 
 func (ptr *QScatterDataProxy) DisconnectItemsAdded() {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_DisconnectItemsAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemsAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "itemsAdded")
 	}
 }
 
@@ -13593,7 +13628,7 @@ func (ptr *QScatterDataProxy) ItemsAdded(startIndex int, count int) {
 
 //export callbackQScatterDataProxy_ItemsChanged
 func callbackQScatterDataProxy_ItemsChanged(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemsChanged"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -13602,14 +13637,14 @@ func callbackQScatterDataProxy_ItemsChanged(ptr unsafe.Pointer, startIndex C.int
 func (ptr *QScatterDataProxy) ConnectItemsChanged(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_ConnectItemsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemsChanged", f)
 	}
 }
 
 func (ptr *QScatterDataProxy) DisconnectItemsChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_DisconnectItemsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemsChanged")
 	}
 }
 
@@ -13621,7 +13656,7 @@ func (ptr *QScatterDataProxy) ItemsChanged(startIndex int, count int) {
 
 //export callbackQScatterDataProxy_ItemsInserted
 func callbackQScatterDataProxy_ItemsInserted(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemsInserted"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -13630,14 +13665,14 @@ func callbackQScatterDataProxy_ItemsInserted(ptr unsafe.Pointer, startIndex C.in
 func (ptr *QScatterDataProxy) ConnectItemsInserted(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_ConnectItemsInserted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemsInserted", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemsInserted", f)
 	}
 }
 
 func (ptr *QScatterDataProxy) DisconnectItemsInserted() {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_DisconnectItemsInserted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemsInserted")
+		qt.DisconnectSignal(ptr.Pointer(), "itemsInserted")
 	}
 }
 
@@ -13649,7 +13684,7 @@ func (ptr *QScatterDataProxy) ItemsInserted(startIndex int, count int) {
 
 //export callbackQScatterDataProxy_ItemsRemoved
 func callbackQScatterDataProxy_ItemsRemoved(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemsRemoved"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -13658,14 +13693,14 @@ func callbackQScatterDataProxy_ItemsRemoved(ptr unsafe.Pointer, startIndex C.int
 func (ptr *QScatterDataProxy) ConnectItemsRemoved(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_ConnectItemsRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemsRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemsRemoved", f)
 	}
 }
 
 func (ptr *QScatterDataProxy) DisconnectItemsRemoved() {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_DisconnectItemsRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemsRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "itemsRemoved")
 	}
 }
 
@@ -13683,7 +13718,7 @@ func (ptr *QScatterDataProxy) RemoveItems(index int, removeCount int) {
 
 //export callbackQScatterDataProxy_SeriesChanged
 func callbackQScatterDataProxy_SeriesChanged(ptr unsafe.Pointer, series unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesChanged"); signal != nil {
 		signal.(func(*QScatter3DSeries))(NewQScatter3DSeriesFromPointer(series))
 	}
 
@@ -13692,14 +13727,14 @@ func callbackQScatterDataProxy_SeriesChanged(ptr unsafe.Pointer, series unsafe.P
 func (ptr *QScatterDataProxy) ConnectSeriesChanged(f func(series *QScatter3DSeries)) {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_ConnectSeriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesChanged", f)
 	}
 }
 
 func (ptr *QScatterDataProxy) DisconnectSeriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_DisconnectSeriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesChanged")
 	}
 }
 
@@ -13717,7 +13752,7 @@ func (ptr *QScatterDataProxy) SetItem(index int, item QScatterDataItem_ITF) {
 
 //export callbackQScatterDataProxy_DestroyQScatterDataProxy
 func callbackQScatterDataProxy_DestroyQScatterDataProxy(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QScatterDataProxy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QScatterDataProxy"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScatterDataProxyFromPointer(ptr).DestroyQScatterDataProxyDefault()
@@ -13727,21 +13762,21 @@ func callbackQScatterDataProxy_DestroyQScatterDataProxy(ptr unsafe.Pointer) {
 func (ptr *QScatterDataProxy) ConnectDestroyQScatterDataProxy(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QScatterDataProxy", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QScatterDataProxy", f)
 	}
 }
 
 func (ptr *QScatterDataProxy) DisconnectDestroyQScatterDataProxy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QScatterDataProxy")
+		qt.DisconnectSignal(ptr.Pointer(), "~QScatterDataProxy")
 	}
 }
 
 func (ptr *QScatterDataProxy) DestroyQScatterDataProxy() {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_DestroyQScatterDataProxy(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13749,7 +13784,7 @@ func (ptr *QScatterDataProxy) DestroyQScatterDataProxy() {
 func (ptr *QScatterDataProxy) DestroyQScatterDataProxyDefault() {
 	if ptr.Pointer() != nil {
 		C.QScatterDataProxy_DestroyQScatterDataProxyDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13825,7 +13860,7 @@ const (
 
 //export callbackQSurface3DSeries_SelectedPointChanged
 func callbackQSurface3DSeries_SelectedPointChanged(ptr unsafe.Pointer, position unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedPointChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedPointChanged"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(position))
 	}
 
@@ -13834,14 +13869,14 @@ func callbackQSurface3DSeries_SelectedPointChanged(ptr unsafe.Pointer, position
 func (ptr *QSurface3DSeries) ConnectSelectedPointChanged(f func(position *core.QPoint)) {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_ConnectSelectedPointChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedPointChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedPointChanged", f)
 	}
 }
 
 func (ptr *QSurface3DSeries) DisconnectSelectedPointChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_DisconnectSelectedPointChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedPointChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedPointChanged")
 	}
 }
 
@@ -13879,7 +13914,7 @@ func NewQSurface3DSeries2(dataProxy QSurfaceDataProxy_ITF, parent core.QObject_I
 
 //export callbackQSurface3DSeries_DataProxyChanged
 func callbackQSurface3DSeries_DataProxyChanged(ptr unsafe.Pointer, proxy unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataProxyChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataProxyChanged"); signal != nil {
 		signal.(func(*QSurfaceDataProxy))(NewQSurfaceDataProxyFromPointer(proxy))
 	}
 
@@ -13888,14 +13923,14 @@ func callbackQSurface3DSeries_DataProxyChanged(ptr unsafe.Pointer, proxy unsafe.
 func (ptr *QSurface3DSeries) ConnectDataProxyChanged(f func(proxy *QSurfaceDataProxy)) {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_ConnectDataProxyChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dataProxyChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "dataProxyChanged", f)
 	}
 }
 
 func (ptr *QSurface3DSeries) DisconnectDataProxyChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_DisconnectDataProxyChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dataProxyChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "dataProxyChanged")
 	}
 }
 
@@ -13907,7 +13942,7 @@ func (ptr *QSurface3DSeries) DataProxyChanged(proxy QSurfaceDataProxy_ITF) {
 
 //export callbackQSurface3DSeries_DrawModeChanged
 func callbackQSurface3DSeries_DrawModeChanged(ptr unsafe.Pointer, mode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawModeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawModeChanged"); signal != nil {
 		signal.(func(QSurface3DSeries__DrawFlag))(QSurface3DSeries__DrawFlag(mode))
 	}
 
@@ -13916,14 +13951,14 @@ func callbackQSurface3DSeries_DrawModeChanged(ptr unsafe.Pointer, mode C.longlon
 func (ptr *QSurface3DSeries) ConnectDrawModeChanged(f func(mode QSurface3DSeries__DrawFlag)) {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_ConnectDrawModeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawModeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawModeChanged", f)
 	}
 }
 
 func (ptr *QSurface3DSeries) DisconnectDrawModeChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_DisconnectDrawModeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawModeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "drawModeChanged")
 	}
 }
 
@@ -13935,7 +13970,7 @@ func (ptr *QSurface3DSeries) DrawModeChanged(mode QSurface3DSeries__DrawFlag) {
 
 //export callbackQSurface3DSeries_FlatShadingEnabledChanged
 func callbackQSurface3DSeries_FlatShadingEnabledChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flatShadingEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flatShadingEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -13944,14 +13979,14 @@ func callbackQSurface3DSeries_FlatShadingEnabledChanged(ptr unsafe.Pointer, enab
 func (ptr *QSurface3DSeries) ConnectFlatShadingEnabledChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_ConnectFlatShadingEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "flatShadingEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "flatShadingEnabledChanged", f)
 	}
 }
 
 func (ptr *QSurface3DSeries) DisconnectFlatShadingEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_DisconnectFlatShadingEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "flatShadingEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "flatShadingEnabledChanged")
 	}
 }
 
@@ -13963,7 +13998,7 @@ func (ptr *QSurface3DSeries) FlatShadingEnabledChanged(enable bool) {
 
 //export callbackQSurface3DSeries_FlatShadingSupportedChanged
 func callbackQSurface3DSeries_FlatShadingSupportedChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flatShadingSupportedChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flatShadingSupportedChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -13972,14 +14007,14 @@ func callbackQSurface3DSeries_FlatShadingSupportedChanged(ptr unsafe.Pointer, en
 func (ptr *QSurface3DSeries) ConnectFlatShadingSupportedChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_ConnectFlatShadingSupportedChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "flatShadingSupportedChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "flatShadingSupportedChanged", f)
 	}
 }
 
 func (ptr *QSurface3DSeries) DisconnectFlatShadingSupportedChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_DisconnectFlatShadingSupportedChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "flatShadingSupportedChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "flatShadingSupportedChanged")
 	}
 }
 
@@ -14023,7 +14058,7 @@ func (ptr *QSurface3DSeries) SetTextureFile(filename string) {
 
 //export callbackQSurface3DSeries_TextureChanged
 func callbackQSurface3DSeries_TextureChanged(ptr unsafe.Pointer, image unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureChanged"); signal != nil {
 		signal.(func(*gui.QImage))(gui.NewQImageFromPointer(image))
 	}
 
@@ -14032,14 +14067,14 @@ func callbackQSurface3DSeries_TextureChanged(ptr unsafe.Pointer, image unsafe.Po
 func (ptr *QSurface3DSeries) ConnectTextureChanged(f func(image *gui.QImage)) {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_ConnectTextureChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureChanged", f)
 	}
 }
 
 func (ptr *QSurface3DSeries) DisconnectTextureChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_DisconnectTextureChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureChanged")
 	}
 }
 
@@ -14051,7 +14086,7 @@ func (ptr *QSurface3DSeries) TextureChanged(image gui.QImage_ITF) {
 
 //export callbackQSurface3DSeries_TextureFileChanged
 func callbackQSurface3DSeries_TextureFileChanged(ptr unsafe.Pointer, filename C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureFileChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureFileChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(filename))
 	}
 
@@ -14060,14 +14095,14 @@ func callbackQSurface3DSeries_TextureFileChanged(ptr unsafe.Pointer, filename C.
 func (ptr *QSurface3DSeries) ConnectTextureFileChanged(f func(filename string)) {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_ConnectTextureFileChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureFileChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureFileChanged", f)
 	}
 }
 
 func (ptr *QSurface3DSeries) DisconnectTextureFileChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_DisconnectTextureFileChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureFileChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureFileChanged")
 	}
 }
 
@@ -14081,7 +14116,7 @@ func (ptr *QSurface3DSeries) TextureFileChanged(filename string) {
 
 //export callbackQSurface3DSeries_DestroyQSurface3DSeries
 func callbackQSurface3DSeries_DestroyQSurface3DSeries(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSurface3DSeries"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSurface3DSeries"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSurface3DSeriesFromPointer(ptr).DestroyQSurface3DSeriesDefault()
@@ -14091,21 +14126,21 @@ func callbackQSurface3DSeries_DestroyQSurface3DSeries(ptr unsafe.Pointer) {
 func (ptr *QSurface3DSeries) ConnectDestroyQSurface3DSeries(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSurface3DSeries", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSurface3DSeries", f)
 	}
 }
 
 func (ptr *QSurface3DSeries) DisconnectDestroyQSurface3DSeries() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSurface3DSeries")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSurface3DSeries")
 	}
 }
 
 func (ptr *QSurface3DSeries) DestroyQSurface3DSeries() {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_DestroyQSurface3DSeries(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14113,7 +14148,7 @@ func (ptr *QSurface3DSeries) DestroyQSurface3DSeries() {
 func (ptr *QSurface3DSeries) DestroyQSurface3DSeriesDefault() {
 	if ptr.Pointer() != nil {
 		C.QSurface3DSeries_DestroyQSurface3DSeriesDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14330,7 +14365,7 @@ func NewQSurfaceDataProxy(parent core.QObject_ITF) *QSurfaceDataProxy {
 
 //export callbackQSurfaceDataProxy_ArrayReset
 func callbackQSurfaceDataProxy_ArrayReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "arrayReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "arrayReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14339,14 +14374,14 @@ func callbackQSurfaceDataProxy_ArrayReset(ptr unsafe.Pointer) {
 func (ptr *QSurfaceDataProxy) ConnectArrayReset(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_ConnectArrayReset(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "arrayReset", f)
+		qt.ConnectSignal(ptr.Pointer(), "arrayReset", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectArrayReset() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DisconnectArrayReset(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "arrayReset")
+		qt.DisconnectSignal(ptr.Pointer(), "arrayReset")
 	}
 }
 
@@ -14358,7 +14393,7 @@ func (ptr *QSurfaceDataProxy) ArrayReset() {
 
 //export callbackQSurfaceDataProxy_ColumnCountChanged
 func callbackQSurfaceDataProxy_ColumnCountChanged(ptr unsafe.Pointer, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(count)))
 	}
 
@@ -14367,14 +14402,14 @@ func callbackQSurfaceDataProxy_ColumnCountChanged(ptr unsafe.Pointer, count C.in
 func (ptr *QSurfaceDataProxy) ConnectColumnCountChanged(f func(count int)) {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_ConnectColumnCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCountChanged", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectColumnCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DisconnectColumnCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCountChanged")
 	}
 }
 
@@ -14386,7 +14421,7 @@ func (ptr *QSurfaceDataProxy) ColumnCountChanged(count int) {
 
 //export callbackQSurfaceDataProxy_ItemChanged
 func callbackQSurfaceDataProxy_ItemChanged(ptr unsafe.Pointer, rowIndex C.int, columnIndex C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemChanged"); signal != nil {
 		signal.(func(int, int))(int(int32(rowIndex)), int(int32(columnIndex)))
 	}
 
@@ -14395,14 +14430,14 @@ func callbackQSurfaceDataProxy_ItemChanged(ptr unsafe.Pointer, rowIndex C.int, c
 func (ptr *QSurfaceDataProxy) ConnectItemChanged(f func(rowIndex int, columnIndex int)) {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_ConnectItemChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemChanged", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectItemChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DisconnectItemChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemChanged")
 	}
 }
 
@@ -14420,7 +14455,7 @@ func (ptr *QSurfaceDataProxy) RemoveRows(rowIndex int, removeCount int) {
 
 //export callbackQSurfaceDataProxy_RowCountChanged
 func callbackQSurfaceDataProxy_RowCountChanged(ptr unsafe.Pointer, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(count)))
 	}
 
@@ -14429,14 +14464,14 @@ func callbackQSurfaceDataProxy_RowCountChanged(ptr unsafe.Pointer, count C.int)
 func (ptr *QSurfaceDataProxy) ConnectRowCountChanged(f func(count int)) {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_ConnectRowCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCountChanged", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectRowCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DisconnectRowCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCountChanged")
 	}
 }
 
@@ -14448,7 +14483,7 @@ func (ptr *QSurfaceDataProxy) RowCountChanged(count int) {
 
 //export callbackQSurfaceDataProxy_RowsAdded
 func callbackQSurfaceDataProxy_RowsAdded(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAdded"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -14457,14 +14492,14 @@ func callbackQSurfaceDataProxy_RowsAdded(ptr unsafe.Pointer, startIndex C.int, c
 func (ptr *QSurfaceDataProxy) ConnectRowsAdded(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_ConnectRowsAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsAdded", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectRowsAdded() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DisconnectRowsAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsAdded")
 	}
 }
 
@@ -14476,7 +14511,7 @@ func (ptr *QSurfaceDataProxy) RowsAdded(startIndex int, count int) {
 
 //export callbackQSurfaceDataProxy_RowsChanged
 func callbackQSurfaceDataProxy_RowsChanged(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsChanged"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -14485,14 +14520,14 @@ func callbackQSurfaceDataProxy_RowsChanged(ptr unsafe.Pointer, startIndex C.int,
 func (ptr *QSurfaceDataProxy) ConnectRowsChanged(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_ConnectRowsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsChanged", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectRowsChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DisconnectRowsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsChanged")
 	}
 }
 
@@ -14504,7 +14539,7 @@ func (ptr *QSurfaceDataProxy) RowsChanged(startIndex int, count int) {
 
 //export callbackQSurfaceDataProxy_RowsInserted
 func callbackQSurfaceDataProxy_RowsInserted(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsInserted"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -14513,14 +14548,14 @@ func callbackQSurfaceDataProxy_RowsInserted(ptr unsafe.Pointer, startIndex C.int
 func (ptr *QSurfaceDataProxy) ConnectRowsInserted(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_ConnectRowsInserted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsInserted", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsInserted", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectRowsInserted() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DisconnectRowsInserted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsInserted")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsInserted")
 	}
 }
 
@@ -14532,7 +14567,7 @@ func (ptr *QSurfaceDataProxy) RowsInserted(startIndex int, count int) {
 
 //export callbackQSurfaceDataProxy_RowsRemoved
 func callbackQSurfaceDataProxy_RowsRemoved(ptr unsafe.Pointer, startIndex C.int, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsRemoved"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(count)))
 	}
 
@@ -14541,14 +14576,14 @@ func callbackQSurfaceDataProxy_RowsRemoved(ptr unsafe.Pointer, startIndex C.int,
 func (ptr *QSurfaceDataProxy) ConnectRowsRemoved(f func(startIndex int, count int)) {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_ConnectRowsRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowsRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowsRemoved", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectRowsRemoved() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DisconnectRowsRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowsRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "rowsRemoved")
 	}
 }
 
@@ -14560,7 +14595,7 @@ func (ptr *QSurfaceDataProxy) RowsRemoved(startIndex int, count int) {
 
 //export callbackQSurfaceDataProxy_SeriesChanged
 func callbackQSurfaceDataProxy_SeriesChanged(ptr unsafe.Pointer, series unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seriesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seriesChanged"); signal != nil {
 		signal.(func(*QSurface3DSeries))(NewQSurface3DSeriesFromPointer(series))
 	}
 
@@ -14569,14 +14604,14 @@ func callbackQSurfaceDataProxy_SeriesChanged(ptr unsafe.Pointer, series unsafe.P
 func (ptr *QSurfaceDataProxy) ConnectSeriesChanged(f func(series *QSurface3DSeries)) {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_ConnectSeriesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "seriesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "seriesChanged", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectSeriesChanged() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DisconnectSeriesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "seriesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "seriesChanged")
 	}
 }
 
@@ -14600,7 +14635,7 @@ func (ptr *QSurfaceDataProxy) SetItem(rowIndex int, columnIndex int, item QSurfa
 
 //export callbackQSurfaceDataProxy_DestroyQSurfaceDataProxy
 func callbackQSurfaceDataProxy_DestroyQSurfaceDataProxy(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSurfaceDataProxy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSurfaceDataProxy"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSurfaceDataProxyFromPointer(ptr).DestroyQSurfaceDataProxyDefault()
@@ -14610,21 +14645,21 @@ func callbackQSurfaceDataProxy_DestroyQSurfaceDataProxy(ptr unsafe.Pointer) {
 func (ptr *QSurfaceDataProxy) ConnectDestroyQSurfaceDataProxy(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSurfaceDataProxy", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSurfaceDataProxy", f)
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DisconnectDestroyQSurfaceDataProxy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSurfaceDataProxy")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSurfaceDataProxy")
 	}
 }
 
 func (ptr *QSurfaceDataProxy) DestroyQSurfaceDataProxy() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DestroyQSurfaceDataProxy(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14632,7 +14667,7 @@ func (ptr *QSurfaceDataProxy) DestroyQSurfaceDataProxy() {
 func (ptr *QSurfaceDataProxy) DestroyQSurfaceDataProxyDefault() {
 	if ptr.Pointer() != nil {
 		C.QSurfaceDataProxy_DestroyQSurfaceDataProxyDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14715,7 +14750,7 @@ func NewQTouch3DInputHandler(parent core.QObject_ITF) *QTouch3DInputHandler {
 
 //export callbackQTouch3DInputHandler_TouchEvent
 func callbackQTouch3DInputHandler_TouchEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "touchEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "touchEvent"); signal != nil {
 		signal.(func(*gui.QTouchEvent))(gui.NewQTouchEventFromPointer(event))
 	} else {
 		NewQTouch3DInputHandlerFromPointer(ptr).TouchEventDefault(gui.NewQTouchEventFromPointer(event))
@@ -14725,14 +14760,14 @@ func callbackQTouch3DInputHandler_TouchEvent(ptr unsafe.Pointer, event unsafe.Po
 func (ptr *QTouch3DInputHandler) ConnectTouchEvent(f func(event *gui.QTouchEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "touchEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "touchEvent", f)
 	}
 }
 
 func (ptr *QTouch3DInputHandler) DisconnectTouchEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "touchEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "touchEvent")
 	}
 }
 
@@ -14750,7 +14785,7 @@ func (ptr *QTouch3DInputHandler) TouchEventDefault(event gui.QTouchEvent_ITF) {
 
 //export callbackQTouch3DInputHandler_DestroyQTouch3DInputHandler
 func callbackQTouch3DInputHandler_DestroyQTouch3DInputHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTouch3DInputHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTouch3DInputHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTouch3DInputHandlerFromPointer(ptr).DestroyQTouch3DInputHandlerDefault()
@@ -14760,21 +14795,21 @@ func callbackQTouch3DInputHandler_DestroyQTouch3DInputHandler(ptr unsafe.Pointer
 func (ptr *QTouch3DInputHandler) ConnectDestroyQTouch3DInputHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTouch3DInputHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTouch3DInputHandler", f)
 	}
 }
 
 func (ptr *QTouch3DInputHandler) DisconnectDestroyQTouch3DInputHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTouch3DInputHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTouch3DInputHandler")
 	}
 }
 
 func (ptr *QTouch3DInputHandler) DestroyQTouch3DInputHandler() {
 	if ptr.Pointer() != nil {
 		C.QTouch3DInputHandler_DestroyQTouch3DInputHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14782,7 +14817,7 @@ func (ptr *QTouch3DInputHandler) DestroyQTouch3DInputHandler() {
 func (ptr *QTouch3DInputHandler) DestroyQTouch3DInputHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.QTouch3DInputHandler_DestroyQTouch3DInputHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14830,7 +14865,7 @@ func NewQValue3DAxis(parent core.QObject_ITF) *QValue3DAxis {
 
 //export callbackQValue3DAxis_FormatterChanged
 func callbackQValue3DAxis_FormatterChanged(ptr unsafe.Pointer, formatter unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formatterChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formatterChanged"); signal != nil {
 		signal.(func(*QValue3DAxisFormatter))(NewQValue3DAxisFormatterFromPointer(formatter))
 	}
 
@@ -14839,14 +14874,14 @@ func callbackQValue3DAxis_FormatterChanged(ptr unsafe.Pointer, formatter unsafe.
 func (ptr *QValue3DAxis) ConnectFormatterChanged(f func(formatter *QValue3DAxisFormatter)) {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_ConnectFormatterChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formatterChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "formatterChanged", f)
 	}
 }
 
 func (ptr *QValue3DAxis) DisconnectFormatterChanged() {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_DisconnectFormatterChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formatterChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "formatterChanged")
 	}
 }
 
@@ -14858,7 +14893,7 @@ func (ptr *QValue3DAxis) FormatterChanged(formatter QValue3DAxisFormatter_ITF) {
 
 //export callbackQValue3DAxis_LabelFormatChanged
 func callbackQValue3DAxis_LabelFormatChanged(ptr unsafe.Pointer, format C.struct_QtDataVisualization_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "labelFormatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "labelFormatChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(format))
 	}
 
@@ -14867,14 +14902,14 @@ func callbackQValue3DAxis_LabelFormatChanged(ptr unsafe.Pointer, format C.struct
 func (ptr *QValue3DAxis) ConnectLabelFormatChanged(f func(format string)) {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_ConnectLabelFormatChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "labelFormatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "labelFormatChanged", f)
 	}
 }
 
 func (ptr *QValue3DAxis) DisconnectLabelFormatChanged() {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_DisconnectLabelFormatChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "labelFormatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "labelFormatChanged")
 	}
 }
 
@@ -14888,7 +14923,7 @@ func (ptr *QValue3DAxis) LabelFormatChanged(format string) {
 
 //export callbackQValue3DAxis_ReversedChanged
 func callbackQValue3DAxis_ReversedChanged(ptr unsafe.Pointer, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reversedChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reversedChanged"); signal != nil {
 		signal.(func(bool))(int8(enable) != 0)
 	}
 
@@ -14897,14 +14932,14 @@ func callbackQValue3DAxis_ReversedChanged(ptr unsafe.Pointer, enable C.char) {
 func (ptr *QValue3DAxis) ConnectReversedChanged(f func(enable bool)) {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_ConnectReversedChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reversedChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "reversedChanged", f)
 	}
 }
 
 func (ptr *QValue3DAxis) DisconnectReversedChanged() {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_DisconnectReversedChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reversedChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "reversedChanged")
 	}
 }
 
@@ -14916,7 +14951,7 @@ func (ptr *QValue3DAxis) ReversedChanged(enable bool) {
 
 //export callbackQValue3DAxis_SegmentCountChanged
 func callbackQValue3DAxis_SegmentCountChanged(ptr unsafe.Pointer, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "segmentCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "segmentCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(count)))
 	}
 
@@ -14925,14 +14960,14 @@ func callbackQValue3DAxis_SegmentCountChanged(ptr unsafe.Pointer, count C.int) {
 func (ptr *QValue3DAxis) ConnectSegmentCountChanged(f func(count int)) {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_ConnectSegmentCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "segmentCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "segmentCountChanged", f)
 	}
 }
 
 func (ptr *QValue3DAxis) DisconnectSegmentCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_DisconnectSegmentCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "segmentCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "segmentCountChanged")
 	}
 }
 
@@ -14976,7 +15011,7 @@ func (ptr *QValue3DAxis) SetSubSegmentCount(count int) {
 
 //export callbackQValue3DAxis_SubSegmentCountChanged
 func callbackQValue3DAxis_SubSegmentCountChanged(ptr unsafe.Pointer, count C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "subSegmentCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "subSegmentCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(count)))
 	}
 
@@ -14985,14 +15020,14 @@ func callbackQValue3DAxis_SubSegmentCountChanged(ptr unsafe.Pointer, count C.int
 func (ptr *QValue3DAxis) ConnectSubSegmentCountChanged(f func(count int)) {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_ConnectSubSegmentCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "subSegmentCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "subSegmentCountChanged", f)
 	}
 }
 
 func (ptr *QValue3DAxis) DisconnectSubSegmentCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_DisconnectSubSegmentCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "subSegmentCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "subSegmentCountChanged")
 	}
 }
 
@@ -15004,7 +15039,7 @@ func (ptr *QValue3DAxis) SubSegmentCountChanged(count int) {
 
 //export callbackQValue3DAxis_DestroyQValue3DAxis
 func callbackQValue3DAxis_DestroyQValue3DAxis(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QValue3DAxis"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QValue3DAxis"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQValue3DAxisFromPointer(ptr).DestroyQValue3DAxisDefault()
@@ -15014,21 +15049,21 @@ func callbackQValue3DAxis_DestroyQValue3DAxis(ptr unsafe.Pointer) {
 func (ptr *QValue3DAxis) ConnectDestroyQValue3DAxis(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QValue3DAxis", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QValue3DAxis", f)
 	}
 }
 
 func (ptr *QValue3DAxis) DisconnectDestroyQValue3DAxis() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QValue3DAxis")
+		qt.DisconnectSignal(ptr.Pointer(), "~QValue3DAxis")
 	}
 }
 
 func (ptr *QValue3DAxis) DestroyQValue3DAxis() {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_DestroyQValue3DAxis(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15036,7 +15071,7 @@ func (ptr *QValue3DAxis) DestroyQValue3DAxis() {
 func (ptr *QValue3DAxis) DestroyQValue3DAxisDefault() {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxis_DestroyQValue3DAxisDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15125,7 +15160,7 @@ func (ptr *QValue3DAxisFormatter) MarkDirty(labelsChange bool) {
 
 //export callbackQValue3DAxisFormatter_Recalculate
 func callbackQValue3DAxisFormatter_Recalculate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "recalculate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "recalculate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQValue3DAxisFormatterFromPointer(ptr).RecalculateDefault()
@@ -15135,14 +15170,14 @@ func callbackQValue3DAxisFormatter_Recalculate(ptr unsafe.Pointer) {
 func (ptr *QValue3DAxisFormatter) ConnectRecalculate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "recalculate", f)
+		qt.ConnectSignal(ptr.Pointer(), "recalculate", f)
 	}
 }
 
 func (ptr *QValue3DAxisFormatter) DisconnectRecalculate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "recalculate")
+		qt.DisconnectSignal(ptr.Pointer(), "recalculate")
 	}
 }
 
@@ -15178,7 +15213,7 @@ func (ptr *QValue3DAxisFormatter) SetLocale(locale core.QLocale_ITF) {
 
 //export callbackQValue3DAxisFormatter_DestroyQValue3DAxisFormatter
 func callbackQValue3DAxisFormatter_DestroyQValue3DAxisFormatter(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QValue3DAxisFormatter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QValue3DAxisFormatter"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQValue3DAxisFormatterFromPointer(ptr).DestroyQValue3DAxisFormatterDefault()
@@ -15188,21 +15223,21 @@ func callbackQValue3DAxisFormatter_DestroyQValue3DAxisFormatter(ptr unsafe.Point
 func (ptr *QValue3DAxisFormatter) ConnectDestroyQValue3DAxisFormatter(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QValue3DAxisFormatter", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QValue3DAxisFormatter", f)
 	}
 }
 
 func (ptr *QValue3DAxisFormatter) DisconnectDestroyQValue3DAxisFormatter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QValue3DAxisFormatter")
+		qt.DisconnectSignal(ptr.Pointer(), "~QValue3DAxisFormatter")
 	}
 }
 
 func (ptr *QValue3DAxisFormatter) DestroyQValue3DAxisFormatter() {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxisFormatter_DestroyQValue3DAxisFormatter(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15210,7 +15245,7 @@ func (ptr *QValue3DAxisFormatter) DestroyQValue3DAxisFormatter() {
 func (ptr *QValue3DAxisFormatter) DestroyQValue3DAxisFormatterDefault() {
 	if ptr.Pointer() != nil {
 		C.QValue3DAxisFormatter_DestroyQValue3DAxisFormatterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15226,7 +15261,7 @@ func (ptr *QValue3DAxisFormatter) Locale() *core.QLocale {
 
 //export callbackQValue3DAxisFormatter_StringForValue
 func callbackQValue3DAxisFormatter_StringForValue(ptr unsafe.Pointer, value C.double, format C.struct_QtDataVisualization_PackedString) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stringForValue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stringForValue"); signal != nil {
 		return C.CString(signal.(func(float64, string) string)(float64(value), cGoUnpackString(format)))
 	}
 
@@ -15236,14 +15271,14 @@ func callbackQValue3DAxisFormatter_StringForValue(ptr unsafe.Pointer, value C.do
 func (ptr *QValue3DAxisFormatter) ConnectStringForValue(f func(value float64, format string) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stringForValue", f)
+		qt.ConnectSignal(ptr.Pointer(), "stringForValue", f)
 	}
 }
 
 func (ptr *QValue3DAxisFormatter) DisconnectStringForValue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stringForValue")
+		qt.DisconnectSignal(ptr.Pointer(), "stringForValue")
 	}
 }
 
@@ -15267,7 +15302,7 @@ func (ptr *QValue3DAxisFormatter) StringForValueDefault(value float64, format st
 
 func (ptr *QValue3DAxisFormatter) LabelStrings() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QValue3DAxisFormatter_LabelStrings(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QValue3DAxisFormatter_LabelStrings(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -15281,7 +15316,7 @@ func (ptr *QValue3DAxisFormatter) Axis() *QValue3DAxis {
 
 //export callbackQValue3DAxisFormatter_CreateNewInstance
 func callbackQValue3DAxisFormatter_CreateNewInstance(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createNewInstance"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createNewInstance"); signal != nil {
 		return PointerFromQValue3DAxisFormatter(signal.(func() *QValue3DAxisFormatter)())
 	}
 
@@ -15291,14 +15326,14 @@ func callbackQValue3DAxisFormatter_CreateNewInstance(ptr unsafe.Pointer) unsafe.
 func (ptr *QValue3DAxisFormatter) ConnectCreateNewInstance(f func() *QValue3DAxisFormatter) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createNewInstance", f)
+		qt.ConnectSignal(ptr.Pointer(), "createNewInstance", f)
 	}
 }
 
 func (ptr *QValue3DAxisFormatter) DisconnectCreateNewInstance() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createNewInstance")
+		qt.DisconnectSignal(ptr.Pointer(), "createNewInstance")
 	}
 }
 
@@ -15320,8 +15355,10 @@ func (ptr *QValue3DAxisFormatter) GridPositions() []float32 {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtDataVisualization_PackedList) []float32 {
 			var out = make([]float32, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQValue3DAxisFormatterFromPointer(l.data).__gridPositions_atList(i)
+			var tmpList = make([]C.float, int(l.len)+1)
+			NewQValue3DAxisFormatterFromPointer(l.data).__gridPositions_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = float32(v)
 			}
 			return out
 		}(C.QValue3DAxisFormatter_GridPositions(ptr.Pointer()))
@@ -15333,8 +15370,10 @@ func (ptr *QValue3DAxisFormatter) LabelPositions() []float32 {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtDataVisualization_PackedList) []float32 {
 			var out = make([]float32, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQValue3DAxisFormatterFromPointer(l.data).__labelPositions_atList(i)
+			var tmpList = make([]C.float, int(l.len)+1)
+			NewQValue3DAxisFormatterFromPointer(l.data).__labelPositions_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = float32(v)
 			}
 			return out
 		}(C.QValue3DAxisFormatter_LabelPositions(ptr.Pointer()))
@@ -15346,8 +15385,10 @@ func (ptr *QValue3DAxisFormatter) SubGridPositions() []float32 {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtDataVisualization_PackedList) []float32 {
 			var out = make([]float32, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQValue3DAxisFormatterFromPointer(l.data).__subGridPositions_atList(i)
+			var tmpList = make([]C.float, int(l.len)+1)
+			NewQValue3DAxisFormatterFromPointer(l.data).__subGridPositions_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = float32(v)
 			}
 			return out
 		}(C.QValue3DAxisFormatter_SubGridPositions(ptr.Pointer()))
@@ -15371,7 +15412,7 @@ func (ptr *QValue3DAxisFormatter) AllowZero() bool {
 
 //export callbackQValue3DAxisFormatter_PositionAt
 func callbackQValue3DAxisFormatter_PositionAt(ptr unsafe.Pointer, value C.float) C.float {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "positionAt"); signal != nil {
+	if signal := qt.GetSignal(ptr, "positionAt"); signal != nil {
 		return C.float(signal.(func(float32) float32)(float32(value)))
 	}
 
@@ -15381,14 +15422,14 @@ func callbackQValue3DAxisFormatter_PositionAt(ptr unsafe.Pointer, value C.float)
 func (ptr *QValue3DAxisFormatter) ConnectPositionAt(f func(value float32) float32) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "positionAt", f)
+		qt.ConnectSignal(ptr.Pointer(), "positionAt", f)
 	}
 }
 
 func (ptr *QValue3DAxisFormatter) DisconnectPositionAt() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "positionAt")
+		qt.DisconnectSignal(ptr.Pointer(), "positionAt")
 	}
 }
 
@@ -15408,7 +15449,7 @@ func (ptr *QValue3DAxisFormatter) PositionAtDefault(value float32) float32 {
 
 //export callbackQValue3DAxisFormatter_ValueAt
 func callbackQValue3DAxisFormatter_ValueAt(ptr unsafe.Pointer, position C.float) C.float {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "valueAt"); signal != nil {
+	if signal := qt.GetSignal(ptr, "valueAt"); signal != nil {
 		return C.float(signal.(func(float32) float32)(float32(position)))
 	}
 
@@ -15418,14 +15459,14 @@ func callbackQValue3DAxisFormatter_ValueAt(ptr unsafe.Pointer, position C.float)
 func (ptr *QValue3DAxisFormatter) ConnectValueAt(f func(position float32) float32) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "valueAt", f)
+		qt.ConnectSignal(ptr.Pointer(), "valueAt", f)
 	}
 }
 
 func (ptr *QValue3DAxisFormatter) DisconnectValueAt() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "valueAt")
+		qt.DisconnectSignal(ptr.Pointer(), "valueAt")
 	}
 }
 
@@ -15445,7 +15486,7 @@ func (ptr *QValue3DAxisFormatter) ValueAtDefault(position float32) float32 {
 
 //export callbackQValue3DAxisFormatter_PopulateCopy
 func callbackQValue3DAxisFormatter_PopulateCopy(ptr unsafe.Pointer, copy unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "populateCopy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "populateCopy"); signal != nil {
 		signal.(func(*QValue3DAxisFormatter))(NewQValue3DAxisFormatterFromPointer(copy))
 	} else {
 		NewQValue3DAxisFormatterFromPointer(ptr).PopulateCopyDefault(NewQValue3DAxisFormatterFromPointer(copy))
@@ -15455,14 +15496,14 @@ func callbackQValue3DAxisFormatter_PopulateCopy(ptr unsafe.Pointer, copy unsafe.
 func (ptr *QValue3DAxisFormatter) ConnectPopulateCopy(f func(copy *QValue3DAxisFormatter)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "populateCopy", f)
+		qt.ConnectSignal(ptr.Pointer(), "populateCopy", f)
 	}
 }
 
 func (ptr *QValue3DAxisFormatter) DisconnectPopulateCopy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "populateCopy")
+		qt.DisconnectSignal(ptr.Pointer(), "populateCopy")
 	}
 }
 
@@ -15495,6 +15536,16 @@ func (ptr *QValue3DAxisFormatter) __gridPositions_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QValue3DAxisFormatter___gridPositions_newList(ptr.Pointer()))
 }
 
+func (ptr *QValue3DAxisFormatter) __gridPositions_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QValue3DAxisFormatter___gridPositions_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QValue3DAxisFormatter) __gridPositions_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QValue3DAxisFormatter___gridPositions_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QValue3DAxisFormatter) __labelPositions_atList(i int) float32 {
 	if ptr.Pointer() != nil {
 		return float32(C.QValue3DAxisFormatter___labelPositions_atList(ptr.Pointer(), C.int(int32(i))))
@@ -15512,6 +15563,16 @@ func (ptr *QValue3DAxisFormatter) __labelPositions_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QValue3DAxisFormatter___labelPositions_newList(ptr.Pointer()))
 }
 
+func (ptr *QValue3DAxisFormatter) __labelPositions_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QValue3DAxisFormatter___labelPositions_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QValue3DAxisFormatter) __labelPositions_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QValue3DAxisFormatter___labelPositions_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QValue3DAxisFormatter) __subGridPositions_atList(i int) float32 {
 	if ptr.Pointer() != nil {
 		return float32(C.QValue3DAxisFormatter___subGridPositions_atList(ptr.Pointer(), C.int(int32(i))))
@@ -15528,3 +15589,13 @@ func (ptr *QValue3DAxisFormatter) __subGridPositions_setList(i float32) {
 func (ptr *QValue3DAxisFormatter) __subGridPositions_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QValue3DAxisFormatter___subGridPositions_newList(ptr.Pointer()))
 }
+
+func (ptr *QValue3DAxisFormatter) __subGridPositions_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QValue3DAxisFormatter___subGridPositions_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QValue3DAxisFormatter) __subGridPositions_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QValue3DAxisFormatter___subGridPositions_fillList(ptr.Pointer(), data)
+	}
+}
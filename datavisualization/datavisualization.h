@@ -1566,12 +1566,18 @@ void QValue3DAxisFormatter_PopulateCopyDefault(void* ptr, void* copy);
 float QValue3DAxisFormatter___gridPositions_atList(void* ptr, int i);
 void QValue3DAxisFormatter___gridPositions_setList(void* ptr, float i);
 void* QValue3DAxisFormatter___gridPositions_newList(void* ptr);
+void* QValue3DAxisFormatter___gridPositions_newListBuffer(void* ptr, void* data, int count);
+void QValue3DAxisFormatter___gridPositions_fillList(void* ptr, void* data);
 float QValue3DAxisFormatter___labelPositions_atList(void* ptr, int i);
 void QValue3DAxisFormatter___labelPositions_setList(void* ptr, float i);
 void* QValue3DAxisFormatter___labelPositions_newList(void* ptr);
+void* QValue3DAxisFormatter___labelPositions_newListBuffer(void* ptr, void* data, int count);
+void QValue3DAxisFormatter___labelPositions_fillList(void* ptr, void* data);
 float QValue3DAxisFormatter___subGridPositions_atList(void* ptr, int i);
 void QValue3DAxisFormatter___subGridPositions_setList(void* ptr, float i);
 void* QValue3DAxisFormatter___subGridPositions_newList(void* ptr);
+void* QValue3DAxisFormatter___subGridPositions_newListBuffer(void* ptr, void* data, int count);
+void QValue3DAxisFormatter___subGridPositions_fillList(void* ptr, void* data);
 
 #ifdef __cplusplus
 }
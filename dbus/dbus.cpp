@@ -38,6 +38,76 @@
 #include <QTimer>
 #include <QTimerEvent>
 #include <QVariant>
+#include <QStringList>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 class MyQDBusAbstractAdaptor: public QDBusAbstractAdaptor
 {
@@ -789,9 +859,9 @@ char QDBusConnection_Connect2(void* ptr, char* service, char* path, char* interf
 char QDBusConnection_Connect3(void* ptr, char* service, char* path, char* interfa, char* name, char* argumentMatch, char* signature, void* receiver, char* slot)
 {
 	if (dynamic_cast<QDBusPendingCallWatcher*>(static_cast<QObject*>(receiver))) {
-		return static_cast<QDBusConnection*>(ptr)->connect(QString(service), QString(path), QString(interfa), QString(name), QString(argumentMatch).split("|", QString::SkipEmptyParts), QString(signature), static_cast<QDBusPendingCallWatcher*>(receiver), const_cast<const char*>(slot));
+		return static_cast<QDBusConnection*>(ptr)->connect(QString(service), QString(path), QString(interfa), QString(name), goUnpackStringList(argumentMatch), QString(signature), static_cast<QDBusPendingCallWatcher*>(receiver), const_cast<const char*>(slot));
 	} else {
-		return static_cast<QDBusConnection*>(ptr)->connect(QString(service), QString(path), QString(interfa), QString(name), QString(argumentMatch).split("|", QString::SkipEmptyParts), QString(signature), static_cast<QObject*>(receiver), const_cast<const char*>(slot));
+		return static_cast<QDBusConnection*>(ptr)->connect(QString(service), QString(path), QString(interfa), QString(name), goUnpackStringList(argumentMatch), QString(signature), static_cast<QObject*>(receiver), const_cast<const char*>(slot));
 	}
 }
 
@@ -816,9 +886,9 @@ char QDBusConnection_Disconnect2(void* ptr, char* service, char* path, char* int
 char QDBusConnection_Disconnect3(void* ptr, char* service, char* path, char* interfa, char* name, char* argumentMatch, char* signature, void* receiver, char* slot)
 {
 	if (dynamic_cast<QDBusPendingCallWatcher*>(static_cast<QObject*>(receiver))) {
-		return static_cast<QDBusConnection*>(ptr)->disconnect(QString(service), QString(path), QString(interfa), QString(name), QString(argumentMatch).split("|", QString::SkipEmptyParts), QString(signature), static_cast<QDBusPendingCallWatcher*>(receiver), const_cast<const char*>(slot));
+		return static_cast<QDBusConnection*>(ptr)->disconnect(QString(service), QString(path), QString(interfa), QString(name), goUnpackStringList(argumentMatch), QString(signature), static_cast<QDBusPendingCallWatcher*>(receiver), const_cast<const char*>(slot));
 	} else {
-		return static_cast<QDBusConnection*>(ptr)->disconnect(QString(service), QString(path), QString(interfa), QString(name), QString(argumentMatch).split("|", QString::SkipEmptyParts), QString(signature), static_cast<QObject*>(receiver), const_cast<const char*>(slot));
+		return static_cast<QDBusConnection*>(ptr)->disconnect(QString(service), QString(path), QString(interfa), QString(name), goUnpackStringList(argumentMatch), QString(signature), static_cast<QObject*>(receiver), const_cast<const char*>(slot));
 	}
 }
 
@@ -1947,7 +2017,7 @@ void QDBusServiceWatcher_ServiceUnregistered(void* ptr, char* serviceName)
 
 void QDBusServiceWatcher_SetWatchedServices(void* ptr, char* services)
 {
-	static_cast<QDBusServiceWatcher*>(ptr)->setWatchedServices(QString(services).split("|", QString::SkipEmptyParts));
+	static_cast<QDBusServiceWatcher*>(ptr)->setWatchedServices(goUnpackStringList(services));
 }
 
 void QDBusServiceWatcher_DestroyQDBusServiceWatcher(void* ptr)
@@ -1962,7 +2032,7 @@ void* QDBusServiceWatcher_Connection(void* ptr)
 
 struct QtDBus_PackedString QDBusServiceWatcher_WatchedServices(void* ptr)
 {
-	return ({ QByteArray t4599ca = static_cast<QDBusServiceWatcher*>(ptr)->watchedServices().join("|").toUtf8(); QtDBus_PackedString { const_cast<char*>(t4599ca.prepend("WHITESPACE").constData()+10), t4599ca.size()-10 }; });
+	return ({ long long t4599calen; char* t4599ca = goPackStringList(static_cast<QDBusServiceWatcher*>(ptr)->watchedServices(), &t4599calen); QtDBus_PackedString { t4599ca, t4599calen }; });
 }
 
 void* QDBusServiceWatcher___dynamicPropertyNames_atList(void* ptr, int i)
@@ -71,6 +71,75 @@
 #include <QVariant>
 #include <QWheelEvent>
 #include <QWidget>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 class MyQAbstractExtensionManager: public QAbstractExtensionManager
 {
@@ -1463,7 +1532,7 @@ public:
 	bool setContents(QIODevice * device, QString * errorMessage) { QByteArray t3f2abc = errorMessage->toUtf8(); QtDesigner_PackedString errorMessagePacked = { const_cast<char*>(t3f2abc.prepend("WHITESPACE").constData()+10), t3f2abc.size()-10 };return callbackQDesignerFormWindowInterface_SetContents(this, device, errorMessagePacked) != 0; };
 	bool setContents(const QString & contents) { QByteArray t4a756c = contents.toUtf8(); QtDesigner_PackedString contentsPacked = { const_cast<char*>(t4a756c.prepend("WHITESPACE").constData()+10), t4a756c.size()-10 };return callbackQDesignerFormWindowInterface_SetContents2(this, contentsPacked) != 0; };
 	void Signal_AboutToUnmanageWidget(QWidget * widget) { callbackQDesignerFormWindowInterface_AboutToUnmanageWidget(this, widget); };
-	void activateResourceFilePaths(const QStringList & paths, int * errorCount, QString * errorMessages) { QByteArray t0c6eec = paths.join("|").toUtf8(); QtDesigner_PackedString pathsPacked = { const_cast<char*>(t0c6eec.prepend("WHITESPACE").constData()+10), t0c6eec.size()-10 };QByteArray t99ab00 = errorMessages->toUtf8(); QtDesigner_PackedString errorMessagesPacked = { const_cast<char*>(t99ab00.prepend("WHITESPACE").constData()+10), t99ab00.size()-10 };callbackQDesignerFormWindowInterface_ActivateResourceFilePaths(this, pathsPacked, *errorCount, errorMessagesPacked); };
+	void activateResourceFilePaths(const QStringList & paths, int * errorCount, QString * errorMessages) { long long t0c6eeclen; QScopedPointer<char, QScopedPointerPodDeleter> t0c6eec(goPackStringList(paths, &t0c6eeclen)); QtDesigner_PackedString pathsPacked = { t0c6eec.data(), t0c6eeclen };QByteArray t99ab00 = errorMessages->toUtf8(); QtDesigner_PackedString errorMessagesPacked = { const_cast<char*>(t99ab00.prepend("WHITESPACE").constData()+10), t99ab00.size()-10 };callbackQDesignerFormWindowInterface_ActivateResourceFilePaths(this, pathsPacked, *errorCount, errorMessagesPacked); };
 	void Signal_Activated(QWidget * widget) { callbackQDesignerFormWindowInterface_Activated(this, widget); };
 	void addResourceFile(const QString & path) { QByteArray t3150ec = path.toUtf8(); QtDesigner_PackedString pathPacked = { const_cast<char*>(t3150ec.prepend("WHITESPACE").constData()+10), t3150ec.size()-10 };callbackQDesignerFormWindowInterface_AddResourceFile(this, pathPacked); };
 	void Signal_Changed() { callbackQDesignerFormWindowInterface_Changed(this); };
@@ -1488,7 +1557,7 @@ public:
 	void setFeatures(QDesignerFormWindowInterface::Feature features) { callbackQDesignerFormWindowInterface_SetFeatures(this, features); };
 	void setFileName(const QString & fileName) { QByteArray td83e09 = fileName.toUtf8(); QtDesigner_PackedString fileNamePacked = { const_cast<char*>(td83e09.prepend("WHITESPACE").constData()+10), td83e09.size()-10 };callbackQDesignerFormWindowInterface_SetFileName(this, fileNamePacked); };
 	void setGrid(const QPoint & grid) { callbackQDesignerFormWindowInterface_SetGrid(this, const_cast<QPoint*>(&grid)); };
-	void setIncludeHints(const QStringList & includeHints) { QByteArray t14dd6a = includeHints.join("|").toUtf8(); QtDesigner_PackedString includeHintsPacked = { const_cast<char*>(t14dd6a.prepend("WHITESPACE").constData()+10), t14dd6a.size()-10 };callbackQDesignerFormWindowInterface_SetIncludeHints(this, includeHintsPacked); };
+	void setIncludeHints(const QStringList & includeHints) { long long t14dd6alen; QScopedPointer<char, QScopedPointerPodDeleter> t14dd6a(goPackStringList(includeHints, &t14dd6alen)); QtDesigner_PackedString includeHintsPacked = { t14dd6a.data(), t14dd6alen };callbackQDesignerFormWindowInterface_SetIncludeHints(this, includeHintsPacked); };
 	void setLayoutDefault(int margin, int spacing) { callbackQDesignerFormWindowInterface_SetLayoutDefault(this, margin, spacing); };
 	void setLayoutFunction(const QString & margin, const QString & spacing) { QByteArray t5033fb = margin.toUtf8(); QtDesigner_PackedString marginPacked = { const_cast<char*>(t5033fb.prepend("WHITESPACE").constData()+10), t5033fb.size()-10 };QByteArray t7561d7 = spacing.toUtf8(); QtDesigner_PackedString spacingPacked = { const_cast<char*>(t7561d7.prepend("WHITESPACE").constData()+10), t7561d7.size()-10 };callbackQDesignerFormWindowInterface_SetLayoutFunction(this, marginPacked, spacingPacked); };
 	void setMainContainer(QWidget * mainContainer) { callbackQDesignerFormWindowInterface_SetMainContainer(this, mainContainer); };
@@ -1510,9 +1579,9 @@ public:
 	QString exportMacro() const { return QString(callbackQDesignerFormWindowInterface_ExportMacro(const_cast<void*>(static_cast<const void*>(this)))); };
 	QString fileName() const { return QString(callbackQDesignerFormWindowInterface_FileName(const_cast<void*>(static_cast<const void*>(this)))); };
 	QString pixmapFunction() const { return QString(callbackQDesignerFormWindowInterface_PixmapFunction(const_cast<void*>(static_cast<const void*>(this)))); };
-	QStringList checkContents() const { return QString(callbackQDesignerFormWindowInterface_CheckContents(const_cast<void*>(static_cast<const void*>(this)))).split("|", QString::SkipEmptyParts); };
-	QStringList includeHints() const { return QString(callbackQDesignerFormWindowInterface_IncludeHints(const_cast<void*>(static_cast<const void*>(this)))).split("|", QString::SkipEmptyParts); };
-	QStringList resourceFiles() const { return QString(callbackQDesignerFormWindowInterface_ResourceFiles(const_cast<void*>(static_cast<const void*>(this)))).split("|", QString::SkipEmptyParts); };
+	QStringList checkContents() const { char* tmp = callbackQDesignerFormWindowInterface_CheckContents(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
+	QStringList includeHints() const { char* tmp = callbackQDesignerFormWindowInterface_IncludeHints(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
+	QStringList resourceFiles() const { char* tmp = callbackQDesignerFormWindowInterface_ResourceFiles(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
 	QWidget * formContainer() const { return static_cast<QWidget*>(callbackQDesignerFormWindowInterface_FormContainer(const_cast<void*>(static_cast<const void*>(this)))); };
 	ResourceFileSaveMode resourceFileSaveMode() const { return static_cast<QDesignerFormWindowInterface::ResourceFileSaveMode>(callbackQDesignerFormWindowInterface_ResourceFileSaveMode(const_cast<void*>(static_cast<const void*>(this)))); };
 	bool hasFeature(QDesignerFormWindowInterface::Feature feature) const { return callbackQDesignerFormWindowInterface_HasFeature(const_cast<void*>(static_cast<const void*>(this)), feature) != 0; };
@@ -1634,12 +1703,12 @@ void QDesignerFormWindowInterface_AboutToUnmanageWidget(void* ptr, void* widget)
 
 void QDesignerFormWindowInterface_ActivateResourceFilePaths(void* ptr, char* paths, int errorCount, char* errorMessages)
 {
-	QMetaObject::invokeMethod(static_cast<QDesignerFormWindowInterface*>(ptr), "activateResourceFilePaths", Q_ARG(QStringList, QString(paths).split("|", QString::SkipEmptyParts)), Q_ARG(int*, &errorCount), Q_ARG(QString*, new QString(errorMessages)));
+	QMetaObject::invokeMethod(static_cast<QDesignerFormWindowInterface*>(ptr), "activateResourceFilePaths", Q_ARG(QStringList, goUnpackStringList(paths)), Q_ARG(int*, &errorCount), Q_ARG(QString*, new QString(errorMessages)));
 }
 
 void QDesignerFormWindowInterface_ActivateResourceFilePathsDefault(void* ptr, char* paths, int errorCount, char* errorMessages)
 {
-		static_cast<QDesignerFormWindowInterface*>(ptr)->QDesignerFormWindowInterface::activateResourceFilePaths(QString(paths).split("|", QString::SkipEmptyParts), &errorCount, new QString(errorMessages));
+		static_cast<QDesignerFormWindowInterface*>(ptr)->QDesignerFormWindowInterface::activateResourceFilePaths(goUnpackStringList(paths), &errorCount, new QString(errorMessages));
 }
 
 void QDesignerFormWindowInterface_ConnectActivated(void* ptr)
@@ -1860,7 +1929,7 @@ void QDesignerFormWindowInterface_SetGrid(void* ptr, void* grid)
 
 void QDesignerFormWindowInterface_SetIncludeHints(void* ptr, char* includeHints)
 {
-	static_cast<QDesignerFormWindowInterface*>(ptr)->setIncludeHints(QString(includeHints).split("|", QString::SkipEmptyParts));
+	static_cast<QDesignerFormWindowInterface*>(ptr)->setIncludeHints(goUnpackStringList(includeHints));
 }
 
 void QDesignerFormWindowInterface_SetLayoutDefault(void* ptr, int margin, int spacing)
@@ -2010,22 +2079,22 @@ struct QtDesigner_PackedString QDesignerFormWindowInterface_PixmapFunction(void*
 
 struct QtDesigner_PackedString QDesignerFormWindowInterface_ActiveResourceFilePaths(void* ptr)
 {
-	return ({ QByteArray t8dca06 = static_cast<QDesignerFormWindowInterface*>(ptr)->activeResourceFilePaths().join("|").toUtf8(); QtDesigner_PackedString { const_cast<char*>(t8dca06.prepend("WHITESPACE").constData()+10), t8dca06.size()-10 }; });
+	return ({ long long t8dca06len; char* t8dca06 = goPackStringList(static_cast<QDesignerFormWindowInterface*>(ptr)->activeResourceFilePaths(), &t8dca06len); QtDesigner_PackedString { t8dca06, t8dca06len }; });
 }
 
 struct QtDesigner_PackedString QDesignerFormWindowInterface_CheckContents(void* ptr)
 {
-	return ({ QByteArray t13d91e = static_cast<QDesignerFormWindowInterface*>(ptr)->checkContents().join("|").toUtf8(); QtDesigner_PackedString { const_cast<char*>(t13d91e.prepend("WHITESPACE").constData()+10), t13d91e.size()-10 }; });
+	return ({ long long t13d91elen; char* t13d91e = goPackStringList(static_cast<QDesignerFormWindowInterface*>(ptr)->checkContents(), &t13d91elen); QtDesigner_PackedString { t13d91e, t13d91elen }; });
 }
 
 struct QtDesigner_PackedString QDesignerFormWindowInterface_IncludeHints(void* ptr)
 {
-	return ({ QByteArray ta8d26f = static_cast<QDesignerFormWindowInterface*>(ptr)->includeHints().join("|").toUtf8(); QtDesigner_PackedString { const_cast<char*>(ta8d26f.prepend("WHITESPACE").constData()+10), ta8d26f.size()-10 }; });
+	return ({ long long ta8d26flen; char* ta8d26f = goPackStringList(static_cast<QDesignerFormWindowInterface*>(ptr)->includeHints(), &ta8d26flen); QtDesigner_PackedString { ta8d26f, ta8d26flen }; });
 }
 
 struct QtDesigner_PackedString QDesignerFormWindowInterface_ResourceFiles(void* ptr)
 {
-	return ({ QByteArray t55124a = static_cast<QDesignerFormWindowInterface*>(ptr)->resourceFiles().join("|").toUtf8(); QtDesigner_PackedString { const_cast<char*>(t55124a.prepend("WHITESPACE").constData()+10), t55124a.size()-10 }; });
+	return ({ long long t55124alen; char* t55124a = goPackStringList(static_cast<QDesignerFormWindowInterface*>(ptr)->resourceFiles(), &t55124alen); QtDesigner_PackedString { t55124a, t55124alen }; });
 }
 
 void* QDesignerFormWindowInterface_FormContainer(void* ptr)
@@ -2908,14 +2977,14 @@ void QDesignerMemberSheetExtension_DestroyQDesignerMemberSheetExtensionDefault(v
 
 }
 
-struct QtDesigner_PackedList QDesignerMemberSheetExtension_ParameterNames(void* ptr, int index)
+struct QtDesigner_PackedString QDesignerMemberSheetExtension_ParameterNames(void* ptr, int index)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(static_cast<QDesignerMemberSheetExtension*>(ptr)->parameterNames(index)); QtDesigner_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long t1f521elen; char* t1f521e = goPackStringList(static_cast<QDesignerMemberSheetExtension*>(ptr)->parameterNames(index), &t1f521elen); QtDesigner_PackedString { t1f521e, t1f521elen }; });
 }
 
-struct QtDesigner_PackedList QDesignerMemberSheetExtension_ParameterTypes(void* ptr, int index)
+struct QtDesigner_PackedString QDesignerMemberSheetExtension_ParameterTypes(void* ptr, int index)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(static_cast<QDesignerMemberSheetExtension*>(ptr)->parameterTypes(index)); QtDesigner_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long t766dc7len; char* t766dc7 = goPackStringList(static_cast<QDesignerMemberSheetExtension*>(ptr)->parameterTypes(index), &t766dc7len); QtDesigner_PackedString { t766dc7, t766dc7len }; });
 }
 
 struct QtDesigner_PackedString QDesignerMemberSheetExtension_DeclaredInClass(void* ptr, int index)
@@ -5538,7 +5607,7 @@ void QFormBuilder_ClearPluginPaths(void* ptr)
 
 void QFormBuilder_SetPluginPath(void* ptr, char* pluginPaths)
 {
-	static_cast<QFormBuilder*>(ptr)->setPluginPath(QString(pluginPaths).split("|", QString::SkipEmptyParts));
+	static_cast<QFormBuilder*>(ptr)->setPluginPath(goUnpackStringList(pluginPaths));
 }
 
 void QFormBuilder_DestroyQFormBuilder(void* ptr)
@@ -5558,7 +5627,7 @@ struct QtDesigner_PackedList QFormBuilder_CustomWidgets(void* ptr)
 
 struct QtDesigner_PackedString QFormBuilder_PluginPaths(void* ptr)
 {
-	return ({ QByteArray t18141d = static_cast<QFormBuilder*>(ptr)->pluginPaths().join("|").toUtf8(); QtDesigner_PackedString { const_cast<char*>(t18141d.prepend("WHITESPACE").constData()+10), t18141d.size()-10 }; });
+	return ({ long long t18141dlen; char* t18141d = goPackStringList(static_cast<QFormBuilder*>(ptr)->pluginPaths(), &t18141dlen); QtDesigner_PackedString { t18141d, t18141dlen }; });
 }
 
 void* QFormBuilder___customWidgets_atList(void* ptr, int i)
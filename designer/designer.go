@@ -8,13 +8,11 @@ package designer
 //#include "designer.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"github.com/therecipe/qt/gui"
 	"github.com/therecipe/qt/widgets"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -24,6 +22,43 @@ func cGoUnpackString(s C.struct_QtDesigner_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtDesigner_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtDesigner_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QAbstractExtensionFactory struct {
 	ptr unsafe.Pointer
@@ -103,7 +138,7 @@ func NewQAbstractExtensionManagerFromPointer(ptr unsafe.Pointer) *QAbstractExten
 
 //export callbackQAbstractExtensionManager_RegisterExtensions
 func callbackQAbstractExtensionManager_RegisterExtensions(ptr unsafe.Pointer, factory unsafe.Pointer, iid C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "registerExtensions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "registerExtensions"); signal != nil {
 		signal.(func(*QAbstractExtensionFactory, string))(NewQAbstractExtensionFactoryFromPointer(factory), cGoUnpackString(iid))
 	}
 
@@ -112,14 +147,14 @@ func callbackQAbstractExtensionManager_RegisterExtensions(ptr unsafe.Pointer, fa
 func (ptr *QAbstractExtensionManager) ConnectRegisterExtensions(f func(factory *QAbstractExtensionFactory, iid string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "registerExtensions", f)
+		qt.ConnectSignal(ptr.Pointer(), "registerExtensions", f)
 	}
 }
 
 func (ptr *QAbstractExtensionManager) DisconnectRegisterExtensions() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "registerExtensions")
+		qt.DisconnectSignal(ptr.Pointer(), "registerExtensions")
 	}
 }
 
@@ -133,7 +168,7 @@ func (ptr *QAbstractExtensionManager) RegisterExtensions(factory QAbstractExtens
 
 //export callbackQAbstractExtensionManager_UnregisterExtensions
 func callbackQAbstractExtensionManager_UnregisterExtensions(ptr unsafe.Pointer, factory unsafe.Pointer, iid C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unregisterExtensions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unregisterExtensions"); signal != nil {
 		signal.(func(*QAbstractExtensionFactory, string))(NewQAbstractExtensionFactoryFromPointer(factory), cGoUnpackString(iid))
 	}
 
@@ -142,14 +177,14 @@ func callbackQAbstractExtensionManager_UnregisterExtensions(ptr unsafe.Pointer,
 func (ptr *QAbstractExtensionManager) ConnectUnregisterExtensions(f func(factory *QAbstractExtensionFactory, iid string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterExtensions", f)
+		qt.ConnectSignal(ptr.Pointer(), "unregisterExtensions", f)
 	}
 }
 
 func (ptr *QAbstractExtensionManager) DisconnectUnregisterExtensions() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterExtensions")
+		qt.DisconnectSignal(ptr.Pointer(), "unregisterExtensions")
 	}
 }
 
@@ -163,7 +198,7 @@ func (ptr *QAbstractExtensionManager) UnregisterExtensions(factory QAbstractExte
 
 //export callbackQAbstractExtensionManager_DestroyQAbstractExtensionManager
 func callbackQAbstractExtensionManager_DestroyQAbstractExtensionManager(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractExtensionManager"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractExtensionManager"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractExtensionManagerFromPointer(ptr).DestroyQAbstractExtensionManagerDefault()
@@ -173,21 +208,21 @@ func callbackQAbstractExtensionManager_DestroyQAbstractExtensionManager(ptr unsa
 func (ptr *QAbstractExtensionManager) ConnectDestroyQAbstractExtensionManager(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractExtensionManager", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractExtensionManager", f)
 	}
 }
 
 func (ptr *QAbstractExtensionManager) DisconnectDestroyQAbstractExtensionManager() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractExtensionManager")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractExtensionManager")
 	}
 }
 
 func (ptr *QAbstractExtensionManager) DestroyQAbstractExtensionManager() {
 	if ptr.Pointer() != nil {
 		C.QAbstractExtensionManager_DestroyQAbstractExtensionManager(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -195,14 +230,14 @@ func (ptr *QAbstractExtensionManager) DestroyQAbstractExtensionManager() {
 func (ptr *QAbstractExtensionManager) DestroyQAbstractExtensionManagerDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractExtensionManager_DestroyQAbstractExtensionManagerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractExtensionManager_Extension
 func callbackQAbstractExtensionManager_Extension(ptr unsafe.Pointer, object unsafe.Pointer, iid C.struct_QtDesigner_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "extension"); signal != nil {
+	if signal := qt.GetSignal(ptr, "extension"); signal != nil {
 		return core.PointerFromQObject(signal.(func(*core.QObject, string) *core.QObject)(core.NewQObjectFromPointer(object), cGoUnpackString(iid)))
 	}
 
@@ -212,14 +247,14 @@ func callbackQAbstractExtensionManager_Extension(ptr unsafe.Pointer, object unsa
 func (ptr *QAbstractExtensionManager) ConnectExtension(f func(object *core.QObject, iid string) *core.QObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "extension", f)
+		qt.ConnectSignal(ptr.Pointer(), "extension", f)
 	}
 }
 
 func (ptr *QAbstractExtensionManager) DisconnectExtension() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "extension")
+		qt.DisconnectSignal(ptr.Pointer(), "extension")
 	}
 }
 
@@ -228,7 +263,7 @@ func (ptr *QAbstractExtensionManager) Extension(object core.QObject_ITF, iid str
 		var iidC = C.CString(iid)
 		defer C.free(unsafe.Pointer(iidC))
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractExtensionManager_Extension(ptr.Pointer(), core.PointerFromQObject(object), iidC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -279,7 +314,7 @@ func NewQAbstractFormBuilder() *QAbstractFormBuilder {
 
 //export callbackQAbstractFormBuilder_Load
 func callbackQAbstractFormBuilder_Load(ptr unsafe.Pointer, device unsafe.Pointer, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "load"); signal != nil {
+	if signal := qt.GetSignal(ptr, "load"); signal != nil {
 		return widgets.PointerFromQWidget(signal.(func(*core.QIODevice, *widgets.QWidget) *widgets.QWidget)(core.NewQIODeviceFromPointer(device), widgets.NewQWidgetFromPointer(parent)))
 	}
 
@@ -289,21 +324,21 @@ func callbackQAbstractFormBuilder_Load(ptr unsafe.Pointer, device unsafe.Pointer
 func (ptr *QAbstractFormBuilder) ConnectLoad(f func(device *core.QIODevice, parent *widgets.QWidget) *widgets.QWidget) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "load", f)
+		qt.ConnectSignal(ptr.Pointer(), "load", f)
 	}
 }
 
 func (ptr *QAbstractFormBuilder) DisconnectLoad() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "load")
+		qt.DisconnectSignal(ptr.Pointer(), "load")
 	}
 }
 
 func (ptr *QAbstractFormBuilder) Load(device core.QIODevice_ITF, parent widgets.QWidget_ITF) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QAbstractFormBuilder_Load(ptr.Pointer(), core.PointerFromQIODevice(device), widgets.PointerFromQWidget(parent)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -314,7 +349,7 @@ func (ptr *QAbstractFormBuilder) Load(device core.QIODevice_ITF, parent widgets.
 func (ptr *QAbstractFormBuilder) LoadDefault(device core.QIODevice_ITF, parent widgets.QWidget_ITF) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QAbstractFormBuilder_LoadDefault(ptr.Pointer(), core.PointerFromQIODevice(device), widgets.PointerFromQWidget(parent)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -324,7 +359,7 @@ func (ptr *QAbstractFormBuilder) LoadDefault(device core.QIODevice_ITF, parent w
 
 //export callbackQAbstractFormBuilder_Save
 func callbackQAbstractFormBuilder_Save(ptr unsafe.Pointer, device unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "save"); signal != nil {
+	if signal := qt.GetSignal(ptr, "save"); signal != nil {
 		signal.(func(*core.QIODevice, *widgets.QWidget))(core.NewQIODeviceFromPointer(device), widgets.NewQWidgetFromPointer(widget))
 	} else {
 		NewQAbstractFormBuilderFromPointer(ptr).SaveDefault(core.NewQIODeviceFromPointer(device), widgets.NewQWidgetFromPointer(widget))
@@ -334,14 +369,14 @@ func callbackQAbstractFormBuilder_Save(ptr unsafe.Pointer, device unsafe.Pointer
 func (ptr *QAbstractFormBuilder) ConnectSave(f func(device *core.QIODevice, widget *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "save", f)
+		qt.ConnectSignal(ptr.Pointer(), "save", f)
 	}
 }
 
 func (ptr *QAbstractFormBuilder) DisconnectSave() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "save")
+		qt.DisconnectSignal(ptr.Pointer(), "save")
 	}
 }
 
@@ -365,7 +400,7 @@ func (ptr *QAbstractFormBuilder) SetWorkingDirectory(directory core.QDir_ITF) {
 
 //export callbackQAbstractFormBuilder_DestroyQAbstractFormBuilder
 func callbackQAbstractFormBuilder_DestroyQAbstractFormBuilder(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractFormBuilder"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractFormBuilder"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractFormBuilderFromPointer(ptr).DestroyQAbstractFormBuilderDefault()
@@ -375,21 +410,21 @@ func callbackQAbstractFormBuilder_DestroyQAbstractFormBuilder(ptr unsafe.Pointer
 func (ptr *QAbstractFormBuilder) ConnectDestroyQAbstractFormBuilder(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractFormBuilder", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractFormBuilder", f)
 	}
 }
 
 func (ptr *QAbstractFormBuilder) DisconnectDestroyQAbstractFormBuilder() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractFormBuilder")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractFormBuilder")
 	}
 }
 
 func (ptr *QAbstractFormBuilder) DestroyQAbstractFormBuilder() {
 	if ptr.Pointer() != nil {
 		C.QAbstractFormBuilder_DestroyQAbstractFormBuilder(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -397,7 +432,7 @@ func (ptr *QAbstractFormBuilder) DestroyQAbstractFormBuilder() {
 func (ptr *QAbstractFormBuilder) DestroyQAbstractFormBuilderDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractFormBuilder_DestroyQAbstractFormBuilderDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -470,7 +505,7 @@ func NewQDesignerActionEditorInterfaceFromPointer(ptr unsafe.Pointer) *QDesigner
 }
 func NewQDesignerActionEditorInterface(parent widgets.QWidget_ITF, flags core.Qt__WindowType) *QDesignerActionEditorInterface {
 	var tmpValue = NewQDesignerActionEditorInterfaceFromPointer(C.QDesignerActionEditorInterface_NewQDesignerActionEditorInterface(widgets.PointerFromQWidget(parent), C.longlong(flags)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -478,7 +513,7 @@ func NewQDesignerActionEditorInterface(parent widgets.QWidget_ITF, flags core.Qt
 
 //export callbackQDesignerActionEditorInterface_ManageAction
 func callbackQDesignerActionEditorInterface_ManageAction(ptr unsafe.Pointer, action unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "manageAction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "manageAction"); signal != nil {
 		signal.(func(*widgets.QAction))(widgets.NewQActionFromPointer(action))
 	}
 
@@ -487,14 +522,14 @@ func callbackQDesignerActionEditorInterface_ManageAction(ptr unsafe.Pointer, act
 func (ptr *QDesignerActionEditorInterface) ConnectManageAction(f func(action *widgets.QAction)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "manageAction", f)
+		qt.ConnectSignal(ptr.Pointer(), "manageAction", f)
 	}
 }
 
 func (ptr *QDesignerActionEditorInterface) DisconnectManageAction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "manageAction")
+		qt.DisconnectSignal(ptr.Pointer(), "manageAction")
 	}
 }
 
@@ -506,7 +541,7 @@ func (ptr *QDesignerActionEditorInterface) ManageAction(action widgets.QAction_I
 
 //export callbackQDesignerActionEditorInterface_SetFormWindow
 func callbackQDesignerActionEditorInterface_SetFormWindow(ptr unsafe.Pointer, formWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFormWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFormWindow"); signal != nil {
 		signal.(func(*QDesignerFormWindowInterface))(NewQDesignerFormWindowInterfaceFromPointer(formWindow))
 	}
 
@@ -515,14 +550,14 @@ func callbackQDesignerActionEditorInterface_SetFormWindow(ptr unsafe.Pointer, fo
 func (ptr *QDesignerActionEditorInterface) ConnectSetFormWindow(f func(formWindow *QDesignerFormWindowInterface)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFormWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFormWindow", f)
 	}
 }
 
 func (ptr *QDesignerActionEditorInterface) DisconnectSetFormWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFormWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "setFormWindow")
 	}
 }
 
@@ -534,7 +569,7 @@ func (ptr *QDesignerActionEditorInterface) SetFormWindow(formWindow QDesignerFor
 
 //export callbackQDesignerActionEditorInterface_UnmanageAction
 func callbackQDesignerActionEditorInterface_UnmanageAction(ptr unsafe.Pointer, action unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unmanageAction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unmanageAction"); signal != nil {
 		signal.(func(*widgets.QAction))(widgets.NewQActionFromPointer(action))
 	}
 
@@ -543,14 +578,14 @@ func callbackQDesignerActionEditorInterface_UnmanageAction(ptr unsafe.Pointer, a
 func (ptr *QDesignerActionEditorInterface) ConnectUnmanageAction(f func(action *widgets.QAction)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unmanageAction", f)
+		qt.ConnectSignal(ptr.Pointer(), "unmanageAction", f)
 	}
 }
 
 func (ptr *QDesignerActionEditorInterface) DisconnectUnmanageAction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unmanageAction")
+		qt.DisconnectSignal(ptr.Pointer(), "unmanageAction")
 	}
 }
 
@@ -562,7 +597,7 @@ func (ptr *QDesignerActionEditorInterface) UnmanageAction(action widgets.QAction
 
 //export callbackQDesignerActionEditorInterface_DestroyQDesignerActionEditorInterface
 func callbackQDesignerActionEditorInterface_DestroyQDesignerActionEditorInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerActionEditorInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerActionEditorInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).DestroyQDesignerActionEditorInterfaceDefault()
@@ -572,21 +607,21 @@ func callbackQDesignerActionEditorInterface_DestroyQDesignerActionEditorInterfac
 func (ptr *QDesignerActionEditorInterface) ConnectDestroyQDesignerActionEditorInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerActionEditorInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerActionEditorInterface", f)
 	}
 }
 
 func (ptr *QDesignerActionEditorInterface) DisconnectDestroyQDesignerActionEditorInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerActionEditorInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerActionEditorInterface")
 	}
 }
 
 func (ptr *QDesignerActionEditorInterface) DestroyQDesignerActionEditorInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerActionEditorInterface_DestroyQDesignerActionEditorInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -594,14 +629,14 @@ func (ptr *QDesignerActionEditorInterface) DestroyQDesignerActionEditorInterface
 func (ptr *QDesignerActionEditorInterface) DestroyQDesignerActionEditorInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerActionEditorInterface_DestroyQDesignerActionEditorInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerActionEditorInterface_Core
 func callbackQDesignerActionEditorInterface_Core(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "core"); signal != nil {
+	if signal := qt.GetSignal(ptr, "core"); signal != nil {
 		return PointerFromQDesignerFormEditorInterface(signal.(func() *QDesignerFormEditorInterface)())
 	}
 
@@ -611,21 +646,21 @@ func callbackQDesignerActionEditorInterface_Core(ptr unsafe.Pointer) unsafe.Poin
 func (ptr *QDesignerActionEditorInterface) ConnectCore(f func() *QDesignerFormEditorInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "core", f)
+		qt.ConnectSignal(ptr.Pointer(), "core", f)
 	}
 }
 
 func (ptr *QDesignerActionEditorInterface) DisconnectCore() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "core")
+		qt.DisconnectSignal(ptr.Pointer(), "core")
 	}
 }
 
 func (ptr *QDesignerActionEditorInterface) Core() *QDesignerFormEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerActionEditorInterface_Core(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -636,7 +671,7 @@ func (ptr *QDesignerActionEditorInterface) Core() *QDesignerFormEditorInterface
 func (ptr *QDesignerActionEditorInterface) CoreDefault() *QDesignerFormEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerActionEditorInterface_CoreDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -647,7 +682,7 @@ func (ptr *QDesignerActionEditorInterface) CoreDefault() *QDesignerFormEditorInt
 func (ptr *QDesignerActionEditorInterface) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerActionEditorInterface___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -668,7 +703,7 @@ func (ptr *QDesignerActionEditorInterface) __addActions_actions_newList() unsafe
 func (ptr *QDesignerActionEditorInterface) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerActionEditorInterface___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -689,7 +724,7 @@ func (ptr *QDesignerActionEditorInterface) __insertActions_actions_newList() uns
 func (ptr *QDesignerActionEditorInterface) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerActionEditorInterface___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -729,7 +764,7 @@ func (ptr *QDesignerActionEditorInterface) __dynamicPropertyNames_newList() unsa
 func (ptr *QDesignerActionEditorInterface) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerActionEditorInterface___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -750,7 +785,7 @@ func (ptr *QDesignerActionEditorInterface) __findChildren_newList2() unsafe.Poin
 func (ptr *QDesignerActionEditorInterface) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerActionEditorInterface___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -771,7 +806,7 @@ func (ptr *QDesignerActionEditorInterface) __findChildren_newList3() unsafe.Poin
 func (ptr *QDesignerActionEditorInterface) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerActionEditorInterface___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -792,7 +827,7 @@ func (ptr *QDesignerActionEditorInterface) __findChildren_newList() unsafe.Point
 func (ptr *QDesignerActionEditorInterface) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerActionEditorInterface___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -812,7 +847,7 @@ func (ptr *QDesignerActionEditorInterface) __children_newList() unsafe.Pointer {
 
 //export callbackQDesignerActionEditorInterface_Close
 func callbackQDesignerActionEditorInterface_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -828,7 +863,7 @@ func (ptr *QDesignerActionEditorInterface) CloseDefault() bool {
 
 //export callbackQDesignerActionEditorInterface_Event
 func callbackQDesignerActionEditorInterface_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -844,7 +879,7 @@ func (ptr *QDesignerActionEditorInterface) EventDefault(event core.QEvent_ITF) b
 
 //export callbackQDesignerActionEditorInterface_FocusNextPrevChild
 func callbackQDesignerActionEditorInterface_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -860,7 +895,7 @@ func (ptr *QDesignerActionEditorInterface) FocusNextPrevChildDefault(next bool)
 
 //export callbackQDesignerActionEditorInterface_NativeEvent
 func callbackQDesignerActionEditorInterface_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -876,7 +911,7 @@ func (ptr *QDesignerActionEditorInterface) NativeEventDefault(eventType core.QBy
 
 //export callbackQDesignerActionEditorInterface_ActionEvent
 func callbackQDesignerActionEditorInterface_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -891,7 +926,7 @@ func (ptr *QDesignerActionEditorInterface) ActionEventDefault(event gui.QActionE
 
 //export callbackQDesignerActionEditorInterface_ChangeEvent
 func callbackQDesignerActionEditorInterface_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -906,7 +941,7 @@ func (ptr *QDesignerActionEditorInterface) ChangeEventDefault(event core.QEvent_
 
 //export callbackQDesignerActionEditorInterface_CloseEvent
 func callbackQDesignerActionEditorInterface_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -921,7 +956,7 @@ func (ptr *QDesignerActionEditorInterface) CloseEventDefault(event gui.QCloseEve
 
 //export callbackQDesignerActionEditorInterface_ContextMenuEvent
 func callbackQDesignerActionEditorInterface_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -936,7 +971,7 @@ func (ptr *QDesignerActionEditorInterface) ContextMenuEventDefault(event gui.QCo
 
 //export callbackQDesignerActionEditorInterface_CustomContextMenuRequested
 func callbackQDesignerActionEditorInterface_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -944,7 +979,7 @@ func callbackQDesignerActionEditorInterface_CustomContextMenuRequested(ptr unsaf
 
 //export callbackQDesignerActionEditorInterface_DragEnterEvent
 func callbackQDesignerActionEditorInterface_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -959,7 +994,7 @@ func (ptr *QDesignerActionEditorInterface) DragEnterEventDefault(event gui.QDrag
 
 //export callbackQDesignerActionEditorInterface_DragLeaveEvent
 func callbackQDesignerActionEditorInterface_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -974,7 +1009,7 @@ func (ptr *QDesignerActionEditorInterface) DragLeaveEventDefault(event gui.QDrag
 
 //export callbackQDesignerActionEditorInterface_DragMoveEvent
 func callbackQDesignerActionEditorInterface_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -989,7 +1024,7 @@ func (ptr *QDesignerActionEditorInterface) DragMoveEventDefault(event gui.QDragM
 
 //export callbackQDesignerActionEditorInterface_DropEvent
 func callbackQDesignerActionEditorInterface_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -1004,7 +1039,7 @@ func (ptr *QDesignerActionEditorInterface) DropEventDefault(event gui.QDropEvent
 
 //export callbackQDesignerActionEditorInterface_EnterEvent
 func callbackQDesignerActionEditorInterface_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -1019,7 +1054,7 @@ func (ptr *QDesignerActionEditorInterface) EnterEventDefault(event core.QEvent_I
 
 //export callbackQDesignerActionEditorInterface_FocusInEvent
 func callbackQDesignerActionEditorInterface_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -1034,7 +1069,7 @@ func (ptr *QDesignerActionEditorInterface) FocusInEventDefault(event gui.QFocusE
 
 //export callbackQDesignerActionEditorInterface_FocusOutEvent
 func callbackQDesignerActionEditorInterface_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -1049,7 +1084,7 @@ func (ptr *QDesignerActionEditorInterface) FocusOutEventDefault(event gui.QFocus
 
 //export callbackQDesignerActionEditorInterface_Hide
 func callbackQDesignerActionEditorInterface_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).HideDefault()
@@ -1064,7 +1099,7 @@ func (ptr *QDesignerActionEditorInterface) HideDefault() {
 
 //export callbackQDesignerActionEditorInterface_HideEvent
 func callbackQDesignerActionEditorInterface_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -1079,7 +1114,7 @@ func (ptr *QDesignerActionEditorInterface) HideEventDefault(event gui.QHideEvent
 
 //export callbackQDesignerActionEditorInterface_InputMethodEvent
 func callbackQDesignerActionEditorInterface_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -1094,7 +1129,7 @@ func (ptr *QDesignerActionEditorInterface) InputMethodEventDefault(event gui.QIn
 
 //export callbackQDesignerActionEditorInterface_KeyPressEvent
 func callbackQDesignerActionEditorInterface_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -1109,7 +1144,7 @@ func (ptr *QDesignerActionEditorInterface) KeyPressEventDefault(event gui.QKeyEv
 
 //export callbackQDesignerActionEditorInterface_KeyReleaseEvent
 func callbackQDesignerActionEditorInterface_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -1124,7 +1159,7 @@ func (ptr *QDesignerActionEditorInterface) KeyReleaseEventDefault(event gui.QKey
 
 //export callbackQDesignerActionEditorInterface_LeaveEvent
 func callbackQDesignerActionEditorInterface_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -1139,7 +1174,7 @@ func (ptr *QDesignerActionEditorInterface) LeaveEventDefault(event core.QEvent_I
 
 //export callbackQDesignerActionEditorInterface_Lower
 func callbackQDesignerActionEditorInterface_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).LowerDefault()
@@ -1154,7 +1189,7 @@ func (ptr *QDesignerActionEditorInterface) LowerDefault() {
 
 //export callbackQDesignerActionEditorInterface_MouseDoubleClickEvent
 func callbackQDesignerActionEditorInterface_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -1169,7 +1204,7 @@ func (ptr *QDesignerActionEditorInterface) MouseDoubleClickEventDefault(event gu
 
 //export callbackQDesignerActionEditorInterface_MouseMoveEvent
 func callbackQDesignerActionEditorInterface_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -1184,7 +1219,7 @@ func (ptr *QDesignerActionEditorInterface) MouseMoveEventDefault(event gui.QMous
 
 //export callbackQDesignerActionEditorInterface_MousePressEvent
 func callbackQDesignerActionEditorInterface_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -1199,7 +1234,7 @@ func (ptr *QDesignerActionEditorInterface) MousePressEventDefault(event gui.QMou
 
 //export callbackQDesignerActionEditorInterface_MouseReleaseEvent
 func callbackQDesignerActionEditorInterface_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -1214,7 +1249,7 @@ func (ptr *QDesignerActionEditorInterface) MouseReleaseEventDefault(event gui.QM
 
 //export callbackQDesignerActionEditorInterface_MoveEvent
 func callbackQDesignerActionEditorInterface_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -1229,7 +1264,7 @@ func (ptr *QDesignerActionEditorInterface) MoveEventDefault(event gui.QMoveEvent
 
 //export callbackQDesignerActionEditorInterface_PaintEvent
 func callbackQDesignerActionEditorInterface_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -1244,7 +1279,7 @@ func (ptr *QDesignerActionEditorInterface) PaintEventDefault(event gui.QPaintEve
 
 //export callbackQDesignerActionEditorInterface_Raise
 func callbackQDesignerActionEditorInterface_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).RaiseDefault()
@@ -1259,7 +1294,7 @@ func (ptr *QDesignerActionEditorInterface) RaiseDefault() {
 
 //export callbackQDesignerActionEditorInterface_Repaint
 func callbackQDesignerActionEditorInterface_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).RepaintDefault()
@@ -1274,7 +1309,7 @@ func (ptr *QDesignerActionEditorInterface) RepaintDefault() {
 
 //export callbackQDesignerActionEditorInterface_ResizeEvent
 func callbackQDesignerActionEditorInterface_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -1289,7 +1324,7 @@ func (ptr *QDesignerActionEditorInterface) ResizeEventDefault(event gui.QResizeE
 
 //export callbackQDesignerActionEditorInterface_SetDisabled
 func callbackQDesignerActionEditorInterface_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -1304,7 +1339,7 @@ func (ptr *QDesignerActionEditorInterface) SetDisabledDefault(disable bool) {
 
 //export callbackQDesignerActionEditorInterface_SetEnabled
 func callbackQDesignerActionEditorInterface_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -1319,7 +1354,7 @@ func (ptr *QDesignerActionEditorInterface) SetEnabledDefault(vbo bool) {
 
 //export callbackQDesignerActionEditorInterface_SetFocus2
 func callbackQDesignerActionEditorInterface_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).SetFocus2Default()
@@ -1334,7 +1369,7 @@ func (ptr *QDesignerActionEditorInterface) SetFocus2Default() {
 
 //export callbackQDesignerActionEditorInterface_SetHidden
 func callbackQDesignerActionEditorInterface_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -1349,7 +1384,7 @@ func (ptr *QDesignerActionEditorInterface) SetHiddenDefault(hidden bool) {
 
 //export callbackQDesignerActionEditorInterface_SetStyleSheet
 func callbackQDesignerActionEditorInterface_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -1366,7 +1401,7 @@ func (ptr *QDesignerActionEditorInterface) SetStyleSheetDefault(styleSheet strin
 
 //export callbackQDesignerActionEditorInterface_SetVisible
 func callbackQDesignerActionEditorInterface_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -1381,7 +1416,7 @@ func (ptr *QDesignerActionEditorInterface) SetVisibleDefault(visible bool) {
 
 //export callbackQDesignerActionEditorInterface_SetWindowModified
 func callbackQDesignerActionEditorInterface_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -1396,7 +1431,7 @@ func (ptr *QDesignerActionEditorInterface) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQDesignerActionEditorInterface_SetWindowTitle
 func callbackQDesignerActionEditorInterface_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -1413,7 +1448,7 @@ func (ptr *QDesignerActionEditorInterface) SetWindowTitleDefault(vqs string) {
 
 //export callbackQDesignerActionEditorInterface_Show
 func callbackQDesignerActionEditorInterface_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ShowDefault()
@@ -1428,7 +1463,7 @@ func (ptr *QDesignerActionEditorInterface) ShowDefault() {
 
 //export callbackQDesignerActionEditorInterface_ShowEvent
 func callbackQDesignerActionEditorInterface_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -1443,7 +1478,7 @@ func (ptr *QDesignerActionEditorInterface) ShowEventDefault(event gui.QShowEvent
 
 //export callbackQDesignerActionEditorInterface_ShowFullScreen
 func callbackQDesignerActionEditorInterface_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ShowFullScreenDefault()
@@ -1458,7 +1493,7 @@ func (ptr *QDesignerActionEditorInterface) ShowFullScreenDefault() {
 
 //export callbackQDesignerActionEditorInterface_ShowMaximized
 func callbackQDesignerActionEditorInterface_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ShowMaximizedDefault()
@@ -1473,7 +1508,7 @@ func (ptr *QDesignerActionEditorInterface) ShowMaximizedDefault() {
 
 //export callbackQDesignerActionEditorInterface_ShowMinimized
 func callbackQDesignerActionEditorInterface_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ShowMinimizedDefault()
@@ -1488,7 +1523,7 @@ func (ptr *QDesignerActionEditorInterface) ShowMinimizedDefault() {
 
 //export callbackQDesignerActionEditorInterface_ShowNormal
 func callbackQDesignerActionEditorInterface_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ShowNormalDefault()
@@ -1503,7 +1538,7 @@ func (ptr *QDesignerActionEditorInterface) ShowNormalDefault() {
 
 //export callbackQDesignerActionEditorInterface_TabletEvent
 func callbackQDesignerActionEditorInterface_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -1518,7 +1553,7 @@ func (ptr *QDesignerActionEditorInterface) TabletEventDefault(event gui.QTabletE
 
 //export callbackQDesignerActionEditorInterface_Update
 func callbackQDesignerActionEditorInterface_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).UpdateDefault()
@@ -1533,7 +1568,7 @@ func (ptr *QDesignerActionEditorInterface) UpdateDefault() {
 
 //export callbackQDesignerActionEditorInterface_UpdateMicroFocus
 func callbackQDesignerActionEditorInterface_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).UpdateMicroFocusDefault()
@@ -1548,7 +1583,7 @@ func (ptr *QDesignerActionEditorInterface) UpdateMicroFocusDefault() {
 
 //export callbackQDesignerActionEditorInterface_WheelEvent
 func callbackQDesignerActionEditorInterface_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -1563,7 +1598,7 @@ func (ptr *QDesignerActionEditorInterface) WheelEventDefault(event gui.QWheelEve
 
 //export callbackQDesignerActionEditorInterface_WindowIconChanged
 func callbackQDesignerActionEditorInterface_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -1571,7 +1606,7 @@ func callbackQDesignerActionEditorInterface_WindowIconChanged(ptr unsafe.Pointer
 
 //export callbackQDesignerActionEditorInterface_WindowTitleChanged
 func callbackQDesignerActionEditorInterface_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -1579,7 +1614,7 @@ func callbackQDesignerActionEditorInterface_WindowTitleChanged(ptr unsafe.Pointe
 
 //export callbackQDesignerActionEditorInterface_PaintEngine
 func callbackQDesignerActionEditorInterface_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -1595,7 +1630,7 @@ func (ptr *QDesignerActionEditorInterface) PaintEngineDefault() *gui.QPaintEngin
 
 //export callbackQDesignerActionEditorInterface_MinimumSizeHint
 func callbackQDesignerActionEditorInterface_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -1613,7 +1648,7 @@ func (ptr *QDesignerActionEditorInterface) MinimumSizeHintDefault() *core.QSize
 
 //export callbackQDesignerActionEditorInterface_SizeHint
 func callbackQDesignerActionEditorInterface_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -1631,7 +1666,7 @@ func (ptr *QDesignerActionEditorInterface) SizeHintDefault() *core.QSize {
 
 //export callbackQDesignerActionEditorInterface_InputMethodQuery
 func callbackQDesignerActionEditorInterface_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -1649,7 +1684,7 @@ func (ptr *QDesignerActionEditorInterface) InputMethodQueryDefault(query core.Qt
 
 //export callbackQDesignerActionEditorInterface_HasHeightForWidth
 func callbackQDesignerActionEditorInterface_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1665,7 +1700,7 @@ func (ptr *QDesignerActionEditorInterface) HasHeightForWidthDefault() bool {
 
 //export callbackQDesignerActionEditorInterface_HeightForWidth
 func callbackQDesignerActionEditorInterface_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -1681,7 +1716,7 @@ func (ptr *QDesignerActionEditorInterface) HeightForWidthDefault(w int) int {
 
 //export callbackQDesignerActionEditorInterface_Metric
 func callbackQDesignerActionEditorInterface_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -1697,7 +1732,7 @@ func (ptr *QDesignerActionEditorInterface) MetricDefault(m gui.QPaintDevice__Pai
 
 //export callbackQDesignerActionEditorInterface_EventFilter
 func callbackQDesignerActionEditorInterface_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -1713,7 +1748,7 @@ func (ptr *QDesignerActionEditorInterface) EventFilterDefault(watched core.QObje
 
 //export callbackQDesignerActionEditorInterface_ChildEvent
 func callbackQDesignerActionEditorInterface_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -1728,7 +1763,7 @@ func (ptr *QDesignerActionEditorInterface) ChildEventDefault(event core.QChildEv
 
 //export callbackQDesignerActionEditorInterface_ConnectNotify
 func callbackQDesignerActionEditorInterface_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1743,7 +1778,7 @@ func (ptr *QDesignerActionEditorInterface) ConnectNotifyDefault(sign core.QMetaM
 
 //export callbackQDesignerActionEditorInterface_CustomEvent
 func callbackQDesignerActionEditorInterface_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -1758,7 +1793,7 @@ func (ptr *QDesignerActionEditorInterface) CustomEventDefault(event core.QEvent_
 
 //export callbackQDesignerActionEditorInterface_DeleteLater
 func callbackQDesignerActionEditorInterface_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).DeleteLaterDefault()
@@ -1768,14 +1803,14 @@ func callbackQDesignerActionEditorInterface_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QDesignerActionEditorInterface) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerActionEditorInterface_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerActionEditorInterface_Destroyed
 func callbackQDesignerActionEditorInterface_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -1783,7 +1818,7 @@ func callbackQDesignerActionEditorInterface_Destroyed(ptr unsafe.Pointer, obj un
 
 //export callbackQDesignerActionEditorInterface_DisconnectNotify
 func callbackQDesignerActionEditorInterface_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1798,7 +1833,7 @@ func (ptr *QDesignerActionEditorInterface) DisconnectNotifyDefault(sign core.QMe
 
 //export callbackQDesignerActionEditorInterface_ObjectNameChanged
 func callbackQDesignerActionEditorInterface_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -1806,7 +1841,7 @@ func callbackQDesignerActionEditorInterface_ObjectNameChanged(ptr unsafe.Pointer
 
 //export callbackQDesignerActionEditorInterface_TimerEvent
 func callbackQDesignerActionEditorInterface_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQDesignerActionEditorInterfaceFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -1821,7 +1856,7 @@ func (ptr *QDesignerActionEditorInterface) TimerEventDefault(event core.QTimerEv
 
 //export callbackQDesignerActionEditorInterface_MetaObject
 func callbackQDesignerActionEditorInterface_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -1875,7 +1910,7 @@ func NewQDesignerContainerExtensionFromPointer(ptr unsafe.Pointer) *QDesignerCon
 
 //export callbackQDesignerContainerExtension_AddWidget
 func callbackQDesignerContainerExtension_AddWidget(ptr unsafe.Pointer, page unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "addWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "addWidget"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(page))
 	}
 
@@ -1884,14 +1919,14 @@ func callbackQDesignerContainerExtension_AddWidget(ptr unsafe.Pointer, page unsa
 func (ptr *QDesignerContainerExtension) ConnectAddWidget(f func(page *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "addWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "addWidget", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectAddWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "addWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "addWidget")
 	}
 }
 
@@ -1903,7 +1938,7 @@ func (ptr *QDesignerContainerExtension) AddWidget(page widgets.QWidget_ITF) {
 
 //export callbackQDesignerContainerExtension_InsertWidget
 func callbackQDesignerContainerExtension_InsertWidget(ptr unsafe.Pointer, index C.int, page unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertWidget"); signal != nil {
 		signal.(func(int, *widgets.QWidget))(int(int32(index)), widgets.NewQWidgetFromPointer(page))
 	}
 
@@ -1912,14 +1947,14 @@ func callbackQDesignerContainerExtension_InsertWidget(ptr unsafe.Pointer, index
 func (ptr *QDesignerContainerExtension) ConnectInsertWidget(f func(index int, page *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "insertWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "insertWidget", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectInsertWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "insertWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "insertWidget")
 	}
 }
 
@@ -1931,7 +1966,7 @@ func (ptr *QDesignerContainerExtension) InsertWidget(index int, page widgets.QWi
 
 //export callbackQDesignerContainerExtension_Remove
 func callbackQDesignerContainerExtension_Remove(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "remove"); signal != nil {
+	if signal := qt.GetSignal(ptr, "remove"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -1940,14 +1975,14 @@ func callbackQDesignerContainerExtension_Remove(ptr unsafe.Pointer, index C.int)
 func (ptr *QDesignerContainerExtension) ConnectRemove(f func(index int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "remove", f)
+		qt.ConnectSignal(ptr.Pointer(), "remove", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectRemove() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "remove")
+		qt.DisconnectSignal(ptr.Pointer(), "remove")
 	}
 }
 
@@ -1959,7 +1994,7 @@ func (ptr *QDesignerContainerExtension) Remove(index int) {
 
 //export callbackQDesignerContainerExtension_SetCurrentIndex
 func callbackQDesignerContainerExtension_SetCurrentIndex(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCurrentIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCurrentIndex"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	}
 
@@ -1968,14 +2003,14 @@ func callbackQDesignerContainerExtension_SetCurrentIndex(ptr unsafe.Pointer, ind
 func (ptr *QDesignerContainerExtension) ConnectSetCurrentIndex(f func(index int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentIndex", f)
+		qt.ConnectSignal(ptr.Pointer(), "setCurrentIndex", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectSetCurrentIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentIndex")
+		qt.DisconnectSignal(ptr.Pointer(), "setCurrentIndex")
 	}
 }
 
@@ -1987,7 +2022,7 @@ func (ptr *QDesignerContainerExtension) SetCurrentIndex(index int) {
 
 //export callbackQDesignerContainerExtension_DestroyQDesignerContainerExtension
 func callbackQDesignerContainerExtension_DestroyQDesignerContainerExtension(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerContainerExtension"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerContainerExtension"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerContainerExtensionFromPointer(ptr).DestroyQDesignerContainerExtensionDefault()
@@ -1997,21 +2032,21 @@ func callbackQDesignerContainerExtension_DestroyQDesignerContainerExtension(ptr
 func (ptr *QDesignerContainerExtension) ConnectDestroyQDesignerContainerExtension(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerContainerExtension", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerContainerExtension", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectDestroyQDesignerContainerExtension() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerContainerExtension")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerContainerExtension")
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DestroyQDesignerContainerExtension() {
 	if ptr.Pointer() != nil {
 		C.QDesignerContainerExtension_DestroyQDesignerContainerExtension(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2019,14 +2054,14 @@ func (ptr *QDesignerContainerExtension) DestroyQDesignerContainerExtension() {
 func (ptr *QDesignerContainerExtension) DestroyQDesignerContainerExtensionDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerContainerExtension_DestroyQDesignerContainerExtensionDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerContainerExtension_Widget
 func callbackQDesignerContainerExtension_Widget(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "widget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "widget"); signal != nil {
 		return widgets.PointerFromQWidget(signal.(func(int) *widgets.QWidget)(int(int32(index))))
 	}
 
@@ -2036,21 +2071,21 @@ func callbackQDesignerContainerExtension_Widget(ptr unsafe.Pointer, index C.int)
 func (ptr *QDesignerContainerExtension) ConnectWidget(f func(index int) *widgets.QWidget) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "widget", f)
+		qt.ConnectSignal(ptr.Pointer(), "widget", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "widget")
+		qt.DisconnectSignal(ptr.Pointer(), "widget")
 	}
 }
 
 func (ptr *QDesignerContainerExtension) Widget(index int) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QDesignerContainerExtension_Widget(ptr.Pointer(), C.int(int32(index))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2060,7 +2095,7 @@ func (ptr *QDesignerContainerExtension) Widget(index int) *widgets.QWidget {
 
 //export callbackQDesignerContainerExtension_CanAddWidget
 func callbackQDesignerContainerExtension_CanAddWidget(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canAddWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canAddWidget"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2070,14 +2105,14 @@ func callbackQDesignerContainerExtension_CanAddWidget(ptr unsafe.Pointer) C.char
 func (ptr *QDesignerContainerExtension) ConnectCanAddWidget(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "canAddWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "canAddWidget", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectCanAddWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "canAddWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "canAddWidget")
 	}
 }
 
@@ -2097,7 +2132,7 @@ func (ptr *QDesignerContainerExtension) CanAddWidgetDefault() bool {
 
 //export callbackQDesignerContainerExtension_CanRemove
 func callbackQDesignerContainerExtension_CanRemove(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canRemove"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canRemove"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -2107,14 +2142,14 @@ func callbackQDesignerContainerExtension_CanRemove(ptr unsafe.Pointer, index C.i
 func (ptr *QDesignerContainerExtension) ConnectCanRemove(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "canRemove", f)
+		qt.ConnectSignal(ptr.Pointer(), "canRemove", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectCanRemove() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "canRemove")
+		qt.DisconnectSignal(ptr.Pointer(), "canRemove")
 	}
 }
 
@@ -2134,7 +2169,7 @@ func (ptr *QDesignerContainerExtension) CanRemoveDefault(index int) bool {
 
 //export callbackQDesignerContainerExtension_Count
 func callbackQDesignerContainerExtension_Count(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "count"); signal != nil {
+	if signal := qt.GetSignal(ptr, "count"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -2144,14 +2179,14 @@ func callbackQDesignerContainerExtension_Count(ptr unsafe.Pointer) C.int {
 func (ptr *QDesignerContainerExtension) ConnectCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "count", f)
+		qt.ConnectSignal(ptr.Pointer(), "count", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "count")
+		qt.DisconnectSignal(ptr.Pointer(), "count")
 	}
 }
 
@@ -2164,7 +2199,7 @@ func (ptr *QDesignerContainerExtension) Count() int {
 
 //export callbackQDesignerContainerExtension_CurrentIndex
 func callbackQDesignerContainerExtension_CurrentIndex(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentIndex"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -2174,14 +2209,14 @@ func callbackQDesignerContainerExtension_CurrentIndex(ptr unsafe.Pointer) C.int
 func (ptr *QDesignerContainerExtension) ConnectCurrentIndex(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentIndex", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentIndex", f)
 	}
 }
 
 func (ptr *QDesignerContainerExtension) DisconnectCurrentIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentIndex")
+		qt.DisconnectSignal(ptr.Pointer(), "currentIndex")
 	}
 }
 
@@ -2232,7 +2267,7 @@ func NewQDesignerCustomWidgetCollectionInterfaceFromPointer(ptr unsafe.Pointer)
 
 //export callbackQDesignerCustomWidgetCollectionInterface_DestroyQDesignerCustomWidgetCollectionInterface
 func callbackQDesignerCustomWidgetCollectionInterface_DestroyQDesignerCustomWidgetCollectionInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerCustomWidgetCollectionInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerCustomWidgetCollectionInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerCustomWidgetCollectionInterfaceFromPointer(ptr).DestroyQDesignerCustomWidgetCollectionInterfaceDefault()
@@ -2242,21 +2277,21 @@ func callbackQDesignerCustomWidgetCollectionInterface_DestroyQDesignerCustomWidg
 func (ptr *QDesignerCustomWidgetCollectionInterface) ConnectDestroyQDesignerCustomWidgetCollectionInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerCustomWidgetCollectionInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerCustomWidgetCollectionInterface", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetCollectionInterface) DisconnectDestroyQDesignerCustomWidgetCollectionInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerCustomWidgetCollectionInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerCustomWidgetCollectionInterface")
 	}
 }
 
 func (ptr *QDesignerCustomWidgetCollectionInterface) DestroyQDesignerCustomWidgetCollectionInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerCustomWidgetCollectionInterface_DestroyQDesignerCustomWidgetCollectionInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2264,14 +2299,14 @@ func (ptr *QDesignerCustomWidgetCollectionInterface) DestroyQDesignerCustomWidge
 func (ptr *QDesignerCustomWidgetCollectionInterface) DestroyQDesignerCustomWidgetCollectionInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerCustomWidgetCollectionInterface_DestroyQDesignerCustomWidgetCollectionInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerCustomWidgetCollectionInterface_CustomWidgets
 func callbackQDesignerCustomWidgetCollectionInterface_CustomWidgets(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customWidgets"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customWidgets"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQDesignerCustomWidgetCollectionInterfaceFromPointer(NewQDesignerCustomWidgetCollectionInterfaceFromPointer(nil).__customWidgets_newList())
 			for _, v := range signal.(func() []*QDesignerCustomWidgetInterface)() {
@@ -2293,14 +2328,14 @@ func callbackQDesignerCustomWidgetCollectionInterface_CustomWidgets(ptr unsafe.P
 func (ptr *QDesignerCustomWidgetCollectionInterface) ConnectCustomWidgets(f func() []*QDesignerCustomWidgetInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "customWidgets", f)
+		qt.ConnectSignal(ptr.Pointer(), "customWidgets", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetCollectionInterface) DisconnectCustomWidgets() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "customWidgets")
+		qt.DisconnectSignal(ptr.Pointer(), "customWidgets")
 	}
 }
 
@@ -2374,7 +2409,7 @@ func NewQDesignerCustomWidgetInterfaceFromPointer(ptr unsafe.Pointer) *QDesigner
 
 //export callbackQDesignerCustomWidgetInterface_CreateWidget
 func callbackQDesignerCustomWidgetInterface_CreateWidget(ptr unsafe.Pointer, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createWidget"); signal != nil {
 		return widgets.PointerFromQWidget(signal.(func(*widgets.QWidget) *widgets.QWidget)(widgets.NewQWidgetFromPointer(parent)))
 	}
 
@@ -2384,21 +2419,21 @@ func callbackQDesignerCustomWidgetInterface_CreateWidget(ptr unsafe.Pointer, par
 func (ptr *QDesignerCustomWidgetInterface) ConnectCreateWidget(f func(parent *widgets.QWidget) *widgets.QWidget) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "createWidget", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectCreateWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "createWidget")
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) CreateWidget(parent widgets.QWidget_ITF) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QDesignerCustomWidgetInterface_CreateWidget(ptr.Pointer(), widgets.PointerFromQWidget(parent)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2408,7 +2443,7 @@ func (ptr *QDesignerCustomWidgetInterface) CreateWidget(parent widgets.QWidget_I
 
 //export callbackQDesignerCustomWidgetInterface_Initialize
 func callbackQDesignerCustomWidgetInterface_Initialize(ptr unsafe.Pointer, formEditor unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "initialize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "initialize"); signal != nil {
 		signal.(func(*QDesignerFormEditorInterface))(NewQDesignerFormEditorInterfaceFromPointer(formEditor))
 	} else {
 		NewQDesignerCustomWidgetInterfaceFromPointer(ptr).InitializeDefault(NewQDesignerFormEditorInterfaceFromPointer(formEditor))
@@ -2418,14 +2453,14 @@ func callbackQDesignerCustomWidgetInterface_Initialize(ptr unsafe.Pointer, formE
 func (ptr *QDesignerCustomWidgetInterface) ConnectInitialize(f func(formEditor *QDesignerFormEditorInterface)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "initialize", f)
+		qt.ConnectSignal(ptr.Pointer(), "initialize", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectInitialize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "initialize")
+		qt.DisconnectSignal(ptr.Pointer(), "initialize")
 	}
 }
 
@@ -2443,7 +2478,7 @@ func (ptr *QDesignerCustomWidgetInterface) InitializeDefault(formEditor QDesigne
 
 //export callbackQDesignerCustomWidgetInterface_DestroyQDesignerCustomWidgetInterface
 func callbackQDesignerCustomWidgetInterface_DestroyQDesignerCustomWidgetInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerCustomWidgetInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerCustomWidgetInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerCustomWidgetInterfaceFromPointer(ptr).DestroyQDesignerCustomWidgetInterfaceDefault()
@@ -2453,21 +2488,21 @@ func callbackQDesignerCustomWidgetInterface_DestroyQDesignerCustomWidgetInterfac
 func (ptr *QDesignerCustomWidgetInterface) ConnectDestroyQDesignerCustomWidgetInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerCustomWidgetInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerCustomWidgetInterface", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectDestroyQDesignerCustomWidgetInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerCustomWidgetInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerCustomWidgetInterface")
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DestroyQDesignerCustomWidgetInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerCustomWidgetInterface_DestroyQDesignerCustomWidgetInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2475,14 +2510,14 @@ func (ptr *QDesignerCustomWidgetInterface) DestroyQDesignerCustomWidgetInterface
 func (ptr *QDesignerCustomWidgetInterface) DestroyQDesignerCustomWidgetInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerCustomWidgetInterface_DestroyQDesignerCustomWidgetInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerCustomWidgetInterface_Icon
 func callbackQDesignerCustomWidgetInterface_Icon(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "icon"); signal != nil {
+	if signal := qt.GetSignal(ptr, "icon"); signal != nil {
 		return gui.PointerFromQIcon(signal.(func() *gui.QIcon)())
 	}
 
@@ -2492,14 +2527,14 @@ func callbackQDesignerCustomWidgetInterface_Icon(ptr unsafe.Pointer) unsafe.Poin
 func (ptr *QDesignerCustomWidgetInterface) ConnectIcon(f func() *gui.QIcon) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "icon", f)
+		qt.ConnectSignal(ptr.Pointer(), "icon", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectIcon() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "icon")
+		qt.DisconnectSignal(ptr.Pointer(), "icon")
 	}
 }
 
@@ -2514,7 +2549,7 @@ func (ptr *QDesignerCustomWidgetInterface) Icon() *gui.QIcon {
 
 //export callbackQDesignerCustomWidgetInterface_CodeTemplate
 func callbackQDesignerCustomWidgetInterface_CodeTemplate(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "codeTemplate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "codeTemplate"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -2524,14 +2559,14 @@ func callbackQDesignerCustomWidgetInterface_CodeTemplate(ptr unsafe.Pointer) *C.
 func (ptr *QDesignerCustomWidgetInterface) ConnectCodeTemplate(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "codeTemplate", f)
+		qt.ConnectSignal(ptr.Pointer(), "codeTemplate", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectCodeTemplate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "codeTemplate")
+		qt.DisconnectSignal(ptr.Pointer(), "codeTemplate")
 	}
 }
 
@@ -2551,7 +2586,7 @@ func (ptr *QDesignerCustomWidgetInterface) CodeTemplateDefault() string {
 
 //export callbackQDesignerCustomWidgetInterface_DomXml
 func callbackQDesignerCustomWidgetInterface_DomXml(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "domXml"); signal != nil {
+	if signal := qt.GetSignal(ptr, "domXml"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -2561,14 +2596,14 @@ func callbackQDesignerCustomWidgetInterface_DomXml(ptr unsafe.Pointer) *C.char {
 func (ptr *QDesignerCustomWidgetInterface) ConnectDomXml(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "domXml", f)
+		qt.ConnectSignal(ptr.Pointer(), "domXml", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectDomXml() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "domXml")
+		qt.DisconnectSignal(ptr.Pointer(), "domXml")
 	}
 }
 
@@ -2588,7 +2623,7 @@ func (ptr *QDesignerCustomWidgetInterface) DomXmlDefault() string {
 
 //export callbackQDesignerCustomWidgetInterface_Group
 func callbackQDesignerCustomWidgetInterface_Group(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "group"); signal != nil {
+	if signal := qt.GetSignal(ptr, "group"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -2598,14 +2633,14 @@ func callbackQDesignerCustomWidgetInterface_Group(ptr unsafe.Pointer) *C.char {
 func (ptr *QDesignerCustomWidgetInterface) ConnectGroup(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "group", f)
+		qt.ConnectSignal(ptr.Pointer(), "group", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectGroup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "group")
+		qt.DisconnectSignal(ptr.Pointer(), "group")
 	}
 }
 
@@ -2618,7 +2653,7 @@ func (ptr *QDesignerCustomWidgetInterface) Group() string {
 
 //export callbackQDesignerCustomWidgetInterface_IncludeFile
 func callbackQDesignerCustomWidgetInterface_IncludeFile(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "includeFile"); signal != nil {
+	if signal := qt.GetSignal(ptr, "includeFile"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -2628,14 +2663,14 @@ func callbackQDesignerCustomWidgetInterface_IncludeFile(ptr unsafe.Pointer) *C.c
 func (ptr *QDesignerCustomWidgetInterface) ConnectIncludeFile(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "includeFile", f)
+		qt.ConnectSignal(ptr.Pointer(), "includeFile", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectIncludeFile() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "includeFile")
+		qt.DisconnectSignal(ptr.Pointer(), "includeFile")
 	}
 }
 
@@ -2648,7 +2683,7 @@ func (ptr *QDesignerCustomWidgetInterface) IncludeFile() string {
 
 //export callbackQDesignerCustomWidgetInterface_Name
 func callbackQDesignerCustomWidgetInterface_Name(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "name"); signal != nil {
+	if signal := qt.GetSignal(ptr, "name"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -2658,14 +2693,14 @@ func callbackQDesignerCustomWidgetInterface_Name(ptr unsafe.Pointer) *C.char {
 func (ptr *QDesignerCustomWidgetInterface) ConnectName(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "name", f)
+		qt.ConnectSignal(ptr.Pointer(), "name", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "name")
+		qt.DisconnectSignal(ptr.Pointer(), "name")
 	}
 }
 
@@ -2678,7 +2713,7 @@ func (ptr *QDesignerCustomWidgetInterface) Name() string {
 
 //export callbackQDesignerCustomWidgetInterface_ToolTip
 func callbackQDesignerCustomWidgetInterface_ToolTip(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "toolTip"); signal != nil {
+	if signal := qt.GetSignal(ptr, "toolTip"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -2688,14 +2723,14 @@ func callbackQDesignerCustomWidgetInterface_ToolTip(ptr unsafe.Pointer) *C.char
 func (ptr *QDesignerCustomWidgetInterface) ConnectToolTip(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "toolTip", f)
+		qt.ConnectSignal(ptr.Pointer(), "toolTip", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectToolTip() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "toolTip")
+		qt.DisconnectSignal(ptr.Pointer(), "toolTip")
 	}
 }
 
@@ -2708,7 +2743,7 @@ func (ptr *QDesignerCustomWidgetInterface) ToolTip() string {
 
 //export callbackQDesignerCustomWidgetInterface_WhatsThis
 func callbackQDesignerCustomWidgetInterface_WhatsThis(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "whatsThis"); signal != nil {
+	if signal := qt.GetSignal(ptr, "whatsThis"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -2718,14 +2753,14 @@ func callbackQDesignerCustomWidgetInterface_WhatsThis(ptr unsafe.Pointer) *C.cha
 func (ptr *QDesignerCustomWidgetInterface) ConnectWhatsThis(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "whatsThis", f)
+		qt.ConnectSignal(ptr.Pointer(), "whatsThis", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectWhatsThis() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "whatsThis")
+		qt.DisconnectSignal(ptr.Pointer(), "whatsThis")
 	}
 }
 
@@ -2738,7 +2773,7 @@ func (ptr *QDesignerCustomWidgetInterface) WhatsThis() string {
 
 //export callbackQDesignerCustomWidgetInterface_IsContainer
 func callbackQDesignerCustomWidgetInterface_IsContainer(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isContainer"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isContainer"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2748,14 +2783,14 @@ func callbackQDesignerCustomWidgetInterface_IsContainer(ptr unsafe.Pointer) C.ch
 func (ptr *QDesignerCustomWidgetInterface) ConnectIsContainer(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isContainer", f)
+		qt.ConnectSignal(ptr.Pointer(), "isContainer", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectIsContainer() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isContainer")
+		qt.DisconnectSignal(ptr.Pointer(), "isContainer")
 	}
 }
 
@@ -2768,7 +2803,7 @@ func (ptr *QDesignerCustomWidgetInterface) IsContainer() bool {
 
 //export callbackQDesignerCustomWidgetInterface_IsInitialized
 func callbackQDesignerCustomWidgetInterface_IsInitialized(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isInitialized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isInitialized"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2778,14 +2813,14 @@ func callbackQDesignerCustomWidgetInterface_IsInitialized(ptr unsafe.Pointer) C.
 func (ptr *QDesignerCustomWidgetInterface) ConnectIsInitialized(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isInitialized", f)
+		qt.ConnectSignal(ptr.Pointer(), "isInitialized", f)
 	}
 }
 
 func (ptr *QDesignerCustomWidgetInterface) DisconnectIsInitialized() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isInitialized")
+		qt.DisconnectSignal(ptr.Pointer(), "isInitialized")
 	}
 }
 
@@ -2843,7 +2878,7 @@ func NewQDesignerDynamicPropertySheetExtensionFromPointer(ptr unsafe.Pointer) *Q
 
 //export callbackQDesignerDynamicPropertySheetExtension_RemoveDynamicProperty
 func callbackQDesignerDynamicPropertySheetExtension_RemoveDynamicProperty(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeDynamicProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeDynamicProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -2853,14 +2888,14 @@ func callbackQDesignerDynamicPropertySheetExtension_RemoveDynamicProperty(ptr un
 func (ptr *QDesignerDynamicPropertySheetExtension) ConnectRemoveDynamicProperty(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "removeDynamicProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "removeDynamicProperty", f)
 	}
 }
 
 func (ptr *QDesignerDynamicPropertySheetExtension) DisconnectRemoveDynamicProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "removeDynamicProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "removeDynamicProperty")
 	}
 }
 
@@ -2873,7 +2908,7 @@ func (ptr *QDesignerDynamicPropertySheetExtension) RemoveDynamicProperty(index i
 
 //export callbackQDesignerDynamicPropertySheetExtension_AddDynamicProperty
 func callbackQDesignerDynamicPropertySheetExtension_AddDynamicProperty(ptr unsafe.Pointer, propertyName C.struct_QtDesigner_PackedString, value unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "addDynamicProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "addDynamicProperty"); signal != nil {
 		return C.int(int32(signal.(func(string, *core.QVariant) int)(cGoUnpackString(propertyName), core.NewQVariantFromPointer(value))))
 	}
 
@@ -2883,14 +2918,14 @@ func callbackQDesignerDynamicPropertySheetExtension_AddDynamicProperty(ptr unsaf
 func (ptr *QDesignerDynamicPropertySheetExtension) ConnectAddDynamicProperty(f func(propertyName string, value *core.QVariant) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "addDynamicProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "addDynamicProperty", f)
 	}
 }
 
 func (ptr *QDesignerDynamicPropertySheetExtension) DisconnectAddDynamicProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "addDynamicProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "addDynamicProperty")
 	}
 }
 
@@ -2905,7 +2940,7 @@ func (ptr *QDesignerDynamicPropertySheetExtension) AddDynamicProperty(propertyNa
 
 //export callbackQDesignerDynamicPropertySheetExtension_DestroyQDesignerDynamicPropertySheetExtension
 func callbackQDesignerDynamicPropertySheetExtension_DestroyQDesignerDynamicPropertySheetExtension(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerDynamicPropertySheetExtension"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerDynamicPropertySheetExtension"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerDynamicPropertySheetExtensionFromPointer(ptr).DestroyQDesignerDynamicPropertySheetExtensionDefault()
@@ -2915,21 +2950,21 @@ func callbackQDesignerDynamicPropertySheetExtension_DestroyQDesignerDynamicPrope
 func (ptr *QDesignerDynamicPropertySheetExtension) ConnectDestroyQDesignerDynamicPropertySheetExtension(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerDynamicPropertySheetExtension", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerDynamicPropertySheetExtension", f)
 	}
 }
 
 func (ptr *QDesignerDynamicPropertySheetExtension) DisconnectDestroyQDesignerDynamicPropertySheetExtension() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerDynamicPropertySheetExtension")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerDynamicPropertySheetExtension")
 	}
 }
 
 func (ptr *QDesignerDynamicPropertySheetExtension) DestroyQDesignerDynamicPropertySheetExtension() {
 	if ptr.Pointer() != nil {
 		C.QDesignerDynamicPropertySheetExtension_DestroyQDesignerDynamicPropertySheetExtension(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2937,14 +2972,14 @@ func (ptr *QDesignerDynamicPropertySheetExtension) DestroyQDesignerDynamicProper
 func (ptr *QDesignerDynamicPropertySheetExtension) DestroyQDesignerDynamicPropertySheetExtensionDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerDynamicPropertySheetExtension_DestroyQDesignerDynamicPropertySheetExtensionDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerDynamicPropertySheetExtension_CanAddDynamicProperty
 func callbackQDesignerDynamicPropertySheetExtension_CanAddDynamicProperty(ptr unsafe.Pointer, propertyName C.struct_QtDesigner_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canAddDynamicProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canAddDynamicProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(propertyName)))))
 	}
 
@@ -2954,14 +2989,14 @@ func callbackQDesignerDynamicPropertySheetExtension_CanAddDynamicProperty(ptr un
 func (ptr *QDesignerDynamicPropertySheetExtension) ConnectCanAddDynamicProperty(f func(propertyName string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "canAddDynamicProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "canAddDynamicProperty", f)
 	}
 }
 
 func (ptr *QDesignerDynamicPropertySheetExtension) DisconnectCanAddDynamicProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "canAddDynamicProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "canAddDynamicProperty")
 	}
 }
 
@@ -2976,7 +3011,7 @@ func (ptr *QDesignerDynamicPropertySheetExtension) CanAddDynamicProperty(propert
 
 //export callbackQDesignerDynamicPropertySheetExtension_DynamicPropertiesAllowed
 func callbackQDesignerDynamicPropertySheetExtension_DynamicPropertiesAllowed(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dynamicPropertiesAllowed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dynamicPropertiesAllowed"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2986,14 +3021,14 @@ func callbackQDesignerDynamicPropertySheetExtension_DynamicPropertiesAllowed(ptr
 func (ptr *QDesignerDynamicPropertySheetExtension) ConnectDynamicPropertiesAllowed(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dynamicPropertiesAllowed", f)
+		qt.ConnectSignal(ptr.Pointer(), "dynamicPropertiesAllowed", f)
 	}
 }
 
 func (ptr *QDesignerDynamicPropertySheetExtension) DisconnectDynamicPropertiesAllowed() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dynamicPropertiesAllowed")
+		qt.DisconnectSignal(ptr.Pointer(), "dynamicPropertiesAllowed")
 	}
 }
 
@@ -3006,7 +3041,7 @@ func (ptr *QDesignerDynamicPropertySheetExtension) DynamicPropertiesAllowed() bo
 
 //export callbackQDesignerDynamicPropertySheetExtension_IsDynamicProperty
 func callbackQDesignerDynamicPropertySheetExtension_IsDynamicProperty(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isDynamicProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isDynamicProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -3016,14 +3051,14 @@ func callbackQDesignerDynamicPropertySheetExtension_IsDynamicProperty(ptr unsafe
 func (ptr *QDesignerDynamicPropertySheetExtension) ConnectIsDynamicProperty(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isDynamicProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "isDynamicProperty", f)
 	}
 }
 
 func (ptr *QDesignerDynamicPropertySheetExtension) DisconnectIsDynamicProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isDynamicProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "isDynamicProperty")
 	}
 }
 
@@ -3074,7 +3109,7 @@ func NewQDesignerFormEditorInterfaceFromPointer(ptr unsafe.Pointer) *QDesignerFo
 }
 func NewQDesignerFormEditorInterface(parent core.QObject_ITF) *QDesignerFormEditorInterface {
 	var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerFormEditorInterface_NewQDesignerFormEditorInterface(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3106,7 +3141,7 @@ func (ptr *QDesignerFormEditorInterface) SetWidgetBox(widgetBox QDesignerWidgetB
 
 //export callbackQDesignerFormEditorInterface_DestroyQDesignerFormEditorInterface
 func callbackQDesignerFormEditorInterface_DestroyQDesignerFormEditorInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerFormEditorInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerFormEditorInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormEditorInterfaceFromPointer(ptr).DestroyQDesignerFormEditorInterfaceDefault()
@@ -3116,21 +3151,21 @@ func callbackQDesignerFormEditorInterface_DestroyQDesignerFormEditorInterface(pt
 func (ptr *QDesignerFormEditorInterface) ConnectDestroyQDesignerFormEditorInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerFormEditorInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerFormEditorInterface", f)
 	}
 }
 
 func (ptr *QDesignerFormEditorInterface) DisconnectDestroyQDesignerFormEditorInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerFormEditorInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerFormEditorInterface")
 	}
 }
 
 func (ptr *QDesignerFormEditorInterface) DestroyQDesignerFormEditorInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormEditorInterface_DestroyQDesignerFormEditorInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3138,7 +3173,7 @@ func (ptr *QDesignerFormEditorInterface) DestroyQDesignerFormEditorInterface() {
 func (ptr *QDesignerFormEditorInterface) DestroyQDesignerFormEditorInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormEditorInterface_DestroyQDesignerFormEditorInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3146,7 +3181,7 @@ func (ptr *QDesignerFormEditorInterface) DestroyQDesignerFormEditorInterfaceDefa
 func (ptr *QDesignerFormEditorInterface) ActionEditor() *QDesignerActionEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerActionEditorInterfaceFromPointer(C.QDesignerFormEditorInterface_ActionEditor(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3157,7 +3192,7 @@ func (ptr *QDesignerFormEditorInterface) ActionEditor() *QDesignerActionEditorIn
 func (ptr *QDesignerFormEditorInterface) FormWindowManager() *QDesignerFormWindowManagerInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormWindowManagerInterfaceFromPointer(C.QDesignerFormEditorInterface_FormWindowManager(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3168,7 +3203,7 @@ func (ptr *QDesignerFormEditorInterface) FormWindowManager() *QDesignerFormWindo
 func (ptr *QDesignerFormEditorInterface) ObjectInspector() *QDesignerObjectInspectorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerObjectInspectorInterfaceFromPointer(C.QDesignerFormEditorInterface_ObjectInspector(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3179,7 +3214,7 @@ func (ptr *QDesignerFormEditorInterface) ObjectInspector() *QDesignerObjectInspe
 func (ptr *QDesignerFormEditorInterface) PropertyEditor() *QDesignerPropertyEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerPropertyEditorInterfaceFromPointer(C.QDesignerFormEditorInterface_PropertyEditor(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3190,7 +3225,7 @@ func (ptr *QDesignerFormEditorInterface) PropertyEditor() *QDesignerPropertyEdit
 func (ptr *QDesignerFormEditorInterface) WidgetBox() *QDesignerWidgetBoxInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerWidgetBoxInterfaceFromPointer(C.QDesignerFormEditorInterface_WidgetBox(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3201,7 +3236,7 @@ func (ptr *QDesignerFormEditorInterface) WidgetBox() *QDesignerWidgetBoxInterfac
 func (ptr *QDesignerFormEditorInterface) ExtensionManager() *QExtensionManager {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQExtensionManagerFromPointer(C.QDesignerFormEditorInterface_ExtensionManager(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3212,7 +3247,7 @@ func (ptr *QDesignerFormEditorInterface) ExtensionManager() *QExtensionManager {
 func (ptr *QDesignerFormEditorInterface) TopLevel() *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QDesignerFormEditorInterface_TopLevel(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3231,7 +3266,7 @@ func (ptr *QDesignerFormEditorInterface) __optionsPages_newList() unsafe.Pointer
 func (ptr *QDesignerFormEditorInterface) __pluginInstances_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormEditorInterface___pluginInstances_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3271,7 +3306,7 @@ func (ptr *QDesignerFormEditorInterface) __dynamicPropertyNames_newList() unsafe
 func (ptr *QDesignerFormEditorInterface) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormEditorInterface___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3292,7 +3327,7 @@ func (ptr *QDesignerFormEditorInterface) __findChildren_newList2() unsafe.Pointe
 func (ptr *QDesignerFormEditorInterface) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormEditorInterface___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3313,7 +3348,7 @@ func (ptr *QDesignerFormEditorInterface) __findChildren_newList3() unsafe.Pointe
 func (ptr *QDesignerFormEditorInterface) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormEditorInterface___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3334,7 +3369,7 @@ func (ptr *QDesignerFormEditorInterface) __findChildren_newList() unsafe.Pointer
 func (ptr *QDesignerFormEditorInterface) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormEditorInterface___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3354,7 +3389,7 @@ func (ptr *QDesignerFormEditorInterface) __children_newList() unsafe.Pointer {
 
 //export callbackQDesignerFormEditorInterface_Event
 func callbackQDesignerFormEditorInterface_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -3370,7 +3405,7 @@ func (ptr *QDesignerFormEditorInterface) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQDesignerFormEditorInterface_EventFilter
 func callbackQDesignerFormEditorInterface_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -3386,7 +3421,7 @@ func (ptr *QDesignerFormEditorInterface) EventFilterDefault(watched core.QObject
 
 //export callbackQDesignerFormEditorInterface_ChildEvent
 func callbackQDesignerFormEditorInterface_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQDesignerFormEditorInterfaceFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -3401,7 +3436,7 @@ func (ptr *QDesignerFormEditorInterface) ChildEventDefault(event core.QChildEven
 
 //export callbackQDesignerFormEditorInterface_ConnectNotify
 func callbackQDesignerFormEditorInterface_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerFormEditorInterfaceFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3416,7 +3451,7 @@ func (ptr *QDesignerFormEditorInterface) ConnectNotifyDefault(sign core.QMetaMet
 
 //export callbackQDesignerFormEditorInterface_CustomEvent
 func callbackQDesignerFormEditorInterface_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerFormEditorInterfaceFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -3431,7 +3466,7 @@ func (ptr *QDesignerFormEditorInterface) CustomEventDefault(event core.QEvent_IT
 
 //export callbackQDesignerFormEditorInterface_DeleteLater
 func callbackQDesignerFormEditorInterface_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormEditorInterfaceFromPointer(ptr).DeleteLaterDefault()
@@ -3441,14 +3476,14 @@ func callbackQDesignerFormEditorInterface_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QDesignerFormEditorInterface) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormEditorInterface_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerFormEditorInterface_Destroyed
 func callbackQDesignerFormEditorInterface_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -3456,7 +3491,7 @@ func callbackQDesignerFormEditorInterface_Destroyed(ptr unsafe.Pointer, obj unsa
 
 //export callbackQDesignerFormEditorInterface_DisconnectNotify
 func callbackQDesignerFormEditorInterface_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerFormEditorInterfaceFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3471,7 +3506,7 @@ func (ptr *QDesignerFormEditorInterface) DisconnectNotifyDefault(sign core.QMeta
 
 //export callbackQDesignerFormEditorInterface_ObjectNameChanged
 func callbackQDesignerFormEditorInterface_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -3479,7 +3514,7 @@ func callbackQDesignerFormEditorInterface_ObjectNameChanged(ptr unsafe.Pointer,
 
 //export callbackQDesignerFormEditorInterface_TimerEvent
 func callbackQDesignerFormEditorInterface_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQDesignerFormEditorInterfaceFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -3494,7 +3529,7 @@ func (ptr *QDesignerFormEditorInterface) TimerEventDefault(event core.QTimerEven
 
 //export callbackQDesignerFormEditorInterface_MetaObject
 func callbackQDesignerFormEditorInterface_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -3573,7 +3608,7 @@ const (
 
 //export callbackQDesignerFormWindowCursorInterface_MovePosition
 func callbackQDesignerFormWindowCursorInterface_MovePosition(ptr unsafe.Pointer, operation C.longlong, mode C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "movePosition"); signal != nil {
+	if signal := qt.GetSignal(ptr, "movePosition"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(QDesignerFormWindowCursorInterface__MoveOperation, QDesignerFormWindowCursorInterface__MoveMode) bool)(QDesignerFormWindowCursorInterface__MoveOperation(operation), QDesignerFormWindowCursorInterface__MoveMode(mode)))))
 	}
 
@@ -3583,14 +3618,14 @@ func callbackQDesignerFormWindowCursorInterface_MovePosition(ptr unsafe.Pointer,
 func (ptr *QDesignerFormWindowCursorInterface) ConnectMovePosition(f func(operation QDesignerFormWindowCursorInterface__MoveOperation, mode QDesignerFormWindowCursorInterface__MoveMode) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "movePosition", f)
+		qt.ConnectSignal(ptr.Pointer(), "movePosition", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectMovePosition() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "movePosition")
+		qt.DisconnectSignal(ptr.Pointer(), "movePosition")
 	}
 }
 
@@ -3603,7 +3638,7 @@ func (ptr *QDesignerFormWindowCursorInterface) MovePosition(operation QDesignerF
 
 //export callbackQDesignerFormWindowCursorInterface_ResetWidgetProperty
 func callbackQDesignerFormWindowCursorInterface_ResetWidgetProperty(ptr unsafe.Pointer, widget unsafe.Pointer, name C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resetWidgetProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resetWidgetProperty"); signal != nil {
 		signal.(func(*widgets.QWidget, string))(widgets.NewQWidgetFromPointer(widget), cGoUnpackString(name))
 	}
 
@@ -3612,14 +3647,14 @@ func callbackQDesignerFormWindowCursorInterface_ResetWidgetProperty(ptr unsafe.P
 func (ptr *QDesignerFormWindowCursorInterface) ConnectResetWidgetProperty(f func(widget *widgets.QWidget, name string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resetWidgetProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "resetWidgetProperty", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectResetWidgetProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resetWidgetProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "resetWidgetProperty")
 	}
 }
 
@@ -3633,7 +3668,7 @@ func (ptr *QDesignerFormWindowCursorInterface) ResetWidgetProperty(widget widget
 
 //export callbackQDesignerFormWindowCursorInterface_SetPosition
 func callbackQDesignerFormWindowCursorInterface_SetPosition(ptr unsafe.Pointer, position C.int, mode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPosition"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPosition"); signal != nil {
 		signal.(func(int, QDesignerFormWindowCursorInterface__MoveMode))(int(int32(position)), QDesignerFormWindowCursorInterface__MoveMode(mode))
 	}
 
@@ -3642,14 +3677,14 @@ func callbackQDesignerFormWindowCursorInterface_SetPosition(ptr unsafe.Pointer,
 func (ptr *QDesignerFormWindowCursorInterface) ConnectSetPosition(f func(position int, mode QDesignerFormWindowCursorInterface__MoveMode)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPosition", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPosition", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectSetPosition() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPosition")
+		qt.DisconnectSignal(ptr.Pointer(), "setPosition")
 	}
 }
 
@@ -3661,7 +3696,7 @@ func (ptr *QDesignerFormWindowCursorInterface) SetPosition(position int, mode QD
 
 //export callbackQDesignerFormWindowCursorInterface_SetProperty
 func callbackQDesignerFormWindowCursorInterface_SetProperty(ptr unsafe.Pointer, name C.struct_QtDesigner_PackedString, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setProperty"); signal != nil {
 		signal.(func(string, *core.QVariant))(cGoUnpackString(name), core.NewQVariantFromPointer(value))
 	}
 
@@ -3670,14 +3705,14 @@ func callbackQDesignerFormWindowCursorInterface_SetProperty(ptr unsafe.Pointer,
 func (ptr *QDesignerFormWindowCursorInterface) ConnectSetProperty(f func(name string, value *core.QVariant)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setProperty", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectSetProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setProperty")
 	}
 }
 
@@ -3691,7 +3726,7 @@ func (ptr *QDesignerFormWindowCursorInterface) SetProperty(name string, value co
 
 //export callbackQDesignerFormWindowCursorInterface_SetWidgetProperty
 func callbackQDesignerFormWindowCursorInterface_SetWidgetProperty(ptr unsafe.Pointer, widget unsafe.Pointer, name C.struct_QtDesigner_PackedString, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWidgetProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWidgetProperty"); signal != nil {
 		signal.(func(*widgets.QWidget, string, *core.QVariant))(widgets.NewQWidgetFromPointer(widget), cGoUnpackString(name), core.NewQVariantFromPointer(value))
 	}
 
@@ -3700,14 +3735,14 @@ func callbackQDesignerFormWindowCursorInterface_SetWidgetProperty(ptr unsafe.Poi
 func (ptr *QDesignerFormWindowCursorInterface) ConnectSetWidgetProperty(f func(widget *widgets.QWidget, name string, value *core.QVariant)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setWidgetProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setWidgetProperty", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectSetWidgetProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setWidgetProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setWidgetProperty")
 	}
 }
 
@@ -3721,7 +3756,7 @@ func (ptr *QDesignerFormWindowCursorInterface) SetWidgetProperty(widget widgets.
 
 //export callbackQDesignerFormWindowCursorInterface_DestroyQDesignerFormWindowCursorInterface
 func callbackQDesignerFormWindowCursorInterface_DestroyQDesignerFormWindowCursorInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerFormWindowCursorInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerFormWindowCursorInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowCursorInterfaceFromPointer(ptr).DestroyQDesignerFormWindowCursorInterfaceDefault()
@@ -3731,21 +3766,21 @@ func callbackQDesignerFormWindowCursorInterface_DestroyQDesignerFormWindowCursor
 func (ptr *QDesignerFormWindowCursorInterface) ConnectDestroyQDesignerFormWindowCursorInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerFormWindowCursorInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerFormWindowCursorInterface", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectDestroyQDesignerFormWindowCursorInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerFormWindowCursorInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerFormWindowCursorInterface")
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DestroyQDesignerFormWindowCursorInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowCursorInterface_DestroyQDesignerFormWindowCursorInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3753,14 +3788,14 @@ func (ptr *QDesignerFormWindowCursorInterface) DestroyQDesignerFormWindowCursorI
 func (ptr *QDesignerFormWindowCursorInterface) DestroyQDesignerFormWindowCursorInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowCursorInterface_DestroyQDesignerFormWindowCursorInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerFormWindowCursorInterface_FormWindow
 func callbackQDesignerFormWindowCursorInterface_FormWindow(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formWindow"); signal != nil {
 		return PointerFromQDesignerFormWindowInterface(signal.(func() *QDesignerFormWindowInterface)())
 	}
 
@@ -3770,21 +3805,21 @@ func callbackQDesignerFormWindowCursorInterface_FormWindow(ptr unsafe.Pointer) u
 func (ptr *QDesignerFormWindowCursorInterface) ConnectFormWindow(f func() *QDesignerFormWindowInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "formWindow", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectFormWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "formWindow")
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) FormWindow() *QDesignerFormWindowInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormWindowInterfaceFromPointer(C.QDesignerFormWindowCursorInterface_FormWindow(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3794,7 +3829,7 @@ func (ptr *QDesignerFormWindowCursorInterface) FormWindow() *QDesignerFormWindow
 
 //export callbackQDesignerFormWindowCursorInterface_Current
 func callbackQDesignerFormWindowCursorInterface_Current(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "current"); signal != nil {
+	if signal := qt.GetSignal(ptr, "current"); signal != nil {
 		return widgets.PointerFromQWidget(signal.(func() *widgets.QWidget)())
 	}
 
@@ -3804,21 +3839,21 @@ func callbackQDesignerFormWindowCursorInterface_Current(ptr unsafe.Pointer) unsa
 func (ptr *QDesignerFormWindowCursorInterface) ConnectCurrent(f func() *widgets.QWidget) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "current", f)
+		qt.ConnectSignal(ptr.Pointer(), "current", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectCurrent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "current")
+		qt.DisconnectSignal(ptr.Pointer(), "current")
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) Current() *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QDesignerFormWindowCursorInterface_Current(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3828,7 +3863,7 @@ func (ptr *QDesignerFormWindowCursorInterface) Current() *widgets.QWidget {
 
 //export callbackQDesignerFormWindowCursorInterface_SelectedWidget
 func callbackQDesignerFormWindowCursorInterface_SelectedWidget(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedWidget"); signal != nil {
 		return widgets.PointerFromQWidget(signal.(func(int) *widgets.QWidget)(int(int32(index))))
 	}
 
@@ -3838,21 +3873,21 @@ func callbackQDesignerFormWindowCursorInterface_SelectedWidget(ptr unsafe.Pointe
 func (ptr *QDesignerFormWindowCursorInterface) ConnectSelectedWidget(f func(index int) *widgets.QWidget) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedWidget", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectSelectedWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedWidget")
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) SelectedWidget(index int) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QDesignerFormWindowCursorInterface_SelectedWidget(ptr.Pointer(), C.int(int32(index))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3862,7 +3897,7 @@ func (ptr *QDesignerFormWindowCursorInterface) SelectedWidget(index int) *widget
 
 //export callbackQDesignerFormWindowCursorInterface_Widget
 func callbackQDesignerFormWindowCursorInterface_Widget(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "widget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "widget"); signal != nil {
 		return widgets.PointerFromQWidget(signal.(func(int) *widgets.QWidget)(int(int32(index))))
 	}
 
@@ -3872,21 +3907,21 @@ func callbackQDesignerFormWindowCursorInterface_Widget(ptr unsafe.Pointer, index
 func (ptr *QDesignerFormWindowCursorInterface) ConnectWidget(f func(index int) *widgets.QWidget) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "widget", f)
+		qt.ConnectSignal(ptr.Pointer(), "widget", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "widget")
+		qt.DisconnectSignal(ptr.Pointer(), "widget")
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) Widget(index int) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QDesignerFormWindowCursorInterface_Widget(ptr.Pointer(), C.int(int32(index))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3896,7 +3931,7 @@ func (ptr *QDesignerFormWindowCursorInterface) Widget(index int) *widgets.QWidge
 
 //export callbackQDesignerFormWindowCursorInterface_HasSelection
 func callbackQDesignerFormWindowCursorInterface_HasSelection(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasSelection"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3906,14 +3941,14 @@ func callbackQDesignerFormWindowCursorInterface_HasSelection(ptr unsafe.Pointer)
 func (ptr *QDesignerFormWindowCursorInterface) ConnectHasSelection(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasSelection", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasSelection", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectHasSelection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasSelection")
+		qt.DisconnectSignal(ptr.Pointer(), "hasSelection")
 	}
 }
 
@@ -3933,7 +3968,7 @@ func (ptr *QDesignerFormWindowCursorInterface) IsWidgetSelected(widget widgets.Q
 
 //export callbackQDesignerFormWindowCursorInterface_Position
 func callbackQDesignerFormWindowCursorInterface_Position(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "position"); signal != nil {
+	if signal := qt.GetSignal(ptr, "position"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -3943,14 +3978,14 @@ func callbackQDesignerFormWindowCursorInterface_Position(ptr unsafe.Pointer) C.i
 func (ptr *QDesignerFormWindowCursorInterface) ConnectPosition(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "position", f)
+		qt.ConnectSignal(ptr.Pointer(), "position", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectPosition() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "position")
+		qt.DisconnectSignal(ptr.Pointer(), "position")
 	}
 }
 
@@ -3963,7 +3998,7 @@ func (ptr *QDesignerFormWindowCursorInterface) Position() int {
 
 //export callbackQDesignerFormWindowCursorInterface_SelectedWidgetCount
 func callbackQDesignerFormWindowCursorInterface_SelectedWidgetCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedWidgetCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedWidgetCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -3973,14 +4008,14 @@ func callbackQDesignerFormWindowCursorInterface_SelectedWidgetCount(ptr unsafe.P
 func (ptr *QDesignerFormWindowCursorInterface) ConnectSelectedWidgetCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedWidgetCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedWidgetCount", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectSelectedWidgetCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedWidgetCount")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedWidgetCount")
 	}
 }
 
@@ -3993,7 +4028,7 @@ func (ptr *QDesignerFormWindowCursorInterface) SelectedWidgetCount() int {
 
 //export callbackQDesignerFormWindowCursorInterface_WidgetCount
 func callbackQDesignerFormWindowCursorInterface_WidgetCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "widgetCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "widgetCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -4003,14 +4038,14 @@ func callbackQDesignerFormWindowCursorInterface_WidgetCount(ptr unsafe.Pointer)
 func (ptr *QDesignerFormWindowCursorInterface) ConnectWidgetCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "widgetCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "widgetCount", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowCursorInterface) DisconnectWidgetCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "widgetCount")
+		qt.DisconnectSignal(ptr.Pointer(), "widgetCount")
 	}
 }
 
@@ -4083,7 +4118,7 @@ const (
 
 func QDesignerFormWindowInterface_FindFormWindow2(object core.QObject_ITF) *QDesignerFormWindowInterface {
 	var tmpValue = NewQDesignerFormWindowInterfaceFromPointer(C.QDesignerFormWindowInterface_QDesignerFormWindowInterface_FindFormWindow2(core.PointerFromQObject(object)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4091,7 +4126,7 @@ func QDesignerFormWindowInterface_FindFormWindow2(object core.QObject_ITF) *QDes
 
 func (ptr *QDesignerFormWindowInterface) FindFormWindow2(object core.QObject_ITF) *QDesignerFormWindowInterface {
 	var tmpValue = NewQDesignerFormWindowInterfaceFromPointer(C.QDesignerFormWindowInterface_QDesignerFormWindowInterface_FindFormWindow2(core.PointerFromQObject(object)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4099,7 +4134,7 @@ func (ptr *QDesignerFormWindowInterface) FindFormWindow2(object core.QObject_ITF
 
 func QDesignerFormWindowInterface_FindFormWindow(widget widgets.QWidget_ITF) *QDesignerFormWindowInterface {
 	var tmpValue = NewQDesignerFormWindowInterfaceFromPointer(C.QDesignerFormWindowInterface_QDesignerFormWindowInterface_FindFormWindow(widgets.PointerFromQWidget(widget)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4107,7 +4142,7 @@ func QDesignerFormWindowInterface_FindFormWindow(widget widgets.QWidget_ITF) *QD
 
 func (ptr *QDesignerFormWindowInterface) FindFormWindow(widget widgets.QWidget_ITF) *QDesignerFormWindowInterface {
 	var tmpValue = NewQDesignerFormWindowInterfaceFromPointer(C.QDesignerFormWindowInterface_QDesignerFormWindowInterface_FindFormWindow(widgets.PointerFromQWidget(widget)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4115,7 +4150,7 @@ func (ptr *QDesignerFormWindowInterface) FindFormWindow(widget widgets.QWidget_I
 
 //export callbackQDesignerFormWindowInterface_SetContents
 func callbackQDesignerFormWindowInterface_SetContents(ptr unsafe.Pointer, device unsafe.Pointer, errorMessage C.struct_QtDesigner_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setContents"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setContents"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QIODevice, string) bool)(core.NewQIODeviceFromPointer(device), cGoUnpackString(errorMessage)))))
 	}
 
@@ -4125,14 +4160,14 @@ func callbackQDesignerFormWindowInterface_SetContents(ptr unsafe.Pointer, device
 func (ptr *QDesignerFormWindowInterface) ConnectSetContents(f func(device *core.QIODevice, errorMessage string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setContents", f)
+		qt.ConnectSignal(ptr.Pointer(), "setContents", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetContents() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setContents")
+		qt.DisconnectSignal(ptr.Pointer(), "setContents")
 	}
 }
 
@@ -4147,7 +4182,7 @@ func (ptr *QDesignerFormWindowInterface) SetContents(device core.QIODevice_ITF,
 
 //export callbackQDesignerFormWindowInterface_SetContents2
 func callbackQDesignerFormWindowInterface_SetContents2(ptr unsafe.Pointer, contents C.struct_QtDesigner_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setContents2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setContents2"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(contents)))))
 	}
 
@@ -4157,14 +4192,14 @@ func callbackQDesignerFormWindowInterface_SetContents2(ptr unsafe.Pointer, conte
 func (ptr *QDesignerFormWindowInterface) ConnectSetContents2(f func(contents string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setContents2", f)
+		qt.ConnectSignal(ptr.Pointer(), "setContents2", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetContents2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setContents2")
+		qt.DisconnectSignal(ptr.Pointer(), "setContents2")
 	}
 }
 
@@ -4179,7 +4214,7 @@ func (ptr *QDesignerFormWindowInterface) SetContents2(contents string) bool {
 
 //export callbackQDesignerFormWindowInterface_AboutToUnmanageWidget
 func callbackQDesignerFormWindowInterface_AboutToUnmanageWidget(ptr unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aboutToUnmanageWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aboutToUnmanageWidget"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(widget))
 	}
 
@@ -4188,14 +4223,14 @@ func callbackQDesignerFormWindowInterface_AboutToUnmanageWidget(ptr unsafe.Point
 func (ptr *QDesignerFormWindowInterface) ConnectAboutToUnmanageWidget(f func(widget *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectAboutToUnmanageWidget(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "aboutToUnmanageWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "aboutToUnmanageWidget", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectAboutToUnmanageWidget() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectAboutToUnmanageWidget(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "aboutToUnmanageWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "aboutToUnmanageWidget")
 	}
 }
 
@@ -4207,30 +4242,30 @@ func (ptr *QDesignerFormWindowInterface) AboutToUnmanageWidget(widget widgets.QW
 
 //export callbackQDesignerFormWindowInterface_ActivateResourceFilePaths
 func callbackQDesignerFormWindowInterface_ActivateResourceFilePaths(ptr unsafe.Pointer, paths C.struct_QtDesigner_PackedString, errorCount C.int, errorMessages C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activateResourceFilePaths"); signal != nil {
-		signal.(func([]string, int, string))(strings.Split(cGoUnpackString(paths), "|"), int(int32(errorCount)), cGoUnpackString(errorMessages))
+	if signal := qt.GetSignal(ptr, "activateResourceFilePaths"); signal != nil {
+		signal.(func([]string, int, string))(cGoUnpackStringList(paths), int(int32(errorCount)), cGoUnpackString(errorMessages))
 	} else {
-		NewQDesignerFormWindowInterfaceFromPointer(ptr).ActivateResourceFilePathsDefault(strings.Split(cGoUnpackString(paths), "|"), int(int32(errorCount)), cGoUnpackString(errorMessages))
+		NewQDesignerFormWindowInterfaceFromPointer(ptr).ActivateResourceFilePathsDefault(cGoUnpackStringList(paths), int(int32(errorCount)), cGoUnpackString(errorMessages))
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) ConnectActivateResourceFilePaths(f func(paths []string, errorCount int, errorMessages string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activateResourceFilePaths", f)
+		qt.ConnectSignal(ptr.Pointer(), "activateResourceFilePaths", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectActivateResourceFilePaths() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activateResourceFilePaths")
+		qt.DisconnectSignal(ptr.Pointer(), "activateResourceFilePaths")
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) ActivateResourceFilePaths(paths []string, errorCount int, errorMessages string) {
 	if ptr.Pointer() != nil {
-		var pathsC = C.CString(strings.Join(paths, "|"))
+		var pathsC = cGoPackStringList(paths)
 		defer C.free(unsafe.Pointer(pathsC))
 		var errorMessagesC = C.CString(errorMessages)
 		defer C.free(unsafe.Pointer(errorMessagesC))
@@ -4240,7 +4275,7 @@ func (ptr *QDesignerFormWindowInterface) ActivateResourceFilePaths(paths []strin
 
 func (ptr *QDesignerFormWindowInterface) ActivateResourceFilePathsDefault(paths []string, errorCount int, errorMessages string) {
 	if ptr.Pointer() != nil {
-		var pathsC = C.CString(strings.Join(paths, "|"))
+		var pathsC = cGoPackStringList(paths)
 		defer C.free(unsafe.Pointer(pathsC))
 		var errorMessagesC = C.CString(errorMessages)
 		defer C.free(unsafe.Pointer(errorMessagesC))
@@ -4250,7 +4285,7 @@ func (ptr *QDesignerFormWindowInterface) ActivateResourceFilePathsDefault(paths
 
 //export callbackQDesignerFormWindowInterface_Activated
 func callbackQDesignerFormWindowInterface_Activated(ptr unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activated"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(widget))
 	}
 
@@ -4259,14 +4294,14 @@ func callbackQDesignerFormWindowInterface_Activated(ptr unsafe.Pointer, widget u
 func (ptr *QDesignerFormWindowInterface) ConnectActivated(f func(widget *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectActivated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activated", f)
+		qt.ConnectSignal(ptr.Pointer(), "activated", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectActivated() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectActivated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activated")
+		qt.DisconnectSignal(ptr.Pointer(), "activated")
 	}
 }
 
@@ -4278,7 +4313,7 @@ func (ptr *QDesignerFormWindowInterface) Activated(widget widgets.QWidget_ITF) {
 
 //export callbackQDesignerFormWindowInterface_AddResourceFile
 func callbackQDesignerFormWindowInterface_AddResourceFile(ptr unsafe.Pointer, path C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "addResourceFile"); signal != nil {
+	if signal := qt.GetSignal(ptr, "addResourceFile"); signal != nil {
 		signal.(func(string))(cGoUnpackString(path))
 	}
 
@@ -4287,14 +4322,14 @@ func callbackQDesignerFormWindowInterface_AddResourceFile(ptr unsafe.Pointer, pa
 func (ptr *QDesignerFormWindowInterface) ConnectAddResourceFile(f func(path string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "addResourceFile", f)
+		qt.ConnectSignal(ptr.Pointer(), "addResourceFile", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectAddResourceFile() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "addResourceFile")
+		qt.DisconnectSignal(ptr.Pointer(), "addResourceFile")
 	}
 }
 
@@ -4308,7 +4343,7 @@ func (ptr *QDesignerFormWindowInterface) AddResourceFile(path string) {
 
 //export callbackQDesignerFormWindowInterface_Changed
 func callbackQDesignerFormWindowInterface_Changed(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changed"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4317,14 +4352,14 @@ func callbackQDesignerFormWindowInterface_Changed(ptr unsafe.Pointer) {
 func (ptr *QDesignerFormWindowInterface) ConnectChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "changed", f)
+		qt.ConnectSignal(ptr.Pointer(), "changed", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "changed")
+		qt.DisconnectSignal(ptr.Pointer(), "changed")
 	}
 }
 
@@ -4336,7 +4371,7 @@ func (ptr *QDesignerFormWindowInterface) Changed() {
 
 //export callbackQDesignerFormWindowInterface_ClearSelection
 func callbackQDesignerFormWindowInterface_ClearSelection(ptr unsafe.Pointer, update C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clearSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clearSelection"); signal != nil {
 		signal.(func(bool))(int8(update) != 0)
 	}
 
@@ -4345,14 +4380,14 @@ func callbackQDesignerFormWindowInterface_ClearSelection(ptr unsafe.Pointer, upd
 func (ptr *QDesignerFormWindowInterface) ConnectClearSelection(f func(update bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clearSelection", f)
+		qt.ConnectSignal(ptr.Pointer(), "clearSelection", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectClearSelection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clearSelection")
+		qt.DisconnectSignal(ptr.Pointer(), "clearSelection")
 	}
 }
 
@@ -4364,7 +4399,7 @@ func (ptr *QDesignerFormWindowInterface) ClearSelection(update bool) {
 
 //export callbackQDesignerFormWindowInterface_EmitSelectionChanged
 func callbackQDesignerFormWindowInterface_EmitSelectionChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "emitSelectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "emitSelectionChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4373,14 +4408,14 @@ func callbackQDesignerFormWindowInterface_EmitSelectionChanged(ptr unsafe.Pointe
 func (ptr *QDesignerFormWindowInterface) ConnectEmitSelectionChanged(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "emitSelectionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "emitSelectionChanged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectEmitSelectionChanged() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "emitSelectionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "emitSelectionChanged")
 	}
 }
 
@@ -4392,7 +4427,7 @@ func (ptr *QDesignerFormWindowInterface) EmitSelectionChanged() {
 
 //export callbackQDesignerFormWindowInterface_FeatureChanged
 func callbackQDesignerFormWindowInterface_FeatureChanged(ptr unsafe.Pointer, feature C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "featureChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "featureChanged"); signal != nil {
 		signal.(func(QDesignerFormWindowInterface__FeatureFlag))(QDesignerFormWindowInterface__FeatureFlag(feature))
 	}
 
@@ -4401,14 +4436,14 @@ func callbackQDesignerFormWindowInterface_FeatureChanged(ptr unsafe.Pointer, fea
 func (ptr *QDesignerFormWindowInterface) ConnectFeatureChanged(f func(feature QDesignerFormWindowInterface__FeatureFlag)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectFeatureChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "featureChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "featureChanged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectFeatureChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectFeatureChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "featureChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "featureChanged")
 	}
 }
 
@@ -4420,7 +4455,7 @@ func (ptr *QDesignerFormWindowInterface) FeatureChanged(feature QDesignerFormWin
 
 //export callbackQDesignerFormWindowInterface_FileNameChanged
 func callbackQDesignerFormWindowInterface_FileNameChanged(ptr unsafe.Pointer, fileName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fileNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fileNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(fileName))
 	}
 
@@ -4429,14 +4464,14 @@ func callbackQDesignerFormWindowInterface_FileNameChanged(ptr unsafe.Pointer, fi
 func (ptr *QDesignerFormWindowInterface) ConnectFileNameChanged(f func(fileName string)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectFileNameChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fileNameChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "fileNameChanged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectFileNameChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectFileNameChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fileNameChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "fileNameChanged")
 	}
 }
 
@@ -4450,7 +4485,7 @@ func (ptr *QDesignerFormWindowInterface) FileNameChanged(fileName string) {
 
 //export callbackQDesignerFormWindowInterface_GeometryChanged
 func callbackQDesignerFormWindowInterface_GeometryChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "geometryChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "geometryChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4459,14 +4494,14 @@ func callbackQDesignerFormWindowInterface_GeometryChanged(ptr unsafe.Pointer) {
 func (ptr *QDesignerFormWindowInterface) ConnectGeometryChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectGeometryChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "geometryChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "geometryChanged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectGeometryChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectGeometryChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "geometryChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "geometryChanged")
 	}
 }
 
@@ -4478,7 +4513,7 @@ func (ptr *QDesignerFormWindowInterface) GeometryChanged() {
 
 //export callbackQDesignerFormWindowInterface_LayoutDefault
 func callbackQDesignerFormWindowInterface_LayoutDefault(ptr unsafe.Pointer, margin C.int, spacing C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutDefault"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutDefault"); signal != nil {
 		signal.(func(int, int))(int(int32(margin)), int(int32(spacing)))
 	}
 
@@ -4487,14 +4522,14 @@ func callbackQDesignerFormWindowInterface_LayoutDefault(ptr unsafe.Pointer, marg
 func (ptr *QDesignerFormWindowInterface) ConnectLayoutDefault(f func(margin int, spacing int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "layoutDefault", f)
+		qt.ConnectSignal(ptr.Pointer(), "layoutDefault", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectLayoutDefault() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "layoutDefault")
+		qt.DisconnectSignal(ptr.Pointer(), "layoutDefault")
 	}
 }
 
@@ -4506,7 +4541,7 @@ func (ptr *QDesignerFormWindowInterface) LayoutDefault(margin int, spacing int)
 
 //export callbackQDesignerFormWindowInterface_LayoutFunction
 func callbackQDesignerFormWindowInterface_LayoutFunction(ptr unsafe.Pointer, margin C.struct_QtDesigner_PackedString, spacing C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutFunction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutFunction"); signal != nil {
 		signal.(func(string, string))(cGoUnpackString(margin), cGoUnpackString(spacing))
 	}
 
@@ -4515,14 +4550,14 @@ func callbackQDesignerFormWindowInterface_LayoutFunction(ptr unsafe.Pointer, mar
 func (ptr *QDesignerFormWindowInterface) ConnectLayoutFunction(f func(margin string, spacing string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "layoutFunction", f)
+		qt.ConnectSignal(ptr.Pointer(), "layoutFunction", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectLayoutFunction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "layoutFunction")
+		qt.DisconnectSignal(ptr.Pointer(), "layoutFunction")
 	}
 }
 
@@ -4538,7 +4573,7 @@ func (ptr *QDesignerFormWindowInterface) LayoutFunction(margin string, spacing s
 
 //export callbackQDesignerFormWindowInterface_MainContainerChanged
 func callbackQDesignerFormWindowInterface_MainContainerChanged(ptr unsafe.Pointer, mainContainer unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mainContainerChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mainContainerChanged"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(mainContainer))
 	}
 
@@ -4547,14 +4582,14 @@ func callbackQDesignerFormWindowInterface_MainContainerChanged(ptr unsafe.Pointe
 func (ptr *QDesignerFormWindowInterface) ConnectMainContainerChanged(f func(mainContainer *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectMainContainerChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mainContainerChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "mainContainerChanged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectMainContainerChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectMainContainerChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mainContainerChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "mainContainerChanged")
 	}
 }
 
@@ -4566,7 +4601,7 @@ func (ptr *QDesignerFormWindowInterface) MainContainerChanged(mainContainer widg
 
 //export callbackQDesignerFormWindowInterface_ManageWidget
 func callbackQDesignerFormWindowInterface_ManageWidget(ptr unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "manageWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "manageWidget"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(widget))
 	}
 
@@ -4575,14 +4610,14 @@ func callbackQDesignerFormWindowInterface_ManageWidget(ptr unsafe.Pointer, widge
 func (ptr *QDesignerFormWindowInterface) ConnectManageWidget(f func(widget *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "manageWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "manageWidget", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectManageWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "manageWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "manageWidget")
 	}
 }
 
@@ -4594,7 +4629,7 @@ func (ptr *QDesignerFormWindowInterface) ManageWidget(widget widgets.QWidget_ITF
 
 //export callbackQDesignerFormWindowInterface_ObjectRemoved
 func callbackQDesignerFormWindowInterface_ObjectRemoved(ptr unsafe.Pointer, object unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectRemoved"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(object))
 	}
 
@@ -4603,14 +4638,14 @@ func callbackQDesignerFormWindowInterface_ObjectRemoved(ptr unsafe.Pointer, obje
 func (ptr *QDesignerFormWindowInterface) ConnectObjectRemoved(f func(object *core.QObject)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectObjectRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "objectRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "objectRemoved", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectObjectRemoved() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectObjectRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "objectRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "objectRemoved")
 	}
 }
 
@@ -4622,7 +4657,7 @@ func (ptr *QDesignerFormWindowInterface) ObjectRemoved(object core.QObject_ITF)
 
 //export callbackQDesignerFormWindowInterface_RemoveResourceFile
 func callbackQDesignerFormWindowInterface_RemoveResourceFile(ptr unsafe.Pointer, path C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeResourceFile"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeResourceFile"); signal != nil {
 		signal.(func(string))(cGoUnpackString(path))
 	}
 
@@ -4631,14 +4666,14 @@ func callbackQDesignerFormWindowInterface_RemoveResourceFile(ptr unsafe.Pointer,
 func (ptr *QDesignerFormWindowInterface) ConnectRemoveResourceFile(f func(path string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "removeResourceFile", f)
+		qt.ConnectSignal(ptr.Pointer(), "removeResourceFile", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectRemoveResourceFile() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "removeResourceFile")
+		qt.DisconnectSignal(ptr.Pointer(), "removeResourceFile")
 	}
 }
 
@@ -4652,7 +4687,7 @@ func (ptr *QDesignerFormWindowInterface) RemoveResourceFile(path string) {
 
 //export callbackQDesignerFormWindowInterface_ResourceFilesChanged
 func callbackQDesignerFormWindowInterface_ResourceFilesChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resourceFilesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resourceFilesChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4661,14 +4696,14 @@ func callbackQDesignerFormWindowInterface_ResourceFilesChanged(ptr unsafe.Pointe
 func (ptr *QDesignerFormWindowInterface) ConnectResourceFilesChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectResourceFilesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resourceFilesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "resourceFilesChanged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectResourceFilesChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectResourceFilesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resourceFilesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "resourceFilesChanged")
 	}
 }
 
@@ -4680,7 +4715,7 @@ func (ptr *QDesignerFormWindowInterface) ResourceFilesChanged() {
 
 //export callbackQDesignerFormWindowInterface_SelectWidget
 func callbackQDesignerFormWindowInterface_SelectWidget(ptr unsafe.Pointer, widget unsafe.Pointer, sele C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectWidget"); signal != nil {
 		signal.(func(*widgets.QWidget, bool))(widgets.NewQWidgetFromPointer(widget), int8(sele) != 0)
 	}
 
@@ -4689,14 +4724,14 @@ func callbackQDesignerFormWindowInterface_SelectWidget(ptr unsafe.Pointer, widge
 func (ptr *QDesignerFormWindowInterface) ConnectSelectWidget(f func(widget *widgets.QWidget, sele bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectWidget", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSelectWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "selectWidget")
 	}
 }
 
@@ -4708,7 +4743,7 @@ func (ptr *QDesignerFormWindowInterface) SelectWidget(widget widgets.QWidget_ITF
 
 //export callbackQDesignerFormWindowInterface_SelectionChanged
 func callbackQDesignerFormWindowInterface_SelectionChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4717,14 +4752,14 @@ func callbackQDesignerFormWindowInterface_SelectionChanged(ptr unsafe.Pointer) {
 func (ptr *QDesignerFormWindowInterface) ConnectSelectionChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectSelectionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectionChanged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSelectionChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectSelectionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectionChanged")
 	}
 }
 
@@ -4736,7 +4771,7 @@ func (ptr *QDesignerFormWindowInterface) SelectionChanged() {
 
 //export callbackQDesignerFormWindowInterface_SetAuthor
 func callbackQDesignerFormWindowInterface_SetAuthor(ptr unsafe.Pointer, author C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setAuthor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setAuthor"); signal != nil {
 		signal.(func(string))(cGoUnpackString(author))
 	}
 
@@ -4745,14 +4780,14 @@ func callbackQDesignerFormWindowInterface_SetAuthor(ptr unsafe.Pointer, author C
 func (ptr *QDesignerFormWindowInterface) ConnectSetAuthor(f func(author string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setAuthor", f)
+		qt.ConnectSignal(ptr.Pointer(), "setAuthor", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetAuthor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setAuthor")
+		qt.DisconnectSignal(ptr.Pointer(), "setAuthor")
 	}
 }
 
@@ -4766,7 +4801,7 @@ func (ptr *QDesignerFormWindowInterface) SetAuthor(author string) {
 
 //export callbackQDesignerFormWindowInterface_SetComment
 func callbackQDesignerFormWindowInterface_SetComment(ptr unsafe.Pointer, comment C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setComment"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setComment"); signal != nil {
 		signal.(func(string))(cGoUnpackString(comment))
 	}
 
@@ -4775,14 +4810,14 @@ func callbackQDesignerFormWindowInterface_SetComment(ptr unsafe.Pointer, comment
 func (ptr *QDesignerFormWindowInterface) ConnectSetComment(f func(comment string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setComment", f)
+		qt.ConnectSignal(ptr.Pointer(), "setComment", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetComment() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setComment")
+		qt.DisconnectSignal(ptr.Pointer(), "setComment")
 	}
 }
 
@@ -4796,7 +4831,7 @@ func (ptr *QDesignerFormWindowInterface) SetComment(comment string) {
 
 //export callbackQDesignerFormWindowInterface_SetDirty
 func callbackQDesignerFormWindowInterface_SetDirty(ptr unsafe.Pointer, dirty C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDirty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDirty"); signal != nil {
 		signal.(func(bool))(int8(dirty) != 0)
 	}
 
@@ -4805,14 +4840,14 @@ func callbackQDesignerFormWindowInterface_SetDirty(ptr unsafe.Pointer, dirty C.c
 func (ptr *QDesignerFormWindowInterface) ConnectSetDirty(f func(dirty bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setDirty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setDirty", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetDirty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setDirty")
+		qt.DisconnectSignal(ptr.Pointer(), "setDirty")
 	}
 }
 
@@ -4824,7 +4859,7 @@ func (ptr *QDesignerFormWindowInterface) SetDirty(dirty bool) {
 
 //export callbackQDesignerFormWindowInterface_SetExportMacro
 func callbackQDesignerFormWindowInterface_SetExportMacro(ptr unsafe.Pointer, exportMacro C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setExportMacro"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setExportMacro"); signal != nil {
 		signal.(func(string))(cGoUnpackString(exportMacro))
 	}
 
@@ -4833,14 +4868,14 @@ func callbackQDesignerFormWindowInterface_SetExportMacro(ptr unsafe.Pointer, exp
 func (ptr *QDesignerFormWindowInterface) ConnectSetExportMacro(f func(exportMacro string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setExportMacro", f)
+		qt.ConnectSignal(ptr.Pointer(), "setExportMacro", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetExportMacro() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setExportMacro")
+		qt.DisconnectSignal(ptr.Pointer(), "setExportMacro")
 	}
 }
 
@@ -4854,7 +4889,7 @@ func (ptr *QDesignerFormWindowInterface) SetExportMacro(exportMacro string) {
 
 //export callbackQDesignerFormWindowInterface_SetFeatures
 func callbackQDesignerFormWindowInterface_SetFeatures(ptr unsafe.Pointer, features C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFeatures"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFeatures"); signal != nil {
 		signal.(func(QDesignerFormWindowInterface__FeatureFlag))(QDesignerFormWindowInterface__FeatureFlag(features))
 	}
 
@@ -4863,14 +4898,14 @@ func callbackQDesignerFormWindowInterface_SetFeatures(ptr unsafe.Pointer, featur
 func (ptr *QDesignerFormWindowInterface) ConnectSetFeatures(f func(features QDesignerFormWindowInterface__FeatureFlag)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFeatures", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFeatures", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetFeatures() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFeatures")
+		qt.DisconnectSignal(ptr.Pointer(), "setFeatures")
 	}
 }
 
@@ -4882,7 +4917,7 @@ func (ptr *QDesignerFormWindowInterface) SetFeatures(features QDesignerFormWindo
 
 //export callbackQDesignerFormWindowInterface_SetFileName
 func callbackQDesignerFormWindowInterface_SetFileName(ptr unsafe.Pointer, fileName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFileName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFileName"); signal != nil {
 		signal.(func(string))(cGoUnpackString(fileName))
 	}
 
@@ -4891,14 +4926,14 @@ func callbackQDesignerFormWindowInterface_SetFileName(ptr unsafe.Pointer, fileNa
 func (ptr *QDesignerFormWindowInterface) ConnectSetFileName(f func(fileName string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFileName", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFileName", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetFileName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFileName")
+		qt.DisconnectSignal(ptr.Pointer(), "setFileName")
 	}
 }
 
@@ -4912,7 +4947,7 @@ func (ptr *QDesignerFormWindowInterface) SetFileName(fileName string) {
 
 //export callbackQDesignerFormWindowInterface_SetGrid
 func callbackQDesignerFormWindowInterface_SetGrid(ptr unsafe.Pointer, grid unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setGrid"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setGrid"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(grid))
 	}
 
@@ -4921,14 +4956,14 @@ func callbackQDesignerFormWindowInterface_SetGrid(ptr unsafe.Pointer, grid unsaf
 func (ptr *QDesignerFormWindowInterface) ConnectSetGrid(f func(grid *core.QPoint)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setGrid", f)
+		qt.ConnectSignal(ptr.Pointer(), "setGrid", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetGrid() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setGrid")
+		qt.DisconnectSignal(ptr.Pointer(), "setGrid")
 	}
 }
 
@@ -4940,8 +4975,8 @@ func (ptr *QDesignerFormWindowInterface) SetGrid(grid core.QPoint_ITF) {
 
 //export callbackQDesignerFormWindowInterface_SetIncludeHints
 func callbackQDesignerFormWindowInterface_SetIncludeHints(ptr unsafe.Pointer, includeHints C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setIncludeHints"); signal != nil {
-		signal.(func([]string))(strings.Split(cGoUnpackString(includeHints), "|"))
+	if signal := qt.GetSignal(ptr, "setIncludeHints"); signal != nil {
+		signal.(func([]string))(cGoUnpackStringList(includeHints))
 	}
 
 }
@@ -4949,20 +4984,20 @@ func callbackQDesignerFormWindowInterface_SetIncludeHints(ptr unsafe.Pointer, in
 func (ptr *QDesignerFormWindowInterface) ConnectSetIncludeHints(f func(includeHints []string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setIncludeHints", f)
+		qt.ConnectSignal(ptr.Pointer(), "setIncludeHints", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetIncludeHints() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setIncludeHints")
+		qt.DisconnectSignal(ptr.Pointer(), "setIncludeHints")
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) SetIncludeHints(includeHints []string) {
 	if ptr.Pointer() != nil {
-		var includeHintsC = C.CString(strings.Join(includeHints, "|"))
+		var includeHintsC = cGoPackStringList(includeHints)
 		defer C.free(unsafe.Pointer(includeHintsC))
 		C.QDesignerFormWindowInterface_SetIncludeHints(ptr.Pointer(), includeHintsC)
 	}
@@ -4970,7 +5005,7 @@ func (ptr *QDesignerFormWindowInterface) SetIncludeHints(includeHints []string)
 
 //export callbackQDesignerFormWindowInterface_SetLayoutDefault
 func callbackQDesignerFormWindowInterface_SetLayoutDefault(ptr unsafe.Pointer, margin C.int, spacing C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setLayoutDefault"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setLayoutDefault"); signal != nil {
 		signal.(func(int, int))(int(int32(margin)), int(int32(spacing)))
 	}
 
@@ -4979,14 +5014,14 @@ func callbackQDesignerFormWindowInterface_SetLayoutDefault(ptr unsafe.Pointer, m
 func (ptr *QDesignerFormWindowInterface) ConnectSetLayoutDefault(f func(margin int, spacing int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setLayoutDefault", f)
+		qt.ConnectSignal(ptr.Pointer(), "setLayoutDefault", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetLayoutDefault() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setLayoutDefault")
+		qt.DisconnectSignal(ptr.Pointer(), "setLayoutDefault")
 	}
 }
 
@@ -4998,7 +5033,7 @@ func (ptr *QDesignerFormWindowInterface) SetLayoutDefault(margin int, spacing in
 
 //export callbackQDesignerFormWindowInterface_SetLayoutFunction
 func callbackQDesignerFormWindowInterface_SetLayoutFunction(ptr unsafe.Pointer, margin C.struct_QtDesigner_PackedString, spacing C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setLayoutFunction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setLayoutFunction"); signal != nil {
 		signal.(func(string, string))(cGoUnpackString(margin), cGoUnpackString(spacing))
 	}
 
@@ -5007,14 +5042,14 @@ func callbackQDesignerFormWindowInterface_SetLayoutFunction(ptr unsafe.Pointer,
 func (ptr *QDesignerFormWindowInterface) ConnectSetLayoutFunction(f func(margin string, spacing string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setLayoutFunction", f)
+		qt.ConnectSignal(ptr.Pointer(), "setLayoutFunction", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetLayoutFunction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setLayoutFunction")
+		qt.DisconnectSignal(ptr.Pointer(), "setLayoutFunction")
 	}
 }
 
@@ -5030,7 +5065,7 @@ func (ptr *QDesignerFormWindowInterface) SetLayoutFunction(margin string, spacin
 
 //export callbackQDesignerFormWindowInterface_SetMainContainer
 func callbackQDesignerFormWindowInterface_SetMainContainer(ptr unsafe.Pointer, mainContainer unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMainContainer"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMainContainer"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(mainContainer))
 	}
 
@@ -5039,14 +5074,14 @@ func callbackQDesignerFormWindowInterface_SetMainContainer(ptr unsafe.Pointer, m
 func (ptr *QDesignerFormWindowInterface) ConnectSetMainContainer(f func(mainContainer *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setMainContainer", f)
+		qt.ConnectSignal(ptr.Pointer(), "setMainContainer", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetMainContainer() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setMainContainer")
+		qt.DisconnectSignal(ptr.Pointer(), "setMainContainer")
 	}
 }
 
@@ -5058,7 +5093,7 @@ func (ptr *QDesignerFormWindowInterface) SetMainContainer(mainContainer widgets.
 
 //export callbackQDesignerFormWindowInterface_SetPixmapFunction
 func callbackQDesignerFormWindowInterface_SetPixmapFunction(ptr unsafe.Pointer, pixmapFunction C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPixmapFunction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPixmapFunction"); signal != nil {
 		signal.(func(string))(cGoUnpackString(pixmapFunction))
 	}
 
@@ -5067,14 +5102,14 @@ func callbackQDesignerFormWindowInterface_SetPixmapFunction(ptr unsafe.Pointer,
 func (ptr *QDesignerFormWindowInterface) ConnectSetPixmapFunction(f func(pixmapFunction string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPixmapFunction", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPixmapFunction", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetPixmapFunction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPixmapFunction")
+		qt.DisconnectSignal(ptr.Pointer(), "setPixmapFunction")
 	}
 }
 
@@ -5088,7 +5123,7 @@ func (ptr *QDesignerFormWindowInterface) SetPixmapFunction(pixmapFunction string
 
 //export callbackQDesignerFormWindowInterface_SetResourceFileSaveMode
 func callbackQDesignerFormWindowInterface_SetResourceFileSaveMode(ptr unsafe.Pointer, behaviour C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setResourceFileSaveMode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setResourceFileSaveMode"); signal != nil {
 		signal.(func(QDesignerFormWindowInterface__ResourceFileSaveMode))(QDesignerFormWindowInterface__ResourceFileSaveMode(behaviour))
 	}
 
@@ -5097,14 +5132,14 @@ func callbackQDesignerFormWindowInterface_SetResourceFileSaveMode(ptr unsafe.Poi
 func (ptr *QDesignerFormWindowInterface) ConnectSetResourceFileSaveMode(f func(behaviour QDesignerFormWindowInterface__ResourceFileSaveMode)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setResourceFileSaveMode", f)
+		qt.ConnectSignal(ptr.Pointer(), "setResourceFileSaveMode", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectSetResourceFileSaveMode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setResourceFileSaveMode")
+		qt.DisconnectSignal(ptr.Pointer(), "setResourceFileSaveMode")
 	}
 }
 
@@ -5116,7 +5151,7 @@ func (ptr *QDesignerFormWindowInterface) SetResourceFileSaveMode(behaviour QDesi
 
 //export callbackQDesignerFormWindowInterface_UnmanageWidget
 func callbackQDesignerFormWindowInterface_UnmanageWidget(ptr unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unmanageWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unmanageWidget"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(widget))
 	}
 
@@ -5125,14 +5160,14 @@ func callbackQDesignerFormWindowInterface_UnmanageWidget(ptr unsafe.Pointer, wid
 func (ptr *QDesignerFormWindowInterface) ConnectUnmanageWidget(f func(widget *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unmanageWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "unmanageWidget", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectUnmanageWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unmanageWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "unmanageWidget")
 	}
 }
 
@@ -5144,7 +5179,7 @@ func (ptr *QDesignerFormWindowInterface) UnmanageWidget(widget widgets.QWidget_I
 
 //export callbackQDesignerFormWindowInterface_WidgetManaged
 func callbackQDesignerFormWindowInterface_WidgetManaged(ptr unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "widgetManaged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "widgetManaged"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(widget))
 	}
 
@@ -5153,14 +5188,14 @@ func callbackQDesignerFormWindowInterface_WidgetManaged(ptr unsafe.Pointer, widg
 func (ptr *QDesignerFormWindowInterface) ConnectWidgetManaged(f func(widget *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectWidgetManaged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "widgetManaged", f)
+		qt.ConnectSignal(ptr.Pointer(), "widgetManaged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectWidgetManaged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectWidgetManaged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "widgetManaged")
+		qt.DisconnectSignal(ptr.Pointer(), "widgetManaged")
 	}
 }
 
@@ -5172,7 +5207,7 @@ func (ptr *QDesignerFormWindowInterface) WidgetManaged(widget widgets.QWidget_IT
 
 //export callbackQDesignerFormWindowInterface_WidgetRemoved
 func callbackQDesignerFormWindowInterface_WidgetRemoved(ptr unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "widgetRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "widgetRemoved"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(widget))
 	}
 
@@ -5181,14 +5216,14 @@ func callbackQDesignerFormWindowInterface_WidgetRemoved(ptr unsafe.Pointer, widg
 func (ptr *QDesignerFormWindowInterface) ConnectWidgetRemoved(f func(widget *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectWidgetRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "widgetRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "widgetRemoved", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectWidgetRemoved() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectWidgetRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "widgetRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "widgetRemoved")
 	}
 }
 
@@ -5200,7 +5235,7 @@ func (ptr *QDesignerFormWindowInterface) WidgetRemoved(widget widgets.QWidget_IT
 
 //export callbackQDesignerFormWindowInterface_WidgetUnmanaged
 func callbackQDesignerFormWindowInterface_WidgetUnmanaged(ptr unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "widgetUnmanaged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "widgetUnmanaged"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(widget))
 	}
 
@@ -5209,14 +5244,14 @@ func callbackQDesignerFormWindowInterface_WidgetUnmanaged(ptr unsafe.Pointer, wi
 func (ptr *QDesignerFormWindowInterface) ConnectWidgetUnmanaged(f func(widget *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_ConnectWidgetUnmanaged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "widgetUnmanaged", f)
+		qt.ConnectSignal(ptr.Pointer(), "widgetUnmanaged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectWidgetUnmanaged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DisconnectWidgetUnmanaged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "widgetUnmanaged")
+		qt.DisconnectSignal(ptr.Pointer(), "widgetUnmanaged")
 	}
 }
 
@@ -5228,7 +5263,7 @@ func (ptr *QDesignerFormWindowInterface) WidgetUnmanaged(widget widgets.QWidget_
 
 //export callbackQDesignerFormWindowInterface_DestroyQDesignerFormWindowInterface
 func callbackQDesignerFormWindowInterface_DestroyQDesignerFormWindowInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerFormWindowInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerFormWindowInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).DestroyQDesignerFormWindowInterfaceDefault()
@@ -5238,21 +5273,21 @@ func callbackQDesignerFormWindowInterface_DestroyQDesignerFormWindowInterface(pt
 func (ptr *QDesignerFormWindowInterface) ConnectDestroyQDesignerFormWindowInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerFormWindowInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerFormWindowInterface", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectDestroyQDesignerFormWindowInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerFormWindowInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerFormWindowInterface")
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DestroyQDesignerFormWindowInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DestroyQDesignerFormWindowInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5260,14 +5295,14 @@ func (ptr *QDesignerFormWindowInterface) DestroyQDesignerFormWindowInterface() {
 func (ptr *QDesignerFormWindowInterface) DestroyQDesignerFormWindowInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DestroyQDesignerFormWindowInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerFormWindowInterface_Features
 func callbackQDesignerFormWindowInterface_Features(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "features"); signal != nil {
+	if signal := qt.GetSignal(ptr, "features"); signal != nil {
 		return C.longlong(signal.(func() QDesignerFormWindowInterface__FeatureFlag)())
 	}
 
@@ -5277,14 +5312,14 @@ func callbackQDesignerFormWindowInterface_Features(ptr unsafe.Pointer) C.longlon
 func (ptr *QDesignerFormWindowInterface) ConnectFeatures(f func() QDesignerFormWindowInterface__FeatureFlag) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "features", f)
+		qt.ConnectSignal(ptr.Pointer(), "features", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectFeatures() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "features")
+		qt.DisconnectSignal(ptr.Pointer(), "features")
 	}
 }
 
@@ -5297,7 +5332,7 @@ func (ptr *QDesignerFormWindowInterface) Features() QDesignerFormWindowInterface
 
 //export callbackQDesignerFormWindowInterface_Core
 func callbackQDesignerFormWindowInterface_Core(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "core"); signal != nil {
+	if signal := qt.GetSignal(ptr, "core"); signal != nil {
 		return PointerFromQDesignerFormEditorInterface(signal.(func() *QDesignerFormEditorInterface)())
 	}
 
@@ -5307,21 +5342,21 @@ func callbackQDesignerFormWindowInterface_Core(ptr unsafe.Pointer) unsafe.Pointe
 func (ptr *QDesignerFormWindowInterface) ConnectCore(f func() *QDesignerFormEditorInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "core", f)
+		qt.ConnectSignal(ptr.Pointer(), "core", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectCore() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "core")
+		qt.DisconnectSignal(ptr.Pointer(), "core")
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) Core() *QDesignerFormEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerFormWindowInterface_Core(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5332,7 +5367,7 @@ func (ptr *QDesignerFormWindowInterface) Core() *QDesignerFormEditorInterface {
 func (ptr *QDesignerFormWindowInterface) CoreDefault() *QDesignerFormEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerFormWindowInterface_CoreDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5342,7 +5377,7 @@ func (ptr *QDesignerFormWindowInterface) CoreDefault() *QDesignerFormEditorInter
 
 //export callbackQDesignerFormWindowInterface_Cursor
 func callbackQDesignerFormWindowInterface_Cursor(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cursor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cursor"); signal != nil {
 		return PointerFromQDesignerFormWindowCursorInterface(signal.(func() *QDesignerFormWindowCursorInterface)())
 	}
 
@@ -5352,14 +5387,14 @@ func callbackQDesignerFormWindowInterface_Cursor(ptr unsafe.Pointer) unsafe.Poin
 func (ptr *QDesignerFormWindowInterface) ConnectCursor(f func() *QDesignerFormWindowCursorInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cursor", f)
+		qt.ConnectSignal(ptr.Pointer(), "cursor", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectCursor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cursor")
+		qt.DisconnectSignal(ptr.Pointer(), "cursor")
 	}
 }
 
@@ -5372,7 +5407,7 @@ func (ptr *QDesignerFormWindowInterface) Cursor() *QDesignerFormWindowCursorInte
 
 //export callbackQDesignerFormWindowInterface_AbsoluteDir
 func callbackQDesignerFormWindowInterface_AbsoluteDir(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "absoluteDir"); signal != nil {
+	if signal := qt.GetSignal(ptr, "absoluteDir"); signal != nil {
 		return core.PointerFromQDir(signal.(func() *core.QDir)())
 	}
 
@@ -5382,14 +5417,14 @@ func callbackQDesignerFormWindowInterface_AbsoluteDir(ptr unsafe.Pointer) unsafe
 func (ptr *QDesignerFormWindowInterface) ConnectAbsoluteDir(f func() *core.QDir) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "absoluteDir", f)
+		qt.ConnectSignal(ptr.Pointer(), "absoluteDir", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectAbsoluteDir() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "absoluteDir")
+		qt.DisconnectSignal(ptr.Pointer(), "absoluteDir")
 	}
 }
 
@@ -5404,7 +5439,7 @@ func (ptr *QDesignerFormWindowInterface) AbsoluteDir() *core.QDir {
 
 //export callbackQDesignerFormWindowInterface_Grid
 func callbackQDesignerFormWindowInterface_Grid(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "grid"); signal != nil {
+	if signal := qt.GetSignal(ptr, "grid"); signal != nil {
 		return core.PointerFromQPoint(signal.(func() *core.QPoint)())
 	}
 
@@ -5414,14 +5449,14 @@ func callbackQDesignerFormWindowInterface_Grid(ptr unsafe.Pointer) unsafe.Pointe
 func (ptr *QDesignerFormWindowInterface) ConnectGrid(f func() *core.QPoint) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "grid", f)
+		qt.ConnectSignal(ptr.Pointer(), "grid", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectGrid() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "grid")
+		qt.DisconnectSignal(ptr.Pointer(), "grid")
 	}
 }
 
@@ -5436,7 +5471,7 @@ func (ptr *QDesignerFormWindowInterface) Grid() *core.QPoint {
 
 //export callbackQDesignerFormWindowInterface_Author
 func callbackQDesignerFormWindowInterface_Author(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "author"); signal != nil {
+	if signal := qt.GetSignal(ptr, "author"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5446,14 +5481,14 @@ func callbackQDesignerFormWindowInterface_Author(ptr unsafe.Pointer) *C.char {
 func (ptr *QDesignerFormWindowInterface) ConnectAuthor(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "author", f)
+		qt.ConnectSignal(ptr.Pointer(), "author", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectAuthor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "author")
+		qt.DisconnectSignal(ptr.Pointer(), "author")
 	}
 }
 
@@ -5466,7 +5501,7 @@ func (ptr *QDesignerFormWindowInterface) Author() string {
 
 //export callbackQDesignerFormWindowInterface_Comment
 func callbackQDesignerFormWindowInterface_Comment(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "comment"); signal != nil {
+	if signal := qt.GetSignal(ptr, "comment"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5476,14 +5511,14 @@ func callbackQDesignerFormWindowInterface_Comment(ptr unsafe.Pointer) *C.char {
 func (ptr *QDesignerFormWindowInterface) ConnectComment(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "comment", f)
+		qt.ConnectSignal(ptr.Pointer(), "comment", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectComment() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "comment")
+		qt.DisconnectSignal(ptr.Pointer(), "comment")
 	}
 }
 
@@ -5496,7 +5531,7 @@ func (ptr *QDesignerFormWindowInterface) Comment() string {
 
 //export callbackQDesignerFormWindowInterface_Contents
 func callbackQDesignerFormWindowInterface_Contents(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contents"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contents"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5506,14 +5541,14 @@ func callbackQDesignerFormWindowInterface_Contents(ptr unsafe.Pointer) *C.char {
 func (ptr *QDesignerFormWindowInterface) ConnectContents(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contents", f)
+		qt.ConnectSignal(ptr.Pointer(), "contents", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectContents() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contents")
+		qt.DisconnectSignal(ptr.Pointer(), "contents")
 	}
 }
 
@@ -5526,7 +5561,7 @@ func (ptr *QDesignerFormWindowInterface) Contents() string {
 
 //export callbackQDesignerFormWindowInterface_ExportMacro
 func callbackQDesignerFormWindowInterface_ExportMacro(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "exportMacro"); signal != nil {
+	if signal := qt.GetSignal(ptr, "exportMacro"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5536,14 +5571,14 @@ func callbackQDesignerFormWindowInterface_ExportMacro(ptr unsafe.Pointer) *C.cha
 func (ptr *QDesignerFormWindowInterface) ConnectExportMacro(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "exportMacro", f)
+		qt.ConnectSignal(ptr.Pointer(), "exportMacro", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectExportMacro() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "exportMacro")
+		qt.DisconnectSignal(ptr.Pointer(), "exportMacro")
 	}
 }
 
@@ -5556,7 +5591,7 @@ func (ptr *QDesignerFormWindowInterface) ExportMacro() string {
 
 //export callbackQDesignerFormWindowInterface_FileName
 func callbackQDesignerFormWindowInterface_FileName(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fileName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fileName"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5566,14 +5601,14 @@ func callbackQDesignerFormWindowInterface_FileName(ptr unsafe.Pointer) *C.char {
 func (ptr *QDesignerFormWindowInterface) ConnectFileName(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fileName", f)
+		qt.ConnectSignal(ptr.Pointer(), "fileName", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectFileName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fileName")
+		qt.DisconnectSignal(ptr.Pointer(), "fileName")
 	}
 }
 
@@ -5586,7 +5621,7 @@ func (ptr *QDesignerFormWindowInterface) FileName() string {
 
 //export callbackQDesignerFormWindowInterface_PixmapFunction
 func callbackQDesignerFormWindowInterface_PixmapFunction(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pixmapFunction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pixmapFunction"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5596,14 +5631,14 @@ func callbackQDesignerFormWindowInterface_PixmapFunction(ptr unsafe.Pointer) *C.
 func (ptr *QDesignerFormWindowInterface) ConnectPixmapFunction(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pixmapFunction", f)
+		qt.ConnectSignal(ptr.Pointer(), "pixmapFunction", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectPixmapFunction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pixmapFunction")
+		qt.DisconnectSignal(ptr.Pointer(), "pixmapFunction")
 	}
 }
 
@@ -5616,104 +5651,104 @@ func (ptr *QDesignerFormWindowInterface) PixmapFunction() string {
 
 func (ptr *QDesignerFormWindowInterface) ActiveResourceFilePaths() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QDesignerFormWindowInterface_ActiveResourceFilePaths(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QDesignerFormWindowInterface_ActiveResourceFilePaths(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQDesignerFormWindowInterface_CheckContents
 func callbackQDesignerFormWindowInterface_CheckContents(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "checkContents"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "checkContents"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(make([]string, 0), "|"))
+	return cGoPackStringList(make([]string, 0))
 }
 
 func (ptr *QDesignerFormWindowInterface) ConnectCheckContents(f func() []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "checkContents", f)
+		qt.ConnectSignal(ptr.Pointer(), "checkContents", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectCheckContents() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "checkContents")
+		qt.DisconnectSignal(ptr.Pointer(), "checkContents")
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) CheckContents() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QDesignerFormWindowInterface_CheckContents(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QDesignerFormWindowInterface_CheckContents(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQDesignerFormWindowInterface_IncludeHints
 func callbackQDesignerFormWindowInterface_IncludeHints(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "includeHints"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "includeHints"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(make([]string, 0), "|"))
+	return cGoPackStringList(make([]string, 0))
 }
 
 func (ptr *QDesignerFormWindowInterface) ConnectIncludeHints(f func() []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "includeHints", f)
+		qt.ConnectSignal(ptr.Pointer(), "includeHints", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectIncludeHints() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "includeHints")
+		qt.DisconnectSignal(ptr.Pointer(), "includeHints")
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) IncludeHints() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QDesignerFormWindowInterface_IncludeHints(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QDesignerFormWindowInterface_IncludeHints(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQDesignerFormWindowInterface_ResourceFiles
 func callbackQDesignerFormWindowInterface_ResourceFiles(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resourceFiles"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "resourceFiles"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(make([]string, 0), "|"))
+	return cGoPackStringList(make([]string, 0))
 }
 
 func (ptr *QDesignerFormWindowInterface) ConnectResourceFiles(f func() []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resourceFiles", f)
+		qt.ConnectSignal(ptr.Pointer(), "resourceFiles", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectResourceFiles() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resourceFiles")
+		qt.DisconnectSignal(ptr.Pointer(), "resourceFiles")
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) ResourceFiles() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QDesignerFormWindowInterface_ResourceFiles(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QDesignerFormWindowInterface_ResourceFiles(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQDesignerFormWindowInterface_FormContainer
 func callbackQDesignerFormWindowInterface_FormContainer(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formContainer"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formContainer"); signal != nil {
 		return widgets.PointerFromQWidget(signal.(func() *widgets.QWidget)())
 	}
 
@@ -5723,21 +5758,21 @@ func callbackQDesignerFormWindowInterface_FormContainer(ptr unsafe.Pointer) unsa
 func (ptr *QDesignerFormWindowInterface) ConnectFormContainer(f func() *widgets.QWidget) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formContainer", f)
+		qt.ConnectSignal(ptr.Pointer(), "formContainer", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectFormContainer() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formContainer")
+		qt.DisconnectSignal(ptr.Pointer(), "formContainer")
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) FormContainer() *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QDesignerFormWindowInterface_FormContainer(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5747,7 +5782,7 @@ func (ptr *QDesignerFormWindowInterface) FormContainer() *widgets.QWidget {
 
 //export callbackQDesignerFormWindowInterface_ResourceFileSaveMode
 func callbackQDesignerFormWindowInterface_ResourceFileSaveMode(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resourceFileSaveMode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resourceFileSaveMode"); signal != nil {
 		return C.longlong(signal.(func() QDesignerFormWindowInterface__ResourceFileSaveMode)())
 	}
 
@@ -5757,14 +5792,14 @@ func callbackQDesignerFormWindowInterface_ResourceFileSaveMode(ptr unsafe.Pointe
 func (ptr *QDesignerFormWindowInterface) ConnectResourceFileSaveMode(f func() QDesignerFormWindowInterface__ResourceFileSaveMode) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resourceFileSaveMode", f)
+		qt.ConnectSignal(ptr.Pointer(), "resourceFileSaveMode", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectResourceFileSaveMode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resourceFileSaveMode")
+		qt.DisconnectSignal(ptr.Pointer(), "resourceFileSaveMode")
 	}
 }
 
@@ -5777,7 +5812,7 @@ func (ptr *QDesignerFormWindowInterface) ResourceFileSaveMode() QDesignerFormWin
 
 //export callbackQDesignerFormWindowInterface_HasFeature
 func callbackQDesignerFormWindowInterface_HasFeature(ptr unsafe.Pointer, feature C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasFeature"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasFeature"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(QDesignerFormWindowInterface__FeatureFlag) bool)(QDesignerFormWindowInterface__FeatureFlag(feature)))))
 	}
 
@@ -5787,14 +5822,14 @@ func callbackQDesignerFormWindowInterface_HasFeature(ptr unsafe.Pointer, feature
 func (ptr *QDesignerFormWindowInterface) ConnectHasFeature(f func(feature QDesignerFormWindowInterface__FeatureFlag) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasFeature", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasFeature", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectHasFeature() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasFeature")
+		qt.DisconnectSignal(ptr.Pointer(), "hasFeature")
 	}
 }
 
@@ -5807,7 +5842,7 @@ func (ptr *QDesignerFormWindowInterface) HasFeature(feature QDesignerFormWindowI
 
 //export callbackQDesignerFormWindowInterface_IsDirty
 func callbackQDesignerFormWindowInterface_IsDirty(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isDirty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isDirty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5817,14 +5852,14 @@ func callbackQDesignerFormWindowInterface_IsDirty(ptr unsafe.Pointer) C.char {
 func (ptr *QDesignerFormWindowInterface) ConnectIsDirty(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isDirty", f)
+		qt.ConnectSignal(ptr.Pointer(), "isDirty", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectIsDirty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isDirty")
+		qt.DisconnectSignal(ptr.Pointer(), "isDirty")
 	}
 }
 
@@ -5837,7 +5872,7 @@ func (ptr *QDesignerFormWindowInterface) IsDirty() bool {
 
 //export callbackQDesignerFormWindowInterface_IsManaged
 func callbackQDesignerFormWindowInterface_IsManaged(ptr unsafe.Pointer, widget unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isManaged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isManaged"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*widgets.QWidget) bool)(widgets.NewQWidgetFromPointer(widget)))))
 	}
 
@@ -5847,14 +5882,14 @@ func callbackQDesignerFormWindowInterface_IsManaged(ptr unsafe.Pointer, widget u
 func (ptr *QDesignerFormWindowInterface) ConnectIsManaged(f func(widget *widgets.QWidget) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isManaged", f)
+		qt.ConnectSignal(ptr.Pointer(), "isManaged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowInterface) DisconnectIsManaged() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isManaged")
+		qt.DisconnectSignal(ptr.Pointer(), "isManaged")
 	}
 }
 
@@ -5868,7 +5903,7 @@ func (ptr *QDesignerFormWindowInterface) IsManaged(widget widgets.QWidget_ITF) b
 func (ptr *QDesignerFormWindowInterface) __simplifySelection_widgets_atList(i int) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QDesignerFormWindowInterface___simplifySelection_widgets_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5889,7 +5924,7 @@ func (ptr *QDesignerFormWindowInterface) __simplifySelection_widgets_newList() u
 func (ptr *QDesignerFormWindowInterface) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerFormWindowInterface___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5910,7 +5945,7 @@ func (ptr *QDesignerFormWindowInterface) __addActions_actions_newList() unsafe.P
 func (ptr *QDesignerFormWindowInterface) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerFormWindowInterface___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5931,7 +5966,7 @@ func (ptr *QDesignerFormWindowInterface) __insertActions_actions_newList() unsaf
 func (ptr *QDesignerFormWindowInterface) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerFormWindowInterface___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5971,7 +6006,7 @@ func (ptr *QDesignerFormWindowInterface) __dynamicPropertyNames_newList() unsafe
 func (ptr *QDesignerFormWindowInterface) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormWindowInterface___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5992,7 +6027,7 @@ func (ptr *QDesignerFormWindowInterface) __findChildren_newList2() unsafe.Pointe
 func (ptr *QDesignerFormWindowInterface) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormWindowInterface___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6013,7 +6048,7 @@ func (ptr *QDesignerFormWindowInterface) __findChildren_newList3() unsafe.Pointe
 func (ptr *QDesignerFormWindowInterface) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormWindowInterface___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6034,7 +6069,7 @@ func (ptr *QDesignerFormWindowInterface) __findChildren_newList() unsafe.Pointer
 func (ptr *QDesignerFormWindowInterface) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormWindowInterface___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6054,7 +6089,7 @@ func (ptr *QDesignerFormWindowInterface) __children_newList() unsafe.Pointer {
 
 //export callbackQDesignerFormWindowInterface_Close
 func callbackQDesignerFormWindowInterface_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6070,7 +6105,7 @@ func (ptr *QDesignerFormWindowInterface) CloseDefault() bool {
 
 //export callbackQDesignerFormWindowInterface_Event
 func callbackQDesignerFormWindowInterface_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -6086,7 +6121,7 @@ func (ptr *QDesignerFormWindowInterface) EventDefault(event core.QEvent_ITF) boo
 
 //export callbackQDesignerFormWindowInterface_FocusNextPrevChild
 func callbackQDesignerFormWindowInterface_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -6102,7 +6137,7 @@ func (ptr *QDesignerFormWindowInterface) FocusNextPrevChildDefault(next bool) bo
 
 //export callbackQDesignerFormWindowInterface_NativeEvent
 func callbackQDesignerFormWindowInterface_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -6118,7 +6153,7 @@ func (ptr *QDesignerFormWindowInterface) NativeEventDefault(eventType core.QByte
 
 //export callbackQDesignerFormWindowInterface_ActionEvent
 func callbackQDesignerFormWindowInterface_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -6133,7 +6168,7 @@ func (ptr *QDesignerFormWindowInterface) ActionEventDefault(event gui.QActionEve
 
 //export callbackQDesignerFormWindowInterface_ChangeEvent
 func callbackQDesignerFormWindowInterface_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -6148,7 +6183,7 @@ func (ptr *QDesignerFormWindowInterface) ChangeEventDefault(event core.QEvent_IT
 
 //export callbackQDesignerFormWindowInterface_CloseEvent
 func callbackQDesignerFormWindowInterface_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -6163,7 +6198,7 @@ func (ptr *QDesignerFormWindowInterface) CloseEventDefault(event gui.QCloseEvent
 
 //export callbackQDesignerFormWindowInterface_ContextMenuEvent
 func callbackQDesignerFormWindowInterface_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -6178,7 +6213,7 @@ func (ptr *QDesignerFormWindowInterface) ContextMenuEventDefault(event gui.QCont
 
 //export callbackQDesignerFormWindowInterface_CustomContextMenuRequested
 func callbackQDesignerFormWindowInterface_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -6186,7 +6221,7 @@ func callbackQDesignerFormWindowInterface_CustomContextMenuRequested(ptr unsafe.
 
 //export callbackQDesignerFormWindowInterface_DragEnterEvent
 func callbackQDesignerFormWindowInterface_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -6201,7 +6236,7 @@ func (ptr *QDesignerFormWindowInterface) DragEnterEventDefault(event gui.QDragEn
 
 //export callbackQDesignerFormWindowInterface_DragLeaveEvent
 func callbackQDesignerFormWindowInterface_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -6216,7 +6251,7 @@ func (ptr *QDesignerFormWindowInterface) DragLeaveEventDefault(event gui.QDragLe
 
 //export callbackQDesignerFormWindowInterface_DragMoveEvent
 func callbackQDesignerFormWindowInterface_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -6231,7 +6266,7 @@ func (ptr *QDesignerFormWindowInterface) DragMoveEventDefault(event gui.QDragMov
 
 //export callbackQDesignerFormWindowInterface_DropEvent
 func callbackQDesignerFormWindowInterface_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -6246,7 +6281,7 @@ func (ptr *QDesignerFormWindowInterface) DropEventDefault(event gui.QDropEvent_I
 
 //export callbackQDesignerFormWindowInterface_EnterEvent
 func callbackQDesignerFormWindowInterface_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -6261,7 +6296,7 @@ func (ptr *QDesignerFormWindowInterface) EnterEventDefault(event core.QEvent_ITF
 
 //export callbackQDesignerFormWindowInterface_FocusInEvent
 func callbackQDesignerFormWindowInterface_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -6276,7 +6311,7 @@ func (ptr *QDesignerFormWindowInterface) FocusInEventDefault(event gui.QFocusEve
 
 //export callbackQDesignerFormWindowInterface_FocusOutEvent
 func callbackQDesignerFormWindowInterface_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -6291,7 +6326,7 @@ func (ptr *QDesignerFormWindowInterface) FocusOutEventDefault(event gui.QFocusEv
 
 //export callbackQDesignerFormWindowInterface_Hide
 func callbackQDesignerFormWindowInterface_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).HideDefault()
@@ -6306,7 +6341,7 @@ func (ptr *QDesignerFormWindowInterface) HideDefault() {
 
 //export callbackQDesignerFormWindowInterface_HideEvent
 func callbackQDesignerFormWindowInterface_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -6321,7 +6356,7 @@ func (ptr *QDesignerFormWindowInterface) HideEventDefault(event gui.QHideEvent_I
 
 //export callbackQDesignerFormWindowInterface_InputMethodEvent
 func callbackQDesignerFormWindowInterface_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -6336,7 +6371,7 @@ func (ptr *QDesignerFormWindowInterface) InputMethodEventDefault(event gui.QInpu
 
 //export callbackQDesignerFormWindowInterface_KeyPressEvent
 func callbackQDesignerFormWindowInterface_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -6351,7 +6386,7 @@ func (ptr *QDesignerFormWindowInterface) KeyPressEventDefault(event gui.QKeyEven
 
 //export callbackQDesignerFormWindowInterface_KeyReleaseEvent
 func callbackQDesignerFormWindowInterface_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -6366,7 +6401,7 @@ func (ptr *QDesignerFormWindowInterface) KeyReleaseEventDefault(event gui.QKeyEv
 
 //export callbackQDesignerFormWindowInterface_LeaveEvent
 func callbackQDesignerFormWindowInterface_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -6381,7 +6416,7 @@ func (ptr *QDesignerFormWindowInterface) LeaveEventDefault(event core.QEvent_ITF
 
 //export callbackQDesignerFormWindowInterface_Lower
 func callbackQDesignerFormWindowInterface_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).LowerDefault()
@@ -6396,7 +6431,7 @@ func (ptr *QDesignerFormWindowInterface) LowerDefault() {
 
 //export callbackQDesignerFormWindowInterface_MouseDoubleClickEvent
 func callbackQDesignerFormWindowInterface_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6411,7 +6446,7 @@ func (ptr *QDesignerFormWindowInterface) MouseDoubleClickEventDefault(event gui.
 
 //export callbackQDesignerFormWindowInterface_MouseMoveEvent
 func callbackQDesignerFormWindowInterface_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6426,7 +6461,7 @@ func (ptr *QDesignerFormWindowInterface) MouseMoveEventDefault(event gui.QMouseE
 
 //export callbackQDesignerFormWindowInterface_MousePressEvent
 func callbackQDesignerFormWindowInterface_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6441,7 +6476,7 @@ func (ptr *QDesignerFormWindowInterface) MousePressEventDefault(event gui.QMouse
 
 //export callbackQDesignerFormWindowInterface_MouseReleaseEvent
 func callbackQDesignerFormWindowInterface_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6456,7 +6491,7 @@ func (ptr *QDesignerFormWindowInterface) MouseReleaseEventDefault(event gui.QMou
 
 //export callbackQDesignerFormWindowInterface_MoveEvent
 func callbackQDesignerFormWindowInterface_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -6471,7 +6506,7 @@ func (ptr *QDesignerFormWindowInterface) MoveEventDefault(event gui.QMoveEvent_I
 
 //export callbackQDesignerFormWindowInterface_PaintEvent
 func callbackQDesignerFormWindowInterface_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -6486,7 +6521,7 @@ func (ptr *QDesignerFormWindowInterface) PaintEventDefault(event gui.QPaintEvent
 
 //export callbackQDesignerFormWindowInterface_Raise
 func callbackQDesignerFormWindowInterface_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).RaiseDefault()
@@ -6501,7 +6536,7 @@ func (ptr *QDesignerFormWindowInterface) RaiseDefault() {
 
 //export callbackQDesignerFormWindowInterface_Repaint
 func callbackQDesignerFormWindowInterface_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).RepaintDefault()
@@ -6516,7 +6551,7 @@ func (ptr *QDesignerFormWindowInterface) RepaintDefault() {
 
 //export callbackQDesignerFormWindowInterface_ResizeEvent
 func callbackQDesignerFormWindowInterface_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -6531,7 +6566,7 @@ func (ptr *QDesignerFormWindowInterface) ResizeEventDefault(event gui.QResizeEve
 
 //export callbackQDesignerFormWindowInterface_SetDisabled
 func callbackQDesignerFormWindowInterface_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -6546,7 +6581,7 @@ func (ptr *QDesignerFormWindowInterface) SetDisabledDefault(disable bool) {
 
 //export callbackQDesignerFormWindowInterface_SetEnabled
 func callbackQDesignerFormWindowInterface_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -6561,7 +6596,7 @@ func (ptr *QDesignerFormWindowInterface) SetEnabledDefault(vbo bool) {
 
 //export callbackQDesignerFormWindowInterface_SetFocus2
 func callbackQDesignerFormWindowInterface_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).SetFocus2Default()
@@ -6576,7 +6611,7 @@ func (ptr *QDesignerFormWindowInterface) SetFocus2Default() {
 
 //export callbackQDesignerFormWindowInterface_SetHidden
 func callbackQDesignerFormWindowInterface_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -6591,7 +6626,7 @@ func (ptr *QDesignerFormWindowInterface) SetHiddenDefault(hidden bool) {
 
 //export callbackQDesignerFormWindowInterface_SetStyleSheet
 func callbackQDesignerFormWindowInterface_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -6608,7 +6643,7 @@ func (ptr *QDesignerFormWindowInterface) SetStyleSheetDefault(styleSheet string)
 
 //export callbackQDesignerFormWindowInterface_SetVisible
 func callbackQDesignerFormWindowInterface_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -6623,7 +6658,7 @@ func (ptr *QDesignerFormWindowInterface) SetVisibleDefault(visible bool) {
 
 //export callbackQDesignerFormWindowInterface_SetWindowModified
 func callbackQDesignerFormWindowInterface_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -6638,7 +6673,7 @@ func (ptr *QDesignerFormWindowInterface) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQDesignerFormWindowInterface_SetWindowTitle
 func callbackQDesignerFormWindowInterface_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -6655,7 +6690,7 @@ func (ptr *QDesignerFormWindowInterface) SetWindowTitleDefault(vqs string) {
 
 //export callbackQDesignerFormWindowInterface_Show
 func callbackQDesignerFormWindowInterface_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ShowDefault()
@@ -6670,7 +6705,7 @@ func (ptr *QDesignerFormWindowInterface) ShowDefault() {
 
 //export callbackQDesignerFormWindowInterface_ShowEvent
 func callbackQDesignerFormWindowInterface_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -6685,7 +6720,7 @@ func (ptr *QDesignerFormWindowInterface) ShowEventDefault(event gui.QShowEvent_I
 
 //export callbackQDesignerFormWindowInterface_ShowFullScreen
 func callbackQDesignerFormWindowInterface_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ShowFullScreenDefault()
@@ -6700,7 +6735,7 @@ func (ptr *QDesignerFormWindowInterface) ShowFullScreenDefault() {
 
 //export callbackQDesignerFormWindowInterface_ShowMaximized
 func callbackQDesignerFormWindowInterface_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ShowMaximizedDefault()
@@ -6715,7 +6750,7 @@ func (ptr *QDesignerFormWindowInterface) ShowMaximizedDefault() {
 
 //export callbackQDesignerFormWindowInterface_ShowMinimized
 func callbackQDesignerFormWindowInterface_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ShowMinimizedDefault()
@@ -6730,7 +6765,7 @@ func (ptr *QDesignerFormWindowInterface) ShowMinimizedDefault() {
 
 //export callbackQDesignerFormWindowInterface_ShowNormal
 func callbackQDesignerFormWindowInterface_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ShowNormalDefault()
@@ -6745,7 +6780,7 @@ func (ptr *QDesignerFormWindowInterface) ShowNormalDefault() {
 
 //export callbackQDesignerFormWindowInterface_TabletEvent
 func callbackQDesignerFormWindowInterface_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -6760,7 +6795,7 @@ func (ptr *QDesignerFormWindowInterface) TabletEventDefault(event gui.QTabletEve
 
 //export callbackQDesignerFormWindowInterface_Update
 func callbackQDesignerFormWindowInterface_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).UpdateDefault()
@@ -6775,7 +6810,7 @@ func (ptr *QDesignerFormWindowInterface) UpdateDefault() {
 
 //export callbackQDesignerFormWindowInterface_UpdateMicroFocus
 func callbackQDesignerFormWindowInterface_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).UpdateMicroFocusDefault()
@@ -6790,7 +6825,7 @@ func (ptr *QDesignerFormWindowInterface) UpdateMicroFocusDefault() {
 
 //export callbackQDesignerFormWindowInterface_WheelEvent
 func callbackQDesignerFormWindowInterface_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -6805,7 +6840,7 @@ func (ptr *QDesignerFormWindowInterface) WheelEventDefault(event gui.QWheelEvent
 
 //export callbackQDesignerFormWindowInterface_WindowIconChanged
 func callbackQDesignerFormWindowInterface_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -6813,7 +6848,7 @@ func callbackQDesignerFormWindowInterface_WindowIconChanged(ptr unsafe.Pointer,
 
 //export callbackQDesignerFormWindowInterface_WindowTitleChanged
 func callbackQDesignerFormWindowInterface_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -6821,7 +6856,7 @@ func callbackQDesignerFormWindowInterface_WindowTitleChanged(ptr unsafe.Pointer,
 
 //export callbackQDesignerFormWindowInterface_PaintEngine
 func callbackQDesignerFormWindowInterface_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -6837,7 +6872,7 @@ func (ptr *QDesignerFormWindowInterface) PaintEngineDefault() *gui.QPaintEngine
 
 //export callbackQDesignerFormWindowInterface_MinimumSizeHint
 func callbackQDesignerFormWindowInterface_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -6855,7 +6890,7 @@ func (ptr *QDesignerFormWindowInterface) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQDesignerFormWindowInterface_SizeHint
 func callbackQDesignerFormWindowInterface_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -6873,7 +6908,7 @@ func (ptr *QDesignerFormWindowInterface) SizeHintDefault() *core.QSize {
 
 //export callbackQDesignerFormWindowInterface_InputMethodQuery
 func callbackQDesignerFormWindowInterface_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -6891,7 +6926,7 @@ func (ptr *QDesignerFormWindowInterface) InputMethodQueryDefault(query core.Qt__
 
 //export callbackQDesignerFormWindowInterface_HasHeightForWidth
 func callbackQDesignerFormWindowInterface_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6907,7 +6942,7 @@ func (ptr *QDesignerFormWindowInterface) HasHeightForWidthDefault() bool {
 
 //export callbackQDesignerFormWindowInterface_HeightForWidth
 func callbackQDesignerFormWindowInterface_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -6923,7 +6958,7 @@ func (ptr *QDesignerFormWindowInterface) HeightForWidthDefault(w int) int {
 
 //export callbackQDesignerFormWindowInterface_Metric
 func callbackQDesignerFormWindowInterface_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -6939,7 +6974,7 @@ func (ptr *QDesignerFormWindowInterface) MetricDefault(m gui.QPaintDevice__Paint
 
 //export callbackQDesignerFormWindowInterface_EventFilter
 func callbackQDesignerFormWindowInterface_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -6955,7 +6990,7 @@ func (ptr *QDesignerFormWindowInterface) EventFilterDefault(watched core.QObject
 
 //export callbackQDesignerFormWindowInterface_ChildEvent
 func callbackQDesignerFormWindowInterface_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -6970,7 +7005,7 @@ func (ptr *QDesignerFormWindowInterface) ChildEventDefault(event core.QChildEven
 
 //export callbackQDesignerFormWindowInterface_ConnectNotify
 func callbackQDesignerFormWindowInterface_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6985,7 +7020,7 @@ func (ptr *QDesignerFormWindowInterface) ConnectNotifyDefault(sign core.QMetaMet
 
 //export callbackQDesignerFormWindowInterface_CustomEvent
 func callbackQDesignerFormWindowInterface_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -7000,7 +7035,7 @@ func (ptr *QDesignerFormWindowInterface) CustomEventDefault(event core.QEvent_IT
 
 //export callbackQDesignerFormWindowInterface_DeleteLater
 func callbackQDesignerFormWindowInterface_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).DeleteLaterDefault()
@@ -7010,14 +7045,14 @@ func callbackQDesignerFormWindowInterface_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QDesignerFormWindowInterface) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowInterface_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerFormWindowInterface_Destroyed
 func callbackQDesignerFormWindowInterface_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -7025,7 +7060,7 @@ func callbackQDesignerFormWindowInterface_Destroyed(ptr unsafe.Pointer, obj unsa
 
 //export callbackQDesignerFormWindowInterface_DisconnectNotify
 func callbackQDesignerFormWindowInterface_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7040,7 +7075,7 @@ func (ptr *QDesignerFormWindowInterface) DisconnectNotifyDefault(sign core.QMeta
 
 //export callbackQDesignerFormWindowInterface_ObjectNameChanged
 func callbackQDesignerFormWindowInterface_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -7048,7 +7083,7 @@ func callbackQDesignerFormWindowInterface_ObjectNameChanged(ptr unsafe.Pointer,
 
 //export callbackQDesignerFormWindowInterface_TimerEvent
 func callbackQDesignerFormWindowInterface_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowInterfaceFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -7063,7 +7098,7 @@ func (ptr *QDesignerFormWindowInterface) TimerEventDefault(event core.QTimerEven
 
 //export callbackQDesignerFormWindowInterface_MetaObject
 func callbackQDesignerFormWindowInterface_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -7153,7 +7188,7 @@ const (
 
 //export callbackQDesignerFormWindowManagerInterface_CreateFormWindow
 func callbackQDesignerFormWindowManagerInterface_CreateFormWindow(ptr unsafe.Pointer, parent unsafe.Pointer, flags C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createFormWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createFormWindow"); signal != nil {
 		return PointerFromQDesignerFormWindowInterface(signal.(func(*widgets.QWidget, core.Qt__WindowType) *QDesignerFormWindowInterface)(widgets.NewQWidgetFromPointer(parent), core.Qt__WindowType(flags)))
 	}
 
@@ -7163,21 +7198,21 @@ func callbackQDesignerFormWindowManagerInterface_CreateFormWindow(ptr unsafe.Poi
 func (ptr *QDesignerFormWindowManagerInterface) ConnectCreateFormWindow(f func(parent *widgets.QWidget, flags core.Qt__WindowType) *QDesignerFormWindowInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createFormWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "createFormWindow", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectCreateFormWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createFormWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "createFormWindow")
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) CreateFormWindow(parent widgets.QWidget_ITF, flags core.Qt__WindowType) *QDesignerFormWindowInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormWindowInterfaceFromPointer(C.QDesignerFormWindowManagerInterface_CreateFormWindow(ptr.Pointer(), widgets.PointerFromQWidget(parent), C.longlong(flags)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7187,7 +7222,7 @@ func (ptr *QDesignerFormWindowManagerInterface) CreateFormWindow(parent widgets.
 
 //export callbackQDesignerFormWindowManagerInterface_ActiveFormWindowChanged
 func callbackQDesignerFormWindowManagerInterface_ActiveFormWindowChanged(ptr unsafe.Pointer, formWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeFormWindowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeFormWindowChanged"); signal != nil {
 		signal.(func(*QDesignerFormWindowInterface))(NewQDesignerFormWindowInterfaceFromPointer(formWindow))
 	}
 
@@ -7196,14 +7231,14 @@ func callbackQDesignerFormWindowManagerInterface_ActiveFormWindowChanged(ptr uns
 func (ptr *QDesignerFormWindowManagerInterface) ConnectActiveFormWindowChanged(f func(formWindow *QDesignerFormWindowInterface)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_ConnectActiveFormWindowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeFormWindowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeFormWindowChanged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectActiveFormWindowChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_DisconnectActiveFormWindowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeFormWindowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "activeFormWindowChanged")
 	}
 }
 
@@ -7215,7 +7250,7 @@ func (ptr *QDesignerFormWindowManagerInterface) ActiveFormWindowChanged(formWind
 
 //export callbackQDesignerFormWindowManagerInterface_AddFormWindow
 func callbackQDesignerFormWindowManagerInterface_AddFormWindow(ptr unsafe.Pointer, formWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "addFormWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "addFormWindow"); signal != nil {
 		signal.(func(*QDesignerFormWindowInterface))(NewQDesignerFormWindowInterfaceFromPointer(formWindow))
 	}
 
@@ -7224,14 +7259,14 @@ func callbackQDesignerFormWindowManagerInterface_AddFormWindow(ptr unsafe.Pointe
 func (ptr *QDesignerFormWindowManagerInterface) ConnectAddFormWindow(f func(formWindow *QDesignerFormWindowInterface)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "addFormWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "addFormWindow", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectAddFormWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "addFormWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "addFormWindow")
 	}
 }
 
@@ -7243,7 +7278,7 @@ func (ptr *QDesignerFormWindowManagerInterface) AddFormWindow(formWindow QDesign
 
 //export callbackQDesignerFormWindowManagerInterface_CloseAllPreviews
 func callbackQDesignerFormWindowManagerInterface_CloseAllPreviews(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeAllPreviews"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeAllPreviews"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7252,14 +7287,14 @@ func callbackQDesignerFormWindowManagerInterface_CloseAllPreviews(ptr unsafe.Poi
 func (ptr *QDesignerFormWindowManagerInterface) ConnectCloseAllPreviews(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "closeAllPreviews", f)
+		qt.ConnectSignal(ptr.Pointer(), "closeAllPreviews", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectCloseAllPreviews() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "closeAllPreviews")
+		qt.DisconnectSignal(ptr.Pointer(), "closeAllPreviews")
 	}
 }
 
@@ -7271,7 +7306,7 @@ func (ptr *QDesignerFormWindowManagerInterface) CloseAllPreviews() {
 
 //export callbackQDesignerFormWindowManagerInterface_FormWindowAdded
 func callbackQDesignerFormWindowManagerInterface_FormWindowAdded(ptr unsafe.Pointer, formWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formWindowAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formWindowAdded"); signal != nil {
 		signal.(func(*QDesignerFormWindowInterface))(NewQDesignerFormWindowInterfaceFromPointer(formWindow))
 	}
 
@@ -7280,14 +7315,14 @@ func callbackQDesignerFormWindowManagerInterface_FormWindowAdded(ptr unsafe.Poin
 func (ptr *QDesignerFormWindowManagerInterface) ConnectFormWindowAdded(f func(formWindow *QDesignerFormWindowInterface)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_ConnectFormWindowAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formWindowAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "formWindowAdded", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectFormWindowAdded() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_DisconnectFormWindowAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formWindowAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "formWindowAdded")
 	}
 }
 
@@ -7299,7 +7334,7 @@ func (ptr *QDesignerFormWindowManagerInterface) FormWindowAdded(formWindow QDesi
 
 //export callbackQDesignerFormWindowManagerInterface_FormWindowRemoved
 func callbackQDesignerFormWindowManagerInterface_FormWindowRemoved(ptr unsafe.Pointer, formWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formWindowRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formWindowRemoved"); signal != nil {
 		signal.(func(*QDesignerFormWindowInterface))(NewQDesignerFormWindowInterfaceFromPointer(formWindow))
 	}
 
@@ -7308,14 +7343,14 @@ func callbackQDesignerFormWindowManagerInterface_FormWindowRemoved(ptr unsafe.Po
 func (ptr *QDesignerFormWindowManagerInterface) ConnectFormWindowRemoved(f func(formWindow *QDesignerFormWindowInterface)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_ConnectFormWindowRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formWindowRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "formWindowRemoved", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectFormWindowRemoved() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_DisconnectFormWindowRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formWindowRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "formWindowRemoved")
 	}
 }
 
@@ -7327,7 +7362,7 @@ func (ptr *QDesignerFormWindowManagerInterface) FormWindowRemoved(formWindow QDe
 
 //export callbackQDesignerFormWindowManagerInterface_FormWindowSettingsChanged
 func callbackQDesignerFormWindowManagerInterface_FormWindowSettingsChanged(ptr unsafe.Pointer, formWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formWindowSettingsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formWindowSettingsChanged"); signal != nil {
 		signal.(func(*QDesignerFormWindowInterface))(NewQDesignerFormWindowInterfaceFromPointer(formWindow))
 	}
 
@@ -7336,14 +7371,14 @@ func callbackQDesignerFormWindowManagerInterface_FormWindowSettingsChanged(ptr u
 func (ptr *QDesignerFormWindowManagerInterface) ConnectFormWindowSettingsChanged(f func(formWindow *QDesignerFormWindowInterface)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_ConnectFormWindowSettingsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formWindowSettingsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "formWindowSettingsChanged", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectFormWindowSettingsChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_DisconnectFormWindowSettingsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formWindowSettingsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "formWindowSettingsChanged")
 	}
 }
 
@@ -7355,7 +7390,7 @@ func (ptr *QDesignerFormWindowManagerInterface) FormWindowSettingsChanged(formWi
 
 //export callbackQDesignerFormWindowManagerInterface_RemoveFormWindow
 func callbackQDesignerFormWindowManagerInterface_RemoveFormWindow(ptr unsafe.Pointer, formWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeFormWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeFormWindow"); signal != nil {
 		signal.(func(*QDesignerFormWindowInterface))(NewQDesignerFormWindowInterfaceFromPointer(formWindow))
 	}
 
@@ -7364,14 +7399,14 @@ func callbackQDesignerFormWindowManagerInterface_RemoveFormWindow(ptr unsafe.Poi
 func (ptr *QDesignerFormWindowManagerInterface) ConnectRemoveFormWindow(f func(formWindow *QDesignerFormWindowInterface)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "removeFormWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "removeFormWindow", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectRemoveFormWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "removeFormWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "removeFormWindow")
 	}
 }
 
@@ -7383,7 +7418,7 @@ func (ptr *QDesignerFormWindowManagerInterface) RemoveFormWindow(formWindow QDes
 
 //export callbackQDesignerFormWindowManagerInterface_SetActiveFormWindow
 func callbackQDesignerFormWindowManagerInterface_SetActiveFormWindow(ptr unsafe.Pointer, formWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setActiveFormWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setActiveFormWindow"); signal != nil {
 		signal.(func(*QDesignerFormWindowInterface))(NewQDesignerFormWindowInterfaceFromPointer(formWindow))
 	}
 
@@ -7392,14 +7427,14 @@ func callbackQDesignerFormWindowManagerInterface_SetActiveFormWindow(ptr unsafe.
 func (ptr *QDesignerFormWindowManagerInterface) ConnectSetActiveFormWindow(f func(formWindow *QDesignerFormWindowInterface)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setActiveFormWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "setActiveFormWindow", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectSetActiveFormWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setActiveFormWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "setActiveFormWindow")
 	}
 }
 
@@ -7411,7 +7446,7 @@ func (ptr *QDesignerFormWindowManagerInterface) SetActiveFormWindow(formWindow Q
 
 //export callbackQDesignerFormWindowManagerInterface_ShowPluginDialog
 func callbackQDesignerFormWindowManagerInterface_ShowPluginDialog(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showPluginDialog"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showPluginDialog"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7420,14 +7455,14 @@ func callbackQDesignerFormWindowManagerInterface_ShowPluginDialog(ptr unsafe.Poi
 func (ptr *QDesignerFormWindowManagerInterface) ConnectShowPluginDialog(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "showPluginDialog", f)
+		qt.ConnectSignal(ptr.Pointer(), "showPluginDialog", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectShowPluginDialog() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "showPluginDialog")
+		qt.DisconnectSignal(ptr.Pointer(), "showPluginDialog")
 	}
 }
 
@@ -7439,7 +7474,7 @@ func (ptr *QDesignerFormWindowManagerInterface) ShowPluginDialog() {
 
 //export callbackQDesignerFormWindowManagerInterface_ShowPreview
 func callbackQDesignerFormWindowManagerInterface_ShowPreview(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showPreview"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showPreview"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7448,14 +7483,14 @@ func callbackQDesignerFormWindowManagerInterface_ShowPreview(ptr unsafe.Pointer)
 func (ptr *QDesignerFormWindowManagerInterface) ConnectShowPreview(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "showPreview", f)
+		qt.ConnectSignal(ptr.Pointer(), "showPreview", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectShowPreview() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "showPreview")
+		qt.DisconnectSignal(ptr.Pointer(), "showPreview")
 	}
 }
 
@@ -7467,7 +7502,7 @@ func (ptr *QDesignerFormWindowManagerInterface) ShowPreview() {
 
 //export callbackQDesignerFormWindowManagerInterface_DestroyQDesignerFormWindowManagerInterface
 func callbackQDesignerFormWindowManagerInterface_DestroyQDesignerFormWindowManagerInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerFormWindowManagerInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerFormWindowManagerInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowManagerInterfaceFromPointer(ptr).DestroyQDesignerFormWindowManagerInterfaceDefault()
@@ -7477,21 +7512,21 @@ func callbackQDesignerFormWindowManagerInterface_DestroyQDesignerFormWindowManag
 func (ptr *QDesignerFormWindowManagerInterface) ConnectDestroyQDesignerFormWindowManagerInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerFormWindowManagerInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerFormWindowManagerInterface", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectDestroyQDesignerFormWindowManagerInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerFormWindowManagerInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerFormWindowManagerInterface")
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DestroyQDesignerFormWindowManagerInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_DestroyQDesignerFormWindowManagerInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7499,14 +7534,14 @@ func (ptr *QDesignerFormWindowManagerInterface) DestroyQDesignerFormWindowManage
 func (ptr *QDesignerFormWindowManagerInterface) DestroyQDesignerFormWindowManagerInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_DestroyQDesignerFormWindowManagerInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerFormWindowManagerInterface_Action
 func callbackQDesignerFormWindowManagerInterface_Action(ptr unsafe.Pointer, action C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "action"); signal != nil {
+	if signal := qt.GetSignal(ptr, "action"); signal != nil {
 		return widgets.PointerFromQAction(signal.(func(QDesignerFormWindowManagerInterface__Action) *widgets.QAction)(QDesignerFormWindowManagerInterface__Action(action)))
 	}
 
@@ -7516,21 +7551,21 @@ func callbackQDesignerFormWindowManagerInterface_Action(ptr unsafe.Pointer, acti
 func (ptr *QDesignerFormWindowManagerInterface) ConnectAction(f func(action QDesignerFormWindowManagerInterface__Action) *widgets.QAction) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "action", f)
+		qt.ConnectSignal(ptr.Pointer(), "action", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectAction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "action")
+		qt.DisconnectSignal(ptr.Pointer(), "action")
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) Action(action QDesignerFormWindowManagerInterface__Action) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerFormWindowManagerInterface_Action(ptr.Pointer(), C.longlong(action)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7540,7 +7575,7 @@ func (ptr *QDesignerFormWindowManagerInterface) Action(action QDesignerFormWindo
 
 //export callbackQDesignerFormWindowManagerInterface_ActionGroup
 func callbackQDesignerFormWindowManagerInterface_ActionGroup(ptr unsafe.Pointer, actionGroup C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionGroup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionGroup"); signal != nil {
 		return widgets.PointerFromQActionGroup(signal.(func(QDesignerFormWindowManagerInterface__ActionGroup) *widgets.QActionGroup)(QDesignerFormWindowManagerInterface__ActionGroup(actionGroup)))
 	}
 
@@ -7550,21 +7585,21 @@ func callbackQDesignerFormWindowManagerInterface_ActionGroup(ptr unsafe.Pointer,
 func (ptr *QDesignerFormWindowManagerInterface) ConnectActionGroup(f func(actionGroup QDesignerFormWindowManagerInterface__ActionGroup) *widgets.QActionGroup) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "actionGroup", f)
+		qt.ConnectSignal(ptr.Pointer(), "actionGroup", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectActionGroup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "actionGroup")
+		qt.DisconnectSignal(ptr.Pointer(), "actionGroup")
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) ActionGroup(actionGroup QDesignerFormWindowManagerInterface__ActionGroup) *widgets.QActionGroup {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionGroupFromPointer(C.QDesignerFormWindowManagerInterface_ActionGroup(ptr.Pointer(), C.longlong(actionGroup)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7574,7 +7609,7 @@ func (ptr *QDesignerFormWindowManagerInterface) ActionGroup(actionGroup QDesigne
 
 //export callbackQDesignerFormWindowManagerInterface_Core
 func callbackQDesignerFormWindowManagerInterface_Core(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "core"); signal != nil {
+	if signal := qt.GetSignal(ptr, "core"); signal != nil {
 		return PointerFromQDesignerFormEditorInterface(signal.(func() *QDesignerFormEditorInterface)())
 	}
 
@@ -7584,21 +7619,21 @@ func callbackQDesignerFormWindowManagerInterface_Core(ptr unsafe.Pointer) unsafe
 func (ptr *QDesignerFormWindowManagerInterface) ConnectCore(f func() *QDesignerFormEditorInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "core", f)
+		qt.ConnectSignal(ptr.Pointer(), "core", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectCore() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "core")
+		qt.DisconnectSignal(ptr.Pointer(), "core")
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) Core() *QDesignerFormEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerFormWindowManagerInterface_Core(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7608,7 +7643,7 @@ func (ptr *QDesignerFormWindowManagerInterface) Core() *QDesignerFormEditorInter
 
 //export callbackQDesignerFormWindowManagerInterface_ActiveFormWindow
 func callbackQDesignerFormWindowManagerInterface_ActiveFormWindow(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeFormWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeFormWindow"); signal != nil {
 		return PointerFromQDesignerFormWindowInterface(signal.(func() *QDesignerFormWindowInterface)())
 	}
 
@@ -7618,21 +7653,21 @@ func callbackQDesignerFormWindowManagerInterface_ActiveFormWindow(ptr unsafe.Poi
 func (ptr *QDesignerFormWindowManagerInterface) ConnectActiveFormWindow(f func() *QDesignerFormWindowInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeFormWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeFormWindow", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectActiveFormWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeFormWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "activeFormWindow")
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) ActiveFormWindow() *QDesignerFormWindowInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormWindowInterfaceFromPointer(C.QDesignerFormWindowManagerInterface_ActiveFormWindow(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7642,7 +7677,7 @@ func (ptr *QDesignerFormWindowManagerInterface) ActiveFormWindow() *QDesignerFor
 
 //export callbackQDesignerFormWindowManagerInterface_FormWindow
 func callbackQDesignerFormWindowManagerInterface_FormWindow(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formWindow"); signal != nil {
 		return PointerFromQDesignerFormWindowInterface(signal.(func(int) *QDesignerFormWindowInterface)(int(int32(index))))
 	}
 
@@ -7652,21 +7687,21 @@ func callbackQDesignerFormWindowManagerInterface_FormWindow(ptr unsafe.Pointer,
 func (ptr *QDesignerFormWindowManagerInterface) ConnectFormWindow(f func(index int) *QDesignerFormWindowInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "formWindow", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectFormWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "formWindow")
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) FormWindow(index int) *QDesignerFormWindowInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormWindowInterfaceFromPointer(C.QDesignerFormWindowManagerInterface_FormWindow(ptr.Pointer(), C.int(int32(index))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7676,7 +7711,7 @@ func (ptr *QDesignerFormWindowManagerInterface) FormWindow(index int) *QDesigner
 
 //export callbackQDesignerFormWindowManagerInterface_CreatePreviewPixmap
 func callbackQDesignerFormWindowManagerInterface_CreatePreviewPixmap(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createPreviewPixmap"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createPreviewPixmap"); signal != nil {
 		return gui.PointerFromQPixmap(signal.(func() *gui.QPixmap)())
 	}
 
@@ -7686,14 +7721,14 @@ func callbackQDesignerFormWindowManagerInterface_CreatePreviewPixmap(ptr unsafe.
 func (ptr *QDesignerFormWindowManagerInterface) ConnectCreatePreviewPixmap(f func() *gui.QPixmap) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createPreviewPixmap", f)
+		qt.ConnectSignal(ptr.Pointer(), "createPreviewPixmap", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectCreatePreviewPixmap() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createPreviewPixmap")
+		qt.DisconnectSignal(ptr.Pointer(), "createPreviewPixmap")
 	}
 }
 
@@ -7708,7 +7743,7 @@ func (ptr *QDesignerFormWindowManagerInterface) CreatePreviewPixmap() *gui.QPixm
 
 //export callbackQDesignerFormWindowManagerInterface_FormWindowCount
 func callbackQDesignerFormWindowManagerInterface_FormWindowCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formWindowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formWindowCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -7718,14 +7753,14 @@ func callbackQDesignerFormWindowManagerInterface_FormWindowCount(ptr unsafe.Poin
 func (ptr *QDesignerFormWindowManagerInterface) ConnectFormWindowCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formWindowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "formWindowCount", f)
 	}
 }
 
 func (ptr *QDesignerFormWindowManagerInterface) DisconnectFormWindowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formWindowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "formWindowCount")
 	}
 }
 
@@ -7762,7 +7797,7 @@ func (ptr *QDesignerFormWindowManagerInterface) __dynamicPropertyNames_newList()
 func (ptr *QDesignerFormWindowManagerInterface) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormWindowManagerInterface___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7783,7 +7818,7 @@ func (ptr *QDesignerFormWindowManagerInterface) __findChildren_newList2() unsafe
 func (ptr *QDesignerFormWindowManagerInterface) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormWindowManagerInterface___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7804,7 +7839,7 @@ func (ptr *QDesignerFormWindowManagerInterface) __findChildren_newList3() unsafe
 func (ptr *QDesignerFormWindowManagerInterface) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormWindowManagerInterface___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7825,7 +7860,7 @@ func (ptr *QDesignerFormWindowManagerInterface) __findChildren_newList() unsafe.
 func (ptr *QDesignerFormWindowManagerInterface) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerFormWindowManagerInterface___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7845,7 +7880,7 @@ func (ptr *QDesignerFormWindowManagerInterface) __children_newList() unsafe.Poin
 
 //export callbackQDesignerFormWindowManagerInterface_Event
 func callbackQDesignerFormWindowManagerInterface_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -7861,7 +7896,7 @@ func (ptr *QDesignerFormWindowManagerInterface) EventDefault(e core.QEvent_ITF)
 
 //export callbackQDesignerFormWindowManagerInterface_EventFilter
 func callbackQDesignerFormWindowManagerInterface_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -7877,7 +7912,7 @@ func (ptr *QDesignerFormWindowManagerInterface) EventFilterDefault(watched core.
 
 //export callbackQDesignerFormWindowManagerInterface_ChildEvent
 func callbackQDesignerFormWindowManagerInterface_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowManagerInterfaceFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -7892,7 +7927,7 @@ func (ptr *QDesignerFormWindowManagerInterface) ChildEventDefault(event core.QCh
 
 //export callbackQDesignerFormWindowManagerInterface_ConnectNotify
 func callbackQDesignerFormWindowManagerInterface_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerFormWindowManagerInterfaceFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7907,7 +7942,7 @@ func (ptr *QDesignerFormWindowManagerInterface) ConnectNotifyDefault(sign core.Q
 
 //export callbackQDesignerFormWindowManagerInterface_CustomEvent
 func callbackQDesignerFormWindowManagerInterface_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowManagerInterfaceFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -7922,7 +7957,7 @@ func (ptr *QDesignerFormWindowManagerInterface) CustomEventDefault(event core.QE
 
 //export callbackQDesignerFormWindowManagerInterface_DeleteLater
 func callbackQDesignerFormWindowManagerInterface_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerFormWindowManagerInterfaceFromPointer(ptr).DeleteLaterDefault()
@@ -7932,14 +7967,14 @@ func callbackQDesignerFormWindowManagerInterface_DeleteLater(ptr unsafe.Pointer)
 func (ptr *QDesignerFormWindowManagerInterface) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerFormWindowManagerInterface_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerFormWindowManagerInterface_Destroyed
 func callbackQDesignerFormWindowManagerInterface_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -7947,7 +7982,7 @@ func callbackQDesignerFormWindowManagerInterface_Destroyed(ptr unsafe.Pointer, o
 
 //export callbackQDesignerFormWindowManagerInterface_DisconnectNotify
 func callbackQDesignerFormWindowManagerInterface_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerFormWindowManagerInterfaceFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7962,7 +7997,7 @@ func (ptr *QDesignerFormWindowManagerInterface) DisconnectNotifyDefault(sign cor
 
 //export callbackQDesignerFormWindowManagerInterface_ObjectNameChanged
 func callbackQDesignerFormWindowManagerInterface_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -7970,7 +8005,7 @@ func callbackQDesignerFormWindowManagerInterface_ObjectNameChanged(ptr unsafe.Po
 
 //export callbackQDesignerFormWindowManagerInterface_TimerEvent
 func callbackQDesignerFormWindowManagerInterface_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQDesignerFormWindowManagerInterfaceFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -7985,7 +8020,7 @@ func (ptr *QDesignerFormWindowManagerInterface) TimerEventDefault(event core.QTi
 
 //export callbackQDesignerFormWindowManagerInterface_MetaObject
 func callbackQDesignerFormWindowManagerInterface_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -8039,7 +8074,7 @@ func NewQDesignerMemberSheetExtensionFromPointer(ptr unsafe.Pointer) *QDesignerM
 
 //export callbackQDesignerMemberSheetExtension_SetMemberGroup
 func callbackQDesignerMemberSheetExtension_SetMemberGroup(ptr unsafe.Pointer, index C.int, group C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMemberGroup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMemberGroup"); signal != nil {
 		signal.(func(int, string))(int(int32(index)), cGoUnpackString(group))
 	}
 
@@ -8048,14 +8083,14 @@ func callbackQDesignerMemberSheetExtension_SetMemberGroup(ptr unsafe.Pointer, in
 func (ptr *QDesignerMemberSheetExtension) ConnectSetMemberGroup(f func(index int, group string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setMemberGroup", f)
+		qt.ConnectSignal(ptr.Pointer(), "setMemberGroup", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectSetMemberGroup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setMemberGroup")
+		qt.DisconnectSignal(ptr.Pointer(), "setMemberGroup")
 	}
 }
 
@@ -8069,7 +8104,7 @@ func (ptr *QDesignerMemberSheetExtension) SetMemberGroup(index int, group string
 
 //export callbackQDesignerMemberSheetExtension_SetVisible
 func callbackQDesignerMemberSheetExtension_SetVisible(ptr unsafe.Pointer, index C.int, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(int, bool))(int(int32(index)), int8(visible) != 0)
 	}
 
@@ -8078,14 +8113,14 @@ func callbackQDesignerMemberSheetExtension_SetVisible(ptr unsafe.Pointer, index
 func (ptr *QDesignerMemberSheetExtension) ConnectSetVisible(f func(index int, visible bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setVisible", f)
+		qt.ConnectSignal(ptr.Pointer(), "setVisible", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectSetVisible() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setVisible")
+		qt.DisconnectSignal(ptr.Pointer(), "setVisible")
 	}
 }
 
@@ -8097,7 +8132,7 @@ func (ptr *QDesignerMemberSheetExtension) SetVisible(index int, visible bool) {
 
 //export callbackQDesignerMemberSheetExtension_DestroyQDesignerMemberSheetExtension
 func callbackQDesignerMemberSheetExtension_DestroyQDesignerMemberSheetExtension(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerMemberSheetExtension"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerMemberSheetExtension"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerMemberSheetExtensionFromPointer(ptr).DestroyQDesignerMemberSheetExtensionDefault()
@@ -8107,21 +8142,21 @@ func callbackQDesignerMemberSheetExtension_DestroyQDesignerMemberSheetExtension(
 func (ptr *QDesignerMemberSheetExtension) ConnectDestroyQDesignerMemberSheetExtension(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerMemberSheetExtension", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerMemberSheetExtension", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectDestroyQDesignerMemberSheetExtension() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerMemberSheetExtension")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerMemberSheetExtension")
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DestroyQDesignerMemberSheetExtension() {
 	if ptr.Pointer() != nil {
 		C.QDesignerMemberSheetExtension_DestroyQDesignerMemberSheetExtension(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8129,14 +8164,14 @@ func (ptr *QDesignerMemberSheetExtension) DestroyQDesignerMemberSheetExtension()
 func (ptr *QDesignerMemberSheetExtension) DestroyQDesignerMemberSheetExtensionDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerMemberSheetExtension_DestroyQDesignerMemberSheetExtensionDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerMemberSheetExtension_ParameterNames
 func callbackQDesignerMemberSheetExtension_ParameterNames(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parameterNames"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parameterNames"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQDesignerMemberSheetExtensionFromPointer(NewQDesignerMemberSheetExtensionFromPointer(nil).__parameterNames_newList())
 			for _, v := range signal.(func(int) []*core.QByteArray)(int(int32(index))) {
@@ -8158,33 +8193,33 @@ func callbackQDesignerMemberSheetExtension_ParameterNames(ptr unsafe.Pointer, in
 func (ptr *QDesignerMemberSheetExtension) ConnectParameterNames(f func(index int) []*core.QByteArray) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parameterNames", f)
+		qt.ConnectSignal(ptr.Pointer(), "parameterNames", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectParameterNames() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parameterNames")
+		qt.DisconnectSignal(ptr.Pointer(), "parameterNames")
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) ParameterNames(index int) []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtDesigner_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQDesignerMemberSheetExtensionFromPointer(l.data).__parameterNames_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QDesignerMemberSheetExtension_ParameterNames(ptr.Pointer(), C.int(int32(index))))
+		}(cGoUnpackStringListAndFree(C.QDesignerMemberSheetExtension_ParameterNames(ptr.Pointer(), C.int(int32(index)))))
 	}
 	return make([]*core.QByteArray, 0)
 }
 
 //export callbackQDesignerMemberSheetExtension_ParameterTypes
 func callbackQDesignerMemberSheetExtension_ParameterTypes(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parameterTypes"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parameterTypes"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQDesignerMemberSheetExtensionFromPointer(NewQDesignerMemberSheetExtensionFromPointer(nil).__parameterTypes_newList())
 			for _, v := range signal.(func(int) []*core.QByteArray)(int(int32(index))) {
@@ -8206,33 +8241,33 @@ func callbackQDesignerMemberSheetExtension_ParameterTypes(ptr unsafe.Pointer, in
 func (ptr *QDesignerMemberSheetExtension) ConnectParameterTypes(f func(index int) []*core.QByteArray) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parameterTypes", f)
+		qt.ConnectSignal(ptr.Pointer(), "parameterTypes", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectParameterTypes() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parameterTypes")
+		qt.DisconnectSignal(ptr.Pointer(), "parameterTypes")
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) ParameterTypes(index int) []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtDesigner_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQDesignerMemberSheetExtensionFromPointer(l.data).__parameterTypes_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QDesignerMemberSheetExtension_ParameterTypes(ptr.Pointer(), C.int(int32(index))))
+		}(cGoUnpackStringListAndFree(C.QDesignerMemberSheetExtension_ParameterTypes(ptr.Pointer(), C.int(int32(index)))))
 	}
 	return make([]*core.QByteArray, 0)
 }
 
 //export callbackQDesignerMemberSheetExtension_DeclaredInClass
 func callbackQDesignerMemberSheetExtension_DeclaredInClass(ptr unsafe.Pointer, index C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "declaredInClass"); signal != nil {
+	if signal := qt.GetSignal(ptr, "declaredInClass"); signal != nil {
 		return C.CString(signal.(func(int) string)(int(int32(index))))
 	}
 
@@ -8242,14 +8277,14 @@ func callbackQDesignerMemberSheetExtension_DeclaredInClass(ptr unsafe.Pointer, i
 func (ptr *QDesignerMemberSheetExtension) ConnectDeclaredInClass(f func(index int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "declaredInClass", f)
+		qt.ConnectSignal(ptr.Pointer(), "declaredInClass", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectDeclaredInClass() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "declaredInClass")
+		qt.DisconnectSignal(ptr.Pointer(), "declaredInClass")
 	}
 }
 
@@ -8262,7 +8297,7 @@ func (ptr *QDesignerMemberSheetExtension) DeclaredInClass(index int) string {
 
 //export callbackQDesignerMemberSheetExtension_MemberGroup
 func callbackQDesignerMemberSheetExtension_MemberGroup(ptr unsafe.Pointer, index C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "memberGroup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "memberGroup"); signal != nil {
 		return C.CString(signal.(func(int) string)(int(int32(index))))
 	}
 
@@ -8272,14 +8307,14 @@ func callbackQDesignerMemberSheetExtension_MemberGroup(ptr unsafe.Pointer, index
 func (ptr *QDesignerMemberSheetExtension) ConnectMemberGroup(f func(index int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "memberGroup", f)
+		qt.ConnectSignal(ptr.Pointer(), "memberGroup", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectMemberGroup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "memberGroup")
+		qt.DisconnectSignal(ptr.Pointer(), "memberGroup")
 	}
 }
 
@@ -8292,7 +8327,7 @@ func (ptr *QDesignerMemberSheetExtension) MemberGroup(index int) string {
 
 //export callbackQDesignerMemberSheetExtension_MemberName
 func callbackQDesignerMemberSheetExtension_MemberName(ptr unsafe.Pointer, index C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "memberName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "memberName"); signal != nil {
 		return C.CString(signal.(func(int) string)(int(int32(index))))
 	}
 
@@ -8302,14 +8337,14 @@ func callbackQDesignerMemberSheetExtension_MemberName(ptr unsafe.Pointer, index
 func (ptr *QDesignerMemberSheetExtension) ConnectMemberName(f func(index int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "memberName", f)
+		qt.ConnectSignal(ptr.Pointer(), "memberName", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectMemberName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "memberName")
+		qt.DisconnectSignal(ptr.Pointer(), "memberName")
 	}
 }
 
@@ -8322,7 +8357,7 @@ func (ptr *QDesignerMemberSheetExtension) MemberName(index int) string {
 
 //export callbackQDesignerMemberSheetExtension_Signature
 func callbackQDesignerMemberSheetExtension_Signature(ptr unsafe.Pointer, index C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "signature"); signal != nil {
+	if signal := qt.GetSignal(ptr, "signature"); signal != nil {
 		return C.CString(signal.(func(int) string)(int(int32(index))))
 	}
 
@@ -8332,14 +8367,14 @@ func callbackQDesignerMemberSheetExtension_Signature(ptr unsafe.Pointer, index C
 func (ptr *QDesignerMemberSheetExtension) ConnectSignature(f func(index int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "signature", f)
+		qt.ConnectSignal(ptr.Pointer(), "signature", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectSignature() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "signature")
+		qt.DisconnectSignal(ptr.Pointer(), "signature")
 	}
 }
 
@@ -8352,7 +8387,7 @@ func (ptr *QDesignerMemberSheetExtension) Signature(index int) string {
 
 //export callbackQDesignerMemberSheetExtension_InheritedFromWidget
 func callbackQDesignerMemberSheetExtension_InheritedFromWidget(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inheritedFromWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inheritedFromWidget"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -8362,14 +8397,14 @@ func callbackQDesignerMemberSheetExtension_InheritedFromWidget(ptr unsafe.Pointe
 func (ptr *QDesignerMemberSheetExtension) ConnectInheritedFromWidget(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "inheritedFromWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "inheritedFromWidget", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectInheritedFromWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "inheritedFromWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "inheritedFromWidget")
 	}
 }
 
@@ -8382,7 +8417,7 @@ func (ptr *QDesignerMemberSheetExtension) InheritedFromWidget(index int) bool {
 
 //export callbackQDesignerMemberSheetExtension_IsSignal
 func callbackQDesignerMemberSheetExtension_IsSignal(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isSignal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isSignal"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -8392,14 +8427,14 @@ func callbackQDesignerMemberSheetExtension_IsSignal(ptr unsafe.Pointer, index C.
 func (ptr *QDesignerMemberSheetExtension) ConnectIsSignal(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isSignal", f)
+		qt.ConnectSignal(ptr.Pointer(), "isSignal", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectIsSignal() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isSignal")
+		qt.DisconnectSignal(ptr.Pointer(), "isSignal")
 	}
 }
 
@@ -8412,7 +8447,7 @@ func (ptr *QDesignerMemberSheetExtension) IsSignal(index int) bool {
 
 //export callbackQDesignerMemberSheetExtension_IsSlot
 func callbackQDesignerMemberSheetExtension_IsSlot(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isSlot"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isSlot"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -8422,14 +8457,14 @@ func callbackQDesignerMemberSheetExtension_IsSlot(ptr unsafe.Pointer, index C.in
 func (ptr *QDesignerMemberSheetExtension) ConnectIsSlot(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isSlot", f)
+		qt.ConnectSignal(ptr.Pointer(), "isSlot", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectIsSlot() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isSlot")
+		qt.DisconnectSignal(ptr.Pointer(), "isSlot")
 	}
 }
 
@@ -8442,7 +8477,7 @@ func (ptr *QDesignerMemberSheetExtension) IsSlot(index int) bool {
 
 //export callbackQDesignerMemberSheetExtension_IsVisible
 func callbackQDesignerMemberSheetExtension_IsVisible(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isVisible"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -8452,14 +8487,14 @@ func callbackQDesignerMemberSheetExtension_IsVisible(ptr unsafe.Pointer, index C
 func (ptr *QDesignerMemberSheetExtension) ConnectIsVisible(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isVisible", f)
+		qt.ConnectSignal(ptr.Pointer(), "isVisible", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectIsVisible() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isVisible")
+		qt.DisconnectSignal(ptr.Pointer(), "isVisible")
 	}
 }
 
@@ -8472,7 +8507,7 @@ func (ptr *QDesignerMemberSheetExtension) IsVisible(index int) bool {
 
 //export callbackQDesignerMemberSheetExtension_Count
 func callbackQDesignerMemberSheetExtension_Count(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "count"); signal != nil {
+	if signal := qt.GetSignal(ptr, "count"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -8482,14 +8517,14 @@ func callbackQDesignerMemberSheetExtension_Count(ptr unsafe.Pointer) C.int {
 func (ptr *QDesignerMemberSheetExtension) ConnectCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "count", f)
+		qt.ConnectSignal(ptr.Pointer(), "count", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "count")
+		qt.DisconnectSignal(ptr.Pointer(), "count")
 	}
 }
 
@@ -8502,7 +8537,7 @@ func (ptr *QDesignerMemberSheetExtension) Count() int {
 
 //export callbackQDesignerMemberSheetExtension_IndexOf
 func callbackQDesignerMemberSheetExtension_IndexOf(ptr unsafe.Pointer, name C.struct_QtDesigner_PackedString) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexOf"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexOf"); signal != nil {
 		return C.int(int32(signal.(func(string) int)(cGoUnpackString(name))))
 	}
 
@@ -8512,14 +8547,14 @@ func callbackQDesignerMemberSheetExtension_IndexOf(ptr unsafe.Pointer, name C.st
 func (ptr *QDesignerMemberSheetExtension) ConnectIndexOf(f func(name string) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "indexOf", f)
+		qt.ConnectSignal(ptr.Pointer(), "indexOf", f)
 	}
 }
 
 func (ptr *QDesignerMemberSheetExtension) DisconnectIndexOf() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "indexOf")
+		qt.DisconnectSignal(ptr.Pointer(), "indexOf")
 	}
 }
 
@@ -8610,7 +8645,7 @@ func NewQDesignerObjectInspectorInterfaceFromPointer(ptr unsafe.Pointer) *QDesig
 }
 func NewQDesignerObjectInspectorInterface(parent widgets.QWidget_ITF, flags core.Qt__WindowType) *QDesignerObjectInspectorInterface {
 	var tmpValue = NewQDesignerObjectInspectorInterfaceFromPointer(C.QDesignerObjectInspectorInterface_NewQDesignerObjectInspectorInterface(widgets.PointerFromQWidget(parent), C.longlong(flags)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -8618,7 +8653,7 @@ func NewQDesignerObjectInspectorInterface(parent widgets.QWidget_ITF, flags core
 
 //export callbackQDesignerObjectInspectorInterface_SetFormWindow
 func callbackQDesignerObjectInspectorInterface_SetFormWindow(ptr unsafe.Pointer, formWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFormWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFormWindow"); signal != nil {
 		signal.(func(*QDesignerFormWindowInterface))(NewQDesignerFormWindowInterfaceFromPointer(formWindow))
 	}
 
@@ -8627,14 +8662,14 @@ func callbackQDesignerObjectInspectorInterface_SetFormWindow(ptr unsafe.Pointer,
 func (ptr *QDesignerObjectInspectorInterface) ConnectSetFormWindow(f func(formWindow *QDesignerFormWindowInterface)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFormWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFormWindow", f)
 	}
 }
 
 func (ptr *QDesignerObjectInspectorInterface) DisconnectSetFormWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFormWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "setFormWindow")
 	}
 }
 
@@ -8646,7 +8681,7 @@ func (ptr *QDesignerObjectInspectorInterface) SetFormWindow(formWindow QDesigner
 
 //export callbackQDesignerObjectInspectorInterface_DestroyQDesignerObjectInspectorInterface
 func callbackQDesignerObjectInspectorInterface_DestroyQDesignerObjectInspectorInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerObjectInspectorInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerObjectInspectorInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).DestroyQDesignerObjectInspectorInterfaceDefault()
@@ -8656,21 +8691,21 @@ func callbackQDesignerObjectInspectorInterface_DestroyQDesignerObjectInspectorIn
 func (ptr *QDesignerObjectInspectorInterface) ConnectDestroyQDesignerObjectInspectorInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerObjectInspectorInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerObjectInspectorInterface", f)
 	}
 }
 
 func (ptr *QDesignerObjectInspectorInterface) DisconnectDestroyQDesignerObjectInspectorInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerObjectInspectorInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerObjectInspectorInterface")
 	}
 }
 
 func (ptr *QDesignerObjectInspectorInterface) DestroyQDesignerObjectInspectorInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerObjectInspectorInterface_DestroyQDesignerObjectInspectorInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8678,14 +8713,14 @@ func (ptr *QDesignerObjectInspectorInterface) DestroyQDesignerObjectInspectorInt
 func (ptr *QDesignerObjectInspectorInterface) DestroyQDesignerObjectInspectorInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerObjectInspectorInterface_DestroyQDesignerObjectInspectorInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerObjectInspectorInterface_Core
 func callbackQDesignerObjectInspectorInterface_Core(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "core"); signal != nil {
+	if signal := qt.GetSignal(ptr, "core"); signal != nil {
 		return PointerFromQDesignerFormEditorInterface(signal.(func() *QDesignerFormEditorInterface)())
 	}
 
@@ -8695,21 +8730,21 @@ func callbackQDesignerObjectInspectorInterface_Core(ptr unsafe.Pointer) unsafe.P
 func (ptr *QDesignerObjectInspectorInterface) ConnectCore(f func() *QDesignerFormEditorInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "core", f)
+		qt.ConnectSignal(ptr.Pointer(), "core", f)
 	}
 }
 
 func (ptr *QDesignerObjectInspectorInterface) DisconnectCore() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "core")
+		qt.DisconnectSignal(ptr.Pointer(), "core")
 	}
 }
 
 func (ptr *QDesignerObjectInspectorInterface) Core() *QDesignerFormEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerObjectInspectorInterface_Core(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8720,7 +8755,7 @@ func (ptr *QDesignerObjectInspectorInterface) Core() *QDesignerFormEditorInterfa
 func (ptr *QDesignerObjectInspectorInterface) CoreDefault() *QDesignerFormEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerObjectInspectorInterface_CoreDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8731,7 +8766,7 @@ func (ptr *QDesignerObjectInspectorInterface) CoreDefault() *QDesignerFormEditor
 func (ptr *QDesignerObjectInspectorInterface) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerObjectInspectorInterface___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8752,7 +8787,7 @@ func (ptr *QDesignerObjectInspectorInterface) __addActions_actions_newList() uns
 func (ptr *QDesignerObjectInspectorInterface) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerObjectInspectorInterface___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8773,7 +8808,7 @@ func (ptr *QDesignerObjectInspectorInterface) __insertActions_actions_newList()
 func (ptr *QDesignerObjectInspectorInterface) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerObjectInspectorInterface___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8813,7 +8848,7 @@ func (ptr *QDesignerObjectInspectorInterface) __dynamicPropertyNames_newList() u
 func (ptr *QDesignerObjectInspectorInterface) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerObjectInspectorInterface___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8834,7 +8869,7 @@ func (ptr *QDesignerObjectInspectorInterface) __findChildren_newList2() unsafe.P
 func (ptr *QDesignerObjectInspectorInterface) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerObjectInspectorInterface___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8855,7 +8890,7 @@ func (ptr *QDesignerObjectInspectorInterface) __findChildren_newList3() unsafe.P
 func (ptr *QDesignerObjectInspectorInterface) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerObjectInspectorInterface___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8876,7 +8911,7 @@ func (ptr *QDesignerObjectInspectorInterface) __findChildren_newList() unsafe.Po
 func (ptr *QDesignerObjectInspectorInterface) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerObjectInspectorInterface___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8896,7 +8931,7 @@ func (ptr *QDesignerObjectInspectorInterface) __children_newList() unsafe.Pointe
 
 //export callbackQDesignerObjectInspectorInterface_Close
 func callbackQDesignerObjectInspectorInterface_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -8912,7 +8947,7 @@ func (ptr *QDesignerObjectInspectorInterface) CloseDefault() bool {
 
 //export callbackQDesignerObjectInspectorInterface_Event
 func callbackQDesignerObjectInspectorInterface_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -8928,7 +8963,7 @@ func (ptr *QDesignerObjectInspectorInterface) EventDefault(event core.QEvent_ITF
 
 //export callbackQDesignerObjectInspectorInterface_FocusNextPrevChild
 func callbackQDesignerObjectInspectorInterface_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -8944,7 +8979,7 @@ func (ptr *QDesignerObjectInspectorInterface) FocusNextPrevChildDefault(next boo
 
 //export callbackQDesignerObjectInspectorInterface_NativeEvent
 func callbackQDesignerObjectInspectorInterface_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -8960,7 +8995,7 @@ func (ptr *QDesignerObjectInspectorInterface) NativeEventDefault(eventType core.
 
 //export callbackQDesignerObjectInspectorInterface_ActionEvent
 func callbackQDesignerObjectInspectorInterface_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -8975,7 +9010,7 @@ func (ptr *QDesignerObjectInspectorInterface) ActionEventDefault(event gui.QActi
 
 //export callbackQDesignerObjectInspectorInterface_ChangeEvent
 func callbackQDesignerObjectInspectorInterface_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -8990,7 +9025,7 @@ func (ptr *QDesignerObjectInspectorInterface) ChangeEventDefault(event core.QEve
 
 //export callbackQDesignerObjectInspectorInterface_CloseEvent
 func callbackQDesignerObjectInspectorInterface_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -9005,7 +9040,7 @@ func (ptr *QDesignerObjectInspectorInterface) CloseEventDefault(event gui.QClose
 
 //export callbackQDesignerObjectInspectorInterface_ContextMenuEvent
 func callbackQDesignerObjectInspectorInterface_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -9020,7 +9055,7 @@ func (ptr *QDesignerObjectInspectorInterface) ContextMenuEventDefault(event gui.
 
 //export callbackQDesignerObjectInspectorInterface_CustomContextMenuRequested
 func callbackQDesignerObjectInspectorInterface_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -9028,7 +9063,7 @@ func callbackQDesignerObjectInspectorInterface_CustomContextMenuRequested(ptr un
 
 //export callbackQDesignerObjectInspectorInterface_DragEnterEvent
 func callbackQDesignerObjectInspectorInterface_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -9043,7 +9078,7 @@ func (ptr *QDesignerObjectInspectorInterface) DragEnterEventDefault(event gui.QD
 
 //export callbackQDesignerObjectInspectorInterface_DragLeaveEvent
 func callbackQDesignerObjectInspectorInterface_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -9058,7 +9093,7 @@ func (ptr *QDesignerObjectInspectorInterface) DragLeaveEventDefault(event gui.QD
 
 //export callbackQDesignerObjectInspectorInterface_DragMoveEvent
 func callbackQDesignerObjectInspectorInterface_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -9073,7 +9108,7 @@ func (ptr *QDesignerObjectInspectorInterface) DragMoveEventDefault(event gui.QDr
 
 //export callbackQDesignerObjectInspectorInterface_DropEvent
 func callbackQDesignerObjectInspectorInterface_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -9088,7 +9123,7 @@ func (ptr *QDesignerObjectInspectorInterface) DropEventDefault(event gui.QDropEv
 
 //export callbackQDesignerObjectInspectorInterface_EnterEvent
 func callbackQDesignerObjectInspectorInterface_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -9103,7 +9138,7 @@ func (ptr *QDesignerObjectInspectorInterface) EnterEventDefault(event core.QEven
 
 //export callbackQDesignerObjectInspectorInterface_FocusInEvent
 func callbackQDesignerObjectInspectorInterface_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -9118,7 +9153,7 @@ func (ptr *QDesignerObjectInspectorInterface) FocusInEventDefault(event gui.QFoc
 
 //export callbackQDesignerObjectInspectorInterface_FocusOutEvent
 func callbackQDesignerObjectInspectorInterface_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -9133,7 +9168,7 @@ func (ptr *QDesignerObjectInspectorInterface) FocusOutEventDefault(event gui.QFo
 
 //export callbackQDesignerObjectInspectorInterface_Hide
 func callbackQDesignerObjectInspectorInterface_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).HideDefault()
@@ -9148,7 +9183,7 @@ func (ptr *QDesignerObjectInspectorInterface) HideDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_HideEvent
 func callbackQDesignerObjectInspectorInterface_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -9163,7 +9198,7 @@ func (ptr *QDesignerObjectInspectorInterface) HideEventDefault(event gui.QHideEv
 
 //export callbackQDesignerObjectInspectorInterface_InputMethodEvent
 func callbackQDesignerObjectInspectorInterface_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -9178,7 +9213,7 @@ func (ptr *QDesignerObjectInspectorInterface) InputMethodEventDefault(event gui.
 
 //export callbackQDesignerObjectInspectorInterface_KeyPressEvent
 func callbackQDesignerObjectInspectorInterface_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -9193,7 +9228,7 @@ func (ptr *QDesignerObjectInspectorInterface) KeyPressEventDefault(event gui.QKe
 
 //export callbackQDesignerObjectInspectorInterface_KeyReleaseEvent
 func callbackQDesignerObjectInspectorInterface_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -9208,7 +9243,7 @@ func (ptr *QDesignerObjectInspectorInterface) KeyReleaseEventDefault(event gui.Q
 
 //export callbackQDesignerObjectInspectorInterface_LeaveEvent
 func callbackQDesignerObjectInspectorInterface_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -9223,7 +9258,7 @@ func (ptr *QDesignerObjectInspectorInterface) LeaveEventDefault(event core.QEven
 
 //export callbackQDesignerObjectInspectorInterface_Lower
 func callbackQDesignerObjectInspectorInterface_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).LowerDefault()
@@ -9238,7 +9273,7 @@ func (ptr *QDesignerObjectInspectorInterface) LowerDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_MouseDoubleClickEvent
 func callbackQDesignerObjectInspectorInterface_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -9253,7 +9288,7 @@ func (ptr *QDesignerObjectInspectorInterface) MouseDoubleClickEventDefault(event
 
 //export callbackQDesignerObjectInspectorInterface_MouseMoveEvent
 func callbackQDesignerObjectInspectorInterface_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -9268,7 +9303,7 @@ func (ptr *QDesignerObjectInspectorInterface) MouseMoveEventDefault(event gui.QM
 
 //export callbackQDesignerObjectInspectorInterface_MousePressEvent
 func callbackQDesignerObjectInspectorInterface_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -9283,7 +9318,7 @@ func (ptr *QDesignerObjectInspectorInterface) MousePressEventDefault(event gui.Q
 
 //export callbackQDesignerObjectInspectorInterface_MouseReleaseEvent
 func callbackQDesignerObjectInspectorInterface_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -9298,7 +9333,7 @@ func (ptr *QDesignerObjectInspectorInterface) MouseReleaseEventDefault(event gui
 
 //export callbackQDesignerObjectInspectorInterface_MoveEvent
 func callbackQDesignerObjectInspectorInterface_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -9313,7 +9348,7 @@ func (ptr *QDesignerObjectInspectorInterface) MoveEventDefault(event gui.QMoveEv
 
 //export callbackQDesignerObjectInspectorInterface_PaintEvent
 func callbackQDesignerObjectInspectorInterface_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -9328,7 +9363,7 @@ func (ptr *QDesignerObjectInspectorInterface) PaintEventDefault(event gui.QPaint
 
 //export callbackQDesignerObjectInspectorInterface_Raise
 func callbackQDesignerObjectInspectorInterface_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).RaiseDefault()
@@ -9343,7 +9378,7 @@ func (ptr *QDesignerObjectInspectorInterface) RaiseDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_Repaint
 func callbackQDesignerObjectInspectorInterface_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).RepaintDefault()
@@ -9358,7 +9393,7 @@ func (ptr *QDesignerObjectInspectorInterface) RepaintDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_ResizeEvent
 func callbackQDesignerObjectInspectorInterface_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -9373,7 +9408,7 @@ func (ptr *QDesignerObjectInspectorInterface) ResizeEventDefault(event gui.QResi
 
 //export callbackQDesignerObjectInspectorInterface_SetDisabled
 func callbackQDesignerObjectInspectorInterface_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -9388,7 +9423,7 @@ func (ptr *QDesignerObjectInspectorInterface) SetDisabledDefault(disable bool) {
 
 //export callbackQDesignerObjectInspectorInterface_SetEnabled
 func callbackQDesignerObjectInspectorInterface_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -9403,7 +9438,7 @@ func (ptr *QDesignerObjectInspectorInterface) SetEnabledDefault(vbo bool) {
 
 //export callbackQDesignerObjectInspectorInterface_SetFocus2
 func callbackQDesignerObjectInspectorInterface_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).SetFocus2Default()
@@ -9418,7 +9453,7 @@ func (ptr *QDesignerObjectInspectorInterface) SetFocus2Default() {
 
 //export callbackQDesignerObjectInspectorInterface_SetHidden
 func callbackQDesignerObjectInspectorInterface_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -9433,7 +9468,7 @@ func (ptr *QDesignerObjectInspectorInterface) SetHiddenDefault(hidden bool) {
 
 //export callbackQDesignerObjectInspectorInterface_SetStyleSheet
 func callbackQDesignerObjectInspectorInterface_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -9450,7 +9485,7 @@ func (ptr *QDesignerObjectInspectorInterface) SetStyleSheetDefault(styleSheet st
 
 //export callbackQDesignerObjectInspectorInterface_SetVisible
 func callbackQDesignerObjectInspectorInterface_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -9465,7 +9500,7 @@ func (ptr *QDesignerObjectInspectorInterface) SetVisibleDefault(visible bool) {
 
 //export callbackQDesignerObjectInspectorInterface_SetWindowModified
 func callbackQDesignerObjectInspectorInterface_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -9480,7 +9515,7 @@ func (ptr *QDesignerObjectInspectorInterface) SetWindowModifiedDefault(vbo bool)
 
 //export callbackQDesignerObjectInspectorInterface_SetWindowTitle
 func callbackQDesignerObjectInspectorInterface_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -9497,7 +9532,7 @@ func (ptr *QDesignerObjectInspectorInterface) SetWindowTitleDefault(vqs string)
 
 //export callbackQDesignerObjectInspectorInterface_Show
 func callbackQDesignerObjectInspectorInterface_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ShowDefault()
@@ -9512,7 +9547,7 @@ func (ptr *QDesignerObjectInspectorInterface) ShowDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_ShowEvent
 func callbackQDesignerObjectInspectorInterface_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -9527,7 +9562,7 @@ func (ptr *QDesignerObjectInspectorInterface) ShowEventDefault(event gui.QShowEv
 
 //export callbackQDesignerObjectInspectorInterface_ShowFullScreen
 func callbackQDesignerObjectInspectorInterface_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ShowFullScreenDefault()
@@ -9542,7 +9577,7 @@ func (ptr *QDesignerObjectInspectorInterface) ShowFullScreenDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_ShowMaximized
 func callbackQDesignerObjectInspectorInterface_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ShowMaximizedDefault()
@@ -9557,7 +9592,7 @@ func (ptr *QDesignerObjectInspectorInterface) ShowMaximizedDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_ShowMinimized
 func callbackQDesignerObjectInspectorInterface_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ShowMinimizedDefault()
@@ -9572,7 +9607,7 @@ func (ptr *QDesignerObjectInspectorInterface) ShowMinimizedDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_ShowNormal
 func callbackQDesignerObjectInspectorInterface_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ShowNormalDefault()
@@ -9587,7 +9622,7 @@ func (ptr *QDesignerObjectInspectorInterface) ShowNormalDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_TabletEvent
 func callbackQDesignerObjectInspectorInterface_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -9602,7 +9637,7 @@ func (ptr *QDesignerObjectInspectorInterface) TabletEventDefault(event gui.QTabl
 
 //export callbackQDesignerObjectInspectorInterface_Update
 func callbackQDesignerObjectInspectorInterface_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).UpdateDefault()
@@ -9617,7 +9652,7 @@ func (ptr *QDesignerObjectInspectorInterface) UpdateDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_UpdateMicroFocus
 func callbackQDesignerObjectInspectorInterface_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).UpdateMicroFocusDefault()
@@ -9632,7 +9667,7 @@ func (ptr *QDesignerObjectInspectorInterface) UpdateMicroFocusDefault() {
 
 //export callbackQDesignerObjectInspectorInterface_WheelEvent
 func callbackQDesignerObjectInspectorInterface_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -9647,7 +9682,7 @@ func (ptr *QDesignerObjectInspectorInterface) WheelEventDefault(event gui.QWheel
 
 //export callbackQDesignerObjectInspectorInterface_WindowIconChanged
 func callbackQDesignerObjectInspectorInterface_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -9655,7 +9690,7 @@ func callbackQDesignerObjectInspectorInterface_WindowIconChanged(ptr unsafe.Poin
 
 //export callbackQDesignerObjectInspectorInterface_WindowTitleChanged
 func callbackQDesignerObjectInspectorInterface_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -9663,7 +9698,7 @@ func callbackQDesignerObjectInspectorInterface_WindowTitleChanged(ptr unsafe.Poi
 
 //export callbackQDesignerObjectInspectorInterface_PaintEngine
 func callbackQDesignerObjectInspectorInterface_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -9679,7 +9714,7 @@ func (ptr *QDesignerObjectInspectorInterface) PaintEngineDefault() *gui.QPaintEn
 
 //export callbackQDesignerObjectInspectorInterface_MinimumSizeHint
 func callbackQDesignerObjectInspectorInterface_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -9697,7 +9732,7 @@ func (ptr *QDesignerObjectInspectorInterface) MinimumSizeHintDefault() *core.QSi
 
 //export callbackQDesignerObjectInspectorInterface_SizeHint
 func callbackQDesignerObjectInspectorInterface_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -9715,7 +9750,7 @@ func (ptr *QDesignerObjectInspectorInterface) SizeHintDefault() *core.QSize {
 
 //export callbackQDesignerObjectInspectorInterface_InputMethodQuery
 func callbackQDesignerObjectInspectorInterface_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -9733,7 +9768,7 @@ func (ptr *QDesignerObjectInspectorInterface) InputMethodQueryDefault(query core
 
 //export callbackQDesignerObjectInspectorInterface_HasHeightForWidth
 func callbackQDesignerObjectInspectorInterface_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -9749,7 +9784,7 @@ func (ptr *QDesignerObjectInspectorInterface) HasHeightForWidthDefault() bool {
 
 //export callbackQDesignerObjectInspectorInterface_HeightForWidth
 func callbackQDesignerObjectInspectorInterface_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -9765,7 +9800,7 @@ func (ptr *QDesignerObjectInspectorInterface) HeightForWidthDefault(w int) int {
 
 //export callbackQDesignerObjectInspectorInterface_Metric
 func callbackQDesignerObjectInspectorInterface_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -9781,7 +9816,7 @@ func (ptr *QDesignerObjectInspectorInterface) MetricDefault(m gui.QPaintDevice__
 
 //export callbackQDesignerObjectInspectorInterface_EventFilter
 func callbackQDesignerObjectInspectorInterface_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -9797,7 +9832,7 @@ func (ptr *QDesignerObjectInspectorInterface) EventFilterDefault(watched core.QO
 
 //export callbackQDesignerObjectInspectorInterface_ChildEvent
 func callbackQDesignerObjectInspectorInterface_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -9812,7 +9847,7 @@ func (ptr *QDesignerObjectInspectorInterface) ChildEventDefault(event core.QChil
 
 //export callbackQDesignerObjectInspectorInterface_ConnectNotify
 func callbackQDesignerObjectInspectorInterface_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9827,7 +9862,7 @@ func (ptr *QDesignerObjectInspectorInterface) ConnectNotifyDefault(sign core.QMe
 
 //export callbackQDesignerObjectInspectorInterface_CustomEvent
 func callbackQDesignerObjectInspectorInterface_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -9842,7 +9877,7 @@ func (ptr *QDesignerObjectInspectorInterface) CustomEventDefault(event core.QEve
 
 //export callbackQDesignerObjectInspectorInterface_DeleteLater
 func callbackQDesignerObjectInspectorInterface_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).DeleteLaterDefault()
@@ -9852,14 +9887,14 @@ func callbackQDesignerObjectInspectorInterface_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QDesignerObjectInspectorInterface) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerObjectInspectorInterface_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerObjectInspectorInterface_Destroyed
 func callbackQDesignerObjectInspectorInterface_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -9867,7 +9902,7 @@ func callbackQDesignerObjectInspectorInterface_Destroyed(ptr unsafe.Pointer, obj
 
 //export callbackQDesignerObjectInspectorInterface_DisconnectNotify
 func callbackQDesignerObjectInspectorInterface_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9882,7 +9917,7 @@ func (ptr *QDesignerObjectInspectorInterface) DisconnectNotifyDefault(sign core.
 
 //export callbackQDesignerObjectInspectorInterface_ObjectNameChanged
 func callbackQDesignerObjectInspectorInterface_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -9890,7 +9925,7 @@ func callbackQDesignerObjectInspectorInterface_ObjectNameChanged(ptr unsafe.Poin
 
 //export callbackQDesignerObjectInspectorInterface_TimerEvent
 func callbackQDesignerObjectInspectorInterface_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQDesignerObjectInspectorInterfaceFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -9905,7 +9940,7 @@ func (ptr *QDesignerObjectInspectorInterface) TimerEventDefault(event core.QTime
 
 //export callbackQDesignerObjectInspectorInterface_MetaObject
 func callbackQDesignerObjectInspectorInterface_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -9959,7 +9994,7 @@ func NewQDesignerPropertyEditorInterfaceFromPointer(ptr unsafe.Pointer) *QDesign
 }
 func NewQDesignerPropertyEditorInterface(parent widgets.QWidget_ITF, flags core.Qt__WindowType) *QDesignerPropertyEditorInterface {
 	var tmpValue = NewQDesignerPropertyEditorInterfaceFromPointer(C.QDesignerPropertyEditorInterface_NewQDesignerPropertyEditorInterface(widgets.PointerFromQWidget(parent), C.longlong(flags)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -9967,7 +10002,7 @@ func NewQDesignerPropertyEditorInterface(parent widgets.QWidget_ITF, flags core.
 
 //export callbackQDesignerPropertyEditorInterface_PropertyChanged
 func callbackQDesignerPropertyEditorInterface_PropertyChanged(ptr unsafe.Pointer, name C.struct_QtDesigner_PackedString, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "propertyChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "propertyChanged"); signal != nil {
 		signal.(func(string, *core.QVariant))(cGoUnpackString(name), core.NewQVariantFromPointer(value))
 	}
 
@@ -9976,14 +10011,14 @@ func callbackQDesignerPropertyEditorInterface_PropertyChanged(ptr unsafe.Pointer
 func (ptr *QDesignerPropertyEditorInterface) ConnectPropertyChanged(f func(name string, value *core.QVariant)) {
 	if ptr.Pointer() != nil {
 		C.QDesignerPropertyEditorInterface_ConnectPropertyChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "propertyChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "propertyChanged", f)
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DisconnectPropertyChanged() {
 	if ptr.Pointer() != nil {
 		C.QDesignerPropertyEditorInterface_DisconnectPropertyChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "propertyChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "propertyChanged")
 	}
 }
 
@@ -9997,7 +10032,7 @@ func (ptr *QDesignerPropertyEditorInterface) PropertyChanged(name string, value
 
 //export callbackQDesignerPropertyEditorInterface_SetObject
 func callbackQDesignerPropertyEditorInterface_SetObject(ptr unsafe.Pointer, object unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setObject"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(object))
 	}
 
@@ -10006,14 +10041,14 @@ func callbackQDesignerPropertyEditorInterface_SetObject(ptr unsafe.Pointer, obje
 func (ptr *QDesignerPropertyEditorInterface) ConnectSetObject(f func(object *core.QObject)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "setObject", f)
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DisconnectSetObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setObject")
+		qt.DisconnectSignal(ptr.Pointer(), "setObject")
 	}
 }
 
@@ -10025,7 +10060,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetObject(object core.QObject_ITF)
 
 //export callbackQDesignerPropertyEditorInterface_SetPropertyValue
 func callbackQDesignerPropertyEditorInterface_SetPropertyValue(ptr unsafe.Pointer, name C.struct_QtDesigner_PackedString, value unsafe.Pointer, changed C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPropertyValue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPropertyValue"); signal != nil {
 		signal.(func(string, *core.QVariant, bool))(cGoUnpackString(name), core.NewQVariantFromPointer(value), int8(changed) != 0)
 	}
 
@@ -10034,14 +10069,14 @@ func callbackQDesignerPropertyEditorInterface_SetPropertyValue(ptr unsafe.Pointe
 func (ptr *QDesignerPropertyEditorInterface) ConnectSetPropertyValue(f func(name string, value *core.QVariant, changed bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPropertyValue", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPropertyValue", f)
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DisconnectSetPropertyValue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPropertyValue")
+		qt.DisconnectSignal(ptr.Pointer(), "setPropertyValue")
 	}
 }
 
@@ -10055,7 +10090,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetPropertyValue(name string, value
 
 //export callbackQDesignerPropertyEditorInterface_SetReadOnly
 func callbackQDesignerPropertyEditorInterface_SetReadOnly(ptr unsafe.Pointer, readOnly C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setReadOnly"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setReadOnly"); signal != nil {
 		signal.(func(bool))(int8(readOnly) != 0)
 	}
 
@@ -10064,14 +10099,14 @@ func callbackQDesignerPropertyEditorInterface_SetReadOnly(ptr unsafe.Pointer, re
 func (ptr *QDesignerPropertyEditorInterface) ConnectSetReadOnly(f func(readOnly bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setReadOnly", f)
+		qt.ConnectSignal(ptr.Pointer(), "setReadOnly", f)
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DisconnectSetReadOnly() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setReadOnly")
+		qt.DisconnectSignal(ptr.Pointer(), "setReadOnly")
 	}
 }
 
@@ -10083,7 +10118,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetReadOnly(readOnly bool) {
 
 //export callbackQDesignerPropertyEditorInterface_DestroyQDesignerPropertyEditorInterface
 func callbackQDesignerPropertyEditorInterface_DestroyQDesignerPropertyEditorInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerPropertyEditorInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerPropertyEditorInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).DestroyQDesignerPropertyEditorInterfaceDefault()
@@ -10093,21 +10128,21 @@ func callbackQDesignerPropertyEditorInterface_DestroyQDesignerPropertyEditorInte
 func (ptr *QDesignerPropertyEditorInterface) ConnectDestroyQDesignerPropertyEditorInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerPropertyEditorInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerPropertyEditorInterface", f)
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DisconnectDestroyQDesignerPropertyEditorInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerPropertyEditorInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerPropertyEditorInterface")
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DestroyQDesignerPropertyEditorInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerPropertyEditorInterface_DestroyQDesignerPropertyEditorInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10115,14 +10150,14 @@ func (ptr *QDesignerPropertyEditorInterface) DestroyQDesignerPropertyEditorInter
 func (ptr *QDesignerPropertyEditorInterface) DestroyQDesignerPropertyEditorInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerPropertyEditorInterface_DestroyQDesignerPropertyEditorInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerPropertyEditorInterface_Core
 func callbackQDesignerPropertyEditorInterface_Core(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "core"); signal != nil {
+	if signal := qt.GetSignal(ptr, "core"); signal != nil {
 		return PointerFromQDesignerFormEditorInterface(signal.(func() *QDesignerFormEditorInterface)())
 	}
 
@@ -10132,21 +10167,21 @@ func callbackQDesignerPropertyEditorInterface_Core(ptr unsafe.Pointer) unsafe.Po
 func (ptr *QDesignerPropertyEditorInterface) ConnectCore(f func() *QDesignerFormEditorInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "core", f)
+		qt.ConnectSignal(ptr.Pointer(), "core", f)
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DisconnectCore() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "core")
+		qt.DisconnectSignal(ptr.Pointer(), "core")
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) Core() *QDesignerFormEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerPropertyEditorInterface_Core(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10157,7 +10192,7 @@ func (ptr *QDesignerPropertyEditorInterface) Core() *QDesignerFormEditorInterfac
 func (ptr *QDesignerPropertyEditorInterface) CoreDefault() *QDesignerFormEditorInterface {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDesignerFormEditorInterfaceFromPointer(C.QDesignerPropertyEditorInterface_CoreDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10167,7 +10202,7 @@ func (ptr *QDesignerPropertyEditorInterface) CoreDefault() *QDesignerFormEditorI
 
 //export callbackQDesignerPropertyEditorInterface_Object
 func callbackQDesignerPropertyEditorInterface_Object(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "object"); signal != nil {
+	if signal := qt.GetSignal(ptr, "object"); signal != nil {
 		return core.PointerFromQObject(signal.(func() *core.QObject)())
 	}
 
@@ -10177,21 +10212,21 @@ func callbackQDesignerPropertyEditorInterface_Object(ptr unsafe.Pointer) unsafe.
 func (ptr *QDesignerPropertyEditorInterface) ConnectObject(f func() *core.QObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "object", f)
+		qt.ConnectSignal(ptr.Pointer(), "object", f)
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DisconnectObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "object")
+		qt.DisconnectSignal(ptr.Pointer(), "object")
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) Object() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerPropertyEditorInterface_Object(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10201,7 +10236,7 @@ func (ptr *QDesignerPropertyEditorInterface) Object() *core.QObject {
 
 //export callbackQDesignerPropertyEditorInterface_CurrentPropertyName
 func callbackQDesignerPropertyEditorInterface_CurrentPropertyName(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentPropertyName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentPropertyName"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -10211,14 +10246,14 @@ func callbackQDesignerPropertyEditorInterface_CurrentPropertyName(ptr unsafe.Poi
 func (ptr *QDesignerPropertyEditorInterface) ConnectCurrentPropertyName(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentPropertyName", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentPropertyName", f)
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DisconnectCurrentPropertyName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentPropertyName")
+		qt.DisconnectSignal(ptr.Pointer(), "currentPropertyName")
 	}
 }
 
@@ -10231,7 +10266,7 @@ func (ptr *QDesignerPropertyEditorInterface) CurrentPropertyName() string {
 
 //export callbackQDesignerPropertyEditorInterface_IsReadOnly
 func callbackQDesignerPropertyEditorInterface_IsReadOnly(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isReadOnly"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isReadOnly"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -10241,14 +10276,14 @@ func callbackQDesignerPropertyEditorInterface_IsReadOnly(ptr unsafe.Pointer) C.c
 func (ptr *QDesignerPropertyEditorInterface) ConnectIsReadOnly(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isReadOnly", f)
+		qt.ConnectSignal(ptr.Pointer(), "isReadOnly", f)
 	}
 }
 
 func (ptr *QDesignerPropertyEditorInterface) DisconnectIsReadOnly() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isReadOnly")
+		qt.DisconnectSignal(ptr.Pointer(), "isReadOnly")
 	}
 }
 
@@ -10262,7 +10297,7 @@ func (ptr *QDesignerPropertyEditorInterface) IsReadOnly() bool {
 func (ptr *QDesignerPropertyEditorInterface) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerPropertyEditorInterface___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10283,7 +10318,7 @@ func (ptr *QDesignerPropertyEditorInterface) __addActions_actions_newList() unsa
 func (ptr *QDesignerPropertyEditorInterface) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerPropertyEditorInterface___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10304,7 +10339,7 @@ func (ptr *QDesignerPropertyEditorInterface) __insertActions_actions_newList() u
 func (ptr *QDesignerPropertyEditorInterface) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerPropertyEditorInterface___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10344,7 +10379,7 @@ func (ptr *QDesignerPropertyEditorInterface) __dynamicPropertyNames_newList() un
 func (ptr *QDesignerPropertyEditorInterface) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerPropertyEditorInterface___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10365,7 +10400,7 @@ func (ptr *QDesignerPropertyEditorInterface) __findChildren_newList2() unsafe.Po
 func (ptr *QDesignerPropertyEditorInterface) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerPropertyEditorInterface___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10386,7 +10421,7 @@ func (ptr *QDesignerPropertyEditorInterface) __findChildren_newList3() unsafe.Po
 func (ptr *QDesignerPropertyEditorInterface) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerPropertyEditorInterface___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10407,7 +10442,7 @@ func (ptr *QDesignerPropertyEditorInterface) __findChildren_newList() unsafe.Poi
 func (ptr *QDesignerPropertyEditorInterface) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerPropertyEditorInterface___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10427,7 +10462,7 @@ func (ptr *QDesignerPropertyEditorInterface) __children_newList() unsafe.Pointer
 
 //export callbackQDesignerPropertyEditorInterface_Close
 func callbackQDesignerPropertyEditorInterface_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -10443,7 +10478,7 @@ func (ptr *QDesignerPropertyEditorInterface) CloseDefault() bool {
 
 //export callbackQDesignerPropertyEditorInterface_Event
 func callbackQDesignerPropertyEditorInterface_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -10459,7 +10494,7 @@ func (ptr *QDesignerPropertyEditorInterface) EventDefault(event core.QEvent_ITF)
 
 //export callbackQDesignerPropertyEditorInterface_FocusNextPrevChild
 func callbackQDesignerPropertyEditorInterface_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -10475,7 +10510,7 @@ func (ptr *QDesignerPropertyEditorInterface) FocusNextPrevChildDefault(next bool
 
 //export callbackQDesignerPropertyEditorInterface_NativeEvent
 func callbackQDesignerPropertyEditorInterface_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -10491,7 +10526,7 @@ func (ptr *QDesignerPropertyEditorInterface) NativeEventDefault(eventType core.Q
 
 //export callbackQDesignerPropertyEditorInterface_ActionEvent
 func callbackQDesignerPropertyEditorInterface_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -10506,7 +10541,7 @@ func (ptr *QDesignerPropertyEditorInterface) ActionEventDefault(event gui.QActio
 
 //export callbackQDesignerPropertyEditorInterface_ChangeEvent
 func callbackQDesignerPropertyEditorInterface_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -10521,7 +10556,7 @@ func (ptr *QDesignerPropertyEditorInterface) ChangeEventDefault(event core.QEven
 
 //export callbackQDesignerPropertyEditorInterface_CloseEvent
 func callbackQDesignerPropertyEditorInterface_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -10536,7 +10571,7 @@ func (ptr *QDesignerPropertyEditorInterface) CloseEventDefault(event gui.QCloseE
 
 //export callbackQDesignerPropertyEditorInterface_ContextMenuEvent
 func callbackQDesignerPropertyEditorInterface_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -10551,7 +10586,7 @@ func (ptr *QDesignerPropertyEditorInterface) ContextMenuEventDefault(event gui.Q
 
 //export callbackQDesignerPropertyEditorInterface_CustomContextMenuRequested
 func callbackQDesignerPropertyEditorInterface_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -10559,7 +10594,7 @@ func callbackQDesignerPropertyEditorInterface_CustomContextMenuRequested(ptr uns
 
 //export callbackQDesignerPropertyEditorInterface_DragEnterEvent
 func callbackQDesignerPropertyEditorInterface_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -10574,7 +10609,7 @@ func (ptr *QDesignerPropertyEditorInterface) DragEnterEventDefault(event gui.QDr
 
 //export callbackQDesignerPropertyEditorInterface_DragLeaveEvent
 func callbackQDesignerPropertyEditorInterface_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -10589,7 +10624,7 @@ func (ptr *QDesignerPropertyEditorInterface) DragLeaveEventDefault(event gui.QDr
 
 //export callbackQDesignerPropertyEditorInterface_DragMoveEvent
 func callbackQDesignerPropertyEditorInterface_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -10604,7 +10639,7 @@ func (ptr *QDesignerPropertyEditorInterface) DragMoveEventDefault(event gui.QDra
 
 //export callbackQDesignerPropertyEditorInterface_DropEvent
 func callbackQDesignerPropertyEditorInterface_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -10619,7 +10654,7 @@ func (ptr *QDesignerPropertyEditorInterface) DropEventDefault(event gui.QDropEve
 
 //export callbackQDesignerPropertyEditorInterface_EnterEvent
 func callbackQDesignerPropertyEditorInterface_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -10634,7 +10669,7 @@ func (ptr *QDesignerPropertyEditorInterface) EnterEventDefault(event core.QEvent
 
 //export callbackQDesignerPropertyEditorInterface_FocusInEvent
 func callbackQDesignerPropertyEditorInterface_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -10649,7 +10684,7 @@ func (ptr *QDesignerPropertyEditorInterface) FocusInEventDefault(event gui.QFocu
 
 //export callbackQDesignerPropertyEditorInterface_FocusOutEvent
 func callbackQDesignerPropertyEditorInterface_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -10664,7 +10699,7 @@ func (ptr *QDesignerPropertyEditorInterface) FocusOutEventDefault(event gui.QFoc
 
 //export callbackQDesignerPropertyEditorInterface_Hide
 func callbackQDesignerPropertyEditorInterface_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).HideDefault()
@@ -10679,7 +10714,7 @@ func (ptr *QDesignerPropertyEditorInterface) HideDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_HideEvent
 func callbackQDesignerPropertyEditorInterface_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -10694,7 +10729,7 @@ func (ptr *QDesignerPropertyEditorInterface) HideEventDefault(event gui.QHideEve
 
 //export callbackQDesignerPropertyEditorInterface_InputMethodEvent
 func callbackQDesignerPropertyEditorInterface_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -10709,7 +10744,7 @@ func (ptr *QDesignerPropertyEditorInterface) InputMethodEventDefault(event gui.Q
 
 //export callbackQDesignerPropertyEditorInterface_KeyPressEvent
 func callbackQDesignerPropertyEditorInterface_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -10724,7 +10759,7 @@ func (ptr *QDesignerPropertyEditorInterface) KeyPressEventDefault(event gui.QKey
 
 //export callbackQDesignerPropertyEditorInterface_KeyReleaseEvent
 func callbackQDesignerPropertyEditorInterface_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -10739,7 +10774,7 @@ func (ptr *QDesignerPropertyEditorInterface) KeyReleaseEventDefault(event gui.QK
 
 //export callbackQDesignerPropertyEditorInterface_LeaveEvent
 func callbackQDesignerPropertyEditorInterface_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -10754,7 +10789,7 @@ func (ptr *QDesignerPropertyEditorInterface) LeaveEventDefault(event core.QEvent
 
 //export callbackQDesignerPropertyEditorInterface_Lower
 func callbackQDesignerPropertyEditorInterface_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).LowerDefault()
@@ -10769,7 +10804,7 @@ func (ptr *QDesignerPropertyEditorInterface) LowerDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_MouseDoubleClickEvent
 func callbackQDesignerPropertyEditorInterface_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -10784,7 +10819,7 @@ func (ptr *QDesignerPropertyEditorInterface) MouseDoubleClickEventDefault(event
 
 //export callbackQDesignerPropertyEditorInterface_MouseMoveEvent
 func callbackQDesignerPropertyEditorInterface_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -10799,7 +10834,7 @@ func (ptr *QDesignerPropertyEditorInterface) MouseMoveEventDefault(event gui.QMo
 
 //export callbackQDesignerPropertyEditorInterface_MousePressEvent
 func callbackQDesignerPropertyEditorInterface_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -10814,7 +10849,7 @@ func (ptr *QDesignerPropertyEditorInterface) MousePressEventDefault(event gui.QM
 
 //export callbackQDesignerPropertyEditorInterface_MouseReleaseEvent
 func callbackQDesignerPropertyEditorInterface_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -10829,7 +10864,7 @@ func (ptr *QDesignerPropertyEditorInterface) MouseReleaseEventDefault(event gui.
 
 //export callbackQDesignerPropertyEditorInterface_MoveEvent
 func callbackQDesignerPropertyEditorInterface_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -10844,7 +10879,7 @@ func (ptr *QDesignerPropertyEditorInterface) MoveEventDefault(event gui.QMoveEve
 
 //export callbackQDesignerPropertyEditorInterface_PaintEvent
 func callbackQDesignerPropertyEditorInterface_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -10859,7 +10894,7 @@ func (ptr *QDesignerPropertyEditorInterface) PaintEventDefault(event gui.QPaintE
 
 //export callbackQDesignerPropertyEditorInterface_Raise
 func callbackQDesignerPropertyEditorInterface_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).RaiseDefault()
@@ -10874,7 +10909,7 @@ func (ptr *QDesignerPropertyEditorInterface) RaiseDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_Repaint
 func callbackQDesignerPropertyEditorInterface_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).RepaintDefault()
@@ -10889,7 +10924,7 @@ func (ptr *QDesignerPropertyEditorInterface) RepaintDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_ResizeEvent
 func callbackQDesignerPropertyEditorInterface_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -10904,7 +10939,7 @@ func (ptr *QDesignerPropertyEditorInterface) ResizeEventDefault(event gui.QResiz
 
 //export callbackQDesignerPropertyEditorInterface_SetDisabled
 func callbackQDesignerPropertyEditorInterface_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -10919,7 +10954,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetDisabledDefault(disable bool) {
 
 //export callbackQDesignerPropertyEditorInterface_SetEnabled
 func callbackQDesignerPropertyEditorInterface_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -10934,7 +10969,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetEnabledDefault(vbo bool) {
 
 //export callbackQDesignerPropertyEditorInterface_SetFocus2
 func callbackQDesignerPropertyEditorInterface_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).SetFocus2Default()
@@ -10949,7 +10984,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetFocus2Default() {
 
 //export callbackQDesignerPropertyEditorInterface_SetHidden
 func callbackQDesignerPropertyEditorInterface_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -10964,7 +10999,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetHiddenDefault(hidden bool) {
 
 //export callbackQDesignerPropertyEditorInterface_SetStyleSheet
 func callbackQDesignerPropertyEditorInterface_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -10981,7 +11016,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetStyleSheetDefault(styleSheet str
 
 //export callbackQDesignerPropertyEditorInterface_SetVisible
 func callbackQDesignerPropertyEditorInterface_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -10996,7 +11031,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetVisibleDefault(visible bool) {
 
 //export callbackQDesignerPropertyEditorInterface_SetWindowModified
 func callbackQDesignerPropertyEditorInterface_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -11011,7 +11046,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetWindowModifiedDefault(vbo bool)
 
 //export callbackQDesignerPropertyEditorInterface_SetWindowTitle
 func callbackQDesignerPropertyEditorInterface_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -11028,7 +11063,7 @@ func (ptr *QDesignerPropertyEditorInterface) SetWindowTitleDefault(vqs string) {
 
 //export callbackQDesignerPropertyEditorInterface_Show
 func callbackQDesignerPropertyEditorInterface_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ShowDefault()
@@ -11043,7 +11078,7 @@ func (ptr *QDesignerPropertyEditorInterface) ShowDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_ShowEvent
 func callbackQDesignerPropertyEditorInterface_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -11058,7 +11093,7 @@ func (ptr *QDesignerPropertyEditorInterface) ShowEventDefault(event gui.QShowEve
 
 //export callbackQDesignerPropertyEditorInterface_ShowFullScreen
 func callbackQDesignerPropertyEditorInterface_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ShowFullScreenDefault()
@@ -11073,7 +11108,7 @@ func (ptr *QDesignerPropertyEditorInterface) ShowFullScreenDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_ShowMaximized
 func callbackQDesignerPropertyEditorInterface_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ShowMaximizedDefault()
@@ -11088,7 +11123,7 @@ func (ptr *QDesignerPropertyEditorInterface) ShowMaximizedDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_ShowMinimized
 func callbackQDesignerPropertyEditorInterface_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ShowMinimizedDefault()
@@ -11103,7 +11138,7 @@ func (ptr *QDesignerPropertyEditorInterface) ShowMinimizedDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_ShowNormal
 func callbackQDesignerPropertyEditorInterface_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ShowNormalDefault()
@@ -11118,7 +11153,7 @@ func (ptr *QDesignerPropertyEditorInterface) ShowNormalDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_TabletEvent
 func callbackQDesignerPropertyEditorInterface_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -11133,7 +11168,7 @@ func (ptr *QDesignerPropertyEditorInterface) TabletEventDefault(event gui.QTable
 
 //export callbackQDesignerPropertyEditorInterface_Update
 func callbackQDesignerPropertyEditorInterface_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).UpdateDefault()
@@ -11148,7 +11183,7 @@ func (ptr *QDesignerPropertyEditorInterface) UpdateDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_UpdateMicroFocus
 func callbackQDesignerPropertyEditorInterface_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).UpdateMicroFocusDefault()
@@ -11163,7 +11198,7 @@ func (ptr *QDesignerPropertyEditorInterface) UpdateMicroFocusDefault() {
 
 //export callbackQDesignerPropertyEditorInterface_WheelEvent
 func callbackQDesignerPropertyEditorInterface_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -11178,7 +11213,7 @@ func (ptr *QDesignerPropertyEditorInterface) WheelEventDefault(event gui.QWheelE
 
 //export callbackQDesignerPropertyEditorInterface_WindowIconChanged
 func callbackQDesignerPropertyEditorInterface_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -11186,7 +11221,7 @@ func callbackQDesignerPropertyEditorInterface_WindowIconChanged(ptr unsafe.Point
 
 //export callbackQDesignerPropertyEditorInterface_WindowTitleChanged
 func callbackQDesignerPropertyEditorInterface_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -11194,7 +11229,7 @@ func callbackQDesignerPropertyEditorInterface_WindowTitleChanged(ptr unsafe.Poin
 
 //export callbackQDesignerPropertyEditorInterface_PaintEngine
 func callbackQDesignerPropertyEditorInterface_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -11210,7 +11245,7 @@ func (ptr *QDesignerPropertyEditorInterface) PaintEngineDefault() *gui.QPaintEng
 
 //export callbackQDesignerPropertyEditorInterface_MinimumSizeHint
 func callbackQDesignerPropertyEditorInterface_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -11228,7 +11263,7 @@ func (ptr *QDesignerPropertyEditorInterface) MinimumSizeHintDefault() *core.QSiz
 
 //export callbackQDesignerPropertyEditorInterface_SizeHint
 func callbackQDesignerPropertyEditorInterface_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -11246,7 +11281,7 @@ func (ptr *QDesignerPropertyEditorInterface) SizeHintDefault() *core.QSize {
 
 //export callbackQDesignerPropertyEditorInterface_InputMethodQuery
 func callbackQDesignerPropertyEditorInterface_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -11264,7 +11299,7 @@ func (ptr *QDesignerPropertyEditorInterface) InputMethodQueryDefault(query core.
 
 //export callbackQDesignerPropertyEditorInterface_HasHeightForWidth
 func callbackQDesignerPropertyEditorInterface_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -11280,7 +11315,7 @@ func (ptr *QDesignerPropertyEditorInterface) HasHeightForWidthDefault() bool {
 
 //export callbackQDesignerPropertyEditorInterface_HeightForWidth
 func callbackQDesignerPropertyEditorInterface_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -11296,7 +11331,7 @@ func (ptr *QDesignerPropertyEditorInterface) HeightForWidthDefault(w int) int {
 
 //export callbackQDesignerPropertyEditorInterface_Metric
 func callbackQDesignerPropertyEditorInterface_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -11312,7 +11347,7 @@ func (ptr *QDesignerPropertyEditorInterface) MetricDefault(m gui.QPaintDevice__P
 
 //export callbackQDesignerPropertyEditorInterface_EventFilter
 func callbackQDesignerPropertyEditorInterface_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -11328,7 +11363,7 @@ func (ptr *QDesignerPropertyEditorInterface) EventFilterDefault(watched core.QOb
 
 //export callbackQDesignerPropertyEditorInterface_ChildEvent
 func callbackQDesignerPropertyEditorInterface_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -11343,7 +11378,7 @@ func (ptr *QDesignerPropertyEditorInterface) ChildEventDefault(event core.QChild
 
 //export callbackQDesignerPropertyEditorInterface_ConnectNotify
 func callbackQDesignerPropertyEditorInterface_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -11358,7 +11393,7 @@ func (ptr *QDesignerPropertyEditorInterface) ConnectNotifyDefault(sign core.QMet
 
 //export callbackQDesignerPropertyEditorInterface_CustomEvent
 func callbackQDesignerPropertyEditorInterface_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -11373,7 +11408,7 @@ func (ptr *QDesignerPropertyEditorInterface) CustomEventDefault(event core.QEven
 
 //export callbackQDesignerPropertyEditorInterface_DeleteLater
 func callbackQDesignerPropertyEditorInterface_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).DeleteLaterDefault()
@@ -11383,14 +11418,14 @@ func callbackQDesignerPropertyEditorInterface_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QDesignerPropertyEditorInterface) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerPropertyEditorInterface_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerPropertyEditorInterface_Destroyed
 func callbackQDesignerPropertyEditorInterface_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -11398,7 +11433,7 @@ func callbackQDesignerPropertyEditorInterface_Destroyed(ptr unsafe.Pointer, obj
 
 //export callbackQDesignerPropertyEditorInterface_DisconnectNotify
 func callbackQDesignerPropertyEditorInterface_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -11413,7 +11448,7 @@ func (ptr *QDesignerPropertyEditorInterface) DisconnectNotifyDefault(sign core.Q
 
 //export callbackQDesignerPropertyEditorInterface_ObjectNameChanged
 func callbackQDesignerPropertyEditorInterface_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -11421,7 +11456,7 @@ func callbackQDesignerPropertyEditorInterface_ObjectNameChanged(ptr unsafe.Point
 
 //export callbackQDesignerPropertyEditorInterface_TimerEvent
 func callbackQDesignerPropertyEditorInterface_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQDesignerPropertyEditorInterfaceFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -11436,7 +11471,7 @@ func (ptr *QDesignerPropertyEditorInterface) TimerEventDefault(event core.QTimer
 
 //export callbackQDesignerPropertyEditorInterface_MetaObject
 func callbackQDesignerPropertyEditorInterface_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -11490,7 +11525,7 @@ func NewQDesignerPropertySheetExtensionFromPointer(ptr unsafe.Pointer) *QDesigne
 
 //export callbackQDesignerPropertySheetExtension_Reset
 func callbackQDesignerPropertySheetExtension_Reset(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -11500,14 +11535,14 @@ func callbackQDesignerPropertySheetExtension_Reset(ptr unsafe.Pointer, index C.i
 func (ptr *QDesignerPropertySheetExtension) ConnectReset(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reset", f)
+		qt.ConnectSignal(ptr.Pointer(), "reset", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectReset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reset")
+		qt.DisconnectSignal(ptr.Pointer(), "reset")
 	}
 }
 
@@ -11520,7 +11555,7 @@ func (ptr *QDesignerPropertySheetExtension) Reset(index int) bool {
 
 //export callbackQDesignerPropertySheetExtension_SetAttribute
 func callbackQDesignerPropertySheetExtension_SetAttribute(ptr unsafe.Pointer, index C.int, attribute C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setAttribute"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setAttribute"); signal != nil {
 		signal.(func(int, bool))(int(int32(index)), int8(attribute) != 0)
 	}
 
@@ -11529,14 +11564,14 @@ func callbackQDesignerPropertySheetExtension_SetAttribute(ptr unsafe.Pointer, in
 func (ptr *QDesignerPropertySheetExtension) ConnectSetAttribute(f func(index int, attribute bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setAttribute", f)
+		qt.ConnectSignal(ptr.Pointer(), "setAttribute", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectSetAttribute() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setAttribute")
+		qt.DisconnectSignal(ptr.Pointer(), "setAttribute")
 	}
 }
 
@@ -11548,7 +11583,7 @@ func (ptr *QDesignerPropertySheetExtension) SetAttribute(index int, attribute bo
 
 //export callbackQDesignerPropertySheetExtension_SetChanged
 func callbackQDesignerPropertySheetExtension_SetChanged(ptr unsafe.Pointer, index C.int, changed C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setChanged"); signal != nil {
 		signal.(func(int, bool))(int(int32(index)), int8(changed) != 0)
 	}
 
@@ -11557,14 +11592,14 @@ func callbackQDesignerPropertySheetExtension_SetChanged(ptr unsafe.Pointer, inde
 func (ptr *QDesignerPropertySheetExtension) ConnectSetChanged(f func(index int, changed bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "setChanged", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectSetChanged() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "setChanged")
 	}
 }
 
@@ -11576,7 +11611,7 @@ func (ptr *QDesignerPropertySheetExtension) SetChanged(index int, changed bool)
 
 //export callbackQDesignerPropertySheetExtension_SetProperty
 func callbackQDesignerPropertySheetExtension_SetProperty(ptr unsafe.Pointer, index C.int, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setProperty"); signal != nil {
 		signal.(func(int, *core.QVariant))(int(int32(index)), core.NewQVariantFromPointer(value))
 	}
 
@@ -11585,14 +11620,14 @@ func callbackQDesignerPropertySheetExtension_SetProperty(ptr unsafe.Pointer, ind
 func (ptr *QDesignerPropertySheetExtension) ConnectSetProperty(f func(index int, value *core.QVariant)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setProperty", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectSetProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setProperty")
 	}
 }
 
@@ -11604,7 +11639,7 @@ func (ptr *QDesignerPropertySheetExtension) SetProperty(index int, value core.QV
 
 //export callbackQDesignerPropertySheetExtension_SetPropertyGroup
 func callbackQDesignerPropertySheetExtension_SetPropertyGroup(ptr unsafe.Pointer, index C.int, group C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPropertyGroup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPropertyGroup"); signal != nil {
 		signal.(func(int, string))(int(int32(index)), cGoUnpackString(group))
 	}
 
@@ -11613,14 +11648,14 @@ func callbackQDesignerPropertySheetExtension_SetPropertyGroup(ptr unsafe.Pointer
 func (ptr *QDesignerPropertySheetExtension) ConnectSetPropertyGroup(f func(index int, group string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPropertyGroup", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPropertyGroup", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectSetPropertyGroup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPropertyGroup")
+		qt.DisconnectSignal(ptr.Pointer(), "setPropertyGroup")
 	}
 }
 
@@ -11634,7 +11669,7 @@ func (ptr *QDesignerPropertySheetExtension) SetPropertyGroup(index int, group st
 
 //export callbackQDesignerPropertySheetExtension_SetVisible
 func callbackQDesignerPropertySheetExtension_SetVisible(ptr unsafe.Pointer, index C.int, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(int, bool))(int(int32(index)), int8(visible) != 0)
 	}
 
@@ -11643,14 +11678,14 @@ func callbackQDesignerPropertySheetExtension_SetVisible(ptr unsafe.Pointer, inde
 func (ptr *QDesignerPropertySheetExtension) ConnectSetVisible(f func(index int, visible bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setVisible", f)
+		qt.ConnectSignal(ptr.Pointer(), "setVisible", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectSetVisible() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setVisible")
+		qt.DisconnectSignal(ptr.Pointer(), "setVisible")
 	}
 }
 
@@ -11662,7 +11697,7 @@ func (ptr *QDesignerPropertySheetExtension) SetVisible(index int, visible bool)
 
 //export callbackQDesignerPropertySheetExtension_DestroyQDesignerPropertySheetExtension
 func callbackQDesignerPropertySheetExtension_DestroyQDesignerPropertySheetExtension(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerPropertySheetExtension"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerPropertySheetExtension"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerPropertySheetExtensionFromPointer(ptr).DestroyQDesignerPropertySheetExtensionDefault()
@@ -11672,21 +11707,21 @@ func callbackQDesignerPropertySheetExtension_DestroyQDesignerPropertySheetExtens
 func (ptr *QDesignerPropertySheetExtension) ConnectDestroyQDesignerPropertySheetExtension(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerPropertySheetExtension", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerPropertySheetExtension", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectDestroyQDesignerPropertySheetExtension() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerPropertySheetExtension")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerPropertySheetExtension")
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DestroyQDesignerPropertySheetExtension() {
 	if ptr.Pointer() != nil {
 		C.QDesignerPropertySheetExtension_DestroyQDesignerPropertySheetExtension(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11694,14 +11729,14 @@ func (ptr *QDesignerPropertySheetExtension) DestroyQDesignerPropertySheetExtensi
 func (ptr *QDesignerPropertySheetExtension) DestroyQDesignerPropertySheetExtensionDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerPropertySheetExtension_DestroyQDesignerPropertySheetExtensionDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerPropertySheetExtension_PropertyGroup
 func callbackQDesignerPropertySheetExtension_PropertyGroup(ptr unsafe.Pointer, index C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "propertyGroup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "propertyGroup"); signal != nil {
 		return C.CString(signal.(func(int) string)(int(int32(index))))
 	}
 
@@ -11711,14 +11746,14 @@ func callbackQDesignerPropertySheetExtension_PropertyGroup(ptr unsafe.Pointer, i
 func (ptr *QDesignerPropertySheetExtension) ConnectPropertyGroup(f func(index int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "propertyGroup", f)
+		qt.ConnectSignal(ptr.Pointer(), "propertyGroup", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectPropertyGroup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "propertyGroup")
+		qt.DisconnectSignal(ptr.Pointer(), "propertyGroup")
 	}
 }
 
@@ -11731,7 +11766,7 @@ func (ptr *QDesignerPropertySheetExtension) PropertyGroup(index int) string {
 
 //export callbackQDesignerPropertySheetExtension_PropertyName
 func callbackQDesignerPropertySheetExtension_PropertyName(ptr unsafe.Pointer, index C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "propertyName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "propertyName"); signal != nil {
 		return C.CString(signal.(func(int) string)(int(int32(index))))
 	}
 
@@ -11741,14 +11776,14 @@ func callbackQDesignerPropertySheetExtension_PropertyName(ptr unsafe.Pointer, in
 func (ptr *QDesignerPropertySheetExtension) ConnectPropertyName(f func(index int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "propertyName", f)
+		qt.ConnectSignal(ptr.Pointer(), "propertyName", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectPropertyName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "propertyName")
+		qt.DisconnectSignal(ptr.Pointer(), "propertyName")
 	}
 }
 
@@ -11761,7 +11796,7 @@ func (ptr *QDesignerPropertySheetExtension) PropertyName(index int) string {
 
 //export callbackQDesignerPropertySheetExtension_Property
 func callbackQDesignerPropertySheetExtension_Property(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "property"); signal != nil {
+	if signal := qt.GetSignal(ptr, "property"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(int) *core.QVariant)(int(int32(index))))
 	}
 
@@ -11771,14 +11806,14 @@ func callbackQDesignerPropertySheetExtension_Property(ptr unsafe.Pointer, index
 func (ptr *QDesignerPropertySheetExtension) ConnectProperty(f func(index int) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "property", f)
+		qt.ConnectSignal(ptr.Pointer(), "property", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "property")
+		qt.DisconnectSignal(ptr.Pointer(), "property")
 	}
 }
 
@@ -11793,7 +11828,7 @@ func (ptr *QDesignerPropertySheetExtension) Property(index int) *core.QVariant {
 
 //export callbackQDesignerPropertySheetExtension_HasReset
 func callbackQDesignerPropertySheetExtension_HasReset(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasReset"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -11803,14 +11838,14 @@ func callbackQDesignerPropertySheetExtension_HasReset(ptr unsafe.Pointer, index
 func (ptr *QDesignerPropertySheetExtension) ConnectHasReset(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasReset", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasReset", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectHasReset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasReset")
+		qt.DisconnectSignal(ptr.Pointer(), "hasReset")
 	}
 }
 
@@ -11823,7 +11858,7 @@ func (ptr *QDesignerPropertySheetExtension) HasReset(index int) bool {
 
 //export callbackQDesignerPropertySheetExtension_IsAttribute
 func callbackQDesignerPropertySheetExtension_IsAttribute(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isAttribute"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isAttribute"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -11833,14 +11868,14 @@ func callbackQDesignerPropertySheetExtension_IsAttribute(ptr unsafe.Pointer, ind
 func (ptr *QDesignerPropertySheetExtension) ConnectIsAttribute(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isAttribute", f)
+		qt.ConnectSignal(ptr.Pointer(), "isAttribute", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectIsAttribute() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isAttribute")
+		qt.DisconnectSignal(ptr.Pointer(), "isAttribute")
 	}
 }
 
@@ -11853,7 +11888,7 @@ func (ptr *QDesignerPropertySheetExtension) IsAttribute(index int) bool {
 
 //export callbackQDesignerPropertySheetExtension_IsChanged
 func callbackQDesignerPropertySheetExtension_IsChanged(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isChanged"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -11863,14 +11898,14 @@ func callbackQDesignerPropertySheetExtension_IsChanged(ptr unsafe.Pointer, index
 func (ptr *QDesignerPropertySheetExtension) ConnectIsChanged(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "isChanged", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectIsChanged() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "isChanged")
 	}
 }
 
@@ -11883,7 +11918,7 @@ func (ptr *QDesignerPropertySheetExtension) IsChanged(index int) bool {
 
 //export callbackQDesignerPropertySheetExtension_IsEnabled
 func callbackQDesignerPropertySheetExtension_IsEnabled(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isEnabled"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -11893,14 +11928,14 @@ func callbackQDesignerPropertySheetExtension_IsEnabled(ptr unsafe.Pointer, index
 func (ptr *QDesignerPropertySheetExtension) ConnectIsEnabled(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isEnabled", f)
+		qt.ConnectSignal(ptr.Pointer(), "isEnabled", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectIsEnabled() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isEnabled")
+		qt.DisconnectSignal(ptr.Pointer(), "isEnabled")
 	}
 }
 
@@ -11920,7 +11955,7 @@ func (ptr *QDesignerPropertySheetExtension) IsEnabledDefault(index int) bool {
 
 //export callbackQDesignerPropertySheetExtension_IsVisible
 func callbackQDesignerPropertySheetExtension_IsVisible(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isVisible"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -11930,14 +11965,14 @@ func callbackQDesignerPropertySheetExtension_IsVisible(ptr unsafe.Pointer, index
 func (ptr *QDesignerPropertySheetExtension) ConnectIsVisible(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isVisible", f)
+		qt.ConnectSignal(ptr.Pointer(), "isVisible", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectIsVisible() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isVisible")
+		qt.DisconnectSignal(ptr.Pointer(), "isVisible")
 	}
 }
 
@@ -11950,7 +11985,7 @@ func (ptr *QDesignerPropertySheetExtension) IsVisible(index int) bool {
 
 //export callbackQDesignerPropertySheetExtension_Count
 func callbackQDesignerPropertySheetExtension_Count(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "count"); signal != nil {
+	if signal := qt.GetSignal(ptr, "count"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -11960,14 +11995,14 @@ func callbackQDesignerPropertySheetExtension_Count(ptr unsafe.Pointer) C.int {
 func (ptr *QDesignerPropertySheetExtension) ConnectCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "count", f)
+		qt.ConnectSignal(ptr.Pointer(), "count", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "count")
+		qt.DisconnectSignal(ptr.Pointer(), "count")
 	}
 }
 
@@ -11980,7 +12015,7 @@ func (ptr *QDesignerPropertySheetExtension) Count() int {
 
 //export callbackQDesignerPropertySheetExtension_IndexOf
 func callbackQDesignerPropertySheetExtension_IndexOf(ptr unsafe.Pointer, name C.struct_QtDesigner_PackedString) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexOf"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexOf"); signal != nil {
 		return C.int(int32(signal.(func(string) int)(cGoUnpackString(name))))
 	}
 
@@ -11990,14 +12025,14 @@ func callbackQDesignerPropertySheetExtension_IndexOf(ptr unsafe.Pointer, name C.
 func (ptr *QDesignerPropertySheetExtension) ConnectIndexOf(f func(name string) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "indexOf", f)
+		qt.ConnectSignal(ptr.Pointer(), "indexOf", f)
 	}
 }
 
 func (ptr *QDesignerPropertySheetExtension) DisconnectIndexOf() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "indexOf")
+		qt.DisconnectSignal(ptr.Pointer(), "indexOf")
 	}
 }
 
@@ -12050,7 +12085,7 @@ func NewQDesignerTaskMenuExtensionFromPointer(ptr unsafe.Pointer) *QDesignerTask
 
 //export callbackQDesignerTaskMenuExtension_DestroyQDesignerTaskMenuExtension
 func callbackQDesignerTaskMenuExtension_DestroyQDesignerTaskMenuExtension(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerTaskMenuExtension"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerTaskMenuExtension"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerTaskMenuExtensionFromPointer(ptr).DestroyQDesignerTaskMenuExtensionDefault()
@@ -12060,21 +12095,21 @@ func callbackQDesignerTaskMenuExtension_DestroyQDesignerTaskMenuExtension(ptr un
 func (ptr *QDesignerTaskMenuExtension) ConnectDestroyQDesignerTaskMenuExtension(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerTaskMenuExtension", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerTaskMenuExtension", f)
 	}
 }
 
 func (ptr *QDesignerTaskMenuExtension) DisconnectDestroyQDesignerTaskMenuExtension() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerTaskMenuExtension")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerTaskMenuExtension")
 	}
 }
 
 func (ptr *QDesignerTaskMenuExtension) DestroyQDesignerTaskMenuExtension() {
 	if ptr.Pointer() != nil {
 		C.QDesignerTaskMenuExtension_DestroyQDesignerTaskMenuExtension(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12082,14 +12117,14 @@ func (ptr *QDesignerTaskMenuExtension) DestroyQDesignerTaskMenuExtension() {
 func (ptr *QDesignerTaskMenuExtension) DestroyQDesignerTaskMenuExtensionDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerTaskMenuExtension_DestroyQDesignerTaskMenuExtensionDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerTaskMenuExtension_PreferredEditAction
 func callbackQDesignerTaskMenuExtension_PreferredEditAction(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "preferredEditAction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "preferredEditAction"); signal != nil {
 		return widgets.PointerFromQAction(signal.(func() *widgets.QAction)())
 	}
 
@@ -12099,21 +12134,21 @@ func callbackQDesignerTaskMenuExtension_PreferredEditAction(ptr unsafe.Pointer)
 func (ptr *QDesignerTaskMenuExtension) ConnectPreferredEditAction(f func() *widgets.QAction) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "preferredEditAction", f)
+		qt.ConnectSignal(ptr.Pointer(), "preferredEditAction", f)
 	}
 }
 
 func (ptr *QDesignerTaskMenuExtension) DisconnectPreferredEditAction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "preferredEditAction")
+		qt.DisconnectSignal(ptr.Pointer(), "preferredEditAction")
 	}
 }
 
 func (ptr *QDesignerTaskMenuExtension) PreferredEditAction() *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerTaskMenuExtension_PreferredEditAction(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12124,7 +12159,7 @@ func (ptr *QDesignerTaskMenuExtension) PreferredEditAction() *widgets.QAction {
 func (ptr *QDesignerTaskMenuExtension) PreferredEditActionDefault() *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerTaskMenuExtension_PreferredEditActionDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12134,7 +12169,7 @@ func (ptr *QDesignerTaskMenuExtension) PreferredEditActionDefault() *widgets.QAc
 
 //export callbackQDesignerTaskMenuExtension_TaskActions
 func callbackQDesignerTaskMenuExtension_TaskActions(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "taskActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "taskActions"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQDesignerTaskMenuExtensionFromPointer(NewQDesignerTaskMenuExtensionFromPointer(nil).__taskActions_newList())
 			for _, v := range signal.(func() []*widgets.QAction)() {
@@ -12156,14 +12191,14 @@ func callbackQDesignerTaskMenuExtension_TaskActions(ptr unsafe.Pointer) unsafe.P
 func (ptr *QDesignerTaskMenuExtension) ConnectTaskActions(f func() []*widgets.QAction) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "taskActions", f)
+		qt.ConnectSignal(ptr.Pointer(), "taskActions", f)
 	}
 }
 
 func (ptr *QDesignerTaskMenuExtension) DisconnectTaskActions() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "taskActions")
+		qt.DisconnectSignal(ptr.Pointer(), "taskActions")
 	}
 }
 
@@ -12183,7 +12218,7 @@ func (ptr *QDesignerTaskMenuExtension) TaskActions() []*widgets.QAction {
 func (ptr *QDesignerTaskMenuExtension) __taskActions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerTaskMenuExtension___taskActions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12242,7 +12277,7 @@ func NewQDesignerWidgetBoxInterfaceFromPointer(ptr unsafe.Pointer) *QDesignerWid
 
 //export callbackQDesignerWidgetBoxInterface_Load
 func callbackQDesignerWidgetBoxInterface_Load(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "load"); signal != nil {
+	if signal := qt.GetSignal(ptr, "load"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -12252,14 +12287,14 @@ func callbackQDesignerWidgetBoxInterface_Load(ptr unsafe.Pointer) C.char {
 func (ptr *QDesignerWidgetBoxInterface) ConnectLoad(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "load", f)
+		qt.ConnectSignal(ptr.Pointer(), "load", f)
 	}
 }
 
 func (ptr *QDesignerWidgetBoxInterface) DisconnectLoad() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "load")
+		qt.DisconnectSignal(ptr.Pointer(), "load")
 	}
 }
 
@@ -12272,7 +12307,7 @@ func (ptr *QDesignerWidgetBoxInterface) Load() bool {
 
 //export callbackQDesignerWidgetBoxInterface_Save
 func callbackQDesignerWidgetBoxInterface_Save(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "save"); signal != nil {
+	if signal := qt.GetSignal(ptr, "save"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -12282,14 +12317,14 @@ func callbackQDesignerWidgetBoxInterface_Save(ptr unsafe.Pointer) C.char {
 func (ptr *QDesignerWidgetBoxInterface) ConnectSave(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "save", f)
+		qt.ConnectSignal(ptr.Pointer(), "save", f)
 	}
 }
 
 func (ptr *QDesignerWidgetBoxInterface) DisconnectSave() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "save")
+		qt.DisconnectSignal(ptr.Pointer(), "save")
 	}
 }
 
@@ -12302,7 +12337,7 @@ func (ptr *QDesignerWidgetBoxInterface) Save() bool {
 
 //export callbackQDesignerWidgetBoxInterface_SetFileName
 func callbackQDesignerWidgetBoxInterface_SetFileName(ptr unsafe.Pointer, fileName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFileName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFileName"); signal != nil {
 		signal.(func(string))(cGoUnpackString(fileName))
 	}
 
@@ -12311,14 +12346,14 @@ func callbackQDesignerWidgetBoxInterface_SetFileName(ptr unsafe.Pointer, fileNam
 func (ptr *QDesignerWidgetBoxInterface) ConnectSetFileName(f func(fileName string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFileName", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFileName", f)
 	}
 }
 
 func (ptr *QDesignerWidgetBoxInterface) DisconnectSetFileName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFileName")
+		qt.DisconnectSignal(ptr.Pointer(), "setFileName")
 	}
 }
 
@@ -12332,7 +12367,7 @@ func (ptr *QDesignerWidgetBoxInterface) SetFileName(fileName string) {
 
 //export callbackQDesignerWidgetBoxInterface_DestroyQDesignerWidgetBoxInterface
 func callbackQDesignerWidgetBoxInterface_DestroyQDesignerWidgetBoxInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QDesignerWidgetBoxInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QDesignerWidgetBoxInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).DestroyQDesignerWidgetBoxInterfaceDefault()
@@ -12342,21 +12377,21 @@ func callbackQDesignerWidgetBoxInterface_DestroyQDesignerWidgetBoxInterface(ptr
 func (ptr *QDesignerWidgetBoxInterface) ConnectDestroyQDesignerWidgetBoxInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerWidgetBoxInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QDesignerWidgetBoxInterface", f)
 	}
 }
 
 func (ptr *QDesignerWidgetBoxInterface) DisconnectDestroyQDesignerWidgetBoxInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QDesignerWidgetBoxInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QDesignerWidgetBoxInterface")
 	}
 }
 
 func (ptr *QDesignerWidgetBoxInterface) DestroyQDesignerWidgetBoxInterface() {
 	if ptr.Pointer() != nil {
 		C.QDesignerWidgetBoxInterface_DestroyQDesignerWidgetBoxInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12364,14 +12399,14 @@ func (ptr *QDesignerWidgetBoxInterface) DestroyQDesignerWidgetBoxInterface() {
 func (ptr *QDesignerWidgetBoxInterface) DestroyQDesignerWidgetBoxInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerWidgetBoxInterface_DestroyQDesignerWidgetBoxInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerWidgetBoxInterface_FileName
 func callbackQDesignerWidgetBoxInterface_FileName(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fileName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fileName"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -12381,14 +12416,14 @@ func callbackQDesignerWidgetBoxInterface_FileName(ptr unsafe.Pointer) *C.char {
 func (ptr *QDesignerWidgetBoxInterface) ConnectFileName(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fileName", f)
+		qt.ConnectSignal(ptr.Pointer(), "fileName", f)
 	}
 }
 
 func (ptr *QDesignerWidgetBoxInterface) DisconnectFileName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fileName")
+		qt.DisconnectSignal(ptr.Pointer(), "fileName")
 	}
 }
 
@@ -12406,7 +12441,7 @@ func (ptr *QDesignerWidgetBoxInterface) __dropWidgets_item_list_newList() unsafe
 func (ptr *QDesignerWidgetBoxInterface) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerWidgetBoxInterface___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12427,7 +12462,7 @@ func (ptr *QDesignerWidgetBoxInterface) __addActions_actions_newList() unsafe.Po
 func (ptr *QDesignerWidgetBoxInterface) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerWidgetBoxInterface___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12448,7 +12483,7 @@ func (ptr *QDesignerWidgetBoxInterface) __insertActions_actions_newList() unsafe
 func (ptr *QDesignerWidgetBoxInterface) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QDesignerWidgetBoxInterface___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12488,7 +12523,7 @@ func (ptr *QDesignerWidgetBoxInterface) __dynamicPropertyNames_newList() unsafe.
 func (ptr *QDesignerWidgetBoxInterface) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerWidgetBoxInterface___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12509,7 +12544,7 @@ func (ptr *QDesignerWidgetBoxInterface) __findChildren_newList2() unsafe.Pointer
 func (ptr *QDesignerWidgetBoxInterface) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerWidgetBoxInterface___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12530,7 +12565,7 @@ func (ptr *QDesignerWidgetBoxInterface) __findChildren_newList3() unsafe.Pointer
 func (ptr *QDesignerWidgetBoxInterface) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerWidgetBoxInterface___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12551,7 +12586,7 @@ func (ptr *QDesignerWidgetBoxInterface) __findChildren_newList() unsafe.Pointer
 func (ptr *QDesignerWidgetBoxInterface) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDesignerWidgetBoxInterface___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12571,7 +12606,7 @@ func (ptr *QDesignerWidgetBoxInterface) __children_newList() unsafe.Pointer {
 
 //export callbackQDesignerWidgetBoxInterface_Close
 func callbackQDesignerWidgetBoxInterface_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -12587,7 +12622,7 @@ func (ptr *QDesignerWidgetBoxInterface) CloseDefault() bool {
 
 //export callbackQDesignerWidgetBoxInterface_Event
 func callbackQDesignerWidgetBoxInterface_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -12603,7 +12638,7 @@ func (ptr *QDesignerWidgetBoxInterface) EventDefault(event core.QEvent_ITF) bool
 
 //export callbackQDesignerWidgetBoxInterface_FocusNextPrevChild
 func callbackQDesignerWidgetBoxInterface_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -12619,7 +12654,7 @@ func (ptr *QDesignerWidgetBoxInterface) FocusNextPrevChildDefault(next bool) boo
 
 //export callbackQDesignerWidgetBoxInterface_NativeEvent
 func callbackQDesignerWidgetBoxInterface_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -12635,7 +12670,7 @@ func (ptr *QDesignerWidgetBoxInterface) NativeEventDefault(eventType core.QByteA
 
 //export callbackQDesignerWidgetBoxInterface_ActionEvent
 func callbackQDesignerWidgetBoxInterface_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -12650,7 +12685,7 @@ func (ptr *QDesignerWidgetBoxInterface) ActionEventDefault(event gui.QActionEven
 
 //export callbackQDesignerWidgetBoxInterface_ChangeEvent
 func callbackQDesignerWidgetBoxInterface_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -12665,7 +12700,7 @@ func (ptr *QDesignerWidgetBoxInterface) ChangeEventDefault(event core.QEvent_ITF
 
 //export callbackQDesignerWidgetBoxInterface_CloseEvent
 func callbackQDesignerWidgetBoxInterface_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -12680,7 +12715,7 @@ func (ptr *QDesignerWidgetBoxInterface) CloseEventDefault(event gui.QCloseEvent_
 
 //export callbackQDesignerWidgetBoxInterface_ContextMenuEvent
 func callbackQDesignerWidgetBoxInterface_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -12695,7 +12730,7 @@ func (ptr *QDesignerWidgetBoxInterface) ContextMenuEventDefault(event gui.QConte
 
 //export callbackQDesignerWidgetBoxInterface_CustomContextMenuRequested
 func callbackQDesignerWidgetBoxInterface_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -12703,7 +12738,7 @@ func callbackQDesignerWidgetBoxInterface_CustomContextMenuRequested(ptr unsafe.P
 
 //export callbackQDesignerWidgetBoxInterface_DragEnterEvent
 func callbackQDesignerWidgetBoxInterface_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -12718,7 +12753,7 @@ func (ptr *QDesignerWidgetBoxInterface) DragEnterEventDefault(event gui.QDragEnt
 
 //export callbackQDesignerWidgetBoxInterface_DragLeaveEvent
 func callbackQDesignerWidgetBoxInterface_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -12733,7 +12768,7 @@ func (ptr *QDesignerWidgetBoxInterface) DragLeaveEventDefault(event gui.QDragLea
 
 //export callbackQDesignerWidgetBoxInterface_DragMoveEvent
 func callbackQDesignerWidgetBoxInterface_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -12748,7 +12783,7 @@ func (ptr *QDesignerWidgetBoxInterface) DragMoveEventDefault(event gui.QDragMove
 
 //export callbackQDesignerWidgetBoxInterface_DropEvent
 func callbackQDesignerWidgetBoxInterface_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -12763,7 +12798,7 @@ func (ptr *QDesignerWidgetBoxInterface) DropEventDefault(event gui.QDropEvent_IT
 
 //export callbackQDesignerWidgetBoxInterface_EnterEvent
 func callbackQDesignerWidgetBoxInterface_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -12778,7 +12813,7 @@ func (ptr *QDesignerWidgetBoxInterface) EnterEventDefault(event core.QEvent_ITF)
 
 //export callbackQDesignerWidgetBoxInterface_FocusInEvent
 func callbackQDesignerWidgetBoxInterface_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -12793,7 +12828,7 @@ func (ptr *QDesignerWidgetBoxInterface) FocusInEventDefault(event gui.QFocusEven
 
 //export callbackQDesignerWidgetBoxInterface_FocusOutEvent
 func callbackQDesignerWidgetBoxInterface_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -12808,7 +12843,7 @@ func (ptr *QDesignerWidgetBoxInterface) FocusOutEventDefault(event gui.QFocusEve
 
 //export callbackQDesignerWidgetBoxInterface_Hide
 func callbackQDesignerWidgetBoxInterface_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).HideDefault()
@@ -12823,7 +12858,7 @@ func (ptr *QDesignerWidgetBoxInterface) HideDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_HideEvent
 func callbackQDesignerWidgetBoxInterface_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -12838,7 +12873,7 @@ func (ptr *QDesignerWidgetBoxInterface) HideEventDefault(event gui.QHideEvent_IT
 
 //export callbackQDesignerWidgetBoxInterface_InputMethodEvent
 func callbackQDesignerWidgetBoxInterface_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -12853,7 +12888,7 @@ func (ptr *QDesignerWidgetBoxInterface) InputMethodEventDefault(event gui.QInput
 
 //export callbackQDesignerWidgetBoxInterface_KeyPressEvent
 func callbackQDesignerWidgetBoxInterface_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -12868,7 +12903,7 @@ func (ptr *QDesignerWidgetBoxInterface) KeyPressEventDefault(event gui.QKeyEvent
 
 //export callbackQDesignerWidgetBoxInterface_KeyReleaseEvent
 func callbackQDesignerWidgetBoxInterface_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -12883,7 +12918,7 @@ func (ptr *QDesignerWidgetBoxInterface) KeyReleaseEventDefault(event gui.QKeyEve
 
 //export callbackQDesignerWidgetBoxInterface_LeaveEvent
 func callbackQDesignerWidgetBoxInterface_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -12898,7 +12933,7 @@ func (ptr *QDesignerWidgetBoxInterface) LeaveEventDefault(event core.QEvent_ITF)
 
 //export callbackQDesignerWidgetBoxInterface_Lower
 func callbackQDesignerWidgetBoxInterface_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).LowerDefault()
@@ -12913,7 +12948,7 @@ func (ptr *QDesignerWidgetBoxInterface) LowerDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_MouseDoubleClickEvent
 func callbackQDesignerWidgetBoxInterface_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -12928,7 +12963,7 @@ func (ptr *QDesignerWidgetBoxInterface) MouseDoubleClickEventDefault(event gui.Q
 
 //export callbackQDesignerWidgetBoxInterface_MouseMoveEvent
 func callbackQDesignerWidgetBoxInterface_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -12943,7 +12978,7 @@ func (ptr *QDesignerWidgetBoxInterface) MouseMoveEventDefault(event gui.QMouseEv
 
 //export callbackQDesignerWidgetBoxInterface_MousePressEvent
 func callbackQDesignerWidgetBoxInterface_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -12958,7 +12993,7 @@ func (ptr *QDesignerWidgetBoxInterface) MousePressEventDefault(event gui.QMouseE
 
 //export callbackQDesignerWidgetBoxInterface_MouseReleaseEvent
 func callbackQDesignerWidgetBoxInterface_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -12973,7 +13008,7 @@ func (ptr *QDesignerWidgetBoxInterface) MouseReleaseEventDefault(event gui.QMous
 
 //export callbackQDesignerWidgetBoxInterface_MoveEvent
 func callbackQDesignerWidgetBoxInterface_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -12988,7 +13023,7 @@ func (ptr *QDesignerWidgetBoxInterface) MoveEventDefault(event gui.QMoveEvent_IT
 
 //export callbackQDesignerWidgetBoxInterface_PaintEvent
 func callbackQDesignerWidgetBoxInterface_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -13003,7 +13038,7 @@ func (ptr *QDesignerWidgetBoxInterface) PaintEventDefault(event gui.QPaintEvent_
 
 //export callbackQDesignerWidgetBoxInterface_Raise
 func callbackQDesignerWidgetBoxInterface_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).RaiseDefault()
@@ -13018,7 +13053,7 @@ func (ptr *QDesignerWidgetBoxInterface) RaiseDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_Repaint
 func callbackQDesignerWidgetBoxInterface_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).RepaintDefault()
@@ -13033,7 +13068,7 @@ func (ptr *QDesignerWidgetBoxInterface) RepaintDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_ResizeEvent
 func callbackQDesignerWidgetBoxInterface_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -13048,7 +13083,7 @@ func (ptr *QDesignerWidgetBoxInterface) ResizeEventDefault(event gui.QResizeEven
 
 //export callbackQDesignerWidgetBoxInterface_SetDisabled
 func callbackQDesignerWidgetBoxInterface_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -13063,7 +13098,7 @@ func (ptr *QDesignerWidgetBoxInterface) SetDisabledDefault(disable bool) {
 
 //export callbackQDesignerWidgetBoxInterface_SetEnabled
 func callbackQDesignerWidgetBoxInterface_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -13078,7 +13113,7 @@ func (ptr *QDesignerWidgetBoxInterface) SetEnabledDefault(vbo bool) {
 
 //export callbackQDesignerWidgetBoxInterface_SetFocus2
 func callbackQDesignerWidgetBoxInterface_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).SetFocus2Default()
@@ -13093,7 +13128,7 @@ func (ptr *QDesignerWidgetBoxInterface) SetFocus2Default() {
 
 //export callbackQDesignerWidgetBoxInterface_SetHidden
 func callbackQDesignerWidgetBoxInterface_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -13108,7 +13143,7 @@ func (ptr *QDesignerWidgetBoxInterface) SetHiddenDefault(hidden bool) {
 
 //export callbackQDesignerWidgetBoxInterface_SetStyleSheet
 func callbackQDesignerWidgetBoxInterface_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -13125,7 +13160,7 @@ func (ptr *QDesignerWidgetBoxInterface) SetStyleSheetDefault(styleSheet string)
 
 //export callbackQDesignerWidgetBoxInterface_SetVisible
 func callbackQDesignerWidgetBoxInterface_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -13140,7 +13175,7 @@ func (ptr *QDesignerWidgetBoxInterface) SetVisibleDefault(visible bool) {
 
 //export callbackQDesignerWidgetBoxInterface_SetWindowModified
 func callbackQDesignerWidgetBoxInterface_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -13155,7 +13190,7 @@ func (ptr *QDesignerWidgetBoxInterface) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQDesignerWidgetBoxInterface_SetWindowTitle
 func callbackQDesignerWidgetBoxInterface_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -13172,7 +13207,7 @@ func (ptr *QDesignerWidgetBoxInterface) SetWindowTitleDefault(vqs string) {
 
 //export callbackQDesignerWidgetBoxInterface_Show
 func callbackQDesignerWidgetBoxInterface_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ShowDefault()
@@ -13187,7 +13222,7 @@ func (ptr *QDesignerWidgetBoxInterface) ShowDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_ShowEvent
 func callbackQDesignerWidgetBoxInterface_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -13202,7 +13237,7 @@ func (ptr *QDesignerWidgetBoxInterface) ShowEventDefault(event gui.QShowEvent_IT
 
 //export callbackQDesignerWidgetBoxInterface_ShowFullScreen
 func callbackQDesignerWidgetBoxInterface_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ShowFullScreenDefault()
@@ -13217,7 +13252,7 @@ func (ptr *QDesignerWidgetBoxInterface) ShowFullScreenDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_ShowMaximized
 func callbackQDesignerWidgetBoxInterface_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ShowMaximizedDefault()
@@ -13232,7 +13267,7 @@ func (ptr *QDesignerWidgetBoxInterface) ShowMaximizedDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_ShowMinimized
 func callbackQDesignerWidgetBoxInterface_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ShowMinimizedDefault()
@@ -13247,7 +13282,7 @@ func (ptr *QDesignerWidgetBoxInterface) ShowMinimizedDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_ShowNormal
 func callbackQDesignerWidgetBoxInterface_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ShowNormalDefault()
@@ -13262,7 +13297,7 @@ func (ptr *QDesignerWidgetBoxInterface) ShowNormalDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_TabletEvent
 func callbackQDesignerWidgetBoxInterface_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -13277,7 +13312,7 @@ func (ptr *QDesignerWidgetBoxInterface) TabletEventDefault(event gui.QTabletEven
 
 //export callbackQDesignerWidgetBoxInterface_Update
 func callbackQDesignerWidgetBoxInterface_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).UpdateDefault()
@@ -13292,7 +13327,7 @@ func (ptr *QDesignerWidgetBoxInterface) UpdateDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_UpdateMicroFocus
 func callbackQDesignerWidgetBoxInterface_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).UpdateMicroFocusDefault()
@@ -13307,7 +13342,7 @@ func (ptr *QDesignerWidgetBoxInterface) UpdateMicroFocusDefault() {
 
 //export callbackQDesignerWidgetBoxInterface_WheelEvent
 func callbackQDesignerWidgetBoxInterface_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -13322,7 +13357,7 @@ func (ptr *QDesignerWidgetBoxInterface) WheelEventDefault(event gui.QWheelEvent_
 
 //export callbackQDesignerWidgetBoxInterface_WindowIconChanged
 func callbackQDesignerWidgetBoxInterface_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -13330,7 +13365,7 @@ func callbackQDesignerWidgetBoxInterface_WindowIconChanged(ptr unsafe.Pointer, i
 
 //export callbackQDesignerWidgetBoxInterface_WindowTitleChanged
 func callbackQDesignerWidgetBoxInterface_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -13338,7 +13373,7 @@ func callbackQDesignerWidgetBoxInterface_WindowTitleChanged(ptr unsafe.Pointer,
 
 //export callbackQDesignerWidgetBoxInterface_PaintEngine
 func callbackQDesignerWidgetBoxInterface_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -13354,7 +13389,7 @@ func (ptr *QDesignerWidgetBoxInterface) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQDesignerWidgetBoxInterface_MinimumSizeHint
 func callbackQDesignerWidgetBoxInterface_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -13372,7 +13407,7 @@ func (ptr *QDesignerWidgetBoxInterface) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQDesignerWidgetBoxInterface_SizeHint
 func callbackQDesignerWidgetBoxInterface_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -13390,7 +13425,7 @@ func (ptr *QDesignerWidgetBoxInterface) SizeHintDefault() *core.QSize {
 
 //export callbackQDesignerWidgetBoxInterface_InputMethodQuery
 func callbackQDesignerWidgetBoxInterface_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -13408,7 +13443,7 @@ func (ptr *QDesignerWidgetBoxInterface) InputMethodQueryDefault(query core.Qt__I
 
 //export callbackQDesignerWidgetBoxInterface_HasHeightForWidth
 func callbackQDesignerWidgetBoxInterface_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -13424,7 +13459,7 @@ func (ptr *QDesignerWidgetBoxInterface) HasHeightForWidthDefault() bool {
 
 //export callbackQDesignerWidgetBoxInterface_HeightForWidth
 func callbackQDesignerWidgetBoxInterface_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -13440,7 +13475,7 @@ func (ptr *QDesignerWidgetBoxInterface) HeightForWidthDefault(w int) int {
 
 //export callbackQDesignerWidgetBoxInterface_Metric
 func callbackQDesignerWidgetBoxInterface_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -13456,7 +13491,7 @@ func (ptr *QDesignerWidgetBoxInterface) MetricDefault(m gui.QPaintDevice__PaintD
 
 //export callbackQDesignerWidgetBoxInterface_EventFilter
 func callbackQDesignerWidgetBoxInterface_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -13472,7 +13507,7 @@ func (ptr *QDesignerWidgetBoxInterface) EventFilterDefault(watched core.QObject_
 
 //export callbackQDesignerWidgetBoxInterface_ChildEvent
 func callbackQDesignerWidgetBoxInterface_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -13487,7 +13522,7 @@ func (ptr *QDesignerWidgetBoxInterface) ChildEventDefault(event core.QChildEvent
 
 //export callbackQDesignerWidgetBoxInterface_ConnectNotify
 func callbackQDesignerWidgetBoxInterface_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -13502,7 +13537,7 @@ func (ptr *QDesignerWidgetBoxInterface) ConnectNotifyDefault(sign core.QMetaMeth
 
 //export callbackQDesignerWidgetBoxInterface_CustomEvent
 func callbackQDesignerWidgetBoxInterface_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -13517,7 +13552,7 @@ func (ptr *QDesignerWidgetBoxInterface) CustomEventDefault(event core.QEvent_ITF
 
 //export callbackQDesignerWidgetBoxInterface_DeleteLater
 func callbackQDesignerWidgetBoxInterface_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).DeleteLaterDefault()
@@ -13527,14 +13562,14 @@ func callbackQDesignerWidgetBoxInterface_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QDesignerWidgetBoxInterface) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QDesignerWidgetBoxInterface_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDesignerWidgetBoxInterface_Destroyed
 func callbackQDesignerWidgetBoxInterface_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -13542,7 +13577,7 @@ func callbackQDesignerWidgetBoxInterface_Destroyed(ptr unsafe.Pointer, obj unsaf
 
 //export callbackQDesignerWidgetBoxInterface_DisconnectNotify
 func callbackQDesignerWidgetBoxInterface_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -13557,7 +13592,7 @@ func (ptr *QDesignerWidgetBoxInterface) DisconnectNotifyDefault(sign core.QMetaM
 
 //export callbackQDesignerWidgetBoxInterface_ObjectNameChanged
 func callbackQDesignerWidgetBoxInterface_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -13565,7 +13600,7 @@ func callbackQDesignerWidgetBoxInterface_ObjectNameChanged(ptr unsafe.Pointer, o
 
 //export callbackQDesignerWidgetBoxInterface_TimerEvent
 func callbackQDesignerWidgetBoxInterface_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQDesignerWidgetBoxInterfaceFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -13580,7 +13615,7 @@ func (ptr *QDesignerWidgetBoxInterface) TimerEventDefault(event core.QTimerEvent
 
 //export callbackQDesignerWidgetBoxInterface_MetaObject
 func callbackQDesignerWidgetBoxInterface_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -13639,14 +13674,14 @@ func NewQExtensionFactoryFromPointer(ptr unsafe.Pointer) *QExtensionFactory {
 func (ptr *QExtensionFactory) DestroyQExtensionFactory() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func NewQExtensionFactory(parent QExtensionManager_ITF) *QExtensionFactory {
 	var tmpValue = NewQExtensionFactoryFromPointer(C.QExtensionFactory_NewQExtensionFactory(PointerFromQExtensionManager(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -13655,7 +13690,7 @@ func NewQExtensionFactory(parent QExtensionManager_ITF) *QExtensionFactory {
 func (ptr *QExtensionFactory) ExtensionManager() *QExtensionManager {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQExtensionManagerFromPointer(C.QExtensionFactory_ExtensionManager(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13665,7 +13700,7 @@ func (ptr *QExtensionFactory) ExtensionManager() *QExtensionManager {
 
 //export callbackQExtensionFactory_CreateExtension
 func callbackQExtensionFactory_CreateExtension(ptr unsafe.Pointer, object unsafe.Pointer, iid C.struct_QtDesigner_PackedString, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createExtension"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createExtension"); signal != nil {
 		return core.PointerFromQObject(signal.(func(*core.QObject, string, *core.QObject) *core.QObject)(core.NewQObjectFromPointer(object), cGoUnpackString(iid), core.NewQObjectFromPointer(parent)))
 	}
 
@@ -13675,14 +13710,14 @@ func callbackQExtensionFactory_CreateExtension(ptr unsafe.Pointer, object unsafe
 func (ptr *QExtensionFactory) ConnectCreateExtension(f func(object *core.QObject, iid string, parent *core.QObject) *core.QObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createExtension", f)
+		qt.ConnectSignal(ptr.Pointer(), "createExtension", f)
 	}
 }
 
 func (ptr *QExtensionFactory) DisconnectCreateExtension() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createExtension")
+		qt.DisconnectSignal(ptr.Pointer(), "createExtension")
 	}
 }
 
@@ -13691,7 +13726,7 @@ func (ptr *QExtensionFactory) CreateExtension(object core.QObject_ITF, iid strin
 		var iidC = C.CString(iid)
 		defer C.free(unsafe.Pointer(iidC))
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionFactory_CreateExtension(ptr.Pointer(), core.PointerFromQObject(object), iidC, core.PointerFromQObject(parent)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13704,7 +13739,7 @@ func (ptr *QExtensionFactory) CreateExtensionDefault(object core.QObject_ITF, ii
 		var iidC = C.CString(iid)
 		defer C.free(unsafe.Pointer(iidC))
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionFactory_CreateExtensionDefault(ptr.Pointer(), core.PointerFromQObject(object), iidC, core.PointerFromQObject(parent)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13714,7 +13749,7 @@ func (ptr *QExtensionFactory) CreateExtensionDefault(object core.QObject_ITF, ii
 
 //export callbackQExtensionFactory_Extension
 func callbackQExtensionFactory_Extension(ptr unsafe.Pointer, object unsafe.Pointer, iid C.struct_QtDesigner_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "extension"); signal != nil {
+	if signal := qt.GetSignal(ptr, "extension"); signal != nil {
 		return core.PointerFromQObject(signal.(func(*core.QObject, string) *core.QObject)(core.NewQObjectFromPointer(object), cGoUnpackString(iid)))
 	}
 
@@ -13724,14 +13759,14 @@ func callbackQExtensionFactory_Extension(ptr unsafe.Pointer, object unsafe.Point
 func (ptr *QExtensionFactory) ConnectExtension(f func(object *core.QObject, iid string) *core.QObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "extension", f)
+		qt.ConnectSignal(ptr.Pointer(), "extension", f)
 	}
 }
 
 func (ptr *QExtensionFactory) DisconnectExtension() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "extension")
+		qt.DisconnectSignal(ptr.Pointer(), "extension")
 	}
 }
 
@@ -13740,7 +13775,7 @@ func (ptr *QExtensionFactory) Extension(object core.QObject_ITF, iid string) *co
 		var iidC = C.CString(iid)
 		defer C.free(unsafe.Pointer(iidC))
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionFactory_Extension(ptr.Pointer(), core.PointerFromQObject(object), iidC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13753,7 +13788,7 @@ func (ptr *QExtensionFactory) ExtensionDefault(object core.QObject_ITF, iid stri
 		var iidC = C.CString(iid)
 		defer C.free(unsafe.Pointer(iidC))
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionFactory_ExtensionDefault(ptr.Pointer(), core.PointerFromQObject(object), iidC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13783,7 +13818,7 @@ func (ptr *QExtensionFactory) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QExtensionFactory) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionFactory___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13804,7 +13839,7 @@ func (ptr *QExtensionFactory) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QExtensionFactory) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionFactory___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13825,7 +13860,7 @@ func (ptr *QExtensionFactory) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QExtensionFactory) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionFactory___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13846,7 +13881,7 @@ func (ptr *QExtensionFactory) __findChildren_newList() unsafe.Pointer {
 func (ptr *QExtensionFactory) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionFactory___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13866,7 +13901,7 @@ func (ptr *QExtensionFactory) __children_newList() unsafe.Pointer {
 
 //export callbackQExtensionFactory_Event
 func callbackQExtensionFactory_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -13889,7 +13924,7 @@ func (ptr *QExtensionFactory) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQExtensionFactory_EventFilter
 func callbackQExtensionFactory_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -13912,7 +13947,7 @@ func (ptr *QExtensionFactory) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQExtensionFactory_ChildEvent
 func callbackQExtensionFactory_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQExtensionFactoryFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -13933,7 +13968,7 @@ func (ptr *QExtensionFactory) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQExtensionFactory_ConnectNotify
 func callbackQExtensionFactory_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQExtensionFactoryFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -13954,7 +13989,7 @@ func (ptr *QExtensionFactory) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQExtensionFactory_CustomEvent
 func callbackQExtensionFactory_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQExtensionFactoryFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -13975,7 +14010,7 @@ func (ptr *QExtensionFactory) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQExtensionFactory_DeleteLater
 func callbackQExtensionFactory_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQExtensionFactoryFromPointer(ptr).DeleteLaterDefault()
@@ -13985,7 +14020,7 @@ func callbackQExtensionFactory_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QExtensionFactory) DeleteLater() {
 	if ptr.Pointer() != nil {
 		C.QExtensionFactory_DeleteLater(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13993,14 +14028,14 @@ func (ptr *QExtensionFactory) DeleteLater() {
 func (ptr *QExtensionFactory) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QExtensionFactory_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQExtensionFactory_Destroyed
 func callbackQExtensionFactory_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -14008,7 +14043,7 @@ func callbackQExtensionFactory_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQExtensionFactory_DisconnectNotify
 func callbackQExtensionFactory_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQExtensionFactoryFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -14029,7 +14064,7 @@ func (ptr *QExtensionFactory) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQExtensionFactory_ObjectNameChanged
 func callbackQExtensionFactory_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -14037,7 +14072,7 @@ func callbackQExtensionFactory_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQExtensionFactory_TimerEvent
 func callbackQExtensionFactory_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQExtensionFactoryFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -14058,7 +14093,7 @@ func (ptr *QExtensionFactory) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQExtensionFactory_MetaObject
 func callbackQExtensionFactory_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -14122,7 +14157,7 @@ func NewQExtensionManagerFromPointer(ptr unsafe.Pointer) *QExtensionManager {
 }
 func NewQExtensionManager(parent core.QObject_ITF) *QExtensionManager {
 	var tmpValue = NewQExtensionManagerFromPointer(C.QExtensionManager_NewQExtensionManager(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -14130,7 +14165,7 @@ func NewQExtensionManager(parent core.QObject_ITF) *QExtensionManager {
 
 //export callbackQExtensionManager_RegisterExtensions
 func callbackQExtensionManager_RegisterExtensions(ptr unsafe.Pointer, factory unsafe.Pointer, iid C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "registerExtensions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "registerExtensions"); signal != nil {
 		signal.(func(*QAbstractExtensionFactory, string))(NewQAbstractExtensionFactoryFromPointer(factory), cGoUnpackString(iid))
 	} else {
 		NewQExtensionManagerFromPointer(ptr).RegisterExtensionsDefault(NewQAbstractExtensionFactoryFromPointer(factory), cGoUnpackString(iid))
@@ -14140,14 +14175,14 @@ func callbackQExtensionManager_RegisterExtensions(ptr unsafe.Pointer, factory un
 func (ptr *QExtensionManager) ConnectRegisterExtensions(f func(factory *QAbstractExtensionFactory, iid string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "registerExtensions", f)
+		qt.ConnectSignal(ptr.Pointer(), "registerExtensions", f)
 	}
 }
 
 func (ptr *QExtensionManager) DisconnectRegisterExtensions() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "registerExtensions")
+		qt.DisconnectSignal(ptr.Pointer(), "registerExtensions")
 	}
 }
 
@@ -14169,7 +14204,7 @@ func (ptr *QExtensionManager) RegisterExtensionsDefault(factory QAbstractExtensi
 
 //export callbackQExtensionManager_UnregisterExtensions
 func callbackQExtensionManager_UnregisterExtensions(ptr unsafe.Pointer, factory unsafe.Pointer, iid C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unregisterExtensions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unregisterExtensions"); signal != nil {
 		signal.(func(*QAbstractExtensionFactory, string))(NewQAbstractExtensionFactoryFromPointer(factory), cGoUnpackString(iid))
 	} else {
 		NewQExtensionManagerFromPointer(ptr).UnregisterExtensionsDefault(NewQAbstractExtensionFactoryFromPointer(factory), cGoUnpackString(iid))
@@ -14179,14 +14214,14 @@ func callbackQExtensionManager_UnregisterExtensions(ptr unsafe.Pointer, factory
 func (ptr *QExtensionManager) ConnectUnregisterExtensions(f func(factory *QAbstractExtensionFactory, iid string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterExtensions", f)
+		qt.ConnectSignal(ptr.Pointer(), "unregisterExtensions", f)
 	}
 }
 
 func (ptr *QExtensionManager) DisconnectUnregisterExtensions() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unregisterExtensions")
+		qt.DisconnectSignal(ptr.Pointer(), "unregisterExtensions")
 	}
 }
 
@@ -14209,14 +14244,14 @@ func (ptr *QExtensionManager) UnregisterExtensionsDefault(factory QAbstractExten
 func (ptr *QExtensionManager) DestroyQExtensionManager() {
 	if ptr.Pointer() != nil {
 		C.QExtensionManager_DestroyQExtensionManager(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQExtensionManager_Extension
 func callbackQExtensionManager_Extension(ptr unsafe.Pointer, object unsafe.Pointer, iid C.struct_QtDesigner_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "extension"); signal != nil {
+	if signal := qt.GetSignal(ptr, "extension"); signal != nil {
 		return core.PointerFromQObject(signal.(func(*core.QObject, string) *core.QObject)(core.NewQObjectFromPointer(object), cGoUnpackString(iid)))
 	}
 
@@ -14226,14 +14261,14 @@ func callbackQExtensionManager_Extension(ptr unsafe.Pointer, object unsafe.Point
 func (ptr *QExtensionManager) ConnectExtension(f func(object *core.QObject, iid string) *core.QObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "extension", f)
+		qt.ConnectSignal(ptr.Pointer(), "extension", f)
 	}
 }
 
 func (ptr *QExtensionManager) DisconnectExtension() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "extension")
+		qt.DisconnectSignal(ptr.Pointer(), "extension")
 	}
 }
 
@@ -14242,7 +14277,7 @@ func (ptr *QExtensionManager) Extension(object core.QObject_ITF, iid string) *co
 		var iidC = C.CString(iid)
 		defer C.free(unsafe.Pointer(iidC))
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionManager_Extension(ptr.Pointer(), core.PointerFromQObject(object), iidC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14255,7 +14290,7 @@ func (ptr *QExtensionManager) ExtensionDefault(object core.QObject_ITF, iid stri
 		var iidC = C.CString(iid)
 		defer C.free(unsafe.Pointer(iidC))
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionManager_ExtensionDefault(ptr.Pointer(), core.PointerFromQObject(object), iidC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14285,7 +14320,7 @@ func (ptr *QExtensionManager) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QExtensionManager) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionManager___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14306,7 +14341,7 @@ func (ptr *QExtensionManager) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QExtensionManager) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionManager___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14327,7 +14362,7 @@ func (ptr *QExtensionManager) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QExtensionManager) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionManager___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14348,7 +14383,7 @@ func (ptr *QExtensionManager) __findChildren_newList() unsafe.Pointer {
 func (ptr *QExtensionManager) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QExtensionManager___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14368,7 +14403,7 @@ func (ptr *QExtensionManager) __children_newList() unsafe.Pointer {
 
 //export callbackQExtensionManager_Event
 func callbackQExtensionManager_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -14391,7 +14426,7 @@ func (ptr *QExtensionManager) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQExtensionManager_EventFilter
 func callbackQExtensionManager_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -14414,7 +14449,7 @@ func (ptr *QExtensionManager) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQExtensionManager_ChildEvent
 func callbackQExtensionManager_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQExtensionManagerFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -14435,7 +14470,7 @@ func (ptr *QExtensionManager) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQExtensionManager_ConnectNotify
 func callbackQExtensionManager_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQExtensionManagerFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -14456,7 +14491,7 @@ func (ptr *QExtensionManager) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQExtensionManager_CustomEvent
 func callbackQExtensionManager_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQExtensionManagerFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -14477,7 +14512,7 @@ func (ptr *QExtensionManager) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQExtensionManager_DeleteLater
 func callbackQExtensionManager_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQExtensionManagerFromPointer(ptr).DeleteLaterDefault()
@@ -14487,7 +14522,7 @@ func callbackQExtensionManager_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QExtensionManager) DeleteLater() {
 	if ptr.Pointer() != nil {
 		C.QExtensionManager_DeleteLater(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14495,14 +14530,14 @@ func (ptr *QExtensionManager) DeleteLater() {
 func (ptr *QExtensionManager) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QExtensionManager_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQExtensionManager_Destroyed
 func callbackQExtensionManager_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -14510,7 +14545,7 @@ func callbackQExtensionManager_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQExtensionManager_DisconnectNotify
 func callbackQExtensionManager_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQExtensionManagerFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -14531,7 +14566,7 @@ func (ptr *QExtensionManager) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQExtensionManager_ObjectNameChanged
 func callbackQExtensionManager_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtDesigner_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -14539,7 +14574,7 @@ func callbackQExtensionManager_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQExtensionManager_TimerEvent
 func callbackQExtensionManager_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQExtensionManagerFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -14560,7 +14595,7 @@ func (ptr *QExtensionManager) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQExtensionManager_MetaObject
 func callbackQExtensionManager_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -14639,7 +14674,7 @@ func (ptr *QFormBuilder) ClearPluginPaths() {
 
 func (ptr *QFormBuilder) SetPluginPath(pluginPaths []string) {
 	if ptr.Pointer() != nil {
-		var pluginPathsC = C.CString(strings.Join(pluginPaths, "|"))
+		var pluginPathsC = cGoPackStringList(pluginPaths)
 		defer C.free(unsafe.Pointer(pluginPathsC))
 		C.QFormBuilder_SetPluginPath(ptr.Pointer(), pluginPathsC)
 	}
@@ -14647,7 +14682,7 @@ func (ptr *QFormBuilder) SetPluginPath(pluginPaths []string) {
 
 //export callbackQFormBuilder_DestroyQFormBuilder
 func callbackQFormBuilder_DestroyQFormBuilder(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QFormBuilder"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QFormBuilder"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQFormBuilderFromPointer(ptr).DestroyQFormBuilderDefault()
@@ -14657,21 +14692,21 @@ func callbackQFormBuilder_DestroyQFormBuilder(ptr unsafe.Pointer) {
 func (ptr *QFormBuilder) ConnectDestroyQFormBuilder(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QFormBuilder", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QFormBuilder", f)
 	}
 }
 
 func (ptr *QFormBuilder) DisconnectDestroyQFormBuilder() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QFormBuilder")
+		qt.DisconnectSignal(ptr.Pointer(), "~QFormBuilder")
 	}
 }
 
 func (ptr *QFormBuilder) DestroyQFormBuilder() {
 	if ptr.Pointer() != nil {
 		C.QFormBuilder_DestroyQFormBuilder(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14679,7 +14714,7 @@ func (ptr *QFormBuilder) DestroyQFormBuilder() {
 func (ptr *QFormBuilder) DestroyQFormBuilderDefault() {
 	if ptr.Pointer() != nil {
 		C.QFormBuilder_DestroyQFormBuilderDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14699,7 +14734,7 @@ func (ptr *QFormBuilder) CustomWidgets() []*QDesignerCustomWidgetInterface {
 
 func (ptr *QFormBuilder) PluginPaths() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QFormBuilder_PluginPaths(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QFormBuilder_PluginPaths(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -468,8 +468,8 @@ void QDesignerMemberSheetExtension_SetMemberGroup(void* ptr, int index, char* gr
 void QDesignerMemberSheetExtension_SetVisible(void* ptr, int index, char visible);
 void QDesignerMemberSheetExtension_DestroyQDesignerMemberSheetExtension(void* ptr);
 void QDesignerMemberSheetExtension_DestroyQDesignerMemberSheetExtensionDefault(void* ptr);
-struct QtDesigner_PackedList QDesignerMemberSheetExtension_ParameterNames(void* ptr, int index);
-struct QtDesigner_PackedList QDesignerMemberSheetExtension_ParameterTypes(void* ptr, int index);
+struct QtDesigner_PackedString QDesignerMemberSheetExtension_ParameterNames(void* ptr, int index);
+struct QtDesigner_PackedString QDesignerMemberSheetExtension_ParameterTypes(void* ptr, int index);
 struct QtDesigner_PackedString QDesignerMemberSheetExtension_DeclaredInClass(void* ptr, int index);
 struct QtDesigner_PackedString QDesignerMemberSheetExtension_MemberGroup(void* ptr, int index);
 struct QtDesigner_PackedString QDesignerMemberSheetExtension_MemberName(void* ptr, int index);
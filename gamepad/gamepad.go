@@ -8,7 +8,6 @@ package gamepad
 //#include "gamepad.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
@@ -21,6 +20,43 @@ func cGoUnpackString(s C.struct_QtGamepad_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtGamepad_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtGamepad_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QGamepad struct {
 	core.QObject
@@ -62,7 +98,7 @@ func NewQGamepadFromPointer(ptr unsafe.Pointer) *QGamepad {
 }
 func NewQGamepad(deviceId int, parent core.QObject_ITF) *QGamepad {
 	var tmpValue = NewQGamepadFromPointer(C.QGamepad_NewQGamepad(C.int(int32(deviceId)), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -70,7 +106,7 @@ func NewQGamepad(deviceId int, parent core.QObject_ITF) *QGamepad {
 
 //export callbackQGamepad_AxisLeftXChanged
 func callbackQGamepad_AxisLeftXChanged(ptr unsafe.Pointer, value C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisLeftXChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisLeftXChanged"); signal != nil {
 		signal.(func(float64))(float64(value))
 	}
 
@@ -79,14 +115,14 @@ func callbackQGamepad_AxisLeftXChanged(ptr unsafe.Pointer, value C.double) {
 func (ptr *QGamepad) ConnectAxisLeftXChanged(f func(value float64)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectAxisLeftXChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisLeftXChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisLeftXChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectAxisLeftXChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectAxisLeftXChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisLeftXChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisLeftXChanged")
 	}
 }
 
@@ -98,7 +134,7 @@ func (ptr *QGamepad) AxisLeftXChanged(value float64) {
 
 //export callbackQGamepad_AxisLeftYChanged
 func callbackQGamepad_AxisLeftYChanged(ptr unsafe.Pointer, value C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisLeftYChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisLeftYChanged"); signal != nil {
 		signal.(func(float64))(float64(value))
 	}
 
@@ -107,14 +143,14 @@ func callbackQGamepad_AxisLeftYChanged(ptr unsafe.Pointer, value C.double) {
 func (ptr *QGamepad) ConnectAxisLeftYChanged(f func(value float64)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectAxisLeftYChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisLeftYChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisLeftYChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectAxisLeftYChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectAxisLeftYChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisLeftYChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisLeftYChanged")
 	}
 }
 
@@ -126,7 +162,7 @@ func (ptr *QGamepad) AxisLeftYChanged(value float64) {
 
 //export callbackQGamepad_AxisRightXChanged
 func callbackQGamepad_AxisRightXChanged(ptr unsafe.Pointer, value C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisRightXChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisRightXChanged"); signal != nil {
 		signal.(func(float64))(float64(value))
 	}
 
@@ -135,14 +171,14 @@ func callbackQGamepad_AxisRightXChanged(ptr unsafe.Pointer, value C.double) {
 func (ptr *QGamepad) ConnectAxisRightXChanged(f func(value float64)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectAxisRightXChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisRightXChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisRightXChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectAxisRightXChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectAxisRightXChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisRightXChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisRightXChanged")
 	}
 }
 
@@ -154,7 +190,7 @@ func (ptr *QGamepad) AxisRightXChanged(value float64) {
 
 //export callbackQGamepad_AxisRightYChanged
 func callbackQGamepad_AxisRightYChanged(ptr unsafe.Pointer, value C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axisRightYChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axisRightYChanged"); signal != nil {
 		signal.(func(float64))(float64(value))
 	}
 
@@ -163,14 +199,14 @@ func callbackQGamepad_AxisRightYChanged(ptr unsafe.Pointer, value C.double) {
 func (ptr *QGamepad) ConnectAxisRightYChanged(f func(value float64)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectAxisRightYChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axisRightYChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axisRightYChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectAxisRightYChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectAxisRightYChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axisRightYChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axisRightYChanged")
 	}
 }
 
@@ -182,7 +218,7 @@ func (ptr *QGamepad) AxisRightYChanged(value float64) {
 
 //export callbackQGamepad_ButtonAChanged
 func callbackQGamepad_ButtonAChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonAChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonAChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -191,14 +227,14 @@ func callbackQGamepad_ButtonAChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonAChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonAChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonAChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonAChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonAChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonAChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonAChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonAChanged")
 	}
 }
 
@@ -210,7 +246,7 @@ func (ptr *QGamepad) ButtonAChanged(value bool) {
 
 //export callbackQGamepad_ButtonBChanged
 func callbackQGamepad_ButtonBChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonBChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonBChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -219,14 +255,14 @@ func callbackQGamepad_ButtonBChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonBChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonBChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonBChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonBChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonBChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonBChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonBChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonBChanged")
 	}
 }
 
@@ -238,7 +274,7 @@ func (ptr *QGamepad) ButtonBChanged(value bool) {
 
 //export callbackQGamepad_ButtonCenterChanged
 func callbackQGamepad_ButtonCenterChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonCenterChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonCenterChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -247,14 +283,14 @@ func callbackQGamepad_ButtonCenterChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonCenterChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonCenterChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonCenterChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonCenterChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonCenterChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonCenterChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonCenterChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonCenterChanged")
 	}
 }
 
@@ -266,7 +302,7 @@ func (ptr *QGamepad) ButtonCenterChanged(value bool) {
 
 //export callbackQGamepad_ButtonDownChanged
 func callbackQGamepad_ButtonDownChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonDownChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonDownChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -275,14 +311,14 @@ func callbackQGamepad_ButtonDownChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonDownChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonDownChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonDownChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonDownChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonDownChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonDownChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonDownChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonDownChanged")
 	}
 }
 
@@ -294,7 +330,7 @@ func (ptr *QGamepad) ButtonDownChanged(value bool) {
 
 //export callbackQGamepad_ButtonGuideChanged
 func callbackQGamepad_ButtonGuideChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonGuideChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonGuideChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -303,14 +339,14 @@ func callbackQGamepad_ButtonGuideChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonGuideChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonGuideChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonGuideChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonGuideChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonGuideChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonGuideChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonGuideChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonGuideChanged")
 	}
 }
 
@@ -322,7 +358,7 @@ func (ptr *QGamepad) ButtonGuideChanged(value bool) {
 
 //export callbackQGamepad_ButtonL1Changed
 func callbackQGamepad_ButtonL1Changed(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonL1Changed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonL1Changed"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -331,14 +367,14 @@ func callbackQGamepad_ButtonL1Changed(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonL1Changed(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonL1Changed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonL1Changed", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonL1Changed", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonL1Changed() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonL1Changed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonL1Changed")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonL1Changed")
 	}
 }
 
@@ -350,7 +386,7 @@ func (ptr *QGamepad) ButtonL1Changed(value bool) {
 
 //export callbackQGamepad_ButtonL2Changed
 func callbackQGamepad_ButtonL2Changed(ptr unsafe.Pointer, value C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonL2Changed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonL2Changed"); signal != nil {
 		signal.(func(float64))(float64(value))
 	}
 
@@ -359,14 +395,14 @@ func callbackQGamepad_ButtonL2Changed(ptr unsafe.Pointer, value C.double) {
 func (ptr *QGamepad) ConnectButtonL2Changed(f func(value float64)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonL2Changed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonL2Changed", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonL2Changed", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonL2Changed() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonL2Changed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonL2Changed")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonL2Changed")
 	}
 }
 
@@ -378,7 +414,7 @@ func (ptr *QGamepad) ButtonL2Changed(value float64) {
 
 //export callbackQGamepad_ButtonL3Changed
 func callbackQGamepad_ButtonL3Changed(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonL3Changed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonL3Changed"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -387,14 +423,14 @@ func callbackQGamepad_ButtonL3Changed(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonL3Changed(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonL3Changed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonL3Changed", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonL3Changed", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonL3Changed() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonL3Changed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonL3Changed")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonL3Changed")
 	}
 }
 
@@ -406,7 +442,7 @@ func (ptr *QGamepad) ButtonL3Changed(value bool) {
 
 //export callbackQGamepad_ButtonLeftChanged
 func callbackQGamepad_ButtonLeftChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonLeftChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonLeftChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -415,14 +451,14 @@ func callbackQGamepad_ButtonLeftChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonLeftChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonLeftChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonLeftChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonLeftChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonLeftChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonLeftChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonLeftChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonLeftChanged")
 	}
 }
 
@@ -434,7 +470,7 @@ func (ptr *QGamepad) ButtonLeftChanged(value bool) {
 
 //export callbackQGamepad_ButtonR1Changed
 func callbackQGamepad_ButtonR1Changed(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonR1Changed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonR1Changed"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -443,14 +479,14 @@ func callbackQGamepad_ButtonR1Changed(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonR1Changed(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonR1Changed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonR1Changed", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonR1Changed", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonR1Changed() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonR1Changed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonR1Changed")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonR1Changed")
 	}
 }
 
@@ -462,7 +498,7 @@ func (ptr *QGamepad) ButtonR1Changed(value bool) {
 
 //export callbackQGamepad_ButtonR2Changed
 func callbackQGamepad_ButtonR2Changed(ptr unsafe.Pointer, value C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonR2Changed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonR2Changed"); signal != nil {
 		signal.(func(float64))(float64(value))
 	}
 
@@ -471,14 +507,14 @@ func callbackQGamepad_ButtonR2Changed(ptr unsafe.Pointer, value C.double) {
 func (ptr *QGamepad) ConnectButtonR2Changed(f func(value float64)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonR2Changed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonR2Changed", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonR2Changed", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonR2Changed() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonR2Changed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonR2Changed")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonR2Changed")
 	}
 }
 
@@ -490,7 +526,7 @@ func (ptr *QGamepad) ButtonR2Changed(value float64) {
 
 //export callbackQGamepad_ButtonR3Changed
 func callbackQGamepad_ButtonR3Changed(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonR3Changed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonR3Changed"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -499,14 +535,14 @@ func callbackQGamepad_ButtonR3Changed(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonR3Changed(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonR3Changed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonR3Changed", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonR3Changed", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonR3Changed() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonR3Changed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonR3Changed")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonR3Changed")
 	}
 }
 
@@ -518,7 +554,7 @@ func (ptr *QGamepad) ButtonR3Changed(value bool) {
 
 //export callbackQGamepad_ButtonRightChanged
 func callbackQGamepad_ButtonRightChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonRightChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonRightChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -527,14 +563,14 @@ func callbackQGamepad_ButtonRightChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonRightChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonRightChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonRightChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonRightChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonRightChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonRightChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonRightChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonRightChanged")
 	}
 }
 
@@ -546,7 +582,7 @@ func (ptr *QGamepad) ButtonRightChanged(value bool) {
 
 //export callbackQGamepad_ButtonSelectChanged
 func callbackQGamepad_ButtonSelectChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonSelectChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonSelectChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -555,14 +591,14 @@ func callbackQGamepad_ButtonSelectChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonSelectChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonSelectChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonSelectChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonSelectChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonSelectChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonSelectChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonSelectChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonSelectChanged")
 	}
 }
 
@@ -574,7 +610,7 @@ func (ptr *QGamepad) ButtonSelectChanged(value bool) {
 
 //export callbackQGamepad_ButtonStartChanged
 func callbackQGamepad_ButtonStartChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonStartChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonStartChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -583,14 +619,14 @@ func callbackQGamepad_ButtonStartChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonStartChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonStartChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonStartChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonStartChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonStartChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonStartChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonStartChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonStartChanged")
 	}
 }
 
@@ -602,7 +638,7 @@ func (ptr *QGamepad) ButtonStartChanged(value bool) {
 
 //export callbackQGamepad_ButtonUpChanged
 func callbackQGamepad_ButtonUpChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonUpChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonUpChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -611,14 +647,14 @@ func callbackQGamepad_ButtonUpChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonUpChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonUpChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonUpChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonUpChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonUpChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonUpChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonUpChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonUpChanged")
 	}
 }
 
@@ -630,7 +666,7 @@ func (ptr *QGamepad) ButtonUpChanged(value bool) {
 
 //export callbackQGamepad_ButtonXChanged
 func callbackQGamepad_ButtonXChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonXChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonXChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -639,14 +675,14 @@ func callbackQGamepad_ButtonXChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonXChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonXChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonXChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonXChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonXChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonXChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonXChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonXChanged")
 	}
 }
 
@@ -658,7 +694,7 @@ func (ptr *QGamepad) ButtonXChanged(value bool) {
 
 //export callbackQGamepad_ButtonYChanged
 func callbackQGamepad_ButtonYChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buttonYChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buttonYChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -667,14 +703,14 @@ func callbackQGamepad_ButtonYChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectButtonYChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectButtonYChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "buttonYChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "buttonYChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectButtonYChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectButtonYChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "buttonYChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "buttonYChanged")
 	}
 }
 
@@ -686,7 +722,7 @@ func (ptr *QGamepad) ButtonYChanged(value bool) {
 
 //export callbackQGamepad_ConnectedChanged
 func callbackQGamepad_ConnectedChanged(ptr unsafe.Pointer, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectedChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectedChanged"); signal != nil {
 		signal.(func(bool))(int8(value) != 0)
 	}
 
@@ -695,14 +731,14 @@ func callbackQGamepad_ConnectedChanged(ptr unsafe.Pointer, value C.char) {
 func (ptr *QGamepad) ConnectConnectedChanged(f func(value bool)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectConnectedChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "connectedChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "connectedChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectConnectedChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectConnectedChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "connectedChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "connectedChanged")
 	}
 }
 
@@ -714,7 +750,7 @@ func (ptr *QGamepad) ConnectedChanged(value bool) {
 
 //export callbackQGamepad_DeviceIdChanged
 func callbackQGamepad_DeviceIdChanged(ptr unsafe.Pointer, value C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deviceIdChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deviceIdChanged"); signal != nil {
 		signal.(func(int))(int(int32(value)))
 	}
 
@@ -723,14 +759,14 @@ func callbackQGamepad_DeviceIdChanged(ptr unsafe.Pointer, value C.int) {
 func (ptr *QGamepad) ConnectDeviceIdChanged(f func(value int)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectDeviceIdChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "deviceIdChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "deviceIdChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectDeviceIdChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectDeviceIdChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "deviceIdChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "deviceIdChanged")
 	}
 }
 
@@ -742,7 +778,7 @@ func (ptr *QGamepad) DeviceIdChanged(value int) {
 
 //export callbackQGamepad_NameChanged
 func callbackQGamepad_NameChanged(ptr unsafe.Pointer, value C.struct_QtGamepad_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(value))
 	}
 
@@ -751,14 +787,14 @@ func callbackQGamepad_NameChanged(ptr unsafe.Pointer, value C.struct_QtGamepad_P
 func (ptr *QGamepad) ConnectNameChanged(f func(value string)) {
 	if ptr.Pointer() != nil {
 		C.QGamepad_ConnectNameChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nameChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "nameChanged", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectNameChanged() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DisconnectNameChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nameChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "nameChanged")
 	}
 }
 
@@ -772,7 +808,7 @@ func (ptr *QGamepad) NameChanged(value string) {
 
 //export callbackQGamepad_SetDeviceId
 func callbackQGamepad_SetDeviceId(ptr unsafe.Pointer, number C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDeviceId"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDeviceId"); signal != nil {
 		signal.(func(int))(int(int32(number)))
 	} else {
 		NewQGamepadFromPointer(ptr).SetDeviceIdDefault(int(int32(number)))
@@ -782,14 +818,14 @@ func callbackQGamepad_SetDeviceId(ptr unsafe.Pointer, number C.int) {
 func (ptr *QGamepad) ConnectSetDeviceId(f func(number int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setDeviceId", f)
+		qt.ConnectSignal(ptr.Pointer(), "setDeviceId", f)
 	}
 }
 
 func (ptr *QGamepad) DisconnectSetDeviceId() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setDeviceId")
+		qt.DisconnectSignal(ptr.Pointer(), "setDeviceId")
 	}
 }
 
@@ -808,7 +844,7 @@ func (ptr *QGamepad) SetDeviceIdDefault(number int) {
 func (ptr *QGamepad) DestroyQGamepad() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DestroyQGamepad(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1010,7 +1046,7 @@ func (ptr *QGamepad) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QGamepad) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGamepad___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1031,7 +1067,7 @@ func (ptr *QGamepad) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QGamepad) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGamepad___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1052,7 +1088,7 @@ func (ptr *QGamepad) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QGamepad) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGamepad___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1073,7 +1109,7 @@ func (ptr *QGamepad) __findChildren_newList() unsafe.Pointer {
 func (ptr *QGamepad) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGamepad___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1093,7 +1129,7 @@ func (ptr *QGamepad) __children_newList() unsafe.Pointer {
 
 //export callbackQGamepad_Event
 func callbackQGamepad_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -1109,7 +1145,7 @@ func (ptr *QGamepad) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQGamepad_EventFilter
 func callbackQGamepad_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -1125,7 +1161,7 @@ func (ptr *QGamepad) EventFilterDefault(watched core.QObject_ITF, event core.QEv
 
 //export callbackQGamepad_ChildEvent
 func callbackQGamepad_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQGamepadFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -1140,7 +1176,7 @@ func (ptr *QGamepad) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQGamepad_ConnectNotify
 func callbackQGamepad_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQGamepadFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1155,7 +1191,7 @@ func (ptr *QGamepad) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQGamepad_CustomEvent
 func callbackQGamepad_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQGamepadFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -1170,7 +1206,7 @@ func (ptr *QGamepad) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQGamepad_DeleteLater
 func callbackQGamepad_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQGamepadFromPointer(ptr).DeleteLaterDefault()
@@ -1180,14 +1216,14 @@ func callbackQGamepad_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QGamepad) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QGamepad_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQGamepad_Destroyed
 func callbackQGamepad_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -1195,7 +1231,7 @@ func callbackQGamepad_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQGamepad_DisconnectNotify
 func callbackQGamepad_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQGamepadFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1210,7 +1246,7 @@ func (ptr *QGamepad) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQGamepad_ObjectNameChanged
 func callbackQGamepad_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGamepad_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -1218,7 +1254,7 @@ func callbackQGamepad_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_
 
 //export callbackQGamepad_TimerEvent
 func callbackQGamepad_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQGamepadFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -1233,7 +1269,7 @@ func (ptr *QGamepad) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQGamepad_MetaObject
 func callbackQGamepad_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -0,0 +1,14038 @@
+// +build !minimal
+
+#define protected public
+#define private public
+
+#include "gui.h"
+#include "_cgo_export.h"
+
+#include <QAbstractItemModel>
+#include <QAbstractTextDocumentLayout>
+#include <QBitmap>
+#include <QBrush>
+#include <QByteArray>
+#include <QChar>
+#include <QChildEvent>
+#include <QColor>
+#include <QCursor>
+#include <QDataStream>
+#include <QDoubleValidator>
+#include <QEvent>
+#include <QExposeEvent>
+#include <QFocusEvent>
+#include <QFont>
+#include <QFontDatabase>
+#include <QGlyphRun>
+#include <QHash>
+#include <QHideEvent>
+#include <QIODevice>
+#include <QIcon>
+#include <QImage>
+#include <QIntValidator>
+#include <QKeyEvent>
+#include <QKeySequence>
+#include <QLine>
+#include <QLineF>
+#include <QList>
+#include <QLocale>
+#include <QMap>
+#include <QMargins>
+#include <QMatrix4x4>
+#include <QMetaMethod>
+#include <QMetaObject>
+#include <QMimeData>
+#include <QModelIndex>
+#include <QMouseEvent>
+#include <QMoveEvent>
+#include <QObject>
+#include <QOffscreenSurface>
+#include <QPagedPaintDevice>
+#include <QPaintDevice>
+#include <QPaintDeviceWindow>
+#include <QPaintEngine>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPdfWriter>
+#include <QPen>
+#include <QPersistentModelIndex>
+#include <QPixmap>
+#include <QPixmapCache>
+#include <QPlatformSurfaceEvent>
+#include <QPoint>
+#include <QPointF>
+#include <QPointingDeviceUniqueId>
+#include <QPolygon>
+#include <QPolygonF>
+#include <QQuaternion>
+#include <QRadialGradient>
+#include <QRasterWindow>
+#include <QRawFont>
+#include <QRect>
+#include <QRectF>
+#include <QRegExp>
+#include <QRegExpValidator>
+#include <QRegion>
+#include <QRegularExpression>
+#include <QRegularExpressionValidator>
+#include <QResizeEvent>
+#include <QRgba64>
+#include <QScreen>
+#include <QScrollEvent>
+#include <QScrollPrepareEvent>
+#include <QSessionManager>
+#include <QShortcut>
+#include <QShortcutEvent>
+#include <QShowEvent>
+#include <QSize>
+#include <QSizeF>
+#include <QStandardItem>
+#include <QStandardItemModel>
+#include <QStaticText>
+#include <QStatusTipEvent>
+#include <QString>
+#include <QStringList>
+#include <QStyle>
+#include <QStyleHints>
+#include <QSurface>
+#include <QSurfaceFormat>
+#include <QSyntaxHighlighter>
+#include <QTabletEvent>
+#include <QTextBlock>
+#include <QTextBlockFormat>
+#include <QTextBlockGroup>
+#include <QTextBlockUserData>
+#include <QTextCharFormat>
+#include <QTextCodec>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTextDocumentFragment>
+#include <QTextDocumentWriter>
+#include <QTextFormat>
+#include <QTextFragment>
+#include <QTextFrame>
+#include <QTextFrameFormat>
+#include <QTextImageFormat>
+#include <QTextInlineObject>
+#include <QTextItem>
+#include <QTextLayout>
+#include <QTextLength>
+#include <QTextLine>
+#include <QTextList>
+#include <QTextListFormat>
+#include <QTextObject>
+#include <QTextObjectInterface>
+#include <QTextOption>
+#include <QTextTable>
+#include <QTextTableCell>
+#include <QTextTableCellFormat>
+#include <QTextTableFormat>
+#include <QTime>
+#include <QTimer>
+#include <QTimerEvent>
+#include <QTouchDevice>
+#include <QTouchEvent>
+#include <QTransform>
+#include <QUrl>
+#include <QValidator>
+#include <QVariant>
+#include <QVector>
+#include <QVector2D>
+#include <QVector3D>
+#include <QVector4D>
+#include <QWhatsThis>
+#include <QWhatsThisClickedEvent>
+#include <QWheelEvent>
+#include <QWindow>
+#include <QWindowStateChangeEvent>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+char QPixmapCache_QPixmapCache_Find(char* key, void* pixmap)
+{
+	return QPixmapCache::find(QString(key), static_cast<QPixmap*>(pixmap));
+}
+
+char QPixmapCache_QPixmapCache_Insert(char* key, void* pixmap)
+{
+	return QPixmapCache::insert(QString(key), *static_cast<QPixmap*>(pixmap));
+}
+
+int QPixmapCache_QPixmapCache_CacheLimit()
+{
+	return QPixmapCache::cacheLimit();
+}
+
+void QPixmapCache_QPixmapCache_Clear()
+{
+	QPixmapCache::clear();
+}
+
+void QPixmapCache_QPixmapCache_Remove(char* key)
+{
+	QPixmapCache::remove(QString(key));
+}
+
+void QPixmapCache_QPixmapCache_SetCacheLimit(int n)
+{
+	QPixmapCache::setCacheLimit(n);
+}
+
+class MyQPlatformSurfaceEvent: public QPlatformSurfaceEvent
+{
+public:
+	MyQPlatformSurfaceEvent(SurfaceEventType surfaceEventType) : QPlatformSurfaceEvent(surfaceEventType) {};
+};
+
+void* QPlatformSurfaceEvent_NewQPlatformSurfaceEvent(long long surfaceEventType)
+{
+	return new MyQPlatformSurfaceEvent(static_cast<QPlatformSurfaceEvent::SurfaceEventType>(surfaceEventType));
+}
+
+long long QPlatformSurfaceEvent_SurfaceEventType(void* ptr)
+{
+	return static_cast<QPlatformSurfaceEvent*>(ptr)->surfaceEventType();
+}
+
+long long QPlatformSurfaceEvent_M_surfaceEventType(void* ptr)
+{
+	return static_cast<QPlatformSurfaceEvent*>(ptr)->m_surfaceEventType;
+}
+
+void QPlatformSurfaceEvent_SetM_surfaceEventType(void* ptr, long long vsu)
+{
+	static_cast<QPlatformSurfaceEvent*>(ptr)->m_surfaceEventType = static_cast<QPlatformSurfaceEvent::SurfaceEventType>(vsu);
+}
+
+void* QPointingDeviceUniqueId_QPointingDeviceUniqueId_FromNumericId(long long id)
+{
+	return new QPointingDeviceUniqueId(QPointingDeviceUniqueId::fromNumericId(id));
+}
+
+void* QPointingDeviceUniqueId_NewQPointingDeviceUniqueId()
+{
+	return new QPointingDeviceUniqueId();
+}
+
+char QPointingDeviceUniqueId_IsValid(void* ptr)
+{
+	return static_cast<QPointingDeviceUniqueId*>(ptr)->isValid();
+}
+
+long long QPointingDeviceUniqueId_NumericId(void* ptr)
+{
+	return static_cast<QPointingDeviceUniqueId*>(ptr)->numericId();
+}
+
+void* QPolygon_NewQPolygon()
+{
+	return new QPolygon();
+}
+
+void* QPolygon_NewQPolygon8(void* other)
+{
+	return new QPolygon(*static_cast<QPolygon*>(other));
+}
+
+void* QPolygon_NewQPolygon4(void* v)
+{
+	return new QPolygon(*static_cast<QVector<QPoint>*>(v));
+}
+
+void* QPolygon_NewQPolygon7(void* polygon)
+{
+	return new QPolygon(*static_cast<QPolygon*>(polygon));
+}
+
+void* QPolygon_NewQPolygon5(void* rectangle, char closed)
+{
+	return new QPolygon(*static_cast<QRect*>(rectangle), closed != 0);
+}
+
+void* QPolygon_NewQPolygon3(void* points)
+{
+	return new QPolygon(*static_cast<QVector<QPoint>*>(points));
+}
+
+void* QPolygon_NewQPolygon2(int size)
+{
+	return new QPolygon(size);
+}
+
+void QPolygon_PutPoints3(void* ptr, int index, int nPoints, void* fromPolygon, int fromIndex)
+{
+	static_cast<QPolygon*>(ptr)->putPoints(index, nPoints, *static_cast<QPolygon*>(fromPolygon), fromIndex);
+}
+
+void QPolygon_SetPoint2(void* ptr, int index, void* point)
+{
+	static_cast<QPolygon*>(ptr)->setPoint(index, *static_cast<QPoint*>(point));
+}
+
+void QPolygon_SetPoint(void* ptr, int index, int x, int y)
+{
+	static_cast<QPolygon*>(ptr)->setPoint(index, x, y);
+}
+
+void QPolygon_SetPoints(void* ptr, int nPoints, int points)
+{
+	static_cast<QPolygon*>(ptr)->setPoints(nPoints, const_cast<const int*>(&points));
+}
+
+void QPolygon_Swap(void* ptr, void* other)
+{
+	static_cast<QPolygon*>(ptr)->swap(*static_cast<QPolygon*>(other));
+}
+
+void QPolygon_Translate2(void* ptr, void* offset)
+{
+	static_cast<QPolygon*>(ptr)->translate(*static_cast<QPoint*>(offset));
+}
+
+void QPolygon_Translate(void* ptr, int dx, int dy)
+{
+	static_cast<QPolygon*>(ptr)->translate(dx, dy);
+}
+
+void QPolygon_DestroyQPolygon(void* ptr)
+{
+	static_cast<QPolygon*>(ptr)->~QPolygon();
+}
+
+void* QPolygon_Point2(void* ptr, int index)
+{
+	return ({ QPoint tmpValue = static_cast<QPolygon*>(ptr)->point(index); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QPolygon_Intersected(void* ptr, void* r)
+{
+	return new QPolygon(static_cast<QPolygon*>(ptr)->intersected(*static_cast<QPolygon*>(r)));
+}
+
+void* QPolygon_Subtracted(void* ptr, void* r)
+{
+	return new QPolygon(static_cast<QPolygon*>(ptr)->subtracted(*static_cast<QPolygon*>(r)));
+}
+
+void* QPolygon_Translated2(void* ptr, void* offset)
+{
+	return new QPolygon(static_cast<QPolygon*>(ptr)->translated(*static_cast<QPoint*>(offset)));
+}
+
+void* QPolygon_Translated(void* ptr, int dx, int dy)
+{
+	return new QPolygon(static_cast<QPolygon*>(ptr)->translated(dx, dy));
+}
+
+void* QPolygon_United(void* ptr, void* r)
+{
+	return new QPolygon(static_cast<QPolygon*>(ptr)->united(*static_cast<QPolygon*>(r)));
+}
+
+void* QPolygon_BoundingRect(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QPolygon*>(ptr)->boundingRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+char QPolygon_ContainsPoint(void* ptr, void* point, long long fillRule)
+{
+	return static_cast<QPolygon*>(ptr)->containsPoint(*static_cast<QPoint*>(point), static_cast<Qt::FillRule>(fillRule));
+}
+
+void QPolygon_Point(void* ptr, int index, int x, int y)
+{
+	static_cast<QPolygon*>(ptr)->point(index, &x, &y);
+}
+
+void* QPolygon___QPolygon_v_atList4(void* ptr, int i)
+{
+	return ({ QPoint tmpValue = static_cast<QVector<QPoint>*>(ptr)->at(i); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void QPolygon___QPolygon_v_setList4(void* ptr, void* i)
+{
+	static_cast<QVector<QPoint>*>(ptr)->append(*static_cast<QPoint*>(i));
+}
+
+void* QPolygon___QPolygon_v_newList4(void* ptr)
+{
+	return new QVector<QPoint>;
+}
+
+void* QPolygon___QPolygon_v_newListBuffer4(void* ptr, void* data, int count)
+{
+	return ({ QVector<QPoint>* tmpList = new QVector<QPoint>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPoint*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QPolygon___QPolygon_v_fillList4(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<QPoint>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPoint(static_cast<QVector<QPoint>*>(ptr)->at(i));
+}
+
+void* QPolygon___QPolygon_points_atList3(void* ptr, int i)
+{
+	return ({ QPoint tmpValue = static_cast<QVector<QPoint>*>(ptr)->at(i); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void QPolygon___QPolygon_points_setList3(void* ptr, void* i)
+{
+	static_cast<QVector<QPoint>*>(ptr)->append(*static_cast<QPoint*>(i));
+}
+
+void* QPolygon___QPolygon_points_newList3(void* ptr)
+{
+	return new QVector<QPoint>;
+}
+
+void* QPolygon___QPolygon_points_newListBuffer3(void* ptr, void* data, int count)
+{
+	return ({ QVector<QPoint>* tmpList = new QVector<QPoint>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPoint*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QPolygon___QPolygon_points_fillList3(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<QPoint>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPoint(static_cast<QVector<QPoint>*>(ptr)->at(i));
+}
+
+void* QPolygon___QVector_other_atList5(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___QVector_other_setList5(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___QVector_other_newList5(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygon___QVector_other_atList4(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___QVector_other_setList4(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___QVector_other_newList4(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygon___fill_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___fill_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___fill_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygon___fromList_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___fromList_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___fromList_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygon___fromList_list_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___fromList_list_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___fromList_list_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygon___fromStdVector_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___fromStdVector_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___fromStdVector_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygon___append_value_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___append_value_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___append_value_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygon___swap_other_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___swap_other_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___swap_other_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygon___toList_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___toList_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___toList_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygon___mid_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygon___mid_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygon___mid_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF_NewQPolygonF()
+{
+	return new QPolygonF();
+}
+
+void* QPolygonF_NewQPolygonF8(void* other)
+{
+	return new QPolygonF(*static_cast<QPolygonF*>(other));
+}
+
+void* QPolygonF_NewQPolygonF4(void* v)
+{
+	return new QPolygonF(*static_cast<QVector<QPointF>*>(v));
+}
+
+void* QPolygonF_NewQPolygonF6(void* polygon)
+{
+	return new QPolygonF(*static_cast<QPolygon*>(polygon));
+}
+
+void* QPolygonF_NewQPolygonF7(void* polygon)
+{
+	return new QPolygonF(*static_cast<QPolygonF*>(polygon));
+}
+
+void* QPolygonF_NewQPolygonF5(void* rectangle)
+{
+	return new QPolygonF(*static_cast<QRectF*>(rectangle));
+}
+
+void* QPolygonF_NewQPolygonF3(void* points)
+{
+	return new QPolygonF(*static_cast<QVector<QPointF>*>(points));
+}
+
+void* QPolygonF_NewQPolygonF2(int size)
+{
+	return new QPolygonF(size);
+}
+
+void QPolygonF_Swap(void* ptr, void* other)
+{
+	static_cast<QPolygonF*>(ptr)->swap(*static_cast<QPolygonF*>(other));
+}
+
+void QPolygonF_Translate(void* ptr, void* offset)
+{
+	static_cast<QPolygonF*>(ptr)->translate(*static_cast<QPointF*>(offset));
+}
+
+void QPolygonF_Translate2(void* ptr, double dx, double dy)
+{
+	static_cast<QPolygonF*>(ptr)->translate(dx, dy);
+}
+
+void QPolygonF_DestroyQPolygonF(void* ptr)
+{
+	static_cast<QPolygonF*>(ptr)->~QPolygonF();
+}
+
+void* QPolygonF_ToPolygon(void* ptr)
+{
+	return new QPolygon(static_cast<QPolygonF*>(ptr)->toPolygon());
+}
+
+void* QPolygonF_Intersected(void* ptr, void* r)
+{
+	return new QPolygonF(static_cast<QPolygonF*>(ptr)->intersected(*static_cast<QPolygonF*>(r)));
+}
+
+void* QPolygonF_Subtracted(void* ptr, void* r)
+{
+	return new QPolygonF(static_cast<QPolygonF*>(ptr)->subtracted(*static_cast<QPolygonF*>(r)));
+}
+
+void* QPolygonF_Translated(void* ptr, void* offset)
+{
+	return new QPolygonF(static_cast<QPolygonF*>(ptr)->translated(*static_cast<QPointF*>(offset)));
+}
+
+void* QPolygonF_Translated2(void* ptr, double dx, double dy)
+{
+	return new QPolygonF(static_cast<QPolygonF*>(ptr)->translated(dx, dy));
+}
+
+void* QPolygonF_United(void* ptr, void* r)
+{
+	return new QPolygonF(static_cast<QPolygonF*>(ptr)->united(*static_cast<QPolygonF*>(r)));
+}
+
+void* QPolygonF_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QPolygonF*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+char QPolygonF_ContainsPoint(void* ptr, void* point, long long fillRule)
+{
+	return static_cast<QPolygonF*>(ptr)->containsPoint(*static_cast<QPointF*>(point), static_cast<Qt::FillRule>(fillRule));
+}
+
+char QPolygonF_IsClosed(void* ptr)
+{
+	return static_cast<QPolygonF*>(ptr)->isClosed();
+}
+
+void* QPolygonF___QPolygonF_v_atList4(void* ptr, int i)
+{
+	return ({ QPointF tmpValue = static_cast<QVector<QPointF>*>(ptr)->at(i); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void QPolygonF___QPolygonF_v_setList4(void* ptr, void* i)
+{
+	static_cast<QVector<QPointF>*>(ptr)->append(*static_cast<QPointF*>(i));
+}
+
+void* QPolygonF___QPolygonF_v_newList4(void* ptr)
+{
+	return new QVector<QPointF>;
+}
+
+void* QPolygonF___QPolygonF_v_newListBuffer4(void* ptr, void* data, int count)
+{
+	return ({ QVector<QPointF>* tmpList = new QVector<QPointF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPointF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QPolygonF___QPolygonF_v_fillList4(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<QPointF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPointF(static_cast<QVector<QPointF>*>(ptr)->at(i));
+}
+
+void* QPolygonF___QPolygonF_points_atList3(void* ptr, int i)
+{
+	return ({ QPointF tmpValue = static_cast<QVector<QPointF>*>(ptr)->at(i); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void QPolygonF___QPolygonF_points_setList3(void* ptr, void* i)
+{
+	static_cast<QVector<QPointF>*>(ptr)->append(*static_cast<QPointF*>(i));
+}
+
+void* QPolygonF___QPolygonF_points_newList3(void* ptr)
+{
+	return new QVector<QPointF>;
+}
+
+void* QPolygonF___QPolygonF_points_newListBuffer3(void* ptr, void* data, int count)
+{
+	return ({ QVector<QPointF>* tmpList = new QVector<QPointF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPointF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QPolygonF___QPolygonF_points_fillList3(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<QPointF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPointF(static_cast<QVector<QPointF>*>(ptr)->at(i));
+}
+
+void* QPolygonF___QVector_other_atList5(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___QVector_other_setList5(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___QVector_other_newList5(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF___QVector_other_atList4(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___QVector_other_setList4(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___QVector_other_newList4(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF___fill_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___fill_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___fill_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF___fromList_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___fromList_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___fromList_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF___fromList_list_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___fromList_list_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___fromList_list_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF___fromStdVector_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___fromStdVector_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___fromStdVector_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF___append_value_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___append_value_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___append_value_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF___swap_other_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___swap_other_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___swap_other_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF___toList_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___toList_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___toList_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPolygonF___mid_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPolygonF___mid_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPolygonF___mid_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QQuaternion_QQuaternion_FromAxes(void* xAxis, void* yAxis, void* zAxis)
+{
+	return new QQuaternion(QQuaternion::fromAxes(*static_cast<QVector3D*>(xAxis), *static_cast<QVector3D*>(yAxis), *static_cast<QVector3D*>(zAxis)));
+}
+
+void* QQuaternion_QQuaternion_FromAxisAndAngle(void* axis, float angle)
+{
+	return new QQuaternion(QQuaternion::fromAxisAndAngle(*static_cast<QVector3D*>(axis), angle));
+}
+
+void* QQuaternion_QQuaternion_FromAxisAndAngle2(float x, float y, float z, float angle)
+{
+	return new QQuaternion(QQuaternion::fromAxisAndAngle(x, y, z, angle));
+}
+
+void* QQuaternion_QQuaternion_FromDirection(void* direction, void* up)
+{
+	return new QQuaternion(QQuaternion::fromDirection(*static_cast<QVector3D*>(direction), *static_cast<QVector3D*>(up)));
+}
+
+void* QQuaternion_QQuaternion_FromEulerAngles2(void* eulerAngles)
+{
+	return new QQuaternion(QQuaternion::fromEulerAngles(*static_cast<QVector3D*>(eulerAngles)));
+}
+
+void* QQuaternion_QQuaternion_FromEulerAngles(float pitch, float yaw, float roll)
+{
+	return new QQuaternion(QQuaternion::fromEulerAngles(pitch, yaw, roll));
+}
+
+void* QQuaternion_QQuaternion_Nlerp(void* q1, void* q2, float t)
+{
+	return new QQuaternion(QQuaternion::nlerp(*static_cast<QQuaternion*>(q1), *static_cast<QQuaternion*>(q2), t));
+}
+
+void* QQuaternion_QQuaternion_RotationTo(void* from, void* to)
+{
+	return new QQuaternion(QQuaternion::rotationTo(*static_cast<QVector3D*>(from), *static_cast<QVector3D*>(to)));
+}
+
+void* QQuaternion_QQuaternion_Slerp(void* q1, void* q2, float t)
+{
+	return new QQuaternion(QQuaternion::slerp(*static_cast<QQuaternion*>(q1), *static_cast<QQuaternion*>(q2), t));
+}
+
+void* QQuaternion_NewQQuaternion()
+{
+	return new QQuaternion();
+}
+
+void* QQuaternion_NewQQuaternion5(void* vector)
+{
+	return new QQuaternion(*static_cast<QVector4D*>(vector));
+}
+
+void* QQuaternion_NewQQuaternion4(float scalar, void* vector)
+{
+	return new QQuaternion(scalar, *static_cast<QVector3D*>(vector));
+}
+
+void* QQuaternion_NewQQuaternion3(float scalar, float xpos, float ypos, float zpos)
+{
+	return new QQuaternion(scalar, xpos, ypos, zpos);
+}
+
+float QQuaternion_QQuaternion_DotProduct(void* q1, void* q2)
+{
+	return QQuaternion::dotProduct(*static_cast<QQuaternion*>(q1), *static_cast<QQuaternion*>(q2));
+}
+
+void QQuaternion_Normalize(void* ptr)
+{
+	static_cast<QQuaternion*>(ptr)->normalize();
+}
+
+void QQuaternion_SetScalar(void* ptr, float scalar)
+{
+	static_cast<QQuaternion*>(ptr)->setScalar(scalar);
+}
+
+void QQuaternion_SetVector(void* ptr, void* vector)
+{
+	static_cast<QQuaternion*>(ptr)->setVector(*static_cast<QVector3D*>(vector));
+}
+
+void QQuaternion_SetVector2(void* ptr, float x, float y, float z)
+{
+	static_cast<QQuaternion*>(ptr)->setVector(x, y, z);
+}
+
+void QQuaternion_SetX(void* ptr, float x)
+{
+	static_cast<QQuaternion*>(ptr)->setX(x);
+}
+
+void QQuaternion_SetY(void* ptr, float y)
+{
+	static_cast<QQuaternion*>(ptr)->setY(y);
+}
+
+void QQuaternion_SetZ(void* ptr, float z)
+{
+	static_cast<QQuaternion*>(ptr)->setZ(z);
+}
+
+void* QQuaternion_Conjugated(void* ptr)
+{
+	return new QQuaternion(static_cast<QQuaternion*>(ptr)->conjugated());
+}
+
+void* QQuaternion_Inverted(void* ptr)
+{
+	return new QQuaternion(static_cast<QQuaternion*>(ptr)->inverted());
+}
+
+void* QQuaternion_Normalized(void* ptr)
+{
+	return new QQuaternion(static_cast<QQuaternion*>(ptr)->normalized());
+}
+
+void* QQuaternion_RotatedVector(void* ptr, void* vector)
+{
+	return new QVector3D(static_cast<QQuaternion*>(ptr)->rotatedVector(*static_cast<QVector3D*>(vector)));
+}
+
+void* QQuaternion_ToEulerAngles(void* ptr)
+{
+	return new QVector3D(static_cast<QQuaternion*>(ptr)->toEulerAngles());
+}
+
+void* QQuaternion_Vector(void* ptr)
+{
+	return new QVector3D(static_cast<QQuaternion*>(ptr)->vector());
+}
+
+void* QQuaternion_ToVector4D(void* ptr)
+{
+	return new QVector4D(static_cast<QQuaternion*>(ptr)->toVector4D());
+}
+
+char QQuaternion_IsIdentity(void* ptr)
+{
+	return static_cast<QQuaternion*>(ptr)->isIdentity();
+}
+
+char QQuaternion_IsNull(void* ptr)
+{
+	return static_cast<QQuaternion*>(ptr)->isNull();
+}
+
+float QQuaternion_Length(void* ptr)
+{
+	return static_cast<QQuaternion*>(ptr)->length();
+}
+
+float QQuaternion_LengthSquared(void* ptr)
+{
+	return static_cast<QQuaternion*>(ptr)->lengthSquared();
+}
+
+float QQuaternion_Scalar(void* ptr)
+{
+	return static_cast<QQuaternion*>(ptr)->scalar();
+}
+
+float QQuaternion_X(void* ptr)
+{
+	return static_cast<QQuaternion*>(ptr)->x();
+}
+
+float QQuaternion_Y(void* ptr)
+{
+	return static_cast<QQuaternion*>(ptr)->y();
+}
+
+float QQuaternion_Z(void* ptr)
+{
+	return static_cast<QQuaternion*>(ptr)->z();
+}
+
+void QQuaternion_GetAxes(void* ptr, void* xAxis, void* yAxis, void* zAxis)
+{
+	static_cast<QQuaternion*>(ptr)->getAxes(static_cast<QVector3D*>(xAxis), static_cast<QVector3D*>(yAxis), static_cast<QVector3D*>(zAxis));
+}
+
+void QQuaternion_GetAxisAndAngle2(void* ptr, void* axis, float angle)
+{
+	static_cast<QQuaternion*>(ptr)->getAxisAndAngle(static_cast<QVector3D*>(axis), &angle);
+}
+
+void QQuaternion_GetAxisAndAngle(void* ptr, float x, float y, float z, float angle)
+{
+	static_cast<QQuaternion*>(ptr)->getAxisAndAngle(&x, &y, &z, &angle);
+}
+
+void QQuaternion_GetEulerAngles(void* ptr, float pitch, float yaw, float roll)
+{
+	static_cast<QQuaternion*>(ptr)->getEulerAngles(&pitch, &yaw, &roll);
+}
+
+void* QRadialGradient_NewQRadialGradient()
+{
+	return new QRadialGradient();
+}
+
+void* QRadialGradient_NewQRadialGradient6(void* center, double centerRadius, void* focalPoint, double focalRadius)
+{
+	return new QRadialGradient(*static_cast<QPointF*>(center), centerRadius, *static_cast<QPointF*>(focalPoint), focalRadius);
+}
+
+void* QRadialGradient_NewQRadialGradient4(void* center, double radius)
+{
+	return new QRadialGradient(*static_cast<QPointF*>(center), radius);
+}
+
+void* QRadialGradient_NewQRadialGradient2(void* center, double radius, void* focalPoint)
+{
+	return new QRadialGradient(*static_cast<QPointF*>(center), radius, *static_cast<QPointF*>(focalPoint));
+}
+
+void* QRadialGradient_NewQRadialGradient7(double cx, double cy, double centerRadius, double fx, double fy, double focalRadius)
+{
+	return new QRadialGradient(cx, cy, centerRadius, fx, fy, focalRadius);
+}
+
+void* QRadialGradient_NewQRadialGradient5(double cx, double cy, double radius)
+{
+	return new QRadialGradient(cx, cy, radius);
+}
+
+void* QRadialGradient_NewQRadialGradient3(double cx, double cy, double radius, double fx, double fy)
+{
+	return new QRadialGradient(cx, cy, radius, fx, fy);
+}
+
+void QRadialGradient_SetCenter(void* ptr, void* center)
+{
+	static_cast<QRadialGradient*>(ptr)->setCenter(*static_cast<QPointF*>(center));
+}
+
+void QRadialGradient_SetCenter2(void* ptr, double x, double y)
+{
+	static_cast<QRadialGradient*>(ptr)->setCenter(x, y);
+}
+
+void QRadialGradient_SetCenterRadius(void* ptr, double radius)
+{
+	static_cast<QRadialGradient*>(ptr)->setCenterRadius(radius);
+}
+
+void QRadialGradient_SetFocalPoint(void* ptr, void* focalPoint)
+{
+	static_cast<QRadialGradient*>(ptr)->setFocalPoint(*static_cast<QPointF*>(focalPoint));
+}
+
+void QRadialGradient_SetFocalPoint2(void* ptr, double x, double y)
+{
+	static_cast<QRadialGradient*>(ptr)->setFocalPoint(x, y);
+}
+
+void QRadialGradient_SetFocalRadius(void* ptr, double radius)
+{
+	static_cast<QRadialGradient*>(ptr)->setFocalRadius(radius);
+}
+
+void QRadialGradient_SetRadius(void* ptr, double radius)
+{
+	static_cast<QRadialGradient*>(ptr)->setRadius(radius);
+}
+
+void* QRadialGradient_Center(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QRadialGradient*>(ptr)->center(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QRadialGradient_FocalPoint(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QRadialGradient*>(ptr)->focalPoint(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+double QRadialGradient_CenterRadius(void* ptr)
+{
+	return static_cast<QRadialGradient*>(ptr)->centerRadius();
+}
+
+double QRadialGradient_FocalRadius(void* ptr)
+{
+	return static_cast<QRadialGradient*>(ptr)->focalRadius();
+}
+
+double QRadialGradient_Radius(void* ptr)
+{
+	return static_cast<QRadialGradient*>(ptr)->radius();
+}
+
+class MyQRasterWindow: public QRasterWindow
+{
+public:
+	MyQRasterWindow(QWindow *parent) : QRasterWindow(parent) {};
+	void paintEvent(QPaintEvent * event) { callbackQPaintDeviceWindow_PaintEvent(this, event); };
+	void update() { callbackQPaintDeviceWindow_Update3(this); };
+	bool close() { return callbackQWindow_Close(this) != 0; };
+	bool event(QEvent * ev) { return callbackQWindow_Event(this, ev) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWindow_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void Signal_ActiveChanged() { callbackQWindow_ActiveChanged(this); };
+	void alert(int msec) { callbackQWindow_Alert(this, msec); };
+	void Signal_ContentOrientationChanged(Qt::ScreenOrientation orientation) { callbackQWindow_ContentOrientationChanged(this, orientation); };
+	void exposeEvent(QExposeEvent * ev) { callbackQWindow_ExposeEvent(this, ev); };
+	void focusInEvent(QFocusEvent * ev) { callbackQWindow_FocusInEvent(this, ev); };
+	void Signal_FocusObjectChanged(QObject * object) { callbackQWindow_FocusObjectChanged(this, object); };
+	void focusOutEvent(QFocusEvent * ev) { callbackQWindow_FocusOutEvent(this, ev); };
+	void Signal_HeightChanged(int arg) { callbackQWindow_HeightChanged(this, arg); };
+	void hide() { callbackQWindow_Hide(this); };
+	void hideEvent(QHideEvent * ev) { callbackQWindow_HideEvent(this, ev); };
+	void keyPressEvent(QKeyEvent * ev) { callbackQWindow_KeyPressEvent(this, ev); };
+	void keyReleaseEvent(QKeyEvent * ev) { callbackQWindow_KeyReleaseEvent(this, ev); };
+	void lower() { callbackQWindow_Lower(this); };
+	void Signal_MaximumHeightChanged(int arg) { callbackQWindow_MaximumHeightChanged(this, arg); };
+	void Signal_MaximumWidthChanged(int arg) { callbackQWindow_MaximumWidthChanged(this, arg); };
+	void Signal_MinimumHeightChanged(int arg) { callbackQWindow_MinimumHeightChanged(this, arg); };
+	void Signal_MinimumWidthChanged(int arg) { callbackQWindow_MinimumWidthChanged(this, arg); };
+	void Signal_ModalityChanged(Qt::WindowModality modality) { callbackQWindow_ModalityChanged(this, modality); };
+	void mouseDoubleClickEvent(QMouseEvent * ev) { callbackQWindow_MouseDoubleClickEvent(this, ev); };
+	void mouseMoveEvent(QMouseEvent * ev) { callbackQWindow_MouseMoveEvent(this, ev); };
+	void mousePressEvent(QMouseEvent * ev) { callbackQWindow_MousePressEvent(this, ev); };
+	void mouseReleaseEvent(QMouseEvent * ev) { callbackQWindow_MouseReleaseEvent(this, ev); };
+	void moveEvent(QMoveEvent * ev) { callbackQWindow_MoveEvent(this, ev); };
+	void Signal_OpacityChanged(qreal opacity) { callbackQWindow_OpacityChanged(this, opacity); };
+	void raise() { callbackQWindow_Raise(this); };
+	void requestActivate() { callbackQWindow_RequestActivate(this); };
+	void requestUpdate() { callbackQWindow_RequestUpdate(this); };
+	void resizeEvent(QResizeEvent * ev) { callbackQWindow_ResizeEvent(this, ev); };
+	void Signal_ScreenChanged(QScreen * screen) { callbackQWindow_ScreenChanged(this, screen); };
+	void setHeight(int arg) { callbackQWindow_SetHeight(this, arg); };
+	void setMaximumHeight(int h) { callbackQWindow_SetMaximumHeight(this, h); };
+	void setMaximumWidth(int w) { callbackQWindow_SetMaximumWidth(this, w); };
+	void setMinimumHeight(int h) { callbackQWindow_SetMinimumHeight(this, h); };
+	void setMinimumWidth(int w) { callbackQWindow_SetMinimumWidth(this, w); };
+	void setTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtGui_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWindow_SetTitle(this, vqsPacked); };
+	void setVisible(bool visible) { callbackQWindow_SetVisible(this, visible); };
+	void setWidth(int arg) { callbackQWindow_SetWidth(this, arg); };
+	void setX(int arg) { callbackQWindow_SetX(this, arg); };
+	void setY(int arg) { callbackQWindow_SetY(this, arg); };
+	void show() { callbackQWindow_Show(this); };
+	void showEvent(QShowEvent * ev) { callbackQWindow_ShowEvent(this, ev); };
+	void showFullScreen() { callbackQWindow_ShowFullScreen(this); };
+	void showMaximized() { callbackQWindow_ShowMaximized(this); };
+	void showMinimized() { callbackQWindow_ShowMinimized(this); };
+	void showNormal() { callbackQWindow_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * ev) { callbackQWindow_TabletEvent(this, ev); };
+	void touchEvent(QTouchEvent * ev) { callbackQWindow_TouchEvent(this, ev); };
+	void Signal_VisibilityChanged(QWindow::Visibility visibility) { callbackQWindow_VisibilityChanged(this, visibility); };
+	void Signal_VisibleChanged(bool arg) { callbackQWindow_VisibleChanged(this, arg); };
+	void wheelEvent(QWheelEvent * ev) { callbackQWindow_WheelEvent(this, ev); };
+	void Signal_WidthChanged(int arg) { callbackQWindow_WidthChanged(this, arg); };
+	void Signal_WindowStateChanged(Qt::WindowState windowState) { callbackQWindow_WindowStateChanged(this, windowState); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtGui_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWindow_WindowTitleChanged(this, titlePacked); };
+	void Signal_XChanged(int arg) { callbackQWindow_XChanged(this, arg); };
+	void Signal_YChanged(int arg) { callbackQWindow_YChanged(this, arg); };
+	QObject * focusObject() const { return static_cast<QObject*>(callbackQWindow_FocusObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize size() const { return *static_cast<QSize*>(callbackQWindow_Size(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSurfaceFormat format() const { return *static_cast<QSurfaceFormat*>(callbackQWindow_Format(const_cast<void*>(static_cast<const void*>(this)))); };
+	SurfaceType surfaceType() const { return static_cast<QSurface::SurfaceType>(callbackQWindow_SurfaceType(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWindow_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWindow_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWindow_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWindow_CustomEvent(this, event); };
+	void deleteLater() { callbackQWindow_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWindow_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWindow_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWindow_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWindow_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWindow_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQPaintDeviceWindow_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	int metric(QPaintDevice::PaintDeviceMetric metric) const { return callbackQPaintDevice_Metric(const_cast<void*>(static_cast<const void*>(this)), metric); };
+};
+
+void* QRasterWindow_NewQRasterWindow(void* parent)
+{
+	return new MyQRasterWindow(static_cast<QWindow*>(parent));
+}
+
+void* QRawFont_QRawFont_FromFont(void* font, long long writingSystem)
+{
+	return new QRawFont(QRawFont::fromFont(*static_cast<QFont*>(font), static_cast<QFontDatabase::WritingSystem>(writingSystem)));
+}
+
+void* QRawFont_NewQRawFont()
+{
+	return new QRawFont();
+}
+
+void* QRawFont_NewQRawFont3(void* fontData, double pixelSize, long long hintingPreference)
+{
+	return new QRawFont(*static_cast<QByteArray*>(fontData), pixelSize, static_cast<QFont::HintingPreference>(hintingPreference));
+}
+
+void* QRawFont_NewQRawFont4(void* other)
+{
+	return new QRawFont(*static_cast<QRawFont*>(other));
+}
+
+void* QRawFont_NewQRawFont2(char* fileName, double pixelSize, long long hintingPreference)
+{
+	return new QRawFont(QString(fileName), pixelSize, static_cast<QFont::HintingPreference>(hintingPreference));
+}
+
+void QRawFont_LoadFromData(void* ptr, void* fontData, double pixelSize, long long hintingPreference)
+{
+	static_cast<QRawFont*>(ptr)->loadFromData(*static_cast<QByteArray*>(fontData), pixelSize, static_cast<QFont::HintingPreference>(hintingPreference));
+}
+
+void QRawFont_LoadFromFile(void* ptr, char* fileName, double pixelSize, long long hintingPreference)
+{
+	static_cast<QRawFont*>(ptr)->loadFromFile(QString(fileName), pixelSize, static_cast<QFont::HintingPreference>(hintingPreference));
+}
+
+void QRawFont_SetPixelSize(void* ptr, double pixelSize)
+{
+	static_cast<QRawFont*>(ptr)->setPixelSize(pixelSize);
+}
+
+void QRawFont_Swap(void* ptr, void* other)
+{
+	static_cast<QRawFont*>(ptr)->swap(*static_cast<QRawFont*>(other));
+}
+
+void QRawFont_DestroyQRawFont(void* ptr)
+{
+	static_cast<QRawFont*>(ptr)->~QRawFont();
+}
+
+void* QRawFont_FontTable(void* ptr, char* tagName)
+{
+	return new QByteArray(static_cast<QRawFont*>(ptr)->fontTable(const_cast<const char*>(tagName)));
+}
+
+long long QRawFont_HintingPreference(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->hintingPreference();
+}
+
+long long QRawFont_Style(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->style();
+}
+
+void* QRawFont_AlphaMapForGlyph(void* ptr, unsigned int glyphIndex, long long antialiasingType, void* transform)
+{
+	return new QImage(static_cast<QRawFont*>(ptr)->alphaMapForGlyph(glyphIndex, static_cast<QRawFont::AntialiasingType>(antialiasingType), *static_cast<QTransform*>(transform)));
+}
+
+struct QtGui_PackedList QRawFont_SupportedWritingSystems(void* ptr)
+{
+	return ({ QList<QFontDatabase::WritingSystem>* tmpValue = new QList<QFontDatabase::WritingSystem>(static_cast<QRawFont*>(ptr)->supportedWritingSystems()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QRawFont_PathForGlyph(void* ptr, unsigned int glyphIndex)
+{
+	return new QPainterPath(static_cast<QRawFont*>(ptr)->pathForGlyph(glyphIndex));
+}
+
+void* QRawFont_BoundingRect(void* ptr, unsigned int glyphIndex)
+{
+	return ({ QRectF tmpValue = static_cast<QRawFont*>(ptr)->boundingRect(glyphIndex); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtGui_PackedString QRawFont_FamilyName(void* ptr)
+{
+	return ({ QByteArray t8c920d = static_cast<QRawFont*>(ptr)->familyName().toUtf8(); QtGui_PackedString { const_cast<char*>(t8c920d.prepend("WHITESPACE").constData()+10), t8c920d.size()-10 }; });
+}
+
+struct QtGui_PackedString QRawFont_StyleName(void* ptr)
+{
+	return ({ QByteArray t6b9c52 = static_cast<QRawFont*>(ptr)->styleName().toUtf8(); QtGui_PackedString { const_cast<char*>(t6b9c52.prepend("WHITESPACE").constData()+10), t6b9c52.size()-10 }; });
+}
+
+struct QtGui_PackedList QRawFont_AdvancesForGlyphIndexes2(void* ptr, void* glyphIndexes)
+{
+	return ({ QVector<QPointF>* tmpValue = new QVector<QPointF>(static_cast<QRawFont*>(ptr)->advancesForGlyphIndexes(*static_cast<QVector<quint32>*>(glyphIndexes))); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtGui_PackedList QRawFont_AdvancesForGlyphIndexes(void* ptr, void* glyphIndexes, long long layoutFlags)
+{
+	return ({ QVector<QPointF>* tmpValue = new QVector<QPointF>(static_cast<QRawFont*>(ptr)->advancesForGlyphIndexes(*static_cast<QVector<quint32>*>(glyphIndexes), static_cast<QRawFont::LayoutFlag>(layoutFlags))); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtGui_PackedList QRawFont_GlyphIndexesForString(void* ptr, char* text)
+{
+	return ({ QVector<quint32>* tmpValue = new QVector<quint32>(static_cast<QRawFont*>(ptr)->glyphIndexesForString(QString(text))); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+char QRawFont_AdvancesForGlyphIndexes3(void* ptr, unsigned int glyphIndexes, void* advances, int numGlyphs)
+{
+	return static_cast<QRawFont*>(ptr)->advancesForGlyphIndexes(const_cast<const quint32*>(&glyphIndexes), static_cast<QPointF*>(advances), numGlyphs);
+}
+
+char QRawFont_AdvancesForGlyphIndexes4(void* ptr, unsigned int glyphIndexes, void* advances, int numGlyphs, long long layoutFlags)
+{
+	return static_cast<QRawFont*>(ptr)->advancesForGlyphIndexes(const_cast<const quint32*>(&glyphIndexes), static_cast<QPointF*>(advances), numGlyphs, static_cast<QRawFont::LayoutFlag>(layoutFlags));
+}
+
+char QRawFont_GlyphIndexesForChars(void* ptr, void* chars, int numChars, unsigned int glyphIndexes, int numGlyphs)
+{
+	return static_cast<QRawFont*>(ptr)->glyphIndexesForChars(static_cast<QChar*>(chars), numChars, &glyphIndexes, &numGlyphs);
+}
+
+char QRawFont_IsValid(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->isValid();
+}
+
+char QRawFont_SupportsCharacter(void* ptr, void* character)
+{
+	return static_cast<QRawFont*>(ptr)->supportsCharacter(*static_cast<QChar*>(character));
+}
+
+char QRawFont_SupportsCharacter2(void* ptr, unsigned int ucs4)
+{
+	return static_cast<QRawFont*>(ptr)->supportsCharacter(ucs4);
+}
+
+int QRawFont_Weight(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->weight();
+}
+
+double QRawFont_Ascent(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->ascent();
+}
+
+double QRawFont_AverageCharWidth(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->averageCharWidth();
+}
+
+double QRawFont_CapHeight(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->capHeight();
+}
+
+double QRawFont_Descent(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->descent();
+}
+
+double QRawFont_Leading(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->leading();
+}
+
+double QRawFont_LineThickness(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->lineThickness();
+}
+
+double QRawFont_MaxCharWidth(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->maxCharWidth();
+}
+
+double QRawFont_PixelSize(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->pixelSize();
+}
+
+double QRawFont_UnderlinePosition(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->underlinePosition();
+}
+
+double QRawFont_UnitsPerEm(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->unitsPerEm();
+}
+
+double QRawFont_XHeight(void* ptr)
+{
+	return static_cast<QRawFont*>(ptr)->xHeight();
+}
+
+long long QRawFont___supportedWritingSystems_atList(void* ptr, int i)
+{
+	return static_cast<QList<QFontDatabase::WritingSystem>*>(ptr)->at(i);
+}
+
+void QRawFont___supportedWritingSystems_setList(void* ptr, long long i)
+{
+	static_cast<QList<QFontDatabase::WritingSystem>*>(ptr)->append(static_cast<QFontDatabase::WritingSystem>(i));
+}
+
+void* QRawFont___supportedWritingSystems_newList(void* ptr)
+{
+	return new QList<QFontDatabase::WritingSystem>;
+}
+
+void* QRawFont___advancesForGlyphIndexes_atList2(void* ptr, int i)
+{
+	return ({ QPointF tmpValue = static_cast<QVector<QPointF>*>(ptr)->at(i); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void QRawFont___advancesForGlyphIndexes_setList2(void* ptr, void* i)
+{
+	static_cast<QVector<QPointF>*>(ptr)->append(*static_cast<QPointF*>(i));
+}
+
+void* QRawFont___advancesForGlyphIndexes_newList2(void* ptr)
+{
+	return new QVector<QPointF>;
+}
+
+void* QRawFont___advancesForGlyphIndexes_newListBuffer2(void* ptr, void* data, int count)
+{
+	return ({ QVector<QPointF>* tmpList = new QVector<QPointF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPointF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QRawFont___advancesForGlyphIndexes_fillList2(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<QPointF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPointF(static_cast<QVector<QPointF>*>(ptr)->at(i));
+}
+
+unsigned int QRawFont___advancesForGlyphIndexes_glyphIndexes_atList2(void* ptr, int i)
+{
+	return static_cast<QVector<quint32>*>(ptr)->at(i);
+}
+
+void QRawFont___advancesForGlyphIndexes_glyphIndexes_setList2(void* ptr, unsigned int i)
+{
+	static_cast<QVector<quint32>*>(ptr)->append(i);
+}
+
+void* QRawFont___advancesForGlyphIndexes_glyphIndexes_newList2(void* ptr)
+{
+	return new QVector<quint32>;
+}
+
+void* QRawFont___advancesForGlyphIndexes_atList(void* ptr, int i)
+{
+	return ({ QPointF tmpValue = static_cast<QVector<QPointF>*>(ptr)->at(i); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void QRawFont___advancesForGlyphIndexes_setList(void* ptr, void* i)
+{
+	static_cast<QVector<QPointF>*>(ptr)->append(*static_cast<QPointF*>(i));
+}
+
+void* QRawFont___advancesForGlyphIndexes_newList(void* ptr)
+{
+	return new QVector<QPointF>;
+}
+
+void* QRawFont___advancesForGlyphIndexes_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<QPointF>* tmpList = new QVector<QPointF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QPointF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QRawFont___advancesForGlyphIndexes_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<QPointF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QPointF(static_cast<QVector<QPointF>*>(ptr)->at(i));
+}
+
+unsigned int QRawFont___advancesForGlyphIndexes_glyphIndexes_atList(void* ptr, int i)
+{
+	return static_cast<QVector<quint32>*>(ptr)->at(i);
+}
+
+void QRawFont___advancesForGlyphIndexes_glyphIndexes_setList(void* ptr, unsigned int i)
+{
+	static_cast<QVector<quint32>*>(ptr)->append(i);
+}
+
+void* QRawFont___advancesForGlyphIndexes_glyphIndexes_newList(void* ptr)
+{
+	return new QVector<quint32>;
+}
+
+unsigned int QRawFont___glyphIndexesForString_atList(void* ptr, int i)
+{
+	return static_cast<QVector<quint32>*>(ptr)->at(i);
+}
+
+void QRawFont___glyphIndexesForString_setList(void* ptr, unsigned int i)
+{
+	static_cast<QVector<quint32>*>(ptr)->append(i);
+}
+
+void* QRawFont___glyphIndexesForString_newList(void* ptr)
+{
+	return new QVector<quint32>;
+}
+
+class MyQRegExpValidator: public QRegExpValidator
+{
+public:
+	MyQRegExpValidator(QObject *parent) : QRegExpValidator(parent) {};
+	MyQRegExpValidator(const QRegExp &rx, QObject *parent) : QRegExpValidator(rx, parent) {};
+	QValidator::State validate(QString & input, int & pos) const { QByteArray t140f86 = input.toUtf8(); QtGui_PackedString inputPacked = { const_cast<char*>(t140f86.prepend("WHITESPACE").constData()+10), t140f86.size()-10 };return static_cast<QValidator::State>(callbackQRegExpValidator_Validate(const_cast<void*>(static_cast<const void*>(this)), inputPacked, pos)); };
+	void Signal_Changed() { callbackQValidator_Changed(this); };
+	void fixup(QString & input) const { QByteArray t140f86 = input.toUtf8(); QtGui_PackedString inputPacked = { const_cast<char*>(t140f86.prepend("WHITESPACE").constData()+10), t140f86.size()-10 };callbackQValidator_Fixup(const_cast<void*>(static_cast<const void*>(this)), inputPacked); };
+	bool event(QEvent * e) { return callbackQValidator_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQValidator_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQValidator_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQValidator_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQValidator_CustomEvent(this, event); };
+	void deleteLater() { callbackQValidator_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQValidator_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQValidator_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQValidator_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQValidator_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQValidator_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QRegExpValidator_NewQRegExpValidator(void* parent)
+{
+	return new MyQRegExpValidator(static_cast<QObject*>(parent));
+}
+
+void* QRegExpValidator_NewQRegExpValidator2(void* rx, void* parent)
+{
+	return new MyQRegExpValidator(*static_cast<QRegExp*>(rx), static_cast<QObject*>(parent));
+}
+
+void QRegExpValidator_SetRegExp(void* ptr, void* rx)
+{
+	static_cast<QRegExpValidator*>(ptr)->setRegExp(*static_cast<QRegExp*>(rx));
+}
+
+void QRegExpValidator_DestroyQRegExpValidator(void* ptr)
+{
+	static_cast<QRegExpValidator*>(ptr)->~QRegExpValidator();
+}
+
+long long QRegExpValidator_Validate(void* ptr, char* input, int pos)
+{
+	return static_cast<QRegExpValidator*>(ptr)->validate(*(new QString(input)), pos);
+}
+
+long long QRegExpValidator_ValidateDefault(void* ptr, char* input, int pos)
+{
+		return static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::validate(*(new QString(input)), pos);
+}
+
+void* QRegExpValidator_RegExp(void* ptr)
+{
+	return const_cast<QRegExp*>(&static_cast<QRegExpValidator*>(ptr)->regExp());
+}
+
+void* QRegion_NewQRegion()
+{
+	return new QRegion();
+}
+
+void* QRegion_NewQRegion6(void* other)
+{
+	return new QRegion(*static_cast<QRegion*>(other));
+}
+
+void* QRegion_NewQRegion7(void* bm)
+{
+	return new QRegion(*static_cast<QBitmap*>(bm));
+}
+
+void* QRegion_NewQRegion4(void* a, long long fillRule)
+{
+	return new QRegion(*static_cast<QPolygon*>(a), static_cast<Qt::FillRule>(fillRule));
+}
+
+void* QRegion_NewQRegion3(void* r, long long t)
+{
+	return new QRegion(*static_cast<QRect*>(r), static_cast<QRegion::RegionType>(t));
+}
+
+void* QRegion_NewQRegion5(void* r)
+{
+	return new QRegion(*static_cast<QRegion*>(r));
+}
+
+void* QRegion_NewQRegion2(int x, int y, int w, int h, long long t)
+{
+	return new QRegion(x, y, w, h, static_cast<QRegion::RegionType>(t));
+}
+
+void QRegion_SetRects(void* ptr, void* rects, int number)
+{
+	static_cast<QRegion*>(ptr)->setRects(static_cast<QRect*>(rects), number);
+}
+
+void QRegion_Swap(void* ptr, void* other)
+{
+	static_cast<QRegion*>(ptr)->swap(*static_cast<QRegion*>(other));
+}
+
+void QRegion_Translate2(void* ptr, void* point)
+{
+	static_cast<QRegion*>(ptr)->translate(*static_cast<QPoint*>(point));
+}
+
+void QRegion_Translate(void* ptr, int dx, int dy)
+{
+	static_cast<QRegion*>(ptr)->translate(dx, dy);
+}
+
+void* QRegion_BoundingRect(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QRegion*>(ptr)->boundingRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QRegion_Intersected2(void* ptr, void* rect)
+{
+	return new QRegion(static_cast<QRegion*>(ptr)->intersected(*static_cast<QRect*>(rect)));
+}
+
+void* QRegion_Intersected(void* ptr, void* r)
+{
+	return new QRegion(static_cast<QRegion*>(ptr)->intersected(*static_cast<QRegion*>(r)));
+}
+
+void* QRegion_Subtracted(void* ptr, void* r)
+{
+	return new QRegion(static_cast<QRegion*>(ptr)->subtracted(*static_cast<QRegion*>(r)));
+}
+
+void* QRegion_Translated2(void* ptr, void* p)
+{
+	return new QRegion(static_cast<QRegion*>(ptr)->translated(*static_cast<QPoint*>(p)));
+}
+
+void* QRegion_Translated(void* ptr, int dx, int dy)
+{
+	return new QRegion(static_cast<QRegion*>(ptr)->translated(dx, dy));
+}
+
+void* QRegion_United2(void* ptr, void* rect)
+{
+	return new QRegion(static_cast<QRegion*>(ptr)->united(*static_cast<QRect*>(rect)));
+}
+
+void* QRegion_United(void* ptr, void* r)
+{
+	return new QRegion(static_cast<QRegion*>(ptr)->united(*static_cast<QRegion*>(r)));
+}
+
+void* QRegion_Xored(void* ptr, void* r)
+{
+	return new QRegion(static_cast<QRegion*>(ptr)->xored(*static_cast<QRegion*>(r)));
+}
+
+struct QtGui_PackedList QRegion_Rects(void* ptr)
+{
+	return ({ QVector<QRect>* tmpValue = new QVector<QRect>(static_cast<QRegion*>(ptr)->rects()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+char QRegion_Contains(void* ptr, void* p)
+{
+	return static_cast<QRegion*>(ptr)->contains(*static_cast<QPoint*>(p));
+}
+
+char QRegion_Contains2(void* ptr, void* r)
+{
+	return static_cast<QRegion*>(ptr)->contains(*static_cast<QRect*>(r));
+}
+
+char QRegion_Intersects2(void* ptr, void* rect)
+{
+	return static_cast<QRegion*>(ptr)->intersects(*static_cast<QRect*>(rect));
+}
+
+char QRegion_Intersects(void* ptr, void* region)
+{
+	return static_cast<QRegion*>(ptr)->intersects(*static_cast<QRegion*>(region));
+}
+
+char QRegion_IsEmpty(void* ptr)
+{
+	return static_cast<QRegion*>(ptr)->isEmpty();
+}
+
+char QRegion_IsNull(void* ptr)
+{
+	return static_cast<QRegion*>(ptr)->isNull();
+}
+
+int QRegion_RectCount(void* ptr)
+{
+	return static_cast<QRegion*>(ptr)->rectCount();
+}
+
+void* QRegion___rects_atList(void* ptr, int i)
+{
+	return ({ QRect tmpValue = static_cast<QVector<QRect>*>(ptr)->at(i); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void QRegion___rects_setList(void* ptr, void* i)
+{
+	static_cast<QVector<QRect>*>(ptr)->append(*static_cast<QRect*>(i));
+}
+
+void* QRegion___rects_newList(void* ptr)
+{
+	return new QVector<QRect>;
+}
+
+void* QRegion___rects_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<QRect>* tmpList = new QVector<QRect>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QRect*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QRegion___rects_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<QRect>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QRect(static_cast<QVector<QRect>*>(ptr)->at(i));
+}
+
+class MyQRegularExpressionValidator: public QRegularExpressionValidator
+{
+public:
+	MyQRegularExpressionValidator(QObject *parent) : QRegularExpressionValidator(parent) {};
+	MyQRegularExpressionValidator(const QRegularExpression &re, QObject *parent) : QRegularExpressionValidator(re, parent) {};
+	void Signal_RegularExpressionChanged(const QRegularExpression & re) { callbackQRegularExpressionValidator_RegularExpressionChanged(this, const_cast<QRegularExpression*>(&re)); };
+	void setRegularExpression(const QRegularExpression & re) { callbackQRegularExpressionValidator_SetRegularExpression(this, const_cast<QRegularExpression*>(&re)); };
+	QValidator::State validate(QString & input, int & pos) const { QByteArray t140f86 = input.toUtf8(); QtGui_PackedString inputPacked = { const_cast<char*>(t140f86.prepend("WHITESPACE").constData()+10), t140f86.size()-10 };return static_cast<QValidator::State>(callbackQRegularExpressionValidator_Validate(const_cast<void*>(static_cast<const void*>(this)), inputPacked, pos)); };
+	void Signal_Changed() { callbackQValidator_Changed(this); };
+	void fixup(QString & input) const { QByteArray t140f86 = input.toUtf8(); QtGui_PackedString inputPacked = { const_cast<char*>(t140f86.prepend("WHITESPACE").constData()+10), t140f86.size()-10 };callbackQValidator_Fixup(const_cast<void*>(static_cast<const void*>(this)), inputPacked); };
+	bool event(QEvent * e) { return callbackQValidator_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQValidator_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQValidator_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQValidator_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQValidator_CustomEvent(this, event); };
+	void deleteLater() { callbackQValidator_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQValidator_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQValidator_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQValidator_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQValidator_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQValidator_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QRegularExpressionValidator_NewQRegularExpressionValidator(void* parent)
+{
+	return new MyQRegularExpressionValidator(static_cast<QObject*>(parent));
+}
+
+void* QRegularExpressionValidator_NewQRegularExpressionValidator2(void* re, void* parent)
+{
+	return new MyQRegularExpressionValidator(*static_cast<QRegularExpression*>(re), static_cast<QObject*>(parent));
+}
+
+void QRegularExpressionValidator_ConnectRegularExpressionChanged(void* ptr)
+{
+	QObject::connect(static_cast<QRegularExpressionValidator*>(ptr), static_cast<void (QRegularExpressionValidator::*)(const QRegularExpression &)>(&QRegularExpressionValidator::regularExpressionChanged), static_cast<MyQRegularExpressionValidator*>(ptr), static_cast<void (MyQRegularExpressionValidator::*)(const QRegularExpression &)>(&MyQRegularExpressionValidator::Signal_RegularExpressionChanged));
+}
+
+void QRegularExpressionValidator_DisconnectRegularExpressionChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QRegularExpressionValidator*>(ptr), static_cast<void (QRegularExpressionValidator::*)(const QRegularExpression &)>(&QRegularExpressionValidator::regularExpressionChanged), static_cast<MyQRegularExpressionValidator*>(ptr), static_cast<void (MyQRegularExpressionValidator::*)(const QRegularExpression &)>(&MyQRegularExpressionValidator::Signal_RegularExpressionChanged));
+}
+
+void QRegularExpressionValidator_RegularExpressionChanged(void* ptr, void* re)
+{
+	static_cast<QRegularExpressionValidator*>(ptr)->regularExpressionChanged(*static_cast<QRegularExpression*>(re));
+}
+
+void QRegularExpressionValidator_SetRegularExpression(void* ptr, void* re)
+{
+	QMetaObject::invokeMethod(static_cast<QRegularExpressionValidator*>(ptr), "setRegularExpression", Q_ARG(QRegularExpression, *static_cast<QRegularExpression*>(re)));
+}
+
+void QRegularExpressionValidator_SetRegularExpressionDefault(void* ptr, void* re)
+{
+		static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::setRegularExpression(*static_cast<QRegularExpression*>(re));
+}
+
+void QRegularExpressionValidator_DestroyQRegularExpressionValidator(void* ptr)
+{
+	static_cast<QRegularExpressionValidator*>(ptr)->~QRegularExpressionValidator();
+}
+
+void* QRegularExpressionValidator_RegularExpression(void* ptr)
+{
+	return new QRegularExpression(static_cast<QRegularExpressionValidator*>(ptr)->regularExpression());
+}
+
+long long QRegularExpressionValidator_Validate(void* ptr, char* input, int pos)
+{
+	return static_cast<QRegularExpressionValidator*>(ptr)->validate(*(new QString(input)), pos);
+}
+
+long long QRegularExpressionValidator_ValidateDefault(void* ptr, char* input, int pos)
+{
+		return static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::validate(*(new QString(input)), pos);
+}
+
+class MyQResizeEvent: public QResizeEvent
+{
+public:
+	MyQResizeEvent(const QSize &size, const QSize &oldSize) : QResizeEvent(size, oldSize) {};
+};
+
+void* QResizeEvent_NewQResizeEvent(void* size, void* oldSize)
+{
+	return new MyQResizeEvent(*static_cast<QSize*>(size), *static_cast<QSize*>(oldSize));
+}
+
+void* QResizeEvent_OldSize(void* ptr)
+{
+	return const_cast<QSize*>(&static_cast<QResizeEvent*>(ptr)->oldSize());
+}
+
+void* QResizeEvent_Size(void* ptr)
+{
+	return const_cast<QSize*>(&static_cast<QResizeEvent*>(ptr)->size());
+}
+
+void QRgba64_SetAlpha(void* ptr, unsigned short alpha)
+{
+	static_cast<QRgba64*>(ptr)->setAlpha(alpha);
+}
+
+void QRgba64_SetBlue(void* ptr, unsigned short blue)
+{
+	static_cast<QRgba64*>(ptr)->setBlue(blue);
+}
+
+void QRgba64_SetGreen(void* ptr, unsigned short green)
+{
+	static_cast<QRgba64*>(ptr)->setGreen(green);
+}
+
+void QRgba64_SetRed(void* ptr, unsigned short red)
+{
+	static_cast<QRgba64*>(ptr)->setRed(red);
+}
+
+char QRgba64_IsOpaque(void* ptr)
+{
+	return static_cast<QRgba64*>(ptr)->isOpaque();
+}
+
+char QRgba64_IsTransparent(void* ptr)
+{
+	return static_cast<QRgba64*>(ptr)->isTransparent();
+}
+
+unsigned short QRgba64_Alpha(void* ptr)
+{
+	return static_cast<QRgba64*>(ptr)->alpha();
+}
+
+unsigned short QRgba64_Blue(void* ptr)
+{
+	return static_cast<QRgba64*>(ptr)->blue();
+}
+
+unsigned short QRgba64_Green(void* ptr)
+{
+	return static_cast<QRgba64*>(ptr)->green();
+}
+
+unsigned short QRgba64_Red(void* ptr)
+{
+	return static_cast<QRgba64*>(ptr)->red();
+}
+
+struct QtGui_PackedString QRgba64_Alpha8(void* ptr)
+{
+	return ({ quint8 pret13de7c = static_cast<QRgba64*>(ptr)->alpha8(); char* t13de7c = static_cast<char*>(static_cast<void*>(&pret13de7c)); QtGui_PackedString { t13de7c, -1 }; });
+}
+
+struct QtGui_PackedString QRgba64_Blue8(void* ptr)
+{
+	return ({ quint8 pret2116e7 = static_cast<QRgba64*>(ptr)->blue8(); char* t2116e7 = static_cast<char*>(static_cast<void*>(&pret2116e7)); QtGui_PackedString { t2116e7, -1 }; });
+}
+
+struct QtGui_PackedString QRgba64_Green8(void* ptr)
+{
+	return ({ quint8 pret72b7b3 = static_cast<QRgba64*>(ptr)->green8(); char* t72b7b3 = static_cast<char*>(static_cast<void*>(&pret72b7b3)); QtGui_PackedString { t72b7b3, -1 }; });
+}
+
+struct QtGui_PackedString QRgba64_Red8(void* ptr)
+{
+	return ({ quint8 pretd7bc71 = static_cast<QRgba64*>(ptr)->red8(); char* td7bc71 = static_cast<char*>(static_cast<void*>(&pretd7bc71)); QtGui_PackedString { td7bc71, -1 }; });
+}
+
+unsigned int QRgba64_ToArgb32(void* ptr)
+{
+	return static_cast<QRgba64*>(ptr)->toArgb32();
+}
+
+unsigned short QRgba64_ToRgb16(void* ptr)
+{
+	return static_cast<QRgba64*>(ptr)->toRgb16();
+}
+
+class MyQScreen: public QScreen
+{
+public:
+	void Signal_AvailableGeometryChanged(const QRect & geometry) { callbackQScreen_AvailableGeometryChanged(this, const_cast<QRect*>(&geometry)); };
+	void Signal_GeometryChanged(const QRect & geometry) { callbackQScreen_GeometryChanged(this, const_cast<QRect*>(&geometry)); };
+	void Signal_LogicalDotsPerInchChanged(qreal dpi) { callbackQScreen_LogicalDotsPerInchChanged(this, dpi); };
+	void Signal_OrientationChanged(Qt::ScreenOrientation orientation) { callbackQScreen_OrientationChanged(this, orientation); };
+	void Signal_PhysicalDotsPerInchChanged(qreal dpi) { callbackQScreen_PhysicalDotsPerInchChanged(this, dpi); };
+	void Signal_PhysicalSizeChanged(const QSizeF & size) { callbackQScreen_PhysicalSizeChanged(this, const_cast<QSizeF*>(&size)); };
+	void Signal_PrimaryOrientationChanged(Qt::ScreenOrientation orientation) { callbackQScreen_PrimaryOrientationChanged(this, orientation); };
+	void Signal_RefreshRateChanged(qreal refreshRate) { callbackQScreen_RefreshRateChanged(this, refreshRate); };
+	void Signal_VirtualGeometryChanged(const QRect & rect) { callbackQScreen_VirtualGeometryChanged(this, const_cast<QRect*>(&rect)); };
+	bool event(QEvent * e) { return callbackQScreen_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQScreen_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQScreen_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQScreen_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQScreen_CustomEvent(this, event); };
+	void deleteLater() { callbackQScreen_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQScreen_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQScreen_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQScreen_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQScreen_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQScreen_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QScreen_GrabWindow(void* ptr, uintptr_t window, int x, int y, int width, int height)
+{
+	return new QPixmap(static_cast<QScreen*>(ptr)->grabWindow(window, x, y, width, height));
+}
+
+void QScreen_ConnectAvailableGeometryChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(const QRect &)>(&QScreen::availableGeometryChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(const QRect &)>(&MyQScreen::Signal_AvailableGeometryChanged));
+}
+
+void QScreen_DisconnectAvailableGeometryChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(const QRect &)>(&QScreen::availableGeometryChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(const QRect &)>(&MyQScreen::Signal_AvailableGeometryChanged));
+}
+
+void QScreen_AvailableGeometryChanged(void* ptr, void* geometry)
+{
+	static_cast<QScreen*>(ptr)->availableGeometryChanged(*static_cast<QRect*>(geometry));
+}
+
+void QScreen_ConnectGeometryChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(const QRect &)>(&QScreen::geometryChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(const QRect &)>(&MyQScreen::Signal_GeometryChanged));
+}
+
+void QScreen_DisconnectGeometryChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(const QRect &)>(&QScreen::geometryChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(const QRect &)>(&MyQScreen::Signal_GeometryChanged));
+}
+
+void QScreen_GeometryChanged(void* ptr, void* geometry)
+{
+	static_cast<QScreen*>(ptr)->geometryChanged(*static_cast<QRect*>(geometry));
+}
+
+void QScreen_ConnectLogicalDotsPerInchChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(qreal)>(&QScreen::logicalDotsPerInchChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(qreal)>(&MyQScreen::Signal_LogicalDotsPerInchChanged));
+}
+
+void QScreen_DisconnectLogicalDotsPerInchChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(qreal)>(&QScreen::logicalDotsPerInchChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(qreal)>(&MyQScreen::Signal_LogicalDotsPerInchChanged));
+}
+
+void QScreen_LogicalDotsPerInchChanged(void* ptr, double dpi)
+{
+	static_cast<QScreen*>(ptr)->logicalDotsPerInchChanged(dpi);
+}
+
+void QScreen_ConnectOrientationChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(Qt::ScreenOrientation)>(&QScreen::orientationChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(Qt::ScreenOrientation)>(&MyQScreen::Signal_OrientationChanged));
+}
+
+void QScreen_DisconnectOrientationChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(Qt::ScreenOrientation)>(&QScreen::orientationChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(Qt::ScreenOrientation)>(&MyQScreen::Signal_OrientationChanged));
+}
+
+void QScreen_OrientationChanged(void* ptr, long long orientation)
+{
+	static_cast<QScreen*>(ptr)->orientationChanged(static_cast<Qt::ScreenOrientation>(orientation));
+}
+
+void QScreen_ConnectPhysicalDotsPerInchChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(qreal)>(&QScreen::physicalDotsPerInchChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(qreal)>(&MyQScreen::Signal_PhysicalDotsPerInchChanged));
+}
+
+void QScreen_DisconnectPhysicalDotsPerInchChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(qreal)>(&QScreen::physicalDotsPerInchChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(qreal)>(&MyQScreen::Signal_PhysicalDotsPerInchChanged));
+}
+
+void QScreen_PhysicalDotsPerInchChanged(void* ptr, double dpi)
+{
+	static_cast<QScreen*>(ptr)->physicalDotsPerInchChanged(dpi);
+}
+
+void QScreen_ConnectPhysicalSizeChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(const QSizeF &)>(&QScreen::physicalSizeChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(const QSizeF &)>(&MyQScreen::Signal_PhysicalSizeChanged));
+}
+
+void QScreen_DisconnectPhysicalSizeChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(const QSizeF &)>(&QScreen::physicalSizeChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(const QSizeF &)>(&MyQScreen::Signal_PhysicalSizeChanged));
+}
+
+void QScreen_PhysicalSizeChanged(void* ptr, void* size)
+{
+	static_cast<QScreen*>(ptr)->physicalSizeChanged(*static_cast<QSizeF*>(size));
+}
+
+void QScreen_ConnectPrimaryOrientationChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(Qt::ScreenOrientation)>(&QScreen::primaryOrientationChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(Qt::ScreenOrientation)>(&MyQScreen::Signal_PrimaryOrientationChanged));
+}
+
+void QScreen_DisconnectPrimaryOrientationChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(Qt::ScreenOrientation)>(&QScreen::primaryOrientationChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(Qt::ScreenOrientation)>(&MyQScreen::Signal_PrimaryOrientationChanged));
+}
+
+void QScreen_PrimaryOrientationChanged(void* ptr, long long orientation)
+{
+	static_cast<QScreen*>(ptr)->primaryOrientationChanged(static_cast<Qt::ScreenOrientation>(orientation));
+}
+
+void QScreen_ConnectRefreshRateChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(qreal)>(&QScreen::refreshRateChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(qreal)>(&MyQScreen::Signal_RefreshRateChanged));
+}
+
+void QScreen_DisconnectRefreshRateChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(qreal)>(&QScreen::refreshRateChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(qreal)>(&MyQScreen::Signal_RefreshRateChanged));
+}
+
+void QScreen_RefreshRateChanged(void* ptr, double refreshRate)
+{
+	static_cast<QScreen*>(ptr)->refreshRateChanged(refreshRate);
+}
+
+void QScreen_SetOrientationUpdateMask(void* ptr, long long mask)
+{
+	static_cast<QScreen*>(ptr)->setOrientationUpdateMask(static_cast<Qt::ScreenOrientation>(mask));
+}
+
+void QScreen_ConnectVirtualGeometryChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(const QRect &)>(&QScreen::virtualGeometryChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(const QRect &)>(&MyQScreen::Signal_VirtualGeometryChanged));
+}
+
+void QScreen_DisconnectVirtualGeometryChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScreen*>(ptr), static_cast<void (QScreen::*)(const QRect &)>(&QScreen::virtualGeometryChanged), static_cast<MyQScreen*>(ptr), static_cast<void (MyQScreen::*)(const QRect &)>(&MyQScreen::Signal_VirtualGeometryChanged));
+}
+
+void QScreen_VirtualGeometryChanged(void* ptr, void* rect)
+{
+	static_cast<QScreen*>(ptr)->virtualGeometryChanged(*static_cast<QRect*>(rect));
+}
+
+void QScreen_DestroyQScreen(void* ptr)
+{
+	static_cast<QScreen*>(ptr)->~QScreen();
+}
+
+struct QtGui_PackedList QScreen_VirtualSiblings(void* ptr)
+{
+	return ({ QList<QScreen *>* tmpValue = new QList<QScreen *>(static_cast<QScreen*>(ptr)->virtualSiblings()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QScreen_AvailableGeometry(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QScreen*>(ptr)->availableGeometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScreen_AvailableVirtualGeometry(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QScreen*>(ptr)->availableVirtualGeometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScreen_Geometry(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QScreen*>(ptr)->geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScreen_MapBetween(void* ptr, long long a, long long b, void* rect)
+{
+	return ({ QRect tmpValue = static_cast<QScreen*>(ptr)->mapBetween(static_cast<Qt::ScreenOrientation>(a), static_cast<Qt::ScreenOrientation>(b), *static_cast<QRect*>(rect)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScreen_VirtualGeometry(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QScreen*>(ptr)->virtualGeometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScreen_AvailableSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QScreen*>(ptr)->availableSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScreen_AvailableVirtualSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QScreen*>(ptr)->availableVirtualSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScreen_Size(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QScreen*>(ptr)->size(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScreen_VirtualSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QScreen*>(ptr)->virtualSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScreen_PhysicalSize(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QScreen*>(ptr)->physicalSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtGui_PackedString QScreen_Name(void* ptr)
+{
+	return ({ QByteArray tc60f02 = static_cast<QScreen*>(ptr)->name().toUtf8(); QtGui_PackedString { const_cast<char*>(tc60f02.prepend("WHITESPACE").constData()+10), tc60f02.size()-10 }; });
+}
+
+void* QScreen_TransformBetween(void* ptr, long long a, long long b, void* target)
+{
+	return new QTransform(static_cast<QScreen*>(ptr)->transformBetween(static_cast<Qt::ScreenOrientation>(a), static_cast<Qt::ScreenOrientation>(b), *static_cast<QRect*>(target)));
+}
+
+long long QScreen_NativeOrientation(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->nativeOrientation();
+}
+
+long long QScreen_Orientation(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->orientation();
+}
+
+long long QScreen_PrimaryOrientation(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->primaryOrientation();
+}
+
+long long QScreen_OrientationUpdateMask(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->orientationUpdateMask();
+}
+
+char QScreen_IsLandscape(void* ptr, long long o)
+{
+	return static_cast<QScreen*>(ptr)->isLandscape(static_cast<Qt::ScreenOrientation>(o));
+}
+
+char QScreen_IsPortrait(void* ptr, long long o)
+{
+	return static_cast<QScreen*>(ptr)->isPortrait(static_cast<Qt::ScreenOrientation>(o));
+}
+
+int QScreen_AngleBetween(void* ptr, long long a, long long b)
+{
+	return static_cast<QScreen*>(ptr)->angleBetween(static_cast<Qt::ScreenOrientation>(a), static_cast<Qt::ScreenOrientation>(b));
+}
+
+int QScreen_Depth(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->depth();
+}
+
+double QScreen_DevicePixelRatio(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->devicePixelRatio();
+}
+
+double QScreen_LogicalDotsPerInch(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->logicalDotsPerInch();
+}
+
+double QScreen_LogicalDotsPerInchX(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->logicalDotsPerInchX();
+}
+
+double QScreen_LogicalDotsPerInchY(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->logicalDotsPerInchY();
+}
+
+double QScreen_PhysicalDotsPerInch(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->physicalDotsPerInch();
+}
+
+double QScreen_PhysicalDotsPerInchX(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->physicalDotsPerInchX();
+}
+
+double QScreen_PhysicalDotsPerInchY(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->physicalDotsPerInchY();
+}
+
+double QScreen_RefreshRate(void* ptr)
+{
+	return static_cast<QScreen*>(ptr)->refreshRate();
+}
+
+void* QScreen___virtualSiblings_atList(void* ptr, int i)
+{
+	return const_cast<QScreen*>(static_cast<QList<QScreen *>*>(ptr)->at(i));
+}
+
+void QScreen___virtualSiblings_setList(void* ptr, void* i)
+{
+	static_cast<QList<QScreen *>*>(ptr)->append(static_cast<QScreen*>(i));
+}
+
+void* QScreen___virtualSiblings_newList(void* ptr)
+{
+	return new QList<QScreen *>;
+}
+
+void* QScreen___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QScreen___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QScreen___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QScreen___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QScreen___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QScreen___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QScreen___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QScreen___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QScreen___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QScreen___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QScreen___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QScreen___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QScreen___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QScreen___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QScreen___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QScreen_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QScreen*>(ptr)->QScreen::event(static_cast<QEvent*>(e));
+}
+
+char QScreen_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+		return static_cast<QScreen*>(ptr)->QScreen::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QScreen*>(ptr)->QScreen::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+		return static_cast<QScreen*>(ptr)->QScreen::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QScreen*>(ptr)->QScreen::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QScreen*>(ptr)->QScreen::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QScreen_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QScreen*>(ptr)->QScreen::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QScreen_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QScreen*>(ptr)->QScreen::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QScreen_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QScreen*>(ptr)->QScreen::customEvent(static_cast<QEvent*>(event));
+}
+
+void QScreen_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QScreen*>(ptr)->QScreen::deleteLater();
+}
+
+void QScreen_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QScreen*>(ptr)->QScreen::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QScreen_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QScreen*>(ptr)->QScreen::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QScreen_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QScreen*>(ptr)->QScreen::metaObject());
+}
+
+class MyQScrollEvent: public QScrollEvent
+{
+public:
+	MyQScrollEvent(const QPointF &contentPos, const QPointF &overshootDistance, ScrollState scrollState) : QScrollEvent(contentPos, overshootDistance, scrollState) {};
+};
+
+void* QScrollEvent_NewQScrollEvent(void* contentPos, void* overshootDistance, long long scrollState)
+{
+	return new MyQScrollEvent(*static_cast<QPointF*>(contentPos), *static_cast<QPointF*>(overshootDistance), static_cast<QScrollEvent::ScrollState>(scrollState));
+}
+
+void QScrollEvent_DestroyQScrollEvent(void* ptr)
+{
+	static_cast<QScrollEvent*>(ptr)->~QScrollEvent();
+}
+
+void* QScrollEvent_ContentPos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QScrollEvent*>(ptr)->contentPos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QScrollEvent_OvershootDistance(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QScrollEvent*>(ptr)->overshootDistance(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+long long QScrollEvent_ScrollState(void* ptr)
+{
+	return static_cast<QScrollEvent*>(ptr)->scrollState();
+}
+
+class MyQScrollPrepareEvent: public QScrollPrepareEvent
+{
+public:
+	MyQScrollPrepareEvent(const QPointF &startPos) : QScrollPrepareEvent(startPos) {};
+};
+
+void* QScrollPrepareEvent_NewQScrollPrepareEvent(void* startPos)
+{
+	return new MyQScrollPrepareEvent(*static_cast<QPointF*>(startPos));
+}
+
+void QScrollPrepareEvent_SetContentPos(void* ptr, void* pos)
+{
+	static_cast<QScrollPrepareEvent*>(ptr)->setContentPos(*static_cast<QPointF*>(pos));
+}
+
+void QScrollPrepareEvent_SetContentPosRange(void* ptr, void* rect)
+{
+	static_cast<QScrollPrepareEvent*>(ptr)->setContentPosRange(*static_cast<QRectF*>(rect));
+}
+
+void QScrollPrepareEvent_SetViewportSize(void* ptr, void* size)
+{
+	static_cast<QScrollPrepareEvent*>(ptr)->setViewportSize(*static_cast<QSizeF*>(size));
+}
+
+void QScrollPrepareEvent_DestroyQScrollPrepareEvent(void* ptr)
+{
+	static_cast<QScrollPrepareEvent*>(ptr)->~QScrollPrepareEvent();
+}
+
+void* QScrollPrepareEvent_ContentPos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QScrollPrepareEvent*>(ptr)->contentPos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QScrollPrepareEvent_StartPos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QScrollPrepareEvent*>(ptr)->startPos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QScrollPrepareEvent_ContentPosRange(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QScrollPrepareEvent*>(ptr)->contentPosRange(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QScrollPrepareEvent_ViewportSize(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QScrollPrepareEvent*>(ptr)->viewportSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+class MyQSessionManager: public QSessionManager
+{
+public:
+	bool event(QEvent * e) { return callbackQSessionManager_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQSessionManager_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQSessionManager_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQSessionManager_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQSessionManager_CustomEvent(this, event); };
+	void deleteLater() { callbackQSessionManager_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQSessionManager_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQSessionManager_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQSessionManager_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQSessionManager_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQSessionManager_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+char QSessionManager_AllowsErrorInteraction(void* ptr)
+{
+	return static_cast<QSessionManager*>(ptr)->allowsErrorInteraction();
+}
+
+char QSessionManager_AllowsInteraction(void* ptr)
+{
+	return static_cast<QSessionManager*>(ptr)->allowsInteraction();
+}
+
+void QSessionManager_Cancel(void* ptr)
+{
+	static_cast<QSessionManager*>(ptr)->cancel();
+}
+
+void QSessionManager_Release(void* ptr)
+{
+	static_cast<QSessionManager*>(ptr)->release();
+}
+
+void QSessionManager_RequestPhase2(void* ptr)
+{
+	static_cast<QSessionManager*>(ptr)->requestPhase2();
+}
+
+void QSessionManager_SetDiscardCommand(void* ptr, char* command)
+{
+	static_cast<QSessionManager*>(ptr)->setDiscardCommand(goUnpackStringList(command));
+}
+
+void QSessionManager_SetManagerProperty2(void* ptr, char* name, char* value)
+{
+	static_cast<QSessionManager*>(ptr)->setManagerProperty(QString(name), QString(value));
+}
+
+void QSessionManager_SetManagerProperty(void* ptr, char* name, char* value)
+{
+	static_cast<QSessionManager*>(ptr)->setManagerProperty(QString(name), goUnpackStringList(value));
+}
+
+void QSessionManager_SetRestartCommand(void* ptr, char* command)
+{
+	static_cast<QSessionManager*>(ptr)->setRestartCommand(goUnpackStringList(command));
+}
+
+void QSessionManager_SetRestartHint(void* ptr, long long hint)
+{
+	static_cast<QSessionManager*>(ptr)->setRestartHint(static_cast<QSessionManager::RestartHint>(hint));
+}
+
+struct QtGui_PackedString QSessionManager_SessionId(void* ptr)
+{
+	return ({ QByteArray t8eaf8d = static_cast<QSessionManager*>(ptr)->sessionId().toUtf8(); QtGui_PackedString { const_cast<char*>(t8eaf8d.prepend("WHITESPACE").constData()+10), t8eaf8d.size()-10 }; });
+}
+
+struct QtGui_PackedString QSessionManager_SessionKey(void* ptr)
+{
+	return ({ QByteArray tb1e419 = static_cast<QSessionManager*>(ptr)->sessionKey().toUtf8(); QtGui_PackedString { const_cast<char*>(tb1e419.prepend("WHITESPACE").constData()+10), tb1e419.size()-10 }; });
+}
+
+struct QtGui_PackedString QSessionManager_DiscardCommand(void* ptr)
+{
+	return ({ long long t7ed2e8len; char* t7ed2e8 = goPackStringList(static_cast<QSessionManager*>(ptr)->discardCommand(), &t7ed2e8len); QtGui_PackedString { t7ed2e8, t7ed2e8len }; });
+}
+
+struct QtGui_PackedString QSessionManager_RestartCommand(void* ptr)
+{
+	return ({ long long t8b3c52len; char* t8b3c52 = goPackStringList(static_cast<QSessionManager*>(ptr)->restartCommand(), &t8b3c52len); QtGui_PackedString { t8b3c52, t8b3c52len }; });
+}
+
+long long QSessionManager_RestartHint(void* ptr)
+{
+	return static_cast<QSessionManager*>(ptr)->restartHint();
+}
+
+char QSessionManager_IsPhase2(void* ptr)
+{
+	return static_cast<QSessionManager*>(ptr)->isPhase2();
+}
+
+void* QSessionManager___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QSessionManager___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QSessionManager___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QSessionManager___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QSessionManager___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QSessionManager___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QSessionManager___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QSessionManager___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QSessionManager___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QSessionManager___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QSessionManager___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QSessionManager___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QSessionManager___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QSessionManager___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QSessionManager___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QSessionManager_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QSessionManager*>(ptr)->QSessionManager::event(static_cast<QEvent*>(e));
+}
+
+char QSessionManager_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+		return static_cast<QSessionManager*>(ptr)->QSessionManager::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QSessionManager*>(ptr)->QSessionManager::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+		return static_cast<QSessionManager*>(ptr)->QSessionManager::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QSessionManager*>(ptr)->QSessionManager::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QSessionManager*>(ptr)->QSessionManager::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QSessionManager_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QSessionManager*>(ptr)->QSessionManager::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QSessionManager_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QSessionManager*>(ptr)->QSessionManager::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QSessionManager_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QSessionManager*>(ptr)->QSessionManager::customEvent(static_cast<QEvent*>(event));
+}
+
+void QSessionManager_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QSessionManager*>(ptr)->QSessionManager::deleteLater();
+}
+
+void QSessionManager_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QSessionManager*>(ptr)->QSessionManager::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QSessionManager_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QSessionManager*>(ptr)->QSessionManager::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QSessionManager_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QSessionManager*>(ptr)->QSessionManager::metaObject());
+}
+
+class MyQShortcutEvent: public QShortcutEvent
+{
+public:
+	MyQShortcutEvent(const QKeySequence &key, int id, bool ambiguous) : QShortcutEvent(key, id, ambiguous) {};
+};
+
+void* QShortcutEvent_NewQShortcutEvent(void* key, int id, char ambiguous)
+{
+	return new MyQShortcutEvent(*static_cast<QKeySequence*>(key), id, ambiguous != 0);
+}
+
+void QShortcutEvent_DestroyQShortcutEvent(void* ptr)
+{
+	static_cast<QShortcutEvent*>(ptr)->~QShortcutEvent();
+}
+
+char QShortcutEvent_IsAmbiguous(void* ptr)
+{
+	return static_cast<QShortcutEvent*>(ptr)->isAmbiguous();
+}
+
+void* QShortcutEvent_Key(void* ptr)
+{
+	return const_cast<QKeySequence*>(&static_cast<QShortcutEvent*>(ptr)->key());
+}
+
+int QShortcutEvent_ShortcutId(void* ptr)
+{
+	return static_cast<QShortcutEvent*>(ptr)->shortcutId();
+}
+
+char QShortcutEvent_Ambig(void* ptr)
+{
+	return static_cast<QShortcutEvent*>(ptr)->ambig;
+}
+
+void QShortcutEvent_SetAmbig(void* ptr, char vbo)
+{
+	static_cast<QShortcutEvent*>(ptr)->ambig = vbo != 0;
+}
+
+void* QShortcutEvent_Sequence(void* ptr)
+{
+	return new QKeySequence(static_cast<QShortcutEvent*>(ptr)->sequence);
+}
+
+void QShortcutEvent_SetSequence(void* ptr, void* vqk)
+{
+	static_cast<QShortcutEvent*>(ptr)->sequence = *static_cast<QKeySequence*>(vqk);
+}
+
+int QShortcutEvent_Sid(void* ptr)
+{
+	return static_cast<QShortcutEvent*>(ptr)->sid;
+}
+
+void QShortcutEvent_SetSid(void* ptr, int vin)
+{
+	static_cast<QShortcutEvent*>(ptr)->sid = vin;
+}
+
+class MyQShowEvent: public QShowEvent
+{
+public:
+	MyQShowEvent() : QShowEvent() {};
+};
+
+void* QShowEvent_NewQShowEvent()
+{
+	return new MyQShowEvent();
+}
+
+class MyQStandardItem: public QStandardItem
+{
+public:
+	MyQStandardItem() : QStandardItem() {};
+	MyQStandardItem(const QIcon &icon, const QString &text) : QStandardItem(icon, text) {};
+	MyQStandardItem(const QStandardItem &other) : QStandardItem(other) {};
+	MyQStandardItem(const QString &text) : QStandardItem(text) {};
+	MyQStandardItem(int rows, int columns) : QStandardItem(rows, columns) {};
+	void read(QDataStream & in) { callbackQStandardItem_Read(this, static_cast<QDataStream*>(&in)); };
+	void setData(const QVariant & value, int role) { callbackQStandardItem_SetData(this, const_cast<QVariant*>(&value), role); };
+	 ~MyQStandardItem() { callbackQStandardItem_DestroyQStandardItem(this); };
+	QStandardItem * clone() const { return static_cast<QStandardItem*>(callbackQStandardItem_Clone(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant data(int role) const { return *static_cast<QVariant*>(callbackQStandardItem_Data(const_cast<void*>(static_cast<const void*>(this)), role)); };
+	int type() const { return callbackQStandardItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	void write(QDataStream & out) const { callbackQStandardItem_Write(const_cast<void*>(static_cast<const void*>(this)), static_cast<QDataStream*>(&out)); };
+};
+
+struct QtGui_PackedList QStandardItem_TakeColumn(void* ptr, int column)
+{
+	return ({ QList<QStandardItem *>* tmpValue = new QList<QStandardItem *>(static_cast<QStandardItem*>(ptr)->takeColumn(column)); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtGui_PackedList QStandardItem_TakeRow(void* ptr, int row)
+{
+	return ({ QList<QStandardItem *>* tmpValue = new QList<QStandardItem *>(static_cast<QStandardItem*>(ptr)->takeRow(row)); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStandardItem_TakeChild(void* ptr, int row, int column)
+{
+	return static_cast<QStandardItem*>(ptr)->takeChild(row, column);
+}
+
+void* QStandardItem_NewQStandardItem()
+{
+	return new MyQStandardItem();
+}
+
+void* QStandardItem_NewQStandardItem3(void* icon, char* text)
+{
+	return new MyQStandardItem(*static_cast<QIcon*>(icon), QString(text));
+}
+
+void* QStandardItem_NewQStandardItem5(void* other)
+{
+	return new MyQStandardItem(*static_cast<QStandardItem*>(other));
+}
+
+void* QStandardItem_NewQStandardItem2(char* text)
+{
+	return new MyQStandardItem(QString(text));
+}
+
+void* QStandardItem_NewQStandardItem4(int rows, int columns)
+{
+	return new MyQStandardItem(rows, columns);
+}
+
+void QStandardItem_AppendColumn(void* ptr, void* items)
+{
+	static_cast<QStandardItem*>(ptr)->appendColumn(*static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItem_AppendRow2(void* ptr, void* item)
+{
+	static_cast<QStandardItem*>(ptr)->appendRow(static_cast<QStandardItem*>(item));
+}
+
+void QStandardItem_AppendRow(void* ptr, void* items)
+{
+	static_cast<QStandardItem*>(ptr)->appendRow(*static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItem_AppendRows(void* ptr, void* items)
+{
+	static_cast<QStandardItem*>(ptr)->appendRows(*static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItem_EmitDataChanged(void* ptr)
+{
+	static_cast<QStandardItem*>(ptr)->emitDataChanged();
+}
+
+void QStandardItem_InsertColumn(void* ptr, int column, void* items)
+{
+	static_cast<QStandardItem*>(ptr)->insertColumn(column, *static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItem_InsertColumns(void* ptr, int column, int count)
+{
+	static_cast<QStandardItem*>(ptr)->insertColumns(column, count);
+}
+
+void QStandardItem_InsertRow2(void* ptr, int row, void* item)
+{
+	static_cast<QStandardItem*>(ptr)->insertRow(row, static_cast<QStandardItem*>(item));
+}
+
+void QStandardItem_InsertRow(void* ptr, int row, void* items)
+{
+	static_cast<QStandardItem*>(ptr)->insertRow(row, *static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItem_InsertRows(void* ptr, int row, void* items)
+{
+	static_cast<QStandardItem*>(ptr)->insertRows(row, *static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItem_InsertRows2(void* ptr, int row, int count)
+{
+	static_cast<QStandardItem*>(ptr)->insertRows(row, count);
+}
+
+void QStandardItem_Read(void* ptr, void* in)
+{
+	static_cast<QStandardItem*>(ptr)->read(*static_cast<QDataStream*>(in));
+}
+
+void QStandardItem_ReadDefault(void* ptr, void* in)
+{
+		static_cast<QStandardItem*>(ptr)->QStandardItem::read(*static_cast<QDataStream*>(in));
+}
+
+void QStandardItem_RemoveColumn(void* ptr, int column)
+{
+	static_cast<QStandardItem*>(ptr)->removeColumn(column);
+}
+
+void QStandardItem_RemoveColumns(void* ptr, int column, int count)
+{
+	static_cast<QStandardItem*>(ptr)->removeColumns(column, count);
+}
+
+void QStandardItem_RemoveRow(void* ptr, int row)
+{
+	static_cast<QStandardItem*>(ptr)->removeRow(row);
+}
+
+void QStandardItem_RemoveRows(void* ptr, int row, int count)
+{
+	static_cast<QStandardItem*>(ptr)->removeRows(row, count);
+}
+
+void QStandardItem_SetAccessibleDescription(void* ptr, char* accessibleDescription)
+{
+	static_cast<QStandardItem*>(ptr)->setAccessibleDescription(QString(accessibleDescription));
+}
+
+void QStandardItem_SetAccessibleText(void* ptr, char* accessibleText)
+{
+	static_cast<QStandardItem*>(ptr)->setAccessibleText(QString(accessibleText));
+}
+
+void QStandardItem_SetAutoTristate(void* ptr, char tristate)
+{
+	static_cast<QStandardItem*>(ptr)->setAutoTristate(tristate != 0);
+}
+
+void QStandardItem_SetBackground(void* ptr, void* brush)
+{
+	static_cast<QStandardItem*>(ptr)->setBackground(*static_cast<QBrush*>(brush));
+}
+
+void QStandardItem_SetCheckState(void* ptr, long long state)
+{
+	static_cast<QStandardItem*>(ptr)->setCheckState(static_cast<Qt::CheckState>(state));
+}
+
+void QStandardItem_SetCheckable(void* ptr, char checkable)
+{
+	static_cast<QStandardItem*>(ptr)->setCheckable(checkable != 0);
+}
+
+void QStandardItem_SetChild2(void* ptr, int row, void* item)
+{
+	static_cast<QStandardItem*>(ptr)->setChild(row, static_cast<QStandardItem*>(item));
+}
+
+void QStandardItem_SetChild(void* ptr, int row, int column, void* item)
+{
+	static_cast<QStandardItem*>(ptr)->setChild(row, column, static_cast<QStandardItem*>(item));
+}
+
+void QStandardItem_SetColumnCount(void* ptr, int columns)
+{
+	static_cast<QStandardItem*>(ptr)->setColumnCount(columns);
+}
+
+void QStandardItem_SetData(void* ptr, void* value, int role)
+{
+	static_cast<QStandardItem*>(ptr)->setData(*static_cast<QVariant*>(value), role);
+}
+
+void QStandardItem_SetDataDefault(void* ptr, void* value, int role)
+{
+		static_cast<QStandardItem*>(ptr)->QStandardItem::setData(*static_cast<QVariant*>(value), role);
+}
+
+void QStandardItem_SetDragEnabled(void* ptr, char dragEnabled)
+{
+	static_cast<QStandardItem*>(ptr)->setDragEnabled(dragEnabled != 0);
+}
+
+void QStandardItem_SetDropEnabled(void* ptr, char dropEnabled)
+{
+	static_cast<QStandardItem*>(ptr)->setDropEnabled(dropEnabled != 0);
+}
+
+void QStandardItem_SetEditable(void* ptr, char editable)
+{
+	static_cast<QStandardItem*>(ptr)->setEditable(editable != 0);
+}
+
+void QStandardItem_SetEnabled(void* ptr, char enabled)
+{
+	static_cast<QStandardItem*>(ptr)->setEnabled(enabled != 0);
+}
+
+void QStandardItem_SetFlags(void* ptr, long long flags)
+{
+	static_cast<QStandardItem*>(ptr)->setFlags(static_cast<Qt::ItemFlag>(flags));
+}
+
+void QStandardItem_SetFont(void* ptr, void* font)
+{
+	static_cast<QStandardItem*>(ptr)->setFont(*static_cast<QFont*>(font));
+}
+
+void QStandardItem_SetForeground(void* ptr, void* brush)
+{
+	static_cast<QStandardItem*>(ptr)->setForeground(*static_cast<QBrush*>(brush));
+}
+
+void QStandardItem_SetIcon(void* ptr, void* icon)
+{
+	static_cast<QStandardItem*>(ptr)->setIcon(*static_cast<QIcon*>(icon));
+}
+
+void QStandardItem_SetRowCount(void* ptr, int rows)
+{
+	static_cast<QStandardItem*>(ptr)->setRowCount(rows);
+}
+
+void QStandardItem_SetSelectable(void* ptr, char selectable)
+{
+	static_cast<QStandardItem*>(ptr)->setSelectable(selectable != 0);
+}
+
+void QStandardItem_SetSizeHint(void* ptr, void* size)
+{
+	static_cast<QStandardItem*>(ptr)->setSizeHint(*static_cast<QSize*>(size));
+}
+
+void QStandardItem_SetStatusTip(void* ptr, char* statusTip)
+{
+	static_cast<QStandardItem*>(ptr)->setStatusTip(QString(statusTip));
+}
+
+void QStandardItem_SetText(void* ptr, char* text)
+{
+	static_cast<QStandardItem*>(ptr)->setText(QString(text));
+}
+
+void QStandardItem_SetTextAlignment(void* ptr, long long alignment)
+{
+	static_cast<QStandardItem*>(ptr)->setTextAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QStandardItem_SetToolTip(void* ptr, char* toolTip)
+{
+	static_cast<QStandardItem*>(ptr)->setToolTip(QString(toolTip));
+}
+
+void QStandardItem_SetUserTristate(void* ptr, char tristate)
+{
+	static_cast<QStandardItem*>(ptr)->setUserTristate(tristate != 0);
+}
+
+void QStandardItem_SetWhatsThis(void* ptr, char* whatsThis)
+{
+	static_cast<QStandardItem*>(ptr)->setWhatsThis(QString(whatsThis));
+}
+
+void QStandardItem_SortChildren(void* ptr, int column, long long order)
+{
+	static_cast<QStandardItem*>(ptr)->sortChildren(column, static_cast<Qt::SortOrder>(order));
+}
+
+void QStandardItem_DestroyQStandardItem(void* ptr)
+{
+	static_cast<QStandardItem*>(ptr)->~QStandardItem();
+}
+
+void QStandardItem_DestroyQStandardItemDefault(void* ptr)
+{
+
+}
+
+void* QStandardItem_Background(void* ptr)
+{
+	return new QBrush(static_cast<QStandardItem*>(ptr)->background());
+}
+
+void* QStandardItem_Foreground(void* ptr)
+{
+	return new QBrush(static_cast<QStandardItem*>(ptr)->foreground());
+}
+
+void* QStandardItem_Font(void* ptr)
+{
+	return new QFont(static_cast<QStandardItem*>(ptr)->font());
+}
+
+void* QStandardItem_Icon(void* ptr)
+{
+	return new QIcon(static_cast<QStandardItem*>(ptr)->icon());
+}
+
+void* QStandardItem_Index(void* ptr)
+{
+	return new QModelIndex(static_cast<QStandardItem*>(ptr)->index());
+}
+
+void* QStandardItem_SizeHint(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QStandardItem*>(ptr)->sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QStandardItem_Child(void* ptr, int row, int column)
+{
+	return static_cast<QStandardItem*>(ptr)->child(row, column);
+}
+
+void* QStandardItem_Clone(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->clone();
+}
+
+void* QStandardItem_CloneDefault(void* ptr)
+{
+		return static_cast<QStandardItem*>(ptr)->QStandardItem::clone();
+}
+
+void* QStandardItem_Parent(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->parent();
+}
+
+void* QStandardItem_Model(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->model();
+}
+
+struct QtGui_PackedString QStandardItem_AccessibleDescription(void* ptr)
+{
+	return ({ QByteArray t03d242 = static_cast<QStandardItem*>(ptr)->accessibleDescription().toUtf8(); QtGui_PackedString { const_cast<char*>(t03d242.prepend("WHITESPACE").constData()+10), t03d242.size()-10 }; });
+}
+
+struct QtGui_PackedString QStandardItem_AccessibleText(void* ptr)
+{
+	return ({ QByteArray t3ec2e5 = static_cast<QStandardItem*>(ptr)->accessibleText().toUtf8(); QtGui_PackedString { const_cast<char*>(t3ec2e5.prepend("WHITESPACE").constData()+10), t3ec2e5.size()-10 }; });
+}
+
+struct QtGui_PackedString QStandardItem_StatusTip(void* ptr)
+{
+	return ({ QByteArray t534fca = static_cast<QStandardItem*>(ptr)->statusTip().toUtf8(); QtGui_PackedString { const_cast<char*>(t534fca.prepend("WHITESPACE").constData()+10), t534fca.size()-10 }; });
+}
+
+struct QtGui_PackedString QStandardItem_Text(void* ptr)
+{
+	return ({ QByteArray t847a7a = static_cast<QStandardItem*>(ptr)->text().toUtf8(); QtGui_PackedString { const_cast<char*>(t847a7a.prepend("WHITESPACE").constData()+10), t847a7a.size()-10 }; });
+}
+
+struct QtGui_PackedString QStandardItem_ToolTip(void* ptr)
+{
+	return ({ QByteArray t938860 = static_cast<QStandardItem*>(ptr)->toolTip().toUtf8(); QtGui_PackedString { const_cast<char*>(t938860.prepend("WHITESPACE").constData()+10), t938860.size()-10 }; });
+}
+
+struct QtGui_PackedString QStandardItem_WhatsThis(void* ptr)
+{
+	return ({ QByteArray taa28dd = static_cast<QStandardItem*>(ptr)->whatsThis().toUtf8(); QtGui_PackedString { const_cast<char*>(taa28dd.prepend("WHITESPACE").constData()+10), taa28dd.size()-10 }; });
+}
+
+void* QStandardItem_Data(void* ptr, int role)
+{
+	return new QVariant(static_cast<QStandardItem*>(ptr)->data(role));
+}
+
+void* QStandardItem_DataDefault(void* ptr, int role)
+{
+		return new QVariant(static_cast<QStandardItem*>(ptr)->QStandardItem::data(role));
+}
+
+long long QStandardItem_TextAlignment(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->textAlignment();
+}
+
+long long QStandardItem_CheckState(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->checkState();
+}
+
+long long QStandardItem_Flags(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->flags();
+}
+
+char QStandardItem_HasChildren(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->hasChildren();
+}
+
+char QStandardItem_IsAutoTristate(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->isAutoTristate();
+}
+
+char QStandardItem_IsCheckable(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->isCheckable();
+}
+
+char QStandardItem_IsDragEnabled(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->isDragEnabled();
+}
+
+char QStandardItem_IsDropEnabled(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->isDropEnabled();
+}
+
+char QStandardItem_IsEditable(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->isEditable();
+}
+
+char QStandardItem_IsEnabled(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->isEnabled();
+}
+
+char QStandardItem_IsSelectable(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->isSelectable();
+}
+
+char QStandardItem_IsUserTristate(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->isUserTristate();
+}
+
+int QStandardItem_Column(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->column();
+}
+
+int QStandardItem_ColumnCount(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->columnCount();
+}
+
+int QStandardItem_Row(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->row();
+}
+
+int QStandardItem_RowCount(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->rowCount();
+}
+
+int QStandardItem_Type(void* ptr)
+{
+	return static_cast<QStandardItem*>(ptr)->type();
+}
+
+int QStandardItem_TypeDefault(void* ptr)
+{
+		return static_cast<QStandardItem*>(ptr)->QStandardItem::type();
+}
+
+void QStandardItem_Write(void* ptr, void* out)
+{
+	static_cast<QStandardItem*>(ptr)->write(*static_cast<QDataStream*>(out));
+}
+
+void QStandardItem_WriteDefault(void* ptr, void* out)
+{
+		static_cast<QStandardItem*>(ptr)->QStandardItem::write(*static_cast<QDataStream*>(out));
+}
+
+void* QStandardItem___takeColumn_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItem___takeColumn_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItem___takeColumn_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItem___takeRow_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItem___takeRow_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItem___takeRow_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItem___appendColumn_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItem___appendColumn_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItem___appendColumn_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItem___appendRow_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItem___appendRow_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItem___appendRow_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItem___appendRows_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItem___appendRows_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItem___appendRows_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItem___insertColumn_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItem___insertColumn_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItem___insertColumn_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItem___insertRow_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItem___insertRow_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItem___insertRow_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItem___insertRows_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItem___insertRows_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItem___insertRows_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+class MyQStandardItemModel: public QStandardItemModel
+{
+public:
+	MyQStandardItemModel(QObject *parent) : QStandardItemModel(parent) {};
+	MyQStandardItemModel(int rows, int columns, QObject *parent) : QStandardItemModel(rows, columns, parent) {};
+	bool dropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) { return callbackQStandardItemModel_DropMimeData(this, const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool insertColumns(int column, int count, const QModelIndex & parent) { return callbackQStandardItemModel_InsertColumns(this, column, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool insertRows(int row, int count, const QModelIndex & parent) { return callbackQStandardItemModel_InsertRows(this, row, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool removeColumns(int column, int count, const QModelIndex & parent) { return callbackQStandardItemModel_RemoveColumns(this, column, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool removeRows(int row, int count, const QModelIndex & parent) { return callbackQStandardItemModel_RemoveRows(this, row, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool setData(const QModelIndex & index, const QVariant & value, int role) { return callbackQStandardItemModel_SetData(this, const_cast<QModelIndex*>(&index), const_cast<QVariant*>(&value), role) != 0; };
+	bool setHeaderData(int section, Qt::Orientation orientation, const QVariant & value, int role) { return callbackQStandardItemModel_SetHeaderData(this, section, orientation, const_cast<QVariant*>(&value), role) != 0; };
+	bool setItemData(const QModelIndex & index, const QMap<int, QVariant> & roles) { return callbackQStandardItemModel_SetItemData(this, const_cast<QModelIndex*>(&index), ({ QMap<int, QVariant>* tmpValue = const_cast<QMap<int, QVariant>*>(&roles); QtGui_PackedList { tmpValue, tmpValue->size() }; })) != 0; };
+	void Signal_ItemChanged(QStandardItem * item) { callbackQStandardItemModel_ItemChanged(this, item); };
+	void sort(int column, Qt::SortOrder order) { callbackQStandardItemModel_Sort(this, column, order); };
+	QMap<int, QVariant> itemData(const QModelIndex & index) const { return *static_cast<QMap<int, QVariant>*>(callbackQStandardItemModel_ItemData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QMimeData * mimeData(const QModelIndexList & indexes) const { return static_cast<QMimeData*>(callbackQStandardItemModel_MimeData(const_cast<void*>(static_cast<const void*>(this)), ({ QList<QModelIndex>* tmpValue = new QList<QModelIndex>(indexes); QtGui_PackedList { tmpValue, tmpValue->size() }; }))); };
+	QModelIndex index(int row, int column, const QModelIndex & parent) const { return *static_cast<QModelIndex*>(callbackQStandardItemModel_Index(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&parent))); };
+	QModelIndex parent(const QModelIndex & child) const { return *static_cast<QModelIndex*>(callbackQStandardItemModel_Parent(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&child))); };
+	QModelIndex sibling(int row, int column, const QModelIndex & idx) const { return *static_cast<QModelIndex*>(callbackQStandardItemModel_Sibling(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&idx))); };
+	QStringList mimeTypes() const { char* tmp = callbackQStandardItemModel_MimeTypes(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
+	QVariant data(const QModelIndex & index, int role) const { QVariant ret; callbackQStandardItemModel_Data(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), role, &ret); return ret; };
+	QVariant headerData(int section, Qt::Orientation orientation, int role) const { return *static_cast<QVariant*>(callbackQStandardItemModel_HeaderData(const_cast<void*>(static_cast<const void*>(this)), section, orientation, role)); };
+	Qt::DropActions supportedDropActions() const { return static_cast<Qt::DropAction>(callbackQStandardItemModel_SupportedDropActions(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::ItemFlags flags(const QModelIndex & index) const { return static_cast<Qt::ItemFlag>(callbackQStandardItemModel_Flags(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	bool hasChildren(const QModelIndex & parent) const { return callbackQStandardItemModel_HasChildren(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)) != 0; };
+	int columnCount(const QModelIndex & parent) const { return callbackQStandardItemModel_ColumnCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
+	int rowCount(const QModelIndex & parent) const { return callbackQStandardItemModel_RowCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
+	bool moveColumns(const QModelIndex & sourceParent, int sourceColumn, int count, const QModelIndex & destinationParent, int destinationChild) { return callbackQStandardItemModel_MoveColumns(this, const_cast<QModelIndex*>(&sourceParent), sourceColumn, count, const_cast<QModelIndex*>(&destinationParent), destinationChild) != 0; };
+	bool moveRows(const QModelIndex & sourceParent, int sourceRow, int count, const QModelIndex & destinationParent, int destinationChild) { return callbackQStandardItemModel_MoveRows(this, const_cast<QModelIndex*>(&sourceParent), sourceRow, count, const_cast<QModelIndex*>(&destinationParent), destinationChild) != 0; };
+	bool submit() { return callbackQStandardItemModel_Submit(this) != 0; };
+	void Signal_ColumnsAboutToBeInserted(const QModelIndex & parent, int first, int last) { callbackQStandardItemModel_ColumnsAboutToBeInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsAboutToBeMoved(const QModelIndex & sourceParent, int sourceStart, int sourceEnd, const QModelIndex & destinationParent, int destinationColumn) { callbackQStandardItemModel_ColumnsAboutToBeMoved(this, const_cast<QModelIndex*>(&sourceParent), sourceStart, sourceEnd, const_cast<QModelIndex*>(&destinationParent), destinationColumn); };
+	void Signal_ColumnsAboutToBeRemoved(const QModelIndex & parent, int first, int last) { callbackQStandardItemModel_ColumnsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsInserted(const QModelIndex & parent, int first, int last) { callbackQStandardItemModel_ColumnsInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsMoved(const QModelIndex & parent, int start, int end, const QModelIndex & destination, int column) { callbackQStandardItemModel_ColumnsMoved(this, const_cast<QModelIndex*>(&parent), start, end, const_cast<QModelIndex*>(&destination), column); };
+	void Signal_ColumnsRemoved(const QModelIndex & parent, int first, int last) { callbackQStandardItemModel_ColumnsRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_DataChanged(const QModelIndex & topLeft, const QModelIndex & bottomRight, const QVector<int> & roles) { callbackQStandardItemModel_DataChanged(this, const_cast<QModelIndex*>(&topLeft), const_cast<QModelIndex*>(&bottomRight), ({ QVector<int>* tmpValue = const_cast<QVector<int>*>(&roles); QtGui_PackedList { tmpValue, tmpValue->size() }; })); };
+	void fetchMore(const QModelIndex & parent) { callbackQStandardItemModel_FetchMore(this, const_cast<QModelIndex*>(&parent)); };
+	void Signal_HeaderDataChanged(Qt::Orientation orientation, int first, int last) { callbackQStandardItemModel_HeaderDataChanged(this, orientation, first, last); };
+	void Signal_LayoutAboutToBeChanged(const QList<QPersistentModelIndex> & parents, QAbstractItemModel::LayoutChangeHint hint) { callbackQStandardItemModel_LayoutAboutToBeChanged(this, ({ QList<QPersistentModelIndex>* tmpValue = const_cast<QList<QPersistentModelIndex>*>(&parents); QtGui_PackedList { tmpValue, tmpValue->size() }; }), hint); };
+	void Signal_LayoutChanged(const QList<QPersistentModelIndex> & parents, QAbstractItemModel::LayoutChangeHint hint) { callbackQStandardItemModel_LayoutChanged(this, ({ QList<QPersistentModelIndex>* tmpValue = const_cast<QList<QPersistentModelIndex>*>(&parents); QtGui_PackedList { tmpValue, tmpValue->size() }; }), hint); };
+	void Signal_ModelAboutToBeReset() { callbackQStandardItemModel_ModelAboutToBeReset(this); };
+	void Signal_ModelReset() { callbackQStandardItemModel_ModelReset(this); };
+	void resetInternalData() { callbackQStandardItemModel_ResetInternalData(this); };
+	void revert() { callbackQStandardItemModel_Revert(this); };
+	void Signal_RowsAboutToBeInserted(const QModelIndex & parent, int start, int end) { callbackQStandardItemModel_RowsAboutToBeInserted(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void Signal_RowsAboutToBeMoved(const QModelIndex & sourceParent, int sourceStart, int sourceEnd, const QModelIndex & destinationParent, int destinationRow) { callbackQStandardItemModel_RowsAboutToBeMoved(this, const_cast<QModelIndex*>(&sourceParent), sourceStart, sourceEnd, const_cast<QModelIndex*>(&destinationParent), destinationRow); };
+	void Signal_RowsAboutToBeRemoved(const QModelIndex & parent, int first, int last) { callbackQStandardItemModel_RowsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_RowsInserted(const QModelIndex & parent, int first, int last) { callbackQStandardItemModel_RowsInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_RowsMoved(const QModelIndex & parent, int start, int end, const QModelIndex & destination, int row) { callbackQStandardItemModel_RowsMoved(this, const_cast<QModelIndex*>(&parent), start, end, const_cast<QModelIndex*>(&destination), row); };
+	void Signal_RowsRemoved(const QModelIndex & parent, int first, int last) { callbackQStandardItemModel_RowsRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	QHash<int, QByteArray> roleNames() const { return *static_cast<QHash<int, QByteArray>*>(callbackQStandardItemModel_RoleNames(const_cast<void*>(static_cast<const void*>(this)))); };
+	QModelIndex buddy(const QModelIndex & index) const { return *static_cast<QModelIndex*>(callbackQStandardItemModel_Buddy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QList<QModelIndex> match(const QModelIndex & start, int role, const QVariant & value, int hits, Qt::MatchFlags flags) const { return *static_cast<QList<QModelIndex>*>(callbackQStandardItemModel_Match(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&start), role, const_cast<QVariant*>(&value), hits, flags)); };
+	QSize span(const QModelIndex & index) const { return *static_cast<QSize*>(callbackQStandardItemModel_Span(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	Qt::DropActions supportedDragActions() const { return static_cast<Qt::DropAction>(callbackQStandardItemModel_SupportedDragActions(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool canDropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) const { return callbackQStandardItemModel_CanDropMimeData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool canFetchMore(const QModelIndex & parent) const { return callbackQStandardItemModel_CanFetchMore(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)) != 0; };
+	bool event(QEvent * e) { return callbackQStandardItemModel_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQStandardItemModel_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQStandardItemModel_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQStandardItemModel_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQStandardItemModel_CustomEvent(this, event); };
+	void deleteLater() { callbackQStandardItemModel_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQStandardItemModel_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQStandardItemModel_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQStandardItemModel_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQStandardItemModel_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQStandardItemModel_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+struct QtGui_PackedList QStandardItemModel_TakeColumn(void* ptr, int column)
+{
+	return ({ QList<QStandardItem *>* tmpValue = new QList<QStandardItem *>(static_cast<QStandardItemModel*>(ptr)->takeColumn(column)); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtGui_PackedList QStandardItemModel_TakeRow(void* ptr, int row)
+{
+	return ({ QList<QStandardItem *>* tmpValue = new QList<QStandardItem *>(static_cast<QStandardItemModel*>(ptr)->takeRow(row)); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStandardItemModel_TakeHorizontalHeaderItem(void* ptr, int column)
+{
+	return static_cast<QStandardItemModel*>(ptr)->takeHorizontalHeaderItem(column);
+}
+
+void* QStandardItemModel_TakeItem(void* ptr, int row, int column)
+{
+	return static_cast<QStandardItemModel*>(ptr)->takeItem(row, column);
+}
+
+void* QStandardItemModel_TakeVerticalHeaderItem(void* ptr, int row)
+{
+	return static_cast<QStandardItemModel*>(ptr)->takeVerticalHeaderItem(row);
+}
+
+void* QStandardItemModel_NewQStandardItemModel(void* parent)
+{
+	return new MyQStandardItemModel(static_cast<QObject*>(parent));
+}
+
+void* QStandardItemModel_NewQStandardItemModel2(int rows, int columns, void* parent)
+{
+	return new MyQStandardItemModel(rows, columns, static_cast<QObject*>(parent));
+}
+
+char QStandardItemModel_DropMimeDataDefault(void* ptr, void* data, long long action, int row, int column, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::dropMimeData(static_cast<QMimeData*>(data), static_cast<Qt::DropAction>(action), row, column, *static_cast<QModelIndex*>(parent));
+}
+
+char QStandardItemModel_InsertColumnsDefault(void* ptr, int column, int count, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::insertColumns(column, count, *static_cast<QModelIndex*>(parent));
+}
+
+char QStandardItemModel_InsertRowsDefault(void* ptr, int row, int count, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::insertRows(row, count, *static_cast<QModelIndex*>(parent));
+}
+
+char QStandardItemModel_RemoveColumnsDefault(void* ptr, int column, int count, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::removeColumns(column, count, *static_cast<QModelIndex*>(parent));
+}
+
+char QStandardItemModel_RemoveRowsDefault(void* ptr, int row, int count, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::removeRows(row, count, *static_cast<QModelIndex*>(parent));
+}
+
+char QStandardItemModel_SetDataDefault(void* ptr, void* index, void* value, int role)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::setData(*static_cast<QModelIndex*>(index), *static_cast<QVariant*>(value), role);
+}
+
+char QStandardItemModel_SetHeaderDataDefault(void* ptr, int section, long long orientation, void* value, int role)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::setHeaderData(section, static_cast<Qt::Orientation>(orientation), *static_cast<QVariant*>(value), role);
+}
+
+char QStandardItemModel_SetItemDataDefault(void* ptr, void* index, void* roles)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::setItemData(*static_cast<QModelIndex*>(index), *static_cast<QMap<int, QVariant>*>(roles));
+}
+
+void QStandardItemModel_AppendColumn(void* ptr, void* items)
+{
+	static_cast<QStandardItemModel*>(ptr)->appendColumn(*static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItemModel_AppendRow2(void* ptr, void* item)
+{
+	static_cast<QStandardItemModel*>(ptr)->appendRow(static_cast<QStandardItem*>(item));
+}
+
+void QStandardItemModel_AppendRow(void* ptr, void* items)
+{
+	static_cast<QStandardItemModel*>(ptr)->appendRow(*static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItemModel_Clear(void* ptr)
+{
+	static_cast<QStandardItemModel*>(ptr)->clear();
+}
+
+void QStandardItemModel_InsertColumn(void* ptr, int column, void* items)
+{
+	static_cast<QStandardItemModel*>(ptr)->insertColumn(column, *static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItemModel_InsertRow2(void* ptr, int row, void* item)
+{
+	static_cast<QStandardItemModel*>(ptr)->insertRow(row, static_cast<QStandardItem*>(item));
+}
+
+void QStandardItemModel_InsertRow(void* ptr, int row, void* items)
+{
+	static_cast<QStandardItemModel*>(ptr)->insertRow(row, *static_cast<QList<QStandardItem *>*>(items));
+}
+
+void QStandardItemModel_ConnectItemChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStandardItemModel*>(ptr), static_cast<void (QStandardItemModel::*)(QStandardItem *)>(&QStandardItemModel::itemChanged), static_cast<MyQStandardItemModel*>(ptr), static_cast<void (MyQStandardItemModel::*)(QStandardItem *)>(&MyQStandardItemModel::Signal_ItemChanged));
+}
+
+void QStandardItemModel_DisconnectItemChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStandardItemModel*>(ptr), static_cast<void (QStandardItemModel::*)(QStandardItem *)>(&QStandardItemModel::itemChanged), static_cast<MyQStandardItemModel*>(ptr), static_cast<void (MyQStandardItemModel::*)(QStandardItem *)>(&MyQStandardItemModel::Signal_ItemChanged));
+}
+
+void QStandardItemModel_ItemChanged(void* ptr, void* item)
+{
+	static_cast<QStandardItemModel*>(ptr)->itemChanged(static_cast<QStandardItem*>(item));
+}
+
+void QStandardItemModel_SetColumnCount(void* ptr, int columns)
+{
+	static_cast<QStandardItemModel*>(ptr)->setColumnCount(columns);
+}
+
+void QStandardItemModel_SetHorizontalHeaderItem(void* ptr, int column, void* item)
+{
+	static_cast<QStandardItemModel*>(ptr)->setHorizontalHeaderItem(column, static_cast<QStandardItem*>(item));
+}
+
+void QStandardItemModel_SetHorizontalHeaderLabels(void* ptr, char* labels)
+{
+	static_cast<QStandardItemModel*>(ptr)->setHorizontalHeaderLabels(goUnpackStringList(labels));
+}
+
+void QStandardItemModel_SetItem2(void* ptr, int row, void* item)
+{
+	static_cast<QStandardItemModel*>(ptr)->setItem(row, static_cast<QStandardItem*>(item));
+}
+
+void QStandardItemModel_SetItem(void* ptr, int row, int column, void* item)
+{
+	static_cast<QStandardItemModel*>(ptr)->setItem(row, column, static_cast<QStandardItem*>(item));
+}
+
+void QStandardItemModel_SetItemPrototype(void* ptr, void* item)
+{
+	static_cast<QStandardItemModel*>(ptr)->setItemPrototype(static_cast<QStandardItem*>(item));
+}
+
+void QStandardItemModel_SetItemRoleNames(void* ptr, void* roleNames)
+{
+	static_cast<QStandardItemModel*>(ptr)->setItemRoleNames(*static_cast<QHash<int, QByteArray>*>(roleNames));
+}
+
+void QStandardItemModel_SetRowCount(void* ptr, int rows)
+{
+	static_cast<QStandardItemModel*>(ptr)->setRowCount(rows);
+}
+
+void QStandardItemModel_SetSortRole(void* ptr, int role)
+{
+	static_cast<QStandardItemModel*>(ptr)->setSortRole(role);
+}
+
+void QStandardItemModel_SetVerticalHeaderItem(void* ptr, int row, void* item)
+{
+	static_cast<QStandardItemModel*>(ptr)->setVerticalHeaderItem(row, static_cast<QStandardItem*>(item));
+}
+
+void QStandardItemModel_SetVerticalHeaderLabels(void* ptr, char* labels)
+{
+	static_cast<QStandardItemModel*>(ptr)->setVerticalHeaderLabels(goUnpackStringList(labels));
+}
+
+void QStandardItemModel_SortDefault(void* ptr, int column, long long order)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::sort(column, static_cast<Qt::SortOrder>(order));
+}
+
+void QStandardItemModel_DestroyQStandardItemModel(void* ptr)
+{
+	static_cast<QStandardItemModel*>(ptr)->~QStandardItemModel();
+}
+
+struct QtGui_PackedList QStandardItemModel_FindItems(void* ptr, char* text, long long flags, int column)
+{
+	return ({ QList<QStandardItem *>* tmpValue = new QList<QStandardItem *>(static_cast<QStandardItemModel*>(ptr)->findItems(QString(text), static_cast<Qt::MatchFlag>(flags), column)); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtGui_PackedList QStandardItemModel_ItemDataDefault(void* ptr, void* index)
+{
+		return ({ QMap<int, QVariant>* tmpValue = new QMap<int, QVariant>(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::itemData(*static_cast<QModelIndex*>(index))); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStandardItemModel_MimeDataDefault(void* ptr, void* indexes)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::mimeData(*static_cast<QList<QModelIndex>*>(indexes));
+}
+
+void* QStandardItemModel_Index(void* ptr, int row, int column, void* parent)
+{
+	return new QModelIndex(static_cast<QStandardItemModel*>(ptr)->index(row, column, *static_cast<QModelIndex*>(parent)));
+}
+
+void* QStandardItemModel_IndexDefault(void* ptr, int row, int column, void* parent)
+{
+		return new QModelIndex(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::index(row, column, *static_cast<QModelIndex*>(parent)));
+}
+
+void* QStandardItemModel_IndexFromItem(void* ptr, void* item)
+{
+	return new QModelIndex(static_cast<QStandardItemModel*>(ptr)->indexFromItem(static_cast<QStandardItem*>(item)));
+}
+
+void* QStandardItemModel_Parent(void* ptr, void* child)
+{
+	return new QModelIndex(static_cast<QStandardItemModel*>(ptr)->parent(*static_cast<QModelIndex*>(child)));
+}
+
+void* QStandardItemModel_ParentDefault(void* ptr, void* child)
+{
+		return new QModelIndex(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::parent(*static_cast<QModelIndex*>(child)));
+}
+
+void* QStandardItemModel_SiblingDefault(void* ptr, int row, int column, void* idx)
+{
+		return new QModelIndex(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::sibling(row, column, *static_cast<QModelIndex*>(idx)));
+}
+
+void* QStandardItemModel_HorizontalHeaderItem(void* ptr, int column)
+{
+	return static_cast<QStandardItemModel*>(ptr)->horizontalHeaderItem(column);
+}
+
+void* QStandardItemModel_InvisibleRootItem(void* ptr)
+{
+	return static_cast<QStandardItemModel*>(ptr)->invisibleRootItem();
+}
+
+void* QStandardItemModel_Item(void* ptr, int row, int column)
+{
+	return static_cast<QStandardItemModel*>(ptr)->item(row, column);
+}
+
+void* QStandardItemModel_ItemFromIndex(void* ptr, void* index)
+{
+	return static_cast<QStandardItemModel*>(ptr)->itemFromIndex(*static_cast<QModelIndex*>(index));
+}
+
+void* QStandardItemModel_VerticalHeaderItem(void* ptr, int row)
+{
+	return static_cast<QStandardItemModel*>(ptr)->verticalHeaderItem(row);
+}
+
+struct QtGui_PackedString QStandardItemModel_MimeTypesDefault(void* ptr)
+{
+		return ({ long long t83a37dlen; char* t83a37d = goPackStringList(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::mimeTypes(), &t83a37dlen); QtGui_PackedString { t83a37d, t83a37dlen }; });
+}
+
+void* QStandardItemModel_Data(void* ptr, void* index, int role)
+{
+	return new QVariant(static_cast<QStandardItemModel*>(ptr)->data(*static_cast<QModelIndex*>(index), role));
+}
+
+void* QStandardItemModel_DataDefault(void* ptr, void* index, int role)
+{
+		return new QVariant(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::data(*static_cast<QModelIndex*>(index), role));
+}
+
+void QStandardItemModel_DataDefaultInto(void* ptr, void* index, int role, void* ret)
+{
+		*static_cast<QVariant*>(ret) = QVariant(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::data(*static_cast<QModelIndex*>(index), role));
+}
+
+void* QStandardItemModel_HeaderDataDefault(void* ptr, int section, long long orientation, int role)
+{
+		return new QVariant(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::headerData(section, static_cast<Qt::Orientation>(orientation), role));
+}
+
+long long QStandardItemModel_SupportedDropActionsDefault(void* ptr)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::supportedDropActions();
+}
+
+long long QStandardItemModel_FlagsDefault(void* ptr, void* index)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::flags(*static_cast<QModelIndex*>(index));
+}
+
+char QStandardItemModel_HasChildrenDefault(void* ptr, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::hasChildren(*static_cast<QModelIndex*>(parent));
+}
+
+void* QStandardItemModel_ItemPrototype(void* ptr)
+{
+	return const_cast<QStandardItem*>(static_cast<QStandardItemModel*>(ptr)->itemPrototype());
+}
+
+int QStandardItemModel_ColumnCount(void* ptr, void* parent)
+{
+	return static_cast<QStandardItemModel*>(ptr)->columnCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QStandardItemModel_ColumnCountDefault(void* ptr, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::columnCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QStandardItemModel_RowCount(void* ptr, void* parent)
+{
+	return static_cast<QStandardItemModel*>(ptr)->rowCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QStandardItemModel_RowCountDefault(void* ptr, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::rowCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QStandardItemModel_SortRole(void* ptr)
+{
+	return static_cast<QStandardItemModel*>(ptr)->sortRole();
+}
+
+void* QStandardItemModel___takeColumn_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___takeColumn_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItemModel___takeColumn_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItemModel___takeRow_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___takeRow_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItemModel___takeRow_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItemModel___setItemData_roles_atList(void* ptr, int i)
+{
+	return new QVariant(static_cast<QMap<int, QVariant>*>(ptr)->value(i));
+}
+
+void QStandardItemModel___setItemData_roles_setList(void* ptr, int key, void* i)
+{
+	static_cast<QMap<int, QVariant>*>(ptr)->insert(key, *static_cast<QVariant*>(i));
+}
+
+void* QStandardItemModel___setItemData_roles_newList(void* ptr)
+{
+	return new QMap<int, QVariant>;
+}
+
+struct QtGui_PackedList QStandardItemModel___setItemData_keyList(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QMap<int, QVariant>*>(ptr)->keys()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStandardItemModel___appendColumn_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___appendColumn_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItemModel___appendColumn_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItemModel___appendRow_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___appendRow_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItemModel___appendRow_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItemModel___insertColumn_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___insertColumn_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItemModel___insertColumn_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItemModel___insertRow_items_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___insertRow_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItemModel___insertRow_items_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItemModel___setItemRoleNames_roleNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QHash<int, QByteArray>*>(ptr)->value(i));
+}
+
+void QStandardItemModel___setItemRoleNames_roleNames_setList(void* ptr, int key, void* i)
+{
+	static_cast<QHash<int, QByteArray>*>(ptr)->insert(key, *static_cast<QByteArray*>(i));
+}
+
+void* QStandardItemModel___setItemRoleNames_roleNames_newList(void* ptr)
+{
+	return new QHash<int, QByteArray>;
+}
+
+struct QtGui_PackedList QStandardItemModel___setItemRoleNames_keyList(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QHash<int, QByteArray>*>(ptr)->keys()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStandardItemModel___findItems_atList(void* ptr, int i)
+{
+	return const_cast<QStandardItem*>(static_cast<QList<QStandardItem *>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___findItems_setList(void* ptr, void* i)
+{
+	static_cast<QList<QStandardItem *>*>(ptr)->append(static_cast<QStandardItem*>(i));
+}
+
+void* QStandardItemModel___findItems_newList(void* ptr)
+{
+	return new QList<QStandardItem *>;
+}
+
+void* QStandardItemModel___itemData_atList(void* ptr, int i)
+{
+	return new QVariant(static_cast<QMap<int, QVariant>*>(ptr)->value(i));
+}
+
+void QStandardItemModel___itemData_setList(void* ptr, int key, void* i)
+{
+	static_cast<QMap<int, QVariant>*>(ptr)->insert(key, *static_cast<QVariant*>(i));
+}
+
+void* QStandardItemModel___itemData_newList(void* ptr)
+{
+	return new QMap<int, QVariant>;
+}
+
+struct QtGui_PackedList QStandardItemModel___itemData_keyList(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QMap<int, QVariant>*>(ptr)->keys()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStandardItemModel___mimeData_indexes_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___mimeData_indexes_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QStandardItemModel___mimeData_indexes_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+int QStandardItemModel_____setItemData_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QStandardItemModel_____setItemData_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QStandardItemModel_____setItemData_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QStandardItemModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QStandardItemModel_____setItemData_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QStandardItemModel_____setItemRoleNames_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QStandardItemModel_____setItemRoleNames_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QStandardItemModel_____setItemRoleNames_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QStandardItemModel_____setItemRoleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QStandardItemModel_____setItemRoleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QStandardItemModel_____itemData_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QStandardItemModel_____itemData_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QStandardItemModel_____itemData_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QStandardItemModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QStandardItemModel_____itemData_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void* QStandardItemModel___changePersistentIndexList_from_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___changePersistentIndexList_from_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QStandardItemModel___changePersistentIndexList_from_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+void* QStandardItemModel___changePersistentIndexList_to_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___changePersistentIndexList_to_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QStandardItemModel___changePersistentIndexList_to_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+int QStandardItemModel___dataChanged_roles_atList(void* ptr, int i)
+{
+	return static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+void QStandardItemModel___dataChanged_roles_setList(void* ptr, int i)
+{
+	static_cast<QVector<int>*>(ptr)->append(i);
+}
+
+void* QStandardItemModel___dataChanged_roles_newList(void* ptr)
+{
+	return new QVector<int>;
+}
+
+void* QStandardItemModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QStandardItemModel___dataChanged_roles_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+void* QStandardItemModel___layoutAboutToBeChanged_parents_atList(void* ptr, int i)
+{
+	return new QPersistentModelIndex(static_cast<QList<QPersistentModelIndex>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___layoutAboutToBeChanged_parents_setList(void* ptr, void* i)
+{
+	static_cast<QList<QPersistentModelIndex>*>(ptr)->append(*static_cast<QPersistentModelIndex*>(i));
+}
+
+void* QStandardItemModel___layoutAboutToBeChanged_parents_newList(void* ptr)
+{
+	return new QList<QPersistentModelIndex>;
+}
+
+void* QStandardItemModel___layoutChanged_parents_atList(void* ptr, int i)
+{
+	return new QPersistentModelIndex(static_cast<QList<QPersistentModelIndex>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___layoutChanged_parents_setList(void* ptr, void* i)
+{
+	static_cast<QList<QPersistentModelIndex>*>(ptr)->append(*static_cast<QPersistentModelIndex*>(i));
+}
+
+void* QStandardItemModel___layoutChanged_parents_newList(void* ptr)
+{
+	return new QList<QPersistentModelIndex>;
+}
+
+void* QStandardItemModel___roleNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QHash<int, QByteArray>*>(ptr)->value(i));
+}
+
+void QStandardItemModel___roleNames_setList(void* ptr, int key, void* i)
+{
+	static_cast<QHash<int, QByteArray>*>(ptr)->insert(key, *static_cast<QByteArray*>(i));
+}
+
+void* QStandardItemModel___roleNames_newList(void* ptr)
+{
+	return new QHash<int, QByteArray>;
+}
+
+struct QtGui_PackedList QStandardItemModel___roleNames_keyList(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QHash<int, QByteArray>*>(ptr)->keys()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStandardItemModel___match_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___match_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QStandardItemModel___match_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+void* QStandardItemModel___persistentIndexList_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___persistentIndexList_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QStandardItemModel___persistentIndexList_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+int QStandardItemModel_____doSetRoleNames_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QStandardItemModel_____doSetRoleNames_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QStandardItemModel_____doSetRoleNames_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QStandardItemModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QStandardItemModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QStandardItemModel_____setRoleNames_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QStandardItemModel_____setRoleNames_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QStandardItemModel_____setRoleNames_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QStandardItemModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QStandardItemModel_____setRoleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QStandardItemModel_____roleNames_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QStandardItemModel_____roleNames_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QStandardItemModel_____roleNames_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QStandardItemModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QStandardItemModel_____roleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void* QStandardItemModel___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QStandardItemModel___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QStandardItemModel___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStandardItemModel___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QStandardItemModel___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStandardItemModel___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QStandardItemModel___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStandardItemModel___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QStandardItemModel___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QStandardItemModel___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStandardItemModel___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QStandardItemModel_MoveColumnsDefault(void* ptr, void* sourceParent, int sourceColumn, int count, void* destinationParent, int destinationChild)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::moveColumns(*static_cast<QModelIndex*>(sourceParent), sourceColumn, count, *static_cast<QModelIndex*>(destinationParent), destinationChild);
+}
+
+char QStandardItemModel_MoveRowsDefault(void* ptr, void* sourceParent, int sourceRow, int count, void* destinationParent, int destinationChild)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::moveRows(*static_cast<QModelIndex*>(sourceParent), sourceRow, count, *static_cast<QModelIndex*>(destinationParent), destinationChild);
+}
+
+char QStandardItemModel_SubmitDefault(void* ptr)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::submit();
+}
+
+void QStandardItemModel_FetchMoreDefault(void* ptr, void* parent)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::fetchMore(*static_cast<QModelIndex*>(parent));
+}
+
+void QStandardItemModel_ResetInternalDataDefault(void* ptr)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::resetInternalData();
+}
+
+void QStandardItemModel_RevertDefault(void* ptr)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::revert();
+}
+
+struct QtGui_PackedList QStandardItemModel_RoleNamesDefault(void* ptr)
+{
+		return ({ QHash<int, QByteArray>* tmpValue = new QHash<int, QByteArray>(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::roleNames()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStandardItemModel_BuddyDefault(void* ptr, void* index)
+{
+		return new QModelIndex(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::buddy(*static_cast<QModelIndex*>(index)));
+}
+
+struct QtGui_PackedList QStandardItemModel_MatchDefault(void* ptr, void* start, int role, void* value, int hits, long long flags)
+{
+		return ({ QList<QModelIndex>* tmpValue = new QList<QModelIndex>(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::match(*static_cast<QModelIndex*>(start), role, *static_cast<QVariant*>(value), hits, static_cast<Qt::MatchFlag>(flags))); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QStandardItemModel_SpanDefault(void* ptr, void* index)
+{
+		return ({ QSize tmpValue = static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::span(*static_cast<QModelIndex*>(index)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+long long QStandardItemModel_SupportedDragActionsDefault(void* ptr)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::supportedDragActions();
+}
+
+char QStandardItemModel_CanDropMimeDataDefault(void* ptr, void* data, long long action, int row, int column, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::canDropMimeData(static_cast<QMimeData*>(data), static_cast<Qt::DropAction>(action), row, column, *static_cast<QModelIndex*>(parent));
+}
+
+char QStandardItemModel_CanFetchMoreDefault(void* ptr, void* parent)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::canFetchMore(*static_cast<QModelIndex*>(parent));
+}
+
+char QStandardItemModel_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::event(static_cast<QEvent*>(e));
+}
+
+char QStandardItemModel_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QStandardItemModel_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QStandardItemModel_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QStandardItemModel_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::customEvent(static_cast<QEvent*>(event));
+}
+
+void QStandardItemModel_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::deleteLater();
+}
+
+void QStandardItemModel_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QStandardItemModel_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QStandardItemModel_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QStandardItemModel*>(ptr)->QStandardItemModel::metaObject());
+}
+
+void* QStaticText_NewQStaticText()
+{
+	return new QStaticText();
+}
+
+void* QStaticText_NewQStaticText3(void* other)
+{
+	return new QStaticText(*static_cast<QStaticText*>(other));
+}
+
+void* QStaticText_NewQStaticText2(char* text)
+{
+	return new QStaticText(QString(text));
+}
+
+void QStaticText_Prepare(void* ptr, void* matrix, void* font)
+{
+	static_cast<QStaticText*>(ptr)->prepare(*static_cast<QTransform*>(matrix), *static_cast<QFont*>(font));
+}
+
+void QStaticText_SetPerformanceHint(void* ptr, long long performanceHint)
+{
+	static_cast<QStaticText*>(ptr)->setPerformanceHint(static_cast<QStaticText::PerformanceHint>(performanceHint));
+}
+
+void QStaticText_SetText(void* ptr, char* text)
+{
+	static_cast<QStaticText*>(ptr)->setText(QString(text));
+}
+
+void QStaticText_SetTextFormat(void* ptr, long long textFormat)
+{
+	static_cast<QStaticText*>(ptr)->setTextFormat(static_cast<Qt::TextFormat>(textFormat));
+}
+
+void QStaticText_SetTextOption(void* ptr, void* textOption)
+{
+	static_cast<QStaticText*>(ptr)->setTextOption(*static_cast<QTextOption*>(textOption));
+}
+
+void QStaticText_SetTextWidth(void* ptr, double textWidth)
+{
+	static_cast<QStaticText*>(ptr)->setTextWidth(textWidth);
+}
+
+void QStaticText_Swap(void* ptr, void* other)
+{
+	static_cast<QStaticText*>(ptr)->swap(*static_cast<QStaticText*>(other));
+}
+
+void QStaticText_DestroyQStaticText(void* ptr)
+{
+	static_cast<QStaticText*>(ptr)->~QStaticText();
+}
+
+long long QStaticText_PerformanceHint(void* ptr)
+{
+	return static_cast<QStaticText*>(ptr)->performanceHint();
+}
+
+void* QStaticText_Size(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QStaticText*>(ptr)->size(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtGui_PackedString QStaticText_Text(void* ptr)
+{
+	return ({ QByteArray t6fe556 = static_cast<QStaticText*>(ptr)->text().toUtf8(); QtGui_PackedString { const_cast<char*>(t6fe556.prepend("WHITESPACE").constData()+10), t6fe556.size()-10 }; });
+}
+
+void* QStaticText_TextOption(void* ptr)
+{
+	return new QTextOption(static_cast<QStaticText*>(ptr)->textOption());
+}
+
+long long QStaticText_TextFormat(void* ptr)
+{
+	return static_cast<QStaticText*>(ptr)->textFormat();
+}
+
+double QStaticText_TextWidth(void* ptr)
+{
+	return static_cast<QStaticText*>(ptr)->textWidth();
+}
+
+class MyQStatusTipEvent: public QStatusTipEvent
+{
+public:
+	MyQStatusTipEvent(const QString &tip) : QStatusTipEvent(tip) {};
+};
+
+void* QStatusTipEvent_NewQStatusTipEvent(char* tip)
+{
+	return new MyQStatusTipEvent(QString(tip));
+}
+
+struct QtGui_PackedString QStatusTipEvent_Tip(void* ptr)
+{
+	return ({ QByteArray t663d3b = static_cast<QStatusTipEvent*>(ptr)->tip().toUtf8(); QtGui_PackedString { const_cast<char*>(t663d3b.prepend("WHITESPACE").constData()+10), t663d3b.size()-10 }; });
+}
+
+class MyQStyleHints: public QStyleHints
+{
+public:
+	void Signal_CursorFlashTimeChanged(int cursorFlashTime) { callbackQStyleHints_CursorFlashTimeChanged(this, cursorFlashTime); };
+	void Signal_KeyboardInputIntervalChanged(int keyboardInputInterval) { callbackQStyleHints_KeyboardInputIntervalChanged(this, keyboardInputInterval); };
+	void Signal_MouseDoubleClickIntervalChanged(int mouseDoubleClickInterval) { callbackQStyleHints_MouseDoubleClickIntervalChanged(this, mouseDoubleClickInterval); };
+	void Signal_MousePressAndHoldIntervalChanged(int mousePressAndHoldInterval) { callbackQStyleHints_MousePressAndHoldIntervalChanged(this, mousePressAndHoldInterval); };
+	void Signal_StartDragDistanceChanged(int startDragDistance) { callbackQStyleHints_StartDragDistanceChanged(this, startDragDistance); };
+	void Signal_StartDragTimeChanged(int startDragTime) { callbackQStyleHints_StartDragTimeChanged(this, startDragTime); };
+	void Signal_TabFocusBehaviorChanged(Qt::TabFocusBehavior tabFocusBehavior) { callbackQStyleHints_TabFocusBehaviorChanged(this, tabFocusBehavior); };
+	void Signal_UseHoverEffectsChanged(bool useHoverEffects) { callbackQStyleHints_UseHoverEffectsChanged(this, useHoverEffects); };
+	bool event(QEvent * e) { return callbackQStyleHints_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQStyleHints_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQStyleHints_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQStyleHints_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQStyleHints_CustomEvent(this, event); };
+	void deleteLater() { callbackQStyleHints_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQStyleHints_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQStyleHints_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQStyleHints_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQStyleHints_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQStyleHints_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QStyleHints_ConnectCursorFlashTimeChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::cursorFlashTimeChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_CursorFlashTimeChanged));
+}
+
+void QStyleHints_DisconnectCursorFlashTimeChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::cursorFlashTimeChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_CursorFlashTimeChanged));
+}
+
+void QStyleHints_CursorFlashTimeChanged(void* ptr, int cursorFlashTime)
+{
+	static_cast<QStyleHints*>(ptr)->cursorFlashTimeChanged(cursorFlashTime);
+}
+
+void QStyleHints_ConnectKeyboardInputIntervalChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::keyboardInputIntervalChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_KeyboardInputIntervalChanged));
+}
+
+void QStyleHints_DisconnectKeyboardInputIntervalChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::keyboardInputIntervalChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_KeyboardInputIntervalChanged));
+}
+
+void QStyleHints_KeyboardInputIntervalChanged(void* ptr, int keyboardInputInterval)
+{
+	static_cast<QStyleHints*>(ptr)->keyboardInputIntervalChanged(keyboardInputInterval);
+}
+
+void QStyleHints_ConnectMouseDoubleClickIntervalChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::mouseDoubleClickIntervalChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_MouseDoubleClickIntervalChanged));
+}
+
+void QStyleHints_DisconnectMouseDoubleClickIntervalChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::mouseDoubleClickIntervalChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_MouseDoubleClickIntervalChanged));
+}
+
+void QStyleHints_MouseDoubleClickIntervalChanged(void* ptr, int mouseDoubleClickInterval)
+{
+	static_cast<QStyleHints*>(ptr)->mouseDoubleClickIntervalChanged(mouseDoubleClickInterval);
+}
+
+void QStyleHints_ConnectMousePressAndHoldIntervalChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::mousePressAndHoldIntervalChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_MousePressAndHoldIntervalChanged));
+}
+
+void QStyleHints_DisconnectMousePressAndHoldIntervalChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::mousePressAndHoldIntervalChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_MousePressAndHoldIntervalChanged));
+}
+
+void QStyleHints_MousePressAndHoldIntervalChanged(void* ptr, int mousePressAndHoldInterval)
+{
+	static_cast<QStyleHints*>(ptr)->mousePressAndHoldIntervalChanged(mousePressAndHoldInterval);
+}
+
+void QStyleHints_SetUseHoverEffects(void* ptr, char useHoverEffects)
+{
+	static_cast<QStyleHints*>(ptr)->setUseHoverEffects(useHoverEffects != 0);
+}
+
+void QStyleHints_ConnectStartDragDistanceChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::startDragDistanceChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_StartDragDistanceChanged));
+}
+
+void QStyleHints_DisconnectStartDragDistanceChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::startDragDistanceChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_StartDragDistanceChanged));
+}
+
+void QStyleHints_StartDragDistanceChanged(void* ptr, int startDragDistance)
+{
+	static_cast<QStyleHints*>(ptr)->startDragDistanceChanged(startDragDistance);
+}
+
+void QStyleHints_ConnectStartDragTimeChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::startDragTimeChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_StartDragTimeChanged));
+}
+
+void QStyleHints_DisconnectStartDragTimeChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(int)>(&QStyleHints::startDragTimeChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(int)>(&MyQStyleHints::Signal_StartDragTimeChanged));
+}
+
+void QStyleHints_StartDragTimeChanged(void* ptr, int startDragTime)
+{
+	static_cast<QStyleHints*>(ptr)->startDragTimeChanged(startDragTime);
+}
+
+void QStyleHints_ConnectTabFocusBehaviorChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(Qt::TabFocusBehavior)>(&QStyleHints::tabFocusBehaviorChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(Qt::TabFocusBehavior)>(&MyQStyleHints::Signal_TabFocusBehaviorChanged));
+}
+
+void QStyleHints_DisconnectTabFocusBehaviorChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(Qt::TabFocusBehavior)>(&QStyleHints::tabFocusBehaviorChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(Qt::TabFocusBehavior)>(&MyQStyleHints::Signal_TabFocusBehaviorChanged));
+}
+
+void QStyleHints_TabFocusBehaviorChanged(void* ptr, long long tabFocusBehavior)
+{
+	static_cast<QStyleHints*>(ptr)->tabFocusBehaviorChanged(static_cast<Qt::TabFocusBehavior>(tabFocusBehavior));
+}
+
+void QStyleHints_ConnectUseHoverEffectsChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(bool)>(&QStyleHints::useHoverEffectsChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(bool)>(&MyQStyleHints::Signal_UseHoverEffectsChanged));
+}
+
+void QStyleHints_DisconnectUseHoverEffectsChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStyleHints*>(ptr), static_cast<void (QStyleHints::*)(bool)>(&QStyleHints::useHoverEffectsChanged), static_cast<MyQStyleHints*>(ptr), static_cast<void (MyQStyleHints::*)(bool)>(&MyQStyleHints::Signal_UseHoverEffectsChanged));
+}
+
+void QStyleHints_UseHoverEffectsChanged(void* ptr, char useHoverEffects)
+{
+	static_cast<QStyleHints*>(ptr)->useHoverEffectsChanged(useHoverEffects != 0);
+}
+
+void* QStyleHints_PasswordMaskCharacter(void* ptr)
+{
+	return new QChar(static_cast<QStyleHints*>(ptr)->passwordMaskCharacter());
+}
+
+long long QStyleHints_TabFocusBehavior(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->tabFocusBehavior();
+}
+
+char QStyleHints_SetFocusOnTouchRelease(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->setFocusOnTouchRelease();
+}
+
+char QStyleHints_ShowIsFullScreen(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->showIsFullScreen();
+}
+
+char QStyleHints_ShowIsMaximized(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->showIsMaximized();
+}
+
+char QStyleHints_SingleClickActivation(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->singleClickActivation();
+}
+
+char QStyleHints_UseHoverEffects(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->useHoverEffects();
+}
+
+char QStyleHints_UseRtlExtensions(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->useRtlExtensions();
+}
+
+int QStyleHints_CursorFlashTime(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->cursorFlashTime();
+}
+
+int QStyleHints_KeyboardAutoRepeatRate(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->keyboardAutoRepeatRate();
+}
+
+int QStyleHints_KeyboardInputInterval(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->keyboardInputInterval();
+}
+
+int QStyleHints_MouseDoubleClickInterval(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->mouseDoubleClickInterval();
+}
+
+int QStyleHints_MousePressAndHoldInterval(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->mousePressAndHoldInterval();
+}
+
+int QStyleHints_PasswordMaskDelay(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->passwordMaskDelay();
+}
+
+int QStyleHints_StartDragDistance(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->startDragDistance();
+}
+
+int QStyleHints_StartDragTime(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->startDragTime();
+}
+
+int QStyleHints_StartDragVelocity(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->startDragVelocity();
+}
+
+double QStyleHints_FontSmoothingGamma(void* ptr)
+{
+	return static_cast<QStyleHints*>(ptr)->fontSmoothingGamma();
+}
+
+void* QStyleHints___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QStyleHints___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QStyleHints___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QStyleHints___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QStyleHints___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStyleHints___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QStyleHints___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QStyleHints___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStyleHints___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QStyleHints___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QStyleHints___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStyleHints___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QStyleHints___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QStyleHints___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStyleHints___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QStyleHints_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QStyleHints*>(ptr)->QStyleHints::event(static_cast<QEvent*>(e));
+}
+
+char QStyleHints_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+		return static_cast<QStyleHints*>(ptr)->QStyleHints::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QStyleHints*>(ptr)->QStyleHints::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+		return static_cast<QStyleHints*>(ptr)->QStyleHints::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QStyleHints*>(ptr)->QStyleHints::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QStyleHints*>(ptr)->QStyleHints::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QStyleHints_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QStyleHints*>(ptr)->QStyleHints::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QStyleHints_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QStyleHints*>(ptr)->QStyleHints::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QStyleHints_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QStyleHints*>(ptr)->QStyleHints::customEvent(static_cast<QEvent*>(event));
+}
+
+void QStyleHints_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QStyleHints*>(ptr)->QStyleHints::deleteLater();
+}
+
+void QStyleHints_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QStyleHints*>(ptr)->QStyleHints::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QStyleHints_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QStyleHints*>(ptr)->QStyleHints::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QStyleHints_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QStyleHints*>(ptr)->QStyleHints::metaObject());
+}
+
+class MyQSurface: public QSurface
+{
+public:
+	 ~MyQSurface() { callbackQSurface_DestroyQSurface(this); };
+	QSize size() const { return *static_cast<QSize*>(callbackQSurface_Size(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSurfaceFormat format() const { return *static_cast<QSurfaceFormat*>(callbackQSurface_Format(const_cast<void*>(static_cast<const void*>(this)))); };
+	SurfaceType surfaceType() const { return static_cast<QSurface::SurfaceType>(callbackQSurface_SurfaceType(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QSurface_DestroyQSurface(void* ptr)
+{
+	static_cast<QSurface*>(ptr)->~QSurface();
+}
+
+void QSurface_DestroyQSurfaceDefault(void* ptr)
+{
+
+}
+
+void* QSurface_Size(void* ptr)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QOffscreenSurface*>(ptr)->size(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->size(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QWindow*>(ptr)->size(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QSurface*>(ptr)->size(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QSurface_Format(void* ptr)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(ptr))) {
+		return new QSurfaceFormat(static_cast<QOffscreenSurface*>(ptr)->format());
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QSurfaceFormat(static_cast<QPaintDeviceWindow*>(ptr)->format());
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(ptr))) {
+		return new QSurfaceFormat(static_cast<QWindow*>(ptr)->format());
+	} else {
+		return new QSurfaceFormat(static_cast<QSurface*>(ptr)->format());
+	}
+}
+
+long long QSurface_SurfaceClass(void* ptr)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QOffscreenSurface*>(ptr)->surfaceClass();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->surfaceClass();
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWindow*>(ptr)->surfaceClass();
+	} else {
+		return static_cast<QSurface*>(ptr)->surfaceClass();
+	}
+}
+
+long long QSurface_SurfaceType(void* ptr)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QOffscreenSurface*>(ptr)->surfaceType();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->surfaceType();
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWindow*>(ptr)->surfaceType();
+	} else {
+		return static_cast<QSurface*>(ptr)->surfaceType();
+	}
+}
+
+char QSurface_SupportsOpenGL(void* ptr)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QOffscreenSurface*>(ptr)->supportsOpenGL();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->supportsOpenGL();
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWindow*>(ptr)->supportsOpenGL();
+	} else {
+		return static_cast<QSurface*>(ptr)->supportsOpenGL();
+	}
+}
+
+long long QSurface_M_type(void* ptr)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QOffscreenSurface*>(ptr)->m_type;
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->m_type;
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWindow*>(ptr)->m_type;
+	} else {
+		return static_cast<QSurface*>(ptr)->m_type;
+	}
+}
+
+void QSurface_SetM_type(void* ptr, long long vsu)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(ptr))) {
+		static_cast<QOffscreenSurface*>(ptr)->m_type = static_cast<QSurface::SurfaceClass>(vsu);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->m_type = static_cast<QSurface::SurfaceClass>(vsu);
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QWindow*>(ptr)->m_type = static_cast<QSurface::SurfaceClass>(vsu);
+	} else {
+		static_cast<QSurface*>(ptr)->m_type = static_cast<QSurface::SurfaceClass>(vsu);
+	}
+}
+
+void* QSurfaceFormat_QSurfaceFormat_DefaultFormat()
+{
+	return new QSurfaceFormat(QSurfaceFormat::defaultFormat());
+}
+
+void* QSurfaceFormat_NewQSurfaceFormat()
+{
+	return new QSurfaceFormat();
+}
+
+void* QSurfaceFormat_NewQSurfaceFormat2(long long options)
+{
+	return new QSurfaceFormat(static_cast<QSurfaceFormat::FormatOption>(options));
+}
+
+void* QSurfaceFormat_NewQSurfaceFormat3(void* other)
+{
+	return new QSurfaceFormat(*static_cast<QSurfaceFormat*>(other));
+}
+
+void QSurfaceFormat_SetAlphaBufferSize(void* ptr, int size)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setAlphaBufferSize(size);
+}
+
+void QSurfaceFormat_SetBlueBufferSize(void* ptr, int size)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setBlueBufferSize(size);
+}
+
+void QSurfaceFormat_QSurfaceFormat_SetDefaultFormat(void* format)
+{
+	QSurfaceFormat::setDefaultFormat(*static_cast<QSurfaceFormat*>(format));
+}
+
+void QSurfaceFormat_SetDepthBufferSize(void* ptr, int size)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setDepthBufferSize(size);
+}
+
+void QSurfaceFormat_SetGreenBufferSize(void* ptr, int size)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setGreenBufferSize(size);
+}
+
+void QSurfaceFormat_SetMajorVersion(void* ptr, int major)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setMajorVersion(major);
+}
+
+void QSurfaceFormat_SetMinorVersion(void* ptr, int minor)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setMinorVersion(minor);
+}
+
+void QSurfaceFormat_SetOption(void* ptr, long long option, char on)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setOption(static_cast<QSurfaceFormat::FormatOption>(option), on != 0);
+}
+
+void QSurfaceFormat_SetOptions(void* ptr, long long options)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setOptions(static_cast<QSurfaceFormat::FormatOption>(options));
+}
+
+void QSurfaceFormat_SetProfile(void* ptr, long long profile)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setProfile(static_cast<QSurfaceFormat::OpenGLContextProfile>(profile));
+}
+
+void QSurfaceFormat_SetRedBufferSize(void* ptr, int size)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setRedBufferSize(size);
+}
+
+void QSurfaceFormat_SetRenderableType(void* ptr, long long ty)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setRenderableType(static_cast<QSurfaceFormat::RenderableType>(ty));
+}
+
+void QSurfaceFormat_SetSamples(void* ptr, int numSamples)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setSamples(numSamples);
+}
+
+void QSurfaceFormat_SetStencilBufferSize(void* ptr, int size)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setStencilBufferSize(size);
+}
+
+void QSurfaceFormat_SetStereo(void* ptr, char enable)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setStereo(enable != 0);
+}
+
+void QSurfaceFormat_SetSwapBehavior(void* ptr, long long behavior)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setSwapBehavior(static_cast<QSurfaceFormat::SwapBehavior>(behavior));
+}
+
+void QSurfaceFormat_SetSwapInterval(void* ptr, int interval)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setSwapInterval(interval);
+}
+
+void QSurfaceFormat_SetVersion(void* ptr, int major, int minor)
+{
+	static_cast<QSurfaceFormat*>(ptr)->setVersion(major, minor);
+}
+
+void QSurfaceFormat_DestroyQSurfaceFormat(void* ptr)
+{
+	static_cast<QSurfaceFormat*>(ptr)->~QSurfaceFormat();
+}
+
+long long QSurfaceFormat_Profile(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->profile();
+}
+
+long long QSurfaceFormat_Options(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->options();
+}
+
+long long QSurfaceFormat_RenderableType(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->renderableType();
+}
+
+long long QSurfaceFormat_SwapBehavior(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->swapBehavior();
+}
+
+char QSurfaceFormat_HasAlpha(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->hasAlpha();
+}
+
+char QSurfaceFormat_Stereo(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->stereo();
+}
+
+char QSurfaceFormat_TestOption(void* ptr, long long option)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->testOption(static_cast<QSurfaceFormat::FormatOption>(option));
+}
+
+int QSurfaceFormat_AlphaBufferSize(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->alphaBufferSize();
+}
+
+int QSurfaceFormat_BlueBufferSize(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->blueBufferSize();
+}
+
+int QSurfaceFormat_DepthBufferSize(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->depthBufferSize();
+}
+
+int QSurfaceFormat_GreenBufferSize(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->greenBufferSize();
+}
+
+int QSurfaceFormat_MajorVersion(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->majorVersion();
+}
+
+int QSurfaceFormat_MinorVersion(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->minorVersion();
+}
+
+int QSurfaceFormat_RedBufferSize(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->redBufferSize();
+}
+
+int QSurfaceFormat_Samples(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->samples();
+}
+
+int QSurfaceFormat_StencilBufferSize(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->stencilBufferSize();
+}
+
+int QSurfaceFormat_SwapInterval(void* ptr)
+{
+	return static_cast<QSurfaceFormat*>(ptr)->swapInterval();
+}
+
+class MyQSyntaxHighlighter: public QSyntaxHighlighter
+{
+public:
+	MyQSyntaxHighlighter(QObject *parent) : QSyntaxHighlighter(parent) {};
+	MyQSyntaxHighlighter(QTextDocument *parent) : QSyntaxHighlighter(parent) {};
+	void highlightBlock(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtGui_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQSyntaxHighlighter_HighlightBlock(this, textPacked); };
+	void rehighlight() { callbackQSyntaxHighlighter_Rehighlight(this); };
+	void rehighlightBlock(const QTextBlock & block) { callbackQSyntaxHighlighter_RehighlightBlock(this, const_cast<QTextBlock*>(&block)); };
+	 ~MyQSyntaxHighlighter() { callbackQSyntaxHighlighter_DestroyQSyntaxHighlighter(this); };
+	bool event(QEvent * e) { return callbackQSyntaxHighlighter_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQSyntaxHighlighter_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQSyntaxHighlighter_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQSyntaxHighlighter_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQSyntaxHighlighter_CustomEvent(this, event); };
+	void deleteLater() { callbackQSyntaxHighlighter_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQSyntaxHighlighter_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQSyntaxHighlighter_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQSyntaxHighlighter_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQSyntaxHighlighter_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQSyntaxHighlighter_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSyntaxHighlighter_NewQSyntaxHighlighter(void* parent)
+{
+	return new MyQSyntaxHighlighter(static_cast<QObject*>(parent));
+}
+
+void* QSyntaxHighlighter_NewQSyntaxHighlighter2(void* parent)
+{
+	return new MyQSyntaxHighlighter(static_cast<QTextDocument*>(parent));
+}
+
+void QSyntaxHighlighter_HighlightBlock(void* ptr, char* text)
+{
+	static_cast<QSyntaxHighlighter*>(ptr)->highlightBlock(QString(text));
+}
+
+void QSyntaxHighlighter_Rehighlight(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QSyntaxHighlighter*>(ptr), "rehighlight");
+}
+
+void QSyntaxHighlighter_RehighlightDefault(void* ptr)
+{
+		static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::rehighlight();
+}
+
+void QSyntaxHighlighter_RehighlightBlock(void* ptr, void* block)
+{
+	QMetaObject::invokeMethod(static_cast<QSyntaxHighlighter*>(ptr), "rehighlightBlock", Q_ARG(QTextBlock, *static_cast<QTextBlock*>(block)));
+}
+
+void QSyntaxHighlighter_RehighlightBlockDefault(void* ptr, void* block)
+{
+		static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::rehighlightBlock(*static_cast<QTextBlock*>(block));
+}
+
+void QSyntaxHighlighter_SetCurrentBlockState(void* ptr, int newState)
+{
+	static_cast<QSyntaxHighlighter*>(ptr)->setCurrentBlockState(newState);
+}
+
+void QSyntaxHighlighter_SetCurrentBlockUserData(void* ptr, void* data)
+{
+	static_cast<QSyntaxHighlighter*>(ptr)->setCurrentBlockUserData(static_cast<QTextBlockUserData*>(data));
+}
+
+void QSyntaxHighlighter_SetDocument(void* ptr, void* doc)
+{
+	static_cast<QSyntaxHighlighter*>(ptr)->setDocument(static_cast<QTextDocument*>(doc));
+}
+
+void QSyntaxHighlighter_SetFormat2(void* ptr, int start, int count, void* color)
+{
+	static_cast<QSyntaxHighlighter*>(ptr)->setFormat(start, count, *static_cast<QColor*>(color));
+}
+
+void QSyntaxHighlighter_SetFormat3(void* ptr, int start, int count, void* font)
+{
+	static_cast<QSyntaxHighlighter*>(ptr)->setFormat(start, count, *static_cast<QFont*>(font));
+}
+
+void QSyntaxHighlighter_SetFormat(void* ptr, int start, int count, void* format)
+{
+	static_cast<QSyntaxHighlighter*>(ptr)->setFormat(start, count, *static_cast<QTextCharFormat*>(format));
+}
+
+void QSyntaxHighlighter_DestroyQSyntaxHighlighter(void* ptr)
+{
+	static_cast<QSyntaxHighlighter*>(ptr)->~QSyntaxHighlighter();
+}
+
+void QSyntaxHighlighter_DestroyQSyntaxHighlighterDefault(void* ptr)
+{
+
+}
+
+void* QSyntaxHighlighter_CurrentBlock(void* ptr)
+{
+	return new QTextBlock(static_cast<QSyntaxHighlighter*>(ptr)->currentBlock());
+}
+
+void* QSyntaxHighlighter_CurrentBlockUserData(void* ptr)
+{
+	return static_cast<QSyntaxHighlighter*>(ptr)->currentBlockUserData();
+}
+
+void* QSyntaxHighlighter_Format(void* ptr, int position)
+{
+	return new QTextCharFormat(static_cast<QSyntaxHighlighter*>(ptr)->format(position));
+}
+
+void* QSyntaxHighlighter_Document(void* ptr)
+{
+	return static_cast<QSyntaxHighlighter*>(ptr)->document();
+}
+
+int QSyntaxHighlighter_CurrentBlockState(void* ptr)
+{
+	return static_cast<QSyntaxHighlighter*>(ptr)->currentBlockState();
+}
+
+int QSyntaxHighlighter_PreviousBlockState(void* ptr)
+{
+	return static_cast<QSyntaxHighlighter*>(ptr)->previousBlockState();
+}
+
+void* QSyntaxHighlighter___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QSyntaxHighlighter___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QSyntaxHighlighter___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QSyntaxHighlighter___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QSyntaxHighlighter___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QSyntaxHighlighter___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QSyntaxHighlighter___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QSyntaxHighlighter___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QSyntaxHighlighter___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QSyntaxHighlighter___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QSyntaxHighlighter___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QSyntaxHighlighter___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QSyntaxHighlighter___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QSyntaxHighlighter___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QSyntaxHighlighter___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QSyntaxHighlighter_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::event(static_cast<QEvent*>(e));
+}
+
+char QSyntaxHighlighter_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+		return static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+		return static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QSyntaxHighlighter_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QSyntaxHighlighter_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QSyntaxHighlighter_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::customEvent(static_cast<QEvent*>(event));
+}
+
+void QSyntaxHighlighter_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::deleteLater();
+}
+
+void QSyntaxHighlighter_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QSyntaxHighlighter_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QSyntaxHighlighter_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QSyntaxHighlighter*>(ptr)->QSyntaxHighlighter::metaObject());
+}
+
+class MyQTabletEvent: public QTabletEvent
+{
+public:
+	MyQTabletEvent(Type type, const QPointF &pos, const QPointF &globalPos, int device, int pointerType, qreal pressure, int xTilt, int yTilt, qreal tangentialPressure, qreal rotation, int z, Qt::KeyboardModifiers keyState, qint64 uniqueID, Qt::MouseButton button, Qt::MouseButtons buttons) : QTabletEvent(type, pos, globalPos, device, pointerType, pressure, xTilt, yTilt, tangentialPressure, rotation, z, keyState, uniqueID, button, buttons) {};
+};
+
+void* QTabletEvent_NewQTabletEvent(long long ty, void* pos, void* globalPos, int device, int pointerType, double pressure, int xTilt, int yTilt, double tangentialPressure, double rotation, int z, long long keyState, long long uniqueID, long long button, long long buttons)
+{
+	return new MyQTabletEvent(static_cast<QEvent::Type>(ty), *static_cast<QPointF*>(pos), *static_cast<QPointF*>(globalPos), device, pointerType, pressure, xTilt, yTilt, tangentialPressure, rotation, z, static_cast<Qt::KeyboardModifier>(keyState), uniqueID, static_cast<Qt::MouseButton>(button), static_cast<Qt::MouseButton>(buttons));
+}
+
+long long QTabletEvent_PointerType(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->pointerType();
+}
+
+void* QTabletEvent_GlobalPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QTabletEvent*>(ptr)->globalPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QTabletEvent_Pos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QTabletEvent*>(ptr)->pos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+long long QTabletEvent_Button(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->button();
+}
+
+long long QTabletEvent_Buttons(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->buttons();
+}
+
+long long QTabletEvent_Device(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->device();
+}
+
+void* QTabletEvent_GlobalPosF(void* ptr)
+{
+	return const_cast<QPointF*>(&static_cast<QTabletEvent*>(ptr)->globalPosF());
+}
+
+void* QTabletEvent_PosF(void* ptr)
+{
+	return const_cast<QPointF*>(&static_cast<QTabletEvent*>(ptr)->posF());
+}
+
+int QTabletEvent_GlobalX(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->globalX();
+}
+
+int QTabletEvent_GlobalY(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->globalY();
+}
+
+int QTabletEvent_X(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->x();
+}
+
+int QTabletEvent_XTilt(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->xTilt();
+}
+
+int QTabletEvent_Y(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->y();
+}
+
+int QTabletEvent_YTilt(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->yTilt();
+}
+
+int QTabletEvent_Z(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->z();
+}
+
+long long QTabletEvent_UniqueId(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->uniqueId();
+}
+
+double QTabletEvent_HiResGlobalX(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->hiResGlobalX();
+}
+
+double QTabletEvent_HiResGlobalY(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->hiResGlobalY();
+}
+
+double QTabletEvent_Pressure(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->pressure();
+}
+
+double QTabletEvent_Rotation(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->rotation();
+}
+
+double QTabletEvent_TangentialPressure(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->tangentialPressure();
+}
+
+void* QTabletEvent_MExtra(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->mExtra;
+}
+
+void QTabletEvent_SetMExtra(void* ptr, void* vvo)
+{
+	static_cast<QTabletEvent*>(ptr)->mExtra = vvo;
+}
+
+long long QTabletEvent_MUnique(void* ptr)
+{
+	return static_cast<QTabletEvent*>(ptr)->mUnique;
+}
+
+void QTabletEvent_SetMUnique(void* ptr, long long vqi)
+{
+	static_cast<QTabletEvent*>(ptr)->mUnique = vqi;
+}
+
+void* QTextBlock_NewQTextBlock(void* other)
+{
+	return new QTextBlock(*static_cast<QTextBlock*>(other));
+}
+
+void QTextBlock_ClearLayout(void* ptr)
+{
+	static_cast<QTextBlock*>(ptr)->clearLayout();
+}
+
+void QTextBlock_SetLineCount(void* ptr, int count)
+{
+	static_cast<QTextBlock*>(ptr)->setLineCount(count);
+}
+
+void QTextBlock_SetRevision(void* ptr, int rev)
+{
+	static_cast<QTextBlock*>(ptr)->setRevision(rev);
+}
+
+void QTextBlock_SetUserData(void* ptr, void* data)
+{
+	static_cast<QTextBlock*>(ptr)->setUserData(static_cast<QTextBlockUserData*>(data));
+}
+
+void QTextBlock_SetUserState(void* ptr, int state)
+{
+	static_cast<QTextBlock*>(ptr)->setUserState(state);
+}
+
+void QTextBlock_SetVisible(void* ptr, char visible)
+{
+	static_cast<QTextBlock*>(ptr)->setVisible(visible != 0);
+}
+
+struct QtGui_PackedString QTextBlock_Text(void* ptr)
+{
+	return ({ QByteArray t4bcf6c = static_cast<QTextBlock*>(ptr)->text().toUtf8(); QtGui_PackedString { const_cast<char*>(t4bcf6c.prepend("WHITESPACE").constData()+10), t4bcf6c.size()-10 }; });
+}
+
+void* QTextBlock_Next(void* ptr)
+{
+	return new QTextBlock(static_cast<QTextBlock*>(ptr)->next());
+}
+
+void* QTextBlock_Previous(void* ptr)
+{
+	return new QTextBlock(static_cast<QTextBlock*>(ptr)->previous());
+}
+
+void* QTextBlock_BlockFormat(void* ptr)
+{
+	return new QTextBlockFormat(static_cast<QTextBlock*>(ptr)->blockFormat());
+}
+
+void* QTextBlock_UserData(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->userData();
+}
+
+void* QTextBlock_CharFormat(void* ptr)
+{
+	return new QTextCharFormat(static_cast<QTextBlock*>(ptr)->charFormat());
+}
+
+void* QTextBlock_Layout(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->layout();
+}
+
+long long QTextBlock_TextDirection(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->textDirection();
+}
+
+char QTextBlock_Contains(void* ptr, int position)
+{
+	return static_cast<QTextBlock*>(ptr)->contains(position);
+}
+
+char QTextBlock_IsValid(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->isValid();
+}
+
+char QTextBlock_IsVisible(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->isVisible();
+}
+
+void* QTextBlock_Document(void* ptr)
+{
+	return const_cast<QTextDocument*>(static_cast<QTextBlock*>(ptr)->document());
+}
+
+int QTextBlock_BlockFormatIndex(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->blockFormatIndex();
+}
+
+int QTextBlock_BlockNumber(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->blockNumber();
+}
+
+int QTextBlock_CharFormatIndex(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->charFormatIndex();
+}
+
+int QTextBlock_FirstLineNumber(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->firstLineNumber();
+}
+
+int QTextBlock_Length(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->length();
+}
+
+int QTextBlock_LineCount(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->lineCount();
+}
+
+int QTextBlock_Position(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->position();
+}
+
+int QTextBlock_Revision(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->revision();
+}
+
+int QTextBlock_UserState(void* ptr)
+{
+	return static_cast<QTextBlock*>(ptr)->userState();
+}
+
+void* QTextBlock___textFormats_newList(void* ptr)
+{
+	return new QVector<QTextLayout::FormatRange>;
+}
+
+void* QTextBlockFormat_NewQTextBlockFormat()
+{
+	return new QTextBlockFormat();
+}
+
+void QTextBlockFormat_SetAlignment(void* ptr, long long alignment)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QTextBlockFormat_SetBottomMargin(void* ptr, double margin)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setBottomMargin(margin);
+}
+
+void QTextBlockFormat_SetIndent(void* ptr, int indentation)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setIndent(indentation);
+}
+
+void QTextBlockFormat_SetLeftMargin(void* ptr, double margin)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setLeftMargin(margin);
+}
+
+void QTextBlockFormat_SetLineHeight(void* ptr, double height, int heightType)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setLineHeight(height, heightType);
+}
+
+void QTextBlockFormat_SetNonBreakableLines(void* ptr, char b)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setNonBreakableLines(b != 0);
+}
+
+void QTextBlockFormat_SetPageBreakPolicy(void* ptr, long long policy)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setPageBreakPolicy(static_cast<QTextFormat::PageBreakFlag>(policy));
+}
+
+void QTextBlockFormat_SetRightMargin(void* ptr, double margin)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setRightMargin(margin);
+}
+
+void QTextBlockFormat_SetTextIndent(void* ptr, double indent)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setTextIndent(indent);
+}
+
+void QTextBlockFormat_SetTopMargin(void* ptr, double margin)
+{
+	static_cast<QTextBlockFormat*>(ptr)->setTopMargin(margin);
+}
+
+long long QTextBlockFormat_PageBreakPolicy(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->pageBreakPolicy();
+}
+
+long long QTextBlockFormat_Alignment(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->alignment();
+}
+
+char QTextBlockFormat_NonBreakableLines(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->nonBreakableLines();
+}
+
+int QTextBlockFormat_Indent(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->indent();
+}
+
+int QTextBlockFormat_LineHeightType(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->lineHeightType();
+}
+
+double QTextBlockFormat_BottomMargin(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->bottomMargin();
+}
+
+double QTextBlockFormat_LeftMargin(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->leftMargin();
+}
+
+double QTextBlockFormat_LineHeight2(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->lineHeight();
+}
+
+double QTextBlockFormat_LineHeight(void* ptr, double scriptLineHeight, double scaling)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->lineHeight(scriptLineHeight, scaling);
+}
+
+double QTextBlockFormat_RightMargin(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->rightMargin();
+}
+
+double QTextBlockFormat_TextIndent(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->textIndent();
+}
+
+double QTextBlockFormat_TopMargin(void* ptr)
+{
+	return static_cast<QTextBlockFormat*>(ptr)->topMargin();
+}
+
+void* QTextBlockFormat___setTabPositions_tabs_newList(void* ptr)
+{
+	return new QList<QTextOption::Tab>;
+}
+
+void* QTextBlockFormat___tabPositions_newList(void* ptr)
+{
+	return new QList<QTextOption::Tab>;
+}
+
+class MyQTextBlockGroup: public QTextBlockGroup
+{
+public:
+	MyQTextBlockGroup(QTextDocument *document) : QTextBlockGroup(document) {};
+	void blockFormatChanged(const QTextBlock & block) { callbackQTextBlockGroup_BlockFormatChanged(this, const_cast<QTextBlock*>(&block)); };
+	void blockInserted(const QTextBlock & block) { callbackQTextBlockGroup_BlockInserted(this, const_cast<QTextBlock*>(&block)); };
+	void blockRemoved(const QTextBlock & block) { callbackQTextBlockGroup_BlockRemoved(this, const_cast<QTextBlock*>(&block)); };
+	bool event(QEvent * e) { return callbackQTextObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQTextObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQTextObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQTextObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQTextObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQTextObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQTextObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQTextObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQTextObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQTextObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQTextObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QTextBlockGroup_NewQTextBlockGroup(void* document)
+{
+	return new MyQTextBlockGroup(static_cast<QTextDocument*>(document));
+}
+
+void QTextBlockGroup_BlockFormatChanged(void* ptr, void* block)
+{
+	static_cast<QTextBlockGroup*>(ptr)->blockFormatChanged(*static_cast<QTextBlock*>(block));
+}
+
+void QTextBlockGroup_BlockFormatChangedDefault(void* ptr, void* block)
+{
+	if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextList*>(ptr)->QTextList::blockFormatChanged(*static_cast<QTextBlock*>(block));
+	} else {
+		static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::blockFormatChanged(*static_cast<QTextBlock*>(block));
+	}
+}
+
+void QTextBlockGroup_BlockInserted(void* ptr, void* block)
+{
+	static_cast<QTextBlockGroup*>(ptr)->blockInserted(*static_cast<QTextBlock*>(block));
+}
+
+void QTextBlockGroup_BlockInsertedDefault(void* ptr, void* block)
+{
+	if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextList*>(ptr)->QTextList::blockInserted(*static_cast<QTextBlock*>(block));
+	} else {
+		static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::blockInserted(*static_cast<QTextBlock*>(block));
+	}
+}
+
+void QTextBlockGroup_BlockRemoved(void* ptr, void* block)
+{
+	static_cast<QTextBlockGroup*>(ptr)->blockRemoved(*static_cast<QTextBlock*>(block));
+}
+
+void QTextBlockGroup_BlockRemovedDefault(void* ptr, void* block)
+{
+	if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextList*>(ptr)->QTextList::blockRemoved(*static_cast<QTextBlock*>(block));
+	} else {
+		static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::blockRemoved(*static_cast<QTextBlock*>(block));
+	}
+}
+
+void QTextBlockGroup_DestroyQTextBlockGroup(void* ptr)
+{
+	static_cast<QTextBlockGroup*>(ptr)->~QTextBlockGroup();
+}
+
+struct QtGui_PackedList QTextBlockGroup_BlockList(void* ptr)
+{
+	return ({ QList<QTextBlock>* tmpValue = new QList<QTextBlock>(static_cast<QTextBlockGroup*>(ptr)->blockList()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QTextBlockGroup___blockList_atList(void* ptr, int i)
+{
+	return new QTextBlock(static_cast<QList<QTextBlock>*>(ptr)->at(i));
+}
+
+void QTextBlockGroup___blockList_setList(void* ptr, void* i)
+{
+	static_cast<QList<QTextBlock>*>(ptr)->append(*static_cast<QTextBlock*>(i));
+}
+
+void* QTextBlockGroup___blockList_newList(void* ptr)
+{
+	return new QList<QTextBlock>;
+}
+
+class MyQTextBlockUserData: public QTextBlockUserData
+{
+public:
+	 ~MyQTextBlockUserData() { callbackQTextBlockUserData_DestroyQTextBlockUserData(this); };
+};
+
+void QTextBlockUserData_DestroyQTextBlockUserData(void* ptr)
+{
+	static_cast<QTextBlockUserData*>(ptr)->~QTextBlockUserData();
+}
+
+void QTextBlockUserData_DestroyQTextBlockUserDataDefault(void* ptr)
+{
+
+}
+
+void* QTextCharFormat_NewQTextCharFormat()
+{
+	return new QTextCharFormat();
+}
+
+void QTextCharFormat_SetUnderlineStyle(void* ptr, long long style)
+{
+	static_cast<QTextCharFormat*>(ptr)->setUnderlineStyle(static_cast<QTextCharFormat::UnderlineStyle>(style));
+}
+
+struct QtGui_PackedString QTextCharFormat_AnchorNames(void* ptr)
+{
+	return ({ long long t55bd77len; char* t55bd77 = goPackStringList(static_cast<QTextCharFormat*>(ptr)->anchorNames(), &t55bd77len); QtGui_PackedString { t55bd77, t55bd77len }; });
+}
+
+char QTextCharFormat_FontUnderline(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontUnderline();
+}
+
+void QTextCharFormat_SetAnchor(void* ptr, char anchor)
+{
+	static_cast<QTextCharFormat*>(ptr)->setAnchor(anchor != 0);
+}
+
+void QTextCharFormat_SetAnchorHref(void* ptr, char* value)
+{
+	static_cast<QTextCharFormat*>(ptr)->setAnchorHref(QString(value));
+}
+
+void QTextCharFormat_SetAnchorNames(void* ptr, char* names)
+{
+	static_cast<QTextCharFormat*>(ptr)->setAnchorNames(goUnpackStringList(names));
+}
+
+void QTextCharFormat_SetFont2(void* ptr, void* font)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFont(*static_cast<QFont*>(font));
+}
+
+void QTextCharFormat_SetFont(void* ptr, void* font, long long behavior)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFont(*static_cast<QFont*>(font), static_cast<QTextCharFormat::FontPropertiesInheritanceBehavior>(behavior));
+}
+
+void QTextCharFormat_SetFontCapitalization(void* ptr, long long capitalization)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontCapitalization(static_cast<QFont::Capitalization>(capitalization));
+}
+
+void QTextCharFormat_SetFontFamily(void* ptr, char* family)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontFamily(QString(family));
+}
+
+void QTextCharFormat_SetFontFixedPitch(void* ptr, char fixedPitch)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontFixedPitch(fixedPitch != 0);
+}
+
+void QTextCharFormat_SetFontHintingPreference(void* ptr, long long hintingPreference)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontHintingPreference(static_cast<QFont::HintingPreference>(hintingPreference));
+}
+
+void QTextCharFormat_SetFontItalic(void* ptr, char italic)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontItalic(italic != 0);
+}
+
+void QTextCharFormat_SetFontKerning(void* ptr, char enable)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontKerning(enable != 0);
+}
+
+void QTextCharFormat_SetFontLetterSpacing(void* ptr, double spacing)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontLetterSpacing(spacing);
+}
+
+void QTextCharFormat_SetFontLetterSpacingType(void* ptr, long long letterSpacingType)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontLetterSpacingType(static_cast<QFont::SpacingType>(letterSpacingType));
+}
+
+void QTextCharFormat_SetFontOverline(void* ptr, char overline)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontOverline(overline != 0);
+}
+
+void QTextCharFormat_SetFontPointSize(void* ptr, double size)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontPointSize(size);
+}
+
+void QTextCharFormat_SetFontStretch(void* ptr, int factor)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontStretch(factor);
+}
+
+void QTextCharFormat_SetFontStrikeOut(void* ptr, char strikeOut)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontStrikeOut(strikeOut != 0);
+}
+
+void QTextCharFormat_SetFontStyleHint(void* ptr, long long hint, long long strategy)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontStyleHint(static_cast<QFont::StyleHint>(hint), static_cast<QFont::StyleStrategy>(strategy));
+}
+
+void QTextCharFormat_SetFontStyleStrategy(void* ptr, long long strategy)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontStyleStrategy(static_cast<QFont::StyleStrategy>(strategy));
+}
+
+void QTextCharFormat_SetFontUnderline(void* ptr, char underline)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontUnderline(underline != 0);
+}
+
+void QTextCharFormat_SetFontWeight(void* ptr, int weight)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontWeight(weight);
+}
+
+void QTextCharFormat_SetFontWordSpacing(void* ptr, double spacing)
+{
+	static_cast<QTextCharFormat*>(ptr)->setFontWordSpacing(spacing);
+}
+
+void QTextCharFormat_SetTextOutline(void* ptr, void* pen)
+{
+	static_cast<QTextCharFormat*>(ptr)->setTextOutline(*static_cast<QPen*>(pen));
+}
+
+void QTextCharFormat_SetToolTip(void* ptr, char* text)
+{
+	static_cast<QTextCharFormat*>(ptr)->setToolTip(QString(text));
+}
+
+void QTextCharFormat_SetUnderlineColor(void* ptr, void* color)
+{
+	static_cast<QTextCharFormat*>(ptr)->setUnderlineColor(*static_cast<QColor*>(color));
+}
+
+void QTextCharFormat_SetVerticalAlignment(void* ptr, long long alignment)
+{
+	static_cast<QTextCharFormat*>(ptr)->setVerticalAlignment(static_cast<QTextCharFormat::VerticalAlignment>(alignment));
+}
+
+void* QTextCharFormat_UnderlineColor(void* ptr)
+{
+	return new QColor(static_cast<QTextCharFormat*>(ptr)->underlineColor());
+}
+
+void* QTextCharFormat_Font(void* ptr)
+{
+	return new QFont(static_cast<QTextCharFormat*>(ptr)->font());
+}
+
+long long QTextCharFormat_FontCapitalization(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontCapitalization();
+}
+
+long long QTextCharFormat_FontHintingPreference(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontHintingPreference();
+}
+
+long long QTextCharFormat_FontLetterSpacingType(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontLetterSpacingType();
+}
+
+long long QTextCharFormat_FontStyleHint(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontStyleHint();
+}
+
+long long QTextCharFormat_FontStyleStrategy(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontStyleStrategy();
+}
+
+void* QTextCharFormat_TextOutline(void* ptr)
+{
+	return new QPen(static_cast<QTextCharFormat*>(ptr)->textOutline());
+}
+
+struct QtGui_PackedString QTextCharFormat_AnchorHref(void* ptr)
+{
+	return ({ QByteArray t7b8d88 = static_cast<QTextCharFormat*>(ptr)->anchorHref().toUtf8(); QtGui_PackedString { const_cast<char*>(t7b8d88.prepend("WHITESPACE").constData()+10), t7b8d88.size()-10 }; });
+}
+
+struct QtGui_PackedString QTextCharFormat_FontFamily(void* ptr)
+{
+	return ({ QByteArray t087f3f = static_cast<QTextCharFormat*>(ptr)->fontFamily().toUtf8(); QtGui_PackedString { const_cast<char*>(t087f3f.prepend("WHITESPACE").constData()+10), t087f3f.size()-10 }; });
+}
+
+struct QtGui_PackedString QTextCharFormat_ToolTip(void* ptr)
+{
+	return ({ QByteArray t7e7f7f = static_cast<QTextCharFormat*>(ptr)->toolTip().toUtf8(); QtGui_PackedString { const_cast<char*>(t7e7f7f.prepend("WHITESPACE").constData()+10), t7e7f7f.size()-10 }; });
+}
+
+long long QTextCharFormat_UnderlineStyle(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->underlineStyle();
+}
+
+long long QTextCharFormat_VerticalAlignment(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->verticalAlignment();
+}
+
+char QTextCharFormat_FontFixedPitch(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontFixedPitch();
+}
+
+char QTextCharFormat_FontItalic(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontItalic();
+}
+
+char QTextCharFormat_FontKerning(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontKerning();
+}
+
+char QTextCharFormat_FontOverline(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontOverline();
+}
+
+char QTextCharFormat_FontStrikeOut(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontStrikeOut();
+}
+
+char QTextCharFormat_IsAnchor(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->isAnchor();
+}
+
+int QTextCharFormat_FontStretch(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontStretch();
+}
+
+int QTextCharFormat_FontWeight(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontWeight();
+}
+
+double QTextCharFormat_FontLetterSpacing(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontLetterSpacing();
+}
+
+double QTextCharFormat_FontPointSize(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontPointSize();
+}
+
+double QTextCharFormat_FontWordSpacing(void* ptr)
+{
+	return static_cast<QTextCharFormat*>(ptr)->fontWordSpacing();
+}
+
+void* QTextCursor_NewQTextCursor()
+{
+	return new QTextCursor();
+}
+
+void* QTextCursor_NewQTextCursor2(void* document)
+{
+	return new QTextCursor(static_cast<QTextDocument*>(document));
+}
+
+void* QTextCursor_NewQTextCursor5(void* frame)
+{
+	return new QTextCursor(static_cast<QTextFrame*>(frame));
+}
+
+void* QTextCursor_NewQTextCursor6(void* block)
+{
+	return new QTextCursor(*static_cast<QTextBlock*>(block));
+}
+
+void* QTextCursor_NewQTextCursor7(void* cursor)
+{
+	return new QTextCursor(*static_cast<QTextCursor*>(cursor));
+}
+
+void* QTextCursor_InsertFrame(void* ptr, void* format)
+{
+	return static_cast<QTextCursor*>(ptr)->insertFrame(*static_cast<QTextFrameFormat*>(format));
+}
+
+void* QTextCursor_CreateList2(void* ptr, long long style)
+{
+	return static_cast<QTextCursor*>(ptr)->createList(static_cast<QTextListFormat::Style>(style));
+}
+
+void* QTextCursor_CreateList(void* ptr, void* format)
+{
+	return static_cast<QTextCursor*>(ptr)->createList(*static_cast<QTextListFormat*>(format));
+}
+
+void* QTextCursor_InsertList2(void* ptr, long long style)
+{
+	return static_cast<QTextCursor*>(ptr)->insertList(static_cast<QTextListFormat::Style>(style));
+}
+
+void* QTextCursor_InsertList(void* ptr, void* format)
+{
+	return static_cast<QTextCursor*>(ptr)->insertList(*static_cast<QTextListFormat*>(format));
+}
+
+void* QTextCursor_InsertTable2(void* ptr, int rows, int columns)
+{
+	return static_cast<QTextCursor*>(ptr)->insertTable(rows, columns);
+}
+
+void* QTextCursor_InsertTable(void* ptr, int rows, int columns, void* format)
+{
+	return static_cast<QTextCursor*>(ptr)->insertTable(rows, columns, *static_cast<QTextTableFormat*>(format));
+}
+
+char QTextCursor_MovePosition(void* ptr, long long operation, long long mode, int n)
+{
+	return static_cast<QTextCursor*>(ptr)->movePosition(static_cast<QTextCursor::MoveOperation>(operation), static_cast<QTextCursor::MoveMode>(mode), n);
+}
+
+void QTextCursor_BeginEditBlock(void* ptr)
+{
+	static_cast<QTextCursor*>(ptr)->beginEditBlock();
+}
+
+void QTextCursor_ClearSelection(void* ptr)
+{
+	static_cast<QTextCursor*>(ptr)->clearSelection();
+}
+
+void QTextCursor_DeleteChar(void* ptr)
+{
+	static_cast<QTextCursor*>(ptr)->deleteChar();
+}
+
+void QTextCursor_DeletePreviousChar(void* ptr)
+{
+	static_cast<QTextCursor*>(ptr)->deletePreviousChar();
+}
+
+void QTextCursor_EndEditBlock(void* ptr)
+{
+	static_cast<QTextCursor*>(ptr)->endEditBlock();
+}
+
+void QTextCursor_InsertBlock(void* ptr)
+{
+	static_cast<QTextCursor*>(ptr)->insertBlock();
+}
+
+void QTextCursor_InsertBlock2(void* ptr, void* format)
+{
+	static_cast<QTextCursor*>(ptr)->insertBlock(*static_cast<QTextBlockFormat*>(format));
+}
+
+void QTextCursor_InsertBlock3(void* ptr, void* format, void* charFormat)
+{
+	static_cast<QTextCursor*>(ptr)->insertBlock(*static_cast<QTextBlockFormat*>(format), *static_cast<QTextCharFormat*>(charFormat));
+}
+
+void QTextCursor_InsertFragment(void* ptr, void* fragment)
+{
+	static_cast<QTextCursor*>(ptr)->insertFragment(*static_cast<QTextDocumentFragment*>(fragment));
+}
+
+void QTextCursor_InsertHtml(void* ptr, char* html)
+{
+	static_cast<QTextCursor*>(ptr)->insertHtml(QString(html));
+}
+
+void QTextCursor_InsertImage4(void* ptr, void* image, char* name)
+{
+	static_cast<QTextCursor*>(ptr)->insertImage(*static_cast<QImage*>(image), QString(name));
+}
+
+void QTextCursor_InsertImage3(void* ptr, char* name)
+{
+	static_cast<QTextCursor*>(ptr)->insertImage(QString(name));
+}
+
+void QTextCursor_InsertImage(void* ptr, void* format)
+{
+	static_cast<QTextCursor*>(ptr)->insertImage(*static_cast<QTextImageFormat*>(format));
+}
+
+void QTextCursor_InsertImage2(void* ptr, void* format, long long alignment)
+{
+	static_cast<QTextCursor*>(ptr)->insertImage(*static_cast<QTextImageFormat*>(format), static_cast<QTextFrameFormat::Position>(alignment));
+}
+
+void QTextCursor_InsertText(void* ptr, char* text)
+{
+	static_cast<QTextCursor*>(ptr)->insertText(QString(text));
+}
+
+void QTextCursor_InsertText2(void* ptr, char* text, void* format)
+{
+	static_cast<QTextCursor*>(ptr)->insertText(QString(text), *static_cast<QTextCharFormat*>(format));
+}
+
+void QTextCursor_JoinPreviousEditBlock(void* ptr)
+{
+	static_cast<QTextCursor*>(ptr)->joinPreviousEditBlock();
+}
+
+void QTextCursor_MergeBlockCharFormat(void* ptr, void* modifier)
+{
+	static_cast<QTextCursor*>(ptr)->mergeBlockCharFormat(*static_cast<QTextCharFormat*>(modifier));
+}
+
+void QTextCursor_MergeBlockFormat(void* ptr, void* modifier)
+{
+	static_cast<QTextCursor*>(ptr)->mergeBlockFormat(*static_cast<QTextBlockFormat*>(modifier));
+}
+
+void QTextCursor_MergeCharFormat(void* ptr, void* modifier)
+{
+	static_cast<QTextCursor*>(ptr)->mergeCharFormat(*static_cast<QTextCharFormat*>(modifier));
+}
+
+void QTextCursor_RemoveSelectedText(void* ptr)
+{
+	static_cast<QTextCursor*>(ptr)->removeSelectedText();
+}
+
+void QTextCursor_Select(void* ptr, long long selection)
+{
+	static_cast<QTextCursor*>(ptr)->select(static_cast<QTextCursor::SelectionType>(selection));
+}
+
+void QTextCursor_SetBlockCharFormat(void* ptr, void* format)
+{
+	static_cast<QTextCursor*>(ptr)->setBlockCharFormat(*static_cast<QTextCharFormat*>(format));
+}
+
+void QTextCursor_SetBlockFormat(void* ptr, void* format)
+{
+	static_cast<QTextCursor*>(ptr)->setBlockFormat(*static_cast<QTextBlockFormat*>(format));
+}
+
+void QTextCursor_SetCharFormat(void* ptr, void* format)
+{
+	static_cast<QTextCursor*>(ptr)->setCharFormat(*static_cast<QTextCharFormat*>(format));
+}
+
+void QTextCursor_SetKeepPositionOnInsert(void* ptr, char b)
+{
+	static_cast<QTextCursor*>(ptr)->setKeepPositionOnInsert(b != 0);
+}
+
+void QTextCursor_SetPosition(void* ptr, int pos, long long m)
+{
+	static_cast<QTextCursor*>(ptr)->setPosition(pos, static_cast<QTextCursor::MoveMode>(m));
+}
+
+void QTextCursor_SetVerticalMovementX(void* ptr, int x)
+{
+	static_cast<QTextCursor*>(ptr)->setVerticalMovementX(x);
+}
+
+void QTextCursor_SetVisualNavigation(void* ptr, char b)
+{
+	static_cast<QTextCursor*>(ptr)->setVisualNavigation(b != 0);
+}
+
+void QTextCursor_Swap(void* ptr, void* other)
+{
+	static_cast<QTextCursor*>(ptr)->swap(*static_cast<QTextCursor*>(other));
+}
+
+void QTextCursor_DestroyQTextCursor(void* ptr)
+{
+	static_cast<QTextCursor*>(ptr)->~QTextCursor();
+}
+
+struct QtGui_PackedString QTextCursor_SelectedText(void* ptr)
+{
+	return ({ QByteArray t495ef8 = static_cast<QTextCursor*>(ptr)->selectedText().toUtf8(); QtGui_PackedString { const_cast<char*>(t495ef8.prepend("WHITESPACE").constData()+10), t495ef8.size()-10 }; });
+}
+
+void* QTextCursor_Block(void* ptr)
+{
+	return new QTextBlock(static_cast<QTextCursor*>(ptr)->block());
+}
+
+void* QTextCursor_BlockFormat(void* ptr)
+{
+	return new QTextBlockFormat(static_cast<QTextCursor*>(ptr)->blockFormat());
+}
+
+void* QTextCursor_BlockCharFormat(void* ptr)
+{
+	return new QTextCharFormat(static_cast<QTextCursor*>(ptr)->blockCharFormat());
+}
+
+void* QTextCursor_CharFormat(void* ptr)
+{
+	return new QTextCharFormat(static_cast<QTextCursor*>(ptr)->charFormat());
+}
+
+void* QTextCursor_Document(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->document();
+}
+
+void* QTextCursor_Selection(void* ptr)
+{
+	return new QTextDocumentFragment(static_cast<QTextCursor*>(ptr)->selection());
+}
+
+void* QTextCursor_CurrentFrame(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->currentFrame();
+}
+
+void* QTextCursor_CurrentList(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->currentList();
+}
+
+void* QTextCursor_CurrentTable(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->currentTable();
+}
+
+char QTextCursor_AtBlockEnd(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->atBlockEnd();
+}
+
+char QTextCursor_AtBlockStart(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->atBlockStart();
+}
+
+char QTextCursor_AtEnd(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->atEnd();
+}
+
+char QTextCursor_AtStart(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->atStart();
+}
+
+char QTextCursor_HasComplexSelection(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->hasComplexSelection();
+}
+
+char QTextCursor_HasSelection(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->hasSelection();
+}
+
+char QTextCursor_IsCopyOf(void* ptr, void* other)
+{
+	return static_cast<QTextCursor*>(ptr)->isCopyOf(*static_cast<QTextCursor*>(other));
+}
+
+char QTextCursor_IsNull(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->isNull();
+}
+
+char QTextCursor_KeepPositionOnInsert(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->keepPositionOnInsert();
+}
+
+char QTextCursor_VisualNavigation(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->visualNavigation();
+}
+
+int QTextCursor_Anchor(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->anchor();
+}
+
+int QTextCursor_BlockNumber(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->blockNumber();
+}
+
+int QTextCursor_ColumnNumber(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->columnNumber();
+}
+
+int QTextCursor_Position(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->position();
+}
+
+int QTextCursor_PositionInBlock(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->positionInBlock();
+}
+
+int QTextCursor_SelectionEnd(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->selectionEnd();
+}
+
+int QTextCursor_SelectionStart(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->selectionStart();
+}
+
+int QTextCursor_VerticalMovementX(void* ptr)
+{
+	return static_cast<QTextCursor*>(ptr)->verticalMovementX();
+}
+
+void QTextCursor_SelectedTableCells(void* ptr, int firstRow, int numRows, int firstColumn, int numColumns)
+{
+	static_cast<QTextCursor*>(ptr)->selectedTableCells(&firstRow, &numRows, &firstColumn, &numColumns);
+}
+
+class MyQTextDocument: public QTextDocument
+{
+public:
+	MyQTextDocument(const QString &text, QObject *parent) : QTextDocument(text, parent) {};
+	MyQTextDocument(QObject *parent) : QTextDocument(parent) {};
+	QTextObject * createObject(const QTextFormat & format) { return static_cast<QTextObject*>(callbackQTextDocument_CreateObject(this, const_cast<QTextFormat*>(&format))); };
+	QVariant loadResource(int ty, const QUrl & name) { return *static_cast<QVariant*>(callbackQTextDocument_LoadResource(this, ty, const_cast<QUrl*>(&name))); };
+	void Signal_BaseUrlChanged(const QUrl & url) { callbackQTextDocument_BaseUrlChanged(this, const_cast<QUrl*>(&url)); };
+	void Signal_BlockCountChanged(int newBlockCount) { callbackQTextDocument_BlockCountChanged(this, newBlockCount); };
+	void clear() { callbackQTextDocument_Clear(this); };
+	void Signal_ContentsChange(int position, int charsRemoved, int charsAdded) { callbackQTextDocument_ContentsChange(this, position, charsRemoved, charsAdded); };
+	void Signal_ContentsChanged() { callbackQTextDocument_ContentsChanged(this); };
+	void Signal_CursorPositionChanged(const QTextCursor & cursor) { callbackQTextDocument_CursorPositionChanged(this, const_cast<QTextCursor*>(&cursor)); };
+	void Signal_DocumentLayoutChanged() { callbackQTextDocument_DocumentLayoutChanged(this); };
+	void Signal_ModificationChanged(bool changed) { callbackQTextDocument_ModificationChanged(this, changed); };
+	void redo() { callbackQTextDocument_Redo2(this); };
+	void Signal_RedoAvailable(bool available) { callbackQTextDocument_RedoAvailable(this, available); };
+	void setModified(bool m) { callbackQTextDocument_SetModified(this, m); };
+	void undo() { callbackQTextDocument_Undo2(this); };
+	void Signal_UndoAvailable(bool available) { callbackQTextDocument_UndoAvailable(this, available); };
+	void Signal_UndoCommandAdded() { callbackQTextDocument_UndoCommandAdded(this); };
+	bool event(QEvent * e) { return callbackQTextDocument_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQTextDocument_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQTextDocument_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQTextDocument_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQTextDocument_CustomEvent(this, event); };
+	void deleteLater() { callbackQTextDocument_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQTextDocument_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQTextDocument_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQTextDocument_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQTextDocument_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQTextDocument_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QTextDocument_NewQTextDocument2(char* text, void* parent)
+{
+	return new MyQTextDocument(QString(text), static_cast<QObject*>(parent));
+}
+
+void* QTextDocument_CreateObject(void* ptr, void* format)
+{
+	return static_cast<QTextDocument*>(ptr)->createObject(*static_cast<QTextFormat*>(format));
+}
+
+void* QTextDocument_CreateObjectDefault(void* ptr, void* format)
+{
+		return static_cast<QTextDocument*>(ptr)->QTextDocument::createObject(*static_cast<QTextFormat*>(format));
+}
+
+void* QTextDocument_NewQTextDocument(void* parent)
+{
+	return new MyQTextDocument(static_cast<QObject*>(parent));
+}
+
+void* QTextDocument_LoadResource(void* ptr, int ty, void* name)
+{
+	return new QVariant(static_cast<QTextDocument*>(ptr)->loadResource(ty, *static_cast<QUrl*>(name)));
+}
+
+void* QTextDocument_LoadResourceDefault(void* ptr, int ty, void* name)
+{
+		return new QVariant(static_cast<QTextDocument*>(ptr)->QTextDocument::loadResource(ty, *static_cast<QUrl*>(name)));
+}
+
+void QTextDocument_AddResource(void* ptr, int ty, void* name, void* resource)
+{
+	static_cast<QTextDocument*>(ptr)->addResource(ty, *static_cast<QUrl*>(name), *static_cast<QVariant*>(resource));
+}
+
+void QTextDocument_AdjustSize(void* ptr)
+{
+	static_cast<QTextDocument*>(ptr)->adjustSize();
+}
+
+void QTextDocument_ConnectBaseUrlChanged(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(const QUrl &)>(&QTextDocument::baseUrlChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(const QUrl &)>(&MyQTextDocument::Signal_BaseUrlChanged));
+}
+
+void QTextDocument_DisconnectBaseUrlChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(const QUrl &)>(&QTextDocument::baseUrlChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(const QUrl &)>(&MyQTextDocument::Signal_BaseUrlChanged));
+}
+
+void QTextDocument_BaseUrlChanged(void* ptr, void* url)
+{
+	static_cast<QTextDocument*>(ptr)->baseUrlChanged(*static_cast<QUrl*>(url));
+}
+
+void QTextDocument_ConnectBlockCountChanged(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(int)>(&QTextDocument::blockCountChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(int)>(&MyQTextDocument::Signal_BlockCountChanged));
+}
+
+void QTextDocument_DisconnectBlockCountChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(int)>(&QTextDocument::blockCountChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(int)>(&MyQTextDocument::Signal_BlockCountChanged));
+}
+
+void QTextDocument_BlockCountChanged(void* ptr, int newBlockCount)
+{
+	static_cast<QTextDocument*>(ptr)->blockCountChanged(newBlockCount);
+}
+
+void QTextDocument_Clear(void* ptr)
+{
+	static_cast<QTextDocument*>(ptr)->clear();
+}
+
+void QTextDocument_ClearDefault(void* ptr)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::clear();
+}
+
+void QTextDocument_ClearUndoRedoStacks(void* ptr, long long stacksToClear)
+{
+	static_cast<QTextDocument*>(ptr)->clearUndoRedoStacks(static_cast<QTextDocument::Stacks>(stacksToClear));
+}
+
+void QTextDocument_ConnectContentsChange(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(int, int, int)>(&QTextDocument::contentsChange), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(int, int, int)>(&MyQTextDocument::Signal_ContentsChange));
+}
+
+void QTextDocument_DisconnectContentsChange(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(int, int, int)>(&QTextDocument::contentsChange), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(int, int, int)>(&MyQTextDocument::Signal_ContentsChange));
+}
+
+void QTextDocument_ContentsChange(void* ptr, int position, int charsRemoved, int charsAdded)
+{
+	static_cast<QTextDocument*>(ptr)->contentsChange(position, charsRemoved, charsAdded);
+}
+
+void QTextDocument_ConnectContentsChanged(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)()>(&QTextDocument::contentsChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)()>(&MyQTextDocument::Signal_ContentsChanged));
+}
+
+void QTextDocument_DisconnectContentsChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)()>(&QTextDocument::contentsChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)()>(&MyQTextDocument::Signal_ContentsChanged));
+}
+
+void QTextDocument_ContentsChanged(void* ptr)
+{
+	static_cast<QTextDocument*>(ptr)->contentsChanged();
+}
+
+void QTextDocument_ConnectCursorPositionChanged(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(const QTextCursor &)>(&QTextDocument::cursorPositionChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(const QTextCursor &)>(&MyQTextDocument::Signal_CursorPositionChanged));
+}
+
+void QTextDocument_DisconnectCursorPositionChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(const QTextCursor &)>(&QTextDocument::cursorPositionChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(const QTextCursor &)>(&MyQTextDocument::Signal_CursorPositionChanged));
+}
+
+void QTextDocument_CursorPositionChanged(void* ptr, void* cursor)
+{
+	static_cast<QTextDocument*>(ptr)->cursorPositionChanged(*static_cast<QTextCursor*>(cursor));
+}
+
+void QTextDocument_ConnectDocumentLayoutChanged(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)()>(&QTextDocument::documentLayoutChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)()>(&MyQTextDocument::Signal_DocumentLayoutChanged));
+}
+
+void QTextDocument_DisconnectDocumentLayoutChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)()>(&QTextDocument::documentLayoutChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)()>(&MyQTextDocument::Signal_DocumentLayoutChanged));
+}
+
+void QTextDocument_DocumentLayoutChanged(void* ptr)
+{
+	static_cast<QTextDocument*>(ptr)->documentLayoutChanged();
+}
+
+void QTextDocument_DrawContents(void* ptr, void* p, void* rect)
+{
+	static_cast<QTextDocument*>(ptr)->drawContents(static_cast<QPainter*>(p), *static_cast<QRectF*>(rect));
+}
+
+void QTextDocument_MarkContentsDirty(void* ptr, int position, int length)
+{
+	static_cast<QTextDocument*>(ptr)->markContentsDirty(position, length);
+}
+
+void QTextDocument_ConnectModificationChanged(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(bool)>(&QTextDocument::modificationChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(bool)>(&MyQTextDocument::Signal_ModificationChanged));
+}
+
+void QTextDocument_DisconnectModificationChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(bool)>(&QTextDocument::modificationChanged), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(bool)>(&MyQTextDocument::Signal_ModificationChanged));
+}
+
+void QTextDocument_ModificationChanged(void* ptr, char changed)
+{
+	static_cast<QTextDocument*>(ptr)->modificationChanged(changed != 0);
+}
+
+void QTextDocument_Redo2(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QTextDocument*>(ptr), "redo");
+}
+
+void QTextDocument_Redo2Default(void* ptr)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::redo();
+}
+
+void QTextDocument_Redo(void* ptr, void* cursor)
+{
+	static_cast<QTextDocument*>(ptr)->redo(static_cast<QTextCursor*>(cursor));
+}
+
+void QTextDocument_ConnectRedoAvailable(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(bool)>(&QTextDocument::redoAvailable), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(bool)>(&MyQTextDocument::Signal_RedoAvailable));
+}
+
+void QTextDocument_DisconnectRedoAvailable(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(bool)>(&QTextDocument::redoAvailable), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(bool)>(&MyQTextDocument::Signal_RedoAvailable));
+}
+
+void QTextDocument_RedoAvailable(void* ptr, char available)
+{
+	static_cast<QTextDocument*>(ptr)->redoAvailable(available != 0);
+}
+
+void QTextDocument_SetBaseUrl(void* ptr, void* url)
+{
+	static_cast<QTextDocument*>(ptr)->setBaseUrl(*static_cast<QUrl*>(url));
+}
+
+void QTextDocument_SetDefaultCursorMoveStyle(void* ptr, long long style)
+{
+	static_cast<QTextDocument*>(ptr)->setDefaultCursorMoveStyle(static_cast<Qt::CursorMoveStyle>(style));
+}
+
+void QTextDocument_SetDefaultFont(void* ptr, void* font)
+{
+	static_cast<QTextDocument*>(ptr)->setDefaultFont(*static_cast<QFont*>(font));
+}
+
+void QTextDocument_SetDefaultStyleSheet(void* ptr, char* sheet)
+{
+	static_cast<QTextDocument*>(ptr)->setDefaultStyleSheet(QString(sheet));
+}
+
+void QTextDocument_SetDefaultTextOption(void* ptr, void* option)
+{
+	static_cast<QTextDocument*>(ptr)->setDefaultTextOption(*static_cast<QTextOption*>(option));
+}
+
+void QTextDocument_SetDocumentLayout(void* ptr, void* layout)
+{
+	static_cast<QTextDocument*>(ptr)->setDocumentLayout(static_cast<QAbstractTextDocumentLayout*>(layout));
+}
+
+void QTextDocument_SetDocumentMargin(void* ptr, double margin)
+{
+	static_cast<QTextDocument*>(ptr)->setDocumentMargin(margin);
+}
+
+void QTextDocument_SetHtml(void* ptr, char* html)
+{
+	static_cast<QTextDocument*>(ptr)->setHtml(QString(html));
+}
+
+void QTextDocument_SetIndentWidth(void* ptr, double width)
+{
+	static_cast<QTextDocument*>(ptr)->setIndentWidth(width);
+}
+
+void QTextDocument_SetMaximumBlockCount(void* ptr, int maximum)
+{
+	static_cast<QTextDocument*>(ptr)->setMaximumBlockCount(maximum);
+}
+
+void QTextDocument_SetMetaInformation(void* ptr, long long info, char* stri)
+{
+	static_cast<QTextDocument*>(ptr)->setMetaInformation(static_cast<QTextDocument::MetaInformation>(info), QString(stri));
+}
+
+void QTextDocument_SetModified(void* ptr, char m)
+{
+	QMetaObject::invokeMethod(static_cast<QTextDocument*>(ptr), "setModified", Q_ARG(bool, m != 0));
+}
+
+void QTextDocument_SetModifiedDefault(void* ptr, char m)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::setModified(m != 0);
+}
+
+void QTextDocument_SetPageSize(void* ptr, void* size)
+{
+	static_cast<QTextDocument*>(ptr)->setPageSize(*static_cast<QSizeF*>(size));
+}
+
+void QTextDocument_SetPlainText(void* ptr, char* text)
+{
+	static_cast<QTextDocument*>(ptr)->setPlainText(QString(text));
+}
+
+void QTextDocument_SetTextWidth(void* ptr, double width)
+{
+	static_cast<QTextDocument*>(ptr)->setTextWidth(width);
+}
+
+void QTextDocument_SetUndoRedoEnabled(void* ptr, char enable)
+{
+	static_cast<QTextDocument*>(ptr)->setUndoRedoEnabled(enable != 0);
+}
+
+void QTextDocument_SetUseDesignMetrics(void* ptr, char b)
+{
+	static_cast<QTextDocument*>(ptr)->setUseDesignMetrics(b != 0);
+}
+
+void QTextDocument_Undo2(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QTextDocument*>(ptr), "undo");
+}
+
+void QTextDocument_Undo2Default(void* ptr)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::undo();
+}
+
+void QTextDocument_Undo(void* ptr, void* cursor)
+{
+	static_cast<QTextDocument*>(ptr)->undo(static_cast<QTextCursor*>(cursor));
+}
+
+void QTextDocument_ConnectUndoAvailable(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(bool)>(&QTextDocument::undoAvailable), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(bool)>(&MyQTextDocument::Signal_UndoAvailable));
+}
+
+void QTextDocument_DisconnectUndoAvailable(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)(bool)>(&QTextDocument::undoAvailable), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)(bool)>(&MyQTextDocument::Signal_UndoAvailable));
+}
+
+void QTextDocument_UndoAvailable(void* ptr, char available)
+{
+	static_cast<QTextDocument*>(ptr)->undoAvailable(available != 0);
+}
+
+void QTextDocument_ConnectUndoCommandAdded(void* ptr)
+{
+	QObject::connect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)()>(&QTextDocument::undoCommandAdded), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)()>(&MyQTextDocument::Signal_UndoCommandAdded));
+}
+
+void QTextDocument_DisconnectUndoCommandAdded(void* ptr)
+{
+	QObject::disconnect(static_cast<QTextDocument*>(ptr), static_cast<void (QTextDocument::*)()>(&QTextDocument::undoCommandAdded), static_cast<MyQTextDocument*>(ptr), static_cast<void (MyQTextDocument::*)()>(&MyQTextDocument::Signal_UndoCommandAdded));
+}
+
+void QTextDocument_UndoCommandAdded(void* ptr)
+{
+	static_cast<QTextDocument*>(ptr)->undoCommandAdded();
+}
+
+void QTextDocument_DestroyQTextDocument(void* ptr)
+{
+	static_cast<QTextDocument*>(ptr)->~QTextDocument();
+}
+
+void* QTextDocument_DocumentLayout(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->documentLayout();
+}
+
+void* QTextDocument_CharacterAt(void* ptr, int pos)
+{
+	return new QChar(static_cast<QTextDocument*>(ptr)->characterAt(pos));
+}
+
+void* QTextDocument_DefaultFont(void* ptr)
+{
+	return new QFont(static_cast<QTextDocument*>(ptr)->defaultFont());
+}
+
+void* QTextDocument_PageSize(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QTextDocument*>(ptr)->pageSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QTextDocument_Size(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QTextDocument*>(ptr)->size(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtGui_PackedString QTextDocument_DefaultStyleSheet(void* ptr)
+{
+	return ({ QByteArray t95f0f4 = static_cast<QTextDocument*>(ptr)->defaultStyleSheet().toUtf8(); QtGui_PackedString { const_cast<char*>(t95f0f4.prepend("WHITESPACE").constData()+10), t95f0f4.size()-10 }; });
+}
+
+struct QtGui_PackedString QTextDocument_MetaInformation(void* ptr, long long info)
+{
+	return ({ QByteArray ta91ae2 = static_cast<QTextDocument*>(ptr)->metaInformation(static_cast<QTextDocument::MetaInformation>(info)).toUtf8(); QtGui_PackedString { const_cast<char*>(ta91ae2.prepend("WHITESPACE").constData()+10), ta91ae2.size()-10 }; });
+}
+
+struct QtGui_PackedString QTextDocument_ToHtml(void* ptr, void* encoding)
+{
+	return ({ QByteArray t48be10 = static_cast<QTextDocument*>(ptr)->toHtml(*static_cast<QByteArray*>(encoding)).toUtf8(); QtGui_PackedString { const_cast<char*>(t48be10.prepend("WHITESPACE").constData()+10), t48be10.size()-10 }; });
+}
+
+struct QtGui_PackedString QTextDocument_ToPlainText(void* ptr)
+{
+	return ({ QByteArray t7d8da3 = static_cast<QTextDocument*>(ptr)->toPlainText().toUtf8(); QtGui_PackedString { const_cast<char*>(t7d8da3.prepend("WHITESPACE").constData()+10), t7d8da3.size()-10 }; });
+}
+
+void* QTextDocument_Begin(void* ptr)
+{
+	return new QTextBlock(static_cast<QTextDocument*>(ptr)->begin());
+}
+
+void* QTextDocument_End(void* ptr)
+{
+	return new QTextBlock(static_cast<QTextDocument*>(ptr)->end());
+}
+
+void* QTextDocument_FindBlock(void* ptr, int pos)
+{
+	return new QTextBlock(static_cast<QTextDocument*>(ptr)->findBlock(pos));
+}
+
+void* QTextDocument_FindBlockByLineNumber(void* ptr, int lineNumber)
+{
+	return new QTextBlock(static_cast<QTextDocument*>(ptr)->findBlockByLineNumber(lineNumber));
+}
+
+void* QTextDocument_FindBlockByNumber(void* ptr, int blockNumber)
+{
+	return new QTextBlock(static_cast<QTextDocument*>(ptr)->findBlockByNumber(blockNumber));
+}
+
+void* QTextDocument_FirstBlock(void* ptr)
+{
+	return new QTextBlock(static_cast<QTextDocument*>(ptr)->firstBlock());
+}
+
+void* QTextDocument_LastBlock(void* ptr)
+{
+	return new QTextBlock(static_cast<QTextDocument*>(ptr)->lastBlock());
+}
+
+void* QTextDocument_Find4(void* ptr, void* expr, void* cursor, long long options)
+{
+	return new QTextCursor(static_cast<QTextDocument*>(ptr)->find(*static_cast<QRegExp*>(expr), *static_cast<QTextCursor*>(cursor), static_cast<QTextDocument::FindFlag>(options)));
+}
+
+void* QTextDocument_Find3(void* ptr, void* expr, int from, long long options)
+{
+	return new QTextCursor(static_cast<QTextDocument*>(ptr)->find(*static_cast<QRegExp*>(expr), from, static_cast<QTextDocument::FindFlag>(options)));
+}
+
+void* QTextDocument_Find6(void* ptr, void* expr, void* cursor, long long options)
+{
+	return new QTextCursor(static_cast<QTextDocument*>(ptr)->find(*static_cast<QRegularExpression*>(expr), *static_cast<QTextCursor*>(cursor), static_cast<QTextDocument::FindFlag>(options)));
+}
+
+void* QTextDocument_Find5(void* ptr, void* expr, int from, long long options)
+{
+	return new QTextCursor(static_cast<QTextDocument*>(ptr)->find(*static_cast<QRegularExpression*>(expr), from, static_cast<QTextDocument::FindFlag>(options)));
+}
+
+void* QTextDocument_Find(void* ptr, char* subString, void* cursor, long long options)
+{
+	return new QTextCursor(static_cast<QTextDocument*>(ptr)->find(QString(subString), *static_cast<QTextCursor*>(cursor), static_cast<QTextDocument::FindFlag>(options)));
+}
+
+void* QTextDocument_Find2(void* ptr, char* subString, int position, long long options)
+{
+	return new QTextCursor(static_cast<QTextDocument*>(ptr)->find(QString(subString), position, static_cast<QTextDocument::FindFlag>(options)));
+}
+
+void* QTextDocument_Clone(void* ptr, void* parent)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(parent))) {
+		return static_cast<QTextDocument*>(ptr)->clone(static_cast<QOffscreenSurface*>(parent));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(parent))) {
+		return static_cast<QTextDocument*>(ptr)->clone(static_cast<QPaintDeviceWindow*>(parent));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(parent))) {
+		return static_cast<QTextDocument*>(ptr)->clone(static_cast<QPdfWriter*>(parent));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(parent))) {
+		return static_cast<QTextDocument*>(ptr)->clone(static_cast<QWindow*>(parent));
+	} else {
+		return static_cast<QTextDocument*>(ptr)->clone(static_cast<QObject*>(parent));
+	}
+}
+
+void* QTextDocument_RootFrame(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->rootFrame();
+}
+
+void* QTextDocument_Object(void* ptr, int objectIndex)
+{
+	return static_cast<QTextDocument*>(ptr)->object(objectIndex);
+}
+
+void* QTextDocument_ObjectForFormat(void* ptr, void* f)
+{
+	return static_cast<QTextDocument*>(ptr)->objectForFormat(*static_cast<QTextFormat*>(f));
+}
+
+void* QTextDocument_DefaultTextOption(void* ptr)
+{
+	return new QTextOption(static_cast<QTextDocument*>(ptr)->defaultTextOption());
+}
+
+void* QTextDocument_BaseUrl(void* ptr)
+{
+	return new QUrl(static_cast<QTextDocument*>(ptr)->baseUrl());
+}
+
+void* QTextDocument_Resource(void* ptr, int ty, void* name)
+{
+	return new QVariant(static_cast<QTextDocument*>(ptr)->resource(ty, *static_cast<QUrl*>(name)));
+}
+
+struct QtGui_PackedList QTextDocument_AllFormats(void* ptr)
+{
+	return ({ QVector<QTextFormat>* tmpValue = new QVector<QTextFormat>(static_cast<QTextDocument*>(ptr)->allFormats()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+long long QTextDocument_DefaultCursorMoveStyle(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->defaultCursorMoveStyle();
+}
+
+char QTextDocument_IsEmpty(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->isEmpty();
+}
+
+char QTextDocument_IsModified(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->isModified();
+}
+
+char QTextDocument_IsRedoAvailable(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->isRedoAvailable();
+}
+
+char QTextDocument_IsUndoAvailable(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->isUndoAvailable();
+}
+
+char QTextDocument_IsUndoRedoEnabled(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->isUndoRedoEnabled();
+}
+
+char QTextDocument_UseDesignMetrics(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->useDesignMetrics();
+}
+
+int QTextDocument_AvailableRedoSteps(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->availableRedoSteps();
+}
+
+int QTextDocument_AvailableUndoSteps(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->availableUndoSteps();
+}
+
+int QTextDocument_BlockCount(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->blockCount();
+}
+
+int QTextDocument_CharacterCount(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->characterCount();
+}
+
+int QTextDocument_LineCount(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->lineCount();
+}
+
+int QTextDocument_MaximumBlockCount(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->maximumBlockCount();
+}
+
+int QTextDocument_PageCount(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->pageCount();
+}
+
+int QTextDocument_Revision(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->revision();
+}
+
+double QTextDocument_DocumentMargin(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->documentMargin();
+}
+
+double QTextDocument_IdealWidth(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->idealWidth();
+}
+
+double QTextDocument_IndentWidth(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->indentWidth();
+}
+
+double QTextDocument_TextWidth(void* ptr)
+{
+	return static_cast<QTextDocument*>(ptr)->textWidth();
+}
+
+void QTextDocument_Print(void* ptr, void* printer)
+{
+#ifndef Q_OS_IOS
+	if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(printer))) {
+		static_cast<QTextDocument*>(ptr)->print(static_cast<QPdfWriter*>(printer));
+	} else {
+		static_cast<QTextDocument*>(ptr)->print(static_cast<QPagedPaintDevice*>(printer));
+	}
+#endif
+}
+
+void* QTextDocument___allFormats_atList(void* ptr, int i)
+{
+	return new QTextFormat(static_cast<QVector<QTextFormat>*>(ptr)->at(i));
+}
+
+void QTextDocument___allFormats_setList(void* ptr, void* i)
+{
+	static_cast<QVector<QTextFormat>*>(ptr)->append(*static_cast<QTextFormat*>(i));
+}
+
+void* QTextDocument___allFormats_newList(void* ptr)
+{
+	return new QVector<QTextFormat>;
+}
+
+void* QTextDocument___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTextDocument___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTextDocument___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QTextDocument___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QTextDocument___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QTextDocument___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QTextDocument___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QTextDocument___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QTextDocument___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QTextDocument___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QTextDocument___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QTextDocument___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QTextDocument___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QTextDocument___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QTextDocument___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QTextDocument_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QTextDocument*>(ptr)->QTextDocument::event(static_cast<QEvent*>(e));
+}
+
+char QTextDocument_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+		return static_cast<QTextDocument*>(ptr)->QTextDocument::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QTextDocument*>(ptr)->QTextDocument::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+		return static_cast<QTextDocument*>(ptr)->QTextDocument::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+		return static_cast<QTextDocument*>(ptr)->QTextDocument::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QTextDocument*>(ptr)->QTextDocument::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QTextDocument_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QTextDocument_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QTextDocument_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::customEvent(static_cast<QEvent*>(event));
+}
+
+void QTextDocument_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::deleteLater();
+}
+
+void QTextDocument_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QTextDocument_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QTextDocument*>(ptr)->QTextDocument::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QTextDocument_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QTextDocument*>(ptr)->QTextDocument::metaObject());
+}
+
+void* QTextDocumentFragment_QTextDocumentFragment_FromHtml(char* text)
+{
+	return new QTextDocumentFragment(QTextDocumentFragment::fromHtml(QString(text)));
+}
+
+void* QTextDocumentFragment_QTextDocumentFragment_FromHtml2(char* text, void* resourceProvider)
+{
+	return new QTextDocumentFragment(QTextDocumentFragment::fromHtml(QString(text), static_cast<QTextDocument*>(resourceProvider)));
+}
+
+void* QTextDocumentFragment_QTextDocumentFragment_FromPlainText(char* plainText)
+{
+	return new QTextDocumentFragment(QTextDocumentFragment::fromPlainText(QString(plainText)));
+}
+
+void* QTextDocumentFragment_NewQTextDocumentFragment()
+{
+	return new QTextDocumentFragment();
+}
+
+void* QTextDocumentFragment_NewQTextDocumentFragment3(void* cursor)
+{
+	return new QTextDocumentFragment(*static_cast<QTextCursor*>(cursor));
+}
+
+void* QTextDocumentFragment_NewQTextDocumentFragment2(void* document)
+{
+	return new QTextDocumentFragment(static_cast<QTextDocument*>(document));
+}
+
+void* QTextDocumentFragment_NewQTextDocumentFragment4(void* other)
+{
+	return new QTextDocumentFragment(*static_cast<QTextDocumentFragment*>(other));
+}
+
+void QTextDocumentFragment_DestroyQTextDocumentFragment(void* ptr)
+{
+	static_cast<QTextDocumentFragment*>(ptr)->~QTextDocumentFragment();
+}
+
+struct QtGui_PackedString QTextDocumentFragment_ToHtml(void* ptr, void* encoding)
+{
+	return ({ QByteArray t6dea0f = static_cast<QTextDocumentFragment*>(ptr)->toHtml(*static_cast<QByteArray*>(encoding)).toUtf8(); QtGui_PackedString { const_cast<char*>(t6dea0f.prepend("WHITESPACE").constData()+10), t6dea0f.size()-10 }; });
+}
+
+struct QtGui_PackedString QTextDocumentFragment_ToPlainText(void* ptr)
+{
+	return ({ QByteArray td3666e = static_cast<QTextDocumentFragment*>(ptr)->toPlainText().toUtf8(); QtGui_PackedString { const_cast<char*>(td3666e.prepend("WHITESPACE").constData()+10), td3666e.size()-10 }; });
+}
+
+char QTextDocumentFragment_IsEmpty(void* ptr)
+{
+	return static_cast<QTextDocumentFragment*>(ptr)->isEmpty();
+}
+
+struct QtGui_PackedString QTextDocumentWriter_QTextDocumentWriter_SupportedDocumentFormats()
+{
+	return ({ long long t35469alen; char* t35469a = goPackStringList(QTextDocumentWriter::supportedDocumentFormats(), &t35469alen); QtGui_PackedString { t35469a, t35469alen }; });
+}
+
+void* QTextDocumentWriter_NewQTextDocumentWriter()
+{
+	return new QTextDocumentWriter();
+}
+
+void* QTextDocumentWriter_NewQTextDocumentWriter2(void* device, void* format)
+{
+	return new QTextDocumentWriter(static_cast<QIODevice*>(device), *static_cast<QByteArray*>(format));
+}
+
+void* QTextDocumentWriter_NewQTextDocumentWriter3(char* fileName, void* format)
+{
+	return new QTextDocumentWriter(QString(fileName), *static_cast<QByteArray*>(format));
+}
+
+char QTextDocumentWriter_Write(void* ptr, void* document)
+{
+	return static_cast<QTextDocumentWriter*>(ptr)->write(static_cast<QTextDocument*>(document));
+}
+
+char QTextDocumentWriter_Write2(void* ptr, void* fragment)
+{
+	return static_cast<QTextDocumentWriter*>(ptr)->write(*static_cast<QTextDocumentFragment*>(fragment));
+}
+
+void QTextDocumentWriter_SetCodec(void* ptr, void* codec)
+{
+	static_cast<QTextDocumentWriter*>(ptr)->setCodec(static_cast<QTextCodec*>(codec));
+}
+
+void QTextDocumentWriter_SetDevice(void* ptr, void* device)
+{
+	static_cast<QTextDocumentWriter*>(ptr)->setDevice(static_cast<QIODevice*>(device));
+}
+
+void QTextDocumentWriter_SetFileName(void* ptr, char* fileName)
+{
+	static_cast<QTextDocumentWriter*>(ptr)->setFileName(QString(fileName));
+}
+
+void QTextDocumentWriter_SetFormat(void* ptr, void* format)
+{
+	static_cast<QTextDocumentWriter*>(ptr)->setFormat(*static_cast<QByteArray*>(format));
+}
+
+void QTextDocumentWriter_DestroyQTextDocumentWriter(void* ptr)
+{
+	static_cast<QTextDocumentWriter*>(ptr)->~QTextDocumentWriter();
+}
+
+void* QTextDocumentWriter_Format(void* ptr)
+{
+	return new QByteArray(static_cast<QTextDocumentWriter*>(ptr)->format());
+}
+
+void* QTextDocumentWriter_Device(void* ptr)
+{
+	return static_cast<QTextDocumentWriter*>(ptr)->device();
+}
+
+struct QtGui_PackedString QTextDocumentWriter_FileName(void* ptr)
+{
+	return ({ QByteArray tbc6b5c = static_cast<QTextDocumentWriter*>(ptr)->fileName().toUtf8(); QtGui_PackedString { const_cast<char*>(tbc6b5c.prepend("WHITESPACE").constData()+10), tbc6b5c.size()-10 }; });
+}
+
+void* QTextDocumentWriter_Codec(void* ptr)
+{
+	return static_cast<QTextDocumentWriter*>(ptr)->codec();
+}
+
+void* QTextDocumentWriter___supportedDocumentFormats_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTextDocumentWriter___supportedDocumentFormats_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTextDocumentWriter___supportedDocumentFormats_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QTextFormat_NewQTextFormat3(void* other)
+{
+	return new QTextFormat(*static_cast<QTextFormat*>(other));
+}
+
+void* QTextFormat_NewQTextFormat()
+{
+	return new QTextFormat();
+}
+
+void* QTextFormat_NewQTextFormat2(int ty)
+{
+	return new QTextFormat(ty);
+}
+
+void QTextFormat_ClearBackground(void* ptr)
+{
+	static_cast<QTextFormat*>(ptr)->clearBackground();
+}
+
+void QTextFormat_ClearForeground(void* ptr)
+{
+	static_cast<QTextFormat*>(ptr)->clearForeground();
+}
+
+void QTextFormat_ClearProperty(void* ptr, int propertyId)
+{
+	static_cast<QTextFormat*>(ptr)->clearProperty(propertyId);
+}
+
+void QTextFormat_Merge(void* ptr, void* other)
+{
+	static_cast<QTextFormat*>(ptr)->merge(*static_cast<QTextFormat*>(other));
+}
+
+void QTextFormat_SetBackground(void* ptr, void* brush)
+{
+	static_cast<QTextFormat*>(ptr)->setBackground(*static_cast<QBrush*>(brush));
+}
+
+void QTextFormat_SetForeground(void* ptr, void* brush)
+{
+	static_cast<QTextFormat*>(ptr)->setForeground(*static_cast<QBrush*>(brush));
+}
+
+void QTextFormat_SetLayoutDirection(void* ptr, long long direction)
+{
+	static_cast<QTextFormat*>(ptr)->setLayoutDirection(static_cast<Qt::LayoutDirection>(direction));
+}
+
+void QTextFormat_SetObjectIndex(void* ptr, int index)
+{
+	static_cast<QTextFormat*>(ptr)->setObjectIndex(index);
+}
+
+void QTextFormat_SetObjectType(void* ptr, int ty)
+{
+	static_cast<QTextFormat*>(ptr)->setObjectType(ty);
+}
+
+void QTextFormat_SetProperty(void* ptr, int propertyId, void* value)
+{
+	static_cast<QTextFormat*>(ptr)->setProperty(propertyId, *static_cast<QVariant*>(value));
+}
+
+void QTextFormat_SetProperty2(void* ptr, int propertyId, void* value)
+{
+	static_cast<QTextFormat*>(ptr)->setProperty(propertyId, *static_cast<QVector<QTextLength>*>(value));
+}
+
+void QTextFormat_Swap(void* ptr, void* other)
+{
+	static_cast<QTextFormat*>(ptr)->swap(*static_cast<QTextFormat*>(other));
+}
+
+void QTextFormat_DestroyQTextFormat(void* ptr)
+{
+	static_cast<QTextFormat*>(ptr)->~QTextFormat();
+}
+
+void* QTextFormat_Background(void* ptr)
+{
+	return new QBrush(static_cast<QTextFormat*>(ptr)->background());
+}
+
+void* QTextFormat_BrushProperty(void* ptr, int propertyId)
+{
+	return new QBrush(static_cast<QTextFormat*>(ptr)->brushProperty(propertyId));
+}
+
+void* QTextFormat_Foreground(void* ptr)
+{
+	return new QBrush(static_cast<QTextFormat*>(ptr)->foreground());
+}
+
+void* QTextFormat_ColorProperty(void* ptr, int propertyId)
+{
+	return new QColor(static_cast<QTextFormat*>(ptr)->colorProperty(propertyId));
+}
+
+struct QtGui_PackedList QTextFormat_Properties(void* ptr)
+{
+	return ({ QMap<int, QVariant>* tmpValue = new QMap<int, QVariant>(static_cast<QTextFormat*>(ptr)->properties()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QTextFormat_PenProperty(void* ptr, int propertyId)
+{
+	return new QPen(static_cast<QTextFormat*>(ptr)->penProperty(propertyId));
+}
+
+struct QtGui_PackedString QTextFormat_StringProperty(void* ptr, int propertyId)
+{
+	return ({ QByteArray tb40d27 = static_cast<QTextFormat*>(ptr)->stringProperty(propertyId).toUtf8(); QtGui_PackedString { const_cast<char*>(tb40d27.prepend("WHITESPACE").constData()+10), tb40d27.size()-10 }; });
+}
+
+void* QTextFormat_ToBlockFormat(void* ptr)
+{
+	return new QTextBlockFormat(static_cast<QTextFormat*>(ptr)->toBlockFormat());
+}
+
+void* QTextFormat_ToCharFormat(void* ptr)
+{
+	return new QTextCharFormat(static_cast<QTextFormat*>(ptr)->toCharFormat());
+}
+
+void* QTextFormat_ToFrameFormat(void* ptr)
+{
+	return new QTextFrameFormat(static_cast<QTextFormat*>(ptr)->toFrameFormat());
+}
+
+void* QTextFormat_ToImageFormat(void* ptr)
+{
+	return new QTextImageFormat(static_cast<QTextFormat*>(ptr)->toImageFormat());
+}
+
+void* QTextFormat_LengthProperty(void* ptr, int propertyId)
+{
+	return new QTextLength(static_cast<QTextFormat*>(ptr)->lengthProperty(propertyId));
+}
+
+void* QTextFormat_ToListFormat(void* ptr)
+{
+	return new QTextListFormat(static_cast<QTextFormat*>(ptr)->toListFormat());
+}
+
+void* QTextFormat_ToTableCellFormat(void* ptr)
+{
+	return new QTextTableCellFormat(static_cast<QTextFormat*>(ptr)->toTableCellFormat());
+}
+
+void* QTextFormat_ToTableFormat(void* ptr)
+{
+	return new QTextTableFormat(static_cast<QTextFormat*>(ptr)->toTableFormat());
+}
+
+void* QTextFormat_Property(void* ptr, int propertyId)
+{
+	return new QVariant(static_cast<QTextFormat*>(ptr)->property(propertyId));
+}
+
+long long QTextFormat_LayoutDirection(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->layoutDirection();
+}
+
+char QTextFormat_BoolProperty(void* ptr, int propertyId)
+{
+	return static_cast<QTextFormat*>(ptr)->boolProperty(propertyId);
+}
+
+char QTextFormat_HasProperty(void* ptr, int propertyId)
+{
+	return static_cast<QTextFormat*>(ptr)->hasProperty(propertyId);
+}
+
+char QTextFormat_IsBlockFormat(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->isBlockFormat();
+}
+
+char QTextFormat_IsCharFormat(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->isCharFormat();
+}
+
+char QTextFormat_IsEmpty(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->isEmpty();
+}
+
+char QTextFormat_IsFrameFormat(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->isFrameFormat();
+}
+
+char QTextFormat_IsImageFormat(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->isImageFormat();
+}
+
+char QTextFormat_IsListFormat(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->isListFormat();
+}
+
+char QTextFormat_IsTableCellFormat(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->isTableCellFormat();
+}
+
+char QTextFormat_IsTableFormat(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->isTableFormat();
+}
+
+char QTextFormat_IsValid(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->isValid();
+}
+
+int QTextFormat_IntProperty(void* ptr, int propertyId)
+{
+	return static_cast<QTextFormat*>(ptr)->intProperty(propertyId);
+}
+
+int QTextFormat_ObjectIndex(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->objectIndex();
+}
+
+int QTextFormat_ObjectType(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->objectType();
+}
+
+int QTextFormat_PropertyCount(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->propertyCount();
+}
+
+int QTextFormat_Type(void* ptr)
+{
+	return static_cast<QTextFormat*>(ptr)->type();
+}
+
+double QTextFormat_DoubleProperty(void* ptr, int propertyId)
+{
+	return static_cast<QTextFormat*>(ptr)->doubleProperty(propertyId);
+}
+
+void* QTextFormat___setProperty_value_atList2(void* ptr, int i)
+{
+	return new QTextLength(static_cast<QVector<QTextLength>*>(ptr)->at(i));
+}
+
+void QTextFormat___setProperty_value_setList2(void* ptr, void* i)
+{
+	static_cast<QVector<QTextLength>*>(ptr)->append(*static_cast<QTextLength*>(i));
+}
+
+void* QTextFormat___setProperty_value_newList2(void* ptr)
+{
+	return new QVector<QTextLength>;
+}
+
+void* QTextFormat___properties_atList(void* ptr, int i)
+{
+	return new QVariant(static_cast<QMap<int, QVariant>*>(ptr)->value(i));
+}
+
+void QTextFormat___properties_setList(void* ptr, int key, void* i)
+{
+	static_cast<QMap<int, QVariant>*>(ptr)->insert(key, *static_cast<QVariant*>(i));
+}
+
+void* QTextFormat___properties_newList(void* ptr)
+{
+	return new QMap<int, QVariant>;
+}
+
+struct QtGui_PackedList QTextFormat___properties_keyList(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QMap<int, QVariant>*>(ptr)->keys()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QTextFormat___lengthVectorProperty_atList(void* ptr, int i)
+{
+	return new QTextLength(static_cast<QVector<QTextLength>*>(ptr)->at(i));
+}
+
+void QTextFormat___lengthVectorProperty_setList(void* ptr, void* i)
+{
+	static_cast<QVector<QTextLength>*>(ptr)->append(*static_cast<QTextLength*>(i));
+}
+
+void* QTextFormat___lengthVectorProperty_newList(void* ptr)
+{
+	return new QVector<QTextLength>;
+}
+
+int QTextFormat_____properties_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QTextFormat_____properties_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QTextFormat_____properties_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QTextFormat_____properties_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QTextFormat_____properties_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void* QTextFragment_NewQTextFragment()
+{
+	return new QTextFragment();
+}
+
+void* QTextFragment_NewQTextFragment3(void* other)
+{
+	return new QTextFragment(*static_cast<QTextFragment*>(other));
+}
+
+struct QtGui_PackedList QTextFragment_GlyphRuns(void* ptr, int pos, int len)
+{
+	return ({ QList<QGlyphRun>* tmpValue = new QList<QGlyphRun>(static_cast<QTextFragment*>(ptr)->glyphRuns(pos, len)); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtGui_PackedString QTextFragment_Text(void* ptr)
+{
+	return ({ QByteArray t644af9 = static_cast<QTextFragment*>(ptr)->text().toUtf8(); QtGui_PackedString { const_cast<char*>(t644af9.prepend("WHITESPACE").constData()+10), t644af9.size()-10 }; });
+}
+
+void* QTextFragment_CharFormat(void* ptr)
+{
+	return new QTextCharFormat(static_cast<QTextFragment*>(ptr)->charFormat());
+}
+
+char QTextFragment_Contains(void* ptr, int position)
+{
+	return static_cast<QTextFragment*>(ptr)->contains(position);
+}
+
+char QTextFragment_IsValid(void* ptr)
+{
+	return static_cast<QTextFragment*>(ptr)->isValid();
+}
+
+int QTextFragment_CharFormatIndex(void* ptr)
+{
+	return static_cast<QTextFragment*>(ptr)->charFormatIndex();
+}
+
+int QTextFragment_Length(void* ptr)
+{
+	return static_cast<QTextFragment*>(ptr)->length();
+}
+
+int QTextFragment_Position(void* ptr)
+{
+	return static_cast<QTextFragment*>(ptr)->position();
+}
+
+void* QTextFragment___glyphRuns_atList(void* ptr, int i)
+{
+	return new QGlyphRun(static_cast<QList<QGlyphRun>*>(ptr)->at(i));
+}
+
+void QTextFragment___glyphRuns_setList(void* ptr, void* i)
+{
+	static_cast<QList<QGlyphRun>*>(ptr)->append(*static_cast<QGlyphRun*>(i));
+}
+
+void* QTextFragment___glyphRuns_newList(void* ptr)
+{
+	return new QList<QGlyphRun>;
+}
+
+class MyQTextFrame: public QTextFrame
+{
+public:
+	MyQTextFrame(QTextDocument *document) : QTextFrame(document) {};
+	bool event(QEvent * e) { return callbackQTextObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQTextObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQTextObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQTextObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQTextObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQTextObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQTextObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQTextObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQTextObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQTextObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQTextObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QTextFrame_NewQTextFrame(void* document)
+{
+	return new MyQTextFrame(static_cast<QTextDocument*>(document));
+}
+
+void QTextFrame_SetFrameFormat(void* ptr, void* format)
+{
+	static_cast<QTextFrame*>(ptr)->setFrameFormat(*static_cast<QTextFrameFormat*>(format));
+}
+
+void QTextFrame_DestroyQTextFrame(void* ptr)
+{
+	static_cast<QTextFrame*>(ptr)->~QTextFrame();
+}
+
+struct QtGui_PackedList QTextFrame_ChildFrames(void* ptr)
+{
+	return ({ QList<QTextFrame *>* tmpValue = new QList<QTextFrame *>(static_cast<QTextFrame*>(ptr)->childFrames()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QTextFrame_FirstCursorPosition(void* ptr)
+{
+	return new QTextCursor(static_cast<QTextFrame*>(ptr)->firstCursorPosition());
+}
+
+void* QTextFrame_LastCursorPosition(void* ptr)
+{
+	return new QTextCursor(static_cast<QTextFrame*>(ptr)->lastCursorPosition());
+}
+
+void* QTextFrame_ParentFrame(void* ptr)
+{
+	return static_cast<QTextFrame*>(ptr)->parentFrame();
+}
+
+void* QTextFrame_FrameFormat(void* ptr)
+{
+	return new QTextFrameFormat(static_cast<QTextFrame*>(ptr)->frameFormat());
+}
+
+int QTextFrame_FirstPosition(void* ptr)
+{
+	return static_cast<QTextFrame*>(ptr)->firstPosition();
+}
+
+int QTextFrame_LastPosition(void* ptr)
+{
+	return static_cast<QTextFrame*>(ptr)->lastPosition();
+}
+
+void* QTextFrame___childFrames_atList(void* ptr, int i)
+{
+	return const_cast<QTextFrame*>(static_cast<QList<QTextFrame *>*>(ptr)->at(i));
+}
+
+void QTextFrame___childFrames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QTextFrame *>*>(ptr)->append(static_cast<QTextFrame*>(i));
+}
+
+void* QTextFrame___childFrames_newList(void* ptr)
+{
+	return new QList<QTextFrame *>;
+}
+
+void* QTextFrameFormat_NewQTextFrameFormat()
+{
+	return new QTextFrameFormat();
+}
+
+void QTextFrameFormat_SetBorder(void* ptr, double width)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setBorder(width);
+}
+
+void QTextFrameFormat_SetBorderBrush(void* ptr, void* brush)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setBorderBrush(*static_cast<QBrush*>(brush));
+}
+
+void QTextFrameFormat_SetBorderStyle(void* ptr, long long style)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setBorderStyle(static_cast<QTextFrameFormat::BorderStyle>(style));
+}
+
+void QTextFrameFormat_SetBottomMargin(void* ptr, double margin)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setBottomMargin(margin);
+}
+
+void QTextFrameFormat_SetHeight(void* ptr, void* height)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setHeight(*static_cast<QTextLength*>(height));
+}
+
+void QTextFrameFormat_SetHeight2(void* ptr, double height)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setHeight(height);
+}
+
+void QTextFrameFormat_SetLeftMargin(void* ptr, double margin)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setLeftMargin(margin);
+}
+
+void QTextFrameFormat_SetMargin(void* ptr, double margin)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setMargin(margin);
+}
+
+void QTextFrameFormat_SetPadding(void* ptr, double width)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setPadding(width);
+}
+
+void QTextFrameFormat_SetPageBreakPolicy(void* ptr, long long policy)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setPageBreakPolicy(static_cast<QTextFormat::PageBreakFlag>(policy));
+}
+
+void QTextFrameFormat_SetPosition(void* ptr, long long policy)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setPosition(static_cast<QTextFrameFormat::Position>(policy));
+}
+
+void QTextFrameFormat_SetRightMargin(void* ptr, double margin)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setRightMargin(margin);
+}
+
+void QTextFrameFormat_SetTopMargin(void* ptr, double margin)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setTopMargin(margin);
+}
+
+void QTextFrameFormat_SetWidth(void* ptr, void* width)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setWidth(*static_cast<QTextLength*>(width));
+}
+
+void QTextFrameFormat_SetWidth2(void* ptr, double width)
+{
+	static_cast<QTextFrameFormat*>(ptr)->setWidth(width);
+}
+
+long long QTextFrameFormat_BorderStyle(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->borderStyle();
+}
+
+long long QTextFrameFormat_PageBreakPolicy(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->pageBreakPolicy();
+}
+
+long long QTextFrameFormat_Position(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->position();
+}
+
+void* QTextFrameFormat_BorderBrush(void* ptr)
+{
+	return new QBrush(static_cast<QTextFrameFormat*>(ptr)->borderBrush());
+}
+
+void* QTextFrameFormat_Height(void* ptr)
+{
+	return new QTextLength(static_cast<QTextFrameFormat*>(ptr)->height());
+}
+
+void* QTextFrameFormat_Width(void* ptr)
+{
+	return new QTextLength(static_cast<QTextFrameFormat*>(ptr)->width());
+}
+
+double QTextFrameFormat_Border(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->border();
+}
+
+double QTextFrameFormat_BottomMargin(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->bottomMargin();
+}
+
+double QTextFrameFormat_LeftMargin(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->leftMargin();
+}
+
+double QTextFrameFormat_Margin(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->margin();
+}
+
+double QTextFrameFormat_Padding(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->padding();
+}
+
+double QTextFrameFormat_RightMargin(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->rightMargin();
+}
+
+double QTextFrameFormat_TopMargin(void* ptr)
+{
+	return static_cast<QTextFrameFormat*>(ptr)->topMargin();
+}
+
+void* QTextImageFormat_NewQTextImageFormat()
+{
+	return new QTextImageFormat();
+}
+
+void QTextImageFormat_SetHeight(void* ptr, double height)
+{
+	static_cast<QTextImageFormat*>(ptr)->setHeight(height);
+}
+
+void QTextImageFormat_SetName(void* ptr, char* name)
+{
+	static_cast<QTextImageFormat*>(ptr)->setName(QString(name));
+}
+
+void QTextImageFormat_SetWidth(void* ptr, double width)
+{
+	static_cast<QTextImageFormat*>(ptr)->setWidth(width);
+}
+
+struct QtGui_PackedString QTextImageFormat_Name(void* ptr)
+{
+	return ({ QByteArray t290038 = static_cast<QTextImageFormat*>(ptr)->name().toUtf8(); QtGui_PackedString { const_cast<char*>(t290038.prepend("WHITESPACE").constData()+10), t290038.size()-10 }; });
+}
+
+double QTextImageFormat_Height(void* ptr)
+{
+	return static_cast<QTextImageFormat*>(ptr)->height();
+}
+
+double QTextImageFormat_Width(void* ptr)
+{
+	return static_cast<QTextImageFormat*>(ptr)->width();
+}
+
+void QTextInlineObject_SetAscent(void* ptr, double a)
+{
+	static_cast<QTextInlineObject*>(ptr)->setAscent(a);
+}
+
+void QTextInlineObject_SetDescent(void* ptr, double d)
+{
+	static_cast<QTextInlineObject*>(ptr)->setDescent(d);
+}
+
+void QTextInlineObject_SetWidth(void* ptr, double w)
+{
+	static_cast<QTextInlineObject*>(ptr)->setWidth(w);
+}
+
+void* QTextInlineObject_Rect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QTextInlineObject*>(ptr)->rect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QTextInlineObject_Format(void* ptr)
+{
+	return new QTextFormat(static_cast<QTextInlineObject*>(ptr)->format());
+}
+
+long long QTextInlineObject_TextDirection(void* ptr)
+{
+	return static_cast<QTextInlineObject*>(ptr)->textDirection();
+}
+
+char QTextInlineObject_IsValid(void* ptr)
+{
+	return static_cast<QTextInlineObject*>(ptr)->isValid();
+}
+
+int QTextInlineObject_FormatIndex(void* ptr)
+{
+	return static_cast<QTextInlineObject*>(ptr)->formatIndex();
+}
+
+int QTextInlineObject_TextPosition(void* ptr)
+{
+	return static_cast<QTextInlineObject*>(ptr)->textPosition();
+}
+
+double QTextInlineObject_Ascent(void* ptr)
+{
+	return static_cast<QTextInlineObject*>(ptr)->ascent();
+}
+
+double QTextInlineObject_Descent(void* ptr)
+{
+	return static_cast<QTextInlineObject*>(ptr)->descent();
+}
+
+double QTextInlineObject_Height(void* ptr)
+{
+	return static_cast<QTextInlineObject*>(ptr)->height();
+}
+
+double QTextInlineObject_Width(void* ptr)
+{
+	return static_cast<QTextInlineObject*>(ptr)->width();
+}
+
+void* QTextItem_Font(void* ptr)
+{
+	return new QFont(static_cast<QTextItem*>(ptr)->font());
+}
+
+struct QtGui_PackedString QTextItem_Text(void* ptr)
+{
+	return ({ QByteArray te8cb06 = static_cast<QTextItem*>(ptr)->text().toUtf8(); QtGui_PackedString { const_cast<char*>(te8cb06.prepend("WHITESPACE").constData()+10), te8cb06.size()-10 }; });
+}
+
+long long QTextItem_RenderFlags(void* ptr)
+{
+	return static_cast<QTextItem*>(ptr)->renderFlags();
+}
+
+double QTextItem_Ascent(void* ptr)
+{
+	return static_cast<QTextItem*>(ptr)->ascent();
+}
+
+double QTextItem_Descent(void* ptr)
+{
+	return static_cast<QTextItem*>(ptr)->descent();
+}
+
+double QTextItem_Width(void* ptr)
+{
+	return static_cast<QTextItem*>(ptr)->width();
+}
+
+void* QTextLayout_NewQTextLayout()
+{
+	return new QTextLayout();
+}
+
+void* QTextLayout_NewQTextLayout2(char* text)
+{
+	return new QTextLayout(QString(text));
+}
+
+void* QTextLayout_NewQTextLayout3(char* text, void* font, void* paintdevice)
+{
+	return new QTextLayout(QString(text), *static_cast<QFont*>(font), static_cast<QPaintDevice*>(paintdevice));
+}
+
+void* QTextLayout_CreateLine(void* ptr)
+{
+	return new QTextLine(static_cast<QTextLayout*>(ptr)->createLine());
+}
+
+void QTextLayout_BeginLayout(void* ptr)
+{
+	static_cast<QTextLayout*>(ptr)->beginLayout();
+}
+
+void QTextLayout_ClearFormats(void* ptr)
+{
+	static_cast<QTextLayout*>(ptr)->clearFormats();
+}
+
+void QTextLayout_ClearLayout(void* ptr)
+{
+	static_cast<QTextLayout*>(ptr)->clearLayout();
+}
+
+void QTextLayout_EndLayout(void* ptr)
+{
+	static_cast<QTextLayout*>(ptr)->endLayout();
+}
+
+void QTextLayout_SetCacheEnabled(void* ptr, char enable)
+{
+	static_cast<QTextLayout*>(ptr)->setCacheEnabled(enable != 0);
+}
+
+void QTextLayout_SetCursorMoveStyle(void* ptr, long long style)
+{
+	static_cast<QTextLayout*>(ptr)->setCursorMoveStyle(static_cast<Qt::CursorMoveStyle>(style));
+}
+
+void QTextLayout_SetFont(void* ptr, void* font)
+{
+	static_cast<QTextLayout*>(ptr)->setFont(*static_cast<QFont*>(font));
+}
+
+void QTextLayout_SetPosition(void* ptr, void* p)
+{
+	static_cast<QTextLayout*>(ptr)->setPosition(*static_cast<QPointF*>(p));
+}
+
+void QTextLayout_SetPreeditArea(void* ptr, int position, char* text)
+{
+	static_cast<QTextLayout*>(ptr)->setPreeditArea(position, QString(text));
+}
+
+void QTextLayout_SetText(void* ptr, char* stri)
+{
+	static_cast<QTextLayout*>(ptr)->setText(QString(stri));
+}
+
+void QTextLayout_SetTextOption(void* ptr, void* option)
+{
+	static_cast<QTextLayout*>(ptr)->setTextOption(*static_cast<QTextOption*>(option));
+}
+
+void QTextLayout_DestroyQTextLayout(void* ptr)
+{
+	static_cast<QTextLayout*>(ptr)->~QTextLayout();
+}
+
+void* QTextLayout_Font(void* ptr)
+{
+	return new QFont(static_cast<QTextLayout*>(ptr)->font());
+}
+
+struct QtGui_PackedList QTextLayout_GlyphRuns(void* ptr, int from, int length)
+{
+	return ({ QList<QGlyphRun>* tmpValue = new QList<QGlyphRun>(static_cast<QTextLayout*>(ptr)->glyphRuns(from, length)); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QTextLayout_Position(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QTextLayout*>(ptr)->position(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QTextLayout_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QTextLayout*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtGui_PackedString QTextLayout_PreeditAreaText(void* ptr)
+{
+	return ({ QByteArray t04bdaa = static_cast<QTextLayout*>(ptr)->preeditAreaText().toUtf8(); QtGui_PackedString { const_cast<char*>(t04bdaa.prepend("WHITESPACE").constData()+10), t04bdaa.size()-10 }; });
+}
+
+struct QtGui_PackedString QTextLayout_Text(void* ptr)
+{
+	return ({ QByteArray t7e8d3c = static_cast<QTextLayout*>(ptr)->text().toUtf8(); QtGui_PackedString { const_cast<char*>(t7e8d3c.prepend("WHITESPACE").constData()+10), t7e8d3c.size()-10 }; });
+}
+
+void* QTextLayout_LineAt(void* ptr, int i)
+{
+	return new QTextLine(static_cast<QTextLayout*>(ptr)->lineAt(i));
+}
+
+void* QTextLayout_LineForTextPosition(void* ptr, int pos)
+{
+	return new QTextLine(static_cast<QTextLayout*>(ptr)->lineForTextPosition(pos));
+}
+
+long long QTextLayout_CursorMoveStyle(void* ptr)
+{
+	return static_cast<QTextLayout*>(ptr)->cursorMoveStyle();
+}
+
+char QTextLayout_CacheEnabled(void* ptr)
+{
+	return static_cast<QTextLayout*>(ptr)->cacheEnabled();
+}
+
+char QTextLayout_IsValidCursorPosition(void* ptr, int pos)
+{
+	return static_cast<QTextLayout*>(ptr)->isValidCursorPosition(pos);
+}
+
+void* QTextLayout_TextOption(void* ptr)
+{
+	return const_cast<QTextOption*>(&static_cast<QTextLayout*>(ptr)->textOption());
+}
+
+int QTextLayout_LeftCursorPosition(void* ptr, int oldPos)
+{
+	return static_cast<QTextLayout*>(ptr)->leftCursorPosition(oldPos);
+}
+
+int QTextLayout_LineCount(void* ptr)
+{
+	return static_cast<QTextLayout*>(ptr)->lineCount();
+}
+
+int QTextLayout_NextCursorPosition(void* ptr, int oldPos, long long mode)
+{
+	return static_cast<QTextLayout*>(ptr)->nextCursorPosition(oldPos, static_cast<QTextLayout::CursorMode>(mode));
+}
+
+int QTextLayout_PreeditAreaPosition(void* ptr)
+{
+	return static_cast<QTextLayout*>(ptr)->preeditAreaPosition();
+}
+
+int QTextLayout_PreviousCursorPosition(void* ptr, int oldPos, long long mode)
+{
+	return static_cast<QTextLayout*>(ptr)->previousCursorPosition(oldPos, static_cast<QTextLayout::CursorMode>(mode));
+}
+
+int QTextLayout_RightCursorPosition(void* ptr, int oldPos)
+{
+	return static_cast<QTextLayout*>(ptr)->rightCursorPosition(oldPos);
+}
+
+double QTextLayout_MaximumWidth(void* ptr)
+{
+	return static_cast<QTextLayout*>(ptr)->maximumWidth();
+}
+
+double QTextLayout_MinimumWidth(void* ptr)
+{
+	return static_cast<QTextLayout*>(ptr)->minimumWidth();
+}
+
+void QTextLayout_DrawCursor2(void* ptr, void* painter, void* position, int cursorPosition)
+{
+	static_cast<QTextLayout*>(ptr)->drawCursor(static_cast<QPainter*>(painter), *static_cast<QPointF*>(position), cursorPosition);
+}
+
+void QTextLayout_DrawCursor(void* ptr, void* painter, void* position, int cursorPosition, int width)
+{
+	static_cast<QTextLayout*>(ptr)->drawCursor(static_cast<QPainter*>(painter), *static_cast<QPointF*>(position), cursorPosition, width);
+}
+
+void* QTextLayout___glyphRuns_atList(void* ptr, int i)
+{
+	return new QGlyphRun(static_cast<QList<QGlyphRun>*>(ptr)->at(i));
+}
+
+void QTextLayout___glyphRuns_setList(void* ptr, void* i)
+{
+	static_cast<QList<QGlyphRun>*>(ptr)->append(*static_cast<QGlyphRun*>(i));
+}
+
+void* QTextLayout___glyphRuns_newList(void* ptr)
+{
+	return new QList<QGlyphRun>;
+}
+
+void* QTextLength_NewQTextLength()
+{
+	return new QTextLength();
+}
+
+void* QTextLength_NewQTextLength2(long long ty, double value)
+{
+	return new QTextLength(static_cast<QTextLength::Type>(ty), value);
+}
+
+long long QTextLength_Type(void* ptr)
+{
+	return static_cast<QTextLength*>(ptr)->type();
+}
+
+double QTextLength_RawValue(void* ptr)
+{
+	return static_cast<QTextLength*>(ptr)->rawValue();
+}
+
+double QTextLength_Value(void* ptr, double maximumLength)
+{
+	return static_cast<QTextLength*>(ptr)->value(maximumLength);
+}
+
+void* QTextLine_NewQTextLine()
+{
+	return new QTextLine();
+}
+
+int QTextLine_XToCursor(void* ptr, double x, long long cpos)
+{
+	return static_cast<QTextLine*>(ptr)->xToCursor(x, static_cast<QTextLine::CursorPosition>(cpos));
+}
+
+void QTextLine_SetLeadingIncluded(void* ptr, char included)
+{
+	static_cast<QTextLine*>(ptr)->setLeadingIncluded(included != 0);
+}
+
+void QTextLine_SetLineWidth(void* ptr, double width)
+{
+	static_cast<QTextLine*>(ptr)->setLineWidth(width);
+}
+
+void QTextLine_SetNumColumns(void* ptr, int numColumns)
+{
+	static_cast<QTextLine*>(ptr)->setNumColumns(numColumns);
+}
+
+void QTextLine_SetNumColumns2(void* ptr, int numColumns, double alignmentWidth)
+{
+	static_cast<QTextLine*>(ptr)->setNumColumns(numColumns, alignmentWidth);
+}
+
+void QTextLine_SetPosition(void* ptr, void* pos)
+{
+	static_cast<QTextLine*>(ptr)->setPosition(*static_cast<QPointF*>(pos));
+}
+
+struct QtGui_PackedList QTextLine_GlyphRuns(void* ptr, int from, int length)
+{
+	return ({ QList<QGlyphRun>* tmpValue = new QList<QGlyphRun>(static_cast<QTextLine*>(ptr)->glyphRuns(from, length)); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QTextLine_Position(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QTextLine*>(ptr)->position(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QTextLine_NaturalTextRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QTextLine*>(ptr)->naturalTextRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QTextLine_Rect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QTextLine*>(ptr)->rect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+char QTextLine_IsValid(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->isValid();
+}
+
+char QTextLine_LeadingIncluded(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->leadingIncluded();
+}
+
+int QTextLine_LineNumber(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->lineNumber();
+}
+
+int QTextLine_TextLength(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->textLength();
+}
+
+int QTextLine_TextStart(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->textStart();
+}
+
+double QTextLine_Ascent(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->ascent();
+}
+
+double QTextLine_CursorToX(void* ptr, int cursorPos, long long edge)
+{
+	return static_cast<QTextLine*>(ptr)->cursorToX(&cursorPos, static_cast<QTextLine::Edge>(edge));
+}
+
+double QTextLine_CursorToX2(void* ptr, int cursorPos, long long edge)
+{
+	return static_cast<QTextLine*>(ptr)->cursorToX(cursorPos, static_cast<QTextLine::Edge>(edge));
+}
+
+double QTextLine_Descent(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->descent();
+}
+
+double QTextLine_Height(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->height();
+}
+
+double QTextLine_HorizontalAdvance(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->horizontalAdvance();
+}
+
+double QTextLine_Leading(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->leading();
+}
+
+double QTextLine_NaturalTextWidth(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->naturalTextWidth();
+}
+
+double QTextLine_Width(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->width();
+}
+
+double QTextLine_X(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->x();
+}
+
+double QTextLine_Y(void* ptr)
+{
+	return static_cast<QTextLine*>(ptr)->y();
+}
+
+void* QTextLine___glyphRuns_atList(void* ptr, int i)
+{
+	return new QGlyphRun(static_cast<QList<QGlyphRun>*>(ptr)->at(i));
+}
+
+void QTextLine___glyphRuns_setList(void* ptr, void* i)
+{
+	static_cast<QList<QGlyphRun>*>(ptr)->append(*static_cast<QGlyphRun*>(i));
+}
+
+void* QTextLine___glyphRuns_newList(void* ptr)
+{
+	return new QList<QGlyphRun>;
+}
+
+class MyQTextList: public QTextList
+{
+public:
+	void blockFormatChanged(const QTextBlock & block) { callbackQTextBlockGroup_BlockFormatChanged(this, const_cast<QTextBlock*>(&block)); };
+	void blockInserted(const QTextBlock & block) { callbackQTextBlockGroup_BlockInserted(this, const_cast<QTextBlock*>(&block)); };
+	void blockRemoved(const QTextBlock & block) { callbackQTextBlockGroup_BlockRemoved(this, const_cast<QTextBlock*>(&block)); };
+	bool event(QEvent * e) { return callbackQTextObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQTextObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQTextObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQTextObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQTextObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQTextObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQTextObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQTextObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQTextObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQTextObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQTextObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QTextList_Add(void* ptr, void* block)
+{
+	static_cast<QTextList*>(ptr)->add(*static_cast<QTextBlock*>(block));
+}
+
+void QTextList_Remove(void* ptr, void* block)
+{
+	static_cast<QTextList*>(ptr)->remove(*static_cast<QTextBlock*>(block));
+}
+
+void QTextList_RemoveItem(void* ptr, int i)
+{
+	static_cast<QTextList*>(ptr)->removeItem(i);
+}
+
+void QTextList_SetFormat(void* ptr, void* format)
+{
+	static_cast<QTextList*>(ptr)->setFormat(*static_cast<QTextListFormat*>(format));
+}
+
+struct QtGui_PackedString QTextList_ItemText(void* ptr, void* block)
+{
+	return ({ QByteArray tedd0af = static_cast<QTextList*>(ptr)->itemText(*static_cast<QTextBlock*>(block)).toUtf8(); QtGui_PackedString { const_cast<char*>(tedd0af.prepend("WHITESPACE").constData()+10), tedd0af.size()-10 }; });
+}
+
+void* QTextList_Item(void* ptr, int i)
+{
+	return new QTextBlock(static_cast<QTextList*>(ptr)->item(i));
+}
+
+void* QTextList_Format(void* ptr)
+{
+	return new QTextListFormat(static_cast<QTextList*>(ptr)->format());
+}
+
+int QTextList_Count(void* ptr)
+{
+	return static_cast<QTextList*>(ptr)->count();
+}
+
+int QTextList_ItemNumber(void* ptr, void* block)
+{
+	return static_cast<QTextList*>(ptr)->itemNumber(*static_cast<QTextBlock*>(block));
+}
+
+void* QTextListFormat_NewQTextListFormat()
+{
+	return new QTextListFormat();
+}
+
+void QTextListFormat_SetIndent(void* ptr, int indentation)
+{
+	static_cast<QTextListFormat*>(ptr)->setIndent(indentation);
+}
+
+void QTextListFormat_SetNumberPrefix(void* ptr, char* numberPrefix)
+{
+	static_cast<QTextListFormat*>(ptr)->setNumberPrefix(QString(numberPrefix));
+}
+
+void QTextListFormat_SetNumberSuffix(void* ptr, char* numberSuffix)
+{
+	static_cast<QTextListFormat*>(ptr)->setNumberSuffix(QString(numberSuffix));
+}
+
+void QTextListFormat_SetStyle(void* ptr, long long style)
+{
+	static_cast<QTextListFormat*>(ptr)->setStyle(static_cast<QTextListFormat::Style>(style));
+}
+
+struct QtGui_PackedString QTextListFormat_NumberPrefix(void* ptr)
+{
+	return ({ QByteArray t46a4a3 = static_cast<QTextListFormat*>(ptr)->numberPrefix().toUtf8(); QtGui_PackedString { const_cast<char*>(t46a4a3.prepend("WHITESPACE").constData()+10), t46a4a3.size()-10 }; });
+}
+
+struct QtGui_PackedString QTextListFormat_NumberSuffix(void* ptr)
+{
+	return ({ QByteArray t6ba6a5 = static_cast<QTextListFormat*>(ptr)->numberSuffix().toUtf8(); QtGui_PackedString { const_cast<char*>(t6ba6a5.prepend("WHITESPACE").constData()+10), t6ba6a5.size()-10 }; });
+}
+
+long long QTextListFormat_Style(void* ptr)
+{
+	return static_cast<QTextListFormat*>(ptr)->style();
+}
+
+int QTextListFormat_Indent(void* ptr)
+{
+	return static_cast<QTextListFormat*>(ptr)->indent();
+}
+
+class MyQTextObject: public QTextObject
+{
+public:
+	MyQTextObject(QTextDocument *document) : QTextObject(document) {};
+	bool event(QEvent * e) { return callbackQTextObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQTextObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQTextObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQTextObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQTextObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQTextObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQTextObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQTextObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQTextObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQTextObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQTextObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QTextObject_NewQTextObject(void* document)
+{
+	return new MyQTextObject(static_cast<QTextDocument*>(document));
+}
+
+void QTextObject_SetFormat(void* ptr, void* format)
+{
+	static_cast<QTextObject*>(ptr)->setFormat(*static_cast<QTextFormat*>(format));
+}
+
+void QTextObject_DestroyQTextObject(void* ptr)
+{
+	static_cast<QTextObject*>(ptr)->~QTextObject();
+}
+
+void* QTextObject_Document(void* ptr)
+{
+	return static_cast<QTextObject*>(ptr)->document();
+}
+
+void* QTextObject_Format(void* ptr)
+{
+	return new QTextFormat(static_cast<QTextObject*>(ptr)->format());
+}
+
+int QTextObject_FormatIndex(void* ptr)
+{
+	return static_cast<QTextObject*>(ptr)->formatIndex();
+}
+
+int QTextObject_ObjectIndex(void* ptr)
+{
+	return static_cast<QTextObject*>(ptr)->objectIndex();
+}
+
+void* QTextObject___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QTextObject___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QTextObject___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QTextObject___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QTextObject___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QTextObject___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QTextObject___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QTextObject___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QTextObject___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QTextObject___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QTextObject___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QTextObject___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QTextObject___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QTextObject___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QTextObject___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QTextObject_EventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QTextTable*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTextTable*>(ptr)->QTextTable::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QTextFrame*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTextFrame*>(ptr)->QTextFrame::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTextList*>(ptr)->QTextList::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QTextBlockGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::event(static_cast<QEvent*>(e));
+	} else {
+		return static_cast<QTextObject*>(ptr)->QTextObject::event(static_cast<QEvent*>(e));
+	}
+}
+
+char QTextObject_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QTextTable*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextTable*>(ptr)->QTextTable::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextTable*>(ptr)->QTextTable::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextTable*>(ptr)->QTextTable::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextTable*>(ptr)->QTextTable::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QTextTable*>(ptr)->QTextTable::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QTextFrame*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextFrame*>(ptr)->QTextFrame::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextFrame*>(ptr)->QTextFrame::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextFrame*>(ptr)->QTextFrame::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextFrame*>(ptr)->QTextFrame::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QTextFrame*>(ptr)->QTextFrame::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextList*>(ptr)->QTextList::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextList*>(ptr)->QTextList::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextList*>(ptr)->QTextList::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextList*>(ptr)->QTextList::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QTextList*>(ptr)->QTextList::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QTextBlockGroup*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextObject*>(ptr)->QTextObject::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextObject*>(ptr)->QTextObject::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextObject*>(ptr)->QTextObject::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTextObject*>(ptr)->QTextObject::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QTextObject*>(ptr)->QTextObject::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QTextObject_ChildEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QTextTable*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextTable*>(ptr)->QTextTable::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QTextFrame*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextFrame*>(ptr)->QTextFrame::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextList*>(ptr)->QTextList::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QTextBlockGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QTextObject*>(ptr)->QTextObject::childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QTextObject_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QTextTable*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextTable*>(ptr)->QTextTable::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTextFrame*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextFrame*>(ptr)->QTextFrame::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextList*>(ptr)->QTextList::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTextBlockGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QTextObject*>(ptr)->QTextObject::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QTextObject_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QTextTable*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextTable*>(ptr)->QTextTable::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTextFrame*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextFrame*>(ptr)->QTextFrame::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextList*>(ptr)->QTextList::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTextBlockGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QTextObject*>(ptr)->QTextObject::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QTextObject_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QTextTable*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextTable*>(ptr)->QTextTable::deleteLater();
+	} else if (dynamic_cast<QTextFrame*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextFrame*>(ptr)->QTextFrame::deleteLater();
+	} else if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextList*>(ptr)->QTextList::deleteLater();
+	} else if (dynamic_cast<QTextBlockGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::deleteLater();
+	} else {
+		static_cast<QTextObject*>(ptr)->QTextObject::deleteLater();
+	}
+}
+
+void QTextObject_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QTextTable*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextTable*>(ptr)->QTextTable::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTextFrame*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextFrame*>(ptr)->QTextFrame::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextList*>(ptr)->QTextList::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTextBlockGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QTextObject*>(ptr)->QTextObject::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QTextObject_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QTextTable*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextTable*>(ptr)->QTextTable::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QTextFrame*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextFrame*>(ptr)->QTextFrame::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextList*>(ptr)->QTextList::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QTextBlockGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QTextObject*>(ptr)->QTextObject::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void* QTextObject_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QTextTable*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTextTable*>(ptr)->QTextTable::metaObject());
+	} else if (dynamic_cast<QTextFrame*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTextFrame*>(ptr)->QTextFrame::metaObject());
+	} else if (dynamic_cast<QTextList*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTextList*>(ptr)->QTextList::metaObject());
+	} else if (dynamic_cast<QTextBlockGroup*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTextBlockGroup*>(ptr)->QTextBlockGroup::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QTextObject*>(ptr)->QTextObject::metaObject());
+	}
+}
+
+class MyQTextObjectInterface: public QTextObjectInterface
+{
+public:
+	QSizeF intrinsicSize(QTextDocument * doc, int posInDocument, const QTextFormat & format) { return *static_cast<QSizeF*>(callbackQTextObjectInterface_IntrinsicSize(this, doc, posInDocument, const_cast<QTextFormat*>(&format))); };
+	void drawObject(QPainter * painter, const QRectF & rect, QTextDocument * doc, int posInDocument, const QTextFormat & format) { callbackQTextObjectInterface_DrawObject(this, painter, const_cast<QRectF*>(&rect), doc, posInDocument, const_cast<QTextFormat*>(&format)); };
+	 ~MyQTextObjectInterface() { callbackQTextObjectInterface_DestroyQTextObjectInterface(this); };
+};
+
+void* QTextObjectInterface_IntrinsicSize(void* ptr, void* doc, int posInDocument, void* format)
+{
+	return ({ QSizeF tmpValue = static_cast<QTextObjectInterface*>(ptr)->intrinsicSize(static_cast<QTextDocument*>(doc), posInDocument, *static_cast<QTextFormat*>(format)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void QTextObjectInterface_DrawObject(void* ptr, void* painter, void* rect, void* doc, int posInDocument, void* format)
+{
+	static_cast<QTextObjectInterface*>(ptr)->drawObject(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect), static_cast<QTextDocument*>(doc), posInDocument, *static_cast<QTextFormat*>(format));
+}
+
+void QTextObjectInterface_DestroyQTextObjectInterface(void* ptr)
+{
+	static_cast<QTextObjectInterface*>(ptr)->~QTextObjectInterface();
+}
+
+void QTextObjectInterface_DestroyQTextObjectInterfaceDefault(void* ptr)
+{
+
+}
+
+void* QTextOption_NewQTextOption3(void* other)
+{
+	return new QTextOption(*static_cast<QTextOption*>(other));
+}
+
+void* QTextOption_NewQTextOption()
+{
+	return new QTextOption();
+}
+
+void* QTextOption_NewQTextOption2(long long alignment)
+{
+	return new QTextOption(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QTextOption_SetAlignment(void* ptr, long long alignment)
+{
+	static_cast<QTextOption*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QTextOption_SetFlags(void* ptr, long long flags)
+{
+	static_cast<QTextOption*>(ptr)->setFlags(static_cast<QTextOption::Flag>(flags));
+}
+
+void QTextOption_SetTabArray(void* ptr, void* tabStops)
+{
+	static_cast<QTextOption*>(ptr)->setTabArray(*static_cast<QList<qreal>*>(tabStops));
+}
+
+void QTextOption_SetTabStop(void* ptr, double tabStop)
+{
+	static_cast<QTextOption*>(ptr)->setTabStop(tabStop);
+}
+
+void QTextOption_SetTextDirection(void* ptr, long long direction)
+{
+	static_cast<QTextOption*>(ptr)->setTextDirection(static_cast<Qt::LayoutDirection>(direction));
+}
+
+void QTextOption_SetUseDesignMetrics(void* ptr, char enable)
+{
+	static_cast<QTextOption*>(ptr)->setUseDesignMetrics(enable != 0);
+}
+
+void QTextOption_SetWrapMode(void* ptr, long long mode)
+{
+	static_cast<QTextOption*>(ptr)->setWrapMode(static_cast<QTextOption::WrapMode>(mode));
+}
+
+void QTextOption_DestroyQTextOption(void* ptr)
+{
+	static_cast<QTextOption*>(ptr)->~QTextOption();
+}
+
+long long QTextOption_Flags(void* ptr)
+{
+	return static_cast<QTextOption*>(ptr)->flags();
+}
+
+struct QtGui_PackedList QTextOption_TabArray(void* ptr)
+{
+	return ({ QList<qreal>* tmpValue = new QList<qreal>(static_cast<QTextOption*>(ptr)->tabArray()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+long long QTextOption_Alignment(void* ptr)
+{
+	return static_cast<QTextOption*>(ptr)->alignment();
+}
+
+long long QTextOption_TextDirection(void* ptr)
+{
+	return static_cast<QTextOption*>(ptr)->textDirection();
+}
+
+long long QTextOption_WrapMode(void* ptr)
+{
+	return static_cast<QTextOption*>(ptr)->wrapMode();
+}
+
+char QTextOption_UseDesignMetrics(void* ptr)
+{
+	return static_cast<QTextOption*>(ptr)->useDesignMetrics();
+}
+
+double QTextOption_TabStop(void* ptr)
+{
+	return static_cast<QTextOption*>(ptr)->tabStop();
+}
+
+double QTextOption___setTabArray_tabStops_atList(void* ptr, int i)
+{
+	return static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
+void QTextOption___setTabArray_tabStops_setList(void* ptr, double i)
+{
+	static_cast<QList<qreal>*>(ptr)->append(i);
+}
+
+void* QTextOption___setTabArray_tabStops_newList(void* ptr)
+{
+	return new QList<qreal>;
+}
+
+void* QTextOption___setTabArray_tabStops_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<qreal>* tmpList = new QList<qreal>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<double*>(data)[i]); tmpList; });
+}
+
+void QTextOption___setTabArray_tabStops_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<qreal>*>(ptr)->size(); i++) static_cast<double*>(data)[i] = static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
+double QTextOption___tabArray_atList(void* ptr, int i)
+{
+	return static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
+void QTextOption___tabArray_setList(void* ptr, double i)
+{
+	static_cast<QList<qreal>*>(ptr)->append(i);
+}
+
+void* QTextOption___tabArray_newList(void* ptr)
+{
+	return new QList<qreal>;
+}
+
+void* QTextOption___tabArray_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<qreal>* tmpList = new QList<qreal>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<double*>(data)[i]); tmpList; });
+}
+
+void QTextOption___tabArray_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<qreal>*>(ptr)->size(); i++) static_cast<double*>(data)[i] = static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
+class MyQTextTable: public QTextTable
+{
+public:
+	bool event(QEvent * e) { return callbackQTextObject_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQTextObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQTextObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQTextObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQTextObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQTextObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQTextObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQTextObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQTextObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQTextObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQTextObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QTextTable_AppendColumns(void* ptr, int count)
+{
+	static_cast<QTextTable*>(ptr)->appendColumns(count);
+}
+
+void QTextTable_AppendRows(void* ptr, int count)
+{
+	static_cast<QTextTable*>(ptr)->appendRows(count);
+}
+
+void QTextTable_InsertColumns(void* ptr, int index, int columns)
+{
+	static_cast<QTextTable*>(ptr)->insertColumns(index, columns);
+}
+
+void QTextTable_InsertRows(void* ptr, int index, int rows)
+{
+	static_cast<QTextTable*>(ptr)->insertRows(index, rows);
+}
+
+void QTextTable_MergeCells2(void* ptr, void* cursor)
+{
+	static_cast<QTextTable*>(ptr)->mergeCells(*static_cast<QTextCursor*>(cursor));
+}
+
+void QTextTable_MergeCells(void* ptr, int row, int column, int numRows, int numCols)
+{
+	static_cast<QTextTable*>(ptr)->mergeCells(row, column, numRows, numCols);
+}
+
+void QTextTable_RemoveColumns(void* ptr, int index, int columns)
+{
+	static_cast<QTextTable*>(ptr)->removeColumns(index, columns);
+}
+
+void QTextTable_RemoveRows(void* ptr, int index, int rows)
+{
+	static_cast<QTextTable*>(ptr)->removeRows(index, rows);
+}
+
+void QTextTable_Resize(void* ptr, int rows, int columns)
+{
+	static_cast<QTextTable*>(ptr)->resize(rows, columns);
+}
+
+void QTextTable_SetFormat(void* ptr, void* format)
+{
+	static_cast<QTextTable*>(ptr)->setFormat(*static_cast<QTextTableFormat*>(format));
+}
+
+void QTextTable_SplitCell(void* ptr, int row, int column, int numRows, int numCols)
+{
+	static_cast<QTextTable*>(ptr)->splitCell(row, column, numRows, numCols);
+}
+
+void* QTextTable_RowEnd(void* ptr, void* cursor)
+{
+	return new QTextCursor(static_cast<QTextTable*>(ptr)->rowEnd(*static_cast<QTextCursor*>(cursor)));
+}
+
+void* QTextTable_RowStart(void* ptr, void* cursor)
+{
+	return new QTextCursor(static_cast<QTextTable*>(ptr)->rowStart(*static_cast<QTextCursor*>(cursor)));
+}
+
+void* QTextTable_CellAt3(void* ptr, void* cursor)
+{
+	return new QTextTableCell(static_cast<QTextTable*>(ptr)->cellAt(*static_cast<QTextCursor*>(cursor)));
+}
+
+void* QTextTable_CellAt2(void* ptr, int position)
+{
+	return new QTextTableCell(static_cast<QTextTable*>(ptr)->cellAt(position));
+}
+
+void* QTextTable_CellAt(void* ptr, int row, int column)
+{
+	return new QTextTableCell(static_cast<QTextTable*>(ptr)->cellAt(row, column));
+}
+
+void* QTextTable_Format(void* ptr)
+{
+	return new QTextTableFormat(static_cast<QTextTable*>(ptr)->format());
+}
+
+int QTextTable_Columns(void* ptr)
+{
+	return static_cast<QTextTable*>(ptr)->columns();
+}
+
+int QTextTable_Rows(void* ptr)
+{
+	return static_cast<QTextTable*>(ptr)->rows();
+}
+
+void* QTextTableCell_NewQTextTableCell()
+{
+	return new QTextTableCell();
+}
+
+void* QTextTableCell_NewQTextTableCell2(void* other)
+{
+	return new QTextTableCell(*static_cast<QTextTableCell*>(other));
+}
+
+void QTextTableCell_SetFormat(void* ptr, void* format)
+{
+	static_cast<QTextTableCell*>(ptr)->setFormat(*static_cast<QTextCharFormat*>(format));
+}
+
+void QTextTableCell_DestroyQTextTableCell(void* ptr)
+{
+	static_cast<QTextTableCell*>(ptr)->~QTextTableCell();
+}
+
+void* QTextTableCell_Format(void* ptr)
+{
+	return new QTextCharFormat(static_cast<QTextTableCell*>(ptr)->format());
+}
+
+void* QTextTableCell_FirstCursorPosition(void* ptr)
+{
+	return new QTextCursor(static_cast<QTextTableCell*>(ptr)->firstCursorPosition());
+}
+
+void* QTextTableCell_LastCursorPosition(void* ptr)
+{
+	return new QTextCursor(static_cast<QTextTableCell*>(ptr)->lastCursorPosition());
+}
+
+char QTextTableCell_IsValid(void* ptr)
+{
+	return static_cast<QTextTableCell*>(ptr)->isValid();
+}
+
+int QTextTableCell_Column(void* ptr)
+{
+	return static_cast<QTextTableCell*>(ptr)->column();
+}
+
+int QTextTableCell_ColumnSpan(void* ptr)
+{
+	return static_cast<QTextTableCell*>(ptr)->columnSpan();
+}
+
+int QTextTableCell_Row(void* ptr)
+{
+	return static_cast<QTextTableCell*>(ptr)->row();
+}
+
+int QTextTableCell_RowSpan(void* ptr)
+{
+	return static_cast<QTextTableCell*>(ptr)->rowSpan();
+}
+
+int QTextTableCell_TableCellFormatIndex(void* ptr)
+{
+	return static_cast<QTextTableCell*>(ptr)->tableCellFormatIndex();
+}
+
+void* QTextTableCellFormat_NewQTextTableCellFormat()
+{
+	return new QTextTableCellFormat();
+}
+
+void QTextTableCellFormat_SetBottomPadding(void* ptr, double padding)
+{
+	static_cast<QTextTableCellFormat*>(ptr)->setBottomPadding(padding);
+}
+
+void QTextTableCellFormat_SetLeftPadding(void* ptr, double padding)
+{
+	static_cast<QTextTableCellFormat*>(ptr)->setLeftPadding(padding);
+}
+
+void QTextTableCellFormat_SetPadding(void* ptr, double padding)
+{
+	static_cast<QTextTableCellFormat*>(ptr)->setPadding(padding);
+}
+
+void QTextTableCellFormat_SetRightPadding(void* ptr, double padding)
+{
+	static_cast<QTextTableCellFormat*>(ptr)->setRightPadding(padding);
+}
+
+void QTextTableCellFormat_SetTopPadding(void* ptr, double padding)
+{
+	static_cast<QTextTableCellFormat*>(ptr)->setTopPadding(padding);
+}
+
+double QTextTableCellFormat_BottomPadding(void* ptr)
+{
+	return static_cast<QTextTableCellFormat*>(ptr)->bottomPadding();
+}
+
+double QTextTableCellFormat_LeftPadding(void* ptr)
+{
+	return static_cast<QTextTableCellFormat*>(ptr)->leftPadding();
+}
+
+double QTextTableCellFormat_RightPadding(void* ptr)
+{
+	return static_cast<QTextTableCellFormat*>(ptr)->rightPadding();
+}
+
+double QTextTableCellFormat_TopPadding(void* ptr)
+{
+	return static_cast<QTextTableCellFormat*>(ptr)->topPadding();
+}
+
+void* QTextTableFormat_NewQTextTableFormat()
+{
+	return new QTextTableFormat();
+}
+
+void QTextTableFormat_ClearColumnWidthConstraints(void* ptr)
+{
+	static_cast<QTextTableFormat*>(ptr)->clearColumnWidthConstraints();
+}
+
+void QTextTableFormat_SetAlignment(void* ptr, long long alignment)
+{
+	static_cast<QTextTableFormat*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QTextTableFormat_SetCellPadding(void* ptr, double padding)
+{
+	static_cast<QTextTableFormat*>(ptr)->setCellPadding(padding);
+}
+
+void QTextTableFormat_SetCellSpacing(void* ptr, double spacing)
+{
+	static_cast<QTextTableFormat*>(ptr)->setCellSpacing(spacing);
+}
+
+void QTextTableFormat_SetColumnWidthConstraints(void* ptr, void* constraints)
+{
+	static_cast<QTextTableFormat*>(ptr)->setColumnWidthConstraints(*static_cast<QVector<QTextLength>*>(constraints));
+}
+
+void QTextTableFormat_SetHeaderRowCount(void* ptr, int count)
+{
+	static_cast<QTextTableFormat*>(ptr)->setHeaderRowCount(count);
+}
+
+long long QTextTableFormat_Alignment(void* ptr)
+{
+	return static_cast<QTextTableFormat*>(ptr)->alignment();
+}
+
+int QTextTableFormat_Columns(void* ptr)
+{
+	return static_cast<QTextTableFormat*>(ptr)->columns();
+}
+
+int QTextTableFormat_HeaderRowCount(void* ptr)
+{
+	return static_cast<QTextTableFormat*>(ptr)->headerRowCount();
+}
+
+double QTextTableFormat_CellPadding(void* ptr)
+{
+	return static_cast<QTextTableFormat*>(ptr)->cellPadding();
+}
+
+double QTextTableFormat_CellSpacing(void* ptr)
+{
+	return static_cast<QTextTableFormat*>(ptr)->cellSpacing();
+}
+
+void* QTextTableFormat___setColumnWidthConstraints_constraints_atList(void* ptr, int i)
+{
+	return new QTextLength(static_cast<QVector<QTextLength>*>(ptr)->at(i));
+}
+
+void QTextTableFormat___setColumnWidthConstraints_constraints_setList(void* ptr, void* i)
+{
+	static_cast<QVector<QTextLength>*>(ptr)->append(*static_cast<QTextLength*>(i));
+}
+
+void* QTextTableFormat___setColumnWidthConstraints_constraints_newList(void* ptr)
+{
+	return new QVector<QTextLength>;
+}
+
+void* QTextTableFormat___columnWidthConstraints_atList(void* ptr, int i)
+{
+	return new QTextLength(static_cast<QVector<QTextLength>*>(ptr)->at(i));
+}
+
+void QTextTableFormat___columnWidthConstraints_setList(void* ptr, void* i)
+{
+	static_cast<QVector<QTextLength>*>(ptr)->append(*static_cast<QTextLength*>(i));
+}
+
+void* QTextTableFormat___columnWidthConstraints_newList(void* ptr)
+{
+	return new QVector<QTextLength>;
+}
+
+struct QtGui_PackedList QTouchDevice_QTouchDevice_Devices()
+{
+	return ({ QList<const QTouchDevice *>* tmpValue = new QList<const QTouchDevice *>(QTouchDevice::devices()); QtGui_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QTouchDevice_NewQTouchDevice()
+{
+	return new QTouchDevice();
+}
+
+void QTouchDevice_SetCapabilities(void* ptr, long long caps)
+{
+	static_cast<QTouchDevice*>(ptr)->setCapabilities(static_cast<QTouchDevice::CapabilityFlag>(caps));
+}
+
+void QTouchDevice_SetMaximumTouchPoints(void* ptr, int max)
+{
+	static_cast<QTouchDevice*>(ptr)->setMaximumTouchPoints(max);
+}
+
+void QTouchDevice_SetName(void* ptr, char* name)
+{
+	static_cast<QTouchDevice*>(ptr)->setName(QString(name));
+}
+
+void QTouchDevice_SetType(void* ptr, long long devType)
+{
+	static_cast<QTouchDevice*>(ptr)->setType(static_cast<QTouchDevice::DeviceType>(devType));
+}
+
+void QTouchDevice_DestroyQTouchDevice(void* ptr)
+{
+	static_cast<QTouchDevice*>(ptr)->~QTouchDevice();
+}
+
+long long QTouchDevice_Capabilities(void* ptr)
+{
+	return static_cast<QTouchDevice*>(ptr)->capabilities();
+}
+
+long long QTouchDevice_Type(void* ptr)
+{
+	return static_cast<QTouchDevice*>(ptr)->type();
+}
+
+struct QtGui_PackedString QTouchDevice_Name(void* ptr)
+{
+	return ({ QByteArray td71303 = static_cast<QTouchDevice*>(ptr)->name().toUtf8(); QtGui_PackedString { const_cast<char*>(td71303.prepend("WHITESPACE").constData()+10), td71303.size()-10 }; });
+}
+
+int QTouchDevice_MaximumTouchPoints(void* ptr)
+{
+	return static_cast<QTouchDevice*>(ptr)->maximumTouchPoints();
+}
+
+void* QTouchDevice___devices_atList(void* ptr, int i)
+{
+	return const_cast<QTouchDevice*>(static_cast<QList<const QTouchDevice *>*>(ptr)->at(i));
+}
+
+void QTouchDevice___devices_setList(void* ptr, void* i)
+{
+	static_cast<QList<const QTouchDevice *>*>(ptr)->append(static_cast<QTouchDevice*>(i));
+}
+
+void* QTouchDevice___devices_newList(void* ptr)
+{
+	return new QList<const QTouchDevice *>;
+}
+
+class MyQTouchEvent: public QTouchEvent
+{
+public:
+};
+
+void QTouchEvent_DestroyQTouchEvent(void* ptr)
+{
+	static_cast<QTouchEvent*>(ptr)->~QTouchEvent();
+}
+
+void* QTouchEvent_Target(void* ptr)
+{
+	return static_cast<QTouchEvent*>(ptr)->target();
+}
+
+void* QTouchEvent_Device(void* ptr)
+{
+	return static_cast<QTouchEvent*>(ptr)->device();
+}
+
+void* QTouchEvent_Window(void* ptr)
+{
+	return static_cast<QTouchEvent*>(ptr)->window();
+}
+
+long long QTouchEvent_TouchPointStates(void* ptr)
+{
+	return static_cast<QTouchEvent*>(ptr)->touchPointStates();
+}
+
+void* QTouchEvent__device(void* ptr)
+{
+	return static_cast<QTouchEvent*>(ptr)->_device;
+}
+
+void QTouchEvent_Set_device(void* ptr, void* vqt)
+{
+	static_cast<QTouchEvent*>(ptr)->_device = static_cast<QTouchDevice*>(vqt);
+}
+
+void* QTouchEvent__target(void* ptr)
+{
+	return static_cast<QTouchEvent*>(ptr)->_target;
+}
+
+void QTouchEvent_Set_target(void* ptr, void* vqo)
+{
+		static_cast<QTouchEvent*>(ptr)->_target = static_cast<QObject*>(vqo);
+}
+
+long long QTouchEvent__touchPointStates(void* ptr)
+{
+	return static_cast<QTouchEvent*>(ptr)->_touchPointStates;
+}
+
+void QTouchEvent_Set_touchPointStates(void* ptr, long long vqt)
+{
+	static_cast<QTouchEvent*>(ptr)->_touchPointStates = static_cast<Qt::TouchPointState>(vqt);
+}
+
+void* QTouchEvent__window(void* ptr)
+{
+	return static_cast<QTouchEvent*>(ptr)->_window;
+}
+
+void QTouchEvent_Set_window(void* ptr, void* vqw)
+{
+		static_cast<QTouchEvent*>(ptr)->_window = static_cast<QWindow*>(vqw);
+}
+
+void* QTouchEvent___QTouchEvent_touchPoints_newList(void* ptr)
+{
+	return new QList<QTouchEvent::TouchPoint>;
+}
+
+void* QTouchEvent___setTouchPoints_touchPoints_newList(void* ptr)
+{
+	return new QList<QTouchEvent::TouchPoint>;
+}
+
+void* QTouchEvent___touchPoints_newList(void* ptr)
+{
+	return new QList<QTouchEvent::TouchPoint>;
+}
+
+void* QTouchEvent____touchPoints_newList(void* ptr)
+{
+	return new QList<QTouchEvent::TouchPoint>;
+}
+
+void* QTouchEvent___set_touchPoints__newList(void* ptr)
+{
+	return new QList<QTouchEvent::TouchPoint>;
+}
+
+void* QTransform_Rotate(void* ptr, double angle, long long axis)
+{
+	return new QTransform(static_cast<QTransform*>(ptr)->rotate(angle, static_cast<Qt::Axis>(axis)));
+}
+
+void* QTransform_RotateRadians(void* ptr, double angle, long long axis)
+{
+	return new QTransform(static_cast<QTransform*>(ptr)->rotateRadians(angle, static_cast<Qt::Axis>(axis)));
+}
+
+void* QTransform_Scale(void* ptr, double sx, double sy)
+{
+	return new QTransform(static_cast<QTransform*>(ptr)->scale(sx, sy));
+}
+
+void* QTransform_Shear(void* ptr, double sh, double sv)
+{
+	return new QTransform(static_cast<QTransform*>(ptr)->shear(sh, sv));
+}
+
+void* QTransform_Translate(void* ptr, double dx, double dy)
+{
+	return new QTransform(static_cast<QTransform*>(ptr)->translate(dx, dy));
+}
+
+void* QTransform_QTransform_FromScale(double sx, double sy)
+{
+	return new QTransform(QTransform::fromScale(sx, sy));
+}
+
+void* QTransform_QTransform_FromTranslate(double dx, double dy)
+{
+	return new QTransform(QTransform::fromTranslate(dx, dy));
+}
+
+void* QTransform_NewQTransform()
+{
+	return new QTransform();
+}
+
+void* QTransform_NewQTransform6(void* other)
+{
+	return new QTransform(*static_cast<QTransform*>(other));
+}
+
+void* QTransform_NewQTransform7(void* other)
+{
+	return new QTransform(*static_cast<QTransform*>(other));
+}
+
+void* QTransform_NewQTransform3(double m11, double m12, double m13, double m21, double m22, double m23, double m31, double m32, double m33)
+{
+	return new QTransform(m11, m12, m13, m21, m22, m23, m31, m32, m33);
+}
+
+void* QTransform_NewQTransform4(double m11, double m12, double m21, double m22, double dx, double dy)
+{
+	return new QTransform(m11, m12, m21, m22, dx, dy);
+}
+
+char QTransform_QTransform_QuadToQuad(void* one, void* two, void* trans)
+{
+	return QTransform::quadToQuad(*static_cast<QPolygonF*>(one), *static_cast<QPolygonF*>(two), *static_cast<QTransform*>(trans));
+}
+
+char QTransform_QTransform_QuadToSquare(void* quad, void* trans)
+{
+	return QTransform::quadToSquare(*static_cast<QPolygonF*>(quad), *static_cast<QTransform*>(trans));
+}
+
+char QTransform_QTransform_SquareToQuad(void* quad, void* trans)
+{
+	return QTransform::squareToQuad(*static_cast<QPolygonF*>(quad), *static_cast<QTransform*>(trans));
+}
+
+void QTransform_Reset(void* ptr)
+{
+	static_cast<QTransform*>(ptr)->reset();
+}
+
+void QTransform_SetMatrix(void* ptr, double m11, double m12, double m13, double m21, double m22, double m23, double m31, double m32, double m33)
+{
+	static_cast<QTransform*>(ptr)->setMatrix(m11, m12, m13, m21, m22, m23, m31, m32, m33);
+}
+
+void* QTransform_Map3(void* ptr, void* l)
+{
+	return ({ QLine tmpValue = static_cast<QTransform*>(ptr)->map(*static_cast<QLine*>(l)); new QLine(tmpValue.p1(), tmpValue.p2()); });
+}
+
+void* QTransform_Map4(void* ptr, void* line)
+{
+	return ({ QLineF tmpValue = static_cast<QTransform*>(ptr)->map(*static_cast<QLineF*>(line)); new QLineF(tmpValue.p1(), tmpValue.p2()); });
+}
+
+void* QTransform_Map8(void* ptr, void* path)
+{
+	return new QPainterPath(static_cast<QTransform*>(ptr)->map(*static_cast<QPainterPath*>(path)));
+}
+
+void* QTransform_Map10(void* ptr, void* point)
+{
+	return ({ QPoint tmpValue = static_cast<QTransform*>(ptr)->map(*static_cast<QPoint*>(point)); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QTransform_Map2(void* ptr, void* p)
+{
+	return ({ QPointF tmpValue = static_cast<QTransform*>(ptr)->map(*static_cast<QPointF*>(p)); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QTransform_Map6(void* ptr, void* polygon)
+{
+	return new QPolygon(static_cast<QTransform*>(ptr)->map(*static_cast<QPolygon*>(polygon)));
+}
+
+void* QTransform_MapToPolygon(void* ptr, void* rectangle)
+{
+	return new QPolygon(static_cast<QTransform*>(ptr)->mapToPolygon(*static_cast<QRect*>(rectangle)));
+}
+
+void* QTransform_Map5(void* ptr, void* polygon)
+{
+	return new QPolygonF(static_cast<QTransform*>(ptr)->map(*static_cast<QPolygonF*>(polygon)));
+}
+
+void* QTransform_MapRect2(void* ptr, void* rectangle)
+{
+	return ({ QRect tmpValue = static_cast<QTransform*>(ptr)->mapRect(*static_cast<QRect*>(rectangle)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QTransform_MapRect(void* ptr, void* rectangle)
+{
+	return ({ QRectF tmpValue = static_cast<QTransform*>(ptr)->mapRect(*static_cast<QRectF*>(rectangle)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QTransform_Map7(void* ptr, void* region)
+{
+	return new QRegion(static_cast<QTransform*>(ptr)->map(*static_cast<QRegion*>(region)));
+}
+
+void* QTransform_Adjoint(void* ptr)
+{
+	return new QTransform(static_cast<QTransform*>(ptr)->adjoint());
+}
+
+void* QTransform_Inverted(void* ptr, char invertible)
+{
+	return new QTransform(static_cast<QTransform*>(ptr)->inverted(NULL));
+}
+
+void* QTransform_Transposed(void* ptr)
+{
+	return new QTransform(static_cast<QTransform*>(ptr)->transposed());
+}
+
+long long QTransform_Type(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->type();
+}
+
+char QTransform_IsAffine(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->isAffine();
+}
+
+char QTransform_IsIdentity(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->isIdentity();
+}
+
+char QTransform_IsInvertible(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->isInvertible();
+}
+
+char QTransform_IsRotating(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->isRotating();
+}
+
+char QTransform_IsScaling(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->isScaling();
+}
+
+char QTransform_IsTranslating(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->isTranslating();
+}
+
+double QTransform_Determinant(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->determinant();
+}
+
+double QTransform_Dx(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->dx();
+}
+
+double QTransform_Dy(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->dy();
+}
+
+double QTransform_M11(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->m11();
+}
+
+double QTransform_M12(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->m12();
+}
+
+double QTransform_M13(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->m13();
+}
+
+double QTransform_M21(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->m21();
+}
+
+double QTransform_M22(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->m22();
+}
+
+double QTransform_M23(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->m23();
+}
+
+double QTransform_M31(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->m31();
+}
+
+double QTransform_M32(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->m32();
+}
+
+double QTransform_M33(void* ptr)
+{
+	return static_cast<QTransform*>(ptr)->m33();
+}
+
+void QTransform_Map9(void* ptr, int x, int y, int tx, int ty)
+{
+	static_cast<QTransform*>(ptr)->map(x, y, &tx, &ty);
+}
+
+void QTransform_Map(void* ptr, double x, double y, double tx, double ty)
+{
+	static_cast<QTransform*>(ptr)->map(x, y, &tx, &ty);
+}
+
+class MyQValidator: public QValidator
+{
+public:
+	MyQValidator(QObject *parent) : QValidator(parent) {};
+	void Signal_Changed() { callbackQValidator_Changed(this); };
+	void fixup(QString & input) const { QByteArray t140f86 = input.toUtf8(); QtGui_PackedString inputPacked = { const_cast<char*>(t140f86.prepend("WHITESPACE").constData()+10), t140f86.size()-10 };callbackQValidator_Fixup(const_cast<void*>(static_cast<const void*>(this)), inputPacked); };
+	State validate(QString & input, int & pos) const { QByteArray t140f86 = input.toUtf8(); QtGui_PackedString inputPacked = { const_cast<char*>(t140f86.prepend("WHITESPACE").constData()+10), t140f86.size()-10 };return static_cast<QValidator::State>(callbackQValidator_Validate(const_cast<void*>(static_cast<const void*>(this)), inputPacked, pos)); };
+	bool event(QEvent * e) { return callbackQValidator_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQValidator_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQValidator_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQValidator_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQValidator_CustomEvent(this, event); };
+	void deleteLater() { callbackQValidator_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQValidator_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQValidator_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQValidator_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQValidator_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQValidator_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QValidator_ConnectChanged(void* ptr)
+{
+	QObject::connect(static_cast<QValidator*>(ptr), static_cast<void (QValidator::*)()>(&QValidator::changed), static_cast<MyQValidator*>(ptr), static_cast<void (MyQValidator::*)()>(&MyQValidator::Signal_Changed));
+}
+
+void QValidator_DisconnectChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QValidator*>(ptr), static_cast<void (QValidator::*)()>(&QValidator::changed), static_cast<MyQValidator*>(ptr), static_cast<void (MyQValidator::*)()>(&MyQValidator::Signal_Changed));
+}
+
+void QValidator_Changed(void* ptr)
+{
+	static_cast<QValidator*>(ptr)->changed();
+}
+
+void QValidator_Fixup(void* ptr, char* input)
+{
+	static_cast<QValidator*>(ptr)->fixup(*(new QString(input)));
+}
+
+void QValidator_FixupDefault(void* ptr, char* input)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::fixup(*(new QString(input)));
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::fixup(*(new QString(input)));
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIntValidator*>(ptr)->QIntValidator::fixup(*(new QString(input)));
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::fixup(*(new QString(input)));
+	} else {
+		static_cast<QValidator*>(ptr)->QValidator::fixup(*(new QString(input)));
+	}
+}
+
+void* QValidator_NewQValidator(void* parent)
+{
+	return new MyQValidator(static_cast<QObject*>(parent));
+}
+
+void QValidator_SetLocale(void* ptr, void* locale)
+{
+	static_cast<QValidator*>(ptr)->setLocale(*static_cast<QLocale*>(locale));
+}
+
+void QValidator_DestroyQValidator(void* ptr)
+{
+	static_cast<QValidator*>(ptr)->~QValidator();
+}
+
+void* QValidator_Locale(void* ptr)
+{
+	return new QLocale(static_cast<QValidator*>(ptr)->locale());
+}
+
+long long QValidator_Validate(void* ptr, char* input, int pos)
+{
+	return static_cast<QValidator*>(ptr)->validate(*(new QString(input)), pos);
+}
+
+void* QValidator___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QValidator___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QValidator___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QValidator___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QValidator___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QValidator___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QValidator___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QValidator___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QValidator___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QValidator___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QValidator___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QValidator___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QValidator___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QValidator___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+	} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+	} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QValidator___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QValidator_EventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QIntValidator*>(ptr)->QIntValidator::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::event(static_cast<QEvent*>(e));
+	} else {
+		return static_cast<QValidator*>(ptr)->QValidator::event(static_cast<QEvent*>(e));
+	}
+}
+
+char QValidator_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QIntValidator*>(ptr)->QIntValidator::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QIntValidator*>(ptr)->QIntValidator::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QIntValidator*>(ptr)->QIntValidator::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QIntValidator*>(ptr)->QIntValidator::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QIntValidator*>(ptr)->QIntValidator::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QValidator*>(ptr)->QValidator::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QValidator*>(ptr)->QValidator::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QValidator*>(ptr)->QValidator::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QValidator*>(ptr)->QValidator::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QValidator*>(ptr)->QValidator::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QValidator_ChildEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIntValidator*>(ptr)->QIntValidator::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QValidator*>(ptr)->QValidator::childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QValidator_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIntValidator*>(ptr)->QIntValidator::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QValidator*>(ptr)->QValidator::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QValidator_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIntValidator*>(ptr)->QIntValidator::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QValidator*>(ptr)->QValidator::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QValidator_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::deleteLater();
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::deleteLater();
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIntValidator*>(ptr)->QIntValidator::deleteLater();
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::deleteLater();
+	} else {
+		static_cast<QValidator*>(ptr)->QValidator::deleteLater();
+	}
+}
+
+void QValidator_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIntValidator*>(ptr)->QIntValidator::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QValidator*>(ptr)->QValidator::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QValidator_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QIntValidator*>(ptr)->QIntValidator::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QValidator*>(ptr)->QValidator::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void* QValidator_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QRegularExpressionValidator*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QRegularExpressionValidator*>(ptr)->QRegularExpressionValidator::metaObject());
+	} else if (dynamic_cast<QRegExpValidator*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QRegExpValidator*>(ptr)->QRegExpValidator::metaObject());
+	} else if (dynamic_cast<QIntValidator*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QIntValidator*>(ptr)->QIntValidator::metaObject());
+	} else if (dynamic_cast<QDoubleValidator*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QDoubleValidator*>(ptr)->QDoubleValidator::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QValidator*>(ptr)->QValidator::metaObject());
+	}
+}
+
+void* QVector2D_NewQVector2D()
+{
+	return new QVector2D();
+}
+
+void* QVector2D_NewQVector2D4(void* point)
+{
+	return new QVector2D(*static_cast<QPoint*>(point));
+}
+
+void* QVector2D_NewQVector2D5(void* point)
+{
+	return new QVector2D(*static_cast<QPointF*>(point));
+}
+
+void* QVector2D_NewQVector2D6(void* vector)
+{
+	return new QVector2D(*static_cast<QVector3D*>(vector));
+}
+
+void* QVector2D_NewQVector2D7(void* vector)
+{
+	return new QVector2D(*static_cast<QVector4D*>(vector));
+}
+
+void* QVector2D_NewQVector2D3(float xpos, float ypos)
+{
+	return new QVector2D(xpos, ypos);
+}
+
+float QVector2D_QVector2D_DotProduct(void* v1, void* v2)
+{
+	return QVector2D::dotProduct(*static_cast<QVector2D*>(v1), *static_cast<QVector2D*>(v2));
+}
+
+void QVector2D_Normalize(void* ptr)
+{
+	static_cast<QVector2D*>(ptr)->normalize();
+}
+
+void QVector2D_SetX(void* ptr, float x)
+{
+	static_cast<QVector2D*>(ptr)->setX(x);
+}
+
+void QVector2D_SetY(void* ptr, float y)
+{
+	static_cast<QVector2D*>(ptr)->setY(y);
+}
+
+void* QVector2D_ToPoint(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QVector2D*>(ptr)->toPoint(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QVector2D_ToPointF(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QVector2D*>(ptr)->toPointF(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QVector2D_Normalized(void* ptr)
+{
+	return new QVector2D(static_cast<QVector2D*>(ptr)->normalized());
+}
+
+void* QVector2D_ToVector3D(void* ptr)
+{
+	return new QVector3D(static_cast<QVector2D*>(ptr)->toVector3D());
+}
+
+void* QVector2D_ToVector4D(void* ptr)
+{
+	return new QVector4D(static_cast<QVector2D*>(ptr)->toVector4D());
+}
+
+char QVector2D_IsNull(void* ptr)
+{
+	return static_cast<QVector2D*>(ptr)->isNull();
+}
+
+float QVector2D_DistanceToLine(void* ptr, void* point, void* direction)
+{
+	return static_cast<QVector2D*>(ptr)->distanceToLine(*static_cast<QVector2D*>(point), *static_cast<QVector2D*>(direction));
+}
+
+float QVector2D_DistanceToPoint(void* ptr, void* point)
+{
+	return static_cast<QVector2D*>(ptr)->distanceToPoint(*static_cast<QVector2D*>(point));
+}
+
+float QVector2D_Length(void* ptr)
+{
+	return static_cast<QVector2D*>(ptr)->length();
+}
+
+float QVector2D_LengthSquared(void* ptr)
+{
+	return static_cast<QVector2D*>(ptr)->lengthSquared();
+}
+
+float QVector2D_X(void* ptr)
+{
+	return static_cast<QVector2D*>(ptr)->x();
+}
+
+float QVector2D_Y(void* ptr)
+{
+	return static_cast<QVector2D*>(ptr)->y();
+}
+
+void* QVector3D_QVector3D_CrossProduct(void* v1, void* v2)
+{
+	return new QVector3D(QVector3D::crossProduct(*static_cast<QVector3D*>(v1), *static_cast<QVector3D*>(v2)));
+}
+
+void* QVector3D_QVector3D_Normal(void* v1, void* v2)
+{
+	return new QVector3D(QVector3D::normal(*static_cast<QVector3D*>(v1), *static_cast<QVector3D*>(v2)));
+}
+
+void* QVector3D_QVector3D_Normal2(void* v1, void* v2, void* v3)
+{
+	return new QVector3D(QVector3D::normal(*static_cast<QVector3D*>(v1), *static_cast<QVector3D*>(v2), *static_cast<QVector3D*>(v3)));
+}
+
+void* QVector3D_NewQVector3D()
+{
+	return new QVector3D();
+}
+
+void* QVector3D_NewQVector3D4(void* point)
+{
+	return new QVector3D(*static_cast<QPoint*>(point));
+}
+
+void* QVector3D_NewQVector3D5(void* point)
+{
+	return new QVector3D(*static_cast<QPointF*>(point));
+}
+
+void* QVector3D_NewQVector3D6(void* vector)
+{
+	return new QVector3D(*static_cast<QVector2D*>(vector));
+}
+
+void* QVector3D_NewQVector3D7(void* vector, float zpos)
+{
+	return new QVector3D(*static_cast<QVector2D*>(vector), zpos);
+}
+
+void* QVector3D_NewQVector3D8(void* vector)
+{
+	return new QVector3D(*static_cast<QVector4D*>(vector));
+}
+
+void* QVector3D_NewQVector3D3(float xpos, float ypos, float zpos)
+{
+	return new QVector3D(xpos, ypos, zpos);
+}
+
+float QVector3D_QVector3D_DotProduct(void* v1, void* v2)
+{
+	return QVector3D::dotProduct(*static_cast<QVector3D*>(v1), *static_cast<QVector3D*>(v2));
+}
+
+void QVector3D_Normalize(void* ptr)
+{
+	static_cast<QVector3D*>(ptr)->normalize();
+}
+
+void QVector3D_SetX(void* ptr, float x)
+{
+	static_cast<QVector3D*>(ptr)->setX(x);
+}
+
+void QVector3D_SetY(void* ptr, float y)
+{
+	static_cast<QVector3D*>(ptr)->setY(y);
+}
+
+void QVector3D_SetZ(void* ptr, float z)
+{
+	static_cast<QVector3D*>(ptr)->setZ(z);
+}
+
+void* QVector3D_ToPoint(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QVector3D*>(ptr)->toPoint(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QVector3D_ToPointF(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QVector3D*>(ptr)->toPointF(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QVector3D_ToVector2D(void* ptr)
+{
+	return new QVector2D(static_cast<QVector3D*>(ptr)->toVector2D());
+}
+
+void* QVector3D_Normalized(void* ptr)
+{
+	return new QVector3D(static_cast<QVector3D*>(ptr)->normalized());
+}
+
+void* QVector3D_Project(void* ptr, void* modelView, void* projection, void* viewport)
+{
+	return new QVector3D(static_cast<QVector3D*>(ptr)->project(*static_cast<QMatrix4x4*>(modelView), *static_cast<QMatrix4x4*>(projection), *static_cast<QRect*>(viewport)));
+}
+
+void* QVector3D_Unproject(void* ptr, void* modelView, void* projection, void* viewport)
+{
+	return new QVector3D(static_cast<QVector3D*>(ptr)->unproject(*static_cast<QMatrix4x4*>(modelView), *static_cast<QMatrix4x4*>(projection), *static_cast<QRect*>(viewport)));
+}
+
+void* QVector3D_ToVector4D(void* ptr)
+{
+	return new QVector4D(static_cast<QVector3D*>(ptr)->toVector4D());
+}
+
+char QVector3D_IsNull(void* ptr)
+{
+	return static_cast<QVector3D*>(ptr)->isNull();
+}
+
+float QVector3D_DistanceToLine(void* ptr, void* point, void* direction)
+{
+	return static_cast<QVector3D*>(ptr)->distanceToLine(*static_cast<QVector3D*>(point), *static_cast<QVector3D*>(direction));
+}
+
+float QVector3D_DistanceToPlane(void* ptr, void* plane, void* normal)
+{
+	return static_cast<QVector3D*>(ptr)->distanceToPlane(*static_cast<QVector3D*>(plane), *static_cast<QVector3D*>(normal));
+}
+
+float QVector3D_DistanceToPlane2(void* ptr, void* plane1, void* plane2, void* plane3)
+{
+	return static_cast<QVector3D*>(ptr)->distanceToPlane(*static_cast<QVector3D*>(plane1), *static_cast<QVector3D*>(plane2), *static_cast<QVector3D*>(plane3));
+}
+
+float QVector3D_DistanceToPoint(void* ptr, void* point)
+{
+	return static_cast<QVector3D*>(ptr)->distanceToPoint(*static_cast<QVector3D*>(point));
+}
+
+float QVector3D_Length(void* ptr)
+{
+	return static_cast<QVector3D*>(ptr)->length();
+}
+
+float QVector3D_LengthSquared(void* ptr)
+{
+	return static_cast<QVector3D*>(ptr)->lengthSquared();
+}
+
+float QVector3D_X(void* ptr)
+{
+	return static_cast<QVector3D*>(ptr)->x();
+}
+
+float QVector3D_Y(void* ptr)
+{
+	return static_cast<QVector3D*>(ptr)->y();
+}
+
+float QVector3D_Z(void* ptr)
+{
+	return static_cast<QVector3D*>(ptr)->z();
+}
+
+void* QVector4D_NewQVector4D()
+{
+	return new QVector4D();
+}
+
+void* QVector4D_NewQVector4D4(void* point)
+{
+	return new QVector4D(*static_cast<QPoint*>(point));
+}
+
+void* QVector4D_NewQVector4D5(void* point)
+{
+	return new QVector4D(*static_cast<QPointF*>(point));
+}
+
+void* QVector4D_NewQVector4D6(void* vector)
+{
+	return new QVector4D(*static_cast<QVector2D*>(vector));
+}
+
+void* QVector4D_NewQVector4D7(void* vector, float zpos, float wpos)
+{
+	return new QVector4D(*static_cast<QVector2D*>(vector), zpos, wpos);
+}
+
+void* QVector4D_NewQVector4D8(void* vector)
+{
+	return new QVector4D(*static_cast<QVector3D*>(vector));
+}
+
+void* QVector4D_NewQVector4D9(void* vector, float wpos)
+{
+	return new QVector4D(*static_cast<QVector3D*>(vector), wpos);
+}
+
+void* QVector4D_NewQVector4D3(float xpos, float ypos, float zpos, float wpos)
+{
+	return new QVector4D(xpos, ypos, zpos, wpos);
+}
+
+float QVector4D_QVector4D_DotProduct(void* v1, void* v2)
+{
+	return QVector4D::dotProduct(*static_cast<QVector4D*>(v1), *static_cast<QVector4D*>(v2));
+}
+
+void QVector4D_Normalize(void* ptr)
+{
+	static_cast<QVector4D*>(ptr)->normalize();
+}
+
+void QVector4D_SetW(void* ptr, float w)
+{
+	static_cast<QVector4D*>(ptr)->setW(w);
+}
+
+void QVector4D_SetX(void* ptr, float x)
+{
+	static_cast<QVector4D*>(ptr)->setX(x);
+}
+
+void QVector4D_SetY(void* ptr, float y)
+{
+	static_cast<QVector4D*>(ptr)->setY(y);
+}
+
+void QVector4D_SetZ(void* ptr, float z)
+{
+	static_cast<QVector4D*>(ptr)->setZ(z);
+}
+
+void* QVector4D_ToPoint(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QVector4D*>(ptr)->toPoint(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QVector4D_ToPointF(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QVector4D*>(ptr)->toPointF(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QVector4D_ToVector2D(void* ptr)
+{
+	return new QVector2D(static_cast<QVector4D*>(ptr)->toVector2D());
+}
+
+void* QVector4D_ToVector2DAffine(void* ptr)
+{
+	return new QVector2D(static_cast<QVector4D*>(ptr)->toVector2DAffine());
+}
+
+void* QVector4D_ToVector3D(void* ptr)
+{
+	return new QVector3D(static_cast<QVector4D*>(ptr)->toVector3D());
+}
+
+void* QVector4D_ToVector3DAffine(void* ptr)
+{
+	return new QVector3D(static_cast<QVector4D*>(ptr)->toVector3DAffine());
+}
+
+void* QVector4D_Normalized(void* ptr)
+{
+	return new QVector4D(static_cast<QVector4D*>(ptr)->normalized());
+}
+
+char QVector4D_IsNull(void* ptr)
+{
+	return static_cast<QVector4D*>(ptr)->isNull();
+}
+
+float QVector4D_Length(void* ptr)
+{
+	return static_cast<QVector4D*>(ptr)->length();
+}
+
+float QVector4D_LengthSquared(void* ptr)
+{
+	return static_cast<QVector4D*>(ptr)->lengthSquared();
+}
+
+float QVector4D_W(void* ptr)
+{
+	return static_cast<QVector4D*>(ptr)->w();
+}
+
+float QVector4D_X(void* ptr)
+{
+	return static_cast<QVector4D*>(ptr)->x();
+}
+
+float QVector4D_Y(void* ptr)
+{
+	return static_cast<QVector4D*>(ptr)->y();
+}
+
+float QVector4D_Z(void* ptr)
+{
+	return static_cast<QVector4D*>(ptr)->z();
+}
+
+class MyQWhatsThisClickedEvent: public QWhatsThisClickedEvent
+{
+public:
+	MyQWhatsThisClickedEvent(const QString &href) : QWhatsThisClickedEvent(href) {};
+};
+
+void* QWhatsThisClickedEvent_NewQWhatsThisClickedEvent(char* href)
+{
+	return new MyQWhatsThisClickedEvent(QString(href));
+}
+
+struct QtGui_PackedString QWhatsThisClickedEvent_Href(void* ptr)
+{
+	return ({ QByteArray tc87a51 = static_cast<QWhatsThisClickedEvent*>(ptr)->href().toUtf8(); QtGui_PackedString { const_cast<char*>(tc87a51.prepend("WHITESPACE").constData()+10), tc87a51.size()-10 }; });
+}
+
+class MyQWheelEvent: public QWheelEvent
+{
+public:
+	MyQWheelEvent(const QPointF &pos, const QPointF &globalPos, QPoint pixelDelta, QPoint angleDelta, int qt4Delta, Qt::Orientation qt4Orientation, Qt::MouseButtons buttons, Qt::KeyboardModifiers modifiers) : QWheelEvent(pos, globalPos, pixelDelta, angleDelta, qt4Delta, qt4Orientation, buttons, modifiers) {};
+	MyQWheelEvent(const QPointF &pos, const QPointF &globalPos, QPoint pixelDelta, QPoint angleDelta, int qt4Delta, Qt::Orientation qt4Orientation, Qt::MouseButtons buttons, Qt::KeyboardModifiers modifiers, Qt::ScrollPhase phase) : QWheelEvent(pos, globalPos, pixelDelta, angleDelta, qt4Delta, qt4Orientation, buttons, modifiers, phase) {};
+	MyQWheelEvent(const QPointF &pos, const QPointF &globalPos, QPoint pixelDelta, QPoint angleDelta, int qt4Delta, Qt::Orientation qt4Orientation, Qt::MouseButtons buttons, Qt::KeyboardModifiers modifiers, Qt::ScrollPhase phase, Qt::MouseEventSource source) : QWheelEvent(pos, globalPos, pixelDelta, angleDelta, qt4Delta, qt4Orientation, buttons, modifiers, phase, source) {};
+	MyQWheelEvent(const QPointF &pos, const QPointF &globalPos, QPoint pixelDelta, QPoint angleDelta, int qt4Delta, Qt::Orientation qt4Orientation, Qt::MouseButtons buttons, Qt::KeyboardModifiers modifiers, Qt::ScrollPhase phase, Qt::MouseEventSource source, bool inverted) : QWheelEvent(pos, globalPos, pixelDelta, angleDelta, qt4Delta, qt4Orientation, buttons, modifiers, phase, source, inverted) {};
+};
+
+void* QWheelEvent_NewQWheelEvent(void* pos, void* globalPos, void* pixelDelta, void* angleDelta, int qt4Delta, long long qt4Orientation, long long buttons, long long modifiers)
+{
+	return new MyQWheelEvent(*static_cast<QPointF*>(pos), *static_cast<QPointF*>(globalPos), *static_cast<QPoint*>(pixelDelta), *static_cast<QPoint*>(angleDelta), qt4Delta, static_cast<Qt::Orientation>(qt4Orientation), static_cast<Qt::MouseButton>(buttons), static_cast<Qt::KeyboardModifier>(modifiers));
+}
+
+void* QWheelEvent_NewQWheelEvent4(void* pos, void* globalPos, void* pixelDelta, void* angleDelta, int qt4Delta, long long qt4Orientation, long long buttons, long long modifiers, long long phase)
+{
+	return new MyQWheelEvent(*static_cast<QPointF*>(pos), *static_cast<QPointF*>(globalPos), *static_cast<QPoint*>(pixelDelta), *static_cast<QPoint*>(angleDelta), qt4Delta, static_cast<Qt::Orientation>(qt4Orientation), static_cast<Qt::MouseButton>(buttons), static_cast<Qt::KeyboardModifier>(modifiers), static_cast<Qt::ScrollPhase>(phase));
+}
+
+void* QWheelEvent_NewQWheelEvent5(void* pos, void* globalPos, void* pixelDelta, void* angleDelta, int qt4Delta, long long qt4Orientation, long long buttons, long long modifiers, long long phase, long long source)
+{
+	return new MyQWheelEvent(*static_cast<QPointF*>(pos), *static_cast<QPointF*>(globalPos), *static_cast<QPoint*>(pixelDelta), *static_cast<QPoint*>(angleDelta), qt4Delta, static_cast<Qt::Orientation>(qt4Orientation), static_cast<Qt::MouseButton>(buttons), static_cast<Qt::KeyboardModifier>(modifiers), static_cast<Qt::ScrollPhase>(phase), static_cast<Qt::MouseEventSource>(source));
+}
+
+void* QWheelEvent_NewQWheelEvent6(void* pos, void* globalPos, void* pixelDelta, void* angleDelta, int qt4Delta, long long qt4Orientation, long long buttons, long long modifiers, long long phase, long long source, char inverted)
+{
+	return new MyQWheelEvent(*static_cast<QPointF*>(pos), *static_cast<QPointF*>(globalPos), *static_cast<QPoint*>(pixelDelta), *static_cast<QPoint*>(angleDelta), qt4Delta, static_cast<Qt::Orientation>(qt4Orientation), static_cast<Qt::MouseButton>(buttons), static_cast<Qt::KeyboardModifier>(modifiers), static_cast<Qt::ScrollPhase>(phase), static_cast<Qt::MouseEventSource>(source), inverted != 0);
+}
+
+void* QWheelEvent_AngleDelta(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QWheelEvent*>(ptr)->angleDelta(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QWheelEvent_GlobalPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QWheelEvent*>(ptr)->globalPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QWheelEvent_PixelDelta(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QWheelEvent*>(ptr)->pixelDelta(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QWheelEvent_Pos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QWheelEvent*>(ptr)->pos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+long long QWheelEvent_Buttons(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->buttons();
+}
+
+long long QWheelEvent_Source(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->source();
+}
+
+long long QWheelEvent_Phase(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->phase();
+}
+
+char QWheelEvent_Inverted(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->inverted();
+}
+
+void* QWheelEvent_GlobalPosF(void* ptr)
+{
+	return const_cast<QPointF*>(&static_cast<QWheelEvent*>(ptr)->globalPosF());
+}
+
+void* QWheelEvent_PosF(void* ptr)
+{
+	return const_cast<QPointF*>(&static_cast<QWheelEvent*>(ptr)->posF());
+}
+
+int QWheelEvent_GlobalX(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->globalX();
+}
+
+int QWheelEvent_GlobalY(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->globalY();
+}
+
+int QWheelEvent_X(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->x();
+}
+
+int QWheelEvent_Y(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->y();
+}
+
+int QWheelEvent_QWheelEvent_DefaultDeltasPerStep()
+{
+	return QWheelEvent::DefaultDeltasPerStep;
+}
+
+void* QWheelEvent_AngleD(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QWheelEvent*>(ptr)->angleD; new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void QWheelEvent_SetAngleD(void* ptr, void* vqp)
+{
+	static_cast<QWheelEvent*>(ptr)->angleD = *static_cast<QPoint*>(vqp);
+}
+
+void* QWheelEvent_G(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QWheelEvent*>(ptr)->g; new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void QWheelEvent_SetG(void* ptr, void* vqp)
+{
+	static_cast<QWheelEvent*>(ptr)->g = *static_cast<QPointF*>(vqp);
+}
+
+long long QWheelEvent_MouseState(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->mouseState;
+}
+
+void QWheelEvent_SetMouseState(void* ptr, long long vqt)
+{
+	static_cast<QWheelEvent*>(ptr)->mouseState = static_cast<Qt::MouseButton>(vqt);
+}
+
+void* QWheelEvent_P(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QWheelEvent*>(ptr)->p; new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void QWheelEvent_SetP(void* ptr, void* vqp)
+{
+	static_cast<QWheelEvent*>(ptr)->p = *static_cast<QPointF*>(vqp);
+}
+
+void* QWheelEvent_PixelD(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QWheelEvent*>(ptr)->pixelD; new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void QWheelEvent_SetPixelD(void* ptr, void* vqp)
+{
+	static_cast<QWheelEvent*>(ptr)->pixelD = *static_cast<QPoint*>(vqp);
+}
+
+int QWheelEvent_Qt4D(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->qt4D;
+}
+
+void QWheelEvent_SetQt4D(void* ptr, int vin)
+{
+	static_cast<QWheelEvent*>(ptr)->qt4D = vin;
+}
+
+long long QWheelEvent_Qt4O(void* ptr)
+{
+	return static_cast<QWheelEvent*>(ptr)->qt4O;
+}
+
+void QWheelEvent_SetQt4O(void* ptr, long long vqt)
+{
+	static_cast<QWheelEvent*>(ptr)->qt4O = static_cast<Qt::Orientation>(vqt);
+}
+
+class MyQWindow: public QWindow
+{
+public:
+	MyQWindow(QScreen *targetScreen) : QWindow(targetScreen) {};
+	MyQWindow(QWindow *parent) : QWindow(parent) {};
+	bool close() { return callbackQWindow_Close(this) != 0; };
+	bool event(QEvent * ev) { return callbackQWindow_Event(this, ev) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWindow_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void Signal_ActiveChanged() { callbackQWindow_ActiveChanged(this); };
+	void alert(int msec) { callbackQWindow_Alert(this, msec); };
+	void Signal_ContentOrientationChanged(Qt::ScreenOrientation orientation) { callbackQWindow_ContentOrientationChanged(this, orientation); };
+	void exposeEvent(QExposeEvent * ev) { callbackQWindow_ExposeEvent(this, ev); };
+	void focusInEvent(QFocusEvent * ev) { callbackQWindow_FocusInEvent(this, ev); };
+	void Signal_FocusObjectChanged(QObject * object) { callbackQWindow_FocusObjectChanged(this, object); };
+	void focusOutEvent(QFocusEvent * ev) { callbackQWindow_FocusOutEvent(this, ev); };
+	void Signal_HeightChanged(int arg) { callbackQWindow_HeightChanged(this, arg); };
+	void hide() { callbackQWindow_Hide(this); };
+	void hideEvent(QHideEvent * ev) { callbackQWindow_HideEvent(this, ev); };
+	void keyPressEvent(QKeyEvent * ev) { callbackQWindow_KeyPressEvent(this, ev); };
+	void keyReleaseEvent(QKeyEvent * ev) { callbackQWindow_KeyReleaseEvent(this, ev); };
+	void lower() { callbackQWindow_Lower(this); };
+	void Signal_MaximumHeightChanged(int arg) { callbackQWindow_MaximumHeightChanged(this, arg); };
+	void Signal_MaximumWidthChanged(int arg) { callbackQWindow_MaximumWidthChanged(this, arg); };
+	void Signal_MinimumHeightChanged(int arg) { callbackQWindow_MinimumHeightChanged(this, arg); };
+	void Signal_MinimumWidthChanged(int arg) { callbackQWindow_MinimumWidthChanged(this, arg); };
+	void Signal_ModalityChanged(Qt::WindowModality modality) { callbackQWindow_ModalityChanged(this, modality); };
+	void mouseDoubleClickEvent(QMouseEvent * ev) { callbackQWindow_MouseDoubleClickEvent(this, ev); };
+	void mouseMoveEvent(QMouseEvent * ev) { callbackQWindow_MouseMoveEvent(this, ev); };
+	void mousePressEvent(QMouseEvent * ev) { callbackQWindow_MousePressEvent(this, ev); };
+	void mouseReleaseEvent(QMouseEvent * ev) { callbackQWindow_MouseReleaseEvent(this, ev); };
+	void moveEvent(QMoveEvent * ev) { callbackQWindow_MoveEvent(this, ev); };
+	void Signal_OpacityChanged(qreal opacity) { callbackQWindow_OpacityChanged(this, opacity); };
+	void raise() { callbackQWindow_Raise(this); };
+	void requestActivate() { callbackQWindow_RequestActivate(this); };
+	void requestUpdate() { callbackQWindow_RequestUpdate(this); };
+	void resizeEvent(QResizeEvent * ev) { callbackQWindow_ResizeEvent(this, ev); };
+	void Signal_ScreenChanged(QScreen * screen) { callbackQWindow_ScreenChanged(this, screen); };
+	void setHeight(int arg) { callbackQWindow_SetHeight(this, arg); };
+	void setMaximumHeight(int h) { callbackQWindow_SetMaximumHeight(this, h); };
+	void setMaximumWidth(int w) { callbackQWindow_SetMaximumWidth(this, w); };
+	void setMinimumHeight(int h) { callbackQWindow_SetMinimumHeight(this, h); };
+	void setMinimumWidth(int w) { callbackQWindow_SetMinimumWidth(this, w); };
+	void setTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtGui_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWindow_SetTitle(this, vqsPacked); };
+	void setVisible(bool visible) { callbackQWindow_SetVisible(this, visible); };
+	void setWidth(int arg) { callbackQWindow_SetWidth(this, arg); };
+	void setX(int arg) { callbackQWindow_SetX(this, arg); };
+	void setY(int arg) { callbackQWindow_SetY(this, arg); };
+	void show() { callbackQWindow_Show(this); };
+	void showEvent(QShowEvent * ev) { callbackQWindow_ShowEvent(this, ev); };
+	void showFullScreen() { callbackQWindow_ShowFullScreen(this); };
+	void showMaximized() { callbackQWindow_ShowMaximized(this); };
+	void showMinimized() { callbackQWindow_ShowMinimized(this); };
+	void showNormal() { callbackQWindow_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * ev) { callbackQWindow_TabletEvent(this, ev); };
+	void touchEvent(QTouchEvent * ev) { callbackQWindow_TouchEvent(this, ev); };
+	void Signal_VisibilityChanged(QWindow::Visibility visibility) { callbackQWindow_VisibilityChanged(this, visibility); };
+	void Signal_VisibleChanged(bool arg) { callbackQWindow_VisibleChanged(this, arg); };
+	void wheelEvent(QWheelEvent * ev) { callbackQWindow_WheelEvent(this, ev); };
+	void Signal_WidthChanged(int arg) { callbackQWindow_WidthChanged(this, arg); };
+	void Signal_WindowStateChanged(Qt::WindowState windowState) { callbackQWindow_WindowStateChanged(this, windowState); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtGui_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWindow_WindowTitleChanged(this, titlePacked); };
+	void Signal_XChanged(int arg) { callbackQWindow_XChanged(this, arg); };
+	void Signal_YChanged(int arg) { callbackQWindow_YChanged(this, arg); };
+	 ~MyQWindow() { callbackQWindow_DestroyQWindow(this); };
+	QObject * focusObject() const { return static_cast<QObject*>(callbackQWindow_FocusObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize size() const { return *static_cast<QSize*>(callbackQWindow_Size(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSurfaceFormat format() const { return *static_cast<QSurfaceFormat*>(callbackQWindow_Format(const_cast<void*>(static_cast<const void*>(this)))); };
+	SurfaceType surfaceType() const { return static_cast<QSurface::SurfaceType>(callbackQWindow_SurfaceType(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWindow_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWindow_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWindow_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWindow_CustomEvent(this, event); };
+	void deleteLater() { callbackQWindow_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWindow_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWindow_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtGui_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWindow_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWindow_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWindow_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QWindow_QWindow_FromWinId(uintptr_t id)
+{
+		return QWindow::fromWinId(id);
+}
+
+void* QWindow_NewQWindow(void* targetScreen)
+{
+	return new MyQWindow(static_cast<QScreen*>(targetScreen));
+}
+
+void* QWindow_NewQWindow2(void* parent)
+{
+	return new MyQWindow(static_cast<QWindow*>(parent));
+}
+
+char QWindow_Close(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+			bool returnArg;
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "close", Q_RETURN_ARG(bool, returnArg));
+		return returnArg;
+	} else {
+			bool returnArg;
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "close", Q_RETURN_ARG(bool, returnArg));
+		return returnArg;
+	}
+}
+
+char QWindow_CloseDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QRasterWindow*>(ptr)->QRasterWindow::close();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::close();
+	} else {
+		return static_cast<QWindow*>(ptr)->QWindow::close();
+	}
+}
+
+char QWindow_Event(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->event(static_cast<QEvent*>(ev));
+	} else {
+		return static_cast<QWindow*>(ptr)->event(static_cast<QEvent*>(ev));
+	}
+}
+
+char QWindow_EventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QRasterWindow*>(ptr)->QRasterWindow::event(static_cast<QEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::event(static_cast<QEvent*>(ev));
+	} else {
+		return static_cast<QWindow*>(ptr)->QWindow::event(static_cast<QEvent*>(ev));
+	}
+}
+
+char QWindow_NativeEvent(void* ptr, void* eventType, void* message, long result)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->nativeEvent(*static_cast<QByteArray*>(eventType), message, &result);
+	} else {
+		return static_cast<QWindow*>(ptr)->nativeEvent(*static_cast<QByteArray*>(eventType), message, &result);
+	}
+}
+
+char QWindow_NativeEventDefault(void* ptr, void* eventType, void* message, long result)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QRasterWindow*>(ptr)->QRasterWindow::nativeEvent(*static_cast<QByteArray*>(eventType), message, &result);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::nativeEvent(*static_cast<QByteArray*>(eventType), message, &result);
+	} else {
+		return static_cast<QWindow*>(ptr)->QWindow::nativeEvent(*static_cast<QByteArray*>(eventType), message, &result);
+	}
+}
+
+char QWindow_SetKeyboardGrabEnabled(void* ptr, char grab)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->setKeyboardGrabEnabled(grab != 0);
+	} else {
+		return static_cast<QWindow*>(ptr)->setKeyboardGrabEnabled(grab != 0);
+	}
+}
+
+char QWindow_SetMouseGrabEnabled(void* ptr, char grab)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->setMouseGrabEnabled(grab != 0);
+	} else {
+		return static_cast<QWindow*>(ptr)->setMouseGrabEnabled(grab != 0);
+	}
+}
+
+void QWindow_ConnectActiveChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)()>(&QWindow::activeChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)()>(&MyQWindow::Signal_ActiveChanged));
+}
+
+void QWindow_DisconnectActiveChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)()>(&QWindow::activeChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)()>(&MyQWindow::Signal_ActiveChanged));
+}
+
+void QWindow_ActiveChanged(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->activeChanged();
+	} else {
+		static_cast<QWindow*>(ptr)->activeChanged();
+	}
+}
+
+void QWindow_Alert(void* ptr, int msec)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "alert", Q_ARG(int, msec));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "alert", Q_ARG(int, msec));
+	}
+}
+
+void QWindow_AlertDefault(void* ptr, int msec)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::alert(msec);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::alert(msec);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::alert(msec);
+	}
+}
+
+void QWindow_ConnectContentOrientationChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(Qt::ScreenOrientation)>(&QWindow::contentOrientationChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(Qt::ScreenOrientation)>(&MyQWindow::Signal_ContentOrientationChanged));
+}
+
+void QWindow_DisconnectContentOrientationChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(Qt::ScreenOrientation)>(&QWindow::contentOrientationChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(Qt::ScreenOrientation)>(&MyQWindow::Signal_ContentOrientationChanged));
+}
+
+void QWindow_ContentOrientationChanged(void* ptr, long long orientation)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->contentOrientationChanged(static_cast<Qt::ScreenOrientation>(orientation));
+	} else {
+		static_cast<QWindow*>(ptr)->contentOrientationChanged(static_cast<Qt::ScreenOrientation>(orientation));
+	}
+}
+
+void QWindow_Create(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->create();
+	} else {
+		static_cast<QWindow*>(ptr)->create();
+	}
+}
+
+void QWindow_Destroy(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->destroy();
+	} else {
+		static_cast<QWindow*>(ptr)->destroy();
+	}
+}
+
+void QWindow_ExposeEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->exposeEvent(static_cast<QExposeEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->exposeEvent(static_cast<QExposeEvent*>(ev));
+	}
+}
+
+void QWindow_ExposeEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::exposeEvent(static_cast<QExposeEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::exposeEvent(static_cast<QExposeEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::exposeEvent(static_cast<QExposeEvent*>(ev));
+	}
+}
+
+void QWindow_FocusInEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->focusInEvent(static_cast<QFocusEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->focusInEvent(static_cast<QFocusEvent*>(ev));
+	}
+}
+
+void QWindow_FocusInEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::focusInEvent(static_cast<QFocusEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::focusInEvent(static_cast<QFocusEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::focusInEvent(static_cast<QFocusEvent*>(ev));
+	}
+}
+
+void QWindow_ConnectFocusObjectChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(QObject *)>(&QWindow::focusObjectChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(QObject *)>(&MyQWindow::Signal_FocusObjectChanged));
+}
+
+void QWindow_DisconnectFocusObjectChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(QObject *)>(&QWindow::focusObjectChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(QObject *)>(&MyQWindow::Signal_FocusObjectChanged));
+}
+
+void QWindow_FocusObjectChanged(void* ptr, void* object)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(object))) {
+			static_cast<QPaintDeviceWindow*>(ptr)->focusObjectChanged(static_cast<QOffscreenSurface*>(object));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(object))) {
+			static_cast<QPaintDeviceWindow*>(ptr)->focusObjectChanged(static_cast<QPaintDeviceWindow*>(object));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(object))) {
+			static_cast<QPaintDeviceWindow*>(ptr)->focusObjectChanged(static_cast<QPdfWriter*>(object));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(object))) {
+			static_cast<QPaintDeviceWindow*>(ptr)->focusObjectChanged(static_cast<QWindow*>(object));
+		} else {
+			static_cast<QPaintDeviceWindow*>(ptr)->focusObjectChanged(static_cast<QObject*>(object));
+		}
+	} else {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(object))) {
+			static_cast<QWindow*>(ptr)->focusObjectChanged(static_cast<QOffscreenSurface*>(object));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(object))) {
+			static_cast<QWindow*>(ptr)->focusObjectChanged(static_cast<QPaintDeviceWindow*>(object));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(object))) {
+			static_cast<QWindow*>(ptr)->focusObjectChanged(static_cast<QPdfWriter*>(object));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(object))) {
+			static_cast<QWindow*>(ptr)->focusObjectChanged(static_cast<QWindow*>(object));
+		} else {
+			static_cast<QWindow*>(ptr)->focusObjectChanged(static_cast<QObject*>(object));
+		}
+	}
+}
+
+void QWindow_FocusOutEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->focusOutEvent(static_cast<QFocusEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->focusOutEvent(static_cast<QFocusEvent*>(ev));
+	}
+}
+
+void QWindow_FocusOutEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::focusOutEvent(static_cast<QFocusEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::focusOutEvent(static_cast<QFocusEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::focusOutEvent(static_cast<QFocusEvent*>(ev));
+	}
+}
+
+void QWindow_ConnectHeightChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::heightChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_HeightChanged));
+}
+
+void QWindow_DisconnectHeightChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::heightChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_HeightChanged));
+}
+
+void QWindow_HeightChanged(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->heightChanged(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->heightChanged(arg);
+	}
+}
+
+void QWindow_Hide(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "hide");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "hide");
+	}
+}
+
+void QWindow_HideDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::hide();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::hide();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::hide();
+	}
+}
+
+void QWindow_HideEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->hideEvent(static_cast<QHideEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->hideEvent(static_cast<QHideEvent*>(ev));
+	}
+}
+
+void QWindow_HideEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::hideEvent(static_cast<QHideEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::hideEvent(static_cast<QHideEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::hideEvent(static_cast<QHideEvent*>(ev));
+	}
+}
+
+void QWindow_KeyPressEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->keyPressEvent(static_cast<QKeyEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->keyPressEvent(static_cast<QKeyEvent*>(ev));
+	}
+}
+
+void QWindow_KeyPressEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::keyPressEvent(static_cast<QKeyEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::keyPressEvent(static_cast<QKeyEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::keyPressEvent(static_cast<QKeyEvent*>(ev));
+	}
+}
+
+void QWindow_KeyReleaseEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->keyReleaseEvent(static_cast<QKeyEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->keyReleaseEvent(static_cast<QKeyEvent*>(ev));
+	}
+}
+
+void QWindow_KeyReleaseEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::keyReleaseEvent(static_cast<QKeyEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::keyReleaseEvent(static_cast<QKeyEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::keyReleaseEvent(static_cast<QKeyEvent*>(ev));
+	}
+}
+
+void QWindow_Lower(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "lower");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "lower");
+	}
+}
+
+void QWindow_LowerDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::lower();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::lower();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::lower();
+	}
+}
+
+void QWindow_ConnectMaximumHeightChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::maximumHeightChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_MaximumHeightChanged));
+}
+
+void QWindow_DisconnectMaximumHeightChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::maximumHeightChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_MaximumHeightChanged));
+}
+
+void QWindow_MaximumHeightChanged(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->maximumHeightChanged(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->maximumHeightChanged(arg);
+	}
+}
+
+void QWindow_ConnectMaximumWidthChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::maximumWidthChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_MaximumWidthChanged));
+}
+
+void QWindow_DisconnectMaximumWidthChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::maximumWidthChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_MaximumWidthChanged));
+}
+
+void QWindow_MaximumWidthChanged(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->maximumWidthChanged(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->maximumWidthChanged(arg);
+	}
+}
+
+void QWindow_ConnectMinimumHeightChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::minimumHeightChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_MinimumHeightChanged));
+}
+
+void QWindow_DisconnectMinimumHeightChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::minimumHeightChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_MinimumHeightChanged));
+}
+
+void QWindow_MinimumHeightChanged(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->minimumHeightChanged(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->minimumHeightChanged(arg);
+	}
+}
+
+void QWindow_ConnectMinimumWidthChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::minimumWidthChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_MinimumWidthChanged));
+}
+
+void QWindow_DisconnectMinimumWidthChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::minimumWidthChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_MinimumWidthChanged));
+}
+
+void QWindow_MinimumWidthChanged(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->minimumWidthChanged(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->minimumWidthChanged(arg);
+	}
+}
+
+void QWindow_ConnectModalityChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(Qt::WindowModality)>(&QWindow::modalityChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(Qt::WindowModality)>(&MyQWindow::Signal_ModalityChanged));
+}
+
+void QWindow_DisconnectModalityChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(Qt::WindowModality)>(&QWindow::modalityChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(Qt::WindowModality)>(&MyQWindow::Signal_ModalityChanged));
+}
+
+void QWindow_ModalityChanged(void* ptr, long long modality)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->modalityChanged(static_cast<Qt::WindowModality>(modality));
+	} else {
+		static_cast<QWindow*>(ptr)->modalityChanged(static_cast<Qt::WindowModality>(modality));
+	}
+}
+
+void QWindow_MouseDoubleClickEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->mouseDoubleClickEvent(static_cast<QMouseEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->mouseDoubleClickEvent(static_cast<QMouseEvent*>(ev));
+	}
+}
+
+void QWindow_MouseDoubleClickEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::mouseDoubleClickEvent(static_cast<QMouseEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::mouseDoubleClickEvent(static_cast<QMouseEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::mouseDoubleClickEvent(static_cast<QMouseEvent*>(ev));
+	}
+}
+
+void QWindow_MouseMoveEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->mouseMoveEvent(static_cast<QMouseEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->mouseMoveEvent(static_cast<QMouseEvent*>(ev));
+	}
+}
+
+void QWindow_MouseMoveEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::mouseMoveEvent(static_cast<QMouseEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::mouseMoveEvent(static_cast<QMouseEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::mouseMoveEvent(static_cast<QMouseEvent*>(ev));
+	}
+}
+
+void QWindow_MousePressEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->mousePressEvent(static_cast<QMouseEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->mousePressEvent(static_cast<QMouseEvent*>(ev));
+	}
+}
+
+void QWindow_MousePressEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::mousePressEvent(static_cast<QMouseEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::mousePressEvent(static_cast<QMouseEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::mousePressEvent(static_cast<QMouseEvent*>(ev));
+	}
+}
+
+void QWindow_MouseReleaseEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->mouseReleaseEvent(static_cast<QMouseEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->mouseReleaseEvent(static_cast<QMouseEvent*>(ev));
+	}
+}
+
+void QWindow_MouseReleaseEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::mouseReleaseEvent(static_cast<QMouseEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::mouseReleaseEvent(static_cast<QMouseEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::mouseReleaseEvent(static_cast<QMouseEvent*>(ev));
+	}
+}
+
+void QWindow_MoveEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->moveEvent(static_cast<QMoveEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->moveEvent(static_cast<QMoveEvent*>(ev));
+	}
+}
+
+void QWindow_MoveEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::moveEvent(static_cast<QMoveEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::moveEvent(static_cast<QMoveEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::moveEvent(static_cast<QMoveEvent*>(ev));
+	}
+}
+
+void QWindow_ConnectOpacityChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(qreal)>(&QWindow::opacityChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(qreal)>(&MyQWindow::Signal_OpacityChanged));
+}
+
+void QWindow_DisconnectOpacityChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(qreal)>(&QWindow::opacityChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(qreal)>(&MyQWindow::Signal_OpacityChanged));
+}
+
+void QWindow_OpacityChanged(void* ptr, double opacity)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->opacityChanged(opacity);
+	} else {
+		static_cast<QWindow*>(ptr)->opacityChanged(opacity);
+	}
+}
+
+void QWindow_Raise(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "raise");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "raise");
+	}
+}
+
+void QWindow_RaiseDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::raise();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::raise();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::raise();
+	}
+}
+
+void QWindow_ReportContentOrientationChange(void* ptr, long long orientation)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->reportContentOrientationChange(static_cast<Qt::ScreenOrientation>(orientation));
+	} else {
+		static_cast<QWindow*>(ptr)->reportContentOrientationChange(static_cast<Qt::ScreenOrientation>(orientation));
+	}
+}
+
+void QWindow_RequestActivate(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "requestActivate");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "requestActivate");
+	}
+}
+
+void QWindow_RequestActivateDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::requestActivate();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::requestActivate();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::requestActivate();
+	}
+}
+
+void QWindow_RequestUpdate(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "requestUpdate");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "requestUpdate");
+	}
+}
+
+void QWindow_RequestUpdateDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::requestUpdate();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::requestUpdate();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::requestUpdate();
+	}
+}
+
+void QWindow_Resize(void* ptr, void* newSize)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->resize(*static_cast<QSize*>(newSize));
+	} else {
+		static_cast<QWindow*>(ptr)->resize(*static_cast<QSize*>(newSize));
+	}
+}
+
+void QWindow_Resize2(void* ptr, int w, int h)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->resize(w, h);
+	} else {
+		static_cast<QWindow*>(ptr)->resize(w, h);
+	}
+}
+
+void QWindow_ResizeEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->resizeEvent(static_cast<QResizeEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->resizeEvent(static_cast<QResizeEvent*>(ev));
+	}
+}
+
+void QWindow_ResizeEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::resizeEvent(static_cast<QResizeEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::resizeEvent(static_cast<QResizeEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::resizeEvent(static_cast<QResizeEvent*>(ev));
+	}
+}
+
+void QWindow_ConnectScreenChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(QScreen *)>(&QWindow::screenChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(QScreen *)>(&MyQWindow::Signal_ScreenChanged));
+}
+
+void QWindow_DisconnectScreenChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(QScreen *)>(&QWindow::screenChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(QScreen *)>(&MyQWindow::Signal_ScreenChanged));
+}
+
+void QWindow_ScreenChanged(void* ptr, void* screen)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->screenChanged(static_cast<QScreen*>(screen));
+	} else {
+		static_cast<QWindow*>(ptr)->screenChanged(static_cast<QScreen*>(screen));
+	}
+}
+
+void QWindow_SetBaseSize(void* ptr, void* size)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setBaseSize(*static_cast<QSize*>(size));
+	} else {
+		static_cast<QWindow*>(ptr)->setBaseSize(*static_cast<QSize*>(size));
+	}
+}
+
+void QWindow_SetCursor(void* ptr, void* cursor)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setCursor(*static_cast<QCursor*>(cursor));
+	} else {
+		static_cast<QWindow*>(ptr)->setCursor(*static_cast<QCursor*>(cursor));
+	}
+}
+
+void QWindow_SetFilePath(void* ptr, char* filePath)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setFilePath(QString(filePath));
+	} else {
+		static_cast<QWindow*>(ptr)->setFilePath(QString(filePath));
+	}
+}
+
+void QWindow_SetFlags(void* ptr, long long flags)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setFlags(static_cast<Qt::WindowType>(flags));
+	} else {
+		static_cast<QWindow*>(ptr)->setFlags(static_cast<Qt::WindowType>(flags));
+	}
+}
+
+void QWindow_SetFormat(void* ptr, void* format)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setFormat(*static_cast<QSurfaceFormat*>(format));
+	} else {
+		static_cast<QWindow*>(ptr)->setFormat(*static_cast<QSurfaceFormat*>(format));
+	}
+}
+
+void QWindow_SetFramePosition(void* ptr, void* point)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setFramePosition(*static_cast<QPoint*>(point));
+	} else {
+		static_cast<QWindow*>(ptr)->setFramePosition(*static_cast<QPoint*>(point));
+	}
+}
+
+void QWindow_SetGeometry2(void* ptr, void* rect)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setGeometry(*static_cast<QRect*>(rect));
+	} else {
+		static_cast<QWindow*>(ptr)->setGeometry(*static_cast<QRect*>(rect));
+	}
+}
+
+void QWindow_SetGeometry(void* ptr, int posx, int posy, int w, int h)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setGeometry(posx, posy, w, h);
+	} else {
+		static_cast<QWindow*>(ptr)->setGeometry(posx, posy, w, h);
+	}
+}
+
+void QWindow_SetHeight(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setHeight", Q_ARG(int, arg));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setHeight", Q_ARG(int, arg));
+	}
+}
+
+void QWindow_SetHeightDefault(void* ptr, int arg)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setHeight(arg);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setHeight(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setHeight(arg);
+	}
+}
+
+void QWindow_SetIcon(void* ptr, void* icon)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setIcon(*static_cast<QIcon*>(icon));
+	} else {
+		static_cast<QWindow*>(ptr)->setIcon(*static_cast<QIcon*>(icon));
+	}
+}
+
+void QWindow_SetMask(void* ptr, void* region)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setMask(*static_cast<QRegion*>(region));
+	} else {
+		static_cast<QWindow*>(ptr)->setMask(*static_cast<QRegion*>(region));
+	}
+}
+
+void QWindow_SetMaximumHeight(void* ptr, int h)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setMaximumHeight", Q_ARG(int, h));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setMaximumHeight", Q_ARG(int, h));
+	}
+}
+
+void QWindow_SetMaximumHeightDefault(void* ptr, int h)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setMaximumHeight(h);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setMaximumHeight(h);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setMaximumHeight(h);
+	}
+}
+
+void QWindow_SetMaximumSize(void* ptr, void* size)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setMaximumSize(*static_cast<QSize*>(size));
+	} else {
+		static_cast<QWindow*>(ptr)->setMaximumSize(*static_cast<QSize*>(size));
+	}
+}
+
+void QWindow_SetMaximumWidth(void* ptr, int w)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setMaximumWidth", Q_ARG(int, w));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setMaximumWidth", Q_ARG(int, w));
+	}
+}
+
+void QWindow_SetMaximumWidthDefault(void* ptr, int w)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setMaximumWidth(w);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setMaximumWidth(w);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setMaximumWidth(w);
+	}
+}
+
+void QWindow_SetMinimumHeight(void* ptr, int h)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setMinimumHeight", Q_ARG(int, h));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setMinimumHeight", Q_ARG(int, h));
+	}
+}
+
+void QWindow_SetMinimumHeightDefault(void* ptr, int h)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setMinimumHeight(h);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setMinimumHeight(h);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setMinimumHeight(h);
+	}
+}
+
+void QWindow_SetMinimumSize(void* ptr, void* size)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setMinimumSize(*static_cast<QSize*>(size));
+	} else {
+		static_cast<QWindow*>(ptr)->setMinimumSize(*static_cast<QSize*>(size));
+	}
+}
+
+void QWindow_SetMinimumWidth(void* ptr, int w)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setMinimumWidth", Q_ARG(int, w));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setMinimumWidth", Q_ARG(int, w));
+	}
+}
+
+void QWindow_SetMinimumWidthDefault(void* ptr, int w)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setMinimumWidth(w);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setMinimumWidth(w);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setMinimumWidth(w);
+	}
+}
+
+void QWindow_SetModality(void* ptr, long long modality)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setModality(static_cast<Qt::WindowModality>(modality));
+	} else {
+		static_cast<QWindow*>(ptr)->setModality(static_cast<Qt::WindowModality>(modality));
+	}
+}
+
+void QWindow_SetOpacity(void* ptr, double level)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setOpacity(level);
+	} else {
+		static_cast<QWindow*>(ptr)->setOpacity(level);
+	}
+}
+
+void QWindow_SetParent(void* ptr, void* parent)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(parent))) {
+			static_cast<QPaintDeviceWindow*>(ptr)->setParent(static_cast<QPaintDeviceWindow*>(parent));
+		} else {
+			static_cast<QPaintDeviceWindow*>(ptr)->setParent(static_cast<QWindow*>(parent));
+		}
+	} else {
+		if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(parent))) {
+			static_cast<QWindow*>(ptr)->setParent(static_cast<QPaintDeviceWindow*>(parent));
+		} else {
+			static_cast<QWindow*>(ptr)->setParent(static_cast<QWindow*>(parent));
+		}
+	}
+}
+
+void QWindow_SetPosition(void* ptr, void* pt)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setPosition(*static_cast<QPoint*>(pt));
+	} else {
+		static_cast<QWindow*>(ptr)->setPosition(*static_cast<QPoint*>(pt));
+	}
+}
+
+void QWindow_SetPosition2(void* ptr, int posx, int posy)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setPosition(posx, posy);
+	} else {
+		static_cast<QWindow*>(ptr)->setPosition(posx, posy);
+	}
+}
+
+void QWindow_SetScreen(void* ptr, void* newScreen)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setScreen(static_cast<QScreen*>(newScreen));
+	} else {
+		static_cast<QWindow*>(ptr)->setScreen(static_cast<QScreen*>(newScreen));
+	}
+}
+
+void QWindow_SetSizeIncrement(void* ptr, void* size)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setSizeIncrement(*static_cast<QSize*>(size));
+	} else {
+		static_cast<QWindow*>(ptr)->setSizeIncrement(*static_cast<QSize*>(size));
+	}
+}
+
+void QWindow_SetSurfaceType(void* ptr, long long surfaceType)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setSurfaceType(static_cast<QSurface::SurfaceType>(surfaceType));
+	} else {
+		static_cast<QWindow*>(ptr)->setSurfaceType(static_cast<QSurface::SurfaceType>(surfaceType));
+	}
+}
+
+void QWindow_SetTitle(void* ptr, char* vqs)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setTitle", Q_ARG(QString, QString(vqs)));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setTitle", Q_ARG(QString, QString(vqs)));
+	}
+}
+
+void QWindow_SetTitleDefault(void* ptr, char* vqs)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setTitle(QString(vqs));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setTitle(QString(vqs));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setTitle(QString(vqs));
+	}
+}
+
+void QWindow_SetTransientParent(void* ptr, void* parent)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(parent))) {
+			static_cast<QPaintDeviceWindow*>(ptr)->setTransientParent(static_cast<QPaintDeviceWindow*>(parent));
+		} else {
+			static_cast<QPaintDeviceWindow*>(ptr)->setTransientParent(static_cast<QWindow*>(parent));
+		}
+	} else {
+		if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(parent))) {
+			static_cast<QWindow*>(ptr)->setTransientParent(static_cast<QPaintDeviceWindow*>(parent));
+		} else {
+			static_cast<QWindow*>(ptr)->setTransientParent(static_cast<QWindow*>(parent));
+		}
+	}
+}
+
+void QWindow_SetVisibility(void* ptr, long long v)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setVisibility(static_cast<QWindow::Visibility>(v));
+	} else {
+		static_cast<QWindow*>(ptr)->setVisibility(static_cast<QWindow::Visibility>(v));
+	}
+}
+
+void QWindow_SetVisible(void* ptr, char visible)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setVisible", Q_ARG(bool, visible != 0));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setVisible", Q_ARG(bool, visible != 0));
+	}
+}
+
+void QWindow_SetVisibleDefault(void* ptr, char visible)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setVisible(visible != 0);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setVisible(visible != 0);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setVisible(visible != 0);
+	}
+}
+
+void QWindow_SetWidth(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setWidth", Q_ARG(int, arg));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setWidth", Q_ARG(int, arg));
+	}
+}
+
+void QWindow_SetWidthDefault(void* ptr, int arg)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setWidth(arg);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setWidth(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setWidth(arg);
+	}
+}
+
+void QWindow_SetWindowState(void* ptr, long long state)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->setWindowState(static_cast<Qt::WindowState>(state));
+	} else {
+		static_cast<QWindow*>(ptr)->setWindowState(static_cast<Qt::WindowState>(state));
+	}
+}
+
+void QWindow_SetX(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setX", Q_ARG(int, arg));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setX", Q_ARG(int, arg));
+	}
+}
+
+void QWindow_SetXDefault(void* ptr, int arg)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setX(arg);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setX(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setX(arg);
+	}
+}
+
+void QWindow_SetY(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "setY", Q_ARG(int, arg));
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "setY", Q_ARG(int, arg));
+	}
+}
+
+void QWindow_SetYDefault(void* ptr, int arg)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::setY(arg);
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::setY(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::setY(arg);
+	}
+}
+
+void QWindow_Show(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "show");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "show");
+	}
+}
+
+void QWindow_ShowDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::show();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::show();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::show();
+	}
+}
+
+void QWindow_ShowEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->showEvent(static_cast<QShowEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->showEvent(static_cast<QShowEvent*>(ev));
+	}
+}
+
+void QWindow_ShowEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::showEvent(static_cast<QShowEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::showEvent(static_cast<QShowEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::showEvent(static_cast<QShowEvent*>(ev));
+	}
+}
+
+void QWindow_ShowFullScreen(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "showFullScreen");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "showFullScreen");
+	}
+}
+
+void QWindow_ShowFullScreenDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::showFullScreen();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::showFullScreen();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::showFullScreen();
+	}
+}
+
+void QWindow_ShowMaximized(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "showMaximized");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "showMaximized");
+	}
+}
+
+void QWindow_ShowMaximizedDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::showMaximized();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::showMaximized();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::showMaximized();
+	}
+}
+
+void QWindow_ShowMinimized(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "showMinimized");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "showMinimized");
+	}
+}
+
+void QWindow_ShowMinimizedDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::showMinimized();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::showMinimized();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::showMinimized();
+	}
+}
+
+void QWindow_ShowNormal(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "showNormal");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "showNormal");
+	}
+}
+
+void QWindow_ShowNormalDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::showNormal();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::showNormal();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::showNormal();
+	}
+}
+
+void QWindow_TabletEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->tabletEvent(static_cast<QTabletEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->tabletEvent(static_cast<QTabletEvent*>(ev));
+	}
+}
+
+void QWindow_TabletEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::tabletEvent(static_cast<QTabletEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::tabletEvent(static_cast<QTabletEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::tabletEvent(static_cast<QTabletEvent*>(ev));
+	}
+}
+
+void QWindow_TouchEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->touchEvent(static_cast<QTouchEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->touchEvent(static_cast<QTouchEvent*>(ev));
+	}
+}
+
+void QWindow_TouchEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::touchEvent(static_cast<QTouchEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::touchEvent(static_cast<QTouchEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::touchEvent(static_cast<QTouchEvent*>(ev));
+	}
+}
+
+void QWindow_UnsetCursor(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->unsetCursor();
+	} else {
+		static_cast<QWindow*>(ptr)->unsetCursor();
+	}
+}
+
+void QWindow_ConnectVisibilityChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(QWindow::Visibility)>(&QWindow::visibilityChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(QWindow::Visibility)>(&MyQWindow::Signal_VisibilityChanged));
+}
+
+void QWindow_DisconnectVisibilityChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(QWindow::Visibility)>(&QWindow::visibilityChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(QWindow::Visibility)>(&MyQWindow::Signal_VisibilityChanged));
+}
+
+void QWindow_VisibilityChanged(void* ptr, long long visibility)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->visibilityChanged(static_cast<QWindow::Visibility>(visibility));
+	} else {
+		static_cast<QWindow*>(ptr)->visibilityChanged(static_cast<QWindow::Visibility>(visibility));
+	}
+}
+
+void QWindow_ConnectVisibleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(bool)>(&QWindow::visibleChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(bool)>(&MyQWindow::Signal_VisibleChanged));
+}
+
+void QWindow_DisconnectVisibleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(bool)>(&QWindow::visibleChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(bool)>(&MyQWindow::Signal_VisibleChanged));
+}
+
+void QWindow_VisibleChanged(void* ptr, char arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->visibleChanged(arg != 0);
+	} else {
+		static_cast<QWindow*>(ptr)->visibleChanged(arg != 0);
+	}
+}
+
+void QWindow_WheelEvent(void* ptr, void* ev)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->wheelEvent(static_cast<QWheelEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->wheelEvent(static_cast<QWheelEvent*>(ev));
+	}
+}
+
+void QWindow_WheelEventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::wheelEvent(static_cast<QWheelEvent*>(ev));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::wheelEvent(static_cast<QWheelEvent*>(ev));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::wheelEvent(static_cast<QWheelEvent*>(ev));
+	}
+}
+
+void QWindow_ConnectWidthChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::widthChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_WidthChanged));
+}
+
+void QWindow_DisconnectWidthChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::widthChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_WidthChanged));
+}
+
+void QWindow_WidthChanged(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->widthChanged(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->widthChanged(arg);
+	}
+}
+
+void QWindow_ConnectWindowStateChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(Qt::WindowState)>(&QWindow::windowStateChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(Qt::WindowState)>(&MyQWindow::Signal_WindowStateChanged));
+}
+
+void QWindow_DisconnectWindowStateChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(Qt::WindowState)>(&QWindow::windowStateChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(Qt::WindowState)>(&MyQWindow::Signal_WindowStateChanged));
+}
+
+void QWindow_WindowStateChanged(void* ptr, long long windowState)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->windowStateChanged(static_cast<Qt::WindowState>(windowState));
+	} else {
+		static_cast<QWindow*>(ptr)->windowStateChanged(static_cast<Qt::WindowState>(windowState));
+	}
+}
+
+void QWindow_ConnectWindowTitleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(const QString &)>(&QWindow::windowTitleChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(const QString &)>(&MyQWindow::Signal_WindowTitleChanged));
+}
+
+void QWindow_DisconnectWindowTitleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(const QString &)>(&QWindow::windowTitleChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(const QString &)>(&MyQWindow::Signal_WindowTitleChanged));
+}
+
+void QWindow_WindowTitleChanged(void* ptr, char* title)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->windowTitleChanged(QString(title));
+	} else {
+		static_cast<QWindow*>(ptr)->windowTitleChanged(QString(title));
+	}
+}
+
+void QWindow_ConnectXChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::xChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_XChanged));
+}
+
+void QWindow_DisconnectXChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::xChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_XChanged));
+}
+
+void QWindow_XChanged(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->xChanged(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->xChanged(arg);
+	}
+}
+
+void QWindow_ConnectYChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::yChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_YChanged));
+}
+
+void QWindow_DisconnectYChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWindow*>(ptr), static_cast<void (QWindow::*)(int)>(&QWindow::yChanged), static_cast<MyQWindow*>(ptr), static_cast<void (MyQWindow::*)(int)>(&MyQWindow::Signal_YChanged));
+}
+
+void QWindow_YChanged(void* ptr, int arg)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->yChanged(arg);
+	} else {
+		static_cast<QWindow*>(ptr)->yChanged(arg);
+	}
+}
+
+void QWindow_DestroyQWindow(void* ptr)
+{
+	static_cast<QWindow*>(ptr)->~QWindow();
+}
+
+void QWindow_DestroyQWindowDefault(void* ptr)
+{
+
+}
+
+void* QWindow_Cursor(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QCursor(static_cast<QPaintDeviceWindow*>(ptr)->cursor());
+	} else {
+		return new QCursor(static_cast<QWindow*>(ptr)->cursor());
+	}
+}
+
+void* QWindow_Icon(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QIcon(static_cast<QPaintDeviceWindow*>(ptr)->icon());
+	} else {
+		return new QIcon(static_cast<QWindow*>(ptr)->icon());
+	}
+}
+
+void* QWindow_FrameMargins(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QMargins tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->frameMargins(); new QMargins(tmpValue.left(), tmpValue.top(), tmpValue.right(), tmpValue.bottom()); });
+	} else {
+		return ({ QMargins tmpValue = static_cast<QWindow*>(ptr)->frameMargins(); new QMargins(tmpValue.left(), tmpValue.top(), tmpValue.right(), tmpValue.bottom()); });
+	}
+}
+
+void* QWindow_FocusObject(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->focusObject();
+	} else {
+		return static_cast<QWindow*>(ptr)->focusObject();
+	}
+}
+
+void* QWindow_FocusObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QRasterWindow*>(ptr)->QRasterWindow::focusObject();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::focusObject();
+	} else {
+		return static_cast<QWindow*>(ptr)->QWindow::focusObject();
+	}
+}
+
+void* QWindow_FramePosition(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QPoint tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->framePosition(); new QPoint(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPoint tmpValue = static_cast<QWindow*>(ptr)->framePosition(); new QPoint(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QWindow_MapFromGlobal(void* ptr, void* pos)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QPoint tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->mapFromGlobal(*static_cast<QPoint*>(pos)); new QPoint(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPoint tmpValue = static_cast<QWindow*>(ptr)->mapFromGlobal(*static_cast<QPoint*>(pos)); new QPoint(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QWindow_MapToGlobal(void* ptr, void* pos)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QPoint tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->mapToGlobal(*static_cast<QPoint*>(pos)); new QPoint(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPoint tmpValue = static_cast<QWindow*>(ptr)->mapToGlobal(*static_cast<QPoint*>(pos)); new QPoint(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QWindow_Position(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QPoint tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->position(); new QPoint(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPoint tmpValue = static_cast<QWindow*>(ptr)->position(); new QPoint(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QWindow_FrameGeometry(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->frameGeometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRect tmpValue = static_cast<QWindow*>(ptr)->frameGeometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QWindow_Geometry(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRect tmpValue = static_cast<QWindow*>(ptr)->geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QWindow_Mask(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QRegion(static_cast<QPaintDeviceWindow*>(ptr)->mask());
+	} else {
+		return new QRegion(static_cast<QWindow*>(ptr)->mask());
+	}
+}
+
+void* QWindow_Screen(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->screen();
+	} else {
+		return static_cast<QWindow*>(ptr)->screen();
+	}
+}
+
+void* QWindow_BaseSize(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->baseSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QWindow*>(ptr)->baseSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QWindow_MaximumSize(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QWindow*>(ptr)->maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QWindow_MinimumSize(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QWindow*>(ptr)->minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QWindow_Size(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->size(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QWindow*>(ptr)->size(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QWindow_SizeDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QRasterWindow*>(ptr)->QRasterWindow::size(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::size(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QWindow*>(ptr)->QWindow::size(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QWindow_SizeIncrement(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QPaintDeviceWindow*>(ptr)->sizeIncrement(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QWindow*>(ptr)->sizeIncrement(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+struct QtGui_PackedString QWindow_FilePath(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QByteArray t7116fb = static_cast<QPaintDeviceWindow*>(ptr)->filePath().toUtf8(); QtGui_PackedString { const_cast<char*>(t7116fb.prepend("WHITESPACE").constData()+10), t7116fb.size()-10 }; });
+	} else {
+		return ({ QByteArray t7116fb = static_cast<QWindow*>(ptr)->filePath().toUtf8(); QtGui_PackedString { const_cast<char*>(t7116fb.prepend("WHITESPACE").constData()+10), t7116fb.size()-10 }; });
+	}
+}
+
+struct QtGui_PackedString QWindow_Title(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return ({ QByteArray t3f590b = static_cast<QPaintDeviceWindow*>(ptr)->title().toUtf8(); QtGui_PackedString { const_cast<char*>(t3f590b.prepend("WHITESPACE").constData()+10), t3f590b.size()-10 }; });
+	} else {
+		return ({ QByteArray t3f590b = static_cast<QWindow*>(ptr)->title().toUtf8(); QtGui_PackedString { const_cast<char*>(t3f590b.prepend("WHITESPACE").constData()+10), t3f590b.size()-10 }; });
+	}
+}
+
+void* QWindow_Format(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QSurfaceFormat(static_cast<QPaintDeviceWindow*>(ptr)->format());
+	} else {
+		return new QSurfaceFormat(static_cast<QWindow*>(ptr)->format());
+	}
+}
+
+void* QWindow_FormatDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		return new QSurfaceFormat(static_cast<QRasterWindow*>(ptr)->QRasterWindow::format());
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QSurfaceFormat(static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::format());
+	} else {
+		return new QSurfaceFormat(static_cast<QWindow*>(ptr)->QWindow::format());
+	}
+}
+
+void* QWindow_RequestedFormat(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QSurfaceFormat(static_cast<QPaintDeviceWindow*>(ptr)->requestedFormat());
+	} else {
+		return new QSurfaceFormat(static_cast<QWindow*>(ptr)->requestedFormat());
+	}
+}
+
+void* QWindow_Parent(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->parent();
+	} else {
+		return static_cast<QWindow*>(ptr)->parent();
+	}
+}
+
+void* QWindow_TransientParent(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->transientParent();
+	} else {
+		return static_cast<QWindow*>(ptr)->transientParent();
+	}
+}
+
+long long QWindow_ContentOrientation(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->contentOrientation();
+	} else {
+		return static_cast<QWindow*>(ptr)->contentOrientation();
+	}
+}
+
+long long QWindow_Flags(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->flags();
+	} else {
+		return static_cast<QWindow*>(ptr)->flags();
+	}
+}
+
+long long QWindow_Modality(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->modality();
+	} else {
+		return static_cast<QWindow*>(ptr)->modality();
+	}
+}
+
+long long QWindow_WindowState(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->windowState();
+	} else {
+		return static_cast<QWindow*>(ptr)->windowState();
+	}
+}
+
+long long QWindow_Type(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->type();
+	} else {
+		return static_cast<QWindow*>(ptr)->type();
+	}
+}
+
+long long QWindow_SurfaceType(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->surfaceType();
+	} else {
+		return static_cast<QWindow*>(ptr)->surfaceType();
+	}
+}
+
+long long QWindow_SurfaceTypeDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QRasterWindow*>(ptr)->QRasterWindow::surfaceType();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::surfaceType();
+	} else {
+		return static_cast<QWindow*>(ptr)->QWindow::surfaceType();
+	}
+}
+
+long long QWindow_Visibility(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->visibility();
+	} else {
+		return static_cast<QWindow*>(ptr)->visibility();
+	}
+}
+
+uintptr_t QWindow_WinId(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->winId();
+	} else {
+		return static_cast<QWindow*>(ptr)->winId();
+	}
+}
+
+char QWindow_IsActive(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->isActive();
+	} else {
+		return static_cast<QWindow*>(ptr)->isActive();
+	}
+}
+
+char QWindow_IsAncestorOf(void* ptr, void* child, long long mode)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(child))) {
+			return static_cast<QPaintDeviceWindow*>(ptr)->isAncestorOf(static_cast<QPaintDeviceWindow*>(child), static_cast<QWindow::AncestorMode>(mode));
+		} else {
+			return static_cast<QPaintDeviceWindow*>(ptr)->isAncestorOf(static_cast<QWindow*>(child), static_cast<QWindow::AncestorMode>(mode));
+		}
+	} else {
+		if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(child))) {
+			return static_cast<QWindow*>(ptr)->isAncestorOf(static_cast<QPaintDeviceWindow*>(child), static_cast<QWindow::AncestorMode>(mode));
+		} else {
+			return static_cast<QWindow*>(ptr)->isAncestorOf(static_cast<QWindow*>(child), static_cast<QWindow::AncestorMode>(mode));
+		}
+	}
+}
+
+char QWindow_IsExposed(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->isExposed();
+	} else {
+		return static_cast<QWindow*>(ptr)->isExposed();
+	}
+}
+
+char QWindow_IsModal(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->isModal();
+	} else {
+		return static_cast<QWindow*>(ptr)->isModal();
+	}
+}
+
+char QWindow_IsTopLevel(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->isTopLevel();
+	} else {
+		return static_cast<QWindow*>(ptr)->isTopLevel();
+	}
+}
+
+char QWindow_IsVisible(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->isVisible();
+	} else {
+		return static_cast<QWindow*>(ptr)->isVisible();
+	}
+}
+
+int QWindow_Height(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->height();
+	} else {
+		return static_cast<QWindow*>(ptr)->height();
+	}
+}
+
+int QWindow_MaximumHeight(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->maximumHeight();
+	} else {
+		return static_cast<QWindow*>(ptr)->maximumHeight();
+	}
+}
+
+int QWindow_MaximumWidth(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->maximumWidth();
+	} else {
+		return static_cast<QWindow*>(ptr)->maximumWidth();
+	}
+}
+
+int QWindow_MinimumHeight(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->minimumHeight();
+	} else {
+		return static_cast<QWindow*>(ptr)->minimumHeight();
+	}
+}
+
+int QWindow_MinimumWidth(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->minimumWidth();
+	} else {
+		return static_cast<QWindow*>(ptr)->minimumWidth();
+	}
+}
+
+int QWindow_Width(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->width();
+	} else {
+		return static_cast<QWindow*>(ptr)->width();
+	}
+}
+
+int QWindow_X(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->x();
+	} else {
+		return static_cast<QWindow*>(ptr)->x();
+	}
+}
+
+int QWindow_Y(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->y();
+	} else {
+		return static_cast<QWindow*>(ptr)->y();
+	}
+}
+
+double QWindow_DevicePixelRatio(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->devicePixelRatio();
+	} else {
+		return static_cast<QWindow*>(ptr)->devicePixelRatio();
+	}
+}
+
+double QWindow_Opacity(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPaintDeviceWindow*>(ptr)->opacity();
+	} else {
+		return static_cast<QWindow*>(ptr)->opacity();
+	}
+}
+
+void* QWindow___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+	} else {
+		return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+	}
+}
+
+void QWindow___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+	} else {
+		static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+	}
+}
+
+void* QWindow___dynamicPropertyNames_newList(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QList<QByteArray>;
+	} else {
+		return new QList<QByteArray>;
+	}
+}
+
+void* QWindow___findChildren_atList2(void* ptr, int i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	} else {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	}
+}
+
+void QWindow___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	} else {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	}
+}
+
+void* QWindow___findChildren_newList2(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QList<QObject*>;
+	} else {
+		return new QList<QObject*>;
+	}
+}
+
+void* QWindow___findChildren_atList3(void* ptr, int i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	} else {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	}
+}
+
+void QWindow___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	} else {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	}
+}
+
+void* QWindow___findChildren_newList3(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QList<QObject*>;
+	} else {
+		return new QList<QObject*>;
+	}
+}
+
+void* QWindow___findChildren_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	} else {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	}
+}
+
+void QWindow___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	} else {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWindow*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	}
+}
+
+void* QWindow___findChildren_newList(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QList<QObject*>;
+	} else {
+		return new QList<QObject*>;
+	}
+}
+
+void* QWindow___children_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+	} else {
+		return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+	}
+}
+
+void QWindow___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+		} else {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	} else {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QOffscreenSurface*>(i));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPaintDeviceWindow*>(i));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QPdfWriter*>(i));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWindow*>(i));
+		} else {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	}
+}
+
+void* QWindow___children_newList(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return new QList<QObject *>;
+	} else {
+		return new QList<QObject *>;
+	}
+}
+
+char QWindow_EventFilter(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPaintDeviceWindow*>(ptr)->eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPaintDeviceWindow*>(ptr)->eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPaintDeviceWindow*>(ptr)->eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPaintDeviceWindow*>(ptr)->eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QPaintDeviceWindow*>(ptr)->eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QWindow*>(ptr)->eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QWindow*>(ptr)->eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QWindow*>(ptr)->eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QWindow*>(ptr)->eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QWindow*>(ptr)->eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+char QWindow_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRasterWindow*>(ptr)->QRasterWindow::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRasterWindow*>(ptr)->QRasterWindow::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRasterWindow*>(ptr)->QRasterWindow::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QRasterWindow*>(ptr)->QRasterWindow::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QRasterWindow*>(ptr)->QRasterWindow::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QOffscreenSurface*>(static_cast<QObject*>(watched))) {
+			return static_cast<QWindow*>(ptr)->QWindow::eventFilter(static_cast<QOffscreenSurface*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QWindow*>(ptr)->QWindow::eventFilter(static_cast<QPaintDeviceWindow*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QPdfWriter*>(static_cast<QObject*>(watched))) {
+			return static_cast<QWindow*>(ptr)->QWindow::eventFilter(static_cast<QPdfWriter*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWindow*>(static_cast<QObject*>(watched))) {
+			return static_cast<QWindow*>(ptr)->QWindow::eventFilter(static_cast<QWindow*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QWindow*>(ptr)->QWindow::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QWindow_ChildEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QWindow*>(ptr)->childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QWindow_ChildEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QWindow_ConnectNotify(void* ptr, void* sign)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QWindow*>(ptr)->connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QWindow_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QWindow_CustomEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QWindow*>(ptr)->customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QWindow_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QWindow_DeleteLater(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QPaintDeviceWindow*>(ptr), "deleteLater");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QWindow*>(ptr), "deleteLater");
+	}
+}
+
+void QWindow_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::deleteLater();
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::deleteLater();
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::deleteLater();
+	}
+}
+
+void QWindow_DisconnectNotify(void* ptr, void* sign)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QWindow*>(ptr)->disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QWindow_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QWindow_TimerEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QWindow*>(ptr)->timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void QWindow_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QRasterWindow*>(ptr)->QRasterWindow::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QWindow*>(ptr)->QWindow::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void* QWindow_MetaObject(void* ptr)
+{
+	if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QPaintDeviceWindow*>(ptr)->metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QWindow*>(ptr)->metaObject());
+	}
+}
+
+void* QWindow_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QRasterWindow*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QRasterWindow*>(ptr)->QRasterWindow::metaObject());
+	} else if (dynamic_cast<QPaintDeviceWindow*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QPaintDeviceWindow*>(ptr)->QPaintDeviceWindow::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QWindow*>(ptr)->QWindow::metaObject());
+	}
+}
+
+class MyQWindowStateChangeEvent: public QWindowStateChangeEvent
+{
+public:
+};
+
+long long QWindowStateChangeEvent_OldState(void* ptr)
+{
+	return static_cast<QWindowStateChangeEvent*>(ptr)->oldState();
+}
+
@@ -8,11 +8,9 @@ package gui
 //#include "gui.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -22,6 +20,43 @@ func cGoUnpackString(s C.struct_QtGui_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtGui_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtGui_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QAbstractTextDocumentLayout_PaintContext struct {
 	ptr unsafe.Pointer
@@ -197,7 +232,7 @@ func NewQAbstractTextDocumentLayoutFromPointer(ptr unsafe.Pointer) *QAbstractTex
 func (ptr *QAbstractTextDocumentLayout) DestroyQAbstractTextDocumentLayout() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -213,7 +248,7 @@ func (ptr *QAbstractTextDocumentLayout) Format(position int) *QTextCharFormat {
 
 func NewQAbstractTextDocumentLayout(document QTextDocument_ITF) *QAbstractTextDocumentLayout {
 	var tmpValue = NewQAbstractTextDocumentLayoutFromPointer(C.QAbstractTextDocumentLayout_NewQAbstractTextDocumentLayout(PointerFromQTextDocument(document)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -221,7 +256,7 @@ func NewQAbstractTextDocumentLayout(document QTextDocument_ITF) *QAbstractTextDo
 
 //export callbackQAbstractTextDocumentLayout_DocumentChanged
 func callbackQAbstractTextDocumentLayout_DocumentChanged(ptr unsafe.Pointer, position C.int, charsRemoved C.int, charsAdded C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "documentChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "documentChanged"); signal != nil {
 		signal.(func(int, int, int))(int(int32(position)), int(int32(charsRemoved)), int(int32(charsAdded)))
 	}
 
@@ -230,14 +265,14 @@ func callbackQAbstractTextDocumentLayout_DocumentChanged(ptr unsafe.Pointer, pos
 func (ptr *QAbstractTextDocumentLayout) ConnectDocumentChanged(f func(position int, charsRemoved int, charsAdded int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "documentChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "documentChanged", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectDocumentChanged() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "documentChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "documentChanged")
 	}
 }
 
@@ -249,7 +284,7 @@ func (ptr *QAbstractTextDocumentLayout) DocumentChanged(position int, charsRemov
 
 //export callbackQAbstractTextDocumentLayout_DocumentSizeChanged
 func callbackQAbstractTextDocumentLayout_DocumentSizeChanged(ptr unsafe.Pointer, newSize unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "documentSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "documentSizeChanged"); signal != nil {
 		signal.(func(*core.QSizeF))(core.NewQSizeFFromPointer(newSize))
 	}
 
@@ -258,14 +293,14 @@ func callbackQAbstractTextDocumentLayout_DocumentSizeChanged(ptr unsafe.Pointer,
 func (ptr *QAbstractTextDocumentLayout) ConnectDocumentSizeChanged(f func(newSize *core.QSizeF)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractTextDocumentLayout_ConnectDocumentSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "documentSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "documentSizeChanged", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectDocumentSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTextDocumentLayout_DisconnectDocumentSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "documentSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "documentSizeChanged")
 	}
 }
 
@@ -277,7 +312,7 @@ func (ptr *QAbstractTextDocumentLayout) DocumentSizeChanged(newSize core.QSizeF_
 
 //export callbackQAbstractTextDocumentLayout_Draw
 func callbackQAbstractTextDocumentLayout_Draw(ptr unsafe.Pointer, painter unsafe.Pointer, context unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "draw"); signal != nil {
+	if signal := qt.GetSignal(ptr, "draw"); signal != nil {
 		signal.(func(*QPainter, *QAbstractTextDocumentLayout_PaintContext))(NewQPainterFromPointer(painter), NewQAbstractTextDocumentLayout_PaintContextFromPointer(context))
 	}
 
@@ -286,14 +321,14 @@ func callbackQAbstractTextDocumentLayout_Draw(ptr unsafe.Pointer, painter unsafe
 func (ptr *QAbstractTextDocumentLayout) ConnectDraw(f func(painter *QPainter, context *QAbstractTextDocumentLayout_PaintContext)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "draw", f)
+		qt.ConnectSignal(ptr.Pointer(), "draw", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectDraw() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "draw")
+		qt.DisconnectSignal(ptr.Pointer(), "draw")
 	}
 }
 
@@ -305,7 +340,7 @@ func (ptr *QAbstractTextDocumentLayout) Draw(painter QPainter_ITF, context QAbst
 
 //export callbackQAbstractTextDocumentLayout_DrawInlineObject
 func callbackQAbstractTextDocumentLayout_DrawInlineObject(ptr unsafe.Pointer, painter unsafe.Pointer, rect unsafe.Pointer, object unsafe.Pointer, posInDocument C.int, format unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawInlineObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawInlineObject"); signal != nil {
 		signal.(func(*QPainter, *core.QRectF, *QTextInlineObject, int, *QTextFormat))(NewQPainterFromPointer(painter), core.NewQRectFFromPointer(rect), NewQTextInlineObjectFromPointer(object), int(int32(posInDocument)), NewQTextFormatFromPointer(format))
 	} else {
 		NewQAbstractTextDocumentLayoutFromPointer(ptr).DrawInlineObjectDefault(NewQPainterFromPointer(painter), core.NewQRectFFromPointer(rect), NewQTextInlineObjectFromPointer(object), int(int32(posInDocument)), NewQTextFormatFromPointer(format))
@@ -315,14 +350,14 @@ func callbackQAbstractTextDocumentLayout_DrawInlineObject(ptr unsafe.Pointer, pa
 func (ptr *QAbstractTextDocumentLayout) ConnectDrawInlineObject(f func(painter *QPainter, rect *core.QRectF, object *QTextInlineObject, posInDocument int, format *QTextFormat)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawInlineObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawInlineObject", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectDrawInlineObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawInlineObject")
+		qt.DisconnectSignal(ptr.Pointer(), "drawInlineObject")
 	}
 }
 
@@ -340,7 +375,7 @@ func (ptr *QAbstractTextDocumentLayout) DrawInlineObjectDefault(painter QPainter
 
 //export callbackQAbstractTextDocumentLayout_PageCountChanged
 func callbackQAbstractTextDocumentLayout_PageCountChanged(ptr unsafe.Pointer, newPages C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pageCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pageCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(newPages)))
 	}
 
@@ -349,14 +384,14 @@ func callbackQAbstractTextDocumentLayout_PageCountChanged(ptr unsafe.Pointer, ne
 func (ptr *QAbstractTextDocumentLayout) ConnectPageCountChanged(f func(newPages int)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractTextDocumentLayout_ConnectPageCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pageCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pageCountChanged", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectPageCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTextDocumentLayout_DisconnectPageCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pageCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pageCountChanged")
 	}
 }
 
@@ -368,7 +403,7 @@ func (ptr *QAbstractTextDocumentLayout) PageCountChanged(newPages int) {
 
 //export callbackQAbstractTextDocumentLayout_PositionInlineObject
 func callbackQAbstractTextDocumentLayout_PositionInlineObject(ptr unsafe.Pointer, item unsafe.Pointer, posInDocument C.int, format unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "positionInlineObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "positionInlineObject"); signal != nil {
 		signal.(func(*QTextInlineObject, int, *QTextFormat))(NewQTextInlineObjectFromPointer(item), int(int32(posInDocument)), NewQTextFormatFromPointer(format))
 	} else {
 		NewQAbstractTextDocumentLayoutFromPointer(ptr).PositionInlineObjectDefault(NewQTextInlineObjectFromPointer(item), int(int32(posInDocument)), NewQTextFormatFromPointer(format))
@@ -378,14 +413,14 @@ func callbackQAbstractTextDocumentLayout_PositionInlineObject(ptr unsafe.Pointer
 func (ptr *QAbstractTextDocumentLayout) ConnectPositionInlineObject(f func(item *QTextInlineObject, posInDocument int, format *QTextFormat)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "positionInlineObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "positionInlineObject", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectPositionInlineObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "positionInlineObject")
+		qt.DisconnectSignal(ptr.Pointer(), "positionInlineObject")
 	}
 }
 
@@ -409,7 +444,7 @@ func (ptr *QAbstractTextDocumentLayout) RegisterHandler(objectType int, componen
 
 //export callbackQAbstractTextDocumentLayout_ResizeInlineObject
 func callbackQAbstractTextDocumentLayout_ResizeInlineObject(ptr unsafe.Pointer, item unsafe.Pointer, posInDocument C.int, format unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeInlineObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeInlineObject"); signal != nil {
 		signal.(func(*QTextInlineObject, int, *QTextFormat))(NewQTextInlineObjectFromPointer(item), int(int32(posInDocument)), NewQTextFormatFromPointer(format))
 	} else {
 		NewQAbstractTextDocumentLayoutFromPointer(ptr).ResizeInlineObjectDefault(NewQTextInlineObjectFromPointer(item), int(int32(posInDocument)), NewQTextFormatFromPointer(format))
@@ -419,14 +454,14 @@ func callbackQAbstractTextDocumentLayout_ResizeInlineObject(ptr unsafe.Pointer,
 func (ptr *QAbstractTextDocumentLayout) ConnectResizeInlineObject(f func(item *QTextInlineObject, posInDocument int, format *QTextFormat)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resizeInlineObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "resizeInlineObject", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectResizeInlineObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resizeInlineObject")
+		qt.DisconnectSignal(ptr.Pointer(), "resizeInlineObject")
 	}
 }
 
@@ -456,7 +491,7 @@ func (ptr *QAbstractTextDocumentLayout) UnregisterHandler(objectType int, compon
 
 //export callbackQAbstractTextDocumentLayout_Update
 func callbackQAbstractTextDocumentLayout_Update(ptr unsafe.Pointer, rect unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func(*core.QRectF))(core.NewQRectFFromPointer(rect))
 	}
 
@@ -465,14 +500,14 @@ func callbackQAbstractTextDocumentLayout_Update(ptr unsafe.Pointer, rect unsafe.
 func (ptr *QAbstractTextDocumentLayout) ConnectUpdate(f func(rect *core.QRectF)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractTextDocumentLayout_ConnectUpdate(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "update", f)
+		qt.ConnectSignal(ptr.Pointer(), "update", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectUpdate() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTextDocumentLayout_DisconnectUpdate(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "update")
+		qt.DisconnectSignal(ptr.Pointer(), "update")
 	}
 }
 
@@ -484,7 +519,7 @@ func (ptr *QAbstractTextDocumentLayout) Update(rect core.QRectF_ITF) {
 
 //export callbackQAbstractTextDocumentLayout_UpdateBlock
 func callbackQAbstractTextDocumentLayout_UpdateBlock(ptr unsafe.Pointer, block unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateBlock"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateBlock"); signal != nil {
 		signal.(func(*QTextBlock))(NewQTextBlockFromPointer(block))
 	}
 
@@ -493,14 +528,14 @@ func callbackQAbstractTextDocumentLayout_UpdateBlock(ptr unsafe.Pointer, block u
 func (ptr *QAbstractTextDocumentLayout) ConnectUpdateBlock(f func(block *QTextBlock)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractTextDocumentLayout_ConnectUpdateBlock(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateBlock", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateBlock", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectUpdateBlock() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTextDocumentLayout_DisconnectUpdateBlock(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateBlock")
+		qt.DisconnectSignal(ptr.Pointer(), "updateBlock")
 	}
 }
 
@@ -519,7 +554,7 @@ func (ptr *QAbstractTextDocumentLayout) PaintDevice() *QPaintDevice {
 
 //export callbackQAbstractTextDocumentLayout_BlockBoundingRect
 func callbackQAbstractTextDocumentLayout_BlockBoundingRect(ptr unsafe.Pointer, block unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "blockBoundingRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "blockBoundingRect"); signal != nil {
 		return core.PointerFromQRectF(signal.(func(*QTextBlock) *core.QRectF)(NewQTextBlockFromPointer(block)))
 	}
 
@@ -529,14 +564,14 @@ func callbackQAbstractTextDocumentLayout_BlockBoundingRect(ptr unsafe.Pointer, b
 func (ptr *QAbstractTextDocumentLayout) ConnectBlockBoundingRect(f func(block *QTextBlock) *core.QRectF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "blockBoundingRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "blockBoundingRect", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectBlockBoundingRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "blockBoundingRect")
+		qt.DisconnectSignal(ptr.Pointer(), "blockBoundingRect")
 	}
 }
 
@@ -551,7 +586,7 @@ func (ptr *QAbstractTextDocumentLayout) BlockBoundingRect(block QTextBlock_ITF)
 
 //export callbackQAbstractTextDocumentLayout_FrameBoundingRect
 func callbackQAbstractTextDocumentLayout_FrameBoundingRect(ptr unsafe.Pointer, frame unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "frameBoundingRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "frameBoundingRect"); signal != nil {
 		return core.PointerFromQRectF(signal.(func(*QTextFrame) *core.QRectF)(NewQTextFrameFromPointer(frame)))
 	}
 
@@ -561,14 +596,14 @@ func callbackQAbstractTextDocumentLayout_FrameBoundingRect(ptr unsafe.Pointer, f
 func (ptr *QAbstractTextDocumentLayout) ConnectFrameBoundingRect(f func(frame *QTextFrame) *core.QRectF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "frameBoundingRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "frameBoundingRect", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectFrameBoundingRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "frameBoundingRect")
+		qt.DisconnectSignal(ptr.Pointer(), "frameBoundingRect")
 	}
 }
 
@@ -583,7 +618,7 @@ func (ptr *QAbstractTextDocumentLayout) FrameBoundingRect(frame QTextFrame_ITF)
 
 //export callbackQAbstractTextDocumentLayout_DocumentSize
 func callbackQAbstractTextDocumentLayout_DocumentSize(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "documentSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "documentSize"); signal != nil {
 		return core.PointerFromQSizeF(signal.(func() *core.QSizeF)())
 	}
 
@@ -593,14 +628,14 @@ func callbackQAbstractTextDocumentLayout_DocumentSize(ptr unsafe.Pointer) unsafe
 func (ptr *QAbstractTextDocumentLayout) ConnectDocumentSize(f func() *core.QSizeF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "documentSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "documentSize", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectDocumentSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "documentSize")
+		qt.DisconnectSignal(ptr.Pointer(), "documentSize")
 	}
 }
 
@@ -630,7 +665,7 @@ func (ptr *QAbstractTextDocumentLayout) ImageAt(pos core.QPointF_ITF) string {
 func (ptr *QAbstractTextDocumentLayout) Document() *QTextDocument {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextDocumentFromPointer(C.QAbstractTextDocumentLayout_Document(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -656,7 +691,7 @@ func (ptr *QAbstractTextDocumentLayout) HandlerForObject(objectType int) *QTextO
 
 //export callbackQAbstractTextDocumentLayout_HitTest
 func callbackQAbstractTextDocumentLayout_HitTest(ptr unsafe.Pointer, point unsafe.Pointer, accuracy C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hitTest"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hitTest"); signal != nil {
 		return C.int(int32(signal.(func(*core.QPointF, core.Qt__HitTestAccuracy) int)(core.NewQPointFFromPointer(point), core.Qt__HitTestAccuracy(accuracy))))
 	}
 
@@ -666,14 +701,14 @@ func callbackQAbstractTextDocumentLayout_HitTest(ptr unsafe.Pointer, point unsaf
 func (ptr *QAbstractTextDocumentLayout) ConnectHitTest(f func(point *core.QPointF, accuracy core.Qt__HitTestAccuracy) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hitTest", f)
+		qt.ConnectSignal(ptr.Pointer(), "hitTest", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectHitTest() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hitTest")
+		qt.DisconnectSignal(ptr.Pointer(), "hitTest")
 	}
 }
 
@@ -686,7 +721,7 @@ func (ptr *QAbstractTextDocumentLayout) HitTest(point core.QPointF_ITF, accuracy
 
 //export callbackQAbstractTextDocumentLayout_PageCount
 func callbackQAbstractTextDocumentLayout_PageCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pageCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pageCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -696,14 +731,14 @@ func callbackQAbstractTextDocumentLayout_PageCount(ptr unsafe.Pointer) C.int {
 func (ptr *QAbstractTextDocumentLayout) ConnectPageCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pageCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "pageCount", f)
 	}
 }
 
 func (ptr *QAbstractTextDocumentLayout) DisconnectPageCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pageCount")
+		qt.DisconnectSignal(ptr.Pointer(), "pageCount")
 	}
 }
 
@@ -736,7 +771,7 @@ func (ptr *QAbstractTextDocumentLayout) __dynamicPropertyNames_newList() unsafe.
 func (ptr *QAbstractTextDocumentLayout) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractTextDocumentLayout___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -757,7 +792,7 @@ func (ptr *QAbstractTextDocumentLayout) __findChildren_newList2() unsafe.Pointer
 func (ptr *QAbstractTextDocumentLayout) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractTextDocumentLayout___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -778,7 +813,7 @@ func (ptr *QAbstractTextDocumentLayout) __findChildren_newList3() unsafe.Pointer
 func (ptr *QAbstractTextDocumentLayout) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractTextDocumentLayout___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -799,7 +834,7 @@ func (ptr *QAbstractTextDocumentLayout) __findChildren_newList() unsafe.Pointer
 func (ptr *QAbstractTextDocumentLayout) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractTextDocumentLayout___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -819,7 +854,7 @@ func (ptr *QAbstractTextDocumentLayout) __children_newList() unsafe.Pointer {
 
 //export callbackQAbstractTextDocumentLayout_Event
 func callbackQAbstractTextDocumentLayout_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -835,7 +870,7 @@ func (ptr *QAbstractTextDocumentLayout) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQAbstractTextDocumentLayout_EventFilter
 func callbackQAbstractTextDocumentLayout_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -851,7 +886,7 @@ func (ptr *QAbstractTextDocumentLayout) EventFilterDefault(watched core.QObject_
 
 //export callbackQAbstractTextDocumentLayout_ChildEvent
 func callbackQAbstractTextDocumentLayout_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQAbstractTextDocumentLayoutFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -866,7 +901,7 @@ func (ptr *QAbstractTextDocumentLayout) ChildEventDefault(event core.QChildEvent
 
 //export callbackQAbstractTextDocumentLayout_ConnectNotify
 func callbackQAbstractTextDocumentLayout_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAbstractTextDocumentLayoutFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -881,7 +916,7 @@ func (ptr *QAbstractTextDocumentLayout) ConnectNotifyDefault(sign core.QMetaMeth
 
 //export callbackQAbstractTextDocumentLayout_CustomEvent
 func callbackQAbstractTextDocumentLayout_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQAbstractTextDocumentLayoutFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -896,7 +931,7 @@ func (ptr *QAbstractTextDocumentLayout) CustomEventDefault(event core.QEvent_ITF
 
 //export callbackQAbstractTextDocumentLayout_DeleteLater
 func callbackQAbstractTextDocumentLayout_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractTextDocumentLayoutFromPointer(ptr).DeleteLaterDefault()
@@ -906,14 +941,14 @@ func callbackQAbstractTextDocumentLayout_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QAbstractTextDocumentLayout) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractTextDocumentLayout_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractTextDocumentLayout_Destroyed
 func callbackQAbstractTextDocumentLayout_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -921,7 +956,7 @@ func callbackQAbstractTextDocumentLayout_Destroyed(ptr unsafe.Pointer, obj unsaf
 
 //export callbackQAbstractTextDocumentLayout_DisconnectNotify
 func callbackQAbstractTextDocumentLayout_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAbstractTextDocumentLayoutFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -936,7 +971,7 @@ func (ptr *QAbstractTextDocumentLayout) DisconnectNotifyDefault(sign core.QMetaM
 
 //export callbackQAbstractTextDocumentLayout_ObjectNameChanged
 func callbackQAbstractTextDocumentLayout_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -944,7 +979,7 @@ func callbackQAbstractTextDocumentLayout_ObjectNameChanged(ptr unsafe.Pointer, o
 
 //export callbackQAbstractTextDocumentLayout_TimerEvent
 func callbackQAbstractTextDocumentLayout_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQAbstractTextDocumentLayoutFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -959,7 +994,7 @@ func (ptr *QAbstractTextDocumentLayout) TimerEventDefault(event core.QTimerEvent
 
 //export callbackQAbstractTextDocumentLayout_MetaObject
 func callbackQAbstractTextDocumentLayout_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -1396,7 +1431,7 @@ func (ptr *QAccessibleActionInterface) ToggleAction() string {
 
 //export callbackQAccessibleActionInterface_DoAction
 func callbackQAccessibleActionInterface_DoAction(ptr unsafe.Pointer, actionName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doAction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doAction"); signal != nil {
 		signal.(func(string))(cGoUnpackString(actionName))
 	}
 
@@ -1405,14 +1440,14 @@ func callbackQAccessibleActionInterface_DoAction(ptr unsafe.Pointer, actionName
 func (ptr *QAccessibleActionInterface) ConnectDoAction(f func(actionName string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "doAction", f)
+		qt.ConnectSignal(ptr.Pointer(), "doAction", f)
 	}
 }
 
 func (ptr *QAccessibleActionInterface) DisconnectDoAction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "doAction")
+		qt.DisconnectSignal(ptr.Pointer(), "doAction")
 	}
 }
 
@@ -1426,7 +1461,7 @@ func (ptr *QAccessibleActionInterface) DoAction(actionName string) {
 
 //export callbackQAccessibleActionInterface_DestroyQAccessibleActionInterface
 func callbackQAccessibleActionInterface_DestroyQAccessibleActionInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccessibleActionInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccessibleActionInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessibleActionInterfaceFromPointer(ptr).DestroyQAccessibleActionInterfaceDefault()
@@ -1436,21 +1471,21 @@ func callbackQAccessibleActionInterface_DestroyQAccessibleActionInterface(ptr un
 func (ptr *QAccessibleActionInterface) ConnectDestroyQAccessibleActionInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleActionInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccessibleActionInterface", f)
 	}
 }
 
 func (ptr *QAccessibleActionInterface) DisconnectDestroyQAccessibleActionInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleActionInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccessibleActionInterface")
 	}
 }
 
 func (ptr *QAccessibleActionInterface) DestroyQAccessibleActionInterface() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleActionInterface_DestroyQAccessibleActionInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1458,14 +1493,14 @@ func (ptr *QAccessibleActionInterface) DestroyQAccessibleActionInterface() {
 func (ptr *QAccessibleActionInterface) DestroyQAccessibleActionInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleActionInterface_DestroyQAccessibleActionInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAccessibleActionInterface_LocalizedActionDescription
 func callbackQAccessibleActionInterface_LocalizedActionDescription(ptr unsafe.Pointer, actionName C.struct_QtGui_PackedString) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "localizedActionDescription"); signal != nil {
+	if signal := qt.GetSignal(ptr, "localizedActionDescription"); signal != nil {
 		return C.CString(signal.(func(string) string)(cGoUnpackString(actionName)))
 	}
 
@@ -1475,14 +1510,14 @@ func callbackQAccessibleActionInterface_LocalizedActionDescription(ptr unsafe.Po
 func (ptr *QAccessibleActionInterface) ConnectLocalizedActionDescription(f func(actionName string) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "localizedActionDescription", f)
+		qt.ConnectSignal(ptr.Pointer(), "localizedActionDescription", f)
 	}
 }
 
 func (ptr *QAccessibleActionInterface) DisconnectLocalizedActionDescription() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "localizedActionDescription")
+		qt.DisconnectSignal(ptr.Pointer(), "localizedActionDescription")
 	}
 }
 
@@ -1506,7 +1541,7 @@ func (ptr *QAccessibleActionInterface) LocalizedActionDescriptionDefault(actionN
 
 //export callbackQAccessibleActionInterface_LocalizedActionName
 func callbackQAccessibleActionInterface_LocalizedActionName(ptr unsafe.Pointer, actionName C.struct_QtGui_PackedString) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "localizedActionName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "localizedActionName"); signal != nil {
 		return C.CString(signal.(func(string) string)(cGoUnpackString(actionName)))
 	}
 
@@ -1516,14 +1551,14 @@ func callbackQAccessibleActionInterface_LocalizedActionName(ptr unsafe.Pointer,
 func (ptr *QAccessibleActionInterface) ConnectLocalizedActionName(f func(actionName string) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "localizedActionName", f)
+		qt.ConnectSignal(ptr.Pointer(), "localizedActionName", f)
 	}
 }
 
 func (ptr *QAccessibleActionInterface) DisconnectLocalizedActionName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "localizedActionName")
+		qt.DisconnectSignal(ptr.Pointer(), "localizedActionName")
 	}
 }
 
@@ -1547,54 +1582,54 @@ func (ptr *QAccessibleActionInterface) LocalizedActionNameDefault(actionName str
 
 //export callbackQAccessibleActionInterface_ActionNames
 func callbackQAccessibleActionInterface_ActionNames(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionNames"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "actionNames"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(make([]string, 0), "|"))
+	return cGoPackStringList(make([]string, 0))
 }
 
 func (ptr *QAccessibleActionInterface) ConnectActionNames(f func() []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "actionNames", f)
+		qt.ConnectSignal(ptr.Pointer(), "actionNames", f)
 	}
 }
 
 func (ptr *QAccessibleActionInterface) DisconnectActionNames() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "actionNames")
+		qt.DisconnectSignal(ptr.Pointer(), "actionNames")
 	}
 }
 
 func (ptr *QAccessibleActionInterface) ActionNames() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QAccessibleActionInterface_ActionNames(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QAccessibleActionInterface_ActionNames(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQAccessibleActionInterface_KeyBindingsForAction
 func callbackQAccessibleActionInterface_KeyBindingsForAction(ptr unsafe.Pointer, actionName C.struct_QtGui_PackedString) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyBindingsForAction"); signal != nil {
-		return C.CString(strings.Join(signal.(func(string) []string)(cGoUnpackString(actionName)), "|"))
+	if signal := qt.GetSignal(ptr, "keyBindingsForAction"); signal != nil {
+		return cGoPackStringList(signal.(func(string) []string)(cGoUnpackString(actionName)))
 	}
 
-	return C.CString(strings.Join(make([]string, 0), "|"))
+	return cGoPackStringList(make([]string, 0))
 }
 
 func (ptr *QAccessibleActionInterface) ConnectKeyBindingsForAction(f func(actionName string) []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "keyBindingsForAction", f)
+		qt.ConnectSignal(ptr.Pointer(), "keyBindingsForAction", f)
 	}
 }
 
 func (ptr *QAccessibleActionInterface) DisconnectKeyBindingsForAction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "keyBindingsForAction")
+		qt.DisconnectSignal(ptr.Pointer(), "keyBindingsForAction")
 	}
 }
 
@@ -1602,7 +1637,7 @@ func (ptr *QAccessibleActionInterface) KeyBindingsForAction(actionName string) [
 	if ptr.Pointer() != nil {
 		var actionNameC = C.CString(actionName)
 		defer C.free(unsafe.Pointer(actionNameC))
-		return strings.Split(cGoUnpackString(C.QAccessibleActionInterface_KeyBindingsForAction(ptr.Pointer(), actionNameC)), "|")
+		return cGoUnpackStringListAndFree(C.QAccessibleActionInterface_KeyBindingsForAction(ptr.Pointer(), actionNameC))
 	}
 	return make([]string, 0)
 }
@@ -1647,7 +1682,7 @@ func NewQAccessibleEditableTextInterfaceFromPointer(ptr unsafe.Pointer) *QAccess
 
 //export callbackQAccessibleEditableTextInterface_DeleteText
 func callbackQAccessibleEditableTextInterface_DeleteText(ptr unsafe.Pointer, startOffset C.int, endOffset C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteText"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteText"); signal != nil {
 		signal.(func(int, int))(int(int32(startOffset)), int(int32(endOffset)))
 	}
 
@@ -1656,14 +1691,14 @@ func callbackQAccessibleEditableTextInterface_DeleteText(ptr unsafe.Pointer, sta
 func (ptr *QAccessibleEditableTextInterface) ConnectDeleteText(f func(startOffset int, endOffset int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "deleteText", f)
+		qt.ConnectSignal(ptr.Pointer(), "deleteText", f)
 	}
 }
 
 func (ptr *QAccessibleEditableTextInterface) DisconnectDeleteText() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "deleteText")
+		qt.DisconnectSignal(ptr.Pointer(), "deleteText")
 	}
 }
 
@@ -1675,7 +1710,7 @@ func (ptr *QAccessibleEditableTextInterface) DeleteText(startOffset int, endOffs
 
 //export callbackQAccessibleEditableTextInterface_InsertText
 func callbackQAccessibleEditableTextInterface_InsertText(ptr unsafe.Pointer, offset C.int, text C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertText"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertText"); signal != nil {
 		signal.(func(int, string))(int(int32(offset)), cGoUnpackString(text))
 	}
 
@@ -1684,14 +1719,14 @@ func callbackQAccessibleEditableTextInterface_InsertText(ptr unsafe.Pointer, off
 func (ptr *QAccessibleEditableTextInterface) ConnectInsertText(f func(offset int, text string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "insertText", f)
+		qt.ConnectSignal(ptr.Pointer(), "insertText", f)
 	}
 }
 
 func (ptr *QAccessibleEditableTextInterface) DisconnectInsertText() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "insertText")
+		qt.DisconnectSignal(ptr.Pointer(), "insertText")
 	}
 }
 
@@ -1705,7 +1740,7 @@ func (ptr *QAccessibleEditableTextInterface) InsertText(offset int, text string)
 
 //export callbackQAccessibleEditableTextInterface_ReplaceText
 func callbackQAccessibleEditableTextInterface_ReplaceText(ptr unsafe.Pointer, startOffset C.int, endOffset C.int, text C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "replaceText"); signal != nil {
+	if signal := qt.GetSignal(ptr, "replaceText"); signal != nil {
 		signal.(func(int, int, string))(int(int32(startOffset)), int(int32(endOffset)), cGoUnpackString(text))
 	}
 
@@ -1714,14 +1749,14 @@ func callbackQAccessibleEditableTextInterface_ReplaceText(ptr unsafe.Pointer, st
 func (ptr *QAccessibleEditableTextInterface) ConnectReplaceText(f func(startOffset int, endOffset int, text string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "replaceText", f)
+		qt.ConnectSignal(ptr.Pointer(), "replaceText", f)
 	}
 }
 
 func (ptr *QAccessibleEditableTextInterface) DisconnectReplaceText() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "replaceText")
+		qt.DisconnectSignal(ptr.Pointer(), "replaceText")
 	}
 }
 
@@ -1735,7 +1770,7 @@ func (ptr *QAccessibleEditableTextInterface) ReplaceText(startOffset int, endOff
 
 //export callbackQAccessibleEditableTextInterface_DestroyQAccessibleEditableTextInterface
 func callbackQAccessibleEditableTextInterface_DestroyQAccessibleEditableTextInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccessibleEditableTextInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccessibleEditableTextInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessibleEditableTextInterfaceFromPointer(ptr).DestroyQAccessibleEditableTextInterfaceDefault()
@@ -1745,21 +1780,21 @@ func callbackQAccessibleEditableTextInterface_DestroyQAccessibleEditableTextInte
 func (ptr *QAccessibleEditableTextInterface) ConnectDestroyQAccessibleEditableTextInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleEditableTextInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccessibleEditableTextInterface", f)
 	}
 }
 
 func (ptr *QAccessibleEditableTextInterface) DisconnectDestroyQAccessibleEditableTextInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleEditableTextInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccessibleEditableTextInterface")
 	}
 }
 
 func (ptr *QAccessibleEditableTextInterface) DestroyQAccessibleEditableTextInterface() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleEditableTextInterface_DestroyQAccessibleEditableTextInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1767,7 +1802,7 @@ func (ptr *QAccessibleEditableTextInterface) DestroyQAccessibleEditableTextInter
 func (ptr *QAccessibleEditableTextInterface) DestroyQAccessibleEditableTextInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleEditableTextInterface_DestroyQAccessibleEditableTextInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1825,7 +1860,7 @@ func (ptr *QAccessibleEvent) SetChild(child int) {
 
 //export callbackQAccessibleEvent_DestroyQAccessibleEvent
 func callbackQAccessibleEvent_DestroyQAccessibleEvent(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccessibleEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccessibleEvent"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessibleEventFromPointer(ptr).DestroyQAccessibleEventDefault()
@@ -1835,21 +1870,21 @@ func callbackQAccessibleEvent_DestroyQAccessibleEvent(ptr unsafe.Pointer) {
 func (ptr *QAccessibleEvent) ConnectDestroyQAccessibleEvent(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccessibleEvent", f)
 	}
 }
 
 func (ptr *QAccessibleEvent) DisconnectDestroyQAccessibleEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccessibleEvent")
 	}
 }
 
 func (ptr *QAccessibleEvent) DestroyQAccessibleEvent() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleEvent_DestroyQAccessibleEvent(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1857,7 +1892,7 @@ func (ptr *QAccessibleEvent) DestroyQAccessibleEvent() {
 func (ptr *QAccessibleEvent) DestroyQAccessibleEventDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleEvent_DestroyQAccessibleEventDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1871,7 +1906,7 @@ func (ptr *QAccessibleEvent) Type() QAccessible__Event {
 
 //export callbackQAccessibleEvent_AccessibleInterface
 func callbackQAccessibleEvent_AccessibleInterface(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accessibleInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accessibleInterface"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func() *QAccessibleInterface)())
 	}
 
@@ -1881,14 +1916,14 @@ func callbackQAccessibleEvent_AccessibleInterface(ptr unsafe.Pointer) unsafe.Poi
 func (ptr *QAccessibleEvent) ConnectAccessibleInterface(f func() *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "accessibleInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "accessibleInterface", f)
 	}
 }
 
 func (ptr *QAccessibleEvent) DisconnectAccessibleInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "accessibleInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "accessibleInterface")
 	}
 }
 
@@ -1909,7 +1944,7 @@ func (ptr *QAccessibleEvent) AccessibleInterfaceDefault() *QAccessibleInterface
 func (ptr *QAccessibleEvent) Object() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAccessibleEvent_Object(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1927,7 +1962,7 @@ func (ptr *QAccessibleEvent) Child() int {
 func (ptr *QAccessibleEvent) M_object() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAccessibleEvent_M_object(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2028,7 +2063,7 @@ func (ptr *QAccessibleInterface) ValueInterface() *QAccessibleValueInterface {
 
 //export callbackQAccessibleInterface_Interface_cast
 func callbackQAccessibleInterface_Interface_cast(ptr unsafe.Pointer, ty C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "interface_cast"); signal != nil {
+	if signal := qt.GetSignal(ptr, "interface_cast"); signal != nil {
 		return signal.(func(QAccessible__InterfaceType) unsafe.Pointer)(QAccessible__InterfaceType(ty))
 	}
 
@@ -2038,14 +2073,14 @@ func callbackQAccessibleInterface_Interface_cast(ptr unsafe.Pointer, ty C.longlo
 func (ptr *QAccessibleInterface) ConnectInterface_cast(f func(ty QAccessible__InterfaceType) unsafe.Pointer) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "interface_cast", f)
+		qt.ConnectSignal(ptr.Pointer(), "interface_cast", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectInterface_cast() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "interface_cast")
+		qt.DisconnectSignal(ptr.Pointer(), "interface_cast")
 	}
 }
 
@@ -2065,7 +2100,7 @@ func (ptr *QAccessibleInterface) Interface_castDefault(ty QAccessible__Interface
 
 //export callbackQAccessibleInterface_SetText
 func callbackQAccessibleInterface_SetText(ptr unsafe.Pointer, t C.longlong, text C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setText"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setText"); signal != nil {
 		signal.(func(QAccessible__Text, string))(QAccessible__Text(t), cGoUnpackString(text))
 	}
 
@@ -2074,14 +2109,14 @@ func callbackQAccessibleInterface_SetText(ptr unsafe.Pointer, t C.longlong, text
 func (ptr *QAccessibleInterface) ConnectSetText(f func(t QAccessible__Text, text string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setText", f)
+		qt.ConnectSignal(ptr.Pointer(), "setText", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectSetText() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setText")
+		qt.DisconnectSignal(ptr.Pointer(), "setText")
 	}
 }
 
@@ -2095,7 +2130,7 @@ func (ptr *QAccessibleInterface) SetText(t QAccessible__Text, text string) {
 
 //export callbackQAccessibleInterface_DestroyQAccessibleInterface
 func callbackQAccessibleInterface_DestroyQAccessibleInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccessibleInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccessibleInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessibleInterfaceFromPointer(ptr).DestroyQAccessibleInterfaceDefault()
@@ -2105,21 +2140,21 @@ func callbackQAccessibleInterface_DestroyQAccessibleInterface(ptr unsafe.Pointer
 func (ptr *QAccessibleInterface) ConnectDestroyQAccessibleInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccessibleInterface", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectDestroyQAccessibleInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccessibleInterface")
 	}
 }
 
 func (ptr *QAccessibleInterface) DestroyQAccessibleInterface() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleInterface_DestroyQAccessibleInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2127,14 +2162,14 @@ func (ptr *QAccessibleInterface) DestroyQAccessibleInterface() {
 func (ptr *QAccessibleInterface) DestroyQAccessibleInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleInterface_DestroyQAccessibleInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAccessibleInterface_Role
 func callbackQAccessibleInterface_Role(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "role"); signal != nil {
+	if signal := qt.GetSignal(ptr, "role"); signal != nil {
 		return C.longlong(signal.(func() QAccessible__Role)())
 	}
 
@@ -2144,14 +2179,14 @@ func callbackQAccessibleInterface_Role(ptr unsafe.Pointer) C.longlong {
 func (ptr *QAccessibleInterface) ConnectRole(f func() QAccessible__Role) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "role", f)
+		qt.ConnectSignal(ptr.Pointer(), "role", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectRole() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "role")
+		qt.DisconnectSignal(ptr.Pointer(), "role")
 	}
 }
 
@@ -2164,7 +2199,7 @@ func (ptr *QAccessibleInterface) Role() QAccessible__Role {
 
 //export callbackQAccessibleInterface_Child
 func callbackQAccessibleInterface_Child(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "child"); signal != nil {
+	if signal := qt.GetSignal(ptr, "child"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func(int) *QAccessibleInterface)(int(int32(index))))
 	}
 
@@ -2174,14 +2209,14 @@ func callbackQAccessibleInterface_Child(ptr unsafe.Pointer, index C.int) unsafe.
 func (ptr *QAccessibleInterface) ConnectChild(f func(index int) *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "child", f)
+		qt.ConnectSignal(ptr.Pointer(), "child", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectChild() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "child")
+		qt.DisconnectSignal(ptr.Pointer(), "child")
 	}
 }
 
@@ -2194,7 +2229,7 @@ func (ptr *QAccessibleInterface) Child(index int) *QAccessibleInterface {
 
 //export callbackQAccessibleInterface_ChildAt
 func callbackQAccessibleInterface_ChildAt(ptr unsafe.Pointer, x C.int, y C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childAt"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childAt"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func(int, int) *QAccessibleInterface)(int(int32(x)), int(int32(y))))
 	}
 
@@ -2204,14 +2239,14 @@ func callbackQAccessibleInterface_ChildAt(ptr unsafe.Pointer, x C.int, y C.int)
 func (ptr *QAccessibleInterface) ConnectChildAt(f func(x int, y int) *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "childAt", f)
+		qt.ConnectSignal(ptr.Pointer(), "childAt", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectChildAt() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "childAt")
+		qt.DisconnectSignal(ptr.Pointer(), "childAt")
 	}
 }
 
@@ -2224,7 +2259,7 @@ func (ptr *QAccessibleInterface) ChildAt(x int, y int) *QAccessibleInterface {
 
 //export callbackQAccessibleInterface_FocusChild
 func callbackQAccessibleInterface_FocusChild(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusChild"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func() *QAccessibleInterface)())
 	}
 
@@ -2234,14 +2269,14 @@ func callbackQAccessibleInterface_FocusChild(ptr unsafe.Pointer) unsafe.Pointer
 func (ptr *QAccessibleInterface) ConnectFocusChild(f func() *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "focusChild", f)
+		qt.ConnectSignal(ptr.Pointer(), "focusChild", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectFocusChild() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "focusChild")
+		qt.DisconnectSignal(ptr.Pointer(), "focusChild")
 	}
 }
 
@@ -2261,7 +2296,7 @@ func (ptr *QAccessibleInterface) FocusChildDefault() *QAccessibleInterface {
 
 //export callbackQAccessibleInterface_Parent
 func callbackQAccessibleInterface_Parent(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func() *QAccessibleInterface)())
 	}
 
@@ -2271,14 +2306,14 @@ func callbackQAccessibleInterface_Parent(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QAccessibleInterface) ConnectParent(f func() *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parent", f)
+		qt.ConnectSignal(ptr.Pointer(), "parent", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectParent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parent")
+		qt.DisconnectSignal(ptr.Pointer(), "parent")
 	}
 }
 
@@ -2291,7 +2326,7 @@ func (ptr *QAccessibleInterface) Parent() *QAccessibleInterface {
 
 //export callbackQAccessibleInterface_BackgroundColor
 func callbackQAccessibleInterface_BackgroundColor(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "backgroundColor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "backgroundColor"); signal != nil {
 		return PointerFromQColor(signal.(func() *QColor)())
 	}
 
@@ -2301,14 +2336,14 @@ func callbackQAccessibleInterface_BackgroundColor(ptr unsafe.Pointer) unsafe.Poi
 func (ptr *QAccessibleInterface) ConnectBackgroundColor(f func() *QColor) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundColor", f)
+		qt.ConnectSignal(ptr.Pointer(), "backgroundColor", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectBackgroundColor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "backgroundColor")
+		qt.DisconnectSignal(ptr.Pointer(), "backgroundColor")
 	}
 }
 
@@ -2332,7 +2367,7 @@ func (ptr *QAccessibleInterface) BackgroundColorDefault() *QColor {
 
 //export callbackQAccessibleInterface_ForegroundColor
 func callbackQAccessibleInterface_ForegroundColor(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "foregroundColor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "foregroundColor"); signal != nil {
 		return PointerFromQColor(signal.(func() *QColor)())
 	}
 
@@ -2342,14 +2377,14 @@ func callbackQAccessibleInterface_ForegroundColor(ptr unsafe.Pointer) unsafe.Poi
 func (ptr *QAccessibleInterface) ConnectForegroundColor(f func() *QColor) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "foregroundColor", f)
+		qt.ConnectSignal(ptr.Pointer(), "foregroundColor", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectForegroundColor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "foregroundColor")
+		qt.DisconnectSignal(ptr.Pointer(), "foregroundColor")
 	}
 }
 
@@ -2373,7 +2408,7 @@ func (ptr *QAccessibleInterface) ForegroundColorDefault() *QColor {
 
 //export callbackQAccessibleInterface_Object
 func callbackQAccessibleInterface_Object(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "object"); signal != nil {
+	if signal := qt.GetSignal(ptr, "object"); signal != nil {
 		return core.PointerFromQObject(signal.(func() *core.QObject)())
 	}
 
@@ -2383,21 +2418,21 @@ func callbackQAccessibleInterface_Object(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QAccessibleInterface) ConnectObject(f func() *core.QObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "object", f)
+		qt.ConnectSignal(ptr.Pointer(), "object", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "object")
+		qt.DisconnectSignal(ptr.Pointer(), "object")
 	}
 }
 
 func (ptr *QAccessibleInterface) Object() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAccessibleInterface_Object(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2407,7 +2442,7 @@ func (ptr *QAccessibleInterface) Object() *core.QObject {
 
 //export callbackQAccessibleInterface_Rect
 func callbackQAccessibleInterface_Rect(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rect"); signal != nil {
 		return core.PointerFromQRect(signal.(func() *core.QRect)())
 	}
 
@@ -2417,14 +2452,14 @@ func callbackQAccessibleInterface_Rect(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QAccessibleInterface) ConnectRect(f func() *core.QRect) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rect", f)
+		qt.ConnectSignal(ptr.Pointer(), "rect", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rect")
+		qt.DisconnectSignal(ptr.Pointer(), "rect")
 	}
 }
 
@@ -2439,7 +2474,7 @@ func (ptr *QAccessibleInterface) Rect() *core.QRect {
 
 //export callbackQAccessibleInterface_Text
 func callbackQAccessibleInterface_Text(ptr unsafe.Pointer, t C.longlong) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "text"); signal != nil {
+	if signal := qt.GetSignal(ptr, "text"); signal != nil {
 		return C.CString(signal.(func(QAccessible__Text) string)(QAccessible__Text(t)))
 	}
 
@@ -2449,14 +2484,14 @@ func callbackQAccessibleInterface_Text(ptr unsafe.Pointer, t C.longlong) *C.char
 func (ptr *QAccessibleInterface) ConnectText(f func(t QAccessible__Text) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "text", f)
+		qt.ConnectSignal(ptr.Pointer(), "text", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectText() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "text")
+		qt.DisconnectSignal(ptr.Pointer(), "text")
 	}
 }
 
@@ -2469,7 +2504,7 @@ func (ptr *QAccessibleInterface) Text(t QAccessible__Text) string {
 
 //export callbackQAccessibleInterface_Window
 func callbackQAccessibleInterface_Window(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "window"); signal != nil {
+	if signal := qt.GetSignal(ptr, "window"); signal != nil {
 		return PointerFromQWindow(signal.(func() *QWindow)())
 	}
 
@@ -2479,21 +2514,21 @@ func callbackQAccessibleInterface_Window(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QAccessibleInterface) ConnectWindow(f func() *QWindow) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "window", f)
+		qt.ConnectSignal(ptr.Pointer(), "window", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "window")
+		qt.DisconnectSignal(ptr.Pointer(), "window")
 	}
 }
 
 func (ptr *QAccessibleInterface) Window() *QWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQWindowFromPointer(C.QAccessibleInterface_Window(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2504,7 +2539,7 @@ func (ptr *QAccessibleInterface) Window() *QWindow {
 func (ptr *QAccessibleInterface) WindowDefault() *QWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQWindowFromPointer(C.QAccessibleInterface_WindowDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2514,7 +2549,7 @@ func (ptr *QAccessibleInterface) WindowDefault() *QWindow {
 
 //export callbackQAccessibleInterface_IsValid
 func callbackQAccessibleInterface_IsValid(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isValid"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isValid"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2524,14 +2559,14 @@ func callbackQAccessibleInterface_IsValid(ptr unsafe.Pointer) C.char {
 func (ptr *QAccessibleInterface) ConnectIsValid(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isValid", f)
+		qt.ConnectSignal(ptr.Pointer(), "isValid", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectIsValid() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isValid")
+		qt.DisconnectSignal(ptr.Pointer(), "isValid")
 	}
 }
 
@@ -2544,7 +2579,7 @@ func (ptr *QAccessibleInterface) IsValid() bool {
 
 //export callbackQAccessibleInterface_ChildCount
 func callbackQAccessibleInterface_ChildCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -2554,14 +2589,14 @@ func callbackQAccessibleInterface_ChildCount(ptr unsafe.Pointer) C.int {
 func (ptr *QAccessibleInterface) ConnectChildCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "childCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "childCount", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectChildCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "childCount")
+		qt.DisconnectSignal(ptr.Pointer(), "childCount")
 	}
 }
 
@@ -2574,7 +2609,7 @@ func (ptr *QAccessibleInterface) ChildCount() int {
 
 //export callbackQAccessibleInterface_IndexOfChild
 func callbackQAccessibleInterface_IndexOfChild(ptr unsafe.Pointer, child unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexOfChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexOfChild"); signal != nil {
 		return C.int(int32(signal.(func(*QAccessibleInterface) int)(NewQAccessibleInterfaceFromPointer(child))))
 	}
 
@@ -2584,14 +2619,14 @@ func callbackQAccessibleInterface_IndexOfChild(ptr unsafe.Pointer, child unsafe.
 func (ptr *QAccessibleInterface) ConnectIndexOfChild(f func(child *QAccessibleInterface) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "indexOfChild", f)
+		qt.ConnectSignal(ptr.Pointer(), "indexOfChild", f)
 	}
 }
 
 func (ptr *QAccessibleInterface) DisconnectIndexOfChild() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "indexOfChild")
+		qt.DisconnectSignal(ptr.Pointer(), "indexOfChild")
 	}
 }
 
@@ -2643,7 +2678,7 @@ func NewQAccessibleObjectFromPointer(ptr unsafe.Pointer) *QAccessibleObject {
 
 //export callbackQAccessibleObject_SetText
 func callbackQAccessibleObject_SetText(ptr unsafe.Pointer, t C.longlong, text C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setText"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setText"); signal != nil {
 		signal.(func(QAccessible__Text, string))(QAccessible__Text(t), cGoUnpackString(text))
 	} else {
 		NewQAccessibleObjectFromPointer(ptr).SetTextDefault(QAccessible__Text(t), cGoUnpackString(text))
@@ -2653,14 +2688,14 @@ func callbackQAccessibleObject_SetText(ptr unsafe.Pointer, t C.longlong, text C.
 func (ptr *QAccessibleObject) ConnectSetText(f func(t QAccessible__Text, text string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setText", f)
+		qt.ConnectSignal(ptr.Pointer(), "setText", f)
 	}
 }
 
 func (ptr *QAccessibleObject) DisconnectSetText() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setText")
+		qt.DisconnectSignal(ptr.Pointer(), "setText")
 	}
 }
 
@@ -2682,7 +2717,7 @@ func (ptr *QAccessibleObject) SetTextDefault(t QAccessible__Text, text string) {
 
 //export callbackQAccessibleObject_DestroyQAccessibleObject
 func callbackQAccessibleObject_DestroyQAccessibleObject(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccessibleObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccessibleObject"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessibleObjectFromPointer(ptr).DestroyQAccessibleObjectDefault()
@@ -2692,21 +2727,21 @@ func callbackQAccessibleObject_DestroyQAccessibleObject(ptr unsafe.Pointer) {
 func (ptr *QAccessibleObject) ConnectDestroyQAccessibleObject(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccessibleObject", f)
 	}
 }
 
 func (ptr *QAccessibleObject) DisconnectDestroyQAccessibleObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleObject")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccessibleObject")
 	}
 }
 
 func (ptr *QAccessibleObject) DestroyQAccessibleObject() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleObject_DestroyQAccessibleObject(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2714,14 +2749,14 @@ func (ptr *QAccessibleObject) DestroyQAccessibleObject() {
 func (ptr *QAccessibleObject) DestroyQAccessibleObjectDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleObject_DestroyQAccessibleObjectDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAccessibleObject_ChildAt
 func callbackQAccessibleObject_ChildAt(ptr unsafe.Pointer, x C.int, y C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childAt"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childAt"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func(int, int) *QAccessibleInterface)(int(int32(x)), int(int32(y))))
 	}
 
@@ -2731,14 +2766,14 @@ func callbackQAccessibleObject_ChildAt(ptr unsafe.Pointer, x C.int, y C.int) uns
 func (ptr *QAccessibleObject) ConnectChildAt(f func(x int, y int) *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "childAt", f)
+		qt.ConnectSignal(ptr.Pointer(), "childAt", f)
 	}
 }
 
 func (ptr *QAccessibleObject) DisconnectChildAt() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "childAt")
+		qt.DisconnectSignal(ptr.Pointer(), "childAt")
 	}
 }
 
@@ -2758,7 +2793,7 @@ func (ptr *QAccessibleObject) ChildAtDefault(x int, y int) *QAccessibleInterface
 
 //export callbackQAccessibleObject_Object
 func callbackQAccessibleObject_Object(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "object"); signal != nil {
+	if signal := qt.GetSignal(ptr, "object"); signal != nil {
 		return core.PointerFromQObject(signal.(func() *core.QObject)())
 	}
 
@@ -2768,21 +2803,21 @@ func callbackQAccessibleObject_Object(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QAccessibleObject) ConnectObject(f func() *core.QObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "object", f)
+		qt.ConnectSignal(ptr.Pointer(), "object", f)
 	}
 }
 
 func (ptr *QAccessibleObject) DisconnectObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "object")
+		qt.DisconnectSignal(ptr.Pointer(), "object")
 	}
 }
 
 func (ptr *QAccessibleObject) Object() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAccessibleObject_Object(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2793,7 +2828,7 @@ func (ptr *QAccessibleObject) Object() *core.QObject {
 func (ptr *QAccessibleObject) ObjectDefault() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAccessibleObject_ObjectDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2803,7 +2838,7 @@ func (ptr *QAccessibleObject) ObjectDefault() *core.QObject {
 
 //export callbackQAccessibleObject_Rect
 func callbackQAccessibleObject_Rect(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rect"); signal != nil {
 		return core.PointerFromQRect(signal.(func() *core.QRect)())
 	}
 
@@ -2813,14 +2848,14 @@ func callbackQAccessibleObject_Rect(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QAccessibleObject) ConnectRect(f func() *core.QRect) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rect", f)
+		qt.ConnectSignal(ptr.Pointer(), "rect", f)
 	}
 }
 
 func (ptr *QAccessibleObject) DisconnectRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rect")
+		qt.DisconnectSignal(ptr.Pointer(), "rect")
 	}
 }
 
@@ -2844,7 +2879,7 @@ func (ptr *QAccessibleObject) RectDefault() *core.QRect {
 
 //export callbackQAccessibleObject_IsValid
 func callbackQAccessibleObject_IsValid(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isValid"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isValid"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2854,14 +2889,14 @@ func callbackQAccessibleObject_IsValid(ptr unsafe.Pointer) C.char {
 func (ptr *QAccessibleObject) ConnectIsValid(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isValid", f)
+		qt.ConnectSignal(ptr.Pointer(), "isValid", f)
 	}
 }
 
 func (ptr *QAccessibleObject) DisconnectIsValid() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isValid")
+		qt.DisconnectSignal(ptr.Pointer(), "isValid")
 	}
 }
 
@@ -2881,7 +2916,7 @@ func (ptr *QAccessibleObject) IsValidDefault() bool {
 
 //export callbackQAccessibleObject_Role
 func callbackQAccessibleObject_Role(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "role"); signal != nil {
+	if signal := qt.GetSignal(ptr, "role"); signal != nil {
 		return C.longlong(signal.(func() QAccessible__Role)())
 	}
 
@@ -2904,7 +2939,7 @@ func (ptr *QAccessibleObject) RoleDefault() QAccessible__Role {
 
 //export callbackQAccessibleObject_Child
 func callbackQAccessibleObject_Child(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "child"); signal != nil {
+	if signal := qt.GetSignal(ptr, "child"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func(int) *QAccessibleInterface)(int(int32(index))))
 	}
 
@@ -2927,7 +2962,7 @@ func (ptr *QAccessibleObject) ChildDefault(index int) *QAccessibleInterface {
 
 //export callbackQAccessibleObject_Parent
 func callbackQAccessibleObject_Parent(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func() *QAccessibleInterface)())
 	}
 
@@ -2950,7 +2985,7 @@ func (ptr *QAccessibleObject) ParentDefault() *QAccessibleInterface {
 
 //export callbackQAccessibleObject_Text
 func callbackQAccessibleObject_Text(ptr unsafe.Pointer, t C.longlong) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "text"); signal != nil {
+	if signal := qt.GetSignal(ptr, "text"); signal != nil {
 		return C.CString(signal.(func(QAccessible__Text) string)(QAccessible__Text(t)))
 	}
 
@@ -2973,7 +3008,7 @@ func (ptr *QAccessibleObject) TextDefault(t QAccessible__Text) string {
 
 //export callbackQAccessibleObject_ChildCount
 func callbackQAccessibleObject_ChildCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -2996,7 +3031,7 @@ func (ptr *QAccessibleObject) ChildCountDefault() int {
 
 //export callbackQAccessibleObject_IndexOfChild
 func callbackQAccessibleObject_IndexOfChild(ptr unsafe.Pointer, child unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexOfChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexOfChild"); signal != nil {
 		return C.int(int32(signal.(func(*QAccessibleInterface) int)(NewQAccessibleInterfaceFromPointer(child))))
 	}
 
@@ -3058,7 +3093,7 @@ func NewQAccessiblePluginFromPointer(ptr unsafe.Pointer) *QAccessiblePlugin {
 
 //export callbackQAccessiblePlugin_Create
 func callbackQAccessiblePlugin_Create(ptr unsafe.Pointer, key C.struct_QtGui_PackedString, object unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "create"); signal != nil {
+	if signal := qt.GetSignal(ptr, "create"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func(string, *core.QObject) *QAccessibleInterface)(cGoUnpackString(key), core.NewQObjectFromPointer(object)))
 	}
 
@@ -3068,14 +3103,14 @@ func callbackQAccessiblePlugin_Create(ptr unsafe.Pointer, key C.struct_QtGui_Pac
 func (ptr *QAccessiblePlugin) ConnectCreate(f func(key string, object *core.QObject) *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "create", f)
+		qt.ConnectSignal(ptr.Pointer(), "create", f)
 	}
 }
 
 func (ptr *QAccessiblePlugin) DisconnectCreate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "create")
+		qt.DisconnectSignal(ptr.Pointer(), "create")
 	}
 }
 
@@ -3090,7 +3125,7 @@ func (ptr *QAccessiblePlugin) Create(key string, object core.QObject_ITF) *QAcce
 
 func NewQAccessiblePlugin(parent core.QObject_ITF) *QAccessiblePlugin {
 	var tmpValue = NewQAccessiblePluginFromPointer(C.QAccessiblePlugin_NewQAccessiblePlugin(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3099,7 +3134,7 @@ func NewQAccessiblePlugin(parent core.QObject_ITF) *QAccessiblePlugin {
 func (ptr *QAccessiblePlugin) DestroyQAccessiblePlugin() {
 	if ptr.Pointer() != nil {
 		C.QAccessiblePlugin_DestroyQAccessiblePlugin(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3126,7 +3161,7 @@ func (ptr *QAccessiblePlugin) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QAccessiblePlugin) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAccessiblePlugin___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3147,7 +3182,7 @@ func (ptr *QAccessiblePlugin) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QAccessiblePlugin) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAccessiblePlugin___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3168,7 +3203,7 @@ func (ptr *QAccessiblePlugin) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QAccessiblePlugin) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAccessiblePlugin___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3189,7 +3224,7 @@ func (ptr *QAccessiblePlugin) __findChildren_newList() unsafe.Pointer {
 func (ptr *QAccessiblePlugin) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAccessiblePlugin___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3209,7 +3244,7 @@ func (ptr *QAccessiblePlugin) __children_newList() unsafe.Pointer {
 
 //export callbackQAccessiblePlugin_Event
 func callbackQAccessiblePlugin_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -3225,7 +3260,7 @@ func (ptr *QAccessiblePlugin) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQAccessiblePlugin_EventFilter
 func callbackQAccessiblePlugin_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -3241,7 +3276,7 @@ func (ptr *QAccessiblePlugin) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQAccessiblePlugin_ChildEvent
 func callbackQAccessiblePlugin_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQAccessiblePluginFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -3256,7 +3291,7 @@ func (ptr *QAccessiblePlugin) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQAccessiblePlugin_ConnectNotify
 func callbackQAccessiblePlugin_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAccessiblePluginFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3271,7 +3306,7 @@ func (ptr *QAccessiblePlugin) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQAccessiblePlugin_CustomEvent
 func callbackQAccessiblePlugin_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQAccessiblePluginFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -3286,7 +3321,7 @@ func (ptr *QAccessiblePlugin) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQAccessiblePlugin_DeleteLater
 func callbackQAccessiblePlugin_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessiblePluginFromPointer(ptr).DeleteLaterDefault()
@@ -3296,14 +3331,14 @@ func callbackQAccessiblePlugin_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QAccessiblePlugin) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessiblePlugin_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAccessiblePlugin_Destroyed
 func callbackQAccessiblePlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -3311,7 +3346,7 @@ func callbackQAccessiblePlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQAccessiblePlugin_DisconnectNotify
 func callbackQAccessiblePlugin_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAccessiblePluginFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3326,7 +3361,7 @@ func (ptr *QAccessiblePlugin) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQAccessiblePlugin_ObjectNameChanged
 func callbackQAccessiblePlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -3334,7 +3369,7 @@ func callbackQAccessiblePlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQAccessiblePlugin_TimerEvent
 func callbackQAccessiblePlugin_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQAccessiblePluginFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -3349,7 +3384,7 @@ func (ptr *QAccessiblePlugin) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQAccessiblePlugin_MetaObject
 func callbackQAccessiblePlugin_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -3405,7 +3440,7 @@ func NewQAccessibleStateChangeEventFromPointer(ptr unsafe.Pointer) *QAccessibleS
 func (ptr *QAccessibleStateChangeEvent) DestroyQAccessibleStateChangeEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3450,7 +3485,7 @@ func NewQAccessibleTableCellInterfaceFromPointer(ptr unsafe.Pointer) *QAccessibl
 
 //export callbackQAccessibleTableCellInterface_DestroyQAccessibleTableCellInterface
 func callbackQAccessibleTableCellInterface_DestroyQAccessibleTableCellInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccessibleTableCellInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccessibleTableCellInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessibleTableCellInterfaceFromPointer(ptr).DestroyQAccessibleTableCellInterfaceDefault()
@@ -3460,21 +3495,21 @@ func callbackQAccessibleTableCellInterface_DestroyQAccessibleTableCellInterface(
 func (ptr *QAccessibleTableCellInterface) ConnectDestroyQAccessibleTableCellInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleTableCellInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccessibleTableCellInterface", f)
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DisconnectDestroyQAccessibleTableCellInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleTableCellInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccessibleTableCellInterface")
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DestroyQAccessibleTableCellInterface() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleTableCellInterface_DestroyQAccessibleTableCellInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3482,14 +3517,14 @@ func (ptr *QAccessibleTableCellInterface) DestroyQAccessibleTableCellInterface()
 func (ptr *QAccessibleTableCellInterface) DestroyQAccessibleTableCellInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleTableCellInterface_DestroyQAccessibleTableCellInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAccessibleTableCellInterface_Table
 func callbackQAccessibleTableCellInterface_Table(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "table"); signal != nil {
+	if signal := qt.GetSignal(ptr, "table"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func() *QAccessibleInterface)())
 	}
 
@@ -3499,14 +3534,14 @@ func callbackQAccessibleTableCellInterface_Table(ptr unsafe.Pointer) unsafe.Poin
 func (ptr *QAccessibleTableCellInterface) ConnectTable(f func() *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "table", f)
+		qt.ConnectSignal(ptr.Pointer(), "table", f)
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DisconnectTable() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "table")
+		qt.DisconnectSignal(ptr.Pointer(), "table")
 	}
 }
 
@@ -3519,7 +3554,7 @@ func (ptr *QAccessibleTableCellInterface) Table() *QAccessibleInterface {
 
 //export callbackQAccessibleTableCellInterface_ColumnHeaderCells
 func callbackQAccessibleTableCellInterface_ColumnHeaderCells(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnHeaderCells"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnHeaderCells"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQAccessibleTableCellInterfaceFromPointer(NewQAccessibleTableCellInterfaceFromPointer(nil).__columnHeaderCells_newList())
 			for _, v := range signal.(func() []*QAccessibleInterface)() {
@@ -3541,14 +3576,14 @@ func callbackQAccessibleTableCellInterface_ColumnHeaderCells(ptr unsafe.Pointer)
 func (ptr *QAccessibleTableCellInterface) ConnectColumnHeaderCells(f func() []*QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnHeaderCells", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnHeaderCells", f)
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DisconnectColumnHeaderCells() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnHeaderCells")
+		qt.DisconnectSignal(ptr.Pointer(), "columnHeaderCells")
 	}
 }
 
@@ -3567,7 +3602,7 @@ func (ptr *QAccessibleTableCellInterface) ColumnHeaderCells() []*QAccessibleInte
 
 //export callbackQAccessibleTableCellInterface_RowHeaderCells
 func callbackQAccessibleTableCellInterface_RowHeaderCells(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowHeaderCells"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowHeaderCells"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQAccessibleTableCellInterfaceFromPointer(NewQAccessibleTableCellInterfaceFromPointer(nil).__rowHeaderCells_newList())
 			for _, v := range signal.(func() []*QAccessibleInterface)() {
@@ -3589,14 +3624,14 @@ func callbackQAccessibleTableCellInterface_RowHeaderCells(ptr unsafe.Pointer) un
 func (ptr *QAccessibleTableCellInterface) ConnectRowHeaderCells(f func() []*QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowHeaderCells", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowHeaderCells", f)
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DisconnectRowHeaderCells() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowHeaderCells")
+		qt.DisconnectSignal(ptr.Pointer(), "rowHeaderCells")
 	}
 }
 
@@ -3615,7 +3650,7 @@ func (ptr *QAccessibleTableCellInterface) RowHeaderCells() []*QAccessibleInterfa
 
 //export callbackQAccessibleTableCellInterface_IsSelected
 func callbackQAccessibleTableCellInterface_IsSelected(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isSelected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isSelected"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3625,14 +3660,14 @@ func callbackQAccessibleTableCellInterface_IsSelected(ptr unsafe.Pointer) C.char
 func (ptr *QAccessibleTableCellInterface) ConnectIsSelected(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isSelected", f)
+		qt.ConnectSignal(ptr.Pointer(), "isSelected", f)
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DisconnectIsSelected() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isSelected")
+		qt.DisconnectSignal(ptr.Pointer(), "isSelected")
 	}
 }
 
@@ -3645,7 +3680,7 @@ func (ptr *QAccessibleTableCellInterface) IsSelected() bool {
 
 //export callbackQAccessibleTableCellInterface_ColumnExtent
 func callbackQAccessibleTableCellInterface_ColumnExtent(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnExtent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnExtent"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -3655,14 +3690,14 @@ func callbackQAccessibleTableCellInterface_ColumnExtent(ptr unsafe.Pointer) C.in
 func (ptr *QAccessibleTableCellInterface) ConnectColumnExtent(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnExtent", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnExtent", f)
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DisconnectColumnExtent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnExtent")
+		qt.DisconnectSignal(ptr.Pointer(), "columnExtent")
 	}
 }
 
@@ -3675,7 +3710,7 @@ func (ptr *QAccessibleTableCellInterface) ColumnExtent() int {
 
 //export callbackQAccessibleTableCellInterface_ColumnIndex
 func callbackQAccessibleTableCellInterface_ColumnIndex(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnIndex"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -3685,14 +3720,14 @@ func callbackQAccessibleTableCellInterface_ColumnIndex(ptr unsafe.Pointer) C.int
 func (ptr *QAccessibleTableCellInterface) ConnectColumnIndex(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnIndex", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnIndex", f)
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DisconnectColumnIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnIndex")
+		qt.DisconnectSignal(ptr.Pointer(), "columnIndex")
 	}
 }
 
@@ -3705,7 +3740,7 @@ func (ptr *QAccessibleTableCellInterface) ColumnIndex() int {
 
 //export callbackQAccessibleTableCellInterface_RowExtent
 func callbackQAccessibleTableCellInterface_RowExtent(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowExtent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowExtent"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -3715,14 +3750,14 @@ func callbackQAccessibleTableCellInterface_RowExtent(ptr unsafe.Pointer) C.int {
 func (ptr *QAccessibleTableCellInterface) ConnectRowExtent(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowExtent", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowExtent", f)
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DisconnectRowExtent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowExtent")
+		qt.DisconnectSignal(ptr.Pointer(), "rowExtent")
 	}
 }
 
@@ -3735,7 +3770,7 @@ func (ptr *QAccessibleTableCellInterface) RowExtent() int {
 
 //export callbackQAccessibleTableCellInterface_RowIndex
 func callbackQAccessibleTableCellInterface_RowIndex(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowIndex"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -3745,14 +3780,14 @@ func callbackQAccessibleTableCellInterface_RowIndex(ptr unsafe.Pointer) C.int {
 func (ptr *QAccessibleTableCellInterface) ConnectRowIndex(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowIndex", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowIndex", f)
 	}
 }
 
 func (ptr *QAccessibleTableCellInterface) DisconnectRowIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowIndex")
+		qt.DisconnectSignal(ptr.Pointer(), "rowIndex")
 	}
 }
 
@@ -3837,7 +3872,7 @@ func NewQAccessibleTableInterfaceFromPointer(ptr unsafe.Pointer) *QAccessibleTab
 
 //export callbackQAccessibleTableInterface_SelectColumn
 func callbackQAccessibleTableInterface_SelectColumn(ptr unsafe.Pointer, column C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectColumn"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectColumn"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(column))))))
 	}
 
@@ -3847,14 +3882,14 @@ func callbackQAccessibleTableInterface_SelectColumn(ptr unsafe.Pointer, column C
 func (ptr *QAccessibleTableInterface) ConnectSelectColumn(f func(column int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectColumn", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectColumn", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectSelectColumn() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectColumn")
+		qt.DisconnectSignal(ptr.Pointer(), "selectColumn")
 	}
 }
 
@@ -3867,7 +3902,7 @@ func (ptr *QAccessibleTableInterface) SelectColumn(column int) bool {
 
 //export callbackQAccessibleTableInterface_SelectRow
 func callbackQAccessibleTableInterface_SelectRow(ptr unsafe.Pointer, row C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectRow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectRow"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(row))))))
 	}
 
@@ -3877,14 +3912,14 @@ func callbackQAccessibleTableInterface_SelectRow(ptr unsafe.Pointer, row C.int)
 func (ptr *QAccessibleTableInterface) ConnectSelectRow(f func(row int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectRow", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectRow", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectSelectRow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectRow")
+		qt.DisconnectSignal(ptr.Pointer(), "selectRow")
 	}
 }
 
@@ -3897,7 +3932,7 @@ func (ptr *QAccessibleTableInterface) SelectRow(row int) bool {
 
 //export callbackQAccessibleTableInterface_UnselectColumn
 func callbackQAccessibleTableInterface_UnselectColumn(ptr unsafe.Pointer, column C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unselectColumn"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unselectColumn"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(column))))))
 	}
 
@@ -3907,14 +3942,14 @@ func callbackQAccessibleTableInterface_UnselectColumn(ptr unsafe.Pointer, column
 func (ptr *QAccessibleTableInterface) ConnectUnselectColumn(f func(column int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unselectColumn", f)
+		qt.ConnectSignal(ptr.Pointer(), "unselectColumn", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectUnselectColumn() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unselectColumn")
+		qt.DisconnectSignal(ptr.Pointer(), "unselectColumn")
 	}
 }
 
@@ -3927,7 +3962,7 @@ func (ptr *QAccessibleTableInterface) UnselectColumn(column int) bool {
 
 //export callbackQAccessibleTableInterface_UnselectRow
 func callbackQAccessibleTableInterface_UnselectRow(ptr unsafe.Pointer, row C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unselectRow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unselectRow"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(row))))))
 	}
 
@@ -3937,14 +3972,14 @@ func callbackQAccessibleTableInterface_UnselectRow(ptr unsafe.Pointer, row C.int
 func (ptr *QAccessibleTableInterface) ConnectUnselectRow(f func(row int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unselectRow", f)
+		qt.ConnectSignal(ptr.Pointer(), "unselectRow", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectUnselectRow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unselectRow")
+		qt.DisconnectSignal(ptr.Pointer(), "unselectRow")
 	}
 }
 
@@ -3957,7 +3992,7 @@ func (ptr *QAccessibleTableInterface) UnselectRow(row int) bool {
 
 //export callbackQAccessibleTableInterface_ModelChange
 func callbackQAccessibleTableInterface_ModelChange(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelChange"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelChange"); signal != nil {
 		signal.(func(*QAccessibleTableModelChangeEvent))(NewQAccessibleTableModelChangeEventFromPointer(event))
 	}
 
@@ -3966,14 +4001,14 @@ func callbackQAccessibleTableInterface_ModelChange(ptr unsafe.Pointer, event uns
 func (ptr *QAccessibleTableInterface) ConnectModelChange(f func(event *QAccessibleTableModelChangeEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modelChange", f)
+		qt.ConnectSignal(ptr.Pointer(), "modelChange", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectModelChange() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modelChange")
+		qt.DisconnectSignal(ptr.Pointer(), "modelChange")
 	}
 }
 
@@ -3985,7 +4020,7 @@ func (ptr *QAccessibleTableInterface) ModelChange(event QAccessibleTableModelCha
 
 //export callbackQAccessibleTableInterface_DestroyQAccessibleTableInterface
 func callbackQAccessibleTableInterface_DestroyQAccessibleTableInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccessibleTableInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccessibleTableInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessibleTableInterfaceFromPointer(ptr).DestroyQAccessibleTableInterfaceDefault()
@@ -3995,21 +4030,21 @@ func callbackQAccessibleTableInterface_DestroyQAccessibleTableInterface(ptr unsa
 func (ptr *QAccessibleTableInterface) ConnectDestroyQAccessibleTableInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleTableInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccessibleTableInterface", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectDestroyQAccessibleTableInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleTableInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccessibleTableInterface")
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DestroyQAccessibleTableInterface() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleTableInterface_DestroyQAccessibleTableInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4017,14 +4052,14 @@ func (ptr *QAccessibleTableInterface) DestroyQAccessibleTableInterface() {
 func (ptr *QAccessibleTableInterface) DestroyQAccessibleTableInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleTableInterface_DestroyQAccessibleTableInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAccessibleTableInterface_Caption
 func callbackQAccessibleTableInterface_Caption(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "caption"); signal != nil {
+	if signal := qt.GetSignal(ptr, "caption"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func() *QAccessibleInterface)())
 	}
 
@@ -4034,14 +4069,14 @@ func callbackQAccessibleTableInterface_Caption(ptr unsafe.Pointer) unsafe.Pointe
 func (ptr *QAccessibleTableInterface) ConnectCaption(f func() *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "caption", f)
+		qt.ConnectSignal(ptr.Pointer(), "caption", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectCaption() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "caption")
+		qt.DisconnectSignal(ptr.Pointer(), "caption")
 	}
 }
 
@@ -4054,7 +4089,7 @@ func (ptr *QAccessibleTableInterface) Caption() *QAccessibleInterface {
 
 //export callbackQAccessibleTableInterface_CellAt
 func callbackQAccessibleTableInterface_CellAt(ptr unsafe.Pointer, row C.int, column C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cellAt"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cellAt"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func(int, int) *QAccessibleInterface)(int(int32(row)), int(int32(column))))
 	}
 
@@ -4064,14 +4099,14 @@ func callbackQAccessibleTableInterface_CellAt(ptr unsafe.Pointer, row C.int, col
 func (ptr *QAccessibleTableInterface) ConnectCellAt(f func(row int, column int) *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cellAt", f)
+		qt.ConnectSignal(ptr.Pointer(), "cellAt", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectCellAt() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cellAt")
+		qt.DisconnectSignal(ptr.Pointer(), "cellAt")
 	}
 }
 
@@ -4084,7 +4119,7 @@ func (ptr *QAccessibleTableInterface) CellAt(row int, column int) *QAccessibleIn
 
 //export callbackQAccessibleTableInterface_Summary
 func callbackQAccessibleTableInterface_Summary(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "summary"); signal != nil {
+	if signal := qt.GetSignal(ptr, "summary"); signal != nil {
 		return PointerFromQAccessibleInterface(signal.(func() *QAccessibleInterface)())
 	}
 
@@ -4094,14 +4129,14 @@ func callbackQAccessibleTableInterface_Summary(ptr unsafe.Pointer) unsafe.Pointe
 func (ptr *QAccessibleTableInterface) ConnectSummary(f func() *QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "summary", f)
+		qt.ConnectSignal(ptr.Pointer(), "summary", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectSummary() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "summary")
+		qt.DisconnectSignal(ptr.Pointer(), "summary")
 	}
 }
 
@@ -4114,7 +4149,7 @@ func (ptr *QAccessibleTableInterface) Summary() *QAccessibleInterface {
 
 //export callbackQAccessibleTableInterface_SelectedCells
 func callbackQAccessibleTableInterface_SelectedCells(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedCells"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedCells"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQAccessibleTableInterfaceFromPointer(NewQAccessibleTableInterfaceFromPointer(nil).__selectedCells_newList())
 			for _, v := range signal.(func() []*QAccessibleInterface)() {
@@ -4136,14 +4171,14 @@ func callbackQAccessibleTableInterface_SelectedCells(ptr unsafe.Pointer) unsafe.
 func (ptr *QAccessibleTableInterface) ConnectSelectedCells(f func() []*QAccessibleInterface) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedCells", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedCells", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectSelectedCells() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedCells")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedCells")
 	}
 }
 
@@ -4162,36 +4197,36 @@ func (ptr *QAccessibleTableInterface) SelectedCells() []*QAccessibleInterface {
 
 //export callbackQAccessibleTableInterface_SelectedColumns
 func callbackQAccessibleTableInterface_SelectedColumns(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedColumns"); signal != nil {
-		return func() unsafe.Pointer {
-			var tmpList = NewQAccessibleTableInterfaceFromPointer(NewQAccessibleTableInterfaceFromPointer(nil).__selectedColumns_newList())
-			for _, v := range signal.(func() []int)() {
-				tmpList.__selectedColumns_setList(v)
+	if signal := qt.GetSignal(ptr, "selectedColumns"); signal != nil {
+		return func(l []int) unsafe.Pointer {
+			var tmpList = make([]C.int, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.int(int32(v))
 			}
-			return tmpList.Pointer()
-		}()
+			return NewQAccessibleTableInterfaceFromPointer(nil).__selectedColumns_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(signal.(func() []int)())
 	}
 
-	return func() unsafe.Pointer {
-		var tmpList = NewQAccessibleTableInterfaceFromPointer(NewQAccessibleTableInterfaceFromPointer(nil).__selectedColumns_newList())
-		for _, v := range make([]int, 0) {
-			tmpList.__selectedColumns_setList(v)
+	return func(l []int) unsafe.Pointer {
+		var tmpList = make([]C.int, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = C.int(int32(v))
 		}
-		return tmpList.Pointer()
-	}()
+		return NewQAccessibleTableInterfaceFromPointer(nil).__selectedColumns_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+	}(make([]int, 0))
 }
 
 func (ptr *QAccessibleTableInterface) ConnectSelectedColumns(f func() []int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedColumns", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedColumns", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectSelectedColumns() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedColumns")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedColumns")
 	}
 }
 
@@ -4199,8 +4234,10 @@ func (ptr *QAccessibleTableInterface) SelectedColumns() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQAccessibleTableInterfaceFromPointer(l.data).__selectedColumns_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQAccessibleTableInterfaceFromPointer(l.data).__selectedColumns_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QAccessibleTableInterface_SelectedColumns(ptr.Pointer()))
@@ -4210,36 +4247,36 @@ func (ptr *QAccessibleTableInterface) SelectedColumns() []int {
 
 //export callbackQAccessibleTableInterface_SelectedRows
 func callbackQAccessibleTableInterface_SelectedRows(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedRows"); signal != nil {
-		return func() unsafe.Pointer {
-			var tmpList = NewQAccessibleTableInterfaceFromPointer(NewQAccessibleTableInterfaceFromPointer(nil).__selectedRows_newList())
-			for _, v := range signal.(func() []int)() {
-				tmpList.__selectedRows_setList(v)
+	if signal := qt.GetSignal(ptr, "selectedRows"); signal != nil {
+		return func(l []int) unsafe.Pointer {
+			var tmpList = make([]C.int, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.int(int32(v))
 			}
-			return tmpList.Pointer()
-		}()
+			return NewQAccessibleTableInterfaceFromPointer(nil).__selectedRows_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(signal.(func() []int)())
 	}
 
-	return func() unsafe.Pointer {
-		var tmpList = NewQAccessibleTableInterfaceFromPointer(NewQAccessibleTableInterfaceFromPointer(nil).__selectedRows_newList())
-		for _, v := range make([]int, 0) {
-			tmpList.__selectedRows_setList(v)
+	return func(l []int) unsafe.Pointer {
+		var tmpList = make([]C.int, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = C.int(int32(v))
 		}
-		return tmpList.Pointer()
-	}()
+		return NewQAccessibleTableInterfaceFromPointer(nil).__selectedRows_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+	}(make([]int, 0))
 }
 
 func (ptr *QAccessibleTableInterface) ConnectSelectedRows(f func() []int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedRows", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedRows", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectSelectedRows() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedRows")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedRows")
 	}
 }
 
@@ -4247,8 +4284,10 @@ func (ptr *QAccessibleTableInterface) SelectedRows() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQAccessibleTableInterfaceFromPointer(l.data).__selectedRows_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQAccessibleTableInterfaceFromPointer(l.data).__selectedRows_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QAccessibleTableInterface_SelectedRows(ptr.Pointer()))
@@ -4258,7 +4297,7 @@ func (ptr *QAccessibleTableInterface) SelectedRows() []int {
 
 //export callbackQAccessibleTableInterface_ColumnDescription
 func callbackQAccessibleTableInterface_ColumnDescription(ptr unsafe.Pointer, column C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnDescription"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnDescription"); signal != nil {
 		return C.CString(signal.(func(int) string)(int(int32(column))))
 	}
 
@@ -4268,14 +4307,14 @@ func callbackQAccessibleTableInterface_ColumnDescription(ptr unsafe.Pointer, col
 func (ptr *QAccessibleTableInterface) ConnectColumnDescription(f func(column int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnDescription", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnDescription", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectColumnDescription() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnDescription")
+		qt.DisconnectSignal(ptr.Pointer(), "columnDescription")
 	}
 }
 
@@ -4288,7 +4327,7 @@ func (ptr *QAccessibleTableInterface) ColumnDescription(column int) string {
 
 //export callbackQAccessibleTableInterface_RowDescription
 func callbackQAccessibleTableInterface_RowDescription(ptr unsafe.Pointer, row C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowDescription"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowDescription"); signal != nil {
 		return C.CString(signal.(func(int) string)(int(int32(row))))
 	}
 
@@ -4298,14 +4337,14 @@ func callbackQAccessibleTableInterface_RowDescription(ptr unsafe.Pointer, row C.
 func (ptr *QAccessibleTableInterface) ConnectRowDescription(f func(row int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowDescription", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowDescription", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectRowDescription() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowDescription")
+		qt.DisconnectSignal(ptr.Pointer(), "rowDescription")
 	}
 }
 
@@ -4318,7 +4357,7 @@ func (ptr *QAccessibleTableInterface) RowDescription(row int) string {
 
 //export callbackQAccessibleTableInterface_IsColumnSelected
 func callbackQAccessibleTableInterface_IsColumnSelected(ptr unsafe.Pointer, column C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isColumnSelected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isColumnSelected"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(column))))))
 	}
 
@@ -4328,14 +4367,14 @@ func callbackQAccessibleTableInterface_IsColumnSelected(ptr unsafe.Pointer, colu
 func (ptr *QAccessibleTableInterface) ConnectIsColumnSelected(f func(column int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isColumnSelected", f)
+		qt.ConnectSignal(ptr.Pointer(), "isColumnSelected", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectIsColumnSelected() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isColumnSelected")
+		qt.DisconnectSignal(ptr.Pointer(), "isColumnSelected")
 	}
 }
 
@@ -4348,7 +4387,7 @@ func (ptr *QAccessibleTableInterface) IsColumnSelected(column int) bool {
 
 //export callbackQAccessibleTableInterface_IsRowSelected
 func callbackQAccessibleTableInterface_IsRowSelected(ptr unsafe.Pointer, row C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isRowSelected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isRowSelected"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(row))))))
 	}
 
@@ -4358,14 +4397,14 @@ func callbackQAccessibleTableInterface_IsRowSelected(ptr unsafe.Pointer, row C.i
 func (ptr *QAccessibleTableInterface) ConnectIsRowSelected(f func(row int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isRowSelected", f)
+		qt.ConnectSignal(ptr.Pointer(), "isRowSelected", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectIsRowSelected() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isRowSelected")
+		qt.DisconnectSignal(ptr.Pointer(), "isRowSelected")
 	}
 }
 
@@ -4378,7 +4417,7 @@ func (ptr *QAccessibleTableInterface) IsRowSelected(row int) bool {
 
 //export callbackQAccessibleTableInterface_ColumnCount
 func callbackQAccessibleTableInterface_ColumnCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -4388,14 +4427,14 @@ func callbackQAccessibleTableInterface_ColumnCount(ptr unsafe.Pointer) C.int {
 func (ptr *QAccessibleTableInterface) ConnectColumnCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCount", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectColumnCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCount")
 	}
 }
 
@@ -4408,7 +4447,7 @@ func (ptr *QAccessibleTableInterface) ColumnCount() int {
 
 //export callbackQAccessibleTableInterface_RowCount
 func callbackQAccessibleTableInterface_RowCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -4418,14 +4457,14 @@ func callbackQAccessibleTableInterface_RowCount(ptr unsafe.Pointer) C.int {
 func (ptr *QAccessibleTableInterface) ConnectRowCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCount", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectRowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCount")
 	}
 }
 
@@ -4438,7 +4477,7 @@ func (ptr *QAccessibleTableInterface) RowCount() int {
 
 //export callbackQAccessibleTableInterface_SelectedCellCount
 func callbackQAccessibleTableInterface_SelectedCellCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedCellCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedCellCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -4448,14 +4487,14 @@ func callbackQAccessibleTableInterface_SelectedCellCount(ptr unsafe.Pointer) C.i
 func (ptr *QAccessibleTableInterface) ConnectSelectedCellCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedCellCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedCellCount", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectSelectedCellCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedCellCount")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedCellCount")
 	}
 }
 
@@ -4468,7 +4507,7 @@ func (ptr *QAccessibleTableInterface) SelectedCellCount() int {
 
 //export callbackQAccessibleTableInterface_SelectedColumnCount
 func callbackQAccessibleTableInterface_SelectedColumnCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedColumnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedColumnCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -4478,14 +4517,14 @@ func callbackQAccessibleTableInterface_SelectedColumnCount(ptr unsafe.Pointer) C
 func (ptr *QAccessibleTableInterface) ConnectSelectedColumnCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedColumnCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedColumnCount", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectSelectedColumnCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedColumnCount")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedColumnCount")
 	}
 }
 
@@ -4498,7 +4537,7 @@ func (ptr *QAccessibleTableInterface) SelectedColumnCount() int {
 
 //export callbackQAccessibleTableInterface_SelectedRowCount
 func callbackQAccessibleTableInterface_SelectedRowCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedRowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedRowCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -4508,14 +4547,14 @@ func callbackQAccessibleTableInterface_SelectedRowCount(ptr unsafe.Pointer) C.in
 func (ptr *QAccessibleTableInterface) ConnectSelectedRowCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectedRowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectedRowCount", f)
 	}
 }
 
 func (ptr *QAccessibleTableInterface) DisconnectSelectedRowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectedRowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "selectedRowCount")
 	}
 }
 
@@ -4560,6 +4599,16 @@ func (ptr *QAccessibleTableInterface) __selectedColumns_newList() unsafe.Pointer
 	return unsafe.Pointer(C.QAccessibleTableInterface___selectedColumns_newList(ptr.Pointer()))
 }
 
+func (ptr *QAccessibleTableInterface) __selectedColumns_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QAccessibleTableInterface___selectedColumns_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QAccessibleTableInterface) __selectedColumns_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QAccessibleTableInterface___selectedColumns_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QAccessibleTableInterface) __selectedRows_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QAccessibleTableInterface___selectedRows_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -4577,6 +4626,16 @@ func (ptr *QAccessibleTableInterface) __selectedRows_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QAccessibleTableInterface___selectedRows_newList(ptr.Pointer()))
 }
 
+func (ptr *QAccessibleTableInterface) __selectedRows_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QAccessibleTableInterface___selectedRows_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QAccessibleTableInterface) __selectedRows_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QAccessibleTableInterface___selectedRows_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QAccessibleTableModelChangeEvent struct {
 	QAccessibleEvent
 }
@@ -4619,7 +4678,7 @@ func NewQAccessibleTableModelChangeEventFromPointer(ptr unsafe.Pointer) *QAccess
 func (ptr *QAccessibleTableModelChangeEvent) DestroyQAccessibleTableModelChangeEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4817,7 +4876,7 @@ func NewQAccessibleTextCursorEventFromPointer(ptr unsafe.Pointer) *QAccessibleTe
 func (ptr *QAccessibleTextCursorEvent) DestroyQAccessibleTextCursorEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4898,7 +4957,7 @@ func NewQAccessibleTextInsertEventFromPointer(ptr unsafe.Pointer) *QAccessibleTe
 func (ptr *QAccessibleTextInsertEvent) DestroyQAccessibleTextInsertEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4997,7 +5056,7 @@ func NewQAccessibleTextInterfaceFromPointer(ptr unsafe.Pointer) *QAccessibleText
 
 //export callbackQAccessibleTextInterface_AddSelection
 func callbackQAccessibleTextInterface_AddSelection(ptr unsafe.Pointer, startOffset C.int, endOffset C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "addSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "addSelection"); signal != nil {
 		signal.(func(int, int))(int(int32(startOffset)), int(int32(endOffset)))
 	}
 
@@ -5006,14 +5065,14 @@ func callbackQAccessibleTextInterface_AddSelection(ptr unsafe.Pointer, startOffs
 func (ptr *QAccessibleTextInterface) ConnectAddSelection(f func(startOffset int, endOffset int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "addSelection", f)
+		qt.ConnectSignal(ptr.Pointer(), "addSelection", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectAddSelection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "addSelection")
+		qt.DisconnectSignal(ptr.Pointer(), "addSelection")
 	}
 }
 
@@ -5025,7 +5084,7 @@ func (ptr *QAccessibleTextInterface) AddSelection(startOffset int, endOffset int
 
 //export callbackQAccessibleTextInterface_RemoveSelection
 func callbackQAccessibleTextInterface_RemoveSelection(ptr unsafe.Pointer, selectionIndex C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeSelection"); signal != nil {
 		signal.(func(int))(int(int32(selectionIndex)))
 	}
 
@@ -5034,14 +5093,14 @@ func callbackQAccessibleTextInterface_RemoveSelection(ptr unsafe.Pointer, select
 func (ptr *QAccessibleTextInterface) ConnectRemoveSelection(f func(selectionIndex int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "removeSelection", f)
+		qt.ConnectSignal(ptr.Pointer(), "removeSelection", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectRemoveSelection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "removeSelection")
+		qt.DisconnectSignal(ptr.Pointer(), "removeSelection")
 	}
 }
 
@@ -5053,7 +5112,7 @@ func (ptr *QAccessibleTextInterface) RemoveSelection(selectionIndex int) {
 
 //export callbackQAccessibleTextInterface_ScrollToSubstring
 func callbackQAccessibleTextInterface_ScrollToSubstring(ptr unsafe.Pointer, startIndex C.int, endIndex C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scrollToSubstring"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scrollToSubstring"); signal != nil {
 		signal.(func(int, int))(int(int32(startIndex)), int(int32(endIndex)))
 	}
 
@@ -5062,14 +5121,14 @@ func callbackQAccessibleTextInterface_ScrollToSubstring(ptr unsafe.Pointer, star
 func (ptr *QAccessibleTextInterface) ConnectScrollToSubstring(f func(startIndex int, endIndex int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "scrollToSubstring", f)
+		qt.ConnectSignal(ptr.Pointer(), "scrollToSubstring", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectScrollToSubstring() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "scrollToSubstring")
+		qt.DisconnectSignal(ptr.Pointer(), "scrollToSubstring")
 	}
 }
 
@@ -5081,7 +5140,7 @@ func (ptr *QAccessibleTextInterface) ScrollToSubstring(startIndex int, endIndex
 
 //export callbackQAccessibleTextInterface_SetCursorPosition
 func callbackQAccessibleTextInterface_SetCursorPosition(ptr unsafe.Pointer, position C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCursorPosition"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCursorPosition"); signal != nil {
 		signal.(func(int))(int(int32(position)))
 	}
 
@@ -5090,14 +5149,14 @@ func callbackQAccessibleTextInterface_SetCursorPosition(ptr unsafe.Pointer, posi
 func (ptr *QAccessibleTextInterface) ConnectSetCursorPosition(f func(position int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setCursorPosition", f)
+		qt.ConnectSignal(ptr.Pointer(), "setCursorPosition", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectSetCursorPosition() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setCursorPosition")
+		qt.DisconnectSignal(ptr.Pointer(), "setCursorPosition")
 	}
 }
 
@@ -5109,7 +5168,7 @@ func (ptr *QAccessibleTextInterface) SetCursorPosition(position int) {
 
 //export callbackQAccessibleTextInterface_SetSelection
 func callbackQAccessibleTextInterface_SetSelection(ptr unsafe.Pointer, selectionIndex C.int, startOffset C.int, endOffset C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSelection"); signal != nil {
 		signal.(func(int, int, int))(int(int32(selectionIndex)), int(int32(startOffset)), int(int32(endOffset)))
 	}
 
@@ -5118,14 +5177,14 @@ func callbackQAccessibleTextInterface_SetSelection(ptr unsafe.Pointer, selection
 func (ptr *QAccessibleTextInterface) ConnectSetSelection(f func(selectionIndex int, startOffset int, endOffset int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSelection", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSelection", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectSetSelection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSelection")
+		qt.DisconnectSignal(ptr.Pointer(), "setSelection")
 	}
 }
 
@@ -5137,7 +5196,7 @@ func (ptr *QAccessibleTextInterface) SetSelection(selectionIndex int, startOffse
 
 //export callbackQAccessibleTextInterface_DestroyQAccessibleTextInterface
 func callbackQAccessibleTextInterface_DestroyQAccessibleTextInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccessibleTextInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccessibleTextInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessibleTextInterfaceFromPointer(ptr).DestroyQAccessibleTextInterfaceDefault()
@@ -5147,21 +5206,21 @@ func callbackQAccessibleTextInterface_DestroyQAccessibleTextInterface(ptr unsafe
 func (ptr *QAccessibleTextInterface) ConnectDestroyQAccessibleTextInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleTextInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccessibleTextInterface", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectDestroyQAccessibleTextInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleTextInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccessibleTextInterface")
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DestroyQAccessibleTextInterface() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleTextInterface_DestroyQAccessibleTextInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5169,14 +5228,14 @@ func (ptr *QAccessibleTextInterface) DestroyQAccessibleTextInterface() {
 func (ptr *QAccessibleTextInterface) DestroyQAccessibleTextInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleTextInterface_DestroyQAccessibleTextInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAccessibleTextInterface_CharacterRect
 func callbackQAccessibleTextInterface_CharacterRect(ptr unsafe.Pointer, offset C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "characterRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "characterRect"); signal != nil {
 		return core.PointerFromQRect(signal.(func(int) *core.QRect)(int(int32(offset))))
 	}
 
@@ -5186,14 +5245,14 @@ func callbackQAccessibleTextInterface_CharacterRect(ptr unsafe.Pointer, offset C
 func (ptr *QAccessibleTextInterface) ConnectCharacterRect(f func(offset int) *core.QRect) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "characterRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "characterRect", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectCharacterRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "characterRect")
+		qt.DisconnectSignal(ptr.Pointer(), "characterRect")
 	}
 }
 
@@ -5208,7 +5267,7 @@ func (ptr *QAccessibleTextInterface) CharacterRect(offset int) *core.QRect {
 
 //export callbackQAccessibleTextInterface_Text
 func callbackQAccessibleTextInterface_Text(ptr unsafe.Pointer, startOffset C.int, endOffset C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "text"); signal != nil {
+	if signal := qt.GetSignal(ptr, "text"); signal != nil {
 		return C.CString(signal.(func(int, int) string)(int(int32(startOffset)), int(int32(endOffset))))
 	}
 
@@ -5218,14 +5277,14 @@ func callbackQAccessibleTextInterface_Text(ptr unsafe.Pointer, startOffset C.int
 func (ptr *QAccessibleTextInterface) ConnectText(f func(startOffset int, endOffset int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "text", f)
+		qt.ConnectSignal(ptr.Pointer(), "text", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectText() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "text")
+		qt.DisconnectSignal(ptr.Pointer(), "text")
 	}
 }
 
@@ -5238,7 +5297,7 @@ func (ptr *QAccessibleTextInterface) Text(startOffset int, endOffset int) string
 
 //export callbackQAccessibleTextInterface_TextAfterOffset
 func callbackQAccessibleTextInterface_TextAfterOffset(ptr unsafe.Pointer, offset C.int, boundaryType C.longlong, startOffset C.int, endOffset C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textAfterOffset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textAfterOffset"); signal != nil {
 		return C.CString(signal.(func(int, QAccessible__TextBoundaryType, int, int) string)(int(int32(offset)), QAccessible__TextBoundaryType(boundaryType), int(int32(startOffset)), int(int32(endOffset))))
 	}
 
@@ -5248,14 +5307,14 @@ func callbackQAccessibleTextInterface_TextAfterOffset(ptr unsafe.Pointer, offset
 func (ptr *QAccessibleTextInterface) ConnectTextAfterOffset(f func(offset int, boundaryType QAccessible__TextBoundaryType, startOffset int, endOffset int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textAfterOffset", f)
+		qt.ConnectSignal(ptr.Pointer(), "textAfterOffset", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectTextAfterOffset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textAfterOffset")
+		qt.DisconnectSignal(ptr.Pointer(), "textAfterOffset")
 	}
 }
 
@@ -5275,7 +5334,7 @@ func (ptr *QAccessibleTextInterface) TextAfterOffsetDefault(offset int, boundary
 
 //export callbackQAccessibleTextInterface_TextAtOffset
 func callbackQAccessibleTextInterface_TextAtOffset(ptr unsafe.Pointer, offset C.int, boundaryType C.longlong, startOffset C.int, endOffset C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textAtOffset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textAtOffset"); signal != nil {
 		return C.CString(signal.(func(int, QAccessible__TextBoundaryType, int, int) string)(int(int32(offset)), QAccessible__TextBoundaryType(boundaryType), int(int32(startOffset)), int(int32(endOffset))))
 	}
 
@@ -5285,14 +5344,14 @@ func callbackQAccessibleTextInterface_TextAtOffset(ptr unsafe.Pointer, offset C.
 func (ptr *QAccessibleTextInterface) ConnectTextAtOffset(f func(offset int, boundaryType QAccessible__TextBoundaryType, startOffset int, endOffset int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textAtOffset", f)
+		qt.ConnectSignal(ptr.Pointer(), "textAtOffset", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectTextAtOffset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textAtOffset")
+		qt.DisconnectSignal(ptr.Pointer(), "textAtOffset")
 	}
 }
 
@@ -5312,7 +5371,7 @@ func (ptr *QAccessibleTextInterface) TextAtOffsetDefault(offset int, boundaryTyp
 
 //export callbackQAccessibleTextInterface_TextBeforeOffset
 func callbackQAccessibleTextInterface_TextBeforeOffset(ptr unsafe.Pointer, offset C.int, boundaryType C.longlong, startOffset C.int, endOffset C.int) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textBeforeOffset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textBeforeOffset"); signal != nil {
 		return C.CString(signal.(func(int, QAccessible__TextBoundaryType, int, int) string)(int(int32(offset)), QAccessible__TextBoundaryType(boundaryType), int(int32(startOffset)), int(int32(endOffset))))
 	}
 
@@ -5322,14 +5381,14 @@ func callbackQAccessibleTextInterface_TextBeforeOffset(ptr unsafe.Pointer, offse
 func (ptr *QAccessibleTextInterface) ConnectTextBeforeOffset(f func(offset int, boundaryType QAccessible__TextBoundaryType, startOffset int, endOffset int) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textBeforeOffset", f)
+		qt.ConnectSignal(ptr.Pointer(), "textBeforeOffset", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectTextBeforeOffset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textBeforeOffset")
+		qt.DisconnectSignal(ptr.Pointer(), "textBeforeOffset")
 	}
 }
 
@@ -5349,7 +5408,7 @@ func (ptr *QAccessibleTextInterface) TextBeforeOffsetDefault(offset int, boundar
 
 //export callbackQAccessibleTextInterface_CharacterCount
 func callbackQAccessibleTextInterface_CharacterCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "characterCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "characterCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -5359,14 +5418,14 @@ func callbackQAccessibleTextInterface_CharacterCount(ptr unsafe.Pointer) C.int {
 func (ptr *QAccessibleTextInterface) ConnectCharacterCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "characterCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "characterCount", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectCharacterCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "characterCount")
+		qt.DisconnectSignal(ptr.Pointer(), "characterCount")
 	}
 }
 
@@ -5379,7 +5438,7 @@ func (ptr *QAccessibleTextInterface) CharacterCount() int {
 
 //export callbackQAccessibleTextInterface_CursorPosition
 func callbackQAccessibleTextInterface_CursorPosition(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cursorPosition"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cursorPosition"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -5389,14 +5448,14 @@ func callbackQAccessibleTextInterface_CursorPosition(ptr unsafe.Pointer) C.int {
 func (ptr *QAccessibleTextInterface) ConnectCursorPosition(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cursorPosition", f)
+		qt.ConnectSignal(ptr.Pointer(), "cursorPosition", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectCursorPosition() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cursorPosition")
+		qt.DisconnectSignal(ptr.Pointer(), "cursorPosition")
 	}
 }
 
@@ -5409,7 +5468,7 @@ func (ptr *QAccessibleTextInterface) CursorPosition() int {
 
 //export callbackQAccessibleTextInterface_OffsetAtPoint
 func callbackQAccessibleTextInterface_OffsetAtPoint(ptr unsafe.Pointer, point unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "offsetAtPoint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "offsetAtPoint"); signal != nil {
 		return C.int(int32(signal.(func(*core.QPoint) int)(core.NewQPointFromPointer(point))))
 	}
 
@@ -5419,14 +5478,14 @@ func callbackQAccessibleTextInterface_OffsetAtPoint(ptr unsafe.Pointer, point un
 func (ptr *QAccessibleTextInterface) ConnectOffsetAtPoint(f func(point *core.QPoint) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "offsetAtPoint", f)
+		qt.ConnectSignal(ptr.Pointer(), "offsetAtPoint", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectOffsetAtPoint() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "offsetAtPoint")
+		qt.DisconnectSignal(ptr.Pointer(), "offsetAtPoint")
 	}
 }
 
@@ -5439,7 +5498,7 @@ func (ptr *QAccessibleTextInterface) OffsetAtPoint(point core.QPoint_ITF) int {
 
 //export callbackQAccessibleTextInterface_SelectionCount
 func callbackQAccessibleTextInterface_SelectionCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -5449,14 +5508,14 @@ func callbackQAccessibleTextInterface_SelectionCount(ptr unsafe.Pointer) C.int {
 func (ptr *QAccessibleTextInterface) ConnectSelectionCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectionCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectionCount", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectSelectionCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectionCount")
+		qt.DisconnectSignal(ptr.Pointer(), "selectionCount")
 	}
 }
 
@@ -5469,7 +5528,7 @@ func (ptr *QAccessibleTextInterface) SelectionCount() int {
 
 //export callbackQAccessibleTextInterface_Selection
 func callbackQAccessibleTextInterface_Selection(ptr unsafe.Pointer, selectionIndex C.int, startOffset C.int, endOffset C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selection"); signal != nil {
 		signal.(func(int, int, int))(int(int32(selectionIndex)), int(int32(startOffset)), int(int32(endOffset)))
 	}
 
@@ -5478,14 +5537,14 @@ func callbackQAccessibleTextInterface_Selection(ptr unsafe.Pointer, selectionInd
 func (ptr *QAccessibleTextInterface) ConnectSelection(f func(selectionIndex int, startOffset int, endOffset int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selection", f)
+		qt.ConnectSignal(ptr.Pointer(), "selection", f)
 	}
 }
 
 func (ptr *QAccessibleTextInterface) DisconnectSelection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selection")
+		qt.DisconnectSignal(ptr.Pointer(), "selection")
 	}
 }
 
@@ -5537,7 +5596,7 @@ func NewQAccessibleTextRemoveEventFromPointer(ptr unsafe.Pointer) *QAccessibleTe
 func (ptr *QAccessibleTextRemoveEvent) DestroyQAccessibleTextRemoveEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5638,7 +5697,7 @@ func NewQAccessibleTextSelectionEventFromPointer(ptr unsafe.Pointer) *QAccessibl
 func (ptr *QAccessibleTextSelectionEvent) DestroyQAccessibleTextSelectionEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5739,7 +5798,7 @@ func NewQAccessibleTextUpdateEventFromPointer(ptr unsafe.Pointer) *QAccessibleTe
 func (ptr *QAccessibleTextUpdateEvent) DestroyQAccessibleTextUpdateEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5866,7 +5925,7 @@ func NewQAccessibleValueChangeEventFromPointer(ptr unsafe.Pointer) *QAccessibleV
 func (ptr *QAccessibleValueChangeEvent) DestroyQAccessibleValueChangeEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5949,7 +6008,7 @@ func NewQAccessibleValueInterfaceFromPointer(ptr unsafe.Pointer) *QAccessibleVal
 
 //export callbackQAccessibleValueInterface_SetCurrentValue
 func callbackQAccessibleValueInterface_SetCurrentValue(ptr unsafe.Pointer, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCurrentValue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCurrentValue"); signal != nil {
 		signal.(func(*core.QVariant))(core.NewQVariantFromPointer(value))
 	}
 
@@ -5958,14 +6017,14 @@ func callbackQAccessibleValueInterface_SetCurrentValue(ptr unsafe.Pointer, value
 func (ptr *QAccessibleValueInterface) ConnectSetCurrentValue(f func(value *core.QVariant)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentValue", f)
+		qt.ConnectSignal(ptr.Pointer(), "setCurrentValue", f)
 	}
 }
 
 func (ptr *QAccessibleValueInterface) DisconnectSetCurrentValue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentValue")
+		qt.DisconnectSignal(ptr.Pointer(), "setCurrentValue")
 	}
 }
 
@@ -5977,7 +6036,7 @@ func (ptr *QAccessibleValueInterface) SetCurrentValue(value core.QVariant_ITF) {
 
 //export callbackQAccessibleValueInterface_DestroyQAccessibleValueInterface
 func callbackQAccessibleValueInterface_DestroyQAccessibleValueInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccessibleValueInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccessibleValueInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccessibleValueInterfaceFromPointer(ptr).DestroyQAccessibleValueInterfaceDefault()
@@ -5987,21 +6046,21 @@ func callbackQAccessibleValueInterface_DestroyQAccessibleValueInterface(ptr unsa
 func (ptr *QAccessibleValueInterface) ConnectDestroyQAccessibleValueInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleValueInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccessibleValueInterface", f)
 	}
 }
 
 func (ptr *QAccessibleValueInterface) DisconnectDestroyQAccessibleValueInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccessibleValueInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccessibleValueInterface")
 	}
 }
 
 func (ptr *QAccessibleValueInterface) DestroyQAccessibleValueInterface() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleValueInterface_DestroyQAccessibleValueInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6009,14 +6068,14 @@ func (ptr *QAccessibleValueInterface) DestroyQAccessibleValueInterface() {
 func (ptr *QAccessibleValueInterface) DestroyQAccessibleValueInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccessibleValueInterface_DestroyQAccessibleValueInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAccessibleValueInterface_CurrentValue
 func callbackQAccessibleValueInterface_CurrentValue(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentValue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentValue"); signal != nil {
 		return core.PointerFromQVariant(signal.(func() *core.QVariant)())
 	}
 
@@ -6026,14 +6085,14 @@ func callbackQAccessibleValueInterface_CurrentValue(ptr unsafe.Pointer) unsafe.P
 func (ptr *QAccessibleValueInterface) ConnectCurrentValue(f func() *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentValue", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentValue", f)
 	}
 }
 
 func (ptr *QAccessibleValueInterface) DisconnectCurrentValue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentValue")
+		qt.DisconnectSignal(ptr.Pointer(), "currentValue")
 	}
 }
 
@@ -6048,7 +6107,7 @@ func (ptr *QAccessibleValueInterface) CurrentValue() *core.QVariant {
 
 //export callbackQAccessibleValueInterface_MaximumValue
 func callbackQAccessibleValueInterface_MaximumValue(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maximumValue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maximumValue"); signal != nil {
 		return core.PointerFromQVariant(signal.(func() *core.QVariant)())
 	}
 
@@ -6058,14 +6117,14 @@ func callbackQAccessibleValueInterface_MaximumValue(ptr unsafe.Pointer) unsafe.P
 func (ptr *QAccessibleValueInterface) ConnectMaximumValue(f func() *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maximumValue", f)
+		qt.ConnectSignal(ptr.Pointer(), "maximumValue", f)
 	}
 }
 
 func (ptr *QAccessibleValueInterface) DisconnectMaximumValue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maximumValue")
+		qt.DisconnectSignal(ptr.Pointer(), "maximumValue")
 	}
 }
 
@@ -6080,7 +6139,7 @@ func (ptr *QAccessibleValueInterface) MaximumValue() *core.QVariant {
 
 //export callbackQAccessibleValueInterface_MinimumStepSize
 func callbackQAccessibleValueInterface_MinimumStepSize(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumStepSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumStepSize"); signal != nil {
 		return core.PointerFromQVariant(signal.(func() *core.QVariant)())
 	}
 
@@ -6090,14 +6149,14 @@ func callbackQAccessibleValueInterface_MinimumStepSize(ptr unsafe.Pointer) unsaf
 func (ptr *QAccessibleValueInterface) ConnectMinimumStepSize(f func() *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minimumStepSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "minimumStepSize", f)
 	}
 }
 
 func (ptr *QAccessibleValueInterface) DisconnectMinimumStepSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minimumStepSize")
+		qt.DisconnectSignal(ptr.Pointer(), "minimumStepSize")
 	}
 }
 
@@ -6112,7 +6171,7 @@ func (ptr *QAccessibleValueInterface) MinimumStepSize() *core.QVariant {
 
 //export callbackQAccessibleValueInterface_MinimumValue
 func callbackQAccessibleValueInterface_MinimumValue(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumValue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumValue"); signal != nil {
 		return core.PointerFromQVariant(signal.(func() *core.QVariant)())
 	}
 
@@ -6122,14 +6181,14 @@ func callbackQAccessibleValueInterface_MinimumValue(ptr unsafe.Pointer) unsafe.P
 func (ptr *QAccessibleValueInterface) ConnectMinimumValue(f func() *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minimumValue", f)
+		qt.ConnectSignal(ptr.Pointer(), "minimumValue", f)
 	}
 }
 
 func (ptr *QAccessibleValueInterface) DisconnectMinimumValue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minimumValue")
+		qt.DisconnectSignal(ptr.Pointer(), "minimumValue")
 	}
 }
 
@@ -6184,7 +6243,7 @@ func NewQActionEventFromPointer(ptr unsafe.Pointer) *QActionEvent {
 func (ptr *QActionEvent) DestroyQActionEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6322,7 +6381,7 @@ func (ptr *QBackingStore) Size() *core.QSize {
 func (ptr *QBackingStore) Window() *QWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQWindowFromPointer(C.QBackingStore_Window(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6446,7 +6505,7 @@ func (ptr *QBitmap) Swap(other QBitmap_ITF) {
 func (ptr *QBitmap) DestroyQBitmap() {
 	if ptr.Pointer() != nil {
 		C.QBitmap_DestroyQBitmap(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6703,7 +6762,7 @@ func NewQClipboardFromPointer(ptr unsafe.Pointer) *QClipboard {
 func (ptr *QClipboard) DestroyQClipboard() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6721,7 +6780,7 @@ const (
 
 //export callbackQClipboard_Changed
 func callbackQClipboard_Changed(ptr unsafe.Pointer, mode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changed"); signal != nil {
 		signal.(func(QClipboard__Mode))(QClipboard__Mode(mode))
 	}
 
@@ -6730,14 +6789,14 @@ func callbackQClipboard_Changed(ptr unsafe.Pointer, mode C.longlong) {
 func (ptr *QClipboard) ConnectChanged(f func(mode QClipboard__Mode)) {
 	if ptr.Pointer() != nil {
 		C.QClipboard_ConnectChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "changed", f)
+		qt.ConnectSignal(ptr.Pointer(), "changed", f)
 	}
 }
 
 func (ptr *QClipboard) DisconnectChanged() {
 	if ptr.Pointer() != nil {
 		C.QClipboard_DisconnectChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "changed")
+		qt.DisconnectSignal(ptr.Pointer(), "changed")
 	}
 }
 
@@ -6755,7 +6814,7 @@ func (ptr *QClipboard) Clear(mode QClipboard__Mode) {
 
 //export callbackQClipboard_DataChanged
 func callbackQClipboard_DataChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6764,14 +6823,14 @@ func callbackQClipboard_DataChanged(ptr unsafe.Pointer) {
 func (ptr *QClipboard) ConnectDataChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QClipboard_ConnectDataChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dataChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "dataChanged", f)
 	}
 }
 
 func (ptr *QClipboard) DisconnectDataChanged() {
 	if ptr.Pointer() != nil {
 		C.QClipboard_DisconnectDataChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dataChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "dataChanged")
 	}
 }
 
@@ -6783,7 +6842,7 @@ func (ptr *QClipboard) DataChanged() {
 
 //export callbackQClipboard_FindBufferChanged
 func callbackQClipboard_FindBufferChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "findBufferChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "findBufferChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6792,14 +6851,14 @@ func callbackQClipboard_FindBufferChanged(ptr unsafe.Pointer) {
 func (ptr *QClipboard) ConnectFindBufferChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QClipboard_ConnectFindBufferChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "findBufferChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "findBufferChanged", f)
 	}
 }
 
 func (ptr *QClipboard) DisconnectFindBufferChanged() {
 	if ptr.Pointer() != nil {
 		C.QClipboard_DisconnectFindBufferChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "findBufferChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "findBufferChanged")
 	}
 }
 
@@ -6811,7 +6870,7 @@ func (ptr *QClipboard) FindBufferChanged() {
 
 //export callbackQClipboard_SelectionChanged
 func callbackQClipboard_SelectionChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6820,14 +6879,14 @@ func callbackQClipboard_SelectionChanged(ptr unsafe.Pointer) {
 func (ptr *QClipboard) ConnectSelectionChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QClipboard_ConnectSelectionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectionChanged", f)
 	}
 }
 
 func (ptr *QClipboard) DisconnectSelectionChanged() {
 	if ptr.Pointer() != nil {
 		C.QClipboard_DisconnectSelectionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "selectionChanged")
 	}
 }
 
@@ -6935,7 +6994,7 @@ func (ptr *QClipboard) SupportsSelection() bool {
 func (ptr *QClipboard) MimeData(mode QClipboard__Mode) *core.QMimeData {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQMimeDataFromPointer(C.QClipboard_MimeData(ptr.Pointer(), C.longlong(mode)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6965,7 +7024,7 @@ func (ptr *QClipboard) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QClipboard) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QClipboard___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6986,7 +7045,7 @@ func (ptr *QClipboard) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QClipboard) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QClipboard___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7007,7 +7066,7 @@ func (ptr *QClipboard) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QClipboard) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QClipboard___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7028,7 +7087,7 @@ func (ptr *QClipboard) __findChildren_newList() unsafe.Pointer {
 func (ptr *QClipboard) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QClipboard___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7048,7 +7107,7 @@ func (ptr *QClipboard) __children_newList() unsafe.Pointer {
 
 //export callbackQClipboard_Event
 func callbackQClipboard_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -7064,7 +7123,7 @@ func (ptr *QClipboard) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQClipboard_EventFilter
 func callbackQClipboard_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -7080,7 +7139,7 @@ func (ptr *QClipboard) EventFilterDefault(watched core.QObject_ITF, event core.Q
 
 //export callbackQClipboard_ChildEvent
 func callbackQClipboard_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQClipboardFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -7095,7 +7154,7 @@ func (ptr *QClipboard) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQClipboard_ConnectNotify
 func callbackQClipboard_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQClipboardFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7110,7 +7169,7 @@ func (ptr *QClipboard) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQClipboard_CustomEvent
 func callbackQClipboard_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQClipboardFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -7125,7 +7184,7 @@ func (ptr *QClipboard) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQClipboard_DeleteLater
 func callbackQClipboard_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQClipboardFromPointer(ptr).DeleteLaterDefault()
@@ -7135,14 +7194,14 @@ func callbackQClipboard_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QClipboard) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QClipboard_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQClipboard_Destroyed
 func callbackQClipboard_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -7150,7 +7209,7 @@ func callbackQClipboard_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQClipboard_DisconnectNotify
 func callbackQClipboard_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQClipboardFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7165,7 +7224,7 @@ func (ptr *QClipboard) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQClipboard_ObjectNameChanged
 func callbackQClipboard_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -7173,7 +7232,7 @@ func callbackQClipboard_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struc
 
 //export callbackQClipboard_TimerEvent
 func callbackQClipboard_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQClipboardFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -7188,7 +7247,7 @@ func (ptr *QClipboard) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQClipboard_MetaObject
 func callbackQClipboard_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -7244,7 +7303,7 @@ func NewQCloseEventFromPointer(ptr unsafe.Pointer) *QCloseEvent {
 func (ptr *QCloseEvent) DestroyQCloseEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7513,11 +7572,11 @@ func NewQColor3(r int, g int, b int, a int) *QColor {
 }
 
 func QColor_ColorNames() []string {
-	return strings.Split(cGoUnpackString(C.QColor_QColor_ColorNames()), "|")
+	return cGoUnpackStringListAndFree(C.QColor_QColor_ColorNames())
 }
 
 func (ptr *QColor) ColorNames() []string {
-	return strings.Split(cGoUnpackString(C.QColor_QColor_ColorNames()), "|")
+	return cGoUnpackStringListAndFree(C.QColor_QColor_ColorNames())
 }
 
 func QColor_IsValidColor2(name core.QLatin1String_ITF) bool {
@@ -8153,7 +8212,7 @@ func NewQContextMenuEventFromPointer(ptr unsafe.Pointer) *QContextMenuEvent {
 func (ptr *QContextMenuEvent) DestroyQContextMenuEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8622,7 +8681,7 @@ const (
 
 func NewQDoubleValidator(parent core.QObject_ITF) *QDoubleValidator {
 	var tmpValue = NewQDoubleValidatorFromPointer(C.QDoubleValidator_NewQDoubleValidator(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -8630,7 +8689,7 @@ func NewQDoubleValidator(parent core.QObject_ITF) *QDoubleValidator {
 
 func NewQDoubleValidator2(bottom float64, top float64, decimals int, parent core.QObject_ITF) *QDoubleValidator {
 	var tmpValue = NewQDoubleValidatorFromPointer(C.QDoubleValidator_NewQDoubleValidator2(C.double(bottom), C.double(top), C.int(int32(decimals)), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -8656,7 +8715,7 @@ func (ptr *QDoubleValidator) SetNotation(vno QDoubleValidator__Notation) {
 
 //export callbackQDoubleValidator_SetRange
 func callbackQDoubleValidator_SetRange(ptr unsafe.Pointer, minimum C.double, maximum C.double, decimals C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRange"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRange"); signal != nil {
 		signal.(func(float64, float64, int))(float64(minimum), float64(maximum), int(int32(decimals)))
 	} else {
 		NewQDoubleValidatorFromPointer(ptr).SetRangeDefault(float64(minimum), float64(maximum), int(int32(decimals)))
@@ -8666,14 +8725,14 @@ func callbackQDoubleValidator_SetRange(ptr unsafe.Pointer, minimum C.double, max
 func (ptr *QDoubleValidator) ConnectSetRange(f func(minimum float64, maximum float64, decimals int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setRange", f)
+		qt.ConnectSignal(ptr.Pointer(), "setRange", f)
 	}
 }
 
 func (ptr *QDoubleValidator) DisconnectSetRange() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setRange")
+		qt.DisconnectSignal(ptr.Pointer(), "setRange")
 	}
 }
 
@@ -8698,7 +8757,7 @@ func (ptr *QDoubleValidator) SetTop(vdo float64) {
 func (ptr *QDoubleValidator) DestroyQDoubleValidator() {
 	if ptr.Pointer() != nil {
 		C.QDoubleValidator_DestroyQDoubleValidator(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8712,7 +8771,7 @@ func (ptr *QDoubleValidator) Notation() QDoubleValidator__Notation {
 
 //export callbackQDoubleValidator_Validate
 func callbackQDoubleValidator_Validate(ptr unsafe.Pointer, input C.struct_QtGui_PackedString, pos C.int) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "validate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "validate"); signal != nil {
 		return C.longlong(signal.(func(string, int) QValidator__State)(cGoUnpackString(input), int(int32(pos))))
 	}
 
@@ -8722,14 +8781,14 @@ func callbackQDoubleValidator_Validate(ptr unsafe.Pointer, input C.struct_QtGui_
 func (ptr *QDoubleValidator) ConnectValidate(f func(input string, pos int) QValidator__State) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "validate", f)
+		qt.ConnectSignal(ptr.Pointer(), "validate", f)
 	}
 }
 
 func (ptr *QDoubleValidator) DisconnectValidate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "validate")
+		qt.DisconnectSignal(ptr.Pointer(), "validate")
 	}
 }
 
@@ -8812,7 +8871,7 @@ func NewQDragFromPointer(ptr unsafe.Pointer) *QDrag {
 }
 func NewQDrag(dragSource core.QObject_ITF) *QDrag {
 	var tmpValue = NewQDragFromPointer(C.QDrag_NewQDrag(core.PointerFromQObject(dragSource)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -8834,7 +8893,7 @@ func (ptr *QDrag) Exec2(supportedActions core.Qt__DropAction, defaultDropAction
 
 //export callbackQDrag_ActionChanged
 func callbackQDrag_ActionChanged(ptr unsafe.Pointer, action C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionChanged"); signal != nil {
 		signal.(func(core.Qt__DropAction))(core.Qt__DropAction(action))
 	}
 
@@ -8843,14 +8902,14 @@ func callbackQDrag_ActionChanged(ptr unsafe.Pointer, action C.longlong) {
 func (ptr *QDrag) ConnectActionChanged(f func(action core.Qt__DropAction)) {
 	if ptr.Pointer() != nil {
 		C.QDrag_ConnectActionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "actionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "actionChanged", f)
 	}
 }
 
 func (ptr *QDrag) DisconnectActionChanged() {
 	if ptr.Pointer() != nil {
 		C.QDrag_DisconnectActionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "actionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "actionChanged")
 	}
 }
 
@@ -8894,7 +8953,7 @@ func (ptr *QDrag) SetPixmap(pixmap QPixmap_ITF) {
 
 //export callbackQDrag_TargetChanged
 func callbackQDrag_TargetChanged(ptr unsafe.Pointer, newTarget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "targetChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "targetChanged"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(newTarget))
 	}
 
@@ -8903,14 +8962,14 @@ func callbackQDrag_TargetChanged(ptr unsafe.Pointer, newTarget unsafe.Pointer) {
 func (ptr *QDrag) ConnectTargetChanged(f func(newTarget *core.QObject)) {
 	if ptr.Pointer() != nil {
 		C.QDrag_ConnectTargetChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "targetChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "targetChanged", f)
 	}
 }
 
 func (ptr *QDrag) DisconnectTargetChanged() {
 	if ptr.Pointer() != nil {
 		C.QDrag_DisconnectTargetChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "targetChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "targetChanged")
 	}
 }
 
@@ -8923,7 +8982,7 @@ func (ptr *QDrag) TargetChanged(newTarget core.QObject_ITF) {
 func (ptr *QDrag) DestroyQDrag() {
 	if ptr.Pointer() != nil {
 		C.QDrag_DestroyQDrag(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8931,7 +8990,7 @@ func (ptr *QDrag) DestroyQDrag() {
 func (ptr *QDrag) MimeData() *core.QMimeData {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQMimeDataFromPointer(C.QDrag_MimeData(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8942,7 +9001,7 @@ func (ptr *QDrag) MimeData() *core.QMimeData {
 func (ptr *QDrag) Source() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDrag_Source(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8953,7 +9012,7 @@ func (ptr *QDrag) Source() *core.QObject {
 func (ptr *QDrag) Target() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDrag_Target(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9024,7 +9083,7 @@ func (ptr *QDrag) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QDrag) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDrag___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9045,7 +9104,7 @@ func (ptr *QDrag) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QDrag) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDrag___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9066,7 +9125,7 @@ func (ptr *QDrag) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QDrag) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDrag___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9087,7 +9146,7 @@ func (ptr *QDrag) __findChildren_newList() unsafe.Pointer {
 func (ptr *QDrag) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDrag___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9107,7 +9166,7 @@ func (ptr *QDrag) __children_newList() unsafe.Pointer {
 
 //export callbackQDrag_Event
 func callbackQDrag_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -9123,7 +9182,7 @@ func (ptr *QDrag) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQDrag_EventFilter
 func callbackQDrag_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -9139,7 +9198,7 @@ func (ptr *QDrag) EventFilterDefault(watched core.QObject_ITF, event core.QEvent
 
 //export callbackQDrag_ChildEvent
 func callbackQDrag_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQDragFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -9154,7 +9213,7 @@ func (ptr *QDrag) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQDrag_ConnectNotify
 func callbackQDrag_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDragFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9169,7 +9228,7 @@ func (ptr *QDrag) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQDrag_CustomEvent
 func callbackQDrag_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDragFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -9184,7 +9243,7 @@ func (ptr *QDrag) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQDrag_DeleteLater
 func callbackQDrag_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDragFromPointer(ptr).DeleteLaterDefault()
@@ -9194,14 +9253,14 @@ func callbackQDrag_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QDrag) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QDrag_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDrag_Destroyed
 func callbackQDrag_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -9209,7 +9268,7 @@ func callbackQDrag_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQDrag_DisconnectNotify
 func callbackQDrag_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDragFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9224,7 +9283,7 @@ func (ptr *QDrag) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQDrag_ObjectNameChanged
 func callbackQDrag_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -9232,7 +9291,7 @@ func callbackQDrag_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtG
 
 //export callbackQDrag_TimerEvent
 func callbackQDrag_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQDragFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -9247,7 +9306,7 @@ func (ptr *QDrag) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQDrag_MetaObject
 func callbackQDrag_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -9303,7 +9362,7 @@ func NewQDragEnterEventFromPointer(ptr unsafe.Pointer) *QDragEnterEvent {
 func (ptr *QDragEnterEvent) DestroyQDragEnterEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9354,7 +9413,7 @@ func NewQDragLeaveEventFromPointer(ptr unsafe.Pointer) *QDragLeaveEvent {
 func (ptr *QDragLeaveEvent) DestroyQDragLeaveEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9420,7 +9479,7 @@ func (ptr *QDragMoveEvent) Ignore(rectangle core.QRect_ITF) {
 func (ptr *QDragMoveEvent) DestroyQDragMoveEvent() {
 	if ptr.Pointer() != nil {
 		C.QDragMoveEvent_DestroyQDragMoveEvent(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9491,7 +9550,7 @@ func NewQDropEventFromPointer(ptr unsafe.Pointer) *QDropEvent {
 func (ptr *QDropEvent) DestroyQDropEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9515,7 +9574,7 @@ func (ptr *QDropEvent) SetDropAction(action core.Qt__DropAction) {
 func (ptr *QDropEvent) Source() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDropEvent_Source(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9570,7 +9629,7 @@ func (ptr *QDropEvent) MouseButtons() core.Qt__MouseButton {
 func (ptr *QDropEvent) MimeData() *core.QMimeData {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQMimeDataFromPointer(C.QDropEvent_MimeData(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9627,7 +9686,7 @@ func (ptr *QDropEvent) SetDrop_action(vqt core.Qt__DropAction) {
 func (ptr *QDropEvent) Mdata() *core.QMimeData {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQMimeDataFromPointer(C.QDropEvent_Mdata(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9718,7 +9777,7 @@ func NewQEnterEventFromPointer(ptr unsafe.Pointer) *QEnterEvent {
 func (ptr *QEnterEvent) DestroyQEnterEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9836,7 +9895,7 @@ func NewQExposeEventFromPointer(ptr unsafe.Pointer) *QExposeEvent {
 func (ptr *QExposeEvent) DestroyQExposeEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9909,7 +9968,7 @@ func NewQFileOpenEventFromPointer(ptr unsafe.Pointer) *QFileOpenEvent {
 func (ptr *QFileOpenEvent) DestroyQFileOpenEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9979,7 +10038,7 @@ func NewQFocusEventFromPointer(ptr unsafe.Pointer) *QFocusEvent {
 func (ptr *QFocusEvent) DestroyQFocusEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10203,21 +10262,21 @@ func (ptr *QFont) Substitute(familyName string) string {
 func QFont_Substitutes(familyName string) []string {
 	var familyNameC = C.CString(familyName)
 	defer C.free(unsafe.Pointer(familyNameC))
-	return strings.Split(cGoUnpackString(C.QFont_QFont_Substitutes(familyNameC)), "|")
+	return cGoUnpackStringListAndFree(C.QFont_QFont_Substitutes(familyNameC))
 }
 
 func (ptr *QFont) Substitutes(familyName string) []string {
 	var familyNameC = C.CString(familyName)
 	defer C.free(unsafe.Pointer(familyNameC))
-	return strings.Split(cGoUnpackString(C.QFont_QFont_Substitutes(familyNameC)), "|")
+	return cGoUnpackStringListAndFree(C.QFont_QFont_Substitutes(familyNameC))
 }
 
 func QFont_Substitutions() []string {
-	return strings.Split(cGoUnpackString(C.QFont_QFont_Substitutions()), "|")
+	return cGoUnpackStringListAndFree(C.QFont_QFont_Substitutions())
 }
 
 func (ptr *QFont) Substitutions() []string {
-	return strings.Split(cGoUnpackString(C.QFont_QFont_Substitutions()), "|")
+	return cGoUnpackStringListAndFree(C.QFont_QFont_Substitutions())
 }
 
 func (ptr *QFont) FromString(descrip string) bool {
@@ -10248,7 +10307,7 @@ func (ptr *QFont) InsertSubstitution(familyName string, substituteName string) {
 func QFont_InsertSubstitutions(familyName string, substituteNames []string) {
 	var familyNameC = C.CString(familyName)
 	defer C.free(unsafe.Pointer(familyNameC))
-	var substituteNamesC = C.CString(strings.Join(substituteNames, "|"))
+	var substituteNamesC = cGoPackStringList(substituteNames)
 	defer C.free(unsafe.Pointer(substituteNamesC))
 	C.QFont_QFont_InsertSubstitutions(familyNameC, substituteNamesC)
 }
@@ -10256,7 +10315,7 @@ func QFont_InsertSubstitutions(familyName string, substituteNames []string) {
 func (ptr *QFont) InsertSubstitutions(familyName string, substituteNames []string) {
 	var familyNameC = C.CString(familyName)
 	defer C.free(unsafe.Pointer(familyNameC))
-	var substituteNamesC = C.CString(strings.Join(substituteNames, "|"))
+	var substituteNamesC = cGoPackStringList(substituteNames)
 	defer C.free(unsafe.Pointer(substituteNamesC))
 	C.QFont_QFont_InsertSubstitutions(familyNameC, substituteNamesC)
 }
@@ -10744,8 +10803,10 @@ func (ptr *QFontDatabase) PointSizes(family string, styleName string) []int {
 		defer C.free(unsafe.Pointer(styleNameC))
 		return func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQFontDatabaseFromPointer(l.data).__pointSizes_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQFontDatabaseFromPointer(l.data).__pointSizes_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QFontDatabase_PointSizes(ptr.Pointer(), familyC, styleNameC))
@@ -10761,8 +10822,10 @@ func (ptr *QFontDatabase) SmoothSizes(family string, styleName string) []int {
 		defer C.free(unsafe.Pointer(styleNameC))
 		return func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQFontDatabaseFromPointer(l.data).__smoothSizes_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQFontDatabaseFromPointer(l.data).__smoothSizes_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QFontDatabase_SmoothSizes(ptr.Pointer(), familyC, styleNameC))
@@ -10807,8 +10870,10 @@ func NewQFontDatabase() *QFontDatabase {
 func QFontDatabase_StandardSizes() []int {
 	return func(l C.struct_QtGui_PackedList) []int {
 		var out = make([]int, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQFontDatabaseFromPointer(l.data).__standardSizes_atList(i)
+		var tmpList = make([]C.int, int(l.len)+1)
+		NewQFontDatabaseFromPointer(l.data).__standardSizes_fillList(unsafe.Pointer(&tmpList[0]))
+		for i, v := range tmpList[:len(out)] {
+			out[i] = int(int32(v))
 		}
 		return out
 	}(C.QFontDatabase_QFontDatabase_StandardSizes())
@@ -10817,8 +10882,10 @@ func QFontDatabase_StandardSizes() []int {
 func (ptr *QFontDatabase) StandardSizes() []int {
 	return func(l C.struct_QtGui_PackedList) []int {
 		var out = make([]int, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQFontDatabaseFromPointer(l.data).__standardSizes_atList(i)
+		var tmpList = make([]C.int, int(l.len)+1)
+		NewQFontDatabaseFromPointer(l.data).__standardSizes_fillList(unsafe.Pointer(&tmpList[0]))
+		for i, v := range tmpList[:len(out)] {
+			out[i] = int(int32(v))
 		}
 		return out
 	}(C.QFontDatabase_QFontDatabase_StandardSizes())
@@ -10839,11 +10906,11 @@ func (ptr *QFontDatabase) StyleString2(fontInfo QFontInfo_ITF) string {
 }
 
 func QFontDatabase_ApplicationFontFamilies(id int) []string {
-	return strings.Split(cGoUnpackString(C.QFontDatabase_QFontDatabase_ApplicationFontFamilies(C.int(int32(id)))), "|")
+	return cGoUnpackStringListAndFree(C.QFontDatabase_QFontDatabase_ApplicationFontFamilies(C.int(int32(id))))
 }
 
 func (ptr *QFontDatabase) ApplicationFontFamilies(id int) []string {
-	return strings.Split(cGoUnpackString(C.QFontDatabase_QFontDatabase_ApplicationFontFamilies(C.int(int32(id)))), "|")
+	return cGoUnpackStringListAndFree(C.QFontDatabase_QFontDatabase_ApplicationFontFamilies(C.int(int32(id))))
 }
 
 func QFontDatabase_AddApplicationFont(fileName string) int {
@@ -10881,7 +10948,7 @@ func (ptr *QFontDatabase) Font(family string, style string, pointSize int) *QFon
 
 func (ptr *QFontDatabase) Families(writingSystem QFontDatabase__WritingSystem) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QFontDatabase_Families(ptr.Pointer(), C.longlong(writingSystem))), "|")
+		return cGoUnpackStringListAndFree(C.QFontDatabase_Families(ptr.Pointer(), C.longlong(writingSystem)))
 	}
 	return make([]string, 0)
 }
@@ -10890,7 +10957,7 @@ func (ptr *QFontDatabase) Styles(family string) []string {
 	if ptr.Pointer() != nil {
 		var familyC = C.CString(family)
 		defer C.free(unsafe.Pointer(familyC))
-		return strings.Split(cGoUnpackString(C.QFontDatabase_Styles(ptr.Pointer(), familyC)), "|")
+		return cGoUnpackStringListAndFree(C.QFontDatabase_Styles(ptr.Pointer(), familyC))
 	}
 	return make([]string, 0)
 }
@@ -10998,6 +11065,16 @@ func (ptr *QFontDatabase) __pointSizes_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QFontDatabase___pointSizes_newList(ptr.Pointer()))
 }
 
+func (ptr *QFontDatabase) __pointSizes_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QFontDatabase___pointSizes_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QFontDatabase) __pointSizes_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QFontDatabase___pointSizes_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QFontDatabase) __smoothSizes_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QFontDatabase___smoothSizes_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -11015,6 +11092,16 @@ func (ptr *QFontDatabase) __smoothSizes_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QFontDatabase___smoothSizes_newList(ptr.Pointer()))
 }
 
+func (ptr *QFontDatabase) __smoothSizes_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QFontDatabase___smoothSizes_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QFontDatabase) __smoothSizes_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QFontDatabase___smoothSizes_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QFontDatabase) __standardSizes_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QFontDatabase___standardSizes_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -11032,6 +11119,16 @@ func (ptr *QFontDatabase) __standardSizes_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QFontDatabase___standardSizes_newList(ptr.Pointer()))
 }
 
+func (ptr *QFontDatabase) __standardSizes_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QFontDatabase___standardSizes_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QFontDatabase) __standardSizes_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QFontDatabase___standardSizes_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QFontInfo struct {
 	ptr unsafe.Pointer
 }
@@ -11838,7 +11935,7 @@ func NewQGenericPluginFromPointer(ptr unsafe.Pointer) *QGenericPlugin {
 }
 func NewQGenericPlugin(parent core.QObject_ITF) *QGenericPlugin {
 	var tmpValue = NewQGenericPluginFromPointer(C.QGenericPlugin_NewQGenericPlugin(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -11846,7 +11943,7 @@ func NewQGenericPlugin(parent core.QObject_ITF) *QGenericPlugin {
 
 //export callbackQGenericPlugin_Create
 func callbackQGenericPlugin_Create(ptr unsafe.Pointer, key C.struct_QtGui_PackedString, specification C.struct_QtGui_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "create"); signal != nil {
+	if signal := qt.GetSignal(ptr, "create"); signal != nil {
 		return core.PointerFromQObject(signal.(func(string, string) *core.QObject)(cGoUnpackString(key), cGoUnpackString(specification)))
 	}
 
@@ -11856,14 +11953,14 @@ func callbackQGenericPlugin_Create(ptr unsafe.Pointer, key C.struct_QtGui_Packed
 func (ptr *QGenericPlugin) ConnectCreate(f func(key string, specification string) *core.QObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "create", f)
+		qt.ConnectSignal(ptr.Pointer(), "create", f)
 	}
 }
 
 func (ptr *QGenericPlugin) DisconnectCreate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "create")
+		qt.DisconnectSignal(ptr.Pointer(), "create")
 	}
 }
 
@@ -11874,7 +11971,7 @@ func (ptr *QGenericPlugin) Create(key string, specification string) *core.QObjec
 		var specificationC = C.CString(specification)
 		defer C.free(unsafe.Pointer(specificationC))
 		var tmpValue = core.NewQObjectFromPointer(C.QGenericPlugin_Create(ptr.Pointer(), keyC, specificationC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11885,7 +11982,7 @@ func (ptr *QGenericPlugin) Create(key string, specification string) *core.QObjec
 func (ptr *QGenericPlugin) DestroyQGenericPlugin() {
 	if ptr.Pointer() != nil {
 		C.QGenericPlugin_DestroyQGenericPlugin(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11912,7 +12009,7 @@ func (ptr *QGenericPlugin) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QGenericPlugin) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGenericPlugin___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11933,7 +12030,7 @@ func (ptr *QGenericPlugin) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QGenericPlugin) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGenericPlugin___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11954,7 +12051,7 @@ func (ptr *QGenericPlugin) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QGenericPlugin) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGenericPlugin___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11975,7 +12072,7 @@ func (ptr *QGenericPlugin) __findChildren_newList() unsafe.Pointer {
 func (ptr *QGenericPlugin) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGenericPlugin___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11995,7 +12092,7 @@ func (ptr *QGenericPlugin) __children_newList() unsafe.Pointer {
 
 //export callbackQGenericPlugin_Event
 func callbackQGenericPlugin_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -12011,7 +12108,7 @@ func (ptr *QGenericPlugin) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQGenericPlugin_EventFilter
 func callbackQGenericPlugin_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -12027,7 +12124,7 @@ func (ptr *QGenericPlugin) EventFilterDefault(watched core.QObject_ITF, event co
 
 //export callbackQGenericPlugin_ChildEvent
 func callbackQGenericPlugin_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQGenericPluginFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -12042,7 +12139,7 @@ func (ptr *QGenericPlugin) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQGenericPlugin_ConnectNotify
 func callbackQGenericPlugin_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQGenericPluginFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -12057,7 +12154,7 @@ func (ptr *QGenericPlugin) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQGenericPlugin_CustomEvent
 func callbackQGenericPlugin_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQGenericPluginFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -12072,7 +12169,7 @@ func (ptr *QGenericPlugin) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQGenericPlugin_DeleteLater
 func callbackQGenericPlugin_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQGenericPluginFromPointer(ptr).DeleteLaterDefault()
@@ -12082,14 +12179,14 @@ func callbackQGenericPlugin_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QGenericPlugin) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QGenericPlugin_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQGenericPlugin_Destroyed
 func callbackQGenericPlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -12097,7 +12194,7 @@ func callbackQGenericPlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQGenericPlugin_DisconnectNotify
 func callbackQGenericPlugin_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQGenericPluginFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -12112,7 +12209,7 @@ func (ptr *QGenericPlugin) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQGenericPlugin_ObjectNameChanged
 func callbackQGenericPlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -12120,7 +12217,7 @@ func callbackQGenericPlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName C.s
 
 //export callbackQGenericPlugin_TimerEvent
 func callbackQGenericPlugin_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQGenericPluginFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -12135,7 +12232,7 @@ func (ptr *QGenericPlugin) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQGenericPlugin_MetaObject
 func callbackQGenericPlugin_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -12200,7 +12297,7 @@ func QGenericPluginFactory_Create(key string, specification string) *core.QObjec
 	var specificationC = C.CString(specification)
 	defer C.free(unsafe.Pointer(specificationC))
 	var tmpValue = core.NewQObjectFromPointer(C.QGenericPluginFactory_QGenericPluginFactory_Create(keyC, specificationC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12212,18 +12309,18 @@ func (ptr *QGenericPluginFactory) Create(key string, specification string) *core
 	var specificationC = C.CString(specification)
 	defer C.free(unsafe.Pointer(specificationC))
 	var tmpValue = core.NewQObjectFromPointer(C.QGenericPluginFactory_QGenericPluginFactory_Create(keyC, specificationC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
 }
 
 func QGenericPluginFactory_Keys() []string {
-	return strings.Split(cGoUnpackString(C.QGenericPluginFactory_QGenericPluginFactory_Keys()), "|")
+	return cGoUnpackStringListAndFree(C.QGenericPluginFactory_QGenericPluginFactory_Keys())
 }
 
 func (ptr *QGenericPluginFactory) Keys() []string {
-	return strings.Split(cGoUnpackString(C.QGenericPluginFactory_QGenericPluginFactory_Keys()), "|")
+	return cGoUnpackStringListAndFree(C.QGenericPluginFactory_QGenericPluginFactory_Keys())
 }
 
 type QGlyphRun struct {
@@ -12332,13 +12429,13 @@ func (ptr *QGlyphRun) SetOverline(overline bool) {
 
 func (ptr *QGlyphRun) SetPositions(positions []*core.QPointF) {
 	if ptr.Pointer() != nil {
-		C.QGlyphRun_SetPositions(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQGlyphRunFromPointer(NewQGlyphRunFromPointer(nil).__setPositions_positions_newList())
-			for _, v := range positions {
-				tmpList.__setPositions_positions_setList(v)
+		C.QGlyphRun_SetPositions(ptr.Pointer(), func(l []*core.QPointF) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQPointF(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQGlyphRunFromPointer(nil).__setPositions_positions_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(positions))
 	}
 }
 
@@ -12414,8 +12511,11 @@ func (ptr *QGlyphRun) Positions() []*core.QPointF {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []*core.QPointF {
 			var out = make([]*core.QPointF, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQGlyphRunFromPointer(l.data).__positions_atList(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQGlyphRunFromPointer(l.data).__positions_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = core.NewQPointFFromPointer(v)
+				runtime.SetFinalizer(out[i], (*core.QPointF).DestroyQPointF)
 			}
 			return out
 		}(C.QGlyphRun_Positions(ptr.Pointer()))
@@ -12507,6 +12607,16 @@ func (ptr *QGlyphRun) __setPositions_positions_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QGlyphRun___setPositions_positions_newList(ptr.Pointer()))
 }
 
+func (ptr *QGlyphRun) __setPositions_positions_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QGlyphRun___setPositions_positions_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QGlyphRun) __setPositions_positions_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QGlyphRun___setPositions_positions_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QGlyphRun) __positions_atList(i int) *core.QPointF {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPointFFromPointer(C.QGlyphRun___positions_atList(ptr.Pointer(), C.int(int32(i))))
@@ -12526,6 +12636,16 @@ func (ptr *QGlyphRun) __positions_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QGlyphRun___positions_newList(ptr.Pointer()))
 }
 
+func (ptr *QGlyphRun) __positions_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QGlyphRun___positions_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QGlyphRun) __positions_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QGlyphRun___positions_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QGlyphRun) __glyphIndexes_atList(i int) uint {
 	if ptr.Pointer() != nil {
 		return uint(uint32(C.QGlyphRun___glyphIndexes_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -12698,7 +12818,7 @@ func NewQGuiApplicationFromPointer(ptr unsafe.Pointer) *QGuiApplication {
 }
 func QGuiApplication_Clipboard() *QClipboard {
 	var tmpValue = NewQClipboardFromPointer(C.QGuiApplication_QGuiApplication_Clipboard())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12706,7 +12826,7 @@ func QGuiApplication_Clipboard() *QClipboard {
 
 func (ptr *QGuiApplication) Clipboard() *QClipboard {
 	var tmpValue = NewQClipboardFromPointer(C.QGuiApplication_QGuiApplication_Clipboard())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12733,10 +12853,10 @@ func (ptr *QGuiApplication) Font() *QFont {
 }
 
 func NewQGuiApplication(argc int, argv []string) *QGuiApplication {
-	var argvC = C.CString(strings.Join(argv, "|"))
+	var argvC = cGoPackStringList(argv)
 	defer C.free(unsafe.Pointer(argvC))
 	var tmpValue = NewQGuiApplicationFromPointer(C.QGuiApplication_NewQGuiApplication(C.int(int32(argc)), argvC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12756,7 +12876,7 @@ func (ptr *QGuiApplication) WindowIcon() *QIcon {
 
 func QGuiApplication_InputMethod() *QInputMethod {
 	var tmpValue = NewQInputMethodFromPointer(C.QGuiApplication_QGuiApplication_InputMethod())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12764,7 +12884,7 @@ func QGuiApplication_InputMethod() *QInputMethod {
 
 func (ptr *QGuiApplication) InputMethod() *QInputMethod {
 	var tmpValue = NewQInputMethodFromPointer(C.QGuiApplication_QGuiApplication_InputMethod())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12792,7 +12912,7 @@ func (ptr *QGuiApplication) Screens() []*QScreen {
 
 func QGuiApplication_FocusObject() *core.QObject {
 	var tmpValue = core.NewQObjectFromPointer(C.QGuiApplication_QGuiApplication_FocusObject())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12800,7 +12920,7 @@ func QGuiApplication_FocusObject() *core.QObject {
 
 func (ptr *QGuiApplication) FocusObject() *core.QObject {
 	var tmpValue = core.NewQObjectFromPointer(C.QGuiApplication_QGuiApplication_FocusObject())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12820,7 +12940,7 @@ func (ptr *QGuiApplication) Palette() *QPalette {
 
 func QGuiApplication_PrimaryScreen() *QScreen {
 	var tmpValue = NewQScreenFromPointer(C.QGuiApplication_QGuiApplication_PrimaryScreen())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12828,7 +12948,7 @@ func QGuiApplication_PrimaryScreen() *QScreen {
 
 func (ptr *QGuiApplication) PrimaryScreen() *QScreen {
 	var tmpValue = NewQScreenFromPointer(C.QGuiApplication_QGuiApplication_PrimaryScreen())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12860,7 +12980,7 @@ func (ptr *QGuiApplication) PlatformName() string {
 
 func QGuiApplication_StyleHints() *QStyleHints {
 	var tmpValue = NewQStyleHintsFromPointer(C.QGuiApplication_QGuiApplication_StyleHints())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12868,7 +12988,7 @@ func QGuiApplication_StyleHints() *QStyleHints {
 
 func (ptr *QGuiApplication) StyleHints() *QStyleHints {
 	var tmpValue = NewQStyleHintsFromPointer(C.QGuiApplication_QGuiApplication_StyleHints())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12876,7 +12996,7 @@ func (ptr *QGuiApplication) StyleHints() *QStyleHints {
 
 func QGuiApplication_FocusWindow() *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QGuiApplication_QGuiApplication_FocusWindow())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12884,7 +13004,7 @@ func QGuiApplication_FocusWindow() *QWindow {
 
 func (ptr *QGuiApplication) FocusWindow() *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QGuiApplication_QGuiApplication_FocusWindow())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12892,7 +13012,7 @@ func (ptr *QGuiApplication) FocusWindow() *QWindow {
 
 func QGuiApplication_ModalWindow() *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QGuiApplication_QGuiApplication_ModalWindow())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12900,7 +13020,7 @@ func QGuiApplication_ModalWindow() *QWindow {
 
 func (ptr *QGuiApplication) ModalWindow() *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QGuiApplication_QGuiApplication_ModalWindow())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12908,7 +13028,7 @@ func (ptr *QGuiApplication) ModalWindow() *QWindow {
 
 func QGuiApplication_TopLevelAt(pos core.QPoint_ITF) *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QGuiApplication_QGuiApplication_TopLevelAt(core.PointerFromQPoint(pos)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12916,7 +13036,7 @@ func QGuiApplication_TopLevelAt(pos core.QPoint_ITF) *QWindow {
 
 func (ptr *QGuiApplication) TopLevelAt(pos core.QPoint_ITF) *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QGuiApplication_QGuiApplication_TopLevelAt(core.PointerFromQPoint(pos)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12972,7 +13092,7 @@ func (ptr *QGuiApplication) DesktopSettingsAware() bool {
 
 //export callbackQGuiApplication_Event
 func callbackQGuiApplication_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -13028,7 +13148,7 @@ func (ptr *QGuiApplication) Exec() int {
 
 //export callbackQGuiApplication_ApplicationDisplayNameChanged
 func callbackQGuiApplication_ApplicationDisplayNameChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "applicationDisplayNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "applicationDisplayNameChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13037,14 +13157,14 @@ func callbackQGuiApplication_ApplicationDisplayNameChanged(ptr unsafe.Pointer) {
 func (ptr *QGuiApplication) ConnectApplicationDisplayNameChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectApplicationDisplayNameChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "applicationDisplayNameChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "applicationDisplayNameChanged", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectApplicationDisplayNameChanged() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectApplicationDisplayNameChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "applicationDisplayNameChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "applicationDisplayNameChanged")
 	}
 }
 
@@ -13056,7 +13176,7 @@ func (ptr *QGuiApplication) ApplicationDisplayNameChanged() {
 
 //export callbackQGuiApplication_ApplicationStateChanged
 func callbackQGuiApplication_ApplicationStateChanged(ptr unsafe.Pointer, state C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "applicationStateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "applicationStateChanged"); signal != nil {
 		signal.(func(core.Qt__ApplicationState))(core.Qt__ApplicationState(state))
 	}
 
@@ -13065,14 +13185,14 @@ func callbackQGuiApplication_ApplicationStateChanged(ptr unsafe.Pointer, state C
 func (ptr *QGuiApplication) ConnectApplicationStateChanged(f func(state core.Qt__ApplicationState)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectApplicationStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "applicationStateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "applicationStateChanged", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectApplicationStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectApplicationStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "applicationStateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "applicationStateChanged")
 	}
 }
 
@@ -13092,7 +13212,7 @@ func (ptr *QGuiApplication) ChangeOverrideCursor(cursor QCursor_ITF) {
 
 //export callbackQGuiApplication_CommitDataRequest
 func callbackQGuiApplication_CommitDataRequest(ptr unsafe.Pointer, manager unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "commitDataRequest"); signal != nil {
+	if signal := qt.GetSignal(ptr, "commitDataRequest"); signal != nil {
 		signal.(func(*QSessionManager))(NewQSessionManagerFromPointer(manager))
 	}
 
@@ -13101,14 +13221,14 @@ func callbackQGuiApplication_CommitDataRequest(ptr unsafe.Pointer, manager unsaf
 func (ptr *QGuiApplication) ConnectCommitDataRequest(f func(manager *QSessionManager)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectCommitDataRequest(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "commitDataRequest", f)
+		qt.ConnectSignal(ptr.Pointer(), "commitDataRequest", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectCommitDataRequest() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectCommitDataRequest(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "commitDataRequest")
+		qt.DisconnectSignal(ptr.Pointer(), "commitDataRequest")
 	}
 }
 
@@ -13120,7 +13240,7 @@ func (ptr *QGuiApplication) CommitDataRequest(manager QSessionManager_ITF) {
 
 //export callbackQGuiApplication_FocusObjectChanged
 func callbackQGuiApplication_FocusObjectChanged(ptr unsafe.Pointer, focusObject unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusObjectChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusObjectChanged"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(focusObject))
 	}
 
@@ -13129,14 +13249,14 @@ func callbackQGuiApplication_FocusObjectChanged(ptr unsafe.Pointer, focusObject
 func (ptr *QGuiApplication) ConnectFocusObjectChanged(f func(focusObject *core.QObject)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectFocusObjectChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "focusObjectChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "focusObjectChanged", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectFocusObjectChanged() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectFocusObjectChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "focusObjectChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "focusObjectChanged")
 	}
 }
 
@@ -13148,7 +13268,7 @@ func (ptr *QGuiApplication) FocusObjectChanged(focusObject core.QObject_ITF) {
 
 //export callbackQGuiApplication_FocusWindowChanged
 func callbackQGuiApplication_FocusWindowChanged(ptr unsafe.Pointer, focusWindow unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusWindowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusWindowChanged"); signal != nil {
 		signal.(func(*QWindow))(NewQWindowFromPointer(focusWindow))
 	}
 
@@ -13157,14 +13277,14 @@ func callbackQGuiApplication_FocusWindowChanged(ptr unsafe.Pointer, focusWindow
 func (ptr *QGuiApplication) ConnectFocusWindowChanged(f func(focusWindow *QWindow)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectFocusWindowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "focusWindowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "focusWindowChanged", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectFocusWindowChanged() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectFocusWindowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "focusWindowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "focusWindowChanged")
 	}
 }
 
@@ -13176,7 +13296,7 @@ func (ptr *QGuiApplication) FocusWindowChanged(focusWindow QWindow_ITF) {
 
 //export callbackQGuiApplication_FontDatabaseChanged
 func callbackQGuiApplication_FontDatabaseChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fontDatabaseChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fontDatabaseChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13185,14 +13305,14 @@ func callbackQGuiApplication_FontDatabaseChanged(ptr unsafe.Pointer) {
 func (ptr *QGuiApplication) ConnectFontDatabaseChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectFontDatabaseChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fontDatabaseChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "fontDatabaseChanged", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectFontDatabaseChanged() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectFontDatabaseChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fontDatabaseChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "fontDatabaseChanged")
 	}
 }
 
@@ -13204,7 +13324,7 @@ func (ptr *QGuiApplication) FontDatabaseChanged() {
 
 //export callbackQGuiApplication_LastWindowClosed
 func callbackQGuiApplication_LastWindowClosed(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lastWindowClosed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lastWindowClosed"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13213,14 +13333,14 @@ func callbackQGuiApplication_LastWindowClosed(ptr unsafe.Pointer) {
 func (ptr *QGuiApplication) ConnectLastWindowClosed(f func()) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectLastWindowClosed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lastWindowClosed", f)
+		qt.ConnectSignal(ptr.Pointer(), "lastWindowClosed", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectLastWindowClosed() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectLastWindowClosed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lastWindowClosed")
+		qt.DisconnectSignal(ptr.Pointer(), "lastWindowClosed")
 	}
 }
 
@@ -13232,7 +13352,7 @@ func (ptr *QGuiApplication) LastWindowClosed() {
 
 //export callbackQGuiApplication_LayoutDirectionChanged
 func callbackQGuiApplication_LayoutDirectionChanged(ptr unsafe.Pointer, direction C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutDirectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutDirectionChanged"); signal != nil {
 		signal.(func(core.Qt__LayoutDirection))(core.Qt__LayoutDirection(direction))
 	}
 
@@ -13241,14 +13361,14 @@ func callbackQGuiApplication_LayoutDirectionChanged(ptr unsafe.Pointer, directio
 func (ptr *QGuiApplication) ConnectLayoutDirectionChanged(f func(direction core.Qt__LayoutDirection)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectLayoutDirectionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "layoutDirectionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "layoutDirectionChanged", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectLayoutDirectionChanged() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectLayoutDirectionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "layoutDirectionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "layoutDirectionChanged")
 	}
 }
 
@@ -13260,7 +13380,7 @@ func (ptr *QGuiApplication) LayoutDirectionChanged(direction core.Qt__LayoutDire
 
 //export callbackQGuiApplication_PaletteChanged
 func callbackQGuiApplication_PaletteChanged(ptr unsafe.Pointer, palette unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paletteChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paletteChanged"); signal != nil {
 		signal.(func(*QPalette))(NewQPaletteFromPointer(palette))
 	}
 
@@ -13269,14 +13389,14 @@ func callbackQGuiApplication_PaletteChanged(ptr unsafe.Pointer, palette unsafe.P
 func (ptr *QGuiApplication) ConnectPaletteChanged(f func(palette *QPalette)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectPaletteChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paletteChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "paletteChanged", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectPaletteChanged() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectPaletteChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paletteChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "paletteChanged")
 	}
 }
 
@@ -13288,7 +13408,7 @@ func (ptr *QGuiApplication) PaletteChanged(palette QPalette_ITF) {
 
 //export callbackQGuiApplication_PrimaryScreenChanged
 func callbackQGuiApplication_PrimaryScreenChanged(ptr unsafe.Pointer, screen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "primaryScreenChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "primaryScreenChanged"); signal != nil {
 		signal.(func(*QScreen))(NewQScreenFromPointer(screen))
 	}
 
@@ -13297,14 +13417,14 @@ func callbackQGuiApplication_PrimaryScreenChanged(ptr unsafe.Pointer, screen uns
 func (ptr *QGuiApplication) ConnectPrimaryScreenChanged(f func(screen *QScreen)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectPrimaryScreenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "primaryScreenChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "primaryScreenChanged", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectPrimaryScreenChanged() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectPrimaryScreenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "primaryScreenChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "primaryScreenChanged")
 	}
 }
 
@@ -13324,7 +13444,7 @@ func (ptr *QGuiApplication) RestoreOverrideCursor() {
 
 //export callbackQGuiApplication_SaveStateRequest
 func callbackQGuiApplication_SaveStateRequest(ptr unsafe.Pointer, manager unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "saveStateRequest"); signal != nil {
+	if signal := qt.GetSignal(ptr, "saveStateRequest"); signal != nil {
 		signal.(func(*QSessionManager))(NewQSessionManagerFromPointer(manager))
 	}
 
@@ -13333,14 +13453,14 @@ func callbackQGuiApplication_SaveStateRequest(ptr unsafe.Pointer, manager unsafe
 func (ptr *QGuiApplication) ConnectSaveStateRequest(f func(manager *QSessionManager)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectSaveStateRequest(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "saveStateRequest", f)
+		qt.ConnectSignal(ptr.Pointer(), "saveStateRequest", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectSaveStateRequest() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectSaveStateRequest(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "saveStateRequest")
+		qt.DisconnectSignal(ptr.Pointer(), "saveStateRequest")
 	}
 }
 
@@ -13352,7 +13472,7 @@ func (ptr *QGuiApplication) SaveStateRequest(manager QSessionManager_ITF) {
 
 //export callbackQGuiApplication_ScreenAdded
 func callbackQGuiApplication_ScreenAdded(ptr unsafe.Pointer, screen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "screenAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "screenAdded"); signal != nil {
 		signal.(func(*QScreen))(NewQScreenFromPointer(screen))
 	}
 
@@ -13361,14 +13481,14 @@ func callbackQGuiApplication_ScreenAdded(ptr unsafe.Pointer, screen unsafe.Point
 func (ptr *QGuiApplication) ConnectScreenAdded(f func(screen *QScreen)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectScreenAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "screenAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "screenAdded", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectScreenAdded() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectScreenAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "screenAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "screenAdded")
 	}
 }
 
@@ -13380,7 +13500,7 @@ func (ptr *QGuiApplication) ScreenAdded(screen QScreen_ITF) {
 
 //export callbackQGuiApplication_ScreenRemoved
 func callbackQGuiApplication_ScreenRemoved(ptr unsafe.Pointer, screen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "screenRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "screenRemoved"); signal != nil {
 		signal.(func(*QScreen))(NewQScreenFromPointer(screen))
 	}
 
@@ -13389,14 +13509,14 @@ func callbackQGuiApplication_ScreenRemoved(ptr unsafe.Pointer, screen unsafe.Poi
 func (ptr *QGuiApplication) ConnectScreenRemoved(f func(screen *QScreen)) {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_ConnectScreenRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "screenRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "screenRemoved", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectScreenRemoved() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DisconnectScreenRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "screenRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "screenRemoved")
 	}
 }
 
@@ -13504,7 +13624,7 @@ func (ptr *QGuiApplication) Sync() {
 
 //export callbackQGuiApplication_DestroyQGuiApplication
 func callbackQGuiApplication_DestroyQGuiApplication(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QGuiApplication"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QGuiApplication"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQGuiApplicationFromPointer(ptr).DestroyQGuiApplicationDefault()
@@ -13514,21 +13634,21 @@ func callbackQGuiApplication_DestroyQGuiApplication(ptr unsafe.Pointer) {
 func (ptr *QGuiApplication) ConnectDestroyQGuiApplication(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QGuiApplication", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QGuiApplication", f)
 	}
 }
 
 func (ptr *QGuiApplication) DisconnectDestroyQGuiApplication() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QGuiApplication")
+		qt.DisconnectSignal(ptr.Pointer(), "~QGuiApplication")
 	}
 }
 
 func (ptr *QGuiApplication) DestroyQGuiApplication() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DestroyQGuiApplication(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13536,7 +13656,7 @@ func (ptr *QGuiApplication) DestroyQGuiApplication() {
 func (ptr *QGuiApplication) DestroyQGuiApplicationDefault() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DestroyQGuiApplicationDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13579,7 +13699,7 @@ func (ptr *QGuiApplication) DevicePixelRatio() float64 {
 func (ptr *QGuiApplication) __screens_atList(i int) *QScreen {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScreenFromPointer(C.QGuiApplication___screens_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13619,7 +13739,7 @@ func (ptr *QGuiApplication) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QGuiApplication) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGuiApplication___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13640,7 +13760,7 @@ func (ptr *QGuiApplication) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QGuiApplication) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGuiApplication___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13661,7 +13781,7 @@ func (ptr *QGuiApplication) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QGuiApplication) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGuiApplication___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13682,7 +13802,7 @@ func (ptr *QGuiApplication) __findChildren_newList() unsafe.Pointer {
 func (ptr *QGuiApplication) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGuiApplication___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13702,7 +13822,7 @@ func (ptr *QGuiApplication) __children_newList() unsafe.Pointer {
 
 //export callbackQGuiApplication_AboutToQuit
 func callbackQGuiApplication_AboutToQuit(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aboutToQuit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aboutToQuit"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13710,7 +13830,7 @@ func callbackQGuiApplication_AboutToQuit(ptr unsafe.Pointer) {
 
 //export callbackQGuiApplication_Quit
 func callbackQGuiApplication_Quit(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "quit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "quit"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQGuiApplicationFromPointer(ptr).QuitDefault()
@@ -13725,7 +13845,7 @@ func (ptr *QGuiApplication) QuitDefault() {
 
 //export callbackQGuiApplication_EventFilter
 func callbackQGuiApplication_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -13741,7 +13861,7 @@ func (ptr *QGuiApplication) EventFilterDefault(watched core.QObject_ITF, event c
 
 //export callbackQGuiApplication_ChildEvent
 func callbackQGuiApplication_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQGuiApplicationFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -13756,7 +13876,7 @@ func (ptr *QGuiApplication) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQGuiApplication_ConnectNotify
 func callbackQGuiApplication_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQGuiApplicationFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -13771,7 +13891,7 @@ func (ptr *QGuiApplication) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQGuiApplication_CustomEvent
 func callbackQGuiApplication_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQGuiApplicationFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -13786,7 +13906,7 @@ func (ptr *QGuiApplication) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQGuiApplication_DeleteLater
 func callbackQGuiApplication_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQGuiApplicationFromPointer(ptr).DeleteLaterDefault()
@@ -13796,14 +13916,14 @@ func callbackQGuiApplication_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QGuiApplication) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QGuiApplication_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQGuiApplication_Destroyed
 func callbackQGuiApplication_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -13811,7 +13931,7 @@ func callbackQGuiApplication_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQGuiApplication_DisconnectNotify
 func callbackQGuiApplication_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQGuiApplicationFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -13826,7 +13946,7 @@ func (ptr *QGuiApplication) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQGuiApplication_ObjectNameChanged
 func callbackQGuiApplication_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -13834,7 +13954,7 @@ func callbackQGuiApplication_ObjectNameChanged(ptr unsafe.Pointer, objectName C.
 
 //export callbackQGuiApplication_TimerEvent
 func callbackQGuiApplication_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQGuiApplicationFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -13849,7 +13969,7 @@ func (ptr *QGuiApplication) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQGuiApplication_MetaObject
 func callbackQGuiApplication_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -13905,7 +14025,7 @@ func NewQHelpEventFromPointer(ptr unsafe.Pointer) *QHelpEvent {
 func (ptr *QHelpEvent) DestroyQHelpEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13998,7 +14118,7 @@ func NewQHideEventFromPointer(ptr unsafe.Pointer) *QHideEvent {
 func (ptr *QHideEvent) DestroyQHideEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14049,7 +14169,7 @@ func NewQHoverEventFromPointer(ptr unsafe.Pointer) *QHoverEvent {
 func (ptr *QHoverEvent) DestroyQHoverEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14227,11 +14347,11 @@ func (ptr *QIcon) ThemeName() string {
 }
 
 func QIcon_ThemeSearchPaths() []string {
-	return strings.Split(cGoUnpackString(C.QIcon_QIcon_ThemeSearchPaths()), "|")
+	return cGoUnpackStringListAndFree(C.QIcon_QIcon_ThemeSearchPaths())
 }
 
 func (ptr *QIcon) ThemeSearchPaths() []string {
-	return strings.Split(cGoUnpackString(C.QIcon_QIcon_ThemeSearchPaths()), "|")
+	return cGoUnpackStringListAndFree(C.QIcon_QIcon_ThemeSearchPaths())
 }
 
 func QIcon_HasThemeIcon(name string) bool {
@@ -14279,13 +14399,13 @@ func (ptr *QIcon) SetThemeName(name string) {
 }
 
 func QIcon_SetThemeSearchPaths(paths []string) {
-	var pathsC = C.CString(strings.Join(paths, "|"))
+	var pathsC = cGoPackStringList(paths)
 	defer C.free(unsafe.Pointer(pathsC))
 	C.QIcon_QIcon_SetThemeSearchPaths(pathsC)
 }
 
 func (ptr *QIcon) SetThemeSearchPaths(paths []string) {
-	var pathsC = C.CString(strings.Join(paths, "|"))
+	var pathsC = cGoPackStringList(paths)
 	defer C.free(unsafe.Pointer(pathsC))
 	C.QIcon_QIcon_SetThemeSearchPaths(pathsC)
 }
@@ -14307,8 +14427,11 @@ func (ptr *QIcon) AvailableSizes(mode QIcon__Mode, state QIcon__State) []*core.Q
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []*core.QSize {
 			var out = make([]*core.QSize, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQIconFromPointer(l.data).__availableSizes_atList(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQIconFromPointer(l.data).__availableSizes_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = core.NewQSizeFromPointer(v)
+				runtime.SetFinalizer(out[i], (*core.QSize).DestroyQSize)
 			}
 			return out
 		}(C.QIcon_AvailableSizes(ptr.Pointer(), C.longlong(mode), C.longlong(state)))
@@ -14429,6 +14552,16 @@ func (ptr *QIcon) __availableSizes_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QIcon___availableSizes_newList(ptr.Pointer()))
 }
 
+func (ptr *QIcon) __availableSizes_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QIcon___availableSizes_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QIcon) __availableSizes_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QIcon___availableSizes_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QIconDragEvent struct {
 	core.QEvent
 }
@@ -14471,7 +14604,7 @@ func NewQIconDragEventFromPointer(ptr unsafe.Pointer) *QIconDragEvent {
 func (ptr *QIconDragEvent) DestroyQIconDragEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14534,7 +14667,7 @@ func NewQIconEngine() *QIconEngine {
 
 //export callbackQIconEngine_Pixmap
 func callbackQIconEngine_Pixmap(ptr unsafe.Pointer, size unsafe.Pointer, mode C.longlong, state C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pixmap"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pixmap"); signal != nil {
 		return PointerFromQPixmap(signal.(func(*core.QSize, QIcon__Mode, QIcon__State) *QPixmap)(core.NewQSizeFromPointer(size), QIcon__Mode(mode), QIcon__State(state)))
 	}
 
@@ -14544,14 +14677,14 @@ func callbackQIconEngine_Pixmap(ptr unsafe.Pointer, size unsafe.Pointer, mode C.
 func (ptr *QIconEngine) ConnectPixmap(f func(size *core.QSize, mode QIcon__Mode, state QIcon__State) *QPixmap) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pixmap", f)
+		qt.ConnectSignal(ptr.Pointer(), "pixmap", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectPixmap() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pixmap")
+		qt.DisconnectSignal(ptr.Pointer(), "pixmap")
 	}
 }
 
@@ -14575,7 +14708,7 @@ func (ptr *QIconEngine) PixmapDefault(size core.QSize_ITF, mode QIcon__Mode, sta
 
 //export callbackQIconEngine_ActualSize
 func callbackQIconEngine_ActualSize(ptr unsafe.Pointer, size unsafe.Pointer, mode C.longlong, state C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actualSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actualSize"); signal != nil {
 		return core.PointerFromQSize(signal.(func(*core.QSize, QIcon__Mode, QIcon__State) *core.QSize)(core.NewQSizeFromPointer(size), QIcon__Mode(mode), QIcon__State(state)))
 	}
 
@@ -14585,14 +14718,14 @@ func callbackQIconEngine_ActualSize(ptr unsafe.Pointer, size unsafe.Pointer, mod
 func (ptr *QIconEngine) ConnectActualSize(f func(size *core.QSize, mode QIcon__Mode, state QIcon__State) *core.QSize) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "actualSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "actualSize", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectActualSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "actualSize")
+		qt.DisconnectSignal(ptr.Pointer(), "actualSize")
 	}
 }
 
@@ -14616,7 +14749,7 @@ func (ptr *QIconEngine) ActualSizeDefault(size core.QSize_ITF, mode QIcon__Mode,
 
 //export callbackQIconEngine_Read
 func callbackQIconEngine_Read(ptr unsafe.Pointer, in unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "read"); signal != nil {
+	if signal := qt.GetSignal(ptr, "read"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QDataStream) bool)(core.NewQDataStreamFromPointer(in)))))
 	}
 
@@ -14626,14 +14759,14 @@ func callbackQIconEngine_Read(ptr unsafe.Pointer, in unsafe.Pointer) C.char {
 func (ptr *QIconEngine) ConnectRead(f func(in *core.QDataStream) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "read", f)
+		qt.ConnectSignal(ptr.Pointer(), "read", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectRead() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "read")
+		qt.DisconnectSignal(ptr.Pointer(), "read")
 	}
 }
 
@@ -14653,7 +14786,7 @@ func (ptr *QIconEngine) ReadDefault(in core.QDataStream_ITF) bool {
 
 //export callbackQIconEngine_AddFile
 func callbackQIconEngine_AddFile(ptr unsafe.Pointer, fileName C.struct_QtGui_PackedString, size unsafe.Pointer, mode C.longlong, state C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "addFile"); signal != nil {
+	if signal := qt.GetSignal(ptr, "addFile"); signal != nil {
 		signal.(func(string, *core.QSize, QIcon__Mode, QIcon__State))(cGoUnpackString(fileName), core.NewQSizeFromPointer(size), QIcon__Mode(mode), QIcon__State(state))
 	} else {
 		NewQIconEngineFromPointer(ptr).AddFileDefault(cGoUnpackString(fileName), core.NewQSizeFromPointer(size), QIcon__Mode(mode), QIcon__State(state))
@@ -14663,14 +14796,14 @@ func callbackQIconEngine_AddFile(ptr unsafe.Pointer, fileName C.struct_QtGui_Pac
 func (ptr *QIconEngine) ConnectAddFile(f func(fileName string, size *core.QSize, mode QIcon__Mode, state QIcon__State)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "addFile", f)
+		qt.ConnectSignal(ptr.Pointer(), "addFile", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectAddFile() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "addFile")
+		qt.DisconnectSignal(ptr.Pointer(), "addFile")
 	}
 }
 
@@ -14692,7 +14825,7 @@ func (ptr *QIconEngine) AddFileDefault(fileName string, size core.QSize_ITF, mod
 
 //export callbackQIconEngine_AddPixmap
 func callbackQIconEngine_AddPixmap(ptr unsafe.Pointer, pixmap unsafe.Pointer, mode C.longlong, state C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "addPixmap"); signal != nil {
+	if signal := qt.GetSignal(ptr, "addPixmap"); signal != nil {
 		signal.(func(*QPixmap, QIcon__Mode, QIcon__State))(NewQPixmapFromPointer(pixmap), QIcon__Mode(mode), QIcon__State(state))
 	} else {
 		NewQIconEngineFromPointer(ptr).AddPixmapDefault(NewQPixmapFromPointer(pixmap), QIcon__Mode(mode), QIcon__State(state))
@@ -14702,14 +14835,14 @@ func callbackQIconEngine_AddPixmap(ptr unsafe.Pointer, pixmap unsafe.Pointer, mo
 func (ptr *QIconEngine) ConnectAddPixmap(f func(pixmap *QPixmap, mode QIcon__Mode, state QIcon__State)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "addPixmap", f)
+		qt.ConnectSignal(ptr.Pointer(), "addPixmap", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectAddPixmap() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "addPixmap")
+		qt.DisconnectSignal(ptr.Pointer(), "addPixmap")
 	}
 }
 
@@ -14727,7 +14860,7 @@ func (ptr *QIconEngine) AddPixmapDefault(pixmap QPixmap_ITF, mode QIcon__Mode, s
 
 //export callbackQIconEngine_Paint
 func callbackQIconEngine_Paint(ptr unsafe.Pointer, painter unsafe.Pointer, rect unsafe.Pointer, mode C.longlong, state C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paint"); signal != nil {
 		signal.(func(*QPainter, *core.QRect, QIcon__Mode, QIcon__State))(NewQPainterFromPointer(painter), core.NewQRectFromPointer(rect), QIcon__Mode(mode), QIcon__State(state))
 	}
 
@@ -14736,14 +14869,14 @@ func callbackQIconEngine_Paint(ptr unsafe.Pointer, painter unsafe.Pointer, rect
 func (ptr *QIconEngine) ConnectPaint(f func(painter *QPainter, rect *core.QRect, mode QIcon__Mode, state QIcon__State)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paint", f)
+		qt.ConnectSignal(ptr.Pointer(), "paint", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectPaint() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paint")
+		qt.DisconnectSignal(ptr.Pointer(), "paint")
 	}
 }
 
@@ -14755,7 +14888,7 @@ func (ptr *QIconEngine) Paint(painter QPainter_ITF, rect core.QRect_ITF, mode QI
 
 //export callbackQIconEngine_Virtual_hook
 func callbackQIconEngine_Virtual_hook(ptr unsafe.Pointer, id C.int, data unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "virtual_hook"); signal != nil {
+	if signal := qt.GetSignal(ptr, "virtual_hook"); signal != nil {
 		signal.(func(int, unsafe.Pointer))(int(int32(id)), data)
 	} else {
 		NewQIconEngineFromPointer(ptr).Virtual_hookDefault(int(int32(id)), data)
@@ -14765,14 +14898,14 @@ func callbackQIconEngine_Virtual_hook(ptr unsafe.Pointer, id C.int, data unsafe.
 func (ptr *QIconEngine) ConnectVirtual_hook(f func(id int, data unsafe.Pointer)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "virtual_hook", f)
+		qt.ConnectSignal(ptr.Pointer(), "virtual_hook", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectVirtual_hook() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "virtual_hook")
+		qt.DisconnectSignal(ptr.Pointer(), "virtual_hook")
 	}
 }
 
@@ -14790,7 +14923,7 @@ func (ptr *QIconEngine) Virtual_hookDefault(id int, data unsafe.Pointer) {
 
 //export callbackQIconEngine_DestroyQIconEngine
 func callbackQIconEngine_DestroyQIconEngine(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QIconEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QIconEngine"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQIconEngineFromPointer(ptr).DestroyQIconEngineDefault()
@@ -14800,21 +14933,21 @@ func callbackQIconEngine_DestroyQIconEngine(ptr unsafe.Pointer) {
 func (ptr *QIconEngine) ConnectDestroyQIconEngine(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QIconEngine", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QIconEngine", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectDestroyQIconEngine() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QIconEngine")
+		qt.DisconnectSignal(ptr.Pointer(), "~QIconEngine")
 	}
 }
 
 func (ptr *QIconEngine) DestroyQIconEngine() {
 	if ptr.Pointer() != nil {
 		C.QIconEngine_DestroyQIconEngine(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14822,14 +14955,14 @@ func (ptr *QIconEngine) DestroyQIconEngine() {
 func (ptr *QIconEngine) DestroyQIconEngineDefault() {
 	if ptr.Pointer() != nil {
 		C.QIconEngine_DestroyQIconEngineDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQIconEngine_Clone
 func callbackQIconEngine_Clone(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clone"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clone"); signal != nil {
 		return PointerFromQIconEngine(signal.(func() *QIconEngine)())
 	}
 
@@ -14839,14 +14972,14 @@ func callbackQIconEngine_Clone(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QIconEngine) ConnectClone(f func() *QIconEngine) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clone", f)
+		qt.ConnectSignal(ptr.Pointer(), "clone", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectClone() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clone")
+		qt.DisconnectSignal(ptr.Pointer(), "clone")
 	}
 }
 
@@ -14859,36 +14992,36 @@ func (ptr *QIconEngine) Clone() *QIconEngine {
 
 //export callbackQIconEngine_AvailableSizes
 func callbackQIconEngine_AvailableSizes(ptr unsafe.Pointer, mode C.longlong, state C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "availableSizes"); signal != nil {
-		return func() unsafe.Pointer {
-			var tmpList = NewQIconEngineFromPointer(NewQIconEngineFromPointer(nil).__availableSizes_newList())
-			for _, v := range signal.(func(QIcon__Mode, QIcon__State) []*core.QSize)(QIcon__Mode(mode), QIcon__State(state)) {
-				tmpList.__availableSizes_setList(v)
+	if signal := qt.GetSignal(ptr, "availableSizes"); signal != nil {
+		return func(l []*core.QSize) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQSize(v)
 			}
-			return tmpList.Pointer()
-		}()
+			return NewQIconEngineFromPointer(nil).__availableSizes_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(signal.(func(QIcon__Mode, QIcon__State) []*core.QSize)(QIcon__Mode(mode), QIcon__State(state)))
 	}
 
-	return func() unsafe.Pointer {
-		var tmpList = NewQIconEngineFromPointer(NewQIconEngineFromPointer(nil).__availableSizes_newList())
-		for _, v := range NewQIconEngineFromPointer(ptr).AvailableSizesDefault(QIcon__Mode(mode), QIcon__State(state)) {
-			tmpList.__availableSizes_setList(v)
+	return func(l []*core.QSize) unsafe.Pointer {
+		var tmpList = make([]unsafe.Pointer, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = core.PointerFromQSize(v)
 		}
-		return tmpList.Pointer()
-	}()
+		return NewQIconEngineFromPointer(nil).__availableSizes_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+	}(NewQIconEngineFromPointer(ptr).AvailableSizesDefault(QIcon__Mode(mode), QIcon__State(state)))
 }
 
 func (ptr *QIconEngine) ConnectAvailableSizes(f func(mode QIcon__Mode, state QIcon__State) []*core.QSize) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "availableSizes", f)
+		qt.ConnectSignal(ptr.Pointer(), "availableSizes", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectAvailableSizes() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "availableSizes")
+		qt.DisconnectSignal(ptr.Pointer(), "availableSizes")
 	}
 }
 
@@ -14896,8 +15029,11 @@ func (ptr *QIconEngine) AvailableSizes(mode QIcon__Mode, state QIcon__State) []*
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []*core.QSize {
 			var out = make([]*core.QSize, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQIconEngineFromPointer(l.data).__availableSizes_atList(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQIconEngineFromPointer(l.data).__availableSizes_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = core.NewQSizeFromPointer(v)
+				runtime.SetFinalizer(out[i], (*core.QSize).DestroyQSize)
 			}
 			return out
 		}(C.QIconEngine_AvailableSizes(ptr.Pointer(), C.longlong(mode), C.longlong(state)))
@@ -14909,8 +15045,11 @@ func (ptr *QIconEngine) AvailableSizesDefault(mode QIcon__Mode, state QIcon__Sta
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []*core.QSize {
 			var out = make([]*core.QSize, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQIconEngineFromPointer(l.data).__availableSizes_atList(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQIconEngineFromPointer(l.data).__availableSizes_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = core.NewQSizeFromPointer(v)
+				runtime.SetFinalizer(out[i], (*core.QSize).DestroyQSize)
 			}
 			return out
 		}(C.QIconEngine_AvailableSizesDefault(ptr.Pointer(), C.longlong(mode), C.longlong(state)))
@@ -14920,7 +15059,7 @@ func (ptr *QIconEngine) AvailableSizesDefault(mode QIcon__Mode, state QIcon__Sta
 
 //export callbackQIconEngine_IconName
 func callbackQIconEngine_IconName(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "iconName"); signal != nil {
+	if signal := qt.GetSignal(ptr, "iconName"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -14930,14 +15069,14 @@ func callbackQIconEngine_IconName(ptr unsafe.Pointer) *C.char {
 func (ptr *QIconEngine) ConnectIconName(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "iconName", f)
+		qt.ConnectSignal(ptr.Pointer(), "iconName", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectIconName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "iconName")
+		qt.DisconnectSignal(ptr.Pointer(), "iconName")
 	}
 }
 
@@ -14957,7 +15096,7 @@ func (ptr *QIconEngine) IconNameDefault() string {
 
 //export callbackQIconEngine_Key
 func callbackQIconEngine_Key(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "key"); signal != nil {
+	if signal := qt.GetSignal(ptr, "key"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -14967,14 +15106,14 @@ func callbackQIconEngine_Key(ptr unsafe.Pointer) *C.char {
 func (ptr *QIconEngine) ConnectKey(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "key", f)
+		qt.ConnectSignal(ptr.Pointer(), "key", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectKey() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "key")
+		qt.DisconnectSignal(ptr.Pointer(), "key")
 	}
 }
 
@@ -15001,7 +15140,7 @@ func (ptr *QIconEngine) IsNull() bool {
 
 //export callbackQIconEngine_Write
 func callbackQIconEngine_Write(ptr unsafe.Pointer, out unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "write"); signal != nil {
+	if signal := qt.GetSignal(ptr, "write"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QDataStream) bool)(core.NewQDataStreamFromPointer(out)))))
 	}
 
@@ -15011,14 +15150,14 @@ func callbackQIconEngine_Write(ptr unsafe.Pointer, out unsafe.Pointer) C.char {
 func (ptr *QIconEngine) ConnectWrite(f func(out *core.QDataStream) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "write", f)
+		qt.ConnectSignal(ptr.Pointer(), "write", f)
 	}
 }
 
 func (ptr *QIconEngine) DisconnectWrite() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "write")
+		qt.DisconnectSignal(ptr.Pointer(), "write")
 	}
 }
 
@@ -15055,6 +15194,16 @@ func (ptr *QIconEngine) __availableSizes_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QIconEngine___availableSizes_newList(ptr.Pointer()))
 }
 
+func (ptr *QIconEngine) __availableSizes_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QIconEngine___availableSizes_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QIconEngine) __availableSizes_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QIconEngine___availableSizes_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QIconEnginePlugin struct {
 	core.QObject
 }
@@ -15096,7 +15245,7 @@ func NewQIconEnginePluginFromPointer(ptr unsafe.Pointer) *QIconEnginePlugin {
 
 //export callbackQIconEnginePlugin_Create
 func callbackQIconEnginePlugin_Create(ptr unsafe.Pointer, filename C.struct_QtGui_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "create"); signal != nil {
+	if signal := qt.GetSignal(ptr, "create"); signal != nil {
 		return PointerFromQIconEngine(signal.(func(string) *QIconEngine)(cGoUnpackString(filename)))
 	}
 
@@ -15106,14 +15255,14 @@ func callbackQIconEnginePlugin_Create(ptr unsafe.Pointer, filename C.struct_QtGu
 func (ptr *QIconEnginePlugin) ConnectCreate(f func(filename string) *QIconEngine) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "create", f)
+		qt.ConnectSignal(ptr.Pointer(), "create", f)
 	}
 }
 
 func (ptr *QIconEnginePlugin) DisconnectCreate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "create")
+		qt.DisconnectSignal(ptr.Pointer(), "create")
 	}
 }
 
@@ -15128,7 +15277,7 @@ func (ptr *QIconEnginePlugin) Create(filename string) *QIconEngine {
 
 func NewQIconEnginePlugin(parent core.QObject_ITF) *QIconEnginePlugin {
 	var tmpValue = NewQIconEnginePluginFromPointer(C.QIconEnginePlugin_NewQIconEnginePlugin(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -15137,7 +15286,7 @@ func NewQIconEnginePlugin(parent core.QObject_ITF) *QIconEnginePlugin {
 func (ptr *QIconEnginePlugin) DestroyQIconEnginePlugin() {
 	if ptr.Pointer() != nil {
 		C.QIconEnginePlugin_DestroyQIconEnginePlugin(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15164,7 +15313,7 @@ func (ptr *QIconEnginePlugin) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QIconEnginePlugin) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QIconEnginePlugin___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -15185,7 +15334,7 @@ func (ptr *QIconEnginePlugin) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QIconEnginePlugin) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QIconEnginePlugin___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -15206,7 +15355,7 @@ func (ptr *QIconEnginePlugin) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QIconEnginePlugin) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QIconEnginePlugin___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -15227,7 +15376,7 @@ func (ptr *QIconEnginePlugin) __findChildren_newList() unsafe.Pointer {
 func (ptr *QIconEnginePlugin) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QIconEnginePlugin___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -15247,7 +15396,7 @@ func (ptr *QIconEnginePlugin) __children_newList() unsafe.Pointer {
 
 //export callbackQIconEnginePlugin_Event
 func callbackQIconEnginePlugin_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -15263,7 +15412,7 @@ func (ptr *QIconEnginePlugin) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQIconEnginePlugin_EventFilter
 func callbackQIconEnginePlugin_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -15279,7 +15428,7 @@ func (ptr *QIconEnginePlugin) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQIconEnginePlugin_ChildEvent
 func callbackQIconEnginePlugin_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQIconEnginePluginFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -15294,7 +15443,7 @@ func (ptr *QIconEnginePlugin) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQIconEnginePlugin_ConnectNotify
 func callbackQIconEnginePlugin_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQIconEnginePluginFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -15309,7 +15458,7 @@ func (ptr *QIconEnginePlugin) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQIconEnginePlugin_CustomEvent
 func callbackQIconEnginePlugin_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQIconEnginePluginFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -15324,7 +15473,7 @@ func (ptr *QIconEnginePlugin) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQIconEnginePlugin_DeleteLater
 func callbackQIconEnginePlugin_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQIconEnginePluginFromPointer(ptr).DeleteLaterDefault()
@@ -15334,14 +15483,14 @@ func callbackQIconEnginePlugin_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QIconEnginePlugin) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QIconEnginePlugin_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQIconEnginePlugin_Destroyed
 func callbackQIconEnginePlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -15349,7 +15498,7 @@ func callbackQIconEnginePlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQIconEnginePlugin_DisconnectNotify
 func callbackQIconEnginePlugin_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQIconEnginePluginFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -15364,7 +15513,7 @@ func (ptr *QIconEnginePlugin) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQIconEnginePlugin_ObjectNameChanged
 func callbackQIconEnginePlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -15372,7 +15521,7 @@ func callbackQIconEnginePlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQIconEnginePlugin_TimerEvent
 func callbackQIconEnginePlugin_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQIconEnginePluginFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -15387,7 +15536,7 @@ func (ptr *QIconEnginePlugin) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQIconEnginePlugin_MetaObject
 func callbackQIconEnginePlugin_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -15728,7 +15877,7 @@ func (ptr *QImage) Swap(other QImage_ITF) {
 func (ptr *QImage) DestroyQImage() {
 	if ptr.Pointer() != nil {
 		C.QImage_DestroyQImage(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -15922,7 +16071,7 @@ func (ptr *QImage) Text(key string) string {
 
 func (ptr *QImage) TextKeys() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QImage_TextKeys(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QImage_TextKeys(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -16103,7 +16252,7 @@ func (ptr *QImage) __colorTable_newList() unsafe.Pointer {
 
 //export callbackQImage_PaintEngine
 func callbackQImage_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return PointerFromQPaintEngine(signal.(func() *QPaintEngine)())
 	}
 
@@ -16210,7 +16359,7 @@ func NewQImageIOHandler() *QImageIOHandler {
 
 //export callbackQImageIOHandler_JumpToImage
 func callbackQImageIOHandler_JumpToImage(ptr unsafe.Pointer, imageNumber C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "jumpToImage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "jumpToImage"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(imageNumber))))))
 	}
 
@@ -16220,14 +16369,14 @@ func callbackQImageIOHandler_JumpToImage(ptr unsafe.Pointer, imageNumber C.int)
 func (ptr *QImageIOHandler) ConnectJumpToImage(f func(imageNumber int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "jumpToImage", f)
+		qt.ConnectSignal(ptr.Pointer(), "jumpToImage", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectJumpToImage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "jumpToImage")
+		qt.DisconnectSignal(ptr.Pointer(), "jumpToImage")
 	}
 }
 
@@ -16247,7 +16396,7 @@ func (ptr *QImageIOHandler) JumpToImageDefault(imageNumber int) bool {
 
 //export callbackQImageIOHandler_JumpToNextImage
 func callbackQImageIOHandler_JumpToNextImage(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "jumpToNextImage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "jumpToNextImage"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -16257,14 +16406,14 @@ func callbackQImageIOHandler_JumpToNextImage(ptr unsafe.Pointer) C.char {
 func (ptr *QImageIOHandler) ConnectJumpToNextImage(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "jumpToNextImage", f)
+		qt.ConnectSignal(ptr.Pointer(), "jumpToNextImage", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectJumpToNextImage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "jumpToNextImage")
+		qt.DisconnectSignal(ptr.Pointer(), "jumpToNextImage")
 	}
 }
 
@@ -16284,7 +16433,7 @@ func (ptr *QImageIOHandler) JumpToNextImageDefault() bool {
 
 //export callbackQImageIOHandler_Read
 func callbackQImageIOHandler_Read(ptr unsafe.Pointer, image unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "read"); signal != nil {
+	if signal := qt.GetSignal(ptr, "read"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QImage) bool)(NewQImageFromPointer(image)))))
 	}
 
@@ -16294,14 +16443,14 @@ func callbackQImageIOHandler_Read(ptr unsafe.Pointer, image unsafe.Pointer) C.ch
 func (ptr *QImageIOHandler) ConnectRead(f func(image *QImage) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "read", f)
+		qt.ConnectSignal(ptr.Pointer(), "read", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectRead() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "read")
+		qt.DisconnectSignal(ptr.Pointer(), "read")
 	}
 }
 
@@ -16314,7 +16463,7 @@ func (ptr *QImageIOHandler) Read(image QImage_ITF) bool {
 
 //export callbackQImageIOHandler_Write
 func callbackQImageIOHandler_Write(ptr unsafe.Pointer, image unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "write"); signal != nil {
+	if signal := qt.GetSignal(ptr, "write"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QImage) bool)(NewQImageFromPointer(image)))))
 	}
 
@@ -16324,14 +16473,14 @@ func callbackQImageIOHandler_Write(ptr unsafe.Pointer, image unsafe.Pointer) C.c
 func (ptr *QImageIOHandler) ConnectWrite(f func(image *QImage) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "write", f)
+		qt.ConnectSignal(ptr.Pointer(), "write", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectWrite() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "write")
+		qt.DisconnectSignal(ptr.Pointer(), "write")
 	}
 }
 
@@ -16363,7 +16512,7 @@ func (ptr *QImageIOHandler) SetFormat(format core.QByteArray_ITF) {
 
 //export callbackQImageIOHandler_SetOption
 func callbackQImageIOHandler_SetOption(ptr unsafe.Pointer, option C.longlong, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setOption"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setOption"); signal != nil {
 		signal.(func(QImageIOHandler__ImageOption, *core.QVariant))(QImageIOHandler__ImageOption(option), core.NewQVariantFromPointer(value))
 	} else {
 		NewQImageIOHandlerFromPointer(ptr).SetOptionDefault(QImageIOHandler__ImageOption(option), core.NewQVariantFromPointer(value))
@@ -16373,14 +16522,14 @@ func callbackQImageIOHandler_SetOption(ptr unsafe.Pointer, option C.longlong, va
 func (ptr *QImageIOHandler) ConnectSetOption(f func(option QImageIOHandler__ImageOption, value *core.QVariant)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setOption", f)
+		qt.ConnectSignal(ptr.Pointer(), "setOption", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectSetOption() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setOption")
+		qt.DisconnectSignal(ptr.Pointer(), "setOption")
 	}
 }
 
@@ -16398,7 +16547,7 @@ func (ptr *QImageIOHandler) SetOptionDefault(option QImageIOHandler__ImageOption
 
 //export callbackQImageIOHandler_DestroyQImageIOHandler
 func callbackQImageIOHandler_DestroyQImageIOHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QImageIOHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QImageIOHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQImageIOHandlerFromPointer(ptr).DestroyQImageIOHandlerDefault()
@@ -16408,21 +16557,21 @@ func callbackQImageIOHandler_DestroyQImageIOHandler(ptr unsafe.Pointer) {
 func (ptr *QImageIOHandler) ConnectDestroyQImageIOHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QImageIOHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QImageIOHandler", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectDestroyQImageIOHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QImageIOHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~QImageIOHandler")
 	}
 }
 
 func (ptr *QImageIOHandler) DestroyQImageIOHandler() {
 	if ptr.Pointer() != nil {
 		C.QImageIOHandler_DestroyQImageIOHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -16430,7 +16579,7 @@ func (ptr *QImageIOHandler) DestroyQImageIOHandler() {
 func (ptr *QImageIOHandler) DestroyQImageIOHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.QImageIOHandler_DestroyQImageIOHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -16447,7 +16596,7 @@ func (ptr *QImageIOHandler) Format() *core.QByteArray {
 func (ptr *QImageIOHandler) Device() *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QImageIOHandler_Device(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -16457,7 +16606,7 @@ func (ptr *QImageIOHandler) Device() *core.QIODevice {
 
 //export callbackQImageIOHandler_CurrentImageRect
 func callbackQImageIOHandler_CurrentImageRect(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentImageRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentImageRect"); signal != nil {
 		return core.PointerFromQRect(signal.(func() *core.QRect)())
 	}
 
@@ -16467,14 +16616,14 @@ func callbackQImageIOHandler_CurrentImageRect(ptr unsafe.Pointer) unsafe.Pointer
 func (ptr *QImageIOHandler) ConnectCurrentImageRect(f func() *core.QRect) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentImageRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentImageRect", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectCurrentImageRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentImageRect")
+		qt.DisconnectSignal(ptr.Pointer(), "currentImageRect")
 	}
 }
 
@@ -16498,7 +16647,7 @@ func (ptr *QImageIOHandler) CurrentImageRectDefault() *core.QRect {
 
 //export callbackQImageIOHandler_Option
 func callbackQImageIOHandler_Option(ptr unsafe.Pointer, option C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "option"); signal != nil {
+	if signal := qt.GetSignal(ptr, "option"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(QImageIOHandler__ImageOption) *core.QVariant)(QImageIOHandler__ImageOption(option)))
 	}
 
@@ -16508,14 +16657,14 @@ func callbackQImageIOHandler_Option(ptr unsafe.Pointer, option C.longlong) unsaf
 func (ptr *QImageIOHandler) ConnectOption(f func(option QImageIOHandler__ImageOption) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "option", f)
+		qt.ConnectSignal(ptr.Pointer(), "option", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectOption() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "option")
+		qt.DisconnectSignal(ptr.Pointer(), "option")
 	}
 }
 
@@ -16539,7 +16688,7 @@ func (ptr *QImageIOHandler) OptionDefault(option QImageIOHandler__ImageOption) *
 
 //export callbackQImageIOHandler_CanRead
 func callbackQImageIOHandler_CanRead(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canRead"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -16549,14 +16698,14 @@ func callbackQImageIOHandler_CanRead(ptr unsafe.Pointer) C.char {
 func (ptr *QImageIOHandler) ConnectCanRead(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "canRead", f)
+		qt.ConnectSignal(ptr.Pointer(), "canRead", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectCanRead() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "canRead")
+		qt.DisconnectSignal(ptr.Pointer(), "canRead")
 	}
 }
 
@@ -16569,7 +16718,7 @@ func (ptr *QImageIOHandler) CanRead() bool {
 
 //export callbackQImageIOHandler_SupportsOption
 func callbackQImageIOHandler_SupportsOption(ptr unsafe.Pointer, option C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportsOption"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportsOption"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(QImageIOHandler__ImageOption) bool)(QImageIOHandler__ImageOption(option)))))
 	}
 
@@ -16579,14 +16728,14 @@ func callbackQImageIOHandler_SupportsOption(ptr unsafe.Pointer, option C.longlon
 func (ptr *QImageIOHandler) ConnectSupportsOption(f func(option QImageIOHandler__ImageOption) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "supportsOption", f)
+		qt.ConnectSignal(ptr.Pointer(), "supportsOption", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectSupportsOption() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "supportsOption")
+		qt.DisconnectSignal(ptr.Pointer(), "supportsOption")
 	}
 }
 
@@ -16606,7 +16755,7 @@ func (ptr *QImageIOHandler) SupportsOptionDefault(option QImageIOHandler__ImageO
 
 //export callbackQImageIOHandler_CurrentImageNumber
 func callbackQImageIOHandler_CurrentImageNumber(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentImageNumber"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentImageNumber"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -16616,14 +16765,14 @@ func callbackQImageIOHandler_CurrentImageNumber(ptr unsafe.Pointer) C.int {
 func (ptr *QImageIOHandler) ConnectCurrentImageNumber(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentImageNumber", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentImageNumber", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectCurrentImageNumber() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentImageNumber")
+		qt.DisconnectSignal(ptr.Pointer(), "currentImageNumber")
 	}
 }
 
@@ -16643,7 +16792,7 @@ func (ptr *QImageIOHandler) CurrentImageNumberDefault() int {
 
 //export callbackQImageIOHandler_ImageCount
 func callbackQImageIOHandler_ImageCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "imageCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "imageCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -16653,14 +16802,14 @@ func callbackQImageIOHandler_ImageCount(ptr unsafe.Pointer) C.int {
 func (ptr *QImageIOHandler) ConnectImageCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "imageCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "imageCount", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectImageCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "imageCount")
+		qt.DisconnectSignal(ptr.Pointer(), "imageCount")
 	}
 }
 
@@ -16680,7 +16829,7 @@ func (ptr *QImageIOHandler) ImageCountDefault() int {
 
 //export callbackQImageIOHandler_LoopCount
 func callbackQImageIOHandler_LoopCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "loopCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "loopCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -16690,14 +16839,14 @@ func callbackQImageIOHandler_LoopCount(ptr unsafe.Pointer) C.int {
 func (ptr *QImageIOHandler) ConnectLoopCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "loopCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "loopCount", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectLoopCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "loopCount")
+		qt.DisconnectSignal(ptr.Pointer(), "loopCount")
 	}
 }
 
@@ -16717,7 +16866,7 @@ func (ptr *QImageIOHandler) LoopCountDefault() int {
 
 //export callbackQImageIOHandler_NextImageDelay
 func callbackQImageIOHandler_NextImageDelay(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nextImageDelay"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nextImageDelay"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -16727,14 +16876,14 @@ func callbackQImageIOHandler_NextImageDelay(ptr unsafe.Pointer) C.int {
 func (ptr *QImageIOHandler) ConnectNextImageDelay(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nextImageDelay", f)
+		qt.ConnectSignal(ptr.Pointer(), "nextImageDelay", f)
 	}
 }
 
 func (ptr *QImageIOHandler) DisconnectNextImageDelay() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nextImageDelay")
+		qt.DisconnectSignal(ptr.Pointer(), "nextImageDelay")
 	}
 }
 
@@ -16809,7 +16958,7 @@ const (
 
 func NewQImageIOPlugin(parent core.QObject_ITF) *QImageIOPlugin {
 	var tmpValue = NewQImageIOPluginFromPointer(C.QImageIOPlugin_NewQImageIOPlugin(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -16817,7 +16966,7 @@ func NewQImageIOPlugin(parent core.QObject_ITF) *QImageIOPlugin {
 
 //export callbackQImageIOPlugin_DestroyQImageIOPlugin
 func callbackQImageIOPlugin_DestroyQImageIOPlugin(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QImageIOPlugin"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QImageIOPlugin"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQImageIOPluginFromPointer(ptr).DestroyQImageIOPluginDefault()
@@ -16827,21 +16976,21 @@ func callbackQImageIOPlugin_DestroyQImageIOPlugin(ptr unsafe.Pointer) {
 func (ptr *QImageIOPlugin) ConnectDestroyQImageIOPlugin(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QImageIOPlugin", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QImageIOPlugin", f)
 	}
 }
 
 func (ptr *QImageIOPlugin) DisconnectDestroyQImageIOPlugin() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QImageIOPlugin")
+		qt.DisconnectSignal(ptr.Pointer(), "~QImageIOPlugin")
 	}
 }
 
 func (ptr *QImageIOPlugin) DestroyQImageIOPlugin() {
 	if ptr.Pointer() != nil {
 		C.QImageIOPlugin_DestroyQImageIOPlugin(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -16849,14 +16998,14 @@ func (ptr *QImageIOPlugin) DestroyQImageIOPlugin() {
 func (ptr *QImageIOPlugin) DestroyQImageIOPluginDefault() {
 	if ptr.Pointer() != nil {
 		C.QImageIOPlugin_DestroyQImageIOPluginDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQImageIOPlugin_Capabilities
 func callbackQImageIOPlugin_Capabilities(ptr unsafe.Pointer, device unsafe.Pointer, format unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "capabilities"); signal != nil {
+	if signal := qt.GetSignal(ptr, "capabilities"); signal != nil {
 		return C.longlong(signal.(func(*core.QIODevice, *core.QByteArray) QImageIOPlugin__Capability)(core.NewQIODeviceFromPointer(device), core.NewQByteArrayFromPointer(format)))
 	}
 
@@ -16866,14 +17015,14 @@ func callbackQImageIOPlugin_Capabilities(ptr unsafe.Pointer, device unsafe.Point
 func (ptr *QImageIOPlugin) ConnectCapabilities(f func(device *core.QIODevice, format *core.QByteArray) QImageIOPlugin__Capability) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "capabilities", f)
+		qt.ConnectSignal(ptr.Pointer(), "capabilities", f)
 	}
 }
 
 func (ptr *QImageIOPlugin) DisconnectCapabilities() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "capabilities")
+		qt.DisconnectSignal(ptr.Pointer(), "capabilities")
 	}
 }
 
@@ -16886,7 +17035,7 @@ func (ptr *QImageIOPlugin) Capabilities(device core.QIODevice_ITF, format core.Q
 
 //export callbackQImageIOPlugin_Create
 func callbackQImageIOPlugin_Create(ptr unsafe.Pointer, device unsafe.Pointer, format unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "create"); signal != nil {
+	if signal := qt.GetSignal(ptr, "create"); signal != nil {
 		return PointerFromQImageIOHandler(signal.(func(*core.QIODevice, *core.QByteArray) *QImageIOHandler)(core.NewQIODeviceFromPointer(device), core.NewQByteArrayFromPointer(format)))
 	}
 
@@ -16896,14 +17045,14 @@ func callbackQImageIOPlugin_Create(ptr unsafe.Pointer, device unsafe.Pointer, fo
 func (ptr *QImageIOPlugin) ConnectCreate(f func(device *core.QIODevice, format *core.QByteArray) *QImageIOHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "create", f)
+		qt.ConnectSignal(ptr.Pointer(), "create", f)
 	}
 }
 
 func (ptr *QImageIOPlugin) DisconnectCreate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "create")
+		qt.DisconnectSignal(ptr.Pointer(), "create")
 	}
 }
 
@@ -16936,7 +17085,7 @@ func (ptr *QImageIOPlugin) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QImageIOPlugin) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QImageIOPlugin___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -16957,7 +17106,7 @@ func (ptr *QImageIOPlugin) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QImageIOPlugin) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QImageIOPlugin___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -16978,7 +17127,7 @@ func (ptr *QImageIOPlugin) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QImageIOPlugin) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QImageIOPlugin___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -16999,7 +17148,7 @@ func (ptr *QImageIOPlugin) __findChildren_newList() unsafe.Pointer {
 func (ptr *QImageIOPlugin) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QImageIOPlugin___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -17019,7 +17168,7 @@ func (ptr *QImageIOPlugin) __children_newList() unsafe.Pointer {
 
 //export callbackQImageIOPlugin_Event
 func callbackQImageIOPlugin_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -17035,7 +17184,7 @@ func (ptr *QImageIOPlugin) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQImageIOPlugin_EventFilter
 func callbackQImageIOPlugin_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -17051,7 +17200,7 @@ func (ptr *QImageIOPlugin) EventFilterDefault(watched core.QObject_ITF, event co
 
 //export callbackQImageIOPlugin_ChildEvent
 func callbackQImageIOPlugin_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQImageIOPluginFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -17066,7 +17215,7 @@ func (ptr *QImageIOPlugin) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQImageIOPlugin_ConnectNotify
 func callbackQImageIOPlugin_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQImageIOPluginFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -17081,7 +17230,7 @@ func (ptr *QImageIOPlugin) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQImageIOPlugin_CustomEvent
 func callbackQImageIOPlugin_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQImageIOPluginFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -17096,7 +17245,7 @@ func (ptr *QImageIOPlugin) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQImageIOPlugin_DeleteLater
 func callbackQImageIOPlugin_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQImageIOPluginFromPointer(ptr).DeleteLaterDefault()
@@ -17106,14 +17255,14 @@ func callbackQImageIOPlugin_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QImageIOPlugin) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QImageIOPlugin_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQImageIOPlugin_Destroyed
 func callbackQImageIOPlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -17121,7 +17270,7 @@ func callbackQImageIOPlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQImageIOPlugin_DisconnectNotify
 func callbackQImageIOPlugin_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQImageIOPluginFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -17136,7 +17285,7 @@ func (ptr *QImageIOPlugin) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQImageIOPlugin_ObjectNameChanged
 func callbackQImageIOPlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -17144,7 +17293,7 @@ func callbackQImageIOPlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName C.s
 
 //export callbackQImageIOPlugin_TimerEvent
 func callbackQImageIOPlugin_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQImageIOPluginFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -17159,7 +17308,7 @@ func (ptr *QImageIOPlugin) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQImageIOPlugin_MetaObject
 func callbackQImageIOPlugin_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -17281,43 +17430,43 @@ func NewQImageReader3(fileName string, format core.QByteArray_ITF) *QImageReader
 }
 
 func QImageReader_SupportedImageFormats() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQImageReaderFromPointer(l.data).__supportedImageFormats_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QImageReader_QImageReader_SupportedImageFormats())
+	}(cGoUnpackStringListAndFree(C.QImageReader_QImageReader_SupportedImageFormats()))
 }
 
 func (ptr *QImageReader) SupportedImageFormats() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQImageReaderFromPointer(l.data).__supportedImageFormats_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QImageReader_QImageReader_SupportedImageFormats())
+	}(cGoUnpackStringListAndFree(C.QImageReader_QImageReader_SupportedImageFormats()))
 }
 
 func QImageReader_SupportedMimeTypes() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQImageReaderFromPointer(l.data).__supportedMimeTypes_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QImageReader_QImageReader_SupportedMimeTypes())
+	}(cGoUnpackStringListAndFree(C.QImageReader_QImageReader_SupportedMimeTypes()))
 }
 
 func (ptr *QImageReader) SupportedMimeTypes() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQImageReaderFromPointer(l.data).__supportedMimeTypes_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QImageReader_QImageReader_SupportedMimeTypes())
+	}(cGoUnpackStringListAndFree(C.QImageReader_QImageReader_SupportedMimeTypes()))
 }
 
 func (ptr *QImageReader) JumpToImage(imageNumber int) bool {
@@ -17459,7 +17608,7 @@ func (ptr *QImageReader) BackgroundColor() *QColor {
 func (ptr *QImageReader) Device() *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QImageReader_Device(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -17483,13 +17632,13 @@ func (ptr *QImageReader) Transformation() QImageIOHandler__Transformation {
 
 func (ptr *QImageReader) SupportedSubTypes() []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQImageReaderFromPointer(l.data).__supportedSubTypes_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QImageReader_SupportedSubTypes(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QImageReader_SupportedSubTypes(ptr.Pointer())))
 	}
 	return make([]*core.QByteArray, 0)
 }
@@ -17564,7 +17713,7 @@ func (ptr *QImageReader) Text(key string) string {
 
 func (ptr *QImageReader) TextKeys() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QImageReader_TextKeys(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QImageReader_TextKeys(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -17779,43 +17928,43 @@ func NewQImageWriter3(fileName string, format core.QByteArray_ITF) *QImageWriter
 }
 
 func QImageWriter_SupportedImageFormats() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQImageWriterFromPointer(l.data).__supportedImageFormats_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QImageWriter_QImageWriter_SupportedImageFormats())
+	}(cGoUnpackStringListAndFree(C.QImageWriter_QImageWriter_SupportedImageFormats()))
 }
 
 func (ptr *QImageWriter) SupportedImageFormats() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQImageWriterFromPointer(l.data).__supportedImageFormats_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QImageWriter_QImageWriter_SupportedImageFormats())
+	}(cGoUnpackStringListAndFree(C.QImageWriter_QImageWriter_SupportedImageFormats()))
 }
 
 func QImageWriter_SupportedMimeTypes() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQImageWriterFromPointer(l.data).__supportedMimeTypes_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QImageWriter_QImageWriter_SupportedMimeTypes())
+	}(cGoUnpackStringListAndFree(C.QImageWriter_QImageWriter_SupportedMimeTypes()))
 }
 
 func (ptr *QImageWriter) SupportedMimeTypes() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQImageWriterFromPointer(l.data).__supportedMimeTypes_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QImageWriter_QImageWriter_SupportedMimeTypes())
+	}(cGoUnpackStringListAndFree(C.QImageWriter_QImageWriter_SupportedMimeTypes()))
 }
 
 func (ptr *QImageWriter) Write(image QImage_ITF) bool {
@@ -17932,7 +18081,7 @@ func (ptr *QImageWriter) SubType() *core.QByteArray {
 func (ptr *QImageWriter) Device() *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QImageWriter_Device(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -17949,13 +18098,13 @@ func (ptr *QImageWriter) Transformation() QImageIOHandler__Transformation {
 
 func (ptr *QImageWriter) SupportedSubTypes() []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQImageWriterFromPointer(l.data).__supportedSubTypes_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QImageWriter_SupportedSubTypes(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QImageWriter_SupportedSubTypes(ptr.Pointer())))
 	}
 	return make([]*core.QByteArray, 0)
 }
@@ -18122,7 +18271,7 @@ func NewQInputEventFromPointer(ptr unsafe.Pointer) *QInputEvent {
 func (ptr *QInputEvent) DestroyQInputEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -18209,7 +18358,7 @@ func NewQInputMethodFromPointer(ptr unsafe.Pointer) *QInputMethod {
 func (ptr *QInputMethod) DestroyQInputMethod() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -18237,7 +18386,7 @@ func (ptr *QInputMethod) QueryFocusObject(query core.Qt__InputMethodQuery, argum
 
 //export callbackQInputMethod_AnchorRectangleChanged
 func callbackQInputMethod_AnchorRectangleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "anchorRectangleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "anchorRectangleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -18246,14 +18395,14 @@ func callbackQInputMethod_AnchorRectangleChanged(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectAnchorRectangleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_ConnectAnchorRectangleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "anchorRectangleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "anchorRectangleChanged", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectAnchorRectangleChanged() {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_DisconnectAnchorRectangleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "anchorRectangleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "anchorRectangleChanged")
 	}
 }
 
@@ -18265,7 +18414,7 @@ func (ptr *QInputMethod) AnchorRectangleChanged() {
 
 //export callbackQInputMethod_AnimatingChanged
 func callbackQInputMethod_AnimatingChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "animatingChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "animatingChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -18274,14 +18423,14 @@ func callbackQInputMethod_AnimatingChanged(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectAnimatingChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_ConnectAnimatingChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "animatingChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "animatingChanged", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectAnimatingChanged() {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_DisconnectAnimatingChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "animatingChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "animatingChanged")
 	}
 }
 
@@ -18293,7 +18442,7 @@ func (ptr *QInputMethod) AnimatingChanged() {
 
 //export callbackQInputMethod_Commit
 func callbackQInputMethod_Commit(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "commit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "commit"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQInputMethodFromPointer(ptr).CommitDefault()
@@ -18303,14 +18452,14 @@ func callbackQInputMethod_Commit(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectCommit(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "commit", f)
+		qt.ConnectSignal(ptr.Pointer(), "commit", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectCommit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "commit")
+		qt.DisconnectSignal(ptr.Pointer(), "commit")
 	}
 }
 
@@ -18328,7 +18477,7 @@ func (ptr *QInputMethod) CommitDefault() {
 
 //export callbackQInputMethod_CursorRectangleChanged
 func callbackQInputMethod_CursorRectangleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cursorRectangleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cursorRectangleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -18337,14 +18486,14 @@ func callbackQInputMethod_CursorRectangleChanged(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectCursorRectangleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_ConnectCursorRectangleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cursorRectangleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "cursorRectangleChanged", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectCursorRectangleChanged() {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_DisconnectCursorRectangleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cursorRectangleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "cursorRectangleChanged")
 	}
 }
 
@@ -18356,7 +18505,7 @@ func (ptr *QInputMethod) CursorRectangleChanged() {
 
 //export callbackQInputMethod_Hide
 func callbackQInputMethod_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQInputMethodFromPointer(ptr).HideDefault()
@@ -18366,14 +18515,14 @@ func callbackQInputMethod_Hide(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectHide(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hide", f)
+		qt.ConnectSignal(ptr.Pointer(), "hide", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectHide() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hide")
+		qt.DisconnectSignal(ptr.Pointer(), "hide")
 	}
 }
 
@@ -18391,7 +18540,7 @@ func (ptr *QInputMethod) HideDefault() {
 
 //export callbackQInputMethod_InputDirectionChanged
 func callbackQInputMethod_InputDirectionChanged(ptr unsafe.Pointer, newDirection C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputDirectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputDirectionChanged"); signal != nil {
 		signal.(func(core.Qt__LayoutDirection))(core.Qt__LayoutDirection(newDirection))
 	}
 
@@ -18400,14 +18549,14 @@ func callbackQInputMethod_InputDirectionChanged(ptr unsafe.Pointer, newDirection
 func (ptr *QInputMethod) ConnectInputDirectionChanged(f func(newDirection core.Qt__LayoutDirection)) {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_ConnectInputDirectionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "inputDirectionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "inputDirectionChanged", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectInputDirectionChanged() {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_DisconnectInputDirectionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "inputDirectionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "inputDirectionChanged")
 	}
 }
 
@@ -18419,7 +18568,7 @@ func (ptr *QInputMethod) InputDirectionChanged(newDirection core.Qt__LayoutDirec
 
 //export callbackQInputMethod_InputItemClipRectangleChanged
 func callbackQInputMethod_InputItemClipRectangleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputItemClipRectangleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputItemClipRectangleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -18428,14 +18577,14 @@ func callbackQInputMethod_InputItemClipRectangleChanged(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectInputItemClipRectangleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_ConnectInputItemClipRectangleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "inputItemClipRectangleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "inputItemClipRectangleChanged", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectInputItemClipRectangleChanged() {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_DisconnectInputItemClipRectangleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "inputItemClipRectangleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "inputItemClipRectangleChanged")
 	}
 }
 
@@ -18447,7 +18596,7 @@ func (ptr *QInputMethod) InputItemClipRectangleChanged() {
 
 //export callbackQInputMethod_InvokeAction
 func callbackQInputMethod_InvokeAction(ptr unsafe.Pointer, a C.longlong, cursorPosition C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "invokeAction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "invokeAction"); signal != nil {
 		signal.(func(QInputMethod__Action, int))(QInputMethod__Action(a), int(int32(cursorPosition)))
 	} else {
 		NewQInputMethodFromPointer(ptr).InvokeActionDefault(QInputMethod__Action(a), int(int32(cursorPosition)))
@@ -18457,14 +18606,14 @@ func callbackQInputMethod_InvokeAction(ptr unsafe.Pointer, a C.longlong, cursorP
 func (ptr *QInputMethod) ConnectInvokeAction(f func(a QInputMethod__Action, cursorPosition int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "invokeAction", f)
+		qt.ConnectSignal(ptr.Pointer(), "invokeAction", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectInvokeAction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "invokeAction")
+		qt.DisconnectSignal(ptr.Pointer(), "invokeAction")
 	}
 }
 
@@ -18482,7 +18631,7 @@ func (ptr *QInputMethod) InvokeActionDefault(a QInputMethod__Action, cursorPosit
 
 //export callbackQInputMethod_KeyboardRectangleChanged
 func callbackQInputMethod_KeyboardRectangleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyboardRectangleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyboardRectangleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -18491,14 +18640,14 @@ func callbackQInputMethod_KeyboardRectangleChanged(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectKeyboardRectangleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_ConnectKeyboardRectangleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "keyboardRectangleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "keyboardRectangleChanged", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectKeyboardRectangleChanged() {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_DisconnectKeyboardRectangleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "keyboardRectangleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "keyboardRectangleChanged")
 	}
 }
 
@@ -18510,7 +18659,7 @@ func (ptr *QInputMethod) KeyboardRectangleChanged() {
 
 //export callbackQInputMethod_LocaleChanged
 func callbackQInputMethod_LocaleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "localeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "localeChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -18519,14 +18668,14 @@ func callbackQInputMethod_LocaleChanged(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectLocaleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_ConnectLocaleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "localeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "localeChanged", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectLocaleChanged() {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_DisconnectLocaleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "localeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "localeChanged")
 	}
 }
 
@@ -18538,7 +18687,7 @@ func (ptr *QInputMethod) LocaleChanged() {
 
 //export callbackQInputMethod_Reset
 func callbackQInputMethod_Reset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQInputMethodFromPointer(ptr).ResetDefault()
@@ -18548,14 +18697,14 @@ func callbackQInputMethod_Reset(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectReset(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reset", f)
+		qt.ConnectSignal(ptr.Pointer(), "reset", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectReset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reset")
+		qt.DisconnectSignal(ptr.Pointer(), "reset")
 	}
 }
 
@@ -18591,7 +18740,7 @@ func (ptr *QInputMethod) SetVisible(visible bool) {
 
 //export callbackQInputMethod_Show
 func callbackQInputMethod_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQInputMethodFromPointer(ptr).ShowDefault()
@@ -18601,14 +18750,14 @@ func callbackQInputMethod_Show(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectShow(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "show", f)
+		qt.ConnectSignal(ptr.Pointer(), "show", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectShow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "show")
+		qt.DisconnectSignal(ptr.Pointer(), "show")
 	}
 }
 
@@ -18626,7 +18775,7 @@ func (ptr *QInputMethod) ShowDefault() {
 
 //export callbackQInputMethod_Update
 func callbackQInputMethod_Update(ptr unsafe.Pointer, queries C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func(core.Qt__InputMethodQuery))(core.Qt__InputMethodQuery(queries))
 	} else {
 		NewQInputMethodFromPointer(ptr).UpdateDefault(core.Qt__InputMethodQuery(queries))
@@ -18636,14 +18785,14 @@ func callbackQInputMethod_Update(ptr unsafe.Pointer, queries C.longlong) {
 func (ptr *QInputMethod) ConnectUpdate(f func(queries core.Qt__InputMethodQuery)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "update", f)
+		qt.ConnectSignal(ptr.Pointer(), "update", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectUpdate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "update")
+		qt.DisconnectSignal(ptr.Pointer(), "update")
 	}
 }
 
@@ -18661,7 +18810,7 @@ func (ptr *QInputMethod) UpdateDefault(queries core.Qt__InputMethodQuery) {
 
 //export callbackQInputMethod_VisibleChanged
 func callbackQInputMethod_VisibleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -18670,14 +18819,14 @@ func callbackQInputMethod_VisibleChanged(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) ConnectVisibleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_ConnectVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "visibleChanged", f)
 	}
 }
 
 func (ptr *QInputMethod) DisconnectVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_DisconnectVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "visibleChanged")
 	}
 }
 
@@ -18793,7 +18942,7 @@ func (ptr *QInputMethod) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QInputMethod) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInputMethod___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -18814,7 +18963,7 @@ func (ptr *QInputMethod) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QInputMethod) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInputMethod___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -18835,7 +18984,7 @@ func (ptr *QInputMethod) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QInputMethod) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInputMethod___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -18856,7 +19005,7 @@ func (ptr *QInputMethod) __findChildren_newList() unsafe.Pointer {
 func (ptr *QInputMethod) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInputMethod___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -18876,7 +19025,7 @@ func (ptr *QInputMethod) __children_newList() unsafe.Pointer {
 
 //export callbackQInputMethod_Event
 func callbackQInputMethod_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -18892,7 +19041,7 @@ func (ptr *QInputMethod) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQInputMethod_EventFilter
 func callbackQInputMethod_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -18908,7 +19057,7 @@ func (ptr *QInputMethod) EventFilterDefault(watched core.QObject_ITF, event core
 
 //export callbackQInputMethod_ChildEvent
 func callbackQInputMethod_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQInputMethodFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -18923,7 +19072,7 @@ func (ptr *QInputMethod) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQInputMethod_ConnectNotify
 func callbackQInputMethod_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQInputMethodFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -18938,7 +19087,7 @@ func (ptr *QInputMethod) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQInputMethod_CustomEvent
 func callbackQInputMethod_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQInputMethodFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -18953,7 +19102,7 @@ func (ptr *QInputMethod) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQInputMethod_DeleteLater
 func callbackQInputMethod_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQInputMethodFromPointer(ptr).DeleteLaterDefault()
@@ -18963,14 +19112,14 @@ func callbackQInputMethod_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QInputMethod) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QInputMethod_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQInputMethod_Destroyed
 func callbackQInputMethod_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -18978,7 +19127,7 @@ func callbackQInputMethod_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQInputMethod_DisconnectNotify
 func callbackQInputMethod_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQInputMethodFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -18993,7 +19142,7 @@ func (ptr *QInputMethod) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQInputMethod_ObjectNameChanged
 func callbackQInputMethod_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -19001,7 +19150,7 @@ func callbackQInputMethod_ObjectNameChanged(ptr unsafe.Pointer, objectName C.str
 
 //export callbackQInputMethod_TimerEvent
 func callbackQInputMethod_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQInputMethodFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -19016,7 +19165,7 @@ func (ptr *QInputMethod) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQInputMethod_MetaObject
 func callbackQInputMethod_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -19096,7 +19245,7 @@ func (ptr *QInputMethodEvent) SetCommitString(commitString string, replaceFrom i
 func (ptr *QInputMethodEvent) DestroyQInputMethodEvent() {
 	if ptr.Pointer() != nil {
 		C.QInputMethodEvent_DestroyQInputMethodEvent(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -19175,7 +19324,7 @@ func NewQInputMethodQueryEventFromPointer(ptr unsafe.Pointer) *QInputMethodQuery
 func (ptr *QInputMethodQueryEvent) DestroyQInputMethodQueryEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -19246,7 +19395,7 @@ func NewQIntValidatorFromPointer(ptr unsafe.Pointer) *QIntValidator {
 }
 func NewQIntValidator(parent core.QObject_ITF) *QIntValidator {
 	var tmpValue = NewQIntValidatorFromPointer(C.QIntValidator_NewQIntValidator(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -19254,7 +19403,7 @@ func NewQIntValidator(parent core.QObject_ITF) *QIntValidator {
 
 func NewQIntValidator2(minimum int, maximum int, parent core.QObject_ITF) *QIntValidator {
 	var tmpValue = NewQIntValidatorFromPointer(C.QIntValidator_NewQIntValidator2(C.int(int32(minimum)), C.int(int32(maximum)), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -19268,7 +19417,7 @@ func (ptr *QIntValidator) SetBottom(vin int) {
 
 //export callbackQIntValidator_SetRange
 func callbackQIntValidator_SetRange(ptr unsafe.Pointer, bottom C.int, top C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRange"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRange"); signal != nil {
 		signal.(func(int, int))(int(int32(bottom)), int(int32(top)))
 	} else {
 		NewQIntValidatorFromPointer(ptr).SetRangeDefault(int(int32(bottom)), int(int32(top)))
@@ -19278,14 +19427,14 @@ func callbackQIntValidator_SetRange(ptr unsafe.Pointer, bottom C.int, top C.int)
 func (ptr *QIntValidator) ConnectSetRange(f func(bottom int, top int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setRange", f)
+		qt.ConnectSignal(ptr.Pointer(), "setRange", f)
 	}
 }
 
 func (ptr *QIntValidator) DisconnectSetRange() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setRange")
+		qt.DisconnectSignal(ptr.Pointer(), "setRange")
 	}
 }
 
@@ -19310,14 +19459,14 @@ func (ptr *QIntValidator) SetTop(vin int) {
 func (ptr *QIntValidator) DestroyQIntValidator() {
 	if ptr.Pointer() != nil {
 		C.QIntValidator_DestroyQIntValidator(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQIntValidator_Validate
 func callbackQIntValidator_Validate(ptr unsafe.Pointer, input C.struct_QtGui_PackedString, pos C.int) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "validate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "validate"); signal != nil {
 		return C.longlong(signal.(func(string, int) QValidator__State)(cGoUnpackString(input), int(int32(pos))))
 	}
 
@@ -19327,14 +19476,14 @@ func callbackQIntValidator_Validate(ptr unsafe.Pointer, input C.struct_QtGui_Pac
 func (ptr *QIntValidator) ConnectValidate(f func(input string, pos int) QValidator__State) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "validate", f)
+		qt.ConnectSignal(ptr.Pointer(), "validate", f)
 	}
 }
 
 func (ptr *QIntValidator) DisconnectValidate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "validate")
+		qt.DisconnectSignal(ptr.Pointer(), "validate")
 	}
 }
 
@@ -19412,7 +19561,7 @@ func NewQKeyEventFromPointer(ptr unsafe.Pointer) *QKeyEvent {
 func (ptr *QKeyEvent) DestroyQKeyEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -20446,7 +20595,7 @@ func NewQMouseEventFromPointer(ptr unsafe.Pointer) *QMouseEvent {
 func (ptr *QMouseEvent) DestroyQMouseEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -20658,7 +20807,7 @@ func NewQMoveEventFromPointer(ptr unsafe.Pointer) *QMoveEvent {
 func (ptr *QMoveEvent) DestroyQMoveEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -20740,28 +20889,28 @@ const (
 )
 
 func QMovie_SupportedFormats() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQMovieFromPointer(l.data).__supportedFormats_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QMovie_QMovie_SupportedFormats())
+	}(cGoUnpackStringListAndFree(C.QMovie_QMovie_SupportedFormats()))
 }
 
 func (ptr *QMovie) SupportedFormats() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQMovieFromPointer(l.data).__supportedFormats_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QMovie_QMovie_SupportedFormats())
+	}(cGoUnpackStringListAndFree(C.QMovie_QMovie_SupportedFormats()))
 }
 
 func NewQMovie2(device core.QIODevice_ITF, format core.QByteArray_ITF, parent core.QObject_ITF) *QMovie {
 	var tmpValue = NewQMovieFromPointer(C.QMovie_NewQMovie2(core.PointerFromQIODevice(device), core.PointerFromQByteArray(format), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -20769,7 +20918,7 @@ func NewQMovie2(device core.QIODevice_ITF, format core.QByteArray_ITF, parent co
 
 func NewQMovie(parent core.QObject_ITF) *QMovie {
 	var tmpValue = NewQMovieFromPointer(C.QMovie_NewQMovie(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -20779,7 +20928,7 @@ func NewQMovie3(fileName string, format core.QByteArray_ITF, parent core.QObject
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQMovieFromPointer(C.QMovie_NewQMovie3(fileNameC, core.PointerFromQByteArray(format), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -20803,7 +20952,7 @@ func (ptr *QMovie) JumpToFrame(frameNumber int) bool {
 
 //export callbackQMovie_JumpToNextFrame
 func callbackQMovie_JumpToNextFrame(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "jumpToNextFrame"); signal != nil {
+	if signal := qt.GetSignal(ptr, "jumpToNextFrame"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -20813,14 +20962,14 @@ func callbackQMovie_JumpToNextFrame(ptr unsafe.Pointer) C.char {
 func (ptr *QMovie) ConnectJumpToNextFrame(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "jumpToNextFrame", f)
+		qt.ConnectSignal(ptr.Pointer(), "jumpToNextFrame", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectJumpToNextFrame() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "jumpToNextFrame")
+		qt.DisconnectSignal(ptr.Pointer(), "jumpToNextFrame")
 	}
 }
 
@@ -20840,7 +20989,7 @@ func (ptr *QMovie) JumpToNextFrameDefault() bool {
 
 //export callbackQMovie_Error
 func callbackQMovie_Error(ptr unsafe.Pointer, error C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "error"); signal != nil {
+	if signal := qt.GetSignal(ptr, "error"); signal != nil {
 		signal.(func(QImageReader__ImageReaderError))(QImageReader__ImageReaderError(error))
 	}
 
@@ -20849,14 +20998,14 @@ func callbackQMovie_Error(ptr unsafe.Pointer, error C.longlong) {
 func (ptr *QMovie) ConnectError(f func(error QImageReader__ImageReaderError)) {
 	if ptr.Pointer() != nil {
 		C.QMovie_ConnectError(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "error", f)
+		qt.ConnectSignal(ptr.Pointer(), "error", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectError() {
 	if ptr.Pointer() != nil {
 		C.QMovie_DisconnectError(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "error")
+		qt.DisconnectSignal(ptr.Pointer(), "error")
 	}
 }
 
@@ -20868,7 +21017,7 @@ func (ptr *QMovie) Error(error QImageReader__ImageReaderError) {
 
 //export callbackQMovie_Finished
 func callbackQMovie_Finished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -20877,14 +21026,14 @@ func callbackQMovie_Finished(ptr unsafe.Pointer) {
 func (ptr *QMovie) ConnectFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QMovie_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QMovie_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
@@ -20896,7 +21045,7 @@ func (ptr *QMovie) Finished() {
 
 //export callbackQMovie_FrameChanged
 func callbackQMovie_FrameChanged(ptr unsafe.Pointer, frameNumber C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "frameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "frameChanged"); signal != nil {
 		signal.(func(int))(int(int32(frameNumber)))
 	}
 
@@ -20905,14 +21054,14 @@ func callbackQMovie_FrameChanged(ptr unsafe.Pointer, frameNumber C.int) {
 func (ptr *QMovie) ConnectFrameChanged(f func(frameNumber int)) {
 	if ptr.Pointer() != nil {
 		C.QMovie_ConnectFrameChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "frameChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "frameChanged", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectFrameChanged() {
 	if ptr.Pointer() != nil {
 		C.QMovie_DisconnectFrameChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "frameChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "frameChanged")
 	}
 }
 
@@ -20924,7 +21073,7 @@ func (ptr *QMovie) FrameChanged(frameNumber int) {
 
 //export callbackQMovie_Resized
 func callbackQMovie_Resized(ptr unsafe.Pointer, size unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resized"); signal != nil {
 		signal.(func(*core.QSize))(core.NewQSizeFromPointer(size))
 	}
 
@@ -20933,14 +21082,14 @@ func callbackQMovie_Resized(ptr unsafe.Pointer, size unsafe.Pointer) {
 func (ptr *QMovie) ConnectResized(f func(size *core.QSize)) {
 	if ptr.Pointer() != nil {
 		C.QMovie_ConnectResized(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resized", f)
+		qt.ConnectSignal(ptr.Pointer(), "resized", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectResized() {
 	if ptr.Pointer() != nil {
 		C.QMovie_DisconnectResized(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resized")
+		qt.DisconnectSignal(ptr.Pointer(), "resized")
 	}
 }
 
@@ -20984,7 +21133,7 @@ func (ptr *QMovie) SetFormat(format core.QByteArray_ITF) {
 
 //export callbackQMovie_SetPaused
 func callbackQMovie_SetPaused(ptr unsafe.Pointer, paused C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPaused"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPaused"); signal != nil {
 		signal.(func(bool))(int8(paused) != 0)
 	} else {
 		NewQMovieFromPointer(ptr).SetPausedDefault(int8(paused) != 0)
@@ -20994,14 +21143,14 @@ func callbackQMovie_SetPaused(ptr unsafe.Pointer, paused C.char) {
 func (ptr *QMovie) ConnectSetPaused(f func(paused bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPaused", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPaused", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectSetPaused() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPaused")
+		qt.DisconnectSignal(ptr.Pointer(), "setPaused")
 	}
 }
 
@@ -21025,7 +21174,7 @@ func (ptr *QMovie) SetScaledSize(size core.QSize_ITF) {
 
 //export callbackQMovie_SetSpeed
 func callbackQMovie_SetSpeed(ptr unsafe.Pointer, percentSpeed C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSpeed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSpeed"); signal != nil {
 		signal.(func(int))(int(int32(percentSpeed)))
 	} else {
 		NewQMovieFromPointer(ptr).SetSpeedDefault(int(int32(percentSpeed)))
@@ -21035,14 +21184,14 @@ func callbackQMovie_SetSpeed(ptr unsafe.Pointer, percentSpeed C.int) {
 func (ptr *QMovie) ConnectSetSpeed(f func(percentSpeed int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSpeed", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSpeed", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectSetSpeed() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSpeed")
+		qt.DisconnectSignal(ptr.Pointer(), "setSpeed")
 	}
 }
 
@@ -21060,7 +21209,7 @@ func (ptr *QMovie) SetSpeedDefault(percentSpeed int) {
 
 //export callbackQMovie_Start
 func callbackQMovie_Start(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQMovieFromPointer(ptr).StartDefault()
@@ -21070,14 +21219,14 @@ func callbackQMovie_Start(ptr unsafe.Pointer) {
 func (ptr *QMovie) ConnectStart(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -21095,7 +21244,7 @@ func (ptr *QMovie) StartDefault() {
 
 //export callbackQMovie_Started
 func callbackQMovie_Started(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "started"); signal != nil {
+	if signal := qt.GetSignal(ptr, "started"); signal != nil {
 		signal.(func())()
 	}
 
@@ -21104,14 +21253,14 @@ func callbackQMovie_Started(ptr unsafe.Pointer) {
 func (ptr *QMovie) ConnectStarted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QMovie_ConnectStarted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "started", f)
+		qt.ConnectSignal(ptr.Pointer(), "started", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectStarted() {
 	if ptr.Pointer() != nil {
 		C.QMovie_DisconnectStarted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "started")
+		qt.DisconnectSignal(ptr.Pointer(), "started")
 	}
 }
 
@@ -21123,7 +21272,7 @@ func (ptr *QMovie) Started() {
 
 //export callbackQMovie_StateChanged
 func callbackQMovie_StateChanged(ptr unsafe.Pointer, state C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stateChanged"); signal != nil {
 		signal.(func(QMovie__MovieState))(QMovie__MovieState(state))
 	}
 
@@ -21132,14 +21281,14 @@ func callbackQMovie_StateChanged(ptr unsafe.Pointer, state C.longlong) {
 func (ptr *QMovie) ConnectStateChanged(f func(state QMovie__MovieState)) {
 	if ptr.Pointer() != nil {
 		C.QMovie_ConnectStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "stateChanged", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QMovie_DisconnectStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "stateChanged")
 	}
 }
 
@@ -21151,7 +21300,7 @@ func (ptr *QMovie) StateChanged(state QMovie__MovieState) {
 
 //export callbackQMovie_Stop
 func callbackQMovie_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQMovieFromPointer(ptr).StopDefault()
@@ -21161,14 +21310,14 @@ func callbackQMovie_Stop(ptr unsafe.Pointer) {
 func (ptr *QMovie) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -21186,7 +21335,7 @@ func (ptr *QMovie) StopDefault() {
 
 //export callbackQMovie_Updated
 func callbackQMovie_Updated(ptr unsafe.Pointer, rect unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updated"); signal != nil {
 		signal.(func(*core.QRect))(core.NewQRectFromPointer(rect))
 	}
 
@@ -21195,14 +21344,14 @@ func callbackQMovie_Updated(ptr unsafe.Pointer, rect unsafe.Pointer) {
 func (ptr *QMovie) ConnectUpdated(f func(rect *core.QRect)) {
 	if ptr.Pointer() != nil {
 		C.QMovie_ConnectUpdated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updated", f)
+		qt.ConnectSignal(ptr.Pointer(), "updated", f)
 	}
 }
 
 func (ptr *QMovie) DisconnectUpdated() {
 	if ptr.Pointer() != nil {
 		C.QMovie_DisconnectUpdated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updated")
+		qt.DisconnectSignal(ptr.Pointer(), "updated")
 	}
 }
 
@@ -21215,7 +21364,7 @@ func (ptr *QMovie) Updated(rect core.QRect_ITF) {
 func (ptr *QMovie) DestroyQMovie() {
 	if ptr.Pointer() != nil {
 		C.QMovie_DestroyQMovie(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -21255,7 +21404,7 @@ func (ptr *QMovie) BackgroundColor() *QColor {
 func (ptr *QMovie) Device() *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QMovie_Device(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -21380,7 +21529,7 @@ func (ptr *QMovie) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QMovie) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QMovie___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -21401,7 +21550,7 @@ func (ptr *QMovie) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QMovie) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QMovie___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -21422,7 +21571,7 @@ func (ptr *QMovie) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QMovie) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QMovie___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -21443,7 +21592,7 @@ func (ptr *QMovie) __findChildren_newList() unsafe.Pointer {
 func (ptr *QMovie) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QMovie___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -21463,7 +21612,7 @@ func (ptr *QMovie) __children_newList() unsafe.Pointer {
 
 //export callbackQMovie_Event
 func callbackQMovie_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -21479,7 +21628,7 @@ func (ptr *QMovie) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQMovie_EventFilter
 func callbackQMovie_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -21495,7 +21644,7 @@ func (ptr *QMovie) EventFilterDefault(watched core.QObject_ITF, event core.QEven
 
 //export callbackQMovie_ChildEvent
 func callbackQMovie_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQMovieFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -21510,7 +21659,7 @@ func (ptr *QMovie) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQMovie_ConnectNotify
 func callbackQMovie_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQMovieFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -21525,7 +21674,7 @@ func (ptr *QMovie) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQMovie_CustomEvent
 func callbackQMovie_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQMovieFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -21540,7 +21689,7 @@ func (ptr *QMovie) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQMovie_DeleteLater
 func callbackQMovie_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQMovieFromPointer(ptr).DeleteLaterDefault()
@@ -21550,14 +21699,14 @@ func callbackQMovie_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QMovie) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QMovie_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQMovie_Destroyed
 func callbackQMovie_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -21565,7 +21714,7 @@ func callbackQMovie_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQMovie_DisconnectNotify
 func callbackQMovie_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQMovieFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -21580,7 +21729,7 @@ func (ptr *QMovie) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQMovie_ObjectNameChanged
 func callbackQMovie_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -21588,7 +21737,7 @@ func callbackQMovie_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_Qt
 
 //export callbackQMovie_TimerEvent
 func callbackQMovie_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQMovieFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -21603,7 +21752,7 @@ func (ptr *QMovie) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQMovie_MetaObject
 func callbackQMovie_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -21659,7 +21808,7 @@ func NewQNativeGestureEventFromPointer(ptr unsafe.Pointer) *QNativeGestureEvent
 func (ptr *QNativeGestureEvent) DestroyQNativeGestureEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -21861,7 +22010,7 @@ func NewQOffscreenSurfaceFromPointer(ptr unsafe.Pointer) *QOffscreenSurface {
 }
 func NewQOffscreenSurface(targetScreen QScreen_ITF) *QOffscreenSurface {
 	var tmpValue = NewQOffscreenSurfaceFromPointer(C.QOffscreenSurface_NewQOffscreenSurface(PointerFromQScreen(targetScreen)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -21881,7 +22030,7 @@ func (ptr *QOffscreenSurface) Destroy() {
 
 //export callbackQOffscreenSurface_ScreenChanged
 func callbackQOffscreenSurface_ScreenChanged(ptr unsafe.Pointer, screen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "screenChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "screenChanged"); signal != nil {
 		signal.(func(*QScreen))(NewQScreenFromPointer(screen))
 	}
 
@@ -21890,14 +22039,14 @@ func callbackQOffscreenSurface_ScreenChanged(ptr unsafe.Pointer, screen unsafe.P
 func (ptr *QOffscreenSurface) ConnectScreenChanged(f func(screen *QScreen)) {
 	if ptr.Pointer() != nil {
 		C.QOffscreenSurface_ConnectScreenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "screenChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "screenChanged", f)
 	}
 }
 
 func (ptr *QOffscreenSurface) DisconnectScreenChanged() {
 	if ptr.Pointer() != nil {
 		C.QOffscreenSurface_DisconnectScreenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "screenChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "screenChanged")
 	}
 }
 
@@ -21921,7 +22070,7 @@ func (ptr *QOffscreenSurface) SetScreen(newScreen QScreen_ITF) {
 
 //export callbackQOffscreenSurface_DestroyQOffscreenSurface
 func callbackQOffscreenSurface_DestroyQOffscreenSurface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QOffscreenSurface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QOffscreenSurface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQOffscreenSurfaceFromPointer(ptr).DestroyQOffscreenSurfaceDefault()
@@ -21931,21 +22080,21 @@ func callbackQOffscreenSurface_DestroyQOffscreenSurface(ptr unsafe.Pointer) {
 func (ptr *QOffscreenSurface) ConnectDestroyQOffscreenSurface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QOffscreenSurface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QOffscreenSurface", f)
 	}
 }
 
 func (ptr *QOffscreenSurface) DisconnectDestroyQOffscreenSurface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QOffscreenSurface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QOffscreenSurface")
 	}
 }
 
 func (ptr *QOffscreenSurface) DestroyQOffscreenSurface() {
 	if ptr.Pointer() != nil {
 		C.QOffscreenSurface_DestroyQOffscreenSurface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -21953,7 +22102,7 @@ func (ptr *QOffscreenSurface) DestroyQOffscreenSurface() {
 func (ptr *QOffscreenSurface) DestroyQOffscreenSurfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QOffscreenSurface_DestroyQOffscreenSurfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -21961,7 +22110,7 @@ func (ptr *QOffscreenSurface) DestroyQOffscreenSurfaceDefault() {
 func (ptr *QOffscreenSurface) Screen() *QScreen {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScreenFromPointer(C.QOffscreenSurface_Screen(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -21971,7 +22120,7 @@ func (ptr *QOffscreenSurface) Screen() *QScreen {
 
 //export callbackQOffscreenSurface_Size
 func callbackQOffscreenSurface_Size(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -21981,14 +22130,14 @@ func callbackQOffscreenSurface_Size(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QOffscreenSurface) ConnectSize(f func() *core.QSize) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "size", f)
+		qt.ConnectSignal(ptr.Pointer(), "size", f)
 	}
 }
 
 func (ptr *QOffscreenSurface) DisconnectSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "size")
+		qt.DisconnectSignal(ptr.Pointer(), "size")
 	}
 }
 
@@ -22012,7 +22161,7 @@ func (ptr *QOffscreenSurface) SizeDefault() *core.QSize {
 
 //export callbackQOffscreenSurface_Format
 func callbackQOffscreenSurface_Format(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "format"); signal != nil {
+	if signal := qt.GetSignal(ptr, "format"); signal != nil {
 		return PointerFromQSurfaceFormat(signal.(func() *QSurfaceFormat)())
 	}
 
@@ -22022,14 +22171,14 @@ func callbackQOffscreenSurface_Format(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QOffscreenSurface) ConnectFormat(f func() *QSurfaceFormat) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "format", f)
+		qt.ConnectSignal(ptr.Pointer(), "format", f)
 	}
 }
 
 func (ptr *QOffscreenSurface) DisconnectFormat() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "format")
+		qt.DisconnectSignal(ptr.Pointer(), "format")
 	}
 }
 
@@ -22062,7 +22211,7 @@ func (ptr *QOffscreenSurface) RequestedFormat() *QSurfaceFormat {
 
 //export callbackQOffscreenSurface_SurfaceType
 func callbackQOffscreenSurface_SurfaceType(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "surfaceType"); signal != nil {
+	if signal := qt.GetSignal(ptr, "surfaceType"); signal != nil {
 		return C.longlong(signal.(func() QSurface__SurfaceType)())
 	}
 
@@ -22072,14 +22221,14 @@ func callbackQOffscreenSurface_SurfaceType(ptr unsafe.Pointer) C.longlong {
 func (ptr *QOffscreenSurface) ConnectSurfaceType(f func() QSurface__SurfaceType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "surfaceType", f)
+		qt.ConnectSignal(ptr.Pointer(), "surfaceType", f)
 	}
 }
 
 func (ptr *QOffscreenSurface) DisconnectSurfaceType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "surfaceType")
+		qt.DisconnectSignal(ptr.Pointer(), "surfaceType")
 	}
 }
 
@@ -22126,7 +22275,7 @@ func (ptr *QOffscreenSurface) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QOffscreenSurface) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QOffscreenSurface___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -22147,7 +22296,7 @@ func (ptr *QOffscreenSurface) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QOffscreenSurface) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QOffscreenSurface___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -22168,7 +22317,7 @@ func (ptr *QOffscreenSurface) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QOffscreenSurface) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QOffscreenSurface___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -22189,7 +22338,7 @@ func (ptr *QOffscreenSurface) __findChildren_newList() unsafe.Pointer {
 func (ptr *QOffscreenSurface) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QOffscreenSurface___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -22209,7 +22358,7 @@ func (ptr *QOffscreenSurface) __children_newList() unsafe.Pointer {
 
 //export callbackQOffscreenSurface_Event
 func callbackQOffscreenSurface_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -22232,7 +22381,7 @@ func (ptr *QOffscreenSurface) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQOffscreenSurface_EventFilter
 func callbackQOffscreenSurface_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -22255,7 +22404,7 @@ func (ptr *QOffscreenSurface) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQOffscreenSurface_ChildEvent
 func callbackQOffscreenSurface_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQOffscreenSurfaceFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -22276,7 +22425,7 @@ func (ptr *QOffscreenSurface) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQOffscreenSurface_ConnectNotify
 func callbackQOffscreenSurface_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQOffscreenSurfaceFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -22297,7 +22446,7 @@ func (ptr *QOffscreenSurface) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQOffscreenSurface_CustomEvent
 func callbackQOffscreenSurface_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQOffscreenSurfaceFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -22318,7 +22467,7 @@ func (ptr *QOffscreenSurface) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQOffscreenSurface_DeleteLater
 func callbackQOffscreenSurface_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQOffscreenSurfaceFromPointer(ptr).DeleteLaterDefault()
@@ -22328,7 +22477,7 @@ func callbackQOffscreenSurface_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QOffscreenSurface) DeleteLater() {
 	if ptr.Pointer() != nil {
 		C.QOffscreenSurface_DeleteLater(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -22336,14 +22485,14 @@ func (ptr *QOffscreenSurface) DeleteLater() {
 func (ptr *QOffscreenSurface) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QOffscreenSurface_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQOffscreenSurface_Destroyed
 func callbackQOffscreenSurface_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -22351,7 +22500,7 @@ func callbackQOffscreenSurface_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQOffscreenSurface_DisconnectNotify
 func callbackQOffscreenSurface_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQOffscreenSurfaceFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -22372,7 +22521,7 @@ func (ptr *QOffscreenSurface) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQOffscreenSurface_ObjectNameChanged
 func callbackQOffscreenSurface_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -22380,7 +22529,7 @@ func callbackQOffscreenSurface_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQOffscreenSurface_TimerEvent
 func callbackQOffscreenSurface_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQOffscreenSurfaceFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -22401,7 +22550,7 @@ func (ptr *QOffscreenSurface) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQOffscreenSurface_MetaObject
 func callbackQOffscreenSurface_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -22600,7 +22749,7 @@ func NewQOpenGLContextGroupFromPointer(ptr unsafe.Pointer) *QOpenGLContextGroup
 func (ptr *QOpenGLContextGroup) DestroyQOpenGLContextGroup() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -25764,7 +25913,7 @@ func NewQPagedPaintDevice() *QPagedPaintDevice {
 
 //export callbackQPagedPaintDevice_NewPage
 func callbackQPagedPaintDevice_NewPage(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "newPage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "newPage"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -25774,14 +25923,14 @@ func callbackQPagedPaintDevice_NewPage(ptr unsafe.Pointer) C.char {
 func (ptr *QPagedPaintDevice) ConnectNewPage(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "newPage", f)
+		qt.ConnectSignal(ptr.Pointer(), "newPage", f)
 	}
 }
 
 func (ptr *QPagedPaintDevice) DisconnectNewPage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "newPage")
+		qt.DisconnectSignal(ptr.Pointer(), "newPage")
 	}
 }
 
@@ -25829,7 +25978,7 @@ func (ptr *QPagedPaintDevice) SetPageSize(pageSize QPageSize_ITF) bool {
 
 //export callbackQPagedPaintDevice_SetPageSize2
 func callbackQPagedPaintDevice_SetPageSize2(ptr unsafe.Pointer, size C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPageSize2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPageSize2"); signal != nil {
 		signal.(func(QPagedPaintDevice__PageSize))(QPagedPaintDevice__PageSize(size))
 	} else {
 		NewQPagedPaintDeviceFromPointer(ptr).SetPageSize2Default(QPagedPaintDevice__PageSize(size))
@@ -25839,14 +25988,14 @@ func callbackQPagedPaintDevice_SetPageSize2(ptr unsafe.Pointer, size C.longlong)
 func (ptr *QPagedPaintDevice) ConnectSetPageSize2(f func(size QPagedPaintDevice__PageSize)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPageSize2", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPageSize2", f)
 	}
 }
 
 func (ptr *QPagedPaintDevice) DisconnectSetPageSize2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPageSize2")
+		qt.DisconnectSignal(ptr.Pointer(), "setPageSize2")
 	}
 }
 
@@ -25864,7 +26013,7 @@ func (ptr *QPagedPaintDevice) SetPageSize2Default(size QPagedPaintDevice__PageSi
 
 //export callbackQPagedPaintDevice_SetPageSizeMM
 func callbackQPagedPaintDevice_SetPageSizeMM(ptr unsafe.Pointer, size unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPageSizeMM"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPageSizeMM"); signal != nil {
 		signal.(func(*core.QSizeF))(core.NewQSizeFFromPointer(size))
 	} else {
 		NewQPagedPaintDeviceFromPointer(ptr).SetPageSizeMMDefault(core.NewQSizeFFromPointer(size))
@@ -25874,14 +26023,14 @@ func callbackQPagedPaintDevice_SetPageSizeMM(ptr unsafe.Pointer, size unsafe.Poi
 func (ptr *QPagedPaintDevice) ConnectSetPageSizeMM(f func(size *core.QSizeF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPageSizeMM", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPageSizeMM", f)
 	}
 }
 
 func (ptr *QPagedPaintDevice) DisconnectSetPageSizeMM() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPageSizeMM")
+		qt.DisconnectSignal(ptr.Pointer(), "setPageSizeMM")
 	}
 }
 
@@ -25900,7 +26049,7 @@ func (ptr *QPagedPaintDevice) SetPageSizeMMDefault(size core.QSizeF_ITF) {
 func (ptr *QPagedPaintDevice) DestroyQPagedPaintDevice() {
 	if ptr.Pointer() != nil {
 		C.QPagedPaintDevice_DestroyQPagedPaintDevice(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -25932,7 +26081,7 @@ func (ptr *QPagedPaintDevice) PageSizeMM() *core.QSizeF {
 
 //export callbackQPagedPaintDevice_PaintEngine
 func callbackQPagedPaintDevice_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return PointerFromQPaintEngine(signal.(func() *QPaintEngine)())
 	}
 
@@ -26016,7 +26165,7 @@ func NewQPaintDevice() *QPaintDevice {
 
 //export callbackQPaintDevice_DestroyQPaintDevice
 func callbackQPaintDevice_DestroyQPaintDevice(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QPaintDevice"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QPaintDevice"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPaintDeviceFromPointer(ptr).DestroyQPaintDeviceDefault()
@@ -26026,21 +26175,21 @@ func callbackQPaintDevice_DestroyQPaintDevice(ptr unsafe.Pointer) {
 func (ptr *QPaintDevice) ConnectDestroyQPaintDevice(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QPaintDevice", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QPaintDevice", f)
 	}
 }
 
 func (ptr *QPaintDevice) DisconnectDestroyQPaintDevice() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QPaintDevice")
+		qt.DisconnectSignal(ptr.Pointer(), "~QPaintDevice")
 	}
 }
 
 func (ptr *QPaintDevice) DestroyQPaintDevice() {
 	if ptr.Pointer() != nil {
 		C.QPaintDevice_DestroyQPaintDevice(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -26048,14 +26197,14 @@ func (ptr *QPaintDevice) DestroyQPaintDevice() {
 func (ptr *QPaintDevice) DestroyQPaintDeviceDefault() {
 	if ptr.Pointer() != nil {
 		C.QPaintDevice_DestroyQPaintDeviceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPaintDevice_PaintEngine
 func callbackQPaintDevice_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return PointerFromQPaintEngine(signal.(func() *QPaintEngine)())
 	}
 
@@ -26065,14 +26214,14 @@ func callbackQPaintDevice_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QPaintDevice) ConnectPaintEngine(f func() *QPaintEngine) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paintEngine", f)
+		qt.ConnectSignal(ptr.Pointer(), "paintEngine", f)
 	}
 }
 
 func (ptr *QPaintDevice) DisconnectPaintEngine() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paintEngine")
+		qt.DisconnectSignal(ptr.Pointer(), "paintEngine")
 	}
 }
 
@@ -26141,7 +26290,7 @@ func (ptr *QPaintDevice) LogicalDpiY() int {
 
 //export callbackQPaintDevice_Metric
 func callbackQPaintDevice_Metric(ptr unsafe.Pointer, metric C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(QPaintDevice__PaintDeviceMetric) int)(QPaintDevice__PaintDeviceMetric(metric))))
 	}
 
@@ -26151,14 +26300,14 @@ func callbackQPaintDevice_Metric(ptr unsafe.Pointer, metric C.longlong) C.int {
 func (ptr *QPaintDevice) ConnectMetric(f func(metric QPaintDevice__PaintDeviceMetric) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "metric", f)
+		qt.ConnectSignal(ptr.Pointer(), "metric", f)
 	}
 }
 
 func (ptr *QPaintDevice) DisconnectMetric() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "metric")
+		qt.DisconnectSignal(ptr.Pointer(), "metric")
 	}
 }
 
@@ -26269,14 +26418,14 @@ func NewQPaintDeviceWindowFromPointer(ptr unsafe.Pointer) *QPaintDeviceWindow {
 func (ptr *QPaintDeviceWindow) DestroyQPaintDeviceWindow() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPaintDeviceWindow_PaintEvent
 func callbackQPaintDeviceWindow_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*QPaintEvent))(NewQPaintEventFromPointer(event))
 	} else {
 		NewQPaintDeviceWindowFromPointer(ptr).PaintEventDefault(NewQPaintEventFromPointer(event))
@@ -26286,14 +26435,14 @@ func callbackQPaintDeviceWindow_PaintEvent(ptr unsafe.Pointer, event unsafe.Poin
 func (ptr *QPaintDeviceWindow) ConnectPaintEvent(f func(event *QPaintEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paintEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "paintEvent", f)
 	}
 }
 
 func (ptr *QPaintDeviceWindow) DisconnectPaintEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paintEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "paintEvent")
 	}
 }
 
@@ -26311,7 +26460,7 @@ func (ptr *QPaintDeviceWindow) PaintEventDefault(event QPaintEvent_ITF) {
 
 //export callbackQPaintDeviceWindow_Update3
 func callbackQPaintDeviceWindow_Update3(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update3"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update3"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPaintDeviceWindowFromPointer(ptr).Update3Default()
@@ -26321,14 +26470,14 @@ func callbackQPaintDeviceWindow_Update3(ptr unsafe.Pointer) {
 func (ptr *QPaintDeviceWindow) ConnectUpdate3(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "update3", f)
+		qt.ConnectSignal(ptr.Pointer(), "update3", f)
 	}
 }
 
 func (ptr *QPaintDeviceWindow) DisconnectUpdate3() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "update3")
+		qt.DisconnectSignal(ptr.Pointer(), "update3")
 	}
 }
 
@@ -26358,7 +26507,7 @@ func (ptr *QPaintDeviceWindow) Update2(region QRegion_ITF) {
 
 //export callbackQPaintDeviceWindow_PaintEngine
 func callbackQPaintDeviceWindow_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return PointerFromQPaintEngine(signal.(func() *QPaintEngine)())
 	}
 
@@ -26505,7 +26654,7 @@ const (
 
 //export callbackQPaintEngine_End
 func callbackQPaintEngine_End(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "end"); signal != nil {
+	if signal := qt.GetSignal(ptr, "end"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -26515,14 +26664,14 @@ func callbackQPaintEngine_End(ptr unsafe.Pointer) C.char {
 func (ptr *QPaintEngine) ConnectEnd(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "end", f)
+		qt.ConnectSignal(ptr.Pointer(), "end", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectEnd() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "end")
+		qt.DisconnectSignal(ptr.Pointer(), "end")
 	}
 }
 
@@ -26535,7 +26684,7 @@ func (ptr *QPaintEngine) End() bool {
 
 //export callbackQPaintEngine_DrawEllipse
 func callbackQPaintEngine_DrawEllipse(ptr unsafe.Pointer, rect unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawEllipse"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawEllipse"); signal != nil {
 		signal.(func(*core.QRectF))(core.NewQRectFFromPointer(rect))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawEllipseDefault(core.NewQRectFFromPointer(rect))
@@ -26545,14 +26694,14 @@ func callbackQPaintEngine_DrawEllipse(ptr unsafe.Pointer, rect unsafe.Pointer) {
 func (ptr *QPaintEngine) ConnectDrawEllipse(f func(rect *core.QRectF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawEllipse", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawEllipse", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawEllipse() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawEllipse")
+		qt.DisconnectSignal(ptr.Pointer(), "drawEllipse")
 	}
 }
 
@@ -26570,7 +26719,7 @@ func (ptr *QPaintEngine) DrawEllipseDefault(rect core.QRectF_ITF) {
 
 //export callbackQPaintEngine_DrawImage
 func callbackQPaintEngine_DrawImage(ptr unsafe.Pointer, rectangle unsafe.Pointer, image unsafe.Pointer, sr unsafe.Pointer, flags C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawImage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawImage"); signal != nil {
 		signal.(func(*core.QRectF, *QImage, *core.QRectF, core.Qt__ImageConversionFlag))(core.NewQRectFFromPointer(rectangle), NewQImageFromPointer(image), core.NewQRectFFromPointer(sr), core.Qt__ImageConversionFlag(flags))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawImageDefault(core.NewQRectFFromPointer(rectangle), NewQImageFromPointer(image), core.NewQRectFFromPointer(sr), core.Qt__ImageConversionFlag(flags))
@@ -26580,14 +26729,14 @@ func callbackQPaintEngine_DrawImage(ptr unsafe.Pointer, rectangle unsafe.Pointer
 func (ptr *QPaintEngine) ConnectDrawImage(f func(rectangle *core.QRectF, image *QImage, sr *core.QRectF, flags core.Qt__ImageConversionFlag)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawImage", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawImage", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawImage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawImage")
+		qt.DisconnectSignal(ptr.Pointer(), "drawImage")
 	}
 }
 
@@ -26605,7 +26754,7 @@ func (ptr *QPaintEngine) DrawImageDefault(rectangle core.QRectF_ITF, image QImag
 
 //export callbackQPaintEngine_DrawPolygon
 func callbackQPaintEngine_DrawPolygon(ptr unsafe.Pointer, points unsafe.Pointer, pointCount C.int, mode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawPolygon"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawPolygon"); signal != nil {
 		signal.(func(*core.QPointF, int, QPaintEngine__PolygonDrawMode))(core.NewQPointFFromPointer(points), int(int32(pointCount)), QPaintEngine__PolygonDrawMode(mode))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawPolygonDefault(core.NewQPointFFromPointer(points), int(int32(pointCount)), QPaintEngine__PolygonDrawMode(mode))
@@ -26615,14 +26764,14 @@ func callbackQPaintEngine_DrawPolygon(ptr unsafe.Pointer, points unsafe.Pointer,
 func (ptr *QPaintEngine) ConnectDrawPolygon(f func(points *core.QPointF, pointCount int, mode QPaintEngine__PolygonDrawMode)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawPolygon", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawPolygon", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawPolygon() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawPolygon")
+		qt.DisconnectSignal(ptr.Pointer(), "drawPolygon")
 	}
 }
 
@@ -26644,7 +26793,7 @@ func NewQPaintEngine(caps QPaintEngine__PaintEngineFeature) *QPaintEngine {
 
 //export callbackQPaintEngine_Begin
 func callbackQPaintEngine_Begin(ptr unsafe.Pointer, pdev unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "begin"); signal != nil {
+	if signal := qt.GetSignal(ptr, "begin"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QPaintDevice) bool)(NewQPaintDeviceFromPointer(pdev)))))
 	}
 
@@ -26654,14 +26803,14 @@ func callbackQPaintEngine_Begin(ptr unsafe.Pointer, pdev unsafe.Pointer) C.char
 func (ptr *QPaintEngine) ConnectBegin(f func(pdev *QPaintDevice) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "begin", f)
+		qt.ConnectSignal(ptr.Pointer(), "begin", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectBegin() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "begin")
+		qt.DisconnectSignal(ptr.Pointer(), "begin")
 	}
 }
 
@@ -26674,7 +26823,7 @@ func (ptr *QPaintEngine) Begin(pdev QPaintDevice_ITF) bool {
 
 //export callbackQPaintEngine_DrawEllipse2
 func callbackQPaintEngine_DrawEllipse2(ptr unsafe.Pointer, rect unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawEllipse2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawEllipse2"); signal != nil {
 		signal.(func(*core.QRect))(core.NewQRectFromPointer(rect))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawEllipse2Default(core.NewQRectFromPointer(rect))
@@ -26684,14 +26833,14 @@ func callbackQPaintEngine_DrawEllipse2(ptr unsafe.Pointer, rect unsafe.Pointer)
 func (ptr *QPaintEngine) ConnectDrawEllipse2(f func(rect *core.QRect)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawEllipse2", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawEllipse2", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawEllipse2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawEllipse2")
+		qt.DisconnectSignal(ptr.Pointer(), "drawEllipse2")
 	}
 }
 
@@ -26709,7 +26858,7 @@ func (ptr *QPaintEngine) DrawEllipse2Default(rect core.QRect_ITF) {
 
 //export callbackQPaintEngine_DrawLines2
 func callbackQPaintEngine_DrawLines2(ptr unsafe.Pointer, lines unsafe.Pointer, lineCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawLines2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawLines2"); signal != nil {
 		signal.(func(*core.QLine, int))(core.NewQLineFromPointer(lines), int(int32(lineCount)))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawLines2Default(core.NewQLineFromPointer(lines), int(int32(lineCount)))
@@ -26719,14 +26868,14 @@ func callbackQPaintEngine_DrawLines2(ptr unsafe.Pointer, lines unsafe.Pointer, l
 func (ptr *QPaintEngine) ConnectDrawLines2(f func(lines *core.QLine, lineCount int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawLines2", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawLines2", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawLines2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawLines2")
+		qt.DisconnectSignal(ptr.Pointer(), "drawLines2")
 	}
 }
 
@@ -26744,7 +26893,7 @@ func (ptr *QPaintEngine) DrawLines2Default(lines core.QLine_ITF, lineCount int)
 
 //export callbackQPaintEngine_DrawLines
 func callbackQPaintEngine_DrawLines(ptr unsafe.Pointer, lines unsafe.Pointer, lineCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawLines"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawLines"); signal != nil {
 		signal.(func(*core.QLineF, int))(core.NewQLineFFromPointer(lines), int(int32(lineCount)))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawLinesDefault(core.NewQLineFFromPointer(lines), int(int32(lineCount)))
@@ -26754,14 +26903,14 @@ func callbackQPaintEngine_DrawLines(ptr unsafe.Pointer, lines unsafe.Pointer, li
 func (ptr *QPaintEngine) ConnectDrawLines(f func(lines *core.QLineF, lineCount int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawLines", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawLines", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawLines() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawLines")
+		qt.DisconnectSignal(ptr.Pointer(), "drawLines")
 	}
 }
 
@@ -26779,7 +26928,7 @@ func (ptr *QPaintEngine) DrawLinesDefault(lines core.QLineF_ITF, lineCount int)
 
 //export callbackQPaintEngine_DrawPath
 func callbackQPaintEngine_DrawPath(ptr unsafe.Pointer, path unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawPath"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawPath"); signal != nil {
 		signal.(func(*QPainterPath))(NewQPainterPathFromPointer(path))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawPathDefault(NewQPainterPathFromPointer(path))
@@ -26789,14 +26938,14 @@ func callbackQPaintEngine_DrawPath(ptr unsafe.Pointer, path unsafe.Pointer) {
 func (ptr *QPaintEngine) ConnectDrawPath(f func(path *QPainterPath)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawPath", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawPath", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawPath() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawPath")
+		qt.DisconnectSignal(ptr.Pointer(), "drawPath")
 	}
 }
 
@@ -26814,7 +26963,7 @@ func (ptr *QPaintEngine) DrawPathDefault(path QPainterPath_ITF) {
 
 //export callbackQPaintEngine_DrawPixmap
 func callbackQPaintEngine_DrawPixmap(ptr unsafe.Pointer, r unsafe.Pointer, pm unsafe.Pointer, sr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawPixmap"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawPixmap"); signal != nil {
 		signal.(func(*core.QRectF, *QPixmap, *core.QRectF))(core.NewQRectFFromPointer(r), NewQPixmapFromPointer(pm), core.NewQRectFFromPointer(sr))
 	}
 
@@ -26823,14 +26972,14 @@ func callbackQPaintEngine_DrawPixmap(ptr unsafe.Pointer, r unsafe.Pointer, pm un
 func (ptr *QPaintEngine) ConnectDrawPixmap(f func(r *core.QRectF, pm *QPixmap, sr *core.QRectF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawPixmap", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawPixmap", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawPixmap() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawPixmap")
+		qt.DisconnectSignal(ptr.Pointer(), "drawPixmap")
 	}
 }
 
@@ -26842,7 +26991,7 @@ func (ptr *QPaintEngine) DrawPixmap(r core.QRectF_ITF, pm QPixmap_ITF, sr core.Q
 
 //export callbackQPaintEngine_DrawPoints2
 func callbackQPaintEngine_DrawPoints2(ptr unsafe.Pointer, points unsafe.Pointer, pointCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawPoints2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawPoints2"); signal != nil {
 		signal.(func(*core.QPoint, int))(core.NewQPointFromPointer(points), int(int32(pointCount)))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawPoints2Default(core.NewQPointFromPointer(points), int(int32(pointCount)))
@@ -26852,14 +27001,14 @@ func callbackQPaintEngine_DrawPoints2(ptr unsafe.Pointer, points unsafe.Pointer,
 func (ptr *QPaintEngine) ConnectDrawPoints2(f func(points *core.QPoint, pointCount int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawPoints2", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawPoints2", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawPoints2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawPoints2")
+		qt.DisconnectSignal(ptr.Pointer(), "drawPoints2")
 	}
 }
 
@@ -26877,7 +27026,7 @@ func (ptr *QPaintEngine) DrawPoints2Default(points core.QPoint_ITF, pointCount i
 
 //export callbackQPaintEngine_DrawPoints
 func callbackQPaintEngine_DrawPoints(ptr unsafe.Pointer, points unsafe.Pointer, pointCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawPoints"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawPoints"); signal != nil {
 		signal.(func(*core.QPointF, int))(core.NewQPointFFromPointer(points), int(int32(pointCount)))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawPointsDefault(core.NewQPointFFromPointer(points), int(int32(pointCount)))
@@ -26887,14 +27036,14 @@ func callbackQPaintEngine_DrawPoints(ptr unsafe.Pointer, points unsafe.Pointer,
 func (ptr *QPaintEngine) ConnectDrawPoints(f func(points *core.QPointF, pointCount int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawPoints", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawPoints", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawPoints() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawPoints")
+		qt.DisconnectSignal(ptr.Pointer(), "drawPoints")
 	}
 }
 
@@ -26912,7 +27061,7 @@ func (ptr *QPaintEngine) DrawPointsDefault(points core.QPointF_ITF, pointCount i
 
 //export callbackQPaintEngine_DrawPolygon2
 func callbackQPaintEngine_DrawPolygon2(ptr unsafe.Pointer, points unsafe.Pointer, pointCount C.int, mode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawPolygon2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawPolygon2"); signal != nil {
 		signal.(func(*core.QPoint, int, QPaintEngine__PolygonDrawMode))(core.NewQPointFromPointer(points), int(int32(pointCount)), QPaintEngine__PolygonDrawMode(mode))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawPolygon2Default(core.NewQPointFromPointer(points), int(int32(pointCount)), QPaintEngine__PolygonDrawMode(mode))
@@ -26922,14 +27071,14 @@ func callbackQPaintEngine_DrawPolygon2(ptr unsafe.Pointer, points unsafe.Pointer
 func (ptr *QPaintEngine) ConnectDrawPolygon2(f func(points *core.QPoint, pointCount int, mode QPaintEngine__PolygonDrawMode)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawPolygon2", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawPolygon2", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawPolygon2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawPolygon2")
+		qt.DisconnectSignal(ptr.Pointer(), "drawPolygon2")
 	}
 }
 
@@ -26947,7 +27096,7 @@ func (ptr *QPaintEngine) DrawPolygon2Default(points core.QPoint_ITF, pointCount
 
 //export callbackQPaintEngine_DrawRects2
 func callbackQPaintEngine_DrawRects2(ptr unsafe.Pointer, rects unsafe.Pointer, rectCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawRects2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawRects2"); signal != nil {
 		signal.(func(*core.QRect, int))(core.NewQRectFromPointer(rects), int(int32(rectCount)))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawRects2Default(core.NewQRectFromPointer(rects), int(int32(rectCount)))
@@ -26957,14 +27106,14 @@ func callbackQPaintEngine_DrawRects2(ptr unsafe.Pointer, rects unsafe.Pointer, r
 func (ptr *QPaintEngine) ConnectDrawRects2(f func(rects *core.QRect, rectCount int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawRects2", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawRects2", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawRects2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawRects2")
+		qt.DisconnectSignal(ptr.Pointer(), "drawRects2")
 	}
 }
 
@@ -26982,7 +27131,7 @@ func (ptr *QPaintEngine) DrawRects2Default(rects core.QRect_ITF, rectCount int)
 
 //export callbackQPaintEngine_DrawRects
 func callbackQPaintEngine_DrawRects(ptr unsafe.Pointer, rects unsafe.Pointer, rectCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawRects"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawRects"); signal != nil {
 		signal.(func(*core.QRectF, int))(core.NewQRectFFromPointer(rects), int(int32(rectCount)))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawRectsDefault(core.NewQRectFFromPointer(rects), int(int32(rectCount)))
@@ -26992,14 +27141,14 @@ func callbackQPaintEngine_DrawRects(ptr unsafe.Pointer, rects unsafe.Pointer, re
 func (ptr *QPaintEngine) ConnectDrawRects(f func(rects *core.QRectF, rectCount int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawRects", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawRects", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawRects() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawRects")
+		qt.DisconnectSignal(ptr.Pointer(), "drawRects")
 	}
 }
 
@@ -27017,7 +27166,7 @@ func (ptr *QPaintEngine) DrawRectsDefault(rects core.QRectF_ITF, rectCount int)
 
 //export callbackQPaintEngine_DrawTextItem
 func callbackQPaintEngine_DrawTextItem(ptr unsafe.Pointer, p unsafe.Pointer, textItem unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawTextItem"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawTextItem"); signal != nil {
 		signal.(func(*core.QPointF, *QTextItem))(core.NewQPointFFromPointer(p), NewQTextItemFromPointer(textItem))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawTextItemDefault(core.NewQPointFFromPointer(p), NewQTextItemFromPointer(textItem))
@@ -27027,14 +27176,14 @@ func callbackQPaintEngine_DrawTextItem(ptr unsafe.Pointer, p unsafe.Pointer, tex
 func (ptr *QPaintEngine) ConnectDrawTextItem(f func(p *core.QPointF, textItem *QTextItem)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawTextItem", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawTextItem", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawTextItem() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawTextItem")
+		qt.DisconnectSignal(ptr.Pointer(), "drawTextItem")
 	}
 }
 
@@ -27052,7 +27201,7 @@ func (ptr *QPaintEngine) DrawTextItemDefault(p core.QPointF_ITF, textItem QTextI
 
 //export callbackQPaintEngine_DrawTiledPixmap
 func callbackQPaintEngine_DrawTiledPixmap(ptr unsafe.Pointer, rect unsafe.Pointer, pixmap unsafe.Pointer, p unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawTiledPixmap"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawTiledPixmap"); signal != nil {
 		signal.(func(*core.QRectF, *QPixmap, *core.QPointF))(core.NewQRectFFromPointer(rect), NewQPixmapFromPointer(pixmap), core.NewQPointFFromPointer(p))
 	} else {
 		NewQPaintEngineFromPointer(ptr).DrawTiledPixmapDefault(core.NewQRectFFromPointer(rect), NewQPixmapFromPointer(pixmap), core.NewQPointFFromPointer(p))
@@ -27062,14 +27211,14 @@ func callbackQPaintEngine_DrawTiledPixmap(ptr unsafe.Pointer, rect unsafe.Pointe
 func (ptr *QPaintEngine) ConnectDrawTiledPixmap(f func(rect *core.QRectF, pixmap *QPixmap, p *core.QPointF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawTiledPixmap", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawTiledPixmap", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDrawTiledPixmap() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawTiledPixmap")
+		qt.DisconnectSignal(ptr.Pointer(), "drawTiledPixmap")
 	}
 }
 
@@ -27093,7 +27242,7 @@ func (ptr *QPaintEngine) SetActive(state bool) {
 
 //export callbackQPaintEngine_UpdateState
 func callbackQPaintEngine_UpdateState(ptr unsafe.Pointer, state unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateState"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateState"); signal != nil {
 		signal.(func(*QPaintEngineState))(NewQPaintEngineStateFromPointer(state))
 	}
 
@@ -27102,14 +27251,14 @@ func callbackQPaintEngine_UpdateState(ptr unsafe.Pointer, state unsafe.Pointer)
 func (ptr *QPaintEngine) ConnectUpdateState(f func(state *QPaintEngineState)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateState", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateState", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectUpdateState() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateState")
+		qt.DisconnectSignal(ptr.Pointer(), "updateState")
 	}
 }
 
@@ -27121,7 +27270,7 @@ func (ptr *QPaintEngine) UpdateState(state QPaintEngineState_ITF) {
 
 //export callbackQPaintEngine_DestroyQPaintEngine
 func callbackQPaintEngine_DestroyQPaintEngine(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QPaintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QPaintEngine"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPaintEngineFromPointer(ptr).DestroyQPaintEngineDefault()
@@ -27131,21 +27280,21 @@ func callbackQPaintEngine_DestroyQPaintEngine(ptr unsafe.Pointer) {
 func (ptr *QPaintEngine) ConnectDestroyQPaintEngine(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QPaintEngine", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QPaintEngine", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectDestroyQPaintEngine() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QPaintEngine")
+		qt.DisconnectSignal(ptr.Pointer(), "~QPaintEngine")
 	}
 }
 
 func (ptr *QPaintEngine) DestroyQPaintEngine() {
 	if ptr.Pointer() != nil {
 		C.QPaintEngine_DestroyQPaintEngine(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -27153,7 +27302,7 @@ func (ptr *QPaintEngine) DestroyQPaintEngine() {
 func (ptr *QPaintEngine) DestroyQPaintEngineDefault() {
 	if ptr.Pointer() != nil {
 		C.QPaintEngine_DestroyQPaintEngineDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -27174,7 +27323,7 @@ func (ptr *QPaintEngine) Painter() *QPainter {
 
 //export callbackQPaintEngine_Type
 func callbackQPaintEngine_Type(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.longlong(signal.(func() QPaintEngine__Type)())
 	}
 
@@ -27184,14 +27333,14 @@ func callbackQPaintEngine_Type(ptr unsafe.Pointer) C.longlong {
 func (ptr *QPaintEngine) ConnectType(f func() QPaintEngine__Type) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QPaintEngine) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -27484,7 +27633,7 @@ func NewQPaintEventFromPointer(ptr unsafe.Pointer) *QPaintEvent {
 func (ptr *QPaintEvent) DestroyQPaintEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -27940,49 +28089,49 @@ func (ptr *QPainter) DrawLines3(pointPairs core.QPointF_ITF, lineCount int) {
 
 func (ptr *QPainter) DrawLines6(lines []*core.QLine) {
 	if ptr.Pointer() != nil {
-		C.QPainter_DrawLines6(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQPainterFromPointer(NewQPainterFromPointer(nil).__drawLines_lines_newList6())
-			for _, v := range lines {
-				tmpList.__drawLines_lines_setList6(v)
+		C.QPainter_DrawLines6(ptr.Pointer(), func(l []*core.QLine) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQLine(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQPainterFromPointer(nil).__drawLines_lines_newListBuffer6(unsafe.Pointer(&tmpList[0]), len(l))
+		}(lines))
 	}
 }
 
 func (ptr *QPainter) DrawLines2(lines []*core.QLineF) {
 	if ptr.Pointer() != nil {
-		C.QPainter_DrawLines2(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQPainterFromPointer(NewQPainterFromPointer(nil).__drawLines_lines_newList2())
-			for _, v := range lines {
-				tmpList.__drawLines_lines_setList2(v)
+		C.QPainter_DrawLines2(ptr.Pointer(), func(l []*core.QLineF) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQLineF(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQPainterFromPointer(nil).__drawLines_lines_newListBuffer2(unsafe.Pointer(&tmpList[0]), len(l))
+		}(lines))
 	}
 }
 
 func (ptr *QPainter) DrawLines8(pointPairs []*core.QPoint) {
 	if ptr.Pointer() != nil {
-		C.QPainter_DrawLines8(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQPainterFromPointer(NewQPainterFromPointer(nil).__drawLines_pointPairs_newList8())
-			for _, v := range pointPairs {
-				tmpList.__drawLines_pointPairs_setList8(v)
+		C.QPainter_DrawLines8(ptr.Pointer(), func(l []*core.QPoint) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQPoint(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQPainterFromPointer(nil).__drawLines_pointPairs_newListBuffer8(unsafe.Pointer(&tmpList[0]), len(l))
+		}(pointPairs))
 	}
 }
 
 func (ptr *QPainter) DrawLines4(pointPairs []*core.QPointF) {
 	if ptr.Pointer() != nil {
-		C.QPainter_DrawLines4(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQPainterFromPointer(NewQPainterFromPointer(nil).__drawLines_pointPairs_newList4())
-			for _, v := range pointPairs {
-				tmpList.__drawLines_pointPairs_setList4(v)
+		C.QPainter_DrawLines4(ptr.Pointer(), func(l []*core.QPointF) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQPointF(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQPainterFromPointer(nil).__drawLines_pointPairs_newListBuffer4(unsafe.Pointer(&tmpList[0]), len(l))
+		}(pointPairs))
 	}
 }
 
@@ -28216,25 +28365,25 @@ func (ptr *QPainter) DrawRects(rectangles core.QRectF_ITF, rectCount int) {
 
 func (ptr *QPainter) DrawRects4(rectangles []*core.QRect) {
 	if ptr.Pointer() != nil {
-		C.QPainter_DrawRects4(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQPainterFromPointer(NewQPainterFromPointer(nil).__drawRects_rectangles_newList4())
-			for _, v := range rectangles {
-				tmpList.__drawRects_rectangles_setList4(v)
+		C.QPainter_DrawRects4(ptr.Pointer(), func(l []*core.QRect) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQRect(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQPainterFromPointer(nil).__drawRects_rectangles_newListBuffer4(unsafe.Pointer(&tmpList[0]), len(l))
+		}(rectangles))
 	}
 }
 
 func (ptr *QPainter) DrawRects2(rectangles []*core.QRectF) {
 	if ptr.Pointer() != nil {
-		C.QPainter_DrawRects2(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQPainterFromPointer(NewQPainterFromPointer(nil).__drawRects_rectangles_newList2())
-			for _, v := range rectangles {
-				tmpList.__drawRects_rectangles_setList2(v)
+		C.QPainter_DrawRects2(ptr.Pointer(), func(l []*core.QRectF) unsafe.Pointer {
+			var tmpList = make([]unsafe.Pointer, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = core.PointerFromQRectF(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQPainterFromPointer(nil).__drawRects_rectangles_newListBuffer2(unsafe.Pointer(&tmpList[0]), len(l))
+		}(rectangles))
 	}
 }
 
@@ -28930,6 +29079,16 @@ func (ptr *QPainter) __drawLines_lines_newList6() unsafe.Pointer {
 	return unsafe.Pointer(C.QPainter___drawLines_lines_newList6(ptr.Pointer()))
 }
 
+func (ptr *QPainter) __drawLines_lines_newListBuffer6(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPainter___drawLines_lines_newListBuffer6(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPainter) __drawLines_lines_fillList6(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPainter___drawLines_lines_fillList6(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPainter) __drawLines_lines_atList2(i int) *core.QLineF {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQLineFFromPointer(C.QPainter___drawLines_lines_atList2(ptr.Pointer(), C.int(int32(i))))
@@ -28949,6 +29108,16 @@ func (ptr *QPainter) __drawLines_lines_newList2() unsafe.Pointer {
 	return unsafe.Pointer(C.QPainter___drawLines_lines_newList2(ptr.Pointer()))
 }
 
+func (ptr *QPainter) __drawLines_lines_newListBuffer2(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPainter___drawLines_lines_newListBuffer2(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPainter) __drawLines_lines_fillList2(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPainter___drawLines_lines_fillList2(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPainter) __drawLines_pointPairs_atList8(i int) *core.QPoint {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPointFromPointer(C.QPainter___drawLines_pointPairs_atList8(ptr.Pointer(), C.int(int32(i))))
@@ -28968,6 +29137,16 @@ func (ptr *QPainter) __drawLines_pointPairs_newList8() unsafe.Pointer {
 	return unsafe.Pointer(C.QPainter___drawLines_pointPairs_newList8(ptr.Pointer()))
 }
 
+func (ptr *QPainter) __drawLines_pointPairs_newListBuffer8(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPainter___drawLines_pointPairs_newListBuffer8(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPainter) __drawLines_pointPairs_fillList8(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPainter___drawLines_pointPairs_fillList8(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPainter) __drawLines_pointPairs_atList4(i int) *core.QPointF {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPointFFromPointer(C.QPainter___drawLines_pointPairs_atList4(ptr.Pointer(), C.int(int32(i))))
@@ -28987,6 +29166,16 @@ func (ptr *QPainter) __drawLines_pointPairs_newList4() unsafe.Pointer {
 	return unsafe.Pointer(C.QPainter___drawLines_pointPairs_newList4(ptr.Pointer()))
 }
 
+func (ptr *QPainter) __drawLines_pointPairs_newListBuffer4(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPainter___drawLines_pointPairs_newListBuffer4(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPainter) __drawLines_pointPairs_fillList4(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPainter___drawLines_pointPairs_fillList4(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPainter) __drawRects_rectangles_atList4(i int) *core.QRect {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQRectFromPointer(C.QPainter___drawRects_rectangles_atList4(ptr.Pointer(), C.int(int32(i))))
@@ -29006,6 +29195,16 @@ func (ptr *QPainter) __drawRects_rectangles_newList4() unsafe.Pointer {
 	return unsafe.Pointer(C.QPainter___drawRects_rectangles_newList4(ptr.Pointer()))
 }
 
+func (ptr *QPainter) __drawRects_rectangles_newListBuffer4(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPainter___drawRects_rectangles_newListBuffer4(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPainter) __drawRects_rectangles_fillList4(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPainter___drawRects_rectangles_fillList4(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPainter) __drawRects_rectangles_atList2(i int) *core.QRectF {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQRectFFromPointer(C.QPainter___drawRects_rectangles_atList2(ptr.Pointer(), C.int(int32(i))))
@@ -29025,6 +29224,16 @@ func (ptr *QPainter) __drawRects_rectangles_newList2() unsafe.Pointer {
 	return unsafe.Pointer(C.QPainter___drawRects_rectangles_newList2(ptr.Pointer()))
 }
 
+func (ptr *QPainter) __drawRects_rectangles_newListBuffer2(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPainter___drawRects_rectangles_newListBuffer2(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPainter) __drawRects_rectangles_fillList2(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPainter___drawRects_rectangles_fillList2(ptr.Pointer(), data)
+	}
+}
+
 type QPainterPath struct {
 	ptr unsafe.Pointer
 }
@@ -29658,13 +29867,13 @@ func (ptr *QPainterPathStroker) SetDashPattern(style core.Qt__PenStyle) {
 
 func (ptr *QPainterPathStroker) SetDashPattern2(dashPattern []float64) {
 	if ptr.Pointer() != nil {
-		C.QPainterPathStroker_SetDashPattern2(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQPainterPathStrokerFromPointer(NewQPainterPathStrokerFromPointer(nil).__setDashPattern_dashPattern_newList2())
-			for _, v := range dashPattern {
-				tmpList.__setDashPattern_dashPattern_setList2(v)
+		C.QPainterPathStroker_SetDashPattern2(ptr.Pointer(), func(l []float64) unsafe.Pointer {
+			var tmpList = make([]C.double, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.double(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQPainterPathStrokerFromPointer(nil).__setDashPattern_dashPattern_newListBuffer2(unsafe.Pointer(&tmpList[0]), len(l))
+		}(dashPattern))
 	}
 }
 
@@ -29706,8 +29915,10 @@ func (ptr *QPainterPathStroker) DashPattern() []float64 {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []float64 {
 			var out = make([]float64, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQPainterPathStrokerFromPointer(l.data).__dashPattern_atList(i)
+			var tmpList = make([]C.double, int(l.len)+1)
+			NewQPainterPathStrokerFromPointer(l.data).__dashPattern_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = float64(v)
 			}
 			return out
 		}(C.QPainterPathStroker_DashPattern(ptr.Pointer()))
@@ -29774,6 +29985,16 @@ func (ptr *QPainterPathStroker) __setDashPattern_dashPattern_newList2() unsafe.P
 	return unsafe.Pointer(C.QPainterPathStroker___setDashPattern_dashPattern_newList2(ptr.Pointer()))
 }
 
+func (ptr *QPainterPathStroker) __setDashPattern_dashPattern_newListBuffer2(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPainterPathStroker___setDashPattern_dashPattern_newListBuffer2(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPainterPathStroker) __setDashPattern_dashPattern_fillList2(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPainterPathStroker___setDashPattern_dashPattern_fillList2(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPainterPathStroker) __dashPattern_atList(i int) float64 {
 	if ptr.Pointer() != nil {
 		return float64(C.QPainterPathStroker___dashPattern_atList(ptr.Pointer(), C.int(int32(i))))
@@ -29791,6 +30012,16 @@ func (ptr *QPainterPathStroker) __dashPattern_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QPainterPathStroker___dashPattern_newList(ptr.Pointer()))
 }
 
+func (ptr *QPainterPathStroker) __dashPattern_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPainterPathStroker___dashPattern_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPainterPathStroker) __dashPattern_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPainterPathStroker___dashPattern_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QPalette struct {
 	ptr unsafe.Pointer
 }
@@ -30268,7 +30499,7 @@ func NewQPdfWriterFromPointer(ptr unsafe.Pointer) *QPdfWriter {
 }
 func NewQPdfWriter2(device core.QIODevice_ITF) *QPdfWriter {
 	var tmpValue = NewQPdfWriterFromPointer(C.QPdfWriter_NewQPdfWriter2(core.PointerFromQIODevice(device)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -30278,7 +30509,7 @@ func NewQPdfWriter(filename string) *QPdfWriter {
 	var filenameC = C.CString(filename)
 	defer C.free(unsafe.Pointer(filenameC))
 	var tmpValue = NewQPdfWriterFromPointer(C.QPdfWriter_NewQPdfWriter(filenameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -30309,7 +30540,7 @@ func (ptr *QPdfWriter) SetTitle(title string) {
 func (ptr *QPdfWriter) DestroyQPdfWriter() {
 	if ptr.Pointer() != nil {
 		C.QPdfWriter_DestroyQPdfWriter(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -30357,7 +30588,7 @@ func (ptr *QPdfWriter) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QPdfWriter) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPdfWriter___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -30378,7 +30609,7 @@ func (ptr *QPdfWriter) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QPdfWriter) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPdfWriter___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -30399,7 +30630,7 @@ func (ptr *QPdfWriter) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QPdfWriter) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPdfWriter___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -30420,7 +30651,7 @@ func (ptr *QPdfWriter) __findChildren_newList() unsafe.Pointer {
 func (ptr *QPdfWriter) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPdfWriter___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -30440,7 +30671,7 @@ func (ptr *QPdfWriter) __children_newList() unsafe.Pointer {
 
 //export callbackQPdfWriter_Event
 func callbackQPdfWriter_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -30463,7 +30694,7 @@ func (ptr *QPdfWriter) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQPdfWriter_EventFilter
 func callbackQPdfWriter_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -30486,7 +30717,7 @@ func (ptr *QPdfWriter) EventFilterDefault(watched core.QObject_ITF, event core.Q
 
 //export callbackQPdfWriter_ChildEvent
 func callbackQPdfWriter_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQPdfWriterFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -30507,7 +30738,7 @@ func (ptr *QPdfWriter) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQPdfWriter_ConnectNotify
 func callbackQPdfWriter_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQPdfWriterFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -30528,7 +30759,7 @@ func (ptr *QPdfWriter) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQPdfWriter_CustomEvent
 func callbackQPdfWriter_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPdfWriterFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -30549,7 +30780,7 @@ func (ptr *QPdfWriter) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPdfWriter_DeleteLater
 func callbackQPdfWriter_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPdfWriterFromPointer(ptr).DeleteLaterDefault()
@@ -30559,7 +30790,7 @@ func callbackQPdfWriter_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QPdfWriter) DeleteLater() {
 	if ptr.Pointer() != nil {
 		C.QPdfWriter_DeleteLater(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -30567,14 +30798,14 @@ func (ptr *QPdfWriter) DeleteLater() {
 func (ptr *QPdfWriter) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QPdfWriter_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPdfWriter_Destroyed
 func callbackQPdfWriter_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -30582,7 +30813,7 @@ func callbackQPdfWriter_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQPdfWriter_DisconnectNotify
 func callbackQPdfWriter_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQPdfWriterFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -30603,7 +30834,7 @@ func (ptr *QPdfWriter) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQPdfWriter_ObjectNameChanged
 func callbackQPdfWriter_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -30611,7 +30842,7 @@ func callbackQPdfWriter_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struc
 
 //export callbackQPdfWriter_TimerEvent
 func callbackQPdfWriter_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQPdfWriterFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -30632,7 +30863,7 @@ func (ptr *QPdfWriter) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQPdfWriter_MetaObject
 func callbackQPdfWriter_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -30655,7 +30886,7 @@ func (ptr *QPdfWriter) MetaObjectDefault() *core.QMetaObject {
 
 //export callbackQPdfWriter_NewPage
 func callbackQPdfWriter_NewPage(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "newPage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "newPage"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -30781,13 +31012,13 @@ func (ptr *QPen) SetDashOffset(offset float64) {
 
 func (ptr *QPen) SetDashPattern(pattern []float64) {
 	if ptr.Pointer() != nil {
-		C.QPen_SetDashPattern(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQPenFromPointer(NewQPenFromPointer(nil).__setDashPattern_pattern_newList())
-			for _, v := range pattern {
-				tmpList.__setDashPattern_pattern_setList(v)
+		C.QPen_SetDashPattern(ptr.Pointer(), func(l []float64) unsafe.Pointer {
+			var tmpList = make([]C.double, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.double(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQPenFromPointer(nil).__setDashPattern_pattern_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(pattern))
 	}
 }
 
@@ -30856,8 +31087,10 @@ func (ptr *QPen) DashPattern() []float64 {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []float64 {
 			var out = make([]float64, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQPenFromPointer(l.data).__dashPattern_atList(i)
+			var tmpList = make([]C.double, int(l.len)+1)
+			NewQPenFromPointer(l.data).__dashPattern_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = float64(v)
 			}
 			return out
 		}(C.QPen_DashPattern(ptr.Pointer()))
@@ -30945,6 +31178,16 @@ func (ptr *QPen) __setDashPattern_pattern_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QPen___setDashPattern_pattern_newList(ptr.Pointer()))
 }
 
+func (ptr *QPen) __setDashPattern_pattern_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPen___setDashPattern_pattern_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPen) __setDashPattern_pattern_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPen___setDashPattern_pattern_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPen) __dashPattern_atList(i int) float64 {
 	if ptr.Pointer() != nil {
 		return float64(C.QPen___dashPattern_atList(ptr.Pointer(), C.int(int32(i))))
@@ -30962,6 +31205,16 @@ func (ptr *QPen) __dashPattern_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QPen___dashPattern_newList(ptr.Pointer()))
 }
 
+func (ptr *QPen) __dashPattern_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPen___dashPattern_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPen) __dashPattern_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPen___dashPattern_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QPicture struct {
 	QPaintDevice
 }
@@ -31063,7 +31316,7 @@ func (ptr *QPicture) SetBoundingRect(r core.QRect_ITF) {
 
 //export callbackQPicture_SetData
 func callbackQPicture_SetData(ptr unsafe.Pointer, data C.struct_QtGui_PackedString, size C.uint) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setData"); signal != nil {
 		signal.(func(string, uint))(cGoUnpackString(data), uint(uint32(size)))
 	} else {
 		NewQPictureFromPointer(ptr).SetDataDefault(cGoUnpackString(data), uint(uint32(size)))
@@ -31073,14 +31326,14 @@ func callbackQPicture_SetData(ptr unsafe.Pointer, data C.struct_QtGui_PackedStri
 func (ptr *QPicture) ConnectSetData(f func(data string, size uint)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setData", f)
+		qt.ConnectSignal(ptr.Pointer(), "setData", f)
 	}
 }
 
 func (ptr *QPicture) DisconnectSetData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setData")
+		qt.DisconnectSignal(ptr.Pointer(), "setData")
 	}
 }
 
@@ -31109,7 +31362,7 @@ func (ptr *QPicture) Swap(other QPicture_ITF) {
 func (ptr *QPicture) DestroyQPicture() {
 	if ptr.Pointer() != nil {
 		C.QPicture_DestroyQPicture(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -31184,7 +31437,7 @@ func (ptr *QPicture) __outputFormats_newList() unsafe.Pointer {
 
 //export callbackQPicture_PaintEngine
 func callbackQPicture_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return PointerFromQPaintEngine(signal.(func() *QPaintEngine)())
 	}
 
@@ -31711,7 +31964,7 @@ func (ptr *QPixmap) Swap(other QPixmap_ITF) {
 func (ptr *QPixmap) DestroyQPixmap() {
 	if ptr.Pointer() != nil {
 		C.QPixmap_DestroyQPixmap(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -31897,7 +32150,7 @@ func (ptr *QPixmap) DevicePixelRatio() float64 {
 
 //export callbackQPixmap_PaintEngine
 func callbackQPixmap_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return PointerFromQPaintEngine(signal.(func() *QPaintEngine)())
 	}
 
@@ -32125,7 +32378,7 @@ func NewQPlatformSurfaceEventFromPointer(ptr unsafe.Pointer) *QPlatformSurfaceEv
 func (ptr *QPlatformSurfaceEvent) DestroyQPlatformSurfaceEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -32205,7 +32458,7 @@ func NewQPlatformSystemTrayIconFromPointer(ptr unsafe.Pointer) *QPlatformSystemT
 func (ptr *QPlatformSystemTrayIcon) DestroyQPlatformSystemTrayIcon() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -32361,13 +32614,13 @@ func NewQPolygon8(other QPolygon_ITF) *QPolygon {
 }
 
 func NewQPolygon4(v []*core.QPoint) *QPolygon {
-	var tmpValue = NewQPolygonFromPointer(C.QPolygon_NewQPolygon4(func() unsafe.Pointer {
-		var tmpList = NewQPolygonFromPointer(NewQPolygonFromPointer(nil).__QPolygon_v_newList4())
-		for _, v := range v {
-			tmpList.__QPolygon_v_setList4(v)
+	var tmpValue = NewQPolygonFromPointer(C.QPolygon_NewQPolygon4(func(l []*core.QPoint) unsafe.Pointer {
+		var tmpList = make([]unsafe.Pointer, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = core.PointerFromQPoint(v)
 		}
-		return tmpList.Pointer()
-	}()))
+		return NewQPolygonFromPointer(nil).__QPolygon_v_newListBuffer4(unsafe.Pointer(&tmpList[0]), len(l))
+	}(v)))
 	runtime.SetFinalizer(tmpValue, (*QPolygon).DestroyQPolygon)
 	return tmpValue
 }
@@ -32385,13 +32638,13 @@ func NewQPolygon5(rectangle core.QRect_ITF, closed bool) *QPolygon {
 }
 
 func NewQPolygon3(points []*core.QPoint) *QPolygon {
-	var tmpValue = NewQPolygonFromPointer(C.QPolygon_NewQPolygon3(func() unsafe.Pointer {
-		var tmpList = NewQPolygonFromPointer(NewQPolygonFromPointer(nil).__QPolygon_points_newList3())
-		for _, v := range points {
-			tmpList.__QPolygon_points_setList3(v)
+	var tmpValue = NewQPolygonFromPointer(C.QPolygon_NewQPolygon3(func(l []*core.QPoint) unsafe.Pointer {
+		var tmpList = make([]unsafe.Pointer, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = core.PointerFromQPoint(v)
 		}
-		return tmpList.Pointer()
-	}()))
+		return NewQPolygonFromPointer(nil).__QPolygon_points_newListBuffer3(unsafe.Pointer(&tmpList[0]), len(l))
+	}(points)))
 	runtime.SetFinalizer(tmpValue, (*QPolygon).DestroyQPolygon)
 	return tmpValue
 }
@@ -32546,6 +32799,16 @@ func (ptr *QPolygon) __QPolygon_v_newList4() unsafe.Pointer {
 	return unsafe.Pointer(C.QPolygon___QPolygon_v_newList4(ptr.Pointer()))
 }
 
+func (ptr *QPolygon) __QPolygon_v_newListBuffer4(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPolygon___QPolygon_v_newListBuffer4(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPolygon) __QPolygon_v_fillList4(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPolygon___QPolygon_v_fillList4(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPolygon) __QPolygon_points_atList3(i int) *core.QPoint {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPointFromPointer(C.QPolygon___QPolygon_points_atList3(ptr.Pointer(), C.int(int32(i))))
@@ -32565,10 +32828,20 @@ func (ptr *QPolygon) __QPolygon_points_newList3() unsafe.Pointer {
 	return unsafe.Pointer(C.QPolygon___QPolygon_points_newList3(ptr.Pointer()))
 }
 
+func (ptr *QPolygon) __QPolygon_points_newListBuffer3(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPolygon___QPolygon_points_newListBuffer3(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPolygon) __QPolygon_points_fillList3(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPolygon___QPolygon_points_fillList3(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPolygon) __QVector_other_atList5(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___QVector_other_atList5(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32589,7 +32862,7 @@ func (ptr *QPolygon) __QVector_other_newList5() unsafe.Pointer {
 func (ptr *QPolygon) __QVector_other_atList4(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___QVector_other_atList4(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32610,7 +32883,7 @@ func (ptr *QPolygon) __QVector_other_newList4() unsafe.Pointer {
 func (ptr *QPolygon) __fill_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___fill_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32631,7 +32904,7 @@ func (ptr *QPolygon) __fill_newList() unsafe.Pointer {
 func (ptr *QPolygon) __fromList_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___fromList_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32652,7 +32925,7 @@ func (ptr *QPolygon) __fromList_newList() unsafe.Pointer {
 func (ptr *QPolygon) __fromList_list_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___fromList_list_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32673,7 +32946,7 @@ func (ptr *QPolygon) __fromList_list_newList() unsafe.Pointer {
 func (ptr *QPolygon) __fromStdVector_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___fromStdVector_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32694,7 +32967,7 @@ func (ptr *QPolygon) __fromStdVector_newList() unsafe.Pointer {
 func (ptr *QPolygon) __append_value_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___append_value_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32715,7 +32988,7 @@ func (ptr *QPolygon) __append_value_newList3() unsafe.Pointer {
 func (ptr *QPolygon) __swap_other_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___swap_other_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32736,7 +33009,7 @@ func (ptr *QPolygon) __swap_other_newList() unsafe.Pointer {
 func (ptr *QPolygon) __toList_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___toList_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32757,7 +33030,7 @@ func (ptr *QPolygon) __toList_newList() unsafe.Pointer {
 func (ptr *QPolygon) __mid_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygon___mid_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -32826,13 +33099,13 @@ func NewQPolygonF8(other QPolygonF_ITF) *QPolygonF {
 }
 
 func NewQPolygonF4(v []*core.QPointF) *QPolygonF {
-	var tmpValue = NewQPolygonFFromPointer(C.QPolygonF_NewQPolygonF4(func() unsafe.Pointer {
-		var tmpList = NewQPolygonFFromPointer(NewQPolygonFFromPointer(nil).__QPolygonF_v_newList4())
-		for _, v := range v {
-			tmpList.__QPolygonF_v_setList4(v)
+	var tmpValue = NewQPolygonFFromPointer(C.QPolygonF_NewQPolygonF4(func(l []*core.QPointF) unsafe.Pointer {
+		var tmpList = make([]unsafe.Pointer, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = core.PointerFromQPointF(v)
 		}
-		return tmpList.Pointer()
-	}()))
+		return NewQPolygonFFromPointer(nil).__QPolygonF_v_newListBuffer4(unsafe.Pointer(&tmpList[0]), len(l))
+	}(v)))
 	runtime.SetFinalizer(tmpValue, (*QPolygonF).DestroyQPolygonF)
 	return tmpValue
 }
@@ -32856,13 +33129,13 @@ func NewQPolygonF5(rectangle core.QRectF_ITF) *QPolygonF {
 }
 
 func NewQPolygonF3(points []*core.QPointF) *QPolygonF {
-	var tmpValue = NewQPolygonFFromPointer(C.QPolygonF_NewQPolygonF3(func() unsafe.Pointer {
-		var tmpList = NewQPolygonFFromPointer(NewQPolygonFFromPointer(nil).__QPolygonF_points_newList3())
-		for _, v := range points {
-			tmpList.__QPolygonF_points_setList3(v)
+	var tmpValue = NewQPolygonFFromPointer(C.QPolygonF_NewQPolygonF3(func(l []*core.QPointF) unsafe.Pointer {
+		var tmpList = make([]unsafe.Pointer, len(l)+1)
+		for i, v := range l {
+			tmpList[i] = core.PointerFromQPointF(v)
 		}
-		return tmpList.Pointer()
-	}()))
+		return NewQPolygonFFromPointer(nil).__QPolygonF_points_newListBuffer3(unsafe.Pointer(&tmpList[0]), len(l))
+	}(points)))
 	runtime.SetFinalizer(tmpValue, (*QPolygonF).DestroyQPolygonF)
 	return tmpValue
 }
@@ -32994,6 +33267,16 @@ func (ptr *QPolygonF) __QPolygonF_v_newList4() unsafe.Pointer {
 	return unsafe.Pointer(C.QPolygonF___QPolygonF_v_newList4(ptr.Pointer()))
 }
 
+func (ptr *QPolygonF) __QPolygonF_v_newListBuffer4(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPolygonF___QPolygonF_v_newListBuffer4(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPolygonF) __QPolygonF_v_fillList4(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPolygonF___QPolygonF_v_fillList4(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPolygonF) __QPolygonF_points_atList3(i int) *core.QPointF {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPointFFromPointer(C.QPolygonF___QPolygonF_points_atList3(ptr.Pointer(), C.int(int32(i))))
@@ -33013,10 +33296,20 @@ func (ptr *QPolygonF) __QPolygonF_points_newList3() unsafe.Pointer {
 	return unsafe.Pointer(C.QPolygonF___QPolygonF_points_newList3(ptr.Pointer()))
 }
 
+func (ptr *QPolygonF) __QPolygonF_points_newListBuffer3(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPolygonF___QPolygonF_points_newListBuffer3(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPolygonF) __QPolygonF_points_fillList3(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPolygonF___QPolygonF_points_fillList3(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QPolygonF) __QVector_other_atList5(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___QVector_other_atList5(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33037,7 +33330,7 @@ func (ptr *QPolygonF) __QVector_other_newList5() unsafe.Pointer {
 func (ptr *QPolygonF) __QVector_other_atList4(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___QVector_other_atList4(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33058,7 +33351,7 @@ func (ptr *QPolygonF) __QVector_other_newList4() unsafe.Pointer {
 func (ptr *QPolygonF) __fill_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___fill_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33079,7 +33372,7 @@ func (ptr *QPolygonF) __fill_newList() unsafe.Pointer {
 func (ptr *QPolygonF) __fromList_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___fromList_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33100,7 +33393,7 @@ func (ptr *QPolygonF) __fromList_newList() unsafe.Pointer {
 func (ptr *QPolygonF) __fromList_list_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___fromList_list_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33121,7 +33414,7 @@ func (ptr *QPolygonF) __fromList_list_newList() unsafe.Pointer {
 func (ptr *QPolygonF) __fromStdVector_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___fromStdVector_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33142,7 +33435,7 @@ func (ptr *QPolygonF) __fromStdVector_newList() unsafe.Pointer {
 func (ptr *QPolygonF) __append_value_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___append_value_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33163,7 +33456,7 @@ func (ptr *QPolygonF) __append_value_newList3() unsafe.Pointer {
 func (ptr *QPolygonF) __swap_other_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___swap_other_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33184,7 +33477,7 @@ func (ptr *QPolygonF) __swap_other_newList() unsafe.Pointer {
 func (ptr *QPolygonF) __toList_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___toList_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33205,7 +33498,7 @@ func (ptr *QPolygonF) __toList_newList() unsafe.Pointer {
 func (ptr *QPolygonF) __mid_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPolygonF___mid_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -33843,14 +34136,14 @@ func NewQRasterWindowFromPointer(ptr unsafe.Pointer) *QRasterWindow {
 func (ptr *QRasterWindow) DestroyQRasterWindow() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func NewQRasterWindow(parent QWindow_ITF) *QRasterWindow {
 	var tmpValue = NewQRasterWindowFromPointer(C.QRasterWindow_NewQRasterWindow(PointerFromQWindow(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -34067,8 +34360,11 @@ func (ptr *QRawFont) AdvancesForGlyphIndexes2(glyphIndexes []uint) []*core.QPoin
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []*core.QPointF {
 			var out = make([]*core.QPointF, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQRawFontFromPointer(l.data).__advancesForGlyphIndexes_atList2(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQRawFontFromPointer(l.data).__advancesForGlyphIndexes_fillList2(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = core.NewQPointFFromPointer(v)
+				runtime.SetFinalizer(out[i], (*core.QPointF).DestroyQPointF)
 			}
 			return out
 		}(C.QRawFont_AdvancesForGlyphIndexes2(ptr.Pointer(), func() unsafe.Pointer {
@@ -34086,8 +34382,11 @@ func (ptr *QRawFont) AdvancesForGlyphIndexes(glyphIndexes []uint, layoutFlags QR
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []*core.QPointF {
 			var out = make([]*core.QPointF, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQRawFontFromPointer(l.data).__advancesForGlyphIndexes_atList(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQRawFontFromPointer(l.data).__advancesForGlyphIndexes_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = core.NewQPointFFromPointer(v)
+				runtime.SetFinalizer(out[i], (*core.QPointF).DestroyQPointF)
 			}
 			return out
 		}(C.QRawFont_AdvancesForGlyphIndexes(ptr.Pointer(), func() unsafe.Pointer {
@@ -34278,6 +34577,16 @@ func (ptr *QRawFont) __advancesForGlyphIndexes_newList2() unsafe.Pointer {
 	return unsafe.Pointer(C.QRawFont___advancesForGlyphIndexes_newList2(ptr.Pointer()))
 }
 
+func (ptr *QRawFont) __advancesForGlyphIndexes_newListBuffer2(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QRawFont___advancesForGlyphIndexes_newListBuffer2(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QRawFont) __advancesForGlyphIndexes_fillList2(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QRawFont___advancesForGlyphIndexes_fillList2(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QRawFont) __advancesForGlyphIndexes_glyphIndexes_atList2(i int) uint {
 	if ptr.Pointer() != nil {
 		return uint(uint32(C.QRawFont___advancesForGlyphIndexes_glyphIndexes_atList2(ptr.Pointer(), C.int(int32(i)))))
@@ -34314,6 +34623,16 @@ func (ptr *QRawFont) __advancesForGlyphIndexes_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QRawFont___advancesForGlyphIndexes_newList(ptr.Pointer()))
 }
 
+func (ptr *QRawFont) __advancesForGlyphIndexes_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QRawFont___advancesForGlyphIndexes_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QRawFont) __advancesForGlyphIndexes_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QRawFont___advancesForGlyphIndexes_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QRawFont) __advancesForGlyphIndexes_glyphIndexes_atList(i int) uint {
 	if ptr.Pointer() != nil {
 		return uint(uint32(C.QRawFont___advancesForGlyphIndexes_glyphIndexes_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -34388,7 +34707,7 @@ func NewQRegExpValidatorFromPointer(ptr unsafe.Pointer) *QRegExpValidator {
 }
 func NewQRegExpValidator(parent core.QObject_ITF) *QRegExpValidator {
 	var tmpValue = NewQRegExpValidatorFromPointer(C.QRegExpValidator_NewQRegExpValidator(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -34396,7 +34715,7 @@ func NewQRegExpValidator(parent core.QObject_ITF) *QRegExpValidator {
 
 func NewQRegExpValidator2(rx core.QRegExp_ITF, parent core.QObject_ITF) *QRegExpValidator {
 	var tmpValue = NewQRegExpValidatorFromPointer(C.QRegExpValidator_NewQRegExpValidator2(core.PointerFromQRegExp(rx), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -34411,14 +34730,14 @@ func (ptr *QRegExpValidator) SetRegExp(rx core.QRegExp_ITF) {
 func (ptr *QRegExpValidator) DestroyQRegExpValidator() {
 	if ptr.Pointer() != nil {
 		C.QRegExpValidator_DestroyQRegExpValidator(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQRegExpValidator_Validate
 func callbackQRegExpValidator_Validate(ptr unsafe.Pointer, input C.struct_QtGui_PackedString, pos C.int) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "validate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "validate"); signal != nil {
 		return C.longlong(signal.(func(string, int) QValidator__State)(cGoUnpackString(input), int(int32(pos))))
 	}
 
@@ -34428,14 +34747,14 @@ func callbackQRegExpValidator_Validate(ptr unsafe.Pointer, input C.struct_QtGui_
 func (ptr *QRegExpValidator) ConnectValidate(f func(input string, pos int) QValidator__State) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "validate", f)
+		qt.ConnectSignal(ptr.Pointer(), "validate", f)
 	}
 }
 
 func (ptr *QRegExpValidator) DisconnectValidate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "validate")
+		qt.DisconnectSignal(ptr.Pointer(), "validate")
 	}
 }
 
@@ -34669,8 +34988,11 @@ func (ptr *QRegion) Rects() []*core.QRect {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []*core.QRect {
 			var out = make([]*core.QRect, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQRegionFromPointer(l.data).__rects_atList(i)
+			var tmpList = make([]unsafe.Pointer, int(l.len)+1)
+			NewQRegionFromPointer(l.data).__rects_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = core.NewQRectFromPointer(v)
+				runtime.SetFinalizer(out[i], (*core.QRect).DestroyQRect)
 			}
 			return out
 		}(C.QRegion_Rects(ptr.Pointer()))
@@ -34746,6 +35068,16 @@ func (ptr *QRegion) __rects_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QRegion___rects_newList(ptr.Pointer()))
 }
 
+func (ptr *QRegion) __rects_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QRegion___rects_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QRegion) __rects_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QRegion___rects_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QRegularExpressionValidator struct {
 	QValidator
 }
@@ -34786,7 +35118,7 @@ func NewQRegularExpressionValidatorFromPointer(ptr unsafe.Pointer) *QRegularExpr
 }
 func NewQRegularExpressionValidator(parent core.QObject_ITF) *QRegularExpressionValidator {
 	var tmpValue = NewQRegularExpressionValidatorFromPointer(C.QRegularExpressionValidator_NewQRegularExpressionValidator(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -34794,7 +35126,7 @@ func NewQRegularExpressionValidator(parent core.QObject_ITF) *QRegularExpression
 
 func NewQRegularExpressionValidator2(re core.QRegularExpression_ITF, parent core.QObject_ITF) *QRegularExpressionValidator {
 	var tmpValue = NewQRegularExpressionValidatorFromPointer(C.QRegularExpressionValidator_NewQRegularExpressionValidator2(core.PointerFromQRegularExpression(re), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -34802,7 +35134,7 @@ func NewQRegularExpressionValidator2(re core.QRegularExpression_ITF, parent core
 
 //export callbackQRegularExpressionValidator_RegularExpressionChanged
 func callbackQRegularExpressionValidator_RegularExpressionChanged(ptr unsafe.Pointer, re unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "regularExpressionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "regularExpressionChanged"); signal != nil {
 		signal.(func(*core.QRegularExpression))(core.NewQRegularExpressionFromPointer(re))
 	}
 
@@ -34811,14 +35143,14 @@ func callbackQRegularExpressionValidator_RegularExpressionChanged(ptr unsafe.Poi
 func (ptr *QRegularExpressionValidator) ConnectRegularExpressionChanged(f func(re *core.QRegularExpression)) {
 	if ptr.Pointer() != nil {
 		C.QRegularExpressionValidator_ConnectRegularExpressionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "regularExpressionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "regularExpressionChanged", f)
 	}
 }
 
 func (ptr *QRegularExpressionValidator) DisconnectRegularExpressionChanged() {
 	if ptr.Pointer() != nil {
 		C.QRegularExpressionValidator_DisconnectRegularExpressionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "regularExpressionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "regularExpressionChanged")
 	}
 }
 
@@ -34830,7 +35162,7 @@ func (ptr *QRegularExpressionValidator) RegularExpressionChanged(re core.QRegula
 
 //export callbackQRegularExpressionValidator_SetRegularExpression
 func callbackQRegularExpressionValidator_SetRegularExpression(ptr unsafe.Pointer, re unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRegularExpression"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRegularExpression"); signal != nil {
 		signal.(func(*core.QRegularExpression))(core.NewQRegularExpressionFromPointer(re))
 	} else {
 		NewQRegularExpressionValidatorFromPointer(ptr).SetRegularExpressionDefault(core.NewQRegularExpressionFromPointer(re))
@@ -34840,14 +35172,14 @@ func callbackQRegularExpressionValidator_SetRegularExpression(ptr unsafe.Pointer
 func (ptr *QRegularExpressionValidator) ConnectSetRegularExpression(f func(re *core.QRegularExpression)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setRegularExpression", f)
+		qt.ConnectSignal(ptr.Pointer(), "setRegularExpression", f)
 	}
 }
 
 func (ptr *QRegularExpressionValidator) DisconnectSetRegularExpression() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setRegularExpression")
+		qt.DisconnectSignal(ptr.Pointer(), "setRegularExpression")
 	}
 }
 
@@ -34866,7 +35198,7 @@ func (ptr *QRegularExpressionValidator) SetRegularExpressionDefault(re core.QReg
 func (ptr *QRegularExpressionValidator) DestroyQRegularExpressionValidator() {
 	if ptr.Pointer() != nil {
 		C.QRegularExpressionValidator_DestroyQRegularExpressionValidator(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -34882,7 +35214,7 @@ func (ptr *QRegularExpressionValidator) RegularExpression() *core.QRegularExpres
 
 //export callbackQRegularExpressionValidator_Validate
 func callbackQRegularExpressionValidator_Validate(ptr unsafe.Pointer, input C.struct_QtGui_PackedString, pos C.int) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "validate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "validate"); signal != nil {
 		return C.longlong(signal.(func(string, int) QValidator__State)(cGoUnpackString(input), int(int32(pos))))
 	}
 
@@ -34892,14 +35224,14 @@ func callbackQRegularExpressionValidator_Validate(ptr unsafe.Pointer, input C.st
 func (ptr *QRegularExpressionValidator) ConnectValidate(f func(input string, pos int) QValidator__State) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "validate", f)
+		qt.ConnectSignal(ptr.Pointer(), "validate", f)
 	}
 }
 
 func (ptr *QRegularExpressionValidator) DisconnectValidate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "validate")
+		qt.DisconnectSignal(ptr.Pointer(), "validate")
 	}
 }
 
@@ -34963,7 +35295,7 @@ func NewQResizeEventFromPointer(ptr unsafe.Pointer) *QResizeEvent {
 func (ptr *QResizeEvent) DestroyQResizeEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -35188,7 +35520,7 @@ func (ptr *QScreen) GrabWindow(window uintptr, x int, y int, width int, height i
 
 //export callbackQScreen_AvailableGeometryChanged
 func callbackQScreen_AvailableGeometryChanged(ptr unsafe.Pointer, geometry unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "availableGeometryChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "availableGeometryChanged"); signal != nil {
 		signal.(func(*core.QRect))(core.NewQRectFromPointer(geometry))
 	}
 
@@ -35197,14 +35529,14 @@ func callbackQScreen_AvailableGeometryChanged(ptr unsafe.Pointer, geometry unsaf
 func (ptr *QScreen) ConnectAvailableGeometryChanged(f func(geometry *core.QRect)) {
 	if ptr.Pointer() != nil {
 		C.QScreen_ConnectAvailableGeometryChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "availableGeometryChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "availableGeometryChanged", f)
 	}
 }
 
 func (ptr *QScreen) DisconnectAvailableGeometryChanged() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DisconnectAvailableGeometryChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "availableGeometryChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "availableGeometryChanged")
 	}
 }
 
@@ -35216,7 +35548,7 @@ func (ptr *QScreen) AvailableGeometryChanged(geometry core.QRect_ITF) {
 
 //export callbackQScreen_GeometryChanged
 func callbackQScreen_GeometryChanged(ptr unsafe.Pointer, geometry unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "geometryChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "geometryChanged"); signal != nil {
 		signal.(func(*core.QRect))(core.NewQRectFromPointer(geometry))
 	}
 
@@ -35225,14 +35557,14 @@ func callbackQScreen_GeometryChanged(ptr unsafe.Pointer, geometry unsafe.Pointer
 func (ptr *QScreen) ConnectGeometryChanged(f func(geometry *core.QRect)) {
 	if ptr.Pointer() != nil {
 		C.QScreen_ConnectGeometryChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "geometryChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "geometryChanged", f)
 	}
 }
 
 func (ptr *QScreen) DisconnectGeometryChanged() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DisconnectGeometryChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "geometryChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "geometryChanged")
 	}
 }
 
@@ -35244,7 +35576,7 @@ func (ptr *QScreen) GeometryChanged(geometry core.QRect_ITF) {
 
 //export callbackQScreen_LogicalDotsPerInchChanged
 func callbackQScreen_LogicalDotsPerInchChanged(ptr unsafe.Pointer, dpi C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "logicalDotsPerInchChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "logicalDotsPerInchChanged"); signal != nil {
 		signal.(func(float64))(float64(dpi))
 	}
 
@@ -35253,14 +35585,14 @@ func callbackQScreen_LogicalDotsPerInchChanged(ptr unsafe.Pointer, dpi C.double)
 func (ptr *QScreen) ConnectLogicalDotsPerInchChanged(f func(dpi float64)) {
 	if ptr.Pointer() != nil {
 		C.QScreen_ConnectLogicalDotsPerInchChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "logicalDotsPerInchChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "logicalDotsPerInchChanged", f)
 	}
 }
 
 func (ptr *QScreen) DisconnectLogicalDotsPerInchChanged() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DisconnectLogicalDotsPerInchChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "logicalDotsPerInchChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "logicalDotsPerInchChanged")
 	}
 }
 
@@ -35272,7 +35604,7 @@ func (ptr *QScreen) LogicalDotsPerInchChanged(dpi float64) {
 
 //export callbackQScreen_OrientationChanged
 func callbackQScreen_OrientationChanged(ptr unsafe.Pointer, orientation C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "orientationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "orientationChanged"); signal != nil {
 		signal.(func(core.Qt__ScreenOrientation))(core.Qt__ScreenOrientation(orientation))
 	}
 
@@ -35281,14 +35613,14 @@ func callbackQScreen_OrientationChanged(ptr unsafe.Pointer, orientation C.longlo
 func (ptr *QScreen) ConnectOrientationChanged(f func(orientation core.Qt__ScreenOrientation)) {
 	if ptr.Pointer() != nil {
 		C.QScreen_ConnectOrientationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "orientationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "orientationChanged", f)
 	}
 }
 
 func (ptr *QScreen) DisconnectOrientationChanged() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DisconnectOrientationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "orientationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "orientationChanged")
 	}
 }
 
@@ -35300,7 +35632,7 @@ func (ptr *QScreen) OrientationChanged(orientation core.Qt__ScreenOrientation) {
 
 //export callbackQScreen_PhysicalDotsPerInchChanged
 func callbackQScreen_PhysicalDotsPerInchChanged(ptr unsafe.Pointer, dpi C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "physicalDotsPerInchChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "physicalDotsPerInchChanged"); signal != nil {
 		signal.(func(float64))(float64(dpi))
 	}
 
@@ -35309,14 +35641,14 @@ func callbackQScreen_PhysicalDotsPerInchChanged(ptr unsafe.Pointer, dpi C.double
 func (ptr *QScreen) ConnectPhysicalDotsPerInchChanged(f func(dpi float64)) {
 	if ptr.Pointer() != nil {
 		C.QScreen_ConnectPhysicalDotsPerInchChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "physicalDotsPerInchChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "physicalDotsPerInchChanged", f)
 	}
 }
 
 func (ptr *QScreen) DisconnectPhysicalDotsPerInchChanged() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DisconnectPhysicalDotsPerInchChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "physicalDotsPerInchChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "physicalDotsPerInchChanged")
 	}
 }
 
@@ -35328,7 +35660,7 @@ func (ptr *QScreen) PhysicalDotsPerInchChanged(dpi float64) {
 
 //export callbackQScreen_PhysicalSizeChanged
 func callbackQScreen_PhysicalSizeChanged(ptr unsafe.Pointer, size unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "physicalSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "physicalSizeChanged"); signal != nil {
 		signal.(func(*core.QSizeF))(core.NewQSizeFFromPointer(size))
 	}
 
@@ -35337,14 +35669,14 @@ func callbackQScreen_PhysicalSizeChanged(ptr unsafe.Pointer, size unsafe.Pointer
 func (ptr *QScreen) ConnectPhysicalSizeChanged(f func(size *core.QSizeF)) {
 	if ptr.Pointer() != nil {
 		C.QScreen_ConnectPhysicalSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "physicalSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "physicalSizeChanged", f)
 	}
 }
 
 func (ptr *QScreen) DisconnectPhysicalSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DisconnectPhysicalSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "physicalSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "physicalSizeChanged")
 	}
 }
 
@@ -35356,7 +35688,7 @@ func (ptr *QScreen) PhysicalSizeChanged(size core.QSizeF_ITF) {
 
 //export callbackQScreen_PrimaryOrientationChanged
 func callbackQScreen_PrimaryOrientationChanged(ptr unsafe.Pointer, orientation C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "primaryOrientationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "primaryOrientationChanged"); signal != nil {
 		signal.(func(core.Qt__ScreenOrientation))(core.Qt__ScreenOrientation(orientation))
 	}
 
@@ -35365,14 +35697,14 @@ func callbackQScreen_PrimaryOrientationChanged(ptr unsafe.Pointer, orientation C
 func (ptr *QScreen) ConnectPrimaryOrientationChanged(f func(orientation core.Qt__ScreenOrientation)) {
 	if ptr.Pointer() != nil {
 		C.QScreen_ConnectPrimaryOrientationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "primaryOrientationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "primaryOrientationChanged", f)
 	}
 }
 
 func (ptr *QScreen) DisconnectPrimaryOrientationChanged() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DisconnectPrimaryOrientationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "primaryOrientationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "primaryOrientationChanged")
 	}
 }
 
@@ -35384,7 +35716,7 @@ func (ptr *QScreen) PrimaryOrientationChanged(orientation core.Qt__ScreenOrienta
 
 //export callbackQScreen_RefreshRateChanged
 func callbackQScreen_RefreshRateChanged(ptr unsafe.Pointer, refreshRate C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "refreshRateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "refreshRateChanged"); signal != nil {
 		signal.(func(float64))(float64(refreshRate))
 	}
 
@@ -35393,14 +35725,14 @@ func callbackQScreen_RefreshRateChanged(ptr unsafe.Pointer, refreshRate C.double
 func (ptr *QScreen) ConnectRefreshRateChanged(f func(refreshRate float64)) {
 	if ptr.Pointer() != nil {
 		C.QScreen_ConnectRefreshRateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "refreshRateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "refreshRateChanged", f)
 	}
 }
 
 func (ptr *QScreen) DisconnectRefreshRateChanged() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DisconnectRefreshRateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "refreshRateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "refreshRateChanged")
 	}
 }
 
@@ -35418,7 +35750,7 @@ func (ptr *QScreen) SetOrientationUpdateMask(mask core.Qt__ScreenOrientation) {
 
 //export callbackQScreen_VirtualGeometryChanged
 func callbackQScreen_VirtualGeometryChanged(ptr unsafe.Pointer, rect unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "virtualGeometryChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "virtualGeometryChanged"); signal != nil {
 		signal.(func(*core.QRect))(core.NewQRectFromPointer(rect))
 	}
 
@@ -35427,14 +35759,14 @@ func callbackQScreen_VirtualGeometryChanged(ptr unsafe.Pointer, rect unsafe.Poin
 func (ptr *QScreen) ConnectVirtualGeometryChanged(f func(rect *core.QRect)) {
 	if ptr.Pointer() != nil {
 		C.QScreen_ConnectVirtualGeometryChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "virtualGeometryChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "virtualGeometryChanged", f)
 	}
 }
 
 func (ptr *QScreen) DisconnectVirtualGeometryChanged() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DisconnectVirtualGeometryChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "virtualGeometryChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "virtualGeometryChanged")
 	}
 }
 
@@ -35447,7 +35779,7 @@ func (ptr *QScreen) VirtualGeometryChanged(rect core.QRect_ITF) {
 func (ptr *QScreen) DestroyQScreen() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DestroyQScreen(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -35686,7 +36018,7 @@ func (ptr *QScreen) RefreshRate() float64 {
 func (ptr *QScreen) __virtualSiblings_atList(i int) *QScreen {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScreenFromPointer(C.QScreen___virtualSiblings_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -35726,7 +36058,7 @@ func (ptr *QScreen) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QScreen) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScreen___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -35747,7 +36079,7 @@ func (ptr *QScreen) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QScreen) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScreen___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -35768,7 +36100,7 @@ func (ptr *QScreen) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QScreen) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScreen___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -35789,7 +36121,7 @@ func (ptr *QScreen) __findChildren_newList() unsafe.Pointer {
 func (ptr *QScreen) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScreen___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -35809,7 +36141,7 @@ func (ptr *QScreen) __children_newList() unsafe.Pointer {
 
 //export callbackQScreen_Event
 func callbackQScreen_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -35825,7 +36157,7 @@ func (ptr *QScreen) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQScreen_EventFilter
 func callbackQScreen_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -35841,7 +36173,7 @@ func (ptr *QScreen) EventFilterDefault(watched core.QObject_ITF, event core.QEve
 
 //export callbackQScreen_ChildEvent
 func callbackQScreen_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQScreenFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -35856,7 +36188,7 @@ func (ptr *QScreen) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQScreen_ConnectNotify
 func callbackQScreen_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScreenFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -35871,7 +36203,7 @@ func (ptr *QScreen) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQScreen_CustomEvent
 func callbackQScreen_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQScreenFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -35886,7 +36218,7 @@ func (ptr *QScreen) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQScreen_DeleteLater
 func callbackQScreen_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScreenFromPointer(ptr).DeleteLaterDefault()
@@ -35896,14 +36228,14 @@ func callbackQScreen_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QScreen) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QScreen_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScreen_Destroyed
 func callbackQScreen_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -35911,7 +36243,7 @@ func callbackQScreen_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQScreen_DisconnectNotify
 func callbackQScreen_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScreenFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -35926,7 +36258,7 @@ func (ptr *QScreen) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQScreen_ObjectNameChanged
 func callbackQScreen_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -35934,7 +36266,7 @@ func callbackQScreen_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_Q
 
 //export callbackQScreen_TimerEvent
 func callbackQScreen_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQScreenFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -35949,7 +36281,7 @@ func (ptr *QScreen) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQScreen_MetaObject
 func callbackQScreen_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -36019,7 +36351,7 @@ func NewQScrollEvent(contentPos core.QPointF_ITF, overshootDistance core.QPointF
 func (ptr *QScrollEvent) DestroyQScrollEvent() {
 	if ptr.Pointer() != nil {
 		C.QScrollEvent_DestroyQScrollEvent(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -36112,7 +36444,7 @@ func (ptr *QScrollPrepareEvent) SetViewportSize(size core.QSizeF_ITF) {
 func (ptr *QScrollPrepareEvent) DestroyQScrollPrepareEvent() {
 	if ptr.Pointer() != nil {
 		C.QScrollPrepareEvent_DestroyQScrollPrepareEvent(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -36195,7 +36527,7 @@ func NewQSessionManagerFromPointer(ptr unsafe.Pointer) *QSessionManager {
 func (ptr *QSessionManager) DestroyQSessionManager() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -36245,7 +36577,7 @@ func (ptr *QSessionManager) RequestPhase2() {
 
 func (ptr *QSessionManager) SetDiscardCommand(command []string) {
 	if ptr.Pointer() != nil {
-		var commandC = C.CString(strings.Join(command, "|"))
+		var commandC = cGoPackStringList(command)
 		defer C.free(unsafe.Pointer(commandC))
 		C.QSessionManager_SetDiscardCommand(ptr.Pointer(), commandC)
 	}
@@ -36265,7 +36597,7 @@ func (ptr *QSessionManager) SetManagerProperty(name string, value []string) {
 	if ptr.Pointer() != nil {
 		var nameC = C.CString(name)
 		defer C.free(unsafe.Pointer(nameC))
-		var valueC = C.CString(strings.Join(value, "|"))
+		var valueC = cGoPackStringList(value)
 		defer C.free(unsafe.Pointer(valueC))
 		C.QSessionManager_SetManagerProperty(ptr.Pointer(), nameC, valueC)
 	}
@@ -36273,7 +36605,7 @@ func (ptr *QSessionManager) SetManagerProperty(name string, value []string) {
 
 func (ptr *QSessionManager) SetRestartCommand(command []string) {
 	if ptr.Pointer() != nil {
-		var commandC = C.CString(strings.Join(command, "|"))
+		var commandC = cGoPackStringList(command)
 		defer C.free(unsafe.Pointer(commandC))
 		C.QSessionManager_SetRestartCommand(ptr.Pointer(), commandC)
 	}
@@ -36301,14 +36633,14 @@ func (ptr *QSessionManager) SessionKey() string {
 
 func (ptr *QSessionManager) DiscardCommand() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSessionManager_DiscardCommand(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSessionManager_DiscardCommand(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSessionManager) RestartCommand() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSessionManager_RestartCommand(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSessionManager_RestartCommand(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -36349,7 +36681,7 @@ func (ptr *QSessionManager) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSessionManager) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSessionManager___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -36370,7 +36702,7 @@ func (ptr *QSessionManager) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSessionManager) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSessionManager___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -36391,7 +36723,7 @@ func (ptr *QSessionManager) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSessionManager) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSessionManager___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -36412,7 +36744,7 @@ func (ptr *QSessionManager) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSessionManager) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSessionManager___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -36432,7 +36764,7 @@ func (ptr *QSessionManager) __children_newList() unsafe.Pointer {
 
 //export callbackQSessionManager_Event
 func callbackQSessionManager_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -36448,7 +36780,7 @@ func (ptr *QSessionManager) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSessionManager_EventFilter
 func callbackQSessionManager_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -36464,7 +36796,7 @@ func (ptr *QSessionManager) EventFilterDefault(watched core.QObject_ITF, event c
 
 //export callbackQSessionManager_ChildEvent
 func callbackQSessionManager_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSessionManagerFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -36479,7 +36811,7 @@ func (ptr *QSessionManager) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSessionManager_ConnectNotify
 func callbackQSessionManager_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSessionManagerFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -36494,7 +36826,7 @@ func (ptr *QSessionManager) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSessionManager_CustomEvent
 func callbackQSessionManager_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSessionManagerFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -36509,7 +36841,7 @@ func (ptr *QSessionManager) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSessionManager_DeleteLater
 func callbackQSessionManager_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSessionManagerFromPointer(ptr).DeleteLaterDefault()
@@ -36519,14 +36851,14 @@ func callbackQSessionManager_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSessionManager) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSessionManager_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSessionManager_Destroyed
 func callbackQSessionManager_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -36534,7 +36866,7 @@ func callbackQSessionManager_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSessionManager_DisconnectNotify
 func callbackQSessionManager_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSessionManagerFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -36549,7 +36881,7 @@ func (ptr *QSessionManager) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSessionManager_ObjectNameChanged
 func callbackQSessionManager_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -36557,7 +36889,7 @@ func callbackQSessionManager_ObjectNameChanged(ptr unsafe.Pointer, objectName C.
 
 //export callbackQSessionManager_TimerEvent
 func callbackQSessionManager_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSessionManagerFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -36572,7 +36904,7 @@ func (ptr *QSessionManager) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSessionManager_MetaObject
 func callbackQSessionManager_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -36631,7 +36963,7 @@ func NewQShortcutEvent(key QKeySequence_ITF, id int, ambiguous bool) *QShortcutE
 func (ptr *QShortcutEvent) DestroyQShortcutEvent() {
 	if ptr.Pointer() != nil {
 		C.QShortcutEvent_DestroyQShortcutEvent(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -36740,7 +37072,7 @@ func NewQShowEventFromPointer(ptr unsafe.Pointer) *QShowEvent {
 func (ptr *QShowEvent) DestroyQShowEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -36957,7 +37289,7 @@ func (ptr *QStandardItem) InsertRows2(row int, count int) {
 
 //export callbackQStandardItem_Read
 func callbackQStandardItem_Read(ptr unsafe.Pointer, in unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "read"); signal != nil {
+	if signal := qt.GetSignal(ptr, "read"); signal != nil {
 		signal.(func(*core.QDataStream))(core.NewQDataStreamFromPointer(in))
 	} else {
 		NewQStandardItemFromPointer(ptr).ReadDefault(core.NewQDataStreamFromPointer(in))
@@ -36967,14 +37299,14 @@ func callbackQStandardItem_Read(ptr unsafe.Pointer, in unsafe.Pointer) {
 func (ptr *QStandardItem) ConnectRead(f func(in *core.QDataStream)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "read", f)
+		qt.ConnectSignal(ptr.Pointer(), "read", f)
 	}
 }
 
 func (ptr *QStandardItem) DisconnectRead() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "read")
+		qt.DisconnectSignal(ptr.Pointer(), "read")
 	}
 }
 
@@ -37074,7 +37406,7 @@ func (ptr *QStandardItem) SetColumnCount(columns int) {
 
 //export callbackQStandardItem_SetData
 func callbackQStandardItem_SetData(ptr unsafe.Pointer, value unsafe.Pointer, role C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setData"); signal != nil {
 		signal.(func(*core.QVariant, int))(core.NewQVariantFromPointer(value), int(int32(role)))
 	} else {
 		NewQStandardItemFromPointer(ptr).SetDataDefault(core.NewQVariantFromPointer(value), int(int32(role)))
@@ -37084,14 +37416,14 @@ func callbackQStandardItem_SetData(ptr unsafe.Pointer, value unsafe.Pointer, rol
 func (ptr *QStandardItem) ConnectSetData(f func(value *core.QVariant, role int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setData", f)
+		qt.ConnectSignal(ptr.Pointer(), "setData", f)
 	}
 }
 
 func (ptr *QStandardItem) DisconnectSetData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setData")
+		qt.DisconnectSignal(ptr.Pointer(), "setData")
 	}
 }
 
@@ -37225,7 +37557,7 @@ func (ptr *QStandardItem) SortChildren(column int, order core.Qt__SortOrder) {
 
 //export callbackQStandardItem_DestroyQStandardItem
 func callbackQStandardItem_DestroyQStandardItem(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QStandardItem"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QStandardItem"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQStandardItemFromPointer(ptr).DestroyQStandardItemDefault()
@@ -37235,21 +37567,21 @@ func callbackQStandardItem_DestroyQStandardItem(ptr unsafe.Pointer) {
 func (ptr *QStandardItem) ConnectDestroyQStandardItem(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QStandardItem", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QStandardItem", f)
 	}
 }
 
 func (ptr *QStandardItem) DisconnectDestroyQStandardItem() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QStandardItem")
+		qt.DisconnectSignal(ptr.Pointer(), "~QStandardItem")
 	}
 }
 
 func (ptr *QStandardItem) DestroyQStandardItem() {
 	if ptr.Pointer() != nil {
 		C.QStandardItem_DestroyQStandardItem(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -37257,7 +37589,7 @@ func (ptr *QStandardItem) DestroyQStandardItem() {
 func (ptr *QStandardItem) DestroyQStandardItemDefault() {
 	if ptr.Pointer() != nil {
 		C.QStandardItem_DestroyQStandardItemDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -37325,7 +37657,7 @@ func (ptr *QStandardItem) Child(row int, column int) *QStandardItem {
 
 //export callbackQStandardItem_Clone
 func callbackQStandardItem_Clone(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clone"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clone"); signal != nil {
 		return PointerFromQStandardItem(signal.(func() *QStandardItem)())
 	}
 
@@ -37335,14 +37667,14 @@ func callbackQStandardItem_Clone(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QStandardItem) ConnectClone(f func() *QStandardItem) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clone", f)
+		qt.ConnectSignal(ptr.Pointer(), "clone", f)
 	}
 }
 
 func (ptr *QStandardItem) DisconnectClone() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clone")
+		qt.DisconnectSignal(ptr.Pointer(), "clone")
 	}
 }
 
@@ -37370,7 +37702,7 @@ func (ptr *QStandardItem) Parent() *QStandardItem {
 func (ptr *QStandardItem) Model() *QStandardItemModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQStandardItemModelFromPointer(C.QStandardItem_Model(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -37422,7 +37754,7 @@ func (ptr *QStandardItem) WhatsThis() string {
 
 //export callbackQStandardItem_Data
 func callbackQStandardItem_Data(ptr unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(int) *core.QVariant)(int(int32(role))))
 	}
 
@@ -37432,14 +37764,14 @@ func callbackQStandardItem_Data(ptr unsafe.Pointer, role C.int) unsafe.Pointer {
 func (ptr *QStandardItem) ConnectData(f func(role int) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QStandardItem) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
@@ -37575,7 +37907,7 @@ func (ptr *QStandardItem) RowCount() int {
 
 //export callbackQStandardItem_Type
 func callbackQStandardItem_Type(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -37585,14 +37917,14 @@ func callbackQStandardItem_Type(ptr unsafe.Pointer) C.int {
 func (ptr *QStandardItem) ConnectType(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QStandardItem) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -37612,7 +37944,7 @@ func (ptr *QStandardItem) TypeDefault() int {
 
 //export callbackQStandardItem_Write
 func callbackQStandardItem_Write(ptr unsafe.Pointer, out unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "write"); signal != nil {
+	if signal := qt.GetSignal(ptr, "write"); signal != nil {
 		signal.(func(*core.QDataStream))(core.NewQDataStreamFromPointer(out))
 	} else {
 		NewQStandardItemFromPointer(ptr).WriteDefault(core.NewQDataStreamFromPointer(out))
@@ -37622,14 +37954,14 @@ func callbackQStandardItem_Write(ptr unsafe.Pointer, out unsafe.Pointer) {
 func (ptr *QStandardItem) ConnectWrite(f func(out *core.QDataStream)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "write", f)
+		qt.ConnectSignal(ptr.Pointer(), "write", f)
 	}
 }
 
 func (ptr *QStandardItem) DisconnectWrite() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "write")
+		qt.DisconnectSignal(ptr.Pointer(), "write")
 	}
 }
 
@@ -37868,7 +38200,7 @@ func (ptr *QStandardItemModel) TakeVerticalHeaderItem(row int) *QStandardItem {
 
 func NewQStandardItemModel(parent core.QObject_ITF) *QStandardItemModel {
 	var tmpValue = NewQStandardItemModelFromPointer(C.QStandardItemModel_NewQStandardItemModel(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -37876,7 +38208,7 @@ func NewQStandardItemModel(parent core.QObject_ITF) *QStandardItemModel {
 
 func NewQStandardItemModel2(rows int, columns int, parent core.QObject_ITF) *QStandardItemModel {
 	var tmpValue = NewQStandardItemModelFromPointer(C.QStandardItemModel_NewQStandardItemModel2(C.int(int32(rows)), C.int(int32(columns)), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -37884,7 +38216,7 @@ func NewQStandardItemModel2(rows int, columns int, parent core.QObject_ITF) *QSt
 
 //export callbackQStandardItemModel_DropMimeData
 func callbackQStandardItemModel_DropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QMimeData, core.Qt__DropAction, int, int, *core.QModelIndex) bool)(core.NewQMimeDataFromPointer(data), core.Qt__DropAction(action), int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -37900,7 +38232,7 @@ func (ptr *QStandardItemModel) DropMimeDataDefault(data core.QMimeData_ITF, acti
 
 //export callbackQStandardItemModel_InsertColumns
 func callbackQStandardItemModel_InsertColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(column)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -37916,7 +38248,7 @@ func (ptr *QStandardItemModel) InsertColumnsDefault(column int, count int, paren
 
 //export callbackQStandardItemModel_InsertRows
 func callbackQStandardItemModel_InsertRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(row)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -37932,7 +38264,7 @@ func (ptr *QStandardItemModel) InsertRowsDefault(row int, count int, parent core
 
 //export callbackQStandardItemModel_RemoveColumns
 func callbackQStandardItemModel_RemoveColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(column)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -37948,7 +38280,7 @@ func (ptr *QStandardItemModel) RemoveColumnsDefault(column int, count int, paren
 
 //export callbackQStandardItemModel_RemoveRows
 func callbackQStandardItemModel_RemoveRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(row)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -37964,7 +38296,7 @@ func (ptr *QStandardItemModel) RemoveRowsDefault(row int, count int, parent core
 
 //export callbackQStandardItemModel_SetData
 func callbackQStandardItemModel_SetData(ptr unsafe.Pointer, index unsafe.Pointer, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, *core.QVariant, int) bool)(core.NewQModelIndexFromPointer(index), core.NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -37980,7 +38312,7 @@ func (ptr *QStandardItemModel) SetDataDefault(index core.QModelIndex_ITF, value
 
 //export callbackQStandardItemModel_SetHeaderData
 func callbackQStandardItemModel_SetHeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHeaderData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHeaderData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, core.Qt__Orientation, *core.QVariant, int) bool)(int(int32(section)), core.Qt__Orientation(orientation), core.NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -37996,7 +38328,7 @@ func (ptr *QStandardItemModel) SetHeaderDataDefault(section int, orientation cor
 
 //export callbackQStandardItemModel_SetItemData
 func callbackQStandardItemModel_SetItemData(ptr unsafe.Pointer, index unsafe.Pointer, roles C.struct_QtGui_PackedList) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setItemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setItemData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, map[int]*core.QVariant) bool)(core.NewQModelIndexFromPointer(index), func(l C.struct_QtGui_PackedList) map[int]*core.QVariant {
 			var out = make(map[int]*core.QVariant, int(l.len))
 			for _, i := range NewQStandardItemModelFromPointer(l.data).__setItemData_keyList() {
@@ -38096,7 +38428,7 @@ func (ptr *QStandardItemModel) InsertRow(row int, items []*QStandardItem) {
 
 //export callbackQStandardItemModel_ItemChanged
 func callbackQStandardItemModel_ItemChanged(ptr unsafe.Pointer, item unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemChanged"); signal != nil {
 		signal.(func(*QStandardItem))(NewQStandardItemFromPointer(item))
 	}
 
@@ -38105,14 +38437,14 @@ func callbackQStandardItemModel_ItemChanged(ptr unsafe.Pointer, item unsafe.Poin
 func (ptr *QStandardItemModel) ConnectItemChanged(f func(item *QStandardItem)) {
 	if ptr.Pointer() != nil {
 		C.QStandardItemModel_ConnectItemChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "itemChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "itemChanged", f)
 	}
 }
 
 func (ptr *QStandardItemModel) DisconnectItemChanged() {
 	if ptr.Pointer() != nil {
 		C.QStandardItemModel_DisconnectItemChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "itemChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "itemChanged")
 	}
 }
 
@@ -38136,7 +38468,7 @@ func (ptr *QStandardItemModel) SetHorizontalHeaderItem(column int, item QStandar
 
 func (ptr *QStandardItemModel) SetHorizontalHeaderLabels(labels []string) {
 	if ptr.Pointer() != nil {
-		var labelsC = C.CString(strings.Join(labels, "|"))
+		var labelsC = cGoPackStringList(labels)
 		defer C.free(unsafe.Pointer(labelsC))
 		C.QStandardItemModel_SetHorizontalHeaderLabels(ptr.Pointer(), labelsC)
 	}
@@ -38192,7 +38524,7 @@ func (ptr *QStandardItemModel) SetVerticalHeaderItem(row int, item QStandardItem
 
 func (ptr *QStandardItemModel) SetVerticalHeaderLabels(labels []string) {
 	if ptr.Pointer() != nil {
-		var labelsC = C.CString(strings.Join(labels, "|"))
+		var labelsC = cGoPackStringList(labels)
 		defer C.free(unsafe.Pointer(labelsC))
 		C.QStandardItemModel_SetVerticalHeaderLabels(ptr.Pointer(), labelsC)
 	}
@@ -38200,7 +38532,7 @@ func (ptr *QStandardItemModel) SetVerticalHeaderLabels(labels []string) {
 
 //export callbackQStandardItemModel_Sort
 func callbackQStandardItemModel_Sort(ptr unsafe.Pointer, column C.int, order C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sort"); signal != nil {
 		signal.(func(int, core.Qt__SortOrder))(int(int32(column)), core.Qt__SortOrder(order))
 	} else {
 		NewQStandardItemModelFromPointer(ptr).SortDefault(int(int32(column)), core.Qt__SortOrder(order))
@@ -38216,7 +38548,7 @@ func (ptr *QStandardItemModel) SortDefault(column int, order core.Qt__SortOrder)
 func (ptr *QStandardItemModel) DestroyQStandardItemModel() {
 	if ptr.Pointer() != nil {
 		C.QStandardItemModel_DestroyQStandardItemModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -38238,7 +38570,7 @@ func (ptr *QStandardItemModel) FindItems(text string, flags core.Qt__MatchFlag,
 
 //export callbackQStandardItemModel_ItemData
 func callbackQStandardItemModel_ItemData(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemData"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQStandardItemModelFromPointer(NewQStandardItemModelFromPointer(nil).__itemData_newList())
 			for k, v := range signal.(func(*core.QModelIndex) map[int]*core.QVariant)(core.NewQModelIndexFromPointer(index)) {
@@ -38272,7 +38604,7 @@ func (ptr *QStandardItemModel) ItemDataDefault(index core.QModelIndex_ITF) map[i
 
 //export callbackQStandardItemModel_MimeData
 func callbackQStandardItemModel_MimeData(ptr unsafe.Pointer, indexes C.struct_QtGui_PackedList) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mimeData"); signal != nil {
 		return core.PointerFromQMimeData(signal.(func([]*core.QModelIndex) *core.QMimeData)(func(l C.struct_QtGui_PackedList) []*core.QModelIndex {
 			var out = make([]*core.QModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -38300,7 +38632,7 @@ func (ptr *QStandardItemModel) MimeDataDefault(indexes []*core.QModelIndex) *cor
 			}
 			return tmpList.Pointer()
 		}()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -38310,7 +38642,7 @@ func (ptr *QStandardItemModel) MimeDataDefault(indexes []*core.QModelIndex) *cor
 
 //export callbackQStandardItemModel_Index
 func callbackQStandardItemModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(int, int, *core.QModelIndex) *core.QModelIndex)(int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))
 	}
 
@@ -38320,14 +38652,14 @@ func callbackQStandardItemModel_Index(ptr unsafe.Pointer, row C.int, column C.in
 func (ptr *QStandardItemModel) ConnectIndex(f func(row int, column int, parent *core.QModelIndex) *core.QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "index", f)
+		qt.ConnectSignal(ptr.Pointer(), "index", f)
 	}
 }
 
 func (ptr *QStandardItemModel) DisconnectIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "index")
+		qt.DisconnectSignal(ptr.Pointer(), "index")
 	}
 }
 
@@ -38360,7 +38692,7 @@ func (ptr *QStandardItemModel) IndexFromItem(item QStandardItem_ITF) *core.QMode
 
 //export callbackQStandardItemModel_Parent
 func callbackQStandardItemModel_Parent(ptr unsafe.Pointer, child unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QModelIndex) *core.QModelIndex)(core.NewQModelIndexFromPointer(child)))
 	}
 
@@ -38370,14 +38702,14 @@ func callbackQStandardItemModel_Parent(ptr unsafe.Pointer, child unsafe.Pointer)
 func (ptr *QStandardItemModel) ConnectParent(f func(child *core.QModelIndex) *core.QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parent", f)
+		qt.ConnectSignal(ptr.Pointer(), "parent", f)
 	}
 }
 
 func (ptr *QStandardItemModel) DisconnectParent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parent")
+		qt.DisconnectSignal(ptr.Pointer(), "parent")
 	}
 }
 
@@ -38401,7 +38733,7 @@ func (ptr *QStandardItemModel) ParentDefault(child core.QModelIndex_ITF) *core.Q
 
 //export callbackQStandardItemModel_Sibling
 func callbackQStandardItemModel_Sibling(ptr unsafe.Pointer, row C.int, column C.int, idx unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sibling"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sibling"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(int, int, *core.QModelIndex) *core.QModelIndex)(int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(idx)))
 	}
 
@@ -38454,40 +38786,46 @@ func (ptr *QStandardItemModel) VerticalHeaderItem(row int) *QStandardItem {
 
 //export callbackQStandardItemModel_MimeTypes
 func callbackQStandardItemModel_MimeTypes(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeTypes"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "mimeTypes"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(NewQStandardItemModelFromPointer(ptr).MimeTypesDefault(), "|"))
+	return cGoPackStringList(NewQStandardItemModelFromPointer(ptr).MimeTypesDefault())
 }
 
 func (ptr *QStandardItemModel) MimeTypesDefault() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QStandardItemModel_MimeTypesDefault(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QStandardItemModel_MimeTypesDefault(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQStandardItemModel_Data
-func callbackQStandardItemModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
-		return core.PointerFromQVariant(signal.(func(*core.QModelIndex, int) *core.QVariant)(core.NewQModelIndexFromPointer(index), int(int32(role))))
+func callbackQStandardItemModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int, ret unsafe.Pointer) {
+	if signal := qt.GetSignal(ptr, "dataInto"); signal != nil {
+		signal.(func(*core.QModelIndex, int, *core.QVariant))(core.NewQModelIndexFromPointer(index), int(int32(role)), core.NewQVariantFromPointer(ret))
+		return
+	}
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
+		var tmpValue = signal.(func(*core.QModelIndex, int) *core.QVariant)(core.NewQModelIndexFromPointer(index), int(int32(role)))
+		core.NewQVariantFromPointer(ret).Assign(tmpValue)
+		return
 	}
 
-	return core.PointerFromQVariant(NewQStandardItemModelFromPointer(ptr).DataDefault(core.NewQModelIndexFromPointer(index), int(int32(role))))
+	C.QStandardItemModel_DataDefaultInto(ptr, index, role, ret)
 }
 
 func (ptr *QStandardItemModel) ConnectData(f func(index *core.QModelIndex, role int) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QStandardItemModel) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
@@ -38511,7 +38849,7 @@ func (ptr *QStandardItemModel) DataDefault(index core.QModelIndex_ITF, role int)
 
 //export callbackQStandardItemModel_HeaderData
 func callbackQStandardItemModel_HeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerData"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(int, core.Qt__Orientation, int) *core.QVariant)(int(int32(section)), core.Qt__Orientation(orientation), int(int32(role))))
 	}
 
@@ -38529,7 +38867,7 @@ func (ptr *QStandardItemModel) HeaderDataDefault(section int, orientation core.Q
 
 //export callbackQStandardItemModel_SupportedDropActions
 func callbackQStandardItemModel_SupportedDropActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDropActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDropActions"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__DropAction)())
 	}
 
@@ -38545,7 +38883,7 @@ func (ptr *QStandardItemModel) SupportedDropActionsDefault() core.Qt__DropAction
 
 //export callbackQStandardItemModel_Flags
 func callbackQStandardItemModel_Flags(ptr unsafe.Pointer, index unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flags"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flags"); signal != nil {
 		return C.longlong(signal.(func(*core.QModelIndex) core.Qt__ItemFlag)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -38561,7 +38899,7 @@ func (ptr *QStandardItemModel) FlagsDefault(index core.QModelIndex_ITF) core.Qt_
 
 //export callbackQStandardItemModel_HasChildren
 func callbackQStandardItemModel_HasChildren(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasChildren"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasChildren"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -38584,7 +38922,7 @@ func (ptr *QStandardItemModel) ItemPrototype() *QStandardItem {
 
 //export callbackQStandardItemModel_ColumnCount
 func callbackQStandardItemModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*core.QModelIndex) int)(core.NewQModelIndexFromPointer(parent))))
 	}
 
@@ -38594,14 +38932,14 @@ func callbackQStandardItemModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Po
 func (ptr *QStandardItemModel) ConnectColumnCount(f func(parent *core.QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCount", f)
 	}
 }
 
 func (ptr *QStandardItemModel) DisconnectColumnCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCount")
 	}
 }
 
@@ -38621,7 +38959,7 @@ func (ptr *QStandardItemModel) ColumnCountDefault(parent core.QModelIndex_ITF) i
 
 //export callbackQStandardItemModel_RowCount
 func callbackQStandardItemModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*core.QModelIndex) int)(core.NewQModelIndexFromPointer(parent))))
 	}
 
@@ -38631,14 +38969,14 @@ func callbackQStandardItemModel_RowCount(ptr unsafe.Pointer, parent unsafe.Point
 func (ptr *QStandardItemModel) ConnectRowCount(f func(parent *core.QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCount", f)
 	}
 }
 
 func (ptr *QStandardItemModel) DisconnectRowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCount")
 	}
 }
 
@@ -38720,8 +39058,10 @@ func (ptr *QStandardItemModel) __setItemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQStandardItemModelFromPointer(l.data).____setItemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQStandardItemModelFromPointer(l.data).____setItemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QStandardItemModel___setItemData_keyList(ptr.Pointer()))
@@ -38820,8 +39160,10 @@ func (ptr *QStandardItemModel) __setItemRoleNames_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQStandardItemModelFromPointer(l.data).____setItemRoleNames_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQStandardItemModelFromPointer(l.data).____setItemRoleNames_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QStandardItemModel___setItemRoleNames_keyList(ptr.Pointer()))
@@ -38869,8 +39211,10 @@ func (ptr *QStandardItemModel) __itemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQStandardItemModelFromPointer(l.data).____itemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQStandardItemModelFromPointer(l.data).____itemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QStandardItemModel___itemData_keyList(ptr.Pointer()))
@@ -38914,6 +39258,16 @@ func (ptr *QStandardItemModel) ____setItemData_keyList_newList() unsafe.Pointer
 	return unsafe.Pointer(C.QStandardItemModel_____setItemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QStandardItemModel) ____setItemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QStandardItemModel_____setItemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QStandardItemModel) ____setItemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QStandardItemModel_____setItemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QStandardItemModel) ____setItemRoleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QStandardItemModel_____setItemRoleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -38931,6 +39285,16 @@ func (ptr *QStandardItemModel) ____setItemRoleNames_keyList_newList() unsafe.Poi
 	return unsafe.Pointer(C.QStandardItemModel_____setItemRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QStandardItemModel) ____setItemRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QStandardItemModel_____setItemRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QStandardItemModel) ____setItemRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QStandardItemModel_____setItemRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QStandardItemModel) ____itemData_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QStandardItemModel_____itemData_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -38948,6 +39312,16 @@ func (ptr *QStandardItemModel) ____itemData_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QStandardItemModel_____itemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QStandardItemModel) ____itemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QStandardItemModel_____itemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QStandardItemModel) ____itemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QStandardItemModel_____itemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QStandardItemModel) __changePersistentIndexList_from_atList(i int) *core.QModelIndex {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQModelIndexFromPointer(C.QStandardItemModel___changePersistentIndexList_from_atList(ptr.Pointer(), C.int(int32(i))))
@@ -39003,6 +39377,16 @@ func (ptr *QStandardItemModel) __dataChanged_roles_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QStandardItemModel___dataChanged_roles_newList(ptr.Pointer()))
 }
 
+func (ptr *QStandardItemModel) __dataChanged_roles_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QStandardItemModel___dataChanged_roles_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QStandardItemModel) __dataChanged_roles_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QStandardItemModel___dataChanged_roles_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QStandardItemModel) __layoutAboutToBeChanged_parents_atList(i int) *core.QPersistentModelIndex {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPersistentModelIndexFromPointer(C.QStandardItemModel___layoutAboutToBeChanged_parents_atList(ptr.Pointer(), C.int(int32(i))))
@@ -39064,8 +39448,10 @@ func (ptr *QStandardItemModel) __roleNames_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQStandardItemModelFromPointer(l.data).____roleNames_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQStandardItemModelFromPointer(l.data).____roleNames_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QStandardItemModel___roleNames_keyList(ptr.Pointer()))
@@ -39128,6 +39514,16 @@ func (ptr *QStandardItemModel) ____doSetRoleNames_keyList_newList() unsafe.Point
 	return unsafe.Pointer(C.QStandardItemModel_____doSetRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QStandardItemModel) ____doSetRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QStandardItemModel_____doSetRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QStandardItemModel) ____doSetRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QStandardItemModel_____doSetRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QStandardItemModel) ____setRoleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QStandardItemModel_____setRoleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -39145,6 +39541,16 @@ func (ptr *QStandardItemModel) ____setRoleNames_keyList_newList() unsafe.Pointer
 	return unsafe.Pointer(C.QStandardItemModel_____setRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QStandardItemModel) ____setRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QStandardItemModel_____setRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QStandardItemModel) ____setRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QStandardItemModel_____setRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QStandardItemModel) ____roleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QStandardItemModel_____roleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -39162,6 +39568,16 @@ func (ptr *QStandardItemModel) ____roleNames_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QStandardItemModel_____roleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QStandardItemModel) ____roleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QStandardItemModel_____roleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QStandardItemModel) ____roleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QStandardItemModel_____roleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QStandardItemModel) __dynamicPropertyNames_atList(i int) *core.QByteArray {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQByteArrayFromPointer(C.QStandardItemModel___dynamicPropertyNames_atList(ptr.Pointer(), C.int(int32(i))))
@@ -39184,7 +39600,7 @@ func (ptr *QStandardItemModel) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QStandardItemModel) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QStandardItemModel___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -39205,7 +39621,7 @@ func (ptr *QStandardItemModel) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QStandardItemModel) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QStandardItemModel___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -39226,7 +39642,7 @@ func (ptr *QStandardItemModel) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QStandardItemModel) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QStandardItemModel___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -39247,7 +39663,7 @@ func (ptr *QStandardItemModel) __findChildren_newList() unsafe.Pointer {
 func (ptr *QStandardItemModel) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QStandardItemModel___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -39267,7 +39683,7 @@ func (ptr *QStandardItemModel) __children_newList() unsafe.Pointer {
 
 //export callbackQStandardItemModel_MoveColumns
 func callbackQStandardItemModel_MoveColumns(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceColumn C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int) bool)(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceColumn)), int(int32(count)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -39283,7 +39699,7 @@ func (ptr *QStandardItemModel) MoveColumnsDefault(sourceParent core.QModelIndex_
 
 //export callbackQStandardItemModel_MoveRows
 func callbackQStandardItemModel_MoveRows(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceRow C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int) bool)(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceRow)), int(int32(count)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -39299,7 +39715,7 @@ func (ptr *QStandardItemModel) MoveRowsDefault(sourceParent core.QModelIndex_ITF
 
 //export callbackQStandardItemModel_Submit
 func callbackQStandardItemModel_Submit(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "submit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "submit"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -39315,7 +39731,7 @@ func (ptr *QStandardItemModel) SubmitDefault() bool {
 
 //export callbackQStandardItemModel_ColumnsAboutToBeInserted
 func callbackQStandardItemModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -39323,7 +39739,7 @@ func callbackQStandardItemModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, par
 
 //export callbackQStandardItemModel_ColumnsAboutToBeMoved
 func callbackQStandardItemModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationColumn C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationColumn)))
 	}
 
@@ -39331,7 +39747,7 @@ func callbackQStandardItemModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, source
 
 //export callbackQStandardItemModel_ColumnsAboutToBeRemoved
 func callbackQStandardItemModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -39339,7 +39755,7 @@ func callbackQStandardItemModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, pare
 
 //export callbackQStandardItemModel_ColumnsInserted
 func callbackQStandardItemModel_ColumnsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -39347,7 +39763,7 @@ func callbackQStandardItemModel_ColumnsInserted(ptr unsafe.Pointer, parent unsaf
 
 //export callbackQStandardItemModel_ColumnsMoved
 func callbackQStandardItemModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, column C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), core.NewQModelIndexFromPointer(destination), int(int32(column)))
 	}
 
@@ -39355,7 +39771,7 @@ func callbackQStandardItemModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.P
 
 //export callbackQStandardItemModel_ColumnsRemoved
 func callbackQStandardItemModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -39363,11 +39779,13 @@ func callbackQStandardItemModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe
 
 //export callbackQStandardItemModel_DataChanged
 func callbackQStandardItemModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Pointer, bottomRight unsafe.Pointer, roles C.struct_QtGui_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataChanged"); signal != nil {
 		signal.(func(*core.QModelIndex, *core.QModelIndex, []int))(core.NewQModelIndexFromPointer(topLeft), core.NewQModelIndexFromPointer(bottomRight), func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQStandardItemModelFromPointer(l.data).__dataChanged_roles_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQStandardItemModelFromPointer(l.data).__dataChanged_roles_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(roles))
@@ -39377,7 +39795,7 @@ func callbackQStandardItemModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.P
 
 //export callbackQStandardItemModel_FetchMore
 func callbackQStandardItemModel_FetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchMore"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(parent))
 	} else {
 		NewQStandardItemModelFromPointer(ptr).FetchMoreDefault(core.NewQModelIndexFromPointer(parent))
@@ -39392,7 +39810,7 @@ func (ptr *QStandardItemModel) FetchMoreDefault(parent core.QModelIndex_ITF) {
 
 //export callbackQStandardItemModel_HeaderDataChanged
 func callbackQStandardItemModel_HeaderDataChanged(ptr unsafe.Pointer, orientation C.longlong, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerDataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerDataChanged"); signal != nil {
 		signal.(func(core.Qt__Orientation, int, int))(core.Qt__Orientation(orientation), int(int32(first)), int(int32(last)))
 	}
 
@@ -39400,7 +39818,7 @@ func callbackQStandardItemModel_HeaderDataChanged(ptr unsafe.Pointer, orientatio
 
 //export callbackQStandardItemModel_LayoutAboutToBeChanged
 func callbackQStandardItemModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, parents C.struct_QtGui_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutAboutToBeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutAboutToBeChanged"); signal != nil {
 		signal.(func([]*core.QPersistentModelIndex, core.QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtGui_PackedList) []*core.QPersistentModelIndex {
 			var out = make([]*core.QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -39414,7 +39832,7 @@ func callbackQStandardItemModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, paren
 
 //export callbackQStandardItemModel_LayoutChanged
 func callbackQStandardItemModel_LayoutChanged(ptr unsafe.Pointer, parents C.struct_QtGui_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutChanged"); signal != nil {
 		signal.(func([]*core.QPersistentModelIndex, core.QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtGui_PackedList) []*core.QPersistentModelIndex {
 			var out = make([]*core.QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -39428,7 +39846,7 @@ func callbackQStandardItemModel_LayoutChanged(ptr unsafe.Pointer, parents C.stru
 
 //export callbackQStandardItemModel_ModelAboutToBeReset
 func callbackQStandardItemModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelAboutToBeReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelAboutToBeReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -39436,7 +39854,7 @@ func callbackQStandardItemModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
 
 //export callbackQStandardItemModel_ModelReset
 func callbackQStandardItemModel_ModelReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -39444,7 +39862,7 @@ func callbackQStandardItemModel_ModelReset(ptr unsafe.Pointer) {
 
 //export callbackQStandardItemModel_ResetInternalData
 func callbackQStandardItemModel_ResetInternalData(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resetInternalData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resetInternalData"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQStandardItemModelFromPointer(ptr).ResetInternalDataDefault()
@@ -39459,7 +39877,7 @@ func (ptr *QStandardItemModel) ResetInternalDataDefault() {
 
 //export callbackQStandardItemModel_Revert
 func callbackQStandardItemModel_Revert(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "revert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "revert"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQStandardItemModelFromPointer(ptr).RevertDefault()
@@ -39474,7 +39892,7 @@ func (ptr *QStandardItemModel) RevertDefault() {
 
 //export callbackQStandardItemModel_RowsAboutToBeInserted
 func callbackQStandardItemModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	}
 
@@ -39482,7 +39900,7 @@ func callbackQStandardItemModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent
 
 //export callbackQStandardItemModel_RowsAboutToBeMoved
 func callbackQStandardItemModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationRow C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationRow)))
 	}
 
@@ -39490,7 +39908,7 @@ func callbackQStandardItemModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourcePar
 
 //export callbackQStandardItemModel_RowsAboutToBeRemoved
 func callbackQStandardItemModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -39498,7 +39916,7 @@ func callbackQStandardItemModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent
 
 //export callbackQStandardItemModel_RowsInserted
 func callbackQStandardItemModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -39506,7 +39924,7 @@ func callbackQStandardItemModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.P
 
 //export callbackQStandardItemModel_RowsMoved
 func callbackQStandardItemModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, row C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), core.NewQModelIndexFromPointer(destination), int(int32(row)))
 	}
 
@@ -39514,7 +39932,7 @@ func callbackQStandardItemModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Poin
 
 //export callbackQStandardItemModel_RowsRemoved
 func callbackQStandardItemModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -39522,7 +39940,7 @@ func callbackQStandardItemModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Po
 
 //export callbackQStandardItemModel_RoleNames
 func callbackQStandardItemModel_RoleNames(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "roleNames"); signal != nil {
+	if signal := qt.GetSignal(ptr, "roleNames"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQStandardItemModelFromPointer(NewQStandardItemModelFromPointer(nil).__roleNames_newList())
 			for k, v := range signal.(func() map[int]*core.QByteArray)() {
@@ -39556,7 +39974,7 @@ func (ptr *QStandardItemModel) RoleNamesDefault() map[int]*core.QByteArray {
 
 //export callbackQStandardItemModel_Buddy
 func callbackQStandardItemModel_Buddy(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buddy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buddy"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QModelIndex) *core.QModelIndex)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -39574,7 +39992,7 @@ func (ptr *QStandardItemModel) BuddyDefault(index core.QModelIndex_ITF) *core.QM
 
 //export callbackQStandardItemModel_Match
 func callbackQStandardItemModel_Match(ptr unsafe.Pointer, start unsafe.Pointer, role C.int, value unsafe.Pointer, hits C.int, flags C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "match"); signal != nil {
+	if signal := qt.GetSignal(ptr, "match"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQStandardItemModelFromPointer(NewQStandardItemModelFromPointer(nil).__match_newList())
 			for _, v := range signal.(func(*core.QModelIndex, int, *core.QVariant, int, core.Qt__MatchFlag) []*core.QModelIndex)(core.NewQModelIndexFromPointer(start), int(int32(role)), core.NewQVariantFromPointer(value), int(int32(hits)), core.Qt__MatchFlag(flags)) {
@@ -39608,7 +40026,7 @@ func (ptr *QStandardItemModel) MatchDefault(start core.QModelIndex_ITF, role int
 
 //export callbackQStandardItemModel_Span
 func callbackQStandardItemModel_Span(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "span"); signal != nil {
+	if signal := qt.GetSignal(ptr, "span"); signal != nil {
 		return core.PointerFromQSize(signal.(func(*core.QModelIndex) *core.QSize)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -39626,7 +40044,7 @@ func (ptr *QStandardItemModel) SpanDefault(index core.QModelIndex_ITF) *core.QSi
 
 //export callbackQStandardItemModel_SupportedDragActions
 func callbackQStandardItemModel_SupportedDragActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDragActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDragActions"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__DropAction)())
 	}
 
@@ -39642,7 +40060,7 @@ func (ptr *QStandardItemModel) SupportedDragActionsDefault() core.Qt__DropAction
 
 //export callbackQStandardItemModel_CanDropMimeData
 func callbackQStandardItemModel_CanDropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canDropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canDropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QMimeData, core.Qt__DropAction, int, int, *core.QModelIndex) bool)(core.NewQMimeDataFromPointer(data), core.Qt__DropAction(action), int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -39658,7 +40076,7 @@ func (ptr *QStandardItemModel) CanDropMimeDataDefault(data core.QMimeData_ITF, a
 
 //export callbackQStandardItemModel_CanFetchMore
 func callbackQStandardItemModel_CanFetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canFetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canFetchMore"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -39674,7 +40092,7 @@ func (ptr *QStandardItemModel) CanFetchMoreDefault(parent core.QModelIndex_ITF)
 
 //export callbackQStandardItemModel_Event
 func callbackQStandardItemModel_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -39690,7 +40108,7 @@ func (ptr *QStandardItemModel) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQStandardItemModel_EventFilter
 func callbackQStandardItemModel_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -39706,7 +40124,7 @@ func (ptr *QStandardItemModel) EventFilterDefault(watched core.QObject_ITF, even
 
 //export callbackQStandardItemModel_ChildEvent
 func callbackQStandardItemModel_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQStandardItemModelFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -39721,7 +40139,7 @@ func (ptr *QStandardItemModel) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQStandardItemModel_ConnectNotify
 func callbackQStandardItemModel_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQStandardItemModelFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -39736,7 +40154,7 @@ func (ptr *QStandardItemModel) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQStandardItemModel_CustomEvent
 func callbackQStandardItemModel_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQStandardItemModelFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -39751,7 +40169,7 @@ func (ptr *QStandardItemModel) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQStandardItemModel_DeleteLater
 func callbackQStandardItemModel_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQStandardItemModelFromPointer(ptr).DeleteLaterDefault()
@@ -39761,14 +40179,14 @@ func callbackQStandardItemModel_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QStandardItemModel) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QStandardItemModel_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQStandardItemModel_Destroyed
 func callbackQStandardItemModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -39776,7 +40194,7 @@ func callbackQStandardItemModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer
 
 //export callbackQStandardItemModel_DisconnectNotify
 func callbackQStandardItemModel_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQStandardItemModelFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -39791,7 +40209,7 @@ func (ptr *QStandardItemModel) DisconnectNotifyDefault(sign core.QMetaMethod_ITF
 
 //export callbackQStandardItemModel_ObjectNameChanged
 func callbackQStandardItemModel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -39799,7 +40217,7 @@ func callbackQStandardItemModel_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQStandardItemModel_TimerEvent
 func callbackQStandardItemModel_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQStandardItemModelFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -39814,7 +40232,7 @@ func (ptr *QStandardItemModel) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQStandardItemModel_MetaObject
 func callbackQStandardItemModel_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -40034,7 +40452,7 @@ func NewQStatusTipEventFromPointer(ptr unsafe.Pointer) *QStatusTipEvent {
 func (ptr *QStatusTipEvent) DestroyQStatusTipEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -40094,14 +40512,14 @@ func NewQStyleHintsFromPointer(ptr unsafe.Pointer) *QStyleHints {
 func (ptr *QStyleHints) DestroyQStyleHints() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQStyleHints_CursorFlashTimeChanged
 func callbackQStyleHints_CursorFlashTimeChanged(ptr unsafe.Pointer, cursorFlashTime C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cursorFlashTimeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cursorFlashTimeChanged"); signal != nil {
 		signal.(func(int))(int(int32(cursorFlashTime)))
 	}
 
@@ -40110,14 +40528,14 @@ func callbackQStyleHints_CursorFlashTimeChanged(ptr unsafe.Pointer, cursorFlashT
 func (ptr *QStyleHints) ConnectCursorFlashTimeChanged(f func(cursorFlashTime int)) {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_ConnectCursorFlashTimeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cursorFlashTimeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "cursorFlashTimeChanged", f)
 	}
 }
 
 func (ptr *QStyleHints) DisconnectCursorFlashTimeChanged() {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_DisconnectCursorFlashTimeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cursorFlashTimeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "cursorFlashTimeChanged")
 	}
 }
 
@@ -40129,7 +40547,7 @@ func (ptr *QStyleHints) CursorFlashTimeChanged(cursorFlashTime int) {
 
 //export callbackQStyleHints_KeyboardInputIntervalChanged
 func callbackQStyleHints_KeyboardInputIntervalChanged(ptr unsafe.Pointer, keyboardInputInterval C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyboardInputIntervalChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyboardInputIntervalChanged"); signal != nil {
 		signal.(func(int))(int(int32(keyboardInputInterval)))
 	}
 
@@ -40138,14 +40556,14 @@ func callbackQStyleHints_KeyboardInputIntervalChanged(ptr unsafe.Pointer, keyboa
 func (ptr *QStyleHints) ConnectKeyboardInputIntervalChanged(f func(keyboardInputInterval int)) {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_ConnectKeyboardInputIntervalChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "keyboardInputIntervalChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "keyboardInputIntervalChanged", f)
 	}
 }
 
 func (ptr *QStyleHints) DisconnectKeyboardInputIntervalChanged() {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_DisconnectKeyboardInputIntervalChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "keyboardInputIntervalChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "keyboardInputIntervalChanged")
 	}
 }
 
@@ -40157,7 +40575,7 @@ func (ptr *QStyleHints) KeyboardInputIntervalChanged(keyboardInputInterval int)
 
 //export callbackQStyleHints_MouseDoubleClickIntervalChanged
 func callbackQStyleHints_MouseDoubleClickIntervalChanged(ptr unsafe.Pointer, mouseDoubleClickInterval C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickIntervalChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickIntervalChanged"); signal != nil {
 		signal.(func(int))(int(int32(mouseDoubleClickInterval)))
 	}
 
@@ -40166,14 +40584,14 @@ func callbackQStyleHints_MouseDoubleClickIntervalChanged(ptr unsafe.Pointer, mou
 func (ptr *QStyleHints) ConnectMouseDoubleClickIntervalChanged(f func(mouseDoubleClickInterval int)) {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_ConnectMouseDoubleClickIntervalChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseDoubleClickIntervalChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseDoubleClickIntervalChanged", f)
 	}
 }
 
 func (ptr *QStyleHints) DisconnectMouseDoubleClickIntervalChanged() {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_DisconnectMouseDoubleClickIntervalChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseDoubleClickIntervalChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseDoubleClickIntervalChanged")
 	}
 }
 
@@ -40185,7 +40603,7 @@ func (ptr *QStyleHints) MouseDoubleClickIntervalChanged(mouseDoubleClickInterval
 
 //export callbackQStyleHints_MousePressAndHoldIntervalChanged
 func callbackQStyleHints_MousePressAndHoldIntervalChanged(ptr unsafe.Pointer, mousePressAndHoldInterval C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressAndHoldIntervalChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressAndHoldIntervalChanged"); signal != nil {
 		signal.(func(int))(int(int32(mousePressAndHoldInterval)))
 	}
 
@@ -40194,14 +40612,14 @@ func callbackQStyleHints_MousePressAndHoldIntervalChanged(ptr unsafe.Pointer, mo
 func (ptr *QStyleHints) ConnectMousePressAndHoldIntervalChanged(f func(mousePressAndHoldInterval int)) {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_ConnectMousePressAndHoldIntervalChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressAndHoldIntervalChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "mousePressAndHoldIntervalChanged", f)
 	}
 }
 
 func (ptr *QStyleHints) DisconnectMousePressAndHoldIntervalChanged() {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_DisconnectMousePressAndHoldIntervalChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressAndHoldIntervalChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "mousePressAndHoldIntervalChanged")
 	}
 }
 
@@ -40219,7 +40637,7 @@ func (ptr *QStyleHints) SetUseHoverEffects(useHoverEffects bool) {
 
 //export callbackQStyleHints_StartDragDistanceChanged
 func callbackQStyleHints_StartDragDistanceChanged(ptr unsafe.Pointer, startDragDistance C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startDragDistanceChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startDragDistanceChanged"); signal != nil {
 		signal.(func(int))(int(int32(startDragDistance)))
 	}
 
@@ -40228,14 +40646,14 @@ func callbackQStyleHints_StartDragDistanceChanged(ptr unsafe.Pointer, startDragD
 func (ptr *QStyleHints) ConnectStartDragDistanceChanged(f func(startDragDistance int)) {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_ConnectStartDragDistanceChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startDragDistanceChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "startDragDistanceChanged", f)
 	}
 }
 
 func (ptr *QStyleHints) DisconnectStartDragDistanceChanged() {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_DisconnectStartDragDistanceChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startDragDistanceChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "startDragDistanceChanged")
 	}
 }
 
@@ -40247,7 +40665,7 @@ func (ptr *QStyleHints) StartDragDistanceChanged(startDragDistance int) {
 
 //export callbackQStyleHints_StartDragTimeChanged
 func callbackQStyleHints_StartDragTimeChanged(ptr unsafe.Pointer, startDragTime C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startDragTimeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startDragTimeChanged"); signal != nil {
 		signal.(func(int))(int(int32(startDragTime)))
 	}
 
@@ -40256,14 +40674,14 @@ func callbackQStyleHints_StartDragTimeChanged(ptr unsafe.Pointer, startDragTime
 func (ptr *QStyleHints) ConnectStartDragTimeChanged(f func(startDragTime int)) {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_ConnectStartDragTimeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startDragTimeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "startDragTimeChanged", f)
 	}
 }
 
 func (ptr *QStyleHints) DisconnectStartDragTimeChanged() {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_DisconnectStartDragTimeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startDragTimeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "startDragTimeChanged")
 	}
 }
 
@@ -40275,7 +40693,7 @@ func (ptr *QStyleHints) StartDragTimeChanged(startDragTime int) {
 
 //export callbackQStyleHints_TabFocusBehaviorChanged
 func callbackQStyleHints_TabFocusBehaviorChanged(ptr unsafe.Pointer, tabFocusBehavior C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabFocusBehaviorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabFocusBehaviorChanged"); signal != nil {
 		signal.(func(core.Qt__TabFocusBehavior))(core.Qt__TabFocusBehavior(tabFocusBehavior))
 	}
 
@@ -40284,14 +40702,14 @@ func callbackQStyleHints_TabFocusBehaviorChanged(ptr unsafe.Pointer, tabFocusBeh
 func (ptr *QStyleHints) ConnectTabFocusBehaviorChanged(f func(tabFocusBehavior core.Qt__TabFocusBehavior)) {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_ConnectTabFocusBehaviorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "tabFocusBehaviorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "tabFocusBehaviorChanged", f)
 	}
 }
 
 func (ptr *QStyleHints) DisconnectTabFocusBehaviorChanged() {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_DisconnectTabFocusBehaviorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "tabFocusBehaviorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "tabFocusBehaviorChanged")
 	}
 }
 
@@ -40303,7 +40721,7 @@ func (ptr *QStyleHints) TabFocusBehaviorChanged(tabFocusBehavior core.Qt__TabFoc
 
 //export callbackQStyleHints_UseHoverEffectsChanged
 func callbackQStyleHints_UseHoverEffectsChanged(ptr unsafe.Pointer, useHoverEffects C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "useHoverEffectsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "useHoverEffectsChanged"); signal != nil {
 		signal.(func(bool))(int8(useHoverEffects) != 0)
 	}
 
@@ -40312,14 +40730,14 @@ func callbackQStyleHints_UseHoverEffectsChanged(ptr unsafe.Pointer, useHoverEffe
 func (ptr *QStyleHints) ConnectUseHoverEffectsChanged(f func(useHoverEffects bool)) {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_ConnectUseHoverEffectsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "useHoverEffectsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "useHoverEffectsChanged", f)
 	}
 }
 
 func (ptr *QStyleHints) DisconnectUseHoverEffectsChanged() {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_DisconnectUseHoverEffectsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "useHoverEffectsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "useHoverEffectsChanged")
 	}
 }
 
@@ -40479,7 +40897,7 @@ func (ptr *QStyleHints) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QStyleHints) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QStyleHints___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -40500,7 +40918,7 @@ func (ptr *QStyleHints) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QStyleHints) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QStyleHints___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -40521,7 +40939,7 @@ func (ptr *QStyleHints) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QStyleHints) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QStyleHints___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -40542,7 +40960,7 @@ func (ptr *QStyleHints) __findChildren_newList() unsafe.Pointer {
 func (ptr *QStyleHints) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QStyleHints___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -40562,7 +40980,7 @@ func (ptr *QStyleHints) __children_newList() unsafe.Pointer {
 
 //export callbackQStyleHints_Event
 func callbackQStyleHints_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -40578,7 +40996,7 @@ func (ptr *QStyleHints) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQStyleHints_EventFilter
 func callbackQStyleHints_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -40594,7 +41012,7 @@ func (ptr *QStyleHints) EventFilterDefault(watched core.QObject_ITF, event core.
 
 //export callbackQStyleHints_ChildEvent
 func callbackQStyleHints_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQStyleHintsFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -40609,7 +41027,7 @@ func (ptr *QStyleHints) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQStyleHints_ConnectNotify
 func callbackQStyleHints_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQStyleHintsFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -40624,7 +41042,7 @@ func (ptr *QStyleHints) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQStyleHints_CustomEvent
 func callbackQStyleHints_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQStyleHintsFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -40639,7 +41057,7 @@ func (ptr *QStyleHints) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQStyleHints_DeleteLater
 func callbackQStyleHints_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQStyleHintsFromPointer(ptr).DeleteLaterDefault()
@@ -40649,14 +41067,14 @@ func callbackQStyleHints_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QStyleHints) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QStyleHints_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQStyleHints_Destroyed
 func callbackQStyleHints_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -40664,7 +41082,7 @@ func callbackQStyleHints_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQStyleHints_DisconnectNotify
 func callbackQStyleHints_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQStyleHintsFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -40679,7 +41097,7 @@ func (ptr *QStyleHints) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQStyleHints_ObjectNameChanged
 func callbackQStyleHints_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -40687,7 +41105,7 @@ func callbackQStyleHints_ObjectNameChanged(ptr unsafe.Pointer, objectName C.stru
 
 //export callbackQStyleHints_TimerEvent
 func callbackQStyleHints_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQStyleHintsFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -40702,7 +41120,7 @@ func (ptr *QStyleHints) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQStyleHints_MetaObject
 func callbackQStyleHints_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -40813,7 +41231,7 @@ const (
 
 //export callbackQSurface_DestroyQSurface
 func callbackQSurface_DestroyQSurface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSurface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSurface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSurfaceFromPointer(ptr).DestroyQSurfaceDefault()
@@ -40823,21 +41241,21 @@ func callbackQSurface_DestroyQSurface(ptr unsafe.Pointer) {
 func (ptr *QSurface) ConnectDestroyQSurface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSurface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSurface", f)
 	}
 }
 
 func (ptr *QSurface) DisconnectDestroyQSurface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSurface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSurface")
 	}
 }
 
 func (ptr *QSurface) DestroyQSurface() {
 	if ptr.Pointer() != nil {
 		C.QSurface_DestroyQSurface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -40845,14 +41263,14 @@ func (ptr *QSurface) DestroyQSurface() {
 func (ptr *QSurface) DestroyQSurfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QSurface_DestroyQSurfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSurface_Size
 func callbackQSurface_Size(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -40862,14 +41280,14 @@ func callbackQSurface_Size(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSurface) ConnectSize(f func() *core.QSize) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "size", f)
+		qt.ConnectSignal(ptr.Pointer(), "size", f)
 	}
 }
 
 func (ptr *QSurface) DisconnectSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "size")
+		qt.DisconnectSignal(ptr.Pointer(), "size")
 	}
 }
 
@@ -40884,7 +41302,7 @@ func (ptr *QSurface) Size() *core.QSize {
 
 //export callbackQSurface_Format
 func callbackQSurface_Format(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "format"); signal != nil {
+	if signal := qt.GetSignal(ptr, "format"); signal != nil {
 		return PointerFromQSurfaceFormat(signal.(func() *QSurfaceFormat)())
 	}
 
@@ -40894,14 +41312,14 @@ func callbackQSurface_Format(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSurface) ConnectFormat(f func() *QSurfaceFormat) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "format", f)
+		qt.ConnectSignal(ptr.Pointer(), "format", f)
 	}
 }
 
 func (ptr *QSurface) DisconnectFormat() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "format")
+		qt.DisconnectSignal(ptr.Pointer(), "format")
 	}
 }
 
@@ -40923,7 +41341,7 @@ func (ptr *QSurface) SurfaceClass() QSurface__SurfaceClass {
 
 //export callbackQSurface_SurfaceType
 func callbackQSurface_SurfaceType(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "surfaceType"); signal != nil {
+	if signal := qt.GetSignal(ptr, "surfaceType"); signal != nil {
 		return C.longlong(signal.(func() QSurface__SurfaceType)())
 	}
 
@@ -40933,14 +41351,14 @@ func callbackQSurface_SurfaceType(ptr unsafe.Pointer) C.longlong {
 func (ptr *QSurface) ConnectSurfaceType(f func() QSurface__SurfaceType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "surfaceType", f)
+		qt.ConnectSignal(ptr.Pointer(), "surfaceType", f)
 	}
 }
 
 func (ptr *QSurface) DisconnectSurfaceType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "surfaceType")
+		qt.DisconnectSignal(ptr.Pointer(), "surfaceType")
 	}
 }
 
@@ -41358,7 +41776,7 @@ func NewQSyntaxHighlighterFromPointer(ptr unsafe.Pointer) *QSyntaxHighlighter {
 }
 func NewQSyntaxHighlighter(parent core.QObject_ITF) *QSyntaxHighlighter {
 	var tmpValue = NewQSyntaxHighlighterFromPointer(C.QSyntaxHighlighter_NewQSyntaxHighlighter(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -41366,7 +41784,7 @@ func NewQSyntaxHighlighter(parent core.QObject_ITF) *QSyntaxHighlighter {
 
 func NewQSyntaxHighlighter2(parent QTextDocument_ITF) *QSyntaxHighlighter {
 	var tmpValue = NewQSyntaxHighlighterFromPointer(C.QSyntaxHighlighter_NewQSyntaxHighlighter2(PointerFromQTextDocument(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -41374,7 +41792,7 @@ func NewQSyntaxHighlighter2(parent QTextDocument_ITF) *QSyntaxHighlighter {
 
 //export callbackQSyntaxHighlighter_HighlightBlock
 func callbackQSyntaxHighlighter_HighlightBlock(ptr unsafe.Pointer, text C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "highlightBlock"); signal != nil {
+	if signal := qt.GetSignal(ptr, "highlightBlock"); signal != nil {
 		signal.(func(string))(cGoUnpackString(text))
 	}
 
@@ -41383,14 +41801,14 @@ func callbackQSyntaxHighlighter_HighlightBlock(ptr unsafe.Pointer, text C.struct
 func (ptr *QSyntaxHighlighter) ConnectHighlightBlock(f func(text string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "highlightBlock", f)
+		qt.ConnectSignal(ptr.Pointer(), "highlightBlock", f)
 	}
 }
 
 func (ptr *QSyntaxHighlighter) DisconnectHighlightBlock() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "highlightBlock")
+		qt.DisconnectSignal(ptr.Pointer(), "highlightBlock")
 	}
 }
 
@@ -41404,7 +41822,7 @@ func (ptr *QSyntaxHighlighter) HighlightBlock(text string) {
 
 //export callbackQSyntaxHighlighter_Rehighlight
 func callbackQSyntaxHighlighter_Rehighlight(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rehighlight"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rehighlight"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSyntaxHighlighterFromPointer(ptr).RehighlightDefault()
@@ -41414,14 +41832,14 @@ func callbackQSyntaxHighlighter_Rehighlight(ptr unsafe.Pointer) {
 func (ptr *QSyntaxHighlighter) ConnectRehighlight(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rehighlight", f)
+		qt.ConnectSignal(ptr.Pointer(), "rehighlight", f)
 	}
 }
 
 func (ptr *QSyntaxHighlighter) DisconnectRehighlight() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rehighlight")
+		qt.DisconnectSignal(ptr.Pointer(), "rehighlight")
 	}
 }
 
@@ -41439,7 +41857,7 @@ func (ptr *QSyntaxHighlighter) RehighlightDefault() {
 
 //export callbackQSyntaxHighlighter_RehighlightBlock
 func callbackQSyntaxHighlighter_RehighlightBlock(ptr unsafe.Pointer, block unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rehighlightBlock"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rehighlightBlock"); signal != nil {
 		signal.(func(*QTextBlock))(NewQTextBlockFromPointer(block))
 	} else {
 		NewQSyntaxHighlighterFromPointer(ptr).RehighlightBlockDefault(NewQTextBlockFromPointer(block))
@@ -41449,14 +41867,14 @@ func callbackQSyntaxHighlighter_RehighlightBlock(ptr unsafe.Pointer, block unsaf
 func (ptr *QSyntaxHighlighter) ConnectRehighlightBlock(f func(block *QTextBlock)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rehighlightBlock", f)
+		qt.ConnectSignal(ptr.Pointer(), "rehighlightBlock", f)
 	}
 }
 
 func (ptr *QSyntaxHighlighter) DisconnectRehighlightBlock() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rehighlightBlock")
+		qt.DisconnectSignal(ptr.Pointer(), "rehighlightBlock")
 	}
 }
 
@@ -41510,7 +41928,7 @@ func (ptr *QSyntaxHighlighter) SetFormat(start int, count int, format QTextCharF
 
 //export callbackQSyntaxHighlighter_DestroyQSyntaxHighlighter
 func callbackQSyntaxHighlighter_DestroyQSyntaxHighlighter(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSyntaxHighlighter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSyntaxHighlighter"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSyntaxHighlighterFromPointer(ptr).DestroyQSyntaxHighlighterDefault()
@@ -41520,21 +41938,21 @@ func callbackQSyntaxHighlighter_DestroyQSyntaxHighlighter(ptr unsafe.Pointer) {
 func (ptr *QSyntaxHighlighter) ConnectDestroyQSyntaxHighlighter(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSyntaxHighlighter", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSyntaxHighlighter", f)
 	}
 }
 
 func (ptr *QSyntaxHighlighter) DisconnectDestroyQSyntaxHighlighter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSyntaxHighlighter")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSyntaxHighlighter")
 	}
 }
 
 func (ptr *QSyntaxHighlighter) DestroyQSyntaxHighlighter() {
 	if ptr.Pointer() != nil {
 		C.QSyntaxHighlighter_DestroyQSyntaxHighlighter(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -41542,7 +41960,7 @@ func (ptr *QSyntaxHighlighter) DestroyQSyntaxHighlighter() {
 func (ptr *QSyntaxHighlighter) DestroyQSyntaxHighlighterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSyntaxHighlighter_DestroyQSyntaxHighlighterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -41575,7 +41993,7 @@ func (ptr *QSyntaxHighlighter) Format(position int) *QTextCharFormat {
 func (ptr *QSyntaxHighlighter) Document() *QTextDocument {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextDocumentFromPointer(C.QSyntaxHighlighter_Document(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -41619,7 +42037,7 @@ func (ptr *QSyntaxHighlighter) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSyntaxHighlighter) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSyntaxHighlighter___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -41640,7 +42058,7 @@ func (ptr *QSyntaxHighlighter) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSyntaxHighlighter) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSyntaxHighlighter___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -41661,7 +42079,7 @@ func (ptr *QSyntaxHighlighter) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSyntaxHighlighter) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSyntaxHighlighter___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -41682,7 +42100,7 @@ func (ptr *QSyntaxHighlighter) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSyntaxHighlighter) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSyntaxHighlighter___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -41702,7 +42120,7 @@ func (ptr *QSyntaxHighlighter) __children_newList() unsafe.Pointer {
 
 //export callbackQSyntaxHighlighter_Event
 func callbackQSyntaxHighlighter_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -41718,7 +42136,7 @@ func (ptr *QSyntaxHighlighter) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSyntaxHighlighter_EventFilter
 func callbackQSyntaxHighlighter_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -41734,7 +42152,7 @@ func (ptr *QSyntaxHighlighter) EventFilterDefault(watched core.QObject_ITF, even
 
 //export callbackQSyntaxHighlighter_ChildEvent
 func callbackQSyntaxHighlighter_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSyntaxHighlighterFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -41749,7 +42167,7 @@ func (ptr *QSyntaxHighlighter) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSyntaxHighlighter_ConnectNotify
 func callbackQSyntaxHighlighter_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSyntaxHighlighterFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -41764,7 +42182,7 @@ func (ptr *QSyntaxHighlighter) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSyntaxHighlighter_CustomEvent
 func callbackQSyntaxHighlighter_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSyntaxHighlighterFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -41779,7 +42197,7 @@ func (ptr *QSyntaxHighlighter) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSyntaxHighlighter_DeleteLater
 func callbackQSyntaxHighlighter_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSyntaxHighlighterFromPointer(ptr).DeleteLaterDefault()
@@ -41789,14 +42207,14 @@ func callbackQSyntaxHighlighter_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSyntaxHighlighter) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSyntaxHighlighter_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSyntaxHighlighter_Destroyed
 func callbackQSyntaxHighlighter_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -41804,7 +42222,7 @@ func callbackQSyntaxHighlighter_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer
 
 //export callbackQSyntaxHighlighter_DisconnectNotify
 func callbackQSyntaxHighlighter_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSyntaxHighlighterFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -41819,7 +42237,7 @@ func (ptr *QSyntaxHighlighter) DisconnectNotifyDefault(sign core.QMetaMethod_ITF
 
 //export callbackQSyntaxHighlighter_ObjectNameChanged
 func callbackQSyntaxHighlighter_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -41827,7 +42245,7 @@ func callbackQSyntaxHighlighter_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQSyntaxHighlighter_TimerEvent
 func callbackQSyntaxHighlighter_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSyntaxHighlighterFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -41842,7 +42260,7 @@ func (ptr *QSyntaxHighlighter) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSyntaxHighlighter_MetaObject
 func callbackQSyntaxHighlighter_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -41898,7 +42316,7 @@ func NewQTabletEventFromPointer(ptr unsafe.Pointer) *QTabletEvent {
 func (ptr *QTabletEvent) DestroyQTabletEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -42284,7 +42702,7 @@ func (ptr *QTextBlock) IsVisible() bool {
 func (ptr *QTextBlock) Document() *QTextDocument {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextDocumentFromPointer(C.QTextBlock_Document(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -42615,7 +43033,7 @@ func NewQTextBlockGroupFromPointer(ptr unsafe.Pointer) *QTextBlockGroup {
 }
 func NewQTextBlockGroup(document QTextDocument_ITF) *QTextBlockGroup {
 	var tmpValue = NewQTextBlockGroupFromPointer(C.QTextBlockGroup_NewQTextBlockGroup(PointerFromQTextDocument(document)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -42623,7 +43041,7 @@ func NewQTextBlockGroup(document QTextDocument_ITF) *QTextBlockGroup {
 
 //export callbackQTextBlockGroup_BlockFormatChanged
 func callbackQTextBlockGroup_BlockFormatChanged(ptr unsafe.Pointer, block unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "blockFormatChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "blockFormatChanged"); signal != nil {
 		signal.(func(*QTextBlock))(NewQTextBlockFromPointer(block))
 	} else {
 		NewQTextBlockGroupFromPointer(ptr).BlockFormatChangedDefault(NewQTextBlockFromPointer(block))
@@ -42633,14 +43051,14 @@ func callbackQTextBlockGroup_BlockFormatChanged(ptr unsafe.Pointer, block unsafe
 func (ptr *QTextBlockGroup) ConnectBlockFormatChanged(f func(block *QTextBlock)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "blockFormatChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "blockFormatChanged", f)
 	}
 }
 
 func (ptr *QTextBlockGroup) DisconnectBlockFormatChanged() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "blockFormatChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "blockFormatChanged")
 	}
 }
 
@@ -42658,7 +43076,7 @@ func (ptr *QTextBlockGroup) BlockFormatChangedDefault(block QTextBlock_ITF) {
 
 //export callbackQTextBlockGroup_BlockInserted
 func callbackQTextBlockGroup_BlockInserted(ptr unsafe.Pointer, block unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "blockInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "blockInserted"); signal != nil {
 		signal.(func(*QTextBlock))(NewQTextBlockFromPointer(block))
 	} else {
 		NewQTextBlockGroupFromPointer(ptr).BlockInsertedDefault(NewQTextBlockFromPointer(block))
@@ -42668,14 +43086,14 @@ func callbackQTextBlockGroup_BlockInserted(ptr unsafe.Pointer, block unsafe.Poin
 func (ptr *QTextBlockGroup) ConnectBlockInserted(f func(block *QTextBlock)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "blockInserted", f)
+		qt.ConnectSignal(ptr.Pointer(), "blockInserted", f)
 	}
 }
 
 func (ptr *QTextBlockGroup) DisconnectBlockInserted() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "blockInserted")
+		qt.DisconnectSignal(ptr.Pointer(), "blockInserted")
 	}
 }
 
@@ -42693,7 +43111,7 @@ func (ptr *QTextBlockGroup) BlockInsertedDefault(block QTextBlock_ITF) {
 
 //export callbackQTextBlockGroup_BlockRemoved
 func callbackQTextBlockGroup_BlockRemoved(ptr unsafe.Pointer, block unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "blockRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "blockRemoved"); signal != nil {
 		signal.(func(*QTextBlock))(NewQTextBlockFromPointer(block))
 	} else {
 		NewQTextBlockGroupFromPointer(ptr).BlockRemovedDefault(NewQTextBlockFromPointer(block))
@@ -42703,14 +43121,14 @@ func callbackQTextBlockGroup_BlockRemoved(ptr unsafe.Pointer, block unsafe.Point
 func (ptr *QTextBlockGroup) ConnectBlockRemoved(f func(block *QTextBlock)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "blockRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "blockRemoved", f)
 	}
 }
 
 func (ptr *QTextBlockGroup) DisconnectBlockRemoved() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "blockRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "blockRemoved")
 	}
 }
 
@@ -42729,7 +43147,7 @@ func (ptr *QTextBlockGroup) BlockRemovedDefault(block QTextBlock_ITF) {
 func (ptr *QTextBlockGroup) DestroyQTextBlockGroup() {
 	if ptr.Pointer() != nil {
 		C.QTextBlockGroup_DestroyQTextBlockGroup(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -42806,7 +43224,7 @@ func NewQTextBlockUserDataFromPointer(ptr unsafe.Pointer) *QTextBlockUserData {
 
 //export callbackQTextBlockUserData_DestroyQTextBlockUserData
 func callbackQTextBlockUserData_DestroyQTextBlockUserData(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTextBlockUserData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTextBlockUserData"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextBlockUserDataFromPointer(ptr).DestroyQTextBlockUserDataDefault()
@@ -42816,21 +43234,21 @@ func callbackQTextBlockUserData_DestroyQTextBlockUserData(ptr unsafe.Pointer) {
 func (ptr *QTextBlockUserData) ConnectDestroyQTextBlockUserData(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextBlockUserData", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTextBlockUserData", f)
 	}
 }
 
 func (ptr *QTextBlockUserData) DisconnectDestroyQTextBlockUserData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextBlockUserData")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTextBlockUserData")
 	}
 }
 
 func (ptr *QTextBlockUserData) DestroyQTextBlockUserData() {
 	if ptr.Pointer() != nil {
 		C.QTextBlockUserData_DestroyQTextBlockUserData(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -42838,7 +43256,7 @@ func (ptr *QTextBlockUserData) DestroyQTextBlockUserData() {
 func (ptr *QTextBlockUserData) DestroyQTextBlockUserDataDefault() {
 	if ptr.Pointer() != nil {
 		C.QTextBlockUserData_DestroyQTextBlockUserDataDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -42941,7 +43359,7 @@ func (ptr *QTextCharFormat) SetUnderlineStyle(style QTextCharFormat__UnderlineSt
 
 func (ptr *QTextCharFormat) AnchorNames() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QTextCharFormat_AnchorNames(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QTextCharFormat_AnchorNames(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -42969,7 +43387,7 @@ func (ptr *QTextCharFormat) SetAnchorHref(value string) {
 
 func (ptr *QTextCharFormat) SetAnchorNames(names []string) {
 	if ptr.Pointer() != nil {
-		var namesC = C.CString(strings.Join(names, "|"))
+		var namesC = cGoPackStringList(names)
 		defer C.free(unsafe.Pointer(namesC))
 		C.QTextCharFormat_SetAnchorNames(ptr.Pointer(), namesC)
 	}
@@ -43414,7 +43832,7 @@ func NewQTextCursor7(cursor QTextCursor_ITF) *QTextCursor {
 func (ptr *QTextCursor) InsertFrame(format QTextFrameFormat_ITF) *QTextFrame {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextFrameFromPointer(C.QTextCursor_InsertFrame(ptr.Pointer(), PointerFromQTextFrameFormat(format)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43425,7 +43843,7 @@ func (ptr *QTextCursor) InsertFrame(format QTextFrameFormat_ITF) *QTextFrame {
 func (ptr *QTextCursor) CreateList2(style QTextListFormat__Style) *QTextList {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextListFromPointer(C.QTextCursor_CreateList2(ptr.Pointer(), C.longlong(style)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43436,7 +43854,7 @@ func (ptr *QTextCursor) CreateList2(style QTextListFormat__Style) *QTextList {
 func (ptr *QTextCursor) CreateList(format QTextListFormat_ITF) *QTextList {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextListFromPointer(C.QTextCursor_CreateList(ptr.Pointer(), PointerFromQTextListFormat(format)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43447,7 +43865,7 @@ func (ptr *QTextCursor) CreateList(format QTextListFormat_ITF) *QTextList {
 func (ptr *QTextCursor) InsertList2(style QTextListFormat__Style) *QTextList {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextListFromPointer(C.QTextCursor_InsertList2(ptr.Pointer(), C.longlong(style)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43458,7 +43876,7 @@ func (ptr *QTextCursor) InsertList2(style QTextListFormat__Style) *QTextList {
 func (ptr *QTextCursor) InsertList(format QTextListFormat_ITF) *QTextList {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextListFromPointer(C.QTextCursor_InsertList(ptr.Pointer(), PointerFromQTextListFormat(format)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43469,7 +43887,7 @@ func (ptr *QTextCursor) InsertList(format QTextListFormat_ITF) *QTextList {
 func (ptr *QTextCursor) InsertTable2(rows int, columns int) *QTextTable {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextTableFromPointer(C.QTextCursor_InsertTable2(ptr.Pointer(), C.int(int32(rows)), C.int(int32(columns))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43480,7 +43898,7 @@ func (ptr *QTextCursor) InsertTable2(rows int, columns int) *QTextTable {
 func (ptr *QTextCursor) InsertTable(rows int, columns int, format QTextTableFormat_ITF) *QTextTable {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextTableFromPointer(C.QTextCursor_InsertTable(ptr.Pointer(), C.int(int32(rows)), C.int(int32(columns)), PointerFromQTextTableFormat(format)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43738,7 +44156,7 @@ func (ptr *QTextCursor) CharFormat() *QTextCharFormat {
 func (ptr *QTextCursor) Document() *QTextDocument {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextDocumentFromPointer(C.QTextCursor_Document(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43758,7 +44176,7 @@ func (ptr *QTextCursor) Selection() *QTextDocumentFragment {
 func (ptr *QTextCursor) CurrentFrame() *QTextFrame {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextFrameFromPointer(C.QTextCursor_CurrentFrame(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43769,7 +44187,7 @@ func (ptr *QTextCursor) CurrentFrame() *QTextFrame {
 func (ptr *QTextCursor) CurrentList() *QTextList {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextListFromPointer(C.QTextCursor_CurrentList(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -43780,7 +44198,7 @@ func (ptr *QTextCursor) CurrentList() *QTextList {
 func (ptr *QTextCursor) CurrentTable() *QTextTable {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextTableFromPointer(C.QTextCursor_CurrentTable(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -44003,7 +44421,7 @@ func NewQTextDocument2(text string, parent core.QObject_ITF) *QTextDocument {
 	var textC = C.CString(text)
 	defer C.free(unsafe.Pointer(textC))
 	var tmpValue = NewQTextDocumentFromPointer(C.QTextDocument_NewQTextDocument2(textC, core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -44011,7 +44429,7 @@ func NewQTextDocument2(text string, parent core.QObject_ITF) *QTextDocument {
 
 //export callbackQTextDocument_CreateObject
 func callbackQTextDocument_CreateObject(ptr unsafe.Pointer, format unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createObject"); signal != nil {
 		return PointerFromQTextObject(signal.(func(*QTextFormat) *QTextObject)(NewQTextFormatFromPointer(format)))
 	}
 
@@ -44021,21 +44439,21 @@ func callbackQTextDocument_CreateObject(ptr unsafe.Pointer, format unsafe.Pointe
 func (ptr *QTextDocument) ConnectCreateObject(f func(format *QTextFormat) *QTextObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "createObject", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectCreateObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createObject")
+		qt.DisconnectSignal(ptr.Pointer(), "createObject")
 	}
 }
 
 func (ptr *QTextDocument) CreateObject(format QTextFormat_ITF) *QTextObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextObjectFromPointer(C.QTextDocument_CreateObject(ptr.Pointer(), PointerFromQTextFormat(format)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -44046,7 +44464,7 @@ func (ptr *QTextDocument) CreateObject(format QTextFormat_ITF) *QTextObject {
 func (ptr *QTextDocument) CreateObjectDefault(format QTextFormat_ITF) *QTextObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextObjectFromPointer(C.QTextDocument_CreateObjectDefault(ptr.Pointer(), PointerFromQTextFormat(format)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -44056,7 +44474,7 @@ func (ptr *QTextDocument) CreateObjectDefault(format QTextFormat_ITF) *QTextObje
 
 func NewQTextDocument(parent core.QObject_ITF) *QTextDocument {
 	var tmpValue = NewQTextDocumentFromPointer(C.QTextDocument_NewQTextDocument(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -44064,7 +44482,7 @@ func NewQTextDocument(parent core.QObject_ITF) *QTextDocument {
 
 //export callbackQTextDocument_LoadResource
 func callbackQTextDocument_LoadResource(ptr unsafe.Pointer, ty C.int, name unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "loadResource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "loadResource"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(int, *core.QUrl) *core.QVariant)(int(int32(ty)), core.NewQUrlFromPointer(name)))
 	}
 
@@ -44074,14 +44492,14 @@ func callbackQTextDocument_LoadResource(ptr unsafe.Pointer, ty C.int, name unsaf
 func (ptr *QTextDocument) ConnectLoadResource(f func(ty int, name *core.QUrl) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "loadResource", f)
+		qt.ConnectSignal(ptr.Pointer(), "loadResource", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectLoadResource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "loadResource")
+		qt.DisconnectSignal(ptr.Pointer(), "loadResource")
 	}
 }
 
@@ -44117,7 +44535,7 @@ func (ptr *QTextDocument) AdjustSize() {
 
 //export callbackQTextDocument_BaseUrlChanged
 func callbackQTextDocument_BaseUrlChanged(ptr unsafe.Pointer, url unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "baseUrlChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "baseUrlChanged"); signal != nil {
 		signal.(func(*core.QUrl))(core.NewQUrlFromPointer(url))
 	}
 
@@ -44126,14 +44544,14 @@ func callbackQTextDocument_BaseUrlChanged(ptr unsafe.Pointer, url unsafe.Pointer
 func (ptr *QTextDocument) ConnectBaseUrlChanged(f func(url *core.QUrl)) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectBaseUrlChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "baseUrlChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "baseUrlChanged", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectBaseUrlChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectBaseUrlChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "baseUrlChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "baseUrlChanged")
 	}
 }
 
@@ -44145,7 +44563,7 @@ func (ptr *QTextDocument) BaseUrlChanged(url core.QUrl_ITF) {
 
 //export callbackQTextDocument_BlockCountChanged
 func callbackQTextDocument_BlockCountChanged(ptr unsafe.Pointer, newBlockCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "blockCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "blockCountChanged"); signal != nil {
 		signal.(func(int))(int(int32(newBlockCount)))
 	}
 
@@ -44154,14 +44572,14 @@ func callbackQTextDocument_BlockCountChanged(ptr unsafe.Pointer, newBlockCount C
 func (ptr *QTextDocument) ConnectBlockCountChanged(f func(newBlockCount int)) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectBlockCountChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "blockCountChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "blockCountChanged", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectBlockCountChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectBlockCountChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "blockCountChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "blockCountChanged")
 	}
 }
 
@@ -44173,7 +44591,7 @@ func (ptr *QTextDocument) BlockCountChanged(newBlockCount int) {
 
 //export callbackQTextDocument_Clear
 func callbackQTextDocument_Clear(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clear"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clear"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextDocumentFromPointer(ptr).ClearDefault()
@@ -44183,14 +44601,14 @@ func callbackQTextDocument_Clear(ptr unsafe.Pointer) {
 func (ptr *QTextDocument) ConnectClear(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clear", f)
+		qt.ConnectSignal(ptr.Pointer(), "clear", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectClear() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clear")
+		qt.DisconnectSignal(ptr.Pointer(), "clear")
 	}
 }
 
@@ -44214,7 +44632,7 @@ func (ptr *QTextDocument) ClearUndoRedoStacks(stacksToClear QTextDocument__Stack
 
 //export callbackQTextDocument_ContentsChange
 func callbackQTextDocument_ContentsChange(ptr unsafe.Pointer, position C.int, charsRemoved C.int, charsAdded C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentsChange"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentsChange"); signal != nil {
 		signal.(func(int, int, int))(int(int32(position)), int(int32(charsRemoved)), int(int32(charsAdded)))
 	}
 
@@ -44223,14 +44641,14 @@ func callbackQTextDocument_ContentsChange(ptr unsafe.Pointer, position C.int, ch
 func (ptr *QTextDocument) ConnectContentsChange(f func(position int, charsRemoved int, charsAdded int)) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectContentsChange(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contentsChange", f)
+		qt.ConnectSignal(ptr.Pointer(), "contentsChange", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectContentsChange() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectContentsChange(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contentsChange")
+		qt.DisconnectSignal(ptr.Pointer(), "contentsChange")
 	}
 }
 
@@ -44242,7 +44660,7 @@ func (ptr *QTextDocument) ContentsChange(position int, charsRemoved int, charsAd
 
 //export callbackQTextDocument_ContentsChanged
 func callbackQTextDocument_ContentsChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentsChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -44251,14 +44669,14 @@ func callbackQTextDocument_ContentsChanged(ptr unsafe.Pointer) {
 func (ptr *QTextDocument) ConnectContentsChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectContentsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contentsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "contentsChanged", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectContentsChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectContentsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contentsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "contentsChanged")
 	}
 }
 
@@ -44270,7 +44688,7 @@ func (ptr *QTextDocument) ContentsChanged() {
 
 //export callbackQTextDocument_CursorPositionChanged
 func callbackQTextDocument_CursorPositionChanged(ptr unsafe.Pointer, cursor unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cursorPositionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cursorPositionChanged"); signal != nil {
 		signal.(func(*QTextCursor))(NewQTextCursorFromPointer(cursor))
 	}
 
@@ -44279,14 +44697,14 @@ func callbackQTextDocument_CursorPositionChanged(ptr unsafe.Pointer, cursor unsa
 func (ptr *QTextDocument) ConnectCursorPositionChanged(f func(cursor *QTextCursor)) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectCursorPositionChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cursorPositionChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "cursorPositionChanged", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectCursorPositionChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectCursorPositionChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cursorPositionChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "cursorPositionChanged")
 	}
 }
 
@@ -44298,7 +44716,7 @@ func (ptr *QTextDocument) CursorPositionChanged(cursor QTextCursor_ITF) {
 
 //export callbackQTextDocument_DocumentLayoutChanged
 func callbackQTextDocument_DocumentLayoutChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "documentLayoutChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "documentLayoutChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -44307,14 +44725,14 @@ func callbackQTextDocument_DocumentLayoutChanged(ptr unsafe.Pointer) {
 func (ptr *QTextDocument) ConnectDocumentLayoutChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectDocumentLayoutChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "documentLayoutChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "documentLayoutChanged", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectDocumentLayoutChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectDocumentLayoutChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "documentLayoutChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "documentLayoutChanged")
 	}
 }
 
@@ -44338,7 +44756,7 @@ func (ptr *QTextDocument) MarkContentsDirty(position int, length int) {
 
 //export callbackQTextDocument_ModificationChanged
 func callbackQTextDocument_ModificationChanged(ptr unsafe.Pointer, changed C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modificationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modificationChanged"); signal != nil {
 		signal.(func(bool))(int8(changed) != 0)
 	}
 
@@ -44347,14 +44765,14 @@ func callbackQTextDocument_ModificationChanged(ptr unsafe.Pointer, changed C.cha
 func (ptr *QTextDocument) ConnectModificationChanged(f func(changed bool)) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectModificationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modificationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "modificationChanged", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectModificationChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectModificationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modificationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "modificationChanged")
 	}
 }
 
@@ -44366,7 +44784,7 @@ func (ptr *QTextDocument) ModificationChanged(changed bool) {
 
 //export callbackQTextDocument_Redo2
 func callbackQTextDocument_Redo2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "redo2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "redo2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextDocumentFromPointer(ptr).Redo2Default()
@@ -44376,14 +44794,14 @@ func callbackQTextDocument_Redo2(ptr unsafe.Pointer) {
 func (ptr *QTextDocument) ConnectRedo2(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "redo2", f)
+		qt.ConnectSignal(ptr.Pointer(), "redo2", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectRedo2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "redo2")
+		qt.DisconnectSignal(ptr.Pointer(), "redo2")
 	}
 }
 
@@ -44407,7 +44825,7 @@ func (ptr *QTextDocument) Redo(cursor QTextCursor_ITF) {
 
 //export callbackQTextDocument_RedoAvailable
 func callbackQTextDocument_RedoAvailable(ptr unsafe.Pointer, available C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "redoAvailable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "redoAvailable"); signal != nil {
 		signal.(func(bool))(int8(available) != 0)
 	}
 
@@ -44416,14 +44834,14 @@ func callbackQTextDocument_RedoAvailable(ptr unsafe.Pointer, available C.char) {
 func (ptr *QTextDocument) ConnectRedoAvailable(f func(available bool)) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectRedoAvailable(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "redoAvailable", f)
+		qt.ConnectSignal(ptr.Pointer(), "redoAvailable", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectRedoAvailable() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectRedoAvailable(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "redoAvailable")
+		qt.DisconnectSignal(ptr.Pointer(), "redoAvailable")
 	}
 }
 
@@ -44507,7 +44925,7 @@ func (ptr *QTextDocument) SetMetaInformation(info QTextDocument__MetaInformation
 
 //export callbackQTextDocument_SetModified
 func callbackQTextDocument_SetModified(ptr unsafe.Pointer, m C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setModified"); signal != nil {
 		signal.(func(bool))(int8(m) != 0)
 	} else {
 		NewQTextDocumentFromPointer(ptr).SetModifiedDefault(int8(m) != 0)
@@ -44517,14 +44935,14 @@ func callbackQTextDocument_SetModified(ptr unsafe.Pointer, m C.char) {
 func (ptr *QTextDocument) ConnectSetModified(f func(m bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setModified", f)
+		qt.ConnectSignal(ptr.Pointer(), "setModified", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectSetModified() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setModified")
+		qt.DisconnectSignal(ptr.Pointer(), "setModified")
 	}
 }
 
@@ -44574,7 +44992,7 @@ func (ptr *QTextDocument) SetUseDesignMetrics(b bool) {
 
 //export callbackQTextDocument_Undo2
 func callbackQTextDocument_Undo2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "undo2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "undo2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextDocumentFromPointer(ptr).Undo2Default()
@@ -44584,14 +45002,14 @@ func callbackQTextDocument_Undo2(ptr unsafe.Pointer) {
 func (ptr *QTextDocument) ConnectUndo2(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "undo2", f)
+		qt.ConnectSignal(ptr.Pointer(), "undo2", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectUndo2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "undo2")
+		qt.DisconnectSignal(ptr.Pointer(), "undo2")
 	}
 }
 
@@ -44615,7 +45033,7 @@ func (ptr *QTextDocument) Undo(cursor QTextCursor_ITF) {
 
 //export callbackQTextDocument_UndoAvailable
 func callbackQTextDocument_UndoAvailable(ptr unsafe.Pointer, available C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "undoAvailable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "undoAvailable"); signal != nil {
 		signal.(func(bool))(int8(available) != 0)
 	}
 
@@ -44624,14 +45042,14 @@ func callbackQTextDocument_UndoAvailable(ptr unsafe.Pointer, available C.char) {
 func (ptr *QTextDocument) ConnectUndoAvailable(f func(available bool)) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectUndoAvailable(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "undoAvailable", f)
+		qt.ConnectSignal(ptr.Pointer(), "undoAvailable", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectUndoAvailable() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectUndoAvailable(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "undoAvailable")
+		qt.DisconnectSignal(ptr.Pointer(), "undoAvailable")
 	}
 }
 
@@ -44643,7 +45061,7 @@ func (ptr *QTextDocument) UndoAvailable(available bool) {
 
 //export callbackQTextDocument_UndoCommandAdded
 func callbackQTextDocument_UndoCommandAdded(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "undoCommandAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "undoCommandAdded"); signal != nil {
 		signal.(func())()
 	}
 
@@ -44652,14 +45070,14 @@ func callbackQTextDocument_UndoCommandAdded(ptr unsafe.Pointer) {
 func (ptr *QTextDocument) ConnectUndoCommandAdded(f func()) {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_ConnectUndoCommandAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "undoCommandAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "undoCommandAdded", f)
 	}
 }
 
 func (ptr *QTextDocument) DisconnectUndoCommandAdded() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DisconnectUndoCommandAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "undoCommandAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "undoCommandAdded")
 	}
 }
 
@@ -44672,7 +45090,7 @@ func (ptr *QTextDocument) UndoCommandAdded() {
 func (ptr *QTextDocument) DestroyQTextDocument() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DestroyQTextDocument(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -44680,7 +45098,7 @@ func (ptr *QTextDocument) DestroyQTextDocument() {
 func (ptr *QTextDocument) DocumentLayout() *QAbstractTextDocumentLayout {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractTextDocumentLayoutFromPointer(C.QTextDocument_DocumentLayout(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -44876,7 +45294,7 @@ func (ptr *QTextDocument) Find2(subString string, position int, options QTextDoc
 func (ptr *QTextDocument) Clone(parent core.QObject_ITF) *QTextDocument {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextDocumentFromPointer(C.QTextDocument_Clone(ptr.Pointer(), core.PointerFromQObject(parent)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -44887,7 +45305,7 @@ func (ptr *QTextDocument) Clone(parent core.QObject_ITF) *QTextDocument {
 func (ptr *QTextDocument) RootFrame() *QTextFrame {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextFrameFromPointer(C.QTextDocument_RootFrame(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -44898,7 +45316,7 @@ func (ptr *QTextDocument) RootFrame() *QTextFrame {
 func (ptr *QTextDocument) Object(objectIndex int) *QTextObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextObjectFromPointer(C.QTextDocument_Object(ptr.Pointer(), C.int(int32(objectIndex))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -44909,7 +45327,7 @@ func (ptr *QTextDocument) Object(objectIndex int) *QTextObject {
 func (ptr *QTextDocument) ObjectForFormat(f QTextFormat_ITF) *QTextObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextObjectFromPointer(C.QTextDocument_ObjectForFormat(ptr.Pointer(), PointerFromQTextFormat(f)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -45137,7 +45555,7 @@ func (ptr *QTextDocument) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QTextDocument) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTextDocument___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -45158,7 +45576,7 @@ func (ptr *QTextDocument) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QTextDocument) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTextDocument___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -45179,7 +45597,7 @@ func (ptr *QTextDocument) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QTextDocument) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTextDocument___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -45200,7 +45618,7 @@ func (ptr *QTextDocument) __findChildren_newList() unsafe.Pointer {
 func (ptr *QTextDocument) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTextDocument___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -45220,7 +45638,7 @@ func (ptr *QTextDocument) __children_newList() unsafe.Pointer {
 
 //export callbackQTextDocument_Event
 func callbackQTextDocument_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -45236,7 +45654,7 @@ func (ptr *QTextDocument) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQTextDocument_EventFilter
 func callbackQTextDocument_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -45252,7 +45670,7 @@ func (ptr *QTextDocument) EventFilterDefault(watched core.QObject_ITF, event cor
 
 //export callbackQTextDocument_ChildEvent
 func callbackQTextDocument_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQTextDocumentFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -45267,7 +45685,7 @@ func (ptr *QTextDocument) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQTextDocument_ConnectNotify
 func callbackQTextDocument_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQTextDocumentFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -45282,7 +45700,7 @@ func (ptr *QTextDocument) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQTextDocument_CustomEvent
 func callbackQTextDocument_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQTextDocumentFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -45297,7 +45715,7 @@ func (ptr *QTextDocument) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQTextDocument_DeleteLater
 func callbackQTextDocument_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextDocumentFromPointer(ptr).DeleteLaterDefault()
@@ -45307,14 +45725,14 @@ func callbackQTextDocument_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QTextDocument) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QTextDocument_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQTextDocument_Destroyed
 func callbackQTextDocument_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -45322,7 +45740,7 @@ func callbackQTextDocument_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQTextDocument_DisconnectNotify
 func callbackQTextDocument_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQTextDocumentFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -45337,7 +45755,7 @@ func (ptr *QTextDocument) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQTextDocument_ObjectNameChanged
 func callbackQTextDocument_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -45345,7 +45763,7 @@ func callbackQTextDocument_ObjectNameChanged(ptr unsafe.Pointer, objectName C.st
 
 //export callbackQTextDocument_TimerEvent
 func callbackQTextDocument_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQTextDocumentFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -45360,7 +45778,7 @@ func (ptr *QTextDocument) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQTextDocument_MetaObject
 func callbackQTextDocument_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -45549,23 +45967,23 @@ func NewQTextDocumentWriterFromPointer(ptr unsafe.Pointer) *QTextDocumentWriter
 	return n
 }
 func QTextDocumentWriter_SupportedDocumentFormats() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTextDocumentWriterFromPointer(l.data).__supportedDocumentFormats_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTextDocumentWriter_QTextDocumentWriter_SupportedDocumentFormats())
+	}(cGoUnpackStringListAndFree(C.QTextDocumentWriter_QTextDocumentWriter_SupportedDocumentFormats()))
 }
 
 func (ptr *QTextDocumentWriter) SupportedDocumentFormats() []*core.QByteArray {
-	return func(l C.struct_QtGui_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQTextDocumentWriterFromPointer(l.data).__supportedDocumentFormats_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QTextDocumentWriter_QTextDocumentWriter_SupportedDocumentFormats())
+	}(cGoUnpackStringListAndFree(C.QTextDocumentWriter_QTextDocumentWriter_SupportedDocumentFormats()))
 }
 
 func NewQTextDocumentWriter() *QTextDocumentWriter {
@@ -45647,7 +46065,7 @@ func (ptr *QTextDocumentWriter) Format() *core.QByteArray {
 func (ptr *QTextDocumentWriter) Device() *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QTextDocumentWriter_Device(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -46268,8 +46686,10 @@ func (ptr *QTextFormat) __properties_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQTextFormatFromPointer(l.data).____properties_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQTextFormatFromPointer(l.data).____properties_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QTextFormat___properties_keyList(ptr.Pointer()))
@@ -46313,6 +46733,16 @@ func (ptr *QTextFormat) ____properties_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QTextFormat_____properties_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QTextFormat) ____properties_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QTextFormat_____properties_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QTextFormat) ____properties_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QTextFormat_____properties_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QTextFragment struct {
 	ptr unsafe.Pointer
 }
@@ -46493,7 +46923,7 @@ func NewQTextFrameFromPointer(ptr unsafe.Pointer) *QTextFrame {
 }
 func NewQTextFrame(document QTextDocument_ITF) *QTextFrame {
 	var tmpValue = NewQTextFrameFromPointer(C.QTextFrame_NewQTextFrame(PointerFromQTextDocument(document)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -46508,7 +46938,7 @@ func (ptr *QTextFrame) SetFrameFormat(format QTextFrameFormat_ITF) {
 func (ptr *QTextFrame) DestroyQTextFrame() {
 	if ptr.Pointer() != nil {
 		C.QTextFrame_DestroyQTextFrame(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -46547,7 +46977,7 @@ func (ptr *QTextFrame) LastCursorPosition() *QTextCursor {
 func (ptr *QTextFrame) ParentFrame() *QTextFrame {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextFrameFromPointer(C.QTextFrame_ParentFrame(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -46581,7 +47011,7 @@ func (ptr *QTextFrame) LastPosition() int {
 func (ptr *QTextFrame) __childFrames_atList(i int) *QTextFrame {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextFrameFromPointer(C.QTextFrame___childFrames_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -47946,7 +48376,7 @@ func NewQTextListFromPointer(ptr unsafe.Pointer) *QTextList {
 func (ptr *QTextList) DestroyQTextList() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -48178,7 +48608,7 @@ func NewQTextObjectFromPointer(ptr unsafe.Pointer) *QTextObject {
 }
 func NewQTextObject(document QTextDocument_ITF) *QTextObject {
 	var tmpValue = NewQTextObjectFromPointer(C.QTextObject_NewQTextObject(PointerFromQTextDocument(document)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -48193,7 +48623,7 @@ func (ptr *QTextObject) SetFormat(format QTextFormat_ITF) {
 func (ptr *QTextObject) DestroyQTextObject() {
 	if ptr.Pointer() != nil {
 		C.QTextObject_DestroyQTextObject(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -48201,7 +48631,7 @@ func (ptr *QTextObject) DestroyQTextObject() {
 func (ptr *QTextObject) Document() *QTextDocument {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTextDocumentFromPointer(C.QTextObject_Document(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -48254,7 +48684,7 @@ func (ptr *QTextObject) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QTextObject) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTextObject___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -48275,7 +48705,7 @@ func (ptr *QTextObject) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QTextObject) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTextObject___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -48296,7 +48726,7 @@ func (ptr *QTextObject) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QTextObject) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTextObject___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -48317,7 +48747,7 @@ func (ptr *QTextObject) __findChildren_newList() unsafe.Pointer {
 func (ptr *QTextObject) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTextObject___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -48337,7 +48767,7 @@ func (ptr *QTextObject) __children_newList() unsafe.Pointer {
 
 //export callbackQTextObject_Event
 func callbackQTextObject_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -48353,7 +48783,7 @@ func (ptr *QTextObject) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQTextObject_EventFilter
 func callbackQTextObject_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -48369,7 +48799,7 @@ func (ptr *QTextObject) EventFilterDefault(watched core.QObject_ITF, event core.
 
 //export callbackQTextObject_ChildEvent
 func callbackQTextObject_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQTextObjectFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -48384,7 +48814,7 @@ func (ptr *QTextObject) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQTextObject_ConnectNotify
 func callbackQTextObject_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQTextObjectFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -48399,7 +48829,7 @@ func (ptr *QTextObject) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQTextObject_CustomEvent
 func callbackQTextObject_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQTextObjectFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -48414,7 +48844,7 @@ func (ptr *QTextObject) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQTextObject_DeleteLater
 func callbackQTextObject_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextObjectFromPointer(ptr).DeleteLaterDefault()
@@ -48424,14 +48854,14 @@ func callbackQTextObject_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QTextObject) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QTextObject_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQTextObject_Destroyed
 func callbackQTextObject_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -48439,7 +48869,7 @@ func callbackQTextObject_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQTextObject_DisconnectNotify
 func callbackQTextObject_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQTextObjectFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -48454,7 +48884,7 @@ func (ptr *QTextObject) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQTextObject_ObjectNameChanged
 func callbackQTextObject_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -48462,7 +48892,7 @@ func callbackQTextObject_ObjectNameChanged(ptr unsafe.Pointer, objectName C.stru
 
 //export callbackQTextObject_TimerEvent
 func callbackQTextObject_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQTextObjectFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -48477,7 +48907,7 @@ func (ptr *QTextObject) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQTextObject_MetaObject
 func callbackQTextObject_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -48531,7 +48961,7 @@ func NewQTextObjectInterfaceFromPointer(ptr unsafe.Pointer) *QTextObjectInterfac
 
 //export callbackQTextObjectInterface_IntrinsicSize
 func callbackQTextObjectInterface_IntrinsicSize(ptr unsafe.Pointer, doc unsafe.Pointer, posInDocument C.int, format unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "intrinsicSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "intrinsicSize"); signal != nil {
 		return core.PointerFromQSizeF(signal.(func(*QTextDocument, int, *QTextFormat) *core.QSizeF)(NewQTextDocumentFromPointer(doc), int(int32(posInDocument)), NewQTextFormatFromPointer(format)))
 	}
 
@@ -48541,14 +48971,14 @@ func callbackQTextObjectInterface_IntrinsicSize(ptr unsafe.Pointer, doc unsafe.P
 func (ptr *QTextObjectInterface) ConnectIntrinsicSize(f func(doc *QTextDocument, posInDocument int, format *QTextFormat) *core.QSizeF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "intrinsicSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "intrinsicSize", f)
 	}
 }
 
 func (ptr *QTextObjectInterface) DisconnectIntrinsicSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "intrinsicSize")
+		qt.DisconnectSignal(ptr.Pointer(), "intrinsicSize")
 	}
 }
 
@@ -48563,7 +48993,7 @@ func (ptr *QTextObjectInterface) IntrinsicSize(doc QTextDocument_ITF, posInDocum
 
 //export callbackQTextObjectInterface_DrawObject
 func callbackQTextObjectInterface_DrawObject(ptr unsafe.Pointer, painter unsafe.Pointer, rect unsafe.Pointer, doc unsafe.Pointer, posInDocument C.int, format unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawObject"); signal != nil {
 		signal.(func(*QPainter, *core.QRectF, *QTextDocument, int, *QTextFormat))(NewQPainterFromPointer(painter), core.NewQRectFFromPointer(rect), NewQTextDocumentFromPointer(doc), int(int32(posInDocument)), NewQTextFormatFromPointer(format))
 	}
 
@@ -48572,14 +49002,14 @@ func callbackQTextObjectInterface_DrawObject(ptr unsafe.Pointer, painter unsafe.
 func (ptr *QTextObjectInterface) ConnectDrawObject(f func(painter *QPainter, rect *core.QRectF, doc *QTextDocument, posInDocument int, format *QTextFormat)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "drawObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "drawObject", f)
 	}
 }
 
 func (ptr *QTextObjectInterface) DisconnectDrawObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "drawObject")
+		qt.DisconnectSignal(ptr.Pointer(), "drawObject")
 	}
 }
 
@@ -48591,7 +49021,7 @@ func (ptr *QTextObjectInterface) DrawObject(painter QPainter_ITF, rect core.QRec
 
 //export callbackQTextObjectInterface_DestroyQTextObjectInterface
 func callbackQTextObjectInterface_DestroyQTextObjectInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTextObjectInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTextObjectInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextObjectInterfaceFromPointer(ptr).DestroyQTextObjectInterfaceDefault()
@@ -48601,21 +49031,21 @@ func callbackQTextObjectInterface_DestroyQTextObjectInterface(ptr unsafe.Pointer
 func (ptr *QTextObjectInterface) ConnectDestroyQTextObjectInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextObjectInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTextObjectInterface", f)
 	}
 }
 
 func (ptr *QTextObjectInterface) DisconnectDestroyQTextObjectInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextObjectInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTextObjectInterface")
 	}
 }
 
 func (ptr *QTextObjectInterface) DestroyQTextObjectInterface() {
 	if ptr.Pointer() != nil {
 		C.QTextObjectInterface_DestroyQTextObjectInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -48623,7 +49053,7 @@ func (ptr *QTextObjectInterface) DestroyQTextObjectInterface() {
 func (ptr *QTextObjectInterface) DestroyQTextObjectInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QTextObjectInterface_DestroyQTextObjectInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -48734,13 +49164,13 @@ func (ptr *QTextOption) SetFlags(flags QTextOption__Flag) {
 
 func (ptr *QTextOption) SetTabArray(tabStops []float64) {
 	if ptr.Pointer() != nil {
-		C.QTextOption_SetTabArray(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQTextOptionFromPointer(NewQTextOptionFromPointer(nil).__setTabArray_tabStops_newList())
-			for _, v := range tabStops {
-				tmpList.__setTabArray_tabStops_setList(v)
+		C.QTextOption_SetTabArray(ptr.Pointer(), func(l []float64) unsafe.Pointer {
+			var tmpList = make([]C.double, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.double(v)
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQTextOptionFromPointer(nil).__setTabArray_tabStops_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(tabStops))
 	}
 }
 
@@ -48786,8 +49216,10 @@ func (ptr *QTextOption) TabArray() []float64 {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtGui_PackedList) []float64 {
 			var out = make([]float64, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQTextOptionFromPointer(l.data).__tabArray_atList(i)
+			var tmpList = make([]C.double, int(l.len)+1)
+			NewQTextOptionFromPointer(l.data).__tabArray_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = float64(v)
 			}
 			return out
 		}(C.QTextOption_TabArray(ptr.Pointer()))
@@ -48847,6 +49279,16 @@ func (ptr *QTextOption) __setTabArray_tabStops_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QTextOption___setTabArray_tabStops_newList(ptr.Pointer()))
 }
 
+func (ptr *QTextOption) __setTabArray_tabStops_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QTextOption___setTabArray_tabStops_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QTextOption) __setTabArray_tabStops_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QTextOption___setTabArray_tabStops_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QTextOption) __tabArray_atList(i int) float64 {
 	if ptr.Pointer() != nil {
 		return float64(C.QTextOption___tabArray_atList(ptr.Pointer(), C.int(int32(i))))
@@ -48864,6 +49306,16 @@ func (ptr *QTextOption) __tabArray_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QTextOption___tabArray_newList(ptr.Pointer()))
 }
 
+func (ptr *QTextOption) __tabArray_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QTextOption___tabArray_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QTextOption) __tabArray_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QTextOption___tabArray_fillList(ptr.Pointer(), data)
+	}
+}
+
 type QTextTable struct {
 	QTextFrame
 }
@@ -48906,7 +49358,7 @@ func NewQTextTableFromPointer(ptr unsafe.Pointer) *QTextTable {
 func (ptr *QTextTable) DestroyQTextTable() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -49659,7 +50111,7 @@ func NewQTouchEventFromPointer(ptr unsafe.Pointer) *QTouchEvent {
 func (ptr *QTouchEvent) DestroyQTouchEvent() {
 	if ptr.Pointer() != nil {
 		C.QTouchEvent_DestroyQTouchEvent(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -49667,7 +50119,7 @@ func (ptr *QTouchEvent) DestroyQTouchEvent() {
 func (ptr *QTouchEvent) Target() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTouchEvent_Target(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -49685,7 +50137,7 @@ func (ptr *QTouchEvent) Device() *QTouchDevice {
 func (ptr *QTouchEvent) Window() *QWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQWindowFromPointer(C.QTouchEvent_Window(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -49716,7 +50168,7 @@ func (ptr *QTouchEvent) Set_device(vqt QTouchDevice_ITF) {
 func (ptr *QTouchEvent) _target() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTouchEvent__target(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -49746,7 +50198,7 @@ func (ptr *QTouchEvent) Set_touchPointStates(vqt core.Qt__TouchPointState) {
 func (ptr *QTouchEvent) _window() *QWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQWindowFromPointer(C.QTouchEvent__window(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -50295,7 +50747,7 @@ const (
 
 //export callbackQValidator_Changed
 func callbackQValidator_Changed(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changed"); signal != nil {
 		signal.(func())()
 	}
 
@@ -50304,14 +50756,14 @@ func callbackQValidator_Changed(ptr unsafe.Pointer) {
 func (ptr *QValidator) ConnectChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QValidator_ConnectChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "changed", f)
+		qt.ConnectSignal(ptr.Pointer(), "changed", f)
 	}
 }
 
 func (ptr *QValidator) DisconnectChanged() {
 	if ptr.Pointer() != nil {
 		C.QValidator_DisconnectChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "changed")
+		qt.DisconnectSignal(ptr.Pointer(), "changed")
 	}
 }
 
@@ -50323,7 +50775,7 @@ func (ptr *QValidator) Changed() {
 
 //export callbackQValidator_Fixup
 func callbackQValidator_Fixup(ptr unsafe.Pointer, input C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fixup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fixup"); signal != nil {
 		signal.(func(string))(cGoUnpackString(input))
 	} else {
 		NewQValidatorFromPointer(ptr).FixupDefault(cGoUnpackString(input))
@@ -50333,14 +50785,14 @@ func callbackQValidator_Fixup(ptr unsafe.Pointer, input C.struct_QtGui_PackedStr
 func (ptr *QValidator) ConnectFixup(f func(input string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fixup", f)
+		qt.ConnectSignal(ptr.Pointer(), "fixup", f)
 	}
 }
 
 func (ptr *QValidator) DisconnectFixup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fixup")
+		qt.DisconnectSignal(ptr.Pointer(), "fixup")
 	}
 }
 
@@ -50362,7 +50814,7 @@ func (ptr *QValidator) FixupDefault(input string) {
 
 func NewQValidator(parent core.QObject_ITF) *QValidator {
 	var tmpValue = NewQValidatorFromPointer(C.QValidator_NewQValidator(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -50377,7 +50829,7 @@ func (ptr *QValidator) SetLocale(locale core.QLocale_ITF) {
 func (ptr *QValidator) DestroyQValidator() {
 	if ptr.Pointer() != nil {
 		C.QValidator_DestroyQValidator(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -50393,7 +50845,7 @@ func (ptr *QValidator) Locale() *core.QLocale {
 
 //export callbackQValidator_Validate
 func callbackQValidator_Validate(ptr unsafe.Pointer, input C.struct_QtGui_PackedString, pos C.int) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "validate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "validate"); signal != nil {
 		return C.longlong(signal.(func(string, int) QValidator__State)(cGoUnpackString(input), int(int32(pos))))
 	}
 
@@ -50403,14 +50855,14 @@ func callbackQValidator_Validate(ptr unsafe.Pointer, input C.struct_QtGui_Packed
 func (ptr *QValidator) ConnectValidate(f func(input string, pos int) QValidator__State) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "validate", f)
+		qt.ConnectSignal(ptr.Pointer(), "validate", f)
 	}
 }
 
 func (ptr *QValidator) DisconnectValidate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "validate")
+		qt.DisconnectSignal(ptr.Pointer(), "validate")
 	}
 }
 
@@ -50445,7 +50897,7 @@ func (ptr *QValidator) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QValidator) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QValidator___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -50466,7 +50918,7 @@ func (ptr *QValidator) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QValidator) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QValidator___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -50487,7 +50939,7 @@ func (ptr *QValidator) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QValidator) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QValidator___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -50508,7 +50960,7 @@ func (ptr *QValidator) __findChildren_newList() unsafe.Pointer {
 func (ptr *QValidator) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QValidator___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -50528,7 +50980,7 @@ func (ptr *QValidator) __children_newList() unsafe.Pointer {
 
 //export callbackQValidator_Event
 func callbackQValidator_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -50544,7 +50996,7 @@ func (ptr *QValidator) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQValidator_EventFilter
 func callbackQValidator_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -50560,7 +51012,7 @@ func (ptr *QValidator) EventFilterDefault(watched core.QObject_ITF, event core.Q
 
 //export callbackQValidator_ChildEvent
 func callbackQValidator_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQValidatorFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -50575,7 +51027,7 @@ func (ptr *QValidator) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQValidator_ConnectNotify
 func callbackQValidator_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQValidatorFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -50590,7 +51042,7 @@ func (ptr *QValidator) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQValidator_CustomEvent
 func callbackQValidator_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQValidatorFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -50605,7 +51057,7 @@ func (ptr *QValidator) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQValidator_DeleteLater
 func callbackQValidator_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQValidatorFromPointer(ptr).DeleteLaterDefault()
@@ -50615,14 +51067,14 @@ func callbackQValidator_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QValidator) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QValidator_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQValidator_Destroyed
 func callbackQValidator_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -50630,7 +51082,7 @@ func callbackQValidator_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQValidator_DisconnectNotify
 func callbackQValidator_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQValidatorFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -50645,7 +51097,7 @@ func (ptr *QValidator) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQValidator_ObjectNameChanged
 func callbackQValidator_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -50653,7 +51105,7 @@ func callbackQValidator_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struc
 
 //export callbackQValidator_TimerEvent
 func callbackQValidator_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQValidatorFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -50668,7 +51120,7 @@ func (ptr *QValidator) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQValidator_MetaObject
 func callbackQValidator_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -51456,7 +51908,7 @@ func NewQWhatsThisClickedEventFromPointer(ptr unsafe.Pointer) *QWhatsThisClicked
 func (ptr *QWhatsThisClickedEvent) DestroyQWhatsThisClickedEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -51516,7 +51968,7 @@ func NewQWheelEventFromPointer(ptr unsafe.Pointer) *QWheelEvent {
 func (ptr *QWheelEvent) DestroyQWheelEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -51816,7 +52268,7 @@ const (
 
 func QWindow_FromWinId(id uintptr) *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QWindow_QWindow_FromWinId(C.uintptr_t(id)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -51824,7 +52276,7 @@ func QWindow_FromWinId(id uintptr) *QWindow {
 
 func (ptr *QWindow) FromWinId(id uintptr) *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QWindow_QWindow_FromWinId(C.uintptr_t(id)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -51832,7 +52284,7 @@ func (ptr *QWindow) FromWinId(id uintptr) *QWindow {
 
 func NewQWindow(targetScreen QScreen_ITF) *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QWindow_NewQWindow(PointerFromQScreen(targetScreen)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -51840,7 +52292,7 @@ func NewQWindow(targetScreen QScreen_ITF) *QWindow {
 
 func NewQWindow2(parent QWindow_ITF) *QWindow {
 	var tmpValue = NewQWindowFromPointer(C.QWindow_NewQWindow2(PointerFromQWindow(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -51848,7 +52300,7 @@ func NewQWindow2(parent QWindow_ITF) *QWindow {
 
 //export callbackQWindow_Close
 func callbackQWindow_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -51858,14 +52310,14 @@ func callbackQWindow_Close(ptr unsafe.Pointer) C.char {
 func (ptr *QWindow) ConnectClose(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "close", f)
+		qt.ConnectSignal(ptr.Pointer(), "close", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectClose() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "close")
+		qt.DisconnectSignal(ptr.Pointer(), "close")
 	}
 }
 
@@ -51885,7 +52337,7 @@ func (ptr *QWindow) CloseDefault() bool {
 
 //export callbackQWindow_Event
 func callbackQWindow_Event(ptr unsafe.Pointer, ev unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(ev)))))
 	}
 
@@ -51895,14 +52347,14 @@ func callbackQWindow_Event(ptr unsafe.Pointer, ev unsafe.Pointer) C.char {
 func (ptr *QWindow) ConnectEvent(f func(ev *core.QEvent) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "event", f)
+		qt.ConnectSignal(ptr.Pointer(), "event", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "event")
+		qt.DisconnectSignal(ptr.Pointer(), "event")
 	}
 }
 
@@ -51922,7 +52374,7 @@ func (ptr *QWindow) EventDefault(ev core.QEvent_ITF) bool {
 
 //export callbackQWindow_NativeEvent
 func callbackQWindow_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -51932,14 +52384,14 @@ func callbackQWindow_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, m
 func (ptr *QWindow) ConnectNativeEvent(f func(eventType *core.QByteArray, message unsafe.Pointer, result int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nativeEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "nativeEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectNativeEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nativeEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "nativeEvent")
 	}
 }
 
@@ -51973,7 +52425,7 @@ func (ptr *QWindow) SetMouseGrabEnabled(grab bool) bool {
 
 //export callbackQWindow_ActiveChanged
 func callbackQWindow_ActiveChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -51982,14 +52434,14 @@ func callbackQWindow_ActiveChanged(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectActiveChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectActiveChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectActiveChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectActiveChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "activeChanged")
 	}
 }
 
@@ -52001,7 +52453,7 @@ func (ptr *QWindow) ActiveChanged() {
 
 //export callbackQWindow_Alert
 func callbackQWindow_Alert(ptr unsafe.Pointer, msec C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "alert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "alert"); signal != nil {
 		signal.(func(int))(int(int32(msec)))
 	} else {
 		NewQWindowFromPointer(ptr).AlertDefault(int(int32(msec)))
@@ -52011,14 +52463,14 @@ func callbackQWindow_Alert(ptr unsafe.Pointer, msec C.int) {
 func (ptr *QWindow) ConnectAlert(f func(msec int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "alert", f)
+		qt.ConnectSignal(ptr.Pointer(), "alert", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectAlert() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "alert")
+		qt.DisconnectSignal(ptr.Pointer(), "alert")
 	}
 }
 
@@ -52036,7 +52488,7 @@ func (ptr *QWindow) AlertDefault(msec int) {
 
 //export callbackQWindow_ContentOrientationChanged
 func callbackQWindow_ContentOrientationChanged(ptr unsafe.Pointer, orientation C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentOrientationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentOrientationChanged"); signal != nil {
 		signal.(func(core.Qt__ScreenOrientation))(core.Qt__ScreenOrientation(orientation))
 	}
 
@@ -52045,14 +52497,14 @@ func callbackQWindow_ContentOrientationChanged(ptr unsafe.Pointer, orientation C
 func (ptr *QWindow) ConnectContentOrientationChanged(f func(orientation core.Qt__ScreenOrientation)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectContentOrientationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contentOrientationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "contentOrientationChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectContentOrientationChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectContentOrientationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contentOrientationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "contentOrientationChanged")
 	}
 }
 
@@ -52076,7 +52528,7 @@ func (ptr *QWindow) Destroy() {
 
 //export callbackQWindow_ExposeEvent
 func callbackQWindow_ExposeEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "exposeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "exposeEvent"); signal != nil {
 		signal.(func(*QExposeEvent))(NewQExposeEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).ExposeEventDefault(NewQExposeEventFromPointer(ev))
@@ -52086,14 +52538,14 @@ func callbackQWindow_ExposeEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectExposeEvent(f func(ev *QExposeEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "exposeEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "exposeEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectExposeEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "exposeEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "exposeEvent")
 	}
 }
 
@@ -52111,7 +52563,7 @@ func (ptr *QWindow) ExposeEventDefault(ev QExposeEvent_ITF) {
 
 //export callbackQWindow_FocusInEvent
 func callbackQWindow_FocusInEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*QFocusEvent))(NewQFocusEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).FocusInEventDefault(NewQFocusEventFromPointer(ev))
@@ -52121,14 +52573,14 @@ func callbackQWindow_FocusInEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectFocusInEvent(f func(ev *QFocusEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "focusInEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "focusInEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectFocusInEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "focusInEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "focusInEvent")
 	}
 }
 
@@ -52146,7 +52598,7 @@ func (ptr *QWindow) FocusInEventDefault(ev QFocusEvent_ITF) {
 
 //export callbackQWindow_FocusObjectChanged
 func callbackQWindow_FocusObjectChanged(ptr unsafe.Pointer, object unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusObjectChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusObjectChanged"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(object))
 	}
 
@@ -52155,14 +52607,14 @@ func callbackQWindow_FocusObjectChanged(ptr unsafe.Pointer, object unsafe.Pointe
 func (ptr *QWindow) ConnectFocusObjectChanged(f func(object *core.QObject)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectFocusObjectChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "focusObjectChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "focusObjectChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectFocusObjectChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectFocusObjectChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "focusObjectChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "focusObjectChanged")
 	}
 }
 
@@ -52174,7 +52626,7 @@ func (ptr *QWindow) FocusObjectChanged(object core.QObject_ITF) {
 
 //export callbackQWindow_FocusOutEvent
 func callbackQWindow_FocusOutEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*QFocusEvent))(NewQFocusEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).FocusOutEventDefault(NewQFocusEventFromPointer(ev))
@@ -52184,14 +52636,14 @@ func callbackQWindow_FocusOutEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectFocusOutEvent(f func(ev *QFocusEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "focusOutEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "focusOutEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectFocusOutEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "focusOutEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "focusOutEvent")
 	}
 }
 
@@ -52209,7 +52661,7 @@ func (ptr *QWindow) FocusOutEventDefault(ev QFocusEvent_ITF) {
 
 //export callbackQWindow_HeightChanged
 func callbackQWindow_HeightChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -52218,14 +52670,14 @@ func callbackQWindow_HeightChanged(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectHeightChanged(f func(arg int)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectHeightChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "heightChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "heightChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectHeightChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectHeightChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "heightChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "heightChanged")
 	}
 }
 
@@ -52237,7 +52689,7 @@ func (ptr *QWindow) HeightChanged(arg int) {
 
 //export callbackQWindow_Hide
 func callbackQWindow_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).HideDefault()
@@ -52247,14 +52699,14 @@ func callbackQWindow_Hide(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectHide(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hide", f)
+		qt.ConnectSignal(ptr.Pointer(), "hide", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectHide() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hide")
+		qt.DisconnectSignal(ptr.Pointer(), "hide")
 	}
 }
 
@@ -52272,7 +52724,7 @@ func (ptr *QWindow) HideDefault() {
 
 //export callbackQWindow_HideEvent
 func callbackQWindow_HideEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*QHideEvent))(NewQHideEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).HideEventDefault(NewQHideEventFromPointer(ev))
@@ -52282,14 +52734,14 @@ func callbackQWindow_HideEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectHideEvent(f func(ev *QHideEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hideEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "hideEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectHideEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hideEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "hideEvent")
 	}
 }
 
@@ -52307,7 +52759,7 @@ func (ptr *QWindow) HideEventDefault(ev QHideEvent_ITF) {
 
 //export callbackQWindow_KeyPressEvent
 func callbackQWindow_KeyPressEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*QKeyEvent))(NewQKeyEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).KeyPressEventDefault(NewQKeyEventFromPointer(ev))
@@ -52317,14 +52769,14 @@ func callbackQWindow_KeyPressEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectKeyPressEvent(f func(ev *QKeyEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "keyPressEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "keyPressEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectKeyPressEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "keyPressEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "keyPressEvent")
 	}
 }
 
@@ -52342,7 +52794,7 @@ func (ptr *QWindow) KeyPressEventDefault(ev QKeyEvent_ITF) {
 
 //export callbackQWindow_KeyReleaseEvent
 func callbackQWindow_KeyReleaseEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*QKeyEvent))(NewQKeyEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).KeyReleaseEventDefault(NewQKeyEventFromPointer(ev))
@@ -52352,14 +52804,14 @@ func callbackQWindow_KeyReleaseEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectKeyReleaseEvent(f func(ev *QKeyEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "keyReleaseEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "keyReleaseEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectKeyReleaseEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "keyReleaseEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "keyReleaseEvent")
 	}
 }
 
@@ -52377,7 +52829,7 @@ func (ptr *QWindow) KeyReleaseEventDefault(ev QKeyEvent_ITF) {
 
 //export callbackQWindow_Lower
 func callbackQWindow_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).LowerDefault()
@@ -52387,14 +52839,14 @@ func callbackQWindow_Lower(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectLower(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lower", f)
+		qt.ConnectSignal(ptr.Pointer(), "lower", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectLower() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lower")
+		qt.DisconnectSignal(ptr.Pointer(), "lower")
 	}
 }
 
@@ -52412,7 +52864,7 @@ func (ptr *QWindow) LowerDefault() {
 
 //export callbackQWindow_MaximumHeightChanged
 func callbackQWindow_MaximumHeightChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maximumHeightChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maximumHeightChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -52421,14 +52873,14 @@ func callbackQWindow_MaximumHeightChanged(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectMaximumHeightChanged(f func(arg int)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectMaximumHeightChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maximumHeightChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maximumHeightChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectMaximumHeightChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectMaximumHeightChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maximumHeightChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maximumHeightChanged")
 	}
 }
 
@@ -52440,7 +52892,7 @@ func (ptr *QWindow) MaximumHeightChanged(arg int) {
 
 //export callbackQWindow_MaximumWidthChanged
 func callbackQWindow_MaximumWidthChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maximumWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maximumWidthChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -52449,14 +52901,14 @@ func callbackQWindow_MaximumWidthChanged(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectMaximumWidthChanged(f func(arg int)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectMaximumWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maximumWidthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maximumWidthChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectMaximumWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectMaximumWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maximumWidthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maximumWidthChanged")
 	}
 }
 
@@ -52468,7 +52920,7 @@ func (ptr *QWindow) MaximumWidthChanged(arg int) {
 
 //export callbackQWindow_MinimumHeightChanged
 func callbackQWindow_MinimumHeightChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumHeightChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumHeightChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -52477,14 +52929,14 @@ func callbackQWindow_MinimumHeightChanged(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectMinimumHeightChanged(f func(arg int)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectMinimumHeightChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minimumHeightChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minimumHeightChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectMinimumHeightChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectMinimumHeightChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minimumHeightChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minimumHeightChanged")
 	}
 }
 
@@ -52496,7 +52948,7 @@ func (ptr *QWindow) MinimumHeightChanged(arg int) {
 
 //export callbackQWindow_MinimumWidthChanged
 func callbackQWindow_MinimumWidthChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumWidthChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -52505,14 +52957,14 @@ func callbackQWindow_MinimumWidthChanged(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectMinimumWidthChanged(f func(arg int)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectMinimumWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "minimumWidthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "minimumWidthChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectMinimumWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectMinimumWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "minimumWidthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "minimumWidthChanged")
 	}
 }
 
@@ -52524,7 +52976,7 @@ func (ptr *QWindow) MinimumWidthChanged(arg int) {
 
 //export callbackQWindow_ModalityChanged
 func callbackQWindow_ModalityChanged(ptr unsafe.Pointer, modality C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modalityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modalityChanged"); signal != nil {
 		signal.(func(core.Qt__WindowModality))(core.Qt__WindowModality(modality))
 	}
 
@@ -52533,14 +52985,14 @@ func callbackQWindow_ModalityChanged(ptr unsafe.Pointer, modality C.longlong) {
 func (ptr *QWindow) ConnectModalityChanged(f func(modality core.Qt__WindowModality)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectModalityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modalityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "modalityChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectModalityChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectModalityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modalityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "modalityChanged")
 	}
 }
 
@@ -52552,7 +53004,7 @@ func (ptr *QWindow) ModalityChanged(modality core.Qt__WindowModality) {
 
 //export callbackQWindow_MouseDoubleClickEvent
 func callbackQWindow_MouseDoubleClickEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*QMouseEvent))(NewQMouseEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).MouseDoubleClickEventDefault(NewQMouseEventFromPointer(ev))
@@ -52562,14 +53014,14 @@ func callbackQWindow_MouseDoubleClickEvent(ptr unsafe.Pointer, ev unsafe.Pointer
 func (ptr *QWindow) ConnectMouseDoubleClickEvent(f func(ev *QMouseEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseDoubleClickEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseDoubleClickEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectMouseDoubleClickEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseDoubleClickEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseDoubleClickEvent")
 	}
 }
 
@@ -52587,7 +53039,7 @@ func (ptr *QWindow) MouseDoubleClickEventDefault(ev QMouseEvent_ITF) {
 
 //export callbackQWindow_MouseMoveEvent
 func callbackQWindow_MouseMoveEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*QMouseEvent))(NewQMouseEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).MouseMoveEventDefault(NewQMouseEventFromPointer(ev))
@@ -52597,14 +53049,14 @@ func callbackQWindow_MouseMoveEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectMouseMoveEvent(f func(ev *QMouseEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseMoveEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseMoveEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectMouseMoveEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseMoveEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseMoveEvent")
 	}
 }
 
@@ -52622,7 +53074,7 @@ func (ptr *QWindow) MouseMoveEventDefault(ev QMouseEvent_ITF) {
 
 //export callbackQWindow_MousePressEvent
 func callbackQWindow_MousePressEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*QMouseEvent))(NewQMouseEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).MousePressEventDefault(NewQMouseEventFromPointer(ev))
@@ -52632,14 +53084,14 @@ func callbackQWindow_MousePressEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectMousePressEvent(f func(ev *QMouseEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mousePressEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectMousePressEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mousePressEvent")
 	}
 }
 
@@ -52657,7 +53109,7 @@ func (ptr *QWindow) MousePressEventDefault(ev QMouseEvent_ITF) {
 
 //export callbackQWindow_MouseReleaseEvent
 func callbackQWindow_MouseReleaseEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*QMouseEvent))(NewQMouseEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).MouseReleaseEventDefault(NewQMouseEventFromPointer(ev))
@@ -52667,14 +53119,14 @@ func callbackQWindow_MouseReleaseEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectMouseReleaseEvent(f func(ev *QMouseEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseReleaseEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseReleaseEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectMouseReleaseEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseReleaseEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseReleaseEvent")
 	}
 }
 
@@ -52692,7 +53144,7 @@ func (ptr *QWindow) MouseReleaseEventDefault(ev QMouseEvent_ITF) {
 
 //export callbackQWindow_MoveEvent
 func callbackQWindow_MoveEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*QMoveEvent))(NewQMoveEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).MoveEventDefault(NewQMoveEventFromPointer(ev))
@@ -52702,14 +53154,14 @@ func callbackQWindow_MoveEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectMoveEvent(f func(ev *QMoveEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "moveEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "moveEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectMoveEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "moveEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "moveEvent")
 	}
 }
 
@@ -52727,7 +53179,7 @@ func (ptr *QWindow) MoveEventDefault(ev QMoveEvent_ITF) {
 
 //export callbackQWindow_OpacityChanged
 func callbackQWindow_OpacityChanged(ptr unsafe.Pointer, opacity C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "opacityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "opacityChanged"); signal != nil {
 		signal.(func(float64))(float64(opacity))
 	}
 
@@ -52736,14 +53188,14 @@ func callbackQWindow_OpacityChanged(ptr unsafe.Pointer, opacity C.double) {
 func (ptr *QWindow) ConnectOpacityChanged(f func(opacity float64)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectOpacityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "opacityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "opacityChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectOpacityChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectOpacityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "opacityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "opacityChanged")
 	}
 }
 
@@ -52755,7 +53207,7 @@ func (ptr *QWindow) OpacityChanged(opacity float64) {
 
 //export callbackQWindow_Raise
 func callbackQWindow_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).RaiseDefault()
@@ -52765,14 +53217,14 @@ func callbackQWindow_Raise(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectRaise(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "raise", f)
+		qt.ConnectSignal(ptr.Pointer(), "raise", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectRaise() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "raise")
+		qt.DisconnectSignal(ptr.Pointer(), "raise")
 	}
 }
 
@@ -52796,7 +53248,7 @@ func (ptr *QWindow) ReportContentOrientationChange(orientation core.Qt__ScreenOr
 
 //export callbackQWindow_RequestActivate
 func callbackQWindow_RequestActivate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestActivate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestActivate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).RequestActivateDefault()
@@ -52806,14 +53258,14 @@ func callbackQWindow_RequestActivate(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectRequestActivate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "requestActivate", f)
+		qt.ConnectSignal(ptr.Pointer(), "requestActivate", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectRequestActivate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "requestActivate")
+		qt.DisconnectSignal(ptr.Pointer(), "requestActivate")
 	}
 }
 
@@ -52831,7 +53283,7 @@ func (ptr *QWindow) RequestActivateDefault() {
 
 //export callbackQWindow_RequestUpdate
 func callbackQWindow_RequestUpdate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestUpdate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestUpdate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).RequestUpdateDefault()
@@ -52841,14 +53293,14 @@ func callbackQWindow_RequestUpdate(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectRequestUpdate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "requestUpdate", f)
+		qt.ConnectSignal(ptr.Pointer(), "requestUpdate", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectRequestUpdate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "requestUpdate")
+		qt.DisconnectSignal(ptr.Pointer(), "requestUpdate")
 	}
 }
 
@@ -52878,7 +53330,7 @@ func (ptr *QWindow) Resize2(w int, h int) {
 
 //export callbackQWindow_ResizeEvent
 func callbackQWindow_ResizeEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*QResizeEvent))(NewQResizeEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).ResizeEventDefault(NewQResizeEventFromPointer(ev))
@@ -52888,14 +53340,14 @@ func callbackQWindow_ResizeEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectResizeEvent(f func(ev *QResizeEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resizeEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "resizeEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectResizeEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resizeEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "resizeEvent")
 	}
 }
 
@@ -52913,7 +53365,7 @@ func (ptr *QWindow) ResizeEventDefault(ev QResizeEvent_ITF) {
 
 //export callbackQWindow_ScreenChanged
 func callbackQWindow_ScreenChanged(ptr unsafe.Pointer, screen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "screenChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "screenChanged"); signal != nil {
 		signal.(func(*QScreen))(NewQScreenFromPointer(screen))
 	}
 
@@ -52922,14 +53374,14 @@ func callbackQWindow_ScreenChanged(ptr unsafe.Pointer, screen unsafe.Pointer) {
 func (ptr *QWindow) ConnectScreenChanged(f func(screen *QScreen)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectScreenChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "screenChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "screenChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectScreenChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectScreenChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "screenChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "screenChanged")
 	}
 }
 
@@ -52991,7 +53443,7 @@ func (ptr *QWindow) SetGeometry(posx int, posy int, w int, h int) {
 
 //export callbackQWindow_SetHeight
 func callbackQWindow_SetHeight(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHeight"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHeight"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	} else {
 		NewQWindowFromPointer(ptr).SetHeightDefault(int(int32(arg)))
@@ -53001,14 +53453,14 @@ func callbackQWindow_SetHeight(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectSetHeight(f func(arg int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setHeight", f)
+		qt.ConnectSignal(ptr.Pointer(), "setHeight", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetHeight() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setHeight")
+		qt.DisconnectSignal(ptr.Pointer(), "setHeight")
 	}
 }
 
@@ -53038,7 +53490,7 @@ func (ptr *QWindow) SetMask(region QRegion_ITF) {
 
 //export callbackQWindow_SetMaximumHeight
 func callbackQWindow_SetMaximumHeight(ptr unsafe.Pointer, h C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMaximumHeight"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMaximumHeight"); signal != nil {
 		signal.(func(int))(int(int32(h)))
 	} else {
 		NewQWindowFromPointer(ptr).SetMaximumHeightDefault(int(int32(h)))
@@ -53048,14 +53500,14 @@ func callbackQWindow_SetMaximumHeight(ptr unsafe.Pointer, h C.int) {
 func (ptr *QWindow) ConnectSetMaximumHeight(f func(h int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setMaximumHeight", f)
+		qt.ConnectSignal(ptr.Pointer(), "setMaximumHeight", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetMaximumHeight() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setMaximumHeight")
+		qt.DisconnectSignal(ptr.Pointer(), "setMaximumHeight")
 	}
 }
 
@@ -53079,7 +53531,7 @@ func (ptr *QWindow) SetMaximumSize(size core.QSize_ITF) {
 
 //export callbackQWindow_SetMaximumWidth
 func callbackQWindow_SetMaximumWidth(ptr unsafe.Pointer, w C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMaximumWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMaximumWidth"); signal != nil {
 		signal.(func(int))(int(int32(w)))
 	} else {
 		NewQWindowFromPointer(ptr).SetMaximumWidthDefault(int(int32(w)))
@@ -53089,14 +53541,14 @@ func callbackQWindow_SetMaximumWidth(ptr unsafe.Pointer, w C.int) {
 func (ptr *QWindow) ConnectSetMaximumWidth(f func(w int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setMaximumWidth", f)
+		qt.ConnectSignal(ptr.Pointer(), "setMaximumWidth", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetMaximumWidth() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setMaximumWidth")
+		qt.DisconnectSignal(ptr.Pointer(), "setMaximumWidth")
 	}
 }
 
@@ -53114,7 +53566,7 @@ func (ptr *QWindow) SetMaximumWidthDefault(w int) {
 
 //export callbackQWindow_SetMinimumHeight
 func callbackQWindow_SetMinimumHeight(ptr unsafe.Pointer, h C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMinimumHeight"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMinimumHeight"); signal != nil {
 		signal.(func(int))(int(int32(h)))
 	} else {
 		NewQWindowFromPointer(ptr).SetMinimumHeightDefault(int(int32(h)))
@@ -53124,14 +53576,14 @@ func callbackQWindow_SetMinimumHeight(ptr unsafe.Pointer, h C.int) {
 func (ptr *QWindow) ConnectSetMinimumHeight(f func(h int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setMinimumHeight", f)
+		qt.ConnectSignal(ptr.Pointer(), "setMinimumHeight", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetMinimumHeight() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setMinimumHeight")
+		qt.DisconnectSignal(ptr.Pointer(), "setMinimumHeight")
 	}
 }
 
@@ -53155,7 +53607,7 @@ func (ptr *QWindow) SetMinimumSize(size core.QSize_ITF) {
 
 //export callbackQWindow_SetMinimumWidth
 func callbackQWindow_SetMinimumWidth(ptr unsafe.Pointer, w C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMinimumWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMinimumWidth"); signal != nil {
 		signal.(func(int))(int(int32(w)))
 	} else {
 		NewQWindowFromPointer(ptr).SetMinimumWidthDefault(int(int32(w)))
@@ -53165,14 +53617,14 @@ func callbackQWindow_SetMinimumWidth(ptr unsafe.Pointer, w C.int) {
 func (ptr *QWindow) ConnectSetMinimumWidth(f func(w int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setMinimumWidth", f)
+		qt.ConnectSignal(ptr.Pointer(), "setMinimumWidth", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetMinimumWidth() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setMinimumWidth")
+		qt.DisconnectSignal(ptr.Pointer(), "setMinimumWidth")
 	}
 }
 
@@ -53238,7 +53690,7 @@ func (ptr *QWindow) SetSurfaceType(surfaceType QSurface__SurfaceType) {
 
 //export callbackQWindow_SetTitle
 func callbackQWindow_SetTitle(ptr unsafe.Pointer, vqs C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQWindowFromPointer(ptr).SetTitleDefault(cGoUnpackString(vqs))
@@ -53248,14 +53700,14 @@ func callbackQWindow_SetTitle(ptr unsafe.Pointer, vqs C.struct_QtGui_PackedStrin
 func (ptr *QWindow) ConnectSetTitle(f func(vqs string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setTitle", f)
+		qt.ConnectSignal(ptr.Pointer(), "setTitle", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetTitle() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setTitle")
+		qt.DisconnectSignal(ptr.Pointer(), "setTitle")
 	}
 }
 
@@ -53289,7 +53741,7 @@ func (ptr *QWindow) SetVisibility(v QWindow__Visibility) {
 
 //export callbackQWindow_SetVisible
 func callbackQWindow_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQWindowFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -53299,14 +53751,14 @@ func callbackQWindow_SetVisible(ptr unsafe.Pointer, visible C.char) {
 func (ptr *QWindow) ConnectSetVisible(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setVisible", f)
+		qt.ConnectSignal(ptr.Pointer(), "setVisible", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetVisible() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setVisible")
+		qt.DisconnectSignal(ptr.Pointer(), "setVisible")
 	}
 }
 
@@ -53324,7 +53776,7 @@ func (ptr *QWindow) SetVisibleDefault(visible bool) {
 
 //export callbackQWindow_SetWidth
 func callbackQWindow_SetWidth(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWidth"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	} else {
 		NewQWindowFromPointer(ptr).SetWidthDefault(int(int32(arg)))
@@ -53334,14 +53786,14 @@ func callbackQWindow_SetWidth(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectSetWidth(f func(arg int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setWidth", f)
+		qt.ConnectSignal(ptr.Pointer(), "setWidth", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetWidth() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setWidth")
+		qt.DisconnectSignal(ptr.Pointer(), "setWidth")
 	}
 }
 
@@ -53365,7 +53817,7 @@ func (ptr *QWindow) SetWindowState(state core.Qt__WindowState) {
 
 //export callbackQWindow_SetX
 func callbackQWindow_SetX(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setX"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setX"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	} else {
 		NewQWindowFromPointer(ptr).SetXDefault(int(int32(arg)))
@@ -53375,14 +53827,14 @@ func callbackQWindow_SetX(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectSetX(f func(arg int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setX", f)
+		qt.ConnectSignal(ptr.Pointer(), "setX", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetX() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setX")
+		qt.DisconnectSignal(ptr.Pointer(), "setX")
 	}
 }
 
@@ -53400,7 +53852,7 @@ func (ptr *QWindow) SetXDefault(arg int) {
 
 //export callbackQWindow_SetY
 func callbackQWindow_SetY(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setY"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setY"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	} else {
 		NewQWindowFromPointer(ptr).SetYDefault(int(int32(arg)))
@@ -53410,14 +53862,14 @@ func callbackQWindow_SetY(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectSetY(f func(arg int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setY", f)
+		qt.ConnectSignal(ptr.Pointer(), "setY", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSetY() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setY")
+		qt.DisconnectSignal(ptr.Pointer(), "setY")
 	}
 }
 
@@ -53435,7 +53887,7 @@ func (ptr *QWindow) SetYDefault(arg int) {
 
 //export callbackQWindow_Show
 func callbackQWindow_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).ShowDefault()
@@ -53445,14 +53897,14 @@ func callbackQWindow_Show(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectShow(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "show", f)
+		qt.ConnectSignal(ptr.Pointer(), "show", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectShow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "show")
+		qt.DisconnectSignal(ptr.Pointer(), "show")
 	}
 }
 
@@ -53470,7 +53922,7 @@ func (ptr *QWindow) ShowDefault() {
 
 //export callbackQWindow_ShowEvent
 func callbackQWindow_ShowEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*QShowEvent))(NewQShowEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).ShowEventDefault(NewQShowEventFromPointer(ev))
@@ -53480,14 +53932,14 @@ func callbackQWindow_ShowEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectShowEvent(f func(ev *QShowEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "showEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "showEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectShowEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "showEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "showEvent")
 	}
 }
 
@@ -53505,7 +53957,7 @@ func (ptr *QWindow) ShowEventDefault(ev QShowEvent_ITF) {
 
 //export callbackQWindow_ShowFullScreen
 func callbackQWindow_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).ShowFullScreenDefault()
@@ -53515,14 +53967,14 @@ func callbackQWindow_ShowFullScreen(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectShowFullScreen(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "showFullScreen", f)
+		qt.ConnectSignal(ptr.Pointer(), "showFullScreen", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectShowFullScreen() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "showFullScreen")
+		qt.DisconnectSignal(ptr.Pointer(), "showFullScreen")
 	}
 }
 
@@ -53540,7 +53992,7 @@ func (ptr *QWindow) ShowFullScreenDefault() {
 
 //export callbackQWindow_ShowMaximized
 func callbackQWindow_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).ShowMaximizedDefault()
@@ -53550,14 +54002,14 @@ func callbackQWindow_ShowMaximized(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectShowMaximized(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "showMaximized", f)
+		qt.ConnectSignal(ptr.Pointer(), "showMaximized", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectShowMaximized() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "showMaximized")
+		qt.DisconnectSignal(ptr.Pointer(), "showMaximized")
 	}
 }
 
@@ -53575,7 +54027,7 @@ func (ptr *QWindow) ShowMaximizedDefault() {
 
 //export callbackQWindow_ShowMinimized
 func callbackQWindow_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).ShowMinimizedDefault()
@@ -53585,14 +54037,14 @@ func callbackQWindow_ShowMinimized(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectShowMinimized(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "showMinimized", f)
+		qt.ConnectSignal(ptr.Pointer(), "showMinimized", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectShowMinimized() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "showMinimized")
+		qt.DisconnectSignal(ptr.Pointer(), "showMinimized")
 	}
 }
 
@@ -53610,7 +54062,7 @@ func (ptr *QWindow) ShowMinimizedDefault() {
 
 //export callbackQWindow_ShowNormal
 func callbackQWindow_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).ShowNormalDefault()
@@ -53620,14 +54072,14 @@ func callbackQWindow_ShowNormal(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectShowNormal(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "showNormal", f)
+		qt.ConnectSignal(ptr.Pointer(), "showNormal", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectShowNormal() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "showNormal")
+		qt.DisconnectSignal(ptr.Pointer(), "showNormal")
 	}
 }
 
@@ -53645,7 +54097,7 @@ func (ptr *QWindow) ShowNormalDefault() {
 
 //export callbackQWindow_TabletEvent
 func callbackQWindow_TabletEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*QTabletEvent))(NewQTabletEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).TabletEventDefault(NewQTabletEventFromPointer(ev))
@@ -53655,14 +54107,14 @@ func callbackQWindow_TabletEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectTabletEvent(f func(ev *QTabletEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "tabletEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "tabletEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectTabletEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "tabletEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "tabletEvent")
 	}
 }
 
@@ -53680,7 +54132,7 @@ func (ptr *QWindow) TabletEventDefault(ev QTabletEvent_ITF) {
 
 //export callbackQWindow_TouchEvent
 func callbackQWindow_TouchEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "touchEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "touchEvent"); signal != nil {
 		signal.(func(*QTouchEvent))(NewQTouchEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).TouchEventDefault(NewQTouchEventFromPointer(ev))
@@ -53690,14 +54142,14 @@ func callbackQWindow_TouchEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectTouchEvent(f func(ev *QTouchEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "touchEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "touchEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectTouchEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "touchEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "touchEvent")
 	}
 }
 
@@ -53721,7 +54173,7 @@ func (ptr *QWindow) UnsetCursor() {
 
 //export callbackQWindow_VisibilityChanged
 func callbackQWindow_VisibilityChanged(ptr unsafe.Pointer, visibility C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibilityChanged"); signal != nil {
 		signal.(func(QWindow__Visibility))(QWindow__Visibility(visibility))
 	}
 
@@ -53730,14 +54182,14 @@ func callbackQWindow_VisibilityChanged(ptr unsafe.Pointer, visibility C.longlong
 func (ptr *QWindow) ConnectVisibilityChanged(f func(visibility QWindow__Visibility)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectVisibilityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "visibilityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "visibilityChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectVisibilityChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectVisibilityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "visibilityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "visibilityChanged")
 	}
 }
 
@@ -53749,7 +54201,7 @@ func (ptr *QWindow) VisibilityChanged(visibility QWindow__Visibility) {
 
 //export callbackQWindow_VisibleChanged
 func callbackQWindow_VisibleChanged(ptr unsafe.Pointer, arg C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibleChanged"); signal != nil {
 		signal.(func(bool))(int8(arg) != 0)
 	}
 
@@ -53758,14 +54210,14 @@ func callbackQWindow_VisibleChanged(ptr unsafe.Pointer, arg C.char) {
 func (ptr *QWindow) ConnectVisibleChanged(f func(arg bool)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectVisibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "visibleChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectVisibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectVisibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "visibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "visibleChanged")
 	}
 }
 
@@ -53777,7 +54229,7 @@ func (ptr *QWindow) VisibleChanged(arg bool) {
 
 //export callbackQWindow_WheelEvent
 func callbackQWindow_WheelEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*QWheelEvent))(NewQWheelEventFromPointer(ev))
 	} else {
 		NewQWindowFromPointer(ptr).WheelEventDefault(NewQWheelEventFromPointer(ev))
@@ -53787,14 +54239,14 @@ func callbackQWindow_WheelEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
 func (ptr *QWindow) ConnectWheelEvent(f func(ev *QWheelEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "wheelEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "wheelEvent", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectWheelEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "wheelEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "wheelEvent")
 	}
 }
 
@@ -53812,7 +54264,7 @@ func (ptr *QWindow) WheelEventDefault(ev QWheelEvent_ITF) {
 
 //export callbackQWindow_WidthChanged
 func callbackQWindow_WidthChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "widthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "widthChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -53821,14 +54273,14 @@ func callbackQWindow_WidthChanged(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectWidthChanged(f func(arg int)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectWidthChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "widthChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "widthChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectWidthChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectWidthChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "widthChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "widthChanged")
 	}
 }
 
@@ -53840,7 +54292,7 @@ func (ptr *QWindow) WidthChanged(arg int) {
 
 //export callbackQWindow_WindowStateChanged
 func callbackQWindow_WindowStateChanged(ptr unsafe.Pointer, windowState C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowStateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowStateChanged"); signal != nil {
 		signal.(func(core.Qt__WindowState))(core.Qt__WindowState(windowState))
 	}
 
@@ -53849,14 +54301,14 @@ func callbackQWindow_WindowStateChanged(ptr unsafe.Pointer, windowState C.longlo
 func (ptr *QWindow) ConnectWindowStateChanged(f func(windowState core.Qt__WindowState)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectWindowStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "windowStateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "windowStateChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectWindowStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectWindowStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "windowStateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "windowStateChanged")
 	}
 }
 
@@ -53868,7 +54320,7 @@ func (ptr *QWindow) WindowStateChanged(windowState core.Qt__WindowState) {
 
 //export callbackQWindow_WindowTitleChanged
 func callbackQWindow_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -53877,14 +54329,14 @@ func callbackQWindow_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtGui
 func (ptr *QWindow) ConnectWindowTitleChanged(f func(title string)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectWindowTitleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "windowTitleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "windowTitleChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectWindowTitleChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectWindowTitleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "windowTitleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "windowTitleChanged")
 	}
 }
 
@@ -53898,7 +54350,7 @@ func (ptr *QWindow) WindowTitleChanged(title string) {
 
 //export callbackQWindow_XChanged
 func callbackQWindow_XChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -53907,14 +54359,14 @@ func callbackQWindow_XChanged(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectXChanged(f func(arg int)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectXChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "xChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "xChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectXChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectXChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "xChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "xChanged")
 	}
 }
 
@@ -53926,7 +54378,7 @@ func (ptr *QWindow) XChanged(arg int) {
 
 //export callbackQWindow_YChanged
 func callbackQWindow_YChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -53935,14 +54387,14 @@ func callbackQWindow_YChanged(ptr unsafe.Pointer, arg C.int) {
 func (ptr *QWindow) ConnectYChanged(f func(arg int)) {
 	if ptr.Pointer() != nil {
 		C.QWindow_ConnectYChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "yChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "yChanged", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectYChanged() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DisconnectYChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "yChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "yChanged")
 	}
 }
 
@@ -53954,7 +54406,7 @@ func (ptr *QWindow) YChanged(arg int) {
 
 //export callbackQWindow_DestroyQWindow
 func callbackQWindow_DestroyQWindow(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QWindow"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).DestroyQWindowDefault()
@@ -53964,21 +54416,21 @@ func callbackQWindow_DestroyQWindow(ptr unsafe.Pointer) {
 func (ptr *QWindow) ConnectDestroyQWindow(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QWindow", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectDestroyQWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "~QWindow")
 	}
 }
 
 func (ptr *QWindow) DestroyQWindow() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DestroyQWindow(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -53986,7 +54438,7 @@ func (ptr *QWindow) DestroyQWindow() {
 func (ptr *QWindow) DestroyQWindowDefault() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DestroyQWindowDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -54020,7 +54472,7 @@ func (ptr *QWindow) FrameMargins() *core.QMargins {
 
 //export callbackQWindow_FocusObject
 func callbackQWindow_FocusObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusObject"); signal != nil {
 		return core.PointerFromQObject(signal.(func() *core.QObject)())
 	}
 
@@ -54030,21 +54482,21 @@ func callbackQWindow_FocusObject(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QWindow) ConnectFocusObject(f func() *core.QObject) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "focusObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "focusObject", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectFocusObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "focusObject")
+		qt.DisconnectSignal(ptr.Pointer(), "focusObject")
 	}
 }
 
 func (ptr *QWindow) FocusObject() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWindow_FocusObject(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -54055,7 +54507,7 @@ func (ptr *QWindow) FocusObject() *core.QObject {
 func (ptr *QWindow) FocusObjectDefault() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWindow_FocusObjectDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -54129,7 +54581,7 @@ func (ptr *QWindow) Mask() *QRegion {
 func (ptr *QWindow) Screen() *QScreen {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScreenFromPointer(C.QWindow_Screen(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -54166,7 +54618,7 @@ func (ptr *QWindow) MinimumSize() *core.QSize {
 
 //export callbackQWindow_Size
 func callbackQWindow_Size(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -54176,14 +54628,14 @@ func callbackQWindow_Size(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QWindow) ConnectSize(f func() *core.QSize) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "size", f)
+		qt.ConnectSignal(ptr.Pointer(), "size", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "size")
+		qt.DisconnectSignal(ptr.Pointer(), "size")
 	}
 }
 
@@ -54230,7 +54682,7 @@ func (ptr *QWindow) Title() string {
 
 //export callbackQWindow_Format
 func callbackQWindow_Format(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "format"); signal != nil {
+	if signal := qt.GetSignal(ptr, "format"); signal != nil {
 		return PointerFromQSurfaceFormat(signal.(func() *QSurfaceFormat)())
 	}
 
@@ -54240,14 +54692,14 @@ func callbackQWindow_Format(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QWindow) ConnectFormat(f func() *QSurfaceFormat) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "format", f)
+		qt.ConnectSignal(ptr.Pointer(), "format", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectFormat() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "format")
+		qt.DisconnectSignal(ptr.Pointer(), "format")
 	}
 }
 
@@ -54281,7 +54733,7 @@ func (ptr *QWindow) RequestedFormat() *QSurfaceFormat {
 func (ptr *QWindow) Parent() *QWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQWindowFromPointer(C.QWindow_Parent(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -54292,7 +54744,7 @@ func (ptr *QWindow) Parent() *QWindow {
 func (ptr *QWindow) TransientParent() *QWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQWindowFromPointer(C.QWindow_TransientParent(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -54337,7 +54789,7 @@ func (ptr *QWindow) Type() core.Qt__WindowType {
 
 //export callbackQWindow_SurfaceType
 func callbackQWindow_SurfaceType(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "surfaceType"); signal != nil {
+	if signal := qt.GetSignal(ptr, "surfaceType"); signal != nil {
 		return C.longlong(signal.(func() QSurface__SurfaceType)())
 	}
 
@@ -54347,14 +54799,14 @@ func callbackQWindow_SurfaceType(ptr unsafe.Pointer) C.longlong {
 func (ptr *QWindow) ConnectSurfaceType(f func() QSurface__SurfaceType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "surfaceType", f)
+		qt.ConnectSignal(ptr.Pointer(), "surfaceType", f)
 	}
 }
 
 func (ptr *QWindow) DisconnectSurfaceType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "surfaceType")
+		qt.DisconnectSignal(ptr.Pointer(), "surfaceType")
 	}
 }
 
@@ -54520,7 +54972,7 @@ func (ptr *QWindow) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QWindow) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWindow___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -54541,7 +54993,7 @@ func (ptr *QWindow) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QWindow) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWindow___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -54562,7 +55014,7 @@ func (ptr *QWindow) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QWindow) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWindow___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -54583,7 +55035,7 @@ func (ptr *QWindow) __findChildren_newList() unsafe.Pointer {
 func (ptr *QWindow) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWindow___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -54603,7 +55055,7 @@ func (ptr *QWindow) __children_newList() unsafe.Pointer {
 
 //export callbackQWindow_EventFilter
 func callbackQWindow_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -54626,7 +55078,7 @@ func (ptr *QWindow) EventFilterDefault(watched core.QObject_ITF, event core.QEve
 
 //export callbackQWindow_ChildEvent
 func callbackQWindow_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQWindowFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -54647,7 +55099,7 @@ func (ptr *QWindow) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQWindow_ConnectNotify
 func callbackQWindow_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQWindowFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -54668,7 +55120,7 @@ func (ptr *QWindow) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQWindow_CustomEvent
 func callbackQWindow_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQWindowFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -54689,7 +55141,7 @@ func (ptr *QWindow) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQWindow_DeleteLater
 func callbackQWindow_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWindowFromPointer(ptr).DeleteLaterDefault()
@@ -54699,7 +55151,7 @@ func callbackQWindow_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QWindow) DeleteLater() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DeleteLater(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -54707,14 +55159,14 @@ func (ptr *QWindow) DeleteLater() {
 func (ptr *QWindow) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QWindow_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQWindow_Destroyed
 func callbackQWindow_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -54722,7 +55174,7 @@ func callbackQWindow_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQWindow_DisconnectNotify
 func callbackQWindow_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQWindowFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -54743,7 +55195,7 @@ func (ptr *QWindow) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQWindow_ObjectNameChanged
 func callbackQWindow_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtGui_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -54751,7 +55203,7 @@ func callbackQWindow_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_Q
 
 //export callbackQWindow_TimerEvent
 func callbackQWindow_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQWindowFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -54772,7 +55224,7 @@ func (ptr *QWindow) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQWindow_MetaObject
 func callbackQWindow_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -54835,7 +55287,7 @@ func NewQWindowStateChangeEventFromPointer(ptr unsafe.Pointer) *QWindowStateChan
 func (ptr *QWindowStateChangeEvent) DestroyQWindowStateChangeEvent() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
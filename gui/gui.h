@@ -248,9 +248,13 @@ void* QAccessibleTableInterface___selectedCells_newList(void* ptr);
 int QAccessibleTableInterface___selectedColumns_atList(void* ptr, int i);
 void QAccessibleTableInterface___selectedColumns_setList(void* ptr, int i);
 void* QAccessibleTableInterface___selectedColumns_newList(void* ptr);
+void* QAccessibleTableInterface___selectedColumns_newListBuffer(void* ptr, void* data, int count);
+void QAccessibleTableInterface___selectedColumns_fillList(void* ptr, void* data);
 int QAccessibleTableInterface___selectedRows_atList(void* ptr, int i);
 void QAccessibleTableInterface___selectedRows_setList(void* ptr, int i);
 void* QAccessibleTableInterface___selectedRows_newList(void* ptr);
+void* QAccessibleTableInterface___selectedRows_newListBuffer(void* ptr, void* data, int count);
+void QAccessibleTableInterface___selectedRows_fillList(void* ptr, void* data);
 void* QAccessibleTableModelChangeEvent_NewQAccessibleTableModelChangeEvent2(void* iface, long long changeType);
 void* QAccessibleTableModelChangeEvent_NewQAccessibleTableModelChangeEvent(void* object, long long changeType);
 void QAccessibleTableModelChangeEvent_SetFirstColumn(void* ptr, int column);
@@ -811,12 +815,18 @@ int QFontDatabase_Weight(void* ptr, char* family, char* style);
 int QFontDatabase___pointSizes_atList(void* ptr, int i);
 void QFontDatabase___pointSizes_setList(void* ptr, int i);
 void* QFontDatabase___pointSizes_newList(void* ptr);
+void* QFontDatabase___pointSizes_newListBuffer(void* ptr, void* data, int count);
+void QFontDatabase___pointSizes_fillList(void* ptr, void* data);
 int QFontDatabase___smoothSizes_atList(void* ptr, int i);
 void QFontDatabase___smoothSizes_setList(void* ptr, int i);
 void* QFontDatabase___smoothSizes_newList(void* ptr);
+void* QFontDatabase___smoothSizes_newListBuffer(void* ptr, void* data, int count);
+void QFontDatabase___smoothSizes_fillList(void* ptr, void* data);
 int QFontDatabase___standardSizes_atList(void* ptr, int i);
 void QFontDatabase___standardSizes_setList(void* ptr, int i);
 void* QFontDatabase___standardSizes_newList(void* ptr);
+void* QFontDatabase___standardSizes_newListBuffer(void* ptr, void* data, int count);
+void QFontDatabase___standardSizes_fillList(void* ptr, void* data);
 void* QFontInfo_NewQFontInfo(void* font);
 void* QFontInfo_NewQFontInfo2(void* fi);
 void QFontInfo_Swap(void* ptr, void* other);
@@ -960,9 +970,13 @@ void* QGlyphRun___setGlyphIndexes_glyphIndexes_newList(void* ptr);
 void* QGlyphRun___setPositions_positions_atList(void* ptr, int i);
 void QGlyphRun___setPositions_positions_setList(void* ptr, void* i);
 void* QGlyphRun___setPositions_positions_newList(void* ptr);
+void* QGlyphRun___setPositions_positions_newListBuffer(void* ptr, void* data, int count);
+void QGlyphRun___setPositions_positions_fillList(void* ptr, void* data);
 void* QGlyphRun___positions_atList(void* ptr, int i);
 void QGlyphRun___positions_setList(void* ptr, void* i);
 void* QGlyphRun___positions_newList(void* ptr);
+void* QGlyphRun___positions_newListBuffer(void* ptr, void* data, int count);
+void QGlyphRun___positions_fillList(void* ptr, void* data);
 unsigned int QGlyphRun___glyphIndexes_atList(void* ptr, int i);
 void QGlyphRun___glyphIndexes_setList(void* ptr, unsigned int i);
 void* QGlyphRun___glyphIndexes_newList(void* ptr);
@@ -1134,6 +1148,8 @@ void QIcon_Paint2(void* ptr, void* painter, int x, int y, int w, int h, long lon
 void* QIcon___availableSizes_atList(void* ptr, int i);
 void QIcon___availableSizes_setList(void* ptr, void* i);
 void* QIcon___availableSizes_newList(void* ptr);
+void* QIcon___availableSizes_newListBuffer(void* ptr, void* data, int count);
+void QIcon___availableSizes_fillList(void* ptr, void* data);
 void* QIconDragEvent_NewQIconDragEvent();
 void* QIconEngine_NewQIconEngine();
 void* QIconEngine_Pixmap(void* ptr, void* size, long long mode, long long state);
@@ -1164,6 +1180,8 @@ char QIconEngine_WriteDefault(void* ptr, void* out);
 void* QIconEngine___availableSizes_atList(void* ptr, int i);
 void QIconEngine___availableSizes_setList(void* ptr, void* i);
 void* QIconEngine___availableSizes_newList(void* ptr);
+void* QIconEngine___availableSizes_newListBuffer(void* ptr, void* data, int count);
+void QIconEngine___availableSizes_fillList(void* ptr, void* data);
 void* QIconEnginePlugin_Create(void* ptr, char* filename);
 void* QIconEnginePlugin_NewQIconEnginePlugin(void* parent);
 void QIconEnginePlugin_DestroyQIconEnginePlugin(void* ptr);
@@ -1340,8 +1358,8 @@ void* QImageReader_Read(void* ptr);
 void* QImageReader_NewQImageReader();
 void* QImageReader_NewQImageReader2(void* device, void* format);
 void* QImageReader_NewQImageReader3(char* fileName, void* format);
-struct QtGui_PackedList QImageReader_QImageReader_SupportedImageFormats();
-struct QtGui_PackedList QImageReader_QImageReader_SupportedMimeTypes();
+struct QtGui_PackedString QImageReader_QImageReader_SupportedImageFormats();
+struct QtGui_PackedString QImageReader_QImageReader_SupportedMimeTypes();
 char QImageReader_JumpToImage(void* ptr, int imageNumber);
 char QImageReader_JumpToNextImage(void* ptr);
 char QImageReader_Read2(void* ptr, void* image);
@@ -1365,7 +1383,7 @@ void* QImageReader_BackgroundColor(void* ptr);
 void* QImageReader_Device(void* ptr);
 long long QImageReader_ImageFormat(void* ptr);
 long long QImageReader_Transformation(void* ptr);
-struct QtGui_PackedList QImageReader_SupportedSubTypes(void* ptr);
+struct QtGui_PackedString QImageReader_SupportedSubTypes(void* ptr);
 void* QImageReader_ClipRect(void* ptr);
 void* QImageReader_CurrentImageRect(void* ptr);
 void* QImageReader_ScaledClipRect(void* ptr);
@@ -1399,8 +1417,8 @@ void* QImageReader___supportedSubTypes_newList(void* ptr);
 void* QImageWriter_NewQImageWriter();
 void* QImageWriter_NewQImageWriter2(void* device, void* format);
 void* QImageWriter_NewQImageWriter3(char* fileName, void* format);
-struct QtGui_PackedList QImageWriter_QImageWriter_SupportedImageFormats();
-struct QtGui_PackedList QImageWriter_QImageWriter_SupportedMimeTypes();
+struct QtGui_PackedString QImageWriter_QImageWriter_SupportedImageFormats();
+struct QtGui_PackedString QImageWriter_QImageWriter_SupportedMimeTypes();
 char QImageWriter_Write(void* ptr, void* image);
 void QImageWriter_SetCompression(void* ptr, int compression);
 void QImageWriter_SetDevice(void* ptr, void* device);
@@ -1419,7 +1437,7 @@ void* QImageWriter_Format(void* ptr);
 void* QImageWriter_SubType(void* ptr);
 void* QImageWriter_Device(void* ptr);
 long long QImageWriter_Transformation(void* ptr);
-struct QtGui_PackedList QImageWriter_SupportedSubTypes(void* ptr);
+struct QtGui_PackedString QImageWriter_SupportedSubTypes(void* ptr);
 struct QtGui_PackedString QImageWriter_ErrorString(void* ptr);
 struct QtGui_PackedString QImageWriter_FileName(void* ptr);
 char QImageWriter_CanWrite(void* ptr);
@@ -1672,7 +1690,7 @@ void QMouseEvent_SetVelocity(void* ptr, void* vqv);
 void* QMoveEvent_NewQMoveEvent(void* pos, void* oldPos);
 void* QMoveEvent_OldPos(void* ptr);
 void* QMoveEvent_Pos(void* ptr);
-struct QtGui_PackedList QMovie_QMovie_SupportedFormats();
+struct QtGui_PackedString QMovie_QMovie_SupportedFormats();
 void* QMovie_NewQMovie2(void* device, void* format, void* parent);
 void* QMovie_NewQMovie(void* parent);
 void* QMovie_NewQMovie3(char* fileName, void* format, void* parent);
@@ -2212,21 +2230,33 @@ double QPainter_Opacity(void* ptr);
 void* QPainter___drawLines_lines_atList6(void* ptr, int i);
 void QPainter___drawLines_lines_setList6(void* ptr, void* i);
 void* QPainter___drawLines_lines_newList6(void* ptr);
+void* QPainter___drawLines_lines_newListBuffer6(void* ptr, void* data, int count);
+void QPainter___drawLines_lines_fillList6(void* ptr, void* data);
 void* QPainter___drawLines_lines_atList2(void* ptr, int i);
 void QPainter___drawLines_lines_setList2(void* ptr, void* i);
 void* QPainter___drawLines_lines_newList2(void* ptr);
+void* QPainter___drawLines_lines_newListBuffer2(void* ptr, void* data, int count);
+void QPainter___drawLines_lines_fillList2(void* ptr, void* data);
 void* QPainter___drawLines_pointPairs_atList8(void* ptr, int i);
 void QPainter___drawLines_pointPairs_setList8(void* ptr, void* i);
 void* QPainter___drawLines_pointPairs_newList8(void* ptr);
+void* QPainter___drawLines_pointPairs_newListBuffer8(void* ptr, void* data, int count);
+void QPainter___drawLines_pointPairs_fillList8(void* ptr, void* data);
 void* QPainter___drawLines_pointPairs_atList4(void* ptr, int i);
 void QPainter___drawLines_pointPairs_setList4(void* ptr, void* i);
 void* QPainter___drawLines_pointPairs_newList4(void* ptr);
+void* QPainter___drawLines_pointPairs_newListBuffer4(void* ptr, void* data, int count);
+void QPainter___drawLines_pointPairs_fillList4(void* ptr, void* data);
 void* QPainter___drawRects_rectangles_atList4(void* ptr, int i);
 void QPainter___drawRects_rectangles_setList4(void* ptr, void* i);
 void* QPainter___drawRects_rectangles_newList4(void* ptr);
+void* QPainter___drawRects_rectangles_newListBuffer4(void* ptr, void* data, int count);
+void QPainter___drawRects_rectangles_fillList4(void* ptr, void* data);
 void* QPainter___drawRects_rectangles_atList2(void* ptr, int i);
 void QPainter___drawRects_rectangles_setList2(void* ptr, void* i);
 void* QPainter___drawRects_rectangles_newList2(void* ptr);
+void* QPainter___drawRects_rectangles_newListBuffer2(void* ptr, void* data, int count);
+void QPainter___drawRects_rectangles_fillList2(void* ptr, void* data);
 void* QPainterPath_NewQPainterPath3(void* path);
 void QPainterPath_AddEllipse(void* ptr, void* boundingRectangle);
 void QPainterPath_AddPath(void* ptr, void* path);
@@ -2322,9 +2352,13 @@ double QPainterPathStroker_Width(void* ptr);
 double QPainterPathStroker___setDashPattern_dashPattern_atList2(void* ptr, int i);
 void QPainterPathStroker___setDashPattern_dashPattern_setList2(void* ptr, double i);
 void* QPainterPathStroker___setDashPattern_dashPattern_newList2(void* ptr);
+void* QPainterPathStroker___setDashPattern_dashPattern_newListBuffer2(void* ptr, void* data, int count);
+void QPainterPathStroker___setDashPattern_dashPattern_fillList2(void* ptr, void* data);
 double QPainterPathStroker___dashPattern_atList(void* ptr, int i);
 void QPainterPathStroker___dashPattern_setList(void* ptr, double i);
 void* QPainterPathStroker___dashPattern_newList(void* ptr);
+void* QPainterPathStroker___dashPattern_newListBuffer(void* ptr, void* data, int count);
+void QPainterPathStroker___dashPattern_fillList(void* ptr, void* data);
 int QPalette_NColorRoles_Type();
 void* QPalette_NewQPalette();
 void* QPalette_NewQPalette8(void* other);
@@ -2448,9 +2482,13 @@ double QPen_WidthF(void* ptr);
 double QPen___setDashPattern_pattern_atList(void* ptr, int i);
 void QPen___setDashPattern_pattern_setList(void* ptr, double i);
 void* QPen___setDashPattern_pattern_newList(void* ptr);
+void* QPen___setDashPattern_pattern_newListBuffer(void* ptr, void* data, int count);
+void QPen___setDashPattern_pattern_fillList(void* ptr, void* data);
 double QPen___dashPattern_atList(void* ptr, int i);
 void QPen___dashPattern_setList(void* ptr, double i);
 void* QPen___dashPattern_newList(void* ptr);
+void* QPen___dashPattern_newListBuffer(void* ptr, void* data, int count);
+void QPen___dashPattern_fillList(void* ptr, void* data);
 void* QPicture_NewQPicture2(void* pic);
 void* QPicture_NewQPicture(int formatVersion);
 char QPicture_Load2(void* ptr, void* dev, char* format);
@@ -2584,9 +2622,13 @@ void QPolygon_Point(void* ptr, int index, int x, int y);
 void* QPolygon___QPolygon_v_atList4(void* ptr, int i);
 void QPolygon___QPolygon_v_setList4(void* ptr, void* i);
 void* QPolygon___QPolygon_v_newList4(void* ptr);
+void* QPolygon___QPolygon_v_newListBuffer4(void* ptr, void* data, int count);
+void QPolygon___QPolygon_v_fillList4(void* ptr, void* data);
 void* QPolygon___QPolygon_points_atList3(void* ptr, int i);
 void QPolygon___QPolygon_points_setList3(void* ptr, void* i);
 void* QPolygon___QPolygon_points_newList3(void* ptr);
+void* QPolygon___QPolygon_points_newListBuffer3(void* ptr, void* data, int count);
+void QPolygon___QPolygon_points_fillList3(void* ptr, void* data);
 void* QPolygon___QVector_other_atList5(void* ptr, int i);
 void QPolygon___QVector_other_setList5(void* ptr, void* i);
 void* QPolygon___QVector_other_newList5(void* ptr);
@@ -2641,9 +2683,13 @@ char QPolygonF_IsClosed(void* ptr);
 void* QPolygonF___QPolygonF_v_atList4(void* ptr, int i);
 void QPolygonF___QPolygonF_v_setList4(void* ptr, void* i);
 void* QPolygonF___QPolygonF_v_newList4(void* ptr);
+void* QPolygonF___QPolygonF_v_newListBuffer4(void* ptr, void* data, int count);
+void QPolygonF___QPolygonF_v_fillList4(void* ptr, void* data);
 void* QPolygonF___QPolygonF_points_atList3(void* ptr, int i);
 void QPolygonF___QPolygonF_points_setList3(void* ptr, void* i);
 void* QPolygonF___QPolygonF_points_newList3(void* ptr);
+void* QPolygonF___QPolygonF_points_newListBuffer3(void* ptr, void* data, int count);
+void QPolygonF___QPolygonF_points_fillList3(void* ptr, void* data);
 void* QPolygonF___QVector_other_atList5(void* ptr, int i);
 void QPolygonF___QVector_other_setList5(void* ptr, void* i);
 void* QPolygonF___QVector_other_newList5(void* ptr);
@@ -2780,12 +2826,16 @@ void* QRawFont___supportedWritingSystems_newList(void* ptr);
 void* QRawFont___advancesForGlyphIndexes_atList2(void* ptr, int i);
 void QRawFont___advancesForGlyphIndexes_setList2(void* ptr, void* i);
 void* QRawFont___advancesForGlyphIndexes_newList2(void* ptr);
+void* QRawFont___advancesForGlyphIndexes_newListBuffer2(void* ptr, void* data, int count);
+void QRawFont___advancesForGlyphIndexes_fillList2(void* ptr, void* data);
 unsigned int QRawFont___advancesForGlyphIndexes_glyphIndexes_atList2(void* ptr, int i);
 void QRawFont___advancesForGlyphIndexes_glyphIndexes_setList2(void* ptr, unsigned int i);
 void* QRawFont___advancesForGlyphIndexes_glyphIndexes_newList2(void* ptr);
 void* QRawFont___advancesForGlyphIndexes_atList(void* ptr, int i);
 void QRawFont___advancesForGlyphIndexes_setList(void* ptr, void* i);
 void* QRawFont___advancesForGlyphIndexes_newList(void* ptr);
+void* QRawFont___advancesForGlyphIndexes_newListBuffer(void* ptr, void* data, int count);
+void QRawFont___advancesForGlyphIndexes_fillList(void* ptr, void* data);
 unsigned int QRawFont___advancesForGlyphIndexes_glyphIndexes_atList(void* ptr, int i);
 void QRawFont___advancesForGlyphIndexes_glyphIndexes_setList(void* ptr, unsigned int i);
 void* QRawFont___advancesForGlyphIndexes_glyphIndexes_newList(void* ptr);
@@ -2830,6 +2880,8 @@ int QRegion_RectCount(void* ptr);
 void* QRegion___rects_atList(void* ptr, int i);
 void QRegion___rects_setList(void* ptr, void* i);
 void* QRegion___rects_newList(void* ptr);
+void* QRegion___rects_newListBuffer(void* ptr, void* data, int count);
+void QRegion___rects_fillList(void* ptr, void* data);
 void* QRegularExpressionValidator_NewQRegularExpressionValidator(void* parent);
 void* QRegularExpressionValidator_NewQRegularExpressionValidator2(void* re, void* parent);
 void QRegularExpressionValidator_ConnectRegularExpressionChanged(void* ptr);
@@ -3186,6 +3238,7 @@ void* QStandardItemModel_VerticalHeaderItem(void* ptr, int row);
 struct QtGui_PackedString QStandardItemModel_MimeTypesDefault(void* ptr);
 void* QStandardItemModel_Data(void* ptr, void* index, int role);
 void* QStandardItemModel_DataDefault(void* ptr, void* index, int role);
+void QStandardItemModel_DataDefaultInto(void* ptr, void* index, int role, void* ret);
 void* QStandardItemModel_HeaderDataDefault(void* ptr, int section, long long orientation, int role);
 long long QStandardItemModel_SupportedDropActionsDefault(void* ptr);
 long long QStandardItemModel_FlagsDefault(void* ptr, void* index);
@@ -3235,12 +3288,18 @@ void* QStandardItemModel___mimeData_indexes_newList(void* ptr);
 int QStandardItemModel_____setItemData_keyList_atList(void* ptr, int i);
 void QStandardItemModel_____setItemData_keyList_setList(void* ptr, int i);
 void* QStandardItemModel_____setItemData_keyList_newList(void* ptr);
+void* QStandardItemModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QStandardItemModel_____setItemData_keyList_fillList(void* ptr, void* data);
 int QStandardItemModel_____setItemRoleNames_keyList_atList(void* ptr, int i);
 void QStandardItemModel_____setItemRoleNames_keyList_setList(void* ptr, int i);
 void* QStandardItemModel_____setItemRoleNames_keyList_newList(void* ptr);
+void* QStandardItemModel_____setItemRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QStandardItemModel_____setItemRoleNames_keyList_fillList(void* ptr, void* data);
 int QStandardItemModel_____itemData_keyList_atList(void* ptr, int i);
 void QStandardItemModel_____itemData_keyList_setList(void* ptr, int i);
 void* QStandardItemModel_____itemData_keyList_newList(void* ptr);
+void* QStandardItemModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QStandardItemModel_____itemData_keyList_fillList(void* ptr, void* data);
 void* QStandardItemModel___changePersistentIndexList_from_atList(void* ptr, int i);
 void QStandardItemModel___changePersistentIndexList_from_setList(void* ptr, void* i);
 void* QStandardItemModel___changePersistentIndexList_from_newList(void* ptr);
@@ -3250,6 +3309,8 @@ void* QStandardItemModel___changePersistentIndexList_to_newList(void* ptr);
 int QStandardItemModel___dataChanged_roles_atList(void* ptr, int i);
 void QStandardItemModel___dataChanged_roles_setList(void* ptr, int i);
 void* QStandardItemModel___dataChanged_roles_newList(void* ptr);
+void* QStandardItemModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count);
+void QStandardItemModel___dataChanged_roles_fillList(void* ptr, void* data);
 void* QStandardItemModel___layoutAboutToBeChanged_parents_atList(void* ptr, int i);
 void QStandardItemModel___layoutAboutToBeChanged_parents_setList(void* ptr, void* i);
 void* QStandardItemModel___layoutAboutToBeChanged_parents_newList(void* ptr);
@@ -3269,12 +3330,18 @@ void* QStandardItemModel___persistentIndexList_newList(void* ptr);
 int QStandardItemModel_____doSetRoleNames_keyList_atList(void* ptr, int i);
 void QStandardItemModel_____doSetRoleNames_keyList_setList(void* ptr, int i);
 void* QStandardItemModel_____doSetRoleNames_keyList_newList(void* ptr);
+void* QStandardItemModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QStandardItemModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data);
 int QStandardItemModel_____setRoleNames_keyList_atList(void* ptr, int i);
 void QStandardItemModel_____setRoleNames_keyList_setList(void* ptr, int i);
 void* QStandardItemModel_____setRoleNames_keyList_newList(void* ptr);
+void* QStandardItemModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QStandardItemModel_____setRoleNames_keyList_fillList(void* ptr, void* data);
 int QStandardItemModel_____roleNames_keyList_atList(void* ptr, int i);
 void QStandardItemModel_____roleNames_keyList_setList(void* ptr, int i);
 void* QStandardItemModel_____roleNames_keyList_newList(void* ptr);
+void* QStandardItemModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QStandardItemModel_____roleNames_keyList_fillList(void* ptr, void* data);
 void* QStandardItemModel___dynamicPropertyNames_atList(void* ptr, int i);
 void QStandardItemModel___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QStandardItemModel___dynamicPropertyNames_newList(void* ptr);
@@ -3869,7 +3936,7 @@ void QTextDocumentFragment_DestroyQTextDocumentFragment(void* ptr);
 struct QtGui_PackedString QTextDocumentFragment_ToHtml(void* ptr, void* encoding);
 struct QtGui_PackedString QTextDocumentFragment_ToPlainText(void* ptr);
 char QTextDocumentFragment_IsEmpty(void* ptr);
-struct QtGui_PackedList QTextDocumentWriter_QTextDocumentWriter_SupportedDocumentFormats();
+struct QtGui_PackedString QTextDocumentWriter_QTextDocumentWriter_SupportedDocumentFormats();
 void* QTextDocumentWriter_NewQTextDocumentWriter();
 void* QTextDocumentWriter_NewQTextDocumentWriter2(void* device, void* format);
 void* QTextDocumentWriter_NewQTextDocumentWriter3(char* fileName, void* format);
@@ -3950,6 +4017,8 @@ void* QTextFormat___lengthVectorProperty_newList(void* ptr);
 int QTextFormat_____properties_keyList_atList(void* ptr, int i);
 void QTextFormat_____properties_keyList_setList(void* ptr, int i);
 void* QTextFormat_____properties_keyList_newList(void* ptr);
+void* QTextFormat_____properties_keyList_newListBuffer(void* ptr, void* data, int count);
+void QTextFormat_____properties_keyList_fillList(void* ptr, void* data);
 void* QTextFragment_NewQTextFragment();
 void* QTextFragment_NewQTextFragment3(void* other);
 struct QtGui_PackedList QTextFragment_GlyphRuns(void* ptr, int pos, int len);
@@ -4181,9 +4250,13 @@ double QTextOption_TabStop(void* ptr);
 double QTextOption___setTabArray_tabStops_atList(void* ptr, int i);
 void QTextOption___setTabArray_tabStops_setList(void* ptr, double i);
 void* QTextOption___setTabArray_tabStops_newList(void* ptr);
+void* QTextOption___setTabArray_tabStops_newListBuffer(void* ptr, void* data, int count);
+void QTextOption___setTabArray_tabStops_fillList(void* ptr, void* data);
 double QTextOption___tabArray_atList(void* ptr, int i);
 void QTextOption___tabArray_setList(void* ptr, double i);
 void* QTextOption___tabArray_newList(void* ptr);
+void* QTextOption___tabArray_newListBuffer(void* ptr, void* data, int count);
+void QTextOption___tabArray_fillList(void* ptr, void* data);
 void QTextTable_AppendColumns(void* ptr, int count);
 void QTextTable_AppendRows(void* ptr, int count);
 void QTextTable_InsertColumns(void* ptr, int index, int columns);
@@ -0,0 +1,41 @@
+package gui
+
+//#include <stdint.h>
+//#include <stdlib.h>
+//#include "utils-gui.h"
+import "C"
+import (
+	"github.com/therecipe/qt"
+	"unsafe"
+)
+
+//BitsView returns the pixel data of the image without copying it.
+//The slice aliases the image memory, so it is only valid until the image is destroyed or detached.
+func (ptr *QImage) BitsView() []byte {
+	if ptr.Pointer() != nil {
+		var b = C.QImage_BitsBuffer(ptr.Pointer())
+		return qt.UnsafeBytes(b.data, int(b.len))
+	}
+	return nil
+}
+
+//ScanLineView returns the i-th scan line of the image without copying it, see BitsView.
+//It returns nil if the image has no such line.
+func (ptr *QImage) ScanLineView(i int) []byte {
+	if ptr.Pointer() != nil {
+		var b = C.QImage_ScanLineBuffer(ptr.Pointer(), C.int(int32(i)))
+		return qt.UnsafeBytes(b.data, int(b.len))
+	}
+	return nil
+}
+
+//NewQImageFromBuffer wraps data without copying it.
+//Because C++ keeps using the memory after the call returns, data must not be allocated by the Go runtime,
+//use the BitsView of another image or memory from C.malloc or syscall.Mmap instead.
+//The buffer has to outlive the image and its shallow copies.
+func NewQImageFromBuffer(data []byte, width int, height int, bytesPerLine int, format QImage__Format) *QImage {
+	if len(data) == 0 || len(data) < bytesPerLine*height {
+		return nil
+	}
+	return NewQImageFromPointer(C.QImage_NewQImageFromBuffer(unsafe.Pointer(&data[0]), C.int(int32(width)), C.int(int32(height)), C.int(int32(bytesPerLine)), C.longlong(format)))
+}
@@ -75,6 +75,75 @@
 #include <QVector>
 #include <QWheelEvent>
 #include <QWidget>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 void QHelpContentItem_DestroyQHelpContentItem(void* ptr)
 {
@@ -123,7 +192,7 @@ public:
 	void Signal_ContentsCreationStarted() { callbackQHelpContentModel_ContentsCreationStarted(this); };
 	QModelIndex index(int row, int column, const QModelIndex & parent) const { return *static_cast<QModelIndex*>(callbackQHelpContentModel_Index(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&parent))); };
 	QModelIndex parent(const QModelIndex & index) const { return *static_cast<QModelIndex*>(callbackQHelpContentModel_Parent(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
-	QVariant data(const QModelIndex & index, int role) const { return *static_cast<QVariant*>(callbackQHelpContentModel_Data(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), role)); };
+	QVariant data(const QModelIndex & index, int role) const { QVariant ret; callbackQHelpContentModel_Data(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), role, &ret); return ret; };
 	int columnCount(const QModelIndex & parent) const { return callbackQHelpContentModel_ColumnCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
 	int rowCount(const QModelIndex & parent) const { return callbackQHelpContentModel_RowCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
 	bool dropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) { return callbackQHelpContentModel_DropMimeData(this, const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
@@ -166,7 +235,7 @@ public:
 	QModelIndex sibling(int row, int column, const QModelIndex & index) const { return *static_cast<QModelIndex*>(callbackQHelpContentModel_Sibling(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&index))); };
 	QList<QModelIndex> match(const QModelIndex & start, int role, const QVariant & value, int hits, Qt::MatchFlags flags) const { return *static_cast<QList<QModelIndex>*>(callbackQHelpContentModel_Match(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&start), role, const_cast<QVariant*>(&value), hits, flags)); };
 	QSize span(const QModelIndex & index) const { return *static_cast<QSize*>(callbackQHelpContentModel_Span(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
-	QStringList mimeTypes() const { return QString(callbackQHelpContentModel_MimeTypes(const_cast<void*>(static_cast<const void*>(this)))).split("|", QString::SkipEmptyParts); };
+	QStringList mimeTypes() const { char* tmp = callbackQHelpContentModel_MimeTypes(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
 	QVariant headerData(int section, Qt::Orientation orientation, int role) const { return *static_cast<QVariant*>(callbackQHelpContentModel_HeaderData(const_cast<void*>(static_cast<const void*>(this)), section, orientation, role)); };
 	Qt::DropActions supportedDragActions() const { return static_cast<Qt::DropAction>(callbackQHelpContentModel_SupportedDragActions(const_cast<void*>(static_cast<const void*>(this)))); };
 	Qt::DropActions supportedDropActions() const { return static_cast<Qt::DropAction>(callbackQHelpContentModel_SupportedDropActions(const_cast<void*>(static_cast<const void*>(this)))); };
@@ -262,6 +331,11 @@ void* QHelpContentModel_DataDefault(void* ptr, void* index, int role)
 		return new QVariant(static_cast<QHelpContentModel*>(ptr)->QHelpContentModel::data(*static_cast<QModelIndex*>(index), role));
 }
 
+void QHelpContentModel_DataDefaultInto(void* ptr, void* index, int role, void* ret)
+{
+		*static_cast<QVariant*>(ret) = QVariant(static_cast<QHelpContentModel*>(ptr)->QHelpContentModel::data(*static_cast<QModelIndex*>(index), role));
+}
+
 char QHelpContentModel_IsCreatingContents(void* ptr)
 {
 	return static_cast<QHelpContentModel*>(ptr)->isCreatingContents();
@@ -352,6 +426,16 @@ void* QHelpContentModel___dataChanged_roles_newList(void* ptr)
 	return new QVector<int>;
 }
 
+void* QHelpContentModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpContentModel___dataChanged_roles_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
 void* QHelpContentModel___layoutAboutToBeChanged_parents_atList(void* ptr, int i)
 {
 	return new QPersistentModelIndex(static_cast<QList<QPersistentModelIndex>*>(ptr)->at(i));
@@ -482,6 +566,16 @@ void* QHelpContentModel_____setItemData_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpContentModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpContentModel_____setItemData_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 int QHelpContentModel_____doSetRoleNames_keyList_atList(void* ptr, int i)
 {
 	return static_cast<QList<int>*>(ptr)->at(i);
@@ -497,6 +591,16 @@ void* QHelpContentModel_____doSetRoleNames_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpContentModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpContentModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 int QHelpContentModel_____setRoleNames_keyList_atList(void* ptr, int i)
 {
 	return static_cast<QList<int>*>(ptr)->at(i);
@@ -512,6 +616,16 @@ void* QHelpContentModel_____setRoleNames_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpContentModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpContentModel_____setRoleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 int QHelpContentModel_____roleNames_keyList_atList(void* ptr, int i)
 {
 	return static_cast<QList<int>*>(ptr)->at(i);
@@ -527,6 +641,16 @@ void* QHelpContentModel_____roleNames_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpContentModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpContentModel_____roleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 int QHelpContentModel_____itemData_keyList_atList(void* ptr, int i)
 {
 	return static_cast<QList<int>*>(ptr)->at(i);
@@ -542,6 +666,16 @@ void* QHelpContentModel_____itemData_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpContentModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpContentModel_____itemData_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 void* QHelpContentModel___dynamicPropertyNames_atList(void* ptr, int i)
 {
 	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
@@ -729,7 +863,7 @@ void* QHelpContentModel_SpanDefault(void* ptr, void* index)
 
 struct QtHelp_PackedString QHelpContentModel_MimeTypesDefault(void* ptr)
 {
-		return ({ QByteArray tf8824d = static_cast<QHelpContentModel*>(ptr)->QHelpContentModel::mimeTypes().join("|").toUtf8(); QtHelp_PackedString { const_cast<char*>(tf8824d.prepend("WHITESPACE").constData()+10), tf8824d.size()-10 }; });
+		return ({ long long tf8824dlen; char* tf8824d = goPackStringList(static_cast<QHelpContentModel*>(ptr)->QHelpContentModel::mimeTypes(), &tf8824dlen); QtHelp_PackedString { tf8824d, tf8824dlen }; });
 }
 
 void* QHelpContentModel_HeaderDataDefault(void* ptr, int section, long long orientation, int role)
@@ -985,6 +1119,16 @@ void* QHelpContentWidget___dataChanged_roles_newList(void* ptr)
 	return new QVector<int>;
 }
 
+void* QHelpContentWidget___dataChanged_roles_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpContentWidget___dataChanged_roles_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
 void* QHelpContentWidget___selectedIndexes_atList(void* ptr, int i)
 {
 	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
@@ -1809,7 +1953,7 @@ void* QHelpEngineCore_NewQHelpEngineCore(char* collectionFile, void* parent)
 
 struct QtHelp_PackedList QHelpEngineCore_Files(void* ptr, char* namespaceName, char* filterAttributes, char* extensionFilter)
 {
-	return ({ QList<QUrl>* tmpValue = new QList<QUrl>(static_cast<QHelpEngineCore*>(ptr)->files(QString(namespaceName), QString(filterAttributes).split("|", QString::SkipEmptyParts), QString(extensionFilter))); QtHelp_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ QList<QUrl>* tmpValue = new QList<QUrl>(static_cast<QHelpEngineCore*>(ptr)->files(QString(namespaceName), goUnpackStringList(filterAttributes), QString(extensionFilter))); QtHelp_PackedList { tmpValue, tmpValue->size() }; });
 }
 
 struct QtHelp_PackedString QHelpEngineCore_DocumentationFileName(void* ptr, char* namespaceName)
@@ -1829,7 +1973,7 @@ void* QHelpEngineCore_QHelpEngineCore_MetaData(char* documentationFileName, char
 
 char QHelpEngineCore_AddCustomFilter(void* ptr, char* filterName, char* attributes)
 {
-	return static_cast<QHelpEngineCore*>(ptr)->addCustomFilter(QString(filterName), QString(attributes).split("|", QString::SkipEmptyParts));
+	return static_cast<QHelpEngineCore*>(ptr)->addCustomFilter(QString(filterName), goUnpackStringList(attributes));
 }
 
 char QHelpEngineCore_CopyCollectionFile(void* ptr, char* fileName)
@@ -1994,22 +2138,22 @@ struct QtHelp_PackedString QHelpEngineCore_Error(void* ptr)
 
 struct QtHelp_PackedString QHelpEngineCore_CustomFilters(void* ptr)
 {
-	return ({ QByteArray t2b7197 = static_cast<QHelpEngineCore*>(ptr)->customFilters().join("|").toUtf8(); QtHelp_PackedString { const_cast<char*>(t2b7197.prepend("WHITESPACE").constData()+10), t2b7197.size()-10 }; });
+	return ({ long long t2b7197len; char* t2b7197 = goPackStringList(static_cast<QHelpEngineCore*>(ptr)->customFilters(), &t2b7197len); QtHelp_PackedString { t2b7197, t2b7197len }; });
 }
 
 struct QtHelp_PackedString QHelpEngineCore_FilterAttributes(void* ptr)
 {
-	return ({ QByteArray t22f9b0 = static_cast<QHelpEngineCore*>(ptr)->filterAttributes().join("|").toUtf8(); QtHelp_PackedString { const_cast<char*>(t22f9b0.prepend("WHITESPACE").constData()+10), t22f9b0.size()-10 }; });
+	return ({ long long t22f9b0len; char* t22f9b0 = goPackStringList(static_cast<QHelpEngineCore*>(ptr)->filterAttributes(), &t22f9b0len); QtHelp_PackedString { t22f9b0, t22f9b0len }; });
 }
 
 struct QtHelp_PackedString QHelpEngineCore_FilterAttributes2(void* ptr, char* filterName)
 {
-	return ({ QByteArray t1b0981 = static_cast<QHelpEngineCore*>(ptr)->filterAttributes(QString(filterName)).join("|").toUtf8(); QtHelp_PackedString { const_cast<char*>(t1b0981.prepend("WHITESPACE").constData()+10), t1b0981.size()-10 }; });
+	return ({ long long t1b0981len; char* t1b0981 = goPackStringList(static_cast<QHelpEngineCore*>(ptr)->filterAttributes(QString(filterName)), &t1b0981len); QtHelp_PackedString { t1b0981, t1b0981len }; });
 }
 
 struct QtHelp_PackedString QHelpEngineCore_RegisteredDocumentations(void* ptr)
 {
-	return ({ QByteArray t7c5252 = static_cast<QHelpEngineCore*>(ptr)->registeredDocumentations().join("|").toUtf8(); QtHelp_PackedString { const_cast<char*>(t7c5252.prepend("WHITESPACE").constData()+10), t7c5252.size()-10 }; });
+	return ({ long long t7c5252len; char* t7c5252 = goPackStringList(static_cast<QHelpEngineCore*>(ptr)->registeredDocumentations(), &t7c5252len); QtHelp_PackedString { t7c5252, t7c5252len }; });
 }
 
 void* QHelpEngineCore_FindFile(void* ptr, void* url)
@@ -2044,12 +2188,12 @@ void* QHelpEngineCore___files_newList(void* ptr)
 
 struct QtHelp_PackedString QHelpEngineCore___filterAttributeSets_atList(void* ptr, int i)
 {
-	return ({ QByteArray t5372d5 = static_cast<QList<QStringList>*>(ptr)->at(i).join("|").toUtf8(); QtHelp_PackedString { const_cast<char*>(t5372d5.prepend("WHITESPACE").constData()+10), t5372d5.size()-10 }; });
+	return ({ long long t5372d5len; char* t5372d5 = goPackStringList(static_cast<QList<QStringList>*>(ptr)->at(i), &t5372d5len); QtHelp_PackedString { t5372d5, t5372d5len }; });
 }
 
 void QHelpEngineCore___filterAttributeSets_setList(void* ptr, char* i)
 {
-	static_cast<QList<QStringList>*>(ptr)->append(QString(i).split("|", QString::SkipEmptyParts));
+	static_cast<QList<QStringList>*>(ptr)->append(goUnpackStringList(i));
 }
 
 void* QHelpEngineCore___filterAttributeSets_newList(void* ptr)
@@ -2258,7 +2402,7 @@ public:
 	bool setData(const QModelIndex & index, const QVariant & value, int role) { return callbackQHelpIndexModel_SetData(this, const_cast<QModelIndex*>(&index), const_cast<QVariant*>(&value), role) != 0; };
 	void sort(int column, Qt::SortOrder order) { callbackQHelpIndexModel_Sort(this, column, order); };
 	QModelIndex sibling(int row, int column, const QModelIndex & idx) const { return *static_cast<QModelIndex*>(callbackQHelpIndexModel_Sibling(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&idx))); };
-	QVariant data(const QModelIndex & index, int role) const { return *static_cast<QVariant*>(callbackQHelpIndexModel_Data(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), role)); };
+	QVariant data(const QModelIndex & index, int role) const { QVariant ret; callbackQHelpIndexModel_Data(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), role, &ret); return ret; };
 	Qt::DropActions supportedDropActions() const { return static_cast<Qt::DropAction>(callbackQHelpIndexModel_SupportedDropActions(const_cast<void*>(static_cast<const void*>(this)))); };
 	Qt::ItemFlags flags(const QModelIndex & index) const { return static_cast<Qt::ItemFlag>(callbackQHelpIndexModel_Flags(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
 	int rowCount(const QModelIndex & parent) const { return callbackQHelpIndexModel_RowCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
@@ -2299,7 +2443,7 @@ public:
 	QModelIndex parent(const QModelIndex & index) const { return *static_cast<QModelIndex*>(callbackQHelpIndexModel_Parent(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
 	QList<QModelIndex> match(const QModelIndex & start, int role, const QVariant & value, int hits, Qt::MatchFlags flags) const { return *static_cast<QList<QModelIndex>*>(callbackQHelpIndexModel_Match(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&start), role, const_cast<QVariant*>(&value), hits, flags)); };
 	QSize span(const QModelIndex & index) const { return *static_cast<QSize*>(callbackQHelpIndexModel_Span(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
-	QStringList mimeTypes() const { return QString(callbackQHelpIndexModel_MimeTypes(const_cast<void*>(static_cast<const void*>(this)))).split("|", QString::SkipEmptyParts); };
+	QStringList mimeTypes() const { char* tmp = callbackQHelpIndexModel_MimeTypes(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
 	QVariant headerData(int section, Qt::Orientation orientation, int role) const { return *static_cast<QVariant*>(callbackQHelpIndexModel_HeaderData(const_cast<void*>(static_cast<const void*>(this)), section, orientation, role)); };
 	Qt::DropActions supportedDragActions() const { return static_cast<Qt::DropAction>(callbackQHelpIndexModel_SupportedDragActions(const_cast<void*>(static_cast<const void*>(this)))); };
 	bool canDropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) const { return callbackQHelpIndexModel_CanDropMimeData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
@@ -2419,6 +2563,16 @@ void* QHelpIndexModel_____setItemData_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpIndexModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpIndexModel_____setItemData_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 int QHelpIndexModel_____roleNames_keyList_atList(void* ptr, int i)
 {
 	return static_cast<QList<int>*>(ptr)->at(i);
@@ -2434,6 +2588,16 @@ void* QHelpIndexModel_____roleNames_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpIndexModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpIndexModel_____roleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 int QHelpIndexModel_____itemData_keyList_atList(void* ptr, int i)
 {
 	return static_cast<QList<int>*>(ptr)->at(i);
@@ -2449,6 +2613,16 @@ void* QHelpIndexModel_____itemData_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpIndexModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpIndexModel_____itemData_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 void* QHelpIndexModel___setItemData_roles_atList(void* ptr, int i)
 {
 	return new QVariant(static_cast<QMap<int, QVariant>*>(ptr)->value(i));
@@ -2514,6 +2688,16 @@ void* QHelpIndexModel___dataChanged_roles_newList(void* ptr)
 	return new QVector<int>;
 }
 
+void* QHelpIndexModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpIndexModel___dataChanged_roles_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
 void* QHelpIndexModel___layoutAboutToBeChanged_parents_atList(void* ptr, int i)
 {
 	return new QPersistentModelIndex(static_cast<QList<QPersistentModelIndex>*>(ptr)->at(i));
@@ -2644,6 +2828,16 @@ void* QHelpIndexModel_____doSetRoleNames_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpIndexModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpIndexModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 int QHelpIndexModel_____setRoleNames_keyList_atList(void* ptr, int i)
 {
 	return static_cast<QList<int>*>(ptr)->at(i);
@@ -2659,6 +2853,16 @@ void* QHelpIndexModel_____setRoleNames_keyList_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QHelpIndexModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpIndexModel_____setRoleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 void* QHelpIndexModel___dynamicPropertyNames_atList(void* ptr, int i)
 {
 	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
@@ -2764,6 +2968,11 @@ void* QHelpIndexModel_DataDefault(void* ptr, void* index, int role)
 		return new QVariant(static_cast<QHelpIndexModel*>(ptr)->QHelpIndexModel::data(*static_cast<QModelIndex*>(index), role));
 }
 
+void QHelpIndexModel_DataDefaultInto(void* ptr, void* index, int role, void* ret)
+{
+		*static_cast<QVariant*>(ret) = QVariant(static_cast<QHelpIndexModel*>(ptr)->QHelpIndexModel::data(*static_cast<QModelIndex*>(index), role));
+}
+
 long long QHelpIndexModel_SupportedDropActionsDefault(void* ptr)
 {
 		return static_cast<QHelpIndexModel*>(ptr)->QHelpIndexModel::supportedDropActions();
@@ -2876,7 +3085,7 @@ void* QHelpIndexModel_SpanDefault(void* ptr, void* index)
 
 struct QtHelp_PackedString QHelpIndexModel_MimeTypesDefault(void* ptr)
 {
-		return ({ QByteArray t6c8862 = static_cast<QHelpIndexModel*>(ptr)->QHelpIndexModel::mimeTypes().join("|").toUtf8(); QtHelp_PackedString { const_cast<char*>(t6c8862.prepend("WHITESPACE").constData()+10), t6c8862.size()-10 }; });
+		return ({ long long t6c8862len; char* t6c8862 = goPackStringList(static_cast<QHelpIndexModel*>(ptr)->QHelpIndexModel::mimeTypes(), &t6c8862len); QtHelp_PackedString { t6c8862, t6c8862len }; });
 }
 
 void* QHelpIndexModel_HeaderDataDefault(void* ptr, int section, long long orientation, int role)
@@ -3179,6 +3388,16 @@ void* QHelpIndexWidget___dataChanged_roles_newList(void* ptr)
 	return new QVector<int>;
 }
 
+void* QHelpIndexWidget___dataChanged_roles_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QHelpIndexWidget___dataChanged_roles_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
 void* QHelpIndexWidget___indexesMoved_indexes_atList(void* ptr, int i)
 {
 	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
@@ -4171,7 +4390,7 @@ void* QHelpSearchQuery_NewQHelpSearchQuery()
 
 void* QHelpSearchQuery_NewQHelpSearchQuery2(long long field, char* wordList)
 {
-	return new QHelpSearchQuery(static_cast<QHelpSearchQuery::FieldName>(field), QString(wordList).split("|", QString::SkipEmptyParts));
+	return new QHelpSearchQuery(static_cast<QHelpSearchQuery::FieldName>(field), goUnpackStringList(wordList));
 }
 
 long long QHelpSearchQuery_FieldName(void* ptr)
@@ -4186,12 +4405,12 @@ void QHelpSearchQuery_SetFieldName(void* ptr, long long vfi)
 
 struct QtHelp_PackedString QHelpSearchQuery_WordList(void* ptr)
 {
-	return ({ QByteArray t152f34 = static_cast<QHelpSearchQuery*>(ptr)->wordList.join("|").toUtf8(); QtHelp_PackedString { const_cast<char*>(t152f34.prepend("WHITESPACE").constData()+10), t152f34.size()-10 }; });
+	return ({ long long t152f34len; char* t152f34 = goPackStringList(static_cast<QHelpSearchQuery*>(ptr)->wordList, &t152f34len); QtHelp_PackedString { t152f34, t152f34len }; });
 }
 
 void QHelpSearchQuery_SetWordList(void* ptr, char* vqs)
 {
-	static_cast<QHelpSearchQuery*>(ptr)->wordList = QString(vqs).split("|", QString::SkipEmptyParts);
+	static_cast<QHelpSearchQuery*>(ptr)->wordList = goUnpackStringList(vqs);
 }
 
 class MyQHelpSearchQueryWidget: public QHelpSearchQueryWidget
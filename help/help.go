@@ -8,13 +8,11 @@ package help
 //#include "help.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"github.com/therecipe/qt/gui"
 	"github.com/therecipe/qt/widgets"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -24,6 +22,43 @@ func cGoUnpackString(s C.struct_QtHelp_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtHelp_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtHelp_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QHelpContentItem struct {
 	ptr unsafe.Pointer
@@ -161,7 +196,7 @@ func NewQHelpContentModelFromPointer(ptr unsafe.Pointer) *QHelpContentModel {
 
 //export callbackQHelpContentModel_ContentsCreated
 func callbackQHelpContentModel_ContentsCreated(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentsCreated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentsCreated"); signal != nil {
 		signal.(func())()
 	}
 
@@ -170,14 +205,14 @@ func callbackQHelpContentModel_ContentsCreated(ptr unsafe.Pointer) {
 func (ptr *QHelpContentModel) ConnectContentsCreated(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpContentModel_ConnectContentsCreated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contentsCreated", f)
+		qt.ConnectSignal(ptr.Pointer(), "contentsCreated", f)
 	}
 }
 
 func (ptr *QHelpContentModel) DisconnectContentsCreated() {
 	if ptr.Pointer() != nil {
 		C.QHelpContentModel_DisconnectContentsCreated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contentsCreated")
+		qt.DisconnectSignal(ptr.Pointer(), "contentsCreated")
 	}
 }
 
@@ -189,7 +224,7 @@ func (ptr *QHelpContentModel) ContentsCreated() {
 
 //export callbackQHelpContentModel_ContentsCreationStarted
 func callbackQHelpContentModel_ContentsCreationStarted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentsCreationStarted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentsCreationStarted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -198,14 +233,14 @@ func callbackQHelpContentModel_ContentsCreationStarted(ptr unsafe.Pointer) {
 func (ptr *QHelpContentModel) ConnectContentsCreationStarted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpContentModel_ConnectContentsCreationStarted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contentsCreationStarted", f)
+		qt.ConnectSignal(ptr.Pointer(), "contentsCreationStarted", f)
 	}
 }
 
 func (ptr *QHelpContentModel) DisconnectContentsCreationStarted() {
 	if ptr.Pointer() != nil {
 		C.QHelpContentModel_DisconnectContentsCreationStarted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contentsCreationStarted")
+		qt.DisconnectSignal(ptr.Pointer(), "contentsCreationStarted")
 	}
 }
 
@@ -226,7 +261,7 @@ func (ptr *QHelpContentModel) CreateContents(customFilterName string) {
 func (ptr *QHelpContentModel) DestroyQHelpContentModel() {
 	if ptr.Pointer() != nil {
 		C.QHelpContentModel_DestroyQHelpContentModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -240,7 +275,7 @@ func (ptr *QHelpContentModel) ContentItemAt(index core.QModelIndex_ITF) *QHelpCo
 
 //export callbackQHelpContentModel_Index
 func callbackQHelpContentModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(int, int, *core.QModelIndex) *core.QModelIndex)(int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))
 	}
 
@@ -250,14 +285,14 @@ func callbackQHelpContentModel_Index(ptr unsafe.Pointer, row C.int, column C.int
 func (ptr *QHelpContentModel) ConnectIndex(f func(row int, column int, parent *core.QModelIndex) *core.QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "index", f)
+		qt.ConnectSignal(ptr.Pointer(), "index", f)
 	}
 }
 
 func (ptr *QHelpContentModel) DisconnectIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "index")
+		qt.DisconnectSignal(ptr.Pointer(), "index")
 	}
 }
 
@@ -281,7 +316,7 @@ func (ptr *QHelpContentModel) IndexDefault(row int, column int, parent core.QMod
 
 //export callbackQHelpContentModel_Parent
 func callbackQHelpContentModel_Parent(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QModelIndex) *core.QModelIndex)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -291,14 +326,14 @@ func callbackQHelpContentModel_Parent(ptr unsafe.Pointer, index unsafe.Pointer)
 func (ptr *QHelpContentModel) ConnectParent(f func(index *core.QModelIndex) *core.QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parent", f)
+		qt.ConnectSignal(ptr.Pointer(), "parent", f)
 	}
 }
 
 func (ptr *QHelpContentModel) DisconnectParent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parent")
+		qt.DisconnectSignal(ptr.Pointer(), "parent")
 	}
 }
 
@@ -321,25 +356,31 @@ func (ptr *QHelpContentModel) ParentDefault(index core.QModelIndex_ITF) *core.QM
 }
 
 //export callbackQHelpContentModel_Data
-func callbackQHelpContentModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
-		return core.PointerFromQVariant(signal.(func(*core.QModelIndex, int) *core.QVariant)(core.NewQModelIndexFromPointer(index), int(int32(role))))
+func callbackQHelpContentModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int, ret unsafe.Pointer) {
+	if signal := qt.GetSignal(ptr, "dataInto"); signal != nil {
+		signal.(func(*core.QModelIndex, int, *core.QVariant))(core.NewQModelIndexFromPointer(index), int(int32(role)), core.NewQVariantFromPointer(ret))
+		return
+	}
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
+		var tmpValue = signal.(func(*core.QModelIndex, int) *core.QVariant)(core.NewQModelIndexFromPointer(index), int(int32(role)))
+		core.NewQVariantFromPointer(ret).Assign(tmpValue)
+		return
 	}
 
-	return core.PointerFromQVariant(NewQHelpContentModelFromPointer(ptr).DataDefault(core.NewQModelIndexFromPointer(index), int(int32(role))))
+	C.QHelpContentModel_DataDefaultInto(ptr, index, role, ret)
 }
 
 func (ptr *QHelpContentModel) ConnectData(f func(index *core.QModelIndex, role int) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QHelpContentModel) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
@@ -370,7 +411,7 @@ func (ptr *QHelpContentModel) IsCreatingContents() bool {
 
 //export callbackQHelpContentModel_ColumnCount
 func callbackQHelpContentModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*core.QModelIndex) int)(core.NewQModelIndexFromPointer(parent))))
 	}
 
@@ -380,14 +421,14 @@ func callbackQHelpContentModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Poi
 func (ptr *QHelpContentModel) ConnectColumnCount(f func(parent *core.QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCount", f)
 	}
 }
 
 func (ptr *QHelpContentModel) DisconnectColumnCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCount")
 	}
 }
 
@@ -407,7 +448,7 @@ func (ptr *QHelpContentModel) ColumnCountDefault(parent core.QModelIndex_ITF) in
 
 //export callbackQHelpContentModel_RowCount
 func callbackQHelpContentModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*core.QModelIndex) int)(core.NewQModelIndexFromPointer(parent))))
 	}
 
@@ -417,14 +458,14 @@ func callbackQHelpContentModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointe
 func (ptr *QHelpContentModel) ConnectRowCount(f func(parent *core.QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCount", f)
 	}
 }
 
 func (ptr *QHelpContentModel) DisconnectRowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCount")
 	}
 }
 
@@ -465,8 +506,10 @@ func (ptr *QHelpContentModel) __setItemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpContentModelFromPointer(l.data).____setItemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpContentModelFromPointer(l.data).____setItemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QHelpContentModel___setItemData_keyList(ptr.Pointer()))
@@ -529,6 +572,16 @@ func (ptr *QHelpContentModel) __dataChanged_roles_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpContentModel___dataChanged_roles_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpContentModel) __dataChanged_roles_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpContentModel___dataChanged_roles_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpContentModel) __dataChanged_roles_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpContentModel___dataChanged_roles_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpContentModel) __layoutAboutToBeChanged_parents_atList(i int) *core.QPersistentModelIndex {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPersistentModelIndexFromPointer(C.QHelpContentModel___layoutAboutToBeChanged_parents_atList(ptr.Pointer(), C.int(int32(i))))
@@ -590,8 +643,10 @@ func (ptr *QHelpContentModel) __roleNames_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpContentModelFromPointer(l.data).____roleNames_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpContentModelFromPointer(l.data).____roleNames_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QHelpContentModel___roleNames_keyList(ptr.Pointer()))
@@ -622,8 +677,10 @@ func (ptr *QHelpContentModel) __itemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpContentModelFromPointer(l.data).____itemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpContentModelFromPointer(l.data).____itemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QHelpContentModel___itemData_keyList(ptr.Pointer()))
@@ -705,6 +762,16 @@ func (ptr *QHelpContentModel) ____setItemData_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpContentModel_____setItemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpContentModel) ____setItemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpContentModel_____setItemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpContentModel) ____setItemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpContentModel_____setItemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpContentModel) ____doSetRoleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QHelpContentModel_____doSetRoleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -722,6 +789,16 @@ func (ptr *QHelpContentModel) ____doSetRoleNames_keyList_newList() unsafe.Pointe
 	return unsafe.Pointer(C.QHelpContentModel_____doSetRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpContentModel) ____doSetRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpContentModel_____doSetRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpContentModel) ____doSetRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpContentModel_____doSetRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpContentModel) ____setRoleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QHelpContentModel_____setRoleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -739,6 +816,16 @@ func (ptr *QHelpContentModel) ____setRoleNames_keyList_newList() unsafe.Pointer
 	return unsafe.Pointer(C.QHelpContentModel_____setRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpContentModel) ____setRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpContentModel_____setRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpContentModel) ____setRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpContentModel_____setRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpContentModel) ____roleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QHelpContentModel_____roleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -756,6 +843,16 @@ func (ptr *QHelpContentModel) ____roleNames_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpContentModel_____roleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpContentModel) ____roleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpContentModel_____roleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpContentModel) ____roleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpContentModel_____roleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpContentModel) ____itemData_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QHelpContentModel_____itemData_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -773,6 +870,16 @@ func (ptr *QHelpContentModel) ____itemData_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpContentModel_____itemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpContentModel) ____itemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpContentModel_____itemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpContentModel) ____itemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpContentModel_____itemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpContentModel) __dynamicPropertyNames_atList(i int) *core.QByteArray {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQByteArrayFromPointer(C.QHelpContentModel___dynamicPropertyNames_atList(ptr.Pointer(), C.int(int32(i))))
@@ -795,7 +902,7 @@ func (ptr *QHelpContentModel) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QHelpContentModel) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpContentModel___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -816,7 +923,7 @@ func (ptr *QHelpContentModel) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QHelpContentModel) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpContentModel___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -837,7 +944,7 @@ func (ptr *QHelpContentModel) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QHelpContentModel) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpContentModel___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -858,7 +965,7 @@ func (ptr *QHelpContentModel) __findChildren_newList() unsafe.Pointer {
 func (ptr *QHelpContentModel) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpContentModel___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -878,7 +985,7 @@ func (ptr *QHelpContentModel) __children_newList() unsafe.Pointer {
 
 //export callbackQHelpContentModel_DropMimeData
 func callbackQHelpContentModel_DropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QMimeData, core.Qt__DropAction, int, int, *core.QModelIndex) bool)(core.NewQMimeDataFromPointer(data), core.Qt__DropAction(action), int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -894,7 +1001,7 @@ func (ptr *QHelpContentModel) DropMimeDataDefault(data core.QMimeData_ITF, actio
 
 //export callbackQHelpContentModel_InsertColumns
 func callbackQHelpContentModel_InsertColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(column)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -910,7 +1017,7 @@ func (ptr *QHelpContentModel) InsertColumnsDefault(column int, count int, parent
 
 //export callbackQHelpContentModel_InsertRows
 func callbackQHelpContentModel_InsertRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(row)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -926,7 +1033,7 @@ func (ptr *QHelpContentModel) InsertRowsDefault(row int, count int, parent core.
 
 //export callbackQHelpContentModel_MoveColumns
 func callbackQHelpContentModel_MoveColumns(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceColumn C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int) bool)(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceColumn)), int(int32(count)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -942,7 +1049,7 @@ func (ptr *QHelpContentModel) MoveColumnsDefault(sourceParent core.QModelIndex_I
 
 //export callbackQHelpContentModel_MoveRows
 func callbackQHelpContentModel_MoveRows(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceRow C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int) bool)(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceRow)), int(int32(count)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -958,7 +1065,7 @@ func (ptr *QHelpContentModel) MoveRowsDefault(sourceParent core.QModelIndex_ITF,
 
 //export callbackQHelpContentModel_RemoveColumns
 func callbackQHelpContentModel_RemoveColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(column)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -974,7 +1081,7 @@ func (ptr *QHelpContentModel) RemoveColumnsDefault(column int, count int, parent
 
 //export callbackQHelpContentModel_RemoveRows
 func callbackQHelpContentModel_RemoveRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(row)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -990,7 +1097,7 @@ func (ptr *QHelpContentModel) RemoveRowsDefault(row int, count int, parent core.
 
 //export callbackQHelpContentModel_SetData
 func callbackQHelpContentModel_SetData(ptr unsafe.Pointer, index unsafe.Pointer, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, *core.QVariant, int) bool)(core.NewQModelIndexFromPointer(index), core.NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -1006,7 +1113,7 @@ func (ptr *QHelpContentModel) SetDataDefault(index core.QModelIndex_ITF, value c
 
 //export callbackQHelpContentModel_SetHeaderData
 func callbackQHelpContentModel_SetHeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHeaderData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHeaderData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, core.Qt__Orientation, *core.QVariant, int) bool)(int(int32(section)), core.Qt__Orientation(orientation), core.NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -1022,7 +1129,7 @@ func (ptr *QHelpContentModel) SetHeaderDataDefault(section int, orientation core
 
 //export callbackQHelpContentModel_SetItemData
 func callbackQHelpContentModel_SetItemData(ptr unsafe.Pointer, index unsafe.Pointer, roles C.struct_QtHelp_PackedList) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setItemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setItemData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, map[int]*core.QVariant) bool)(core.NewQModelIndexFromPointer(index), func(l C.struct_QtHelp_PackedList) map[int]*core.QVariant {
 			var out = make(map[int]*core.QVariant, int(l.len))
 			for _, i := range NewQHelpContentModelFromPointer(l.data).__setItemData_keyList() {
@@ -1056,7 +1163,7 @@ func (ptr *QHelpContentModel) SetItemDataDefault(index core.QModelIndex_ITF, rol
 
 //export callbackQHelpContentModel_Submit
 func callbackQHelpContentModel_Submit(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "submit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "submit"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1072,7 +1179,7 @@ func (ptr *QHelpContentModel) SubmitDefault() bool {
 
 //export callbackQHelpContentModel_ColumnsAboutToBeInserted
 func callbackQHelpContentModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1080,7 +1187,7 @@ func callbackQHelpContentModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, pare
 
 //export callbackQHelpContentModel_ColumnsAboutToBeMoved
 func callbackQHelpContentModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationColumn C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationColumn)))
 	}
 
@@ -1088,7 +1195,7 @@ func callbackQHelpContentModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, sourceP
 
 //export callbackQHelpContentModel_ColumnsAboutToBeRemoved
 func callbackQHelpContentModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1096,7 +1203,7 @@ func callbackQHelpContentModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, paren
 
 //export callbackQHelpContentModel_ColumnsInserted
 func callbackQHelpContentModel_ColumnsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1104,7 +1211,7 @@ func callbackQHelpContentModel_ColumnsInserted(ptr unsafe.Pointer, parent unsafe
 
 //export callbackQHelpContentModel_ColumnsMoved
 func callbackQHelpContentModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, column C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), core.NewQModelIndexFromPointer(destination), int(int32(column)))
 	}
 
@@ -1112,7 +1219,7 @@ func callbackQHelpContentModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.Po
 
 //export callbackQHelpContentModel_ColumnsRemoved
 func callbackQHelpContentModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1120,11 +1227,13 @@ func callbackQHelpContentModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe.
 
 //export callbackQHelpContentModel_DataChanged
 func callbackQHelpContentModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Pointer, bottomRight unsafe.Pointer, roles C.struct_QtHelp_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataChanged"); signal != nil {
 		signal.(func(*core.QModelIndex, *core.QModelIndex, []int))(core.NewQModelIndexFromPointer(topLeft), core.NewQModelIndexFromPointer(bottomRight), func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpContentModelFromPointer(l.data).__dataChanged_roles_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpContentModelFromPointer(l.data).__dataChanged_roles_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(roles))
@@ -1134,7 +1243,7 @@ func callbackQHelpContentModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Po
 
 //export callbackQHelpContentModel_FetchMore
 func callbackQHelpContentModel_FetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchMore"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(parent))
 	} else {
 		NewQHelpContentModelFromPointer(ptr).FetchMoreDefault(core.NewQModelIndexFromPointer(parent))
@@ -1149,7 +1258,7 @@ func (ptr *QHelpContentModel) FetchMoreDefault(parent core.QModelIndex_ITF) {
 
 //export callbackQHelpContentModel_HeaderDataChanged
 func callbackQHelpContentModel_HeaderDataChanged(ptr unsafe.Pointer, orientation C.longlong, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerDataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerDataChanged"); signal != nil {
 		signal.(func(core.Qt__Orientation, int, int))(core.Qt__Orientation(orientation), int(int32(first)), int(int32(last)))
 	}
 
@@ -1157,7 +1266,7 @@ func callbackQHelpContentModel_HeaderDataChanged(ptr unsafe.Pointer, orientation
 
 //export callbackQHelpContentModel_LayoutAboutToBeChanged
 func callbackQHelpContentModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, parents C.struct_QtHelp_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutAboutToBeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutAboutToBeChanged"); signal != nil {
 		signal.(func([]*core.QPersistentModelIndex, core.QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtHelp_PackedList) []*core.QPersistentModelIndex {
 			var out = make([]*core.QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -1171,7 +1280,7 @@ func callbackQHelpContentModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, parent
 
 //export callbackQHelpContentModel_LayoutChanged
 func callbackQHelpContentModel_LayoutChanged(ptr unsafe.Pointer, parents C.struct_QtHelp_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutChanged"); signal != nil {
 		signal.(func([]*core.QPersistentModelIndex, core.QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtHelp_PackedList) []*core.QPersistentModelIndex {
 			var out = make([]*core.QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -1185,7 +1294,7 @@ func callbackQHelpContentModel_LayoutChanged(ptr unsafe.Pointer, parents C.struc
 
 //export callbackQHelpContentModel_ModelAboutToBeReset
 func callbackQHelpContentModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelAboutToBeReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelAboutToBeReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1193,7 +1302,7 @@ func callbackQHelpContentModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
 
 //export callbackQHelpContentModel_ModelReset
 func callbackQHelpContentModel_ModelReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1201,7 +1310,7 @@ func callbackQHelpContentModel_ModelReset(ptr unsafe.Pointer) {
 
 //export callbackQHelpContentModel_ResetInternalData
 func callbackQHelpContentModel_ResetInternalData(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resetInternalData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resetInternalData"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentModelFromPointer(ptr).ResetInternalDataDefault()
@@ -1216,7 +1325,7 @@ func (ptr *QHelpContentModel) ResetInternalDataDefault() {
 
 //export callbackQHelpContentModel_Revert
 func callbackQHelpContentModel_Revert(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "revert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "revert"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentModelFromPointer(ptr).RevertDefault()
@@ -1231,7 +1340,7 @@ func (ptr *QHelpContentModel) RevertDefault() {
 
 //export callbackQHelpContentModel_RowsAboutToBeInserted
 func callbackQHelpContentModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	}
 
@@ -1239,7 +1348,7 @@ func callbackQHelpContentModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent
 
 //export callbackQHelpContentModel_RowsAboutToBeMoved
 func callbackQHelpContentModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationRow C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationRow)))
 	}
 
@@ -1247,7 +1356,7 @@ func callbackQHelpContentModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourcePare
 
 //export callbackQHelpContentModel_RowsAboutToBeRemoved
 func callbackQHelpContentModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1255,7 +1364,7 @@ func callbackQHelpContentModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent u
 
 //export callbackQHelpContentModel_RowsInserted
 func callbackQHelpContentModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1263,7 +1372,7 @@ func callbackQHelpContentModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.Po
 
 //export callbackQHelpContentModel_RowsMoved
 func callbackQHelpContentModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, row C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), core.NewQModelIndexFromPointer(destination), int(int32(row)))
 	}
 
@@ -1271,7 +1380,7 @@ func callbackQHelpContentModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Point
 
 //export callbackQHelpContentModel_RowsRemoved
 func callbackQHelpContentModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -1279,7 +1388,7 @@ func callbackQHelpContentModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Poi
 
 //export callbackQHelpContentModel_Sort
 func callbackQHelpContentModel_Sort(ptr unsafe.Pointer, column C.int, order C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sort"); signal != nil {
 		signal.(func(int, core.Qt__SortOrder))(int(int32(column)), core.Qt__SortOrder(order))
 	} else {
 		NewQHelpContentModelFromPointer(ptr).SortDefault(int(int32(column)), core.Qt__SortOrder(order))
@@ -1294,7 +1403,7 @@ func (ptr *QHelpContentModel) SortDefault(column int, order core.Qt__SortOrder)
 
 //export callbackQHelpContentModel_RoleNames
 func callbackQHelpContentModel_RoleNames(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "roleNames"); signal != nil {
+	if signal := qt.GetSignal(ptr, "roleNames"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQHelpContentModelFromPointer(NewQHelpContentModelFromPointer(nil).__roleNames_newList())
 			for k, v := range signal.(func() map[int]*core.QByteArray)() {
@@ -1328,7 +1437,7 @@ func (ptr *QHelpContentModel) RoleNamesDefault() map[int]*core.QByteArray {
 
 //export callbackQHelpContentModel_ItemData
 func callbackQHelpContentModel_ItemData(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemData"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQHelpContentModelFromPointer(NewQHelpContentModelFromPointer(nil).__itemData_newList())
 			for k, v := range signal.(func(*core.QModelIndex) map[int]*core.QVariant)(core.NewQModelIndexFromPointer(index)) {
@@ -1362,7 +1471,7 @@ func (ptr *QHelpContentModel) ItemDataDefault(index core.QModelIndex_ITF) map[in
 
 //export callbackQHelpContentModel_MimeData
 func callbackQHelpContentModel_MimeData(ptr unsafe.Pointer, indexes C.struct_QtHelp_PackedList) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mimeData"); signal != nil {
 		return core.PointerFromQMimeData(signal.(func([]*core.QModelIndex) *core.QMimeData)(func(l C.struct_QtHelp_PackedList) []*core.QModelIndex {
 			var out = make([]*core.QModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -1390,7 +1499,7 @@ func (ptr *QHelpContentModel) MimeDataDefault(indexes []*core.QModelIndex) *core
 			}
 			return tmpList.Pointer()
 		}()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1400,7 +1509,7 @@ func (ptr *QHelpContentModel) MimeDataDefault(indexes []*core.QModelIndex) *core
 
 //export callbackQHelpContentModel_Buddy
 func callbackQHelpContentModel_Buddy(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buddy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buddy"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QModelIndex) *core.QModelIndex)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -1418,7 +1527,7 @@ func (ptr *QHelpContentModel) BuddyDefault(index core.QModelIndex_ITF) *core.QMo
 
 //export callbackQHelpContentModel_Sibling
 func callbackQHelpContentModel_Sibling(ptr unsafe.Pointer, row C.int, column C.int, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sibling"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sibling"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(int, int, *core.QModelIndex) *core.QModelIndex)(int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -1436,7 +1545,7 @@ func (ptr *QHelpContentModel) SiblingDefault(row int, column int, index core.QMo
 
 //export callbackQHelpContentModel_Match
 func callbackQHelpContentModel_Match(ptr unsafe.Pointer, start unsafe.Pointer, role C.int, value unsafe.Pointer, hits C.int, flags C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "match"); signal != nil {
+	if signal := qt.GetSignal(ptr, "match"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQHelpContentModelFromPointer(NewQHelpContentModelFromPointer(nil).__match_newList())
 			for _, v := range signal.(func(*core.QModelIndex, int, *core.QVariant, int, core.Qt__MatchFlag) []*core.QModelIndex)(core.NewQModelIndexFromPointer(start), int(int32(role)), core.NewQVariantFromPointer(value), int(int32(hits)), core.Qt__MatchFlag(flags)) {
@@ -1470,7 +1579,7 @@ func (ptr *QHelpContentModel) MatchDefault(start core.QModelIndex_ITF, role int,
 
 //export callbackQHelpContentModel_Span
 func callbackQHelpContentModel_Span(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "span"); signal != nil {
+	if signal := qt.GetSignal(ptr, "span"); signal != nil {
 		return core.PointerFromQSize(signal.(func(*core.QModelIndex) *core.QSize)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -1488,23 +1597,23 @@ func (ptr *QHelpContentModel) SpanDefault(index core.QModelIndex_ITF) *core.QSiz
 
 //export callbackQHelpContentModel_MimeTypes
 func callbackQHelpContentModel_MimeTypes(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeTypes"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "mimeTypes"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(NewQHelpContentModelFromPointer(ptr).MimeTypesDefault(), "|"))
+	return cGoPackStringList(NewQHelpContentModelFromPointer(ptr).MimeTypesDefault())
 }
 
 func (ptr *QHelpContentModel) MimeTypesDefault() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QHelpContentModel_MimeTypesDefault(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QHelpContentModel_MimeTypesDefault(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQHelpContentModel_HeaderData
 func callbackQHelpContentModel_HeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerData"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(int, core.Qt__Orientation, int) *core.QVariant)(int(int32(section)), core.Qt__Orientation(orientation), int(int32(role))))
 	}
 
@@ -1522,7 +1631,7 @@ func (ptr *QHelpContentModel) HeaderDataDefault(section int, orientation core.Qt
 
 //export callbackQHelpContentModel_SupportedDragActions
 func callbackQHelpContentModel_SupportedDragActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDragActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDragActions"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__DropAction)())
 	}
 
@@ -1538,7 +1647,7 @@ func (ptr *QHelpContentModel) SupportedDragActionsDefault() core.Qt__DropAction
 
 //export callbackQHelpContentModel_SupportedDropActions
 func callbackQHelpContentModel_SupportedDropActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDropActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDropActions"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__DropAction)())
 	}
 
@@ -1554,7 +1663,7 @@ func (ptr *QHelpContentModel) SupportedDropActionsDefault() core.Qt__DropAction
 
 //export callbackQHelpContentModel_Flags
 func callbackQHelpContentModel_Flags(ptr unsafe.Pointer, index unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flags"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flags"); signal != nil {
 		return C.longlong(signal.(func(*core.QModelIndex) core.Qt__ItemFlag)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -1570,7 +1679,7 @@ func (ptr *QHelpContentModel) FlagsDefault(index core.QModelIndex_ITF) core.Qt__
 
 //export callbackQHelpContentModel_CanDropMimeData
 func callbackQHelpContentModel_CanDropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canDropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canDropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QMimeData, core.Qt__DropAction, int, int, *core.QModelIndex) bool)(core.NewQMimeDataFromPointer(data), core.Qt__DropAction(action), int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -1586,7 +1695,7 @@ func (ptr *QHelpContentModel) CanDropMimeDataDefault(data core.QMimeData_ITF, ac
 
 //export callbackQHelpContentModel_CanFetchMore
 func callbackQHelpContentModel_CanFetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canFetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canFetchMore"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -1602,7 +1711,7 @@ func (ptr *QHelpContentModel) CanFetchMoreDefault(parent core.QModelIndex_ITF) b
 
 //export callbackQHelpContentModel_HasChildren
 func callbackQHelpContentModel_HasChildren(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasChildren"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasChildren"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -1618,7 +1727,7 @@ func (ptr *QHelpContentModel) HasChildrenDefault(parent core.QModelIndex_ITF) bo
 
 //export callbackQHelpContentModel_Event
 func callbackQHelpContentModel_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -1634,7 +1743,7 @@ func (ptr *QHelpContentModel) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQHelpContentModel_EventFilter
 func callbackQHelpContentModel_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -1650,7 +1759,7 @@ func (ptr *QHelpContentModel) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQHelpContentModel_ChildEvent
 func callbackQHelpContentModel_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQHelpContentModelFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -1665,7 +1774,7 @@ func (ptr *QHelpContentModel) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQHelpContentModel_ConnectNotify
 func callbackQHelpContentModel_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpContentModelFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1680,7 +1789,7 @@ func (ptr *QHelpContentModel) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHelpContentModel_CustomEvent
 func callbackQHelpContentModel_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpContentModelFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -1695,7 +1804,7 @@ func (ptr *QHelpContentModel) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpContentModel_DeleteLater
 func callbackQHelpContentModel_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentModelFromPointer(ptr).DeleteLaterDefault()
@@ -1705,14 +1814,14 @@ func callbackQHelpContentModel_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QHelpContentModel) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QHelpContentModel_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHelpContentModel_Destroyed
 func callbackQHelpContentModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -1720,7 +1829,7 @@ func callbackQHelpContentModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQHelpContentModel_DisconnectNotify
 func callbackQHelpContentModel_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpContentModelFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1735,7 +1844,7 @@ func (ptr *QHelpContentModel) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQHelpContentModel_ObjectNameChanged
 func callbackQHelpContentModel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -1743,7 +1852,7 @@ func callbackQHelpContentModel_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQHelpContentModel_TimerEvent
 func callbackQHelpContentModel_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQHelpContentModelFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -1758,7 +1867,7 @@ func (ptr *QHelpContentModel) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQHelpContentModel_MetaObject
 func callbackQHelpContentModel_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -1814,7 +1923,7 @@ func NewQHelpContentWidgetFromPointer(ptr unsafe.Pointer) *QHelpContentWidget {
 func (ptr *QHelpContentWidget) DestroyQHelpContentWidget() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1830,7 +1939,7 @@ func (ptr *QHelpContentWidget) IndexOf(link core.QUrl_ITF) *core.QModelIndex {
 
 //export callbackQHelpContentWidget_LinkActivated
 func callbackQHelpContentWidget_LinkActivated(ptr unsafe.Pointer, link unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "linkActivated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "linkActivated"); signal != nil {
 		signal.(func(*core.QUrl))(core.NewQUrlFromPointer(link))
 	}
 
@@ -1839,14 +1948,14 @@ func callbackQHelpContentWidget_LinkActivated(ptr unsafe.Pointer, link unsafe.Po
 func (ptr *QHelpContentWidget) ConnectLinkActivated(f func(link *core.QUrl)) {
 	if ptr.Pointer() != nil {
 		C.QHelpContentWidget_ConnectLinkActivated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "linkActivated", f)
+		qt.ConnectSignal(ptr.Pointer(), "linkActivated", f)
 	}
 }
 
 func (ptr *QHelpContentWidget) DisconnectLinkActivated() {
 	if ptr.Pointer() != nil {
 		C.QHelpContentWidget_DisconnectLinkActivated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "linkActivated")
+		qt.DisconnectSignal(ptr.Pointer(), "linkActivated")
 	}
 }
 
@@ -1873,6 +1982,16 @@ func (ptr *QHelpContentWidget) __dataChanged_roles_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpContentWidget___dataChanged_roles_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpContentWidget) __dataChanged_roles_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpContentWidget___dataChanged_roles_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpContentWidget) __dataChanged_roles_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpContentWidget___dataChanged_roles_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpContentWidget) __selectedIndexes_atList(i int) *core.QModelIndex {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQModelIndexFromPointer(C.QHelpContentWidget___selectedIndexes_atList(ptr.Pointer(), C.int(int32(i))))
@@ -1895,7 +2014,7 @@ func (ptr *QHelpContentWidget) __selectedIndexes_newList() unsafe.Pointer {
 func (ptr *QHelpContentWidget) __scrollBarWidgets_atList(i int) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QHelpContentWidget___scrollBarWidgets_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1916,7 +2035,7 @@ func (ptr *QHelpContentWidget) __scrollBarWidgets_newList() unsafe.Pointer {
 func (ptr *QHelpContentWidget) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpContentWidget___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1937,7 +2056,7 @@ func (ptr *QHelpContentWidget) __addActions_actions_newList() unsafe.Pointer {
 func (ptr *QHelpContentWidget) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpContentWidget___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1958,7 +2077,7 @@ func (ptr *QHelpContentWidget) __insertActions_actions_newList() unsafe.Pointer
 func (ptr *QHelpContentWidget) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpContentWidget___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1998,7 +2117,7 @@ func (ptr *QHelpContentWidget) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QHelpContentWidget) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpContentWidget___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2019,7 +2138,7 @@ func (ptr *QHelpContentWidget) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QHelpContentWidget) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpContentWidget___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2040,7 +2159,7 @@ func (ptr *QHelpContentWidget) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QHelpContentWidget) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpContentWidget___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2061,7 +2180,7 @@ func (ptr *QHelpContentWidget) __findChildren_newList() unsafe.Pointer {
 func (ptr *QHelpContentWidget) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpContentWidget___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2081,7 +2200,7 @@ func (ptr *QHelpContentWidget) __children_newList() unsafe.Pointer {
 
 //export callbackQHelpContentWidget_MoveCursor
 func callbackQHelpContentWidget_MoveCursor(ptr unsafe.Pointer, cursorAction C.longlong, modifiers C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveCursor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveCursor"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(widgets.QAbstractItemView__CursorAction, core.Qt__KeyboardModifier) *core.QModelIndex)(widgets.QAbstractItemView__CursorAction(cursorAction), core.Qt__KeyboardModifier(modifiers)))
 	}
 
@@ -2099,7 +2218,7 @@ func (ptr *QHelpContentWidget) MoveCursorDefault(cursorAction widgets.QAbstractI
 
 //export callbackQHelpContentWidget_ViewportEvent
 func callbackQHelpContentWidget_ViewportEvent(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "viewportEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "viewportEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -2115,7 +2234,7 @@ func (ptr *QHelpContentWidget) ViewportEventDefault(event core.QEvent_ITF) bool
 
 //export callbackQHelpContentWidget_Collapse
 func callbackQHelpContentWidget_Collapse(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "collapse"); signal != nil {
+	if signal := qt.GetSignal(ptr, "collapse"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).CollapseDefault(core.NewQModelIndexFromPointer(index))
@@ -2130,7 +2249,7 @@ func (ptr *QHelpContentWidget) CollapseDefault(index core.QModelIndex_ITF) {
 
 //export callbackQHelpContentWidget_CollapseAll
 func callbackQHelpContentWidget_CollapseAll(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "collapseAll"); signal != nil {
+	if signal := qt.GetSignal(ptr, "collapseAll"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).CollapseAllDefault()
@@ -2145,7 +2264,7 @@ func (ptr *QHelpContentWidget) CollapseAllDefault() {
 
 //export callbackQHelpContentWidget_Collapsed
 func callbackQHelpContentWidget_Collapsed(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "collapsed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "collapsed"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -2153,7 +2272,7 @@ func callbackQHelpContentWidget_Collapsed(ptr unsafe.Pointer, index unsafe.Point
 
 //export callbackQHelpContentWidget_ColumnCountChanged
 func callbackQHelpContentWidget_ColumnCountChanged(ptr unsafe.Pointer, oldCount C.int, newCount C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCountChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCountChanged"); signal != nil {
 		signal.(func(int, int))(int(int32(oldCount)), int(int32(newCount)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ColumnCountChangedDefault(int(int32(oldCount)), int(int32(newCount)))
@@ -2168,7 +2287,7 @@ func (ptr *QHelpContentWidget) ColumnCountChangedDefault(oldCount int, newCount
 
 //export callbackQHelpContentWidget_ColumnMoved
 func callbackQHelpContentWidget_ColumnMoved(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnMoved"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ColumnMovedDefault()
@@ -2183,7 +2302,7 @@ func (ptr *QHelpContentWidget) ColumnMovedDefault() {
 
 //export callbackQHelpContentWidget_ColumnResized
 func callbackQHelpContentWidget_ColumnResized(ptr unsafe.Pointer, column C.int, oldSize C.int, newSize C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnResized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnResized"); signal != nil {
 		signal.(func(int, int, int))(int(int32(column)), int(int32(oldSize)), int(int32(newSize)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ColumnResizedDefault(int(int32(column)), int(int32(oldSize)), int(int32(newSize)))
@@ -2198,7 +2317,7 @@ func (ptr *QHelpContentWidget) ColumnResizedDefault(column int, oldSize int, new
 
 //export callbackQHelpContentWidget_CurrentChanged
 func callbackQHelpContentWidget_CurrentChanged(ptr unsafe.Pointer, current unsafe.Pointer, previous unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentChanged"); signal != nil {
 		signal.(func(*core.QModelIndex, *core.QModelIndex))(core.NewQModelIndexFromPointer(current), core.NewQModelIndexFromPointer(previous))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).CurrentChangedDefault(core.NewQModelIndexFromPointer(current), core.NewQModelIndexFromPointer(previous))
@@ -2213,19 +2332,23 @@ func (ptr *QHelpContentWidget) CurrentChangedDefault(current core.QModelIndex_IT
 
 //export callbackQHelpContentWidget_DataChanged
 func callbackQHelpContentWidget_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Pointer, bottomRight unsafe.Pointer, roles C.struct_QtHelp_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataChanged"); signal != nil {
 		signal.(func(*core.QModelIndex, *core.QModelIndex, []int))(core.NewQModelIndexFromPointer(topLeft), core.NewQModelIndexFromPointer(bottomRight), func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpContentWidgetFromPointer(l.data).__dataChanged_roles_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpContentWidgetFromPointer(l.data).__dataChanged_roles_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(roles))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).DataChangedDefault(core.NewQModelIndexFromPointer(topLeft), core.NewQModelIndexFromPointer(bottomRight), func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpContentWidgetFromPointer(l.data).__dataChanged_roles_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpContentWidgetFromPointer(l.data).__dataChanged_roles_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(roles))
@@ -2234,19 +2357,19 @@ func callbackQHelpContentWidget_DataChanged(ptr unsafe.Pointer, topLeft unsafe.P
 
 func (ptr *QHelpContentWidget) DataChangedDefault(topLeft core.QModelIndex_ITF, bottomRight core.QModelIndex_ITF, roles []int) {
 	if ptr.Pointer() != nil {
-		C.QHelpContentWidget_DataChangedDefault(ptr.Pointer(), core.PointerFromQModelIndex(topLeft), core.PointerFromQModelIndex(bottomRight), func() unsafe.Pointer {
-			var tmpList = NewQHelpContentWidgetFromPointer(NewQHelpContentWidgetFromPointer(nil).__dataChanged_roles_newList())
-			for _, v := range roles {
-				tmpList.__dataChanged_roles_setList(v)
+		C.QHelpContentWidget_DataChangedDefault(ptr.Pointer(), core.PointerFromQModelIndex(topLeft), core.PointerFromQModelIndex(bottomRight), func(l []int) unsafe.Pointer {
+			var tmpList = make([]C.int, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.int(int32(v))
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQHelpContentWidgetFromPointer(nil).__dataChanged_roles_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(roles))
 	}
 }
 
 //export callbackQHelpContentWidget_DragMoveEvent
 func callbackQHelpContentWidget_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -2261,7 +2384,7 @@ func (ptr *QHelpContentWidget) DragMoveEventDefault(event gui.QDragMoveEvent_ITF
 
 //export callbackQHelpContentWidget_Expand
 func callbackQHelpContentWidget_Expand(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "expand"); signal != nil {
+	if signal := qt.GetSignal(ptr, "expand"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ExpandDefault(core.NewQModelIndexFromPointer(index))
@@ -2276,7 +2399,7 @@ func (ptr *QHelpContentWidget) ExpandDefault(index core.QModelIndex_ITF) {
 
 //export callbackQHelpContentWidget_ExpandAll
 func callbackQHelpContentWidget_ExpandAll(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "expandAll"); signal != nil {
+	if signal := qt.GetSignal(ptr, "expandAll"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ExpandAllDefault()
@@ -2291,7 +2414,7 @@ func (ptr *QHelpContentWidget) ExpandAllDefault() {
 
 //export callbackQHelpContentWidget_ExpandToDepth
 func callbackQHelpContentWidget_ExpandToDepth(ptr unsafe.Pointer, depth C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "expandToDepth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "expandToDepth"); signal != nil {
 		signal.(func(int))(int(int32(depth)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ExpandToDepthDefault(int(int32(depth)))
@@ -2306,7 +2429,7 @@ func (ptr *QHelpContentWidget) ExpandToDepthDefault(depth int) {
 
 //export callbackQHelpContentWidget_Expanded
 func callbackQHelpContentWidget_Expanded(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "expanded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "expanded"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -2314,7 +2437,7 @@ func callbackQHelpContentWidget_Expanded(ptr unsafe.Pointer, index unsafe.Pointe
 
 //export callbackQHelpContentWidget_HideColumn
 func callbackQHelpContentWidget_HideColumn(ptr unsafe.Pointer, column C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideColumn"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideColumn"); signal != nil {
 		signal.(func(int))(int(int32(column)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).HideColumnDefault(int(int32(column)))
@@ -2329,7 +2452,7 @@ func (ptr *QHelpContentWidget) HideColumnDefault(column int) {
 
 //export callbackQHelpContentWidget_KeyPressEvent
 func callbackQHelpContentWidget_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -2344,7 +2467,7 @@ func (ptr *QHelpContentWidget) KeyPressEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQHelpContentWidget_KeyboardSearch
 func callbackQHelpContentWidget_KeyboardSearch(ptr unsafe.Pointer, search C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyboardSearch"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyboardSearch"); signal != nil {
 		signal.(func(string))(cGoUnpackString(search))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).KeyboardSearchDefault(cGoUnpackString(search))
@@ -2361,7 +2484,7 @@ func (ptr *QHelpContentWidget) KeyboardSearchDefault(search string) {
 
 //export callbackQHelpContentWidget_MouseDoubleClickEvent
 func callbackQHelpContentWidget_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2376,7 +2499,7 @@ func (ptr *QHelpContentWidget) MouseDoubleClickEventDefault(event gui.QMouseEven
 
 //export callbackQHelpContentWidget_MouseMoveEvent
 func callbackQHelpContentWidget_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2391,7 +2514,7 @@ func (ptr *QHelpContentWidget) MouseMoveEventDefault(event gui.QMouseEvent_ITF)
 
 //export callbackQHelpContentWidget_MousePressEvent
 func callbackQHelpContentWidget_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2406,7 +2529,7 @@ func (ptr *QHelpContentWidget) MousePressEventDefault(event gui.QMouseEvent_ITF)
 
 //export callbackQHelpContentWidget_MouseReleaseEvent
 func callbackQHelpContentWidget_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2421,7 +2544,7 @@ func (ptr *QHelpContentWidget) MouseReleaseEventDefault(event gui.QMouseEvent_IT
 
 //export callbackQHelpContentWidget_PaintEvent
 func callbackQHelpContentWidget_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -2436,7 +2559,7 @@ func (ptr *QHelpContentWidget) PaintEventDefault(event gui.QPaintEvent_ITF) {
 
 //export callbackQHelpContentWidget_Reset
 func callbackQHelpContentWidget_Reset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ResetDefault()
@@ -2451,7 +2574,7 @@ func (ptr *QHelpContentWidget) ResetDefault() {
 
 //export callbackQHelpContentWidget_ResizeColumnToContents
 func callbackQHelpContentWidget_ResizeColumnToContents(ptr unsafe.Pointer, column C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeColumnToContents"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeColumnToContents"); signal != nil {
 		signal.(func(int))(int(int32(column)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ResizeColumnToContentsDefault(int(int32(column)))
@@ -2466,7 +2589,7 @@ func (ptr *QHelpContentWidget) ResizeColumnToContentsDefault(column int) {
 
 //export callbackQHelpContentWidget_RowsAboutToBeRemoved
 func callbackQHelpContentWidget_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).RowsAboutToBeRemovedDefault(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
@@ -2481,7 +2604,7 @@ func (ptr *QHelpContentWidget) RowsAboutToBeRemovedDefault(parent core.QModelInd
 
 //export callbackQHelpContentWidget_RowsInserted
 func callbackQHelpContentWidget_RowsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).RowsInsertedDefault(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
@@ -2496,7 +2619,7 @@ func (ptr *QHelpContentWidget) RowsInsertedDefault(parent core.QModelIndex_ITF,
 
 //export callbackQHelpContentWidget_RowsRemoved
 func callbackQHelpContentWidget_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).RowsRemovedDefault(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
@@ -2511,7 +2634,7 @@ func (ptr *QHelpContentWidget) RowsRemovedDefault(parent core.QModelIndex_ITF, s
 
 //export callbackQHelpContentWidget_ScrollContentsBy
 func callbackQHelpContentWidget_ScrollContentsBy(ptr unsafe.Pointer, dx C.int, dy C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scrollContentsBy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scrollContentsBy"); signal != nil {
 		signal.(func(int, int))(int(int32(dx)), int(int32(dy)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ScrollContentsByDefault(int(int32(dx)), int(int32(dy)))
@@ -2526,7 +2649,7 @@ func (ptr *QHelpContentWidget) ScrollContentsByDefault(dx int, dy int) {
 
 //export callbackQHelpContentWidget_ScrollTo
 func callbackQHelpContentWidget_ScrollTo(ptr unsafe.Pointer, index unsafe.Pointer, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scrollTo"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scrollTo"); signal != nil {
 		signal.(func(*core.QModelIndex, widgets.QAbstractItemView__ScrollHint))(core.NewQModelIndexFromPointer(index), widgets.QAbstractItemView__ScrollHint(hint))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ScrollToDefault(core.NewQModelIndexFromPointer(index), widgets.QAbstractItemView__ScrollHint(hint))
@@ -2541,7 +2664,7 @@ func (ptr *QHelpContentWidget) ScrollToDefault(index core.QModelIndex_ITF, hint
 
 //export callbackQHelpContentWidget_SelectAll
 func callbackQHelpContentWidget_SelectAll(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectAll"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectAll"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SelectAllDefault()
@@ -2556,7 +2679,7 @@ func (ptr *QHelpContentWidget) SelectAllDefault() {
 
 //export callbackQHelpContentWidget_SelectionChanged
 func callbackQHelpContentWidget_SelectionChanged(ptr unsafe.Pointer, selected unsafe.Pointer, deselected unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionChanged"); signal != nil {
 		signal.(func(*core.QItemSelection, *core.QItemSelection))(core.NewQItemSelectionFromPointer(selected), core.NewQItemSelectionFromPointer(deselected))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SelectionChangedDefault(core.NewQItemSelectionFromPointer(selected), core.NewQItemSelectionFromPointer(deselected))
@@ -2571,7 +2694,7 @@ func (ptr *QHelpContentWidget) SelectionChangedDefault(selected core.QItemSelect
 
 //export callbackQHelpContentWidget_SetModel
 func callbackQHelpContentWidget_SetModel(ptr unsafe.Pointer, model unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setModel"); signal != nil {
 		signal.(func(*core.QAbstractItemModel))(core.NewQAbstractItemModelFromPointer(model))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetModelDefault(core.NewQAbstractItemModelFromPointer(model))
@@ -2586,7 +2709,7 @@ func (ptr *QHelpContentWidget) SetModelDefault(model core.QAbstractItemModel_ITF
 
 //export callbackQHelpContentWidget_SetRootIndex
 func callbackQHelpContentWidget_SetRootIndex(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRootIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRootIndex"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetRootIndexDefault(core.NewQModelIndexFromPointer(index))
@@ -2601,7 +2724,7 @@ func (ptr *QHelpContentWidget) SetRootIndexDefault(index core.QModelIndex_ITF) {
 
 //export callbackQHelpContentWidget_SetSelection
 func callbackQHelpContentWidget_SetSelection(ptr unsafe.Pointer, rect unsafe.Pointer, command C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSelection"); signal != nil {
 		signal.(func(*core.QRect, core.QItemSelectionModel__SelectionFlag))(core.NewQRectFromPointer(rect), core.QItemSelectionModel__SelectionFlag(command))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetSelectionDefault(core.NewQRectFromPointer(rect), core.QItemSelectionModel__SelectionFlag(command))
@@ -2616,7 +2739,7 @@ func (ptr *QHelpContentWidget) SetSelectionDefault(rect core.QRect_ITF, command
 
 //export callbackQHelpContentWidget_SetSelectionModel
 func callbackQHelpContentWidget_SetSelectionModel(ptr unsafe.Pointer, selectionModel unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSelectionModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSelectionModel"); signal != nil {
 		signal.(func(*core.QItemSelectionModel))(core.NewQItemSelectionModelFromPointer(selectionModel))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetSelectionModelDefault(core.NewQItemSelectionModelFromPointer(selectionModel))
@@ -2631,7 +2754,7 @@ func (ptr *QHelpContentWidget) SetSelectionModelDefault(selectionModel core.QIte
 
 //export callbackQHelpContentWidget_ShowColumn
 func callbackQHelpContentWidget_ShowColumn(ptr unsafe.Pointer, column C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showColumn"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showColumn"); signal != nil {
 		signal.(func(int))(int(int32(column)))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ShowColumnDefault(int(int32(column)))
@@ -2646,7 +2769,7 @@ func (ptr *QHelpContentWidget) ShowColumnDefault(column int) {
 
 //export callbackQHelpContentWidget_TimerEvent
 func callbackQHelpContentWidget_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -2661,7 +2784,7 @@ func (ptr *QHelpContentWidget) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQHelpContentWidget_UpdateGeometries
 func callbackQHelpContentWidget_UpdateGeometries(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateGeometries"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateGeometries"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).UpdateGeometriesDefault()
@@ -2676,7 +2799,7 @@ func (ptr *QHelpContentWidget) UpdateGeometriesDefault() {
 
 //export callbackQHelpContentWidget_IndexAt
 func callbackQHelpContentWidget_IndexAt(ptr unsafe.Pointer, point unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexAt"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexAt"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QPoint) *core.QModelIndex)(core.NewQPointFromPointer(point)))
 	}
 
@@ -2694,7 +2817,7 @@ func (ptr *QHelpContentWidget) IndexAtDefault(point core.QPoint_ITF) *core.QMode
 
 //export callbackQHelpContentWidget_VisualRect
 func callbackQHelpContentWidget_VisualRect(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visualRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visualRect"); signal != nil {
 		return core.PointerFromQRect(signal.(func(*core.QModelIndex) *core.QRect)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -2712,7 +2835,7 @@ func (ptr *QHelpContentWidget) VisualRectDefault(index core.QModelIndex_ITF) *co
 
 //export callbackQHelpContentWidget_VisualRegionForSelection
 func callbackQHelpContentWidget_VisualRegionForSelection(ptr unsafe.Pointer, selection unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visualRegionForSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visualRegionForSelection"); signal != nil {
 		return gui.PointerFromQRegion(signal.(func(*core.QItemSelection) *gui.QRegion)(core.NewQItemSelectionFromPointer(selection)))
 	}
 
@@ -2730,7 +2853,7 @@ func (ptr *QHelpContentWidget) VisualRegionForSelectionDefault(selection core.QI
 
 //export callbackQHelpContentWidget_ViewportSizeHint
 func callbackQHelpContentWidget_ViewportSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "viewportSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "viewportSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -2748,7 +2871,7 @@ func (ptr *QHelpContentWidget) ViewportSizeHintDefault() *core.QSize {
 
 //export callbackQHelpContentWidget_IsIndexHidden
 func callbackQHelpContentWidget_IsIndexHidden(ptr unsafe.Pointer, index unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isIndexHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isIndexHidden"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(index)))))
 	}
 
@@ -2764,7 +2887,7 @@ func (ptr *QHelpContentWidget) IsIndexHiddenDefault(index core.QModelIndex_ITF)
 
 //export callbackQHelpContentWidget_HorizontalOffset
 func callbackQHelpContentWidget_HorizontalOffset(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "horizontalOffset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "horizontalOffset"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -2780,7 +2903,7 @@ func (ptr *QHelpContentWidget) HorizontalOffsetDefault() int {
 
 //export callbackQHelpContentWidget_SizeHintForColumn
 func callbackQHelpContentWidget_SizeHintForColumn(ptr unsafe.Pointer, column C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHintForColumn"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHintForColumn"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(column)))))
 	}
 
@@ -2796,7 +2919,7 @@ func (ptr *QHelpContentWidget) SizeHintForColumnDefault(column int) int {
 
 //export callbackQHelpContentWidget_VerticalOffset
 func callbackQHelpContentWidget_VerticalOffset(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "verticalOffset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "verticalOffset"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -2812,7 +2935,7 @@ func (ptr *QHelpContentWidget) VerticalOffsetDefault() int {
 
 //export callbackQHelpContentWidget_DrawBranches
 func callbackQHelpContentWidget_DrawBranches(ptr unsafe.Pointer, painter unsafe.Pointer, rect unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawBranches"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawBranches"); signal != nil {
 		signal.(func(*gui.QPainter, *core.QRect, *core.QModelIndex))(gui.NewQPainterFromPointer(painter), core.NewQRectFromPointer(rect), core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).DrawBranchesDefault(gui.NewQPainterFromPointer(painter), core.NewQRectFromPointer(rect), core.NewQModelIndexFromPointer(index))
@@ -2827,7 +2950,7 @@ func (ptr *QHelpContentWidget) DrawBranchesDefault(painter gui.QPainter_ITF, rec
 
 //export callbackQHelpContentWidget_DrawRow
 func callbackQHelpContentWidget_DrawRow(ptr unsafe.Pointer, painter unsafe.Pointer, option unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawRow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawRow"); signal != nil {
 		signal.(func(*gui.QPainter, *widgets.QStyleOptionViewItem, *core.QModelIndex))(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).DrawRowDefault(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index))
@@ -2842,7 +2965,7 @@ func (ptr *QHelpContentWidget) DrawRowDefault(painter gui.QPainter_ITF, option w
 
 //export callbackQHelpContentWidget_Edit2
 func callbackQHelpContentWidget_Edit2(ptr unsafe.Pointer, index unsafe.Pointer, trigger C.longlong, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "edit2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "edit2"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, widgets.QAbstractItemView__EditTrigger, *core.QEvent) bool)(core.NewQModelIndexFromPointer(index), widgets.QAbstractItemView__EditTrigger(trigger), core.NewQEventFromPointer(event)))))
 	}
 
@@ -2858,7 +2981,7 @@ func (ptr *QHelpContentWidget) Edit2Default(index core.QModelIndex_ITF, trigger
 
 //export callbackQHelpContentWidget_Event
 func callbackQHelpContentWidget_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -2874,7 +2997,7 @@ func (ptr *QHelpContentWidget) EventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQHelpContentWidget_FocusNextPrevChild
 func callbackQHelpContentWidget_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -2890,7 +3013,7 @@ func (ptr *QHelpContentWidget) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQHelpContentWidget_Activated
 func callbackQHelpContentWidget_Activated(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activated"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -2898,7 +3021,7 @@ func callbackQHelpContentWidget_Activated(ptr unsafe.Pointer, index unsafe.Point
 
 //export callbackQHelpContentWidget_ClearSelection
 func callbackQHelpContentWidget_ClearSelection(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clearSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clearSelection"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ClearSelectionDefault()
@@ -2913,7 +3036,7 @@ func (ptr *QHelpContentWidget) ClearSelectionDefault() {
 
 //export callbackQHelpContentWidget_Clicked
 func callbackQHelpContentWidget_Clicked(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -2921,7 +3044,7 @@ func callbackQHelpContentWidget_Clicked(ptr unsafe.Pointer, index unsafe.Pointer
 
 //export callbackQHelpContentWidget_CloseEditor
 func callbackQHelpContentWidget_CloseEditor(ptr unsafe.Pointer, editor unsafe.Pointer, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEditor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEditor"); signal != nil {
 		signal.(func(*widgets.QWidget, widgets.QAbstractItemDelegate__EndEditHint))(widgets.NewQWidgetFromPointer(editor), widgets.QAbstractItemDelegate__EndEditHint(hint))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).CloseEditorDefault(widgets.NewQWidgetFromPointer(editor), widgets.QAbstractItemDelegate__EndEditHint(hint))
@@ -2936,7 +3059,7 @@ func (ptr *QHelpContentWidget) CloseEditorDefault(editor widgets.QWidget_ITF, hi
 
 //export callbackQHelpContentWidget_CommitData
 func callbackQHelpContentWidget_CommitData(ptr unsafe.Pointer, editor unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "commitData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "commitData"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(editor))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).CommitDataDefault(widgets.NewQWidgetFromPointer(editor))
@@ -2951,7 +3074,7 @@ func (ptr *QHelpContentWidget) CommitDataDefault(editor widgets.QWidget_ITF) {
 
 //export callbackQHelpContentWidget_DoubleClicked
 func callbackQHelpContentWidget_DoubleClicked(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -2959,7 +3082,7 @@ func callbackQHelpContentWidget_DoubleClicked(ptr unsafe.Pointer, index unsafe.P
 
 //export callbackQHelpContentWidget_DragEnterEvent
 func callbackQHelpContentWidget_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -2974,7 +3097,7 @@ func (ptr *QHelpContentWidget) DragEnterEventDefault(event gui.QDragEnterEvent_I
 
 //export callbackQHelpContentWidget_DragLeaveEvent
 func callbackQHelpContentWidget_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -2989,7 +3112,7 @@ func (ptr *QHelpContentWidget) DragLeaveEventDefault(event gui.QDragLeaveEvent_I
 
 //export callbackQHelpContentWidget_DropEvent
 func callbackQHelpContentWidget_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -3004,7 +3127,7 @@ func (ptr *QHelpContentWidget) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQHelpContentWidget_Edit
 func callbackQHelpContentWidget_Edit(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "edit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "edit"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).EditDefault(core.NewQModelIndexFromPointer(index))
@@ -3019,7 +3142,7 @@ func (ptr *QHelpContentWidget) EditDefault(index core.QModelIndex_ITF) {
 
 //export callbackQHelpContentWidget_EditorDestroyed
 func callbackQHelpContentWidget_EditorDestroyed(ptr unsafe.Pointer, editor unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "editorDestroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "editorDestroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(editor))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).EditorDestroyedDefault(core.NewQObjectFromPointer(editor))
@@ -3034,7 +3157,7 @@ func (ptr *QHelpContentWidget) EditorDestroyedDefault(editor core.QObject_ITF) {
 
 //export callbackQHelpContentWidget_Entered
 func callbackQHelpContentWidget_Entered(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "entered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "entered"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -3042,7 +3165,7 @@ func callbackQHelpContentWidget_Entered(ptr unsafe.Pointer, index unsafe.Pointer
 
 //export callbackQHelpContentWidget_FocusInEvent
 func callbackQHelpContentWidget_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -3057,7 +3180,7 @@ func (ptr *QHelpContentWidget) FocusInEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQHelpContentWidget_FocusOutEvent
 func callbackQHelpContentWidget_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -3072,7 +3195,7 @@ func (ptr *QHelpContentWidget) FocusOutEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQHelpContentWidget_IconSizeChanged
 func callbackQHelpContentWidget_IconSizeChanged(ptr unsafe.Pointer, size unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "iconSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "iconSizeChanged"); signal != nil {
 		signal.(func(*core.QSize))(core.NewQSizeFromPointer(size))
 	}
 
@@ -3080,7 +3203,7 @@ func callbackQHelpContentWidget_IconSizeChanged(ptr unsafe.Pointer, size unsafe.
 
 //export callbackQHelpContentWidget_InputMethodEvent
 func callbackQHelpContentWidget_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -3095,7 +3218,7 @@ func (ptr *QHelpContentWidget) InputMethodEventDefault(event gui.QInputMethodEve
 
 //export callbackQHelpContentWidget_Pressed
 func callbackQHelpContentWidget_Pressed(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -3103,7 +3226,7 @@ func callbackQHelpContentWidget_Pressed(ptr unsafe.Pointer, index unsafe.Pointer
 
 //export callbackQHelpContentWidget_ResizeEvent
 func callbackQHelpContentWidget_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -3118,7 +3241,7 @@ func (ptr *QHelpContentWidget) ResizeEventDefault(event gui.QResizeEvent_ITF) {
 
 //export callbackQHelpContentWidget_ScrollToBottom
 func callbackQHelpContentWidget_ScrollToBottom(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scrollToBottom"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scrollToBottom"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ScrollToBottomDefault()
@@ -3133,7 +3256,7 @@ func (ptr *QHelpContentWidget) ScrollToBottomDefault() {
 
 //export callbackQHelpContentWidget_ScrollToTop
 func callbackQHelpContentWidget_ScrollToTop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scrollToTop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scrollToTop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ScrollToTopDefault()
@@ -3148,7 +3271,7 @@ func (ptr *QHelpContentWidget) ScrollToTopDefault() {
 
 //export callbackQHelpContentWidget_SetCurrentIndex
 func callbackQHelpContentWidget_SetCurrentIndex(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCurrentIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCurrentIndex"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetCurrentIndexDefault(core.NewQModelIndexFromPointer(index))
@@ -3163,7 +3286,7 @@ func (ptr *QHelpContentWidget) SetCurrentIndexDefault(index core.QModelIndex_ITF
 
 //export callbackQHelpContentWidget_StartDrag
 func callbackQHelpContentWidget_StartDrag(ptr unsafe.Pointer, supportedActions C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startDrag"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startDrag"); signal != nil {
 		signal.(func(core.Qt__DropAction))(core.Qt__DropAction(supportedActions))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).StartDragDefault(core.Qt__DropAction(supportedActions))
@@ -3178,7 +3301,7 @@ func (ptr *QHelpContentWidget) StartDragDefault(supportedActions core.Qt__DropAc
 
 //export callbackQHelpContentWidget_Update
 func callbackQHelpContentWidget_Update(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).UpdateDefault(core.NewQModelIndexFromPointer(index))
@@ -3193,7 +3316,7 @@ func (ptr *QHelpContentWidget) UpdateDefault(index core.QModelIndex_ITF) {
 
 //export callbackQHelpContentWidget_ViewportEntered
 func callbackQHelpContentWidget_ViewportEntered(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "viewportEntered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "viewportEntered"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3201,7 +3324,7 @@ func callbackQHelpContentWidget_ViewportEntered(ptr unsafe.Pointer) {
 
 //export callbackQHelpContentWidget_SelectionCommand
 func callbackQHelpContentWidget_SelectionCommand(ptr unsafe.Pointer, index unsafe.Pointer, event unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionCommand"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionCommand"); signal != nil {
 		return C.longlong(signal.(func(*core.QModelIndex, *core.QEvent) core.QItemSelectionModel__SelectionFlag)(core.NewQModelIndexFromPointer(index), core.NewQEventFromPointer(event)))
 	}
 
@@ -3217,7 +3340,7 @@ func (ptr *QHelpContentWidget) SelectionCommandDefault(index core.QModelIndex_IT
 
 //export callbackQHelpContentWidget_ViewOptions
 func callbackQHelpContentWidget_ViewOptions(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "viewOptions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "viewOptions"); signal != nil {
 		return widgets.PointerFromQStyleOptionViewItem(signal.(func() *widgets.QStyleOptionViewItem)())
 	}
 
@@ -3235,7 +3358,7 @@ func (ptr *QHelpContentWidget) ViewOptionsDefault() *widgets.QStyleOptionViewIte
 
 //export callbackQHelpContentWidget_InputMethodQuery
 func callbackQHelpContentWidget_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -3253,7 +3376,7 @@ func (ptr *QHelpContentWidget) InputMethodQueryDefault(query core.Qt__InputMetho
 
 //export callbackQHelpContentWidget_SizeHintForRow
 func callbackQHelpContentWidget_SizeHintForRow(ptr unsafe.Pointer, row C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHintForRow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHintForRow"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(row)))))
 	}
 
@@ -3269,7 +3392,7 @@ func (ptr *QHelpContentWidget) SizeHintForRowDefault(row int) int {
 
 //export callbackQHelpContentWidget_ContextMenuEvent
 func callbackQHelpContentWidget_ContextMenuEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(e))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(e))
@@ -3284,7 +3407,7 @@ func (ptr *QHelpContentWidget) ContextMenuEventDefault(e gui.QContextMenuEvent_I
 
 //export callbackQHelpContentWidget_SetupViewport
 func callbackQHelpContentWidget_SetupViewport(ptr unsafe.Pointer, viewport unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setupViewport"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setupViewport"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(viewport))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetupViewportDefault(widgets.NewQWidgetFromPointer(viewport))
@@ -3299,7 +3422,7 @@ func (ptr *QHelpContentWidget) SetupViewportDefault(viewport widgets.QWidget_ITF
 
 //export callbackQHelpContentWidget_WheelEvent
 func callbackQHelpContentWidget_WheelEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(e))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(e))
@@ -3314,7 +3437,7 @@ func (ptr *QHelpContentWidget) WheelEventDefault(e gui.QWheelEvent_ITF) {
 
 //export callbackQHelpContentWidget_MinimumSizeHint
 func callbackQHelpContentWidget_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -3332,7 +3455,7 @@ func (ptr *QHelpContentWidget) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQHelpContentWidget_SizeHint
 func callbackQHelpContentWidget_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -3350,7 +3473,7 @@ func (ptr *QHelpContentWidget) SizeHintDefault() *core.QSize {
 
 //export callbackQHelpContentWidget_ChangeEvent
 func callbackQHelpContentWidget_ChangeEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(ev))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(ev))
@@ -3365,7 +3488,7 @@ func (ptr *QHelpContentWidget) ChangeEventDefault(ev core.QEvent_ITF) {
 
 //export callbackQHelpContentWidget_Close
 func callbackQHelpContentWidget_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3381,7 +3504,7 @@ func (ptr *QHelpContentWidget) CloseDefault() bool {
 
 //export callbackQHelpContentWidget_NativeEvent
 func callbackQHelpContentWidget_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -3397,7 +3520,7 @@ func (ptr *QHelpContentWidget) NativeEventDefault(eventType core.QByteArray_ITF,
 
 //export callbackQHelpContentWidget_ActionEvent
 func callbackQHelpContentWidget_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -3412,7 +3535,7 @@ func (ptr *QHelpContentWidget) ActionEventDefault(event gui.QActionEvent_ITF) {
 
 //export callbackQHelpContentWidget_CloseEvent
 func callbackQHelpContentWidget_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -3427,7 +3550,7 @@ func (ptr *QHelpContentWidget) CloseEventDefault(event gui.QCloseEvent_ITF) {
 
 //export callbackQHelpContentWidget_CustomContextMenuRequested
 func callbackQHelpContentWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -3435,7 +3558,7 @@ func callbackQHelpContentWidget_CustomContextMenuRequested(ptr unsafe.Pointer, p
 
 //export callbackQHelpContentWidget_EnterEvent
 func callbackQHelpContentWidget_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -3450,7 +3573,7 @@ func (ptr *QHelpContentWidget) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpContentWidget_Hide
 func callbackQHelpContentWidget_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).HideDefault()
@@ -3465,7 +3588,7 @@ func (ptr *QHelpContentWidget) HideDefault() {
 
 //export callbackQHelpContentWidget_HideEvent
 func callbackQHelpContentWidget_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -3480,7 +3603,7 @@ func (ptr *QHelpContentWidget) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQHelpContentWidget_KeyReleaseEvent
 func callbackQHelpContentWidget_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -3495,7 +3618,7 @@ func (ptr *QHelpContentWidget) KeyReleaseEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQHelpContentWidget_LeaveEvent
 func callbackQHelpContentWidget_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -3510,7 +3633,7 @@ func (ptr *QHelpContentWidget) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpContentWidget_Lower
 func callbackQHelpContentWidget_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).LowerDefault()
@@ -3525,7 +3648,7 @@ func (ptr *QHelpContentWidget) LowerDefault() {
 
 //export callbackQHelpContentWidget_MoveEvent
 func callbackQHelpContentWidget_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -3540,7 +3663,7 @@ func (ptr *QHelpContentWidget) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQHelpContentWidget_Raise
 func callbackQHelpContentWidget_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).RaiseDefault()
@@ -3555,7 +3678,7 @@ func (ptr *QHelpContentWidget) RaiseDefault() {
 
 //export callbackQHelpContentWidget_Repaint
 func callbackQHelpContentWidget_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).RepaintDefault()
@@ -3570,7 +3693,7 @@ func (ptr *QHelpContentWidget) RepaintDefault() {
 
 //export callbackQHelpContentWidget_SetDisabled
 func callbackQHelpContentWidget_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -3585,7 +3708,7 @@ func (ptr *QHelpContentWidget) SetDisabledDefault(disable bool) {
 
 //export callbackQHelpContentWidget_SetEnabled
 func callbackQHelpContentWidget_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -3600,7 +3723,7 @@ func (ptr *QHelpContentWidget) SetEnabledDefault(vbo bool) {
 
 //export callbackQHelpContentWidget_SetFocus2
 func callbackQHelpContentWidget_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetFocus2Default()
@@ -3615,7 +3738,7 @@ func (ptr *QHelpContentWidget) SetFocus2Default() {
 
 //export callbackQHelpContentWidget_SetHidden
 func callbackQHelpContentWidget_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -3630,7 +3753,7 @@ func (ptr *QHelpContentWidget) SetHiddenDefault(hidden bool) {
 
 //export callbackQHelpContentWidget_SetStyleSheet
 func callbackQHelpContentWidget_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -3647,7 +3770,7 @@ func (ptr *QHelpContentWidget) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQHelpContentWidget_SetVisible
 func callbackQHelpContentWidget_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -3662,7 +3785,7 @@ func (ptr *QHelpContentWidget) SetVisibleDefault(visible bool) {
 
 //export callbackQHelpContentWidget_SetWindowModified
 func callbackQHelpContentWidget_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -3677,7 +3800,7 @@ func (ptr *QHelpContentWidget) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQHelpContentWidget_SetWindowTitle
 func callbackQHelpContentWidget_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -3694,7 +3817,7 @@ func (ptr *QHelpContentWidget) SetWindowTitleDefault(vqs string) {
 
 //export callbackQHelpContentWidget_Show
 func callbackQHelpContentWidget_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ShowDefault()
@@ -3709,7 +3832,7 @@ func (ptr *QHelpContentWidget) ShowDefault() {
 
 //export callbackQHelpContentWidget_ShowEvent
 func callbackQHelpContentWidget_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -3724,7 +3847,7 @@ func (ptr *QHelpContentWidget) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQHelpContentWidget_ShowFullScreen
 func callbackQHelpContentWidget_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ShowFullScreenDefault()
@@ -3739,7 +3862,7 @@ func (ptr *QHelpContentWidget) ShowFullScreenDefault() {
 
 //export callbackQHelpContentWidget_ShowMaximized
 func callbackQHelpContentWidget_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ShowMaximizedDefault()
@@ -3754,7 +3877,7 @@ func (ptr *QHelpContentWidget) ShowMaximizedDefault() {
 
 //export callbackQHelpContentWidget_ShowMinimized
 func callbackQHelpContentWidget_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ShowMinimizedDefault()
@@ -3769,7 +3892,7 @@ func (ptr *QHelpContentWidget) ShowMinimizedDefault() {
 
 //export callbackQHelpContentWidget_ShowNormal
 func callbackQHelpContentWidget_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ShowNormalDefault()
@@ -3784,7 +3907,7 @@ func (ptr *QHelpContentWidget) ShowNormalDefault() {
 
 //export callbackQHelpContentWidget_TabletEvent
 func callbackQHelpContentWidget_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -3799,7 +3922,7 @@ func (ptr *QHelpContentWidget) TabletEventDefault(event gui.QTabletEvent_ITF) {
 
 //export callbackQHelpContentWidget_UpdateMicroFocus
 func callbackQHelpContentWidget_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).UpdateMicroFocusDefault()
@@ -3814,7 +3937,7 @@ func (ptr *QHelpContentWidget) UpdateMicroFocusDefault() {
 
 //export callbackQHelpContentWidget_WindowIconChanged
 func callbackQHelpContentWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -3822,7 +3945,7 @@ func callbackQHelpContentWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsaf
 
 //export callbackQHelpContentWidget_WindowTitleChanged
 func callbackQHelpContentWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -3830,7 +3953,7 @@ func callbackQHelpContentWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.s
 
 //export callbackQHelpContentWidget_PaintEngine
 func callbackQHelpContentWidget_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -3846,7 +3969,7 @@ func (ptr *QHelpContentWidget) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQHelpContentWidget_HasHeightForWidth
 func callbackQHelpContentWidget_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3862,7 +3985,7 @@ func (ptr *QHelpContentWidget) HasHeightForWidthDefault() bool {
 
 //export callbackQHelpContentWidget_HeightForWidth
 func callbackQHelpContentWidget_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -3878,7 +4001,7 @@ func (ptr *QHelpContentWidget) HeightForWidthDefault(w int) int {
 
 //export callbackQHelpContentWidget_Metric
 func callbackQHelpContentWidget_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -3894,7 +4017,7 @@ func (ptr *QHelpContentWidget) MetricDefault(m gui.QPaintDevice__PaintDeviceMetr
 
 //export callbackQHelpContentWidget_EventFilter
 func callbackQHelpContentWidget_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -3910,7 +4033,7 @@ func (ptr *QHelpContentWidget) EventFilterDefault(watched core.QObject_ITF, even
 
 //export callbackQHelpContentWidget_ChildEvent
 func callbackQHelpContentWidget_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -3925,7 +4048,7 @@ func (ptr *QHelpContentWidget) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQHelpContentWidget_ConnectNotify
 func callbackQHelpContentWidget_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3940,7 +4063,7 @@ func (ptr *QHelpContentWidget) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHelpContentWidget_CustomEvent
 func callbackQHelpContentWidget_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -3955,7 +4078,7 @@ func (ptr *QHelpContentWidget) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpContentWidget_DeleteLater
 func callbackQHelpContentWidget_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).DeleteLaterDefault()
@@ -3965,14 +4088,14 @@ func callbackQHelpContentWidget_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QHelpContentWidget) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QHelpContentWidget_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHelpContentWidget_Destroyed
 func callbackQHelpContentWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -3980,7 +4103,7 @@ func callbackQHelpContentWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer
 
 //export callbackQHelpContentWidget_DisconnectNotify
 func callbackQHelpContentWidget_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpContentWidgetFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3995,7 +4118,7 @@ func (ptr *QHelpContentWidget) DisconnectNotifyDefault(sign core.QMetaMethod_ITF
 
 //export callbackQHelpContentWidget_ObjectNameChanged
 func callbackQHelpContentWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -4003,7 +4126,7 @@ func callbackQHelpContentWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQHelpContentWidget_MetaObject
 func callbackQHelpContentWidget_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -4058,7 +4181,7 @@ func NewQHelpEngineFromPointer(ptr unsafe.Pointer) *QHelpEngine {
 func (ptr *QHelpEngine) ContentWidget() *QHelpContentWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQHelpContentWidgetFromPointer(C.QHelpEngine_ContentWidget(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4070,7 +4193,7 @@ func NewQHelpEngine(collectionFile string, parent core.QObject_ITF) *QHelpEngine
 	var collectionFileC = C.CString(collectionFile)
 	defer C.free(unsafe.Pointer(collectionFileC))
 	var tmpValue = NewQHelpEngineFromPointer(C.QHelpEngine_NewQHelpEngine(collectionFileC, core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4079,7 +4202,7 @@ func NewQHelpEngine(collectionFile string, parent core.QObject_ITF) *QHelpEngine
 func (ptr *QHelpEngine) IndexWidget() *QHelpIndexWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQHelpIndexWidgetFromPointer(C.QHelpEngine_IndexWidget(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4090,7 +4213,7 @@ func (ptr *QHelpEngine) IndexWidget() *QHelpIndexWidget {
 func (ptr *QHelpEngine) SearchEngine() *QHelpSearchEngine {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQHelpSearchEngineFromPointer(C.QHelpEngine_SearchEngine(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4101,7 +4224,7 @@ func (ptr *QHelpEngine) SearchEngine() *QHelpSearchEngine {
 func (ptr *QHelpEngine) DestroyQHelpEngine() {
 	if ptr.Pointer() != nil {
 		C.QHelpEngine_DestroyQHelpEngine(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4109,7 +4232,7 @@ func (ptr *QHelpEngine) DestroyQHelpEngine() {
 func (ptr *QHelpEngine) ContentModel() *QHelpContentModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQHelpContentModelFromPointer(C.QHelpEngine_ContentModel(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4120,7 +4243,7 @@ func (ptr *QHelpEngine) ContentModel() *QHelpContentModel {
 func (ptr *QHelpEngine) IndexModel() *QHelpIndexModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQHelpIndexModelFromPointer(C.QHelpEngine_IndexModel(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4170,7 +4293,7 @@ func NewQHelpEngineCore(collectionFile string, parent core.QObject_ITF) *QHelpEn
 	var collectionFileC = C.CString(collectionFile)
 	defer C.free(unsafe.Pointer(collectionFileC))
 	var tmpValue = NewQHelpEngineCoreFromPointer(C.QHelpEngineCore_NewQHelpEngineCore(collectionFileC, core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4180,7 +4303,7 @@ func (ptr *QHelpEngineCore) Files(namespaceName string, filterAttributes []strin
 	if ptr.Pointer() != nil {
 		var namespaceNameC = C.CString(namespaceName)
 		defer C.free(unsafe.Pointer(namespaceNameC))
-		var filterAttributesC = C.CString(strings.Join(filterAttributes, "|"))
+		var filterAttributesC = cGoPackStringList(filterAttributes)
 		defer C.free(unsafe.Pointer(filterAttributesC))
 		var extensionFilterC = C.CString(extensionFilter)
 		defer C.free(unsafe.Pointer(extensionFilterC))
@@ -4240,7 +4363,7 @@ func (ptr *QHelpEngineCore) AddCustomFilter(filterName string, attributes []stri
 	if ptr.Pointer() != nil {
 		var filterNameC = C.CString(filterName)
 		defer C.free(unsafe.Pointer(filterNameC))
-		var attributesC = C.CString(strings.Join(attributes, "|"))
+		var attributesC = cGoPackStringList(attributes)
 		defer C.free(unsafe.Pointer(attributesC))
 		return C.QHelpEngineCore_AddCustomFilter(ptr.Pointer(), filterNameC, attributesC) != 0
 	}
@@ -4310,7 +4433,7 @@ func (ptr *QHelpEngineCore) UnregisterDocumentation(namespaceName string) bool {
 
 //export callbackQHelpEngineCore_CurrentFilterChanged
 func callbackQHelpEngineCore_CurrentFilterChanged(ptr unsafe.Pointer, newFilter C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentFilterChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentFilterChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(newFilter))
 	}
 
@@ -4319,14 +4442,14 @@ func callbackQHelpEngineCore_CurrentFilterChanged(ptr unsafe.Pointer, newFilter
 func (ptr *QHelpEngineCore) ConnectCurrentFilterChanged(f func(newFilter string)) {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_ConnectCurrentFilterChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentFilterChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentFilterChanged", f)
 	}
 }
 
 func (ptr *QHelpEngineCore) DisconnectCurrentFilterChanged() {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_DisconnectCurrentFilterChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentFilterChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "currentFilterChanged")
 	}
 }
 
@@ -4340,7 +4463,7 @@ func (ptr *QHelpEngineCore) CurrentFilterChanged(newFilter string) {
 
 //export callbackQHelpEngineCore_ReadersAboutToBeInvalidated
 func callbackQHelpEngineCore_ReadersAboutToBeInvalidated(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readersAboutToBeInvalidated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readersAboutToBeInvalidated"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4349,14 +4472,14 @@ func callbackQHelpEngineCore_ReadersAboutToBeInvalidated(ptr unsafe.Pointer) {
 func (ptr *QHelpEngineCore) ConnectReadersAboutToBeInvalidated(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_ConnectReadersAboutToBeInvalidated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readersAboutToBeInvalidated", f)
+		qt.ConnectSignal(ptr.Pointer(), "readersAboutToBeInvalidated", f)
 	}
 }
 
 func (ptr *QHelpEngineCore) DisconnectReadersAboutToBeInvalidated() {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_DisconnectReadersAboutToBeInvalidated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readersAboutToBeInvalidated")
+		qt.DisconnectSignal(ptr.Pointer(), "readersAboutToBeInvalidated")
 	}
 }
 
@@ -4390,7 +4513,7 @@ func (ptr *QHelpEngineCore) SetCurrentFilter(filterName string) {
 
 //export callbackQHelpEngineCore_SetupFinished
 func callbackQHelpEngineCore_SetupFinished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setupFinished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setupFinished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4399,14 +4522,14 @@ func callbackQHelpEngineCore_SetupFinished(ptr unsafe.Pointer) {
 func (ptr *QHelpEngineCore) ConnectSetupFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_ConnectSetupFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setupFinished", f)
+		qt.ConnectSignal(ptr.Pointer(), "setupFinished", f)
 	}
 }
 
 func (ptr *QHelpEngineCore) DisconnectSetupFinished() {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_DisconnectSetupFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setupFinished")
+		qt.DisconnectSignal(ptr.Pointer(), "setupFinished")
 	}
 }
 
@@ -4418,7 +4541,7 @@ func (ptr *QHelpEngineCore) SetupFinished() {
 
 //export callbackQHelpEngineCore_SetupStarted
 func callbackQHelpEngineCore_SetupStarted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setupStarted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setupStarted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4427,14 +4550,14 @@ func callbackQHelpEngineCore_SetupStarted(ptr unsafe.Pointer) {
 func (ptr *QHelpEngineCore) ConnectSetupStarted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_ConnectSetupStarted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setupStarted", f)
+		qt.ConnectSignal(ptr.Pointer(), "setupStarted", f)
 	}
 }
 
 func (ptr *QHelpEngineCore) DisconnectSetupStarted() {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_DisconnectSetupStarted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setupStarted")
+		qt.DisconnectSignal(ptr.Pointer(), "setupStarted")
 	}
 }
 
@@ -4446,7 +4569,7 @@ func (ptr *QHelpEngineCore) SetupStarted() {
 
 //export callbackQHelpEngineCore_Warning
 func callbackQHelpEngineCore_Warning(ptr unsafe.Pointer, msg C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "warning"); signal != nil {
+	if signal := qt.GetSignal(ptr, "warning"); signal != nil {
 		signal.(func(string))(cGoUnpackString(msg))
 	}
 
@@ -4455,14 +4578,14 @@ func callbackQHelpEngineCore_Warning(ptr unsafe.Pointer, msg C.struct_QtHelp_Pac
 func (ptr *QHelpEngineCore) ConnectWarning(f func(msg string)) {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_ConnectWarning(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "warning", f)
+		qt.ConnectSignal(ptr.Pointer(), "warning", f)
 	}
 }
 
 func (ptr *QHelpEngineCore) DisconnectWarning() {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_DisconnectWarning(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "warning")
+		qt.DisconnectSignal(ptr.Pointer(), "warning")
 	}
 }
 
@@ -4476,7 +4599,7 @@ func (ptr *QHelpEngineCore) Warning(msg string) {
 
 //export callbackQHelpEngineCore_DestroyQHelpEngineCore
 func callbackQHelpEngineCore_DestroyQHelpEngineCore(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QHelpEngineCore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QHelpEngineCore"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpEngineCoreFromPointer(ptr).DestroyQHelpEngineCoreDefault()
@@ -4486,21 +4609,21 @@ func callbackQHelpEngineCore_DestroyQHelpEngineCore(ptr unsafe.Pointer) {
 func (ptr *QHelpEngineCore) ConnectDestroyQHelpEngineCore(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QHelpEngineCore", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QHelpEngineCore", f)
 	}
 }
 
 func (ptr *QHelpEngineCore) DisconnectDestroyQHelpEngineCore() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QHelpEngineCore")
+		qt.DisconnectSignal(ptr.Pointer(), "~QHelpEngineCore")
 	}
 }
 
 func (ptr *QHelpEngineCore) DestroyQHelpEngineCore() {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_DestroyQHelpEngineCore(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4508,7 +4631,7 @@ func (ptr *QHelpEngineCore) DestroyQHelpEngineCore() {
 func (ptr *QHelpEngineCore) DestroyQHelpEngineCoreDefault() {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_DestroyQHelpEngineCoreDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4560,14 +4683,14 @@ func (ptr *QHelpEngineCore) Error() string {
 
 func (ptr *QHelpEngineCore) CustomFilters() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QHelpEngineCore_CustomFilters(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QHelpEngineCore_CustomFilters(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QHelpEngineCore) FilterAttributes() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QHelpEngineCore_FilterAttributes(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QHelpEngineCore_FilterAttributes(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -4576,14 +4699,14 @@ func (ptr *QHelpEngineCore) FilterAttributes2(filterName string) []string {
 	if ptr.Pointer() != nil {
 		var filterNameC = C.CString(filterName)
 		defer C.free(unsafe.Pointer(filterNameC))
-		return strings.Split(cGoUnpackString(C.QHelpEngineCore_FilterAttributes2(ptr.Pointer(), filterNameC)), "|")
+		return cGoUnpackStringListAndFree(C.QHelpEngineCore_FilterAttributes2(ptr.Pointer(), filterNameC))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QHelpEngineCore) RegisteredDocumentations() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QHelpEngineCore_RegisteredDocumentations(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QHelpEngineCore_RegisteredDocumentations(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -4636,14 +4759,14 @@ func (ptr *QHelpEngineCore) __files_newList() unsafe.Pointer {
 
 func (ptr *QHelpEngineCore) __filterAttributeSets_atList(i int) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QHelpEngineCore___filterAttributeSets_atList(ptr.Pointer(), C.int(int32(i)))), "|")
+		return cGoUnpackStringListAndFree(C.QHelpEngineCore___filterAttributeSets_atList(ptr.Pointer(), C.int(int32(i))))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QHelpEngineCore) __filterAttributeSets_setList(i []string) {
 	if ptr.Pointer() != nil {
-		var iC = C.CString(strings.Join(i, "|"))
+		var iC = cGoPackStringList(i)
 		defer C.free(unsafe.Pointer(iC))
 		C.QHelpEngineCore___filterAttributeSets_setList(ptr.Pointer(), iC)
 	}
@@ -4730,7 +4853,7 @@ func (ptr *QHelpEngineCore) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QHelpEngineCore) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpEngineCore___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4751,7 +4874,7 @@ func (ptr *QHelpEngineCore) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QHelpEngineCore) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpEngineCore___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4772,7 +4895,7 @@ func (ptr *QHelpEngineCore) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QHelpEngineCore) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpEngineCore___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4793,7 +4916,7 @@ func (ptr *QHelpEngineCore) __findChildren_newList() unsafe.Pointer {
 func (ptr *QHelpEngineCore) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpEngineCore___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4813,7 +4936,7 @@ func (ptr *QHelpEngineCore) __children_newList() unsafe.Pointer {
 
 //export callbackQHelpEngineCore_Event
 func callbackQHelpEngineCore_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -4829,7 +4952,7 @@ func (ptr *QHelpEngineCore) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQHelpEngineCore_EventFilter
 func callbackQHelpEngineCore_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -4845,7 +4968,7 @@ func (ptr *QHelpEngineCore) EventFilterDefault(watched core.QObject_ITF, event c
 
 //export callbackQHelpEngineCore_ChildEvent
 func callbackQHelpEngineCore_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQHelpEngineCoreFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -4860,7 +4983,7 @@ func (ptr *QHelpEngineCore) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQHelpEngineCore_ConnectNotify
 func callbackQHelpEngineCore_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpEngineCoreFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4875,7 +4998,7 @@ func (ptr *QHelpEngineCore) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHelpEngineCore_CustomEvent
 func callbackQHelpEngineCore_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpEngineCoreFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -4890,7 +5013,7 @@ func (ptr *QHelpEngineCore) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpEngineCore_DeleteLater
 func callbackQHelpEngineCore_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpEngineCoreFromPointer(ptr).DeleteLaterDefault()
@@ -4900,14 +5023,14 @@ func callbackQHelpEngineCore_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QHelpEngineCore) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QHelpEngineCore_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHelpEngineCore_Destroyed
 func callbackQHelpEngineCore_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -4915,7 +5038,7 @@ func callbackQHelpEngineCore_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQHelpEngineCore_DisconnectNotify
 func callbackQHelpEngineCore_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpEngineCoreFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4930,7 +5053,7 @@ func (ptr *QHelpEngineCore) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHelpEngineCore_ObjectNameChanged
 func callbackQHelpEngineCore_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -4938,7 +5061,7 @@ func callbackQHelpEngineCore_ObjectNameChanged(ptr unsafe.Pointer, objectName C.
 
 //export callbackQHelpEngineCore_TimerEvent
 func callbackQHelpEngineCore_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQHelpEngineCoreFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -4953,7 +5076,7 @@ func (ptr *QHelpEngineCore) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQHelpEngineCore_MetaObject
 func callbackQHelpEngineCore_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -5009,7 +5132,7 @@ func NewQHelpIndexModelFromPointer(ptr unsafe.Pointer) *QHelpIndexModel {
 func (ptr *QHelpIndexModel) DestroyQHelpIndexModel() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5037,7 +5160,7 @@ func (ptr *QHelpIndexModel) CreateIndex(customFilterName string) {
 
 //export callbackQHelpIndexModel_IndexCreated
 func callbackQHelpIndexModel_IndexCreated(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexCreated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexCreated"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5046,14 +5169,14 @@ func callbackQHelpIndexModel_IndexCreated(ptr unsafe.Pointer) {
 func (ptr *QHelpIndexModel) ConnectIndexCreated(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexModel_ConnectIndexCreated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "indexCreated", f)
+		qt.ConnectSignal(ptr.Pointer(), "indexCreated", f)
 	}
 }
 
 func (ptr *QHelpIndexModel) DisconnectIndexCreated() {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexModel_DisconnectIndexCreated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "indexCreated")
+		qt.DisconnectSignal(ptr.Pointer(), "indexCreated")
 	}
 }
 
@@ -5065,7 +5188,7 @@ func (ptr *QHelpIndexModel) IndexCreated() {
 
 //export callbackQHelpIndexModel_IndexCreationStarted
 func callbackQHelpIndexModel_IndexCreationStarted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexCreationStarted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexCreationStarted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5074,14 +5197,14 @@ func callbackQHelpIndexModel_IndexCreationStarted(ptr unsafe.Pointer) {
 func (ptr *QHelpIndexModel) ConnectIndexCreationStarted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexModel_ConnectIndexCreationStarted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "indexCreationStarted", f)
+		qt.ConnectSignal(ptr.Pointer(), "indexCreationStarted", f)
 	}
 }
 
 func (ptr *QHelpIndexModel) DisconnectIndexCreationStarted() {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexModel_DisconnectIndexCreationStarted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "indexCreationStarted")
+		qt.DisconnectSignal(ptr.Pointer(), "indexCreationStarted")
 	}
 }
 
@@ -5185,6 +5308,16 @@ func (ptr *QHelpIndexModel) ____setItemData_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpIndexModel_____setItemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpIndexModel) ____setItemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpIndexModel_____setItemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpIndexModel) ____setItemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpIndexModel_____setItemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpIndexModel) ____roleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QHelpIndexModel_____roleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -5202,6 +5335,16 @@ func (ptr *QHelpIndexModel) ____roleNames_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpIndexModel_____roleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpIndexModel) ____roleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpIndexModel_____roleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpIndexModel) ____roleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpIndexModel_____roleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpIndexModel) ____itemData_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QHelpIndexModel_____itemData_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -5219,6 +5362,16 @@ func (ptr *QHelpIndexModel) ____itemData_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpIndexModel_____itemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpIndexModel) ____itemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpIndexModel_____itemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpIndexModel) ____itemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpIndexModel_____itemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpIndexModel) __setItemData_roles_atList(i int) *core.QVariant {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQVariantFromPointer(C.QHelpIndexModel___setItemData_roles_atList(ptr.Pointer(), C.int(int32(i))))
@@ -5242,8 +5395,10 @@ func (ptr *QHelpIndexModel) __setItemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpIndexModelFromPointer(l.data).____setItemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpIndexModelFromPointer(l.data).____setItemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QHelpIndexModel___setItemData_keyList(ptr.Pointer()))
@@ -5306,6 +5461,16 @@ func (ptr *QHelpIndexModel) __dataChanged_roles_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpIndexModel___dataChanged_roles_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpIndexModel) __dataChanged_roles_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpIndexModel___dataChanged_roles_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpIndexModel) __dataChanged_roles_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpIndexModel___dataChanged_roles_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpIndexModel) __layoutAboutToBeChanged_parents_atList(i int) *core.QPersistentModelIndex {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPersistentModelIndexFromPointer(C.QHelpIndexModel___layoutAboutToBeChanged_parents_atList(ptr.Pointer(), C.int(int32(i))))
@@ -5367,8 +5532,10 @@ func (ptr *QHelpIndexModel) __roleNames_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpIndexModelFromPointer(l.data).____roleNames_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpIndexModelFromPointer(l.data).____roleNames_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QHelpIndexModel___roleNames_keyList(ptr.Pointer()))
@@ -5399,8 +5566,10 @@ func (ptr *QHelpIndexModel) __itemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpIndexModelFromPointer(l.data).____itemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpIndexModelFromPointer(l.data).____itemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QHelpIndexModel___itemData_keyList(ptr.Pointer()))
@@ -5482,6 +5651,16 @@ func (ptr *QHelpIndexModel) ____doSetRoleNames_keyList_newList() unsafe.Pointer
 	return unsafe.Pointer(C.QHelpIndexModel_____doSetRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpIndexModel) ____doSetRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpIndexModel_____doSetRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpIndexModel) ____doSetRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpIndexModel_____doSetRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpIndexModel) ____setRoleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QHelpIndexModel_____setRoleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -5499,6 +5678,16 @@ func (ptr *QHelpIndexModel) ____setRoleNames_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpIndexModel_____setRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpIndexModel) ____setRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpIndexModel_____setRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpIndexModel) ____setRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpIndexModel_____setRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpIndexModel) __dynamicPropertyNames_atList(i int) *core.QByteArray {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQByteArrayFromPointer(C.QHelpIndexModel___dynamicPropertyNames_atList(ptr.Pointer(), C.int(int32(i))))
@@ -5521,7 +5710,7 @@ func (ptr *QHelpIndexModel) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QHelpIndexModel) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpIndexModel___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5542,7 +5731,7 @@ func (ptr *QHelpIndexModel) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QHelpIndexModel) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpIndexModel___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5563,7 +5752,7 @@ func (ptr *QHelpIndexModel) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QHelpIndexModel) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpIndexModel___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5584,7 +5773,7 @@ func (ptr *QHelpIndexModel) __findChildren_newList() unsafe.Pointer {
 func (ptr *QHelpIndexModel) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpIndexModel___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5604,7 +5793,7 @@ func (ptr *QHelpIndexModel) __children_newList() unsafe.Pointer {
 
 //export callbackQHelpIndexModel_InsertRows
 func callbackQHelpIndexModel_InsertRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(row)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -5620,7 +5809,7 @@ func (ptr *QHelpIndexModel) InsertRowsDefault(row int, count int, parent core.QM
 
 //export callbackQHelpIndexModel_RemoveRows
 func callbackQHelpIndexModel_RemoveRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(row)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -5636,7 +5825,7 @@ func (ptr *QHelpIndexModel) RemoveRowsDefault(row int, count int, parent core.QM
 
 //export callbackQHelpIndexModel_SetData
 func callbackQHelpIndexModel_SetData(ptr unsafe.Pointer, index unsafe.Pointer, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, *core.QVariant, int) bool)(core.NewQModelIndexFromPointer(index), core.NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -5652,7 +5841,7 @@ func (ptr *QHelpIndexModel) SetDataDefault(index core.QModelIndex_ITF, value cor
 
 //export callbackQHelpIndexModel_Sort
 func callbackQHelpIndexModel_Sort(ptr unsafe.Pointer, column C.int, order C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sort"); signal != nil {
 		signal.(func(int, core.Qt__SortOrder))(int(int32(column)), core.Qt__SortOrder(order))
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).SortDefault(int(int32(column)), core.Qt__SortOrder(order))
@@ -5667,7 +5856,7 @@ func (ptr *QHelpIndexModel) SortDefault(column int, order core.Qt__SortOrder) {
 
 //export callbackQHelpIndexModel_Sibling
 func callbackQHelpIndexModel_Sibling(ptr unsafe.Pointer, row C.int, column C.int, idx unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sibling"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sibling"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(int, int, *core.QModelIndex) *core.QModelIndex)(int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(idx)))
 	}
 
@@ -5684,12 +5873,18 @@ func (ptr *QHelpIndexModel) SiblingDefault(row int, column int, idx core.QModelI
 }
 
 //export callbackQHelpIndexModel_Data
-func callbackQHelpIndexModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
-		return core.PointerFromQVariant(signal.(func(*core.QModelIndex, int) *core.QVariant)(core.NewQModelIndexFromPointer(index), int(int32(role))))
+func callbackQHelpIndexModel_Data(ptr unsafe.Pointer, index unsafe.Pointer, role C.int, ret unsafe.Pointer) {
+	if signal := qt.GetSignal(ptr, "dataInto"); signal != nil {
+		signal.(func(*core.QModelIndex, int, *core.QVariant))(core.NewQModelIndexFromPointer(index), int(int32(role)), core.NewQVariantFromPointer(ret))
+		return
+	}
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
+		var tmpValue = signal.(func(*core.QModelIndex, int) *core.QVariant)(core.NewQModelIndexFromPointer(index), int(int32(role)))
+		core.NewQVariantFromPointer(ret).Assign(tmpValue)
+		return
 	}
 
-	return core.PointerFromQVariant(NewQHelpIndexModelFromPointer(ptr).DataDefault(core.NewQModelIndexFromPointer(index), int(int32(role))))
+	C.QHelpIndexModel_DataDefaultInto(ptr, index, role, ret)
 }
 
 func (ptr *QHelpIndexModel) DataDefault(index core.QModelIndex_ITF, role int) *core.QVariant {
@@ -5703,7 +5898,7 @@ func (ptr *QHelpIndexModel) DataDefault(index core.QModelIndex_ITF, role int) *c
 
 //export callbackQHelpIndexModel_SupportedDropActions
 func callbackQHelpIndexModel_SupportedDropActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDropActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDropActions"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__DropAction)())
 	}
 
@@ -5719,7 +5914,7 @@ func (ptr *QHelpIndexModel) SupportedDropActionsDefault() core.Qt__DropAction {
 
 //export callbackQHelpIndexModel_Flags
 func callbackQHelpIndexModel_Flags(ptr unsafe.Pointer, index unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flags"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flags"); signal != nil {
 		return C.longlong(signal.(func(*core.QModelIndex) core.Qt__ItemFlag)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -5735,7 +5930,7 @@ func (ptr *QHelpIndexModel) FlagsDefault(index core.QModelIndex_ITF) core.Qt__It
 
 //export callbackQHelpIndexModel_RowCount
 func callbackQHelpIndexModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*core.QModelIndex) int)(core.NewQModelIndexFromPointer(parent))))
 	}
 
@@ -5751,7 +5946,7 @@ func (ptr *QHelpIndexModel) RowCountDefault(parent core.QModelIndex_ITF) int {
 
 //export callbackQHelpIndexModel_DropMimeData
 func callbackQHelpIndexModel_DropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QMimeData, core.Qt__DropAction, int, int, *core.QModelIndex) bool)(core.NewQMimeDataFromPointer(data), core.Qt__DropAction(action), int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -5767,7 +5962,7 @@ func (ptr *QHelpIndexModel) DropMimeDataDefault(data core.QMimeData_ITF, action
 
 //export callbackQHelpIndexModel_Index
 func callbackQHelpIndexModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(int, int, *core.QModelIndex) *core.QModelIndex)(int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))
 	}
 
@@ -5785,7 +5980,7 @@ func (ptr *QHelpIndexModel) IndexDefault(row int, column int, parent core.QModel
 
 //export callbackQHelpIndexModel_InsertColumns
 func callbackQHelpIndexModel_InsertColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(column)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -5801,7 +5996,7 @@ func (ptr *QHelpIndexModel) InsertColumnsDefault(column int, count int, parent c
 
 //export callbackQHelpIndexModel_MoveColumns
 func callbackQHelpIndexModel_MoveColumns(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceColumn C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int) bool)(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceColumn)), int(int32(count)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -5817,7 +6012,7 @@ func (ptr *QHelpIndexModel) MoveColumnsDefault(sourceParent core.QModelIndex_ITF
 
 //export callbackQHelpIndexModel_MoveRows
 func callbackQHelpIndexModel_MoveRows(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceRow C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int) bool)(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceRow)), int(int32(count)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -5833,7 +6028,7 @@ func (ptr *QHelpIndexModel) MoveRowsDefault(sourceParent core.QModelIndex_ITF, s
 
 //export callbackQHelpIndexModel_RemoveColumns
 func callbackQHelpIndexModel_RemoveColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(column)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -5849,7 +6044,7 @@ func (ptr *QHelpIndexModel) RemoveColumnsDefault(column int, count int, parent c
 
 //export callbackQHelpIndexModel_SetHeaderData
 func callbackQHelpIndexModel_SetHeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHeaderData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHeaderData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, core.Qt__Orientation, *core.QVariant, int) bool)(int(int32(section)), core.Qt__Orientation(orientation), core.NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -5865,7 +6060,7 @@ func (ptr *QHelpIndexModel) SetHeaderDataDefault(section int, orientation core.Q
 
 //export callbackQHelpIndexModel_SetItemData
 func callbackQHelpIndexModel_SetItemData(ptr unsafe.Pointer, index unsafe.Pointer, roles C.struct_QtHelp_PackedList) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setItemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setItemData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, map[int]*core.QVariant) bool)(core.NewQModelIndexFromPointer(index), func(l C.struct_QtHelp_PackedList) map[int]*core.QVariant {
 			var out = make(map[int]*core.QVariant, int(l.len))
 			for _, i := range NewQHelpIndexModelFromPointer(l.data).__setItemData_keyList() {
@@ -5899,7 +6094,7 @@ func (ptr *QHelpIndexModel) SetItemDataDefault(index core.QModelIndex_ITF, roles
 
 //export callbackQHelpIndexModel_Submit
 func callbackQHelpIndexModel_Submit(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "submit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "submit"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5915,7 +6110,7 @@ func (ptr *QHelpIndexModel) SubmitDefault() bool {
 
 //export callbackQHelpIndexModel_ColumnsAboutToBeInserted
 func callbackQHelpIndexModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -5923,7 +6118,7 @@ func callbackQHelpIndexModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, parent
 
 //export callbackQHelpIndexModel_ColumnsAboutToBeMoved
 func callbackQHelpIndexModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationColumn C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationColumn)))
 	}
 
@@ -5931,7 +6126,7 @@ func callbackQHelpIndexModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, sourcePar
 
 //export callbackQHelpIndexModel_ColumnsAboutToBeRemoved
 func callbackQHelpIndexModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -5939,7 +6134,7 @@ func callbackQHelpIndexModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, parent
 
 //export callbackQHelpIndexModel_ColumnsInserted
 func callbackQHelpIndexModel_ColumnsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -5947,7 +6142,7 @@ func callbackQHelpIndexModel_ColumnsInserted(ptr unsafe.Pointer, parent unsafe.P
 
 //export callbackQHelpIndexModel_ColumnsMoved
 func callbackQHelpIndexModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, column C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), core.NewQModelIndexFromPointer(destination), int(int32(column)))
 	}
 
@@ -5955,7 +6150,7 @@ func callbackQHelpIndexModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.Poin
 
 //export callbackQHelpIndexModel_ColumnsRemoved
 func callbackQHelpIndexModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -5963,11 +6158,13 @@ func callbackQHelpIndexModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe.Po
 
 //export callbackQHelpIndexModel_DataChanged
 func callbackQHelpIndexModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Pointer, bottomRight unsafe.Pointer, roles C.struct_QtHelp_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataChanged"); signal != nil {
 		signal.(func(*core.QModelIndex, *core.QModelIndex, []int))(core.NewQModelIndexFromPointer(topLeft), core.NewQModelIndexFromPointer(bottomRight), func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpIndexModelFromPointer(l.data).__dataChanged_roles_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpIndexModelFromPointer(l.data).__dataChanged_roles_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(roles))
@@ -5977,7 +6174,7 @@ func callbackQHelpIndexModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Poin
 
 //export callbackQHelpIndexModel_FetchMore
 func callbackQHelpIndexModel_FetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchMore"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(parent))
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).FetchMoreDefault(core.NewQModelIndexFromPointer(parent))
@@ -5992,7 +6189,7 @@ func (ptr *QHelpIndexModel) FetchMoreDefault(parent core.QModelIndex_ITF) {
 
 //export callbackQHelpIndexModel_HeaderDataChanged
 func callbackQHelpIndexModel_HeaderDataChanged(ptr unsafe.Pointer, orientation C.longlong, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerDataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerDataChanged"); signal != nil {
 		signal.(func(core.Qt__Orientation, int, int))(core.Qt__Orientation(orientation), int(int32(first)), int(int32(last)))
 	}
 
@@ -6000,7 +6197,7 @@ func callbackQHelpIndexModel_HeaderDataChanged(ptr unsafe.Pointer, orientation C
 
 //export callbackQHelpIndexModel_LayoutAboutToBeChanged
 func callbackQHelpIndexModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, parents C.struct_QtHelp_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutAboutToBeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutAboutToBeChanged"); signal != nil {
 		signal.(func([]*core.QPersistentModelIndex, core.QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtHelp_PackedList) []*core.QPersistentModelIndex {
 			var out = make([]*core.QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -6014,7 +6211,7 @@ func callbackQHelpIndexModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, parents
 
 //export callbackQHelpIndexModel_LayoutChanged
 func callbackQHelpIndexModel_LayoutChanged(ptr unsafe.Pointer, parents C.struct_QtHelp_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutChanged"); signal != nil {
 		signal.(func([]*core.QPersistentModelIndex, core.QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtHelp_PackedList) []*core.QPersistentModelIndex {
 			var out = make([]*core.QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -6028,7 +6225,7 @@ func callbackQHelpIndexModel_LayoutChanged(ptr unsafe.Pointer, parents C.struct_
 
 //export callbackQHelpIndexModel_ModelAboutToBeReset
 func callbackQHelpIndexModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelAboutToBeReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelAboutToBeReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6036,7 +6233,7 @@ func callbackQHelpIndexModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
 
 //export callbackQHelpIndexModel_ModelReset
 func callbackQHelpIndexModel_ModelReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6044,7 +6241,7 @@ func callbackQHelpIndexModel_ModelReset(ptr unsafe.Pointer) {
 
 //export callbackQHelpIndexModel_ResetInternalData
 func callbackQHelpIndexModel_ResetInternalData(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resetInternalData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resetInternalData"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).ResetInternalDataDefault()
@@ -6059,7 +6256,7 @@ func (ptr *QHelpIndexModel) ResetInternalDataDefault() {
 
 //export callbackQHelpIndexModel_Revert
 func callbackQHelpIndexModel_Revert(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "revert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "revert"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).RevertDefault()
@@ -6074,7 +6271,7 @@ func (ptr *QHelpIndexModel) RevertDefault() {
 
 //export callbackQHelpIndexModel_RowsAboutToBeInserted
 func callbackQHelpIndexModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	}
 
@@ -6082,7 +6279,7 @@ func callbackQHelpIndexModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent un
 
 //export callbackQHelpIndexModel_RowsAboutToBeMoved
 func callbackQHelpIndexModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationRow C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationRow)))
 	}
 
@@ -6090,7 +6287,7 @@ func callbackQHelpIndexModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourceParent
 
 //export callbackQHelpIndexModel_RowsAboutToBeRemoved
 func callbackQHelpIndexModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -6098,7 +6295,7 @@ func callbackQHelpIndexModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent uns
 
 //export callbackQHelpIndexModel_RowsInserted
 func callbackQHelpIndexModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -6106,7 +6303,7 @@ func callbackQHelpIndexModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.Poin
 
 //export callbackQHelpIndexModel_RowsMoved
 func callbackQHelpIndexModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, row C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), core.NewQModelIndexFromPointer(destination), int(int32(row)))
 	}
 
@@ -6114,7 +6311,7 @@ func callbackQHelpIndexModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Pointer
 
 //export callbackQHelpIndexModel_RowsRemoved
 func callbackQHelpIndexModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -6122,7 +6319,7 @@ func callbackQHelpIndexModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Point
 
 //export callbackQHelpIndexModel_RoleNames
 func callbackQHelpIndexModel_RoleNames(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "roleNames"); signal != nil {
+	if signal := qt.GetSignal(ptr, "roleNames"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQHelpIndexModelFromPointer(NewQHelpIndexModelFromPointer(nil).__roleNames_newList())
 			for k, v := range signal.(func() map[int]*core.QByteArray)() {
@@ -6156,7 +6353,7 @@ func (ptr *QHelpIndexModel) RoleNamesDefault() map[int]*core.QByteArray {
 
 //export callbackQHelpIndexModel_ItemData
 func callbackQHelpIndexModel_ItemData(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemData"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQHelpIndexModelFromPointer(NewQHelpIndexModelFromPointer(nil).__itemData_newList())
 			for k, v := range signal.(func(*core.QModelIndex) map[int]*core.QVariant)(core.NewQModelIndexFromPointer(index)) {
@@ -6190,7 +6387,7 @@ func (ptr *QHelpIndexModel) ItemDataDefault(index core.QModelIndex_ITF) map[int]
 
 //export callbackQHelpIndexModel_MimeData
 func callbackQHelpIndexModel_MimeData(ptr unsafe.Pointer, indexes C.struct_QtHelp_PackedList) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mimeData"); signal != nil {
 		return core.PointerFromQMimeData(signal.(func([]*core.QModelIndex) *core.QMimeData)(func(l C.struct_QtHelp_PackedList) []*core.QModelIndex {
 			var out = make([]*core.QModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -6218,7 +6415,7 @@ func (ptr *QHelpIndexModel) MimeDataDefault(indexes []*core.QModelIndex) *core.Q
 			}
 			return tmpList.Pointer()
 		}()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6228,7 +6425,7 @@ func (ptr *QHelpIndexModel) MimeDataDefault(indexes []*core.QModelIndex) *core.Q
 
 //export callbackQHelpIndexModel_Buddy
 func callbackQHelpIndexModel_Buddy(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buddy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buddy"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QModelIndex) *core.QModelIndex)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -6246,7 +6443,7 @@ func (ptr *QHelpIndexModel) BuddyDefault(index core.QModelIndex_ITF) *core.QMode
 
 //export callbackQHelpIndexModel_Parent
 func callbackQHelpIndexModel_Parent(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QModelIndex) *core.QModelIndex)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -6264,7 +6461,7 @@ func (ptr *QHelpIndexModel) ParentDefault(index core.QModelIndex_ITF) *core.QMod
 
 //export callbackQHelpIndexModel_Match
 func callbackQHelpIndexModel_Match(ptr unsafe.Pointer, start unsafe.Pointer, role C.int, value unsafe.Pointer, hits C.int, flags C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "match"); signal != nil {
+	if signal := qt.GetSignal(ptr, "match"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQHelpIndexModelFromPointer(NewQHelpIndexModelFromPointer(nil).__match_newList())
 			for _, v := range signal.(func(*core.QModelIndex, int, *core.QVariant, int, core.Qt__MatchFlag) []*core.QModelIndex)(core.NewQModelIndexFromPointer(start), int(int32(role)), core.NewQVariantFromPointer(value), int(int32(hits)), core.Qt__MatchFlag(flags)) {
@@ -6298,7 +6495,7 @@ func (ptr *QHelpIndexModel) MatchDefault(start core.QModelIndex_ITF, role int, v
 
 //export callbackQHelpIndexModel_Span
 func callbackQHelpIndexModel_Span(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "span"); signal != nil {
+	if signal := qt.GetSignal(ptr, "span"); signal != nil {
 		return core.PointerFromQSize(signal.(func(*core.QModelIndex) *core.QSize)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -6316,23 +6513,23 @@ func (ptr *QHelpIndexModel) SpanDefault(index core.QModelIndex_ITF) *core.QSize
 
 //export callbackQHelpIndexModel_MimeTypes
 func callbackQHelpIndexModel_MimeTypes(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeTypes"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "mimeTypes"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(NewQHelpIndexModelFromPointer(ptr).MimeTypesDefault(), "|"))
+	return cGoPackStringList(NewQHelpIndexModelFromPointer(ptr).MimeTypesDefault())
 }
 
 func (ptr *QHelpIndexModel) MimeTypesDefault() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QHelpIndexModel_MimeTypesDefault(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QHelpIndexModel_MimeTypesDefault(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQHelpIndexModel_HeaderData
 func callbackQHelpIndexModel_HeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerData"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(int, core.Qt__Orientation, int) *core.QVariant)(int(int32(section)), core.Qt__Orientation(orientation), int(int32(role))))
 	}
 
@@ -6350,7 +6547,7 @@ func (ptr *QHelpIndexModel) HeaderDataDefault(section int, orientation core.Qt__
 
 //export callbackQHelpIndexModel_SupportedDragActions
 func callbackQHelpIndexModel_SupportedDragActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDragActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDragActions"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__DropAction)())
 	}
 
@@ -6366,7 +6563,7 @@ func (ptr *QHelpIndexModel) SupportedDragActionsDefault() core.Qt__DropAction {
 
 //export callbackQHelpIndexModel_CanDropMimeData
 func callbackQHelpIndexModel_CanDropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canDropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canDropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QMimeData, core.Qt__DropAction, int, int, *core.QModelIndex) bool)(core.NewQMimeDataFromPointer(data), core.Qt__DropAction(action), int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -6382,7 +6579,7 @@ func (ptr *QHelpIndexModel) CanDropMimeDataDefault(data core.QMimeData_ITF, acti
 
 //export callbackQHelpIndexModel_CanFetchMore
 func callbackQHelpIndexModel_CanFetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canFetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canFetchMore"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -6398,7 +6595,7 @@ func (ptr *QHelpIndexModel) CanFetchMoreDefault(parent core.QModelIndex_ITF) boo
 
 //export callbackQHelpIndexModel_HasChildren
 func callbackQHelpIndexModel_HasChildren(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasChildren"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasChildren"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -6414,7 +6611,7 @@ func (ptr *QHelpIndexModel) HasChildrenDefault(parent core.QModelIndex_ITF) bool
 
 //export callbackQHelpIndexModel_ColumnCount
 func callbackQHelpIndexModel_ColumnCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*core.QModelIndex) int)(core.NewQModelIndexFromPointer(parent))))
 	}
 
@@ -6430,7 +6627,7 @@ func (ptr *QHelpIndexModel) ColumnCountDefault(parent core.QModelIndex_ITF) int
 
 //export callbackQHelpIndexModel_Event
 func callbackQHelpIndexModel_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -6446,7 +6643,7 @@ func (ptr *QHelpIndexModel) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQHelpIndexModel_EventFilter
 func callbackQHelpIndexModel_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -6462,7 +6659,7 @@ func (ptr *QHelpIndexModel) EventFilterDefault(watched core.QObject_ITF, event c
 
 //export callbackQHelpIndexModel_ChildEvent
 func callbackQHelpIndexModel_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -6477,7 +6674,7 @@ func (ptr *QHelpIndexModel) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQHelpIndexModel_ConnectNotify
 func callbackQHelpIndexModel_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6492,7 +6689,7 @@ func (ptr *QHelpIndexModel) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHelpIndexModel_CustomEvent
 func callbackQHelpIndexModel_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -6507,7 +6704,7 @@ func (ptr *QHelpIndexModel) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpIndexModel_DeleteLater
 func callbackQHelpIndexModel_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).DeleteLaterDefault()
@@ -6517,14 +6714,14 @@ func callbackQHelpIndexModel_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QHelpIndexModel) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexModel_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHelpIndexModel_Destroyed
 func callbackQHelpIndexModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -6532,7 +6729,7 @@ func callbackQHelpIndexModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQHelpIndexModel_DisconnectNotify
 func callbackQHelpIndexModel_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6547,7 +6744,7 @@ func (ptr *QHelpIndexModel) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHelpIndexModel_ObjectNameChanged
 func callbackQHelpIndexModel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -6555,7 +6752,7 @@ func callbackQHelpIndexModel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.
 
 //export callbackQHelpIndexModel_TimerEvent
 func callbackQHelpIndexModel_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQHelpIndexModelFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -6570,7 +6767,7 @@ func (ptr *QHelpIndexModel) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQHelpIndexModel_MetaObject
 func callbackQHelpIndexModel_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -6626,14 +6823,14 @@ func NewQHelpIndexWidgetFromPointer(ptr unsafe.Pointer) *QHelpIndexWidget {
 func (ptr *QHelpIndexWidget) DestroyQHelpIndexWidget() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHelpIndexWidget_ActivateCurrentItem
 func callbackQHelpIndexWidget_ActivateCurrentItem(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activateCurrentItem"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activateCurrentItem"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ActivateCurrentItemDefault()
@@ -6643,14 +6840,14 @@ func callbackQHelpIndexWidget_ActivateCurrentItem(ptr unsafe.Pointer) {
 func (ptr *QHelpIndexWidget) ConnectActivateCurrentItem(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activateCurrentItem", f)
+		qt.ConnectSignal(ptr.Pointer(), "activateCurrentItem", f)
 	}
 }
 
 func (ptr *QHelpIndexWidget) DisconnectActivateCurrentItem() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activateCurrentItem")
+		qt.DisconnectSignal(ptr.Pointer(), "activateCurrentItem")
 	}
 }
 
@@ -6668,7 +6865,7 @@ func (ptr *QHelpIndexWidget) ActivateCurrentItemDefault() {
 
 //export callbackQHelpIndexWidget_FilterIndices
 func callbackQHelpIndexWidget_FilterIndices(ptr unsafe.Pointer, filter C.struct_QtHelp_PackedString, wildcard C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filterIndices"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filterIndices"); signal != nil {
 		signal.(func(string, string))(cGoUnpackString(filter), cGoUnpackString(wildcard))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).FilterIndicesDefault(cGoUnpackString(filter), cGoUnpackString(wildcard))
@@ -6678,14 +6875,14 @@ func callbackQHelpIndexWidget_FilterIndices(ptr unsafe.Pointer, filter C.struct_
 func (ptr *QHelpIndexWidget) ConnectFilterIndices(f func(filter string, wildcard string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filterIndices", f)
+		qt.ConnectSignal(ptr.Pointer(), "filterIndices", f)
 	}
 }
 
 func (ptr *QHelpIndexWidget) DisconnectFilterIndices() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filterIndices")
+		qt.DisconnectSignal(ptr.Pointer(), "filterIndices")
 	}
 }
 
@@ -6711,7 +6908,7 @@ func (ptr *QHelpIndexWidget) FilterIndicesDefault(filter string, wildcard string
 
 //export callbackQHelpIndexWidget_LinkActivated
 func callbackQHelpIndexWidget_LinkActivated(ptr unsafe.Pointer, link unsafe.Pointer, keyword C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "linkActivated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "linkActivated"); signal != nil {
 		signal.(func(*core.QUrl, string))(core.NewQUrlFromPointer(link), cGoUnpackString(keyword))
 	}
 
@@ -6720,14 +6917,14 @@ func callbackQHelpIndexWidget_LinkActivated(ptr unsafe.Pointer, link unsafe.Poin
 func (ptr *QHelpIndexWidget) ConnectLinkActivated(f func(link *core.QUrl, keyword string)) {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexWidget_ConnectLinkActivated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "linkActivated", f)
+		qt.ConnectSignal(ptr.Pointer(), "linkActivated", f)
 	}
 }
 
 func (ptr *QHelpIndexWidget) DisconnectLinkActivated() {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexWidget_DisconnectLinkActivated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "linkActivated")
+		qt.DisconnectSignal(ptr.Pointer(), "linkActivated")
 	}
 }
 
@@ -6741,7 +6938,7 @@ func (ptr *QHelpIndexWidget) LinkActivated(link core.QUrl_ITF, keyword string) {
 
 //export callbackQHelpIndexWidget_LinksActivated
 func callbackQHelpIndexWidget_LinksActivated(ptr unsafe.Pointer, links C.struct_QtHelp_PackedList, keyword C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "linksActivated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "linksActivated"); signal != nil {
 		signal.(func(map[string]*core.QUrl, string))(func(l C.struct_QtHelp_PackedList) map[string]*core.QUrl {
 			var out = make(map[string]*core.QUrl, int(l.len))
 			for _, i := range NewQHelpIndexWidgetFromPointer(l.data).__linksActivated_keyList() {
@@ -6756,14 +6953,14 @@ func callbackQHelpIndexWidget_LinksActivated(ptr unsafe.Pointer, links C.struct_
 func (ptr *QHelpIndexWidget) ConnectLinksActivated(f func(links map[string]*core.QUrl, keyword string)) {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexWidget_ConnectLinksActivated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "linksActivated", f)
+		qt.ConnectSignal(ptr.Pointer(), "linksActivated", f)
 	}
 }
 
 func (ptr *QHelpIndexWidget) DisconnectLinksActivated() {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexWidget_DisconnectLinksActivated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "linksActivated")
+		qt.DisconnectSignal(ptr.Pointer(), "linksActivated")
 	}
 }
 
@@ -6853,6 +7050,16 @@ func (ptr *QHelpIndexWidget) __dataChanged_roles_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QHelpIndexWidget___dataChanged_roles_newList(ptr.Pointer()))
 }
 
+func (ptr *QHelpIndexWidget) __dataChanged_roles_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QHelpIndexWidget___dataChanged_roles_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QHelpIndexWidget) __dataChanged_roles_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QHelpIndexWidget___dataChanged_roles_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QHelpIndexWidget) __indexesMoved_indexes_atList(i int) *core.QModelIndex {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQModelIndexFromPointer(C.QHelpIndexWidget___indexesMoved_indexes_atList(ptr.Pointer(), C.int(int32(i))))
@@ -6894,7 +7101,7 @@ func (ptr *QHelpIndexWidget) __selectedIndexes_newList() unsafe.Pointer {
 func (ptr *QHelpIndexWidget) __scrollBarWidgets_atList(i int) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QHelpIndexWidget___scrollBarWidgets_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6915,7 +7122,7 @@ func (ptr *QHelpIndexWidget) __scrollBarWidgets_newList() unsafe.Pointer {
 func (ptr *QHelpIndexWidget) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpIndexWidget___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6936,7 +7143,7 @@ func (ptr *QHelpIndexWidget) __addActions_actions_newList() unsafe.Pointer {
 func (ptr *QHelpIndexWidget) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpIndexWidget___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6957,7 +7164,7 @@ func (ptr *QHelpIndexWidget) __insertActions_actions_newList() unsafe.Pointer {
 func (ptr *QHelpIndexWidget) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpIndexWidget___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6997,7 +7204,7 @@ func (ptr *QHelpIndexWidget) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QHelpIndexWidget) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpIndexWidget___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7018,7 +7225,7 @@ func (ptr *QHelpIndexWidget) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QHelpIndexWidget) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpIndexWidget___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7039,7 +7246,7 @@ func (ptr *QHelpIndexWidget) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QHelpIndexWidget) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpIndexWidget___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7060,7 +7267,7 @@ func (ptr *QHelpIndexWidget) __findChildren_newList() unsafe.Pointer {
 func (ptr *QHelpIndexWidget) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpIndexWidget___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7080,7 +7287,7 @@ func (ptr *QHelpIndexWidget) __children_newList() unsafe.Pointer {
 
 //export callbackQHelpIndexWidget_MoveCursor
 func callbackQHelpIndexWidget_MoveCursor(ptr unsafe.Pointer, cursorAction C.longlong, modifiers C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveCursor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveCursor"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(widgets.QAbstractItemView__CursorAction, core.Qt__KeyboardModifier) *core.QModelIndex)(widgets.QAbstractItemView__CursorAction(cursorAction), core.Qt__KeyboardModifier(modifiers)))
 	}
 
@@ -7098,7 +7305,7 @@ func (ptr *QHelpIndexWidget) MoveCursorDefault(cursorAction widgets.QAbstractIte
 
 //export callbackQHelpIndexWidget_Event
 func callbackQHelpIndexWidget_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -7114,7 +7321,7 @@ func (ptr *QHelpIndexWidget) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQHelpIndexWidget_CurrentChanged
 func callbackQHelpIndexWidget_CurrentChanged(ptr unsafe.Pointer, current unsafe.Pointer, previous unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentChanged"); signal != nil {
 		signal.(func(*core.QModelIndex, *core.QModelIndex))(core.NewQModelIndexFromPointer(current), core.NewQModelIndexFromPointer(previous))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).CurrentChangedDefault(core.NewQModelIndexFromPointer(current), core.NewQModelIndexFromPointer(previous))
@@ -7129,19 +7336,23 @@ func (ptr *QHelpIndexWidget) CurrentChangedDefault(current core.QModelIndex_ITF,
 
 //export callbackQHelpIndexWidget_DataChanged
 func callbackQHelpIndexWidget_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Pointer, bottomRight unsafe.Pointer, roles C.struct_QtHelp_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataChanged"); signal != nil {
 		signal.(func(*core.QModelIndex, *core.QModelIndex, []int))(core.NewQModelIndexFromPointer(topLeft), core.NewQModelIndexFromPointer(bottomRight), func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpIndexWidgetFromPointer(l.data).__dataChanged_roles_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpIndexWidgetFromPointer(l.data).__dataChanged_roles_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(roles))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).DataChangedDefault(core.NewQModelIndexFromPointer(topLeft), core.NewQModelIndexFromPointer(bottomRight), func(l C.struct_QtHelp_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQHelpIndexWidgetFromPointer(l.data).__dataChanged_roles_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQHelpIndexWidgetFromPointer(l.data).__dataChanged_roles_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(roles))
@@ -7150,19 +7361,19 @@ func callbackQHelpIndexWidget_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Poi
 
 func (ptr *QHelpIndexWidget) DataChangedDefault(topLeft core.QModelIndex_ITF, bottomRight core.QModelIndex_ITF, roles []int) {
 	if ptr.Pointer() != nil {
-		C.QHelpIndexWidget_DataChangedDefault(ptr.Pointer(), core.PointerFromQModelIndex(topLeft), core.PointerFromQModelIndex(bottomRight), func() unsafe.Pointer {
-			var tmpList = NewQHelpIndexWidgetFromPointer(NewQHelpIndexWidgetFromPointer(nil).__dataChanged_roles_newList())
-			for _, v := range roles {
-				tmpList.__dataChanged_roles_setList(v)
+		C.QHelpIndexWidget_DataChangedDefault(ptr.Pointer(), core.PointerFromQModelIndex(topLeft), core.PointerFromQModelIndex(bottomRight), func(l []int) unsafe.Pointer {
+			var tmpList = make([]C.int, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.int(int32(v))
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQHelpIndexWidgetFromPointer(nil).__dataChanged_roles_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(roles))
 	}
 }
 
 //export callbackQHelpIndexWidget_DragLeaveEvent
 func callbackQHelpIndexWidget_DragLeaveEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(e))
@@ -7177,7 +7388,7 @@ func (ptr *QHelpIndexWidget) DragLeaveEventDefault(e gui.QDragLeaveEvent_ITF) {
 
 //export callbackQHelpIndexWidget_DragMoveEvent
 func callbackQHelpIndexWidget_DragMoveEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(e))
@@ -7192,7 +7403,7 @@ func (ptr *QHelpIndexWidget) DragMoveEventDefault(e gui.QDragMoveEvent_ITF) {
 
 //export callbackQHelpIndexWidget_DropEvent
 func callbackQHelpIndexWidget_DropEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(e))
@@ -7207,7 +7418,7 @@ func (ptr *QHelpIndexWidget) DropEventDefault(e gui.QDropEvent_ITF) {
 
 //export callbackQHelpIndexWidget_MouseMoveEvent
 func callbackQHelpIndexWidget_MouseMoveEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(e))
@@ -7222,7 +7433,7 @@ func (ptr *QHelpIndexWidget) MouseMoveEventDefault(e gui.QMouseEvent_ITF) {
 
 //export callbackQHelpIndexWidget_MouseReleaseEvent
 func callbackQHelpIndexWidget_MouseReleaseEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(e))
@@ -7237,7 +7448,7 @@ func (ptr *QHelpIndexWidget) MouseReleaseEventDefault(e gui.QMouseEvent_ITF) {
 
 //export callbackQHelpIndexWidget_PaintEvent
 func callbackQHelpIndexWidget_PaintEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(e))
@@ -7252,7 +7463,7 @@ func (ptr *QHelpIndexWidget) PaintEventDefault(e gui.QPaintEvent_ITF) {
 
 //export callbackQHelpIndexWidget_ResizeEvent
 func callbackQHelpIndexWidget_ResizeEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(e))
@@ -7267,7 +7478,7 @@ func (ptr *QHelpIndexWidget) ResizeEventDefault(e gui.QResizeEvent_ITF) {
 
 //export callbackQHelpIndexWidget_RowsAboutToBeRemoved
 func callbackQHelpIndexWidget_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).RowsAboutToBeRemovedDefault(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
@@ -7282,7 +7493,7 @@ func (ptr *QHelpIndexWidget) RowsAboutToBeRemovedDefault(parent core.QModelIndex
 
 //export callbackQHelpIndexWidget_RowsInserted
 func callbackQHelpIndexWidget_RowsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).RowsInsertedDefault(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
@@ -7297,7 +7508,7 @@ func (ptr *QHelpIndexWidget) RowsInsertedDefault(parent core.QModelIndex_ITF, st
 
 //export callbackQHelpIndexWidget_ScrollTo
 func callbackQHelpIndexWidget_ScrollTo(ptr unsafe.Pointer, index unsafe.Pointer, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scrollTo"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scrollTo"); signal != nil {
 		signal.(func(*core.QModelIndex, widgets.QAbstractItemView__ScrollHint))(core.NewQModelIndexFromPointer(index), widgets.QAbstractItemView__ScrollHint(hint))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ScrollToDefault(core.NewQModelIndexFromPointer(index), widgets.QAbstractItemView__ScrollHint(hint))
@@ -7312,7 +7523,7 @@ func (ptr *QHelpIndexWidget) ScrollToDefault(index core.QModelIndex_ITF, hint wi
 
 //export callbackQHelpIndexWidget_SelectionChanged
 func callbackQHelpIndexWidget_SelectionChanged(ptr unsafe.Pointer, selected unsafe.Pointer, deselected unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionChanged"); signal != nil {
 		signal.(func(*core.QItemSelection, *core.QItemSelection))(core.NewQItemSelectionFromPointer(selected), core.NewQItemSelectionFromPointer(deselected))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SelectionChangedDefault(core.NewQItemSelectionFromPointer(selected), core.NewQItemSelectionFromPointer(deselected))
@@ -7327,7 +7538,7 @@ func (ptr *QHelpIndexWidget) SelectionChangedDefault(selected core.QItemSelectio
 
 //export callbackQHelpIndexWidget_SetSelection
 func callbackQHelpIndexWidget_SetSelection(ptr unsafe.Pointer, rect unsafe.Pointer, command C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSelection"); signal != nil {
 		signal.(func(*core.QRect, core.QItemSelectionModel__SelectionFlag))(core.NewQRectFromPointer(rect), core.QItemSelectionModel__SelectionFlag(command))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetSelectionDefault(core.NewQRectFromPointer(rect), core.QItemSelectionModel__SelectionFlag(command))
@@ -7342,7 +7553,7 @@ func (ptr *QHelpIndexWidget) SetSelectionDefault(rect core.QRect_ITF, command co
 
 //export callbackQHelpIndexWidget_StartDrag
 func callbackQHelpIndexWidget_StartDrag(ptr unsafe.Pointer, supportedActions C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startDrag"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startDrag"); signal != nil {
 		signal.(func(core.Qt__DropAction))(core.Qt__DropAction(supportedActions))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).StartDragDefault(core.Qt__DropAction(supportedActions))
@@ -7357,7 +7568,7 @@ func (ptr *QHelpIndexWidget) StartDragDefault(supportedActions core.Qt__DropActi
 
 //export callbackQHelpIndexWidget_TimerEvent
 func callbackQHelpIndexWidget_TimerEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(e))
@@ -7372,7 +7583,7 @@ func (ptr *QHelpIndexWidget) TimerEventDefault(e core.QTimerEvent_ITF) {
 
 //export callbackQHelpIndexWidget_UpdateGeometries
 func callbackQHelpIndexWidget_UpdateGeometries(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateGeometries"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateGeometries"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).UpdateGeometriesDefault()
@@ -7387,7 +7598,7 @@ func (ptr *QHelpIndexWidget) UpdateGeometriesDefault() {
 
 //export callbackQHelpIndexWidget_WheelEvent
 func callbackQHelpIndexWidget_WheelEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(e))
@@ -7402,7 +7613,7 @@ func (ptr *QHelpIndexWidget) WheelEventDefault(e gui.QWheelEvent_ITF) {
 
 //export callbackQHelpIndexWidget_IndexAt
 func callbackQHelpIndexWidget_IndexAt(ptr unsafe.Pointer, p unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexAt"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexAt"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QPoint) *core.QModelIndex)(core.NewQPointFromPointer(p)))
 	}
 
@@ -7420,7 +7631,7 @@ func (ptr *QHelpIndexWidget) IndexAtDefault(p core.QPoint_ITF) *core.QModelIndex
 
 //export callbackQHelpIndexWidget_SelectedIndexes
 func callbackQHelpIndexWidget_SelectedIndexes(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectedIndexes"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectedIndexes"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQHelpIndexWidgetFromPointer(NewQHelpIndexWidgetFromPointer(nil).__selectedIndexes_newList())
 			for _, v := range signal.(func() []*core.QModelIndex)() {
@@ -7454,7 +7665,7 @@ func (ptr *QHelpIndexWidget) SelectedIndexesDefault() []*core.QModelIndex {
 
 //export callbackQHelpIndexWidget_VisualRect
 func callbackQHelpIndexWidget_VisualRect(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visualRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visualRect"); signal != nil {
 		return core.PointerFromQRect(signal.(func(*core.QModelIndex) *core.QRect)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -7472,7 +7683,7 @@ func (ptr *QHelpIndexWidget) VisualRectDefault(index core.QModelIndex_ITF) *core
 
 //export callbackQHelpIndexWidget_VisualRegionForSelection
 func callbackQHelpIndexWidget_VisualRegionForSelection(ptr unsafe.Pointer, selection unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visualRegionForSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visualRegionForSelection"); signal != nil {
 		return gui.PointerFromQRegion(signal.(func(*core.QItemSelection) *gui.QRegion)(core.NewQItemSelectionFromPointer(selection)))
 	}
 
@@ -7490,7 +7701,7 @@ func (ptr *QHelpIndexWidget) VisualRegionForSelectionDefault(selection core.QIte
 
 //export callbackQHelpIndexWidget_ViewportSizeHint
 func callbackQHelpIndexWidget_ViewportSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "viewportSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "viewportSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -7508,7 +7719,7 @@ func (ptr *QHelpIndexWidget) ViewportSizeHintDefault() *core.QSize {
 
 //export callbackQHelpIndexWidget_ViewOptions
 func callbackQHelpIndexWidget_ViewOptions(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "viewOptions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "viewOptions"); signal != nil {
 		return widgets.PointerFromQStyleOptionViewItem(signal.(func() *widgets.QStyleOptionViewItem)())
 	}
 
@@ -7526,7 +7737,7 @@ func (ptr *QHelpIndexWidget) ViewOptionsDefault() *widgets.QStyleOptionViewItem
 
 //export callbackQHelpIndexWidget_IsIndexHidden
 func callbackQHelpIndexWidget_IsIndexHidden(ptr unsafe.Pointer, index unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isIndexHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isIndexHidden"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(index)))))
 	}
 
@@ -7542,7 +7753,7 @@ func (ptr *QHelpIndexWidget) IsIndexHiddenDefault(index core.QModelIndex_ITF) bo
 
 //export callbackQHelpIndexWidget_HorizontalOffset
 func callbackQHelpIndexWidget_HorizontalOffset(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "horizontalOffset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "horizontalOffset"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -7558,7 +7769,7 @@ func (ptr *QHelpIndexWidget) HorizontalOffsetDefault() int {
 
 //export callbackQHelpIndexWidget_VerticalOffset
 func callbackQHelpIndexWidget_VerticalOffset(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "verticalOffset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "verticalOffset"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -7574,7 +7785,7 @@ func (ptr *QHelpIndexWidget) VerticalOffsetDefault() int {
 
 //export callbackQHelpIndexWidget_Edit2
 func callbackQHelpIndexWidget_Edit2(ptr unsafe.Pointer, index unsafe.Pointer, trigger C.longlong, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "edit2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "edit2"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, widgets.QAbstractItemView__EditTrigger, *core.QEvent) bool)(core.NewQModelIndexFromPointer(index), widgets.QAbstractItemView__EditTrigger(trigger), core.NewQEventFromPointer(event)))))
 	}
 
@@ -7590,7 +7801,7 @@ func (ptr *QHelpIndexWidget) Edit2Default(index core.QModelIndex_ITF, trigger wi
 
 //export callbackQHelpIndexWidget_FocusNextPrevChild
 func callbackQHelpIndexWidget_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -7606,7 +7817,7 @@ func (ptr *QHelpIndexWidget) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQHelpIndexWidget_ViewportEvent
 func callbackQHelpIndexWidget_ViewportEvent(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "viewportEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "viewportEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -7622,7 +7833,7 @@ func (ptr *QHelpIndexWidget) ViewportEventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQHelpIndexWidget_Activated
 func callbackQHelpIndexWidget_Activated(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activated"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -7630,7 +7841,7 @@ func callbackQHelpIndexWidget_Activated(ptr unsafe.Pointer, index unsafe.Pointer
 
 //export callbackQHelpIndexWidget_ClearSelection
 func callbackQHelpIndexWidget_ClearSelection(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clearSelection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clearSelection"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ClearSelectionDefault()
@@ -7645,7 +7856,7 @@ func (ptr *QHelpIndexWidget) ClearSelectionDefault() {
 
 //export callbackQHelpIndexWidget_Clicked
 func callbackQHelpIndexWidget_Clicked(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clicked"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -7653,7 +7864,7 @@ func callbackQHelpIndexWidget_Clicked(ptr unsafe.Pointer, index unsafe.Pointer)
 
 //export callbackQHelpIndexWidget_CloseEditor
 func callbackQHelpIndexWidget_CloseEditor(ptr unsafe.Pointer, editor unsafe.Pointer, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEditor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEditor"); signal != nil {
 		signal.(func(*widgets.QWidget, widgets.QAbstractItemDelegate__EndEditHint))(widgets.NewQWidgetFromPointer(editor), widgets.QAbstractItemDelegate__EndEditHint(hint))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).CloseEditorDefault(widgets.NewQWidgetFromPointer(editor), widgets.QAbstractItemDelegate__EndEditHint(hint))
@@ -7668,7 +7879,7 @@ func (ptr *QHelpIndexWidget) CloseEditorDefault(editor widgets.QWidget_ITF, hint
 
 //export callbackQHelpIndexWidget_CommitData
 func callbackQHelpIndexWidget_CommitData(ptr unsafe.Pointer, editor unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "commitData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "commitData"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(editor))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).CommitDataDefault(widgets.NewQWidgetFromPointer(editor))
@@ -7683,7 +7894,7 @@ func (ptr *QHelpIndexWidget) CommitDataDefault(editor widgets.QWidget_ITF) {
 
 //export callbackQHelpIndexWidget_DoubleClicked
 func callbackQHelpIndexWidget_DoubleClicked(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "doubleClicked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "doubleClicked"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -7691,7 +7902,7 @@ func callbackQHelpIndexWidget_DoubleClicked(ptr unsafe.Pointer, index unsafe.Poi
 
 //export callbackQHelpIndexWidget_DragEnterEvent
 func callbackQHelpIndexWidget_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -7706,7 +7917,7 @@ func (ptr *QHelpIndexWidget) DragEnterEventDefault(event gui.QDragEnterEvent_ITF
 
 //export callbackQHelpIndexWidget_Edit
 func callbackQHelpIndexWidget_Edit(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "edit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "edit"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).EditDefault(core.NewQModelIndexFromPointer(index))
@@ -7721,7 +7932,7 @@ func (ptr *QHelpIndexWidget) EditDefault(index core.QModelIndex_ITF) {
 
 //export callbackQHelpIndexWidget_EditorDestroyed
 func callbackQHelpIndexWidget_EditorDestroyed(ptr unsafe.Pointer, editor unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "editorDestroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "editorDestroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(editor))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).EditorDestroyedDefault(core.NewQObjectFromPointer(editor))
@@ -7736,7 +7947,7 @@ func (ptr *QHelpIndexWidget) EditorDestroyedDefault(editor core.QObject_ITF) {
 
 //export callbackQHelpIndexWidget_Entered
 func callbackQHelpIndexWidget_Entered(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "entered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "entered"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -7744,7 +7955,7 @@ func callbackQHelpIndexWidget_Entered(ptr unsafe.Pointer, index unsafe.Pointer)
 
 //export callbackQHelpIndexWidget_FocusInEvent
 func callbackQHelpIndexWidget_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -7759,7 +7970,7 @@ func (ptr *QHelpIndexWidget) FocusInEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQHelpIndexWidget_FocusOutEvent
 func callbackQHelpIndexWidget_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -7774,7 +7985,7 @@ func (ptr *QHelpIndexWidget) FocusOutEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQHelpIndexWidget_IconSizeChanged
 func callbackQHelpIndexWidget_IconSizeChanged(ptr unsafe.Pointer, size unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "iconSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "iconSizeChanged"); signal != nil {
 		signal.(func(*core.QSize))(core.NewQSizeFromPointer(size))
 	}
 
@@ -7782,7 +7993,7 @@ func callbackQHelpIndexWidget_IconSizeChanged(ptr unsafe.Pointer, size unsafe.Po
 
 //export callbackQHelpIndexWidget_InputMethodEvent
 func callbackQHelpIndexWidget_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -7797,7 +8008,7 @@ func (ptr *QHelpIndexWidget) InputMethodEventDefault(event gui.QInputMethodEvent
 
 //export callbackQHelpIndexWidget_KeyPressEvent
 func callbackQHelpIndexWidget_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -7812,7 +8023,7 @@ func (ptr *QHelpIndexWidget) KeyPressEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQHelpIndexWidget_KeyboardSearch
 func callbackQHelpIndexWidget_KeyboardSearch(ptr unsafe.Pointer, search C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyboardSearch"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyboardSearch"); signal != nil {
 		signal.(func(string))(cGoUnpackString(search))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).KeyboardSearchDefault(cGoUnpackString(search))
@@ -7829,7 +8040,7 @@ func (ptr *QHelpIndexWidget) KeyboardSearchDefault(search string) {
 
 //export callbackQHelpIndexWidget_MouseDoubleClickEvent
 func callbackQHelpIndexWidget_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -7844,7 +8055,7 @@ func (ptr *QHelpIndexWidget) MouseDoubleClickEventDefault(event gui.QMouseEvent_
 
 //export callbackQHelpIndexWidget_MousePressEvent
 func callbackQHelpIndexWidget_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -7859,7 +8070,7 @@ func (ptr *QHelpIndexWidget) MousePressEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQHelpIndexWidget_Pressed
 func callbackQHelpIndexWidget_Pressed(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pressed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pressed"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -7867,7 +8078,7 @@ func callbackQHelpIndexWidget_Pressed(ptr unsafe.Pointer, index unsafe.Pointer)
 
 //export callbackQHelpIndexWidget_Reset
 func callbackQHelpIndexWidget_Reset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ResetDefault()
@@ -7882,7 +8093,7 @@ func (ptr *QHelpIndexWidget) ResetDefault() {
 
 //export callbackQHelpIndexWidget_ScrollToBottom
 func callbackQHelpIndexWidget_ScrollToBottom(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scrollToBottom"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scrollToBottom"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ScrollToBottomDefault()
@@ -7897,7 +8108,7 @@ func (ptr *QHelpIndexWidget) ScrollToBottomDefault() {
 
 //export callbackQHelpIndexWidget_ScrollToTop
 func callbackQHelpIndexWidget_ScrollToTop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scrollToTop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scrollToTop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ScrollToTopDefault()
@@ -7912,7 +8123,7 @@ func (ptr *QHelpIndexWidget) ScrollToTopDefault() {
 
 //export callbackQHelpIndexWidget_SelectAll
 func callbackQHelpIndexWidget_SelectAll(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectAll"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectAll"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SelectAllDefault()
@@ -7927,7 +8138,7 @@ func (ptr *QHelpIndexWidget) SelectAllDefault() {
 
 //export callbackQHelpIndexWidget_SetCurrentIndex
 func callbackQHelpIndexWidget_SetCurrentIndex(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCurrentIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCurrentIndex"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetCurrentIndexDefault(core.NewQModelIndexFromPointer(index))
@@ -7942,7 +8153,7 @@ func (ptr *QHelpIndexWidget) SetCurrentIndexDefault(index core.QModelIndex_ITF)
 
 //export callbackQHelpIndexWidget_SetModel
 func callbackQHelpIndexWidget_SetModel(ptr unsafe.Pointer, model unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setModel"); signal != nil {
 		signal.(func(*core.QAbstractItemModel))(core.NewQAbstractItemModelFromPointer(model))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetModelDefault(core.NewQAbstractItemModelFromPointer(model))
@@ -7957,7 +8168,7 @@ func (ptr *QHelpIndexWidget) SetModelDefault(model core.QAbstractItemModel_ITF)
 
 //export callbackQHelpIndexWidget_SetRootIndex
 func callbackQHelpIndexWidget_SetRootIndex(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRootIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRootIndex"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetRootIndexDefault(core.NewQModelIndexFromPointer(index))
@@ -7972,7 +8183,7 @@ func (ptr *QHelpIndexWidget) SetRootIndexDefault(index core.QModelIndex_ITF) {
 
 //export callbackQHelpIndexWidget_SetSelectionModel
 func callbackQHelpIndexWidget_SetSelectionModel(ptr unsafe.Pointer, selectionModel unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSelectionModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSelectionModel"); signal != nil {
 		signal.(func(*core.QItemSelectionModel))(core.NewQItemSelectionModelFromPointer(selectionModel))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetSelectionModelDefault(core.NewQItemSelectionModelFromPointer(selectionModel))
@@ -7987,7 +8198,7 @@ func (ptr *QHelpIndexWidget) SetSelectionModelDefault(selectionModel core.QItemS
 
 //export callbackQHelpIndexWidget_Update
 func callbackQHelpIndexWidget_Update(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).UpdateDefault(core.NewQModelIndexFromPointer(index))
@@ -8002,7 +8213,7 @@ func (ptr *QHelpIndexWidget) UpdateDefault(index core.QModelIndex_ITF) {
 
 //export callbackQHelpIndexWidget_ViewportEntered
 func callbackQHelpIndexWidget_ViewportEntered(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "viewportEntered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "viewportEntered"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8010,7 +8221,7 @@ func callbackQHelpIndexWidget_ViewportEntered(ptr unsafe.Pointer) {
 
 //export callbackQHelpIndexWidget_SelectionCommand
 func callbackQHelpIndexWidget_SelectionCommand(ptr unsafe.Pointer, index unsafe.Pointer, event unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectionCommand"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectionCommand"); signal != nil {
 		return C.longlong(signal.(func(*core.QModelIndex, *core.QEvent) core.QItemSelectionModel__SelectionFlag)(core.NewQModelIndexFromPointer(index), core.NewQEventFromPointer(event)))
 	}
 
@@ -8026,7 +8237,7 @@ func (ptr *QHelpIndexWidget) SelectionCommandDefault(index core.QModelIndex_ITF,
 
 //export callbackQHelpIndexWidget_InputMethodQuery
 func callbackQHelpIndexWidget_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -8044,7 +8255,7 @@ func (ptr *QHelpIndexWidget) InputMethodQueryDefault(query core.Qt__InputMethodQ
 
 //export callbackQHelpIndexWidget_SizeHintForColumn
 func callbackQHelpIndexWidget_SizeHintForColumn(ptr unsafe.Pointer, column C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHintForColumn"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHintForColumn"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(column)))))
 	}
 
@@ -8060,7 +8271,7 @@ func (ptr *QHelpIndexWidget) SizeHintForColumnDefault(column int) int {
 
 //export callbackQHelpIndexWidget_SizeHintForRow
 func callbackQHelpIndexWidget_SizeHintForRow(ptr unsafe.Pointer, row C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHintForRow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHintForRow"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(row)))))
 	}
 
@@ -8076,7 +8287,7 @@ func (ptr *QHelpIndexWidget) SizeHintForRowDefault(row int) int {
 
 //export callbackQHelpIndexWidget_ContextMenuEvent
 func callbackQHelpIndexWidget_ContextMenuEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(e))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(e))
@@ -8091,7 +8302,7 @@ func (ptr *QHelpIndexWidget) ContextMenuEventDefault(e gui.QContextMenuEvent_ITF
 
 //export callbackQHelpIndexWidget_ScrollContentsBy
 func callbackQHelpIndexWidget_ScrollContentsBy(ptr unsafe.Pointer, dx C.int, dy C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scrollContentsBy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scrollContentsBy"); signal != nil {
 		signal.(func(int, int))(int(int32(dx)), int(int32(dy)))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ScrollContentsByDefault(int(int32(dx)), int(int32(dy)))
@@ -8106,7 +8317,7 @@ func (ptr *QHelpIndexWidget) ScrollContentsByDefault(dx int, dy int) {
 
 //export callbackQHelpIndexWidget_SetupViewport
 func callbackQHelpIndexWidget_SetupViewport(ptr unsafe.Pointer, viewport unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setupViewport"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setupViewport"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(viewport))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetupViewportDefault(widgets.NewQWidgetFromPointer(viewport))
@@ -8121,7 +8332,7 @@ func (ptr *QHelpIndexWidget) SetupViewportDefault(viewport widgets.QWidget_ITF)
 
 //export callbackQHelpIndexWidget_MinimumSizeHint
 func callbackQHelpIndexWidget_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -8139,7 +8350,7 @@ func (ptr *QHelpIndexWidget) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQHelpIndexWidget_SizeHint
 func callbackQHelpIndexWidget_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -8157,7 +8368,7 @@ func (ptr *QHelpIndexWidget) SizeHintDefault() *core.QSize {
 
 //export callbackQHelpIndexWidget_ChangeEvent
 func callbackQHelpIndexWidget_ChangeEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(ev))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(ev))
@@ -8172,7 +8383,7 @@ func (ptr *QHelpIndexWidget) ChangeEventDefault(ev core.QEvent_ITF) {
 
 //export callbackQHelpIndexWidget_Close
 func callbackQHelpIndexWidget_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -8188,7 +8399,7 @@ func (ptr *QHelpIndexWidget) CloseDefault() bool {
 
 //export callbackQHelpIndexWidget_NativeEvent
 func callbackQHelpIndexWidget_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -8204,7 +8415,7 @@ func (ptr *QHelpIndexWidget) NativeEventDefault(eventType core.QByteArray_ITF, m
 
 //export callbackQHelpIndexWidget_ActionEvent
 func callbackQHelpIndexWidget_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -8219,7 +8430,7 @@ func (ptr *QHelpIndexWidget) ActionEventDefault(event gui.QActionEvent_ITF) {
 
 //export callbackQHelpIndexWidget_CloseEvent
 func callbackQHelpIndexWidget_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -8234,7 +8445,7 @@ func (ptr *QHelpIndexWidget) CloseEventDefault(event gui.QCloseEvent_ITF) {
 
 //export callbackQHelpIndexWidget_CustomContextMenuRequested
 func callbackQHelpIndexWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -8242,7 +8453,7 @@ func callbackQHelpIndexWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos
 
 //export callbackQHelpIndexWidget_EnterEvent
 func callbackQHelpIndexWidget_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -8257,7 +8468,7 @@ func (ptr *QHelpIndexWidget) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpIndexWidget_Hide
 func callbackQHelpIndexWidget_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).HideDefault()
@@ -8272,7 +8483,7 @@ func (ptr *QHelpIndexWidget) HideDefault() {
 
 //export callbackQHelpIndexWidget_HideEvent
 func callbackQHelpIndexWidget_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -8287,7 +8498,7 @@ func (ptr *QHelpIndexWidget) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQHelpIndexWidget_KeyReleaseEvent
 func callbackQHelpIndexWidget_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -8302,7 +8513,7 @@ func (ptr *QHelpIndexWidget) KeyReleaseEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQHelpIndexWidget_LeaveEvent
 func callbackQHelpIndexWidget_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -8317,7 +8528,7 @@ func (ptr *QHelpIndexWidget) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpIndexWidget_Lower
 func callbackQHelpIndexWidget_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).LowerDefault()
@@ -8332,7 +8543,7 @@ func (ptr *QHelpIndexWidget) LowerDefault() {
 
 //export callbackQHelpIndexWidget_MoveEvent
 func callbackQHelpIndexWidget_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -8347,7 +8558,7 @@ func (ptr *QHelpIndexWidget) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQHelpIndexWidget_Raise
 func callbackQHelpIndexWidget_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).RaiseDefault()
@@ -8362,7 +8573,7 @@ func (ptr *QHelpIndexWidget) RaiseDefault() {
 
 //export callbackQHelpIndexWidget_Repaint
 func callbackQHelpIndexWidget_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).RepaintDefault()
@@ -8377,7 +8588,7 @@ func (ptr *QHelpIndexWidget) RepaintDefault() {
 
 //export callbackQHelpIndexWidget_SetDisabled
 func callbackQHelpIndexWidget_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -8392,7 +8603,7 @@ func (ptr *QHelpIndexWidget) SetDisabledDefault(disable bool) {
 
 //export callbackQHelpIndexWidget_SetEnabled
 func callbackQHelpIndexWidget_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -8407,7 +8618,7 @@ func (ptr *QHelpIndexWidget) SetEnabledDefault(vbo bool) {
 
 //export callbackQHelpIndexWidget_SetFocus2
 func callbackQHelpIndexWidget_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetFocus2Default()
@@ -8422,7 +8633,7 @@ func (ptr *QHelpIndexWidget) SetFocus2Default() {
 
 //export callbackQHelpIndexWidget_SetHidden
 func callbackQHelpIndexWidget_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -8437,7 +8648,7 @@ func (ptr *QHelpIndexWidget) SetHiddenDefault(hidden bool) {
 
 //export callbackQHelpIndexWidget_SetStyleSheet
 func callbackQHelpIndexWidget_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -8454,7 +8665,7 @@ func (ptr *QHelpIndexWidget) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQHelpIndexWidget_SetVisible
 func callbackQHelpIndexWidget_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -8469,7 +8680,7 @@ func (ptr *QHelpIndexWidget) SetVisibleDefault(visible bool) {
 
 //export callbackQHelpIndexWidget_SetWindowModified
 func callbackQHelpIndexWidget_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -8484,7 +8695,7 @@ func (ptr *QHelpIndexWidget) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQHelpIndexWidget_SetWindowTitle
 func callbackQHelpIndexWidget_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -8501,7 +8712,7 @@ func (ptr *QHelpIndexWidget) SetWindowTitleDefault(vqs string) {
 
 //export callbackQHelpIndexWidget_Show
 func callbackQHelpIndexWidget_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ShowDefault()
@@ -8516,7 +8727,7 @@ func (ptr *QHelpIndexWidget) ShowDefault() {
 
 //export callbackQHelpIndexWidget_ShowEvent
 func callbackQHelpIndexWidget_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -8531,7 +8742,7 @@ func (ptr *QHelpIndexWidget) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQHelpIndexWidget_ShowFullScreen
 func callbackQHelpIndexWidget_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ShowFullScreenDefault()
@@ -8546,7 +8757,7 @@ func (ptr *QHelpIndexWidget) ShowFullScreenDefault() {
 
 //export callbackQHelpIndexWidget_ShowMaximized
 func callbackQHelpIndexWidget_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ShowMaximizedDefault()
@@ -8561,7 +8772,7 @@ func (ptr *QHelpIndexWidget) ShowMaximizedDefault() {
 
 //export callbackQHelpIndexWidget_ShowMinimized
 func callbackQHelpIndexWidget_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ShowMinimizedDefault()
@@ -8576,7 +8787,7 @@ func (ptr *QHelpIndexWidget) ShowMinimizedDefault() {
 
 //export callbackQHelpIndexWidget_ShowNormal
 func callbackQHelpIndexWidget_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ShowNormalDefault()
@@ -8591,7 +8802,7 @@ func (ptr *QHelpIndexWidget) ShowNormalDefault() {
 
 //export callbackQHelpIndexWidget_TabletEvent
 func callbackQHelpIndexWidget_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -8606,7 +8817,7 @@ func (ptr *QHelpIndexWidget) TabletEventDefault(event gui.QTabletEvent_ITF) {
 
 //export callbackQHelpIndexWidget_UpdateMicroFocus
 func callbackQHelpIndexWidget_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).UpdateMicroFocusDefault()
@@ -8621,7 +8832,7 @@ func (ptr *QHelpIndexWidget) UpdateMicroFocusDefault() {
 
 //export callbackQHelpIndexWidget_WindowIconChanged
 func callbackQHelpIndexWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -8629,7 +8840,7 @@ func callbackQHelpIndexWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.
 
 //export callbackQHelpIndexWidget_WindowTitleChanged
 func callbackQHelpIndexWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -8637,7 +8848,7 @@ func callbackQHelpIndexWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.str
 
 //export callbackQHelpIndexWidget_PaintEngine
 func callbackQHelpIndexWidget_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -8653,7 +8864,7 @@ func (ptr *QHelpIndexWidget) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQHelpIndexWidget_HasHeightForWidth
 func callbackQHelpIndexWidget_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -8669,7 +8880,7 @@ func (ptr *QHelpIndexWidget) HasHeightForWidthDefault() bool {
 
 //export callbackQHelpIndexWidget_HeightForWidth
 func callbackQHelpIndexWidget_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -8685,7 +8896,7 @@ func (ptr *QHelpIndexWidget) HeightForWidthDefault(w int) int {
 
 //export callbackQHelpIndexWidget_Metric
 func callbackQHelpIndexWidget_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -8701,7 +8912,7 @@ func (ptr *QHelpIndexWidget) MetricDefault(m gui.QPaintDevice__PaintDeviceMetric
 
 //export callbackQHelpIndexWidget_EventFilter
 func callbackQHelpIndexWidget_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -8717,7 +8928,7 @@ func (ptr *QHelpIndexWidget) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQHelpIndexWidget_ChildEvent
 func callbackQHelpIndexWidget_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -8732,7 +8943,7 @@ func (ptr *QHelpIndexWidget) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQHelpIndexWidget_ConnectNotify
 func callbackQHelpIndexWidget_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -8747,7 +8958,7 @@ func (ptr *QHelpIndexWidget) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHelpIndexWidget_CustomEvent
 func callbackQHelpIndexWidget_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -8762,7 +8973,7 @@ func (ptr *QHelpIndexWidget) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpIndexWidget_DeleteLater
 func callbackQHelpIndexWidget_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).DeleteLaterDefault()
@@ -8772,14 +8983,14 @@ func callbackQHelpIndexWidget_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QHelpIndexWidget) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QHelpIndexWidget_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHelpIndexWidget_Destroyed
 func callbackQHelpIndexWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -8787,7 +8998,7 @@ func callbackQHelpIndexWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQHelpIndexWidget_DisconnectNotify
 func callbackQHelpIndexWidget_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpIndexWidgetFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -8802,7 +9013,7 @@ func (ptr *QHelpIndexWidget) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQHelpIndexWidget_ObjectNameChanged
 func callbackQHelpIndexWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -8810,7 +9021,7 @@ func callbackQHelpIndexWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C
 
 //export callbackQHelpIndexWidget_MetaObject
 func callbackQHelpIndexWidget_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -8864,7 +9075,7 @@ func NewQHelpSearchEngineFromPointer(ptr unsafe.Pointer) *QHelpSearchEngine {
 }
 func NewQHelpSearchEngine(helpEngine QHelpEngineCore_ITF, parent core.QObject_ITF) *QHelpSearchEngine {
 	var tmpValue = NewQHelpSearchEngineFromPointer(C.QHelpSearchEngine_NewQHelpSearchEngine(PointerFromQHelpEngineCore(helpEngine), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -8873,7 +9084,7 @@ func NewQHelpSearchEngine(helpEngine QHelpEngineCore_ITF, parent core.QObject_IT
 func (ptr *QHelpSearchEngine) QueryWidget() *QHelpSearchQueryWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQHelpSearchQueryWidgetFromPointer(C.QHelpSearchEngine_QueryWidget(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8884,7 +9095,7 @@ func (ptr *QHelpSearchEngine) QueryWidget() *QHelpSearchQueryWidget {
 func (ptr *QHelpSearchEngine) ResultWidget() *QHelpSearchResultWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQHelpSearchResultWidgetFromPointer(C.QHelpSearchEngine_ResultWidget(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8894,7 +9105,7 @@ func (ptr *QHelpSearchEngine) ResultWidget() *QHelpSearchResultWidget {
 
 //export callbackQHelpSearchEngine_CancelIndexing
 func callbackQHelpSearchEngine_CancelIndexing(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cancelIndexing"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cancelIndexing"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchEngineFromPointer(ptr).CancelIndexingDefault()
@@ -8904,14 +9115,14 @@ func callbackQHelpSearchEngine_CancelIndexing(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchEngine) ConnectCancelIndexing(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cancelIndexing", f)
+		qt.ConnectSignal(ptr.Pointer(), "cancelIndexing", f)
 	}
 }
 
 func (ptr *QHelpSearchEngine) DisconnectCancelIndexing() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cancelIndexing")
+		qt.DisconnectSignal(ptr.Pointer(), "cancelIndexing")
 	}
 }
 
@@ -8929,7 +9140,7 @@ func (ptr *QHelpSearchEngine) CancelIndexingDefault() {
 
 //export callbackQHelpSearchEngine_CancelSearching
 func callbackQHelpSearchEngine_CancelSearching(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cancelSearching"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cancelSearching"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchEngineFromPointer(ptr).CancelSearchingDefault()
@@ -8939,14 +9150,14 @@ func callbackQHelpSearchEngine_CancelSearching(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchEngine) ConnectCancelSearching(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cancelSearching", f)
+		qt.ConnectSignal(ptr.Pointer(), "cancelSearching", f)
 	}
 }
 
 func (ptr *QHelpSearchEngine) DisconnectCancelSearching() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cancelSearching")
+		qt.DisconnectSignal(ptr.Pointer(), "cancelSearching")
 	}
 }
 
@@ -8964,7 +9175,7 @@ func (ptr *QHelpSearchEngine) CancelSearchingDefault() {
 
 //export callbackQHelpSearchEngine_IndexingFinished
 func callbackQHelpSearchEngine_IndexingFinished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexingFinished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexingFinished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8973,14 +9184,14 @@ func callbackQHelpSearchEngine_IndexingFinished(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchEngine) ConnectIndexingFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_ConnectIndexingFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "indexingFinished", f)
+		qt.ConnectSignal(ptr.Pointer(), "indexingFinished", f)
 	}
 }
 
 func (ptr *QHelpSearchEngine) DisconnectIndexingFinished() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_DisconnectIndexingFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "indexingFinished")
+		qt.DisconnectSignal(ptr.Pointer(), "indexingFinished")
 	}
 }
 
@@ -8992,7 +9203,7 @@ func (ptr *QHelpSearchEngine) IndexingFinished() {
 
 //export callbackQHelpSearchEngine_IndexingStarted
 func callbackQHelpSearchEngine_IndexingStarted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexingStarted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexingStarted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9001,14 +9212,14 @@ func callbackQHelpSearchEngine_IndexingStarted(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchEngine) ConnectIndexingStarted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_ConnectIndexingStarted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "indexingStarted", f)
+		qt.ConnectSignal(ptr.Pointer(), "indexingStarted", f)
 	}
 }
 
 func (ptr *QHelpSearchEngine) DisconnectIndexingStarted() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_DisconnectIndexingStarted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "indexingStarted")
+		qt.DisconnectSignal(ptr.Pointer(), "indexingStarted")
 	}
 }
 
@@ -9020,7 +9231,7 @@ func (ptr *QHelpSearchEngine) IndexingStarted() {
 
 //export callbackQHelpSearchEngine_ReindexDocumentation
 func callbackQHelpSearchEngine_ReindexDocumentation(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reindexDocumentation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reindexDocumentation"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchEngineFromPointer(ptr).ReindexDocumentationDefault()
@@ -9030,14 +9241,14 @@ func callbackQHelpSearchEngine_ReindexDocumentation(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchEngine) ConnectReindexDocumentation(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reindexDocumentation", f)
+		qt.ConnectSignal(ptr.Pointer(), "reindexDocumentation", f)
 	}
 }
 
 func (ptr *QHelpSearchEngine) DisconnectReindexDocumentation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reindexDocumentation")
+		qt.DisconnectSignal(ptr.Pointer(), "reindexDocumentation")
 	}
 }
 
@@ -9055,7 +9266,7 @@ func (ptr *QHelpSearchEngine) ReindexDocumentationDefault() {
 
 //export callbackQHelpSearchEngine_Search
 func callbackQHelpSearchEngine_Search(ptr unsafe.Pointer, queryList C.struct_QtHelp_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "search"); signal != nil {
+	if signal := qt.GetSignal(ptr, "search"); signal != nil {
 		signal.(func([]*QHelpSearchQuery))(func(l C.struct_QtHelp_PackedList) []*QHelpSearchQuery {
 			var out = make([]*QHelpSearchQuery, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -9077,14 +9288,14 @@ func callbackQHelpSearchEngine_Search(ptr unsafe.Pointer, queryList C.struct_QtH
 func (ptr *QHelpSearchEngine) ConnectSearch(f func(queryList []*QHelpSearchQuery)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "search", f)
+		qt.ConnectSignal(ptr.Pointer(), "search", f)
 	}
 }
 
 func (ptr *QHelpSearchEngine) DisconnectSearch() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "search")
+		qt.DisconnectSignal(ptr.Pointer(), "search")
 	}
 }
 
@@ -9114,7 +9325,7 @@ func (ptr *QHelpSearchEngine) SearchDefault(queryList []*QHelpSearchQuery) {
 
 //export callbackQHelpSearchEngine_SearchingFinished
 func callbackQHelpSearchEngine_SearchingFinished(ptr unsafe.Pointer, hits C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "searchingFinished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "searchingFinished"); signal != nil {
 		signal.(func(int))(int(int32(hits)))
 	}
 
@@ -9123,14 +9334,14 @@ func callbackQHelpSearchEngine_SearchingFinished(ptr unsafe.Pointer, hits C.int)
 func (ptr *QHelpSearchEngine) ConnectSearchingFinished(f func(hits int)) {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_ConnectSearchingFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "searchingFinished", f)
+		qt.ConnectSignal(ptr.Pointer(), "searchingFinished", f)
 	}
 }
 
 func (ptr *QHelpSearchEngine) DisconnectSearchingFinished() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_DisconnectSearchingFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "searchingFinished")
+		qt.DisconnectSignal(ptr.Pointer(), "searchingFinished")
 	}
 }
 
@@ -9142,7 +9353,7 @@ func (ptr *QHelpSearchEngine) SearchingFinished(hits int) {
 
 //export callbackQHelpSearchEngine_SearchingStarted
 func callbackQHelpSearchEngine_SearchingStarted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "searchingStarted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "searchingStarted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9151,14 +9362,14 @@ func callbackQHelpSearchEngine_SearchingStarted(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchEngine) ConnectSearchingStarted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_ConnectSearchingStarted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "searchingStarted", f)
+		qt.ConnectSignal(ptr.Pointer(), "searchingStarted", f)
 	}
 }
 
 func (ptr *QHelpSearchEngine) DisconnectSearchingStarted() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_DisconnectSearchingStarted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "searchingStarted")
+		qt.DisconnectSignal(ptr.Pointer(), "searchingStarted")
 	}
 }
 
@@ -9171,7 +9382,7 @@ func (ptr *QHelpSearchEngine) SearchingStarted() {
 func (ptr *QHelpSearchEngine) DestroyQHelpSearchEngine() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_DestroyQHelpSearchEngine(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9243,7 +9454,7 @@ func (ptr *QHelpSearchEngine) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QHelpSearchEngine) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchEngine___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9264,7 +9475,7 @@ func (ptr *QHelpSearchEngine) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QHelpSearchEngine) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchEngine___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9285,7 +9496,7 @@ func (ptr *QHelpSearchEngine) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QHelpSearchEngine) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchEngine___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9306,7 +9517,7 @@ func (ptr *QHelpSearchEngine) __findChildren_newList() unsafe.Pointer {
 func (ptr *QHelpSearchEngine) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchEngine___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9326,7 +9537,7 @@ func (ptr *QHelpSearchEngine) __children_newList() unsafe.Pointer {
 
 //export callbackQHelpSearchEngine_Event
 func callbackQHelpSearchEngine_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -9342,7 +9553,7 @@ func (ptr *QHelpSearchEngine) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQHelpSearchEngine_EventFilter
 func callbackQHelpSearchEngine_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -9358,7 +9569,7 @@ func (ptr *QHelpSearchEngine) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQHelpSearchEngine_ChildEvent
 func callbackQHelpSearchEngine_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQHelpSearchEngineFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -9373,7 +9584,7 @@ func (ptr *QHelpSearchEngine) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQHelpSearchEngine_ConnectNotify
 func callbackQHelpSearchEngine_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpSearchEngineFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9388,7 +9599,7 @@ func (ptr *QHelpSearchEngine) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHelpSearchEngine_CustomEvent
 func callbackQHelpSearchEngine_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpSearchEngineFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -9403,7 +9614,7 @@ func (ptr *QHelpSearchEngine) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpSearchEngine_DeleteLater
 func callbackQHelpSearchEngine_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchEngineFromPointer(ptr).DeleteLaterDefault()
@@ -9413,14 +9624,14 @@ func callbackQHelpSearchEngine_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchEngine) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchEngine_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHelpSearchEngine_Destroyed
 func callbackQHelpSearchEngine_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -9428,7 +9639,7 @@ func callbackQHelpSearchEngine_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQHelpSearchEngine_DisconnectNotify
 func callbackQHelpSearchEngine_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpSearchEngineFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9443,7 +9654,7 @@ func (ptr *QHelpSearchEngine) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQHelpSearchEngine_ObjectNameChanged
 func callbackQHelpSearchEngine_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -9451,7 +9662,7 @@ func callbackQHelpSearchEngine_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQHelpSearchEngine_TimerEvent
 func callbackQHelpSearchEngine_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQHelpSearchEngineFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -9466,7 +9677,7 @@ func (ptr *QHelpSearchEngine) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQHelpSearchEngine_MetaObject
 func callbackQHelpSearchEngine_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -9545,7 +9756,7 @@ func NewQHelpSearchQuery() *QHelpSearchQuery {
 }
 
 func NewQHelpSearchQuery2(field QHelpSearchQuery__FieldName, wordList []string) *QHelpSearchQuery {
-	var wordListC = C.CString(strings.Join(wordList, "|"))
+	var wordListC = cGoPackStringList(wordList)
 	defer C.free(unsafe.Pointer(wordListC))
 	var tmpValue = NewQHelpSearchQueryFromPointer(C.QHelpSearchQuery_NewQHelpSearchQuery2(C.longlong(field), wordListC))
 	runtime.SetFinalizer(tmpValue, (*QHelpSearchQuery).DestroyQHelpSearchQuery)
@@ -9567,14 +9778,14 @@ func (ptr *QHelpSearchQuery) SetFieldName(vfi QHelpSearchQuery__FieldName) {
 
 func (ptr *QHelpSearchQuery) WordList() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QHelpSearchQuery_WordList(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QHelpSearchQuery_WordList(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QHelpSearchQuery) SetWordList(vqs []string) {
 	if ptr.Pointer() != nil {
-		var vqsC = C.CString(strings.Join(vqs, "|"))
+		var vqsC = cGoPackStringList(vqs)
 		defer C.free(unsafe.Pointer(vqsC))
 		C.QHelpSearchQuery_SetWordList(ptr.Pointer(), vqsC)
 	}
@@ -9620,7 +9831,7 @@ func NewQHelpSearchQueryWidgetFromPointer(ptr unsafe.Pointer) *QHelpSearchQueryW
 }
 func NewQHelpSearchQueryWidget(parent widgets.QWidget_ITF) *QHelpSearchQueryWidget {
 	var tmpValue = NewQHelpSearchQueryWidgetFromPointer(C.QHelpSearchQueryWidget_NewQHelpSearchQueryWidget(widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -9640,7 +9851,7 @@ func (ptr *QHelpSearchQueryWidget) ExpandExtendedSearch() {
 
 //export callbackQHelpSearchQueryWidget_Search
 func callbackQHelpSearchQueryWidget_Search(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "search"); signal != nil {
+	if signal := qt.GetSignal(ptr, "search"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9649,14 +9860,14 @@ func callbackQHelpSearchQueryWidget_Search(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchQueryWidget) ConnectSearch(f func()) {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchQueryWidget_ConnectSearch(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "search", f)
+		qt.ConnectSignal(ptr.Pointer(), "search", f)
 	}
 }
 
 func (ptr *QHelpSearchQueryWidget) DisconnectSearch() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchQueryWidget_DisconnectSearch(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "search")
+		qt.DisconnectSignal(ptr.Pointer(), "search")
 	}
 }
 
@@ -9681,7 +9892,7 @@ func (ptr *QHelpSearchQueryWidget) SetQuery(queryList []*QHelpSearchQuery) {
 func (ptr *QHelpSearchQueryWidget) DestroyQHelpSearchQueryWidget() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchQueryWidget_DestroyQHelpSearchQueryWidget(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9734,7 +9945,7 @@ func (ptr *QHelpSearchQueryWidget) __query_newList() unsafe.Pointer {
 func (ptr *QHelpSearchQueryWidget) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpSearchQueryWidget___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9755,7 +9966,7 @@ func (ptr *QHelpSearchQueryWidget) __addActions_actions_newList() unsafe.Pointer
 func (ptr *QHelpSearchQueryWidget) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpSearchQueryWidget___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9776,7 +9987,7 @@ func (ptr *QHelpSearchQueryWidget) __insertActions_actions_newList() unsafe.Poin
 func (ptr *QHelpSearchQueryWidget) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpSearchQueryWidget___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9816,7 +10027,7 @@ func (ptr *QHelpSearchQueryWidget) __dynamicPropertyNames_newList() unsafe.Point
 func (ptr *QHelpSearchQueryWidget) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchQueryWidget___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9837,7 +10048,7 @@ func (ptr *QHelpSearchQueryWidget) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QHelpSearchQueryWidget) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchQueryWidget___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9858,7 +10069,7 @@ func (ptr *QHelpSearchQueryWidget) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QHelpSearchQueryWidget) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchQueryWidget___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9879,7 +10090,7 @@ func (ptr *QHelpSearchQueryWidget) __findChildren_newList() unsafe.Pointer {
 func (ptr *QHelpSearchQueryWidget) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchQueryWidget___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9899,7 +10110,7 @@ func (ptr *QHelpSearchQueryWidget) __children_newList() unsafe.Pointer {
 
 //export callbackQHelpSearchQueryWidget_Close
 func callbackQHelpSearchQueryWidget_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -9915,7 +10126,7 @@ func (ptr *QHelpSearchQueryWidget) CloseDefault() bool {
 
 //export callbackQHelpSearchQueryWidget_Event
 func callbackQHelpSearchQueryWidget_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -9931,7 +10142,7 @@ func (ptr *QHelpSearchQueryWidget) EventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQHelpSearchQueryWidget_FocusNextPrevChild
 func callbackQHelpSearchQueryWidget_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -9947,7 +10158,7 @@ func (ptr *QHelpSearchQueryWidget) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQHelpSearchQueryWidget_NativeEvent
 func callbackQHelpSearchQueryWidget_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -9963,7 +10174,7 @@ func (ptr *QHelpSearchQueryWidget) NativeEventDefault(eventType core.QByteArray_
 
 //export callbackQHelpSearchQueryWidget_ActionEvent
 func callbackQHelpSearchQueryWidget_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -9978,7 +10189,7 @@ func (ptr *QHelpSearchQueryWidget) ActionEventDefault(event gui.QActionEvent_ITF
 
 //export callbackQHelpSearchQueryWidget_ChangeEvent
 func callbackQHelpSearchQueryWidget_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -9993,7 +10204,7 @@ func (ptr *QHelpSearchQueryWidget) ChangeEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpSearchQueryWidget_CloseEvent
 func callbackQHelpSearchQueryWidget_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -10008,7 +10219,7 @@ func (ptr *QHelpSearchQueryWidget) CloseEventDefault(event gui.QCloseEvent_ITF)
 
 //export callbackQHelpSearchQueryWidget_ContextMenuEvent
 func callbackQHelpSearchQueryWidget_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -10023,7 +10234,7 @@ func (ptr *QHelpSearchQueryWidget) ContextMenuEventDefault(event gui.QContextMen
 
 //export callbackQHelpSearchQueryWidget_CustomContextMenuRequested
 func callbackQHelpSearchQueryWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -10031,7 +10242,7 @@ func callbackQHelpSearchQueryWidget_CustomContextMenuRequested(ptr unsafe.Pointe
 
 //export callbackQHelpSearchQueryWidget_DragEnterEvent
 func callbackQHelpSearchQueryWidget_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -10046,7 +10257,7 @@ func (ptr *QHelpSearchQueryWidget) DragEnterEventDefault(event gui.QDragEnterEve
 
 //export callbackQHelpSearchQueryWidget_DragLeaveEvent
 func callbackQHelpSearchQueryWidget_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -10061,7 +10272,7 @@ func (ptr *QHelpSearchQueryWidget) DragLeaveEventDefault(event gui.QDragLeaveEve
 
 //export callbackQHelpSearchQueryWidget_DragMoveEvent
 func callbackQHelpSearchQueryWidget_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -10076,7 +10287,7 @@ func (ptr *QHelpSearchQueryWidget) DragMoveEventDefault(event gui.QDragMoveEvent
 
 //export callbackQHelpSearchQueryWidget_DropEvent
 func callbackQHelpSearchQueryWidget_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -10091,7 +10302,7 @@ func (ptr *QHelpSearchQueryWidget) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQHelpSearchQueryWidget_EnterEvent
 func callbackQHelpSearchQueryWidget_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -10106,7 +10317,7 @@ func (ptr *QHelpSearchQueryWidget) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpSearchQueryWidget_FocusInEvent
 func callbackQHelpSearchQueryWidget_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -10121,7 +10332,7 @@ func (ptr *QHelpSearchQueryWidget) FocusInEventDefault(event gui.QFocusEvent_ITF
 
 //export callbackQHelpSearchQueryWidget_FocusOutEvent
 func callbackQHelpSearchQueryWidget_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -10136,7 +10347,7 @@ func (ptr *QHelpSearchQueryWidget) FocusOutEventDefault(event gui.QFocusEvent_IT
 
 //export callbackQHelpSearchQueryWidget_Hide
 func callbackQHelpSearchQueryWidget_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).HideDefault()
@@ -10151,7 +10362,7 @@ func (ptr *QHelpSearchQueryWidget) HideDefault() {
 
 //export callbackQHelpSearchQueryWidget_HideEvent
 func callbackQHelpSearchQueryWidget_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -10166,7 +10377,7 @@ func (ptr *QHelpSearchQueryWidget) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQHelpSearchQueryWidget_InputMethodEvent
 func callbackQHelpSearchQueryWidget_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -10181,7 +10392,7 @@ func (ptr *QHelpSearchQueryWidget) InputMethodEventDefault(event gui.QInputMetho
 
 //export callbackQHelpSearchQueryWidget_KeyPressEvent
 func callbackQHelpSearchQueryWidget_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -10196,7 +10407,7 @@ func (ptr *QHelpSearchQueryWidget) KeyPressEventDefault(event gui.QKeyEvent_ITF)
 
 //export callbackQHelpSearchQueryWidget_KeyReleaseEvent
 func callbackQHelpSearchQueryWidget_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -10211,7 +10422,7 @@ func (ptr *QHelpSearchQueryWidget) KeyReleaseEventDefault(event gui.QKeyEvent_IT
 
 //export callbackQHelpSearchQueryWidget_LeaveEvent
 func callbackQHelpSearchQueryWidget_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -10226,7 +10437,7 @@ func (ptr *QHelpSearchQueryWidget) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpSearchQueryWidget_Lower
 func callbackQHelpSearchQueryWidget_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).LowerDefault()
@@ -10241,7 +10452,7 @@ func (ptr *QHelpSearchQueryWidget) LowerDefault() {
 
 //export callbackQHelpSearchQueryWidget_MouseDoubleClickEvent
 func callbackQHelpSearchQueryWidget_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -10256,7 +10467,7 @@ func (ptr *QHelpSearchQueryWidget) MouseDoubleClickEventDefault(event gui.QMouse
 
 //export callbackQHelpSearchQueryWidget_MouseMoveEvent
 func callbackQHelpSearchQueryWidget_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -10271,7 +10482,7 @@ func (ptr *QHelpSearchQueryWidget) MouseMoveEventDefault(event gui.QMouseEvent_I
 
 //export callbackQHelpSearchQueryWidget_MousePressEvent
 func callbackQHelpSearchQueryWidget_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -10286,7 +10497,7 @@ func (ptr *QHelpSearchQueryWidget) MousePressEventDefault(event gui.QMouseEvent_
 
 //export callbackQHelpSearchQueryWidget_MouseReleaseEvent
 func callbackQHelpSearchQueryWidget_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -10301,7 +10512,7 @@ func (ptr *QHelpSearchQueryWidget) MouseReleaseEventDefault(event gui.QMouseEven
 
 //export callbackQHelpSearchQueryWidget_MoveEvent
 func callbackQHelpSearchQueryWidget_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -10316,7 +10527,7 @@ func (ptr *QHelpSearchQueryWidget) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQHelpSearchQueryWidget_PaintEvent
 func callbackQHelpSearchQueryWidget_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -10331,7 +10542,7 @@ func (ptr *QHelpSearchQueryWidget) PaintEventDefault(event gui.QPaintEvent_ITF)
 
 //export callbackQHelpSearchQueryWidget_Raise
 func callbackQHelpSearchQueryWidget_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).RaiseDefault()
@@ -10346,7 +10557,7 @@ func (ptr *QHelpSearchQueryWidget) RaiseDefault() {
 
 //export callbackQHelpSearchQueryWidget_Repaint
 func callbackQHelpSearchQueryWidget_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).RepaintDefault()
@@ -10361,7 +10572,7 @@ func (ptr *QHelpSearchQueryWidget) RepaintDefault() {
 
 //export callbackQHelpSearchQueryWidget_ResizeEvent
 func callbackQHelpSearchQueryWidget_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -10376,7 +10587,7 @@ func (ptr *QHelpSearchQueryWidget) ResizeEventDefault(event gui.QResizeEvent_ITF
 
 //export callbackQHelpSearchQueryWidget_SetDisabled
 func callbackQHelpSearchQueryWidget_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -10391,7 +10602,7 @@ func (ptr *QHelpSearchQueryWidget) SetDisabledDefault(disable bool) {
 
 //export callbackQHelpSearchQueryWidget_SetEnabled
 func callbackQHelpSearchQueryWidget_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -10406,7 +10617,7 @@ func (ptr *QHelpSearchQueryWidget) SetEnabledDefault(vbo bool) {
 
 //export callbackQHelpSearchQueryWidget_SetFocus2
 func callbackQHelpSearchQueryWidget_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).SetFocus2Default()
@@ -10421,7 +10632,7 @@ func (ptr *QHelpSearchQueryWidget) SetFocus2Default() {
 
 //export callbackQHelpSearchQueryWidget_SetHidden
 func callbackQHelpSearchQueryWidget_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -10436,7 +10647,7 @@ func (ptr *QHelpSearchQueryWidget) SetHiddenDefault(hidden bool) {
 
 //export callbackQHelpSearchQueryWidget_SetStyleSheet
 func callbackQHelpSearchQueryWidget_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -10453,7 +10664,7 @@ func (ptr *QHelpSearchQueryWidget) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQHelpSearchQueryWidget_SetVisible
 func callbackQHelpSearchQueryWidget_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -10468,7 +10679,7 @@ func (ptr *QHelpSearchQueryWidget) SetVisibleDefault(visible bool) {
 
 //export callbackQHelpSearchQueryWidget_SetWindowModified
 func callbackQHelpSearchQueryWidget_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -10483,7 +10694,7 @@ func (ptr *QHelpSearchQueryWidget) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQHelpSearchQueryWidget_SetWindowTitle
 func callbackQHelpSearchQueryWidget_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -10500,7 +10711,7 @@ func (ptr *QHelpSearchQueryWidget) SetWindowTitleDefault(vqs string) {
 
 //export callbackQHelpSearchQueryWidget_Show
 func callbackQHelpSearchQueryWidget_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ShowDefault()
@@ -10515,7 +10726,7 @@ func (ptr *QHelpSearchQueryWidget) ShowDefault() {
 
 //export callbackQHelpSearchQueryWidget_ShowEvent
 func callbackQHelpSearchQueryWidget_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -10530,7 +10741,7 @@ func (ptr *QHelpSearchQueryWidget) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQHelpSearchQueryWidget_ShowFullScreen
 func callbackQHelpSearchQueryWidget_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ShowFullScreenDefault()
@@ -10545,7 +10756,7 @@ func (ptr *QHelpSearchQueryWidget) ShowFullScreenDefault() {
 
 //export callbackQHelpSearchQueryWidget_ShowMaximized
 func callbackQHelpSearchQueryWidget_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ShowMaximizedDefault()
@@ -10560,7 +10771,7 @@ func (ptr *QHelpSearchQueryWidget) ShowMaximizedDefault() {
 
 //export callbackQHelpSearchQueryWidget_ShowMinimized
 func callbackQHelpSearchQueryWidget_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ShowMinimizedDefault()
@@ -10575,7 +10786,7 @@ func (ptr *QHelpSearchQueryWidget) ShowMinimizedDefault() {
 
 //export callbackQHelpSearchQueryWidget_ShowNormal
 func callbackQHelpSearchQueryWidget_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ShowNormalDefault()
@@ -10590,7 +10801,7 @@ func (ptr *QHelpSearchQueryWidget) ShowNormalDefault() {
 
 //export callbackQHelpSearchQueryWidget_TabletEvent
 func callbackQHelpSearchQueryWidget_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -10605,7 +10816,7 @@ func (ptr *QHelpSearchQueryWidget) TabletEventDefault(event gui.QTabletEvent_ITF
 
 //export callbackQHelpSearchQueryWidget_Update
 func callbackQHelpSearchQueryWidget_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).UpdateDefault()
@@ -10620,7 +10831,7 @@ func (ptr *QHelpSearchQueryWidget) UpdateDefault() {
 
 //export callbackQHelpSearchQueryWidget_UpdateMicroFocus
 func callbackQHelpSearchQueryWidget_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).UpdateMicroFocusDefault()
@@ -10635,7 +10846,7 @@ func (ptr *QHelpSearchQueryWidget) UpdateMicroFocusDefault() {
 
 //export callbackQHelpSearchQueryWidget_WheelEvent
 func callbackQHelpSearchQueryWidget_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -10650,7 +10861,7 @@ func (ptr *QHelpSearchQueryWidget) WheelEventDefault(event gui.QWheelEvent_ITF)
 
 //export callbackQHelpSearchQueryWidget_WindowIconChanged
 func callbackQHelpSearchQueryWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -10658,7 +10869,7 @@ func callbackQHelpSearchQueryWidget_WindowIconChanged(ptr unsafe.Pointer, icon u
 
 //export callbackQHelpSearchQueryWidget_WindowTitleChanged
 func callbackQHelpSearchQueryWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -10666,7 +10877,7 @@ func callbackQHelpSearchQueryWidget_WindowTitleChanged(ptr unsafe.Pointer, title
 
 //export callbackQHelpSearchQueryWidget_PaintEngine
 func callbackQHelpSearchQueryWidget_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -10682,7 +10893,7 @@ func (ptr *QHelpSearchQueryWidget) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQHelpSearchQueryWidget_MinimumSizeHint
 func callbackQHelpSearchQueryWidget_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -10700,7 +10911,7 @@ func (ptr *QHelpSearchQueryWidget) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQHelpSearchQueryWidget_SizeHint
 func callbackQHelpSearchQueryWidget_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -10718,7 +10929,7 @@ func (ptr *QHelpSearchQueryWidget) SizeHintDefault() *core.QSize {
 
 //export callbackQHelpSearchQueryWidget_InputMethodQuery
 func callbackQHelpSearchQueryWidget_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -10736,7 +10947,7 @@ func (ptr *QHelpSearchQueryWidget) InputMethodQueryDefault(query core.Qt__InputM
 
 //export callbackQHelpSearchQueryWidget_HasHeightForWidth
 func callbackQHelpSearchQueryWidget_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -10752,7 +10963,7 @@ func (ptr *QHelpSearchQueryWidget) HasHeightForWidthDefault() bool {
 
 //export callbackQHelpSearchQueryWidget_HeightForWidth
 func callbackQHelpSearchQueryWidget_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -10768,7 +10979,7 @@ func (ptr *QHelpSearchQueryWidget) HeightForWidthDefault(w int) int {
 
 //export callbackQHelpSearchQueryWidget_Metric
 func callbackQHelpSearchQueryWidget_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -10784,7 +10995,7 @@ func (ptr *QHelpSearchQueryWidget) MetricDefault(m gui.QPaintDevice__PaintDevice
 
 //export callbackQHelpSearchQueryWidget_EventFilter
 func callbackQHelpSearchQueryWidget_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -10800,7 +11011,7 @@ func (ptr *QHelpSearchQueryWidget) EventFilterDefault(watched core.QObject_ITF,
 
 //export callbackQHelpSearchQueryWidget_ChildEvent
 func callbackQHelpSearchQueryWidget_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -10815,7 +11026,7 @@ func (ptr *QHelpSearchQueryWidget) ChildEventDefault(event core.QChildEvent_ITF)
 
 //export callbackQHelpSearchQueryWidget_ConnectNotify
 func callbackQHelpSearchQueryWidget_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -10830,7 +11041,7 @@ func (ptr *QHelpSearchQueryWidget) ConnectNotifyDefault(sign core.QMetaMethod_IT
 
 //export callbackQHelpSearchQueryWidget_CustomEvent
 func callbackQHelpSearchQueryWidget_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -10845,7 +11056,7 @@ func (ptr *QHelpSearchQueryWidget) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpSearchQueryWidget_DeleteLater
 func callbackQHelpSearchQueryWidget_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).DeleteLaterDefault()
@@ -10855,14 +11066,14 @@ func callbackQHelpSearchQueryWidget_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchQueryWidget) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchQueryWidget_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHelpSearchQueryWidget_Destroyed
 func callbackQHelpSearchQueryWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -10870,7 +11081,7 @@ func callbackQHelpSearchQueryWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Poi
 
 //export callbackQHelpSearchQueryWidget_DisconnectNotify
 func callbackQHelpSearchQueryWidget_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -10885,7 +11096,7 @@ func (ptr *QHelpSearchQueryWidget) DisconnectNotifyDefault(sign core.QMetaMethod
 
 //export callbackQHelpSearchQueryWidget_ObjectNameChanged
 func callbackQHelpSearchQueryWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -10893,7 +11104,7 @@ func callbackQHelpSearchQueryWidget_ObjectNameChanged(ptr unsafe.Pointer, object
 
 //export callbackQHelpSearchQueryWidget_TimerEvent
 func callbackQHelpSearchQueryWidget_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQHelpSearchQueryWidgetFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -10908,7 +11119,7 @@ func (ptr *QHelpSearchQueryWidget) TimerEventDefault(event core.QTimerEvent_ITF)
 
 //export callbackQHelpSearchQueryWidget_MetaObject
 func callbackQHelpSearchQueryWidget_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -10971,7 +11182,7 @@ func (ptr *QHelpSearchResultWidget) LinkAt(point core.QPoint_ITF) *core.QUrl {
 
 //export callbackQHelpSearchResultWidget_RequestShowLink
 func callbackQHelpSearchResultWidget_RequestShowLink(ptr unsafe.Pointer, link unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestShowLink"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestShowLink"); signal != nil {
 		signal.(func(*core.QUrl))(core.NewQUrlFromPointer(link))
 	}
 
@@ -10980,14 +11191,14 @@ func callbackQHelpSearchResultWidget_RequestShowLink(ptr unsafe.Pointer, link un
 func (ptr *QHelpSearchResultWidget) ConnectRequestShowLink(f func(link *core.QUrl)) {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchResultWidget_ConnectRequestShowLink(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "requestShowLink", f)
+		qt.ConnectSignal(ptr.Pointer(), "requestShowLink", f)
 	}
 }
 
 func (ptr *QHelpSearchResultWidget) DisconnectRequestShowLink() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchResultWidget_DisconnectRequestShowLink(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "requestShowLink")
+		qt.DisconnectSignal(ptr.Pointer(), "requestShowLink")
 	}
 }
 
@@ -11000,7 +11211,7 @@ func (ptr *QHelpSearchResultWidget) RequestShowLink(link core.QUrl_ITF) {
 func (ptr *QHelpSearchResultWidget) DestroyQHelpSearchResultWidget() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchResultWidget_DestroyQHelpSearchResultWidget(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11008,7 +11219,7 @@ func (ptr *QHelpSearchResultWidget) DestroyQHelpSearchResultWidget() {
 func (ptr *QHelpSearchResultWidget) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpSearchResultWidget___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11029,7 +11240,7 @@ func (ptr *QHelpSearchResultWidget) __addActions_actions_newList() unsafe.Pointe
 func (ptr *QHelpSearchResultWidget) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpSearchResultWidget___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11050,7 +11261,7 @@ func (ptr *QHelpSearchResultWidget) __insertActions_actions_newList() unsafe.Poi
 func (ptr *QHelpSearchResultWidget) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QHelpSearchResultWidget___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11090,7 +11301,7 @@ func (ptr *QHelpSearchResultWidget) __dynamicPropertyNames_newList() unsafe.Poin
 func (ptr *QHelpSearchResultWidget) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchResultWidget___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11111,7 +11322,7 @@ func (ptr *QHelpSearchResultWidget) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QHelpSearchResultWidget) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchResultWidget___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11132,7 +11343,7 @@ func (ptr *QHelpSearchResultWidget) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QHelpSearchResultWidget) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchResultWidget___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11153,7 +11364,7 @@ func (ptr *QHelpSearchResultWidget) __findChildren_newList() unsafe.Pointer {
 func (ptr *QHelpSearchResultWidget) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHelpSearchResultWidget___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11173,7 +11384,7 @@ func (ptr *QHelpSearchResultWidget) __children_newList() unsafe.Pointer {
 
 //export callbackQHelpSearchResultWidget_Close
 func callbackQHelpSearchResultWidget_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -11189,7 +11400,7 @@ func (ptr *QHelpSearchResultWidget) CloseDefault() bool {
 
 //export callbackQHelpSearchResultWidget_Event
 func callbackQHelpSearchResultWidget_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -11205,7 +11416,7 @@ func (ptr *QHelpSearchResultWidget) EventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQHelpSearchResultWidget_FocusNextPrevChild
 func callbackQHelpSearchResultWidget_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -11221,7 +11432,7 @@ func (ptr *QHelpSearchResultWidget) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQHelpSearchResultWidget_NativeEvent
 func callbackQHelpSearchResultWidget_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -11237,7 +11448,7 @@ func (ptr *QHelpSearchResultWidget) NativeEventDefault(eventType core.QByteArray
 
 //export callbackQHelpSearchResultWidget_ActionEvent
 func callbackQHelpSearchResultWidget_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -11252,7 +11463,7 @@ func (ptr *QHelpSearchResultWidget) ActionEventDefault(event gui.QActionEvent_IT
 
 //export callbackQHelpSearchResultWidget_ChangeEvent
 func callbackQHelpSearchResultWidget_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -11267,7 +11478,7 @@ func (ptr *QHelpSearchResultWidget) ChangeEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpSearchResultWidget_CloseEvent
 func callbackQHelpSearchResultWidget_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -11282,7 +11493,7 @@ func (ptr *QHelpSearchResultWidget) CloseEventDefault(event gui.QCloseEvent_ITF)
 
 //export callbackQHelpSearchResultWidget_ContextMenuEvent
 func callbackQHelpSearchResultWidget_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -11297,7 +11508,7 @@ func (ptr *QHelpSearchResultWidget) ContextMenuEventDefault(event gui.QContextMe
 
 //export callbackQHelpSearchResultWidget_CustomContextMenuRequested
 func callbackQHelpSearchResultWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -11305,7 +11516,7 @@ func callbackQHelpSearchResultWidget_CustomContextMenuRequested(ptr unsafe.Point
 
 //export callbackQHelpSearchResultWidget_DragEnterEvent
 func callbackQHelpSearchResultWidget_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -11320,7 +11531,7 @@ func (ptr *QHelpSearchResultWidget) DragEnterEventDefault(event gui.QDragEnterEv
 
 //export callbackQHelpSearchResultWidget_DragLeaveEvent
 func callbackQHelpSearchResultWidget_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -11335,7 +11546,7 @@ func (ptr *QHelpSearchResultWidget) DragLeaveEventDefault(event gui.QDragLeaveEv
 
 //export callbackQHelpSearchResultWidget_DragMoveEvent
 func callbackQHelpSearchResultWidget_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -11350,7 +11561,7 @@ func (ptr *QHelpSearchResultWidget) DragMoveEventDefault(event gui.QDragMoveEven
 
 //export callbackQHelpSearchResultWidget_DropEvent
 func callbackQHelpSearchResultWidget_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -11365,7 +11576,7 @@ func (ptr *QHelpSearchResultWidget) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQHelpSearchResultWidget_EnterEvent
 func callbackQHelpSearchResultWidget_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -11380,7 +11591,7 @@ func (ptr *QHelpSearchResultWidget) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpSearchResultWidget_FocusInEvent
 func callbackQHelpSearchResultWidget_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -11395,7 +11606,7 @@ func (ptr *QHelpSearchResultWidget) FocusInEventDefault(event gui.QFocusEvent_IT
 
 //export callbackQHelpSearchResultWidget_FocusOutEvent
 func callbackQHelpSearchResultWidget_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -11410,7 +11621,7 @@ func (ptr *QHelpSearchResultWidget) FocusOutEventDefault(event gui.QFocusEvent_I
 
 //export callbackQHelpSearchResultWidget_Hide
 func callbackQHelpSearchResultWidget_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).HideDefault()
@@ -11425,7 +11636,7 @@ func (ptr *QHelpSearchResultWidget) HideDefault() {
 
 //export callbackQHelpSearchResultWidget_HideEvent
 func callbackQHelpSearchResultWidget_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -11440,7 +11651,7 @@ func (ptr *QHelpSearchResultWidget) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQHelpSearchResultWidget_InputMethodEvent
 func callbackQHelpSearchResultWidget_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -11455,7 +11666,7 @@ func (ptr *QHelpSearchResultWidget) InputMethodEventDefault(event gui.QInputMeth
 
 //export callbackQHelpSearchResultWidget_KeyPressEvent
 func callbackQHelpSearchResultWidget_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -11470,7 +11681,7 @@ func (ptr *QHelpSearchResultWidget) KeyPressEventDefault(event gui.QKeyEvent_ITF
 
 //export callbackQHelpSearchResultWidget_KeyReleaseEvent
 func callbackQHelpSearchResultWidget_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -11485,7 +11696,7 @@ func (ptr *QHelpSearchResultWidget) KeyReleaseEventDefault(event gui.QKeyEvent_I
 
 //export callbackQHelpSearchResultWidget_LeaveEvent
 func callbackQHelpSearchResultWidget_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -11500,7 +11711,7 @@ func (ptr *QHelpSearchResultWidget) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpSearchResultWidget_Lower
 func callbackQHelpSearchResultWidget_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).LowerDefault()
@@ -11515,7 +11726,7 @@ func (ptr *QHelpSearchResultWidget) LowerDefault() {
 
 //export callbackQHelpSearchResultWidget_MouseDoubleClickEvent
 func callbackQHelpSearchResultWidget_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -11530,7 +11741,7 @@ func (ptr *QHelpSearchResultWidget) MouseDoubleClickEventDefault(event gui.QMous
 
 //export callbackQHelpSearchResultWidget_MouseMoveEvent
 func callbackQHelpSearchResultWidget_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -11545,7 +11756,7 @@ func (ptr *QHelpSearchResultWidget) MouseMoveEventDefault(event gui.QMouseEvent_
 
 //export callbackQHelpSearchResultWidget_MousePressEvent
 func callbackQHelpSearchResultWidget_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -11560,7 +11771,7 @@ func (ptr *QHelpSearchResultWidget) MousePressEventDefault(event gui.QMouseEvent
 
 //export callbackQHelpSearchResultWidget_MouseReleaseEvent
 func callbackQHelpSearchResultWidget_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -11575,7 +11786,7 @@ func (ptr *QHelpSearchResultWidget) MouseReleaseEventDefault(event gui.QMouseEve
 
 //export callbackQHelpSearchResultWidget_MoveEvent
 func callbackQHelpSearchResultWidget_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -11590,7 +11801,7 @@ func (ptr *QHelpSearchResultWidget) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQHelpSearchResultWidget_PaintEvent
 func callbackQHelpSearchResultWidget_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -11605,7 +11816,7 @@ func (ptr *QHelpSearchResultWidget) PaintEventDefault(event gui.QPaintEvent_ITF)
 
 //export callbackQHelpSearchResultWidget_Raise
 func callbackQHelpSearchResultWidget_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).RaiseDefault()
@@ -11620,7 +11831,7 @@ func (ptr *QHelpSearchResultWidget) RaiseDefault() {
 
 //export callbackQHelpSearchResultWidget_Repaint
 func callbackQHelpSearchResultWidget_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).RepaintDefault()
@@ -11635,7 +11846,7 @@ func (ptr *QHelpSearchResultWidget) RepaintDefault() {
 
 //export callbackQHelpSearchResultWidget_ResizeEvent
 func callbackQHelpSearchResultWidget_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -11650,7 +11861,7 @@ func (ptr *QHelpSearchResultWidget) ResizeEventDefault(event gui.QResizeEvent_IT
 
 //export callbackQHelpSearchResultWidget_SetDisabled
 func callbackQHelpSearchResultWidget_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -11665,7 +11876,7 @@ func (ptr *QHelpSearchResultWidget) SetDisabledDefault(disable bool) {
 
 //export callbackQHelpSearchResultWidget_SetEnabled
 func callbackQHelpSearchResultWidget_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -11680,7 +11891,7 @@ func (ptr *QHelpSearchResultWidget) SetEnabledDefault(vbo bool) {
 
 //export callbackQHelpSearchResultWidget_SetFocus2
 func callbackQHelpSearchResultWidget_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).SetFocus2Default()
@@ -11695,7 +11906,7 @@ func (ptr *QHelpSearchResultWidget) SetFocus2Default() {
 
 //export callbackQHelpSearchResultWidget_SetHidden
 func callbackQHelpSearchResultWidget_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -11710,7 +11921,7 @@ func (ptr *QHelpSearchResultWidget) SetHiddenDefault(hidden bool) {
 
 //export callbackQHelpSearchResultWidget_SetStyleSheet
 func callbackQHelpSearchResultWidget_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -11727,7 +11938,7 @@ func (ptr *QHelpSearchResultWidget) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQHelpSearchResultWidget_SetVisible
 func callbackQHelpSearchResultWidget_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -11742,7 +11953,7 @@ func (ptr *QHelpSearchResultWidget) SetVisibleDefault(visible bool) {
 
 //export callbackQHelpSearchResultWidget_SetWindowModified
 func callbackQHelpSearchResultWidget_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -11757,7 +11968,7 @@ func (ptr *QHelpSearchResultWidget) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQHelpSearchResultWidget_SetWindowTitle
 func callbackQHelpSearchResultWidget_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -11774,7 +11985,7 @@ func (ptr *QHelpSearchResultWidget) SetWindowTitleDefault(vqs string) {
 
 //export callbackQHelpSearchResultWidget_Show
 func callbackQHelpSearchResultWidget_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ShowDefault()
@@ -11789,7 +12000,7 @@ func (ptr *QHelpSearchResultWidget) ShowDefault() {
 
 //export callbackQHelpSearchResultWidget_ShowEvent
 func callbackQHelpSearchResultWidget_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -11804,7 +12015,7 @@ func (ptr *QHelpSearchResultWidget) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQHelpSearchResultWidget_ShowFullScreen
 func callbackQHelpSearchResultWidget_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ShowFullScreenDefault()
@@ -11819,7 +12030,7 @@ func (ptr *QHelpSearchResultWidget) ShowFullScreenDefault() {
 
 //export callbackQHelpSearchResultWidget_ShowMaximized
 func callbackQHelpSearchResultWidget_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ShowMaximizedDefault()
@@ -11834,7 +12045,7 @@ func (ptr *QHelpSearchResultWidget) ShowMaximizedDefault() {
 
 //export callbackQHelpSearchResultWidget_ShowMinimized
 func callbackQHelpSearchResultWidget_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ShowMinimizedDefault()
@@ -11849,7 +12060,7 @@ func (ptr *QHelpSearchResultWidget) ShowMinimizedDefault() {
 
 //export callbackQHelpSearchResultWidget_ShowNormal
 func callbackQHelpSearchResultWidget_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ShowNormalDefault()
@@ -11864,7 +12075,7 @@ func (ptr *QHelpSearchResultWidget) ShowNormalDefault() {
 
 //export callbackQHelpSearchResultWidget_TabletEvent
 func callbackQHelpSearchResultWidget_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -11879,7 +12090,7 @@ func (ptr *QHelpSearchResultWidget) TabletEventDefault(event gui.QTabletEvent_IT
 
 //export callbackQHelpSearchResultWidget_Update
 func callbackQHelpSearchResultWidget_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).UpdateDefault()
@@ -11894,7 +12105,7 @@ func (ptr *QHelpSearchResultWidget) UpdateDefault() {
 
 //export callbackQHelpSearchResultWidget_UpdateMicroFocus
 func callbackQHelpSearchResultWidget_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).UpdateMicroFocusDefault()
@@ -11909,7 +12120,7 @@ func (ptr *QHelpSearchResultWidget) UpdateMicroFocusDefault() {
 
 //export callbackQHelpSearchResultWidget_WheelEvent
 func callbackQHelpSearchResultWidget_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -11924,7 +12135,7 @@ func (ptr *QHelpSearchResultWidget) WheelEventDefault(event gui.QWheelEvent_ITF)
 
 //export callbackQHelpSearchResultWidget_WindowIconChanged
 func callbackQHelpSearchResultWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -11932,7 +12143,7 @@ func callbackQHelpSearchResultWidget_WindowIconChanged(ptr unsafe.Pointer, icon
 
 //export callbackQHelpSearchResultWidget_WindowTitleChanged
 func callbackQHelpSearchResultWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -11940,7 +12151,7 @@ func callbackQHelpSearchResultWidget_WindowTitleChanged(ptr unsafe.Pointer, titl
 
 //export callbackQHelpSearchResultWidget_PaintEngine
 func callbackQHelpSearchResultWidget_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -11956,7 +12167,7 @@ func (ptr *QHelpSearchResultWidget) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQHelpSearchResultWidget_MinimumSizeHint
 func callbackQHelpSearchResultWidget_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -11974,7 +12185,7 @@ func (ptr *QHelpSearchResultWidget) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQHelpSearchResultWidget_SizeHint
 func callbackQHelpSearchResultWidget_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -11992,7 +12203,7 @@ func (ptr *QHelpSearchResultWidget) SizeHintDefault() *core.QSize {
 
 //export callbackQHelpSearchResultWidget_InputMethodQuery
 func callbackQHelpSearchResultWidget_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -12010,7 +12221,7 @@ func (ptr *QHelpSearchResultWidget) InputMethodQueryDefault(query core.Qt__Input
 
 //export callbackQHelpSearchResultWidget_HasHeightForWidth
 func callbackQHelpSearchResultWidget_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -12026,7 +12237,7 @@ func (ptr *QHelpSearchResultWidget) HasHeightForWidthDefault() bool {
 
 //export callbackQHelpSearchResultWidget_HeightForWidth
 func callbackQHelpSearchResultWidget_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -12042,7 +12253,7 @@ func (ptr *QHelpSearchResultWidget) HeightForWidthDefault(w int) int {
 
 //export callbackQHelpSearchResultWidget_Metric
 func callbackQHelpSearchResultWidget_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -12058,7 +12269,7 @@ func (ptr *QHelpSearchResultWidget) MetricDefault(m gui.QPaintDevice__PaintDevic
 
 //export callbackQHelpSearchResultWidget_EventFilter
 func callbackQHelpSearchResultWidget_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -12074,7 +12285,7 @@ func (ptr *QHelpSearchResultWidget) EventFilterDefault(watched core.QObject_ITF,
 
 //export callbackQHelpSearchResultWidget_ChildEvent
 func callbackQHelpSearchResultWidget_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -12089,7 +12300,7 @@ func (ptr *QHelpSearchResultWidget) ChildEventDefault(event core.QChildEvent_ITF
 
 //export callbackQHelpSearchResultWidget_ConnectNotify
 func callbackQHelpSearchResultWidget_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -12104,7 +12315,7 @@ func (ptr *QHelpSearchResultWidget) ConnectNotifyDefault(sign core.QMetaMethod_I
 
 //export callbackQHelpSearchResultWidget_CustomEvent
 func callbackQHelpSearchResultWidget_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -12119,7 +12330,7 @@ func (ptr *QHelpSearchResultWidget) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHelpSearchResultWidget_DeleteLater
 func callbackQHelpSearchResultWidget_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).DeleteLaterDefault()
@@ -12129,14 +12340,14 @@ func callbackQHelpSearchResultWidget_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QHelpSearchResultWidget) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QHelpSearchResultWidget_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHelpSearchResultWidget_Destroyed
 func callbackQHelpSearchResultWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -12144,7 +12355,7 @@ func callbackQHelpSearchResultWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Po
 
 //export callbackQHelpSearchResultWidget_DisconnectNotify
 func callbackQHelpSearchResultWidget_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -12159,7 +12370,7 @@ func (ptr *QHelpSearchResultWidget) DisconnectNotifyDefault(sign core.QMetaMetho
 
 //export callbackQHelpSearchResultWidget_ObjectNameChanged
 func callbackQHelpSearchResultWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtHelp_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -12167,7 +12378,7 @@ func callbackQHelpSearchResultWidget_ObjectNameChanged(ptr unsafe.Pointer, objec
 
 //export callbackQHelpSearchResultWidget_TimerEvent
 func callbackQHelpSearchResultWidget_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQHelpSearchResultWidgetFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -12182,7 +12393,7 @@ func (ptr *QHelpSearchResultWidget) TimerEventDefault(event core.QTimerEvent_ITF
 
 //export callbackQHelpSearchResultWidget_MetaObject
 func callbackQHelpSearchResultWidget_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
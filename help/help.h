@@ -36,6 +36,7 @@ void* QHelpContentModel_Parent(void* ptr, void* index);
 void* QHelpContentModel_ParentDefault(void* ptr, void* index);
 void* QHelpContentModel_Data(void* ptr, void* index, int role);
 void* QHelpContentModel_DataDefault(void* ptr, void* index, int role);
+void QHelpContentModel_DataDefaultInto(void* ptr, void* index, int role, void* ret);
 char QHelpContentModel_IsCreatingContents(void* ptr);
 int QHelpContentModel_ColumnCount(void* ptr, void* parent);
 int QHelpContentModel_ColumnCountDefault(void* ptr, void* parent);
@@ -54,6 +55,8 @@ void* QHelpContentModel___changePersistentIndexList_to_newList(void* ptr);
 int QHelpContentModel___dataChanged_roles_atList(void* ptr, int i);
 void QHelpContentModel___dataChanged_roles_setList(void* ptr, int i);
 void* QHelpContentModel___dataChanged_roles_newList(void* ptr);
+void* QHelpContentModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count);
+void QHelpContentModel___dataChanged_roles_fillList(void* ptr, void* data);
 void* QHelpContentModel___layoutAboutToBeChanged_parents_atList(void* ptr, int i);
 void QHelpContentModel___layoutAboutToBeChanged_parents_setList(void* ptr, void* i);
 void* QHelpContentModel___layoutAboutToBeChanged_parents_newList(void* ptr);
@@ -80,18 +83,28 @@ void* QHelpContentModel___persistentIndexList_newList(void* ptr);
 int QHelpContentModel_____setItemData_keyList_atList(void* ptr, int i);
 void QHelpContentModel_____setItemData_keyList_setList(void* ptr, int i);
 void* QHelpContentModel_____setItemData_keyList_newList(void* ptr);
+void* QHelpContentModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpContentModel_____setItemData_keyList_fillList(void* ptr, void* data);
 int QHelpContentModel_____doSetRoleNames_keyList_atList(void* ptr, int i);
 void QHelpContentModel_____doSetRoleNames_keyList_setList(void* ptr, int i);
 void* QHelpContentModel_____doSetRoleNames_keyList_newList(void* ptr);
+void* QHelpContentModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpContentModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data);
 int QHelpContentModel_____setRoleNames_keyList_atList(void* ptr, int i);
 void QHelpContentModel_____setRoleNames_keyList_setList(void* ptr, int i);
 void* QHelpContentModel_____setRoleNames_keyList_newList(void* ptr);
+void* QHelpContentModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpContentModel_____setRoleNames_keyList_fillList(void* ptr, void* data);
 int QHelpContentModel_____roleNames_keyList_atList(void* ptr, int i);
 void QHelpContentModel_____roleNames_keyList_setList(void* ptr, int i);
 void* QHelpContentModel_____roleNames_keyList_newList(void* ptr);
+void* QHelpContentModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpContentModel_____roleNames_keyList_fillList(void* ptr, void* data);
 int QHelpContentModel_____itemData_keyList_atList(void* ptr, int i);
 void QHelpContentModel_____itemData_keyList_setList(void* ptr, int i);
 void* QHelpContentModel_____itemData_keyList_newList(void* ptr);
+void* QHelpContentModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpContentModel_____itemData_keyList_fillList(void* ptr, void* data);
 void* QHelpContentModel___dynamicPropertyNames_atList(void* ptr, int i);
 void QHelpContentModel___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QHelpContentModel___dynamicPropertyNames_newList(void* ptr);
@@ -153,6 +166,8 @@ void QHelpContentWidget_LinkActivated(void* ptr, void* link);
 int QHelpContentWidget___dataChanged_roles_atList(void* ptr, int i);
 void QHelpContentWidget___dataChanged_roles_setList(void* ptr, int i);
 void* QHelpContentWidget___dataChanged_roles_newList(void* ptr);
+void* QHelpContentWidget___dataChanged_roles_newListBuffer(void* ptr, void* data, int count);
+void QHelpContentWidget___dataChanged_roles_fillList(void* ptr, void* data);
 void* QHelpContentWidget___selectedIndexes_atList(void* ptr, int i);
 void QHelpContentWidget___selectedIndexes_setList(void* ptr, void* i);
 void* QHelpContentWidget___selectedIndexes_newList(void* ptr);
@@ -410,12 +425,18 @@ void* QHelpIndexModel_____linksForKeyword_keyList_newList(void* ptr);
 int QHelpIndexModel_____setItemData_keyList_atList(void* ptr, int i);
 void QHelpIndexModel_____setItemData_keyList_setList(void* ptr, int i);
 void* QHelpIndexModel_____setItemData_keyList_newList(void* ptr);
+void* QHelpIndexModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpIndexModel_____setItemData_keyList_fillList(void* ptr, void* data);
 int QHelpIndexModel_____roleNames_keyList_atList(void* ptr, int i);
 void QHelpIndexModel_____roleNames_keyList_setList(void* ptr, int i);
 void* QHelpIndexModel_____roleNames_keyList_newList(void* ptr);
+void* QHelpIndexModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpIndexModel_____roleNames_keyList_fillList(void* ptr, void* data);
 int QHelpIndexModel_____itemData_keyList_atList(void* ptr, int i);
 void QHelpIndexModel_____itemData_keyList_setList(void* ptr, int i);
 void* QHelpIndexModel_____itemData_keyList_newList(void* ptr);
+void* QHelpIndexModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpIndexModel_____itemData_keyList_fillList(void* ptr, void* data);
 void* QHelpIndexModel___setItemData_roles_atList(void* ptr, int i);
 void QHelpIndexModel___setItemData_roles_setList(void* ptr, int key, void* i);
 void* QHelpIndexModel___setItemData_roles_newList(void* ptr);
@@ -429,6 +450,8 @@ void* QHelpIndexModel___changePersistentIndexList_to_newList(void* ptr);
 int QHelpIndexModel___dataChanged_roles_atList(void* ptr, int i);
 void QHelpIndexModel___dataChanged_roles_setList(void* ptr, int i);
 void* QHelpIndexModel___dataChanged_roles_newList(void* ptr);
+void* QHelpIndexModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count);
+void QHelpIndexModel___dataChanged_roles_fillList(void* ptr, void* data);
 void* QHelpIndexModel___layoutAboutToBeChanged_parents_atList(void* ptr, int i);
 void QHelpIndexModel___layoutAboutToBeChanged_parents_setList(void* ptr, void* i);
 void* QHelpIndexModel___layoutAboutToBeChanged_parents_newList(void* ptr);
@@ -455,9 +478,13 @@ void* QHelpIndexModel___persistentIndexList_newList(void* ptr);
 int QHelpIndexModel_____doSetRoleNames_keyList_atList(void* ptr, int i);
 void QHelpIndexModel_____doSetRoleNames_keyList_setList(void* ptr, int i);
 void* QHelpIndexModel_____doSetRoleNames_keyList_newList(void* ptr);
+void* QHelpIndexModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpIndexModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data);
 int QHelpIndexModel_____setRoleNames_keyList_atList(void* ptr, int i);
 void QHelpIndexModel_____setRoleNames_keyList_setList(void* ptr, int i);
 void* QHelpIndexModel_____setRoleNames_keyList_newList(void* ptr);
+void* QHelpIndexModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QHelpIndexModel_____setRoleNames_keyList_fillList(void* ptr, void* data);
 void* QHelpIndexModel___dynamicPropertyNames_atList(void* ptr, int i);
 void QHelpIndexModel___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QHelpIndexModel___dynamicPropertyNames_newList(void* ptr);
@@ -479,6 +506,7 @@ char QHelpIndexModel_SetDataDefault(void* ptr, void* index, void* value, int rol
 void QHelpIndexModel_SortDefault(void* ptr, int column, long long order);
 void* QHelpIndexModel_SiblingDefault(void* ptr, int row, int column, void* idx);
 void* QHelpIndexModel_DataDefault(void* ptr, void* index, int role);
+void QHelpIndexModel_DataDefaultInto(void* ptr, void* index, int role, void* ret);
 long long QHelpIndexModel_SupportedDropActionsDefault(void* ptr);
 long long QHelpIndexModel_FlagsDefault(void* ptr, void* index);
 int QHelpIndexModel_RowCountDefault(void* ptr, void* parent);
@@ -537,6 +565,8 @@ void* QHelpIndexWidget_____linksActivated_keyList_newList(void* ptr);
 int QHelpIndexWidget___dataChanged_roles_atList(void* ptr, int i);
 void QHelpIndexWidget___dataChanged_roles_setList(void* ptr, int i);
 void* QHelpIndexWidget___dataChanged_roles_newList(void* ptr);
+void* QHelpIndexWidget___dataChanged_roles_newListBuffer(void* ptr, void* data, int count);
+void QHelpIndexWidget___dataChanged_roles_fillList(void* ptr, void* data);
 void* QHelpIndexWidget___indexesMoved_indexes_atList(void* ptr, int i);
 void QHelpIndexWidget___indexesMoved_indexes_setList(void* ptr, void* i);
 void* QHelpIndexWidget___indexesMoved_indexes_newList(void* ptr);
@@ -0,0 +1,190 @@
+package qt
+
+import (
+	"context"
+	"fmt"
+	"os"
+	"sort"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+//callbacks generated with QT_INSTRUMENT=true report to CallbackStart and CallbackEnd,
+//nothing is recorded until EnableCallbackStats is called or QT_CALLBACK_STATS is set
+
+//CallbackBuckets is the number of latency buckets, bucket i counts the calls that took less than 1µs<<i
+//and the last bucket counts everything slower
+const CallbackBuckets = 24
+
+type callbackKey struct {
+	class  string
+	signal string
+}
+
+//the counters are updated atomically, so the struct is only ever used through a pointer
+type callbackCounters struct {
+	count   uint64
+	total   uint64
+	max     uint64
+	buckets [CallbackBuckets]uint64
+}
+
+var (
+	callbackStatsMode int32 //0 off, 1 on, 2 on with pprof labels
+
+	callbackStats      = make(map[callbackKey]*callbackCounters)
+	callbackStatsMutex = new(sync.RWMutex)
+)
+
+func init() {
+	switch strings.ToLower(os.Getenv("QT_CALLBACK_STATS")) {
+	case "true":
+		EnableCallbackStats(true, false)
+	case "labels":
+		EnableCallbackStats(true, true)
+	}
+}
+
+//EnableCallbackStats turns the recording of the instrumented callbacks on or off,
+//with labels every callback also runs with a "qt_callback" pprof label set to "Class::signal",
+//so that cpu profiles can be broken down by callback, labels need go1.9 and are ignored before
+func EnableCallbackStats(enable, labels bool) {
+	var mode int32
+	if enable {
+		mode = 1
+		if labels {
+			mode = 2
+		}
+	}
+	atomic.StoreInt32(&callbackStatsMode, mode)
+}
+
+//CallbackToken carries the state of a running callback from CallbackStart to CallbackEnd
+type CallbackToken struct {
+	class  string
+	signal string
+	start  time.Time
+	prev   context.Context //the labels to restore, nil without labels
+}
+
+//CallbackStart is called on entry of an instrumented callback, it's a single atomic load while disabled
+func CallbackStart(class, signal string) CallbackToken {
+	var mode = atomic.LoadInt32(&callbackStatsMode)
+	if mode == 0 {
+		return CallbackToken{}
+	}
+	var prev context.Context
+	if mode == 2 {
+		prev = setCallbackLabel(class, signal)
+	}
+	return CallbackToken{class, signal, time.Now(), prev}
+}
+
+//CallbackEnd is deferred by an instrumented callback with the token returned by CallbackStart
+func CallbackEnd(t CallbackToken) {
+	if t.start.IsZero() {
+		return
+	}
+	var d = uint64(time.Since(t.start))
+	if t.prev != nil {
+		restoreCallbackLabel(t.prev)
+	}
+
+	var key = callbackKey{t.class, t.signal}
+	callbackStatsMutex.RLock()
+	var c = callbackStats[key]
+	callbackStatsMutex.RUnlock()
+	if c == nil {
+		callbackStatsMutex.Lock()
+		if c = callbackStats[key]; c == nil {
+			c = new(callbackCounters)
+			callbackStats[key] = c
+		}
+		callbackStatsMutex.Unlock()
+	}
+
+	atomic.AddUint64(&c.count, 1)
+	atomic.AddUint64(&c.total, d)
+	for {
+		var max = atomic.LoadUint64(&c.max)
+		if d <= max || atomic.CompareAndSwapUint64(&c.max, max, d) {
+			break
+		}
+	}
+	atomic.AddUint64(&c.buckets[callbackBucket(d)], 1)
+}
+
+func callbackBucket(d uint64) int {
+	var b int
+	for limit := uint64(time.Microsecond); d >= limit && b < CallbackBuckets-1; limit <<= 1 {
+		b++
+	}
+	return b
+}
+
+//CallbackStat is a snapshot of the recorded calls of a single callback
+type CallbackStat struct {
+	Class     string
+	Signal    string
+	Count     uint64
+	Total     time.Duration
+	Max       time.Duration
+	Histogram [CallbackBuckets]uint64
+}
+
+func (s CallbackStat) Mean() time.Duration {
+	if s.Count == 0 {
+		return 0
+	}
+	return s.Total / time.Duration(s.Count)
+}
+
+//CallbackStats returns the recorded callbacks, the ones that took the most time in total first
+func CallbackStats() []CallbackStat {
+	callbackStatsMutex.RLock()
+	var out = make([]CallbackStat, 0, len(callbackStats))
+	for key, c := range callbackStats {
+		var s = CallbackStat{
+			Class:  key.class,
+			Signal: key.signal,
+			Count:  atomic.LoadUint64(&c.count),
+			Total:  time.Duration(atomic.LoadUint64(&c.total)),
+			Max:    time.Duration(atomic.LoadUint64(&c.max)),
+		}
+		for i := range c.buckets {
+			s.Histogram[i] = atomic.LoadUint64(&c.buckets[i])
+		}
+		out = append(out, s)
+	}
+	callbackStatsMutex.RUnlock()
+
+	sort.Sort(byCallbackTotal(out))
+	return out
+}
+
+type byCallbackTotal []CallbackStat
+
+func (s byCallbackTotal) Len() int      { return len(s) }
+func (s byCallbackTotal) Swap(i, j int) { s[i], s[j] = s[j], s[i] }
+func (s byCallbackTotal) Less(i, j int) bool {
+	if s[i].Total != s[j].Total {
+		return s[i].Total > s[j].Total
+	}
+	return s[i].Class+s[i].Signal < s[j].Class+s[j].Signal
+}
+
+func ResetCallbackStats() {
+	callbackStatsMutex.Lock()
+	callbackStats = make(map[callbackKey]*callbackCounters)
+	callbackStatsMutex.Unlock()
+}
+
+func DumpCallbackStats() {
+	Logger.Println("##############################\tCALLBACKSTATS_START\t##############################")
+	for _, s := range CallbackStats() {
+		Logger.Println(fmt.Sprintf("%v::%v\tcalls: %v\ttotal: %v\tmean: %v\tmax: %v", s.Class, s.Signal, s.Count, s.Total, s.Mean(), s.Max))
+	}
+	Logger.Println("##############################\tCALLBACKSTATS_END\t##############################")
+}
@@ -0,0 +1,57 @@
+//go:build go1.9
+// +build go1.9
+
+package qt
+
+import (
+	"bytes"
+	"context"
+	"runtime"
+	"runtime/pprof"
+	"strconv"
+	"sync"
+)
+
+//pprof can't report the labels a goroutine currently has, so the ones set by the running callbacks are kept here,
+//that way a nested callback restores the labels of the callback it was called from once it returns
+var (
+	callbackLabels      = make(map[uint64]context.Context)
+	callbackLabelsMutex = new(sync.Mutex)
+)
+
+func setCallbackLabel(class, signal string) context.Context {
+	var id = goroutineID()
+	callbackLabelsMutex.Lock()
+	var prev, ok = callbackLabels[id]
+	if !ok {
+		prev = context.Background()
+	}
+	var ctx = pprof.WithLabels(prev, pprof.Labels("qt_callback", class+"::"+signal))
+	callbackLabels[id] = ctx
+	callbackLabelsMutex.Unlock()
+	pprof.SetGoroutineLabels(ctx)
+	return prev
+}
+
+func restoreCallbackLabel(prev context.Context) {
+	var id = goroutineID()
+	callbackLabelsMutex.Lock()
+	if prev == context.Background() {
+		delete(callbackLabels, id)
+	} else {
+		callbackLabels[id] = prev
+	}
+	callbackLabelsMutex.Unlock()
+	pprof.SetGoroutineLabels(prev)
+}
+
+//goroutineID parses the id from the "goroutine 1 [running]:" header of the stack trace
+func goroutineID() uint64 {
+	var buf [64]byte
+	var b = bytes.TrimPrefix(buf[:runtime.Stack(buf[:], false)], []byte("goroutine "))
+	if i := bytes.IndexByte(b, ' '); i >= 0 {
+		b = b[:i]
+	}
+	var id, _ = strconv.ParseUint(string(b), 10, 64)
+	return id
+}
@@ -0,0 +1,29 @@
+//go:build go1.9
+// +build go1.9
+
+package qt
+
+import (
+	"context"
+	"testing"
+
+	assert "github.com/stretchr/testify/require"
+)
+
+func TestCallbackLabelsNested(t *testing.T) {
+	EnableCallbackStats(true, true)
+	defer EnableCallbackStats(false, false)
+	defer ResetCallbackStats()
+
+	var outer = CallbackStart("QWidget", "paintEvent")
+	assert.Equal(t, context.Background(), outer.prev)
+	var outerLabels = callbackLabels[goroutineID()]
+
+	var inner = CallbackStart("QAbstractItemModel", "data")
+	assert.Equal(t, outerLabels, inner.prev)
+	CallbackEnd(inner)
+	assert.Equal(t, outerLabels, callbackLabels[goroutineID()])
+
+	CallbackEnd(outer)
+	assert.Len(t, callbackLabels, 0)
+}
@@ -0,0 +1,12 @@
+//go:build !go1.9
+// +build !go1.9
+
+package qt
+
+import "context"
+
+//pprof labels were added in go1.9, before that the callbacks are only timed
+
+func setCallbackLabel(class, signal string) context.Context { return nil }
+
+func restoreCallbackLabel(prev context.Context) {}
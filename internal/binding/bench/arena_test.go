@@ -0,0 +1,28 @@
+package bench
+
+import (
+	"testing"
+
+	"github.com/therecipe/qt/core"
+)
+
+//roughly the geometry a paint handler creates for one frame
+const pointsPerFrame = 300
+
+func BenchmarkQPointF(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		for j := 0; j < pointsPerFrame; j++ {
+			core.NewQPointF3(float64(j), float64(i))
+		}
+	}
+}
+
+func BenchmarkQPointFArena(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		core.WithArena(func(a *core.Arena) {
+			for j := 0; j < pointsPerFrame; j++ {
+				a.NewQPointF3(float64(j), float64(i))
+			}
+		})
+	}
+}
@@ -0,0 +1,150 @@
+package bench
+
+import (
+	"runtime"
+	"testing"
+
+	"github.com/therecipe/qt"
+	"github.com/therecipe/qt/charts"
+	"github.com/therecipe/qt/core"
+	"github.com/therecipe/qt/gui"
+	"github.com/therecipe/qt/widgets"
+)
+
+//plain calls
+
+func BenchmarkQPointFX(b *testing.B) {
+	var p = core.NewQPointF3(1, 2)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		p.X()
+	}
+}
+
+//strings in and out
+
+func BenchmarkSetObjectName(b *testing.B) {
+	var obj = core.NewQObject(nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		obj.SetObjectName("benchmark")
+	}
+}
+
+func BenchmarkObjectName(b *testing.B) {
+	var obj = core.NewQObject(nil)
+	obj.SetObjectName("benchmark")
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		obj.ObjectName()
+	}
+}
+
+//list marshalling
+
+func BenchmarkQXYSeriesAppend(b *testing.B) {
+	var (
+		//the checked in charts module doesn't embed the base classes, so the series is used through its QXYSeries
+		series = charts.NewQXYSeriesFromPointer(charts.NewQLineSeries(nil).Pointer())
+		points = make([]*core.QPointF, pointsPerFrame)
+	)
+	for i := range points {
+		points[i] = core.NewQPointF3(float64(i), float64(i))
+	}
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		series.Clear()
+		series.Append3(points)
+	}
+}
+
+func BenchmarkRoleNames(b *testing.B) {
+	var model = core.NewQAbstractListModel(nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		model.RoleNames()
+	}
+}
+
+//virtual callbacks, the model data callback is covered by BenchmarkData
+
+func BenchmarkPaintEvent(b *testing.B) {
+	qt.RunOnMainSync(func() {
+		var (
+			widget = widgets.NewQWidget(nil, 0)
+			rect   = core.NewQRect4(0, 0, -1, -1)
+		)
+		widget.Resize2(16, 16)
+		widget.ConnectPaintEvent(func(event *gui.QPaintEvent) {})
+
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			widget.Grab(rect).DestroyQPixmap()
+		}
+		b.StopTimer()
+
+		widget.DestroyQWidget()
+	})
+}
+
+//signal emission
+
+func BenchmarkObjectNameChanged(b *testing.B) {
+	var (
+		obj   = core.NewQObject(nil)
+		names = []string{"a", "b"}
+		n     int
+	)
+	obj.ConnectObjectNameChanged(func(string) { n++ })
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		obj.SetObjectName(names[i%2])
+	}
+}
+
+//timeout is a private signal, so it's emitted by a zero interval timer on the qt thread instead
+func BenchmarkTimerTimeout(b *testing.B) {
+	var (
+		timer *core.QTimer
+		done  = make(chan struct{})
+		n     int
+	)
+	qt.RunOnMainSync(func() {
+		timer = core.NewQTimer(nil)
+		timer.ConnectTimeout(func() {
+			if n++; n == b.N {
+				timer.Stop()
+				close(done)
+			}
+		})
+	})
+
+	b.ResetTimer()
+	qt.RunOnMainSync(func() { timer.Start(0) })
+	<-done
+	b.StopTimer()
+
+	qt.RunOnMainSync(func() { timer.DestroyQTimer() })
+}
+
+//object creation and destruction
+
+func BenchmarkNewQObject(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		core.NewQObject(nil).DestroyQObject()
+	}
+}
+
+func BenchmarkNewQPointFDestroy(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		core.NewQPointF3(float64(i), 0).DestroyQPointF()
+	}
+}
+
+//the values are released by their finalizers, the collection is part of the measurement
+func BenchmarkNewQPointFFinalizer(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		core.NewQPointF3(float64(i), 0)
+	}
+	runtime.GC()
+}
@@ -0,0 +1,38 @@
+package bench
+
+import (
+	"runtime"
+	"testing"
+
+	"github.com/therecipe/qt/core"
+)
+
+const updatesPerFlush = 100000
+
+func BenchmarkPropertyUpdates(b *testing.B) {
+	var timer = core.NewQTimer(nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for j := 0; j < updatesPerFlush; j++ {
+			timer.SetInterval(j)
+		}
+	}
+}
+
+func BenchmarkPropertyUpdatesBatched(b *testing.B) {
+	//the timer has to stay on the thread that created it, otherwise a flush waits for that thread's event loop
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+
+	var (
+		timer = core.NewQTimer(nil)
+		buf   = core.NewCommandBuffer()
+	)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for j := 0; j < updatesPerFlush; j++ {
+			buf.SetInt(timer, "interval", j)
+		}
+		buf.Flush()
+	}
+}
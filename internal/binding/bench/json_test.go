@@ -0,0 +1,118 @@
+package bench
+
+import (
+	"encoding/json"
+	"reflect"
+	"testing"
+
+	"github.com/therecipe/qt/core"
+)
+
+type jsonRow struct {
+	ID     int      `json:"id"`
+	Name   string   `json:"name"`
+	Score  float64  `json:"score"`
+	Active bool     `json:"active"`
+	Tags   []string `json:"tags"`
+}
+
+type jsonReply struct {
+	Count int       `json:"count"`
+	Rows  []jsonRow `json:"rows"`
+}
+
+//a rest like reply with the rows of variantPayload
+func jsonPayload(n int) []byte {
+	var b, _ = json.Marshal(variantPayload(n))
+	return b
+}
+
+func TestQJsonDocumentDecode(t *testing.T) {
+	var (
+		doc = core.QJsonDocument_FromJson(core.NewQByteArrayFromBytes(jsonPayload(3)), nil)
+		in  jsonReply
+		out jsonReply
+	)
+	if err := json.Unmarshal(jsonPayload(3), &in); err != nil {
+		t.Fatal(err)
+	}
+	if err := doc.Decode(&out); err != nil || !reflect.DeepEqual(in, out) {
+		t.Fatalf("decode changed the value: %v\n%v\n%v", err, in, out)
+	}
+
+	for _, v := range []interface{}{in, variantPayload(3)} {
+		var doc, err = core.NewQJsonDocumentFromGo(v)
+		if err != nil {
+			t.Fatal(err)
+		}
+		out = jsonReply{}
+		if err := doc.Decode(&out); err != nil || !reflect.DeepEqual(in, out) {
+			t.Fatalf("round trip changed the value: %v\n%v\n%v", err, in, out)
+		}
+	}
+}
+
+func TestNewQJsonDocumentFromGoScalar(t *testing.T) {
+	var nilSlice []int
+	for _, v := range []interface{}{42, "x", nil, nilSlice, []interface{}(nil), map[string]interface{}(nil)} {
+		if doc, err := core.NewQJsonDocumentFromGo(v); err == nil {
+			t.Fatalf("%#v was accepted: %v", v, doc)
+		}
+	}
+}
+
+//the previous way, one call per field
+func decodePerField(doc *core.QJsonDocument) (out jsonReply) {
+	var obj = doc.Object()
+	out.Count = int(obj.Value("count").ToDouble(0))
+	var rows = obj.Value("rows").ToArray2()
+	out.Rows = make([]jsonRow, rows.Size())
+	for i := range out.Rows {
+		var row = rows.At(i).ToObject2()
+		out.Rows[i].ID = int(row.Value("id").ToDouble(0))
+		out.Rows[i].Name = row.Value("name").ToString()
+		out.Rows[i].Score = row.Value("score").ToDouble(0)
+		out.Rows[i].Active = row.Value("active").ToBool(false)
+		var tags = row.Value("tags").ToArray2()
+		for j := 0; j < tags.Size(); j++ {
+			out.Rows[i].Tags = append(out.Rows[i].Tags, tags.At(j).ToString())
+		}
+	}
+	return
+}
+
+func BenchmarkQJsonDocumentPerField(b *testing.B) {
+	var doc = core.QJsonDocument_FromJson(core.NewQByteArrayFromBytes(jsonPayload(1000)), nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		decodePerField(doc)
+	}
+}
+
+func BenchmarkQJsonDocumentDecode(b *testing.B) {
+	var doc = core.QJsonDocument_FromJson(core.NewQByteArrayFromBytes(jsonPayload(1000)), nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		var out jsonReply
+		doc.Decode(&out)
+	}
+}
+
+func BenchmarkQByteArrayDecodeJSON(b *testing.B) {
+	var ba = core.NewQByteArrayFromBytes(jsonPayload(1000))
+	b.SetBytes(int64(ba.Size()))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		var out jsonReply
+		ba.DecodeJSON(&out)
+	}
+}
+
+func BenchmarkNewQJsonDocumentFromGo(b *testing.B) {
+	var payload = variantPayload(1000)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		var doc, _ = core.NewQJsonDocumentFromGo(payload)
+		doc.DestroyQJsonDocument()
+	}
+}
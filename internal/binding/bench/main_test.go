@@ -0,0 +1,27 @@
+package bench
+
+import (
+	"os"
+	"runtime"
+	"testing"
+
+	"github.com/therecipe/qt/widgets"
+)
+
+//the qt thread has to be the main thread
+func init() { runtime.LockOSThread() }
+
+//TestMain runs the event loop on the main thread while the benchmarks run next to it,
+//benchmarks that need the qt thread use qt.RunOnMainSync.
+//it defaults to the offscreen platform, so that the suite also runs headless
+func TestMain(m *testing.M) {
+	if os.Getenv("QT_QPA_PLATFORM") == "" {
+		os.Setenv("QT_QPA_PLATFORM", "offscreen")
+	}
+
+	widgets.NewQApplication(len(os.Args), os.Args)
+
+	go func() { os.Exit(m.Run()) }()
+
+	widgets.QApplication_Exec()
+}
@@ -0,0 +1,78 @@
+package bench
+
+import (
+	"testing"
+
+	"github.com/therecipe/qt"
+	"github.com/therecipe/qt/core"
+)
+
+func BenchmarkSetPropertyByName(b *testing.B) {
+	var timer = core.NewQTimer(nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		timer.SetProperty("interval", core.NewQVariant7(i%1000))
+	}
+}
+
+func BenchmarkMetaPropertyWriteInt(b *testing.B) {
+	var (
+		timer    = core.NewQTimer(nil)
+		interval = core.NewMetaProperty("interval")
+	)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		interval.WriteInt(timer, i%1000)
+	}
+}
+
+func BenchmarkPropertyByName(b *testing.B) {
+	var timer = core.NewQTimer(nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		timer.Property("interval").ToInt(false)
+	}
+}
+
+func BenchmarkMetaPropertyReadInt(b *testing.B) {
+	var (
+		timer    = core.NewQTimer(nil)
+		interval = core.NewMetaProperty("interval")
+	)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		interval.ReadInt(timer)
+	}
+}
+
+func TestMetaProperty(t *testing.T) {
+	var (
+		timer    = core.NewQTimer(nil)
+		interval = core.NewMetaProperty("interval")
+		name     = core.NewMetaProperty("objectName")
+	)
+	if !interval.WriteInt(timer, 42) || interval.ReadInt(timer) != 42 || timer.Interval() != 42 {
+		t.Fatal("interval wasn't written")
+	}
+	if !name.WriteString(timer, "timer") || name.ReadString(timer) != "timer" {
+		t.Fatal("objectName wasn't written")
+	}
+	if core.NewMetaProperty("missing").IsValid(timer) {
+		t.Fatal("missing property is valid")
+	}
+
+	qt.RunOnMainSync(func() {
+		var (
+			timer = core.NewQTimer(nil)
+			start = core.NewMetaMethod("start(int)")
+			stop  = core.NewMetaMethod("stop")
+		)
+		defer timer.DestroyQTimer()
+		if !start.InvokeInt(timer, 7) || !timer.IsActive() || timer.Interval() != 7 {
+			t.Fatal("start wasn't invoked")
+		}
+		if !stop.Invoke(timer) || timer.IsActive() {
+			t.Fatal("stop wasn't invoked")
+		}
+	})
+}
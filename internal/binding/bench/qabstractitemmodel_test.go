@@ -0,0 +1,62 @@
+package bench
+
+import (
+	"testing"
+
+	"github.com/therecipe/qt/core"
+)
+
+const rowCount = 10000
+
+func newListModel() *core.QAbstractListModel {
+	var model = core.NewQAbstractListModel(nil)
+	model.ConnectRowCount(func(parent *core.QModelIndex) int {
+		return rowCount
+	})
+	return model
+}
+
+func benchmarkData(b *testing.B, model *core.QAbstractListModel) {
+	var indexes = make([]*core.QModelIndex, rowCount)
+	for i := range indexes {
+		indexes[i] = model.Index(i, 0, core.NewQModelIndex())
+	}
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		model.Data(indexes[i%rowCount], int(core.Qt__DisplayRole)).DeleteQVariant()
+	}
+}
+
+func BenchmarkData(b *testing.B) {
+	var model = newListModel()
+	model.ConnectData(func(index *core.QModelIndex, role int) *core.QVariant {
+		return core.NewQVariant7(index.Row())
+	})
+	benchmarkData(b, model)
+}
+
+func BenchmarkDataInto(b *testing.B) {
+	var model = newListModel()
+	model.ConnectDataInto(func(index *core.QModelIndex, role int, ret *core.QVariant) {
+		ret.SetInt(index.Row())
+	})
+	benchmarkData(b, model)
+}
+
+func BenchmarkColumnTableModelUpdate(b *testing.B) {
+	const rows, batch = 500000, 10000
+
+	var model = core.NewColumnTableModel(nil)
+	model.AddColumn(core.ColumnTableModel__Int64, "id")
+	model.AddColumn(core.ColumnTableModel__Float64, "price")
+	model.AppendRows(rows)
+
+	var prices = make([]float64, batch)
+	b.SetBytes(batch * 8)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		model.BeginBatch()
+		model.SetFloat64s(1, (i*batch)%rows, prices)
+		model.EndBatch()
+	}
+}
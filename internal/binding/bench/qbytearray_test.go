@@ -0,0 +1,51 @@
+package bench
+
+import (
+	"testing"
+
+	"github.com/therecipe/qt/core"
+)
+
+func BenchmarkQByteArrayData(b *testing.B) {
+	var ba = core.NewQByteArrayFromBytes(payload)
+	b.SetBytes(chunkSize)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_ = []byte(ba.Data())
+	}
+}
+
+func BenchmarkQByteArrayView(b *testing.B) {
+	var ba = core.NewQByteArrayFromBytes(payload)
+	b.SetBytes(chunkSize)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_ = ba.View()
+	}
+}
+
+func BenchmarkNewQByteArrayString(b *testing.B) {
+	b.SetBytes(chunkSize)
+	for i := 0; i < b.N; i++ {
+		core.NewQByteArray2(string(payload), chunkSize).DestroyQByteArray()
+	}
+}
+
+func BenchmarkNewQByteArrayFromBytes(b *testing.B) {
+	b.SetBytes(chunkSize)
+	for i := 0; i < b.N; i++ {
+		core.NewQByteArrayFromBytes(payload).DeleteQByteArray()
+	}
+}
+
+func BenchmarkQByteArrayFromRawData(b *testing.B) {
+	//the raw data has to live in C++ memory
+	var src = core.NewQByteArrayFromBytes(payload)
+	b.SetBytes(chunkSize)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		core.WithQByteArrayFromRawData(src.View(), func(ba *core.QByteArray) {
+			ba.Size()
+		})
+	}
+}
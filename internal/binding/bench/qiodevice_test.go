@@ -0,0 +1,89 @@
+package bench
+
+import (
+	"testing"
+
+	"github.com/therecipe/qt/core"
+)
+
+const chunkSize = 64 << 10
+
+var payload = make([]byte, chunkSize)
+
+func newStringReader() *core.QIODevice {
+	var dev = core.NewQIODevice()
+	var s = string(payload)
+	dev.ConnectReadData(func(data *string, maxSize int64) int64 {
+		if maxSize > int64(len(s)) {
+			maxSize = int64(len(s))
+		}
+		*data = s[:maxSize]
+		return maxSize
+	})
+	return dev
+}
+
+func newBufferReader() *core.QIODevice {
+	var dev = core.NewQIODevice()
+	dev.ConnectReadDataBuffer(func(data []byte) int64 {
+		return int64(copy(data, payload))
+	})
+	return dev
+}
+
+func benchmarkRead(b *testing.B, dev *core.QIODevice) {
+	dev.Open(core.QIODevice__ReadOnly | core.QIODevice__Unbuffered)
+	b.SetBytes(chunkSize)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		dev.Seek(0)
+		dev.Read2(chunkSize).DestroyQByteArray()
+	}
+	b.StopTimer()
+	dev.Close()
+}
+
+func BenchmarkReadQBuffer(b *testing.B) {
+	var buf = core.NewQBuffer(nil)
+	buf.SetData2(string(payload), chunkSize)
+	benchmarkRead(b, &buf.QIODevice)
+}
+
+func BenchmarkReadDataString(b *testing.B) { benchmarkRead(b, newStringReader()) }
+
+func BenchmarkReadDataBuffer(b *testing.B) { benchmarkRead(b, newBufferReader()) }
+
+func benchmarkWrite(b *testing.B, dev *core.QIODevice) {
+	var chunk = core.NewQByteArray3(chunkSize, "x")
+	dev.Open(core.QIODevice__WriteOnly | core.QIODevice__Unbuffered)
+	b.SetBytes(chunkSize)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		dev.Seek(0)
+		dev.Write3(chunk)
+	}
+	b.StopTimer()
+	dev.Close()
+	chunk.DestroyQByteArray()
+}
+
+func BenchmarkWriteQBuffer(b *testing.B) {
+	benchmarkWrite(b, &core.NewQBuffer(nil).QIODevice)
+}
+
+func BenchmarkWriteDataString(b *testing.B) {
+	var dev = core.NewQIODevice()
+	dev.ConnectWriteData(func(data string, maxSize int64) int64 {
+		copy(payload, data)
+		return maxSize
+	})
+	benchmarkWrite(b, dev)
+}
+
+func BenchmarkWriteDataBuffer(b *testing.B) {
+	var dev = core.NewQIODevice()
+	dev.ConnectWriteDataBuffer(func(data []byte) int64 {
+		return int64(copy(payload, data))
+	})
+	benchmarkWrite(b, dev)
+}
@@ -0,0 +1,79 @@
+package bench
+
+import (
+	"runtime"
+	"testing"
+	"unicode/utf16"
+
+	"github.com/therecipe/qt"
+	"github.com/therecipe/qt/core"
+	"github.com/therecipe/qt/widgets"
+)
+
+const logLine = "2017-03-14 12:00:00.000 INFO  request served in 12ms by worker 7"
+
+//appends to a log view that keeps the last 1000 lines, like a log viewer would
+func benchmarkAppend(b *testing.B, f func(*widgets.QPlainTextEdit)) {
+	qt.RunOnMainSync(func() {
+		var edit = widgets.NewQPlainTextEdit(nil)
+		edit.SetMaximumBlockCount(1000)
+
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			f(edit)
+		}
+		b.StopTimer()
+
+		edit.DestroyQPlainTextEdit()
+	})
+}
+
+func BenchmarkAppendPlainText(b *testing.B) {
+	benchmarkAppend(b, func(edit *widgets.QPlainTextEdit) { edit.AppendPlainText(logLine) })
+}
+
+func BenchmarkAppendPlainTextUTF16(b *testing.B) {
+	var line = utf16.Encode([]rune(logLine))
+	benchmarkAppend(b, func(edit *widgets.QPlainTextEdit) { edit.AppendPlainTextUTF16(line) })
+}
+
+func BenchmarkAppendPlainTextQString(b *testing.B) {
+	var line = core.NewQStringHandle(logLine)
+	benchmarkAppend(b, func(edit *widgets.QPlainTextEdit) { edit.AppendPlainTextQString(line) })
+}
+
+func BenchmarkQVariantSetString(b *testing.B) {
+	var v = core.NewQVariant()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		v.SetString("display")
+	}
+}
+
+func BenchmarkQVariantSetInternedQString(b *testing.B) {
+	var v = core.NewQVariant()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		v.SetQString(core.InternQString("display"))
+	}
+}
+
+func TestQStringHandle(t *testing.T) {
+	var s = "grüße, 世界 🌍"
+	if out := core.NewQStringHandle(s).String(); out != s {
+		t.Fatalf("got %q, want %q", out, s)
+	}
+	if out := core.NewQStringHandleFromUTF16(utf16.Encode([]rune(s))).String(); out != s {
+		t.Fatalf("got %q, want %q", out, s)
+	}
+	var src = core.NewQStringHandle(s)
+	core.WithQStringFromRawUTF16(src.UTF16(), func(h *core.QStringHandle) {
+		if out := h.String(); out != s {
+			t.Fatalf("got %q, want %q", out, s)
+		}
+	})
+	runtime.KeepAlive(src)
+	if core.InternQString(s) != core.InternQString(s) {
+		t.Fatal("interned strings differ")
+	}
+}
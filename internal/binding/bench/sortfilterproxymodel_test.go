@@ -0,0 +1,109 @@
+package bench
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/therecipe/qt/core"
+)
+
+//a table with an id, a price that repeats every 1000 rows and a name column
+func newSortSource(rows int) *core.ColumnTableModel {
+	var (
+		model  = core.NewColumnTableModel(nil)
+		ids    = make([]int64, rows)
+		prices = make([]float64, rows)
+		names  = make([]string, rows)
+	)
+	model.AddColumn(core.ColumnTableModel__Int64, "id")
+	model.AddColumn(core.ColumnTableModel__Float64, "price")
+	model.AddColumn(core.ColumnTableModel__String, "name")
+	model.AppendRows(rows)
+	for i := range ids {
+		ids[i] = int64(i)
+		prices[i] = float64((i * 7919) % 1000)
+		names[i] = fmt.Sprint("row ", i)
+	}
+	model.SetInt64s(0, 0, ids)
+	model.SetFloat64s(1, 0, prices)
+	model.SetStrings(2, 0, names)
+	return model
+}
+
+func proxyIDs(proxy *core.SortFilterProxyModel) (out []int64) {
+	for i := 0; i < proxy.RowCount(core.NewQModelIndex()); i++ {
+		out = append(out, proxy.Index(i, 0, core.NewQModelIndex()).Data(int(core.Qt__DisplayRole)).ToLongLong(false))
+	}
+	return
+}
+
+func TestSortFilterProxyModel(t *testing.T) {
+	var (
+		source = newSortSource(10)
+		proxy  = core.NewSortFilterProxyModel(nil)
+	)
+	proxy.SetSourceModel(source)
+	proxy.SetFilters(core.SortFilterProxyModelFilter{Column: 1, Role: int(core.Qt__DisplayRole), Kind: core.SortFilterProxyModel__Range, Min: 0, Max: 500})
+	proxy.SetSortKeys(core.SortFilterProxyModelKey{Column: 1, Role: int(core.Qt__DisplayRole), Kind: core.SortFilterProxyModel__Number, Descending: true})
+
+	//prices are 0 919 838 757 676 595 514 433 352 271
+	if ids := fmt.Sprint(proxyIDs(proxy)); ids != "[7 8 9 0]" {
+		t.Fatalf("unexpected rows after sorting: %v", ids)
+	}
+
+	//a changed price moves its row or filters it out, a removed source row shifts the rest
+	source.SetFloat64s(1, 3, []float64{400})
+	source.SetFloat64s(1, 8, []float64{600})
+	if ids := fmt.Sprint(proxyIDs(proxy)); ids != "[7 3 9 0]" {
+		t.Fatalf("unexpected rows after dataChanged: %v", ids)
+	}
+	source.RemoveRows(0, 1)
+	if ids := fmt.Sprint(proxyIDs(proxy)); ids != "[7 3 9]" {
+		t.Fatalf("unexpected rows after rowsRemoved: %v", ids)
+	}
+
+	proxy.SetFilters(core.SortFilterProxyModelFilter{Column: 2, Role: int(core.Qt__DisplayRole), Kind: core.SortFilterProxyModel__RegExp, Text: "^row [1-3]$"})
+	proxy.SetSortKeys()
+	if ids := fmt.Sprint(proxyIDs(proxy)); ids != "[1 2 3]" {
+		t.Fatalf("unexpected rows after resetting the keys: %v", ids)
+	}
+}
+
+const sortRows = 100000
+
+//the previous way, a lessThan override that calls into Go for every comparison
+func BenchmarkQSortFilterProxyModelLessThan(b *testing.B) {
+	var proxy = core.NewQSortFilterProxyModel(nil)
+	proxy.ConnectLessThan(func(left *core.QModelIndex, right *core.QModelIndex) bool {
+		return left.Data(int(core.Qt__DisplayRole)).ToDouble(false) < right.Data(int(core.Qt__DisplayRole)).ToDouble(false)
+	})
+	proxy.SetSourceModel(newSortSource(sortRows))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		proxy.Sort(1, core.Qt__SortOrder(i%2))
+	}
+}
+
+func BenchmarkSortFilterProxyModelSort(b *testing.B) {
+	var proxy = core.NewSortFilterProxyModel(nil)
+	proxy.SetSourceModel(newSortSource(sortRows))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		proxy.SetSortKeys(core.SortFilterProxyModelKey{Column: 1, Role: int(core.Qt__DisplayRole), Kind: core.SortFilterProxyModel__Number, Descending: i%2 == 1})
+	}
+}
+
+func BenchmarkSortFilterProxyModelDataChanged(b *testing.B) {
+	var (
+		source = newSortSource(sortRows)
+		proxy  = core.NewSortFilterProxyModel(nil)
+	)
+	proxy.SetSourceModel(source)
+	proxy.SetSortKeys(core.SortFilterProxyModelKey{Column: 1, Role: int(core.Qt__DisplayRole), Kind: core.SortFilterProxyModel__Number})
+	var price = make([]float64, 1)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		price[0] = float64(i % 1000)
+		source.SetFloat64s(1, (i*7919)%sortRows, price)
+	}
+}
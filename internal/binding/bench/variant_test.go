@@ -0,0 +1,80 @@
+package bench
+
+import (
+	"fmt"
+	"reflect"
+	"testing"
+
+	"github.com/therecipe/qt/core"
+)
+
+//a qml like payload, a list of records with a nested map each
+func variantPayload(n int) map[string]interface{} {
+	var rows = make([]interface{}, n)
+	for i := range rows {
+		rows[i] = map[string]interface{}{
+			"id":     i,
+			"name":   fmt.Sprint("row ", i),
+			"score":  float64(i) / 3,
+			"active": i%2 == 0,
+			"tags":   []interface{}{"a", "b"},
+		}
+	}
+	return map[string]interface{}{"rows": rows, "count": n}
+}
+
+func TestQVariantToGo(t *testing.T) {
+	var in = variantPayload(3)
+	if out := core.NewQVariantFromGo(in).ToGo(); !reflect.DeepEqual(in, out) {
+		t.Fatalf("round trip changed the value:\n%v\n%v", in, out)
+	}
+}
+
+//the previous way, one call per key and entry
+func toGoPerEntry(v *core.QVariant) interface{} {
+	switch v.TypeName() {
+	case "QVariantMap":
+		var out = make(map[string]interface{})
+		for k, v := range v.ToMap() {
+			out[k] = toGoPerEntry(v)
+		}
+		return out
+	case "QVariantList":
+		var out []interface{}
+		for _, v := range v.ToList() {
+			out = append(out, toGoPerEntry(v))
+		}
+		return out
+	case "int":
+		return v.ToInt(false)
+	case "double":
+		return v.ToDouble(false)
+	case "bool":
+		return v.ToBool()
+	}
+	return v.ToString()
+}
+
+func BenchmarkQVariantToMap(b *testing.B) {
+	var v = core.NewQVariantFromGo(variantPayload(1000))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		toGoPerEntry(v)
+	}
+}
+
+func BenchmarkQVariantToGo(b *testing.B) {
+	var v = core.NewQVariantFromGo(variantPayload(1000))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		v.ToGo()
+	}
+}
+
+func BenchmarkNewQVariantFromGo(b *testing.B) {
+	var payload = variantPayload(1000)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		core.NewQVariantFromGo(payload).DestroyQVariant()
+	}
+}
@@ -15,10 +15,14 @@ func GoInputParametersForC(function *parser.Function) string {
 		input = append(input, "ptr.Pointer()")
 	}
 
+	if function.Arena {
+		input = append(input, "arena.Pointer()")
+	}
+
 	if function.SignalMode == "" {
 		for _, parameter := range function.Parameters {
 			var alloc = GoInput(parameter.Name, parameter.Value, function)
-			if strings.Contains(alloc, "C.CString") {
+			if strings.Contains(alloc, "C.CString") || strings.Contains(alloc, "cGoPackStringList") {
 				input = append(input, fmt.Sprintf("%vC", parser.CleanName(parameter.Name, parameter.Value)))
 			} else {
 				input = append(input, alloc)
@@ -39,7 +43,7 @@ func GoInputParametersForCAlloc(function *parser.Function) []string {
 				alloc = GoInput(parameter.Name, parameter.Value, function)
 				name  = fmt.Sprintf("%vC", parser.CleanName(parameter.Name, parameter.Value))
 			)
-			if strings.Contains(alloc, "C.CString") {
+			if strings.Contains(alloc, "C.CString") || strings.Contains(alloc, "cGoPackStringList") {
 				input = append(input, fmt.Sprintf("var %v = %v\ndefer C.free(unsafe.Pointer(%v))\n", name, alloc, name))
 			}
 		}
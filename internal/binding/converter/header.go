@@ -53,7 +53,8 @@ func GoHeaderName(f *parser.Function) string {
 
 				func() string {
 					if strings.HasSuffix(f.Name, "_atList") || strings.HasSuffix(f.Name, "_setList") ||
-						strings.HasSuffix(f.Name, "_newList") || strings.HasSuffix(f.Name, "_keyList") {
+						strings.HasSuffix(f.Name, "_newList") || strings.HasSuffix(f.Name, "_keyList") ||
+						strings.HasSuffix(f.Name, "_newListBuffer") || strings.HasSuffix(f.Name, "_fillList") {
 						return f.Name
 					}
 					return strings.Title(f.Name)
@@ -76,6 +77,10 @@ func GoHeaderName(f *parser.Function) string {
 		fmt.Fprint(bb, "Caught")
 	}
 
+	if f.Arena {
+		fmt.Fprint(bb, "InArena")
+	}
+
 	if strings.ContainsAny(bb.String(), "&<>=/!()[]{}^|*+-") || strings.Contains(bb.String(), "Operator") {
 		f.Access = "unsupported_GoHeaderName"
 		return f.Access
@@ -241,6 +246,10 @@ func CppHeaderInput(f *parser.Function) string {
 		tmp = append(tmp, "void* ptr")
 	}
 
+	if f.Arena {
+		tmp = append(tmp, "void* arena")
+	}
+
 	if f.Meta == parser.SIGNAL {
 		return strings.Join(tmp, ", ")
 	}
@@ -17,7 +17,7 @@ func GoInput(name, value string, f *parser.Function) string {
 	case "char", "qint8":
 		{
 			if strings.Contains(vOld, "**") {
-				return fmt.Sprintf("C.CString(strings.Join(%v, \"|\"))", name)
+				return fmt.Sprintf("cGoPackStringList(%v)", name)
 			}
 
 			if value == "char" && strings.Count(vOld, "*") == 1 && f.Name == "readData" {
@@ -39,7 +39,7 @@ func GoInput(name, value string, f *parser.Function) string {
 
 	case "QStringList":
 		{
-			return fmt.Sprintf("C.CString(strings.Join(%v, \"|\"))", name)
+			return fmt.Sprintf("cGoPackStringList(%v)", name)
 		}
 
 	case "void" /*, ""*/ :
@@ -162,6 +162,15 @@ func GoInput(name, value string, f *parser.Function) string {
 			return fmt.Sprintf("PointerFrom%v(%v)", strings.Title(value), name)
 		}
 
+	case parser.IsPODList(value):
+		{
+			var element = parser.UnpackedList(value)
+			if strings.ContainsAny(name, "*&()[]") {
+				return fmt.Sprintf("func(l %v) unsafe.Pointer {\nvar tmpList = make([]%v, len(l)+1)\nfor i, v := range l {\ntmpList[i] = %v\n}\nreturn New%vFromPointer(nil).__%v_newListBuffer%v(unsafe.Pointer(&tmpList[0]), len(l))\n}(%v)", goType(f, value), cgoType(f, element), GoInput("v", element, f), strings.Title(f.ClassName()), f.Name, f.OverloadNumber, name)
+			}
+			return fmt.Sprintf("func(l %v) unsafe.Pointer {\nvar tmpList = make([]%v, len(l)+1)\nfor i, v := range l {\ntmpList[i] = %v\n}\nreturn New%vFromPointer(nil).__%v_%v_newListBuffer%v(unsafe.Pointer(&tmpList[0]), len(l))\n}(%v)", goType(f, value), cgoType(f, element), GoInput("v", element, f), strings.Title(f.ClassName()), f.Name, name, f.OverloadNumber, name)
+		}
+
 	case parser.IsPackedList(value):
 		{
 			if strings.ContainsAny(name, "*&()[]") {
@@ -245,7 +254,7 @@ func cppInput(name, value string, f *parser.Function) string {
 				return fmt.Sprintf("*(%v)", cppInput(name, "QStringList*", f))
 			}
 
-			return fmt.Sprintf("QString(%v).split(\"|\", QString::SkipEmptyParts)", name)
+			return fmt.Sprintf("goUnpackStringList(%v)", name)
 		}
 
 	case "void" /*, ""*/ :
@@ -29,7 +29,7 @@ func goOutput(name, value string, f *parser.Function) string {
 
 	case "QStringList":
 		{
-			return fmt.Sprintf("strings.Split(cGoUnpackString(%v), \"|\")", name)
+			return fmt.Sprintf("cGoUnpackStringListAndFree(%v)", name)
 		}
 
 	case "void", "":
@@ -149,6 +149,17 @@ func goOutput(name, value string, f *parser.Function) string {
 			return fmt.Sprintf("New%vFromPointer(%v)", strings.Title(value), name)
 		}
 
+	case value == "QList<QByteArray>":
+		{
+			return goByteArrayListOutput(fmt.Sprintf("cGoUnpackStringListAndFree(%v)", name), f)
+		}
+
+	case parser.IsPODList(value):
+		{
+			var element = parser.UnpackedList(value)
+			return fmt.Sprintf("func(l C.struct_%v_PackedList)%v{var out = make(%v, int(l.len))\nvar tmpList = make([]%v, int(l.len)+1)\nNew%vFromPointer(l.data).__%v_fillList%v(unsafe.Pointer(&tmpList[0]))\nfor i, v := range tmpList[:len(out)] {\nout[i] = %v%v\n}\nreturn out}(%v)", strings.Title(parser.State.ClassMap[f.ClassName()].Module), goType(f, value), goType(f, value), cgoType(f, element), strings.Title(f.ClassName()), f.Name, f.OverloadNumber, goOutput("v", element, f), goBufferFinalizer(f, element), name)
+		}
+
 	case parser.IsPackedList(value):
 		{
 			return fmt.Sprintf("func(l C.struct_%v_PackedList)%v{var out = make(%v, int(l.len))\nfor i:=0;i<int(l.len);i++{ out[i] = New%vFromPointer(l.data).__%v_atList%v(i) }\nreturn out}(%v)", strings.Title(parser.State.ClassMap[f.ClassName()].Module), goType(f, value), goType(f, value), strings.Title(f.ClassName()), f.Name, f.OverloadNumber, name)
@@ -290,7 +301,7 @@ func cgoOutput(name, value string, f *parser.Function) string {
 
 	case "QStringList":
 		{
-			return fmt.Sprintf("strings.Split(cGoUnpackString(%v), \"|\")", name)
+			return fmt.Sprintf("cGoUnpackStringList(%v)", name)
 		}
 
 	case "void", "":
@@ -386,6 +397,17 @@ func cgoOutput(name, value string, f *parser.Function) string {
 			return fmt.Sprintf("New%vFromPointer(%v)", strings.Title(value), name)
 		}
 
+	case value == "QList<QByteArray>":
+		{
+			return goByteArrayListOutput(fmt.Sprintf("cGoUnpackStringList(%v)", name), f)
+		}
+
+	case parser.IsPODList(value):
+		{
+			var element = parser.UnpackedList(value)
+			return fmt.Sprintf("func(l C.struct_%v_PackedList)%v{var out = make(%v, int(l.len))\nvar tmpList = make([]%v, int(l.len)+1)\nNew%vFromPointer(l.data).__%v_%v_fillList%v(unsafe.Pointer(&tmpList[0]))\nfor i, v := range tmpList[:len(out)] {\nout[i] = %v%v\n}\nreturn out}(%v)", strings.Title(parser.State.ClassMap[f.ClassName()].Module), goType(f, value), goType(f, value), cgoType(f, element), strings.Title(f.ClassName()), f.Name, name, f.OverloadNumber, cgoOutput("v", element, f), goBufferFinalizer(f, element), name)
+		}
+
 	case parser.IsPackedList(value):
 		{
 			return fmt.Sprintf("func(l C.struct_%v_PackedList)%v{var out = make(%v, int(l.len))\nfor i:=0;i<int(l.len);i++{ out[i] = New%vFromPointer(l.data).__%v_%v_atList%v(i) }\nreturn out}(%v)", strings.Title(parser.State.ClassMap[f.ClassName()].Module), goType(f, value), goType(f, value), strings.Title(f.ClassName()), f.Name, name, f.OverloadNumber, name)
@@ -401,6 +423,12 @@ func cgoOutput(name, value string, f *parser.Function) string {
 	return f.Access
 }
 
+//byte array lists are packed like string lists and copied into new byte arrays
+func goByteArrayListOutput(list string, f *parser.Function) string {
+	var constructor = strings.Replace(goType(f, "QByteArray"), "QByteArray", "NewQByteArray2", -1)
+	return fmt.Sprintf("func(l []string)%v{var out = make(%v, len(l))\nfor i, v := range l { out[i] = %v(v, len(v)) }\nreturn out}(%v)", goType(f, "QList<QByteArray>"), goType(f, "QList<QByteArray>"), constructor, list)
+}
+
 func CppOutput(name, value string, f *parser.Function) string {
 	if strings.HasSuffix(f.Name, "_atList") {
 		if f.IsMap {
@@ -417,6 +445,26 @@ func CppOutput(name, value string, f *parser.Function) string {
 	if strings.HasSuffix(f.Name, "_newList") {
 		return fmt.Sprintf("new %v", parser.CleanValue(f.Container))
 	}
+	if strings.HasSuffix(f.Name, "_newListBuffer") {
+		var container, element = parser.CleanValue(f.Container), parser.UnpackedList(f.Container)
+		return fmt.Sprintf("({ %v* tmpList = new %v; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(%v); tmpList; })", container, container,
+			func() string {
+				if isClass(element) {
+					return fmt.Sprintf("*static_cast<%v*>(static_cast<void**>(data)[i])", element)
+				}
+				return fmt.Sprintf("static_cast<%v*>(data)[i]", cppType(f, element))
+			}())
+	}
+	if strings.HasSuffix(f.Name, "_fillList") {
+		var container, element = parser.CleanValue(f.Container), parser.UnpackedList(f.Container)
+		return fmt.Sprintf("for (int i = 0; i < static_cast<%v*>(ptr)->size(); i++) static_cast<%v*>(data)[i] = %v", container, cppType(f, element),
+			func() string {
+				if isClass(element) {
+					return fmt.Sprintf("new %v(static_cast<%v*>(ptr)->at(i))", element, container)
+				}
+				return fmt.Sprintf("static_cast<%v*>(ptr)->at(i)", container)
+			}())
+	}
 	if strings.HasSuffix(f.Name, "_keyList") {
 		return cppOutput(fmt.Sprintf("static_cast<%v*>(ptr)->keys()", f.Container), value, f)
 	}
@@ -426,6 +474,18 @@ func CppOutput(name, value string, f *parser.Function) string {
 func cppOutputPack(name, value string, f *parser.Function) string {
 	var out = CppOutput(name, value, f)
 
+	//the packed string list only needs to outlive the callback, so it's freed when the calling function returns
+	if v := parser.CleanValue(value); v == "QStringList" || v == "QList<QByteArray>" {
+		var tHash = sha1.New()
+		tHash.Write([]byte(name))
+		var tHashName = hex.EncodeToString(tHash.Sum(nil)[:3])
+		var list = parser.CleanName(name, value)
+		if strings.Contains(value, "*") {
+			list = fmt.Sprintf("*%v", list)
+		}
+		return fmt.Sprintf("long long t%vlen; QScopedPointer<char, QScopedPointerPodDeleter> t%v(goPackStringList(%v, &t%vlen)); %v_PackedString %vPacked = { t%v.data(), t%vlen };", tHashName, tHashName, list, tHashName, strings.Title(parser.State.ClassMap[f.ClassName()].Module), parser.CleanName(name, value), tHashName, tHashName)
+	}
+
 	if strings.Contains(out, "_PackedString") {
 		var out = strings.Replace(out, "({ ", "", -1)
 		out = strings.Replace(out, " })", "", -1)
@@ -514,12 +574,12 @@ func cppOutput(name, value string, f *parser.Function) string {
 			return fmt.Sprintf("({ QByteArray t%v = %v.toUtf8(); %v_PackedString { const_cast<char*>(t%v.prepend(\"WHITESPACE\").constData()+10), t%v.size()-10 }; })", tHashName, name, strings.Title(parser.State.ClassMap[f.ClassName()].Module), tHashName, tHashName)
 		}
 
-	case "QStringList":
+	case "QStringList", "QList<QByteArray>":
 		{
 			if strings.Contains(vOld, "*") {
-				return fmt.Sprintf("({ QByteArray t%v = %v->join(\"|\").toUtf8(); %v_PackedString { const_cast<char*>(t%v.prepend(\"WHITESPACE\").constData()+10), t%v.size()-10 }; })", tHashName, name, strings.Title(parser.State.ClassMap[f.ClassName()].Module), tHashName, tHashName)
+				name = fmt.Sprintf("*%v", name)
 			}
-			return fmt.Sprintf("({ QByteArray t%v = %v.join(\"|\").toUtf8(); %v_PackedString { const_cast<char*>(t%v.prepend(\"WHITESPACE\").constData()+10), t%v.size()-10 }; })", tHashName, name, strings.Title(parser.State.ClassMap[f.ClassName()].Module), tHashName, tHashName)
+			return fmt.Sprintf("({ long long t%vlen; char* t%v = goPackStringList(%v, &t%vlen); %v_PackedString { t%v, t%vlen }; })", tHashName, tHashName, name, tHashName, strings.Title(parser.State.ClassMap[f.ClassName()].Module), tHashName, tHashName)
 		}
 
 	case
@@ -695,3 +755,10 @@ func cppOutput(name, value string, f *parser.Function) string {
 	f.Access = fmt.Sprintf("unsupported_cppOutput(%v)", value)
 	return f.Access
 }
+
+func goBufferFinalizer(f *parser.Function, element string) string {
+	if isClass(element) {
+		return fmt.Sprintf("\nruntime.SetFinalizer(out[i], (%v).Destroy%v)", goType(f, element), element)
+	}
+	return ""
+}
@@ -312,6 +312,11 @@ func cgoType(f *parser.Function, value string) string {
 			return "unsafe.Pointer"
 		}
 
+	case value == "QList<QByteArray>":
+		{
+			return fmt.Sprintf("C.struct_%v_PackedString", strings.Title(parser.State.ClassMap[f.ClassName()].Module))
+		}
+
 	case parser.IsPackedList(value) || parser.IsPackedMap(value):
 		{
 			return fmt.Sprintf("C.struct_%v_PackedList", strings.Title(parser.State.ClassMap[f.ClassName()].Module))
@@ -473,6 +478,11 @@ func cppType(f *parser.Function, value string) string {
 			return "void*"
 		}
 
+	case value == "QList<QByteArray>":
+		{
+			return fmt.Sprintf("struct %v_PackedString", strings.Title(parser.State.ClassMap[f.ClassName()].Module))
+		}
+
 	case parser.IsPackedList(value) || parser.IsPackedMap(value):
 		{
 			return fmt.Sprintf("struct %v_PackedList", strings.Title(parser.State.ClassMap[f.ClassName()].Module))
@@ -0,0 +1,23 @@
+#include "utils-gui.h"
+
+#include <QImage>
+
+struct QtGui_PackedBuffer QImage_BitsBuffer(void* ptr)
+{
+	uchar* tmpValue = static_cast<QImage*>(ptr)->bits();
+	return QtGui_PackedBuffer { tmpValue, static_cast<QImage*>(ptr)->byteCount() };
+}
+
+struct QtGui_PackedBuffer QImage_ScanLineBuffer(void* ptr, int i)
+{
+	QImage* image = static_cast<QImage*>(ptr);
+	if (i < 0 || i >= image->height()) {
+		return QtGui_PackedBuffer { 0, 0 };
+	}
+	return QtGui_PackedBuffer { image->scanLine(i), image->bytesPerLine() };
+}
+
+void* QImage_NewQImageFromBuffer(void* data, int width, int height, int bytesPerLine, long long format)
+{
+	return new QImage(static_cast<uchar*>(data), width, height, bytesPerLine, static_cast<QImage::Format>(format));
+}
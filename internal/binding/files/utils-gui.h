@@ -0,0 +1,21 @@
+#pragma once
+
+#ifndef GO_QTGUI_UTILS_H
+#define GO_QTGUI_UTILS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct QtGui_PackedBuffer { void* data; long long len; };
+struct QtGui_PackedBuffer QImage_BitsBuffer(void* ptr);
+struct QtGui_PackedBuffer QImage_ScanLineBuffer(void* ptr, int i);
+void* QImage_NewQImageFromBuffer(void* data, int width, int height, int bytesPerLine, long long format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
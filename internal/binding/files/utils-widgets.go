@@ -0,0 +1,32 @@
+//go:build ignore
+// +build ignore
+
+package widgets
+
+//#include <stdint.h>
+//#include <stdlib.h>
+//#include "utils-widgets.h"
+import "C"
+import (
+	"github.com/therecipe/qt/core"
+	"unsafe"
+)
+
+//AppendPlainTextUTF16 is AppendPlainText for text that is already UTF-16,
+//the text is copied once instead of going through a C string and an UTF-8 decoder.
+func (ptr *QPlainTextEdit) AppendPlainTextUTF16(text []uint16) {
+	if ptr.Pointer() != nil {
+		var data unsafe.Pointer
+		if len(text) > 0 {
+			data = unsafe.Pointer(&text[0])
+		}
+		C.QPlainTextEdit_AppendPlainTextUTF16(ptr.Pointer(), data, C.int(int32(len(text))))
+	}
+}
+
+//AppendPlainTextQString is AppendPlainText for a string that already lives in C++, like an interned one.
+func (ptr *QPlainTextEdit) AppendPlainTextQString(text *core.QStringHandle) {
+	if ptr.Pointer() != nil && text.Pointer() != nil {
+		C.QPlainTextEdit_AppendPlainTextQString(ptr.Pointer(), text.Pointer())
+	}
+}
@@ -39,6 +39,7 @@ type Function struct {
 	Synthetic       bool
 	Checked         bool
 	Exception       bool
+	Arena           bool
 	IsMap           bool
 	OgParameters    []Parameter
 	IsMocFunction   bool
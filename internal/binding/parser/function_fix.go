@@ -392,6 +392,10 @@ func (c *Class) FixGenericHelper() {
 					})
 				}
 
+				if IsPODList(CleanValue(f.Output)) {
+					c.addBufferHelper(f, fmt.Sprintf("__%v", f.Name), f.Output)
+				}
+
 				if IsPackedMap(CleanValue(f.Output)) {
 					if !c.HasFunctionWithNameAndOverloadNumber(fmt.Sprintf("__%v_keyList", f.Name), f.OverloadNumber) {
 						var keyType, _ = UnpackedMapDirty(CleanValue(f.Output))
@@ -485,6 +489,10 @@ func (c *Class) FixGenericHelper() {
 						})
 					}
 
+					if IsPODList(CleanValue(p.Value)) {
+						c.addBufferHelper(f, fmt.Sprintf("__%v_%v", f.Name, p.Name), p.Value)
+					}
+
 					if IsPackedMap(CleanValue(p.Value)) {
 						if !c.HasFunctionWithNameAndOverloadNumber(fmt.Sprintf("__%v_keyList", f.Name), f.OverloadNumber) {
 							var keyType, _ = UnpackedMapDirty(CleanValue(p.Value))
@@ -513,3 +521,41 @@ func (c *Class) FixGenericHelper() {
 		}
 	}
 }
+
+func (c *Class) addBufferHelper(f *Function, name, container string) {
+	if !c.HasFunctionWithNameAndOverloadNumber(name+"_newListBuffer", f.OverloadNumber) {
+		c.Functions = append(c.Functions, &Function{
+			Name:           name + "_newListBuffer",
+			Fullname:       fmt.Sprintf("%v::%v_newListBuffer", c.Name, name),
+			Access:         "public",
+			Virtual:        "non",
+			Meta:           PLAIN,
+			Output:         "void *",
+			Parameters:     []*Parameter{{Name: "data", Value: "void *"}, {Name: "count", Value: "int"}},
+			Signature:      "()",
+			Container:      container,
+			OverloadNumber: f.OverloadNumber,
+			Overload:       f.Overload,
+			NoMocDeduce:    true,
+			AsError:        f.AsError,
+		})
+	}
+
+	if !c.HasFunctionWithNameAndOverloadNumber(name+"_fillList", f.OverloadNumber) {
+		c.Functions = append(c.Functions, &Function{
+			Name:           name + "_fillList",
+			Fullname:       fmt.Sprintf("%v::%v_fillList", c.Name, name),
+			Access:         "public",
+			Virtual:        "non",
+			Meta:           PLAIN,
+			Output:         "void",
+			Parameters:     []*Parameter{{Name: "data", Value: "void *"}},
+			Signature:      "()",
+			Container:      container,
+			OverloadNumber: f.OverloadNumber,
+			Overload:       f.Overload,
+			NoMocDeduce:    true,
+			AsError:        f.AsError,
+		})
+	}
+}
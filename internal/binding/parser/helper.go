@@ -57,6 +57,23 @@ func UnpackedListDirty(v string) string {
 	return strings.Split(strings.Split(v, "<")[1], ">")[0]
 }
 
+//lists of these are passed through a single contiguous buffer instead of per element calls
+func IsPODList(v string) bool {
+	if !IsPackedList(v) {
+		return false
+	}
+
+	switch strings.TrimSpace(UnpackedListDirty(v)) {
+	case "int", "qreal", "double", "float",
+		"QPoint", "QPointF", "QRect", "QRectF", "QLine", "QLineF", "QSize", "QSizeF":
+		{
+			return true
+		}
+	}
+
+	return false
+}
+
 func IsPackedMap(v string) bool {
 	return (strings.HasPrefix(v, "QMap<") ||
 		strings.HasPrefix(v, "QMultiMap<") ||
@@ -1,10 +1,14 @@
 package parser
 
 import (
+	"crypto/sha1"
+	"encoding/hex"
 	"encoding/xml"
 	"fmt"
 	"path/filepath"
+	"runtime"
 	"strings"
+	"sync"
 
 	"github.com/Sirupsen/logrus"
 	"github.com/therecipe/qt/internal/utils"
@@ -22,12 +26,41 @@ var State = &struct {
 }
 
 func LoadModules() {
-	for _, m := range GetLibs() {
-		_ = LoadModule(m)
+	var (
+		libs    = GetLibs()
+		modules = make([]*Module, len(libs))
+		wg      sync.WaitGroup
+		sem     = make(chan struct{}, runtime.NumCPU())
+	)
+
+	//unmarshal the index files in parallel, but register them in a stable order
+	for i, m := range libs {
+		wg.Add(1)
+		go func(i int, m string) {
+			defer wg.Done()
+			sem <- struct{}{}
+			modules[i], _ = loadModule(m)
+			<-sem
+		}(i, m)
+	}
+	wg.Wait()
+
+	for _, module := range modules {
+		if module != nil {
+			_ = module.Prepare()
+		}
 	}
 }
 
 func LoadModule(m string) error {
+	var module, err = loadModule(m)
+	if err != nil {
+		return err
+	}
+	return module.Prepare()
+}
+
+func loadModule(m string) (*Module, error) {
 	var (
 		logName   = "parser.LoadModule"
 		logFields = logrus.Fields{"0_module": m}
@@ -35,37 +68,60 @@ func LoadModule(m string) error {
 	utils.Log.WithFields(logFields).Debug(logName)
 
 	if m == "Sailfish" {
-		return sailfishModule().Prepare()
+		return sailfishModule(), nil
 	}
 
 	var (
 		module = new(Module)
 		err    error
 	)
+	if utils.UseHomeBrew() || utils.UseMsys2() || utils.UsePkgConfig() {
+		err = xml.Unmarshal([]byte(utils.LoadOptional(indexPath(m))), &module)
+	} else {
+		err = xml.Unmarshal([]byte(utils.Load(indexPath(m))), &module)
+	}
+	if err != nil {
+		if m != "DataVisualization" && m != "Charts" {
+			utils.Log.WithFields(logFields).WithError(err).Warn(logName)
+		} else {
+			utils.Log.WithFields(logFields).WithError(err).Debug(logName)
+		}
+		return nil, err
+	}
+
+	return module, nil
+}
+
+func indexPath(m string) string {
 	switch {
 	case utils.UseHomeBrew(), utils.UseMsys2():
 		{
-			err = xml.Unmarshal([]byte(utils.LoadOptional(filepath.Join(utils.MustGoPath(), "src", "github.com", "therecipe", "qt", "internal", "binding", "files", "docs", utils.QT_VERSION(), fmt.Sprintf("qt%v.index", strings.ToLower(m))))), &module)
+			return filepath.Join(utils.MustGoPath(), "src", "github.com", "therecipe", "qt", "internal", "binding", "files", "docs", utils.QT_VERSION(), fmt.Sprintf("qt%v.index", strings.ToLower(m)))
 		}
 
 	case utils.UsePkgConfig():
 		{
-			err = xml.Unmarshal([]byte(utils.LoadOptional(filepath.Join(utils.QT_DOC_DIR(), fmt.Sprintf("qt%v", strings.ToLower(m)), fmt.Sprintf("qt%v.index", strings.ToLower(m))))), &module)
+			return filepath.Join(utils.QT_DOC_DIR(), fmt.Sprintf("qt%v", strings.ToLower(m)), fmt.Sprintf("qt%v.index", strings.ToLower(m)))
 		}
 
 	default:
 		{
-			err = xml.Unmarshal([]byte(utils.Load(filepath.Join(utils.QT_DIR(), "Docs", fmt.Sprintf("Qt-%v", utils.QT_VERSION_MAJOR()), fmt.Sprintf("qt%v", strings.ToLower(m)), fmt.Sprintf("qt%v.index", strings.ToLower(m))))), &module)
+			return filepath.Join(utils.QT_DIR(), "Docs", fmt.Sprintf("Qt-%v", utils.QT_VERSION_MAJOR()), fmt.Sprintf("qt%v", strings.ToLower(m)), fmt.Sprintf("qt%v.index", strings.ToLower(m)))
 		}
 	}
-	if err != nil {
-		if m != "DataVisualization" && m != "Charts" {
-			utils.Log.WithFields(logFields).WithError(err).Warn(logName)
-		} else {
-			utils.Log.WithFields(logFields).WithError(err).Debug(logName)
+}
+
+var indexHashes = make(map[string]string)
+
+//IndexHash hashes the index files a module is generated from, including the ones of its dependencies
+func IndexHash(m string) string {
+	var h = sha1.New()
+	for _, dep := range append(append([]string{}, LibDeps[m]...), m) {
+		if _, ok := indexHashes[dep]; !ok && dep != "Sailfish" {
+			var sum = sha1.Sum([]byte(utils.LoadOptional(indexPath(dep))))
+			indexHashes[dep] = hex.EncodeToString(sum[:])
 		}
-		return err
+		fmt.Fprintf(h, "%v:%v\n", dep, indexHashes[dep])
 	}
-
-	return module.Prepare()
+	return hex.EncodeToString(h.Sum(nil))
 }
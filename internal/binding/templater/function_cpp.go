@@ -80,6 +80,15 @@ func cppFunctionCallbackHeader(function *parser.Function) string {
 }
 
 func cppFunctionCallbackBody(function *parser.Function) string {
+	if isModelDataCallback(function) {
+		return fmt.Sprintf("QVariant ret; callback%v_%v%v(%v, &ret); return ret;", function.ClassName(), strings.Title(function.Name), function.OverloadNumber, converter.CppInputParametersForCallbackBody(function))
+	}
+
+	//the packed string list returned by the callback is malloc'ed by Go and freed once it's unpacked
+	if function.Output == "QStringList" {
+		return fmt.Sprintf("%vchar* tmp = callback%v_%v%v(%v); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret;", converter.CppInputParametersForCallbackBodyPrePack(function), function.ClassName(), strings.Title(function.Name), function.OverloadNumber, converter.CppInputParametersForCallbackBody(function))
+	}
+
 	return fmt.Sprintf("%v%v%v;",
 
 		converter.CppInputParametersForCallbackBodyPrePack(function),
@@ -106,11 +115,28 @@ func cppFunctionCallbackBody(function *parser.Function) string {
 func cppFunction(function *parser.Function) string {
 	var output = fmt.Sprintf("%v\n{\n%v\n}", cppFunctionHeader(function), cppFunctionBodyWithGuards(function))
 	if function.IsSupported() {
+		if isModelDataDefault(function) {
+			var body = strings.Replace(cppFunctionBodyWithGuards(function), "return new QVariant(", "*static_cast<QVariant*>(ret) = QVariant(", -1)
+			output += fmt.Sprintf("\n\n%v\n{\n%v\n}", cppModelDataDefaultIntoHeader(function), body)
+		}
 		return output
 	}
 	return ""
 }
 
+//cppFunctionDeclaration also declares the companion functions cppFunction emits
+func cppFunctionDeclaration(function *parser.Function) string {
+	var output = cppFunctionHeader(function)
+	if output != "" && isModelDataDefault(function) {
+		output += ";\n" + cppModelDataDefaultIntoHeader(function)
+	}
+	return output
+}
+
+func cppModelDataDefaultIntoHeader(function *parser.Function) string {
+	return fmt.Sprintf("void %vInto(%v, void* ret)", converter.CppHeaderName(function), converter.CppHeaderInput(function))
+}
+
 func cppFunctionHeader(function *parser.Function) string {
 	var output = fmt.Sprintf("%v %v(%v)", converter.CppHeaderOutput(function), converter.CppHeaderName(function), converter.CppHeaderInput(function))
 	if function.IsSupported() {
@@ -310,13 +336,13 @@ func cppFunctionBodyInternal(function *parser.Function) string {
 	switch function.Meta {
 	case parser.CONSTRUCTOR:
 		{
-			return fmt.Sprintf("%v\treturn new %v%v(%v);",
+			return fmt.Sprintf("%v\treturn new %v%v%v(%v);",
 				func() string {
 					if parser.State.ClassMap[function.ClassName()].IsSubClassOf("QCoreApplication") {
 						return `	static int argcs = argc;
 	static char** argvs = static_cast<char**>(malloc(argcs * sizeof(char*)));
 
-	QList<QByteArray> aList = QByteArray(argv).split('|');
+	QList<QByteArray> aList = goUnpackByteArrayList(argv);
 	for (int i = 0; i < argcs; i++)
 		argvs[i] = (new QByteArray(aList.at(i)))->data();
 
@@ -325,6 +351,16 @@ func cppFunctionBodyInternal(function *parser.Function) string {
 					return ""
 				}(),
 
+				func() string {
+					if function.Arena {
+						if c := parser.State.ClassMap[function.ClassName()]; c != nil && c.Fullname != "" {
+							return fmt.Sprintf("(goArenaAlloc<%v>(arena)) ", c.Fullname)
+						}
+						return fmt.Sprintf("(goArenaAlloc<%v>(arena)) ", function.ClassName())
+					}
+					return ""
+				}(),
+
 				func() string {
 					var class = parser.State.ClassMap[function.ClassName()]
 					if !parser.State.Moc {
@@ -404,7 +440,7 @@ func cppFunctionBodyInternal(function *parser.Function) string {
 				return fmt.Sprintf(`	static int argcs = argc;
 	static char** argvs = static_cast<char**>(malloc(argcs * sizeof(char*)));
 
-	QList<QByteArray> aList = QByteArray(argv).split('|');
+	QList<QByteArray> aList = goUnpackByteArrayList(argv);
 	for (int i = 0; i < argcs; i++)
 		argvs[i] = (new QByteArray(aList.at(i)))->data();
 
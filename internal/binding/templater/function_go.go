@@ -19,6 +19,14 @@ func goFunction(function *parser.Function) string {
 }
 
 func goFunctionHeader(function *parser.Function) string {
+	if isModelDataCallback(function) {
+		return fmt.Sprintf("func %v(%v, ret unsafe.Pointer)", converter.GoHeaderName(function), converter.GoHeaderInput(function))
+	}
+
+	if function.Arena {
+		return fmt.Sprintf("func (arena *Arena) %v(%v)%v", strings.TrimSuffix(converter.GoHeaderName(function), "InArena"), converter.GoHeaderInput(function), converter.GoHeaderOutput(function))
+	}
+
 	return fmt.Sprintf("func %v %v(%v)%v",
 		func() string {
 			if function.Static || function.Meta == parser.CONSTRUCTOR || function.SignalMode == parser.CALLBACK {
@@ -71,6 +79,10 @@ func goFunctionBody(function *parser.Function) string {
 		)
 	}
 
+	if utils.QT_INSTRUMENT() && function.SignalMode == parser.CALLBACK {
+		fmt.Fprintf(bb, "defer qt.CallbackEnd(qt.CallbackStart(\"%v\", \"%v%v\"))\n", class.Name, function.Name, function.OverloadNumber)
+	}
+
 	if !(function.Static || function.Meta == parser.CONSTRUCTOR || function.SignalMode == parser.CALLBACK || strings.Contains(function.Name, "_newList")) {
 		fmt.Fprintf(bb, "if ptr.Pointer() != nil {\n")
 	}
@@ -103,7 +115,7 @@ func goFunctionBody(function *parser.Function) string {
 			}
 
 			switch {
-			case function.NeedsFinalizer && parser.State.ClassMap[parser.CleanValue(function.Output)].IsSupported() || function.Meta == parser.CONSTRUCTOR && !(parser.State.ClassMap[function.Name].HasCallbackFunctions() || parser.State.ClassMap[function.Name].IsSubClassOfQObject()):
+			case function.NeedsFinalizer && parser.State.ClassMap[parser.CleanValue(function.Output)].IsSupported() || function.Meta == parser.CONSTRUCTOR && !function.Arena && !(parser.State.ClassMap[function.Name].HasCallbackFunctions() || parser.State.ClassMap[function.Name].IsSubClassOfQObject()):
 				{
 					var bb = new(bytes.Buffer)
 					defer bb.Reset()
@@ -153,7 +165,7 @@ func goFunctionBody(function *parser.Function) string {
 
 					fmt.Fprintf(bb, "var tmpValue = %v\n", body)
 
-					fmt.Fprintf(bb, "if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), \"QObject::destroyed\") {\ntmpValue.ConnectDestroyed(func(%v){ tmpValue.SetPointer(nil) })\n}\n",
+					fmt.Fprintf(bb, "if !qt.ExistsSignal(tmpValue.Pointer(), \"QObject::destroyed\") {\ntmpValue.ConnectDestroyed(func(%v){ tmpValue.SetPointer(nil) })\n}\n",
 						func() string {
 							if class.Module == "QtCore" {
 								return "*QObject"
@@ -200,7 +212,32 @@ func goFunctionBody(function *parser.Function) string {
 	switch function.SignalMode {
 	case parser.CALLBACK:
 		{
-			fmt.Fprintf(bb, "if signal := qt.GetSignal(fmt.Sprint(ptr), \"%v%v\"); signal != nil {\n",
+			if isModelDataCallback(function) {
+				var core string
+				if class.Module != "QtCore" {
+					core = "core."
+				}
+
+				fmt.Fprintf(bb, "if signal := qt.GetSignal(ptr, \"%vInto%v\"); signal != nil {\n", function.Name, function.OverloadNumber)
+				fmt.Fprintf(bb, "signal.(func(*%vQModelIndex, int, *%vQVariant))(%v, %vNewQVariantFromPointer(ret))\nreturn\n}\n", core, core, converter.GoInputParametersForCallback(function), core)
+
+				//the variant returned by the callback is only copied, it stays owned by the callback
+				fmt.Fprintf(bb, "if signal := qt.GetSignal(ptr, \"%v%v\"); signal != nil {\n", function.Name, function.OverloadNumber)
+				fmt.Fprintf(bb, "var tmpValue = signal.(%v)(%v)\n", converter.GoHeaderInputSignalFunction(function), converter.GoInputParametersForCallback(function))
+				fmt.Fprintf(bb, "%vNewQVariantFromPointer(ret).Assign(tmpValue)\nreturn\n}", core)
+
+				if (!function.IsDerivedFromPure() || function.IsDerivedFromImpure() || function.Synthetic) && function.Meta != parser.SIGNAL {
+					fmt.Fprintf(bb, "\n\nC.%v_%v%vDefaultInto(ptr, %v, %v, ret)", class.Name, strings.Title(function.Name), function.OverloadNumber,
+						parser.CleanName(function.Parameters[0].Name, function.Parameters[0].Value), parser.CleanName(function.Parameters[1].Name, function.Parameters[1].Value))
+				}
+				break
+			}
+
+			if (function.Name == "readData" || function.Name == "writeData") && len(function.Parameters) == 2 {
+				fmt.Fprintf(bb, "if signal := qt.GetSignal(ptr, \"%vBuffer\"); signal != nil {\nreturn C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))\n}\n", function.Name)
+			}
+
+			fmt.Fprintf(bb, "if signal := qt.GetSignal(ptr, \"%v%v\"); signal != nil {\n",
 				function.Name,
 				function.OverloadNumber,
 			)
@@ -211,7 +248,7 @@ func goFunctionBody(function *parser.Function) string {
 				if function.Name == "readData" && len(function.Parameters) == 2 {
 					fmt.Fprint(bb, "var retS = cGoUnpackString(data)\n")
 					fmt.Fprintf(bb, "var ret = %v\n", converter.GoInput(fmt.Sprintf("signal.(%v)(%v)", converter.GoHeaderInputSignalFunction(function), converter.GoInputParametersForCallback(function)), function.Output, function))
-					fmt.Fprint(bb, "if ret > 0 {\nC.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))\n}\n")
+					fmt.Fprint(bb, "if ret > 0 {\ncopy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)\n}\n")
 					fmt.Fprint(bb, "return ret")
 				} else {
 					fmt.Fprintf(bb, "return %v", converter.GoInput(fmt.Sprintf("signal.(%v)(%v)", converter.GoHeaderInputSignalFunction(function), converter.GoInputParametersForCallback(function)), function.Output, function))
@@ -238,7 +275,7 @@ func goFunctionBody(function *parser.Function) string {
 					if function.Name == "readData" && len(function.Parameters) == 2 {
 						fmt.Fprint(bb, "var retS = cGoUnpackString(data)\n")
 						fmt.Fprintf(bb, "var ret = %v\n", converter.GoInput(fmt.Sprintf("New%vFromPointer(ptr).%v%vDefault(%v)", strings.Title(class.Name), strings.Replace(strings.Title(function.Name), parser.TILDE, "Destroy", -1), function.OverloadNumber, converter.GoInputParametersForCallback(function)), function.Output, function))
-						fmt.Fprint(bb, "if ret > 0 {\nC.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))\n}\n")
+						fmt.Fprint(bb, "if ret > 0 {\ncopy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)\n}\n")
 						fmt.Fprint(bb, "return ret")
 					} else {
 						fmt.Fprintf(bb, "\nreturn %v", converter.GoInput(fmt.Sprintf("New%vFromPointer(ptr).%v%vDefault(%v)", strings.Title(class.Name), strings.Replace(strings.Title(function.Name), parser.TILDE, "Destroy", -1), function.OverloadNumber, converter.GoInputParametersForCallback(function)), function.Output, function))
@@ -303,7 +340,7 @@ func goFunctionBody(function *parser.Function) string {
 
 	case parser.CONNECT, parser.DISCONNECT:
 		{
-			fmt.Fprintf(bb, "\nqt.%vSignal(fmt.Sprint(ptr.Pointer()), \"%v%v\"%v)",
+			fmt.Fprintf(bb, "\nqt.%vSignal(ptr.Pointer(), \"%v%v\"%v)",
 				function.SignalMode,
 				function.Name,
 				function.OverloadNumber,
@@ -319,7 +356,7 @@ func goFunctionBody(function *parser.Function) string {
 
 	if (function.Meta == parser.DESTRUCTOR || function.Name == "deleteLater" || function.Name == "destroyed" || strings.HasPrefix(function.Name, parser.TILDE)) && function.SignalMode == "" {
 		if class.HasCallbackFunctions() || class.IsSubClassOfQObject() {
-			fmt.Fprint(bb, "\nqt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))")
+			fmt.Fprint(bb, "\nqt.DisconnectAllSignals(ptr.Pointer())")
 		}
 		fmt.Fprint(bb, "\nptr.SetPointer(nil)")
 	}
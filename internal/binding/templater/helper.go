@@ -23,6 +23,33 @@ func hasUnimplementedPureVirtualFunctions(className string) bool {
 	return false
 }
 
+//value types of QtCore also get constructors that place the object into a core.Arena,
+//the arena frees them in bulk, so they don't need a finalizer
+func hasArenaConstructor(function *parser.Function) bool {
+	if function.Meta != parser.CONSTRUCTOR || UseStub() || parser.State.Moc {
+		return false
+	}
+	var class, ok = function.Class()
+	return ok && class.Module == "QtCore" && !(class.HasCallbackFunctions() || class.IsSubClassOfQObject())
+}
+
+//the data() callbacks of the item models fill a QVariant owned by the c++ caller,
+//instead of returning one that would have to be allocated on the heap for every cell
+func isModelDataCallback(function *parser.Function) bool {
+	return function.SignalMode == parser.CALLBACK && isModelData(function)
+}
+
+//the default implementation of data() gets a companion that fills a QVariant owned by the caller as well,
+//so the callback can fall back to it without a heap copy
+func isModelDataDefault(function *parser.Function) bool {
+	return function.Default && function.SignalMode == "" && isModelData(function)
+}
+
+func isModelData(function *parser.Function) bool {
+	return function.Name == "data" && parser.CleanValue(function.Output) == "QVariant" &&
+		len(function.Parameters) == 2 && parser.CleanValue(function.Parameters[0].Value) == "QModelIndex"
+}
+
 func goModule(module string) string {
 	return strings.ToLower(strings.TrimPrefix(module, "Qt"))
 }
@@ -219,6 +219,11 @@ func cTemplateFunctions(bb *bytes.Buffer, pc *parser.Class, ff func(*parser.Func
 					var out = ff(&f)
 					if out != "" {
 						fmt.Fprintf(bb, "%v%v", out, del)
+						if hasArenaConstructor(&f) {
+							var f = f
+							f.Arena = true
+							fmt.Fprintf(bb, "%v%v", ff(&f), del)
+						}
 						if isGo && f.Static {
 							fmt.Fprintf(bb, "%v{\n%v\n}\n\n",
 								func() string {
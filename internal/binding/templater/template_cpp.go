@@ -12,7 +12,20 @@ import (
 	"github.com/therecipe/qt/internal/utils"
 )
 
+//generated sources are split at class boundaries once a shard grows beyond this size,
+//so that the big modules compile in several smaller translation units
+const cppShardSize = 512 * 1024
+
 func CppTemplate(module string) []byte {
+	return cppTemplate(module, 0)[0]
+}
+
+//CppTemplateShards is like CppTemplate, but splits the classes over several sources, each with its own preamble
+func CppTemplateShards(module string) [][]byte {
+	return cppTemplate(module, cppShardSize)
+}
+
+func cppTemplate(module string, shardSize int) [][]byte {
 	utils.Log.WithField("0_module", module).Debug("generating cpp")
 
 	var bb = new(bytes.Buffer)
@@ -64,9 +77,14 @@ func CppTemplate(module string) []byte {
 		fmt.Fprint(bb, "\n")
 	}
 
+	var cuts = []int{bb.Len()}
 	for _, className := range parser.SortedClassNamesForModule(module, true) {
 		var class = parser.State.ClassMap[className]
 
+		if shardSize > 0 && !parser.State.Moc && bb.Len()-cuts[len(cuts)-1] >= shardSize {
+			cuts = append(cuts, bb.Len())
+		}
+
 		if class.IsSupported() {
 
 			if class.HasCallbackFunctions() || parser.State.Moc {
@@ -265,7 +283,22 @@ func CppTemplate(module string) []byte {
 		fmt.Fprintln(bb, "#include \"moc_moc.h\"")
 	}
 
-	return preambleCpp(module, bb.Bytes())
+	var (
+		head   = bb.Bytes()[:cuts[0]]
+		shards = make([][]byte, 0, len(cuts))
+	)
+	for i, cut := range cuts {
+		var end = bb.Len()
+		if i+1 < len(cuts) {
+			end = cuts[i+1]
+		}
+		if i > 0 && cut == end {
+			continue
+		}
+		var input = append(append([]byte{}, head...), bb.Bytes()[cut:end]...)
+		shards = append(shards, append([]byte{}, preambleCpp(module, input)...))
+	}
+	return shards
 }
 
 func preambleCpp(module string, input []byte) []byte {
@@ -364,8 +397,103 @@ func preambleCpp(module string, input []byte) []byte {
 		}
 	}
 
+	if strings.Contains(string(input), "goArenaAlloc<") {
+		fmt.Fprint(bb, "#include \"utils-core.h\"\n")
+	}
+
+	if strings.Contains(string(input), "goUnpackStringList(") || strings.Contains(string(input), "goUnpackByteArrayList(") {
+		for _, header := range []string{"QByteArray", "QList", "QStringList", "QtEndian", "cstdlib"} {
+			if !strings.Contains(bb.String(), fmt.Sprintf("<%v>", header)) {
+				fmt.Fprintf(bb, "#include <%v>\n", header)
+			}
+		}
+	}
+
+	if strings.Contains(string(input), "goPackStringList(") {
+		for _, header := range []string{"QByteArray", "QList", "QScopedPointer", "QStringList", "cstdlib", "cstring"} {
+			if !strings.Contains(bb.String(), fmt.Sprintf("<%v>", header)) {
+				fmt.Fprintf(bb, "#include <%v>\n", header)
+			}
+		}
+	}
+
 	fmt.Fprint(bb, "\n")
 
+	//string lists are passed as one malloc'ed buffer of little endian uint32 prefixed utf8 strings, preceded by the number of strings
+	if strings.Contains(string(input), "goPackStringList(") {
+		fmt.Fprint(bb, `static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+`)
+	}
+
+	//the same format is used from Go to C++, the buffer stays owned by Go
+	if strings.Contains(string(input), "goUnpackStringList(") || strings.Contains(string(input), "goUnpackByteArrayList(") {
+		fmt.Fprint(bb, `static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+`)
+	}
+
 	bb.Write(input)
 
 	return bb.Bytes()
@@ -22,6 +22,9 @@ func GoTemplate(module string, stub bool) []byte {
 
 	if !(UseStub() || stub) {
 		fmt.Fprintf(bb, "func cGoUnpackString(s C.struct_%v_PackedString) string { if len := int(s.len); len == -1 {\n return C.GoString(s.data)\n }\n return C.GoStringN(s.data, C.int(s.len)) }\n", strings.Title(module))
+		fmt.Fprintf(bb, "func cGoUnpackStringList(s C.struct_%v_PackedString) []string {\nif s.data == nil || s.len < 4 {\nreturn make([]string, 0)\n}\nvar b = C.GoStringN(s.data, C.int(s.len))\nvar out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))\nfor i := 4; i+4 <= len(b); {\nvar n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)\nout = append(out, b[i+4:i+4+n])\ni += 4 + n\n}\nreturn out\n}\n", strings.Title(module))
+		fmt.Fprint(bb, "func cGoPackStringList(l []string) *C.char {\nvar n = 4\nfor _, s := range l {\nn += 4 + len(s)\n}\nvar p = C.malloc(C.size_t(n))\nvar b, o = qt.UnsafeBytes(p, n), 0\nfor i := -1; i < len(l); i++ {\nvar c = len(l)\nif i >= 0 {\nc = len(l[i])\n}\nb[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)\no += 4\nif i >= 0 {\no += copy(b[o:], l[i])\n}\n}\nreturn (*C.char)(p)\n}\n")
+		fmt.Fprintf(bb, "func cGoUnpackStringListAndFree(s C.struct_%v_PackedString) []string {\ndefer C.free(unsafe.Pointer(s.data))\nreturn cGoUnpackStringList(s)\n}\n", strings.Title(module))
 	}
 
 	if module == "QtAndroidExtras" {
@@ -165,7 +168,7 @@ func (ptr *%v) Destroy%v() {
 
 `, class.Name, class.Name, func() string {
 						if class.HasCallbackFunctions() || class.IsSubClassOfQObject() {
-							return "\nqt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))"
+							return "\nqt.DisconnectAllSignals(ptr.Pointer())"
 						}
 						return ""
 					}())
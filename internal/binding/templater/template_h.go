@@ -42,7 +42,7 @@ func HTemplate(m string) []byte {
 
 	//body
 	for _, c := range parser.SortedClassesForModule(m, true) {
-		cTemplate(bb, c, cppEnumHeader, cppFunctionHeader, ";\n", false)
+		cTemplate(bb, c, cppEnumHeader, cppFunctionDeclaration, ";\n", false)
 	}
 
 	//footer
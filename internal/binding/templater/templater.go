@@ -1,7 +1,13 @@
 package templater
 
 import (
+	"crypto/sha1"
+	"encoding/hex"
+	"fmt"
+	"os"
+	"path/filepath"
 	"strings"
+	"sync"
 
 	"github.com/therecipe/qt/internal/binding/parser"
 	"github.com/therecipe/qt/internal/utils"
@@ -62,8 +68,23 @@ func GenModule(m string) {
 	}
 
 	if !UseStub() {
-		utils.SaveBytes(utils.GoQtPkgPath(strings.ToLower(m), strings.ToLower(m)+suffix+".cpp"), CppTemplate(m))
+		for i, shard := range CppTemplateShards(m) {
+			var name = strings.ToLower(m) + suffix + ".cpp"
+			if i > 0 {
+				name = fmt.Sprintf("%v-%v%v.cpp", strings.ToLower(m), i+1, suffix)
+			}
+			utils.SaveBytes(utils.GoQtPkgPath(strings.ToLower(m), name), shard)
+		}
 		utils.SaveBytes(utils.GoQtPkgPath(strings.ToLower(m), strings.ToLower(m)+suffix+".h"), HTemplate(m))
+
+		//handwritten helpers that don't fit the generated bindings,
+		//the go ones are excluded from the build of the files dir as they belong to different packages
+		for _, ext := range []string{".go", ".cpp", ".h"} {
+			var name = "utils-" + strings.ToLower(m) + ext
+			if utils.ExistsFile(utils.GoQtPkgPath("internal", "binding", "files", name)) {
+				utils.Save(utils.GoQtPkgPath(strings.ToLower(m), name), strings.TrimPrefix(utils.Load(utils.GoQtPkgPath("internal", "binding", "files", name)), "//go:build ignore\n// +build ignore\n\n"))
+			}
+		}
 	}
 
 	//always generate full
@@ -74,3 +95,32 @@ func GenModule(m string) {
 	//may generate stub
 	utils.SaveBytes(utils.GoQtPkgPath(strings.ToLower(m), strings.ToLower(m)+".go"), GoTemplate(m, suffix != ""))
 }
+
+var (
+	version     string
+	versionOnce sync.Once
+)
+
+//Version hashes the sources of the generator itself, so that any change to it invalidates previously generated modules
+func Version() string {
+	versionOnce.Do(func() {
+		var h = sha1.New()
+		for _, dir := range []string{"parser", "converter", "templater", "files"} {
+			filepath.Walk(utils.GoQtPkgPath("internal", "binding", dir), func(path string, info os.FileInfo, err error) error {
+				if err != nil {
+					return err
+				}
+				if info.IsDir() {
+					if info.Name() == "docs" {
+						return filepath.SkipDir
+					}
+					return nil
+				}
+				fmt.Fprintf(h, "%v\n%v\n", filepath.Base(path), utils.LoadOptional(path))
+				return nil
+			})
+		}
+		version = hex.EncodeToString(h.Sum(nil))
+	})
+	return version
+}
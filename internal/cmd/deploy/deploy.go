@@ -31,6 +31,7 @@ var (
 	ending                 string
 	buildDocker            bool
 	gLdFlags               string
+	rccFile                string
 )
 
 type State struct {
@@ -100,7 +101,7 @@ func Deploy(s *State) {
 				if env_output_dir := os.Getenv("QTRCC_OUTPUT_DIR"); env_output_dir != "" {
 					qtrcc_output = &env_output_dir
 				}
-				rcc.Rcc(qtrcc_cwd, buildTarget, qtrcc_output)
+				rccFile = rcc.Rcc(qtrcc_cwd, buildTarget, qtrcc_output)
 				utils.Log.Debug("qtrcc - done")
 
 				//moc
@@ -636,6 +637,20 @@ func predeploy() {
 			}
 		}
 	}
+
+	//ship the binary resource file where rrc.cpp registers it from
+	if rccFile != "" {
+		var dst = depPath
+		switch {
+		case buildTarget == "android":
+			dst = filepath.Join(depPath, "build", "assets")
+
+		case buildTarget == "desktop" && runtime.GOOS == "darwin":
+			dst = filepath.Join(depPath, fmt.Sprintf("%v.app/Contents/Resources", appName))
+		}
+		utils.MkdirAll(dst)
+		utils.Save(filepath.Join(dst, filepath.Base(rccFile)), utils.Load(rccFile))
+	}
 }
 
 func deployInternal() {
@@ -959,6 +974,9 @@ func cleanup() error {
 	utils.RemoveAll(filepath.Join(appPath, "rrc.go"))
 	utils.RemoveAll(filepath.Join(appPath, "rrc.qrc"))
 	utils.RemoveAll(filepath.Join(appPath, "rrc.cpp"))
+	if rccFile != "" {
+		utils.RemoveAll(rccFile)
+	}
 	utils.RemoveAll(filepath.Join(appPath, "cgo_main_wrapper.go"))
 
 	return moc.CleanPath(appPath)
@@ -18,7 +18,7 @@ func Minimal(appPath, buildTarget string) {
 
 	var (
 		imported       []string
-		cached         []string
+		used           = newUsage()
 		importedPkgMap = make(map[string]struct{})
 		goPaths        = strings.Split(os.Getenv("GOPATH"), string(os.PathListSeparator))
 	)
@@ -68,7 +68,7 @@ func Minimal(appPath, buildTarget string) {
 
 			if file := utils.Load(appPath); strings.Contains(file, "github.com/therecipe/qt/") &&
 				!(strings.Contains(file, "github.com/therecipe/qt/androidextras") && strings.Count(file, "github.com/therecipe/qt/") == 1) {
-				cached = append(cached, file)
+				used.add(appPath, file, false)
 			}
 		}
 
@@ -96,10 +96,15 @@ func Minimal(appPath, buildTarget string) {
 		parser.LoadModules()
 	}
 
-	var file = strings.Join(cached, "")
+	//the handwritten helpers are always compiled, so the classes they use need to be exported as well
+	for _, m := range importedPkgs {
+		if name := utils.GoQtPkgPath(strings.ToLower(m), "utils-"+strings.ToLower(m)+".go"); utils.ExistsFile(name) {
+			used.add(name, utils.Load(name), true)
+		}
+	}
 
 	for className, c := range parser.State.ClassMap {
-		if strings.Contains(file, className) {
+		if used.class(className) {
 			c.Export = true
 
 			if hasPureVirtualFunctions(className) {
@@ -129,7 +134,7 @@ func Minimal(appPath, buildTarget string) {
 					for _, signalMode := range []string{parser.CONNECT, parser.DISCONNECT, ""} {
 						f.SignalMode = signalMode
 
-						if strings.Contains(file, "."+converter.GoHeaderName(f)+"(") {
+						if used.method(converter.GoHeaderName(f)) {
 							exportFunction(c, f)
 						}
 					}
@@ -138,18 +143,18 @@ func Minimal(appPath, buildTarget string) {
 			default:
 				{
 					if f.Static {
-						if strings.Contains(file, converter.GoHeaderName(f)+"(") {
+						if used.function(converter.GoHeaderName(f)) {
 							exportFunction(c, f)
 						}
 
 						var fTmp = *f
 						fTmp.Static = false
 
-						if strings.Contains(file, "."+converter.GoHeaderName(&fTmp)+"(") {
+						if used.method(converter.GoHeaderName(&fTmp)) {
 							exportFunction(c, f)
 						}
 					} else {
-						if strings.Contains(file, "."+converter.GoHeaderName(f)+"(") {
+						if used.method(converter.GoHeaderName(f)) {
 							exportFunction(c, f)
 						}
 					}
@@ -231,7 +236,9 @@ func exportFunction(class *parser.Class, function *parser.Function) {
 						(strings.HasSuffix(f.Name, "_atList") ||
 							strings.HasSuffix(f.Name, "_setList") ||
 							strings.HasSuffix(f.Name, "_newList") ||
-							strings.HasSuffix(f.Name, "_keyList")) {
+							strings.HasSuffix(f.Name, "_keyList") ||
+							strings.HasSuffix(f.Name, "_newListBuffer") ||
+							strings.HasSuffix(f.Name, "_fillList")) {
 						f.Export = true
 					}
 				}
@@ -245,7 +252,9 @@ func exportFunction(class *parser.Class, function *parser.Function) {
 							(strings.HasSuffix(f.Name, "_atList") ||
 								strings.HasSuffix(f.Name, "_setList") ||
 								strings.HasSuffix(f.Name, "_newList") ||
-								strings.HasSuffix(f.Name, "_keyList")) {
+								strings.HasSuffix(f.Name, "_keyList") ||
+								strings.HasSuffix(f.Name, "_newListBuffer") ||
+								strings.HasSuffix(f.Name, "_fillList")) {
 							f.Export = true
 						}
 					}
@@ -259,7 +268,9 @@ func exportFunction(class *parser.Class, function *parser.Function) {
 							(strings.HasSuffix(f.Name, "_atList") ||
 								strings.HasSuffix(f.Name, "_setList") ||
 								strings.HasSuffix(f.Name, "_newList") ||
-								strings.HasSuffix(f.Name, "_keyList")) {
+								strings.HasSuffix(f.Name, "_keyList") ||
+								strings.HasSuffix(f.Name, "_newListBuffer") ||
+								strings.HasSuffix(f.Name, "_fillList")) {
 							f.Export = true
 						}
 					}
@@ -273,7 +284,9 @@ func exportFunction(class *parser.Class, function *parser.Function) {
 								(strings.HasSuffix(f.Name, "_atList") ||
 									strings.HasSuffix(f.Name, "_setList") ||
 									strings.HasSuffix(f.Name, "_newList") ||
-									strings.HasSuffix(f.Name, "_keyList")) {
+									strings.HasSuffix(f.Name, "_keyList") ||
+									strings.HasSuffix(f.Name, "_newListBuffer") ||
+									strings.HasSuffix(f.Name, "_fillList")) {
 								f.Export = true
 							}
 						}
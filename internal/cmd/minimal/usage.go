@@ -0,0 +1,109 @@
+package minimal
+
+import (
+	"go/ast"
+	goparser "go/parser"
+	"go/token"
+	"strconv"
+	"strings"
+
+	"github.com/therecipe/qt/internal/utils"
+)
+
+//usage collects the qt identifiers that are referenced from go code, comments and string literals are ignored
+type usage struct {
+	idents    map[string]struct{} //qualified identifiers of the qt packages, or any identifier inside of them
+	selectors map[string]struct{} //selected names, which includes every called method and method value
+	unparsed  []string            //sources that failed to parse, these are still matched by substring like before
+}
+
+func newUsage() *usage {
+	return &usage{idents: make(map[string]struct{}), selectors: make(map[string]struct{})}
+}
+
+func (u *usage) add(name, src string, qtPkg bool) {
+	var file, err = goparser.ParseFile(token.NewFileSet(), name, src, 0)
+	if err != nil {
+		utils.Log.WithError(err).Warnf("failed to parse file %v, falling back to a substring scan", name)
+		u.unparsed = append(u.unparsed, src)
+		return
+	}
+
+	var qtImports = make(map[string]struct{})
+	for _, i := range file.Imports {
+		var path, _ = strconv.Unquote(i.Path.Value)
+		if !strings.HasPrefix(path, "github.com/therecipe/qt/") {
+			continue
+		}
+		if i.Name != nil {
+			qtImports[i.Name.Name] = struct{}{}
+		} else {
+			qtImports[path[strings.LastIndex(path, "/")+1:]] = struct{}{}
+		}
+	}
+
+	ast.Inspect(file, func(n ast.Node) bool {
+		switch n := n.(type) {
+		case *ast.SelectorExpr:
+			{
+				u.selectors[n.Sel.Name] = struct{}{}
+				if x, ok := n.X.(*ast.Ident); ok {
+					if _, ok := qtImports[x.Name]; ok {
+						u.idents[n.Sel.Name] = struct{}{}
+						return false
+					}
+				}
+			}
+
+		case *ast.Ident:
+			{
+				if qtPkg {
+					u.idents[n.Name] = struct{}{}
+				}
+			}
+		}
+		return true
+	})
+}
+
+//class reports whether the class itself, one of its constructors, statics or enums is referenced
+func (u *usage) class(name string) bool {
+	for id := range u.idents {
+		switch {
+		case id == name, id == name+"_ITF", id == "PointerFrom"+name, strings.HasPrefix(id, name+"_"):
+			return true
+
+		case strings.HasPrefix(id, "New"+name):
+			if strings.Trim(strings.TrimSuffix(strings.TrimPrefix(id, "New"+name), "FromPointer"), "0123456789") == "" {
+				return true
+			}
+		}
+	}
+	return u.scan(name)
+}
+
+func (u *usage) function(name string) bool {
+	if _, ok := u.idents[name]; ok {
+		return true
+	}
+	return u.scan(name + "(")
+}
+
+func (u *usage) method(name string) bool {
+	if _, ok := u.selectors[name]; ok {
+		return true
+	}
+	if _, ok := u.idents[name]; ok {
+		return true
+	}
+	return u.scan("." + name + "(")
+}
+
+func (u *usage) scan(s string) bool {
+	for _, src := range u.unparsed {
+		if strings.Contains(src, s) {
+			return true
+		}
+	}
+	return false
+}
@@ -1,6 +1,11 @@
 package moc
 
 import (
+	"bufio"
+	"bytes"
+	"crypto/sha1"
+	"encoding/gob"
+	"encoding/hex"
 	"errors"
 	"fmt"
 	"go/ast"
@@ -12,6 +17,7 @@ import (
 	"path/filepath"
 	"runtime"
 	"strings"
+	"sync"
 
 	"github.com/Sirupsen/logrus"
 
@@ -46,13 +52,77 @@ func cacheModules() (err error) {
 		return
 	}
 
-	if len(parser.State.ClassMap) == 0 {
-		parser.LoadModules()
+	//the parsed class map is kept on disk, so that the index files only need to be parsed again once they or the generator change
+	var (
+		path = filepath.Join(utils.MustGoPath(), "pkg", "qtmoc", "classmap.gob")
+		key  = classMapKey()
+	)
+	if loadClassMap(path, key) {
+		utils.Log.WithField("func", "cacheModules").Debug("loaded modules from cache")
+		return
+	}
+
+	parser.LoadModules()
+
+	if err := saveClassMap(path, key); err != nil {
+		utils.Log.WithError(err).WithField("func", "cacheModules").Warn("failed to cache modules")
 	}
 
 	return
 }
 
+func classMapKey() string {
+	var h = sha1.New()
+	fmt.Fprintf(h, "%v\n%v\n", templater.Version(), utils.QT_VERSION())
+	for _, m := range parser.GetLibs() {
+		fmt.Fprintf(h, "%v:%v\n", m, parser.IndexHash(m))
+	}
+	return hex.EncodeToString(h.Sum(nil))
+}
+
+func loadClassMap(path, key string) bool {
+	var f, err = os.Open(path)
+	if err != nil {
+		return false
+	}
+	defer f.Close()
+
+	var (
+		dec      = gob.NewDecoder(bufio.NewReader(f))
+		cached   string
+		classMap map[string]*parser.Class
+	)
+	if dec.Decode(&cached) != nil || cached != key || dec.Decode(&classMap) != nil {
+		return false
+	}
+	parser.State.ClassMap = classMap
+	return true
+}
+
+func saveClassMap(path, key string) error {
+	if err := os.MkdirAll(filepath.Dir(path), 0755); err != nil {
+		return err
+	}
+
+	var bb = new(bytes.Buffer)
+	defer bb.Reset()
+
+	var enc = gob.NewEncoder(bb)
+	if err := enc.Encode(key); err != nil {
+		return err
+	}
+	if err := enc.Encode(parser.State.ClassMap); err != nil {
+		return err
+	}
+
+	//write to a temporary file first, as several qtmoc processes may run at the same time
+	var tmp = fmt.Sprintf("%v.%v", path, os.Getpid())
+	if err := ioutil.WriteFile(tmp, bb.Bytes(), 0644); err != nil {
+		return err
+	}
+	return os.Rename(tmp, path)
+}
+
 // return how many moc classes are in module, delete those that are not
 func (m *appMoc) cleanupClassMap() (size int) {
 	for _, class := range m.module.Namespace.Classes {
@@ -65,17 +135,35 @@ func (m *appMoc) cleanupClassMap() (size int) {
 	return
 }
 
-func (m *appMoc) parseGo(path string) error {
-	src, errRead := ioutil.ReadFile(path)
-	if errRead != nil {
-		return errRead
+//parseGo reads and parses the given files concurrently, the structs are collected in the order of the files afterwards
+func (m *appMoc) parseGo(paths []string) error {
+	var (
+		srcs  = make([][]byte, len(paths))
+		files = make([]*ast.File, len(paths))
+		errs  = make([]error, len(paths))
+		wg    sync.WaitGroup
+	)
+	for i, path := range paths {
+		wg.Add(1)
+		go func(i int, path string) {
+			defer wg.Done()
+			if srcs[i], errs[i] = ioutil.ReadFile(path); errs[i] == nil {
+				files[i], errs[i] = goparser.ParseFile(token.NewFileSet(), path, srcs[i], 0)
+			}
+		}(i, path)
 	}
+	wg.Wait()
 
-	file, errParse := goparser.ParseFile(token.NewFileSet(), path, nil, 0)
-	if errParse != nil {
-		return errParse
+	for i := range paths {
+		if errs[i] != nil {
+			return errs[i]
+		}
+		m.collectStructs(srcs[i], files[i])
 	}
+	return nil
+}
 
+func (m *appMoc) collectStructs(src []byte, file *ast.File) {
 	parser.State.Module = file.Name.String()
 
 	for _, d := range file.Decls {
@@ -190,13 +278,12 @@ func (m *appMoc) parseGo(path string) error {
 			m.module.Namespace.Classes = append(m.module.Namespace.Classes, class)
 		}
 	}
-	return nil
 }
 
 func CleanPath(path string) (err error) {
 	var (
 		tmpFileNames = []string{
-			"moc_cleanup.json",
+			"moc_cleanup.json", "moc.sha1",
 			"moc.h", "moc.go", "moc.cpp", "moc_moc.h",
 			"moc_cgo_desktop_darwin_amd64.go", "moc_cgo_desktop_windows_386.go", "moc_cgo_desktop_windows_amd64.go", "moc_cgo_desktop_linux_amd64.go",
 			"moc_cgo_android_linux_arm.go",
@@ -311,6 +398,7 @@ func (m *appMoc) generate() error {
 		"func": "appMoc.generate",
 	}
 
+	var paths = make([]string, 0)
 	for _, info := range files {
 		filename := filepath.Join(m.appPath, info.Name())
 		loopFields := logrus.Fields{"filename": filename}
@@ -324,18 +412,33 @@ func (m *appMoc) generate() error {
 			continue
 		}
 
-		if strings.HasPrefix(filename, "moc") {
+		if strings.HasPrefix(info.Name(), "moc") {
 			utils.Log.WithFields(fields).WithFields(loopFields).Debug("Skip moc output")
 			continue
 		}
 
 		utils.Log.WithFields(fields).WithFields(loopFields).Debug("Process source")
-		if err = m.parseGo(filename); err != nil {
-			return err
-		}
+		paths = append(paths, filename)
+	}
+
+	//skip the package if neither its sources nor the generator changed since the last run
+	var inputKey = m.inputKey(paths)
+	if utils.LoadOptional(filepath.Join(m.appPath, "moc.sha1")) == inputKey && m.hasOutput() {
+		utils.Log.WithFields(fields).Debug("moc files are up to date")
+		return nil
+	}
+
+	if err = m.parseGo(paths); err != nil {
+		return err
 	}
 
-	structsSize := len(m.module.Namespace.Classes)
+	//only structs that embed something can be subclasses of a qt class
+	var structsSize int
+	for _, c := range m.module.Namespace.Classes {
+		if c.Bases != "" {
+			structsSize++
+		}
+	}
 	if structsSize == 0 {
 		utils.Log.WithFields(fields).Debug("failed to find moc structs")
 		return nil
@@ -426,7 +529,28 @@ func (m *appMoc) generate() error {
 		}
 	}
 
-	return m.runQtMoc()
+	if err = m.runQtMoc(); err != nil {
+		return err
+	}
+	return utils.Save(filepath.Join(m.appPath, "moc.sha1"), inputKey)
+}
+
+func (m *appMoc) inputKey(paths []string) string {
+	var h = sha1.New()
+	fmt.Fprintf(h, "%v\n%v\n", templater.Version(), m.buildTarget)
+	for _, path := range paths {
+		fmt.Fprintf(h, "%v\n%v\n", filepath.Base(path), utils.LoadOptional(path))
+	}
+	return hex.EncodeToString(h.Sum(nil))
+}
+
+func (m *appMoc) hasOutput() bool {
+	for _, name := range []string{"moc.h", "moc.go", "moc.cpp", "moc_moc.h"} {
+		if !utils.ExistsFile(filepath.Join(m.appPath, name)) {
+			return false
+		}
+	}
+	return true
 }
 
 func isInClassArray(classes []*parser.Class, className string) bool {
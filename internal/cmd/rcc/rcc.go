@@ -1,6 +1,11 @@
 package rcc
 
 import (
+	"bytes"
+	"compress/zlib"
+	"crypto/sha1"
+	"encoding/hex"
+	"encoding/xml"
 	"fmt"
 	"io/ioutil"
 	"os"
@@ -12,7 +17,8 @@ import (
 	"github.com/therecipe/qt/internal/utils"
 )
 
-func Rcc(appPath, buildTarget string, output_dir *string) {
+//Rcc returns the path of the binary resource file if QTRCC_BINARY is used, it needs to be shipped with the application
+func Rcc(appPath, buildTarget string, output_dir *string) string {
 	if output_dir == nil {
 		var toutput_dir string
 		output_dir = &toutput_dir
@@ -75,14 +81,18 @@ func Rcc(appPath, buildTarget string, output_dir *string) {
 
 	utils.Save(qmlGo, qmlHeader(appName))
 
-	var rcc = exec.Command(rccPath, "-project", "-o", qmlQrc)
-	rcc.Dir = filepath.Join(appPath, "qml")
-	utils.RunCmd(rcc, fmt.Sprintf("execute rcc.1 on %v", runtime.GOOS))
-
-	utils.Save(qmlQrc, strings.Replace(utils.Load(qmlQrc), "<file>./", "<file>qml/", -1))
-
-	if utils.ExistsFile(filepath.Join(appPath, "qtquickcontrols2.conf")) {
-		utils.Save(qmlQrc, strings.Replace(utils.Load(qmlQrc), "<qresource>", "<qresource>\n<file>qtquickcontrols2.conf</file>", -1))
+	var (
+		binary    = strings.ToLower(os.Getenv("QTRCC_BINARY")) == "true"
+		qmlFiles  = qmlResources(appPath)
+		qmlBinary = filepath.Join(filepath.Dir(qmlCpp), appName+".rcc")
+		output    = qmlCpp
+	)
+	if binary && !BinaryTarget(buildTarget) {
+		utils.Log.Warnf("QTRCC_BINARY isn't supported for %v, the resources are embedded instead", buildTarget)
+		binary = false
+	}
+	if binary {
+		output = qmlBinary
 	}
 
 	var files, err = ioutil.ReadDir(appPath)
@@ -92,15 +102,192 @@ func Rcc(appPath, buildTarget string, output_dir *string) {
 
 	var fileList = make([]string, 0)
 	for _, file := range files {
-		if !file.IsDir() && strings.HasSuffix(file.Name(), ".qrc") {
+		if !file.IsDir() && strings.HasSuffix(file.Name(), ".qrc") && file.Name() != filepath.Base(qmlQrc) {
 			fileList = append(fileList, filepath.Join(appPath, file.Name()))
 		}
 	}
+	fileList = append(fileList, qmlQrc)
+
+	//the output is cached outside of the project, as qtdeploy removes it again after each build
+	var (
+		key   = rccKey(appPath, rccPath, binary, qmlFiles, fileList)
+		cache = filepath.Join(utils.MustGoPath(), "pkg", "qtrcc", fmt.Sprintf("%x", sha1.Sum([]byte(appPath))))
+	)
+	if utils.LoadOptional(cache+".sha1") == key && utils.ExistsFile(cache+filepath.Ext(output)) {
+		utils.Log.Debug("resources are up to date -> don't re-run rcc")
+		if data := utils.LoadOptional(cache + filepath.Ext(output)); utils.LoadOptional(output) != data {
+			utils.Save(output, data)
+		}
+	} else {
+		utils.Save(qmlQrc, qmlProject(appPath, qmlFiles))
+
+		var rcc = exec.Command(rccPath, "-o", output)
+		if binary {
+			rcc.Args = append(rcc.Args, "-binary")
+		}
+		rcc.Args = append(rcc.Args, fileList...)
+
+		utils.RunCmd(rcc, fmt.Sprintf("execute rcc on %v", runtime.GOOS))
+
+		utils.MkdirAll(filepath.Dir(cache))
+		utils.Save(cache+filepath.Ext(output), utils.Load(output))
+		utils.Save(cache+".sha1", key)
+	}
+
+	if binary {
+		utils.Log.Infof("%v needs to be shipped with the application", filepath.Base(qmlBinary))
+		utils.Save(qmlCpp, qmlRegister(appName))
+		return qmlBinary
+	}
+	return ""
+}
+
+//BinaryTarget reports if qtdeploy knows where the binary resource file goes for the target
+func BinaryTarget(buildTarget string) bool {
+	switch buildTarget {
+	case "ios", "ios-simulator", "sailfish", "sailfish-emulator":
+		return false
+	}
+	return true
+}
+
+//qmlResources lists the files in the qml folder like "rcc -project" would
+func qmlResources(appPath string) []string {
+	var out = make([]string, 0)
+	if utils.ExistsFile(filepath.Join(appPath, "qtquickcontrols2.conf")) {
+		out = append(out, "qtquickcontrols2.conf")
+	}
+	filepath.Walk(filepath.Join(appPath, "qml"), func(path string, info os.FileInfo, err error) error {
+		if err != nil {
+			return err
+		}
+		if strings.HasPrefix(info.Name(), ".") {
+			if info.IsDir() {
+				return filepath.SkipDir
+			}
+			return nil
+		}
+		if !info.IsDir() {
+			var rel, _ = filepath.Rel(appPath, path)
+			out = append(out, filepath.ToSlash(rel))
+		}
+		return nil
+	})
+	return out
+}
+
+//qmlProject writes the qrc file for the qml folder.
+//rcc only keeps the compressed data if it saves at least 70%, so files that don't get close to that (images, fonts, ...) aren't compressed at all.
+//identical files can't share their data within a qrc file, so they are only reported.
+func qmlProject(appPath string, qmlFiles []string) string {
+	var (
+		bb   = new(bytes.Buffer)
+		seen = make(map[[sha1.Size]byte]string)
+	)
+	defer bb.Reset()
 
-	rcc = exec.Command(rccPath, "-o", qmlCpp)
-	rcc.Args = append(rcc.Args, fileList...)
+	fmt.Fprint(bb, "<!DOCTYPE RCC><RCC version=\"1.0\">\n<qresource>\n")
+	for _, name := range qmlFiles {
+		var data, _ = ioutil.ReadFile(filepath.Join(appPath, filepath.FromSlash(name)))
+
+		if sum := sha1.Sum(data); len(data) > 0 {
+			if first, ok := seen[sum]; ok {
+				utils.Log.Warnf("%v is identical to %v and gets embedded twice", name, first)
+			} else {
+				seen[sum] = name
+			}
+		}
+
+		var attr string
+		if compressionRatio(data) < 60 {
+			attr = " compress=\"0\""
+		}
+		fmt.Fprintf(bb, "<file%v>", attr)
+		xml.EscapeText(bb, []byte(name))
+		fmt.Fprint(bb, "</file>\n")
+	}
+	fmt.Fprint(bb, "</qresource>\n</RCC>\n")
+
+	return bb.String()
+}
+
+//compressionRatio returns how many percent zlib saves on the data
+func compressionRatio(data []byte) int {
+	if len(data) == 0 {
+		return 0
+	}
+	var bb = new(bytes.Buffer)
+	var w = zlib.NewWriter(bb)
+	w.Write(data)
+	w.Close()
+	return 100 * (len(data) - bb.Len()) / len(data)
+}
+
+//rccKey hashes everything the rcc output depends on, which are the qrc files and the files they list
+func rccKey(appPath, rccPath string, binary bool, qmlFiles, fileList []string) string {
+	var h = sha1.New()
+	fmt.Fprintf(h, "%v\n%v\n", rccPath, binary)
+
+	var hashFile = func(path string) {
+		filepath.Walk(path, func(path string, info os.FileInfo, err error) error {
+			if err == nil && !info.IsDir() {
+				fmt.Fprintf(h, "%v\n%v\n", path, utils.LoadOptional(path))
+			}
+			return nil
+		})
+	}
+
+	for _, name := range qmlFiles {
+		hashFile(filepath.Join(appPath, filepath.FromSlash(name)))
+	}
+
+	for _, qrc := range fileList {
+		if filepath.Base(qrc) == "rrc.qrc" {
+			continue
+		}
+
+		var data = utils.Load(qrc)
+		fmt.Fprintf(h, "%v\n%v\n", qrc, data)
+
+		var project struct {
+			Resources []struct {
+				Files []string `xml:"file"`
+			} `xml:"qresource"`
+		}
+		if err := xml.Unmarshal([]byte(data), &project); err != nil {
+			utils.Log.WithError(err).Warnf("failed to parse %v", qrc)
+			continue
+		}
+		for _, r := range project.Resources {
+			for _, f := range r.Files {
+				hashFile(filepath.Join(filepath.Dir(qrc), filepath.FromSlash(strings.TrimSpace(f))))
+			}
+		}
+	}
+
+	return hex.EncodeToString(h.Sum(nil))
+}
+
+//qmlRegister registers the binary resource file where qtdeploy puts it, it gets mapped into memory instead of being copied.
+//that's next to the executable, except for the Resources folder of macOS bundles and the assets of android packages
+func qmlRegister(appName string) string {
+	return fmt.Sprintf(`#include <QCoreApplication>
+#include <QResource>
+#include <QString>
+
+static void registerRrc()
+{
+#if defined(Q_OS_ANDROID)
+	QResource::registerResource(QStringLiteral("assets:/%[1]v.rcc"));
+#elif defined(Q_OS_OSX)
+	QResource::registerResource(QCoreApplication::applicationDirPath() + QStringLiteral("/../Resources/%[1]v.rcc"));
+#else
+	QResource::registerResource(QCoreApplication::applicationDirPath() + QStringLiteral("/%[1]v.rcc"));
+#endif
+}
 
-	utils.RunCmd(rcc, fmt.Sprintf("execute rcc.2 on %v", runtime.GOOS))
+Q_COREAPP_STARTUP_FUNCTION(registerRrc)
+`, appName)
 }
 
 //TODO: make docker compatible
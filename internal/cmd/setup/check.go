@@ -31,6 +31,7 @@ func check(buildTarget string) {
 	utils.Log.Infoln("QT_VERSION_MAJOR:", utils.QT_VERSION_MAJOR())
 	utils.Log.Infoln("QT_DIR:", utils.QT_DIR())
 	utils.Log.Infoln("QT_STUB:", utils.QT_STUB())
+	utils.Log.Infoln("QT_INSTRUMENT:", utils.QT_INSTRUMENT())
 
 	switch buildTarget {
 	case "desktop", "ios", "ios-simulator":
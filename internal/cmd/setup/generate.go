@@ -1,6 +1,10 @@
 package setup
 
 import (
+	"crypto/sha1"
+	"encoding/hex"
+	"fmt"
+	"runtime"
 	"strings"
 
 	"github.com/therecipe/qt/internal/binding/parser"
@@ -29,9 +33,26 @@ func generate(buildTarget string) {
 		}
 	}
 
+	//only regenerate the modules whose index files, generator sources or target changed since the last run
+	var (
+		version = templater.Version()
+		stale   = make([]string, 0)
+		keys    = make(map[string]string)
+	)
+	for _, module := range parser.GetLibs() {
+		keys[module] = generateKey(module, buildTarget, version)
+		if utils.LoadOptional(generateStamp(module)) != keys[module] {
+			stale = append(stale, module)
+		}
+	}
+	if len(stale) == 0 {
+		utils.Log.Info("all modules are up to date -> don't re-generate")
+		return
+	}
+
 	parser.LoadModules()
 
-	for _, module := range parser.GetLibs() {
+	for _, module := range stale {
 		utils.Log.Infof("generating %v qt/%v", func() string {
 			if utils.QT_STUB() {
 				return "stub"
@@ -39,5 +60,18 @@ func generate(buildTarget string) {
 			return "full"
 		}(), strings.ToLower(module))
 		templater.GenModule(module)
+		if utils.ExistsDir(utils.GoQtPkgPath(strings.ToLower(module))) {
+			utils.Save(generateStamp(module), keys[module])
+		}
 	}
 }
+
+func generateKey(module, buildTarget, version string) string {
+	var h = sha1.New()
+	fmt.Fprintf(h, "%v\n%v\n%v\n%v\n%v\n%v\n%v\n%v\n", parser.IndexHash(module), version, buildTarget, utils.QT_STUB(), utils.QT_VERSION(), runtime.GOOS, utils.QT_DEBUG(), utils.QT_INSTRUMENT())
+	return hex.EncodeToString(h.Sum(nil))
+}
+
+func generateStamp(module string) string {
+	return utils.GoQtPkgPath(strings.ToLower(module), ".qtsetup-generate")
+}
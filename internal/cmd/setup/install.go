@@ -7,8 +7,11 @@ import (
 	"os/exec"
 	"path/filepath"
 	"runtime"
+	"sort"
 	"strconv"
 	"strings"
+	"sync"
+	"time"
 
 	"github.com/therecipe/qt/internal/binding/parser"
 	"github.com/therecipe/qt/internal/utils"
@@ -48,13 +51,7 @@ func install(buildTarget string) {
 		return
 	}
 
-	utils.Log.Infof("starting to install modules (~%v5min)", func() string {
-		if !utils.QT_STUB() {
-			return "1"
-		}
-		return ""
-	}())
-
+	var modules = make([]string, 0)
 	for _, module := range parser.GetLibs() {
 		if parser.ShouldBuild(module) {
 
@@ -62,23 +59,145 @@ func install(buildTarget string) {
 				!(strings.HasPrefix(buildTarget, "ios") && (module == "DBus" || module == "SerialPort" || module == "SerialBus" || module == "WebEngine" || module == "PrintSupport" || module == "Designer" || strings.HasSuffix(module, "Extras"))) && //TODO: support for PrintSupport
 				!(strings.HasPrefix(buildTarget, "rpi") && (module == "WebEngine" || module == "Designer" || strings.HasSuffix(module, "Extras"))) { //TODO: support for WebEngine (rpi2 + rpi3)
 
-				utils.Log.Infof("installing%v qt/%v", func() string {
-					if utils.QT_STUB() {
-						return " stub"
-					}
-					return " full"
-				}(), strings.ToLower(module))
+				modules = append(modules, module)
+			}
+		}
+	}
 
-				utils.RunCmdOptional(installPkgCmd(buildTarget, tagFlags, fmt.Sprintf("github.com/therecipe/qt/%v", strings.ToLower(module)), env), fmt.Sprintf("install.%v", strings.ToLower(module)))
-				//also install armv7 modules
-				if buildTarget == "ios" {
-					var cmd = installPkgCmd(buildTarget, tagFlags, fmt.Sprintf("github.com/therecipe/qt/%v", strings.ToLower(module)), env)
-					cmd.Env = append(strings.Split(strings.Replace(strings.Replace(strings.Join(cmd.Env, "|"), "-arch arm64", "-arch armv7", -1), "arm64", "arm", -1), "|"), "GOARM=7")
-					utils.RunCmdOptional(cmd, fmt.Sprintf("install.%v", strings.ToLower(module)))
+	var (
+		jobs    = installJobs()
+		sem     = make(chan struct{}, jobs)
+		done    = make(map[string]chan struct{})
+		wg      sync.WaitGroup
+		mutex   sync.Mutex
+		timings = make(map[string]time.Duration)
+		start   = time.Now()
+	)
+	for _, module := range modules {
+		done[module] = make(chan struct{})
+	}
+
+	utils.Log.Infof("starting to install modules (~%v5min) with %v parallel job(s)", func() string {
+		if !utils.QT_STUB() {
+			return "1"
+		}
+		return ""
+	}(), jobs)
+
+	//a module is installed once the modules it depends on are, independent modules are installed concurrently
+	for i, module := range modules {
+		wg.Add(1)
+		go func(module string, deps []string) {
+			defer wg.Done()
+			defer close(done[module])
+
+			for _, dep := range deps {
+				<-done[dep]
+			}
+
+			sem <- struct{}{}
+			defer func() { <-sem }()
+
+			utils.Log.Infof("installing%v qt/%v", func() string {
+				if utils.QT_STUB() {
+					return " stub"
 				}
+				return " full"
+			}(), strings.ToLower(module))
+
+			var now = time.Now()
+			utils.RunCmdOptional(installPkgCmd(buildTarget, tagFlags, fmt.Sprintf("github.com/therecipe/qt/%v", strings.ToLower(module)), env), fmt.Sprintf("install.%v", strings.ToLower(module)))
+			//also install armv7 modules
+			if buildTarget == "ios" {
+				var cmd = installPkgCmd(buildTarget, tagFlags, fmt.Sprintf("github.com/therecipe/qt/%v", strings.ToLower(module)), env)
+				cmd.Env = append(strings.Split(strings.Replace(strings.Replace(strings.Join(cmd.Env, "|"), "-arch arm64", "-arch armv7", -1), "arm64", "arm", -1), "|"), "GOARM=7")
+				utils.RunCmdOptional(cmd, fmt.Sprintf("install.%v", strings.ToLower(module)))
 			}
+
+			mutex.Lock()
+			timings[module] = time.Since(now)
+			mutex.Unlock()
+		}(module, installDeps(module, modules[:i]))
+	}
+	wg.Wait()
+
+	sort.Stable(byDuration{modules, timings})
+	for _, module := range modules {
+		utils.Log.Infof("installed qt/%v in %v", strings.ToLower(module), timings[module]/time.Second*time.Second)
+	}
+	utils.Log.Infof("installed %v modules in %v", len(modules), time.Since(start)/time.Second*time.Second)
+}
+
+//byDuration orders the installed modules by how long they took, slowest first
+type byDuration struct {
+	modules []string
+	timings map[string]time.Duration
+}
+
+func (s byDuration) Len() int           { return len(s.modules) }
+func (s byDuration) Swap(i, j int)      { s.modules[i], s.modules[j] = s.modules[j], s.modules[i] }
+func (s byDuration) Less(i, j int) bool { return s.timings[s.modules[i]] > s.timings[s.modules[j]] }
+
+//LibDeps also lists link time dependencies which can be cyclic (Core <-> Widgets),
+//so only the ones that come earlier in the install order are waited for
+func installDeps(module string, earlier []string) []string {
+	var deps = make([]string, 0)
+	for _, dep := range parser.LibDeps[module] {
+		for _, e := range earlier {
+			if dep == e {
+				deps = append(deps, dep)
+				break
+			}
+		}
+	}
+	return deps
+}
+
+//compiling the full cgo sources of the bigger modules can take up to ~2gb of ram each,
+//so the number of parallel jobs is bounded by the available memory as well as by the cpu count
+func installJobs() int {
+	if jobs, err := strconv.Atoi(os.Getenv("QT_INSTALL_JOBS")); err == nil && jobs > 0 {
+		return jobs
+	}
+
+	var jobs = runtime.NumCPU()
+	if utils.QT_STUB() {
+		return jobs
+	}
+
+	var mem = availableMemory()
+	if mem == 0 {
+		return 1
+	}
+	if byMem := int(mem / (2 << 30)); byMem < jobs {
+		jobs = byMem
+	}
+	if jobs < 1 {
+		jobs = 1
+	}
+	return jobs
+}
+
+func availableMemory() uint64 {
+	switch runtime.GOOS {
+	case "linux":
+		{
+			for _, l := range strings.Split(utils.LoadOptional("/proc/meminfo"), "\n") {
+				if f := strings.Fields(l); len(f) >= 2 && f[0] == "MemAvailable:" {
+					var kb, _ = strconv.ParseUint(f[1], 10, 64)
+					return kb << 10
+				}
+			}
+		}
+
+	case "darwin":
+		{
+			var out, _ = exec.Command("sysctl", "-n", "hw.memsize").Output()
+			var b, _ = strconv.ParseUint(strings.TrimSpace(string(out)), 10, 64)
+			return b
 		}
 	}
+	return 0
 }
 
 func installPkgCmd(buildTarget, tagFlags, pkg string, env map[string]string) *exec.Cmd {
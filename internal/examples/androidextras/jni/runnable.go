@@ -2,12 +2,19 @@ package main
 
 import "C"
 import (
+	"sync"
 	"unsafe"
 
-	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/androidextras"
 )
 
+//the qt signal table is keyed by c++ object pointers,
+//java objects are tracked by their string representation instead
+var (
+	runnables      = make(map[string]func())
+	runnablesMutex = new(sync.Mutex)
+)
+
 type Runnable struct {
 	ptr *androidextras.QAndroidJniObject
 }
@@ -27,21 +34,28 @@ func (p *Runnable) SetPointer(ptr *androidextras.QAndroidJniObject) {
 func (ptr *Runnable) ConnectRun(f func()) {
 	if ptr.Pointer() != nil && ptr.Pointer().IsValid() {
 
-		qt.ConnectSignal(ptr.Pointer().ToString(), "Runnable::run", f)
+		runnablesMutex.Lock()
+		runnables[ptr.Pointer().ToString()] = f
+		runnablesMutex.Unlock()
 	}
 }
 
 func (ptr *Runnable) DisconnectRun() {
 	if ptr.Pointer() != nil && ptr.Pointer().IsValid() {
 
-		qt.DisconnectSignal(ptr.Pointer().ToString(), "Runnable::run")
+		runnablesMutex.Lock()
+		delete(runnables, ptr.Pointer().ToString())
+		runnablesMutex.Unlock()
 	}
 }
 
 //export Java_qt_java_lang_Runnable_qtrun
 func Java_qt_java_lang_Runnable_qtrun(_, _, this unsafe.Pointer) {
-	if signal := qt.GetSignal(androidextras.NewQAndroidJniObject6(this).ToString(), "Runnable::run"); signal != nil {
-		signal.(func())()
+	runnablesMutex.Lock()
+	var signal = runnables[androidextras.NewQAndroidJniObject6(this).ToString()]
+	runnablesMutex.Unlock()
+	if signal != nil {
+		signal()
 	}
 
 }
@@ -37,6 +37,10 @@ func QT_DEBUG() bool {
 	return strings.ToLower(os.Getenv("QT_DEBUG")) == "true"
 }
 
+func QT_INSTRUMENT() bool {
+	return strings.ToLower(os.Getenv("QT_INSTRUMENT")) == "true"
+}
+
 func CheckBuildTarget(buildTarget string) {
 	switch buildTarget {
 	case "desktop", "android", "ios", "ios-simulator",
@@ -31,6 +31,41 @@
 #include <QTimer>
 #include <QTimerEvent>
 #include <QVariant>
+#include <QScopedPointer>
+#include <QStringList>
+#include <cstdlib>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
 
 void* QGeoManeuver_NewQGeoManeuver()
 {
@@ -1538,7 +1573,7 @@ void* QGeoServiceProvider_NewQGeoServiceProvider(char* providerName, void* param
 
 struct QtLocation_PackedString QGeoServiceProvider_QGeoServiceProvider_AvailableServiceProviders()
 {
-	return ({ QByteArray teec3ca = QGeoServiceProvider::availableServiceProviders().join("|").toUtf8(); QtLocation_PackedString { const_cast<char*>(teec3ca.prepend("WHITESPACE").constData()+10), teec3ca.size()-10 }; });
+	return ({ long long teec3calen; char* teec3ca = goPackStringList(QGeoServiceProvider::availableServiceProviders(), &teec3calen); QtLocation_PackedString { teec3ca, teec3calen }; });
 }
 
 void QGeoServiceProvider_SetAllowExperimental(void* ptr, char allow)
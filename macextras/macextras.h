@@ -13,7 +13,7 @@ extern "C" {
 
 struct QtMacExtras_PackedString { char* data; long long len; };
 struct QtMacExtras_PackedList { void* data; long long len; };
-struct QtMacExtras_PackedList QMacPasteboardMime_ConvertFromMime(void* ptr, char* mime, void* data, char* flav);
+struct QtMacExtras_PackedString QMacPasteboardMime_ConvertFromMime(void* ptr, char* mime, void* data, char* flav);
 void* QMacPasteboardMime_NewQMacPasteboardMime(char* t);
 struct QtMacExtras_PackedString QMacPasteboardMime_ConvertorName(void* ptr);
 struct QtMacExtras_PackedString QMacPasteboardMime_FlavorFor(void* ptr, char* mime);
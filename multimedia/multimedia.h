@@ -259,12 +259,18 @@ void* QAudioDeviceInfo___supportedSampleTypes_newList(void* ptr);
 int QAudioDeviceInfo___supportedChannelCounts_atList(void* ptr, int i);
 void QAudioDeviceInfo___supportedChannelCounts_setList(void* ptr, int i);
 void* QAudioDeviceInfo___supportedChannelCounts_newList(void* ptr);
+void* QAudioDeviceInfo___supportedChannelCounts_newListBuffer(void* ptr, void* data, int count);
+void QAudioDeviceInfo___supportedChannelCounts_fillList(void* ptr, void* data);
 int QAudioDeviceInfo___supportedSampleRates_atList(void* ptr, int i);
 void QAudioDeviceInfo___supportedSampleRates_setList(void* ptr, int i);
 void* QAudioDeviceInfo___supportedSampleRates_newList(void* ptr);
+void* QAudioDeviceInfo___supportedSampleRates_newListBuffer(void* ptr, void* data, int count);
+void QAudioDeviceInfo___supportedSampleRates_fillList(void* ptr, void* data);
 int QAudioDeviceInfo___supportedSampleSizes_atList(void* ptr, int i);
 void QAudioDeviceInfo___supportedSampleSizes_setList(void* ptr, int i);
 void* QAudioDeviceInfo___supportedSampleSizes_newList(void* ptr);
+void* QAudioDeviceInfo___supportedSampleSizes_newListBuffer(void* ptr, void* data, int count);
+void QAudioDeviceInfo___supportedSampleSizes_fillList(void* ptr, void* data);
 void* QAudioEncoderSettings_NewQAudioEncoderSettings();
 void* QAudioEncoderSettings_NewQAudioEncoderSettings2(void* other);
 void QAudioEncoderSettings_SetBitRate(void* ptr, int rate);
@@ -310,6 +316,8 @@ struct QtMultimedia_PackedString QAudioEncoderSettingsControl_SupportedAudioCode
 int QAudioEncoderSettingsControl___supportedSampleRates_atList(void* ptr, int i);
 void QAudioEncoderSettingsControl___supportedSampleRates_setList(void* ptr, int i);
 void* QAudioEncoderSettingsControl___supportedSampleRates_newList(void* ptr);
+void* QAudioEncoderSettingsControl___supportedSampleRates_newListBuffer(void* ptr, void* data, int count);
+void QAudioEncoderSettingsControl___supportedSampleRates_fillList(void* ptr, void* data);
 void* QAudioFormat_NewQAudioFormat();
 void* QAudioFormat_NewQAudioFormat2(void* other);
 void QAudioFormat_SetByteOrder(void* ptr, long long byteOrder);
@@ -601,6 +609,8 @@ void* QCamera___supportedViewfinderSettings_newList(void* ptr);
 void* QCamera___supportedViewfinderResolutions_atList(void* ptr, int i);
 void QCamera___supportedViewfinderResolutions_setList(void* ptr, void* i);
 void* QCamera___supportedViewfinderResolutions_newList(void* ptr);
+void* QCamera___supportedViewfinderResolutions_newListBuffer(void* ptr, void* data, int count);
+void QCamera___supportedViewfinderResolutions_fillList(void* ptr, void* data);
 long long QCamera___supportedViewfinderPixelFormats_atList(void* ptr, int i);
 void QCamera___supportedViewfinderPixelFormats_setList(void* ptr, long long i);
 void* QCamera___supportedViewfinderPixelFormats_newList(void* ptr);
@@ -708,12 +718,18 @@ double QCameraExposure_ShutterSpeed(void* ptr);
 int QCameraExposure___supportedIsoSensitivities_atList(void* ptr, int i);
 void QCameraExposure___supportedIsoSensitivities_setList(void* ptr, int i);
 void* QCameraExposure___supportedIsoSensitivities_newList(void* ptr);
+void* QCameraExposure___supportedIsoSensitivities_newListBuffer(void* ptr, void* data, int count);
+void QCameraExposure___supportedIsoSensitivities_fillList(void* ptr, void* data);
 double QCameraExposure___supportedApertures_atList(void* ptr, int i);
 void QCameraExposure___supportedApertures_setList(void* ptr, double i);
 void* QCameraExposure___supportedApertures_newList(void* ptr);
+void* QCameraExposure___supportedApertures_newListBuffer(void* ptr, void* data, int count);
+void QCameraExposure___supportedApertures_fillList(void* ptr, void* data);
 double QCameraExposure___supportedShutterSpeeds_atList(void* ptr, int i);
 void QCameraExposure___supportedShutterSpeeds_setList(void* ptr, double i);
 void* QCameraExposure___supportedShutterSpeeds_newList(void* ptr);
+void* QCameraExposure___supportedShutterSpeeds_newListBuffer(void* ptr, void* data, int count);
+void QCameraExposure___supportedShutterSpeeds_fillList(void* ptr, void* data);
 void* QCameraExposure___dynamicPropertyNames_atList(void* ptr, int i);
 void QCameraExposure___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QCameraExposure___dynamicPropertyNames_newList(void* ptr);
@@ -908,6 +924,8 @@ char QCameraImageCapture_IsReadyForCapture(void* ptr);
 void* QCameraImageCapture___supportedResolutions_atList(void* ptr, int i);
 void QCameraImageCapture___supportedResolutions_setList(void* ptr, void* i);
 void* QCameraImageCapture___supportedResolutions_newList(void* ptr);
+void* QCameraImageCapture___supportedResolutions_newListBuffer(void* ptr, void* data, int count);
+void QCameraImageCapture___supportedResolutions_fillList(void* ptr, void* data);
 long long QCameraImageCapture___supportedBufferFormats_atList(void* ptr, int i);
 void QCameraImageCapture___supportedBufferFormats_setList(void* ptr, long long i);
 void* QCameraImageCapture___supportedBufferFormats_newList(void* ptr);
@@ -1249,6 +1267,8 @@ struct QtMultimedia_PackedString QImageEncoderControl_SupportedImageCodecs(void*
 void* QImageEncoderControl___supportedResolutions_atList(void* ptr, int i);
 void QImageEncoderControl___supportedResolutions_setList(void* ptr, void* i);
 void* QImageEncoderControl___supportedResolutions_newList(void* ptr);
+void* QImageEncoderControl___supportedResolutions_newListBuffer(void* ptr, void* data, int count);
+void QImageEncoderControl___supportedResolutions_fillList(void* ptr, void* data);
 void* QImageEncoderSettings_NewQImageEncoderSettings();
 void* QImageEncoderSettings_NewQImageEncoderSettings2(void* other);
 void QImageEncoderSettings_SetCodec(void* ptr, char* codec);
@@ -1803,12 +1823,18 @@ double QMediaRecorder_Volume(void* ptr);
 void* QMediaRecorder___supportedResolutions_atList(void* ptr, int i);
 void QMediaRecorder___supportedResolutions_setList(void* ptr, void* i);
 void* QMediaRecorder___supportedResolutions_newList(void* ptr);
+void* QMediaRecorder___supportedResolutions_newListBuffer(void* ptr, void* data, int count);
+void QMediaRecorder___supportedResolutions_fillList(void* ptr, void* data);
 int QMediaRecorder___supportedAudioSampleRates_atList(void* ptr, int i);
 void QMediaRecorder___supportedAudioSampleRates_setList(void* ptr, int i);
 void* QMediaRecorder___supportedAudioSampleRates_newList(void* ptr);
+void* QMediaRecorder___supportedAudioSampleRates_newListBuffer(void* ptr, void* data, int count);
+void QMediaRecorder___supportedAudioSampleRates_fillList(void* ptr, void* data);
 double QMediaRecorder___supportedFrameRates_atList(void* ptr, int i);
 void QMediaRecorder___supportedFrameRates_setList(void* ptr, double i);
 void* QMediaRecorder___supportedFrameRates_newList(void* ptr);
+void* QMediaRecorder___supportedFrameRates_newListBuffer(void* ptr, void* data, int count);
+void QMediaRecorder___supportedFrameRates_fillList(void* ptr, void* data);
 void* QMediaRecorder___dynamicPropertyNames_atList(void* ptr, int i);
 void QMediaRecorder___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QMediaRecorder___dynamicPropertyNames_newList(void* ptr);
@@ -1974,7 +2000,7 @@ void* QMediaServiceProviderPlugin_MetaObjectDefault(void* ptr);
 struct QtMultimedia_PackedString QMediaServiceSupportedDevicesInterface_DeviceDescription(void* ptr, void* service, void* device);
 void QMediaServiceSupportedDevicesInterface_DestroyQMediaServiceSupportedDevicesInterface(void* ptr);
 void QMediaServiceSupportedDevicesInterface_DestroyQMediaServiceSupportedDevicesInterfaceDefault(void* ptr);
-struct QtMultimedia_PackedList QMediaServiceSupportedDevicesInterface_Devices(void* ptr, void* service);
+struct QtMultimedia_PackedString QMediaServiceSupportedDevicesInterface_Devices(void* ptr, void* service);
 void* QMediaServiceSupportedDevicesInterface___devices_atList(void* ptr, int i);
 void QMediaServiceSupportedDevicesInterface___devices_setList(void* ptr, void* i);
 void* QMediaServiceSupportedDevicesInterface___devices_newList(void* ptr);
@@ -2475,9 +2501,13 @@ void* QVideoEncoderSettingsControl_VideoSettings(void* ptr);
 void* QVideoEncoderSettingsControl___supportedResolutions_atList(void* ptr, int i);
 void QVideoEncoderSettingsControl___supportedResolutions_setList(void* ptr, void* i);
 void* QVideoEncoderSettingsControl___supportedResolutions_newList(void* ptr);
+void* QVideoEncoderSettingsControl___supportedResolutions_newListBuffer(void* ptr, void* data, int count);
+void QVideoEncoderSettingsControl___supportedResolutions_fillList(void* ptr, void* data);
 double QVideoEncoderSettingsControl___supportedFrameRates_atList(void* ptr, int i);
 void QVideoEncoderSettingsControl___supportedFrameRates_setList(void* ptr, double i);
 void* QVideoEncoderSettingsControl___supportedFrameRates_newList(void* ptr);
+void* QVideoEncoderSettingsControl___supportedFrameRates_newListBuffer(void* ptr, void* data, int count);
+void QVideoEncoderSettingsControl___supportedFrameRates_fillList(void* ptr, void* data);
 void* QVideoFilterRunnable_Run(void* ptr, void* input, void* surfaceFormat, long long flags);
 long long QVideoFrame_QVideoFrame_PixelFormatFromImageFormat(long long format);
 long long QVideoFrame_QVideoFrame_ImageFormatFromPixelFormat(long long format);
@@ -2578,7 +2608,7 @@ void QVideoSurfaceFormat_SetYCbCrColorSpace(void* ptr, long long space);
 void QVideoSurfaceFormat_DestroyQVideoSurfaceFormat(void* ptr);
 long long QVideoSurfaceFormat_ScanLineDirection(void* ptr);
 long long QVideoSurfaceFormat_HandleType(void* ptr);
-struct QtMultimedia_PackedList QVideoSurfaceFormat_PropertyNames(void* ptr);
+struct QtMultimedia_PackedString QVideoSurfaceFormat_PropertyNames(void* ptr);
 void* QVideoSurfaceFormat_Viewport(void* ptr);
 void* QVideoSurfaceFormat_FrameSize(void* ptr);
 void* QVideoSurfaceFormat_PixelAspectRatio(void* ptr);
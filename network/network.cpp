@@ -72,6 +72,75 @@
 #include <QUrl>
 #include <QVariant>
 #include <QVector>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 class MyQAbstractNetworkCache: public QAbstractNetworkCache
 {
@@ -1872,9 +1941,9 @@ void QDnsTextRecord_DestroyQDnsTextRecord(void* ptr)
 	static_cast<QDnsTextRecord*>(ptr)->~QDnsTextRecord();
 }
 
-struct QtNetwork_PackedList QDnsTextRecord_Values(void* ptr)
+struct QtNetwork_PackedString QDnsTextRecord_Values(void* ptr)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(static_cast<QDnsTextRecord*>(ptr)->values()); QtNetwork_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long tade13flen; char* tade13f = goPackStringList(static_cast<QDnsTextRecord*>(ptr)->values(), &tade13flen); QtNetwork_PackedString { tade13f, tade13flen }; });
 }
 
 struct QtNetwork_PackedString QDnsTextRecord_Name(void* ptr)
@@ -3036,7 +3105,7 @@ public:
 	void Signal_PreSharedKeyAuthenticationRequired(QNetworkReply * reply, QSslPreSharedKeyAuthenticator * authenticator) { callbackQNetworkAccessManager_PreSharedKeyAuthenticationRequired(this, reply, authenticator); };
 	void Signal_ProxyAuthenticationRequired(const QNetworkProxy & proxy, QAuthenticator * authenticator) { callbackQNetworkAccessManager_ProxyAuthenticationRequired(this, const_cast<QNetworkProxy*>(&proxy), authenticator); };
 	void Signal_SslErrors(QNetworkReply * reply, const QList<QSslError> & errors) { callbackQNetworkAccessManager_SslErrors(this, reply, ({ QList<QSslError>* tmpValue = const_cast<QList<QSslError>*>(&errors); QtNetwork_PackedList { tmpValue, tmpValue->size() }; })); };
-	QStringList supportedSchemesImplementation() const { return QString(callbackQNetworkAccessManager_SupportedSchemesImplementation(const_cast<void*>(static_cast<const void*>(this)))).split("|", QString::SkipEmptyParts); };
+	QStringList supportedSchemesImplementation() const { char* tmp = callbackQNetworkAccessManager_SupportedSchemesImplementation(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
 	bool event(QEvent * e) { return callbackQNetworkAccessManager_Event(this, e) != 0; };
 	bool eventFilter(QObject * watched, QEvent * event) { return callbackQNetworkAccessManager_EventFilter(this, watched, event) != 0; };
 	void childEvent(QChildEvent * event) { callbackQNetworkAccessManager_ChildEvent(this, event); };
@@ -3317,19 +3386,19 @@ void* QNetworkAccessManager_ProxyFactory(void* ptr)
 
 struct QtNetwork_PackedString QNetworkAccessManager_SupportedSchemes(void* ptr)
 {
-	return ({ QByteArray tda9ca8 = static_cast<QNetworkAccessManager*>(ptr)->supportedSchemes().join("|").toUtf8(); QtNetwork_PackedString { const_cast<char*>(tda9ca8.prepend("WHITESPACE").constData()+10), tda9ca8.size()-10 }; });
+	return ({ long long tda9ca8len; char* tda9ca8 = goPackStringList(static_cast<QNetworkAccessManager*>(ptr)->supportedSchemes(), &tda9ca8len); QtNetwork_PackedString { tda9ca8, tda9ca8len }; });
 }
 
 struct QtNetwork_PackedString QNetworkAccessManager_SupportedSchemesImplementation(void* ptr)
 {
 	QStringList returnArg;
 	QMetaObject::invokeMethod(static_cast<QNetworkAccessManager*>(ptr), "supportedSchemesImplementation", Q_RETURN_ARG(QStringList, returnArg));
-	return ({ QByteArray t8e5b69 = returnArg.join("|").toUtf8(); QtNetwork_PackedString { const_cast<char*>(t8e5b69.prepend("WHITESPACE").constData()+10), t8e5b69.size()-10 }; });
+	return ({ long long t8e5b69len; char* t8e5b69 = goPackStringList(returnArg, &t8e5b69len); QtNetwork_PackedString { t8e5b69, t8e5b69len }; });
 }
 
 struct QtNetwork_PackedString QNetworkAccessManager_SupportedSchemesImplementationDefault(void* ptr)
 {
-		return ({ QByteArray t5e649f = static_cast<QNetworkAccessManager*>(ptr)->QNetworkAccessManager::supportedSchemesImplementation().join("|").toUtf8(); QtNetwork_PackedString { const_cast<char*>(t5e649f.prepend("WHITESPACE").constData()+10), t5e649f.size()-10 }; });
+		return ({ long long t5e649flen; char* t5e649f = goPackStringList(static_cast<QNetworkAccessManager*>(ptr)->QNetworkAccessManager::supportedSchemesImplementation(), &t5e649flen); QtNetwork_PackedString { t5e649f, t5e649flen }; });
 }
 
 void* QNetworkAccessManager___sslErrors_errors_atList(void* ptr, int i)
@@ -4861,9 +4930,9 @@ void* QNetworkProxy_RawHeader(void* ptr, void* headerName)
 	return new QByteArray(static_cast<QNetworkProxy*>(ptr)->rawHeader(*static_cast<QByteArray*>(headerName)));
 }
 
-struct QtNetwork_PackedList QNetworkProxy_RawHeaderList(void* ptr)
+struct QtNetwork_PackedString QNetworkProxy_RawHeaderList(void* ptr)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(static_cast<QNetworkProxy*>(ptr)->rawHeaderList()); QtNetwork_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long t021e9dlen; char* t021e9d = goPackStringList(static_cast<QNetworkProxy*>(ptr)->rawHeaderList(), &t021e9dlen); QtNetwork_PackedString { t021e9d, t021e9dlen }; });
 }
 
 long long QNetworkProxy_Type(void* ptr)
@@ -5453,9 +5522,9 @@ void* QNetworkReply_RawHeader(void* ptr, void* headerName)
 	return new QByteArray(static_cast<QNetworkReply*>(ptr)->rawHeader(*static_cast<QByteArray*>(headerName)));
 }
 
-struct QtNetwork_PackedList QNetworkReply_RawHeaderList(void* ptr)
+struct QtNetwork_PackedString QNetworkReply_RawHeaderList(void* ptr)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(static_cast<QNetworkReply*>(ptr)->rawHeaderList()); QtNetwork_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long t25fd91len; char* t25fd91 = goPackStringList(static_cast<QNetworkReply*>(ptr)->rawHeaderList(), &t25fd91len); QtNetwork_PackedString { t25fd91, t25fd91len }; });
 }
 
 void* QNetworkReply_Manager(void* ptr)
@@ -5858,9 +5927,9 @@ void* QNetworkRequest_RawHeader(void* ptr, void* headerName)
 	return new QByteArray(static_cast<QNetworkRequest*>(ptr)->rawHeader(*static_cast<QByteArray*>(headerName)));
 }
 
-struct QtNetwork_PackedList QNetworkRequest_RawHeaderList(void* ptr)
+struct QtNetwork_PackedString QNetworkRequest_RawHeaderList(void* ptr)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(static_cast<QNetworkRequest*>(ptr)->rawHeaderList()); QtNetwork_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long t903df8len; char* t903df8 = goPackStringList(static_cast<QNetworkRequest*>(ptr)->rawHeaderList(), &t903df8len); QtNetwork_PackedString { t903df8, t903df8len }; });
 }
 
 void* QNetworkRequest_OriginatingObject(void* ptr)
@@ -6450,14 +6519,14 @@ void* QSslCertificate_ExpiryDate(void* ptr)
 	return new QDateTime(static_cast<QSslCertificate*>(ptr)->expiryDate());
 }
 
-struct QtNetwork_PackedList QSslCertificate_IssuerInfoAttributes(void* ptr)
+struct QtNetwork_PackedString QSslCertificate_IssuerInfoAttributes(void* ptr)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(static_cast<QSslCertificate*>(ptr)->issuerInfoAttributes()); QtNetwork_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long t552db1len; char* t552db1 = goPackStringList(static_cast<QSslCertificate*>(ptr)->issuerInfoAttributes(), &t552db1len); QtNetwork_PackedString { t552db1, t552db1len }; });
 }
 
-struct QtNetwork_PackedList QSslCertificate_SubjectInfoAttributes(void* ptr)
+struct QtNetwork_PackedString QSslCertificate_SubjectInfoAttributes(void* ptr)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(static_cast<QSslCertificate*>(ptr)->subjectInfoAttributes()); QtNetwork_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long t0a6cf3len; char* t0a6cf3 = goPackStringList(static_cast<QSslCertificate*>(ptr)->subjectInfoAttributes(), &t0a6cf3len); QtNetwork_PackedString { t0a6cf3, t0a6cf3len }; });
 }
 
 struct QtNetwork_PackedList QSslCertificate_Extensions(void* ptr)
@@ -6482,22 +6551,22 @@ struct QtNetwork_PackedString QSslCertificate_ToText(void* ptr)
 
 struct QtNetwork_PackedString QSslCertificate_IssuerInfo(void* ptr, long long subject)
 {
-	return ({ QByteArray t768c47 = static_cast<QSslCertificate*>(ptr)->issuerInfo(static_cast<QSslCertificate::SubjectInfo>(subject)).join("|").toUtf8(); QtNetwork_PackedString { const_cast<char*>(t768c47.prepend("WHITESPACE").constData()+10), t768c47.size()-10 }; });
+	return ({ long long t768c47len; char* t768c47 = goPackStringList(static_cast<QSslCertificate*>(ptr)->issuerInfo(static_cast<QSslCertificate::SubjectInfo>(subject)), &t768c47len); QtNetwork_PackedString { t768c47, t768c47len }; });
 }
 
 struct QtNetwork_PackedString QSslCertificate_IssuerInfo2(void* ptr, void* attribute)
 {
-	return ({ QByteArray tc820f1 = static_cast<QSslCertificate*>(ptr)->issuerInfo(*static_cast<QByteArray*>(attribute)).join("|").toUtf8(); QtNetwork_PackedString { const_cast<char*>(tc820f1.prepend("WHITESPACE").constData()+10), tc820f1.size()-10 }; });
+	return ({ long long tc820f1len; char* tc820f1 = goPackStringList(static_cast<QSslCertificate*>(ptr)->issuerInfo(*static_cast<QByteArray*>(attribute)), &tc820f1len); QtNetwork_PackedString { tc820f1, tc820f1len }; });
 }
 
 struct QtNetwork_PackedString QSslCertificate_SubjectInfo(void* ptr, long long subject)
 {
-	return ({ QByteArray tee2197 = static_cast<QSslCertificate*>(ptr)->subjectInfo(static_cast<QSslCertificate::SubjectInfo>(subject)).join("|").toUtf8(); QtNetwork_PackedString { const_cast<char*>(tee2197.prepend("WHITESPACE").constData()+10), tee2197.size()-10 }; });
+	return ({ long long tee2197len; char* tee2197 = goPackStringList(static_cast<QSslCertificate*>(ptr)->subjectInfo(static_cast<QSslCertificate::SubjectInfo>(subject)), &tee2197len); QtNetwork_PackedString { tee2197, tee2197len }; });
 }
 
 struct QtNetwork_PackedString QSslCertificate_SubjectInfo2(void* ptr, void* attribute)
 {
-	return ({ QByteArray tc13a73 = static_cast<QSslCertificate*>(ptr)->subjectInfo(*static_cast<QByteArray*>(attribute)).join("|").toUtf8(); QtNetwork_PackedString { const_cast<char*>(tc13a73.prepend("WHITESPACE").constData()+10), tc13a73.size()-10 }; });
+	return ({ long long tc13a73len; char* tc13a73 = goPackStringList(static_cast<QSslCertificate*>(ptr)->subjectInfo(*static_cast<QByteArray*>(attribute)), &tc13a73len); QtNetwork_PackedString { tc13a73, tc13a73len }; });
 }
 
 char QSslCertificate_IsBlacklisted(void* ptr)
@@ -6935,9 +7004,9 @@ void* QSslConfiguration_SessionTicket(void* ptr)
 	return new QByteArray(static_cast<QSslConfiguration*>(ptr)->sessionTicket());
 }
 
-struct QtNetwork_PackedList QSslConfiguration_AllowedNextProtocols(void* ptr)
+struct QtNetwork_PackedString QSslConfiguration_AllowedNextProtocols(void* ptr)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(static_cast<QSslConfiguration*>(ptr)->allowedNextProtocols()); QtNetwork_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long tb0056elen; char* tb0056e = goPackStringList(static_cast<QSslConfiguration*>(ptr)->allowedNextProtocols(), &tb0056elen); QtNetwork_PackedString { tb0056e, tb0056elen }; });
 }
 
 struct QtNetwork_PackedList QSslConfiguration_CaCertificates(void* ptr)
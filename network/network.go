@@ -8,7 +8,6 @@ package network
 //#include "network.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
@@ -22,6 +21,43 @@ func cGoUnpackString(s C.struct_QtNetwork_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtNetwork_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtNetwork_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type Http2 struct {
 	ptr unsafe.Pointer
@@ -108,7 +144,7 @@ func NewQAbstractNetworkCacheFromPointer(ptr unsafe.Pointer) *QAbstractNetworkCa
 }
 func NewQAbstractNetworkCache(parent core.QObject_ITF) *QAbstractNetworkCache {
 	var tmpValue = NewQAbstractNetworkCacheFromPointer(C.QAbstractNetworkCache_NewQAbstractNetworkCache(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -116,7 +152,7 @@ func NewQAbstractNetworkCache(parent core.QObject_ITF) *QAbstractNetworkCache {
 
 //export callbackQAbstractNetworkCache_Data
 func callbackQAbstractNetworkCache_Data(ptr unsafe.Pointer, url unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
 		return core.PointerFromQIODevice(signal.(func(*core.QUrl) *core.QIODevice)(core.NewQUrlFromPointer(url)))
 	}
 
@@ -126,21 +162,21 @@ func callbackQAbstractNetworkCache_Data(ptr unsafe.Pointer, url unsafe.Pointer)
 func (ptr *QAbstractNetworkCache) ConnectData(f func(url *core.QUrl) *core.QIODevice) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
 func (ptr *QAbstractNetworkCache) Data(url core.QUrl_ITF) *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QAbstractNetworkCache_Data(ptr.Pointer(), core.PointerFromQUrl(url)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -150,7 +186,7 @@ func (ptr *QAbstractNetworkCache) Data(url core.QUrl_ITF) *core.QIODevice {
 
 //export callbackQAbstractNetworkCache_Prepare
 func callbackQAbstractNetworkCache_Prepare(ptr unsafe.Pointer, metaData unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "prepare"); signal != nil {
+	if signal := qt.GetSignal(ptr, "prepare"); signal != nil {
 		return core.PointerFromQIODevice(signal.(func(*QNetworkCacheMetaData) *core.QIODevice)(NewQNetworkCacheMetaDataFromPointer(metaData)))
 	}
 
@@ -160,21 +196,21 @@ func callbackQAbstractNetworkCache_Prepare(ptr unsafe.Pointer, metaData unsafe.P
 func (ptr *QAbstractNetworkCache) ConnectPrepare(f func(metaData *QNetworkCacheMetaData) *core.QIODevice) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "prepare", f)
+		qt.ConnectSignal(ptr.Pointer(), "prepare", f)
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DisconnectPrepare() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "prepare")
+		qt.DisconnectSignal(ptr.Pointer(), "prepare")
 	}
 }
 
 func (ptr *QAbstractNetworkCache) Prepare(metaData QNetworkCacheMetaData_ITF) *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QAbstractNetworkCache_Prepare(ptr.Pointer(), PointerFromQNetworkCacheMetaData(metaData)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -184,7 +220,7 @@ func (ptr *QAbstractNetworkCache) Prepare(metaData QNetworkCacheMetaData_ITF) *c
 
 //export callbackQAbstractNetworkCache_MetaData
 func callbackQAbstractNetworkCache_MetaData(ptr unsafe.Pointer, url unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaData"); signal != nil {
 		return PointerFromQNetworkCacheMetaData(signal.(func(*core.QUrl) *QNetworkCacheMetaData)(core.NewQUrlFromPointer(url)))
 	}
 
@@ -194,14 +230,14 @@ func callbackQAbstractNetworkCache_MetaData(ptr unsafe.Pointer, url unsafe.Point
 func (ptr *QAbstractNetworkCache) ConnectMetaData(f func(url *core.QUrl) *QNetworkCacheMetaData) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "metaData", f)
+		qt.ConnectSignal(ptr.Pointer(), "metaData", f)
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DisconnectMetaData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "metaData")
+		qt.DisconnectSignal(ptr.Pointer(), "metaData")
 	}
 }
 
@@ -216,7 +252,7 @@ func (ptr *QAbstractNetworkCache) MetaData(url core.QUrl_ITF) *QNetworkCacheMeta
 
 //export callbackQAbstractNetworkCache_Remove
 func callbackQAbstractNetworkCache_Remove(ptr unsafe.Pointer, url unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "remove"); signal != nil {
+	if signal := qt.GetSignal(ptr, "remove"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QUrl) bool)(core.NewQUrlFromPointer(url)))))
 	}
 
@@ -226,14 +262,14 @@ func callbackQAbstractNetworkCache_Remove(ptr unsafe.Pointer, url unsafe.Pointer
 func (ptr *QAbstractNetworkCache) ConnectRemove(f func(url *core.QUrl) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "remove", f)
+		qt.ConnectSignal(ptr.Pointer(), "remove", f)
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DisconnectRemove() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "remove")
+		qt.DisconnectSignal(ptr.Pointer(), "remove")
 	}
 }
 
@@ -246,7 +282,7 @@ func (ptr *QAbstractNetworkCache) Remove(url core.QUrl_ITF) bool {
 
 //export callbackQAbstractNetworkCache_Clear
 func callbackQAbstractNetworkCache_Clear(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clear"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clear"); signal != nil {
 		signal.(func())()
 	}
 
@@ -255,14 +291,14 @@ func callbackQAbstractNetworkCache_Clear(ptr unsafe.Pointer) {
 func (ptr *QAbstractNetworkCache) ConnectClear(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clear", f)
+		qt.ConnectSignal(ptr.Pointer(), "clear", f)
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DisconnectClear() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clear")
+		qt.DisconnectSignal(ptr.Pointer(), "clear")
 	}
 }
 
@@ -274,7 +310,7 @@ func (ptr *QAbstractNetworkCache) Clear() {
 
 //export callbackQAbstractNetworkCache_Insert
 func callbackQAbstractNetworkCache_Insert(ptr unsafe.Pointer, device unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insert"); signal != nil {
 		signal.(func(*core.QIODevice))(core.NewQIODeviceFromPointer(device))
 	}
 
@@ -283,14 +319,14 @@ func callbackQAbstractNetworkCache_Insert(ptr unsafe.Pointer, device unsafe.Poin
 func (ptr *QAbstractNetworkCache) ConnectInsert(f func(device *core.QIODevice)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "insert", f)
+		qt.ConnectSignal(ptr.Pointer(), "insert", f)
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DisconnectInsert() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "insert")
+		qt.DisconnectSignal(ptr.Pointer(), "insert")
 	}
 }
 
@@ -302,7 +338,7 @@ func (ptr *QAbstractNetworkCache) Insert(device core.QIODevice_ITF) {
 
 //export callbackQAbstractNetworkCache_UpdateMetaData
 func callbackQAbstractNetworkCache_UpdateMetaData(ptr unsafe.Pointer, metaData unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMetaData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMetaData"); signal != nil {
 		signal.(func(*QNetworkCacheMetaData))(NewQNetworkCacheMetaDataFromPointer(metaData))
 	}
 
@@ -311,14 +347,14 @@ func callbackQAbstractNetworkCache_UpdateMetaData(ptr unsafe.Pointer, metaData u
 func (ptr *QAbstractNetworkCache) ConnectUpdateMetaData(f func(metaData *QNetworkCacheMetaData)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateMetaData", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateMetaData", f)
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DisconnectUpdateMetaData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateMetaData")
+		qt.DisconnectSignal(ptr.Pointer(), "updateMetaData")
 	}
 }
 
@@ -330,7 +366,7 @@ func (ptr *QAbstractNetworkCache) UpdateMetaData(metaData QNetworkCacheMetaData_
 
 //export callbackQAbstractNetworkCache_DestroyQAbstractNetworkCache
 func callbackQAbstractNetworkCache_DestroyQAbstractNetworkCache(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractNetworkCache"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractNetworkCache"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractNetworkCacheFromPointer(ptr).DestroyQAbstractNetworkCacheDefault()
@@ -340,21 +376,21 @@ func callbackQAbstractNetworkCache_DestroyQAbstractNetworkCache(ptr unsafe.Point
 func (ptr *QAbstractNetworkCache) ConnectDestroyQAbstractNetworkCache(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractNetworkCache", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractNetworkCache", f)
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DisconnectDestroyQAbstractNetworkCache() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractNetworkCache")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractNetworkCache")
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DestroyQAbstractNetworkCache() {
 	if ptr.Pointer() != nil {
 		C.QAbstractNetworkCache_DestroyQAbstractNetworkCache(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -362,14 +398,14 @@ func (ptr *QAbstractNetworkCache) DestroyQAbstractNetworkCache() {
 func (ptr *QAbstractNetworkCache) DestroyQAbstractNetworkCacheDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractNetworkCache_DestroyQAbstractNetworkCacheDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractNetworkCache_CacheSize
 func callbackQAbstractNetworkCache_CacheSize(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cacheSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cacheSize"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -379,14 +415,14 @@ func callbackQAbstractNetworkCache_CacheSize(ptr unsafe.Pointer) C.longlong {
 func (ptr *QAbstractNetworkCache) ConnectCacheSize(f func() int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cacheSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "cacheSize", f)
 	}
 }
 
 func (ptr *QAbstractNetworkCache) DisconnectCacheSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cacheSize")
+		qt.DisconnectSignal(ptr.Pointer(), "cacheSize")
 	}
 }
 
@@ -419,7 +455,7 @@ func (ptr *QAbstractNetworkCache) __dynamicPropertyNames_newList() unsafe.Pointe
 func (ptr *QAbstractNetworkCache) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractNetworkCache___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -440,7 +476,7 @@ func (ptr *QAbstractNetworkCache) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QAbstractNetworkCache) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractNetworkCache___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -461,7 +497,7 @@ func (ptr *QAbstractNetworkCache) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QAbstractNetworkCache) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractNetworkCache___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -482,7 +518,7 @@ func (ptr *QAbstractNetworkCache) __findChildren_newList() unsafe.Pointer {
 func (ptr *QAbstractNetworkCache) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractNetworkCache___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -502,7 +538,7 @@ func (ptr *QAbstractNetworkCache) __children_newList() unsafe.Pointer {
 
 //export callbackQAbstractNetworkCache_Event
 func callbackQAbstractNetworkCache_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -518,7 +554,7 @@ func (ptr *QAbstractNetworkCache) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQAbstractNetworkCache_EventFilter
 func callbackQAbstractNetworkCache_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -534,7 +570,7 @@ func (ptr *QAbstractNetworkCache) EventFilterDefault(watched core.QObject_ITF, e
 
 //export callbackQAbstractNetworkCache_ChildEvent
 func callbackQAbstractNetworkCache_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQAbstractNetworkCacheFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -549,7 +585,7 @@ func (ptr *QAbstractNetworkCache) ChildEventDefault(event core.QChildEvent_ITF)
 
 //export callbackQAbstractNetworkCache_ConnectNotify
 func callbackQAbstractNetworkCache_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAbstractNetworkCacheFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -564,7 +600,7 @@ func (ptr *QAbstractNetworkCache) ConnectNotifyDefault(sign core.QMetaMethod_ITF
 
 //export callbackQAbstractNetworkCache_CustomEvent
 func callbackQAbstractNetworkCache_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQAbstractNetworkCacheFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -579,7 +615,7 @@ func (ptr *QAbstractNetworkCache) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQAbstractNetworkCache_DeleteLater
 func callbackQAbstractNetworkCache_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractNetworkCacheFromPointer(ptr).DeleteLaterDefault()
@@ -589,14 +625,14 @@ func callbackQAbstractNetworkCache_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QAbstractNetworkCache) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractNetworkCache_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractNetworkCache_Destroyed
 func callbackQAbstractNetworkCache_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -604,7 +640,7 @@ func callbackQAbstractNetworkCache_Destroyed(ptr unsafe.Pointer, obj unsafe.Poin
 
 //export callbackQAbstractNetworkCache_DisconnectNotify
 func callbackQAbstractNetworkCache_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAbstractNetworkCacheFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -619,7 +655,7 @@ func (ptr *QAbstractNetworkCache) DisconnectNotifyDefault(sign core.QMetaMethod_
 
 //export callbackQAbstractNetworkCache_ObjectNameChanged
 func callbackQAbstractNetworkCache_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -627,7 +663,7 @@ func callbackQAbstractNetworkCache_ObjectNameChanged(ptr unsafe.Pointer, objectN
 
 //export callbackQAbstractNetworkCache_TimerEvent
 func callbackQAbstractNetworkCache_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQAbstractNetworkCacheFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -642,7 +678,7 @@ func (ptr *QAbstractNetworkCache) TimerEventDefault(event core.QTimerEvent_ITF)
 
 //export callbackQAbstractNetworkCache_MetaObject
 func callbackQAbstractNetworkCache_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -798,7 +834,7 @@ const (
 
 func NewQAbstractSocket(socketType QAbstractSocket__SocketType, parent core.QObject_ITF) *QAbstractSocket {
 	var tmpValue = NewQAbstractSocketFromPointer(C.QAbstractSocket_NewQAbstractSocket(C.longlong(socketType), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -806,7 +842,7 @@ func NewQAbstractSocket(socketType QAbstractSocket__SocketType, parent core.QObj
 
 //export callbackQAbstractSocket_SocketOption
 func callbackQAbstractSocket_SocketOption(ptr unsafe.Pointer, option C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "socketOption"); signal != nil {
+	if signal := qt.GetSignal(ptr, "socketOption"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(QAbstractSocket__SocketOption) *core.QVariant)(QAbstractSocket__SocketOption(option)))
 	}
 
@@ -816,14 +852,14 @@ func callbackQAbstractSocket_SocketOption(ptr unsafe.Pointer, option C.longlong)
 func (ptr *QAbstractSocket) ConnectSocketOption(f func(option QAbstractSocket__SocketOption) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "socketOption", f)
+		qt.ConnectSignal(ptr.Pointer(), "socketOption", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectSocketOption() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "socketOption")
+		qt.DisconnectSignal(ptr.Pointer(), "socketOption")
 	}
 }
 
@@ -868,7 +904,7 @@ func (ptr *QAbstractSocket) Flush() bool {
 
 //export callbackQAbstractSocket_WaitForBytesWritten
 func callbackQAbstractSocket_WaitForBytesWritten(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForBytesWritten"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -884,7 +920,7 @@ func (ptr *QAbstractSocket) WaitForBytesWrittenDefault(msecs int) bool {
 
 //export callbackQAbstractSocket_WaitForConnected
 func callbackQAbstractSocket_WaitForConnected(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForConnected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForConnected"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -894,14 +930,14 @@ func callbackQAbstractSocket_WaitForConnected(ptr unsafe.Pointer, msecs C.int) C
 func (ptr *QAbstractSocket) ConnectWaitForConnected(f func(msecs int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "waitForConnected", f)
+		qt.ConnectSignal(ptr.Pointer(), "waitForConnected", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectWaitForConnected() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "waitForConnected")
+		qt.DisconnectSignal(ptr.Pointer(), "waitForConnected")
 	}
 }
 
@@ -921,7 +957,7 @@ func (ptr *QAbstractSocket) WaitForConnectedDefault(msecs int) bool {
 
 //export callbackQAbstractSocket_WaitForDisconnected
 func callbackQAbstractSocket_WaitForDisconnected(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForDisconnected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForDisconnected"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -931,14 +967,14 @@ func callbackQAbstractSocket_WaitForDisconnected(ptr unsafe.Pointer, msecs C.int
 func (ptr *QAbstractSocket) ConnectWaitForDisconnected(f func(msecs int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "waitForDisconnected", f)
+		qt.ConnectSignal(ptr.Pointer(), "waitForDisconnected", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectWaitForDisconnected() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "waitForDisconnected")
+		qt.DisconnectSignal(ptr.Pointer(), "waitForDisconnected")
 	}
 }
 
@@ -958,7 +994,7 @@ func (ptr *QAbstractSocket) WaitForDisconnectedDefault(msecs int) bool {
 
 //export callbackQAbstractSocket_WaitForReadyRead
 func callbackQAbstractSocket_WaitForReadyRead(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForReadyRead"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -974,18 +1010,21 @@ func (ptr *QAbstractSocket) WaitForReadyReadDefault(msecs int) bool {
 
 //export callbackQAbstractSocket_ReadData
 func callbackQAbstractSocket_ReadData(ptr unsafe.Pointer, data C.struct_QtNetwork_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "readData"); signal != nil {
 		var retS = cGoUnpackString(data)
 		var ret = C.longlong(signal.(func(*string, int64) int64)(&retS, int64(maxSize)))
 		if ret > 0 {
-			C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+			copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 		}
 		return ret
 	}
 	var retS = cGoUnpackString(data)
 	var ret = C.longlong(NewQAbstractSocketFromPointer(ptr).ReadDataDefault(&retS, int64(maxSize)))
 	if ret > 0 {
-		C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+		copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 	}
 	return ret
 }
@@ -993,14 +1032,14 @@ func callbackQAbstractSocket_ReadData(ptr unsafe.Pointer, data C.struct_QtNetwor
 func (ptr *QAbstractSocket) ConnectReadData(f func(data *string, maxSize int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readData", f)
+		qt.ConnectSignal(ptr.Pointer(), "readData", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectReadData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readData")
+		qt.DisconnectSignal(ptr.Pointer(), "readData")
 	}
 }
 
@@ -1032,7 +1071,7 @@ func (ptr *QAbstractSocket) ReadDataDefault(data *string, maxSize int64) int64 {
 
 //export callbackQAbstractSocket_ReadLineData
 func callbackQAbstractSocket_ReadLineData(ptr unsafe.Pointer, data C.struct_QtNetwork_PackedString, maxlen C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readLineData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readLineData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(maxlen)))
 	}
 
@@ -1050,7 +1089,10 @@ func (ptr *QAbstractSocket) ReadLineDataDefault(data string, maxlen int64) int64
 
 //export callbackQAbstractSocket_WriteData
 func callbackQAbstractSocket_WriteData(ptr unsafe.Pointer, data C.struct_QtNetwork_PackedString, size C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "writeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "writeDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "writeData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(size)))
 	}
 
@@ -1060,14 +1102,14 @@ func callbackQAbstractSocket_WriteData(ptr unsafe.Pointer, data C.struct_QtNetwo
 func (ptr *QAbstractSocket) ConnectWriteData(f func(data string, size int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "writeData", f)
+		qt.ConnectSignal(ptr.Pointer(), "writeData", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectWriteData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "writeData")
+		qt.DisconnectSignal(ptr.Pointer(), "writeData")
 	}
 }
 
@@ -1097,7 +1139,7 @@ func (ptr *QAbstractSocket) Abort() {
 
 //export callbackQAbstractSocket_Close
 func callbackQAbstractSocket_Close(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractSocketFromPointer(ptr).CloseDefault()
@@ -1112,7 +1154,7 @@ func (ptr *QAbstractSocket) CloseDefault() {
 
 //export callbackQAbstractSocket_ConnectToHost2
 func callbackQAbstractSocket_ConnectToHost2(ptr unsafe.Pointer, address unsafe.Pointer, port C.ushort, openMode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectToHost2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectToHost2"); signal != nil {
 		signal.(func(*QHostAddress, uint16, core.QIODevice__OpenModeFlag))(NewQHostAddressFromPointer(address), uint16(port), core.QIODevice__OpenModeFlag(openMode))
 	} else {
 		NewQAbstractSocketFromPointer(ptr).ConnectToHost2Default(NewQHostAddressFromPointer(address), uint16(port), core.QIODevice__OpenModeFlag(openMode))
@@ -1122,14 +1164,14 @@ func callbackQAbstractSocket_ConnectToHost2(ptr unsafe.Pointer, address unsafe.P
 func (ptr *QAbstractSocket) ConnectConnectToHost2(f func(address *QHostAddress, port uint16, openMode core.QIODevice__OpenModeFlag)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "connectToHost2", f)
+		qt.ConnectSignal(ptr.Pointer(), "connectToHost2", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectConnectToHost2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "connectToHost2")
+		qt.DisconnectSignal(ptr.Pointer(), "connectToHost2")
 	}
 }
 
@@ -1147,7 +1189,7 @@ func (ptr *QAbstractSocket) ConnectToHost2Default(address QHostAddress_ITF, port
 
 //export callbackQAbstractSocket_ConnectToHost
 func callbackQAbstractSocket_ConnectToHost(ptr unsafe.Pointer, hostName C.struct_QtNetwork_PackedString, port C.ushort, openMode C.longlong, protocol C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectToHost"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectToHost"); signal != nil {
 		signal.(func(string, uint16, core.QIODevice__OpenModeFlag, QAbstractSocket__NetworkLayerProtocol))(cGoUnpackString(hostName), uint16(port), core.QIODevice__OpenModeFlag(openMode), QAbstractSocket__NetworkLayerProtocol(protocol))
 	} else {
 		NewQAbstractSocketFromPointer(ptr).ConnectToHostDefault(cGoUnpackString(hostName), uint16(port), core.QIODevice__OpenModeFlag(openMode), QAbstractSocket__NetworkLayerProtocol(protocol))
@@ -1157,14 +1199,14 @@ func callbackQAbstractSocket_ConnectToHost(ptr unsafe.Pointer, hostName C.struct
 func (ptr *QAbstractSocket) ConnectConnectToHost(f func(hostName string, port uint16, openMode core.QIODevice__OpenModeFlag, protocol QAbstractSocket__NetworkLayerProtocol)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "connectToHost", f)
+		qt.ConnectSignal(ptr.Pointer(), "connectToHost", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectConnectToHost() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "connectToHost")
+		qt.DisconnectSignal(ptr.Pointer(), "connectToHost")
 	}
 }
 
@@ -1186,7 +1228,7 @@ func (ptr *QAbstractSocket) ConnectToHostDefault(hostName string, port uint16, o
 
 //export callbackQAbstractSocket_Connected
 func callbackQAbstractSocket_Connected(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connected"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1195,14 +1237,14 @@ func callbackQAbstractSocket_Connected(ptr unsafe.Pointer) {
 func (ptr *QAbstractSocket) ConnectConnected(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_ConnectConnected(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "connected", f)
+		qt.ConnectSignal(ptr.Pointer(), "connected", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectConnected() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_DisconnectConnected(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "connected")
+		qt.DisconnectSignal(ptr.Pointer(), "connected")
 	}
 }
 
@@ -1214,7 +1256,7 @@ func (ptr *QAbstractSocket) Connected() {
 
 //export callbackQAbstractSocket_DisconnectFromHost
 func callbackQAbstractSocket_DisconnectFromHost(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectFromHost"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectFromHost"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractSocketFromPointer(ptr).DisconnectFromHostDefault()
@@ -1224,14 +1266,14 @@ func callbackQAbstractSocket_DisconnectFromHost(ptr unsafe.Pointer) {
 func (ptr *QAbstractSocket) ConnectDisconnectFromHost(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "disconnectFromHost", f)
+		qt.ConnectSignal(ptr.Pointer(), "disconnectFromHost", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectDisconnectFromHost() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "disconnectFromHost")
+		qt.DisconnectSignal(ptr.Pointer(), "disconnectFromHost")
 	}
 }
 
@@ -1249,7 +1291,7 @@ func (ptr *QAbstractSocket) DisconnectFromHostDefault() {
 
 //export callbackQAbstractSocket_Disconnected
 func callbackQAbstractSocket_Disconnected(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnected"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1258,14 +1300,14 @@ func callbackQAbstractSocket_Disconnected(ptr unsafe.Pointer) {
 func (ptr *QAbstractSocket) ConnectDisconnected(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_ConnectDisconnected(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "disconnected", f)
+		qt.ConnectSignal(ptr.Pointer(), "disconnected", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectDisconnected() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_DisconnectDisconnected(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "disconnected")
+		qt.DisconnectSignal(ptr.Pointer(), "disconnected")
 	}
 }
 
@@ -1277,7 +1319,7 @@ func (ptr *QAbstractSocket) Disconnected() {
 
 //export callbackQAbstractSocket_Error2
 func callbackQAbstractSocket_Error2(ptr unsafe.Pointer, socketError C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "error2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "error2"); signal != nil {
 		signal.(func(QAbstractSocket__SocketError))(QAbstractSocket__SocketError(socketError))
 	}
 
@@ -1286,14 +1328,14 @@ func callbackQAbstractSocket_Error2(ptr unsafe.Pointer, socketError C.longlong)
 func (ptr *QAbstractSocket) ConnectError2(f func(socketError QAbstractSocket__SocketError)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_ConnectError2(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "error2", f)
+		qt.ConnectSignal(ptr.Pointer(), "error2", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectError2() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_DisconnectError2(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "error2")
+		qt.DisconnectSignal(ptr.Pointer(), "error2")
 	}
 }
 
@@ -1305,7 +1347,7 @@ func (ptr *QAbstractSocket) Error2(socketError QAbstractSocket__SocketError) {
 
 //export callbackQAbstractSocket_HostFound
 func callbackQAbstractSocket_HostFound(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hostFound"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hostFound"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1314,14 +1356,14 @@ func callbackQAbstractSocket_HostFound(ptr unsafe.Pointer) {
 func (ptr *QAbstractSocket) ConnectHostFound(f func()) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_ConnectHostFound(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hostFound", f)
+		qt.ConnectSignal(ptr.Pointer(), "hostFound", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectHostFound() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_DisconnectHostFound(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hostFound")
+		qt.DisconnectSignal(ptr.Pointer(), "hostFound")
 	}
 }
 
@@ -1333,7 +1375,7 @@ func (ptr *QAbstractSocket) HostFound() {
 
 //export callbackQAbstractSocket_ProxyAuthenticationRequired
 func callbackQAbstractSocket_ProxyAuthenticationRequired(ptr unsafe.Pointer, proxy unsafe.Pointer, authenticator unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "proxyAuthenticationRequired"); signal != nil {
+	if signal := qt.GetSignal(ptr, "proxyAuthenticationRequired"); signal != nil {
 		signal.(func(*QNetworkProxy, *QAuthenticator))(NewQNetworkProxyFromPointer(proxy), NewQAuthenticatorFromPointer(authenticator))
 	}
 
@@ -1342,14 +1384,14 @@ func callbackQAbstractSocket_ProxyAuthenticationRequired(ptr unsafe.Pointer, pro
 func (ptr *QAbstractSocket) ConnectProxyAuthenticationRequired(f func(proxy *QNetworkProxy, authenticator *QAuthenticator)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_ConnectProxyAuthenticationRequired(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "proxyAuthenticationRequired", f)
+		qt.ConnectSignal(ptr.Pointer(), "proxyAuthenticationRequired", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectProxyAuthenticationRequired() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_DisconnectProxyAuthenticationRequired(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "proxyAuthenticationRequired")
+		qt.DisconnectSignal(ptr.Pointer(), "proxyAuthenticationRequired")
 	}
 }
 
@@ -1361,7 +1403,7 @@ func (ptr *QAbstractSocket) ProxyAuthenticationRequired(proxy QNetworkProxy_ITF,
 
 //export callbackQAbstractSocket_Resume
 func callbackQAbstractSocket_Resume(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resume"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resume"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractSocketFromPointer(ptr).ResumeDefault()
@@ -1371,14 +1413,14 @@ func callbackQAbstractSocket_Resume(ptr unsafe.Pointer) {
 func (ptr *QAbstractSocket) ConnectResume(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resume", f)
+		qt.ConnectSignal(ptr.Pointer(), "resume", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectResume() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resume")
+		qt.DisconnectSignal(ptr.Pointer(), "resume")
 	}
 }
 
@@ -1440,7 +1482,7 @@ func (ptr *QAbstractSocket) SetProxy(networkProxy QNetworkProxy_ITF) {
 
 //export callbackQAbstractSocket_SetReadBufferSize
 func callbackQAbstractSocket_SetReadBufferSize(ptr unsafe.Pointer, size C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setReadBufferSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setReadBufferSize"); signal != nil {
 		signal.(func(int64))(int64(size))
 	} else {
 		NewQAbstractSocketFromPointer(ptr).SetReadBufferSizeDefault(int64(size))
@@ -1450,14 +1492,14 @@ func callbackQAbstractSocket_SetReadBufferSize(ptr unsafe.Pointer, size C.longlo
 func (ptr *QAbstractSocket) ConnectSetReadBufferSize(f func(size int64)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setReadBufferSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "setReadBufferSize", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectSetReadBufferSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setReadBufferSize")
+		qt.DisconnectSignal(ptr.Pointer(), "setReadBufferSize")
 	}
 }
 
@@ -1481,7 +1523,7 @@ func (ptr *QAbstractSocket) SetSocketError(socketError QAbstractSocket__SocketEr
 
 //export callbackQAbstractSocket_SetSocketOption
 func callbackQAbstractSocket_SetSocketOption(ptr unsafe.Pointer, option C.longlong, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSocketOption"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSocketOption"); signal != nil {
 		signal.(func(QAbstractSocket__SocketOption, *core.QVariant))(QAbstractSocket__SocketOption(option), core.NewQVariantFromPointer(value))
 	} else {
 		NewQAbstractSocketFromPointer(ptr).SetSocketOptionDefault(QAbstractSocket__SocketOption(option), core.NewQVariantFromPointer(value))
@@ -1491,14 +1533,14 @@ func callbackQAbstractSocket_SetSocketOption(ptr unsafe.Pointer, option C.longlo
 func (ptr *QAbstractSocket) ConnectSetSocketOption(f func(option QAbstractSocket__SocketOption, value *core.QVariant)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSocketOption", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSocketOption", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectSetSocketOption() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSocketOption")
+		qt.DisconnectSignal(ptr.Pointer(), "setSocketOption")
 	}
 }
 
@@ -1522,7 +1564,7 @@ func (ptr *QAbstractSocket) SetSocketState(state QAbstractSocket__SocketState) {
 
 //export callbackQAbstractSocket_StateChanged
 func callbackQAbstractSocket_StateChanged(ptr unsafe.Pointer, socketState C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stateChanged"); signal != nil {
 		signal.(func(QAbstractSocket__SocketState))(QAbstractSocket__SocketState(socketState))
 	}
 
@@ -1531,14 +1573,14 @@ func callbackQAbstractSocket_StateChanged(ptr unsafe.Pointer, socketState C.long
 func (ptr *QAbstractSocket) ConnectStateChanged(f func(socketState QAbstractSocket__SocketState)) {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_ConnectStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "stateChanged", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_DisconnectStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "stateChanged")
 	}
 }
 
@@ -1550,7 +1592,7 @@ func (ptr *QAbstractSocket) StateChanged(socketState QAbstractSocket__SocketStat
 
 //export callbackQAbstractSocket_DestroyQAbstractSocket
 func callbackQAbstractSocket_DestroyQAbstractSocket(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAbstractSocket"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAbstractSocket"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractSocketFromPointer(ptr).DestroyQAbstractSocketDefault()
@@ -1560,21 +1602,21 @@ func callbackQAbstractSocket_DestroyQAbstractSocket(ptr unsafe.Pointer) {
 func (ptr *QAbstractSocket) ConnectDestroyQAbstractSocket(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractSocket", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAbstractSocket", f)
 	}
 }
 
 func (ptr *QAbstractSocket) DisconnectDestroyQAbstractSocket() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAbstractSocket")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAbstractSocket")
 	}
 }
 
 func (ptr *QAbstractSocket) DestroyQAbstractSocket() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_DestroyQAbstractSocket(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1582,7 +1624,7 @@ func (ptr *QAbstractSocket) DestroyQAbstractSocket() {
 func (ptr *QAbstractSocket) DestroyQAbstractSocketDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_DestroyQAbstractSocketDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1651,7 +1693,7 @@ func (ptr *QAbstractSocket) SocketType() QAbstractSocket__SocketType {
 
 //export callbackQAbstractSocket_AtEnd
 func callbackQAbstractSocket_AtEnd(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "atEnd"); signal != nil {
+	if signal := qt.GetSignal(ptr, "atEnd"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1667,7 +1709,7 @@ func (ptr *QAbstractSocket) AtEndDefault() bool {
 
 //export callbackQAbstractSocket_CanReadLine
 func callbackQAbstractSocket_CanReadLine(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canReadLine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canReadLine"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1683,7 +1725,7 @@ func (ptr *QAbstractSocket) CanReadLineDefault() bool {
 
 //export callbackQAbstractSocket_IsSequential
 func callbackQAbstractSocket_IsSequential(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isSequential"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isSequential"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1706,7 +1748,7 @@ func (ptr *QAbstractSocket) IsValid() bool {
 
 //export callbackQAbstractSocket_BytesAvailable
 func callbackQAbstractSocket_BytesAvailable(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesAvailable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesAvailable"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -1722,7 +1764,7 @@ func (ptr *QAbstractSocket) BytesAvailableDefault() int64 {
 
 //export callbackQAbstractSocket_BytesToWrite
 func callbackQAbstractSocket_BytesToWrite(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesToWrite"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesToWrite"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -1779,7 +1821,7 @@ func (ptr *QAbstractSocket) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QAbstractSocket) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractSocket___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1800,7 +1842,7 @@ func (ptr *QAbstractSocket) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QAbstractSocket) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractSocket___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1821,7 +1863,7 @@ func (ptr *QAbstractSocket) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QAbstractSocket) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractSocket___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1842,7 +1884,7 @@ func (ptr *QAbstractSocket) __findChildren_newList() unsafe.Pointer {
 func (ptr *QAbstractSocket) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractSocket___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1862,7 +1904,7 @@ func (ptr *QAbstractSocket) __children_newList() unsafe.Pointer {
 
 //export callbackQAbstractSocket_Open
 func callbackQAbstractSocket_Open(ptr unsafe.Pointer, mode C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "open"); signal != nil {
+	if signal := qt.GetSignal(ptr, "open"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(core.QIODevice__OpenModeFlag) bool)(core.QIODevice__OpenModeFlag(mode)))))
 	}
 
@@ -1878,7 +1920,7 @@ func (ptr *QAbstractSocket) OpenDefault(mode core.QIODevice__OpenModeFlag) bool
 
 //export callbackQAbstractSocket_Reset
 func callbackQAbstractSocket_Reset(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1894,7 +1936,7 @@ func (ptr *QAbstractSocket) ResetDefault() bool {
 
 //export callbackQAbstractSocket_Seek
 func callbackQAbstractSocket_Seek(ptr unsafe.Pointer, pos C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seek"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seek"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int64) bool)(int64(pos)))))
 	}
 
@@ -1910,7 +1952,7 @@ func (ptr *QAbstractSocket) SeekDefault(pos int64) bool {
 
 //export callbackQAbstractSocket_AboutToClose
 func callbackQAbstractSocket_AboutToClose(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aboutToClose"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aboutToClose"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1918,7 +1960,7 @@ func callbackQAbstractSocket_AboutToClose(ptr unsafe.Pointer) {
 
 //export callbackQAbstractSocket_BytesWritten
 func callbackQAbstractSocket_BytesWritten(ptr unsafe.Pointer, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesWritten"); signal != nil {
 		signal.(func(int64))(int64(bytes))
 	}
 
@@ -1926,7 +1968,7 @@ func callbackQAbstractSocket_BytesWritten(ptr unsafe.Pointer, bytes C.longlong)
 
 //export callbackQAbstractSocket_ChannelBytesWritten
 func callbackQAbstractSocket_ChannelBytesWritten(ptr unsafe.Pointer, channel C.int, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelBytesWritten"); signal != nil {
 		signal.(func(int, int64))(int(int32(channel)), int64(bytes))
 	}
 
@@ -1934,7 +1976,7 @@ func callbackQAbstractSocket_ChannelBytesWritten(ptr unsafe.Pointer, channel C.i
 
 //export callbackQAbstractSocket_ChannelReadyRead
 func callbackQAbstractSocket_ChannelReadyRead(ptr unsafe.Pointer, channel C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelReadyRead"); signal != nil {
 		signal.(func(int))(int(int32(channel)))
 	}
 
@@ -1942,7 +1984,7 @@ func callbackQAbstractSocket_ChannelReadyRead(ptr unsafe.Pointer, channel C.int)
 
 //export callbackQAbstractSocket_ReadChannelFinished
 func callbackQAbstractSocket_ReadChannelFinished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readChannelFinished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readChannelFinished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1950,7 +1992,7 @@ func callbackQAbstractSocket_ReadChannelFinished(ptr unsafe.Pointer) {
 
 //export callbackQAbstractSocket_ReadyRead
 func callbackQAbstractSocket_ReadyRead(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readyRead"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1958,7 +2000,7 @@ func callbackQAbstractSocket_ReadyRead(ptr unsafe.Pointer) {
 
 //export callbackQAbstractSocket_Pos
 func callbackQAbstractSocket_Pos(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pos"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pos"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -1974,7 +2016,7 @@ func (ptr *QAbstractSocket) PosDefault() int64 {
 
 //export callbackQAbstractSocket_Size
 func callbackQAbstractSocket_Size(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -1990,7 +2032,7 @@ func (ptr *QAbstractSocket) SizeDefault() int64 {
 
 //export callbackQAbstractSocket_Event
 func callbackQAbstractSocket_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -2006,7 +2048,7 @@ func (ptr *QAbstractSocket) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQAbstractSocket_EventFilter
 func callbackQAbstractSocket_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -2022,7 +2064,7 @@ func (ptr *QAbstractSocket) EventFilterDefault(watched core.QObject_ITF, event c
 
 //export callbackQAbstractSocket_ChildEvent
 func callbackQAbstractSocket_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQAbstractSocketFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -2037,7 +2079,7 @@ func (ptr *QAbstractSocket) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQAbstractSocket_ConnectNotify
 func callbackQAbstractSocket_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAbstractSocketFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -2052,7 +2094,7 @@ func (ptr *QAbstractSocket) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQAbstractSocket_CustomEvent
 func callbackQAbstractSocket_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQAbstractSocketFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -2067,7 +2109,7 @@ func (ptr *QAbstractSocket) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQAbstractSocket_DeleteLater
 func callbackQAbstractSocket_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractSocketFromPointer(ptr).DeleteLaterDefault()
@@ -2077,14 +2119,14 @@ func callbackQAbstractSocket_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QAbstractSocket) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractSocket_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractSocket_Destroyed
 func callbackQAbstractSocket_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -2092,7 +2134,7 @@ func callbackQAbstractSocket_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQAbstractSocket_DisconnectNotify
 func callbackQAbstractSocket_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAbstractSocketFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -2107,7 +2149,7 @@ func (ptr *QAbstractSocket) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQAbstractSocket_ObjectNameChanged
 func callbackQAbstractSocket_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -2115,7 +2157,7 @@ func callbackQAbstractSocket_ObjectNameChanged(ptr unsafe.Pointer, objectName C.
 
 //export callbackQAbstractSocket_TimerEvent
 func callbackQAbstractSocket_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQAbstractSocketFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -2130,7 +2172,7 @@ func (ptr *QAbstractSocket) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQAbstractSocket_MetaObject
 func callbackQAbstractSocket_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -2571,7 +2613,7 @@ const (
 
 func NewQDnsLookup(parent core.QObject_ITF) *QDnsLookup {
 	var tmpValue = NewQDnsLookupFromPointer(C.QDnsLookup_NewQDnsLookup(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2581,7 +2623,7 @@ func NewQDnsLookup2(ty QDnsLookup__Type, name string, parent core.QObject_ITF) *
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
 	var tmpValue = NewQDnsLookupFromPointer(C.QDnsLookup_NewQDnsLookup2(C.longlong(ty), nameC, core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2591,7 +2633,7 @@ func NewQDnsLookup3(ty QDnsLookup__Type, name string, nameserver QHostAddress_IT
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
 	var tmpValue = NewQDnsLookupFromPointer(C.QDnsLookup_NewQDnsLookup3(C.longlong(ty), nameC, PointerFromQHostAddress(nameserver), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2599,7 +2641,7 @@ func NewQDnsLookup3(ty QDnsLookup__Type, name string, nameserver QHostAddress_IT
 
 //export callbackQDnsLookup_Abort
 func callbackQDnsLookup_Abort(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "abort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "abort"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDnsLookupFromPointer(ptr).AbortDefault()
@@ -2609,14 +2651,14 @@ func callbackQDnsLookup_Abort(ptr unsafe.Pointer) {
 func (ptr *QDnsLookup) ConnectAbort(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "abort", f)
+		qt.ConnectSignal(ptr.Pointer(), "abort", f)
 	}
 }
 
 func (ptr *QDnsLookup) DisconnectAbort() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "abort")
+		qt.DisconnectSignal(ptr.Pointer(), "abort")
 	}
 }
 
@@ -2634,7 +2676,7 @@ func (ptr *QDnsLookup) AbortDefault() {
 
 //export callbackQDnsLookup_Finished
 func callbackQDnsLookup_Finished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -2643,14 +2685,14 @@ func callbackQDnsLookup_Finished(ptr unsafe.Pointer) {
 func (ptr *QDnsLookup) ConnectFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QDnsLookup) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
@@ -2662,7 +2704,7 @@ func (ptr *QDnsLookup) Finished() {
 
 //export callbackQDnsLookup_Lookup
 func callbackQDnsLookup_Lookup(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lookup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lookup"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDnsLookupFromPointer(ptr).LookupDefault()
@@ -2672,14 +2714,14 @@ func callbackQDnsLookup_Lookup(ptr unsafe.Pointer) {
 func (ptr *QDnsLookup) ConnectLookup(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lookup", f)
+		qt.ConnectSignal(ptr.Pointer(), "lookup", f)
 	}
 }
 
 func (ptr *QDnsLookup) DisconnectLookup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lookup")
+		qt.DisconnectSignal(ptr.Pointer(), "lookup")
 	}
 }
 
@@ -2697,7 +2739,7 @@ func (ptr *QDnsLookup) LookupDefault() {
 
 //export callbackQDnsLookup_NameChanged
 func callbackQDnsLookup_NameChanged(ptr unsafe.Pointer, name C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(name))
 	}
 
@@ -2706,14 +2748,14 @@ func callbackQDnsLookup_NameChanged(ptr unsafe.Pointer, name C.struct_QtNetwork_
 func (ptr *QDnsLookup) ConnectNameChanged(f func(name string)) {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_ConnectNameChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nameChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "nameChanged", f)
 	}
 }
 
 func (ptr *QDnsLookup) DisconnectNameChanged() {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_DisconnectNameChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nameChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "nameChanged")
 	}
 }
 
@@ -2727,7 +2769,7 @@ func (ptr *QDnsLookup) NameChanged(name string) {
 
 //export callbackQDnsLookup_NameserverChanged
 func callbackQDnsLookup_NameserverChanged(ptr unsafe.Pointer, nameserver unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nameserverChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nameserverChanged"); signal != nil {
 		signal.(func(*QHostAddress))(NewQHostAddressFromPointer(nameserver))
 	}
 
@@ -2736,14 +2778,14 @@ func callbackQDnsLookup_NameserverChanged(ptr unsafe.Pointer, nameserver unsafe.
 func (ptr *QDnsLookup) ConnectNameserverChanged(f func(nameserver *QHostAddress)) {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_ConnectNameserverChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nameserverChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "nameserverChanged", f)
 	}
 }
 
 func (ptr *QDnsLookup) DisconnectNameserverChanged() {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_DisconnectNameserverChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nameserverChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "nameserverChanged")
 	}
 }
 
@@ -2775,7 +2817,7 @@ func (ptr *QDnsLookup) SetType(vqd QDnsLookup__Type) {
 
 //export callbackQDnsLookup_TypeChanged
 func callbackQDnsLookup_TypeChanged(ptr unsafe.Pointer, ty C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "typeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "typeChanged"); signal != nil {
 		signal.(func(QDnsLookup__Type))(QDnsLookup__Type(ty))
 	}
 
@@ -2784,14 +2826,14 @@ func callbackQDnsLookup_TypeChanged(ptr unsafe.Pointer, ty C.longlong) {
 func (ptr *QDnsLookup) ConnectTypeChanged(f func(ty QDnsLookup__Type)) {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_ConnectTypeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "typeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "typeChanged", f)
 	}
 }
 
 func (ptr *QDnsLookup) DisconnectTypeChanged() {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_DisconnectTypeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "typeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "typeChanged")
 	}
 }
 
@@ -2804,7 +2846,7 @@ func (ptr *QDnsLookup) TypeChanged(ty QDnsLookup__Type) {
 func (ptr *QDnsLookup) DestroyQDnsLookup() {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_DestroyQDnsLookup(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3099,7 +3141,7 @@ func (ptr *QDnsLookup) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QDnsLookup) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDnsLookup___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3120,7 +3162,7 @@ func (ptr *QDnsLookup) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QDnsLookup) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDnsLookup___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3141,7 +3183,7 @@ func (ptr *QDnsLookup) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QDnsLookup) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDnsLookup___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3162,7 +3204,7 @@ func (ptr *QDnsLookup) __findChildren_newList() unsafe.Pointer {
 func (ptr *QDnsLookup) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QDnsLookup___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3182,7 +3224,7 @@ func (ptr *QDnsLookup) __children_newList() unsafe.Pointer {
 
 //export callbackQDnsLookup_Event
 func callbackQDnsLookup_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -3198,7 +3240,7 @@ func (ptr *QDnsLookup) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQDnsLookup_EventFilter
 func callbackQDnsLookup_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -3214,7 +3256,7 @@ func (ptr *QDnsLookup) EventFilterDefault(watched core.QObject_ITF, event core.Q
 
 //export callbackQDnsLookup_ChildEvent
 func callbackQDnsLookup_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQDnsLookupFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -3229,7 +3271,7 @@ func (ptr *QDnsLookup) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQDnsLookup_ConnectNotify
 func callbackQDnsLookup_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDnsLookupFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3244,7 +3286,7 @@ func (ptr *QDnsLookup) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQDnsLookup_CustomEvent
 func callbackQDnsLookup_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQDnsLookupFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -3259,7 +3301,7 @@ func (ptr *QDnsLookup) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQDnsLookup_DeleteLater
 func callbackQDnsLookup_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQDnsLookupFromPointer(ptr).DeleteLaterDefault()
@@ -3269,14 +3311,14 @@ func callbackQDnsLookup_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QDnsLookup) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QDnsLookup_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDnsLookup_Destroyed
 func callbackQDnsLookup_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -3284,7 +3326,7 @@ func callbackQDnsLookup_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQDnsLookup_DisconnectNotify
 func callbackQDnsLookup_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQDnsLookupFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3299,7 +3341,7 @@ func (ptr *QDnsLookup) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQDnsLookup_ObjectNameChanged
 func callbackQDnsLookup_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -3307,7 +3349,7 @@ func callbackQDnsLookup_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struc
 
 //export callbackQDnsLookup_TimerEvent
 func callbackQDnsLookup_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQDnsLookupFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -3322,7 +3364,7 @@ func (ptr *QDnsLookup) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQDnsLookup_MetaObject
 func callbackQDnsLookup_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -3594,13 +3636,13 @@ func (ptr *QDnsTextRecord) DestroyQDnsTextRecord() {
 
 func (ptr *QDnsTextRecord) Values() []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtNetwork_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQDnsTextRecordFromPointer(l.data).__values_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QDnsTextRecord_Values(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QDnsTextRecord_Values(ptr.Pointer())))
 	}
 	return make([]*core.QByteArray, 0)
 }
@@ -4179,7 +4221,7 @@ const (
 
 func NewQHttpMultiPart2(contentType QHttpMultiPart__ContentType, parent core.QObject_ITF) *QHttpMultiPart {
 	var tmpValue = NewQHttpMultiPartFromPointer(C.QHttpMultiPart_NewQHttpMultiPart2(C.longlong(contentType), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4187,7 +4229,7 @@ func NewQHttpMultiPart2(contentType QHttpMultiPart__ContentType, parent core.QOb
 
 func NewQHttpMultiPart(parent core.QObject_ITF) *QHttpMultiPart {
 	var tmpValue = NewQHttpMultiPartFromPointer(C.QHttpMultiPart_NewQHttpMultiPart(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4214,7 +4256,7 @@ func (ptr *QHttpMultiPart) SetContentType(contentType QHttpMultiPart__ContentTyp
 func (ptr *QHttpMultiPart) DestroyQHttpMultiPart() {
 	if ptr.Pointer() != nil {
 		C.QHttpMultiPart_DestroyQHttpMultiPart(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4250,7 +4292,7 @@ func (ptr *QHttpMultiPart) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QHttpMultiPart) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHttpMultiPart___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4271,7 +4313,7 @@ func (ptr *QHttpMultiPart) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QHttpMultiPart) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHttpMultiPart___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4292,7 +4334,7 @@ func (ptr *QHttpMultiPart) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QHttpMultiPart) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHttpMultiPart___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4313,7 +4355,7 @@ func (ptr *QHttpMultiPart) __findChildren_newList() unsafe.Pointer {
 func (ptr *QHttpMultiPart) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QHttpMultiPart___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4333,7 +4375,7 @@ func (ptr *QHttpMultiPart) __children_newList() unsafe.Pointer {
 
 //export callbackQHttpMultiPart_Event
 func callbackQHttpMultiPart_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -4349,7 +4391,7 @@ func (ptr *QHttpMultiPart) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQHttpMultiPart_EventFilter
 func callbackQHttpMultiPart_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -4365,7 +4407,7 @@ func (ptr *QHttpMultiPart) EventFilterDefault(watched core.QObject_ITF, event co
 
 //export callbackQHttpMultiPart_ChildEvent
 func callbackQHttpMultiPart_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQHttpMultiPartFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -4380,7 +4422,7 @@ func (ptr *QHttpMultiPart) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQHttpMultiPart_ConnectNotify
 func callbackQHttpMultiPart_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHttpMultiPartFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4395,7 +4437,7 @@ func (ptr *QHttpMultiPart) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHttpMultiPart_CustomEvent
 func callbackQHttpMultiPart_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQHttpMultiPartFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -4410,7 +4452,7 @@ func (ptr *QHttpMultiPart) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQHttpMultiPart_DeleteLater
 func callbackQHttpMultiPart_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQHttpMultiPartFromPointer(ptr).DeleteLaterDefault()
@@ -4420,14 +4462,14 @@ func callbackQHttpMultiPart_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QHttpMultiPart) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QHttpMultiPart_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHttpMultiPart_Destroyed
 func callbackQHttpMultiPart_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -4435,7 +4477,7 @@ func callbackQHttpMultiPart_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQHttpMultiPart_DisconnectNotify
 func callbackQHttpMultiPart_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQHttpMultiPartFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4450,7 +4492,7 @@ func (ptr *QHttpMultiPart) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQHttpMultiPart_ObjectNameChanged
 func callbackQHttpMultiPart_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -4458,7 +4500,7 @@ func callbackQHttpMultiPart_ObjectNameChanged(ptr unsafe.Pointer, objectName C.s
 
 //export callbackQHttpMultiPart_TimerEvent
 func callbackQHttpMultiPart_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQHttpMultiPartFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -4473,7 +4515,7 @@ func (ptr *QHttpMultiPart) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQHttpMultiPart_MetaObject
 func callbackQHttpMultiPart_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -4626,7 +4668,7 @@ const (
 
 func NewQLocalServer(parent core.QObject_ITF) *QLocalServer {
 	var tmpValue = NewQLocalServerFromPointer(C.QLocalServer_NewQLocalServer(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4634,7 +4676,7 @@ func NewQLocalServer(parent core.QObject_ITF) *QLocalServer {
 
 //export callbackQLocalServer_NextPendingConnection
 func callbackQLocalServer_NextPendingConnection(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nextPendingConnection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nextPendingConnection"); signal != nil {
 		return PointerFromQLocalSocket(signal.(func() *QLocalSocket)())
 	}
 
@@ -4644,21 +4686,21 @@ func callbackQLocalServer_NextPendingConnection(ptr unsafe.Pointer) unsafe.Point
 func (ptr *QLocalServer) ConnectNextPendingConnection(f func() *QLocalSocket) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nextPendingConnection", f)
+		qt.ConnectSignal(ptr.Pointer(), "nextPendingConnection", f)
 	}
 }
 
 func (ptr *QLocalServer) DisconnectNextPendingConnection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nextPendingConnection")
+		qt.DisconnectSignal(ptr.Pointer(), "nextPendingConnection")
 	}
 }
 
 func (ptr *QLocalServer) NextPendingConnection() *QLocalSocket {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQLocalSocketFromPointer(C.QLocalServer_NextPendingConnection(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4669,7 +4711,7 @@ func (ptr *QLocalServer) NextPendingConnection() *QLocalSocket {
 func (ptr *QLocalServer) NextPendingConnectionDefault() *QLocalSocket {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQLocalSocketFromPointer(C.QLocalServer_NextPendingConnectionDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4713,7 +4755,7 @@ func (ptr *QLocalServer) Close() {
 
 //export callbackQLocalServer_IncomingConnection
 func callbackQLocalServer_IncomingConnection(ptr unsafe.Pointer, socketDescriptor C.uintptr_t) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "incomingConnection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "incomingConnection"); signal != nil {
 		signal.(func(uintptr))(uintptr(socketDescriptor))
 	} else {
 		NewQLocalServerFromPointer(ptr).IncomingConnectionDefault(uintptr(socketDescriptor))
@@ -4723,14 +4765,14 @@ func callbackQLocalServer_IncomingConnection(ptr unsafe.Pointer, socketDescripto
 func (ptr *QLocalServer) ConnectIncomingConnection(f func(socketDescriptor uintptr)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "incomingConnection", f)
+		qt.ConnectSignal(ptr.Pointer(), "incomingConnection", f)
 	}
 }
 
 func (ptr *QLocalServer) DisconnectIncomingConnection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "incomingConnection")
+		qt.DisconnectSignal(ptr.Pointer(), "incomingConnection")
 	}
 }
 
@@ -4748,7 +4790,7 @@ func (ptr *QLocalServer) IncomingConnectionDefault(socketDescriptor uintptr) {
 
 //export callbackQLocalServer_NewConnection
 func callbackQLocalServer_NewConnection(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "newConnection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "newConnection"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4757,14 +4799,14 @@ func callbackQLocalServer_NewConnection(ptr unsafe.Pointer) {
 func (ptr *QLocalServer) ConnectNewConnection(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLocalServer_ConnectNewConnection(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "newConnection", f)
+		qt.ConnectSignal(ptr.Pointer(), "newConnection", f)
 	}
 }
 
 func (ptr *QLocalServer) DisconnectNewConnection() {
 	if ptr.Pointer() != nil {
 		C.QLocalServer_DisconnectNewConnection(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "newConnection")
+		qt.DisconnectSignal(ptr.Pointer(), "newConnection")
 	}
 }
 
@@ -4789,7 +4831,7 @@ func (ptr *QLocalServer) SetSocketOptions(options QLocalServer__SocketOption) {
 func (ptr *QLocalServer) DestroyQLocalServer() {
 	if ptr.Pointer() != nil {
 		C.QLocalServer_DestroyQLocalServer(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4831,7 +4873,7 @@ func (ptr *QLocalServer) SocketOptions() QLocalServer__SocketOption {
 
 //export callbackQLocalServer_HasPendingConnections
 func callbackQLocalServer_HasPendingConnections(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasPendingConnections"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasPendingConnections"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -4841,14 +4883,14 @@ func callbackQLocalServer_HasPendingConnections(ptr unsafe.Pointer) C.char {
 func (ptr *QLocalServer) ConnectHasPendingConnections(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasPendingConnections", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasPendingConnections", f)
 	}
 }
 
 func (ptr *QLocalServer) DisconnectHasPendingConnections() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasPendingConnections")
+		qt.DisconnectSignal(ptr.Pointer(), "hasPendingConnections")
 	}
 }
 
@@ -4902,7 +4944,7 @@ func (ptr *QLocalServer) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QLocalServer) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QLocalServer___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4923,7 +4965,7 @@ func (ptr *QLocalServer) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QLocalServer) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QLocalServer___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4944,7 +4986,7 @@ func (ptr *QLocalServer) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QLocalServer) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QLocalServer___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4965,7 +5007,7 @@ func (ptr *QLocalServer) __findChildren_newList() unsafe.Pointer {
 func (ptr *QLocalServer) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QLocalServer___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4985,7 +5027,7 @@ func (ptr *QLocalServer) __children_newList() unsafe.Pointer {
 
 //export callbackQLocalServer_Event
 func callbackQLocalServer_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -5001,7 +5043,7 @@ func (ptr *QLocalServer) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQLocalServer_EventFilter
 func callbackQLocalServer_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -5017,7 +5059,7 @@ func (ptr *QLocalServer) EventFilterDefault(watched core.QObject_ITF, event core
 
 //export callbackQLocalServer_ChildEvent
 func callbackQLocalServer_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQLocalServerFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -5032,7 +5074,7 @@ func (ptr *QLocalServer) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQLocalServer_ConnectNotify
 func callbackQLocalServer_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQLocalServerFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5047,7 +5089,7 @@ func (ptr *QLocalServer) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQLocalServer_CustomEvent
 func callbackQLocalServer_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQLocalServerFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -5062,7 +5104,7 @@ func (ptr *QLocalServer) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQLocalServer_DeleteLater
 func callbackQLocalServer_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQLocalServerFromPointer(ptr).DeleteLaterDefault()
@@ -5072,14 +5114,14 @@ func callbackQLocalServer_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QLocalServer) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QLocalServer_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQLocalServer_Destroyed
 func callbackQLocalServer_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -5087,7 +5129,7 @@ func callbackQLocalServer_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQLocalServer_DisconnectNotify
 func callbackQLocalServer_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQLocalServerFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5102,7 +5144,7 @@ func (ptr *QLocalServer) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQLocalServer_ObjectNameChanged
 func callbackQLocalServer_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -5110,7 +5152,7 @@ func callbackQLocalServer_ObjectNameChanged(ptr unsafe.Pointer, objectName C.str
 
 //export callbackQLocalServer_TimerEvent
 func callbackQLocalServer_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQLocalServerFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -5125,7 +5167,7 @@ func (ptr *QLocalServer) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQLocalServer_MetaObject
 func callbackQLocalServer_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -5209,7 +5251,7 @@ const (
 
 //export callbackQLocalSocket_Open
 func callbackQLocalSocket_Open(ptr unsafe.Pointer, openMode C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "open"); signal != nil {
+	if signal := qt.GetSignal(ptr, "open"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(core.QIODevice__OpenModeFlag) bool)(core.QIODevice__OpenModeFlag(openMode)))))
 	}
 
@@ -5225,7 +5267,7 @@ func (ptr *QLocalSocket) OpenDefault(openMode core.QIODevice__OpenModeFlag) bool
 
 func NewQLocalSocket(parent core.QObject_ITF) *QLocalSocket {
 	var tmpValue = NewQLocalSocketFromPointer(C.QLocalSocket_NewQLocalSocket(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5240,7 +5282,7 @@ func (ptr *QLocalSocket) Flush() bool {
 
 //export callbackQLocalSocket_WaitForBytesWritten
 func callbackQLocalSocket_WaitForBytesWritten(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForBytesWritten"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -5270,7 +5312,7 @@ func (ptr *QLocalSocket) WaitForDisconnected(msecs int) bool {
 
 //export callbackQLocalSocket_WaitForReadyRead
 func callbackQLocalSocket_WaitForReadyRead(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForReadyRead"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -5286,18 +5328,21 @@ func (ptr *QLocalSocket) WaitForReadyReadDefault(msecs int) bool {
 
 //export callbackQLocalSocket_ReadData
 func callbackQLocalSocket_ReadData(ptr unsafe.Pointer, data C.struct_QtNetwork_PackedString, c C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "readData"); signal != nil {
 		var retS = cGoUnpackString(data)
 		var ret = C.longlong(signal.(func(*string, int64) int64)(&retS, int64(c)))
 		if ret > 0 {
-			C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+			copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 		}
 		return ret
 	}
 	var retS = cGoUnpackString(data)
 	var ret = C.longlong(NewQLocalSocketFromPointer(ptr).ReadDataDefault(&retS, int64(c)))
 	if ret > 0 {
-		C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+		copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 	}
 	return ret
 }
@@ -5305,14 +5350,14 @@ func callbackQLocalSocket_ReadData(ptr unsafe.Pointer, data C.struct_QtNetwork_P
 func (ptr *QLocalSocket) ConnectReadData(f func(data *string, c int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readData", f)
+		qt.ConnectSignal(ptr.Pointer(), "readData", f)
 	}
 }
 
 func (ptr *QLocalSocket) DisconnectReadData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readData")
+		qt.DisconnectSignal(ptr.Pointer(), "readData")
 	}
 }
 
@@ -5344,7 +5389,10 @@ func (ptr *QLocalSocket) ReadDataDefault(data *string, c int64) int64 {
 
 //export callbackQLocalSocket_WriteData
 func callbackQLocalSocket_WriteData(ptr unsafe.Pointer, data C.struct_QtNetwork_PackedString, c C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "writeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "writeDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "writeData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(c)))
 	}
 
@@ -5354,14 +5402,14 @@ func callbackQLocalSocket_WriteData(ptr unsafe.Pointer, data C.struct_QtNetwork_
 func (ptr *QLocalSocket) ConnectWriteData(f func(data string, c int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "writeData", f)
+		qt.ConnectSignal(ptr.Pointer(), "writeData", f)
 	}
 }
 
 func (ptr *QLocalSocket) DisconnectWriteData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "writeData")
+		qt.DisconnectSignal(ptr.Pointer(), "writeData")
 	}
 }
 
@@ -5391,7 +5439,7 @@ func (ptr *QLocalSocket) Abort() {
 
 //export callbackQLocalSocket_Close
 func callbackQLocalSocket_Close(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQLocalSocketFromPointer(ptr).CloseDefault()
@@ -5420,7 +5468,7 @@ func (ptr *QLocalSocket) ConnectToServer2(name string, openMode core.QIODevice__
 
 //export callbackQLocalSocket_Connected
 func callbackQLocalSocket_Connected(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connected"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5429,14 +5477,14 @@ func callbackQLocalSocket_Connected(ptr unsafe.Pointer) {
 func (ptr *QLocalSocket) ConnectConnected(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_ConnectConnected(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "connected", f)
+		qt.ConnectSignal(ptr.Pointer(), "connected", f)
 	}
 }
 
 func (ptr *QLocalSocket) DisconnectConnected() {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_DisconnectConnected(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "connected")
+		qt.DisconnectSignal(ptr.Pointer(), "connected")
 	}
 }
 
@@ -5454,7 +5502,7 @@ func (ptr *QLocalSocket) DisconnectFromServer() {
 
 //export callbackQLocalSocket_Disconnected
 func callbackQLocalSocket_Disconnected(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnected"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5463,14 +5511,14 @@ func callbackQLocalSocket_Disconnected(ptr unsafe.Pointer) {
 func (ptr *QLocalSocket) ConnectDisconnected(f func()) {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_ConnectDisconnected(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "disconnected", f)
+		qt.ConnectSignal(ptr.Pointer(), "disconnected", f)
 	}
 }
 
 func (ptr *QLocalSocket) DisconnectDisconnected() {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_DisconnectDisconnected(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "disconnected")
+		qt.DisconnectSignal(ptr.Pointer(), "disconnected")
 	}
 }
 
@@ -5482,7 +5530,7 @@ func (ptr *QLocalSocket) Disconnected() {
 
 //export callbackQLocalSocket_Error2
 func callbackQLocalSocket_Error2(ptr unsafe.Pointer, socketError C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "error2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "error2"); signal != nil {
 		signal.(func(QLocalSocket__LocalSocketError))(QLocalSocket__LocalSocketError(socketError))
 	}
 
@@ -5491,14 +5539,14 @@ func callbackQLocalSocket_Error2(ptr unsafe.Pointer, socketError C.longlong) {
 func (ptr *QLocalSocket) ConnectError2(f func(socketError QLocalSocket__LocalSocketError)) {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_ConnectError2(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "error2", f)
+		qt.ConnectSignal(ptr.Pointer(), "error2", f)
 	}
 }
 
 func (ptr *QLocalSocket) DisconnectError2() {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_DisconnectError2(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "error2")
+		qt.DisconnectSignal(ptr.Pointer(), "error2")
 	}
 }
 
@@ -5524,7 +5572,7 @@ func (ptr *QLocalSocket) SetServerName(name string) {
 
 //export callbackQLocalSocket_StateChanged
 func callbackQLocalSocket_StateChanged(ptr unsafe.Pointer, socketState C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stateChanged"); signal != nil {
 		signal.(func(QLocalSocket__LocalSocketState))(QLocalSocket__LocalSocketState(socketState))
 	}
 
@@ -5533,14 +5581,14 @@ func callbackQLocalSocket_StateChanged(ptr unsafe.Pointer, socketState C.longlon
 func (ptr *QLocalSocket) ConnectStateChanged(f func(socketState QLocalSocket__LocalSocketState)) {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_ConnectStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "stateChanged", f)
 	}
 }
 
 func (ptr *QLocalSocket) DisconnectStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_DisconnectStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "stateChanged")
 	}
 }
 
@@ -5553,7 +5601,7 @@ func (ptr *QLocalSocket) StateChanged(socketState QLocalSocket__LocalSocketState
 func (ptr *QLocalSocket) DestroyQLocalSocket() {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_DestroyQLocalSocket(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5588,7 +5636,7 @@ func (ptr *QLocalSocket) ServerName() string {
 
 //export callbackQLocalSocket_CanReadLine
 func callbackQLocalSocket_CanReadLine(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canReadLine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canReadLine"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5604,7 +5652,7 @@ func (ptr *QLocalSocket) CanReadLineDefault() bool {
 
 //export callbackQLocalSocket_IsSequential
 func callbackQLocalSocket_IsSequential(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isSequential"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isSequential"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5627,7 +5675,7 @@ func (ptr *QLocalSocket) IsValid() bool {
 
 //export callbackQLocalSocket_BytesAvailable
 func callbackQLocalSocket_BytesAvailable(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesAvailable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesAvailable"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -5643,7 +5691,7 @@ func (ptr *QLocalSocket) BytesAvailableDefault() int64 {
 
 //export callbackQLocalSocket_BytesToWrite
 func callbackQLocalSocket_BytesToWrite(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesToWrite"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesToWrite"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -5686,7 +5734,7 @@ func (ptr *QLocalSocket) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QLocalSocket) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QLocalSocket___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5707,7 +5755,7 @@ func (ptr *QLocalSocket) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QLocalSocket) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QLocalSocket___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5728,7 +5776,7 @@ func (ptr *QLocalSocket) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QLocalSocket) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QLocalSocket___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5749,7 +5797,7 @@ func (ptr *QLocalSocket) __findChildren_newList() unsafe.Pointer {
 func (ptr *QLocalSocket) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QLocalSocket___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5769,7 +5817,7 @@ func (ptr *QLocalSocket) __children_newList() unsafe.Pointer {
 
 //export callbackQLocalSocket_Reset
 func callbackQLocalSocket_Reset(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5785,7 +5833,7 @@ func (ptr *QLocalSocket) ResetDefault() bool {
 
 //export callbackQLocalSocket_Seek
 func callbackQLocalSocket_Seek(ptr unsafe.Pointer, pos C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seek"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seek"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int64) bool)(int64(pos)))))
 	}
 
@@ -5801,7 +5849,7 @@ func (ptr *QLocalSocket) SeekDefault(pos int64) bool {
 
 //export callbackQLocalSocket_ReadLineData
 func callbackQLocalSocket_ReadLineData(ptr unsafe.Pointer, data C.struct_QtNetwork_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readLineData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readLineData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(maxSize)))
 	}
 
@@ -5819,7 +5867,7 @@ func (ptr *QLocalSocket) ReadLineDataDefault(data string, maxSize int64) int64 {
 
 //export callbackQLocalSocket_AboutToClose
 func callbackQLocalSocket_AboutToClose(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aboutToClose"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aboutToClose"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5827,7 +5875,7 @@ func callbackQLocalSocket_AboutToClose(ptr unsafe.Pointer) {
 
 //export callbackQLocalSocket_BytesWritten
 func callbackQLocalSocket_BytesWritten(ptr unsafe.Pointer, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesWritten"); signal != nil {
 		signal.(func(int64))(int64(bytes))
 	}
 
@@ -5835,7 +5883,7 @@ func callbackQLocalSocket_BytesWritten(ptr unsafe.Pointer, bytes C.longlong) {
 
 //export callbackQLocalSocket_ChannelBytesWritten
 func callbackQLocalSocket_ChannelBytesWritten(ptr unsafe.Pointer, channel C.int, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelBytesWritten"); signal != nil {
 		signal.(func(int, int64))(int(int32(channel)), int64(bytes))
 	}
 
@@ -5843,7 +5891,7 @@ func callbackQLocalSocket_ChannelBytesWritten(ptr unsafe.Pointer, channel C.int,
 
 //export callbackQLocalSocket_ChannelReadyRead
 func callbackQLocalSocket_ChannelReadyRead(ptr unsafe.Pointer, channel C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelReadyRead"); signal != nil {
 		signal.(func(int))(int(int32(channel)))
 	}
 
@@ -5851,7 +5899,7 @@ func callbackQLocalSocket_ChannelReadyRead(ptr unsafe.Pointer, channel C.int) {
 
 //export callbackQLocalSocket_ReadChannelFinished
 func callbackQLocalSocket_ReadChannelFinished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readChannelFinished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readChannelFinished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5859,7 +5907,7 @@ func callbackQLocalSocket_ReadChannelFinished(ptr unsafe.Pointer) {
 
 //export callbackQLocalSocket_ReadyRead
 func callbackQLocalSocket_ReadyRead(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readyRead"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5867,7 +5915,7 @@ func callbackQLocalSocket_ReadyRead(ptr unsafe.Pointer) {
 
 //export callbackQLocalSocket_AtEnd
 func callbackQLocalSocket_AtEnd(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "atEnd"); signal != nil {
+	if signal := qt.GetSignal(ptr, "atEnd"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5883,7 +5931,7 @@ func (ptr *QLocalSocket) AtEndDefault() bool {
 
 //export callbackQLocalSocket_Pos
 func callbackQLocalSocket_Pos(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pos"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pos"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -5899,7 +5947,7 @@ func (ptr *QLocalSocket) PosDefault() int64 {
 
 //export callbackQLocalSocket_Size
 func callbackQLocalSocket_Size(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -5915,7 +5963,7 @@ func (ptr *QLocalSocket) SizeDefault() int64 {
 
 //export callbackQLocalSocket_Event
 func callbackQLocalSocket_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -5931,7 +5979,7 @@ func (ptr *QLocalSocket) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQLocalSocket_EventFilter
 func callbackQLocalSocket_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -5947,7 +5995,7 @@ func (ptr *QLocalSocket) EventFilterDefault(watched core.QObject_ITF, event core
 
 //export callbackQLocalSocket_ChildEvent
 func callbackQLocalSocket_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQLocalSocketFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -5962,7 +6010,7 @@ func (ptr *QLocalSocket) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQLocalSocket_ConnectNotify
 func callbackQLocalSocket_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQLocalSocketFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5977,7 +6025,7 @@ func (ptr *QLocalSocket) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQLocalSocket_CustomEvent
 func callbackQLocalSocket_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQLocalSocketFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -5992,7 +6040,7 @@ func (ptr *QLocalSocket) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQLocalSocket_DeleteLater
 func callbackQLocalSocket_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQLocalSocketFromPointer(ptr).DeleteLaterDefault()
@@ -6002,14 +6050,14 @@ func callbackQLocalSocket_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QLocalSocket) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QLocalSocket_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQLocalSocket_Destroyed
 func callbackQLocalSocket_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -6017,7 +6065,7 @@ func callbackQLocalSocket_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQLocalSocket_DisconnectNotify
 func callbackQLocalSocket_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQLocalSocketFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6032,7 +6080,7 @@ func (ptr *QLocalSocket) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQLocalSocket_ObjectNameChanged
 func callbackQLocalSocket_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -6040,7 +6088,7 @@ func callbackQLocalSocket_ObjectNameChanged(ptr unsafe.Pointer, objectName C.str
 
 //export callbackQLocalSocket_TimerEvent
 func callbackQLocalSocket_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQLocalSocketFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -6055,7 +6103,7 @@ func (ptr *QLocalSocket) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQLocalSocket_MetaObject
 func callbackQLocalSocket_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -6134,7 +6182,7 @@ const (
 
 func NewQNetworkAccessManager(parent core.QObject_ITF) *QNetworkAccessManager {
 	var tmpValue = NewQNetworkAccessManagerFromPointer(C.QNetworkAccessManager_NewQNetworkAccessManager(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -6142,7 +6190,7 @@ func NewQNetworkAccessManager(parent core.QObject_ITF) *QNetworkAccessManager {
 
 //export callbackQNetworkAccessManager_CreateRequest
 func callbackQNetworkAccessManager_CreateRequest(ptr unsafe.Pointer, op C.longlong, req unsafe.Pointer, outgoingData unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createRequest"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createRequest"); signal != nil {
 		return PointerFromQNetworkReply(signal.(func(QNetworkAccessManager__Operation, *QNetworkRequest, *core.QIODevice) *QNetworkReply)(QNetworkAccessManager__Operation(op), NewQNetworkRequestFromPointer(req), core.NewQIODeviceFromPointer(outgoingData)))
 	}
 
@@ -6152,21 +6200,21 @@ func callbackQNetworkAccessManager_CreateRequest(ptr unsafe.Pointer, op C.longlo
 func (ptr *QNetworkAccessManager) ConnectCreateRequest(f func(op QNetworkAccessManager__Operation, req *QNetworkRequest, outgoingData *core.QIODevice) *QNetworkReply) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createRequest", f)
+		qt.ConnectSignal(ptr.Pointer(), "createRequest", f)
 	}
 }
 
 func (ptr *QNetworkAccessManager) DisconnectCreateRequest() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createRequest")
+		qt.DisconnectSignal(ptr.Pointer(), "createRequest")
 	}
 }
 
 func (ptr *QNetworkAccessManager) CreateRequest(op QNetworkAccessManager__Operation, req QNetworkRequest_ITF, outgoingData core.QIODevice_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_CreateRequest(ptr.Pointer(), C.longlong(op), PointerFromQNetworkRequest(req), core.PointerFromQIODevice(outgoingData)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6177,7 +6225,7 @@ func (ptr *QNetworkAccessManager) CreateRequest(op QNetworkAccessManager__Operat
 func (ptr *QNetworkAccessManager) CreateRequestDefault(op QNetworkAccessManager__Operation, req QNetworkRequest_ITF, outgoingData core.QIODevice_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_CreateRequestDefault(ptr.Pointer(), C.longlong(op), PointerFromQNetworkRequest(req), core.PointerFromQIODevice(outgoingData)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6188,7 +6236,7 @@ func (ptr *QNetworkAccessManager) CreateRequestDefault(op QNetworkAccessManager_
 func (ptr *QNetworkAccessManager) DeleteResource(request QNetworkRequest_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_DeleteResource(ptr.Pointer(), PointerFromQNetworkRequest(request)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6199,7 +6247,7 @@ func (ptr *QNetworkAccessManager) DeleteResource(request QNetworkRequest_ITF) *Q
 func (ptr *QNetworkAccessManager) Get(request QNetworkRequest_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_Get(ptr.Pointer(), PointerFromQNetworkRequest(request)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6210,7 +6258,7 @@ func (ptr *QNetworkAccessManager) Get(request QNetworkRequest_ITF) *QNetworkRepl
 func (ptr *QNetworkAccessManager) Head(request QNetworkRequest_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_Head(ptr.Pointer(), PointerFromQNetworkRequest(request)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6221,7 +6269,7 @@ func (ptr *QNetworkAccessManager) Head(request QNetworkRequest_ITF) *QNetworkRep
 func (ptr *QNetworkAccessManager) Post3(request QNetworkRequest_ITF, multiPart QHttpMultiPart_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_Post3(ptr.Pointer(), PointerFromQNetworkRequest(request), PointerFromQHttpMultiPart(multiPart)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6232,7 +6280,7 @@ func (ptr *QNetworkAccessManager) Post3(request QNetworkRequest_ITF, multiPart Q
 func (ptr *QNetworkAccessManager) Post(request QNetworkRequest_ITF, data core.QIODevice_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_Post(ptr.Pointer(), PointerFromQNetworkRequest(request), core.PointerFromQIODevice(data)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6243,7 +6291,7 @@ func (ptr *QNetworkAccessManager) Post(request QNetworkRequest_ITF, data core.QI
 func (ptr *QNetworkAccessManager) Post2(request QNetworkRequest_ITF, data core.QByteArray_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_Post2(ptr.Pointer(), PointerFromQNetworkRequest(request), core.PointerFromQByteArray(data)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6254,7 +6302,7 @@ func (ptr *QNetworkAccessManager) Post2(request QNetworkRequest_ITF, data core.Q
 func (ptr *QNetworkAccessManager) Put3(request QNetworkRequest_ITF, multiPart QHttpMultiPart_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_Put3(ptr.Pointer(), PointerFromQNetworkRequest(request), PointerFromQHttpMultiPart(multiPart)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6265,7 +6313,7 @@ func (ptr *QNetworkAccessManager) Put3(request QNetworkRequest_ITF, multiPart QH
 func (ptr *QNetworkAccessManager) Put(request QNetworkRequest_ITF, data core.QIODevice_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_Put(ptr.Pointer(), PointerFromQNetworkRequest(request), core.PointerFromQIODevice(data)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6276,7 +6324,7 @@ func (ptr *QNetworkAccessManager) Put(request QNetworkRequest_ITF, data core.QIO
 func (ptr *QNetworkAccessManager) Put2(request QNetworkRequest_ITF, data core.QByteArray_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_Put2(ptr.Pointer(), PointerFromQNetworkRequest(request), core.PointerFromQByteArray(data)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6287,7 +6335,7 @@ func (ptr *QNetworkAccessManager) Put2(request QNetworkRequest_ITF, data core.QB
 func (ptr *QNetworkAccessManager) SendCustomRequest3(request QNetworkRequest_ITF, verb core.QByteArray_ITF, multiPart QHttpMultiPart_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_SendCustomRequest3(ptr.Pointer(), PointerFromQNetworkRequest(request), core.PointerFromQByteArray(verb), PointerFromQHttpMultiPart(multiPart)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6298,7 +6346,7 @@ func (ptr *QNetworkAccessManager) SendCustomRequest3(request QNetworkRequest_ITF
 func (ptr *QNetworkAccessManager) SendCustomRequest(request QNetworkRequest_ITF, verb core.QByteArray_ITF, data core.QIODevice_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_SendCustomRequest(ptr.Pointer(), PointerFromQNetworkRequest(request), core.PointerFromQByteArray(verb), core.PointerFromQIODevice(data)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6309,7 +6357,7 @@ func (ptr *QNetworkAccessManager) SendCustomRequest(request QNetworkRequest_ITF,
 func (ptr *QNetworkAccessManager) SendCustomRequest2(request QNetworkRequest_ITF, verb core.QByteArray_ITF, data core.QByteArray_ITF) *QNetworkReply {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkAccessManager_SendCustomRequest2(ptr.Pointer(), PointerFromQNetworkRequest(request), core.PointerFromQByteArray(verb), core.PointerFromQByteArray(data)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6319,7 +6367,7 @@ func (ptr *QNetworkAccessManager) SendCustomRequest2(request QNetworkRequest_ITF
 
 //export callbackQNetworkAccessManager_AuthenticationRequired
 func callbackQNetworkAccessManager_AuthenticationRequired(ptr unsafe.Pointer, reply unsafe.Pointer, authenticator unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "authenticationRequired"); signal != nil {
+	if signal := qt.GetSignal(ptr, "authenticationRequired"); signal != nil {
 		signal.(func(*QNetworkReply, *QAuthenticator))(NewQNetworkReplyFromPointer(reply), NewQAuthenticatorFromPointer(authenticator))
 	}
 
@@ -6328,14 +6376,14 @@ func callbackQNetworkAccessManager_AuthenticationRequired(ptr unsafe.Pointer, re
 func (ptr *QNetworkAccessManager) ConnectAuthenticationRequired(f func(reply *QNetworkReply, authenticator *QAuthenticator)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_ConnectAuthenticationRequired(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "authenticationRequired", f)
+		qt.ConnectSignal(ptr.Pointer(), "authenticationRequired", f)
 	}
 }
 
 func (ptr *QNetworkAccessManager) DisconnectAuthenticationRequired() {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_DisconnectAuthenticationRequired(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "authenticationRequired")
+		qt.DisconnectSignal(ptr.Pointer(), "authenticationRequired")
 	}
 }
 
@@ -6369,7 +6417,7 @@ func (ptr *QNetworkAccessManager) ConnectToHostEncrypted(hostName string, port u
 
 //export callbackQNetworkAccessManager_Encrypted
 func callbackQNetworkAccessManager_Encrypted(ptr unsafe.Pointer, reply unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "encrypted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "encrypted"); signal != nil {
 		signal.(func(*QNetworkReply))(NewQNetworkReplyFromPointer(reply))
 	}
 
@@ -6378,14 +6426,14 @@ func callbackQNetworkAccessManager_Encrypted(ptr unsafe.Pointer, reply unsafe.Po
 func (ptr *QNetworkAccessManager) ConnectEncrypted(f func(reply *QNetworkReply)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_ConnectEncrypted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "encrypted", f)
+		qt.ConnectSignal(ptr.Pointer(), "encrypted", f)
 	}
 }
 
 func (ptr *QNetworkAccessManager) DisconnectEncrypted() {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_DisconnectEncrypted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "encrypted")
+		qt.DisconnectSignal(ptr.Pointer(), "encrypted")
 	}
 }
 
@@ -6397,7 +6445,7 @@ func (ptr *QNetworkAccessManager) Encrypted(reply QNetworkReply_ITF) {
 
 //export callbackQNetworkAccessManager_Finished
 func callbackQNetworkAccessManager_Finished(ptr unsafe.Pointer, reply unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func(*QNetworkReply))(NewQNetworkReplyFromPointer(reply))
 	}
 
@@ -6406,14 +6454,14 @@ func callbackQNetworkAccessManager_Finished(ptr unsafe.Pointer, reply unsafe.Poi
 func (ptr *QNetworkAccessManager) ConnectFinished(f func(reply *QNetworkReply)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QNetworkAccessManager) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
@@ -6425,7 +6473,7 @@ func (ptr *QNetworkAccessManager) Finished(reply QNetworkReply_ITF) {
 
 //export callbackQNetworkAccessManager_NetworkAccessibleChanged
 func callbackQNetworkAccessManager_NetworkAccessibleChanged(ptr unsafe.Pointer, accessible C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "networkAccessibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "networkAccessibleChanged"); signal != nil {
 		signal.(func(QNetworkAccessManager__NetworkAccessibility))(QNetworkAccessManager__NetworkAccessibility(accessible))
 	}
 
@@ -6434,14 +6482,14 @@ func callbackQNetworkAccessManager_NetworkAccessibleChanged(ptr unsafe.Pointer,
 func (ptr *QNetworkAccessManager) ConnectNetworkAccessibleChanged(f func(accessible QNetworkAccessManager__NetworkAccessibility)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_ConnectNetworkAccessibleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "networkAccessibleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "networkAccessibleChanged", f)
 	}
 }
 
 func (ptr *QNetworkAccessManager) DisconnectNetworkAccessibleChanged() {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_DisconnectNetworkAccessibleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "networkAccessibleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "networkAccessibleChanged")
 	}
 }
 
@@ -6453,7 +6501,7 @@ func (ptr *QNetworkAccessManager) NetworkAccessibleChanged(accessible QNetworkAc
 
 //export callbackQNetworkAccessManager_PreSharedKeyAuthenticationRequired
 func callbackQNetworkAccessManager_PreSharedKeyAuthenticationRequired(ptr unsafe.Pointer, reply unsafe.Pointer, authenticator unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "preSharedKeyAuthenticationRequired"); signal != nil {
+	if signal := qt.GetSignal(ptr, "preSharedKeyAuthenticationRequired"); signal != nil {
 		signal.(func(*QNetworkReply, *QSslPreSharedKeyAuthenticator))(NewQNetworkReplyFromPointer(reply), NewQSslPreSharedKeyAuthenticatorFromPointer(authenticator))
 	}
 
@@ -6462,14 +6510,14 @@ func callbackQNetworkAccessManager_PreSharedKeyAuthenticationRequired(ptr unsafe
 func (ptr *QNetworkAccessManager) ConnectPreSharedKeyAuthenticationRequired(f func(reply *QNetworkReply, authenticator *QSslPreSharedKeyAuthenticator)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_ConnectPreSharedKeyAuthenticationRequired(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "preSharedKeyAuthenticationRequired", f)
+		qt.ConnectSignal(ptr.Pointer(), "preSharedKeyAuthenticationRequired", f)
 	}
 }
 
 func (ptr *QNetworkAccessManager) DisconnectPreSharedKeyAuthenticationRequired() {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_DisconnectPreSharedKeyAuthenticationRequired(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "preSharedKeyAuthenticationRequired")
+		qt.DisconnectSignal(ptr.Pointer(), "preSharedKeyAuthenticationRequired")
 	}
 }
 
@@ -6481,7 +6529,7 @@ func (ptr *QNetworkAccessManager) PreSharedKeyAuthenticationRequired(reply QNetw
 
 //export callbackQNetworkAccessManager_ProxyAuthenticationRequired
 func callbackQNetworkAccessManager_ProxyAuthenticationRequired(ptr unsafe.Pointer, proxy unsafe.Pointer, authenticator unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "proxyAuthenticationRequired"); signal != nil {
+	if signal := qt.GetSignal(ptr, "proxyAuthenticationRequired"); signal != nil {
 		signal.(func(*QNetworkProxy, *QAuthenticator))(NewQNetworkProxyFromPointer(proxy), NewQAuthenticatorFromPointer(authenticator))
 	}
 
@@ -6490,14 +6538,14 @@ func callbackQNetworkAccessManager_ProxyAuthenticationRequired(ptr unsafe.Pointe
 func (ptr *QNetworkAccessManager) ConnectProxyAuthenticationRequired(f func(proxy *QNetworkProxy, authenticator *QAuthenticator)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_ConnectProxyAuthenticationRequired(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "proxyAuthenticationRequired", f)
+		qt.ConnectSignal(ptr.Pointer(), "proxyAuthenticationRequired", f)
 	}
 }
 
 func (ptr *QNetworkAccessManager) DisconnectProxyAuthenticationRequired() {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_DisconnectProxyAuthenticationRequired(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "proxyAuthenticationRequired")
+		qt.DisconnectSignal(ptr.Pointer(), "proxyAuthenticationRequired")
 	}
 }
 
@@ -6545,7 +6593,7 @@ func (ptr *QNetworkAccessManager) SetProxyFactory(factory QNetworkProxyFactory_I
 
 //export callbackQNetworkAccessManager_SslErrors
 func callbackQNetworkAccessManager_SslErrors(ptr unsafe.Pointer, reply unsafe.Pointer, errors C.struct_QtNetwork_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sslErrors"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sslErrors"); signal != nil {
 		signal.(func(*QNetworkReply, []*QSslError))(NewQNetworkReplyFromPointer(reply), func(l C.struct_QtNetwork_PackedList) []*QSslError {
 			var out = make([]*QSslError, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -6560,14 +6608,14 @@ func callbackQNetworkAccessManager_SslErrors(ptr unsafe.Pointer, reply unsafe.Po
 func (ptr *QNetworkAccessManager) ConnectSslErrors(f func(reply *QNetworkReply, errors []*QSslError)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_ConnectSslErrors(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sslErrors", f)
+		qt.ConnectSignal(ptr.Pointer(), "sslErrors", f)
 	}
 }
 
 func (ptr *QNetworkAccessManager) DisconnectSslErrors() {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_DisconnectSslErrors(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sslErrors")
+		qt.DisconnectSignal(ptr.Pointer(), "sslErrors")
 	}
 }
 
@@ -6586,7 +6634,7 @@ func (ptr *QNetworkAccessManager) SslErrors(reply QNetworkReply_ITF, errors []*Q
 func (ptr *QNetworkAccessManager) DestroyQNetworkAccessManager() {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_DestroyQNetworkAccessManager(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6601,7 +6649,7 @@ func (ptr *QNetworkAccessManager) NetworkAccessible() QNetworkAccessManager__Net
 func (ptr *QNetworkAccessManager) Cache() *QAbstractNetworkCache {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAbstractNetworkCacheFromPointer(C.QNetworkAccessManager_Cache(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6630,7 +6678,7 @@ func (ptr *QNetworkAccessManager) Configuration() *QNetworkConfiguration {
 func (ptr *QNetworkAccessManager) CookieJar() *QNetworkCookieJar {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkCookieJarFromPointer(C.QNetworkAccessManager_CookieJar(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6656,44 +6704,44 @@ func (ptr *QNetworkAccessManager) ProxyFactory() *QNetworkProxyFactory {
 
 func (ptr *QNetworkAccessManager) SupportedSchemes() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QNetworkAccessManager_SupportedSchemes(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QNetworkAccessManager_SupportedSchemes(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQNetworkAccessManager_SupportedSchemesImplementation
 func callbackQNetworkAccessManager_SupportedSchemesImplementation(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedSchemesImplementation"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "supportedSchemesImplementation"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(NewQNetworkAccessManagerFromPointer(ptr).SupportedSchemesImplementationDefault(), "|"))
+	return cGoPackStringList(NewQNetworkAccessManagerFromPointer(ptr).SupportedSchemesImplementationDefault())
 }
 
 func (ptr *QNetworkAccessManager) ConnectSupportedSchemesImplementation(f func() []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "supportedSchemesImplementation", f)
+		qt.ConnectSignal(ptr.Pointer(), "supportedSchemesImplementation", f)
 	}
 }
 
 func (ptr *QNetworkAccessManager) DisconnectSupportedSchemesImplementation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "supportedSchemesImplementation")
+		qt.DisconnectSignal(ptr.Pointer(), "supportedSchemesImplementation")
 	}
 }
 
 func (ptr *QNetworkAccessManager) SupportedSchemesImplementation() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QNetworkAccessManager_SupportedSchemesImplementation(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QNetworkAccessManager_SupportedSchemesImplementation(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QNetworkAccessManager) SupportedSchemesImplementationDefault() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QNetworkAccessManager_SupportedSchemesImplementationDefault(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QNetworkAccessManager_SupportedSchemesImplementationDefault(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -6739,7 +6787,7 @@ func (ptr *QNetworkAccessManager) __dynamicPropertyNames_newList() unsafe.Pointe
 func (ptr *QNetworkAccessManager) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkAccessManager___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6760,7 +6808,7 @@ func (ptr *QNetworkAccessManager) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QNetworkAccessManager) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkAccessManager___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6781,7 +6829,7 @@ func (ptr *QNetworkAccessManager) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QNetworkAccessManager) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkAccessManager___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6802,7 +6850,7 @@ func (ptr *QNetworkAccessManager) __findChildren_newList() unsafe.Pointer {
 func (ptr *QNetworkAccessManager) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkAccessManager___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6822,7 +6870,7 @@ func (ptr *QNetworkAccessManager) __children_newList() unsafe.Pointer {
 
 //export callbackQNetworkAccessManager_Event
 func callbackQNetworkAccessManager_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -6838,7 +6886,7 @@ func (ptr *QNetworkAccessManager) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQNetworkAccessManager_EventFilter
 func callbackQNetworkAccessManager_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -6854,7 +6902,7 @@ func (ptr *QNetworkAccessManager) EventFilterDefault(watched core.QObject_ITF, e
 
 //export callbackQNetworkAccessManager_ChildEvent
 func callbackQNetworkAccessManager_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQNetworkAccessManagerFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -6869,7 +6917,7 @@ func (ptr *QNetworkAccessManager) ChildEventDefault(event core.QChildEvent_ITF)
 
 //export callbackQNetworkAccessManager_ConnectNotify
 func callbackQNetworkAccessManager_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkAccessManagerFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6884,7 +6932,7 @@ func (ptr *QNetworkAccessManager) ConnectNotifyDefault(sign core.QMetaMethod_ITF
 
 //export callbackQNetworkAccessManager_CustomEvent
 func callbackQNetworkAccessManager_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQNetworkAccessManagerFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -6899,7 +6947,7 @@ func (ptr *QNetworkAccessManager) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQNetworkAccessManager_DeleteLater
 func callbackQNetworkAccessManager_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkAccessManagerFromPointer(ptr).DeleteLaterDefault()
@@ -6909,14 +6957,14 @@ func callbackQNetworkAccessManager_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QNetworkAccessManager) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QNetworkAccessManager_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQNetworkAccessManager_Destroyed
 func callbackQNetworkAccessManager_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -6924,7 +6972,7 @@ func callbackQNetworkAccessManager_Destroyed(ptr unsafe.Pointer, obj unsafe.Poin
 
 //export callbackQNetworkAccessManager_DisconnectNotify
 func callbackQNetworkAccessManager_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkAccessManagerFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6939,7 +6987,7 @@ func (ptr *QNetworkAccessManager) DisconnectNotifyDefault(sign core.QMetaMethod_
 
 //export callbackQNetworkAccessManager_ObjectNameChanged
 func callbackQNetworkAccessManager_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -6947,7 +6995,7 @@ func callbackQNetworkAccessManager_ObjectNameChanged(ptr unsafe.Pointer, objectN
 
 //export callbackQNetworkAccessManager_TimerEvent
 func callbackQNetworkAccessManager_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQNetworkAccessManagerFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -6962,7 +7010,7 @@ func (ptr *QNetworkAccessManager) TimerEventDefault(event core.QTimerEvent_ITF)
 
 //export callbackQNetworkAccessManager_MetaObject
 func callbackQNetworkAccessManager_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -7496,7 +7544,7 @@ const (
 
 func NewQNetworkConfigurationManager(parent core.QObject_ITF) *QNetworkConfigurationManager {
 	var tmpValue = NewQNetworkConfigurationManagerFromPointer(C.QNetworkConfigurationManager_NewQNetworkConfigurationManager(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -7504,7 +7552,7 @@ func NewQNetworkConfigurationManager(parent core.QObject_ITF) *QNetworkConfigura
 
 //export callbackQNetworkConfigurationManager_ConfigurationAdded
 func callbackQNetworkConfigurationManager_ConfigurationAdded(ptr unsafe.Pointer, config unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "configurationAdded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "configurationAdded"); signal != nil {
 		signal.(func(*QNetworkConfiguration))(NewQNetworkConfigurationFromPointer(config))
 	}
 
@@ -7513,14 +7561,14 @@ func callbackQNetworkConfigurationManager_ConfigurationAdded(ptr unsafe.Pointer,
 func (ptr *QNetworkConfigurationManager) ConnectConfigurationAdded(f func(config *QNetworkConfiguration)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_ConnectConfigurationAdded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "configurationAdded", f)
+		qt.ConnectSignal(ptr.Pointer(), "configurationAdded", f)
 	}
 }
 
 func (ptr *QNetworkConfigurationManager) DisconnectConfigurationAdded() {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_DisconnectConfigurationAdded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "configurationAdded")
+		qt.DisconnectSignal(ptr.Pointer(), "configurationAdded")
 	}
 }
 
@@ -7532,7 +7580,7 @@ func (ptr *QNetworkConfigurationManager) ConfigurationAdded(config QNetworkConfi
 
 //export callbackQNetworkConfigurationManager_ConfigurationChanged
 func callbackQNetworkConfigurationManager_ConfigurationChanged(ptr unsafe.Pointer, config unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "configurationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "configurationChanged"); signal != nil {
 		signal.(func(*QNetworkConfiguration))(NewQNetworkConfigurationFromPointer(config))
 	}
 
@@ -7541,14 +7589,14 @@ func callbackQNetworkConfigurationManager_ConfigurationChanged(ptr unsafe.Pointe
 func (ptr *QNetworkConfigurationManager) ConnectConfigurationChanged(f func(config *QNetworkConfiguration)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_ConnectConfigurationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "configurationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "configurationChanged", f)
 	}
 }
 
 func (ptr *QNetworkConfigurationManager) DisconnectConfigurationChanged() {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_DisconnectConfigurationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "configurationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "configurationChanged")
 	}
 }
 
@@ -7560,7 +7608,7 @@ func (ptr *QNetworkConfigurationManager) ConfigurationChanged(config QNetworkCon
 
 //export callbackQNetworkConfigurationManager_ConfigurationRemoved
 func callbackQNetworkConfigurationManager_ConfigurationRemoved(ptr unsafe.Pointer, config unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "configurationRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "configurationRemoved"); signal != nil {
 		signal.(func(*QNetworkConfiguration))(NewQNetworkConfigurationFromPointer(config))
 	}
 
@@ -7569,14 +7617,14 @@ func callbackQNetworkConfigurationManager_ConfigurationRemoved(ptr unsafe.Pointe
 func (ptr *QNetworkConfigurationManager) ConnectConfigurationRemoved(f func(config *QNetworkConfiguration)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_ConnectConfigurationRemoved(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "configurationRemoved", f)
+		qt.ConnectSignal(ptr.Pointer(), "configurationRemoved", f)
 	}
 }
 
 func (ptr *QNetworkConfigurationManager) DisconnectConfigurationRemoved() {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_DisconnectConfigurationRemoved(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "configurationRemoved")
+		qt.DisconnectSignal(ptr.Pointer(), "configurationRemoved")
 	}
 }
 
@@ -7588,7 +7636,7 @@ func (ptr *QNetworkConfigurationManager) ConfigurationRemoved(config QNetworkCon
 
 //export callbackQNetworkConfigurationManager_OnlineStateChanged
 func callbackQNetworkConfigurationManager_OnlineStateChanged(ptr unsafe.Pointer, isOnline C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "onlineStateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "onlineStateChanged"); signal != nil {
 		signal.(func(bool))(int8(isOnline) != 0)
 	}
 
@@ -7597,14 +7645,14 @@ func callbackQNetworkConfigurationManager_OnlineStateChanged(ptr unsafe.Pointer,
 func (ptr *QNetworkConfigurationManager) ConnectOnlineStateChanged(f func(isOnline bool)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_ConnectOnlineStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "onlineStateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "onlineStateChanged", f)
 	}
 }
 
 func (ptr *QNetworkConfigurationManager) DisconnectOnlineStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_DisconnectOnlineStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "onlineStateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "onlineStateChanged")
 	}
 }
 
@@ -7616,7 +7664,7 @@ func (ptr *QNetworkConfigurationManager) OnlineStateChanged(isOnline bool) {
 
 //export callbackQNetworkConfigurationManager_UpdateCompleted
 func callbackQNetworkConfigurationManager_UpdateCompleted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateCompleted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateCompleted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7625,14 +7673,14 @@ func callbackQNetworkConfigurationManager_UpdateCompleted(ptr unsafe.Pointer) {
 func (ptr *QNetworkConfigurationManager) ConnectUpdateCompleted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_ConnectUpdateCompleted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateCompleted", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateCompleted", f)
 	}
 }
 
 func (ptr *QNetworkConfigurationManager) DisconnectUpdateCompleted() {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_DisconnectUpdateCompleted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateCompleted")
+		qt.DisconnectSignal(ptr.Pointer(), "updateCompleted")
 	}
 }
 
@@ -7644,7 +7692,7 @@ func (ptr *QNetworkConfigurationManager) UpdateCompleted() {
 
 //export callbackQNetworkConfigurationManager_UpdateConfigurations
 func callbackQNetworkConfigurationManager_UpdateConfigurations(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateConfigurations"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateConfigurations"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkConfigurationManagerFromPointer(ptr).UpdateConfigurationsDefault()
@@ -7654,14 +7702,14 @@ func callbackQNetworkConfigurationManager_UpdateConfigurations(ptr unsafe.Pointe
 func (ptr *QNetworkConfigurationManager) ConnectUpdateConfigurations(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateConfigurations", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateConfigurations", f)
 	}
 }
 
 func (ptr *QNetworkConfigurationManager) DisconnectUpdateConfigurations() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateConfigurations")
+		qt.DisconnectSignal(ptr.Pointer(), "updateConfigurations")
 	}
 }
 
@@ -7679,7 +7727,7 @@ func (ptr *QNetworkConfigurationManager) UpdateConfigurationsDefault() {
 
 //export callbackQNetworkConfigurationManager_DestroyQNetworkConfigurationManager
 func callbackQNetworkConfigurationManager_DestroyQNetworkConfigurationManager(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QNetworkConfigurationManager"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QNetworkConfigurationManager"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkConfigurationManagerFromPointer(ptr).DestroyQNetworkConfigurationManagerDefault()
@@ -7689,21 +7737,21 @@ func callbackQNetworkConfigurationManager_DestroyQNetworkConfigurationManager(pt
 func (ptr *QNetworkConfigurationManager) ConnectDestroyQNetworkConfigurationManager(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QNetworkConfigurationManager", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QNetworkConfigurationManager", f)
 	}
 }
 
 func (ptr *QNetworkConfigurationManager) DisconnectDestroyQNetworkConfigurationManager() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QNetworkConfigurationManager")
+		qt.DisconnectSignal(ptr.Pointer(), "~QNetworkConfigurationManager")
 	}
 }
 
 func (ptr *QNetworkConfigurationManager) DestroyQNetworkConfigurationManager() {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_DestroyQNetworkConfigurationManager(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7711,7 +7759,7 @@ func (ptr *QNetworkConfigurationManager) DestroyQNetworkConfigurationManager() {
 func (ptr *QNetworkConfigurationManager) DestroyQNetworkConfigurationManagerDefault() {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_DestroyQNetworkConfigurationManagerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7804,7 +7852,7 @@ func (ptr *QNetworkConfigurationManager) __dynamicPropertyNames_newList() unsafe
 func (ptr *QNetworkConfigurationManager) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkConfigurationManager___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7825,7 +7873,7 @@ func (ptr *QNetworkConfigurationManager) __findChildren_newList2() unsafe.Pointe
 func (ptr *QNetworkConfigurationManager) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkConfigurationManager___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7846,7 +7894,7 @@ func (ptr *QNetworkConfigurationManager) __findChildren_newList3() unsafe.Pointe
 func (ptr *QNetworkConfigurationManager) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkConfigurationManager___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7867,7 +7915,7 @@ func (ptr *QNetworkConfigurationManager) __findChildren_newList() unsafe.Pointer
 func (ptr *QNetworkConfigurationManager) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkConfigurationManager___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7887,7 +7935,7 @@ func (ptr *QNetworkConfigurationManager) __children_newList() unsafe.Pointer {
 
 //export callbackQNetworkConfigurationManager_Event
 func callbackQNetworkConfigurationManager_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -7903,7 +7951,7 @@ func (ptr *QNetworkConfigurationManager) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQNetworkConfigurationManager_EventFilter
 func callbackQNetworkConfigurationManager_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -7919,7 +7967,7 @@ func (ptr *QNetworkConfigurationManager) EventFilterDefault(watched core.QObject
 
 //export callbackQNetworkConfigurationManager_ChildEvent
 func callbackQNetworkConfigurationManager_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQNetworkConfigurationManagerFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -7934,7 +7982,7 @@ func (ptr *QNetworkConfigurationManager) ChildEventDefault(event core.QChildEven
 
 //export callbackQNetworkConfigurationManager_ConnectNotify
 func callbackQNetworkConfigurationManager_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkConfigurationManagerFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7949,7 +7997,7 @@ func (ptr *QNetworkConfigurationManager) ConnectNotifyDefault(sign core.QMetaMet
 
 //export callbackQNetworkConfigurationManager_CustomEvent
 func callbackQNetworkConfigurationManager_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQNetworkConfigurationManagerFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -7964,7 +8012,7 @@ func (ptr *QNetworkConfigurationManager) CustomEventDefault(event core.QEvent_IT
 
 //export callbackQNetworkConfigurationManager_DeleteLater
 func callbackQNetworkConfigurationManager_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkConfigurationManagerFromPointer(ptr).DeleteLaterDefault()
@@ -7974,14 +8022,14 @@ func callbackQNetworkConfigurationManager_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QNetworkConfigurationManager) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QNetworkConfigurationManager_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQNetworkConfigurationManager_Destroyed
 func callbackQNetworkConfigurationManager_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -7989,7 +8037,7 @@ func callbackQNetworkConfigurationManager_Destroyed(ptr unsafe.Pointer, obj unsa
 
 //export callbackQNetworkConfigurationManager_DisconnectNotify
 func callbackQNetworkConfigurationManager_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkConfigurationManagerFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -8004,7 +8052,7 @@ func (ptr *QNetworkConfigurationManager) DisconnectNotifyDefault(sign core.QMeta
 
 //export callbackQNetworkConfigurationManager_ObjectNameChanged
 func callbackQNetworkConfigurationManager_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -8012,7 +8060,7 @@ func callbackQNetworkConfigurationManager_ObjectNameChanged(ptr unsafe.Pointer,
 
 //export callbackQNetworkConfigurationManager_TimerEvent
 func callbackQNetworkConfigurationManager_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQNetworkConfigurationManagerFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -8027,7 +8075,7 @@ func (ptr *QNetworkConfigurationManager) TimerEventDefault(event core.QTimerEven
 
 //export callbackQNetworkConfigurationManager_MetaObject
 func callbackQNetworkConfigurationManager_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -8322,7 +8370,7 @@ func NewQNetworkCookieJarFromPointer(ptr unsafe.Pointer) *QNetworkCookieJar {
 }
 func NewQNetworkCookieJar(parent core.QObject_ITF) *QNetworkCookieJar {
 	var tmpValue = NewQNetworkCookieJarFromPointer(C.QNetworkCookieJar_NewQNetworkCookieJar(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -8330,7 +8378,7 @@ func NewQNetworkCookieJar(parent core.QObject_ITF) *QNetworkCookieJar {
 
 //export callbackQNetworkCookieJar_DeleteCookie
 func callbackQNetworkCookieJar_DeleteCookie(ptr unsafe.Pointer, cookie unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteCookie"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteCookie"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QNetworkCookie) bool)(NewQNetworkCookieFromPointer(cookie)))))
 	}
 
@@ -8340,14 +8388,14 @@ func callbackQNetworkCookieJar_DeleteCookie(ptr unsafe.Pointer, cookie unsafe.Po
 func (ptr *QNetworkCookieJar) ConnectDeleteCookie(f func(cookie *QNetworkCookie) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "deleteCookie", f)
+		qt.ConnectSignal(ptr.Pointer(), "deleteCookie", f)
 	}
 }
 
 func (ptr *QNetworkCookieJar) DisconnectDeleteCookie() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "deleteCookie")
+		qt.DisconnectSignal(ptr.Pointer(), "deleteCookie")
 	}
 }
 
@@ -8367,7 +8415,7 @@ func (ptr *QNetworkCookieJar) DeleteCookieDefault(cookie QNetworkCookie_ITF) boo
 
 //export callbackQNetworkCookieJar_InsertCookie
 func callbackQNetworkCookieJar_InsertCookie(ptr unsafe.Pointer, cookie unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertCookie"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertCookie"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QNetworkCookie) bool)(NewQNetworkCookieFromPointer(cookie)))))
 	}
 
@@ -8377,14 +8425,14 @@ func callbackQNetworkCookieJar_InsertCookie(ptr unsafe.Pointer, cookie unsafe.Po
 func (ptr *QNetworkCookieJar) ConnectInsertCookie(f func(cookie *QNetworkCookie) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "insertCookie", f)
+		qt.ConnectSignal(ptr.Pointer(), "insertCookie", f)
 	}
 }
 
 func (ptr *QNetworkCookieJar) DisconnectInsertCookie() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "insertCookie")
+		qt.DisconnectSignal(ptr.Pointer(), "insertCookie")
 	}
 }
 
@@ -8404,7 +8452,7 @@ func (ptr *QNetworkCookieJar) InsertCookieDefault(cookie QNetworkCookie_ITF) boo
 
 //export callbackQNetworkCookieJar_SetCookiesFromUrl
 func callbackQNetworkCookieJar_SetCookiesFromUrl(ptr unsafe.Pointer, cookieList C.struct_QtNetwork_PackedList, url unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCookiesFromUrl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCookiesFromUrl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func([]*QNetworkCookie, *core.QUrl) bool)(func(l C.struct_QtNetwork_PackedList) []*QNetworkCookie {
 			var out = make([]*QNetworkCookie, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -8426,14 +8474,14 @@ func callbackQNetworkCookieJar_SetCookiesFromUrl(ptr unsafe.Pointer, cookieList
 func (ptr *QNetworkCookieJar) ConnectSetCookiesFromUrl(f func(cookieList []*QNetworkCookie, url *core.QUrl) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setCookiesFromUrl", f)
+		qt.ConnectSignal(ptr.Pointer(), "setCookiesFromUrl", f)
 	}
 }
 
 func (ptr *QNetworkCookieJar) DisconnectSetCookiesFromUrl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setCookiesFromUrl")
+		qt.DisconnectSignal(ptr.Pointer(), "setCookiesFromUrl")
 	}
 }
 
@@ -8465,7 +8513,7 @@ func (ptr *QNetworkCookieJar) SetCookiesFromUrlDefault(cookieList []*QNetworkCoo
 
 //export callbackQNetworkCookieJar_UpdateCookie
 func callbackQNetworkCookieJar_UpdateCookie(ptr unsafe.Pointer, cookie unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateCookie"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateCookie"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QNetworkCookie) bool)(NewQNetworkCookieFromPointer(cookie)))))
 	}
 
@@ -8475,14 +8523,14 @@ func callbackQNetworkCookieJar_UpdateCookie(ptr unsafe.Pointer, cookie unsafe.Po
 func (ptr *QNetworkCookieJar) ConnectUpdateCookie(f func(cookie *QNetworkCookie) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateCookie", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateCookie", f)
 	}
 }
 
 func (ptr *QNetworkCookieJar) DisconnectUpdateCookie() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateCookie")
+		qt.DisconnectSignal(ptr.Pointer(), "updateCookie")
 	}
 }
 
@@ -8514,7 +8562,7 @@ func (ptr *QNetworkCookieJar) SetAllCookies(cookieList []*QNetworkCookie) {
 
 //export callbackQNetworkCookieJar_DestroyQNetworkCookieJar
 func callbackQNetworkCookieJar_DestroyQNetworkCookieJar(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QNetworkCookieJar"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QNetworkCookieJar"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkCookieJarFromPointer(ptr).DestroyQNetworkCookieJarDefault()
@@ -8524,21 +8572,21 @@ func callbackQNetworkCookieJar_DestroyQNetworkCookieJar(ptr unsafe.Pointer) {
 func (ptr *QNetworkCookieJar) ConnectDestroyQNetworkCookieJar(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QNetworkCookieJar", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QNetworkCookieJar", f)
 	}
 }
 
 func (ptr *QNetworkCookieJar) DisconnectDestroyQNetworkCookieJar() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QNetworkCookieJar")
+		qt.DisconnectSignal(ptr.Pointer(), "~QNetworkCookieJar")
 	}
 }
 
 func (ptr *QNetworkCookieJar) DestroyQNetworkCookieJar() {
 	if ptr.Pointer() != nil {
 		C.QNetworkCookieJar_DestroyQNetworkCookieJar(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8546,7 +8594,7 @@ func (ptr *QNetworkCookieJar) DestroyQNetworkCookieJar() {
 func (ptr *QNetworkCookieJar) DestroyQNetworkCookieJarDefault() {
 	if ptr.Pointer() != nil {
 		C.QNetworkCookieJar_DestroyQNetworkCookieJarDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8566,7 +8614,7 @@ func (ptr *QNetworkCookieJar) AllCookies() []*QNetworkCookie {
 
 //export callbackQNetworkCookieJar_CookiesForUrl
 func callbackQNetworkCookieJar_CookiesForUrl(ptr unsafe.Pointer, url unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cookiesForUrl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cookiesForUrl"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQNetworkCookieJarFromPointer(NewQNetworkCookieJarFromPointer(nil).__cookiesForUrl_newList())
 			for _, v := range signal.(func(*core.QUrl) []*QNetworkCookie)(core.NewQUrlFromPointer(url)) {
@@ -8588,14 +8636,14 @@ func callbackQNetworkCookieJar_CookiesForUrl(ptr unsafe.Pointer, url unsafe.Poin
 func (ptr *QNetworkCookieJar) ConnectCookiesForUrl(f func(url *core.QUrl) []*QNetworkCookie) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cookiesForUrl", f)
+		qt.ConnectSignal(ptr.Pointer(), "cookiesForUrl", f)
 	}
 }
 
 func (ptr *QNetworkCookieJar) DisconnectCookiesForUrl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cookiesForUrl")
+		qt.DisconnectSignal(ptr.Pointer(), "cookiesForUrl")
 	}
 }
 
@@ -8627,7 +8675,7 @@ func (ptr *QNetworkCookieJar) CookiesForUrlDefault(url core.QUrl_ITF) []*QNetwor
 
 //export callbackQNetworkCookieJar_ValidateCookie
 func callbackQNetworkCookieJar_ValidateCookie(ptr unsafe.Pointer, cookie unsafe.Pointer, url unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "validateCookie"); signal != nil {
+	if signal := qt.GetSignal(ptr, "validateCookie"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QNetworkCookie, *core.QUrl) bool)(NewQNetworkCookieFromPointer(cookie), core.NewQUrlFromPointer(url)))))
 	}
 
@@ -8637,14 +8685,14 @@ func callbackQNetworkCookieJar_ValidateCookie(ptr unsafe.Pointer, cookie unsafe.
 func (ptr *QNetworkCookieJar) ConnectValidateCookie(f func(cookie *QNetworkCookie, url *core.QUrl) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "validateCookie", f)
+		qt.ConnectSignal(ptr.Pointer(), "validateCookie", f)
 	}
 }
 
 func (ptr *QNetworkCookieJar) DisconnectValidateCookie() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "validateCookie")
+		qt.DisconnectSignal(ptr.Pointer(), "validateCookie")
 	}
 }
 
@@ -8760,7 +8808,7 @@ func (ptr *QNetworkCookieJar) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QNetworkCookieJar) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkCookieJar___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8781,7 +8829,7 @@ func (ptr *QNetworkCookieJar) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QNetworkCookieJar) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkCookieJar___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8802,7 +8850,7 @@ func (ptr *QNetworkCookieJar) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QNetworkCookieJar) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkCookieJar___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8823,7 +8871,7 @@ func (ptr *QNetworkCookieJar) __findChildren_newList() unsafe.Pointer {
 func (ptr *QNetworkCookieJar) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkCookieJar___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8843,7 +8891,7 @@ func (ptr *QNetworkCookieJar) __children_newList() unsafe.Pointer {
 
 //export callbackQNetworkCookieJar_Event
 func callbackQNetworkCookieJar_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -8859,7 +8907,7 @@ func (ptr *QNetworkCookieJar) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQNetworkCookieJar_EventFilter
 func callbackQNetworkCookieJar_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -8875,7 +8923,7 @@ func (ptr *QNetworkCookieJar) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQNetworkCookieJar_ChildEvent
 func callbackQNetworkCookieJar_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQNetworkCookieJarFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -8890,7 +8938,7 @@ func (ptr *QNetworkCookieJar) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQNetworkCookieJar_ConnectNotify
 func callbackQNetworkCookieJar_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkCookieJarFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -8905,7 +8953,7 @@ func (ptr *QNetworkCookieJar) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQNetworkCookieJar_CustomEvent
 func callbackQNetworkCookieJar_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQNetworkCookieJarFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -8920,7 +8968,7 @@ func (ptr *QNetworkCookieJar) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQNetworkCookieJar_DeleteLater
 func callbackQNetworkCookieJar_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkCookieJarFromPointer(ptr).DeleteLaterDefault()
@@ -8930,14 +8978,14 @@ func callbackQNetworkCookieJar_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QNetworkCookieJar) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QNetworkCookieJar_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQNetworkCookieJar_Destroyed
 func callbackQNetworkCookieJar_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -8945,7 +8993,7 @@ func callbackQNetworkCookieJar_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQNetworkCookieJar_DisconnectNotify
 func callbackQNetworkCookieJar_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkCookieJarFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -8960,7 +9008,7 @@ func (ptr *QNetworkCookieJar) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQNetworkCookieJar_ObjectNameChanged
 func callbackQNetworkCookieJar_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -8968,7 +9016,7 @@ func callbackQNetworkCookieJar_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQNetworkCookieJar_TimerEvent
 func callbackQNetworkCookieJar_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQNetworkCookieJarFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -8983,7 +9031,7 @@ func (ptr *QNetworkCookieJar) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQNetworkCookieJar_MetaObject
 func callbackQNetworkCookieJar_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -9226,7 +9274,7 @@ func NewQNetworkDiskCacheFromPointer(ptr unsafe.Pointer) *QNetworkDiskCache {
 
 //export callbackQNetworkDiskCache_Data
 func callbackQNetworkDiskCache_Data(ptr unsafe.Pointer, url unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
 		return core.PointerFromQIODevice(signal.(func(*core.QUrl) *core.QIODevice)(core.NewQUrlFromPointer(url)))
 	}
 
@@ -9236,21 +9284,21 @@ func callbackQNetworkDiskCache_Data(ptr unsafe.Pointer, url unsafe.Pointer) unsa
 func (ptr *QNetworkDiskCache) ConnectData(f func(url *core.QUrl) *core.QIODevice) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QNetworkDiskCache) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
 func (ptr *QNetworkDiskCache) Data(url core.QUrl_ITF) *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QNetworkDiskCache_Data(ptr.Pointer(), core.PointerFromQUrl(url)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9261,7 +9309,7 @@ func (ptr *QNetworkDiskCache) Data(url core.QUrl_ITF) *core.QIODevice {
 func (ptr *QNetworkDiskCache) DataDefault(url core.QUrl_ITF) *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QNetworkDiskCache_DataDefault(ptr.Pointer(), core.PointerFromQUrl(url)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9271,7 +9319,7 @@ func (ptr *QNetworkDiskCache) DataDefault(url core.QUrl_ITF) *core.QIODevice {
 
 //export callbackQNetworkDiskCache_Prepare
 func callbackQNetworkDiskCache_Prepare(ptr unsafe.Pointer, metaData unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "prepare"); signal != nil {
+	if signal := qt.GetSignal(ptr, "prepare"); signal != nil {
 		return core.PointerFromQIODevice(signal.(func(*QNetworkCacheMetaData) *core.QIODevice)(NewQNetworkCacheMetaDataFromPointer(metaData)))
 	}
 
@@ -9281,21 +9329,21 @@ func callbackQNetworkDiskCache_Prepare(ptr unsafe.Pointer, metaData unsafe.Point
 func (ptr *QNetworkDiskCache) ConnectPrepare(f func(metaData *QNetworkCacheMetaData) *core.QIODevice) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "prepare", f)
+		qt.ConnectSignal(ptr.Pointer(), "prepare", f)
 	}
 }
 
 func (ptr *QNetworkDiskCache) DisconnectPrepare() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "prepare")
+		qt.DisconnectSignal(ptr.Pointer(), "prepare")
 	}
 }
 
 func (ptr *QNetworkDiskCache) Prepare(metaData QNetworkCacheMetaData_ITF) *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QNetworkDiskCache_Prepare(ptr.Pointer(), PointerFromQNetworkCacheMetaData(metaData)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9306,7 +9354,7 @@ func (ptr *QNetworkDiskCache) Prepare(metaData QNetworkCacheMetaData_ITF) *core.
 func (ptr *QNetworkDiskCache) PrepareDefault(metaData QNetworkCacheMetaData_ITF) *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QNetworkDiskCache_PrepareDefault(ptr.Pointer(), PointerFromQNetworkCacheMetaData(metaData)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9316,7 +9364,7 @@ func (ptr *QNetworkDiskCache) PrepareDefault(metaData QNetworkCacheMetaData_ITF)
 
 //export callbackQNetworkDiskCache_MetaData
 func callbackQNetworkDiskCache_MetaData(ptr unsafe.Pointer, url unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaData"); signal != nil {
 		return PointerFromQNetworkCacheMetaData(signal.(func(*core.QUrl) *QNetworkCacheMetaData)(core.NewQUrlFromPointer(url)))
 	}
 
@@ -9326,14 +9374,14 @@ func callbackQNetworkDiskCache_MetaData(ptr unsafe.Pointer, url unsafe.Pointer)
 func (ptr *QNetworkDiskCache) ConnectMetaData(f func(url *core.QUrl) *QNetworkCacheMetaData) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "metaData", f)
+		qt.ConnectSignal(ptr.Pointer(), "metaData", f)
 	}
 }
 
 func (ptr *QNetworkDiskCache) DisconnectMetaData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "metaData")
+		qt.DisconnectSignal(ptr.Pointer(), "metaData")
 	}
 }
 
@@ -9357,7 +9405,7 @@ func (ptr *QNetworkDiskCache) MetaDataDefault(url core.QUrl_ITF) *QNetworkCacheM
 
 func NewQNetworkDiskCache(parent core.QObject_ITF) *QNetworkDiskCache {
 	var tmpValue = NewQNetworkDiskCacheFromPointer(C.QNetworkDiskCache_NewQNetworkDiskCache(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -9365,7 +9413,7 @@ func NewQNetworkDiskCache(parent core.QObject_ITF) *QNetworkDiskCache {
 
 //export callbackQNetworkDiskCache_Remove
 func callbackQNetworkDiskCache_Remove(ptr unsafe.Pointer, url unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "remove"); signal != nil {
+	if signal := qt.GetSignal(ptr, "remove"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QUrl) bool)(core.NewQUrlFromPointer(url)))))
 	}
 
@@ -9375,14 +9423,14 @@ func callbackQNetworkDiskCache_Remove(ptr unsafe.Pointer, url unsafe.Pointer) C.
 func (ptr *QNetworkDiskCache) ConnectRemove(f func(url *core.QUrl) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "remove", f)
+		qt.ConnectSignal(ptr.Pointer(), "remove", f)
 	}
 }
 
 func (ptr *QNetworkDiskCache) DisconnectRemove() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "remove")
+		qt.DisconnectSignal(ptr.Pointer(), "remove")
 	}
 }
 
@@ -9402,7 +9450,7 @@ func (ptr *QNetworkDiskCache) RemoveDefault(url core.QUrl_ITF) bool {
 
 //export callbackQNetworkDiskCache_Expire
 func callbackQNetworkDiskCache_Expire(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "expire"); signal != nil {
+	if signal := qt.GetSignal(ptr, "expire"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -9412,14 +9460,14 @@ func callbackQNetworkDiskCache_Expire(ptr unsafe.Pointer) C.longlong {
 func (ptr *QNetworkDiskCache) ConnectExpire(f func() int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "expire", f)
+		qt.ConnectSignal(ptr.Pointer(), "expire", f)
 	}
 }
 
 func (ptr *QNetworkDiskCache) DisconnectExpire() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "expire")
+		qt.DisconnectSignal(ptr.Pointer(), "expire")
 	}
 }
 
@@ -9439,7 +9487,7 @@ func (ptr *QNetworkDiskCache) ExpireDefault() int64 {
 
 //export callbackQNetworkDiskCache_Clear
 func callbackQNetworkDiskCache_Clear(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clear"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clear"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkDiskCacheFromPointer(ptr).ClearDefault()
@@ -9449,14 +9497,14 @@ func callbackQNetworkDiskCache_Clear(ptr unsafe.Pointer) {
 func (ptr *QNetworkDiskCache) ConnectClear(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clear", f)
+		qt.ConnectSignal(ptr.Pointer(), "clear", f)
 	}
 }
 
 func (ptr *QNetworkDiskCache) DisconnectClear() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clear")
+		qt.DisconnectSignal(ptr.Pointer(), "clear")
 	}
 }
 
@@ -9474,7 +9522,7 @@ func (ptr *QNetworkDiskCache) ClearDefault() {
 
 //export callbackQNetworkDiskCache_Insert
 func callbackQNetworkDiskCache_Insert(ptr unsafe.Pointer, device unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insert"); signal != nil {
 		signal.(func(*core.QIODevice))(core.NewQIODeviceFromPointer(device))
 	} else {
 		NewQNetworkDiskCacheFromPointer(ptr).InsertDefault(core.NewQIODeviceFromPointer(device))
@@ -9484,14 +9532,14 @@ func callbackQNetworkDiskCache_Insert(ptr unsafe.Pointer, device unsafe.Pointer)
 func (ptr *QNetworkDiskCache) ConnectInsert(f func(device *core.QIODevice)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "insert", f)
+		qt.ConnectSignal(ptr.Pointer(), "insert", f)
 	}
 }
 
 func (ptr *QNetworkDiskCache) DisconnectInsert() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "insert")
+		qt.DisconnectSignal(ptr.Pointer(), "insert")
 	}
 }
 
@@ -9523,7 +9571,7 @@ func (ptr *QNetworkDiskCache) SetMaximumCacheSize(size int64) {
 
 //export callbackQNetworkDiskCache_UpdateMetaData
 func callbackQNetworkDiskCache_UpdateMetaData(ptr unsafe.Pointer, metaData unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMetaData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMetaData"); signal != nil {
 		signal.(func(*QNetworkCacheMetaData))(NewQNetworkCacheMetaDataFromPointer(metaData))
 	} else {
 		NewQNetworkDiskCacheFromPointer(ptr).UpdateMetaDataDefault(NewQNetworkCacheMetaDataFromPointer(metaData))
@@ -9533,14 +9581,14 @@ func callbackQNetworkDiskCache_UpdateMetaData(ptr unsafe.Pointer, metaData unsaf
 func (ptr *QNetworkDiskCache) ConnectUpdateMetaData(f func(metaData *QNetworkCacheMetaData)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateMetaData", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateMetaData", f)
 	}
 }
 
 func (ptr *QNetworkDiskCache) DisconnectUpdateMetaData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateMetaData")
+		qt.DisconnectSignal(ptr.Pointer(), "updateMetaData")
 	}
 }
 
@@ -9559,7 +9607,7 @@ func (ptr *QNetworkDiskCache) UpdateMetaDataDefault(metaData QNetworkCacheMetaDa
 func (ptr *QNetworkDiskCache) DestroyQNetworkDiskCache() {
 	if ptr.Pointer() != nil {
 		C.QNetworkDiskCache_DestroyQNetworkDiskCache(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9584,7 +9632,7 @@ func (ptr *QNetworkDiskCache) CacheDirectory() string {
 
 //export callbackQNetworkDiskCache_CacheSize
 func callbackQNetworkDiskCache_CacheSize(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cacheSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cacheSize"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -9594,14 +9642,14 @@ func callbackQNetworkDiskCache_CacheSize(ptr unsafe.Pointer) C.longlong {
 func (ptr *QNetworkDiskCache) ConnectCacheSize(f func() int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cacheSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "cacheSize", f)
 	}
 }
 
 func (ptr *QNetworkDiskCache) DisconnectCacheSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cacheSize")
+		qt.DisconnectSignal(ptr.Pointer(), "cacheSize")
 	}
 }
 
@@ -10096,13 +10144,13 @@ func (ptr *QNetworkProxy) RawHeader(headerName core.QByteArray_ITF) *core.QByteA
 
 func (ptr *QNetworkProxy) RawHeaderList() []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtNetwork_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQNetworkProxyFromPointer(l.data).__rawHeaderList_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QNetworkProxy_RawHeaderList(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QNetworkProxy_RawHeaderList(ptr.Pointer())))
 	}
 	return make([]*core.QByteArray, 0)
 }
@@ -10250,7 +10298,7 @@ func (ptr *QNetworkProxyFactory) ProxyForQuery(query QNetworkProxyQuery_ITF) []*
 
 //export callbackQNetworkProxyFactory_QueryProxy
 func callbackQNetworkProxyFactory_QueryProxy(ptr unsafe.Pointer, query unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "queryProxy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "queryProxy"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQNetworkProxyFactoryFromPointer(NewQNetworkProxyFactoryFromPointer(nil).__queryProxy_newList())
 			for _, v := range signal.(func(*QNetworkProxyQuery) []*QNetworkProxy)(NewQNetworkProxyQueryFromPointer(query)) {
@@ -10272,14 +10320,14 @@ func callbackQNetworkProxyFactory_QueryProxy(ptr unsafe.Pointer, query unsafe.Po
 func (ptr *QNetworkProxyFactory) ConnectQueryProxy(f func(query *QNetworkProxyQuery) []*QNetworkProxy) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "queryProxy", f)
+		qt.ConnectSignal(ptr.Pointer(), "queryProxy", f)
 	}
 }
 
 func (ptr *QNetworkProxyFactory) DisconnectQueryProxy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "queryProxy")
+		qt.DisconnectSignal(ptr.Pointer(), "queryProxy")
 	}
 }
 
@@ -10346,7 +10394,7 @@ func (ptr *QNetworkProxyFactory) SetUseSystemConfiguration(enable bool) {
 
 //export callbackQNetworkProxyFactory_DestroyQNetworkProxyFactory
 func callbackQNetworkProxyFactory_DestroyQNetworkProxyFactory(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QNetworkProxyFactory"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QNetworkProxyFactory"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkProxyFactoryFromPointer(ptr).DestroyQNetworkProxyFactoryDefault()
@@ -10356,21 +10404,21 @@ func callbackQNetworkProxyFactory_DestroyQNetworkProxyFactory(ptr unsafe.Pointer
 func (ptr *QNetworkProxyFactory) ConnectDestroyQNetworkProxyFactory(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QNetworkProxyFactory", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QNetworkProxyFactory", f)
 	}
 }
 
 func (ptr *QNetworkProxyFactory) DisconnectDestroyQNetworkProxyFactory() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QNetworkProxyFactory")
+		qt.DisconnectSignal(ptr.Pointer(), "~QNetworkProxyFactory")
 	}
 }
 
 func (ptr *QNetworkProxyFactory) DestroyQNetworkProxyFactory() {
 	if ptr.Pointer() != nil {
 		C.QNetworkProxyFactory_DestroyQNetworkProxyFactory(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10378,7 +10426,7 @@ func (ptr *QNetworkProxyFactory) DestroyQNetworkProxyFactory() {
 func (ptr *QNetworkProxyFactory) DestroyQNetworkProxyFactoryDefault() {
 	if ptr.Pointer() != nil {
 		C.QNetworkProxyFactory_DestroyQNetworkProxyFactoryDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10745,7 +10793,7 @@ const (
 
 func NewQNetworkReply(parent core.QObject_ITF) *QNetworkReply {
 	var tmpValue = NewQNetworkReplyFromPointer(C.QNetworkReply_NewQNetworkReply(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -10753,7 +10801,7 @@ func NewQNetworkReply(parent core.QObject_ITF) *QNetworkReply {
 
 //export callbackQNetworkReply_Abort
 func callbackQNetworkReply_Abort(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "abort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "abort"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10762,14 +10810,14 @@ func callbackQNetworkReply_Abort(ptr unsafe.Pointer) {
 func (ptr *QNetworkReply) ConnectAbort(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "abort", f)
+		qt.ConnectSignal(ptr.Pointer(), "abort", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectAbort() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "abort")
+		qt.DisconnectSignal(ptr.Pointer(), "abort")
 	}
 }
 
@@ -10781,7 +10829,7 @@ func (ptr *QNetworkReply) Abort() {
 
 //export callbackQNetworkReply_Close
 func callbackQNetworkReply_Close(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkReplyFromPointer(ptr).CloseDefault()
@@ -10796,7 +10844,7 @@ func (ptr *QNetworkReply) CloseDefault() {
 
 //export callbackQNetworkReply_DownloadProgress
 func callbackQNetworkReply_DownloadProgress(ptr unsafe.Pointer, bytesReceived C.longlong, bytesTotal C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "downloadProgress"); signal != nil {
+	if signal := qt.GetSignal(ptr, "downloadProgress"); signal != nil {
 		signal.(func(int64, int64))(int64(bytesReceived), int64(bytesTotal))
 	}
 
@@ -10805,14 +10853,14 @@ func callbackQNetworkReply_DownloadProgress(ptr unsafe.Pointer, bytesReceived C.
 func (ptr *QNetworkReply) ConnectDownloadProgress(f func(bytesReceived int64, bytesTotal int64)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_ConnectDownloadProgress(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "downloadProgress", f)
+		qt.ConnectSignal(ptr.Pointer(), "downloadProgress", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectDownloadProgress() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DisconnectDownloadProgress(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "downloadProgress")
+		qt.DisconnectSignal(ptr.Pointer(), "downloadProgress")
 	}
 }
 
@@ -10824,7 +10872,7 @@ func (ptr *QNetworkReply) DownloadProgress(bytesReceived int64, bytesTotal int64
 
 //export callbackQNetworkReply_Encrypted
 func callbackQNetworkReply_Encrypted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "encrypted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "encrypted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10833,14 +10881,14 @@ func callbackQNetworkReply_Encrypted(ptr unsafe.Pointer) {
 func (ptr *QNetworkReply) ConnectEncrypted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_ConnectEncrypted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "encrypted", f)
+		qt.ConnectSignal(ptr.Pointer(), "encrypted", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectEncrypted() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DisconnectEncrypted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "encrypted")
+		qt.DisconnectSignal(ptr.Pointer(), "encrypted")
 	}
 }
 
@@ -10852,7 +10900,7 @@ func (ptr *QNetworkReply) Encrypted() {
 
 //export callbackQNetworkReply_Error2
 func callbackQNetworkReply_Error2(ptr unsafe.Pointer, code C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "error2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "error2"); signal != nil {
 		signal.(func(QNetworkReply__NetworkError))(QNetworkReply__NetworkError(code))
 	}
 
@@ -10861,14 +10909,14 @@ func callbackQNetworkReply_Error2(ptr unsafe.Pointer, code C.longlong) {
 func (ptr *QNetworkReply) ConnectError2(f func(code QNetworkReply__NetworkError)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_ConnectError2(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "error2", f)
+		qt.ConnectSignal(ptr.Pointer(), "error2", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectError2() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DisconnectError2(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "error2")
+		qt.DisconnectSignal(ptr.Pointer(), "error2")
 	}
 }
 
@@ -10880,7 +10928,7 @@ func (ptr *QNetworkReply) Error2(code QNetworkReply__NetworkError) {
 
 //export callbackQNetworkReply_Finished
 func callbackQNetworkReply_Finished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -10889,14 +10937,14 @@ func callbackQNetworkReply_Finished(ptr unsafe.Pointer) {
 func (ptr *QNetworkReply) ConnectFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
@@ -10908,7 +10956,7 @@ func (ptr *QNetworkReply) Finished() {
 
 //export callbackQNetworkReply_IgnoreSslErrors
 func callbackQNetworkReply_IgnoreSslErrors(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "ignoreSslErrors"); signal != nil {
+	if signal := qt.GetSignal(ptr, "ignoreSslErrors"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkReplyFromPointer(ptr).IgnoreSslErrorsDefault()
@@ -10918,14 +10966,14 @@ func callbackQNetworkReply_IgnoreSslErrors(ptr unsafe.Pointer) {
 func (ptr *QNetworkReply) ConnectIgnoreSslErrors(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "ignoreSslErrors", f)
+		qt.ConnectSignal(ptr.Pointer(), "ignoreSslErrors", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectIgnoreSslErrors() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "ignoreSslErrors")
+		qt.DisconnectSignal(ptr.Pointer(), "ignoreSslErrors")
 	}
 }
 
@@ -10955,7 +11003,7 @@ func (ptr *QNetworkReply) IgnoreSslErrors2(errors []*QSslError) {
 
 //export callbackQNetworkReply_IgnoreSslErrorsImplementation
 func callbackQNetworkReply_IgnoreSslErrorsImplementation(ptr unsafe.Pointer, errors C.struct_QtNetwork_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "ignoreSslErrorsImplementation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "ignoreSslErrorsImplementation"); signal != nil {
 		signal.(func([]*QSslError))(func(l C.struct_QtNetwork_PackedList) []*QSslError {
 			var out = make([]*QSslError, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -10977,14 +11025,14 @@ func callbackQNetworkReply_IgnoreSslErrorsImplementation(ptr unsafe.Pointer, err
 func (ptr *QNetworkReply) ConnectIgnoreSslErrorsImplementation(f func(errors []*QSslError)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "ignoreSslErrorsImplementation", f)
+		qt.ConnectSignal(ptr.Pointer(), "ignoreSslErrorsImplementation", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectIgnoreSslErrorsImplementation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "ignoreSslErrorsImplementation")
+		qt.DisconnectSignal(ptr.Pointer(), "ignoreSslErrorsImplementation")
 	}
 }
 
@@ -11014,7 +11062,7 @@ func (ptr *QNetworkReply) IgnoreSslErrorsImplementationDefault(errors []*QSslErr
 
 //export callbackQNetworkReply_MetaDataChanged
 func callbackQNetworkReply_MetaDataChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaDataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaDataChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -11023,14 +11071,14 @@ func callbackQNetworkReply_MetaDataChanged(ptr unsafe.Pointer) {
 func (ptr *QNetworkReply) ConnectMetaDataChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_ConnectMetaDataChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "metaDataChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "metaDataChanged", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectMetaDataChanged() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DisconnectMetaDataChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "metaDataChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "metaDataChanged")
 	}
 }
 
@@ -11042,7 +11090,7 @@ func (ptr *QNetworkReply) MetaDataChanged() {
 
 //export callbackQNetworkReply_PreSharedKeyAuthenticationRequired
 func callbackQNetworkReply_PreSharedKeyAuthenticationRequired(ptr unsafe.Pointer, authenticator unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "preSharedKeyAuthenticationRequired"); signal != nil {
+	if signal := qt.GetSignal(ptr, "preSharedKeyAuthenticationRequired"); signal != nil {
 		signal.(func(*QSslPreSharedKeyAuthenticator))(NewQSslPreSharedKeyAuthenticatorFromPointer(authenticator))
 	}
 
@@ -11051,14 +11099,14 @@ func callbackQNetworkReply_PreSharedKeyAuthenticationRequired(ptr unsafe.Pointer
 func (ptr *QNetworkReply) ConnectPreSharedKeyAuthenticationRequired(f func(authenticator *QSslPreSharedKeyAuthenticator)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_ConnectPreSharedKeyAuthenticationRequired(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "preSharedKeyAuthenticationRequired", f)
+		qt.ConnectSignal(ptr.Pointer(), "preSharedKeyAuthenticationRequired", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectPreSharedKeyAuthenticationRequired() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DisconnectPreSharedKeyAuthenticationRequired(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "preSharedKeyAuthenticationRequired")
+		qt.DisconnectSignal(ptr.Pointer(), "preSharedKeyAuthenticationRequired")
 	}
 }
 
@@ -11070,7 +11118,7 @@ func (ptr *QNetworkReply) PreSharedKeyAuthenticationRequired(authenticator QSslP
 
 //export callbackQNetworkReply_Redirected
 func callbackQNetworkReply_Redirected(ptr unsafe.Pointer, url unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "redirected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "redirected"); signal != nil {
 		signal.(func(*core.QUrl))(core.NewQUrlFromPointer(url))
 	}
 
@@ -11079,14 +11127,14 @@ func callbackQNetworkReply_Redirected(ptr unsafe.Pointer, url unsafe.Pointer) {
 func (ptr *QNetworkReply) ConnectRedirected(f func(url *core.QUrl)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_ConnectRedirected(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "redirected", f)
+		qt.ConnectSignal(ptr.Pointer(), "redirected", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectRedirected() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DisconnectRedirected(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "redirected")
+		qt.DisconnectSignal(ptr.Pointer(), "redirected")
 	}
 }
 
@@ -11136,7 +11184,7 @@ func (ptr *QNetworkReply) SetRawHeader(headerName core.QByteArray_ITF, value cor
 
 //export callbackQNetworkReply_SetReadBufferSize
 func callbackQNetworkReply_SetReadBufferSize(ptr unsafe.Pointer, size C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setReadBufferSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setReadBufferSize"); signal != nil {
 		signal.(func(int64))(int64(size))
 	} else {
 		NewQNetworkReplyFromPointer(ptr).SetReadBufferSizeDefault(int64(size))
@@ -11146,14 +11194,14 @@ func callbackQNetworkReply_SetReadBufferSize(ptr unsafe.Pointer, size C.longlong
 func (ptr *QNetworkReply) ConnectSetReadBufferSize(f func(size int64)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setReadBufferSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "setReadBufferSize", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectSetReadBufferSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setReadBufferSize")
+		qt.DisconnectSignal(ptr.Pointer(), "setReadBufferSize")
 	}
 }
 
@@ -11183,7 +11231,7 @@ func (ptr *QNetworkReply) SetSslConfiguration(config QSslConfiguration_ITF) {
 
 //export callbackQNetworkReply_SetSslConfigurationImplementation
 func callbackQNetworkReply_SetSslConfigurationImplementation(ptr unsafe.Pointer, configuration unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSslConfigurationImplementation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSslConfigurationImplementation"); signal != nil {
 		signal.(func(*QSslConfiguration))(NewQSslConfigurationFromPointer(configuration))
 	} else {
 		NewQNetworkReplyFromPointer(ptr).SetSslConfigurationImplementationDefault(NewQSslConfigurationFromPointer(configuration))
@@ -11193,14 +11241,14 @@ func callbackQNetworkReply_SetSslConfigurationImplementation(ptr unsafe.Pointer,
 func (ptr *QNetworkReply) ConnectSetSslConfigurationImplementation(f func(configuration *QSslConfiguration)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSslConfigurationImplementation", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSslConfigurationImplementation", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectSetSslConfigurationImplementation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSslConfigurationImplementation")
+		qt.DisconnectSignal(ptr.Pointer(), "setSslConfigurationImplementation")
 	}
 }
 
@@ -11224,7 +11272,7 @@ func (ptr *QNetworkReply) SetUrl(url core.QUrl_ITF) {
 
 //export callbackQNetworkReply_SslErrors
 func callbackQNetworkReply_SslErrors(ptr unsafe.Pointer, errors C.struct_QtNetwork_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sslErrors"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sslErrors"); signal != nil {
 		signal.(func([]*QSslError))(func(l C.struct_QtNetwork_PackedList) []*QSslError {
 			var out = make([]*QSslError, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -11239,14 +11287,14 @@ func callbackQNetworkReply_SslErrors(ptr unsafe.Pointer, errors C.struct_QtNetwo
 func (ptr *QNetworkReply) ConnectSslErrors(f func(errors []*QSslError)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_ConnectSslErrors(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sslErrors", f)
+		qt.ConnectSignal(ptr.Pointer(), "sslErrors", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectSslErrors() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DisconnectSslErrors(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sslErrors")
+		qt.DisconnectSignal(ptr.Pointer(), "sslErrors")
 	}
 }
 
@@ -11264,7 +11312,7 @@ func (ptr *QNetworkReply) SslErrors(errors []*QSslError) {
 
 //export callbackQNetworkReply_UploadProgress
 func callbackQNetworkReply_UploadProgress(ptr unsafe.Pointer, bytesSent C.longlong, bytesTotal C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "uploadProgress"); signal != nil {
+	if signal := qt.GetSignal(ptr, "uploadProgress"); signal != nil {
 		signal.(func(int64, int64))(int64(bytesSent), int64(bytesTotal))
 	}
 
@@ -11273,14 +11321,14 @@ func callbackQNetworkReply_UploadProgress(ptr unsafe.Pointer, bytesSent C.longlo
 func (ptr *QNetworkReply) ConnectUploadProgress(f func(bytesSent int64, bytesTotal int64)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_ConnectUploadProgress(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "uploadProgress", f)
+		qt.ConnectSignal(ptr.Pointer(), "uploadProgress", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectUploadProgress() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DisconnectUploadProgress(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "uploadProgress")
+		qt.DisconnectSignal(ptr.Pointer(), "uploadProgress")
 	}
 }
 
@@ -11293,7 +11341,7 @@ func (ptr *QNetworkReply) UploadProgress(bytesSent int64, bytesTotal int64) {
 func (ptr *QNetworkReply) DestroyQNetworkReply() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DestroyQNetworkReply(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11316,13 +11364,13 @@ func (ptr *QNetworkReply) RawHeader(headerName core.QByteArray_ITF) *core.QByteA
 
 func (ptr *QNetworkReply) RawHeaderList() []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtNetwork_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQNetworkReplyFromPointer(l.data).__rawHeaderList_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QNetworkReply_RawHeaderList(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QNetworkReply_RawHeaderList(ptr.Pointer())))
 	}
 	return make([]*core.QByteArray, 0)
 }
@@ -11330,7 +11378,7 @@ func (ptr *QNetworkReply) RawHeaderList() []*core.QByteArray {
 func (ptr *QNetworkReply) Manager() *QNetworkAccessManager {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQNetworkAccessManagerFromPointer(C.QNetworkReply_Manager(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11420,7 +11468,7 @@ func (ptr *QNetworkReply) ReadBufferSize() int64 {
 
 //export callbackQNetworkReply_SslConfigurationImplementation
 func callbackQNetworkReply_SslConfigurationImplementation(ptr unsafe.Pointer, configuration unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sslConfigurationImplementation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sslConfigurationImplementation"); signal != nil {
 		signal.(func(*QSslConfiguration))(NewQSslConfigurationFromPointer(configuration))
 	} else {
 		NewQNetworkReplyFromPointer(ptr).SslConfigurationImplementationDefault(NewQSslConfigurationFromPointer(configuration))
@@ -11430,14 +11478,14 @@ func callbackQNetworkReply_SslConfigurationImplementation(ptr unsafe.Pointer, co
 func (ptr *QNetworkReply) ConnectSslConfigurationImplementation(f func(configuration *QSslConfiguration)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sslConfigurationImplementation", f)
+		qt.ConnectSignal(ptr.Pointer(), "sslConfigurationImplementation", f)
 	}
 }
 
 func (ptr *QNetworkReply) DisconnectSslConfigurationImplementation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sslConfigurationImplementation")
+		qt.DisconnectSignal(ptr.Pointer(), "sslConfigurationImplementation")
 	}
 }
 
@@ -11551,7 +11599,7 @@ func (ptr *QNetworkReply) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QNetworkReply) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkReply___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11572,7 +11620,7 @@ func (ptr *QNetworkReply) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QNetworkReply) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkReply___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11593,7 +11641,7 @@ func (ptr *QNetworkReply) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QNetworkReply) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkReply___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11614,7 +11662,7 @@ func (ptr *QNetworkReply) __findChildren_newList() unsafe.Pointer {
 func (ptr *QNetworkReply) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkReply___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11634,7 +11682,7 @@ func (ptr *QNetworkReply) __children_newList() unsafe.Pointer {
 
 //export callbackQNetworkReply_Open
 func callbackQNetworkReply_Open(ptr unsafe.Pointer, mode C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "open"); signal != nil {
+	if signal := qt.GetSignal(ptr, "open"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(core.QIODevice__OpenModeFlag) bool)(core.QIODevice__OpenModeFlag(mode)))))
 	}
 
@@ -11650,7 +11698,7 @@ func (ptr *QNetworkReply) OpenDefault(mode core.QIODevice__OpenModeFlag) bool {
 
 //export callbackQNetworkReply_Reset
 func callbackQNetworkReply_Reset(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -11666,7 +11714,7 @@ func (ptr *QNetworkReply) ResetDefault() bool {
 
 //export callbackQNetworkReply_Seek
 func callbackQNetworkReply_Seek(ptr unsafe.Pointer, pos C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seek"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seek"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int64) bool)(int64(pos)))))
 	}
 
@@ -11682,7 +11730,7 @@ func (ptr *QNetworkReply) SeekDefault(pos int64) bool {
 
 //export callbackQNetworkReply_WaitForBytesWritten
 func callbackQNetworkReply_WaitForBytesWritten(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForBytesWritten"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -11698,7 +11746,7 @@ func (ptr *QNetworkReply) WaitForBytesWrittenDefault(msecs int) bool {
 
 //export callbackQNetworkReply_WaitForReadyRead
 func callbackQNetworkReply_WaitForReadyRead(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForReadyRead"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -11714,18 +11762,21 @@ func (ptr *QNetworkReply) WaitForReadyReadDefault(msecs int) bool {
 
 //export callbackQNetworkReply_ReadData
 func callbackQNetworkReply_ReadData(ptr unsafe.Pointer, data C.struct_QtNetwork_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "readData"); signal != nil {
 		var retS = cGoUnpackString(data)
 		var ret = C.longlong(signal.(func(*string, int64) int64)(&retS, int64(maxSize)))
 		if ret > 0 {
-			C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+			copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 		}
 		return ret
 	}
 	var retS = cGoUnpackString(data)
 	var ret = C.longlong(NewQNetworkReplyFromPointer(ptr).ReadDataDefault(&retS, int64(maxSize)))
 	if ret > 0 {
-		C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+		copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 	}
 	return ret
 }
@@ -11758,7 +11809,7 @@ func (ptr *QNetworkReply) ReadDataDefault(data *string, maxSize int64) int64 {
 
 //export callbackQNetworkReply_ReadLineData
 func callbackQNetworkReply_ReadLineData(ptr unsafe.Pointer, data C.struct_QtNetwork_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readLineData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readLineData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(maxSize)))
 	}
 
@@ -11776,7 +11827,10 @@ func (ptr *QNetworkReply) ReadLineDataDefault(data string, maxSize int64) int64
 
 //export callbackQNetworkReply_WriteData
 func callbackQNetworkReply_WriteData(ptr unsafe.Pointer, data C.struct_QtNetwork_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "writeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "writeDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "writeData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(maxSize)))
 	}
 
@@ -11803,7 +11857,7 @@ func (ptr *QNetworkReply) WriteDataDefault(data string, maxSize int64) int64 {
 
 //export callbackQNetworkReply_AboutToClose
 func callbackQNetworkReply_AboutToClose(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aboutToClose"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aboutToClose"); signal != nil {
 		signal.(func())()
 	}
 
@@ -11811,7 +11865,7 @@ func callbackQNetworkReply_AboutToClose(ptr unsafe.Pointer) {
 
 //export callbackQNetworkReply_BytesWritten
 func callbackQNetworkReply_BytesWritten(ptr unsafe.Pointer, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesWritten"); signal != nil {
 		signal.(func(int64))(int64(bytes))
 	}
 
@@ -11819,7 +11873,7 @@ func callbackQNetworkReply_BytesWritten(ptr unsafe.Pointer, bytes C.longlong) {
 
 //export callbackQNetworkReply_ChannelBytesWritten
 func callbackQNetworkReply_ChannelBytesWritten(ptr unsafe.Pointer, channel C.int, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelBytesWritten"); signal != nil {
 		signal.(func(int, int64))(int(int32(channel)), int64(bytes))
 	}
 
@@ -11827,7 +11881,7 @@ func callbackQNetworkReply_ChannelBytesWritten(ptr unsafe.Pointer, channel C.int
 
 //export callbackQNetworkReply_ChannelReadyRead
 func callbackQNetworkReply_ChannelReadyRead(ptr unsafe.Pointer, channel C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelReadyRead"); signal != nil {
 		signal.(func(int))(int(int32(channel)))
 	}
 
@@ -11835,7 +11889,7 @@ func callbackQNetworkReply_ChannelReadyRead(ptr unsafe.Pointer, channel C.int) {
 
 //export callbackQNetworkReply_ReadChannelFinished
 func callbackQNetworkReply_ReadChannelFinished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readChannelFinished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readChannelFinished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -11843,7 +11897,7 @@ func callbackQNetworkReply_ReadChannelFinished(ptr unsafe.Pointer) {
 
 //export callbackQNetworkReply_ReadyRead
 func callbackQNetworkReply_ReadyRead(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readyRead"); signal != nil {
 		signal.(func())()
 	}
 
@@ -11851,7 +11905,7 @@ func callbackQNetworkReply_ReadyRead(ptr unsafe.Pointer) {
 
 //export callbackQNetworkReply_AtEnd
 func callbackQNetworkReply_AtEnd(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "atEnd"); signal != nil {
+	if signal := qt.GetSignal(ptr, "atEnd"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -11867,7 +11921,7 @@ func (ptr *QNetworkReply) AtEndDefault() bool {
 
 //export callbackQNetworkReply_CanReadLine
 func callbackQNetworkReply_CanReadLine(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canReadLine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canReadLine"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -11883,7 +11937,7 @@ func (ptr *QNetworkReply) CanReadLineDefault() bool {
 
 //export callbackQNetworkReply_IsSequential
 func callbackQNetworkReply_IsSequential(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isSequential"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isSequential"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -11899,7 +11953,7 @@ func (ptr *QNetworkReply) IsSequentialDefault() bool {
 
 //export callbackQNetworkReply_BytesAvailable
 func callbackQNetworkReply_BytesAvailable(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesAvailable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesAvailable"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -11915,7 +11969,7 @@ func (ptr *QNetworkReply) BytesAvailableDefault() int64 {
 
 //export callbackQNetworkReply_BytesToWrite
 func callbackQNetworkReply_BytesToWrite(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesToWrite"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesToWrite"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -11931,7 +11985,7 @@ func (ptr *QNetworkReply) BytesToWriteDefault() int64 {
 
 //export callbackQNetworkReply_Pos
 func callbackQNetworkReply_Pos(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pos"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pos"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -11947,7 +12001,7 @@ func (ptr *QNetworkReply) PosDefault() int64 {
 
 //export callbackQNetworkReply_Size
 func callbackQNetworkReply_Size(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -11963,7 +12017,7 @@ func (ptr *QNetworkReply) SizeDefault() int64 {
 
 //export callbackQNetworkReply_Event
 func callbackQNetworkReply_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -11979,7 +12033,7 @@ func (ptr *QNetworkReply) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQNetworkReply_EventFilter
 func callbackQNetworkReply_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -11995,7 +12049,7 @@ func (ptr *QNetworkReply) EventFilterDefault(watched core.QObject_ITF, event cor
 
 //export callbackQNetworkReply_ChildEvent
 func callbackQNetworkReply_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQNetworkReplyFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -12010,7 +12064,7 @@ func (ptr *QNetworkReply) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQNetworkReply_ConnectNotify
 func callbackQNetworkReply_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkReplyFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -12025,7 +12079,7 @@ func (ptr *QNetworkReply) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQNetworkReply_CustomEvent
 func callbackQNetworkReply_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQNetworkReplyFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -12040,7 +12094,7 @@ func (ptr *QNetworkReply) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQNetworkReply_DeleteLater
 func callbackQNetworkReply_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkReplyFromPointer(ptr).DeleteLaterDefault()
@@ -12050,14 +12104,14 @@ func callbackQNetworkReply_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QNetworkReply) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QNetworkReply_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQNetworkReply_Destroyed
 func callbackQNetworkReply_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -12065,7 +12119,7 @@ func callbackQNetworkReply_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQNetworkReply_DisconnectNotify
 func callbackQNetworkReply_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkReplyFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -12080,7 +12134,7 @@ func (ptr *QNetworkReply) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQNetworkReply_ObjectNameChanged
 func callbackQNetworkReply_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -12088,7 +12142,7 @@ func callbackQNetworkReply_ObjectNameChanged(ptr unsafe.Pointer, objectName C.st
 
 //export callbackQNetworkReply_TimerEvent
 func callbackQNetworkReply_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQNetworkReplyFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -12103,7 +12157,7 @@ func (ptr *QNetworkReply) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQNetworkReply_MetaObject
 func callbackQNetworkReply_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -12325,13 +12379,13 @@ func (ptr *QNetworkRequest) RawHeader(headerName core.QByteArray_ITF) *core.QByt
 
 func (ptr *QNetworkRequest) RawHeaderList() []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtNetwork_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQNetworkRequestFromPointer(l.data).__rawHeaderList_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QNetworkRequest_RawHeaderList(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QNetworkRequest_RawHeaderList(ptr.Pointer())))
 	}
 	return make([]*core.QByteArray, 0)
 }
@@ -12339,7 +12393,7 @@ func (ptr *QNetworkRequest) RawHeaderList() []*core.QByteArray {
 func (ptr *QNetworkRequest) OriginatingObject() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkRequest_OriginatingObject(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12492,7 +12546,7 @@ const (
 
 func NewQNetworkSession(connectionConfig QNetworkConfiguration_ITF, parent core.QObject_ITF) *QNetworkSession {
 	var tmpValue = NewQNetworkSessionFromPointer(C.QNetworkSession_NewQNetworkSession(PointerFromQNetworkConfiguration(connectionConfig), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -12507,7 +12561,7 @@ func (ptr *QNetworkSession) WaitForOpened(msecs int) bool {
 
 //export callbackQNetworkSession_Accept
 func callbackQNetworkSession_Accept(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accept"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accept"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkSessionFromPointer(ptr).AcceptDefault()
@@ -12517,14 +12571,14 @@ func callbackQNetworkSession_Accept(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectAccept(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "accept", f)
+		qt.ConnectSignal(ptr.Pointer(), "accept", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectAccept() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "accept")
+		qt.DisconnectSignal(ptr.Pointer(), "accept")
 	}
 }
 
@@ -12542,7 +12596,7 @@ func (ptr *QNetworkSession) AcceptDefault() {
 
 //export callbackQNetworkSession_Close
 func callbackQNetworkSession_Close(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkSessionFromPointer(ptr).CloseDefault()
@@ -12552,14 +12606,14 @@ func callbackQNetworkSession_Close(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectClose(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "close", f)
+		qt.ConnectSignal(ptr.Pointer(), "close", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectClose() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "close")
+		qt.DisconnectSignal(ptr.Pointer(), "close")
 	}
 }
 
@@ -12577,7 +12631,7 @@ func (ptr *QNetworkSession) CloseDefault() {
 
 //export callbackQNetworkSession_Closed
 func callbackQNetworkSession_Closed(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closed"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12586,14 +12640,14 @@ func callbackQNetworkSession_Closed(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectClosed(f func()) {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_ConnectClosed(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "closed", f)
+		qt.ConnectSignal(ptr.Pointer(), "closed", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectClosed() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DisconnectClosed(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "closed")
+		qt.DisconnectSignal(ptr.Pointer(), "closed")
 	}
 }
 
@@ -12605,7 +12659,7 @@ func (ptr *QNetworkSession) Closed() {
 
 //export callbackQNetworkSession_Error2
 func callbackQNetworkSession_Error2(ptr unsafe.Pointer, error C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "error2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "error2"); signal != nil {
 		signal.(func(QNetworkSession__SessionError))(QNetworkSession__SessionError(error))
 	}
 
@@ -12614,14 +12668,14 @@ func callbackQNetworkSession_Error2(ptr unsafe.Pointer, error C.longlong) {
 func (ptr *QNetworkSession) ConnectError2(f func(error QNetworkSession__SessionError)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_ConnectError2(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "error2", f)
+		qt.ConnectSignal(ptr.Pointer(), "error2", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectError2() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DisconnectError2(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "error2")
+		qt.DisconnectSignal(ptr.Pointer(), "error2")
 	}
 }
 
@@ -12633,7 +12687,7 @@ func (ptr *QNetworkSession) Error2(error QNetworkSession__SessionError) {
 
 //export callbackQNetworkSession_Ignore
 func callbackQNetworkSession_Ignore(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "ignore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "ignore"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkSessionFromPointer(ptr).IgnoreDefault()
@@ -12643,14 +12697,14 @@ func callbackQNetworkSession_Ignore(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectIgnore(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "ignore", f)
+		qt.ConnectSignal(ptr.Pointer(), "ignore", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectIgnore() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "ignore")
+		qt.DisconnectSignal(ptr.Pointer(), "ignore")
 	}
 }
 
@@ -12668,7 +12722,7 @@ func (ptr *QNetworkSession) IgnoreDefault() {
 
 //export callbackQNetworkSession_Migrate
 func callbackQNetworkSession_Migrate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "migrate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "migrate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkSessionFromPointer(ptr).MigrateDefault()
@@ -12678,14 +12732,14 @@ func callbackQNetworkSession_Migrate(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectMigrate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "migrate", f)
+		qt.ConnectSignal(ptr.Pointer(), "migrate", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectMigrate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "migrate")
+		qt.DisconnectSignal(ptr.Pointer(), "migrate")
 	}
 }
 
@@ -12703,7 +12757,7 @@ func (ptr *QNetworkSession) MigrateDefault() {
 
 //export callbackQNetworkSession_NewConfigurationActivated
 func callbackQNetworkSession_NewConfigurationActivated(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "newConfigurationActivated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "newConfigurationActivated"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12712,14 +12766,14 @@ func callbackQNetworkSession_NewConfigurationActivated(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectNewConfigurationActivated(f func()) {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_ConnectNewConfigurationActivated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "newConfigurationActivated", f)
+		qt.ConnectSignal(ptr.Pointer(), "newConfigurationActivated", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectNewConfigurationActivated() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DisconnectNewConfigurationActivated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "newConfigurationActivated")
+		qt.DisconnectSignal(ptr.Pointer(), "newConfigurationActivated")
 	}
 }
 
@@ -12731,7 +12785,7 @@ func (ptr *QNetworkSession) NewConfigurationActivated() {
 
 //export callbackQNetworkSession_Open
 func callbackQNetworkSession_Open(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "open"); signal != nil {
+	if signal := qt.GetSignal(ptr, "open"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkSessionFromPointer(ptr).OpenDefault()
@@ -12741,14 +12795,14 @@ func callbackQNetworkSession_Open(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectOpen(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "open", f)
+		qt.ConnectSignal(ptr.Pointer(), "open", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectOpen() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "open")
+		qt.DisconnectSignal(ptr.Pointer(), "open")
 	}
 }
 
@@ -12766,7 +12820,7 @@ func (ptr *QNetworkSession) OpenDefault() {
 
 //export callbackQNetworkSession_Opened
 func callbackQNetworkSession_Opened(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "opened"); signal != nil {
+	if signal := qt.GetSignal(ptr, "opened"); signal != nil {
 		signal.(func())()
 	}
 
@@ -12775,14 +12829,14 @@ func callbackQNetworkSession_Opened(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectOpened(f func()) {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_ConnectOpened(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "opened", f)
+		qt.ConnectSignal(ptr.Pointer(), "opened", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectOpened() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DisconnectOpened(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "opened")
+		qt.DisconnectSignal(ptr.Pointer(), "opened")
 	}
 }
 
@@ -12794,7 +12848,7 @@ func (ptr *QNetworkSession) Opened() {
 
 //export callbackQNetworkSession_PreferredConfigurationChanged
 func callbackQNetworkSession_PreferredConfigurationChanged(ptr unsafe.Pointer, config unsafe.Pointer, isSeamless C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "preferredConfigurationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "preferredConfigurationChanged"); signal != nil {
 		signal.(func(*QNetworkConfiguration, bool))(NewQNetworkConfigurationFromPointer(config), int8(isSeamless) != 0)
 	}
 
@@ -12803,14 +12857,14 @@ func callbackQNetworkSession_PreferredConfigurationChanged(ptr unsafe.Pointer, c
 func (ptr *QNetworkSession) ConnectPreferredConfigurationChanged(f func(config *QNetworkConfiguration, isSeamless bool)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_ConnectPreferredConfigurationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "preferredConfigurationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "preferredConfigurationChanged", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectPreferredConfigurationChanged() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DisconnectPreferredConfigurationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "preferredConfigurationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "preferredConfigurationChanged")
 	}
 }
 
@@ -12822,7 +12876,7 @@ func (ptr *QNetworkSession) PreferredConfigurationChanged(config QNetworkConfigu
 
 //export callbackQNetworkSession_Reject
 func callbackQNetworkSession_Reject(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reject"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkSessionFromPointer(ptr).RejectDefault()
@@ -12832,14 +12886,14 @@ func callbackQNetworkSession_Reject(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectReject(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reject", f)
+		qt.ConnectSignal(ptr.Pointer(), "reject", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectReject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reject")
+		qt.DisconnectSignal(ptr.Pointer(), "reject")
 	}
 }
 
@@ -12865,7 +12919,7 @@ func (ptr *QNetworkSession) SetSessionProperty(key string, value core.QVariant_I
 
 //export callbackQNetworkSession_StateChanged
 func callbackQNetworkSession_StateChanged(ptr unsafe.Pointer, state C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stateChanged"); signal != nil {
 		signal.(func(QNetworkSession__State))(QNetworkSession__State(state))
 	}
 
@@ -12874,14 +12928,14 @@ func callbackQNetworkSession_StateChanged(ptr unsafe.Pointer, state C.longlong)
 func (ptr *QNetworkSession) ConnectStateChanged(f func(state QNetworkSession__State)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_ConnectStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "stateChanged", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DisconnectStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "stateChanged")
 	}
 }
 
@@ -12893,7 +12947,7 @@ func (ptr *QNetworkSession) StateChanged(state QNetworkSession__State) {
 
 //export callbackQNetworkSession_Stop
 func callbackQNetworkSession_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkSessionFromPointer(ptr).StopDefault()
@@ -12903,14 +12957,14 @@ func callbackQNetworkSession_Stop(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -12928,7 +12982,7 @@ func (ptr *QNetworkSession) StopDefault() {
 
 //export callbackQNetworkSession_UsagePoliciesChanged
 func callbackQNetworkSession_UsagePoliciesChanged(ptr unsafe.Pointer, usagePolicies C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "usagePoliciesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "usagePoliciesChanged"); signal != nil {
 		signal.(func(QNetworkSession__UsagePolicy))(QNetworkSession__UsagePolicy(usagePolicies))
 	}
 
@@ -12937,14 +12991,14 @@ func callbackQNetworkSession_UsagePoliciesChanged(ptr unsafe.Pointer, usagePolic
 func (ptr *QNetworkSession) ConnectUsagePoliciesChanged(f func(usagePolicies QNetworkSession__UsagePolicy)) {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_ConnectUsagePoliciesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "usagePoliciesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "usagePoliciesChanged", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectUsagePoliciesChanged() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DisconnectUsagePoliciesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "usagePoliciesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "usagePoliciesChanged")
 	}
 }
 
@@ -12956,7 +13010,7 @@ func (ptr *QNetworkSession) UsagePoliciesChanged(usagePolicies QNetworkSession__
 
 //export callbackQNetworkSession_DestroyQNetworkSession
 func callbackQNetworkSession_DestroyQNetworkSession(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QNetworkSession"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QNetworkSession"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkSessionFromPointer(ptr).DestroyQNetworkSessionDefault()
@@ -12966,21 +13020,21 @@ func callbackQNetworkSession_DestroyQNetworkSession(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) ConnectDestroyQNetworkSession(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QNetworkSession", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QNetworkSession", f)
 	}
 }
 
 func (ptr *QNetworkSession) DisconnectDestroyQNetworkSession() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QNetworkSession")
+		qt.DisconnectSignal(ptr.Pointer(), "~QNetworkSession")
 	}
 }
 
 func (ptr *QNetworkSession) DestroyQNetworkSession() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DestroyQNetworkSession(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12988,7 +13042,7 @@ func (ptr *QNetworkSession) DestroyQNetworkSession() {
 func (ptr *QNetworkSession) DestroyQNetworkSessionDefault() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DestroyQNetworkSessionDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13100,7 +13154,7 @@ func (ptr *QNetworkSession) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QNetworkSession) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkSession___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13121,7 +13175,7 @@ func (ptr *QNetworkSession) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QNetworkSession) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkSession___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13142,7 +13196,7 @@ func (ptr *QNetworkSession) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QNetworkSession) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkSession___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13163,7 +13217,7 @@ func (ptr *QNetworkSession) __findChildren_newList() unsafe.Pointer {
 func (ptr *QNetworkSession) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QNetworkSession___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13183,7 +13237,7 @@ func (ptr *QNetworkSession) __children_newList() unsafe.Pointer {
 
 //export callbackQNetworkSession_Event
 func callbackQNetworkSession_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -13199,7 +13253,7 @@ func (ptr *QNetworkSession) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQNetworkSession_EventFilter
 func callbackQNetworkSession_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -13215,7 +13269,7 @@ func (ptr *QNetworkSession) EventFilterDefault(watched core.QObject_ITF, event c
 
 //export callbackQNetworkSession_ChildEvent
 func callbackQNetworkSession_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQNetworkSessionFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -13230,7 +13284,7 @@ func (ptr *QNetworkSession) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQNetworkSession_ConnectNotify
 func callbackQNetworkSession_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkSessionFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -13245,7 +13299,7 @@ func (ptr *QNetworkSession) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQNetworkSession_CustomEvent
 func callbackQNetworkSession_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQNetworkSessionFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -13260,7 +13314,7 @@ func (ptr *QNetworkSession) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQNetworkSession_DeleteLater
 func callbackQNetworkSession_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQNetworkSessionFromPointer(ptr).DeleteLaterDefault()
@@ -13270,14 +13324,14 @@ func callbackQNetworkSession_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QNetworkSession) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QNetworkSession_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQNetworkSession_Destroyed
 func callbackQNetworkSession_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -13285,7 +13339,7 @@ func callbackQNetworkSession_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQNetworkSession_DisconnectNotify
 func callbackQNetworkSession_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQNetworkSessionFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -13300,7 +13354,7 @@ func (ptr *QNetworkSession) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQNetworkSession_ObjectNameChanged
 func callbackQNetworkSession_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -13308,7 +13362,7 @@ func callbackQNetworkSession_ObjectNameChanged(ptr unsafe.Pointer, objectName C.
 
 //export callbackQNetworkSession_TimerEvent
 func callbackQNetworkSession_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQNetworkSessionFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -13323,7 +13377,7 @@ func (ptr *QNetworkSession) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQNetworkSession_MetaObject
 func callbackQNetworkSession_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -13809,26 +13863,26 @@ func (ptr *QSslCertificate) ExpiryDate() *core.QDateTime {
 
 func (ptr *QSslCertificate) IssuerInfoAttributes() []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtNetwork_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQSslCertificateFromPointer(l.data).__issuerInfoAttributes_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QSslCertificate_IssuerInfoAttributes(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QSslCertificate_IssuerInfoAttributes(ptr.Pointer())))
 	}
 	return make([]*core.QByteArray, 0)
 }
 
 func (ptr *QSslCertificate) SubjectInfoAttributes() []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtNetwork_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQSslCertificateFromPointer(l.data).__subjectInfoAttributes_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QSslCertificate_SubjectInfoAttributes(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QSslCertificate_SubjectInfoAttributes(ptr.Pointer())))
 	}
 	return make([]*core.QByteArray, 0)
 }
@@ -13877,28 +13931,28 @@ func (ptr *QSslCertificate) ToText() string {
 
 func (ptr *QSslCertificate) IssuerInfo(subject QSslCertificate__SubjectInfo) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSslCertificate_IssuerInfo(ptr.Pointer(), C.longlong(subject))), "|")
+		return cGoUnpackStringListAndFree(C.QSslCertificate_IssuerInfo(ptr.Pointer(), C.longlong(subject)))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSslCertificate) IssuerInfo2(attribute core.QByteArray_ITF) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSslCertificate_IssuerInfo2(ptr.Pointer(), core.PointerFromQByteArray(attribute))), "|")
+		return cGoUnpackStringListAndFree(C.QSslCertificate_IssuerInfo2(ptr.Pointer(), core.PointerFromQByteArray(attribute)))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSslCertificate) SubjectInfo(subject QSslCertificate__SubjectInfo) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSslCertificate_SubjectInfo(ptr.Pointer(), C.longlong(subject))), "|")
+		return cGoUnpackStringListAndFree(C.QSslCertificate_SubjectInfo(ptr.Pointer(), C.longlong(subject)))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSslCertificate) SubjectInfo2(attribute core.QByteArray_ITF) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSslCertificate_SubjectInfo2(ptr.Pointer(), core.PointerFromQByteArray(attribute))), "|")
+		return cGoUnpackStringListAndFree(C.QSslCertificate_SubjectInfo2(ptr.Pointer(), core.PointerFromQByteArray(attribute)))
 	}
 	return make([]string, 0)
 }
@@ -14667,13 +14721,13 @@ func (ptr *QSslConfiguration) SessionTicket() *core.QByteArray {
 
 func (ptr *QSslConfiguration) AllowedNextProtocols() []*core.QByteArray {
 	if ptr.Pointer() != nil {
-		return func(l C.struct_QtNetwork_PackedList) []*core.QByteArray {
-			var out = make([]*core.QByteArray, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQSslConfigurationFromPointer(l.data).__allowedNextProtocols_atList(i)
+		return func(l []string) []*core.QByteArray {
+			var out = make([]*core.QByteArray, len(l))
+			for i, v := range l {
+				out[i] = core.NewQByteArray2(v, len(v))
 			}
 			return out
-		}(C.QSslConfiguration_AllowedNextProtocols(ptr.Pointer()))
+		}(cGoUnpackStringListAndFree(C.QSslConfiguration_AllowedNextProtocols(ptr.Pointer())))
 	}
 	return make([]*core.QByteArray, 0)
 }
@@ -15787,7 +15841,7 @@ const (
 
 func NewQSslSocket(parent core.QObject_ITF) *QSslSocket {
 	var tmpValue = NewQSslSocketFromPointer(C.QSslSocket_NewQSslSocket(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -15927,7 +15981,7 @@ func (ptr *QSslSocket) ConnectToHostEncrypted2(hostName string, port uint16, ssl
 
 //export callbackQSslSocket_Encrypted
 func callbackQSslSocket_Encrypted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "encrypted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "encrypted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -15936,14 +15990,14 @@ func callbackQSslSocket_Encrypted(ptr unsafe.Pointer) {
 func (ptr *QSslSocket) ConnectEncrypted(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_ConnectEncrypted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "encrypted", f)
+		qt.ConnectSignal(ptr.Pointer(), "encrypted", f)
 	}
 }
 
 func (ptr *QSslSocket) DisconnectEncrypted() {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_DisconnectEncrypted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "encrypted")
+		qt.DisconnectSignal(ptr.Pointer(), "encrypted")
 	}
 }
 
@@ -15955,7 +16009,7 @@ func (ptr *QSslSocket) Encrypted() {
 
 //export callbackQSslSocket_EncryptedBytesWritten
 func callbackQSslSocket_EncryptedBytesWritten(ptr unsafe.Pointer, written C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "encryptedBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "encryptedBytesWritten"); signal != nil {
 		signal.(func(int64))(int64(written))
 	}
 
@@ -15964,14 +16018,14 @@ func callbackQSslSocket_EncryptedBytesWritten(ptr unsafe.Pointer, written C.long
 func (ptr *QSslSocket) ConnectEncryptedBytesWritten(f func(written int64)) {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_ConnectEncryptedBytesWritten(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "encryptedBytesWritten", f)
+		qt.ConnectSignal(ptr.Pointer(), "encryptedBytesWritten", f)
 	}
 }
 
 func (ptr *QSslSocket) DisconnectEncryptedBytesWritten() {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_DisconnectEncryptedBytesWritten(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "encryptedBytesWritten")
+		qt.DisconnectSignal(ptr.Pointer(), "encryptedBytesWritten")
 	}
 }
 
@@ -15983,7 +16037,7 @@ func (ptr *QSslSocket) EncryptedBytesWritten(written int64) {
 
 //export callbackQSslSocket_IgnoreSslErrors
 func callbackQSslSocket_IgnoreSslErrors(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "ignoreSslErrors"); signal != nil {
+	if signal := qt.GetSignal(ptr, "ignoreSslErrors"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSslSocketFromPointer(ptr).IgnoreSslErrorsDefault()
@@ -15993,14 +16047,14 @@ func callbackQSslSocket_IgnoreSslErrors(ptr unsafe.Pointer) {
 func (ptr *QSslSocket) ConnectIgnoreSslErrors(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "ignoreSslErrors", f)
+		qt.ConnectSignal(ptr.Pointer(), "ignoreSslErrors", f)
 	}
 }
 
 func (ptr *QSslSocket) DisconnectIgnoreSslErrors() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "ignoreSslErrors")
+		qt.DisconnectSignal(ptr.Pointer(), "ignoreSslErrors")
 	}
 }
 
@@ -16030,7 +16084,7 @@ func (ptr *QSslSocket) IgnoreSslErrors2(errors []*QSslError) {
 
 //export callbackQSslSocket_ModeChanged
 func callbackQSslSocket_ModeChanged(ptr unsafe.Pointer, mode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modeChanged"); signal != nil {
 		signal.(func(QSslSocket__SslMode))(QSslSocket__SslMode(mode))
 	}
 
@@ -16039,14 +16093,14 @@ func callbackQSslSocket_ModeChanged(ptr unsafe.Pointer, mode C.longlong) {
 func (ptr *QSslSocket) ConnectModeChanged(f func(mode QSslSocket__SslMode)) {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_ConnectModeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "modeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "modeChanged", f)
 	}
 }
 
 func (ptr *QSslSocket) DisconnectModeChanged() {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_DisconnectModeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "modeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "modeChanged")
 	}
 }
 
@@ -16058,7 +16112,7 @@ func (ptr *QSslSocket) ModeChanged(mode QSslSocket__SslMode) {
 
 //export callbackQSslSocket_PeerVerifyError
 func callbackQSslSocket_PeerVerifyError(ptr unsafe.Pointer, error unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "peerVerifyError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "peerVerifyError"); signal != nil {
 		signal.(func(*QSslError))(NewQSslErrorFromPointer(error))
 	}
 
@@ -16067,14 +16121,14 @@ func callbackQSslSocket_PeerVerifyError(ptr unsafe.Pointer, error unsafe.Pointer
 func (ptr *QSslSocket) ConnectPeerVerifyError(f func(error *QSslError)) {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_ConnectPeerVerifyError(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "peerVerifyError", f)
+		qt.ConnectSignal(ptr.Pointer(), "peerVerifyError", f)
 	}
 }
 
 func (ptr *QSslSocket) DisconnectPeerVerifyError() {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_DisconnectPeerVerifyError(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "peerVerifyError")
+		qt.DisconnectSignal(ptr.Pointer(), "peerVerifyError")
 	}
 }
 
@@ -16086,7 +16140,7 @@ func (ptr *QSslSocket) PeerVerifyError(error QSslError_ITF) {
 
 //export callbackQSslSocket_PreSharedKeyAuthenticationRequired
 func callbackQSslSocket_PreSharedKeyAuthenticationRequired(ptr unsafe.Pointer, authenticator unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "preSharedKeyAuthenticationRequired"); signal != nil {
+	if signal := qt.GetSignal(ptr, "preSharedKeyAuthenticationRequired"); signal != nil {
 		signal.(func(*QSslPreSharedKeyAuthenticator))(NewQSslPreSharedKeyAuthenticatorFromPointer(authenticator))
 	}
 
@@ -16095,14 +16149,14 @@ func callbackQSslSocket_PreSharedKeyAuthenticationRequired(ptr unsafe.Pointer, a
 func (ptr *QSslSocket) ConnectPreSharedKeyAuthenticationRequired(f func(authenticator *QSslPreSharedKeyAuthenticator)) {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_ConnectPreSharedKeyAuthenticationRequired(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "preSharedKeyAuthenticationRequired", f)
+		qt.ConnectSignal(ptr.Pointer(), "preSharedKeyAuthenticationRequired", f)
 	}
 }
 
 func (ptr *QSslSocket) DisconnectPreSharedKeyAuthenticationRequired() {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_DisconnectPreSharedKeyAuthenticationRequired(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "preSharedKeyAuthenticationRequired")
+		qt.DisconnectSignal(ptr.Pointer(), "preSharedKeyAuthenticationRequired")
 	}
 }
 
@@ -16186,7 +16240,7 @@ func (ptr *QSslSocket) SetSslConfiguration(configuration QSslConfiguration_ITF)
 
 //export callbackQSslSocket_SslErrors2
 func callbackQSslSocket_SslErrors2(ptr unsafe.Pointer, errors C.struct_QtNetwork_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sslErrors2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sslErrors2"); signal != nil {
 		signal.(func([]*QSslError))(func(l C.struct_QtNetwork_PackedList) []*QSslError {
 			var out = make([]*QSslError, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -16201,14 +16255,14 @@ func callbackQSslSocket_SslErrors2(ptr unsafe.Pointer, errors C.struct_QtNetwork
 func (ptr *QSslSocket) ConnectSslErrors2(f func(errors []*QSslError)) {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_ConnectSslErrors2(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sslErrors2", f)
+		qt.ConnectSignal(ptr.Pointer(), "sslErrors2", f)
 	}
 }
 
 func (ptr *QSslSocket) DisconnectSslErrors2() {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_DisconnectSslErrors2(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sslErrors2")
+		qt.DisconnectSignal(ptr.Pointer(), "sslErrors2")
 	}
 }
 
@@ -16226,7 +16280,7 @@ func (ptr *QSslSocket) SslErrors2(errors []*QSslError) {
 
 //export callbackQSslSocket_StartClientEncryption
 func callbackQSslSocket_StartClientEncryption(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startClientEncryption"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startClientEncryption"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSslSocketFromPointer(ptr).StartClientEncryptionDefault()
@@ -16236,14 +16290,14 @@ func callbackQSslSocket_StartClientEncryption(ptr unsafe.Pointer) {
 func (ptr *QSslSocket) ConnectStartClientEncryption(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startClientEncryption", f)
+		qt.ConnectSignal(ptr.Pointer(), "startClientEncryption", f)
 	}
 }
 
 func (ptr *QSslSocket) DisconnectStartClientEncryption() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startClientEncryption")
+		qt.DisconnectSignal(ptr.Pointer(), "startClientEncryption")
 	}
 }
 
@@ -16261,7 +16315,7 @@ func (ptr *QSslSocket) StartClientEncryptionDefault() {
 
 //export callbackQSslSocket_StartServerEncryption
 func callbackQSslSocket_StartServerEncryption(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startServerEncryption"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startServerEncryption"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSslSocketFromPointer(ptr).StartServerEncryptionDefault()
@@ -16271,14 +16325,14 @@ func callbackQSslSocket_StartServerEncryption(ptr unsafe.Pointer) {
 func (ptr *QSslSocket) ConnectStartServerEncryption(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startServerEncryption", f)
+		qt.ConnectSignal(ptr.Pointer(), "startServerEncryption", f)
 	}
 }
 
 func (ptr *QSslSocket) DisconnectStartServerEncryption() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startServerEncryption")
+		qt.DisconnectSignal(ptr.Pointer(), "startServerEncryption")
 	}
 }
 
@@ -16297,7 +16351,7 @@ func (ptr *QSslSocket) StartServerEncryptionDefault() {
 func (ptr *QSslSocket) DestroyQSslSocket() {
 	if ptr.Pointer() != nil {
 		C.QSslSocket_DestroyQSslSocket(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -16831,7 +16885,7 @@ func NewQTcpServerFromPointer(ptr unsafe.Pointer) *QTcpServer {
 }
 func NewQTcpServer(parent core.QObject_ITF) *QTcpServer {
 	var tmpValue = NewQTcpServerFromPointer(C.QTcpServer_NewQTcpServer(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -16839,7 +16893,7 @@ func NewQTcpServer(parent core.QObject_ITF) *QTcpServer {
 
 //export callbackQTcpServer_NextPendingConnection
 func callbackQTcpServer_NextPendingConnection(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nextPendingConnection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nextPendingConnection"); signal != nil {
 		return PointerFromQTcpSocket(signal.(func() *QTcpSocket)())
 	}
 
@@ -16849,21 +16903,21 @@ func callbackQTcpServer_NextPendingConnection(ptr unsafe.Pointer) unsafe.Pointer
 func (ptr *QTcpServer) ConnectNextPendingConnection(f func() *QTcpSocket) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "nextPendingConnection", f)
+		qt.ConnectSignal(ptr.Pointer(), "nextPendingConnection", f)
 	}
 }
 
 func (ptr *QTcpServer) DisconnectNextPendingConnection() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "nextPendingConnection")
+		qt.DisconnectSignal(ptr.Pointer(), "nextPendingConnection")
 	}
 }
 
 func (ptr *QTcpServer) NextPendingConnection() *QTcpSocket {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTcpSocketFromPointer(C.QTcpServer_NextPendingConnection(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -16874,7 +16928,7 @@ func (ptr *QTcpServer) NextPendingConnection() *QTcpSocket {
 func (ptr *QTcpServer) NextPendingConnectionDefault() *QTcpSocket {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTcpSocketFromPointer(C.QTcpServer_NextPendingConnectionDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -16898,7 +16952,7 @@ func (ptr *QTcpServer) WaitForNewConnection(msec int, timedOut bool) bool {
 
 //export callbackQTcpServer_AcceptError
 func callbackQTcpServer_AcceptError(ptr unsafe.Pointer, socketError C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "acceptError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "acceptError"); signal != nil {
 		signal.(func(QAbstractSocket__SocketError))(QAbstractSocket__SocketError(socketError))
 	}
 
@@ -16907,14 +16961,14 @@ func callbackQTcpServer_AcceptError(ptr unsafe.Pointer, socketError C.longlong)
 func (ptr *QTcpServer) ConnectAcceptError(f func(socketError QAbstractSocket__SocketError)) {
 	if ptr.Pointer() != nil {
 		C.QTcpServer_ConnectAcceptError(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "acceptError", f)
+		qt.ConnectSignal(ptr.Pointer(), "acceptError", f)
 	}
 }
 
 func (ptr *QTcpServer) DisconnectAcceptError() {
 	if ptr.Pointer() != nil {
 		C.QTcpServer_DisconnectAcceptError(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "acceptError")
+		qt.DisconnectSignal(ptr.Pointer(), "acceptError")
 	}
 }
 
@@ -16938,7 +16992,7 @@ func (ptr *QTcpServer) Close() {
 
 //export callbackQTcpServer_NewConnection
 func callbackQTcpServer_NewConnection(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "newConnection"); signal != nil {
+	if signal := qt.GetSignal(ptr, "newConnection"); signal != nil {
 		signal.(func())()
 	}
 
@@ -16947,14 +17001,14 @@ func callbackQTcpServer_NewConnection(ptr unsafe.Pointer) {
 func (ptr *QTcpServer) ConnectNewConnection(f func()) {
 	if ptr.Pointer() != nil {
 		C.QTcpServer_ConnectNewConnection(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "newConnection", f)
+		qt.ConnectSignal(ptr.Pointer(), "newConnection", f)
 	}
 }
 
 func (ptr *QTcpServer) DisconnectNewConnection() {
 	if ptr.Pointer() != nil {
 		C.QTcpServer_DisconnectNewConnection(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "newConnection")
+		qt.DisconnectSignal(ptr.Pointer(), "newConnection")
 	}
 }
 
@@ -16990,7 +17044,7 @@ func (ptr *QTcpServer) SetProxy(networkProxy QNetworkProxy_ITF) {
 
 //export callbackQTcpServer_DestroyQTcpServer
 func callbackQTcpServer_DestroyQTcpServer(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTcpServer"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTcpServer"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTcpServerFromPointer(ptr).DestroyQTcpServerDefault()
@@ -17000,21 +17054,21 @@ func callbackQTcpServer_DestroyQTcpServer(ptr unsafe.Pointer) {
 func (ptr *QTcpServer) ConnectDestroyQTcpServer(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTcpServer", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTcpServer", f)
 	}
 }
 
 func (ptr *QTcpServer) DisconnectDestroyQTcpServer() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTcpServer")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTcpServer")
 	}
 }
 
 func (ptr *QTcpServer) DestroyQTcpServer() {
 	if ptr.Pointer() != nil {
 		C.QTcpServer_DestroyQTcpServer(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -17022,7 +17076,7 @@ func (ptr *QTcpServer) DestroyQTcpServer() {
 func (ptr *QTcpServer) DestroyQTcpServerDefault() {
 	if ptr.Pointer() != nil {
 		C.QTcpServer_DestroyQTcpServerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -17061,7 +17115,7 @@ func (ptr *QTcpServer) ErrorString() string {
 
 //export callbackQTcpServer_HasPendingConnections
 func callbackQTcpServer_HasPendingConnections(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasPendingConnections"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasPendingConnections"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -17071,14 +17125,14 @@ func callbackQTcpServer_HasPendingConnections(ptr unsafe.Pointer) C.char {
 func (ptr *QTcpServer) ConnectHasPendingConnections(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasPendingConnections", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasPendingConnections", f)
 	}
 }
 
 func (ptr *QTcpServer) DisconnectHasPendingConnections() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasPendingConnections")
+		qt.DisconnectSignal(ptr.Pointer(), "hasPendingConnections")
 	}
 }
 
@@ -17139,7 +17193,7 @@ func (ptr *QTcpServer) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QTcpServer) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTcpServer___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -17160,7 +17214,7 @@ func (ptr *QTcpServer) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QTcpServer) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTcpServer___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -17181,7 +17235,7 @@ func (ptr *QTcpServer) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QTcpServer) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTcpServer___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -17202,7 +17256,7 @@ func (ptr *QTcpServer) __findChildren_newList() unsafe.Pointer {
 func (ptr *QTcpServer) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QTcpServer___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -17222,7 +17276,7 @@ func (ptr *QTcpServer) __children_newList() unsafe.Pointer {
 
 //export callbackQTcpServer_Event
 func callbackQTcpServer_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -17238,7 +17292,7 @@ func (ptr *QTcpServer) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQTcpServer_EventFilter
 func callbackQTcpServer_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -17254,7 +17308,7 @@ func (ptr *QTcpServer) EventFilterDefault(watched core.QObject_ITF, event core.Q
 
 //export callbackQTcpServer_ChildEvent
 func callbackQTcpServer_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQTcpServerFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -17269,7 +17323,7 @@ func (ptr *QTcpServer) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQTcpServer_ConnectNotify
 func callbackQTcpServer_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQTcpServerFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -17284,7 +17338,7 @@ func (ptr *QTcpServer) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQTcpServer_CustomEvent
 func callbackQTcpServer_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQTcpServerFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -17299,7 +17353,7 @@ func (ptr *QTcpServer) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQTcpServer_DeleteLater
 func callbackQTcpServer_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTcpServerFromPointer(ptr).DeleteLaterDefault()
@@ -17309,14 +17363,14 @@ func callbackQTcpServer_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QTcpServer) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QTcpServer_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQTcpServer_Destroyed
 func callbackQTcpServer_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -17324,7 +17378,7 @@ func callbackQTcpServer_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQTcpServer_DisconnectNotify
 func callbackQTcpServer_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQTcpServerFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -17339,7 +17393,7 @@ func (ptr *QTcpServer) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQTcpServer_ObjectNameChanged
 func callbackQTcpServer_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtNetwork_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -17347,7 +17401,7 @@ func callbackQTcpServer_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struc
 
 //export callbackQTcpServer_TimerEvent
 func callbackQTcpServer_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQTcpServerFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -17362,7 +17416,7 @@ func (ptr *QTcpServer) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQTcpServer_MetaObject
 func callbackQTcpServer_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -17416,7 +17470,7 @@ func NewQTcpSocketFromPointer(ptr unsafe.Pointer) *QTcpSocket {
 }
 func NewQTcpSocket(parent core.QObject_ITF) *QTcpSocket {
 	var tmpValue = NewQTcpSocketFromPointer(C.QTcpSocket_NewQTcpSocket(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -17424,7 +17478,7 @@ func NewQTcpSocket(parent core.QObject_ITF) *QTcpSocket {
 
 //export callbackQTcpSocket_DestroyQTcpSocket
 func callbackQTcpSocket_DestroyQTcpSocket(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTcpSocket"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTcpSocket"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTcpSocketFromPointer(ptr).DestroyQTcpSocketDefault()
@@ -17434,21 +17488,21 @@ func callbackQTcpSocket_DestroyQTcpSocket(ptr unsafe.Pointer) {
 func (ptr *QTcpSocket) ConnectDestroyQTcpSocket(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTcpSocket", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTcpSocket", f)
 	}
 }
 
 func (ptr *QTcpSocket) DisconnectDestroyQTcpSocket() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTcpSocket")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTcpSocket")
 	}
 }
 
 func (ptr *QTcpSocket) DestroyQTcpSocket() {
 	if ptr.Pointer() != nil {
 		C.QTcpSocket_DestroyQTcpSocket(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -17456,7 +17510,7 @@ func (ptr *QTcpSocket) DestroyQTcpSocket() {
 func (ptr *QTcpSocket) DestroyQTcpSocketDefault() {
 	if ptr.Pointer() != nil {
 		C.QTcpSocket_DestroyQTcpSocketDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -17510,7 +17564,7 @@ func (ptr *QUdpSocket) ReceiveDatagram(maxSize int64) *QNetworkDatagram {
 
 func NewQUdpSocket(parent core.QObject_ITF) *QUdpSocket {
 	var tmpValue = NewQUdpSocketFromPointer(C.QUdpSocket_NewQUdpSocket(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -17584,7 +17638,7 @@ func (ptr *QUdpSocket) SetMulticastInterface(iface QNetworkInterface_ITF) {
 
 //export callbackQUdpSocket_DestroyQUdpSocket
 func callbackQUdpSocket_DestroyQUdpSocket(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QUdpSocket"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QUdpSocket"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQUdpSocketFromPointer(ptr).DestroyQUdpSocketDefault()
@@ -17594,21 +17648,21 @@ func callbackQUdpSocket_DestroyQUdpSocket(ptr unsafe.Pointer) {
 func (ptr *QUdpSocket) ConnectDestroyQUdpSocket(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QUdpSocket", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QUdpSocket", f)
 	}
 }
 
 func (ptr *QUdpSocket) DisconnectDestroyQUdpSocket() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QUdpSocket")
+		qt.DisconnectSignal(ptr.Pointer(), "~QUdpSocket")
 	}
 }
 
 func (ptr *QUdpSocket) DestroyQUdpSocket() {
 	if ptr.Pointer() != nil {
 		C.QUdpSocket_DestroyQUdpSocket(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -17616,7 +17670,7 @@ func (ptr *QUdpSocket) DestroyQUdpSocket() {
 func (ptr *QUdpSocket) DestroyQUdpSocketDefault() {
 	if ptr.Pointer() != nil {
 		C.QUdpSocket_DestroyQUdpSocketDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
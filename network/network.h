@@ -290,7 +290,7 @@ void* QDnsTextRecord_NewQDnsTextRecord();
 void* QDnsTextRecord_NewQDnsTextRecord2(void* other);
 void QDnsTextRecord_Swap(void* ptr, void* other);
 void QDnsTextRecord_DestroyQDnsTextRecord(void* ptr);
-struct QtNetwork_PackedList QDnsTextRecord_Values(void* ptr);
+struct QtNetwork_PackedString QDnsTextRecord_Values(void* ptr);
 struct QtNetwork_PackedString QDnsTextRecord_Name(void* ptr);
 unsigned int QDnsTextRecord_TimeToLive(void* ptr);
 void* QDnsTextRecord___values_atList(void* ptr, int i);
@@ -851,7 +851,7 @@ void QNetworkProxy_Swap(void* ptr, void* other);
 void QNetworkProxy_DestroyQNetworkProxy(void* ptr);
 long long QNetworkProxy_Capabilities(void* ptr);
 void* QNetworkProxy_RawHeader(void* ptr, void* headerName);
-struct QtNetwork_PackedList QNetworkProxy_RawHeaderList(void* ptr);
+struct QtNetwork_PackedString QNetworkProxy_RawHeaderList(void* ptr);
 long long QNetworkProxy_Type(void* ptr);
 struct QtNetwork_PackedString QNetworkProxy_HostName(void* ptr);
 struct QtNetwork_PackedString QNetworkProxy_Password(void* ptr);
@@ -957,7 +957,7 @@ void QNetworkReply_UploadProgress(void* ptr, long long bytesSent, long long byte
 void QNetworkReply_DestroyQNetworkReply(void* ptr);
 long long QNetworkReply_Error(void* ptr);
 void* QNetworkReply_RawHeader(void* ptr, void* headerName);
-struct QtNetwork_PackedList QNetworkReply_RawHeaderList(void* ptr);
+struct QtNetwork_PackedString QNetworkReply_RawHeaderList(void* ptr);
 void* QNetworkReply_Manager(void* ptr);
 long long QNetworkReply_Operation(void* ptr);
 void* QNetworkReply_Request(void* ptr);
@@ -1038,7 +1038,7 @@ void QNetworkRequest_Swap(void* ptr, void* other);
 void QNetworkRequest_DestroyQNetworkRequest(void* ptr);
 long long QNetworkRequest_Priority(void* ptr);
 void* QNetworkRequest_RawHeader(void* ptr, void* headerName);
-struct QtNetwork_PackedList QNetworkRequest_RawHeaderList(void* ptr);
+struct QtNetwork_PackedString QNetworkRequest_RawHeaderList(void* ptr);
 void* QNetworkRequest_OriginatingObject(void* ptr);
 void* QNetworkRequest_SslConfiguration(void* ptr);
 void* QNetworkRequest_Url(void* ptr);
@@ -1150,8 +1150,8 @@ void* QSslCertificate_ToPem(void* ptr);
 void* QSslCertificate_Version(void* ptr);
 void* QSslCertificate_EffectiveDate(void* ptr);
 void* QSslCertificate_ExpiryDate(void* ptr);
-struct QtNetwork_PackedList QSslCertificate_IssuerInfoAttributes(void* ptr);
-struct QtNetwork_PackedList QSslCertificate_SubjectInfoAttributes(void* ptr);
+struct QtNetwork_PackedString QSslCertificate_IssuerInfoAttributes(void* ptr);
+struct QtNetwork_PackedString QSslCertificate_SubjectInfoAttributes(void* ptr);
 struct QtNetwork_PackedList QSslCertificate_Extensions(void* ptr);
 struct QtNetwork_PackedList QSslCertificate_SubjectAlternativeNames(void* ptr);
 void* QSslCertificate_PublicKey(void* ptr);
@@ -1247,7 +1247,7 @@ long long QSslConfiguration_NextProtocolNegotiationStatus(void* ptr);
 void* QSslConfiguration_NextNegotiatedProtocol(void* ptr);
 void* QSslConfiguration_PreSharedKeyIdentityHint(void* ptr);
 void* QSslConfiguration_SessionTicket(void* ptr);
-struct QtNetwork_PackedList QSslConfiguration_AllowedNextProtocols(void* ptr);
+struct QtNetwork_PackedString QSslConfiguration_AllowedNextProtocols(void* ptr);
 struct QtNetwork_PackedList QSslConfiguration_CaCertificates(void* ptr);
 struct QtNetwork_PackedList QSslConfiguration_LocalCertificateChain(void* ptr);
 struct QtNetwork_PackedList QSslConfiguration_PeerCertificateChain(void* ptr);
@@ -35,6 +35,41 @@
 #include <QTimer>
 #include <QTimerEvent>
 #include <QVariant>
+#include <QScopedPointer>
+#include <QStringList>
+#include <cstdlib>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
 
 void* QGeoAddress_NewQGeoAddress()
 {
@@ -349,7 +384,7 @@ void* QGeoAreaMonitorSource_NewQGeoAreaMonitorSource(void* parent)
 
 struct QtPositioning_PackedString QGeoAreaMonitorSource_QGeoAreaMonitorSource_AvailableSources()
 {
-	return ({ QByteArray t3a05b8 = QGeoAreaMonitorSource::availableSources().join("|").toUtf8(); QtPositioning_PackedString { const_cast<char*>(t3a05b8.prepend("WHITESPACE").constData()+10), t3a05b8.size()-10 }; });
+	return ({ long long t3a05b8len; char* t3a05b8 = goPackStringList(QGeoAreaMonitorSource::availableSources(), &t3a05b8len); QtPositioning_PackedString { t3a05b8, t3a05b8len }; });
 }
 
 char QGeoAreaMonitorSource_RequestUpdate(void* ptr, void* monitor, char* sign)
@@ -908,7 +943,7 @@ void* QGeoPositionInfoSource_NewQGeoPositionInfoSource(void* parent)
 
 struct QtPositioning_PackedString QGeoPositionInfoSource_QGeoPositionInfoSource_AvailableSources()
 {
-	return ({ QByteArray t547e22 = QGeoPositionInfoSource::availableSources().join("|").toUtf8(); QtPositioning_PackedString { const_cast<char*>(t547e22.prepend("WHITESPACE").constData()+10), t547e22.size()-10 }; });
+	return ({ long long t547e22len; char* t547e22 = goPackStringList(QGeoPositionInfoSource::availableSources(), &t547e22len); QtPositioning_PackedString { t547e22, t547e22len }; });
 }
 
 void QGeoPositionInfoSource_ConnectError2(void* ptr)
@@ -1455,7 +1490,7 @@ void* QGeoSatelliteInfoSource_NewQGeoSatelliteInfoSource(void* parent)
 
 struct QtPositioning_PackedString QGeoSatelliteInfoSource_QGeoSatelliteInfoSource_AvailableSources()
 {
-	return ({ QByteArray tab00fe = QGeoSatelliteInfoSource::availableSources().join("|").toUtf8(); QtPositioning_PackedString { const_cast<char*>(tab00fe.prepend("WHITESPACE").constData()+10), tab00fe.size()-10 }; });
+	return ({ long long tab00felen; char* tab00fe = goPackStringList(QGeoSatelliteInfoSource::availableSources(), &tab00felen); QtPositioning_PackedString { tab00fe, tab00felen }; });
 }
 
 void QGeoSatelliteInfoSource_ConnectError2(void* ptr)
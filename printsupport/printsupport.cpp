@@ -58,6 +58,41 @@
 #include <QVariant>
 #include <QWheelEvent>
 #include <QWidget>
+#include <QScopedPointer>
+#include <QStringList>
+#include <cstdlib>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
 
 class MyQAbstractPrintDialog: public QAbstractPrintDialog
 {
@@ -3389,6 +3424,16 @@ void* QPrinter___supportedResolutions_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QPrinter___supportedResolutions_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QPrinter___supportedResolutions_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 void QPrinter_SetPageSize2Default(void* ptr, long long size)
 {
 		static_cast<QPrinter*>(ptr)->QPrinter::setPageSize(static_cast<QPagedPaintDevice::PageSize>(size));
@@ -3441,7 +3486,7 @@ struct QtPrintSupport_PackedString QPrinterInfo_QPrinterInfo_DefaultPrinterName(
 
 struct QtPrintSupport_PackedString QPrinterInfo_QPrinterInfo_AvailablePrinterNames()
 {
-	return ({ QByteArray tb6ad9e = QPrinterInfo::availablePrinterNames().join("|").toUtf8(); QtPrintSupport_PackedString { const_cast<char*>(tb6ad9e.prepend("WHITESPACE").constData()+10), tb6ad9e.size()-10 }; });
+	return ({ long long tb6ad9elen; char* tb6ad9e = goPackStringList(QPrinterInfo::availablePrinterNames(), &tb6ad9elen); QtPrintSupport_PackedString { tb6ad9e, tb6ad9elen }; });
 }
 
 void QPrinterInfo_DestroyQPrinterInfo(void* ptr)
@@ -3604,3 +3649,13 @@ void* QPrinterInfo___supportedResolutions_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QPrinterInfo___supportedResolutions_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QPrinterInfo___supportedResolutions_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
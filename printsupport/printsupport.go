@@ -8,13 +8,11 @@ package printsupport
 //#include "printsupport.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"github.com/therecipe/qt/gui"
 	"github.com/therecipe/qt/widgets"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -24,6 +22,43 @@ func cGoUnpackString(s C.struct_QtPrintSupport_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtPrintSupport_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtPrintSupport_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QAbstractPrintDialog struct {
 	widgets.QDialog
@@ -67,7 +102,7 @@ func NewQAbstractPrintDialogFromPointer(ptr unsafe.Pointer) *QAbstractPrintDialo
 func (ptr *QAbstractPrintDialog) DestroyQAbstractPrintDialog() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -100,7 +135,7 @@ const (
 
 func NewQAbstractPrintDialog(printer QPrinter_ITF, parent widgets.QWidget_ITF) *QAbstractPrintDialog {
 	var tmpValue = NewQAbstractPrintDialogFromPointer(C.QAbstractPrintDialog_NewQAbstractPrintDialog(PointerFromQPrinter(printer), widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -108,7 +143,7 @@ func NewQAbstractPrintDialog(printer QPrinter_ITF, parent widgets.QWidget_ITF) *
 
 //export callbackQAbstractPrintDialog_Exec
 func callbackQAbstractPrintDialog_Exec(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "exec"); signal != nil {
+	if signal := qt.GetSignal(ptr, "exec"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -118,14 +153,14 @@ func callbackQAbstractPrintDialog_Exec(ptr unsafe.Pointer) C.int {
 func (ptr *QAbstractPrintDialog) ConnectExec(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "exec", f)
+		qt.ConnectSignal(ptr.Pointer(), "exec", f)
 	}
 }
 
 func (ptr *QAbstractPrintDialog) DisconnectExec() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "exec")
+		qt.DisconnectSignal(ptr.Pointer(), "exec")
 	}
 }
 
@@ -211,7 +246,7 @@ func (ptr *QAbstractPrintDialog) ToPage() int {
 func (ptr *QAbstractPrintDialog) __setOptionTabs_tabs_atList(i int) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QAbstractPrintDialog___setOptionTabs_tabs_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -232,7 +267,7 @@ func (ptr *QAbstractPrintDialog) __setOptionTabs_tabs_newList() unsafe.Pointer {
 func (ptr *QAbstractPrintDialog) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QAbstractPrintDialog___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -253,7 +288,7 @@ func (ptr *QAbstractPrintDialog) __addActions_actions_newList() unsafe.Pointer {
 func (ptr *QAbstractPrintDialog) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QAbstractPrintDialog___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -274,7 +309,7 @@ func (ptr *QAbstractPrintDialog) __insertActions_actions_newList() unsafe.Pointe
 func (ptr *QAbstractPrintDialog) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QAbstractPrintDialog___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -314,7 +349,7 @@ func (ptr *QAbstractPrintDialog) __dynamicPropertyNames_newList() unsafe.Pointer
 func (ptr *QAbstractPrintDialog) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractPrintDialog___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -335,7 +370,7 @@ func (ptr *QAbstractPrintDialog) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QAbstractPrintDialog) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractPrintDialog___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -356,7 +391,7 @@ func (ptr *QAbstractPrintDialog) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QAbstractPrintDialog) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractPrintDialog___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -377,7 +412,7 @@ func (ptr *QAbstractPrintDialog) __findChildren_newList() unsafe.Pointer {
 func (ptr *QAbstractPrintDialog) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QAbstractPrintDialog___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -397,7 +432,7 @@ func (ptr *QAbstractPrintDialog) __children_newList() unsafe.Pointer {
 
 //export callbackQAbstractPrintDialog_EventFilter
 func callbackQAbstractPrintDialog_EventFilter(ptr unsafe.Pointer, o unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(o), core.NewQEventFromPointer(e)))))
 	}
 
@@ -413,7 +448,7 @@ func (ptr *QAbstractPrintDialog) EventFilterDefault(o core.QObject_ITF, e core.Q
 
 //export callbackQAbstractPrintDialog_Accept
 func callbackQAbstractPrintDialog_Accept(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accept"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accept"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).AcceptDefault()
@@ -428,7 +463,7 @@ func (ptr *QAbstractPrintDialog) AcceptDefault() {
 
 //export callbackQAbstractPrintDialog_Accepted
 func callbackQAbstractPrintDialog_Accepted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accepted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accepted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -436,7 +471,7 @@ func callbackQAbstractPrintDialog_Accepted(ptr unsafe.Pointer) {
 
 //export callbackQAbstractPrintDialog_CloseEvent
 func callbackQAbstractPrintDialog_CloseEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(e))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(e))
@@ -451,7 +486,7 @@ func (ptr *QAbstractPrintDialog) CloseEventDefault(e gui.QCloseEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_ContextMenuEvent
 func callbackQAbstractPrintDialog_ContextMenuEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(e))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(e))
@@ -466,7 +501,7 @@ func (ptr *QAbstractPrintDialog) ContextMenuEventDefault(e gui.QContextMenuEvent
 
 //export callbackQAbstractPrintDialog_Done
 func callbackQAbstractPrintDialog_Done(ptr unsafe.Pointer, r C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "done"); signal != nil {
+	if signal := qt.GetSignal(ptr, "done"); signal != nil {
 		signal.(func(int))(int(int32(r)))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).DoneDefault(int(int32(r)))
@@ -481,7 +516,7 @@ func (ptr *QAbstractPrintDialog) DoneDefault(r int) {
 
 //export callbackQAbstractPrintDialog_Finished
 func callbackQAbstractPrintDialog_Finished(ptr unsafe.Pointer, result C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func(int))(int(int32(result)))
 	}
 
@@ -489,7 +524,7 @@ func callbackQAbstractPrintDialog_Finished(ptr unsafe.Pointer, result C.int) {
 
 //export callbackQAbstractPrintDialog_KeyPressEvent
 func callbackQAbstractPrintDialog_KeyPressEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(e))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(e))
@@ -504,7 +539,7 @@ func (ptr *QAbstractPrintDialog) KeyPressEventDefault(e gui.QKeyEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_Open
 func callbackQAbstractPrintDialog_Open(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "open"); signal != nil {
+	if signal := qt.GetSignal(ptr, "open"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).OpenDefault()
@@ -519,7 +554,7 @@ func (ptr *QAbstractPrintDialog) OpenDefault() {
 
 //export callbackQAbstractPrintDialog_Reject
 func callbackQAbstractPrintDialog_Reject(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reject"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).RejectDefault()
@@ -534,7 +569,7 @@ func (ptr *QAbstractPrintDialog) RejectDefault() {
 
 //export callbackQAbstractPrintDialog_Rejected
 func callbackQAbstractPrintDialog_Rejected(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rejected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rejected"); signal != nil {
 		signal.(func())()
 	}
 
@@ -542,7 +577,7 @@ func callbackQAbstractPrintDialog_Rejected(ptr unsafe.Pointer) {
 
 //export callbackQAbstractPrintDialog_ResizeEvent
 func callbackQAbstractPrintDialog_ResizeEvent(ptr unsafe.Pointer, vqr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(vqr))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(vqr))
@@ -557,7 +592,7 @@ func (ptr *QAbstractPrintDialog) ResizeEventDefault(vqr gui.QResizeEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_SetVisible
 func callbackQAbstractPrintDialog_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -572,7 +607,7 @@ func (ptr *QAbstractPrintDialog) SetVisibleDefault(visible bool) {
 
 //export callbackQAbstractPrintDialog_ShowEvent
 func callbackQAbstractPrintDialog_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -587,7 +622,7 @@ func (ptr *QAbstractPrintDialog) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_MinimumSizeHint
 func callbackQAbstractPrintDialog_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -605,7 +640,7 @@ func (ptr *QAbstractPrintDialog) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQAbstractPrintDialog_SizeHint
 func callbackQAbstractPrintDialog_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -623,7 +658,7 @@ func (ptr *QAbstractPrintDialog) SizeHintDefault() *core.QSize {
 
 //export callbackQAbstractPrintDialog_Close
 func callbackQAbstractPrintDialog_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -639,7 +674,7 @@ func (ptr *QAbstractPrintDialog) CloseDefault() bool {
 
 //export callbackQAbstractPrintDialog_Event
 func callbackQAbstractPrintDialog_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -655,7 +690,7 @@ func (ptr *QAbstractPrintDialog) EventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQAbstractPrintDialog_FocusNextPrevChild
 func callbackQAbstractPrintDialog_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -671,7 +706,7 @@ func (ptr *QAbstractPrintDialog) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQAbstractPrintDialog_NativeEvent
 func callbackQAbstractPrintDialog_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -687,7 +722,7 @@ func (ptr *QAbstractPrintDialog) NativeEventDefault(eventType core.QByteArray_IT
 
 //export callbackQAbstractPrintDialog_ActionEvent
 func callbackQAbstractPrintDialog_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -702,7 +737,7 @@ func (ptr *QAbstractPrintDialog) ActionEventDefault(event gui.QActionEvent_ITF)
 
 //export callbackQAbstractPrintDialog_ChangeEvent
 func callbackQAbstractPrintDialog_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -717,7 +752,7 @@ func (ptr *QAbstractPrintDialog) ChangeEventDefault(event core.QEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_CustomContextMenuRequested
 func callbackQAbstractPrintDialog_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -725,7 +760,7 @@ func callbackQAbstractPrintDialog_CustomContextMenuRequested(ptr unsafe.Pointer,
 
 //export callbackQAbstractPrintDialog_DragEnterEvent
 func callbackQAbstractPrintDialog_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -740,7 +775,7 @@ func (ptr *QAbstractPrintDialog) DragEnterEventDefault(event gui.QDragEnterEvent
 
 //export callbackQAbstractPrintDialog_DragLeaveEvent
 func callbackQAbstractPrintDialog_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -755,7 +790,7 @@ func (ptr *QAbstractPrintDialog) DragLeaveEventDefault(event gui.QDragLeaveEvent
 
 //export callbackQAbstractPrintDialog_DragMoveEvent
 func callbackQAbstractPrintDialog_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -770,7 +805,7 @@ func (ptr *QAbstractPrintDialog) DragMoveEventDefault(event gui.QDragMoveEvent_I
 
 //export callbackQAbstractPrintDialog_DropEvent
 func callbackQAbstractPrintDialog_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -785,7 +820,7 @@ func (ptr *QAbstractPrintDialog) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_EnterEvent
 func callbackQAbstractPrintDialog_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -800,7 +835,7 @@ func (ptr *QAbstractPrintDialog) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_FocusInEvent
 func callbackQAbstractPrintDialog_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -815,7 +850,7 @@ func (ptr *QAbstractPrintDialog) FocusInEventDefault(event gui.QFocusEvent_ITF)
 
 //export callbackQAbstractPrintDialog_FocusOutEvent
 func callbackQAbstractPrintDialog_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -830,7 +865,7 @@ func (ptr *QAbstractPrintDialog) FocusOutEventDefault(event gui.QFocusEvent_ITF)
 
 //export callbackQAbstractPrintDialog_Hide
 func callbackQAbstractPrintDialog_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).HideDefault()
@@ -845,7 +880,7 @@ func (ptr *QAbstractPrintDialog) HideDefault() {
 
 //export callbackQAbstractPrintDialog_HideEvent
 func callbackQAbstractPrintDialog_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -860,7 +895,7 @@ func (ptr *QAbstractPrintDialog) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_InputMethodEvent
 func callbackQAbstractPrintDialog_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -875,7 +910,7 @@ func (ptr *QAbstractPrintDialog) InputMethodEventDefault(event gui.QInputMethodE
 
 //export callbackQAbstractPrintDialog_KeyReleaseEvent
 func callbackQAbstractPrintDialog_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -890,7 +925,7 @@ func (ptr *QAbstractPrintDialog) KeyReleaseEventDefault(event gui.QKeyEvent_ITF)
 
 //export callbackQAbstractPrintDialog_LeaveEvent
 func callbackQAbstractPrintDialog_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -905,7 +940,7 @@ func (ptr *QAbstractPrintDialog) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_Lower
 func callbackQAbstractPrintDialog_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).LowerDefault()
@@ -920,7 +955,7 @@ func (ptr *QAbstractPrintDialog) LowerDefault() {
 
 //export callbackQAbstractPrintDialog_MouseDoubleClickEvent
 func callbackQAbstractPrintDialog_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -935,7 +970,7 @@ func (ptr *QAbstractPrintDialog) MouseDoubleClickEventDefault(event gui.QMouseEv
 
 //export callbackQAbstractPrintDialog_MouseMoveEvent
 func callbackQAbstractPrintDialog_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -950,7 +985,7 @@ func (ptr *QAbstractPrintDialog) MouseMoveEventDefault(event gui.QMouseEvent_ITF
 
 //export callbackQAbstractPrintDialog_MousePressEvent
 func callbackQAbstractPrintDialog_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -965,7 +1000,7 @@ func (ptr *QAbstractPrintDialog) MousePressEventDefault(event gui.QMouseEvent_IT
 
 //export callbackQAbstractPrintDialog_MouseReleaseEvent
 func callbackQAbstractPrintDialog_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -980,7 +1015,7 @@ func (ptr *QAbstractPrintDialog) MouseReleaseEventDefault(event gui.QMouseEvent_
 
 //export callbackQAbstractPrintDialog_MoveEvent
 func callbackQAbstractPrintDialog_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -995,7 +1030,7 @@ func (ptr *QAbstractPrintDialog) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_PaintEvent
 func callbackQAbstractPrintDialog_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -1010,7 +1045,7 @@ func (ptr *QAbstractPrintDialog) PaintEventDefault(event gui.QPaintEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_Raise
 func callbackQAbstractPrintDialog_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).RaiseDefault()
@@ -1025,7 +1060,7 @@ func (ptr *QAbstractPrintDialog) RaiseDefault() {
 
 //export callbackQAbstractPrintDialog_Repaint
 func callbackQAbstractPrintDialog_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).RepaintDefault()
@@ -1040,7 +1075,7 @@ func (ptr *QAbstractPrintDialog) RepaintDefault() {
 
 //export callbackQAbstractPrintDialog_SetDisabled
 func callbackQAbstractPrintDialog_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -1055,7 +1090,7 @@ func (ptr *QAbstractPrintDialog) SetDisabledDefault(disable bool) {
 
 //export callbackQAbstractPrintDialog_SetEnabled
 func callbackQAbstractPrintDialog_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -1070,7 +1105,7 @@ func (ptr *QAbstractPrintDialog) SetEnabledDefault(vbo bool) {
 
 //export callbackQAbstractPrintDialog_SetFocus2
 func callbackQAbstractPrintDialog_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).SetFocus2Default()
@@ -1085,7 +1120,7 @@ func (ptr *QAbstractPrintDialog) SetFocus2Default() {
 
 //export callbackQAbstractPrintDialog_SetHidden
 func callbackQAbstractPrintDialog_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -1100,7 +1135,7 @@ func (ptr *QAbstractPrintDialog) SetHiddenDefault(hidden bool) {
 
 //export callbackQAbstractPrintDialog_SetStyleSheet
 func callbackQAbstractPrintDialog_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -1117,7 +1152,7 @@ func (ptr *QAbstractPrintDialog) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQAbstractPrintDialog_SetWindowModified
 func callbackQAbstractPrintDialog_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -1132,7 +1167,7 @@ func (ptr *QAbstractPrintDialog) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQAbstractPrintDialog_SetWindowTitle
 func callbackQAbstractPrintDialog_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -1149,7 +1184,7 @@ func (ptr *QAbstractPrintDialog) SetWindowTitleDefault(vqs string) {
 
 //export callbackQAbstractPrintDialog_Show
 func callbackQAbstractPrintDialog_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ShowDefault()
@@ -1164,7 +1199,7 @@ func (ptr *QAbstractPrintDialog) ShowDefault() {
 
 //export callbackQAbstractPrintDialog_ShowFullScreen
 func callbackQAbstractPrintDialog_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ShowFullScreenDefault()
@@ -1179,7 +1214,7 @@ func (ptr *QAbstractPrintDialog) ShowFullScreenDefault() {
 
 //export callbackQAbstractPrintDialog_ShowMaximized
 func callbackQAbstractPrintDialog_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ShowMaximizedDefault()
@@ -1194,7 +1229,7 @@ func (ptr *QAbstractPrintDialog) ShowMaximizedDefault() {
 
 //export callbackQAbstractPrintDialog_ShowMinimized
 func callbackQAbstractPrintDialog_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ShowMinimizedDefault()
@@ -1209,7 +1244,7 @@ func (ptr *QAbstractPrintDialog) ShowMinimizedDefault() {
 
 //export callbackQAbstractPrintDialog_ShowNormal
 func callbackQAbstractPrintDialog_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ShowNormalDefault()
@@ -1224,7 +1259,7 @@ func (ptr *QAbstractPrintDialog) ShowNormalDefault() {
 
 //export callbackQAbstractPrintDialog_TabletEvent
 func callbackQAbstractPrintDialog_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -1239,7 +1274,7 @@ func (ptr *QAbstractPrintDialog) TabletEventDefault(event gui.QTabletEvent_ITF)
 
 //export callbackQAbstractPrintDialog_Update
 func callbackQAbstractPrintDialog_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).UpdateDefault()
@@ -1254,7 +1289,7 @@ func (ptr *QAbstractPrintDialog) UpdateDefault() {
 
 //export callbackQAbstractPrintDialog_UpdateMicroFocus
 func callbackQAbstractPrintDialog_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).UpdateMicroFocusDefault()
@@ -1269,7 +1304,7 @@ func (ptr *QAbstractPrintDialog) UpdateMicroFocusDefault() {
 
 //export callbackQAbstractPrintDialog_WheelEvent
 func callbackQAbstractPrintDialog_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -1284,7 +1319,7 @@ func (ptr *QAbstractPrintDialog) WheelEventDefault(event gui.QWheelEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_WindowIconChanged
 func callbackQAbstractPrintDialog_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -1292,7 +1327,7 @@ func callbackQAbstractPrintDialog_WindowIconChanged(ptr unsafe.Pointer, icon uns
 
 //export callbackQAbstractPrintDialog_WindowTitleChanged
 func callbackQAbstractPrintDialog_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -1300,7 +1335,7 @@ func callbackQAbstractPrintDialog_WindowTitleChanged(ptr unsafe.Pointer, title C
 
 //export callbackQAbstractPrintDialog_PaintEngine
 func callbackQAbstractPrintDialog_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -1316,7 +1351,7 @@ func (ptr *QAbstractPrintDialog) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQAbstractPrintDialog_InputMethodQuery
 func callbackQAbstractPrintDialog_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -1334,7 +1369,7 @@ func (ptr *QAbstractPrintDialog) InputMethodQueryDefault(query core.Qt__InputMet
 
 //export callbackQAbstractPrintDialog_HasHeightForWidth
 func callbackQAbstractPrintDialog_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1350,7 +1385,7 @@ func (ptr *QAbstractPrintDialog) HasHeightForWidthDefault() bool {
 
 //export callbackQAbstractPrintDialog_HeightForWidth
 func callbackQAbstractPrintDialog_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -1366,7 +1401,7 @@ func (ptr *QAbstractPrintDialog) HeightForWidthDefault(w int) int {
 
 //export callbackQAbstractPrintDialog_Metric
 func callbackQAbstractPrintDialog_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -1382,7 +1417,7 @@ func (ptr *QAbstractPrintDialog) MetricDefault(m gui.QPaintDevice__PaintDeviceMe
 
 //export callbackQAbstractPrintDialog_ChildEvent
 func callbackQAbstractPrintDialog_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -1397,7 +1432,7 @@ func (ptr *QAbstractPrintDialog) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_ConnectNotify
 func callbackQAbstractPrintDialog_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1412,7 +1447,7 @@ func (ptr *QAbstractPrintDialog) ConnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQAbstractPrintDialog_CustomEvent
 func callbackQAbstractPrintDialog_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -1427,7 +1462,7 @@ func (ptr *QAbstractPrintDialog) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_DeleteLater
 func callbackQAbstractPrintDialog_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).DeleteLaterDefault()
@@ -1437,14 +1472,14 @@ func callbackQAbstractPrintDialog_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QAbstractPrintDialog) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QAbstractPrintDialog_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAbstractPrintDialog_Destroyed
 func callbackQAbstractPrintDialog_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -1452,7 +1487,7 @@ func callbackQAbstractPrintDialog_Destroyed(ptr unsafe.Pointer, obj unsafe.Point
 
 //export callbackQAbstractPrintDialog_DisconnectNotify
 func callbackQAbstractPrintDialog_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1467,7 +1502,7 @@ func (ptr *QAbstractPrintDialog) DisconnectNotifyDefault(sign core.QMetaMethod_I
 
 //export callbackQAbstractPrintDialog_ObjectNameChanged
 func callbackQAbstractPrintDialog_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -1475,7 +1510,7 @@ func callbackQAbstractPrintDialog_ObjectNameChanged(ptr unsafe.Pointer, objectNa
 
 //export callbackQAbstractPrintDialog_TimerEvent
 func callbackQAbstractPrintDialog_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQAbstractPrintDialogFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -1490,7 +1525,7 @@ func (ptr *QAbstractPrintDialog) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQAbstractPrintDialog_MetaObject
 func callbackQAbstractPrintDialog_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -1544,7 +1579,7 @@ func NewQPageSetupDialogFromPointer(ptr unsafe.Pointer) *QPageSetupDialog {
 }
 func NewQPageSetupDialog(printer QPrinter_ITF, parent widgets.QWidget_ITF) *QPageSetupDialog {
 	var tmpValue = NewQPageSetupDialogFromPointer(C.QPageSetupDialog_NewQPageSetupDialog(PointerFromQPrinter(printer), widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1552,7 +1587,7 @@ func NewQPageSetupDialog(printer QPrinter_ITF, parent widgets.QWidget_ITF) *QPag
 
 func NewQPageSetupDialog2(parent widgets.QWidget_ITF) *QPageSetupDialog {
 	var tmpValue = NewQPageSetupDialogFromPointer(C.QPageSetupDialog_NewQPageSetupDialog2(widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1567,7 +1602,7 @@ func (ptr *QPageSetupDialog) Printer() *QPrinter {
 
 //export callbackQPageSetupDialog_Exec
 func callbackQPageSetupDialog_Exec(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "exec"); signal != nil {
+	if signal := qt.GetSignal(ptr, "exec"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -1577,14 +1612,14 @@ func callbackQPageSetupDialog_Exec(ptr unsafe.Pointer) C.int {
 func (ptr *QPageSetupDialog) ConnectExec(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "exec", f)
+		qt.ConnectSignal(ptr.Pointer(), "exec", f)
 	}
 }
 
 func (ptr *QPageSetupDialog) DisconnectExec() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "exec")
+		qt.DisconnectSignal(ptr.Pointer(), "exec")
 	}
 }
 
@@ -1604,7 +1639,7 @@ func (ptr *QPageSetupDialog) ExecDefault() int {
 
 //export callbackQPageSetupDialog_Done
 func callbackQPageSetupDialog_Done(ptr unsafe.Pointer, result C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "done"); signal != nil {
+	if signal := qt.GetSignal(ptr, "done"); signal != nil {
 		signal.(func(int))(int(int32(result)))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).DoneDefault(int(int32(result)))
@@ -1614,14 +1649,14 @@ func callbackQPageSetupDialog_Done(ptr unsafe.Pointer, result C.int) {
 func (ptr *QPageSetupDialog) ConnectDone(f func(result int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "done", f)
+		qt.ConnectSignal(ptr.Pointer(), "done", f)
 	}
 }
 
 func (ptr *QPageSetupDialog) DisconnectDone() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "done")
+		qt.DisconnectSignal(ptr.Pointer(), "done")
 	}
 }
 
@@ -1639,7 +1674,7 @@ func (ptr *QPageSetupDialog) DoneDefault(result int) {
 
 //export callbackQPageSetupDialog_SetVisible
 func callbackQPageSetupDialog_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -1655,7 +1690,7 @@ func (ptr *QPageSetupDialog) SetVisibleDefault(visible bool) {
 func (ptr *QPageSetupDialog) DestroyQPageSetupDialog() {
 	if ptr.Pointer() != nil {
 		C.QPageSetupDialog_DestroyQPageSetupDialog(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1663,7 +1698,7 @@ func (ptr *QPageSetupDialog) DestroyQPageSetupDialog() {
 func (ptr *QPageSetupDialog) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QPageSetupDialog___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1684,7 +1719,7 @@ func (ptr *QPageSetupDialog) __addActions_actions_newList() unsafe.Pointer {
 func (ptr *QPageSetupDialog) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QPageSetupDialog___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1705,7 +1740,7 @@ func (ptr *QPageSetupDialog) __insertActions_actions_newList() unsafe.Pointer {
 func (ptr *QPageSetupDialog) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QPageSetupDialog___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1745,7 +1780,7 @@ func (ptr *QPageSetupDialog) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QPageSetupDialog) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPageSetupDialog___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1766,7 +1801,7 @@ func (ptr *QPageSetupDialog) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QPageSetupDialog) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPageSetupDialog___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1787,7 +1822,7 @@ func (ptr *QPageSetupDialog) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QPageSetupDialog) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPageSetupDialog___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1808,7 +1843,7 @@ func (ptr *QPageSetupDialog) __findChildren_newList() unsafe.Pointer {
 func (ptr *QPageSetupDialog) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPageSetupDialog___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1828,7 +1863,7 @@ func (ptr *QPageSetupDialog) __children_newList() unsafe.Pointer {
 
 //export callbackQPageSetupDialog_EventFilter
 func callbackQPageSetupDialog_EventFilter(ptr unsafe.Pointer, o unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(o), core.NewQEventFromPointer(e)))))
 	}
 
@@ -1844,7 +1879,7 @@ func (ptr *QPageSetupDialog) EventFilterDefault(o core.QObject_ITF, e core.QEven
 
 //export callbackQPageSetupDialog_Accept
 func callbackQPageSetupDialog_Accept(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accept"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accept"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).AcceptDefault()
@@ -1859,7 +1894,7 @@ func (ptr *QPageSetupDialog) AcceptDefault() {
 
 //export callbackQPageSetupDialog_Accepted
 func callbackQPageSetupDialog_Accepted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accepted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accepted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1867,7 +1902,7 @@ func callbackQPageSetupDialog_Accepted(ptr unsafe.Pointer) {
 
 //export callbackQPageSetupDialog_CloseEvent
 func callbackQPageSetupDialog_CloseEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(e))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(e))
@@ -1882,7 +1917,7 @@ func (ptr *QPageSetupDialog) CloseEventDefault(e gui.QCloseEvent_ITF) {
 
 //export callbackQPageSetupDialog_ContextMenuEvent
 func callbackQPageSetupDialog_ContextMenuEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(e))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(e))
@@ -1897,7 +1932,7 @@ func (ptr *QPageSetupDialog) ContextMenuEventDefault(e gui.QContextMenuEvent_ITF
 
 //export callbackQPageSetupDialog_Finished
 func callbackQPageSetupDialog_Finished(ptr unsafe.Pointer, result C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func(int))(int(int32(result)))
 	}
 
@@ -1905,7 +1940,7 @@ func callbackQPageSetupDialog_Finished(ptr unsafe.Pointer, result C.int) {
 
 //export callbackQPageSetupDialog_KeyPressEvent
 func callbackQPageSetupDialog_KeyPressEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(e))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(e))
@@ -1920,7 +1955,7 @@ func (ptr *QPageSetupDialog) KeyPressEventDefault(e gui.QKeyEvent_ITF) {
 
 //export callbackQPageSetupDialog_Reject
 func callbackQPageSetupDialog_Reject(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reject"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).RejectDefault()
@@ -1935,7 +1970,7 @@ func (ptr *QPageSetupDialog) RejectDefault() {
 
 //export callbackQPageSetupDialog_Rejected
 func callbackQPageSetupDialog_Rejected(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rejected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rejected"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1943,7 +1978,7 @@ func callbackQPageSetupDialog_Rejected(ptr unsafe.Pointer) {
 
 //export callbackQPageSetupDialog_ResizeEvent
 func callbackQPageSetupDialog_ResizeEvent(ptr unsafe.Pointer, vqr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(vqr))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(vqr))
@@ -1958,7 +1993,7 @@ func (ptr *QPageSetupDialog) ResizeEventDefault(vqr gui.QResizeEvent_ITF) {
 
 //export callbackQPageSetupDialog_ShowEvent
 func callbackQPageSetupDialog_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -1973,7 +2008,7 @@ func (ptr *QPageSetupDialog) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQPageSetupDialog_MinimumSizeHint
 func callbackQPageSetupDialog_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -1991,7 +2026,7 @@ func (ptr *QPageSetupDialog) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQPageSetupDialog_SizeHint
 func callbackQPageSetupDialog_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -2009,7 +2044,7 @@ func (ptr *QPageSetupDialog) SizeHintDefault() *core.QSize {
 
 //export callbackQPageSetupDialog_Close
 func callbackQPageSetupDialog_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2025,7 +2060,7 @@ func (ptr *QPageSetupDialog) CloseDefault() bool {
 
 //export callbackQPageSetupDialog_Event
 func callbackQPageSetupDialog_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -2041,7 +2076,7 @@ func (ptr *QPageSetupDialog) EventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQPageSetupDialog_FocusNextPrevChild
 func callbackQPageSetupDialog_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -2057,7 +2092,7 @@ func (ptr *QPageSetupDialog) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQPageSetupDialog_NativeEvent
 func callbackQPageSetupDialog_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -2073,7 +2108,7 @@ func (ptr *QPageSetupDialog) NativeEventDefault(eventType core.QByteArray_ITF, m
 
 //export callbackQPageSetupDialog_ActionEvent
 func callbackQPageSetupDialog_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -2088,7 +2123,7 @@ func (ptr *QPageSetupDialog) ActionEventDefault(event gui.QActionEvent_ITF) {
 
 //export callbackQPageSetupDialog_ChangeEvent
 func callbackQPageSetupDialog_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -2103,7 +2138,7 @@ func (ptr *QPageSetupDialog) ChangeEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPageSetupDialog_CustomContextMenuRequested
 func callbackQPageSetupDialog_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -2111,7 +2146,7 @@ func callbackQPageSetupDialog_CustomContextMenuRequested(ptr unsafe.Pointer, pos
 
 //export callbackQPageSetupDialog_DragEnterEvent
 func callbackQPageSetupDialog_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -2126,7 +2161,7 @@ func (ptr *QPageSetupDialog) DragEnterEventDefault(event gui.QDragEnterEvent_ITF
 
 //export callbackQPageSetupDialog_DragLeaveEvent
 func callbackQPageSetupDialog_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -2141,7 +2176,7 @@ func (ptr *QPageSetupDialog) DragLeaveEventDefault(event gui.QDragLeaveEvent_ITF
 
 //export callbackQPageSetupDialog_DragMoveEvent
 func callbackQPageSetupDialog_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -2156,7 +2191,7 @@ func (ptr *QPageSetupDialog) DragMoveEventDefault(event gui.QDragMoveEvent_ITF)
 
 //export callbackQPageSetupDialog_DropEvent
 func callbackQPageSetupDialog_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -2171,7 +2206,7 @@ func (ptr *QPageSetupDialog) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQPageSetupDialog_EnterEvent
 func callbackQPageSetupDialog_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -2186,7 +2221,7 @@ func (ptr *QPageSetupDialog) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPageSetupDialog_FocusInEvent
 func callbackQPageSetupDialog_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -2201,7 +2236,7 @@ func (ptr *QPageSetupDialog) FocusInEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQPageSetupDialog_FocusOutEvent
 func callbackQPageSetupDialog_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -2216,7 +2251,7 @@ func (ptr *QPageSetupDialog) FocusOutEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQPageSetupDialog_Hide
 func callbackQPageSetupDialog_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).HideDefault()
@@ -2231,7 +2266,7 @@ func (ptr *QPageSetupDialog) HideDefault() {
 
 //export callbackQPageSetupDialog_HideEvent
 func callbackQPageSetupDialog_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -2246,7 +2281,7 @@ func (ptr *QPageSetupDialog) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQPageSetupDialog_InputMethodEvent
 func callbackQPageSetupDialog_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -2261,7 +2296,7 @@ func (ptr *QPageSetupDialog) InputMethodEventDefault(event gui.QInputMethodEvent
 
 //export callbackQPageSetupDialog_KeyReleaseEvent
 func callbackQPageSetupDialog_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -2276,7 +2311,7 @@ func (ptr *QPageSetupDialog) KeyReleaseEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQPageSetupDialog_LeaveEvent
 func callbackQPageSetupDialog_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -2291,7 +2326,7 @@ func (ptr *QPageSetupDialog) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPageSetupDialog_Lower
 func callbackQPageSetupDialog_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).LowerDefault()
@@ -2306,7 +2341,7 @@ func (ptr *QPageSetupDialog) LowerDefault() {
 
 //export callbackQPageSetupDialog_MouseDoubleClickEvent
 func callbackQPageSetupDialog_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2321,7 +2356,7 @@ func (ptr *QPageSetupDialog) MouseDoubleClickEventDefault(event gui.QMouseEvent_
 
 //export callbackQPageSetupDialog_MouseMoveEvent
 func callbackQPageSetupDialog_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2336,7 +2371,7 @@ func (ptr *QPageSetupDialog) MouseMoveEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQPageSetupDialog_MousePressEvent
 func callbackQPageSetupDialog_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2351,7 +2386,7 @@ func (ptr *QPageSetupDialog) MousePressEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQPageSetupDialog_MouseReleaseEvent
 func callbackQPageSetupDialog_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2366,7 +2401,7 @@ func (ptr *QPageSetupDialog) MouseReleaseEventDefault(event gui.QMouseEvent_ITF)
 
 //export callbackQPageSetupDialog_MoveEvent
 func callbackQPageSetupDialog_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -2381,7 +2416,7 @@ func (ptr *QPageSetupDialog) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQPageSetupDialog_PaintEvent
 func callbackQPageSetupDialog_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -2396,7 +2431,7 @@ func (ptr *QPageSetupDialog) PaintEventDefault(event gui.QPaintEvent_ITF) {
 
 //export callbackQPageSetupDialog_Raise
 func callbackQPageSetupDialog_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).RaiseDefault()
@@ -2411,7 +2446,7 @@ func (ptr *QPageSetupDialog) RaiseDefault() {
 
 //export callbackQPageSetupDialog_Repaint
 func callbackQPageSetupDialog_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).RepaintDefault()
@@ -2426,7 +2461,7 @@ func (ptr *QPageSetupDialog) RepaintDefault() {
 
 //export callbackQPageSetupDialog_SetDisabled
 func callbackQPageSetupDialog_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -2441,7 +2476,7 @@ func (ptr *QPageSetupDialog) SetDisabledDefault(disable bool) {
 
 //export callbackQPageSetupDialog_SetEnabled
 func callbackQPageSetupDialog_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -2456,7 +2491,7 @@ func (ptr *QPageSetupDialog) SetEnabledDefault(vbo bool) {
 
 //export callbackQPageSetupDialog_SetFocus2
 func callbackQPageSetupDialog_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).SetFocus2Default()
@@ -2471,7 +2506,7 @@ func (ptr *QPageSetupDialog) SetFocus2Default() {
 
 //export callbackQPageSetupDialog_SetHidden
 func callbackQPageSetupDialog_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -2486,7 +2521,7 @@ func (ptr *QPageSetupDialog) SetHiddenDefault(hidden bool) {
 
 //export callbackQPageSetupDialog_SetStyleSheet
 func callbackQPageSetupDialog_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -2503,7 +2538,7 @@ func (ptr *QPageSetupDialog) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQPageSetupDialog_SetWindowModified
 func callbackQPageSetupDialog_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -2518,7 +2553,7 @@ func (ptr *QPageSetupDialog) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQPageSetupDialog_SetWindowTitle
 func callbackQPageSetupDialog_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -2535,7 +2570,7 @@ func (ptr *QPageSetupDialog) SetWindowTitleDefault(vqs string) {
 
 //export callbackQPageSetupDialog_Show
 func callbackQPageSetupDialog_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ShowDefault()
@@ -2550,7 +2585,7 @@ func (ptr *QPageSetupDialog) ShowDefault() {
 
 //export callbackQPageSetupDialog_ShowFullScreen
 func callbackQPageSetupDialog_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ShowFullScreenDefault()
@@ -2565,7 +2600,7 @@ func (ptr *QPageSetupDialog) ShowFullScreenDefault() {
 
 //export callbackQPageSetupDialog_ShowMaximized
 func callbackQPageSetupDialog_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ShowMaximizedDefault()
@@ -2580,7 +2615,7 @@ func (ptr *QPageSetupDialog) ShowMaximizedDefault() {
 
 //export callbackQPageSetupDialog_ShowMinimized
 func callbackQPageSetupDialog_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ShowMinimizedDefault()
@@ -2595,7 +2630,7 @@ func (ptr *QPageSetupDialog) ShowMinimizedDefault() {
 
 //export callbackQPageSetupDialog_ShowNormal
 func callbackQPageSetupDialog_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ShowNormalDefault()
@@ -2610,7 +2645,7 @@ func (ptr *QPageSetupDialog) ShowNormalDefault() {
 
 //export callbackQPageSetupDialog_TabletEvent
 func callbackQPageSetupDialog_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -2625,7 +2660,7 @@ func (ptr *QPageSetupDialog) TabletEventDefault(event gui.QTabletEvent_ITF) {
 
 //export callbackQPageSetupDialog_Update
 func callbackQPageSetupDialog_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).UpdateDefault()
@@ -2640,7 +2675,7 @@ func (ptr *QPageSetupDialog) UpdateDefault() {
 
 //export callbackQPageSetupDialog_UpdateMicroFocus
 func callbackQPageSetupDialog_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).UpdateMicroFocusDefault()
@@ -2655,7 +2690,7 @@ func (ptr *QPageSetupDialog) UpdateMicroFocusDefault() {
 
 //export callbackQPageSetupDialog_WheelEvent
 func callbackQPageSetupDialog_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -2670,7 +2705,7 @@ func (ptr *QPageSetupDialog) WheelEventDefault(event gui.QWheelEvent_ITF) {
 
 //export callbackQPageSetupDialog_WindowIconChanged
 func callbackQPageSetupDialog_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -2678,7 +2713,7 @@ func callbackQPageSetupDialog_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.
 
 //export callbackQPageSetupDialog_WindowTitleChanged
 func callbackQPageSetupDialog_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -2686,7 +2721,7 @@ func callbackQPageSetupDialog_WindowTitleChanged(ptr unsafe.Pointer, title C.str
 
 //export callbackQPageSetupDialog_PaintEngine
 func callbackQPageSetupDialog_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -2702,7 +2737,7 @@ func (ptr *QPageSetupDialog) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQPageSetupDialog_InputMethodQuery
 func callbackQPageSetupDialog_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -2720,7 +2755,7 @@ func (ptr *QPageSetupDialog) InputMethodQueryDefault(query core.Qt__InputMethodQ
 
 //export callbackQPageSetupDialog_HasHeightForWidth
 func callbackQPageSetupDialog_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2736,7 +2771,7 @@ func (ptr *QPageSetupDialog) HasHeightForWidthDefault() bool {
 
 //export callbackQPageSetupDialog_HeightForWidth
 func callbackQPageSetupDialog_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -2752,7 +2787,7 @@ func (ptr *QPageSetupDialog) HeightForWidthDefault(w int) int {
 
 //export callbackQPageSetupDialog_Metric
 func callbackQPageSetupDialog_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -2768,7 +2803,7 @@ func (ptr *QPageSetupDialog) MetricDefault(m gui.QPaintDevice__PaintDeviceMetric
 
 //export callbackQPageSetupDialog_ChildEvent
 func callbackQPageSetupDialog_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -2783,7 +2818,7 @@ func (ptr *QPageSetupDialog) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQPageSetupDialog_ConnectNotify
 func callbackQPageSetupDialog_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -2798,7 +2833,7 @@ func (ptr *QPageSetupDialog) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQPageSetupDialog_CustomEvent
 func callbackQPageSetupDialog_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -2813,7 +2848,7 @@ func (ptr *QPageSetupDialog) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPageSetupDialog_DeleteLater
 func callbackQPageSetupDialog_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).DeleteLaterDefault()
@@ -2823,14 +2858,14 @@ func callbackQPageSetupDialog_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QPageSetupDialog) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QPageSetupDialog_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPageSetupDialog_Destroyed
 func callbackQPageSetupDialog_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -2838,7 +2873,7 @@ func callbackQPageSetupDialog_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQPageSetupDialog_DisconnectNotify
 func callbackQPageSetupDialog_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -2853,7 +2888,7 @@ func (ptr *QPageSetupDialog) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQPageSetupDialog_ObjectNameChanged
 func callbackQPageSetupDialog_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -2861,7 +2896,7 @@ func callbackQPageSetupDialog_ObjectNameChanged(ptr unsafe.Pointer, objectName C
 
 //export callbackQPageSetupDialog_TimerEvent
 func callbackQPageSetupDialog_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQPageSetupDialogFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -2876,7 +2911,7 @@ func (ptr *QPageSetupDialog) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQPageSetupDialog_MetaObject
 func callbackQPageSetupDialog_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -3044,7 +3079,7 @@ func NewQPrintDialogFromPointer(ptr unsafe.Pointer) *QPrintDialog {
 
 //export callbackQPrintDialog_Done
 func callbackQPrintDialog_Done(ptr unsafe.Pointer, result C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "done"); signal != nil {
+	if signal := qt.GetSignal(ptr, "done"); signal != nil {
 		signal.(func(int))(int(int32(result)))
 	} else {
 		NewQPrintDialogFromPointer(ptr).DoneDefault(int(int32(result)))
@@ -3054,14 +3089,14 @@ func callbackQPrintDialog_Done(ptr unsafe.Pointer, result C.int) {
 func (ptr *QPrintDialog) ConnectDone(f func(result int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "done", f)
+		qt.ConnectSignal(ptr.Pointer(), "done", f)
 	}
 }
 
 func (ptr *QPrintDialog) DisconnectDone() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "done")
+		qt.DisconnectSignal(ptr.Pointer(), "done")
 	}
 }
 
@@ -3079,7 +3114,7 @@ func (ptr *QPrintDialog) DoneDefault(result int) {
 
 func NewQPrintDialog(printer QPrinter_ITF, parent widgets.QWidget_ITF) *QPrintDialog {
 	var tmpValue = NewQPrintDialogFromPointer(C.QPrintDialog_NewQPrintDialog(PointerFromQPrinter(printer), widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3087,7 +3122,7 @@ func NewQPrintDialog(printer QPrinter_ITF, parent widgets.QWidget_ITF) *QPrintDi
 
 func NewQPrintDialog2(parent widgets.QWidget_ITF) *QPrintDialog {
 	var tmpValue = NewQPrintDialogFromPointer(C.QPrintDialog_NewQPrintDialog2(widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3095,7 +3130,7 @@ func NewQPrintDialog2(parent widgets.QWidget_ITF) *QPrintDialog {
 
 //export callbackQPrintDialog_Exec
 func callbackQPrintDialog_Exec(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "exec"); signal != nil {
+	if signal := qt.GetSignal(ptr, "exec"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -3105,14 +3140,14 @@ func callbackQPrintDialog_Exec(ptr unsafe.Pointer) C.int {
 func (ptr *QPrintDialog) ConnectExec(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "exec", f)
+		qt.ConnectSignal(ptr.Pointer(), "exec", f)
 	}
 }
 
 func (ptr *QPrintDialog) DisconnectExec() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "exec")
+		qt.DisconnectSignal(ptr.Pointer(), "exec")
 	}
 }
 
@@ -3132,7 +3167,7 @@ func (ptr *QPrintDialog) ExecDefault() int {
 
 //export callbackQPrintDialog_Accepted
 func callbackQPrintDialog_Accepted(ptr unsafe.Pointer, printer unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accepted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accepted"); signal != nil {
 		signal.(func(*QPrinter))(NewQPrinterFromPointer(printer))
 	}
 
@@ -3141,14 +3176,14 @@ func callbackQPrintDialog_Accepted(ptr unsafe.Pointer, printer unsafe.Pointer) {
 func (ptr *QPrintDialog) ConnectAccepted(f func(printer *QPrinter)) {
 	if ptr.Pointer() != nil {
 		C.QPrintDialog_ConnectAccepted(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "accepted", f)
+		qt.ConnectSignal(ptr.Pointer(), "accepted", f)
 	}
 }
 
 func (ptr *QPrintDialog) DisconnectAccepted() {
 	if ptr.Pointer() != nil {
 		C.QPrintDialog_DisconnectAccepted(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "accepted")
+		qt.DisconnectSignal(ptr.Pointer(), "accepted")
 	}
 }
 
@@ -3181,7 +3216,7 @@ func (ptr *QPrintDialog) SetOptions(options QAbstractPrintDialog__PrintDialogOpt
 func (ptr *QPrintDialog) DestroyQPrintDialog() {
 	if ptr.Pointer() != nil {
 		C.QPrintDialog_DestroyQPrintDialog(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3279,7 +3314,7 @@ const (
 
 //export callbackQPrintEngine_Abort
 func callbackQPrintEngine_Abort(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "abort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "abort"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3289,14 +3324,14 @@ func callbackQPrintEngine_Abort(ptr unsafe.Pointer) C.char {
 func (ptr *QPrintEngine) ConnectAbort(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "abort", f)
+		qt.ConnectSignal(ptr.Pointer(), "abort", f)
 	}
 }
 
 func (ptr *QPrintEngine) DisconnectAbort() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "abort")
+		qt.DisconnectSignal(ptr.Pointer(), "abort")
 	}
 }
 
@@ -3309,7 +3344,7 @@ func (ptr *QPrintEngine) Abort() bool {
 
 //export callbackQPrintEngine_NewPage
 func callbackQPrintEngine_NewPage(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "newPage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "newPage"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3319,14 +3354,14 @@ func callbackQPrintEngine_NewPage(ptr unsafe.Pointer) C.char {
 func (ptr *QPrintEngine) ConnectNewPage(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "newPage", f)
+		qt.ConnectSignal(ptr.Pointer(), "newPage", f)
 	}
 }
 
 func (ptr *QPrintEngine) DisconnectNewPage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "newPage")
+		qt.DisconnectSignal(ptr.Pointer(), "newPage")
 	}
 }
 
@@ -3339,7 +3374,7 @@ func (ptr *QPrintEngine) NewPage() bool {
 
 //export callbackQPrintEngine_SetProperty
 func callbackQPrintEngine_SetProperty(ptr unsafe.Pointer, key C.longlong, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setProperty"); signal != nil {
 		signal.(func(QPrintEngine__PrintEnginePropertyKey, *core.QVariant))(QPrintEngine__PrintEnginePropertyKey(key), core.NewQVariantFromPointer(value))
 	}
 
@@ -3348,14 +3383,14 @@ func callbackQPrintEngine_SetProperty(ptr unsafe.Pointer, key C.longlong, value
 func (ptr *QPrintEngine) ConnectSetProperty(f func(key QPrintEngine__PrintEnginePropertyKey, value *core.QVariant)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setProperty", f)
 	}
 }
 
 func (ptr *QPrintEngine) DisconnectSetProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setProperty")
 	}
 }
 
@@ -3367,7 +3402,7 @@ func (ptr *QPrintEngine) SetProperty(key QPrintEngine__PrintEnginePropertyKey, v
 
 //export callbackQPrintEngine_DestroyQPrintEngine
 func callbackQPrintEngine_DestroyQPrintEngine(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QPrintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QPrintEngine"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintEngineFromPointer(ptr).DestroyQPrintEngineDefault()
@@ -3377,21 +3412,21 @@ func callbackQPrintEngine_DestroyQPrintEngine(ptr unsafe.Pointer) {
 func (ptr *QPrintEngine) ConnectDestroyQPrintEngine(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QPrintEngine", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QPrintEngine", f)
 	}
 }
 
 func (ptr *QPrintEngine) DisconnectDestroyQPrintEngine() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QPrintEngine")
+		qt.DisconnectSignal(ptr.Pointer(), "~QPrintEngine")
 	}
 }
 
 func (ptr *QPrintEngine) DestroyQPrintEngine() {
 	if ptr.Pointer() != nil {
 		C.QPrintEngine_DestroyQPrintEngine(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3399,14 +3434,14 @@ func (ptr *QPrintEngine) DestroyQPrintEngine() {
 func (ptr *QPrintEngine) DestroyQPrintEngineDefault() {
 	if ptr.Pointer() != nil {
 		C.QPrintEngine_DestroyQPrintEngineDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPrintEngine_PrinterState
 func callbackQPrintEngine_PrinterState(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "printerState"); signal != nil {
+	if signal := qt.GetSignal(ptr, "printerState"); signal != nil {
 		return C.longlong(signal.(func() QPrinter__PrinterState)())
 	}
 
@@ -3416,14 +3451,14 @@ func callbackQPrintEngine_PrinterState(ptr unsafe.Pointer) C.longlong {
 func (ptr *QPrintEngine) ConnectPrinterState(f func() QPrinter__PrinterState) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "printerState", f)
+		qt.ConnectSignal(ptr.Pointer(), "printerState", f)
 	}
 }
 
 func (ptr *QPrintEngine) DisconnectPrinterState() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "printerState")
+		qt.DisconnectSignal(ptr.Pointer(), "printerState")
 	}
 }
 
@@ -3436,7 +3471,7 @@ func (ptr *QPrintEngine) PrinterState() QPrinter__PrinterState {
 
 //export callbackQPrintEngine_Property
 func callbackQPrintEngine_Property(ptr unsafe.Pointer, key C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "property"); signal != nil {
+	if signal := qt.GetSignal(ptr, "property"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(QPrintEngine__PrintEnginePropertyKey) *core.QVariant)(QPrintEngine__PrintEnginePropertyKey(key)))
 	}
 
@@ -3446,14 +3481,14 @@ func callbackQPrintEngine_Property(ptr unsafe.Pointer, key C.longlong) unsafe.Po
 func (ptr *QPrintEngine) ConnectProperty(f func(key QPrintEngine__PrintEnginePropertyKey) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "property", f)
+		qt.ConnectSignal(ptr.Pointer(), "property", f)
 	}
 }
 
 func (ptr *QPrintEngine) DisconnectProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "property")
+		qt.DisconnectSignal(ptr.Pointer(), "property")
 	}
 }
 
@@ -3468,7 +3503,7 @@ func (ptr *QPrintEngine) Property(key QPrintEngine__PrintEnginePropertyKey) *cor
 
 //export callbackQPrintEngine_Metric
 func callbackQPrintEngine_Metric(ptr unsafe.Pointer, id C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(id))))
 	}
 
@@ -3478,14 +3513,14 @@ func callbackQPrintEngine_Metric(ptr unsafe.Pointer, id C.longlong) C.int {
 func (ptr *QPrintEngine) ConnectMetric(f func(id gui.QPaintDevice__PaintDeviceMetric) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "metric", f)
+		qt.ConnectSignal(ptr.Pointer(), "metric", f)
 	}
 }
 
 func (ptr *QPrintEngine) DisconnectMetric() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "metric")
+		qt.DisconnectSignal(ptr.Pointer(), "metric")
 	}
 }
 
@@ -3536,7 +3571,7 @@ func NewQPrintPreviewDialogFromPointer(ptr unsafe.Pointer) *QPrintPreviewDialog
 }
 func NewQPrintPreviewDialog(printer QPrinter_ITF, parent widgets.QWidget_ITF, flags core.Qt__WindowType) *QPrintPreviewDialog {
 	var tmpValue = NewQPrintPreviewDialogFromPointer(C.QPrintPreviewDialog_NewQPrintPreviewDialog(PointerFromQPrinter(printer), widgets.PointerFromQWidget(parent), C.longlong(flags)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3544,7 +3579,7 @@ func NewQPrintPreviewDialog(printer QPrinter_ITF, parent widgets.QWidget_ITF, fl
 
 func NewQPrintPreviewDialog2(parent widgets.QWidget_ITF, flags core.Qt__WindowType) *QPrintPreviewDialog {
 	var tmpValue = NewQPrintPreviewDialogFromPointer(C.QPrintPreviewDialog_NewQPrintPreviewDialog2(widgets.PointerFromQWidget(parent), C.longlong(flags)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3559,7 +3594,7 @@ func (ptr *QPrintPreviewDialog) Printer() *QPrinter {
 
 //export callbackQPrintPreviewDialog_Done
 func callbackQPrintPreviewDialog_Done(ptr unsafe.Pointer, result C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "done"); signal != nil {
+	if signal := qt.GetSignal(ptr, "done"); signal != nil {
 		signal.(func(int))(int(int32(result)))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).DoneDefault(int(int32(result)))
@@ -3569,14 +3604,14 @@ func callbackQPrintPreviewDialog_Done(ptr unsafe.Pointer, result C.int) {
 func (ptr *QPrintPreviewDialog) ConnectDone(f func(result int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "done", f)
+		qt.ConnectSignal(ptr.Pointer(), "done", f)
 	}
 }
 
 func (ptr *QPrintPreviewDialog) DisconnectDone() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "done")
+		qt.DisconnectSignal(ptr.Pointer(), "done")
 	}
 }
 
@@ -3594,7 +3629,7 @@ func (ptr *QPrintPreviewDialog) DoneDefault(result int) {
 
 //export callbackQPrintPreviewDialog_PaintRequested
 func callbackQPrintPreviewDialog_PaintRequested(ptr unsafe.Pointer, printer unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintRequested"); signal != nil {
 		signal.(func(*QPrinter))(NewQPrinterFromPointer(printer))
 	}
 
@@ -3603,14 +3638,14 @@ func callbackQPrintPreviewDialog_PaintRequested(ptr unsafe.Pointer, printer unsa
 func (ptr *QPrintPreviewDialog) ConnectPaintRequested(f func(printer *QPrinter)) {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewDialog_ConnectPaintRequested(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paintRequested", f)
+		qt.ConnectSignal(ptr.Pointer(), "paintRequested", f)
 	}
 }
 
 func (ptr *QPrintPreviewDialog) DisconnectPaintRequested() {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewDialog_DisconnectPaintRequested(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paintRequested")
+		qt.DisconnectSignal(ptr.Pointer(), "paintRequested")
 	}
 }
 
@@ -3622,7 +3657,7 @@ func (ptr *QPrintPreviewDialog) PaintRequested(printer QPrinter_ITF) {
 
 //export callbackQPrintPreviewDialog_SetVisible
 func callbackQPrintPreviewDialog_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -3638,7 +3673,7 @@ func (ptr *QPrintPreviewDialog) SetVisibleDefault(visible bool) {
 func (ptr *QPrintPreviewDialog) DestroyQPrintPreviewDialog() {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewDialog_DestroyQPrintPreviewDialog(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3646,7 +3681,7 @@ func (ptr *QPrintPreviewDialog) DestroyQPrintPreviewDialog() {
 func (ptr *QPrintPreviewDialog) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QPrintPreviewDialog___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3667,7 +3702,7 @@ func (ptr *QPrintPreviewDialog) __addActions_actions_newList() unsafe.Pointer {
 func (ptr *QPrintPreviewDialog) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QPrintPreviewDialog___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3688,7 +3723,7 @@ func (ptr *QPrintPreviewDialog) __insertActions_actions_newList() unsafe.Pointer
 func (ptr *QPrintPreviewDialog) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QPrintPreviewDialog___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3728,7 +3763,7 @@ func (ptr *QPrintPreviewDialog) __dynamicPropertyNames_newList() unsafe.Pointer
 func (ptr *QPrintPreviewDialog) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPrintPreviewDialog___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3749,7 +3784,7 @@ func (ptr *QPrintPreviewDialog) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QPrintPreviewDialog) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPrintPreviewDialog___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3770,7 +3805,7 @@ func (ptr *QPrintPreviewDialog) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QPrintPreviewDialog) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPrintPreviewDialog___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3791,7 +3826,7 @@ func (ptr *QPrintPreviewDialog) __findChildren_newList() unsafe.Pointer {
 func (ptr *QPrintPreviewDialog) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPrintPreviewDialog___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3811,7 +3846,7 @@ func (ptr *QPrintPreviewDialog) __children_newList() unsafe.Pointer {
 
 //export callbackQPrintPreviewDialog_EventFilter
 func callbackQPrintPreviewDialog_EventFilter(ptr unsafe.Pointer, o unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(o), core.NewQEventFromPointer(e)))))
 	}
 
@@ -3827,7 +3862,7 @@ func (ptr *QPrintPreviewDialog) EventFilterDefault(o core.QObject_ITF, e core.QE
 
 //export callbackQPrintPreviewDialog_Exec
 func callbackQPrintPreviewDialog_Exec(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "exec"); signal != nil {
+	if signal := qt.GetSignal(ptr, "exec"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -3843,7 +3878,7 @@ func (ptr *QPrintPreviewDialog) ExecDefault() int {
 
 //export callbackQPrintPreviewDialog_Accept
 func callbackQPrintPreviewDialog_Accept(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accept"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accept"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).AcceptDefault()
@@ -3858,7 +3893,7 @@ func (ptr *QPrintPreviewDialog) AcceptDefault() {
 
 //export callbackQPrintPreviewDialog_Accepted
 func callbackQPrintPreviewDialog_Accepted(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accepted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accepted"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3866,7 +3901,7 @@ func callbackQPrintPreviewDialog_Accepted(ptr unsafe.Pointer) {
 
 //export callbackQPrintPreviewDialog_CloseEvent
 func callbackQPrintPreviewDialog_CloseEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(e))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(e))
@@ -3881,7 +3916,7 @@ func (ptr *QPrintPreviewDialog) CloseEventDefault(e gui.QCloseEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_ContextMenuEvent
 func callbackQPrintPreviewDialog_ContextMenuEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(e))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(e))
@@ -3896,7 +3931,7 @@ func (ptr *QPrintPreviewDialog) ContextMenuEventDefault(e gui.QContextMenuEvent_
 
 //export callbackQPrintPreviewDialog_Finished
 func callbackQPrintPreviewDialog_Finished(ptr unsafe.Pointer, result C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func(int))(int(int32(result)))
 	}
 
@@ -3904,7 +3939,7 @@ func callbackQPrintPreviewDialog_Finished(ptr unsafe.Pointer, result C.int) {
 
 //export callbackQPrintPreviewDialog_KeyPressEvent
 func callbackQPrintPreviewDialog_KeyPressEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(e))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(e))
@@ -3919,7 +3954,7 @@ func (ptr *QPrintPreviewDialog) KeyPressEventDefault(e gui.QKeyEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_Reject
 func callbackQPrintPreviewDialog_Reject(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reject"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).RejectDefault()
@@ -3934,7 +3969,7 @@ func (ptr *QPrintPreviewDialog) RejectDefault() {
 
 //export callbackQPrintPreviewDialog_Rejected
 func callbackQPrintPreviewDialog_Rejected(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rejected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rejected"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3942,7 +3977,7 @@ func callbackQPrintPreviewDialog_Rejected(ptr unsafe.Pointer) {
 
 //export callbackQPrintPreviewDialog_ResizeEvent
 func callbackQPrintPreviewDialog_ResizeEvent(ptr unsafe.Pointer, vqr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(vqr))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(vqr))
@@ -3957,7 +3992,7 @@ func (ptr *QPrintPreviewDialog) ResizeEventDefault(vqr gui.QResizeEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_ShowEvent
 func callbackQPrintPreviewDialog_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -3972,7 +4007,7 @@ func (ptr *QPrintPreviewDialog) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_MinimumSizeHint
 func callbackQPrintPreviewDialog_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -3990,7 +4025,7 @@ func (ptr *QPrintPreviewDialog) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQPrintPreviewDialog_SizeHint
 func callbackQPrintPreviewDialog_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -4008,7 +4043,7 @@ func (ptr *QPrintPreviewDialog) SizeHintDefault() *core.QSize {
 
 //export callbackQPrintPreviewDialog_Close
 func callbackQPrintPreviewDialog_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -4024,7 +4059,7 @@ func (ptr *QPrintPreviewDialog) CloseDefault() bool {
 
 //export callbackQPrintPreviewDialog_Event
 func callbackQPrintPreviewDialog_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -4040,7 +4075,7 @@ func (ptr *QPrintPreviewDialog) EventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQPrintPreviewDialog_FocusNextPrevChild
 func callbackQPrintPreviewDialog_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -4056,7 +4091,7 @@ func (ptr *QPrintPreviewDialog) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQPrintPreviewDialog_NativeEvent
 func callbackQPrintPreviewDialog_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -4072,7 +4107,7 @@ func (ptr *QPrintPreviewDialog) NativeEventDefault(eventType core.QByteArray_ITF
 
 //export callbackQPrintPreviewDialog_ActionEvent
 func callbackQPrintPreviewDialog_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -4087,7 +4122,7 @@ func (ptr *QPrintPreviewDialog) ActionEventDefault(event gui.QActionEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_ChangeEvent
 func callbackQPrintPreviewDialog_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -4102,7 +4137,7 @@ func (ptr *QPrintPreviewDialog) ChangeEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_CustomContextMenuRequested
 func callbackQPrintPreviewDialog_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -4110,7 +4145,7 @@ func callbackQPrintPreviewDialog_CustomContextMenuRequested(ptr unsafe.Pointer,
 
 //export callbackQPrintPreviewDialog_DragEnterEvent
 func callbackQPrintPreviewDialog_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -4125,7 +4160,7 @@ func (ptr *QPrintPreviewDialog) DragEnterEventDefault(event gui.QDragEnterEvent_
 
 //export callbackQPrintPreviewDialog_DragLeaveEvent
 func callbackQPrintPreviewDialog_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -4140,7 +4175,7 @@ func (ptr *QPrintPreviewDialog) DragLeaveEventDefault(event gui.QDragLeaveEvent_
 
 //export callbackQPrintPreviewDialog_DragMoveEvent
 func callbackQPrintPreviewDialog_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -4155,7 +4190,7 @@ func (ptr *QPrintPreviewDialog) DragMoveEventDefault(event gui.QDragMoveEvent_IT
 
 //export callbackQPrintPreviewDialog_DropEvent
 func callbackQPrintPreviewDialog_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -4170,7 +4205,7 @@ func (ptr *QPrintPreviewDialog) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_EnterEvent
 func callbackQPrintPreviewDialog_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -4185,7 +4220,7 @@ func (ptr *QPrintPreviewDialog) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_FocusInEvent
 func callbackQPrintPreviewDialog_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -4200,7 +4235,7 @@ func (ptr *QPrintPreviewDialog) FocusInEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_FocusOutEvent
 func callbackQPrintPreviewDialog_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -4215,7 +4250,7 @@ func (ptr *QPrintPreviewDialog) FocusOutEventDefault(event gui.QFocusEvent_ITF)
 
 //export callbackQPrintPreviewDialog_Hide
 func callbackQPrintPreviewDialog_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).HideDefault()
@@ -4230,7 +4265,7 @@ func (ptr *QPrintPreviewDialog) HideDefault() {
 
 //export callbackQPrintPreviewDialog_HideEvent
 func callbackQPrintPreviewDialog_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -4245,7 +4280,7 @@ func (ptr *QPrintPreviewDialog) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_InputMethodEvent
 func callbackQPrintPreviewDialog_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -4260,7 +4295,7 @@ func (ptr *QPrintPreviewDialog) InputMethodEventDefault(event gui.QInputMethodEv
 
 //export callbackQPrintPreviewDialog_KeyReleaseEvent
 func callbackQPrintPreviewDialog_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -4275,7 +4310,7 @@ func (ptr *QPrintPreviewDialog) KeyReleaseEventDefault(event gui.QKeyEvent_ITF)
 
 //export callbackQPrintPreviewDialog_LeaveEvent
 func callbackQPrintPreviewDialog_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -4290,7 +4325,7 @@ func (ptr *QPrintPreviewDialog) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_Lower
 func callbackQPrintPreviewDialog_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).LowerDefault()
@@ -4305,7 +4340,7 @@ func (ptr *QPrintPreviewDialog) LowerDefault() {
 
 //export callbackQPrintPreviewDialog_MouseDoubleClickEvent
 func callbackQPrintPreviewDialog_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -4320,7 +4355,7 @@ func (ptr *QPrintPreviewDialog) MouseDoubleClickEventDefault(event gui.QMouseEve
 
 //export callbackQPrintPreviewDialog_MouseMoveEvent
 func callbackQPrintPreviewDialog_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -4335,7 +4370,7 @@ func (ptr *QPrintPreviewDialog) MouseMoveEventDefault(event gui.QMouseEvent_ITF)
 
 //export callbackQPrintPreviewDialog_MousePressEvent
 func callbackQPrintPreviewDialog_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -4350,7 +4385,7 @@ func (ptr *QPrintPreviewDialog) MousePressEventDefault(event gui.QMouseEvent_ITF
 
 //export callbackQPrintPreviewDialog_MouseReleaseEvent
 func callbackQPrintPreviewDialog_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -4365,7 +4400,7 @@ func (ptr *QPrintPreviewDialog) MouseReleaseEventDefault(event gui.QMouseEvent_I
 
 //export callbackQPrintPreviewDialog_MoveEvent
 func callbackQPrintPreviewDialog_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -4380,7 +4415,7 @@ func (ptr *QPrintPreviewDialog) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_PaintEvent
 func callbackQPrintPreviewDialog_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -4395,7 +4430,7 @@ func (ptr *QPrintPreviewDialog) PaintEventDefault(event gui.QPaintEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_Raise
 func callbackQPrintPreviewDialog_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).RaiseDefault()
@@ -4410,7 +4445,7 @@ func (ptr *QPrintPreviewDialog) RaiseDefault() {
 
 //export callbackQPrintPreviewDialog_Repaint
 func callbackQPrintPreviewDialog_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).RepaintDefault()
@@ -4425,7 +4460,7 @@ func (ptr *QPrintPreviewDialog) RepaintDefault() {
 
 //export callbackQPrintPreviewDialog_SetDisabled
 func callbackQPrintPreviewDialog_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -4440,7 +4475,7 @@ func (ptr *QPrintPreviewDialog) SetDisabledDefault(disable bool) {
 
 //export callbackQPrintPreviewDialog_SetEnabled
 func callbackQPrintPreviewDialog_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -4455,7 +4490,7 @@ func (ptr *QPrintPreviewDialog) SetEnabledDefault(vbo bool) {
 
 //export callbackQPrintPreviewDialog_SetFocus2
 func callbackQPrintPreviewDialog_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).SetFocus2Default()
@@ -4470,7 +4505,7 @@ func (ptr *QPrintPreviewDialog) SetFocus2Default() {
 
 //export callbackQPrintPreviewDialog_SetHidden
 func callbackQPrintPreviewDialog_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -4485,7 +4520,7 @@ func (ptr *QPrintPreviewDialog) SetHiddenDefault(hidden bool) {
 
 //export callbackQPrintPreviewDialog_SetStyleSheet
 func callbackQPrintPreviewDialog_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -4502,7 +4537,7 @@ func (ptr *QPrintPreviewDialog) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQPrintPreviewDialog_SetWindowModified
 func callbackQPrintPreviewDialog_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -4517,7 +4552,7 @@ func (ptr *QPrintPreviewDialog) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQPrintPreviewDialog_SetWindowTitle
 func callbackQPrintPreviewDialog_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -4534,7 +4569,7 @@ func (ptr *QPrintPreviewDialog) SetWindowTitleDefault(vqs string) {
 
 //export callbackQPrintPreviewDialog_Show
 func callbackQPrintPreviewDialog_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ShowDefault()
@@ -4549,7 +4584,7 @@ func (ptr *QPrintPreviewDialog) ShowDefault() {
 
 //export callbackQPrintPreviewDialog_ShowFullScreen
 func callbackQPrintPreviewDialog_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ShowFullScreenDefault()
@@ -4564,7 +4599,7 @@ func (ptr *QPrintPreviewDialog) ShowFullScreenDefault() {
 
 //export callbackQPrintPreviewDialog_ShowMaximized
 func callbackQPrintPreviewDialog_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ShowMaximizedDefault()
@@ -4579,7 +4614,7 @@ func (ptr *QPrintPreviewDialog) ShowMaximizedDefault() {
 
 //export callbackQPrintPreviewDialog_ShowMinimized
 func callbackQPrintPreviewDialog_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ShowMinimizedDefault()
@@ -4594,7 +4629,7 @@ func (ptr *QPrintPreviewDialog) ShowMinimizedDefault() {
 
 //export callbackQPrintPreviewDialog_ShowNormal
 func callbackQPrintPreviewDialog_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ShowNormalDefault()
@@ -4609,7 +4644,7 @@ func (ptr *QPrintPreviewDialog) ShowNormalDefault() {
 
 //export callbackQPrintPreviewDialog_TabletEvent
 func callbackQPrintPreviewDialog_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -4624,7 +4659,7 @@ func (ptr *QPrintPreviewDialog) TabletEventDefault(event gui.QTabletEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_Update
 func callbackQPrintPreviewDialog_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).UpdateDefault()
@@ -4639,7 +4674,7 @@ func (ptr *QPrintPreviewDialog) UpdateDefault() {
 
 //export callbackQPrintPreviewDialog_UpdateMicroFocus
 func callbackQPrintPreviewDialog_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).UpdateMicroFocusDefault()
@@ -4654,7 +4689,7 @@ func (ptr *QPrintPreviewDialog) UpdateMicroFocusDefault() {
 
 //export callbackQPrintPreviewDialog_WheelEvent
 func callbackQPrintPreviewDialog_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -4669,7 +4704,7 @@ func (ptr *QPrintPreviewDialog) WheelEventDefault(event gui.QWheelEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_WindowIconChanged
 func callbackQPrintPreviewDialog_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -4677,7 +4712,7 @@ func callbackQPrintPreviewDialog_WindowIconChanged(ptr unsafe.Pointer, icon unsa
 
 //export callbackQPrintPreviewDialog_WindowTitleChanged
 func callbackQPrintPreviewDialog_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -4685,7 +4720,7 @@ func callbackQPrintPreviewDialog_WindowTitleChanged(ptr unsafe.Pointer, title C.
 
 //export callbackQPrintPreviewDialog_PaintEngine
 func callbackQPrintPreviewDialog_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -4701,7 +4736,7 @@ func (ptr *QPrintPreviewDialog) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQPrintPreviewDialog_InputMethodQuery
 func callbackQPrintPreviewDialog_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -4719,7 +4754,7 @@ func (ptr *QPrintPreviewDialog) InputMethodQueryDefault(query core.Qt__InputMeth
 
 //export callbackQPrintPreviewDialog_HasHeightForWidth
 func callbackQPrintPreviewDialog_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -4735,7 +4770,7 @@ func (ptr *QPrintPreviewDialog) HasHeightForWidthDefault() bool {
 
 //export callbackQPrintPreviewDialog_HeightForWidth
 func callbackQPrintPreviewDialog_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -4751,7 +4786,7 @@ func (ptr *QPrintPreviewDialog) HeightForWidthDefault(w int) int {
 
 //export callbackQPrintPreviewDialog_Metric
 func callbackQPrintPreviewDialog_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -4767,7 +4802,7 @@ func (ptr *QPrintPreviewDialog) MetricDefault(m gui.QPaintDevice__PaintDeviceMet
 
 //export callbackQPrintPreviewDialog_ChildEvent
 func callbackQPrintPreviewDialog_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -4782,7 +4817,7 @@ func (ptr *QPrintPreviewDialog) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_ConnectNotify
 func callbackQPrintPreviewDialog_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4797,7 +4832,7 @@ func (ptr *QPrintPreviewDialog) ConnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQPrintPreviewDialog_CustomEvent
 func callbackQPrintPreviewDialog_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -4812,7 +4847,7 @@ func (ptr *QPrintPreviewDialog) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_DeleteLater
 func callbackQPrintPreviewDialog_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).DeleteLaterDefault()
@@ -4822,14 +4857,14 @@ func callbackQPrintPreviewDialog_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewDialog) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewDialog_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPrintPreviewDialog_Destroyed
 func callbackQPrintPreviewDialog_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -4837,7 +4872,7 @@ func callbackQPrintPreviewDialog_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointe
 
 //export callbackQPrintPreviewDialog_DisconnectNotify
 func callbackQPrintPreviewDialog_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4852,7 +4887,7 @@ func (ptr *QPrintPreviewDialog) DisconnectNotifyDefault(sign core.QMetaMethod_IT
 
 //export callbackQPrintPreviewDialog_ObjectNameChanged
 func callbackQPrintPreviewDialog_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -4860,7 +4895,7 @@ func callbackQPrintPreviewDialog_ObjectNameChanged(ptr unsafe.Pointer, objectNam
 
 //export callbackQPrintPreviewDialog_TimerEvent
 func callbackQPrintPreviewDialog_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQPrintPreviewDialogFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -4875,7 +4910,7 @@ func (ptr *QPrintPreviewDialog) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQPrintPreviewDialog_MetaObject
 func callbackQPrintPreviewDialog_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -4950,7 +4985,7 @@ const (
 
 func NewQPrintPreviewWidget(printer QPrinter_ITF, parent widgets.QWidget_ITF, flags core.Qt__WindowType) *QPrintPreviewWidget {
 	var tmpValue = NewQPrintPreviewWidgetFromPointer(C.QPrintPreviewWidget_NewQPrintPreviewWidget(PointerFromQPrinter(printer), widgets.PointerFromQWidget(parent), C.longlong(flags)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4958,7 +4993,7 @@ func NewQPrintPreviewWidget(printer QPrinter_ITF, parent widgets.QWidget_ITF, fl
 
 func NewQPrintPreviewWidget2(parent widgets.QWidget_ITF, flags core.Qt__WindowType) *QPrintPreviewWidget {
 	var tmpValue = NewQPrintPreviewWidgetFromPointer(C.QPrintPreviewWidget_NewQPrintPreviewWidget2(widgets.PointerFromQWidget(parent), C.longlong(flags)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4966,7 +5001,7 @@ func NewQPrintPreviewWidget2(parent widgets.QWidget_ITF, flags core.Qt__WindowTy
 
 //export callbackQPrintPreviewWidget_FitInView
 func callbackQPrintPreviewWidget_FitInView(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fitInView"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fitInView"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).FitInViewDefault()
@@ -4976,14 +5011,14 @@ func callbackQPrintPreviewWidget_FitInView(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectFitInView(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fitInView", f)
+		qt.ConnectSignal(ptr.Pointer(), "fitInView", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectFitInView() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fitInView")
+		qt.DisconnectSignal(ptr.Pointer(), "fitInView")
 	}
 }
 
@@ -5001,7 +5036,7 @@ func (ptr *QPrintPreviewWidget) FitInViewDefault() {
 
 //export callbackQPrintPreviewWidget_FitToWidth
 func callbackQPrintPreviewWidget_FitToWidth(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fitToWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fitToWidth"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).FitToWidthDefault()
@@ -5011,14 +5046,14 @@ func callbackQPrintPreviewWidget_FitToWidth(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectFitToWidth(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fitToWidth", f)
+		qt.ConnectSignal(ptr.Pointer(), "fitToWidth", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectFitToWidth() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fitToWidth")
+		qt.DisconnectSignal(ptr.Pointer(), "fitToWidth")
 	}
 }
 
@@ -5036,7 +5071,7 @@ func (ptr *QPrintPreviewWidget) FitToWidthDefault() {
 
 //export callbackQPrintPreviewWidget_PaintRequested
 func callbackQPrintPreviewWidget_PaintRequested(ptr unsafe.Pointer, printer unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintRequested"); signal != nil {
 		signal.(func(*QPrinter))(NewQPrinterFromPointer(printer))
 	}
 
@@ -5045,14 +5080,14 @@ func callbackQPrintPreviewWidget_PaintRequested(ptr unsafe.Pointer, printer unsa
 func (ptr *QPrintPreviewWidget) ConnectPaintRequested(f func(printer *QPrinter)) {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewWidget_ConnectPaintRequested(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paintRequested", f)
+		qt.ConnectSignal(ptr.Pointer(), "paintRequested", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectPaintRequested() {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewWidget_DisconnectPaintRequested(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paintRequested")
+		qt.DisconnectSignal(ptr.Pointer(), "paintRequested")
 	}
 }
 
@@ -5064,7 +5099,7 @@ func (ptr *QPrintPreviewWidget) PaintRequested(printer QPrinter_ITF) {
 
 //export callbackQPrintPreviewWidget_PreviewChanged
 func callbackQPrintPreviewWidget_PreviewChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "previewChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "previewChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5073,14 +5108,14 @@ func callbackQPrintPreviewWidget_PreviewChanged(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectPreviewChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewWidget_ConnectPreviewChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "previewChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "previewChanged", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectPreviewChanged() {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewWidget_DisconnectPreviewChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "previewChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "previewChanged")
 	}
 }
 
@@ -5092,7 +5127,7 @@ func (ptr *QPrintPreviewWidget) PreviewChanged() {
 
 //export callbackQPrintPreviewWidget_Print
 func callbackQPrintPreviewWidget_Print(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "print"); signal != nil {
+	if signal := qt.GetSignal(ptr, "print"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).PrintDefault()
@@ -5102,14 +5137,14 @@ func callbackQPrintPreviewWidget_Print(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectPrint(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "print", f)
+		qt.ConnectSignal(ptr.Pointer(), "print", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectPrint() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "print")
+		qt.DisconnectSignal(ptr.Pointer(), "print")
 	}
 }
 
@@ -5127,7 +5162,7 @@ func (ptr *QPrintPreviewWidget) PrintDefault() {
 
 //export callbackQPrintPreviewWidget_SetAllPagesViewMode
 func callbackQPrintPreviewWidget_SetAllPagesViewMode(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setAllPagesViewMode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setAllPagesViewMode"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetAllPagesViewModeDefault()
@@ -5137,14 +5172,14 @@ func callbackQPrintPreviewWidget_SetAllPagesViewMode(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectSetAllPagesViewMode(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setAllPagesViewMode", f)
+		qt.ConnectSignal(ptr.Pointer(), "setAllPagesViewMode", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetAllPagesViewMode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setAllPagesViewMode")
+		qt.DisconnectSignal(ptr.Pointer(), "setAllPagesViewMode")
 	}
 }
 
@@ -5162,7 +5197,7 @@ func (ptr *QPrintPreviewWidget) SetAllPagesViewModeDefault() {
 
 //export callbackQPrintPreviewWidget_SetCurrentPage
 func callbackQPrintPreviewWidget_SetCurrentPage(ptr unsafe.Pointer, page C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setCurrentPage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setCurrentPage"); signal != nil {
 		signal.(func(int))(int(int32(page)))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetCurrentPageDefault(int(int32(page)))
@@ -5172,14 +5207,14 @@ func callbackQPrintPreviewWidget_SetCurrentPage(ptr unsafe.Pointer, page C.int)
 func (ptr *QPrintPreviewWidget) ConnectSetCurrentPage(f func(page int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentPage", f)
+		qt.ConnectSignal(ptr.Pointer(), "setCurrentPage", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetCurrentPage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setCurrentPage")
+		qt.DisconnectSignal(ptr.Pointer(), "setCurrentPage")
 	}
 }
 
@@ -5197,7 +5232,7 @@ func (ptr *QPrintPreviewWidget) SetCurrentPageDefault(page int) {
 
 //export callbackQPrintPreviewWidget_SetFacingPagesViewMode
 func callbackQPrintPreviewWidget_SetFacingPagesViewMode(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFacingPagesViewMode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFacingPagesViewMode"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetFacingPagesViewModeDefault()
@@ -5207,14 +5242,14 @@ func callbackQPrintPreviewWidget_SetFacingPagesViewMode(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectSetFacingPagesViewMode(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFacingPagesViewMode", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFacingPagesViewMode", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetFacingPagesViewMode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFacingPagesViewMode")
+		qt.DisconnectSignal(ptr.Pointer(), "setFacingPagesViewMode")
 	}
 }
 
@@ -5232,7 +5267,7 @@ func (ptr *QPrintPreviewWidget) SetFacingPagesViewModeDefault() {
 
 //export callbackQPrintPreviewWidget_SetLandscapeOrientation
 func callbackQPrintPreviewWidget_SetLandscapeOrientation(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setLandscapeOrientation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setLandscapeOrientation"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetLandscapeOrientationDefault()
@@ -5242,14 +5277,14 @@ func callbackQPrintPreviewWidget_SetLandscapeOrientation(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectSetLandscapeOrientation(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setLandscapeOrientation", f)
+		qt.ConnectSignal(ptr.Pointer(), "setLandscapeOrientation", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetLandscapeOrientation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setLandscapeOrientation")
+		qt.DisconnectSignal(ptr.Pointer(), "setLandscapeOrientation")
 	}
 }
 
@@ -5267,7 +5302,7 @@ func (ptr *QPrintPreviewWidget) SetLandscapeOrientationDefault() {
 
 //export callbackQPrintPreviewWidget_SetOrientation
 func callbackQPrintPreviewWidget_SetOrientation(ptr unsafe.Pointer, orientation C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setOrientation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setOrientation"); signal != nil {
 		signal.(func(QPrinter__Orientation))(QPrinter__Orientation(orientation))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetOrientationDefault(QPrinter__Orientation(orientation))
@@ -5277,14 +5312,14 @@ func callbackQPrintPreviewWidget_SetOrientation(ptr unsafe.Pointer, orientation
 func (ptr *QPrintPreviewWidget) ConnectSetOrientation(f func(orientation QPrinter__Orientation)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setOrientation", f)
+		qt.ConnectSignal(ptr.Pointer(), "setOrientation", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetOrientation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setOrientation")
+		qt.DisconnectSignal(ptr.Pointer(), "setOrientation")
 	}
 }
 
@@ -5302,7 +5337,7 @@ func (ptr *QPrintPreviewWidget) SetOrientationDefault(orientation QPrinter__Orie
 
 //export callbackQPrintPreviewWidget_SetPortraitOrientation
 func callbackQPrintPreviewWidget_SetPortraitOrientation(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPortraitOrientation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPortraitOrientation"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetPortraitOrientationDefault()
@@ -5312,14 +5347,14 @@ func callbackQPrintPreviewWidget_SetPortraitOrientation(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectSetPortraitOrientation(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPortraitOrientation", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPortraitOrientation", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetPortraitOrientation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPortraitOrientation")
+		qt.DisconnectSignal(ptr.Pointer(), "setPortraitOrientation")
 	}
 }
 
@@ -5337,7 +5372,7 @@ func (ptr *QPrintPreviewWidget) SetPortraitOrientationDefault() {
 
 //export callbackQPrintPreviewWidget_SetSinglePageViewMode
 func callbackQPrintPreviewWidget_SetSinglePageViewMode(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSinglePageViewMode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSinglePageViewMode"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetSinglePageViewModeDefault()
@@ -5347,14 +5382,14 @@ func callbackQPrintPreviewWidget_SetSinglePageViewMode(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectSetSinglePageViewMode(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSinglePageViewMode", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSinglePageViewMode", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetSinglePageViewMode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSinglePageViewMode")
+		qt.DisconnectSignal(ptr.Pointer(), "setSinglePageViewMode")
 	}
 }
 
@@ -5372,7 +5407,7 @@ func (ptr *QPrintPreviewWidget) SetSinglePageViewModeDefault() {
 
 //export callbackQPrintPreviewWidget_SetViewMode
 func callbackQPrintPreviewWidget_SetViewMode(ptr unsafe.Pointer, mode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setViewMode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setViewMode"); signal != nil {
 		signal.(func(QPrintPreviewWidget__ViewMode))(QPrintPreviewWidget__ViewMode(mode))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetViewModeDefault(QPrintPreviewWidget__ViewMode(mode))
@@ -5382,14 +5417,14 @@ func callbackQPrintPreviewWidget_SetViewMode(ptr unsafe.Pointer, mode C.longlong
 func (ptr *QPrintPreviewWidget) ConnectSetViewMode(f func(mode QPrintPreviewWidget__ViewMode)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setViewMode", f)
+		qt.ConnectSignal(ptr.Pointer(), "setViewMode", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetViewMode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setViewMode")
+		qt.DisconnectSignal(ptr.Pointer(), "setViewMode")
 	}
 }
 
@@ -5407,7 +5442,7 @@ func (ptr *QPrintPreviewWidget) SetViewModeDefault(mode QPrintPreviewWidget__Vie
 
 //export callbackQPrintPreviewWidget_SetVisible
 func callbackQPrintPreviewWidget_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -5417,14 +5452,14 @@ func callbackQPrintPreviewWidget_SetVisible(ptr unsafe.Pointer, visible C.char)
 func (ptr *QPrintPreviewWidget) ConnectSetVisible(f func(visible bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setVisible", f)
+		qt.ConnectSignal(ptr.Pointer(), "setVisible", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetVisible() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setVisible")
+		qt.DisconnectSignal(ptr.Pointer(), "setVisible")
 	}
 }
 
@@ -5442,7 +5477,7 @@ func (ptr *QPrintPreviewWidget) SetVisibleDefault(visible bool) {
 
 //export callbackQPrintPreviewWidget_SetZoomFactor
 func callbackQPrintPreviewWidget_SetZoomFactor(ptr unsafe.Pointer, factor C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setZoomFactor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setZoomFactor"); signal != nil {
 		signal.(func(float64))(float64(factor))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetZoomFactorDefault(float64(factor))
@@ -5452,14 +5487,14 @@ func callbackQPrintPreviewWidget_SetZoomFactor(ptr unsafe.Pointer, factor C.doub
 func (ptr *QPrintPreviewWidget) ConnectSetZoomFactor(f func(factor float64)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setZoomFactor", f)
+		qt.ConnectSignal(ptr.Pointer(), "setZoomFactor", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetZoomFactor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setZoomFactor")
+		qt.DisconnectSignal(ptr.Pointer(), "setZoomFactor")
 	}
 }
 
@@ -5477,7 +5512,7 @@ func (ptr *QPrintPreviewWidget) SetZoomFactorDefault(factor float64) {
 
 //export callbackQPrintPreviewWidget_SetZoomMode
 func callbackQPrintPreviewWidget_SetZoomMode(ptr unsafe.Pointer, zoomMode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setZoomMode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setZoomMode"); signal != nil {
 		signal.(func(QPrintPreviewWidget__ZoomMode))(QPrintPreviewWidget__ZoomMode(zoomMode))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetZoomModeDefault(QPrintPreviewWidget__ZoomMode(zoomMode))
@@ -5487,14 +5522,14 @@ func callbackQPrintPreviewWidget_SetZoomMode(ptr unsafe.Pointer, zoomMode C.long
 func (ptr *QPrintPreviewWidget) ConnectSetZoomMode(f func(zoomMode QPrintPreviewWidget__ZoomMode)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setZoomMode", f)
+		qt.ConnectSignal(ptr.Pointer(), "setZoomMode", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectSetZoomMode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setZoomMode")
+		qt.DisconnectSignal(ptr.Pointer(), "setZoomMode")
 	}
 }
 
@@ -5512,7 +5547,7 @@ func (ptr *QPrintPreviewWidget) SetZoomModeDefault(zoomMode QPrintPreviewWidget_
 
 //export callbackQPrintPreviewWidget_UpdatePreview
 func callbackQPrintPreviewWidget_UpdatePreview(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updatePreview"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updatePreview"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).UpdatePreviewDefault()
@@ -5522,14 +5557,14 @@ func callbackQPrintPreviewWidget_UpdatePreview(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) ConnectUpdatePreview(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updatePreview", f)
+		qt.ConnectSignal(ptr.Pointer(), "updatePreview", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectUpdatePreview() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updatePreview")
+		qt.DisconnectSignal(ptr.Pointer(), "updatePreview")
 	}
 }
 
@@ -5547,7 +5582,7 @@ func (ptr *QPrintPreviewWidget) UpdatePreviewDefault() {
 
 //export callbackQPrintPreviewWidget_ZoomIn
 func callbackQPrintPreviewWidget_ZoomIn(ptr unsafe.Pointer, factor C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zoomIn"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zoomIn"); signal != nil {
 		signal.(func(float64))(float64(factor))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ZoomInDefault(float64(factor))
@@ -5557,14 +5592,14 @@ func callbackQPrintPreviewWidget_ZoomIn(ptr unsafe.Pointer, factor C.double) {
 func (ptr *QPrintPreviewWidget) ConnectZoomIn(f func(factor float64)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zoomIn", f)
+		qt.ConnectSignal(ptr.Pointer(), "zoomIn", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectZoomIn() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zoomIn")
+		qt.DisconnectSignal(ptr.Pointer(), "zoomIn")
 	}
 }
 
@@ -5582,7 +5617,7 @@ func (ptr *QPrintPreviewWidget) ZoomInDefault(factor float64) {
 
 //export callbackQPrintPreviewWidget_ZoomOut
 func callbackQPrintPreviewWidget_ZoomOut(ptr unsafe.Pointer, factor C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zoomOut"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zoomOut"); signal != nil {
 		signal.(func(float64))(float64(factor))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ZoomOutDefault(float64(factor))
@@ -5592,14 +5627,14 @@ func callbackQPrintPreviewWidget_ZoomOut(ptr unsafe.Pointer, factor C.double) {
 func (ptr *QPrintPreviewWidget) ConnectZoomOut(f func(factor float64)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "zoomOut", f)
+		qt.ConnectSignal(ptr.Pointer(), "zoomOut", f)
 	}
 }
 
 func (ptr *QPrintPreviewWidget) DisconnectZoomOut() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "zoomOut")
+		qt.DisconnectSignal(ptr.Pointer(), "zoomOut")
 	}
 }
 
@@ -5618,7 +5653,7 @@ func (ptr *QPrintPreviewWidget) ZoomOutDefault(factor float64) {
 func (ptr *QPrintPreviewWidget) DestroyQPrintPreviewWidget() {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewWidget_DestroyQPrintPreviewWidget(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5668,7 +5703,7 @@ func (ptr *QPrintPreviewWidget) ZoomFactor() float64 {
 func (ptr *QPrintPreviewWidget) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QPrintPreviewWidget___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5689,7 +5724,7 @@ func (ptr *QPrintPreviewWidget) __addActions_actions_newList() unsafe.Pointer {
 func (ptr *QPrintPreviewWidget) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QPrintPreviewWidget___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5710,7 +5745,7 @@ func (ptr *QPrintPreviewWidget) __insertActions_actions_newList() unsafe.Pointer
 func (ptr *QPrintPreviewWidget) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QPrintPreviewWidget___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5750,7 +5785,7 @@ func (ptr *QPrintPreviewWidget) __dynamicPropertyNames_newList() unsafe.Pointer
 func (ptr *QPrintPreviewWidget) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPrintPreviewWidget___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5771,7 +5806,7 @@ func (ptr *QPrintPreviewWidget) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QPrintPreviewWidget) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPrintPreviewWidget___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5792,7 +5827,7 @@ func (ptr *QPrintPreviewWidget) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QPrintPreviewWidget) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPrintPreviewWidget___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5813,7 +5848,7 @@ func (ptr *QPrintPreviewWidget) __findChildren_newList() unsafe.Pointer {
 func (ptr *QPrintPreviewWidget) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QPrintPreviewWidget___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5833,7 +5868,7 @@ func (ptr *QPrintPreviewWidget) __children_newList() unsafe.Pointer {
 
 //export callbackQPrintPreviewWidget_Close
 func callbackQPrintPreviewWidget_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5849,7 +5884,7 @@ func (ptr *QPrintPreviewWidget) CloseDefault() bool {
 
 //export callbackQPrintPreviewWidget_Event
 func callbackQPrintPreviewWidget_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -5865,7 +5900,7 @@ func (ptr *QPrintPreviewWidget) EventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQPrintPreviewWidget_FocusNextPrevChild
 func callbackQPrintPreviewWidget_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -5881,7 +5916,7 @@ func (ptr *QPrintPreviewWidget) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQPrintPreviewWidget_NativeEvent
 func callbackQPrintPreviewWidget_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -5897,7 +5932,7 @@ func (ptr *QPrintPreviewWidget) NativeEventDefault(eventType core.QByteArray_ITF
 
 //export callbackQPrintPreviewWidget_ActionEvent
 func callbackQPrintPreviewWidget_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -5912,7 +5947,7 @@ func (ptr *QPrintPreviewWidget) ActionEventDefault(event gui.QActionEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_ChangeEvent
 func callbackQPrintPreviewWidget_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -5927,7 +5962,7 @@ func (ptr *QPrintPreviewWidget) ChangeEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_CloseEvent
 func callbackQPrintPreviewWidget_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -5942,7 +5977,7 @@ func (ptr *QPrintPreviewWidget) CloseEventDefault(event gui.QCloseEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_ContextMenuEvent
 func callbackQPrintPreviewWidget_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -5957,7 +5992,7 @@ func (ptr *QPrintPreviewWidget) ContextMenuEventDefault(event gui.QContextMenuEv
 
 //export callbackQPrintPreviewWidget_CustomContextMenuRequested
 func callbackQPrintPreviewWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -5965,7 +6000,7 @@ func callbackQPrintPreviewWidget_CustomContextMenuRequested(ptr unsafe.Pointer,
 
 //export callbackQPrintPreviewWidget_DragEnterEvent
 func callbackQPrintPreviewWidget_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -5980,7 +6015,7 @@ func (ptr *QPrintPreviewWidget) DragEnterEventDefault(event gui.QDragEnterEvent_
 
 //export callbackQPrintPreviewWidget_DragLeaveEvent
 func callbackQPrintPreviewWidget_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -5995,7 +6030,7 @@ func (ptr *QPrintPreviewWidget) DragLeaveEventDefault(event gui.QDragLeaveEvent_
 
 //export callbackQPrintPreviewWidget_DragMoveEvent
 func callbackQPrintPreviewWidget_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -6010,7 +6045,7 @@ func (ptr *QPrintPreviewWidget) DragMoveEventDefault(event gui.QDragMoveEvent_IT
 
 //export callbackQPrintPreviewWidget_DropEvent
 func callbackQPrintPreviewWidget_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -6025,7 +6060,7 @@ func (ptr *QPrintPreviewWidget) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_EnterEvent
 func callbackQPrintPreviewWidget_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -6040,7 +6075,7 @@ func (ptr *QPrintPreviewWidget) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_FocusInEvent
 func callbackQPrintPreviewWidget_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -6055,7 +6090,7 @@ func (ptr *QPrintPreviewWidget) FocusInEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_FocusOutEvent
 func callbackQPrintPreviewWidget_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -6070,7 +6105,7 @@ func (ptr *QPrintPreviewWidget) FocusOutEventDefault(event gui.QFocusEvent_ITF)
 
 //export callbackQPrintPreviewWidget_Hide
 func callbackQPrintPreviewWidget_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).HideDefault()
@@ -6085,7 +6120,7 @@ func (ptr *QPrintPreviewWidget) HideDefault() {
 
 //export callbackQPrintPreviewWidget_HideEvent
 func callbackQPrintPreviewWidget_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -6100,7 +6135,7 @@ func (ptr *QPrintPreviewWidget) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_InputMethodEvent
 func callbackQPrintPreviewWidget_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -6115,7 +6150,7 @@ func (ptr *QPrintPreviewWidget) InputMethodEventDefault(event gui.QInputMethodEv
 
 //export callbackQPrintPreviewWidget_KeyPressEvent
 func callbackQPrintPreviewWidget_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -6130,7 +6165,7 @@ func (ptr *QPrintPreviewWidget) KeyPressEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_KeyReleaseEvent
 func callbackQPrintPreviewWidget_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -6145,7 +6180,7 @@ func (ptr *QPrintPreviewWidget) KeyReleaseEventDefault(event gui.QKeyEvent_ITF)
 
 //export callbackQPrintPreviewWidget_LeaveEvent
 func callbackQPrintPreviewWidget_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -6160,7 +6195,7 @@ func (ptr *QPrintPreviewWidget) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_Lower
 func callbackQPrintPreviewWidget_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).LowerDefault()
@@ -6175,7 +6210,7 @@ func (ptr *QPrintPreviewWidget) LowerDefault() {
 
 //export callbackQPrintPreviewWidget_MouseDoubleClickEvent
 func callbackQPrintPreviewWidget_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6190,7 +6225,7 @@ func (ptr *QPrintPreviewWidget) MouseDoubleClickEventDefault(event gui.QMouseEve
 
 //export callbackQPrintPreviewWidget_MouseMoveEvent
 func callbackQPrintPreviewWidget_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6205,7 +6240,7 @@ func (ptr *QPrintPreviewWidget) MouseMoveEventDefault(event gui.QMouseEvent_ITF)
 
 //export callbackQPrintPreviewWidget_MousePressEvent
 func callbackQPrintPreviewWidget_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6220,7 +6255,7 @@ func (ptr *QPrintPreviewWidget) MousePressEventDefault(event gui.QMouseEvent_ITF
 
 //export callbackQPrintPreviewWidget_MouseReleaseEvent
 func callbackQPrintPreviewWidget_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6235,7 +6270,7 @@ func (ptr *QPrintPreviewWidget) MouseReleaseEventDefault(event gui.QMouseEvent_I
 
 //export callbackQPrintPreviewWidget_MoveEvent
 func callbackQPrintPreviewWidget_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -6250,7 +6285,7 @@ func (ptr *QPrintPreviewWidget) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_PaintEvent
 func callbackQPrintPreviewWidget_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -6265,7 +6300,7 @@ func (ptr *QPrintPreviewWidget) PaintEventDefault(event gui.QPaintEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_Raise
 func callbackQPrintPreviewWidget_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).RaiseDefault()
@@ -6280,7 +6315,7 @@ func (ptr *QPrintPreviewWidget) RaiseDefault() {
 
 //export callbackQPrintPreviewWidget_Repaint
 func callbackQPrintPreviewWidget_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).RepaintDefault()
@@ -6295,7 +6330,7 @@ func (ptr *QPrintPreviewWidget) RepaintDefault() {
 
 //export callbackQPrintPreviewWidget_ResizeEvent
 func callbackQPrintPreviewWidget_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -6310,7 +6345,7 @@ func (ptr *QPrintPreviewWidget) ResizeEventDefault(event gui.QResizeEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_SetDisabled
 func callbackQPrintPreviewWidget_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -6325,7 +6360,7 @@ func (ptr *QPrintPreviewWidget) SetDisabledDefault(disable bool) {
 
 //export callbackQPrintPreviewWidget_SetEnabled
 func callbackQPrintPreviewWidget_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -6340,7 +6375,7 @@ func (ptr *QPrintPreviewWidget) SetEnabledDefault(vbo bool) {
 
 //export callbackQPrintPreviewWidget_SetFocus2
 func callbackQPrintPreviewWidget_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetFocus2Default()
@@ -6355,7 +6390,7 @@ func (ptr *QPrintPreviewWidget) SetFocus2Default() {
 
 //export callbackQPrintPreviewWidget_SetHidden
 func callbackQPrintPreviewWidget_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -6370,7 +6405,7 @@ func (ptr *QPrintPreviewWidget) SetHiddenDefault(hidden bool) {
 
 //export callbackQPrintPreviewWidget_SetStyleSheet
 func callbackQPrintPreviewWidget_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -6387,7 +6422,7 @@ func (ptr *QPrintPreviewWidget) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQPrintPreviewWidget_SetWindowModified
 func callbackQPrintPreviewWidget_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -6402,7 +6437,7 @@ func (ptr *QPrintPreviewWidget) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQPrintPreviewWidget_SetWindowTitle
 func callbackQPrintPreviewWidget_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -6419,7 +6454,7 @@ func (ptr *QPrintPreviewWidget) SetWindowTitleDefault(vqs string) {
 
 //export callbackQPrintPreviewWidget_Show
 func callbackQPrintPreviewWidget_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ShowDefault()
@@ -6434,7 +6469,7 @@ func (ptr *QPrintPreviewWidget) ShowDefault() {
 
 //export callbackQPrintPreviewWidget_ShowEvent
 func callbackQPrintPreviewWidget_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -6449,7 +6484,7 @@ func (ptr *QPrintPreviewWidget) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_ShowFullScreen
 func callbackQPrintPreviewWidget_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ShowFullScreenDefault()
@@ -6464,7 +6499,7 @@ func (ptr *QPrintPreviewWidget) ShowFullScreenDefault() {
 
 //export callbackQPrintPreviewWidget_ShowMaximized
 func callbackQPrintPreviewWidget_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ShowMaximizedDefault()
@@ -6479,7 +6514,7 @@ func (ptr *QPrintPreviewWidget) ShowMaximizedDefault() {
 
 //export callbackQPrintPreviewWidget_ShowMinimized
 func callbackQPrintPreviewWidget_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ShowMinimizedDefault()
@@ -6494,7 +6529,7 @@ func (ptr *QPrintPreviewWidget) ShowMinimizedDefault() {
 
 //export callbackQPrintPreviewWidget_ShowNormal
 func callbackQPrintPreviewWidget_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ShowNormalDefault()
@@ -6509,7 +6544,7 @@ func (ptr *QPrintPreviewWidget) ShowNormalDefault() {
 
 //export callbackQPrintPreviewWidget_TabletEvent
 func callbackQPrintPreviewWidget_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -6524,7 +6559,7 @@ func (ptr *QPrintPreviewWidget) TabletEventDefault(event gui.QTabletEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_Update
 func callbackQPrintPreviewWidget_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).UpdateDefault()
@@ -6539,7 +6574,7 @@ func (ptr *QPrintPreviewWidget) UpdateDefault() {
 
 //export callbackQPrintPreviewWidget_UpdateMicroFocus
 func callbackQPrintPreviewWidget_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).UpdateMicroFocusDefault()
@@ -6554,7 +6589,7 @@ func (ptr *QPrintPreviewWidget) UpdateMicroFocusDefault() {
 
 //export callbackQPrintPreviewWidget_WheelEvent
 func callbackQPrintPreviewWidget_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -6569,7 +6604,7 @@ func (ptr *QPrintPreviewWidget) WheelEventDefault(event gui.QWheelEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_WindowIconChanged
 func callbackQPrintPreviewWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -6577,7 +6612,7 @@ func callbackQPrintPreviewWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsa
 
 //export callbackQPrintPreviewWidget_WindowTitleChanged
 func callbackQPrintPreviewWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -6585,7 +6620,7 @@ func callbackQPrintPreviewWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.
 
 //export callbackQPrintPreviewWidget_PaintEngine
 func callbackQPrintPreviewWidget_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -6601,7 +6636,7 @@ func (ptr *QPrintPreviewWidget) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQPrintPreviewWidget_MinimumSizeHint
 func callbackQPrintPreviewWidget_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -6619,7 +6654,7 @@ func (ptr *QPrintPreviewWidget) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQPrintPreviewWidget_SizeHint
 func callbackQPrintPreviewWidget_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -6637,7 +6672,7 @@ func (ptr *QPrintPreviewWidget) SizeHintDefault() *core.QSize {
 
 //export callbackQPrintPreviewWidget_InputMethodQuery
 func callbackQPrintPreviewWidget_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -6655,7 +6690,7 @@ func (ptr *QPrintPreviewWidget) InputMethodQueryDefault(query core.Qt__InputMeth
 
 //export callbackQPrintPreviewWidget_HasHeightForWidth
 func callbackQPrintPreviewWidget_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6671,7 +6706,7 @@ func (ptr *QPrintPreviewWidget) HasHeightForWidthDefault() bool {
 
 //export callbackQPrintPreviewWidget_HeightForWidth
 func callbackQPrintPreviewWidget_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -6687,7 +6722,7 @@ func (ptr *QPrintPreviewWidget) HeightForWidthDefault(w int) int {
 
 //export callbackQPrintPreviewWidget_Metric
 func callbackQPrintPreviewWidget_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -6703,7 +6738,7 @@ func (ptr *QPrintPreviewWidget) MetricDefault(m gui.QPaintDevice__PaintDeviceMet
 
 //export callbackQPrintPreviewWidget_EventFilter
 func callbackQPrintPreviewWidget_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -6719,7 +6754,7 @@ func (ptr *QPrintPreviewWidget) EventFilterDefault(watched core.QObject_ITF, eve
 
 //export callbackQPrintPreviewWidget_ChildEvent
 func callbackQPrintPreviewWidget_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -6734,7 +6769,7 @@ func (ptr *QPrintPreviewWidget) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_ConnectNotify
 func callbackQPrintPreviewWidget_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6749,7 +6784,7 @@ func (ptr *QPrintPreviewWidget) ConnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQPrintPreviewWidget_CustomEvent
 func callbackQPrintPreviewWidget_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -6764,7 +6799,7 @@ func (ptr *QPrintPreviewWidget) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_DeleteLater
 func callbackQPrintPreviewWidget_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).DeleteLaterDefault()
@@ -6774,14 +6809,14 @@ func callbackQPrintPreviewWidget_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QPrintPreviewWidget) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QPrintPreviewWidget_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPrintPreviewWidget_Destroyed
 func callbackQPrintPreviewWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -6789,7 +6824,7 @@ func callbackQPrintPreviewWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointe
 
 //export callbackQPrintPreviewWidget_DisconnectNotify
 func callbackQPrintPreviewWidget_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6804,7 +6839,7 @@ func (ptr *QPrintPreviewWidget) DisconnectNotifyDefault(sign core.QMetaMethod_IT
 
 //export callbackQPrintPreviewWidget_ObjectNameChanged
 func callbackQPrintPreviewWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtPrintSupport_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -6812,7 +6847,7 @@ func callbackQPrintPreviewWidget_ObjectNameChanged(ptr unsafe.Pointer, objectNam
 
 //export callbackQPrintPreviewWidget_TimerEvent
 func callbackQPrintPreviewWidget_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQPrintPreviewWidgetFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -6827,7 +6862,7 @@ func (ptr *QPrintPreviewWidget) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQPrintPreviewWidget_MetaObject
 func callbackQPrintPreviewWidget_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -7148,7 +7183,7 @@ func (ptr *QPrinter) Abort() bool {
 
 //export callbackQPrinter_NewPage
 func callbackQPrinter_NewPage(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "newPage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "newPage"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -7158,14 +7193,14 @@ func callbackQPrinter_NewPage(ptr unsafe.Pointer) C.char {
 func (ptr *QPrinter) ConnectNewPage(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "newPage", f)
+		qt.ConnectSignal(ptr.Pointer(), "newPage", f)
 	}
 }
 
 func (ptr *QPrinter) DisconnectNewPage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "newPage")
+		qt.DisconnectSignal(ptr.Pointer(), "newPage")
 	}
 }
 
@@ -7312,7 +7347,7 @@ func (ptr *QPrinter) SetResolution(dpi int) {
 func (ptr *QPrinter) DestroyQPrinter() {
 	if ptr.Pointer() != nil {
 		C.QPrinter_DestroyQPrinter(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7370,8 +7405,10 @@ func (ptr *QPrinter) SupportedResolutions() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtPrintSupport_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQPrinterFromPointer(l.data).__supportedResolutions_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQPrinterFromPointer(l.data).__supportedResolutions_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QPrinter_SupportedResolutions(ptr.Pointer()))
@@ -7381,7 +7418,7 @@ func (ptr *QPrinter) SupportedResolutions() []int {
 
 //export callbackQPrinter_PaintEngine
 func callbackQPrinter_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -7391,14 +7428,14 @@ func callbackQPrinter_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QPrinter) ConnectPaintEngine(f func() *gui.QPaintEngine) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paintEngine", f)
+		qt.ConnectSignal(ptr.Pointer(), "paintEngine", f)
 	}
 }
 
 func (ptr *QPrinter) DisconnectPaintEngine() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paintEngine")
+		qt.DisconnectSignal(ptr.Pointer(), "paintEngine")
 	}
 }
 
@@ -7563,9 +7600,19 @@ func (ptr *QPrinter) __supportedResolutions_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QPrinter___supportedResolutions_newList(ptr.Pointer()))
 }
 
+func (ptr *QPrinter) __supportedResolutions_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPrinter___supportedResolutions_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPrinter) __supportedResolutions_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPrinter___supportedResolutions_fillList(ptr.Pointer(), data)
+	}
+}
+
 //export callbackQPrinter_SetPageSize2
 func callbackQPrinter_SetPageSize2(ptr unsafe.Pointer, size C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPageSize2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPageSize2"); signal != nil {
 		signal.(func(gui.QPagedPaintDevice__PageSize))(gui.QPagedPaintDevice__PageSize(size))
 	} else {
 		NewQPrinterFromPointer(ptr).SetPageSize2Default(gui.QPagedPaintDevice__PageSize(size))
@@ -7580,7 +7627,7 @@ func (ptr *QPrinter) SetPageSize2Default(size gui.QPagedPaintDevice__PageSize) {
 
 //export callbackQPrinter_SetPageSizeMM
 func callbackQPrinter_SetPageSizeMM(ptr unsafe.Pointer, size unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPageSizeMM"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPageSizeMM"); signal != nil {
 		signal.(func(*core.QSizeF))(core.NewQSizeFFromPointer(size))
 	} else {
 		NewQPrinterFromPointer(ptr).SetPageSizeMMDefault(core.NewQSizeFFromPointer(size))
@@ -7595,7 +7642,7 @@ func (ptr *QPrinter) SetPageSizeMMDefault(size core.QSizeF_ITF) {
 
 //export callbackQPrinter_Metric
 func callbackQPrinter_Metric(ptr unsafe.Pointer, metric C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(metric))))
 	}
 
@@ -7721,11 +7768,11 @@ func (ptr *QPrinterInfo) DefaultPrinterName() string {
 }
 
 func QPrinterInfo_AvailablePrinterNames() []string {
-	return strings.Split(cGoUnpackString(C.QPrinterInfo_QPrinterInfo_AvailablePrinterNames()), "|")
+	return cGoUnpackStringListAndFree(C.QPrinterInfo_QPrinterInfo_AvailablePrinterNames())
 }
 
 func (ptr *QPrinterInfo) AvailablePrinterNames() []string {
-	return strings.Split(cGoUnpackString(C.QPrinterInfo_QPrinterInfo_AvailablePrinterNames()), "|")
+	return cGoUnpackStringListAndFree(C.QPrinterInfo_QPrinterInfo_AvailablePrinterNames())
 }
 
 func (ptr *QPrinterInfo) DestroyQPrinterInfo() {
@@ -7765,8 +7812,10 @@ func (ptr *QPrinterInfo) SupportedResolutions() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtPrintSupport_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQPrinterInfoFromPointer(l.data).__supportedResolutions_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQPrinterInfoFromPointer(l.data).__supportedResolutions_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QPrinterInfo_SupportedResolutions(ptr.Pointer()))
@@ -7959,3 +8008,13 @@ func (ptr *QPrinterInfo) __supportedResolutions_setList(i int) {
 func (ptr *QPrinterInfo) __supportedResolutions_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QPrinterInfo___supportedResolutions_newList(ptr.Pointer()))
 }
+
+func (ptr *QPrinterInfo) __supportedResolutions_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QPrinterInfo___supportedResolutions_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QPrinterInfo) __supportedResolutions_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QPrinterInfo___supportedResolutions_fillList(ptr.Pointer(), data)
+	}
+}
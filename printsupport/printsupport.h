@@ -535,6 +535,8 @@ int QPrinter_ToPage(void* ptr);
 int QPrinter___supportedResolutions_atList(void* ptr, int i);
 void QPrinter___supportedResolutions_setList(void* ptr, int i);
 void* QPrinter___supportedResolutions_newList(void* ptr);
+void* QPrinter___supportedResolutions_newListBuffer(void* ptr, void* data, int count);
+void QPrinter___supportedResolutions_fillList(void* ptr, void* data);
 void QPrinter_SetPageSize2Default(void* ptr, long long size);
 void QPrinter_SetPageSizeMMDefault(void* ptr, void* size);
 int QPrinter_MetricDefault(void* ptr, long long metric);
@@ -578,6 +580,8 @@ void* QPrinterInfo___supportedPaperSizes_newList(void* ptr);
 int QPrinterInfo___supportedResolutions_atList(void* ptr, int i);
 void QPrinterInfo___supportedResolutions_setList(void* ptr, int i);
 void* QPrinterInfo___supportedResolutions_newList(void* ptr);
+void* QPrinterInfo___supportedResolutions_newListBuffer(void* ptr, void* data, int count);
+void QPrinterInfo___supportedResolutions_fillList(void* ptr, void* data);
 
 #ifdef __cplusplus
 }
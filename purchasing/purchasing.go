@@ -8,7 +8,6 @@ package purchasing
 //#include "purchasing.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
@@ -21,6 +20,43 @@ func cGoUnpackString(s C.struct_QtPurchasing_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtPurchasing_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtPurchasing_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QInAppProduct struct {
 	core.QObject
@@ -64,7 +100,7 @@ func NewQInAppProductFromPointer(ptr unsafe.Pointer) *QInAppProduct {
 func (ptr *QInAppProduct) DestroyQInAppProduct() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -80,7 +116,7 @@ const (
 
 //export callbackQInAppProduct_Purchase
 func callbackQInAppProduct_Purchase(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "purchase"); signal != nil {
+	if signal := qt.GetSignal(ptr, "purchase"); signal != nil {
 		signal.(func())()
 	}
 
@@ -89,14 +125,14 @@ func callbackQInAppProduct_Purchase(ptr unsafe.Pointer) {
 func (ptr *QInAppProduct) ConnectPurchase(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "purchase", f)
+		qt.ConnectSignal(ptr.Pointer(), "purchase", f)
 	}
 }
 
 func (ptr *QInAppProduct) DisconnectPurchase() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "purchase")
+		qt.DisconnectSignal(ptr.Pointer(), "purchase")
 	}
 }
 
@@ -163,7 +199,7 @@ func (ptr *QInAppProduct) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QInAppProduct) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppProduct___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -184,7 +220,7 @@ func (ptr *QInAppProduct) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QInAppProduct) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppProduct___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -205,7 +241,7 @@ func (ptr *QInAppProduct) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QInAppProduct) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppProduct___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -226,7 +262,7 @@ func (ptr *QInAppProduct) __findChildren_newList() unsafe.Pointer {
 func (ptr *QInAppProduct) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppProduct___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -246,7 +282,7 @@ func (ptr *QInAppProduct) __children_newList() unsafe.Pointer {
 
 //export callbackQInAppProduct_Event
 func callbackQInAppProduct_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -262,7 +298,7 @@ func (ptr *QInAppProduct) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQInAppProduct_EventFilter
 func callbackQInAppProduct_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -278,7 +314,7 @@ func (ptr *QInAppProduct) EventFilterDefault(watched core.QObject_ITF, event cor
 
 //export callbackQInAppProduct_ChildEvent
 func callbackQInAppProduct_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQInAppProductFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -293,7 +329,7 @@ func (ptr *QInAppProduct) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQInAppProduct_ConnectNotify
 func callbackQInAppProduct_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQInAppProductFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -308,7 +344,7 @@ func (ptr *QInAppProduct) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQInAppProduct_CustomEvent
 func callbackQInAppProduct_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQInAppProductFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -323,7 +359,7 @@ func (ptr *QInAppProduct) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQInAppProduct_DeleteLater
 func callbackQInAppProduct_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQInAppProductFromPointer(ptr).DeleteLaterDefault()
@@ -333,14 +369,14 @@ func callbackQInAppProduct_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QInAppProduct) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QInAppProduct_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQInAppProduct_Destroyed
 func callbackQInAppProduct_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -348,7 +384,7 @@ func callbackQInAppProduct_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQInAppProduct_DisconnectNotify
 func callbackQInAppProduct_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQInAppProductFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -363,7 +399,7 @@ func (ptr *QInAppProduct) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQInAppProduct_ObjectNameChanged
 func callbackQInAppProduct_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtPurchasing_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -371,7 +407,7 @@ func callbackQInAppProduct_ObjectNameChanged(ptr unsafe.Pointer, objectName C.st
 
 //export callbackQInAppProduct_TimerEvent
 func callbackQInAppProduct_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQInAppProductFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -386,7 +422,7 @@ func (ptr *QInAppProduct) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQInAppProduct_MetaObject
 func callbackQInAppProduct_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -440,7 +476,7 @@ func NewQInAppStoreFromPointer(ptr unsafe.Pointer) *QInAppStore {
 }
 func NewQInAppStore(parent core.QObject_ITF) *QInAppStore {
 	var tmpValue = NewQInAppStoreFromPointer(C.QInAppStore_NewQInAppStore(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -448,7 +484,7 @@ func NewQInAppStore(parent core.QObject_ITF) *QInAppStore {
 
 //export callbackQInAppStore_ProductRegistered
 func callbackQInAppStore_ProductRegistered(ptr unsafe.Pointer, product unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "productRegistered"); signal != nil {
+	if signal := qt.GetSignal(ptr, "productRegistered"); signal != nil {
 		signal.(func(*QInAppProduct))(NewQInAppProductFromPointer(product))
 	}
 
@@ -457,14 +493,14 @@ func callbackQInAppStore_ProductRegistered(ptr unsafe.Pointer, product unsafe.Po
 func (ptr *QInAppStore) ConnectProductRegistered(f func(product *QInAppProduct)) {
 	if ptr.Pointer() != nil {
 		C.QInAppStore_ConnectProductRegistered(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "productRegistered", f)
+		qt.ConnectSignal(ptr.Pointer(), "productRegistered", f)
 	}
 }
 
 func (ptr *QInAppStore) DisconnectProductRegistered() {
 	if ptr.Pointer() != nil {
 		C.QInAppStore_DisconnectProductRegistered(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "productRegistered")
+		qt.DisconnectSignal(ptr.Pointer(), "productRegistered")
 	}
 }
 
@@ -476,7 +512,7 @@ func (ptr *QInAppStore) ProductRegistered(product QInAppProduct_ITF) {
 
 //export callbackQInAppStore_ProductUnknown
 func callbackQInAppStore_ProductUnknown(ptr unsafe.Pointer, productType C.longlong, identifier C.struct_QtPurchasing_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "productUnknown"); signal != nil {
+	if signal := qt.GetSignal(ptr, "productUnknown"); signal != nil {
 		signal.(func(QInAppProduct__ProductType, string))(QInAppProduct__ProductType(productType), cGoUnpackString(identifier))
 	}
 
@@ -485,14 +521,14 @@ func callbackQInAppStore_ProductUnknown(ptr unsafe.Pointer, productType C.longlo
 func (ptr *QInAppStore) ConnectProductUnknown(f func(productType QInAppProduct__ProductType, identifier string)) {
 	if ptr.Pointer() != nil {
 		C.QInAppStore_ConnectProductUnknown(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "productUnknown", f)
+		qt.ConnectSignal(ptr.Pointer(), "productUnknown", f)
 	}
 }
 
 func (ptr *QInAppStore) DisconnectProductUnknown() {
 	if ptr.Pointer() != nil {
 		C.QInAppStore_DisconnectProductUnknown(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "productUnknown")
+		qt.DisconnectSignal(ptr.Pointer(), "productUnknown")
 	}
 }
 
@@ -530,7 +566,7 @@ func (ptr *QInAppStore) SetPlatformProperty(propertyName string, value string) {
 
 //export callbackQInAppStore_TransactionReady
 func callbackQInAppStore_TransactionReady(ptr unsafe.Pointer, transaction unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "transactionReady"); signal != nil {
+	if signal := qt.GetSignal(ptr, "transactionReady"); signal != nil {
 		signal.(func(*QInAppTransaction))(NewQInAppTransactionFromPointer(transaction))
 	}
 
@@ -539,14 +575,14 @@ func callbackQInAppStore_TransactionReady(ptr unsafe.Pointer, transaction unsafe
 func (ptr *QInAppStore) ConnectTransactionReady(f func(transaction *QInAppTransaction)) {
 	if ptr.Pointer() != nil {
 		C.QInAppStore_ConnectTransactionReady(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "transactionReady", f)
+		qt.ConnectSignal(ptr.Pointer(), "transactionReady", f)
 	}
 }
 
 func (ptr *QInAppStore) DisconnectTransactionReady() {
 	if ptr.Pointer() != nil {
 		C.QInAppStore_DisconnectTransactionReady(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "transactionReady")
+		qt.DisconnectSignal(ptr.Pointer(), "transactionReady")
 	}
 }
 
@@ -559,7 +595,7 @@ func (ptr *QInAppStore) TransactionReady(transaction QInAppTransaction_ITF) {
 func (ptr *QInAppStore) DestroyQInAppStore() {
 	if ptr.Pointer() != nil {
 		C.QInAppStore_DestroyQInAppStore(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -569,7 +605,7 @@ func (ptr *QInAppStore) RegisteredProduct(identifier string) *QInAppProduct {
 		var identifierC = C.CString(identifier)
 		defer C.free(unsafe.Pointer(identifierC))
 		var tmpValue = NewQInAppProductFromPointer(C.QInAppStore_RegisteredProduct(ptr.Pointer(), identifierC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -599,7 +635,7 @@ func (ptr *QInAppStore) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QInAppStore) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppStore___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -620,7 +656,7 @@ func (ptr *QInAppStore) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QInAppStore) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppStore___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -641,7 +677,7 @@ func (ptr *QInAppStore) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QInAppStore) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppStore___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -662,7 +698,7 @@ func (ptr *QInAppStore) __findChildren_newList() unsafe.Pointer {
 func (ptr *QInAppStore) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppStore___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -682,7 +718,7 @@ func (ptr *QInAppStore) __children_newList() unsafe.Pointer {
 
 //export callbackQInAppStore_Event
 func callbackQInAppStore_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -698,7 +734,7 @@ func (ptr *QInAppStore) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQInAppStore_EventFilter
 func callbackQInAppStore_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -714,7 +750,7 @@ func (ptr *QInAppStore) EventFilterDefault(watched core.QObject_ITF, event core.
 
 //export callbackQInAppStore_ChildEvent
 func callbackQInAppStore_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQInAppStoreFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -729,7 +765,7 @@ func (ptr *QInAppStore) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQInAppStore_ConnectNotify
 func callbackQInAppStore_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQInAppStoreFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -744,7 +780,7 @@ func (ptr *QInAppStore) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQInAppStore_CustomEvent
 func callbackQInAppStore_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQInAppStoreFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -759,7 +795,7 @@ func (ptr *QInAppStore) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQInAppStore_DeleteLater
 func callbackQInAppStore_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQInAppStoreFromPointer(ptr).DeleteLaterDefault()
@@ -769,14 +805,14 @@ func callbackQInAppStore_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QInAppStore) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QInAppStore_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQInAppStore_Destroyed
 func callbackQInAppStore_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -784,7 +820,7 @@ func callbackQInAppStore_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQInAppStore_DisconnectNotify
 func callbackQInAppStore_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQInAppStoreFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -799,7 +835,7 @@ func (ptr *QInAppStore) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQInAppStore_ObjectNameChanged
 func callbackQInAppStore_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtPurchasing_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -807,7 +843,7 @@ func callbackQInAppStore_ObjectNameChanged(ptr unsafe.Pointer, objectName C.stru
 
 //export callbackQInAppStore_TimerEvent
 func callbackQInAppStore_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQInAppStoreFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -822,7 +858,7 @@ func (ptr *QInAppStore) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQInAppStore_MetaObject
 func callbackQInAppStore_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -878,7 +914,7 @@ func NewQInAppTransactionFromPointer(ptr unsafe.Pointer) *QInAppTransaction {
 func (ptr *QInAppTransaction) DestroyQInAppTransaction() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -906,7 +942,7 @@ const (
 
 //export callbackQInAppTransaction_ErrorString
 func callbackQInAppTransaction_ErrorString(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorString"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -916,14 +952,14 @@ func callbackQInAppTransaction_ErrorString(ptr unsafe.Pointer) *C.char {
 func (ptr *QInAppTransaction) ConnectErrorString(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorString", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorString", f)
 	}
 }
 
 func (ptr *QInAppTransaction) DisconnectErrorString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorString")
+		qt.DisconnectSignal(ptr.Pointer(), "errorString")
 	}
 }
 
@@ -943,7 +979,7 @@ func (ptr *QInAppTransaction) ErrorStringDefault() string {
 
 //export callbackQInAppTransaction_OrderId
 func callbackQInAppTransaction_OrderId(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "orderId"); signal != nil {
+	if signal := qt.GetSignal(ptr, "orderId"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -953,14 +989,14 @@ func callbackQInAppTransaction_OrderId(ptr unsafe.Pointer) *C.char {
 func (ptr *QInAppTransaction) ConnectOrderId(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "orderId", f)
+		qt.ConnectSignal(ptr.Pointer(), "orderId", f)
 	}
 }
 
 func (ptr *QInAppTransaction) DisconnectOrderId() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "orderId")
+		qt.DisconnectSignal(ptr.Pointer(), "orderId")
 	}
 }
 
@@ -980,7 +1016,7 @@ func (ptr *QInAppTransaction) OrderIdDefault() string {
 
 //export callbackQInAppTransaction_Finalize
 func callbackQInAppTransaction_Finalize(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finalize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finalize"); signal != nil {
 		signal.(func())()
 	}
 
@@ -989,14 +1025,14 @@ func callbackQInAppTransaction_Finalize(ptr unsafe.Pointer) {
 func (ptr *QInAppTransaction) ConnectFinalize(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finalize", f)
+		qt.ConnectSignal(ptr.Pointer(), "finalize", f)
 	}
 }
 
 func (ptr *QInAppTransaction) DisconnectFinalize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finalize")
+		qt.DisconnectSignal(ptr.Pointer(), "finalize")
 	}
 }
 
@@ -1008,7 +1044,7 @@ func (ptr *QInAppTransaction) Finalize() {
 
 //export callbackQInAppTransaction_FailureReason
 func callbackQInAppTransaction_FailureReason(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "failureReason"); signal != nil {
+	if signal := qt.GetSignal(ptr, "failureReason"); signal != nil {
 		return C.longlong(signal.(func() QInAppTransaction__FailureReason)())
 	}
 
@@ -1018,14 +1054,14 @@ func callbackQInAppTransaction_FailureReason(ptr unsafe.Pointer) C.longlong {
 func (ptr *QInAppTransaction) ConnectFailureReason(f func() QInAppTransaction__FailureReason) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "failureReason", f)
+		qt.ConnectSignal(ptr.Pointer(), "failureReason", f)
 	}
 }
 
 func (ptr *QInAppTransaction) DisconnectFailureReason() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "failureReason")
+		qt.DisconnectSignal(ptr.Pointer(), "failureReason")
 	}
 }
 
@@ -1045,7 +1081,7 @@ func (ptr *QInAppTransaction) FailureReasonDefault() QInAppTransaction__FailureR
 
 //export callbackQInAppTransaction_Timestamp
 func callbackQInAppTransaction_Timestamp(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timestamp"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timestamp"); signal != nil {
 		return core.PointerFromQDateTime(signal.(func() *core.QDateTime)())
 	}
 
@@ -1055,14 +1091,14 @@ func callbackQInAppTransaction_Timestamp(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QInAppTransaction) ConnectTimestamp(f func() *core.QDateTime) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "timestamp", f)
+		qt.ConnectSignal(ptr.Pointer(), "timestamp", f)
 	}
 }
 
 func (ptr *QInAppTransaction) DisconnectTimestamp() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "timestamp")
+		qt.DisconnectSignal(ptr.Pointer(), "timestamp")
 	}
 }
 
@@ -1087,7 +1123,7 @@ func (ptr *QInAppTransaction) TimestampDefault() *core.QDateTime {
 func (ptr *QInAppTransaction) Product() *QInAppProduct {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQInAppProductFromPointer(C.QInAppTransaction_Product(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1097,7 +1133,7 @@ func (ptr *QInAppTransaction) Product() *QInAppProduct {
 
 //export callbackQInAppTransaction_PlatformProperty
 func callbackQInAppTransaction_PlatformProperty(ptr unsafe.Pointer, propertyName C.struct_QtPurchasing_PackedString) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "platformProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "platformProperty"); signal != nil {
 		return C.CString(signal.(func(string) string)(cGoUnpackString(propertyName)))
 	}
 
@@ -1107,14 +1143,14 @@ func callbackQInAppTransaction_PlatformProperty(ptr unsafe.Pointer, propertyName
 func (ptr *QInAppTransaction) ConnectPlatformProperty(f func(propertyName string) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "platformProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "platformProperty", f)
 	}
 }
 
 func (ptr *QInAppTransaction) DisconnectPlatformProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "platformProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "platformProperty")
 	}
 }
 
@@ -1165,7 +1201,7 @@ func (ptr *QInAppTransaction) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QInAppTransaction) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppTransaction___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1186,7 +1222,7 @@ func (ptr *QInAppTransaction) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QInAppTransaction) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppTransaction___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1207,7 +1243,7 @@ func (ptr *QInAppTransaction) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QInAppTransaction) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppTransaction___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1228,7 +1264,7 @@ func (ptr *QInAppTransaction) __findChildren_newList() unsafe.Pointer {
 func (ptr *QInAppTransaction) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QInAppTransaction___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1248,7 +1284,7 @@ func (ptr *QInAppTransaction) __children_newList() unsafe.Pointer {
 
 //export callbackQInAppTransaction_Event
 func callbackQInAppTransaction_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -1264,7 +1300,7 @@ func (ptr *QInAppTransaction) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQInAppTransaction_EventFilter
 func callbackQInAppTransaction_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -1280,7 +1316,7 @@ func (ptr *QInAppTransaction) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQInAppTransaction_ChildEvent
 func callbackQInAppTransaction_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQInAppTransactionFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -1295,7 +1331,7 @@ func (ptr *QInAppTransaction) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQInAppTransaction_ConnectNotify
 func callbackQInAppTransaction_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQInAppTransactionFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1310,7 +1346,7 @@ func (ptr *QInAppTransaction) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQInAppTransaction_CustomEvent
 func callbackQInAppTransaction_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQInAppTransactionFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -1325,7 +1361,7 @@ func (ptr *QInAppTransaction) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQInAppTransaction_DeleteLater
 func callbackQInAppTransaction_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQInAppTransactionFromPointer(ptr).DeleteLaterDefault()
@@ -1335,14 +1371,14 @@ func callbackQInAppTransaction_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QInAppTransaction) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QInAppTransaction_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQInAppTransaction_Destroyed
 func callbackQInAppTransaction_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -1350,7 +1386,7 @@ func callbackQInAppTransaction_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQInAppTransaction_DisconnectNotify
 func callbackQInAppTransaction_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQInAppTransactionFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1365,7 +1401,7 @@ func (ptr *QInAppTransaction) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQInAppTransaction_ObjectNameChanged
 func callbackQInAppTransaction_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtPurchasing_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -1373,7 +1409,7 @@ func callbackQInAppTransaction_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQInAppTransaction_TimerEvent
 func callbackQInAppTransaction_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQInAppTransactionFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -1388,7 +1424,7 @@ func (ptr *QInAppTransaction) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQInAppTransaction_MetaObject
 func callbackQInAppTransaction_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -47,6 +47,75 @@
 #include <QTimerEvent>
 #include <QUrl>
 #include <QVariant>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 class MyQJSEngine: public QJSEngine
 {
@@ -1392,7 +1461,7 @@ void QQmlEngine_QQmlEngine_SetContextForObject(void* object, void* context)
 
 void QQmlEngine_SetImportPathList(void* ptr, char* paths)
 {
-	static_cast<QQmlEngine*>(ptr)->setImportPathList(QString(paths).split("|", QString::SkipEmptyParts));
+	static_cast<QQmlEngine*>(ptr)->setImportPathList(goUnpackStringList(paths));
 }
 
 void QQmlEngine_SetIncubationController(void* ptr, void* controller)
@@ -1422,7 +1491,7 @@ void QQmlEngine_SetOutputWarningsToStandardError(void* ptr, char enabled)
 
 void QQmlEngine_SetPluginPathList(void* ptr, char* paths)
 {
-	static_cast<QQmlEngine*>(ptr)->setPluginPathList(QString(paths).split("|", QString::SkipEmptyParts));
+	static_cast<QQmlEngine*>(ptr)->setPluginPathList(goUnpackStringList(paths));
 }
 
 void QQmlEngine_TrimComponentCache(void* ptr)
@@ -1487,12 +1556,12 @@ struct QtQml_PackedString QQmlEngine_OfflineStoragePath(void* ptr)
 
 struct QtQml_PackedString QQmlEngine_ImportPathList(void* ptr)
 {
-	return ({ QByteArray t32e5da = static_cast<QQmlEngine*>(ptr)->importPathList().join("|").toUtf8(); QtQml_PackedString { const_cast<char*>(t32e5da.prepend("WHITESPACE").constData()+10), t32e5da.size()-10 }; });
+	return ({ long long t32e5dalen; char* t32e5da = goPackStringList(static_cast<QQmlEngine*>(ptr)->importPathList(), &t32e5dalen); QtQml_PackedString { t32e5da, t32e5dalen }; });
 }
 
 struct QtQml_PackedString QQmlEngine_PluginPathList(void* ptr)
 {
-	return ({ QByteArray t04b834 = static_cast<QQmlEngine*>(ptr)->pluginPathList().join("|").toUtf8(); QtQml_PackedString { const_cast<char*>(t04b834.prepend("WHITESPACE").constData()+10), t04b834.size()-10 }; });
+	return ({ long long t04b834len; char* t04b834 = goPackStringList(static_cast<QQmlEngine*>(ptr)->pluginPathList(), &t04b834len); QtQml_PackedString { t04b834, t04b834len }; });
 }
 
 void* QQmlEngine_BaseUrl(void* ptr)
@@ -2059,12 +2128,12 @@ void* QQmlFileSelector_NewQQmlFileSelector(void* engine, void* parent)
 
 void QQmlFileSelector_SetExtraSelectors(void* ptr, char* strin)
 {
-	static_cast<QQmlFileSelector*>(ptr)->setExtraSelectors(*(new QStringList(QString(strin).split("|", QString::SkipEmptyParts))));
+	static_cast<QQmlFileSelector*>(ptr)->setExtraSelectors(*(new QStringList(goUnpackStringList(strin))));
 }
 
 void QQmlFileSelector_SetExtraSelectors2(void* ptr, char* strin)
 {
-	static_cast<QQmlFileSelector*>(ptr)->setExtraSelectors(QString(strin).split("|", QString::SkipEmptyParts));
+	static_cast<QQmlFileSelector*>(ptr)->setExtraSelectors(goUnpackStringList(strin));
 }
 
 void QQmlFileSelector_SetSelector(void* ptr, void* selector)
@@ -2721,7 +2790,7 @@ void QQmlPropertyMap_DestroyQQmlPropertyMapDefault(void* ptr)
 
 struct QtQml_PackedString QQmlPropertyMap_Keys(void* ptr)
 {
-	return ({ QByteArray t4c814d = static_cast<QQmlPropertyMap*>(ptr)->keys().join("|").toUtf8(); QtQml_PackedString { const_cast<char*>(t4c814d.prepend("WHITESPACE").constData()+10), t4c814d.size()-10 }; });
+	return ({ long long t4c814dlen; char* t4c814d = goPackStringList(static_cast<QQmlPropertyMap*>(ptr)->keys(), &t4c814dlen); QtQml_PackedString { t4c814d, t4c814dlen }; });
 }
 
 void* QQmlPropertyMap_Value(void* ptr, char* key)
@@ -7,6 +7,8 @@ import (
 	"runtime"
 	"strings"
 	"sync"
+	"sync/atomic"
+	"unsafe"
 
 	_ "github.com/therecipe/qt/internal/android/cgo"
 )
@@ -14,52 +16,104 @@ import (
 var (
 	Logger = log.New(os.Stderr, "", log.Ltime)
 
-	signals      = make(map[string]interface{})
-	signalsMutex = new(sync.Mutex)
+	signals [signalShards]signalShard
 
 	ids int
 )
 
-func init() { runtime.LockOSThread() }
+//the signal table is keyed by the c++ object pointer and the signal name
+//emitted by the templater as a string constant, so lookups from the
+//callback hot path neither format nor allocate
+type signalKey struct {
+	ptr    unsafe.Pointer
+	signal string
+}
 
-func ExistsSignal(name, signal string) bool {
-	signalsMutex.Lock()
-	var _, exists = signals[fmt.Sprintf("%v:%v", name, signal)]
-	signalsMutex.Unlock()
-	return exists
+//the table is split into shards by object pointer, so callbacks coming in
+//for different objects don't contend on a single lock
+const signalShards = 64
+
+type signalShard struct {
+	sync.RWMutex
+	m map[signalKey]interface{}
+
+	//connected signal names per object, so teardown doesn't scan the shard
+	objects map[unsafe.Pointer][]string
 }
 
-func GetSignal(name, signal string) interface{} {
-	if strings.HasSuffix(signal, ":destroyed") || strings.HasSuffix(signal, ":deleteLater") || strings.Contains(signal, ":~") {
-		defer DisconnectAllSignals(name)
+func init() {
+	runtime.LockOSThread()
+
+	for i := range signals {
+		signals[i].m = make(map[signalKey]interface{})
+		signals[i].objects = make(map[unsafe.Pointer][]string)
 	}
-	var s interface{}
-	signalsMutex.Lock()
-	s = signals[fmt.Sprintf("%v:%v", name, signal)]
-	signalsMutex.Unlock()
-	return s
 }
 
-func ConnectSignal(name, signal string, function interface{}) {
-	signalsMutex.Lock()
-	signals[fmt.Sprintf("%v:%v", name, signal)] = function
-	signalsMutex.Unlock()
+func shard(ptr unsafe.Pointer) *signalShard {
+	//c++ allocations are at least 8 byte aligned, drop the low bits
+	var p = uintptr(ptr) >> 3
+	return &signals[(p^p>>7^p>>17)%signalShards]
 }
 
-func DisconnectSignal(name, signal string) {
-	signalsMutex.Lock()
-	delete(signals, fmt.Sprintf("%v:%v", name, signal))
-	signalsMutex.Unlock()
+func ExistsSignal(ptr unsafe.Pointer, signal string) bool {
+	var s = shard(ptr)
+	s.RLock()
+	var _, exists = s.m[signalKey{ptr, signal}]
+	s.RUnlock()
+	return exists
+}
+
+func GetSignal(ptr unsafe.Pointer, signal string) interface{} {
+	var s = shard(ptr)
+	s.RLock()
+	var f = s.m[signalKey{ptr, signal}]
+	s.RUnlock()
+	return f
+}
+
+func ConnectSignal(ptr unsafe.Pointer, signal string, function interface{}) {
+	var s = shard(ptr)
+	var key = signalKey{ptr, signal}
+	s.Lock()
+	if _, exists := s.m[key]; !exists {
+		s.objects[ptr] = append(s.objects[ptr], signal)
+	}
+	s.m[key] = function
+	s.Unlock()
 }
 
-func DisconnectAllSignals(name string) {
-	for entry := range signals {
-		if strings.HasPrefix(entry, fmt.Sprintf("%v:", name)) {
-			signalsMutex.Lock()
-			delete(signals, entry)
-			signalsMutex.Unlock()
+func DisconnectSignal(ptr unsafe.Pointer, signal string) {
+	var s = shard(ptr)
+	var key = signalKey{ptr, signal}
+	s.Lock()
+	if _, exists := s.m[key]; exists {
+		delete(s.m, key)
+		var names = s.objects[ptr]
+		for i, name := range names {
+			if name == signal {
+				names[i] = names[len(names)-1]
+				names = names[:len(names)-1]
+				break
+			}
 		}
+		if len(names) == 0 {
+			delete(s.objects, ptr)
+		} else {
+			s.objects[ptr] = names
+		}
+	}
+	s.Unlock()
+}
+
+func DisconnectAllSignals(ptr unsafe.Pointer) {
+	var s = shard(ptr)
+	s.Lock()
+	for _, signal := range s.objects[ptr] {
+		delete(s.m, signalKey{ptr, signal})
 	}
+	delete(s.objects, ptr)
+	s.Unlock()
 }
 
 func Identifier() string {
@@ -69,8 +123,12 @@ func Identifier() string {
 
 func DumpSignals() {
 	Debug("##############################\tSIGNALSTABLE_START\t##############################")
-	for entry := range signals {
-		Debug(entry)
+	for i := range signals {
+		signals[i].RLock()
+		for entry := range signals[i].m {
+			Debug(fmt.Sprintf("%v:%v", entry.ptr, entry.signal))
+		}
+		signals[i].RUnlock()
 	}
 	Debug("##############################\tSIGNALSTABLE_END\t##############################")
 }
@@ -82,6 +140,105 @@ func GoBoolToInt(b bool) int {
 	return 0
 }
 
+//UnsafeBytes returns a slice backed by the n bytes at ptr without copying them,
+//the memory has to be owned by C/C++ and stay valid while the slice is in use
+func UnsafeBytes(ptr unsafe.Pointer, n int) []byte {
+	if ptr == nil || n <= 0 {
+		return nil
+	}
+	return (*[1 << 30]byte)(ptr)[:n:n]
+}
+
+//functions queued for the qt thread, producers push onto a lock free stack
+//and the qt thread takes the whole stack at once, so posting never blocks
+//and only the push onto an empty queue has to wake up the event loop
+type mainTask struct {
+	next *mainTask
+	f    func()
+}
+
+var (
+	mainQueue   unsafe.Pointer
+	mainPending *mainTask //taken from the queue but not run yet because one of them panicked, only used on the qt thread
+
+	mainWakeup       func()
+	mainIsMainThread func() bool
+)
+
+//SetMainDispatcher is called by core to hook RunOnMain into the Qt event loop,
+//wakeup has to make the qt thread call RunMainQueue soon
+func SetMainDispatcher(wakeup func(), isMainThread func() bool) {
+	mainWakeup, mainIsMainThread = wakeup, isMainThread
+}
+
+//RunOnMain queues f to run on the qt thread and returns immediately,
+//queued functions run in order and all functions queued until the qt thread gets to them run in one go
+func RunOnMain(f func()) {
+	var t = &mainTask{f: f}
+	for {
+		var head = atomic.LoadPointer(&mainQueue)
+		t.next = (*mainTask)(head)
+		if atomic.CompareAndSwapPointer(&mainQueue, head, unsafe.Pointer(t)) {
+			if head == nil && mainWakeup != nil {
+				mainWakeup()
+			}
+			return
+		}
+	}
+}
+
+//RunOnMainSync runs f on the qt thread and waits for it to return,
+//called on the qt thread itself it runs f directly.
+//Before the application exists f waits for its event loop to start,
+//so it must not be called by the goroutine that is about to create the application
+func RunOnMainSync(f func()) {
+	if mainIsMainThread != nil && mainIsMainThread() {
+		f()
+		return
+	}
+	var done = make(chan struct{})
+	RunOnMain(func() {
+		defer close(done)
+		f()
+	})
+	<-done
+}
+
+//RunMainQueue runs the functions queued by RunOnMain, it's called on the qt thread.
+//If one of them panics, the ones after it are kept and run by the next call
+func RunMainQueue() {
+	var t = (*mainTask)(atomic.SwapPointer(&mainQueue, nil))
+
+	//the stack holds the newest function first
+	var ordered *mainTask
+	for t != nil {
+		var next = t.next
+		t.next, ordered = ordered, t
+		t = next
+	}
+
+	if mainPending == nil {
+		mainPending = ordered
+	} else {
+		var last = mainPending
+		for last.next != nil {
+			last = last.next
+		}
+		last.next = ordered
+	}
+
+	defer func() {
+		if mainPending != nil && mainWakeup != nil {
+			mainWakeup()
+		}
+	}()
+	for mainPending != nil {
+		var f = mainPending.f
+		mainPending = mainPending.next
+		f()
+	}
+}
+
 func Recover(fn string) {
 	if recover() != nil {
 		Debug("RECOVERED:", fn)
@@ -0,0 +1,345 @@
+package qt
+
+import (
+	"fmt"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+	"unsafe"
+
+	assert "github.com/stretchr/testify/require"
+)
+
+const benchRows = 100000
+
+//fake c++ object pointers, spaced like heap allocations
+func fakePointers(n int) []unsafe.Pointer {
+	var (
+		mem = make([]byte, n*48)
+		out = make([]unsafe.Pointer, n)
+	)
+	for i := range out {
+		out[i] = unsafe.Pointer(&mem[i*48])
+	}
+	return out
+}
+
+func TestSignals(t *testing.T) {
+	var ptrs = fakePointers(2)
+	defer DisconnectAllSignals(ptrs[0])
+	defer DisconnectAllSignals(ptrs[1])
+
+	ConnectSignal(ptrs[0], "data", func() int { return 0 })
+	ConnectSignal(ptrs[0], "rowCount", func() int { return 1 })
+	ConnectSignal(ptrs[1], "data", func() int { return 2 })
+	ConnectSignal(ptrs[1], "data", func() int { return 3 })
+
+	assert.True(t, ExistsSignal(ptrs[0], "data"))
+	assert.False(t, ExistsSignal(ptrs[0], "columnCount"))
+	assert.Equal(t, 1, GetSignal(ptrs[0], "rowCount").(func() int)())
+	assert.Equal(t, 3, GetSignal(ptrs[1], "data").(func() int)())
+
+	DisconnectSignal(ptrs[0], "data")
+	assert.False(t, ExistsSignal(ptrs[0], "data"))
+	assert.True(t, ExistsSignal(ptrs[0], "rowCount"))
+
+	DisconnectAllSignals(ptrs[0])
+	assert.False(t, ExistsSignal(ptrs[0], "rowCount"))
+	assert.True(t, ExistsSignal(ptrs[1], "data"))
+	assert.Len(t, shard(ptrs[0]).objects[ptrs[0]], 0)
+
+	DisconnectSignal(ptrs[1], "data")
+	assert.Len(t, shard(ptrs[1]).objects[ptrs[1]], 0)
+}
+
+//the string keyed table used before the pointer keyed registry, kept for comparison
+var (
+	legacySignals      = make(map[string]interface{})
+	legacySignalsMutex = new(sync.Mutex)
+)
+
+func legacyGetSignal(name, signal string) interface{} {
+	if strings.HasSuffix(signal, ":destroyed") || strings.HasSuffix(signal, ":deleteLater") || strings.Contains(signal, ":~") {
+		defer legacyDisconnectAllSignals(name)
+	}
+	legacySignalsMutex.Lock()
+	var s = legacySignals[fmt.Sprintf("%v:%v", name, signal)]
+	legacySignalsMutex.Unlock()
+	return s
+}
+
+func legacyConnectSignal(name, signal string, function interface{}) {
+	legacySignalsMutex.Lock()
+	legacySignals[fmt.Sprintf("%v:%v", name, signal)] = function
+	legacySignalsMutex.Unlock()
+}
+
+func legacyDisconnectAllSignals(name string) {
+	for entry := range legacySignals {
+		if strings.HasPrefix(entry, fmt.Sprintf("%v:", name)) {
+			legacySignalsMutex.Lock()
+			delete(legacySignals, entry)
+			legacySignalsMutex.Unlock()
+		}
+	}
+}
+
+//simulates the data() callback of a 100k row model whose view also
+//has a connected delegate per row, as seen from callbackQAbstractItemModel_Data
+func BenchmarkModelDataCallback(b *testing.B) {
+	var (
+		ptrs  = fakePointers(benchRows + 1)
+		model = ptrs[benchRows]
+		data  = func(row, role int) interface{} { return row }
+	)
+
+	b.Run("legacy", func(b *testing.B) {
+		for _, p := range ptrs[:benchRows] {
+			legacyConnectSignal(fmt.Sprint(p), "paintEvent", data)
+		}
+		legacyConnectSignal(fmt.Sprint(model), "data", data)
+		b.ResetTimer()
+
+		for i := 0; i < b.N; i++ {
+			if signal := legacyGetSignal(fmt.Sprint(model), "data"); signal != nil {
+				signal.(func(int, int) interface{})(i%benchRows, 0)
+			}
+		}
+		b.StopTimer()
+		legacySignals = make(map[string]interface{})
+	})
+
+	b.Run("registry", func(b *testing.B) {
+		for _, p := range ptrs[:benchRows] {
+			ConnectSignal(p, "paintEvent", data)
+		}
+		ConnectSignal(model, "data", data)
+		b.ResetTimer()
+
+		for i := 0; i < b.N; i++ {
+			if signal := GetSignal(model, "data"); signal != nil {
+				signal.(func(int, int) interface{})(i%benchRows, 0)
+			}
+		}
+		b.StopTimer()
+		for _, p := range ptrs {
+			DisconnectAllSignals(p)
+		}
+	})
+
+	b.Run("registry_parallel", func(b *testing.B) {
+		for _, p := range ptrs {
+			ConnectSignal(p, "data", data)
+		}
+		b.ResetTimer()
+
+		b.RunParallel(func(pb *testing.PB) {
+			var i int
+			for pb.Next() {
+				if signal := GetSignal(ptrs[i%benchRows], "data"); signal != nil {
+					signal.(func(int, int) interface{})(i, 0)
+				}
+				i++
+			}
+		})
+		b.StopTimer()
+		for _, p := range ptrs {
+			DisconnectAllSignals(p)
+		}
+	})
+}
+
+//connects a few signals on every object and tears them down again,
+//as done by the Destroy*/DeleteLater wrappers of each object
+func BenchmarkDisconnectAllSignals(b *testing.B) {
+	var names = []string{"destroyed", "objectNameChanged", "event", "timerEvent"}
+
+	for _, n := range []int{1000, 50000} {
+		var ptrs = fakePointers(n)
+
+		if n <= 1000 {
+			b.Run(fmt.Sprintf("legacy/%v", n), func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					b.StopTimer()
+					for _, p := range ptrs {
+						for _, name := range names {
+							legacyConnectSignal(fmt.Sprint(p), name, name)
+						}
+					}
+					b.StartTimer()
+
+					for _, p := range ptrs {
+						legacyDisconnectAllSignals(fmt.Sprint(p))
+					}
+				}
+			})
+		}
+
+		b.Run(fmt.Sprintf("registry/%v", n), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				b.StopTimer()
+				for _, p := range ptrs {
+					for _, name := range names {
+						ConnectSignal(p, name, name)
+					}
+				}
+				b.StartTimer()
+
+				for _, p := range ptrs {
+					DisconnectAllSignals(p)
+				}
+			}
+		})
+	}
+}
+
+//runs the main queue on a goroutine that plays the qt thread
+func fakeMainThread() (stop func(), wakeups *int32) {
+	var (
+		wake = make(chan struct{}, 1)
+		quit = make(chan struct{})
+		done = make(chan struct{})
+		n    int32
+	)
+	SetMainDispatcher(func() {
+		atomic.AddInt32(&n, 1)
+		select {
+		case wake <- struct{}{}:
+		default:
+		}
+	}, func() bool { return false })
+	go func() {
+		defer close(done)
+		for {
+			select {
+			case <-wake:
+				RunMainQueue()
+			case <-quit:
+				return
+			}
+		}
+	}()
+	return func() { close(quit); <-done; SetMainDispatcher(nil, nil) }, &n
+}
+
+func TestRunOnMain(t *testing.T) {
+	var stop, wakeups = fakeMainThread()
+	defer stop()
+
+	const producers, posts = 8, 10000
+	var (
+		last       = make([]int, producers)
+		ran        int
+		outOfOrder int
+		wg         sync.WaitGroup
+	)
+	for p := 0; p < producers; p++ {
+		wg.Add(1)
+		go func(p int) {
+			defer wg.Done()
+			for i := 1; i <= posts; i++ {
+				var i = i
+				RunOnMain(func() {
+					if last[p]+1 != i {
+						outOfOrder++
+					}
+					last[p] = i
+					ran++
+				})
+			}
+		}(p)
+	}
+	wg.Wait()
+
+	//the fake qt thread is done with the counters once this returns
+	RunOnMainSync(func() {})
+	assert.Equal(t, 0, outOfOrder)
+	assert.Equal(t, producers*posts, ran)
+	assert.True(t, atomic.LoadInt32(wakeups) < producers*posts)
+}
+
+func TestRunMainQueuePanic(t *testing.T) {
+	var ran []int
+	RunOnMain(func() { ran = append(ran, 1) })
+	RunOnMain(func() { panic("task") })
+	RunOnMain(func() { ran = append(ran, 3) })
+
+	func() {
+		defer func() { assert.Equal(t, "task", recover()) }()
+		RunMainQueue()
+	}()
+	assert.Equal(t, []int{1}, ran)
+
+	RunOnMain(func() { ran = append(ran, 4) })
+	RunMainQueue()
+	assert.Equal(t, []int{1, 3, 4}, ran)
+}
+
+func BenchmarkRunOnMain(b *testing.B) {
+	var stop, _ = fakeMainThread()
+	defer stop()
+
+	b.RunParallel(func(pb *testing.PB) {
+		for pb.Next() {
+			RunOnMain(func() {})
+		}
+	})
+	RunOnMainSync(func() {})
+}
+
+func instrumentedCallback(d time.Duration) {
+	defer CallbackEnd(CallbackStart("QWidget", "paintEvent"))
+	if d > 0 {
+		time.Sleep(d)
+	}
+}
+
+func TestCallbackStats(t *testing.T) {
+	defer ResetCallbackStats()
+
+	instrumentedCallback(0)
+	assert.Len(t, CallbackStats(), 0)
+
+	EnableCallbackStats(true, true)
+	defer EnableCallbackStats(false, false)
+
+	instrumentedCallback(0)
+	instrumentedCallback(2 * time.Millisecond)
+	defer CallbackEnd(CallbackStart("QAbstractItemModel", "data"))
+
+	var stats = CallbackStats()
+	assert.Len(t, stats, 1)
+	assert.Equal(t, "paintEvent", stats[0].Signal)
+	assert.Equal(t, uint64(2), stats[0].Count)
+	assert.True(t, stats[0].Max >= 2*time.Millisecond)
+	assert.True(t, stats[0].Total >= stats[0].Max)
+
+	var calls uint64
+	for _, n := range stats[0].Histogram {
+		calls += n
+	}
+	assert.Equal(t, uint64(2), calls)
+	assert.Equal(t, uint64(0), stats[0].Histogram[callbackBucket(uint64(time.Millisecond))])
+
+	assert.Equal(t, 0, callbackBucket(999))
+	assert.Equal(t, 1, callbackBucket(1000))
+	assert.Equal(t, CallbackBuckets-1, callbackBucket(1<<62))
+}
+
+func BenchmarkCallbackStatsDisabled(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		instrumentedCallback(0)
+	}
+}
+
+func BenchmarkCallbackStatsEnabled(b *testing.B) {
+	EnableCallbackStats(true, false)
+	defer EnableCallbackStats(false, false)
+	defer ResetCallbackStats()
+
+	for i := 0; i < b.N; i++ {
+		instrumentedCallback(0)
+	}
+}
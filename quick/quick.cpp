@@ -107,6 +107,43 @@
 #include <QWheelEvent>
 #include <QWidget>
 #include <QWindow>
+#include <QStringList>
+#include <QtEndian>
+#include <cstdlib>
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 class MyQQuickAsyncImageProvider: public QQuickAsyncImageProvider
 {
@@ -1634,6 +1671,16 @@ void* QQuickItem___grabTouchPoints_ids_newList(void* ptr)
 		return new QVector<int>;
 }
 
+void* QQuickItem___grabTouchPoints_ids_newListBuffer(void* ptr, void* data, int count)
+{
+		return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QQuickItem___grabTouchPoints_ids_fillList(void* ptr, void* data)
+{
+		for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
 void* QQuickItem___childItems_atList(void* ptr, int i)
 {
 		return const_cast<QQuickItem*>(static_cast<QList<QQuickItem *>*>(ptr)->at(i));
@@ -5979,7 +6026,7 @@ void QSGMaterialShader_SetShaderSourceFile(void* ptr, long long ty, char* source
 
 void QSGMaterialShader_SetShaderSourceFiles(void* ptr, long long ty, char* sourceFiles)
 {
-	static_cast<QSGMaterialShader*>(ptr)->setShaderSourceFiles(static_cast<QOpenGLShader::ShaderTypeBit>(ty), QString(sourceFiles).split("|", QString::SkipEmptyParts));
+	static_cast<QSGMaterialShader*>(ptr)->setShaderSourceFiles(static_cast<QOpenGLShader::ShaderTypeBit>(ty), goUnpackStringList(sourceFiles));
 }
 
 class MyQSGNode: public QSGNode
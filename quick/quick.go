@@ -8,14 +8,12 @@ package quick
 //#include "quick.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"github.com/therecipe/qt/gui"
 	"github.com/therecipe/qt/qml"
 	"github.com/therecipe/qt/widgets"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -25,6 +23,43 @@ func cGoUnpackString(s C.struct_QtQuick_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtQuick_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtQuick_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QQuickAsyncImageProvider struct {
 	QQuickImageProvider
@@ -70,7 +105,7 @@ func NewQQuickAsyncImageProvider() *QQuickAsyncImageProvider {
 
 //export callbackQQuickAsyncImageProvider_RequestImageResponse
 func callbackQQuickAsyncImageProvider_RequestImageResponse(ptr unsafe.Pointer, id C.struct_QtQuick_PackedString, requestedSize unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestImageResponse"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestImageResponse"); signal != nil {
 		return PointerFromQQuickImageResponse(signal.(func(string, *core.QSize) *QQuickImageResponse)(cGoUnpackString(id), core.NewQSizeFromPointer(requestedSize)))
 	}
 
@@ -80,14 +115,14 @@ func callbackQQuickAsyncImageProvider_RequestImageResponse(ptr unsafe.Pointer, i
 func (ptr *QQuickAsyncImageProvider) ConnectRequestImageResponse(f func(id string, requestedSize *core.QSize) *QQuickImageResponse) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "requestImageResponse", f)
+		qt.ConnectSignal(ptr.Pointer(), "requestImageResponse", f)
 	}
 }
 
 func (ptr *QQuickAsyncImageProvider) DisconnectRequestImageResponse() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "requestImageResponse")
+		qt.DisconnectSignal(ptr.Pointer(), "requestImageResponse")
 	}
 }
 
@@ -96,7 +131,7 @@ func (ptr *QQuickAsyncImageProvider) RequestImageResponse(id string, requestedSi
 		var idC = C.CString(id)
 		defer C.free(unsafe.Pointer(idC))
 		var tmpValue = NewQQuickImageResponseFromPointer(C.QQuickAsyncImageProvider_RequestImageResponse(ptr.Pointer(), idC, core.PointerFromQSize(requestedSize)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -106,7 +141,7 @@ func (ptr *QQuickAsyncImageProvider) RequestImageResponse(id string, requestedSi
 
 //export callbackQQuickAsyncImageProvider_DestroyQQuickAsyncImageProvider
 func callbackQQuickAsyncImageProvider_DestroyQQuickAsyncImageProvider(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QQuickAsyncImageProvider"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QQuickAsyncImageProvider"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickAsyncImageProviderFromPointer(ptr).DestroyQQuickAsyncImageProviderDefault()
@@ -116,21 +151,21 @@ func callbackQQuickAsyncImageProvider_DestroyQQuickAsyncImageProvider(ptr unsafe
 func (ptr *QQuickAsyncImageProvider) ConnectDestroyQQuickAsyncImageProvider(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickAsyncImageProvider", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QQuickAsyncImageProvider", f)
 	}
 }
 
 func (ptr *QQuickAsyncImageProvider) DisconnectDestroyQQuickAsyncImageProvider() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickAsyncImageProvider")
+		qt.DisconnectSignal(ptr.Pointer(), "~QQuickAsyncImageProvider")
 	}
 }
 
 func (ptr *QQuickAsyncImageProvider) DestroyQQuickAsyncImageProvider() {
 	if ptr.Pointer() != nil {
 		C.QQuickAsyncImageProvider_DestroyQQuickAsyncImageProvider(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -138,7 +173,7 @@ func (ptr *QQuickAsyncImageProvider) DestroyQQuickAsyncImageProvider() {
 func (ptr *QQuickAsyncImageProvider) DestroyQQuickAsyncImageProviderDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickAsyncImageProvider_DestroyQQuickAsyncImageProviderDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -185,14 +220,14 @@ func NewQQuickFramebufferObjectFromPointer(ptr unsafe.Pointer) *QQuickFramebuffe
 func (ptr *QQuickFramebufferObject) DestroyQQuickFramebufferObject() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickFramebufferObject_MirrorVerticallyChanged
 func callbackQQuickFramebufferObject_MirrorVerticallyChanged(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mirrorVerticallyChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mirrorVerticallyChanged"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	}
 
@@ -201,14 +236,14 @@ func callbackQQuickFramebufferObject_MirrorVerticallyChanged(ptr unsafe.Pointer,
 func (ptr *QQuickFramebufferObject) ConnectMirrorVerticallyChanged(f func(vbo bool)) {
 	if ptr.Pointer() != nil {
 		C.QQuickFramebufferObject_ConnectMirrorVerticallyChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mirrorVerticallyChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "mirrorVerticallyChanged", f)
 	}
 }
 
 func (ptr *QQuickFramebufferObject) DisconnectMirrorVerticallyChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickFramebufferObject_DisconnectMirrorVerticallyChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mirrorVerticallyChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "mirrorVerticallyChanged")
 	}
 }
 
@@ -232,7 +267,7 @@ func (ptr *QQuickFramebufferObject) SetTextureFollowsItemSize(follows bool) {
 
 //export callbackQQuickFramebufferObject_TextureFollowsItemSizeChanged
 func callbackQQuickFramebufferObject_TextureFollowsItemSizeChanged(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureFollowsItemSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureFollowsItemSizeChanged"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	}
 
@@ -241,14 +276,14 @@ func callbackQQuickFramebufferObject_TextureFollowsItemSizeChanged(ptr unsafe.Po
 func (ptr *QQuickFramebufferObject) ConnectTextureFollowsItemSizeChanged(f func(vbo bool)) {
 	if ptr.Pointer() != nil {
 		C.QQuickFramebufferObject_ConnectTextureFollowsItemSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureFollowsItemSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureFollowsItemSizeChanged", f)
 	}
 }
 
 func (ptr *QQuickFramebufferObject) DisconnectTextureFollowsItemSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickFramebufferObject_DisconnectTextureFollowsItemSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureFollowsItemSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureFollowsItemSizeChanged")
 	}
 }
 
@@ -313,7 +348,7 @@ func NewQQuickImageProviderFromPointer(ptr unsafe.Pointer) *QQuickImageProvider
 
 //export callbackQQuickImageProvider_RequestImage
 func callbackQQuickImageProvider_RequestImage(ptr unsafe.Pointer, id C.struct_QtQuick_PackedString, size unsafe.Pointer, requestedSize unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestImage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestImage"); signal != nil {
 		return gui.PointerFromQImage(signal.(func(string, *core.QSize, *core.QSize) *gui.QImage)(cGoUnpackString(id), core.NewQSizeFromPointer(size), core.NewQSizeFromPointer(requestedSize)))
 	}
 
@@ -323,14 +358,14 @@ func callbackQQuickImageProvider_RequestImage(ptr unsafe.Pointer, id C.struct_Qt
 func (ptr *QQuickImageProvider) ConnectRequestImage(f func(id string, size *core.QSize, requestedSize *core.QSize) *gui.QImage) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "requestImage", f)
+		qt.ConnectSignal(ptr.Pointer(), "requestImage", f)
 	}
 }
 
 func (ptr *QQuickImageProvider) DisconnectRequestImage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "requestImage")
+		qt.DisconnectSignal(ptr.Pointer(), "requestImage")
 	}
 }
 
@@ -358,7 +393,7 @@ func (ptr *QQuickImageProvider) RequestImageDefault(id string, size core.QSize_I
 
 //export callbackQQuickImageProvider_RequestPixmap
 func callbackQQuickImageProvider_RequestPixmap(ptr unsafe.Pointer, id C.struct_QtQuick_PackedString, size unsafe.Pointer, requestedSize unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestPixmap"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestPixmap"); signal != nil {
 		return gui.PointerFromQPixmap(signal.(func(string, *core.QSize, *core.QSize) *gui.QPixmap)(cGoUnpackString(id), core.NewQSizeFromPointer(size), core.NewQSizeFromPointer(requestedSize)))
 	}
 
@@ -368,14 +403,14 @@ func callbackQQuickImageProvider_RequestPixmap(ptr unsafe.Pointer, id C.struct_Q
 func (ptr *QQuickImageProvider) ConnectRequestPixmap(f func(id string, size *core.QSize, requestedSize *core.QSize) *gui.QPixmap) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "requestPixmap", f)
+		qt.ConnectSignal(ptr.Pointer(), "requestPixmap", f)
 	}
 }
 
 func (ptr *QQuickImageProvider) DisconnectRequestPixmap() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "requestPixmap")
+		qt.DisconnectSignal(ptr.Pointer(), "requestPixmap")
 	}
 }
 
@@ -407,7 +442,7 @@ func NewQQuickImageProvider(ty qml.QQmlImageProviderBase__ImageType, flags qml.Q
 
 //export callbackQQuickImageProvider_RequestTexture
 func callbackQQuickImageProvider_RequestTexture(ptr unsafe.Pointer, id C.struct_QtQuick_PackedString, size unsafe.Pointer, requestedSize unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestTexture"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestTexture"); signal != nil {
 		return PointerFromQQuickTextureFactory(signal.(func(string, *core.QSize, *core.QSize) *QQuickTextureFactory)(cGoUnpackString(id), core.NewQSizeFromPointer(size), core.NewQSizeFromPointer(requestedSize)))
 	}
 
@@ -417,14 +452,14 @@ func callbackQQuickImageProvider_RequestTexture(ptr unsafe.Pointer, id C.struct_
 func (ptr *QQuickImageProvider) ConnectRequestTexture(f func(id string, size *core.QSize, requestedSize *core.QSize) *QQuickTextureFactory) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "requestTexture", f)
+		qt.ConnectSignal(ptr.Pointer(), "requestTexture", f)
 	}
 }
 
 func (ptr *QQuickImageProvider) DisconnectRequestTexture() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "requestTexture")
+		qt.DisconnectSignal(ptr.Pointer(), "requestTexture")
 	}
 }
 
@@ -433,7 +468,7 @@ func (ptr *QQuickImageProvider) RequestTexture(id string, size core.QSize_ITF, r
 		var idC = C.CString(id)
 		defer C.free(unsafe.Pointer(idC))
 		var tmpValue = NewQQuickTextureFactoryFromPointer(C.QQuickImageProvider_RequestTexture(ptr.Pointer(), idC, core.PointerFromQSize(size), core.PointerFromQSize(requestedSize)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -446,7 +481,7 @@ func (ptr *QQuickImageProvider) RequestTextureDefault(id string, size core.QSize
 		var idC = C.CString(id)
 		defer C.free(unsafe.Pointer(idC))
 		var tmpValue = NewQQuickTextureFactoryFromPointer(C.QQuickImageProvider_RequestTextureDefault(ptr.Pointer(), idC, core.PointerFromQSize(size), core.PointerFromQSize(requestedSize)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -456,7 +491,7 @@ func (ptr *QQuickImageProvider) RequestTextureDefault(id string, size core.QSize
 
 //export callbackQQuickImageProvider_DestroyQQuickImageProvider
 func callbackQQuickImageProvider_DestroyQQuickImageProvider(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QQuickImageProvider"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QQuickImageProvider"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickImageProviderFromPointer(ptr).DestroyQQuickImageProviderDefault()
@@ -466,21 +501,21 @@ func callbackQQuickImageProvider_DestroyQQuickImageProvider(ptr unsafe.Pointer)
 func (ptr *QQuickImageProvider) ConnectDestroyQQuickImageProvider(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickImageProvider", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QQuickImageProvider", f)
 	}
 }
 
 func (ptr *QQuickImageProvider) DisconnectDestroyQQuickImageProvider() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickImageProvider")
+		qt.DisconnectSignal(ptr.Pointer(), "~QQuickImageProvider")
 	}
 }
 
 func (ptr *QQuickImageProvider) DestroyQQuickImageProvider() {
 	if ptr.Pointer() != nil {
 		C.QQuickImageProvider_DestroyQQuickImageProvider(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -488,14 +523,14 @@ func (ptr *QQuickImageProvider) DestroyQQuickImageProvider() {
 func (ptr *QQuickImageProvider) DestroyQQuickImageProviderDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickImageProvider_DestroyQQuickImageProviderDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickImageProvider_Flags
 func callbackQQuickImageProvider_Flags(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flags"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flags"); signal != nil {
 		return C.longlong(signal.(func() qml.QQmlImageProviderBase__Flag)())
 	}
 
@@ -505,14 +540,14 @@ func callbackQQuickImageProvider_Flags(ptr unsafe.Pointer) C.longlong {
 func (ptr *QQuickImageProvider) ConnectFlags(f func() qml.QQmlImageProviderBase__Flag) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "flags", f)
+		qt.ConnectSignal(ptr.Pointer(), "flags", f)
 	}
 }
 
 func (ptr *QQuickImageProvider) DisconnectFlags() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "flags")
+		qt.DisconnectSignal(ptr.Pointer(), "flags")
 	}
 }
 
@@ -532,7 +567,7 @@ func (ptr *QQuickImageProvider) FlagsDefault() qml.QQmlImageProviderBase__Flag {
 
 //export callbackQQuickImageProvider_ImageType
 func callbackQQuickImageProvider_ImageType(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "imageType"); signal != nil {
+	if signal := qt.GetSignal(ptr, "imageType"); signal != nil {
 		return C.longlong(signal.(func() qml.QQmlImageProviderBase__ImageType)())
 	}
 
@@ -542,14 +577,14 @@ func callbackQQuickImageProvider_ImageType(ptr unsafe.Pointer) C.longlong {
 func (ptr *QQuickImageProvider) ConnectImageType(f func() qml.QQmlImageProviderBase__ImageType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "imageType", f)
+		qt.ConnectSignal(ptr.Pointer(), "imageType", f)
 	}
 }
 
 func (ptr *QQuickImageProvider) DisconnectImageType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "imageType")
+		qt.DisconnectSignal(ptr.Pointer(), "imageType")
 	}
 }
 
@@ -607,7 +642,7 @@ func NewQQuickImageResponseFromPointer(ptr unsafe.Pointer) *QQuickImageResponse
 }
 func NewQQuickImageResponse() *QQuickImageResponse {
 	var tmpValue = NewQQuickImageResponseFromPointer(C.QQuickImageResponse_NewQQuickImageResponse())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -615,7 +650,7 @@ func NewQQuickImageResponse() *QQuickImageResponse {
 
 //export callbackQQuickImageResponse_Cancel
 func callbackQQuickImageResponse_Cancel(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "cancel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "cancel"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickImageResponseFromPointer(ptr).CancelDefault()
@@ -625,14 +660,14 @@ func callbackQQuickImageResponse_Cancel(ptr unsafe.Pointer) {
 func (ptr *QQuickImageResponse) ConnectCancel(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "cancel", f)
+		qt.ConnectSignal(ptr.Pointer(), "cancel", f)
 	}
 }
 
 func (ptr *QQuickImageResponse) DisconnectCancel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "cancel")
+		qt.DisconnectSignal(ptr.Pointer(), "cancel")
 	}
 }
 
@@ -650,7 +685,7 @@ func (ptr *QQuickImageResponse) CancelDefault() {
 
 //export callbackQQuickImageResponse_Finished
 func callbackQQuickImageResponse_Finished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -659,14 +694,14 @@ func callbackQQuickImageResponse_Finished(ptr unsafe.Pointer) {
 func (ptr *QQuickImageResponse) ConnectFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickImageResponse_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QQuickImageResponse) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QQuickImageResponse_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
@@ -678,7 +713,7 @@ func (ptr *QQuickImageResponse) Finished() {
 
 //export callbackQQuickImageResponse_DestroyQQuickImageResponse
 func callbackQQuickImageResponse_DestroyQQuickImageResponse(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QQuickImageResponse"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QQuickImageResponse"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickImageResponseFromPointer(ptr).DestroyQQuickImageResponseDefault()
@@ -688,21 +723,21 @@ func callbackQQuickImageResponse_DestroyQQuickImageResponse(ptr unsafe.Pointer)
 func (ptr *QQuickImageResponse) ConnectDestroyQQuickImageResponse(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickImageResponse", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QQuickImageResponse", f)
 	}
 }
 
 func (ptr *QQuickImageResponse) DisconnectDestroyQQuickImageResponse() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickImageResponse")
+		qt.DisconnectSignal(ptr.Pointer(), "~QQuickImageResponse")
 	}
 }
 
 func (ptr *QQuickImageResponse) DestroyQQuickImageResponse() {
 	if ptr.Pointer() != nil {
 		C.QQuickImageResponse_DestroyQQuickImageResponse(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -710,14 +745,14 @@ func (ptr *QQuickImageResponse) DestroyQQuickImageResponse() {
 func (ptr *QQuickImageResponse) DestroyQQuickImageResponseDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickImageResponse_DestroyQQuickImageResponseDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickImageResponse_TextureFactory
 func callbackQQuickImageResponse_TextureFactory(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureFactory"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureFactory"); signal != nil {
 		return PointerFromQQuickTextureFactory(signal.(func() *QQuickTextureFactory)())
 	}
 
@@ -727,21 +762,21 @@ func callbackQQuickImageResponse_TextureFactory(ptr unsafe.Pointer) unsafe.Point
 func (ptr *QQuickImageResponse) ConnectTextureFactory(f func() *QQuickTextureFactory) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureFactory", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureFactory", f)
 	}
 }
 
 func (ptr *QQuickImageResponse) DisconnectTextureFactory() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureFactory")
+		qt.DisconnectSignal(ptr.Pointer(), "textureFactory")
 	}
 }
 
 func (ptr *QQuickImageResponse) TextureFactory() *QQuickTextureFactory {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickTextureFactoryFromPointer(C.QQuickImageResponse_TextureFactory(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -751,7 +786,7 @@ func (ptr *QQuickImageResponse) TextureFactory() *QQuickTextureFactory {
 
 //export callbackQQuickImageResponse_ErrorString
 func callbackQQuickImageResponse_ErrorString(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorString"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -761,14 +796,14 @@ func callbackQQuickImageResponse_ErrorString(ptr unsafe.Pointer) *C.char {
 func (ptr *QQuickImageResponse) ConnectErrorString(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorString", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorString", f)
 	}
 }
 
 func (ptr *QQuickImageResponse) DisconnectErrorString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorString")
+		qt.DisconnectSignal(ptr.Pointer(), "errorString")
 	}
 }
 
@@ -808,7 +843,7 @@ func (ptr *QQuickImageResponse) __dynamicPropertyNames_newList() unsafe.Pointer
 func (ptr *QQuickImageResponse) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickImageResponse___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -829,7 +864,7 @@ func (ptr *QQuickImageResponse) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QQuickImageResponse) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickImageResponse___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -850,7 +885,7 @@ func (ptr *QQuickImageResponse) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QQuickImageResponse) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickImageResponse___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -871,7 +906,7 @@ func (ptr *QQuickImageResponse) __findChildren_newList() unsafe.Pointer {
 func (ptr *QQuickImageResponse) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickImageResponse___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -891,7 +926,7 @@ func (ptr *QQuickImageResponse) __children_newList() unsafe.Pointer {
 
 //export callbackQQuickImageResponse_Event
 func callbackQQuickImageResponse_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -907,7 +942,7 @@ func (ptr *QQuickImageResponse) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQQuickImageResponse_EventFilter
 func callbackQQuickImageResponse_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -923,7 +958,7 @@ func (ptr *QQuickImageResponse) EventFilterDefault(watched core.QObject_ITF, eve
 
 //export callbackQQuickImageResponse_ChildEvent
 func callbackQQuickImageResponse_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQQuickImageResponseFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -938,7 +973,7 @@ func (ptr *QQuickImageResponse) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQQuickImageResponse_ConnectNotify
 func callbackQQuickImageResponse_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickImageResponseFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -953,7 +988,7 @@ func (ptr *QQuickImageResponse) ConnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQQuickImageResponse_CustomEvent
 func callbackQQuickImageResponse_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickImageResponseFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -968,7 +1003,7 @@ func (ptr *QQuickImageResponse) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickImageResponse_DeleteLater
 func callbackQQuickImageResponse_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickImageResponseFromPointer(ptr).DeleteLaterDefault()
@@ -978,14 +1013,14 @@ func callbackQQuickImageResponse_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QQuickImageResponse) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickImageResponse_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickImageResponse_Destroyed
 func callbackQQuickImageResponse_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -993,7 +1028,7 @@ func callbackQQuickImageResponse_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointe
 
 //export callbackQQuickImageResponse_DisconnectNotify
 func callbackQQuickImageResponse_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickImageResponseFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1008,7 +1043,7 @@ func (ptr *QQuickImageResponse) DisconnectNotifyDefault(sign core.QMetaMethod_IT
 
 //export callbackQQuickImageResponse_ObjectNameChanged
 func callbackQQuickImageResponse_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -1016,7 +1051,7 @@ func callbackQQuickImageResponse_ObjectNameChanged(ptr unsafe.Pointer, objectNam
 
 //export callbackQQuickImageResponse_TimerEvent
 func callbackQQuickImageResponse_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQQuickImageResponseFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -1031,7 +1066,7 @@ func (ptr *QQuickImageResponse) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQQuickImageResponse_MetaObject
 func callbackQQuickImageResponse_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -1135,7 +1170,7 @@ const (
 func (ptr *QQuickItem) NextItemInFocusChain(forward bool) *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickItem_NextItemInFocusChain(ptr.Pointer(), C.char(int8(qt.GoBoolToInt(forward)))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1145,7 +1180,7 @@ func (ptr *QQuickItem) NextItemInFocusChain(forward bool) *QQuickItem {
 
 func NewQQuickItem(parent QQuickItem_ITF) *QQuickItem {
 	var tmpValue = NewQQuickItemFromPointer(C.QQuickItem_NewQQuickItem(PointerFromQQuickItem(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1162,7 +1197,7 @@ func (ptr *QQuickItem) ChildrenRect() *core.QRectF {
 
 //export callbackQQuickItem_ChildMouseEventFilter
 func callbackQQuickItem_ChildMouseEventFilter(ptr unsafe.Pointer, item unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childMouseEventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childMouseEventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QQuickItem, *core.QEvent) bool)(NewQQuickItemFromPointer(item), core.NewQEventFromPointer(event)))))
 	}
 
@@ -1172,14 +1207,14 @@ func callbackQQuickItem_ChildMouseEventFilter(ptr unsafe.Pointer, item unsafe.Po
 func (ptr *QQuickItem) ConnectChildMouseEventFilter(f func(item *QQuickItem, event *core.QEvent) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "childMouseEventFilter", f)
+		qt.ConnectSignal(ptr.Pointer(), "childMouseEventFilter", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectChildMouseEventFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "childMouseEventFilter")
+		qt.DisconnectSignal(ptr.Pointer(), "childMouseEventFilter")
 	}
 }
 
@@ -1199,7 +1234,7 @@ func (ptr *QQuickItem) ChildMouseEventFilterDefault(item QQuickItem_ITF, event c
 
 //export callbackQQuickItem_Event
 func callbackQQuickItem_Event(ptr unsafe.Pointer, ev unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(ev)))))
 	}
 
@@ -1209,14 +1244,14 @@ func callbackQQuickItem_Event(ptr unsafe.Pointer, ev unsafe.Pointer) C.char {
 func (ptr *QQuickItem) ConnectEvent(f func(ev *core.QEvent) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "event", f)
+		qt.ConnectSignal(ptr.Pointer(), "event", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "event")
+		qt.DisconnectSignal(ptr.Pointer(), "event")
 	}
 }
 
@@ -1236,7 +1271,7 @@ func (ptr *QQuickItem) EventDefault(ev core.QEvent_ITF) bool {
 
 //export callbackQQuickItem_ClassBegin
 func callbackQQuickItem_ClassBegin(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "classBegin"); signal != nil {
+	if signal := qt.GetSignal(ptr, "classBegin"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemFromPointer(ptr).ClassBeginDefault()
@@ -1246,14 +1281,14 @@ func callbackQQuickItem_ClassBegin(ptr unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectClassBegin(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "classBegin", f)
+		qt.ConnectSignal(ptr.Pointer(), "classBegin", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectClassBegin() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "classBegin")
+		qt.DisconnectSignal(ptr.Pointer(), "classBegin")
 	}
 }
 
@@ -1271,7 +1306,7 @@ func (ptr *QQuickItem) ClassBeginDefault() {
 
 //export callbackQQuickItem_ComponentComplete
 func callbackQQuickItem_ComponentComplete(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "componentComplete"); signal != nil {
+	if signal := qt.GetSignal(ptr, "componentComplete"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemFromPointer(ptr).ComponentCompleteDefault()
@@ -1281,14 +1316,14 @@ func callbackQQuickItem_ComponentComplete(ptr unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectComponentComplete(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "componentComplete", f)
+		qt.ConnectSignal(ptr.Pointer(), "componentComplete", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectComponentComplete() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "componentComplete")
+		qt.DisconnectSignal(ptr.Pointer(), "componentComplete")
 	}
 }
 
@@ -1306,7 +1341,7 @@ func (ptr *QQuickItem) ComponentCompleteDefault() {
 
 //export callbackQQuickItem_DragEnterEvent
 func callbackQQuickItem_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -1316,14 +1351,14 @@ func callbackQQuickItem_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer)
 func (ptr *QQuickItem) ConnectDragEnterEvent(f func(event *gui.QDragEnterEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dragEnterEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "dragEnterEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectDragEnterEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dragEnterEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "dragEnterEvent")
 	}
 }
 
@@ -1341,7 +1376,7 @@ func (ptr *QQuickItem) DragEnterEventDefault(event gui.QDragEnterEvent_ITF) {
 
 //export callbackQQuickItem_DragLeaveEvent
 func callbackQQuickItem_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -1351,14 +1386,14 @@ func callbackQQuickItem_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer)
 func (ptr *QQuickItem) ConnectDragLeaveEvent(f func(event *gui.QDragLeaveEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dragLeaveEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "dragLeaveEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectDragLeaveEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dragLeaveEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "dragLeaveEvent")
 	}
 }
 
@@ -1376,7 +1411,7 @@ func (ptr *QQuickItem) DragLeaveEventDefault(event gui.QDragLeaveEvent_ITF) {
 
 //export callbackQQuickItem_DragMoveEvent
 func callbackQQuickItem_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -1386,14 +1421,14 @@ func callbackQQuickItem_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer)
 func (ptr *QQuickItem) ConnectDragMoveEvent(f func(event *gui.QDragMoveEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dragMoveEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "dragMoveEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectDragMoveEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dragMoveEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "dragMoveEvent")
 	}
 }
 
@@ -1411,7 +1446,7 @@ func (ptr *QQuickItem) DragMoveEventDefault(event gui.QDragMoveEvent_ITF) {
 
 //export callbackQQuickItem_DropEvent
 func callbackQQuickItem_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -1421,14 +1456,14 @@ func callbackQQuickItem_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectDropEvent(f func(event *gui.QDropEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dropEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "dropEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectDropEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dropEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "dropEvent")
 	}
 }
 
@@ -1446,7 +1481,7 @@ func (ptr *QQuickItem) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQQuickItem_FocusInEvent
 func callbackQQuickItem_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -1456,14 +1491,14 @@ func callbackQQuickItem_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectFocusInEvent(f func(event *gui.QFocusEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "focusInEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "focusInEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectFocusInEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "focusInEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "focusInEvent")
 	}
 }
 
@@ -1481,7 +1516,7 @@ func (ptr *QQuickItem) FocusInEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQQuickItem_FocusOutEvent
 func callbackQQuickItem_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -1491,14 +1526,14 @@ func callbackQQuickItem_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer)
 func (ptr *QQuickItem) ConnectFocusOutEvent(f func(event *gui.QFocusEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "focusOutEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "focusOutEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectFocusOutEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "focusOutEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "focusOutEvent")
 	}
 }
 
@@ -1528,7 +1563,7 @@ func (ptr *QQuickItem) ForceActiveFocus2(reason core.Qt__FocusReason) {
 
 //export callbackQQuickItem_GeometryChanged
 func callbackQQuickItem_GeometryChanged(ptr unsafe.Pointer, newGeometry unsafe.Pointer, oldGeometry unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "geometryChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "geometryChanged"); signal != nil {
 		signal.(func(*core.QRectF, *core.QRectF))(core.NewQRectFFromPointer(newGeometry), core.NewQRectFFromPointer(oldGeometry))
 	} else {
 		NewQQuickItemFromPointer(ptr).GeometryChangedDefault(core.NewQRectFFromPointer(newGeometry), core.NewQRectFFromPointer(oldGeometry))
@@ -1538,14 +1573,14 @@ func callbackQQuickItem_GeometryChanged(ptr unsafe.Pointer, newGeometry unsafe.P
 func (ptr *QQuickItem) ConnectGeometryChanged(f func(newGeometry *core.QRectF, oldGeometry *core.QRectF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "geometryChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "geometryChanged", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectGeometryChanged() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "geometryChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "geometryChanged")
 	}
 }
 
@@ -1569,19 +1604,19 @@ func (ptr *QQuickItem) GrabMouse() {
 
 func (ptr *QQuickItem) GrabTouchPoints(ids []int) {
 	if ptr.Pointer() != nil {
-		C.QQuickItem_GrabTouchPoints(ptr.Pointer(), func() unsafe.Pointer {
-			var tmpList = NewQQuickItemFromPointer(NewQQuickItemFromPointer(nil).__grabTouchPoints_ids_newList())
-			for _, v := range ids {
-				tmpList.__grabTouchPoints_ids_setList(v)
+		C.QQuickItem_GrabTouchPoints(ptr.Pointer(), func(l []int) unsafe.Pointer {
+			var tmpList = make([]C.int, len(l)+1)
+			for i, v := range l {
+				tmpList[i] = C.int(int32(v))
 			}
-			return tmpList.Pointer()
-		}())
+			return NewQQuickItemFromPointer(nil).__grabTouchPoints_ids_newListBuffer(unsafe.Pointer(&tmpList[0]), len(l))
+		}(ids))
 	}
 }
 
 //export callbackQQuickItem_HoverEnterEvent
 func callbackQQuickItem_HoverEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hoverEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hoverEnterEvent"); signal != nil {
 		signal.(func(*gui.QHoverEvent))(gui.NewQHoverEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).HoverEnterEventDefault(gui.NewQHoverEventFromPointer(event))
@@ -1591,14 +1626,14 @@ func callbackQQuickItem_HoverEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer
 func (ptr *QQuickItem) ConnectHoverEnterEvent(f func(event *gui.QHoverEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hoverEnterEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "hoverEnterEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectHoverEnterEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hoverEnterEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "hoverEnterEvent")
 	}
 }
 
@@ -1616,7 +1651,7 @@ func (ptr *QQuickItem) HoverEnterEventDefault(event gui.QHoverEvent_ITF) {
 
 //export callbackQQuickItem_HoverLeaveEvent
 func callbackQQuickItem_HoverLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hoverLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hoverLeaveEvent"); signal != nil {
 		signal.(func(*gui.QHoverEvent))(gui.NewQHoverEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).HoverLeaveEventDefault(gui.NewQHoverEventFromPointer(event))
@@ -1626,14 +1661,14 @@ func callbackQQuickItem_HoverLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer
 func (ptr *QQuickItem) ConnectHoverLeaveEvent(f func(event *gui.QHoverEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hoverLeaveEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "hoverLeaveEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectHoverLeaveEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hoverLeaveEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "hoverLeaveEvent")
 	}
 }
 
@@ -1651,7 +1686,7 @@ func (ptr *QQuickItem) HoverLeaveEventDefault(event gui.QHoverEvent_ITF) {
 
 //export callbackQQuickItem_HoverMoveEvent
 func callbackQQuickItem_HoverMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hoverMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hoverMoveEvent"); signal != nil {
 		signal.(func(*gui.QHoverEvent))(gui.NewQHoverEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).HoverMoveEventDefault(gui.NewQHoverEventFromPointer(event))
@@ -1661,14 +1696,14 @@ func callbackQQuickItem_HoverMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer)
 func (ptr *QQuickItem) ConnectHoverMoveEvent(f func(event *gui.QHoverEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hoverMoveEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "hoverMoveEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectHoverMoveEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hoverMoveEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "hoverMoveEvent")
 	}
 }
 
@@ -1686,7 +1721,7 @@ func (ptr *QQuickItem) HoverMoveEventDefault(event gui.QHoverEvent_ITF) {
 
 //export callbackQQuickItem_InputMethodEvent
 func callbackQQuickItem_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -1696,14 +1731,14 @@ func callbackQQuickItem_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointe
 func (ptr *QQuickItem) ConnectInputMethodEvent(f func(event *gui.QInputMethodEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "inputMethodEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "inputMethodEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectInputMethodEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "inputMethodEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "inputMethodEvent")
 	}
 }
 
@@ -1721,7 +1756,7 @@ func (ptr *QQuickItem) InputMethodEventDefault(event gui.QInputMethodEvent_ITF)
 
 //export callbackQQuickItem_KeyPressEvent
 func callbackQQuickItem_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -1731,14 +1766,14 @@ func callbackQQuickItem_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer)
 func (ptr *QQuickItem) ConnectKeyPressEvent(f func(event *gui.QKeyEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "keyPressEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "keyPressEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectKeyPressEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "keyPressEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "keyPressEvent")
 	}
 }
 
@@ -1756,7 +1791,7 @@ func (ptr *QQuickItem) KeyPressEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQQuickItem_KeyReleaseEvent
 func callbackQQuickItem_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -1766,14 +1801,14 @@ func callbackQQuickItem_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer
 func (ptr *QQuickItem) ConnectKeyReleaseEvent(f func(event *gui.QKeyEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "keyReleaseEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "keyReleaseEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectKeyReleaseEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "keyReleaseEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "keyReleaseEvent")
 	}
 }
 
@@ -1791,7 +1826,7 @@ func (ptr *QQuickItem) KeyReleaseEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQQuickItem_MouseDoubleClickEvent
 func callbackQQuickItem_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -1801,14 +1836,14 @@ func callbackQQuickItem_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.P
 func (ptr *QQuickItem) ConnectMouseDoubleClickEvent(f func(event *gui.QMouseEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseDoubleClickEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseDoubleClickEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectMouseDoubleClickEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseDoubleClickEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseDoubleClickEvent")
 	}
 }
 
@@ -1826,7 +1861,7 @@ func (ptr *QQuickItem) MouseDoubleClickEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickItem_MouseMoveEvent
 func callbackQQuickItem_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -1836,14 +1871,14 @@ func callbackQQuickItem_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer)
 func (ptr *QQuickItem) ConnectMouseMoveEvent(f func(event *gui.QMouseEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseMoveEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseMoveEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectMouseMoveEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseMoveEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseMoveEvent")
 	}
 }
 
@@ -1861,7 +1896,7 @@ func (ptr *QQuickItem) MouseMoveEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickItem_MousePressEvent
 func callbackQQuickItem_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -1871,14 +1906,14 @@ func callbackQQuickItem_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer
 func (ptr *QQuickItem) ConnectMousePressEvent(f func(event *gui.QMouseEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mousePressEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectMousePressEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mousePressEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mousePressEvent")
 	}
 }
 
@@ -1896,7 +1931,7 @@ func (ptr *QQuickItem) MousePressEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickItem_MouseReleaseEvent
 func callbackQQuickItem_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -1906,14 +1941,14 @@ func callbackQQuickItem_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Point
 func (ptr *QQuickItem) ConnectMouseReleaseEvent(f func(event *gui.QMouseEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseReleaseEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseReleaseEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectMouseReleaseEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseReleaseEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseReleaseEvent")
 	}
 }
 
@@ -1931,7 +1966,7 @@ func (ptr *QQuickItem) MouseReleaseEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickItem_MouseUngrabEvent
 func callbackQQuickItem_MouseUngrabEvent(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseUngrabEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseUngrabEvent"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemFromPointer(ptr).MouseUngrabEventDefault()
@@ -1941,14 +1976,14 @@ func callbackQQuickItem_MouseUngrabEvent(ptr unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectMouseUngrabEvent(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mouseUngrabEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "mouseUngrabEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectMouseUngrabEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mouseUngrabEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "mouseUngrabEvent")
 	}
 }
 
@@ -1972,7 +2007,7 @@ func (ptr *QQuickItem) Polish() {
 
 //export callbackQQuickItem_ReleaseResources
 func callbackQQuickItem_ReleaseResources(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "releaseResources"); signal != nil {
+	if signal := qt.GetSignal(ptr, "releaseResources"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemFromPointer(ptr).ReleaseResourcesDefault()
@@ -1982,14 +2017,14 @@ func callbackQQuickItem_ReleaseResources(ptr unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectReleaseResources(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "releaseResources", f)
+		qt.ConnectSignal(ptr.Pointer(), "releaseResources", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectReleaseResources() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "releaseResources")
+		qt.DisconnectSignal(ptr.Pointer(), "releaseResources")
 	}
 }
 
@@ -2219,7 +2254,7 @@ func (ptr *QQuickItem) StackBefore(sibling QQuickItem_ITF) {
 
 //export callbackQQuickItem_TouchEvent
 func callbackQQuickItem_TouchEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "touchEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "touchEvent"); signal != nil {
 		signal.(func(*gui.QTouchEvent))(gui.NewQTouchEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).TouchEventDefault(gui.NewQTouchEventFromPointer(event))
@@ -2229,14 +2264,14 @@ func callbackQQuickItem_TouchEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectTouchEvent(f func(event *gui.QTouchEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "touchEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "touchEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectTouchEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "touchEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "touchEvent")
 	}
 }
 
@@ -2254,7 +2289,7 @@ func (ptr *QQuickItem) TouchEventDefault(event gui.QTouchEvent_ITF) {
 
 //export callbackQQuickItem_TouchUngrabEvent
 func callbackQQuickItem_TouchUngrabEvent(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "touchUngrabEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "touchUngrabEvent"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemFromPointer(ptr).TouchUngrabEventDefault()
@@ -2264,14 +2299,14 @@ func callbackQQuickItem_TouchUngrabEvent(ptr unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectTouchUngrabEvent(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "touchUngrabEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "touchUngrabEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectTouchUngrabEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "touchUngrabEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "touchUngrabEvent")
 	}
 }
 
@@ -2307,7 +2342,7 @@ func (ptr *QQuickItem) UnsetCursor() {
 
 //export callbackQQuickItem_Update
 func callbackQQuickItem_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemFromPointer(ptr).UpdateDefault()
@@ -2317,14 +2352,14 @@ func callbackQQuickItem_Update(ptr unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectUpdate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "update", f)
+		qt.ConnectSignal(ptr.Pointer(), "update", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectUpdate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "update")
+		qt.DisconnectSignal(ptr.Pointer(), "update")
 	}
 }
 
@@ -2348,7 +2383,7 @@ func (ptr *QQuickItem) UpdateInputMethod(queries core.Qt__InputMethodQuery) {
 
 //export callbackQQuickItem_UpdatePolish
 func callbackQQuickItem_UpdatePolish(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updatePolish"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updatePolish"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemFromPointer(ptr).UpdatePolishDefault()
@@ -2358,14 +2393,14 @@ func callbackQQuickItem_UpdatePolish(ptr unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectUpdatePolish(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updatePolish", f)
+		qt.ConnectSignal(ptr.Pointer(), "updatePolish", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectUpdatePolish() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updatePolish")
+		qt.DisconnectSignal(ptr.Pointer(), "updatePolish")
 	}
 }
 
@@ -2383,7 +2418,7 @@ func (ptr *QQuickItem) UpdatePolishDefault() {
 
 //export callbackQQuickItem_WheelEvent
 func callbackQQuickItem_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -2393,14 +2428,14 @@ func callbackQQuickItem_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectWheelEvent(f func(event *gui.QWheelEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "wheelEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "wheelEvent", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectWheelEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "wheelEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "wheelEvent")
 	}
 }
 
@@ -2418,7 +2453,7 @@ func (ptr *QQuickItem) WheelEventDefault(event gui.QWheelEvent_ITF) {
 
 //export callbackQQuickItem_WindowChanged
 func callbackQQuickItem_WindowChanged(ptr unsafe.Pointer, window unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowChanged"); signal != nil {
 		signal.(func(*QQuickWindow))(NewQQuickWindowFromPointer(window))
 	}
 
@@ -2427,14 +2462,14 @@ func callbackQQuickItem_WindowChanged(ptr unsafe.Pointer, window unsafe.Pointer)
 func (ptr *QQuickItem) ConnectWindowChanged(f func(window *QQuickWindow)) {
 	if ptr.Pointer() != nil {
 		C.QQuickItem_ConnectWindowChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "windowChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "windowChanged", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectWindowChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickItem_DisconnectWindowChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "windowChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "windowChanged")
 	}
 }
 
@@ -2446,7 +2481,7 @@ func (ptr *QQuickItem) WindowChanged(window QQuickWindow_ITF) {
 
 //export callbackQQuickItem_DestroyQQuickItem
 func callbackQQuickItem_DestroyQQuickItem(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QQuickItem"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QQuickItem"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemFromPointer(ptr).DestroyQQuickItemDefault()
@@ -2456,21 +2491,21 @@ func callbackQQuickItem_DestroyQQuickItem(ptr unsafe.Pointer) {
 func (ptr *QQuickItem) ConnectDestroyQQuickItem(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickItem", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QQuickItem", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectDestroyQQuickItem() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickItem")
+		qt.DisconnectSignal(ptr.Pointer(), "~QQuickItem")
 	}
 }
 
 func (ptr *QQuickItem) DestroyQQuickItem() {
 	if ptr.Pointer() != nil {
 		C.QQuickItem_DestroyQQuickItem(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2478,7 +2513,7 @@ func (ptr *QQuickItem) DestroyQQuickItem() {
 func (ptr *QQuickItem) DestroyQQuickItemDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickItem_DestroyQQuickItemDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2569,7 +2604,7 @@ func (ptr *QQuickItem) MapToScene(point core.QPointF_ITF) *core.QPointF {
 func (ptr *QQuickItem) ChildAt(x float64, y float64) *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickItem_ChildAt(ptr.Pointer(), C.double(x), C.double(y)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2580,7 +2615,7 @@ func (ptr *QQuickItem) ChildAt(x float64, y float64) *QQuickItem {
 func (ptr *QQuickItem) ParentItem() *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickItem_ParentItem(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2591,7 +2626,7 @@ func (ptr *QQuickItem) ParentItem() *QQuickItem {
 func (ptr *QQuickItem) ScopedFocusItem() *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickItem_ScopedFocusItem(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2602,7 +2637,7 @@ func (ptr *QQuickItem) ScopedFocusItem() *QQuickItem {
 func (ptr *QQuickItem) Window() *QQuickWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickWindowFromPointer(C.QQuickItem_Window(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2648,7 +2683,7 @@ func (ptr *QQuickItem) MapRectToScene(rect core.QRectF_ITF) *core.QRectF {
 
 //export callbackQQuickItem_TextureProvider
 func callbackQQuickItem_TextureProvider(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureProvider"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureProvider"); signal != nil {
 		return PointerFromQSGTextureProvider(signal.(func() *QSGTextureProvider)())
 	}
 
@@ -2658,21 +2693,21 @@ func callbackQQuickItem_TextureProvider(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QQuickItem) ConnectTextureProvider(f func() *QSGTextureProvider) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureProvider", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureProvider", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectTextureProvider() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureProvider")
+		qt.DisconnectSignal(ptr.Pointer(), "textureProvider")
 	}
 }
 
 func (ptr *QQuickItem) TextureProvider() *QSGTextureProvider {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureProviderFromPointer(C.QQuickItem_TextureProvider(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2683,7 +2718,7 @@ func (ptr *QQuickItem) TextureProvider() *QSGTextureProvider {
 func (ptr *QQuickItem) TextureProviderDefault() *QSGTextureProvider {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureProviderFromPointer(C.QQuickItem_TextureProviderDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2700,7 +2735,7 @@ func (ptr *QQuickItem) State() string {
 
 //export callbackQQuickItem_InputMethodQuery
 func callbackQQuickItem_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -2710,14 +2745,14 @@ func callbackQQuickItem_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) u
 func (ptr *QQuickItem) ConnectInputMethodQuery(f func(query core.Qt__InputMethodQuery) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "inputMethodQuery", f)
+		qt.ConnectSignal(ptr.Pointer(), "inputMethodQuery", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectInputMethodQuery() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "inputMethodQuery")
+		qt.DisconnectSignal(ptr.Pointer(), "inputMethodQuery")
 	}
 }
 
@@ -2783,7 +2818,7 @@ func (ptr *QQuickItem) Clip() bool {
 
 //export callbackQQuickItem_Contains
 func callbackQQuickItem_Contains(ptr unsafe.Pointer, point unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contains"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contains"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QPointF) bool)(core.NewQPointFFromPointer(point)))))
 	}
 
@@ -2793,14 +2828,14 @@ func callbackQQuickItem_Contains(ptr unsafe.Pointer, point unsafe.Pointer) C.cha
 func (ptr *QQuickItem) ConnectContains(f func(point *core.QPointF) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contains", f)
+		qt.ConnectSignal(ptr.Pointer(), "contains", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectContains() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contains")
+		qt.DisconnectSignal(ptr.Pointer(), "contains")
 	}
 }
 
@@ -2876,7 +2911,7 @@ func (ptr *QQuickItem) IsFocusScope() bool {
 
 //export callbackQQuickItem_IsTextureProvider
 func callbackQQuickItem_IsTextureProvider(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isTextureProvider"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isTextureProvider"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2886,14 +2921,14 @@ func callbackQQuickItem_IsTextureProvider(ptr unsafe.Pointer) C.char {
 func (ptr *QQuickItem) ConnectIsTextureProvider(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isTextureProvider", f)
+		qt.ConnectSignal(ptr.Pointer(), "isTextureProvider", f)
 	}
 }
 
 func (ptr *QQuickItem) DisconnectIsTextureProvider() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isTextureProvider")
+		qt.DisconnectSignal(ptr.Pointer(), "isTextureProvider")
 	}
 }
 
@@ -3040,10 +3075,20 @@ func (ptr *QQuickItem) __grabTouchPoints_ids_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QQuickItem___grabTouchPoints_ids_newList(ptr.Pointer()))
 }
 
+func (ptr *QQuickItem) __grabTouchPoints_ids_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QQuickItem___grabTouchPoints_ids_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QQuickItem) __grabTouchPoints_ids_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QQuickItem___grabTouchPoints_ids_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QQuickItem) __childItems_atList(i int) *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickItem___childItems_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3083,7 +3128,7 @@ func (ptr *QQuickItem) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QQuickItem) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickItem___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3104,7 +3149,7 @@ func (ptr *QQuickItem) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QQuickItem) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickItem___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3125,7 +3170,7 @@ func (ptr *QQuickItem) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QQuickItem) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickItem___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3146,7 +3191,7 @@ func (ptr *QQuickItem) __findChildren_newList() unsafe.Pointer {
 func (ptr *QQuickItem) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickItem___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3166,7 +3211,7 @@ func (ptr *QQuickItem) __children_newList() unsafe.Pointer {
 
 //export callbackQQuickItem_EventFilter
 func callbackQQuickItem_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -3189,7 +3234,7 @@ func (ptr *QQuickItem) EventFilterDefault(watched core.QObject_ITF, event core.Q
 
 //export callbackQQuickItem_ChildEvent
 func callbackQQuickItem_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -3210,7 +3255,7 @@ func (ptr *QQuickItem) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQQuickItem_ConnectNotify
 func callbackQQuickItem_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickItemFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3231,7 +3276,7 @@ func (ptr *QQuickItem) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQQuickItem_CustomEvent
 func callbackQQuickItem_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -3252,7 +3297,7 @@ func (ptr *QQuickItem) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickItem_DeleteLater
 func callbackQQuickItem_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemFromPointer(ptr).DeleteLaterDefault()
@@ -3262,7 +3307,7 @@ func callbackQQuickItem_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QQuickItem) DeleteLater() {
 	if ptr.Pointer() != nil {
 		C.QQuickItem_DeleteLater(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3270,14 +3315,14 @@ func (ptr *QQuickItem) DeleteLater() {
 func (ptr *QQuickItem) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickItem_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickItem_Destroyed
 func callbackQQuickItem_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -3285,7 +3330,7 @@ func callbackQQuickItem_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQQuickItem_DisconnectNotify
 func callbackQQuickItem_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickItemFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3306,7 +3351,7 @@ func (ptr *QQuickItem) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQQuickItem_ObjectNameChanged
 func callbackQQuickItem_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -3314,7 +3359,7 @@ func callbackQQuickItem_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struc
 
 //export callbackQQuickItem_TimerEvent
 func callbackQQuickItem_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQQuickItemFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -3335,7 +3380,7 @@ func (ptr *QQuickItem) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQQuickItem_MetaObject
 func callbackQQuickItem_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -3398,7 +3443,7 @@ func NewQQuickItemGrabResultFromPointer(ptr unsafe.Pointer) *QQuickItemGrabResul
 func (ptr *QQuickItemGrabResult) DestroyQQuickItemGrabResult() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3414,7 +3459,7 @@ func (ptr *QQuickItemGrabResult) SaveToFile(fileName string) bool {
 
 //export callbackQQuickItemGrabResult_Ready
 func callbackQQuickItemGrabResult_Ready(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "ready"); signal != nil {
+	if signal := qt.GetSignal(ptr, "ready"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3423,14 +3468,14 @@ func callbackQQuickItemGrabResult_Ready(ptr unsafe.Pointer) {
 func (ptr *QQuickItemGrabResult) ConnectReady(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickItemGrabResult_ConnectReady(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "ready", f)
+		qt.ConnectSignal(ptr.Pointer(), "ready", f)
 	}
 }
 
 func (ptr *QQuickItemGrabResult) DisconnectReady() {
 	if ptr.Pointer() != nil {
 		C.QQuickItemGrabResult_DisconnectReady(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "ready")
+		qt.DisconnectSignal(ptr.Pointer(), "ready")
 	}
 }
 
@@ -3480,7 +3525,7 @@ func (ptr *QQuickItemGrabResult) __dynamicPropertyNames_newList() unsafe.Pointer
 func (ptr *QQuickItemGrabResult) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickItemGrabResult___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3501,7 +3546,7 @@ func (ptr *QQuickItemGrabResult) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QQuickItemGrabResult) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickItemGrabResult___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3522,7 +3567,7 @@ func (ptr *QQuickItemGrabResult) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QQuickItemGrabResult) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickItemGrabResult___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3543,7 +3588,7 @@ func (ptr *QQuickItemGrabResult) __findChildren_newList() unsafe.Pointer {
 func (ptr *QQuickItemGrabResult) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickItemGrabResult___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3563,7 +3608,7 @@ func (ptr *QQuickItemGrabResult) __children_newList() unsafe.Pointer {
 
 //export callbackQQuickItemGrabResult_Event
 func callbackQQuickItemGrabResult_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -3579,7 +3624,7 @@ func (ptr *QQuickItemGrabResult) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQQuickItemGrabResult_EventFilter
 func callbackQQuickItemGrabResult_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -3595,7 +3640,7 @@ func (ptr *QQuickItemGrabResult) EventFilterDefault(watched core.QObject_ITF, ev
 
 //export callbackQQuickItemGrabResult_ChildEvent
 func callbackQQuickItemGrabResult_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQQuickItemGrabResultFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -3610,7 +3655,7 @@ func (ptr *QQuickItemGrabResult) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQQuickItemGrabResult_ConnectNotify
 func callbackQQuickItemGrabResult_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickItemGrabResultFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3625,7 +3670,7 @@ func (ptr *QQuickItemGrabResult) ConnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQQuickItemGrabResult_CustomEvent
 func callbackQQuickItemGrabResult_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickItemGrabResultFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -3640,7 +3685,7 @@ func (ptr *QQuickItemGrabResult) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickItemGrabResult_DeleteLater
 func callbackQQuickItemGrabResult_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickItemGrabResultFromPointer(ptr).DeleteLaterDefault()
@@ -3650,14 +3695,14 @@ func callbackQQuickItemGrabResult_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QQuickItemGrabResult) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickItemGrabResult_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickItemGrabResult_Destroyed
 func callbackQQuickItemGrabResult_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -3665,7 +3710,7 @@ func callbackQQuickItemGrabResult_Destroyed(ptr unsafe.Pointer, obj unsafe.Point
 
 //export callbackQQuickItemGrabResult_DisconnectNotify
 func callbackQQuickItemGrabResult_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickItemGrabResultFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3680,7 +3725,7 @@ func (ptr *QQuickItemGrabResult) DisconnectNotifyDefault(sign core.QMetaMethod_I
 
 //export callbackQQuickItemGrabResult_ObjectNameChanged
 func callbackQQuickItemGrabResult_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -3688,7 +3733,7 @@ func callbackQQuickItemGrabResult_ObjectNameChanged(ptr unsafe.Pointer, objectNa
 
 //export callbackQQuickItemGrabResult_TimerEvent
 func callbackQQuickItemGrabResult_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQQuickItemGrabResultFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -3703,7 +3748,7 @@ func (ptr *QQuickItemGrabResult) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQQuickItemGrabResult_MetaObject
 func callbackQQuickItemGrabResult_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -3776,7 +3821,7 @@ const (
 
 func NewQQuickPaintedItem(parent QQuickItem_ITF) *QQuickPaintedItem {
 	var tmpValue = NewQQuickPaintedItemFromPointer(C.QQuickPaintedItem_NewQQuickPaintedItem(PointerFromQQuickItem(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3784,7 +3829,7 @@ func NewQQuickPaintedItem(parent QQuickItem_ITF) *QQuickPaintedItem {
 
 //export callbackQQuickPaintedItem_ContentsScaleChanged
 func callbackQQuickPaintedItem_ContentsScaleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentsScaleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentsScaleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3793,14 +3838,14 @@ func callbackQQuickPaintedItem_ContentsScaleChanged(ptr unsafe.Pointer) {
 func (ptr *QQuickPaintedItem) ConnectContentsScaleChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_ConnectContentsScaleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contentsScaleChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "contentsScaleChanged", f)
 	}
 }
 
 func (ptr *QQuickPaintedItem) DisconnectContentsScaleChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_DisconnectContentsScaleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contentsScaleChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "contentsScaleChanged")
 	}
 }
 
@@ -3812,7 +3857,7 @@ func (ptr *QQuickPaintedItem) ContentsScaleChanged() {
 
 //export callbackQQuickPaintedItem_ContentsSizeChanged
 func callbackQQuickPaintedItem_ContentsSizeChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentsSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentsSizeChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3821,14 +3866,14 @@ func callbackQQuickPaintedItem_ContentsSizeChanged(ptr unsafe.Pointer) {
 func (ptr *QQuickPaintedItem) ConnectContentsSizeChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_ConnectContentsSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contentsSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "contentsSizeChanged", f)
 	}
 }
 
 func (ptr *QQuickPaintedItem) DisconnectContentsSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_DisconnectContentsSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contentsSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "contentsSizeChanged")
 	}
 }
 
@@ -3840,7 +3885,7 @@ func (ptr *QQuickPaintedItem) ContentsSizeChanged() {
 
 //export callbackQQuickPaintedItem_FillColorChanged
 func callbackQQuickPaintedItem_FillColorChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fillColorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fillColorChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3849,14 +3894,14 @@ func callbackQQuickPaintedItem_FillColorChanged(ptr unsafe.Pointer) {
 func (ptr *QQuickPaintedItem) ConnectFillColorChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_ConnectFillColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fillColorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "fillColorChanged", f)
 	}
 }
 
 func (ptr *QQuickPaintedItem) DisconnectFillColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_DisconnectFillColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fillColorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "fillColorChanged")
 	}
 }
 
@@ -3868,7 +3913,7 @@ func (ptr *QQuickPaintedItem) FillColorChanged() {
 
 //export callbackQQuickPaintedItem_Paint
 func callbackQQuickPaintedItem_Paint(ptr unsafe.Pointer, painter unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paint"); signal != nil {
 		signal.(func(*gui.QPainter))(gui.NewQPainterFromPointer(painter))
 	}
 
@@ -3877,14 +3922,14 @@ func callbackQQuickPaintedItem_Paint(ptr unsafe.Pointer, painter unsafe.Pointer)
 func (ptr *QQuickPaintedItem) ConnectPaint(f func(painter *gui.QPainter)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paint", f)
+		qt.ConnectSignal(ptr.Pointer(), "paint", f)
 	}
 }
 
 func (ptr *QQuickPaintedItem) DisconnectPaint() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paint")
+		qt.DisconnectSignal(ptr.Pointer(), "paint")
 	}
 }
 
@@ -3896,7 +3941,7 @@ func (ptr *QQuickPaintedItem) Paint(painter gui.QPainter_ITF) {
 
 //export callbackQQuickPaintedItem_RenderTargetChanged
 func callbackQQuickPaintedItem_RenderTargetChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "renderTargetChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "renderTargetChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3905,14 +3950,14 @@ func callbackQQuickPaintedItem_RenderTargetChanged(ptr unsafe.Pointer) {
 func (ptr *QQuickPaintedItem) ConnectRenderTargetChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_ConnectRenderTargetChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "renderTargetChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "renderTargetChanged", f)
 	}
 }
 
 func (ptr *QQuickPaintedItem) DisconnectRenderTargetChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_DisconnectRenderTargetChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "renderTargetChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "renderTargetChanged")
 	}
 }
 
@@ -3978,7 +4023,7 @@ func (ptr *QQuickPaintedItem) SetTextureSize(size core.QSize_ITF) {
 
 //export callbackQQuickPaintedItem_TextureSizeChanged
 func callbackQQuickPaintedItem_TextureSizeChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureSizeChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3987,14 +4032,14 @@ func callbackQQuickPaintedItem_TextureSizeChanged(ptr unsafe.Pointer) {
 func (ptr *QQuickPaintedItem) ConnectTextureSizeChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_ConnectTextureSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureSizeChanged", f)
 	}
 }
 
 func (ptr *QQuickPaintedItem) DisconnectTextureSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_DisconnectTextureSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureSizeChanged")
 	}
 }
 
@@ -4012,7 +4057,7 @@ func (ptr *QQuickPaintedItem) Update(rect core.QRect_ITF) {
 
 //export callbackQQuickPaintedItem_DestroyQQuickPaintedItem
 func callbackQQuickPaintedItem_DestroyQQuickPaintedItem(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QQuickPaintedItem"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QQuickPaintedItem"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickPaintedItemFromPointer(ptr).DestroyQQuickPaintedItemDefault()
@@ -4022,21 +4067,21 @@ func callbackQQuickPaintedItem_DestroyQQuickPaintedItem(ptr unsafe.Pointer) {
 func (ptr *QQuickPaintedItem) ConnectDestroyQQuickPaintedItem(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickPaintedItem", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QQuickPaintedItem", f)
 	}
 }
 
 func (ptr *QQuickPaintedItem) DisconnectDestroyQQuickPaintedItem() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickPaintedItem")
+		qt.DisconnectSignal(ptr.Pointer(), "~QQuickPaintedItem")
 	}
 }
 
 func (ptr *QQuickPaintedItem) DestroyQQuickPaintedItem() {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_DestroyQQuickPaintedItem(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4044,7 +4089,7 @@ func (ptr *QQuickPaintedItem) DestroyQQuickPaintedItem() {
 func (ptr *QQuickPaintedItem) DestroyQQuickPaintedItemDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickPaintedItem_DestroyQQuickPaintedItemDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4160,7 +4205,7 @@ func (ptr *QQuickRenderControl) Grab() *gui.QImage {
 
 func NewQQuickRenderControl(parent core.QObject_ITF) *QQuickRenderControl {
 	var tmpValue = NewQQuickRenderControlFromPointer(C.QQuickRenderControl_NewQQuickRenderControl(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4168,7 +4213,7 @@ func NewQQuickRenderControl(parent core.QObject_ITF) *QQuickRenderControl {
 
 //export callbackQQuickRenderControl_RenderWindow
 func callbackQQuickRenderControl_RenderWindow(ptr unsafe.Pointer, offset unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "renderWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "renderWindow"); signal != nil {
 		return gui.PointerFromQWindow(signal.(func(*core.QPoint) *gui.QWindow)(core.NewQPointFromPointer(offset)))
 	}
 
@@ -4178,21 +4223,21 @@ func callbackQQuickRenderControl_RenderWindow(ptr unsafe.Pointer, offset unsafe.
 func (ptr *QQuickRenderControl) ConnectRenderWindow(f func(offset *core.QPoint) *gui.QWindow) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "renderWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "renderWindow", f)
 	}
 }
 
 func (ptr *QQuickRenderControl) DisconnectRenderWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "renderWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "renderWindow")
 	}
 }
 
 func (ptr *QQuickRenderControl) RenderWindow(offset core.QPoint_ITF) *gui.QWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = gui.NewQWindowFromPointer(C.QQuickRenderControl_RenderWindow(ptr.Pointer(), core.PointerFromQPoint(offset)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4203,7 +4248,7 @@ func (ptr *QQuickRenderControl) RenderWindow(offset core.QPoint_ITF) *gui.QWindo
 func (ptr *QQuickRenderControl) RenderWindowDefault(offset core.QPoint_ITF) *gui.QWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = gui.NewQWindowFromPointer(C.QQuickRenderControl_RenderWindowDefault(ptr.Pointer(), core.PointerFromQPoint(offset)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4213,7 +4258,7 @@ func (ptr *QQuickRenderControl) RenderWindowDefault(offset core.QPoint_ITF) *gui
 
 func QQuickRenderControl_RenderWindowFor(win QQuickWindow_ITF, offset core.QPoint_ITF) *gui.QWindow {
 	var tmpValue = gui.NewQWindowFromPointer(C.QQuickRenderControl_QQuickRenderControl_RenderWindowFor(PointerFromQQuickWindow(win), core.PointerFromQPoint(offset)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4221,7 +4266,7 @@ func QQuickRenderControl_RenderWindowFor(win QQuickWindow_ITF, offset core.QPoin
 
 func (ptr *QQuickRenderControl) RenderWindowFor(win QQuickWindow_ITF, offset core.QPoint_ITF) *gui.QWindow {
 	var tmpValue = gui.NewQWindowFromPointer(C.QQuickRenderControl_QQuickRenderControl_RenderWindowFor(PointerFromQQuickWindow(win), core.PointerFromQPoint(offset)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4266,7 +4311,7 @@ func (ptr *QQuickRenderControl) Render() {
 
 //export callbackQQuickRenderControl_RenderRequested
 func callbackQQuickRenderControl_RenderRequested(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "renderRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "renderRequested"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4275,14 +4320,14 @@ func callbackQQuickRenderControl_RenderRequested(ptr unsafe.Pointer) {
 func (ptr *QQuickRenderControl) ConnectRenderRequested(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickRenderControl_ConnectRenderRequested(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "renderRequested", f)
+		qt.ConnectSignal(ptr.Pointer(), "renderRequested", f)
 	}
 }
 
 func (ptr *QQuickRenderControl) DisconnectRenderRequested() {
 	if ptr.Pointer() != nil {
 		C.QQuickRenderControl_DisconnectRenderRequested(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "renderRequested")
+		qt.DisconnectSignal(ptr.Pointer(), "renderRequested")
 	}
 }
 
@@ -4294,7 +4339,7 @@ func (ptr *QQuickRenderControl) RenderRequested() {
 
 //export callbackQQuickRenderControl_SceneChanged
 func callbackQQuickRenderControl_SceneChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4303,14 +4348,14 @@ func callbackQQuickRenderControl_SceneChanged(ptr unsafe.Pointer) {
 func (ptr *QQuickRenderControl) ConnectSceneChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickRenderControl_ConnectSceneChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sceneChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sceneChanged", f)
 	}
 }
 
 func (ptr *QQuickRenderControl) DisconnectSceneChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickRenderControl_DisconnectSceneChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sceneChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sceneChanged")
 	}
 }
 
@@ -4323,7 +4368,7 @@ func (ptr *QQuickRenderControl) SceneChanged() {
 func (ptr *QQuickRenderControl) DestroyQQuickRenderControl() {
 	if ptr.Pointer() != nil {
 		C.QQuickRenderControl_DestroyQQuickRenderControl(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4350,7 +4395,7 @@ func (ptr *QQuickRenderControl) __dynamicPropertyNames_newList() unsafe.Pointer
 func (ptr *QQuickRenderControl) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickRenderControl___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4371,7 +4416,7 @@ func (ptr *QQuickRenderControl) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QQuickRenderControl) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickRenderControl___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4392,7 +4437,7 @@ func (ptr *QQuickRenderControl) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QQuickRenderControl) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickRenderControl___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4413,7 +4458,7 @@ func (ptr *QQuickRenderControl) __findChildren_newList() unsafe.Pointer {
 func (ptr *QQuickRenderControl) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickRenderControl___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4433,7 +4478,7 @@ func (ptr *QQuickRenderControl) __children_newList() unsafe.Pointer {
 
 //export callbackQQuickRenderControl_Event
 func callbackQQuickRenderControl_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -4449,7 +4494,7 @@ func (ptr *QQuickRenderControl) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQQuickRenderControl_EventFilter
 func callbackQQuickRenderControl_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -4465,7 +4510,7 @@ func (ptr *QQuickRenderControl) EventFilterDefault(watched core.QObject_ITF, eve
 
 //export callbackQQuickRenderControl_ChildEvent
 func callbackQQuickRenderControl_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQQuickRenderControlFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -4480,7 +4525,7 @@ func (ptr *QQuickRenderControl) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQQuickRenderControl_ConnectNotify
 func callbackQQuickRenderControl_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickRenderControlFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4495,7 +4540,7 @@ func (ptr *QQuickRenderControl) ConnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQQuickRenderControl_CustomEvent
 func callbackQQuickRenderControl_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickRenderControlFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -4510,7 +4555,7 @@ func (ptr *QQuickRenderControl) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickRenderControl_DeleteLater
 func callbackQQuickRenderControl_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickRenderControlFromPointer(ptr).DeleteLaterDefault()
@@ -4520,14 +4565,14 @@ func callbackQQuickRenderControl_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QQuickRenderControl) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickRenderControl_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickRenderControl_Destroyed
 func callbackQQuickRenderControl_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -4535,7 +4580,7 @@ func callbackQQuickRenderControl_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointe
 
 //export callbackQQuickRenderControl_DisconnectNotify
 func callbackQQuickRenderControl_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickRenderControlFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4550,7 +4595,7 @@ func (ptr *QQuickRenderControl) DisconnectNotifyDefault(sign core.QMetaMethod_IT
 
 //export callbackQQuickRenderControl_ObjectNameChanged
 func callbackQQuickRenderControl_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -4558,7 +4603,7 @@ func callbackQQuickRenderControl_ObjectNameChanged(ptr unsafe.Pointer, objectNam
 
 //export callbackQQuickRenderControl_TimerEvent
 func callbackQQuickRenderControl_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQQuickRenderControlFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -4573,7 +4618,7 @@ func (ptr *QQuickRenderControl) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQQuickRenderControl_MetaObject
 func callbackQQuickRenderControl_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -4629,14 +4674,14 @@ func NewQQuickTextDocumentFromPointer(ptr unsafe.Pointer) *QQuickTextDocument {
 func (ptr *QQuickTextDocument) DestroyQQuickTextDocument() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func NewQQuickTextDocument(parent QQuickItem_ITF) *QQuickTextDocument {
 	var tmpValue = NewQQuickTextDocumentFromPointer(C.QQuickTextDocument_NewQQuickTextDocument(PointerFromQQuickItem(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4645,7 +4690,7 @@ func NewQQuickTextDocument(parent QQuickItem_ITF) *QQuickTextDocument {
 func (ptr *QQuickTextDocument) TextDocument() *gui.QTextDocument {
 	if ptr.Pointer() != nil {
 		var tmpValue = gui.NewQTextDocumentFromPointer(C.QQuickTextDocument_TextDocument(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4675,7 +4720,7 @@ func (ptr *QQuickTextDocument) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QQuickTextDocument) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickTextDocument___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4696,7 +4741,7 @@ func (ptr *QQuickTextDocument) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QQuickTextDocument) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickTextDocument___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4717,7 +4762,7 @@ func (ptr *QQuickTextDocument) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QQuickTextDocument) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickTextDocument___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4738,7 +4783,7 @@ func (ptr *QQuickTextDocument) __findChildren_newList() unsafe.Pointer {
 func (ptr *QQuickTextDocument) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickTextDocument___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4758,7 +4803,7 @@ func (ptr *QQuickTextDocument) __children_newList() unsafe.Pointer {
 
 //export callbackQQuickTextDocument_Event
 func callbackQQuickTextDocument_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -4774,7 +4819,7 @@ func (ptr *QQuickTextDocument) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQQuickTextDocument_EventFilter
 func callbackQQuickTextDocument_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -4790,7 +4835,7 @@ func (ptr *QQuickTextDocument) EventFilterDefault(watched core.QObject_ITF, even
 
 //export callbackQQuickTextDocument_ChildEvent
 func callbackQQuickTextDocument_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQQuickTextDocumentFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -4805,7 +4850,7 @@ func (ptr *QQuickTextDocument) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQQuickTextDocument_ConnectNotify
 func callbackQQuickTextDocument_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickTextDocumentFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4820,7 +4865,7 @@ func (ptr *QQuickTextDocument) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQQuickTextDocument_CustomEvent
 func callbackQQuickTextDocument_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickTextDocumentFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -4835,7 +4880,7 @@ func (ptr *QQuickTextDocument) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickTextDocument_DeleteLater
 func callbackQQuickTextDocument_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickTextDocumentFromPointer(ptr).DeleteLaterDefault()
@@ -4845,14 +4890,14 @@ func callbackQQuickTextDocument_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QQuickTextDocument) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickTextDocument_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickTextDocument_Destroyed
 func callbackQQuickTextDocument_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -4860,7 +4905,7 @@ func callbackQQuickTextDocument_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer
 
 //export callbackQQuickTextDocument_DisconnectNotify
 func callbackQQuickTextDocument_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickTextDocumentFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4875,7 +4920,7 @@ func (ptr *QQuickTextDocument) DisconnectNotifyDefault(sign core.QMetaMethod_ITF
 
 //export callbackQQuickTextDocument_ObjectNameChanged
 func callbackQQuickTextDocument_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -4883,7 +4928,7 @@ func callbackQQuickTextDocument_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQQuickTextDocument_TimerEvent
 func callbackQQuickTextDocument_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQQuickTextDocumentFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -4898,7 +4943,7 @@ func (ptr *QQuickTextDocument) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQQuickTextDocument_MetaObject
 func callbackQQuickTextDocument_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -4952,7 +4997,7 @@ func NewQQuickTextureFactoryFromPointer(ptr unsafe.Pointer) *QQuickTextureFactor
 }
 func QQuickTextureFactory_TextureFactoryForImage(image gui.QImage_ITF) *QQuickTextureFactory {
 	var tmpValue = NewQQuickTextureFactoryFromPointer(C.QQuickTextureFactory_QQuickTextureFactory_TextureFactoryForImage(gui.PointerFromQImage(image)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4960,7 +5005,7 @@ func QQuickTextureFactory_TextureFactoryForImage(image gui.QImage_ITF) *QQuickTe
 
 func (ptr *QQuickTextureFactory) TextureFactoryForImage(image gui.QImage_ITF) *QQuickTextureFactory {
 	var tmpValue = NewQQuickTextureFactoryFromPointer(C.QQuickTextureFactory_QQuickTextureFactory_TextureFactoryForImage(gui.PointerFromQImage(image)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4968,7 +5013,7 @@ func (ptr *QQuickTextureFactory) TextureFactoryForImage(image gui.QImage_ITF) *Q
 
 func NewQQuickTextureFactory() *QQuickTextureFactory {
 	var tmpValue = NewQQuickTextureFactoryFromPointer(C.QQuickTextureFactory_NewQQuickTextureFactory())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4976,7 +5021,7 @@ func NewQQuickTextureFactory() *QQuickTextureFactory {
 
 //export callbackQQuickTextureFactory_DestroyQQuickTextureFactory
 func callbackQQuickTextureFactory_DestroyQQuickTextureFactory(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QQuickTextureFactory"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QQuickTextureFactory"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickTextureFactoryFromPointer(ptr).DestroyQQuickTextureFactoryDefault()
@@ -4986,21 +5031,21 @@ func callbackQQuickTextureFactory_DestroyQQuickTextureFactory(ptr unsafe.Pointer
 func (ptr *QQuickTextureFactory) ConnectDestroyQQuickTextureFactory(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickTextureFactory", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QQuickTextureFactory", f)
 	}
 }
 
 func (ptr *QQuickTextureFactory) DisconnectDestroyQQuickTextureFactory() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickTextureFactory")
+		qt.DisconnectSignal(ptr.Pointer(), "~QQuickTextureFactory")
 	}
 }
 
 func (ptr *QQuickTextureFactory) DestroyQQuickTextureFactory() {
 	if ptr.Pointer() != nil {
 		C.QQuickTextureFactory_DestroyQQuickTextureFactory(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5008,14 +5053,14 @@ func (ptr *QQuickTextureFactory) DestroyQQuickTextureFactory() {
 func (ptr *QQuickTextureFactory) DestroyQQuickTextureFactoryDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickTextureFactory_DestroyQQuickTextureFactoryDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickTextureFactory_Image
 func callbackQQuickTextureFactory_Image(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "image"); signal != nil {
+	if signal := qt.GetSignal(ptr, "image"); signal != nil {
 		return gui.PointerFromQImage(signal.(func() *gui.QImage)())
 	}
 
@@ -5025,14 +5070,14 @@ func callbackQQuickTextureFactory_Image(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QQuickTextureFactory) ConnectImage(f func() *gui.QImage) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "image", f)
+		qt.ConnectSignal(ptr.Pointer(), "image", f)
 	}
 }
 
 func (ptr *QQuickTextureFactory) DisconnectImage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "image")
+		qt.DisconnectSignal(ptr.Pointer(), "image")
 	}
 }
 
@@ -5056,7 +5101,7 @@ func (ptr *QQuickTextureFactory) ImageDefault() *gui.QImage {
 
 //export callbackQQuickTextureFactory_CreateTexture
 func callbackQQuickTextureFactory_CreateTexture(ptr unsafe.Pointer, window unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createTexture"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createTexture"); signal != nil {
 		return PointerFromQSGTexture(signal.(func(*QQuickWindow) *QSGTexture)(NewQQuickWindowFromPointer(window)))
 	}
 
@@ -5066,21 +5111,21 @@ func callbackQQuickTextureFactory_CreateTexture(ptr unsafe.Pointer, window unsaf
 func (ptr *QQuickTextureFactory) ConnectCreateTexture(f func(window *QQuickWindow) *QSGTexture) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createTexture", f)
+		qt.ConnectSignal(ptr.Pointer(), "createTexture", f)
 	}
 }
 
 func (ptr *QQuickTextureFactory) DisconnectCreateTexture() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createTexture")
+		qt.DisconnectSignal(ptr.Pointer(), "createTexture")
 	}
 }
 
 func (ptr *QQuickTextureFactory) CreateTexture(window QQuickWindow_ITF) *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QQuickTextureFactory_CreateTexture(ptr.Pointer(), PointerFromQQuickWindow(window)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5090,7 +5135,7 @@ func (ptr *QQuickTextureFactory) CreateTexture(window QQuickWindow_ITF) *QSGText
 
 //export callbackQQuickTextureFactory_TextureSize
 func callbackQQuickTextureFactory_TextureSize(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureSize"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -5100,14 +5145,14 @@ func callbackQQuickTextureFactory_TextureSize(ptr unsafe.Pointer) unsafe.Pointer
 func (ptr *QQuickTextureFactory) ConnectTextureSize(f func() *core.QSize) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureSize", f)
 	}
 }
 
 func (ptr *QQuickTextureFactory) DisconnectTextureSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureSize")
+		qt.DisconnectSignal(ptr.Pointer(), "textureSize")
 	}
 }
 
@@ -5122,7 +5167,7 @@ func (ptr *QQuickTextureFactory) TextureSize() *core.QSize {
 
 //export callbackQQuickTextureFactory_TextureByteCount
 func callbackQQuickTextureFactory_TextureByteCount(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureByteCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureByteCount"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -5132,14 +5177,14 @@ func callbackQQuickTextureFactory_TextureByteCount(ptr unsafe.Pointer) C.int {
 func (ptr *QQuickTextureFactory) ConnectTextureByteCount(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureByteCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureByteCount", f)
 	}
 }
 
 func (ptr *QQuickTextureFactory) DisconnectTextureByteCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureByteCount")
+		qt.DisconnectSignal(ptr.Pointer(), "textureByteCount")
 	}
 }
 
@@ -5172,7 +5217,7 @@ func (ptr *QQuickTextureFactory) __dynamicPropertyNames_newList() unsafe.Pointer
 func (ptr *QQuickTextureFactory) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickTextureFactory___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5193,7 +5238,7 @@ func (ptr *QQuickTextureFactory) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QQuickTextureFactory) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickTextureFactory___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5214,7 +5259,7 @@ func (ptr *QQuickTextureFactory) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QQuickTextureFactory) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickTextureFactory___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5235,7 +5280,7 @@ func (ptr *QQuickTextureFactory) __findChildren_newList() unsafe.Pointer {
 func (ptr *QQuickTextureFactory) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickTextureFactory___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5255,7 +5300,7 @@ func (ptr *QQuickTextureFactory) __children_newList() unsafe.Pointer {
 
 //export callbackQQuickTextureFactory_Event
 func callbackQQuickTextureFactory_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -5271,7 +5316,7 @@ func (ptr *QQuickTextureFactory) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQQuickTextureFactory_EventFilter
 func callbackQQuickTextureFactory_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -5287,7 +5332,7 @@ func (ptr *QQuickTextureFactory) EventFilterDefault(watched core.QObject_ITF, ev
 
 //export callbackQQuickTextureFactory_ChildEvent
 func callbackQQuickTextureFactory_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQQuickTextureFactoryFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -5302,7 +5347,7 @@ func (ptr *QQuickTextureFactory) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQQuickTextureFactory_ConnectNotify
 func callbackQQuickTextureFactory_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickTextureFactoryFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5317,7 +5362,7 @@ func (ptr *QQuickTextureFactory) ConnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQQuickTextureFactory_CustomEvent
 func callbackQQuickTextureFactory_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickTextureFactoryFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -5332,7 +5377,7 @@ func (ptr *QQuickTextureFactory) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickTextureFactory_DeleteLater
 func callbackQQuickTextureFactory_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickTextureFactoryFromPointer(ptr).DeleteLaterDefault()
@@ -5342,14 +5387,14 @@ func callbackQQuickTextureFactory_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QQuickTextureFactory) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickTextureFactory_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickTextureFactory_Destroyed
 func callbackQQuickTextureFactory_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -5357,7 +5402,7 @@ func callbackQQuickTextureFactory_Destroyed(ptr unsafe.Pointer, obj unsafe.Point
 
 //export callbackQQuickTextureFactory_DisconnectNotify
 func callbackQQuickTextureFactory_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickTextureFactoryFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5372,7 +5417,7 @@ func (ptr *QQuickTextureFactory) DisconnectNotifyDefault(sign core.QMetaMethod_I
 
 //export callbackQQuickTextureFactory_ObjectNameChanged
 func callbackQQuickTextureFactory_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -5380,7 +5425,7 @@ func callbackQQuickTextureFactory_ObjectNameChanged(ptr unsafe.Pointer, objectNa
 
 //export callbackQQuickTextureFactory_TimerEvent
 func callbackQQuickTextureFactory_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQQuickTextureFactoryFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -5395,7 +5440,7 @@ func (ptr *QQuickTextureFactory) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQQuickTextureFactory_MetaObject
 func callbackQQuickTextureFactory_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -5470,7 +5515,7 @@ const (
 
 func NewQQuickView2(engine qml.QQmlEngine_ITF, parent gui.QWindow_ITF) *QQuickView {
 	var tmpValue = NewQQuickViewFromPointer(C.QQuickView_NewQQuickView2(qml.PointerFromQQmlEngine(engine), gui.PointerFromQWindow(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5478,7 +5523,7 @@ func NewQQuickView2(engine qml.QQmlEngine_ITF, parent gui.QWindow_ITF) *QQuickVi
 
 func NewQQuickView(parent gui.QWindow_ITF) *QQuickView {
 	var tmpValue = NewQQuickViewFromPointer(C.QQuickView_NewQQuickView(gui.PointerFromQWindow(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5486,7 +5531,7 @@ func NewQQuickView(parent gui.QWindow_ITF) *QQuickView {
 
 func NewQQuickView3(source core.QUrl_ITF, parent gui.QWindow_ITF) *QQuickView {
 	var tmpValue = NewQQuickViewFromPointer(C.QQuickView_NewQQuickView3(core.PointerFromQUrl(source), gui.PointerFromQWindow(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5500,7 +5545,7 @@ func (ptr *QQuickView) SetResizeMode(vre QQuickView__ResizeMode) {
 
 //export callbackQQuickView_SetSource
 func callbackQQuickView_SetSource(ptr unsafe.Pointer, url unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSource"); signal != nil {
 		signal.(func(*core.QUrl))(core.NewQUrlFromPointer(url))
 	} else {
 		NewQQuickViewFromPointer(ptr).SetSourceDefault(core.NewQUrlFromPointer(url))
@@ -5510,14 +5555,14 @@ func callbackQQuickView_SetSource(ptr unsafe.Pointer, url unsafe.Pointer) {
 func (ptr *QQuickView) ConnectSetSource(f func(url *core.QUrl)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSource", f)
 	}
 }
 
 func (ptr *QQuickView) DisconnectSetSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSource")
+		qt.DisconnectSignal(ptr.Pointer(), "setSource")
 	}
 }
 
@@ -5535,7 +5580,7 @@ func (ptr *QQuickView) SetSourceDefault(url core.QUrl_ITF) {
 
 //export callbackQQuickView_StatusChanged
 func callbackQQuickView_StatusChanged(ptr unsafe.Pointer, status C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "statusChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "statusChanged"); signal != nil {
 		signal.(func(QQuickView__Status))(QQuickView__Status(status))
 	}
 
@@ -5544,14 +5589,14 @@ func callbackQQuickView_StatusChanged(ptr unsafe.Pointer, status C.longlong) {
 func (ptr *QQuickView) ConnectStatusChanged(f func(status QQuickView__Status)) {
 	if ptr.Pointer() != nil {
 		C.QQuickView_ConnectStatusChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "statusChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "statusChanged", f)
 	}
 }
 
 func (ptr *QQuickView) DisconnectStatusChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickView_DisconnectStatusChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "statusChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "statusChanged")
 	}
 }
 
@@ -5563,7 +5608,7 @@ func (ptr *QQuickView) StatusChanged(status QQuickView__Status) {
 
 //export callbackQQuickView_DestroyQQuickView
 func callbackQQuickView_DestroyQQuickView(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QQuickView"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QQuickView"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickViewFromPointer(ptr).DestroyQQuickViewDefault()
@@ -5573,21 +5618,21 @@ func callbackQQuickView_DestroyQQuickView(ptr unsafe.Pointer) {
 func (ptr *QQuickView) ConnectDestroyQQuickView(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickView", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QQuickView", f)
 	}
 }
 
 func (ptr *QQuickView) DisconnectDestroyQQuickView() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickView")
+		qt.DisconnectSignal(ptr.Pointer(), "~QQuickView")
 	}
 }
 
 func (ptr *QQuickView) DestroyQQuickView() {
 	if ptr.Pointer() != nil {
 		C.QQuickView_DestroyQQuickView(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5595,7 +5640,7 @@ func (ptr *QQuickView) DestroyQQuickView() {
 func (ptr *QQuickView) DestroyQQuickViewDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickView_DestroyQQuickViewDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5616,7 +5661,7 @@ func (ptr *QQuickView) Errors() []*qml.QQmlError {
 func (ptr *QQuickView) RootContext() *qml.QQmlContext {
 	if ptr.Pointer() != nil {
 		var tmpValue = qml.NewQQmlContextFromPointer(C.QQuickView_RootContext(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5627,7 +5672,7 @@ func (ptr *QQuickView) RootContext() *qml.QQmlContext {
 func (ptr *QQuickView) Engine() *qml.QQmlEngine {
 	if ptr.Pointer() != nil {
 		var tmpValue = qml.NewQQmlEngineFromPointer(C.QQuickView_Engine(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5638,7 +5683,7 @@ func (ptr *QQuickView) Engine() *qml.QQmlEngine {
 func (ptr *QQuickView) RootObject() *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickView_RootObject(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5758,7 +5803,7 @@ const (
 
 func NewQQuickWidget2(engine qml.QQmlEngine_ITF, parent widgets.QWidget_ITF) *QQuickWidget {
 	var tmpValue = NewQQuickWidgetFromPointer(C.QQuickWidget_NewQQuickWidget2(qml.PointerFromQQmlEngine(engine), widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5766,7 +5811,7 @@ func NewQQuickWidget2(engine qml.QQmlEngine_ITF, parent widgets.QWidget_ITF) *QQ
 
 func NewQQuickWidget(parent widgets.QWidget_ITF) *QQuickWidget {
 	var tmpValue = NewQQuickWidgetFromPointer(C.QQuickWidget_NewQQuickWidget(widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5774,7 +5819,7 @@ func NewQQuickWidget(parent widgets.QWidget_ITF) *QQuickWidget {
 
 func NewQQuickWidget3(source core.QUrl_ITF, parent widgets.QWidget_ITF) *QQuickWidget {
 	var tmpValue = NewQQuickWidgetFromPointer(C.QQuickWidget_NewQQuickWidget3(core.PointerFromQUrl(source), widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5782,7 +5827,7 @@ func NewQQuickWidget3(source core.QUrl_ITF, parent widgets.QWidget_ITF) *QQuickW
 
 //export callbackQQuickWidget_SceneGraphError
 func callbackQQuickWidget_SceneGraphError(ptr unsafe.Pointer, error C.longlong, message C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneGraphError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneGraphError"); signal != nil {
 		signal.(func(QQuickWindow__SceneGraphError, string))(QQuickWindow__SceneGraphError(error), cGoUnpackString(message))
 	}
 
@@ -5791,14 +5836,14 @@ func callbackQQuickWidget_SceneGraphError(ptr unsafe.Pointer, error C.longlong,
 func (ptr *QQuickWidget) ConnectSceneGraphError(f func(error QQuickWindow__SceneGraphError, message string)) {
 	if ptr.Pointer() != nil {
 		C.QQuickWidget_ConnectSceneGraphError(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphError", f)
+		qt.ConnectSignal(ptr.Pointer(), "sceneGraphError", f)
 	}
 }
 
 func (ptr *QQuickWidget) DisconnectSceneGraphError() {
 	if ptr.Pointer() != nil {
 		C.QQuickWidget_DisconnectSceneGraphError(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphError")
+		qt.DisconnectSignal(ptr.Pointer(), "sceneGraphError")
 	}
 }
 
@@ -5830,7 +5875,7 @@ func (ptr *QQuickWidget) SetResizeMode(vre QQuickWidget__ResizeMode) {
 
 //export callbackQQuickWidget_SetSource
 func callbackQQuickWidget_SetSource(ptr unsafe.Pointer, url unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSource"); signal != nil {
 		signal.(func(*core.QUrl))(core.NewQUrlFromPointer(url))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).SetSourceDefault(core.NewQUrlFromPointer(url))
@@ -5840,14 +5885,14 @@ func callbackQQuickWidget_SetSource(ptr unsafe.Pointer, url unsafe.Pointer) {
 func (ptr *QQuickWidget) ConnectSetSource(f func(url *core.QUrl)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSource", f)
 	}
 }
 
 func (ptr *QQuickWidget) DisconnectSetSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSource")
+		qt.DisconnectSignal(ptr.Pointer(), "setSource")
 	}
 }
 
@@ -5865,7 +5910,7 @@ func (ptr *QQuickWidget) SetSourceDefault(url core.QUrl_ITF) {
 
 //export callbackQQuickWidget_StatusChanged
 func callbackQQuickWidget_StatusChanged(ptr unsafe.Pointer, status C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "statusChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "statusChanged"); signal != nil {
 		signal.(func(QQuickWidget__Status))(QQuickWidget__Status(status))
 	}
 
@@ -5874,14 +5919,14 @@ func callbackQQuickWidget_StatusChanged(ptr unsafe.Pointer, status C.longlong) {
 func (ptr *QQuickWidget) ConnectStatusChanged(f func(status QQuickWidget__Status)) {
 	if ptr.Pointer() != nil {
 		C.QQuickWidget_ConnectStatusChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "statusChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "statusChanged", f)
 	}
 }
 
 func (ptr *QQuickWidget) DisconnectStatusChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickWidget_DisconnectStatusChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "statusChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "statusChanged")
 	}
 }
 
@@ -5893,7 +5938,7 @@ func (ptr *QQuickWidget) StatusChanged(status QQuickWidget__Status) {
 
 //export callbackQQuickWidget_DestroyQQuickWidget
 func callbackQQuickWidget_DestroyQQuickWidget(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QQuickWidget"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QQuickWidget"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).DestroyQQuickWidgetDefault()
@@ -5903,21 +5948,21 @@ func callbackQQuickWidget_DestroyQQuickWidget(ptr unsafe.Pointer) {
 func (ptr *QQuickWidget) ConnectDestroyQQuickWidget(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickWidget", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QQuickWidget", f)
 	}
 }
 
 func (ptr *QQuickWidget) DisconnectDestroyQQuickWidget() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickWidget")
+		qt.DisconnectSignal(ptr.Pointer(), "~QQuickWidget")
 	}
 }
 
 func (ptr *QQuickWidget) DestroyQQuickWidget() {
 	if ptr.Pointer() != nil {
 		C.QQuickWidget_DestroyQQuickWidget(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5925,7 +5970,7 @@ func (ptr *QQuickWidget) DestroyQQuickWidget() {
 func (ptr *QQuickWidget) DestroyQQuickWidgetDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickWidget_DestroyQQuickWidgetDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5955,7 +6000,7 @@ func (ptr *QQuickWidget) Errors() []*qml.QQmlError {
 func (ptr *QQuickWidget) RootContext() *qml.QQmlContext {
 	if ptr.Pointer() != nil {
 		var tmpValue = qml.NewQQmlContextFromPointer(C.QQuickWidget_RootContext(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5966,7 +6011,7 @@ func (ptr *QQuickWidget) RootContext() *qml.QQmlContext {
 func (ptr *QQuickWidget) Engine() *qml.QQmlEngine {
 	if ptr.Pointer() != nil {
 		var tmpValue = qml.NewQQmlEngineFromPointer(C.QQuickWidget_Engine(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5977,7 +6022,7 @@ func (ptr *QQuickWidget) Engine() *qml.QQmlEngine {
 func (ptr *QQuickWidget) RootObject() *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickWidget_RootObject(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5988,7 +6033,7 @@ func (ptr *QQuickWidget) RootObject() *QQuickItem {
 func (ptr *QQuickWidget) QuickWindow() *QQuickWindow {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickWindowFromPointer(C.QQuickWidget_QuickWindow(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6059,7 +6104,7 @@ func (ptr *QQuickWidget) __errors_newList() unsafe.Pointer {
 func (ptr *QQuickWidget) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QQuickWidget___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6080,7 +6125,7 @@ func (ptr *QQuickWidget) __addActions_actions_newList() unsafe.Pointer {
 func (ptr *QQuickWidget) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QQuickWidget___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6101,7 +6146,7 @@ func (ptr *QQuickWidget) __insertActions_actions_newList() unsafe.Pointer {
 func (ptr *QQuickWidget) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QQuickWidget___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6141,7 +6186,7 @@ func (ptr *QQuickWidget) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QQuickWidget) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickWidget___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6162,7 +6207,7 @@ func (ptr *QQuickWidget) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QQuickWidget) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickWidget___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6183,7 +6228,7 @@ func (ptr *QQuickWidget) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QQuickWidget) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickWidget___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6204,7 +6249,7 @@ func (ptr *QQuickWidget) __findChildren_newList() unsafe.Pointer {
 func (ptr *QQuickWidget) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickWidget___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6224,7 +6269,7 @@ func (ptr *QQuickWidget) __children_newList() unsafe.Pointer {
 
 //export callbackQQuickWidget_Close
 func callbackQQuickWidget_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6240,7 +6285,7 @@ func (ptr *QQuickWidget) CloseDefault() bool {
 
 //export callbackQQuickWidget_Event
 func callbackQQuickWidget_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -6256,7 +6301,7 @@ func (ptr *QQuickWidget) EventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQQuickWidget_FocusNextPrevChild
 func callbackQQuickWidget_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -6272,7 +6317,7 @@ func (ptr *QQuickWidget) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQQuickWidget_NativeEvent
 func callbackQQuickWidget_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -6288,7 +6333,7 @@ func (ptr *QQuickWidget) NativeEventDefault(eventType core.QByteArray_ITF, messa
 
 //export callbackQQuickWidget_ActionEvent
 func callbackQQuickWidget_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -6303,7 +6348,7 @@ func (ptr *QQuickWidget) ActionEventDefault(event gui.QActionEvent_ITF) {
 
 //export callbackQQuickWidget_ChangeEvent
 func callbackQQuickWidget_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -6318,7 +6363,7 @@ func (ptr *QQuickWidget) ChangeEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickWidget_CloseEvent
 func callbackQQuickWidget_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -6333,7 +6378,7 @@ func (ptr *QQuickWidget) CloseEventDefault(event gui.QCloseEvent_ITF) {
 
 //export callbackQQuickWidget_ContextMenuEvent
 func callbackQQuickWidget_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -6348,7 +6393,7 @@ func (ptr *QQuickWidget) ContextMenuEventDefault(event gui.QContextMenuEvent_ITF
 
 //export callbackQQuickWidget_CustomContextMenuRequested
 func callbackQQuickWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -6356,7 +6401,7 @@ func callbackQQuickWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos uns
 
 //export callbackQQuickWidget_DragEnterEvent
 func callbackQQuickWidget_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -6371,7 +6416,7 @@ func (ptr *QQuickWidget) DragEnterEventDefault(event gui.QDragEnterEvent_ITF) {
 
 //export callbackQQuickWidget_DragLeaveEvent
 func callbackQQuickWidget_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -6386,7 +6431,7 @@ func (ptr *QQuickWidget) DragLeaveEventDefault(event gui.QDragLeaveEvent_ITF) {
 
 //export callbackQQuickWidget_DragMoveEvent
 func callbackQQuickWidget_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -6401,7 +6446,7 @@ func (ptr *QQuickWidget) DragMoveEventDefault(event gui.QDragMoveEvent_ITF) {
 
 //export callbackQQuickWidget_DropEvent
 func callbackQQuickWidget_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -6416,7 +6461,7 @@ func (ptr *QQuickWidget) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQQuickWidget_EnterEvent
 func callbackQQuickWidget_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -6431,7 +6476,7 @@ func (ptr *QQuickWidget) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickWidget_FocusInEvent
 func callbackQQuickWidget_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -6446,7 +6491,7 @@ func (ptr *QQuickWidget) FocusInEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQQuickWidget_FocusOutEvent
 func callbackQQuickWidget_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -6461,7 +6506,7 @@ func (ptr *QQuickWidget) FocusOutEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQQuickWidget_Hide
 func callbackQQuickWidget_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).HideDefault()
@@ -6476,7 +6521,7 @@ func (ptr *QQuickWidget) HideDefault() {
 
 //export callbackQQuickWidget_HideEvent
 func callbackQQuickWidget_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -6491,7 +6536,7 @@ func (ptr *QQuickWidget) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQQuickWidget_InputMethodEvent
 func callbackQQuickWidget_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -6506,7 +6551,7 @@ func (ptr *QQuickWidget) InputMethodEventDefault(event gui.QInputMethodEvent_ITF
 
 //export callbackQQuickWidget_KeyPressEvent
 func callbackQQuickWidget_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -6521,7 +6566,7 @@ func (ptr *QQuickWidget) KeyPressEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQQuickWidget_KeyReleaseEvent
 func callbackQQuickWidget_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -6536,7 +6581,7 @@ func (ptr *QQuickWidget) KeyReleaseEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQQuickWidget_LeaveEvent
 func callbackQQuickWidget_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -6551,7 +6596,7 @@ func (ptr *QQuickWidget) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickWidget_Lower
 func callbackQQuickWidget_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).LowerDefault()
@@ -6566,7 +6611,7 @@ func (ptr *QQuickWidget) LowerDefault() {
 
 //export callbackQQuickWidget_MouseDoubleClickEvent
 func callbackQQuickWidget_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6581,7 +6626,7 @@ func (ptr *QQuickWidget) MouseDoubleClickEventDefault(event gui.QMouseEvent_ITF)
 
 //export callbackQQuickWidget_MouseMoveEvent
 func callbackQQuickWidget_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6596,7 +6641,7 @@ func (ptr *QQuickWidget) MouseMoveEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickWidget_MousePressEvent
 func callbackQQuickWidget_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6611,7 +6656,7 @@ func (ptr *QQuickWidget) MousePressEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickWidget_MouseReleaseEvent
 func callbackQQuickWidget_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -6626,7 +6671,7 @@ func (ptr *QQuickWidget) MouseReleaseEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickWidget_MoveEvent
 func callbackQQuickWidget_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -6641,7 +6686,7 @@ func (ptr *QQuickWidget) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQQuickWidget_PaintEvent
 func callbackQQuickWidget_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -6656,7 +6701,7 @@ func (ptr *QQuickWidget) PaintEventDefault(event gui.QPaintEvent_ITF) {
 
 //export callbackQQuickWidget_Raise
 func callbackQQuickWidget_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).RaiseDefault()
@@ -6671,7 +6716,7 @@ func (ptr *QQuickWidget) RaiseDefault() {
 
 //export callbackQQuickWidget_Repaint
 func callbackQQuickWidget_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).RepaintDefault()
@@ -6686,7 +6731,7 @@ func (ptr *QQuickWidget) RepaintDefault() {
 
 //export callbackQQuickWidget_ResizeEvent
 func callbackQQuickWidget_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -6701,7 +6746,7 @@ func (ptr *QQuickWidget) ResizeEventDefault(event gui.QResizeEvent_ITF) {
 
 //export callbackQQuickWidget_SetDisabled
 func callbackQQuickWidget_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQQuickWidgetFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -6716,7 +6761,7 @@ func (ptr *QQuickWidget) SetDisabledDefault(disable bool) {
 
 //export callbackQQuickWidget_SetEnabled
 func callbackQQuickWidget_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQQuickWidgetFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -6731,7 +6776,7 @@ func (ptr *QQuickWidget) SetEnabledDefault(vbo bool) {
 
 //export callbackQQuickWidget_SetFocus2
 func callbackQQuickWidget_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).SetFocus2Default()
@@ -6746,7 +6791,7 @@ func (ptr *QQuickWidget) SetFocus2Default() {
 
 //export callbackQQuickWidget_SetHidden
 func callbackQQuickWidget_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQQuickWidgetFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -6761,7 +6806,7 @@ func (ptr *QQuickWidget) SetHiddenDefault(hidden bool) {
 
 //export callbackQQuickWidget_SetStyleSheet
 func callbackQQuickWidget_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -6778,7 +6823,7 @@ func (ptr *QQuickWidget) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQQuickWidget_SetVisible
 func callbackQQuickWidget_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQQuickWidgetFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -6793,7 +6838,7 @@ func (ptr *QQuickWidget) SetVisibleDefault(visible bool) {
 
 //export callbackQQuickWidget_SetWindowModified
 func callbackQQuickWidget_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQQuickWidgetFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -6808,7 +6853,7 @@ func (ptr *QQuickWidget) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQQuickWidget_SetWindowTitle
 func callbackQQuickWidget_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -6825,7 +6870,7 @@ func (ptr *QQuickWidget) SetWindowTitleDefault(vqs string) {
 
 //export callbackQQuickWidget_Show
 func callbackQQuickWidget_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ShowDefault()
@@ -6840,7 +6885,7 @@ func (ptr *QQuickWidget) ShowDefault() {
 
 //export callbackQQuickWidget_ShowEvent
 func callbackQQuickWidget_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -6855,7 +6900,7 @@ func (ptr *QQuickWidget) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQQuickWidget_ShowFullScreen
 func callbackQQuickWidget_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ShowFullScreenDefault()
@@ -6870,7 +6915,7 @@ func (ptr *QQuickWidget) ShowFullScreenDefault() {
 
 //export callbackQQuickWidget_ShowMaximized
 func callbackQQuickWidget_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ShowMaximizedDefault()
@@ -6885,7 +6930,7 @@ func (ptr *QQuickWidget) ShowMaximizedDefault() {
 
 //export callbackQQuickWidget_ShowMinimized
 func callbackQQuickWidget_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ShowMinimizedDefault()
@@ -6900,7 +6945,7 @@ func (ptr *QQuickWidget) ShowMinimizedDefault() {
 
 //export callbackQQuickWidget_ShowNormal
 func callbackQQuickWidget_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ShowNormalDefault()
@@ -6915,7 +6960,7 @@ func (ptr *QQuickWidget) ShowNormalDefault() {
 
 //export callbackQQuickWidget_TabletEvent
 func callbackQQuickWidget_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -6930,7 +6975,7 @@ func (ptr *QQuickWidget) TabletEventDefault(event gui.QTabletEvent_ITF) {
 
 //export callbackQQuickWidget_Update
 func callbackQQuickWidget_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).UpdateDefault()
@@ -6945,7 +6990,7 @@ func (ptr *QQuickWidget) UpdateDefault() {
 
 //export callbackQQuickWidget_UpdateMicroFocus
 func callbackQQuickWidget_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).UpdateMicroFocusDefault()
@@ -6960,7 +7005,7 @@ func (ptr *QQuickWidget) UpdateMicroFocusDefault() {
 
 //export callbackQQuickWidget_WheelEvent
 func callbackQQuickWidget_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -6975,7 +7020,7 @@ func (ptr *QQuickWidget) WheelEventDefault(event gui.QWheelEvent_ITF) {
 
 //export callbackQQuickWidget_WindowIconChanged
 func callbackQQuickWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -6983,7 +7028,7 @@ func callbackQQuickWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Poin
 
 //export callbackQQuickWidget_WindowTitleChanged
 func callbackQQuickWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -6991,7 +7036,7 @@ func callbackQQuickWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_
 
 //export callbackQQuickWidget_PaintEngine
 func callbackQQuickWidget_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -7007,7 +7052,7 @@ func (ptr *QQuickWidget) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQQuickWidget_MinimumSizeHint
 func callbackQQuickWidget_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -7025,7 +7070,7 @@ func (ptr *QQuickWidget) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQQuickWidget_SizeHint
 func callbackQQuickWidget_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -7043,7 +7088,7 @@ func (ptr *QQuickWidget) SizeHintDefault() *core.QSize {
 
 //export callbackQQuickWidget_InputMethodQuery
 func callbackQQuickWidget_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -7061,7 +7106,7 @@ func (ptr *QQuickWidget) InputMethodQueryDefault(query core.Qt__InputMethodQuery
 
 //export callbackQQuickWidget_HasHeightForWidth
 func callbackQQuickWidget_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -7077,7 +7122,7 @@ func (ptr *QQuickWidget) HasHeightForWidthDefault() bool {
 
 //export callbackQQuickWidget_HeightForWidth
 func callbackQQuickWidget_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -7093,7 +7138,7 @@ func (ptr *QQuickWidget) HeightForWidthDefault(w int) int {
 
 //export callbackQQuickWidget_Metric
 func callbackQQuickWidget_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -7109,7 +7154,7 @@ func (ptr *QQuickWidget) MetricDefault(m gui.QPaintDevice__PaintDeviceMetric) in
 
 //export callbackQQuickWidget_EventFilter
 func callbackQQuickWidget_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -7125,7 +7170,7 @@ func (ptr *QQuickWidget) EventFilterDefault(watched core.QObject_ITF, event core
 
 //export callbackQQuickWidget_ChildEvent
 func callbackQQuickWidget_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -7140,7 +7185,7 @@ func (ptr *QQuickWidget) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQQuickWidget_ConnectNotify
 func callbackQQuickWidget_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7155,7 +7200,7 @@ func (ptr *QQuickWidget) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQQuickWidget_CustomEvent
 func callbackQQuickWidget_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -7170,7 +7215,7 @@ func (ptr *QQuickWidget) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickWidget_DeleteLater
 func callbackQQuickWidget_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWidgetFromPointer(ptr).DeleteLaterDefault()
@@ -7180,14 +7225,14 @@ func callbackQQuickWidget_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QQuickWidget) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickWidget_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickWidget_Destroyed
 func callbackQQuickWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -7195,7 +7240,7 @@ func callbackQQuickWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQQuickWidget_DisconnectNotify
 func callbackQQuickWidget_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7210,7 +7255,7 @@ func (ptr *QQuickWidget) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQQuickWidget_ObjectNameChanged
 func callbackQQuickWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -7218,7 +7263,7 @@ func callbackQQuickWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C.str
 
 //export callbackQQuickWidget_TimerEvent
 func callbackQQuickWidget_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQQuickWidgetFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -7233,7 +7278,7 @@ func (ptr *QQuickWidget) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQQuickWidget_MetaObject
 func callbackQQuickWidget_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -7330,7 +7375,7 @@ func (ptr *QQuickWindow) GrabWindow() *gui.QImage {
 
 func NewQQuickWindow(parent gui.QWindow_ITF) *QQuickWindow {
 	var tmpValue = NewQQuickWindowFromPointer(C.QQuickWindow_NewQQuickWindow(gui.PointerFromQWindow(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -7338,7 +7383,7 @@ func NewQQuickWindow(parent gui.QWindow_ITF) *QQuickWindow {
 
 //export callbackQQuickWindow_Event
 func callbackQQuickWindow_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -7362,7 +7407,7 @@ func (ptr *QQuickWindow) HasDefaultAlphaBuffer() bool {
 
 //export callbackQQuickWindow_ActiveFocusItemChanged
 func callbackQQuickWindow_ActiveFocusItemChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeFocusItemChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeFocusItemChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7371,14 +7416,14 @@ func callbackQQuickWindow_ActiveFocusItemChanged(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectActiveFocusItemChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectActiveFocusItemChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeFocusItemChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeFocusItemChanged", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectActiveFocusItemChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectActiveFocusItemChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeFocusItemChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "activeFocusItemChanged")
 	}
 }
 
@@ -7390,7 +7435,7 @@ func (ptr *QQuickWindow) ActiveFocusItemChanged() {
 
 //export callbackQQuickWindow_AfterAnimating
 func callbackQQuickWindow_AfterAnimating(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "afterAnimating"); signal != nil {
+	if signal := qt.GetSignal(ptr, "afterAnimating"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7399,14 +7444,14 @@ func callbackQQuickWindow_AfterAnimating(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectAfterAnimating(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectAfterAnimating(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "afterAnimating", f)
+		qt.ConnectSignal(ptr.Pointer(), "afterAnimating", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectAfterAnimating() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectAfterAnimating(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "afterAnimating")
+		qt.DisconnectSignal(ptr.Pointer(), "afterAnimating")
 	}
 }
 
@@ -7418,7 +7463,7 @@ func (ptr *QQuickWindow) AfterAnimating() {
 
 //export callbackQQuickWindow_AfterRendering
 func callbackQQuickWindow_AfterRendering(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "afterRendering"); signal != nil {
+	if signal := qt.GetSignal(ptr, "afterRendering"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7427,14 +7472,14 @@ func callbackQQuickWindow_AfterRendering(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectAfterRendering(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectAfterRendering(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "afterRendering", f)
+		qt.ConnectSignal(ptr.Pointer(), "afterRendering", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectAfterRendering() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectAfterRendering(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "afterRendering")
+		qt.DisconnectSignal(ptr.Pointer(), "afterRendering")
 	}
 }
 
@@ -7446,7 +7491,7 @@ func (ptr *QQuickWindow) AfterRendering() {
 
 //export callbackQQuickWindow_AfterSynchronizing
 func callbackQQuickWindow_AfterSynchronizing(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "afterSynchronizing"); signal != nil {
+	if signal := qt.GetSignal(ptr, "afterSynchronizing"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7455,14 +7500,14 @@ func callbackQQuickWindow_AfterSynchronizing(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectAfterSynchronizing(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectAfterSynchronizing(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "afterSynchronizing", f)
+		qt.ConnectSignal(ptr.Pointer(), "afterSynchronizing", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectAfterSynchronizing() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectAfterSynchronizing(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "afterSynchronizing")
+		qt.DisconnectSignal(ptr.Pointer(), "afterSynchronizing")
 	}
 }
 
@@ -7474,7 +7519,7 @@ func (ptr *QQuickWindow) AfterSynchronizing() {
 
 //export callbackQQuickWindow_BeforeRendering
 func callbackQQuickWindow_BeforeRendering(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "beforeRendering"); signal != nil {
+	if signal := qt.GetSignal(ptr, "beforeRendering"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7483,14 +7528,14 @@ func callbackQQuickWindow_BeforeRendering(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectBeforeRendering(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectBeforeRendering(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "beforeRendering", f)
+		qt.ConnectSignal(ptr.Pointer(), "beforeRendering", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectBeforeRendering() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectBeforeRendering(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "beforeRendering")
+		qt.DisconnectSignal(ptr.Pointer(), "beforeRendering")
 	}
 }
 
@@ -7502,7 +7547,7 @@ func (ptr *QQuickWindow) BeforeRendering() {
 
 //export callbackQQuickWindow_BeforeSynchronizing
 func callbackQQuickWindow_BeforeSynchronizing(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "beforeSynchronizing"); signal != nil {
+	if signal := qt.GetSignal(ptr, "beforeSynchronizing"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7511,14 +7556,14 @@ func callbackQQuickWindow_BeforeSynchronizing(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectBeforeSynchronizing(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectBeforeSynchronizing(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "beforeSynchronizing", f)
+		qt.ConnectSignal(ptr.Pointer(), "beforeSynchronizing", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectBeforeSynchronizing() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectBeforeSynchronizing(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "beforeSynchronizing")
+		qt.DisconnectSignal(ptr.Pointer(), "beforeSynchronizing")
 	}
 }
 
@@ -7530,7 +7575,7 @@ func (ptr *QQuickWindow) BeforeSynchronizing() {
 
 //export callbackQQuickWindow_ColorChanged
 func callbackQQuickWindow_ColorChanged(ptr unsafe.Pointer, vqc unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "colorChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "colorChanged"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(vqc))
 	}
 
@@ -7539,14 +7584,14 @@ func callbackQQuickWindow_ColorChanged(ptr unsafe.Pointer, vqc unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectColorChanged(f func(vqc *gui.QColor)) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectColorChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "colorChanged", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectColorChanged() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectColorChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "colorChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "colorChanged")
 	}
 }
 
@@ -7558,7 +7603,7 @@ func (ptr *QQuickWindow) ColorChanged(vqc gui.QColor_ITF) {
 
 //export callbackQQuickWindow_ExposeEvent
 func callbackQQuickWindow_ExposeEvent(ptr unsafe.Pointer, vqe unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "exposeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "exposeEvent"); signal != nil {
 		signal.(func(*gui.QExposeEvent))(gui.NewQExposeEventFromPointer(vqe))
 	} else {
 		NewQQuickWindowFromPointer(ptr).ExposeEventDefault(gui.NewQExposeEventFromPointer(vqe))
@@ -7573,7 +7618,7 @@ func (ptr *QQuickWindow) ExposeEventDefault(vqe gui.QExposeEvent_ITF) {
 
 //export callbackQQuickWindow_FocusInEvent
 func callbackQQuickWindow_FocusInEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(ev))
 	} else {
 		NewQQuickWindowFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(ev))
@@ -7588,7 +7633,7 @@ func (ptr *QQuickWindow) FocusInEventDefault(ev gui.QFocusEvent_ITF) {
 
 //export callbackQQuickWindow_FocusOutEvent
 func callbackQQuickWindow_FocusOutEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(ev))
 	} else {
 		NewQQuickWindowFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(ev))
@@ -7603,7 +7648,7 @@ func (ptr *QQuickWindow) FocusOutEventDefault(ev gui.QFocusEvent_ITF) {
 
 //export callbackQQuickWindow_FrameSwapped
 func callbackQQuickWindow_FrameSwapped(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "frameSwapped"); signal != nil {
+	if signal := qt.GetSignal(ptr, "frameSwapped"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7612,14 +7657,14 @@ func callbackQQuickWindow_FrameSwapped(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectFrameSwapped(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectFrameSwapped(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "frameSwapped", f)
+		qt.ConnectSignal(ptr.Pointer(), "frameSwapped", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectFrameSwapped() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectFrameSwapped(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "frameSwapped")
+		qt.DisconnectSignal(ptr.Pointer(), "frameSwapped")
 	}
 }
 
@@ -7631,7 +7676,7 @@ func (ptr *QQuickWindow) FrameSwapped() {
 
 //export callbackQQuickWindow_HideEvent
 func callbackQQuickWindow_HideEvent(ptr unsafe.Pointer, vqh unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(vqh))
 	} else {
 		NewQQuickWindowFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(vqh))
@@ -7646,7 +7691,7 @@ func (ptr *QQuickWindow) HideEventDefault(vqh gui.QHideEvent_ITF) {
 
 //export callbackQQuickWindow_KeyPressEvent
 func callbackQQuickWindow_KeyPressEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(e))
 	} else {
 		NewQQuickWindowFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(e))
@@ -7661,7 +7706,7 @@ func (ptr *QQuickWindow) KeyPressEventDefault(e gui.QKeyEvent_ITF) {
 
 //export callbackQQuickWindow_KeyReleaseEvent
 func callbackQQuickWindow_KeyReleaseEvent(ptr unsafe.Pointer, e unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(e))
 	} else {
 		NewQQuickWindowFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(e))
@@ -7676,7 +7721,7 @@ func (ptr *QQuickWindow) KeyReleaseEventDefault(e gui.QKeyEvent_ITF) {
 
 //export callbackQQuickWindow_MouseDoubleClickEvent
 func callbackQQuickWindow_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickWindowFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -7691,7 +7736,7 @@ func (ptr *QQuickWindow) MouseDoubleClickEventDefault(event gui.QMouseEvent_ITF)
 
 //export callbackQQuickWindow_MouseMoveEvent
 func callbackQQuickWindow_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickWindowFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -7706,7 +7751,7 @@ func (ptr *QQuickWindow) MouseMoveEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickWindow_MousePressEvent
 func callbackQQuickWindow_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickWindowFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -7721,7 +7766,7 @@ func (ptr *QQuickWindow) MousePressEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickWindow_MouseReleaseEvent
 func callbackQQuickWindow_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQQuickWindowFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -7736,7 +7781,7 @@ func (ptr *QQuickWindow) MouseReleaseEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQQuickWindow_OpenglContextCreated
 func callbackQQuickWindow_OpenglContextCreated(ptr unsafe.Pointer, context unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "openglContextCreated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "openglContextCreated"); signal != nil {
 		signal.(func(*gui.QOpenGLContext))(gui.NewQOpenGLContextFromPointer(context))
 	}
 
@@ -7745,14 +7790,14 @@ func callbackQQuickWindow_OpenglContextCreated(ptr unsafe.Pointer, context unsaf
 func (ptr *QQuickWindow) ConnectOpenglContextCreated(f func(context *gui.QOpenGLContext)) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectOpenglContextCreated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "openglContextCreated", f)
+		qt.ConnectSignal(ptr.Pointer(), "openglContextCreated", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectOpenglContextCreated() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectOpenglContextCreated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "openglContextCreated")
+		qt.DisconnectSignal(ptr.Pointer(), "openglContextCreated")
 	}
 }
 
@@ -7764,7 +7809,7 @@ func (ptr *QQuickWindow) OpenglContextCreated(context gui.QOpenGLContext_ITF) {
 
 //export callbackQQuickWindow_ReleaseResources
 func callbackQQuickWindow_ReleaseResources(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "releaseResources"); signal != nil {
+	if signal := qt.GetSignal(ptr, "releaseResources"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).ReleaseResourcesDefault()
@@ -7774,14 +7819,14 @@ func callbackQQuickWindow_ReleaseResources(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectReleaseResources(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "releaseResources", f)
+		qt.ConnectSignal(ptr.Pointer(), "releaseResources", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectReleaseResources() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "releaseResources")
+		qt.DisconnectSignal(ptr.Pointer(), "releaseResources")
 	}
 }
 
@@ -7805,7 +7850,7 @@ func (ptr *QQuickWindow) ResetOpenGLState() {
 
 //export callbackQQuickWindow_ResizeEvent
 func callbackQQuickWindow_ResizeEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(ev))
 	} else {
 		NewQQuickWindowFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(ev))
@@ -7820,7 +7865,7 @@ func (ptr *QQuickWindow) ResizeEventDefault(ev gui.QResizeEvent_ITF) {
 
 //export callbackQQuickWindow_SceneGraphAboutToStop
 func callbackQQuickWindow_SceneGraphAboutToStop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneGraphAboutToStop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneGraphAboutToStop"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7829,14 +7874,14 @@ func callbackQQuickWindow_SceneGraphAboutToStop(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectSceneGraphAboutToStop(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectSceneGraphAboutToStop(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphAboutToStop", f)
+		qt.ConnectSignal(ptr.Pointer(), "sceneGraphAboutToStop", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectSceneGraphAboutToStop() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectSceneGraphAboutToStop(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphAboutToStop")
+		qt.DisconnectSignal(ptr.Pointer(), "sceneGraphAboutToStop")
 	}
 }
 
@@ -7848,7 +7893,7 @@ func (ptr *QQuickWindow) SceneGraphAboutToStop() {
 
 //export callbackQQuickWindow_SceneGraphError
 func callbackQQuickWindow_SceneGraphError(ptr unsafe.Pointer, error C.longlong, message C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneGraphError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneGraphError"); signal != nil {
 		signal.(func(QQuickWindow__SceneGraphError, string))(QQuickWindow__SceneGraphError(error), cGoUnpackString(message))
 	}
 
@@ -7857,14 +7902,14 @@ func callbackQQuickWindow_SceneGraphError(ptr unsafe.Pointer, error C.longlong,
 func (ptr *QQuickWindow) ConnectSceneGraphError(f func(error QQuickWindow__SceneGraphError, message string)) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectSceneGraphError(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphError", f)
+		qt.ConnectSignal(ptr.Pointer(), "sceneGraphError", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectSceneGraphError() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectSceneGraphError(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphError")
+		qt.DisconnectSignal(ptr.Pointer(), "sceneGraphError")
 	}
 }
 
@@ -7878,7 +7923,7 @@ func (ptr *QQuickWindow) SceneGraphError(error QQuickWindow__SceneGraphError, me
 
 //export callbackQQuickWindow_SceneGraphInitialized
 func callbackQQuickWindow_SceneGraphInitialized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneGraphInitialized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneGraphInitialized"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7887,14 +7932,14 @@ func callbackQQuickWindow_SceneGraphInitialized(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectSceneGraphInitialized(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectSceneGraphInitialized(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphInitialized", f)
+		qt.ConnectSignal(ptr.Pointer(), "sceneGraphInitialized", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectSceneGraphInitialized() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectSceneGraphInitialized(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphInitialized")
+		qt.DisconnectSignal(ptr.Pointer(), "sceneGraphInitialized")
 	}
 }
 
@@ -7906,7 +7951,7 @@ func (ptr *QQuickWindow) SceneGraphInitialized() {
 
 //export callbackQQuickWindow_SceneGraphInvalidated
 func callbackQQuickWindow_SceneGraphInvalidated(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneGraphInvalidated"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneGraphInvalidated"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7915,14 +7960,14 @@ func callbackQQuickWindow_SceneGraphInvalidated(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectSceneGraphInvalidated(f func()) {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_ConnectSceneGraphInvalidated(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphInvalidated", f)
+		qt.ConnectSignal(ptr.Pointer(), "sceneGraphInvalidated", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectSceneGraphInvalidated() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DisconnectSceneGraphInvalidated(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphInvalidated")
+		qt.DisconnectSignal(ptr.Pointer(), "sceneGraphInvalidated")
 	}
 }
 
@@ -8004,7 +8049,7 @@ func (ptr *QQuickWindow) SetSceneGraphBackend2(backend string) {
 
 //export callbackQQuickWindow_ShowEvent
 func callbackQQuickWindow_ShowEvent(ptr unsafe.Pointer, vqs unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(vqs))
 	} else {
 		NewQQuickWindowFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(vqs))
@@ -8019,7 +8064,7 @@ func (ptr *QQuickWindow) ShowEventDefault(vqs gui.QShowEvent_ITF) {
 
 //export callbackQQuickWindow_Update
 func callbackQQuickWindow_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).UpdateDefault()
@@ -8029,14 +8074,14 @@ func callbackQQuickWindow_Update(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectUpdate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "update", f)
+		qt.ConnectSignal(ptr.Pointer(), "update", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectUpdate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "update")
+		qt.DisconnectSignal(ptr.Pointer(), "update")
 	}
 }
 
@@ -8054,7 +8099,7 @@ func (ptr *QQuickWindow) UpdateDefault() {
 
 //export callbackQQuickWindow_WheelEvent
 func callbackQQuickWindow_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQQuickWindowFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -8069,7 +8114,7 @@ func (ptr *QQuickWindow) WheelEventDefault(event gui.QWheelEvent_ITF) {
 
 //export callbackQQuickWindow_DestroyQQuickWindow
 func callbackQQuickWindow_DestroyQQuickWindow(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QQuickWindow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QQuickWindow"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).DestroyQQuickWindowDefault()
@@ -8079,21 +8124,21 @@ func callbackQQuickWindow_DestroyQQuickWindow(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) ConnectDestroyQQuickWindow(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickWindow", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QQuickWindow", f)
 	}
 }
 
 func (ptr *QQuickWindow) DisconnectDestroyQQuickWindow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QQuickWindow")
+		qt.DisconnectSignal(ptr.Pointer(), "~QQuickWindow")
 	}
 }
 
 func (ptr *QQuickWindow) DestroyQQuickWindow() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DestroyQQuickWindow(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8101,7 +8146,7 @@ func (ptr *QQuickWindow) DestroyQQuickWindow() {
 func (ptr *QQuickWindow) DestroyQQuickWindowDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DestroyQQuickWindowDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8125,7 +8170,7 @@ func (ptr *QQuickWindow) Color() *gui.QColor {
 func (ptr *QQuickWindow) OpenglContext() *gui.QOpenGLContext {
 	if ptr.Pointer() != nil {
 		var tmpValue = gui.NewQOpenGLContextFromPointer(C.QQuickWindow_OpenglContext(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8150,7 +8195,7 @@ func (ptr *QQuickWindow) IncubationController() *qml.QQmlIncubationController {
 func (ptr *QQuickWindow) ActiveFocusItem() *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickWindow_ActiveFocusItem(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8161,7 +8206,7 @@ func (ptr *QQuickWindow) ActiveFocusItem() *QQuickItem {
 func (ptr *QQuickWindow) ContentItem() *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickWindow_ContentItem(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8172,7 +8217,7 @@ func (ptr *QQuickWindow) ContentItem() *QQuickItem {
 func (ptr *QQuickWindow) MouseGrabberItem() *QQuickItem {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQQuickItemFromPointer(C.QQuickWindow_MouseGrabberItem(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8204,7 +8249,7 @@ func (ptr *QQuickWindow) RendererInterface() *QSGRendererInterface {
 func (ptr *QQuickWindow) CreateTextureFromId(id uint, size core.QSize_ITF, options QQuickWindow__CreateTextureOption) *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QQuickWindow_CreateTextureFromId(ptr.Pointer(), C.uint(uint32(id)), core.PointerFromQSize(size), C.longlong(options)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8215,7 +8260,7 @@ func (ptr *QQuickWindow) CreateTextureFromId(id uint, size core.QSize_ITF, optio
 func (ptr *QQuickWindow) CreateTextureFromImage2(image gui.QImage_ITF) *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QQuickWindow_CreateTextureFromImage2(ptr.Pointer(), gui.PointerFromQImage(image)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8226,7 +8271,7 @@ func (ptr *QQuickWindow) CreateTextureFromImage2(image gui.QImage_ITF) *QSGTextu
 func (ptr *QQuickWindow) CreateTextureFromImage(image gui.QImage_ITF, options QQuickWindow__CreateTextureOption) *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QQuickWindow_CreateTextureFromImage(ptr.Pointer(), gui.PointerFromQImage(image), C.longlong(options)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8307,7 +8352,7 @@ func (ptr *QQuickWindow) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QQuickWindow) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickWindow___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8328,7 +8373,7 @@ func (ptr *QQuickWindow) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QQuickWindow) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickWindow___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8349,7 +8394,7 @@ func (ptr *QQuickWindow) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QQuickWindow) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickWindow___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8370,7 +8415,7 @@ func (ptr *QQuickWindow) __findChildren_newList() unsafe.Pointer {
 func (ptr *QQuickWindow) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickWindow___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8390,7 +8435,7 @@ func (ptr *QQuickWindow) __children_newList() unsafe.Pointer {
 
 //export callbackQQuickWindow_Close
 func callbackQQuickWindow_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -8406,7 +8451,7 @@ func (ptr *QQuickWindow) CloseDefault() bool {
 
 //export callbackQQuickWindow_NativeEvent
 func callbackQQuickWindow_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -8422,7 +8467,7 @@ func (ptr *QQuickWindow) NativeEventDefault(eventType core.QByteArray_ITF, messa
 
 //export callbackQQuickWindow_ActiveChanged
 func callbackQQuickWindow_ActiveChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -8430,7 +8475,7 @@ func callbackQQuickWindow_ActiveChanged(ptr unsafe.Pointer) {
 
 //export callbackQQuickWindow_Alert
 func callbackQQuickWindow_Alert(ptr unsafe.Pointer, msec C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "alert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "alert"); signal != nil {
 		signal.(func(int))(int(int32(msec)))
 	} else {
 		NewQQuickWindowFromPointer(ptr).AlertDefault(int(int32(msec)))
@@ -8445,7 +8490,7 @@ func (ptr *QQuickWindow) AlertDefault(msec int) {
 
 //export callbackQQuickWindow_ContentOrientationChanged
 func callbackQQuickWindow_ContentOrientationChanged(ptr unsafe.Pointer, orientation C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentOrientationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentOrientationChanged"); signal != nil {
 		signal.(func(core.Qt__ScreenOrientation))(core.Qt__ScreenOrientation(orientation))
 	}
 
@@ -8453,7 +8498,7 @@ func callbackQQuickWindow_ContentOrientationChanged(ptr unsafe.Pointer, orientat
 
 //export callbackQQuickWindow_FocusObjectChanged
 func callbackQQuickWindow_FocusObjectChanged(ptr unsafe.Pointer, object unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusObjectChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusObjectChanged"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(object))
 	}
 
@@ -8461,7 +8506,7 @@ func callbackQQuickWindow_FocusObjectChanged(ptr unsafe.Pointer, object unsafe.P
 
 //export callbackQQuickWindow_HeightChanged
 func callbackQQuickWindow_HeightChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -8469,7 +8514,7 @@ func callbackQQuickWindow_HeightChanged(ptr unsafe.Pointer, arg C.int) {
 
 //export callbackQQuickWindow_Hide
 func callbackQQuickWindow_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).HideDefault()
@@ -8484,7 +8529,7 @@ func (ptr *QQuickWindow) HideDefault() {
 
 //export callbackQQuickWindow_Lower
 func callbackQQuickWindow_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).LowerDefault()
@@ -8499,7 +8544,7 @@ func (ptr *QQuickWindow) LowerDefault() {
 
 //export callbackQQuickWindow_MaximumHeightChanged
 func callbackQQuickWindow_MaximumHeightChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maximumHeightChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maximumHeightChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -8507,7 +8552,7 @@ func callbackQQuickWindow_MaximumHeightChanged(ptr unsafe.Pointer, arg C.int) {
 
 //export callbackQQuickWindow_MaximumWidthChanged
 func callbackQQuickWindow_MaximumWidthChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maximumWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maximumWidthChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -8515,7 +8560,7 @@ func callbackQQuickWindow_MaximumWidthChanged(ptr unsafe.Pointer, arg C.int) {
 
 //export callbackQQuickWindow_MinimumHeightChanged
 func callbackQQuickWindow_MinimumHeightChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumHeightChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumHeightChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -8523,7 +8568,7 @@ func callbackQQuickWindow_MinimumHeightChanged(ptr unsafe.Pointer, arg C.int) {
 
 //export callbackQQuickWindow_MinimumWidthChanged
 func callbackQQuickWindow_MinimumWidthChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumWidthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumWidthChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -8531,7 +8576,7 @@ func callbackQQuickWindow_MinimumWidthChanged(ptr unsafe.Pointer, arg C.int) {
 
 //export callbackQQuickWindow_ModalityChanged
 func callbackQQuickWindow_ModalityChanged(ptr unsafe.Pointer, modality C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modalityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modalityChanged"); signal != nil {
 		signal.(func(core.Qt__WindowModality))(core.Qt__WindowModality(modality))
 	}
 
@@ -8539,7 +8584,7 @@ func callbackQQuickWindow_ModalityChanged(ptr unsafe.Pointer, modality C.longlon
 
 //export callbackQQuickWindow_MoveEvent
 func callbackQQuickWindow_MoveEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(ev))
 	} else {
 		NewQQuickWindowFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(ev))
@@ -8554,7 +8599,7 @@ func (ptr *QQuickWindow) MoveEventDefault(ev gui.QMoveEvent_ITF) {
 
 //export callbackQQuickWindow_OpacityChanged
 func callbackQQuickWindow_OpacityChanged(ptr unsafe.Pointer, opacity C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "opacityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "opacityChanged"); signal != nil {
 		signal.(func(float64))(float64(opacity))
 	}
 
@@ -8562,7 +8607,7 @@ func callbackQQuickWindow_OpacityChanged(ptr unsafe.Pointer, opacity C.double) {
 
 //export callbackQQuickWindow_Raise
 func callbackQQuickWindow_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).RaiseDefault()
@@ -8577,7 +8622,7 @@ func (ptr *QQuickWindow) RaiseDefault() {
 
 //export callbackQQuickWindow_RequestActivate
 func callbackQQuickWindow_RequestActivate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestActivate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestActivate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).RequestActivateDefault()
@@ -8592,7 +8637,7 @@ func (ptr *QQuickWindow) RequestActivateDefault() {
 
 //export callbackQQuickWindow_RequestUpdate
 func callbackQQuickWindow_RequestUpdate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestUpdate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestUpdate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).RequestUpdateDefault()
@@ -8607,7 +8652,7 @@ func (ptr *QQuickWindow) RequestUpdateDefault() {
 
 //export callbackQQuickWindow_ScreenChanged
 func callbackQQuickWindow_ScreenChanged(ptr unsafe.Pointer, screen unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "screenChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "screenChanged"); signal != nil {
 		signal.(func(*gui.QScreen))(gui.NewQScreenFromPointer(screen))
 	}
 
@@ -8615,7 +8660,7 @@ func callbackQQuickWindow_ScreenChanged(ptr unsafe.Pointer, screen unsafe.Pointe
 
 //export callbackQQuickWindow_SetHeight
 func callbackQQuickWindow_SetHeight(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHeight"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHeight"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetHeightDefault(int(int32(arg)))
@@ -8630,7 +8675,7 @@ func (ptr *QQuickWindow) SetHeightDefault(arg int) {
 
 //export callbackQQuickWindow_SetMaximumHeight
 func callbackQQuickWindow_SetMaximumHeight(ptr unsafe.Pointer, h C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMaximumHeight"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMaximumHeight"); signal != nil {
 		signal.(func(int))(int(int32(h)))
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetMaximumHeightDefault(int(int32(h)))
@@ -8645,7 +8690,7 @@ func (ptr *QQuickWindow) SetMaximumHeightDefault(h int) {
 
 //export callbackQQuickWindow_SetMaximumWidth
 func callbackQQuickWindow_SetMaximumWidth(ptr unsafe.Pointer, w C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMaximumWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMaximumWidth"); signal != nil {
 		signal.(func(int))(int(int32(w)))
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetMaximumWidthDefault(int(int32(w)))
@@ -8660,7 +8705,7 @@ func (ptr *QQuickWindow) SetMaximumWidthDefault(w int) {
 
 //export callbackQQuickWindow_SetMinimumHeight
 func callbackQQuickWindow_SetMinimumHeight(ptr unsafe.Pointer, h C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMinimumHeight"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMinimumHeight"); signal != nil {
 		signal.(func(int))(int(int32(h)))
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetMinimumHeightDefault(int(int32(h)))
@@ -8675,7 +8720,7 @@ func (ptr *QQuickWindow) SetMinimumHeightDefault(h int) {
 
 //export callbackQQuickWindow_SetMinimumWidth
 func callbackQQuickWindow_SetMinimumWidth(ptr unsafe.Pointer, w C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMinimumWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMinimumWidth"); signal != nil {
 		signal.(func(int))(int(int32(w)))
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetMinimumWidthDefault(int(int32(w)))
@@ -8690,7 +8735,7 @@ func (ptr *QQuickWindow) SetMinimumWidthDefault(w int) {
 
 //export callbackQQuickWindow_SetTitle
 func callbackQQuickWindow_SetTitle(ptr unsafe.Pointer, vqs C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetTitleDefault(cGoUnpackString(vqs))
@@ -8707,7 +8752,7 @@ func (ptr *QQuickWindow) SetTitleDefault(vqs string) {
 
 //export callbackQQuickWindow_SetVisible
 func callbackQQuickWindow_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -8722,7 +8767,7 @@ func (ptr *QQuickWindow) SetVisibleDefault(visible bool) {
 
 //export callbackQQuickWindow_SetWidth
 func callbackQQuickWindow_SetWidth(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWidth"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetWidthDefault(int(int32(arg)))
@@ -8737,7 +8782,7 @@ func (ptr *QQuickWindow) SetWidthDefault(arg int) {
 
 //export callbackQQuickWindow_SetX
 func callbackQQuickWindow_SetX(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setX"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setX"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetXDefault(int(int32(arg)))
@@ -8752,7 +8797,7 @@ func (ptr *QQuickWindow) SetXDefault(arg int) {
 
 //export callbackQQuickWindow_SetY
 func callbackQQuickWindow_SetY(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setY"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setY"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	} else {
 		NewQQuickWindowFromPointer(ptr).SetYDefault(int(int32(arg)))
@@ -8767,7 +8812,7 @@ func (ptr *QQuickWindow) SetYDefault(arg int) {
 
 //export callbackQQuickWindow_Show
 func callbackQQuickWindow_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).ShowDefault()
@@ -8782,7 +8827,7 @@ func (ptr *QQuickWindow) ShowDefault() {
 
 //export callbackQQuickWindow_ShowFullScreen
 func callbackQQuickWindow_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).ShowFullScreenDefault()
@@ -8797,7 +8842,7 @@ func (ptr *QQuickWindow) ShowFullScreenDefault() {
 
 //export callbackQQuickWindow_ShowMaximized
 func callbackQQuickWindow_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).ShowMaximizedDefault()
@@ -8812,7 +8857,7 @@ func (ptr *QQuickWindow) ShowMaximizedDefault() {
 
 //export callbackQQuickWindow_ShowMinimized
 func callbackQQuickWindow_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).ShowMinimizedDefault()
@@ -8827,7 +8872,7 @@ func (ptr *QQuickWindow) ShowMinimizedDefault() {
 
 //export callbackQQuickWindow_ShowNormal
 func callbackQQuickWindow_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).ShowNormalDefault()
@@ -8842,7 +8887,7 @@ func (ptr *QQuickWindow) ShowNormalDefault() {
 
 //export callbackQQuickWindow_TabletEvent
 func callbackQQuickWindow_TabletEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(ev))
 	} else {
 		NewQQuickWindowFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(ev))
@@ -8857,7 +8902,7 @@ func (ptr *QQuickWindow) TabletEventDefault(ev gui.QTabletEvent_ITF) {
 
 //export callbackQQuickWindow_TouchEvent
 func callbackQQuickWindow_TouchEvent(ptr unsafe.Pointer, ev unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "touchEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "touchEvent"); signal != nil {
 		signal.(func(*gui.QTouchEvent))(gui.NewQTouchEventFromPointer(ev))
 	} else {
 		NewQQuickWindowFromPointer(ptr).TouchEventDefault(gui.NewQTouchEventFromPointer(ev))
@@ -8872,7 +8917,7 @@ func (ptr *QQuickWindow) TouchEventDefault(ev gui.QTouchEvent_ITF) {
 
 //export callbackQQuickWindow_VisibilityChanged
 func callbackQQuickWindow_VisibilityChanged(ptr unsafe.Pointer, visibility C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibilityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibilityChanged"); signal != nil {
 		signal.(func(gui.QWindow__Visibility))(gui.QWindow__Visibility(visibility))
 	}
 
@@ -8880,7 +8925,7 @@ func callbackQQuickWindow_VisibilityChanged(ptr unsafe.Pointer, visibility C.lon
 
 //export callbackQQuickWindow_VisibleChanged
 func callbackQQuickWindow_VisibleChanged(ptr unsafe.Pointer, arg C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibleChanged"); signal != nil {
 		signal.(func(bool))(int8(arg) != 0)
 	}
 
@@ -8888,7 +8933,7 @@ func callbackQQuickWindow_VisibleChanged(ptr unsafe.Pointer, arg C.char) {
 
 //export callbackQQuickWindow_WidthChanged
 func callbackQQuickWindow_WidthChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "widthChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "widthChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -8896,7 +8941,7 @@ func callbackQQuickWindow_WidthChanged(ptr unsafe.Pointer, arg C.int) {
 
 //export callbackQQuickWindow_WindowStateChanged
 func callbackQQuickWindow_WindowStateChanged(ptr unsafe.Pointer, windowState C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowStateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowStateChanged"); signal != nil {
 		signal.(func(core.Qt__WindowState))(core.Qt__WindowState(windowState))
 	}
 
@@ -8904,7 +8949,7 @@ func callbackQQuickWindow_WindowStateChanged(ptr unsafe.Pointer, windowState C.l
 
 //export callbackQQuickWindow_WindowTitleChanged
 func callbackQQuickWindow_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -8912,7 +8957,7 @@ func callbackQQuickWindow_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_
 
 //export callbackQQuickWindow_XChanged
 func callbackQQuickWindow_XChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -8920,7 +8965,7 @@ func callbackQQuickWindow_XChanged(ptr unsafe.Pointer, arg C.int) {
 
 //export callbackQQuickWindow_YChanged
 func callbackQQuickWindow_YChanged(ptr unsafe.Pointer, arg C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yChanged"); signal != nil {
 		signal.(func(int))(int(int32(arg)))
 	}
 
@@ -8928,7 +8973,7 @@ func callbackQQuickWindow_YChanged(ptr unsafe.Pointer, arg C.int) {
 
 //export callbackQQuickWindow_FocusObject
 func callbackQQuickWindow_FocusObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusObject"); signal != nil {
 		return core.PointerFromQObject(signal.(func() *core.QObject)())
 	}
 
@@ -8938,7 +8983,7 @@ func callbackQQuickWindow_FocusObject(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QQuickWindow) FocusObjectDefault() *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QQuickWindow_FocusObjectDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8948,7 +8993,7 @@ func (ptr *QQuickWindow) FocusObjectDefault() *core.QObject {
 
 //export callbackQQuickWindow_Size
 func callbackQQuickWindow_Size(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -8966,7 +9011,7 @@ func (ptr *QQuickWindow) SizeDefault() *core.QSize {
 
 //export callbackQQuickWindow_Format
 func callbackQQuickWindow_Format(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "format"); signal != nil {
+	if signal := qt.GetSignal(ptr, "format"); signal != nil {
 		return gui.PointerFromQSurfaceFormat(signal.(func() *gui.QSurfaceFormat)())
 	}
 
@@ -8984,7 +9029,7 @@ func (ptr *QQuickWindow) FormatDefault() *gui.QSurfaceFormat {
 
 //export callbackQQuickWindow_SurfaceType
 func callbackQQuickWindow_SurfaceType(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "surfaceType"); signal != nil {
+	if signal := qt.GetSignal(ptr, "surfaceType"); signal != nil {
 		return C.longlong(signal.(func() gui.QSurface__SurfaceType)())
 	}
 
@@ -9000,7 +9045,7 @@ func (ptr *QQuickWindow) SurfaceTypeDefault() gui.QSurface__SurfaceType {
 
 //export callbackQQuickWindow_EventFilter
 func callbackQQuickWindow_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -9016,7 +9061,7 @@ func (ptr *QQuickWindow) EventFilterDefault(watched core.QObject_ITF, event core
 
 //export callbackQQuickWindow_ChildEvent
 func callbackQQuickWindow_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQQuickWindowFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -9031,7 +9076,7 @@ func (ptr *QQuickWindow) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQQuickWindow_ConnectNotify
 func callbackQQuickWindow_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickWindowFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9046,7 +9091,7 @@ func (ptr *QQuickWindow) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQQuickWindow_CustomEvent
 func callbackQQuickWindow_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQQuickWindowFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -9061,7 +9106,7 @@ func (ptr *QQuickWindow) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQQuickWindow_DeleteLater
 func callbackQQuickWindow_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQQuickWindowFromPointer(ptr).DeleteLaterDefault()
@@ -9071,14 +9116,14 @@ func callbackQQuickWindow_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QQuickWindow) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QQuickWindow_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQQuickWindow_Destroyed
 func callbackQQuickWindow_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -9086,7 +9131,7 @@ func callbackQQuickWindow_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQQuickWindow_DisconnectNotify
 func callbackQQuickWindow_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQQuickWindowFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9101,7 +9146,7 @@ func (ptr *QQuickWindow) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQQuickWindow_ObjectNameChanged
 func callbackQQuickWindow_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -9109,7 +9154,7 @@ func callbackQQuickWindow_ObjectNameChanged(ptr unsafe.Pointer, objectName C.str
 
 //export callbackQQuickWindow_TimerEvent
 func callbackQQuickWindow_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQQuickWindowFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -9124,7 +9169,7 @@ func (ptr *QQuickWindow) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQQuickWindow_MetaObject
 func callbackQQuickWindow_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -9180,7 +9225,7 @@ func NewQSGAbstractRendererFromPointer(ptr unsafe.Pointer) *QSGAbstractRenderer
 func (ptr *QSGAbstractRenderer) DestroyQSGAbstractRenderer() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9197,7 +9242,7 @@ const (
 
 //export callbackQSGAbstractRenderer_SceneGraphChanged
 func callbackQSGAbstractRenderer_SceneGraphChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneGraphChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneGraphChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -9206,14 +9251,14 @@ func callbackQSGAbstractRenderer_SceneGraphChanged(ptr unsafe.Pointer) {
 func (ptr *QSGAbstractRenderer) ConnectSceneGraphChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSGAbstractRenderer_ConnectSceneGraphChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sceneGraphChanged", f)
 	}
 }
 
 func (ptr *QSGAbstractRenderer) DisconnectSceneGraphChanged() {
 	if ptr.Pointer() != nil {
 		C.QSGAbstractRenderer_DisconnectSceneGraphChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sceneGraphChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sceneGraphChanged")
 	}
 }
 
@@ -9336,7 +9381,7 @@ func (ptr *QSGAbstractRenderer) __dynamicPropertyNames_newList() unsafe.Pointer
 func (ptr *QSGAbstractRenderer) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGAbstractRenderer___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9357,7 +9402,7 @@ func (ptr *QSGAbstractRenderer) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSGAbstractRenderer) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGAbstractRenderer___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9378,7 +9423,7 @@ func (ptr *QSGAbstractRenderer) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSGAbstractRenderer) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGAbstractRenderer___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9399,7 +9444,7 @@ func (ptr *QSGAbstractRenderer) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSGAbstractRenderer) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGAbstractRenderer___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -9419,7 +9464,7 @@ func (ptr *QSGAbstractRenderer) __children_newList() unsafe.Pointer {
 
 //export callbackQSGAbstractRenderer_Event
 func callbackQSGAbstractRenderer_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -9435,7 +9480,7 @@ func (ptr *QSGAbstractRenderer) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSGAbstractRenderer_EventFilter
 func callbackQSGAbstractRenderer_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -9451,7 +9496,7 @@ func (ptr *QSGAbstractRenderer) EventFilterDefault(watched core.QObject_ITF, eve
 
 //export callbackQSGAbstractRenderer_ChildEvent
 func callbackQSGAbstractRenderer_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSGAbstractRendererFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -9466,7 +9511,7 @@ func (ptr *QSGAbstractRenderer) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSGAbstractRenderer_ConnectNotify
 func callbackQSGAbstractRenderer_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSGAbstractRendererFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9481,7 +9526,7 @@ func (ptr *QSGAbstractRenderer) ConnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQSGAbstractRenderer_CustomEvent
 func callbackQSGAbstractRenderer_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSGAbstractRendererFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -9496,7 +9541,7 @@ func (ptr *QSGAbstractRenderer) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSGAbstractRenderer_DeleteLater
 func callbackQSGAbstractRenderer_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGAbstractRendererFromPointer(ptr).DeleteLaterDefault()
@@ -9506,14 +9551,14 @@ func callbackQSGAbstractRenderer_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSGAbstractRenderer) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSGAbstractRenderer_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGAbstractRenderer_Destroyed
 func callbackQSGAbstractRenderer_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -9521,7 +9566,7 @@ func callbackQSGAbstractRenderer_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointe
 
 //export callbackQSGAbstractRenderer_DisconnectNotify
 func callbackQSGAbstractRenderer_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSGAbstractRendererFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -9536,7 +9581,7 @@ func (ptr *QSGAbstractRenderer) DisconnectNotifyDefault(sign core.QMetaMethod_IT
 
 //export callbackQSGAbstractRenderer_ObjectNameChanged
 func callbackQSGAbstractRenderer_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -9544,7 +9589,7 @@ func callbackQSGAbstractRenderer_ObjectNameChanged(ptr unsafe.Pointer, objectNam
 
 //export callbackQSGAbstractRenderer_TimerEvent
 func callbackQSGAbstractRenderer_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSGAbstractRendererFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -9559,7 +9604,7 @@ func (ptr *QSGAbstractRenderer) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSGAbstractRenderer_MetaObject
 func callbackQSGAbstractRenderer_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -9627,7 +9672,7 @@ func (ptr *QSGBasicGeometryNode) SetGeometry(geometry QSGGeometry_ITF) {
 func (ptr *QSGBasicGeometryNode) DestroyQSGBasicGeometryNode() {
 	if ptr.Pointer() != nil {
 		C.QSGBasicGeometryNode_DestroyQSGBasicGeometryNode(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9750,7 +9795,7 @@ func (ptr *QSGClipNode) SetIsRectangular(rectHint bool) {
 func (ptr *QSGClipNode) DestroyQSGClipNode() {
 	if ptr.Pointer() != nil {
 		C.QSGClipNode_DestroyQSGClipNode(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -9813,14 +9858,14 @@ func NewQSGDynamicTextureFromPointer(ptr unsafe.Pointer) *QSGDynamicTexture {
 func (ptr *QSGDynamicTexture) DestroyQSGDynamicTexture() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGDynamicTexture_UpdateTexture
 func callbackQSGDynamicTexture_UpdateTexture(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateTexture"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateTexture"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -9830,14 +9875,14 @@ func callbackQSGDynamicTexture_UpdateTexture(ptr unsafe.Pointer) C.char {
 func (ptr *QSGDynamicTexture) ConnectUpdateTexture(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateTexture", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateTexture", f)
 	}
 }
 
 func (ptr *QSGDynamicTexture) DisconnectUpdateTexture() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateTexture")
+		qt.DisconnectSignal(ptr.Pointer(), "updateTexture")
 	}
 }
 
@@ -9850,7 +9895,7 @@ func (ptr *QSGDynamicTexture) UpdateTexture() bool {
 
 //export callbackQSGDynamicTexture_Bind
 func callbackQSGDynamicTexture_Bind(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bind"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bind"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGDynamicTextureFromPointer(ptr).BindDefault()
@@ -9871,7 +9916,7 @@ func (ptr *QSGDynamicTexture) BindDefault() {
 
 //export callbackQSGDynamicTexture_TextureSize
 func callbackQSGDynamicTexture_TextureSize(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureSize"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -9898,7 +9943,7 @@ func (ptr *QSGDynamicTexture) TextureSizeDefault() *core.QSize {
 
 //export callbackQSGDynamicTexture_HasAlphaChannel
 func callbackQSGDynamicTexture_HasAlphaChannel(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasAlphaChannel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasAlphaChannel"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -9921,7 +9966,7 @@ func (ptr *QSGDynamicTexture) HasAlphaChannelDefault() bool {
 
 //export callbackQSGDynamicTexture_HasMipmaps
 func callbackQSGDynamicTexture_HasMipmaps(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasMipmaps"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasMipmaps"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -9944,7 +9989,7 @@ func (ptr *QSGDynamicTexture) HasMipmapsDefault() bool {
 
 //export callbackQSGDynamicTexture_TextureId
 func callbackQSGDynamicTexture_TextureId(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureId"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureId"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -10017,7 +10062,7 @@ const (
 
 func NewQSGEngine(parent core.QObject_ITF) *QSGEngine {
 	var tmpValue = NewQSGEngineFromPointer(C.QSGEngine_NewQSGEngine(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -10038,7 +10083,7 @@ func (ptr *QSGEngine) Invalidate() {
 func (ptr *QSGEngine) DestroyQSGEngine() {
 	if ptr.Pointer() != nil {
 		C.QSGEngine_DestroyQSGEngine(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10046,7 +10091,7 @@ func (ptr *QSGEngine) DestroyQSGEngine() {
 func (ptr *QSGEngine) CreateRenderer() *QSGAbstractRenderer {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGAbstractRendererFromPointer(C.QSGEngine_CreateRenderer(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10078,7 +10123,7 @@ func (ptr *QSGEngine) RendererInterface() *QSGRendererInterface {
 func (ptr *QSGEngine) CreateTextureFromId(id uint, size core.QSize_ITF, options QSGEngine__CreateTextureOption) *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QSGEngine_CreateTextureFromId(ptr.Pointer(), C.uint(uint32(id)), core.PointerFromQSize(size), C.longlong(options)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10089,7 +10134,7 @@ func (ptr *QSGEngine) CreateTextureFromId(id uint, size core.QSize_ITF, options
 func (ptr *QSGEngine) CreateTextureFromImage(image gui.QImage_ITF, options QSGEngine__CreateTextureOption) *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QSGEngine_CreateTextureFromImage(ptr.Pointer(), gui.PointerFromQImage(image), C.longlong(options)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10119,7 +10164,7 @@ func (ptr *QSGEngine) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSGEngine) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGEngine___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10140,7 +10185,7 @@ func (ptr *QSGEngine) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSGEngine) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGEngine___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10161,7 +10206,7 @@ func (ptr *QSGEngine) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSGEngine) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGEngine___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10182,7 +10227,7 @@ func (ptr *QSGEngine) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSGEngine) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGEngine___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -10202,7 +10247,7 @@ func (ptr *QSGEngine) __children_newList() unsafe.Pointer {
 
 //export callbackQSGEngine_Event
 func callbackQSGEngine_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -10218,7 +10263,7 @@ func (ptr *QSGEngine) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSGEngine_EventFilter
 func callbackQSGEngine_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -10234,7 +10279,7 @@ func (ptr *QSGEngine) EventFilterDefault(watched core.QObject_ITF, event core.QE
 
 //export callbackQSGEngine_ChildEvent
 func callbackQSGEngine_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSGEngineFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -10249,7 +10294,7 @@ func (ptr *QSGEngine) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSGEngine_ConnectNotify
 func callbackQSGEngine_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSGEngineFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -10264,7 +10309,7 @@ func (ptr *QSGEngine) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSGEngine_CustomEvent
 func callbackQSGEngine_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSGEngineFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -10279,7 +10324,7 @@ func (ptr *QSGEngine) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSGEngine_DeleteLater
 func callbackQSGEngine_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGEngineFromPointer(ptr).DeleteLaterDefault()
@@ -10289,14 +10334,14 @@ func callbackQSGEngine_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSGEngine) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSGEngine_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGEngine_Destroyed
 func callbackQSGEngine_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -10304,7 +10349,7 @@ func callbackQSGEngine_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSGEngine_DisconnectNotify
 func callbackQSGEngine_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSGEngineFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -10319,7 +10364,7 @@ func (ptr *QSGEngine) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSGEngine_ObjectNameChanged
 func callbackQSGEngine_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -10327,7 +10372,7 @@ func callbackQSGEngine_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct
 
 //export callbackQSGEngine_TimerEvent
 func callbackQSGEngine_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSGEngineFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -10342,7 +10387,7 @@ func (ptr *QSGEngine) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSGEngine_MetaObject
 func callbackQSGEngine_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -10398,7 +10443,7 @@ func NewQSGFlatColorMaterialFromPointer(ptr unsafe.Pointer) *QSGFlatColorMateria
 func (ptr *QSGFlatColorMaterial) DestroyQSGFlatColorMaterial() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10422,7 +10467,7 @@ func (ptr *QSGFlatColorMaterial) Color() *gui.QColor {
 
 //export callbackQSGFlatColorMaterial_CreateShader
 func callbackQSGFlatColorMaterial_CreateShader(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createShader"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createShader"); signal != nil {
 		return PointerFromQSGMaterialShader(signal.(func() *QSGMaterialShader)())
 	}
 
@@ -10445,7 +10490,7 @@ func (ptr *QSGFlatColorMaterial) CreateShaderDefault() *QSGMaterialShader {
 
 //export callbackQSGFlatColorMaterial_Type
 func callbackQSGFlatColorMaterial_Type(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return PointerFromQSGMaterialType(signal.(func() *QSGMaterialType)())
 	}
 
@@ -10652,7 +10697,7 @@ func (ptr *QSGGeometry) UpdateTexturedRectGeometry(g QSGGeometry_ITF, rect core.
 
 //export callbackQSGGeometry_DestroyQSGGeometry
 func callbackQSGGeometry_DestroyQSGGeometry(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSGGeometry"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSGGeometry"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGGeometryFromPointer(ptr).DestroyQSGGeometryDefault()
@@ -10662,21 +10707,21 @@ func callbackQSGGeometry_DestroyQSGGeometry(ptr unsafe.Pointer) {
 func (ptr *QSGGeometry) ConnectDestroyQSGGeometry(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGGeometry", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSGGeometry", f)
 	}
 }
 
 func (ptr *QSGGeometry) DisconnectDestroyQSGGeometry() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGGeometry")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSGGeometry")
 	}
 }
 
 func (ptr *QSGGeometry) DestroyQSGGeometry() {
 	if ptr.Pointer() != nil {
 		C.QSGGeometry_DestroyQSGGeometry(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10684,7 +10729,7 @@ func (ptr *QSGGeometry) DestroyQSGGeometry() {
 func (ptr *QSGGeometry) DestroyQSGGeometryDefault() {
 	if ptr.Pointer() != nil {
 		C.QSGGeometry_DestroyQSGGeometryDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10844,7 +10889,7 @@ func (ptr *QSGGeometryNode) SetOpaqueMaterial(material QSGMaterial_ITF) {
 func (ptr *QSGGeometryNode) DestroyQSGGeometryNode() {
 	if ptr.Pointer() != nil {
 		C.QSGGeometryNode_DestroyQSGGeometryNode(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -10922,7 +10967,7 @@ func (ptr *QSGImageNode) RebuildGeometry(g QSGGeometry_ITF, texture QSGTexture_I
 
 //export callbackQSGImageNode_SetFiltering
 func callbackQSGImageNode_SetFiltering(ptr unsafe.Pointer, filtering C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFiltering"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFiltering"); signal != nil {
 		signal.(func(QSGTexture__Filtering))(QSGTexture__Filtering(filtering))
 	}
 
@@ -10931,14 +10976,14 @@ func callbackQSGImageNode_SetFiltering(ptr unsafe.Pointer, filtering C.longlong)
 func (ptr *QSGImageNode) ConnectSetFiltering(f func(filtering QSGTexture__Filtering)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFiltering", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFiltering", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectSetFiltering() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFiltering")
+		qt.DisconnectSignal(ptr.Pointer(), "setFiltering")
 	}
 }
 
@@ -10950,7 +10995,7 @@ func (ptr *QSGImageNode) SetFiltering(filtering QSGTexture__Filtering) {
 
 //export callbackQSGImageNode_SetMipmapFiltering
 func callbackQSGImageNode_SetMipmapFiltering(ptr unsafe.Pointer, filtering C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setMipmapFiltering"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setMipmapFiltering"); signal != nil {
 		signal.(func(QSGTexture__Filtering))(QSGTexture__Filtering(filtering))
 	}
 
@@ -10959,14 +11004,14 @@ func callbackQSGImageNode_SetMipmapFiltering(ptr unsafe.Pointer, filtering C.lon
 func (ptr *QSGImageNode) ConnectSetMipmapFiltering(f func(filtering QSGTexture__Filtering)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setMipmapFiltering", f)
+		qt.ConnectSignal(ptr.Pointer(), "setMipmapFiltering", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectSetMipmapFiltering() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setMipmapFiltering")
+		qt.DisconnectSignal(ptr.Pointer(), "setMipmapFiltering")
 	}
 }
 
@@ -10978,7 +11023,7 @@ func (ptr *QSGImageNode) SetMipmapFiltering(filtering QSGTexture__Filtering) {
 
 //export callbackQSGImageNode_SetOwnsTexture
 func callbackQSGImageNode_SetOwnsTexture(ptr unsafe.Pointer, owns C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setOwnsTexture"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setOwnsTexture"); signal != nil {
 		signal.(func(bool))(int8(owns) != 0)
 	}
 
@@ -10987,14 +11032,14 @@ func callbackQSGImageNode_SetOwnsTexture(ptr unsafe.Pointer, owns C.char) {
 func (ptr *QSGImageNode) ConnectSetOwnsTexture(f func(owns bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setOwnsTexture", f)
+		qt.ConnectSignal(ptr.Pointer(), "setOwnsTexture", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectSetOwnsTexture() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setOwnsTexture")
+		qt.DisconnectSignal(ptr.Pointer(), "setOwnsTexture")
 	}
 }
 
@@ -11006,7 +11051,7 @@ func (ptr *QSGImageNode) SetOwnsTexture(owns bool) {
 
 //export callbackQSGImageNode_SetRect
 func callbackQSGImageNode_SetRect(ptr unsafe.Pointer, rect unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRect"); signal != nil {
 		signal.(func(*core.QRectF))(core.NewQRectFFromPointer(rect))
 	}
 
@@ -11015,14 +11060,14 @@ func callbackQSGImageNode_SetRect(ptr unsafe.Pointer, rect unsafe.Pointer) {
 func (ptr *QSGImageNode) ConnectSetRect(f func(rect *core.QRectF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "setRect", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectSetRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setRect")
+		qt.DisconnectSignal(ptr.Pointer(), "setRect")
 	}
 }
 
@@ -11040,7 +11085,7 @@ func (ptr *QSGImageNode) SetRect2(x float64, y float64, w float64, h float64) {
 
 //export callbackQSGImageNode_SetSourceRect
 func callbackQSGImageNode_SetSourceRect(ptr unsafe.Pointer, rect unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSourceRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSourceRect"); signal != nil {
 		signal.(func(*core.QRectF))(core.NewQRectFFromPointer(rect))
 	}
 
@@ -11049,14 +11094,14 @@ func callbackQSGImageNode_SetSourceRect(ptr unsafe.Pointer, rect unsafe.Pointer)
 func (ptr *QSGImageNode) ConnectSetSourceRect(f func(rect *core.QRectF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSourceRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSourceRect", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectSetSourceRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSourceRect")
+		qt.DisconnectSignal(ptr.Pointer(), "setSourceRect")
 	}
 }
 
@@ -11074,7 +11119,7 @@ func (ptr *QSGImageNode) SetSourceRect2(x float64, y float64, w float64, h float
 
 //export callbackQSGImageNode_SetTexture
 func callbackQSGImageNode_SetTexture(ptr unsafe.Pointer, texture unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setTexture"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setTexture"); signal != nil {
 		signal.(func(*QSGTexture))(NewQSGTextureFromPointer(texture))
 	}
 
@@ -11083,14 +11128,14 @@ func callbackQSGImageNode_SetTexture(ptr unsafe.Pointer, texture unsafe.Pointer)
 func (ptr *QSGImageNode) ConnectSetTexture(f func(texture *QSGTexture)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setTexture", f)
+		qt.ConnectSignal(ptr.Pointer(), "setTexture", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectSetTexture() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setTexture")
+		qt.DisconnectSignal(ptr.Pointer(), "setTexture")
 	}
 }
 
@@ -11102,7 +11147,7 @@ func (ptr *QSGImageNode) SetTexture(texture QSGTexture_ITF) {
 
 //export callbackQSGImageNode_SetTextureCoordinatesTransform
 func callbackQSGImageNode_SetTextureCoordinatesTransform(ptr unsafe.Pointer, mode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setTextureCoordinatesTransform"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setTextureCoordinatesTransform"); signal != nil {
 		signal.(func(QSGImageNode__TextureCoordinatesTransformFlag))(QSGImageNode__TextureCoordinatesTransformFlag(mode))
 	}
 
@@ -11111,14 +11156,14 @@ func callbackQSGImageNode_SetTextureCoordinatesTransform(ptr unsafe.Pointer, mod
 func (ptr *QSGImageNode) ConnectSetTextureCoordinatesTransform(f func(mode QSGImageNode__TextureCoordinatesTransformFlag)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setTextureCoordinatesTransform", f)
+		qt.ConnectSignal(ptr.Pointer(), "setTextureCoordinatesTransform", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectSetTextureCoordinatesTransform() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setTextureCoordinatesTransform")
+		qt.DisconnectSignal(ptr.Pointer(), "setTextureCoordinatesTransform")
 	}
 }
 
@@ -11130,7 +11175,7 @@ func (ptr *QSGImageNode) SetTextureCoordinatesTransform(mode QSGImageNode__Textu
 
 //export callbackQSGImageNode_DestroyQSGImageNode
 func callbackQSGImageNode_DestroyQSGImageNode(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSGImageNode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSGImageNode"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGImageNodeFromPointer(ptr).DestroyQSGImageNodeDefault()
@@ -11140,21 +11185,21 @@ func callbackQSGImageNode_DestroyQSGImageNode(ptr unsafe.Pointer) {
 func (ptr *QSGImageNode) ConnectDestroyQSGImageNode(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGImageNode", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSGImageNode", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectDestroyQSGImageNode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGImageNode")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSGImageNode")
 	}
 }
 
 func (ptr *QSGImageNode) DestroyQSGImageNode() {
 	if ptr.Pointer() != nil {
 		C.QSGImageNode_DestroyQSGImageNode(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11162,14 +11207,14 @@ func (ptr *QSGImageNode) DestroyQSGImageNode() {
 func (ptr *QSGImageNode) DestroyQSGImageNodeDefault() {
 	if ptr.Pointer() != nil {
 		C.QSGImageNode_DestroyQSGImageNodeDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGImageNode_Rect
 func callbackQSGImageNode_Rect(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rect"); signal != nil {
 		return core.PointerFromQRectF(signal.(func() *core.QRectF)())
 	}
 
@@ -11179,14 +11224,14 @@ func callbackQSGImageNode_Rect(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGImageNode) ConnectRect(f func() *core.QRectF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rect", f)
+		qt.ConnectSignal(ptr.Pointer(), "rect", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rect")
+		qt.DisconnectSignal(ptr.Pointer(), "rect")
 	}
 }
 
@@ -11201,7 +11246,7 @@ func (ptr *QSGImageNode) Rect() *core.QRectF {
 
 //export callbackQSGImageNode_SourceRect
 func callbackQSGImageNode_SourceRect(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sourceRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sourceRect"); signal != nil {
 		return core.PointerFromQRectF(signal.(func() *core.QRectF)())
 	}
 
@@ -11211,14 +11256,14 @@ func callbackQSGImageNode_SourceRect(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGImageNode) ConnectSourceRect(f func() *core.QRectF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sourceRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "sourceRect", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectSourceRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sourceRect")
+		qt.DisconnectSignal(ptr.Pointer(), "sourceRect")
 	}
 }
 
@@ -11233,7 +11278,7 @@ func (ptr *QSGImageNode) SourceRect() *core.QRectF {
 
 //export callbackQSGImageNode_Texture
 func callbackQSGImageNode_Texture(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "texture"); signal != nil {
+	if signal := qt.GetSignal(ptr, "texture"); signal != nil {
 		return PointerFromQSGTexture(signal.(func() *QSGTexture)())
 	}
 
@@ -11243,21 +11288,21 @@ func callbackQSGImageNode_Texture(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGImageNode) ConnectTexture(f func() *QSGTexture) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "texture", f)
+		qt.ConnectSignal(ptr.Pointer(), "texture", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectTexture() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "texture")
+		qt.DisconnectSignal(ptr.Pointer(), "texture")
 	}
 }
 
 func (ptr *QSGImageNode) Texture() *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QSGImageNode_Texture(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11267,7 +11312,7 @@ func (ptr *QSGImageNode) Texture() *QSGTexture {
 
 //export callbackQSGImageNode_Filtering
 func callbackQSGImageNode_Filtering(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filtering"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filtering"); signal != nil {
 		return C.longlong(signal.(func() QSGTexture__Filtering)())
 	}
 
@@ -11277,14 +11322,14 @@ func callbackQSGImageNode_Filtering(ptr unsafe.Pointer) C.longlong {
 func (ptr *QSGImageNode) ConnectFiltering(f func() QSGTexture__Filtering) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filtering", f)
+		qt.ConnectSignal(ptr.Pointer(), "filtering", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectFiltering() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filtering")
+		qt.DisconnectSignal(ptr.Pointer(), "filtering")
 	}
 }
 
@@ -11297,7 +11342,7 @@ func (ptr *QSGImageNode) Filtering() QSGTexture__Filtering {
 
 //export callbackQSGImageNode_MipmapFiltering
 func callbackQSGImageNode_MipmapFiltering(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mipmapFiltering"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mipmapFiltering"); signal != nil {
 		return C.longlong(signal.(func() QSGTexture__Filtering)())
 	}
 
@@ -11307,14 +11352,14 @@ func callbackQSGImageNode_MipmapFiltering(ptr unsafe.Pointer) C.longlong {
 func (ptr *QSGImageNode) ConnectMipmapFiltering(f func() QSGTexture__Filtering) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "mipmapFiltering", f)
+		qt.ConnectSignal(ptr.Pointer(), "mipmapFiltering", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectMipmapFiltering() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "mipmapFiltering")
+		qt.DisconnectSignal(ptr.Pointer(), "mipmapFiltering")
 	}
 }
 
@@ -11327,7 +11372,7 @@ func (ptr *QSGImageNode) MipmapFiltering() QSGTexture__Filtering {
 
 //export callbackQSGImageNode_TextureCoordinatesTransform
 func callbackQSGImageNode_TextureCoordinatesTransform(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureCoordinatesTransform"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureCoordinatesTransform"); signal != nil {
 		return C.longlong(signal.(func() QSGImageNode__TextureCoordinatesTransformFlag)())
 	}
 
@@ -11337,14 +11382,14 @@ func callbackQSGImageNode_TextureCoordinatesTransform(ptr unsafe.Pointer) C.long
 func (ptr *QSGImageNode) ConnectTextureCoordinatesTransform(f func() QSGImageNode__TextureCoordinatesTransformFlag) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureCoordinatesTransform", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureCoordinatesTransform", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectTextureCoordinatesTransform() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureCoordinatesTransform")
+		qt.DisconnectSignal(ptr.Pointer(), "textureCoordinatesTransform")
 	}
 }
 
@@ -11357,7 +11402,7 @@ func (ptr *QSGImageNode) TextureCoordinatesTransform() QSGImageNode__TextureCoor
 
 //export callbackQSGImageNode_OwnsTexture
 func callbackQSGImageNode_OwnsTexture(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "ownsTexture"); signal != nil {
+	if signal := qt.GetSignal(ptr, "ownsTexture"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -11367,14 +11412,14 @@ func callbackQSGImageNode_OwnsTexture(ptr unsafe.Pointer) C.char {
 func (ptr *QSGImageNode) ConnectOwnsTexture(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "ownsTexture", f)
+		qt.ConnectSignal(ptr.Pointer(), "ownsTexture", f)
 	}
 }
 
 func (ptr *QSGImageNode) DisconnectOwnsTexture() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "ownsTexture")
+		qt.DisconnectSignal(ptr.Pointer(), "ownsTexture")
 	}
 }
 
@@ -11426,7 +11471,7 @@ func NewQSGMaterialFromPointer(ptr unsafe.Pointer) *QSGMaterial {
 func (ptr *QSGMaterial) DestroyQSGMaterial() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -11458,7 +11503,7 @@ func (ptr *QSGMaterial) Flags() QSGMaterial__Flag {
 
 //export callbackQSGMaterial_CreateShader
 func callbackQSGMaterial_CreateShader(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createShader"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createShader"); signal != nil {
 		return PointerFromQSGMaterialShader(signal.(func() *QSGMaterialShader)())
 	}
 
@@ -11468,14 +11513,14 @@ func callbackQSGMaterial_CreateShader(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGMaterial) ConnectCreateShader(f func() *QSGMaterialShader) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createShader", f)
+		qt.ConnectSignal(ptr.Pointer(), "createShader", f)
 	}
 }
 
 func (ptr *QSGMaterial) DisconnectCreateShader() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createShader")
+		qt.DisconnectSignal(ptr.Pointer(), "createShader")
 	}
 }
 
@@ -11488,7 +11533,7 @@ func (ptr *QSGMaterial) CreateShader() *QSGMaterialShader {
 
 //export callbackQSGMaterial_Type
 func callbackQSGMaterial_Type(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return PointerFromQSGMaterialType(signal.(func() *QSGMaterialType)())
 	}
 
@@ -11498,14 +11543,14 @@ func callbackQSGMaterial_Type(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGMaterial) ConnectType(f func() *QSGMaterialType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "type", f)
+		qt.ConnectSignal(ptr.Pointer(), "type", f)
 	}
 }
 
 func (ptr *QSGMaterial) DisconnectType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "type")
+		qt.DisconnectSignal(ptr.Pointer(), "type")
 	}
 }
 
@@ -11518,7 +11563,7 @@ func (ptr *QSGMaterial) Type() *QSGMaterialType {
 
 //export callbackQSGMaterial_Compare
 func callbackQSGMaterial_Compare(ptr unsafe.Pointer, other unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "compare"); signal != nil {
+	if signal := qt.GetSignal(ptr, "compare"); signal != nil {
 		return C.int(int32(signal.(func(*QSGMaterial) int)(NewQSGMaterialFromPointer(other))))
 	}
 
@@ -11528,14 +11573,14 @@ func callbackQSGMaterial_Compare(ptr unsafe.Pointer, other unsafe.Pointer) C.int
 func (ptr *QSGMaterial) ConnectCompare(f func(other *QSGMaterial) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "compare", f)
+		qt.ConnectSignal(ptr.Pointer(), "compare", f)
 	}
 }
 
 func (ptr *QSGMaterial) DisconnectCompare() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "compare")
+		qt.DisconnectSignal(ptr.Pointer(), "compare")
 	}
 }
 
@@ -11594,14 +11639,14 @@ func NewQSGMaterialShaderFromPointer(ptr unsafe.Pointer) *QSGMaterialShader {
 func (ptr *QSGMaterialShader) DestroyQSGMaterialShader() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGMaterialShader_FragmentShader
 func callbackQSGMaterialShader_FragmentShader(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fragmentShader"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fragmentShader"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -11611,14 +11656,14 @@ func callbackQSGMaterialShader_FragmentShader(ptr unsafe.Pointer) *C.char {
 func (ptr *QSGMaterialShader) ConnectFragmentShader(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fragmentShader", f)
+		qt.ConnectSignal(ptr.Pointer(), "fragmentShader", f)
 	}
 }
 
 func (ptr *QSGMaterialShader) DisconnectFragmentShader() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fragmentShader")
+		qt.DisconnectSignal(ptr.Pointer(), "fragmentShader")
 	}
 }
 
@@ -11638,7 +11683,7 @@ func (ptr *QSGMaterialShader) FragmentShaderDefault() string {
 
 //export callbackQSGMaterialShader_VertexShader
 func callbackQSGMaterialShader_VertexShader(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "vertexShader"); signal != nil {
+	if signal := qt.GetSignal(ptr, "vertexShader"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -11648,14 +11693,14 @@ func callbackQSGMaterialShader_VertexShader(ptr unsafe.Pointer) *C.char {
 func (ptr *QSGMaterialShader) ConnectVertexShader(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "vertexShader", f)
+		qt.ConnectSignal(ptr.Pointer(), "vertexShader", f)
 	}
 }
 
 func (ptr *QSGMaterialShader) DisconnectVertexShader() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "vertexShader")
+		qt.DisconnectSignal(ptr.Pointer(), "vertexShader")
 	}
 }
 
@@ -11676,7 +11721,7 @@ func (ptr *QSGMaterialShader) VertexShaderDefault() string {
 func (ptr *QSGMaterialShader) Program() *gui.QOpenGLShaderProgram {
 	if ptr.Pointer() != nil {
 		var tmpValue = gui.NewQOpenGLShaderProgramFromPointer(C.QSGMaterialShader_Program(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -11686,7 +11731,7 @@ func (ptr *QSGMaterialShader) Program() *gui.QOpenGLShaderProgram {
 
 //export callbackQSGMaterialShader_Activate
 func callbackQSGMaterialShader_Activate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGMaterialShaderFromPointer(ptr).ActivateDefault()
@@ -11696,14 +11741,14 @@ func callbackQSGMaterialShader_Activate(ptr unsafe.Pointer) {
 func (ptr *QSGMaterialShader) ConnectActivate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activate", f)
+		qt.ConnectSignal(ptr.Pointer(), "activate", f)
 	}
 }
 
 func (ptr *QSGMaterialShader) DisconnectActivate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activate")
+		qt.DisconnectSignal(ptr.Pointer(), "activate")
 	}
 }
 
@@ -11721,7 +11766,7 @@ func (ptr *QSGMaterialShader) ActivateDefault() {
 
 //export callbackQSGMaterialShader_Compile
 func callbackQSGMaterialShader_Compile(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "compile"); signal != nil {
+	if signal := qt.GetSignal(ptr, "compile"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGMaterialShaderFromPointer(ptr).CompileDefault()
@@ -11731,14 +11776,14 @@ func callbackQSGMaterialShader_Compile(ptr unsafe.Pointer) {
 func (ptr *QSGMaterialShader) ConnectCompile(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "compile", f)
+		qt.ConnectSignal(ptr.Pointer(), "compile", f)
 	}
 }
 
 func (ptr *QSGMaterialShader) DisconnectCompile() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "compile")
+		qt.DisconnectSignal(ptr.Pointer(), "compile")
 	}
 }
 
@@ -11756,7 +11801,7 @@ func (ptr *QSGMaterialShader) CompileDefault() {
 
 //export callbackQSGMaterialShader_Deactivate
 func callbackQSGMaterialShader_Deactivate(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deactivate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deactivate"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGMaterialShaderFromPointer(ptr).DeactivateDefault()
@@ -11766,14 +11811,14 @@ func callbackQSGMaterialShader_Deactivate(ptr unsafe.Pointer) {
 func (ptr *QSGMaterialShader) ConnectDeactivate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "deactivate", f)
+		qt.ConnectSignal(ptr.Pointer(), "deactivate", f)
 	}
 }
 
 func (ptr *QSGMaterialShader) DisconnectDeactivate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "deactivate")
+		qt.DisconnectSignal(ptr.Pointer(), "deactivate")
 	}
 }
 
@@ -11791,7 +11836,7 @@ func (ptr *QSGMaterialShader) DeactivateDefault() {
 
 //export callbackQSGMaterialShader_Initialize
 func callbackQSGMaterialShader_Initialize(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "initialize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "initialize"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGMaterialShaderFromPointer(ptr).InitializeDefault()
@@ -11801,14 +11846,14 @@ func callbackQSGMaterialShader_Initialize(ptr unsafe.Pointer) {
 func (ptr *QSGMaterialShader) ConnectInitialize(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "initialize", f)
+		qt.ConnectSignal(ptr.Pointer(), "initialize", f)
 	}
 }
 
 func (ptr *QSGMaterialShader) DisconnectInitialize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "initialize")
+		qt.DisconnectSignal(ptr.Pointer(), "initialize")
 	}
 }
 
@@ -11834,7 +11879,7 @@ func (ptr *QSGMaterialShader) SetShaderSourceFile(ty gui.QOpenGLShader__ShaderTy
 
 func (ptr *QSGMaterialShader) SetShaderSourceFiles(ty gui.QOpenGLShader__ShaderTypeBit, sourceFiles []string) {
 	if ptr.Pointer() != nil {
-		var sourceFilesC = C.CString(strings.Join(sourceFiles, "|"))
+		var sourceFilesC = cGoPackStringList(sourceFiles)
 		defer C.free(unsafe.Pointer(sourceFilesC))
 		C.QSGMaterialShader_SetShaderSourceFiles(ptr.Pointer(), C.longlong(ty), sourceFilesC)
 	}
@@ -11999,7 +12044,7 @@ func (ptr *QSGNode) PrependChildNode(node QSGNode_ITF) {
 
 //export callbackQSGNode_Preprocess
 func callbackQSGNode_Preprocess(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "preprocess"); signal != nil {
+	if signal := qt.GetSignal(ptr, "preprocess"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGNodeFromPointer(ptr).PreprocessDefault()
@@ -12009,14 +12054,14 @@ func callbackQSGNode_Preprocess(ptr unsafe.Pointer) {
 func (ptr *QSGNode) ConnectPreprocess(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "preprocess", f)
+		qt.ConnectSignal(ptr.Pointer(), "preprocess", f)
 	}
 }
 
 func (ptr *QSGNode) DisconnectPreprocess() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "preprocess")
+		qt.DisconnectSignal(ptr.Pointer(), "preprocess")
 	}
 }
 
@@ -12058,7 +12103,7 @@ func (ptr *QSGNode) SetFlags(f QSGNode__Flag, enabled bool) {
 
 //export callbackQSGNode_DestroyQSGNode
 func callbackQSGNode_DestroyQSGNode(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSGNode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSGNode"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGNodeFromPointer(ptr).DestroyQSGNodeDefault()
@@ -12068,21 +12113,21 @@ func callbackQSGNode_DestroyQSGNode(ptr unsafe.Pointer) {
 func (ptr *QSGNode) ConnectDestroyQSGNode(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGNode", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSGNode", f)
 	}
 }
 
 func (ptr *QSGNode) DisconnectDestroyQSGNode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGNode")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSGNode")
 	}
 }
 
 func (ptr *QSGNode) DestroyQSGNode() {
 	if ptr.Pointer() != nil {
 		C.QSGNode_DestroyQSGNode(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12090,7 +12135,7 @@ func (ptr *QSGNode) DestroyQSGNode() {
 func (ptr *QSGNode) DestroyQSGNodeDefault() {
 	if ptr.Pointer() != nil {
 		C.QSGNode_DestroyQSGNodeDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12153,7 +12198,7 @@ func (ptr *QSGNode) PreviousSibling() *QSGNode {
 
 //export callbackQSGNode_IsSubtreeBlocked
 func callbackQSGNode_IsSubtreeBlocked(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isSubtreeBlocked"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isSubtreeBlocked"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -12163,14 +12208,14 @@ func callbackQSGNode_IsSubtreeBlocked(ptr unsafe.Pointer) C.char {
 func (ptr *QSGNode) ConnectIsSubtreeBlocked(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isSubtreeBlocked", f)
+		qt.ConnectSignal(ptr.Pointer(), "isSubtreeBlocked", f)
 	}
 }
 
 func (ptr *QSGNode) DisconnectIsSubtreeBlocked() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isSubtreeBlocked")
+		qt.DisconnectSignal(ptr.Pointer(), "isSubtreeBlocked")
 	}
 }
 
@@ -12246,7 +12291,7 @@ func (ptr *QSGOpacityNode) SetOpacity(opacity float64) {
 func (ptr *QSGOpacityNode) DestroyQSGOpacityNode() {
 	if ptr.Pointer() != nil {
 		C.QSGOpacityNode_DestroyQSGOpacityNode(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12300,7 +12345,7 @@ func NewQSGOpaqueTextureMaterialFromPointer(ptr unsafe.Pointer) *QSGOpaqueTextur
 func (ptr *QSGOpaqueTextureMaterial) DestroyQSGOpaqueTextureMaterial() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12342,7 +12387,7 @@ func (ptr *QSGOpaqueTextureMaterial) SetVerticalWrapMode(mode QSGTexture__WrapMo
 func (ptr *QSGOpaqueTextureMaterial) Texture() *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QSGOpaqueTextureMaterial_Texture(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12381,7 +12426,7 @@ func (ptr *QSGOpaqueTextureMaterial) VerticalWrapMode() QSGTexture__WrapMode {
 func (ptr *QSGOpaqueTextureMaterial) M_texture() *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QSGOpaqueTextureMaterial_M_texture(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -12397,7 +12442,7 @@ func (ptr *QSGOpaqueTextureMaterial) SetM_texture(vqs QSGTexture_ITF) {
 
 //export callbackQSGOpaqueTextureMaterial_CreateShader
 func callbackQSGOpaqueTextureMaterial_CreateShader(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createShader"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createShader"); signal != nil {
 		return PointerFromQSGMaterialShader(signal.(func() *QSGMaterialShader)())
 	}
 
@@ -12420,7 +12465,7 @@ func (ptr *QSGOpaqueTextureMaterial) CreateShaderDefault() *QSGMaterialShader {
 
 //export callbackQSGOpaqueTextureMaterial_Type
 func callbackQSGOpaqueTextureMaterial_Type(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return PointerFromQSGMaterialType(signal.(func() *QSGMaterialType)())
 	}
 
@@ -12482,7 +12527,7 @@ func NewQSGRectangleNodeFromPointer(ptr unsafe.Pointer) *QSGRectangleNode {
 
 //export callbackQSGRectangleNode_SetColor
 func callbackQSGRectangleNode_SetColor(ptr unsafe.Pointer, color unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setColor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setColor"); signal != nil {
 		signal.(func(*gui.QColor))(gui.NewQColorFromPointer(color))
 	}
 
@@ -12491,14 +12536,14 @@ func callbackQSGRectangleNode_SetColor(ptr unsafe.Pointer, color unsafe.Pointer)
 func (ptr *QSGRectangleNode) ConnectSetColor(f func(color *gui.QColor)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setColor", f)
+		qt.ConnectSignal(ptr.Pointer(), "setColor", f)
 	}
 }
 
 func (ptr *QSGRectangleNode) DisconnectSetColor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setColor")
+		qt.DisconnectSignal(ptr.Pointer(), "setColor")
 	}
 }
 
@@ -12510,7 +12555,7 @@ func (ptr *QSGRectangleNode) SetColor(color gui.QColor_ITF) {
 
 //export callbackQSGRectangleNode_SetRect
 func callbackQSGRectangleNode_SetRect(ptr unsafe.Pointer, rect unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRect"); signal != nil {
 		signal.(func(*core.QRectF))(core.NewQRectFFromPointer(rect))
 	}
 
@@ -12519,14 +12564,14 @@ func callbackQSGRectangleNode_SetRect(ptr unsafe.Pointer, rect unsafe.Pointer) {
 func (ptr *QSGRectangleNode) ConnectSetRect(f func(rect *core.QRectF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "setRect", f)
 	}
 }
 
 func (ptr *QSGRectangleNode) DisconnectSetRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setRect")
+		qt.DisconnectSignal(ptr.Pointer(), "setRect")
 	}
 }
 
@@ -12544,7 +12589,7 @@ func (ptr *QSGRectangleNode) SetRect2(x float64, y float64, w float64, h float64
 
 //export callbackQSGRectangleNode_DestroyQSGRectangleNode
 func callbackQSGRectangleNode_DestroyQSGRectangleNode(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSGRectangleNode"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSGRectangleNode"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGRectangleNodeFromPointer(ptr).DestroyQSGRectangleNodeDefault()
@@ -12554,21 +12599,21 @@ func callbackQSGRectangleNode_DestroyQSGRectangleNode(ptr unsafe.Pointer) {
 func (ptr *QSGRectangleNode) ConnectDestroyQSGRectangleNode(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGRectangleNode", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSGRectangleNode", f)
 	}
 }
 
 func (ptr *QSGRectangleNode) DisconnectDestroyQSGRectangleNode() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGRectangleNode")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSGRectangleNode")
 	}
 }
 
 func (ptr *QSGRectangleNode) DestroyQSGRectangleNode() {
 	if ptr.Pointer() != nil {
 		C.QSGRectangleNode_DestroyQSGRectangleNode(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -12576,14 +12621,14 @@ func (ptr *QSGRectangleNode) DestroyQSGRectangleNode() {
 func (ptr *QSGRectangleNode) DestroyQSGRectangleNodeDefault() {
 	if ptr.Pointer() != nil {
 		C.QSGRectangleNode_DestroyQSGRectangleNodeDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGRectangleNode_Color
 func callbackQSGRectangleNode_Color(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "color"); signal != nil {
+	if signal := qt.GetSignal(ptr, "color"); signal != nil {
 		return gui.PointerFromQColor(signal.(func() *gui.QColor)())
 	}
 
@@ -12593,14 +12638,14 @@ func callbackQSGRectangleNode_Color(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGRectangleNode) ConnectColor(f func() *gui.QColor) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "color", f)
+		qt.ConnectSignal(ptr.Pointer(), "color", f)
 	}
 }
 
 func (ptr *QSGRectangleNode) DisconnectColor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "color")
+		qt.DisconnectSignal(ptr.Pointer(), "color")
 	}
 }
 
@@ -12615,7 +12660,7 @@ func (ptr *QSGRectangleNode) Color() *gui.QColor {
 
 //export callbackQSGRectangleNode_Rect
 func callbackQSGRectangleNode_Rect(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rect"); signal != nil {
 		return core.PointerFromQRectF(signal.(func() *core.QRectF)())
 	}
 
@@ -12625,14 +12670,14 @@ func callbackQSGRectangleNode_Rect(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGRectangleNode) ConnectRect(f func() *core.QRectF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rect", f)
+		qt.ConnectSignal(ptr.Pointer(), "rect", f)
 	}
 }
 
 func (ptr *QSGRectangleNode) DisconnectRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rect")
+		qt.DisconnectSignal(ptr.Pointer(), "rect")
 	}
 }
 
@@ -12711,7 +12756,7 @@ const (
 
 //export callbackQSGRenderNode_ReleaseResources
 func callbackQSGRenderNode_ReleaseResources(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "releaseResources"); signal != nil {
+	if signal := qt.GetSignal(ptr, "releaseResources"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGRenderNodeFromPointer(ptr).ReleaseResourcesDefault()
@@ -12721,14 +12766,14 @@ func callbackQSGRenderNode_ReleaseResources(ptr unsafe.Pointer) {
 func (ptr *QSGRenderNode) ConnectReleaseResources(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "releaseResources", f)
+		qt.ConnectSignal(ptr.Pointer(), "releaseResources", f)
 	}
 }
 
 func (ptr *QSGRenderNode) DisconnectReleaseResources() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "releaseResources")
+		qt.DisconnectSignal(ptr.Pointer(), "releaseResources")
 	}
 }
 
@@ -12747,14 +12792,14 @@ func (ptr *QSGRenderNode) ReleaseResourcesDefault() {
 func (ptr *QSGRenderNode) DestroyQSGRenderNode() {
 	if ptr.Pointer() != nil {
 		C.QSGRenderNode_DestroyQSGRenderNode(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGRenderNode_Rect
 func callbackQSGRenderNode_Rect(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rect"); signal != nil {
 		return core.PointerFromQRectF(signal.(func() *core.QRectF)())
 	}
 
@@ -12764,14 +12809,14 @@ func callbackQSGRenderNode_Rect(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGRenderNode) ConnectRect(f func() *core.QRectF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rect", f)
+		qt.ConnectSignal(ptr.Pointer(), "rect", f)
 	}
 }
 
 func (ptr *QSGRenderNode) DisconnectRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rect")
+		qt.DisconnectSignal(ptr.Pointer(), "rect")
 	}
 }
 
@@ -12795,7 +12840,7 @@ func (ptr *QSGRenderNode) RectDefault() *core.QRectF {
 
 //export callbackQSGRenderNode_Flags
 func callbackQSGRenderNode_Flags(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flags"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flags"); signal != nil {
 		return C.longlong(signal.(func() QSGRenderNode__RenderingFlag)())
 	}
 
@@ -12805,14 +12850,14 @@ func callbackQSGRenderNode_Flags(ptr unsafe.Pointer) C.longlong {
 func (ptr *QSGRenderNode) ConnectFlags(f func() QSGRenderNode__RenderingFlag) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "flags", f)
+		qt.ConnectSignal(ptr.Pointer(), "flags", f)
 	}
 }
 
 func (ptr *QSGRenderNode) DisconnectFlags() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "flags")
+		qt.DisconnectSignal(ptr.Pointer(), "flags")
 	}
 }
 
@@ -12832,7 +12877,7 @@ func (ptr *QSGRenderNode) FlagsDefault() QSGRenderNode__RenderingFlag {
 
 //export callbackQSGRenderNode_ChangedStates
 func callbackQSGRenderNode_ChangedStates(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changedStates"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changedStates"); signal != nil {
 		return C.longlong(signal.(func() QSGRenderNode__StateFlag)())
 	}
 
@@ -12842,14 +12887,14 @@ func callbackQSGRenderNode_ChangedStates(ptr unsafe.Pointer) C.longlong {
 func (ptr *QSGRenderNode) ConnectChangedStates(f func() QSGRenderNode__StateFlag) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "changedStates", f)
+		qt.ConnectSignal(ptr.Pointer(), "changedStates", f)
 	}
 }
 
 func (ptr *QSGRenderNode) DisconnectChangedStates() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "changedStates")
+		qt.DisconnectSignal(ptr.Pointer(), "changedStates")
 	}
 }
 
@@ -12979,7 +13024,7 @@ const (
 
 //export callbackQSGRendererInterface_DestroyQSGRendererInterface
 func callbackQSGRendererInterface_DestroyQSGRendererInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSGRendererInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSGRendererInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGRendererInterfaceFromPointer(ptr).DestroyQSGRendererInterfaceDefault()
@@ -12989,21 +13034,21 @@ func callbackQSGRendererInterface_DestroyQSGRendererInterface(ptr unsafe.Pointer
 func (ptr *QSGRendererInterface) ConnectDestroyQSGRendererInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGRendererInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSGRendererInterface", f)
 	}
 }
 
 func (ptr *QSGRendererInterface) DisconnectDestroyQSGRendererInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSGRendererInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSGRendererInterface")
 	}
 }
 
 func (ptr *QSGRendererInterface) DestroyQSGRendererInterface() {
 	if ptr.Pointer() != nil {
 		C.QSGRendererInterface_DestroyQSGRendererInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13011,14 +13056,14 @@ func (ptr *QSGRendererInterface) DestroyQSGRendererInterface() {
 func (ptr *QSGRendererInterface) DestroyQSGRendererInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QSGRendererInterface_DestroyQSGRendererInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGRendererInterface_GraphicsApi
 func callbackQSGRendererInterface_GraphicsApi(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "graphicsApi"); signal != nil {
+	if signal := qt.GetSignal(ptr, "graphicsApi"); signal != nil {
 		return C.longlong(signal.(func() QSGRendererInterface__GraphicsApi)())
 	}
 
@@ -13028,14 +13073,14 @@ func callbackQSGRendererInterface_GraphicsApi(ptr unsafe.Pointer) C.longlong {
 func (ptr *QSGRendererInterface) ConnectGraphicsApi(f func() QSGRendererInterface__GraphicsApi) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "graphicsApi", f)
+		qt.ConnectSignal(ptr.Pointer(), "graphicsApi", f)
 	}
 }
 
 func (ptr *QSGRendererInterface) DisconnectGraphicsApi() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "graphicsApi")
+		qt.DisconnectSignal(ptr.Pointer(), "graphicsApi")
 	}
 }
 
@@ -13048,7 +13093,7 @@ func (ptr *QSGRendererInterface) GraphicsApi() QSGRendererInterface__GraphicsApi
 
 //export callbackQSGRendererInterface_ShaderCompilationType
 func callbackQSGRendererInterface_ShaderCompilationType(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shaderCompilationType"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shaderCompilationType"); signal != nil {
 		return C.longlong(signal.(func() QSGRendererInterface__ShaderCompilationType)())
 	}
 
@@ -13058,14 +13103,14 @@ func callbackQSGRendererInterface_ShaderCompilationType(ptr unsafe.Pointer) C.lo
 func (ptr *QSGRendererInterface) ConnectShaderCompilationType(f func() QSGRendererInterface__ShaderCompilationType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shaderCompilationType", f)
+		qt.ConnectSignal(ptr.Pointer(), "shaderCompilationType", f)
 	}
 }
 
 func (ptr *QSGRendererInterface) DisconnectShaderCompilationType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shaderCompilationType")
+		qt.DisconnectSignal(ptr.Pointer(), "shaderCompilationType")
 	}
 }
 
@@ -13078,7 +13123,7 @@ func (ptr *QSGRendererInterface) ShaderCompilationType() QSGRendererInterface__S
 
 //export callbackQSGRendererInterface_ShaderSourceType
 func callbackQSGRendererInterface_ShaderSourceType(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shaderSourceType"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shaderSourceType"); signal != nil {
 		return C.longlong(signal.(func() QSGRendererInterface__ShaderSourceType)())
 	}
 
@@ -13088,14 +13133,14 @@ func callbackQSGRendererInterface_ShaderSourceType(ptr unsafe.Pointer) C.longlon
 func (ptr *QSGRendererInterface) ConnectShaderSourceType(f func() QSGRendererInterface__ShaderSourceType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shaderSourceType", f)
+		qt.ConnectSignal(ptr.Pointer(), "shaderSourceType", f)
 	}
 }
 
 func (ptr *QSGRendererInterface) DisconnectShaderSourceType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shaderSourceType")
+		qt.DisconnectSignal(ptr.Pointer(), "shaderSourceType")
 	}
 }
 
@@ -13108,7 +13153,7 @@ func (ptr *QSGRendererInterface) ShaderSourceType() QSGRendererInterface__Shader
 
 //export callbackQSGRendererInterface_ShaderType
 func callbackQSGRendererInterface_ShaderType(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shaderType"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shaderType"); signal != nil {
 		return C.longlong(signal.(func() QSGRendererInterface__ShaderType)())
 	}
 
@@ -13118,14 +13163,14 @@ func callbackQSGRendererInterface_ShaderType(ptr unsafe.Pointer) C.longlong {
 func (ptr *QSGRendererInterface) ConnectShaderType(f func() QSGRendererInterface__ShaderType) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "shaderType", f)
+		qt.ConnectSignal(ptr.Pointer(), "shaderType", f)
 	}
 }
 
 func (ptr *QSGRendererInterface) DisconnectShaderType() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "shaderType")
+		qt.DisconnectSignal(ptr.Pointer(), "shaderType")
 	}
 }
 
@@ -13138,7 +13183,7 @@ func (ptr *QSGRendererInterface) ShaderType() QSGRendererInterface__ShaderType {
 
 //export callbackQSGRendererInterface_GetResource
 func callbackQSGRendererInterface_GetResource(ptr unsafe.Pointer, window unsafe.Pointer, resource C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "getResource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "getResource"); signal != nil {
 		return signal.(func(*QQuickWindow, QSGRendererInterface__Resource) unsafe.Pointer)(NewQQuickWindowFromPointer(window), QSGRendererInterface__Resource(resource))
 	}
 
@@ -13148,14 +13193,14 @@ func callbackQSGRendererInterface_GetResource(ptr unsafe.Pointer, window unsafe.
 func (ptr *QSGRendererInterface) ConnectGetResource(f func(window *QQuickWindow, resource QSGRendererInterface__Resource) unsafe.Pointer) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "getResource", f)
+		qt.ConnectSignal(ptr.Pointer(), "getResource", f)
 	}
 }
 
 func (ptr *QSGRendererInterface) DisconnectGetResource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "getResource")
+		qt.DisconnectSignal(ptr.Pointer(), "getResource")
 	}
 }
 
@@ -13175,7 +13220,7 @@ func (ptr *QSGRendererInterface) GetResourceDefault(window QQuickWindow_ITF, res
 
 //export callbackQSGRendererInterface_GetResource2
 func callbackQSGRendererInterface_GetResource2(ptr unsafe.Pointer, window unsafe.Pointer, resource C.struct_QtQuick_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "getResource2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "getResource2"); signal != nil {
 		return signal.(func(*QQuickWindow, string) unsafe.Pointer)(NewQQuickWindowFromPointer(window), cGoUnpackString(resource))
 	}
 
@@ -13185,14 +13230,14 @@ func callbackQSGRendererInterface_GetResource2(ptr unsafe.Pointer, window unsafe
 func (ptr *QSGRendererInterface) ConnectGetResource2(f func(window *QQuickWindow, resource string) unsafe.Pointer) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "getResource2", f)
+		qt.ConnectSignal(ptr.Pointer(), "getResource2", f)
 	}
 }
 
 func (ptr *QSGRendererInterface) DisconnectGetResource2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "getResource2")
+		qt.DisconnectSignal(ptr.Pointer(), "getResource2")
 	}
 }
 
@@ -13256,7 +13301,7 @@ func NewQSGSimpleMaterialFromPointer(ptr unsafe.Pointer) *QSGSimpleMaterial {
 func (ptr *QSGSimpleMaterial) DestroyQSGSimpleMaterial() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13303,7 +13348,7 @@ func NewQSGSimpleMaterialShaderFromPointer(ptr unsafe.Pointer) *QSGSimpleMateria
 func (ptr *QSGSimpleMaterialShader) DestroyQSGSimpleMaterialShader() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13368,7 +13413,7 @@ const (
 
 func NewQSGTexture() *QSGTexture {
 	var tmpValue = NewQSGTextureFromPointer(C.QSGTexture_NewQSGTexture())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -13376,7 +13421,7 @@ func NewQSGTexture() *QSGTexture {
 
 //export callbackQSGTexture_Bind
 func callbackQSGTexture_Bind(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bind"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bind"); signal != nil {
 		signal.(func())()
 	}
 
@@ -13385,14 +13430,14 @@ func callbackQSGTexture_Bind(ptr unsafe.Pointer) {
 func (ptr *QSGTexture) ConnectBind(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "bind", f)
+		qt.ConnectSignal(ptr.Pointer(), "bind", f)
 	}
 }
 
 func (ptr *QSGTexture) DisconnectBind() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "bind")
+		qt.DisconnectSignal(ptr.Pointer(), "bind")
 	}
 }
 
@@ -13435,7 +13480,7 @@ func (ptr *QSGTexture) UpdateBindOptions(force bool) {
 func (ptr *QSGTexture) DestroyQSGTexture() {
 	if ptr.Pointer() != nil {
 		C.QSGTexture_DestroyQSGTexture(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -13451,7 +13496,7 @@ func (ptr *QSGTexture) ConvertToNormalizedSourceRect(rect core.QRectF_ITF) *core
 
 //export callbackQSGTexture_NormalizedTextureSubRect
 func callbackQSGTexture_NormalizedTextureSubRect(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "normalizedTextureSubRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "normalizedTextureSubRect"); signal != nil {
 		return core.PointerFromQRectF(signal.(func() *core.QRectF)())
 	}
 
@@ -13461,14 +13506,14 @@ func callbackQSGTexture_NormalizedTextureSubRect(ptr unsafe.Pointer) unsafe.Poin
 func (ptr *QSGTexture) ConnectNormalizedTextureSubRect(f func() *core.QRectF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "normalizedTextureSubRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "normalizedTextureSubRect", f)
 	}
 }
 
 func (ptr *QSGTexture) DisconnectNormalizedTextureSubRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "normalizedTextureSubRect")
+		qt.DisconnectSignal(ptr.Pointer(), "normalizedTextureSubRect")
 	}
 }
 
@@ -13492,7 +13537,7 @@ func (ptr *QSGTexture) NormalizedTextureSubRectDefault() *core.QRectF {
 
 //export callbackQSGTexture_RemovedFromAtlas
 func callbackQSGTexture_RemovedFromAtlas(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removedFromAtlas"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removedFromAtlas"); signal != nil {
 		return PointerFromQSGTexture(signal.(func() *QSGTexture)())
 	}
 
@@ -13502,21 +13547,21 @@ func callbackQSGTexture_RemovedFromAtlas(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGTexture) ConnectRemovedFromAtlas(f func() *QSGTexture) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "removedFromAtlas", f)
+		qt.ConnectSignal(ptr.Pointer(), "removedFromAtlas", f)
 	}
 }
 
 func (ptr *QSGTexture) DisconnectRemovedFromAtlas() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "removedFromAtlas")
+		qt.DisconnectSignal(ptr.Pointer(), "removedFromAtlas")
 	}
 }
 
 func (ptr *QSGTexture) RemovedFromAtlas() *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QSGTexture_RemovedFromAtlas(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13527,7 +13572,7 @@ func (ptr *QSGTexture) RemovedFromAtlas() *QSGTexture {
 func (ptr *QSGTexture) RemovedFromAtlasDefault() *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QSGTexture_RemovedFromAtlasDefault(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13565,7 +13610,7 @@ func (ptr *QSGTexture) VerticalWrapMode() QSGTexture__WrapMode {
 
 //export callbackQSGTexture_TextureSize
 func callbackQSGTexture_TextureSize(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureSize"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureSize"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -13575,14 +13620,14 @@ func callbackQSGTexture_TextureSize(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGTexture) ConnectTextureSize(f func() *core.QSize) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureSize", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureSize", f)
 	}
 }
 
 func (ptr *QSGTexture) DisconnectTextureSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureSize")
+		qt.DisconnectSignal(ptr.Pointer(), "textureSize")
 	}
 }
 
@@ -13597,7 +13642,7 @@ func (ptr *QSGTexture) TextureSize() *core.QSize {
 
 //export callbackQSGTexture_HasAlphaChannel
 func callbackQSGTexture_HasAlphaChannel(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasAlphaChannel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasAlphaChannel"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -13607,14 +13652,14 @@ func callbackQSGTexture_HasAlphaChannel(ptr unsafe.Pointer) C.char {
 func (ptr *QSGTexture) ConnectHasAlphaChannel(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasAlphaChannel", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasAlphaChannel", f)
 	}
 }
 
 func (ptr *QSGTexture) DisconnectHasAlphaChannel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasAlphaChannel")
+		qt.DisconnectSignal(ptr.Pointer(), "hasAlphaChannel")
 	}
 }
 
@@ -13627,7 +13672,7 @@ func (ptr *QSGTexture) HasAlphaChannel() bool {
 
 //export callbackQSGTexture_HasMipmaps
 func callbackQSGTexture_HasMipmaps(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasMipmaps"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasMipmaps"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -13637,14 +13682,14 @@ func callbackQSGTexture_HasMipmaps(ptr unsafe.Pointer) C.char {
 func (ptr *QSGTexture) ConnectHasMipmaps(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasMipmaps", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasMipmaps", f)
 	}
 }
 
 func (ptr *QSGTexture) DisconnectHasMipmaps() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasMipmaps")
+		qt.DisconnectSignal(ptr.Pointer(), "hasMipmaps")
 	}
 }
 
@@ -13657,7 +13702,7 @@ func (ptr *QSGTexture) HasMipmaps() bool {
 
 //export callbackQSGTexture_IsAtlasTexture
 func callbackQSGTexture_IsAtlasTexture(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isAtlasTexture"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isAtlasTexture"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -13667,14 +13712,14 @@ func callbackQSGTexture_IsAtlasTexture(ptr unsafe.Pointer) C.char {
 func (ptr *QSGTexture) ConnectIsAtlasTexture(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isAtlasTexture", f)
+		qt.ConnectSignal(ptr.Pointer(), "isAtlasTexture", f)
 	}
 }
 
 func (ptr *QSGTexture) DisconnectIsAtlasTexture() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isAtlasTexture")
+		qt.DisconnectSignal(ptr.Pointer(), "isAtlasTexture")
 	}
 }
 
@@ -13694,7 +13739,7 @@ func (ptr *QSGTexture) IsAtlasTextureDefault() bool {
 
 //export callbackQSGTexture_TextureId
 func callbackQSGTexture_TextureId(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureId"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureId"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -13704,14 +13749,14 @@ func callbackQSGTexture_TextureId(ptr unsafe.Pointer) C.int {
 func (ptr *QSGTexture) ConnectTextureId(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureId", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureId", f)
 	}
 }
 
 func (ptr *QSGTexture) DisconnectTextureId() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureId")
+		qt.DisconnectSignal(ptr.Pointer(), "textureId")
 	}
 }
 
@@ -13744,7 +13789,7 @@ func (ptr *QSGTexture) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSGTexture) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGTexture___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13765,7 +13810,7 @@ func (ptr *QSGTexture) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSGTexture) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGTexture___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13786,7 +13831,7 @@ func (ptr *QSGTexture) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSGTexture) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGTexture___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13807,7 +13852,7 @@ func (ptr *QSGTexture) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSGTexture) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGTexture___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -13827,7 +13872,7 @@ func (ptr *QSGTexture) __children_newList() unsafe.Pointer {
 
 //export callbackQSGTexture_Event
 func callbackQSGTexture_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -13843,7 +13888,7 @@ func (ptr *QSGTexture) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSGTexture_EventFilter
 func callbackQSGTexture_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -13859,7 +13904,7 @@ func (ptr *QSGTexture) EventFilterDefault(watched core.QObject_ITF, event core.Q
 
 //export callbackQSGTexture_ChildEvent
 func callbackQSGTexture_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSGTextureFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -13874,7 +13919,7 @@ func (ptr *QSGTexture) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSGTexture_ConnectNotify
 func callbackQSGTexture_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSGTextureFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -13889,7 +13934,7 @@ func (ptr *QSGTexture) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSGTexture_CustomEvent
 func callbackQSGTexture_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSGTextureFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -13904,7 +13949,7 @@ func (ptr *QSGTexture) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSGTexture_DeleteLater
 func callbackQSGTexture_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGTextureFromPointer(ptr).DeleteLaterDefault()
@@ -13914,14 +13959,14 @@ func callbackQSGTexture_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSGTexture) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSGTexture_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGTexture_Destroyed
 func callbackQSGTexture_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -13929,7 +13974,7 @@ func callbackQSGTexture_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSGTexture_DisconnectNotify
 func callbackQSGTexture_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSGTextureFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -13944,7 +13989,7 @@ func (ptr *QSGTexture) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSGTexture_ObjectNameChanged
 func callbackQSGTexture_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -13952,7 +13997,7 @@ func callbackQSGTexture_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struc
 
 //export callbackQSGTexture_TimerEvent
 func callbackQSGTexture_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSGTextureFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -13967,7 +14012,7 @@ func (ptr *QSGTexture) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSGTexture_MetaObject
 func callbackQSGTexture_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -14023,7 +14068,7 @@ func NewQSGTextureMaterialFromPointer(ptr unsafe.Pointer) *QSGTextureMaterial {
 func (ptr *QSGTextureMaterial) DestroyQSGTextureMaterial() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14070,14 +14115,14 @@ func NewQSGTextureProviderFromPointer(ptr unsafe.Pointer) *QSGTextureProvider {
 func (ptr *QSGTextureProvider) DestroyQSGTextureProvider() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGTextureProvider_TextureChanged
 func callbackQSGTextureProvider_TextureChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "textureChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "textureChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -14086,14 +14131,14 @@ func callbackQSGTextureProvider_TextureChanged(ptr unsafe.Pointer) {
 func (ptr *QSGTextureProvider) ConnectTextureChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSGTextureProvider_ConnectTextureChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "textureChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "textureChanged", f)
 	}
 }
 
 func (ptr *QSGTextureProvider) DisconnectTextureChanged() {
 	if ptr.Pointer() != nil {
 		C.QSGTextureProvider_DisconnectTextureChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "textureChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "textureChanged")
 	}
 }
 
@@ -14105,7 +14150,7 @@ func (ptr *QSGTextureProvider) TextureChanged() {
 
 //export callbackQSGTextureProvider_Texture
 func callbackQSGTextureProvider_Texture(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "texture"); signal != nil {
+	if signal := qt.GetSignal(ptr, "texture"); signal != nil {
 		return PointerFromQSGTexture(signal.(func() *QSGTexture)())
 	}
 
@@ -14115,21 +14160,21 @@ func callbackQSGTextureProvider_Texture(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSGTextureProvider) ConnectTexture(f func() *QSGTexture) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "texture", f)
+		qt.ConnectSignal(ptr.Pointer(), "texture", f)
 	}
 }
 
 func (ptr *QSGTextureProvider) DisconnectTexture() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "texture")
+		qt.DisconnectSignal(ptr.Pointer(), "texture")
 	}
 }
 
 func (ptr *QSGTextureProvider) Texture() *QSGTexture {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSGTextureFromPointer(C.QSGTextureProvider_Texture(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14159,7 +14204,7 @@ func (ptr *QSGTextureProvider) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSGTextureProvider) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGTextureProvider___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14180,7 +14225,7 @@ func (ptr *QSGTextureProvider) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSGTextureProvider) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGTextureProvider___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14201,7 +14246,7 @@ func (ptr *QSGTextureProvider) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSGTextureProvider) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGTextureProvider___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14222,7 +14267,7 @@ func (ptr *QSGTextureProvider) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSGTextureProvider) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSGTextureProvider___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -14242,7 +14287,7 @@ func (ptr *QSGTextureProvider) __children_newList() unsafe.Pointer {
 
 //export callbackQSGTextureProvider_Event
 func callbackQSGTextureProvider_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -14258,7 +14303,7 @@ func (ptr *QSGTextureProvider) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSGTextureProvider_EventFilter
 func callbackQSGTextureProvider_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -14274,7 +14319,7 @@ func (ptr *QSGTextureProvider) EventFilterDefault(watched core.QObject_ITF, even
 
 //export callbackQSGTextureProvider_ChildEvent
 func callbackQSGTextureProvider_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSGTextureProviderFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -14289,7 +14334,7 @@ func (ptr *QSGTextureProvider) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSGTextureProvider_ConnectNotify
 func callbackQSGTextureProvider_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSGTextureProviderFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -14304,7 +14349,7 @@ func (ptr *QSGTextureProvider) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSGTextureProvider_CustomEvent
 func callbackQSGTextureProvider_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSGTextureProviderFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -14319,7 +14364,7 @@ func (ptr *QSGTextureProvider) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSGTextureProvider_DeleteLater
 func callbackQSGTextureProvider_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSGTextureProviderFromPointer(ptr).DeleteLaterDefault()
@@ -14329,14 +14374,14 @@ func callbackQSGTextureProvider_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSGTextureProvider) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSGTextureProvider_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSGTextureProvider_Destroyed
 func callbackQSGTextureProvider_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -14344,7 +14389,7 @@ func callbackQSGTextureProvider_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer
 
 //export callbackQSGTextureProvider_DisconnectNotify
 func callbackQSGTextureProvider_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSGTextureProviderFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -14359,7 +14404,7 @@ func (ptr *QSGTextureProvider) DisconnectNotifyDefault(sign core.QMetaMethod_ITF
 
 //export callbackQSGTextureProvider_ObjectNameChanged
 func callbackQSGTextureProvider_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtQuick_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -14367,7 +14412,7 @@ func callbackQSGTextureProvider_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQSGTextureProvider_TimerEvent
 func callbackQSGTextureProvider_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSGTextureProviderFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -14382,7 +14427,7 @@ func (ptr *QSGTextureProvider) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSGTextureProvider_MetaObject
 func callbackQSGTextureProvider_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -14447,7 +14492,7 @@ func (ptr *QSGTransformNode) SetMatrix(matrix gui.QMatrix4x4_ITF) {
 func (ptr *QSGTransformNode) DestroyQSGTransformNode() {
 	if ptr.Pointer() != nil {
 		C.QSGTransformNode_DestroyQSGTransformNode(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14501,7 +14546,7 @@ func NewQSGVertexColorMaterialFromPointer(ptr unsafe.Pointer) *QSGVertexColorMat
 func (ptr *QSGVertexColorMaterial) DestroyQSGVertexColorMaterial() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -14512,7 +14557,7 @@ func NewQSGVertexColorMaterial() *QSGVertexColorMaterial {
 
 //export callbackQSGVertexColorMaterial_CreateShader
 func callbackQSGVertexColorMaterial_CreateShader(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createShader"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createShader"); signal != nil {
 		return PointerFromQSGMaterialShader(signal.(func() *QSGMaterialShader)())
 	}
 
@@ -14535,7 +14580,7 @@ func (ptr *QSGVertexColorMaterial) CreateShaderDefault() *QSGMaterialShader {
 
 //export callbackQSGVertexColorMaterial_Type
 func callbackQSGVertexColorMaterial_Type(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return PointerFromQSGMaterialType(signal.(func() *QSGMaterialType)())
 	}
 
@@ -242,6 +242,8 @@ double QQuickItem_Z(void* ptr);
 int QQuickItem___grabTouchPoints_ids_atList(void* ptr, int i);
 void QQuickItem___grabTouchPoints_ids_setList(void* ptr, int i);
 void* QQuickItem___grabTouchPoints_ids_newList(void* ptr);
+void* QQuickItem___grabTouchPoints_ids_newListBuffer(void* ptr, void* data, int count);
+void QQuickItem___grabTouchPoints_ids_fillList(void* ptr, void* data);
 void* QQuickItem___childItems_atList(void* ptr, int i);
 void QQuickItem___childItems_setList(void* ptr, void* i);
 void* QQuickItem___childItems_newList(void* ptr);
@@ -11,13 +11,50 @@
 #include <QString>
 #include <QUrl>
 #include <sailfishapp.h>
+#include <QStringList>
+#include <QtEndian>
+#include <cstdlib>
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 void* SailfishApp_SailfishApp_Application(int argc, char* argv)
 {
 	static int argcs = argc;
 	static char** argvs = static_cast<char**>(malloc(argcs * sizeof(char*)));
 
-	QList<QByteArray> aList = QByteArray(argv).split('|');
+	QList<QByteArray> aList = goUnpackByteArrayList(argv);
 	for (int i = 0; i < argcs; i++)
 		argvs[i] = (new QByteArray(aList.at(i)))->data();
 
@@ -29,7 +66,7 @@ int SailfishApp_SailfishApp_Main(int argc, char* argv)
 	static int argcs = argc;
 	static char** argvs = static_cast<char**>(malloc(argcs * sizeof(char*)));
 
-	QList<QByteArray> aList = QByteArray(argv).split('|');
+	QList<QByteArray> aList = goUnpackByteArrayList(argv);
 	for (int i = 0; i < argcs; i++)
 		argvs[i] = (new QByteArray(aList.at(i)))->data();
 
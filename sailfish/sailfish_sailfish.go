@@ -8,13 +8,11 @@ package sailfish
 //#include "sailfish_sailfish.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"github.com/therecipe/qt/gui"
 	"github.com/therecipe/qt/quick"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -24,6 +22,43 @@ func cGoUnpackString(s C.struct_QtSailfish_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtSailfish_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtSailfish_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type SailfishApp struct {
 	ptr unsafe.Pointer
@@ -71,40 +106,40 @@ func (ptr *SailfishApp) DestroySailfishApp() {
 }
 
 func SailfishApp_Application(argc int, argv []string) *gui.QGuiApplication {
-	var argvC = C.CString(strings.Join(argv, "|"))
+	var argvC = cGoPackStringList(argv)
 	defer C.free(unsafe.Pointer(argvC))
 	var tmpValue = gui.NewQGuiApplicationFromPointer(C.SailfishApp_SailfishApp_Application(C.int(int32(argc)), argvC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
 }
 
 func (ptr *SailfishApp) Application(argc int, argv []string) *gui.QGuiApplication {
-	var argvC = C.CString(strings.Join(argv, "|"))
+	var argvC = cGoPackStringList(argv)
 	defer C.free(unsafe.Pointer(argvC))
 	var tmpValue = gui.NewQGuiApplicationFromPointer(C.SailfishApp_SailfishApp_Application(C.int(int32(argc)), argvC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
 }
 
 func SailfishApp_Main(argc int, argv []string) int {
-	var argvC = C.CString(strings.Join(argv, "|"))
+	var argvC = cGoPackStringList(argv)
 	defer C.free(unsafe.Pointer(argvC))
 	return int(int32(C.SailfishApp_SailfishApp_Main(C.int(int32(argc)), argvC)))
 }
 
 func (ptr *SailfishApp) Main(argc int, argv []string) int {
-	var argvC = C.CString(strings.Join(argv, "|"))
+	var argvC = cGoPackStringList(argv)
 	defer C.free(unsafe.Pointer(argvC))
 	return int(int32(C.SailfishApp_SailfishApp_Main(C.int(int32(argc)), argvC)))
 }
 
 func SailfishApp_CreateView() *quick.QQuickView {
 	var tmpValue = quick.NewQQuickViewFromPointer(C.SailfishApp_SailfishApp_CreateView())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -112,7 +147,7 @@ func SailfishApp_CreateView() *quick.QQuickView {
 
 func (ptr *SailfishApp) CreateView() *quick.QQuickView {
 	var tmpValue = quick.NewQQuickViewFromPointer(C.SailfishApp_SailfishApp_CreateView())
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
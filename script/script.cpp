@@ -35,6 +35,75 @@
 #include <QTimer>
 #include <QTimerEvent>
 #include <QVariant>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 class MyQScriptClass: public QScriptClass
 {
@@ -239,7 +308,7 @@ struct QtScript_PackedString QScriptContext_ToString(void* ptr)
 
 struct QtScript_PackedString QScriptContext_Backtrace(void* ptr)
 {
-	return ({ QByteArray t5c5475 = static_cast<QScriptContext*>(ptr)->backtrace().join("|").toUtf8(); QtScript_PackedString { const_cast<char*>(t5c5475.prepend("WHITESPACE").constData()+10), t5c5475.size()-10 }; });
+	return ({ long long t5c5475len; char* t5c5475 = goPackStringList(static_cast<QScriptContext*>(ptr)->backtrace(), &t5c5475len); QtScript_PackedString { t5c5475, t5c5475len }; });
 }
 
 char QScriptContext_IsCalledAsConstructor(void* ptr)
@@ -289,7 +358,7 @@ struct QtScript_PackedString QScriptContextInfo_FunctionName(void* ptr)
 
 struct QtScript_PackedString QScriptContextInfo_FunctionParameterNames(void* ptr)
 {
-	return ({ QByteArray te54f54 = static_cast<QScriptContextInfo*>(ptr)->functionParameterNames().join("|").toUtf8(); QtScript_PackedString { const_cast<char*>(te54f54.prepend("WHITESPACE").constData()+10), te54f54.size()-10 }; });
+	return ({ long long te54f54len; char* te54f54 = goPackStringList(static_cast<QScriptContextInfo*>(ptr)->functionParameterNames(), &te54f54len); QtScript_PackedString { te54f54, te54f54len }; });
 }
 
 char QScriptContextInfo_IsNull(void* ptr)
@@ -554,17 +623,17 @@ void* QScriptEngine_UncaughtException(void* ptr)
 
 struct QtScript_PackedString QScriptEngine_AvailableExtensions(void* ptr)
 {
-	return ({ QByteArray tf41e6e = static_cast<QScriptEngine*>(ptr)->availableExtensions().join("|").toUtf8(); QtScript_PackedString { const_cast<char*>(tf41e6e.prepend("WHITESPACE").constData()+10), tf41e6e.size()-10 }; });
+	return ({ long long tf41e6elen; char* tf41e6e = goPackStringList(static_cast<QScriptEngine*>(ptr)->availableExtensions(), &tf41e6elen); QtScript_PackedString { tf41e6e, tf41e6elen }; });
 }
 
 struct QtScript_PackedString QScriptEngine_ImportedExtensions(void* ptr)
 {
-	return ({ QByteArray td77625 = static_cast<QScriptEngine*>(ptr)->importedExtensions().join("|").toUtf8(); QtScript_PackedString { const_cast<char*>(td77625.prepend("WHITESPACE").constData()+10), td77625.size()-10 }; });
+	return ({ long long td77625len; char* td77625 = goPackStringList(static_cast<QScriptEngine*>(ptr)->importedExtensions(), &td77625len); QtScript_PackedString { td77625, td77625len }; });
 }
 
 struct QtScript_PackedString QScriptEngine_UncaughtExceptionBacktrace(void* ptr)
 {
-	return ({ QByteArray t6a16bc = static_cast<QScriptEngine*>(ptr)->uncaughtExceptionBacktrace().join("|").toUtf8(); QtScript_PackedString { const_cast<char*>(t6a16bc.prepend("WHITESPACE").constData()+10), t6a16bc.size()-10 }; });
+	return ({ long long t6a16bclen; char* t6a16bc = goPackStringList(static_cast<QScriptEngine*>(ptr)->uncaughtExceptionBacktrace(), &t6a16bclen); QtScript_PackedString { t6a16bc, t6a16bclen }; });
 }
 
 char QScriptEngine_HasUncaughtException(void* ptr)
@@ -860,7 +929,7 @@ class MyQScriptExtensionPlugin: public QScriptExtensionPlugin
 public:
 	MyQScriptExtensionPlugin(QObject *parent) : QScriptExtensionPlugin(parent) {};
 	void initialize(const QString & key, QScriptEngine * engine) { QByteArray ta62f22 = key.toUtf8(); QtScript_PackedString keyPacked = { const_cast<char*>(ta62f22.prepend("WHITESPACE").constData()+10), ta62f22.size()-10 };callbackQScriptExtensionPlugin_Initialize(this, keyPacked, engine); };
-	QStringList keys() const { return QString(callbackQScriptExtensionPlugin_Keys(const_cast<void*>(static_cast<const void*>(this)))).split("|", QString::SkipEmptyParts); };
+	QStringList keys() const { char* tmp = callbackQScriptExtensionPlugin_Keys(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
 	bool event(QEvent * e) { return callbackQScriptExtensionPlugin_Event(this, e) != 0; };
 	bool eventFilter(QObject * watched, QEvent * event) { return callbackQScriptExtensionPlugin_EventFilter(this, watched, event) != 0; };
 	void childEvent(QChildEvent * event) { callbackQScriptExtensionPlugin_ChildEvent(this, event); };
@@ -896,7 +965,7 @@ void* QScriptExtensionPlugin_SetupPackage(void* ptr, char* key, void* engine)
 
 struct QtScript_PackedString QScriptExtensionPlugin_Keys(void* ptr)
 {
-	return ({ QByteArray tcd9b88 = static_cast<QScriptExtensionPlugin*>(ptr)->keys().join("|").toUtf8(); QtScript_PackedString { const_cast<char*>(tcd9b88.prepend("WHITESPACE").constData()+10), tcd9b88.size()-10 }; });
+	return ({ long long tcd9b88len; char* tcd9b88 = goPackStringList(static_cast<QScriptExtensionPlugin*>(ptr)->keys(), &tcd9b88len); QtScript_PackedString { tcd9b88, tcd9b88len }; });
 }
 
 void* QScriptExtensionPlugin___dynamicPropertyNames_atList(void* ptr, int i)
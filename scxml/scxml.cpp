@@ -35,6 +35,41 @@
 #include <QVariant>
 #include <QVector>
 #include <QXmlStreamReader>
+#include <QScopedPointer>
+#include <QStringList>
+#include <cstdlib>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
 
 void* QScxmlCompiler_NewQScxmlCompiler(void* reader)
 {
@@ -1474,12 +1509,12 @@ struct QtScxml_PackedString QScxmlStateMachine_SessionId(void* ptr)
 
 struct QtScxml_PackedString QScxmlStateMachine_ActiveStateNames(void* ptr, char compress)
 {
-	return ({ QByteArray t57b518 = static_cast<QScxmlStateMachine*>(ptr)->activeStateNames(compress != 0).join("|").toUtf8(); QtScxml_PackedString { const_cast<char*>(t57b518.prepend("WHITESPACE").constData()+10), t57b518.size()-10 }; });
+	return ({ long long t57b518len; char* t57b518 = goPackStringList(static_cast<QScxmlStateMachine*>(ptr)->activeStateNames(compress != 0), &t57b518len); QtScxml_PackedString { t57b518, t57b518len }; });
 }
 
 struct QtScxml_PackedString QScxmlStateMachine_StateNames(void* ptr, char compress)
 {
-	return ({ QByteArray td672b5 = static_cast<QScxmlStateMachine*>(ptr)->stateNames(compress != 0).join("|").toUtf8(); QtScxml_PackedString { const_cast<char*>(td672b5.prepend("WHITESPACE").constData()+10), td672b5.size()-10 }; });
+	return ({ long long td672b5len; char* td672b5 = goPackStringList(static_cast<QScxmlStateMachine*>(ptr)->stateNames(compress != 0), &td672b5len); QtScxml_PackedString { td672b5, td672b5len }; });
 }
 
 struct QtScxml_PackedList QScxmlStateMachine_ParseErrors(void* ptr)
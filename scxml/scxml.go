@@ -8,11 +8,9 @@ package scxml
 //#include "scxml.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -22,6 +20,43 @@ func cGoUnpackString(s C.struct_QtScxml_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtScxml_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtScxml_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QScxmlCompiler struct {
 	ptr unsafe.Pointer
@@ -69,7 +104,7 @@ func NewQScxmlCompiler(reader core.QXmlStreamReader_ITF) *QScxmlCompiler {
 func (ptr *QScxmlCompiler) Compile() *QScxmlStateMachine {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlStateMachineFromPointer(C.QScxmlCompiler_Compile(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -173,14 +208,14 @@ func NewQScxmlCppDataModelFromPointer(ptr unsafe.Pointer) *QScxmlCppDataModel {
 func (ptr *QScxmlCppDataModel) DestroyQScxmlCppDataModel() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlCppDataModel_SetScxmlProperty
 func callbackQScxmlCppDataModel_SetScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString, value unsafe.Pointer, context C.struct_QtScxml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setScxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setScxmlProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, *core.QVariant, string) bool)(cGoUnpackString(name), core.NewQVariantFromPointer(value), cGoUnpackString(context)))))
 	}
 
@@ -190,14 +225,14 @@ func callbackQScxmlCppDataModel_SetScxmlProperty(ptr unsafe.Pointer, name C.stru
 func (ptr *QScxmlCppDataModel) ConnectSetScxmlProperty(f func(name string, value *core.QVariant, context string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setScxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlCppDataModel) DisconnectSetScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setScxmlProperty")
 	}
 }
 
@@ -225,7 +260,7 @@ func (ptr *QScxmlCppDataModel) SetScxmlPropertyDefault(name string, value core.Q
 
 //export callbackQScxmlCppDataModel_Setup
 func callbackQScxmlCppDataModel_Setup(ptr unsafe.Pointer, initialDataValues C.struct_QtScxml_PackedList) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setup"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(map[string]*core.QVariant) bool)(func(l C.struct_QtScxml_PackedList) map[string]*core.QVariant {
 			var out = make(map[string]*core.QVariant, int(l.len))
 			for _, i := range NewQScxmlCppDataModelFromPointer(l.data).__setup_keyList() {
@@ -247,14 +282,14 @@ func callbackQScxmlCppDataModel_Setup(ptr unsafe.Pointer, initialDataValues C.st
 func (ptr *QScxmlCppDataModel) ConnectSetup(f func(initialDataValues map[string]*core.QVariant) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setup", f)
+		qt.ConnectSignal(ptr.Pointer(), "setup", f)
 	}
 }
 
 func (ptr *QScxmlCppDataModel) DisconnectSetup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setup")
+		qt.DisconnectSignal(ptr.Pointer(), "setup")
 	}
 }
 
@@ -292,7 +327,7 @@ func (ptr *QScxmlCppDataModel) SetScxmlEvent(event QScxmlEvent_ITF) {
 
 //export callbackQScxmlCppDataModel_ScxmlProperty
 func callbackQScxmlCppDataModel_ScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scxmlProperty"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(string) *core.QVariant)(cGoUnpackString(name)))
 	}
 
@@ -302,14 +337,14 @@ func callbackQScxmlCppDataModel_ScxmlProperty(ptr unsafe.Pointer, name C.struct_
 func (ptr *QScxmlCppDataModel) ConnectScxmlProperty(f func(name string) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "scxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "scxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlCppDataModel) DisconnectScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "scxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "scxmlProperty")
 	}
 }
 
@@ -337,7 +372,7 @@ func (ptr *QScxmlCppDataModel) ScxmlPropertyDefault(name string) *core.QVariant
 
 //export callbackQScxmlCppDataModel_HasScxmlProperty
 func callbackQScxmlCppDataModel_HasScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasScxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasScxmlProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -347,14 +382,14 @@ func callbackQScxmlCppDataModel_HasScxmlProperty(ptr unsafe.Pointer, name C.stru
 func (ptr *QScxmlCppDataModel) ConnectHasScxmlProperty(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasScxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasScxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlCppDataModel) DisconnectHasScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasScxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "hasScxmlProperty")
 	}
 }
 
@@ -434,14 +469,14 @@ func NewQScxmlDataModelFromPointer(ptr unsafe.Pointer) *QScxmlDataModel {
 func (ptr *QScxmlDataModel) DestroyQScxmlDataModel() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlDataModel_SetScxmlProperty
 func callbackQScxmlDataModel_SetScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString, value unsafe.Pointer, context C.struct_QtScxml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setScxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setScxmlProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, *core.QVariant, string) bool)(cGoUnpackString(name), core.NewQVariantFromPointer(value), cGoUnpackString(context)))))
 	}
 
@@ -451,14 +486,14 @@ func callbackQScxmlDataModel_SetScxmlProperty(ptr unsafe.Pointer, name C.struct_
 func (ptr *QScxmlDataModel) ConnectSetScxmlProperty(f func(name string, value *core.QVariant, context string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setScxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlDataModel) DisconnectSetScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setScxmlProperty")
 	}
 }
 
@@ -475,7 +510,7 @@ func (ptr *QScxmlDataModel) SetScxmlProperty(name string, value core.QVariant_IT
 
 //export callbackQScxmlDataModel_Setup
 func callbackQScxmlDataModel_Setup(ptr unsafe.Pointer, initialDataValues C.struct_QtScxml_PackedList) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setup"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(map[string]*core.QVariant) bool)(func(l C.struct_QtScxml_PackedList) map[string]*core.QVariant {
 			var out = make(map[string]*core.QVariant, int(l.len))
 			for _, i := range NewQScxmlDataModelFromPointer(l.data).__setup_keyList() {
@@ -491,14 +526,14 @@ func callbackQScxmlDataModel_Setup(ptr unsafe.Pointer, initialDataValues C.struc
 func (ptr *QScxmlDataModel) ConnectSetup(f func(initialDataValues map[string]*core.QVariant) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setup", f)
+		qt.ConnectSignal(ptr.Pointer(), "setup", f)
 	}
 }
 
 func (ptr *QScxmlDataModel) DisconnectSetup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setup")
+		qt.DisconnectSignal(ptr.Pointer(), "setup")
 	}
 }
 
@@ -523,7 +558,7 @@ func (ptr *QScxmlDataModel) SetStateMachine(stateMachine QScxmlStateMachine_ITF)
 
 //export callbackQScxmlDataModel_StateMachineChanged
 func callbackQScxmlDataModel_StateMachineChanged(ptr unsafe.Pointer, stateMachine unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stateMachineChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stateMachineChanged"); signal != nil {
 		signal.(func(*QScxmlStateMachine))(NewQScxmlStateMachineFromPointer(stateMachine))
 	}
 
@@ -532,14 +567,14 @@ func callbackQScxmlDataModel_StateMachineChanged(ptr unsafe.Pointer, stateMachin
 func (ptr *QScxmlDataModel) ConnectStateMachineChanged(f func(stateMachine *QScxmlStateMachine)) {
 	if ptr.Pointer() != nil {
 		C.QScxmlDataModel_ConnectStateMachineChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stateMachineChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "stateMachineChanged", f)
 	}
 }
 
 func (ptr *QScxmlDataModel) DisconnectStateMachineChanged() {
 	if ptr.Pointer() != nil {
 		C.QScxmlDataModel_DisconnectStateMachineChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stateMachineChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "stateMachineChanged")
 	}
 }
 
@@ -552,7 +587,7 @@ func (ptr *QScxmlDataModel) StateMachineChanged(stateMachine QScxmlStateMachine_
 func (ptr *QScxmlDataModel) StateMachine() *QScxmlStateMachine {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlStateMachineFromPointer(C.QScxmlDataModel_StateMachine(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -562,7 +597,7 @@ func (ptr *QScxmlDataModel) StateMachine() *QScxmlStateMachine {
 
 //export callbackQScxmlDataModel_ScxmlProperty
 func callbackQScxmlDataModel_ScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scxmlProperty"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(string) *core.QVariant)(cGoUnpackString(name)))
 	}
 
@@ -572,14 +607,14 @@ func callbackQScxmlDataModel_ScxmlProperty(ptr unsafe.Pointer, name C.struct_QtS
 func (ptr *QScxmlDataModel) ConnectScxmlProperty(f func(name string) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "scxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "scxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlDataModel) DisconnectScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "scxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "scxmlProperty")
 	}
 }
 
@@ -596,7 +631,7 @@ func (ptr *QScxmlDataModel) ScxmlProperty(name string) *core.QVariant {
 
 //export callbackQScxmlDataModel_HasScxmlProperty
 func callbackQScxmlDataModel_HasScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasScxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasScxmlProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -606,14 +641,14 @@ func callbackQScxmlDataModel_HasScxmlProperty(ptr unsafe.Pointer, name C.struct_
 func (ptr *QScxmlDataModel) ConnectHasScxmlProperty(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasScxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasScxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlDataModel) DisconnectHasScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasScxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "hasScxmlProperty")
 	}
 }
 
@@ -703,7 +738,7 @@ func (ptr *QScxmlDataModel) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QScxmlDataModel) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlDataModel___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -724,7 +759,7 @@ func (ptr *QScxmlDataModel) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QScxmlDataModel) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlDataModel___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -745,7 +780,7 @@ func (ptr *QScxmlDataModel) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QScxmlDataModel) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlDataModel___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -766,7 +801,7 @@ func (ptr *QScxmlDataModel) __findChildren_newList() unsafe.Pointer {
 func (ptr *QScxmlDataModel) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlDataModel___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -786,7 +821,7 @@ func (ptr *QScxmlDataModel) __children_newList() unsafe.Pointer {
 
 //export callbackQScxmlDataModel_Event
 func callbackQScxmlDataModel_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -802,7 +837,7 @@ func (ptr *QScxmlDataModel) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQScxmlDataModel_EventFilter
 func callbackQScxmlDataModel_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -818,7 +853,7 @@ func (ptr *QScxmlDataModel) EventFilterDefault(watched core.QObject_ITF, event c
 
 //export callbackQScxmlDataModel_ChildEvent
 func callbackQScxmlDataModel_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQScxmlDataModelFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -833,7 +868,7 @@ func (ptr *QScxmlDataModel) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQScxmlDataModel_ConnectNotify
 func callbackQScxmlDataModel_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScxmlDataModelFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -848,7 +883,7 @@ func (ptr *QScxmlDataModel) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQScxmlDataModel_CustomEvent
 func callbackQScxmlDataModel_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQScxmlDataModelFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -863,7 +898,7 @@ func (ptr *QScxmlDataModel) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQScxmlDataModel_DeleteLater
 func callbackQScxmlDataModel_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScxmlDataModelFromPointer(ptr).DeleteLaterDefault()
@@ -873,14 +908,14 @@ func callbackQScxmlDataModel_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QScxmlDataModel) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QScxmlDataModel_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlDataModel_Destroyed
 func callbackQScxmlDataModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -888,7 +923,7 @@ func callbackQScxmlDataModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQScxmlDataModel_DisconnectNotify
 func callbackQScxmlDataModel_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScxmlDataModelFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -903,7 +938,7 @@ func (ptr *QScxmlDataModel) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQScxmlDataModel_ObjectNameChanged
 func callbackQScxmlDataModel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtScxml_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -911,7 +946,7 @@ func callbackQScxmlDataModel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.
 
 //export callbackQScxmlDataModel_TimerEvent
 func callbackQScxmlDataModel_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQScxmlDataModelFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -926,7 +961,7 @@ func (ptr *QScxmlDataModel) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQScxmlDataModel_MetaObject
 func callbackQScxmlDataModel_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -982,14 +1017,14 @@ func NewQScxmlDynamicScxmlServiceFactoryFromPointer(ptr unsafe.Pointer) *QScxmlD
 func (ptr *QScxmlDynamicScxmlServiceFactory) DestroyQScxmlDynamicScxmlServiceFactory() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlDynamicScxmlServiceFactory_Invoke
 func callbackQScxmlDynamicScxmlServiceFactory_Invoke(ptr unsafe.Pointer, parentStateMachine unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "invoke"); signal != nil {
+	if signal := qt.GetSignal(ptr, "invoke"); signal != nil {
 		return PointerFromQScxmlInvokableService(signal.(func(*QScxmlStateMachine) *QScxmlInvokableService)(NewQScxmlStateMachineFromPointer(parentStateMachine)))
 	}
 
@@ -999,21 +1034,21 @@ func callbackQScxmlDynamicScxmlServiceFactory_Invoke(ptr unsafe.Pointer, parentS
 func (ptr *QScxmlDynamicScxmlServiceFactory) ConnectInvoke(f func(parentStateMachine *QScxmlStateMachine) *QScxmlInvokableService) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "invoke", f)
+		qt.ConnectSignal(ptr.Pointer(), "invoke", f)
 	}
 }
 
 func (ptr *QScxmlDynamicScxmlServiceFactory) DisconnectInvoke() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "invoke")
+		qt.DisconnectSignal(ptr.Pointer(), "invoke")
 	}
 }
 
 func (ptr *QScxmlDynamicScxmlServiceFactory) Invoke(parentStateMachine QScxmlStateMachine_ITF) *QScxmlInvokableService {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlInvokableServiceFromPointer(C.QScxmlDynamicScxmlServiceFactory_Invoke(ptr.Pointer(), PointerFromQScxmlStateMachine(parentStateMachine)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1024,7 +1059,7 @@ func (ptr *QScxmlDynamicScxmlServiceFactory) Invoke(parentStateMachine QScxmlSta
 func (ptr *QScxmlDynamicScxmlServiceFactory) InvokeDefault(parentStateMachine QScxmlStateMachine_ITF) *QScxmlInvokableService {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlInvokableServiceFromPointer(C.QScxmlDynamicScxmlServiceFactory_InvokeDefault(ptr.Pointer(), PointerFromQScxmlStateMachine(parentStateMachine)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1082,14 +1117,14 @@ func NewQScxmlEcmaScriptDataModelFromPointer(ptr unsafe.Pointer) *QScxmlEcmaScri
 func (ptr *QScxmlEcmaScriptDataModel) DestroyQScxmlEcmaScriptDataModel() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func NewQScxmlEcmaScriptDataModel(parent core.QObject_ITF) *QScxmlEcmaScriptDataModel {
 	var tmpValue = NewQScxmlEcmaScriptDataModelFromPointer(C.QScxmlEcmaScriptDataModel_NewQScxmlEcmaScriptDataModel(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1097,7 +1132,7 @@ func NewQScxmlEcmaScriptDataModel(parent core.QObject_ITF) *QScxmlEcmaScriptData
 
 //export callbackQScxmlEcmaScriptDataModel_SetScxmlProperty
 func callbackQScxmlEcmaScriptDataModel_SetScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString, value unsafe.Pointer, context C.struct_QtScxml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setScxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setScxmlProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, *core.QVariant, string) bool)(cGoUnpackString(name), core.NewQVariantFromPointer(value), cGoUnpackString(context)))))
 	}
 
@@ -1107,14 +1142,14 @@ func callbackQScxmlEcmaScriptDataModel_SetScxmlProperty(ptr unsafe.Pointer, name
 func (ptr *QScxmlEcmaScriptDataModel) ConnectSetScxmlProperty(f func(name string, value *core.QVariant, context string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setScxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlEcmaScriptDataModel) DisconnectSetScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setScxmlProperty")
 	}
 }
 
@@ -1142,7 +1177,7 @@ func (ptr *QScxmlEcmaScriptDataModel) SetScxmlPropertyDefault(name string, value
 
 //export callbackQScxmlEcmaScriptDataModel_Setup
 func callbackQScxmlEcmaScriptDataModel_Setup(ptr unsafe.Pointer, initialDataValues C.struct_QtScxml_PackedList) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setup"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(map[string]*core.QVariant) bool)(func(l C.struct_QtScxml_PackedList) map[string]*core.QVariant {
 			var out = make(map[string]*core.QVariant, int(l.len))
 			for _, i := range NewQScxmlEcmaScriptDataModelFromPointer(l.data).__setup_keyList() {
@@ -1164,14 +1199,14 @@ func callbackQScxmlEcmaScriptDataModel_Setup(ptr unsafe.Pointer, initialDataValu
 func (ptr *QScxmlEcmaScriptDataModel) ConnectSetup(f func(initialDataValues map[string]*core.QVariant) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setup", f)
+		qt.ConnectSignal(ptr.Pointer(), "setup", f)
 	}
 }
 
 func (ptr *QScxmlEcmaScriptDataModel) DisconnectSetup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setup")
+		qt.DisconnectSignal(ptr.Pointer(), "setup")
 	}
 }
 
@@ -1203,7 +1238,7 @@ func (ptr *QScxmlEcmaScriptDataModel) SetupDefault(initialDataValues map[string]
 
 //export callbackQScxmlEcmaScriptDataModel_SetScxmlEvent
 func callbackQScxmlEcmaScriptDataModel_SetScxmlEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setScxmlEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setScxmlEvent"); signal != nil {
 		signal.(func(*QScxmlEvent))(NewQScxmlEventFromPointer(event))
 	} else {
 		NewQScxmlEcmaScriptDataModelFromPointer(ptr).SetScxmlEventDefault(NewQScxmlEventFromPointer(event))
@@ -1213,14 +1248,14 @@ func callbackQScxmlEcmaScriptDataModel_SetScxmlEvent(ptr unsafe.Pointer, event u
 func (ptr *QScxmlEcmaScriptDataModel) ConnectSetScxmlEvent(f func(event *QScxmlEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "setScxmlEvent", f)
 	}
 }
 
 func (ptr *QScxmlEcmaScriptDataModel) DisconnectSetScxmlEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "setScxmlEvent")
 	}
 }
 
@@ -1238,7 +1273,7 @@ func (ptr *QScxmlEcmaScriptDataModel) SetScxmlEventDefault(event QScxmlEvent_ITF
 
 //export callbackQScxmlEcmaScriptDataModel_ScxmlProperty
 func callbackQScxmlEcmaScriptDataModel_ScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scxmlProperty"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(string) *core.QVariant)(cGoUnpackString(name)))
 	}
 
@@ -1248,14 +1283,14 @@ func callbackQScxmlEcmaScriptDataModel_ScxmlProperty(ptr unsafe.Pointer, name C.
 func (ptr *QScxmlEcmaScriptDataModel) ConnectScxmlProperty(f func(name string) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "scxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "scxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlEcmaScriptDataModel) DisconnectScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "scxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "scxmlProperty")
 	}
 }
 
@@ -1283,7 +1318,7 @@ func (ptr *QScxmlEcmaScriptDataModel) ScxmlPropertyDefault(name string) *core.QV
 
 //export callbackQScxmlEcmaScriptDataModel_HasScxmlProperty
 func callbackQScxmlEcmaScriptDataModel_HasScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasScxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasScxmlProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -1293,14 +1328,14 @@ func callbackQScxmlEcmaScriptDataModel_HasScxmlProperty(ptr unsafe.Pointer, name
 func (ptr *QScxmlEcmaScriptDataModel) ConnectHasScxmlProperty(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasScxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasScxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlEcmaScriptDataModel) DisconnectHasScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasScxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "hasScxmlProperty")
 	}
 }
 
@@ -1690,14 +1725,14 @@ func NewQScxmlInvokableServiceFromPointer(ptr unsafe.Pointer) *QScxmlInvokableSe
 func (ptr *QScxmlInvokableService) DestroyQScxmlInvokableService() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func NewQScxmlInvokableService(parentStateMachine QScxmlStateMachine_ITF, parent QScxmlInvokableServiceFactory_ITF) *QScxmlInvokableService {
 	var tmpValue = NewQScxmlInvokableServiceFromPointer(C.QScxmlInvokableService_NewQScxmlInvokableService(PointerFromQScxmlStateMachine(parentStateMachine), PointerFromQScxmlInvokableServiceFactory(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1705,7 +1740,7 @@ func NewQScxmlInvokableService(parentStateMachine QScxmlStateMachine_ITF, parent
 
 //export callbackQScxmlInvokableService_Start
 func callbackQScxmlInvokableService_Start(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1715,14 +1750,14 @@ func callbackQScxmlInvokableService_Start(ptr unsafe.Pointer) C.char {
 func (ptr *QScxmlInvokableService) ConnectStart(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QScxmlInvokableService) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -1735,7 +1770,7 @@ func (ptr *QScxmlInvokableService) Start() bool {
 
 //export callbackQScxmlInvokableService_PostEvent
 func callbackQScxmlInvokableService_PostEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "postEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "postEvent"); signal != nil {
 		signal.(func(*QScxmlEvent))(NewQScxmlEventFromPointer(event))
 	}
 
@@ -1744,14 +1779,14 @@ func callbackQScxmlInvokableService_PostEvent(ptr unsafe.Pointer, event unsafe.P
 func (ptr *QScxmlInvokableService) ConnectPostEvent(f func(event *QScxmlEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "postEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "postEvent", f)
 	}
 }
 
 func (ptr *QScxmlInvokableService) DisconnectPostEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "postEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "postEvent")
 	}
 }
 
@@ -1764,7 +1799,7 @@ func (ptr *QScxmlInvokableService) PostEvent(event QScxmlEvent_ITF) {
 func (ptr *QScxmlInvokableService) ParentStateMachine() *QScxmlStateMachine {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlStateMachineFromPointer(C.QScxmlInvokableService_ParentStateMachine(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1774,7 +1809,7 @@ func (ptr *QScxmlInvokableService) ParentStateMachine() *QScxmlStateMachine {
 
 //export callbackQScxmlInvokableService_Id
 func callbackQScxmlInvokableService_Id(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "id"); signal != nil {
+	if signal := qt.GetSignal(ptr, "id"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -1784,14 +1819,14 @@ func callbackQScxmlInvokableService_Id(ptr unsafe.Pointer) *C.char {
 func (ptr *QScxmlInvokableService) ConnectId(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "id", f)
+		qt.ConnectSignal(ptr.Pointer(), "id", f)
 	}
 }
 
 func (ptr *QScxmlInvokableService) DisconnectId() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "id")
+		qt.DisconnectSignal(ptr.Pointer(), "id")
 	}
 }
 
@@ -1804,7 +1839,7 @@ func (ptr *QScxmlInvokableService) Id() string {
 
 //export callbackQScxmlInvokableService_Name
 func callbackQScxmlInvokableService_Name(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "name"); signal != nil {
+	if signal := qt.GetSignal(ptr, "name"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -1814,14 +1849,14 @@ func callbackQScxmlInvokableService_Name(ptr unsafe.Pointer) *C.char {
 func (ptr *QScxmlInvokableService) ConnectName(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "name", f)
+		qt.ConnectSignal(ptr.Pointer(), "name", f)
 	}
 }
 
 func (ptr *QScxmlInvokableService) DisconnectName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "name")
+		qt.DisconnectSignal(ptr.Pointer(), "name")
 	}
 }
 
@@ -1854,7 +1889,7 @@ func (ptr *QScxmlInvokableService) __dynamicPropertyNames_newList() unsafe.Point
 func (ptr *QScxmlInvokableService) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlInvokableService___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1875,7 +1910,7 @@ func (ptr *QScxmlInvokableService) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QScxmlInvokableService) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlInvokableService___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1896,7 +1931,7 @@ func (ptr *QScxmlInvokableService) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QScxmlInvokableService) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlInvokableService___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1917,7 +1952,7 @@ func (ptr *QScxmlInvokableService) __findChildren_newList() unsafe.Pointer {
 func (ptr *QScxmlInvokableService) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlInvokableService___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1937,7 +1972,7 @@ func (ptr *QScxmlInvokableService) __children_newList() unsafe.Pointer {
 
 //export callbackQScxmlInvokableService_Event
 func callbackQScxmlInvokableService_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -1953,7 +1988,7 @@ func (ptr *QScxmlInvokableService) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQScxmlInvokableService_EventFilter
 func callbackQScxmlInvokableService_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -1969,7 +2004,7 @@ func (ptr *QScxmlInvokableService) EventFilterDefault(watched core.QObject_ITF,
 
 //export callbackQScxmlInvokableService_ChildEvent
 func callbackQScxmlInvokableService_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQScxmlInvokableServiceFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -1984,7 +2019,7 @@ func (ptr *QScxmlInvokableService) ChildEventDefault(event core.QChildEvent_ITF)
 
 //export callbackQScxmlInvokableService_ConnectNotify
 func callbackQScxmlInvokableService_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScxmlInvokableServiceFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1999,7 +2034,7 @@ func (ptr *QScxmlInvokableService) ConnectNotifyDefault(sign core.QMetaMethod_IT
 
 //export callbackQScxmlInvokableService_CustomEvent
 func callbackQScxmlInvokableService_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQScxmlInvokableServiceFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -2014,7 +2049,7 @@ func (ptr *QScxmlInvokableService) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQScxmlInvokableService_DeleteLater
 func callbackQScxmlInvokableService_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScxmlInvokableServiceFromPointer(ptr).DeleteLaterDefault()
@@ -2024,14 +2059,14 @@ func callbackQScxmlInvokableService_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QScxmlInvokableService) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QScxmlInvokableService_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlInvokableService_Destroyed
 func callbackQScxmlInvokableService_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -2039,7 +2074,7 @@ func callbackQScxmlInvokableService_Destroyed(ptr unsafe.Pointer, obj unsafe.Poi
 
 //export callbackQScxmlInvokableService_DisconnectNotify
 func callbackQScxmlInvokableService_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScxmlInvokableServiceFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -2054,7 +2089,7 @@ func (ptr *QScxmlInvokableService) DisconnectNotifyDefault(sign core.QMetaMethod
 
 //export callbackQScxmlInvokableService_ObjectNameChanged
 func callbackQScxmlInvokableService_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtScxml_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -2062,7 +2097,7 @@ func callbackQScxmlInvokableService_ObjectNameChanged(ptr unsafe.Pointer, object
 
 //export callbackQScxmlInvokableService_TimerEvent
 func callbackQScxmlInvokableService_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQScxmlInvokableServiceFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -2077,7 +2112,7 @@ func (ptr *QScxmlInvokableService) TimerEventDefault(event core.QTimerEvent_ITF)
 
 //export callbackQScxmlInvokableService_MetaObject
 func callbackQScxmlInvokableService_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -2133,14 +2168,14 @@ func NewQScxmlInvokableServiceFactoryFromPointer(ptr unsafe.Pointer) *QScxmlInvo
 func (ptr *QScxmlInvokableServiceFactory) DestroyQScxmlInvokableServiceFactory() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlInvokableServiceFactory_Invoke
 func callbackQScxmlInvokableServiceFactory_Invoke(ptr unsafe.Pointer, parentStateMachine unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "invoke"); signal != nil {
+	if signal := qt.GetSignal(ptr, "invoke"); signal != nil {
 		return PointerFromQScxmlInvokableService(signal.(func(*QScxmlStateMachine) *QScxmlInvokableService)(NewQScxmlStateMachineFromPointer(parentStateMachine)))
 	}
 
@@ -2150,21 +2185,21 @@ func callbackQScxmlInvokableServiceFactory_Invoke(ptr unsafe.Pointer, parentStat
 func (ptr *QScxmlInvokableServiceFactory) ConnectInvoke(f func(parentStateMachine *QScxmlStateMachine) *QScxmlInvokableService) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "invoke", f)
+		qt.ConnectSignal(ptr.Pointer(), "invoke", f)
 	}
 }
 
 func (ptr *QScxmlInvokableServiceFactory) DisconnectInvoke() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "invoke")
+		qt.DisconnectSignal(ptr.Pointer(), "invoke")
 	}
 }
 
 func (ptr *QScxmlInvokableServiceFactory) Invoke(parentStateMachine QScxmlStateMachine_ITF) *QScxmlInvokableService {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlInvokableServiceFromPointer(C.QScxmlInvokableServiceFactory_Invoke(ptr.Pointer(), PointerFromQScxmlStateMachine(parentStateMachine)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2210,7 +2245,7 @@ func (ptr *QScxmlInvokableServiceFactory) __dynamicPropertyNames_newList() unsaf
 func (ptr *QScxmlInvokableServiceFactory) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlInvokableServiceFactory___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2231,7 +2266,7 @@ func (ptr *QScxmlInvokableServiceFactory) __findChildren_newList2() unsafe.Point
 func (ptr *QScxmlInvokableServiceFactory) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlInvokableServiceFactory___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2252,7 +2287,7 @@ func (ptr *QScxmlInvokableServiceFactory) __findChildren_newList3() unsafe.Point
 func (ptr *QScxmlInvokableServiceFactory) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlInvokableServiceFactory___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2273,7 +2308,7 @@ func (ptr *QScxmlInvokableServiceFactory) __findChildren_newList() unsafe.Pointe
 func (ptr *QScxmlInvokableServiceFactory) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlInvokableServiceFactory___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2293,7 +2328,7 @@ func (ptr *QScxmlInvokableServiceFactory) __children_newList() unsafe.Pointer {
 
 //export callbackQScxmlInvokableServiceFactory_Event
 func callbackQScxmlInvokableServiceFactory_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -2309,7 +2344,7 @@ func (ptr *QScxmlInvokableServiceFactory) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQScxmlInvokableServiceFactory_EventFilter
 func callbackQScxmlInvokableServiceFactory_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -2325,7 +2360,7 @@ func (ptr *QScxmlInvokableServiceFactory) EventFilterDefault(watched core.QObjec
 
 //export callbackQScxmlInvokableServiceFactory_ChildEvent
 func callbackQScxmlInvokableServiceFactory_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQScxmlInvokableServiceFactoryFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -2340,7 +2375,7 @@ func (ptr *QScxmlInvokableServiceFactory) ChildEventDefault(event core.QChildEve
 
 //export callbackQScxmlInvokableServiceFactory_ConnectNotify
 func callbackQScxmlInvokableServiceFactory_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScxmlInvokableServiceFactoryFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -2355,7 +2390,7 @@ func (ptr *QScxmlInvokableServiceFactory) ConnectNotifyDefault(sign core.QMetaMe
 
 //export callbackQScxmlInvokableServiceFactory_CustomEvent
 func callbackQScxmlInvokableServiceFactory_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQScxmlInvokableServiceFactoryFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -2370,7 +2405,7 @@ func (ptr *QScxmlInvokableServiceFactory) CustomEventDefault(event core.QEvent_I
 
 //export callbackQScxmlInvokableServiceFactory_DeleteLater
 func callbackQScxmlInvokableServiceFactory_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScxmlInvokableServiceFactoryFromPointer(ptr).DeleteLaterDefault()
@@ -2380,14 +2415,14 @@ func callbackQScxmlInvokableServiceFactory_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QScxmlInvokableServiceFactory) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QScxmlInvokableServiceFactory_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlInvokableServiceFactory_Destroyed
 func callbackQScxmlInvokableServiceFactory_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -2395,7 +2430,7 @@ func callbackQScxmlInvokableServiceFactory_Destroyed(ptr unsafe.Pointer, obj uns
 
 //export callbackQScxmlInvokableServiceFactory_DisconnectNotify
 func callbackQScxmlInvokableServiceFactory_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScxmlInvokableServiceFactoryFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -2410,7 +2445,7 @@ func (ptr *QScxmlInvokableServiceFactory) DisconnectNotifyDefault(sign core.QMet
 
 //export callbackQScxmlInvokableServiceFactory_ObjectNameChanged
 func callbackQScxmlInvokableServiceFactory_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtScxml_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -2418,7 +2453,7 @@ func callbackQScxmlInvokableServiceFactory_ObjectNameChanged(ptr unsafe.Pointer,
 
 //export callbackQScxmlInvokableServiceFactory_TimerEvent
 func callbackQScxmlInvokableServiceFactory_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQScxmlInvokableServiceFactoryFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -2433,7 +2468,7 @@ func (ptr *QScxmlInvokableServiceFactory) TimerEventDefault(event core.QTimerEve
 
 //export callbackQScxmlInvokableServiceFactory_MetaObject
 func callbackQScxmlInvokableServiceFactory_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -2487,7 +2522,7 @@ func NewQScxmlNullDataModelFromPointer(ptr unsafe.Pointer) *QScxmlNullDataModel
 }
 func NewQScxmlNullDataModel(parent core.QObject_ITF) *QScxmlNullDataModel {
 	var tmpValue = NewQScxmlNullDataModelFromPointer(C.QScxmlNullDataModel_NewQScxmlNullDataModel(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2495,7 +2530,7 @@ func NewQScxmlNullDataModel(parent core.QObject_ITF) *QScxmlNullDataModel {
 
 //export callbackQScxmlNullDataModel_SetScxmlProperty
 func callbackQScxmlNullDataModel_SetScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString, value unsafe.Pointer, context C.struct_QtScxml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setScxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setScxmlProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, *core.QVariant, string) bool)(cGoUnpackString(name), core.NewQVariantFromPointer(value), cGoUnpackString(context)))))
 	}
 
@@ -2505,14 +2540,14 @@ func callbackQScxmlNullDataModel_SetScxmlProperty(ptr unsafe.Pointer, name C.str
 func (ptr *QScxmlNullDataModel) ConnectSetScxmlProperty(f func(name string, value *core.QVariant, context string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setScxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlNullDataModel) DisconnectSetScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setScxmlProperty")
 	}
 }
 
@@ -2540,7 +2575,7 @@ func (ptr *QScxmlNullDataModel) SetScxmlPropertyDefault(name string, value core.
 
 //export callbackQScxmlNullDataModel_Setup
 func callbackQScxmlNullDataModel_Setup(ptr unsafe.Pointer, initialDataValues C.struct_QtScxml_PackedList) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setup"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setup"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(map[string]*core.QVariant) bool)(func(l C.struct_QtScxml_PackedList) map[string]*core.QVariant {
 			var out = make(map[string]*core.QVariant, int(l.len))
 			for _, i := range NewQScxmlNullDataModelFromPointer(l.data).__setup_keyList() {
@@ -2562,14 +2597,14 @@ func callbackQScxmlNullDataModel_Setup(ptr unsafe.Pointer, initialDataValues C.s
 func (ptr *QScxmlNullDataModel) ConnectSetup(f func(initialDataValues map[string]*core.QVariant) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setup", f)
+		qt.ConnectSignal(ptr.Pointer(), "setup", f)
 	}
 }
 
 func (ptr *QScxmlNullDataModel) DisconnectSetup() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setup")
+		qt.DisconnectSignal(ptr.Pointer(), "setup")
 	}
 }
 
@@ -2601,7 +2636,7 @@ func (ptr *QScxmlNullDataModel) SetupDefault(initialDataValues map[string]*core.
 
 //export callbackQScxmlNullDataModel_SetScxmlEvent
 func callbackQScxmlNullDataModel_SetScxmlEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setScxmlEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setScxmlEvent"); signal != nil {
 		signal.(func(*QScxmlEvent))(NewQScxmlEventFromPointer(event))
 	} else {
 		NewQScxmlNullDataModelFromPointer(ptr).SetScxmlEventDefault(NewQScxmlEventFromPointer(event))
@@ -2611,14 +2646,14 @@ func callbackQScxmlNullDataModel_SetScxmlEvent(ptr unsafe.Pointer, event unsafe.
 func (ptr *QScxmlNullDataModel) ConnectSetScxmlEvent(f func(event *QScxmlEvent)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlEvent", f)
+		qt.ConnectSignal(ptr.Pointer(), "setScxmlEvent", f)
 	}
 }
 
 func (ptr *QScxmlNullDataModel) DisconnectSetScxmlEvent() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setScxmlEvent")
+		qt.DisconnectSignal(ptr.Pointer(), "setScxmlEvent")
 	}
 }
 
@@ -2637,14 +2672,14 @@ func (ptr *QScxmlNullDataModel) SetScxmlEventDefault(event QScxmlEvent_ITF) {
 func (ptr *QScxmlNullDataModel) DestroyQScxmlNullDataModel() {
 	if ptr.Pointer() != nil {
 		C.QScxmlNullDataModel_DestroyQScxmlNullDataModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlNullDataModel_ScxmlProperty
 func callbackQScxmlNullDataModel_ScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scxmlProperty"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(string) *core.QVariant)(cGoUnpackString(name)))
 	}
 
@@ -2654,14 +2689,14 @@ func callbackQScxmlNullDataModel_ScxmlProperty(ptr unsafe.Pointer, name C.struct
 func (ptr *QScxmlNullDataModel) ConnectScxmlProperty(f func(name string) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "scxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "scxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlNullDataModel) DisconnectScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "scxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "scxmlProperty")
 	}
 }
 
@@ -2689,7 +2724,7 @@ func (ptr *QScxmlNullDataModel) ScxmlPropertyDefault(name string) *core.QVariant
 
 //export callbackQScxmlNullDataModel_HasScxmlProperty
 func callbackQScxmlNullDataModel_HasScxmlProperty(ptr unsafe.Pointer, name C.struct_QtScxml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasScxmlProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasScxmlProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -2699,14 +2734,14 @@ func callbackQScxmlNullDataModel_HasScxmlProperty(ptr unsafe.Pointer, name C.str
 func (ptr *QScxmlNullDataModel) ConnectHasScxmlProperty(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasScxmlProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasScxmlProperty", f)
 	}
 }
 
 func (ptr *QScxmlNullDataModel) DisconnectHasScxmlProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasScxmlProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "hasScxmlProperty")
 	}
 }
 
@@ -2770,7 +2805,7 @@ func NewQScxmlStateMachineFromPointer(ptr unsafe.Pointer) *QScxmlStateMachine {
 func (ptr *QScxmlStateMachine) DestroyQScxmlStateMachine() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2779,7 +2814,7 @@ func QScxmlStateMachine_FromData(data core.QIODevice_ITF, fileName string) *QScx
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQScxmlStateMachineFromPointer(C.QScxmlStateMachine_QScxmlStateMachine_FromData(core.PointerFromQIODevice(data), fileNameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2789,7 +2824,7 @@ func (ptr *QScxmlStateMachine) FromData(data core.QIODevice_ITF, fileName string
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQScxmlStateMachineFromPointer(C.QScxmlStateMachine_QScxmlStateMachine_FromData(core.PointerFromQIODevice(data), fileNameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2799,7 +2834,7 @@ func QScxmlStateMachine_FromFile(fileName string) *QScxmlStateMachine {
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQScxmlStateMachineFromPointer(C.QScxmlStateMachine_QScxmlStateMachine_FromFile(fileNameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2809,7 +2844,7 @@ func (ptr *QScxmlStateMachine) FromFile(fileName string) *QScxmlStateMachine {
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQScxmlStateMachineFromPointer(C.QScxmlStateMachine_QScxmlStateMachine_FromFile(fileNameC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2817,7 +2852,7 @@ func (ptr *QScxmlStateMachine) FromFile(fileName string) *QScxmlStateMachine {
 
 func NewQScxmlStateMachine(metaObject core.QMetaObject_ITF, parent core.QObject_ITF) *QScxmlStateMachine {
 	var tmpValue = NewQScxmlStateMachineFromPointer(C.QScxmlStateMachine_NewQScxmlStateMachine(core.PointerFromQMetaObject(metaObject), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2838,7 +2873,7 @@ func (ptr *QScxmlStateMachine) InitialValues() map[string]*core.QVariant {
 
 //export callbackQScxmlStateMachine_Init
 func callbackQScxmlStateMachine_Init(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "init"); signal != nil {
+	if signal := qt.GetSignal(ptr, "init"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2848,14 +2883,14 @@ func callbackQScxmlStateMachine_Init(ptr unsafe.Pointer) C.char {
 func (ptr *QScxmlStateMachine) ConnectInit(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "init", f)
+		qt.ConnectSignal(ptr.Pointer(), "init", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectInit() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "init")
+		qt.DisconnectSignal(ptr.Pointer(), "init")
 	}
 }
 
@@ -2883,7 +2918,7 @@ func (ptr *QScxmlStateMachine) CancelDelayedEvent(sendId string) {
 
 //export callbackQScxmlStateMachine_DataModelChanged
 func callbackQScxmlStateMachine_DataModelChanged(ptr unsafe.Pointer, model unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataModelChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataModelChanged"); signal != nil {
 		signal.(func(*QScxmlDataModel))(NewQScxmlDataModelFromPointer(model))
 	}
 
@@ -2892,14 +2927,14 @@ func callbackQScxmlStateMachine_DataModelChanged(ptr unsafe.Pointer, model unsaf
 func (ptr *QScxmlStateMachine) ConnectDataModelChanged(f func(model *QScxmlDataModel)) {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_ConnectDataModelChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dataModelChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "dataModelChanged", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectDataModelChanged() {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_DisconnectDataModelChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dataModelChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "dataModelChanged")
 	}
 }
 
@@ -2911,7 +2946,7 @@ func (ptr *QScxmlStateMachine) DataModelChanged(model QScxmlDataModel_ITF) {
 
 //export callbackQScxmlStateMachine_Finished
 func callbackQScxmlStateMachine_Finished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "finished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "finished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -2920,14 +2955,14 @@ func callbackQScxmlStateMachine_Finished(ptr unsafe.Pointer) {
 func (ptr *QScxmlStateMachine) ConnectFinished(f func()) {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_ConnectFinished(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "finished", f)
+		qt.ConnectSignal(ptr.Pointer(), "finished", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectFinished() {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_DisconnectFinished(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "finished")
+		qt.DisconnectSignal(ptr.Pointer(), "finished")
 	}
 }
 
@@ -2939,7 +2974,7 @@ func (ptr *QScxmlStateMachine) Finished() {
 
 //export callbackQScxmlStateMachine_InitializedChanged
 func callbackQScxmlStateMachine_InitializedChanged(ptr unsafe.Pointer, initialized C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "initializedChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "initializedChanged"); signal != nil {
 		signal.(func(bool))(int8(initialized) != 0)
 	}
 
@@ -2948,14 +2983,14 @@ func callbackQScxmlStateMachine_InitializedChanged(ptr unsafe.Pointer, initializ
 func (ptr *QScxmlStateMachine) ConnectInitializedChanged(f func(initialized bool)) {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_ConnectInitializedChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "initializedChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "initializedChanged", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectInitializedChanged() {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_DisconnectInitializedChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "initializedChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "initializedChanged")
 	}
 }
 
@@ -2967,7 +3002,7 @@ func (ptr *QScxmlStateMachine) InitializedChanged(initialized bool) {
 
 //export callbackQScxmlStateMachine_InvokedServicesChanged
 func callbackQScxmlStateMachine_InvokedServicesChanged(ptr unsafe.Pointer, invokedServices C.struct_QtScxml_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "invokedServicesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "invokedServicesChanged"); signal != nil {
 		signal.(func([]*QScxmlInvokableService))(func(l C.struct_QtScxml_PackedList) []*QScxmlInvokableService {
 			var out = make([]*QScxmlInvokableService, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -2982,14 +3017,14 @@ func callbackQScxmlStateMachine_InvokedServicesChanged(ptr unsafe.Pointer, invok
 func (ptr *QScxmlStateMachine) ConnectInvokedServicesChanged(f func(invokedServices []*QScxmlInvokableService)) {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_ConnectInvokedServicesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "invokedServicesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "invokedServicesChanged", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectInvokedServicesChanged() {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_DisconnectInvokedServicesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "invokedServicesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "invokedServicesChanged")
 	}
 }
 
@@ -3007,7 +3042,7 @@ func (ptr *QScxmlStateMachine) InvokedServicesChanged(invokedServices []*QScxmlI
 
 //export callbackQScxmlStateMachine_Log
 func callbackQScxmlStateMachine_Log(ptr unsafe.Pointer, label C.struct_QtScxml_PackedString, msg C.struct_QtScxml_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "log"); signal != nil {
+	if signal := qt.GetSignal(ptr, "log"); signal != nil {
 		signal.(func(string, string))(cGoUnpackString(label), cGoUnpackString(msg))
 	}
 
@@ -3016,14 +3051,14 @@ func callbackQScxmlStateMachine_Log(ptr unsafe.Pointer, label C.struct_QtScxml_P
 func (ptr *QScxmlStateMachine) ConnectLog(f func(label string, msg string)) {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_ConnectLog(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "log", f)
+		qt.ConnectSignal(ptr.Pointer(), "log", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectLog() {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_DisconnectLog(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "log")
+		qt.DisconnectSignal(ptr.Pointer(), "log")
 	}
 }
 
@@ -3039,7 +3074,7 @@ func (ptr *QScxmlStateMachine) Log(label string, msg string) {
 
 //export callbackQScxmlStateMachine_ReachedStableState
 func callbackQScxmlStateMachine_ReachedStableState(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reachedStableState"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reachedStableState"); signal != nil {
 		signal.(func())()
 	}
 
@@ -3048,14 +3083,14 @@ func callbackQScxmlStateMachine_ReachedStableState(ptr unsafe.Pointer) {
 func (ptr *QScxmlStateMachine) ConnectReachedStableState(f func()) {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_ConnectReachedStableState(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reachedStableState", f)
+		qt.ConnectSignal(ptr.Pointer(), "reachedStableState", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectReachedStableState() {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_DisconnectReachedStableState(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reachedStableState")
+		qt.DisconnectSignal(ptr.Pointer(), "reachedStableState")
 	}
 }
 
@@ -3067,7 +3102,7 @@ func (ptr *QScxmlStateMachine) ReachedStableState() {
 
 //export callbackQScxmlStateMachine_RunningChanged
 func callbackQScxmlStateMachine_RunningChanged(ptr unsafe.Pointer, running C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "runningChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "runningChanged"); signal != nil {
 		signal.(func(bool))(int8(running) != 0)
 	}
 
@@ -3076,14 +3111,14 @@ func callbackQScxmlStateMachine_RunningChanged(ptr unsafe.Pointer, running C.cha
 func (ptr *QScxmlStateMachine) ConnectRunningChanged(f func(running bool)) {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_ConnectRunningChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "runningChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "runningChanged", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectRunningChanged() {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_DisconnectRunningChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "runningChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "runningChanged")
 	}
 }
 
@@ -3125,7 +3160,7 @@ func (ptr *QScxmlStateMachine) SetTableData(tableData QScxmlTableData_ITF) {
 
 //export callbackQScxmlStateMachine_Start
 func callbackQScxmlStateMachine_Start(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScxmlStateMachineFromPointer(ptr).StartDefault()
@@ -3135,14 +3170,14 @@ func callbackQScxmlStateMachine_Start(ptr unsafe.Pointer) {
 func (ptr *QScxmlStateMachine) ConnectStart(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -3160,7 +3195,7 @@ func (ptr *QScxmlStateMachine) StartDefault() {
 
 //export callbackQScxmlStateMachine_Stop
 func callbackQScxmlStateMachine_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScxmlStateMachineFromPointer(ptr).StopDefault()
@@ -3170,14 +3205,14 @@ func callbackQScxmlStateMachine_Stop(ptr unsafe.Pointer) {
 func (ptr *QScxmlStateMachine) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -3217,7 +3252,7 @@ func (ptr *QScxmlStateMachine) SubmitEvent3(eventName string, data core.QVariant
 
 //export callbackQScxmlStateMachine_TableDataChanged
 func callbackQScxmlStateMachine_TableDataChanged(ptr unsafe.Pointer, tableData unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tableDataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tableDataChanged"); signal != nil {
 		signal.(func(*QScxmlTableData))(NewQScxmlTableDataFromPointer(tableData))
 	}
 
@@ -3226,14 +3261,14 @@ func callbackQScxmlStateMachine_TableDataChanged(ptr unsafe.Pointer, tableData u
 func (ptr *QScxmlStateMachine) ConnectTableDataChanged(f func(tableData *QScxmlTableData)) {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_ConnectTableDataChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "tableDataChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "tableDataChanged", f)
 	}
 }
 
 func (ptr *QScxmlStateMachine) DisconnectTableDataChanged() {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_DisconnectTableDataChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "tableDataChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "tableDataChanged")
 	}
 }
 
@@ -3246,7 +3281,7 @@ func (ptr *QScxmlStateMachine) TableDataChanged(tableData QScxmlTableData_ITF) {
 func (ptr *QScxmlStateMachine) DataModel() *QScxmlDataModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlDataModelFromPointer(C.QScxmlStateMachine_DataModel(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3277,14 +3312,14 @@ func (ptr *QScxmlStateMachine) SessionId() string {
 
 func (ptr *QScxmlStateMachine) ActiveStateNames(compress bool) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QScxmlStateMachine_ActiveStateNames(ptr.Pointer(), C.char(int8(qt.GoBoolToInt(compress))))), "|")
+		return cGoUnpackStringListAndFree(C.QScxmlStateMachine_ActiveStateNames(ptr.Pointer(), C.char(int8(qt.GoBoolToInt(compress)))))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QScxmlStateMachine) StateNames(compress bool) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QScxmlStateMachine_StateNames(ptr.Pointer(), C.char(int8(qt.GoBoolToInt(compress))))), "|")
+		return cGoUnpackStringListAndFree(C.QScxmlStateMachine_StateNames(ptr.Pointer(), C.char(int8(qt.GoBoolToInt(compress)))))
 	}
 	return make([]string, 0)
 }
@@ -3436,7 +3471,7 @@ func (ptr *QScxmlStateMachine) __initialValuesChanged_keyList() []string {
 func (ptr *QScxmlStateMachine) __invokedServicesChanged_invokedServices_atList(i int) *QScxmlInvokableService {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlInvokableServiceFromPointer(C.QScxmlStateMachine___invokedServicesChanged_invokedServices_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3512,7 +3547,7 @@ func (ptr *QScxmlStateMachine) __parseErrors_newList() unsafe.Pointer {
 func (ptr *QScxmlStateMachine) __invokedServices_atList(i int) *QScxmlInvokableService {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlInvokableServiceFromPointer(C.QScxmlStateMachine___invokedServices_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3609,7 +3644,7 @@ func (ptr *QScxmlStateMachine) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QScxmlStateMachine) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlStateMachine___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3630,7 +3665,7 @@ func (ptr *QScxmlStateMachine) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QScxmlStateMachine) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlStateMachine___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3651,7 +3686,7 @@ func (ptr *QScxmlStateMachine) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QScxmlStateMachine) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlStateMachine___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3672,7 +3707,7 @@ func (ptr *QScxmlStateMachine) __findChildren_newList() unsafe.Pointer {
 func (ptr *QScxmlStateMachine) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QScxmlStateMachine___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3692,7 +3727,7 @@ func (ptr *QScxmlStateMachine) __children_newList() unsafe.Pointer {
 
 //export callbackQScxmlStateMachine_Event
 func callbackQScxmlStateMachine_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -3708,7 +3743,7 @@ func (ptr *QScxmlStateMachine) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQScxmlStateMachine_EventFilter
 func callbackQScxmlStateMachine_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -3724,7 +3759,7 @@ func (ptr *QScxmlStateMachine) EventFilterDefault(watched core.QObject_ITF, even
 
 //export callbackQScxmlStateMachine_ChildEvent
 func callbackQScxmlStateMachine_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQScxmlStateMachineFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -3739,7 +3774,7 @@ func (ptr *QScxmlStateMachine) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQScxmlStateMachine_ConnectNotify
 func callbackQScxmlStateMachine_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScxmlStateMachineFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3754,7 +3789,7 @@ func (ptr *QScxmlStateMachine) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQScxmlStateMachine_CustomEvent
 func callbackQScxmlStateMachine_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQScxmlStateMachineFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -3769,7 +3804,7 @@ func (ptr *QScxmlStateMachine) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQScxmlStateMachine_DeleteLater
 func callbackQScxmlStateMachine_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScxmlStateMachineFromPointer(ptr).DeleteLaterDefault()
@@ -3779,14 +3814,14 @@ func callbackQScxmlStateMachine_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QScxmlStateMachine) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QScxmlStateMachine_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlStateMachine_Destroyed
 func callbackQScxmlStateMachine_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -3794,7 +3829,7 @@ func callbackQScxmlStateMachine_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer
 
 //export callbackQScxmlStateMachine_DisconnectNotify
 func callbackQScxmlStateMachine_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQScxmlStateMachineFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3809,7 +3844,7 @@ func (ptr *QScxmlStateMachine) DisconnectNotifyDefault(sign core.QMetaMethod_ITF
 
 //export callbackQScxmlStateMachine_ObjectNameChanged
 func callbackQScxmlStateMachine_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtScxml_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -3817,7 +3852,7 @@ func callbackQScxmlStateMachine_ObjectNameChanged(ptr unsafe.Pointer, objectName
 
 //export callbackQScxmlStateMachine_TimerEvent
 func callbackQScxmlStateMachine_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQScxmlStateMachineFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -3832,7 +3867,7 @@ func (ptr *QScxmlStateMachine) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQScxmlStateMachine_MetaObject
 func callbackQScxmlStateMachine_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -3888,14 +3923,14 @@ func NewQScxmlStaticScxmlServiceFactoryFromPointer(ptr unsafe.Pointer) *QScxmlSt
 func (ptr *QScxmlStaticScxmlServiceFactory) DestroyQScxmlStaticScxmlServiceFactory() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlStaticScxmlServiceFactory_Invoke
 func callbackQScxmlStaticScxmlServiceFactory_Invoke(ptr unsafe.Pointer, parentStateMachine unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "invoke"); signal != nil {
+	if signal := qt.GetSignal(ptr, "invoke"); signal != nil {
 		return PointerFromQScxmlInvokableService(signal.(func(*QScxmlStateMachine) *QScxmlInvokableService)(NewQScxmlStateMachineFromPointer(parentStateMachine)))
 	}
 
@@ -3905,21 +3940,21 @@ func callbackQScxmlStaticScxmlServiceFactory_Invoke(ptr unsafe.Pointer, parentSt
 func (ptr *QScxmlStaticScxmlServiceFactory) ConnectInvoke(f func(parentStateMachine *QScxmlStateMachine) *QScxmlInvokableService) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "invoke", f)
+		qt.ConnectSignal(ptr.Pointer(), "invoke", f)
 	}
 }
 
 func (ptr *QScxmlStaticScxmlServiceFactory) DisconnectInvoke() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "invoke")
+		qt.DisconnectSignal(ptr.Pointer(), "invoke")
 	}
 }
 
 func (ptr *QScxmlStaticScxmlServiceFactory) Invoke(parentStateMachine QScxmlStateMachine_ITF) *QScxmlInvokableService {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlInvokableServiceFromPointer(C.QScxmlStaticScxmlServiceFactory_Invoke(ptr.Pointer(), PointerFromQScxmlStateMachine(parentStateMachine)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3930,7 +3965,7 @@ func (ptr *QScxmlStaticScxmlServiceFactory) Invoke(parentStateMachine QScxmlStat
 func (ptr *QScxmlStaticScxmlServiceFactory) InvokeDefault(parentStateMachine QScxmlStateMachine_ITF) *QScxmlInvokableService {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlInvokableServiceFromPointer(C.QScxmlStaticScxmlServiceFactory_InvokeDefault(ptr.Pointer(), PointerFromQScxmlStateMachine(parentStateMachine)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3986,7 +4021,7 @@ func NewQScxmlTableDataFromPointer(ptr unsafe.Pointer) *QScxmlTableData {
 
 //export callbackQScxmlTableData_DestroyQScxmlTableData
 func callbackQScxmlTableData_DestroyQScxmlTableData(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QScxmlTableData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QScxmlTableData"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQScxmlTableDataFromPointer(ptr).DestroyQScxmlTableDataDefault()
@@ -3996,21 +4031,21 @@ func callbackQScxmlTableData_DestroyQScxmlTableData(ptr unsafe.Pointer) {
 func (ptr *QScxmlTableData) ConnectDestroyQScxmlTableData(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QScxmlTableData", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QScxmlTableData", f)
 	}
 }
 
 func (ptr *QScxmlTableData) DisconnectDestroyQScxmlTableData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QScxmlTableData")
+		qt.DisconnectSignal(ptr.Pointer(), "~QScxmlTableData")
 	}
 }
 
 func (ptr *QScxmlTableData) DestroyQScxmlTableData() {
 	if ptr.Pointer() != nil {
 		C.QScxmlTableData_DestroyQScxmlTableData(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4018,14 +4053,14 @@ func (ptr *QScxmlTableData) DestroyQScxmlTableData() {
 func (ptr *QScxmlTableData) DestroyQScxmlTableDataDefault() {
 	if ptr.Pointer() != nil {
 		C.QScxmlTableData_DestroyQScxmlTableDataDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQScxmlTableData_ServiceFactory
 func callbackQScxmlTableData_ServiceFactory(ptr unsafe.Pointer, id C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "serviceFactory"); signal != nil {
+	if signal := qt.GetSignal(ptr, "serviceFactory"); signal != nil {
 		return PointerFromQScxmlInvokableServiceFactory(signal.(func(int) *QScxmlInvokableServiceFactory)(int(int32(id))))
 	}
 
@@ -4035,21 +4070,21 @@ func callbackQScxmlTableData_ServiceFactory(ptr unsafe.Pointer, id C.int) unsafe
 func (ptr *QScxmlTableData) ConnectServiceFactory(f func(id int) *QScxmlInvokableServiceFactory) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "serviceFactory", f)
+		qt.ConnectSignal(ptr.Pointer(), "serviceFactory", f)
 	}
 }
 
 func (ptr *QScxmlTableData) DisconnectServiceFactory() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "serviceFactory")
+		qt.DisconnectSignal(ptr.Pointer(), "serviceFactory")
 	}
 }
 
 func (ptr *QScxmlTableData) ServiceFactory(id int) *QScxmlInvokableServiceFactory {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQScxmlInvokableServiceFactoryFromPointer(C.QScxmlTableData_ServiceFactory(ptr.Pointer(), C.int(int32(id))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4059,7 +4094,7 @@ func (ptr *QScxmlTableData) ServiceFactory(id int) *QScxmlInvokableServiceFactor
 
 //export callbackQScxmlTableData_Name
 func callbackQScxmlTableData_Name(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "name"); signal != nil {
+	if signal := qt.GetSignal(ptr, "name"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -4069,14 +4104,14 @@ func callbackQScxmlTableData_Name(ptr unsafe.Pointer) *C.char {
 func (ptr *QScxmlTableData) ConnectName(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "name", f)
+		qt.ConnectSignal(ptr.Pointer(), "name", f)
 	}
 }
 
 func (ptr *QScxmlTableData) DisconnectName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "name")
+		qt.DisconnectSignal(ptr.Pointer(), "name")
 	}
 }
 
@@ -82,6 +82,75 @@
 #include <QTimer>
 #include <QTimerEvent>
 #include <QVariant>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 class MyQAccelerometer: public QAccelerometer
 {
@@ -1736,14 +1805,14 @@ void* QSensor_QSensor_DefaultSensorForType(void* ty)
 	return new QByteArray(QSensor::defaultSensorForType(*static_cast<QByteArray*>(ty)));
 }
 
-struct QtSensors_PackedList QSensor_QSensor_SensorTypes()
+struct QtSensors_PackedString QSensor_QSensor_SensorTypes()
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(QSensor::sensorTypes()); QtSensors_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long t6a4e95len; char* t6a4e95 = goPackStringList(QSensor::sensorTypes(), &t6a4e95len); QtSensors_PackedString { t6a4e95, t6a4e95len }; });
 }
 
-struct QtSensors_PackedList QSensor_QSensor_SensorsForType(void* ty)
+struct QtSensors_PackedString QSensor_QSensor_SensorsForType(void* ty)
 {
-	return ({ QList<QByteArray>* tmpValue = new QList<QByteArray>(QSensor::sensorsForType(*static_cast<QByteArray*>(ty))); QtSensors_PackedList { tmpValue, tmpValue->size() }; });
+	return ({ long long t54e55flen; char* t54e55f = goPackStringList(QSensor::sensorsForType(*static_cast<QByteArray*>(ty)), &t54e55flen); QtSensors_PackedString { t54e55f, t54e55flen }; });
 }
 
 void* QSensor_NewQSensor(void* ty, void* parent)
@@ -3014,7 +3083,7 @@ public:
 
 void* QSensorGesture_NewQSensorGesture(char* ids, void* parent)
 {
-	return new MyQSensorGesture(QString(ids).split("|", QString::SkipEmptyParts), static_cast<QObject*>(parent));
+	return new MyQSensorGesture(goUnpackStringList(ids), static_cast<QObject*>(parent));
 }
 
 char QSensorGesture_IsActive(void* ptr)
@@ -3060,17 +3129,17 @@ void QSensorGesture_DestroyQSensorGesture(void* ptr)
 
 struct QtSensors_PackedString QSensorGesture_GestureSignals(void* ptr)
 {
-	return ({ QByteArray t7a3c3d = static_cast<QSensorGesture*>(ptr)->gestureSignals().join("|").toUtf8(); QtSensors_PackedString { const_cast<char*>(t7a3c3d.prepend("WHITESPACE").constData()+10), t7a3c3d.size()-10 }; });
+	return ({ long long t7a3c3dlen; char* t7a3c3d = goPackStringList(static_cast<QSensorGesture*>(ptr)->gestureSignals(), &t7a3c3dlen); QtSensors_PackedString { t7a3c3d, t7a3c3dlen }; });
 }
 
 struct QtSensors_PackedString QSensorGesture_InvalidIds(void* ptr)
 {
-	return ({ QByteArray ta7952e = static_cast<QSensorGesture*>(ptr)->invalidIds().join("|").toUtf8(); QtSensors_PackedString { const_cast<char*>(ta7952e.prepend("WHITESPACE").constData()+10), ta7952e.size()-10 }; });
+	return ({ long long ta7952elen; char* ta7952e = goPackStringList(static_cast<QSensorGesture*>(ptr)->invalidIds(), &ta7952elen); QtSensors_PackedString { ta7952e, ta7952elen }; });
 }
 
 struct QtSensors_PackedString QSensorGesture_ValidIds(void* ptr)
 {
-	return ({ QByteArray t98eddb = static_cast<QSensorGesture*>(ptr)->validIds().join("|").toUtf8(); QtSensors_PackedString { const_cast<char*>(t98eddb.prepend("WHITESPACE").constData()+10), t98eddb.size()-10 }; });
+	return ({ long long t98eddblen; char* t98eddb = goPackStringList(static_cast<QSensorGesture*>(ptr)->validIds(), &t98eddblen); QtSensors_PackedString { t98eddb, t98eddblen }; });
 }
 
 void* QSensorGesture___dynamicPropertyNames_atList(void* ptr, int i)
@@ -3248,12 +3317,12 @@ void QSensorGestureManager_DestroyQSensorGestureManager(void* ptr)
 
 struct QtSensors_PackedString QSensorGestureManager_GestureIds(void* ptr)
 {
-	return ({ QByteArray t5f71c3 = static_cast<QSensorGestureManager*>(ptr)->gestureIds().join("|").toUtf8(); QtSensors_PackedString { const_cast<char*>(t5f71c3.prepend("WHITESPACE").constData()+10), t5f71c3.size()-10 }; });
+	return ({ long long t5f71c3len; char* t5f71c3 = goPackStringList(static_cast<QSensorGestureManager*>(ptr)->gestureIds(), &t5f71c3len); QtSensors_PackedString { t5f71c3, t5f71c3len }; });
 }
 
 struct QtSensors_PackedString QSensorGestureManager_RecognizerSignals(void* ptr, char* gestureId)
 {
-	return ({ QByteArray t4087bf = static_cast<QSensorGestureManager*>(ptr)->recognizerSignals(QString(gestureId)).join("|").toUtf8(); QtSensors_PackedString { const_cast<char*>(t4087bf.prepend("WHITESPACE").constData()+10), t4087bf.size()-10 }; });
+	return ({ long long t4087bflen; char* t4087bf = goPackStringList(static_cast<QSensorGestureManager*>(ptr)->recognizerSignals(QString(gestureId)), &t4087bflen); QtSensors_PackedString { t4087bf, t4087bflen }; });
 }
 
 void* QSensorGestureManager___dynamicPropertyNames_atList(void* ptr, int i)
@@ -3383,7 +3452,7 @@ public:
 	QList<QSensorGestureRecognizer *> createRecognizers() { return *static_cast<QList<QSensorGestureRecognizer *>*>(callbackQSensorGesturePluginInterface_CreateRecognizers(this)); };
 	 ~MyQSensorGesturePluginInterface() { callbackQSensorGesturePluginInterface_DestroyQSensorGesturePluginInterface(this); };
 	QString name() const { return QString(callbackQSensorGesturePluginInterface_Name(const_cast<void*>(static_cast<const void*>(this)))); };
-	QStringList supportedIds() const { return QString(callbackQSensorGesturePluginInterface_SupportedIds(const_cast<void*>(static_cast<const void*>(this)))).split("|", QString::SkipEmptyParts); };
+	QStringList supportedIds() const { char* tmp = callbackQSensorGesturePluginInterface_SupportedIds(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
 };
 
 struct QtSensors_PackedList QSensorGesturePluginInterface_CreateRecognizers(void* ptr)
@@ -3413,7 +3482,7 @@ struct QtSensors_PackedString QSensorGesturePluginInterface_Name(void* ptr)
 
 struct QtSensors_PackedString QSensorGesturePluginInterface_SupportedIds(void* ptr)
 {
-	return ({ QByteArray tab1a26 = static_cast<QSensorGesturePluginInterface*>(ptr)->supportedIds().join("|").toUtf8(); QtSensors_PackedString { const_cast<char*>(tab1a26.prepend("WHITESPACE").constData()+10), tab1a26.size()-10 }; });
+	return ({ long long tab1a26len; char* tab1a26 = goPackStringList(static_cast<QSensorGesturePluginInterface*>(ptr)->supportedIds(), &tab1a26len); QtSensors_PackedString { tab1a26, tab1a26len }; });
 }
 
 void* QSensorGesturePluginInterface___createRecognizers_atList(void* ptr, int i)
@@ -3527,7 +3596,7 @@ struct QtSensors_PackedString QSensorGestureRecognizer_Id(void* ptr)
 
 struct QtSensors_PackedString QSensorGestureRecognizer_GestureSignals(void* ptr)
 {
-	return ({ QByteArray t79f8ee = static_cast<QSensorGestureRecognizer*>(ptr)->gestureSignals().join("|").toUtf8(); QtSensors_PackedString { const_cast<char*>(t79f8ee.prepend("WHITESPACE").constData()+10), t79f8ee.size()-10 }; });
+	return ({ long long t79f8eelen; char* t79f8ee = goPackStringList(static_cast<QSensorGestureRecognizer*>(ptr)->gestureSignals(), &t79f8eelen); QtSensors_PackedString { t79f8ee, t79f8eelen }; });
 }
 
 void* QSensorGestureRecognizer___dynamicPropertyNames_atList(void* ptr, int i)
@@ -8,11 +8,9 @@ package sensors
 //#include "sensors.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -22,6 +20,43 @@ func cGoUnpackString(s C.struct_QtSensors_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtSensors_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtSensors_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type AndroidSensors struct {
 	ptr unsafe.Pointer
@@ -143,7 +178,7 @@ const (
 
 //export callbackQAccelerometer_AccelerationModeChanged
 func callbackQAccelerometer_AccelerationModeChanged(ptr unsafe.Pointer, accelerationMode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "accelerationModeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "accelerationModeChanged"); signal != nil {
 		signal.(func(QAccelerometer__AccelerationMode))(QAccelerometer__AccelerationMode(accelerationMode))
 	}
 
@@ -152,14 +187,14 @@ func callbackQAccelerometer_AccelerationModeChanged(ptr unsafe.Pointer, accelera
 func (ptr *QAccelerometer) ConnectAccelerationModeChanged(f func(accelerationMode QAccelerometer__AccelerationMode)) {
 	if ptr.Pointer() != nil {
 		C.QAccelerometer_ConnectAccelerationModeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "accelerationModeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "accelerationModeChanged", f)
 	}
 }
 
 func (ptr *QAccelerometer) DisconnectAccelerationModeChanged() {
 	if ptr.Pointer() != nil {
 		C.QAccelerometer_DisconnectAccelerationModeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "accelerationModeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "accelerationModeChanged")
 	}
 }
 
@@ -184,7 +219,7 @@ func (ptr *QAccelerometer) AccelerationMode() QAccelerometer__AccelerationMode {
 
 func NewQAccelerometer(parent core.QObject_ITF) *QAccelerometer {
 	var tmpValue = NewQAccelerometerFromPointer(C.QAccelerometer_NewQAccelerometer(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -192,7 +227,7 @@ func NewQAccelerometer(parent core.QObject_ITF) *QAccelerometer {
 
 //export callbackQAccelerometer_DestroyQAccelerometer
 func callbackQAccelerometer_DestroyQAccelerometer(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAccelerometer"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAccelerometer"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAccelerometerFromPointer(ptr).DestroyQAccelerometerDefault()
@@ -202,21 +237,21 @@ func callbackQAccelerometer_DestroyQAccelerometer(ptr unsafe.Pointer) {
 func (ptr *QAccelerometer) ConnectDestroyQAccelerometer(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccelerometer", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAccelerometer", f)
 	}
 }
 
 func (ptr *QAccelerometer) DisconnectDestroyQAccelerometer() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAccelerometer")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAccelerometer")
 	}
 }
 
 func (ptr *QAccelerometer) DestroyQAccelerometer() {
 	if ptr.Pointer() != nil {
 		C.QAccelerometer_DestroyQAccelerometer(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -224,7 +259,7 @@ func (ptr *QAccelerometer) DestroyQAccelerometer() {
 func (ptr *QAccelerometer) DestroyQAccelerometerDefault() {
 	if ptr.Pointer() != nil {
 		C.QAccelerometer_DestroyQAccelerometerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -232,7 +267,7 @@ func (ptr *QAccelerometer) DestroyQAccelerometerDefault() {
 func (ptr *QAccelerometer) Reading() *QAccelerometerReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAccelerometerReadingFromPointer(C.QAccelerometer_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -290,14 +325,14 @@ func NewQAccelerometerFilterFromPointer(ptr unsafe.Pointer) *QAccelerometerFilte
 func (ptr *QAccelerometerFilter) DestroyQAccelerometerFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAccelerometerFilter_Filter
 func callbackQAccelerometerFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QAccelerometerReading) bool)(NewQAccelerometerReadingFromPointer(reading)))))
 	}
 
@@ -307,14 +342,14 @@ func callbackQAccelerometerFilter_Filter(ptr unsafe.Pointer, reading unsafe.Poin
 func (ptr *QAccelerometerFilter) ConnectFilter(f func(reading *QAccelerometerReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QAccelerometerFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -367,7 +402,7 @@ func NewQAccelerometerReadingFromPointer(ptr unsafe.Pointer) *QAccelerometerRead
 func (ptr *QAccelerometerReading) DestroyQAccelerometerReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -451,7 +486,7 @@ func NewQAltimeterFromPointer(ptr unsafe.Pointer) *QAltimeter {
 }
 func NewQAltimeter(parent core.QObject_ITF) *QAltimeter {
 	var tmpValue = NewQAltimeterFromPointer(C.QAltimeter_NewQAltimeter(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -460,7 +495,7 @@ func NewQAltimeter(parent core.QObject_ITF) *QAltimeter {
 func (ptr *QAltimeter) DestroyQAltimeter() {
 	if ptr.Pointer() != nil {
 		C.QAltimeter_DestroyQAltimeter(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -468,7 +503,7 @@ func (ptr *QAltimeter) DestroyQAltimeter() {
 func (ptr *QAltimeter) Reading() *QAltimeterReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAltimeterReadingFromPointer(C.QAltimeter_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -526,14 +561,14 @@ func NewQAltimeterFilterFromPointer(ptr unsafe.Pointer) *QAltimeterFilter {
 func (ptr *QAltimeterFilter) DestroyQAltimeterFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAltimeterFilter_Filter
 func callbackQAltimeterFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QAltimeterReading) bool)(NewQAltimeterReadingFromPointer(reading)))))
 	}
 
@@ -543,14 +578,14 @@ func callbackQAltimeterFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer)
 func (ptr *QAltimeterFilter) ConnectFilter(f func(reading *QAltimeterReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QAltimeterFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -603,7 +638,7 @@ func NewQAltimeterReadingFromPointer(ptr unsafe.Pointer) *QAltimeterReading {
 func (ptr *QAltimeterReading) DestroyQAltimeterReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -663,14 +698,14 @@ func NewQAmbientLightFilterFromPointer(ptr unsafe.Pointer) *QAmbientLightFilter
 func (ptr *QAmbientLightFilter) DestroyQAmbientLightFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAmbientLightFilter_Filter
 func callbackQAmbientLightFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QAmbientLightReading) bool)(NewQAmbientLightReadingFromPointer(reading)))))
 	}
 
@@ -680,14 +715,14 @@ func callbackQAmbientLightFilter_Filter(ptr unsafe.Pointer, reading unsafe.Point
 func (ptr *QAmbientLightFilter) ConnectFilter(f func(reading *QAmbientLightReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QAmbientLightFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -740,7 +775,7 @@ func NewQAmbientLightReadingFromPointer(ptr unsafe.Pointer) *QAmbientLightReadin
 func (ptr *QAmbientLightReading) DestroyQAmbientLightReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -811,7 +846,7 @@ func NewQAmbientLightSensorFromPointer(ptr unsafe.Pointer) *QAmbientLightSensor
 }
 func NewQAmbientLightSensor(parent core.QObject_ITF) *QAmbientLightSensor {
 	var tmpValue = NewQAmbientLightSensorFromPointer(C.QAmbientLightSensor_NewQAmbientLightSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -819,7 +854,7 @@ func NewQAmbientLightSensor(parent core.QObject_ITF) *QAmbientLightSensor {
 
 //export callbackQAmbientLightSensor_DestroyQAmbientLightSensor
 func callbackQAmbientLightSensor_DestroyQAmbientLightSensor(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QAmbientLightSensor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QAmbientLightSensor"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQAmbientLightSensorFromPointer(ptr).DestroyQAmbientLightSensorDefault()
@@ -829,21 +864,21 @@ func callbackQAmbientLightSensor_DestroyQAmbientLightSensor(ptr unsafe.Pointer)
 func (ptr *QAmbientLightSensor) ConnectDestroyQAmbientLightSensor(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QAmbientLightSensor", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QAmbientLightSensor", f)
 	}
 }
 
 func (ptr *QAmbientLightSensor) DisconnectDestroyQAmbientLightSensor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QAmbientLightSensor")
+		qt.DisconnectSignal(ptr.Pointer(), "~QAmbientLightSensor")
 	}
 }
 
 func (ptr *QAmbientLightSensor) DestroyQAmbientLightSensor() {
 	if ptr.Pointer() != nil {
 		C.QAmbientLightSensor_DestroyQAmbientLightSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -851,7 +886,7 @@ func (ptr *QAmbientLightSensor) DestroyQAmbientLightSensor() {
 func (ptr *QAmbientLightSensor) DestroyQAmbientLightSensorDefault() {
 	if ptr.Pointer() != nil {
 		C.QAmbientLightSensor_DestroyQAmbientLightSensorDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -859,7 +894,7 @@ func (ptr *QAmbientLightSensor) DestroyQAmbientLightSensorDefault() {
 func (ptr *QAmbientLightSensor) Reading() *QAmbientLightReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAmbientLightReadingFromPointer(C.QAmbientLightSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -917,14 +952,14 @@ func NewQAmbientTemperatureFilterFromPointer(ptr unsafe.Pointer) *QAmbientTemper
 func (ptr *QAmbientTemperatureFilter) DestroyQAmbientTemperatureFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQAmbientTemperatureFilter_Filter
 func callbackQAmbientTemperatureFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QAmbientTemperatureReading) bool)(NewQAmbientTemperatureReadingFromPointer(reading)))))
 	}
 
@@ -934,14 +969,14 @@ func callbackQAmbientTemperatureFilter_Filter(ptr unsafe.Pointer, reading unsafe
 func (ptr *QAmbientTemperatureFilter) ConnectFilter(f func(reading *QAmbientTemperatureReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QAmbientTemperatureFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -994,7 +1029,7 @@ func NewQAmbientTemperatureReadingFromPointer(ptr unsafe.Pointer) *QAmbientTempe
 func (ptr *QAmbientTemperatureReading) DestroyQAmbientTemperatureReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1052,7 +1087,7 @@ func NewQAmbientTemperatureSensorFromPointer(ptr unsafe.Pointer) *QAmbientTemper
 }
 func NewQAmbientTemperatureSensor(parent core.QObject_ITF) *QAmbientTemperatureSensor {
 	var tmpValue = NewQAmbientTemperatureSensorFromPointer(C.QAmbientTemperatureSensor_NewQAmbientTemperatureSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1061,7 +1096,7 @@ func NewQAmbientTemperatureSensor(parent core.QObject_ITF) *QAmbientTemperatureS
 func (ptr *QAmbientTemperatureSensor) DestroyQAmbientTemperatureSensor() {
 	if ptr.Pointer() != nil {
 		C.QAmbientTemperatureSensor_DestroyQAmbientTemperatureSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1069,7 +1104,7 @@ func (ptr *QAmbientTemperatureSensor) DestroyQAmbientTemperatureSensor() {
 func (ptr *QAmbientTemperatureSensor) Reading() *QAmbientTemperatureReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQAmbientTemperatureReadingFromPointer(C.QAmbientTemperatureSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1125,7 +1160,7 @@ func NewQCompassFromPointer(ptr unsafe.Pointer) *QCompass {
 }
 func NewQCompass(parent core.QObject_ITF) *QCompass {
 	var tmpValue = NewQCompassFromPointer(C.QCompass_NewQCompass(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1133,7 +1168,7 @@ func NewQCompass(parent core.QObject_ITF) *QCompass {
 
 //export callbackQCompass_DestroyQCompass
 func callbackQCompass_DestroyQCompass(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QCompass"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QCompass"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQCompassFromPointer(ptr).DestroyQCompassDefault()
@@ -1143,21 +1178,21 @@ func callbackQCompass_DestroyQCompass(ptr unsafe.Pointer) {
 func (ptr *QCompass) ConnectDestroyQCompass(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QCompass", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QCompass", f)
 	}
 }
 
 func (ptr *QCompass) DisconnectDestroyQCompass() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QCompass")
+		qt.DisconnectSignal(ptr.Pointer(), "~QCompass")
 	}
 }
 
 func (ptr *QCompass) DestroyQCompass() {
 	if ptr.Pointer() != nil {
 		C.QCompass_DestroyQCompass(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1165,7 +1200,7 @@ func (ptr *QCompass) DestroyQCompass() {
 func (ptr *QCompass) DestroyQCompassDefault() {
 	if ptr.Pointer() != nil {
 		C.QCompass_DestroyQCompassDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1173,7 +1208,7 @@ func (ptr *QCompass) DestroyQCompassDefault() {
 func (ptr *QCompass) Reading() *QCompassReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQCompassReadingFromPointer(C.QCompass_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1231,14 +1266,14 @@ func NewQCompassFilterFromPointer(ptr unsafe.Pointer) *QCompassFilter {
 func (ptr *QCompassFilter) DestroyQCompassFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQCompassFilter_Filter
 func callbackQCompassFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QCompassReading) bool)(NewQCompassReadingFromPointer(reading)))))
 	}
 
@@ -1248,14 +1283,14 @@ func callbackQCompassFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C
 func (ptr *QCompassFilter) ConnectFilter(f func(reading *QCompassReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QCompassFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -1308,7 +1343,7 @@ func NewQCompassReadingFromPointer(ptr unsafe.Pointer) *QCompassReading {
 func (ptr *QCompassReading) DestroyQCompassReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1381,14 +1416,14 @@ func NewQDistanceFilterFromPointer(ptr unsafe.Pointer) *QDistanceFilter {
 func (ptr *QDistanceFilter) DestroyQDistanceFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQDistanceFilter_Filter
 func callbackQDistanceFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QDistanceReading) bool)(NewQDistanceReadingFromPointer(reading)))))
 	}
 
@@ -1398,14 +1433,14 @@ func callbackQDistanceFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer)
 func (ptr *QDistanceFilter) ConnectFilter(f func(reading *QDistanceReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QDistanceFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -1458,7 +1493,7 @@ func NewQDistanceReadingFromPointer(ptr unsafe.Pointer) *QDistanceReading {
 func (ptr *QDistanceReading) DestroyQDistanceReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1516,7 +1551,7 @@ func NewQDistanceSensorFromPointer(ptr unsafe.Pointer) *QDistanceSensor {
 }
 func NewQDistanceSensor(parent core.QObject_ITF) *QDistanceSensor {
 	var tmpValue = NewQDistanceSensorFromPointer(C.QDistanceSensor_NewQDistanceSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1525,7 +1560,7 @@ func NewQDistanceSensor(parent core.QObject_ITF) *QDistanceSensor {
 func (ptr *QDistanceSensor) DestroyQDistanceSensor() {
 	if ptr.Pointer() != nil {
 		C.QDistanceSensor_DestroyQDistanceSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1533,7 +1568,7 @@ func (ptr *QDistanceSensor) DestroyQDistanceSensor() {
 func (ptr *QDistanceSensor) Reading() *QDistanceReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQDistanceReadingFromPointer(C.QDistanceSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1589,7 +1624,7 @@ func NewQGyroscopeFromPointer(ptr unsafe.Pointer) *QGyroscope {
 }
 func NewQGyroscope(parent core.QObject_ITF) *QGyroscope {
 	var tmpValue = NewQGyroscopeFromPointer(C.QGyroscope_NewQGyroscope(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1597,7 +1632,7 @@ func NewQGyroscope(parent core.QObject_ITF) *QGyroscope {
 
 //export callbackQGyroscope_DestroyQGyroscope
 func callbackQGyroscope_DestroyQGyroscope(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QGyroscope"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QGyroscope"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQGyroscopeFromPointer(ptr).DestroyQGyroscopeDefault()
@@ -1607,21 +1642,21 @@ func callbackQGyroscope_DestroyQGyroscope(ptr unsafe.Pointer) {
 func (ptr *QGyroscope) ConnectDestroyQGyroscope(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QGyroscope", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QGyroscope", f)
 	}
 }
 
 func (ptr *QGyroscope) DisconnectDestroyQGyroscope() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QGyroscope")
+		qt.DisconnectSignal(ptr.Pointer(), "~QGyroscope")
 	}
 }
 
 func (ptr *QGyroscope) DestroyQGyroscope() {
 	if ptr.Pointer() != nil {
 		C.QGyroscope_DestroyQGyroscope(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1629,7 +1664,7 @@ func (ptr *QGyroscope) DestroyQGyroscope() {
 func (ptr *QGyroscope) DestroyQGyroscopeDefault() {
 	if ptr.Pointer() != nil {
 		C.QGyroscope_DestroyQGyroscopeDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1637,7 +1672,7 @@ func (ptr *QGyroscope) DestroyQGyroscopeDefault() {
 func (ptr *QGyroscope) Reading() *QGyroscopeReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQGyroscopeReadingFromPointer(C.QGyroscope_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1695,14 +1730,14 @@ func NewQGyroscopeFilterFromPointer(ptr unsafe.Pointer) *QGyroscopeFilter {
 func (ptr *QGyroscopeFilter) DestroyQGyroscopeFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQGyroscopeFilter_Filter
 func callbackQGyroscopeFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QGyroscopeReading) bool)(NewQGyroscopeReadingFromPointer(reading)))))
 	}
 
@@ -1712,14 +1747,14 @@ func callbackQGyroscopeFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer)
 func (ptr *QGyroscopeFilter) ConnectFilter(f func(reading *QGyroscopeReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QGyroscopeFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -1772,7 +1807,7 @@ func NewQGyroscopeReadingFromPointer(ptr unsafe.Pointer) *QGyroscopeReading {
 func (ptr *QGyroscopeReading) DestroyQGyroscopeReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1858,14 +1893,14 @@ func NewQHolsterFilterFromPointer(ptr unsafe.Pointer) *QHolsterFilter {
 func (ptr *QHolsterFilter) DestroyQHolsterFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQHolsterFilter_Filter
 func callbackQHolsterFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QHolsterReading) bool)(NewQHolsterReadingFromPointer(reading)))))
 	}
 
@@ -1875,14 +1910,14 @@ func callbackQHolsterFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C
 func (ptr *QHolsterFilter) ConnectFilter(f func(reading *QHolsterReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QHolsterFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -1935,7 +1970,7 @@ func NewQHolsterReadingFromPointer(ptr unsafe.Pointer) *QHolsterReading {
 func (ptr *QHolsterReading) DestroyQHolsterReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1993,7 +2028,7 @@ func NewQHolsterSensorFromPointer(ptr unsafe.Pointer) *QHolsterSensor {
 }
 func NewQHolsterSensor(parent core.QObject_ITF) *QHolsterSensor {
 	var tmpValue = NewQHolsterSensorFromPointer(C.QHolsterSensor_NewQHolsterSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2002,7 +2037,7 @@ func NewQHolsterSensor(parent core.QObject_ITF) *QHolsterSensor {
 func (ptr *QHolsterSensor) DestroyQHolsterSensor() {
 	if ptr.Pointer() != nil {
 		C.QHolsterSensor_DestroyQHolsterSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2010,7 +2045,7 @@ func (ptr *QHolsterSensor) DestroyQHolsterSensor() {
 func (ptr *QHolsterSensor) Reading() *QHolsterReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQHolsterReadingFromPointer(C.QHolsterSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2068,14 +2103,14 @@ func NewQIRProximityFilterFromPointer(ptr unsafe.Pointer) *QIRProximityFilter {
 func (ptr *QIRProximityFilter) DestroyQIRProximityFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQIRProximityFilter_Filter
 func callbackQIRProximityFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QIRProximityReading) bool)(NewQIRProximityReadingFromPointer(reading)))))
 	}
 
@@ -2085,14 +2120,14 @@ func callbackQIRProximityFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointe
 func (ptr *QIRProximityFilter) ConnectFilter(f func(reading *QIRProximityReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QIRProximityFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -2145,7 +2180,7 @@ func NewQIRProximityReadingFromPointer(ptr unsafe.Pointer) *QIRProximityReading
 func (ptr *QIRProximityReading) DestroyQIRProximityReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2203,7 +2238,7 @@ func NewQIRProximitySensorFromPointer(ptr unsafe.Pointer) *QIRProximitySensor {
 }
 func NewQIRProximitySensor(parent core.QObject_ITF) *QIRProximitySensor {
 	var tmpValue = NewQIRProximitySensorFromPointer(C.QIRProximitySensor_NewQIRProximitySensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2211,7 +2246,7 @@ func NewQIRProximitySensor(parent core.QObject_ITF) *QIRProximitySensor {
 
 //export callbackQIRProximitySensor_DestroyQIRProximitySensor
 func callbackQIRProximitySensor_DestroyQIRProximitySensor(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QIRProximitySensor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QIRProximitySensor"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQIRProximitySensorFromPointer(ptr).DestroyQIRProximitySensorDefault()
@@ -2221,21 +2256,21 @@ func callbackQIRProximitySensor_DestroyQIRProximitySensor(ptr unsafe.Pointer) {
 func (ptr *QIRProximitySensor) ConnectDestroyQIRProximitySensor(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QIRProximitySensor", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QIRProximitySensor", f)
 	}
 }
 
 func (ptr *QIRProximitySensor) DisconnectDestroyQIRProximitySensor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QIRProximitySensor")
+		qt.DisconnectSignal(ptr.Pointer(), "~QIRProximitySensor")
 	}
 }
 
 func (ptr *QIRProximitySensor) DestroyQIRProximitySensor() {
 	if ptr.Pointer() != nil {
 		C.QIRProximitySensor_DestroyQIRProximitySensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2243,7 +2278,7 @@ func (ptr *QIRProximitySensor) DestroyQIRProximitySensor() {
 func (ptr *QIRProximitySensor) DestroyQIRProximitySensorDefault() {
 	if ptr.Pointer() != nil {
 		C.QIRProximitySensor_DestroyQIRProximitySensorDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2251,7 +2286,7 @@ func (ptr *QIRProximitySensor) DestroyQIRProximitySensorDefault() {
 func (ptr *QIRProximitySensor) Reading() *QIRProximityReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQIRProximityReadingFromPointer(C.QIRProximitySensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2309,14 +2344,14 @@ func NewQLightFilterFromPointer(ptr unsafe.Pointer) *QLightFilter {
 func (ptr *QLightFilter) DestroyQLightFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQLightFilter_Filter
 func callbackQLightFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QLightReading) bool)(NewQLightReadingFromPointer(reading)))))
 	}
 
@@ -2326,14 +2361,14 @@ func callbackQLightFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.c
 func (ptr *QLightFilter) ConnectFilter(f func(reading *QLightReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QLightFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -2386,7 +2421,7 @@ func NewQLightReadingFromPointer(ptr unsafe.Pointer) *QLightReading {
 func (ptr *QLightReading) DestroyQLightReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2444,7 +2479,7 @@ func NewQLightSensorFromPointer(ptr unsafe.Pointer) *QLightSensor {
 }
 func NewQLightSensor(parent core.QObject_ITF) *QLightSensor {
 	var tmpValue = NewQLightSensorFromPointer(C.QLightSensor_NewQLightSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2452,7 +2487,7 @@ func NewQLightSensor(parent core.QObject_ITF) *QLightSensor {
 
 //export callbackQLightSensor_FieldOfViewChanged
 func callbackQLightSensor_FieldOfViewChanged(ptr unsafe.Pointer, fieldOfView C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fieldOfViewChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fieldOfViewChanged"); signal != nil {
 		signal.(func(float64))(float64(fieldOfView))
 	}
 
@@ -2461,14 +2496,14 @@ func callbackQLightSensor_FieldOfViewChanged(ptr unsafe.Pointer, fieldOfView C.d
 func (ptr *QLightSensor) ConnectFieldOfViewChanged(f func(fieldOfView float64)) {
 	if ptr.Pointer() != nil {
 		C.QLightSensor_ConnectFieldOfViewChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fieldOfViewChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "fieldOfViewChanged", f)
 	}
 }
 
 func (ptr *QLightSensor) DisconnectFieldOfViewChanged() {
 	if ptr.Pointer() != nil {
 		C.QLightSensor_DisconnectFieldOfViewChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fieldOfViewChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "fieldOfViewChanged")
 	}
 }
 
@@ -2486,7 +2521,7 @@ func (ptr *QLightSensor) SetFieldOfView(fieldOfView float64) {
 
 //export callbackQLightSensor_DestroyQLightSensor
 func callbackQLightSensor_DestroyQLightSensor(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QLightSensor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QLightSensor"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQLightSensorFromPointer(ptr).DestroyQLightSensorDefault()
@@ -2496,21 +2531,21 @@ func callbackQLightSensor_DestroyQLightSensor(ptr unsafe.Pointer) {
 func (ptr *QLightSensor) ConnectDestroyQLightSensor(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QLightSensor", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QLightSensor", f)
 	}
 }
 
 func (ptr *QLightSensor) DisconnectDestroyQLightSensor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QLightSensor")
+		qt.DisconnectSignal(ptr.Pointer(), "~QLightSensor")
 	}
 }
 
 func (ptr *QLightSensor) DestroyQLightSensor() {
 	if ptr.Pointer() != nil {
 		C.QLightSensor_DestroyQLightSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2518,7 +2553,7 @@ func (ptr *QLightSensor) DestroyQLightSensor() {
 func (ptr *QLightSensor) DestroyQLightSensorDefault() {
 	if ptr.Pointer() != nil {
 		C.QLightSensor_DestroyQLightSensorDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2526,7 +2561,7 @@ func (ptr *QLightSensor) DestroyQLightSensorDefault() {
 func (ptr *QLightSensor) Reading() *QLightReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQLightReadingFromPointer(C.QLightSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2589,7 +2624,7 @@ func NewQMagnetometerFromPointer(ptr unsafe.Pointer) *QMagnetometer {
 }
 func NewQMagnetometer(parent core.QObject_ITF) *QMagnetometer {
 	var tmpValue = NewQMagnetometerFromPointer(C.QMagnetometer_NewQMagnetometer(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2597,7 +2632,7 @@ func NewQMagnetometer(parent core.QObject_ITF) *QMagnetometer {
 
 //export callbackQMagnetometer_ReturnGeoValuesChanged
 func callbackQMagnetometer_ReturnGeoValuesChanged(ptr unsafe.Pointer, returnGeoValues C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "returnGeoValuesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "returnGeoValuesChanged"); signal != nil {
 		signal.(func(bool))(int8(returnGeoValues) != 0)
 	}
 
@@ -2606,14 +2641,14 @@ func callbackQMagnetometer_ReturnGeoValuesChanged(ptr unsafe.Pointer, returnGeoV
 func (ptr *QMagnetometer) ConnectReturnGeoValuesChanged(f func(returnGeoValues bool)) {
 	if ptr.Pointer() != nil {
 		C.QMagnetometer_ConnectReturnGeoValuesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "returnGeoValuesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "returnGeoValuesChanged", f)
 	}
 }
 
 func (ptr *QMagnetometer) DisconnectReturnGeoValuesChanged() {
 	if ptr.Pointer() != nil {
 		C.QMagnetometer_DisconnectReturnGeoValuesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "returnGeoValuesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "returnGeoValuesChanged")
 	}
 }
 
@@ -2631,7 +2666,7 @@ func (ptr *QMagnetometer) SetReturnGeoValues(returnGeoValues bool) {
 
 //export callbackQMagnetometer_DestroyQMagnetometer
 func callbackQMagnetometer_DestroyQMagnetometer(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QMagnetometer"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QMagnetometer"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQMagnetometerFromPointer(ptr).DestroyQMagnetometerDefault()
@@ -2641,21 +2676,21 @@ func callbackQMagnetometer_DestroyQMagnetometer(ptr unsafe.Pointer) {
 func (ptr *QMagnetometer) ConnectDestroyQMagnetometer(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QMagnetometer", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QMagnetometer", f)
 	}
 }
 
 func (ptr *QMagnetometer) DisconnectDestroyQMagnetometer() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QMagnetometer")
+		qt.DisconnectSignal(ptr.Pointer(), "~QMagnetometer")
 	}
 }
 
 func (ptr *QMagnetometer) DestroyQMagnetometer() {
 	if ptr.Pointer() != nil {
 		C.QMagnetometer_DestroyQMagnetometer(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2663,7 +2698,7 @@ func (ptr *QMagnetometer) DestroyQMagnetometer() {
 func (ptr *QMagnetometer) DestroyQMagnetometerDefault() {
 	if ptr.Pointer() != nil {
 		C.QMagnetometer_DestroyQMagnetometerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2671,7 +2706,7 @@ func (ptr *QMagnetometer) DestroyQMagnetometerDefault() {
 func (ptr *QMagnetometer) Reading() *QMagnetometerReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQMagnetometerReadingFromPointer(C.QMagnetometer_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2736,14 +2771,14 @@ func NewQMagnetometerFilterFromPointer(ptr unsafe.Pointer) *QMagnetometerFilter
 func (ptr *QMagnetometerFilter) DestroyQMagnetometerFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQMagnetometerFilter_Filter
 func callbackQMagnetometerFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QMagnetometerReading) bool)(NewQMagnetometerReadingFromPointer(reading)))))
 	}
 
@@ -2753,14 +2788,14 @@ func callbackQMagnetometerFilter_Filter(ptr unsafe.Pointer, reading unsafe.Point
 func (ptr *QMagnetometerFilter) ConnectFilter(f func(reading *QMagnetometerReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QMagnetometerFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -2813,7 +2848,7 @@ func NewQMagnetometerReadingFromPointer(ptr unsafe.Pointer) *QMagnetometerReadin
 func (ptr *QMagnetometerReading) DestroyQMagnetometerReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2912,14 +2947,14 @@ func NewQOrientationFilterFromPointer(ptr unsafe.Pointer) *QOrientationFilter {
 func (ptr *QOrientationFilter) DestroyQOrientationFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQOrientationFilter_Filter
 func callbackQOrientationFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QOrientationReading) bool)(NewQOrientationReadingFromPointer(reading)))))
 	}
 
@@ -2929,14 +2964,14 @@ func callbackQOrientationFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointe
 func (ptr *QOrientationFilter) ConnectFilter(f func(reading *QOrientationReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QOrientationFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -2989,7 +3024,7 @@ func NewQOrientationReadingFromPointer(ptr unsafe.Pointer) *QOrientationReading
 func (ptr *QOrientationReading) DestroyQOrientationReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3061,7 +3096,7 @@ func NewQOrientationSensorFromPointer(ptr unsafe.Pointer) *QOrientationSensor {
 }
 func NewQOrientationSensor(parent core.QObject_ITF) *QOrientationSensor {
 	var tmpValue = NewQOrientationSensorFromPointer(C.QOrientationSensor_NewQOrientationSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3069,7 +3104,7 @@ func NewQOrientationSensor(parent core.QObject_ITF) *QOrientationSensor {
 
 //export callbackQOrientationSensor_DestroyQOrientationSensor
 func callbackQOrientationSensor_DestroyQOrientationSensor(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QOrientationSensor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QOrientationSensor"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQOrientationSensorFromPointer(ptr).DestroyQOrientationSensorDefault()
@@ -3079,21 +3114,21 @@ func callbackQOrientationSensor_DestroyQOrientationSensor(ptr unsafe.Pointer) {
 func (ptr *QOrientationSensor) ConnectDestroyQOrientationSensor(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QOrientationSensor", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QOrientationSensor", f)
 	}
 }
 
 func (ptr *QOrientationSensor) DisconnectDestroyQOrientationSensor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QOrientationSensor")
+		qt.DisconnectSignal(ptr.Pointer(), "~QOrientationSensor")
 	}
 }
 
 func (ptr *QOrientationSensor) DestroyQOrientationSensor() {
 	if ptr.Pointer() != nil {
 		C.QOrientationSensor_DestroyQOrientationSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3101,7 +3136,7 @@ func (ptr *QOrientationSensor) DestroyQOrientationSensor() {
 func (ptr *QOrientationSensor) DestroyQOrientationSensorDefault() {
 	if ptr.Pointer() != nil {
 		C.QOrientationSensor_DestroyQOrientationSensorDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3109,7 +3144,7 @@ func (ptr *QOrientationSensor) DestroyQOrientationSensorDefault() {
 func (ptr *QOrientationSensor) Reading() *QOrientationReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQOrientationReadingFromPointer(C.QOrientationSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3167,14 +3202,14 @@ func NewQPressureFilterFromPointer(ptr unsafe.Pointer) *QPressureFilter {
 func (ptr *QPressureFilter) DestroyQPressureFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQPressureFilter_Filter
 func callbackQPressureFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QPressureReading) bool)(NewQPressureReadingFromPointer(reading)))))
 	}
 
@@ -3184,14 +3219,14 @@ func callbackQPressureFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer)
 func (ptr *QPressureFilter) ConnectFilter(f func(reading *QPressureReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QPressureFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -3244,7 +3279,7 @@ func NewQPressureReadingFromPointer(ptr unsafe.Pointer) *QPressureReading {
 func (ptr *QPressureReading) DestroyQPressureReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3315,7 +3350,7 @@ func NewQPressureSensorFromPointer(ptr unsafe.Pointer) *QPressureSensor {
 }
 func NewQPressureSensor(parent core.QObject_ITF) *QPressureSensor {
 	var tmpValue = NewQPressureSensorFromPointer(C.QPressureSensor_NewQPressureSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3324,7 +3359,7 @@ func NewQPressureSensor(parent core.QObject_ITF) *QPressureSensor {
 func (ptr *QPressureSensor) DestroyQPressureSensor() {
 	if ptr.Pointer() != nil {
 		C.QPressureSensor_DestroyQPressureSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3332,7 +3367,7 @@ func (ptr *QPressureSensor) DestroyQPressureSensor() {
 func (ptr *QPressureSensor) Reading() *QPressureReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQPressureReadingFromPointer(C.QPressureSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3390,14 +3425,14 @@ func NewQProximityFilterFromPointer(ptr unsafe.Pointer) *QProximityFilter {
 func (ptr *QProximityFilter) DestroyQProximityFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQProximityFilter_Filter
 func callbackQProximityFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QProximityReading) bool)(NewQProximityReadingFromPointer(reading)))))
 	}
 
@@ -3407,14 +3442,14 @@ func callbackQProximityFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer)
 func (ptr *QProximityFilter) ConnectFilter(f func(reading *QProximityReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QProximityFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -3467,7 +3502,7 @@ func NewQProximityReadingFromPointer(ptr unsafe.Pointer) *QProximityReading {
 func (ptr *QProximityReading) DestroyQProximityReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3525,7 +3560,7 @@ func NewQProximitySensorFromPointer(ptr unsafe.Pointer) *QProximitySensor {
 }
 func NewQProximitySensor(parent core.QObject_ITF) *QProximitySensor {
 	var tmpValue = NewQProximitySensorFromPointer(C.QProximitySensor_NewQProximitySensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3533,7 +3568,7 @@ func NewQProximitySensor(parent core.QObject_ITF) *QProximitySensor {
 
 //export callbackQProximitySensor_DestroyQProximitySensor
 func callbackQProximitySensor_DestroyQProximitySensor(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QProximitySensor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QProximitySensor"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQProximitySensorFromPointer(ptr).DestroyQProximitySensorDefault()
@@ -3543,21 +3578,21 @@ func callbackQProximitySensor_DestroyQProximitySensor(ptr unsafe.Pointer) {
 func (ptr *QProximitySensor) ConnectDestroyQProximitySensor(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QProximitySensor", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QProximitySensor", f)
 	}
 }
 
 func (ptr *QProximitySensor) DisconnectDestroyQProximitySensor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QProximitySensor")
+		qt.DisconnectSignal(ptr.Pointer(), "~QProximitySensor")
 	}
 }
 
 func (ptr *QProximitySensor) DestroyQProximitySensor() {
 	if ptr.Pointer() != nil {
 		C.QProximitySensor_DestroyQProximitySensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3565,7 +3600,7 @@ func (ptr *QProximitySensor) DestroyQProximitySensor() {
 func (ptr *QProximitySensor) DestroyQProximitySensorDefault() {
 	if ptr.Pointer() != nil {
 		C.QProximitySensor_DestroyQProximitySensorDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3573,7 +3608,7 @@ func (ptr *QProximitySensor) DestroyQProximitySensorDefault() {
 func (ptr *QProximitySensor) Reading() *QProximityReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQProximityReadingFromPointer(C.QProximitySensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3631,14 +3666,14 @@ func NewQRotationFilterFromPointer(ptr unsafe.Pointer) *QRotationFilter {
 func (ptr *QRotationFilter) DestroyQRotationFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQRotationFilter_Filter
 func callbackQRotationFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QRotationReading) bool)(NewQRotationReadingFromPointer(reading)))))
 	}
 
@@ -3648,14 +3683,14 @@ func callbackQRotationFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer)
 func (ptr *QRotationFilter) ConnectFilter(f func(reading *QRotationReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QRotationFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -3708,7 +3743,7 @@ func NewQRotationReadingFromPointer(ptr unsafe.Pointer) *QRotationReading {
 func (ptr *QRotationReading) DestroyQRotationReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3780,7 +3815,7 @@ func NewQRotationSensorFromPointer(ptr unsafe.Pointer) *QRotationSensor {
 }
 func NewQRotationSensor(parent core.QObject_ITF) *QRotationSensor {
 	var tmpValue = NewQRotationSensorFromPointer(C.QRotationSensor_NewQRotationSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3788,7 +3823,7 @@ func NewQRotationSensor(parent core.QObject_ITF) *QRotationSensor {
 
 //export callbackQRotationSensor_HasZChanged
 func callbackQRotationSensor_HasZChanged(ptr unsafe.Pointer, hasZ C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasZChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasZChanged"); signal != nil {
 		signal.(func(bool))(int8(hasZ) != 0)
 	}
 
@@ -3797,14 +3832,14 @@ func callbackQRotationSensor_HasZChanged(ptr unsafe.Pointer, hasZ C.char) {
 func (ptr *QRotationSensor) ConnectHasZChanged(f func(hasZ bool)) {
 	if ptr.Pointer() != nil {
 		C.QRotationSensor_ConnectHasZChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasZChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasZChanged", f)
 	}
 }
 
 func (ptr *QRotationSensor) DisconnectHasZChanged() {
 	if ptr.Pointer() != nil {
 		C.QRotationSensor_DisconnectHasZChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasZChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "hasZChanged")
 	}
 }
 
@@ -3822,7 +3857,7 @@ func (ptr *QRotationSensor) SetHasZ(hasZ bool) {
 
 //export callbackQRotationSensor_DestroyQRotationSensor
 func callbackQRotationSensor_DestroyQRotationSensor(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QRotationSensor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QRotationSensor"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQRotationSensorFromPointer(ptr).DestroyQRotationSensorDefault()
@@ -3832,21 +3867,21 @@ func callbackQRotationSensor_DestroyQRotationSensor(ptr unsafe.Pointer) {
 func (ptr *QRotationSensor) ConnectDestroyQRotationSensor(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QRotationSensor", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QRotationSensor", f)
 	}
 }
 
 func (ptr *QRotationSensor) DisconnectDestroyQRotationSensor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QRotationSensor")
+		qt.DisconnectSignal(ptr.Pointer(), "~QRotationSensor")
 	}
 }
 
 func (ptr *QRotationSensor) DestroyQRotationSensor() {
 	if ptr.Pointer() != nil {
 		C.QRotationSensor_DestroyQRotationSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3854,7 +3889,7 @@ func (ptr *QRotationSensor) DestroyQRotationSensor() {
 func (ptr *QRotationSensor) DestroyQRotationSensorDefault() {
 	if ptr.Pointer() != nil {
 		C.QRotationSensor_DestroyQRotationSensorDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3862,7 +3897,7 @@ func (ptr *QRotationSensor) DestroyQRotationSensorDefault() {
 func (ptr *QRotationSensor) Reading() *QRotationReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQRotationReadingFromPointer(C.QRotationSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3963,48 +3998,48 @@ func (ptr *QSensor) DefaultSensorForType(ty core.QByteArray_ITF) *core.QByteArra
 }
 
 func QSensor_SensorTypes() []*core.QByteArray {
-	return func(l C.struct_QtSensors_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQSensorFromPointer(l.data).__sensorTypes_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QSensor_QSensor_SensorTypes())
+	}(cGoUnpackStringListAndFree(C.QSensor_QSensor_SensorTypes()))
 }
 
 func (ptr *QSensor) SensorTypes() []*core.QByteArray {
-	return func(l C.struct_QtSensors_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQSensorFromPointer(l.data).__sensorTypes_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QSensor_QSensor_SensorTypes())
+	}(cGoUnpackStringListAndFree(C.QSensor_QSensor_SensorTypes()))
 }
 
 func QSensor_SensorsForType(ty core.QByteArray_ITF) []*core.QByteArray {
-	return func(l C.struct_QtSensors_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQSensorFromPointer(l.data).__sensorsForType_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QSensor_QSensor_SensorsForType(core.PointerFromQByteArray(ty)))
+	}(cGoUnpackStringListAndFree(C.QSensor_QSensor_SensorsForType(core.PointerFromQByteArray(ty))))
 }
 
 func (ptr *QSensor) SensorsForType(ty core.QByteArray_ITF) []*core.QByteArray {
-	return func(l C.struct_QtSensors_PackedList) []*core.QByteArray {
-		var out = make([]*core.QByteArray, int(l.len))
-		for i := 0; i < int(l.len); i++ {
-			out[i] = NewQSensorFromPointer(l.data).__sensorsForType_atList(i)
+	return func(l []string) []*core.QByteArray {
+		var out = make([]*core.QByteArray, len(l))
+		for i, v := range l {
+			out[i] = core.NewQByteArray2(v, len(v))
 		}
 		return out
-	}(C.QSensor_QSensor_SensorsForType(core.PointerFromQByteArray(ty)))
+	}(cGoUnpackStringListAndFree(C.QSensor_QSensor_SensorsForType(core.PointerFromQByteArray(ty))))
 }
 
 func NewQSensor(ty core.QByteArray_ITF, parent core.QObject_ITF) *QSensor {
 	var tmpValue = NewQSensorFromPointer(C.QSensor_NewQSensor(core.PointerFromQByteArray(ty), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -4019,7 +4054,7 @@ func (ptr *QSensor) ConnectToBackend() bool {
 
 //export callbackQSensor_Start
 func callbackQSensor_Start(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -4029,14 +4064,14 @@ func callbackQSensor_Start(ptr unsafe.Pointer) C.char {
 func (ptr *QSensor) ConnectStart(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -4056,7 +4091,7 @@ func (ptr *QSensor) StartDefault() bool {
 
 //export callbackQSensor_ActiveChanged
 func callbackQSensor_ActiveChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "activeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "activeChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4065,14 +4100,14 @@ func callbackQSensor_ActiveChanged(ptr unsafe.Pointer) {
 func (ptr *QSensor) ConnectActiveChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectActiveChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "activeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "activeChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectActiveChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectActiveChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "activeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "activeChanged")
 	}
 }
 
@@ -4090,7 +4125,7 @@ func (ptr *QSensor) AddFilter(filter QSensorFilter_ITF) {
 
 //export callbackQSensor_AlwaysOnChanged
 func callbackQSensor_AlwaysOnChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "alwaysOnChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "alwaysOnChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4099,14 +4134,14 @@ func callbackQSensor_AlwaysOnChanged(ptr unsafe.Pointer) {
 func (ptr *QSensor) ConnectAlwaysOnChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectAlwaysOnChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "alwaysOnChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "alwaysOnChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectAlwaysOnChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectAlwaysOnChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "alwaysOnChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "alwaysOnChanged")
 	}
 }
 
@@ -4118,7 +4153,7 @@ func (ptr *QSensor) AlwaysOnChanged() {
 
 //export callbackQSensor_AvailableSensorsChanged
 func callbackQSensor_AvailableSensorsChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "availableSensorsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "availableSensorsChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4127,14 +4162,14 @@ func callbackQSensor_AvailableSensorsChanged(ptr unsafe.Pointer) {
 func (ptr *QSensor) ConnectAvailableSensorsChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectAvailableSensorsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "availableSensorsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "availableSensorsChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectAvailableSensorsChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectAvailableSensorsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "availableSensorsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "availableSensorsChanged")
 	}
 }
 
@@ -4146,7 +4181,7 @@ func (ptr *QSensor) AvailableSensorsChanged() {
 
 //export callbackQSensor_AxesOrientationModeChanged
 func callbackQSensor_AxesOrientationModeChanged(ptr unsafe.Pointer, axesOrientationMode C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "axesOrientationModeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "axesOrientationModeChanged"); signal != nil {
 		signal.(func(QSensor__AxesOrientationMode))(QSensor__AxesOrientationMode(axesOrientationMode))
 	}
 
@@ -4155,14 +4190,14 @@ func callbackQSensor_AxesOrientationModeChanged(ptr unsafe.Pointer, axesOrientat
 func (ptr *QSensor) ConnectAxesOrientationModeChanged(f func(axesOrientationMode QSensor__AxesOrientationMode)) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectAxesOrientationModeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "axesOrientationModeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "axesOrientationModeChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectAxesOrientationModeChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectAxesOrientationModeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "axesOrientationModeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "axesOrientationModeChanged")
 	}
 }
 
@@ -4174,7 +4209,7 @@ func (ptr *QSensor) AxesOrientationModeChanged(axesOrientationMode QSensor__Axes
 
 //export callbackQSensor_BufferSizeChanged
 func callbackQSensor_BufferSizeChanged(ptr unsafe.Pointer, bufferSize C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bufferSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bufferSizeChanged"); signal != nil {
 		signal.(func(int))(int(int32(bufferSize)))
 	}
 
@@ -4183,14 +4218,14 @@ func callbackQSensor_BufferSizeChanged(ptr unsafe.Pointer, bufferSize C.int) {
 func (ptr *QSensor) ConnectBufferSizeChanged(f func(bufferSize int)) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectBufferSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "bufferSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "bufferSizeChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectBufferSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectBufferSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "bufferSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "bufferSizeChanged")
 	}
 }
 
@@ -4202,7 +4237,7 @@ func (ptr *QSensor) BufferSizeChanged(bufferSize int) {
 
 //export callbackQSensor_BusyChanged
 func callbackQSensor_BusyChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "busyChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "busyChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4211,14 +4246,14 @@ func callbackQSensor_BusyChanged(ptr unsafe.Pointer) {
 func (ptr *QSensor) ConnectBusyChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectBusyChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "busyChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "busyChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectBusyChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectBusyChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "busyChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "busyChanged")
 	}
 }
 
@@ -4230,7 +4265,7 @@ func (ptr *QSensor) BusyChanged() {
 
 //export callbackQSensor_CurrentOrientationChanged
 func callbackQSensor_CurrentOrientationChanged(ptr unsafe.Pointer, currentOrientation C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "currentOrientationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "currentOrientationChanged"); signal != nil {
 		signal.(func(int))(int(int32(currentOrientation)))
 	}
 
@@ -4239,14 +4274,14 @@ func callbackQSensor_CurrentOrientationChanged(ptr unsafe.Pointer, currentOrient
 func (ptr *QSensor) ConnectCurrentOrientationChanged(f func(currentOrientation int)) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectCurrentOrientationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "currentOrientationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "currentOrientationChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectCurrentOrientationChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectCurrentOrientationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "currentOrientationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "currentOrientationChanged")
 	}
 }
 
@@ -4258,7 +4293,7 @@ func (ptr *QSensor) CurrentOrientationChanged(currentOrientation int) {
 
 //export callbackQSensor_DataRateChanged
 func callbackQSensor_DataRateChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataRateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataRateChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4267,14 +4302,14 @@ func callbackQSensor_DataRateChanged(ptr unsafe.Pointer) {
 func (ptr *QSensor) ConnectDataRateChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectDataRateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dataRateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "dataRateChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectDataRateChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectDataRateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dataRateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "dataRateChanged")
 	}
 }
 
@@ -4286,7 +4321,7 @@ func (ptr *QSensor) DataRateChanged() {
 
 //export callbackQSensor_EfficientBufferSizeChanged
 func callbackQSensor_EfficientBufferSizeChanged(ptr unsafe.Pointer, efficientBufferSize C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "efficientBufferSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "efficientBufferSizeChanged"); signal != nil {
 		signal.(func(int))(int(int32(efficientBufferSize)))
 	}
 
@@ -4295,14 +4330,14 @@ func callbackQSensor_EfficientBufferSizeChanged(ptr unsafe.Pointer, efficientBuf
 func (ptr *QSensor) ConnectEfficientBufferSizeChanged(f func(efficientBufferSize int)) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectEfficientBufferSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "efficientBufferSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "efficientBufferSizeChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectEfficientBufferSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectEfficientBufferSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "efficientBufferSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "efficientBufferSizeChanged")
 	}
 }
 
@@ -4314,7 +4349,7 @@ func (ptr *QSensor) EfficientBufferSizeChanged(efficientBufferSize int) {
 
 //export callbackQSensor_MaxBufferSizeChanged
 func callbackQSensor_MaxBufferSizeChanged(ptr unsafe.Pointer, maxBufferSize C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "maxBufferSizeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "maxBufferSizeChanged"); signal != nil {
 		signal.(func(int))(int(int32(maxBufferSize)))
 	}
 
@@ -4323,14 +4358,14 @@ func callbackQSensor_MaxBufferSizeChanged(ptr unsafe.Pointer, maxBufferSize C.in
 func (ptr *QSensor) ConnectMaxBufferSizeChanged(f func(maxBufferSize int)) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectMaxBufferSizeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "maxBufferSizeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "maxBufferSizeChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectMaxBufferSizeChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectMaxBufferSizeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "maxBufferSizeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "maxBufferSizeChanged")
 	}
 }
 
@@ -4342,7 +4377,7 @@ func (ptr *QSensor) MaxBufferSizeChanged(maxBufferSize int) {
 
 //export callbackQSensor_ReadingChanged
 func callbackQSensor_ReadingChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readingChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readingChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4351,14 +4386,14 @@ func callbackQSensor_ReadingChanged(ptr unsafe.Pointer) {
 func (ptr *QSensor) ConnectReadingChanged(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectReadingChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readingChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "readingChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectReadingChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectReadingChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readingChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "readingChanged")
 	}
 }
 
@@ -4376,7 +4411,7 @@ func (ptr *QSensor) RemoveFilter(filter QSensorFilter_ITF) {
 
 //export callbackQSensor_SensorError
 func callbackQSensor_SensorError(ptr unsafe.Pointer, error C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sensorError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sensorError"); signal != nil {
 		signal.(func(int))(int(int32(error)))
 	}
 
@@ -4385,14 +4420,14 @@ func callbackQSensor_SensorError(ptr unsafe.Pointer, error C.int) {
 func (ptr *QSensor) ConnectSensorError(f func(error int)) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectSensorError(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sensorError", f)
+		qt.ConnectSignal(ptr.Pointer(), "sensorError", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectSensorError() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectSensorError(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sensorError")
+		qt.DisconnectSignal(ptr.Pointer(), "sensorError")
 	}
 }
 
@@ -4476,7 +4511,7 @@ func (ptr *QSensor) SetUserOrientation(userOrientation int) {
 
 //export callbackQSensor_SkipDuplicatesChanged
 func callbackQSensor_SkipDuplicatesChanged(ptr unsafe.Pointer, skipDuplicates C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "skipDuplicatesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "skipDuplicatesChanged"); signal != nil {
 		signal.(func(bool))(int8(skipDuplicates) != 0)
 	}
 
@@ -4485,14 +4520,14 @@ func callbackQSensor_SkipDuplicatesChanged(ptr unsafe.Pointer, skipDuplicates C.
 func (ptr *QSensor) ConnectSkipDuplicatesChanged(f func(skipDuplicates bool)) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectSkipDuplicatesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "skipDuplicatesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "skipDuplicatesChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectSkipDuplicatesChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectSkipDuplicatesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "skipDuplicatesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "skipDuplicatesChanged")
 	}
 }
 
@@ -4504,7 +4539,7 @@ func (ptr *QSensor) SkipDuplicatesChanged(skipDuplicates bool) {
 
 //export callbackQSensor_Stop
 func callbackQSensor_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorFromPointer(ptr).StopDefault()
@@ -4514,14 +4549,14 @@ func callbackQSensor_Stop(ptr unsafe.Pointer) {
 func (ptr *QSensor) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -4539,7 +4574,7 @@ func (ptr *QSensor) StopDefault() {
 
 //export callbackQSensor_UserOrientationChanged
 func callbackQSensor_UserOrientationChanged(ptr unsafe.Pointer, userOrientation C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "userOrientationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "userOrientationChanged"); signal != nil {
 		signal.(func(int))(int(int32(userOrientation)))
 	}
 
@@ -4548,14 +4583,14 @@ func callbackQSensor_UserOrientationChanged(ptr unsafe.Pointer, userOrientation
 func (ptr *QSensor) ConnectUserOrientationChanged(f func(userOrientation int)) {
 	if ptr.Pointer() != nil {
 		C.QSensor_ConnectUserOrientationChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "userOrientationChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "userOrientationChanged", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectUserOrientationChanged() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DisconnectUserOrientationChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "userOrientationChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "userOrientationChanged")
 	}
 }
 
@@ -4567,7 +4602,7 @@ func (ptr *QSensor) UserOrientationChanged(userOrientation int) {
 
 //export callbackQSensor_DestroyQSensor
 func callbackQSensor_DestroyQSensor(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSensor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSensor"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorFromPointer(ptr).DestroyQSensorDefault()
@@ -4577,21 +4612,21 @@ func callbackQSensor_DestroyQSensor(ptr unsafe.Pointer) {
 func (ptr *QSensor) ConnectDestroyQSensor(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSensor", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSensor", f)
 	}
 }
 
 func (ptr *QSensor) DisconnectDestroyQSensor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSensor")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSensor")
 	}
 }
 
 func (ptr *QSensor) DestroyQSensor() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DestroyQSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4599,7 +4634,7 @@ func (ptr *QSensor) DestroyQSensor() {
 func (ptr *QSensor) DestroyQSensorDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DestroyQSensorDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4645,7 +4680,7 @@ func (ptr *QSensor) Filters() []*QSensorFilter {
 func (ptr *QSensor) Reading() *QSensorReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSensorReadingFromPointer(C.QSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4835,7 +4870,7 @@ func (ptr *QSensor) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSensor) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensor___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4856,7 +4891,7 @@ func (ptr *QSensor) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSensor) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensor___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4877,7 +4912,7 @@ func (ptr *QSensor) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSensor) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensor___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4898,7 +4933,7 @@ func (ptr *QSensor) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSensor) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensor___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4918,7 +4953,7 @@ func (ptr *QSensor) __children_newList() unsafe.Pointer {
 
 //export callbackQSensor_Event
 func callbackQSensor_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -4934,7 +4969,7 @@ func (ptr *QSensor) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSensor_EventFilter
 func callbackQSensor_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -4950,7 +4985,7 @@ func (ptr *QSensor) EventFilterDefault(watched core.QObject_ITF, event core.QEve
 
 //export callbackQSensor_ChildEvent
 func callbackQSensor_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSensorFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -4965,7 +5000,7 @@ func (ptr *QSensor) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSensor_ConnectNotify
 func callbackQSensor_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4980,7 +5015,7 @@ func (ptr *QSensor) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSensor_CustomEvent
 func callbackQSensor_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSensorFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -4995,7 +5030,7 @@ func (ptr *QSensor) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSensor_DeleteLater
 func callbackQSensor_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorFromPointer(ptr).DeleteLaterDefault()
@@ -5005,14 +5040,14 @@ func callbackQSensor_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSensor) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensor_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensor_Destroyed
 func callbackQSensor_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -5020,7 +5055,7 @@ func callbackQSensor_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSensor_DisconnectNotify
 func callbackQSensor_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5035,7 +5070,7 @@ func (ptr *QSensor) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSensor_ObjectNameChanged
 func callbackQSensor_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSensors_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -5043,7 +5078,7 @@ func callbackQSensor_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_Q
 
 //export callbackQSensor_TimerEvent
 func callbackQSensor_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSensorFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -5058,7 +5093,7 @@ func (ptr *QSensor) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSensor_MetaObject
 func callbackQSensor_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -5114,7 +5149,7 @@ func NewQSensorBackendFromPointer(ptr unsafe.Pointer) *QSensorBackend {
 func (ptr *QSensorBackend) DestroyQSensorBackend() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5171,7 +5206,7 @@ func (ptr *QSensorBackend) SetDescription(description string) {
 
 //export callbackQSensorBackend_Start
 func callbackQSensorBackend_Start(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5180,14 +5215,14 @@ func callbackQSensorBackend_Start(ptr unsafe.Pointer) {
 func (ptr *QSensorBackend) ConnectStart(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QSensorBackend) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -5199,7 +5234,7 @@ func (ptr *QSensorBackend) Start() {
 
 //export callbackQSensorBackend_Stop
 func callbackQSensorBackend_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5208,14 +5243,14 @@ func callbackQSensorBackend_Stop(ptr unsafe.Pointer) {
 func (ptr *QSensorBackend) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QSensorBackend) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -5228,7 +5263,7 @@ func (ptr *QSensorBackend) Stop() {
 func (ptr *QSensorBackend) Sensor() *QSensor {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSensorFromPointer(C.QSensorBackend_Sensor(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5239,7 +5274,7 @@ func (ptr *QSensorBackend) Sensor() *QSensor {
 func (ptr *QSensorBackend) Reading() *QSensorReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSensorReadingFromPointer(C.QSensorBackend_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5249,7 +5284,7 @@ func (ptr *QSensorBackend) Reading() *QSensorReading {
 
 //export callbackQSensorBackend_IsFeatureSupported
 func callbackQSensorBackend_IsFeatureSupported(ptr unsafe.Pointer, feature C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isFeatureSupported"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isFeatureSupported"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(QSensor__Feature) bool)(QSensor__Feature(feature)))))
 	}
 
@@ -5259,14 +5294,14 @@ func callbackQSensorBackend_IsFeatureSupported(ptr unsafe.Pointer, feature C.lon
 func (ptr *QSensorBackend) ConnectIsFeatureSupported(f func(feature QSensor__Feature) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isFeatureSupported", f)
+		qt.ConnectSignal(ptr.Pointer(), "isFeatureSupported", f)
 	}
 }
 
 func (ptr *QSensorBackend) DisconnectIsFeatureSupported() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isFeatureSupported")
+		qt.DisconnectSignal(ptr.Pointer(), "isFeatureSupported")
 	}
 }
 
@@ -5306,7 +5341,7 @@ func (ptr *QSensorBackend) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSensorBackend) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorBackend___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5327,7 +5362,7 @@ func (ptr *QSensorBackend) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSensorBackend) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorBackend___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5348,7 +5383,7 @@ func (ptr *QSensorBackend) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSensorBackend) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorBackend___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5369,7 +5404,7 @@ func (ptr *QSensorBackend) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSensorBackend) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorBackend___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5389,7 +5424,7 @@ func (ptr *QSensorBackend) __children_newList() unsafe.Pointer {
 
 //export callbackQSensorBackend_Event
 func callbackQSensorBackend_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -5405,7 +5440,7 @@ func (ptr *QSensorBackend) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSensorBackend_EventFilter
 func callbackQSensorBackend_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -5421,7 +5456,7 @@ func (ptr *QSensorBackend) EventFilterDefault(watched core.QObject_ITF, event co
 
 //export callbackQSensorBackend_ChildEvent
 func callbackQSensorBackend_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSensorBackendFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -5436,7 +5471,7 @@ func (ptr *QSensorBackend) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSensorBackend_ConnectNotify
 func callbackQSensorBackend_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorBackendFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5451,7 +5486,7 @@ func (ptr *QSensorBackend) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSensorBackend_CustomEvent
 func callbackQSensorBackend_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSensorBackendFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -5466,7 +5501,7 @@ func (ptr *QSensorBackend) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSensorBackend_DeleteLater
 func callbackQSensorBackend_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorBackendFromPointer(ptr).DeleteLaterDefault()
@@ -5476,14 +5511,14 @@ func callbackQSensorBackend_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSensorBackend) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensorBackend_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorBackend_Destroyed
 func callbackQSensorBackend_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -5491,7 +5526,7 @@ func callbackQSensorBackend_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSensorBackend_DisconnectNotify
 func callbackQSensorBackend_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorBackendFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5506,7 +5541,7 @@ func (ptr *QSensorBackend) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSensorBackend_ObjectNameChanged
 func callbackQSensorBackend_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSensors_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -5514,7 +5549,7 @@ func callbackQSensorBackend_ObjectNameChanged(ptr unsafe.Pointer, objectName C.s
 
 //export callbackQSensorBackend_TimerEvent
 func callbackQSensorBackend_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSensorBackendFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -5529,7 +5564,7 @@ func (ptr *QSensorBackend) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSensorBackend_MetaObject
 func callbackQSensorBackend_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -5584,14 +5619,14 @@ func NewQSensorBackendFactoryFromPointer(ptr unsafe.Pointer) *QSensorBackendFact
 func (ptr *QSensorBackendFactory) DestroyQSensorBackendFactory() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorBackendFactory_CreateBackend
 func callbackQSensorBackendFactory_CreateBackend(ptr unsafe.Pointer, sensor unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createBackend"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createBackend"); signal != nil {
 		return PointerFromQSensorBackend(signal.(func(*QSensor) *QSensorBackend)(NewQSensorFromPointer(sensor)))
 	}
 
@@ -5601,21 +5636,21 @@ func callbackQSensorBackendFactory_CreateBackend(ptr unsafe.Pointer, sensor unsa
 func (ptr *QSensorBackendFactory) ConnectCreateBackend(f func(sensor *QSensor) *QSensorBackend) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createBackend", f)
+		qt.ConnectSignal(ptr.Pointer(), "createBackend", f)
 	}
 }
 
 func (ptr *QSensorBackendFactory) DisconnectCreateBackend() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createBackend")
+		qt.DisconnectSignal(ptr.Pointer(), "createBackend")
 	}
 }
 
 func (ptr *QSensorBackendFactory) CreateBackend(sensor QSensor_ITF) *QSensorBackend {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSensorBackendFromPointer(C.QSensorBackendFactory_CreateBackend(ptr.Pointer(), PointerFromQSensor(sensor)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5664,14 +5699,14 @@ func NewQSensorChangesInterfaceFromPointer(ptr unsafe.Pointer) *QSensorChangesIn
 func (ptr *QSensorChangesInterface) DestroyQSensorChangesInterface() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorChangesInterface_SensorsChanged
 func callbackQSensorChangesInterface_SensorsChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sensorsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sensorsChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -5680,14 +5715,14 @@ func callbackQSensorChangesInterface_SensorsChanged(ptr unsafe.Pointer) {
 func (ptr *QSensorChangesInterface) ConnectSensorsChanged(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sensorsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "sensorsChanged", f)
 	}
 }
 
 func (ptr *QSensorChangesInterface) DisconnectSensorsChanged() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sensorsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "sensorsChanged")
 	}
 }
 
@@ -5737,7 +5772,7 @@ func NewQSensorFilterFromPointer(ptr unsafe.Pointer) *QSensorFilter {
 
 //export callbackQSensorFilter_Filter
 func callbackQSensorFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QSensorReading) bool)(NewQSensorReadingFromPointer(reading)))))
 	}
 
@@ -5747,14 +5782,14 @@ func callbackQSensorFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.
 func (ptr *QSensorFilter) ConnectFilter(f func(reading *QSensorReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QSensorFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -5767,7 +5802,7 @@ func (ptr *QSensorFilter) Filter(reading QSensorReading_ITF) bool {
 
 //export callbackQSensorFilter_DestroyQSensorFilter
 func callbackQSensorFilter_DestroyQSensorFilter(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSensorFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSensorFilter"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorFilterFromPointer(ptr).DestroyQSensorFilterDefault()
@@ -5777,21 +5812,21 @@ func callbackQSensorFilter_DestroyQSensorFilter(ptr unsafe.Pointer) {
 func (ptr *QSensorFilter) ConnectDestroyQSensorFilter(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSensorFilter", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSensorFilter", f)
 	}
 }
 
 func (ptr *QSensorFilter) DisconnectDestroyQSensorFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSensorFilter")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSensorFilter")
 	}
 }
 
 func (ptr *QSensorFilter) DestroyQSensorFilter() {
 	if ptr.Pointer() != nil {
 		C.QSensorFilter_DestroyQSensorFilter(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5799,7 +5834,7 @@ func (ptr *QSensorFilter) DestroyQSensorFilter() {
 func (ptr *QSensorFilter) DestroyQSensorFilterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensorFilter_DestroyQSensorFilterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5807,7 +5842,7 @@ func (ptr *QSensorFilter) DestroyQSensorFilterDefault() {
 func (ptr *QSensorFilter) M_sensor() *QSensor {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSensorFromPointer(C.QSensorFilter_M_sensor(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5860,10 +5895,10 @@ func NewQSensorGestureFromPointer(ptr unsafe.Pointer) *QSensorGesture {
 	return n
 }
 func NewQSensorGesture(ids []string, parent core.QObject_ITF) *QSensorGesture {
-	var idsC = C.CString(strings.Join(ids, "|"))
+	var idsC = cGoPackStringList(ids)
 	defer C.free(unsafe.Pointer(idsC))
 	var tmpValue = NewQSensorGestureFromPointer(C.QSensorGesture_NewQSensorGesture(idsC, core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5878,7 +5913,7 @@ func (ptr *QSensorGesture) IsActive() bool {
 
 //export callbackQSensorGesture_Detected
 func callbackQSensorGesture_Detected(ptr unsafe.Pointer, gestureId C.struct_QtSensors_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "detected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "detected"); signal != nil {
 		signal.(func(string))(cGoUnpackString(gestureId))
 	}
 
@@ -5887,14 +5922,14 @@ func callbackQSensorGesture_Detected(ptr unsafe.Pointer, gestureId C.struct_QtSe
 func (ptr *QSensorGesture) ConnectDetected(f func(gestureId string)) {
 	if ptr.Pointer() != nil {
 		C.QSensorGesture_ConnectDetected(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "detected", f)
+		qt.ConnectSignal(ptr.Pointer(), "detected", f)
 	}
 }
 
 func (ptr *QSensorGesture) DisconnectDetected() {
 	if ptr.Pointer() != nil {
 		C.QSensorGesture_DisconnectDetected(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "detected")
+		qt.DisconnectSignal(ptr.Pointer(), "detected")
 	}
 }
 
@@ -5921,28 +5956,28 @@ func (ptr *QSensorGesture) StopDetection() {
 func (ptr *QSensorGesture) DestroyQSensorGesture() {
 	if ptr.Pointer() != nil {
 		C.QSensorGesture_DestroyQSensorGesture(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func (ptr *QSensorGesture) GestureSignals() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSensorGesture_GestureSignals(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSensorGesture_GestureSignals(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSensorGesture) InvalidIds() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSensorGesture_InvalidIds(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSensorGesture_InvalidIds(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSensorGesture) ValidIds() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSensorGesture_ValidIds(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSensorGesture_ValidIds(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -5969,7 +6004,7 @@ func (ptr *QSensorGesture) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSensorGesture) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGesture___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5990,7 +6025,7 @@ func (ptr *QSensorGesture) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSensorGesture) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGesture___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6011,7 +6046,7 @@ func (ptr *QSensorGesture) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSensorGesture) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGesture___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6032,7 +6067,7 @@ func (ptr *QSensorGesture) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSensorGesture) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGesture___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6052,7 +6087,7 @@ func (ptr *QSensorGesture) __children_newList() unsafe.Pointer {
 
 //export callbackQSensorGesture_Event
 func callbackQSensorGesture_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -6068,7 +6103,7 @@ func (ptr *QSensorGesture) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSensorGesture_EventFilter
 func callbackQSensorGesture_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -6084,7 +6119,7 @@ func (ptr *QSensorGesture) EventFilterDefault(watched core.QObject_ITF, event co
 
 //export callbackQSensorGesture_ChildEvent
 func callbackQSensorGesture_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSensorGestureFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -6099,7 +6134,7 @@ func (ptr *QSensorGesture) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSensorGesture_ConnectNotify
 func callbackQSensorGesture_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorGestureFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6114,7 +6149,7 @@ func (ptr *QSensorGesture) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSensorGesture_CustomEvent
 func callbackQSensorGesture_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSensorGestureFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -6129,7 +6164,7 @@ func (ptr *QSensorGesture) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSensorGesture_DeleteLater
 func callbackQSensorGesture_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorGestureFromPointer(ptr).DeleteLaterDefault()
@@ -6139,14 +6174,14 @@ func callbackQSensorGesture_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSensorGesture) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensorGesture_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorGesture_Destroyed
 func callbackQSensorGesture_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -6154,7 +6189,7 @@ func callbackQSensorGesture_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSensorGesture_DisconnectNotify
 func callbackQSensorGesture_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorGestureFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6169,7 +6204,7 @@ func (ptr *QSensorGesture) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSensorGesture_ObjectNameChanged
 func callbackQSensorGesture_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSensors_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -6177,7 +6212,7 @@ func callbackQSensorGesture_ObjectNameChanged(ptr unsafe.Pointer, objectName C.s
 
 //export callbackQSensorGesture_TimerEvent
 func callbackQSensorGesture_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSensorGestureFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -6192,7 +6227,7 @@ func (ptr *QSensorGesture) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSensorGesture_MetaObject
 func callbackQSensorGesture_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -6246,7 +6281,7 @@ func NewQSensorGestureManagerFromPointer(ptr unsafe.Pointer) *QSensorGestureMana
 }
 func NewQSensorGestureManager(parent core.QObject_ITF) *QSensorGestureManager {
 	var tmpValue = NewQSensorGestureManagerFromPointer(C.QSensorGestureManager_NewQSensorGestureManager(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -6256,7 +6291,7 @@ func QSensorGestureManager_SensorGestureRecognizer(id string) *QSensorGestureRec
 	var idC = C.CString(id)
 	defer C.free(unsafe.Pointer(idC))
 	var tmpValue = NewQSensorGestureRecognizerFromPointer(C.QSensorGestureManager_QSensorGestureManager_SensorGestureRecognizer(idC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -6266,7 +6301,7 @@ func (ptr *QSensorGestureManager) SensorGestureRecognizer(id string) *QSensorGes
 	var idC = C.CString(id)
 	defer C.free(unsafe.Pointer(idC))
 	var tmpValue = NewQSensorGestureRecognizerFromPointer(C.QSensorGestureManager_QSensorGestureManager_SensorGestureRecognizer(idC))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -6281,7 +6316,7 @@ func (ptr *QSensorGestureManager) RegisterSensorGestureRecognizer(recognizer QSe
 
 //export callbackQSensorGestureManager_NewSensorGestureAvailable
 func callbackQSensorGestureManager_NewSensorGestureAvailable(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "newSensorGestureAvailable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "newSensorGestureAvailable"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6290,14 +6325,14 @@ func callbackQSensorGestureManager_NewSensorGestureAvailable(ptr unsafe.Pointer)
 func (ptr *QSensorGestureManager) ConnectNewSensorGestureAvailable(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSensorGestureManager_ConnectNewSensorGestureAvailable(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "newSensorGestureAvailable", f)
+		qt.ConnectSignal(ptr.Pointer(), "newSensorGestureAvailable", f)
 	}
 }
 
 func (ptr *QSensorGestureManager) DisconnectNewSensorGestureAvailable() {
 	if ptr.Pointer() != nil {
 		C.QSensorGestureManager_DisconnectNewSensorGestureAvailable(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "newSensorGestureAvailable")
+		qt.DisconnectSignal(ptr.Pointer(), "newSensorGestureAvailable")
 	}
 }
 
@@ -6310,14 +6345,14 @@ func (ptr *QSensorGestureManager) NewSensorGestureAvailable() {
 func (ptr *QSensorGestureManager) DestroyQSensorGestureManager() {
 	if ptr.Pointer() != nil {
 		C.QSensorGestureManager_DestroyQSensorGestureManager(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func (ptr *QSensorGestureManager) GestureIds() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSensorGestureManager_GestureIds(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSensorGestureManager_GestureIds(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -6326,7 +6361,7 @@ func (ptr *QSensorGestureManager) RecognizerSignals(gestureId string) []string {
 	if ptr.Pointer() != nil {
 		var gestureIdC = C.CString(gestureId)
 		defer C.free(unsafe.Pointer(gestureIdC))
-		return strings.Split(cGoUnpackString(C.QSensorGestureManager_RecognizerSignals(ptr.Pointer(), gestureIdC)), "|")
+		return cGoUnpackStringListAndFree(C.QSensorGestureManager_RecognizerSignals(ptr.Pointer(), gestureIdC))
 	}
 	return make([]string, 0)
 }
@@ -6353,7 +6388,7 @@ func (ptr *QSensorGestureManager) __dynamicPropertyNames_newList() unsafe.Pointe
 func (ptr *QSensorGestureManager) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGestureManager___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6374,7 +6409,7 @@ func (ptr *QSensorGestureManager) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSensorGestureManager) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGestureManager___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6395,7 +6430,7 @@ func (ptr *QSensorGestureManager) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSensorGestureManager) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGestureManager___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6416,7 +6451,7 @@ func (ptr *QSensorGestureManager) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSensorGestureManager) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGestureManager___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6436,7 +6471,7 @@ func (ptr *QSensorGestureManager) __children_newList() unsafe.Pointer {
 
 //export callbackQSensorGestureManager_Event
 func callbackQSensorGestureManager_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -6452,7 +6487,7 @@ func (ptr *QSensorGestureManager) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSensorGestureManager_EventFilter
 func callbackQSensorGestureManager_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -6468,7 +6503,7 @@ func (ptr *QSensorGestureManager) EventFilterDefault(watched core.QObject_ITF, e
 
 //export callbackQSensorGestureManager_ChildEvent
 func callbackQSensorGestureManager_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSensorGestureManagerFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -6483,7 +6518,7 @@ func (ptr *QSensorGestureManager) ChildEventDefault(event core.QChildEvent_ITF)
 
 //export callbackQSensorGestureManager_ConnectNotify
 func callbackQSensorGestureManager_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorGestureManagerFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6498,7 +6533,7 @@ func (ptr *QSensorGestureManager) ConnectNotifyDefault(sign core.QMetaMethod_ITF
 
 //export callbackQSensorGestureManager_CustomEvent
 func callbackQSensorGestureManager_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSensorGestureManagerFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -6513,7 +6548,7 @@ func (ptr *QSensorGestureManager) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSensorGestureManager_DeleteLater
 func callbackQSensorGestureManager_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorGestureManagerFromPointer(ptr).DeleteLaterDefault()
@@ -6523,14 +6558,14 @@ func callbackQSensorGestureManager_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSensorGestureManager) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensorGestureManager_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorGestureManager_Destroyed
 func callbackQSensorGestureManager_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -6538,7 +6573,7 @@ func callbackQSensorGestureManager_Destroyed(ptr unsafe.Pointer, obj unsafe.Poin
 
 //export callbackQSensorGestureManager_DisconnectNotify
 func callbackQSensorGestureManager_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorGestureManagerFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -6553,7 +6588,7 @@ func (ptr *QSensorGestureManager) DisconnectNotifyDefault(sign core.QMetaMethod_
 
 //export callbackQSensorGestureManager_ObjectNameChanged
 func callbackQSensorGestureManager_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSensors_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -6561,7 +6596,7 @@ func callbackQSensorGestureManager_ObjectNameChanged(ptr unsafe.Pointer, objectN
 
 //export callbackQSensorGestureManager_TimerEvent
 func callbackQSensorGestureManager_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSensorGestureManagerFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -6576,7 +6611,7 @@ func (ptr *QSensorGestureManager) TimerEventDefault(event core.QTimerEvent_ITF)
 
 //export callbackQSensorGestureManager_MetaObject
 func callbackQSensorGestureManager_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -6630,7 +6665,7 @@ func NewQSensorGesturePluginInterfaceFromPointer(ptr unsafe.Pointer) *QSensorGes
 
 //export callbackQSensorGesturePluginInterface_CreateRecognizers
 func callbackQSensorGesturePluginInterface_CreateRecognizers(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createRecognizers"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createRecognizers"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQSensorGesturePluginInterfaceFromPointer(NewQSensorGesturePluginInterfaceFromPointer(nil).__createRecognizers_newList())
 			for _, v := range signal.(func() []*QSensorGestureRecognizer)() {
@@ -6652,14 +6687,14 @@ func callbackQSensorGesturePluginInterface_CreateRecognizers(ptr unsafe.Pointer)
 func (ptr *QSensorGesturePluginInterface) ConnectCreateRecognizers(f func() []*QSensorGestureRecognizer) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createRecognizers", f)
+		qt.ConnectSignal(ptr.Pointer(), "createRecognizers", f)
 	}
 }
 
 func (ptr *QSensorGesturePluginInterface) DisconnectCreateRecognizers() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createRecognizers")
+		qt.DisconnectSignal(ptr.Pointer(), "createRecognizers")
 	}
 }
 
@@ -6682,7 +6717,7 @@ func NewQSensorGesturePluginInterface() *QSensorGesturePluginInterface {
 
 //export callbackQSensorGesturePluginInterface_DestroyQSensorGesturePluginInterface
 func callbackQSensorGesturePluginInterface_DestroyQSensorGesturePluginInterface(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSensorGesturePluginInterface"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSensorGesturePluginInterface"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorGesturePluginInterfaceFromPointer(ptr).DestroyQSensorGesturePluginInterfaceDefault()
@@ -6692,21 +6727,21 @@ func callbackQSensorGesturePluginInterface_DestroyQSensorGesturePluginInterface(
 func (ptr *QSensorGesturePluginInterface) ConnectDestroyQSensorGesturePluginInterface(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSensorGesturePluginInterface", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSensorGesturePluginInterface", f)
 	}
 }
 
 func (ptr *QSensorGesturePluginInterface) DisconnectDestroyQSensorGesturePluginInterface() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSensorGesturePluginInterface")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSensorGesturePluginInterface")
 	}
 }
 
 func (ptr *QSensorGesturePluginInterface) DestroyQSensorGesturePluginInterface() {
 	if ptr.Pointer() != nil {
 		C.QSensorGesturePluginInterface_DestroyQSensorGesturePluginInterface(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6714,14 +6749,14 @@ func (ptr *QSensorGesturePluginInterface) DestroyQSensorGesturePluginInterface()
 func (ptr *QSensorGesturePluginInterface) DestroyQSensorGesturePluginInterfaceDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensorGesturePluginInterface_DestroyQSensorGesturePluginInterfaceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorGesturePluginInterface_Name
 func callbackQSensorGesturePluginInterface_Name(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "name"); signal != nil {
+	if signal := qt.GetSignal(ptr, "name"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -6731,14 +6766,14 @@ func callbackQSensorGesturePluginInterface_Name(ptr unsafe.Pointer) *C.char {
 func (ptr *QSensorGesturePluginInterface) ConnectName(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "name", f)
+		qt.ConnectSignal(ptr.Pointer(), "name", f)
 	}
 }
 
 func (ptr *QSensorGesturePluginInterface) DisconnectName() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "name")
+		qt.DisconnectSignal(ptr.Pointer(), "name")
 	}
 }
 
@@ -6751,30 +6786,30 @@ func (ptr *QSensorGesturePluginInterface) Name() string {
 
 //export callbackQSensorGesturePluginInterface_SupportedIds
 func callbackQSensorGesturePluginInterface_SupportedIds(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedIds"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "supportedIds"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(make([]string, 0), "|"))
+	return cGoPackStringList(make([]string, 0))
 }
 
 func (ptr *QSensorGesturePluginInterface) ConnectSupportedIds(f func() []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "supportedIds", f)
+		qt.ConnectSignal(ptr.Pointer(), "supportedIds", f)
 	}
 }
 
 func (ptr *QSensorGesturePluginInterface) DisconnectSupportedIds() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "supportedIds")
+		qt.DisconnectSignal(ptr.Pointer(), "supportedIds")
 	}
 }
 
 func (ptr *QSensorGesturePluginInterface) SupportedIds() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSensorGesturePluginInterface_SupportedIds(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSensorGesturePluginInterface_SupportedIds(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -6782,7 +6817,7 @@ func (ptr *QSensorGesturePluginInterface) SupportedIds() []string {
 func (ptr *QSensorGesturePluginInterface) __createRecognizers_atList(i int) *QSensorGestureRecognizer {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSensorGestureRecognizerFromPointer(C.QSensorGesturePluginInterface___createRecognizers_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6840,7 +6875,7 @@ func NewQSensorGestureRecognizerFromPointer(ptr unsafe.Pointer) *QSensorGestureR
 }
 func NewQSensorGestureRecognizer(parent core.QObject_ITF) *QSensorGestureRecognizer {
 	var tmpValue = NewQSensorGestureRecognizerFromPointer(C.QSensorGestureRecognizer_NewQSensorGestureRecognizer(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -6848,7 +6883,7 @@ func NewQSensorGestureRecognizer(parent core.QObject_ITF) *QSensorGestureRecogni
 
 //export callbackQSensorGestureRecognizer_IsActive
 func callbackQSensorGestureRecognizer_IsActive(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isActive"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isActive"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6858,14 +6893,14 @@ func callbackQSensorGestureRecognizer_IsActive(ptr unsafe.Pointer) C.char {
 func (ptr *QSensorGestureRecognizer) ConnectIsActive(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isActive", f)
+		qt.ConnectSignal(ptr.Pointer(), "isActive", f)
 	}
 }
 
 func (ptr *QSensorGestureRecognizer) DisconnectIsActive() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isActive")
+		qt.DisconnectSignal(ptr.Pointer(), "isActive")
 	}
 }
 
@@ -6878,7 +6913,7 @@ func (ptr *QSensorGestureRecognizer) IsActive() bool {
 
 //export callbackQSensorGestureRecognizer_Start
 func callbackQSensorGestureRecognizer_Start(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "start"); signal != nil {
+	if signal := qt.GetSignal(ptr, "start"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6888,14 +6923,14 @@ func callbackQSensorGestureRecognizer_Start(ptr unsafe.Pointer) C.char {
 func (ptr *QSensorGestureRecognizer) ConnectStart(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "start", f)
+		qt.ConnectSignal(ptr.Pointer(), "start", f)
 	}
 }
 
 func (ptr *QSensorGestureRecognizer) DisconnectStart() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "start")
+		qt.DisconnectSignal(ptr.Pointer(), "start")
 	}
 }
 
@@ -6908,7 +6943,7 @@ func (ptr *QSensorGestureRecognizer) Start() bool {
 
 //export callbackQSensorGestureRecognizer_Stop
 func callbackQSensorGestureRecognizer_Stop(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6918,14 +6953,14 @@ func callbackQSensorGestureRecognizer_Stop(ptr unsafe.Pointer) C.char {
 func (ptr *QSensorGestureRecognizer) ConnectStop(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QSensorGestureRecognizer) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -6938,7 +6973,7 @@ func (ptr *QSensorGestureRecognizer) Stop() bool {
 
 //export callbackQSensorGestureRecognizer_Create
 func callbackQSensorGestureRecognizer_Create(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "create"); signal != nil {
+	if signal := qt.GetSignal(ptr, "create"); signal != nil {
 		signal.(func())()
 	}
 
@@ -6947,14 +6982,14 @@ func callbackQSensorGestureRecognizer_Create(ptr unsafe.Pointer) {
 func (ptr *QSensorGestureRecognizer) ConnectCreate(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "create", f)
+		qt.ConnectSignal(ptr.Pointer(), "create", f)
 	}
 }
 
 func (ptr *QSensorGestureRecognizer) DisconnectCreate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "create")
+		qt.DisconnectSignal(ptr.Pointer(), "create")
 	}
 }
 
@@ -6972,7 +7007,7 @@ func (ptr *QSensorGestureRecognizer) CreateBackend() {
 
 //export callbackQSensorGestureRecognizer_Detected
 func callbackQSensorGestureRecognizer_Detected(ptr unsafe.Pointer, gestureId C.struct_QtSensors_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "detected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "detected"); signal != nil {
 		signal.(func(string))(cGoUnpackString(gestureId))
 	}
 
@@ -6981,14 +7016,14 @@ func callbackQSensorGestureRecognizer_Detected(ptr unsafe.Pointer, gestureId C.s
 func (ptr *QSensorGestureRecognizer) ConnectDetected(f func(gestureId string)) {
 	if ptr.Pointer() != nil {
 		C.QSensorGestureRecognizer_ConnectDetected(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "detected", f)
+		qt.ConnectSignal(ptr.Pointer(), "detected", f)
 	}
 }
 
 func (ptr *QSensorGestureRecognizer) DisconnectDetected() {
 	if ptr.Pointer() != nil {
 		C.QSensorGestureRecognizer_DisconnectDetected(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "detected")
+		qt.DisconnectSignal(ptr.Pointer(), "detected")
 	}
 }
 
@@ -7014,7 +7049,7 @@ func (ptr *QSensorGestureRecognizer) StopBackend() {
 
 //export callbackQSensorGestureRecognizer_DestroyQSensorGestureRecognizer
 func callbackQSensorGestureRecognizer_DestroyQSensorGestureRecognizer(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSensorGestureRecognizer"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSensorGestureRecognizer"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorGestureRecognizerFromPointer(ptr).DestroyQSensorGestureRecognizerDefault()
@@ -7024,21 +7059,21 @@ func callbackQSensorGestureRecognizer_DestroyQSensorGestureRecognizer(ptr unsafe
 func (ptr *QSensorGestureRecognizer) ConnectDestroyQSensorGestureRecognizer(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSensorGestureRecognizer", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSensorGestureRecognizer", f)
 	}
 }
 
 func (ptr *QSensorGestureRecognizer) DisconnectDestroyQSensorGestureRecognizer() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSensorGestureRecognizer")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSensorGestureRecognizer")
 	}
 }
 
 func (ptr *QSensorGestureRecognizer) DestroyQSensorGestureRecognizer() {
 	if ptr.Pointer() != nil {
 		C.QSensorGestureRecognizer_DestroyQSensorGestureRecognizer(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7046,14 +7081,14 @@ func (ptr *QSensorGestureRecognizer) DestroyQSensorGestureRecognizer() {
 func (ptr *QSensorGestureRecognizer) DestroyQSensorGestureRecognizerDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensorGestureRecognizer_DestroyQSensorGestureRecognizerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorGestureRecognizer_Id
 func callbackQSensorGestureRecognizer_Id(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "id"); signal != nil {
+	if signal := qt.GetSignal(ptr, "id"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -7063,14 +7098,14 @@ func callbackQSensorGestureRecognizer_Id(ptr unsafe.Pointer) *C.char {
 func (ptr *QSensorGestureRecognizer) ConnectId(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "id", f)
+		qt.ConnectSignal(ptr.Pointer(), "id", f)
 	}
 }
 
 func (ptr *QSensorGestureRecognizer) DisconnectId() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "id")
+		qt.DisconnectSignal(ptr.Pointer(), "id")
 	}
 }
 
@@ -7083,7 +7118,7 @@ func (ptr *QSensorGestureRecognizer) Id() string {
 
 func (ptr *QSensorGestureRecognizer) GestureSignals() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSensorGestureRecognizer_GestureSignals(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSensorGestureRecognizer_GestureSignals(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -7110,7 +7145,7 @@ func (ptr *QSensorGestureRecognizer) __dynamicPropertyNames_newList() unsafe.Poi
 func (ptr *QSensorGestureRecognizer) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGestureRecognizer___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7131,7 +7166,7 @@ func (ptr *QSensorGestureRecognizer) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSensorGestureRecognizer) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGestureRecognizer___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7152,7 +7187,7 @@ func (ptr *QSensorGestureRecognizer) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSensorGestureRecognizer) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGestureRecognizer___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7173,7 +7208,7 @@ func (ptr *QSensorGestureRecognizer) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSensorGestureRecognizer) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorGestureRecognizer___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7193,7 +7228,7 @@ func (ptr *QSensorGestureRecognizer) __children_newList() unsafe.Pointer {
 
 //export callbackQSensorGestureRecognizer_Event
 func callbackQSensorGestureRecognizer_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -7209,7 +7244,7 @@ func (ptr *QSensorGestureRecognizer) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSensorGestureRecognizer_EventFilter
 func callbackQSensorGestureRecognizer_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -7225,7 +7260,7 @@ func (ptr *QSensorGestureRecognizer) EventFilterDefault(watched core.QObject_ITF
 
 //export callbackQSensorGestureRecognizer_ChildEvent
 func callbackQSensorGestureRecognizer_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSensorGestureRecognizerFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -7240,7 +7275,7 @@ func (ptr *QSensorGestureRecognizer) ChildEventDefault(event core.QChildEvent_IT
 
 //export callbackQSensorGestureRecognizer_ConnectNotify
 func callbackQSensorGestureRecognizer_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorGestureRecognizerFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7255,7 +7290,7 @@ func (ptr *QSensorGestureRecognizer) ConnectNotifyDefault(sign core.QMetaMethod_
 
 //export callbackQSensorGestureRecognizer_CustomEvent
 func callbackQSensorGestureRecognizer_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSensorGestureRecognizerFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -7270,7 +7305,7 @@ func (ptr *QSensorGestureRecognizer) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSensorGestureRecognizer_DeleteLater
 func callbackQSensorGestureRecognizer_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorGestureRecognizerFromPointer(ptr).DeleteLaterDefault()
@@ -7280,14 +7315,14 @@ func callbackQSensorGestureRecognizer_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSensorGestureRecognizer) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensorGestureRecognizer_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorGestureRecognizer_Destroyed
 func callbackQSensorGestureRecognizer_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -7295,7 +7330,7 @@ func callbackQSensorGestureRecognizer_Destroyed(ptr unsafe.Pointer, obj unsafe.P
 
 //export callbackQSensorGestureRecognizer_DisconnectNotify
 func callbackQSensorGestureRecognizer_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorGestureRecognizerFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7310,7 +7345,7 @@ func (ptr *QSensorGestureRecognizer) DisconnectNotifyDefault(sign core.QMetaMeth
 
 //export callbackQSensorGestureRecognizer_ObjectNameChanged
 func callbackQSensorGestureRecognizer_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSensors_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -7318,7 +7353,7 @@ func callbackQSensorGestureRecognizer_ObjectNameChanged(ptr unsafe.Pointer, obje
 
 //export callbackQSensorGestureRecognizer_TimerEvent
 func callbackQSensorGestureRecognizer_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSensorGestureRecognizerFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -7333,7 +7368,7 @@ func (ptr *QSensorGestureRecognizer) TimerEventDefault(event core.QTimerEvent_IT
 
 //export callbackQSensorGestureRecognizer_MetaObject
 func callbackQSensorGestureRecognizer_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -7394,7 +7429,7 @@ func (ptr *QSensorManager) DestroyQSensorManager() {
 
 func QSensorManager_CreateBackend(sensor QSensor_ITF) *QSensorBackend {
 	var tmpValue = NewQSensorBackendFromPointer(C.QSensorManager_QSensorManager_CreateBackend(PointerFromQSensor(sensor)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -7402,7 +7437,7 @@ func QSensorManager_CreateBackend(sensor QSensor_ITF) *QSensorBackend {
 
 func (ptr *QSensorManager) CreateBackend(sensor QSensor_ITF) *QSensorBackend {
 	var tmpValue = NewQSensorBackendFromPointer(C.QSensorManager_QSensorManager_CreateBackend(PointerFromQSensor(sensor)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -7481,14 +7516,14 @@ func NewQSensorPluginInterfaceFromPointer(ptr unsafe.Pointer) *QSensorPluginInte
 func (ptr *QSensorPluginInterface) DestroyQSensorPluginInterface() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorPluginInterface_RegisterSensors
 func callbackQSensorPluginInterface_RegisterSensors(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "registerSensors"); signal != nil {
+	if signal := qt.GetSignal(ptr, "registerSensors"); signal != nil {
 		signal.(func())()
 	}
 
@@ -7497,14 +7532,14 @@ func callbackQSensorPluginInterface_RegisterSensors(ptr unsafe.Pointer) {
 func (ptr *QSensorPluginInterface) ConnectRegisterSensors(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "registerSensors", f)
+		qt.ConnectSignal(ptr.Pointer(), "registerSensors", f)
 	}
 }
 
 func (ptr *QSensorPluginInterface) DisconnectRegisterSensors() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "registerSensors")
+		qt.DisconnectSignal(ptr.Pointer(), "registerSensors")
 	}
 }
 
@@ -7556,7 +7591,7 @@ func NewQSensorReadingFromPointer(ptr unsafe.Pointer) *QSensorReading {
 func (ptr *QSensorReading) DestroyQSensorReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7612,7 +7647,7 @@ func (ptr *QSensorReading) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSensorReading) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorReading___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7633,7 +7668,7 @@ func (ptr *QSensorReading) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSensorReading) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorReading___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7654,7 +7689,7 @@ func (ptr *QSensorReading) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSensorReading) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorReading___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7675,7 +7710,7 @@ func (ptr *QSensorReading) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSensorReading) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSensorReading___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7695,7 +7730,7 @@ func (ptr *QSensorReading) __children_newList() unsafe.Pointer {
 
 //export callbackQSensorReading_Event
 func callbackQSensorReading_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -7711,7 +7746,7 @@ func (ptr *QSensorReading) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSensorReading_EventFilter
 func callbackQSensorReading_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -7727,7 +7762,7 @@ func (ptr *QSensorReading) EventFilterDefault(watched core.QObject_ITF, event co
 
 //export callbackQSensorReading_ChildEvent
 func callbackQSensorReading_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSensorReadingFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -7742,7 +7777,7 @@ func (ptr *QSensorReading) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSensorReading_ConnectNotify
 func callbackQSensorReading_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorReadingFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7757,7 +7792,7 @@ func (ptr *QSensorReading) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSensorReading_CustomEvent
 func callbackQSensorReading_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSensorReadingFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -7772,7 +7807,7 @@ func (ptr *QSensorReading) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSensorReading_DeleteLater
 func callbackQSensorReading_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSensorReadingFromPointer(ptr).DeleteLaterDefault()
@@ -7782,14 +7817,14 @@ func callbackQSensorReading_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSensorReading) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSensorReading_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSensorReading_Destroyed
 func callbackQSensorReading_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -7797,7 +7832,7 @@ func callbackQSensorReading_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSensorReading_DisconnectNotify
 func callbackQSensorReading_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSensorReadingFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -7812,7 +7847,7 @@ func (ptr *QSensorReading) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSensorReading_ObjectNameChanged
 func callbackQSensorReading_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSensors_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -7820,7 +7855,7 @@ func callbackQSensorReading_ObjectNameChanged(ptr unsafe.Pointer, objectName C.s
 
 //export callbackQSensorReading_TimerEvent
 func callbackQSensorReading_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSensorReadingFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -7835,7 +7870,7 @@ func (ptr *QSensorReading) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSensorReading_MetaObject
 func callbackQSensorReading_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -7891,14 +7926,14 @@ func NewQTapFilterFromPointer(ptr unsafe.Pointer) *QTapFilter {
 func (ptr *QTapFilter) DestroyQTapFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQTapFilter_Filter
 func callbackQTapFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QTapReading) bool)(NewQTapReadingFromPointer(reading)))))
 	}
 
@@ -7908,14 +7943,14 @@ func callbackQTapFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.cha
 func (ptr *QTapFilter) ConnectFilter(f func(reading *QTapReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QTapFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -7968,7 +8003,7 @@ func NewQTapReadingFromPointer(ptr unsafe.Pointer) *QTapReading {
 func (ptr *QTapReading) DestroyQTapReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8059,7 +8094,7 @@ func NewQTapSensorFromPointer(ptr unsafe.Pointer) *QTapSensor {
 }
 func NewQTapSensor(parent core.QObject_ITF) *QTapSensor {
 	var tmpValue = NewQTapSensorFromPointer(C.QTapSensor_NewQTapSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -8067,7 +8102,7 @@ func NewQTapSensor(parent core.QObject_ITF) *QTapSensor {
 
 //export callbackQTapSensor_ReturnDoubleTapEventsChanged
 func callbackQTapSensor_ReturnDoubleTapEventsChanged(ptr unsafe.Pointer, returnDoubleTapEvents C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "returnDoubleTapEventsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "returnDoubleTapEventsChanged"); signal != nil {
 		signal.(func(bool))(int8(returnDoubleTapEvents) != 0)
 	}
 
@@ -8076,14 +8111,14 @@ func callbackQTapSensor_ReturnDoubleTapEventsChanged(ptr unsafe.Pointer, returnD
 func (ptr *QTapSensor) ConnectReturnDoubleTapEventsChanged(f func(returnDoubleTapEvents bool)) {
 	if ptr.Pointer() != nil {
 		C.QTapSensor_ConnectReturnDoubleTapEventsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "returnDoubleTapEventsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "returnDoubleTapEventsChanged", f)
 	}
 }
 
 func (ptr *QTapSensor) DisconnectReturnDoubleTapEventsChanged() {
 	if ptr.Pointer() != nil {
 		C.QTapSensor_DisconnectReturnDoubleTapEventsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "returnDoubleTapEventsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "returnDoubleTapEventsChanged")
 	}
 }
 
@@ -8101,7 +8136,7 @@ func (ptr *QTapSensor) SetReturnDoubleTapEvents(returnDoubleTapEvents bool) {
 
 //export callbackQTapSensor_DestroyQTapSensor
 func callbackQTapSensor_DestroyQTapSensor(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTapSensor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTapSensor"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTapSensorFromPointer(ptr).DestroyQTapSensorDefault()
@@ -8111,21 +8146,21 @@ func callbackQTapSensor_DestroyQTapSensor(ptr unsafe.Pointer) {
 func (ptr *QTapSensor) ConnectDestroyQTapSensor(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTapSensor", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTapSensor", f)
 	}
 }
 
 func (ptr *QTapSensor) DisconnectDestroyQTapSensor() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTapSensor")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTapSensor")
 	}
 }
 
 func (ptr *QTapSensor) DestroyQTapSensor() {
 	if ptr.Pointer() != nil {
 		C.QTapSensor_DestroyQTapSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8133,7 +8168,7 @@ func (ptr *QTapSensor) DestroyQTapSensor() {
 func (ptr *QTapSensor) DestroyQTapSensorDefault() {
 	if ptr.Pointer() != nil {
 		C.QTapSensor_DestroyQTapSensorDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8141,7 +8176,7 @@ func (ptr *QTapSensor) DestroyQTapSensorDefault() {
 func (ptr *QTapSensor) Reading() *QTapReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTapReadingFromPointer(C.QTapSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -8206,14 +8241,14 @@ func NewQTiltFilterFromPointer(ptr unsafe.Pointer) *QTiltFilter {
 func (ptr *QTiltFilter) DestroyQTiltFilter() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQTiltFilter_Filter
 func callbackQTiltFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "filter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "filter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QTiltReading) bool)(NewQTiltReadingFromPointer(reading)))))
 	}
 
@@ -8223,14 +8258,14 @@ func callbackQTiltFilter_Filter(ptr unsafe.Pointer, reading unsafe.Pointer) C.ch
 func (ptr *QTiltFilter) ConnectFilter(f func(reading *QTiltReading) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "filter", f)
+		qt.ConnectSignal(ptr.Pointer(), "filter", f)
 	}
 }
 
 func (ptr *QTiltFilter) DisconnectFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "filter")
+		qt.DisconnectSignal(ptr.Pointer(), "filter")
 	}
 }
 
@@ -8283,7 +8318,7 @@ func NewQTiltReadingFromPointer(ptr unsafe.Pointer) *QTiltReading {
 func (ptr *QTiltReading) DestroyQTiltReading() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8354,7 +8389,7 @@ func NewQTiltSensorFromPointer(ptr unsafe.Pointer) *QTiltSensor {
 }
 func NewQTiltSensor(parent core.QObject_ITF) *QTiltSensor {
 	var tmpValue = NewQTiltSensorFromPointer(C.QTiltSensor_NewQTiltSensor(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -8369,7 +8404,7 @@ func (ptr *QTiltSensor) Calibrate() {
 func (ptr *QTiltSensor) DestroyQTiltSensor() {
 	if ptr.Pointer() != nil {
 		C.QTiltSensor_DestroyQTiltSensor(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8377,7 +8412,7 @@ func (ptr *QTiltSensor) DestroyQTiltSensor() {
 func (ptr *QTiltSensor) Reading() *QTiltReading {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQTiltReadingFromPointer(C.QTiltSensor_Reading(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
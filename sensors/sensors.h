@@ -169,8 +169,8 @@ void* QRotationSensor_Reading(void* ptr);
 char QRotationSensor_HasZ(void* ptr);
 struct QtSensors_PackedString QRotationSensor_QRotationSensor_Type();
 void* QSensor_QSensor_DefaultSensorForType(void* ty);
-struct QtSensors_PackedList QSensor_QSensor_SensorTypes();
-struct QtSensors_PackedList QSensor_QSensor_SensorsForType(void* ty);
+struct QtSensors_PackedString QSensor_QSensor_SensorTypes();
+struct QtSensors_PackedString QSensor_QSensor_SensorsForType(void* ty);
 void* QSensor_NewQSensor(void* ty, void* parent);
 char QSensor_ConnectToBackend(void* ptr);
 char QSensor_Start(void* ptr);
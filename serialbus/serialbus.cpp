@@ -37,6 +37,41 @@
 #include <QTimerEvent>
 #include <QVariant>
 #include <QVector>
+#include <QScopedPointer>
+#include <QStringList>
+#include <cstdlib>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
 
 class MyQCanBus: public QCanBus
 {
@@ -66,7 +101,7 @@ void* QCanBus_CreateDevice(void* ptr, char* plugin, char* interfaceName, char* e
 
 struct QtSerialBus_PackedString QCanBus_Plugins(void* ptr)
 {
-	return ({ QByteArray t48ad25 = static_cast<QCanBus*>(ptr)->plugins().join("|").toUtf8(); QtSerialBus_PackedString { const_cast<char*>(t48ad25.prepend("WHITESPACE").constData()+10), t48ad25.size()-10 }; });
+	return ({ long long t48ad25len; char* t48ad25 = goPackStringList(static_cast<QCanBus*>(ptr)->plugins(), &t48ad25len); QtSerialBus_PackedString { t48ad25, t48ad25len }; });
 }
 
 void* QCanBus___dynamicPropertyNames_atList(void* ptr, int i)
@@ -427,6 +462,16 @@ void* QCanBusDevice___configurationKeys_newList(void* ptr)
 	return new QVector<int>;
 }
 
+void* QCanBusDevice___configurationKeys_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QCanBusDevice___configurationKeys_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
 void* QCanBusDevice___dynamicPropertyNames_atList(void* ptr, int i)
 {
 	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
@@ -1388,6 +1433,16 @@ void* QModbusDeviceIdentification___objectIds_newList(void* ptr)
 	return new QList<int>;
 }
 
+void* QModbusDeviceIdentification___objectIds_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QModbusDeviceIdentification___objectIds_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
 class MyQModbusExceptionResponse: public QModbusExceptionResponse
 {
 public:
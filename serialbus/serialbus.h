@@ -82,6 +82,8 @@ void* QCanBusDevice___enqueueReceivedFrames_newFrames_newList(void* ptr);
 int QCanBusDevice___configurationKeys_atList(void* ptr, int i);
 void QCanBusDevice___configurationKeys_setList(void* ptr, int i);
 void* QCanBusDevice___configurationKeys_newList(void* ptr);
+void* QCanBusDevice___configurationKeys_newListBuffer(void* ptr, void* data, int count);
+void QCanBusDevice___configurationKeys_fillList(void* ptr, void* data);
 void* QCanBusDevice___dynamicPropertyNames_atList(void* ptr, int i);
 void QCanBusDevice___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QCanBusDevice___dynamicPropertyNames_newList(void* ptr);
@@ -234,6 +236,8 @@ char QModbusDeviceIdentification_IsValid(void* ptr);
 int QModbusDeviceIdentification___objectIds_atList(void* ptr, int i);
 void QModbusDeviceIdentification___objectIds_setList(void* ptr, int i);
 void* QModbusDeviceIdentification___objectIds_newList(void* ptr);
+void* QModbusDeviceIdentification___objectIds_newListBuffer(void* ptr, void* data, int count);
+void QModbusDeviceIdentification___objectIds_fillList(void* ptr, void* data);
 void* QModbusExceptionResponse_NewQModbusExceptionResponse();
 void* QModbusExceptionResponse_NewQModbusExceptionResponse3(long long code, long long ec);
 void* QModbusExceptionResponse_NewQModbusExceptionResponse2(void* pdu);
@@ -8,7 +8,6 @@ package serialport
 //#include "serialport.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
@@ -22,6 +21,43 @@ func cGoUnpackString(s C.struct_QtSerialPort_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtSerialPort_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtSerialPort_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QSerialPort struct {
 	core.QIODevice
@@ -183,7 +219,7 @@ func (ptr *QSerialPort) PinoutSignals() QSerialPort__PinoutSignal {
 
 func NewQSerialPort(parent core.QObject_ITF) *QSerialPort {
 	var tmpValue = NewQSerialPortFromPointer(C.QSerialPort_NewQSerialPort(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -191,7 +227,7 @@ func NewQSerialPort(parent core.QObject_ITF) *QSerialPort {
 
 func NewQSerialPort3(serialPortInfo QSerialPortInfo_ITF, parent core.QObject_ITF) *QSerialPort {
 	var tmpValue = NewQSerialPortFromPointer(C.QSerialPort_NewQSerialPort3(PointerFromQSerialPortInfo(serialPortInfo), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -201,7 +237,7 @@ func NewQSerialPort2(name string, parent core.QObject_ITF) *QSerialPort {
 	var nameC = C.CString(name)
 	defer C.free(unsafe.Pointer(nameC))
 	var tmpValue = NewQSerialPortFromPointer(C.QSerialPort_NewQSerialPort2(nameC, core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -237,7 +273,7 @@ func (ptr *QSerialPort) IsRequestToSend() bool {
 
 //export callbackQSerialPort_Open
 func callbackQSerialPort_Open(ptr unsafe.Pointer, mode C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "open"); signal != nil {
+	if signal := qt.GetSignal(ptr, "open"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(core.QIODevice__OpenModeFlag) bool)(core.QIODevice__OpenModeFlag(mode)))))
 	}
 
@@ -309,7 +345,7 @@ func (ptr *QSerialPort) SetStopBits(stopBits QSerialPort__StopBits) bool {
 
 //export callbackQSerialPort_WaitForBytesWritten
 func callbackQSerialPort_WaitForBytesWritten(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForBytesWritten"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -325,7 +361,7 @@ func (ptr *QSerialPort) WaitForBytesWrittenDefault(msecs int) bool {
 
 //export callbackQSerialPort_WaitForReadyRead
 func callbackQSerialPort_WaitForReadyRead(ptr unsafe.Pointer, msecs C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "waitForReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "waitForReadyRead"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(msecs))))))
 	}
 
@@ -341,18 +377,21 @@ func (ptr *QSerialPort) WaitForReadyReadDefault(msecs int) bool {
 
 //export callbackQSerialPort_ReadData
 func callbackQSerialPort_ReadData(ptr unsafe.Pointer, data C.struct_QtSerialPort_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "readData"); signal != nil {
 		var retS = cGoUnpackString(data)
 		var ret = C.longlong(signal.(func(*string, int64) int64)(&retS, int64(maxSize)))
 		if ret > 0 {
-			C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+			copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 		}
 		return ret
 	}
 	var retS = cGoUnpackString(data)
 	var ret = C.longlong(NewQSerialPortFromPointer(ptr).ReadDataDefault(&retS, int64(maxSize)))
 	if ret > 0 {
-		C.memcpy(unsafe.Pointer(data.data), unsafe.Pointer(C.CString(retS)), C.size_t(ret))
+		copy(qt.UnsafeBytes(unsafe.Pointer(data.data), int(ret)), retS)
 	}
 	return ret
 }
@@ -360,14 +399,14 @@ func callbackQSerialPort_ReadData(ptr unsafe.Pointer, data C.struct_QtSerialPort
 func (ptr *QSerialPort) ConnectReadData(f func(data *string, maxSize int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "readData", f)
+		qt.ConnectSignal(ptr.Pointer(), "readData", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectReadData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "readData")
+		qt.DisconnectSignal(ptr.Pointer(), "readData")
 	}
 }
 
@@ -399,7 +438,7 @@ func (ptr *QSerialPort) ReadDataDefault(data *string, maxSize int64) int64 {
 
 //export callbackQSerialPort_ReadLineData
 func callbackQSerialPort_ReadLineData(ptr unsafe.Pointer, data C.struct_QtSerialPort_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readLineData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readLineData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(maxSize)))
 	}
 
@@ -417,7 +456,10 @@ func (ptr *QSerialPort) ReadLineDataDefault(data string, maxSize int64) int64 {
 
 //export callbackQSerialPort_WriteData
 func callbackQSerialPort_WriteData(ptr unsafe.Pointer, data C.struct_QtSerialPort_PackedString, maxSize C.longlong) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "writeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "writeDataBuffer"); signal != nil {
+		return C.longlong(signal.(func([]byte) int64)(qt.UnsafeBytes(unsafe.Pointer(data.data), int(data.len))))
+	}
+	if signal := qt.GetSignal(ptr, "writeData"); signal != nil {
 		return C.longlong(signal.(func(string, int64) int64)(cGoUnpackString(data), int64(maxSize)))
 	}
 
@@ -427,14 +469,14 @@ func callbackQSerialPort_WriteData(ptr unsafe.Pointer, data C.struct_QtSerialPor
 func (ptr *QSerialPort) ConnectWriteData(f func(data string, maxSize int64) int64) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "writeData", f)
+		qt.ConnectSignal(ptr.Pointer(), "writeData", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectWriteData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "writeData")
+		qt.DisconnectSignal(ptr.Pointer(), "writeData")
 	}
 }
 
@@ -458,7 +500,7 @@ func (ptr *QSerialPort) WriteDataDefault(data string, maxSize int64) int64 {
 
 //export callbackQSerialPort_BaudRateChanged
 func callbackQSerialPort_BaudRateChanged(ptr unsafe.Pointer, baudRate C.int, directions C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "baudRateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "baudRateChanged"); signal != nil {
 		signal.(func(int, QSerialPort__Direction))(int(int32(baudRate)), QSerialPort__Direction(directions))
 	}
 
@@ -467,14 +509,14 @@ func callbackQSerialPort_BaudRateChanged(ptr unsafe.Pointer, baudRate C.int, dir
 func (ptr *QSerialPort) ConnectBaudRateChanged(f func(baudRate int, directions QSerialPort__Direction)) {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_ConnectBaudRateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "baudRateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "baudRateChanged", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectBaudRateChanged() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DisconnectBaudRateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "baudRateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "baudRateChanged")
 	}
 }
 
@@ -486,7 +528,7 @@ func (ptr *QSerialPort) BaudRateChanged(baudRate int, directions QSerialPort__Di
 
 //export callbackQSerialPort_BreakEnabledChanged
 func callbackQSerialPort_BreakEnabledChanged(ptr unsafe.Pointer, set C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "breakEnabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "breakEnabledChanged"); signal != nil {
 		signal.(func(bool))(int8(set) != 0)
 	}
 
@@ -495,14 +537,14 @@ func callbackQSerialPort_BreakEnabledChanged(ptr unsafe.Pointer, set C.char) {
 func (ptr *QSerialPort) ConnectBreakEnabledChanged(f func(set bool)) {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_ConnectBreakEnabledChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "breakEnabledChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "breakEnabledChanged", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectBreakEnabledChanged() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DisconnectBreakEnabledChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "breakEnabledChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "breakEnabledChanged")
 	}
 }
 
@@ -520,7 +562,7 @@ func (ptr *QSerialPort) ClearError() {
 
 //export callbackQSerialPort_Close
 func callbackQSerialPort_Close(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSerialPortFromPointer(ptr).CloseDefault()
@@ -535,7 +577,7 @@ func (ptr *QSerialPort) CloseDefault() {
 
 //export callbackQSerialPort_DataBitsChanged
 func callbackQSerialPort_DataBitsChanged(ptr unsafe.Pointer, dataBits C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataBitsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataBitsChanged"); signal != nil {
 		signal.(func(QSerialPort__DataBits))(QSerialPort__DataBits(dataBits))
 	}
 
@@ -544,14 +586,14 @@ func callbackQSerialPort_DataBitsChanged(ptr unsafe.Pointer, dataBits C.longlong
 func (ptr *QSerialPort) ConnectDataBitsChanged(f func(dataBits QSerialPort__DataBits)) {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_ConnectDataBitsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dataBitsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "dataBitsChanged", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectDataBitsChanged() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DisconnectDataBitsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dataBitsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "dataBitsChanged")
 	}
 }
 
@@ -563,7 +605,7 @@ func (ptr *QSerialPort) DataBitsChanged(dataBits QSerialPort__DataBits) {
 
 //export callbackQSerialPort_DataTerminalReadyChanged
 func callbackQSerialPort_DataTerminalReadyChanged(ptr unsafe.Pointer, set C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataTerminalReadyChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataTerminalReadyChanged"); signal != nil {
 		signal.(func(bool))(int8(set) != 0)
 	}
 
@@ -572,14 +614,14 @@ func callbackQSerialPort_DataTerminalReadyChanged(ptr unsafe.Pointer, set C.char
 func (ptr *QSerialPort) ConnectDataTerminalReadyChanged(f func(set bool)) {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_ConnectDataTerminalReadyChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "dataTerminalReadyChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "dataTerminalReadyChanged", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectDataTerminalReadyChanged() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DisconnectDataTerminalReadyChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "dataTerminalReadyChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "dataTerminalReadyChanged")
 	}
 }
 
@@ -591,7 +633,7 @@ func (ptr *QSerialPort) DataTerminalReadyChanged(set bool) {
 
 //export callbackQSerialPort_ErrorOccurred
 func callbackQSerialPort_ErrorOccurred(ptr unsafe.Pointer, error C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorOccurred"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorOccurred"); signal != nil {
 		signal.(func(QSerialPort__SerialPortError))(QSerialPort__SerialPortError(error))
 	}
 
@@ -600,14 +642,14 @@ func callbackQSerialPort_ErrorOccurred(ptr unsafe.Pointer, error C.longlong) {
 func (ptr *QSerialPort) ConnectErrorOccurred(f func(error QSerialPort__SerialPortError)) {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_ConnectErrorOccurred(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorOccurred", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorOccurred", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectErrorOccurred() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DisconnectErrorOccurred(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorOccurred")
+		qt.DisconnectSignal(ptr.Pointer(), "errorOccurred")
 	}
 }
 
@@ -619,7 +661,7 @@ func (ptr *QSerialPort) ErrorOccurred(error QSerialPort__SerialPortError) {
 
 //export callbackQSerialPort_FlowControlChanged
 func callbackQSerialPort_FlowControlChanged(ptr unsafe.Pointer, flow C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flowControlChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flowControlChanged"); signal != nil {
 		signal.(func(QSerialPort__FlowControl))(QSerialPort__FlowControl(flow))
 	}
 
@@ -628,14 +670,14 @@ func callbackQSerialPort_FlowControlChanged(ptr unsafe.Pointer, flow C.longlong)
 func (ptr *QSerialPort) ConnectFlowControlChanged(f func(flow QSerialPort__FlowControl)) {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_ConnectFlowControlChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "flowControlChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "flowControlChanged", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectFlowControlChanged() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DisconnectFlowControlChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "flowControlChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "flowControlChanged")
 	}
 }
 
@@ -647,7 +689,7 @@ func (ptr *QSerialPort) FlowControlChanged(flow QSerialPort__FlowControl) {
 
 //export callbackQSerialPort_ParityChanged
 func callbackQSerialPort_ParityChanged(ptr unsafe.Pointer, parity C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parityChanged"); signal != nil {
 		signal.(func(QSerialPort__Parity))(QSerialPort__Parity(parity))
 	}
 
@@ -656,14 +698,14 @@ func callbackQSerialPort_ParityChanged(ptr unsafe.Pointer, parity C.longlong) {
 func (ptr *QSerialPort) ConnectParityChanged(f func(parity QSerialPort__Parity)) {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_ConnectParityChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parityChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "parityChanged", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectParityChanged() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DisconnectParityChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parityChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "parityChanged")
 	}
 }
 
@@ -675,7 +717,7 @@ func (ptr *QSerialPort) ParityChanged(parity QSerialPort__Parity) {
 
 //export callbackQSerialPort_RequestToSendChanged
 func callbackQSerialPort_RequestToSendChanged(ptr unsafe.Pointer, set C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "requestToSendChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "requestToSendChanged"); signal != nil {
 		signal.(func(bool))(int8(set) != 0)
 	}
 
@@ -684,14 +726,14 @@ func callbackQSerialPort_RequestToSendChanged(ptr unsafe.Pointer, set C.char) {
 func (ptr *QSerialPort) ConnectRequestToSendChanged(f func(set bool)) {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_ConnectRequestToSendChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "requestToSendChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "requestToSendChanged", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectRequestToSendChanged() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DisconnectRequestToSendChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "requestToSendChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "requestToSendChanged")
 	}
 }
 
@@ -723,7 +765,7 @@ func (ptr *QSerialPort) SetReadBufferSize(size int64) {
 
 //export callbackQSerialPort_StopBitsChanged
 func callbackQSerialPort_StopBitsChanged(ptr unsafe.Pointer, stopBits C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stopBitsChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stopBitsChanged"); signal != nil {
 		signal.(func(QSerialPort__StopBits))(QSerialPort__StopBits(stopBits))
 	}
 
@@ -732,14 +774,14 @@ func callbackQSerialPort_StopBitsChanged(ptr unsafe.Pointer, stopBits C.longlong
 func (ptr *QSerialPort) ConnectStopBitsChanged(f func(stopBits QSerialPort__StopBits)) {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_ConnectStopBitsChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stopBitsChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "stopBitsChanged", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectStopBitsChanged() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DisconnectStopBitsChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stopBitsChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "stopBitsChanged")
 	}
 }
 
@@ -751,7 +793,7 @@ func (ptr *QSerialPort) StopBitsChanged(stopBits QSerialPort__StopBits) {
 
 //export callbackQSerialPort_DestroyQSerialPort
 func callbackQSerialPort_DestroyQSerialPort(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSerialPort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSerialPort"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSerialPortFromPointer(ptr).DestroyQSerialPortDefault()
@@ -761,21 +803,21 @@ func callbackQSerialPort_DestroyQSerialPort(ptr unsafe.Pointer) {
 func (ptr *QSerialPort) ConnectDestroyQSerialPort(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSerialPort", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSerialPort", f)
 	}
 }
 
 func (ptr *QSerialPort) DisconnectDestroyQSerialPort() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSerialPort")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSerialPort")
 	}
 }
 
 func (ptr *QSerialPort) DestroyQSerialPort() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DestroyQSerialPort(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -783,7 +825,7 @@ func (ptr *QSerialPort) DestroyQSerialPort() {
 func (ptr *QSerialPort) DestroyQSerialPortDefault() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DestroyQSerialPortDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -846,7 +888,7 @@ func (ptr *QSerialPort) BaudRate(directions QSerialPort__Direction) int {
 
 //export callbackQSerialPort_AtEnd
 func callbackQSerialPort_AtEnd(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "atEnd"); signal != nil {
+	if signal := qt.GetSignal(ptr, "atEnd"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -862,7 +904,7 @@ func (ptr *QSerialPort) AtEndDefault() bool {
 
 //export callbackQSerialPort_CanReadLine
 func callbackQSerialPort_CanReadLine(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canReadLine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canReadLine"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -878,7 +920,7 @@ func (ptr *QSerialPort) CanReadLineDefault() bool {
 
 //export callbackQSerialPort_IsSequential
 func callbackQSerialPort_IsSequential(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isSequential"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isSequential"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -894,7 +936,7 @@ func (ptr *QSerialPort) IsSequentialDefault() bool {
 
 //export callbackQSerialPort_BytesAvailable
 func callbackQSerialPort_BytesAvailable(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesAvailable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesAvailable"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -910,7 +952,7 @@ func (ptr *QSerialPort) BytesAvailableDefault() int64 {
 
 //export callbackQSerialPort_BytesToWrite
 func callbackQSerialPort_BytesToWrite(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesToWrite"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesToWrite"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -953,7 +995,7 @@ func (ptr *QSerialPort) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSerialPort) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSerialPort___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -974,7 +1016,7 @@ func (ptr *QSerialPort) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSerialPort) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSerialPort___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -995,7 +1037,7 @@ func (ptr *QSerialPort) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSerialPort) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSerialPort___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1016,7 +1058,7 @@ func (ptr *QSerialPort) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSerialPort) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSerialPort___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1036,7 +1078,7 @@ func (ptr *QSerialPort) __children_newList() unsafe.Pointer {
 
 //export callbackQSerialPort_Reset
 func callbackQSerialPort_Reset(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1052,7 +1094,7 @@ func (ptr *QSerialPort) ResetDefault() bool {
 
 //export callbackQSerialPort_Seek
 func callbackQSerialPort_Seek(ptr unsafe.Pointer, pos C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "seek"); signal != nil {
+	if signal := qt.GetSignal(ptr, "seek"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int64) bool)(int64(pos)))))
 	}
 
@@ -1068,7 +1110,7 @@ func (ptr *QSerialPort) SeekDefault(pos int64) bool {
 
 //export callbackQSerialPort_AboutToClose
 func callbackQSerialPort_AboutToClose(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "aboutToClose"); signal != nil {
+	if signal := qt.GetSignal(ptr, "aboutToClose"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1076,7 +1118,7 @@ func callbackQSerialPort_AboutToClose(ptr unsafe.Pointer) {
 
 //export callbackQSerialPort_BytesWritten
 func callbackQSerialPort_BytesWritten(ptr unsafe.Pointer, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bytesWritten"); signal != nil {
 		signal.(func(int64))(int64(bytes))
 	}
 
@@ -1084,7 +1126,7 @@ func callbackQSerialPort_BytesWritten(ptr unsafe.Pointer, bytes C.longlong) {
 
 //export callbackQSerialPort_ChannelBytesWritten
 func callbackQSerialPort_ChannelBytesWritten(ptr unsafe.Pointer, channel C.int, bytes C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelBytesWritten"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelBytesWritten"); signal != nil {
 		signal.(func(int, int64))(int(int32(channel)), int64(bytes))
 	}
 
@@ -1092,7 +1134,7 @@ func callbackQSerialPort_ChannelBytesWritten(ptr unsafe.Pointer, channel C.int,
 
 //export callbackQSerialPort_ChannelReadyRead
 func callbackQSerialPort_ChannelReadyRead(ptr unsafe.Pointer, channel C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "channelReadyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "channelReadyRead"); signal != nil {
 		signal.(func(int))(int(int32(channel)))
 	}
 
@@ -1100,7 +1142,7 @@ func callbackQSerialPort_ChannelReadyRead(ptr unsafe.Pointer, channel C.int) {
 
 //export callbackQSerialPort_ReadChannelFinished
 func callbackQSerialPort_ReadChannelFinished(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readChannelFinished"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readChannelFinished"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1108,7 +1150,7 @@ func callbackQSerialPort_ReadChannelFinished(ptr unsafe.Pointer) {
 
 //export callbackQSerialPort_ReadyRead
 func callbackQSerialPort_ReadyRead(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "readyRead"); signal != nil {
+	if signal := qt.GetSignal(ptr, "readyRead"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1116,7 +1158,7 @@ func callbackQSerialPort_ReadyRead(ptr unsafe.Pointer) {
 
 //export callbackQSerialPort_Pos
 func callbackQSerialPort_Pos(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pos"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pos"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -1132,7 +1174,7 @@ func (ptr *QSerialPort) PosDefault() int64 {
 
 //export callbackQSerialPort_Size
 func callbackQSerialPort_Size(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return C.longlong(signal.(func() int64)())
 	}
 
@@ -1148,7 +1190,7 @@ func (ptr *QSerialPort) SizeDefault() int64 {
 
 //export callbackQSerialPort_Event
 func callbackQSerialPort_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -1164,7 +1206,7 @@ func (ptr *QSerialPort) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSerialPort_EventFilter
 func callbackQSerialPort_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -1180,7 +1222,7 @@ func (ptr *QSerialPort) EventFilterDefault(watched core.QObject_ITF, event core.
 
 //export callbackQSerialPort_ChildEvent
 func callbackQSerialPort_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSerialPortFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -1195,7 +1237,7 @@ func (ptr *QSerialPort) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSerialPort_ConnectNotify
 func callbackQSerialPort_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSerialPortFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1210,7 +1252,7 @@ func (ptr *QSerialPort) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSerialPort_CustomEvent
 func callbackQSerialPort_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSerialPortFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -1225,7 +1267,7 @@ func (ptr *QSerialPort) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSerialPort_DeleteLater
 func callbackQSerialPort_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSerialPortFromPointer(ptr).DeleteLaterDefault()
@@ -1235,14 +1277,14 @@ func callbackQSerialPort_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSerialPort) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSerialPort_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSerialPort_Destroyed
 func callbackQSerialPort_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -1250,7 +1292,7 @@ func callbackQSerialPort_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSerialPort_DisconnectNotify
 func callbackQSerialPort_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSerialPortFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1265,7 +1307,7 @@ func (ptr *QSerialPort) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSerialPort_ObjectNameChanged
 func callbackQSerialPort_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSerialPort_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -1273,7 +1315,7 @@ func callbackQSerialPort_ObjectNameChanged(ptr unsafe.Pointer, objectName C.stru
 
 //export callbackQSerialPort_TimerEvent
 func callbackQSerialPort_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSerialPortFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -1288,7 +1330,7 @@ func (ptr *QSerialPort) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSerialPort_MetaObject
 func callbackQSerialPort_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -8,11 +8,9 @@ package speech
 //#include "speech.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -22,6 +20,43 @@ func cGoUnpackString(s C.struct_QtSpeech_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtSpeech_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtSpeech_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QTextToSpeech struct {
 	ptr unsafe.Pointer
@@ -64,7 +99,7 @@ func NewQTextToSpeechFromPointer(ptr unsafe.Pointer) *QTextToSpeech {
 func (ptr *QTextToSpeech) DestroyQTextToSpeech() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -81,11 +116,11 @@ const (
 )
 
 func QTextToSpeech_AvailableEngines() []string {
-	return strings.Split(cGoUnpackString(C.QTextToSpeech_QTextToSpeech_AvailableEngines()), "|")
+	return cGoUnpackStringListAndFree(C.QTextToSpeech_QTextToSpeech_AvailableEngines())
 }
 
 func (ptr *QTextToSpeech) AvailableEngines() []string {
-	return strings.Split(cGoUnpackString(C.QTextToSpeech_QTextToSpeech_AvailableEngines()), "|")
+	return cGoUnpackStringListAndFree(C.QTextToSpeech_QTextToSpeech_AvailableEngines())
 }
 
 func NewQTextToSpeech(parent core.QObject_ITF) *QTextToSpeech {
@@ -100,7 +135,7 @@ func NewQTextToSpeech2(engine string, parent core.QObject_ITF) *QTextToSpeech {
 
 //export callbackQTextToSpeech_LocaleChanged
 func callbackQTextToSpeech_LocaleChanged(ptr unsafe.Pointer, locale unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "localeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "localeChanged"); signal != nil {
 		signal.(func(*core.QLocale))(core.NewQLocaleFromPointer(locale))
 	}
 
@@ -109,14 +144,14 @@ func callbackQTextToSpeech_LocaleChanged(ptr unsafe.Pointer, locale unsafe.Point
 func (ptr *QTextToSpeech) ConnectLocaleChanged(f func(locale *core.QLocale)) {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_ConnectLocaleChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "localeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "localeChanged", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectLocaleChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_DisconnectLocaleChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "localeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "localeChanged")
 	}
 }
 
@@ -128,7 +163,7 @@ func (ptr *QTextToSpeech) LocaleChanged(locale core.QLocale_ITF) {
 
 //export callbackQTextToSpeech_Pause
 func callbackQTextToSpeech_Pause(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pause"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pause"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextToSpeechFromPointer(ptr).PauseDefault()
@@ -138,14 +173,14 @@ func callbackQTextToSpeech_Pause(ptr unsafe.Pointer) {
 func (ptr *QTextToSpeech) ConnectPause(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pause", f)
+		qt.ConnectSignal(ptr.Pointer(), "pause", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectPause() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pause")
+		qt.DisconnectSignal(ptr.Pointer(), "pause")
 	}
 }
 
@@ -163,7 +198,7 @@ func (ptr *QTextToSpeech) PauseDefault() {
 
 //export callbackQTextToSpeech_PitchChanged
 func callbackQTextToSpeech_PitchChanged(ptr unsafe.Pointer, pitch C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "pitchChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "pitchChanged"); signal != nil {
 		signal.(func(float64))(float64(pitch))
 	}
 
@@ -172,14 +207,14 @@ func callbackQTextToSpeech_PitchChanged(ptr unsafe.Pointer, pitch C.double) {
 func (ptr *QTextToSpeech) ConnectPitchChanged(f func(pitch float64)) {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_ConnectPitchChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "pitchChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "pitchChanged", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectPitchChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_DisconnectPitchChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "pitchChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "pitchChanged")
 	}
 }
 
@@ -191,7 +226,7 @@ func (ptr *QTextToSpeech) PitchChanged(pitch float64) {
 
 //export callbackQTextToSpeech_RateChanged
 func callbackQTextToSpeech_RateChanged(ptr unsafe.Pointer, rate C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rateChanged"); signal != nil {
 		signal.(func(float64))(float64(rate))
 	}
 
@@ -200,14 +235,14 @@ func callbackQTextToSpeech_RateChanged(ptr unsafe.Pointer, rate C.double) {
 func (ptr *QTextToSpeech) ConnectRateChanged(f func(rate float64)) {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_ConnectRateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "rateChanged", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectRateChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_DisconnectRateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "rateChanged")
 	}
 }
 
@@ -219,7 +254,7 @@ func (ptr *QTextToSpeech) RateChanged(rate float64) {
 
 //export callbackQTextToSpeech_Resume
 func callbackQTextToSpeech_Resume(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resume"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resume"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextToSpeechFromPointer(ptr).ResumeDefault()
@@ -229,14 +264,14 @@ func callbackQTextToSpeech_Resume(ptr unsafe.Pointer) {
 func (ptr *QTextToSpeech) ConnectResume(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "resume", f)
+		qt.ConnectSignal(ptr.Pointer(), "resume", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectResume() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "resume")
+		qt.DisconnectSignal(ptr.Pointer(), "resume")
 	}
 }
 
@@ -254,7 +289,7 @@ func (ptr *QTextToSpeech) ResumeDefault() {
 
 //export callbackQTextToSpeech_Say
 func callbackQTextToSpeech_Say(ptr unsafe.Pointer, text C.struct_QtSpeech_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "say"); signal != nil {
+	if signal := qt.GetSignal(ptr, "say"); signal != nil {
 		signal.(func(string))(cGoUnpackString(text))
 	} else {
 		NewQTextToSpeechFromPointer(ptr).SayDefault(cGoUnpackString(text))
@@ -264,14 +299,14 @@ func callbackQTextToSpeech_Say(ptr unsafe.Pointer, text C.struct_QtSpeech_Packed
 func (ptr *QTextToSpeech) ConnectSay(f func(text string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "say", f)
+		qt.ConnectSignal(ptr.Pointer(), "say", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectSay() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "say")
+		qt.DisconnectSignal(ptr.Pointer(), "say")
 	}
 }
 
@@ -293,7 +328,7 @@ func (ptr *QTextToSpeech) SayDefault(text string) {
 
 //export callbackQTextToSpeech_SetLocale
 func callbackQTextToSpeech_SetLocale(ptr unsafe.Pointer, locale unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setLocale"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setLocale"); signal != nil {
 		signal.(func(*core.QLocale))(core.NewQLocaleFromPointer(locale))
 	} else {
 		NewQTextToSpeechFromPointer(ptr).SetLocaleDefault(core.NewQLocaleFromPointer(locale))
@@ -303,14 +338,14 @@ func callbackQTextToSpeech_SetLocale(ptr unsafe.Pointer, locale unsafe.Pointer)
 func (ptr *QTextToSpeech) ConnectSetLocale(f func(locale *core.QLocale)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setLocale", f)
+		qt.ConnectSignal(ptr.Pointer(), "setLocale", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectSetLocale() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setLocale")
+		qt.DisconnectSignal(ptr.Pointer(), "setLocale")
 	}
 }
 
@@ -328,7 +363,7 @@ func (ptr *QTextToSpeech) SetLocaleDefault(locale core.QLocale_ITF) {
 
 //export callbackQTextToSpeech_SetPitch
 func callbackQTextToSpeech_SetPitch(ptr unsafe.Pointer, pitch C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setPitch"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setPitch"); signal != nil {
 		signal.(func(float64))(float64(pitch))
 	} else {
 		NewQTextToSpeechFromPointer(ptr).SetPitchDefault(float64(pitch))
@@ -338,14 +373,14 @@ func callbackQTextToSpeech_SetPitch(ptr unsafe.Pointer, pitch C.double) {
 func (ptr *QTextToSpeech) ConnectSetPitch(f func(pitch float64)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setPitch", f)
+		qt.ConnectSignal(ptr.Pointer(), "setPitch", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectSetPitch() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setPitch")
+		qt.DisconnectSignal(ptr.Pointer(), "setPitch")
 	}
 }
 
@@ -363,7 +398,7 @@ func (ptr *QTextToSpeech) SetPitchDefault(pitch float64) {
 
 //export callbackQTextToSpeech_SetRate
 func callbackQTextToSpeech_SetRate(ptr unsafe.Pointer, rate C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRate"); signal != nil {
 		signal.(func(float64))(float64(rate))
 	} else {
 		NewQTextToSpeechFromPointer(ptr).SetRateDefault(float64(rate))
@@ -373,14 +408,14 @@ func callbackQTextToSpeech_SetRate(ptr unsafe.Pointer, rate C.double) {
 func (ptr *QTextToSpeech) ConnectSetRate(f func(rate float64)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setRate", f)
+		qt.ConnectSignal(ptr.Pointer(), "setRate", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectSetRate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setRate")
+		qt.DisconnectSignal(ptr.Pointer(), "setRate")
 	}
 }
 
@@ -398,7 +433,7 @@ func (ptr *QTextToSpeech) SetRateDefault(rate float64) {
 
 //export callbackQTextToSpeech_SetVolume
 func callbackQTextToSpeech_SetVolume(ptr unsafe.Pointer, volume C.double) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVolume"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVolume"); signal != nil {
 		signal.(func(float64))(float64(volume))
 	} else {
 		NewQTextToSpeechFromPointer(ptr).SetVolumeDefault(float64(volume))
@@ -408,14 +443,14 @@ func callbackQTextToSpeech_SetVolume(ptr unsafe.Pointer, volume C.double) {
 func (ptr *QTextToSpeech) ConnectSetVolume(f func(volume float64)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setVolume", f)
+		qt.ConnectSignal(ptr.Pointer(), "setVolume", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectSetVolume() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setVolume")
+		qt.DisconnectSignal(ptr.Pointer(), "setVolume")
 	}
 }
 
@@ -433,7 +468,7 @@ func (ptr *QTextToSpeech) SetVolumeDefault(volume float64) {
 
 //export callbackQTextToSpeech_StateChanged
 func callbackQTextToSpeech_StateChanged(ptr unsafe.Pointer, state C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stateChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stateChanged"); signal != nil {
 		signal.(func(QTextToSpeech__State))(QTextToSpeech__State(state))
 	}
 
@@ -442,14 +477,14 @@ func callbackQTextToSpeech_StateChanged(ptr unsafe.Pointer, state C.longlong) {
 func (ptr *QTextToSpeech) ConnectStateChanged(f func(state QTextToSpeech__State)) {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_ConnectStateChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "stateChanged", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectStateChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_DisconnectStateChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stateChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "stateChanged")
 	}
 }
 
@@ -461,7 +496,7 @@ func (ptr *QTextToSpeech) StateChanged(state QTextToSpeech__State) {
 
 //export callbackQTextToSpeech_Stop
 func callbackQTextToSpeech_Stop(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stop"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stop"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextToSpeechFromPointer(ptr).StopDefault()
@@ -471,14 +506,14 @@ func callbackQTextToSpeech_Stop(ptr unsafe.Pointer) {
 func (ptr *QTextToSpeech) ConnectStop(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stop", f)
+		qt.ConnectSignal(ptr.Pointer(), "stop", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectStop() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stop")
+		qt.DisconnectSignal(ptr.Pointer(), "stop")
 	}
 }
 
@@ -496,7 +531,7 @@ func (ptr *QTextToSpeech) StopDefault() {
 
 //export callbackQTextToSpeech_VolumeChanged
 func callbackQTextToSpeech_VolumeChanged(ptr unsafe.Pointer, volume C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "volumeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "volumeChanged"); signal != nil {
 		signal.(func(int))(int(int32(volume)))
 	}
 
@@ -505,14 +540,14 @@ func callbackQTextToSpeech_VolumeChanged(ptr unsafe.Pointer, volume C.int) {
 func (ptr *QTextToSpeech) ConnectVolumeChanged(f func(volume int)) {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_ConnectVolumeChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "volumeChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "volumeChanged", f)
 	}
 }
 
 func (ptr *QTextToSpeech) DisconnectVolumeChanged() {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeech_DisconnectVolumeChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "volumeChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "volumeChanged")
 	}
 }
 
@@ -635,7 +670,7 @@ func NewQTextToSpeechPluginFromPointer(ptr unsafe.Pointer) *QTextToSpeechPlugin
 
 //export callbackQTextToSpeechPlugin_DestroyQTextToSpeechPlugin
 func callbackQTextToSpeechPlugin_DestroyQTextToSpeechPlugin(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QTextToSpeechPlugin"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QTextToSpeechPlugin"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQTextToSpeechPluginFromPointer(ptr).DestroyQTextToSpeechPluginDefault()
@@ -645,21 +680,21 @@ func callbackQTextToSpeechPlugin_DestroyQTextToSpeechPlugin(ptr unsafe.Pointer)
 func (ptr *QTextToSpeechPlugin) ConnectDestroyQTextToSpeechPlugin(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextToSpeechPlugin", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QTextToSpeechPlugin", f)
 	}
 }
 
 func (ptr *QTextToSpeechPlugin) DisconnectDestroyQTextToSpeechPlugin() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QTextToSpeechPlugin")
+		qt.DisconnectSignal(ptr.Pointer(), "~QTextToSpeechPlugin")
 	}
 }
 
 func (ptr *QTextToSpeechPlugin) DestroyQTextToSpeechPlugin() {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeechPlugin_DestroyQTextToSpeechPlugin(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -667,7 +702,7 @@ func (ptr *QTextToSpeechPlugin) DestroyQTextToSpeechPlugin() {
 func (ptr *QTextToSpeechPlugin) DestroyQTextToSpeechPluginDefault() {
 	if ptr.Pointer() != nil {
 		C.QTextToSpeechPlugin_DestroyQTextToSpeechPluginDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
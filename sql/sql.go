@@ -8,13 +8,11 @@ package sql
 //#include "sql.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"github.com/therecipe/qt/gui"
 	"github.com/therecipe/qt/widgets"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -24,6 +22,43 @@ func cGoUnpackString(s C.struct_QtSql_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtSql_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtSql_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QSql struct {
 	ptr unsafe.Pointer
@@ -244,19 +279,19 @@ func NewQSqlDatabase3(ty string) *QSqlDatabase {
 }
 
 func QSqlDatabase_ConnectionNames() []string {
-	return strings.Split(cGoUnpackString(C.QSqlDatabase_QSqlDatabase_ConnectionNames()), "|")
+	return cGoUnpackStringListAndFree(C.QSqlDatabase_QSqlDatabase_ConnectionNames())
 }
 
 func (ptr *QSqlDatabase) ConnectionNames() []string {
-	return strings.Split(cGoUnpackString(C.QSqlDatabase_QSqlDatabase_ConnectionNames()), "|")
+	return cGoUnpackStringListAndFree(C.QSqlDatabase_QSqlDatabase_ConnectionNames())
 }
 
 func QSqlDatabase_Drivers() []string {
-	return strings.Split(cGoUnpackString(C.QSqlDatabase_QSqlDatabase_Drivers()), "|")
+	return cGoUnpackStringListAndFree(C.QSqlDatabase_QSqlDatabase_Drivers())
 }
 
 func (ptr *QSqlDatabase) Drivers() []string {
-	return strings.Split(cGoUnpackString(C.QSqlDatabase_QSqlDatabase_Drivers()), "|")
+	return cGoUnpackStringListAndFree(C.QSqlDatabase_QSqlDatabase_Drivers())
 }
 
 func (ptr *QSqlDatabase) Commit() bool {
@@ -421,7 +456,7 @@ func (ptr *QSqlDatabase) NumericalPrecisionPolicy() QSql__NumericalPrecisionPoli
 func (ptr *QSqlDatabase) Driver() *QSqlDriver {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSqlDriverFromPointer(C.QSqlDatabase_Driver(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -522,7 +557,7 @@ func (ptr *QSqlDatabase) UserName() string {
 
 func (ptr *QSqlDatabase) Tables(ty QSql__TableType) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSqlDatabase_Tables(ptr.Pointer(), C.longlong(ty))), "|")
+		return cGoUnpackStringListAndFree(C.QSqlDatabase_Tables(ptr.Pointer(), C.longlong(ty)))
 	}
 	return make([]string, 0)
 }
@@ -673,7 +708,7 @@ const (
 
 func NewQSqlDriver(parent core.QObject_ITF) *QSqlDriver {
 	var tmpValue = NewQSqlDriverFromPointer(C.QSqlDriver_NewQSqlDriver(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -681,7 +716,7 @@ func NewQSqlDriver(parent core.QObject_ITF) *QSqlDriver {
 
 //export callbackQSqlDriver_BeginTransaction
 func callbackQSqlDriver_BeginTransaction(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "beginTransaction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "beginTransaction"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -691,14 +726,14 @@ func callbackQSqlDriver_BeginTransaction(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlDriver) ConnectBeginTransaction(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "beginTransaction", f)
+		qt.ConnectSignal(ptr.Pointer(), "beginTransaction", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectBeginTransaction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "beginTransaction")
+		qt.DisconnectSignal(ptr.Pointer(), "beginTransaction")
 	}
 }
 
@@ -718,7 +753,7 @@ func (ptr *QSqlDriver) BeginTransactionDefault() bool {
 
 //export callbackQSqlDriver_CommitTransaction
 func callbackQSqlDriver_CommitTransaction(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "commitTransaction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "commitTransaction"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -728,14 +763,14 @@ func callbackQSqlDriver_CommitTransaction(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlDriver) ConnectCommitTransaction(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "commitTransaction", f)
+		qt.ConnectSignal(ptr.Pointer(), "commitTransaction", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectCommitTransaction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "commitTransaction")
+		qt.DisconnectSignal(ptr.Pointer(), "commitTransaction")
 	}
 }
 
@@ -755,7 +790,7 @@ func (ptr *QSqlDriver) CommitTransactionDefault() bool {
 
 //export callbackQSqlDriver_Open
 func callbackQSqlDriver_Open(ptr unsafe.Pointer, db C.struct_QtSql_PackedString, user C.struct_QtSql_PackedString, password C.struct_QtSql_PackedString, host C.struct_QtSql_PackedString, port C.int, options C.struct_QtSql_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "open"); signal != nil {
+	if signal := qt.GetSignal(ptr, "open"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string, string, int, string) bool)(cGoUnpackString(db), cGoUnpackString(user), cGoUnpackString(password), cGoUnpackString(host), int(int32(port)), cGoUnpackString(options)))))
 	}
 
@@ -765,14 +800,14 @@ func callbackQSqlDriver_Open(ptr unsafe.Pointer, db C.struct_QtSql_PackedString,
 func (ptr *QSqlDriver) ConnectOpen(f func(db string, user string, password string, host string, port int, options string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "open", f)
+		qt.ConnectSignal(ptr.Pointer(), "open", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectOpen() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "open")
+		qt.DisconnectSignal(ptr.Pointer(), "open")
 	}
 }
 
@@ -795,7 +830,7 @@ func (ptr *QSqlDriver) Open(db string, user string, password string, host string
 
 //export callbackQSqlDriver_RollbackTransaction
 func callbackQSqlDriver_RollbackTransaction(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rollbackTransaction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rollbackTransaction"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -805,14 +840,14 @@ func callbackQSqlDriver_RollbackTransaction(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlDriver) ConnectRollbackTransaction(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rollbackTransaction", f)
+		qt.ConnectSignal(ptr.Pointer(), "rollbackTransaction", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectRollbackTransaction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rollbackTransaction")
+		qt.DisconnectSignal(ptr.Pointer(), "rollbackTransaction")
 	}
 }
 
@@ -832,7 +867,7 @@ func (ptr *QSqlDriver) RollbackTransactionDefault() bool {
 
 //export callbackQSqlDriver_SubscribeToNotification
 func callbackQSqlDriver_SubscribeToNotification(ptr unsafe.Pointer, name C.struct_QtSql_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "subscribeToNotification"); signal != nil {
+	if signal := qt.GetSignal(ptr, "subscribeToNotification"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -842,14 +877,14 @@ func callbackQSqlDriver_SubscribeToNotification(ptr unsafe.Pointer, name C.struc
 func (ptr *QSqlDriver) ConnectSubscribeToNotification(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "subscribeToNotification", f)
+		qt.ConnectSignal(ptr.Pointer(), "subscribeToNotification", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectSubscribeToNotification() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "subscribeToNotification")
+		qt.DisconnectSignal(ptr.Pointer(), "subscribeToNotification")
 	}
 }
 
@@ -873,7 +908,7 @@ func (ptr *QSqlDriver) SubscribeToNotificationDefault(name string) bool {
 
 //export callbackQSqlDriver_UnsubscribeFromNotification
 func callbackQSqlDriver_UnsubscribeFromNotification(ptr unsafe.Pointer, name C.struct_QtSql_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unsubscribeFromNotification"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unsubscribeFromNotification"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -883,14 +918,14 @@ func callbackQSqlDriver_UnsubscribeFromNotification(ptr unsafe.Pointer, name C.s
 func (ptr *QSqlDriver) ConnectUnsubscribeFromNotification(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unsubscribeFromNotification", f)
+		qt.ConnectSignal(ptr.Pointer(), "unsubscribeFromNotification", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectUnsubscribeFromNotification() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unsubscribeFromNotification")
+		qt.DisconnectSignal(ptr.Pointer(), "unsubscribeFromNotification")
 	}
 }
 
@@ -914,7 +949,7 @@ func (ptr *QSqlDriver) UnsubscribeFromNotificationDefault(name string) bool {
 
 //export callbackQSqlDriver_Close
 func callbackQSqlDriver_Close(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		signal.(func())()
 	}
 
@@ -923,14 +958,14 @@ func callbackQSqlDriver_Close(ptr unsafe.Pointer) {
 func (ptr *QSqlDriver) ConnectClose(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "close", f)
+		qt.ConnectSignal(ptr.Pointer(), "close", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectClose() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "close")
+		qt.DisconnectSignal(ptr.Pointer(), "close")
 	}
 }
 
@@ -942,7 +977,7 @@ func (ptr *QSqlDriver) Close() {
 
 //export callbackQSqlDriver_Notification
 func callbackQSqlDriver_Notification(ptr unsafe.Pointer, name C.struct_QtSql_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "notification"); signal != nil {
+	if signal := qt.GetSignal(ptr, "notification"); signal != nil {
 		signal.(func(string))(cGoUnpackString(name))
 	}
 
@@ -951,14 +986,14 @@ func callbackQSqlDriver_Notification(ptr unsafe.Pointer, name C.struct_QtSql_Pac
 func (ptr *QSqlDriver) ConnectNotification(f func(name string)) {
 	if ptr.Pointer() != nil {
 		C.QSqlDriver_ConnectNotification(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "notification", f)
+		qt.ConnectSignal(ptr.Pointer(), "notification", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectNotification() {
 	if ptr.Pointer() != nil {
 		C.QSqlDriver_DisconnectNotification(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "notification")
+		qt.DisconnectSignal(ptr.Pointer(), "notification")
 	}
 }
 
@@ -972,7 +1007,7 @@ func (ptr *QSqlDriver) Notification(name string) {
 
 //export callbackQSqlDriver_Notification2
 func callbackQSqlDriver_Notification2(ptr unsafe.Pointer, name C.struct_QtSql_PackedString, source C.longlong, payload unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "notification2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "notification2"); signal != nil {
 		signal.(func(string, QSqlDriver__NotificationSource, *core.QVariant))(cGoUnpackString(name), QSqlDriver__NotificationSource(source), core.NewQVariantFromPointer(payload))
 	}
 
@@ -981,14 +1016,14 @@ func callbackQSqlDriver_Notification2(ptr unsafe.Pointer, name C.struct_QtSql_Pa
 func (ptr *QSqlDriver) ConnectNotification2(f func(name string, source QSqlDriver__NotificationSource, payload *core.QVariant)) {
 	if ptr.Pointer() != nil {
 		C.QSqlDriver_ConnectNotification2(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "notification2", f)
+		qt.ConnectSignal(ptr.Pointer(), "notification2", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectNotification2() {
 	if ptr.Pointer() != nil {
 		C.QSqlDriver_DisconnectNotification2(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "notification2")
+		qt.DisconnectSignal(ptr.Pointer(), "notification2")
 	}
 }
 
@@ -1002,7 +1037,7 @@ func (ptr *QSqlDriver) Notification2(name string, source QSqlDriver__Notificatio
 
 //export callbackQSqlDriver_SetLastError
 func callbackQSqlDriver_SetLastError(ptr unsafe.Pointer, error unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setLastError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setLastError"); signal != nil {
 		signal.(func(*QSqlError))(NewQSqlErrorFromPointer(error))
 	} else {
 		NewQSqlDriverFromPointer(ptr).SetLastErrorDefault(NewQSqlErrorFromPointer(error))
@@ -1012,14 +1047,14 @@ func callbackQSqlDriver_SetLastError(ptr unsafe.Pointer, error unsafe.Pointer) {
 func (ptr *QSqlDriver) ConnectSetLastError(f func(error *QSqlError)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setLastError", f)
+		qt.ConnectSignal(ptr.Pointer(), "setLastError", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectSetLastError() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setLastError")
+		qt.DisconnectSignal(ptr.Pointer(), "setLastError")
 	}
 }
 
@@ -1043,7 +1078,7 @@ func (ptr *QSqlDriver) SetNumericalPrecisionPolicy(precisionPolicy QSql__Numeric
 
 //export callbackQSqlDriver_SetOpen
 func callbackQSqlDriver_SetOpen(ptr unsafe.Pointer, open C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setOpen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setOpen"); signal != nil {
 		signal.(func(bool))(int8(open) != 0)
 	} else {
 		NewQSqlDriverFromPointer(ptr).SetOpenDefault(int8(open) != 0)
@@ -1053,14 +1088,14 @@ func callbackQSqlDriver_SetOpen(ptr unsafe.Pointer, open C.char) {
 func (ptr *QSqlDriver) ConnectSetOpen(f func(open bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setOpen", f)
+		qt.ConnectSignal(ptr.Pointer(), "setOpen", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectSetOpen() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setOpen")
+		qt.DisconnectSignal(ptr.Pointer(), "setOpen")
 	}
 }
 
@@ -1078,7 +1113,7 @@ func (ptr *QSqlDriver) SetOpenDefault(open bool) {
 
 //export callbackQSqlDriver_SetOpenError
 func callbackQSqlDriver_SetOpenError(ptr unsafe.Pointer, error C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setOpenError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setOpenError"); signal != nil {
 		signal.(func(bool))(int8(error) != 0)
 	} else {
 		NewQSqlDriverFromPointer(ptr).SetOpenErrorDefault(int8(error) != 0)
@@ -1088,14 +1123,14 @@ func callbackQSqlDriver_SetOpenError(ptr unsafe.Pointer, error C.char) {
 func (ptr *QSqlDriver) ConnectSetOpenError(f func(error bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setOpenError", f)
+		qt.ConnectSignal(ptr.Pointer(), "setOpenError", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectSetOpenError() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setOpenError")
+		qt.DisconnectSignal(ptr.Pointer(), "setOpenError")
 	}
 }
 
@@ -1114,7 +1149,7 @@ func (ptr *QSqlDriver) SetOpenErrorDefault(error bool) {
 func (ptr *QSqlDriver) DestroyQSqlDriver() {
 	if ptr.Pointer() != nil {
 		C.QSqlDriver_DestroyQSqlDriver(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1144,7 +1179,7 @@ func (ptr *QSqlDriver) LastError() *QSqlError {
 
 //export callbackQSqlDriver_PrimaryIndex
 func callbackQSqlDriver_PrimaryIndex(ptr unsafe.Pointer, tableName C.struct_QtSql_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "primaryIndex"); signal != nil {
+	if signal := qt.GetSignal(ptr, "primaryIndex"); signal != nil {
 		return PointerFromQSqlIndex(signal.(func(string) *QSqlIndex)(cGoUnpackString(tableName)))
 	}
 
@@ -1154,14 +1189,14 @@ func callbackQSqlDriver_PrimaryIndex(ptr unsafe.Pointer, tableName C.struct_QtSq
 func (ptr *QSqlDriver) ConnectPrimaryIndex(f func(tableName string) *QSqlIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "primaryIndex", f)
+		qt.ConnectSignal(ptr.Pointer(), "primaryIndex", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectPrimaryIndex() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "primaryIndex")
+		qt.DisconnectSignal(ptr.Pointer(), "primaryIndex")
 	}
 }
 
@@ -1189,7 +1224,7 @@ func (ptr *QSqlDriver) PrimaryIndexDefault(tableName string) *QSqlIndex {
 
 //export callbackQSqlDriver_Record
 func callbackQSqlDriver_Record(ptr unsafe.Pointer, tableName C.struct_QtSql_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "record"); signal != nil {
+	if signal := qt.GetSignal(ptr, "record"); signal != nil {
 		return PointerFromQSqlRecord(signal.(func(string) *QSqlRecord)(cGoUnpackString(tableName)))
 	}
 
@@ -1199,14 +1234,14 @@ func callbackQSqlDriver_Record(ptr unsafe.Pointer, tableName C.struct_QtSql_Pack
 func (ptr *QSqlDriver) ConnectRecord(f func(tableName string) *QSqlRecord) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "record", f)
+		qt.ConnectSignal(ptr.Pointer(), "record", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectRecord() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "record")
+		qt.DisconnectSignal(ptr.Pointer(), "record")
 	}
 }
 
@@ -1234,7 +1269,7 @@ func (ptr *QSqlDriver) RecordDefault(tableName string) *QSqlRecord {
 
 //export callbackQSqlDriver_CreateResult
 func callbackQSqlDriver_CreateResult(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createResult"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createResult"); signal != nil {
 		return PointerFromQSqlResult(signal.(func() *QSqlResult)())
 	}
 
@@ -1244,14 +1279,14 @@ func callbackQSqlDriver_CreateResult(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSqlDriver) ConnectCreateResult(f func() *QSqlResult) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createResult", f)
+		qt.ConnectSignal(ptr.Pointer(), "createResult", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectCreateResult() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createResult")
+		qt.DisconnectSignal(ptr.Pointer(), "createResult")
 	}
 }
 
@@ -1264,7 +1299,7 @@ func (ptr *QSqlDriver) CreateResult() *QSqlResult {
 
 //export callbackQSqlDriver_EscapeIdentifier
 func callbackQSqlDriver_EscapeIdentifier(ptr unsafe.Pointer, identifier C.struct_QtSql_PackedString, ty C.longlong) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "escapeIdentifier"); signal != nil {
+	if signal := qt.GetSignal(ptr, "escapeIdentifier"); signal != nil {
 		return C.CString(signal.(func(string, QSqlDriver__IdentifierType) string)(cGoUnpackString(identifier), QSqlDriver__IdentifierType(ty)))
 	}
 
@@ -1274,14 +1309,14 @@ func callbackQSqlDriver_EscapeIdentifier(ptr unsafe.Pointer, identifier C.struct
 func (ptr *QSqlDriver) ConnectEscapeIdentifier(f func(identifier string, ty QSqlDriver__IdentifierType) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "escapeIdentifier", f)
+		qt.ConnectSignal(ptr.Pointer(), "escapeIdentifier", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectEscapeIdentifier() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "escapeIdentifier")
+		qt.DisconnectSignal(ptr.Pointer(), "escapeIdentifier")
 	}
 }
 
@@ -1305,7 +1340,7 @@ func (ptr *QSqlDriver) EscapeIdentifierDefault(identifier string, ty QSqlDriver_
 
 //export callbackQSqlDriver_FormatValue
 func callbackQSqlDriver_FormatValue(ptr unsafe.Pointer, field unsafe.Pointer, trimStrings C.char) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "formatValue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "formatValue"); signal != nil {
 		return C.CString(signal.(func(*QSqlField, bool) string)(NewQSqlFieldFromPointer(field), int8(trimStrings) != 0))
 	}
 
@@ -1315,14 +1350,14 @@ func callbackQSqlDriver_FormatValue(ptr unsafe.Pointer, field unsafe.Pointer, tr
 func (ptr *QSqlDriver) ConnectFormatValue(f func(field *QSqlField, trimStrings bool) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "formatValue", f)
+		qt.ConnectSignal(ptr.Pointer(), "formatValue", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectFormatValue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "formatValue")
+		qt.DisconnectSignal(ptr.Pointer(), "formatValue")
 	}
 }
 
@@ -1342,7 +1377,7 @@ func (ptr *QSqlDriver) FormatValueDefault(field QSqlField_ITF, trimStrings bool)
 
 //export callbackQSqlDriver_SqlStatement
 func callbackQSqlDriver_SqlStatement(ptr unsafe.Pointer, ty C.longlong, tableName C.struct_QtSql_PackedString, rec unsafe.Pointer, preparedStatement C.char) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sqlStatement"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sqlStatement"); signal != nil {
 		return C.CString(signal.(func(QSqlDriver__StatementType, string, *QSqlRecord, bool) string)(QSqlDriver__StatementType(ty), cGoUnpackString(tableName), NewQSqlRecordFromPointer(rec), int8(preparedStatement) != 0))
 	}
 
@@ -1352,14 +1387,14 @@ func callbackQSqlDriver_SqlStatement(ptr unsafe.Pointer, ty C.longlong, tableNam
 func (ptr *QSqlDriver) ConnectSqlStatement(f func(ty QSqlDriver__StatementType, tableName string, rec *QSqlRecord, preparedStatement bool) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sqlStatement", f)
+		qt.ConnectSignal(ptr.Pointer(), "sqlStatement", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectSqlStatement() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sqlStatement")
+		qt.DisconnectSignal(ptr.Pointer(), "sqlStatement")
 	}
 }
 
@@ -1383,7 +1418,7 @@ func (ptr *QSqlDriver) SqlStatementDefault(ty QSqlDriver__StatementType, tableNa
 
 //export callbackQSqlDriver_StripDelimiters
 func callbackQSqlDriver_StripDelimiters(ptr unsafe.Pointer, identifier C.struct_QtSql_PackedString, ty C.longlong) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "stripDelimiters"); signal != nil {
+	if signal := qt.GetSignal(ptr, "stripDelimiters"); signal != nil {
 		return C.CString(signal.(func(string, QSqlDriver__IdentifierType) string)(cGoUnpackString(identifier), QSqlDriver__IdentifierType(ty)))
 	}
 
@@ -1393,14 +1428,14 @@ func callbackQSqlDriver_StripDelimiters(ptr unsafe.Pointer, identifier C.struct_
 func (ptr *QSqlDriver) ConnectStripDelimiters(f func(identifier string, ty QSqlDriver__IdentifierType) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "stripDelimiters", f)
+		qt.ConnectSignal(ptr.Pointer(), "stripDelimiters", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectStripDelimiters() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "stripDelimiters")
+		qt.DisconnectSignal(ptr.Pointer(), "stripDelimiters")
 	}
 }
 
@@ -1424,81 +1459,81 @@ func (ptr *QSqlDriver) StripDelimitersDefault(identifier string, ty QSqlDriver__
 
 //export callbackQSqlDriver_SubscribedToNotifications
 func callbackQSqlDriver_SubscribedToNotifications(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "subscribedToNotifications"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "subscribedToNotifications"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(NewQSqlDriverFromPointer(ptr).SubscribedToNotificationsDefault(), "|"))
+	return cGoPackStringList(NewQSqlDriverFromPointer(ptr).SubscribedToNotificationsDefault())
 }
 
 func (ptr *QSqlDriver) ConnectSubscribedToNotifications(f func() []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "subscribedToNotifications", f)
+		qt.ConnectSignal(ptr.Pointer(), "subscribedToNotifications", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectSubscribedToNotifications() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "subscribedToNotifications")
+		qt.DisconnectSignal(ptr.Pointer(), "subscribedToNotifications")
 	}
 }
 
 func (ptr *QSqlDriver) SubscribedToNotifications() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSqlDriver_SubscribedToNotifications(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSqlDriver_SubscribedToNotifications(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSqlDriver) SubscribedToNotificationsDefault() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSqlDriver_SubscribedToNotificationsDefault(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSqlDriver_SubscribedToNotificationsDefault(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQSqlDriver_Tables
 func callbackQSqlDriver_Tables(ptr unsafe.Pointer, tableType C.longlong) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tables"); signal != nil {
-		return C.CString(strings.Join(signal.(func(QSql__TableType) []string)(QSql__TableType(tableType)), "|"))
+	if signal := qt.GetSignal(ptr, "tables"); signal != nil {
+		return cGoPackStringList(signal.(func(QSql__TableType) []string)(QSql__TableType(tableType)))
 	}
 
-	return C.CString(strings.Join(NewQSqlDriverFromPointer(ptr).TablesDefault(QSql__TableType(tableType)), "|"))
+	return cGoPackStringList(NewQSqlDriverFromPointer(ptr).TablesDefault(QSql__TableType(tableType)))
 }
 
 func (ptr *QSqlDriver) ConnectTables(f func(tableType QSql__TableType) []string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "tables", f)
+		qt.ConnectSignal(ptr.Pointer(), "tables", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectTables() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "tables")
+		qt.DisconnectSignal(ptr.Pointer(), "tables")
 	}
 }
 
 func (ptr *QSqlDriver) Tables(tableType QSql__TableType) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSqlDriver_Tables(ptr.Pointer(), C.longlong(tableType))), "|")
+		return cGoUnpackStringListAndFree(C.QSqlDriver_Tables(ptr.Pointer(), C.longlong(tableType)))
 	}
 	return make([]string, 0)
 }
 
 func (ptr *QSqlDriver) TablesDefault(tableType QSql__TableType) []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSqlDriver_TablesDefault(ptr.Pointer(), C.longlong(tableType))), "|")
+		return cGoUnpackStringListAndFree(C.QSqlDriver_TablesDefault(ptr.Pointer(), C.longlong(tableType)))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQSqlDriver_Handle
 func callbackQSqlDriver_Handle(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "handle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "handle"); signal != nil {
 		return core.PointerFromQVariant(signal.(func() *core.QVariant)())
 	}
 
@@ -1508,14 +1543,14 @@ func callbackQSqlDriver_Handle(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSqlDriver) ConnectHandle(f func() *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "handle", f)
+		qt.ConnectSignal(ptr.Pointer(), "handle", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectHandle() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "handle")
+		qt.DisconnectSignal(ptr.Pointer(), "handle")
 	}
 }
 
@@ -1539,7 +1574,7 @@ func (ptr *QSqlDriver) HandleDefault() *core.QVariant {
 
 //export callbackQSqlDriver_HasFeature
 func callbackQSqlDriver_HasFeature(ptr unsafe.Pointer, feature C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasFeature"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasFeature"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(QSqlDriver__DriverFeature) bool)(QSqlDriver__DriverFeature(feature)))))
 	}
 
@@ -1549,14 +1584,14 @@ func callbackQSqlDriver_HasFeature(ptr unsafe.Pointer, feature C.longlong) C.cha
 func (ptr *QSqlDriver) ConnectHasFeature(f func(feature QSqlDriver__DriverFeature) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasFeature", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasFeature", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectHasFeature() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasFeature")
+		qt.DisconnectSignal(ptr.Pointer(), "hasFeature")
 	}
 }
 
@@ -1569,7 +1604,7 @@ func (ptr *QSqlDriver) HasFeature(feature QSqlDriver__DriverFeature) bool {
 
 //export callbackQSqlDriver_IsIdentifierEscaped
 func callbackQSqlDriver_IsIdentifierEscaped(ptr unsafe.Pointer, identifier C.struct_QtSql_PackedString, ty C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isIdentifierEscaped"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isIdentifierEscaped"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, QSqlDriver__IdentifierType) bool)(cGoUnpackString(identifier), QSqlDriver__IdentifierType(ty)))))
 	}
 
@@ -1579,14 +1614,14 @@ func callbackQSqlDriver_IsIdentifierEscaped(ptr unsafe.Pointer, identifier C.str
 func (ptr *QSqlDriver) ConnectIsIdentifierEscaped(f func(identifier string, ty QSqlDriver__IdentifierType) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isIdentifierEscaped", f)
+		qt.ConnectSignal(ptr.Pointer(), "isIdentifierEscaped", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectIsIdentifierEscaped() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isIdentifierEscaped")
+		qt.DisconnectSignal(ptr.Pointer(), "isIdentifierEscaped")
 	}
 }
 
@@ -1610,7 +1645,7 @@ func (ptr *QSqlDriver) IsIdentifierEscapedDefault(identifier string, ty QSqlDriv
 
 //export callbackQSqlDriver_IsOpen
 func callbackQSqlDriver_IsOpen(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isOpen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isOpen"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -1620,14 +1655,14 @@ func callbackQSqlDriver_IsOpen(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlDriver) ConnectIsOpen(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isOpen", f)
+		qt.ConnectSignal(ptr.Pointer(), "isOpen", f)
 	}
 }
 
 func (ptr *QSqlDriver) DisconnectIsOpen() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isOpen")
+		qt.DisconnectSignal(ptr.Pointer(), "isOpen")
 	}
 }
 
@@ -1674,7 +1709,7 @@ func (ptr *QSqlDriver) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSqlDriver) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlDriver___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1695,7 +1730,7 @@ func (ptr *QSqlDriver) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSqlDriver) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlDriver___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1716,7 +1751,7 @@ func (ptr *QSqlDriver) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSqlDriver) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlDriver___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1737,7 +1772,7 @@ func (ptr *QSqlDriver) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSqlDriver) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlDriver___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1757,7 +1792,7 @@ func (ptr *QSqlDriver) __children_newList() unsafe.Pointer {
 
 //export callbackQSqlDriver_Event
 func callbackQSqlDriver_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -1773,7 +1808,7 @@ func (ptr *QSqlDriver) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSqlDriver_EventFilter
 func callbackQSqlDriver_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -1789,7 +1824,7 @@ func (ptr *QSqlDriver) EventFilterDefault(watched core.QObject_ITF, event core.Q
 
 //export callbackQSqlDriver_ChildEvent
 func callbackQSqlDriver_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSqlDriverFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -1804,7 +1839,7 @@ func (ptr *QSqlDriver) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSqlDriver_ConnectNotify
 func callbackQSqlDriver_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSqlDriverFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1819,7 +1854,7 @@ func (ptr *QSqlDriver) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSqlDriver_CustomEvent
 func callbackQSqlDriver_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSqlDriverFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -1834,7 +1869,7 @@ func (ptr *QSqlDriver) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSqlDriver_DeleteLater
 func callbackQSqlDriver_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlDriverFromPointer(ptr).DeleteLaterDefault()
@@ -1844,14 +1879,14 @@ func callbackQSqlDriver_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSqlDriver) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSqlDriver_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSqlDriver_Destroyed
 func callbackQSqlDriver_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -1859,7 +1894,7 @@ func callbackQSqlDriver_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSqlDriver_DisconnectNotify
 func callbackQSqlDriver_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSqlDriverFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1874,7 +1909,7 @@ func (ptr *QSqlDriver) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSqlDriver_ObjectNameChanged
 func callbackQSqlDriver_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSql_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -1882,7 +1917,7 @@ func callbackQSqlDriver_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struc
 
 //export callbackQSqlDriver_TimerEvent
 func callbackQSqlDriver_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSqlDriverFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -1897,7 +1932,7 @@ func (ptr *QSqlDriver) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSqlDriver_MetaObject
 func callbackQSqlDriver_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -1953,7 +1988,7 @@ func NewQSqlDriverCreatorFromPointer(ptr unsafe.Pointer) *QSqlDriverCreator {
 func (ptr *QSqlDriverCreator) DestroyQSqlDriverCreator() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1998,7 +2033,7 @@ func NewQSqlDriverCreatorBaseFromPointer(ptr unsafe.Pointer) *QSqlDriverCreatorB
 
 //export callbackQSqlDriverCreatorBase_DestroyQSqlDriverCreatorBase
 func callbackQSqlDriverCreatorBase_DestroyQSqlDriverCreatorBase(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSqlDriverCreatorBase"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSqlDriverCreatorBase"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlDriverCreatorBaseFromPointer(ptr).DestroyQSqlDriverCreatorBaseDefault()
@@ -2008,21 +2043,21 @@ func callbackQSqlDriverCreatorBase_DestroyQSqlDriverCreatorBase(ptr unsafe.Point
 func (ptr *QSqlDriverCreatorBase) ConnectDestroyQSqlDriverCreatorBase(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlDriverCreatorBase", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSqlDriverCreatorBase", f)
 	}
 }
 
 func (ptr *QSqlDriverCreatorBase) DisconnectDestroyQSqlDriverCreatorBase() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlDriverCreatorBase")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSqlDriverCreatorBase")
 	}
 }
 
 func (ptr *QSqlDriverCreatorBase) DestroyQSqlDriverCreatorBase() {
 	if ptr.Pointer() != nil {
 		C.QSqlDriverCreatorBase_DestroyQSqlDriverCreatorBase(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2030,14 +2065,14 @@ func (ptr *QSqlDriverCreatorBase) DestroyQSqlDriverCreatorBase() {
 func (ptr *QSqlDriverCreatorBase) DestroyQSqlDriverCreatorBaseDefault() {
 	if ptr.Pointer() != nil {
 		C.QSqlDriverCreatorBase_DestroyQSqlDriverCreatorBaseDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSqlDriverCreatorBase_CreateObject
 func callbackQSqlDriverCreatorBase_CreateObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createObject"); signal != nil {
 		return PointerFromQSqlDriver(signal.(func() *QSqlDriver)())
 	}
 
@@ -2047,21 +2082,21 @@ func callbackQSqlDriverCreatorBase_CreateObject(ptr unsafe.Pointer) unsafe.Point
 func (ptr *QSqlDriverCreatorBase) ConnectCreateObject(f func() *QSqlDriver) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "createObject", f)
+		qt.ConnectSignal(ptr.Pointer(), "createObject", f)
 	}
 }
 
 func (ptr *QSqlDriverCreatorBase) DisconnectCreateObject() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "createObject")
+		qt.DisconnectSignal(ptr.Pointer(), "createObject")
 	}
 }
 
 func (ptr *QSqlDriverCreatorBase) CreateObject() *QSqlDriver {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSqlDriverFromPointer(C.QSqlDriverCreatorBase_CreateObject(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2110,7 +2145,7 @@ func NewQSqlDriverPluginFromPointer(ptr unsafe.Pointer) *QSqlDriverPlugin {
 
 //export callbackQSqlDriverPlugin_Create
 func callbackQSqlDriverPlugin_Create(ptr unsafe.Pointer, key C.struct_QtSql_PackedString) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "create"); signal != nil {
+	if signal := qt.GetSignal(ptr, "create"); signal != nil {
 		return PointerFromQSqlDriver(signal.(func(string) *QSqlDriver)(cGoUnpackString(key)))
 	}
 
@@ -2120,14 +2155,14 @@ func callbackQSqlDriverPlugin_Create(ptr unsafe.Pointer, key C.struct_QtSql_Pack
 func (ptr *QSqlDriverPlugin) ConnectCreate(f func(key string) *QSqlDriver) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "create", f)
+		qt.ConnectSignal(ptr.Pointer(), "create", f)
 	}
 }
 
 func (ptr *QSqlDriverPlugin) DisconnectCreate() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "create")
+		qt.DisconnectSignal(ptr.Pointer(), "create")
 	}
 }
 
@@ -2136,7 +2171,7 @@ func (ptr *QSqlDriverPlugin) Create(key string) *QSqlDriver {
 		var keyC = C.CString(key)
 		defer C.free(unsafe.Pointer(keyC))
 		var tmpValue = NewQSqlDriverFromPointer(C.QSqlDriverPlugin_Create(ptr.Pointer(), keyC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2146,7 +2181,7 @@ func (ptr *QSqlDriverPlugin) Create(key string) *QSqlDriver {
 
 func NewQSqlDriverPlugin(parent core.QObject_ITF) *QSqlDriverPlugin {
 	var tmpValue = NewQSqlDriverPluginFromPointer(C.QSqlDriverPlugin_NewQSqlDriverPlugin(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2155,7 +2190,7 @@ func NewQSqlDriverPlugin(parent core.QObject_ITF) *QSqlDriverPlugin {
 func (ptr *QSqlDriverPlugin) DestroyQSqlDriverPlugin() {
 	if ptr.Pointer() != nil {
 		C.QSqlDriverPlugin_DestroyQSqlDriverPlugin(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2182,7 +2217,7 @@ func (ptr *QSqlDriverPlugin) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSqlDriverPlugin) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlDriverPlugin___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2203,7 +2238,7 @@ func (ptr *QSqlDriverPlugin) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSqlDriverPlugin) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlDriverPlugin___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2224,7 +2259,7 @@ func (ptr *QSqlDriverPlugin) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSqlDriverPlugin) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlDriverPlugin___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2245,7 +2280,7 @@ func (ptr *QSqlDriverPlugin) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSqlDriverPlugin) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlDriverPlugin___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2265,7 +2300,7 @@ func (ptr *QSqlDriverPlugin) __children_newList() unsafe.Pointer {
 
 //export callbackQSqlDriverPlugin_Event
 func callbackQSqlDriverPlugin_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -2281,7 +2316,7 @@ func (ptr *QSqlDriverPlugin) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSqlDriverPlugin_EventFilter
 func callbackQSqlDriverPlugin_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -2297,7 +2332,7 @@ func (ptr *QSqlDriverPlugin) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQSqlDriverPlugin_ChildEvent
 func callbackQSqlDriverPlugin_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSqlDriverPluginFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -2312,7 +2347,7 @@ func (ptr *QSqlDriverPlugin) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSqlDriverPlugin_ConnectNotify
 func callbackQSqlDriverPlugin_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSqlDriverPluginFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -2327,7 +2362,7 @@ func (ptr *QSqlDriverPlugin) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSqlDriverPlugin_CustomEvent
 func callbackQSqlDriverPlugin_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSqlDriverPluginFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -2342,7 +2377,7 @@ func (ptr *QSqlDriverPlugin) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSqlDriverPlugin_DeleteLater
 func callbackQSqlDriverPlugin_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlDriverPluginFromPointer(ptr).DeleteLaterDefault()
@@ -2352,14 +2387,14 @@ func callbackQSqlDriverPlugin_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSqlDriverPlugin) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSqlDriverPlugin_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSqlDriverPlugin_Destroyed
 func callbackQSqlDriverPlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -2367,7 +2402,7 @@ func callbackQSqlDriverPlugin_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQSqlDriverPlugin_DisconnectNotify
 func callbackQSqlDriverPlugin_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSqlDriverPluginFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -2382,7 +2417,7 @@ func (ptr *QSqlDriverPlugin) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQSqlDriverPlugin_ObjectNameChanged
 func callbackQSqlDriverPlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSql_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -2390,7 +2425,7 @@ func callbackQSqlDriverPlugin_ObjectNameChanged(ptr unsafe.Pointer, objectName C
 
 //export callbackQSqlDriverPlugin_TimerEvent
 func callbackQSqlDriverPlugin_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSqlDriverPluginFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -2405,7 +2440,7 @@ func (ptr *QSqlDriverPlugin) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSqlDriverPlugin_MetaObject
 func callbackQSqlDriverPlugin_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -3202,7 +3237,7 @@ func (ptr *QSqlQuery) IsValid() bool {
 func (ptr *QSqlQuery) Driver() *QSqlDriver {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSqlDriverFromPointer(C.QSqlQuery_Driver(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -3333,7 +3368,7 @@ func NewQSqlQueryModelFromPointer(ptr unsafe.Pointer) *QSqlQueryModel {
 }
 func NewQSqlQueryModel(parent core.QObject_ITF) *QSqlQueryModel {
 	var tmpValue = NewQSqlQueryModelFromPointer(C.QSqlQueryModel_NewQSqlQueryModel(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -3341,7 +3376,7 @@ func NewQSqlQueryModel(parent core.QObject_ITF) *QSqlQueryModel {
 
 //export callbackQSqlQueryModel_InsertColumns
 func callbackQSqlQueryModel_InsertColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(column)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -3357,7 +3392,7 @@ func (ptr *QSqlQueryModel) InsertColumnsDefault(column int, count int, parent co
 
 //export callbackQSqlQueryModel_RemoveColumns
 func callbackQSqlQueryModel_RemoveColumns(ptr unsafe.Pointer, column C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(column)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -3373,7 +3408,7 @@ func (ptr *QSqlQueryModel) RemoveColumnsDefault(column int, count int, parent co
 
 //export callbackQSqlQueryModel_SetHeaderData
 func callbackQSqlQueryModel_SetHeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHeaderData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHeaderData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, core.Qt__Orientation, *core.QVariant, int) bool)(int(int32(section)), core.Qt__Orientation(orientation), core.NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -3389,7 +3424,7 @@ func (ptr *QSqlQueryModel) SetHeaderDataDefault(section int, orientation core.Qt
 
 //export callbackQSqlQueryModel_Clear
 func callbackQSqlQueryModel_Clear(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "clear"); signal != nil {
+	if signal := qt.GetSignal(ptr, "clear"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).ClearDefault()
@@ -3399,14 +3434,14 @@ func callbackQSqlQueryModel_Clear(ptr unsafe.Pointer) {
 func (ptr *QSqlQueryModel) ConnectClear(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "clear", f)
+		qt.ConnectSignal(ptr.Pointer(), "clear", f)
 	}
 }
 
 func (ptr *QSqlQueryModel) DisconnectClear() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "clear")
+		qt.DisconnectSignal(ptr.Pointer(), "clear")
 	}
 }
 
@@ -3424,7 +3459,7 @@ func (ptr *QSqlQueryModel) ClearDefault() {
 
 //export callbackQSqlQueryModel_FetchMore
 func callbackQSqlQueryModel_FetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchMore"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(parent))
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).FetchMoreDefault(core.NewQModelIndexFromPointer(parent))
@@ -3439,7 +3474,7 @@ func (ptr *QSqlQueryModel) FetchMoreDefault(parent core.QModelIndex_ITF) {
 
 //export callbackQSqlQueryModel_QueryChange
 func callbackQSqlQueryModel_QueryChange(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "queryChange"); signal != nil {
+	if signal := qt.GetSignal(ptr, "queryChange"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).QueryChangeDefault()
@@ -3449,14 +3484,14 @@ func callbackQSqlQueryModel_QueryChange(ptr unsafe.Pointer) {
 func (ptr *QSqlQueryModel) ConnectQueryChange(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "queryChange", f)
+		qt.ConnectSignal(ptr.Pointer(), "queryChange", f)
 	}
 }
 
 func (ptr *QSqlQueryModel) DisconnectQueryChange() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "queryChange")
+		qt.DisconnectSignal(ptr.Pointer(), "queryChange")
 	}
 }
 
@@ -3494,7 +3529,7 @@ func (ptr *QSqlQueryModel) SetQuery2(query string, db QSqlDatabase_ITF) {
 
 //export callbackQSqlQueryModel_DestroyQSqlQueryModel
 func callbackQSqlQueryModel_DestroyQSqlQueryModel(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSqlQueryModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSqlQueryModel"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).DestroyQSqlQueryModelDefault()
@@ -3504,21 +3539,21 @@ func callbackQSqlQueryModel_DestroyQSqlQueryModel(ptr unsafe.Pointer) {
 func (ptr *QSqlQueryModel) ConnectDestroyQSqlQueryModel(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlQueryModel", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSqlQueryModel", f)
 	}
 }
 
 func (ptr *QSqlQueryModel) DisconnectDestroyQSqlQueryModel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlQueryModel")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSqlQueryModel")
 	}
 }
 
 func (ptr *QSqlQueryModel) DestroyQSqlQueryModel() {
 	if ptr.Pointer() != nil {
 		C.QSqlQueryModel_DestroyQSqlQueryModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3526,14 +3561,14 @@ func (ptr *QSqlQueryModel) DestroyQSqlQueryModel() {
 func (ptr *QSqlQueryModel) DestroyQSqlQueryModelDefault() {
 	if ptr.Pointer() != nil {
 		C.QSqlQueryModel_DestroyQSqlQueryModelDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSqlQueryModel_IndexInQuery
 func callbackQSqlQueryModel_IndexInQuery(ptr unsafe.Pointer, item unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "indexInQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "indexInQuery"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QModelIndex) *core.QModelIndex)(core.NewQModelIndexFromPointer(item)))
 	}
 
@@ -3543,14 +3578,14 @@ func callbackQSqlQueryModel_IndexInQuery(ptr unsafe.Pointer, item unsafe.Pointer
 func (ptr *QSqlQueryModel) ConnectIndexInQuery(f func(item *core.QModelIndex) *core.QModelIndex) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "indexInQuery", f)
+		qt.ConnectSignal(ptr.Pointer(), "indexInQuery", f)
 	}
 }
 
 func (ptr *QSqlQueryModel) DisconnectIndexInQuery() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "indexInQuery")
+		qt.DisconnectSignal(ptr.Pointer(), "indexInQuery")
 	}
 }
 
@@ -3609,25 +3644,31 @@ func (ptr *QSqlQueryModel) Record(row int) *QSqlRecord {
 }
 
 //export callbackQSqlQueryModel_Data
-func callbackQSqlQueryModel_Data(ptr unsafe.Pointer, item unsafe.Pointer, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
-		return core.PointerFromQVariant(signal.(func(*core.QModelIndex, int) *core.QVariant)(core.NewQModelIndexFromPointer(item), int(int32(role))))
+func callbackQSqlQueryModel_Data(ptr unsafe.Pointer, item unsafe.Pointer, role C.int, ret unsafe.Pointer) {
+	if signal := qt.GetSignal(ptr, "dataInto"); signal != nil {
+		signal.(func(*core.QModelIndex, int, *core.QVariant))(core.NewQModelIndexFromPointer(item), int(int32(role)), core.NewQVariantFromPointer(ret))
+		return
+	}
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
+		var tmpValue = signal.(func(*core.QModelIndex, int) *core.QVariant)(core.NewQModelIndexFromPointer(item), int(int32(role)))
+		core.NewQVariantFromPointer(ret).Assign(tmpValue)
+		return
 	}
 
-	return core.PointerFromQVariant(NewQSqlQueryModelFromPointer(ptr).DataDefault(core.NewQModelIndexFromPointer(item), int(int32(role))))
+	C.QSqlQueryModel_DataDefaultInto(ptr, item, role, ret)
 }
 
 func (ptr *QSqlQueryModel) ConnectData(f func(item *core.QModelIndex, role int) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QSqlQueryModel) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
@@ -3651,7 +3692,7 @@ func (ptr *QSqlQueryModel) DataDefault(item core.QModelIndex_ITF, role int) *cor
 
 //export callbackQSqlQueryModel_HeaderData
 func callbackQSqlQueryModel_HeaderData(ptr unsafe.Pointer, section C.int, orientation C.longlong, role C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerData"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(int, core.Qt__Orientation, int) *core.QVariant)(int(int32(section)), core.Qt__Orientation(orientation), int(int32(role))))
 	}
 
@@ -3669,7 +3710,7 @@ func (ptr *QSqlQueryModel) HeaderDataDefault(section int, orientation core.Qt__O
 
 //export callbackQSqlQueryModel_CanFetchMore
 func callbackQSqlQueryModel_CanFetchMore(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canFetchMore"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canFetchMore"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -3685,7 +3726,7 @@ func (ptr *QSqlQueryModel) CanFetchMoreDefault(parent core.QModelIndex_ITF) bool
 
 //export callbackQSqlQueryModel_ColumnCount
 func callbackQSqlQueryModel_ColumnCount(ptr unsafe.Pointer, index unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnCount"); signal != nil {
 		return C.int(int32(signal.(func(*core.QModelIndex) int)(core.NewQModelIndexFromPointer(index))))
 	}
 
@@ -3695,14 +3736,14 @@ func callbackQSqlQueryModel_ColumnCount(ptr unsafe.Pointer, index unsafe.Pointer
 func (ptr *QSqlQueryModel) ConnectColumnCount(f func(index *core.QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnCount", f)
 	}
 }
 
 func (ptr *QSqlQueryModel) DisconnectColumnCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnCount")
+		qt.DisconnectSignal(ptr.Pointer(), "columnCount")
 	}
 }
 
@@ -3722,7 +3763,7 @@ func (ptr *QSqlQueryModel) ColumnCountDefault(index core.QModelIndex_ITF) int {
 
 //export callbackQSqlQueryModel_RowCount
 func callbackQSqlQueryModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowCount"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowCount"); signal != nil {
 		return C.int(int32(signal.(func(*core.QModelIndex) int)(core.NewQModelIndexFromPointer(parent))))
 	}
 
@@ -3732,14 +3773,14 @@ func callbackQSqlQueryModel_RowCount(ptr unsafe.Pointer, parent unsafe.Pointer)
 func (ptr *QSqlQueryModel) ConnectRowCount(f func(parent *core.QModelIndex) int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount", f)
+		qt.ConnectSignal(ptr.Pointer(), "rowCount", f)
 	}
 }
 
 func (ptr *QSqlQueryModel) DisconnectRowCount() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "rowCount")
+		qt.DisconnectSignal(ptr.Pointer(), "rowCount")
 	}
 }
 
@@ -3774,6 +3815,16 @@ func (ptr *QSqlQueryModel) ____setItemData_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QSqlQueryModel_____setItemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QSqlQueryModel) ____setItemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QSqlQueryModel_____setItemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QSqlQueryModel) ____setItemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QSqlQueryModel_____setItemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QSqlQueryModel) ____roleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QSqlQueryModel_____roleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -3791,6 +3842,16 @@ func (ptr *QSqlQueryModel) ____roleNames_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QSqlQueryModel_____roleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QSqlQueryModel) ____roleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QSqlQueryModel_____roleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QSqlQueryModel) ____roleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QSqlQueryModel_____roleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QSqlQueryModel) ____itemData_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QSqlQueryModel_____itemData_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -3808,6 +3869,16 @@ func (ptr *QSqlQueryModel) ____itemData_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QSqlQueryModel_____itemData_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QSqlQueryModel) ____itemData_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QSqlQueryModel_____itemData_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QSqlQueryModel) ____itemData_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QSqlQueryModel_____itemData_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QSqlQueryModel) __setItemData_roles_atList(i int) *core.QVariant {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQVariantFromPointer(C.QSqlQueryModel___setItemData_roles_atList(ptr.Pointer(), C.int(int32(i))))
@@ -3831,8 +3902,10 @@ func (ptr *QSqlQueryModel) __setItemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtSql_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQSqlQueryModelFromPointer(l.data).____setItemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQSqlQueryModelFromPointer(l.data).____setItemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QSqlQueryModel___setItemData_keyList(ptr.Pointer()))
@@ -3895,6 +3968,16 @@ func (ptr *QSqlQueryModel) __dataChanged_roles_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QSqlQueryModel___dataChanged_roles_newList(ptr.Pointer()))
 }
 
+func (ptr *QSqlQueryModel) __dataChanged_roles_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QSqlQueryModel___dataChanged_roles_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QSqlQueryModel) __dataChanged_roles_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QSqlQueryModel___dataChanged_roles_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QSqlQueryModel) __layoutAboutToBeChanged_parents_atList(i int) *core.QPersistentModelIndex {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQPersistentModelIndexFromPointer(C.QSqlQueryModel___layoutAboutToBeChanged_parents_atList(ptr.Pointer(), C.int(int32(i))))
@@ -3956,8 +4039,10 @@ func (ptr *QSqlQueryModel) __roleNames_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtSql_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQSqlQueryModelFromPointer(l.data).____roleNames_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQSqlQueryModelFromPointer(l.data).____roleNames_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QSqlQueryModel___roleNames_keyList(ptr.Pointer()))
@@ -3988,8 +4073,10 @@ func (ptr *QSqlQueryModel) __itemData_keyList() []int {
 	if ptr.Pointer() != nil {
 		return func(l C.struct_QtSql_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQSqlQueryModelFromPointer(l.data).____itemData_keyList_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQSqlQueryModelFromPointer(l.data).____itemData_keyList_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(C.QSqlQueryModel___itemData_keyList(ptr.Pointer()))
@@ -4071,6 +4158,16 @@ func (ptr *QSqlQueryModel) ____doSetRoleNames_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QSqlQueryModel_____doSetRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QSqlQueryModel) ____doSetRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QSqlQueryModel_____doSetRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QSqlQueryModel) ____doSetRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QSqlQueryModel_____doSetRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QSqlQueryModel) ____setRoleNames_keyList_atList(i int) int {
 	if ptr.Pointer() != nil {
 		return int(int32(C.QSqlQueryModel_____setRoleNames_keyList_atList(ptr.Pointer(), C.int(int32(i)))))
@@ -4088,6 +4185,16 @@ func (ptr *QSqlQueryModel) ____setRoleNames_keyList_newList() unsafe.Pointer {
 	return unsafe.Pointer(C.QSqlQueryModel_____setRoleNames_keyList_newList(ptr.Pointer()))
 }
 
+func (ptr *QSqlQueryModel) ____setRoleNames_keyList_newListBuffer(data unsafe.Pointer, count int) unsafe.Pointer {
+	return unsafe.Pointer(C.QSqlQueryModel_____setRoleNames_keyList_newListBuffer(ptr.Pointer(), data, C.int(int32(count))))
+}
+
+func (ptr *QSqlQueryModel) ____setRoleNames_keyList_fillList(data unsafe.Pointer) {
+	if ptr.Pointer() != nil {
+		C.QSqlQueryModel_____setRoleNames_keyList_fillList(ptr.Pointer(), data)
+	}
+}
+
 func (ptr *QSqlQueryModel) __dynamicPropertyNames_atList(i int) *core.QByteArray {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQByteArrayFromPointer(C.QSqlQueryModel___dynamicPropertyNames_atList(ptr.Pointer(), C.int(int32(i))))
@@ -4110,7 +4217,7 @@ func (ptr *QSqlQueryModel) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSqlQueryModel) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlQueryModel___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4131,7 +4238,7 @@ func (ptr *QSqlQueryModel) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSqlQueryModel) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlQueryModel___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4152,7 +4259,7 @@ func (ptr *QSqlQueryModel) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSqlQueryModel) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlQueryModel___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4173,7 +4280,7 @@ func (ptr *QSqlQueryModel) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSqlQueryModel) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlQueryModel___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4193,7 +4300,7 @@ func (ptr *QSqlQueryModel) __children_newList() unsafe.Pointer {
 
 //export callbackQSqlQueryModel_DropMimeData
 func callbackQSqlQueryModel_DropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QMimeData, core.Qt__DropAction, int, int, *core.QModelIndex) bool)(core.NewQMimeDataFromPointer(data), core.Qt__DropAction(action), int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -4209,7 +4316,7 @@ func (ptr *QSqlQueryModel) DropMimeDataDefault(data core.QMimeData_ITF, action c
 
 //export callbackQSqlQueryModel_Index
 func callbackQSqlQueryModel_Index(ptr unsafe.Pointer, row C.int, column C.int, parent unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "index"); signal != nil {
+	if signal := qt.GetSignal(ptr, "index"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(int, int, *core.QModelIndex) *core.QModelIndex)(int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))
 	}
 
@@ -4227,7 +4334,7 @@ func (ptr *QSqlQueryModel) IndexDefault(row int, column int, parent core.QModelI
 
 //export callbackQSqlQueryModel_Sibling
 func callbackQSqlQueryModel_Sibling(ptr unsafe.Pointer, row C.int, column C.int, idx unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sibling"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sibling"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(int, int, *core.QModelIndex) *core.QModelIndex)(int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(idx)))
 	}
 
@@ -4245,7 +4352,7 @@ func (ptr *QSqlQueryModel) SiblingDefault(row int, column int, idx core.QModelIn
 
 //export callbackQSqlQueryModel_Flags
 func callbackQSqlQueryModel_Flags(ptr unsafe.Pointer, index unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "flags"); signal != nil {
+	if signal := qt.GetSignal(ptr, "flags"); signal != nil {
 		return C.longlong(signal.(func(*core.QModelIndex) core.Qt__ItemFlag)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -4261,7 +4368,7 @@ func (ptr *QSqlQueryModel) FlagsDefault(index core.QModelIndex_ITF) core.Qt__Ite
 
 //export callbackQSqlQueryModel_InsertRows
 func callbackQSqlQueryModel_InsertRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(row)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -4277,7 +4384,7 @@ func (ptr *QSqlQueryModel) InsertRowsDefault(row int, count int, parent core.QMo
 
 //export callbackQSqlQueryModel_MoveColumns
 func callbackQSqlQueryModel_MoveColumns(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceColumn C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveColumns"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveColumns"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int) bool)(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceColumn)), int(int32(count)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -4293,7 +4400,7 @@ func (ptr *QSqlQueryModel) MoveColumnsDefault(sourceParent core.QModelIndex_ITF,
 
 //export callbackQSqlQueryModel_MoveRows
 func callbackQSqlQueryModel_MoveRows(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceRow C.int, count C.int, destinationParent unsafe.Pointer, destinationChild C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int) bool)(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceRow)), int(int32(count)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationChild))))))
 	}
 
@@ -4309,7 +4416,7 @@ func (ptr *QSqlQueryModel) MoveRowsDefault(sourceParent core.QModelIndex_ITF, so
 
 //export callbackQSqlQueryModel_RemoveRows
 func callbackQSqlQueryModel_RemoveRows(ptr unsafe.Pointer, row C.int, count C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "removeRows"); signal != nil {
+	if signal := qt.GetSignal(ptr, "removeRows"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, int, *core.QModelIndex) bool)(int(int32(row)), int(int32(count)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -4325,7 +4432,7 @@ func (ptr *QSqlQueryModel) RemoveRowsDefault(row int, count int, parent core.QMo
 
 //export callbackQSqlQueryModel_SetData
 func callbackQSqlQueryModel_SetData(ptr unsafe.Pointer, index unsafe.Pointer, value unsafe.Pointer, role C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, *core.QVariant, int) bool)(core.NewQModelIndexFromPointer(index), core.NewQVariantFromPointer(value), int(int32(role))))))
 	}
 
@@ -4341,7 +4448,7 @@ func (ptr *QSqlQueryModel) SetDataDefault(index core.QModelIndex_ITF, value core
 
 //export callbackQSqlQueryModel_SetItemData
 func callbackQSqlQueryModel_SetItemData(ptr unsafe.Pointer, index unsafe.Pointer, roles C.struct_QtSql_PackedList) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setItemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setItemData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex, map[int]*core.QVariant) bool)(core.NewQModelIndexFromPointer(index), func(l C.struct_QtSql_PackedList) map[int]*core.QVariant {
 			var out = make(map[int]*core.QVariant, int(l.len))
 			for _, i := range NewQSqlQueryModelFromPointer(l.data).__setItemData_keyList() {
@@ -4375,7 +4482,7 @@ func (ptr *QSqlQueryModel) SetItemDataDefault(index core.QModelIndex_ITF, roles
 
 //export callbackQSqlQueryModel_Submit
 func callbackQSqlQueryModel_Submit(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "submit"); signal != nil {
+	if signal := qt.GetSignal(ptr, "submit"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -4391,7 +4498,7 @@ func (ptr *QSqlQueryModel) SubmitDefault() bool {
 
 //export callbackQSqlQueryModel_ColumnsAboutToBeInserted
 func callbackQSqlQueryModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -4399,7 +4506,7 @@ func callbackQSqlQueryModel_ColumnsAboutToBeInserted(ptr unsafe.Pointer, parent
 
 //export callbackQSqlQueryModel_ColumnsAboutToBeMoved
 func callbackQSqlQueryModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationColumn C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationColumn)))
 	}
 
@@ -4407,7 +4514,7 @@ func callbackQSqlQueryModel_ColumnsAboutToBeMoved(ptr unsafe.Pointer, sourcePare
 
 //export callbackQSqlQueryModel_ColumnsAboutToBeRemoved
 func callbackQSqlQueryModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -4415,7 +4522,7 @@ func callbackQSqlQueryModel_ColumnsAboutToBeRemoved(ptr unsafe.Pointer, parent u
 
 //export callbackQSqlQueryModel_ColumnsInserted
 func callbackQSqlQueryModel_ColumnsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -4423,7 +4530,7 @@ func callbackQSqlQueryModel_ColumnsInserted(ptr unsafe.Pointer, parent unsafe.Po
 
 //export callbackQSqlQueryModel_ColumnsMoved
 func callbackQSqlQueryModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, column C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), core.NewQModelIndexFromPointer(destination), int(int32(column)))
 	}
 
@@ -4431,7 +4538,7 @@ func callbackQSqlQueryModel_ColumnsMoved(ptr unsafe.Pointer, parent unsafe.Point
 
 //export callbackQSqlQueryModel_ColumnsRemoved
 func callbackQSqlQueryModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnsRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -4439,11 +4546,13 @@ func callbackQSqlQueryModel_ColumnsRemoved(ptr unsafe.Pointer, parent unsafe.Poi
 
 //export callbackQSqlQueryModel_DataChanged
 func callbackQSqlQueryModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Pointer, bottomRight unsafe.Pointer, roles C.struct_QtSql_PackedList) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dataChanged"); signal != nil {
 		signal.(func(*core.QModelIndex, *core.QModelIndex, []int))(core.NewQModelIndexFromPointer(topLeft), core.NewQModelIndexFromPointer(bottomRight), func(l C.struct_QtSql_PackedList) []int {
 			var out = make([]int, int(l.len))
-			for i := 0; i < int(l.len); i++ {
-				out[i] = NewQSqlQueryModelFromPointer(l.data).__dataChanged_roles_atList(i)
+			var tmpList = make([]C.int, int(l.len)+1)
+			NewQSqlQueryModelFromPointer(l.data).__dataChanged_roles_fillList(unsafe.Pointer(&tmpList[0]))
+			for i, v := range tmpList[:len(out)] {
+				out[i] = int(int32(v))
 			}
 			return out
 		}(roles))
@@ -4453,7 +4562,7 @@ func callbackQSqlQueryModel_DataChanged(ptr unsafe.Pointer, topLeft unsafe.Point
 
 //export callbackQSqlQueryModel_HeaderDataChanged
 func callbackQSqlQueryModel_HeaderDataChanged(ptr unsafe.Pointer, orientation C.longlong, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "headerDataChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "headerDataChanged"); signal != nil {
 		signal.(func(core.Qt__Orientation, int, int))(core.Qt__Orientation(orientation), int(int32(first)), int(int32(last)))
 	}
 
@@ -4461,7 +4570,7 @@ func callbackQSqlQueryModel_HeaderDataChanged(ptr unsafe.Pointer, orientation C.
 
 //export callbackQSqlQueryModel_LayoutAboutToBeChanged
 func callbackQSqlQueryModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, parents C.struct_QtSql_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutAboutToBeChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutAboutToBeChanged"); signal != nil {
 		signal.(func([]*core.QPersistentModelIndex, core.QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtSql_PackedList) []*core.QPersistentModelIndex {
 			var out = make([]*core.QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -4475,7 +4584,7 @@ func callbackQSqlQueryModel_LayoutAboutToBeChanged(ptr unsafe.Pointer, parents C
 
 //export callbackQSqlQueryModel_LayoutChanged
 func callbackQSqlQueryModel_LayoutChanged(ptr unsafe.Pointer, parents C.struct_QtSql_PackedList, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "layoutChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "layoutChanged"); signal != nil {
 		signal.(func([]*core.QPersistentModelIndex, core.QAbstractItemModel__LayoutChangeHint))(func(l C.struct_QtSql_PackedList) []*core.QPersistentModelIndex {
 			var out = make([]*core.QPersistentModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -4489,7 +4598,7 @@ func callbackQSqlQueryModel_LayoutChanged(ptr unsafe.Pointer, parents C.struct_Q
 
 //export callbackQSqlQueryModel_ModelAboutToBeReset
 func callbackQSqlQueryModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelAboutToBeReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelAboutToBeReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4497,7 +4606,7 @@ func callbackQSqlQueryModel_ModelAboutToBeReset(ptr unsafe.Pointer) {
 
 //export callbackQSqlQueryModel_ModelReset
 func callbackQSqlQueryModel_ModelReset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "modelReset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "modelReset"); signal != nil {
 		signal.(func())()
 	}
 
@@ -4505,7 +4614,7 @@ func callbackQSqlQueryModel_ModelReset(ptr unsafe.Pointer) {
 
 //export callbackQSqlQueryModel_ResetInternalData
 func callbackQSqlQueryModel_ResetInternalData(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resetInternalData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resetInternalData"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).ResetInternalDataDefault()
@@ -4520,7 +4629,7 @@ func (ptr *QSqlQueryModel) ResetInternalDataDefault() {
 
 //export callbackQSqlQueryModel_Revert
 func callbackQSqlQueryModel_Revert(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "revert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "revert"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).RevertDefault()
@@ -4535,7 +4644,7 @@ func (ptr *QSqlQueryModel) RevertDefault() {
 
 //export callbackQSqlQueryModel_RowsAboutToBeInserted
 func callbackQSqlQueryModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)))
 	}
 
@@ -4543,7 +4652,7 @@ func callbackQSqlQueryModel_RowsAboutToBeInserted(ptr unsafe.Pointer, parent uns
 
 //export callbackQSqlQueryModel_RowsAboutToBeMoved
 func callbackQSqlQueryModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourceParent unsafe.Pointer, sourceStart C.int, sourceEnd C.int, destinationParent unsafe.Pointer, destinationRow C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(sourceParent), int(int32(sourceStart)), int(int32(sourceEnd)), core.NewQModelIndexFromPointer(destinationParent), int(int32(destinationRow)))
 	}
 
@@ -4551,7 +4660,7 @@ func callbackQSqlQueryModel_RowsAboutToBeMoved(ptr unsafe.Pointer, sourceParent
 
 //export callbackQSqlQueryModel_RowsAboutToBeRemoved
 func callbackQSqlQueryModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsAboutToBeRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsAboutToBeRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -4559,7 +4668,7 @@ func callbackQSqlQueryModel_RowsAboutToBeRemoved(ptr unsafe.Pointer, parent unsa
 
 //export callbackQSqlQueryModel_RowsInserted
 func callbackQSqlQueryModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsInserted"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsInserted"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -4567,7 +4676,7 @@ func callbackQSqlQueryModel_RowsInserted(ptr unsafe.Pointer, parent unsafe.Point
 
 //export callbackQSqlQueryModel_RowsMoved
 func callbackQSqlQueryModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Pointer, start C.int, end C.int, destination unsafe.Pointer, row C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsMoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsMoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int, *core.QModelIndex, int))(core.NewQModelIndexFromPointer(parent), int(int32(start)), int(int32(end)), core.NewQModelIndexFromPointer(destination), int(int32(row)))
 	}
 
@@ -4575,7 +4684,7 @@ func callbackQSqlQueryModel_RowsMoved(ptr unsafe.Pointer, parent unsafe.Pointer,
 
 //export callbackQSqlQueryModel_RowsRemoved
 func callbackQSqlQueryModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Pointer, first C.int, last C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rowsRemoved"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rowsRemoved"); signal != nil {
 		signal.(func(*core.QModelIndex, int, int))(core.NewQModelIndexFromPointer(parent), int(int32(first)), int(int32(last)))
 	}
 
@@ -4583,7 +4692,7 @@ func callbackQSqlQueryModel_RowsRemoved(ptr unsafe.Pointer, parent unsafe.Pointe
 
 //export callbackQSqlQueryModel_Sort
 func callbackQSqlQueryModel_Sort(ptr unsafe.Pointer, column C.int, order C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sort"); signal != nil {
 		signal.(func(int, core.Qt__SortOrder))(int(int32(column)), core.Qt__SortOrder(order))
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).SortDefault(int(int32(column)), core.Qt__SortOrder(order))
@@ -4598,7 +4707,7 @@ func (ptr *QSqlQueryModel) SortDefault(column int, order core.Qt__SortOrder) {
 
 //export callbackQSqlQueryModel_RoleNames
 func callbackQSqlQueryModel_RoleNames(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "roleNames"); signal != nil {
+	if signal := qt.GetSignal(ptr, "roleNames"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQSqlQueryModelFromPointer(NewQSqlQueryModelFromPointer(nil).__roleNames_newList())
 			for k, v := range signal.(func() map[int]*core.QByteArray)() {
@@ -4632,7 +4741,7 @@ func (ptr *QSqlQueryModel) RoleNamesDefault() map[int]*core.QByteArray {
 
 //export callbackQSqlQueryModel_ItemData
 func callbackQSqlQueryModel_ItemData(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemData"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQSqlQueryModelFromPointer(NewQSqlQueryModelFromPointer(nil).__itemData_newList())
 			for k, v := range signal.(func(*core.QModelIndex) map[int]*core.QVariant)(core.NewQModelIndexFromPointer(index)) {
@@ -4666,7 +4775,7 @@ func (ptr *QSqlQueryModel) ItemDataDefault(index core.QModelIndex_ITF) map[int]*
 
 //export callbackQSqlQueryModel_MimeData
 func callbackQSqlQueryModel_MimeData(ptr unsafe.Pointer, indexes C.struct_QtSql_PackedList) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mimeData"); signal != nil {
 		return core.PointerFromQMimeData(signal.(func([]*core.QModelIndex) *core.QMimeData)(func(l C.struct_QtSql_PackedList) []*core.QModelIndex {
 			var out = make([]*core.QModelIndex, int(l.len))
 			for i := 0; i < int(l.len); i++ {
@@ -4694,7 +4803,7 @@ func (ptr *QSqlQueryModel) MimeDataDefault(indexes []*core.QModelIndex) *core.QM
 			}
 			return tmpList.Pointer()
 		}()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -4704,7 +4813,7 @@ func (ptr *QSqlQueryModel) MimeDataDefault(indexes []*core.QModelIndex) *core.QM
 
 //export callbackQSqlQueryModel_Buddy
 func callbackQSqlQueryModel_Buddy(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "buddy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "buddy"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QModelIndex) *core.QModelIndex)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -4722,7 +4831,7 @@ func (ptr *QSqlQueryModel) BuddyDefault(index core.QModelIndex_ITF) *core.QModel
 
 //export callbackQSqlQueryModel_Parent
 func callbackQSqlQueryModel_Parent(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parent"); signal != nil {
 		return core.PointerFromQModelIndex(signal.(func(*core.QModelIndex) *core.QModelIndex)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -4740,7 +4849,7 @@ func (ptr *QSqlQueryModel) ParentDefault(index core.QModelIndex_ITF) *core.QMode
 
 //export callbackQSqlQueryModel_Match
 func callbackQSqlQueryModel_Match(ptr unsafe.Pointer, start unsafe.Pointer, role C.int, value unsafe.Pointer, hits C.int, flags C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "match"); signal != nil {
+	if signal := qt.GetSignal(ptr, "match"); signal != nil {
 		return func() unsafe.Pointer {
 			var tmpList = NewQSqlQueryModelFromPointer(NewQSqlQueryModelFromPointer(nil).__match_newList())
 			for _, v := range signal.(func(*core.QModelIndex, int, *core.QVariant, int, core.Qt__MatchFlag) []*core.QModelIndex)(core.NewQModelIndexFromPointer(start), int(int32(role)), core.NewQVariantFromPointer(value), int(int32(hits)), core.Qt__MatchFlag(flags)) {
@@ -4774,7 +4883,7 @@ func (ptr *QSqlQueryModel) MatchDefault(start core.QModelIndex_ITF, role int, va
 
 //export callbackQSqlQueryModel_Span
 func callbackQSqlQueryModel_Span(ptr unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "span"); signal != nil {
+	if signal := qt.GetSignal(ptr, "span"); signal != nil {
 		return core.PointerFromQSize(signal.(func(*core.QModelIndex) *core.QSize)(core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -4792,23 +4901,23 @@ func (ptr *QSqlQueryModel) SpanDefault(index core.QModelIndex_ITF) *core.QSize {
 
 //export callbackQSqlQueryModel_MimeTypes
 func callbackQSqlQueryModel_MimeTypes(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mimeTypes"); signal != nil {
-		return C.CString(strings.Join(signal.(func() []string)(), "|"))
+	if signal := qt.GetSignal(ptr, "mimeTypes"); signal != nil {
+		return cGoPackStringList(signal.(func() []string)())
 	}
 
-	return C.CString(strings.Join(NewQSqlQueryModelFromPointer(ptr).MimeTypesDefault(), "|"))
+	return cGoPackStringList(NewQSqlQueryModelFromPointer(ptr).MimeTypesDefault())
 }
 
 func (ptr *QSqlQueryModel) MimeTypesDefault() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QSqlQueryModel_MimeTypesDefault(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QSqlQueryModel_MimeTypesDefault(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
 
 //export callbackQSqlQueryModel_SupportedDragActions
 func callbackQSqlQueryModel_SupportedDragActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDragActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDragActions"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__DropAction)())
 	}
 
@@ -4824,7 +4933,7 @@ func (ptr *QSqlQueryModel) SupportedDragActionsDefault() core.Qt__DropAction {
 
 //export callbackQSqlQueryModel_SupportedDropActions
 func callbackQSqlQueryModel_SupportedDropActions(ptr unsafe.Pointer) C.longlong {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "supportedDropActions"); signal != nil {
+	if signal := qt.GetSignal(ptr, "supportedDropActions"); signal != nil {
 		return C.longlong(signal.(func() core.Qt__DropAction)())
 	}
 
@@ -4840,7 +4949,7 @@ func (ptr *QSqlQueryModel) SupportedDropActionsDefault() core.Qt__DropAction {
 
 //export callbackQSqlQueryModel_CanDropMimeData
 func callbackQSqlQueryModel_CanDropMimeData(ptr unsafe.Pointer, data unsafe.Pointer, action C.longlong, row C.int, column C.int, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "canDropMimeData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "canDropMimeData"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QMimeData, core.Qt__DropAction, int, int, *core.QModelIndex) bool)(core.NewQMimeDataFromPointer(data), core.Qt__DropAction(action), int(int32(row)), int(int32(column)), core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -4856,7 +4965,7 @@ func (ptr *QSqlQueryModel) CanDropMimeDataDefault(data core.QMimeData_ITF, actio
 
 //export callbackQSqlQueryModel_HasChildren
 func callbackQSqlQueryModel_HasChildren(ptr unsafe.Pointer, parent unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasChildren"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasChildren"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QModelIndex) bool)(core.NewQModelIndexFromPointer(parent)))))
 	}
 
@@ -4872,7 +4981,7 @@ func (ptr *QSqlQueryModel) HasChildrenDefault(parent core.QModelIndex_ITF) bool
 
 //export callbackQSqlQueryModel_Event
 func callbackQSqlQueryModel_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -4888,7 +4997,7 @@ func (ptr *QSqlQueryModel) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSqlQueryModel_EventFilter
 func callbackQSqlQueryModel_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -4904,7 +5013,7 @@ func (ptr *QSqlQueryModel) EventFilterDefault(watched core.QObject_ITF, event co
 
 //export callbackQSqlQueryModel_ChildEvent
 func callbackQSqlQueryModel_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -4919,7 +5028,7 @@ func (ptr *QSqlQueryModel) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSqlQueryModel_ConnectNotify
 func callbackQSqlQueryModel_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4934,7 +5043,7 @@ func (ptr *QSqlQueryModel) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSqlQueryModel_CustomEvent
 func callbackQSqlQueryModel_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -4949,7 +5058,7 @@ func (ptr *QSqlQueryModel) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSqlQueryModel_DeleteLater
 func callbackQSqlQueryModel_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).DeleteLaterDefault()
@@ -4959,14 +5068,14 @@ func callbackQSqlQueryModel_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSqlQueryModel) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSqlQueryModel_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSqlQueryModel_Destroyed
 func callbackQSqlQueryModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -4974,7 +5083,7 @@ func callbackQSqlQueryModel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSqlQueryModel_DisconnectNotify
 func callbackQSqlQueryModel_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -4989,7 +5098,7 @@ func (ptr *QSqlQueryModel) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSqlQueryModel_ObjectNameChanged
 func callbackQSqlQueryModel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSql_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -4997,7 +5106,7 @@ func callbackQSqlQueryModel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.s
 
 //export callbackQSqlQueryModel_TimerEvent
 func callbackQSqlQueryModel_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSqlQueryModelFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -5012,7 +5121,7 @@ func (ptr *QSqlQueryModel) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSqlQueryModel_MetaObject
 func callbackQSqlQueryModel_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -5417,7 +5526,7 @@ func NewQSqlRelationalDelegateFromPointer(ptr unsafe.Pointer) *QSqlRelationalDel
 }
 func NewQSqlRelationalDelegate(parent core.QObject_ITF) *QSqlRelationalDelegate {
 	var tmpValue = NewQSqlRelationalDelegateFromPointer(C.QSqlRelationalDelegate_NewQSqlRelationalDelegate(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5426,14 +5535,14 @@ func NewQSqlRelationalDelegate(parent core.QObject_ITF) *QSqlRelationalDelegate
 func (ptr *QSqlRelationalDelegate) DestroyQSqlRelationalDelegate() {
 	if ptr.Pointer() != nil {
 		C.QSqlRelationalDelegate_DestroyQSqlRelationalDelegate(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSqlRelationalDelegate_CreateEditor
 func callbackQSqlRelationalDelegate_CreateEditor(ptr unsafe.Pointer, parent unsafe.Pointer, option unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "createEditor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "createEditor"); signal != nil {
 		return widgets.PointerFromQWidget(signal.(func(*widgets.QWidget, *widgets.QStyleOptionViewItem, *core.QModelIndex) *widgets.QWidget)(widgets.NewQWidgetFromPointer(parent), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -5443,7 +5552,7 @@ func callbackQSqlRelationalDelegate_CreateEditor(ptr unsafe.Pointer, parent unsa
 func (ptr *QSqlRelationalDelegate) CreateEditorDefault(parent widgets.QWidget_ITF, option widgets.QStyleOptionViewItem_ITF, index core.QModelIndex_ITF) *widgets.QWidget {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQWidgetFromPointer(C.QSqlRelationalDelegate_CreateEditorDefault(ptr.Pointer(), widgets.PointerFromQWidget(parent), widgets.PointerFromQStyleOptionViewItem(option), core.PointerFromQModelIndex(index)))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5453,7 +5562,7 @@ func (ptr *QSqlRelationalDelegate) CreateEditorDefault(parent widgets.QWidget_IT
 
 //export callbackQSqlRelationalDelegate_SetModelData
 func callbackQSqlRelationalDelegate_SetModelData(ptr unsafe.Pointer, editor unsafe.Pointer, model unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setModelData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setModelData"); signal != nil {
 		signal.(func(*widgets.QWidget, *core.QAbstractItemModel, *core.QModelIndex))(widgets.NewQWidgetFromPointer(editor), core.NewQAbstractItemModelFromPointer(model), core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).SetModelDataDefault(widgets.NewQWidgetFromPointer(editor), core.NewQAbstractItemModelFromPointer(model), core.NewQModelIndexFromPointer(index))
@@ -5488,7 +5597,7 @@ func (ptr *QSqlRelationalDelegate) __dynamicPropertyNames_newList() unsafe.Point
 func (ptr *QSqlRelationalDelegate) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlRelationalDelegate___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5509,7 +5618,7 @@ func (ptr *QSqlRelationalDelegate) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSqlRelationalDelegate) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlRelationalDelegate___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5530,7 +5639,7 @@ func (ptr *QSqlRelationalDelegate) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSqlRelationalDelegate) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlRelationalDelegate___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5551,7 +5660,7 @@ func (ptr *QSqlRelationalDelegate) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSqlRelationalDelegate) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSqlRelationalDelegate___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -5571,7 +5680,7 @@ func (ptr *QSqlRelationalDelegate) __children_newList() unsafe.Pointer {
 
 //export callbackQSqlRelationalDelegate_EditorEvent
 func callbackQSqlRelationalDelegate_EditorEvent(ptr unsafe.Pointer, event unsafe.Pointer, model unsafe.Pointer, option unsafe.Pointer, index unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "editorEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "editorEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent, *core.QAbstractItemModel, *widgets.QStyleOptionViewItem, *core.QModelIndex) bool)(core.NewQEventFromPointer(event), core.NewQAbstractItemModelFromPointer(model), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index)))))
 	}
 
@@ -5587,7 +5696,7 @@ func (ptr *QSqlRelationalDelegate) EditorEventDefault(event core.QEvent_ITF, mod
 
 //export callbackQSqlRelationalDelegate_EventFilter
 func callbackQSqlRelationalDelegate_EventFilter(ptr unsafe.Pointer, editor unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(editor), core.NewQEventFromPointer(event)))))
 	}
 
@@ -5603,7 +5712,7 @@ func (ptr *QSqlRelationalDelegate) EventFilterDefault(editor core.QObject_ITF, e
 
 //export callbackQSqlRelationalDelegate_SizeHint
 func callbackQSqlRelationalDelegate_SizeHint(ptr unsafe.Pointer, option unsafe.Pointer, index unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func(*widgets.QStyleOptionViewItem, *core.QModelIndex) *core.QSize)(widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index)))
 	}
 
@@ -5621,7 +5730,7 @@ func (ptr *QSqlRelationalDelegate) SizeHintDefault(option widgets.QStyleOptionVi
 
 //export callbackQSqlRelationalDelegate_DrawCheck
 func callbackQSqlRelationalDelegate_DrawCheck(ptr unsafe.Pointer, painter unsafe.Pointer, option unsafe.Pointer, rect unsafe.Pointer, state C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawCheck"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawCheck"); signal != nil {
 		signal.(func(*gui.QPainter, *widgets.QStyleOptionViewItem, *core.QRect, core.Qt__CheckState))(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQRectFromPointer(rect), core.Qt__CheckState(state))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).DrawCheckDefault(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQRectFromPointer(rect), core.Qt__CheckState(state))
@@ -5636,7 +5745,7 @@ func (ptr *QSqlRelationalDelegate) DrawCheckDefault(painter gui.QPainter_ITF, op
 
 //export callbackQSqlRelationalDelegate_DrawDecoration
 func callbackQSqlRelationalDelegate_DrawDecoration(ptr unsafe.Pointer, painter unsafe.Pointer, option unsafe.Pointer, rect unsafe.Pointer, pixmap unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawDecoration"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawDecoration"); signal != nil {
 		signal.(func(*gui.QPainter, *widgets.QStyleOptionViewItem, *core.QRect, *gui.QPixmap))(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQRectFromPointer(rect), gui.NewQPixmapFromPointer(pixmap))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).DrawDecorationDefault(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQRectFromPointer(rect), gui.NewQPixmapFromPointer(pixmap))
@@ -5651,7 +5760,7 @@ func (ptr *QSqlRelationalDelegate) DrawDecorationDefault(painter gui.QPainter_IT
 
 //export callbackQSqlRelationalDelegate_DrawDisplay
 func callbackQSqlRelationalDelegate_DrawDisplay(ptr unsafe.Pointer, painter unsafe.Pointer, option unsafe.Pointer, rect unsafe.Pointer, text C.struct_QtSql_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawDisplay"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawDisplay"); signal != nil {
 		signal.(func(*gui.QPainter, *widgets.QStyleOptionViewItem, *core.QRect, string))(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQRectFromPointer(rect), cGoUnpackString(text))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).DrawDisplayDefault(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQRectFromPointer(rect), cGoUnpackString(text))
@@ -5668,7 +5777,7 @@ func (ptr *QSqlRelationalDelegate) DrawDisplayDefault(painter gui.QPainter_ITF,
 
 //export callbackQSqlRelationalDelegate_DrawFocus
 func callbackQSqlRelationalDelegate_DrawFocus(ptr unsafe.Pointer, painter unsafe.Pointer, option unsafe.Pointer, rect unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "drawFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "drawFocus"); signal != nil {
 		signal.(func(*gui.QPainter, *widgets.QStyleOptionViewItem, *core.QRect))(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQRectFromPointer(rect))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).DrawFocusDefault(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQRectFromPointer(rect))
@@ -5683,7 +5792,7 @@ func (ptr *QSqlRelationalDelegate) DrawFocusDefault(painter gui.QPainter_ITF, op
 
 //export callbackQSqlRelationalDelegate_Paint
 func callbackQSqlRelationalDelegate_Paint(ptr unsafe.Pointer, painter unsafe.Pointer, option unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paint"); signal != nil {
 		signal.(func(*gui.QPainter, *widgets.QStyleOptionViewItem, *core.QModelIndex))(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).PaintDefault(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index))
@@ -5698,7 +5807,7 @@ func (ptr *QSqlRelationalDelegate) PaintDefault(painter gui.QPainter_ITF, option
 
 //export callbackQSqlRelationalDelegate_SetEditorData
 func callbackQSqlRelationalDelegate_SetEditorData(ptr unsafe.Pointer, editor unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEditorData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEditorData"); signal != nil {
 		signal.(func(*widgets.QWidget, *core.QModelIndex))(widgets.NewQWidgetFromPointer(editor), core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).SetEditorDataDefault(widgets.NewQWidgetFromPointer(editor), core.NewQModelIndexFromPointer(index))
@@ -5713,7 +5822,7 @@ func (ptr *QSqlRelationalDelegate) SetEditorDataDefault(editor widgets.QWidget_I
 
 //export callbackQSqlRelationalDelegate_UpdateEditorGeometry
 func callbackQSqlRelationalDelegate_UpdateEditorGeometry(ptr unsafe.Pointer, editor unsafe.Pointer, option unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateEditorGeometry"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateEditorGeometry"); signal != nil {
 		signal.(func(*widgets.QWidget, *widgets.QStyleOptionViewItem, *core.QModelIndex))(widgets.NewQWidgetFromPointer(editor), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).UpdateEditorGeometryDefault(widgets.NewQWidgetFromPointer(editor), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index))
@@ -5728,7 +5837,7 @@ func (ptr *QSqlRelationalDelegate) UpdateEditorGeometryDefault(editor widgets.QW
 
 //export callbackQSqlRelationalDelegate_HelpEvent
 func callbackQSqlRelationalDelegate_HelpEvent(ptr unsafe.Pointer, event unsafe.Pointer, view unsafe.Pointer, option unsafe.Pointer, index unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "helpEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "helpEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*gui.QHelpEvent, *widgets.QAbstractItemView, *widgets.QStyleOptionViewItem, *core.QModelIndex) bool)(gui.NewQHelpEventFromPointer(event), widgets.NewQAbstractItemViewFromPointer(view), widgets.NewQStyleOptionViewItemFromPointer(option), core.NewQModelIndexFromPointer(index)))))
 	}
 
@@ -5744,7 +5853,7 @@ func (ptr *QSqlRelationalDelegate) HelpEventDefault(event gui.QHelpEvent_ITF, vi
 
 //export callbackQSqlRelationalDelegate_CloseEditor
 func callbackQSqlRelationalDelegate_CloseEditor(ptr unsafe.Pointer, editor unsafe.Pointer, hint C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEditor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEditor"); signal != nil {
 		signal.(func(*widgets.QWidget, widgets.QAbstractItemDelegate__EndEditHint))(widgets.NewQWidgetFromPointer(editor), widgets.QAbstractItemDelegate__EndEditHint(hint))
 	}
 
@@ -5752,7 +5861,7 @@ func callbackQSqlRelationalDelegate_CloseEditor(ptr unsafe.Pointer, editor unsaf
 
 //export callbackQSqlRelationalDelegate_CommitData
 func callbackQSqlRelationalDelegate_CommitData(ptr unsafe.Pointer, editor unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "commitData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "commitData"); signal != nil {
 		signal.(func(*widgets.QWidget))(widgets.NewQWidgetFromPointer(editor))
 	}
 
@@ -5760,7 +5869,7 @@ func callbackQSqlRelationalDelegate_CommitData(ptr unsafe.Pointer, editor unsafe
 
 //export callbackQSqlRelationalDelegate_SizeHintChanged
 func callbackQSqlRelationalDelegate_SizeHintChanged(ptr unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHintChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHintChanged"); signal != nil {
 		signal.(func(*core.QModelIndex))(core.NewQModelIndexFromPointer(index))
 	}
 
@@ -5768,7 +5877,7 @@ func callbackQSqlRelationalDelegate_SizeHintChanged(ptr unsafe.Pointer, index un
 
 //export callbackQSqlRelationalDelegate_DestroyEditor
 func callbackQSqlRelationalDelegate_DestroyEditor(ptr unsafe.Pointer, editor unsafe.Pointer, index unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyEditor"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyEditor"); signal != nil {
 		signal.(func(*widgets.QWidget, *core.QModelIndex))(widgets.NewQWidgetFromPointer(editor), core.NewQModelIndexFromPointer(index))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).DestroyEditorDefault(widgets.NewQWidgetFromPointer(editor), core.NewQModelIndexFromPointer(index))
@@ -5783,7 +5892,7 @@ func (ptr *QSqlRelationalDelegate) DestroyEditorDefault(editor widgets.QWidget_I
 
 //export callbackQSqlRelationalDelegate_Event
 func callbackQSqlRelationalDelegate_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -5799,7 +5908,7 @@ func (ptr *QSqlRelationalDelegate) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSqlRelationalDelegate_ChildEvent
 func callbackQSqlRelationalDelegate_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -5814,7 +5923,7 @@ func (ptr *QSqlRelationalDelegate) ChildEventDefault(event core.QChildEvent_ITF)
 
 //export callbackQSqlRelationalDelegate_ConnectNotify
 func callbackQSqlRelationalDelegate_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5829,7 +5938,7 @@ func (ptr *QSqlRelationalDelegate) ConnectNotifyDefault(sign core.QMetaMethod_IT
 
 //export callbackQSqlRelationalDelegate_CustomEvent
 func callbackQSqlRelationalDelegate_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -5844,7 +5953,7 @@ func (ptr *QSqlRelationalDelegate) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSqlRelationalDelegate_DeleteLater
 func callbackQSqlRelationalDelegate_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).DeleteLaterDefault()
@@ -5854,14 +5963,14 @@ func callbackQSqlRelationalDelegate_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSqlRelationalDelegate) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSqlRelationalDelegate_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSqlRelationalDelegate_Destroyed
 func callbackQSqlRelationalDelegate_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -5869,7 +5978,7 @@ func callbackQSqlRelationalDelegate_Destroyed(ptr unsafe.Pointer, obj unsafe.Poi
 
 //export callbackQSqlRelationalDelegate_DisconnectNotify
 func callbackQSqlRelationalDelegate_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -5884,7 +5993,7 @@ func (ptr *QSqlRelationalDelegate) DisconnectNotifyDefault(sign core.QMetaMethod
 
 //export callbackQSqlRelationalDelegate_ObjectNameChanged
 func callbackQSqlRelationalDelegate_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSql_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -5892,7 +6001,7 @@ func callbackQSqlRelationalDelegate_ObjectNameChanged(ptr unsafe.Pointer, object
 
 //export callbackQSqlRelationalDelegate_TimerEvent
 func callbackQSqlRelationalDelegate_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSqlRelationalDelegateFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -5907,7 +6016,7 @@ func (ptr *QSqlRelationalDelegate) TimerEventDefault(event core.QTimerEvent_ITF)
 
 //export callbackQSqlRelationalDelegate_MetaObject
 func callbackQSqlRelationalDelegate_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -5971,7 +6080,7 @@ const (
 
 func NewQSqlRelationalTableModel(parent core.QObject_ITF, db QSqlDatabase_ITF) *QSqlRelationalTableModel {
 	var tmpValue = NewQSqlRelationalTableModelFromPointer(C.QSqlRelationalTableModel_NewQSqlRelationalTableModel(core.PointerFromQObject(parent), PointerFromQSqlDatabase(db)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -5979,7 +6088,7 @@ func NewQSqlRelationalTableModel(parent core.QObject_ITF, db QSqlDatabase_ITF) *
 
 //export callbackQSqlRelationalTableModel_Select
 func callbackQSqlRelationalTableModel_Select(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "select"); signal != nil {
+	if signal := qt.GetSignal(ptr, "select"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5989,14 +6098,14 @@ func callbackQSqlRelationalTableModel_Select(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlRelationalTableModel) ConnectSelect(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "select", f)
+		qt.ConnectSignal(ptr.Pointer(), "select", f)
 	}
 }
 
 func (ptr *QSqlRelationalTableModel) DisconnectSelect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "select")
+		qt.DisconnectSignal(ptr.Pointer(), "select")
 	}
 }
 
@@ -6016,7 +6125,7 @@ func (ptr *QSqlRelationalTableModel) SelectDefault() bool {
 
 //export callbackQSqlRelationalTableModel_RevertRow
 func callbackQSqlRelationalTableModel_RevertRow(ptr unsafe.Pointer, row C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "revertRow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "revertRow"); signal != nil {
 		signal.(func(int))(int(int32(row)))
 	} else {
 		NewQSqlRelationalTableModelFromPointer(ptr).RevertRowDefault(int(int32(row)))
@@ -6026,14 +6135,14 @@ func callbackQSqlRelationalTableModel_RevertRow(ptr unsafe.Pointer, row C.int) {
 func (ptr *QSqlRelationalTableModel) ConnectRevertRow(f func(row int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "revertRow", f)
+		qt.ConnectSignal(ptr.Pointer(), "revertRow", f)
 	}
 }
 
 func (ptr *QSqlRelationalTableModel) DisconnectRevertRow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "revertRow")
+		qt.DisconnectSignal(ptr.Pointer(), "revertRow")
 	}
 }
 
@@ -6057,7 +6166,7 @@ func (ptr *QSqlRelationalTableModel) SetJoinMode(joinMode QSqlRelationalTableMod
 
 //export callbackQSqlRelationalTableModel_SetRelation
 func callbackQSqlRelationalTableModel_SetRelation(ptr unsafe.Pointer, column C.int, relation unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setRelation"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setRelation"); signal != nil {
 		signal.(func(int, *QSqlRelation))(int(int32(column)), NewQSqlRelationFromPointer(relation))
 	} else {
 		NewQSqlRelationalTableModelFromPointer(ptr).SetRelationDefault(int(int32(column)), NewQSqlRelationFromPointer(relation))
@@ -6067,14 +6176,14 @@ func callbackQSqlRelationalTableModel_SetRelation(ptr unsafe.Pointer, column C.i
 func (ptr *QSqlRelationalTableModel) ConnectSetRelation(f func(column int, relation *QSqlRelation)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setRelation", f)
+		qt.ConnectSignal(ptr.Pointer(), "setRelation", f)
 	}
 }
 
 func (ptr *QSqlRelationalTableModel) DisconnectSetRelation() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setRelation")
+		qt.DisconnectSignal(ptr.Pointer(), "setRelation")
 	}
 }
 
@@ -6092,7 +6201,7 @@ func (ptr *QSqlRelationalTableModel) SetRelationDefault(column int, relation QSq
 
 //export callbackQSqlRelationalTableModel_DestroyQSqlRelationalTableModel
 func callbackQSqlRelationalTableModel_DestroyQSqlRelationalTableModel(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSqlRelationalTableModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSqlRelationalTableModel"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlRelationalTableModelFromPointer(ptr).DestroyQSqlRelationalTableModelDefault()
@@ -6102,21 +6211,21 @@ func callbackQSqlRelationalTableModel_DestroyQSqlRelationalTableModel(ptr unsafe
 func (ptr *QSqlRelationalTableModel) ConnectDestroyQSqlRelationalTableModel(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlRelationalTableModel", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSqlRelationalTableModel", f)
 	}
 }
 
 func (ptr *QSqlRelationalTableModel) DisconnectDestroyQSqlRelationalTableModel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlRelationalTableModel")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSqlRelationalTableModel")
 	}
 }
 
 func (ptr *QSqlRelationalTableModel) DestroyQSqlRelationalTableModel() {
 	if ptr.Pointer() != nil {
 		C.QSqlRelationalTableModel_DestroyQSqlRelationalTableModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6124,7 +6233,7 @@ func (ptr *QSqlRelationalTableModel) DestroyQSqlRelationalTableModel() {
 func (ptr *QSqlRelationalTableModel) DestroyQSqlRelationalTableModelDefault() {
 	if ptr.Pointer() != nil {
 		C.QSqlRelationalTableModel_DestroyQSqlRelationalTableModelDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6140,7 +6249,7 @@ func (ptr *QSqlRelationalTableModel) Relation(column int) *QSqlRelation {
 
 //export callbackQSqlRelationalTableModel_RelationModel
 func callbackQSqlRelationalTableModel_RelationModel(ptr unsafe.Pointer, column C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "relationModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "relationModel"); signal != nil {
 		return PointerFromQSqlTableModel(signal.(func(int) *QSqlTableModel)(int(int32(column))))
 	}
 
@@ -6150,21 +6259,21 @@ func callbackQSqlRelationalTableModel_RelationModel(ptr unsafe.Pointer, column C
 func (ptr *QSqlRelationalTableModel) ConnectRelationModel(f func(column int) *QSqlTableModel) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "relationModel", f)
+		qt.ConnectSignal(ptr.Pointer(), "relationModel", f)
 	}
 }
 
 func (ptr *QSqlRelationalTableModel) DisconnectRelationModel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "relationModel")
+		qt.DisconnectSignal(ptr.Pointer(), "relationModel")
 	}
 }
 
 func (ptr *QSqlRelationalTableModel) RelationModel(column int) *QSqlTableModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSqlTableModelFromPointer(C.QSqlRelationalTableModel_RelationModel(ptr.Pointer(), C.int(int32(column))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6175,7 +6284,7 @@ func (ptr *QSqlRelationalTableModel) RelationModel(column int) *QSqlTableModel {
 func (ptr *QSqlRelationalTableModel) RelationModelDefault(column int) *QSqlTableModel {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSqlTableModelFromPointer(C.QSqlRelationalTableModel_RelationModelDefault(ptr.Pointer(), C.int(int32(column))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -6236,7 +6345,7 @@ func NewQSqlResult(db QSqlDriver_ITF) *QSqlResult {
 
 //export callbackQSqlResult_Data
 func callbackQSqlResult_Data(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(int) *core.QVariant)(int(int32(index))))
 	}
 
@@ -6246,14 +6355,14 @@ func callbackQSqlResult_Data(ptr unsafe.Pointer, index C.int) unsafe.Pointer {
 func (ptr *QSqlResult) ConnectData(f func(index int) *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
@@ -6268,7 +6377,7 @@ func (ptr *QSqlResult) Data(index int) *core.QVariant {
 
 //export callbackQSqlResult_Exec
 func callbackQSqlResult_Exec(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "exec"); signal != nil {
+	if signal := qt.GetSignal(ptr, "exec"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6278,14 +6387,14 @@ func callbackQSqlResult_Exec(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlResult) ConnectExec(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "exec", f)
+		qt.ConnectSignal(ptr.Pointer(), "exec", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectExec() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "exec")
+		qt.DisconnectSignal(ptr.Pointer(), "exec")
 	}
 }
 
@@ -6305,7 +6414,7 @@ func (ptr *QSqlResult) ExecDefault() bool {
 
 //export callbackQSqlResult_Fetch
 func callbackQSqlResult_Fetch(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetch"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetch"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -6315,14 +6424,14 @@ func callbackQSqlResult_Fetch(ptr unsafe.Pointer, index C.int) C.char {
 func (ptr *QSqlResult) ConnectFetch(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fetch", f)
+		qt.ConnectSignal(ptr.Pointer(), "fetch", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectFetch() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fetch")
+		qt.DisconnectSignal(ptr.Pointer(), "fetch")
 	}
 }
 
@@ -6335,7 +6444,7 @@ func (ptr *QSqlResult) Fetch(index int) bool {
 
 //export callbackQSqlResult_FetchFirst
 func callbackQSqlResult_FetchFirst(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchFirst"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchFirst"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6345,14 +6454,14 @@ func callbackQSqlResult_FetchFirst(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlResult) ConnectFetchFirst(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fetchFirst", f)
+		qt.ConnectSignal(ptr.Pointer(), "fetchFirst", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectFetchFirst() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fetchFirst")
+		qt.DisconnectSignal(ptr.Pointer(), "fetchFirst")
 	}
 }
 
@@ -6365,7 +6474,7 @@ func (ptr *QSqlResult) FetchFirst() bool {
 
 //export callbackQSqlResult_FetchLast
 func callbackQSqlResult_FetchLast(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchLast"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchLast"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6375,14 +6484,14 @@ func callbackQSqlResult_FetchLast(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlResult) ConnectFetchLast(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fetchLast", f)
+		qt.ConnectSignal(ptr.Pointer(), "fetchLast", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectFetchLast() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fetchLast")
+		qt.DisconnectSignal(ptr.Pointer(), "fetchLast")
 	}
 }
 
@@ -6395,7 +6504,7 @@ func (ptr *QSqlResult) FetchLast() bool {
 
 //export callbackQSqlResult_FetchNext
 func callbackQSqlResult_FetchNext(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchNext"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchNext"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6405,14 +6514,14 @@ func callbackQSqlResult_FetchNext(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlResult) ConnectFetchNext(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fetchNext", f)
+		qt.ConnectSignal(ptr.Pointer(), "fetchNext", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectFetchNext() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fetchNext")
+		qt.DisconnectSignal(ptr.Pointer(), "fetchNext")
 	}
 }
 
@@ -6432,7 +6541,7 @@ func (ptr *QSqlResult) FetchNextDefault() bool {
 
 //export callbackQSqlResult_FetchPrevious
 func callbackQSqlResult_FetchPrevious(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchPrevious"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchPrevious"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -6442,14 +6551,14 @@ func callbackQSqlResult_FetchPrevious(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlResult) ConnectFetchPrevious(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fetchPrevious", f)
+		qt.ConnectSignal(ptr.Pointer(), "fetchPrevious", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectFetchPrevious() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fetchPrevious")
+		qt.DisconnectSignal(ptr.Pointer(), "fetchPrevious")
 	}
 }
 
@@ -6469,7 +6578,7 @@ func (ptr *QSqlResult) FetchPreviousDefault() bool {
 
 //export callbackQSqlResult_IsNull
 func callbackQSqlResult_IsNull(ptr unsafe.Pointer, index C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isNull"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isNull"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(index))))))
 	}
 
@@ -6479,14 +6588,14 @@ func callbackQSqlResult_IsNull(ptr unsafe.Pointer, index C.int) C.char {
 func (ptr *QSqlResult) ConnectIsNull(f func(index int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "isNull", f)
+		qt.ConnectSignal(ptr.Pointer(), "isNull", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectIsNull() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "isNull")
+		qt.DisconnectSignal(ptr.Pointer(), "isNull")
 	}
 }
 
@@ -6499,7 +6608,7 @@ func (ptr *QSqlResult) IsNull(index int) bool {
 
 //export callbackQSqlResult_Prepare
 func callbackQSqlResult_Prepare(ptr unsafe.Pointer, query C.struct_QtSql_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "prepare"); signal != nil {
+	if signal := qt.GetSignal(ptr, "prepare"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(query)))))
 	}
 
@@ -6509,14 +6618,14 @@ func callbackQSqlResult_Prepare(ptr unsafe.Pointer, query C.struct_QtSql_PackedS
 func (ptr *QSqlResult) ConnectPrepare(f func(query string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "prepare", f)
+		qt.ConnectSignal(ptr.Pointer(), "prepare", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectPrepare() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "prepare")
+		qt.DisconnectSignal(ptr.Pointer(), "prepare")
 	}
 }
 
@@ -6540,7 +6649,7 @@ func (ptr *QSqlResult) PrepareDefault(query string) bool {
 
 //export callbackQSqlResult_Reset
 func callbackQSqlResult_Reset(ptr unsafe.Pointer, query C.struct_QtSql_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(query)))))
 	}
 
@@ -6550,14 +6659,14 @@ func callbackQSqlResult_Reset(ptr unsafe.Pointer, query C.struct_QtSql_PackedStr
 func (ptr *QSqlResult) ConnectReset(f func(query string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reset", f)
+		qt.ConnectSignal(ptr.Pointer(), "reset", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectReset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reset")
+		qt.DisconnectSignal(ptr.Pointer(), "reset")
 	}
 }
 
@@ -6572,7 +6681,7 @@ func (ptr *QSqlResult) Reset(query string) bool {
 
 //export callbackQSqlResult_SavePrepare
 func callbackQSqlResult_SavePrepare(ptr unsafe.Pointer, query C.struct_QtSql_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "savePrepare"); signal != nil {
+	if signal := qt.GetSignal(ptr, "savePrepare"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(query)))))
 	}
 
@@ -6582,14 +6691,14 @@ func callbackQSqlResult_SavePrepare(ptr unsafe.Pointer, query C.struct_QtSql_Pac
 func (ptr *QSqlResult) ConnectSavePrepare(f func(query string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "savePrepare", f)
+		qt.ConnectSignal(ptr.Pointer(), "savePrepare", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectSavePrepare() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "savePrepare")
+		qt.DisconnectSignal(ptr.Pointer(), "savePrepare")
 	}
 }
 
@@ -6613,7 +6722,7 @@ func (ptr *QSqlResult) SavePrepareDefault(query string) bool {
 
 //export callbackQSqlResult_NumRowsAffected
 func callbackQSqlResult_NumRowsAffected(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "numRowsAffected"); signal != nil {
+	if signal := qt.GetSignal(ptr, "numRowsAffected"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -6623,14 +6732,14 @@ func callbackQSqlResult_NumRowsAffected(ptr unsafe.Pointer) C.int {
 func (ptr *QSqlResult) ConnectNumRowsAffected(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "numRowsAffected", f)
+		qt.ConnectSignal(ptr.Pointer(), "numRowsAffected", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectNumRowsAffected() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "numRowsAffected")
+		qt.DisconnectSignal(ptr.Pointer(), "numRowsAffected")
 	}
 }
 
@@ -6643,7 +6752,7 @@ func (ptr *QSqlResult) NumRowsAffected() int {
 
 //export callbackQSqlResult_Size
 func callbackQSqlResult_Size(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "size"); signal != nil {
+	if signal := qt.GetSignal(ptr, "size"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -6653,14 +6762,14 @@ func callbackQSqlResult_Size(ptr unsafe.Pointer) C.int {
 func (ptr *QSqlResult) ConnectSize(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "size", f)
+		qt.ConnectSignal(ptr.Pointer(), "size", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectSize() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "size")
+		qt.DisconnectSignal(ptr.Pointer(), "size")
 	}
 }
 
@@ -6679,7 +6788,7 @@ func (ptr *QSqlResult) AddBindValue(val core.QVariant_ITF, paramType QSql__Param
 
 //export callbackQSqlResult_BindValue2
 func callbackQSqlResult_BindValue2(ptr unsafe.Pointer, placeholder C.struct_QtSql_PackedString, val unsafe.Pointer, paramType C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bindValue2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bindValue2"); signal != nil {
 		signal.(func(string, *core.QVariant, QSql__ParamTypeFlag))(cGoUnpackString(placeholder), core.NewQVariantFromPointer(val), QSql__ParamTypeFlag(paramType))
 	} else {
 		NewQSqlResultFromPointer(ptr).BindValue2Default(cGoUnpackString(placeholder), core.NewQVariantFromPointer(val), QSql__ParamTypeFlag(paramType))
@@ -6689,14 +6798,14 @@ func callbackQSqlResult_BindValue2(ptr unsafe.Pointer, placeholder C.struct_QtSq
 func (ptr *QSqlResult) ConnectBindValue2(f func(placeholder string, val *core.QVariant, paramType QSql__ParamTypeFlag)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "bindValue2", f)
+		qt.ConnectSignal(ptr.Pointer(), "bindValue2", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectBindValue2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "bindValue2")
+		qt.DisconnectSignal(ptr.Pointer(), "bindValue2")
 	}
 }
 
@@ -6718,7 +6827,7 @@ func (ptr *QSqlResult) BindValue2Default(placeholder string, val core.QVariant_I
 
 //export callbackQSqlResult_BindValue
 func callbackQSqlResult_BindValue(ptr unsafe.Pointer, index C.int, val unsafe.Pointer, paramType C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "bindValue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "bindValue"); signal != nil {
 		signal.(func(int, *core.QVariant, QSql__ParamTypeFlag))(int(int32(index)), core.NewQVariantFromPointer(val), QSql__ParamTypeFlag(paramType))
 	} else {
 		NewQSqlResultFromPointer(ptr).BindValueDefault(int(int32(index)), core.NewQVariantFromPointer(val), QSql__ParamTypeFlag(paramType))
@@ -6728,14 +6837,14 @@ func callbackQSqlResult_BindValue(ptr unsafe.Pointer, index C.int, val unsafe.Po
 func (ptr *QSqlResult) ConnectBindValue(f func(index int, val *core.QVariant, paramType QSql__ParamTypeFlag)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "bindValue", f)
+		qt.ConnectSignal(ptr.Pointer(), "bindValue", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectBindValue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "bindValue")
+		qt.DisconnectSignal(ptr.Pointer(), "bindValue")
 	}
 }
 
@@ -6765,7 +6874,7 @@ func (ptr *QSqlResult) ResetBindCount() {
 
 //export callbackQSqlResult_SetActive
 func callbackQSqlResult_SetActive(ptr unsafe.Pointer, active C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setActive"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setActive"); signal != nil {
 		signal.(func(bool))(int8(active) != 0)
 	} else {
 		NewQSqlResultFromPointer(ptr).SetActiveDefault(int8(active) != 0)
@@ -6775,14 +6884,14 @@ func callbackQSqlResult_SetActive(ptr unsafe.Pointer, active C.char) {
 func (ptr *QSqlResult) ConnectSetActive(f func(active bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setActive", f)
+		qt.ConnectSignal(ptr.Pointer(), "setActive", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectSetActive() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setActive")
+		qt.DisconnectSignal(ptr.Pointer(), "setActive")
 	}
 }
 
@@ -6800,7 +6909,7 @@ func (ptr *QSqlResult) SetActiveDefault(active bool) {
 
 //export callbackQSqlResult_SetAt
 func callbackQSqlResult_SetAt(ptr unsafe.Pointer, index C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setAt"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setAt"); signal != nil {
 		signal.(func(int))(int(int32(index)))
 	} else {
 		NewQSqlResultFromPointer(ptr).SetAtDefault(int(int32(index)))
@@ -6810,14 +6919,14 @@ func callbackQSqlResult_SetAt(ptr unsafe.Pointer, index C.int) {
 func (ptr *QSqlResult) ConnectSetAt(f func(index int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setAt", f)
+		qt.ConnectSignal(ptr.Pointer(), "setAt", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectSetAt() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setAt")
+		qt.DisconnectSignal(ptr.Pointer(), "setAt")
 	}
 }
 
@@ -6835,7 +6944,7 @@ func (ptr *QSqlResult) SetAtDefault(index int) {
 
 //export callbackQSqlResult_SetForwardOnly
 func callbackQSqlResult_SetForwardOnly(ptr unsafe.Pointer, forward C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setForwardOnly"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setForwardOnly"); signal != nil {
 		signal.(func(bool))(int8(forward) != 0)
 	} else {
 		NewQSqlResultFromPointer(ptr).SetForwardOnlyDefault(int8(forward) != 0)
@@ -6845,14 +6954,14 @@ func callbackQSqlResult_SetForwardOnly(ptr unsafe.Pointer, forward C.char) {
 func (ptr *QSqlResult) ConnectSetForwardOnly(f func(forward bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setForwardOnly", f)
+		qt.ConnectSignal(ptr.Pointer(), "setForwardOnly", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectSetForwardOnly() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setForwardOnly")
+		qt.DisconnectSignal(ptr.Pointer(), "setForwardOnly")
 	}
 }
 
@@ -6870,7 +6979,7 @@ func (ptr *QSqlResult) SetForwardOnlyDefault(forward bool) {
 
 //export callbackQSqlResult_SetLastError
 func callbackQSqlResult_SetLastError(ptr unsafe.Pointer, error unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setLastError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setLastError"); signal != nil {
 		signal.(func(*QSqlError))(NewQSqlErrorFromPointer(error))
 	} else {
 		NewQSqlResultFromPointer(ptr).SetLastErrorDefault(NewQSqlErrorFromPointer(error))
@@ -6880,14 +6989,14 @@ func callbackQSqlResult_SetLastError(ptr unsafe.Pointer, error unsafe.Pointer) {
 func (ptr *QSqlResult) ConnectSetLastError(f func(error *QSqlError)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setLastError", f)
+		qt.ConnectSignal(ptr.Pointer(), "setLastError", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectSetLastError() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setLastError")
+		qt.DisconnectSignal(ptr.Pointer(), "setLastError")
 	}
 }
 
@@ -6905,7 +7014,7 @@ func (ptr *QSqlResult) SetLastErrorDefault(error QSqlError_ITF) {
 
 //export callbackQSqlResult_SetQuery
 func callbackQSqlResult_SetQuery(ptr unsafe.Pointer, query C.struct_QtSql_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setQuery"); signal != nil {
 		signal.(func(string))(cGoUnpackString(query))
 	} else {
 		NewQSqlResultFromPointer(ptr).SetQueryDefault(cGoUnpackString(query))
@@ -6915,14 +7024,14 @@ func callbackQSqlResult_SetQuery(ptr unsafe.Pointer, query C.struct_QtSql_Packed
 func (ptr *QSqlResult) ConnectSetQuery(f func(query string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setQuery", f)
+		qt.ConnectSignal(ptr.Pointer(), "setQuery", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectSetQuery() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setQuery")
+		qt.DisconnectSignal(ptr.Pointer(), "setQuery")
 	}
 }
 
@@ -6944,7 +7053,7 @@ func (ptr *QSqlResult) SetQueryDefault(query string) {
 
 //export callbackQSqlResult_SetSelect
 func callbackQSqlResult_SetSelect(ptr unsafe.Pointer, sele C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSelect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSelect"); signal != nil {
 		signal.(func(bool))(int8(sele) != 0)
 	} else {
 		NewQSqlResultFromPointer(ptr).SetSelectDefault(int8(sele) != 0)
@@ -6954,14 +7063,14 @@ func callbackQSqlResult_SetSelect(ptr unsafe.Pointer, sele C.char) {
 func (ptr *QSqlResult) ConnectSetSelect(f func(sele bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSelect", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSelect", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectSetSelect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSelect")
+		qt.DisconnectSignal(ptr.Pointer(), "setSelect")
 	}
 }
 
@@ -6979,7 +7088,7 @@ func (ptr *QSqlResult) SetSelectDefault(sele bool) {
 
 //export callbackQSqlResult_DestroyQSqlResult
 func callbackQSqlResult_DestroyQSqlResult(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSqlResult"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSqlResult"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlResultFromPointer(ptr).DestroyQSqlResultDefault()
@@ -6989,21 +7098,21 @@ func callbackQSqlResult_DestroyQSqlResult(ptr unsafe.Pointer) {
 func (ptr *QSqlResult) ConnectDestroyQSqlResult(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlResult", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSqlResult", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectDestroyQSqlResult() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlResult")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSqlResult")
 	}
 }
 
 func (ptr *QSqlResult) DestroyQSqlResult() {
 	if ptr.Pointer() != nil {
 		C.QSqlResult_DestroyQSqlResult(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7011,7 +7120,7 @@ func (ptr *QSqlResult) DestroyQSqlResult() {
 func (ptr *QSqlResult) DestroyQSqlResultDefault() {
 	if ptr.Pointer() != nil {
 		C.QSqlResult_DestroyQSqlResultDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7050,7 +7159,7 @@ func (ptr *QSqlResult) LastError() *QSqlError {
 
 //export callbackQSqlResult_Record
 func callbackQSqlResult_Record(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "record"); signal != nil {
+	if signal := qt.GetSignal(ptr, "record"); signal != nil {
 		return PointerFromQSqlRecord(signal.(func() *QSqlRecord)())
 	}
 
@@ -7060,14 +7169,14 @@ func callbackQSqlResult_Record(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSqlResult) ConnectRecord(f func() *QSqlRecord) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "record", f)
+		qt.ConnectSignal(ptr.Pointer(), "record", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectRecord() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "record")
+		qt.DisconnectSignal(ptr.Pointer(), "record")
 	}
 }
 
@@ -7132,7 +7241,7 @@ func (ptr *QSqlResult) BoundValue(index int) *core.QVariant {
 
 //export callbackQSqlResult_Handle
 func callbackQSqlResult_Handle(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "handle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "handle"); signal != nil {
 		return core.PointerFromQVariant(signal.(func() *core.QVariant)())
 	}
 
@@ -7142,14 +7251,14 @@ func callbackQSqlResult_Handle(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSqlResult) ConnectHandle(f func() *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "handle", f)
+		qt.ConnectSignal(ptr.Pointer(), "handle", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectHandle() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "handle")
+		qt.DisconnectSignal(ptr.Pointer(), "handle")
 	}
 }
 
@@ -7173,7 +7282,7 @@ func (ptr *QSqlResult) HandleDefault() *core.QVariant {
 
 //export callbackQSqlResult_LastInsertId
 func callbackQSqlResult_LastInsertId(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lastInsertId"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lastInsertId"); signal != nil {
 		return core.PointerFromQVariant(signal.(func() *core.QVariant)())
 	}
 
@@ -7183,14 +7292,14 @@ func callbackQSqlResult_LastInsertId(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSqlResult) ConnectLastInsertId(f func() *core.QVariant) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lastInsertId", f)
+		qt.ConnectSignal(ptr.Pointer(), "lastInsertId", f)
 	}
 }
 
 func (ptr *QSqlResult) DisconnectLastInsertId() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lastInsertId")
+		qt.DisconnectSignal(ptr.Pointer(), "lastInsertId")
 	}
 }
 
@@ -7263,7 +7372,7 @@ func (ptr *QSqlResult) IsValid() bool {
 func (ptr *QSqlResult) Driver() *QSqlDriver {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSqlDriverFromPointer(C.QSqlResult_Driver(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -7355,7 +7464,7 @@ const (
 
 func NewQSqlTableModel(parent core.QObject_ITF, db QSqlDatabase_ITF) *QSqlTableModel {
 	var tmpValue = NewQSqlTableModelFromPointer(C.QSqlTableModel_NewQSqlTableModel(core.PointerFromQObject(parent), PointerFromQSqlDatabase(db)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -7363,7 +7472,7 @@ func NewQSqlTableModel(parent core.QObject_ITF, db QSqlDatabase_ITF) *QSqlTableM
 
 //export callbackQSqlTableModel_DeleteRowFromTable
 func callbackQSqlTableModel_DeleteRowFromTable(ptr unsafe.Pointer, row C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteRowFromTable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteRowFromTable"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(row))))))
 	}
 
@@ -7373,14 +7482,14 @@ func callbackQSqlTableModel_DeleteRowFromTable(ptr unsafe.Pointer, row C.int) C.
 func (ptr *QSqlTableModel) ConnectDeleteRowFromTable(f func(row int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "deleteRowFromTable", f)
+		qt.ConnectSignal(ptr.Pointer(), "deleteRowFromTable", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectDeleteRowFromTable() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "deleteRowFromTable")
+		qt.DisconnectSignal(ptr.Pointer(), "deleteRowFromTable")
 	}
 }
 
@@ -7407,7 +7516,7 @@ func (ptr *QSqlTableModel) InsertRecord(row int, record QSqlRecord_ITF) bool {
 
 //export callbackQSqlTableModel_InsertRowIntoTable
 func callbackQSqlTableModel_InsertRowIntoTable(ptr unsafe.Pointer, values unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "insertRowIntoTable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "insertRowIntoTable"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QSqlRecord) bool)(NewQSqlRecordFromPointer(values)))))
 	}
 
@@ -7417,14 +7526,14 @@ func callbackQSqlTableModel_InsertRowIntoTable(ptr unsafe.Pointer, values unsafe
 func (ptr *QSqlTableModel) ConnectInsertRowIntoTable(f func(values *QSqlRecord) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "insertRowIntoTable", f)
+		qt.ConnectSignal(ptr.Pointer(), "insertRowIntoTable", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectInsertRowIntoTable() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "insertRowIntoTable")
+		qt.DisconnectSignal(ptr.Pointer(), "insertRowIntoTable")
 	}
 }
 
@@ -7444,7 +7553,7 @@ func (ptr *QSqlTableModel) InsertRowIntoTableDefault(values QSqlRecord_ITF) bool
 
 //export callbackQSqlTableModel_Select
 func callbackQSqlTableModel_Select(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "select"); signal != nil {
+	if signal := qt.GetSignal(ptr, "select"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -7454,14 +7563,14 @@ func callbackQSqlTableModel_Select(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlTableModel) ConnectSelect(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "select", f)
+		qt.ConnectSignal(ptr.Pointer(), "select", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectSelect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "select")
+		qt.DisconnectSignal(ptr.Pointer(), "select")
 	}
 }
 
@@ -7481,7 +7590,7 @@ func (ptr *QSqlTableModel) SelectDefault() bool {
 
 //export callbackQSqlTableModel_SelectRow
 func callbackQSqlTableModel_SelectRow(ptr unsafe.Pointer, row C.int) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectRow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectRow"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int) bool)(int(int32(row))))))
 	}
 
@@ -7491,14 +7600,14 @@ func callbackQSqlTableModel_SelectRow(ptr unsafe.Pointer, row C.int) C.char {
 func (ptr *QSqlTableModel) ConnectSelectRow(f func(row int) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectRow", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectRow", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectSelectRow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectRow")
+		qt.DisconnectSignal(ptr.Pointer(), "selectRow")
 	}
 }
 
@@ -7525,7 +7634,7 @@ func (ptr *QSqlTableModel) SetRecord(row int, values QSqlRecord_ITF) bool {
 
 //export callbackQSqlTableModel_SubmitAll
 func callbackQSqlTableModel_SubmitAll(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "submitAll"); signal != nil {
+	if signal := qt.GetSignal(ptr, "submitAll"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -7535,14 +7644,14 @@ func callbackQSqlTableModel_SubmitAll(ptr unsafe.Pointer) C.char {
 func (ptr *QSqlTableModel) ConnectSubmitAll(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "submitAll", f)
+		qt.ConnectSignal(ptr.Pointer(), "submitAll", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectSubmitAll() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "submitAll")
+		qt.DisconnectSignal(ptr.Pointer(), "submitAll")
 	}
 }
 
@@ -7562,7 +7671,7 @@ func (ptr *QSqlTableModel) SubmitAllDefault() bool {
 
 //export callbackQSqlTableModel_UpdateRowInTable
 func callbackQSqlTableModel_UpdateRowInTable(ptr unsafe.Pointer, row C.int, values unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateRowInTable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateRowInTable"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(int, *QSqlRecord) bool)(int(int32(row)), NewQSqlRecordFromPointer(values)))))
 	}
 
@@ -7572,14 +7681,14 @@ func callbackQSqlTableModel_UpdateRowInTable(ptr unsafe.Pointer, row C.int, valu
 func (ptr *QSqlTableModel) ConnectUpdateRowInTable(f func(row int, values *QSqlRecord) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "updateRowInTable", f)
+		qt.ConnectSignal(ptr.Pointer(), "updateRowInTable", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectUpdateRowInTable() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "updateRowInTable")
+		qt.DisconnectSignal(ptr.Pointer(), "updateRowInTable")
 	}
 }
 
@@ -7599,7 +7708,7 @@ func (ptr *QSqlTableModel) UpdateRowInTableDefault(row int, values QSqlRecord_IT
 
 //export callbackQSqlTableModel_BeforeDelete
 func callbackQSqlTableModel_BeforeDelete(ptr unsafe.Pointer, row C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "beforeDelete"); signal != nil {
+	if signal := qt.GetSignal(ptr, "beforeDelete"); signal != nil {
 		signal.(func(int))(int(int32(row)))
 	}
 
@@ -7608,14 +7717,14 @@ func callbackQSqlTableModel_BeforeDelete(ptr unsafe.Pointer, row C.int) {
 func (ptr *QSqlTableModel) ConnectBeforeDelete(f func(row int)) {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_ConnectBeforeDelete(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "beforeDelete", f)
+		qt.ConnectSignal(ptr.Pointer(), "beforeDelete", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectBeforeDelete() {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_DisconnectBeforeDelete(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "beforeDelete")
+		qt.DisconnectSignal(ptr.Pointer(), "beforeDelete")
 	}
 }
 
@@ -7627,7 +7736,7 @@ func (ptr *QSqlTableModel) BeforeDelete(row int) {
 
 //export callbackQSqlTableModel_BeforeInsert
 func callbackQSqlTableModel_BeforeInsert(ptr unsafe.Pointer, record unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "beforeInsert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "beforeInsert"); signal != nil {
 		signal.(func(*QSqlRecord))(NewQSqlRecordFromPointer(record))
 	}
 
@@ -7636,14 +7745,14 @@ func callbackQSqlTableModel_BeforeInsert(ptr unsafe.Pointer, record unsafe.Point
 func (ptr *QSqlTableModel) ConnectBeforeInsert(f func(record *QSqlRecord)) {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_ConnectBeforeInsert(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "beforeInsert", f)
+		qt.ConnectSignal(ptr.Pointer(), "beforeInsert", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectBeforeInsert() {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_DisconnectBeforeInsert(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "beforeInsert")
+		qt.DisconnectSignal(ptr.Pointer(), "beforeInsert")
 	}
 }
 
@@ -7655,7 +7764,7 @@ func (ptr *QSqlTableModel) BeforeInsert(record QSqlRecord_ITF) {
 
 //export callbackQSqlTableModel_BeforeUpdate
 func callbackQSqlTableModel_BeforeUpdate(ptr unsafe.Pointer, row C.int, record unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "beforeUpdate"); signal != nil {
+	if signal := qt.GetSignal(ptr, "beforeUpdate"); signal != nil {
 		signal.(func(int, *QSqlRecord))(int(int32(row)), NewQSqlRecordFromPointer(record))
 	}
 
@@ -7664,14 +7773,14 @@ func callbackQSqlTableModel_BeforeUpdate(ptr unsafe.Pointer, row C.int, record u
 func (ptr *QSqlTableModel) ConnectBeforeUpdate(f func(row int, record *QSqlRecord)) {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_ConnectBeforeUpdate(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "beforeUpdate", f)
+		qt.ConnectSignal(ptr.Pointer(), "beforeUpdate", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectBeforeUpdate() {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_DisconnectBeforeUpdate(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "beforeUpdate")
+		qt.DisconnectSignal(ptr.Pointer(), "beforeUpdate")
 	}
 }
 
@@ -7683,7 +7792,7 @@ func (ptr *QSqlTableModel) BeforeUpdate(row int, record QSqlRecord_ITF) {
 
 //export callbackQSqlTableModel_PrimeInsert
 func callbackQSqlTableModel_PrimeInsert(ptr unsafe.Pointer, row C.int, record unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "primeInsert"); signal != nil {
+	if signal := qt.GetSignal(ptr, "primeInsert"); signal != nil {
 		signal.(func(int, *QSqlRecord))(int(int32(row)), NewQSqlRecordFromPointer(record))
 	}
 
@@ -7692,14 +7801,14 @@ func callbackQSqlTableModel_PrimeInsert(ptr unsafe.Pointer, row C.int, record un
 func (ptr *QSqlTableModel) ConnectPrimeInsert(f func(row int, record *QSqlRecord)) {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_ConnectPrimeInsert(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "primeInsert", f)
+		qt.ConnectSignal(ptr.Pointer(), "primeInsert", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectPrimeInsert() {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_DisconnectPrimeInsert(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "primeInsert")
+		qt.DisconnectSignal(ptr.Pointer(), "primeInsert")
 	}
 }
 
@@ -7711,7 +7820,7 @@ func (ptr *QSqlTableModel) PrimeInsert(row int, record QSqlRecord_ITF) {
 
 //export callbackQSqlTableModel_RevertAll
 func callbackQSqlTableModel_RevertAll(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "revertAll"); signal != nil {
+	if signal := qt.GetSignal(ptr, "revertAll"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlTableModelFromPointer(ptr).RevertAllDefault()
@@ -7721,14 +7830,14 @@ func callbackQSqlTableModel_RevertAll(ptr unsafe.Pointer) {
 func (ptr *QSqlTableModel) ConnectRevertAll(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "revertAll", f)
+		qt.ConnectSignal(ptr.Pointer(), "revertAll", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectRevertAll() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "revertAll")
+		qt.DisconnectSignal(ptr.Pointer(), "revertAll")
 	}
 }
 
@@ -7746,7 +7855,7 @@ func (ptr *QSqlTableModel) RevertAllDefault() {
 
 //export callbackQSqlTableModel_RevertRow
 func callbackQSqlTableModel_RevertRow(ptr unsafe.Pointer, row C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "revertRow"); signal != nil {
+	if signal := qt.GetSignal(ptr, "revertRow"); signal != nil {
 		signal.(func(int))(int(int32(row)))
 	} else {
 		NewQSqlTableModelFromPointer(ptr).RevertRowDefault(int(int32(row)))
@@ -7756,14 +7865,14 @@ func callbackQSqlTableModel_RevertRow(ptr unsafe.Pointer, row C.int) {
 func (ptr *QSqlTableModel) ConnectRevertRow(f func(row int)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "revertRow", f)
+		qt.ConnectSignal(ptr.Pointer(), "revertRow", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectRevertRow() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "revertRow")
+		qt.DisconnectSignal(ptr.Pointer(), "revertRow")
 	}
 }
 
@@ -7781,7 +7890,7 @@ func (ptr *QSqlTableModel) RevertRowDefault(row int) {
 
 //export callbackQSqlTableModel_SetEditStrategy
 func callbackQSqlTableModel_SetEditStrategy(ptr unsafe.Pointer, strategy C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEditStrategy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEditStrategy"); signal != nil {
 		signal.(func(QSqlTableModel__EditStrategy))(QSqlTableModel__EditStrategy(strategy))
 	} else {
 		NewQSqlTableModelFromPointer(ptr).SetEditStrategyDefault(QSqlTableModel__EditStrategy(strategy))
@@ -7791,14 +7900,14 @@ func callbackQSqlTableModel_SetEditStrategy(ptr unsafe.Pointer, strategy C.longl
 func (ptr *QSqlTableModel) ConnectSetEditStrategy(f func(strategy QSqlTableModel__EditStrategy)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setEditStrategy", f)
+		qt.ConnectSignal(ptr.Pointer(), "setEditStrategy", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectSetEditStrategy() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setEditStrategy")
+		qt.DisconnectSignal(ptr.Pointer(), "setEditStrategy")
 	}
 }
 
@@ -7816,7 +7925,7 @@ func (ptr *QSqlTableModel) SetEditStrategyDefault(strategy QSqlTableModel__EditS
 
 //export callbackQSqlTableModel_SetFilter
 func callbackQSqlTableModel_SetFilter(ptr unsafe.Pointer, filter C.struct_QtSql_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFilter"); signal != nil {
 		signal.(func(string))(cGoUnpackString(filter))
 	} else {
 		NewQSqlTableModelFromPointer(ptr).SetFilterDefault(cGoUnpackString(filter))
@@ -7826,14 +7935,14 @@ func callbackQSqlTableModel_SetFilter(ptr unsafe.Pointer, filter C.struct_QtSql_
 func (ptr *QSqlTableModel) ConnectSetFilter(f func(filter string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFilter", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFilter", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectSetFilter() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFilter")
+		qt.DisconnectSignal(ptr.Pointer(), "setFilter")
 	}
 }
 
@@ -7861,7 +7970,7 @@ func (ptr *QSqlTableModel) SetPrimaryKey(key QSqlIndex_ITF) {
 
 //export callbackQSqlTableModel_SetSort
 func callbackQSqlTableModel_SetSort(ptr unsafe.Pointer, column C.int, order C.longlong) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setSort"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setSort"); signal != nil {
 		signal.(func(int, core.Qt__SortOrder))(int(int32(column)), core.Qt__SortOrder(order))
 	} else {
 		NewQSqlTableModelFromPointer(ptr).SetSortDefault(int(int32(column)), core.Qt__SortOrder(order))
@@ -7871,14 +7980,14 @@ func callbackQSqlTableModel_SetSort(ptr unsafe.Pointer, column C.int, order C.lo
 func (ptr *QSqlTableModel) ConnectSetSort(f func(column int, order core.Qt__SortOrder)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setSort", f)
+		qt.ConnectSignal(ptr.Pointer(), "setSort", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectSetSort() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setSort")
+		qt.DisconnectSignal(ptr.Pointer(), "setSort")
 	}
 }
 
@@ -7896,7 +8005,7 @@ func (ptr *QSqlTableModel) SetSortDefault(column int, order core.Qt__SortOrder)
 
 //export callbackQSqlTableModel_SetTable
 func callbackQSqlTableModel_SetTable(ptr unsafe.Pointer, tableName C.struct_QtSql_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setTable"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setTable"); signal != nil {
 		signal.(func(string))(cGoUnpackString(tableName))
 	} else {
 		NewQSqlTableModelFromPointer(ptr).SetTableDefault(cGoUnpackString(tableName))
@@ -7906,14 +8015,14 @@ func callbackQSqlTableModel_SetTable(ptr unsafe.Pointer, tableName C.struct_QtSq
 func (ptr *QSqlTableModel) ConnectSetTable(f func(tableName string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setTable", f)
+		qt.ConnectSignal(ptr.Pointer(), "setTable", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectSetTable() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setTable")
+		qt.DisconnectSignal(ptr.Pointer(), "setTable")
 	}
 }
 
@@ -7935,7 +8044,7 @@ func (ptr *QSqlTableModel) SetTableDefault(tableName string) {
 
 //export callbackQSqlTableModel_DestroyQSqlTableModel
 func callbackQSqlTableModel_DestroyQSqlTableModel(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QSqlTableModel"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QSqlTableModel"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSqlTableModelFromPointer(ptr).DestroyQSqlTableModelDefault()
@@ -7945,21 +8054,21 @@ func callbackQSqlTableModel_DestroyQSqlTableModel(ptr unsafe.Pointer) {
 func (ptr *QSqlTableModel) ConnectDestroyQSqlTableModel(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlTableModel", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QSqlTableModel", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectDestroyQSqlTableModel() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QSqlTableModel")
+		qt.DisconnectSignal(ptr.Pointer(), "~QSqlTableModel")
 	}
 }
 
 func (ptr *QSqlTableModel) DestroyQSqlTableModel() {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_DestroyQSqlTableModel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7967,7 +8076,7 @@ func (ptr *QSqlTableModel) DestroyQSqlTableModel() {
 func (ptr *QSqlTableModel) DestroyQSqlTableModelDefault() {
 	if ptr.Pointer() != nil {
 		C.QSqlTableModel_DestroyQSqlTableModelDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -8015,7 +8124,7 @@ func (ptr *QSqlTableModel) Filter() string {
 
 //export callbackQSqlTableModel_OrderByClause
 func callbackQSqlTableModel_OrderByClause(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "orderByClause"); signal != nil {
+	if signal := qt.GetSignal(ptr, "orderByClause"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -8025,14 +8134,14 @@ func callbackQSqlTableModel_OrderByClause(ptr unsafe.Pointer) *C.char {
 func (ptr *QSqlTableModel) ConnectOrderByClause(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "orderByClause", f)
+		qt.ConnectSignal(ptr.Pointer(), "orderByClause", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectOrderByClause() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "orderByClause")
+		qt.DisconnectSignal(ptr.Pointer(), "orderByClause")
 	}
 }
 
@@ -8052,7 +8161,7 @@ func (ptr *QSqlTableModel) OrderByClauseDefault() string {
 
 //export callbackQSqlTableModel_SelectStatement
 func callbackQSqlTableModel_SelectStatement(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "selectStatement"); signal != nil {
+	if signal := qt.GetSignal(ptr, "selectStatement"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -8062,14 +8171,14 @@ func callbackQSqlTableModel_SelectStatement(ptr unsafe.Pointer) *C.char {
 func (ptr *QSqlTableModel) ConnectSelectStatement(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "selectStatement", f)
+		qt.ConnectSignal(ptr.Pointer(), "selectStatement", f)
 	}
 }
 
 func (ptr *QSqlTableModel) DisconnectSelectStatement() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "selectStatement")
+		qt.DisconnectSignal(ptr.Pointer(), "selectStatement")
 	}
 }
 
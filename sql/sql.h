@@ -285,6 +285,7 @@ void* QSqlQueryModel_Record2(void* ptr);
 void* QSqlQueryModel_Record(void* ptr, int row);
 void* QSqlQueryModel_Data(void* ptr, void* item, int role);
 void* QSqlQueryModel_DataDefault(void* ptr, void* item, int role);
+void QSqlQueryModel_DataDefaultInto(void* ptr, void* item, int role, void* ret);
 void* QSqlQueryModel_HeaderDataDefault(void* ptr, int section, long long orientation, int role);
 char QSqlQueryModel_CanFetchMoreDefault(void* ptr, void* parent);
 int QSqlQueryModel_ColumnCount(void* ptr, void* index);
@@ -294,12 +295,18 @@ int QSqlQueryModel_RowCountDefault(void* ptr, void* parent);
 int QSqlQueryModel_____setItemData_keyList_atList(void* ptr, int i);
 void QSqlQueryModel_____setItemData_keyList_setList(void* ptr, int i);
 void* QSqlQueryModel_____setItemData_keyList_newList(void* ptr);
+void* QSqlQueryModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QSqlQueryModel_____setItemData_keyList_fillList(void* ptr, void* data);
 int QSqlQueryModel_____roleNames_keyList_atList(void* ptr, int i);
 void QSqlQueryModel_____roleNames_keyList_setList(void* ptr, int i);
 void* QSqlQueryModel_____roleNames_keyList_newList(void* ptr);
+void* QSqlQueryModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QSqlQueryModel_____roleNames_keyList_fillList(void* ptr, void* data);
 int QSqlQueryModel_____itemData_keyList_atList(void* ptr, int i);
 void QSqlQueryModel_____itemData_keyList_setList(void* ptr, int i);
 void* QSqlQueryModel_____itemData_keyList_newList(void* ptr);
+void* QSqlQueryModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QSqlQueryModel_____itemData_keyList_fillList(void* ptr, void* data);
 void* QSqlQueryModel___setItemData_roles_atList(void* ptr, int i);
 void QSqlQueryModel___setItemData_roles_setList(void* ptr, int key, void* i);
 void* QSqlQueryModel___setItemData_roles_newList(void* ptr);
@@ -313,6 +320,8 @@ void* QSqlQueryModel___changePersistentIndexList_to_newList(void* ptr);
 int QSqlQueryModel___dataChanged_roles_atList(void* ptr, int i);
 void QSqlQueryModel___dataChanged_roles_setList(void* ptr, int i);
 void* QSqlQueryModel___dataChanged_roles_newList(void* ptr);
+void* QSqlQueryModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count);
+void QSqlQueryModel___dataChanged_roles_fillList(void* ptr, void* data);
 void* QSqlQueryModel___layoutAboutToBeChanged_parents_atList(void* ptr, int i);
 void QSqlQueryModel___layoutAboutToBeChanged_parents_setList(void* ptr, void* i);
 void* QSqlQueryModel___layoutAboutToBeChanged_parents_newList(void* ptr);
@@ -339,9 +348,13 @@ void* QSqlQueryModel___persistentIndexList_newList(void* ptr);
 int QSqlQueryModel_____doSetRoleNames_keyList_atList(void* ptr, int i);
 void QSqlQueryModel_____doSetRoleNames_keyList_setList(void* ptr, int i);
 void* QSqlQueryModel_____doSetRoleNames_keyList_newList(void* ptr);
+void* QSqlQueryModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QSqlQueryModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data);
 int QSqlQueryModel_____setRoleNames_keyList_atList(void* ptr, int i);
 void QSqlQueryModel_____setRoleNames_keyList_setList(void* ptr, int i);
 void* QSqlQueryModel_____setRoleNames_keyList_newList(void* ptr);
+void* QSqlQueryModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QSqlQueryModel_____setRoleNames_keyList_fillList(void* ptr, void* data);
 void* QSqlQueryModel___dynamicPropertyNames_atList(void* ptr, int i);
 void QSqlQueryModel___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QSqlQueryModel___dynamicPropertyNames_newList(void* ptr);
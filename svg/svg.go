@@ -8,7 +8,6 @@ package svg
 //#include "svg.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"github.com/therecipe/qt/gui"
@@ -23,6 +22,43 @@ func cGoUnpackString(s C.struct_QtSvg_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtSvg_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtSvg_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QGraphicsSvgItem struct {
 	widgets.QGraphicsObject
@@ -66,14 +102,14 @@ func NewQGraphicsSvgItemFromPointer(ptr unsafe.Pointer) *QGraphicsSvgItem {
 func (ptr *QGraphicsSvgItem) DestroyQGraphicsSvgItem() {
 	if ptr != nil {
 		C.free(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 func NewQGraphicsSvgItem(parent widgets.QGraphicsItem_ITF) *QGraphicsSvgItem {
 	var tmpValue = NewQGraphicsSvgItemFromPointer(C.QGraphicsSvgItem_NewQGraphicsSvgItem(widgets.PointerFromQGraphicsItem(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -83,7 +119,7 @@ func NewQGraphicsSvgItem2(fileName string, parent widgets.QGraphicsItem_ITF) *QG
 	var fileNameC = C.CString(fileName)
 	defer C.free(unsafe.Pointer(fileNameC))
 	var tmpValue = NewQGraphicsSvgItemFromPointer(C.QGraphicsSvgItem_NewQGraphicsSvgItem2(fileNameC, widgets.PointerFromQGraphicsItem(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -91,7 +127,7 @@ func NewQGraphicsSvgItem2(fileName string, parent widgets.QGraphicsItem_ITF) *QG
 
 //export callbackQGraphicsSvgItem_Paint
 func callbackQGraphicsSvgItem_Paint(ptr unsafe.Pointer, painter unsafe.Pointer, option unsafe.Pointer, widget unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paint"); signal != nil {
 		signal.(func(*gui.QPainter, *widgets.QStyleOptionGraphicsItem, *widgets.QWidget))(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionGraphicsItemFromPointer(option), widgets.NewQWidgetFromPointer(widget))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).PaintDefault(gui.NewQPainterFromPointer(painter), widgets.NewQStyleOptionGraphicsItemFromPointer(option), widgets.NewQWidgetFromPointer(widget))
@@ -101,14 +137,14 @@ func callbackQGraphicsSvgItem_Paint(ptr unsafe.Pointer, painter unsafe.Pointer,
 func (ptr *QGraphicsSvgItem) ConnectPaint(f func(painter *gui.QPainter, option *widgets.QStyleOptionGraphicsItem, widget *widgets.QWidget)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paint", f)
+		qt.ConnectSignal(ptr.Pointer(), "paint", f)
 	}
 }
 
 func (ptr *QGraphicsSvgItem) DisconnectPaint() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paint")
+		qt.DisconnectSignal(ptr.Pointer(), "paint")
 	}
 }
 
@@ -146,7 +182,7 @@ func (ptr *QGraphicsSvgItem) SetSharedRenderer(renderer QSvgRenderer_ITF) {
 
 //export callbackQGraphicsSvgItem_BoundingRect
 func callbackQGraphicsSvgItem_BoundingRect(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "boundingRect"); signal != nil {
+	if signal := qt.GetSignal(ptr, "boundingRect"); signal != nil {
 		return core.PointerFromQRectF(signal.(func() *core.QRectF)())
 	}
 
@@ -156,14 +192,14 @@ func callbackQGraphicsSvgItem_BoundingRect(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QGraphicsSvgItem) ConnectBoundingRect(f func() *core.QRectF) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "boundingRect", f)
+		qt.ConnectSignal(ptr.Pointer(), "boundingRect", f)
 	}
 }
 
 func (ptr *QGraphicsSvgItem) DisconnectBoundingRect() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "boundingRect")
+		qt.DisconnectSignal(ptr.Pointer(), "boundingRect")
 	}
 }
 
@@ -204,7 +240,7 @@ func (ptr *QGraphicsSvgItem) ElementId() string {
 func (ptr *QGraphicsSvgItem) Renderer() *QSvgRenderer {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSvgRendererFromPointer(C.QGraphicsSvgItem_Renderer(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -214,7 +250,7 @@ func (ptr *QGraphicsSvgItem) Renderer() *QSvgRenderer {
 
 //export callbackQGraphicsSvgItem_Type
 func callbackQGraphicsSvgItem_Type(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "type"); signal != nil {
+	if signal := qt.GetSignal(ptr, "type"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -250,7 +286,7 @@ func (ptr *QGraphicsSvgItem) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QGraphicsSvgItem) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGraphicsSvgItem___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -271,7 +307,7 @@ func (ptr *QGraphicsSvgItem) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QGraphicsSvgItem) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGraphicsSvgItem___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -292,7 +328,7 @@ func (ptr *QGraphicsSvgItem) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QGraphicsSvgItem) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGraphicsSvgItem___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -313,7 +349,7 @@ func (ptr *QGraphicsSvgItem) __findChildren_newList() unsafe.Pointer {
 func (ptr *QGraphicsSvgItem) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QGraphicsSvgItem___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -334,7 +370,7 @@ func (ptr *QGraphicsSvgItem) __children_newList() unsafe.Pointer {
 func (ptr *QGraphicsSvgItem) __setTransformations_transformations_atList(i int) *widgets.QGraphicsTransform {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQGraphicsTransformFromPointer(C.QGraphicsSvgItem___setTransformations_transformations_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -389,7 +425,7 @@ func (ptr *QGraphicsSvgItem) __collidingItems_newList() unsafe.Pointer {
 func (ptr *QGraphicsSvgItem) __transformations_atList(i int) *widgets.QGraphicsTransform {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQGraphicsTransformFromPointer(C.QGraphicsSvgItem___transformations_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -409,7 +445,7 @@ func (ptr *QGraphicsSvgItem) __transformations_newList() unsafe.Pointer {
 
 //export callbackQGraphicsSvgItem_Event
 func callbackQGraphicsSvgItem_Event(ptr unsafe.Pointer, ev unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(ev)))))
 	}
 
@@ -425,7 +461,7 @@ func (ptr *QGraphicsSvgItem) EventDefault(ev core.QEvent_ITF) bool {
 
 //export callbackQGraphicsSvgItem_EnabledChanged
 func callbackQGraphicsSvgItem_EnabledChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enabledChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enabledChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -433,7 +469,7 @@ func callbackQGraphicsSvgItem_EnabledChanged(ptr unsafe.Pointer) {
 
 //export callbackQGraphicsSvgItem_OpacityChanged
 func callbackQGraphicsSvgItem_OpacityChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "opacityChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "opacityChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -441,7 +477,7 @@ func callbackQGraphicsSvgItem_OpacityChanged(ptr unsafe.Pointer) {
 
 //export callbackQGraphicsSvgItem_ParentChanged
 func callbackQGraphicsSvgItem_ParentChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parentChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parentChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -449,7 +485,7 @@ func callbackQGraphicsSvgItem_ParentChanged(ptr unsafe.Pointer) {
 
 //export callbackQGraphicsSvgItem_RotationChanged
 func callbackQGraphicsSvgItem_RotationChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "rotationChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "rotationChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -457,7 +493,7 @@ func callbackQGraphicsSvgItem_RotationChanged(ptr unsafe.Pointer) {
 
 //export callbackQGraphicsSvgItem_ScaleChanged
 func callbackQGraphicsSvgItem_ScaleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "scaleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "scaleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -465,7 +501,7 @@ func callbackQGraphicsSvgItem_ScaleChanged(ptr unsafe.Pointer) {
 
 //export callbackQGraphicsSvgItem_UpdateMicroFocus
 func callbackQGraphicsSvgItem_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).UpdateMicroFocusDefault()
@@ -480,7 +516,7 @@ func (ptr *QGraphicsSvgItem) UpdateMicroFocusDefault() {
 
 //export callbackQGraphicsSvgItem_VisibleChanged
 func callbackQGraphicsSvgItem_VisibleChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "visibleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "visibleChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -488,7 +524,7 @@ func callbackQGraphicsSvgItem_VisibleChanged(ptr unsafe.Pointer) {
 
 //export callbackQGraphicsSvgItem_XChanged
 func callbackQGraphicsSvgItem_XChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "xChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "xChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -496,7 +532,7 @@ func callbackQGraphicsSvgItem_XChanged(ptr unsafe.Pointer) {
 
 //export callbackQGraphicsSvgItem_YChanged
 func callbackQGraphicsSvgItem_YChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "yChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "yChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -504,7 +540,7 @@ func callbackQGraphicsSvgItem_YChanged(ptr unsafe.Pointer) {
 
 //export callbackQGraphicsSvgItem_ZChanged
 func callbackQGraphicsSvgItem_ZChanged(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "zChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "zChanged"); signal != nil {
 		signal.(func())()
 	}
 
@@ -512,7 +548,7 @@ func callbackQGraphicsSvgItem_ZChanged(ptr unsafe.Pointer) {
 
 //export callbackQGraphicsSvgItem_EventFilter
 func callbackQGraphicsSvgItem_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -528,7 +564,7 @@ func (ptr *QGraphicsSvgItem) EventFilterDefault(watched core.QObject_ITF, event
 
 //export callbackQGraphicsSvgItem_ChildEvent
 func callbackQGraphicsSvgItem_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -543,7 +579,7 @@ func (ptr *QGraphicsSvgItem) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQGraphicsSvgItem_ConnectNotify
 func callbackQGraphicsSvgItem_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -558,7 +594,7 @@ func (ptr *QGraphicsSvgItem) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQGraphicsSvgItem_CustomEvent
 func callbackQGraphicsSvgItem_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -573,7 +609,7 @@ func (ptr *QGraphicsSvgItem) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQGraphicsSvgItem_DeleteLater
 func callbackQGraphicsSvgItem_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).DeleteLaterDefault()
@@ -583,14 +619,14 @@ func callbackQGraphicsSvgItem_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QGraphicsSvgItem) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QGraphicsSvgItem_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQGraphicsSvgItem_Destroyed
 func callbackQGraphicsSvgItem_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -598,7 +634,7 @@ func callbackQGraphicsSvgItem_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer)
 
 //export callbackQGraphicsSvgItem_DisconnectNotify
 func callbackQGraphicsSvgItem_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -613,7 +649,7 @@ func (ptr *QGraphicsSvgItem) DisconnectNotifyDefault(sign core.QMetaMethod_ITF)
 
 //export callbackQGraphicsSvgItem_ObjectNameChanged
 func callbackQGraphicsSvgItem_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSvg_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -621,7 +657,7 @@ func callbackQGraphicsSvgItem_ObjectNameChanged(ptr unsafe.Pointer, objectName C
 
 //export callbackQGraphicsSvgItem_TimerEvent
 func callbackQGraphicsSvgItem_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -636,7 +672,7 @@ func (ptr *QGraphicsSvgItem) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQGraphicsSvgItem_MetaObject
 func callbackQGraphicsSvgItem_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -652,7 +688,7 @@ func (ptr *QGraphicsSvgItem) MetaObjectDefault() *core.QMetaObject {
 
 //export callbackQGraphicsSvgItem_ItemChange
 func callbackQGraphicsSvgItem_ItemChange(ptr unsafe.Pointer, change C.longlong, value unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "itemChange"); signal != nil {
+	if signal := qt.GetSignal(ptr, "itemChange"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(widgets.QGraphicsItem__GraphicsItemChange, *core.QVariant) *core.QVariant)(widgets.QGraphicsItem__GraphicsItemChange(change), core.NewQVariantFromPointer(value)))
 	}
 
@@ -670,7 +706,7 @@ func (ptr *QGraphicsSvgItem) ItemChangeDefault(change widgets.QGraphicsItem__Gra
 
 //export callbackQGraphicsSvgItem_SceneEvent
 func callbackQGraphicsSvgItem_SceneEvent(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -686,7 +722,7 @@ func (ptr *QGraphicsSvgItem) SceneEventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQGraphicsSvgItem_SceneEventFilter
 func callbackQGraphicsSvgItem_SceneEventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sceneEventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sceneEventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*widgets.QGraphicsItem, *core.QEvent) bool)(widgets.NewQGraphicsItemFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -702,7 +738,7 @@ func (ptr *QGraphicsSvgItem) SceneEventFilterDefault(watched widgets.QGraphicsIt
 
 //export callbackQGraphicsSvgItem_Advance
 func callbackQGraphicsSvgItem_Advance(ptr unsafe.Pointer, phase C.int) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "advance"); signal != nil {
+	if signal := qt.GetSignal(ptr, "advance"); signal != nil {
 		signal.(func(int))(int(int32(phase)))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).AdvanceDefault(int(int32(phase)))
@@ -717,7 +753,7 @@ func (ptr *QGraphicsSvgItem) AdvanceDefault(phase int) {
 
 //export callbackQGraphicsSvgItem_ContextMenuEvent
 func callbackQGraphicsSvgItem_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneContextMenuEvent))(widgets.NewQGraphicsSceneContextMenuEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).ContextMenuEventDefault(widgets.NewQGraphicsSceneContextMenuEventFromPointer(event))
@@ -732,7 +768,7 @@ func (ptr *QGraphicsSvgItem) ContextMenuEventDefault(event widgets.QGraphicsScen
 
 //export callbackQGraphicsSvgItem_DragEnterEvent
 func callbackQGraphicsSvgItem_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneDragDropEvent))(widgets.NewQGraphicsSceneDragDropEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).DragEnterEventDefault(widgets.NewQGraphicsSceneDragDropEventFromPointer(event))
@@ -747,7 +783,7 @@ func (ptr *QGraphicsSvgItem) DragEnterEventDefault(event widgets.QGraphicsSceneD
 
 //export callbackQGraphicsSvgItem_DragLeaveEvent
 func callbackQGraphicsSvgItem_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneDragDropEvent))(widgets.NewQGraphicsSceneDragDropEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).DragLeaveEventDefault(widgets.NewQGraphicsSceneDragDropEventFromPointer(event))
@@ -762,7 +798,7 @@ func (ptr *QGraphicsSvgItem) DragLeaveEventDefault(event widgets.QGraphicsSceneD
 
 //export callbackQGraphicsSvgItem_DragMoveEvent
 func callbackQGraphicsSvgItem_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneDragDropEvent))(widgets.NewQGraphicsSceneDragDropEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).DragMoveEventDefault(widgets.NewQGraphicsSceneDragDropEventFromPointer(event))
@@ -777,7 +813,7 @@ func (ptr *QGraphicsSvgItem) DragMoveEventDefault(event widgets.QGraphicsSceneDr
 
 //export callbackQGraphicsSvgItem_DropEvent
 func callbackQGraphicsSvgItem_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneDragDropEvent))(widgets.NewQGraphicsSceneDragDropEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).DropEventDefault(widgets.NewQGraphicsSceneDragDropEventFromPointer(event))
@@ -792,7 +828,7 @@ func (ptr *QGraphicsSvgItem) DropEventDefault(event widgets.QGraphicsSceneDragDr
 
 //export callbackQGraphicsSvgItem_FocusInEvent
 func callbackQGraphicsSvgItem_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -807,7 +843,7 @@ func (ptr *QGraphicsSvgItem) FocusInEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQGraphicsSvgItem_FocusOutEvent
 func callbackQGraphicsSvgItem_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -822,7 +858,7 @@ func (ptr *QGraphicsSvgItem) FocusOutEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQGraphicsSvgItem_HoverEnterEvent
 func callbackQGraphicsSvgItem_HoverEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hoverEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hoverEnterEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneHoverEvent))(widgets.NewQGraphicsSceneHoverEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).HoverEnterEventDefault(widgets.NewQGraphicsSceneHoverEventFromPointer(event))
@@ -837,7 +873,7 @@ func (ptr *QGraphicsSvgItem) HoverEnterEventDefault(event widgets.QGraphicsScene
 
 //export callbackQGraphicsSvgItem_HoverLeaveEvent
 func callbackQGraphicsSvgItem_HoverLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hoverLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hoverLeaveEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneHoverEvent))(widgets.NewQGraphicsSceneHoverEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).HoverLeaveEventDefault(widgets.NewQGraphicsSceneHoverEventFromPointer(event))
@@ -852,7 +888,7 @@ func (ptr *QGraphicsSvgItem) HoverLeaveEventDefault(event widgets.QGraphicsScene
 
 //export callbackQGraphicsSvgItem_HoverMoveEvent
 func callbackQGraphicsSvgItem_HoverMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hoverMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hoverMoveEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneHoverEvent))(widgets.NewQGraphicsSceneHoverEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).HoverMoveEventDefault(widgets.NewQGraphicsSceneHoverEventFromPointer(event))
@@ -867,7 +903,7 @@ func (ptr *QGraphicsSvgItem) HoverMoveEventDefault(event widgets.QGraphicsSceneH
 
 //export callbackQGraphicsSvgItem_InputMethodEvent
 func callbackQGraphicsSvgItem_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -882,7 +918,7 @@ func (ptr *QGraphicsSvgItem) InputMethodEventDefault(event gui.QInputMethodEvent
 
 //export callbackQGraphicsSvgItem_KeyPressEvent
 func callbackQGraphicsSvgItem_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -897,7 +933,7 @@ func (ptr *QGraphicsSvgItem) KeyPressEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQGraphicsSvgItem_KeyReleaseEvent
 func callbackQGraphicsSvgItem_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -912,7 +948,7 @@ func (ptr *QGraphicsSvgItem) KeyReleaseEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQGraphicsSvgItem_MouseDoubleClickEvent
 func callbackQGraphicsSvgItem_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneMouseEvent))(widgets.NewQGraphicsSceneMouseEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).MouseDoubleClickEventDefault(widgets.NewQGraphicsSceneMouseEventFromPointer(event))
@@ -927,7 +963,7 @@ func (ptr *QGraphicsSvgItem) MouseDoubleClickEventDefault(event widgets.QGraphic
 
 //export callbackQGraphicsSvgItem_MouseMoveEvent
 func callbackQGraphicsSvgItem_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneMouseEvent))(widgets.NewQGraphicsSceneMouseEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).MouseMoveEventDefault(widgets.NewQGraphicsSceneMouseEventFromPointer(event))
@@ -942,7 +978,7 @@ func (ptr *QGraphicsSvgItem) MouseMoveEventDefault(event widgets.QGraphicsSceneM
 
 //export callbackQGraphicsSvgItem_MousePressEvent
 func callbackQGraphicsSvgItem_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneMouseEvent))(widgets.NewQGraphicsSceneMouseEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).MousePressEventDefault(widgets.NewQGraphicsSceneMouseEventFromPointer(event))
@@ -957,7 +993,7 @@ func (ptr *QGraphicsSvgItem) MousePressEventDefault(event widgets.QGraphicsScene
 
 //export callbackQGraphicsSvgItem_MouseReleaseEvent
 func callbackQGraphicsSvgItem_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneMouseEvent))(widgets.NewQGraphicsSceneMouseEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).MouseReleaseEventDefault(widgets.NewQGraphicsSceneMouseEventFromPointer(event))
@@ -972,7 +1008,7 @@ func (ptr *QGraphicsSvgItem) MouseReleaseEventDefault(event widgets.QGraphicsSce
 
 //export callbackQGraphicsSvgItem_WheelEvent
 func callbackQGraphicsSvgItem_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*widgets.QGraphicsSceneWheelEvent))(widgets.NewQGraphicsSceneWheelEventFromPointer(event))
 	} else {
 		NewQGraphicsSvgItemFromPointer(ptr).WheelEventDefault(widgets.NewQGraphicsSceneWheelEventFromPointer(event))
@@ -987,7 +1023,7 @@ func (ptr *QGraphicsSvgItem) WheelEventDefault(event widgets.QGraphicsSceneWheel
 
 //export callbackQGraphicsSvgItem_OpaqueArea
 func callbackQGraphicsSvgItem_OpaqueArea(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "opaqueArea"); signal != nil {
+	if signal := qt.GetSignal(ptr, "opaqueArea"); signal != nil {
 		return gui.PointerFromQPainterPath(signal.(func() *gui.QPainterPath)())
 	}
 
@@ -1005,7 +1041,7 @@ func (ptr *QGraphicsSvgItem) OpaqueAreaDefault() *gui.QPainterPath {
 
 //export callbackQGraphicsSvgItem_Shape
 func callbackQGraphicsSvgItem_Shape(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "shape"); signal != nil {
+	if signal := qt.GetSignal(ptr, "shape"); signal != nil {
 		return gui.PointerFromQPainterPath(signal.(func() *gui.QPainterPath)())
 	}
 
@@ -1023,7 +1059,7 @@ func (ptr *QGraphicsSvgItem) ShapeDefault() *gui.QPainterPath {
 
 //export callbackQGraphicsSvgItem_InputMethodQuery
 func callbackQGraphicsSvgItem_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -1041,7 +1077,7 @@ func (ptr *QGraphicsSvgItem) InputMethodQueryDefault(query core.Qt__InputMethodQ
 
 //export callbackQGraphicsSvgItem_CollidesWithItem
 func callbackQGraphicsSvgItem_CollidesWithItem(ptr unsafe.Pointer, other unsafe.Pointer, mode C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "collidesWithItem"); signal != nil {
+	if signal := qt.GetSignal(ptr, "collidesWithItem"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*widgets.QGraphicsItem, core.Qt__ItemSelectionMode) bool)(widgets.NewQGraphicsItemFromPointer(other), core.Qt__ItemSelectionMode(mode)))))
 	}
 
@@ -1057,7 +1093,7 @@ func (ptr *QGraphicsSvgItem) CollidesWithItemDefault(other widgets.QGraphicsItem
 
 //export callbackQGraphicsSvgItem_CollidesWithPath
 func callbackQGraphicsSvgItem_CollidesWithPath(ptr unsafe.Pointer, path unsafe.Pointer, mode C.longlong) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "collidesWithPath"); signal != nil {
+	if signal := qt.GetSignal(ptr, "collidesWithPath"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*gui.QPainterPath, core.Qt__ItemSelectionMode) bool)(gui.NewQPainterPathFromPointer(path), core.Qt__ItemSelectionMode(mode)))))
 	}
 
@@ -1073,7 +1109,7 @@ func (ptr *QGraphicsSvgItem) CollidesWithPathDefault(path gui.QPainterPath_ITF,
 
 //export callbackQGraphicsSvgItem_Contains
 func callbackQGraphicsSvgItem_Contains(ptr unsafe.Pointer, point unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contains"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contains"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QPointF) bool)(core.NewQPointFFromPointer(point)))))
 	}
 
@@ -1089,7 +1125,7 @@ func (ptr *QGraphicsSvgItem) ContainsDefault(point core.QPointF_ITF) bool {
 
 //export callbackQGraphicsSvgItem_IsObscuredBy
 func callbackQGraphicsSvgItem_IsObscuredBy(ptr unsafe.Pointer, item unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "isObscuredBy"); signal != nil {
+	if signal := qt.GetSignal(ptr, "isObscuredBy"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*widgets.QGraphicsItem) bool)(widgets.NewQGraphicsItemFromPointer(item)))))
 	}
 
@@ -1202,7 +1238,7 @@ func (ptr *QSvgGenerator) SetViewBox2(viewBox core.QRectF_ITF) {
 func (ptr *QSvgGenerator) DestroyQSvgGenerator() {
 	if ptr.Pointer() != nil {
 		C.QSvgGenerator_DestroyQSvgGenerator(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1210,7 +1246,7 @@ func (ptr *QSvgGenerator) DestroyQSvgGenerator() {
 func (ptr *QSvgGenerator) OutputDevice() *core.QIODevice {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQIODeviceFromPointer(C.QSvgGenerator_OutputDevice(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1220,7 +1256,7 @@ func (ptr *QSvgGenerator) OutputDevice() *core.QIODevice {
 
 //export callbackQSvgGenerator_PaintEngine
 func callbackQSvgGenerator_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -1230,14 +1266,14 @@ func callbackQSvgGenerator_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QSvgGenerator) ConnectPaintEngine(f func() *gui.QPaintEngine) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "paintEngine", f)
+		qt.ConnectSignal(ptr.Pointer(), "paintEngine", f)
 	}
 }
 
 func (ptr *QSvgGenerator) DisconnectPaintEngine() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "paintEngine")
+		qt.DisconnectSignal(ptr.Pointer(), "paintEngine")
 	}
 }
 
@@ -1350,7 +1386,7 @@ func NewQSvgRendererFromPointer(ptr unsafe.Pointer) *QSvgRenderer {
 }
 func NewQSvgRenderer(parent core.QObject_ITF) *QSvgRenderer {
 	var tmpValue = NewQSvgRendererFromPointer(C.QSvgRenderer_NewQSvgRenderer(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1358,7 +1394,7 @@ func NewQSvgRenderer(parent core.QObject_ITF) *QSvgRenderer {
 
 func NewQSvgRenderer4(contents core.QXmlStreamReader_ITF, parent core.QObject_ITF) *QSvgRenderer {
 	var tmpValue = NewQSvgRendererFromPointer(C.QSvgRenderer_NewQSvgRenderer4(core.PointerFromQXmlStreamReader(contents), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1366,7 +1402,7 @@ func NewQSvgRenderer4(contents core.QXmlStreamReader_ITF, parent core.QObject_IT
 
 func NewQSvgRenderer3(contents core.QByteArray_ITF, parent core.QObject_ITF) *QSvgRenderer {
 	var tmpValue = NewQSvgRendererFromPointer(C.QSvgRenderer_NewQSvgRenderer3(core.PointerFromQByteArray(contents), core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1376,7 +1412,7 @@ func NewQSvgRenderer2(filename string, parent core.QObject_ITF) *QSvgRenderer {
 	var filenameC = C.CString(filename)
 	defer C.free(unsafe.Pointer(filenameC))
 	var tmpValue = NewQSvgRendererFromPointer(C.QSvgRenderer_NewQSvgRenderer2(filenameC, core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -1384,7 +1420,7 @@ func NewQSvgRenderer2(filename string, parent core.QObject_ITF) *QSvgRenderer {
 
 //export callbackQSvgRenderer_Load3
 func callbackQSvgRenderer_Load3(ptr unsafe.Pointer, contents unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "load3"); signal != nil {
+	if signal := qt.GetSignal(ptr, "load3"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QXmlStreamReader) bool)(core.NewQXmlStreamReaderFromPointer(contents)))))
 	}
 
@@ -1394,14 +1430,14 @@ func callbackQSvgRenderer_Load3(ptr unsafe.Pointer, contents unsafe.Pointer) C.c
 func (ptr *QSvgRenderer) ConnectLoad3(f func(contents *core.QXmlStreamReader) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "load3", f)
+		qt.ConnectSignal(ptr.Pointer(), "load3", f)
 	}
 }
 
 func (ptr *QSvgRenderer) DisconnectLoad3() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "load3")
+		qt.DisconnectSignal(ptr.Pointer(), "load3")
 	}
 }
 
@@ -1421,7 +1457,7 @@ func (ptr *QSvgRenderer) Load3Default(contents core.QXmlStreamReader_ITF) bool {
 
 //export callbackQSvgRenderer_Load2
 func callbackQSvgRenderer_Load2(ptr unsafe.Pointer, contents unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "load2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "load2"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray) bool)(core.NewQByteArrayFromPointer(contents)))))
 	}
 
@@ -1431,14 +1467,14 @@ func callbackQSvgRenderer_Load2(ptr unsafe.Pointer, contents unsafe.Pointer) C.c
 func (ptr *QSvgRenderer) ConnectLoad2(f func(contents *core.QByteArray) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "load2", f)
+		qt.ConnectSignal(ptr.Pointer(), "load2", f)
 	}
 }
 
 func (ptr *QSvgRenderer) DisconnectLoad2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "load2")
+		qt.DisconnectSignal(ptr.Pointer(), "load2")
 	}
 }
 
@@ -1458,7 +1494,7 @@ func (ptr *QSvgRenderer) Load2Default(contents core.QByteArray_ITF) bool {
 
 //export callbackQSvgRenderer_Load
 func callbackQSvgRenderer_Load(ptr unsafe.Pointer, filename C.struct_QtSvg_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "load"); signal != nil {
+	if signal := qt.GetSignal(ptr, "load"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(filename)))))
 	}
 
@@ -1468,14 +1504,14 @@ func callbackQSvgRenderer_Load(ptr unsafe.Pointer, filename C.struct_QtSvg_Packe
 func (ptr *QSvgRenderer) ConnectLoad(f func(filename string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "load", f)
+		qt.ConnectSignal(ptr.Pointer(), "load", f)
 	}
 }
 
 func (ptr *QSvgRenderer) DisconnectLoad() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "load")
+		qt.DisconnectSignal(ptr.Pointer(), "load")
 	}
 }
 
@@ -1499,7 +1535,7 @@ func (ptr *QSvgRenderer) LoadDefault(filename string) bool {
 
 //export callbackQSvgRenderer_Render
 func callbackQSvgRenderer_Render(ptr unsafe.Pointer, painter unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "render"); signal != nil {
+	if signal := qt.GetSignal(ptr, "render"); signal != nil {
 		signal.(func(*gui.QPainter))(gui.NewQPainterFromPointer(painter))
 	} else {
 		NewQSvgRendererFromPointer(ptr).RenderDefault(gui.NewQPainterFromPointer(painter))
@@ -1509,14 +1545,14 @@ func callbackQSvgRenderer_Render(ptr unsafe.Pointer, painter unsafe.Pointer) {
 func (ptr *QSvgRenderer) ConnectRender(f func(painter *gui.QPainter)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "render", f)
+		qt.ConnectSignal(ptr.Pointer(), "render", f)
 	}
 }
 
 func (ptr *QSvgRenderer) DisconnectRender() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "render")
+		qt.DisconnectSignal(ptr.Pointer(), "render")
 	}
 }
 
@@ -1534,7 +1570,7 @@ func (ptr *QSvgRenderer) RenderDefault(painter gui.QPainter_ITF) {
 
 //export callbackQSvgRenderer_Render2
 func callbackQSvgRenderer_Render2(ptr unsafe.Pointer, painter unsafe.Pointer, bounds unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "render2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "render2"); signal != nil {
 		signal.(func(*gui.QPainter, *core.QRectF))(gui.NewQPainterFromPointer(painter), core.NewQRectFFromPointer(bounds))
 	} else {
 		NewQSvgRendererFromPointer(ptr).Render2Default(gui.NewQPainterFromPointer(painter), core.NewQRectFFromPointer(bounds))
@@ -1544,14 +1580,14 @@ func callbackQSvgRenderer_Render2(ptr unsafe.Pointer, painter unsafe.Pointer, bo
 func (ptr *QSvgRenderer) ConnectRender2(f func(painter *gui.QPainter, bounds *core.QRectF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "render2", f)
+		qt.ConnectSignal(ptr.Pointer(), "render2", f)
 	}
 }
 
 func (ptr *QSvgRenderer) DisconnectRender2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "render2")
+		qt.DisconnectSignal(ptr.Pointer(), "render2")
 	}
 }
 
@@ -1569,7 +1605,7 @@ func (ptr *QSvgRenderer) Render2Default(painter gui.QPainter_ITF, bounds core.QR
 
 //export callbackQSvgRenderer_Render3
 func callbackQSvgRenderer_Render3(ptr unsafe.Pointer, painter unsafe.Pointer, elementId C.struct_QtSvg_PackedString, bounds unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "render3"); signal != nil {
+	if signal := qt.GetSignal(ptr, "render3"); signal != nil {
 		signal.(func(*gui.QPainter, string, *core.QRectF))(gui.NewQPainterFromPointer(painter), cGoUnpackString(elementId), core.NewQRectFFromPointer(bounds))
 	} else {
 		NewQSvgRendererFromPointer(ptr).Render3Default(gui.NewQPainterFromPointer(painter), cGoUnpackString(elementId), core.NewQRectFFromPointer(bounds))
@@ -1579,14 +1615,14 @@ func callbackQSvgRenderer_Render3(ptr unsafe.Pointer, painter unsafe.Pointer, el
 func (ptr *QSvgRenderer) ConnectRender3(f func(painter *gui.QPainter, elementId string, bounds *core.QRectF)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "render3", f)
+		qt.ConnectSignal(ptr.Pointer(), "render3", f)
 	}
 }
 
 func (ptr *QSvgRenderer) DisconnectRender3() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "render3")
+		qt.DisconnectSignal(ptr.Pointer(), "render3")
 	}
 }
 
@@ -1608,7 +1644,7 @@ func (ptr *QSvgRenderer) Render3Default(painter gui.QPainter_ITF, elementId stri
 
 //export callbackQSvgRenderer_RepaintNeeded
 func callbackQSvgRenderer_RepaintNeeded(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaintNeeded"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaintNeeded"); signal != nil {
 		signal.(func())()
 	}
 
@@ -1617,14 +1653,14 @@ func callbackQSvgRenderer_RepaintNeeded(ptr unsafe.Pointer) {
 func (ptr *QSvgRenderer) ConnectRepaintNeeded(f func()) {
 	if ptr.Pointer() != nil {
 		C.QSvgRenderer_ConnectRepaintNeeded(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "repaintNeeded", f)
+		qt.ConnectSignal(ptr.Pointer(), "repaintNeeded", f)
 	}
 }
 
 func (ptr *QSvgRenderer) DisconnectRepaintNeeded() {
 	if ptr.Pointer() != nil {
 		C.QSvgRenderer_DisconnectRepaintNeeded(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "repaintNeeded")
+		qt.DisconnectSignal(ptr.Pointer(), "repaintNeeded")
 	}
 }
 
@@ -1655,7 +1691,7 @@ func (ptr *QSvgRenderer) SetViewBox2(viewbox core.QRectF_ITF) {
 func (ptr *QSvgRenderer) DestroyQSvgRenderer() {
 	if ptr.Pointer() != nil {
 		C.QSvgRenderer_DestroyQSvgRenderer(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -1750,7 +1786,7 @@ func (ptr *QSvgRenderer) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSvgRenderer) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSvgRenderer___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1771,7 +1807,7 @@ func (ptr *QSvgRenderer) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSvgRenderer) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSvgRenderer___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1792,7 +1828,7 @@ func (ptr *QSvgRenderer) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSvgRenderer) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSvgRenderer___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1813,7 +1849,7 @@ func (ptr *QSvgRenderer) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSvgRenderer) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSvgRenderer___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -1833,7 +1869,7 @@ func (ptr *QSvgRenderer) __children_newList() unsafe.Pointer {
 
 //export callbackQSvgRenderer_Event
 func callbackQSvgRenderer_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -1849,7 +1885,7 @@ func (ptr *QSvgRenderer) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQSvgRenderer_EventFilter
 func callbackQSvgRenderer_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -1865,7 +1901,7 @@ func (ptr *QSvgRenderer) EventFilterDefault(watched core.QObject_ITF, event core
 
 //export callbackQSvgRenderer_ChildEvent
 func callbackQSvgRenderer_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSvgRendererFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -1880,7 +1916,7 @@ func (ptr *QSvgRenderer) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSvgRenderer_ConnectNotify
 func callbackQSvgRenderer_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSvgRendererFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1895,7 +1931,7 @@ func (ptr *QSvgRenderer) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSvgRenderer_CustomEvent
 func callbackQSvgRenderer_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSvgRendererFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -1910,7 +1946,7 @@ func (ptr *QSvgRenderer) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSvgRenderer_DeleteLater
 func callbackQSvgRenderer_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgRendererFromPointer(ptr).DeleteLaterDefault()
@@ -1920,14 +1956,14 @@ func callbackQSvgRenderer_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSvgRenderer) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSvgRenderer_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSvgRenderer_Destroyed
 func callbackQSvgRenderer_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -1935,7 +1971,7 @@ func callbackQSvgRenderer_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSvgRenderer_DisconnectNotify
 func callbackQSvgRenderer_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSvgRendererFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -1950,7 +1986,7 @@ func (ptr *QSvgRenderer) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSvgRenderer_ObjectNameChanged
 func callbackQSvgRenderer_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSvg_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -1958,7 +1994,7 @@ func callbackQSvgRenderer_ObjectNameChanged(ptr unsafe.Pointer, objectName C.str
 
 //export callbackQSvgRenderer_TimerEvent
 func callbackQSvgRenderer_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSvgRendererFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -1973,7 +2009,7 @@ func (ptr *QSvgRenderer) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSvgRenderer_MetaObject
 func callbackQSvgRenderer_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -2027,7 +2063,7 @@ func NewQSvgWidgetFromPointer(ptr unsafe.Pointer) *QSvgWidget {
 }
 func NewQSvgWidget(parent widgets.QWidget_ITF) *QSvgWidget {
 	var tmpValue = NewQSvgWidgetFromPointer(C.QSvgWidget_NewQSvgWidget(widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2037,7 +2073,7 @@ func NewQSvgWidget2(file string, parent widgets.QWidget_ITF) *QSvgWidget {
 	var fileC = C.CString(file)
 	defer C.free(unsafe.Pointer(fileC))
 	var tmpValue = NewQSvgWidgetFromPointer(C.QSvgWidget_NewQSvgWidget2(fileC, widgets.PointerFromQWidget(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -2045,7 +2081,7 @@ func NewQSvgWidget2(file string, parent widgets.QWidget_ITF) *QSvgWidget {
 
 //export callbackQSvgWidget_Load2
 func callbackQSvgWidget_Load2(ptr unsafe.Pointer, contents unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "load2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "load2"); signal != nil {
 		signal.(func(*core.QByteArray))(core.NewQByteArrayFromPointer(contents))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).Load2Default(core.NewQByteArrayFromPointer(contents))
@@ -2055,14 +2091,14 @@ func callbackQSvgWidget_Load2(ptr unsafe.Pointer, contents unsafe.Pointer) {
 func (ptr *QSvgWidget) ConnectLoad2(f func(contents *core.QByteArray)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "load2", f)
+		qt.ConnectSignal(ptr.Pointer(), "load2", f)
 	}
 }
 
 func (ptr *QSvgWidget) DisconnectLoad2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "load2")
+		qt.DisconnectSignal(ptr.Pointer(), "load2")
 	}
 }
 
@@ -2080,7 +2116,7 @@ func (ptr *QSvgWidget) Load2Default(contents core.QByteArray_ITF) {
 
 //export callbackQSvgWidget_Load
 func callbackQSvgWidget_Load(ptr unsafe.Pointer, file C.struct_QtSvg_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "load"); signal != nil {
+	if signal := qt.GetSignal(ptr, "load"); signal != nil {
 		signal.(func(string))(cGoUnpackString(file))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).LoadDefault(cGoUnpackString(file))
@@ -2090,14 +2126,14 @@ func callbackQSvgWidget_Load(ptr unsafe.Pointer, file C.struct_QtSvg_PackedStrin
 func (ptr *QSvgWidget) ConnectLoad(f func(file string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "load", f)
+		qt.ConnectSignal(ptr.Pointer(), "load", f)
 	}
 }
 
 func (ptr *QSvgWidget) DisconnectLoad() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "load")
+		qt.DisconnectSignal(ptr.Pointer(), "load")
 	}
 }
 
@@ -2119,7 +2155,7 @@ func (ptr *QSvgWidget) LoadDefault(file string) {
 
 //export callbackQSvgWidget_PaintEvent
 func callbackQSvgWidget_PaintEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEvent"); signal != nil {
 		signal.(func(*gui.QPaintEvent))(gui.NewQPaintEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).PaintEventDefault(gui.NewQPaintEventFromPointer(event))
@@ -2135,14 +2171,14 @@ func (ptr *QSvgWidget) PaintEventDefault(event gui.QPaintEvent_ITF) {
 func (ptr *QSvgWidget) DestroyQSvgWidget() {
 	if ptr.Pointer() != nil {
 		C.QSvgWidget_DestroyQSvgWidget(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSvgWidget_SizeHint
 func callbackQSvgWidget_SizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -2161,7 +2197,7 @@ func (ptr *QSvgWidget) SizeHintDefault() *core.QSize {
 func (ptr *QSvgWidget) Renderer() *QSvgRenderer {
 	if ptr.Pointer() != nil {
 		var tmpValue = NewQSvgRendererFromPointer(C.QSvgWidget_Renderer(ptr.Pointer()))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2172,7 +2208,7 @@ func (ptr *QSvgWidget) Renderer() *QSvgRenderer {
 func (ptr *QSvgWidget) __addActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QSvgWidget___addActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2193,7 +2229,7 @@ func (ptr *QSvgWidget) __addActions_actions_newList() unsafe.Pointer {
 func (ptr *QSvgWidget) __insertActions_actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QSvgWidget___insertActions_actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2214,7 +2250,7 @@ func (ptr *QSvgWidget) __insertActions_actions_newList() unsafe.Pointer {
 func (ptr *QSvgWidget) __actions_atList(i int) *widgets.QAction {
 	if ptr.Pointer() != nil {
 		var tmpValue = widgets.NewQActionFromPointer(C.QSvgWidget___actions_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2254,7 +2290,7 @@ func (ptr *QSvgWidget) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QSvgWidget) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSvgWidget___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2275,7 +2311,7 @@ func (ptr *QSvgWidget) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QSvgWidget) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSvgWidget___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2296,7 +2332,7 @@ func (ptr *QSvgWidget) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QSvgWidget) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSvgWidget___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2317,7 +2353,7 @@ func (ptr *QSvgWidget) __findChildren_newList() unsafe.Pointer {
 func (ptr *QSvgWidget) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QSvgWidget___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -2337,7 +2373,7 @@ func (ptr *QSvgWidget) __children_newList() unsafe.Pointer {
 
 //export callbackQSvgWidget_Close
 func callbackQSvgWidget_Close(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "close"); signal != nil {
+	if signal := qt.GetSignal(ptr, "close"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2353,7 +2389,7 @@ func (ptr *QSvgWidget) CloseDefault() bool {
 
 //export callbackQSvgWidget_Event
 func callbackQSvgWidget_Event(ptr unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(event)))))
 	}
 
@@ -2369,7 +2405,7 @@ func (ptr *QSvgWidget) EventDefault(event core.QEvent_ITF) bool {
 
 //export callbackQSvgWidget_FocusNextPrevChild
 func callbackQSvgWidget_FocusNextPrevChild(ptr unsafe.Pointer, next C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusNextPrevChild"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusNextPrevChild"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(bool) bool)(int8(next) != 0))))
 	}
 
@@ -2385,7 +2421,7 @@ func (ptr *QSvgWidget) FocusNextPrevChildDefault(next bool) bool {
 
 //export callbackQSvgWidget_NativeEvent
 func callbackQSvgWidget_NativeEvent(ptr unsafe.Pointer, eventType unsafe.Pointer, message unsafe.Pointer, result C.long) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "nativeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "nativeEvent"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QByteArray, unsafe.Pointer, int) bool)(core.NewQByteArrayFromPointer(eventType), message, int(int32(result))))))
 	}
 
@@ -2401,7 +2437,7 @@ func (ptr *QSvgWidget) NativeEventDefault(eventType core.QByteArray_ITF, message
 
 //export callbackQSvgWidget_ActionEvent
 func callbackQSvgWidget_ActionEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "actionEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "actionEvent"); signal != nil {
 		signal.(func(*gui.QActionEvent))(gui.NewQActionEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ActionEventDefault(gui.NewQActionEventFromPointer(event))
@@ -2416,7 +2452,7 @@ func (ptr *QSvgWidget) ActionEventDefault(event gui.QActionEvent_ITF) {
 
 //export callbackQSvgWidget_ChangeEvent
 func callbackQSvgWidget_ChangeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "changeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "changeEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ChangeEventDefault(core.NewQEventFromPointer(event))
@@ -2431,7 +2467,7 @@ func (ptr *QSvgWidget) ChangeEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSvgWidget_CloseEvent
 func callbackQSvgWidget_CloseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "closeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "closeEvent"); signal != nil {
 		signal.(func(*gui.QCloseEvent))(gui.NewQCloseEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).CloseEventDefault(gui.NewQCloseEventFromPointer(event))
@@ -2446,7 +2482,7 @@ func (ptr *QSvgWidget) CloseEventDefault(event gui.QCloseEvent_ITF) {
 
 //export callbackQSvgWidget_ContextMenuEvent
 func callbackQSvgWidget_ContextMenuEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contextMenuEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contextMenuEvent"); signal != nil {
 		signal.(func(*gui.QContextMenuEvent))(gui.NewQContextMenuEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ContextMenuEventDefault(gui.NewQContextMenuEventFromPointer(event))
@@ -2461,7 +2497,7 @@ func (ptr *QSvgWidget) ContextMenuEventDefault(event gui.QContextMenuEvent_ITF)
 
 //export callbackQSvgWidget_CustomContextMenuRequested
 func callbackQSvgWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customContextMenuRequested"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customContextMenuRequested"); signal != nil {
 		signal.(func(*core.QPoint))(core.NewQPointFromPointer(pos))
 	}
 
@@ -2469,7 +2505,7 @@ func callbackQSvgWidget_CustomContextMenuRequested(ptr unsafe.Pointer, pos unsaf
 
 //export callbackQSvgWidget_DragEnterEvent
 func callbackQSvgWidget_DragEnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragEnterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragEnterEvent"); signal != nil {
 		signal.(func(*gui.QDragEnterEvent))(gui.NewQDragEnterEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).DragEnterEventDefault(gui.NewQDragEnterEventFromPointer(event))
@@ -2484,7 +2520,7 @@ func (ptr *QSvgWidget) DragEnterEventDefault(event gui.QDragEnterEvent_ITF) {
 
 //export callbackQSvgWidget_DragLeaveEvent
 func callbackQSvgWidget_DragLeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragLeaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragLeaveEvent"); signal != nil {
 		signal.(func(*gui.QDragLeaveEvent))(gui.NewQDragLeaveEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).DragLeaveEventDefault(gui.NewQDragLeaveEventFromPointer(event))
@@ -2499,7 +2535,7 @@ func (ptr *QSvgWidget) DragLeaveEventDefault(event gui.QDragLeaveEvent_ITF) {
 
 //export callbackQSvgWidget_DragMoveEvent
 func callbackQSvgWidget_DragMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dragMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dragMoveEvent"); signal != nil {
 		signal.(func(*gui.QDragMoveEvent))(gui.NewQDragMoveEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).DragMoveEventDefault(gui.NewQDragMoveEventFromPointer(event))
@@ -2514,7 +2550,7 @@ func (ptr *QSvgWidget) DragMoveEventDefault(event gui.QDragMoveEvent_ITF) {
 
 //export callbackQSvgWidget_DropEvent
 func callbackQSvgWidget_DropEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "dropEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "dropEvent"); signal != nil {
 		signal.(func(*gui.QDropEvent))(gui.NewQDropEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).DropEventDefault(gui.NewQDropEventFromPointer(event))
@@ -2529,7 +2565,7 @@ func (ptr *QSvgWidget) DropEventDefault(event gui.QDropEvent_ITF) {
 
 //export callbackQSvgWidget_EnterEvent
 func callbackQSvgWidget_EnterEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "enterEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "enterEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).EnterEventDefault(core.NewQEventFromPointer(event))
@@ -2544,7 +2580,7 @@ func (ptr *QSvgWidget) EnterEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSvgWidget_FocusInEvent
 func callbackQSvgWidget_FocusInEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusInEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusInEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).FocusInEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -2559,7 +2595,7 @@ func (ptr *QSvgWidget) FocusInEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQSvgWidget_FocusOutEvent
 func callbackQSvgWidget_FocusOutEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "focusOutEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "focusOutEvent"); signal != nil {
 		signal.(func(*gui.QFocusEvent))(gui.NewQFocusEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).FocusOutEventDefault(gui.NewQFocusEventFromPointer(event))
@@ -2574,7 +2610,7 @@ func (ptr *QSvgWidget) FocusOutEventDefault(event gui.QFocusEvent_ITF) {
 
 //export callbackQSvgWidget_Hide
 func callbackQSvgWidget_Hide(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hide"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hide"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).HideDefault()
@@ -2589,7 +2625,7 @@ func (ptr *QSvgWidget) HideDefault() {
 
 //export callbackQSvgWidget_HideEvent
 func callbackQSvgWidget_HideEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hideEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hideEvent"); signal != nil {
 		signal.(func(*gui.QHideEvent))(gui.NewQHideEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).HideEventDefault(gui.NewQHideEventFromPointer(event))
@@ -2604,7 +2640,7 @@ func (ptr *QSvgWidget) HideEventDefault(event gui.QHideEvent_ITF) {
 
 //export callbackQSvgWidget_InputMethodEvent
 func callbackQSvgWidget_InputMethodEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodEvent"); signal != nil {
 		signal.(func(*gui.QInputMethodEvent))(gui.NewQInputMethodEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).InputMethodEventDefault(gui.NewQInputMethodEventFromPointer(event))
@@ -2619,7 +2655,7 @@ func (ptr *QSvgWidget) InputMethodEventDefault(event gui.QInputMethodEvent_ITF)
 
 //export callbackQSvgWidget_KeyPressEvent
 func callbackQSvgWidget_KeyPressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyPressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyPressEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).KeyPressEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -2634,7 +2670,7 @@ func (ptr *QSvgWidget) KeyPressEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQSvgWidget_KeyReleaseEvent
 func callbackQSvgWidget_KeyReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "keyReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "keyReleaseEvent"); signal != nil {
 		signal.(func(*gui.QKeyEvent))(gui.NewQKeyEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).KeyReleaseEventDefault(gui.NewQKeyEventFromPointer(event))
@@ -2649,7 +2685,7 @@ func (ptr *QSvgWidget) KeyReleaseEventDefault(event gui.QKeyEvent_ITF) {
 
 //export callbackQSvgWidget_LeaveEvent
 func callbackQSvgWidget_LeaveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "leaveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "leaveEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).LeaveEventDefault(core.NewQEventFromPointer(event))
@@ -2664,7 +2700,7 @@ func (ptr *QSvgWidget) LeaveEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSvgWidget_Lower
 func callbackQSvgWidget_Lower(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lower"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lower"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).LowerDefault()
@@ -2679,7 +2715,7 @@ func (ptr *QSvgWidget) LowerDefault() {
 
 //export callbackQSvgWidget_MouseDoubleClickEvent
 func callbackQSvgWidget_MouseDoubleClickEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseDoubleClickEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseDoubleClickEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).MouseDoubleClickEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2694,7 +2730,7 @@ func (ptr *QSvgWidget) MouseDoubleClickEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQSvgWidget_MouseMoveEvent
 func callbackQSvgWidget_MouseMoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseMoveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseMoveEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).MouseMoveEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2709,7 +2745,7 @@ func (ptr *QSvgWidget) MouseMoveEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQSvgWidget_MousePressEvent
 func callbackQSvgWidget_MousePressEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mousePressEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mousePressEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).MousePressEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2724,7 +2760,7 @@ func (ptr *QSvgWidget) MousePressEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQSvgWidget_MouseReleaseEvent
 func callbackQSvgWidget_MouseReleaseEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "mouseReleaseEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "mouseReleaseEvent"); signal != nil {
 		signal.(func(*gui.QMouseEvent))(gui.NewQMouseEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).MouseReleaseEventDefault(gui.NewQMouseEventFromPointer(event))
@@ -2739,7 +2775,7 @@ func (ptr *QSvgWidget) MouseReleaseEventDefault(event gui.QMouseEvent_ITF) {
 
 //export callbackQSvgWidget_MoveEvent
 func callbackQSvgWidget_MoveEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "moveEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "moveEvent"); signal != nil {
 		signal.(func(*gui.QMoveEvent))(gui.NewQMoveEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).MoveEventDefault(gui.NewQMoveEventFromPointer(event))
@@ -2754,7 +2790,7 @@ func (ptr *QSvgWidget) MoveEventDefault(event gui.QMoveEvent_ITF) {
 
 //export callbackQSvgWidget_Raise
 func callbackQSvgWidget_Raise(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "raise"); signal != nil {
+	if signal := qt.GetSignal(ptr, "raise"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).RaiseDefault()
@@ -2769,7 +2805,7 @@ func (ptr *QSvgWidget) RaiseDefault() {
 
 //export callbackQSvgWidget_Repaint
 func callbackQSvgWidget_Repaint(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "repaint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "repaint"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).RepaintDefault()
@@ -2784,7 +2820,7 @@ func (ptr *QSvgWidget) RepaintDefault() {
 
 //export callbackQSvgWidget_ResizeEvent
 func callbackQSvgWidget_ResizeEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "resizeEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "resizeEvent"); signal != nil {
 		signal.(func(*gui.QResizeEvent))(gui.NewQResizeEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ResizeEventDefault(gui.NewQResizeEventFromPointer(event))
@@ -2799,7 +2835,7 @@ func (ptr *QSvgWidget) ResizeEventDefault(event gui.QResizeEvent_ITF) {
 
 //export callbackQSvgWidget_SetDisabled
 func callbackQSvgWidget_SetDisabled(ptr unsafe.Pointer, disable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDisabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDisabled"); signal != nil {
 		signal.(func(bool))(int8(disable) != 0)
 	} else {
 		NewQSvgWidgetFromPointer(ptr).SetDisabledDefault(int8(disable) != 0)
@@ -2814,7 +2850,7 @@ func (ptr *QSvgWidget) SetDisabledDefault(disable bool) {
 
 //export callbackQSvgWidget_SetEnabled
 func callbackQSvgWidget_SetEnabled(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEnabled"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEnabled"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQSvgWidgetFromPointer(ptr).SetEnabledDefault(int8(vbo) != 0)
@@ -2829,7 +2865,7 @@ func (ptr *QSvgWidget) SetEnabledDefault(vbo bool) {
 
 //export callbackQSvgWidget_SetFocus2
 func callbackQSvgWidget_SetFocus2(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFocus2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFocus2"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).SetFocus2Default()
@@ -2844,7 +2880,7 @@ func (ptr *QSvgWidget) SetFocus2Default() {
 
 //export callbackQSvgWidget_SetHidden
 func callbackQSvgWidget_SetHidden(ptr unsafe.Pointer, hidden C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setHidden"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setHidden"); signal != nil {
 		signal.(func(bool))(int8(hidden) != 0)
 	} else {
 		NewQSvgWidgetFromPointer(ptr).SetHiddenDefault(int8(hidden) != 0)
@@ -2859,7 +2895,7 @@ func (ptr *QSvgWidget) SetHiddenDefault(hidden bool) {
 
 //export callbackQSvgWidget_SetStyleSheet
 func callbackQSvgWidget_SetStyleSheet(ptr unsafe.Pointer, styleSheet C.struct_QtSvg_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setStyleSheet"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setStyleSheet"); signal != nil {
 		signal.(func(string))(cGoUnpackString(styleSheet))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).SetStyleSheetDefault(cGoUnpackString(styleSheet))
@@ -2876,7 +2912,7 @@ func (ptr *QSvgWidget) SetStyleSheetDefault(styleSheet string) {
 
 //export callbackQSvgWidget_SetVisible
 func callbackQSvgWidget_SetVisible(ptr unsafe.Pointer, visible C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setVisible"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setVisible"); signal != nil {
 		signal.(func(bool))(int8(visible) != 0)
 	} else {
 		NewQSvgWidgetFromPointer(ptr).SetVisibleDefault(int8(visible) != 0)
@@ -2891,7 +2927,7 @@ func (ptr *QSvgWidget) SetVisibleDefault(visible bool) {
 
 //export callbackQSvgWidget_SetWindowModified
 func callbackQSvgWidget_SetWindowModified(ptr unsafe.Pointer, vbo C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowModified"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowModified"); signal != nil {
 		signal.(func(bool))(int8(vbo) != 0)
 	} else {
 		NewQSvgWidgetFromPointer(ptr).SetWindowModifiedDefault(int8(vbo) != 0)
@@ -2906,7 +2942,7 @@ func (ptr *QSvgWidget) SetWindowModifiedDefault(vbo bool) {
 
 //export callbackQSvgWidget_SetWindowTitle
 func callbackQSvgWidget_SetWindowTitle(ptr unsafe.Pointer, vqs C.struct_QtSvg_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setWindowTitle"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setWindowTitle"); signal != nil {
 		signal.(func(string))(cGoUnpackString(vqs))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).SetWindowTitleDefault(cGoUnpackString(vqs))
@@ -2923,7 +2959,7 @@ func (ptr *QSvgWidget) SetWindowTitleDefault(vqs string) {
 
 //export callbackQSvgWidget_Show
 func callbackQSvgWidget_Show(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "show"); signal != nil {
+	if signal := qt.GetSignal(ptr, "show"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ShowDefault()
@@ -2938,7 +2974,7 @@ func (ptr *QSvgWidget) ShowDefault() {
 
 //export callbackQSvgWidget_ShowEvent
 func callbackQSvgWidget_ShowEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showEvent"); signal != nil {
 		signal.(func(*gui.QShowEvent))(gui.NewQShowEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ShowEventDefault(gui.NewQShowEventFromPointer(event))
@@ -2953,7 +2989,7 @@ func (ptr *QSvgWidget) ShowEventDefault(event gui.QShowEvent_ITF) {
 
 //export callbackQSvgWidget_ShowFullScreen
 func callbackQSvgWidget_ShowFullScreen(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showFullScreen"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showFullScreen"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ShowFullScreenDefault()
@@ -2968,7 +3004,7 @@ func (ptr *QSvgWidget) ShowFullScreenDefault() {
 
 //export callbackQSvgWidget_ShowMaximized
 func callbackQSvgWidget_ShowMaximized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMaximized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMaximized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ShowMaximizedDefault()
@@ -2983,7 +3019,7 @@ func (ptr *QSvgWidget) ShowMaximizedDefault() {
 
 //export callbackQSvgWidget_ShowMinimized
 func callbackQSvgWidget_ShowMinimized(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showMinimized"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showMinimized"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ShowMinimizedDefault()
@@ -2998,7 +3034,7 @@ func (ptr *QSvgWidget) ShowMinimizedDefault() {
 
 //export callbackQSvgWidget_ShowNormal
 func callbackQSvgWidget_ShowNormal(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "showNormal"); signal != nil {
+	if signal := qt.GetSignal(ptr, "showNormal"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ShowNormalDefault()
@@ -3013,7 +3049,7 @@ func (ptr *QSvgWidget) ShowNormalDefault() {
 
 //export callbackQSvgWidget_TabletEvent
 func callbackQSvgWidget_TabletEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "tabletEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "tabletEvent"); signal != nil {
 		signal.(func(*gui.QTabletEvent))(gui.NewQTabletEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).TabletEventDefault(gui.NewQTabletEventFromPointer(event))
@@ -3028,7 +3064,7 @@ func (ptr *QSvgWidget) TabletEventDefault(event gui.QTabletEvent_ITF) {
 
 //export callbackQSvgWidget_Update
 func callbackQSvgWidget_Update(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "update"); signal != nil {
+	if signal := qt.GetSignal(ptr, "update"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).UpdateDefault()
@@ -3043,7 +3079,7 @@ func (ptr *QSvgWidget) UpdateDefault() {
 
 //export callbackQSvgWidget_UpdateMicroFocus
 func callbackQSvgWidget_UpdateMicroFocus(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "updateMicroFocus"); signal != nil {
+	if signal := qt.GetSignal(ptr, "updateMicroFocus"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).UpdateMicroFocusDefault()
@@ -3058,7 +3094,7 @@ func (ptr *QSvgWidget) UpdateMicroFocusDefault() {
 
 //export callbackQSvgWidget_WheelEvent
 func callbackQSvgWidget_WheelEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "wheelEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "wheelEvent"); signal != nil {
 		signal.(func(*gui.QWheelEvent))(gui.NewQWheelEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).WheelEventDefault(gui.NewQWheelEventFromPointer(event))
@@ -3073,7 +3109,7 @@ func (ptr *QSvgWidget) WheelEventDefault(event gui.QWheelEvent_ITF) {
 
 //export callbackQSvgWidget_WindowIconChanged
 func callbackQSvgWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowIconChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowIconChanged"); signal != nil {
 		signal.(func(*gui.QIcon))(gui.NewQIconFromPointer(icon))
 	}
 
@@ -3081,7 +3117,7 @@ func callbackQSvgWidget_WindowIconChanged(ptr unsafe.Pointer, icon unsafe.Pointe
 
 //export callbackQSvgWidget_WindowTitleChanged
 func callbackQSvgWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_QtSvg_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "windowTitleChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "windowTitleChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(title))
 	}
 
@@ -3089,7 +3125,7 @@ func callbackQSvgWidget_WindowTitleChanged(ptr unsafe.Pointer, title C.struct_Qt
 
 //export callbackQSvgWidget_PaintEngine
 func callbackQSvgWidget_PaintEngine(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "paintEngine"); signal != nil {
+	if signal := qt.GetSignal(ptr, "paintEngine"); signal != nil {
 		return gui.PointerFromQPaintEngine(signal.(func() *gui.QPaintEngine)())
 	}
 
@@ -3105,7 +3141,7 @@ func (ptr *QSvgWidget) PaintEngineDefault() *gui.QPaintEngine {
 
 //export callbackQSvgWidget_MinimumSizeHint
 func callbackQSvgWidget_MinimumSizeHint(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "minimumSizeHint"); signal != nil {
+	if signal := qt.GetSignal(ptr, "minimumSizeHint"); signal != nil {
 		return core.PointerFromQSize(signal.(func() *core.QSize)())
 	}
 
@@ -3123,7 +3159,7 @@ func (ptr *QSvgWidget) MinimumSizeHintDefault() *core.QSize {
 
 //export callbackQSvgWidget_InputMethodQuery
 func callbackQSvgWidget_InputMethodQuery(ptr unsafe.Pointer, query C.longlong) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "inputMethodQuery"); signal != nil {
+	if signal := qt.GetSignal(ptr, "inputMethodQuery"); signal != nil {
 		return core.PointerFromQVariant(signal.(func(core.Qt__InputMethodQuery) *core.QVariant)(core.Qt__InputMethodQuery(query)))
 	}
 
@@ -3141,7 +3177,7 @@ func (ptr *QSvgWidget) InputMethodQueryDefault(query core.Qt__InputMethodQuery)
 
 //export callbackQSvgWidget_HasHeightForWidth
 func callbackQSvgWidget_HasHeightForWidth(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasHeightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasHeightForWidth"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3157,7 +3193,7 @@ func (ptr *QSvgWidget) HasHeightForWidthDefault() bool {
 
 //export callbackQSvgWidget_HeightForWidth
 func callbackQSvgWidget_HeightForWidth(ptr unsafe.Pointer, w C.int) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "heightForWidth"); signal != nil {
+	if signal := qt.GetSignal(ptr, "heightForWidth"); signal != nil {
 		return C.int(int32(signal.(func(int) int)(int(int32(w)))))
 	}
 
@@ -3173,7 +3209,7 @@ func (ptr *QSvgWidget) HeightForWidthDefault(w int) int {
 
 //export callbackQSvgWidget_Metric
 func callbackQSvgWidget_Metric(ptr unsafe.Pointer, m C.longlong) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metric"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metric"); signal != nil {
 		return C.int(int32(signal.(func(gui.QPaintDevice__PaintDeviceMetric) int)(gui.QPaintDevice__PaintDeviceMetric(m))))
 	}
 
@@ -3189,7 +3225,7 @@ func (ptr *QSvgWidget) MetricDefault(m gui.QPaintDevice__PaintDeviceMetric) int
 
 //export callbackQSvgWidget_EventFilter
 func callbackQSvgWidget_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -3205,7 +3241,7 @@ func (ptr *QSvgWidget) EventFilterDefault(watched core.QObject_ITF, event core.Q
 
 //export callbackQSvgWidget_ChildEvent
 func callbackQSvgWidget_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -3220,7 +3256,7 @@ func (ptr *QSvgWidget) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQSvgWidget_ConnectNotify
 func callbackQSvgWidget_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3235,7 +3271,7 @@ func (ptr *QSvgWidget) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSvgWidget_CustomEvent
 func callbackQSvgWidget_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -3250,7 +3286,7 @@ func (ptr *QSvgWidget) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQSvgWidget_DeleteLater
 func callbackQSvgWidget_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQSvgWidgetFromPointer(ptr).DeleteLaterDefault()
@@ -3260,14 +3296,14 @@ func callbackQSvgWidget_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QSvgWidget) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QSvgWidget_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQSvgWidget_Destroyed
 func callbackQSvgWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -3275,7 +3311,7 @@ func callbackQSvgWidget_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQSvgWidget_DisconnectNotify
 func callbackQSvgWidget_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -3290,7 +3326,7 @@ func (ptr *QSvgWidget) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQSvgWidget_ObjectNameChanged
 func callbackQSvgWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtSvg_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -3298,7 +3334,7 @@ func callbackQSvgWidget_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struc
 
 //export callbackQSvgWidget_TimerEvent
 func callbackQSvgWidget_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQSvgWidgetFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -3313,7 +3349,7 @@ func (ptr *QSvgWidget) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQSvgWidget_MetaObject
 func callbackQSvgWidget_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
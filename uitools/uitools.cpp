@@ -24,6 +24,41 @@
 #include <QTimerEvent>
 #include <QUiLoader>
 #include <QWidget>
+#include <QScopedPointer>
+#include <QStringList>
+#include <cstdlib>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
 
 class MyQUiLoader: public QUiLoader
 {
@@ -139,17 +174,17 @@ struct QtUiTools_PackedString QUiLoader_ErrorString(void* ptr)
 
 struct QtUiTools_PackedString QUiLoader_AvailableLayouts(void* ptr)
 {
-	return ({ QByteArray te9f98b = static_cast<QUiLoader*>(ptr)->availableLayouts().join("|").toUtf8(); QtUiTools_PackedString { const_cast<char*>(te9f98b.prepend("WHITESPACE").constData()+10), te9f98b.size()-10 }; });
+	return ({ long long te9f98blen; char* te9f98b = goPackStringList(static_cast<QUiLoader*>(ptr)->availableLayouts(), &te9f98blen); QtUiTools_PackedString { te9f98b, te9f98blen }; });
 }
 
 struct QtUiTools_PackedString QUiLoader_AvailableWidgets(void* ptr)
 {
-	return ({ QByteArray tf979e0 = static_cast<QUiLoader*>(ptr)->availableWidgets().join("|").toUtf8(); QtUiTools_PackedString { const_cast<char*>(tf979e0.prepend("WHITESPACE").constData()+10), tf979e0.size()-10 }; });
+	return ({ long long tf979e0len; char* tf979e0 = goPackStringList(static_cast<QUiLoader*>(ptr)->availableWidgets(), &tf979e0len); QtUiTools_PackedString { tf979e0, tf979e0len }; });
 }
 
 struct QtUiTools_PackedString QUiLoader_PluginPaths(void* ptr)
 {
-	return ({ QByteArray t84d911 = static_cast<QUiLoader*>(ptr)->pluginPaths().join("|").toUtf8(); QtUiTools_PackedString { const_cast<char*>(t84d911.prepend("WHITESPACE").constData()+10), t84d911.size()-10 }; });
+	return ({ long long t84d911len; char* t84d911 = goPackStringList(static_cast<QUiLoader*>(ptr)->pluginPaths(), &t84d911len); QtUiTools_PackedString { t84d911, t84d911len }; });
 }
 
 char QUiLoader_IsLanguageChangeEnabled(void* ptr)
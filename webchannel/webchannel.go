@@ -8,7 +8,6 @@ package webchannel
 //#include "webchannel.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
@@ -21,6 +20,43 @@ func cGoUnpackString(s C.struct_QtWebChannel_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtWebChannel_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtWebChannel_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QWebChannel struct {
 	core.QObject
@@ -62,7 +98,7 @@ func NewQWebChannelFromPointer(ptr unsafe.Pointer) *QWebChannel {
 }
 func NewQWebChannel(parent core.QObject_ITF) *QWebChannel {
 	var tmpValue = NewQWebChannelFromPointer(C.QWebChannel_NewQWebChannel(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -70,7 +106,7 @@ func NewQWebChannel(parent core.QObject_ITF) *QWebChannel {
 
 //export callbackQWebChannel_BlockUpdatesChanged
 func callbackQWebChannel_BlockUpdatesChanged(ptr unsafe.Pointer, block C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "blockUpdatesChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "blockUpdatesChanged"); signal != nil {
 		signal.(func(bool))(int8(block) != 0)
 	}
 
@@ -79,14 +115,14 @@ func callbackQWebChannel_BlockUpdatesChanged(ptr unsafe.Pointer, block C.char) {
 func (ptr *QWebChannel) ConnectBlockUpdatesChanged(f func(block bool)) {
 	if ptr.Pointer() != nil {
 		C.QWebChannel_ConnectBlockUpdatesChanged(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "blockUpdatesChanged", f)
+		qt.ConnectSignal(ptr.Pointer(), "blockUpdatesChanged", f)
 	}
 }
 
 func (ptr *QWebChannel) DisconnectBlockUpdatesChanged() {
 	if ptr.Pointer() != nil {
 		C.QWebChannel_DisconnectBlockUpdatesChanged(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "blockUpdatesChanged")
+		qt.DisconnectSignal(ptr.Pointer(), "blockUpdatesChanged")
 	}
 }
 
@@ -98,7 +134,7 @@ func (ptr *QWebChannel) BlockUpdatesChanged(block bool) {
 
 //export callbackQWebChannel_ConnectTo
 func callbackQWebChannel_ConnectTo(ptr unsafe.Pointer, transport unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectTo"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectTo"); signal != nil {
 		signal.(func(*QWebChannelAbstractTransport))(NewQWebChannelAbstractTransportFromPointer(transport))
 	} else {
 		NewQWebChannelFromPointer(ptr).ConnectToDefault(NewQWebChannelAbstractTransportFromPointer(transport))
@@ -108,14 +144,14 @@ func callbackQWebChannel_ConnectTo(ptr unsafe.Pointer, transport unsafe.Pointer)
 func (ptr *QWebChannel) ConnectConnectTo(f func(transport *QWebChannelAbstractTransport)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "connectTo", f)
+		qt.ConnectSignal(ptr.Pointer(), "connectTo", f)
 	}
 }
 
 func (ptr *QWebChannel) DisconnectConnectTo() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "connectTo")
+		qt.DisconnectSignal(ptr.Pointer(), "connectTo")
 	}
 }
 
@@ -139,7 +175,7 @@ func (ptr *QWebChannel) DeregisterObject(object core.QObject_ITF) {
 
 //export callbackQWebChannel_DisconnectFrom
 func callbackQWebChannel_DisconnectFrom(ptr unsafe.Pointer, transport unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectFrom"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectFrom"); signal != nil {
 		signal.(func(*QWebChannelAbstractTransport))(NewQWebChannelAbstractTransportFromPointer(transport))
 	} else {
 		NewQWebChannelFromPointer(ptr).DisconnectFromDefault(NewQWebChannelAbstractTransportFromPointer(transport))
@@ -149,14 +185,14 @@ func callbackQWebChannel_DisconnectFrom(ptr unsafe.Pointer, transport unsafe.Poi
 func (ptr *QWebChannel) ConnectDisconnectFrom(f func(transport *QWebChannelAbstractTransport)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "disconnectFrom", f)
+		qt.ConnectSignal(ptr.Pointer(), "disconnectFrom", f)
 	}
 }
 
 func (ptr *QWebChannel) DisconnectDisconnectFrom() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "disconnectFrom")
+		qt.DisconnectSignal(ptr.Pointer(), "disconnectFrom")
 	}
 }
 
@@ -201,7 +237,7 @@ func (ptr *QWebChannel) SetBlockUpdates(block bool) {
 func (ptr *QWebChannel) DestroyQWebChannel() {
 	if ptr.Pointer() != nil {
 		C.QWebChannel_DestroyQWebChannel(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -231,7 +267,7 @@ func (ptr *QWebChannel) __registerObjects_objects_atList(i string) *core.QObject
 		var iC = C.CString(i)
 		defer C.free(unsafe.Pointer(iC))
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannel___registerObjects_objects_atList(ptr.Pointer(), iC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -269,7 +305,7 @@ func (ptr *QWebChannel) __registeredObjects_atList(i string) *core.QObject {
 		var iC = C.CString(i)
 		defer C.free(unsafe.Pointer(iC))
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannel___registeredObjects_atList(ptr.Pointer(), iC))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -362,7 +398,7 @@ func (ptr *QWebChannel) __dynamicPropertyNames_newList() unsafe.Pointer {
 func (ptr *QWebChannel) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannel___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -383,7 +419,7 @@ func (ptr *QWebChannel) __findChildren_newList2() unsafe.Pointer {
 func (ptr *QWebChannel) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannel___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -404,7 +440,7 @@ func (ptr *QWebChannel) __findChildren_newList3() unsafe.Pointer {
 func (ptr *QWebChannel) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannel___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -425,7 +461,7 @@ func (ptr *QWebChannel) __findChildren_newList() unsafe.Pointer {
 func (ptr *QWebChannel) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannel___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -445,7 +481,7 @@ func (ptr *QWebChannel) __children_newList() unsafe.Pointer {
 
 //export callbackQWebChannel_Event
 func callbackQWebChannel_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -461,7 +497,7 @@ func (ptr *QWebChannel) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQWebChannel_EventFilter
 func callbackQWebChannel_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -477,7 +513,7 @@ func (ptr *QWebChannel) EventFilterDefault(watched core.QObject_ITF, event core.
 
 //export callbackQWebChannel_ChildEvent
 func callbackQWebChannel_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQWebChannelFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -492,7 +528,7 @@ func (ptr *QWebChannel) ChildEventDefault(event core.QChildEvent_ITF) {
 
 //export callbackQWebChannel_ConnectNotify
 func callbackQWebChannel_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQWebChannelFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -507,7 +543,7 @@ func (ptr *QWebChannel) ConnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQWebChannel_CustomEvent
 func callbackQWebChannel_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQWebChannelFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -522,7 +558,7 @@ func (ptr *QWebChannel) CustomEventDefault(event core.QEvent_ITF) {
 
 //export callbackQWebChannel_DeleteLater
 func callbackQWebChannel_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWebChannelFromPointer(ptr).DeleteLaterDefault()
@@ -532,14 +568,14 @@ func callbackQWebChannel_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QWebChannel) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QWebChannel_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQWebChannel_Destroyed
 func callbackQWebChannel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -547,7 +583,7 @@ func callbackQWebChannel_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
 
 //export callbackQWebChannel_DisconnectNotify
 func callbackQWebChannel_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQWebChannelFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -562,7 +598,7 @@ func (ptr *QWebChannel) DisconnectNotifyDefault(sign core.QMetaMethod_ITF) {
 
 //export callbackQWebChannel_ObjectNameChanged
 func callbackQWebChannel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtWebChannel_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -570,7 +606,7 @@ func callbackQWebChannel_ObjectNameChanged(ptr unsafe.Pointer, objectName C.stru
 
 //export callbackQWebChannel_TimerEvent
 func callbackQWebChannel_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQWebChannelFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -585,7 +621,7 @@ func (ptr *QWebChannel) TimerEventDefault(event core.QTimerEvent_ITF) {
 
 //export callbackQWebChannel_MetaObject
 func callbackQWebChannel_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -639,7 +675,7 @@ func NewQWebChannelAbstractTransportFromPointer(ptr unsafe.Pointer) *QWebChannel
 }
 func NewQWebChannelAbstractTransport(parent core.QObject_ITF) *QWebChannelAbstractTransport {
 	var tmpValue = NewQWebChannelAbstractTransportFromPointer(C.QWebChannelAbstractTransport_NewQWebChannelAbstractTransport(core.PointerFromQObject(parent)))
-	if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+	if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 		tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 	}
 	return tmpValue
@@ -647,7 +683,7 @@ func NewQWebChannelAbstractTransport(parent core.QObject_ITF) *QWebChannelAbstra
 
 //export callbackQWebChannelAbstractTransport_MessageReceived
 func callbackQWebChannelAbstractTransport_MessageReceived(ptr unsafe.Pointer, message unsafe.Pointer, transport unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "messageReceived"); signal != nil {
+	if signal := qt.GetSignal(ptr, "messageReceived"); signal != nil {
 		signal.(func(*core.QJsonObject, *QWebChannelAbstractTransport))(core.NewQJsonObjectFromPointer(message), NewQWebChannelAbstractTransportFromPointer(transport))
 	}
 
@@ -656,14 +692,14 @@ func callbackQWebChannelAbstractTransport_MessageReceived(ptr unsafe.Pointer, me
 func (ptr *QWebChannelAbstractTransport) ConnectMessageReceived(f func(message *core.QJsonObject, transport *QWebChannelAbstractTransport)) {
 	if ptr.Pointer() != nil {
 		C.QWebChannelAbstractTransport_ConnectMessageReceived(ptr.Pointer())
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "messageReceived", f)
+		qt.ConnectSignal(ptr.Pointer(), "messageReceived", f)
 	}
 }
 
 func (ptr *QWebChannelAbstractTransport) DisconnectMessageReceived() {
 	if ptr.Pointer() != nil {
 		C.QWebChannelAbstractTransport_DisconnectMessageReceived(ptr.Pointer())
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "messageReceived")
+		qt.DisconnectSignal(ptr.Pointer(), "messageReceived")
 	}
 }
 
@@ -675,7 +711,7 @@ func (ptr *QWebChannelAbstractTransport) MessageReceived(message core.QJsonObjec
 
 //export callbackQWebChannelAbstractTransport_SendMessage
 func callbackQWebChannelAbstractTransport_SendMessage(ptr unsafe.Pointer, message unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "sendMessage"); signal != nil {
+	if signal := qt.GetSignal(ptr, "sendMessage"); signal != nil {
 		signal.(func(*core.QJsonObject))(core.NewQJsonObjectFromPointer(message))
 	}
 
@@ -684,14 +720,14 @@ func callbackQWebChannelAbstractTransport_SendMessage(ptr unsafe.Pointer, messag
 func (ptr *QWebChannelAbstractTransport) ConnectSendMessage(f func(message *core.QJsonObject)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "sendMessage", f)
+		qt.ConnectSignal(ptr.Pointer(), "sendMessage", f)
 	}
 }
 
 func (ptr *QWebChannelAbstractTransport) DisconnectSendMessage() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "sendMessage")
+		qt.DisconnectSignal(ptr.Pointer(), "sendMessage")
 	}
 }
 
@@ -703,7 +739,7 @@ func (ptr *QWebChannelAbstractTransport) SendMessage(message core.QJsonObject_IT
 
 //export callbackQWebChannelAbstractTransport_DestroyQWebChannelAbstractTransport
 func callbackQWebChannelAbstractTransport_DestroyQWebChannelAbstractTransport(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QWebChannelAbstractTransport"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QWebChannelAbstractTransport"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWebChannelAbstractTransportFromPointer(ptr).DestroyQWebChannelAbstractTransportDefault()
@@ -713,21 +749,21 @@ func callbackQWebChannelAbstractTransport_DestroyQWebChannelAbstractTransport(pt
 func (ptr *QWebChannelAbstractTransport) ConnectDestroyQWebChannelAbstractTransport(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QWebChannelAbstractTransport", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QWebChannelAbstractTransport", f)
 	}
 }
 
 func (ptr *QWebChannelAbstractTransport) DisconnectDestroyQWebChannelAbstractTransport() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QWebChannelAbstractTransport")
+		qt.DisconnectSignal(ptr.Pointer(), "~QWebChannelAbstractTransport")
 	}
 }
 
 func (ptr *QWebChannelAbstractTransport) DestroyQWebChannelAbstractTransport() {
 	if ptr.Pointer() != nil {
 		C.QWebChannelAbstractTransport_DestroyQWebChannelAbstractTransport(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -735,7 +771,7 @@ func (ptr *QWebChannelAbstractTransport) DestroyQWebChannelAbstractTransport() {
 func (ptr *QWebChannelAbstractTransport) DestroyQWebChannelAbstractTransportDefault() {
 	if ptr.Pointer() != nil {
 		C.QWebChannelAbstractTransport_DestroyQWebChannelAbstractTransportDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -762,7 +798,7 @@ func (ptr *QWebChannelAbstractTransport) __dynamicPropertyNames_newList() unsafe
 func (ptr *QWebChannelAbstractTransport) __findChildren_atList2(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannelAbstractTransport___findChildren_atList2(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -783,7 +819,7 @@ func (ptr *QWebChannelAbstractTransport) __findChildren_newList2() unsafe.Pointe
 func (ptr *QWebChannelAbstractTransport) __findChildren_atList3(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannelAbstractTransport___findChildren_atList3(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -804,7 +840,7 @@ func (ptr *QWebChannelAbstractTransport) __findChildren_newList3() unsafe.Pointe
 func (ptr *QWebChannelAbstractTransport) __findChildren_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannelAbstractTransport___findChildren_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -825,7 +861,7 @@ func (ptr *QWebChannelAbstractTransport) __findChildren_newList() unsafe.Pointer
 func (ptr *QWebChannelAbstractTransport) __children_atList(i int) *core.QObject {
 	if ptr.Pointer() != nil {
 		var tmpValue = core.NewQObjectFromPointer(C.QWebChannelAbstractTransport___children_atList(ptr.Pointer(), C.int(int32(i))))
-		if !qt.ExistsSignal(fmt.Sprint(tmpValue.Pointer()), "QObject::destroyed") {
+		if !qt.ExistsSignal(tmpValue.Pointer(), "QObject::destroyed") {
 			tmpValue.ConnectDestroyed(func(*core.QObject) { tmpValue.SetPointer(nil) })
 		}
 		return tmpValue
@@ -845,7 +881,7 @@ func (ptr *QWebChannelAbstractTransport) __children_newList() unsafe.Pointer {
 
 //export callbackQWebChannelAbstractTransport_Event
 func callbackQWebChannelAbstractTransport_Event(ptr unsafe.Pointer, e unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "event"); signal != nil {
+	if signal := qt.GetSignal(ptr, "event"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QEvent) bool)(core.NewQEventFromPointer(e)))))
 	}
 
@@ -861,7 +897,7 @@ func (ptr *QWebChannelAbstractTransport) EventDefault(e core.QEvent_ITF) bool {
 
 //export callbackQWebChannelAbstractTransport_EventFilter
 func callbackQWebChannelAbstractTransport_EventFilter(ptr unsafe.Pointer, watched unsafe.Pointer, event unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "eventFilter"); signal != nil {
+	if signal := qt.GetSignal(ptr, "eventFilter"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*core.QObject, *core.QEvent) bool)(core.NewQObjectFromPointer(watched), core.NewQEventFromPointer(event)))))
 	}
 
@@ -877,7 +913,7 @@ func (ptr *QWebChannelAbstractTransport) EventFilterDefault(watched core.QObject
 
 //export callbackQWebChannelAbstractTransport_ChildEvent
 func callbackQWebChannelAbstractTransport_ChildEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "childEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "childEvent"); signal != nil {
 		signal.(func(*core.QChildEvent))(core.NewQChildEventFromPointer(event))
 	} else {
 		NewQWebChannelAbstractTransportFromPointer(ptr).ChildEventDefault(core.NewQChildEventFromPointer(event))
@@ -892,7 +928,7 @@ func (ptr *QWebChannelAbstractTransport) ChildEventDefault(event core.QChildEven
 
 //export callbackQWebChannelAbstractTransport_ConnectNotify
 func callbackQWebChannelAbstractTransport_ConnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "connectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "connectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQWebChannelAbstractTransportFromPointer(ptr).ConnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -907,7 +943,7 @@ func (ptr *QWebChannelAbstractTransport) ConnectNotifyDefault(sign core.QMetaMet
 
 //export callbackQWebChannelAbstractTransport_CustomEvent
 func callbackQWebChannelAbstractTransport_CustomEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "customEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "customEvent"); signal != nil {
 		signal.(func(*core.QEvent))(core.NewQEventFromPointer(event))
 	} else {
 		NewQWebChannelAbstractTransportFromPointer(ptr).CustomEventDefault(core.NewQEventFromPointer(event))
@@ -922,7 +958,7 @@ func (ptr *QWebChannelAbstractTransport) CustomEventDefault(event core.QEvent_IT
 
 //export callbackQWebChannelAbstractTransport_DeleteLater
 func callbackQWebChannelAbstractTransport_DeleteLater(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "deleteLater"); signal != nil {
+	if signal := qt.GetSignal(ptr, "deleteLater"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQWebChannelAbstractTransportFromPointer(ptr).DeleteLaterDefault()
@@ -932,14 +968,14 @@ func callbackQWebChannelAbstractTransport_DeleteLater(ptr unsafe.Pointer) {
 func (ptr *QWebChannelAbstractTransport) DeleteLaterDefault() {
 	if ptr.Pointer() != nil {
 		C.QWebChannelAbstractTransport_DeleteLaterDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQWebChannelAbstractTransport_Destroyed
 func callbackQWebChannelAbstractTransport_Destroyed(ptr unsafe.Pointer, obj unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "destroyed"); signal != nil {
+	if signal := qt.GetSignal(ptr, "destroyed"); signal != nil {
 		signal.(func(*core.QObject))(core.NewQObjectFromPointer(obj))
 	}
 
@@ -947,7 +983,7 @@ func callbackQWebChannelAbstractTransport_Destroyed(ptr unsafe.Pointer, obj unsa
 
 //export callbackQWebChannelAbstractTransport_DisconnectNotify
 func callbackQWebChannelAbstractTransport_DisconnectNotify(ptr unsafe.Pointer, sign unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "disconnectNotify"); signal != nil {
+	if signal := qt.GetSignal(ptr, "disconnectNotify"); signal != nil {
 		signal.(func(*core.QMetaMethod))(core.NewQMetaMethodFromPointer(sign))
 	} else {
 		NewQWebChannelAbstractTransportFromPointer(ptr).DisconnectNotifyDefault(core.NewQMetaMethodFromPointer(sign))
@@ -962,7 +998,7 @@ func (ptr *QWebChannelAbstractTransport) DisconnectNotifyDefault(sign core.QMeta
 
 //export callbackQWebChannelAbstractTransport_ObjectNameChanged
 func callbackQWebChannelAbstractTransport_ObjectNameChanged(ptr unsafe.Pointer, objectName C.struct_QtWebChannel_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "objectNameChanged"); signal != nil {
+	if signal := qt.GetSignal(ptr, "objectNameChanged"); signal != nil {
 		signal.(func(string))(cGoUnpackString(objectName))
 	}
 
@@ -970,7 +1006,7 @@ func callbackQWebChannelAbstractTransport_ObjectNameChanged(ptr unsafe.Pointer,
 
 //export callbackQWebChannelAbstractTransport_TimerEvent
 func callbackQWebChannelAbstractTransport_TimerEvent(ptr unsafe.Pointer, event unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "timerEvent"); signal != nil {
+	if signal := qt.GetSignal(ptr, "timerEvent"); signal != nil {
 		signal.(func(*core.QTimerEvent))(core.NewQTimerEventFromPointer(event))
 	} else {
 		NewQWebChannelAbstractTransportFromPointer(ptr).TimerEventDefault(core.NewQTimerEventFromPointer(event))
@@ -985,7 +1021,7 @@ func (ptr *QWebChannelAbstractTransport) TimerEventDefault(event core.QTimerEven
 
 //export callbackQWebChannelAbstractTransport_MetaObject
 func callbackQWebChannelAbstractTransport_MetaObject(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "metaObject"); signal != nil {
+	if signal := qt.GetSignal(ptr, "metaObject"); signal != nil {
 		return core.PointerFromQMetaObject(signal.(func() *core.QMetaObject)())
 	}
 
@@ -76,6 +76,75 @@
 #include <QWebEngineView>
 #include <QWheelEvent>
 #include <QWidget>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 class MyQQuickWebEngineProfile: public QQuickWebEngineProfile
 {
@@ -312,7 +381,7 @@ void QQuickWebEngineProfile_SetSpellCheckEnabled(void* ptr, char enabled)
 
 void QQuickWebEngineProfile_SetSpellCheckLanguages(void* ptr, char* languages)
 {
-	static_cast<QQuickWebEngineProfile*>(ptr)->setSpellCheckLanguages(QString(languages).split("|", QString::SkipEmptyParts));
+	static_cast<QQuickWebEngineProfile*>(ptr)->setSpellCheckLanguages(goUnpackStringList(languages));
 }
 
 void QQuickWebEngineProfile_SetStorageName(void* ptr, char* name)
@@ -402,7 +471,7 @@ struct QtWebEngine_PackedString QQuickWebEngineProfile_StorageName(void* ptr)
 
 struct QtWebEngine_PackedString QQuickWebEngineProfile_SpellCheckLanguages(void* ptr)
 {
-	return ({ QByteArray td376a8 = static_cast<QQuickWebEngineProfile*>(ptr)->spellCheckLanguages().join("|").toUtf8(); QtWebEngine_PackedString { const_cast<char*>(td376a8.prepend("WHITESPACE").constData()+10), td376a8.size()-10 }; });
+	return ({ long long td376a8len; char* td376a8 = goPackStringList(static_cast<QQuickWebEngineProfile*>(ptr)->spellCheckLanguages(), &td376a8len); QtWebEngine_PackedString { td376a8, td376a8len }; });
 }
 
 void* QQuickWebEngineProfile_CookieStore(void* ptr)
@@ -612,7 +681,7 @@ struct QtWebEngine_PackedString QWebEngineContextMenuData_SelectedText(void* ptr
 
 struct QtWebEngine_PackedString QWebEngineContextMenuData_SpellCheckerSuggestions(void* ptr)
 {
-	return ({ QByteArray tc7c525 = static_cast<QWebEngineContextMenuData*>(ptr)->spellCheckerSuggestions().join("|").toUtf8(); QtWebEngine_PackedString { const_cast<char*>(tc7c525.prepend("WHITESPACE").constData()+10), tc7c525.size()-10 }; });
+	return ({ long long tc7c525len; char* tc7c525 = goPackStringList(static_cast<QWebEngineContextMenuData*>(ptr)->spellCheckerSuggestions(), &tc7c525len); QtWebEngine_PackedString { tc7c525, tc7c525len }; });
 }
 
 void* QWebEngineContextMenuData_LinkUrl(void* ptr)
@@ -1295,7 +1364,7 @@ class MyQWebEnginePage: public QWebEnginePage
 public:
 	MyQWebEnginePage(QObject *parent) : QWebEnginePage(parent) {};
 	MyQWebEnginePage(QWebEngineProfile *profile, QObject *parent) : QWebEnginePage(profile, parent) {};
-	QStringList chooseFiles(QWebEnginePage::FileSelectionMode mode, const QStringList & oldFiles, const QStringList & acceptedMimeTypes) { QByteArray t76015f = oldFiles.join("|").toUtf8(); QtWebEngine_PackedString oldFilesPacked = { const_cast<char*>(t76015f.prepend("WHITESPACE").constData()+10), t76015f.size()-10 };QByteArray t541092 = acceptedMimeTypes.join("|").toUtf8(); QtWebEngine_PackedString acceptedMimeTypesPacked = { const_cast<char*>(t541092.prepend("WHITESPACE").constData()+10), t541092.size()-10 };return QString(callbackQWebEnginePage_ChooseFiles(this, mode, oldFilesPacked, acceptedMimeTypesPacked)).split("|", QString::SkipEmptyParts); };
+	QStringList chooseFiles(QWebEnginePage::FileSelectionMode mode, const QStringList & oldFiles, const QStringList & acceptedMimeTypes) { long long t76015flen; QScopedPointer<char, QScopedPointerPodDeleter> t76015f(goPackStringList(oldFiles, &t76015flen)); QtWebEngine_PackedString oldFilesPacked = { t76015f.data(), t76015flen };long long t541092len; QScopedPointer<char, QScopedPointerPodDeleter> t541092(goPackStringList(acceptedMimeTypes, &t541092len)); QtWebEngine_PackedString acceptedMimeTypesPacked = { t541092.data(), t541092len };char* tmp = callbackQWebEnginePage_ChooseFiles(this, mode, oldFilesPacked, acceptedMimeTypesPacked); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
 	QWebEnginePage * createWindow(QWebEnginePage::WebWindowType ty) { return static_cast<QWebEnginePage*>(callbackQWebEnginePage_CreateWindow(this, ty)); };
 	bool acceptNavigationRequest(const QUrl & url, QWebEnginePage::NavigationType ty, bool isMainFrame) { return callbackQWebEnginePage_AcceptNavigationRequest(this, const_cast<QUrl*>(&url), ty, isMainFrame) != 0; };
 	bool certificateError(const QWebEngineCertificateError & certificateError) { return callbackQWebEnginePage_CertificateError(this, const_cast<QWebEngineCertificateError*>(&certificateError)) != 0; };
@@ -1344,12 +1413,12 @@ void* QWebEnginePage_CreateStandardContextMenu(void* ptr)
 
 struct QtWebEngine_PackedString QWebEnginePage_ChooseFiles(void* ptr, long long mode, char* oldFiles, char* acceptedMimeTypes)
 {
-	return ({ QByteArray tbef4f3 = static_cast<QWebEnginePage*>(ptr)->chooseFiles(static_cast<QWebEnginePage::FileSelectionMode>(mode), QString(oldFiles).split("|", QString::SkipEmptyParts), QString(acceptedMimeTypes).split("|", QString::SkipEmptyParts)).join("|").toUtf8(); QtWebEngine_PackedString { const_cast<char*>(tbef4f3.prepend("WHITESPACE").constData()+10), tbef4f3.size()-10 }; });
+	return ({ long long tbef4f3len; char* tbef4f3 = goPackStringList(static_cast<QWebEnginePage*>(ptr)->chooseFiles(static_cast<QWebEnginePage::FileSelectionMode>(mode), goUnpackStringList(oldFiles), goUnpackStringList(acceptedMimeTypes)), &tbef4f3len); QtWebEngine_PackedString { tbef4f3, tbef4f3len }; });
 }
 
 struct QtWebEngine_PackedString QWebEnginePage_ChooseFilesDefault(void* ptr, long long mode, char* oldFiles, char* acceptedMimeTypes)
 {
-		return ({ QByteArray te5a7b3 = static_cast<QWebEnginePage*>(ptr)->QWebEnginePage::chooseFiles(static_cast<QWebEnginePage::FileSelectionMode>(mode), QString(oldFiles).split("|", QString::SkipEmptyParts), QString(acceptedMimeTypes).split("|", QString::SkipEmptyParts)).join("|").toUtf8(); QtWebEngine_PackedString { const_cast<char*>(te5a7b3.prepend("WHITESPACE").constData()+10), te5a7b3.size()-10 }; });
+		return ({ long long te5a7b3len; char* te5a7b3 = goPackStringList(static_cast<QWebEnginePage*>(ptr)->QWebEnginePage::chooseFiles(static_cast<QWebEnginePage::FileSelectionMode>(mode), goUnpackStringList(oldFiles), goUnpackStringList(acceptedMimeTypes)), &te5a7b3len); QtWebEngine_PackedString { te5a7b3, te5a7b3len }; });
 }
 
 void* QWebEnginePage_CreateWindow(void* ptr, long long ty)
@@ -2188,7 +2257,7 @@ void QWebEngineProfile_SetSpellCheckEnabled(void* ptr, char enable)
 
 void QWebEngineProfile_SetSpellCheckLanguages(void* ptr, char* languages)
 {
-	static_cast<QWebEngineProfile*>(ptr)->setSpellCheckLanguages(QString(languages).split("|", QString::SkipEmptyParts));
+	static_cast<QWebEngineProfile*>(ptr)->setSpellCheckLanguages(goUnpackStringList(languages));
 }
 
 long long QWebEngineProfile_HttpCacheType(void* ptr)
@@ -2228,7 +2297,7 @@ struct QtWebEngine_PackedString QWebEngineProfile_StorageName(void* ptr)
 
 struct QtWebEngine_PackedString QWebEngineProfile_SpellCheckLanguages(void* ptr)
 {
-	return ({ QByteArray tba4fdb = static_cast<QWebEngineProfile*>(ptr)->spellCheckLanguages().join("|").toUtf8(); QtWebEngine_PackedString { const_cast<char*>(tba4fdb.prepend("WHITESPACE").constData()+10), tba4fdb.size()-10 }; });
+	return ({ long long tba4fdblen; char* tba4fdb = goPackStringList(static_cast<QWebEngineProfile*>(ptr)->spellCheckLanguages(), &tba4fdblen); QtWebEngine_PackedString { tba4fdb, tba4fdblen }; });
 }
 
 void* QWebEngineProfile_Scripts(void* ptr)
@@ -0,0 +1,14 @@
+#include "utils-widgets.h"
+
+#include <QPlainTextEdit>
+#include <QString>
+
+void QPlainTextEdit_AppendPlainTextUTF16(void* ptr, void* data, int len)
+{
+	static_cast<QPlainTextEdit*>(ptr)->appendPlainText(QString::fromUtf16(static_cast<ushort*>(data), len));
+}
+
+void QPlainTextEdit_AppendPlainTextQString(void* ptr, void* str)
+{
+	static_cast<QPlainTextEdit*>(ptr)->appendPlainText(*static_cast<QString*>(str));
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#ifndef GO_QTWIDGETS_UTILS_H
+#define GO_QTWIDGETS_UTILS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void QPlainTextEdit_AppendPlainTextUTF16(void* ptr, void* data, int len);
+void QPlainTextEdit_AppendPlainTextQString(void* ptr, void* str);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
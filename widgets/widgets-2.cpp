@@ -0,0 +1,10433 @@
+// +build !minimal
+
+#define protected public
+#define private public
+
+#include "widgets.h"
+#include "_cgo_export.h"
+
+#include <QAbstractButton>
+#include <QAbstractGraphicsShapeItem>
+#include <QAbstractItemDelegate>
+#include <QAbstractItemModel>
+#include <QAbstractProxyModel>
+#include <QAbstractSpinBox>
+#include <QAction>
+#include <QActionEvent>
+#include <QByteArray>
+#include <QChildEvent>
+#include <QCloseEvent>
+#include <QColor>
+#include <QColorDialog>
+#include <QComboBox>
+#include <QContextMenuEvent>
+#include <QCursor>
+#include <QDate>
+#include <QDateTime>
+#include <QDial>
+#include <QDialog>
+#include <QDialogButtonBox>
+#include <QDir>
+#include <QDockWidget>
+#include <QDoubleSpinBox>
+#include <QDrag>
+#include <QDragEnterEvent>
+#include <QDragLeaveEvent>
+#include <QDragMoveEvent>
+#include <QDropEvent>
+#include <QErrorMessage>
+#include <QEvent>
+#include <QFile>
+#include <QFileDialog>
+#include <QFileIconProvider>
+#include <QFileInfo>
+#include <QFileSystemModel>
+#include <QFocusEvent>
+#include <QFocusFrame>
+#include <QFont>
+#include <QFontComboBox>
+#include <QFontDatabase>
+#include <QFontDialog>
+#include <QFormLayout>
+#include <QFrame>
+#include <QGesture>
+#include <QGestureEvent>
+#include <QGestureRecognizer>
+#include <QGraphicsAnchor>
+#include <QGraphicsAnchorLayout>
+#include <QGraphicsBlurEffect>
+#include <QGraphicsColorizeEffect>
+#include <QGraphicsDropShadowEffect>
+#include <QGraphicsEffect>
+#include <QGraphicsEllipseItem>
+#include <QGraphicsGridLayout>
+#include <QGraphicsItem>
+#include <QGraphicsItemGroup>
+#include <QGraphicsLayout>
+#include <QGraphicsLayoutItem>
+#include <QGraphicsLineItem>
+#include <QGraphicsObject>
+#include <QGraphicsOpacityEffect>
+#include <QGraphicsPathItem>
+#include <QGraphicsPixmapItem>
+#include <QGraphicsPolygonItem>
+#include <QGraphicsProxyWidget>
+#include <QGraphicsRectItem>
+#include <QGraphicsScene>
+#include <QGraphicsSceneContextMenuEvent>
+#include <QGraphicsSceneDragDropEvent>
+#include <QGraphicsSceneHoverEvent>
+#include <QGraphicsSceneMouseEvent>
+#include <QGraphicsSceneWheelEvent>
+#include <QGraphicsSimpleTextItem>
+#include <QGraphicsTextItem>
+#include <QGraphicsTransform>
+#include <QGraphicsWidget>
+#include <QHash>
+#include <QHideEvent>
+#include <QIcon>
+#include <QInputDialog>
+#include <QInputMethod>
+#include <QInputMethodEvent>
+#include <QKeyEvent>
+#include <QLayout>
+#include <QLayoutItem>
+#include <QList>
+#include <QMap>
+#include <QMessageBox>
+#include <QMetaMethod>
+#include <QMetaObject>
+#include <QMimeData>
+#include <QModelIndex>
+#include <QMouseEvent>
+#include <QMoveEvent>
+#include <QObject>
+#include <QPaintDevice>
+#include <QPaintEngine>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPanGesture>
+#include <QPersistentModelIndex>
+#include <QPinchGesture>
+#include <QPixmap>
+#include <QPoint>
+#include <QPointF>
+#include <QPolygon>
+#include <QPolygonF>
+#include <QProgressDialog>
+#include <QRect>
+#include <QRectF>
+#include <QRegion>
+#include <QResizeEvent>
+#include <QShowEvent>
+#include <QSize>
+#include <QSizeF>
+#include <QSizePolicy>
+#include <QSpacerItem>
+#include <QString>
+#include <QStringList>
+#include <QStyle>
+#include <QStyleOption>
+#include <QStyleOptionDockWidget>
+#include <QStyleOptionFrame>
+#include <QStyleOptionGraphicsItem>
+#include <QSwipeGesture>
+#include <QTabletEvent>
+#include <QTapAndHoldGesture>
+#include <QTapGesture>
+#include <QTime>
+#include <QTimer>
+#include <QTimerEvent>
+#include <QTransform>
+#include <QUrl>
+#include <QValidator>
+#include <QVariant>
+#include <QVector>
+#include <QWheelEvent>
+#include <QWidget>
+#include <QWizard>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+class MyQDialog: public QDialog
+{
+public:
+	MyQDialog(QWidget *parent, Qt::WindowFlags f) : QDialog(parent, f) {};
+	int exec() { return callbackQDialog_Exec(this); };
+	void accept() { callbackQDialog_Accept(this); };
+	void Signal_Accepted() { callbackQDialog_Accepted(this); };
+	void closeEvent(QCloseEvent * e) { callbackQWidget_CloseEvent(this, e); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void done(int r) { callbackQDialog_Done(this, r); };
+	void Signal_Finished(int result) { callbackQDialog_Finished(this, result); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void open() { callbackQDialog_Open(this); };
+	void reject() { callbackQDialog_Reject(this); };
+	void Signal_Rejected() { callbackQDialog_Rejected(this); };
+	void resizeEvent(QResizeEvent * vqr) { callbackQWidget_ResizeEvent(this, vqr); };
+	void setVisible(bool visible) { callbackQDialog_SetVisible(this, visible); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QDialog_SetModal(void* ptr, char modal)
+{
+	static_cast<QDialog*>(ptr)->setModal(modal != 0);
+}
+
+void QDialog_SetSizeGripEnabled(void* ptr, char vbo)
+{
+	static_cast<QDialog*>(ptr)->setSizeGripEnabled(vbo != 0);
+}
+
+void* QDialog_NewQDialog(void* parent, long long f)
+{
+	return new MyQDialog(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(f));
+}
+
+int QDialog_Exec(void* ptr)
+{
+	int returnArg;
+	QMetaObject::invokeMethod(static_cast<QDialog*>(ptr), "exec", Q_RETURN_ARG(int, returnArg));
+	return returnArg;
+}
+
+int QDialog_ExecDefault(void* ptr)
+{
+	if (dynamic_cast<QWizard*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWizard*>(ptr)->QWizard::exec();
+	} else if (dynamic_cast<QProgressDialog*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QProgressDialog*>(ptr)->QProgressDialog::exec();
+	} else if (dynamic_cast<QMessageBox*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QMessageBox*>(ptr)->QMessageBox::exec();
+	} else if (dynamic_cast<QInputDialog*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QInputDialog*>(ptr)->QInputDialog::exec();
+	} else if (dynamic_cast<QFontDialog*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFontDialog*>(ptr)->QFontDialog::exec();
+	} else if (dynamic_cast<QFileDialog*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFileDialog*>(ptr)->QFileDialog::exec();
+	} else if (dynamic_cast<QErrorMessage*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QErrorMessage*>(ptr)->QErrorMessage::exec();
+	} else if (dynamic_cast<QColorDialog*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QColorDialog*>(ptr)->QColorDialog::exec();
+	} else {
+		return static_cast<QDialog*>(ptr)->QDialog::exec();
+	}
+}
+
+void QDialog_Accept(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QDialog*>(ptr), "accept");
+}
+
+void QDialog_AcceptDefault(void* ptr)
+{
+	if (dynamic_cast<QWizard*>(static_cast<QObject*>(ptr))) {
+		static_cast<QWizard*>(ptr)->QWizard::accept();
+	} else if (dynamic_cast<QProgressDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::accept();
+	} else if (dynamic_cast<QMessageBox*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMessageBox*>(ptr)->QMessageBox::accept();
+	} else if (dynamic_cast<QInputDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QInputDialog*>(ptr)->QInputDialog::accept();
+	} else if (dynamic_cast<QFontDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFontDialog*>(ptr)->QFontDialog::accept();
+	} else if (dynamic_cast<QFileDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDialog*>(ptr)->QFileDialog::accept();
+	} else if (dynamic_cast<QErrorMessage*>(static_cast<QObject*>(ptr))) {
+		static_cast<QErrorMessage*>(ptr)->QErrorMessage::accept();
+	} else if (dynamic_cast<QColorDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QColorDialog*>(ptr)->QColorDialog::accept();
+	} else {
+		static_cast<QDialog*>(ptr)->QDialog::accept();
+	}
+}
+
+void QDialog_ConnectAccepted(void* ptr)
+{
+	QObject::connect(static_cast<QDialog*>(ptr), static_cast<void (QDialog::*)()>(&QDialog::accepted), static_cast<MyQDialog*>(ptr), static_cast<void (MyQDialog::*)()>(&MyQDialog::Signal_Accepted));
+}
+
+void QDialog_DisconnectAccepted(void* ptr)
+{
+	QObject::disconnect(static_cast<QDialog*>(ptr), static_cast<void (QDialog::*)()>(&QDialog::accepted), static_cast<MyQDialog*>(ptr), static_cast<void (MyQDialog::*)()>(&MyQDialog::Signal_Accepted));
+}
+
+void QDialog_Accepted(void* ptr)
+{
+	static_cast<QDialog*>(ptr)->accepted();
+}
+
+void QDialog_Done(void* ptr, int r)
+{
+	QMetaObject::invokeMethod(static_cast<QDialog*>(ptr), "done", Q_ARG(int, r));
+}
+
+void QDialog_DoneDefault(void* ptr, int r)
+{
+	if (dynamic_cast<QWizard*>(static_cast<QObject*>(ptr))) {
+		static_cast<QWizard*>(ptr)->QWizard::done(r);
+	} else if (dynamic_cast<QProgressDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::done(r);
+	} else if (dynamic_cast<QMessageBox*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMessageBox*>(ptr)->QMessageBox::done(r);
+	} else if (dynamic_cast<QInputDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QInputDialog*>(ptr)->QInputDialog::done(r);
+	} else if (dynamic_cast<QFontDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFontDialog*>(ptr)->QFontDialog::done(r);
+	} else if (dynamic_cast<QFileDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDialog*>(ptr)->QFileDialog::done(r);
+	} else if (dynamic_cast<QErrorMessage*>(static_cast<QObject*>(ptr))) {
+		static_cast<QErrorMessage*>(ptr)->QErrorMessage::done(r);
+	} else if (dynamic_cast<QColorDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QColorDialog*>(ptr)->QColorDialog::done(r);
+	} else {
+		static_cast<QDialog*>(ptr)->QDialog::done(r);
+	}
+}
+
+void QDialog_ConnectFinished(void* ptr)
+{
+	QObject::connect(static_cast<QDialog*>(ptr), static_cast<void (QDialog::*)(int)>(&QDialog::finished), static_cast<MyQDialog*>(ptr), static_cast<void (MyQDialog::*)(int)>(&MyQDialog::Signal_Finished));
+}
+
+void QDialog_DisconnectFinished(void* ptr)
+{
+	QObject::disconnect(static_cast<QDialog*>(ptr), static_cast<void (QDialog::*)(int)>(&QDialog::finished), static_cast<MyQDialog*>(ptr), static_cast<void (MyQDialog::*)(int)>(&MyQDialog::Signal_Finished));
+}
+
+void QDialog_Finished(void* ptr, int result)
+{
+	static_cast<QDialog*>(ptr)->finished(result);
+}
+
+void QDialog_Open(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QDialog*>(ptr), "open");
+}
+
+void QDialog_OpenDefault(void* ptr)
+{
+	if (dynamic_cast<QWizard*>(static_cast<QObject*>(ptr))) {
+		static_cast<QWizard*>(ptr)->QWizard::open();
+	} else if (dynamic_cast<QProgressDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::open();
+	} else if (dynamic_cast<QMessageBox*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMessageBox*>(ptr)->QMessageBox::open();
+	} else if (dynamic_cast<QInputDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QInputDialog*>(ptr)->QInputDialog::open();
+	} else if (dynamic_cast<QFontDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFontDialog*>(ptr)->QFontDialog::open();
+	} else if (dynamic_cast<QFileDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDialog*>(ptr)->QFileDialog::open();
+	} else if (dynamic_cast<QErrorMessage*>(static_cast<QObject*>(ptr))) {
+		static_cast<QErrorMessage*>(ptr)->QErrorMessage::open();
+	} else if (dynamic_cast<QColorDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QColorDialog*>(ptr)->QColorDialog::open();
+	} else {
+		static_cast<QDialog*>(ptr)->QDialog::open();
+	}
+}
+
+void QDialog_Reject(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QDialog*>(ptr), "reject");
+}
+
+void QDialog_RejectDefault(void* ptr)
+{
+	if (dynamic_cast<QWizard*>(static_cast<QObject*>(ptr))) {
+		static_cast<QWizard*>(ptr)->QWizard::reject();
+	} else if (dynamic_cast<QProgressDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::reject();
+	} else if (dynamic_cast<QMessageBox*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMessageBox*>(ptr)->QMessageBox::reject();
+	} else if (dynamic_cast<QInputDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QInputDialog*>(ptr)->QInputDialog::reject();
+	} else if (dynamic_cast<QFontDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFontDialog*>(ptr)->QFontDialog::reject();
+	} else if (dynamic_cast<QFileDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDialog*>(ptr)->QFileDialog::reject();
+	} else if (dynamic_cast<QErrorMessage*>(static_cast<QObject*>(ptr))) {
+		static_cast<QErrorMessage*>(ptr)->QErrorMessage::reject();
+	} else if (dynamic_cast<QColorDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QColorDialog*>(ptr)->QColorDialog::reject();
+	} else {
+		static_cast<QDialog*>(ptr)->QDialog::reject();
+	}
+}
+
+void QDialog_ConnectRejected(void* ptr)
+{
+	QObject::connect(static_cast<QDialog*>(ptr), static_cast<void (QDialog::*)()>(&QDialog::rejected), static_cast<MyQDialog*>(ptr), static_cast<void (MyQDialog::*)()>(&MyQDialog::Signal_Rejected));
+}
+
+void QDialog_DisconnectRejected(void* ptr)
+{
+	QObject::disconnect(static_cast<QDialog*>(ptr), static_cast<void (QDialog::*)()>(&QDialog::rejected), static_cast<MyQDialog*>(ptr), static_cast<void (MyQDialog::*)()>(&MyQDialog::Signal_Rejected));
+}
+
+void QDialog_Rejected(void* ptr)
+{
+	static_cast<QDialog*>(ptr)->rejected();
+}
+
+void QDialog_SetResult(void* ptr, int i)
+{
+	static_cast<QDialog*>(ptr)->setResult(i);
+}
+
+void QDialog_SetVisible(void* ptr, char visible)
+{
+	static_cast<QDialog*>(ptr)->setVisible(visible != 0);
+}
+
+void QDialog_SetVisibleDefault(void* ptr, char visible)
+{
+	if (dynamic_cast<QWizard*>(static_cast<QObject*>(ptr))) {
+		static_cast<QWizard*>(ptr)->QWizard::setVisible(visible != 0);
+	} else if (dynamic_cast<QProgressDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::setVisible(visible != 0);
+	} else if (dynamic_cast<QMessageBox*>(static_cast<QObject*>(ptr))) {
+		static_cast<QMessageBox*>(ptr)->QMessageBox::setVisible(visible != 0);
+	} else if (dynamic_cast<QInputDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QInputDialog*>(ptr)->QInputDialog::setVisible(visible != 0);
+	} else if (dynamic_cast<QFontDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFontDialog*>(ptr)->QFontDialog::setVisible(visible != 0);
+	} else if (dynamic_cast<QFileDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFileDialog*>(ptr)->QFileDialog::setVisible(visible != 0);
+	} else if (dynamic_cast<QErrorMessage*>(static_cast<QObject*>(ptr))) {
+		static_cast<QErrorMessage*>(ptr)->QErrorMessage::setVisible(visible != 0);
+	} else if (dynamic_cast<QColorDialog*>(static_cast<QObject*>(ptr))) {
+		static_cast<QColorDialog*>(ptr)->QColorDialog::setVisible(visible != 0);
+	} else {
+		static_cast<QDialog*>(ptr)->QDialog::setVisible(visible != 0);
+	}
+}
+
+void QDialog_DestroyQDialog(void* ptr)
+{
+	static_cast<QDialog*>(ptr)->~QDialog();
+}
+
+char QDialog_IsSizeGripEnabled(void* ptr)
+{
+	return static_cast<QDialog*>(ptr)->isSizeGripEnabled();
+}
+
+int QDialog_Result(void* ptr)
+{
+	return static_cast<QDialog*>(ptr)->result();
+}
+
+class MyQDialogButtonBox: public QDialogButtonBox
+{
+public:
+	MyQDialogButtonBox(QWidget *parent) : QDialogButtonBox(parent) {};
+	MyQDialogButtonBox(Qt::Orientation orientation, QWidget *parent) : QDialogButtonBox(orientation, parent) {};
+	MyQDialogButtonBox(StandardButtons buttons, QWidget *parent) : QDialogButtonBox(buttons, parent) {};
+	MyQDialogButtonBox(StandardButtons buttons, Qt::Orientation orientation, QWidget *parent) : QDialogButtonBox(buttons, orientation, parent) {};
+	void Signal_Accepted() { callbackQDialogButtonBox_Accepted(this); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void Signal_Clicked(QAbstractButton * button) { callbackQDialogButtonBox_Clicked(this, button); };
+	void Signal_HelpRequested() { callbackQDialogButtonBox_HelpRequested(this); };
+	void Signal_Rejected() { callbackQDialogButtonBox_Rejected(this); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QDialogButtonBox_ConnectAccepted(void* ptr)
+{
+	QObject::connect(static_cast<QDialogButtonBox*>(ptr), static_cast<void (QDialogButtonBox::*)()>(&QDialogButtonBox::accepted), static_cast<MyQDialogButtonBox*>(ptr), static_cast<void (MyQDialogButtonBox::*)()>(&MyQDialogButtonBox::Signal_Accepted));
+}
+
+void QDialogButtonBox_DisconnectAccepted(void* ptr)
+{
+	QObject::disconnect(static_cast<QDialogButtonBox*>(ptr), static_cast<void (QDialogButtonBox::*)()>(&QDialogButtonBox::accepted), static_cast<MyQDialogButtonBox*>(ptr), static_cast<void (MyQDialogButtonBox::*)()>(&MyQDialogButtonBox::Signal_Accepted));
+}
+
+void QDialogButtonBox_Accepted(void* ptr)
+{
+	static_cast<QDialogButtonBox*>(ptr)->accepted();
+}
+
+void QDialogButtonBox_SetOrientation(void* ptr, long long orientation)
+{
+	static_cast<QDialogButtonBox*>(ptr)->setOrientation(static_cast<Qt::Orientation>(orientation));
+}
+
+void* QDialogButtonBox_NewQDialogButtonBox(void* parent)
+{
+	return new MyQDialogButtonBox(static_cast<QWidget*>(parent));
+}
+
+void* QDialogButtonBox_NewQDialogButtonBox2(long long orientation, void* parent)
+{
+	return new MyQDialogButtonBox(static_cast<Qt::Orientation>(orientation), static_cast<QWidget*>(parent));
+}
+
+void* QDialogButtonBox_NewQDialogButtonBox3(long long buttons, void* parent)
+{
+	return new MyQDialogButtonBox(static_cast<QDialogButtonBox::StandardButton>(buttons), static_cast<QWidget*>(parent));
+}
+
+void* QDialogButtonBox_NewQDialogButtonBox4(long long buttons, long long orientation, void* parent)
+{
+	return new MyQDialogButtonBox(static_cast<QDialogButtonBox::StandardButton>(buttons), static_cast<Qt::Orientation>(orientation), static_cast<QWidget*>(parent));
+}
+
+void* QDialogButtonBox_AddButton3(void* ptr, long long button)
+{
+	return static_cast<QDialogButtonBox*>(ptr)->addButton(static_cast<QDialogButtonBox::StandardButton>(button));
+}
+
+void* QDialogButtonBox_AddButton2(void* ptr, char* text, long long role)
+{
+	return static_cast<QDialogButtonBox*>(ptr)->addButton(QString(text), static_cast<QDialogButtonBox::ButtonRole>(role));
+}
+
+void QDialogButtonBox_AddButton(void* ptr, void* button, long long role)
+{
+	static_cast<QDialogButtonBox*>(ptr)->addButton(static_cast<QAbstractButton*>(button), static_cast<QDialogButtonBox::ButtonRole>(role));
+}
+
+void QDialogButtonBox_Clear(void* ptr)
+{
+	static_cast<QDialogButtonBox*>(ptr)->clear();
+}
+
+void QDialogButtonBox_ConnectClicked(void* ptr)
+{
+	QObject::connect(static_cast<QDialogButtonBox*>(ptr), static_cast<void (QDialogButtonBox::*)(QAbstractButton *)>(&QDialogButtonBox::clicked), static_cast<MyQDialogButtonBox*>(ptr), static_cast<void (MyQDialogButtonBox::*)(QAbstractButton *)>(&MyQDialogButtonBox::Signal_Clicked));
+}
+
+void QDialogButtonBox_DisconnectClicked(void* ptr)
+{
+	QObject::disconnect(static_cast<QDialogButtonBox*>(ptr), static_cast<void (QDialogButtonBox::*)(QAbstractButton *)>(&QDialogButtonBox::clicked), static_cast<MyQDialogButtonBox*>(ptr), static_cast<void (MyQDialogButtonBox::*)(QAbstractButton *)>(&MyQDialogButtonBox::Signal_Clicked));
+}
+
+void QDialogButtonBox_Clicked(void* ptr, void* button)
+{
+	static_cast<QDialogButtonBox*>(ptr)->clicked(static_cast<QAbstractButton*>(button));
+}
+
+void QDialogButtonBox_ConnectHelpRequested(void* ptr)
+{
+	QObject::connect(static_cast<QDialogButtonBox*>(ptr), static_cast<void (QDialogButtonBox::*)()>(&QDialogButtonBox::helpRequested), static_cast<MyQDialogButtonBox*>(ptr), static_cast<void (MyQDialogButtonBox::*)()>(&MyQDialogButtonBox::Signal_HelpRequested));
+}
+
+void QDialogButtonBox_DisconnectHelpRequested(void* ptr)
+{
+	QObject::disconnect(static_cast<QDialogButtonBox*>(ptr), static_cast<void (QDialogButtonBox::*)()>(&QDialogButtonBox::helpRequested), static_cast<MyQDialogButtonBox*>(ptr), static_cast<void (MyQDialogButtonBox::*)()>(&MyQDialogButtonBox::Signal_HelpRequested));
+}
+
+void QDialogButtonBox_HelpRequested(void* ptr)
+{
+	static_cast<QDialogButtonBox*>(ptr)->helpRequested();
+}
+
+void QDialogButtonBox_ConnectRejected(void* ptr)
+{
+	QObject::connect(static_cast<QDialogButtonBox*>(ptr), static_cast<void (QDialogButtonBox::*)()>(&QDialogButtonBox::rejected), static_cast<MyQDialogButtonBox*>(ptr), static_cast<void (MyQDialogButtonBox::*)()>(&MyQDialogButtonBox::Signal_Rejected));
+}
+
+void QDialogButtonBox_DisconnectRejected(void* ptr)
+{
+	QObject::disconnect(static_cast<QDialogButtonBox*>(ptr), static_cast<void (QDialogButtonBox::*)()>(&QDialogButtonBox::rejected), static_cast<MyQDialogButtonBox*>(ptr), static_cast<void (MyQDialogButtonBox::*)()>(&MyQDialogButtonBox::Signal_Rejected));
+}
+
+void QDialogButtonBox_Rejected(void* ptr)
+{
+	static_cast<QDialogButtonBox*>(ptr)->rejected();
+}
+
+void QDialogButtonBox_RemoveButton(void* ptr, void* button)
+{
+	static_cast<QDialogButtonBox*>(ptr)->removeButton(static_cast<QAbstractButton*>(button));
+}
+
+void QDialogButtonBox_SetCenterButtons(void* ptr, char center)
+{
+	static_cast<QDialogButtonBox*>(ptr)->setCenterButtons(center != 0);
+}
+
+void QDialogButtonBox_SetStandardButtons(void* ptr, long long buttons)
+{
+	static_cast<QDialogButtonBox*>(ptr)->setStandardButtons(static_cast<QDialogButtonBox::StandardButton>(buttons));
+}
+
+void QDialogButtonBox_DestroyQDialogButtonBox(void* ptr)
+{
+	static_cast<QDialogButtonBox*>(ptr)->~QDialogButtonBox();
+}
+
+long long QDialogButtonBox_ButtonRole(void* ptr, void* button)
+{
+	return static_cast<QDialogButtonBox*>(ptr)->buttonRole(static_cast<QAbstractButton*>(button));
+}
+
+struct QtWidgets_PackedList QDialogButtonBox_Buttons(void* ptr)
+{
+	return ({ QList<QAbstractButton *>* tmpValue = new QList<QAbstractButton *>(static_cast<QDialogButtonBox*>(ptr)->buttons()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QDialogButtonBox_Button(void* ptr, long long which)
+{
+	return static_cast<QDialogButtonBox*>(ptr)->button(static_cast<QDialogButtonBox::StandardButton>(which));
+}
+
+long long QDialogButtonBox_Orientation(void* ptr)
+{
+	return static_cast<QDialogButtonBox*>(ptr)->orientation();
+}
+
+long long QDialogButtonBox_StandardButton(void* ptr, void* button)
+{
+	return static_cast<QDialogButtonBox*>(ptr)->standardButton(static_cast<QAbstractButton*>(button));
+}
+
+long long QDialogButtonBox_StandardButtons(void* ptr)
+{
+	return static_cast<QDialogButtonBox*>(ptr)->standardButtons();
+}
+
+char QDialogButtonBox_CenterButtons(void* ptr)
+{
+	return static_cast<QDialogButtonBox*>(ptr)->centerButtons();
+}
+
+void* QDialogButtonBox___buttons_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractButton*>(static_cast<QList<QAbstractButton *>*>(ptr)->at(i));
+}
+
+void QDialogButtonBox___buttons_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractButton *>*>(ptr)->append(static_cast<QAbstractButton*>(i));
+}
+
+void* QDialogButtonBox___buttons_newList(void* ptr)
+{
+	return new QList<QAbstractButton *>;
+}
+
+class MyQDockWidget: public QDockWidget
+{
+public:
+	MyQDockWidget(QWidget *parent, Qt::WindowFlags flags) : QDockWidget(parent, flags) {};
+	MyQDockWidget(const QString &title, QWidget *parent, Qt::WindowFlags flags) : QDockWidget(title, parent, flags) {};
+	void Signal_FeaturesChanged(QDockWidget::DockWidgetFeatures features) { callbackQDockWidget_FeaturesChanged(this, features); };
+	void Signal_AllowedAreasChanged(Qt::DockWidgetAreas allowedAreas) { callbackQDockWidget_AllowedAreasChanged(this, allowedAreas); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_DockLocationChanged(Qt::DockWidgetArea area) { callbackQDockWidget_DockLocationChanged(this, area); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void Signal_TopLevelChanged(bool topLevel) { callbackQDockWidget_TopLevelChanged(this, topLevel); };
+	void Signal_VisibilityChanged(bool visible) { callbackQDockWidget_VisibilityChanged(this, visible); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QDockWidget_ConnectFeaturesChanged(void* ptr)
+{
+	QObject::connect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(QDockWidget::DockWidgetFeatures)>(&QDockWidget::featuresChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(QDockWidget::DockWidgetFeatures)>(&MyQDockWidget::Signal_FeaturesChanged));
+}
+
+void QDockWidget_DisconnectFeaturesChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(QDockWidget::DockWidgetFeatures)>(&QDockWidget::featuresChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(QDockWidget::DockWidgetFeatures)>(&MyQDockWidget::Signal_FeaturesChanged));
+}
+
+void QDockWidget_FeaturesChanged(void* ptr, long long features)
+{
+	static_cast<QDockWidget*>(ptr)->featuresChanged(static_cast<QDockWidget::DockWidgetFeature>(features));
+}
+
+void QDockWidget_SetFeatures(void* ptr, long long features)
+{
+	static_cast<QDockWidget*>(ptr)->setFeatures(static_cast<QDockWidget::DockWidgetFeature>(features));
+}
+
+void* QDockWidget_NewQDockWidget2(void* parent, long long flags)
+{
+	return new MyQDockWidget(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(flags));
+}
+
+void* QDockWidget_NewQDockWidget(char* title, void* parent, long long flags)
+{
+	return new MyQDockWidget(QString(title), static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(flags));
+}
+
+void QDockWidget_ConnectAllowedAreasChanged(void* ptr)
+{
+	QObject::connect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(Qt::DockWidgetAreas)>(&QDockWidget::allowedAreasChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(Qt::DockWidgetAreas)>(&MyQDockWidget::Signal_AllowedAreasChanged));
+}
+
+void QDockWidget_DisconnectAllowedAreasChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(Qt::DockWidgetAreas)>(&QDockWidget::allowedAreasChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(Qt::DockWidgetAreas)>(&MyQDockWidget::Signal_AllowedAreasChanged));
+}
+
+void QDockWidget_AllowedAreasChanged(void* ptr, long long allowedAreas)
+{
+	static_cast<QDockWidget*>(ptr)->allowedAreasChanged(static_cast<Qt::DockWidgetArea>(allowedAreas));
+}
+
+void QDockWidget_ConnectDockLocationChanged(void* ptr)
+{
+	QObject::connect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(Qt::DockWidgetArea)>(&QDockWidget::dockLocationChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(Qt::DockWidgetArea)>(&MyQDockWidget::Signal_DockLocationChanged));
+}
+
+void QDockWidget_DisconnectDockLocationChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(Qt::DockWidgetArea)>(&QDockWidget::dockLocationChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(Qt::DockWidgetArea)>(&MyQDockWidget::Signal_DockLocationChanged));
+}
+
+void QDockWidget_DockLocationChanged(void* ptr, long long area)
+{
+	static_cast<QDockWidget*>(ptr)->dockLocationChanged(static_cast<Qt::DockWidgetArea>(area));
+}
+
+void QDockWidget_SetAllowedAreas(void* ptr, long long areas)
+{
+	static_cast<QDockWidget*>(ptr)->setAllowedAreas(static_cast<Qt::DockWidgetArea>(areas));
+}
+
+void QDockWidget_SetFloating(void* ptr, char floating)
+{
+	static_cast<QDockWidget*>(ptr)->setFloating(floating != 0);
+}
+
+void QDockWidget_SetTitleBarWidget(void* ptr, void* widget)
+{
+		static_cast<QDockWidget*>(ptr)->setTitleBarWidget(static_cast<QWidget*>(widget));
+}
+
+void QDockWidget_SetWidget(void* ptr, void* widget)
+{
+		static_cast<QDockWidget*>(ptr)->setWidget(static_cast<QWidget*>(widget));
+}
+
+void QDockWidget_ConnectTopLevelChanged(void* ptr)
+{
+	QObject::connect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(bool)>(&QDockWidget::topLevelChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(bool)>(&MyQDockWidget::Signal_TopLevelChanged));
+}
+
+void QDockWidget_DisconnectTopLevelChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(bool)>(&QDockWidget::topLevelChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(bool)>(&MyQDockWidget::Signal_TopLevelChanged));
+}
+
+void QDockWidget_TopLevelChanged(void* ptr, char topLevel)
+{
+	static_cast<QDockWidget*>(ptr)->topLevelChanged(topLevel != 0);
+}
+
+void QDockWidget_ConnectVisibilityChanged(void* ptr)
+{
+	QObject::connect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(bool)>(&QDockWidget::visibilityChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(bool)>(&MyQDockWidget::Signal_VisibilityChanged));
+}
+
+void QDockWidget_DisconnectVisibilityChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QDockWidget*>(ptr), static_cast<void (QDockWidget::*)(bool)>(&QDockWidget::visibilityChanged), static_cast<MyQDockWidget*>(ptr), static_cast<void (MyQDockWidget::*)(bool)>(&MyQDockWidget::Signal_VisibilityChanged));
+}
+
+void QDockWidget_VisibilityChanged(void* ptr, char visible)
+{
+	static_cast<QDockWidget*>(ptr)->visibilityChanged(visible != 0);
+}
+
+void QDockWidget_DestroyQDockWidget(void* ptr)
+{
+	static_cast<QDockWidget*>(ptr)->~QDockWidget();
+}
+
+long long QDockWidget_Features(void* ptr)
+{
+	return static_cast<QDockWidget*>(ptr)->features();
+}
+
+void* QDockWidget_ToggleViewAction(void* ptr)
+{
+	return static_cast<QDockWidget*>(ptr)->toggleViewAction();
+}
+
+void* QDockWidget_TitleBarWidget(void* ptr)
+{
+	return static_cast<QDockWidget*>(ptr)->titleBarWidget();
+}
+
+void* QDockWidget_Widget(void* ptr)
+{
+	return static_cast<QDockWidget*>(ptr)->widget();
+}
+
+long long QDockWidget_AllowedAreas(void* ptr)
+{
+	return static_cast<QDockWidget*>(ptr)->allowedAreas();
+}
+
+char QDockWidget_IsAreaAllowed(void* ptr, long long area)
+{
+	return static_cast<QDockWidget*>(ptr)->isAreaAllowed(static_cast<Qt::DockWidgetArea>(area));
+}
+
+char QDockWidget_IsFloating(void* ptr)
+{
+	return static_cast<QDockWidget*>(ptr)->isFloating();
+}
+
+void QDockWidget_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QDockWidget*>(ptr)->initStyleOption(static_cast<QStyleOptionDockWidget*>(option));
+}
+
+class MyQDoubleSpinBox: public QDoubleSpinBox
+{
+public:
+	MyQDoubleSpinBox(QWidget *parent) : QDoubleSpinBox(parent) {};
+	void setValue(double val) { callbackQDoubleSpinBox_SetValue(this, val); };
+	void Signal_ValueChanged2(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQDoubleSpinBox_ValueChanged2(this, textPacked); };
+	void Signal_ValueChanged(double d) { callbackQDoubleSpinBox_ValueChanged(this, d); };
+	QString textFromValue(double value) const { return QString(callbackQDoubleSpinBox_TextFromValue(const_cast<void*>(static_cast<const void*>(this)), value)); };
+	QValidator::State validate(QString & text, int & pos) const { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };return static_cast<QValidator::State>(callbackQAbstractSpinBox_Validate(const_cast<void*>(static_cast<const void*>(this)), textPacked, pos)); };
+	double valueFromText(const QString & text) const { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };return callbackQDoubleSpinBox_ValueFromText(const_cast<void*>(static_cast<const void*>(this)), textPacked); };
+	void fixup(QString & input) const { QByteArray t140f86 = input.toUtf8(); QtWidgets_PackedString inputPacked = { const_cast<char*>(t140f86.prepend("WHITESPACE").constData()+10), t140f86.size()-10 };callbackQAbstractSpinBox_Fixup(const_cast<void*>(static_cast<const void*>(this)), inputPacked); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void clear() { callbackQAbstractSpinBox_Clear(this); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_EditingFinished() { callbackQAbstractSpinBox_EditingFinished(this); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void selectAll() { callbackQAbstractSpinBox_SelectAll(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void stepBy(int steps) { callbackQAbstractSpinBox_StepBy(this, steps); };
+	void stepDown() { callbackQAbstractSpinBox_StepDown(this); };
+	void stepUp() { callbackQAbstractSpinBox_StepUp(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	StepEnabled stepEnabled() const { return static_cast<QAbstractSpinBox::StepEnabledFlag>(callbackQAbstractSpinBox_StepEnabled(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QDoubleSpinBox_NewQDoubleSpinBox(void* parent)
+{
+	return new MyQDoubleSpinBox(static_cast<QWidget*>(parent));
+}
+
+void QDoubleSpinBox_SetDecimals(void* ptr, int prec)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->setDecimals(prec);
+}
+
+void QDoubleSpinBox_SetMaximum(void* ptr, double max)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->setMaximum(max);
+}
+
+void QDoubleSpinBox_SetMinimum(void* ptr, double min)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->setMinimum(min);
+}
+
+void QDoubleSpinBox_SetPrefix(void* ptr, char* prefix)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->setPrefix(QString(prefix));
+}
+
+void QDoubleSpinBox_SetRange(void* ptr, double minimum, double maximum)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->setRange(minimum, maximum);
+}
+
+void QDoubleSpinBox_SetSingleStep(void* ptr, double val)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->setSingleStep(val);
+}
+
+void QDoubleSpinBox_SetSuffix(void* ptr, char* suffix)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->setSuffix(QString(suffix));
+}
+
+void QDoubleSpinBox_SetValue(void* ptr, double val)
+{
+	QMetaObject::invokeMethod(static_cast<QDoubleSpinBox*>(ptr), "setValue", Q_ARG(double, val));
+}
+
+void QDoubleSpinBox_SetValueDefault(void* ptr, double val)
+{
+		static_cast<QDoubleSpinBox*>(ptr)->QDoubleSpinBox::setValue(val);
+}
+
+void QDoubleSpinBox_ConnectValueChanged2(void* ptr)
+{
+	QObject::connect(static_cast<QDoubleSpinBox*>(ptr), static_cast<void (QDoubleSpinBox::*)(const QString &)>(&QDoubleSpinBox::valueChanged), static_cast<MyQDoubleSpinBox*>(ptr), static_cast<void (MyQDoubleSpinBox::*)(const QString &)>(&MyQDoubleSpinBox::Signal_ValueChanged2));
+}
+
+void QDoubleSpinBox_DisconnectValueChanged2(void* ptr)
+{
+	QObject::disconnect(static_cast<QDoubleSpinBox*>(ptr), static_cast<void (QDoubleSpinBox::*)(const QString &)>(&QDoubleSpinBox::valueChanged), static_cast<MyQDoubleSpinBox*>(ptr), static_cast<void (MyQDoubleSpinBox::*)(const QString &)>(&MyQDoubleSpinBox::Signal_ValueChanged2));
+}
+
+void QDoubleSpinBox_ValueChanged2(void* ptr, char* text)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->valueChanged(QString(text));
+}
+
+void QDoubleSpinBox_ConnectValueChanged(void* ptr)
+{
+	QObject::connect(static_cast<QDoubleSpinBox*>(ptr), static_cast<void (QDoubleSpinBox::*)(double)>(&QDoubleSpinBox::valueChanged), static_cast<MyQDoubleSpinBox*>(ptr), static_cast<void (MyQDoubleSpinBox::*)(double)>(&MyQDoubleSpinBox::Signal_ValueChanged));
+}
+
+void QDoubleSpinBox_DisconnectValueChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QDoubleSpinBox*>(ptr), static_cast<void (QDoubleSpinBox::*)(double)>(&QDoubleSpinBox::valueChanged), static_cast<MyQDoubleSpinBox*>(ptr), static_cast<void (MyQDoubleSpinBox::*)(double)>(&MyQDoubleSpinBox::Signal_ValueChanged));
+}
+
+void QDoubleSpinBox_ValueChanged(void* ptr, double d)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->valueChanged(d);
+}
+
+void QDoubleSpinBox_DestroyQDoubleSpinBox(void* ptr)
+{
+	static_cast<QDoubleSpinBox*>(ptr)->~QDoubleSpinBox();
+}
+
+struct QtWidgets_PackedString QDoubleSpinBox_CleanText(void* ptr)
+{
+	return ({ QByteArray t77d32e = static_cast<QDoubleSpinBox*>(ptr)->cleanText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t77d32e.prepend("WHITESPACE").constData()+10), t77d32e.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QDoubleSpinBox_Prefix(void* ptr)
+{
+	return ({ QByteArray t5a79ac = static_cast<QDoubleSpinBox*>(ptr)->prefix().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t5a79ac.prepend("WHITESPACE").constData()+10), t5a79ac.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QDoubleSpinBox_Suffix(void* ptr)
+{
+	return ({ QByteArray t4d98e3 = static_cast<QDoubleSpinBox*>(ptr)->suffix().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t4d98e3.prepend("WHITESPACE").constData()+10), t4d98e3.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QDoubleSpinBox_TextFromValue(void* ptr, double value)
+{
+	return ({ QByteArray t86f376 = static_cast<QDoubleSpinBox*>(ptr)->textFromValue(value).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t86f376.prepend("WHITESPACE").constData()+10), t86f376.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QDoubleSpinBox_TextFromValueDefault(void* ptr, double value)
+{
+		return ({ QByteArray t7bc6a7 = static_cast<QDoubleSpinBox*>(ptr)->QDoubleSpinBox::textFromValue(value).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t7bc6a7.prepend("WHITESPACE").constData()+10), t7bc6a7.size()-10 }; });
+}
+
+double QDoubleSpinBox_Maximum(void* ptr)
+{
+	return static_cast<QDoubleSpinBox*>(ptr)->maximum();
+}
+
+double QDoubleSpinBox_Minimum(void* ptr)
+{
+	return static_cast<QDoubleSpinBox*>(ptr)->minimum();
+}
+
+double QDoubleSpinBox_SingleStep(void* ptr)
+{
+	return static_cast<QDoubleSpinBox*>(ptr)->singleStep();
+}
+
+double QDoubleSpinBox_Value(void* ptr)
+{
+	return static_cast<QDoubleSpinBox*>(ptr)->value();
+}
+
+double QDoubleSpinBox_ValueFromText(void* ptr, char* text)
+{
+	return static_cast<QDoubleSpinBox*>(ptr)->valueFromText(QString(text));
+}
+
+double QDoubleSpinBox_ValueFromTextDefault(void* ptr, char* text)
+{
+		return static_cast<QDoubleSpinBox*>(ptr)->QDoubleSpinBox::valueFromText(QString(text));
+}
+
+int QDoubleSpinBox_Decimals(void* ptr)
+{
+	return static_cast<QDoubleSpinBox*>(ptr)->decimals();
+}
+
+class MyQErrorMessage: public QErrorMessage
+{
+public:
+	MyQErrorMessage(QWidget *parent) : QErrorMessage(parent) {};
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void done(int a) { callbackQErrorMessage_Done(this, a); };
+	void showMessage(const QString & message) { QByteArray t6f9b9a = message.toUtf8(); QtWidgets_PackedString messagePacked = { const_cast<char*>(t6f9b9a.prepend("WHITESPACE").constData()+10), t6f9b9a.size()-10 };callbackQErrorMessage_ShowMessage(this, messagePacked); };
+	void showMessage(const QString & message, const QString & ty) { QByteArray t6f9b9a = message.toUtf8(); QtWidgets_PackedString messagePacked = { const_cast<char*>(t6f9b9a.prepend("WHITESPACE").constData()+10), t6f9b9a.size()-10 };QByteArray td0a3e7 = ty.toUtf8(); QtWidgets_PackedString tyPacked = { const_cast<char*>(td0a3e7.prepend("WHITESPACE").constData()+10), td0a3e7.size()-10 };callbackQErrorMessage_ShowMessage2(this, messagePacked, tyPacked); };
+	int exec() { return callbackQDialog_Exec(this); };
+	void accept() { callbackQDialog_Accept(this); };
+	void Signal_Accepted() { callbackQDialog_Accepted(this); };
+	void closeEvent(QCloseEvent * e) { callbackQWidget_CloseEvent(this, e); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void Signal_Finished(int result) { callbackQDialog_Finished(this, result); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void open() { callbackQDialog_Open(this); };
+	void reject() { callbackQDialog_Reject(this); };
+	void Signal_Rejected() { callbackQDialog_Rejected(this); };
+	void resizeEvent(QResizeEvent * vqr) { callbackQWidget_ResizeEvent(this, vqr); };
+	void setVisible(bool visible) { callbackQDialog_SetVisible(this, visible); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QErrorMessage_QErrorMessage_QtHandler()
+{
+	return QErrorMessage::qtHandler();
+}
+
+void* QErrorMessage_NewQErrorMessage(void* parent)
+{
+	return new MyQErrorMessage(static_cast<QWidget*>(parent));
+}
+
+void QErrorMessage_Done(void* ptr, int a)
+{
+	static_cast<QErrorMessage*>(ptr)->done(a);
+}
+
+void QErrorMessage_DoneDefault(void* ptr, int a)
+{
+		static_cast<QErrorMessage*>(ptr)->QErrorMessage::done(a);
+}
+
+void QErrorMessage_ShowMessage(void* ptr, char* message)
+{
+	QMetaObject::invokeMethod(static_cast<QErrorMessage*>(ptr), "showMessage", Q_ARG(QString, QString(message)));
+}
+
+void QErrorMessage_ShowMessageDefault(void* ptr, char* message)
+{
+		static_cast<QErrorMessage*>(ptr)->QErrorMessage::showMessage(QString(message));
+}
+
+void QErrorMessage_ShowMessage2(void* ptr, char* message, char* ty)
+{
+	QMetaObject::invokeMethod(static_cast<QErrorMessage*>(ptr), "showMessage", Q_ARG(QString, QString(message)), Q_ARG(QString, QString(ty)));
+}
+
+void QErrorMessage_ShowMessage2Default(void* ptr, char* message, char* ty)
+{
+		static_cast<QErrorMessage*>(ptr)->QErrorMessage::showMessage(QString(message), QString(ty));
+}
+
+void QErrorMessage_DestroyQErrorMessage(void* ptr)
+{
+	static_cast<QErrorMessage*>(ptr)->~QErrorMessage();
+}
+
+class MyQFileDialog: public QFileDialog
+{
+public:
+	MyQFileDialog(QWidget *parent, Qt::WindowFlags flags) : QFileDialog(parent, flags) {};
+	MyQFileDialog(QWidget *parent, const QString &caption, const QString &directory, const QString &filter) : QFileDialog(parent, caption, directory, filter) {};
+	void accept() { callbackQFileDialog_Accept(this); };
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void Signal_CurrentChanged(const QString & path) { QByteArray t3150ec = path.toUtf8(); QtWidgets_PackedString pathPacked = { const_cast<char*>(t3150ec.prepend("WHITESPACE").constData()+10), t3150ec.size()-10 };callbackQFileDialog_CurrentChanged(this, pathPacked); };
+	void Signal_CurrentUrlChanged(const QUrl & url) { callbackQFileDialog_CurrentUrlChanged(this, const_cast<QUrl*>(&url)); };
+	void Signal_DirectoryEntered(const QString & directory) { QByteArray t8d392f = directory.toUtf8(); QtWidgets_PackedString directoryPacked = { const_cast<char*>(t8d392f.prepend("WHITESPACE").constData()+10), t8d392f.size()-10 };callbackQFileDialog_DirectoryEntered(this, directoryPacked); };
+	void Signal_DirectoryUrlEntered(const QUrl & directory) { callbackQFileDialog_DirectoryUrlEntered(this, const_cast<QUrl*>(&directory)); };
+	void done(int result) { callbackQFileDialog_Done(this, result); };
+	void Signal_FileSelected(const QString & file) { QByteArray t971c41 = file.toUtf8(); QtWidgets_PackedString filePacked = { const_cast<char*>(t971c41.prepend("WHITESPACE").constData()+10), t971c41.size()-10 };callbackQFileDialog_FileSelected(this, filePacked); };
+	void Signal_FilesSelected(const QStringList & selected) { long long t835f3blen; QScopedPointer<char, QScopedPointerPodDeleter> t835f3b(goPackStringList(selected, &t835f3blen)); QtWidgets_PackedString selectedPacked = { t835f3b.data(), t835f3blen };callbackQFileDialog_FilesSelected(this, selectedPacked); };
+	void Signal_FilterSelected(const QString & filter) { QByteArray t4bb4ca = filter.toUtf8(); QtWidgets_PackedString filterPacked = { const_cast<char*>(t4bb4ca.prepend("WHITESPACE").constData()+10), t4bb4ca.size()-10 };callbackQFileDialog_FilterSelected(this, filterPacked); };
+	void setVisible(bool visible) { callbackQDialog_SetVisible(this, visible); };
+	void Signal_UrlSelected(const QUrl & url) { callbackQFileDialog_UrlSelected(this, const_cast<QUrl*>(&url)); };
+	void Signal_UrlsSelected(const QList<QUrl> & urls) { callbackQFileDialog_UrlsSelected(this, ({ QList<QUrl>* tmpValue = const_cast<QList<QUrl>*>(&urls); QtWidgets_PackedList { tmpValue, tmpValue->size() }; })); };
+	int exec() { return callbackQDialog_Exec(this); };
+	void Signal_Accepted() { callbackQDialog_Accepted(this); };
+	void closeEvent(QCloseEvent * e) { callbackQWidget_CloseEvent(this, e); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void Signal_Finished(int result) { callbackQDialog_Finished(this, result); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void open() { callbackQDialog_Open(this); };
+	void reject() { callbackQDialog_Reject(this); };
+	void Signal_Rejected() { callbackQDialog_Rejected(this); };
+	void resizeEvent(QResizeEvent * vqr) { callbackQWidget_ResizeEvent(this, vqr); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QFileDialog_NewQFileDialog(void* parent, long long flags)
+{
+	return new MyQFileDialog(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(flags));
+}
+
+void* QFileDialog_NewQFileDialog2(void* parent, char* caption, char* directory, char* filter)
+{
+	return new MyQFileDialog(static_cast<QWidget*>(parent), QString(caption), QString(directory), QString(filter));
+}
+
+struct QtWidgets_PackedList QFileDialog_QFileDialog_GetOpenFileUrls(void* parent, char* caption, void* dir, char* filter, char* selectedFilter, long long options, char* supportedSchemes)
+{
+		return ({ QList<QUrl>* tmpValue = new QList<QUrl>(QFileDialog::getOpenFileUrls(static_cast<QWidget*>(parent), QString(caption), *static_cast<QUrl*>(dir), QString(filter), new QString(selectedFilter), static_cast<QFileDialog::Option>(options), goUnpackStringList(supportedSchemes))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_QFileDialog_GetExistingDirectory(void* parent, char* caption, char* dir, long long options)
+{
+		return ({ QByteArray t6c26bd = QFileDialog::getExistingDirectory(static_cast<QWidget*>(parent), QString(caption), QString(dir), static_cast<QFileDialog::Option>(options)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t6c26bd.prepend("WHITESPACE").constData()+10), t6c26bd.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_QFileDialog_GetOpenFileName(void* parent, char* caption, char* dir, char* filter, char* selectedFilter, long long options)
+{
+		return ({ QByteArray t4d142d = QFileDialog::getOpenFileName(static_cast<QWidget*>(parent), QString(caption), QString(dir), QString(filter), new QString(selectedFilter), static_cast<QFileDialog::Option>(options)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t4d142d.prepend("WHITESPACE").constData()+10), t4d142d.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_QFileDialog_GetSaveFileName(void* parent, char* caption, char* dir, char* filter, char* selectedFilter, long long options)
+{
+		return ({ QByteArray t897f02 = QFileDialog::getSaveFileName(static_cast<QWidget*>(parent), QString(caption), QString(dir), QString(filter), new QString(selectedFilter), static_cast<QFileDialog::Option>(options)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t897f02.prepend("WHITESPACE").constData()+10), t897f02.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_QFileDialog_GetOpenFileNames(void* parent, char* caption, char* dir, char* filter, char* selectedFilter, long long options)
+{
+		return ({ long long t1d7015len; char* t1d7015 = goPackStringList(QFileDialog::getOpenFileNames(static_cast<QWidget*>(parent), QString(caption), QString(dir), QString(filter), new QString(selectedFilter), static_cast<QFileDialog::Option>(options)), &t1d7015len); QtWidgets_PackedString { t1d7015, t1d7015len }; });
+}
+
+void* QFileDialog_QFileDialog_GetExistingDirectoryUrl(void* parent, char* caption, void* dir, long long options, char* supportedSchemes)
+{
+		return new QUrl(QFileDialog::getExistingDirectoryUrl(static_cast<QWidget*>(parent), QString(caption), *static_cast<QUrl*>(dir), static_cast<QFileDialog::Option>(options), goUnpackStringList(supportedSchemes)));
+}
+
+void* QFileDialog_QFileDialog_GetOpenFileUrl(void* parent, char* caption, void* dir, char* filter, char* selectedFilter, long long options, char* supportedSchemes)
+{
+		return new QUrl(QFileDialog::getOpenFileUrl(static_cast<QWidget*>(parent), QString(caption), *static_cast<QUrl*>(dir), QString(filter), new QString(selectedFilter), static_cast<QFileDialog::Option>(options), goUnpackStringList(supportedSchemes)));
+}
+
+void* QFileDialog_QFileDialog_GetSaveFileUrl(void* parent, char* caption, void* dir, char* filter, char* selectedFilter, long long options, char* supportedSchemes)
+{
+		return new QUrl(QFileDialog::getSaveFileUrl(static_cast<QWidget*>(parent), QString(caption), *static_cast<QUrl*>(dir), QString(filter), new QString(selectedFilter), static_cast<QFileDialog::Option>(options), goUnpackStringList(supportedSchemes)));
+}
+
+char QFileDialog_RestoreState(void* ptr, void* state)
+{
+	return static_cast<QFileDialog*>(ptr)->restoreState(*static_cast<QByteArray*>(state));
+}
+
+void QFileDialog_Accept(void* ptr)
+{
+	static_cast<QFileDialog*>(ptr)->accept();
+}
+
+void QFileDialog_AcceptDefault(void* ptr)
+{
+		static_cast<QFileDialog*>(ptr)->QFileDialog::accept();
+}
+
+void QFileDialog_ConnectCurrentChanged(void* ptr)
+{
+	QObject::connect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QString &)>(&QFileDialog::currentChanged), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QString &)>(&MyQFileDialog::Signal_CurrentChanged));
+}
+
+void QFileDialog_DisconnectCurrentChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QString &)>(&QFileDialog::currentChanged), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QString &)>(&MyQFileDialog::Signal_CurrentChanged));
+}
+
+void QFileDialog_CurrentChanged(void* ptr, char* path)
+{
+	static_cast<QFileDialog*>(ptr)->currentChanged(QString(path));
+}
+
+void QFileDialog_ConnectCurrentUrlChanged(void* ptr)
+{
+	QObject::connect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QUrl &)>(&QFileDialog::currentUrlChanged), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QUrl &)>(&MyQFileDialog::Signal_CurrentUrlChanged));
+}
+
+void QFileDialog_DisconnectCurrentUrlChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QUrl &)>(&QFileDialog::currentUrlChanged), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QUrl &)>(&MyQFileDialog::Signal_CurrentUrlChanged));
+}
+
+void QFileDialog_CurrentUrlChanged(void* ptr, void* url)
+{
+	static_cast<QFileDialog*>(ptr)->currentUrlChanged(*static_cast<QUrl*>(url));
+}
+
+void QFileDialog_ConnectDirectoryEntered(void* ptr)
+{
+	QObject::connect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QString &)>(&QFileDialog::directoryEntered), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QString &)>(&MyQFileDialog::Signal_DirectoryEntered));
+}
+
+void QFileDialog_DisconnectDirectoryEntered(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QString &)>(&QFileDialog::directoryEntered), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QString &)>(&MyQFileDialog::Signal_DirectoryEntered));
+}
+
+void QFileDialog_DirectoryEntered(void* ptr, char* directory)
+{
+	static_cast<QFileDialog*>(ptr)->directoryEntered(QString(directory));
+}
+
+void QFileDialog_ConnectDirectoryUrlEntered(void* ptr)
+{
+	QObject::connect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QUrl &)>(&QFileDialog::directoryUrlEntered), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QUrl &)>(&MyQFileDialog::Signal_DirectoryUrlEntered));
+}
+
+void QFileDialog_DisconnectDirectoryUrlEntered(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QUrl &)>(&QFileDialog::directoryUrlEntered), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QUrl &)>(&MyQFileDialog::Signal_DirectoryUrlEntered));
+}
+
+void QFileDialog_DirectoryUrlEntered(void* ptr, void* directory)
+{
+	static_cast<QFileDialog*>(ptr)->directoryUrlEntered(*static_cast<QUrl*>(directory));
+}
+
+void QFileDialog_Done(void* ptr, int result)
+{
+	static_cast<QFileDialog*>(ptr)->done(result);
+}
+
+void QFileDialog_DoneDefault(void* ptr, int result)
+{
+		static_cast<QFileDialog*>(ptr)->QFileDialog::done(result);
+}
+
+void QFileDialog_ConnectFileSelected(void* ptr)
+{
+	QObject::connect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QString &)>(&QFileDialog::fileSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QString &)>(&MyQFileDialog::Signal_FileSelected));
+}
+
+void QFileDialog_DisconnectFileSelected(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QString &)>(&QFileDialog::fileSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QString &)>(&MyQFileDialog::Signal_FileSelected));
+}
+
+void QFileDialog_FileSelected(void* ptr, char* file)
+{
+	static_cast<QFileDialog*>(ptr)->fileSelected(QString(file));
+}
+
+void QFileDialog_ConnectFilesSelected(void* ptr)
+{
+	QObject::connect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QStringList &)>(&QFileDialog::filesSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QStringList &)>(&MyQFileDialog::Signal_FilesSelected));
+}
+
+void QFileDialog_DisconnectFilesSelected(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QStringList &)>(&QFileDialog::filesSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QStringList &)>(&MyQFileDialog::Signal_FilesSelected));
+}
+
+void QFileDialog_FilesSelected(void* ptr, char* selected)
+{
+	static_cast<QFileDialog*>(ptr)->filesSelected(goUnpackStringList(selected));
+}
+
+void QFileDialog_ConnectFilterSelected(void* ptr)
+{
+	QObject::connect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QString &)>(&QFileDialog::filterSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QString &)>(&MyQFileDialog::Signal_FilterSelected));
+}
+
+void QFileDialog_DisconnectFilterSelected(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QString &)>(&QFileDialog::filterSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QString &)>(&MyQFileDialog::Signal_FilterSelected));
+}
+
+void QFileDialog_FilterSelected(void* ptr, char* filter)
+{
+	static_cast<QFileDialog*>(ptr)->filterSelected(QString(filter));
+}
+
+void QFileDialog_Open(void* ptr, void* receiver, char* member)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(receiver))) {
+		static_cast<QFileDialog*>(ptr)->open(static_cast<QGraphicsObject*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QFileDialog*>(ptr)->open(static_cast<QGraphicsWidget*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(receiver))) {
+		static_cast<QFileDialog*>(ptr)->open(static_cast<QLayout*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QFileDialog*>(ptr)->open(static_cast<QWidget*>(receiver), const_cast<const char*>(member));
+	} else {
+		static_cast<QFileDialog*>(ptr)->open(static_cast<QObject*>(receiver), const_cast<const char*>(member));
+	}
+}
+
+void QFileDialog_SelectFile(void* ptr, char* filename)
+{
+	static_cast<QFileDialog*>(ptr)->selectFile(QString(filename));
+}
+
+void QFileDialog_SelectMimeTypeFilter(void* ptr, char* filter)
+{
+	static_cast<QFileDialog*>(ptr)->selectMimeTypeFilter(QString(filter));
+}
+
+void QFileDialog_SelectNameFilter(void* ptr, char* filter)
+{
+	static_cast<QFileDialog*>(ptr)->selectNameFilter(QString(filter));
+}
+
+void QFileDialog_SelectUrl(void* ptr, void* url)
+{
+	static_cast<QFileDialog*>(ptr)->selectUrl(*static_cast<QUrl*>(url));
+}
+
+void QFileDialog_SetAcceptMode(void* ptr, long long mode)
+{
+	static_cast<QFileDialog*>(ptr)->setAcceptMode(static_cast<QFileDialog::AcceptMode>(mode));
+}
+
+void QFileDialog_SetConfirmOverwrite(void* ptr, char enabled)
+{
+	static_cast<QFileDialog*>(ptr)->setConfirmOverwrite(enabled != 0);
+}
+
+void QFileDialog_SetDefaultSuffix(void* ptr, char* suffix)
+{
+	static_cast<QFileDialog*>(ptr)->setDefaultSuffix(QString(suffix));
+}
+
+void QFileDialog_SetDirectory2(void* ptr, void* directory)
+{
+	static_cast<QFileDialog*>(ptr)->setDirectory(*static_cast<QDir*>(directory));
+}
+
+void QFileDialog_SetDirectory(void* ptr, char* directory)
+{
+	static_cast<QFileDialog*>(ptr)->setDirectory(QString(directory));
+}
+
+void QFileDialog_SetDirectoryUrl(void* ptr, void* directory)
+{
+	static_cast<QFileDialog*>(ptr)->setDirectoryUrl(*static_cast<QUrl*>(directory));
+}
+
+void QFileDialog_SetFileMode(void* ptr, long long mode)
+{
+	static_cast<QFileDialog*>(ptr)->setFileMode(static_cast<QFileDialog::FileMode>(mode));
+}
+
+void QFileDialog_SetFilter(void* ptr, long long filters)
+{
+	static_cast<QFileDialog*>(ptr)->setFilter(static_cast<QDir::Filter>(filters));
+}
+
+void QFileDialog_SetHistory(void* ptr, char* paths)
+{
+	static_cast<QFileDialog*>(ptr)->setHistory(goUnpackStringList(paths));
+}
+
+void QFileDialog_SetIconProvider(void* ptr, void* provider)
+{
+	static_cast<QFileDialog*>(ptr)->setIconProvider(static_cast<QFileIconProvider*>(provider));
+}
+
+void QFileDialog_SetItemDelegate(void* ptr, void* delegate)
+{
+	static_cast<QFileDialog*>(ptr)->setItemDelegate(static_cast<QAbstractItemDelegate*>(delegate));
+}
+
+void QFileDialog_SetLabelText(void* ptr, long long label, char* text)
+{
+	static_cast<QFileDialog*>(ptr)->setLabelText(static_cast<QFileDialog::DialogLabel>(label), QString(text));
+}
+
+void QFileDialog_SetMimeTypeFilters(void* ptr, char* filters)
+{
+	static_cast<QFileDialog*>(ptr)->setMimeTypeFilters(goUnpackStringList(filters));
+}
+
+void QFileDialog_SetNameFilter(void* ptr, char* filter)
+{
+	static_cast<QFileDialog*>(ptr)->setNameFilter(QString(filter));
+}
+
+void QFileDialog_SetNameFilterDetailsVisible(void* ptr, char enabled)
+{
+	static_cast<QFileDialog*>(ptr)->setNameFilterDetailsVisible(enabled != 0);
+}
+
+void QFileDialog_SetNameFilters(void* ptr, char* filters)
+{
+	static_cast<QFileDialog*>(ptr)->setNameFilters(goUnpackStringList(filters));
+}
+
+void QFileDialog_SetOption(void* ptr, long long option, char on)
+{
+	static_cast<QFileDialog*>(ptr)->setOption(static_cast<QFileDialog::Option>(option), on != 0);
+}
+
+void QFileDialog_SetOptions(void* ptr, long long options)
+{
+	static_cast<QFileDialog*>(ptr)->setOptions(static_cast<QFileDialog::Option>(options));
+}
+
+void QFileDialog_SetProxyModel(void* ptr, void* proxyModel)
+{
+	static_cast<QFileDialog*>(ptr)->setProxyModel(static_cast<QAbstractProxyModel*>(proxyModel));
+}
+
+void QFileDialog_SetReadOnly(void* ptr, char enabled)
+{
+	static_cast<QFileDialog*>(ptr)->setReadOnly(enabled != 0);
+}
+
+void QFileDialog_SetResolveSymlinks(void* ptr, char enabled)
+{
+	static_cast<QFileDialog*>(ptr)->setResolveSymlinks(enabled != 0);
+}
+
+void QFileDialog_SetSidebarUrls(void* ptr, void* urls)
+{
+	static_cast<QFileDialog*>(ptr)->setSidebarUrls(*static_cast<QList<QUrl>*>(urls));
+}
+
+void QFileDialog_SetSupportedSchemes(void* ptr, char* schemes)
+{
+	static_cast<QFileDialog*>(ptr)->setSupportedSchemes(goUnpackStringList(schemes));
+}
+
+void QFileDialog_SetViewMode(void* ptr, long long mode)
+{
+	static_cast<QFileDialog*>(ptr)->setViewMode(static_cast<QFileDialog::ViewMode>(mode));
+}
+
+void QFileDialog_ConnectUrlSelected(void* ptr)
+{
+	QObject::connect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QUrl &)>(&QFileDialog::urlSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QUrl &)>(&MyQFileDialog::Signal_UrlSelected));
+}
+
+void QFileDialog_DisconnectUrlSelected(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QUrl &)>(&QFileDialog::urlSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QUrl &)>(&MyQFileDialog::Signal_UrlSelected));
+}
+
+void QFileDialog_UrlSelected(void* ptr, void* url)
+{
+	static_cast<QFileDialog*>(ptr)->urlSelected(*static_cast<QUrl*>(url));
+}
+
+void QFileDialog_ConnectUrlsSelected(void* ptr)
+{
+	QObject::connect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QList<QUrl> &)>(&QFileDialog::urlsSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QList<QUrl> &)>(&MyQFileDialog::Signal_UrlsSelected));
+}
+
+void QFileDialog_DisconnectUrlsSelected(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileDialog*>(ptr), static_cast<void (QFileDialog::*)(const QList<QUrl> &)>(&QFileDialog::urlsSelected), static_cast<MyQFileDialog*>(ptr), static_cast<void (MyQFileDialog::*)(const QList<QUrl> &)>(&MyQFileDialog::Signal_UrlsSelected));
+}
+
+void QFileDialog_UrlsSelected(void* ptr, void* urls)
+{
+	static_cast<QFileDialog*>(ptr)->urlsSelected(*static_cast<QList<QUrl>*>(urls));
+}
+
+void QFileDialog_DestroyQFileDialog(void* ptr)
+{
+	static_cast<QFileDialog*>(ptr)->~QFileDialog();
+}
+
+long long QFileDialog_AcceptMode(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->acceptMode();
+}
+
+long long QFileDialog_FileMode(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->fileMode();
+}
+
+long long QFileDialog_Options(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->options();
+}
+
+void* QFileDialog_ItemDelegate(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->itemDelegate();
+}
+
+void* QFileDialog_ProxyModel(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->proxyModel();
+}
+
+void* QFileDialog_SaveState(void* ptr)
+{
+	return new QByteArray(static_cast<QFileDialog*>(ptr)->saveState());
+}
+
+void* QFileDialog_Directory(void* ptr)
+{
+	return new QDir(static_cast<QFileDialog*>(ptr)->directory());
+}
+
+long long QFileDialog_Filter(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->filter();
+}
+
+void* QFileDialog_IconProvider(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->iconProvider();
+}
+
+struct QtWidgets_PackedList QFileDialog_SelectedUrls(void* ptr)
+{
+	return ({ QList<QUrl>* tmpValue = new QList<QUrl>(static_cast<QFileDialog*>(ptr)->selectedUrls()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QFileDialog_SidebarUrls(void* ptr)
+{
+	return ({ QList<QUrl>* tmpValue = new QList<QUrl>(static_cast<QFileDialog*>(ptr)->sidebarUrls()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_DefaultSuffix(void* ptr)
+{
+	return ({ QByteArray t9b6b68 = static_cast<QFileDialog*>(ptr)->defaultSuffix().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t9b6b68.prepend("WHITESPACE").constData()+10), t9b6b68.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_LabelText(void* ptr, long long label)
+{
+	return ({ QByteArray td750f3 = static_cast<QFileDialog*>(ptr)->labelText(static_cast<QFileDialog::DialogLabel>(label)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(td750f3.prepend("WHITESPACE").constData()+10), td750f3.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_SelectedNameFilter(void* ptr)
+{
+	return ({ QByteArray tca1caa = static_cast<QFileDialog*>(ptr)->selectedNameFilter().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tca1caa.prepend("WHITESPACE").constData()+10), tca1caa.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_History(void* ptr)
+{
+	return ({ long long t242067len; char* t242067 = goPackStringList(static_cast<QFileDialog*>(ptr)->history(), &t242067len); QtWidgets_PackedString { t242067, t242067len }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_MimeTypeFilters(void* ptr)
+{
+	return ({ long long t17a2a7len; char* t17a2a7 = goPackStringList(static_cast<QFileDialog*>(ptr)->mimeTypeFilters(), &t17a2a7len); QtWidgets_PackedString { t17a2a7, t17a2a7len }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_NameFilters(void* ptr)
+{
+	return ({ long long t4389e5len; char* t4389e5 = goPackStringList(static_cast<QFileDialog*>(ptr)->nameFilters(), &t4389e5len); QtWidgets_PackedString { t4389e5, t4389e5len }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_SelectedFiles(void* ptr)
+{
+	return ({ long long tc6127blen; char* tc6127b = goPackStringList(static_cast<QFileDialog*>(ptr)->selectedFiles(), &tc6127blen); QtWidgets_PackedString { tc6127b, tc6127blen }; });
+}
+
+struct QtWidgets_PackedString QFileDialog_SupportedSchemes(void* ptr)
+{
+	return ({ long long tfcd263len; char* tfcd263 = goPackStringList(static_cast<QFileDialog*>(ptr)->supportedSchemes(), &tfcd263len); QtWidgets_PackedString { tfcd263, tfcd263len }; });
+}
+
+void* QFileDialog_DirectoryUrl(void* ptr)
+{
+	return new QUrl(static_cast<QFileDialog*>(ptr)->directoryUrl());
+}
+
+long long QFileDialog_ViewMode(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->viewMode();
+}
+
+char QFileDialog_ConfirmOverwrite(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->confirmOverwrite();
+}
+
+char QFileDialog_IsNameFilterDetailsVisible(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->isNameFilterDetailsVisible();
+}
+
+char QFileDialog_IsReadOnly(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->isReadOnly();
+}
+
+char QFileDialog_ResolveSymlinks(void* ptr)
+{
+	return static_cast<QFileDialog*>(ptr)->resolveSymlinks();
+}
+
+char QFileDialog_TestOption(void* ptr, long long option)
+{
+	return static_cast<QFileDialog*>(ptr)->testOption(static_cast<QFileDialog::Option>(option));
+}
+
+void* QFileDialog___getOpenFileUrls_atList(void* ptr, int i)
+{
+	return new QUrl(static_cast<QList<QUrl>*>(ptr)->at(i));
+}
+
+void QFileDialog___getOpenFileUrls_setList(void* ptr, void* i)
+{
+	static_cast<QList<QUrl>*>(ptr)->append(*static_cast<QUrl*>(i));
+}
+
+void* QFileDialog___getOpenFileUrls_newList(void* ptr)
+{
+	return new QList<QUrl>;
+}
+
+void* QFileDialog___setSidebarUrls_urls_atList(void* ptr, int i)
+{
+	return new QUrl(static_cast<QList<QUrl>*>(ptr)->at(i));
+}
+
+void QFileDialog___setSidebarUrls_urls_setList(void* ptr, void* i)
+{
+	static_cast<QList<QUrl>*>(ptr)->append(*static_cast<QUrl*>(i));
+}
+
+void* QFileDialog___setSidebarUrls_urls_newList(void* ptr)
+{
+	return new QList<QUrl>;
+}
+
+void* QFileDialog___urlsSelected_urls_atList(void* ptr, int i)
+{
+	return new QUrl(static_cast<QList<QUrl>*>(ptr)->at(i));
+}
+
+void QFileDialog___urlsSelected_urls_setList(void* ptr, void* i)
+{
+	static_cast<QList<QUrl>*>(ptr)->append(*static_cast<QUrl*>(i));
+}
+
+void* QFileDialog___urlsSelected_urls_newList(void* ptr)
+{
+	return new QList<QUrl>;
+}
+
+void* QFileDialog___selectedUrls_atList(void* ptr, int i)
+{
+	return new QUrl(static_cast<QList<QUrl>*>(ptr)->at(i));
+}
+
+void QFileDialog___selectedUrls_setList(void* ptr, void* i)
+{
+	static_cast<QList<QUrl>*>(ptr)->append(*static_cast<QUrl*>(i));
+}
+
+void* QFileDialog___selectedUrls_newList(void* ptr)
+{
+	return new QList<QUrl>;
+}
+
+void* QFileDialog___sidebarUrls_atList(void* ptr, int i)
+{
+	return new QUrl(static_cast<QList<QUrl>*>(ptr)->at(i));
+}
+
+void QFileDialog___sidebarUrls_setList(void* ptr, void* i)
+{
+	static_cast<QList<QUrl>*>(ptr)->append(*static_cast<QUrl*>(i));
+}
+
+void* QFileDialog___sidebarUrls_newList(void* ptr)
+{
+	return new QList<QUrl>;
+}
+
+class MyQFileIconProvider: public QFileIconProvider
+{
+public:
+	MyQFileIconProvider() : QFileIconProvider() {};
+	 ~MyQFileIconProvider() { callbackQFileIconProvider_DestroyQFileIconProvider(this); };
+	QIcon icon(QFileIconProvider::IconType ty) const { return *static_cast<QIcon*>(callbackQFileIconProvider_Icon(const_cast<void*>(static_cast<const void*>(this)), ty)); };
+	QIcon icon(const QFileInfo & info) const { return *static_cast<QIcon*>(callbackQFileIconProvider_Icon2(const_cast<void*>(static_cast<const void*>(this)), const_cast<QFileInfo*>(&info))); };
+	QString type(const QFileInfo & info) const { return QString(callbackQFileIconProvider_Type(const_cast<void*>(static_cast<const void*>(this)), const_cast<QFileInfo*>(&info))); };
+};
+
+void* QFileIconProvider_NewQFileIconProvider()
+{
+	return new MyQFileIconProvider();
+}
+
+void QFileIconProvider_SetOptions(void* ptr, long long options)
+{
+	static_cast<QFileIconProvider*>(ptr)->setOptions(static_cast<QFileIconProvider::Option>(options));
+}
+
+void QFileIconProvider_DestroyQFileIconProvider(void* ptr)
+{
+	static_cast<QFileIconProvider*>(ptr)->~QFileIconProvider();
+}
+
+void QFileIconProvider_DestroyQFileIconProviderDefault(void* ptr)
+{
+
+}
+
+long long QFileIconProvider_Options(void* ptr)
+{
+	return static_cast<QFileIconProvider*>(ptr)->options();
+}
+
+void* QFileIconProvider_Icon(void* ptr, long long ty)
+{
+	return new QIcon(static_cast<QFileIconProvider*>(ptr)->icon(static_cast<QFileIconProvider::IconType>(ty)));
+}
+
+void* QFileIconProvider_IconDefault(void* ptr, long long ty)
+{
+		return new QIcon(static_cast<QFileIconProvider*>(ptr)->QFileIconProvider::icon(static_cast<QFileIconProvider::IconType>(ty)));
+}
+
+void* QFileIconProvider_Icon2(void* ptr, void* info)
+{
+	return new QIcon(static_cast<QFileIconProvider*>(ptr)->icon(*static_cast<QFileInfo*>(info)));
+}
+
+void* QFileIconProvider_Icon2Default(void* ptr, void* info)
+{
+		return new QIcon(static_cast<QFileIconProvider*>(ptr)->QFileIconProvider::icon(*static_cast<QFileInfo*>(info)));
+}
+
+struct QtWidgets_PackedString QFileIconProvider_Type(void* ptr, void* info)
+{
+	return ({ QByteArray t69d0f8 = static_cast<QFileIconProvider*>(ptr)->type(*static_cast<QFileInfo*>(info)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t69d0f8.prepend("WHITESPACE").constData()+10), t69d0f8.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileIconProvider_TypeDefault(void* ptr, void* info)
+{
+		return ({ QByteArray tb3bd2f = static_cast<QFileIconProvider*>(ptr)->QFileIconProvider::type(*static_cast<QFileInfo*>(info)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(tb3bd2f.prepend("WHITESPACE").constData()+10), tb3bd2f.size()-10 }; });
+}
+
+class MyQFileSystemModel: public QFileSystemModel
+{
+public:
+	MyQFileSystemModel(QObject *parent) : QFileSystemModel(parent) {};
+	bool dropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) { return callbackQFileSystemModel_DropMimeData(this, const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool event(QEvent * event) { return callbackQFileSystemModel_Event(this, event) != 0; };
+	bool setData(const QModelIndex & idx, const QVariant & value, int role) { return callbackQFileSystemModel_SetData(this, const_cast<QModelIndex*>(&idx), const_cast<QVariant*>(&value), role) != 0; };
+	void Signal_DirectoryLoaded(const QString & path) { QByteArray t3150ec = path.toUtf8(); QtWidgets_PackedString pathPacked = { const_cast<char*>(t3150ec.prepend("WHITESPACE").constData()+10), t3150ec.size()-10 };callbackQFileSystemModel_DirectoryLoaded(this, pathPacked); };
+	void fetchMore(const QModelIndex & parent) { callbackQFileSystemModel_FetchMore(this, const_cast<QModelIndex*>(&parent)); };
+	void Signal_FileRenamed(const QString & path, const QString & oldName, const QString & newName) { QByteArray t3150ec = path.toUtf8(); QtWidgets_PackedString pathPacked = { const_cast<char*>(t3150ec.prepend("WHITESPACE").constData()+10), t3150ec.size()-10 };QByteArray td041bb = oldName.toUtf8(); QtWidgets_PackedString oldNamePacked = { const_cast<char*>(td041bb.prepend("WHITESPACE").constData()+10), td041bb.size()-10 };QByteArray t1530cb = newName.toUtf8(); QtWidgets_PackedString newNamePacked = { const_cast<char*>(t1530cb.prepend("WHITESPACE").constData()+10), t1530cb.size()-10 };callbackQFileSystemModel_FileRenamed(this, pathPacked, oldNamePacked, newNamePacked); };
+	void Signal_RootPathChanged(const QString & newPath) { QByteArray t1ced92 = newPath.toUtf8(); QtWidgets_PackedString newPathPacked = { const_cast<char*>(t1ced92.prepend("WHITESPACE").constData()+10), t1ced92.size()-10 };callbackQFileSystemModel_RootPathChanged(this, newPathPacked); };
+	void sort(int column, Qt::SortOrder order) { callbackQFileSystemModel_Sort(this, column, order); };
+	void timerEvent(QTimerEvent * event) { callbackQFileSystemModel_TimerEvent(this, event); };
+	QMimeData * mimeData(const QModelIndexList & indexes) const { return static_cast<QMimeData*>(callbackQFileSystemModel_MimeData(const_cast<void*>(static_cast<const void*>(this)), ({ QList<QModelIndex>* tmpValue = new QList<QModelIndex>(indexes); QtWidgets_PackedList { tmpValue, tmpValue->size() }; }))); };
+	QModelIndex index(int row, int column, const QModelIndex & parent) const { return *static_cast<QModelIndex*>(callbackQFileSystemModel_Index(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&parent))); };
+	QModelIndex parent(const QModelIndex & index) const { return *static_cast<QModelIndex*>(callbackQFileSystemModel_Parent(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QModelIndex sibling(int row, int column, const QModelIndex & idx) const { return *static_cast<QModelIndex*>(callbackQFileSystemModel_Sibling(const_cast<void*>(static_cast<const void*>(this)), row, column, const_cast<QModelIndex*>(&idx))); };
+	QStringList mimeTypes() const { char* tmp = callbackQFileSystemModel_MimeTypes(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
+	QVariant data(const QModelIndex & index, int role) const { QVariant ret; callbackQFileSystemModel_Data(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), role, &ret); return ret; };
+	QVariant headerData(int section, Qt::Orientation orientation, int role) const { return *static_cast<QVariant*>(callbackQFileSystemModel_HeaderData(const_cast<void*>(static_cast<const void*>(this)), section, orientation, role)); };
+	Qt::DropActions supportedDropActions() const { return static_cast<Qt::DropAction>(callbackQFileSystemModel_SupportedDropActions(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::ItemFlags flags(const QModelIndex & index) const { return static_cast<Qt::ItemFlag>(callbackQFileSystemModel_Flags(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	bool canFetchMore(const QModelIndex & parent) const { return callbackQFileSystemModel_CanFetchMore(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)) != 0; };
+	bool hasChildren(const QModelIndex & parent) const { return callbackQFileSystemModel_HasChildren(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)) != 0; };
+	int columnCount(const QModelIndex & parent) const { return callbackQFileSystemModel_ColumnCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
+	int rowCount(const QModelIndex & parent) const { return callbackQFileSystemModel_RowCount(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&parent)); };
+	bool insertColumns(int column, int count, const QModelIndex & parent) { return callbackQFileSystemModel_InsertColumns(this, column, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool insertRows(int row, int count, const QModelIndex & parent) { return callbackQFileSystemModel_InsertRows(this, row, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool moveColumns(const QModelIndex & sourceParent, int sourceColumn, int count, const QModelIndex & destinationParent, int destinationChild) { return callbackQFileSystemModel_MoveColumns(this, const_cast<QModelIndex*>(&sourceParent), sourceColumn, count, const_cast<QModelIndex*>(&destinationParent), destinationChild) != 0; };
+	bool moveRows(const QModelIndex & sourceParent, int sourceRow, int count, const QModelIndex & destinationParent, int destinationChild) { return callbackQFileSystemModel_MoveRows(this, const_cast<QModelIndex*>(&sourceParent), sourceRow, count, const_cast<QModelIndex*>(&destinationParent), destinationChild) != 0; };
+	bool removeColumns(int column, int count, const QModelIndex & parent) { return callbackQFileSystemModel_RemoveColumns(this, column, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool removeRows(int row, int count, const QModelIndex & parent) { return callbackQFileSystemModel_RemoveRows(this, row, count, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool setHeaderData(int section, Qt::Orientation orientation, const QVariant & value, int role) { return callbackQFileSystemModel_SetHeaderData(this, section, orientation, const_cast<QVariant*>(&value), role) != 0; };
+	bool setItemData(const QModelIndex & index, const QMap<int, QVariant> & roles) { return callbackQFileSystemModel_SetItemData(this, const_cast<QModelIndex*>(&index), ({ QMap<int, QVariant>* tmpValue = const_cast<QMap<int, QVariant>*>(&roles); QtWidgets_PackedList { tmpValue, tmpValue->size() }; })) != 0; };
+	bool submit() { return callbackQFileSystemModel_Submit(this) != 0; };
+	void Signal_ColumnsAboutToBeInserted(const QModelIndex & parent, int first, int last) { callbackQFileSystemModel_ColumnsAboutToBeInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsAboutToBeMoved(const QModelIndex & sourceParent, int sourceStart, int sourceEnd, const QModelIndex & destinationParent, int destinationColumn) { callbackQFileSystemModel_ColumnsAboutToBeMoved(this, const_cast<QModelIndex*>(&sourceParent), sourceStart, sourceEnd, const_cast<QModelIndex*>(&destinationParent), destinationColumn); };
+	void Signal_ColumnsAboutToBeRemoved(const QModelIndex & parent, int first, int last) { callbackQFileSystemModel_ColumnsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsInserted(const QModelIndex & parent, int first, int last) { callbackQFileSystemModel_ColumnsInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_ColumnsMoved(const QModelIndex & parent, int start, int end, const QModelIndex & destination, int column) { callbackQFileSystemModel_ColumnsMoved(this, const_cast<QModelIndex*>(&parent), start, end, const_cast<QModelIndex*>(&destination), column); };
+	void Signal_ColumnsRemoved(const QModelIndex & parent, int first, int last) { callbackQFileSystemModel_ColumnsRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_DataChanged(const QModelIndex & topLeft, const QModelIndex & bottomRight, const QVector<int> & roles) { callbackQFileSystemModel_DataChanged(this, const_cast<QModelIndex*>(&topLeft), const_cast<QModelIndex*>(&bottomRight), ({ QVector<int>* tmpValue = const_cast<QVector<int>*>(&roles); QtWidgets_PackedList { tmpValue, tmpValue->size() }; })); };
+	void Signal_HeaderDataChanged(Qt::Orientation orientation, int first, int last) { callbackQFileSystemModel_HeaderDataChanged(this, orientation, first, last); };
+	void Signal_LayoutAboutToBeChanged(const QList<QPersistentModelIndex> & parents, QAbstractItemModel::LayoutChangeHint hint) { callbackQFileSystemModel_LayoutAboutToBeChanged(this, ({ QList<QPersistentModelIndex>* tmpValue = const_cast<QList<QPersistentModelIndex>*>(&parents); QtWidgets_PackedList { tmpValue, tmpValue->size() }; }), hint); };
+	void Signal_LayoutChanged(const QList<QPersistentModelIndex> & parents, QAbstractItemModel::LayoutChangeHint hint) { callbackQFileSystemModel_LayoutChanged(this, ({ QList<QPersistentModelIndex>* tmpValue = const_cast<QList<QPersistentModelIndex>*>(&parents); QtWidgets_PackedList { tmpValue, tmpValue->size() }; }), hint); };
+	void Signal_ModelAboutToBeReset() { callbackQFileSystemModel_ModelAboutToBeReset(this); };
+	void Signal_ModelReset() { callbackQFileSystemModel_ModelReset(this); };
+	void resetInternalData() { callbackQFileSystemModel_ResetInternalData(this); };
+	void revert() { callbackQFileSystemModel_Revert(this); };
+	void Signal_RowsAboutToBeInserted(const QModelIndex & parent, int start, int end) { callbackQFileSystemModel_RowsAboutToBeInserted(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void Signal_RowsAboutToBeMoved(const QModelIndex & sourceParent, int sourceStart, int sourceEnd, const QModelIndex & destinationParent, int destinationRow) { callbackQFileSystemModel_RowsAboutToBeMoved(this, const_cast<QModelIndex*>(&sourceParent), sourceStart, sourceEnd, const_cast<QModelIndex*>(&destinationParent), destinationRow); };
+	void Signal_RowsAboutToBeRemoved(const QModelIndex & parent, int first, int last) { callbackQFileSystemModel_RowsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_RowsInserted(const QModelIndex & parent, int first, int last) { callbackQFileSystemModel_RowsInserted(this, const_cast<QModelIndex*>(&parent), first, last); };
+	void Signal_RowsMoved(const QModelIndex & parent, int start, int end, const QModelIndex & destination, int row) { callbackQFileSystemModel_RowsMoved(this, const_cast<QModelIndex*>(&parent), start, end, const_cast<QModelIndex*>(&destination), row); };
+	void Signal_RowsRemoved(const QModelIndex & parent, int first, int last) { callbackQFileSystemModel_RowsRemoved(this, const_cast<QModelIndex*>(&parent), first, last); };
+	QHash<int, QByteArray> roleNames() const { return *static_cast<QHash<int, QByteArray>*>(callbackQFileSystemModel_RoleNames(const_cast<void*>(static_cast<const void*>(this)))); };
+	QMap<int, QVariant> itemData(const QModelIndex & index) const { return *static_cast<QMap<int, QVariant>*>(callbackQFileSystemModel_ItemData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QModelIndex buddy(const QModelIndex & index) const { return *static_cast<QModelIndex*>(callbackQFileSystemModel_Buddy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QList<QModelIndex> match(const QModelIndex & start, int role, const QVariant & value, int hits, Qt::MatchFlags flags) const { return *static_cast<QList<QModelIndex>*>(callbackQFileSystemModel_Match(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&start), role, const_cast<QVariant*>(&value), hits, flags)); };
+	QSize span(const QModelIndex & index) const { return *static_cast<QSize*>(callbackQFileSystemModel_Span(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	Qt::DropActions supportedDragActions() const { return static_cast<Qt::DropAction>(callbackQFileSystemModel_SupportedDragActions(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool canDropMimeData(const QMimeData * data, Qt::DropAction action, int row, int column, const QModelIndex & parent) const { return callbackQFileSystemModel_CanDropMimeData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QMimeData*>(data), action, row, column, const_cast<QModelIndex*>(&parent)) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQFileSystemModel_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQFileSystemModel_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQFileSystemModel_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQFileSystemModel_CustomEvent(this, event); };
+	void deleteLater() { callbackQFileSystemModel_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQFileSystemModel_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQFileSystemModel_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQFileSystemModel_ObjectNameChanged(this, objectNamePacked); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQFileSystemModel_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+int QFileSystemModel_FilePathRole_Type()
+{
+	return QFileSystemModel::FilePathRole;
+}
+
+int QFileSystemModel_FileNameRole_Type()
+{
+	return QFileSystemModel::FileNameRole;
+}
+
+int QFileSystemModel_FilePermissions_Type()
+{
+	return QFileSystemModel::FilePermissions;
+}
+
+void* QFileSystemModel_NewQFileSystemModel(void* parent)
+{
+	return new MyQFileSystemModel(static_cast<QObject*>(parent));
+}
+
+void* QFileSystemModel_Mkdir(void* ptr, void* parent, char* name)
+{
+	return new QModelIndex(static_cast<QFileSystemModel*>(ptr)->mkdir(*static_cast<QModelIndex*>(parent), QString(name)));
+}
+
+void* QFileSystemModel_SetRootPath(void* ptr, char* newPath)
+{
+	return new QModelIndex(static_cast<QFileSystemModel*>(ptr)->setRootPath(QString(newPath)));
+}
+
+char QFileSystemModel_DropMimeDataDefault(void* ptr, void* data, long long action, int row, int column, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::dropMimeData(static_cast<QMimeData*>(data), static_cast<Qt::DropAction>(action), row, column, *static_cast<QModelIndex*>(parent));
+}
+
+char QFileSystemModel_EventDefault(void* ptr, void* event)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::event(static_cast<QEvent*>(event));
+}
+
+char QFileSystemModel_Remove(void* ptr, void* index)
+{
+	return static_cast<QFileSystemModel*>(ptr)->remove(*static_cast<QModelIndex*>(index));
+}
+
+char QFileSystemModel_Rmdir(void* ptr, void* index)
+{
+	return static_cast<QFileSystemModel*>(ptr)->rmdir(*static_cast<QModelIndex*>(index));
+}
+
+char QFileSystemModel_SetDataDefault(void* ptr, void* idx, void* value, int role)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::setData(*static_cast<QModelIndex*>(idx), *static_cast<QVariant*>(value), role);
+}
+
+void QFileSystemModel_ConnectDirectoryLoaded(void* ptr)
+{
+	QObject::connect(static_cast<QFileSystemModel*>(ptr), static_cast<void (QFileSystemModel::*)(const QString &)>(&QFileSystemModel::directoryLoaded), static_cast<MyQFileSystemModel*>(ptr), static_cast<void (MyQFileSystemModel::*)(const QString &)>(&MyQFileSystemModel::Signal_DirectoryLoaded));
+}
+
+void QFileSystemModel_DisconnectDirectoryLoaded(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileSystemModel*>(ptr), static_cast<void (QFileSystemModel::*)(const QString &)>(&QFileSystemModel::directoryLoaded), static_cast<MyQFileSystemModel*>(ptr), static_cast<void (MyQFileSystemModel::*)(const QString &)>(&MyQFileSystemModel::Signal_DirectoryLoaded));
+}
+
+void QFileSystemModel_DirectoryLoaded(void* ptr, char* path)
+{
+	static_cast<QFileSystemModel*>(ptr)->directoryLoaded(QString(path));
+}
+
+void QFileSystemModel_FetchMoreDefault(void* ptr, void* parent)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::fetchMore(*static_cast<QModelIndex*>(parent));
+}
+
+void QFileSystemModel_ConnectFileRenamed(void* ptr)
+{
+	QObject::connect(static_cast<QFileSystemModel*>(ptr), static_cast<void (QFileSystemModel::*)(const QString &, const QString &, const QString &)>(&QFileSystemModel::fileRenamed), static_cast<MyQFileSystemModel*>(ptr), static_cast<void (MyQFileSystemModel::*)(const QString &, const QString &, const QString &)>(&MyQFileSystemModel::Signal_FileRenamed));
+}
+
+void QFileSystemModel_DisconnectFileRenamed(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileSystemModel*>(ptr), static_cast<void (QFileSystemModel::*)(const QString &, const QString &, const QString &)>(&QFileSystemModel::fileRenamed), static_cast<MyQFileSystemModel*>(ptr), static_cast<void (MyQFileSystemModel::*)(const QString &, const QString &, const QString &)>(&MyQFileSystemModel::Signal_FileRenamed));
+}
+
+void QFileSystemModel_FileRenamed(void* ptr, char* path, char* oldName, char* newName)
+{
+	static_cast<QFileSystemModel*>(ptr)->fileRenamed(QString(path), QString(oldName), QString(newName));
+}
+
+void QFileSystemModel_ConnectRootPathChanged(void* ptr)
+{
+	QObject::connect(static_cast<QFileSystemModel*>(ptr), static_cast<void (QFileSystemModel::*)(const QString &)>(&QFileSystemModel::rootPathChanged), static_cast<MyQFileSystemModel*>(ptr), static_cast<void (MyQFileSystemModel::*)(const QString &)>(&MyQFileSystemModel::Signal_RootPathChanged));
+}
+
+void QFileSystemModel_DisconnectRootPathChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QFileSystemModel*>(ptr), static_cast<void (QFileSystemModel::*)(const QString &)>(&QFileSystemModel::rootPathChanged), static_cast<MyQFileSystemModel*>(ptr), static_cast<void (MyQFileSystemModel::*)(const QString &)>(&MyQFileSystemModel::Signal_RootPathChanged));
+}
+
+void QFileSystemModel_RootPathChanged(void* ptr, char* newPath)
+{
+	static_cast<QFileSystemModel*>(ptr)->rootPathChanged(QString(newPath));
+}
+
+void QFileSystemModel_SetFilter(void* ptr, long long filters)
+{
+	static_cast<QFileSystemModel*>(ptr)->setFilter(static_cast<QDir::Filter>(filters));
+}
+
+void QFileSystemModel_SetIconProvider(void* ptr, void* provider)
+{
+	static_cast<QFileSystemModel*>(ptr)->setIconProvider(static_cast<QFileIconProvider*>(provider));
+}
+
+void QFileSystemModel_SetNameFilterDisables(void* ptr, char enable)
+{
+	static_cast<QFileSystemModel*>(ptr)->setNameFilterDisables(enable != 0);
+}
+
+void QFileSystemModel_SetNameFilters(void* ptr, char* filters)
+{
+	static_cast<QFileSystemModel*>(ptr)->setNameFilters(goUnpackStringList(filters));
+}
+
+void QFileSystemModel_SetReadOnly(void* ptr, char enable)
+{
+	static_cast<QFileSystemModel*>(ptr)->setReadOnly(enable != 0);
+}
+
+void QFileSystemModel_SetResolveSymlinks(void* ptr, char enable)
+{
+	static_cast<QFileSystemModel*>(ptr)->setResolveSymlinks(enable != 0);
+}
+
+void QFileSystemModel_SortDefault(void* ptr, int column, long long order)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::sort(column, static_cast<Qt::SortOrder>(order));
+}
+
+void QFileSystemModel_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void QFileSystemModel_DestroyQFileSystemModel(void* ptr)
+{
+	static_cast<QFileSystemModel*>(ptr)->~QFileSystemModel();
+}
+
+void* QFileSystemModel_LastModified(void* ptr, void* index)
+{
+	return new QDateTime(static_cast<QFileSystemModel*>(ptr)->lastModified(*static_cast<QModelIndex*>(index)));
+}
+
+void* QFileSystemModel_RootDirectory(void* ptr)
+{
+	return new QDir(static_cast<QFileSystemModel*>(ptr)->rootDirectory());
+}
+
+long long QFileSystemModel_Filter(void* ptr)
+{
+	return static_cast<QFileSystemModel*>(ptr)->filter();
+}
+
+void* QFileSystemModel_IconProvider(void* ptr)
+{
+	return static_cast<QFileSystemModel*>(ptr)->iconProvider();
+}
+
+void* QFileSystemModel_FileInfo(void* ptr, void* index)
+{
+	return new QFileInfo(static_cast<QFileSystemModel*>(ptr)->fileInfo(*static_cast<QModelIndex*>(index)));
+}
+
+void* QFileSystemModel_FileIcon(void* ptr, void* index)
+{
+	return new QIcon(static_cast<QFileSystemModel*>(ptr)->fileIcon(*static_cast<QModelIndex*>(index)));
+}
+
+void* QFileSystemModel_MimeDataDefault(void* ptr, void* indexes)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::mimeData(*static_cast<QList<QModelIndex>*>(indexes));
+}
+
+void* QFileSystemModel_Index2(void* ptr, char* path, int column)
+{
+	return new QModelIndex(static_cast<QFileSystemModel*>(ptr)->index(QString(path), column));
+}
+
+void* QFileSystemModel_Index(void* ptr, int row, int column, void* parent)
+{
+	return new QModelIndex(static_cast<QFileSystemModel*>(ptr)->index(row, column, *static_cast<QModelIndex*>(parent)));
+}
+
+void* QFileSystemModel_IndexDefault(void* ptr, int row, int column, void* parent)
+{
+		return new QModelIndex(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::index(row, column, *static_cast<QModelIndex*>(parent)));
+}
+
+void* QFileSystemModel_Parent(void* ptr, void* index)
+{
+	return new QModelIndex(static_cast<QFileSystemModel*>(ptr)->parent(*static_cast<QModelIndex*>(index)));
+}
+
+void* QFileSystemModel_ParentDefault(void* ptr, void* index)
+{
+		return new QModelIndex(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::parent(*static_cast<QModelIndex*>(index)));
+}
+
+void* QFileSystemModel_SiblingDefault(void* ptr, int row, int column, void* idx)
+{
+		return new QModelIndex(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::sibling(row, column, *static_cast<QModelIndex*>(idx)));
+}
+
+struct QtWidgets_PackedString QFileSystemModel_FileName(void* ptr, void* index)
+{
+	return ({ QByteArray t9528ac = static_cast<QFileSystemModel*>(ptr)->fileName(*static_cast<QModelIndex*>(index)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t9528ac.prepend("WHITESPACE").constData()+10), t9528ac.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileSystemModel_FilePath(void* ptr, void* index)
+{
+	return ({ QByteArray t6d0e31 = static_cast<QFileSystemModel*>(ptr)->filePath(*static_cast<QModelIndex*>(index)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t6d0e31.prepend("WHITESPACE").constData()+10), t6d0e31.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileSystemModel_RootPath(void* ptr)
+{
+	return ({ QByteArray tdcb5b3 = static_cast<QFileSystemModel*>(ptr)->rootPath().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tdcb5b3.prepend("WHITESPACE").constData()+10), tdcb5b3.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileSystemModel_Type(void* ptr, void* index)
+{
+	return ({ QByteArray tf8baa8 = static_cast<QFileSystemModel*>(ptr)->type(*static_cast<QModelIndex*>(index)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(tf8baa8.prepend("WHITESPACE").constData()+10), tf8baa8.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QFileSystemModel_MimeTypesDefault(void* ptr)
+{
+		return ({ long long t836878len; char* t836878 = goPackStringList(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::mimeTypes(), &t836878len); QtWidgets_PackedString { t836878, t836878len }; });
+}
+
+struct QtWidgets_PackedString QFileSystemModel_NameFilters(void* ptr)
+{
+	return ({ long long te17825len; char* te17825 = goPackStringList(static_cast<QFileSystemModel*>(ptr)->nameFilters(), &te17825len); QtWidgets_PackedString { te17825, te17825len }; });
+}
+
+void* QFileSystemModel_Data(void* ptr, void* index, int role)
+{
+	return new QVariant(static_cast<QFileSystemModel*>(ptr)->data(*static_cast<QModelIndex*>(index), role));
+}
+
+void* QFileSystemModel_DataDefault(void* ptr, void* index, int role)
+{
+		return new QVariant(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::data(*static_cast<QModelIndex*>(index), role));
+}
+
+void QFileSystemModel_DataDefaultInto(void* ptr, void* index, int role, void* ret)
+{
+		*static_cast<QVariant*>(ret) = QVariant(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::data(*static_cast<QModelIndex*>(index), role));
+}
+
+void* QFileSystemModel_HeaderDataDefault(void* ptr, int section, long long orientation, int role)
+{
+		return new QVariant(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::headerData(section, static_cast<Qt::Orientation>(orientation), role));
+}
+
+void* QFileSystemModel_MyComputer(void* ptr, int role)
+{
+	return new QVariant(static_cast<QFileSystemModel*>(ptr)->myComputer(role));
+}
+
+long long QFileSystemModel_SupportedDropActionsDefault(void* ptr)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::supportedDropActions();
+}
+
+long long QFileSystemModel_FlagsDefault(void* ptr, void* index)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::flags(*static_cast<QModelIndex*>(index));
+}
+
+char QFileSystemModel_CanFetchMoreDefault(void* ptr, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::canFetchMore(*static_cast<QModelIndex*>(parent));
+}
+
+char QFileSystemModel_HasChildrenDefault(void* ptr, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::hasChildren(*static_cast<QModelIndex*>(parent));
+}
+
+char QFileSystemModel_IsDir(void* ptr, void* index)
+{
+	return static_cast<QFileSystemModel*>(ptr)->isDir(*static_cast<QModelIndex*>(index));
+}
+
+char QFileSystemModel_IsReadOnly(void* ptr)
+{
+	return static_cast<QFileSystemModel*>(ptr)->isReadOnly();
+}
+
+char QFileSystemModel_NameFilterDisables(void* ptr)
+{
+	return static_cast<QFileSystemModel*>(ptr)->nameFilterDisables();
+}
+
+char QFileSystemModel_ResolveSymlinks(void* ptr)
+{
+	return static_cast<QFileSystemModel*>(ptr)->resolveSymlinks();
+}
+
+int QFileSystemModel_ColumnCount(void* ptr, void* parent)
+{
+	return static_cast<QFileSystemModel*>(ptr)->columnCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QFileSystemModel_ColumnCountDefault(void* ptr, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::columnCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QFileSystemModel_RowCount(void* ptr, void* parent)
+{
+	return static_cast<QFileSystemModel*>(ptr)->rowCount(*static_cast<QModelIndex*>(parent));
+}
+
+int QFileSystemModel_RowCountDefault(void* ptr, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::rowCount(*static_cast<QModelIndex*>(parent));
+}
+
+long long QFileSystemModel_Size(void* ptr, void* index)
+{
+	return static_cast<QFileSystemModel*>(ptr)->size(*static_cast<QModelIndex*>(index));
+}
+
+void* QFileSystemModel___mimeData_indexes_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___mimeData_indexes_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QFileSystemModel___mimeData_indexes_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+void* QFileSystemModel___setItemData_roles_atList(void* ptr, int i)
+{
+	return new QVariant(static_cast<QMap<int, QVariant>*>(ptr)->value(i));
+}
+
+void QFileSystemModel___setItemData_roles_setList(void* ptr, int key, void* i)
+{
+	static_cast<QMap<int, QVariant>*>(ptr)->insert(key, *static_cast<QVariant*>(i));
+}
+
+void* QFileSystemModel___setItemData_roles_newList(void* ptr)
+{
+	return new QMap<int, QVariant>;
+}
+
+struct QtWidgets_PackedList QFileSystemModel___setItemData_keyList(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QMap<int, QVariant>*>(ptr)->keys()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QFileSystemModel___changePersistentIndexList_from_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___changePersistentIndexList_from_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QFileSystemModel___changePersistentIndexList_from_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+void* QFileSystemModel___changePersistentIndexList_to_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___changePersistentIndexList_to_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QFileSystemModel___changePersistentIndexList_to_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+int QFileSystemModel___dataChanged_roles_atList(void* ptr, int i)
+{
+	return static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+void QFileSystemModel___dataChanged_roles_setList(void* ptr, int i)
+{
+	static_cast<QVector<int>*>(ptr)->append(i);
+}
+
+void* QFileSystemModel___dataChanged_roles_newList(void* ptr)
+{
+	return new QVector<int>;
+}
+
+void* QFileSystemModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QVector<int>* tmpList = new QVector<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QFileSystemModel___dataChanged_roles_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QVector<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QVector<int>*>(ptr)->at(i);
+}
+
+void* QFileSystemModel___layoutAboutToBeChanged_parents_atList(void* ptr, int i)
+{
+	return new QPersistentModelIndex(static_cast<QList<QPersistentModelIndex>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___layoutAboutToBeChanged_parents_setList(void* ptr, void* i)
+{
+	static_cast<QList<QPersistentModelIndex>*>(ptr)->append(*static_cast<QPersistentModelIndex*>(i));
+}
+
+void* QFileSystemModel___layoutAboutToBeChanged_parents_newList(void* ptr)
+{
+	return new QList<QPersistentModelIndex>;
+}
+
+void* QFileSystemModel___layoutChanged_parents_atList(void* ptr, int i)
+{
+	return new QPersistentModelIndex(static_cast<QList<QPersistentModelIndex>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___layoutChanged_parents_setList(void* ptr, void* i)
+{
+	static_cast<QList<QPersistentModelIndex>*>(ptr)->append(*static_cast<QPersistentModelIndex*>(i));
+}
+
+void* QFileSystemModel___layoutChanged_parents_newList(void* ptr)
+{
+	return new QList<QPersistentModelIndex>;
+}
+
+void* QFileSystemModel___roleNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QHash<int, QByteArray>*>(ptr)->value(i));
+}
+
+void QFileSystemModel___roleNames_setList(void* ptr, int key, void* i)
+{
+	static_cast<QHash<int, QByteArray>*>(ptr)->insert(key, *static_cast<QByteArray*>(i));
+}
+
+void* QFileSystemModel___roleNames_newList(void* ptr)
+{
+	return new QHash<int, QByteArray>;
+}
+
+struct QtWidgets_PackedList QFileSystemModel___roleNames_keyList(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QHash<int, QByteArray>*>(ptr)->keys()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QFileSystemModel___itemData_atList(void* ptr, int i)
+{
+	return new QVariant(static_cast<QMap<int, QVariant>*>(ptr)->value(i));
+}
+
+void QFileSystemModel___itemData_setList(void* ptr, int key, void* i)
+{
+	static_cast<QMap<int, QVariant>*>(ptr)->insert(key, *static_cast<QVariant*>(i));
+}
+
+void* QFileSystemModel___itemData_newList(void* ptr)
+{
+	return new QMap<int, QVariant>;
+}
+
+struct QtWidgets_PackedList QFileSystemModel___itemData_keyList(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QMap<int, QVariant>*>(ptr)->keys()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QFileSystemModel___match_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___match_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QFileSystemModel___match_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+void* QFileSystemModel___persistentIndexList_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___persistentIndexList_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QFileSystemModel___persistentIndexList_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+int QFileSystemModel_____setItemData_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QFileSystemModel_____setItemData_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QFileSystemModel_____setItemData_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QFileSystemModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QFileSystemModel_____setItemData_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QFileSystemModel_____doSetRoleNames_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QFileSystemModel_____doSetRoleNames_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QFileSystemModel_____doSetRoleNames_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QFileSystemModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QFileSystemModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QFileSystemModel_____setRoleNames_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QFileSystemModel_____setRoleNames_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QFileSystemModel_____setRoleNames_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QFileSystemModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QFileSystemModel_____setRoleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QFileSystemModel_____roleNames_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QFileSystemModel_____roleNames_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QFileSystemModel_____roleNames_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QFileSystemModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QFileSystemModel_____roleNames_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QFileSystemModel_____itemData_keyList_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QFileSystemModel_____itemData_keyList_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QFileSystemModel_____itemData_keyList_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QFileSystemModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QFileSystemModel_____itemData_keyList_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void* QFileSystemModel___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QFileSystemModel___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QFileSystemModel___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QFileSystemModel___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QFileSystemModel___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QFileSystemModel___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QFileSystemModel___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QFileSystemModel___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QFileSystemModel___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QFileSystemModel___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QFileSystemModel___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QFileSystemModel_InsertColumnsDefault(void* ptr, int column, int count, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::insertColumns(column, count, *static_cast<QModelIndex*>(parent));
+}
+
+char QFileSystemModel_InsertRowsDefault(void* ptr, int row, int count, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::insertRows(row, count, *static_cast<QModelIndex*>(parent));
+}
+
+char QFileSystemModel_MoveColumnsDefault(void* ptr, void* sourceParent, int sourceColumn, int count, void* destinationParent, int destinationChild)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::moveColumns(*static_cast<QModelIndex*>(sourceParent), sourceColumn, count, *static_cast<QModelIndex*>(destinationParent), destinationChild);
+}
+
+char QFileSystemModel_MoveRowsDefault(void* ptr, void* sourceParent, int sourceRow, int count, void* destinationParent, int destinationChild)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::moveRows(*static_cast<QModelIndex*>(sourceParent), sourceRow, count, *static_cast<QModelIndex*>(destinationParent), destinationChild);
+}
+
+char QFileSystemModel_RemoveColumnsDefault(void* ptr, int column, int count, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::removeColumns(column, count, *static_cast<QModelIndex*>(parent));
+}
+
+char QFileSystemModel_RemoveRowsDefault(void* ptr, int row, int count, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::removeRows(row, count, *static_cast<QModelIndex*>(parent));
+}
+
+char QFileSystemModel_SetHeaderDataDefault(void* ptr, int section, long long orientation, void* value, int role)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::setHeaderData(section, static_cast<Qt::Orientation>(orientation), *static_cast<QVariant*>(value), role);
+}
+
+char QFileSystemModel_SetItemDataDefault(void* ptr, void* index, void* roles)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::setItemData(*static_cast<QModelIndex*>(index), *static_cast<QMap<int, QVariant>*>(roles));
+}
+
+char QFileSystemModel_SubmitDefault(void* ptr)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::submit();
+}
+
+void QFileSystemModel_ResetInternalDataDefault(void* ptr)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::resetInternalData();
+}
+
+void QFileSystemModel_RevertDefault(void* ptr)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::revert();
+}
+
+struct QtWidgets_PackedList QFileSystemModel_RoleNamesDefault(void* ptr)
+{
+		return ({ QHash<int, QByteArray>* tmpValue = new QHash<int, QByteArray>(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::roleNames()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QFileSystemModel_ItemDataDefault(void* ptr, void* index)
+{
+		return ({ QMap<int, QVariant>* tmpValue = new QMap<int, QVariant>(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::itemData(*static_cast<QModelIndex*>(index))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QFileSystemModel_BuddyDefault(void* ptr, void* index)
+{
+		return new QModelIndex(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::buddy(*static_cast<QModelIndex*>(index)));
+}
+
+struct QtWidgets_PackedList QFileSystemModel_MatchDefault(void* ptr, void* start, int role, void* value, int hits, long long flags)
+{
+		return ({ QList<QModelIndex>* tmpValue = new QList<QModelIndex>(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::match(*static_cast<QModelIndex*>(start), role, *static_cast<QVariant*>(value), hits, static_cast<Qt::MatchFlag>(flags))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QFileSystemModel_SpanDefault(void* ptr, void* index)
+{
+		return ({ QSize tmpValue = static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::span(*static_cast<QModelIndex*>(index)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+long long QFileSystemModel_SupportedDragActionsDefault(void* ptr)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::supportedDragActions();
+}
+
+char QFileSystemModel_CanDropMimeDataDefault(void* ptr, void* data, long long action, int row, int column, void* parent)
+{
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::canDropMimeData(static_cast<QMimeData*>(data), static_cast<Qt::DropAction>(action), row, column, *static_cast<QModelIndex*>(parent));
+}
+
+char QFileSystemModel_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QFileSystemModel_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QFileSystemModel_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QFileSystemModel_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::customEvent(static_cast<QEvent*>(event));
+}
+
+void QFileSystemModel_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::deleteLater();
+}
+
+void QFileSystemModel_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void* QFileSystemModel_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QFileSystemModel*>(ptr)->QFileSystemModel::metaObject());
+}
+
+class MyQFocusFrame: public QFocusFrame
+{
+public:
+	MyQFocusFrame(QWidget *parent) : QFocusFrame(parent) {};
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QFocusFrame_NewQFocusFrame(void* parent)
+{
+	return new MyQFocusFrame(static_cast<QWidget*>(parent));
+}
+
+void QFocusFrame_SetWidget(void* ptr, void* widget)
+{
+		static_cast<QFocusFrame*>(ptr)->setWidget(static_cast<QWidget*>(widget));
+}
+
+void QFocusFrame_DestroyQFocusFrame(void* ptr)
+{
+	static_cast<QFocusFrame*>(ptr)->~QFocusFrame();
+}
+
+void* QFocusFrame_Widget(void* ptr)
+{
+	return static_cast<QFocusFrame*>(ptr)->widget();
+}
+
+void QFocusFrame_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QFocusFrame*>(ptr)->initStyleOption(static_cast<QStyleOption*>(option));
+}
+
+class MyQFontComboBox: public QFontComboBox
+{
+public:
+	MyQFontComboBox(QWidget *parent) : QFontComboBox(parent) {};
+	void Signal_CurrentFontChanged(const QFont & font) { callbackQFontComboBox_CurrentFontChanged(this, const_cast<QFont*>(&font)); };
+	void setCurrentFont(const QFont & f) { callbackQFontComboBox_SetCurrentFont(this, const_cast<QFont*>(&f)); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void Signal_Activated2(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQComboBox_Activated2(this, textPacked); };
+	void Signal_Activated(int index) { callbackQComboBox_Activated(this, index); };
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void clear() { callbackQComboBox_Clear(this); };
+	void clearEditText() { callbackQComboBox_ClearEditText(this); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void Signal_CurrentIndexChanged2(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQComboBox_CurrentIndexChanged2(this, textPacked); };
+	void Signal_CurrentIndexChanged(int index) { callbackQComboBox_CurrentIndexChanged(this, index); };
+	void Signal_CurrentTextChanged(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQComboBox_CurrentTextChanged(this, textPacked); };
+	void Signal_EditTextChanged(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQComboBox_EditTextChanged(this, textPacked); };
+	void focusInEvent(QFocusEvent * e) { callbackQWidget_FocusInEvent(this, e); };
+	void focusOutEvent(QFocusEvent * e) { callbackQWidget_FocusOutEvent(this, e); };
+	void hideEvent(QHideEvent * e) { callbackQWidget_HideEvent(this, e); };
+	void hidePopup() { callbackQComboBox_HidePopup(this); };
+	void Signal_Highlighted2(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQComboBox_Highlighted2(this, textPacked); };
+	void Signal_Highlighted(int index) { callbackQComboBox_Highlighted(this, index); };
+	void inputMethodEvent(QInputMethodEvent * e) { callbackQWidget_InputMethodEvent(this, e); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void keyReleaseEvent(QKeyEvent * e) { callbackQWidget_KeyReleaseEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * e) { callbackQWidget_PaintEvent(this, e); };
+	void resizeEvent(QResizeEvent * e) { callbackQWidget_ResizeEvent(this, e); };
+	void setCurrentIndex(int index) { callbackQComboBox_SetCurrentIndex(this, index); };
+	void setCurrentText(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQComboBox_SetCurrentText(this, textPacked); };
+	void setEditText(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQComboBox_SetEditText(this, textPacked); };
+	void showEvent(QShowEvent * e) { callbackQWidget_ShowEvent(this, e); };
+	void showPopup() { callbackQComboBox_ShowPopup(this); };
+	void wheelEvent(QWheelEvent * e) { callbackQWidget_WheelEvent(this, e); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QFontComboBox_ConnectCurrentFontChanged(void* ptr)
+{
+	QObject::connect(static_cast<QFontComboBox*>(ptr), static_cast<void (QFontComboBox::*)(const QFont &)>(&QFontComboBox::currentFontChanged), static_cast<MyQFontComboBox*>(ptr), static_cast<void (MyQFontComboBox::*)(const QFont &)>(&MyQFontComboBox::Signal_CurrentFontChanged));
+}
+
+void QFontComboBox_DisconnectCurrentFontChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QFontComboBox*>(ptr), static_cast<void (QFontComboBox::*)(const QFont &)>(&QFontComboBox::currentFontChanged), static_cast<MyQFontComboBox*>(ptr), static_cast<void (MyQFontComboBox::*)(const QFont &)>(&MyQFontComboBox::Signal_CurrentFontChanged));
+}
+
+void QFontComboBox_CurrentFontChanged(void* ptr, void* font)
+{
+	static_cast<QFontComboBox*>(ptr)->currentFontChanged(*static_cast<QFont*>(font));
+}
+
+void QFontComboBox_SetCurrentFont(void* ptr, void* f)
+{
+	QMetaObject::invokeMethod(static_cast<QFontComboBox*>(ptr), "setCurrentFont", Q_ARG(QFont, *static_cast<QFont*>(f)));
+}
+
+void QFontComboBox_SetCurrentFontDefault(void* ptr, void* f)
+{
+		static_cast<QFontComboBox*>(ptr)->QFontComboBox::setCurrentFont(*static_cast<QFont*>(f));
+}
+
+void QFontComboBox_SetFontFilters(void* ptr, long long filters)
+{
+	static_cast<QFontComboBox*>(ptr)->setFontFilters(static_cast<QFontComboBox::FontFilter>(filters));
+}
+
+void* QFontComboBox_NewQFontComboBox(void* parent)
+{
+	return new MyQFontComboBox(static_cast<QWidget*>(parent));
+}
+
+void QFontComboBox_SetWritingSystem(void* ptr, long long vqf)
+{
+	static_cast<QFontComboBox*>(ptr)->setWritingSystem(static_cast<QFontDatabase::WritingSystem>(vqf));
+}
+
+void QFontComboBox_DestroyQFontComboBox(void* ptr)
+{
+	static_cast<QFontComboBox*>(ptr)->~QFontComboBox();
+}
+
+long long QFontComboBox_FontFilters(void* ptr)
+{
+	return static_cast<QFontComboBox*>(ptr)->fontFilters();
+}
+
+void* QFontComboBox_CurrentFont(void* ptr)
+{
+	return new QFont(static_cast<QFontComboBox*>(ptr)->currentFont());
+}
+
+class MyQFontDialog: public QFontDialog
+{
+public:
+	MyQFontDialog(QWidget *parent) : QFontDialog(parent) {};
+	MyQFontDialog(const QFont &initial, QWidget *parent) : QFontDialog(initial, parent) {};
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void Signal_CurrentFontChanged(const QFont & font) { callbackQFontDialog_CurrentFontChanged(this, const_cast<QFont*>(&font)); };
+	void done(int result) { callbackQFontDialog_Done(this, result); };
+	void Signal_FontSelected(const QFont & font) { callbackQFontDialog_FontSelected(this, const_cast<QFont*>(&font)); };
+	void setVisible(bool visible) { callbackQDialog_SetVisible(this, visible); };
+	int exec() { return callbackQDialog_Exec(this); };
+	void accept() { callbackQDialog_Accept(this); };
+	void Signal_Accepted() { callbackQDialog_Accepted(this); };
+	void closeEvent(QCloseEvent * e) { callbackQWidget_CloseEvent(this, e); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void Signal_Finished(int result) { callbackQDialog_Finished(this, result); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void open() { callbackQDialog_Open(this); };
+	void reject() { callbackQDialog_Reject(this); };
+	void Signal_Rejected() { callbackQDialog_Rejected(this); };
+	void resizeEvent(QResizeEvent * vqr) { callbackQWidget_ResizeEvent(this, vqr); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QFontDialog_Open(void* ptr, void* receiver, char* member)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(receiver))) {
+		static_cast<QFontDialog*>(ptr)->open(static_cast<QGraphicsObject*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QFontDialog*>(ptr)->open(static_cast<QGraphicsWidget*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(receiver))) {
+		static_cast<QFontDialog*>(ptr)->open(static_cast<QLayout*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QFontDialog*>(ptr)->open(static_cast<QWidget*>(receiver), const_cast<const char*>(member));
+	} else {
+		static_cast<QFontDialog*>(ptr)->open(static_cast<QObject*>(receiver), const_cast<const char*>(member));
+	}
+}
+
+void QFontDialog_SetOptions(void* ptr, long long options)
+{
+	static_cast<QFontDialog*>(ptr)->setOptions(static_cast<QFontDialog::FontDialogOption>(options));
+}
+
+void* QFontDialog_QFontDialog_GetFont2(char ok, void* parent)
+{
+		return new QFont(QFontDialog::getFont(NULL, static_cast<QWidget*>(parent)));
+}
+
+void* QFontDialog_QFontDialog_GetFont(char ok, void* initial, void* parent, char* title, long long options)
+{
+		return new QFont(QFontDialog::getFont(NULL, *static_cast<QFont*>(initial), static_cast<QWidget*>(parent), QString(title), static_cast<QFontDialog::FontDialogOption>(options)));
+}
+
+void* QFontDialog_NewQFontDialog(void* parent)
+{
+	return new MyQFontDialog(static_cast<QWidget*>(parent));
+}
+
+void* QFontDialog_NewQFontDialog2(void* initial, void* parent)
+{
+	return new MyQFontDialog(*static_cast<QFont*>(initial), static_cast<QWidget*>(parent));
+}
+
+void QFontDialog_ConnectCurrentFontChanged(void* ptr)
+{
+	QObject::connect(static_cast<QFontDialog*>(ptr), static_cast<void (QFontDialog::*)(const QFont &)>(&QFontDialog::currentFontChanged), static_cast<MyQFontDialog*>(ptr), static_cast<void (MyQFontDialog::*)(const QFont &)>(&MyQFontDialog::Signal_CurrentFontChanged));
+}
+
+void QFontDialog_DisconnectCurrentFontChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QFontDialog*>(ptr), static_cast<void (QFontDialog::*)(const QFont &)>(&QFontDialog::currentFontChanged), static_cast<MyQFontDialog*>(ptr), static_cast<void (MyQFontDialog::*)(const QFont &)>(&MyQFontDialog::Signal_CurrentFontChanged));
+}
+
+void QFontDialog_CurrentFontChanged(void* ptr, void* font)
+{
+	static_cast<QFontDialog*>(ptr)->currentFontChanged(*static_cast<QFont*>(font));
+}
+
+void QFontDialog_Done(void* ptr, int result)
+{
+	static_cast<QFontDialog*>(ptr)->done(result);
+}
+
+void QFontDialog_DoneDefault(void* ptr, int result)
+{
+		static_cast<QFontDialog*>(ptr)->QFontDialog::done(result);
+}
+
+void QFontDialog_ConnectFontSelected(void* ptr)
+{
+	QObject::connect(static_cast<QFontDialog*>(ptr), static_cast<void (QFontDialog::*)(const QFont &)>(&QFontDialog::fontSelected), static_cast<MyQFontDialog*>(ptr), static_cast<void (MyQFontDialog::*)(const QFont &)>(&MyQFontDialog::Signal_FontSelected));
+}
+
+void QFontDialog_DisconnectFontSelected(void* ptr)
+{
+	QObject::disconnect(static_cast<QFontDialog*>(ptr), static_cast<void (QFontDialog::*)(const QFont &)>(&QFontDialog::fontSelected), static_cast<MyQFontDialog*>(ptr), static_cast<void (MyQFontDialog::*)(const QFont &)>(&MyQFontDialog::Signal_FontSelected));
+}
+
+void QFontDialog_FontSelected(void* ptr, void* font)
+{
+	static_cast<QFontDialog*>(ptr)->fontSelected(*static_cast<QFont*>(font));
+}
+
+void QFontDialog_SetCurrentFont(void* ptr, void* font)
+{
+	static_cast<QFontDialog*>(ptr)->setCurrentFont(*static_cast<QFont*>(font));
+}
+
+void QFontDialog_SetOption(void* ptr, long long option, char on)
+{
+	static_cast<QFontDialog*>(ptr)->setOption(static_cast<QFontDialog::FontDialogOption>(option), on != 0);
+}
+
+long long QFontDialog_Options(void* ptr)
+{
+	return static_cast<QFontDialog*>(ptr)->options();
+}
+
+void* QFontDialog_CurrentFont(void* ptr)
+{
+	return new QFont(static_cast<QFontDialog*>(ptr)->currentFont());
+}
+
+void* QFontDialog_SelectedFont(void* ptr)
+{
+	return new QFont(static_cast<QFontDialog*>(ptr)->selectedFont());
+}
+
+char QFontDialog_TestOption(void* ptr, long long option)
+{
+	return static_cast<QFontDialog*>(ptr)->testOption(static_cast<QFontDialog::FontDialogOption>(option));
+}
+
+class MyQFormLayout: public QFormLayout
+{
+public:
+	MyQFormLayout(QWidget *parent) : QFormLayout(parent) {};
+	QLayoutItem * takeAt(int index) { return static_cast<QLayoutItem*>(callbackQFormLayout_TakeAt(this, index)); };
+	void addItem(QLayoutItem * item) { callbackQFormLayout_AddItem(this, item); };
+	void invalidate() { callbackQLayoutItem_Invalidate(this); };
+	void setGeometry(const QRect & rect) { callbackQLayout_SetGeometry(this, const_cast<QRect*>(&rect)); };
+	QSize minimumSize() const { return *static_cast<QSize*>(callbackQLayout_MinimumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQFormLayout_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::Orientations expandingDirections() const { return static_cast<Qt::Orientation>(callbackQLayout_ExpandingDirections(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQLayoutItem_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int count() const { return callbackQFormLayout_Count(const_cast<void*>(static_cast<const void*>(this))); };
+	int heightForWidth(int width) const { return callbackQLayoutItem_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), width); };
+	QLayout * layout() { return static_cast<QLayout*>(callbackQLayoutItem_Layout(this)); };
+	void childEvent(QChildEvent * e) { callbackQLayout_ChildEvent(this, e); };
+	
+	QRect geometry() const { return *static_cast<QRect*>(callbackQLayout_Geometry(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize maximumSize() const { return *static_cast<QSize*>(callbackQLayout_MaximumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSizePolicy::ControlTypes controlTypes() const { return static_cast<QSizePolicy::ControlType>(callbackQLayoutItem_ControlTypes(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool isEmpty() const { return callbackQLayout_IsEmpty(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int indexOf(QWidget * widget) const { return callbackQLayout_IndexOf(const_cast<void*>(static_cast<const void*>(this)), widget); };
+	bool event(QEvent * e) { return callbackQLayout_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQLayout_EventFilter(this, watched, event) != 0; };
+	void connectNotify(const QMetaMethod & sign) { callbackQLayout_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQLayout_CustomEvent(this, event); };
+	void deleteLater() { callbackQLayout_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQLayout_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQLayout_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQLayout_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQLayout_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQLayout_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSpacerItem * spacerItem() { return static_cast<QSpacerItem*>(callbackQLayoutItem_SpacerItem(this)); };
+	QWidget * widget() { return static_cast<QWidget*>(callbackQLayoutItem_Widget(this)); };
+	int minimumHeightForWidth(int w) const { return callbackQLayoutItem_MinimumHeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+};
+
+void* QFormLayout_NewQFormLayout(void* parent)
+{
+	return new MyQFormLayout(static_cast<QWidget*>(parent));
+}
+
+void* QFormLayout_TakeAt(void* ptr, int index)
+{
+	return static_cast<QFormLayout*>(ptr)->takeAt(index);
+}
+
+void* QFormLayout_TakeAtDefault(void* ptr, int index)
+{
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::takeAt(index);
+}
+
+void QFormLayout_AddItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(item))) {
+		static_cast<QFormLayout*>(ptr)->addItem(static_cast<QLayout*>(item));
+	} else {
+		static_cast<QFormLayout*>(ptr)->addItem(static_cast<QLayoutItem*>(item));
+	}
+}
+
+void QFormLayout_AddItemDefault(void* ptr, void* item)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(item))) {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::addItem(static_cast<QLayout*>(item));
+	} else {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::addItem(static_cast<QLayoutItem*>(item));
+	}
+}
+
+void QFormLayout_AddRow6(void* ptr, void* layout)
+{
+		static_cast<QFormLayout*>(ptr)->addRow(static_cast<QLayout*>(layout));
+}
+
+void QFormLayout_AddRow2(void* ptr, void* label, void* field)
+{
+		static_cast<QFormLayout*>(ptr)->addRow(static_cast<QWidget*>(label), static_cast<QLayout*>(field));
+}
+
+void QFormLayout_AddRow(void* ptr, void* label, void* field)
+{
+		static_cast<QFormLayout*>(ptr)->addRow(static_cast<QWidget*>(label), static_cast<QWidget*>(field));
+}
+
+void QFormLayout_AddRow5(void* ptr, void* widget)
+{
+		static_cast<QFormLayout*>(ptr)->addRow(static_cast<QWidget*>(widget));
+}
+
+void QFormLayout_AddRow4(void* ptr, char* labelText, void* field)
+{
+		static_cast<QFormLayout*>(ptr)->addRow(QString(labelText), static_cast<QLayout*>(field));
+}
+
+void QFormLayout_AddRow3(void* ptr, char* labelText, void* field)
+{
+		static_cast<QFormLayout*>(ptr)->addRow(QString(labelText), static_cast<QWidget*>(field));
+}
+
+void QFormLayout_InsertRow6(void* ptr, int row, void* layout)
+{
+		static_cast<QFormLayout*>(ptr)->insertRow(row, static_cast<QLayout*>(layout));
+}
+
+void QFormLayout_InsertRow2(void* ptr, int row, void* label, void* field)
+{
+		static_cast<QFormLayout*>(ptr)->insertRow(row, static_cast<QWidget*>(label), static_cast<QLayout*>(field));
+}
+
+void QFormLayout_InsertRow(void* ptr, int row, void* label, void* field)
+{
+		static_cast<QFormLayout*>(ptr)->insertRow(row, static_cast<QWidget*>(label), static_cast<QWidget*>(field));
+}
+
+void QFormLayout_InsertRow5(void* ptr, int row, void* widget)
+{
+		static_cast<QFormLayout*>(ptr)->insertRow(row, static_cast<QWidget*>(widget));
+}
+
+void QFormLayout_InsertRow4(void* ptr, int row, char* labelText, void* field)
+{
+		static_cast<QFormLayout*>(ptr)->insertRow(row, QString(labelText), static_cast<QLayout*>(field));
+}
+
+void QFormLayout_InsertRow3(void* ptr, int row, char* labelText, void* field)
+{
+		static_cast<QFormLayout*>(ptr)->insertRow(row, QString(labelText), static_cast<QWidget*>(field));
+}
+
+void QFormLayout_RemoveRow3(void* ptr, void* layout)
+{
+		static_cast<QFormLayout*>(ptr)->removeRow(static_cast<QLayout*>(layout));
+}
+
+void QFormLayout_RemoveRow2(void* ptr, void* widget)
+{
+		static_cast<QFormLayout*>(ptr)->removeRow(static_cast<QWidget*>(widget));
+}
+
+void QFormLayout_RemoveRow(void* ptr, int row)
+{
+	static_cast<QFormLayout*>(ptr)->removeRow(row);
+}
+
+void QFormLayout_SetFieldGrowthPolicy(void* ptr, long long policy)
+{
+	static_cast<QFormLayout*>(ptr)->setFieldGrowthPolicy(static_cast<QFormLayout::FieldGrowthPolicy>(policy));
+}
+
+void QFormLayout_SetFormAlignment(void* ptr, long long alignment)
+{
+	static_cast<QFormLayout*>(ptr)->setFormAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QFormLayout_SetHorizontalSpacing(void* ptr, int spacing)
+{
+	static_cast<QFormLayout*>(ptr)->setHorizontalSpacing(spacing);
+}
+
+void QFormLayout_SetItem(void* ptr, int row, long long role, void* item)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(item))) {
+		static_cast<QFormLayout*>(ptr)->setItem(row, static_cast<QFormLayout::ItemRole>(role), static_cast<QLayout*>(item));
+	} else {
+		static_cast<QFormLayout*>(ptr)->setItem(row, static_cast<QFormLayout::ItemRole>(role), static_cast<QLayoutItem*>(item));
+	}
+}
+
+void QFormLayout_SetLabelAlignment(void* ptr, long long alignment)
+{
+	static_cast<QFormLayout*>(ptr)->setLabelAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QFormLayout_SetLayout(void* ptr, int row, long long role, void* layout)
+{
+		static_cast<QFormLayout*>(ptr)->setLayout(row, static_cast<QFormLayout::ItemRole>(role), static_cast<QLayout*>(layout));
+}
+
+void QFormLayout_SetRowWrapPolicy(void* ptr, long long policy)
+{
+	static_cast<QFormLayout*>(ptr)->setRowWrapPolicy(static_cast<QFormLayout::RowWrapPolicy>(policy));
+}
+
+void QFormLayout_SetVerticalSpacing(void* ptr, int spacing)
+{
+	static_cast<QFormLayout*>(ptr)->setVerticalSpacing(spacing);
+}
+
+void QFormLayout_SetWidget(void* ptr, int row, long long role, void* widget)
+{
+		static_cast<QFormLayout*>(ptr)->setWidget(row, static_cast<QFormLayout::ItemRole>(role), static_cast<QWidget*>(widget));
+}
+
+void QFormLayout_DestroyQFormLayout(void* ptr)
+{
+	static_cast<QFormLayout*>(ptr)->~QFormLayout();
+}
+
+long long QFormLayout_FieldGrowthPolicy(void* ptr)
+{
+	return static_cast<QFormLayout*>(ptr)->fieldGrowthPolicy();
+}
+
+void* QFormLayout_SizeHint(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QFormLayout*>(ptr)->sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QFormLayout_SizeHintDefault(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QFormLayout*>(ptr)->QFormLayout::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QFormLayout_LabelForField2(void* ptr, void* field)
+{
+		return static_cast<QFormLayout*>(ptr)->labelForField(static_cast<QLayout*>(field));
+}
+
+void* QFormLayout_LabelForField(void* ptr, void* field)
+{
+		return static_cast<QFormLayout*>(ptr)->labelForField(static_cast<QWidget*>(field));
+}
+
+long long QFormLayout_FormAlignment(void* ptr)
+{
+	return static_cast<QFormLayout*>(ptr)->formAlignment();
+}
+
+long long QFormLayout_LabelAlignment(void* ptr)
+{
+	return static_cast<QFormLayout*>(ptr)->labelAlignment();
+}
+
+long long QFormLayout_RowWrapPolicy(void* ptr)
+{
+	return static_cast<QFormLayout*>(ptr)->rowWrapPolicy();
+}
+
+int QFormLayout_Count(void* ptr)
+{
+	return static_cast<QFormLayout*>(ptr)->count();
+}
+
+int QFormLayout_CountDefault(void* ptr)
+{
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::count();
+}
+
+int QFormLayout_HorizontalSpacing(void* ptr)
+{
+	return static_cast<QFormLayout*>(ptr)->horizontalSpacing();
+}
+
+int QFormLayout_RowCount(void* ptr)
+{
+	return static_cast<QFormLayout*>(ptr)->rowCount();
+}
+
+int QFormLayout_VerticalSpacing(void* ptr)
+{
+	return static_cast<QFormLayout*>(ptr)->verticalSpacing();
+}
+
+
+
+
+
+class MyQFrame: public QFrame
+{
+public:
+	MyQFrame(QWidget *parent, Qt::WindowFlags f) : QFrame(parent, f) {};
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QFrame_NewQFrame(void* parent, long long f)
+{
+	return new MyQFrame(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(f));
+}
+
+void QFrame_SetFrameRect(void* ptr, void* vqr)
+{
+	static_cast<QFrame*>(ptr)->setFrameRect(*static_cast<QRect*>(vqr));
+}
+
+void QFrame_SetFrameShadow(void* ptr, long long vsh)
+{
+	static_cast<QFrame*>(ptr)->setFrameShadow(static_cast<QFrame::Shadow>(vsh));
+}
+
+void QFrame_SetFrameShape(void* ptr, long long vsh)
+{
+	static_cast<QFrame*>(ptr)->setFrameShape(static_cast<QFrame::Shape>(vsh));
+}
+
+void QFrame_SetFrameStyle(void* ptr, int style)
+{
+	static_cast<QFrame*>(ptr)->setFrameStyle(style);
+}
+
+void QFrame_SetLineWidth(void* ptr, int vin)
+{
+	static_cast<QFrame*>(ptr)->setLineWidth(vin);
+}
+
+void QFrame_SetMidLineWidth(void* ptr, int vin)
+{
+	static_cast<QFrame*>(ptr)->setMidLineWidth(vin);
+}
+
+void QFrame_DestroyQFrame(void* ptr)
+{
+	static_cast<QFrame*>(ptr)->~QFrame();
+}
+
+void* QFrame_FrameRect(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QFrame*>(ptr)->frameRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+long long QFrame_FrameShadow(void* ptr)
+{
+	return static_cast<QFrame*>(ptr)->frameShadow();
+}
+
+long long QFrame_FrameShape(void* ptr)
+{
+	return static_cast<QFrame*>(ptr)->frameShape();
+}
+
+int QFrame_FrameStyle(void* ptr)
+{
+	return static_cast<QFrame*>(ptr)->frameStyle();
+}
+
+int QFrame_FrameWidth(void* ptr)
+{
+	return static_cast<QFrame*>(ptr)->frameWidth();
+}
+
+int QFrame_LineWidth(void* ptr)
+{
+	return static_cast<QFrame*>(ptr)->lineWidth();
+}
+
+int QFrame_MidLineWidth(void* ptr)
+{
+	return static_cast<QFrame*>(ptr)->midLineWidth();
+}
+
+void QFrame_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QFrame*>(ptr)->initStyleOption(static_cast<QStyleOptionFrame*>(option));
+}
+
+class MyQGesture: public QGesture
+{
+public:
+	MyQGesture(QObject *parent) : QGesture(parent) {};
+	bool event(QEvent * e) { return callbackQGesture_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGesture_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGesture_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGesture_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGesture_CustomEvent(this, event); };
+	void deleteLater() { callbackQGesture_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGesture_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGesture_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGesture_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGesture_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGesture_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGesture_NewQGesture(void* parent)
+{
+	return new MyQGesture(static_cast<QObject*>(parent));
+}
+
+void QGesture_SetGestureCancelPolicy(void* ptr, long long policy)
+{
+	static_cast<QGesture*>(ptr)->setGestureCancelPolicy(static_cast<QGesture::GestureCancelPolicy>(policy));
+}
+
+void QGesture_SetHotSpot(void* ptr, void* value)
+{
+	static_cast<QGesture*>(ptr)->setHotSpot(*static_cast<QPointF*>(value));
+}
+
+void QGesture_UnsetHotSpot(void* ptr)
+{
+	static_cast<QGesture*>(ptr)->unsetHotSpot();
+}
+
+void QGesture_DestroyQGesture(void* ptr)
+{
+	static_cast<QGesture*>(ptr)->~QGesture();
+}
+
+long long QGesture_GestureCancelPolicy(void* ptr)
+{
+	return static_cast<QGesture*>(ptr)->gestureCancelPolicy();
+}
+
+void* QGesture_HotSpot(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGesture*>(ptr)->hotSpot(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+long long QGesture_State(void* ptr)
+{
+	return static_cast<QGesture*>(ptr)->state();
+}
+
+long long QGesture_GestureType(void* ptr)
+{
+	return static_cast<QGesture*>(ptr)->gestureType();
+}
+
+char QGesture_HasHotSpot(void* ptr)
+{
+	return static_cast<QGesture*>(ptr)->hasHotSpot();
+}
+
+void* QGesture___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QGesture___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QGesture___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QGesture___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGesture___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGesture___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGesture___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGesture___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGesture___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGesture___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGesture___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGesture___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGesture___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QGesture___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGesture___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QGesture_EventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QTapGesture*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTapGesture*>(ptr)->QTapGesture::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QTapAndHoldGesture*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QSwipeGesture*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QPinchGesture*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPinchGesture*>(ptr)->QPinchGesture::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QPanGesture*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QPanGesture*>(ptr)->QPanGesture::event(static_cast<QEvent*>(e));
+	} else {
+		return static_cast<QGesture*>(ptr)->QGesture::event(static_cast<QEvent*>(e));
+	}
+}
+
+char QGesture_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QTapGesture*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTapGesture*>(ptr)->QTapGesture::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTapGesture*>(ptr)->QTapGesture::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTapGesture*>(ptr)->QTapGesture::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTapGesture*>(ptr)->QTapGesture::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QTapGesture*>(ptr)->QTapGesture::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QTapAndHoldGesture*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QSwipeGesture*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QPinchGesture*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPinchGesture*>(ptr)->QPinchGesture::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPinchGesture*>(ptr)->QPinchGesture::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPinchGesture*>(ptr)->QPinchGesture::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPinchGesture*>(ptr)->QPinchGesture::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QPinchGesture*>(ptr)->QPinchGesture::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QPanGesture*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPanGesture*>(ptr)->QPanGesture::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPanGesture*>(ptr)->QPanGesture::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPanGesture*>(ptr)->QPanGesture::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QPanGesture*>(ptr)->QPanGesture::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QPanGesture*>(ptr)->QPanGesture::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGesture*>(ptr)->QGesture::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGesture*>(ptr)->QGesture::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGesture*>(ptr)->QGesture::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGesture*>(ptr)->QGesture::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGesture*>(ptr)->QGesture::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QGesture_ChildEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QTapGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapGesture*>(ptr)->QTapGesture::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QTapAndHoldGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QSwipeGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QPinchGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPinchGesture*>(ptr)->QPinchGesture::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QPanGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPanGesture*>(ptr)->QPanGesture::childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QGesture*>(ptr)->QGesture::childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QGesture_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QTapGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapGesture*>(ptr)->QTapGesture::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTapAndHoldGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSwipeGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPinchGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPinchGesture*>(ptr)->QPinchGesture::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPanGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPanGesture*>(ptr)->QPanGesture::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGesture*>(ptr)->QGesture::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGesture_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QTapGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapGesture*>(ptr)->QTapGesture::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QTapAndHoldGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QSwipeGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPinchGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPinchGesture*>(ptr)->QPinchGesture::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QPanGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPanGesture*>(ptr)->QPanGesture::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGesture*>(ptr)->QGesture::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGesture_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QTapGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapGesture*>(ptr)->QTapGesture::deleteLater();
+	} else if (dynamic_cast<QTapAndHoldGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::deleteLater();
+	} else if (dynamic_cast<QSwipeGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::deleteLater();
+	} else if (dynamic_cast<QPinchGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPinchGesture*>(ptr)->QPinchGesture::deleteLater();
+	} else if (dynamic_cast<QPanGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPanGesture*>(ptr)->QPanGesture::deleteLater();
+	} else {
+		static_cast<QGesture*>(ptr)->QGesture::deleteLater();
+	}
+}
+
+void QGesture_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QTapGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapGesture*>(ptr)->QTapGesture::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QTapAndHoldGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QSwipeGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPinchGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPinchGesture*>(ptr)->QPinchGesture::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QPanGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPanGesture*>(ptr)->QPanGesture::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGesture*>(ptr)->QGesture::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGesture_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QTapGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapGesture*>(ptr)->QTapGesture::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QTapAndHoldGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QSwipeGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QPinchGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPinchGesture*>(ptr)->QPinchGesture::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QPanGesture*>(static_cast<QObject*>(ptr))) {
+		static_cast<QPanGesture*>(ptr)->QPanGesture::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QGesture*>(ptr)->QGesture::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void* QGesture_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QTapGesture*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTapGesture*>(ptr)->QTapGesture::metaObject());
+	} else if (dynamic_cast<QTapAndHoldGesture*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QTapAndHoldGesture*>(ptr)->QTapAndHoldGesture::metaObject());
+	} else if (dynamic_cast<QSwipeGesture*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QSwipeGesture*>(ptr)->QSwipeGesture::metaObject());
+	} else if (dynamic_cast<QPinchGesture*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QPinchGesture*>(ptr)->QPinchGesture::metaObject());
+	} else if (dynamic_cast<QPanGesture*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QPanGesture*>(ptr)->QPanGesture::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QGesture*>(ptr)->QGesture::metaObject());
+	}
+}
+
+class MyQGestureEvent: public QGestureEvent
+{
+public:
+	MyQGestureEvent(const QList<QGesture *> &gestures) : QGestureEvent(gestures) {};
+};
+
+void* QGestureEvent_NewQGestureEvent(void* gestures)
+{
+	return new MyQGestureEvent(*static_cast<QList<QGesture *>*>(gestures));
+}
+
+void QGestureEvent_Accept(void* ptr, void* gesture)
+{
+	static_cast<QGestureEvent*>(ptr)->accept(static_cast<QGesture*>(gesture));
+}
+
+void QGestureEvent_Accept2(void* ptr, long long gestureType)
+{
+	static_cast<QGestureEvent*>(ptr)->accept(static_cast<Qt::GestureType>(gestureType));
+}
+
+void QGestureEvent_Ignore(void* ptr, void* gesture)
+{
+	static_cast<QGestureEvent*>(ptr)->ignore(static_cast<QGesture*>(gesture));
+}
+
+void QGestureEvent_Ignore2(void* ptr, long long gestureType)
+{
+	static_cast<QGestureEvent*>(ptr)->ignore(static_cast<Qt::GestureType>(gestureType));
+}
+
+void QGestureEvent_SetAccepted(void* ptr, void* gesture, char value)
+{
+	static_cast<QGestureEvent*>(ptr)->setAccepted(static_cast<QGesture*>(gesture), value != 0);
+}
+
+void QGestureEvent_SetAccepted2(void* ptr, long long gestureType, char value)
+{
+	static_cast<QGestureEvent*>(ptr)->setAccepted(static_cast<Qt::GestureType>(gestureType), value != 0);
+}
+
+void QGestureEvent_DestroyQGestureEvent(void* ptr)
+{
+	static_cast<QGestureEvent*>(ptr)->~QGestureEvent();
+}
+
+void* QGestureEvent_Gesture(void* ptr, long long ty)
+{
+	return static_cast<QGestureEvent*>(ptr)->gesture(static_cast<Qt::GestureType>(ty));
+}
+
+struct QtWidgets_PackedList QGestureEvent_ActiveGestures(void* ptr)
+{
+	return ({ QList<QGesture *>* tmpValue = new QList<QGesture *>(static_cast<QGestureEvent*>(ptr)->activeGestures()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGestureEvent_CanceledGestures(void* ptr)
+{
+	return ({ QList<QGesture *>* tmpValue = new QList<QGesture *>(static_cast<QGestureEvent*>(ptr)->canceledGestures()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGestureEvent_Gestures(void* ptr)
+{
+	return ({ QList<QGesture *>* tmpValue = new QList<QGesture *>(static_cast<QGestureEvent*>(ptr)->gestures()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QGestureEvent_MapToGraphicsScene(void* ptr, void* gesturePoint)
+{
+	return ({ QPointF tmpValue = static_cast<QGestureEvent*>(ptr)->mapToGraphicsScene(*static_cast<QPointF*>(gesturePoint)); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGestureEvent_Widget(void* ptr)
+{
+	return static_cast<QGestureEvent*>(ptr)->widget();
+}
+
+char QGestureEvent_IsAccepted(void* ptr, void* gesture)
+{
+	return static_cast<QGestureEvent*>(ptr)->isAccepted(static_cast<QGesture*>(gesture));
+}
+
+char QGestureEvent_IsAccepted2(void* ptr, long long gestureType)
+{
+	return static_cast<QGestureEvent*>(ptr)->isAccepted(static_cast<Qt::GestureType>(gestureType));
+}
+
+void* QGestureEvent___QGestureEvent_gestures_atList(void* ptr, int i)
+{
+	return const_cast<QGesture*>(static_cast<QList<QGesture *>*>(ptr)->at(i));
+}
+
+void QGestureEvent___QGestureEvent_gestures_setList(void* ptr, void* i)
+{
+	static_cast<QList<QGesture *>*>(ptr)->append(static_cast<QGesture*>(i));
+}
+
+void* QGestureEvent___QGestureEvent_gestures_newList(void* ptr)
+{
+	return new QList<QGesture *>;
+}
+
+void* QGestureEvent___activeGestures_atList(void* ptr, int i)
+{
+	return const_cast<QGesture*>(static_cast<QList<QGesture *>*>(ptr)->at(i));
+}
+
+void QGestureEvent___activeGestures_setList(void* ptr, void* i)
+{
+	static_cast<QList<QGesture *>*>(ptr)->append(static_cast<QGesture*>(i));
+}
+
+void* QGestureEvent___activeGestures_newList(void* ptr)
+{
+	return new QList<QGesture *>;
+}
+
+void* QGestureEvent___canceledGestures_atList(void* ptr, int i)
+{
+	return const_cast<QGesture*>(static_cast<QList<QGesture *>*>(ptr)->at(i));
+}
+
+void QGestureEvent___canceledGestures_setList(void* ptr, void* i)
+{
+	static_cast<QList<QGesture *>*>(ptr)->append(static_cast<QGesture*>(i));
+}
+
+void* QGestureEvent___canceledGestures_newList(void* ptr)
+{
+	return new QList<QGesture *>;
+}
+
+void* QGestureEvent___gestures_atList(void* ptr, int i)
+{
+	return const_cast<QGesture*>(static_cast<QList<QGesture *>*>(ptr)->at(i));
+}
+
+void QGestureEvent___gestures_setList(void* ptr, void* i)
+{
+	static_cast<QList<QGesture *>*>(ptr)->append(static_cast<QGesture*>(i));
+}
+
+void* QGestureEvent___gestures_newList(void* ptr)
+{
+	return new QList<QGesture *>;
+}
+
+class MyQGestureRecognizer: public QGestureRecognizer
+{
+public:
+	MyQGestureRecognizer() : QGestureRecognizer() {};
+	QGesture * create(QObject * target) { return static_cast<QGesture*>(callbackQGestureRecognizer_Create(this, target)); };
+	Result recognize(QGesture * gesture, QObject * watched, QEvent * event) { return static_cast<QGestureRecognizer::ResultFlag>(callbackQGestureRecognizer_Recognize(this, gesture, watched, event)); };
+	void reset(QGesture * gesture) { callbackQGestureRecognizer_Reset(this, gesture); };
+	 ~MyQGestureRecognizer() { callbackQGestureRecognizer_DestroyQGestureRecognizer(this); };
+};
+
+void* QGestureRecognizer_Create(void* ptr, void* target)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(target))) {
+		return static_cast<QGestureRecognizer*>(ptr)->create(static_cast<QGraphicsObject*>(target));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(target))) {
+		return static_cast<QGestureRecognizer*>(ptr)->create(static_cast<QGraphicsWidget*>(target));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(target))) {
+		return static_cast<QGestureRecognizer*>(ptr)->create(static_cast<QLayout*>(target));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(target))) {
+		return static_cast<QGestureRecognizer*>(ptr)->create(static_cast<QWidget*>(target));
+	} else {
+		return static_cast<QGestureRecognizer*>(ptr)->create(static_cast<QObject*>(target));
+	}
+}
+
+void* QGestureRecognizer_CreateDefault(void* ptr, void* target)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(target))) {
+		return static_cast<QGestureRecognizer*>(ptr)->QGestureRecognizer::create(static_cast<QGraphicsObject*>(target));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(target))) {
+		return static_cast<QGestureRecognizer*>(ptr)->QGestureRecognizer::create(static_cast<QGraphicsWidget*>(target));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(target))) {
+		return static_cast<QGestureRecognizer*>(ptr)->QGestureRecognizer::create(static_cast<QLayout*>(target));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(target))) {
+		return static_cast<QGestureRecognizer*>(ptr)->QGestureRecognizer::create(static_cast<QWidget*>(target));
+	} else {
+		return static_cast<QGestureRecognizer*>(ptr)->QGestureRecognizer::create(static_cast<QObject*>(target));
+	}
+}
+
+void* QGestureRecognizer_NewQGestureRecognizer()
+{
+	return new MyQGestureRecognizer();
+}
+
+long long QGestureRecognizer_QGestureRecognizer_RegisterRecognizer(void* recognizer)
+{
+	return QGestureRecognizer::registerRecognizer(static_cast<QGestureRecognizer*>(recognizer));
+}
+
+long long QGestureRecognizer_Recognize(void* ptr, void* gesture, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGestureRecognizer*>(ptr)->recognize(static_cast<QGesture*>(gesture), static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGestureRecognizer*>(ptr)->recognize(static_cast<QGesture*>(gesture), static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGestureRecognizer*>(ptr)->recognize(static_cast<QGesture*>(gesture), static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGestureRecognizer*>(ptr)->recognize(static_cast<QGesture*>(gesture), static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QGestureRecognizer*>(ptr)->recognize(static_cast<QGesture*>(gesture), static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QGestureRecognizer_Reset(void* ptr, void* gesture)
+{
+	static_cast<QGestureRecognizer*>(ptr)->reset(static_cast<QGesture*>(gesture));
+}
+
+void QGestureRecognizer_ResetDefault(void* ptr, void* gesture)
+{
+		static_cast<QGestureRecognizer*>(ptr)->QGestureRecognizer::reset(static_cast<QGesture*>(gesture));
+}
+
+void QGestureRecognizer_QGestureRecognizer_UnregisterRecognizer(long long ty)
+{
+	QGestureRecognizer::unregisterRecognizer(static_cast<Qt::GestureType>(ty));
+}
+
+void QGestureRecognizer_DestroyQGestureRecognizer(void* ptr)
+{
+	static_cast<QGestureRecognizer*>(ptr)->~QGestureRecognizer();
+}
+
+void QGestureRecognizer_DestroyQGestureRecognizerDefault(void* ptr)
+{
+
+}
+
+class MyQGraphicsAnchor: public QGraphicsAnchor
+{
+public:
+	bool event(QEvent * e) { return callbackQGraphicsAnchor_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsAnchor_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsAnchor_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsAnchor_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsAnchor_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsAnchor_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsAnchor_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsAnchor_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsAnchor_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsAnchor_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsAnchor_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QGraphicsAnchor_SetSizePolicy(void* ptr, long long policy)
+{
+	static_cast<QGraphicsAnchor*>(ptr)->setSizePolicy(static_cast<QSizePolicy::Policy>(policy));
+}
+
+void QGraphicsAnchor_SetSpacing(void* ptr, double spacing)
+{
+	static_cast<QGraphicsAnchor*>(ptr)->setSpacing(spacing);
+}
+
+void QGraphicsAnchor_UnsetSpacing(void* ptr)
+{
+	static_cast<QGraphicsAnchor*>(ptr)->unsetSpacing();
+}
+
+void QGraphicsAnchor_DestroyQGraphicsAnchor(void* ptr)
+{
+	static_cast<QGraphicsAnchor*>(ptr)->~QGraphicsAnchor();
+}
+
+long long QGraphicsAnchor_SizePolicy(void* ptr)
+{
+	return static_cast<QGraphicsAnchor*>(ptr)->sizePolicy();
+}
+
+double QGraphicsAnchor_Spacing(void* ptr)
+{
+	return static_cast<QGraphicsAnchor*>(ptr)->spacing();
+}
+
+void* QGraphicsAnchor___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QGraphicsAnchor___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QGraphicsAnchor___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QGraphicsAnchor___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsAnchor___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsAnchor___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsAnchor___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsAnchor___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsAnchor___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsAnchor___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsAnchor___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsAnchor___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsAnchor___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QGraphicsAnchor___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsAnchor___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QGraphicsAnchor_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::event(static_cast<QEvent*>(e));
+}
+
+char QGraphicsAnchor_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsAnchor_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QGraphicsAnchor_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QGraphicsAnchor_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::customEvent(static_cast<QEvent*>(event));
+}
+
+void QGraphicsAnchor_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::deleteLater();
+}
+
+void QGraphicsAnchor_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QGraphicsAnchor_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QGraphicsAnchor_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QGraphicsAnchor*>(ptr)->QGraphicsAnchor::metaObject());
+}
+
+class MyQGraphicsAnchorLayout: public QGraphicsAnchorLayout
+{
+public:
+	MyQGraphicsAnchorLayout(QGraphicsLayoutItem *parent) : QGraphicsAnchorLayout(parent) {};
+	void invalidate() { callbackQGraphicsLayout_Invalidate(this); };
+	void removeAt(int index) { callbackQGraphicsAnchorLayout_RemoveAt(this, index); };
+	void setGeometry(const QRectF & geom) { callbackQGraphicsLayoutItem_SetGeometry(this, const_cast<QRectF*>(&geom)); };
+	 ~MyQGraphicsAnchorLayout() { callbackQGraphicsAnchorLayout_DestroyQGraphicsAnchorLayout(this); };
+	QGraphicsLayoutItem * itemAt(int index) const { return static_cast<QGraphicsLayoutItem*>(callbackQGraphicsAnchorLayout_ItemAt(const_cast<void*>(static_cast<const void*>(this)), index)); };
+	QSizeF sizeHint(Qt::SizeHint which, const QSizeF & constraint) const { return *static_cast<QSizeF*>(callbackQGraphicsAnchorLayout_SizeHint(const_cast<void*>(static_cast<const void*>(this)), which, const_cast<QSizeF*>(&constraint))); };
+	int count() const { return callbackQGraphicsAnchorLayout_Count(const_cast<void*>(static_cast<const void*>(this))); };
+	void updateGeometry() { callbackQGraphicsLayoutItem_UpdateGeometry(this); };
+	void widgetEvent(QEvent * e) { callbackQGraphicsLayout_WidgetEvent(this, e); };
+	void getContentsMargins(qreal * left, qreal * top, qreal * right, qreal * bottom) const { callbackQGraphicsLayoutItem_GetContentsMargins(const_cast<void*>(static_cast<const void*>(this)), *left, *top, *right, *bottom); };
+};
+
+void* QGraphicsAnchorLayout_AddAnchor(void* ptr, void* firstItem, long long firstEdge, void* secondItem, long long secondEdge)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(firstItem))) {
+		return static_cast<QGraphicsAnchorLayout*>(ptr)->addAnchor(static_cast<QGraphicsWidget*>(firstItem), static_cast<Qt::AnchorPoint>(firstEdge), static_cast<QGraphicsLayoutItem*>(secondItem), static_cast<Qt::AnchorPoint>(secondEdge));
+	} else {
+		return static_cast<QGraphicsAnchorLayout*>(ptr)->addAnchor(static_cast<QGraphicsLayoutItem*>(firstItem), static_cast<Qt::AnchorPoint>(firstEdge), static_cast<QGraphicsLayoutItem*>(secondItem), static_cast<Qt::AnchorPoint>(secondEdge));
+	}
+}
+
+void* QGraphicsAnchorLayout_Anchor(void* ptr, void* firstItem, long long firstEdge, void* secondItem, long long secondEdge)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(firstItem))) {
+		return static_cast<QGraphicsAnchorLayout*>(ptr)->anchor(static_cast<QGraphicsWidget*>(firstItem), static_cast<Qt::AnchorPoint>(firstEdge), static_cast<QGraphicsLayoutItem*>(secondItem), static_cast<Qt::AnchorPoint>(secondEdge));
+	} else {
+		return static_cast<QGraphicsAnchorLayout*>(ptr)->anchor(static_cast<QGraphicsLayoutItem*>(firstItem), static_cast<Qt::AnchorPoint>(firstEdge), static_cast<QGraphicsLayoutItem*>(secondItem), static_cast<Qt::AnchorPoint>(secondEdge));
+	}
+}
+
+void* QGraphicsAnchorLayout_NewQGraphicsAnchorLayout(void* parent)
+{
+	return new MyQGraphicsAnchorLayout(static_cast<QGraphicsLayoutItem*>(parent));
+}
+
+void QGraphicsAnchorLayout_AddAnchors(void* ptr, void* firstItem, void* secondItem, long long orientations)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(firstItem))) {
+		static_cast<QGraphicsAnchorLayout*>(ptr)->addAnchors(static_cast<QGraphicsWidget*>(firstItem), static_cast<QGraphicsLayoutItem*>(secondItem), static_cast<Qt::Orientation>(orientations));
+	} else {
+		static_cast<QGraphicsAnchorLayout*>(ptr)->addAnchors(static_cast<QGraphicsLayoutItem*>(firstItem), static_cast<QGraphicsLayoutItem*>(secondItem), static_cast<Qt::Orientation>(orientations));
+	}
+}
+
+void QGraphicsAnchorLayout_AddCornerAnchors(void* ptr, void* firstItem, long long firstCorner, void* secondItem, long long secondCorner)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(firstItem))) {
+		static_cast<QGraphicsAnchorLayout*>(ptr)->addCornerAnchors(static_cast<QGraphicsWidget*>(firstItem), static_cast<Qt::Corner>(firstCorner), static_cast<QGraphicsLayoutItem*>(secondItem), static_cast<Qt::Corner>(secondCorner));
+	} else {
+		static_cast<QGraphicsAnchorLayout*>(ptr)->addCornerAnchors(static_cast<QGraphicsLayoutItem*>(firstItem), static_cast<Qt::Corner>(firstCorner), static_cast<QGraphicsLayoutItem*>(secondItem), static_cast<Qt::Corner>(secondCorner));
+	}
+}
+
+void QGraphicsAnchorLayout_RemoveAt(void* ptr, int index)
+{
+	static_cast<QGraphicsAnchorLayout*>(ptr)->removeAt(index);
+}
+
+void QGraphicsAnchorLayout_RemoveAtDefault(void* ptr, int index)
+{
+		static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::removeAt(index);
+}
+
+void QGraphicsAnchorLayout_SetHorizontalSpacing(void* ptr, double spacing)
+{
+	static_cast<QGraphicsAnchorLayout*>(ptr)->setHorizontalSpacing(spacing);
+}
+
+void QGraphicsAnchorLayout_SetSpacing(void* ptr, double spacing)
+{
+	static_cast<QGraphicsAnchorLayout*>(ptr)->setSpacing(spacing);
+}
+
+void QGraphicsAnchorLayout_SetVerticalSpacing(void* ptr, double spacing)
+{
+	static_cast<QGraphicsAnchorLayout*>(ptr)->setVerticalSpacing(spacing);
+}
+
+void QGraphicsAnchorLayout_DestroyQGraphicsAnchorLayout(void* ptr)
+{
+	static_cast<QGraphicsAnchorLayout*>(ptr)->~QGraphicsAnchorLayout();
+}
+
+void QGraphicsAnchorLayout_DestroyQGraphicsAnchorLayoutDefault(void* ptr)
+{
+
+}
+
+void* QGraphicsAnchorLayout_ItemAt(void* ptr, int index)
+{
+	return static_cast<QGraphicsAnchorLayout*>(ptr)->itemAt(index);
+}
+
+void* QGraphicsAnchorLayout_ItemAtDefault(void* ptr, int index)
+{
+		return static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::itemAt(index);
+}
+
+void* QGraphicsAnchorLayout_SizeHint(void* ptr, long long which, void* constraint)
+{
+	return ({ QSizeF tmpValue = static_cast<QGraphicsAnchorLayout*>(ptr)->sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsAnchorLayout_SizeHintDefault(void* ptr, long long which, void* constraint)
+{
+		return ({ QSizeF tmpValue = static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+int QGraphicsAnchorLayout_Count(void* ptr)
+{
+	return static_cast<QGraphicsAnchorLayout*>(ptr)->count();
+}
+
+int QGraphicsAnchorLayout_CountDefault(void* ptr)
+{
+		return static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::count();
+}
+
+double QGraphicsAnchorLayout_HorizontalSpacing(void* ptr)
+{
+	return static_cast<QGraphicsAnchorLayout*>(ptr)->horizontalSpacing();
+}
+
+double QGraphicsAnchorLayout_VerticalSpacing(void* ptr)
+{
+	return static_cast<QGraphicsAnchorLayout*>(ptr)->verticalSpacing();
+}
+
+class MyQGraphicsBlurEffect: public QGraphicsBlurEffect
+{
+public:
+	MyQGraphicsBlurEffect(QObject *parent) : QGraphicsBlurEffect(parent) {};
+	void Signal_BlurHintsChanged(QGraphicsBlurEffect::BlurHints hints) { callbackQGraphicsBlurEffect_BlurHintsChanged(this, hints); };
+	void Signal_BlurRadiusChanged(qreal radius) { callbackQGraphicsBlurEffect_BlurRadiusChanged(this, radius); };
+	void setBlurHints(QGraphicsBlurEffect::BlurHints hints) { callbackQGraphicsBlurEffect_SetBlurHints(this, hints); };
+	void setBlurRadius(qreal blurRadius) { callbackQGraphicsBlurEffect_SetBlurRadius(this, blurRadius); };
+	void draw(QPainter * painter) { callbackQGraphicsBlurEffect_Draw(this, painter); };
+	QRectF boundingRectFor(const QRectF & rect) const { return *static_cast<QRectF*>(callbackQGraphicsEffect_BoundingRectFor(const_cast<void*>(static_cast<const void*>(this)), const_cast<QRectF*>(&rect))); };
+	void Signal_EnabledChanged(bool enabled) { callbackQGraphicsEffect_EnabledChanged(this, enabled); };
+	void setEnabled(bool enable) { callbackQGraphicsEffect_SetEnabled(this, enable); };
+	void sourceChanged(QGraphicsEffect::ChangeFlags flags) { callbackQGraphicsEffect_SourceChanged(this, flags); };
+	void update() { callbackQGraphicsEffect_Update(this); };
+	bool event(QEvent * e) { return callbackQGraphicsEffect_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsEffect_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsEffect_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsEffect_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsEffect_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsEffect_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsEffect_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsEffect_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsEffect_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QGraphicsBlurEffect_ConnectBlurHintsChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsBlurEffect*>(ptr), static_cast<void (QGraphicsBlurEffect::*)(QGraphicsBlurEffect::BlurHints)>(&QGraphicsBlurEffect::blurHintsChanged), static_cast<MyQGraphicsBlurEffect*>(ptr), static_cast<void (MyQGraphicsBlurEffect::*)(QGraphicsBlurEffect::BlurHints)>(&MyQGraphicsBlurEffect::Signal_BlurHintsChanged));
+}
+
+void QGraphicsBlurEffect_DisconnectBlurHintsChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsBlurEffect*>(ptr), static_cast<void (QGraphicsBlurEffect::*)(QGraphicsBlurEffect::BlurHints)>(&QGraphicsBlurEffect::blurHintsChanged), static_cast<MyQGraphicsBlurEffect*>(ptr), static_cast<void (MyQGraphicsBlurEffect::*)(QGraphicsBlurEffect::BlurHints)>(&MyQGraphicsBlurEffect::Signal_BlurHintsChanged));
+}
+
+void QGraphicsBlurEffect_BlurHintsChanged(void* ptr, long long hints)
+{
+	static_cast<QGraphicsBlurEffect*>(ptr)->blurHintsChanged(static_cast<QGraphicsBlurEffect::BlurHint>(hints));
+}
+
+void QGraphicsBlurEffect_ConnectBlurRadiusChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsBlurEffect*>(ptr), static_cast<void (QGraphicsBlurEffect::*)(qreal)>(&QGraphicsBlurEffect::blurRadiusChanged), static_cast<MyQGraphicsBlurEffect*>(ptr), static_cast<void (MyQGraphicsBlurEffect::*)(qreal)>(&MyQGraphicsBlurEffect::Signal_BlurRadiusChanged));
+}
+
+void QGraphicsBlurEffect_DisconnectBlurRadiusChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsBlurEffect*>(ptr), static_cast<void (QGraphicsBlurEffect::*)(qreal)>(&QGraphicsBlurEffect::blurRadiusChanged), static_cast<MyQGraphicsBlurEffect*>(ptr), static_cast<void (MyQGraphicsBlurEffect::*)(qreal)>(&MyQGraphicsBlurEffect::Signal_BlurRadiusChanged));
+}
+
+void QGraphicsBlurEffect_BlurRadiusChanged(void* ptr, double radius)
+{
+	static_cast<QGraphicsBlurEffect*>(ptr)->blurRadiusChanged(radius);
+}
+
+void QGraphicsBlurEffect_SetBlurHints(void* ptr, long long hints)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsBlurEffect*>(ptr), "setBlurHints", Q_ARG(QGraphicsBlurEffect::BlurHint, static_cast<QGraphicsBlurEffect::BlurHint>(hints)));
+}
+
+void QGraphicsBlurEffect_SetBlurHintsDefault(void* ptr, long long hints)
+{
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::setBlurHints(static_cast<QGraphicsBlurEffect::BlurHint>(hints));
+}
+
+void QGraphicsBlurEffect_SetBlurRadius(void* ptr, double blurRadius)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsBlurEffect*>(ptr), "setBlurRadius", Q_ARG(qreal, blurRadius));
+}
+
+void QGraphicsBlurEffect_SetBlurRadiusDefault(void* ptr, double blurRadius)
+{
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::setBlurRadius(blurRadius);
+}
+
+long long QGraphicsBlurEffect_BlurHints(void* ptr)
+{
+	return static_cast<QGraphicsBlurEffect*>(ptr)->blurHints();
+}
+
+double QGraphicsBlurEffect_BlurRadius(void* ptr)
+{
+	return static_cast<QGraphicsBlurEffect*>(ptr)->blurRadius();
+}
+
+void* QGraphicsBlurEffect_NewQGraphicsBlurEffect(void* parent)
+{
+	return new MyQGraphicsBlurEffect(static_cast<QObject*>(parent));
+}
+
+void QGraphicsBlurEffect_Draw(void* ptr, void* painter)
+{
+	static_cast<QGraphicsBlurEffect*>(ptr)->draw(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsBlurEffect_DrawDefault(void* ptr, void* painter)
+{
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::draw(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsBlurEffect_DestroyQGraphicsBlurEffect(void* ptr)
+{
+	static_cast<QGraphicsBlurEffect*>(ptr)->~QGraphicsBlurEffect();
+}
+
+class MyQGraphicsColorizeEffect: public QGraphicsColorizeEffect
+{
+public:
+	MyQGraphicsColorizeEffect(QObject *parent) : QGraphicsColorizeEffect(parent) {};
+	void Signal_ColorChanged(const QColor & color) { callbackQGraphicsColorizeEffect_ColorChanged(this, const_cast<QColor*>(&color)); };
+	void draw(QPainter * painter) { callbackQGraphicsColorizeEffect_Draw(this, painter); };
+	void setColor(const QColor & c) { callbackQGraphicsColorizeEffect_SetColor(this, const_cast<QColor*>(&c)); };
+	void setStrength(qreal strength) { callbackQGraphicsColorizeEffect_SetStrength(this, strength); };
+	void Signal_StrengthChanged(qreal strength) { callbackQGraphicsColorizeEffect_StrengthChanged(this, strength); };
+	void Signal_EnabledChanged(bool enabled) { callbackQGraphicsEffect_EnabledChanged(this, enabled); };
+	void setEnabled(bool enable) { callbackQGraphicsEffect_SetEnabled(this, enable); };
+	void sourceChanged(QGraphicsEffect::ChangeFlags flags) { callbackQGraphicsEffect_SourceChanged(this, flags); };
+	void update() { callbackQGraphicsEffect_Update(this); };
+	QRectF boundingRectFor(const QRectF & rect) const { return *static_cast<QRectF*>(callbackQGraphicsEffect_BoundingRectFor(const_cast<void*>(static_cast<const void*>(this)), const_cast<QRectF*>(&rect))); };
+	bool event(QEvent * e) { return callbackQGraphicsEffect_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsEffect_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsEffect_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsEffect_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsEffect_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsEffect_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsEffect_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsEffect_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsEffect_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGraphicsColorizeEffect_NewQGraphicsColorizeEffect(void* parent)
+{
+	return new MyQGraphicsColorizeEffect(static_cast<QObject*>(parent));
+}
+
+void QGraphicsColorizeEffect_ConnectColorChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsColorizeEffect*>(ptr), static_cast<void (QGraphicsColorizeEffect::*)(const QColor &)>(&QGraphicsColorizeEffect::colorChanged), static_cast<MyQGraphicsColorizeEffect*>(ptr), static_cast<void (MyQGraphicsColorizeEffect::*)(const QColor &)>(&MyQGraphicsColorizeEffect::Signal_ColorChanged));
+}
+
+void QGraphicsColorizeEffect_DisconnectColorChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsColorizeEffect*>(ptr), static_cast<void (QGraphicsColorizeEffect::*)(const QColor &)>(&QGraphicsColorizeEffect::colorChanged), static_cast<MyQGraphicsColorizeEffect*>(ptr), static_cast<void (MyQGraphicsColorizeEffect::*)(const QColor &)>(&MyQGraphicsColorizeEffect::Signal_ColorChanged));
+}
+
+void QGraphicsColorizeEffect_ColorChanged(void* ptr, void* color)
+{
+	static_cast<QGraphicsColorizeEffect*>(ptr)->colorChanged(*static_cast<QColor*>(color));
+}
+
+void QGraphicsColorizeEffect_Draw(void* ptr, void* painter)
+{
+	static_cast<QGraphicsColorizeEffect*>(ptr)->draw(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsColorizeEffect_DrawDefault(void* ptr, void* painter)
+{
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::draw(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsColorizeEffect_SetColor(void* ptr, void* c)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsColorizeEffect*>(ptr), "setColor", Q_ARG(QColor, *static_cast<QColor*>(c)));
+}
+
+void QGraphicsColorizeEffect_SetColorDefault(void* ptr, void* c)
+{
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::setColor(*static_cast<QColor*>(c));
+}
+
+void QGraphicsColorizeEffect_SetStrength(void* ptr, double strength)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsColorizeEffect*>(ptr), "setStrength", Q_ARG(qreal, strength));
+}
+
+void QGraphicsColorizeEffect_SetStrengthDefault(void* ptr, double strength)
+{
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::setStrength(strength);
+}
+
+void QGraphicsColorizeEffect_ConnectStrengthChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsColorizeEffect*>(ptr), static_cast<void (QGraphicsColorizeEffect::*)(qreal)>(&QGraphicsColorizeEffect::strengthChanged), static_cast<MyQGraphicsColorizeEffect*>(ptr), static_cast<void (MyQGraphicsColorizeEffect::*)(qreal)>(&MyQGraphicsColorizeEffect::Signal_StrengthChanged));
+}
+
+void QGraphicsColorizeEffect_DisconnectStrengthChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsColorizeEffect*>(ptr), static_cast<void (QGraphicsColorizeEffect::*)(qreal)>(&QGraphicsColorizeEffect::strengthChanged), static_cast<MyQGraphicsColorizeEffect*>(ptr), static_cast<void (MyQGraphicsColorizeEffect::*)(qreal)>(&MyQGraphicsColorizeEffect::Signal_StrengthChanged));
+}
+
+void QGraphicsColorizeEffect_StrengthChanged(void* ptr, double strength)
+{
+	static_cast<QGraphicsColorizeEffect*>(ptr)->strengthChanged(strength);
+}
+
+void QGraphicsColorizeEffect_DestroyQGraphicsColorizeEffect(void* ptr)
+{
+	static_cast<QGraphicsColorizeEffect*>(ptr)->~QGraphicsColorizeEffect();
+}
+
+void* QGraphicsColorizeEffect_Color(void* ptr)
+{
+	return new QColor(static_cast<QGraphicsColorizeEffect*>(ptr)->color());
+}
+
+double QGraphicsColorizeEffect_Strength(void* ptr)
+{
+	return static_cast<QGraphicsColorizeEffect*>(ptr)->strength();
+}
+
+class MyQGraphicsDropShadowEffect: public QGraphicsDropShadowEffect
+{
+public:
+	MyQGraphicsDropShadowEffect(QObject *parent) : QGraphicsDropShadowEffect(parent) {};
+	void Signal_BlurRadiusChanged(qreal blurRadius) { callbackQGraphicsDropShadowEffect_BlurRadiusChanged(this, blurRadius); };
+	void Signal_ColorChanged(const QColor & color) { callbackQGraphicsDropShadowEffect_ColorChanged(this, const_cast<QColor*>(&color)); };
+	void draw(QPainter * painter) { callbackQGraphicsDropShadowEffect_Draw(this, painter); };
+	void Signal_OffsetChanged(const QPointF & offset) { callbackQGraphicsDropShadowEffect_OffsetChanged(this, const_cast<QPointF*>(&offset)); };
+	void setBlurRadius(qreal blurRadius) { callbackQGraphicsDropShadowEffect_SetBlurRadius(this, blurRadius); };
+	void setColor(const QColor & color) { callbackQGraphicsDropShadowEffect_SetColor(this, const_cast<QColor*>(&color)); };
+	void setOffset(const QPointF & ofs) { callbackQGraphicsDropShadowEffect_SetOffset(this, const_cast<QPointF*>(&ofs)); };
+	void setOffset(qreal d) { callbackQGraphicsDropShadowEffect_SetOffset2(this, d); };
+	void setOffset(qreal dx, qreal dy) { callbackQGraphicsDropShadowEffect_SetOffset3(this, dx, dy); };
+	void setXOffset(qreal dx) { callbackQGraphicsDropShadowEffect_SetXOffset(this, dx); };
+	void setYOffset(qreal dy) { callbackQGraphicsDropShadowEffect_SetYOffset(this, dy); };
+	QRectF boundingRectFor(const QRectF & rect) const { return *static_cast<QRectF*>(callbackQGraphicsEffect_BoundingRectFor(const_cast<void*>(static_cast<const void*>(this)), const_cast<QRectF*>(&rect))); };
+	void Signal_EnabledChanged(bool enabled) { callbackQGraphicsEffect_EnabledChanged(this, enabled); };
+	void setEnabled(bool enable) { callbackQGraphicsEffect_SetEnabled(this, enable); };
+	void sourceChanged(QGraphicsEffect::ChangeFlags flags) { callbackQGraphicsEffect_SourceChanged(this, flags); };
+	void update() { callbackQGraphicsEffect_Update(this); };
+	bool event(QEvent * e) { return callbackQGraphicsEffect_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsEffect_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsEffect_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsEffect_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsEffect_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsEffect_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsEffect_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsEffect_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsEffect_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGraphicsDropShadowEffect_NewQGraphicsDropShadowEffect(void* parent)
+{
+	return new MyQGraphicsDropShadowEffect(static_cast<QObject*>(parent));
+}
+
+void QGraphicsDropShadowEffect_ConnectBlurRadiusChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsDropShadowEffect*>(ptr), static_cast<void (QGraphicsDropShadowEffect::*)(qreal)>(&QGraphicsDropShadowEffect::blurRadiusChanged), static_cast<MyQGraphicsDropShadowEffect*>(ptr), static_cast<void (MyQGraphicsDropShadowEffect::*)(qreal)>(&MyQGraphicsDropShadowEffect::Signal_BlurRadiusChanged));
+}
+
+void QGraphicsDropShadowEffect_DisconnectBlurRadiusChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsDropShadowEffect*>(ptr), static_cast<void (QGraphicsDropShadowEffect::*)(qreal)>(&QGraphicsDropShadowEffect::blurRadiusChanged), static_cast<MyQGraphicsDropShadowEffect*>(ptr), static_cast<void (MyQGraphicsDropShadowEffect::*)(qreal)>(&MyQGraphicsDropShadowEffect::Signal_BlurRadiusChanged));
+}
+
+void QGraphicsDropShadowEffect_BlurRadiusChanged(void* ptr, double blurRadius)
+{
+	static_cast<QGraphicsDropShadowEffect*>(ptr)->blurRadiusChanged(blurRadius);
+}
+
+void QGraphicsDropShadowEffect_ConnectColorChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsDropShadowEffect*>(ptr), static_cast<void (QGraphicsDropShadowEffect::*)(const QColor &)>(&QGraphicsDropShadowEffect::colorChanged), static_cast<MyQGraphicsDropShadowEffect*>(ptr), static_cast<void (MyQGraphicsDropShadowEffect::*)(const QColor &)>(&MyQGraphicsDropShadowEffect::Signal_ColorChanged));
+}
+
+void QGraphicsDropShadowEffect_DisconnectColorChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsDropShadowEffect*>(ptr), static_cast<void (QGraphicsDropShadowEffect::*)(const QColor &)>(&QGraphicsDropShadowEffect::colorChanged), static_cast<MyQGraphicsDropShadowEffect*>(ptr), static_cast<void (MyQGraphicsDropShadowEffect::*)(const QColor &)>(&MyQGraphicsDropShadowEffect::Signal_ColorChanged));
+}
+
+void QGraphicsDropShadowEffect_ColorChanged(void* ptr, void* color)
+{
+	static_cast<QGraphicsDropShadowEffect*>(ptr)->colorChanged(*static_cast<QColor*>(color));
+}
+
+void QGraphicsDropShadowEffect_Draw(void* ptr, void* painter)
+{
+	static_cast<QGraphicsDropShadowEffect*>(ptr)->draw(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsDropShadowEffect_DrawDefault(void* ptr, void* painter)
+{
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::draw(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsDropShadowEffect_ConnectOffsetChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsDropShadowEffect*>(ptr), static_cast<void (QGraphicsDropShadowEffect::*)(const QPointF &)>(&QGraphicsDropShadowEffect::offsetChanged), static_cast<MyQGraphicsDropShadowEffect*>(ptr), static_cast<void (MyQGraphicsDropShadowEffect::*)(const QPointF &)>(&MyQGraphicsDropShadowEffect::Signal_OffsetChanged));
+}
+
+void QGraphicsDropShadowEffect_DisconnectOffsetChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsDropShadowEffect*>(ptr), static_cast<void (QGraphicsDropShadowEffect::*)(const QPointF &)>(&QGraphicsDropShadowEffect::offsetChanged), static_cast<MyQGraphicsDropShadowEffect*>(ptr), static_cast<void (MyQGraphicsDropShadowEffect::*)(const QPointF &)>(&MyQGraphicsDropShadowEffect::Signal_OffsetChanged));
+}
+
+void QGraphicsDropShadowEffect_OffsetChanged(void* ptr, void* offset)
+{
+	static_cast<QGraphicsDropShadowEffect*>(ptr)->offsetChanged(*static_cast<QPointF*>(offset));
+}
+
+void QGraphicsDropShadowEffect_SetBlurRadius(void* ptr, double blurRadius)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsDropShadowEffect*>(ptr), "setBlurRadius", Q_ARG(qreal, blurRadius));
+}
+
+void QGraphicsDropShadowEffect_SetBlurRadiusDefault(void* ptr, double blurRadius)
+{
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::setBlurRadius(blurRadius);
+}
+
+void QGraphicsDropShadowEffect_SetColor(void* ptr, void* color)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsDropShadowEffect*>(ptr), "setColor", Q_ARG(QColor, *static_cast<QColor*>(color)));
+}
+
+void QGraphicsDropShadowEffect_SetColorDefault(void* ptr, void* color)
+{
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::setColor(*static_cast<QColor*>(color));
+}
+
+void QGraphicsDropShadowEffect_SetOffset(void* ptr, void* ofs)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsDropShadowEffect*>(ptr), "setOffset", Q_ARG(QPointF, *static_cast<QPointF*>(ofs)));
+}
+
+void QGraphicsDropShadowEffect_SetOffsetDefault(void* ptr, void* ofs)
+{
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::setOffset(*static_cast<QPointF*>(ofs));
+}
+
+void QGraphicsDropShadowEffect_SetOffset2(void* ptr, double d)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsDropShadowEffect*>(ptr), "setOffset", Q_ARG(qreal, d));
+}
+
+void QGraphicsDropShadowEffect_SetOffset2Default(void* ptr, double d)
+{
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::setOffset(d);
+}
+
+void QGraphicsDropShadowEffect_SetOffset3(void* ptr, double dx, double dy)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsDropShadowEffect*>(ptr), "setOffset", Q_ARG(qreal, dx), Q_ARG(qreal, dy));
+}
+
+void QGraphicsDropShadowEffect_SetOffset3Default(void* ptr, double dx, double dy)
+{
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::setOffset(dx, dy);
+}
+
+void QGraphicsDropShadowEffect_SetXOffset(void* ptr, double dx)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsDropShadowEffect*>(ptr), "setXOffset", Q_ARG(qreal, dx));
+}
+
+void QGraphicsDropShadowEffect_SetXOffsetDefault(void* ptr, double dx)
+{
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::setXOffset(dx);
+}
+
+void QGraphicsDropShadowEffect_SetYOffset(void* ptr, double dy)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsDropShadowEffect*>(ptr), "setYOffset", Q_ARG(qreal, dy));
+}
+
+void QGraphicsDropShadowEffect_SetYOffsetDefault(void* ptr, double dy)
+{
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::setYOffset(dy);
+}
+
+void QGraphicsDropShadowEffect_DestroyQGraphicsDropShadowEffect(void* ptr)
+{
+	static_cast<QGraphicsDropShadowEffect*>(ptr)->~QGraphicsDropShadowEffect();
+}
+
+void* QGraphicsDropShadowEffect_Color(void* ptr)
+{
+	return new QColor(static_cast<QGraphicsDropShadowEffect*>(ptr)->color());
+}
+
+void* QGraphicsDropShadowEffect_Offset(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsDropShadowEffect*>(ptr)->offset(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+double QGraphicsDropShadowEffect_BlurRadius(void* ptr)
+{
+	return static_cast<QGraphicsDropShadowEffect*>(ptr)->blurRadius();
+}
+
+double QGraphicsDropShadowEffect_XOffset(void* ptr)
+{
+	return static_cast<QGraphicsDropShadowEffect*>(ptr)->xOffset();
+}
+
+double QGraphicsDropShadowEffect_YOffset(void* ptr)
+{
+	return static_cast<QGraphicsDropShadowEffect*>(ptr)->yOffset();
+}
+
+class MyQGraphicsEffect: public QGraphicsEffect
+{
+public:
+	MyQGraphicsEffect(QObject *parent) : QGraphicsEffect(parent) {};
+	void Signal_EnabledChanged(bool enabled) { callbackQGraphicsEffect_EnabledChanged(this, enabled); };
+	void setEnabled(bool enable) { callbackQGraphicsEffect_SetEnabled(this, enable); };
+	void draw(QPainter * painter) { callbackQGraphicsEffect_Draw(this, painter); };
+	void sourceChanged(QGraphicsEffect::ChangeFlags flags) { callbackQGraphicsEffect_SourceChanged(this, flags); };
+	void update() { callbackQGraphicsEffect_Update(this); };
+	 ~MyQGraphicsEffect() { callbackQGraphicsEffect_DestroyQGraphicsEffect(this); };
+	QRectF boundingRectFor(const QRectF & rect) const { return *static_cast<QRectF*>(callbackQGraphicsEffect_BoundingRectFor(const_cast<void*>(static_cast<const void*>(this)), const_cast<QRectF*>(&rect))); };
+	bool event(QEvent * e) { return callbackQGraphicsEffect_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsEffect_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsEffect_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsEffect_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsEffect_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsEffect_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsEffect_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsEffect_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsEffect_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QGraphicsEffect_ConnectEnabledChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsEffect*>(ptr), static_cast<void (QGraphicsEffect::*)(bool)>(&QGraphicsEffect::enabledChanged), static_cast<MyQGraphicsEffect*>(ptr), static_cast<void (MyQGraphicsEffect::*)(bool)>(&MyQGraphicsEffect::Signal_EnabledChanged));
+}
+
+void QGraphicsEffect_DisconnectEnabledChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsEffect*>(ptr), static_cast<void (QGraphicsEffect::*)(bool)>(&QGraphicsEffect::enabledChanged), static_cast<MyQGraphicsEffect*>(ptr), static_cast<void (MyQGraphicsEffect::*)(bool)>(&MyQGraphicsEffect::Signal_EnabledChanged));
+}
+
+void QGraphicsEffect_EnabledChanged(void* ptr, char enabled)
+{
+	static_cast<QGraphicsEffect*>(ptr)->enabledChanged(enabled != 0);
+}
+
+void QGraphicsEffect_SetEnabled(void* ptr, char enable)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsEffect*>(ptr), "setEnabled", Q_ARG(bool, enable != 0));
+}
+
+void QGraphicsEffect_SetEnabledDefault(void* ptr, char enable)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::setEnabled(enable != 0);
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::setEnabled(enable != 0);
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::setEnabled(enable != 0);
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::setEnabled(enable != 0);
+	} else {
+		static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::setEnabled(enable != 0);
+	}
+}
+
+void* QGraphicsEffect_NewQGraphicsEffect(void* parent)
+{
+	return new MyQGraphicsEffect(static_cast<QObject*>(parent));
+}
+
+void QGraphicsEffect_Draw(void* ptr, void* painter)
+{
+	static_cast<QGraphicsEffect*>(ptr)->draw(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsEffect_DrawSource(void* ptr, void* painter)
+{
+	static_cast<QGraphicsEffect*>(ptr)->drawSource(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsEffect_SourceChanged(void* ptr, long long flags)
+{
+	static_cast<QGraphicsEffect*>(ptr)->sourceChanged(static_cast<QGraphicsEffect::ChangeFlag>(flags));
+}
+
+void QGraphicsEffect_SourceChangedDefault(void* ptr, long long flags)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::sourceChanged(static_cast<QGraphicsEffect::ChangeFlag>(flags));
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::sourceChanged(static_cast<QGraphicsEffect::ChangeFlag>(flags));
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::sourceChanged(static_cast<QGraphicsEffect::ChangeFlag>(flags));
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::sourceChanged(static_cast<QGraphicsEffect::ChangeFlag>(flags));
+	} else {
+		static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::sourceChanged(static_cast<QGraphicsEffect::ChangeFlag>(flags));
+	}
+}
+
+void QGraphicsEffect_Update(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsEffect*>(ptr), "update");
+}
+
+void QGraphicsEffect_UpdateDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::update();
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::update();
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::update();
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::update();
+	} else {
+		static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::update();
+	}
+}
+
+void QGraphicsEffect_UpdateBoundingRect(void* ptr)
+{
+	static_cast<QGraphicsEffect*>(ptr)->updateBoundingRect();
+}
+
+void QGraphicsEffect_DestroyQGraphicsEffect(void* ptr)
+{
+	static_cast<QGraphicsEffect*>(ptr)->~QGraphicsEffect();
+}
+
+void QGraphicsEffect_DestroyQGraphicsEffectDefault(void* ptr)
+{
+
+}
+
+void* QGraphicsEffect_SourcePixmap(void* ptr, long long system, void* offset, long long mode)
+{
+	return new QPixmap(static_cast<QGraphicsEffect*>(ptr)->sourcePixmap(static_cast<Qt::CoordinateSystem>(system), static_cast<QPoint*>(offset), static_cast<QGraphicsEffect::PixmapPadMode>(mode)));
+}
+
+void* QGraphicsEffect_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsEffect*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsEffect_BoundingRectFor(void* ptr, void* rect)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsEffect*>(ptr)->boundingRectFor(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsEffect_BoundingRectForDefault(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::boundingRectFor(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::boundingRectFor(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::boundingRectFor(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::boundingRectFor(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::boundingRectFor(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsEffect_SourceBoundingRect(void* ptr, long long system)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsEffect*>(ptr)->sourceBoundingRect(static_cast<Qt::CoordinateSystem>(system)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+char QGraphicsEffect_IsEnabled(void* ptr)
+{
+	return static_cast<QGraphicsEffect*>(ptr)->isEnabled();
+}
+
+char QGraphicsEffect_SourceIsPixmap(void* ptr)
+{
+	return static_cast<QGraphicsEffect*>(ptr)->sourceIsPixmap();
+}
+
+void* QGraphicsEffect___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QGraphicsEffect___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QGraphicsEffect___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QGraphicsEffect___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsEffect___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsEffect___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsEffect___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsEffect___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsEffect___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsEffect___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsEffect___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsEffect___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsEffect___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QGraphicsEffect___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsEffect___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QGraphicsEffect_EventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::event(static_cast<QEvent*>(e));
+	} else {
+		return static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::event(static_cast<QEvent*>(e));
+	}
+}
+
+char QGraphicsEffect_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QGraphicsEffect_ChildEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QGraphicsEffect_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGraphicsEffect_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsEffect_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::deleteLater();
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::deleteLater();
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::deleteLater();
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::deleteLater();
+	} else {
+		static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::deleteLater();
+	}
+}
+
+void QGraphicsEffect_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGraphicsEffect_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void* QGraphicsEffect_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsOpacityEffect*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::metaObject());
+	} else if (dynamic_cast<QGraphicsDropShadowEffect*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsDropShadowEffect*>(ptr)->QGraphicsDropShadowEffect::metaObject());
+	} else if (dynamic_cast<QGraphicsColorizeEffect*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsColorizeEffect*>(ptr)->QGraphicsColorizeEffect::metaObject());
+	} else if (dynamic_cast<QGraphicsBlurEffect*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsBlurEffect*>(ptr)->QGraphicsBlurEffect::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsEffect*>(ptr)->QGraphicsEffect::metaObject());
+	}
+}
+
+class MyQGraphicsEllipseItem: public QGraphicsEllipseItem
+{
+public:
+	MyQGraphicsEllipseItem(QGraphicsItem *parent) : QGraphicsEllipseItem(parent) {};
+	MyQGraphicsEllipseItem(const QRectF &rect, QGraphicsItem *parent) : QGraphicsEllipseItem(rect, parent) {};
+	MyQGraphicsEllipseItem(qreal x, qreal y, qreal width, qreal height, QGraphicsItem *parent) : QGraphicsEllipseItem(x, y, width, height, parent) {};
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsEllipseItem_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsEllipseItem_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+};
+
+void* QGraphicsEllipseItem_NewQGraphicsEllipseItem(void* parent)
+{
+	return new MyQGraphicsEllipseItem(static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsEllipseItem_NewQGraphicsEllipseItem2(void* rect, void* parent)
+{
+	return new MyQGraphicsEllipseItem(*static_cast<QRectF*>(rect), static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsEllipseItem_NewQGraphicsEllipseItem3(double x, double y, double width, double height, void* parent)
+{
+	return new MyQGraphicsEllipseItem(x, y, width, height, static_cast<QGraphicsItem*>(parent));
+}
+
+void QGraphicsEllipseItem_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsEllipseItem*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsEllipseItem_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsEllipseItem_SetRect(void* ptr, void* rect)
+{
+	static_cast<QGraphicsEllipseItem*>(ptr)->setRect(*static_cast<QRectF*>(rect));
+}
+
+void QGraphicsEllipseItem_SetRect2(void* ptr, double x, double y, double width, double height)
+{
+	static_cast<QGraphicsEllipseItem*>(ptr)->setRect(x, y, width, height);
+}
+
+void QGraphicsEllipseItem_SetSpanAngle(void* ptr, int angle)
+{
+	static_cast<QGraphicsEllipseItem*>(ptr)->setSpanAngle(angle);
+}
+
+void QGraphicsEllipseItem_SetStartAngle(void* ptr, int angle)
+{
+	static_cast<QGraphicsEllipseItem*>(ptr)->setStartAngle(angle);
+}
+
+void QGraphicsEllipseItem_DestroyQGraphicsEllipseItem(void* ptr)
+{
+	static_cast<QGraphicsEllipseItem*>(ptr)->~QGraphicsEllipseItem();
+}
+
+void* QGraphicsEllipseItem_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsEllipseItem*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsEllipseItem_BoundingRectDefault(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsEllipseItem_Rect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsEllipseItem*>(ptr)->rect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+int QGraphicsEllipseItem_SpanAngle(void* ptr)
+{
+	return static_cast<QGraphicsEllipseItem*>(ptr)->spanAngle();
+}
+
+int QGraphicsEllipseItem_StartAngle(void* ptr)
+{
+	return static_cast<QGraphicsEllipseItem*>(ptr)->startAngle();
+}
+
+class MyQGraphicsGridLayout: public QGraphicsGridLayout
+{
+public:
+	MyQGraphicsGridLayout(QGraphicsLayoutItem *parent) : QGraphicsGridLayout(parent) {};
+	void invalidate() { callbackQGraphicsLayout_Invalidate(this); };
+	void removeAt(int index) { callbackQGraphicsGridLayout_RemoveAt(this, index); };
+	void setGeometry(const QRectF & rect) { callbackQGraphicsLayoutItem_SetGeometry(this, const_cast<QRectF*>(&rect)); };
+	 ~MyQGraphicsGridLayout() { callbackQGraphicsGridLayout_DestroyQGraphicsGridLayout(this); };
+	QSizeF sizeHint(Qt::SizeHint which, const QSizeF & constraint) const { return *static_cast<QSizeF*>(callbackQGraphicsGridLayout_SizeHint(const_cast<void*>(static_cast<const void*>(this)), which, const_cast<QSizeF*>(&constraint))); };
+	int count() const { return callbackQGraphicsGridLayout_Count(const_cast<void*>(static_cast<const void*>(this))); };
+	void updateGeometry() { callbackQGraphicsLayoutItem_UpdateGeometry(this); };
+	void widgetEvent(QEvent * e) { callbackQGraphicsLayout_WidgetEvent(this, e); };
+	
+	void getContentsMargins(qreal * left, qreal * top, qreal * right, qreal * bottom) const { callbackQGraphicsLayoutItem_GetContentsMargins(const_cast<void*>(static_cast<const void*>(this)), *left, *top, *right, *bottom); };
+};
+
+void* QGraphicsGridLayout_NewQGraphicsGridLayout(void* parent)
+{
+	return new MyQGraphicsGridLayout(static_cast<QGraphicsLayoutItem*>(parent));
+}
+
+void QGraphicsGridLayout_AddItem2(void* ptr, void* item, int row, int column, long long alignment)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsGridLayout*>(ptr)->addItem(static_cast<QGraphicsWidget*>(item), row, column, static_cast<Qt::AlignmentFlag>(alignment));
+	} else {
+		static_cast<QGraphicsGridLayout*>(ptr)->addItem(static_cast<QGraphicsLayoutItem*>(item), row, column, static_cast<Qt::AlignmentFlag>(alignment));
+	}
+}
+
+void QGraphicsGridLayout_AddItem(void* ptr, void* item, int row, int column, int rowSpan, int columnSpan, long long alignment)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsGridLayout*>(ptr)->addItem(static_cast<QGraphicsWidget*>(item), row, column, rowSpan, columnSpan, static_cast<Qt::AlignmentFlag>(alignment));
+	} else {
+		static_cast<QGraphicsGridLayout*>(ptr)->addItem(static_cast<QGraphicsLayoutItem*>(item), row, column, rowSpan, columnSpan, static_cast<Qt::AlignmentFlag>(alignment));
+	}
+}
+
+void QGraphicsGridLayout_RemoveAt(void* ptr, int index)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->removeAt(index);
+}
+
+void QGraphicsGridLayout_RemoveAtDefault(void* ptr, int index)
+{
+		static_cast<QGraphicsGridLayout*>(ptr)->QGraphicsGridLayout::removeAt(index);
+}
+
+void QGraphicsGridLayout_RemoveItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsGridLayout*>(ptr)->removeItem(static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsGridLayout*>(ptr)->removeItem(static_cast<QGraphicsLayoutItem*>(item));
+	}
+}
+
+void QGraphicsGridLayout_SetAlignment(void* ptr, void* item, long long alignment)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsGridLayout*>(ptr)->setAlignment(static_cast<QGraphicsWidget*>(item), static_cast<Qt::AlignmentFlag>(alignment));
+	} else {
+		static_cast<QGraphicsGridLayout*>(ptr)->setAlignment(static_cast<QGraphicsLayoutItem*>(item), static_cast<Qt::AlignmentFlag>(alignment));
+	}
+}
+
+void QGraphicsGridLayout_SetColumnAlignment(void* ptr, int column, long long alignment)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setColumnAlignment(column, static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QGraphicsGridLayout_SetColumnFixedWidth(void* ptr, int column, double width)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setColumnFixedWidth(column, width);
+}
+
+void QGraphicsGridLayout_SetColumnMaximumWidth(void* ptr, int column, double width)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setColumnMaximumWidth(column, width);
+}
+
+void QGraphicsGridLayout_SetColumnMinimumWidth(void* ptr, int column, double width)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setColumnMinimumWidth(column, width);
+}
+
+void QGraphicsGridLayout_SetColumnPreferredWidth(void* ptr, int column, double width)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setColumnPreferredWidth(column, width);
+}
+
+void QGraphicsGridLayout_SetColumnSpacing(void* ptr, int column, double spacing)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setColumnSpacing(column, spacing);
+}
+
+void QGraphicsGridLayout_SetColumnStretchFactor(void* ptr, int column, int stretch)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setColumnStretchFactor(column, stretch);
+}
+
+void QGraphicsGridLayout_SetHorizontalSpacing(void* ptr, double spacing)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setHorizontalSpacing(spacing);
+}
+
+void QGraphicsGridLayout_SetRowAlignment(void* ptr, int row, long long alignment)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setRowAlignment(row, static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QGraphicsGridLayout_SetRowFixedHeight(void* ptr, int row, double height)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setRowFixedHeight(row, height);
+}
+
+void QGraphicsGridLayout_SetRowMaximumHeight(void* ptr, int row, double height)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setRowMaximumHeight(row, height);
+}
+
+void QGraphicsGridLayout_SetRowMinimumHeight(void* ptr, int row, double height)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setRowMinimumHeight(row, height);
+}
+
+void QGraphicsGridLayout_SetRowPreferredHeight(void* ptr, int row, double height)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setRowPreferredHeight(row, height);
+}
+
+void QGraphicsGridLayout_SetRowSpacing(void* ptr, int row, double spacing)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setRowSpacing(row, spacing);
+}
+
+void QGraphicsGridLayout_SetRowStretchFactor(void* ptr, int row, int stretch)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setRowStretchFactor(row, stretch);
+}
+
+void QGraphicsGridLayout_SetSpacing(void* ptr, double spacing)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setSpacing(spacing);
+}
+
+void QGraphicsGridLayout_SetVerticalSpacing(void* ptr, double spacing)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->setVerticalSpacing(spacing);
+}
+
+void QGraphicsGridLayout_DestroyQGraphicsGridLayout(void* ptr)
+{
+	static_cast<QGraphicsGridLayout*>(ptr)->~QGraphicsGridLayout();
+}
+
+void QGraphicsGridLayout_DestroyQGraphicsGridLayoutDefault(void* ptr)
+{
+
+}
+
+void* QGraphicsGridLayout_SizeHint(void* ptr, long long which, void* constraint)
+{
+	return ({ QSizeF tmpValue = static_cast<QGraphicsGridLayout*>(ptr)->sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsGridLayout_SizeHintDefault(void* ptr, long long which, void* constraint)
+{
+		return ({ QSizeF tmpValue = static_cast<QGraphicsGridLayout*>(ptr)->QGraphicsGridLayout::sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+long long QGraphicsGridLayout_Alignment(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		return static_cast<QGraphicsGridLayout*>(ptr)->alignment(static_cast<QGraphicsWidget*>(item));
+	} else {
+		return static_cast<QGraphicsGridLayout*>(ptr)->alignment(static_cast<QGraphicsLayoutItem*>(item));
+	}
+}
+
+long long QGraphicsGridLayout_ColumnAlignment(void* ptr, int column)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->columnAlignment(column);
+}
+
+long long QGraphicsGridLayout_RowAlignment(void* ptr, int row)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->rowAlignment(row);
+}
+
+int QGraphicsGridLayout_ColumnCount(void* ptr)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->columnCount();
+}
+
+int QGraphicsGridLayout_ColumnStretchFactor(void* ptr, int column)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->columnStretchFactor(column);
+}
+
+int QGraphicsGridLayout_Count(void* ptr)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->count();
+}
+
+int QGraphicsGridLayout_CountDefault(void* ptr)
+{
+		return static_cast<QGraphicsGridLayout*>(ptr)->QGraphicsGridLayout::count();
+}
+
+int QGraphicsGridLayout_RowCount(void* ptr)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->rowCount();
+}
+
+int QGraphicsGridLayout_RowStretchFactor(void* ptr, int row)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->rowStretchFactor(row);
+}
+
+double QGraphicsGridLayout_ColumnMaximumWidth(void* ptr, int column)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->columnMaximumWidth(column);
+}
+
+double QGraphicsGridLayout_ColumnMinimumWidth(void* ptr, int column)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->columnMinimumWidth(column);
+}
+
+double QGraphicsGridLayout_ColumnPreferredWidth(void* ptr, int column)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->columnPreferredWidth(column);
+}
+
+double QGraphicsGridLayout_ColumnSpacing(void* ptr, int column)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->columnSpacing(column);
+}
+
+double QGraphicsGridLayout_HorizontalSpacing(void* ptr)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->horizontalSpacing();
+}
+
+double QGraphicsGridLayout_RowMaximumHeight(void* ptr, int row)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->rowMaximumHeight(row);
+}
+
+double QGraphicsGridLayout_RowMinimumHeight(void* ptr, int row)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->rowMinimumHeight(row);
+}
+
+double QGraphicsGridLayout_RowPreferredHeight(void* ptr, int row)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->rowPreferredHeight(row);
+}
+
+double QGraphicsGridLayout_RowSpacing(void* ptr, int row)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->rowSpacing(row);
+}
+
+double QGraphicsGridLayout_VerticalSpacing(void* ptr)
+{
+	return static_cast<QGraphicsGridLayout*>(ptr)->verticalSpacing();
+}
+
+
+
+
+
+class MyQGraphicsItem: public QGraphicsItem
+{
+public:
+	MyQGraphicsItem(QGraphicsItem *parent) : QGraphicsItem(parent) {};
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsItem_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	 ~MyQGraphicsItem() { callbackQGraphicsItem_DestroyQGraphicsItem(this); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsItem_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+};
+
+void* QGraphicsItem_NewQGraphicsItem(void* parent)
+{
+	return new MyQGraphicsItem(static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsItem_ToGraphicsObject(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->toGraphicsObject();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->toGraphicsObject();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->toGraphicsObject();
+	}
+}
+
+void* QGraphicsItem_ItemChange(void* ptr, long long change, void* value)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsObject*>(ptr)->itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsWidget*>(ptr)->itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else {
+		return new QVariant(static_cast<QGraphicsItem*>(ptr)->itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	}
+}
+
+void* QGraphicsItem_ItemChangeDefault(void* ptr, long long change, void* value)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	} else {
+		return new QVariant(static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::itemChange(static_cast<QGraphicsItem::GraphicsItemChange>(change), *static_cast<QVariant*>(value)));
+	}
+}
+
+char QGraphicsItem_SceneEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->sceneEvent(static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->sceneEvent(static_cast<QEvent*>(event));
+	}
+}
+
+char QGraphicsItem_SceneEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::sceneEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::sceneEvent(static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::sceneEvent(static_cast<QEvent*>(event));
+	}
+}
+
+char QGraphicsItem_SceneEventFilter(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsItem*>(ptr)->sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsItem*>(ptr)->sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsItem*>(ptr)->sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+char QGraphicsItem_SceneEventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::sceneEventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::sceneEventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::sceneEventFilter(static_cast<QGraphicsItem*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QGraphicsItem_Advance(void* ptr, int phase)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->advance(phase);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->advance(phase);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->advance(phase);
+	}
+}
+
+void QGraphicsItem_AdvanceDefault(void* ptr, int phase)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::advance(phase);
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::advance(phase);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::advance(phase);
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::advance(phase);
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::advance(phase);
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::advance(phase);
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::advance(phase);
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::advance(phase);
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::advance(phase);
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::advance(phase);
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::advance(phase);
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::advance(phase);
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::advance(phase);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::advance(phase);
+	}
+}
+
+void QGraphicsItem_ClearFocus(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->clearFocus();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->clearFocus();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->clearFocus();
+	}
+}
+
+void QGraphicsItem_ContextMenuEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	}
+}
+
+void QGraphicsItem_ContextMenuEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(event));
+	}
+}
+
+void QGraphicsItem_DragEnterEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	}
+}
+
+void QGraphicsItem_DragEnterEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	}
+}
+
+void QGraphicsItem_DragLeaveEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	}
+}
+
+void QGraphicsItem_DragLeaveEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	}
+}
+
+void QGraphicsItem_DragMoveEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	}
+}
+
+void QGraphicsItem_DragMoveEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	}
+}
+
+void QGraphicsItem_DropEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	}
+}
+
+void QGraphicsItem_DropEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+	}
+}
+
+void QGraphicsItem_EnsureVisible(void* ptr, void* rect, int xmargin, int ymargin)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->ensureVisible(*static_cast<QRectF*>(rect), xmargin, ymargin);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->ensureVisible(*static_cast<QRectF*>(rect), xmargin, ymargin);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->ensureVisible(*static_cast<QRectF*>(rect), xmargin, ymargin);
+	}
+}
+
+void QGraphicsItem_EnsureVisible2(void* ptr, double x, double y, double w, double h, int xmargin, int ymargin)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->ensureVisible(x, y, w, h, xmargin, ymargin);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->ensureVisible(x, y, w, h, xmargin, ymargin);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->ensureVisible(x, y, w, h, xmargin, ymargin);
+	}
+}
+
+void QGraphicsItem_FocusInEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->focusInEvent(static_cast<QFocusEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->focusInEvent(static_cast<QFocusEvent*>(event));
+	}
+}
+
+void QGraphicsItem_FocusInEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::focusInEvent(static_cast<QFocusEvent*>(event));
+	}
+}
+
+void QGraphicsItem_FocusOutEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->focusOutEvent(static_cast<QFocusEvent*>(event));
+	}
+}
+
+void QGraphicsItem_FocusOutEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::focusOutEvent(static_cast<QFocusEvent*>(event));
+	}
+}
+
+void QGraphicsItem_GrabKeyboard(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->grabKeyboard();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->grabKeyboard();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->grabKeyboard();
+	}
+}
+
+void QGraphicsItem_GrabMouse(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->grabMouse();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->grabMouse();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->grabMouse();
+	}
+}
+
+void QGraphicsItem_Hide(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->hide();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->hide();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->hide();
+	}
+}
+
+void QGraphicsItem_HoverEnterEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	}
+}
+
+void QGraphicsItem_HoverEnterEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::hoverEnterEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	}
+}
+
+void QGraphicsItem_HoverLeaveEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	}
+}
+
+void QGraphicsItem_HoverLeaveEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::hoverLeaveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	}
+}
+
+void QGraphicsItem_HoverMoveEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	}
+}
+
+void QGraphicsItem_HoverMoveEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::hoverMoveEvent(static_cast<QGraphicsSceneHoverEvent*>(event));
+	}
+}
+
+void QGraphicsItem_InputMethodEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	}
+}
+
+void QGraphicsItem_InputMethodEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+	}
+}
+
+void QGraphicsItem_InstallSceneEventFilter(void* ptr, void* filterItem)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsObject*>(ptr)->installSceneEventFilter(static_cast<QGraphicsObject*>(filterItem));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsObject*>(ptr)->installSceneEventFilter(static_cast<QGraphicsWidget*>(filterItem));
+		} else {
+			static_cast<QGraphicsObject*>(ptr)->installSceneEventFilter(static_cast<QGraphicsItem*>(filterItem));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsWidget*>(ptr)->installSceneEventFilter(static_cast<QGraphicsObject*>(filterItem));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsWidget*>(ptr)->installSceneEventFilter(static_cast<QGraphicsWidget*>(filterItem));
+		} else {
+			static_cast<QGraphicsWidget*>(ptr)->installSceneEventFilter(static_cast<QGraphicsItem*>(filterItem));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsItem*>(ptr)->installSceneEventFilter(static_cast<QGraphicsObject*>(filterItem));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsItem*>(ptr)->installSceneEventFilter(static_cast<QGraphicsWidget*>(filterItem));
+		} else {
+			static_cast<QGraphicsItem*>(ptr)->installSceneEventFilter(static_cast<QGraphicsItem*>(filterItem));
+		}
+	}
+}
+
+void QGraphicsItem_KeyPressEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->keyPressEvent(static_cast<QKeyEvent*>(event));
+	}
+}
+
+void QGraphicsItem_KeyPressEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::keyPressEvent(static_cast<QKeyEvent*>(event));
+	}
+}
+
+void QGraphicsItem_KeyReleaseEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	}
+}
+
+void QGraphicsItem_KeyReleaseEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::keyReleaseEvent(static_cast<QKeyEvent*>(event));
+	}
+}
+
+void QGraphicsItem_MouseDoubleClickEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	}
+}
+
+void QGraphicsItem_MouseDoubleClickEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	}
+}
+
+void QGraphicsItem_MouseMoveEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	}
+}
+
+void QGraphicsItem_MouseMoveEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	}
+}
+
+void QGraphicsItem_MousePressEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	}
+}
+
+void QGraphicsItem_MousePressEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	}
+}
+
+void QGraphicsItem_MouseReleaseEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	}
+}
+
+void QGraphicsItem_MouseReleaseEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(event));
+	}
+}
+
+void QGraphicsItem_MoveBy(void* ptr, double dx, double dy)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->moveBy(dx, dy);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->moveBy(dx, dy);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->moveBy(dx, dy);
+	}
+}
+
+void QGraphicsItem_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	}
+}
+
+void QGraphicsItem_PrepareGeometryChange(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->prepareGeometryChange();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->prepareGeometryChange();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->prepareGeometryChange();
+	}
+}
+
+void QGraphicsItem_RemoveSceneEventFilter(void* ptr, void* filterItem)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsObject*>(ptr)->removeSceneEventFilter(static_cast<QGraphicsObject*>(filterItem));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsObject*>(ptr)->removeSceneEventFilter(static_cast<QGraphicsWidget*>(filterItem));
+		} else {
+			static_cast<QGraphicsObject*>(ptr)->removeSceneEventFilter(static_cast<QGraphicsItem*>(filterItem));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsWidget*>(ptr)->removeSceneEventFilter(static_cast<QGraphicsObject*>(filterItem));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsWidget*>(ptr)->removeSceneEventFilter(static_cast<QGraphicsWidget*>(filterItem));
+		} else {
+			static_cast<QGraphicsWidget*>(ptr)->removeSceneEventFilter(static_cast<QGraphicsItem*>(filterItem));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsItem*>(ptr)->removeSceneEventFilter(static_cast<QGraphicsObject*>(filterItem));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(filterItem))) {
+			static_cast<QGraphicsItem*>(ptr)->removeSceneEventFilter(static_cast<QGraphicsWidget*>(filterItem));
+		} else {
+			static_cast<QGraphicsItem*>(ptr)->removeSceneEventFilter(static_cast<QGraphicsItem*>(filterItem));
+		}
+	}
+}
+
+void QGraphicsItem_ResetTransform(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->resetTransform();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->resetTransform();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->resetTransform();
+	}
+}
+
+void QGraphicsItem_Scroll(void* ptr, double dx, double dy, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->scroll(dx, dy, *static_cast<QRectF*>(rect));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->scroll(dx, dy, *static_cast<QRectF*>(rect));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->scroll(dx, dy, *static_cast<QRectF*>(rect));
+	}
+}
+
+void QGraphicsItem_SetAcceptDrops(void* ptr, char on)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setAcceptDrops(on != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setAcceptDrops(on != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setAcceptDrops(on != 0);
+	}
+}
+
+void QGraphicsItem_SetAcceptHoverEvents(void* ptr, char enabled)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setAcceptHoverEvents(enabled != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setAcceptHoverEvents(enabled != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setAcceptHoverEvents(enabled != 0);
+	}
+}
+
+void QGraphicsItem_SetAcceptTouchEvents(void* ptr, char enabled)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setAcceptTouchEvents(enabled != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setAcceptTouchEvents(enabled != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setAcceptTouchEvents(enabled != 0);
+	}
+}
+
+void QGraphicsItem_SetAcceptedMouseButtons(void* ptr, long long buttons)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setAcceptedMouseButtons(static_cast<Qt::MouseButton>(buttons));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setAcceptedMouseButtons(static_cast<Qt::MouseButton>(buttons));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setAcceptedMouseButtons(static_cast<Qt::MouseButton>(buttons));
+	}
+}
+
+void QGraphicsItem_SetActive(void* ptr, char active)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setActive(active != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setActive(active != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setActive(active != 0);
+	}
+}
+
+void QGraphicsItem_SetBoundingRegionGranularity(void* ptr, double granularity)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setBoundingRegionGranularity(granularity);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setBoundingRegionGranularity(granularity);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setBoundingRegionGranularity(granularity);
+	}
+}
+
+void QGraphicsItem_SetCacheMode(void* ptr, long long mode, void* logicalCacheSize)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setCacheMode(static_cast<QGraphicsItem::CacheMode>(mode), *static_cast<QSize*>(logicalCacheSize));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setCacheMode(static_cast<QGraphicsItem::CacheMode>(mode), *static_cast<QSize*>(logicalCacheSize));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setCacheMode(static_cast<QGraphicsItem::CacheMode>(mode), *static_cast<QSize*>(logicalCacheSize));
+	}
+}
+
+void QGraphicsItem_SetCursor(void* ptr, void* cursor)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setCursor(*static_cast<QCursor*>(cursor));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setCursor(*static_cast<QCursor*>(cursor));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setCursor(*static_cast<QCursor*>(cursor));
+	}
+}
+
+void QGraphicsItem_SetData(void* ptr, int key, void* value)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setData(key, *static_cast<QVariant*>(value));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setData(key, *static_cast<QVariant*>(value));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setData(key, *static_cast<QVariant*>(value));
+	}
+}
+
+void QGraphicsItem_SetEnabled(void* ptr, char enabled)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setEnabled(enabled != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setEnabled(enabled != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setEnabled(enabled != 0);
+	}
+}
+
+void QGraphicsItem_SetFiltersChildEvents(void* ptr, char enabled)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setFiltersChildEvents(enabled != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setFiltersChildEvents(enabled != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setFiltersChildEvents(enabled != 0);
+	}
+}
+
+void QGraphicsItem_SetFlag(void* ptr, long long flag, char enabled)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setFlag(static_cast<QGraphicsItem::GraphicsItemFlag>(flag), enabled != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setFlag(static_cast<QGraphicsItem::GraphicsItemFlag>(flag), enabled != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setFlag(static_cast<QGraphicsItem::GraphicsItemFlag>(flag), enabled != 0);
+	}
+}
+
+void QGraphicsItem_SetFlags(void* ptr, long long flags)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setFlags(static_cast<QGraphicsItem::GraphicsItemFlag>(flags));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setFlags(static_cast<QGraphicsItem::GraphicsItemFlag>(flags));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setFlags(static_cast<QGraphicsItem::GraphicsItemFlag>(flags));
+	}
+}
+
+void QGraphicsItem_SetFocus(void* ptr, long long focusReason)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setFocus(static_cast<Qt::FocusReason>(focusReason));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setFocus(static_cast<Qt::FocusReason>(focusReason));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setFocus(static_cast<Qt::FocusReason>(focusReason));
+	}
+}
+
+void QGraphicsItem_SetFocusProxy(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsObject*>(ptr)->setFocusProxy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsObject*>(ptr)->setFocusProxy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			static_cast<QGraphicsObject*>(ptr)->setFocusProxy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsWidget*>(ptr)->setFocusProxy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsWidget*>(ptr)->setFocusProxy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			static_cast<QGraphicsWidget*>(ptr)->setFocusProxy(static_cast<QGraphicsItem*>(item));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsItem*>(ptr)->setFocusProxy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsItem*>(ptr)->setFocusProxy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			static_cast<QGraphicsItem*>(ptr)->setFocusProxy(static_cast<QGraphicsItem*>(item));
+		}
+	}
+}
+
+void QGraphicsItem_SetGraphicsEffect(void* ptr, void* effect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setGraphicsEffect(static_cast<QGraphicsEffect*>(effect));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setGraphicsEffect(static_cast<QGraphicsEffect*>(effect));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setGraphicsEffect(static_cast<QGraphicsEffect*>(effect));
+	}
+}
+
+void QGraphicsItem_SetGroup(void* ptr, void* group)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setGroup(static_cast<QGraphicsItemGroup*>(group));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setGroup(static_cast<QGraphicsItemGroup*>(group));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setGroup(static_cast<QGraphicsItemGroup*>(group));
+	}
+}
+
+void QGraphicsItem_SetInputMethodHints(void* ptr, long long hints)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setInputMethodHints(static_cast<Qt::InputMethodHint>(hints));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setInputMethodHints(static_cast<Qt::InputMethodHint>(hints));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setInputMethodHints(static_cast<Qt::InputMethodHint>(hints));
+	}
+}
+
+void QGraphicsItem_SetOpacity(void* ptr, double opacity)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setOpacity(opacity);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setOpacity(opacity);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setOpacity(opacity);
+	}
+}
+
+void QGraphicsItem_SetPanelModality(void* ptr, long long panelModality)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setPanelModality(static_cast<QGraphicsItem::PanelModality>(panelModality));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setPanelModality(static_cast<QGraphicsItem::PanelModality>(panelModality));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setPanelModality(static_cast<QGraphicsItem::PanelModality>(panelModality));
+	}
+}
+
+void QGraphicsItem_SetParentItem(void* ptr, void* newParent)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(newParent))) {
+			static_cast<QGraphicsObject*>(ptr)->setParentItem(static_cast<QGraphicsObject*>(newParent));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(newParent))) {
+			static_cast<QGraphicsObject*>(ptr)->setParentItem(static_cast<QGraphicsWidget*>(newParent));
+		} else {
+			static_cast<QGraphicsObject*>(ptr)->setParentItem(static_cast<QGraphicsItem*>(newParent));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(newParent))) {
+			static_cast<QGraphicsWidget*>(ptr)->setParentItem(static_cast<QGraphicsObject*>(newParent));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(newParent))) {
+			static_cast<QGraphicsWidget*>(ptr)->setParentItem(static_cast<QGraphicsWidget*>(newParent));
+		} else {
+			static_cast<QGraphicsWidget*>(ptr)->setParentItem(static_cast<QGraphicsItem*>(newParent));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(newParent))) {
+			static_cast<QGraphicsItem*>(ptr)->setParentItem(static_cast<QGraphicsObject*>(newParent));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(newParent))) {
+			static_cast<QGraphicsItem*>(ptr)->setParentItem(static_cast<QGraphicsWidget*>(newParent));
+		} else {
+			static_cast<QGraphicsItem*>(ptr)->setParentItem(static_cast<QGraphicsItem*>(newParent));
+		}
+	}
+}
+
+void QGraphicsItem_SetPos(void* ptr, void* pos)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setPos(*static_cast<QPointF*>(pos));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setPos(*static_cast<QPointF*>(pos));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setPos(*static_cast<QPointF*>(pos));
+	}
+}
+
+void QGraphicsItem_SetPos2(void* ptr, double x, double y)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setPos(x, y);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setPos(x, y);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setPos(x, y);
+	}
+}
+
+void QGraphicsItem_SetRotation(void* ptr, double angle)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setRotation(angle);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setRotation(angle);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setRotation(angle);
+	}
+}
+
+void QGraphicsItem_SetScale(void* ptr, double factor)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setScale(factor);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setScale(factor);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setScale(factor);
+	}
+}
+
+void QGraphicsItem_SetSelected(void* ptr, char selected)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setSelected(selected != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setSelected(selected != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setSelected(selected != 0);
+	}
+}
+
+void QGraphicsItem_SetToolTip(void* ptr, char* toolTip)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setToolTip(QString(toolTip));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setToolTip(QString(toolTip));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setToolTip(QString(toolTip));
+	}
+}
+
+void QGraphicsItem_SetTransform(void* ptr, void* matrix, char combine)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setTransform(*static_cast<QTransform*>(matrix), combine != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setTransform(*static_cast<QTransform*>(matrix), combine != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setTransform(*static_cast<QTransform*>(matrix), combine != 0);
+	}
+}
+
+void QGraphicsItem_SetTransformOriginPoint(void* ptr, void* origin)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setTransformOriginPoint(*static_cast<QPointF*>(origin));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setTransformOriginPoint(*static_cast<QPointF*>(origin));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setTransformOriginPoint(*static_cast<QPointF*>(origin));
+	}
+}
+
+void QGraphicsItem_SetTransformOriginPoint2(void* ptr, double x, double y)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setTransformOriginPoint(x, y);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setTransformOriginPoint(x, y);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setTransformOriginPoint(x, y);
+	}
+}
+
+void QGraphicsItem_SetTransformations(void* ptr, void* transformations)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setTransformations(*static_cast<QList<QGraphicsTransform *>*>(transformations));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setTransformations(*static_cast<QList<QGraphicsTransform *>*>(transformations));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setTransformations(*static_cast<QList<QGraphicsTransform *>*>(transformations));
+	}
+}
+
+void QGraphicsItem_SetVisible(void* ptr, char visible)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setVisible(visible != 0);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setVisible(visible != 0);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setVisible(visible != 0);
+	}
+}
+
+void QGraphicsItem_SetX(void* ptr, double x)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setX(x);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setX(x);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setX(x);
+	}
+}
+
+void QGraphicsItem_SetY(void* ptr, double y)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setY(y);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setY(y);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setY(y);
+	}
+}
+
+void QGraphicsItem_SetZValue(void* ptr, double z)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->setZValue(z);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setZValue(z);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->setZValue(z);
+	}
+}
+
+void QGraphicsItem_Show(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->show();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->show();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->show();
+	}
+}
+
+void QGraphicsItem_StackBefore(void* ptr, void* sibling)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(sibling))) {
+			static_cast<QGraphicsObject*>(ptr)->stackBefore(static_cast<QGraphicsObject*>(sibling));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(sibling))) {
+			static_cast<QGraphicsObject*>(ptr)->stackBefore(static_cast<QGraphicsWidget*>(sibling));
+		} else {
+			static_cast<QGraphicsObject*>(ptr)->stackBefore(static_cast<QGraphicsItem*>(sibling));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(sibling))) {
+			static_cast<QGraphicsWidget*>(ptr)->stackBefore(static_cast<QGraphicsObject*>(sibling));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(sibling))) {
+			static_cast<QGraphicsWidget*>(ptr)->stackBefore(static_cast<QGraphicsWidget*>(sibling));
+		} else {
+			static_cast<QGraphicsWidget*>(ptr)->stackBefore(static_cast<QGraphicsItem*>(sibling));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(sibling))) {
+			static_cast<QGraphicsItem*>(ptr)->stackBefore(static_cast<QGraphicsObject*>(sibling));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(sibling))) {
+			static_cast<QGraphicsItem*>(ptr)->stackBefore(static_cast<QGraphicsWidget*>(sibling));
+		} else {
+			static_cast<QGraphicsItem*>(ptr)->stackBefore(static_cast<QGraphicsItem*>(sibling));
+		}
+	}
+}
+
+void QGraphicsItem_UngrabKeyboard(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->ungrabKeyboard();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->ungrabKeyboard();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->ungrabKeyboard();
+	}
+}
+
+void QGraphicsItem_UngrabMouse(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->ungrabMouse();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->ungrabMouse();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->ungrabMouse();
+	}
+}
+
+void QGraphicsItem_UnsetCursor(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->unsetCursor();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->unsetCursor();
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->unsetCursor();
+	}
+}
+
+void QGraphicsItem_Update(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->update(*static_cast<QRectF*>(rect));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->update(*static_cast<QRectF*>(rect));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->update(*static_cast<QRectF*>(rect));
+	}
+}
+
+void QGraphicsItem_Update2(void* ptr, double x, double y, double width, double height)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->update(x, y, width, height);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->update(x, y, width, height);
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->update(x, y, width, height);
+	}
+}
+
+void QGraphicsItem_WheelEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	}
+}
+
+void QGraphicsItem_WheelEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	} else {
+		static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(event));
+	}
+}
+
+void QGraphicsItem_DestroyQGraphicsItem(void* ptr)
+{
+	static_cast<QGraphicsItem*>(ptr)->~QGraphicsItem();
+}
+
+void QGraphicsItem_DestroyQGraphicsItemDefault(void* ptr)
+{
+
+}
+
+long long QGraphicsItem_CacheMode(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->cacheMode();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->cacheMode();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->cacheMode();
+	}
+}
+
+long long QGraphicsItem_Flags(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->flags();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->flags();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->flags();
+	}
+}
+
+long long QGraphicsItem_PanelModality(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->panelModality();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->panelModality();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->panelModality();
+	}
+}
+
+void* QGraphicsItem_Cursor(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QCursor(static_cast<QGraphicsObject*>(ptr)->cursor());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QCursor(static_cast<QGraphicsWidget*>(ptr)->cursor());
+	} else {
+		return new QCursor(static_cast<QGraphicsItem*>(ptr)->cursor());
+	}
+}
+
+void* QGraphicsItem_GraphicsEffect(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->graphicsEffect();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->graphicsEffect();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->graphicsEffect();
+	}
+}
+
+void* QGraphicsItem_CommonAncestorItem(void* ptr, void* other)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsObject*>(ptr)->commonAncestorItem(static_cast<QGraphicsObject*>(other));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsObject*>(ptr)->commonAncestorItem(static_cast<QGraphicsWidget*>(other));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->commonAncestorItem(static_cast<QGraphicsItem*>(other));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsWidget*>(ptr)->commonAncestorItem(static_cast<QGraphicsObject*>(other));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsWidget*>(ptr)->commonAncestorItem(static_cast<QGraphicsWidget*>(other));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->commonAncestorItem(static_cast<QGraphicsItem*>(other));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsItem*>(ptr)->commonAncestorItem(static_cast<QGraphicsObject*>(other));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsItem*>(ptr)->commonAncestorItem(static_cast<QGraphicsWidget*>(other));
+		} else {
+			return static_cast<QGraphicsItem*>(ptr)->commonAncestorItem(static_cast<QGraphicsItem*>(other));
+		}
+	}
+}
+
+void* QGraphicsItem_FocusItem(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->focusItem();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->focusItem();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->focusItem();
+	}
+}
+
+void* QGraphicsItem_FocusProxy(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->focusProxy();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->focusProxy();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->focusProxy();
+	}
+}
+
+void* QGraphicsItem_Panel(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->panel();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->panel();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->panel();
+	}
+}
+
+void* QGraphicsItem_ParentItem(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->parentItem();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->parentItem();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->parentItem();
+	}
+}
+
+void* QGraphicsItem_TopLevelItem(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->topLevelItem();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->topLevelItem();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->topLevelItem();
+	}
+}
+
+void* QGraphicsItem_Group(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->group();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->group();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->group();
+	}
+}
+
+void* QGraphicsItem_ParentObject(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->parentObject();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->parentObject();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->parentObject();
+	}
+}
+
+void* QGraphicsItem_Scene(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->scene();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->scene();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->scene();
+	}
+}
+
+void* QGraphicsItem_ParentWidget(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->parentWidget();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->parentWidget();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->parentWidget();
+	}
+}
+
+void* QGraphicsItem_TopLevelWidget(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->topLevelWidget();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->topLevelWidget();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->topLevelWidget();
+	}
+}
+
+void* QGraphicsItem_Window(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->window();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->window();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->window();
+	}
+}
+
+struct QtWidgets_PackedList QGraphicsItem_ChildItems(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsObject*>(ptr)->childItems()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsWidget*>(ptr)->childItems()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	} else {
+		return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsItem*>(ptr)->childItems()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	}
+}
+
+struct QtWidgets_PackedList QGraphicsItem_CollidingItems(void* ptr, long long mode)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsObject*>(ptr)->collidingItems(static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsWidget*>(ptr)->collidingItems(static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	} else {
+		return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsItem*>(ptr)->collidingItems(static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	}
+}
+
+struct QtWidgets_PackedList QGraphicsItem_Transformations(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QList<QGraphicsTransform *>* tmpValue = new QList<QGraphicsTransform *>(static_cast<QGraphicsObject*>(ptr)->transformations()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QList<QGraphicsTransform *>* tmpValue = new QList<QGraphicsTransform *>(static_cast<QGraphicsWidget*>(ptr)->transformations()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	} else {
+		return ({ QList<QGraphicsTransform *>* tmpValue = new QList<QGraphicsTransform *>(static_cast<QGraphicsItem*>(ptr)->transformations()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	}
+}
+
+void* QGraphicsItem_ClipPath(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->clipPath());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->clipPath());
+	} else {
+		return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->clipPath());
+	}
+}
+
+void* QGraphicsItem_MapFromItem4(void* ptr, void* item, void* path)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QPainterPath*>(path)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPainterPath*>(path)));
+		} else {
+			return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QPainterPath*>(path)));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QPainterPath*>(path)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPainterPath*>(path)));
+		} else {
+			return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QPainterPath*>(path)));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QPainterPath*>(path)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPainterPath*>(path)));
+		} else {
+			return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QPainterPath*>(path)));
+		}
+	}
+}
+
+void* QGraphicsItem_MapFromParent4(void* ptr, void* path)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapFromParent(*static_cast<QPainterPath*>(path)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapFromParent(*static_cast<QPainterPath*>(path)));
+	} else {
+		return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapFromParent(*static_cast<QPainterPath*>(path)));
+	}
+}
+
+void* QGraphicsItem_MapFromScene4(void* ptr, void* path)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapFromScene(*static_cast<QPainterPath*>(path)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapFromScene(*static_cast<QPainterPath*>(path)));
+	} else {
+		return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapFromScene(*static_cast<QPainterPath*>(path)));
+	}
+}
+
+void* QGraphicsItem_MapToItem4(void* ptr, void* item, void* path)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QPainterPath*>(path)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPainterPath*>(path)));
+		} else {
+			return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QPainterPath*>(path)));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QPainterPath*>(path)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPainterPath*>(path)));
+		} else {
+			return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QPainterPath*>(path)));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QPainterPath*>(path)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPainterPath*>(path)));
+		} else {
+			return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QPainterPath*>(path)));
+		}
+	}
+}
+
+void* QGraphicsItem_MapToParent4(void* ptr, void* path)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapToParent(*static_cast<QPainterPath*>(path)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapToParent(*static_cast<QPainterPath*>(path)));
+	} else {
+		return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapToParent(*static_cast<QPainterPath*>(path)));
+	}
+}
+
+void* QGraphicsItem_MapToScene4(void* ptr, void* path)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->mapToScene(*static_cast<QPainterPath*>(path)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->mapToScene(*static_cast<QPainterPath*>(path)));
+	} else {
+		return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->mapToScene(*static_cast<QPainterPath*>(path)));
+	}
+}
+
+void* QGraphicsItem_OpaqueArea(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->opaqueArea());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->opaqueArea());
+	} else {
+		return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->opaqueArea());
+	}
+}
+
+void* QGraphicsItem_OpaqueAreaDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::opaqueArea());
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::opaqueArea());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::opaqueArea());
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::opaqueArea());
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::opaqueArea());
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::opaqueArea());
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::opaqueArea());
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::opaqueArea());
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::opaqueArea());
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::opaqueArea());
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::opaqueArea());
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::opaqueArea());
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::opaqueArea());
+	} else {
+		return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::opaqueArea());
+	}
+}
+
+void* QGraphicsItem_Shape(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->shape());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->shape());
+	} else {
+		return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->shape());
+	}
+}
+
+void* QGraphicsItem_ShapeDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::shape());
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::shape());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::shape());
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::shape());
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::shape());
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::shape());
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::shape());
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::shape());
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::shape());
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::shape());
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::shape());
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::shape());
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		return new QPainterPath(static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::shape());
+	} else {
+		return new QPainterPath(static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::shape());
+	}
+}
+
+void* QGraphicsItem_MapFromItem(void* ptr, void* item, void* point)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	}
+}
+
+void* QGraphicsItem_MapFromItem5(void* ptr, void* item, double x, double y)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	}
+}
+
+void* QGraphicsItem_MapFromParent(void* ptr, void* point)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromParent(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromParent(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromParent(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_MapFromParent5(void* ptr, double x, double y)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromParent(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromParent(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromParent(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_MapFromScene(void* ptr, void* point)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromScene(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromScene(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromScene(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_MapFromScene5(void* ptr, double x, double y)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapFromScene(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapFromScene(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapFromScene(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_MapToItem(void* ptr, void* item, void* point)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	}
+}
+
+void* QGraphicsItem_MapToItem5(void* ptr, void* item, double x, double y)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		} else {
+			return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+		}
+	}
+}
+
+void* QGraphicsItem_MapToParent(void* ptr, void* point)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToParent(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToParent(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToParent(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_MapToParent5(void* ptr, double x, double y)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToParent(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToParent(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToParent(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_MapToScene(void* ptr, void* point)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToScene(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToScene(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToScene(*static_cast<QPointF*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_MapToScene5(void* ptr, double x, double y)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapToScene(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapToScene(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapToScene(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_Pos(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_ScenePos(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->scenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->scenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->scenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_TransformOriginPoint(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->transformOriginPoint(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->transformOriginPoint(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsItem*>(ptr)->transformOriginPoint(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void* QGraphicsItem_MapFromItem3(void* ptr, void* item, void* polygon)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QPolygonF*>(polygon)));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QPolygonF*>(polygon)));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QPolygonF*>(polygon)));
+		}
+	}
+}
+
+void* QGraphicsItem_MapFromItem2(void* ptr, void* item, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)));
+		}
+	}
+}
+
+void* QGraphicsItem_MapFromItem6(void* ptr, void* item, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), x, y, w, h));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), x, y, w, h));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), x, y, w, h));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), x, y, w, h));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), x, y, w, h));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), x, y, w, h));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsObject*>(item), x, y, w, h));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsWidget*>(item), x, y, w, h));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromItem(static_cast<QGraphicsItem*>(item), x, y, w, h));
+		}
+	}
+}
+
+void* QGraphicsItem_MapFromParent3(void* ptr, void* polygon)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromParent(*static_cast<QPolygonF*>(polygon)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromParent(*static_cast<QPolygonF*>(polygon)));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromParent(*static_cast<QPolygonF*>(polygon)));
+	}
+}
+
+void* QGraphicsItem_MapFromParent2(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromParent(*static_cast<QRectF*>(rect)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromParent(*static_cast<QRectF*>(rect)));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromParent(*static_cast<QRectF*>(rect)));
+	}
+}
+
+void* QGraphicsItem_MapFromParent6(void* ptr, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromParent(x, y, w, h));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromParent(x, y, w, h));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromParent(x, y, w, h));
+	}
+}
+
+void* QGraphicsItem_MapFromScene3(void* ptr, void* polygon)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromScene(*static_cast<QPolygonF*>(polygon)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromScene(*static_cast<QPolygonF*>(polygon)));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromScene(*static_cast<QPolygonF*>(polygon)));
+	}
+}
+
+void* QGraphicsItem_MapFromScene2(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromScene(*static_cast<QRectF*>(rect)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromScene(*static_cast<QRectF*>(rect)));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromScene(*static_cast<QRectF*>(rect)));
+	}
+}
+
+void* QGraphicsItem_MapFromScene6(void* ptr, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapFromScene(x, y, w, h));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapFromScene(x, y, w, h));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapFromScene(x, y, w, h));
+	}
+}
+
+void* QGraphicsItem_MapToItem3(void* ptr, void* item, void* polygon)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QPolygonF*>(polygon)));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QPolygonF*>(polygon)));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QPolygonF*>(polygon)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QPolygonF*>(polygon)));
+		}
+	}
+}
+
+void* QGraphicsItem_MapToItem2(void* ptr, void* item, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)));
+		}
+	}
+}
+
+void* QGraphicsItem_MapToItem6(void* ptr, void* item, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), x, y, w, h));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), x, y, w, h));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), x, y, w, h));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), x, y, w, h));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), x, y, w, h));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), x, y, w, h));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsObject*>(item), x, y, w, h));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsWidget*>(item), x, y, w, h));
+		} else {
+			return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToItem(static_cast<QGraphicsItem*>(item), x, y, w, h));
+		}
+	}
+}
+
+void* QGraphicsItem_MapToParent3(void* ptr, void* polygon)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToParent(*static_cast<QPolygonF*>(polygon)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToParent(*static_cast<QPolygonF*>(polygon)));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToParent(*static_cast<QPolygonF*>(polygon)));
+	}
+}
+
+void* QGraphicsItem_MapToParent2(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToParent(*static_cast<QRectF*>(rect)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToParent(*static_cast<QRectF*>(rect)));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToParent(*static_cast<QRectF*>(rect)));
+	}
+}
+
+void* QGraphicsItem_MapToParent6(void* ptr, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToParent(x, y, w, h));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToParent(x, y, w, h));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToParent(x, y, w, h));
+	}
+}
+
+void* QGraphicsItem_MapToScene3(void* ptr, void* polygon)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToScene(*static_cast<QPolygonF*>(polygon)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToScene(*static_cast<QPolygonF*>(polygon)));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToScene(*static_cast<QPolygonF*>(polygon)));
+	}
+}
+
+void* QGraphicsItem_MapToScene2(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToScene(*static_cast<QRectF*>(rect)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToScene(*static_cast<QRectF*>(rect)));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToScene(*static_cast<QRectF*>(rect)));
+	}
+}
+
+void* QGraphicsItem_MapToScene6(void* ptr, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsObject*>(ptr)->mapToScene(x, y, w, h));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QPolygonF(static_cast<QGraphicsWidget*>(ptr)->mapToScene(x, y, w, h));
+	} else {
+		return new QPolygonF(static_cast<QGraphicsItem*>(ptr)->mapToScene(x, y, w, h));
+	}
+}
+
+void* QGraphicsItem_BoundingRect(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_ChildrenBoundingRect(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->childrenBoundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->childrenBoundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->childrenBoundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_MapRectFromItem(void* ptr, void* item, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	}
+}
+
+void* QGraphicsItem_MapRectFromItem2(void* ptr, void* item, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromItem(static_cast<QGraphicsObject*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromItem(static_cast<QGraphicsWidget*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromItem(static_cast<QGraphicsItem*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromItem(static_cast<QGraphicsObject*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromItem(static_cast<QGraphicsWidget*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromItem(static_cast<QGraphicsItem*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromItem(static_cast<QGraphicsObject*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromItem(static_cast<QGraphicsWidget*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromItem(static_cast<QGraphicsItem*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	}
+}
+
+void* QGraphicsItem_MapRectFromParent(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromParent(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromParent(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromParent(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_MapRectFromParent2(void* ptr, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromParent(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromParent(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromParent(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_MapRectFromScene(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromScene(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromScene(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromScene(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_MapRectFromScene2(void* ptr, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectFromScene(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectFromScene(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectFromScene(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_MapRectToItem(void* ptr, void* item, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToItem(static_cast<QGraphicsObject*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToItem(static_cast<QGraphicsWidget*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToItem(static_cast<QGraphicsItem*>(item), *static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	}
+}
+
+void* QGraphicsItem_MapRectToItem2(void* ptr, void* item, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToItem(static_cast<QGraphicsObject*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToItem(static_cast<QGraphicsWidget*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToItem(static_cast<QGraphicsItem*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToItem(static_cast<QGraphicsObject*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToItem(static_cast<QGraphicsWidget*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToItem(static_cast<QGraphicsItem*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToItem(static_cast<QGraphicsObject*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToItem(static_cast<QGraphicsWidget*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		} else {
+			return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToItem(static_cast<QGraphicsItem*>(item), x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+		}
+	}
+}
+
+void* QGraphicsItem_MapRectToParent(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToParent(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToParent(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToParent(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_MapRectToParent2(void* ptr, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToParent(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToParent(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToParent(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_MapRectToScene(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToScene(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToScene(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToScene(*static_cast<QRectF*>(rect)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_MapRectToScene2(void* ptr, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->mapRectToScene(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->mapRectToScene(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->mapRectToScene(x, y, w, h); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_SceneBoundingRect(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsObject*>(ptr)->sceneBoundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->sceneBoundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsItem*>(ptr)->sceneBoundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsItem_BoundingRegion(void* ptr, void* itemToDeviceTransform)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QRegion(static_cast<QGraphicsObject*>(ptr)->boundingRegion(*static_cast<QTransform*>(itemToDeviceTransform)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QRegion(static_cast<QGraphicsWidget*>(ptr)->boundingRegion(*static_cast<QTransform*>(itemToDeviceTransform)));
+	} else {
+		return new QRegion(static_cast<QGraphicsItem*>(ptr)->boundingRegion(*static_cast<QTransform*>(itemToDeviceTransform)));
+	}
+}
+
+struct QtWidgets_PackedString QGraphicsItem_ToolTip(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return ({ QByteArray t7daf65 = static_cast<QGraphicsObject*>(ptr)->toolTip().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t7daf65.prepend("WHITESPACE").constData()+10), t7daf65.size()-10 }; });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QByteArray t7daf65 = static_cast<QGraphicsWidget*>(ptr)->toolTip().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t7daf65.prepend("WHITESPACE").constData()+10), t7daf65.size()-10 }; });
+	} else {
+		return ({ QByteArray t7daf65 = static_cast<QGraphicsItem*>(ptr)->toolTip().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t7daf65.prepend("WHITESPACE").constData()+10), t7daf65.size()-10 }; });
+	}
+}
+
+void* QGraphicsItem_DeviceTransform(void* ptr, void* viewportTransform)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QTransform(static_cast<QGraphicsObject*>(ptr)->deviceTransform(*static_cast<QTransform*>(viewportTransform)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QTransform(static_cast<QGraphicsWidget*>(ptr)->deviceTransform(*static_cast<QTransform*>(viewportTransform)));
+	} else {
+		return new QTransform(static_cast<QGraphicsItem*>(ptr)->deviceTransform(*static_cast<QTransform*>(viewportTransform)));
+	}
+}
+
+void* QGraphicsItem_ItemTransform(void* ptr, void* other, char ok)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return new QTransform(static_cast<QGraphicsObject*>(ptr)->itemTransform(static_cast<QGraphicsObject*>(other), NULL));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return new QTransform(static_cast<QGraphicsObject*>(ptr)->itemTransform(static_cast<QGraphicsWidget*>(other), NULL));
+		} else {
+			return new QTransform(static_cast<QGraphicsObject*>(ptr)->itemTransform(static_cast<QGraphicsItem*>(other), NULL));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return new QTransform(static_cast<QGraphicsWidget*>(ptr)->itemTransform(static_cast<QGraphicsObject*>(other), NULL));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return new QTransform(static_cast<QGraphicsWidget*>(ptr)->itemTransform(static_cast<QGraphicsWidget*>(other), NULL));
+		} else {
+			return new QTransform(static_cast<QGraphicsWidget*>(ptr)->itemTransform(static_cast<QGraphicsItem*>(other), NULL));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return new QTransform(static_cast<QGraphicsItem*>(ptr)->itemTransform(static_cast<QGraphicsObject*>(other), NULL));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return new QTransform(static_cast<QGraphicsItem*>(ptr)->itemTransform(static_cast<QGraphicsWidget*>(other), NULL));
+		} else {
+			return new QTransform(static_cast<QGraphicsItem*>(ptr)->itemTransform(static_cast<QGraphicsItem*>(other), NULL));
+		}
+	}
+}
+
+void* QGraphicsItem_SceneTransform(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QTransform(static_cast<QGraphicsObject*>(ptr)->sceneTransform());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QTransform(static_cast<QGraphicsWidget*>(ptr)->sceneTransform());
+	} else {
+		return new QTransform(static_cast<QGraphicsItem*>(ptr)->sceneTransform());
+	}
+}
+
+void* QGraphicsItem_Transform(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QTransform(static_cast<QGraphicsObject*>(ptr)->transform());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QTransform(static_cast<QGraphicsWidget*>(ptr)->transform());
+	} else {
+		return new QTransform(static_cast<QGraphicsItem*>(ptr)->transform());
+	}
+}
+
+void* QGraphicsItem_Data(void* ptr, int key)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsObject*>(ptr)->data(key));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsWidget*>(ptr)->data(key));
+	} else {
+		return new QVariant(static_cast<QGraphicsItem*>(ptr)->data(key));
+	}
+}
+
+void* QGraphicsItem_InputMethodQuery(void* ptr, long long query)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsObject*>(ptr)->inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsWidget*>(ptr)->inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else {
+		return new QVariant(static_cast<QGraphicsItem*>(ptr)->inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	}
+}
+
+void* QGraphicsItem_InputMethodQueryDefault(void* ptr, long long query)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		return new QVariant(static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	} else {
+		return new QVariant(static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+	}
+}
+
+long long QGraphicsItem_InputMethodHints(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->inputMethodHints();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->inputMethodHints();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->inputMethodHints();
+	}
+}
+
+long long QGraphicsItem_AcceptedMouseButtons(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->acceptedMouseButtons();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->acceptedMouseButtons();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->acceptedMouseButtons();
+	}
+}
+
+char QGraphicsItem_AcceptDrops(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->acceptDrops();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->acceptDrops();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->acceptDrops();
+	}
+}
+
+char QGraphicsItem_AcceptHoverEvents(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->acceptHoverEvents();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->acceptHoverEvents();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->acceptHoverEvents();
+	}
+}
+
+char QGraphicsItem_AcceptTouchEvents(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->acceptTouchEvents();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->acceptTouchEvents();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->acceptTouchEvents();
+	}
+}
+
+char QGraphicsItem_CollidesWithItem(void* ptr, void* other, long long mode)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsObject*>(ptr)->collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsObject*>(ptr)->collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsWidget*>(ptr)->collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsWidget*>(ptr)->collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsItem*>(ptr)->collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsItem*>(ptr)->collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsItem*>(ptr)->collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	}
+}
+
+char QGraphicsItem_CollidesWithItemDefault(void* ptr, void* other, long long mode)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::collidesWithItem(static_cast<QGraphicsObject*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(other))) {
+			return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::collidesWithItem(static_cast<QGraphicsWidget*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		} else {
+			return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::collidesWithItem(static_cast<QGraphicsItem*>(other), static_cast<Qt::ItemSelectionMode>(mode));
+		}
+	}
+}
+
+char QGraphicsItem_CollidesWithPath(void* ptr, void* path, long long mode)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	}
+}
+
+char QGraphicsItem_CollidesWithPathDefault(void* ptr, void* path, long long mode)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::collidesWithPath(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode));
+	}
+}
+
+char QGraphicsItem_Contains(void* ptr, void* point)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->contains(*static_cast<QPointF*>(point));
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->contains(*static_cast<QPointF*>(point));
+	}
+}
+
+char QGraphicsItem_ContainsDefault(void* ptr, void* point)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::contains(*static_cast<QPointF*>(point));
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::contains(*static_cast<QPointF*>(point));
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::contains(*static_cast<QPointF*>(point));
+	}
+}
+
+char QGraphicsItem_FiltersChildEvents(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->filtersChildEvents();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->filtersChildEvents();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->filtersChildEvents();
+	}
+}
+
+char QGraphicsItem_HasCursor(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->hasCursor();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->hasCursor();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->hasCursor();
+	}
+}
+
+char QGraphicsItem_HasFocus(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->hasFocus();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->hasFocus();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->hasFocus();
+	}
+}
+
+char QGraphicsItem_IsActive(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isActive();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isActive();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isActive();
+	}
+}
+
+char QGraphicsItem_IsAncestorOf(void* ptr, void* child)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(child))) {
+			return static_cast<QGraphicsObject*>(ptr)->isAncestorOf(static_cast<QGraphicsObject*>(child));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(child))) {
+			return static_cast<QGraphicsObject*>(ptr)->isAncestorOf(static_cast<QGraphicsWidget*>(child));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->isAncestorOf(static_cast<QGraphicsItem*>(child));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(child))) {
+			return static_cast<QGraphicsWidget*>(ptr)->isAncestorOf(static_cast<QGraphicsObject*>(child));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(child))) {
+			return static_cast<QGraphicsWidget*>(ptr)->isAncestorOf(static_cast<QGraphicsWidget*>(child));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->isAncestorOf(static_cast<QGraphicsItem*>(child));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(child))) {
+			return static_cast<QGraphicsItem*>(ptr)->isAncestorOf(static_cast<QGraphicsObject*>(child));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(child))) {
+			return static_cast<QGraphicsItem*>(ptr)->isAncestorOf(static_cast<QGraphicsWidget*>(child));
+		} else {
+			return static_cast<QGraphicsItem*>(ptr)->isAncestorOf(static_cast<QGraphicsItem*>(child));
+		}
+	}
+}
+
+char QGraphicsItem_IsClipped(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isClipped();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isClipped();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isClipped();
+	}
+}
+
+char QGraphicsItem_IsEnabled(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isEnabled();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isEnabled();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isEnabled();
+	}
+}
+
+char QGraphicsItem_IsObscured(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isObscured(*static_cast<QRectF*>(rect));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isObscured(*static_cast<QRectF*>(rect));
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isObscured(*static_cast<QRectF*>(rect));
+	}
+}
+
+char QGraphicsItem_IsObscured2(void* ptr, double x, double y, double w, double h)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isObscured(x, y, w, h);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isObscured(x, y, w, h);
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isObscured(x, y, w, h);
+	}
+}
+
+char QGraphicsItem_IsObscuredBy(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsObject*>(ptr)->isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsObject*>(ptr)->isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsWidget*>(ptr)->isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsWidget*>(ptr)->isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsItem*>(ptr)->isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsItem*>(ptr)->isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsItem*>(ptr)->isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	}
+}
+
+char QGraphicsItem_IsObscuredByDefault(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::isObscuredBy(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::isObscuredBy(static_cast<QGraphicsWidget*>(item));
+		} else {
+			return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::isObscuredBy(static_cast<QGraphicsItem*>(item));
+		}
+	}
+}
+
+char QGraphicsItem_IsPanel(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isPanel();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isPanel();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isPanel();
+	}
+}
+
+char QGraphicsItem_IsSelected(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isSelected();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isSelected();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isSelected();
+	}
+}
+
+char QGraphicsItem_IsUnderMouse(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isUnderMouse();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isUnderMouse();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isUnderMouse();
+	}
+}
+
+char QGraphicsItem_IsVisible(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isVisible();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isVisible();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isVisible();
+	}
+}
+
+char QGraphicsItem_IsVisibleTo(void* ptr, void* parent)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(parent))) {
+			return static_cast<QGraphicsObject*>(ptr)->isVisibleTo(static_cast<QGraphicsObject*>(parent));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(parent))) {
+			return static_cast<QGraphicsObject*>(ptr)->isVisibleTo(static_cast<QGraphicsWidget*>(parent));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->isVisibleTo(static_cast<QGraphicsItem*>(parent));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(parent))) {
+			return static_cast<QGraphicsWidget*>(ptr)->isVisibleTo(static_cast<QGraphicsObject*>(parent));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(parent))) {
+			return static_cast<QGraphicsWidget*>(ptr)->isVisibleTo(static_cast<QGraphicsWidget*>(parent));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->isVisibleTo(static_cast<QGraphicsItem*>(parent));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(parent))) {
+			return static_cast<QGraphicsItem*>(ptr)->isVisibleTo(static_cast<QGraphicsObject*>(parent));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(parent))) {
+			return static_cast<QGraphicsItem*>(ptr)->isVisibleTo(static_cast<QGraphicsWidget*>(parent));
+		} else {
+			return static_cast<QGraphicsItem*>(ptr)->isVisibleTo(static_cast<QGraphicsItem*>(parent));
+		}
+	}
+}
+
+char QGraphicsItem_IsWidget(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isWidget();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isWidget();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isWidget();
+	}
+}
+
+char QGraphicsItem_IsWindow(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->isWindow();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isWindow();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->isWindow();
+	}
+}
+
+void* QGraphicsItem_ToGraphicsObject2(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsObject*>(static_cast<QGraphicsObject*>(ptr)->toGraphicsObject());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsObject*>(static_cast<QGraphicsWidget*>(ptr)->toGraphicsObject());
+	} else {
+		return const_cast<QGraphicsObject*>(static_cast<QGraphicsItem*>(ptr)->toGraphicsObject());
+	}
+}
+
+int QGraphicsItem_Type(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->type();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->type();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->type();
+	}
+}
+
+int QGraphicsItem_TypeDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsPixmapItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::type();
+	} else if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::type();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::type();
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::type();
+	} else if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::type();
+	} else if (dynamic_cast<QGraphicsLineItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::type();
+	} else if (dynamic_cast<QGraphicsItemGroup*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::type();
+	} else if (dynamic_cast<QGraphicsSimpleTextItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::type();
+	} else if (dynamic_cast<QGraphicsRectItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::type();
+	} else if (dynamic_cast<QGraphicsPolygonItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::type();
+	} else if (dynamic_cast<QGraphicsPathItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::type();
+	} else if (dynamic_cast<QGraphicsEllipseItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsEllipseItem*>(ptr)->QGraphicsEllipseItem::type();
+	} else if (dynamic_cast<QAbstractGraphicsShapeItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QAbstractGraphicsShapeItem*>(ptr)->QAbstractGraphicsShapeItem::type();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->QGraphicsItem::type();
+	}
+}
+
+double QGraphicsItem_BoundingRegionGranularity(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->boundingRegionGranularity();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->boundingRegionGranularity();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->boundingRegionGranularity();
+	}
+}
+
+double QGraphicsItem_EffectiveOpacity(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->effectiveOpacity();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->effectiveOpacity();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->effectiveOpacity();
+	}
+}
+
+double QGraphicsItem_Opacity(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->opacity();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->opacity();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->opacity();
+	}
+}
+
+double QGraphicsItem_Rotation(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->rotation();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->rotation();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->rotation();
+	}
+}
+
+double QGraphicsItem_Scale(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->scale();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->scale();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->scale();
+	}
+}
+
+double QGraphicsItem_X(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->x();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->x();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->x();
+	}
+}
+
+double QGraphicsItem_Y(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->y();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->y();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->y();
+	}
+}
+
+double QGraphicsItem_ZValue(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsObject*>(ptr)->zValue();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->zValue();
+	} else {
+		return static_cast<QGraphicsItem*>(ptr)->zValue();
+	}
+}
+
+int QGraphicsItem_QGraphicsItem_UserType()
+{
+		return QGraphicsItem::UserType;
+}
+
+void* QGraphicsItem___setTransformations_transformations_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsTransform*>(static_cast<QList<QGraphicsTransform *>*>(ptr)->at(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsTransform*>(static_cast<QList<QGraphicsTransform *>*>(ptr)->at(i));
+	} else {
+		return const_cast<QGraphicsTransform*>(static_cast<QList<QGraphicsTransform *>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsItem___setTransformations_transformations_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QList<QGraphicsTransform *>*>(ptr)->append(static_cast<QGraphicsTransform*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QList<QGraphicsTransform *>*>(ptr)->append(static_cast<QGraphicsTransform*>(i));
+	} else {
+		static_cast<QList<QGraphicsTransform *>*>(ptr)->append(static_cast<QGraphicsTransform*>(i));
+	}
+}
+
+void* QGraphicsItem___setTransformations_transformations_newList(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsTransform *>;
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsTransform *>;
+	} else {
+		return new QList<QGraphicsTransform *>;
+	}
+}
+
+void* QGraphicsItem___childItems_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+	} else {
+		return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsItem___childItems_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+		}
+	}
+}
+
+void* QGraphicsItem___childItems_newList(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsItem *>;
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsItem *>;
+	} else {
+		return new QList<QGraphicsItem *>;
+	}
+}
+
+void* QGraphicsItem___children_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+	} else {
+		return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsItem___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+		}
+	}
+}
+
+void* QGraphicsItem___children_newList(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsItem *>;
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsItem *>;
+	} else {
+		return new QList<QGraphicsItem *>;
+	}
+}
+
+void* QGraphicsItem___collidingItems_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+	} else {
+		return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsItem___collidingItems_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else {
+			static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+		}
+	}
+}
+
+void* QGraphicsItem___collidingItems_newList(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsItem *>;
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsItem *>;
+	} else {
+		return new QList<QGraphicsItem *>;
+	}
+}
+
+void* QGraphicsItem___transformations_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsTransform*>(static_cast<QList<QGraphicsTransform *>*>(ptr)->at(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QGraphicsTransform*>(static_cast<QList<QGraphicsTransform *>*>(ptr)->at(i));
+	} else {
+		return const_cast<QGraphicsTransform*>(static_cast<QList<QGraphicsTransform *>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsItem___transformations_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		static_cast<QList<QGraphicsTransform *>*>(ptr)->append(static_cast<QGraphicsTransform*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QList<QGraphicsTransform *>*>(ptr)->append(static_cast<QGraphicsTransform*>(i));
+	} else {
+		static_cast<QList<QGraphicsTransform *>*>(ptr)->append(static_cast<QGraphicsTransform*>(i));
+	}
+}
+
+void* QGraphicsItem___transformations_newList(void* ptr)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsTransform *>;
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QGraphicsTransform *>;
+	} else {
+		return new QList<QGraphicsTransform *>;
+	}
+}
+
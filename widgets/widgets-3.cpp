@@ -0,0 +1,11397 @@
+// +build !minimal
+
+#define protected public
+#define private public
+
+#include "widgets.h"
+#include "_cgo_export.h"
+
+#include <QAbstractAnimation>
+#include <QAbstractItemDelegate>
+#include <QAbstractItemModel>
+#include <QAbstractItemView>
+#include <QAbstractScrollArea>
+#include <QAbstractState>
+#include <QAction>
+#include <QActionEvent>
+#include <QBoxLayout>
+#include <QBrush>
+#include <QByteArray>
+#include <QChildEvent>
+#include <QCloseEvent>
+#include <QColor>
+#include <QCompleter>
+#include <QContextMenuEvent>
+#include <QDial>
+#include <QDialog>
+#include <QDrag>
+#include <QDragEnterEvent>
+#include <QDragLeaveEvent>
+#include <QDragMoveEvent>
+#include <QDropEvent>
+#include <QEvent>
+#include <QFocusEvent>
+#include <QFont>
+#include <QFormLayout>
+#include <QGraphicsAnchor>
+#include <QGraphicsAnchorLayout>
+#include <QGraphicsEffect>
+#include <QGraphicsGridLayout>
+#include <QGraphicsItem>
+#include <QGraphicsItemGroup>
+#include <QGraphicsLayout>
+#include <QGraphicsLayoutItem>
+#include <QGraphicsLineItem>
+#include <QGraphicsLinearLayout>
+#include <QGraphicsObject>
+#include <QGraphicsOpacityEffect>
+#include <QGraphicsPathItem>
+#include <QGraphicsPixmapItem>
+#include <QGraphicsPolygonItem>
+#include <QGraphicsProxyWidget>
+#include <QGraphicsRectItem>
+#include <QGraphicsRotation>
+#include <QGraphicsScale>
+#include <QGraphicsScene>
+#include <QGraphicsSceneContextMenuEvent>
+#include <QGraphicsSceneDragDropEvent>
+#include <QGraphicsSceneEvent>
+#include <QGraphicsSceneHelpEvent>
+#include <QGraphicsSceneHoverEvent>
+#include <QGraphicsSceneMouseEvent>
+#include <QGraphicsSceneMoveEvent>
+#include <QGraphicsSceneResizeEvent>
+#include <QGraphicsSceneWheelEvent>
+#include <QGraphicsSimpleTextItem>
+#include <QGraphicsTextItem>
+#include <QGraphicsTransform>
+#include <QGraphicsView>
+#include <QGraphicsWidget>
+#include <QGridLayout>
+#include <QGroupBox>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QHelpEvent>
+#include <QHideEvent>
+#include <QIcon>
+#include <QInputDialog>
+#include <QInputMethod>
+#include <QInputMethodEvent>
+#include <QItemDelegate>
+#include <QItemEditorCreator>
+#include <QItemEditorCreatorBase>
+#include <QItemEditorFactory>
+#include <QItemSelection>
+#include <QItemSelectionModel>
+#include <QKeyEvent>
+#include <QKeyEventTransition>
+#include <QKeySequence>
+#include <QKeySequenceEdit>
+#include <QLCDNumber>
+#include <QLabel>
+#include <QLayout>
+#include <QLayoutItem>
+#include <QLine>
+#include <QLineEdit>
+#include <QLineF>
+#include <QList>
+#include <QMargins>
+#include <QMatrix4x4>
+#include <QMetaMethod>
+#include <QMetaObject>
+#include <QMimeData>
+#include <QModelIndex>
+#include <QMouseEvent>
+#include <QMoveEvent>
+#include <QMovie>
+#include <QObject>
+#include <QPaintDevice>
+#include <QPaintEngine>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPalette>
+#include <QPen>
+#include <QPicture>
+#include <QPixmap>
+#include <QPoint>
+#include <QPointF>
+#include <QPolygon>
+#include <QPolygonF>
+#include <QRect>
+#include <QRectF>
+#include <QRegion>
+#include <QResizeEvent>
+#include <QShowEvent>
+#include <QSize>
+#include <QSizeF>
+#include <QSizePolicy>
+#include <QSpacerItem>
+#include <QStack>
+#include <QStackedLayout>
+#include <QState>
+#include <QString>
+#include <QStyle>
+#include <QStyleOption>
+#include <QStyleOptionFrame>
+#include <QStyleOptionGraphicsItem>
+#include <QStyleOptionGroupBox>
+#include <QStyleOptionHeader>
+#include <QStyleOptionViewItem>
+#include <QTabletEvent>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTime>
+#include <QTimer>
+#include <QTimerEvent>
+#include <QTransform>
+#include <QVBoxLayout>
+#include <QValidator>
+#include <QVariant>
+#include <QVector>
+#include <QVector3D>
+#include <QWheelEvent>
+#include <QWidget>
+#include <QWidgetItem>
+#include <QStringList>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+class MyQGraphicsItemGroup: public QGraphicsItemGroup
+{
+public:
+	MyQGraphicsItemGroup(QGraphicsItem *parent) : QGraphicsItemGroup(parent) {};
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsItemGroup_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsItemGroup_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+};
+
+void* QGraphicsItemGroup_NewQGraphicsItemGroup(void* parent)
+{
+	return new MyQGraphicsItemGroup(static_cast<QGraphicsItem*>(parent));
+}
+
+void QGraphicsItemGroup_AddToGroup(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->addToGroup(static_cast<QGraphicsObject*>(item));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->addToGroup(static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsItemGroup*>(ptr)->addToGroup(static_cast<QGraphicsItem*>(item));
+	}
+}
+
+void QGraphicsItemGroup_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsItemGroup*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsItemGroup_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsItemGroup_RemoveFromGroup(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->removeFromGroup(static_cast<QGraphicsObject*>(item));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsItemGroup*>(ptr)->removeFromGroup(static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsItemGroup*>(ptr)->removeFromGroup(static_cast<QGraphicsItem*>(item));
+	}
+}
+
+void QGraphicsItemGroup_DestroyQGraphicsItemGroup(void* ptr)
+{
+	static_cast<QGraphicsItemGroup*>(ptr)->~QGraphicsItemGroup();
+}
+
+void* QGraphicsItemGroup_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsItemGroup*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsItemGroup_BoundingRectDefault(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsItemGroup*>(ptr)->QGraphicsItemGroup::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+class MyQGraphicsLayout: public QGraphicsLayout
+{
+public:
+	MyQGraphicsLayout(QGraphicsLayoutItem *parent) : QGraphicsLayout(parent) {};
+	void invalidate() { callbackQGraphicsLayout_Invalidate(this); };
+	void removeAt(int index) { callbackQGraphicsLayout_RemoveAt(this, index); };
+	void updateGeometry() { callbackQGraphicsLayoutItem_UpdateGeometry(this); };
+	void widgetEvent(QEvent * e) { callbackQGraphicsLayout_WidgetEvent(this, e); };
+	QGraphicsLayoutItem * itemAt(int i) const { return static_cast<QGraphicsLayoutItem*>(callbackQGraphicsLayout_ItemAt(const_cast<void*>(static_cast<const void*>(this)), i)); };
+	int count() const { return callbackQGraphicsLayout_Count(const_cast<void*>(static_cast<const void*>(this))); };
+	void getContentsMargins(qreal * left, qreal * top, qreal * right, qreal * bottom) const { callbackQGraphicsLayoutItem_GetContentsMargins(const_cast<void*>(static_cast<const void*>(this)), *left, *top, *right, *bottom); };
+	void setGeometry(const QRectF & rect) { callbackQGraphicsLayoutItem_SetGeometry(this, const_cast<QRectF*>(&rect)); };
+	QSizeF sizeHint(Qt::SizeHint which, const QSizeF & constraint) const { return *static_cast<QSizeF*>(callbackQGraphicsLayout_SizeHint(const_cast<void*>(static_cast<const void*>(this)), which, const_cast<QSizeF*>(&constraint))); };
+};
+
+void* QGraphicsLayout_NewQGraphicsLayout(void* parent)
+{
+	return new MyQGraphicsLayout(static_cast<QGraphicsLayoutItem*>(parent));
+}
+
+void QGraphicsLayout_Activate(void* ptr)
+{
+	static_cast<QGraphicsLayout*>(ptr)->activate();
+}
+
+void QGraphicsLayout_AddChildLayoutItem(void* ptr, void* layoutItem)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(layoutItem))) {
+		static_cast<QGraphicsLayout*>(ptr)->addChildLayoutItem(static_cast<QGraphicsWidget*>(layoutItem));
+	} else {
+		static_cast<QGraphicsLayout*>(ptr)->addChildLayoutItem(static_cast<QGraphicsLayoutItem*>(layoutItem));
+	}
+}
+
+void QGraphicsLayout_Invalidate(void* ptr)
+{
+	static_cast<QGraphicsLayout*>(ptr)->invalidate();
+}
+
+void QGraphicsLayout_InvalidateDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsLinearLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::invalidate();
+	} else if (dynamic_cast<QGraphicsGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsGridLayout*>(ptr)->QGraphicsGridLayout::invalidate();
+	} else if (dynamic_cast<QGraphicsAnchorLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::invalidate();
+	} else {
+		static_cast<QGraphicsLayout*>(ptr)->QGraphicsLayout::invalidate();
+	}
+}
+
+void QGraphicsLayout_RemoveAt(void* ptr, int index)
+{
+	static_cast<QGraphicsLayout*>(ptr)->removeAt(index);
+}
+
+void QGraphicsLayout_SetContentsMargins(void* ptr, double left, double top, double right, double bottom)
+{
+	static_cast<QGraphicsLayout*>(ptr)->setContentsMargins(left, top, right, bottom);
+}
+
+void QGraphicsLayout_WidgetEvent(void* ptr, void* e)
+{
+	static_cast<QGraphicsLayout*>(ptr)->widgetEvent(static_cast<QEvent*>(e));
+}
+
+void QGraphicsLayout_WidgetEventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QGraphicsLinearLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::widgetEvent(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QGraphicsGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsGridLayout*>(ptr)->QGraphicsGridLayout::widgetEvent(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QGraphicsAnchorLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::widgetEvent(static_cast<QEvent*>(e));
+	} else {
+		static_cast<QGraphicsLayout*>(ptr)->QGraphicsLayout::widgetEvent(static_cast<QEvent*>(e));
+	}
+}
+
+void QGraphicsLayout_DestroyQGraphicsLayout(void* ptr)
+{
+	static_cast<QGraphicsLayout*>(ptr)->~QGraphicsLayout();
+}
+
+void* QGraphicsLayout_ItemAt(void* ptr, int i)
+{
+	return static_cast<QGraphicsLayout*>(ptr)->itemAt(i);
+}
+
+char QGraphicsLayout_IsActivated(void* ptr)
+{
+	return static_cast<QGraphicsLayout*>(ptr)->isActivated();
+}
+
+int QGraphicsLayout_Count(void* ptr)
+{
+	return static_cast<QGraphicsLayout*>(ptr)->count();
+}
+
+void* QGraphicsLayout_SizeHint(void* ptr, long long which, void* constraint)
+{
+	return ({ QSizeF tmpValue = static_cast<QGraphicsLayout*>(ptr)->sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsLayout_SizeHintDefault(void* ptr, long long which, void* constraint)
+{
+	if (dynamic_cast<QGraphicsLinearLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsGridLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsGridLayout*>(ptr)->QGraphicsGridLayout::sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsAnchorLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	} else {
+	
+	}
+}
+
+class MyQGraphicsLayoutItem: public QGraphicsLayoutItem
+{
+public:
+	MyQGraphicsLayoutItem(QGraphicsLayoutItem *parent, bool isLayout) : QGraphicsLayoutItem(parent, isLayout) {};
+	void setGeometry(const QRectF & rect) { callbackQGraphicsLayoutItem_SetGeometry(this, const_cast<QRectF*>(&rect)); };
+	void updateGeometry() { callbackQGraphicsLayoutItem_UpdateGeometry(this); };
+	 ~MyQGraphicsLayoutItem() { callbackQGraphicsLayoutItem_DestroyQGraphicsLayoutItem(this); };
+	QSizeF sizeHint(Qt::SizeHint which, const QSizeF & constraint) const { return *static_cast<QSizeF*>(callbackQGraphicsLayoutItem_SizeHint(const_cast<void*>(static_cast<const void*>(this)), which, const_cast<QSizeF*>(&constraint))); };
+	void getContentsMargins(qreal * left, qreal * top, qreal * right, qreal * bottom) const { callbackQGraphicsLayoutItem_GetContentsMargins(const_cast<void*>(static_cast<const void*>(this)), *left, *top, *right, *bottom); };
+};
+
+void* QGraphicsLayoutItem_NewQGraphicsLayoutItem(void* parent, char isLayout)
+{
+	return new MyQGraphicsLayoutItem(static_cast<QGraphicsLayoutItem*>(parent), isLayout != 0);
+}
+
+void QGraphicsLayoutItem_SetGeometry(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setGeometry(*static_cast<QRectF*>(rect));
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setGeometry(*static_cast<QRectF*>(rect));
+	}
+}
+
+void QGraphicsLayoutItem_SetGeometryDefault(void* ptr, void* rect)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::setGeometry(*static_cast<QRectF*>(rect));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::setGeometry(*static_cast<QRectF*>(rect));
+	} else if (dynamic_cast<QGraphicsLinearLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::setGeometry(*static_cast<QRectF*>(rect));
+	} else if (dynamic_cast<QGraphicsGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsGridLayout*>(ptr)->QGraphicsGridLayout::setGeometry(*static_cast<QRectF*>(rect));
+	} else if (dynamic_cast<QGraphicsAnchorLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::setGeometry(*static_cast<QRectF*>(rect));
+	} else if (dynamic_cast<QGraphicsLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLayout*>(ptr)->QGraphicsLayout::setGeometry(*static_cast<QRectF*>(rect));
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->QGraphicsLayoutItem::setGeometry(*static_cast<QRectF*>(rect));
+	}
+}
+
+void QGraphicsLayoutItem_SetGraphicsItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsWidget*>(ptr)->setGraphicsItem(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsWidget*>(ptr)->setGraphicsItem(static_cast<QGraphicsWidget*>(item));
+		} else {
+			static_cast<QGraphicsWidget*>(ptr)->setGraphicsItem(static_cast<QGraphicsItem*>(item));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsLayoutItem*>(ptr)->setGraphicsItem(static_cast<QGraphicsObject*>(item));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+			static_cast<QGraphicsLayoutItem*>(ptr)->setGraphicsItem(static_cast<QGraphicsWidget*>(item));
+		} else {
+			static_cast<QGraphicsLayoutItem*>(ptr)->setGraphicsItem(static_cast<QGraphicsItem*>(item));
+		}
+	}
+}
+
+void QGraphicsLayoutItem_SetMaximumHeight(void* ptr, double height)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setMaximumHeight(height);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setMaximumHeight(height);
+	}
+}
+
+void QGraphicsLayoutItem_SetMaximumSize(void* ptr, void* size)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setMaximumSize(*static_cast<QSizeF*>(size));
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setMaximumSize(*static_cast<QSizeF*>(size));
+	}
+}
+
+void QGraphicsLayoutItem_SetMaximumSize2(void* ptr, double w, double h)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setMaximumSize(w, h);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setMaximumSize(w, h);
+	}
+}
+
+void QGraphicsLayoutItem_SetMaximumWidth(void* ptr, double width)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setMaximumWidth(width);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setMaximumWidth(width);
+	}
+}
+
+void QGraphicsLayoutItem_SetMinimumHeight(void* ptr, double height)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setMinimumHeight(height);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setMinimumHeight(height);
+	}
+}
+
+void QGraphicsLayoutItem_SetMinimumSize(void* ptr, void* size)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setMinimumSize(*static_cast<QSizeF*>(size));
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setMinimumSize(*static_cast<QSizeF*>(size));
+	}
+}
+
+void QGraphicsLayoutItem_SetMinimumSize2(void* ptr, double w, double h)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setMinimumSize(w, h);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setMinimumSize(w, h);
+	}
+}
+
+void QGraphicsLayoutItem_SetMinimumWidth(void* ptr, double width)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setMinimumWidth(width);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setMinimumWidth(width);
+	}
+}
+
+void QGraphicsLayoutItem_SetOwnedByLayout(void* ptr, char ownership)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setOwnedByLayout(ownership != 0);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setOwnedByLayout(ownership != 0);
+	}
+}
+
+void QGraphicsLayoutItem_SetParentLayoutItem(void* ptr, void* parent)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(parent))) {
+			static_cast<QGraphicsWidget*>(ptr)->setParentLayoutItem(static_cast<QGraphicsWidget*>(parent));
+		} else {
+			static_cast<QGraphicsWidget*>(ptr)->setParentLayoutItem(static_cast<QGraphicsLayoutItem*>(parent));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(parent))) {
+			static_cast<QGraphicsLayoutItem*>(ptr)->setParentLayoutItem(static_cast<QGraphicsWidget*>(parent));
+		} else {
+			static_cast<QGraphicsLayoutItem*>(ptr)->setParentLayoutItem(static_cast<QGraphicsLayoutItem*>(parent));
+		}
+	}
+}
+
+void QGraphicsLayoutItem_SetPreferredHeight(void* ptr, double height)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setPreferredHeight(height);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setPreferredHeight(height);
+	}
+}
+
+void QGraphicsLayoutItem_SetPreferredSize(void* ptr, void* size)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setPreferredSize(*static_cast<QSizeF*>(size));
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setPreferredSize(*static_cast<QSizeF*>(size));
+	}
+}
+
+void QGraphicsLayoutItem_SetPreferredSize2(void* ptr, double w, double h)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setPreferredSize(w, h);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setPreferredSize(w, h);
+	}
+}
+
+void QGraphicsLayoutItem_SetPreferredWidth(void* ptr, double width)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setPreferredWidth(width);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setPreferredWidth(width);
+	}
+}
+
+void QGraphicsLayoutItem_SetSizePolicy2(void* ptr, long long hPolicy, long long vPolicy, long long controlType)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setSizePolicy(static_cast<QSizePolicy::Policy>(hPolicy), static_cast<QSizePolicy::Policy>(vPolicy), static_cast<QSizePolicy::ControlType>(controlType));
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setSizePolicy(static_cast<QSizePolicy::Policy>(hPolicy), static_cast<QSizePolicy::Policy>(vPolicy), static_cast<QSizePolicy::ControlType>(controlType));
+	}
+}
+
+void QGraphicsLayoutItem_SetSizePolicy(void* ptr, void* policy)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setSizePolicy(*static_cast<QSizePolicy*>(policy));
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->setSizePolicy(*static_cast<QSizePolicy*>(policy));
+	}
+}
+
+void QGraphicsLayoutItem_UpdateGeometry(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->updateGeometry();
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->updateGeometry();
+	}
+}
+
+void QGraphicsLayoutItem_UpdateGeometryDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::updateGeometry();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::updateGeometry();
+	} else if (dynamic_cast<QGraphicsLinearLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::updateGeometry();
+	} else if (dynamic_cast<QGraphicsGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsGridLayout*>(ptr)->QGraphicsGridLayout::updateGeometry();
+	} else if (dynamic_cast<QGraphicsAnchorLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::updateGeometry();
+	} else if (dynamic_cast<QGraphicsLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLayout*>(ptr)->QGraphicsLayout::updateGeometry();
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->QGraphicsLayoutItem::updateGeometry();
+	}
+}
+
+void QGraphicsLayoutItem_DestroyQGraphicsLayoutItem(void* ptr)
+{
+	static_cast<QGraphicsLayoutItem*>(ptr)->~QGraphicsLayoutItem();
+}
+
+void QGraphicsLayoutItem_DestroyQGraphicsLayoutItemDefault(void* ptr)
+{
+
+}
+
+void* QGraphicsLayoutItem_GraphicsItem(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->graphicsItem();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->graphicsItem();
+	}
+}
+
+void* QGraphicsLayoutItem_ParentLayoutItem(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->parentLayoutItem();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->parentLayoutItem();
+	}
+}
+
+void* QGraphicsLayoutItem_ContentsRect(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->contentsRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsLayoutItem*>(ptr)->contentsRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsLayoutItem_Geometry(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->geometry(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsLayoutItem*>(ptr)->geometry(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsLayoutItem_EffectiveSizeHint(void* ptr, long long which, void* constraint)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->effectiveSizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsLayoutItem*>(ptr)->effectiveSizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsLayoutItem_MaximumSize(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->maximumSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsLayoutItem*>(ptr)->maximumSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsLayoutItem_MinimumSize(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->minimumSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsLayoutItem*>(ptr)->minimumSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsLayoutItem_PreferredSize(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->preferredSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsLayoutItem*>(ptr)->preferredSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsLayoutItem_SizeHint(void* ptr, long long which, void* constraint)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsLayoutItem*>(ptr)->sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsLayoutItem_SizePolicy(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QSizePolicy(static_cast<QGraphicsWidget*>(ptr)->sizePolicy());
+	} else {
+		return new QSizePolicy(static_cast<QGraphicsLayoutItem*>(ptr)->sizePolicy());
+	}
+}
+
+char QGraphicsLayoutItem_IsLayout(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isLayout();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->isLayout();
+	}
+}
+
+char QGraphicsLayoutItem_OwnedByLayout(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->ownedByLayout();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->ownedByLayout();
+	}
+}
+
+double QGraphicsLayoutItem_MaximumHeight(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->maximumHeight();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->maximumHeight();
+	}
+}
+
+double QGraphicsLayoutItem_MaximumWidth(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->maximumWidth();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->maximumWidth();
+	}
+}
+
+double QGraphicsLayoutItem_MinimumHeight(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->minimumHeight();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->minimumHeight();
+	}
+}
+
+double QGraphicsLayoutItem_MinimumWidth(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->minimumWidth();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->minimumWidth();
+	}
+}
+
+double QGraphicsLayoutItem_PreferredHeight(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->preferredHeight();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->preferredHeight();
+	}
+}
+
+double QGraphicsLayoutItem_PreferredWidth(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->preferredWidth();
+	} else {
+		return static_cast<QGraphicsLayoutItem*>(ptr)->preferredWidth();
+	}
+}
+
+void QGraphicsLayoutItem_GetContentsMargins(void* ptr, double left, double top, double right, double bottom)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->getContentsMargins(&left, &top, &right, &bottom);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->getContentsMargins(&left, &top, &right, &bottom);
+	}
+}
+
+void QGraphicsLayoutItem_GetContentsMarginsDefault(void* ptr, double left, double top, double right, double bottom)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::getContentsMargins(&left, &top, &right, &bottom);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::getContentsMargins(&left, &top, &right, &bottom);
+	} else if (dynamic_cast<QGraphicsLinearLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::getContentsMargins(&left, &top, &right, &bottom);
+	} else if (dynamic_cast<QGraphicsGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsGridLayout*>(ptr)->QGraphicsGridLayout::getContentsMargins(&left, &top, &right, &bottom);
+	} else if (dynamic_cast<QGraphicsAnchorLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsAnchorLayout*>(ptr)->QGraphicsAnchorLayout::getContentsMargins(&left, &top, &right, &bottom);
+	} else if (dynamic_cast<QGraphicsLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsLayout*>(ptr)->QGraphicsLayout::getContentsMargins(&left, &top, &right, &bottom);
+	} else {
+		static_cast<QGraphicsLayoutItem*>(ptr)->QGraphicsLayoutItem::getContentsMargins(&left, &top, &right, &bottom);
+	}
+}
+
+class MyQGraphicsLineItem: public QGraphicsLineItem
+{
+public:
+	MyQGraphicsLineItem(QGraphicsItem *parent) : QGraphicsLineItem(parent) {};
+	MyQGraphicsLineItem(const QLineF &line, QGraphicsItem *parent) : QGraphicsLineItem(line, parent) {};
+	MyQGraphicsLineItem(qreal x1, qreal y1, qreal x2, qreal y2, QGraphicsItem *parent) : QGraphicsLineItem(x1, y1, x2, y2, parent) {};
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsLineItem_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsLineItem_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+};
+
+void* QGraphicsLineItem_NewQGraphicsLineItem(void* parent)
+{
+	return new MyQGraphicsLineItem(static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsLineItem_NewQGraphicsLineItem2(void* line, void* parent)
+{
+	return new MyQGraphicsLineItem(*static_cast<QLineF*>(line), static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsLineItem_NewQGraphicsLineItem3(double x1, double y1, double x2, double y2, void* parent)
+{
+	return new MyQGraphicsLineItem(x1, y1, x2, y2, static_cast<QGraphicsItem*>(parent));
+}
+
+void QGraphicsLineItem_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsLineItem*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsLineItem_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsLineItem_SetLine(void* ptr, void* line)
+{
+	static_cast<QGraphicsLineItem*>(ptr)->setLine(*static_cast<QLineF*>(line));
+}
+
+void QGraphicsLineItem_SetLine2(void* ptr, double x1, double y1, double x2, double y2)
+{
+	static_cast<QGraphicsLineItem*>(ptr)->setLine(x1, y1, x2, y2);
+}
+
+void QGraphicsLineItem_SetPen(void* ptr, void* pen)
+{
+	static_cast<QGraphicsLineItem*>(ptr)->setPen(*static_cast<QPen*>(pen));
+}
+
+void QGraphicsLineItem_DestroyQGraphicsLineItem(void* ptr)
+{
+	static_cast<QGraphicsLineItem*>(ptr)->~QGraphicsLineItem();
+}
+
+void* QGraphicsLineItem_Line(void* ptr)
+{
+	return ({ QLineF tmpValue = static_cast<QGraphicsLineItem*>(ptr)->line(); new QLineF(tmpValue.p1(), tmpValue.p2()); });
+}
+
+void* QGraphicsLineItem_Pen(void* ptr)
+{
+	return new QPen(static_cast<QGraphicsLineItem*>(ptr)->pen());
+}
+
+void* QGraphicsLineItem_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsLineItem*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsLineItem_BoundingRectDefault(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsLineItem*>(ptr)->QGraphicsLineItem::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+class MyQGraphicsLinearLayout: public QGraphicsLinearLayout
+{
+public:
+	MyQGraphicsLinearLayout(QGraphicsLayoutItem *parent) : QGraphicsLinearLayout(parent) {};
+	MyQGraphicsLinearLayout(Qt::Orientation orientation, QGraphicsLayoutItem *parent) : QGraphicsLinearLayout(orientation, parent) {};
+	void invalidate() { callbackQGraphicsLayout_Invalidate(this); };
+	void removeAt(int index) { callbackQGraphicsLinearLayout_RemoveAt(this, index); };
+	void setGeometry(const QRectF & rect) { callbackQGraphicsLayoutItem_SetGeometry(this, const_cast<QRectF*>(&rect)); };
+	 ~MyQGraphicsLinearLayout() { callbackQGraphicsLinearLayout_DestroyQGraphicsLinearLayout(this); };
+	QGraphicsLayoutItem * itemAt(int index) const { return static_cast<QGraphicsLayoutItem*>(callbackQGraphicsLinearLayout_ItemAt(const_cast<void*>(static_cast<const void*>(this)), index)); };
+	QSizeF sizeHint(Qt::SizeHint which, const QSizeF & constraint) const { return *static_cast<QSizeF*>(callbackQGraphicsLinearLayout_SizeHint(const_cast<void*>(static_cast<const void*>(this)), which, const_cast<QSizeF*>(&constraint))); };
+	int count() const { return callbackQGraphicsLinearLayout_Count(const_cast<void*>(static_cast<const void*>(this))); };
+	void updateGeometry() { callbackQGraphicsLayoutItem_UpdateGeometry(this); };
+	void widgetEvent(QEvent * e) { callbackQGraphicsLayout_WidgetEvent(this, e); };
+	void getContentsMargins(qreal * left, qreal * top, qreal * right, qreal * bottom) const { callbackQGraphicsLayoutItem_GetContentsMargins(const_cast<void*>(static_cast<const void*>(this)), *left, *top, *right, *bottom); };
+};
+
+void* QGraphicsLinearLayout_NewQGraphicsLinearLayout(void* parent)
+{
+	return new MyQGraphicsLinearLayout(static_cast<QGraphicsLayoutItem*>(parent));
+}
+
+void* QGraphicsLinearLayout_NewQGraphicsLinearLayout2(long long orientation, void* parent)
+{
+	return new MyQGraphicsLinearLayout(static_cast<Qt::Orientation>(orientation), static_cast<QGraphicsLayoutItem*>(parent));
+}
+
+void QGraphicsLinearLayout_AddItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->addItem(static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsLinearLayout*>(ptr)->addItem(static_cast<QGraphicsLayoutItem*>(item));
+	}
+}
+
+void QGraphicsLinearLayout_AddStretch(void* ptr, int stretch)
+{
+	static_cast<QGraphicsLinearLayout*>(ptr)->addStretch(stretch);
+}
+
+void QGraphicsLinearLayout_InsertItem(void* ptr, int index, void* item)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->insertItem(index, static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsLinearLayout*>(ptr)->insertItem(index, static_cast<QGraphicsLayoutItem*>(item));
+	}
+}
+
+void QGraphicsLinearLayout_InsertStretch(void* ptr, int index, int stretch)
+{
+	static_cast<QGraphicsLinearLayout*>(ptr)->insertStretch(index, stretch);
+}
+
+void QGraphicsLinearLayout_RemoveAt(void* ptr, int index)
+{
+	static_cast<QGraphicsLinearLayout*>(ptr)->removeAt(index);
+}
+
+void QGraphicsLinearLayout_RemoveAtDefault(void* ptr, int index)
+{
+		static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::removeAt(index);
+}
+
+void QGraphicsLinearLayout_RemoveItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->removeItem(static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsLinearLayout*>(ptr)->removeItem(static_cast<QGraphicsLayoutItem*>(item));
+	}
+}
+
+void QGraphicsLinearLayout_SetAlignment(void* ptr, void* item, long long alignment)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->setAlignment(static_cast<QGraphicsWidget*>(item), static_cast<Qt::AlignmentFlag>(alignment));
+	} else {
+		static_cast<QGraphicsLinearLayout*>(ptr)->setAlignment(static_cast<QGraphicsLayoutItem*>(item), static_cast<Qt::AlignmentFlag>(alignment));
+	}
+}
+
+void QGraphicsLinearLayout_SetItemSpacing(void* ptr, int index, double spacing)
+{
+	static_cast<QGraphicsLinearLayout*>(ptr)->setItemSpacing(index, spacing);
+}
+
+void QGraphicsLinearLayout_SetOrientation(void* ptr, long long orientation)
+{
+	static_cast<QGraphicsLinearLayout*>(ptr)->setOrientation(static_cast<Qt::Orientation>(orientation));
+}
+
+void QGraphicsLinearLayout_SetSpacing(void* ptr, double spacing)
+{
+	static_cast<QGraphicsLinearLayout*>(ptr)->setSpacing(spacing);
+}
+
+void QGraphicsLinearLayout_SetStretchFactor(void* ptr, void* item, int stretch)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsLinearLayout*>(ptr)->setStretchFactor(static_cast<QGraphicsWidget*>(item), stretch);
+	} else {
+		static_cast<QGraphicsLinearLayout*>(ptr)->setStretchFactor(static_cast<QGraphicsLayoutItem*>(item), stretch);
+	}
+}
+
+void QGraphicsLinearLayout_DestroyQGraphicsLinearLayout(void* ptr)
+{
+	static_cast<QGraphicsLinearLayout*>(ptr)->~QGraphicsLinearLayout();
+}
+
+void QGraphicsLinearLayout_DestroyQGraphicsLinearLayoutDefault(void* ptr)
+{
+
+}
+
+void* QGraphicsLinearLayout_ItemAt(void* ptr, int index)
+{
+	return static_cast<QGraphicsLinearLayout*>(ptr)->itemAt(index);
+}
+
+void* QGraphicsLinearLayout_ItemAtDefault(void* ptr, int index)
+{
+		return static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::itemAt(index);
+}
+
+void* QGraphicsLinearLayout_SizeHint(void* ptr, long long which, void* constraint)
+{
+	return ({ QSizeF tmpValue = static_cast<QGraphicsLinearLayout*>(ptr)->sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsLinearLayout_SizeHintDefault(void* ptr, long long which, void* constraint)
+{
+		return ({ QSizeF tmpValue = static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+long long QGraphicsLinearLayout_Alignment(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		return static_cast<QGraphicsLinearLayout*>(ptr)->alignment(static_cast<QGraphicsWidget*>(item));
+	} else {
+		return static_cast<QGraphicsLinearLayout*>(ptr)->alignment(static_cast<QGraphicsLayoutItem*>(item));
+	}
+}
+
+long long QGraphicsLinearLayout_Orientation(void* ptr)
+{
+	return static_cast<QGraphicsLinearLayout*>(ptr)->orientation();
+}
+
+int QGraphicsLinearLayout_Count(void* ptr)
+{
+	return static_cast<QGraphicsLinearLayout*>(ptr)->count();
+}
+
+int QGraphicsLinearLayout_CountDefault(void* ptr)
+{
+		return static_cast<QGraphicsLinearLayout*>(ptr)->QGraphicsLinearLayout::count();
+}
+
+int QGraphicsLinearLayout_StretchFactor(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		return static_cast<QGraphicsLinearLayout*>(ptr)->stretchFactor(static_cast<QGraphicsWidget*>(item));
+	} else {
+		return static_cast<QGraphicsLinearLayout*>(ptr)->stretchFactor(static_cast<QGraphicsLayoutItem*>(item));
+	}
+}
+
+double QGraphicsLinearLayout_ItemSpacing(void* ptr, int index)
+{
+	return static_cast<QGraphicsLinearLayout*>(ptr)->itemSpacing(index);
+}
+
+double QGraphicsLinearLayout_Spacing(void* ptr)
+{
+	return static_cast<QGraphicsLinearLayout*>(ptr)->spacing();
+}
+
+class MyQGraphicsObject: public QGraphicsObject
+{
+public:
+	MyQGraphicsObject(QGraphicsItem *parent) : QGraphicsObject(parent) {};
+	bool event(QEvent * ev) { return callbackQGraphicsObject_Event(this, ev) != 0; };
+	void Signal_EnabledChanged() { callbackQGraphicsObject_EnabledChanged(this); };
+	void Signal_OpacityChanged() { callbackQGraphicsObject_OpacityChanged(this); };
+	void Signal_ParentChanged() { callbackQGraphicsObject_ParentChanged(this); };
+	void Signal_RotationChanged() { callbackQGraphicsObject_RotationChanged(this); };
+	void Signal_ScaleChanged() { callbackQGraphicsObject_ScaleChanged(this); };
+	void updateMicroFocus() { callbackQGraphicsObject_UpdateMicroFocus(this); };
+	void Signal_VisibleChanged() { callbackQGraphicsObject_VisibleChanged(this); };
+	void Signal_XChanged() { callbackQGraphicsObject_XChanged(this); };
+	void Signal_YChanged() { callbackQGraphicsObject_YChanged(this); };
+	void Signal_ZChanged() { callbackQGraphicsObject_ZChanged(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsObject_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsObject_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+};
+
+void* QGraphicsObject_NewQGraphicsObject(void* parent)
+{
+	return new MyQGraphicsObject(static_cast<QGraphicsItem*>(parent));
+}
+
+char QGraphicsObject_Event(void* ptr, void* ev)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->event(static_cast<QEvent*>(ev));
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->event(static_cast<QEvent*>(ev));
+	}
+}
+
+char QGraphicsObject_EventDefault(void* ptr, void* ev)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::event(static_cast<QEvent*>(ev));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::event(static_cast<QEvent*>(ev));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::event(static_cast<QEvent*>(ev));
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::event(static_cast<QEvent*>(ev));
+	}
+}
+
+void QGraphicsObject_ConnectEnabledChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::enabledChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_EnabledChanged));
+}
+
+void QGraphicsObject_DisconnectEnabledChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::enabledChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_EnabledChanged));
+}
+
+void QGraphicsObject_EnabledChanged(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->enabledChanged();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->enabledChanged();
+	}
+}
+
+void QGraphicsObject_GrabGesture(void* ptr, long long gesture, long long flags)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->grabGesture(static_cast<Qt::GestureType>(gesture), static_cast<Qt::GestureFlag>(flags));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->grabGesture(static_cast<Qt::GestureType>(gesture), static_cast<Qt::GestureFlag>(flags));
+	}
+}
+
+void QGraphicsObject_ConnectOpacityChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::opacityChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_OpacityChanged));
+}
+
+void QGraphicsObject_DisconnectOpacityChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::opacityChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_OpacityChanged));
+}
+
+void QGraphicsObject_OpacityChanged(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->opacityChanged();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->opacityChanged();
+	}
+}
+
+void QGraphicsObject_ConnectParentChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::parentChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_ParentChanged));
+}
+
+void QGraphicsObject_DisconnectParentChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::parentChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_ParentChanged));
+}
+
+void QGraphicsObject_ParentChanged(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->parentChanged();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->parentChanged();
+	}
+}
+
+void QGraphicsObject_ConnectRotationChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::rotationChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_RotationChanged));
+}
+
+void QGraphicsObject_DisconnectRotationChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::rotationChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_RotationChanged));
+}
+
+void QGraphicsObject_RotationChanged(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->rotationChanged();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->rotationChanged();
+	}
+}
+
+void QGraphicsObject_ConnectScaleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::scaleChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_ScaleChanged));
+}
+
+void QGraphicsObject_DisconnectScaleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::scaleChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_ScaleChanged));
+}
+
+void QGraphicsObject_ScaleChanged(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->scaleChanged();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->scaleChanged();
+	}
+}
+
+void QGraphicsObject_UngrabGesture(void* ptr, long long gesture)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->ungrabGesture(static_cast<Qt::GestureType>(gesture));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->ungrabGesture(static_cast<Qt::GestureType>(gesture));
+	}
+}
+
+void QGraphicsObject_UpdateMicroFocus(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QGraphicsWidget*>(ptr), "updateMicroFocus");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QGraphicsObject*>(ptr), "updateMicroFocus");
+	}
+}
+
+void QGraphicsObject_UpdateMicroFocusDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::updateMicroFocus();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::updateMicroFocus();
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::updateMicroFocus();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::updateMicroFocus();
+	}
+}
+
+void QGraphicsObject_ConnectVisibleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::visibleChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_VisibleChanged));
+}
+
+void QGraphicsObject_DisconnectVisibleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::visibleChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_VisibleChanged));
+}
+
+void QGraphicsObject_VisibleChanged(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->visibleChanged();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->visibleChanged();
+	}
+}
+
+void QGraphicsObject_ConnectXChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::xChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_XChanged));
+}
+
+void QGraphicsObject_DisconnectXChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::xChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_XChanged));
+}
+
+void QGraphicsObject_XChanged(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->xChanged();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->xChanged();
+	}
+}
+
+void QGraphicsObject_ConnectYChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::yChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_YChanged));
+}
+
+void QGraphicsObject_DisconnectYChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::yChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_YChanged));
+}
+
+void QGraphicsObject_YChanged(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->yChanged();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->yChanged();
+	}
+}
+
+void QGraphicsObject_ConnectZChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::zChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_ZChanged));
+}
+
+void QGraphicsObject_DisconnectZChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsObject*>(ptr), static_cast<void (QGraphicsObject::*)()>(&QGraphicsObject::zChanged), static_cast<MyQGraphicsObject*>(ptr), static_cast<void (MyQGraphicsObject::*)()>(&MyQGraphicsObject::Signal_ZChanged));
+}
+
+void QGraphicsObject_ZChanged(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->zChanged();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->zChanged();
+	}
+}
+
+void QGraphicsObject_DestroyQGraphicsObject(void* ptr)
+{
+	static_cast<QGraphicsObject*>(ptr)->~QGraphicsObject();
+}
+
+void* QGraphicsObject_GraphicsEffect(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->graphicsEffect();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->graphicsEffect();
+	}
+}
+
+void QGraphicsObject_SetGraphicsEffect(void* ptr, void* effect)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setGraphicsEffect(static_cast<QGraphicsEffect*>(effect));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setGraphicsEffect(static_cast<QGraphicsEffect*>(effect));
+	}
+}
+
+char QGraphicsObject_IsEnabled(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isEnabled();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->isEnabled();
+	}
+}
+
+void QGraphicsObject_SetEnabled(void* ptr, char enabled)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setEnabled(enabled != 0);
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setEnabled(enabled != 0);
+	}
+}
+
+double QGraphicsObject_Opacity(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->opacity();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->opacity();
+	}
+}
+
+void QGraphicsObject_SetOpacity(void* ptr, double opacity)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setOpacity(opacity);
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setOpacity(opacity);
+	}
+}
+
+void* QGraphicsObject_Parent(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->parent();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->parent();
+	}
+}
+
+void QGraphicsObject_SetParent(void* ptr, void* parent)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(parent))) {
+			static_cast<QGraphicsWidget*>(ptr)->setParent(static_cast<QGraphicsWidget*>(parent));
+		} else {
+			static_cast<QGraphicsWidget*>(ptr)->setParent(static_cast<QGraphicsObject*>(parent));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(parent))) {
+			static_cast<QGraphicsObject*>(ptr)->setParent(static_cast<QGraphicsWidget*>(parent));
+		} else {
+			static_cast<QGraphicsObject*>(ptr)->setParent(static_cast<QGraphicsObject*>(parent));
+		}
+	}
+}
+
+void* QGraphicsObject_Pos(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void QGraphicsObject_SetPos(void* ptr, void* pos)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setPos(*static_cast<QPointF*>(pos));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setPos(*static_cast<QPointF*>(pos));
+	}
+}
+
+double QGraphicsObject_Rotation(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->rotation();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->rotation();
+	}
+}
+
+void QGraphicsObject_SetRotation(void* ptr, double rotation)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setRotation(rotation);
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setRotation(rotation);
+	}
+}
+
+double QGraphicsObject_Scale(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->scale();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->scale();
+	}
+}
+
+void QGraphicsObject_SetScale(void* ptr, double scale)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setScale(scale);
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setScale(scale);
+	}
+}
+
+void* QGraphicsObject_TransformOriginPoint(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QPointF tmpValue = static_cast<QGraphicsWidget*>(ptr)->transformOriginPoint(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	} else {
+		return ({ QPointF tmpValue = static_cast<QGraphicsObject*>(ptr)->transformOriginPoint(); new QPointF(tmpValue.x(), tmpValue.y()); });
+	}
+}
+
+void QGraphicsObject_SetTransformOriginPoint(void* ptr, void* transformOriginPoint)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setTransformOriginPoint(*static_cast<QPointF*>(transformOriginPoint));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setTransformOriginPoint(*static_cast<QPointF*>(transformOriginPoint));
+	}
+}
+
+char QGraphicsObject_IsVisible(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->isVisible();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->isVisible();
+	}
+}
+
+void QGraphicsObject_SetVisible(void* ptr, char visible)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setVisible(visible != 0);
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setVisible(visible != 0);
+	}
+}
+
+double QGraphicsObject_X(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->x();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->x();
+	}
+}
+
+void QGraphicsObject_SetX(void* ptr, double x)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setX(x);
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setX(x);
+	}
+}
+
+double QGraphicsObject_Y(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->y();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->y();
+	}
+}
+
+void QGraphicsObject_SetY(void* ptr, double y)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setY(y);
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setY(y);
+	}
+}
+
+double QGraphicsObject_ZValue(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsWidget*>(ptr)->zValue();
+	} else {
+		return static_cast<QGraphicsObject*>(ptr)->zValue();
+	}
+}
+
+void QGraphicsObject_SetZValue(void* ptr, double z)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->setZValue(z);
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->setZValue(z);
+	}
+}
+
+void* QGraphicsObject___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+	} else {
+		return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsObject___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+	} else {
+		static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+	}
+}
+
+void* QGraphicsObject___dynamicPropertyNames_newList(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QByteArray>;
+	} else {
+		return new QList<QByteArray>;
+	}
+}
+
+void* QGraphicsObject___findChildren_atList2(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	} else {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsObject___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	}
+}
+
+void* QGraphicsObject___findChildren_newList2(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QObject*>;
+	} else {
+		return new QList<QObject*>;
+	}
+}
+
+void* QGraphicsObject___findChildren_atList3(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	} else {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsObject___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	}
+}
+
+void* QGraphicsObject___findChildren_newList3(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QObject*>;
+	} else {
+		return new QList<QObject*>;
+	}
+}
+
+void* QGraphicsObject___findChildren_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	} else {
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsObject___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+		} else {
+			static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	}
+}
+
+void* QGraphicsObject___findChildren_newList(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QObject*>;
+	} else {
+		return new QList<QObject*>;
+	}
+}
+
+void* QGraphicsObject___children_atList(void* ptr, int i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+	} else {
+		return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+	}
+}
+
+void QGraphicsObject___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+		} else {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+		} else {
+			static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+		}
+	}
+}
+
+void* QGraphicsObject___children_newList(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return new QList<QObject *>;
+	} else {
+		return new QList<QObject *>;
+	}
+}
+
+char QGraphicsObject_EventFilter(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+char QGraphicsObject_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QGraphicsObject_ChildEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QGraphicsObject_ChildEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QGraphicsObject_ConnectNotify(void* ptr, void* sign)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGraphicsObject_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGraphicsObject_CustomEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsObject_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsObject_DeleteLater(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		QMetaObject::invokeMethod(static_cast<QGraphicsWidget*>(ptr), "deleteLater");
+	} else {
+		QMetaObject::invokeMethod(static_cast<QGraphicsObject*>(ptr), "deleteLater");
+	}
+}
+
+void QGraphicsObject_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::deleteLater();
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::deleteLater();
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::deleteLater();
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::deleteLater();
+	}
+}
+
+void QGraphicsObject_DisconnectNotify(void* ptr, void* sign)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGraphicsObject_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGraphicsObject_TimerEvent(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void QGraphicsObject_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void* QGraphicsObject_MetaObject(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsWidget*>(ptr)->metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsObject*>(ptr)->metaObject());
+	}
+}
+
+void* QGraphicsObject_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::metaObject());
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::metaObject());
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsObject*>(ptr)->QGraphicsObject::metaObject());
+	}
+}
+
+void QGraphicsObject_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	} else {
+	
+	}
+}
+
+void QGraphicsObject_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	} else {
+	
+	}
+}
+
+void* QGraphicsObject_BoundingRect(void* ptr)
+{
+	if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+	
+	}
+}
+
+void* QGraphicsObject_BoundingRectDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGraphicsTextItem*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+	
+	}
+}
+
+class MyQGraphicsOpacityEffect: public QGraphicsOpacityEffect
+{
+public:
+	MyQGraphicsOpacityEffect(QObject *parent) : QGraphicsOpacityEffect(parent) {};
+	void draw(QPainter * painter) { callbackQGraphicsOpacityEffect_Draw(this, painter); };
+	void Signal_OpacityChanged(qreal opacity) { callbackQGraphicsOpacityEffect_OpacityChanged(this, opacity); };
+	void Signal_OpacityMaskChanged(const QBrush & mask) { callbackQGraphicsOpacityEffect_OpacityMaskChanged(this, const_cast<QBrush*>(&mask)); };
+	void setOpacity(qreal opacity) { callbackQGraphicsOpacityEffect_SetOpacity(this, opacity); };
+	void setOpacityMask(const QBrush & mask) { callbackQGraphicsOpacityEffect_SetOpacityMask(this, const_cast<QBrush*>(&mask)); };
+	void Signal_EnabledChanged(bool enabled) { callbackQGraphicsEffect_EnabledChanged(this, enabled); };
+	void setEnabled(bool enable) { callbackQGraphicsEffect_SetEnabled(this, enable); };
+	void sourceChanged(QGraphicsEffect::ChangeFlags flags) { callbackQGraphicsEffect_SourceChanged(this, flags); };
+	void update() { callbackQGraphicsEffect_Update(this); };
+	QRectF boundingRectFor(const QRectF & rect) const { return *static_cast<QRectF*>(callbackQGraphicsEffect_BoundingRectFor(const_cast<void*>(static_cast<const void*>(this)), const_cast<QRectF*>(&rect))); };
+	bool event(QEvent * e) { return callbackQGraphicsEffect_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsEffect_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsEffect_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsEffect_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsEffect_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsEffect_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsEffect_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsEffect_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsEffect_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsEffect_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGraphicsOpacityEffect_NewQGraphicsOpacityEffect(void* parent)
+{
+	return new MyQGraphicsOpacityEffect(static_cast<QObject*>(parent));
+}
+
+void QGraphicsOpacityEffect_Draw(void* ptr, void* painter)
+{
+	static_cast<QGraphicsOpacityEffect*>(ptr)->draw(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsOpacityEffect_DrawDefault(void* ptr, void* painter)
+{
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::draw(static_cast<QPainter*>(painter));
+}
+
+void QGraphicsOpacityEffect_ConnectOpacityChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsOpacityEffect*>(ptr), static_cast<void (QGraphicsOpacityEffect::*)(qreal)>(&QGraphicsOpacityEffect::opacityChanged), static_cast<MyQGraphicsOpacityEffect*>(ptr), static_cast<void (MyQGraphicsOpacityEffect::*)(qreal)>(&MyQGraphicsOpacityEffect::Signal_OpacityChanged));
+}
+
+void QGraphicsOpacityEffect_DisconnectOpacityChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsOpacityEffect*>(ptr), static_cast<void (QGraphicsOpacityEffect::*)(qreal)>(&QGraphicsOpacityEffect::opacityChanged), static_cast<MyQGraphicsOpacityEffect*>(ptr), static_cast<void (MyQGraphicsOpacityEffect::*)(qreal)>(&MyQGraphicsOpacityEffect::Signal_OpacityChanged));
+}
+
+void QGraphicsOpacityEffect_OpacityChanged(void* ptr, double opacity)
+{
+	static_cast<QGraphicsOpacityEffect*>(ptr)->opacityChanged(opacity);
+}
+
+void QGraphicsOpacityEffect_ConnectOpacityMaskChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsOpacityEffect*>(ptr), static_cast<void (QGraphicsOpacityEffect::*)(const QBrush &)>(&QGraphicsOpacityEffect::opacityMaskChanged), static_cast<MyQGraphicsOpacityEffect*>(ptr), static_cast<void (MyQGraphicsOpacityEffect::*)(const QBrush &)>(&MyQGraphicsOpacityEffect::Signal_OpacityMaskChanged));
+}
+
+void QGraphicsOpacityEffect_DisconnectOpacityMaskChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsOpacityEffect*>(ptr), static_cast<void (QGraphicsOpacityEffect::*)(const QBrush &)>(&QGraphicsOpacityEffect::opacityMaskChanged), static_cast<MyQGraphicsOpacityEffect*>(ptr), static_cast<void (MyQGraphicsOpacityEffect::*)(const QBrush &)>(&MyQGraphicsOpacityEffect::Signal_OpacityMaskChanged));
+}
+
+void QGraphicsOpacityEffect_OpacityMaskChanged(void* ptr, void* mask)
+{
+	static_cast<QGraphicsOpacityEffect*>(ptr)->opacityMaskChanged(*static_cast<QBrush*>(mask));
+}
+
+void QGraphicsOpacityEffect_SetOpacity(void* ptr, double opacity)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsOpacityEffect*>(ptr), "setOpacity", Q_ARG(qreal, opacity));
+}
+
+void QGraphicsOpacityEffect_SetOpacityDefault(void* ptr, double opacity)
+{
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::setOpacity(opacity);
+}
+
+void QGraphicsOpacityEffect_SetOpacityMask(void* ptr, void* mask)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsOpacityEffect*>(ptr), "setOpacityMask", Q_ARG(QBrush, *static_cast<QBrush*>(mask)));
+}
+
+void QGraphicsOpacityEffect_SetOpacityMaskDefault(void* ptr, void* mask)
+{
+		static_cast<QGraphicsOpacityEffect*>(ptr)->QGraphicsOpacityEffect::setOpacityMask(*static_cast<QBrush*>(mask));
+}
+
+void QGraphicsOpacityEffect_DestroyQGraphicsOpacityEffect(void* ptr)
+{
+	static_cast<QGraphicsOpacityEffect*>(ptr)->~QGraphicsOpacityEffect();
+}
+
+void* QGraphicsOpacityEffect_OpacityMask(void* ptr)
+{
+	return new QBrush(static_cast<QGraphicsOpacityEffect*>(ptr)->opacityMask());
+}
+
+double QGraphicsOpacityEffect_Opacity(void* ptr)
+{
+	return static_cast<QGraphicsOpacityEffect*>(ptr)->opacity();
+}
+
+class MyQGraphicsPathItem: public QGraphicsPathItem
+{
+public:
+	MyQGraphicsPathItem(QGraphicsItem *parent) : QGraphicsPathItem(parent) {};
+	MyQGraphicsPathItem(const QPainterPath &path, QGraphicsItem *parent) : QGraphicsPathItem(path, parent) {};
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsPathItem_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsPathItem_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+};
+
+void* QGraphicsPathItem_NewQGraphicsPathItem(void* parent)
+{
+	return new MyQGraphicsPathItem(static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsPathItem_NewQGraphicsPathItem2(void* path, void* parent)
+{
+	return new MyQGraphicsPathItem(*static_cast<QPainterPath*>(path), static_cast<QGraphicsItem*>(parent));
+}
+
+void QGraphicsPathItem_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsPathItem*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsPathItem_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsPathItem_SetPath(void* ptr, void* path)
+{
+	static_cast<QGraphicsPathItem*>(ptr)->setPath(*static_cast<QPainterPath*>(path));
+}
+
+void QGraphicsPathItem_DestroyQGraphicsPathItem(void* ptr)
+{
+	static_cast<QGraphicsPathItem*>(ptr)->~QGraphicsPathItem();
+}
+
+void* QGraphicsPathItem_Path(void* ptr)
+{
+	return new QPainterPath(static_cast<QGraphicsPathItem*>(ptr)->path());
+}
+
+void* QGraphicsPathItem_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsPathItem*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsPathItem_BoundingRectDefault(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsPathItem*>(ptr)->QGraphicsPathItem::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+class MyQGraphicsPixmapItem: public QGraphicsPixmapItem
+{
+public:
+	MyQGraphicsPixmapItem(QGraphicsItem *parent) : QGraphicsPixmapItem(parent) {};
+	MyQGraphicsPixmapItem(const QPixmap &pixmap, QGraphicsItem *parent) : QGraphicsPixmapItem(pixmap, parent) {};
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsPixmapItem_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsPixmapItem_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+};
+
+void* QGraphicsPixmapItem_NewQGraphicsPixmapItem(void* parent)
+{
+	return new MyQGraphicsPixmapItem(static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsPixmapItem_NewQGraphicsPixmapItem2(void* pixmap, void* parent)
+{
+	return new MyQGraphicsPixmapItem(*static_cast<QPixmap*>(pixmap), static_cast<QGraphicsItem*>(parent));
+}
+
+void QGraphicsPixmapItem_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsPixmapItem*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsPixmapItem_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsPixmapItem_SetOffset(void* ptr, void* offset)
+{
+	static_cast<QGraphicsPixmapItem*>(ptr)->setOffset(*static_cast<QPointF*>(offset));
+}
+
+void QGraphicsPixmapItem_SetOffset2(void* ptr, double x, double y)
+{
+	static_cast<QGraphicsPixmapItem*>(ptr)->setOffset(x, y);
+}
+
+void QGraphicsPixmapItem_SetPixmap(void* ptr, void* pixmap)
+{
+	static_cast<QGraphicsPixmapItem*>(ptr)->setPixmap(*static_cast<QPixmap*>(pixmap));
+}
+
+void QGraphicsPixmapItem_SetShapeMode(void* ptr, long long mode)
+{
+	static_cast<QGraphicsPixmapItem*>(ptr)->setShapeMode(static_cast<QGraphicsPixmapItem::ShapeMode>(mode));
+}
+
+void QGraphicsPixmapItem_SetTransformationMode(void* ptr, long long mode)
+{
+	static_cast<QGraphicsPixmapItem*>(ptr)->setTransformationMode(static_cast<Qt::TransformationMode>(mode));
+}
+
+void QGraphicsPixmapItem_DestroyQGraphicsPixmapItem(void* ptr)
+{
+	static_cast<QGraphicsPixmapItem*>(ptr)->~QGraphicsPixmapItem();
+}
+
+void* QGraphicsPixmapItem_Pixmap(void* ptr)
+{
+	return new QPixmap(static_cast<QGraphicsPixmapItem*>(ptr)->pixmap());
+}
+
+void* QGraphicsPixmapItem_Offset(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsPixmapItem*>(ptr)->offset(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsPixmapItem_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsPixmapItem*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsPixmapItem_BoundingRectDefault(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsPixmapItem*>(ptr)->QGraphicsPixmapItem::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+long long QGraphicsPixmapItem_TransformationMode(void* ptr)
+{
+	return static_cast<QGraphicsPixmapItem*>(ptr)->transformationMode();
+}
+
+long long QGraphicsPixmapItem_ShapeMode(void* ptr)
+{
+	return static_cast<QGraphicsPixmapItem*>(ptr)->shapeMode();
+}
+
+class MyQGraphicsPolygonItem: public QGraphicsPolygonItem
+{
+public:
+	MyQGraphicsPolygonItem(QGraphicsItem *parent) : QGraphicsPolygonItem(parent) {};
+	MyQGraphicsPolygonItem(const QPolygonF &polygon, QGraphicsItem *parent) : QGraphicsPolygonItem(polygon, parent) {};
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsPolygonItem_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsPolygonItem_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+};
+
+void* QGraphicsPolygonItem_NewQGraphicsPolygonItem(void* parent)
+{
+	return new MyQGraphicsPolygonItem(static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsPolygonItem_NewQGraphicsPolygonItem2(void* polygon, void* parent)
+{
+	return new MyQGraphicsPolygonItem(*static_cast<QPolygonF*>(polygon), static_cast<QGraphicsItem*>(parent));
+}
+
+void QGraphicsPolygonItem_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsPolygonItem*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsPolygonItem_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsPolygonItem_SetFillRule(void* ptr, long long rule)
+{
+	static_cast<QGraphicsPolygonItem*>(ptr)->setFillRule(static_cast<Qt::FillRule>(rule));
+}
+
+void QGraphicsPolygonItem_SetPolygon(void* ptr, void* polygon)
+{
+	static_cast<QGraphicsPolygonItem*>(ptr)->setPolygon(*static_cast<QPolygonF*>(polygon));
+}
+
+void QGraphicsPolygonItem_DestroyQGraphicsPolygonItem(void* ptr)
+{
+	static_cast<QGraphicsPolygonItem*>(ptr)->~QGraphicsPolygonItem();
+}
+
+void* QGraphicsPolygonItem_Polygon(void* ptr)
+{
+	return new QPolygonF(static_cast<QGraphicsPolygonItem*>(ptr)->polygon());
+}
+
+void* QGraphicsPolygonItem_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsPolygonItem*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsPolygonItem_BoundingRectDefault(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsPolygonItem*>(ptr)->QGraphicsPolygonItem::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+long long QGraphicsPolygonItem_FillRule(void* ptr)
+{
+	return static_cast<QGraphicsPolygonItem*>(ptr)->fillRule();
+}
+
+class MyQGraphicsProxyWidget: public QGraphicsProxyWidget
+{
+public:
+	MyQGraphicsProxyWidget(QGraphicsItem *parent, Qt::WindowFlags wFlags) : QGraphicsProxyWidget(parent, wFlags) {};
+	QGraphicsProxyWidget * newProxyWidget(const QWidget * child) { return static_cast<QGraphicsProxyWidget*>(callbackQGraphicsProxyWidget_NewProxyWidget(this, const_cast<QWidget*>(child))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool event(QEvent * event) { return callbackQGraphicsObject_Event(this, event) != 0; };
+	bool eventFilter(QObject * object, QEvent * event) { return callbackQGraphicsObject_EventFilter(this, object, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQGraphicsWidget_FocusNextPrevChild(this, next) != 0; };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void grabMouseEvent(QEvent * event) { callbackQGraphicsWidget_GrabMouseEvent(this, event); };
+	void hideEvent(QHideEvent * event) { callbackQGraphicsWidget_HideEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsWidget_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	void resizeEvent(QGraphicsSceneResizeEvent * event) { callbackQGraphicsWidget_ResizeEvent(this, event); };
+	void setGeometry(const QRectF & rect) { callbackQGraphicsLayoutItem_SetGeometry(this, const_cast<QRectF*>(&rect)); };
+	void showEvent(QShowEvent * event) { callbackQGraphicsWidget_ShowEvent(this, event); };
+	void ungrabMouseEvent(QEvent * event) { callbackQGraphicsWidget_UngrabMouseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QSizeF sizeHint(Qt::SizeHint which, const QSizeF & constraint) const { return *static_cast<QSizeF*>(callbackQGraphicsWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)), which, const_cast<QSizeF*>(&constraint))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	bool close() { return callbackQGraphicsWidget_Close(this) != 0; };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool windowFrameEvent(QEvent * event) { return callbackQGraphicsWidget_WindowFrameEvent(this, event) != 0; };
+	void changeEvent(QEvent * event) { callbackQGraphicsWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQGraphicsWidget_CloseEvent(this, event); };
+	void Signal_GeometryChanged() { callbackQGraphicsWidget_GeometryChanged(this); };
+	void grabKeyboardEvent(QEvent * event) { callbackQGraphicsWidget_GrabKeyboardEvent(this, event); };
+	void moveEvent(QGraphicsSceneMoveEvent * event) { callbackQGraphicsWidget_MoveEvent(this, event); };
+	void paintWindowFrame(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsWidget_PaintWindowFrame(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	void polishEvent() { callbackQGraphicsWidget_PolishEvent(this); };
+	void ungrabKeyboardEvent(QEvent * event) { callbackQGraphicsWidget_UngrabKeyboardEvent(this, event); };
+	void updateGeometry() { callbackQGraphicsLayoutItem_UpdateGeometry(this); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsWidget_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::WindowFrameSection windowFrameSectionAt(const QPointF & pos) const { return static_cast<Qt::WindowFrameSection>(callbackQGraphicsWidget_WindowFrameSectionAt(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&pos))); };
+	void getContentsMargins(qreal * left, qreal * top, qreal * right, qreal * bottom) const { callbackQGraphicsLayoutItem_GetContentsMargins(const_cast<void*>(static_cast<const void*>(this)), *left, *top, *right, *bottom); };
+	void initStyleOption(QStyleOption * option) const { callbackQGraphicsWidget_InitStyleOption(const_cast<void*>(static_cast<const void*>(this)), option); };
+	void Signal_EnabledChanged() { callbackQGraphicsObject_EnabledChanged(this); };
+	void Signal_OpacityChanged() { callbackQGraphicsObject_OpacityChanged(this); };
+	void Signal_ParentChanged() { callbackQGraphicsObject_ParentChanged(this); };
+	void Signal_RotationChanged() { callbackQGraphicsObject_RotationChanged(this); };
+	void Signal_ScaleChanged() { callbackQGraphicsObject_ScaleChanged(this); };
+	void updateMicroFocus() { callbackQGraphicsObject_UpdateMicroFocus(this); };
+	void Signal_VisibleChanged() { callbackQGraphicsObject_VisibleChanged(this); };
+	void Signal_XChanged() { callbackQGraphicsObject_XChanged(this); };
+	void Signal_YChanged() { callbackQGraphicsObject_YChanged(this); };
+	void Signal_ZChanged() { callbackQGraphicsObject_ZChanged(this); };
+	void childEvent(QChildEvent * event) { callbackQGraphicsObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+};
+
+void* QGraphicsProxyWidget_CreateProxyForChildWidget(void* ptr, void* child)
+{
+		return static_cast<QGraphicsProxyWidget*>(ptr)->createProxyForChildWidget(static_cast<QWidget*>(child));
+}
+
+void* QGraphicsProxyWidget_NewProxyWidget(void* ptr, void* child)
+{
+		QGraphicsProxyWidget* returnArg;
+	QMetaObject::invokeMethod(static_cast<QGraphicsProxyWidget*>(ptr), "newProxyWidget", Q_RETURN_ARG(QGraphicsProxyWidget*, returnArg), Q_ARG(QWidget*, static_cast<QWidget*>(child)));
+	return returnArg;
+}
+
+void* QGraphicsProxyWidget_NewProxyWidgetDefault(void* ptr, void* child)
+{
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::newProxyWidget(static_cast<QWidget*>(child));
+}
+
+void* QGraphicsProxyWidget_NewQGraphicsProxyWidget(void* parent, long long wFlags)
+{
+	return new MyQGraphicsProxyWidget(static_cast<QGraphicsItem*>(parent), static_cast<Qt::WindowType>(wFlags));
+}
+
+void QGraphicsProxyWidget_SetWidget(void* ptr, void* widget)
+{
+		static_cast<QGraphicsProxyWidget*>(ptr)->setWidget(static_cast<QWidget*>(widget));
+}
+
+void QGraphicsProxyWidget_DestroyQGraphicsProxyWidget(void* ptr)
+{
+	static_cast<QGraphicsProxyWidget*>(ptr)->~QGraphicsProxyWidget();
+}
+
+void* QGraphicsProxyWidget_SubWidgetRect(void* ptr, void* widget)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsProxyWidget*>(ptr)->subWidgetRect(static_cast<QWidget*>(widget)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsProxyWidget_Widget(void* ptr)
+{
+	return static_cast<QGraphicsProxyWidget*>(ptr)->widget();
+}
+
+class MyQGraphicsRectItem: public QGraphicsRectItem
+{
+public:
+	MyQGraphicsRectItem(QGraphicsItem *parent) : QGraphicsRectItem(parent) {};
+	MyQGraphicsRectItem(const QRectF &rect, QGraphicsItem *parent) : QGraphicsRectItem(rect, parent) {};
+	MyQGraphicsRectItem(qreal x, qreal y, qreal width, qreal height, QGraphicsItem *parent) : QGraphicsRectItem(x, y, width, height, parent) {};
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsRectItem_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsRectItem_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+};
+
+void* QGraphicsRectItem_NewQGraphicsRectItem(void* parent)
+{
+	return new MyQGraphicsRectItem(static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsRectItem_NewQGraphicsRectItem2(void* rect, void* parent)
+{
+	return new MyQGraphicsRectItem(*static_cast<QRectF*>(rect), static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsRectItem_NewQGraphicsRectItem3(double x, double y, double width, double height, void* parent)
+{
+	return new MyQGraphicsRectItem(x, y, width, height, static_cast<QGraphicsItem*>(parent));
+}
+
+void QGraphicsRectItem_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsRectItem*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsRectItem_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsRectItem_SetRect(void* ptr, void* rectangle)
+{
+	static_cast<QGraphicsRectItem*>(ptr)->setRect(*static_cast<QRectF*>(rectangle));
+}
+
+void QGraphicsRectItem_SetRect2(void* ptr, double x, double y, double width, double height)
+{
+	static_cast<QGraphicsRectItem*>(ptr)->setRect(x, y, width, height);
+}
+
+void QGraphicsRectItem_DestroyQGraphicsRectItem(void* ptr)
+{
+	static_cast<QGraphicsRectItem*>(ptr)->~QGraphicsRectItem();
+}
+
+void* QGraphicsRectItem_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsRectItem*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsRectItem_BoundingRectDefault(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsRectItem*>(ptr)->QGraphicsRectItem::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsRectItem_Rect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsRectItem*>(ptr)->rect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+class MyQGraphicsRotation: public QGraphicsRotation
+{
+public:
+	MyQGraphicsRotation(QObject *parent) : QGraphicsRotation(parent) {};
+	void Signal_AngleChanged() { callbackQGraphicsRotation_AngleChanged(this); };
+	void Signal_AxisChanged() { callbackQGraphicsRotation_AxisChanged(this); };
+	void Signal_OriginChanged() { callbackQGraphicsRotation_OriginChanged(this); };
+	void applyTo(QMatrix4x4 * matrix) const { callbackQGraphicsRotation_ApplyTo(const_cast<void*>(static_cast<const void*>(this)), matrix); };
+	void update() { callbackQGraphicsTransform_Update(this); };
+	bool event(QEvent * e) { return callbackQGraphicsTransform_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsTransform_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsTransform_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsTransform_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsTransform_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsTransform_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsTransform_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsTransform_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsTransform_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsTransform_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsTransform_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGraphicsRotation_NewQGraphicsRotation(void* parent)
+{
+	return new MyQGraphicsRotation(static_cast<QObject*>(parent));
+}
+
+void QGraphicsRotation_ConnectAngleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsRotation*>(ptr), static_cast<void (QGraphicsRotation::*)()>(&QGraphicsRotation::angleChanged), static_cast<MyQGraphicsRotation*>(ptr), static_cast<void (MyQGraphicsRotation::*)()>(&MyQGraphicsRotation::Signal_AngleChanged));
+}
+
+void QGraphicsRotation_DisconnectAngleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsRotation*>(ptr), static_cast<void (QGraphicsRotation::*)()>(&QGraphicsRotation::angleChanged), static_cast<MyQGraphicsRotation*>(ptr), static_cast<void (MyQGraphicsRotation::*)()>(&MyQGraphicsRotation::Signal_AngleChanged));
+}
+
+void QGraphicsRotation_AngleChanged(void* ptr)
+{
+	static_cast<QGraphicsRotation*>(ptr)->angleChanged();
+}
+
+void QGraphicsRotation_ConnectAxisChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsRotation*>(ptr), static_cast<void (QGraphicsRotation::*)()>(&QGraphicsRotation::axisChanged), static_cast<MyQGraphicsRotation*>(ptr), static_cast<void (MyQGraphicsRotation::*)()>(&MyQGraphicsRotation::Signal_AxisChanged));
+}
+
+void QGraphicsRotation_DisconnectAxisChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsRotation*>(ptr), static_cast<void (QGraphicsRotation::*)()>(&QGraphicsRotation::axisChanged), static_cast<MyQGraphicsRotation*>(ptr), static_cast<void (MyQGraphicsRotation::*)()>(&MyQGraphicsRotation::Signal_AxisChanged));
+}
+
+void QGraphicsRotation_AxisChanged(void* ptr)
+{
+	static_cast<QGraphicsRotation*>(ptr)->axisChanged();
+}
+
+void QGraphicsRotation_ConnectOriginChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsRotation*>(ptr), static_cast<void (QGraphicsRotation::*)()>(&QGraphicsRotation::originChanged), static_cast<MyQGraphicsRotation*>(ptr), static_cast<void (MyQGraphicsRotation::*)()>(&MyQGraphicsRotation::Signal_OriginChanged));
+}
+
+void QGraphicsRotation_DisconnectOriginChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsRotation*>(ptr), static_cast<void (QGraphicsRotation::*)()>(&QGraphicsRotation::originChanged), static_cast<MyQGraphicsRotation*>(ptr), static_cast<void (MyQGraphicsRotation::*)()>(&MyQGraphicsRotation::Signal_OriginChanged));
+}
+
+void QGraphicsRotation_OriginChanged(void* ptr)
+{
+	static_cast<QGraphicsRotation*>(ptr)->originChanged();
+}
+
+void QGraphicsRotation_SetAngle(void* ptr, double vqr)
+{
+	static_cast<QGraphicsRotation*>(ptr)->setAngle(vqr);
+}
+
+void QGraphicsRotation_SetAxis2(void* ptr, long long axis)
+{
+	static_cast<QGraphicsRotation*>(ptr)->setAxis(static_cast<Qt::Axis>(axis));
+}
+
+void QGraphicsRotation_SetAxis(void* ptr, void* axis)
+{
+	static_cast<QGraphicsRotation*>(ptr)->setAxis(*static_cast<QVector3D*>(axis));
+}
+
+void QGraphicsRotation_SetOrigin(void* ptr, void* point)
+{
+	static_cast<QGraphicsRotation*>(ptr)->setOrigin(*static_cast<QVector3D*>(point));
+}
+
+void QGraphicsRotation_DestroyQGraphicsRotation(void* ptr)
+{
+	static_cast<QGraphicsRotation*>(ptr)->~QGraphicsRotation();
+}
+
+void* QGraphicsRotation_Axis(void* ptr)
+{
+	return new QVector3D(static_cast<QGraphicsRotation*>(ptr)->axis());
+}
+
+void* QGraphicsRotation_Origin(void* ptr)
+{
+	return new QVector3D(static_cast<QGraphicsRotation*>(ptr)->origin());
+}
+
+double QGraphicsRotation_Angle(void* ptr)
+{
+	return static_cast<QGraphicsRotation*>(ptr)->angle();
+}
+
+void QGraphicsRotation_ApplyTo(void* ptr, void* matrix)
+{
+	static_cast<QGraphicsRotation*>(ptr)->applyTo(static_cast<QMatrix4x4*>(matrix));
+}
+
+void QGraphicsRotation_ApplyToDefault(void* ptr, void* matrix)
+{
+		static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::applyTo(static_cast<QMatrix4x4*>(matrix));
+}
+
+class MyQGraphicsScale: public QGraphicsScale
+{
+public:
+	MyQGraphicsScale(QObject *parent) : QGraphicsScale(parent) {};
+	void Signal_OriginChanged() { callbackQGraphicsScale_OriginChanged(this); };
+	void Signal_ScaleChanged() { callbackQGraphicsScale_ScaleChanged(this); };
+	void Signal_XScaleChanged() { callbackQGraphicsScale_XScaleChanged(this); };
+	void Signal_YScaleChanged() { callbackQGraphicsScale_YScaleChanged(this); };
+	void Signal_ZScaleChanged() { callbackQGraphicsScale_ZScaleChanged(this); };
+	void applyTo(QMatrix4x4 * matrix) const { callbackQGraphicsScale_ApplyTo(const_cast<void*>(static_cast<const void*>(this)), matrix); };
+	void update() { callbackQGraphicsTransform_Update(this); };
+	bool event(QEvent * e) { return callbackQGraphicsTransform_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsTransform_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsTransform_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsTransform_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsTransform_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsTransform_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsTransform_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsTransform_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsTransform_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsTransform_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsTransform_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGraphicsScale_NewQGraphicsScale(void* parent)
+{
+	return new MyQGraphicsScale(static_cast<QObject*>(parent));
+}
+
+void QGraphicsScale_ConnectOriginChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::originChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_OriginChanged));
+}
+
+void QGraphicsScale_DisconnectOriginChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::originChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_OriginChanged));
+}
+
+void QGraphicsScale_OriginChanged(void* ptr)
+{
+	static_cast<QGraphicsScale*>(ptr)->originChanged();
+}
+
+void QGraphicsScale_ConnectScaleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::scaleChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_ScaleChanged));
+}
+
+void QGraphicsScale_DisconnectScaleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::scaleChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_ScaleChanged));
+}
+
+void QGraphicsScale_ScaleChanged(void* ptr)
+{
+	static_cast<QGraphicsScale*>(ptr)->scaleChanged();
+}
+
+void QGraphicsScale_SetOrigin(void* ptr, void* point)
+{
+	static_cast<QGraphicsScale*>(ptr)->setOrigin(*static_cast<QVector3D*>(point));
+}
+
+void QGraphicsScale_SetXScale(void* ptr, double vqr)
+{
+	static_cast<QGraphicsScale*>(ptr)->setXScale(vqr);
+}
+
+void QGraphicsScale_SetYScale(void* ptr, double vqr)
+{
+	static_cast<QGraphicsScale*>(ptr)->setYScale(vqr);
+}
+
+void QGraphicsScale_SetZScale(void* ptr, double vqr)
+{
+	static_cast<QGraphicsScale*>(ptr)->setZScale(vqr);
+}
+
+void QGraphicsScale_ConnectXScaleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::xScaleChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_XScaleChanged));
+}
+
+void QGraphicsScale_DisconnectXScaleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::xScaleChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_XScaleChanged));
+}
+
+void QGraphicsScale_XScaleChanged(void* ptr)
+{
+	static_cast<QGraphicsScale*>(ptr)->xScaleChanged();
+}
+
+void QGraphicsScale_ConnectYScaleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::yScaleChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_YScaleChanged));
+}
+
+void QGraphicsScale_DisconnectYScaleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::yScaleChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_YScaleChanged));
+}
+
+void QGraphicsScale_YScaleChanged(void* ptr)
+{
+	static_cast<QGraphicsScale*>(ptr)->yScaleChanged();
+}
+
+void QGraphicsScale_ConnectZScaleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::zScaleChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_ZScaleChanged));
+}
+
+void QGraphicsScale_DisconnectZScaleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsScale*>(ptr), static_cast<void (QGraphicsScale::*)()>(&QGraphicsScale::zScaleChanged), static_cast<MyQGraphicsScale*>(ptr), static_cast<void (MyQGraphicsScale::*)()>(&MyQGraphicsScale::Signal_ZScaleChanged));
+}
+
+void QGraphicsScale_ZScaleChanged(void* ptr)
+{
+	static_cast<QGraphicsScale*>(ptr)->zScaleChanged();
+}
+
+void QGraphicsScale_DestroyQGraphicsScale(void* ptr)
+{
+	static_cast<QGraphicsScale*>(ptr)->~QGraphicsScale();
+}
+
+void* QGraphicsScale_Origin(void* ptr)
+{
+	return new QVector3D(static_cast<QGraphicsScale*>(ptr)->origin());
+}
+
+double QGraphicsScale_XScale(void* ptr)
+{
+	return static_cast<QGraphicsScale*>(ptr)->xScale();
+}
+
+double QGraphicsScale_YScale(void* ptr)
+{
+	return static_cast<QGraphicsScale*>(ptr)->yScale();
+}
+
+double QGraphicsScale_ZScale(void* ptr)
+{
+	return static_cast<QGraphicsScale*>(ptr)->zScale();
+}
+
+void QGraphicsScale_ApplyTo(void* ptr, void* matrix)
+{
+	static_cast<QGraphicsScale*>(ptr)->applyTo(static_cast<QMatrix4x4*>(matrix));
+}
+
+void QGraphicsScale_ApplyToDefault(void* ptr, void* matrix)
+{
+		static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::applyTo(static_cast<QMatrix4x4*>(matrix));
+}
+
+class MyQGraphicsScene: public QGraphicsScene
+{
+public:
+	MyQGraphicsScene(QObject *parent) : QGraphicsScene(parent) {};
+	MyQGraphicsScene(const QRectF &sceneRect, QObject *parent) : QGraphicsScene(sceneRect, parent) {};
+	MyQGraphicsScene(qreal x, qreal y, qreal width, qreal height, QObject *parent) : QGraphicsScene(x, y, width, height, parent) {};
+	bool event(QEvent * event) { return callbackQGraphicsScene_Event(this, event) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsScene_EventFilter(this, watched, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQGraphicsScene_FocusNextPrevChild(this, next) != 0; };
+	void advance() { callbackQGraphicsScene_Advance(this); };
+	void Signal_Changed(const QList<QRectF> & region) { callbackQGraphicsScene_Changed(this, ({ QList<QRectF>* tmpValue = const_cast<QList<QRectF>*>(&region); QtWidgets_PackedList { tmpValue, tmpValue->size() }; })); };
+	void clear() { callbackQGraphicsScene_Clear(this); };
+	void clearSelection() { callbackQGraphicsScene_ClearSelection(this); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * contextMenuEvent) { callbackQGraphicsScene_ContextMenuEvent(this, contextMenuEvent); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsScene_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsScene_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsScene_DragMoveEvent(this, event); };
+	void drawBackground(QPainter * painter, const QRectF & rect) { callbackQGraphicsScene_DrawBackground(this, painter, const_cast<QRectF*>(&rect)); };
+	void drawForeground(QPainter * painter, const QRectF & rect) { callbackQGraphicsScene_DrawForeground(this, painter, const_cast<QRectF*>(&rect)); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsScene_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * focusEvent) { callbackQGraphicsScene_FocusInEvent(this, focusEvent); };
+	void Signal_FocusItemChanged(QGraphicsItem * newFocusItem, QGraphicsItem * oldFocusItem, Qt::FocusReason reason) { callbackQGraphicsScene_FocusItemChanged(this, newFocusItem, oldFocusItem, reason); };
+	void focusOutEvent(QFocusEvent * focusEvent) { callbackQGraphicsScene_FocusOutEvent(this, focusEvent); };
+	void helpEvent(QGraphicsSceneHelpEvent * helpEvent) { callbackQGraphicsScene_HelpEvent(this, helpEvent); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsScene_InputMethodEvent(this, event); };
+	void invalidate(const QRectF & rect, QGraphicsScene::SceneLayers layers) { callbackQGraphicsScene_Invalidate(this, const_cast<QRectF*>(&rect), layers); };
+	void keyPressEvent(QKeyEvent * keyEvent) { callbackQGraphicsScene_KeyPressEvent(this, keyEvent); };
+	void keyReleaseEvent(QKeyEvent * keyEvent) { callbackQGraphicsScene_KeyReleaseEvent(this, keyEvent); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * mouseEvent) { callbackQGraphicsScene_MouseDoubleClickEvent(this, mouseEvent); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * mouseEvent) { callbackQGraphicsScene_MouseMoveEvent(this, mouseEvent); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * mouseEvent) { callbackQGraphicsScene_MousePressEvent(this, mouseEvent); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * mouseEvent) { callbackQGraphicsScene_MouseReleaseEvent(this, mouseEvent); };
+	void Signal_SceneRectChanged(const QRectF & rect) { callbackQGraphicsScene_SceneRectChanged(this, const_cast<QRectF*>(&rect)); };
+	void Signal_SelectionChanged() { callbackQGraphicsScene_SelectionChanged(this); };
+	void update(const QRectF & rect) { callbackQGraphicsScene_Update(this, const_cast<QRectF*>(&rect)); };
+	void wheelEvent(QGraphicsSceneWheelEvent * wheelEvent) { callbackQGraphicsScene_WheelEvent(this, wheelEvent); };
+	 ~MyQGraphicsScene() { callbackQGraphicsScene_DestroyQGraphicsScene(this); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsScene_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	void childEvent(QChildEvent * event) { callbackQGraphicsScene_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsScene_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsScene_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsScene_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsScene_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsScene_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsScene_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsScene_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsScene_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGraphicsScene_AddEllipse(void* ptr, void* rect, void* pen, void* brush)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addEllipse(*static_cast<QRectF*>(rect), *static_cast<QPen*>(pen), *static_cast<QBrush*>(brush));
+}
+
+void* QGraphicsScene_AddEllipse2(void* ptr, double x, double y, double w, double h, void* pen, void* brush)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addEllipse(x, y, w, h, *static_cast<QPen*>(pen), *static_cast<QBrush*>(brush));
+}
+
+void* QGraphicsScene_CreateItemGroup(void* ptr, void* items)
+{
+	return static_cast<QGraphicsScene*>(ptr)->createItemGroup(*static_cast<QList<QGraphicsItem *>*>(items));
+}
+
+void* QGraphicsScene_AddLine(void* ptr, void* line, void* pen)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addLine(*static_cast<QLineF*>(line), *static_cast<QPen*>(pen));
+}
+
+void* QGraphicsScene_AddLine2(void* ptr, double x1, double y1, double x2, double y2, void* pen)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addLine(x1, y1, x2, y2, *static_cast<QPen*>(pen));
+}
+
+void* QGraphicsScene_AddPath(void* ptr, void* path, void* pen, void* brush)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addPath(*static_cast<QPainterPath*>(path), *static_cast<QPen*>(pen), *static_cast<QBrush*>(brush));
+}
+
+void* QGraphicsScene_AddPixmap(void* ptr, void* pixmap)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addPixmap(*static_cast<QPixmap*>(pixmap));
+}
+
+void* QGraphicsScene_AddPolygon(void* ptr, void* polygon, void* pen, void* brush)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addPolygon(*static_cast<QPolygonF*>(polygon), *static_cast<QPen*>(pen), *static_cast<QBrush*>(brush));
+}
+
+void* QGraphicsScene_AddWidget(void* ptr, void* widget, long long wFlags)
+{
+		return static_cast<QGraphicsScene*>(ptr)->addWidget(static_cast<QWidget*>(widget), static_cast<Qt::WindowType>(wFlags));
+}
+
+void* QGraphicsScene_AddRect(void* ptr, void* rect, void* pen, void* brush)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addRect(*static_cast<QRectF*>(rect), *static_cast<QPen*>(pen), *static_cast<QBrush*>(brush));
+}
+
+void* QGraphicsScene_AddRect2(void* ptr, double x, double y, double w, double h, void* pen, void* brush)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addRect(x, y, w, h, *static_cast<QPen*>(pen), *static_cast<QBrush*>(brush));
+}
+
+void* QGraphicsScene_NewQGraphicsScene(void* parent)
+{
+	return new MyQGraphicsScene(static_cast<QObject*>(parent));
+}
+
+void* QGraphicsScene_NewQGraphicsScene2(void* sceneRect, void* parent)
+{
+	return new MyQGraphicsScene(*static_cast<QRectF*>(sceneRect), static_cast<QObject*>(parent));
+}
+
+void* QGraphicsScene_NewQGraphicsScene3(double x, double y, double width, double height, void* parent)
+{
+	return new MyQGraphicsScene(x, y, width, height, static_cast<QObject*>(parent));
+}
+
+void* QGraphicsScene_AddSimpleText(void* ptr, char* text, void* font)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addSimpleText(QString(text), *static_cast<QFont*>(font));
+}
+
+void* QGraphicsScene_AddText(void* ptr, char* text, void* font)
+{
+	return static_cast<QGraphicsScene*>(ptr)->addText(QString(text), *static_cast<QFont*>(font));
+}
+
+char QGraphicsScene_EventDefault(void* ptr, void* event)
+{
+		return static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::event(static_cast<QEvent*>(event));
+}
+
+char QGraphicsScene_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+char QGraphicsScene_FocusNextPrevChild(void* ptr, char next)
+{
+	bool returnArg;
+	QMetaObject::invokeMethod(static_cast<QGraphicsScene*>(ptr), "focusNextPrevChild", Q_RETURN_ARG(bool, returnArg), Q_ARG(bool, next != 0));
+	return returnArg;
+}
+
+char QGraphicsScene_FocusNextPrevChildDefault(void* ptr, char next)
+{
+		return static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::focusNextPrevChild(next != 0);
+}
+
+char QGraphicsScene_SendEvent(void* ptr, void* item, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		return static_cast<QGraphicsScene*>(ptr)->sendEvent(static_cast<QGraphicsObject*>(item), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		return static_cast<QGraphicsScene*>(ptr)->sendEvent(static_cast<QGraphicsWidget*>(item), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QGraphicsScene*>(ptr)->sendEvent(static_cast<QGraphicsItem*>(item), static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsScene_AddItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsScene*>(ptr)->addItem(static_cast<QGraphicsObject*>(item));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsScene*>(ptr)->addItem(static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsScene*>(ptr)->addItem(static_cast<QGraphicsItem*>(item));
+	}
+}
+
+void QGraphicsScene_Advance(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsScene*>(ptr), "advance");
+}
+
+void QGraphicsScene_AdvanceDefault(void* ptr)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::advance();
+}
+
+void QGraphicsScene_ConnectChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsScene*>(ptr), static_cast<void (QGraphicsScene::*)(const QList<QRectF> &)>(&QGraphicsScene::changed), static_cast<MyQGraphicsScene*>(ptr), static_cast<void (MyQGraphicsScene::*)(const QList<QRectF> &)>(&MyQGraphicsScene::Signal_Changed));
+}
+
+void QGraphicsScene_DisconnectChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsScene*>(ptr), static_cast<void (QGraphicsScene::*)(const QList<QRectF> &)>(&QGraphicsScene::changed), static_cast<MyQGraphicsScene*>(ptr), static_cast<void (MyQGraphicsScene::*)(const QList<QRectF> &)>(&MyQGraphicsScene::Signal_Changed));
+}
+
+void QGraphicsScene_Changed(void* ptr, void* region)
+{
+	static_cast<QGraphicsScene*>(ptr)->changed(*static_cast<QList<QRectF>*>(region));
+}
+
+void QGraphicsScene_Clear(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsScene*>(ptr), "clear");
+}
+
+void QGraphicsScene_ClearDefault(void* ptr)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::clear();
+}
+
+void QGraphicsScene_ClearFocus(void* ptr)
+{
+	static_cast<QGraphicsScene*>(ptr)->clearFocus();
+}
+
+void QGraphicsScene_ClearSelection(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsScene*>(ptr), "clearSelection");
+}
+
+void QGraphicsScene_ClearSelectionDefault(void* ptr)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::clearSelection();
+}
+
+void QGraphicsScene_ContextMenuEvent(void* ptr, void* contextMenuEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(contextMenuEvent));
+}
+
+void QGraphicsScene_ContextMenuEventDefault(void* ptr, void* contextMenuEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::contextMenuEvent(static_cast<QGraphicsSceneContextMenuEvent*>(contextMenuEvent));
+}
+
+void QGraphicsScene_DestroyItemGroup(void* ptr, void* group)
+{
+	static_cast<QGraphicsScene*>(ptr)->destroyItemGroup(static_cast<QGraphicsItemGroup*>(group));
+}
+
+void QGraphicsScene_DragEnterEvent(void* ptr, void* event)
+{
+	static_cast<QGraphicsScene*>(ptr)->dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+}
+
+void QGraphicsScene_DragEnterEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::dragEnterEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+}
+
+void QGraphicsScene_DragLeaveEvent(void* ptr, void* event)
+{
+	static_cast<QGraphicsScene*>(ptr)->dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+}
+
+void QGraphicsScene_DragLeaveEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::dragLeaveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+}
+
+void QGraphicsScene_DragMoveEvent(void* ptr, void* event)
+{
+	static_cast<QGraphicsScene*>(ptr)->dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+}
+
+void QGraphicsScene_DragMoveEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::dragMoveEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+}
+
+void QGraphicsScene_DrawBackground(void* ptr, void* painter, void* rect)
+{
+	static_cast<QGraphicsScene*>(ptr)->drawBackground(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect));
+}
+
+void QGraphicsScene_DrawBackgroundDefault(void* ptr, void* painter, void* rect)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::drawBackground(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect));
+}
+
+void QGraphicsScene_DrawForeground(void* ptr, void* painter, void* rect)
+{
+	static_cast<QGraphicsScene*>(ptr)->drawForeground(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect));
+}
+
+void QGraphicsScene_DrawForegroundDefault(void* ptr, void* painter, void* rect)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::drawForeground(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect));
+}
+
+void QGraphicsScene_DropEvent(void* ptr, void* event)
+{
+	static_cast<QGraphicsScene*>(ptr)->dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+}
+
+void QGraphicsScene_DropEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::dropEvent(static_cast<QGraphicsSceneDragDropEvent*>(event));
+}
+
+void QGraphicsScene_FocusInEvent(void* ptr, void* focusEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->focusInEvent(static_cast<QFocusEvent*>(focusEvent));
+}
+
+void QGraphicsScene_FocusInEventDefault(void* ptr, void* focusEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::focusInEvent(static_cast<QFocusEvent*>(focusEvent));
+}
+
+void QGraphicsScene_ConnectFocusItemChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsScene*>(ptr), static_cast<void (QGraphicsScene::*)(QGraphicsItem *, QGraphicsItem *, Qt::FocusReason)>(&QGraphicsScene::focusItemChanged), static_cast<MyQGraphicsScene*>(ptr), static_cast<void (MyQGraphicsScene::*)(QGraphicsItem *, QGraphicsItem *, Qt::FocusReason)>(&MyQGraphicsScene::Signal_FocusItemChanged));
+}
+
+void QGraphicsScene_DisconnectFocusItemChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsScene*>(ptr), static_cast<void (QGraphicsScene::*)(QGraphicsItem *, QGraphicsItem *, Qt::FocusReason)>(&QGraphicsScene::focusItemChanged), static_cast<MyQGraphicsScene*>(ptr), static_cast<void (MyQGraphicsScene::*)(QGraphicsItem *, QGraphicsItem *, Qt::FocusReason)>(&MyQGraphicsScene::Signal_FocusItemChanged));
+}
+
+void QGraphicsScene_FocusItemChanged(void* ptr, void* newFocusItem, void* oldFocusItem, long long reason)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(newFocusItem))) {
+		static_cast<QGraphicsScene*>(ptr)->focusItemChanged(static_cast<QGraphicsObject*>(newFocusItem), static_cast<QGraphicsItem*>(oldFocusItem), static_cast<Qt::FocusReason>(reason));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(newFocusItem))) {
+		static_cast<QGraphicsScene*>(ptr)->focusItemChanged(static_cast<QGraphicsWidget*>(newFocusItem), static_cast<QGraphicsItem*>(oldFocusItem), static_cast<Qt::FocusReason>(reason));
+	} else {
+		static_cast<QGraphicsScene*>(ptr)->focusItemChanged(static_cast<QGraphicsItem*>(newFocusItem), static_cast<QGraphicsItem*>(oldFocusItem), static_cast<Qt::FocusReason>(reason));
+	}
+}
+
+void QGraphicsScene_FocusOutEvent(void* ptr, void* focusEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->focusOutEvent(static_cast<QFocusEvent*>(focusEvent));
+}
+
+void QGraphicsScene_FocusOutEventDefault(void* ptr, void* focusEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::focusOutEvent(static_cast<QFocusEvent*>(focusEvent));
+}
+
+void QGraphicsScene_HelpEvent(void* ptr, void* helpEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->helpEvent(static_cast<QGraphicsSceneHelpEvent*>(helpEvent));
+}
+
+void QGraphicsScene_HelpEventDefault(void* ptr, void* helpEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::helpEvent(static_cast<QGraphicsSceneHelpEvent*>(helpEvent));
+}
+
+void QGraphicsScene_InputMethodEvent(void* ptr, void* event)
+{
+	static_cast<QGraphicsScene*>(ptr)->inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+}
+
+void QGraphicsScene_InputMethodEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::inputMethodEvent(static_cast<QInputMethodEvent*>(event));
+}
+
+void QGraphicsScene_Invalidate(void* ptr, void* rect, long long layers)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsScene*>(ptr), "invalidate", Q_ARG(QRectF, *static_cast<QRectF*>(rect)), Q_ARG(QGraphicsScene::SceneLayer, static_cast<QGraphicsScene::SceneLayer>(layers)));
+}
+
+void QGraphicsScene_InvalidateDefault(void* ptr, void* rect, long long layers)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::invalidate(*static_cast<QRectF*>(rect), static_cast<QGraphicsScene::SceneLayer>(layers));
+}
+
+void QGraphicsScene_Invalidate2(void* ptr, double x, double y, double w, double h, long long layers)
+{
+	static_cast<QGraphicsScene*>(ptr)->invalidate(x, y, w, h, static_cast<QGraphicsScene::SceneLayer>(layers));
+}
+
+void QGraphicsScene_KeyPressEvent(void* ptr, void* keyEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->keyPressEvent(static_cast<QKeyEvent*>(keyEvent));
+}
+
+void QGraphicsScene_KeyPressEventDefault(void* ptr, void* keyEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::keyPressEvent(static_cast<QKeyEvent*>(keyEvent));
+}
+
+void QGraphicsScene_KeyReleaseEvent(void* ptr, void* keyEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->keyReleaseEvent(static_cast<QKeyEvent*>(keyEvent));
+}
+
+void QGraphicsScene_KeyReleaseEventDefault(void* ptr, void* keyEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::keyReleaseEvent(static_cast<QKeyEvent*>(keyEvent));
+}
+
+void QGraphicsScene_MouseDoubleClickEvent(void* ptr, void* mouseEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(mouseEvent));
+}
+
+void QGraphicsScene_MouseDoubleClickEventDefault(void* ptr, void* mouseEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::mouseDoubleClickEvent(static_cast<QGraphicsSceneMouseEvent*>(mouseEvent));
+}
+
+void QGraphicsScene_MouseMoveEvent(void* ptr, void* mouseEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(mouseEvent));
+}
+
+void QGraphicsScene_MouseMoveEventDefault(void* ptr, void* mouseEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::mouseMoveEvent(static_cast<QGraphicsSceneMouseEvent*>(mouseEvent));
+}
+
+void QGraphicsScene_MousePressEvent(void* ptr, void* mouseEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(mouseEvent));
+}
+
+void QGraphicsScene_MousePressEventDefault(void* ptr, void* mouseEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::mousePressEvent(static_cast<QGraphicsSceneMouseEvent*>(mouseEvent));
+}
+
+void QGraphicsScene_MouseReleaseEvent(void* ptr, void* mouseEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(mouseEvent));
+}
+
+void QGraphicsScene_MouseReleaseEventDefault(void* ptr, void* mouseEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::mouseReleaseEvent(static_cast<QGraphicsSceneMouseEvent*>(mouseEvent));
+}
+
+void QGraphicsScene_RemoveItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsScene*>(ptr)->removeItem(static_cast<QGraphicsObject*>(item));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsScene*>(ptr)->removeItem(static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsScene*>(ptr)->removeItem(static_cast<QGraphicsItem*>(item));
+	}
+}
+
+void QGraphicsScene_Render(void* ptr, void* painter, void* target, void* source, long long aspectRatioMode)
+{
+	static_cast<QGraphicsScene*>(ptr)->render(static_cast<QPainter*>(painter), *static_cast<QRectF*>(target), *static_cast<QRectF*>(source), static_cast<Qt::AspectRatioMode>(aspectRatioMode));
+}
+
+void QGraphicsScene_ConnectSceneRectChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsScene*>(ptr), static_cast<void (QGraphicsScene::*)(const QRectF &)>(&QGraphicsScene::sceneRectChanged), static_cast<MyQGraphicsScene*>(ptr), static_cast<void (MyQGraphicsScene::*)(const QRectF &)>(&MyQGraphicsScene::Signal_SceneRectChanged));
+}
+
+void QGraphicsScene_DisconnectSceneRectChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsScene*>(ptr), static_cast<void (QGraphicsScene::*)(const QRectF &)>(&QGraphicsScene::sceneRectChanged), static_cast<MyQGraphicsScene*>(ptr), static_cast<void (MyQGraphicsScene::*)(const QRectF &)>(&MyQGraphicsScene::Signal_SceneRectChanged));
+}
+
+void QGraphicsScene_SceneRectChanged(void* ptr, void* rect)
+{
+	static_cast<QGraphicsScene*>(ptr)->sceneRectChanged(*static_cast<QRectF*>(rect));
+}
+
+void QGraphicsScene_ConnectSelectionChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsScene*>(ptr), static_cast<void (QGraphicsScene::*)()>(&QGraphicsScene::selectionChanged), static_cast<MyQGraphicsScene*>(ptr), static_cast<void (MyQGraphicsScene::*)()>(&MyQGraphicsScene::Signal_SelectionChanged));
+}
+
+void QGraphicsScene_DisconnectSelectionChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsScene*>(ptr), static_cast<void (QGraphicsScene::*)()>(&QGraphicsScene::selectionChanged), static_cast<MyQGraphicsScene*>(ptr), static_cast<void (MyQGraphicsScene::*)()>(&MyQGraphicsScene::Signal_SelectionChanged));
+}
+
+void QGraphicsScene_SelectionChanged(void* ptr)
+{
+	static_cast<QGraphicsScene*>(ptr)->selectionChanged();
+}
+
+void QGraphicsScene_SetActivePanel(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsScene*>(ptr)->setActivePanel(static_cast<QGraphicsObject*>(item));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsScene*>(ptr)->setActivePanel(static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsScene*>(ptr)->setActivePanel(static_cast<QGraphicsItem*>(item));
+	}
+}
+
+void QGraphicsScene_SetActiveWindow(void* ptr, void* widget)
+{
+		static_cast<QGraphicsScene*>(ptr)->setActiveWindow(static_cast<QGraphicsWidget*>(widget));
+}
+
+void QGraphicsScene_SetBackgroundBrush(void* ptr, void* brush)
+{
+	static_cast<QGraphicsScene*>(ptr)->setBackgroundBrush(*static_cast<QBrush*>(brush));
+}
+
+void QGraphicsScene_SetBspTreeDepth(void* ptr, int depth)
+{
+	static_cast<QGraphicsScene*>(ptr)->setBspTreeDepth(depth);
+}
+
+void QGraphicsScene_SetFocus(void* ptr, long long focusReason)
+{
+	static_cast<QGraphicsScene*>(ptr)->setFocus(static_cast<Qt::FocusReason>(focusReason));
+}
+
+void QGraphicsScene_SetFocusItem(void* ptr, void* item, long long focusReason)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsScene*>(ptr)->setFocusItem(static_cast<QGraphicsObject*>(item), static_cast<Qt::FocusReason>(focusReason));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsScene*>(ptr)->setFocusItem(static_cast<QGraphicsWidget*>(item), static_cast<Qt::FocusReason>(focusReason));
+	} else {
+		static_cast<QGraphicsScene*>(ptr)->setFocusItem(static_cast<QGraphicsItem*>(item), static_cast<Qt::FocusReason>(focusReason));
+	}
+}
+
+void QGraphicsScene_SetFont(void* ptr, void* font)
+{
+	static_cast<QGraphicsScene*>(ptr)->setFont(*static_cast<QFont*>(font));
+}
+
+void QGraphicsScene_SetForegroundBrush(void* ptr, void* brush)
+{
+	static_cast<QGraphicsScene*>(ptr)->setForegroundBrush(*static_cast<QBrush*>(brush));
+}
+
+void QGraphicsScene_SetItemIndexMethod(void* ptr, long long method)
+{
+	static_cast<QGraphicsScene*>(ptr)->setItemIndexMethod(static_cast<QGraphicsScene::ItemIndexMethod>(method));
+}
+
+void QGraphicsScene_SetMinimumRenderSize(void* ptr, double minSize)
+{
+	static_cast<QGraphicsScene*>(ptr)->setMinimumRenderSize(minSize);
+}
+
+void QGraphicsScene_SetPalette(void* ptr, void* palette)
+{
+	static_cast<QGraphicsScene*>(ptr)->setPalette(*static_cast<QPalette*>(palette));
+}
+
+void QGraphicsScene_SetSceneRect(void* ptr, void* rect)
+{
+	static_cast<QGraphicsScene*>(ptr)->setSceneRect(*static_cast<QRectF*>(rect));
+}
+
+void QGraphicsScene_SetSceneRect2(void* ptr, double x, double y, double w, double h)
+{
+	static_cast<QGraphicsScene*>(ptr)->setSceneRect(x, y, w, h);
+}
+
+void QGraphicsScene_SetSelectionArea2(void* ptr, void* path, long long mode, void* deviceTransform)
+{
+	static_cast<QGraphicsScene*>(ptr)->setSelectionArea(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode), *static_cast<QTransform*>(deviceTransform));
+}
+
+void QGraphicsScene_SetSelectionArea3(void* ptr, void* path, long long selectionOperation, long long mode, void* deviceTransform)
+{
+	static_cast<QGraphicsScene*>(ptr)->setSelectionArea(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionOperation>(selectionOperation), static_cast<Qt::ItemSelectionMode>(mode), *static_cast<QTransform*>(deviceTransform));
+}
+
+void QGraphicsScene_SetSelectionArea(void* ptr, void* path, void* deviceTransform)
+{
+	static_cast<QGraphicsScene*>(ptr)->setSelectionArea(*static_cast<QPainterPath*>(path), *static_cast<QTransform*>(deviceTransform));
+}
+
+void QGraphicsScene_SetSortCacheEnabled(void* ptr, char enabled)
+{
+	static_cast<QGraphicsScene*>(ptr)->setSortCacheEnabled(enabled != 0);
+}
+
+void QGraphicsScene_SetStickyFocus(void* ptr, char enabled)
+{
+	static_cast<QGraphicsScene*>(ptr)->setStickyFocus(enabled != 0);
+}
+
+void QGraphicsScene_SetStyle(void* ptr, void* style)
+{
+	static_cast<QGraphicsScene*>(ptr)->setStyle(static_cast<QStyle*>(style));
+}
+
+void QGraphicsScene_Update(void* ptr, void* rect)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsScene*>(ptr), "update", Q_ARG(QRectF, *static_cast<QRectF*>(rect)));
+}
+
+void QGraphicsScene_UpdateDefault(void* ptr, void* rect)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::update(*static_cast<QRectF*>(rect));
+}
+
+void QGraphicsScene_Update2(void* ptr, double x, double y, double w, double h)
+{
+	static_cast<QGraphicsScene*>(ptr)->update(x, y, w, h);
+}
+
+void QGraphicsScene_WheelEvent(void* ptr, void* wheelEvent)
+{
+	static_cast<QGraphicsScene*>(ptr)->wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(wheelEvent));
+}
+
+void QGraphicsScene_WheelEventDefault(void* ptr, void* wheelEvent)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::wheelEvent(static_cast<QGraphicsSceneWheelEvent*>(wheelEvent));
+}
+
+void QGraphicsScene_DestroyQGraphicsScene(void* ptr)
+{
+	static_cast<QGraphicsScene*>(ptr)->~QGraphicsScene();
+}
+
+void QGraphicsScene_DestroyQGraphicsSceneDefault(void* ptr)
+{
+
+}
+
+long long QGraphicsScene_ItemIndexMethod(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->itemIndexMethod();
+}
+
+void* QGraphicsScene_BackgroundBrush(void* ptr)
+{
+	return new QBrush(static_cast<QGraphicsScene*>(ptr)->backgroundBrush());
+}
+
+void* QGraphicsScene_ForegroundBrush(void* ptr)
+{
+	return new QBrush(static_cast<QGraphicsScene*>(ptr)->foregroundBrush());
+}
+
+void* QGraphicsScene_Font(void* ptr)
+{
+	return new QFont(static_cast<QGraphicsScene*>(ptr)->font());
+}
+
+void* QGraphicsScene_ActivePanel(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->activePanel();
+}
+
+void* QGraphicsScene_FocusItem(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->focusItem();
+}
+
+void* QGraphicsScene_ItemAt(void* ptr, void* position, void* deviceTransform)
+{
+	return static_cast<QGraphicsScene*>(ptr)->itemAt(*static_cast<QPointF*>(position), *static_cast<QTransform*>(deviceTransform));
+}
+
+void* QGraphicsScene_ItemAt4(void* ptr, double x, double y, void* deviceTransform)
+{
+	return static_cast<QGraphicsScene*>(ptr)->itemAt(x, y, *static_cast<QTransform*>(deviceTransform));
+}
+
+void* QGraphicsScene_MouseGrabberItem(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->mouseGrabberItem();
+}
+
+void* QGraphicsScene_ActiveWindow(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->activeWindow();
+}
+
+struct QtWidgets_PackedList QGraphicsScene_CollidingItems(void* ptr, void* item, long long mode)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->collidingItems(static_cast<QGraphicsObject*>(item), static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->collidingItems(static_cast<QGraphicsWidget*>(item), static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	} else {
+		return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->collidingItems(static_cast<QGraphicsItem*>(item), static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+	}
+}
+
+struct QtWidgets_PackedList QGraphicsScene_Items(void* ptr, long long order)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->items(static_cast<Qt::SortOrder>(order))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsScene_Items5(void* ptr, void* path, long long mode, long long order, void* deviceTransform)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->items(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode), static_cast<Qt::SortOrder>(order), *static_cast<QTransform*>(deviceTransform))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsScene_Items2(void* ptr, void* pos, long long mode, long long order, void* deviceTransform)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->items(*static_cast<QPointF*>(pos), static_cast<Qt::ItemSelectionMode>(mode), static_cast<Qt::SortOrder>(order), *static_cast<QTransform*>(deviceTransform))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsScene_Items4(void* ptr, void* polygon, long long mode, long long order, void* deviceTransform)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->items(*static_cast<QPolygonF*>(polygon), static_cast<Qt::ItemSelectionMode>(mode), static_cast<Qt::SortOrder>(order), *static_cast<QTransform*>(deviceTransform))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsScene_Items3(void* ptr, void* rect, long long mode, long long order, void* deviceTransform)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->items(*static_cast<QRectF*>(rect), static_cast<Qt::ItemSelectionMode>(mode), static_cast<Qt::SortOrder>(order), *static_cast<QTransform*>(deviceTransform))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsScene_Items7(void* ptr, double x, double y, double w, double h, long long mode, long long order, void* deviceTransform)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->items(x, y, w, h, static_cast<Qt::ItemSelectionMode>(mode), static_cast<Qt::SortOrder>(order), *static_cast<QTransform*>(deviceTransform))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsScene_SelectedItems(void* ptr)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsScene*>(ptr)->selectedItems()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsScene_Views(void* ptr)
+{
+	return ({ QList<QGraphicsView *>* tmpValue = new QList<QGraphicsView *>(static_cast<QGraphicsScene*>(ptr)->views()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QGraphicsScene_SelectionArea(void* ptr)
+{
+	return new QPainterPath(static_cast<QGraphicsScene*>(ptr)->selectionArea());
+}
+
+void* QGraphicsScene_Palette(void* ptr)
+{
+	return new QPalette(static_cast<QGraphicsScene*>(ptr)->palette());
+}
+
+void* QGraphicsScene_ItemsBoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsScene*>(ptr)->itemsBoundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsScene_SceneRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsScene*>(ptr)->sceneRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsScene_Style(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->style();
+}
+
+void* QGraphicsScene_InputMethodQuery(void* ptr, long long query)
+{
+	return new QVariant(static_cast<QGraphicsScene*>(ptr)->inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+}
+
+void* QGraphicsScene_InputMethodQueryDefault(void* ptr, long long query)
+{
+		return new QVariant(static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::inputMethodQuery(static_cast<Qt::InputMethodQuery>(query)));
+}
+
+char QGraphicsScene_HasFocus(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->hasFocus();
+}
+
+char QGraphicsScene_IsActive(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->isActive();
+}
+
+char QGraphicsScene_IsSortCacheEnabled(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->isSortCacheEnabled();
+}
+
+char QGraphicsScene_StickyFocus(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->stickyFocus();
+}
+
+int QGraphicsScene_BspTreeDepth(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->bspTreeDepth();
+}
+
+double QGraphicsScene_Height(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->height();
+}
+
+double QGraphicsScene_MinimumRenderSize(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->minimumRenderSize();
+}
+
+double QGraphicsScene_Width(void* ptr)
+{
+	return static_cast<QGraphicsScene*>(ptr)->width();
+}
+
+void* QGraphicsScene___createItemGroup_items_atList(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___createItemGroup_items_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsScene___createItemGroup_items_newList(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsScene___changed_region_atList(void* ptr, int i)
+{
+	return ({ QRectF tmpValue = static_cast<QList<QRectF>*>(ptr)->at(i); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void QGraphicsScene___changed_region_setList(void* ptr, void* i)
+{
+	static_cast<QList<QRectF>*>(ptr)->append(*static_cast<QRectF*>(i));
+}
+
+void* QGraphicsScene___changed_region_newList(void* ptr)
+{
+	return new QList<QRectF>;
+}
+
+void* QGraphicsScene___changed_region_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<QRectF>* tmpList = new QList<QRectF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QRectF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QGraphicsScene___changed_region_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<QRectF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QRectF(static_cast<QList<QRectF>*>(ptr)->at(i));
+}
+
+void* QGraphicsScene___collidingItems_atList(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___collidingItems_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsScene___collidingItems_newList(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsScene___items_atList(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___items_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsScene___items_newList(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsScene___items_atList5(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___items_setList5(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsScene___items_newList5(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsScene___items_atList2(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___items_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsScene___items_newList2(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsScene___items_atList4(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___items_setList4(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsScene___items_newList4(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsScene___items_atList3(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___items_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsScene___items_newList3(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsScene___items_atList7(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___items_setList7(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsScene___items_newList7(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsScene___selectedItems_atList(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___selectedItems_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsScene___selectedItems_newList(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsScene___views_atList(void* ptr, int i)
+{
+	return const_cast<QGraphicsView*>(static_cast<QList<QGraphicsView *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___views_setList(void* ptr, void* i)
+{
+	static_cast<QList<QGraphicsView *>*>(ptr)->append(static_cast<QGraphicsView*>(i));
+}
+
+void* QGraphicsScene___views_newList(void* ptr)
+{
+	return new QList<QGraphicsView *>;
+}
+
+void* QGraphicsScene___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QGraphicsScene___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QGraphicsScene___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsScene___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsScene___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsScene___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsScene___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsScene___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsScene___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QGraphicsScene___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsScene___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+void QGraphicsScene_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QGraphicsScene_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QGraphicsScene_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::customEvent(static_cast<QEvent*>(event));
+}
+
+void QGraphicsScene_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::deleteLater();
+}
+
+void QGraphicsScene_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QGraphicsScene_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QGraphicsScene_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QGraphicsScene*>(ptr)->QGraphicsScene::metaObject());
+}
+
+class MyQGraphicsSceneContextMenuEvent: public QGraphicsSceneContextMenuEvent
+{
+public:
+};
+
+void QGraphicsSceneContextMenuEvent_DestroyQGraphicsSceneContextMenuEvent(void* ptr)
+{
+	static_cast<QGraphicsSceneContextMenuEvent*>(ptr)->~QGraphicsSceneContextMenuEvent();
+}
+
+void* QGraphicsSceneContextMenuEvent_ScreenPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsSceneContextMenuEvent*>(ptr)->screenPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneContextMenuEvent_Pos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneContextMenuEvent*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneContextMenuEvent_ScenePos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneContextMenuEvent*>(ptr)->scenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+long long QGraphicsSceneContextMenuEvent_Modifiers(void* ptr)
+{
+	return static_cast<QGraphicsSceneContextMenuEvent*>(ptr)->modifiers();
+}
+
+long long QGraphicsSceneContextMenuEvent_Reason(void* ptr)
+{
+	return static_cast<QGraphicsSceneContextMenuEvent*>(ptr)->reason();
+}
+
+class MyQGraphicsSceneDragDropEvent: public QGraphicsSceneDragDropEvent
+{
+public:
+};
+
+void QGraphicsSceneDragDropEvent_AcceptProposedAction(void* ptr)
+{
+	static_cast<QGraphicsSceneDragDropEvent*>(ptr)->acceptProposedAction();
+}
+
+void QGraphicsSceneDragDropEvent_SetDropAction(void* ptr, long long action)
+{
+	static_cast<QGraphicsSceneDragDropEvent*>(ptr)->setDropAction(static_cast<Qt::DropAction>(action));
+}
+
+void QGraphicsSceneDragDropEvent_DestroyQGraphicsSceneDragDropEvent(void* ptr)
+{
+	static_cast<QGraphicsSceneDragDropEvent*>(ptr)->~QGraphicsSceneDragDropEvent();
+}
+
+void* QGraphicsSceneDragDropEvent_ScreenPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsSceneDragDropEvent*>(ptr)->screenPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneDragDropEvent_Pos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneDragDropEvent*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneDragDropEvent_ScenePos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneDragDropEvent*>(ptr)->scenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneDragDropEvent_Source(void* ptr)
+{
+	return static_cast<QGraphicsSceneDragDropEvent*>(ptr)->source();
+}
+
+long long QGraphicsSceneDragDropEvent_DropAction(void* ptr)
+{
+	return static_cast<QGraphicsSceneDragDropEvent*>(ptr)->dropAction();
+}
+
+long long QGraphicsSceneDragDropEvent_ProposedAction(void* ptr)
+{
+	return static_cast<QGraphicsSceneDragDropEvent*>(ptr)->proposedAction();
+}
+
+long long QGraphicsSceneDragDropEvent_PossibleActions(void* ptr)
+{
+	return static_cast<QGraphicsSceneDragDropEvent*>(ptr)->possibleActions();
+}
+
+long long QGraphicsSceneDragDropEvent_Modifiers(void* ptr)
+{
+	return static_cast<QGraphicsSceneDragDropEvent*>(ptr)->modifiers();
+}
+
+long long QGraphicsSceneDragDropEvent_Buttons(void* ptr)
+{
+	return static_cast<QGraphicsSceneDragDropEvent*>(ptr)->buttons();
+}
+
+void* QGraphicsSceneDragDropEvent_MimeData(void* ptr)
+{
+	return const_cast<QMimeData*>(static_cast<QGraphicsSceneDragDropEvent*>(ptr)->mimeData());
+}
+
+class MyQGraphicsSceneEvent: public QGraphicsSceneEvent
+{
+public:
+};
+
+void QGraphicsSceneEvent_DestroyQGraphicsSceneEvent(void* ptr)
+{
+	static_cast<QGraphicsSceneEvent*>(ptr)->~QGraphicsSceneEvent();
+}
+
+void* QGraphicsSceneEvent_Widget(void* ptr)
+{
+	return static_cast<QGraphicsSceneEvent*>(ptr)->widget();
+}
+
+class MyQGraphicsSceneHelpEvent: public QGraphicsSceneHelpEvent
+{
+public:
+};
+
+void QGraphicsSceneHelpEvent_DestroyQGraphicsSceneHelpEvent(void* ptr)
+{
+	static_cast<QGraphicsSceneHelpEvent*>(ptr)->~QGraphicsSceneHelpEvent();
+}
+
+void* QGraphicsSceneHelpEvent_ScreenPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsSceneHelpEvent*>(ptr)->screenPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneHelpEvent_ScenePos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneHelpEvent*>(ptr)->scenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+class MyQGraphicsSceneHoverEvent: public QGraphicsSceneHoverEvent
+{
+public:
+};
+
+void QGraphicsSceneHoverEvent_DestroyQGraphicsSceneHoverEvent(void* ptr)
+{
+	static_cast<QGraphicsSceneHoverEvent*>(ptr)->~QGraphicsSceneHoverEvent();
+}
+
+void* QGraphicsSceneHoverEvent_LastScreenPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsSceneHoverEvent*>(ptr)->lastScreenPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneHoverEvent_ScreenPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsSceneHoverEvent*>(ptr)->screenPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneHoverEvent_LastPos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneHoverEvent*>(ptr)->lastPos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneHoverEvent_LastScenePos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneHoverEvent*>(ptr)->lastScenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneHoverEvent_Pos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneHoverEvent*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneHoverEvent_ScenePos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneHoverEvent*>(ptr)->scenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+long long QGraphicsSceneHoverEvent_Modifiers(void* ptr)
+{
+	return static_cast<QGraphicsSceneHoverEvent*>(ptr)->modifiers();
+}
+
+class MyQGraphicsSceneMouseEvent: public QGraphicsSceneMouseEvent
+{
+public:
+};
+
+void QGraphicsSceneMouseEvent_DestroyQGraphicsSceneMouseEvent(void* ptr)
+{
+	static_cast<QGraphicsSceneMouseEvent*>(ptr)->~QGraphicsSceneMouseEvent();
+}
+
+void* QGraphicsSceneMouseEvent_ButtonDownScreenPos(void* ptr, long long button)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsSceneMouseEvent*>(ptr)->buttonDownScreenPos(static_cast<Qt::MouseButton>(button)); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneMouseEvent_LastScreenPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsSceneMouseEvent*>(ptr)->lastScreenPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneMouseEvent_ScreenPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsSceneMouseEvent*>(ptr)->screenPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneMouseEvent_ButtonDownPos(void* ptr, long long button)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneMouseEvent*>(ptr)->buttonDownPos(static_cast<Qt::MouseButton>(button)); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneMouseEvent_ButtonDownScenePos(void* ptr, long long button)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneMouseEvent*>(ptr)->buttonDownScenePos(static_cast<Qt::MouseButton>(button)); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneMouseEvent_LastPos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneMouseEvent*>(ptr)->lastPos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneMouseEvent_LastScenePos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneMouseEvent*>(ptr)->lastScenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneMouseEvent_Pos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneMouseEvent*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneMouseEvent_ScenePos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneMouseEvent*>(ptr)->scenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+long long QGraphicsSceneMouseEvent_Modifiers(void* ptr)
+{
+	return static_cast<QGraphicsSceneMouseEvent*>(ptr)->modifiers();
+}
+
+long long QGraphicsSceneMouseEvent_Button(void* ptr)
+{
+	return static_cast<QGraphicsSceneMouseEvent*>(ptr)->button();
+}
+
+long long QGraphicsSceneMouseEvent_Buttons(void* ptr)
+{
+	return static_cast<QGraphicsSceneMouseEvent*>(ptr)->buttons();
+}
+
+long long QGraphicsSceneMouseEvent_Flags(void* ptr)
+{
+	return static_cast<QGraphicsSceneMouseEvent*>(ptr)->flags();
+}
+
+long long QGraphicsSceneMouseEvent_Source(void* ptr)
+{
+	return static_cast<QGraphicsSceneMouseEvent*>(ptr)->source();
+}
+
+class MyQGraphicsSceneMoveEvent: public QGraphicsSceneMoveEvent
+{
+public:
+	MyQGraphicsSceneMoveEvent() : QGraphicsSceneMoveEvent() {};
+};
+
+void* QGraphicsSceneMoveEvent_NewQGraphicsSceneMoveEvent()
+{
+	return new MyQGraphicsSceneMoveEvent();
+}
+
+void QGraphicsSceneMoveEvent_DestroyQGraphicsSceneMoveEvent(void* ptr)
+{
+	static_cast<QGraphicsSceneMoveEvent*>(ptr)->~QGraphicsSceneMoveEvent();
+}
+
+void* QGraphicsSceneMoveEvent_NewPos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneMoveEvent*>(ptr)->newPos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneMoveEvent_OldPos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneMoveEvent*>(ptr)->oldPos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+class MyQGraphicsSceneResizeEvent: public QGraphicsSceneResizeEvent
+{
+public:
+	MyQGraphicsSceneResizeEvent() : QGraphicsSceneResizeEvent() {};
+};
+
+void* QGraphicsSceneResizeEvent_NewQGraphicsSceneResizeEvent()
+{
+	return new MyQGraphicsSceneResizeEvent();
+}
+
+void QGraphicsSceneResizeEvent_DestroyQGraphicsSceneResizeEvent(void* ptr)
+{
+	static_cast<QGraphicsSceneResizeEvent*>(ptr)->~QGraphicsSceneResizeEvent();
+}
+
+void* QGraphicsSceneResizeEvent_NewSize(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QGraphicsSceneResizeEvent*>(ptr)->newSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsSceneResizeEvent_OldSize(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QGraphicsSceneResizeEvent*>(ptr)->oldSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+class MyQGraphicsSceneWheelEvent: public QGraphicsSceneWheelEvent
+{
+public:
+};
+
+void QGraphicsSceneWheelEvent_DestroyQGraphicsSceneWheelEvent(void* ptr)
+{
+	static_cast<QGraphicsSceneWheelEvent*>(ptr)->~QGraphicsSceneWheelEvent();
+}
+
+void* QGraphicsSceneWheelEvent_ScreenPos(void* ptr)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsSceneWheelEvent*>(ptr)->screenPos(); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneWheelEvent_Pos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneWheelEvent*>(ptr)->pos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsSceneWheelEvent_ScenePos(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsSceneWheelEvent*>(ptr)->scenePos(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+long long QGraphicsSceneWheelEvent_Modifiers(void* ptr)
+{
+	return static_cast<QGraphicsSceneWheelEvent*>(ptr)->modifiers();
+}
+
+long long QGraphicsSceneWheelEvent_Buttons(void* ptr)
+{
+	return static_cast<QGraphicsSceneWheelEvent*>(ptr)->buttons();
+}
+
+long long QGraphicsSceneWheelEvent_Orientation(void* ptr)
+{
+	return static_cast<QGraphicsSceneWheelEvent*>(ptr)->orientation();
+}
+
+int QGraphicsSceneWheelEvent_Delta(void* ptr)
+{
+	return static_cast<QGraphicsSceneWheelEvent*>(ptr)->delta();
+}
+
+class MyQGraphicsSimpleTextItem: public QGraphicsSimpleTextItem
+{
+public:
+	MyQGraphicsSimpleTextItem(QGraphicsItem *parent) : QGraphicsSimpleTextItem(parent) {};
+	MyQGraphicsSimpleTextItem(const QString &text, QGraphicsItem *parent) : QGraphicsSimpleTextItem(text, parent) {};
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsSimpleTextItem_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsSimpleTextItem_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+};
+
+void* QGraphicsSimpleTextItem_NewQGraphicsSimpleTextItem(void* parent)
+{
+	return new MyQGraphicsSimpleTextItem(static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsSimpleTextItem_NewQGraphicsSimpleTextItem2(char* text, void* parent)
+{
+	return new MyQGraphicsSimpleTextItem(QString(text), static_cast<QGraphicsItem*>(parent));
+}
+
+void QGraphicsSimpleTextItem_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsSimpleTextItem_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsSimpleTextItem_SetFont(void* ptr, void* font)
+{
+	static_cast<QGraphicsSimpleTextItem*>(ptr)->setFont(*static_cast<QFont*>(font));
+}
+
+void QGraphicsSimpleTextItem_SetText(void* ptr, char* text)
+{
+	static_cast<QGraphicsSimpleTextItem*>(ptr)->setText(QString(text));
+}
+
+void QGraphicsSimpleTextItem_DestroyQGraphicsSimpleTextItem(void* ptr)
+{
+	static_cast<QGraphicsSimpleTextItem*>(ptr)->~QGraphicsSimpleTextItem();
+}
+
+void* QGraphicsSimpleTextItem_Font(void* ptr)
+{
+	return new QFont(static_cast<QGraphicsSimpleTextItem*>(ptr)->font());
+}
+
+void* QGraphicsSimpleTextItem_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsSimpleTextItem*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsSimpleTextItem_BoundingRectDefault(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsSimpleTextItem*>(ptr)->QGraphicsSimpleTextItem::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtWidgets_PackedString QGraphicsSimpleTextItem_Text(void* ptr)
+{
+	return ({ QByteArray tb2ceed = static_cast<QGraphicsSimpleTextItem*>(ptr)->text().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tb2ceed.prepend("WHITESPACE").constData()+10), tb2ceed.size()-10 }; });
+}
+
+class MyQGraphicsTextItem: public QGraphicsTextItem
+{
+public:
+	MyQGraphicsTextItem(QGraphicsItem *parent) : QGraphicsTextItem(parent) {};
+	MyQGraphicsTextItem(const QString &text, QGraphicsItem *parent) : QGraphicsTextItem(text, parent) {};
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void Signal_LinkActivated(const QString & link) { QByteArray t4f0aa5 = link.toUtf8(); QtWidgets_PackedString linkPacked = { const_cast<char*>(t4f0aa5.prepend("WHITESPACE").constData()+10), t4f0aa5.size()-10 };callbackQGraphicsTextItem_LinkActivated(this, linkPacked); };
+	void Signal_LinkHovered(const QString & link) { QByteArray t4f0aa5 = link.toUtf8(); QtWidgets_PackedString linkPacked = { const_cast<char*>(t4f0aa5.prepend("WHITESPACE").constData()+10), t4f0aa5.size()-10 };callbackQGraphicsTextItem_LinkHovered(this, linkPacked); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsTextItem_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsTextItem_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	bool event(QEvent * ev) { return callbackQGraphicsObject_Event(this, ev) != 0; };
+	void Signal_EnabledChanged() { callbackQGraphicsObject_EnabledChanged(this); };
+	void Signal_OpacityChanged() { callbackQGraphicsObject_OpacityChanged(this); };
+	void Signal_ParentChanged() { callbackQGraphicsObject_ParentChanged(this); };
+	void Signal_RotationChanged() { callbackQGraphicsObject_RotationChanged(this); };
+	void Signal_ScaleChanged() { callbackQGraphicsObject_ScaleChanged(this); };
+	void updateMicroFocus() { callbackQGraphicsObject_UpdateMicroFocus(this); };
+	void Signal_VisibleChanged() { callbackQGraphicsObject_VisibleChanged(this); };
+	void Signal_XChanged() { callbackQGraphicsObject_XChanged(this); };
+	void Signal_YChanged() { callbackQGraphicsObject_YChanged(this); };
+	void Signal_ZChanged() { callbackQGraphicsObject_ZChanged(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+};
+
+void* QGraphicsTextItem_NewQGraphicsTextItem(void* parent)
+{
+	return new MyQGraphicsTextItem(static_cast<QGraphicsItem*>(parent));
+}
+
+void* QGraphicsTextItem_NewQGraphicsTextItem2(char* text, void* parent)
+{
+	return new MyQGraphicsTextItem(QString(text), static_cast<QGraphicsItem*>(parent));
+}
+
+void QGraphicsTextItem_AdjustSize(void* ptr)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->adjustSize();
+}
+
+void QGraphicsTextItem_ConnectLinkActivated(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsTextItem*>(ptr), static_cast<void (QGraphicsTextItem::*)(const QString &)>(&QGraphicsTextItem::linkActivated), static_cast<MyQGraphicsTextItem*>(ptr), static_cast<void (MyQGraphicsTextItem::*)(const QString &)>(&MyQGraphicsTextItem::Signal_LinkActivated));
+}
+
+void QGraphicsTextItem_DisconnectLinkActivated(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsTextItem*>(ptr), static_cast<void (QGraphicsTextItem::*)(const QString &)>(&QGraphicsTextItem::linkActivated), static_cast<MyQGraphicsTextItem*>(ptr), static_cast<void (MyQGraphicsTextItem::*)(const QString &)>(&MyQGraphicsTextItem::Signal_LinkActivated));
+}
+
+void QGraphicsTextItem_LinkActivated(void* ptr, char* link)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->linkActivated(QString(link));
+}
+
+void QGraphicsTextItem_ConnectLinkHovered(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsTextItem*>(ptr), static_cast<void (QGraphicsTextItem::*)(const QString &)>(&QGraphicsTextItem::linkHovered), static_cast<MyQGraphicsTextItem*>(ptr), static_cast<void (MyQGraphicsTextItem::*)(const QString &)>(&MyQGraphicsTextItem::Signal_LinkHovered));
+}
+
+void QGraphicsTextItem_DisconnectLinkHovered(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsTextItem*>(ptr), static_cast<void (QGraphicsTextItem::*)(const QString &)>(&QGraphicsTextItem::linkHovered), static_cast<MyQGraphicsTextItem*>(ptr), static_cast<void (MyQGraphicsTextItem::*)(const QString &)>(&MyQGraphicsTextItem::Signal_LinkHovered));
+}
+
+void QGraphicsTextItem_LinkHovered(void* ptr, char* link)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->linkHovered(QString(link));
+}
+
+void QGraphicsTextItem_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsTextItem*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsTextItem_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsTextItem_SetDefaultTextColor(void* ptr, void* col)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setDefaultTextColor(*static_cast<QColor*>(col));
+}
+
+void QGraphicsTextItem_SetDocument(void* ptr, void* document)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setDocument(static_cast<QTextDocument*>(document));
+}
+
+void QGraphicsTextItem_SetFont(void* ptr, void* font)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setFont(*static_cast<QFont*>(font));
+}
+
+void QGraphicsTextItem_SetHtml(void* ptr, char* text)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setHtml(QString(text));
+}
+
+void QGraphicsTextItem_SetOpenExternalLinks(void* ptr, char open)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setOpenExternalLinks(open != 0);
+}
+
+void QGraphicsTextItem_SetPlainText(void* ptr, char* text)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setPlainText(QString(text));
+}
+
+void QGraphicsTextItem_SetTabChangesFocus(void* ptr, char b)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setTabChangesFocus(b != 0);
+}
+
+void QGraphicsTextItem_SetTextCursor(void* ptr, void* cursor)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setTextCursor(*static_cast<QTextCursor*>(cursor));
+}
+
+void QGraphicsTextItem_SetTextInteractionFlags(void* ptr, long long flags)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setTextInteractionFlags(static_cast<Qt::TextInteractionFlag>(flags));
+}
+
+void QGraphicsTextItem_SetTextWidth(void* ptr, double width)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->setTextWidth(width);
+}
+
+void QGraphicsTextItem_DestroyQGraphicsTextItem(void* ptr)
+{
+	static_cast<QGraphicsTextItem*>(ptr)->~QGraphicsTextItem();
+}
+
+void* QGraphicsTextItem_DefaultTextColor(void* ptr)
+{
+	return new QColor(static_cast<QGraphicsTextItem*>(ptr)->defaultTextColor());
+}
+
+void* QGraphicsTextItem_Font(void* ptr)
+{
+	return new QFont(static_cast<QGraphicsTextItem*>(ptr)->font());
+}
+
+void* QGraphicsTextItem_BoundingRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsTextItem*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsTextItem_BoundingRectDefault(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsTextItem*>(ptr)->QGraphicsTextItem::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtWidgets_PackedString QGraphicsTextItem_ToHtml(void* ptr)
+{
+	return ({ QByteArray t880d4e = static_cast<QGraphicsTextItem*>(ptr)->toHtml().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t880d4e.prepend("WHITESPACE").constData()+10), t880d4e.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QGraphicsTextItem_ToPlainText(void* ptr)
+{
+	return ({ QByteArray t3e9441 = static_cast<QGraphicsTextItem*>(ptr)->toPlainText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t3e9441.prepend("WHITESPACE").constData()+10), t3e9441.size()-10 }; });
+}
+
+void* QGraphicsTextItem_TextCursor(void* ptr)
+{
+	return new QTextCursor(static_cast<QGraphicsTextItem*>(ptr)->textCursor());
+}
+
+void* QGraphicsTextItem_Document(void* ptr)
+{
+	return static_cast<QGraphicsTextItem*>(ptr)->document();
+}
+
+long long QGraphicsTextItem_TextInteractionFlags(void* ptr)
+{
+	return static_cast<QGraphicsTextItem*>(ptr)->textInteractionFlags();
+}
+
+char QGraphicsTextItem_OpenExternalLinks(void* ptr)
+{
+	return static_cast<QGraphicsTextItem*>(ptr)->openExternalLinks();
+}
+
+char QGraphicsTextItem_TabChangesFocus(void* ptr)
+{
+	return static_cast<QGraphicsTextItem*>(ptr)->tabChangesFocus();
+}
+
+double QGraphicsTextItem_TextWidth(void* ptr)
+{
+	return static_cast<QGraphicsTextItem*>(ptr)->textWidth();
+}
+
+class MyQGraphicsTransform: public QGraphicsTransform
+{
+public:
+	MyQGraphicsTransform(QObject *parent) : QGraphicsTransform(parent) {};
+	void update() { callbackQGraphicsTransform_Update(this); };
+	void applyTo(QMatrix4x4 * matrix) const { callbackQGraphicsTransform_ApplyTo(const_cast<void*>(static_cast<const void*>(this)), matrix); };
+	bool event(QEvent * e) { return callbackQGraphicsTransform_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsTransform_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsTransform_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsTransform_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsTransform_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsTransform_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsTransform_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsTransform_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsTransform_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsTransform_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsTransform_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGraphicsTransform_NewQGraphicsTransform(void* parent)
+{
+	return new MyQGraphicsTransform(static_cast<QObject*>(parent));
+}
+
+void QGraphicsTransform_Update(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsTransform*>(ptr), "update");
+}
+
+void QGraphicsTransform_UpdateDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::update();
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::update();
+	} else {
+		static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::update();
+	}
+}
+
+void QGraphicsTransform_DestroyQGraphicsTransform(void* ptr)
+{
+	static_cast<QGraphicsTransform*>(ptr)->~QGraphicsTransform();
+}
+
+void QGraphicsTransform_ApplyTo(void* ptr, void* matrix)
+{
+	static_cast<QGraphicsTransform*>(ptr)->applyTo(static_cast<QMatrix4x4*>(matrix));
+}
+
+void* QGraphicsTransform___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QGraphicsTransform___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QGraphicsTransform___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QGraphicsTransform___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsTransform___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsTransform___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsTransform___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsTransform___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsTransform___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsTransform___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QGraphicsTransform___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsTransform___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QGraphicsTransform___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QGraphicsTransform___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QGraphicsTransform___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QGraphicsTransform_EventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::event(static_cast<QEvent*>(e));
+	} else {
+		return static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::event(static_cast<QEvent*>(e));
+	}
+}
+
+char QGraphicsTransform_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QGraphicsTransform_ChildEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QGraphicsTransform_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGraphicsTransform_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsTransform_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::deleteLater();
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::deleteLater();
+	} else {
+		static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::deleteLater();
+	}
+}
+
+void QGraphicsTransform_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QGraphicsTransform_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void* QGraphicsTransform_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsScale*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsScale*>(ptr)->QGraphicsScale::metaObject());
+	} else if (dynamic_cast<QGraphicsRotation*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsRotation*>(ptr)->QGraphicsRotation::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QGraphicsTransform*>(ptr)->QGraphicsTransform::metaObject());
+	}
+}
+
+class MyQGraphicsView: public QGraphicsView
+{
+public:
+	MyQGraphicsView(QGraphicsScene *scene, QWidget *parent) : QGraphicsView(scene, parent) {};
+	MyQGraphicsView(QWidget *parent) : QGraphicsView(parent) {};
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool viewportEvent(QEvent * event) { return callbackQAbstractScrollArea_ViewportEvent(this, event) != 0; };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void drawBackground(QPainter * painter, const QRectF & rect) { callbackQGraphicsView_DrawBackground(this, painter, const_cast<QRectF*>(&rect)); };
+	void drawForeground(QPainter * painter, const QRectF & rect) { callbackQGraphicsView_DrawForeground(this, painter, const_cast<QRectF*>(&rect)); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void invalidateScene(const QRectF & rect, QGraphicsScene::SceneLayers layers) { callbackQGraphicsView_InvalidateScene(this, const_cast<QRectF*>(&rect), layers); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void Signal_RubberBandChanged(QRect rubberBandRect, QPointF fromScenePoint, QPointF toScenePoint) { callbackQGraphicsView_RubberBandChanged(this, ({ QRect tmpValue = rubberBandRect; new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); }), ({ QPointF tmpValue = fromScenePoint; new QPointF(tmpValue.x(), tmpValue.y()); }), ({ QPointF tmpValue = toScenePoint; new QPointF(tmpValue.x(), tmpValue.y()); })); };
+	void scrollContentsBy(int dx, int dy) { callbackQAbstractScrollArea_ScrollContentsBy(this, dx, dy); };
+	void setupViewport(QWidget * widget) { callbackQGraphicsView_SetupViewport(this, widget); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void updateScene(const QList<QRectF> & rects) { callbackQGraphicsView_UpdateScene(this, ({ QList<QRectF>* tmpValue = const_cast<QList<QRectF>*>(&rects); QtWidgets_PackedList { tmpValue, tmpValue->size() }; })); };
+	void updateSceneRect(const QRectF & rect) { callbackQGraphicsView_UpdateSceneRect(this, const_cast<QRectF*>(&rect)); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize viewportSizeHint() const { return *static_cast<QSize*>(callbackQAbstractScrollArea_ViewportSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGraphicsView_NewQGraphicsView2(void* scene, void* parent)
+{
+	return new MyQGraphicsView(static_cast<QGraphicsScene*>(scene), static_cast<QWidget*>(parent));
+}
+
+void* QGraphicsView_NewQGraphicsView(void* parent)
+{
+	return new MyQGraphicsView(static_cast<QWidget*>(parent));
+}
+
+void QGraphicsView_CenterOn3(void* ptr, void* item)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsView*>(ptr)->centerOn(static_cast<QGraphicsObject*>(item));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsView*>(ptr)->centerOn(static_cast<QGraphicsWidget*>(item));
+	} else {
+		static_cast<QGraphicsView*>(ptr)->centerOn(static_cast<QGraphicsItem*>(item));
+	}
+}
+
+void QGraphicsView_CenterOn(void* ptr, void* pos)
+{
+	static_cast<QGraphicsView*>(ptr)->centerOn(*static_cast<QPointF*>(pos));
+}
+
+void QGraphicsView_CenterOn2(void* ptr, double x, double y)
+{
+	static_cast<QGraphicsView*>(ptr)->centerOn(x, y);
+}
+
+void QGraphicsView_DrawBackground(void* ptr, void* painter, void* rect)
+{
+	static_cast<QGraphicsView*>(ptr)->drawBackground(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect));
+}
+
+void QGraphicsView_DrawBackgroundDefault(void* ptr, void* painter, void* rect)
+{
+		static_cast<QGraphicsView*>(ptr)->QGraphicsView::drawBackground(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect));
+}
+
+void QGraphicsView_DrawForeground(void* ptr, void* painter, void* rect)
+{
+	static_cast<QGraphicsView*>(ptr)->drawForeground(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect));
+}
+
+void QGraphicsView_DrawForegroundDefault(void* ptr, void* painter, void* rect)
+{
+		static_cast<QGraphicsView*>(ptr)->QGraphicsView::drawForeground(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect));
+}
+
+void QGraphicsView_EnsureVisible3(void* ptr, void* item, int xmargin, int ymargin)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsView*>(ptr)->ensureVisible(static_cast<QGraphicsObject*>(item), xmargin, ymargin);
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsView*>(ptr)->ensureVisible(static_cast<QGraphicsWidget*>(item), xmargin, ymargin);
+	} else {
+		static_cast<QGraphicsView*>(ptr)->ensureVisible(static_cast<QGraphicsItem*>(item), xmargin, ymargin);
+	}
+}
+
+void QGraphicsView_EnsureVisible(void* ptr, void* rect, int xmargin, int ymargin)
+{
+	static_cast<QGraphicsView*>(ptr)->ensureVisible(*static_cast<QRectF*>(rect), xmargin, ymargin);
+}
+
+void QGraphicsView_EnsureVisible2(void* ptr, double x, double y, double w, double h, int xmargin, int ymargin)
+{
+	static_cast<QGraphicsView*>(ptr)->ensureVisible(x, y, w, h, xmargin, ymargin);
+}
+
+void QGraphicsView_FitInView3(void* ptr, void* item, long long aspectRatioMode)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsView*>(ptr)->fitInView(static_cast<QGraphicsObject*>(item), static_cast<Qt::AspectRatioMode>(aspectRatioMode));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(item))) {
+		static_cast<QGraphicsView*>(ptr)->fitInView(static_cast<QGraphicsWidget*>(item), static_cast<Qt::AspectRatioMode>(aspectRatioMode));
+	} else {
+		static_cast<QGraphicsView*>(ptr)->fitInView(static_cast<QGraphicsItem*>(item), static_cast<Qt::AspectRatioMode>(aspectRatioMode));
+	}
+}
+
+void QGraphicsView_FitInView(void* ptr, void* rect, long long aspectRatioMode)
+{
+	static_cast<QGraphicsView*>(ptr)->fitInView(*static_cast<QRectF*>(rect), static_cast<Qt::AspectRatioMode>(aspectRatioMode));
+}
+
+void QGraphicsView_FitInView2(void* ptr, double x, double y, double w, double h, long long aspectRatioMode)
+{
+	static_cast<QGraphicsView*>(ptr)->fitInView(x, y, w, h, static_cast<Qt::AspectRatioMode>(aspectRatioMode));
+}
+
+void QGraphicsView_InvalidateScene(void* ptr, void* rect, long long layers)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsView*>(ptr), "invalidateScene", Q_ARG(QRectF, *static_cast<QRectF*>(rect)), Q_ARG(QGraphicsScene::SceneLayer, static_cast<QGraphicsScene::SceneLayer>(layers)));
+}
+
+void QGraphicsView_InvalidateSceneDefault(void* ptr, void* rect, long long layers)
+{
+		static_cast<QGraphicsView*>(ptr)->QGraphicsView::invalidateScene(*static_cast<QRectF*>(rect), static_cast<QGraphicsScene::SceneLayer>(layers));
+}
+
+void QGraphicsView_Render(void* ptr, void* painter, void* target, void* source, long long aspectRatioMode)
+{
+	static_cast<QGraphicsView*>(ptr)->render(static_cast<QPainter*>(painter), *static_cast<QRectF*>(target), *static_cast<QRect*>(source), static_cast<Qt::AspectRatioMode>(aspectRatioMode));
+}
+
+void QGraphicsView_ResetCachedContent(void* ptr)
+{
+	static_cast<QGraphicsView*>(ptr)->resetCachedContent();
+}
+
+void QGraphicsView_ResetMatrix(void* ptr)
+{
+	static_cast<QGraphicsView*>(ptr)->resetMatrix();
+}
+
+void QGraphicsView_ResetTransform(void* ptr)
+{
+	static_cast<QGraphicsView*>(ptr)->resetTransform();
+}
+
+void QGraphicsView_Rotate(void* ptr, double angle)
+{
+	static_cast<QGraphicsView*>(ptr)->rotate(angle);
+}
+
+void QGraphicsView_ConnectRubberBandChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsView*>(ptr), static_cast<void (QGraphicsView::*)(QRect, QPointF, QPointF)>(&QGraphicsView::rubberBandChanged), static_cast<MyQGraphicsView*>(ptr), static_cast<void (MyQGraphicsView::*)(QRect, QPointF, QPointF)>(&MyQGraphicsView::Signal_RubberBandChanged));
+}
+
+void QGraphicsView_DisconnectRubberBandChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsView*>(ptr), static_cast<void (QGraphicsView::*)(QRect, QPointF, QPointF)>(&QGraphicsView::rubberBandChanged), static_cast<MyQGraphicsView*>(ptr), static_cast<void (MyQGraphicsView::*)(QRect, QPointF, QPointF)>(&MyQGraphicsView::Signal_RubberBandChanged));
+}
+
+void QGraphicsView_RubberBandChanged(void* ptr, void* rubberBandRect, void* fromScenePoint, void* toScenePoint)
+{
+	static_cast<QGraphicsView*>(ptr)->rubberBandChanged(*static_cast<QRect*>(rubberBandRect), *static_cast<QPointF*>(fromScenePoint), *static_cast<QPointF*>(toScenePoint));
+}
+
+void QGraphicsView_Scale(void* ptr, double sx, double sy)
+{
+	static_cast<QGraphicsView*>(ptr)->scale(sx, sy);
+}
+
+void QGraphicsView_SetAlignment(void* ptr, long long alignment)
+{
+	static_cast<QGraphicsView*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QGraphicsView_SetBackgroundBrush(void* ptr, void* brush)
+{
+	static_cast<QGraphicsView*>(ptr)->setBackgroundBrush(*static_cast<QBrush*>(brush));
+}
+
+void QGraphicsView_SetCacheMode(void* ptr, long long mode)
+{
+	static_cast<QGraphicsView*>(ptr)->setCacheMode(static_cast<QGraphicsView::CacheModeFlag>(mode));
+}
+
+void QGraphicsView_SetDragMode(void* ptr, long long mode)
+{
+	static_cast<QGraphicsView*>(ptr)->setDragMode(static_cast<QGraphicsView::DragMode>(mode));
+}
+
+void QGraphicsView_SetForegroundBrush(void* ptr, void* brush)
+{
+	static_cast<QGraphicsView*>(ptr)->setForegroundBrush(*static_cast<QBrush*>(brush));
+}
+
+void QGraphicsView_SetInteractive(void* ptr, char allowed)
+{
+	static_cast<QGraphicsView*>(ptr)->setInteractive(allowed != 0);
+}
+
+void QGraphicsView_SetOptimizationFlag(void* ptr, long long flag, char enabled)
+{
+	static_cast<QGraphicsView*>(ptr)->setOptimizationFlag(static_cast<QGraphicsView::OptimizationFlag>(flag), enabled != 0);
+}
+
+void QGraphicsView_SetOptimizationFlags(void* ptr, long long flags)
+{
+	static_cast<QGraphicsView*>(ptr)->setOptimizationFlags(static_cast<QGraphicsView::OptimizationFlag>(flags));
+}
+
+void QGraphicsView_SetRenderHint(void* ptr, long long hint, char enabled)
+{
+	static_cast<QGraphicsView*>(ptr)->setRenderHint(static_cast<QPainter::RenderHint>(hint), enabled != 0);
+}
+
+void QGraphicsView_SetRenderHints(void* ptr, long long hints)
+{
+	static_cast<QGraphicsView*>(ptr)->setRenderHints(static_cast<QPainter::RenderHint>(hints));
+}
+
+void QGraphicsView_SetResizeAnchor(void* ptr, long long anchor)
+{
+	static_cast<QGraphicsView*>(ptr)->setResizeAnchor(static_cast<QGraphicsView::ViewportAnchor>(anchor));
+}
+
+void QGraphicsView_SetRubberBandSelectionMode(void* ptr, long long mode)
+{
+	static_cast<QGraphicsView*>(ptr)->setRubberBandSelectionMode(static_cast<Qt::ItemSelectionMode>(mode));
+}
+
+void QGraphicsView_SetScene(void* ptr, void* scene)
+{
+	static_cast<QGraphicsView*>(ptr)->setScene(static_cast<QGraphicsScene*>(scene));
+}
+
+void QGraphicsView_SetSceneRect(void* ptr, void* rect)
+{
+	static_cast<QGraphicsView*>(ptr)->setSceneRect(*static_cast<QRectF*>(rect));
+}
+
+void QGraphicsView_SetSceneRect2(void* ptr, double x, double y, double w, double h)
+{
+	static_cast<QGraphicsView*>(ptr)->setSceneRect(x, y, w, h);
+}
+
+void QGraphicsView_SetTransform(void* ptr, void* matrix, char combine)
+{
+	static_cast<QGraphicsView*>(ptr)->setTransform(*static_cast<QTransform*>(matrix), combine != 0);
+}
+
+void QGraphicsView_SetTransformationAnchor(void* ptr, long long anchor)
+{
+	static_cast<QGraphicsView*>(ptr)->setTransformationAnchor(static_cast<QGraphicsView::ViewportAnchor>(anchor));
+}
+
+void QGraphicsView_SetViewportUpdateMode(void* ptr, long long mode)
+{
+	static_cast<QGraphicsView*>(ptr)->setViewportUpdateMode(static_cast<QGraphicsView::ViewportUpdateMode>(mode));
+}
+
+void QGraphicsView_SetupViewport(void* ptr, void* widget)
+{
+		QMetaObject::invokeMethod(static_cast<QGraphicsView*>(ptr), "setupViewport", Q_ARG(QWidget*, static_cast<QWidget*>(widget)));
+}
+
+void QGraphicsView_SetupViewportDefault(void* ptr, void* widget)
+{
+		static_cast<QGraphicsView*>(ptr)->QGraphicsView::setupViewport(static_cast<QWidget*>(widget));
+}
+
+void QGraphicsView_Shear(void* ptr, double sh, double sv)
+{
+	static_cast<QGraphicsView*>(ptr)->shear(sh, sv);
+}
+
+void QGraphicsView_Translate(void* ptr, double dx, double dy)
+{
+	static_cast<QGraphicsView*>(ptr)->translate(dx, dy);
+}
+
+void QGraphicsView_UpdateScene(void* ptr, void* rects)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsView*>(ptr), "updateScene", Q_ARG(QList<QRectF>, *static_cast<QList<QRectF>*>(rects)));
+}
+
+void QGraphicsView_UpdateSceneDefault(void* ptr, void* rects)
+{
+		static_cast<QGraphicsView*>(ptr)->QGraphicsView::updateScene(*static_cast<QList<QRectF>*>(rects));
+}
+
+void QGraphicsView_UpdateSceneRect(void* ptr, void* rect)
+{
+	QMetaObject::invokeMethod(static_cast<QGraphicsView*>(ptr), "updateSceneRect", Q_ARG(QRectF, *static_cast<QRectF*>(rect)));
+}
+
+void QGraphicsView_UpdateSceneRectDefault(void* ptr, void* rect)
+{
+		static_cast<QGraphicsView*>(ptr)->QGraphicsView::updateSceneRect(*static_cast<QRectF*>(rect));
+}
+
+void QGraphicsView_DestroyQGraphicsView(void* ptr)
+{
+	static_cast<QGraphicsView*>(ptr)->~QGraphicsView();
+}
+
+long long QGraphicsView_CacheMode(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->cacheMode();
+}
+
+long long QGraphicsView_DragMode(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->dragMode();
+}
+
+long long QGraphicsView_OptimizationFlags(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->optimizationFlags();
+}
+
+void* QGraphicsView_BackgroundBrush(void* ptr)
+{
+	return new QBrush(static_cast<QGraphicsView*>(ptr)->backgroundBrush());
+}
+
+void* QGraphicsView_ForegroundBrush(void* ptr)
+{
+	return new QBrush(static_cast<QGraphicsView*>(ptr)->foregroundBrush());
+}
+
+void* QGraphicsView_ItemAt(void* ptr, void* pos)
+{
+	return static_cast<QGraphicsView*>(ptr)->itemAt(*static_cast<QPoint*>(pos));
+}
+
+void* QGraphicsView_ItemAt2(void* ptr, int x, int y)
+{
+	return static_cast<QGraphicsView*>(ptr)->itemAt(x, y);
+}
+
+void* QGraphicsView_Scene(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->scene();
+}
+
+struct QtWidgets_PackedList QGraphicsView_Items(void* ptr)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsView*>(ptr)->items()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsView_Items7(void* ptr, void* path, long long mode)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsView*>(ptr)->items(*static_cast<QPainterPath*>(path), static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsView_Items2(void* ptr, void* pos)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsView*>(ptr)->items(*static_cast<QPoint*>(pos))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsView_Items6(void* ptr, void* polygon, long long mode)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsView*>(ptr)->items(*static_cast<QPolygon*>(polygon), static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsView_Items4(void* ptr, void* rect, long long mode)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsView*>(ptr)->items(*static_cast<QRect*>(rect), static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsView_Items3(void* ptr, int x, int y)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsView*>(ptr)->items(x, y)); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QGraphicsView_Items5(void* ptr, int x, int y, int w, int h, long long mode)
+{
+	return ({ QList<QGraphicsItem *>* tmpValue = new QList<QGraphicsItem *>(static_cast<QGraphicsView*>(ptr)->items(x, y, w, h, static_cast<Qt::ItemSelectionMode>(mode))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+long long QGraphicsView_RenderHints(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->renderHints();
+}
+
+void* QGraphicsView_MapFromScene4(void* ptr, void* path)
+{
+	return new QPainterPath(static_cast<QGraphicsView*>(ptr)->mapFromScene(*static_cast<QPainterPath*>(path)));
+}
+
+void* QGraphicsView_MapToScene4(void* ptr, void* path)
+{
+	return new QPainterPath(static_cast<QGraphicsView*>(ptr)->mapToScene(*static_cast<QPainterPath*>(path)));
+}
+
+void* QGraphicsView_MapFromScene(void* ptr, void* point)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsView*>(ptr)->mapFromScene(*static_cast<QPointF*>(point)); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsView_MapFromScene5(void* ptr, double x, double y)
+{
+	return ({ QPoint tmpValue = static_cast<QGraphicsView*>(ptr)->mapFromScene(x, y); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsView_MapToScene(void* ptr, void* point)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsView*>(ptr)->mapToScene(*static_cast<QPoint*>(point)); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsView_MapToScene5(void* ptr, int x, int y)
+{
+	return ({ QPointF tmpValue = static_cast<QGraphicsView*>(ptr)->mapToScene(x, y); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QGraphicsView_MapFromScene3(void* ptr, void* polygon)
+{
+	return new QPolygon(static_cast<QGraphicsView*>(ptr)->mapFromScene(*static_cast<QPolygonF*>(polygon)));
+}
+
+void* QGraphicsView_MapFromScene2(void* ptr, void* rect)
+{
+	return new QPolygon(static_cast<QGraphicsView*>(ptr)->mapFromScene(*static_cast<QRectF*>(rect)));
+}
+
+void* QGraphicsView_MapFromScene6(void* ptr, double x, double y, double w, double h)
+{
+	return new QPolygon(static_cast<QGraphicsView*>(ptr)->mapFromScene(x, y, w, h));
+}
+
+void* QGraphicsView_MapToScene3(void* ptr, void* polygon)
+{
+	return new QPolygonF(static_cast<QGraphicsView*>(ptr)->mapToScene(*static_cast<QPolygon*>(polygon)));
+}
+
+void* QGraphicsView_MapToScene2(void* ptr, void* rect)
+{
+	return new QPolygonF(static_cast<QGraphicsView*>(ptr)->mapToScene(*static_cast<QRect*>(rect)));
+}
+
+void* QGraphicsView_MapToScene6(void* ptr, int x, int y, int w, int h)
+{
+	return new QPolygonF(static_cast<QGraphicsView*>(ptr)->mapToScene(x, y, w, h));
+}
+
+void* QGraphicsView_RubberBandRect(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QGraphicsView*>(ptr)->rubberBandRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsView_SceneRect(void* ptr)
+{
+	return ({ QRectF tmpValue = static_cast<QGraphicsView*>(ptr)->sceneRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsView_Transform(void* ptr)
+{
+	return new QTransform(static_cast<QGraphicsView*>(ptr)->transform());
+}
+
+void* QGraphicsView_ViewportTransform(void* ptr)
+{
+	return new QTransform(static_cast<QGraphicsView*>(ptr)->viewportTransform());
+}
+
+long long QGraphicsView_Alignment(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->alignment();
+}
+
+long long QGraphicsView_RubberBandSelectionMode(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->rubberBandSelectionMode();
+}
+
+long long QGraphicsView_ResizeAnchor(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->resizeAnchor();
+}
+
+long long QGraphicsView_TransformationAnchor(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->transformationAnchor();
+}
+
+long long QGraphicsView_ViewportUpdateMode(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->viewportUpdateMode();
+}
+
+char QGraphicsView_IsInteractive(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->isInteractive();
+}
+
+char QGraphicsView_IsTransformed(void* ptr)
+{
+	return static_cast<QGraphicsView*>(ptr)->isTransformed();
+}
+
+void* QGraphicsView___updateScene_rects_atList(void* ptr, int i)
+{
+	return ({ QRectF tmpValue = static_cast<QList<QRectF>*>(ptr)->at(i); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void QGraphicsView___updateScene_rects_setList(void* ptr, void* i)
+{
+	static_cast<QList<QRectF>*>(ptr)->append(*static_cast<QRectF*>(i));
+}
+
+void* QGraphicsView___updateScene_rects_newList(void* ptr)
+{
+	return new QList<QRectF>;
+}
+
+void* QGraphicsView___updateScene_rects_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<QRectF>* tmpList = new QList<QRectF>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(*static_cast<QRectF*>(static_cast<void**>(data)[i])); tmpList; });
+}
+
+void QGraphicsView___updateScene_rects_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<QRectF>*>(ptr)->size(); i++) static_cast<void**>(data)[i] = new QRectF(static_cast<QList<QRectF>*>(ptr)->at(i));
+}
+
+void* QGraphicsView___items_atList(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsView___items_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsView___items_newList(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsView___items_atList7(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsView___items_setList7(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsView___items_newList7(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsView___items_atList2(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsView___items_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsView___items_newList2(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsView___items_atList6(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsView___items_setList6(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsView___items_newList6(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsView___items_atList4(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsView___items_setList4(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsView___items_newList4(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsView___items_atList3(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsView___items_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsView___items_newList3(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+void* QGraphicsView___items_atList5(void* ptr, int i)
+{
+	return const_cast<QGraphicsItem*>(static_cast<QList<QGraphicsItem *>*>(ptr)->at(i));
+}
+
+void QGraphicsView___items_setList5(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else {
+		static_cast<QList<QGraphicsItem *>*>(ptr)->append(static_cast<QGraphicsItem*>(i));
+	}
+}
+
+void* QGraphicsView___items_newList5(void* ptr)
+{
+	return new QList<QGraphicsItem *>;
+}
+
+class MyQGraphicsWidget: public QGraphicsWidget
+{
+public:
+	MyQGraphicsWidget(QGraphicsItem *parent, Qt::WindowFlags wFlags) : QGraphicsWidget(parent, wFlags) {};
+	QVariant itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant & value) { return *static_cast<QVariant*>(callbackQGraphicsItem_ItemChange(this, change, const_cast<QVariant*>(&value))); };
+	bool close() { return callbackQGraphicsWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQGraphicsObject_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQGraphicsWidget_FocusNextPrevChild(this, next) != 0; };
+	bool sceneEvent(QEvent * event) { return callbackQGraphicsItem_SceneEvent(this, event) != 0; };
+	bool windowFrameEvent(QEvent * event) { return callbackQGraphicsWidget_WindowFrameEvent(this, event) != 0; };
+	void changeEvent(QEvent * event) { callbackQGraphicsWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQGraphicsWidget_CloseEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQGraphicsItem_FocusOutEvent(this, event); };
+	void Signal_GeometryChanged() { callbackQGraphicsWidget_GeometryChanged(this); };
+	void grabKeyboardEvent(QEvent * event) { callbackQGraphicsWidget_GrabKeyboardEvent(this, event); };
+	void grabMouseEvent(QEvent * event) { callbackQGraphicsWidget_GrabMouseEvent(this, event); };
+	void hideEvent(QHideEvent * event) { callbackQGraphicsWidget_HideEvent(this, event); };
+	void hoverLeaveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverLeaveEvent(this, event); };
+	void hoverMoveEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverMoveEvent(this, event); };
+	void moveEvent(QGraphicsSceneMoveEvent * event) { callbackQGraphicsWidget_MoveEvent(this, event); };
+	void paint(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsWidget_Paint(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	void paintWindowFrame(QPainter * painter, const QStyleOptionGraphicsItem * option, QWidget * widget) { callbackQGraphicsWidget_PaintWindowFrame(this, painter, const_cast<QStyleOptionGraphicsItem*>(option), widget); };
+	void polishEvent() { callbackQGraphicsWidget_PolishEvent(this); };
+	void resizeEvent(QGraphicsSceneResizeEvent * event) { callbackQGraphicsWidget_ResizeEvent(this, event); };
+	void setGeometry(const QRectF & rect) { callbackQGraphicsLayoutItem_SetGeometry(this, const_cast<QRectF*>(&rect)); };
+	void showEvent(QShowEvent * event) { callbackQGraphicsWidget_ShowEvent(this, event); };
+	void ungrabKeyboardEvent(QEvent * event) { callbackQGraphicsWidget_UngrabKeyboardEvent(this, event); };
+	void ungrabMouseEvent(QEvent * event) { callbackQGraphicsWidget_UngrabMouseEvent(this, event); };
+	void updateGeometry() { callbackQGraphicsLayoutItem_UpdateGeometry(this); };
+	QPainterPath shape() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_Shape(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRectF boundingRect() const { return *static_cast<QRectF*>(callbackQGraphicsWidget_BoundingRect(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSizeF sizeHint(Qt::SizeHint which, const QSizeF & constraint) const { return *static_cast<QSizeF*>(callbackQGraphicsWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)), which, const_cast<QSizeF*>(&constraint))); };
+	Qt::WindowFrameSection windowFrameSectionAt(const QPointF & pos) const { return static_cast<Qt::WindowFrameSection>(callbackQGraphicsWidget_WindowFrameSectionAt(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&pos))); };
+	int type() const { return callbackQGraphicsItem_Type(const_cast<void*>(static_cast<const void*>(this))); };
+	void getContentsMargins(qreal * left, qreal * top, qreal * right, qreal * bottom) const { callbackQGraphicsLayoutItem_GetContentsMargins(const_cast<void*>(static_cast<const void*>(this)), *left, *top, *right, *bottom); };
+	void initStyleOption(QStyleOption * option) const { callbackQGraphicsWidget_InitStyleOption(const_cast<void*>(static_cast<const void*>(this)), option); };
+	void Signal_EnabledChanged() { callbackQGraphicsObject_EnabledChanged(this); };
+	void Signal_OpacityChanged() { callbackQGraphicsObject_OpacityChanged(this); };
+	void Signal_ParentChanged() { callbackQGraphicsObject_ParentChanged(this); };
+	void Signal_RotationChanged() { callbackQGraphicsObject_RotationChanged(this); };
+	void Signal_ScaleChanged() { callbackQGraphicsObject_ScaleChanged(this); };
+	void updateMicroFocus() { callbackQGraphicsObject_UpdateMicroFocus(this); };
+	void Signal_VisibleChanged() { callbackQGraphicsObject_VisibleChanged(this); };
+	void Signal_XChanged() { callbackQGraphicsObject_XChanged(this); };
+	void Signal_YChanged() { callbackQGraphicsObject_YChanged(this); };
+	void Signal_ZChanged() { callbackQGraphicsObject_ZChanged(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGraphicsObject_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGraphicsObject_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGraphicsObject_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGraphicsObject_CustomEvent(this, event); };
+	void deleteLater() { callbackQGraphicsObject_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGraphicsObject_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGraphicsObject_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGraphicsObject_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGraphicsObject_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGraphicsObject_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool sceneEventFilter(QGraphicsItem * watched, QEvent * event) { return callbackQGraphicsItem_SceneEventFilter(this, watched, event) != 0; };
+	void advance(int phase) { callbackQGraphicsItem_Advance(this, phase); };
+	void contextMenuEvent(QGraphicsSceneContextMenuEvent * event) { callbackQGraphicsItem_ContextMenuEvent(this, event); };
+	void dragEnterEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DragMoveEvent(this, event); };
+	void dropEvent(QGraphicsSceneDragDropEvent * event) { callbackQGraphicsItem_DropEvent(this, event); };
+	void hoverEnterEvent(QGraphicsSceneHoverEvent * event) { callbackQGraphicsItem_HoverEnterEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQGraphicsItem_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQGraphicsItem_KeyReleaseEvent(this, event); };
+	void mouseDoubleClickEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseMoveEvent(this, event); };
+	void mousePressEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QGraphicsSceneMouseEvent * event) { callbackQGraphicsItem_MouseReleaseEvent(this, event); };
+	void wheelEvent(QGraphicsSceneWheelEvent * event) { callbackQGraphicsItem_WheelEvent(this, event); };
+	QPainterPath opaqueArea() const { return *static_cast<QPainterPath*>(callbackQGraphicsItem_OpaqueArea(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQGraphicsItem_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool collidesWithItem(const QGraphicsItem * other, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithItem(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(other), mode) != 0; };
+	bool collidesWithPath(const QPainterPath & path, Qt::ItemSelectionMode mode) const { return callbackQGraphicsItem_CollidesWithPath(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPainterPath*>(&path), mode) != 0; };
+	bool contains(const QPointF & point) const { return callbackQGraphicsItem_Contains(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&point)) != 0; };
+	bool isObscuredBy(const QGraphicsItem * item) const { return callbackQGraphicsItem_IsObscuredBy(const_cast<void*>(static_cast<const void*>(this)), const_cast<QGraphicsItem*>(item)) != 0; };
+};
+
+void* QGraphicsWidget_NewQGraphicsWidget(void* parent, long long wFlags)
+{
+	return new MyQGraphicsWidget(static_cast<QGraphicsItem*>(parent), static_cast<Qt::WindowType>(wFlags));
+}
+
+char QGraphicsWidget_Close(void* ptr)
+{
+		bool returnArg;
+	QMetaObject::invokeMethod(static_cast<QGraphicsWidget*>(ptr), "close", Q_RETURN_ARG(bool, returnArg));
+	return returnArg;
+}
+
+char QGraphicsWidget_CloseDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::close();
+	} else {
+		return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::close();
+	}
+}
+
+char QGraphicsWidget_FocusNextPrevChild(void* ptr, char next)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->focusNextPrevChild(next != 0);
+}
+
+char QGraphicsWidget_FocusNextPrevChildDefault(void* ptr, char next)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::focusNextPrevChild(next != 0);
+	} else {
+		return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::focusNextPrevChild(next != 0);
+	}
+}
+
+char QGraphicsWidget_WindowFrameEvent(void* ptr, void* event)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->windowFrameEvent(static_cast<QEvent*>(event));
+}
+
+char QGraphicsWidget_WindowFrameEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::windowFrameEvent(static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::windowFrameEvent(static_cast<QEvent*>(event));
+	}
+}
+
+int QGraphicsWidget_GrabShortcut(void* ptr, void* sequence, long long context)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->grabShortcut(*static_cast<QKeySequence*>(sequence), static_cast<Qt::ShortcutContext>(context));
+}
+
+void QGraphicsWidget_AddAction(void* ptr, void* action)
+{
+		static_cast<QGraphicsWidget*>(ptr)->addAction(static_cast<QAction*>(action));
+}
+
+void QGraphicsWidget_AddActions(void* ptr, void* actions)
+{
+		static_cast<QGraphicsWidget*>(ptr)->addActions(*static_cast<QList<QAction *>*>(actions));
+}
+
+void QGraphicsWidget_AdjustSize(void* ptr)
+{
+		static_cast<QGraphicsWidget*>(ptr)->adjustSize();
+}
+
+void QGraphicsWidget_ChangeEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->changeEvent(static_cast<QEvent*>(event));
+}
+
+void QGraphicsWidget_ChangeEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::changeEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::changeEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_CloseEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->closeEvent(static_cast<QCloseEvent*>(event));
+}
+
+void QGraphicsWidget_CloseEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::closeEvent(static_cast<QCloseEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::closeEvent(static_cast<QCloseEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_ConnectGeometryChanged(void* ptr)
+{
+	QObject::connect(static_cast<QGraphicsWidget*>(ptr), static_cast<void (QGraphicsWidget::*)()>(&QGraphicsWidget::geometryChanged), static_cast<MyQGraphicsWidget*>(ptr), static_cast<void (MyQGraphicsWidget::*)()>(&MyQGraphicsWidget::Signal_GeometryChanged));
+}
+
+void QGraphicsWidget_DisconnectGeometryChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QGraphicsWidget*>(ptr), static_cast<void (QGraphicsWidget::*)()>(&QGraphicsWidget::geometryChanged), static_cast<MyQGraphicsWidget*>(ptr), static_cast<void (MyQGraphicsWidget::*)()>(&MyQGraphicsWidget::Signal_GeometryChanged));
+}
+
+void QGraphicsWidget_GeometryChanged(void* ptr)
+{
+		static_cast<QGraphicsWidget*>(ptr)->geometryChanged();
+}
+
+void QGraphicsWidget_GrabKeyboardEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->grabKeyboardEvent(static_cast<QEvent*>(event));
+}
+
+void QGraphicsWidget_GrabKeyboardEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::grabKeyboardEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::grabKeyboardEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_GrabMouseEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->grabMouseEvent(static_cast<QEvent*>(event));
+}
+
+void QGraphicsWidget_GrabMouseEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::grabMouseEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::grabMouseEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_HideEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->hideEvent(static_cast<QHideEvent*>(event));
+}
+
+void QGraphicsWidget_HideEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::hideEvent(static_cast<QHideEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::hideEvent(static_cast<QHideEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_InsertAction(void* ptr, void* before, void* action)
+{
+		static_cast<QGraphicsWidget*>(ptr)->insertAction(static_cast<QAction*>(before), static_cast<QAction*>(action));
+}
+
+void QGraphicsWidget_InsertActions(void* ptr, void* before, void* actions)
+{
+		static_cast<QGraphicsWidget*>(ptr)->insertActions(static_cast<QAction*>(before), *static_cast<QList<QAction *>*>(actions));
+}
+
+void QGraphicsWidget_MoveEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->moveEvent(static_cast<QGraphicsSceneMoveEvent*>(event));
+}
+
+void QGraphicsWidget_MoveEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::moveEvent(static_cast<QGraphicsSceneMoveEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::moveEvent(static_cast<QGraphicsSceneMoveEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_Paint(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsWidget*>(ptr)->paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsWidget_PaintDefault(void* ptr, void* painter, void* option, void* widget)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::paint(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	}
+}
+
+void QGraphicsWidget_PaintWindowFrame(void* ptr, void* painter, void* option, void* widget)
+{
+		static_cast<QGraphicsWidget*>(ptr)->paintWindowFrame(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+}
+
+void QGraphicsWidget_PaintWindowFrameDefault(void* ptr, void* painter, void* option, void* widget)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::paintWindowFrame(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::paintWindowFrame(static_cast<QPainter*>(painter), static_cast<QStyleOptionGraphicsItem*>(option), static_cast<QWidget*>(widget));
+	}
+}
+
+void QGraphicsWidget_PolishEvent(void* ptr)
+{
+		static_cast<QGraphicsWidget*>(ptr)->polishEvent();
+}
+
+void QGraphicsWidget_PolishEventDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::polishEvent();
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::polishEvent();
+	}
+}
+
+void QGraphicsWidget_ReleaseShortcut(void* ptr, int id)
+{
+		static_cast<QGraphicsWidget*>(ptr)->releaseShortcut(id);
+}
+
+void QGraphicsWidget_RemoveAction(void* ptr, void* action)
+{
+		static_cast<QGraphicsWidget*>(ptr)->removeAction(static_cast<QAction*>(action));
+}
+
+void QGraphicsWidget_Resize(void* ptr, void* size)
+{
+		static_cast<QGraphicsWidget*>(ptr)->resize(*static_cast<QSizeF*>(size));
+}
+
+void QGraphicsWidget_Resize2(void* ptr, double w, double h)
+{
+		static_cast<QGraphicsWidget*>(ptr)->resize(w, h);
+}
+
+void QGraphicsWidget_ResizeEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->resizeEvent(static_cast<QGraphicsSceneResizeEvent*>(event));
+}
+
+void QGraphicsWidget_ResizeEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::resizeEvent(static_cast<QGraphicsSceneResizeEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::resizeEvent(static_cast<QGraphicsSceneResizeEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_SetAttribute(void* ptr, long long attribute, char on)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setAttribute(static_cast<Qt::WidgetAttribute>(attribute), on != 0);
+}
+
+void QGraphicsWidget_SetAutoFillBackground(void* ptr, char enabled)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setAutoFillBackground(enabled != 0);
+}
+
+void QGraphicsWidget_SetContentsMargins(void* ptr, double left, double top, double right, double bottom)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setContentsMargins(left, top, right, bottom);
+}
+
+void QGraphicsWidget_SetFocusPolicy(void* ptr, long long policy)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setFocusPolicy(static_cast<Qt::FocusPolicy>(policy));
+}
+
+void QGraphicsWidget_SetFont(void* ptr, void* font)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setFont(*static_cast<QFont*>(font));
+}
+
+void QGraphicsWidget_SetGeometry2(void* ptr, double x, double y, double w, double h)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setGeometry(x, y, w, h);
+}
+
+void QGraphicsWidget_SetLayout(void* ptr, void* layout)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setLayout(static_cast<QGraphicsLayout*>(layout));
+}
+
+void QGraphicsWidget_SetLayoutDirection(void* ptr, long long direction)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setLayoutDirection(static_cast<Qt::LayoutDirection>(direction));
+}
+
+void QGraphicsWidget_SetPalette(void* ptr, void* palette)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setPalette(*static_cast<QPalette*>(palette));
+}
+
+void QGraphicsWidget_SetShortcutAutoRepeat(void* ptr, int id, char enabled)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setShortcutAutoRepeat(id, enabled != 0);
+}
+
+void QGraphicsWidget_SetShortcutEnabled(void* ptr, int id, char enabled)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setShortcutEnabled(id, enabled != 0);
+}
+
+void QGraphicsWidget_SetStyle(void* ptr, void* style)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setStyle(static_cast<QStyle*>(style));
+}
+
+void QGraphicsWidget_QGraphicsWidget_SetTabOrder(void* first, void* second)
+{
+		QGraphicsWidget::setTabOrder(static_cast<QGraphicsWidget*>(first), static_cast<QGraphicsWidget*>(second));
+}
+
+void QGraphicsWidget_SetWindowFlags(void* ptr, long long wFlags)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setWindowFlags(static_cast<Qt::WindowType>(wFlags));
+}
+
+void QGraphicsWidget_SetWindowFrameMargins(void* ptr, double left, double top, double right, double bottom)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setWindowFrameMargins(left, top, right, bottom);
+}
+
+void QGraphicsWidget_SetWindowTitle(void* ptr, char* title)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setWindowTitle(QString(title));
+}
+
+void QGraphicsWidget_ShowEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->showEvent(static_cast<QShowEvent*>(event));
+}
+
+void QGraphicsWidget_ShowEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::showEvent(static_cast<QShowEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::showEvent(static_cast<QShowEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_UngrabKeyboardEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->ungrabKeyboardEvent(static_cast<QEvent*>(event));
+}
+
+void QGraphicsWidget_UngrabKeyboardEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::ungrabKeyboardEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::ungrabKeyboardEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_UngrabMouseEvent(void* ptr, void* event)
+{
+		static_cast<QGraphicsWidget*>(ptr)->ungrabMouseEvent(static_cast<QEvent*>(event));
+}
+
+void QGraphicsWidget_UngrabMouseEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::ungrabMouseEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::ungrabMouseEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QGraphicsWidget_UnsetLayoutDirection(void* ptr)
+{
+		static_cast<QGraphicsWidget*>(ptr)->unsetLayoutDirection();
+}
+
+void QGraphicsWidget_UnsetWindowFrameMargins(void* ptr)
+{
+		static_cast<QGraphicsWidget*>(ptr)->unsetWindowFrameMargins();
+}
+
+void QGraphicsWidget_DestroyQGraphicsWidget(void* ptr)
+{
+	static_cast<QGraphicsWidget*>(ptr)->~QGraphicsWidget();
+}
+
+void* QGraphicsWidget_Font(void* ptr)
+{
+		return new QFont(static_cast<QGraphicsWidget*>(ptr)->font());
+}
+
+void* QGraphicsWidget_Layout(void* ptr)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->layout();
+}
+
+void* QGraphicsWidget_FocusWidget(void* ptr)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->focusWidget();
+}
+
+struct QtWidgets_PackedList QGraphicsWidget_Actions(void* ptr)
+{
+		return ({ QList<QAction *>* tmpValue = new QList<QAction *>(static_cast<QGraphicsWidget*>(ptr)->actions()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QGraphicsWidget_Palette(void* ptr)
+{
+		return new QPalette(static_cast<QGraphicsWidget*>(ptr)->palette());
+}
+
+void* QGraphicsWidget_BoundingRect(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsWidget_BoundingRectDefault(void* ptr)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRectF tmpValue = static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::boundingRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QGraphicsWidget_Rect(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->rect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsWidget_WindowFrameGeometry(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->windowFrameGeometry(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsWidget_WindowFrameRect(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->windowFrameRect(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsWidget_Size(void* ptr)
+{
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->size(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsWidget_SizeHint(void* ptr, long long which, void* constraint)
+{
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsWidget_SizeHintDefault(void* ptr, long long which, void* constraint)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::sizeHint(static_cast<Qt::SizeHint>(which), *static_cast<QSizeF*>(constraint)); new QSizeF(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+struct QtWidgets_PackedString QGraphicsWidget_WindowTitle(void* ptr)
+{
+		return ({ QByteArray t8cb41d = static_cast<QGraphicsWidget*>(ptr)->windowTitle().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t8cb41d.prepend("WHITESPACE").constData()+10), t8cb41d.size()-10 }; });
+}
+
+void* QGraphicsWidget_Style(void* ptr)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->style();
+}
+
+long long QGraphicsWidget_FocusPolicy(void* ptr)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->focusPolicy();
+}
+
+long long QGraphicsWidget_LayoutDirection(void* ptr)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->layoutDirection();
+}
+
+long long QGraphicsWidget_WindowFlags(void* ptr)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->windowFlags();
+}
+
+long long QGraphicsWidget_WindowFrameSectionAt(void* ptr, void* pos)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->windowFrameSectionAt(*static_cast<QPointF*>(pos));
+}
+
+long long QGraphicsWidget_WindowFrameSectionAtDefault(void* ptr, void* pos)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::windowFrameSectionAt(*static_cast<QPointF*>(pos));
+	} else {
+		return static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::windowFrameSectionAt(*static_cast<QPointF*>(pos));
+	}
+}
+
+long long QGraphicsWidget_WindowType(void* ptr)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->windowType();
+}
+
+char QGraphicsWidget_AutoFillBackground(void* ptr)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->autoFillBackground();
+}
+
+char QGraphicsWidget_IsActiveWindow(void* ptr)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->isActiveWindow();
+}
+
+char QGraphicsWidget_TestAttribute(void* ptr, long long attribute)
+{
+		return static_cast<QGraphicsWidget*>(ptr)->testAttribute(static_cast<Qt::WidgetAttribute>(attribute));
+}
+
+void QGraphicsWidget_GetWindowFrameMargins(void* ptr, double left, double top, double right, double bottom)
+{
+		static_cast<QGraphicsWidget*>(ptr)->getWindowFrameMargins(&left, &top, &right, &bottom);
+}
+
+void QGraphicsWidget_InitStyleOption(void* ptr, void* option)
+{
+		static_cast<QGraphicsWidget*>(ptr)->initStyleOption(static_cast<QStyleOption*>(option));
+}
+
+void QGraphicsWidget_InitStyleOptionDefault(void* ptr, void* option)
+{
+	if (dynamic_cast<QGraphicsProxyWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGraphicsProxyWidget*>(ptr)->QGraphicsProxyWidget::initStyleOption(static_cast<QStyleOption*>(option));
+	} else {
+		static_cast<QGraphicsWidget*>(ptr)->QGraphicsWidget::initStyleOption(static_cast<QStyleOption*>(option));
+	}
+}
+
+void* QGraphicsWidget_Geometry(void* ptr)
+{
+		return ({ QRectF tmpValue = static_cast<QGraphicsWidget*>(ptr)->geometry(); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGraphicsWidget_MaximumSize(void* ptr)
+{
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->maximumSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void QGraphicsWidget_SetMaximumSize(void* ptr, void* maximumSize)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setMaximumSize(*static_cast<QSizeF*>(maximumSize));
+}
+
+void* QGraphicsWidget_MinimumSize(void* ptr)
+{
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->minimumSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void QGraphicsWidget_SetMinimumSize(void* ptr, void* minimumSize)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setMinimumSize(*static_cast<QSizeF*>(minimumSize));
+}
+
+void* QGraphicsWidget_PreferredSize(void* ptr)
+{
+		return ({ QSizeF tmpValue = static_cast<QGraphicsWidget*>(ptr)->preferredSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void QGraphicsWidget_SetPreferredSize(void* ptr, void* preferredSize)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setPreferredSize(*static_cast<QSizeF*>(preferredSize));
+}
+
+void* QGraphicsWidget_SizePolicy(void* ptr)
+{
+		return new QSizePolicy(static_cast<QGraphicsWidget*>(ptr)->sizePolicy());
+}
+
+void QGraphicsWidget_SetSizePolicy(void* ptr, void* sizePolicy)
+{
+		static_cast<QGraphicsWidget*>(ptr)->setSizePolicy(*static_cast<QSizePolicy*>(sizePolicy));
+}
+
+void* QGraphicsWidget___addActions_actions_atList(void* ptr, int i)
+{
+		return const_cast<QAction*>(static_cast<QList<QAction *>*>(ptr)->at(i));
+}
+
+void QGraphicsWidget___addActions_actions_setList(void* ptr, void* i)
+{
+		static_cast<QList<QAction *>*>(ptr)->append(static_cast<QAction*>(i));
+}
+
+void* QGraphicsWidget___addActions_actions_newList(void* ptr)
+{
+		return new QList<QAction *>;
+}
+
+void* QGraphicsWidget___insertActions_actions_atList(void* ptr, int i)
+{
+		return const_cast<QAction*>(static_cast<QList<QAction *>*>(ptr)->at(i));
+}
+
+void QGraphicsWidget___insertActions_actions_setList(void* ptr, void* i)
+{
+		static_cast<QList<QAction *>*>(ptr)->append(static_cast<QAction*>(i));
+}
+
+void* QGraphicsWidget___insertActions_actions_newList(void* ptr)
+{
+		return new QList<QAction *>;
+}
+
+void* QGraphicsWidget___actions_atList(void* ptr, int i)
+{
+		return const_cast<QAction*>(static_cast<QList<QAction *>*>(ptr)->at(i));
+}
+
+void QGraphicsWidget___actions_setList(void* ptr, void* i)
+{
+		static_cast<QList<QAction *>*>(ptr)->append(static_cast<QAction*>(i));
+}
+
+void* QGraphicsWidget___actions_newList(void* ptr)
+{
+		return new QList<QAction *>;
+}
+
+class MyQGridLayout: public QGridLayout
+{
+public:
+	MyQGridLayout() : QGridLayout() {};
+	MyQGridLayout(QWidget *parent) : QGridLayout(parent) {};
+	QLayoutItem * takeAt(int index) { return static_cast<QLayoutItem*>(callbackQGridLayout_TakeAt(this, index)); };
+	void invalidate() { callbackQLayoutItem_Invalidate(this); };
+	void setGeometry(const QRect & rect) { callbackQLayout_SetGeometry(this, const_cast<QRect*>(&rect)); };
+	QLayoutItem * itemAt(int index) const { return static_cast<QLayoutItem*>(callbackQGridLayout_ItemAt(const_cast<void*>(static_cast<const void*>(this)), index)); };
+	QSize maximumSize() const { return *static_cast<QSize*>(callbackQLayout_MaximumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSize() const { return *static_cast<QSize*>(callbackQLayout_MinimumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQGridLayout_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::Orientations expandingDirections() const { return static_cast<Qt::Orientation>(callbackQLayout_ExpandingDirections(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQLayoutItem_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int count() const { return callbackQGridLayout_Count(const_cast<void*>(static_cast<const void*>(this))); };
+	int heightForWidth(int w) const { return callbackQLayoutItem_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int minimumHeightForWidth(int w) const { return callbackQLayoutItem_MinimumHeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	QLayout * layout() { return static_cast<QLayout*>(callbackQLayoutItem_Layout(this)); };
+	
+	void childEvent(QChildEvent * e) { callbackQLayout_ChildEvent(this, e); };
+	QRect geometry() const { return *static_cast<QRect*>(callbackQLayout_Geometry(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSizePolicy::ControlTypes controlTypes() const { return static_cast<QSizePolicy::ControlType>(callbackQLayoutItem_ControlTypes(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool isEmpty() const { return callbackQLayout_IsEmpty(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int indexOf(QWidget * widget) const { return callbackQLayout_IndexOf(const_cast<void*>(static_cast<const void*>(this)), widget); };
+	bool event(QEvent * e) { return callbackQLayout_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQLayout_EventFilter(this, watched, event) != 0; };
+	void connectNotify(const QMetaMethod & sign) { callbackQLayout_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQLayout_CustomEvent(this, event); };
+	void deleteLater() { callbackQLayout_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQLayout_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQLayout_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQLayout_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQLayout_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQLayout_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSpacerItem * spacerItem() { return static_cast<QSpacerItem*>(callbackQLayoutItem_SpacerItem(this)); };
+	QWidget * widget() { return static_cast<QWidget*>(callbackQLayoutItem_Widget(this)); };
+};
+
+void* QGridLayout_NewQGridLayout2()
+{
+	return new MyQGridLayout();
+}
+
+void* QGridLayout_NewQGridLayout(void* parent)
+{
+	return new MyQGridLayout(static_cast<QWidget*>(parent));
+}
+
+void* QGridLayout_TakeAt(void* ptr, int index)
+{
+	return static_cast<QGridLayout*>(ptr)->takeAt(index);
+}
+
+void* QGridLayout_TakeAtDefault(void* ptr, int index)
+{
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::takeAt(index);
+}
+
+void QGridLayout_AddLayout(void* ptr, void* layout, int row, int column, long long alignment)
+{
+		static_cast<QGridLayout*>(ptr)->addLayout(static_cast<QLayout*>(layout), row, column, static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QGridLayout_AddLayout2(void* ptr, void* layout, int row, int column, int rowSpan, int columnSpan, long long alignment)
+{
+		static_cast<QGridLayout*>(ptr)->addLayout(static_cast<QLayout*>(layout), row, column, rowSpan, columnSpan, static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QGridLayout_AddWidget3(void* ptr, void* widget, int fromRow, int fromColumn, int rowSpan, int columnSpan, long long alignment)
+{
+		static_cast<QGridLayout*>(ptr)->addWidget(static_cast<QWidget*>(widget), fromRow, fromColumn, rowSpan, columnSpan, static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QGridLayout_AddWidget(void* ptr, void* widget, int row, int column, long long alignment)
+{
+		static_cast<QGridLayout*>(ptr)->addWidget(static_cast<QWidget*>(widget), row, column, static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QGridLayout_SetColumnMinimumWidth(void* ptr, int column, int minSize)
+{
+	static_cast<QGridLayout*>(ptr)->setColumnMinimumWidth(column, minSize);
+}
+
+void QGridLayout_SetColumnStretch(void* ptr, int column, int stretch)
+{
+	static_cast<QGridLayout*>(ptr)->setColumnStretch(column, stretch);
+}
+
+void QGridLayout_SetHorizontalSpacing(void* ptr, int spacing)
+{
+	static_cast<QGridLayout*>(ptr)->setHorizontalSpacing(spacing);
+}
+
+void QGridLayout_SetOriginCorner(void* ptr, long long corner)
+{
+	static_cast<QGridLayout*>(ptr)->setOriginCorner(static_cast<Qt::Corner>(corner));
+}
+
+void QGridLayout_SetRowMinimumHeight(void* ptr, int row, int minSize)
+{
+	static_cast<QGridLayout*>(ptr)->setRowMinimumHeight(row, minSize);
+}
+
+void QGridLayout_SetRowStretch(void* ptr, int row, int stretch)
+{
+	static_cast<QGridLayout*>(ptr)->setRowStretch(row, stretch);
+}
+
+void QGridLayout_SetVerticalSpacing(void* ptr, int spacing)
+{
+	static_cast<QGridLayout*>(ptr)->setVerticalSpacing(spacing);
+}
+
+void QGridLayout_DestroyQGridLayout(void* ptr)
+{
+	static_cast<QGridLayout*>(ptr)->~QGridLayout();
+}
+
+void* QGridLayout_ItemAt(void* ptr, int index)
+{
+	return static_cast<QGridLayout*>(ptr)->itemAt(index);
+}
+
+void* QGridLayout_ItemAtDefault(void* ptr, int index)
+{
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::itemAt(index);
+}
+
+void* QGridLayout_ItemAtPosition(void* ptr, int row, int column)
+{
+	return static_cast<QGridLayout*>(ptr)->itemAtPosition(row, column);
+}
+
+void* QGridLayout_CellRect(void* ptr, int row, int column)
+{
+	return ({ QRect tmpValue = static_cast<QGridLayout*>(ptr)->cellRect(row, column); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGridLayout_SizeHint(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QGridLayout*>(ptr)->sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QGridLayout_SizeHintDefault(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QGridLayout*>(ptr)->QGridLayout::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+long long QGridLayout_OriginCorner(void* ptr)
+{
+	return static_cast<QGridLayout*>(ptr)->originCorner();
+}
+
+int QGridLayout_ColumnCount(void* ptr)
+{
+	return static_cast<QGridLayout*>(ptr)->columnCount();
+}
+
+int QGridLayout_ColumnMinimumWidth(void* ptr, int column)
+{
+	return static_cast<QGridLayout*>(ptr)->columnMinimumWidth(column);
+}
+
+int QGridLayout_ColumnStretch(void* ptr, int column)
+{
+	return static_cast<QGridLayout*>(ptr)->columnStretch(column);
+}
+
+int QGridLayout_Count(void* ptr)
+{
+	return static_cast<QGridLayout*>(ptr)->count();
+}
+
+int QGridLayout_CountDefault(void* ptr)
+{
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::count();
+}
+
+int QGridLayout_HorizontalSpacing(void* ptr)
+{
+	return static_cast<QGridLayout*>(ptr)->horizontalSpacing();
+}
+
+int QGridLayout_RowCount(void* ptr)
+{
+	return static_cast<QGridLayout*>(ptr)->rowCount();
+}
+
+int QGridLayout_RowMinimumHeight(void* ptr, int row)
+{
+	return static_cast<QGridLayout*>(ptr)->rowMinimumHeight(row);
+}
+
+int QGridLayout_RowStretch(void* ptr, int row)
+{
+	return static_cast<QGridLayout*>(ptr)->rowStretch(row);
+}
+
+int QGridLayout_VerticalSpacing(void* ptr)
+{
+	return static_cast<QGridLayout*>(ptr)->verticalSpacing();
+}
+
+void QGridLayout_GetItemPosition(void* ptr, int index, int row, int column, int rowSpan, int columnSpan)
+{
+	static_cast<QGridLayout*>(ptr)->getItemPosition(index, &row, &column, &rowSpan, &columnSpan);
+}
+
+
+
+
+
+class MyQGroupBox: public QGroupBox
+{
+public:
+	MyQGroupBox(QWidget *parent) : QGroupBox(parent) {};
+	MyQGroupBox(const QString &title, QWidget *parent) : QGroupBox(title, parent) {};
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void Signal_Clicked(bool checked) { callbackQGroupBox_Clicked(this, checked); };
+	void focusInEvent(QFocusEvent * fe) { callbackQWidget_FocusInEvent(this, fe); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void resizeEvent(QResizeEvent * e) { callbackQWidget_ResizeEvent(this, e); };
+	void setChecked(bool checked) { callbackQGroupBox_SetChecked(this, checked); };
+	void Signal_Toggled(bool on) { callbackQGroupBox_Toggled(this, on); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QGroupBox_NewQGroupBox(void* parent)
+{
+	return new MyQGroupBox(static_cast<QWidget*>(parent));
+}
+
+void* QGroupBox_NewQGroupBox2(char* title, void* parent)
+{
+	return new MyQGroupBox(QString(title), static_cast<QWidget*>(parent));
+}
+
+void QGroupBox_ConnectClicked(void* ptr)
+{
+	QObject::connect(static_cast<QGroupBox*>(ptr), static_cast<void (QGroupBox::*)(bool)>(&QGroupBox::clicked), static_cast<MyQGroupBox*>(ptr), static_cast<void (MyQGroupBox::*)(bool)>(&MyQGroupBox::Signal_Clicked));
+}
+
+void QGroupBox_DisconnectClicked(void* ptr)
+{
+	QObject::disconnect(static_cast<QGroupBox*>(ptr), static_cast<void (QGroupBox::*)(bool)>(&QGroupBox::clicked), static_cast<MyQGroupBox*>(ptr), static_cast<void (MyQGroupBox::*)(bool)>(&MyQGroupBox::Signal_Clicked));
+}
+
+void QGroupBox_Clicked(void* ptr, char checked)
+{
+	static_cast<QGroupBox*>(ptr)->clicked(checked != 0);
+}
+
+void QGroupBox_SetAlignment(void* ptr, int alignment)
+{
+	static_cast<QGroupBox*>(ptr)->setAlignment(alignment);
+}
+
+void QGroupBox_SetCheckable(void* ptr, char checkable)
+{
+	static_cast<QGroupBox*>(ptr)->setCheckable(checkable != 0);
+}
+
+void QGroupBox_SetChecked(void* ptr, char checked)
+{
+	QMetaObject::invokeMethod(static_cast<QGroupBox*>(ptr), "setChecked", Q_ARG(bool, checked != 0));
+}
+
+void QGroupBox_SetCheckedDefault(void* ptr, char checked)
+{
+		static_cast<QGroupBox*>(ptr)->QGroupBox::setChecked(checked != 0);
+}
+
+void QGroupBox_SetFlat(void* ptr, char flat)
+{
+	static_cast<QGroupBox*>(ptr)->setFlat(flat != 0);
+}
+
+void QGroupBox_SetTitle(void* ptr, char* title)
+{
+	static_cast<QGroupBox*>(ptr)->setTitle(QString(title));
+}
+
+void QGroupBox_ConnectToggled(void* ptr)
+{
+	QObject::connect(static_cast<QGroupBox*>(ptr), static_cast<void (QGroupBox::*)(bool)>(&QGroupBox::toggled), static_cast<MyQGroupBox*>(ptr), static_cast<void (MyQGroupBox::*)(bool)>(&MyQGroupBox::Signal_Toggled));
+}
+
+void QGroupBox_DisconnectToggled(void* ptr)
+{
+	QObject::disconnect(static_cast<QGroupBox*>(ptr), static_cast<void (QGroupBox::*)(bool)>(&QGroupBox::toggled), static_cast<MyQGroupBox*>(ptr), static_cast<void (MyQGroupBox::*)(bool)>(&MyQGroupBox::Signal_Toggled));
+}
+
+void QGroupBox_Toggled(void* ptr, char on)
+{
+	static_cast<QGroupBox*>(ptr)->toggled(on != 0);
+}
+
+void QGroupBox_DestroyQGroupBox(void* ptr)
+{
+	static_cast<QGroupBox*>(ptr)->~QGroupBox();
+}
+
+struct QtWidgets_PackedString QGroupBox_Title(void* ptr)
+{
+	return ({ QByteArray t937a1b = static_cast<QGroupBox*>(ptr)->title().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t937a1b.prepend("WHITESPACE").constData()+10), t937a1b.size()-10 }; });
+}
+
+long long QGroupBox_Alignment(void* ptr)
+{
+	return static_cast<QGroupBox*>(ptr)->alignment();
+}
+
+char QGroupBox_IsCheckable(void* ptr)
+{
+	return static_cast<QGroupBox*>(ptr)->isCheckable();
+}
+
+char QGroupBox_IsChecked(void* ptr)
+{
+	return static_cast<QGroupBox*>(ptr)->isChecked();
+}
+
+char QGroupBox_IsFlat(void* ptr)
+{
+	return static_cast<QGroupBox*>(ptr)->isFlat();
+}
+
+void QGroupBox_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QGroupBox*>(ptr)->initStyleOption(static_cast<QStyleOptionGroupBox*>(option));
+}
+
+class MyQHBoxLayout: public QHBoxLayout
+{
+public:
+	MyQHBoxLayout() : QHBoxLayout() {};
+	MyQHBoxLayout(QWidget *parent) : QHBoxLayout(parent) {};
+	QLayoutItem * takeAt(int index) { return static_cast<QLayoutItem*>(callbackQBoxLayout_TakeAt(this, index)); };
+	void addItem(QLayoutItem * item) { callbackQBoxLayout_AddItem(this, item); };
+	void invalidate() { callbackQLayoutItem_Invalidate(this); };
+	void setGeometry(const QRect & r) { callbackQLayout_SetGeometry(this, const_cast<QRect*>(&r)); };
+	QLayoutItem * itemAt(int index) const { return static_cast<QLayoutItem*>(callbackQBoxLayout_ItemAt(const_cast<void*>(static_cast<const void*>(this)), index)); };
+	QSize maximumSize() const { return *static_cast<QSize*>(callbackQLayout_MaximumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSize() const { return *static_cast<QSize*>(callbackQLayout_MinimumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQBoxLayout_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::Orientations expandingDirections() const { return static_cast<Qt::Orientation>(callbackQLayout_ExpandingDirections(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQLayoutItem_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int count() const { return callbackQBoxLayout_Count(const_cast<void*>(static_cast<const void*>(this))); };
+	int heightForWidth(int w) const { return callbackQLayoutItem_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int minimumHeightForWidth(int w) const { return callbackQLayoutItem_MinimumHeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	QLayout * layout() { return static_cast<QLayout*>(callbackQLayoutItem_Layout(this)); };
+	void childEvent(QChildEvent * e) { callbackQLayout_ChildEvent(this, e); };
+	QRect geometry() const { return *static_cast<QRect*>(callbackQLayout_Geometry(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSizePolicy::ControlTypes controlTypes() const { return static_cast<QSizePolicy::ControlType>(callbackQLayoutItem_ControlTypes(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool isEmpty() const { return callbackQLayout_IsEmpty(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int indexOf(QWidget * widget) const { return callbackQLayout_IndexOf(const_cast<void*>(static_cast<const void*>(this)), widget); };
+	bool event(QEvent * e) { return callbackQLayout_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQLayout_EventFilter(this, watched, event) != 0; };
+	void connectNotify(const QMetaMethod & sign) { callbackQLayout_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQLayout_CustomEvent(this, event); };
+	void deleteLater() { callbackQLayout_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQLayout_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQLayout_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQLayout_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQLayout_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQLayout_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSpacerItem * spacerItem() { return static_cast<QSpacerItem*>(callbackQLayoutItem_SpacerItem(this)); };
+	QWidget * widget() { return static_cast<QWidget*>(callbackQLayoutItem_Widget(this)); };
+};
+
+void* QHBoxLayout_NewQHBoxLayout()
+{
+	return new MyQHBoxLayout();
+}
+
+void* QHBoxLayout_NewQHBoxLayout2(void* parent)
+{
+	return new MyQHBoxLayout(static_cast<QWidget*>(parent));
+}
+
+void QHBoxLayout_DestroyQHBoxLayout(void* ptr)
+{
+	static_cast<QHBoxLayout*>(ptr)->~QHBoxLayout();
+}
+
+class MyQHeaderView: public QHeaderView
+{
+public:
+	MyQHeaderView(Qt::Orientation orientation, QWidget *parent) : QHeaderView(orientation, parent) {};
+	bool viewportEvent(QEvent * e) { return callbackQAbstractScrollArea_ViewportEvent(this, e) != 0; };
+	void currentChanged(const QModelIndex & current, const QModelIndex & old) { callbackQHeaderView_CurrentChanged(this, const_cast<QModelIndex*>(&current), const_cast<QModelIndex*>(&old)); };
+	void Signal_GeometriesChanged() { callbackQHeaderView_GeometriesChanged(this); };
+	void headerDataChanged(Qt::Orientation orientation, int logicalFirst, int logicalLast) { callbackQHeaderView_HeaderDataChanged(this, orientation, logicalFirst, logicalLast); };
+	void mouseDoubleClickEvent(QMouseEvent * e) { callbackQWidget_MouseDoubleClickEvent(this, e); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * e) { callbackQWidget_PaintEvent(this, e); };
+	void reset() { callbackQHeaderView_Reset(this); };
+	void resizeSections() { callbackQHeaderView_ResizeSections2(this); };
+	void Signal_SectionClicked(int logicalIndex) { callbackQHeaderView_SectionClicked(this, logicalIndex); };
+	void Signal_SectionCountChanged(int oldCount, int newCount) { callbackQHeaderView_SectionCountChanged(this, oldCount, newCount); };
+	void Signal_SectionDoubleClicked(int logicalIndex) { callbackQHeaderView_SectionDoubleClicked(this, logicalIndex); };
+	void Signal_SectionEntered(int logicalIndex) { callbackQHeaderView_SectionEntered(this, logicalIndex); };
+	void Signal_SectionHandleDoubleClicked(int logicalIndex) { callbackQHeaderView_SectionHandleDoubleClicked(this, logicalIndex); };
+	void Signal_SectionMoved(int logicalIndex, int oldVisualIndex, int newVisualIndex) { callbackQHeaderView_SectionMoved(this, logicalIndex, oldVisualIndex, newVisualIndex); };
+	void Signal_SectionPressed(int logicalIndex) { callbackQHeaderView_SectionPressed(this, logicalIndex); };
+	void Signal_SectionResized(int logicalIndex, int oldSize, int newSize) { callbackQHeaderView_SectionResized(this, logicalIndex, oldSize, newSize); };
+	void sectionsAboutToBeRemoved(const QModelIndex & parent, int logicalFirst, int logicalLast) { callbackQHeaderView_SectionsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), logicalFirst, logicalLast); };
+	void sectionsInserted(const QModelIndex & parent, int logicalFirst, int logicalLast) { callbackQHeaderView_SectionsInserted(this, const_cast<QModelIndex*>(&parent), logicalFirst, logicalLast); };
+	void setModel(QAbstractItemModel * model) { callbackQAbstractItemView_SetModel(this, model); };
+	void setOffset(int offset) { callbackQHeaderView_SetOffset(this, offset); };
+	void setOffsetToLastSection() { callbackQHeaderView_SetOffsetToLastSection(this); };
+	void setOffsetToSectionPosition(int visualSectionNumber) { callbackQHeaderView_SetOffsetToSectionPosition(this, visualSectionNumber); };
+	void setSelection(const QRect & rect, QItemSelectionModel::SelectionFlags flags) { callbackQHeaderView_SetSelection(this, const_cast<QRect*>(&rect), flags); };
+	void setVisible(bool v) { callbackQHeaderView_SetVisible(this, v); };
+	void Signal_SortIndicatorChanged(int logicalIndex, Qt::SortOrder order) { callbackQHeaderView_SortIndicatorChanged(this, logicalIndex, order); };
+	 ~MyQHeaderView() { callbackQHeaderView_DestroyQHeaderView(this); };
+	QSize sectionSizeFromContents(int logicalIndex) const { return *static_cast<QSize*>(callbackQHeaderView_SectionSizeFromContents(const_cast<void*>(static_cast<const void*>(this)), logicalIndex)); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	int horizontalOffset() const { return callbackQHeaderView_HorizontalOffset(const_cast<void*>(static_cast<const void*>(this))); };
+	int verticalOffset() const { return callbackQHeaderView_VerticalOffset(const_cast<void*>(static_cast<const void*>(this))); };
+	void paintSection(QPainter * painter, const QRect & rect, int logicalIndex) const { callbackQHeaderView_PaintSection(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QRect*>(&rect), logicalIndex); };
+	QModelIndex moveCursor(QAbstractItemView::CursorAction cursorAction, Qt::KeyboardModifiers modifiers) { return *static_cast<QModelIndex*>(callbackQHeaderView_MoveCursor(this, cursorAction, modifiers)); };
+	bool edit(const QModelIndex & index, QAbstractItemView::EditTrigger trigger, QEvent * event) { return callbackQAbstractItemView_Edit2(this, const_cast<QModelIndex*>(&index), trigger, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	void Signal_Activated(const QModelIndex & index) { callbackQAbstractItemView_Activated(this, const_cast<QModelIndex*>(&index)); };
+	void clearSelection() { callbackQAbstractItemView_ClearSelection(this); };
+	void Signal_Clicked(const QModelIndex & index) { callbackQAbstractItemView_Clicked(this, const_cast<QModelIndex*>(&index)); };
+	void closeEditor(QWidget * editor, QAbstractItemDelegate::EndEditHint hint) { callbackQAbstractItemView_CloseEditor(this, editor, hint); };
+	void commitData(QWidget * editor) { callbackQAbstractItemView_CommitData(this, editor); };
+	void dataChanged(const QModelIndex & topLeft, const QModelIndex & bottomRight, const QVector<int> & roles) { callbackQAbstractItemView_DataChanged(this, const_cast<QModelIndex*>(&topLeft), const_cast<QModelIndex*>(&bottomRight), ({ QVector<int>* tmpValue = const_cast<QVector<int>*>(&roles); QtWidgets_PackedList { tmpValue, tmpValue->size() }; })); };
+	void Signal_DoubleClicked(const QModelIndex & index) { callbackQAbstractItemView_DoubleClicked(this, const_cast<QModelIndex*>(&index)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void edit(const QModelIndex & index) { callbackQAbstractItemView_Edit(this, const_cast<QModelIndex*>(&index)); };
+	void editorDestroyed(QObject * editor) { callbackQAbstractItemView_EditorDestroyed(this, editor); };
+	void Signal_Entered(const QModelIndex & index) { callbackQAbstractItemView_Entered(this, const_cast<QModelIndex*>(&index)); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void Signal_IconSizeChanged(const QSize & size) { callbackQAbstractItemView_IconSizeChanged(this, const_cast<QSize*>(&size)); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyboardSearch(const QString & search) { QByteArray t3559d7 = search.toUtf8(); QtWidgets_PackedString searchPacked = { const_cast<char*>(t3559d7.prepend("WHITESPACE").constData()+10), t3559d7.size()-10 };callbackQAbstractItemView_KeyboardSearch(this, searchPacked); };
+	void Signal_Pressed(const QModelIndex & index) { callbackQAbstractItemView_Pressed(this, const_cast<QModelIndex*>(&index)); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void rowsAboutToBeRemoved(const QModelIndex & parent, int start, int end) { callbackQAbstractItemView_RowsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void rowsInserted(const QModelIndex & parent, int start, int end) { callbackQAbstractItemView_RowsInserted(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void scrollTo(const QModelIndex & index, QAbstractItemView::ScrollHint hint) { callbackQHeaderView_ScrollTo(this, const_cast<QModelIndex*>(&index), hint); };
+	void scrollToBottom() { callbackQAbstractItemView_ScrollToBottom(this); };
+	void scrollToTop() { callbackQAbstractItemView_ScrollToTop(this); };
+	void selectAll() { callbackQAbstractItemView_SelectAll(this); };
+	void selectionChanged(const QItemSelection & selected, const QItemSelection & deselected) { callbackQAbstractItemView_SelectionChanged(this, const_cast<QItemSelection*>(&selected), const_cast<QItemSelection*>(&deselected)); };
+	void setCurrentIndex(const QModelIndex & index) { callbackQAbstractItemView_SetCurrentIndex(this, const_cast<QModelIndex*>(&index)); };
+	void setRootIndex(const QModelIndex & index) { callbackQAbstractItemView_SetRootIndex(this, const_cast<QModelIndex*>(&index)); };
+	void setSelectionModel(QItemSelectionModel * selectionModel) { callbackQAbstractItemView_SetSelectionModel(this, selectionModel); };
+	void startDrag(Qt::DropActions supportedActions) { callbackQAbstractItemView_StartDrag(this, supportedActions); };
+	void update(const QModelIndex & index) { callbackQAbstractItemView_Update(this, const_cast<QModelIndex*>(&index)); };
+	void updateGeometries() { callbackQAbstractItemView_UpdateGeometries(this); };
+	void Signal_ViewportEntered() { callbackQAbstractItemView_ViewportEntered(this); };
+	QItemSelectionModel::SelectionFlags selectionCommand(const QModelIndex & index, const QEvent * event) const { return static_cast<QItemSelectionModel::SelectionFlag>(callbackQAbstractItemView_SelectionCommand(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), const_cast<QEvent*>(event))); };
+	QModelIndex indexAt(const QPoint & point) const { return *static_cast<QModelIndex*>(callbackQHeaderView_IndexAt(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPoint*>(&point))); };
+	QList<QModelIndex> selectedIndexes() const { return *static_cast<QList<QModelIndex>*>(callbackQAbstractItemView_SelectedIndexes(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRect visualRect(const QModelIndex & index) const { return *static_cast<QRect*>(callbackQHeaderView_VisualRect(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QRegion visualRegionForSelection(const QItemSelection & selection) const { return *static_cast<QRegion*>(callbackQHeaderView_VisualRegionForSelection(const_cast<void*>(static_cast<const void*>(this)), const_cast<QItemSelection*>(&selection))); };
+	QSize viewportSizeHint() const { return *static_cast<QSize*>(callbackQAbstractScrollArea_ViewportSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QStyleOptionViewItem viewOptions() const { return *static_cast<QStyleOptionViewItem*>(callbackQAbstractItemView_ViewOptions(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool isIndexHidden(const QModelIndex & index) const { return callbackQHeaderView_IsIndexHidden(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index)) != 0; };
+	int sizeHintForColumn(int column) const { return callbackQAbstractItemView_SizeHintForColumn(const_cast<void*>(static_cast<const void*>(this)), column); };
+	int sizeHintForRow(int row) const { return callbackQAbstractItemView_SizeHintForRow(const_cast<void*>(static_cast<const void*>(this)), row); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void scrollContentsBy(int dx, int dy) { callbackQAbstractScrollArea_ScrollContentsBy(this, dx, dy); };
+	void setupViewport(QWidget * viewport) { callbackQAbstractScrollArea_SetupViewport(this, viewport); };
+	void wheelEvent(QWheelEvent * e) { callbackQWidget_WheelEvent(this, e); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QHeaderView_NewQHeaderView(long long orientation, void* parent)
+{
+	return new MyQHeaderView(static_cast<Qt::Orientation>(orientation), static_cast<QWidget*>(parent));
+}
+
+char QHeaderView_RestoreState(void* ptr, void* state)
+{
+	return static_cast<QHeaderView*>(ptr)->restoreState(*static_cast<QByteArray*>(state));
+}
+
+void QHeaderView_CurrentChanged(void* ptr, void* current, void* old)
+{
+	static_cast<QHeaderView*>(ptr)->currentChanged(*static_cast<QModelIndex*>(current), *static_cast<QModelIndex*>(old));
+}
+
+void QHeaderView_CurrentChangedDefault(void* ptr, void* current, void* old)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::currentChanged(*static_cast<QModelIndex*>(current), *static_cast<QModelIndex*>(old));
+}
+
+void QHeaderView_ConnectGeometriesChanged(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)()>(&QHeaderView::geometriesChanged), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)()>(&MyQHeaderView::Signal_GeometriesChanged));
+}
+
+void QHeaderView_DisconnectGeometriesChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)()>(&QHeaderView::geometriesChanged), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)()>(&MyQHeaderView::Signal_GeometriesChanged));
+}
+
+void QHeaderView_GeometriesChanged(void* ptr)
+{
+	static_cast<QHeaderView*>(ptr)->geometriesChanged();
+}
+
+void QHeaderView_HeaderDataChanged(void* ptr, long long orientation, int logicalFirst, int logicalLast)
+{
+	QMetaObject::invokeMethod(static_cast<QHeaderView*>(ptr), "headerDataChanged", Q_ARG(Qt::Orientation, static_cast<Qt::Orientation>(orientation)), Q_ARG(int, logicalFirst), Q_ARG(int, logicalLast));
+}
+
+void QHeaderView_HeaderDataChangedDefault(void* ptr, long long orientation, int logicalFirst, int logicalLast)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::headerDataChanged(static_cast<Qt::Orientation>(orientation), logicalFirst, logicalLast);
+}
+
+void QHeaderView_HideSection(void* ptr, int logicalIndex)
+{
+	static_cast<QHeaderView*>(ptr)->hideSection(logicalIndex);
+}
+
+void QHeaderView_MoveSection(void* ptr, int from, int to)
+{
+	static_cast<QHeaderView*>(ptr)->moveSection(from, to);
+}
+
+void QHeaderView_Reset(void* ptr)
+{
+	static_cast<QHeaderView*>(ptr)->reset();
+}
+
+void QHeaderView_ResetDefault(void* ptr)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::reset();
+}
+
+void QHeaderView_ResetDefaultSectionSize(void* ptr)
+{
+	static_cast<QHeaderView*>(ptr)->resetDefaultSectionSize();
+}
+
+void QHeaderView_ResizeSection(void* ptr, int logicalIndex, int size)
+{
+	static_cast<QHeaderView*>(ptr)->resizeSection(logicalIndex, size);
+}
+
+void QHeaderView_ResizeSections2(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QHeaderView*>(ptr), "resizeSections");
+}
+
+void QHeaderView_ResizeSections2Default(void* ptr)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::resizeSections();
+}
+
+void QHeaderView_ResizeSections(void* ptr, long long mode)
+{
+	static_cast<QHeaderView*>(ptr)->resizeSections(static_cast<QHeaderView::ResizeMode>(mode));
+}
+
+void QHeaderView_ConnectSectionClicked(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionClicked), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionClicked));
+}
+
+void QHeaderView_DisconnectSectionClicked(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionClicked), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionClicked));
+}
+
+void QHeaderView_SectionClicked(void* ptr, int logicalIndex)
+{
+	static_cast<QHeaderView*>(ptr)->sectionClicked(logicalIndex);
+}
+
+void QHeaderView_ConnectSectionCountChanged(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int, int)>(&QHeaderView::sectionCountChanged), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int, int)>(&MyQHeaderView::Signal_SectionCountChanged));
+}
+
+void QHeaderView_DisconnectSectionCountChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int, int)>(&QHeaderView::sectionCountChanged), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int, int)>(&MyQHeaderView::Signal_SectionCountChanged));
+}
+
+void QHeaderView_SectionCountChanged(void* ptr, int oldCount, int newCount)
+{
+	static_cast<QHeaderView*>(ptr)->sectionCountChanged(oldCount, newCount);
+}
+
+void QHeaderView_ConnectSectionDoubleClicked(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionDoubleClicked), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionDoubleClicked));
+}
+
+void QHeaderView_DisconnectSectionDoubleClicked(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionDoubleClicked), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionDoubleClicked));
+}
+
+void QHeaderView_SectionDoubleClicked(void* ptr, int logicalIndex)
+{
+	static_cast<QHeaderView*>(ptr)->sectionDoubleClicked(logicalIndex);
+}
+
+void QHeaderView_ConnectSectionEntered(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionEntered), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionEntered));
+}
+
+void QHeaderView_DisconnectSectionEntered(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionEntered), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionEntered));
+}
+
+void QHeaderView_SectionEntered(void* ptr, int logicalIndex)
+{
+	static_cast<QHeaderView*>(ptr)->sectionEntered(logicalIndex);
+}
+
+void QHeaderView_ConnectSectionHandleDoubleClicked(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionHandleDoubleClicked), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionHandleDoubleClicked));
+}
+
+void QHeaderView_DisconnectSectionHandleDoubleClicked(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionHandleDoubleClicked), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionHandleDoubleClicked));
+}
+
+void QHeaderView_SectionHandleDoubleClicked(void* ptr, int logicalIndex)
+{
+	static_cast<QHeaderView*>(ptr)->sectionHandleDoubleClicked(logicalIndex);
+}
+
+void QHeaderView_ConnectSectionMoved(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int, int, int)>(&QHeaderView::sectionMoved), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int, int, int)>(&MyQHeaderView::Signal_SectionMoved));
+}
+
+void QHeaderView_DisconnectSectionMoved(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int, int, int)>(&QHeaderView::sectionMoved), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int, int, int)>(&MyQHeaderView::Signal_SectionMoved));
+}
+
+void QHeaderView_SectionMoved(void* ptr, int logicalIndex, int oldVisualIndex, int newVisualIndex)
+{
+	static_cast<QHeaderView*>(ptr)->sectionMoved(logicalIndex, oldVisualIndex, newVisualIndex);
+}
+
+void QHeaderView_ConnectSectionPressed(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionPressed), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionPressed));
+}
+
+void QHeaderView_DisconnectSectionPressed(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int)>(&QHeaderView::sectionPressed), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int)>(&MyQHeaderView::Signal_SectionPressed));
+}
+
+void QHeaderView_SectionPressed(void* ptr, int logicalIndex)
+{
+	static_cast<QHeaderView*>(ptr)->sectionPressed(logicalIndex);
+}
+
+void QHeaderView_ConnectSectionResized(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int, int, int)>(&QHeaderView::sectionResized), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int, int, int)>(&MyQHeaderView::Signal_SectionResized));
+}
+
+void QHeaderView_DisconnectSectionResized(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int, int, int)>(&QHeaderView::sectionResized), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int, int, int)>(&MyQHeaderView::Signal_SectionResized));
+}
+
+void QHeaderView_SectionResized(void* ptr, int logicalIndex, int oldSize, int newSize)
+{
+	static_cast<QHeaderView*>(ptr)->sectionResized(logicalIndex, oldSize, newSize);
+}
+
+void QHeaderView_SectionsAboutToBeRemoved(void* ptr, void* parent, int logicalFirst, int logicalLast)
+{
+	QMetaObject::invokeMethod(static_cast<QHeaderView*>(ptr), "sectionsAboutToBeRemoved", Q_ARG(QModelIndex, *static_cast<QModelIndex*>(parent)), Q_ARG(int, logicalFirst), Q_ARG(int, logicalLast));
+}
+
+void QHeaderView_SectionsAboutToBeRemovedDefault(void* ptr, void* parent, int logicalFirst, int logicalLast)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::sectionsAboutToBeRemoved(*static_cast<QModelIndex*>(parent), logicalFirst, logicalLast);
+}
+
+void QHeaderView_SectionsInserted(void* ptr, void* parent, int logicalFirst, int logicalLast)
+{
+	QMetaObject::invokeMethod(static_cast<QHeaderView*>(ptr), "sectionsInserted", Q_ARG(QModelIndex, *static_cast<QModelIndex*>(parent)), Q_ARG(int, logicalFirst), Q_ARG(int, logicalLast));
+}
+
+void QHeaderView_SectionsInsertedDefault(void* ptr, void* parent, int logicalFirst, int logicalLast)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::sectionsInserted(*static_cast<QModelIndex*>(parent), logicalFirst, logicalLast);
+}
+
+void QHeaderView_SetCascadingSectionResizes(void* ptr, char enable)
+{
+	static_cast<QHeaderView*>(ptr)->setCascadingSectionResizes(enable != 0);
+}
+
+void QHeaderView_SetDefaultAlignment(void* ptr, long long alignment)
+{
+	static_cast<QHeaderView*>(ptr)->setDefaultAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QHeaderView_SetDefaultSectionSize(void* ptr, int size)
+{
+	static_cast<QHeaderView*>(ptr)->setDefaultSectionSize(size);
+}
+
+void QHeaderView_SetHighlightSections(void* ptr, char highlight)
+{
+	static_cast<QHeaderView*>(ptr)->setHighlightSections(highlight != 0);
+}
+
+void QHeaderView_SetMaximumSectionSize(void* ptr, int size)
+{
+	static_cast<QHeaderView*>(ptr)->setMaximumSectionSize(size);
+}
+
+void QHeaderView_SetMinimumSectionSize(void* ptr, int size)
+{
+	static_cast<QHeaderView*>(ptr)->setMinimumSectionSize(size);
+}
+
+void QHeaderView_SetOffset(void* ptr, int offset)
+{
+	QMetaObject::invokeMethod(static_cast<QHeaderView*>(ptr), "setOffset", Q_ARG(int, offset));
+}
+
+void QHeaderView_SetOffsetDefault(void* ptr, int offset)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::setOffset(offset);
+}
+
+void QHeaderView_SetOffsetToLastSection(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QHeaderView*>(ptr), "setOffsetToLastSection");
+}
+
+void QHeaderView_SetOffsetToLastSectionDefault(void* ptr)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::setOffsetToLastSection();
+}
+
+void QHeaderView_SetOffsetToSectionPosition(void* ptr, int visualSectionNumber)
+{
+	QMetaObject::invokeMethod(static_cast<QHeaderView*>(ptr), "setOffsetToSectionPosition", Q_ARG(int, visualSectionNumber));
+}
+
+void QHeaderView_SetOffsetToSectionPositionDefault(void* ptr, int visualSectionNumber)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::setOffsetToSectionPosition(visualSectionNumber);
+}
+
+void QHeaderView_SetResizeContentsPrecision(void* ptr, int precision)
+{
+	static_cast<QHeaderView*>(ptr)->setResizeContentsPrecision(precision);
+}
+
+void QHeaderView_SetSectionHidden(void* ptr, int logicalIndex, char hide)
+{
+	static_cast<QHeaderView*>(ptr)->setSectionHidden(logicalIndex, hide != 0);
+}
+
+void QHeaderView_SetSectionResizeMode(void* ptr, long long mode)
+{
+	static_cast<QHeaderView*>(ptr)->setSectionResizeMode(static_cast<QHeaderView::ResizeMode>(mode));
+}
+
+void QHeaderView_SetSectionResizeMode2(void* ptr, int logicalIndex, long long mode)
+{
+	static_cast<QHeaderView*>(ptr)->setSectionResizeMode(logicalIndex, static_cast<QHeaderView::ResizeMode>(mode));
+}
+
+void QHeaderView_SetSectionsClickable(void* ptr, char clickable)
+{
+	static_cast<QHeaderView*>(ptr)->setSectionsClickable(clickable != 0);
+}
+
+void QHeaderView_SetSectionsMovable(void* ptr, char movable)
+{
+	static_cast<QHeaderView*>(ptr)->setSectionsMovable(movable != 0);
+}
+
+void QHeaderView_SetSelection(void* ptr, void* rect, long long flags)
+{
+	static_cast<QHeaderView*>(ptr)->setSelection(*static_cast<QRect*>(rect), static_cast<QItemSelectionModel::SelectionFlag>(flags));
+}
+
+void QHeaderView_SetSelectionDefault(void* ptr, void* rect, long long flags)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::setSelection(*static_cast<QRect*>(rect), static_cast<QItemSelectionModel::SelectionFlag>(flags));
+}
+
+void QHeaderView_SetSortIndicator(void* ptr, int logicalIndex, long long order)
+{
+	static_cast<QHeaderView*>(ptr)->setSortIndicator(logicalIndex, static_cast<Qt::SortOrder>(order));
+}
+
+void QHeaderView_SetSortIndicatorShown(void* ptr, char show)
+{
+	static_cast<QHeaderView*>(ptr)->setSortIndicatorShown(show != 0);
+}
+
+void QHeaderView_SetStretchLastSection(void* ptr, char stretch)
+{
+	static_cast<QHeaderView*>(ptr)->setStretchLastSection(stretch != 0);
+}
+
+void QHeaderView_SetVisible(void* ptr, char v)
+{
+	static_cast<QHeaderView*>(ptr)->setVisible(v != 0);
+}
+
+void QHeaderView_SetVisibleDefault(void* ptr, char v)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::setVisible(v != 0);
+}
+
+void QHeaderView_ShowSection(void* ptr, int logicalIndex)
+{
+	static_cast<QHeaderView*>(ptr)->showSection(logicalIndex);
+}
+
+void QHeaderView_ConnectSortIndicatorChanged(void* ptr)
+{
+	QObject::connect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int, Qt::SortOrder)>(&QHeaderView::sortIndicatorChanged), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int, Qt::SortOrder)>(&MyQHeaderView::Signal_SortIndicatorChanged));
+}
+
+void QHeaderView_DisconnectSortIndicatorChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QHeaderView*>(ptr), static_cast<void (QHeaderView::*)(int, Qt::SortOrder)>(&QHeaderView::sortIndicatorChanged), static_cast<MyQHeaderView*>(ptr), static_cast<void (MyQHeaderView::*)(int, Qt::SortOrder)>(&MyQHeaderView::Signal_SortIndicatorChanged));
+}
+
+void QHeaderView_SortIndicatorChanged(void* ptr, int logicalIndex, long long order)
+{
+	static_cast<QHeaderView*>(ptr)->sortIndicatorChanged(logicalIndex, static_cast<Qt::SortOrder>(order));
+}
+
+void QHeaderView_SwapSections(void* ptr, int first, int second)
+{
+	static_cast<QHeaderView*>(ptr)->swapSections(first, second);
+}
+
+void QHeaderView_DestroyQHeaderView(void* ptr)
+{
+	static_cast<QHeaderView*>(ptr)->~QHeaderView();
+}
+
+void QHeaderView_DestroyQHeaderViewDefault(void* ptr)
+{
+
+}
+
+void* QHeaderView_SaveState(void* ptr)
+{
+	return new QByteArray(static_cast<QHeaderView*>(ptr)->saveState());
+}
+
+void* QHeaderView_SectionSizeFromContents(void* ptr, int logicalIndex)
+{
+	return ({ QSize tmpValue = static_cast<QHeaderView*>(ptr)->sectionSizeFromContents(logicalIndex); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QHeaderView_SectionSizeFromContentsDefault(void* ptr, int logicalIndex)
+{
+		return ({ QSize tmpValue = static_cast<QHeaderView*>(ptr)->QHeaderView::sectionSizeFromContents(logicalIndex); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+long long QHeaderView_DefaultAlignment(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->defaultAlignment();
+}
+
+long long QHeaderView_Orientation(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->orientation();
+}
+
+long long QHeaderView_SortIndicatorOrder(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->sortIndicatorOrder();
+}
+
+long long QHeaderView_SectionResizeMode(void* ptr, int logicalIndex)
+{
+	return static_cast<QHeaderView*>(ptr)->sectionResizeMode(logicalIndex);
+}
+
+char QHeaderView_CascadingSectionResizes(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->cascadingSectionResizes();
+}
+
+char QHeaderView_HighlightSections(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->highlightSections();
+}
+
+char QHeaderView_IsSectionHidden(void* ptr, int logicalIndex)
+{
+	return static_cast<QHeaderView*>(ptr)->isSectionHidden(logicalIndex);
+}
+
+char QHeaderView_IsSortIndicatorShown(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->isSortIndicatorShown();
+}
+
+char QHeaderView_SectionsClickable(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->sectionsClickable();
+}
+
+char QHeaderView_SectionsHidden(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->sectionsHidden();
+}
+
+char QHeaderView_SectionsMovable(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->sectionsMovable();
+}
+
+char QHeaderView_SectionsMoved(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->sectionsMoved();
+}
+
+char QHeaderView_StretchLastSection(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->stretchLastSection();
+}
+
+int QHeaderView_Count(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->count();
+}
+
+int QHeaderView_DefaultSectionSize(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->defaultSectionSize();
+}
+
+int QHeaderView_HiddenSectionCount(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->hiddenSectionCount();
+}
+
+int QHeaderView_HorizontalOffset(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->horizontalOffset();
+}
+
+int QHeaderView_HorizontalOffsetDefault(void* ptr)
+{
+		return static_cast<QHeaderView*>(ptr)->QHeaderView::horizontalOffset();
+}
+
+int QHeaderView_Length(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->length();
+}
+
+int QHeaderView_LogicalIndex(void* ptr, int visualIndex)
+{
+	return static_cast<QHeaderView*>(ptr)->logicalIndex(visualIndex);
+}
+
+int QHeaderView_LogicalIndexAt3(void* ptr, void* pos)
+{
+	return static_cast<QHeaderView*>(ptr)->logicalIndexAt(*static_cast<QPoint*>(pos));
+}
+
+int QHeaderView_LogicalIndexAt(void* ptr, int position)
+{
+	return static_cast<QHeaderView*>(ptr)->logicalIndexAt(position);
+}
+
+int QHeaderView_LogicalIndexAt2(void* ptr, int x, int y)
+{
+	return static_cast<QHeaderView*>(ptr)->logicalIndexAt(x, y);
+}
+
+int QHeaderView_MaximumSectionSize(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->maximumSectionSize();
+}
+
+int QHeaderView_MinimumSectionSize(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->minimumSectionSize();
+}
+
+int QHeaderView_Offset(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->offset();
+}
+
+int QHeaderView_ResizeContentsPrecision(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->resizeContentsPrecision();
+}
+
+int QHeaderView_SectionPosition(void* ptr, int logicalIndex)
+{
+	return static_cast<QHeaderView*>(ptr)->sectionPosition(logicalIndex);
+}
+
+int QHeaderView_SectionSize(void* ptr, int logicalIndex)
+{
+	return static_cast<QHeaderView*>(ptr)->sectionSize(logicalIndex);
+}
+
+int QHeaderView_SectionSizeHint(void* ptr, int logicalIndex)
+{
+	return static_cast<QHeaderView*>(ptr)->sectionSizeHint(logicalIndex);
+}
+
+int QHeaderView_SectionViewportPosition(void* ptr, int logicalIndex)
+{
+	return static_cast<QHeaderView*>(ptr)->sectionViewportPosition(logicalIndex);
+}
+
+int QHeaderView_SortIndicatorSection(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->sortIndicatorSection();
+}
+
+int QHeaderView_StretchSectionCount(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->stretchSectionCount();
+}
+
+int QHeaderView_VerticalOffset(void* ptr)
+{
+	return static_cast<QHeaderView*>(ptr)->verticalOffset();
+}
+
+int QHeaderView_VerticalOffsetDefault(void* ptr)
+{
+		return static_cast<QHeaderView*>(ptr)->QHeaderView::verticalOffset();
+}
+
+int QHeaderView_VisualIndex(void* ptr, int logicalIndex)
+{
+	return static_cast<QHeaderView*>(ptr)->visualIndex(logicalIndex);
+}
+
+int QHeaderView_VisualIndexAt(void* ptr, int position)
+{
+	return static_cast<QHeaderView*>(ptr)->visualIndexAt(position);
+}
+
+void QHeaderView_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QHeaderView*>(ptr)->initStyleOption(static_cast<QStyleOptionHeader*>(option));
+}
+
+void QHeaderView_PaintSection(void* ptr, void* painter, void* rect, int logicalIndex)
+{
+	static_cast<QHeaderView*>(ptr)->paintSection(static_cast<QPainter*>(painter), *static_cast<QRect*>(rect), logicalIndex);
+}
+
+void QHeaderView_PaintSectionDefault(void* ptr, void* painter, void* rect, int logicalIndex)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::paintSection(static_cast<QPainter*>(painter), *static_cast<QRect*>(rect), logicalIndex);
+}
+
+void* QHeaderView_MoveCursor(void* ptr, long long cursorAction, long long modifiers)
+{
+	return new QModelIndex(static_cast<QHeaderView*>(ptr)->moveCursor(static_cast<QAbstractItemView::CursorAction>(cursorAction), static_cast<Qt::KeyboardModifier>(modifiers)));
+}
+
+void* QHeaderView_MoveCursorDefault(void* ptr, long long cursorAction, long long modifiers)
+{
+		return new QModelIndex(static_cast<QHeaderView*>(ptr)->QHeaderView::moveCursor(static_cast<QAbstractItemView::CursorAction>(cursorAction), static_cast<Qt::KeyboardModifier>(modifiers)));
+}
+
+void QHeaderView_ScrollTo(void* ptr, void* index, long long hint)
+{
+	static_cast<QHeaderView*>(ptr)->scrollTo(*static_cast<QModelIndex*>(index), static_cast<QAbstractItemView::ScrollHint>(hint));
+}
+
+void QHeaderView_ScrollToDefault(void* ptr, void* index, long long hint)
+{
+		static_cast<QHeaderView*>(ptr)->QHeaderView::scrollTo(*static_cast<QModelIndex*>(index), static_cast<QAbstractItemView::ScrollHint>(hint));
+}
+
+void* QHeaderView_IndexAt(void* ptr, void* point)
+{
+	return new QModelIndex(static_cast<QHeaderView*>(ptr)->indexAt(*static_cast<QPoint*>(point)));
+}
+
+void* QHeaderView_IndexAtDefault(void* ptr, void* point)
+{
+		return new QModelIndex(static_cast<QHeaderView*>(ptr)->QHeaderView::indexAt(*static_cast<QPoint*>(point)));
+}
+
+void* QHeaderView_VisualRect(void* ptr, void* index)
+{
+	return ({ QRect tmpValue = static_cast<QHeaderView*>(ptr)->visualRect(*static_cast<QModelIndex*>(index)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QHeaderView_VisualRectDefault(void* ptr, void* index)
+{
+		return ({ QRect tmpValue = static_cast<QHeaderView*>(ptr)->QHeaderView::visualRect(*static_cast<QModelIndex*>(index)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QHeaderView_VisualRegionForSelection(void* ptr, void* selection)
+{
+	return new QRegion(static_cast<QHeaderView*>(ptr)->visualRegionForSelection(*static_cast<QItemSelection*>(selection)));
+}
+
+void* QHeaderView_VisualRegionForSelectionDefault(void* ptr, void* selection)
+{
+		return new QRegion(static_cast<QHeaderView*>(ptr)->QHeaderView::visualRegionForSelection(*static_cast<QItemSelection*>(selection)));
+}
+
+char QHeaderView_IsIndexHidden(void* ptr, void* index)
+{
+	return static_cast<QHeaderView*>(ptr)->isIndexHidden(*static_cast<QModelIndex*>(index));
+}
+
+char QHeaderView_IsIndexHiddenDefault(void* ptr, void* index)
+{
+		return static_cast<QHeaderView*>(ptr)->QHeaderView::isIndexHidden(*static_cast<QModelIndex*>(index));
+}
+
+class MyQInputDialog: public QInputDialog
+{
+public:
+	MyQInputDialog(QWidget *parent, Qt::WindowFlags flags) : QInputDialog(parent, flags) {};
+	void done(int result) { callbackQInputDialog_Done(this, result); };
+	void Signal_DoubleValueChanged(double value) { callbackQInputDialog_DoubleValueChanged(this, value); };
+	void Signal_DoubleValueSelected(double value) { callbackQInputDialog_DoubleValueSelected(this, value); };
+	void Signal_IntValueChanged(int value) { callbackQInputDialog_IntValueChanged(this, value); };
+	void Signal_IntValueSelected(int value) { callbackQInputDialog_IntValueSelected(this, value); };
+	void setVisible(bool visible) { callbackQDialog_SetVisible(this, visible); };
+	void Signal_TextValueChanged(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQInputDialog_TextValueChanged(this, textPacked); };
+	void Signal_TextValueSelected(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQInputDialog_TextValueSelected(this, textPacked); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	int exec() { return callbackQDialog_Exec(this); };
+	void accept() { callbackQDialog_Accept(this); };
+	void Signal_Accepted() { callbackQDialog_Accepted(this); };
+	void closeEvent(QCloseEvent * e) { callbackQWidget_CloseEvent(this, e); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void Signal_Finished(int result) { callbackQDialog_Finished(this, result); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void open() { callbackQDialog_Open(this); };
+	void reject() { callbackQDialog_Reject(this); };
+	void Signal_Rejected() { callbackQDialog_Rejected(this); };
+	void resizeEvent(QResizeEvent * vqr) { callbackQWidget_ResizeEvent(this, vqr); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QInputDialog_NewQInputDialog(void* parent, long long flags)
+{
+	return new MyQInputDialog(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(flags));
+}
+
+struct QtWidgets_PackedString QInputDialog_QInputDialog_GetItem(void* parent, char* title, char* label, char* items, int current, char editable, char ok, long long flags, long long inputMethodHints)
+{
+		return ({ QByteArray t17f816 = QInputDialog::getItem(static_cast<QWidget*>(parent), QString(title), QString(label), goUnpackStringList(items), current, editable != 0, NULL, static_cast<Qt::WindowType>(flags), static_cast<Qt::InputMethodHint>(inputMethodHints)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t17f816.prepend("WHITESPACE").constData()+10), t17f816.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QInputDialog_QInputDialog_GetMultiLineText(void* parent, char* title, char* label, char* text, char ok, long long flags, long long inputMethodHints)
+{
+		return ({ QByteArray t808af0 = QInputDialog::getMultiLineText(static_cast<QWidget*>(parent), QString(title), QString(label), QString(text), NULL, static_cast<Qt::WindowType>(flags), static_cast<Qt::InputMethodHint>(inputMethodHints)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t808af0.prepend("WHITESPACE").constData()+10), t808af0.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QInputDialog_QInputDialog_GetText(void* parent, char* title, char* label, long long mode, char* text, char ok, long long flags, long long inputMethodHints)
+{
+		return ({ QByteArray t06a16f = QInputDialog::getText(static_cast<QWidget*>(parent), QString(title), QString(label), static_cast<QLineEdit::EchoMode>(mode), QString(text), NULL, static_cast<Qt::WindowType>(flags), static_cast<Qt::InputMethodHint>(inputMethodHints)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t06a16f.prepend("WHITESPACE").constData()+10), t06a16f.size()-10 }; });
+}
+
+double QInputDialog_QInputDialog_GetDouble(void* parent, char* title, char* label, double value, double min, double max, int decimals, char ok, long long flags)
+{
+		return QInputDialog::getDouble(static_cast<QWidget*>(parent), QString(title), QString(label), value, min, max, decimals, NULL, static_cast<Qt::WindowType>(flags));
+}
+
+int QInputDialog_QInputDialog_GetInt(void* parent, char* title, char* label, int value, int min, int max, int step, char ok, long long flags)
+{
+		return QInputDialog::getInt(static_cast<QWidget*>(parent), QString(title), QString(label), value, min, max, step, NULL, static_cast<Qt::WindowType>(flags));
+}
+
+void QInputDialog_Done(void* ptr, int result)
+{
+	static_cast<QInputDialog*>(ptr)->done(result);
+}
+
+void QInputDialog_DoneDefault(void* ptr, int result)
+{
+		static_cast<QInputDialog*>(ptr)->QInputDialog::done(result);
+}
+
+void QInputDialog_ConnectDoubleValueChanged(void* ptr)
+{
+	QObject::connect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(double)>(&QInputDialog::doubleValueChanged), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(double)>(&MyQInputDialog::Signal_DoubleValueChanged));
+}
+
+void QInputDialog_DisconnectDoubleValueChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(double)>(&QInputDialog::doubleValueChanged), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(double)>(&MyQInputDialog::Signal_DoubleValueChanged));
+}
+
+void QInputDialog_DoubleValueChanged(void* ptr, double value)
+{
+	static_cast<QInputDialog*>(ptr)->doubleValueChanged(value);
+}
+
+void QInputDialog_ConnectDoubleValueSelected(void* ptr)
+{
+	QObject::connect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(double)>(&QInputDialog::doubleValueSelected), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(double)>(&MyQInputDialog::Signal_DoubleValueSelected));
+}
+
+void QInputDialog_DisconnectDoubleValueSelected(void* ptr)
+{
+	QObject::disconnect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(double)>(&QInputDialog::doubleValueSelected), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(double)>(&MyQInputDialog::Signal_DoubleValueSelected));
+}
+
+void QInputDialog_DoubleValueSelected(void* ptr, double value)
+{
+	static_cast<QInputDialog*>(ptr)->doubleValueSelected(value);
+}
+
+void QInputDialog_ConnectIntValueChanged(void* ptr)
+{
+	QObject::connect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(int)>(&QInputDialog::intValueChanged), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(int)>(&MyQInputDialog::Signal_IntValueChanged));
+}
+
+void QInputDialog_DisconnectIntValueChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(int)>(&QInputDialog::intValueChanged), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(int)>(&MyQInputDialog::Signal_IntValueChanged));
+}
+
+void QInputDialog_IntValueChanged(void* ptr, int value)
+{
+	static_cast<QInputDialog*>(ptr)->intValueChanged(value);
+}
+
+void QInputDialog_ConnectIntValueSelected(void* ptr)
+{
+	QObject::connect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(int)>(&QInputDialog::intValueSelected), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(int)>(&MyQInputDialog::Signal_IntValueSelected));
+}
+
+void QInputDialog_DisconnectIntValueSelected(void* ptr)
+{
+	QObject::disconnect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(int)>(&QInputDialog::intValueSelected), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(int)>(&MyQInputDialog::Signal_IntValueSelected));
+}
+
+void QInputDialog_IntValueSelected(void* ptr, int value)
+{
+	static_cast<QInputDialog*>(ptr)->intValueSelected(value);
+}
+
+void QInputDialog_Open(void* ptr, void* receiver, char* member)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(receiver))) {
+		static_cast<QInputDialog*>(ptr)->open(static_cast<QGraphicsObject*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QInputDialog*>(ptr)->open(static_cast<QGraphicsWidget*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(receiver))) {
+		static_cast<QInputDialog*>(ptr)->open(static_cast<QLayout*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QInputDialog*>(ptr)->open(static_cast<QWidget*>(receiver), const_cast<const char*>(member));
+	} else {
+		static_cast<QInputDialog*>(ptr)->open(static_cast<QObject*>(receiver), const_cast<const char*>(member));
+	}
+}
+
+void QInputDialog_SetCancelButtonText(void* ptr, char* text)
+{
+	static_cast<QInputDialog*>(ptr)->setCancelButtonText(QString(text));
+}
+
+void QInputDialog_SetComboBoxEditable(void* ptr, char editable)
+{
+	static_cast<QInputDialog*>(ptr)->setComboBoxEditable(editable != 0);
+}
+
+void QInputDialog_SetComboBoxItems(void* ptr, char* items)
+{
+	static_cast<QInputDialog*>(ptr)->setComboBoxItems(goUnpackStringList(items));
+}
+
+void QInputDialog_SetDoubleDecimals(void* ptr, int decimals)
+{
+	static_cast<QInputDialog*>(ptr)->setDoubleDecimals(decimals);
+}
+
+void QInputDialog_SetDoubleMaximum(void* ptr, double max)
+{
+	static_cast<QInputDialog*>(ptr)->setDoubleMaximum(max);
+}
+
+void QInputDialog_SetDoubleMinimum(void* ptr, double min)
+{
+	static_cast<QInputDialog*>(ptr)->setDoubleMinimum(min);
+}
+
+void QInputDialog_SetDoubleRange(void* ptr, double min, double max)
+{
+	static_cast<QInputDialog*>(ptr)->setDoubleRange(min, max);
+}
+
+void QInputDialog_SetDoubleValue(void* ptr, double value)
+{
+	static_cast<QInputDialog*>(ptr)->setDoubleValue(value);
+}
+
+void QInputDialog_SetInputMode(void* ptr, long long mode)
+{
+	static_cast<QInputDialog*>(ptr)->setInputMode(static_cast<QInputDialog::InputMode>(mode));
+}
+
+void QInputDialog_SetIntMaximum(void* ptr, int max)
+{
+	static_cast<QInputDialog*>(ptr)->setIntMaximum(max);
+}
+
+void QInputDialog_SetIntMinimum(void* ptr, int min)
+{
+	static_cast<QInputDialog*>(ptr)->setIntMinimum(min);
+}
+
+void QInputDialog_SetIntRange(void* ptr, int min, int max)
+{
+	static_cast<QInputDialog*>(ptr)->setIntRange(min, max);
+}
+
+void QInputDialog_SetIntStep(void* ptr, int step)
+{
+	static_cast<QInputDialog*>(ptr)->setIntStep(step);
+}
+
+void QInputDialog_SetIntValue(void* ptr, int value)
+{
+	static_cast<QInputDialog*>(ptr)->setIntValue(value);
+}
+
+void QInputDialog_SetLabelText(void* ptr, char* text)
+{
+	static_cast<QInputDialog*>(ptr)->setLabelText(QString(text));
+}
+
+void QInputDialog_SetOkButtonText(void* ptr, char* text)
+{
+	static_cast<QInputDialog*>(ptr)->setOkButtonText(QString(text));
+}
+
+void QInputDialog_SetOption(void* ptr, long long option, char on)
+{
+	static_cast<QInputDialog*>(ptr)->setOption(static_cast<QInputDialog::InputDialogOption>(option), on != 0);
+}
+
+void QInputDialog_SetOptions(void* ptr, long long options)
+{
+	static_cast<QInputDialog*>(ptr)->setOptions(static_cast<QInputDialog::InputDialogOption>(options));
+}
+
+void QInputDialog_SetTextEchoMode(void* ptr, long long mode)
+{
+	static_cast<QInputDialog*>(ptr)->setTextEchoMode(static_cast<QLineEdit::EchoMode>(mode));
+}
+
+void QInputDialog_SetTextValue(void* ptr, char* text)
+{
+	static_cast<QInputDialog*>(ptr)->setTextValue(QString(text));
+}
+
+void QInputDialog_ConnectTextValueChanged(void* ptr)
+{
+	QObject::connect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(const QString &)>(&QInputDialog::textValueChanged), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(const QString &)>(&MyQInputDialog::Signal_TextValueChanged));
+}
+
+void QInputDialog_DisconnectTextValueChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(const QString &)>(&QInputDialog::textValueChanged), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(const QString &)>(&MyQInputDialog::Signal_TextValueChanged));
+}
+
+void QInputDialog_TextValueChanged(void* ptr, char* text)
+{
+	static_cast<QInputDialog*>(ptr)->textValueChanged(QString(text));
+}
+
+void QInputDialog_ConnectTextValueSelected(void* ptr)
+{
+	QObject::connect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(const QString &)>(&QInputDialog::textValueSelected), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(const QString &)>(&MyQInputDialog::Signal_TextValueSelected));
+}
+
+void QInputDialog_DisconnectTextValueSelected(void* ptr)
+{
+	QObject::disconnect(static_cast<QInputDialog*>(ptr), static_cast<void (QInputDialog::*)(const QString &)>(&QInputDialog::textValueSelected), static_cast<MyQInputDialog*>(ptr), static_cast<void (MyQInputDialog::*)(const QString &)>(&MyQInputDialog::Signal_TextValueSelected));
+}
+
+void QInputDialog_TextValueSelected(void* ptr, char* text)
+{
+	static_cast<QInputDialog*>(ptr)->textValueSelected(QString(text));
+}
+
+void QInputDialog_DestroyQInputDialog(void* ptr)
+{
+	static_cast<QInputDialog*>(ptr)->~QInputDialog();
+}
+
+long long QInputDialog_Options(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->options();
+}
+
+long long QInputDialog_InputMode(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->inputMode();
+}
+
+long long QInputDialog_TextEchoMode(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->textEchoMode();
+}
+
+struct QtWidgets_PackedString QInputDialog_CancelButtonText(void* ptr)
+{
+	return ({ QByteArray t24ff21 = static_cast<QInputDialog*>(ptr)->cancelButtonText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t24ff21.prepend("WHITESPACE").constData()+10), t24ff21.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QInputDialog_LabelText(void* ptr)
+{
+	return ({ QByteArray tf75eaa = static_cast<QInputDialog*>(ptr)->labelText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tf75eaa.prepend("WHITESPACE").constData()+10), tf75eaa.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QInputDialog_OkButtonText(void* ptr)
+{
+	return ({ QByteArray t1d4e9a = static_cast<QInputDialog*>(ptr)->okButtonText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t1d4e9a.prepend("WHITESPACE").constData()+10), t1d4e9a.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QInputDialog_TextValue(void* ptr)
+{
+	return ({ QByteArray t1ee8b9 = static_cast<QInputDialog*>(ptr)->textValue().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t1ee8b9.prepend("WHITESPACE").constData()+10), t1ee8b9.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QInputDialog_ComboBoxItems(void* ptr)
+{
+	return ({ long long t976d54len; char* t976d54 = goPackStringList(static_cast<QInputDialog*>(ptr)->comboBoxItems(), &t976d54len); QtWidgets_PackedString { t976d54, t976d54len }; });
+}
+
+char QInputDialog_IsComboBoxEditable(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->isComboBoxEditable();
+}
+
+char QInputDialog_TestOption(void* ptr, long long option)
+{
+	return static_cast<QInputDialog*>(ptr)->testOption(static_cast<QInputDialog::InputDialogOption>(option));
+}
+
+double QInputDialog_DoubleMaximum(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->doubleMaximum();
+}
+
+double QInputDialog_DoubleMinimum(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->doubleMinimum();
+}
+
+double QInputDialog_DoubleValue(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->doubleValue();
+}
+
+int QInputDialog_DoubleDecimals(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->doubleDecimals();
+}
+
+int QInputDialog_IntMaximum(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->intMaximum();
+}
+
+int QInputDialog_IntMinimum(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->intMinimum();
+}
+
+int QInputDialog_IntStep(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->intStep();
+}
+
+int QInputDialog_IntValue(void* ptr)
+{
+	return static_cast<QInputDialog*>(ptr)->intValue();
+}
+
+class MyQItemDelegate: public QItemDelegate
+{
+public:
+	MyQItemDelegate(QObject *parent) : QItemDelegate(parent) {};
+	bool editorEvent(QEvent * event, QAbstractItemModel * model, const QStyleOptionViewItem & option, const QModelIndex & index) { return callbackQAbstractItemDelegate_EditorEvent(this, event, model, const_cast<QStyleOptionViewItem*>(&option), const_cast<QModelIndex*>(&index)) != 0; };
+	bool eventFilter(QObject * editor, QEvent * event) { return callbackQAbstractItemDelegate_EventFilter(this, editor, event) != 0; };
+	QSize sizeHint(const QStyleOptionViewItem & option, const QModelIndex & index) const { return *static_cast<QSize*>(callbackQItemDelegate_SizeHint(const_cast<void*>(static_cast<const void*>(this)), const_cast<QStyleOptionViewItem*>(&option), const_cast<QModelIndex*>(&index))); };
+	QWidget * createEditor(QWidget * parent, const QStyleOptionViewItem & option, const QModelIndex & index) const { return static_cast<QWidget*>(callbackQAbstractItemDelegate_CreateEditor(const_cast<void*>(static_cast<const void*>(this)), parent, const_cast<QStyleOptionViewItem*>(&option), const_cast<QModelIndex*>(&index))); };
+	void drawCheck(QPainter * painter, const QStyleOptionViewItem & option, const QRect & rect, Qt::CheckState state) const { callbackQItemDelegate_DrawCheck(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QStyleOptionViewItem*>(&option), const_cast<QRect*>(&rect), state); };
+	void drawDecoration(QPainter * painter, const QStyleOptionViewItem & option, const QRect & rect, const QPixmap & pixmap) const { callbackQItemDelegate_DrawDecoration(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QStyleOptionViewItem*>(&option), const_cast<QRect*>(&rect), const_cast<QPixmap*>(&pixmap)); };
+	void drawDisplay(QPainter * painter, const QStyleOptionViewItem & option, const QRect & rect, const QString & text) const { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQItemDelegate_DrawDisplay(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QStyleOptionViewItem*>(&option), const_cast<QRect*>(&rect), textPacked); };
+	void drawFocus(QPainter * painter, const QStyleOptionViewItem & option, const QRect & rect) const { callbackQItemDelegate_DrawFocus(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QStyleOptionViewItem*>(&option), const_cast<QRect*>(&rect)); };
+	void paint(QPainter * painter, const QStyleOptionViewItem & option, const QModelIndex & index) const { callbackQItemDelegate_Paint(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QStyleOptionViewItem*>(&option), const_cast<QModelIndex*>(&index)); };
+	void setEditorData(QWidget * editor, const QModelIndex & index) const { callbackQAbstractItemDelegate_SetEditorData(const_cast<void*>(static_cast<const void*>(this)), editor, const_cast<QModelIndex*>(&index)); };
+	void setModelData(QWidget * editor, QAbstractItemModel * model, const QModelIndex & index) const { callbackQAbstractItemDelegate_SetModelData(const_cast<void*>(static_cast<const void*>(this)), editor, model, const_cast<QModelIndex*>(&index)); };
+	void updateEditorGeometry(QWidget * editor, const QStyleOptionViewItem & option, const QModelIndex & index) const { callbackQAbstractItemDelegate_UpdateEditorGeometry(const_cast<void*>(static_cast<const void*>(this)), editor, const_cast<QStyleOptionViewItem*>(&option), const_cast<QModelIndex*>(&index)); };
+	bool helpEvent(QHelpEvent * event, QAbstractItemView * view, const QStyleOptionViewItem & option, const QModelIndex & index) { return callbackQAbstractItemDelegate_HelpEvent(this, event, view, const_cast<QStyleOptionViewItem*>(&option), const_cast<QModelIndex*>(&index)) != 0; };
+	void Signal_CloseEditor(QWidget * editor, QAbstractItemDelegate::EndEditHint hint) { callbackQAbstractItemDelegate_CloseEditor(this, editor, hint); };
+	void Signal_CommitData(QWidget * editor) { callbackQAbstractItemDelegate_CommitData(this, editor); };
+	void Signal_SizeHintChanged(const QModelIndex & index) { callbackQAbstractItemDelegate_SizeHintChanged(this, const_cast<QModelIndex*>(&index)); };
+	void destroyEditor(QWidget * editor, const QModelIndex & index) const { callbackQAbstractItemDelegate_DestroyEditor(const_cast<void*>(static_cast<const void*>(this)), editor, const_cast<QModelIndex*>(&index)); };
+	bool event(QEvent * e) { return callbackQAbstractItemDelegate_Event(this, e) != 0; };
+	void childEvent(QChildEvent * event) { callbackQAbstractItemDelegate_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQAbstractItemDelegate_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQAbstractItemDelegate_CustomEvent(this, event); };
+	void deleteLater() { callbackQAbstractItemDelegate_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQAbstractItemDelegate_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQAbstractItemDelegate_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQAbstractItemDelegate_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQAbstractItemDelegate_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQAbstractItemDelegate_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QItemDelegate_NewQItemDelegate(void* parent)
+{
+	return new MyQItemDelegate(static_cast<QObject*>(parent));
+}
+
+void QItemDelegate_SetClipping(void* ptr, char clip)
+{
+	static_cast<QItemDelegate*>(ptr)->setClipping(clip != 0);
+}
+
+void QItemDelegate_SetItemEditorFactory(void* ptr, void* factory)
+{
+	static_cast<QItemDelegate*>(ptr)->setItemEditorFactory(static_cast<QItemEditorFactory*>(factory));
+}
+
+void QItemDelegate_DestroyQItemDelegate(void* ptr)
+{
+	static_cast<QItemDelegate*>(ptr)->~QItemDelegate();
+}
+
+void* QItemDelegate_ItemEditorFactory(void* ptr)
+{
+	return static_cast<QItemDelegate*>(ptr)->itemEditorFactory();
+}
+
+void* QItemDelegate_SizeHint(void* ptr, void* option, void* index)
+{
+	return ({ QSize tmpValue = static_cast<QItemDelegate*>(ptr)->sizeHint(*static_cast<QStyleOptionViewItem*>(option), *static_cast<QModelIndex*>(index)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QItemDelegate_SizeHintDefault(void* ptr, void* option, void* index)
+{
+		return ({ QSize tmpValue = static_cast<QItemDelegate*>(ptr)->QItemDelegate::sizeHint(*static_cast<QStyleOptionViewItem*>(option), *static_cast<QModelIndex*>(index)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+char QItemDelegate_HasClipping(void* ptr)
+{
+	return static_cast<QItemDelegate*>(ptr)->hasClipping();
+}
+
+void QItemDelegate_DrawBackground(void* ptr, void* painter, void* option, void* index)
+{
+	static_cast<QItemDelegate*>(ptr)->drawBackground(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QModelIndex*>(index));
+}
+
+void QItemDelegate_DrawCheck(void* ptr, void* painter, void* option, void* rect, long long state)
+{
+	static_cast<QItemDelegate*>(ptr)->drawCheck(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QRect*>(rect), static_cast<Qt::CheckState>(state));
+}
+
+void QItemDelegate_DrawCheckDefault(void* ptr, void* painter, void* option, void* rect, long long state)
+{
+		static_cast<QItemDelegate*>(ptr)->QItemDelegate::drawCheck(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QRect*>(rect), static_cast<Qt::CheckState>(state));
+}
+
+void QItemDelegate_DrawDecoration(void* ptr, void* painter, void* option, void* rect, void* pixmap)
+{
+	static_cast<QItemDelegate*>(ptr)->drawDecoration(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QRect*>(rect), *static_cast<QPixmap*>(pixmap));
+}
+
+void QItemDelegate_DrawDecorationDefault(void* ptr, void* painter, void* option, void* rect, void* pixmap)
+{
+		static_cast<QItemDelegate*>(ptr)->QItemDelegate::drawDecoration(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QRect*>(rect), *static_cast<QPixmap*>(pixmap));
+}
+
+void QItemDelegate_DrawDisplay(void* ptr, void* painter, void* option, void* rect, char* text)
+{
+	static_cast<QItemDelegate*>(ptr)->drawDisplay(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QRect*>(rect), QString(text));
+}
+
+void QItemDelegate_DrawDisplayDefault(void* ptr, void* painter, void* option, void* rect, char* text)
+{
+		static_cast<QItemDelegate*>(ptr)->QItemDelegate::drawDisplay(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QRect*>(rect), QString(text));
+}
+
+void QItemDelegate_DrawFocus(void* ptr, void* painter, void* option, void* rect)
+{
+	static_cast<QItemDelegate*>(ptr)->drawFocus(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QRect*>(rect));
+}
+
+void QItemDelegate_DrawFocusDefault(void* ptr, void* painter, void* option, void* rect)
+{
+		static_cast<QItemDelegate*>(ptr)->QItemDelegate::drawFocus(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QRect*>(rect));
+}
+
+void QItemDelegate_Paint(void* ptr, void* painter, void* option, void* index)
+{
+	static_cast<QItemDelegate*>(ptr)->paint(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QModelIndex*>(index));
+}
+
+void QItemDelegate_PaintDefault(void* ptr, void* painter, void* option, void* index)
+{
+		static_cast<QItemDelegate*>(ptr)->QItemDelegate::paint(static_cast<QPainter*>(painter), *static_cast<QStyleOptionViewItem*>(option), *static_cast<QModelIndex*>(index));
+}
+
+class MyQItemEditorCreatorBase: public QItemEditorCreatorBase
+{
+public:
+	 ~MyQItemEditorCreatorBase() { callbackQItemEditorCreatorBase_DestroyQItemEditorCreatorBase(this); };
+	QByteArray valuePropertyName() const { return *static_cast<QByteArray*>(callbackQItemEditorCreatorBase_ValuePropertyName(const_cast<void*>(static_cast<const void*>(this)))); };
+	QWidget * createWidget(QWidget * parent) const { return static_cast<QWidget*>(callbackQItemEditorCreatorBase_CreateWidget(const_cast<void*>(static_cast<const void*>(this)), parent)); };
+};
+
+void QItemEditorCreatorBase_DestroyQItemEditorCreatorBase(void* ptr)
+{
+	static_cast<QItemEditorCreatorBase*>(ptr)->~QItemEditorCreatorBase();
+}
+
+void QItemEditorCreatorBase_DestroyQItemEditorCreatorBaseDefault(void* ptr)
+{
+
+}
+
+void* QItemEditorCreatorBase_ValuePropertyName(void* ptr)
+{
+	return new QByteArray(static_cast<QItemEditorCreatorBase*>(ptr)->valuePropertyName());
+}
+
+void* QItemEditorCreatorBase_CreateWidget(void* ptr, void* parent)
+{
+		return static_cast<QItemEditorCreatorBase*>(ptr)->createWidget(static_cast<QWidget*>(parent));
+}
+
+class MyQItemEditorFactory: public QItemEditorFactory
+{
+public:
+	MyQItemEditorFactory() : QItemEditorFactory() {};
+	 ~MyQItemEditorFactory() { callbackQItemEditorFactory_DestroyQItemEditorFactory(this); };
+	QByteArray valuePropertyName(int userType) const { return *static_cast<QByteArray*>(callbackQItemEditorFactory_ValuePropertyName(const_cast<void*>(static_cast<const void*>(this)), userType)); };
+	QWidget * createEditor(int userType, QWidget * parent) const { return static_cast<QWidget*>(callbackQItemEditorFactory_CreateEditor(const_cast<void*>(static_cast<const void*>(this)), userType, parent)); };
+};
+
+void* QItemEditorFactory_NewQItemEditorFactory()
+{
+	return new MyQItemEditorFactory();
+}
+
+void* QItemEditorFactory_QItemEditorFactory_DefaultFactory()
+{
+	return const_cast<QItemEditorFactory*>(QItemEditorFactory::defaultFactory());
+}
+
+void QItemEditorFactory_RegisterEditor(void* ptr, int userType, void* creator)
+{
+	static_cast<QItemEditorFactory*>(ptr)->registerEditor(userType, static_cast<QItemEditorCreatorBase*>(creator));
+}
+
+void QItemEditorFactory_QItemEditorFactory_SetDefaultFactory(void* factory)
+{
+	QItemEditorFactory::setDefaultFactory(static_cast<QItemEditorFactory*>(factory));
+}
+
+void QItemEditorFactory_DestroyQItemEditorFactory(void* ptr)
+{
+	static_cast<QItemEditorFactory*>(ptr)->~QItemEditorFactory();
+}
+
+void QItemEditorFactory_DestroyQItemEditorFactoryDefault(void* ptr)
+{
+
+}
+
+void* QItemEditorFactory_ValuePropertyName(void* ptr, int userType)
+{
+	return new QByteArray(static_cast<QItemEditorFactory*>(ptr)->valuePropertyName(userType));
+}
+
+void* QItemEditorFactory_ValuePropertyNameDefault(void* ptr, int userType)
+{
+		return new QByteArray(static_cast<QItemEditorFactory*>(ptr)->QItemEditorFactory::valuePropertyName(userType));
+}
+
+void* QItemEditorFactory_CreateEditor(void* ptr, int userType, void* parent)
+{
+		return static_cast<QItemEditorFactory*>(ptr)->createEditor(userType, static_cast<QWidget*>(parent));
+}
+
+void* QItemEditorFactory_CreateEditorDefault(void* ptr, int userType, void* parent)
+{
+		return static_cast<QItemEditorFactory*>(ptr)->QItemEditorFactory::createEditor(userType, static_cast<QWidget*>(parent));
+}
+
+class MyQKeyEventTransition: public QKeyEventTransition
+{
+public:
+	MyQKeyEventTransition(QObject *object, QEvent::Type type, int key, QState *sourceState) : QKeyEventTransition(object, type, key, sourceState) {};
+	MyQKeyEventTransition(QState *sourceState) : QKeyEventTransition(sourceState) {};
+	bool eventTest(QEvent * event) { return callbackQKeyEventTransition_EventTest(this, event) != 0; };
+	void onTransition(QEvent * event) { callbackQKeyEventTransition_OnTransition(this, event); };
+	bool event(QEvent * e) { return callbackQKeyEventTransition_Event(this, e) != 0; };
+	void Signal_TargetStateChanged() { callbackQKeyEventTransition_TargetStateChanged(this); };
+	void Signal_TargetStatesChanged() { callbackQKeyEventTransition_TargetStatesChanged(this); };
+	void Signal_Triggered() { callbackQKeyEventTransition_Triggered(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQKeyEventTransition_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQKeyEventTransition_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQKeyEventTransition_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQKeyEventTransition_CustomEvent(this, event); };
+	void deleteLater() { callbackQKeyEventTransition_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQKeyEventTransition_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQKeyEventTransition_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQKeyEventTransition_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQKeyEventTransition_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQKeyEventTransition_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QKeyEventTransition_NewQKeyEventTransition2(void* object, long long ty, int key, void* sourceState)
+{
+	return new MyQKeyEventTransition(static_cast<QObject*>(object), static_cast<QEvent::Type>(ty), key, static_cast<QState*>(sourceState));
+}
+
+void* QKeyEventTransition_NewQKeyEventTransition(void* sourceState)
+{
+	return new MyQKeyEventTransition(static_cast<QState*>(sourceState));
+}
+
+char QKeyEventTransition_EventTestDefault(void* ptr, void* event)
+{
+		return static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::eventTest(static_cast<QEvent*>(event));
+}
+
+void QKeyEventTransition_OnTransitionDefault(void* ptr, void* event)
+{
+		static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::onTransition(static_cast<QEvent*>(event));
+}
+
+void QKeyEventTransition_SetKey(void* ptr, int key)
+{
+	static_cast<QKeyEventTransition*>(ptr)->setKey(key);
+}
+
+void QKeyEventTransition_SetModifierMask(void* ptr, long long modifierMask)
+{
+	static_cast<QKeyEventTransition*>(ptr)->setModifierMask(static_cast<Qt::KeyboardModifier>(modifierMask));
+}
+
+void QKeyEventTransition_DestroyQKeyEventTransition(void* ptr)
+{
+	static_cast<QKeyEventTransition*>(ptr)->~QKeyEventTransition();
+}
+
+long long QKeyEventTransition_ModifierMask(void* ptr)
+{
+	return static_cast<QKeyEventTransition*>(ptr)->modifierMask();
+}
+
+int QKeyEventTransition_Key(void* ptr)
+{
+	return static_cast<QKeyEventTransition*>(ptr)->key();
+}
+
+void* QKeyEventTransition___setTargetStates_targets_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractState*>(static_cast<QList<QAbstractState *>*>(ptr)->at(i));
+}
+
+void QKeyEventTransition___setTargetStates_targets_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractState *>*>(ptr)->append(static_cast<QAbstractState*>(i));
+}
+
+void* QKeyEventTransition___setTargetStates_targets_newList(void* ptr)
+{
+	return new QList<QAbstractState *>;
+}
+
+void* QKeyEventTransition___animations_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractAnimation*>(static_cast<QList<QAbstractAnimation *>*>(ptr)->at(i));
+}
+
+void QKeyEventTransition___animations_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractAnimation *>*>(ptr)->append(static_cast<QAbstractAnimation*>(i));
+}
+
+void* QKeyEventTransition___animations_newList(void* ptr)
+{
+	return new QList<QAbstractAnimation *>;
+}
+
+void* QKeyEventTransition___targetStates_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractState*>(static_cast<QList<QAbstractState *>*>(ptr)->at(i));
+}
+
+void QKeyEventTransition___targetStates_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractState *>*>(ptr)->append(static_cast<QAbstractState*>(i));
+}
+
+void* QKeyEventTransition___targetStates_newList(void* ptr)
+{
+	return new QList<QAbstractState *>;
+}
+
+void* QKeyEventTransition___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QKeyEventTransition___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QKeyEventTransition___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QKeyEventTransition___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QKeyEventTransition___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QKeyEventTransition___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QKeyEventTransition___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QKeyEventTransition___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QKeyEventTransition___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QKeyEventTransition___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QKeyEventTransition___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QKeyEventTransition___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QKeyEventTransition___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QKeyEventTransition___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QKeyEventTransition___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QKeyEventTransition_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::event(static_cast<QEvent*>(e));
+}
+
+char QKeyEventTransition_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QKeyEventTransition_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QKeyEventTransition_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QKeyEventTransition_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::customEvent(static_cast<QEvent*>(event));
+}
+
+void QKeyEventTransition_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::deleteLater();
+}
+
+void QKeyEventTransition_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QKeyEventTransition_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QKeyEventTransition_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QKeyEventTransition*>(ptr)->QKeyEventTransition::metaObject());
+}
+
+class MyQKeySequenceEdit: public QKeySequenceEdit
+{
+public:
+	MyQKeySequenceEdit(QWidget *parent) : QKeySequenceEdit(parent) {};
+	MyQKeySequenceEdit(const QKeySequence &keySequence, QWidget *parent) : QKeySequenceEdit(keySequence, parent) {};
+	void clear() { callbackQKeySequenceEdit_Clear(this); };
+	void Signal_EditingFinished() { callbackQKeySequenceEdit_EditingFinished(this); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void keyReleaseEvent(QKeyEvent * e) { callbackQWidget_KeyReleaseEvent(this, e); };
+	void Signal_KeySequenceChanged(const QKeySequence & keySequence) { callbackQKeySequenceEdit_KeySequenceChanged(this, const_cast<QKeySequence*>(&keySequence)); };
+	void setKeySequence(const QKeySequence & keySequence) { callbackQKeySequenceEdit_SetKeySequence(this, const_cast<QKeySequence*>(&keySequence)); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QKeySequenceEdit_NewQKeySequenceEdit(void* parent)
+{
+	return new MyQKeySequenceEdit(static_cast<QWidget*>(parent));
+}
+
+void* QKeySequenceEdit_NewQKeySequenceEdit2(void* keySequence, void* parent)
+{
+	return new MyQKeySequenceEdit(*static_cast<QKeySequence*>(keySequence), static_cast<QWidget*>(parent));
+}
+
+void QKeySequenceEdit_Clear(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QKeySequenceEdit*>(ptr), "clear");
+}
+
+void QKeySequenceEdit_ClearDefault(void* ptr)
+{
+		static_cast<QKeySequenceEdit*>(ptr)->QKeySequenceEdit::clear();
+}
+
+void QKeySequenceEdit_ConnectEditingFinished(void* ptr)
+{
+	QObject::connect(static_cast<QKeySequenceEdit*>(ptr), static_cast<void (QKeySequenceEdit::*)()>(&QKeySequenceEdit::editingFinished), static_cast<MyQKeySequenceEdit*>(ptr), static_cast<void (MyQKeySequenceEdit::*)()>(&MyQKeySequenceEdit::Signal_EditingFinished));
+}
+
+void QKeySequenceEdit_DisconnectEditingFinished(void* ptr)
+{
+	QObject::disconnect(static_cast<QKeySequenceEdit*>(ptr), static_cast<void (QKeySequenceEdit::*)()>(&QKeySequenceEdit::editingFinished), static_cast<MyQKeySequenceEdit*>(ptr), static_cast<void (MyQKeySequenceEdit::*)()>(&MyQKeySequenceEdit::Signal_EditingFinished));
+}
+
+void QKeySequenceEdit_EditingFinished(void* ptr)
+{
+	static_cast<QKeySequenceEdit*>(ptr)->editingFinished();
+}
+
+void QKeySequenceEdit_ConnectKeySequenceChanged(void* ptr)
+{
+	QObject::connect(static_cast<QKeySequenceEdit*>(ptr), static_cast<void (QKeySequenceEdit::*)(const QKeySequence &)>(&QKeySequenceEdit::keySequenceChanged), static_cast<MyQKeySequenceEdit*>(ptr), static_cast<void (MyQKeySequenceEdit::*)(const QKeySequence &)>(&MyQKeySequenceEdit::Signal_KeySequenceChanged));
+}
+
+void QKeySequenceEdit_DisconnectKeySequenceChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QKeySequenceEdit*>(ptr), static_cast<void (QKeySequenceEdit::*)(const QKeySequence &)>(&QKeySequenceEdit::keySequenceChanged), static_cast<MyQKeySequenceEdit*>(ptr), static_cast<void (MyQKeySequenceEdit::*)(const QKeySequence &)>(&MyQKeySequenceEdit::Signal_KeySequenceChanged));
+}
+
+void QKeySequenceEdit_KeySequenceChanged(void* ptr, void* keySequence)
+{
+	static_cast<QKeySequenceEdit*>(ptr)->keySequenceChanged(*static_cast<QKeySequence*>(keySequence));
+}
+
+void QKeySequenceEdit_SetKeySequence(void* ptr, void* keySequence)
+{
+	QMetaObject::invokeMethod(static_cast<QKeySequenceEdit*>(ptr), "setKeySequence", Q_ARG(QKeySequence, *static_cast<QKeySequence*>(keySequence)));
+}
+
+void QKeySequenceEdit_SetKeySequenceDefault(void* ptr, void* keySequence)
+{
+		static_cast<QKeySequenceEdit*>(ptr)->QKeySequenceEdit::setKeySequence(*static_cast<QKeySequence*>(keySequence));
+}
+
+void QKeySequenceEdit_DestroyQKeySequenceEdit(void* ptr)
+{
+	static_cast<QKeySequenceEdit*>(ptr)->~QKeySequenceEdit();
+}
+
+void* QKeySequenceEdit_KeySequence(void* ptr)
+{
+	return new QKeySequence(static_cast<QKeySequenceEdit*>(ptr)->keySequence());
+}
+
+class MyQLCDNumber: public QLCDNumber
+{
+public:
+	MyQLCDNumber(QWidget *parent) : QLCDNumber(parent) {};
+	MyQLCDNumber(uint numDigits, QWidget *parent) : QLCDNumber(numDigits, parent) {};
+	void display(const QString & s) { QByteArray ta0f149 = s.toUtf8(); QtWidgets_PackedString sPacked = { const_cast<char*>(ta0f149.prepend("WHITESPACE").constData()+10), ta0f149.size()-10 };callbackQLCDNumber_Display(this, sPacked); };
+	void display(double num) { callbackQLCDNumber_Display3(this, num); };
+	void display(int num) { callbackQLCDNumber_Display2(this, num); };
+	void Signal_Overflow() { callbackQLCDNumber_Overflow(this); };
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	void setBinMode() { callbackQLCDNumber_SetBinMode(this); };
+	void setDecMode() { callbackQLCDNumber_SetDecMode(this); };
+	void setHexMode() { callbackQLCDNumber_SetHexMode(this); };
+	void setOctMode() { callbackQLCDNumber_SetOctMode(this); };
+	void setSmallDecimalPoint(bool vbo) { callbackQLCDNumber_SetSmallDecimalPoint(this, vbo); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QLCDNumber_NewQLCDNumber(void* parent)
+{
+	return new MyQLCDNumber(static_cast<QWidget*>(parent));
+}
+
+void* QLCDNumber_NewQLCDNumber2(unsigned int numDigits, void* parent)
+{
+	return new MyQLCDNumber(numDigits, static_cast<QWidget*>(parent));
+}
+
+void QLCDNumber_Display(void* ptr, char* s)
+{
+	QMetaObject::invokeMethod(static_cast<QLCDNumber*>(ptr), "display", Q_ARG(QString, QString(s)));
+}
+
+void QLCDNumber_DisplayDefault(void* ptr, char* s)
+{
+		static_cast<QLCDNumber*>(ptr)->QLCDNumber::display(QString(s));
+}
+
+void QLCDNumber_Display3(void* ptr, double num)
+{
+	QMetaObject::invokeMethod(static_cast<QLCDNumber*>(ptr), "display", Q_ARG(double, num));
+}
+
+void QLCDNumber_Display3Default(void* ptr, double num)
+{
+		static_cast<QLCDNumber*>(ptr)->QLCDNumber::display(num);
+}
+
+void QLCDNumber_Display2(void* ptr, int num)
+{
+	QMetaObject::invokeMethod(static_cast<QLCDNumber*>(ptr), "display", Q_ARG(int, num));
+}
+
+void QLCDNumber_Display2Default(void* ptr, int num)
+{
+		static_cast<QLCDNumber*>(ptr)->QLCDNumber::display(num);
+}
+
+void QLCDNumber_ConnectOverflow(void* ptr)
+{
+	QObject::connect(static_cast<QLCDNumber*>(ptr), static_cast<void (QLCDNumber::*)()>(&QLCDNumber::overflow), static_cast<MyQLCDNumber*>(ptr), static_cast<void (MyQLCDNumber::*)()>(&MyQLCDNumber::Signal_Overflow));
+}
+
+void QLCDNumber_DisconnectOverflow(void* ptr)
+{
+	QObject::disconnect(static_cast<QLCDNumber*>(ptr), static_cast<void (QLCDNumber::*)()>(&QLCDNumber::overflow), static_cast<MyQLCDNumber*>(ptr), static_cast<void (MyQLCDNumber::*)()>(&MyQLCDNumber::Signal_Overflow));
+}
+
+void QLCDNumber_Overflow(void* ptr)
+{
+	static_cast<QLCDNumber*>(ptr)->overflow();
+}
+
+void QLCDNumber_SetBinMode(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLCDNumber*>(ptr), "setBinMode");
+}
+
+void QLCDNumber_SetBinModeDefault(void* ptr)
+{
+		static_cast<QLCDNumber*>(ptr)->QLCDNumber::setBinMode();
+}
+
+void QLCDNumber_SetDecMode(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLCDNumber*>(ptr), "setDecMode");
+}
+
+void QLCDNumber_SetDecModeDefault(void* ptr)
+{
+		static_cast<QLCDNumber*>(ptr)->QLCDNumber::setDecMode();
+}
+
+void QLCDNumber_SetDigitCount(void* ptr, int numDigits)
+{
+	static_cast<QLCDNumber*>(ptr)->setDigitCount(numDigits);
+}
+
+void QLCDNumber_SetHexMode(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLCDNumber*>(ptr), "setHexMode");
+}
+
+void QLCDNumber_SetHexModeDefault(void* ptr)
+{
+		static_cast<QLCDNumber*>(ptr)->QLCDNumber::setHexMode();
+}
+
+void QLCDNumber_SetMode(void* ptr, long long vmo)
+{
+	static_cast<QLCDNumber*>(ptr)->setMode(static_cast<QLCDNumber::Mode>(vmo));
+}
+
+void QLCDNumber_SetOctMode(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLCDNumber*>(ptr), "setOctMode");
+}
+
+void QLCDNumber_SetOctModeDefault(void* ptr)
+{
+		static_cast<QLCDNumber*>(ptr)->QLCDNumber::setOctMode();
+}
+
+void QLCDNumber_SetSegmentStyle(void* ptr, long long vse)
+{
+	static_cast<QLCDNumber*>(ptr)->setSegmentStyle(static_cast<QLCDNumber::SegmentStyle>(vse));
+}
+
+void QLCDNumber_SetSmallDecimalPoint(void* ptr, char vbo)
+{
+	QMetaObject::invokeMethod(static_cast<QLCDNumber*>(ptr), "setSmallDecimalPoint", Q_ARG(bool, vbo != 0));
+}
+
+void QLCDNumber_SetSmallDecimalPointDefault(void* ptr, char vbo)
+{
+		static_cast<QLCDNumber*>(ptr)->QLCDNumber::setSmallDecimalPoint(vbo != 0);
+}
+
+void QLCDNumber_DestroyQLCDNumber(void* ptr)
+{
+	static_cast<QLCDNumber*>(ptr)->~QLCDNumber();
+}
+
+long long QLCDNumber_Mode(void* ptr)
+{
+	return static_cast<QLCDNumber*>(ptr)->mode();
+}
+
+long long QLCDNumber_SegmentStyle(void* ptr)
+{
+	return static_cast<QLCDNumber*>(ptr)->segmentStyle();
+}
+
+char QLCDNumber_CheckOverflow(void* ptr, double num)
+{
+	return static_cast<QLCDNumber*>(ptr)->checkOverflow(num);
+}
+
+char QLCDNumber_CheckOverflow2(void* ptr, int num)
+{
+	return static_cast<QLCDNumber*>(ptr)->checkOverflow(num);
+}
+
+char QLCDNumber_SmallDecimalPoint(void* ptr)
+{
+	return static_cast<QLCDNumber*>(ptr)->smallDecimalPoint();
+}
+
+double QLCDNumber_Value(void* ptr)
+{
+	return static_cast<QLCDNumber*>(ptr)->value();
+}
+
+int QLCDNumber_DigitCount(void* ptr)
+{
+	return static_cast<QLCDNumber*>(ptr)->digitCount();
+}
+
+int QLCDNumber_IntValue(void* ptr)
+{
+	return static_cast<QLCDNumber*>(ptr)->intValue();
+}
+
+class MyQLabel: public QLabel
+{
+public:
+	MyQLabel(QWidget *parent, Qt::WindowFlags f) : QLabel(parent, f) {};
+	MyQLabel(const QString &text, QWidget *parent, Qt::WindowFlags f) : QLabel(text, parent, f) {};
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void clear() { callbackQLabel_Clear(this); };
+	void contextMenuEvent(QContextMenuEvent * ev) { callbackQWidget_ContextMenuEvent(this, ev); };
+	void focusInEvent(QFocusEvent * ev) { callbackQWidget_FocusInEvent(this, ev); };
+	void focusOutEvent(QFocusEvent * ev) { callbackQWidget_FocusOutEvent(this, ev); };
+	void keyPressEvent(QKeyEvent * ev) { callbackQWidget_KeyPressEvent(this, ev); };
+	void Signal_LinkActivated(const QString & link) { QByteArray t4f0aa5 = link.toUtf8(); QtWidgets_PackedString linkPacked = { const_cast<char*>(t4f0aa5.prepend("WHITESPACE").constData()+10), t4f0aa5.size()-10 };callbackQLabel_LinkActivated(this, linkPacked); };
+	void Signal_LinkHovered(const QString & link) { QByteArray t4f0aa5 = link.toUtf8(); QtWidgets_PackedString linkPacked = { const_cast<char*>(t4f0aa5.prepend("WHITESPACE").constData()+10), t4f0aa5.size()-10 };callbackQLabel_LinkHovered(this, linkPacked); };
+	void mouseMoveEvent(QMouseEvent * ev) { callbackQWidget_MouseMoveEvent(this, ev); };
+	void mousePressEvent(QMouseEvent * ev) { callbackQWidget_MousePressEvent(this, ev); };
+	void mouseReleaseEvent(QMouseEvent * ev) { callbackQWidget_MouseReleaseEvent(this, ev); };
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	void setMovie(QMovie * movie) { callbackQLabel_SetMovie(this, movie); };
+	void setNum(double num) { callbackQLabel_SetNum2(this, num); };
+	void setNum(int num) { callbackQLabel_SetNum(this, num); };
+	void setPicture(const QPicture & picture) { callbackQLabel_SetPicture(this, const_cast<QPicture*>(&picture)); };
+	void setPixmap(const QPixmap & vqp) { callbackQLabel_SetPixmap(this, const_cast<QPixmap*>(&vqp)); };
+	void setText(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQLabel_SetText(this, vqsPacked); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QLabel_NewQLabel(void* parent, long long f)
+{
+	return new MyQLabel(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(f));
+}
+
+void* QLabel_NewQLabel2(char* text, void* parent, long long f)
+{
+	return new MyQLabel(QString(text), static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(f));
+}
+
+void QLabel_Clear(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLabel*>(ptr), "clear");
+}
+
+void QLabel_ClearDefault(void* ptr)
+{
+		static_cast<QLabel*>(ptr)->QLabel::clear();
+}
+
+void QLabel_ConnectLinkActivated(void* ptr)
+{
+	QObject::connect(static_cast<QLabel*>(ptr), static_cast<void (QLabel::*)(const QString &)>(&QLabel::linkActivated), static_cast<MyQLabel*>(ptr), static_cast<void (MyQLabel::*)(const QString &)>(&MyQLabel::Signal_LinkActivated));
+}
+
+void QLabel_DisconnectLinkActivated(void* ptr)
+{
+	QObject::disconnect(static_cast<QLabel*>(ptr), static_cast<void (QLabel::*)(const QString &)>(&QLabel::linkActivated), static_cast<MyQLabel*>(ptr), static_cast<void (MyQLabel::*)(const QString &)>(&MyQLabel::Signal_LinkActivated));
+}
+
+void QLabel_LinkActivated(void* ptr, char* link)
+{
+	static_cast<QLabel*>(ptr)->linkActivated(QString(link));
+}
+
+void QLabel_ConnectLinkHovered(void* ptr)
+{
+	QObject::connect(static_cast<QLabel*>(ptr), static_cast<void (QLabel::*)(const QString &)>(&QLabel::linkHovered), static_cast<MyQLabel*>(ptr), static_cast<void (MyQLabel::*)(const QString &)>(&MyQLabel::Signal_LinkHovered));
+}
+
+void QLabel_DisconnectLinkHovered(void* ptr)
+{
+	QObject::disconnect(static_cast<QLabel*>(ptr), static_cast<void (QLabel::*)(const QString &)>(&QLabel::linkHovered), static_cast<MyQLabel*>(ptr), static_cast<void (MyQLabel::*)(const QString &)>(&MyQLabel::Signal_LinkHovered));
+}
+
+void QLabel_LinkHovered(void* ptr, char* link)
+{
+	static_cast<QLabel*>(ptr)->linkHovered(QString(link));
+}
+
+void QLabel_SetAlignment(void* ptr, long long vqt)
+{
+	static_cast<QLabel*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(vqt));
+}
+
+void QLabel_SetBuddy(void* ptr, void* buddy)
+{
+		static_cast<QLabel*>(ptr)->setBuddy(static_cast<QWidget*>(buddy));
+}
+
+void QLabel_SetIndent(void* ptr, int vin)
+{
+	static_cast<QLabel*>(ptr)->setIndent(vin);
+}
+
+void QLabel_SetMargin(void* ptr, int vin)
+{
+	static_cast<QLabel*>(ptr)->setMargin(vin);
+}
+
+void QLabel_SetMovie(void* ptr, void* movie)
+{
+	QMetaObject::invokeMethod(static_cast<QLabel*>(ptr), "setMovie", Q_ARG(QMovie*, static_cast<QMovie*>(movie)));
+}
+
+void QLabel_SetMovieDefault(void* ptr, void* movie)
+{
+		static_cast<QLabel*>(ptr)->QLabel::setMovie(static_cast<QMovie*>(movie));
+}
+
+void QLabel_SetNum2(void* ptr, double num)
+{
+	QMetaObject::invokeMethod(static_cast<QLabel*>(ptr), "setNum", Q_ARG(double, num));
+}
+
+void QLabel_SetNum2Default(void* ptr, double num)
+{
+		static_cast<QLabel*>(ptr)->QLabel::setNum(num);
+}
+
+void QLabel_SetNum(void* ptr, int num)
+{
+	QMetaObject::invokeMethod(static_cast<QLabel*>(ptr), "setNum", Q_ARG(int, num));
+}
+
+void QLabel_SetNumDefault(void* ptr, int num)
+{
+		static_cast<QLabel*>(ptr)->QLabel::setNum(num);
+}
+
+void QLabel_SetOpenExternalLinks(void* ptr, char open)
+{
+	static_cast<QLabel*>(ptr)->setOpenExternalLinks(open != 0);
+}
+
+void QLabel_SetPicture(void* ptr, void* picture)
+{
+	QMetaObject::invokeMethod(static_cast<QLabel*>(ptr), "setPicture", Q_ARG(QPicture, *static_cast<QPicture*>(picture)));
+}
+
+void QLabel_SetPictureDefault(void* ptr, void* picture)
+{
+		static_cast<QLabel*>(ptr)->QLabel::setPicture(*static_cast<QPicture*>(picture));
+}
+
+void QLabel_SetPixmap(void* ptr, void* vqp)
+{
+	QMetaObject::invokeMethod(static_cast<QLabel*>(ptr), "setPixmap", Q_ARG(QPixmap, *static_cast<QPixmap*>(vqp)));
+}
+
+void QLabel_SetPixmapDefault(void* ptr, void* vqp)
+{
+		static_cast<QLabel*>(ptr)->QLabel::setPixmap(*static_cast<QPixmap*>(vqp));
+}
+
+void QLabel_SetScaledContents(void* ptr, char vbo)
+{
+	static_cast<QLabel*>(ptr)->setScaledContents(vbo != 0);
+}
+
+void QLabel_SetSelection(void* ptr, int start, int length)
+{
+	static_cast<QLabel*>(ptr)->setSelection(start, length);
+}
+
+void QLabel_SetText(void* ptr, char* vqs)
+{
+	QMetaObject::invokeMethod(static_cast<QLabel*>(ptr), "setText", Q_ARG(QString, QString(vqs)));
+}
+
+void QLabel_SetTextDefault(void* ptr, char* vqs)
+{
+		static_cast<QLabel*>(ptr)->QLabel::setText(QString(vqs));
+}
+
+void QLabel_SetTextFormat(void* ptr, long long vqt)
+{
+	static_cast<QLabel*>(ptr)->setTextFormat(static_cast<Qt::TextFormat>(vqt));
+}
+
+void QLabel_SetTextInteractionFlags(void* ptr, long long flags)
+{
+	static_cast<QLabel*>(ptr)->setTextInteractionFlags(static_cast<Qt::TextInteractionFlag>(flags));
+}
+
+void QLabel_SetWordWrap(void* ptr, char on)
+{
+	static_cast<QLabel*>(ptr)->setWordWrap(on != 0);
+}
+
+void QLabel_DestroyQLabel(void* ptr)
+{
+	static_cast<QLabel*>(ptr)->~QLabel();
+}
+
+void* QLabel_Movie(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->movie();
+}
+
+struct QtWidgets_PackedString QLabel_SelectedText(void* ptr)
+{
+	return ({ QByteArray t8b2afb = static_cast<QLabel*>(ptr)->selectedText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t8b2afb.prepend("WHITESPACE").constData()+10), t8b2afb.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QLabel_Text(void* ptr)
+{
+	return ({ QByteArray t0d779d = static_cast<QLabel*>(ptr)->text().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t0d779d.prepend("WHITESPACE").constData()+10), t0d779d.size()-10 }; });
+}
+
+void* QLabel_Buddy(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->buddy();
+}
+
+long long QLabel_Alignment(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->alignment();
+}
+
+long long QLabel_TextFormat(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->textFormat();
+}
+
+long long QLabel_TextInteractionFlags(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->textInteractionFlags();
+}
+
+char QLabel_HasScaledContents(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->hasScaledContents();
+}
+
+char QLabel_HasSelectedText(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->hasSelectedText();
+}
+
+char QLabel_OpenExternalLinks(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->openExternalLinks();
+}
+
+char QLabel_WordWrap(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->wordWrap();
+}
+
+void* QLabel_Picture(void* ptr)
+{
+	return const_cast<QPicture*>(static_cast<QLabel*>(ptr)->picture());
+}
+
+void* QLabel_Pixmap(void* ptr)
+{
+	return const_cast<QPixmap*>(static_cast<QLabel*>(ptr)->pixmap());
+}
+
+int QLabel_Indent(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->indent();
+}
+
+int QLabel_Margin(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->margin();
+}
+
+int QLabel_SelectionStart(void* ptr)
+{
+	return static_cast<QLabel*>(ptr)->selectionStart();
+}
+
+class MyQLayout: public QLayout
+{
+public:
+	MyQLayout() : QLayout() {};
+	MyQLayout(QWidget *parent) : QLayout(parent) {};
+	QLayout * layout() { return static_cast<QLayout*>(callbackQLayoutItem_Layout(this)); };
+	QLayoutItem * takeAt(int index) { return static_cast<QLayoutItem*>(callbackQLayout_TakeAt(this, index)); };
+	void addItem(QLayoutItem * item) { callbackQLayout_AddItem(this, item); };
+	void childEvent(QChildEvent * e) { callbackQLayout_ChildEvent(this, e); };
+	void invalidate() { callbackQLayoutItem_Invalidate(this); };
+	void setGeometry(const QRect & r) { callbackQLayout_SetGeometry(this, const_cast<QRect*>(&r)); };
+	QLayoutItem * itemAt(int index) const { return static_cast<QLayoutItem*>(callbackQLayout_ItemAt(const_cast<void*>(static_cast<const void*>(this)), index)); };
+	QRect geometry() const { return *static_cast<QRect*>(callbackQLayout_Geometry(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize maximumSize() const { return *static_cast<QSize*>(callbackQLayout_MaximumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSize() const { return *static_cast<QSize*>(callbackQLayout_MinimumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSizePolicy::ControlTypes controlTypes() const { return static_cast<QSizePolicy::ControlType>(callbackQLayoutItem_ControlTypes(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::Orientations expandingDirections() const { return static_cast<Qt::Orientation>(callbackQLayout_ExpandingDirections(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool isEmpty() const { return callbackQLayout_IsEmpty(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int count() const { return callbackQLayout_Count(const_cast<void*>(static_cast<const void*>(this))); };
+	int indexOf(QWidget * widget) const { return callbackQLayout_IndexOf(const_cast<void*>(static_cast<const void*>(this)), widget); };
+	bool event(QEvent * e) { return callbackQLayout_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQLayout_EventFilter(this, watched, event) != 0; };
+	void connectNotify(const QMetaMethod & sign) { callbackQLayout_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQLayout_CustomEvent(this, event); };
+	void deleteLater() { callbackQLayout_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQLayout_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQLayout_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQLayout_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQLayout_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQLayout_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSpacerItem * spacerItem() { return static_cast<QSpacerItem*>(callbackQLayoutItem_SpacerItem(this)); };
+	QWidget * widget() { return static_cast<QWidget*>(callbackQLayoutItem_Widget(this)); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQLayout_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQLayoutItem_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQLayoutItem_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int minimumHeightForWidth(int w) const { return callbackQLayoutItem_MinimumHeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+};
+
+void* QLayout_NewQLayout2()
+{
+	return new MyQLayout();
+}
+
+void* QLayout_NewQLayout(void* parent)
+{
+	return new MyQLayout(static_cast<QWidget*>(parent));
+}
+
+void* QLayout_ReplaceWidget(void* ptr, void* from, void* to, long long options)
+{
+		return static_cast<QLayout*>(ptr)->replaceWidget(static_cast<QWidget*>(from), static_cast<QWidget*>(to), static_cast<Qt::FindChildOption>(options));
+}
+
+void* QLayout_TakeAt(void* ptr, int index)
+{
+		return static_cast<QLayout*>(ptr)->takeAt(index);
+}
+
+void* QLayout_QLayout_ClosestAcceptableSize(void* widget, void* size)
+{
+		return ({ QSize tmpValue = QLayout::closestAcceptableSize(static_cast<QWidget*>(widget), *static_cast<QSize*>(size)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+char QLayout_Activate(void* ptr)
+{
+		return static_cast<QLayout*>(ptr)->activate();
+}
+
+char QLayout_SetAlignment2(void* ptr, void* l, long long alignment)
+{
+		return static_cast<QLayout*>(ptr)->setAlignment(static_cast<QLayout*>(l), static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+char QLayout_SetAlignment(void* ptr, void* w, long long alignment)
+{
+		return static_cast<QLayout*>(ptr)->setAlignment(static_cast<QWidget*>(w), static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QLayout_AddChildLayout(void* ptr, void* l)
+{
+		static_cast<QLayout*>(ptr)->addChildLayout(static_cast<QLayout*>(l));
+}
+
+void QLayout_AddChildWidget(void* ptr, void* w)
+{
+		static_cast<QLayout*>(ptr)->addChildWidget(static_cast<QWidget*>(w));
+}
+
+void QLayout_AddItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(item))) {
+		static_cast<QLayout*>(ptr)->addItem(static_cast<QLayout*>(item));
+	} else {
+		static_cast<QLayout*>(ptr)->addItem(static_cast<QLayoutItem*>(item));
+	}
+}
+
+void QLayout_AddWidget(void* ptr, void* w)
+{
+		static_cast<QLayout*>(ptr)->addWidget(static_cast<QWidget*>(w));
+}
+
+void QLayout_ChildEvent(void* ptr, void* e)
+{
+		static_cast<QLayout*>(ptr)->childEvent(static_cast<QChildEvent*>(e));
+}
+
+void QLayout_ChildEventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::childEvent(static_cast<QChildEvent*>(e));
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGridLayout*>(ptr)->QGridLayout::childEvent(static_cast<QChildEvent*>(e));
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::childEvent(static_cast<QChildEvent*>(e));
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::childEvent(static_cast<QChildEvent*>(e));
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::childEvent(static_cast<QChildEvent*>(e));
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBoxLayout*>(ptr)->QBoxLayout::childEvent(static_cast<QChildEvent*>(e));
+	} else {
+		static_cast<QLayout*>(ptr)->QLayout::childEvent(static_cast<QChildEvent*>(e));
+	}
+}
+
+void QLayout_RemoveItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(item))) {
+		static_cast<QLayout*>(ptr)->removeItem(static_cast<QLayout*>(item));
+	} else {
+		static_cast<QLayout*>(ptr)->removeItem(static_cast<QLayoutItem*>(item));
+	}
+}
+
+void QLayout_RemoveWidget(void* ptr, void* widget)
+{
+		static_cast<QLayout*>(ptr)->removeWidget(static_cast<QWidget*>(widget));
+}
+
+void QLayout_SetContentsMargins2(void* ptr, void* margins)
+{
+		static_cast<QLayout*>(ptr)->setContentsMargins(*static_cast<QMargins*>(margins));
+}
+
+void QLayout_SetContentsMargins(void* ptr, int left, int top, int right, int bottom)
+{
+		static_cast<QLayout*>(ptr)->setContentsMargins(left, top, right, bottom);
+}
+
+void QLayout_SetEnabled(void* ptr, char enable)
+{
+		static_cast<QLayout*>(ptr)->setEnabled(enable != 0);
+}
+
+void QLayout_SetGeometry(void* ptr, void* r)
+{
+		static_cast<QLayout*>(ptr)->setGeometry(*static_cast<QRect*>(r));
+}
+
+void QLayout_SetGeometryDefault(void* ptr, void* r)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::setGeometry(*static_cast<QRect*>(r));
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGridLayout*>(ptr)->QGridLayout::setGeometry(*static_cast<QRect*>(r));
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::setGeometry(*static_cast<QRect*>(r));
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::setGeometry(*static_cast<QRect*>(r));
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::setGeometry(*static_cast<QRect*>(r));
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBoxLayout*>(ptr)->QBoxLayout::setGeometry(*static_cast<QRect*>(r));
+	} else {
+		static_cast<QLayout*>(ptr)->QLayout::setGeometry(*static_cast<QRect*>(r));
+	}
+}
+
+void QLayout_SetMenuBar(void* ptr, void* widget)
+{
+		static_cast<QLayout*>(ptr)->setMenuBar(static_cast<QWidget*>(widget));
+}
+
+void QLayout_SetSizeConstraint(void* ptr, long long vsi)
+{
+		static_cast<QLayout*>(ptr)->setSizeConstraint(static_cast<QLayout::SizeConstraint>(vsi));
+}
+
+void QLayout_SetSpacing(void* ptr, int vin)
+{
+		static_cast<QLayout*>(ptr)->setSpacing(vin);
+}
+
+void QLayout_Update(void* ptr)
+{
+		static_cast<QLayout*>(ptr)->update();
+}
+
+void* QLayout_ItemAt(void* ptr, int index)
+{
+		return static_cast<QLayout*>(ptr)->itemAt(index);
+}
+
+void* QLayout_ContentsMargins(void* ptr)
+{
+		return ({ QMargins tmpValue = static_cast<QLayout*>(ptr)->contentsMargins(); new QMargins(tmpValue.left(), tmpValue.top(), tmpValue.right(), tmpValue.bottom()); });
+}
+
+void* QLayout_AlignmentRect(void* ptr, void* r)
+{
+		return ({ QRect tmpValue = static_cast<QLayout*>(ptr)->alignmentRect(*static_cast<QRect*>(r)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QLayout_ContentsRect(void* ptr)
+{
+		return ({ QRect tmpValue = static_cast<QLayout*>(ptr)->contentsRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QLayout_Geometry(void* ptr)
+{
+		return ({ QRect tmpValue = static_cast<QLayout*>(ptr)->geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QLayout_GeometryDefault(void* ptr)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QStackedLayout*>(ptr)->QStackedLayout::geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QGridLayout*>(ptr)->QGridLayout::geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QFormLayout*>(ptr)->QFormLayout::geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QBoxLayout*>(ptr)->QBoxLayout::geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRect tmpValue = static_cast<QLayout*>(ptr)->QLayout::geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QLayout_MaximumSize(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QLayout*>(ptr)->maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QLayout_MaximumSizeDefault(void* ptr)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QStackedLayout*>(ptr)->QStackedLayout::maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QGridLayout*>(ptr)->QGridLayout::maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QFormLayout*>(ptr)->QFormLayout::maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QBoxLayout*>(ptr)->QBoxLayout::maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QLayout*>(ptr)->QLayout::maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QLayout_MinimumSize(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QLayout*>(ptr)->minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QLayout_MinimumSizeDefault(void* ptr)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QStackedLayout*>(ptr)->QStackedLayout::minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QGridLayout*>(ptr)->QGridLayout::minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QFormLayout*>(ptr)->QFormLayout::minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QBoxLayout*>(ptr)->QBoxLayout::minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QLayout*>(ptr)->QLayout::minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QLayout_MenuBar(void* ptr)
+{
+		return static_cast<QLayout*>(ptr)->menuBar();
+}
+
+void* QLayout_ParentWidget(void* ptr)
+{
+		return static_cast<QLayout*>(ptr)->parentWidget();
+}
+
+long long QLayout_ExpandingDirections(void* ptr)
+{
+		return static_cast<QLayout*>(ptr)->expandingDirections();
+}
+
+long long QLayout_ExpandingDirectionsDefault(void* ptr)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::expandingDirections();
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::expandingDirections();
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::expandingDirections();
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::expandingDirections();
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::expandingDirections();
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::expandingDirections();
+	} else {
+		return static_cast<QLayout*>(ptr)->QLayout::expandingDirections();
+	}
+}
+
+long long QLayout_SizeConstraint(void* ptr)
+{
+		return static_cast<QLayout*>(ptr)->sizeConstraint();
+}
+
+char QLayout_IsEmpty(void* ptr)
+{
+		return static_cast<QLayout*>(ptr)->isEmpty();
+}
+
+char QLayout_IsEmptyDefault(void* ptr)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::isEmpty();
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::isEmpty();
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::isEmpty();
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::isEmpty();
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::isEmpty();
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::isEmpty();
+	} else {
+		return static_cast<QLayout*>(ptr)->QLayout::isEmpty();
+	}
+}
+
+char QLayout_IsEnabled(void* ptr)
+{
+		return static_cast<QLayout*>(ptr)->isEnabled();
+}
+
+int QLayout_Count(void* ptr)
+{
+		return static_cast<QLayout*>(ptr)->count();
+}
+
+int QLayout_IndexOf(void* ptr, void* widget)
+{
+		return static_cast<QLayout*>(ptr)->indexOf(static_cast<QWidget*>(widget));
+}
+
+int QLayout_IndexOfDefault(void* ptr, void* widget)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::indexOf(static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::indexOf(static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::indexOf(static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::indexOf(static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::indexOf(static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::indexOf(static_cast<QWidget*>(widget));
+	} else {
+		return static_cast<QLayout*>(ptr)->QLayout::indexOf(static_cast<QWidget*>(widget));
+	}
+}
+
+int QLayout_Spacing(void* ptr)
+{
+		return static_cast<QLayout*>(ptr)->spacing();
+}
+
+void QLayout_GetContentsMargins(void* ptr, int left, int top, int right, int bottom)
+{
+		static_cast<QLayout*>(ptr)->getContentsMargins(&left, &top, &right, &bottom);
+}
+
+void* QLayout___dynamicPropertyNames_atList(void* ptr, int i)
+{
+		return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QLayout___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+		static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QLayout___dynamicPropertyNames_newList(void* ptr)
+{
+		return new QList<QByteArray>;
+}
+
+void* QLayout___findChildren_atList2(void* ptr, int i)
+{
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QLayout___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QLayout___findChildren_newList2(void* ptr)
+{
+		return new QList<QObject*>;
+}
+
+void* QLayout___findChildren_atList3(void* ptr, int i)
+{
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QLayout___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QLayout___findChildren_newList3(void* ptr)
+{
+		return new QList<QObject*>;
+}
+
+void* QLayout___findChildren_atList(void* ptr, int i)
+{
+		return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QLayout___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QLayout___findChildren_newList(void* ptr)
+{
+		return new QList<QObject*>;
+}
+
+void* QLayout___children_atList(void* ptr, int i)
+{
+		return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QLayout___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QLayout___children_newList(void* ptr)
+{
+		return new QList<QObject *>;
+}
+
+char QLayout_Event(void* ptr, void* e)
+{
+		return static_cast<QLayout*>(ptr)->event(static_cast<QEvent*>(e));
+}
+
+char QLayout_EventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::event(static_cast<QEvent*>(e));
+	} else {
+		return static_cast<QLayout*>(ptr)->QLayout::event(static_cast<QEvent*>(e));
+	}
+}
+
+char QLayout_EventFilter(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QLayout*>(ptr)->eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QLayout*>(ptr)->eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QLayout*>(ptr)->eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QLayout*>(ptr)->eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QLayout*>(ptr)->eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+char QLayout_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QStackedLayout*>(ptr)->QStackedLayout::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QStackedLayout*>(ptr)->QStackedLayout::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QStackedLayout*>(ptr)->QStackedLayout::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QStackedLayout*>(ptr)->QStackedLayout::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QStackedLayout*>(ptr)->QStackedLayout::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGridLayout*>(ptr)->QGridLayout::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGridLayout*>(ptr)->QGridLayout::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGridLayout*>(ptr)->QGridLayout::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QGridLayout*>(ptr)->QGridLayout::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QGridLayout*>(ptr)->QGridLayout::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QFormLayout*>(ptr)->QFormLayout::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QFormLayout*>(ptr)->QFormLayout::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QFormLayout*>(ptr)->QFormLayout::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QFormLayout*>(ptr)->QFormLayout::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QFormLayout*>(ptr)->QFormLayout::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QBoxLayout*>(ptr)->QBoxLayout::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QBoxLayout*>(ptr)->QBoxLayout::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QBoxLayout*>(ptr)->QBoxLayout::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QBoxLayout*>(ptr)->QBoxLayout::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QBoxLayout*>(ptr)->QBoxLayout::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QLayout*>(ptr)->QLayout::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QLayout*>(ptr)->QLayout::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QLayout*>(ptr)->QLayout::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QLayout*>(ptr)->QLayout::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QLayout*>(ptr)->QLayout::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QLayout_ConnectNotify(void* ptr, void* sign)
+{
+		static_cast<QLayout*>(ptr)->connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QLayout_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGridLayout*>(ptr)->QGridLayout::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBoxLayout*>(ptr)->QBoxLayout::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QLayout*>(ptr)->QLayout::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QLayout_CustomEvent(void* ptr, void* event)
+{
+		static_cast<QLayout*>(ptr)->customEvent(static_cast<QEvent*>(event));
+}
+
+void QLayout_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGridLayout*>(ptr)->QGridLayout::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBoxLayout*>(ptr)->QBoxLayout::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QLayout*>(ptr)->QLayout::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QLayout_DeleteLater(void* ptr)
+{
+		QMetaObject::invokeMethod(static_cast<QLayout*>(ptr), "deleteLater");
+}
+
+void QLayout_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::deleteLater();
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGridLayout*>(ptr)->QGridLayout::deleteLater();
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::deleteLater();
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::deleteLater();
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::deleteLater();
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBoxLayout*>(ptr)->QBoxLayout::deleteLater();
+	} else {
+		static_cast<QLayout*>(ptr)->QLayout::deleteLater();
+	}
+}
+
+void QLayout_DisconnectNotify(void* ptr, void* sign)
+{
+		static_cast<QLayout*>(ptr)->disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QLayout_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGridLayout*>(ptr)->QGridLayout::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBoxLayout*>(ptr)->QBoxLayout::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QLayout*>(ptr)->QLayout::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QLayout_TimerEvent(void* ptr, void* event)
+{
+		static_cast<QLayout*>(ptr)->timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void QLayout_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGridLayout*>(ptr)->QGridLayout::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBoxLayout*>(ptr)->QBoxLayout::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QLayout*>(ptr)->QLayout::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void* QLayout_MetaObject(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QLayout*>(ptr)->metaObject());
+}
+
+void* QLayout_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QStackedLayout*>(ptr)->QStackedLayout::metaObject());
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QGridLayout*>(ptr)->QGridLayout::metaObject());
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QFormLayout*>(ptr)->QFormLayout::metaObject());
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::metaObject());
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::metaObject());
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QBoxLayout*>(ptr)->QBoxLayout::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QLayout*>(ptr)->QLayout::metaObject());
+	}
+}
+
+void* QLayout_SizeHint(void* ptr)
+{
+	
+}
+
+void* QLayout_SizeHintDefault(void* ptr)
+{
+	if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QStackedLayout*>(ptr)->QStackedLayout::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QGridLayout*>(ptr)->QGridLayout::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QFormLayout*>(ptr)->QFormLayout::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QBoxLayout*>(ptr)->QBoxLayout::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+	
+	}
+}
+
+class MyQLayoutItem: public QLayoutItem
+{
+public:
+	MyQLayoutItem(Qt::Alignment alignment) : QLayoutItem(alignment) {};
+	QLayout * layout() { return static_cast<QLayout*>(callbackQLayoutItem_Layout(this)); };
+	QSpacerItem * spacerItem() { return static_cast<QSpacerItem*>(callbackQLayoutItem_SpacerItem(this)); };
+	QWidget * widget() { return static_cast<QWidget*>(callbackQLayoutItem_Widget(this)); };
+	void invalidate() { callbackQLayoutItem_Invalidate(this); };
+	void setGeometry(const QRect & r) { callbackQLayoutItem_SetGeometry(this, const_cast<QRect*>(&r)); };
+	 ~MyQLayoutItem() { callbackQLayoutItem_DestroyQLayoutItem(this); };
+	QRect geometry() const { return *static_cast<QRect*>(callbackQLayoutItem_Geometry(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize maximumSize() const { return *static_cast<QSize*>(callbackQLayoutItem_MaximumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSize() const { return *static_cast<QSize*>(callbackQLayoutItem_MinimumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQLayoutItem_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSizePolicy::ControlTypes controlTypes() const { return static_cast<QSizePolicy::ControlType>(callbackQLayoutItem_ControlTypes(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::Orientations expandingDirections() const { return static_cast<Qt::Orientation>(callbackQLayoutItem_ExpandingDirections(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQLayoutItem_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	bool isEmpty() const { return callbackQLayoutItem_IsEmpty(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQLayoutItem_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int minimumHeightForWidth(int w) const { return callbackQLayoutItem_MinimumHeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+};
+
+void* QLayoutItem_Layout(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->layout();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->layout();
+	}
+}
+
+void* QLayoutItem_LayoutDefault(void* ptr)
+{
+	if (dynamic_cast<QWidgetItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWidgetItem*>(ptr)->QWidgetItem::layout();
+	} else if (dynamic_cast<QSpacerItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSpacerItem*>(ptr)->QSpacerItem::layout();
+	} else if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::layout();
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::layout();
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::layout();
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::layout();
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::layout();
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::layout();
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->QLayout::layout();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->QLayoutItem::layout();
+	}
+}
+
+void* QLayoutItem_NewQLayoutItem(long long alignment)
+{
+	return new MyQLayoutItem(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void* QLayoutItem_SpacerItem(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->spacerItem();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->spacerItem();
+	}
+}
+
+void* QLayoutItem_SpacerItemDefault(void* ptr)
+{
+	if (dynamic_cast<QWidgetItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWidgetItem*>(ptr)->QWidgetItem::spacerItem();
+	} else if (dynamic_cast<QSpacerItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSpacerItem*>(ptr)->QSpacerItem::spacerItem();
+	} else if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::spacerItem();
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::spacerItem();
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::spacerItem();
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::spacerItem();
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::spacerItem();
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::spacerItem();
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->QLayout::spacerItem();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->QLayoutItem::spacerItem();
+	}
+}
+
+void* QLayoutItem_Widget(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->widget();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->widget();
+	}
+}
+
+void* QLayoutItem_WidgetDefault(void* ptr)
+{
+	if (dynamic_cast<QWidgetItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWidgetItem*>(ptr)->QWidgetItem::widget();
+	} else if (dynamic_cast<QSpacerItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSpacerItem*>(ptr)->QSpacerItem::widget();
+	} else if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::widget();
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::widget();
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::widget();
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::widget();
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::widget();
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::widget();
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->QLayout::widget();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->QLayoutItem::widget();
+	}
+}
+
+void QLayoutItem_Invalidate(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLayout*>(ptr)->invalidate();
+	} else {
+		static_cast<QLayoutItem*>(ptr)->invalidate();
+	}
+}
+
+void QLayoutItem_InvalidateDefault(void* ptr)
+{
+	if (dynamic_cast<QWidgetItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QWidgetItem*>(ptr)->QWidgetItem::invalidate();
+	} else if (dynamic_cast<QSpacerItem*>(static_cast<QObject*>(ptr))) {
+		static_cast<QSpacerItem*>(ptr)->QSpacerItem::invalidate();
+	} else if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::invalidate();
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QGridLayout*>(ptr)->QGridLayout::invalidate();
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QFormLayout*>(ptr)->QFormLayout::invalidate();
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::invalidate();
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::invalidate();
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QBoxLayout*>(ptr)->QBoxLayout::invalidate();
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLayout*>(ptr)->QLayout::invalidate();
+	} else {
+		static_cast<QLayoutItem*>(ptr)->QLayoutItem::invalidate();
+	}
+}
+
+void QLayoutItem_SetAlignment(void* ptr, long long alignment)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLayout*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+	} else {
+		static_cast<QLayoutItem*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+	}
+}
+
+void QLayoutItem_SetGeometry(void* ptr, void* r)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLayout*>(ptr)->setGeometry(*static_cast<QRect*>(r));
+	} else {
+		static_cast<QLayoutItem*>(ptr)->setGeometry(*static_cast<QRect*>(r));
+	}
+}
+
+void QLayoutItem_DestroyQLayoutItem(void* ptr)
+{
+	static_cast<QLayoutItem*>(ptr)->~QLayoutItem();
+}
+
+void QLayoutItem_DestroyQLayoutItemDefault(void* ptr)
+{
+
+}
+
+void* QLayoutItem_Geometry(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QLayout*>(ptr)->geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRect tmpValue = static_cast<QLayoutItem*>(ptr)->geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QLayoutItem_MaximumSize(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QLayout*>(ptr)->maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QLayoutItem*>(ptr)->maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QLayoutItem_MinimumSize(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QLayout*>(ptr)->minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QLayoutItem*>(ptr)->minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QLayoutItem_SizeHint(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return ({ QSize tmpValue = static_cast<QLayout*>(ptr)->sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QSize tmpValue = static_cast<QLayoutItem*>(ptr)->sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+long long QLayoutItem_ControlTypes(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->controlTypes();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->controlTypes();
+	}
+}
+
+long long QLayoutItem_ControlTypesDefault(void* ptr)
+{
+	if (dynamic_cast<QWidgetItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWidgetItem*>(ptr)->QWidgetItem::controlTypes();
+	} else if (dynamic_cast<QSpacerItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSpacerItem*>(ptr)->QSpacerItem::controlTypes();
+	} else if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::controlTypes();
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::controlTypes();
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::controlTypes();
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::controlTypes();
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::controlTypes();
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::controlTypes();
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->QLayout::controlTypes();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->QLayoutItem::controlTypes();
+	}
+}
+
+long long QLayoutItem_Alignment(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->alignment();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->alignment();
+	}
+}
+
+long long QLayoutItem_ExpandingDirections(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->expandingDirections();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->expandingDirections();
+	}
+}
+
+char QLayoutItem_HasHeightForWidth(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->hasHeightForWidth();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->hasHeightForWidth();
+	}
+}
+
+char QLayoutItem_HasHeightForWidthDefault(void* ptr)
+{
+	if (dynamic_cast<QWidgetItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWidgetItem*>(ptr)->QWidgetItem::hasHeightForWidth();
+	} else if (dynamic_cast<QSpacerItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSpacerItem*>(ptr)->QSpacerItem::hasHeightForWidth();
+	} else if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::hasHeightForWidth();
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::hasHeightForWidth();
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::hasHeightForWidth();
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::hasHeightForWidth();
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::hasHeightForWidth();
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::hasHeightForWidth();
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->QLayout::hasHeightForWidth();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->QLayoutItem::hasHeightForWidth();
+	}
+}
+
+char QLayoutItem_IsEmpty(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->isEmpty();
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->isEmpty();
+	}
+}
+
+int QLayoutItem_HeightForWidth(void* ptr, int w)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->heightForWidth(w);
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->heightForWidth(w);
+	}
+}
+
+int QLayoutItem_HeightForWidthDefault(void* ptr, int w)
+{
+	if (dynamic_cast<QWidgetItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWidgetItem*>(ptr)->QWidgetItem::heightForWidth(w);
+	} else if (dynamic_cast<QSpacerItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSpacerItem*>(ptr)->QSpacerItem::heightForWidth(w);
+	} else if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::heightForWidth(w);
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::heightForWidth(w);
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::heightForWidth(w);
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::heightForWidth(w);
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::heightForWidth(w);
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::heightForWidth(w);
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->QLayout::heightForWidth(w);
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->QLayoutItem::heightForWidth(w);
+	}
+}
+
+int QLayoutItem_MinimumHeightForWidth(void* ptr, int w)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->minimumHeightForWidth(w);
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->minimumHeightForWidth(w);
+	}
+}
+
+int QLayoutItem_MinimumHeightForWidthDefault(void* ptr, int w)
+{
+	if (dynamic_cast<QWidgetItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QWidgetItem*>(ptr)->QWidgetItem::minimumHeightForWidth(w);
+	} else if (dynamic_cast<QSpacerItem*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QSpacerItem*>(ptr)->QSpacerItem::minimumHeightForWidth(w);
+	} else if (dynamic_cast<QStackedLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::minimumHeightForWidth(w);
+	} else if (dynamic_cast<QGridLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QGridLayout*>(ptr)->QGridLayout::minimumHeightForWidth(w);
+	} else if (dynamic_cast<QFormLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QFormLayout*>(ptr)->QFormLayout::minimumHeightForWidth(w);
+	} else if (dynamic_cast<QVBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QVBoxLayout*>(ptr)->QVBoxLayout::minimumHeightForWidth(w);
+	} else if (dynamic_cast<QHBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QHBoxLayout*>(ptr)->QHBoxLayout::minimumHeightForWidth(w);
+	} else if (dynamic_cast<QBoxLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QBoxLayout*>(ptr)->QBoxLayout::minimumHeightForWidth(w);
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->QLayout::minimumHeightForWidth(w);
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->QLayoutItem::minimumHeightForWidth(w);
+	}
+}
+
+long long QLayoutItem_Align(void* ptr)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QLayout*>(ptr)->align;
+	} else {
+		return static_cast<QLayoutItem*>(ptr)->align;
+	}
+}
+
+void QLayoutItem_SetAlign(void* ptr, long long vqt)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(ptr))) {
+		static_cast<QLayout*>(ptr)->align = static_cast<Qt::AlignmentFlag>(vqt);
+	} else {
+		static_cast<QLayoutItem*>(ptr)->align = static_cast<Qt::AlignmentFlag>(vqt);
+	}
+}
+
+class MyQLineEdit: public QLineEdit
+{
+public:
+	MyQLineEdit(QWidget *parent) : QLineEdit(parent) {};
+	MyQLineEdit(const QString &contents, QWidget *parent) : QLineEdit(contents, parent) {};
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void clear() { callbackQLineEdit_Clear(this); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CursorPositionChanged(int old, int n) { callbackQLineEdit_CursorPositionChanged(this, old, n); };
+	void cut() { callbackQLineEdit_Cut(this); };
+	void dragEnterEvent(QDragEnterEvent * e) { callbackQWidget_DragEnterEvent(this, e); };
+	void dragLeaveEvent(QDragLeaveEvent * e) { callbackQWidget_DragLeaveEvent(this, e); };
+	void dragMoveEvent(QDragMoveEvent * e) { callbackQWidget_DragMoveEvent(this, e); };
+	void dropEvent(QDropEvent * e) { callbackQWidget_DropEvent(this, e); };
+	void Signal_EditingFinished() { callbackQLineEdit_EditingFinished(this); };
+	void focusInEvent(QFocusEvent * e) { callbackQWidget_FocusInEvent(this, e); };
+	void focusOutEvent(QFocusEvent * e) { callbackQWidget_FocusOutEvent(this, e); };
+	void inputMethodEvent(QInputMethodEvent * e) { callbackQWidget_InputMethodEvent(this, e); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void mouseDoubleClickEvent(QMouseEvent * e) { callbackQWidget_MouseDoubleClickEvent(this, e); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	void paste() { callbackQLineEdit_Paste(this); };
+	void redo() { callbackQLineEdit_Redo(this); };
+	void Signal_ReturnPressed() { callbackQLineEdit_ReturnPressed(this); };
+	void selectAll() { callbackQLineEdit_SelectAll(this); };
+	void Signal_SelectionChanged() { callbackQLineEdit_SelectionChanged(this); };
+	void setText(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQLineEdit_SetText(this, vqsPacked); };
+	void Signal_TextChanged(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQLineEdit_TextChanged(this, textPacked); };
+	void Signal_TextEdited(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQLineEdit_TextEdited(this, textPacked); };
+	void undo() { callbackQLineEdit_Undo(this); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery property) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), property)); };
+	void copy() const { callbackQLineEdit_Copy(const_cast<void*>(static_cast<const void*>(this))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QLineEdit_AddAction2(void* ptr, void* icon, long long position)
+{
+	return static_cast<QLineEdit*>(ptr)->addAction(*static_cast<QIcon*>(icon), static_cast<QLineEdit::ActionPosition>(position));
+}
+
+void* QLineEdit_NewQLineEdit(void* parent)
+{
+	return new MyQLineEdit(static_cast<QWidget*>(parent));
+}
+
+void* QLineEdit_NewQLineEdit2(char* contents, void* parent)
+{
+	return new MyQLineEdit(QString(contents), static_cast<QWidget*>(parent));
+}
+
+void* QLineEdit_CreateStandardContextMenu(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->createStandardContextMenu();
+}
+
+int QLineEdit_CursorPositionAt(void* ptr, void* pos)
+{
+	return static_cast<QLineEdit*>(ptr)->cursorPositionAt(*static_cast<QPoint*>(pos));
+}
+
+void QLineEdit_AddAction(void* ptr, void* action, long long position)
+{
+	static_cast<QLineEdit*>(ptr)->addAction(static_cast<QAction*>(action), static_cast<QLineEdit::ActionPosition>(position));
+}
+
+void QLineEdit_Backspace(void* ptr)
+{
+	static_cast<QLineEdit*>(ptr)->backspace();
+}
+
+void QLineEdit_Clear(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLineEdit*>(ptr), "clear");
+}
+
+void QLineEdit_ClearDefault(void* ptr)
+{
+		static_cast<QLineEdit*>(ptr)->QLineEdit::clear();
+}
+
+void QLineEdit_CursorBackward(void* ptr, char mark, int steps)
+{
+	static_cast<QLineEdit*>(ptr)->cursorBackward(mark != 0, steps);
+}
+
+void QLineEdit_CursorForward(void* ptr, char mark, int steps)
+{
+	static_cast<QLineEdit*>(ptr)->cursorForward(mark != 0, steps);
+}
+
+void QLineEdit_ConnectCursorPositionChanged(void* ptr)
+{
+	QObject::connect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)(int, int)>(&QLineEdit::cursorPositionChanged), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)(int, int)>(&MyQLineEdit::Signal_CursorPositionChanged));
+}
+
+void QLineEdit_DisconnectCursorPositionChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)(int, int)>(&QLineEdit::cursorPositionChanged), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)(int, int)>(&MyQLineEdit::Signal_CursorPositionChanged));
+}
+
+void QLineEdit_CursorPositionChanged(void* ptr, int old, int n)
+{
+	static_cast<QLineEdit*>(ptr)->cursorPositionChanged(old, n);
+}
+
+void QLineEdit_CursorWordBackward(void* ptr, char mark)
+{
+	static_cast<QLineEdit*>(ptr)->cursorWordBackward(mark != 0);
+}
+
+void QLineEdit_CursorWordForward(void* ptr, char mark)
+{
+	static_cast<QLineEdit*>(ptr)->cursorWordForward(mark != 0);
+}
+
+void QLineEdit_Cut(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLineEdit*>(ptr), "cut");
+}
+
+void QLineEdit_CutDefault(void* ptr)
+{
+		static_cast<QLineEdit*>(ptr)->QLineEdit::cut();
+}
+
+void QLineEdit_Del(void* ptr)
+{
+	static_cast<QLineEdit*>(ptr)->del();
+}
+
+void QLineEdit_Deselect(void* ptr)
+{
+	static_cast<QLineEdit*>(ptr)->deselect();
+}
+
+void QLineEdit_ConnectEditingFinished(void* ptr)
+{
+	QObject::connect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)()>(&QLineEdit::editingFinished), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)()>(&MyQLineEdit::Signal_EditingFinished));
+}
+
+void QLineEdit_DisconnectEditingFinished(void* ptr)
+{
+	QObject::disconnect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)()>(&QLineEdit::editingFinished), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)()>(&MyQLineEdit::Signal_EditingFinished));
+}
+
+void QLineEdit_EditingFinished(void* ptr)
+{
+	static_cast<QLineEdit*>(ptr)->editingFinished();
+}
+
+void QLineEdit_End(void* ptr, char mark)
+{
+	static_cast<QLineEdit*>(ptr)->end(mark != 0);
+}
+
+void QLineEdit_Home(void* ptr, char mark)
+{
+	static_cast<QLineEdit*>(ptr)->home(mark != 0);
+}
+
+void QLineEdit_Insert(void* ptr, char* newText)
+{
+	static_cast<QLineEdit*>(ptr)->insert(QString(newText));
+}
+
+void QLineEdit_Paste(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLineEdit*>(ptr), "paste");
+}
+
+void QLineEdit_PasteDefault(void* ptr)
+{
+		static_cast<QLineEdit*>(ptr)->QLineEdit::paste();
+}
+
+void QLineEdit_Redo(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLineEdit*>(ptr), "redo");
+}
+
+void QLineEdit_RedoDefault(void* ptr)
+{
+		static_cast<QLineEdit*>(ptr)->QLineEdit::redo();
+}
+
+void QLineEdit_ConnectReturnPressed(void* ptr)
+{
+	QObject::connect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)()>(&QLineEdit::returnPressed), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)()>(&MyQLineEdit::Signal_ReturnPressed));
+}
+
+void QLineEdit_DisconnectReturnPressed(void* ptr)
+{
+	QObject::disconnect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)()>(&QLineEdit::returnPressed), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)()>(&MyQLineEdit::Signal_ReturnPressed));
+}
+
+void QLineEdit_ReturnPressed(void* ptr)
+{
+	static_cast<QLineEdit*>(ptr)->returnPressed();
+}
+
+void QLineEdit_SelectAll(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLineEdit*>(ptr), "selectAll");
+}
+
+void QLineEdit_SelectAllDefault(void* ptr)
+{
+		static_cast<QLineEdit*>(ptr)->QLineEdit::selectAll();
+}
+
+void QLineEdit_ConnectSelectionChanged(void* ptr)
+{
+	QObject::connect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)()>(&QLineEdit::selectionChanged), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)()>(&MyQLineEdit::Signal_SelectionChanged));
+}
+
+void QLineEdit_DisconnectSelectionChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)()>(&QLineEdit::selectionChanged), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)()>(&MyQLineEdit::Signal_SelectionChanged));
+}
+
+void QLineEdit_SelectionChanged(void* ptr)
+{
+	static_cast<QLineEdit*>(ptr)->selectionChanged();
+}
+
+void QLineEdit_SetAlignment(void* ptr, long long flag)
+{
+	static_cast<QLineEdit*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(flag));
+}
+
+void QLineEdit_SetClearButtonEnabled(void* ptr, char enable)
+{
+	static_cast<QLineEdit*>(ptr)->setClearButtonEnabled(enable != 0);
+}
+
+void QLineEdit_SetCompleter(void* ptr, void* c)
+{
+	static_cast<QLineEdit*>(ptr)->setCompleter(static_cast<QCompleter*>(c));
+}
+
+void QLineEdit_SetCursorMoveStyle(void* ptr, long long style)
+{
+	static_cast<QLineEdit*>(ptr)->setCursorMoveStyle(static_cast<Qt::CursorMoveStyle>(style));
+}
+
+void QLineEdit_SetCursorPosition(void* ptr, int vin)
+{
+	static_cast<QLineEdit*>(ptr)->setCursorPosition(vin);
+}
+
+void QLineEdit_SetDragEnabled(void* ptr, char b)
+{
+	static_cast<QLineEdit*>(ptr)->setDragEnabled(b != 0);
+}
+
+void QLineEdit_SetEchoMode(void* ptr, long long vec)
+{
+	static_cast<QLineEdit*>(ptr)->setEchoMode(static_cast<QLineEdit::EchoMode>(vec));
+}
+
+void QLineEdit_SetFrame(void* ptr, char vbo)
+{
+	static_cast<QLineEdit*>(ptr)->setFrame(vbo != 0);
+}
+
+void QLineEdit_SetInputMask(void* ptr, char* inputMask)
+{
+	static_cast<QLineEdit*>(ptr)->setInputMask(QString(inputMask));
+}
+
+void QLineEdit_SetMaxLength(void* ptr, int vin)
+{
+	static_cast<QLineEdit*>(ptr)->setMaxLength(vin);
+}
+
+void QLineEdit_SetModified(void* ptr, char vbo)
+{
+	static_cast<QLineEdit*>(ptr)->setModified(vbo != 0);
+}
+
+void QLineEdit_SetPlaceholderText(void* ptr, char* vqs)
+{
+	static_cast<QLineEdit*>(ptr)->setPlaceholderText(QString(vqs));
+}
+
+void QLineEdit_SetReadOnly(void* ptr, char vbo)
+{
+	static_cast<QLineEdit*>(ptr)->setReadOnly(vbo != 0);
+}
+
+void QLineEdit_SetSelection(void* ptr, int start, int length)
+{
+	static_cast<QLineEdit*>(ptr)->setSelection(start, length);
+}
+
+void QLineEdit_SetText(void* ptr, char* vqs)
+{
+	QMetaObject::invokeMethod(static_cast<QLineEdit*>(ptr), "setText", Q_ARG(QString, QString(vqs)));
+}
+
+void QLineEdit_SetTextDefault(void* ptr, char* vqs)
+{
+		static_cast<QLineEdit*>(ptr)->QLineEdit::setText(QString(vqs));
+}
+
+void QLineEdit_SetTextMargins2(void* ptr, void* margins)
+{
+	static_cast<QLineEdit*>(ptr)->setTextMargins(*static_cast<QMargins*>(margins));
+}
+
+void QLineEdit_SetTextMargins(void* ptr, int left, int top, int right, int bottom)
+{
+	static_cast<QLineEdit*>(ptr)->setTextMargins(left, top, right, bottom);
+}
+
+void QLineEdit_SetValidator(void* ptr, void* v)
+{
+	static_cast<QLineEdit*>(ptr)->setValidator(static_cast<QValidator*>(v));
+}
+
+void QLineEdit_ConnectTextChanged(void* ptr)
+{
+	QObject::connect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)(const QString &)>(&QLineEdit::textChanged), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)(const QString &)>(&MyQLineEdit::Signal_TextChanged));
+}
+
+void QLineEdit_DisconnectTextChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)(const QString &)>(&QLineEdit::textChanged), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)(const QString &)>(&MyQLineEdit::Signal_TextChanged));
+}
+
+void QLineEdit_TextChanged(void* ptr, char* text)
+{
+	static_cast<QLineEdit*>(ptr)->textChanged(QString(text));
+}
+
+void QLineEdit_ConnectTextEdited(void* ptr)
+{
+	QObject::connect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)(const QString &)>(&QLineEdit::textEdited), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)(const QString &)>(&MyQLineEdit::Signal_TextEdited));
+}
+
+void QLineEdit_DisconnectTextEdited(void* ptr)
+{
+	QObject::disconnect(static_cast<QLineEdit*>(ptr), static_cast<void (QLineEdit::*)(const QString &)>(&QLineEdit::textEdited), static_cast<MyQLineEdit*>(ptr), static_cast<void (MyQLineEdit::*)(const QString &)>(&MyQLineEdit::Signal_TextEdited));
+}
+
+void QLineEdit_TextEdited(void* ptr, char* text)
+{
+	static_cast<QLineEdit*>(ptr)->textEdited(QString(text));
+}
+
+void QLineEdit_Undo(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLineEdit*>(ptr), "undo");
+}
+
+void QLineEdit_UndoDefault(void* ptr)
+{
+		static_cast<QLineEdit*>(ptr)->QLineEdit::undo();
+}
+
+void QLineEdit_DestroyQLineEdit(void* ptr)
+{
+	static_cast<QLineEdit*>(ptr)->~QLineEdit();
+}
+
+long long QLineEdit_EchoMode(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->echoMode();
+}
+
+void* QLineEdit_Completer(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->completer();
+}
+
+void* QLineEdit_TextMargins(void* ptr)
+{
+	return ({ QMargins tmpValue = static_cast<QLineEdit*>(ptr)->textMargins(); new QMargins(tmpValue.left(), tmpValue.top(), tmpValue.right(), tmpValue.bottom()); });
+}
+
+void* QLineEdit_CursorRect(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QLineEdit*>(ptr)->cursorRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtWidgets_PackedString QLineEdit_DisplayText(void* ptr)
+{
+	return ({ QByteArray t6ee01b = static_cast<QLineEdit*>(ptr)->displayText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t6ee01b.prepend("WHITESPACE").constData()+10), t6ee01b.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QLineEdit_InputMask(void* ptr)
+{
+	return ({ QByteArray taabe0f = static_cast<QLineEdit*>(ptr)->inputMask().toUtf8(); QtWidgets_PackedString { const_cast<char*>(taabe0f.prepend("WHITESPACE").constData()+10), taabe0f.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QLineEdit_PlaceholderText(void* ptr)
+{
+	return ({ QByteArray t749e76 = static_cast<QLineEdit*>(ptr)->placeholderText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t749e76.prepend("WHITESPACE").constData()+10), t749e76.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QLineEdit_SelectedText(void* ptr)
+{
+	return ({ QByteArray t1e6e00 = static_cast<QLineEdit*>(ptr)->selectedText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t1e6e00.prepend("WHITESPACE").constData()+10), t1e6e00.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QLineEdit_Text(void* ptr)
+{
+	return ({ QByteArray te2605d = static_cast<QLineEdit*>(ptr)->text().toUtf8(); QtWidgets_PackedString { const_cast<char*>(te2605d.prepend("WHITESPACE").constData()+10), te2605d.size()-10 }; });
+}
+
+long long QLineEdit_Alignment(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->alignment();
+}
+
+long long QLineEdit_CursorMoveStyle(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->cursorMoveStyle();
+}
+
+char QLineEdit_DragEnabled(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->dragEnabled();
+}
+
+char QLineEdit_HasAcceptableInput(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->hasAcceptableInput();
+}
+
+char QLineEdit_HasFrame(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->hasFrame();
+}
+
+char QLineEdit_HasSelectedText(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->hasSelectedText();
+}
+
+char QLineEdit_IsClearButtonEnabled(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->isClearButtonEnabled();
+}
+
+char QLineEdit_IsModified(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->isModified();
+}
+
+char QLineEdit_IsReadOnly(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->isReadOnly();
+}
+
+char QLineEdit_IsRedoAvailable(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->isRedoAvailable();
+}
+
+char QLineEdit_IsUndoAvailable(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->isUndoAvailable();
+}
+
+void* QLineEdit_Validator(void* ptr)
+{
+	return const_cast<QValidator*>(static_cast<QLineEdit*>(ptr)->validator());
+}
+
+int QLineEdit_CursorPosition(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->cursorPosition();
+}
+
+int QLineEdit_MaxLength(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->maxLength();
+}
+
+int QLineEdit_SelectionStart(void* ptr)
+{
+	return static_cast<QLineEdit*>(ptr)->selectionStart();
+}
+
+void QLineEdit_Copy(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QLineEdit*>(ptr), "copy");
+}
+
+void QLineEdit_CopyDefault(void* ptr)
+{
+		static_cast<QLineEdit*>(ptr)->QLineEdit::copy();
+}
+
+void QLineEdit_GetTextMargins(void* ptr, int left, int top, int right, int bottom)
+{
+	static_cast<QLineEdit*>(ptr)->getTextMargins(&left, &top, &right, &bottom);
+}
+
+void QLineEdit_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QLineEdit*>(ptr)->initStyleOption(static_cast<QStyleOptionFrame*>(option));
+}
+
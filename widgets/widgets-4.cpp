@@ -0,0 +1,11625 @@
+// +build !minimal
+
+#define protected public
+#define private public
+
+#include "widgets.h"
+#include "_cgo_export.h"
+
+#include <QAbstractAnimation>
+#include <QAbstractButton>
+#include <QAbstractItemDelegate>
+#include <QAbstractItemModel>
+#include <QAbstractItemView>
+#include <QAbstractScrollArea>
+#include <QAbstractSlider>
+#include <QAbstractSpinBox>
+#include <QAbstractState>
+#include <QAbstractTextDocumentLayout>
+#include <QAction>
+#include <QActionEvent>
+#include <QApplication>
+#include <QBrush>
+#include <QByteArray>
+#include <QCheckBox>
+#include <QChildEvent>
+#include <QCloseEvent>
+#include <QColor>
+#include <QCommandLinkButton>
+#include <QCommonStyle>
+#include <QContextMenuEvent>
+#include <QDataStream>
+#include <QDial>
+#include <QDialog>
+#include <QDockWidget>
+#include <QDrag>
+#include <QDragEnterEvent>
+#include <QDragLeaveEvent>
+#include <QDragMoveEvent>
+#include <QDropEvent>
+#include <QEvent>
+#include <QFocusEvent>
+#include <QFont>
+#include <QFontMetrics>
+#include <QGesture>
+#include <QGraphicsObject>
+#include <QGraphicsWidget>
+#include <QHideEvent>
+#include <QIcon>
+#include <QInputMethod>
+#include <QInputMethodEvent>
+#include <QItemSelection>
+#include <QItemSelectionModel>
+#include <QKeyEvent>
+#include <QKeySequence>
+#include <QLabel>
+#include <QLayout>
+#include <QLayoutItem>
+#include <QList>
+#include <QListView>
+#include <QListWidget>
+#include <QListWidgetItem>
+#include <QMacCocoaViewContainer>
+#include <QMacNativeWidget>
+#include <QMainWindow>
+#include <QMdiArea>
+#include <QMdiSubWindow>
+#include <QMenu>
+#include <QMenuBar>
+#include <QMessageBox>
+#include <QMetaMethod>
+#include <QMetaObject>
+#include <QMimeData>
+#include <QModelIndex>
+#include <QMouseEvent>
+#include <QMouseEventTransition>
+#include <QMoveEvent>
+#include <QObject>
+#include <QPagedPaintDevice>
+#include <QPaintDevice>
+#include <QPaintEngine>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPalette>
+#include <QPanGesture>
+#include <QPinchGesture>
+#include <QPixmap>
+#include <QPlainTextDocumentLayout>
+#include <QPlainTextEdit>
+#include <QPoint>
+#include <QPointF>
+#include <QProgressBar>
+#include <QProgressDialog>
+#include <QProxyStyle>
+#include <QPushButton>
+#include <QRadioButton>
+#include <QRect>
+#include <QRectF>
+#include <QRegExp>
+#include <QRegion>
+#include <QResizeEvent>
+#include <QRubberBand>
+#include <QScrollArea>
+#include <QScrollBar>
+#include <QScroller>
+#include <QScrollerProperties>
+#include <QShortcut>
+#include <QShowEvent>
+#include <QSize>
+#include <QSizeF>
+#include <QSizeGrip>
+#include <QSizePolicy>
+#include <QSlider>
+#include <QSpacerItem>
+#include <QSpinBox>
+#include <QSplashScreen>
+#include <QSplitter>
+#include <QSplitterHandle>
+#include <QStack>
+#include <QStackedLayout>
+#include <QStackedWidget>
+#include <QState>
+#include <QStatusBar>
+#include <QString>
+#include <QStringList>
+#include <QStyle>
+#include <QStyleHintReturn>
+#include <QStyleOption>
+#include <QStyleOptionButton>
+#include <QStyleOptionComplex>
+#include <QStyleOptionMenuItem>
+#include <QStyleOptionProgressBar>
+#include <QStyleOptionRubberBand>
+#include <QStyleOptionSlider>
+#include <QStyleOptionViewItem>
+#include <QTabWidget>
+#include <QTabletEvent>
+#include <QTextBlock>
+#include <QTextCharFormat>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTextFormat>
+#include <QTextFrame>
+#include <QTextInlineObject>
+#include <QTextOption>
+#include <QTime>
+#include <QTimer>
+#include <QTimerEvent>
+#include <QToolBar>
+#include <QUndoView>
+#include <QUrl>
+#include <QValidator>
+#include <QVariant>
+#include <QVector>
+#include <QWheelEvent>
+#include <QWidget>
+#include <QtEndian>
+#include <cstdlib>
+#include <QScopedPointer>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+class MyQListView: public QListView
+{
+public:
+	MyQListView(QWidget *parent) : QListView(parent) {};
+	QModelIndex moveCursor(QAbstractItemView::CursorAction cursorAction, Qt::KeyboardModifiers modifiers) { return *static_cast<QModelIndex*>(callbackQListView_MoveCursor(this, cursorAction, modifiers)); };
+	void currentChanged(const QModelIndex & current, const QModelIndex & previous) { callbackQListView_CurrentChanged(this, const_cast<QModelIndex*>(&current), const_cast<QModelIndex*>(&previous)); };
+	void dataChanged(const QModelIndex & topLeft, const QModelIndex & bottomRight, const QVector<int> & roles) { callbackQListView_DataChanged(this, const_cast<QModelIndex*>(&topLeft), const_cast<QModelIndex*>(&bottomRight), ({ QVector<int>* tmpValue = const_cast<QVector<int>*>(&roles); QtWidgets_PackedList { tmpValue, tmpValue->size() }; })); };
+	void dragLeaveEvent(QDragLeaveEvent * e) { callbackQWidget_DragLeaveEvent(this, e); };
+	void dragMoveEvent(QDragMoveEvent * e) { callbackQWidget_DragMoveEvent(this, e); };
+	void dropEvent(QDropEvent * e) { callbackQWidget_DropEvent(this, e); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * e) { callbackQWidget_PaintEvent(this, e); };
+	void resizeEvent(QResizeEvent * e) { callbackQWidget_ResizeEvent(this, e); };
+	void rowsAboutToBeRemoved(const QModelIndex & parent, int start, int end) { callbackQListView_RowsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void rowsInserted(const QModelIndex & parent, int start, int end) { callbackQListView_RowsInserted(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void scrollTo(const QModelIndex & index, QAbstractItemView::ScrollHint hint) { callbackQListView_ScrollTo(this, const_cast<QModelIndex*>(&index), hint); };
+	void selectionChanged(const QItemSelection & selected, const QItemSelection & deselected) { callbackQListView_SelectionChanged(this, const_cast<QItemSelection*>(&selected), const_cast<QItemSelection*>(&deselected)); };
+	void setSelection(const QRect & rect, QItemSelectionModel::SelectionFlags command) { callbackQListView_SetSelection(this, const_cast<QRect*>(&rect), command); };
+	void startDrag(Qt::DropActions supportedActions) { callbackQAbstractItemView_StartDrag(this, supportedActions); };
+	void updateGeometries() { callbackQListView_UpdateGeometries(this); };
+	void wheelEvent(QWheelEvent * e) { callbackQWidget_WheelEvent(this, e); };
+	QModelIndex indexAt(const QPoint & p) const { return *static_cast<QModelIndex*>(callbackQListView_IndexAt(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPoint*>(&p))); };
+	QList<QModelIndex> selectedIndexes() const { return *static_cast<QList<QModelIndex>*>(callbackQAbstractItemView_SelectedIndexes(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRect visualRect(const QModelIndex & index) const { return *static_cast<QRect*>(callbackQListView_VisualRect(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QRegion visualRegionForSelection(const QItemSelection & selection) const { return *static_cast<QRegion*>(callbackQListView_VisualRegionForSelection(const_cast<void*>(static_cast<const void*>(this)), const_cast<QItemSelection*>(&selection))); };
+	QSize viewportSizeHint() const { return *static_cast<QSize*>(callbackQAbstractScrollArea_ViewportSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QStyleOptionViewItem viewOptions() const { return *static_cast<QStyleOptionViewItem*>(callbackQAbstractItemView_ViewOptions(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool isIndexHidden(const QModelIndex & index) const { return callbackQListView_IsIndexHidden(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index)) != 0; };
+	int horizontalOffset() const { return callbackQListView_HorizontalOffset(const_cast<void*>(static_cast<const void*>(this))); };
+	int verticalOffset() const { return callbackQListView_VerticalOffset(const_cast<void*>(static_cast<const void*>(this))); };
+	bool edit(const QModelIndex & index, QAbstractItemView::EditTrigger trigger, QEvent * event) { return callbackQAbstractItemView_Edit2(this, const_cast<QModelIndex*>(&index), trigger, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool viewportEvent(QEvent * event) { return callbackQAbstractScrollArea_ViewportEvent(this, event) != 0; };
+	void Signal_Activated(const QModelIndex & index) { callbackQAbstractItemView_Activated(this, const_cast<QModelIndex*>(&index)); };
+	void clearSelection() { callbackQAbstractItemView_ClearSelection(this); };
+	void Signal_Clicked(const QModelIndex & index) { callbackQAbstractItemView_Clicked(this, const_cast<QModelIndex*>(&index)); };
+	void closeEditor(QWidget * editor, QAbstractItemDelegate::EndEditHint hint) { callbackQAbstractItemView_CloseEditor(this, editor, hint); };
+	void commitData(QWidget * editor) { callbackQAbstractItemView_CommitData(this, editor); };
+	void Signal_DoubleClicked(const QModelIndex & index) { callbackQAbstractItemView_DoubleClicked(this, const_cast<QModelIndex*>(&index)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void edit(const QModelIndex & index) { callbackQAbstractItemView_Edit(this, const_cast<QModelIndex*>(&index)); };
+	void editorDestroyed(QObject * editor) { callbackQAbstractItemView_EditorDestroyed(this, editor); };
+	void Signal_Entered(const QModelIndex & index) { callbackQAbstractItemView_Entered(this, const_cast<QModelIndex*>(&index)); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void Signal_IconSizeChanged(const QSize & size) { callbackQAbstractItemView_IconSizeChanged(this, const_cast<QSize*>(&size)); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyboardSearch(const QString & search) { QByteArray t3559d7 = search.toUtf8(); QtWidgets_PackedString searchPacked = { const_cast<char*>(t3559d7.prepend("WHITESPACE").constData()+10), t3559d7.size()-10 };callbackQAbstractItemView_KeyboardSearch(this, searchPacked); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void Signal_Pressed(const QModelIndex & index) { callbackQAbstractItemView_Pressed(this, const_cast<QModelIndex*>(&index)); };
+	void reset() { callbackQAbstractItemView_Reset(this); };
+	void scrollToBottom() { callbackQAbstractItemView_ScrollToBottom(this); };
+	void scrollToTop() { callbackQAbstractItemView_ScrollToTop(this); };
+	void selectAll() { callbackQAbstractItemView_SelectAll(this); };
+	void setCurrentIndex(const QModelIndex & index) { callbackQAbstractItemView_SetCurrentIndex(this, const_cast<QModelIndex*>(&index)); };
+	void setModel(QAbstractItemModel * model) { callbackQAbstractItemView_SetModel(this, model); };
+	void setRootIndex(const QModelIndex & index) { callbackQAbstractItemView_SetRootIndex(this, const_cast<QModelIndex*>(&index)); };
+	void setSelectionModel(QItemSelectionModel * selectionModel) { callbackQAbstractItemView_SetSelectionModel(this, selectionModel); };
+	void update(const QModelIndex & index) { callbackQAbstractItemView_Update(this, const_cast<QModelIndex*>(&index)); };
+	void Signal_ViewportEntered() { callbackQAbstractItemView_ViewportEntered(this); };
+	QItemSelectionModel::SelectionFlags selectionCommand(const QModelIndex & index, const QEvent * event) const { return static_cast<QItemSelectionModel::SelectionFlag>(callbackQAbstractItemView_SelectionCommand(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), const_cast<QEvent*>(event))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	int sizeHintForColumn(int column) const { return callbackQAbstractItemView_SizeHintForColumn(const_cast<void*>(static_cast<const void*>(this)), column); };
+	int sizeHintForRow(int row) const { return callbackQAbstractItemView_SizeHintForRow(const_cast<void*>(static_cast<const void*>(this)), row); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void scrollContentsBy(int dx, int dy) { callbackQAbstractScrollArea_ScrollContentsBy(this, dx, dy); };
+	void setupViewport(QWidget * viewport) { callbackQAbstractScrollArea_SetupViewport(this, viewport); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QListView_NewQListView(void* parent)
+{
+	return new MyQListView(static_cast<QWidget*>(parent));
+}
+
+void* QListView_MoveCursor(void* ptr, long long cursorAction, long long modifiers)
+{
+	return new QModelIndex(static_cast<QListView*>(ptr)->moveCursor(static_cast<QAbstractItemView::CursorAction>(cursorAction), static_cast<Qt::KeyboardModifier>(modifiers)));
+}
+
+void* QListView_MoveCursorDefault(void* ptr, long long cursorAction, long long modifiers)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		return new QModelIndex(static_cast<QUndoView*>(ptr)->QUndoView::moveCursor(static_cast<QAbstractItemView::CursorAction>(cursorAction), static_cast<Qt::KeyboardModifier>(modifiers)));
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		return new QModelIndex(static_cast<QListWidget*>(ptr)->QListWidget::moveCursor(static_cast<QAbstractItemView::CursorAction>(cursorAction), static_cast<Qt::KeyboardModifier>(modifiers)));
+	} else {
+		return new QModelIndex(static_cast<QListView*>(ptr)->QListView::moveCursor(static_cast<QAbstractItemView::CursorAction>(cursorAction), static_cast<Qt::KeyboardModifier>(modifiers)));
+	}
+}
+
+void QListView_ClearPropertyFlags(void* ptr)
+{
+	static_cast<QListView*>(ptr)->clearPropertyFlags();
+}
+
+void QListView_CurrentChanged(void* ptr, void* current, void* previous)
+{
+	static_cast<QListView*>(ptr)->currentChanged(*static_cast<QModelIndex*>(current), *static_cast<QModelIndex*>(previous));
+}
+
+void QListView_CurrentChangedDefault(void* ptr, void* current, void* previous)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		static_cast<QUndoView*>(ptr)->QUndoView::currentChanged(*static_cast<QModelIndex*>(current), *static_cast<QModelIndex*>(previous));
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QListWidget*>(ptr)->QListWidget::currentChanged(*static_cast<QModelIndex*>(current), *static_cast<QModelIndex*>(previous));
+	} else {
+		static_cast<QListView*>(ptr)->QListView::currentChanged(*static_cast<QModelIndex*>(current), *static_cast<QModelIndex*>(previous));
+	}
+}
+
+void QListView_DataChanged(void* ptr, void* topLeft, void* bottomRight, void* roles)
+{
+	static_cast<QListView*>(ptr)->dataChanged(*static_cast<QModelIndex*>(topLeft), *static_cast<QModelIndex*>(bottomRight), *static_cast<QVector<int>*>(roles));
+}
+
+void QListView_DataChangedDefault(void* ptr, void* topLeft, void* bottomRight, void* roles)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		static_cast<QUndoView*>(ptr)->QUndoView::dataChanged(*static_cast<QModelIndex*>(topLeft), *static_cast<QModelIndex*>(bottomRight), *static_cast<QVector<int>*>(roles));
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QListWidget*>(ptr)->QListWidget::dataChanged(*static_cast<QModelIndex*>(topLeft), *static_cast<QModelIndex*>(bottomRight), *static_cast<QVector<int>*>(roles));
+	} else {
+		static_cast<QListView*>(ptr)->QListView::dataChanged(*static_cast<QModelIndex*>(topLeft), *static_cast<QModelIndex*>(bottomRight), *static_cast<QVector<int>*>(roles));
+	}
+}
+
+void QListView_RowsAboutToBeRemoved(void* ptr, void* parent, int start, int end)
+{
+	static_cast<QListView*>(ptr)->rowsAboutToBeRemoved(*static_cast<QModelIndex*>(parent), start, end);
+}
+
+void QListView_RowsAboutToBeRemovedDefault(void* ptr, void* parent, int start, int end)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		static_cast<QUndoView*>(ptr)->QUndoView::rowsAboutToBeRemoved(*static_cast<QModelIndex*>(parent), start, end);
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QListWidget*>(ptr)->QListWidget::rowsAboutToBeRemoved(*static_cast<QModelIndex*>(parent), start, end);
+	} else {
+		static_cast<QListView*>(ptr)->QListView::rowsAboutToBeRemoved(*static_cast<QModelIndex*>(parent), start, end);
+	}
+}
+
+void QListView_RowsInserted(void* ptr, void* parent, int start, int end)
+{
+	static_cast<QListView*>(ptr)->rowsInserted(*static_cast<QModelIndex*>(parent), start, end);
+}
+
+void QListView_RowsInsertedDefault(void* ptr, void* parent, int start, int end)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		static_cast<QUndoView*>(ptr)->QUndoView::rowsInserted(*static_cast<QModelIndex*>(parent), start, end);
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QListWidget*>(ptr)->QListWidget::rowsInserted(*static_cast<QModelIndex*>(parent), start, end);
+	} else {
+		static_cast<QListView*>(ptr)->QListView::rowsInserted(*static_cast<QModelIndex*>(parent), start, end);
+	}
+}
+
+void QListView_ScrollTo(void* ptr, void* index, long long hint)
+{
+	static_cast<QListView*>(ptr)->scrollTo(*static_cast<QModelIndex*>(index), static_cast<QAbstractItemView::ScrollHint>(hint));
+}
+
+void QListView_ScrollToDefault(void* ptr, void* index, long long hint)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		static_cast<QUndoView*>(ptr)->QUndoView::scrollTo(*static_cast<QModelIndex*>(index), static_cast<QAbstractItemView::ScrollHint>(hint));
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QListWidget*>(ptr)->QListWidget::scrollTo(*static_cast<QModelIndex*>(index), static_cast<QAbstractItemView::ScrollHint>(hint));
+	} else {
+		static_cast<QListView*>(ptr)->QListView::scrollTo(*static_cast<QModelIndex*>(index), static_cast<QAbstractItemView::ScrollHint>(hint));
+	}
+}
+
+void QListView_SelectionChanged(void* ptr, void* selected, void* deselected)
+{
+	static_cast<QListView*>(ptr)->selectionChanged(*static_cast<QItemSelection*>(selected), *static_cast<QItemSelection*>(deselected));
+}
+
+void QListView_SelectionChangedDefault(void* ptr, void* selected, void* deselected)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		static_cast<QUndoView*>(ptr)->QUndoView::selectionChanged(*static_cast<QItemSelection*>(selected), *static_cast<QItemSelection*>(deselected));
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QListWidget*>(ptr)->QListWidget::selectionChanged(*static_cast<QItemSelection*>(selected), *static_cast<QItemSelection*>(deselected));
+	} else {
+		static_cast<QListView*>(ptr)->QListView::selectionChanged(*static_cast<QItemSelection*>(selected), *static_cast<QItemSelection*>(deselected));
+	}
+}
+
+void QListView_SetBatchSize(void* ptr, int batchSize)
+{
+	static_cast<QListView*>(ptr)->setBatchSize(batchSize);
+}
+
+void QListView_SetFlow(void* ptr, long long flow)
+{
+	static_cast<QListView*>(ptr)->setFlow(static_cast<QListView::Flow>(flow));
+}
+
+void QListView_SetGridSize(void* ptr, void* size)
+{
+	static_cast<QListView*>(ptr)->setGridSize(*static_cast<QSize*>(size));
+}
+
+void QListView_SetLayoutMode(void* ptr, long long mode)
+{
+	static_cast<QListView*>(ptr)->setLayoutMode(static_cast<QListView::LayoutMode>(mode));
+}
+
+void QListView_SetModelColumn(void* ptr, int column)
+{
+	static_cast<QListView*>(ptr)->setModelColumn(column);
+}
+
+void QListView_SetMovement(void* ptr, long long movement)
+{
+	static_cast<QListView*>(ptr)->setMovement(static_cast<QListView::Movement>(movement));
+}
+
+void QListView_SetPositionForIndex(void* ptr, void* position, void* index)
+{
+	static_cast<QListView*>(ptr)->setPositionForIndex(*static_cast<QPoint*>(position), *static_cast<QModelIndex*>(index));
+}
+
+void QListView_SetResizeMode(void* ptr, long long mode)
+{
+	static_cast<QListView*>(ptr)->setResizeMode(static_cast<QListView::ResizeMode>(mode));
+}
+
+void QListView_SetRowHidden(void* ptr, int row, char hide)
+{
+	static_cast<QListView*>(ptr)->setRowHidden(row, hide != 0);
+}
+
+void QListView_SetSelection(void* ptr, void* rect, long long command)
+{
+	static_cast<QListView*>(ptr)->setSelection(*static_cast<QRect*>(rect), static_cast<QItemSelectionModel::SelectionFlag>(command));
+}
+
+void QListView_SetSelectionDefault(void* ptr, void* rect, long long command)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		static_cast<QUndoView*>(ptr)->QUndoView::setSelection(*static_cast<QRect*>(rect), static_cast<QItemSelectionModel::SelectionFlag>(command));
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QListWidget*>(ptr)->QListWidget::setSelection(*static_cast<QRect*>(rect), static_cast<QItemSelectionModel::SelectionFlag>(command));
+	} else {
+		static_cast<QListView*>(ptr)->QListView::setSelection(*static_cast<QRect*>(rect), static_cast<QItemSelectionModel::SelectionFlag>(command));
+	}
+}
+
+void QListView_SetSelectionRectVisible(void* ptr, char show)
+{
+	static_cast<QListView*>(ptr)->setSelectionRectVisible(show != 0);
+}
+
+void QListView_SetSpacing(void* ptr, int space)
+{
+	static_cast<QListView*>(ptr)->setSpacing(space);
+}
+
+void QListView_SetUniformItemSizes(void* ptr, char enable)
+{
+	static_cast<QListView*>(ptr)->setUniformItemSizes(enable != 0);
+}
+
+void QListView_SetViewMode(void* ptr, long long mode)
+{
+	static_cast<QListView*>(ptr)->setViewMode(static_cast<QListView::ViewMode>(mode));
+}
+
+void QListView_SetWordWrap(void* ptr, char on)
+{
+	static_cast<QListView*>(ptr)->setWordWrap(on != 0);
+}
+
+void QListView_SetWrapping(void* ptr, char enable)
+{
+	static_cast<QListView*>(ptr)->setWrapping(enable != 0);
+}
+
+void QListView_UpdateGeometries(void* ptr)
+{
+	static_cast<QListView*>(ptr)->updateGeometries();
+}
+
+void QListView_UpdateGeometriesDefault(void* ptr)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		static_cast<QUndoView*>(ptr)->QUndoView::updateGeometries();
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		static_cast<QListWidget*>(ptr)->QListWidget::updateGeometries();
+	} else {
+		static_cast<QListView*>(ptr)->QListView::updateGeometries();
+	}
+}
+
+void QListView_DestroyQListView(void* ptr)
+{
+	static_cast<QListView*>(ptr)->~QListView();
+}
+
+long long QListView_Flow(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->flow();
+}
+
+long long QListView_LayoutMode(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->layoutMode();
+}
+
+long long QListView_Movement(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->movement();
+}
+
+void* QListView_IndexAt(void* ptr, void* p)
+{
+	return new QModelIndex(static_cast<QListView*>(ptr)->indexAt(*static_cast<QPoint*>(p)));
+}
+
+void* QListView_IndexAtDefault(void* ptr, void* p)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		return new QModelIndex(static_cast<QUndoView*>(ptr)->QUndoView::indexAt(*static_cast<QPoint*>(p)));
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		return new QModelIndex(static_cast<QListWidget*>(ptr)->QListWidget::indexAt(*static_cast<QPoint*>(p)));
+	} else {
+		return new QModelIndex(static_cast<QListView*>(ptr)->QListView::indexAt(*static_cast<QPoint*>(p)));
+	}
+}
+
+void* QListView_RectForIndex(void* ptr, void* index)
+{
+	return ({ QRect tmpValue = static_cast<QListView*>(ptr)->rectForIndex(*static_cast<QModelIndex*>(index)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QListView_VisualRect(void* ptr, void* index)
+{
+	return ({ QRect tmpValue = static_cast<QListView*>(ptr)->visualRect(*static_cast<QModelIndex*>(index)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QListView_VisualRectDefault(void* ptr, void* index)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QUndoView*>(ptr)->QUndoView::visualRect(*static_cast<QModelIndex*>(index)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QListWidget*>(ptr)->QListWidget::visualRect(*static_cast<QModelIndex*>(index)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRect tmpValue = static_cast<QListView*>(ptr)->QListView::visualRect(*static_cast<QModelIndex*>(index)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QListView_VisualRegionForSelection(void* ptr, void* selection)
+{
+	return new QRegion(static_cast<QListView*>(ptr)->visualRegionForSelection(*static_cast<QItemSelection*>(selection)));
+}
+
+void* QListView_VisualRegionForSelectionDefault(void* ptr, void* selection)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		return new QRegion(static_cast<QUndoView*>(ptr)->QUndoView::visualRegionForSelection(*static_cast<QItemSelection*>(selection)));
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		return new QRegion(static_cast<QListWidget*>(ptr)->QListWidget::visualRegionForSelection(*static_cast<QItemSelection*>(selection)));
+	} else {
+		return new QRegion(static_cast<QListView*>(ptr)->QListView::visualRegionForSelection(*static_cast<QItemSelection*>(selection)));
+	}
+}
+
+void* QListView_GridSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QListView*>(ptr)->gridSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+long long QListView_ResizeMode(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->resizeMode();
+}
+
+long long QListView_ViewMode(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->viewMode();
+}
+
+char QListView_IsIndexHidden(void* ptr, void* index)
+{
+	return static_cast<QListView*>(ptr)->isIndexHidden(*static_cast<QModelIndex*>(index));
+}
+
+char QListView_IsIndexHiddenDefault(void* ptr, void* index)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QUndoView*>(ptr)->QUndoView::isIndexHidden(*static_cast<QModelIndex*>(index));
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QListWidget*>(ptr)->QListWidget::isIndexHidden(*static_cast<QModelIndex*>(index));
+	} else {
+		return static_cast<QListView*>(ptr)->QListView::isIndexHidden(*static_cast<QModelIndex*>(index));
+	}
+}
+
+char QListView_IsRowHidden(void* ptr, int row)
+{
+	return static_cast<QListView*>(ptr)->isRowHidden(row);
+}
+
+char QListView_IsSelectionRectVisible(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->isSelectionRectVisible();
+}
+
+char QListView_IsWrapping(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->isWrapping();
+}
+
+char QListView_UniformItemSizes(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->uniformItemSizes();
+}
+
+char QListView_WordWrap(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->wordWrap();
+}
+
+int QListView_BatchSize(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->batchSize();
+}
+
+int QListView_HorizontalOffset(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->horizontalOffset();
+}
+
+int QListView_HorizontalOffsetDefault(void* ptr)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QUndoView*>(ptr)->QUndoView::horizontalOffset();
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QListWidget*>(ptr)->QListWidget::horizontalOffset();
+	} else {
+		return static_cast<QListView*>(ptr)->QListView::horizontalOffset();
+	}
+}
+
+int QListView_ModelColumn(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->modelColumn();
+}
+
+int QListView_Spacing(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->spacing();
+}
+
+int QListView_VerticalOffset(void* ptr)
+{
+	return static_cast<QListView*>(ptr)->verticalOffset();
+}
+
+int QListView_VerticalOffsetDefault(void* ptr)
+{
+	if (dynamic_cast<QUndoView*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QUndoView*>(ptr)->QUndoView::verticalOffset();
+	} else if (dynamic_cast<QListWidget*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QListWidget*>(ptr)->QListWidget::verticalOffset();
+	} else {
+		return static_cast<QListView*>(ptr)->QListView::verticalOffset();
+	}
+}
+
+void* QListView___indexesMoved_indexes_atList(void* ptr, int i)
+{
+	return new QModelIndex(static_cast<QList<QModelIndex>*>(ptr)->at(i));
+}
+
+void QListView___indexesMoved_indexes_setList(void* ptr, void* i)
+{
+	static_cast<QList<QModelIndex>*>(ptr)->append(*static_cast<QModelIndex*>(i));
+}
+
+void* QListView___indexesMoved_indexes_newList(void* ptr)
+{
+	return new QList<QModelIndex>;
+}
+
+class MyQListWidget: public QListWidget
+{
+public:
+	MyQListWidget(QWidget *parent) : QListWidget(parent) {};
+	bool dropMimeData(int index, const QMimeData * data, Qt::DropAction action) { return callbackQListWidget_DropMimeData(this, index, const_cast<QMimeData*>(data), action) != 0; };
+	void clear() { callbackQListWidget_Clear(this); };
+	void Signal_CurrentItemChanged(QListWidgetItem * current, QListWidgetItem * previous) { callbackQListWidget_CurrentItemChanged(this, current, previous); };
+	void Signal_CurrentRowChanged(int currentRow) { callbackQListWidget_CurrentRowChanged(this, currentRow); };
+	void Signal_CurrentTextChanged(const QString & currentText) { QByteArray t5a0ada = currentText.toUtf8(); QtWidgets_PackedString currentTextPacked = { const_cast<char*>(t5a0ada.prepend("WHITESPACE").constData()+10), t5a0ada.size()-10 };callbackQListWidget_CurrentTextChanged(this, currentTextPacked); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void Signal_ItemActivated(QListWidgetItem * item) { callbackQListWidget_ItemActivated(this, item); };
+	void Signal_ItemChanged(QListWidgetItem * item) { callbackQListWidget_ItemChanged(this, item); };
+	void Signal_ItemClicked(QListWidgetItem * item) { callbackQListWidget_ItemClicked(this, item); };
+	void Signal_ItemDoubleClicked(QListWidgetItem * item) { callbackQListWidget_ItemDoubleClicked(this, item); };
+	void Signal_ItemEntered(QListWidgetItem * item) { callbackQListWidget_ItemEntered(this, item); };
+	void Signal_ItemPressed(QListWidgetItem * item) { callbackQListWidget_ItemPressed(this, item); };
+	void Signal_ItemSelectionChanged() { callbackQListWidget_ItemSelectionChanged(this); };
+	void scrollToItem(const QListWidgetItem * item, QAbstractItemView::ScrollHint hint) { callbackQListWidget_ScrollToItem(this, const_cast<QListWidgetItem*>(item), hint); };
+	void setSelectionModel(QItemSelectionModel * selectionModel) { callbackQAbstractItemView_SetSelectionModel(this, selectionModel); };
+	QMimeData * mimeData(const QList<QListWidgetItem *> items) const { return static_cast<QMimeData*>(callbackQListWidget_MimeData(const_cast<void*>(static_cast<const void*>(this)), ({ QList<QListWidgetItem *>* tmpValue = new QList<QListWidgetItem *>(items); QtWidgets_PackedList { tmpValue, tmpValue->size() }; }))); };
+	QStringList mimeTypes() const { char* tmp = callbackQListWidget_MimeTypes(const_cast<void*>(static_cast<const void*>(this))); QStringList ret = goUnpackStringList(tmp); free(tmp); return ret; };
+	Qt::DropActions supportedDropActions() const { return static_cast<Qt::DropAction>(callbackQListWidget_SupportedDropActions(const_cast<void*>(static_cast<const void*>(this)))); };
+	QModelIndex moveCursor(QAbstractItemView::CursorAction cursorAction, Qt::KeyboardModifiers modifiers) { return *static_cast<QModelIndex*>(callbackQListView_MoveCursor(this, cursorAction, modifiers)); };
+	void currentChanged(const QModelIndex & current, const QModelIndex & previous) { callbackQListView_CurrentChanged(this, const_cast<QModelIndex*>(&current), const_cast<QModelIndex*>(&previous)); };
+	void dataChanged(const QModelIndex & topLeft, const QModelIndex & bottomRight, const QVector<int> & roles) { callbackQListView_DataChanged(this, const_cast<QModelIndex*>(&topLeft), const_cast<QModelIndex*>(&bottomRight), ({ QVector<int>* tmpValue = const_cast<QVector<int>*>(&roles); QtWidgets_PackedList { tmpValue, tmpValue->size() }; })); };
+	void dragLeaveEvent(QDragLeaveEvent * e) { callbackQWidget_DragLeaveEvent(this, e); };
+	void dragMoveEvent(QDragMoveEvent * e) { callbackQWidget_DragMoveEvent(this, e); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * e) { callbackQWidget_PaintEvent(this, e); };
+	void resizeEvent(QResizeEvent * e) { callbackQWidget_ResizeEvent(this, e); };
+	void rowsAboutToBeRemoved(const QModelIndex & parent, int start, int end) { callbackQListView_RowsAboutToBeRemoved(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void rowsInserted(const QModelIndex & parent, int start, int end) { callbackQListView_RowsInserted(this, const_cast<QModelIndex*>(&parent), start, end); };
+	void scrollTo(const QModelIndex & index, QAbstractItemView::ScrollHint hint) { callbackQListView_ScrollTo(this, const_cast<QModelIndex*>(&index), hint); };
+	void selectionChanged(const QItemSelection & selected, const QItemSelection & deselected) { callbackQListView_SelectionChanged(this, const_cast<QItemSelection*>(&selected), const_cast<QItemSelection*>(&deselected)); };
+	void setSelection(const QRect & rect, QItemSelectionModel::SelectionFlags command) { callbackQListView_SetSelection(this, const_cast<QRect*>(&rect), command); };
+	void startDrag(Qt::DropActions supportedActions) { callbackQAbstractItemView_StartDrag(this, supportedActions); };
+	void updateGeometries() { callbackQListView_UpdateGeometries(this); };
+	void wheelEvent(QWheelEvent * e) { callbackQWidget_WheelEvent(this, e); };
+	QModelIndex indexAt(const QPoint & p) const { return *static_cast<QModelIndex*>(callbackQListView_IndexAt(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPoint*>(&p))); };
+	QList<QModelIndex> selectedIndexes() const { return *static_cast<QList<QModelIndex>*>(callbackQAbstractItemView_SelectedIndexes(const_cast<void*>(static_cast<const void*>(this)))); };
+	QRect visualRect(const QModelIndex & index) const { return *static_cast<QRect*>(callbackQListView_VisualRect(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index))); };
+	QRegion visualRegionForSelection(const QItemSelection & selection) const { return *static_cast<QRegion*>(callbackQListView_VisualRegionForSelection(const_cast<void*>(static_cast<const void*>(this)), const_cast<QItemSelection*>(&selection))); };
+	QSize viewportSizeHint() const { return *static_cast<QSize*>(callbackQAbstractScrollArea_ViewportSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QStyleOptionViewItem viewOptions() const { return *static_cast<QStyleOptionViewItem*>(callbackQAbstractItemView_ViewOptions(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool isIndexHidden(const QModelIndex & index) const { return callbackQListView_IsIndexHidden(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index)) != 0; };
+	int horizontalOffset() const { return callbackQListView_HorizontalOffset(const_cast<void*>(static_cast<const void*>(this))); };
+	int verticalOffset() const { return callbackQListView_VerticalOffset(const_cast<void*>(static_cast<const void*>(this))); };
+	bool edit(const QModelIndex & index, QAbstractItemView::EditTrigger trigger, QEvent * event) { return callbackQAbstractItemView_Edit2(this, const_cast<QModelIndex*>(&index), trigger, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool viewportEvent(QEvent * event) { return callbackQAbstractScrollArea_ViewportEvent(this, event) != 0; };
+	void Signal_Activated(const QModelIndex & index) { callbackQAbstractItemView_Activated(this, const_cast<QModelIndex*>(&index)); };
+	void clearSelection() { callbackQAbstractItemView_ClearSelection(this); };
+	void Signal_Clicked(const QModelIndex & index) { callbackQAbstractItemView_Clicked(this, const_cast<QModelIndex*>(&index)); };
+	void closeEditor(QWidget * editor, QAbstractItemDelegate::EndEditHint hint) { callbackQAbstractItemView_CloseEditor(this, editor, hint); };
+	void commitData(QWidget * editor) { callbackQAbstractItemView_CommitData(this, editor); };
+	void Signal_DoubleClicked(const QModelIndex & index) { callbackQAbstractItemView_DoubleClicked(this, const_cast<QModelIndex*>(&index)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void edit(const QModelIndex & index) { callbackQAbstractItemView_Edit(this, const_cast<QModelIndex*>(&index)); };
+	void editorDestroyed(QObject * editor) { callbackQAbstractItemView_EditorDestroyed(this, editor); };
+	void Signal_Entered(const QModelIndex & index) { callbackQAbstractItemView_Entered(this, const_cast<QModelIndex*>(&index)); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void Signal_IconSizeChanged(const QSize & size) { callbackQAbstractItemView_IconSizeChanged(this, const_cast<QSize*>(&size)); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyboardSearch(const QString & search) { QByteArray t3559d7 = search.toUtf8(); QtWidgets_PackedString searchPacked = { const_cast<char*>(t3559d7.prepend("WHITESPACE").constData()+10), t3559d7.size()-10 };callbackQAbstractItemView_KeyboardSearch(this, searchPacked); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void Signal_Pressed(const QModelIndex & index) { callbackQAbstractItemView_Pressed(this, const_cast<QModelIndex*>(&index)); };
+	void reset() { callbackQAbstractItemView_Reset(this); };
+	void scrollToBottom() { callbackQAbstractItemView_ScrollToBottom(this); };
+	void scrollToTop() { callbackQAbstractItemView_ScrollToTop(this); };
+	void selectAll() { callbackQAbstractItemView_SelectAll(this); };
+	void setCurrentIndex(const QModelIndex & index) { callbackQAbstractItemView_SetCurrentIndex(this, const_cast<QModelIndex*>(&index)); };
+	void setModel(QAbstractItemModel * model) { callbackQAbstractItemView_SetModel(this, model); };
+	void setRootIndex(const QModelIndex & index) { callbackQAbstractItemView_SetRootIndex(this, const_cast<QModelIndex*>(&index)); };
+	void update(const QModelIndex & index) { callbackQAbstractItemView_Update(this, const_cast<QModelIndex*>(&index)); };
+	void Signal_ViewportEntered() { callbackQAbstractItemView_ViewportEntered(this); };
+	QItemSelectionModel::SelectionFlags selectionCommand(const QModelIndex & index, const QEvent * event) const { return static_cast<QItemSelectionModel::SelectionFlag>(callbackQAbstractItemView_SelectionCommand(const_cast<void*>(static_cast<const void*>(this)), const_cast<QModelIndex*>(&index), const_cast<QEvent*>(event))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	int sizeHintForColumn(int column) const { return callbackQAbstractItemView_SizeHintForColumn(const_cast<void*>(static_cast<const void*>(this)), column); };
+	int sizeHintForRow(int row) const { return callbackQAbstractItemView_SizeHintForRow(const_cast<void*>(static_cast<const void*>(this)), row); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void scrollContentsBy(int dx, int dy) { callbackQAbstractScrollArea_ScrollContentsBy(this, dx, dy); };
+	void setupViewport(QWidget * viewport) { callbackQAbstractScrollArea_SetupViewport(this, viewport); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QListWidget_NewQListWidget(void* parent)
+{
+	return new MyQListWidget(static_cast<QWidget*>(parent));
+}
+
+void* QListWidget_TakeItem(void* ptr, int row)
+{
+	return static_cast<QListWidget*>(ptr)->takeItem(row);
+}
+
+char QListWidget_DropMimeData(void* ptr, int index, void* data, long long action)
+{
+	return static_cast<QListWidget*>(ptr)->dropMimeData(index, static_cast<QMimeData*>(data), static_cast<Qt::DropAction>(action));
+}
+
+char QListWidget_DropMimeDataDefault(void* ptr, int index, void* data, long long action)
+{
+		return static_cast<QListWidget*>(ptr)->QListWidget::dropMimeData(index, static_cast<QMimeData*>(data), static_cast<Qt::DropAction>(action));
+}
+
+void QListWidget_AddItem2(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->addItem(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_AddItem(void* ptr, char* label)
+{
+	static_cast<QListWidget*>(ptr)->addItem(QString(label));
+}
+
+void QListWidget_AddItems(void* ptr, char* labels)
+{
+	static_cast<QListWidget*>(ptr)->addItems(goUnpackStringList(labels));
+}
+
+void QListWidget_Clear(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QListWidget*>(ptr), "clear");
+}
+
+void QListWidget_ClearDefault(void* ptr)
+{
+		static_cast<QListWidget*>(ptr)->QListWidget::clear();
+}
+
+void QListWidget_ClosePersistentEditor(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->closePersistentEditor(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_ConnectCurrentItemChanged(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *, QListWidgetItem *)>(&QListWidget::currentItemChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *, QListWidgetItem *)>(&MyQListWidget::Signal_CurrentItemChanged));
+}
+
+void QListWidget_DisconnectCurrentItemChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *, QListWidgetItem *)>(&QListWidget::currentItemChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *, QListWidgetItem *)>(&MyQListWidget::Signal_CurrentItemChanged));
+}
+
+void QListWidget_CurrentItemChanged(void* ptr, void* current, void* previous)
+{
+	static_cast<QListWidget*>(ptr)->currentItemChanged(static_cast<QListWidgetItem*>(current), static_cast<QListWidgetItem*>(previous));
+}
+
+void QListWidget_ConnectCurrentRowChanged(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(int)>(&QListWidget::currentRowChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(int)>(&MyQListWidget::Signal_CurrentRowChanged));
+}
+
+void QListWidget_DisconnectCurrentRowChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(int)>(&QListWidget::currentRowChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(int)>(&MyQListWidget::Signal_CurrentRowChanged));
+}
+
+void QListWidget_CurrentRowChanged(void* ptr, int currentRow)
+{
+	static_cast<QListWidget*>(ptr)->currentRowChanged(currentRow);
+}
+
+void QListWidget_ConnectCurrentTextChanged(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(const QString &)>(&QListWidget::currentTextChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(const QString &)>(&MyQListWidget::Signal_CurrentTextChanged));
+}
+
+void QListWidget_DisconnectCurrentTextChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(const QString &)>(&QListWidget::currentTextChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(const QString &)>(&MyQListWidget::Signal_CurrentTextChanged));
+}
+
+void QListWidget_CurrentTextChanged(void* ptr, char* currentText)
+{
+	static_cast<QListWidget*>(ptr)->currentTextChanged(QString(currentText));
+}
+
+void QListWidget_EditItem(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->editItem(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_InsertItem(void* ptr, int row, void* item)
+{
+	static_cast<QListWidget*>(ptr)->insertItem(row, static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_InsertItem2(void* ptr, int row, char* label)
+{
+	static_cast<QListWidget*>(ptr)->insertItem(row, QString(label));
+}
+
+void QListWidget_InsertItems(void* ptr, int row, char* labels)
+{
+	static_cast<QListWidget*>(ptr)->insertItems(row, goUnpackStringList(labels));
+}
+
+void QListWidget_ConnectItemActivated(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemActivated), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemActivated));
+}
+
+void QListWidget_DisconnectItemActivated(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemActivated), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemActivated));
+}
+
+void QListWidget_ItemActivated(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->itemActivated(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_ConnectItemChanged(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemChanged));
+}
+
+void QListWidget_DisconnectItemChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemChanged));
+}
+
+void QListWidget_ItemChanged(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->itemChanged(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_ConnectItemClicked(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemClicked), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemClicked));
+}
+
+void QListWidget_DisconnectItemClicked(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemClicked), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemClicked));
+}
+
+void QListWidget_ItemClicked(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->itemClicked(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_ConnectItemDoubleClicked(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemDoubleClicked), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemDoubleClicked));
+}
+
+void QListWidget_DisconnectItemDoubleClicked(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemDoubleClicked), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemDoubleClicked));
+}
+
+void QListWidget_ItemDoubleClicked(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->itemDoubleClicked(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_ConnectItemEntered(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemEntered), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemEntered));
+}
+
+void QListWidget_DisconnectItemEntered(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemEntered), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemEntered));
+}
+
+void QListWidget_ItemEntered(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->itemEntered(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_ConnectItemPressed(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemPressed), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemPressed));
+}
+
+void QListWidget_DisconnectItemPressed(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)(QListWidgetItem *)>(&QListWidget::itemPressed), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)(QListWidgetItem *)>(&MyQListWidget::Signal_ItemPressed));
+}
+
+void QListWidget_ItemPressed(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->itemPressed(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_ConnectItemSelectionChanged(void* ptr)
+{
+	QObject::connect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)()>(&QListWidget::itemSelectionChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)()>(&MyQListWidget::Signal_ItemSelectionChanged));
+}
+
+void QListWidget_DisconnectItemSelectionChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QListWidget*>(ptr), static_cast<void (QListWidget::*)()>(&QListWidget::itemSelectionChanged), static_cast<MyQListWidget*>(ptr), static_cast<void (MyQListWidget::*)()>(&MyQListWidget::Signal_ItemSelectionChanged));
+}
+
+void QListWidget_ItemSelectionChanged(void* ptr)
+{
+	static_cast<QListWidget*>(ptr)->itemSelectionChanged();
+}
+
+void QListWidget_OpenPersistentEditor(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->openPersistentEditor(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_RemoveItemWidget(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->removeItemWidget(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_ScrollToItem(void* ptr, void* item, long long hint)
+{
+	QMetaObject::invokeMethod(static_cast<QListWidget*>(ptr), "scrollToItem", Q_ARG(QListWidgetItem*, static_cast<QListWidgetItem*>(item)), Q_ARG(QAbstractItemView::ScrollHint, static_cast<QAbstractItemView::ScrollHint>(hint)));
+}
+
+void QListWidget_ScrollToItemDefault(void* ptr, void* item, long long hint)
+{
+		static_cast<QListWidget*>(ptr)->QListWidget::scrollToItem(static_cast<QListWidgetItem*>(item), static_cast<QAbstractItemView::ScrollHint>(hint));
+}
+
+void QListWidget_SetCurrentItem(void* ptr, void* item)
+{
+	static_cast<QListWidget*>(ptr)->setCurrentItem(static_cast<QListWidgetItem*>(item));
+}
+
+void QListWidget_SetCurrentItem2(void* ptr, void* item, long long command)
+{
+	static_cast<QListWidget*>(ptr)->setCurrentItem(static_cast<QListWidgetItem*>(item), static_cast<QItemSelectionModel::SelectionFlag>(command));
+}
+
+void QListWidget_SetCurrentRow(void* ptr, int row)
+{
+	static_cast<QListWidget*>(ptr)->setCurrentRow(row);
+}
+
+void QListWidget_SetCurrentRow2(void* ptr, int row, long long command)
+{
+	static_cast<QListWidget*>(ptr)->setCurrentRow(row, static_cast<QItemSelectionModel::SelectionFlag>(command));
+}
+
+void QListWidget_SetItemWidget(void* ptr, void* item, void* widget)
+{
+		static_cast<QListWidget*>(ptr)->setItemWidget(static_cast<QListWidgetItem*>(item), static_cast<QWidget*>(widget));
+}
+
+void QListWidget_SetSortingEnabled(void* ptr, char enable)
+{
+	static_cast<QListWidget*>(ptr)->setSortingEnabled(enable != 0);
+}
+
+void QListWidget_SortItems(void* ptr, long long order)
+{
+	static_cast<QListWidget*>(ptr)->sortItems(static_cast<Qt::SortOrder>(order));
+}
+
+void QListWidget_DestroyQListWidget(void* ptr)
+{
+	static_cast<QListWidget*>(ptr)->~QListWidget();
+}
+
+struct QtWidgets_PackedList QListWidget_FindItems(void* ptr, char* text, long long flags)
+{
+	return ({ QList<QListWidgetItem *>* tmpValue = new QList<QListWidgetItem *>(static_cast<QListWidget*>(ptr)->findItems(QString(text), static_cast<Qt::MatchFlag>(flags))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QListWidget_Items(void* ptr, void* data)
+{
+	return ({ QList<QListWidgetItem *>* tmpValue = new QList<QListWidgetItem *>(static_cast<QListWidget*>(ptr)->items(static_cast<QMimeData*>(data))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QListWidget_SelectedItems(void* ptr)
+{
+	return ({ QList<QListWidgetItem *>* tmpValue = new QList<QListWidgetItem *>(static_cast<QListWidget*>(ptr)->selectedItems()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QListWidget_CurrentItem(void* ptr)
+{
+	return static_cast<QListWidget*>(ptr)->currentItem();
+}
+
+void* QListWidget_Item(void* ptr, int row)
+{
+	return static_cast<QListWidget*>(ptr)->item(row);
+}
+
+void* QListWidget_ItemAt(void* ptr, void* p)
+{
+	return static_cast<QListWidget*>(ptr)->itemAt(*static_cast<QPoint*>(p));
+}
+
+void* QListWidget_ItemAt2(void* ptr, int x, int y)
+{
+	return static_cast<QListWidget*>(ptr)->itemAt(x, y);
+}
+
+void* QListWidget_ItemFromIndex(void* ptr, void* index)
+{
+	return static_cast<QListWidget*>(ptr)->itemFromIndex(*static_cast<QModelIndex*>(index));
+}
+
+void* QListWidget_MimeData(void* ptr, void* items)
+{
+	return static_cast<QListWidget*>(ptr)->mimeData(*static_cast<QList<QListWidgetItem *>*>(items));
+}
+
+void* QListWidget_MimeDataDefault(void* ptr, void* items)
+{
+		return static_cast<QListWidget*>(ptr)->QListWidget::mimeData(*static_cast<QList<QListWidgetItem *>*>(items));
+}
+
+void* QListWidget_IndexFromItem(void* ptr, void* item)
+{
+	return new QModelIndex(static_cast<QListWidget*>(ptr)->indexFromItem(static_cast<QListWidgetItem*>(item)));
+}
+
+void* QListWidget_VisualItemRect(void* ptr, void* item)
+{
+	return ({ QRect tmpValue = static_cast<QListWidget*>(ptr)->visualItemRect(static_cast<QListWidgetItem*>(item)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtWidgets_PackedString QListWidget_MimeTypes(void* ptr)
+{
+	return ({ long long t46fd45len; char* t46fd45 = goPackStringList(static_cast<QListWidget*>(ptr)->mimeTypes(), &t46fd45len); QtWidgets_PackedString { t46fd45, t46fd45len }; });
+}
+
+struct QtWidgets_PackedString QListWidget_MimeTypesDefault(void* ptr)
+{
+		return ({ long long tc474fdlen; char* tc474fd = goPackStringList(static_cast<QListWidget*>(ptr)->QListWidget::mimeTypes(), &tc474fdlen); QtWidgets_PackedString { tc474fd, tc474fdlen }; });
+}
+
+void* QListWidget_ItemWidget(void* ptr, void* item)
+{
+	return static_cast<QListWidget*>(ptr)->itemWidget(static_cast<QListWidgetItem*>(item));
+}
+
+long long QListWidget_SupportedDropActions(void* ptr)
+{
+	return static_cast<QListWidget*>(ptr)->supportedDropActions();
+}
+
+long long QListWidget_SupportedDropActionsDefault(void* ptr)
+{
+		return static_cast<QListWidget*>(ptr)->QListWidget::supportedDropActions();
+}
+
+char QListWidget_IsSortingEnabled(void* ptr)
+{
+	return static_cast<QListWidget*>(ptr)->isSortingEnabled();
+}
+
+int QListWidget_Count(void* ptr)
+{
+	return static_cast<QListWidget*>(ptr)->count();
+}
+
+int QListWidget_CurrentRow(void* ptr)
+{
+	return static_cast<QListWidget*>(ptr)->currentRow();
+}
+
+int QListWidget_Row(void* ptr, void* item)
+{
+	return static_cast<QListWidget*>(ptr)->row(static_cast<QListWidgetItem*>(item));
+}
+
+void* QListWidget___findItems_atList(void* ptr, int i)
+{
+	return const_cast<QListWidgetItem*>(static_cast<QList<QListWidgetItem *>*>(ptr)->at(i));
+}
+
+void QListWidget___findItems_setList(void* ptr, void* i)
+{
+	static_cast<QList<QListWidgetItem *>*>(ptr)->append(static_cast<QListWidgetItem*>(i));
+}
+
+void* QListWidget___findItems_newList(void* ptr)
+{
+	return new QList<QListWidgetItem *>;
+}
+
+void* QListWidget___items_atList(void* ptr, int i)
+{
+	return const_cast<QListWidgetItem*>(static_cast<QList<QListWidgetItem *>*>(ptr)->at(i));
+}
+
+void QListWidget___items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QListWidgetItem *>*>(ptr)->append(static_cast<QListWidgetItem*>(i));
+}
+
+void* QListWidget___items_newList(void* ptr)
+{
+	return new QList<QListWidgetItem *>;
+}
+
+void* QListWidget___selectedItems_atList(void* ptr, int i)
+{
+	return const_cast<QListWidgetItem*>(static_cast<QList<QListWidgetItem *>*>(ptr)->at(i));
+}
+
+void QListWidget___selectedItems_setList(void* ptr, void* i)
+{
+	static_cast<QList<QListWidgetItem *>*>(ptr)->append(static_cast<QListWidgetItem*>(i));
+}
+
+void* QListWidget___selectedItems_newList(void* ptr)
+{
+	return new QList<QListWidgetItem *>;
+}
+
+void* QListWidget___mimeData_items_atList(void* ptr, int i)
+{
+	return const_cast<QListWidgetItem*>(static_cast<QList<QListWidgetItem *>*>(ptr)->at(i));
+}
+
+void QListWidget___mimeData_items_setList(void* ptr, void* i)
+{
+	static_cast<QList<QListWidgetItem *>*>(ptr)->append(static_cast<QListWidgetItem*>(i));
+}
+
+void* QListWidget___mimeData_items_newList(void* ptr)
+{
+	return new QList<QListWidgetItem *>;
+}
+
+class MyQListWidgetItem: public QListWidgetItem
+{
+public:
+	MyQListWidgetItem(QListWidget *parent, int type) : QListWidgetItem(parent, type) {};
+	MyQListWidgetItem(const QIcon &icon, const QString &text, QListWidget *parent, int type) : QListWidgetItem(icon, text, parent, type) {};
+	MyQListWidgetItem(const QString &text, QListWidget *parent, int type) : QListWidgetItem(text, parent, type) {};
+	MyQListWidgetItem(const QListWidgetItem &other) : QListWidgetItem(other) {};
+	void read(QDataStream & in) { callbackQListWidgetItem_Read(this, static_cast<QDataStream*>(&in)); };
+	void setData(int role, const QVariant & value) { callbackQListWidgetItem_SetData(this, role, const_cast<QVariant*>(&value)); };
+	 ~MyQListWidgetItem() { callbackQListWidgetItem_DestroyQListWidgetItem(this); };
+	QListWidgetItem * clone() const { return static_cast<QListWidgetItem*>(callbackQListWidgetItem_Clone(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant data(int role) const { return *static_cast<QVariant*>(callbackQListWidgetItem_Data(const_cast<void*>(static_cast<const void*>(this)), role)); };
+	void write(QDataStream & out) const { callbackQListWidgetItem_Write(const_cast<void*>(static_cast<const void*>(this)), static_cast<QDataStream*>(&out)); };
+};
+
+void* QListWidgetItem_NewQListWidgetItem(void* parent, int ty)
+{
+	return new MyQListWidgetItem(static_cast<QListWidget*>(parent), ty);
+}
+
+void* QListWidgetItem_NewQListWidgetItem3(void* icon, char* text, void* parent, int ty)
+{
+	return new MyQListWidgetItem(*static_cast<QIcon*>(icon), QString(text), static_cast<QListWidget*>(parent), ty);
+}
+
+void* QListWidgetItem_NewQListWidgetItem2(char* text, void* parent, int ty)
+{
+	return new MyQListWidgetItem(QString(text), static_cast<QListWidget*>(parent), ty);
+}
+
+void QListWidgetItem_SetFlags(void* ptr, long long flags)
+{
+	static_cast<QListWidgetItem*>(ptr)->setFlags(static_cast<Qt::ItemFlag>(flags));
+}
+
+void* QListWidgetItem_NewQListWidgetItem4(void* other)
+{
+	return new MyQListWidgetItem(*static_cast<QListWidgetItem*>(other));
+}
+
+void QListWidgetItem_Read(void* ptr, void* in)
+{
+	static_cast<QListWidgetItem*>(ptr)->read(*static_cast<QDataStream*>(in));
+}
+
+void QListWidgetItem_ReadDefault(void* ptr, void* in)
+{
+		static_cast<QListWidgetItem*>(ptr)->QListWidgetItem::read(*static_cast<QDataStream*>(in));
+}
+
+void QListWidgetItem_SetBackground(void* ptr, void* brush)
+{
+	static_cast<QListWidgetItem*>(ptr)->setBackground(*static_cast<QBrush*>(brush));
+}
+
+void QListWidgetItem_SetCheckState(void* ptr, long long state)
+{
+	static_cast<QListWidgetItem*>(ptr)->setCheckState(static_cast<Qt::CheckState>(state));
+}
+
+void QListWidgetItem_SetData(void* ptr, int role, void* value)
+{
+	static_cast<QListWidgetItem*>(ptr)->setData(role, *static_cast<QVariant*>(value));
+}
+
+void QListWidgetItem_SetDataDefault(void* ptr, int role, void* value)
+{
+		static_cast<QListWidgetItem*>(ptr)->QListWidgetItem::setData(role, *static_cast<QVariant*>(value));
+}
+
+void QListWidgetItem_SetFont(void* ptr, void* font)
+{
+	static_cast<QListWidgetItem*>(ptr)->setFont(*static_cast<QFont*>(font));
+}
+
+void QListWidgetItem_SetForeground(void* ptr, void* brush)
+{
+	static_cast<QListWidgetItem*>(ptr)->setForeground(*static_cast<QBrush*>(brush));
+}
+
+void QListWidgetItem_SetHidden(void* ptr, char hide)
+{
+	static_cast<QListWidgetItem*>(ptr)->setHidden(hide != 0);
+}
+
+void QListWidgetItem_SetIcon(void* ptr, void* icon)
+{
+	static_cast<QListWidgetItem*>(ptr)->setIcon(*static_cast<QIcon*>(icon));
+}
+
+void QListWidgetItem_SetSelected(void* ptr, char sele)
+{
+	static_cast<QListWidgetItem*>(ptr)->setSelected(sele != 0);
+}
+
+void QListWidgetItem_SetSizeHint(void* ptr, void* size)
+{
+	static_cast<QListWidgetItem*>(ptr)->setSizeHint(*static_cast<QSize*>(size));
+}
+
+void QListWidgetItem_SetStatusTip(void* ptr, char* statusTip)
+{
+	static_cast<QListWidgetItem*>(ptr)->setStatusTip(QString(statusTip));
+}
+
+void QListWidgetItem_SetText(void* ptr, char* text)
+{
+	static_cast<QListWidgetItem*>(ptr)->setText(QString(text));
+}
+
+void QListWidgetItem_SetTextAlignment(void* ptr, int alignment)
+{
+	static_cast<QListWidgetItem*>(ptr)->setTextAlignment(alignment);
+}
+
+void QListWidgetItem_SetToolTip(void* ptr, char* toolTip)
+{
+	static_cast<QListWidgetItem*>(ptr)->setToolTip(QString(toolTip));
+}
+
+void QListWidgetItem_SetWhatsThis(void* ptr, char* whatsThis)
+{
+	static_cast<QListWidgetItem*>(ptr)->setWhatsThis(QString(whatsThis));
+}
+
+void QListWidgetItem_DestroyQListWidgetItem(void* ptr)
+{
+	static_cast<QListWidgetItem*>(ptr)->~QListWidgetItem();
+}
+
+void QListWidgetItem_DestroyQListWidgetItemDefault(void* ptr)
+{
+
+}
+
+void* QListWidgetItem_Background(void* ptr)
+{
+	return new QBrush(static_cast<QListWidgetItem*>(ptr)->background());
+}
+
+void* QListWidgetItem_Foreground(void* ptr)
+{
+	return new QBrush(static_cast<QListWidgetItem*>(ptr)->foreground());
+}
+
+void* QListWidgetItem_Font(void* ptr)
+{
+	return new QFont(static_cast<QListWidgetItem*>(ptr)->font());
+}
+
+void* QListWidgetItem_Icon(void* ptr)
+{
+	return new QIcon(static_cast<QListWidgetItem*>(ptr)->icon());
+}
+
+void* QListWidgetItem_ListWidget(void* ptr)
+{
+	return static_cast<QListWidgetItem*>(ptr)->listWidget();
+}
+
+void* QListWidgetItem_Clone(void* ptr)
+{
+	return static_cast<QListWidgetItem*>(ptr)->clone();
+}
+
+void* QListWidgetItem_CloneDefault(void* ptr)
+{
+		return static_cast<QListWidgetItem*>(ptr)->QListWidgetItem::clone();
+}
+
+void* QListWidgetItem_SizeHint(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QListWidgetItem*>(ptr)->sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtWidgets_PackedString QListWidgetItem_StatusTip(void* ptr)
+{
+	return ({ QByteArray t97b7ce = static_cast<QListWidgetItem*>(ptr)->statusTip().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t97b7ce.prepend("WHITESPACE").constData()+10), t97b7ce.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QListWidgetItem_Text(void* ptr)
+{
+	return ({ QByteArray t3d0f8a = static_cast<QListWidgetItem*>(ptr)->text().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t3d0f8a.prepend("WHITESPACE").constData()+10), t3d0f8a.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QListWidgetItem_ToolTip(void* ptr)
+{
+	return ({ QByteArray tc8991e = static_cast<QListWidgetItem*>(ptr)->toolTip().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tc8991e.prepend("WHITESPACE").constData()+10), tc8991e.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QListWidgetItem_WhatsThis(void* ptr)
+{
+	return ({ QByteArray tf613a8 = static_cast<QListWidgetItem*>(ptr)->whatsThis().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tf613a8.prepend("WHITESPACE").constData()+10), tf613a8.size()-10 }; });
+}
+
+void* QListWidgetItem_Data(void* ptr, int role)
+{
+	return new QVariant(static_cast<QListWidgetItem*>(ptr)->data(role));
+}
+
+void* QListWidgetItem_DataDefault(void* ptr, int role)
+{
+		return new QVariant(static_cast<QListWidgetItem*>(ptr)->QListWidgetItem::data(role));
+}
+
+long long QListWidgetItem_CheckState(void* ptr)
+{
+	return static_cast<QListWidgetItem*>(ptr)->checkState();
+}
+
+long long QListWidgetItem_Flags(void* ptr)
+{
+	return static_cast<QListWidgetItem*>(ptr)->flags();
+}
+
+char QListWidgetItem_IsHidden(void* ptr)
+{
+	return static_cast<QListWidgetItem*>(ptr)->isHidden();
+}
+
+char QListWidgetItem_IsSelected(void* ptr)
+{
+	return static_cast<QListWidgetItem*>(ptr)->isSelected();
+}
+
+int QListWidgetItem_TextAlignment(void* ptr)
+{
+	return static_cast<QListWidgetItem*>(ptr)->textAlignment();
+}
+
+int QListWidgetItem_Type(void* ptr)
+{
+	return static_cast<QListWidgetItem*>(ptr)->type();
+}
+
+void QListWidgetItem_Write(void* ptr, void* out)
+{
+	static_cast<QListWidgetItem*>(ptr)->write(*static_cast<QDataStream*>(out));
+}
+
+void QListWidgetItem_WriteDefault(void* ptr, void* out)
+{
+		static_cast<QListWidgetItem*>(ptr)->QListWidgetItem::write(*static_cast<QDataStream*>(out));
+}
+
+class MyQMacCocoaViewContainer: public QMacCocoaViewContainer
+{
+public:
+	 ~MyQMacCocoaViewContainer() { callbackQMacCocoaViewContainer_DestroyQMacCocoaViewContainer(this); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QMacCocoaViewContainer_DestroyQMacCocoaViewContainer(void* ptr)
+{
+	static_cast<QMacCocoaViewContainer*>(ptr)->~QMacCocoaViewContainer();
+}
+
+void QMacCocoaViewContainer_DestroyQMacCocoaViewContainerDefault(void* ptr)
+{
+#ifdef Q_OS_OSX
+
+#endif
+}
+
+class MyQMacNativeWidget: public QMacNativeWidget
+{
+public:
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QMacNativeWidget_DestroyQMacNativeWidget(void* ptr)
+{
+	static_cast<QMacNativeWidget*>(ptr)->~QMacNativeWidget();
+}
+
+class MyQMainWindow: public QMainWindow
+{
+public:
+	MyQMainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(parent, flags) {};
+	QMenu * createPopupMenu() { return static_cast<QMenu*>(callbackQMainWindow_CreatePopupMenu(this)); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_IconSizeChanged(const QSize & iconSize) { callbackQMainWindow_IconSizeChanged(this, const_cast<QSize*>(&iconSize)); };
+	void setAnimated(bool enabled) { callbackQMainWindow_SetAnimated(this, enabled); };
+	void setDockNestingEnabled(bool enabled) { callbackQMainWindow_SetDockNestingEnabled(this, enabled); };
+	void setUnifiedTitleAndToolBarOnMac(bool set) { callbackQMainWindow_SetUnifiedTitleAndToolBarOnMac(this, set); };
+	void Signal_TabifiedDockWidgetActivated(QDockWidget * dockWidget) { callbackQMainWindow_TabifiedDockWidgetActivated(this, dockWidget); };
+	void Signal_ToolButtonStyleChanged(Qt::ToolButtonStyle toolButtonStyle) { callbackQMainWindow_ToolButtonStyleChanged(this, toolButtonStyle); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QMainWindow_NewQMainWindow(void* parent, long long flags)
+{
+	return new MyQMainWindow(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(flags));
+}
+
+void* QMainWindow_CreatePopupMenu(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->createPopupMenu();
+}
+
+void* QMainWindow_CreatePopupMenuDefault(void* ptr)
+{
+		return static_cast<QMainWindow*>(ptr)->QMainWindow::createPopupMenu();
+}
+
+void* QMainWindow_AddToolBar3(void* ptr, char* title)
+{
+	return static_cast<QMainWindow*>(ptr)->addToolBar(QString(title));
+}
+
+void* QMainWindow_TakeCentralWidget(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->takeCentralWidget();
+}
+
+char QMainWindow_RestoreDockWidget(void* ptr, void* dockwidget)
+{
+	return static_cast<QMainWindow*>(ptr)->restoreDockWidget(static_cast<QDockWidget*>(dockwidget));
+}
+
+char QMainWindow_RestoreState(void* ptr, void* state, int version)
+{
+	return static_cast<QMainWindow*>(ptr)->restoreState(*static_cast<QByteArray*>(state), version);
+}
+
+void QMainWindow_AddDockWidget(void* ptr, long long area, void* dockwidget)
+{
+	static_cast<QMainWindow*>(ptr)->addDockWidget(static_cast<Qt::DockWidgetArea>(area), static_cast<QDockWidget*>(dockwidget));
+}
+
+void QMainWindow_AddDockWidget2(void* ptr, long long area, void* dockwidget, long long orientation)
+{
+	static_cast<QMainWindow*>(ptr)->addDockWidget(static_cast<Qt::DockWidgetArea>(area), static_cast<QDockWidget*>(dockwidget), static_cast<Qt::Orientation>(orientation));
+}
+
+void QMainWindow_AddToolBar2(void* ptr, void* toolbar)
+{
+	static_cast<QMainWindow*>(ptr)->addToolBar(static_cast<QToolBar*>(toolbar));
+}
+
+void QMainWindow_AddToolBar(void* ptr, long long area, void* toolbar)
+{
+	static_cast<QMainWindow*>(ptr)->addToolBar(static_cast<Qt::ToolBarArea>(area), static_cast<QToolBar*>(toolbar));
+}
+
+void QMainWindow_AddToolBarBreak(void* ptr, long long area)
+{
+	static_cast<QMainWindow*>(ptr)->addToolBarBreak(static_cast<Qt::ToolBarArea>(area));
+}
+
+void QMainWindow_ConnectIconSizeChanged(void* ptr)
+{
+	QObject::connect(static_cast<QMainWindow*>(ptr), static_cast<void (QMainWindow::*)(const QSize &)>(&QMainWindow::iconSizeChanged), static_cast<MyQMainWindow*>(ptr), static_cast<void (MyQMainWindow::*)(const QSize &)>(&MyQMainWindow::Signal_IconSizeChanged));
+}
+
+void QMainWindow_DisconnectIconSizeChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QMainWindow*>(ptr), static_cast<void (QMainWindow::*)(const QSize &)>(&QMainWindow::iconSizeChanged), static_cast<MyQMainWindow*>(ptr), static_cast<void (MyQMainWindow::*)(const QSize &)>(&MyQMainWindow::Signal_IconSizeChanged));
+}
+
+void QMainWindow_IconSizeChanged(void* ptr, void* iconSize)
+{
+	static_cast<QMainWindow*>(ptr)->iconSizeChanged(*static_cast<QSize*>(iconSize));
+}
+
+void QMainWindow_InsertToolBar(void* ptr, void* before, void* toolbar)
+{
+	static_cast<QMainWindow*>(ptr)->insertToolBar(static_cast<QToolBar*>(before), static_cast<QToolBar*>(toolbar));
+}
+
+void QMainWindow_InsertToolBarBreak(void* ptr, void* before)
+{
+	static_cast<QMainWindow*>(ptr)->insertToolBarBreak(static_cast<QToolBar*>(before));
+}
+
+void QMainWindow_RemoveDockWidget(void* ptr, void* dockwidget)
+{
+	static_cast<QMainWindow*>(ptr)->removeDockWidget(static_cast<QDockWidget*>(dockwidget));
+}
+
+void QMainWindow_RemoveToolBar(void* ptr, void* toolbar)
+{
+	static_cast<QMainWindow*>(ptr)->removeToolBar(static_cast<QToolBar*>(toolbar));
+}
+
+void QMainWindow_RemoveToolBarBreak(void* ptr, void* before)
+{
+	static_cast<QMainWindow*>(ptr)->removeToolBarBreak(static_cast<QToolBar*>(before));
+}
+
+void QMainWindow_ResizeDocks(void* ptr, void* docks, void* sizes, long long orientation)
+{
+	static_cast<QMainWindow*>(ptr)->resizeDocks(*static_cast<QList<QDockWidget *>*>(docks), *static_cast<QList<int>*>(sizes), static_cast<Qt::Orientation>(orientation));
+}
+
+void QMainWindow_SetAnimated(void* ptr, char enabled)
+{
+	QMetaObject::invokeMethod(static_cast<QMainWindow*>(ptr), "setAnimated", Q_ARG(bool, enabled != 0));
+}
+
+void QMainWindow_SetAnimatedDefault(void* ptr, char enabled)
+{
+		static_cast<QMainWindow*>(ptr)->QMainWindow::setAnimated(enabled != 0);
+}
+
+void QMainWindow_SetCentralWidget(void* ptr, void* widget)
+{
+		static_cast<QMainWindow*>(ptr)->setCentralWidget(static_cast<QWidget*>(widget));
+}
+
+void QMainWindow_SetCorner(void* ptr, long long corner, long long area)
+{
+	static_cast<QMainWindow*>(ptr)->setCorner(static_cast<Qt::Corner>(corner), static_cast<Qt::DockWidgetArea>(area));
+}
+
+void QMainWindow_SetDockNestingEnabled(void* ptr, char enabled)
+{
+	QMetaObject::invokeMethod(static_cast<QMainWindow*>(ptr), "setDockNestingEnabled", Q_ARG(bool, enabled != 0));
+}
+
+void QMainWindow_SetDockNestingEnabledDefault(void* ptr, char enabled)
+{
+		static_cast<QMainWindow*>(ptr)->QMainWindow::setDockNestingEnabled(enabled != 0);
+}
+
+void QMainWindow_SetDockOptions(void* ptr, long long options)
+{
+	static_cast<QMainWindow*>(ptr)->setDockOptions(static_cast<QMainWindow::DockOption>(options));
+}
+
+void QMainWindow_SetDocumentMode(void* ptr, char enabled)
+{
+	static_cast<QMainWindow*>(ptr)->setDocumentMode(enabled != 0);
+}
+
+void QMainWindow_SetIconSize(void* ptr, void* iconSize)
+{
+	static_cast<QMainWindow*>(ptr)->setIconSize(*static_cast<QSize*>(iconSize));
+}
+
+void QMainWindow_SetMenuBar(void* ptr, void* menuBar)
+{
+	static_cast<QMainWindow*>(ptr)->setMenuBar(static_cast<QMenuBar*>(menuBar));
+}
+
+void QMainWindow_SetMenuWidget(void* ptr, void* menuBar)
+{
+		static_cast<QMainWindow*>(ptr)->setMenuWidget(static_cast<QWidget*>(menuBar));
+}
+
+void QMainWindow_SetStatusBar(void* ptr, void* statusbar)
+{
+	static_cast<QMainWindow*>(ptr)->setStatusBar(static_cast<QStatusBar*>(statusbar));
+}
+
+void QMainWindow_SetTabPosition(void* ptr, long long areas, long long tabPosition)
+{
+	static_cast<QMainWindow*>(ptr)->setTabPosition(static_cast<Qt::DockWidgetArea>(areas), static_cast<QTabWidget::TabPosition>(tabPosition));
+}
+
+void QMainWindow_SetTabShape(void* ptr, long long tabShape)
+{
+	static_cast<QMainWindow*>(ptr)->setTabShape(static_cast<QTabWidget::TabShape>(tabShape));
+}
+
+void QMainWindow_SetToolButtonStyle(void* ptr, long long toolButtonStyle)
+{
+	static_cast<QMainWindow*>(ptr)->setToolButtonStyle(static_cast<Qt::ToolButtonStyle>(toolButtonStyle));
+}
+
+void QMainWindow_SetUnifiedTitleAndToolBarOnMac(void* ptr, char set)
+{
+	QMetaObject::invokeMethod(static_cast<QMainWindow*>(ptr), "setUnifiedTitleAndToolBarOnMac", Q_ARG(bool, set != 0));
+}
+
+void QMainWindow_SetUnifiedTitleAndToolBarOnMacDefault(void* ptr, char set)
+{
+		static_cast<QMainWindow*>(ptr)->QMainWindow::setUnifiedTitleAndToolBarOnMac(set != 0);
+}
+
+void QMainWindow_SplitDockWidget(void* ptr, void* first, void* second, long long orientation)
+{
+	static_cast<QMainWindow*>(ptr)->splitDockWidget(static_cast<QDockWidget*>(first), static_cast<QDockWidget*>(second), static_cast<Qt::Orientation>(orientation));
+}
+
+void QMainWindow_ConnectTabifiedDockWidgetActivated(void* ptr)
+{
+	QObject::connect(static_cast<QMainWindow*>(ptr), static_cast<void (QMainWindow::*)(QDockWidget *)>(&QMainWindow::tabifiedDockWidgetActivated), static_cast<MyQMainWindow*>(ptr), static_cast<void (MyQMainWindow::*)(QDockWidget *)>(&MyQMainWindow::Signal_TabifiedDockWidgetActivated));
+}
+
+void QMainWindow_DisconnectTabifiedDockWidgetActivated(void* ptr)
+{
+	QObject::disconnect(static_cast<QMainWindow*>(ptr), static_cast<void (QMainWindow::*)(QDockWidget *)>(&QMainWindow::tabifiedDockWidgetActivated), static_cast<MyQMainWindow*>(ptr), static_cast<void (MyQMainWindow::*)(QDockWidget *)>(&MyQMainWindow::Signal_TabifiedDockWidgetActivated));
+}
+
+void QMainWindow_TabifiedDockWidgetActivated(void* ptr, void* dockWidget)
+{
+	static_cast<QMainWindow*>(ptr)->tabifiedDockWidgetActivated(static_cast<QDockWidget*>(dockWidget));
+}
+
+void QMainWindow_TabifyDockWidget(void* ptr, void* first, void* second)
+{
+	static_cast<QMainWindow*>(ptr)->tabifyDockWidget(static_cast<QDockWidget*>(first), static_cast<QDockWidget*>(second));
+}
+
+void QMainWindow_ConnectToolButtonStyleChanged(void* ptr)
+{
+	QObject::connect(static_cast<QMainWindow*>(ptr), static_cast<void (QMainWindow::*)(Qt::ToolButtonStyle)>(&QMainWindow::toolButtonStyleChanged), static_cast<MyQMainWindow*>(ptr), static_cast<void (MyQMainWindow::*)(Qt::ToolButtonStyle)>(&MyQMainWindow::Signal_ToolButtonStyleChanged));
+}
+
+void QMainWindow_DisconnectToolButtonStyleChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QMainWindow*>(ptr), static_cast<void (QMainWindow::*)(Qt::ToolButtonStyle)>(&QMainWindow::toolButtonStyleChanged), static_cast<MyQMainWindow*>(ptr), static_cast<void (MyQMainWindow::*)(Qt::ToolButtonStyle)>(&MyQMainWindow::Signal_ToolButtonStyleChanged));
+}
+
+void QMainWindow_ToolButtonStyleChanged(void* ptr, long long toolButtonStyle)
+{
+	static_cast<QMainWindow*>(ptr)->toolButtonStyleChanged(static_cast<Qt::ToolButtonStyle>(toolButtonStyle));
+}
+
+void QMainWindow_DestroyQMainWindow(void* ptr)
+{
+	static_cast<QMainWindow*>(ptr)->~QMainWindow();
+}
+
+long long QMainWindow_DockOptions(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->dockOptions();
+}
+
+void* QMainWindow_SaveState(void* ptr, int version)
+{
+	return new QByteArray(static_cast<QMainWindow*>(ptr)->saveState(version));
+}
+
+struct QtWidgets_PackedList QMainWindow_TabifiedDockWidgets(void* ptr, void* dockwidget)
+{
+	return ({ QList<QDockWidget *>* tmpValue = new QList<QDockWidget *>(static_cast<QMainWindow*>(ptr)->tabifiedDockWidgets(static_cast<QDockWidget*>(dockwidget))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QMainWindow_MenuBar(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->menuBar();
+}
+
+void* QMainWindow_IconSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QMainWindow*>(ptr)->iconSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QMainWindow_StatusBar(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->statusBar();
+}
+
+long long QMainWindow_TabPosition(void* ptr, long long area)
+{
+	return static_cast<QMainWindow*>(ptr)->tabPosition(static_cast<Qt::DockWidgetArea>(area));
+}
+
+long long QMainWindow_TabShape(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->tabShape();
+}
+
+void* QMainWindow_CentralWidget(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->centralWidget();
+}
+
+void* QMainWindow_MenuWidget(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->menuWidget();
+}
+
+long long QMainWindow_Corner(void* ptr, long long corner)
+{
+	return static_cast<QMainWindow*>(ptr)->corner(static_cast<Qt::Corner>(corner));
+}
+
+long long QMainWindow_DockWidgetArea(void* ptr, void* dockwidget)
+{
+	return static_cast<QMainWindow*>(ptr)->dockWidgetArea(static_cast<QDockWidget*>(dockwidget));
+}
+
+long long QMainWindow_ToolBarArea(void* ptr, void* toolbar)
+{
+	return static_cast<QMainWindow*>(ptr)->toolBarArea(static_cast<QToolBar*>(toolbar));
+}
+
+long long QMainWindow_ToolButtonStyle(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->toolButtonStyle();
+}
+
+char QMainWindow_DocumentMode(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->documentMode();
+}
+
+char QMainWindow_IsAnimated(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->isAnimated();
+}
+
+char QMainWindow_IsDockNestingEnabled(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->isDockNestingEnabled();
+}
+
+char QMainWindow_ToolBarBreak(void* ptr, void* toolbar)
+{
+	return static_cast<QMainWindow*>(ptr)->toolBarBreak(static_cast<QToolBar*>(toolbar));
+}
+
+char QMainWindow_UnifiedTitleAndToolBarOnMac(void* ptr)
+{
+	return static_cast<QMainWindow*>(ptr)->unifiedTitleAndToolBarOnMac();
+}
+
+void* QMainWindow___resizeDocks_docks_atList(void* ptr, int i)
+{
+	return const_cast<QDockWidget*>(static_cast<QList<QDockWidget *>*>(ptr)->at(i));
+}
+
+void QMainWindow___resizeDocks_docks_setList(void* ptr, void* i)
+{
+	static_cast<QList<QDockWidget *>*>(ptr)->append(static_cast<QDockWidget*>(i));
+}
+
+void* QMainWindow___resizeDocks_docks_newList(void* ptr)
+{
+	return new QList<QDockWidget *>;
+}
+
+int QMainWindow___resizeDocks_sizes_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QMainWindow___resizeDocks_sizes_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QMainWindow___resizeDocks_sizes_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QMainWindow___resizeDocks_sizes_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QMainWindow___resizeDocks_sizes_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void* QMainWindow___tabifiedDockWidgets_atList(void* ptr, int i)
+{
+	return const_cast<QDockWidget*>(static_cast<QList<QDockWidget *>*>(ptr)->at(i));
+}
+
+void QMainWindow___tabifiedDockWidgets_setList(void* ptr, void* i)
+{
+	static_cast<QList<QDockWidget *>*>(ptr)->append(static_cast<QDockWidget*>(i));
+}
+
+void* QMainWindow___tabifiedDockWidgets_newList(void* ptr)
+{
+	return new QList<QDockWidget *>;
+}
+
+class MyQMdiArea: public QMdiArea
+{
+public:
+	MyQMdiArea(QWidget *parent) : QMdiArea(parent) {};
+	bool viewportEvent(QEvent * event) { return callbackQAbstractScrollArea_ViewportEvent(this, event) != 0; };
+	void activateNextSubWindow() { callbackQMdiArea_ActivateNextSubWindow(this); };
+	void activatePreviousSubWindow() { callbackQMdiArea_ActivatePreviousSubWindow(this); };
+	void cascadeSubWindows() { callbackQMdiArea_CascadeSubWindows(this); };
+	void closeActiveSubWindow() { callbackQMdiArea_CloseActiveSubWindow(this); };
+	void closeAllSubWindows() { callbackQMdiArea_CloseAllSubWindows(this); };
+	void paintEvent(QPaintEvent * paintEvent) { callbackQWidget_PaintEvent(this, paintEvent); };
+	void resizeEvent(QResizeEvent * resizeEvent) { callbackQWidget_ResizeEvent(this, resizeEvent); };
+	void scrollContentsBy(int dx, int dy) { callbackQAbstractScrollArea_ScrollContentsBy(this, dx, dy); };
+	void setActiveSubWindow(QMdiSubWindow * window) { callbackQMdiArea_SetActiveSubWindow(this, window); };
+	void setupViewport(QWidget * viewport) { callbackQMdiArea_SetupViewport(this, viewport); };
+	void showEvent(QShowEvent * showEvent) { callbackQWidget_ShowEvent(this, showEvent); };
+	void Signal_SubWindowActivated(QMdiSubWindow * window) { callbackQMdiArea_SubWindowActivated(this, window); };
+	void tileSubWindows() { callbackQMdiArea_TileSubWindows(this); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void mouseDoubleClickEvent(QMouseEvent * e) { callbackQWidget_MouseDoubleClickEvent(this, e); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void wheelEvent(QWheelEvent * e) { callbackQWidget_WheelEvent(this, e); };
+	QSize viewportSizeHint() const { return *static_cast<QSize*>(callbackQAbstractScrollArea_ViewportSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QMdiArea_NewQMdiArea(void* parent)
+{
+	return new MyQMdiArea(static_cast<QWidget*>(parent));
+}
+
+void* QMdiArea_AddSubWindow(void* ptr, void* widget, long long windowFlags)
+{
+		return static_cast<QMdiArea*>(ptr)->addSubWindow(static_cast<QWidget*>(widget), static_cast<Qt::WindowType>(windowFlags));
+}
+
+void QMdiArea_ActivateNextSubWindow(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QMdiArea*>(ptr), "activateNextSubWindow");
+}
+
+void QMdiArea_ActivateNextSubWindowDefault(void* ptr)
+{
+		static_cast<QMdiArea*>(ptr)->QMdiArea::activateNextSubWindow();
+}
+
+void QMdiArea_ActivatePreviousSubWindow(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QMdiArea*>(ptr), "activatePreviousSubWindow");
+}
+
+void QMdiArea_ActivatePreviousSubWindowDefault(void* ptr)
+{
+		static_cast<QMdiArea*>(ptr)->QMdiArea::activatePreviousSubWindow();
+}
+
+void QMdiArea_CascadeSubWindows(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QMdiArea*>(ptr), "cascadeSubWindows");
+}
+
+void QMdiArea_CascadeSubWindowsDefault(void* ptr)
+{
+		static_cast<QMdiArea*>(ptr)->QMdiArea::cascadeSubWindows();
+}
+
+void QMdiArea_CloseActiveSubWindow(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QMdiArea*>(ptr), "closeActiveSubWindow");
+}
+
+void QMdiArea_CloseActiveSubWindowDefault(void* ptr)
+{
+		static_cast<QMdiArea*>(ptr)->QMdiArea::closeActiveSubWindow();
+}
+
+void QMdiArea_CloseAllSubWindows(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QMdiArea*>(ptr), "closeAllSubWindows");
+}
+
+void QMdiArea_CloseAllSubWindowsDefault(void* ptr)
+{
+		static_cast<QMdiArea*>(ptr)->QMdiArea::closeAllSubWindows();
+}
+
+void QMdiArea_RemoveSubWindow(void* ptr, void* widget)
+{
+		static_cast<QMdiArea*>(ptr)->removeSubWindow(static_cast<QWidget*>(widget));
+}
+
+void QMdiArea_SetActivationOrder(void* ptr, long long order)
+{
+	static_cast<QMdiArea*>(ptr)->setActivationOrder(static_cast<QMdiArea::WindowOrder>(order));
+}
+
+void QMdiArea_SetActiveSubWindow(void* ptr, void* window)
+{
+	QMetaObject::invokeMethod(static_cast<QMdiArea*>(ptr), "setActiveSubWindow", Q_ARG(QMdiSubWindow*, static_cast<QMdiSubWindow*>(window)));
+}
+
+void QMdiArea_SetActiveSubWindowDefault(void* ptr, void* window)
+{
+		static_cast<QMdiArea*>(ptr)->QMdiArea::setActiveSubWindow(static_cast<QMdiSubWindow*>(window));
+}
+
+void QMdiArea_SetBackground(void* ptr, void* background)
+{
+	static_cast<QMdiArea*>(ptr)->setBackground(*static_cast<QBrush*>(background));
+}
+
+void QMdiArea_SetDocumentMode(void* ptr, char enabled)
+{
+	static_cast<QMdiArea*>(ptr)->setDocumentMode(enabled != 0);
+}
+
+void QMdiArea_SetOption(void* ptr, long long option, char on)
+{
+	static_cast<QMdiArea*>(ptr)->setOption(static_cast<QMdiArea::AreaOption>(option), on != 0);
+}
+
+void QMdiArea_SetTabPosition(void* ptr, long long position)
+{
+	static_cast<QMdiArea*>(ptr)->setTabPosition(static_cast<QTabWidget::TabPosition>(position));
+}
+
+void QMdiArea_SetTabShape(void* ptr, long long shape)
+{
+	static_cast<QMdiArea*>(ptr)->setTabShape(static_cast<QTabWidget::TabShape>(shape));
+}
+
+void QMdiArea_SetViewMode(void* ptr, long long mode)
+{
+	static_cast<QMdiArea*>(ptr)->setViewMode(static_cast<QMdiArea::ViewMode>(mode));
+}
+
+void QMdiArea_SetupViewport(void* ptr, void* viewport)
+{
+		QMetaObject::invokeMethod(static_cast<QMdiArea*>(ptr), "setupViewport", Q_ARG(QWidget*, static_cast<QWidget*>(viewport)));
+}
+
+void QMdiArea_SetupViewportDefault(void* ptr, void* viewport)
+{
+		static_cast<QMdiArea*>(ptr)->QMdiArea::setupViewport(static_cast<QWidget*>(viewport));
+}
+
+void QMdiArea_ConnectSubWindowActivated(void* ptr)
+{
+	QObject::connect(static_cast<QMdiArea*>(ptr), static_cast<void (QMdiArea::*)(QMdiSubWindow *)>(&QMdiArea::subWindowActivated), static_cast<MyQMdiArea*>(ptr), static_cast<void (MyQMdiArea::*)(QMdiSubWindow *)>(&MyQMdiArea::Signal_SubWindowActivated));
+}
+
+void QMdiArea_DisconnectSubWindowActivated(void* ptr)
+{
+	QObject::disconnect(static_cast<QMdiArea*>(ptr), static_cast<void (QMdiArea::*)(QMdiSubWindow *)>(&QMdiArea::subWindowActivated), static_cast<MyQMdiArea*>(ptr), static_cast<void (MyQMdiArea::*)(QMdiSubWindow *)>(&MyQMdiArea::Signal_SubWindowActivated));
+}
+
+void QMdiArea_SubWindowActivated(void* ptr, void* window)
+{
+	static_cast<QMdiArea*>(ptr)->subWindowActivated(static_cast<QMdiSubWindow*>(window));
+}
+
+void QMdiArea_TileSubWindows(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QMdiArea*>(ptr), "tileSubWindows");
+}
+
+void QMdiArea_TileSubWindowsDefault(void* ptr)
+{
+		static_cast<QMdiArea*>(ptr)->QMdiArea::tileSubWindows();
+}
+
+void QMdiArea_DestroyQMdiArea(void* ptr)
+{
+	static_cast<QMdiArea*>(ptr)->~QMdiArea();
+}
+
+void* QMdiArea_Background(void* ptr)
+{
+	return new QBrush(static_cast<QMdiArea*>(ptr)->background());
+}
+
+struct QtWidgets_PackedList QMdiArea_SubWindowList(void* ptr, long long order)
+{
+	return ({ QList<QMdiSubWindow *>* tmpValue = new QList<QMdiSubWindow *>(static_cast<QMdiArea*>(ptr)->subWindowList(static_cast<QMdiArea::WindowOrder>(order))); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QMdiArea_ActiveSubWindow(void* ptr)
+{
+	return static_cast<QMdiArea*>(ptr)->activeSubWindow();
+}
+
+void* QMdiArea_CurrentSubWindow(void* ptr)
+{
+	return static_cast<QMdiArea*>(ptr)->currentSubWindow();
+}
+
+long long QMdiArea_TabPosition(void* ptr)
+{
+	return static_cast<QMdiArea*>(ptr)->tabPosition();
+}
+
+long long QMdiArea_TabShape(void* ptr)
+{
+	return static_cast<QMdiArea*>(ptr)->tabShape();
+}
+
+long long QMdiArea_ViewMode(void* ptr)
+{
+	return static_cast<QMdiArea*>(ptr)->viewMode();
+}
+
+long long QMdiArea_ActivationOrder(void* ptr)
+{
+	return static_cast<QMdiArea*>(ptr)->activationOrder();
+}
+
+char QMdiArea_DocumentMode(void* ptr)
+{
+	return static_cast<QMdiArea*>(ptr)->documentMode();
+}
+
+char QMdiArea_TestOption(void* ptr, long long option)
+{
+	return static_cast<QMdiArea*>(ptr)->testOption(static_cast<QMdiArea::AreaOption>(option));
+}
+
+void* QMdiArea___subWindowList_atList(void* ptr, int i)
+{
+	return const_cast<QMdiSubWindow*>(static_cast<QList<QMdiSubWindow *>*>(ptr)->at(i));
+}
+
+void QMdiArea___subWindowList_setList(void* ptr, void* i)
+{
+	static_cast<QList<QMdiSubWindow *>*>(ptr)->append(static_cast<QMdiSubWindow*>(i));
+}
+
+void* QMdiArea___subWindowList_newList(void* ptr)
+{
+	return new QList<QMdiSubWindow *>;
+}
+
+class MyQMdiSubWindow: public QMdiSubWindow
+{
+public:
+	MyQMdiSubWindow(QWidget *parent, Qt::WindowFlags flags) : QMdiSubWindow(parent, flags) {};
+	void Signal_AboutToActivate() { callbackQMdiSubWindow_AboutToActivate(this); };
+	void changeEvent(QEvent * changeEvent) { callbackQWidget_ChangeEvent(this, changeEvent); };
+	void closeEvent(QCloseEvent * closeEvent) { callbackQWidget_CloseEvent(this, closeEvent); };
+	void contextMenuEvent(QContextMenuEvent * contextMenuEvent) { callbackQWidget_ContextMenuEvent(this, contextMenuEvent); };
+	void focusInEvent(QFocusEvent * focusInEvent) { callbackQWidget_FocusInEvent(this, focusInEvent); };
+	void focusOutEvent(QFocusEvent * focusOutEvent) { callbackQWidget_FocusOutEvent(this, focusOutEvent); };
+	void hideEvent(QHideEvent * hideEvent) { callbackQWidget_HideEvent(this, hideEvent); };
+	void keyPressEvent(QKeyEvent * keyEvent) { callbackQWidget_KeyPressEvent(this, keyEvent); };
+	void leaveEvent(QEvent * leaveEvent) { callbackQWidget_LeaveEvent(this, leaveEvent); };
+	void mouseDoubleClickEvent(QMouseEvent * mouseEvent) { callbackQWidget_MouseDoubleClickEvent(this, mouseEvent); };
+	void mouseMoveEvent(QMouseEvent * mouseEvent) { callbackQWidget_MouseMoveEvent(this, mouseEvent); };
+	void mousePressEvent(QMouseEvent * mouseEvent) { callbackQWidget_MousePressEvent(this, mouseEvent); };
+	void mouseReleaseEvent(QMouseEvent * mouseEvent) { callbackQWidget_MouseReleaseEvent(this, mouseEvent); };
+	void moveEvent(QMoveEvent * moveEvent) { callbackQWidget_MoveEvent(this, moveEvent); };
+	void paintEvent(QPaintEvent * paintEvent) { callbackQWidget_PaintEvent(this, paintEvent); };
+	void resizeEvent(QResizeEvent * resizeEvent) { callbackQWidget_ResizeEvent(this, resizeEvent); };
+	void showEvent(QShowEvent * showEvent) { callbackQWidget_ShowEvent(this, showEvent); };
+	void showShaded() { callbackQMdiSubWindow_ShowShaded(this); };
+	void showSystemMenu() { callbackQMdiSubWindow_ShowSystemMenu(this); };
+	void Signal_WindowStateChanged(Qt::WindowStates oldState, Qt::WindowStates newState) { callbackQMdiSubWindow_WindowStateChanged(this, oldState, newState); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QMdiSubWindow_NewQMdiSubWindow(void* parent, long long flags)
+{
+	return new MyQMdiSubWindow(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(flags));
+}
+
+void QMdiSubWindow_ConnectAboutToActivate(void* ptr)
+{
+	QObject::connect(static_cast<QMdiSubWindow*>(ptr), static_cast<void (QMdiSubWindow::*)()>(&QMdiSubWindow::aboutToActivate), static_cast<MyQMdiSubWindow*>(ptr), static_cast<void (MyQMdiSubWindow::*)()>(&MyQMdiSubWindow::Signal_AboutToActivate));
+}
+
+void QMdiSubWindow_DisconnectAboutToActivate(void* ptr)
+{
+	QObject::disconnect(static_cast<QMdiSubWindow*>(ptr), static_cast<void (QMdiSubWindow::*)()>(&QMdiSubWindow::aboutToActivate), static_cast<MyQMdiSubWindow*>(ptr), static_cast<void (MyQMdiSubWindow::*)()>(&MyQMdiSubWindow::Signal_AboutToActivate));
+}
+
+void QMdiSubWindow_AboutToActivate(void* ptr)
+{
+	static_cast<QMdiSubWindow*>(ptr)->aboutToActivate();
+}
+
+void QMdiSubWindow_SetKeyboardPageStep(void* ptr, int step)
+{
+	static_cast<QMdiSubWindow*>(ptr)->setKeyboardPageStep(step);
+}
+
+void QMdiSubWindow_SetKeyboardSingleStep(void* ptr, int step)
+{
+	static_cast<QMdiSubWindow*>(ptr)->setKeyboardSingleStep(step);
+}
+
+void QMdiSubWindow_SetOption(void* ptr, long long option, char on)
+{
+	static_cast<QMdiSubWindow*>(ptr)->setOption(static_cast<QMdiSubWindow::SubWindowOption>(option), on != 0);
+}
+
+void QMdiSubWindow_SetSystemMenu(void* ptr, void* systemMenu)
+{
+	static_cast<QMdiSubWindow*>(ptr)->setSystemMenu(static_cast<QMenu*>(systemMenu));
+}
+
+void QMdiSubWindow_SetWidget(void* ptr, void* widget)
+{
+		static_cast<QMdiSubWindow*>(ptr)->setWidget(static_cast<QWidget*>(widget));
+}
+
+void QMdiSubWindow_ShowShaded(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QMdiSubWindow*>(ptr), "showShaded");
+}
+
+void QMdiSubWindow_ShowShadedDefault(void* ptr)
+{
+		static_cast<QMdiSubWindow*>(ptr)->QMdiSubWindow::showShaded();
+}
+
+void QMdiSubWindow_ShowSystemMenu(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QMdiSubWindow*>(ptr), "showSystemMenu");
+}
+
+void QMdiSubWindow_ShowSystemMenuDefault(void* ptr)
+{
+		static_cast<QMdiSubWindow*>(ptr)->QMdiSubWindow::showSystemMenu();
+}
+
+void QMdiSubWindow_ConnectWindowStateChanged(void* ptr)
+{
+	QObject::connect(static_cast<QMdiSubWindow*>(ptr), static_cast<void (QMdiSubWindow::*)(Qt::WindowStates, Qt::WindowStates)>(&QMdiSubWindow::windowStateChanged), static_cast<MyQMdiSubWindow*>(ptr), static_cast<void (MyQMdiSubWindow::*)(Qt::WindowStates, Qt::WindowStates)>(&MyQMdiSubWindow::Signal_WindowStateChanged));
+}
+
+void QMdiSubWindow_DisconnectWindowStateChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QMdiSubWindow*>(ptr), static_cast<void (QMdiSubWindow::*)(Qt::WindowStates, Qt::WindowStates)>(&QMdiSubWindow::windowStateChanged), static_cast<MyQMdiSubWindow*>(ptr), static_cast<void (MyQMdiSubWindow::*)(Qt::WindowStates, Qt::WindowStates)>(&MyQMdiSubWindow::Signal_WindowStateChanged));
+}
+
+void QMdiSubWindow_WindowStateChanged(void* ptr, long long oldState, long long newState)
+{
+	static_cast<QMdiSubWindow*>(ptr)->windowStateChanged(static_cast<Qt::WindowState>(oldState), static_cast<Qt::WindowState>(newState));
+}
+
+void QMdiSubWindow_DestroyQMdiSubWindow(void* ptr)
+{
+	static_cast<QMdiSubWindow*>(ptr)->~QMdiSubWindow();
+}
+
+void* QMdiSubWindow_MdiArea(void* ptr)
+{
+	return static_cast<QMdiSubWindow*>(ptr)->mdiArea();
+}
+
+void* QMdiSubWindow_SystemMenu(void* ptr)
+{
+	return static_cast<QMdiSubWindow*>(ptr)->systemMenu();
+}
+
+void* QMdiSubWindow_Widget(void* ptr)
+{
+	return static_cast<QMdiSubWindow*>(ptr)->widget();
+}
+
+char QMdiSubWindow_IsShaded(void* ptr)
+{
+	return static_cast<QMdiSubWindow*>(ptr)->isShaded();
+}
+
+char QMdiSubWindow_TestOption(void* ptr, long long option)
+{
+	return static_cast<QMdiSubWindow*>(ptr)->testOption(static_cast<QMdiSubWindow::SubWindowOption>(option));
+}
+
+int QMdiSubWindow_KeyboardPageStep(void* ptr)
+{
+	return static_cast<QMdiSubWindow*>(ptr)->keyboardPageStep();
+}
+
+int QMdiSubWindow_KeyboardSingleStep(void* ptr)
+{
+	return static_cast<QMdiSubWindow*>(ptr)->keyboardSingleStep();
+}
+
+class MyQMenu: public QMenu
+{
+public:
+	MyQMenu(QWidget *parent) : QMenu(parent) {};
+	MyQMenu(const QString &title, QWidget *parent) : QMenu(title, parent) {};
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	void Signal_AboutToHide() { callbackQMenu_AboutToHide(this); };
+	void Signal_AboutToShow() { callbackQMenu_AboutToShow(this); };
+	void actionEvent(QActionEvent * e) { callbackQWidget_ActionEvent(this, e); };
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void enterEvent(QEvent * vqe) { callbackQWidget_EnterEvent(this, vqe); };
+	void hideEvent(QHideEvent * vqh) { callbackQWidget_HideEvent(this, vqh); };
+	void Signal_Hovered(QAction * action) { callbackQMenu_Hovered(this, action); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void leaveEvent(QEvent * vqe) { callbackQWidget_LeaveEvent(this, vqe); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * e) { callbackQWidget_PaintEvent(this, e); };
+	void Signal_Triggered(QAction * action) { callbackQMenu_Triggered(this, action); };
+	void wheelEvent(QWheelEvent * e) { callbackQWidget_WheelEvent(this, e); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QMenu_AddAction2(void* ptr, void* icon, char* text)
+{
+	return static_cast<QMenu*>(ptr)->addAction(*static_cast<QIcon*>(icon), QString(text));
+}
+
+void* QMenu_AddAction4(void* ptr, void* icon, char* text, void* receiver, char* member, void* shortcut)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenu*>(ptr)->addAction(*static_cast<QIcon*>(icon), QString(text), static_cast<QGraphicsObject*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenu*>(ptr)->addAction(*static_cast<QIcon*>(icon), QString(text), static_cast<QGraphicsWidget*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenu*>(ptr)->addAction(*static_cast<QIcon*>(icon), QString(text), static_cast<QLayout*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenu*>(ptr)->addAction(*static_cast<QIcon*>(icon), QString(text), static_cast<QWidget*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	} else {
+		return static_cast<QMenu*>(ptr)->addAction(*static_cast<QIcon*>(icon), QString(text), static_cast<QObject*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	}
+}
+
+void* QMenu_AddAction(void* ptr, char* text)
+{
+	return static_cast<QMenu*>(ptr)->addAction(QString(text));
+}
+
+void* QMenu_AddAction3(void* ptr, char* text, void* receiver, char* member, void* shortcut)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenu*>(ptr)->addAction(QString(text), static_cast<QGraphicsObject*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenu*>(ptr)->addAction(QString(text), static_cast<QGraphicsWidget*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenu*>(ptr)->addAction(QString(text), static_cast<QLayout*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenu*>(ptr)->addAction(QString(text), static_cast<QWidget*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	} else {
+		return static_cast<QMenu*>(ptr)->addAction(QString(text), static_cast<QObject*>(receiver), const_cast<const char*>(member), *static_cast<QKeySequence*>(shortcut));
+	}
+}
+
+void* QMenu_AddMenu(void* ptr, void* menu)
+{
+	return static_cast<QMenu*>(ptr)->addMenu(static_cast<QMenu*>(menu));
+}
+
+void* QMenu_AddSection2(void* ptr, void* icon, char* text)
+{
+	return static_cast<QMenu*>(ptr)->addSection(*static_cast<QIcon*>(icon), QString(text));
+}
+
+void* QMenu_AddSection(void* ptr, char* text)
+{
+	return static_cast<QMenu*>(ptr)->addSection(QString(text));
+}
+
+void* QMenu_AddSeparator(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->addSeparator();
+}
+
+void* QMenu_Exec(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->exec();
+}
+
+void* QMenu_QMenu_Exec3(void* actions, void* pos, void* at, void* parent)
+{
+		return QMenu::exec(*static_cast<QList<QAction *>*>(actions), *static_cast<QPoint*>(pos), static_cast<QAction*>(at), static_cast<QWidget*>(parent));
+}
+
+void* QMenu_Exec2(void* ptr, void* p, void* action)
+{
+	return static_cast<QMenu*>(ptr)->exec(*static_cast<QPoint*>(p), static_cast<QAction*>(action));
+}
+
+void* QMenu_InsertMenu(void* ptr, void* before, void* menu)
+{
+	return static_cast<QMenu*>(ptr)->insertMenu(static_cast<QAction*>(before), static_cast<QMenu*>(menu));
+}
+
+void* QMenu_InsertSection2(void* ptr, void* before, void* icon, char* text)
+{
+	return static_cast<QMenu*>(ptr)->insertSection(static_cast<QAction*>(before), *static_cast<QIcon*>(icon), QString(text));
+}
+
+void* QMenu_InsertSection(void* ptr, void* before, char* text)
+{
+	return static_cast<QMenu*>(ptr)->insertSection(static_cast<QAction*>(before), QString(text));
+}
+
+void* QMenu_InsertSeparator(void* ptr, void* before)
+{
+	return static_cast<QMenu*>(ptr)->insertSeparator(static_cast<QAction*>(before));
+}
+
+void* QMenu_AddMenu3(void* ptr, void* icon, char* title)
+{
+	return static_cast<QMenu*>(ptr)->addMenu(*static_cast<QIcon*>(icon), QString(title));
+}
+
+void* QMenu_AddMenu2(void* ptr, char* title)
+{
+	return static_cast<QMenu*>(ptr)->addMenu(QString(title));
+}
+
+void* QMenu_NewQMenu(void* parent)
+{
+	return new MyQMenu(static_cast<QWidget*>(parent));
+}
+
+void* QMenu_NewQMenu2(char* title, void* parent)
+{
+	return new MyQMenu(QString(title), static_cast<QWidget*>(parent));
+}
+
+void QMenu_ConnectAboutToHide(void* ptr)
+{
+	QObject::connect(static_cast<QMenu*>(ptr), static_cast<void (QMenu::*)()>(&QMenu::aboutToHide), static_cast<MyQMenu*>(ptr), static_cast<void (MyQMenu::*)()>(&MyQMenu::Signal_AboutToHide));
+}
+
+void QMenu_DisconnectAboutToHide(void* ptr)
+{
+	QObject::disconnect(static_cast<QMenu*>(ptr), static_cast<void (QMenu::*)()>(&QMenu::aboutToHide), static_cast<MyQMenu*>(ptr), static_cast<void (MyQMenu::*)()>(&MyQMenu::Signal_AboutToHide));
+}
+
+void QMenu_AboutToHide(void* ptr)
+{
+	static_cast<QMenu*>(ptr)->aboutToHide();
+}
+
+void QMenu_ConnectAboutToShow(void* ptr)
+{
+	QObject::connect(static_cast<QMenu*>(ptr), static_cast<void (QMenu::*)()>(&QMenu::aboutToShow), static_cast<MyQMenu*>(ptr), static_cast<void (MyQMenu::*)()>(&MyQMenu::Signal_AboutToShow));
+}
+
+void QMenu_DisconnectAboutToShow(void* ptr)
+{
+	QObject::disconnect(static_cast<QMenu*>(ptr), static_cast<void (QMenu::*)()>(&QMenu::aboutToShow), static_cast<MyQMenu*>(ptr), static_cast<void (MyQMenu::*)()>(&MyQMenu::Signal_AboutToShow));
+}
+
+void QMenu_AboutToShow(void* ptr)
+{
+	static_cast<QMenu*>(ptr)->aboutToShow();
+}
+
+void QMenu_Clear(void* ptr)
+{
+	static_cast<QMenu*>(ptr)->clear();
+}
+
+void QMenu_HideTearOffMenu(void* ptr)
+{
+	static_cast<QMenu*>(ptr)->hideTearOffMenu();
+}
+
+void QMenu_ConnectHovered(void* ptr)
+{
+	QObject::connect(static_cast<QMenu*>(ptr), static_cast<void (QMenu::*)(QAction *)>(&QMenu::hovered), static_cast<MyQMenu*>(ptr), static_cast<void (MyQMenu::*)(QAction *)>(&MyQMenu::Signal_Hovered));
+}
+
+void QMenu_DisconnectHovered(void* ptr)
+{
+	QObject::disconnect(static_cast<QMenu*>(ptr), static_cast<void (QMenu::*)(QAction *)>(&QMenu::hovered), static_cast<MyQMenu*>(ptr), static_cast<void (MyQMenu::*)(QAction *)>(&MyQMenu::Signal_Hovered));
+}
+
+void QMenu_Hovered(void* ptr, void* action)
+{
+	static_cast<QMenu*>(ptr)->hovered(static_cast<QAction*>(action));
+}
+
+void QMenu_Popup(void* ptr, void* p, void* atAction)
+{
+	static_cast<QMenu*>(ptr)->popup(*static_cast<QPoint*>(p), static_cast<QAction*>(atAction));
+}
+
+void QMenu_SetActiveAction(void* ptr, void* act)
+{
+	static_cast<QMenu*>(ptr)->setActiveAction(static_cast<QAction*>(act));
+}
+
+void QMenu_SetAsDockMenu(void* ptr)
+{
+#ifdef Q_OS_OSX
+	static_cast<QMenu*>(ptr)->setAsDockMenu();
+#endif
+}
+
+void QMenu_SetDefaultAction(void* ptr, void* act)
+{
+	static_cast<QMenu*>(ptr)->setDefaultAction(static_cast<QAction*>(act));
+}
+
+void QMenu_SetIcon(void* ptr, void* icon)
+{
+	static_cast<QMenu*>(ptr)->setIcon(*static_cast<QIcon*>(icon));
+}
+
+void QMenu_SetSeparatorsCollapsible(void* ptr, char collapse)
+{
+	static_cast<QMenu*>(ptr)->setSeparatorsCollapsible(collapse != 0);
+}
+
+void QMenu_SetTearOffEnabled(void* ptr, char vbo)
+{
+	static_cast<QMenu*>(ptr)->setTearOffEnabled(vbo != 0);
+}
+
+void QMenu_SetTitle(void* ptr, char* title)
+{
+	static_cast<QMenu*>(ptr)->setTitle(QString(title));
+}
+
+void QMenu_SetToolTipsVisible(void* ptr, char visible)
+{
+	static_cast<QMenu*>(ptr)->setToolTipsVisible(visible != 0);
+}
+
+void QMenu_ShowTearOffMenu2(void* ptr)
+{
+	static_cast<QMenu*>(ptr)->showTearOffMenu();
+}
+
+void QMenu_ShowTearOffMenu(void* ptr, void* pos)
+{
+	static_cast<QMenu*>(ptr)->showTearOffMenu(*static_cast<QPoint*>(pos));
+}
+
+void QMenu_ConnectTriggered(void* ptr)
+{
+	QObject::connect(static_cast<QMenu*>(ptr), static_cast<void (QMenu::*)(QAction *)>(&QMenu::triggered), static_cast<MyQMenu*>(ptr), static_cast<void (MyQMenu::*)(QAction *)>(&MyQMenu::Signal_Triggered));
+}
+
+void QMenu_DisconnectTriggered(void* ptr)
+{
+	QObject::disconnect(static_cast<QMenu*>(ptr), static_cast<void (QMenu::*)(QAction *)>(&QMenu::triggered), static_cast<MyQMenu*>(ptr), static_cast<void (MyQMenu::*)(QAction *)>(&MyQMenu::Signal_Triggered));
+}
+
+void QMenu_Triggered(void* ptr, void* action)
+{
+	static_cast<QMenu*>(ptr)->triggered(static_cast<QAction*>(action));
+}
+
+void QMenu_DestroyQMenu(void* ptr)
+{
+	static_cast<QMenu*>(ptr)->~QMenu();
+}
+
+void* QMenu_ActionAt(void* ptr, void* pt)
+{
+	return static_cast<QMenu*>(ptr)->actionAt(*static_cast<QPoint*>(pt));
+}
+
+void* QMenu_ActiveAction(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->activeAction();
+}
+
+void* QMenu_DefaultAction(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->defaultAction();
+}
+
+void* QMenu_MenuAction(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->menuAction();
+}
+
+void* QMenu_Icon(void* ptr)
+{
+	return new QIcon(static_cast<QMenu*>(ptr)->icon());
+}
+
+void* QMenu_ActionGeometry(void* ptr, void* act)
+{
+	return ({ QRect tmpValue = static_cast<QMenu*>(ptr)->actionGeometry(static_cast<QAction*>(act)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtWidgets_PackedString QMenu_Title(void* ptr)
+{
+	return ({ QByteArray tbbbdf8 = static_cast<QMenu*>(ptr)->title().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tbbbdf8.prepend("WHITESPACE").constData()+10), tbbbdf8.size()-10 }; });
+}
+
+char QMenu_IsEmpty(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->isEmpty();
+}
+
+char QMenu_IsTearOffEnabled(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->isTearOffEnabled();
+}
+
+char QMenu_IsTearOffMenuVisible(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->isTearOffMenuVisible();
+}
+
+char QMenu_SeparatorsCollapsible(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->separatorsCollapsible();
+}
+
+char QMenu_ToolTipsVisible(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->toolTipsVisible();
+}
+
+int QMenu_ColumnCount(void* ptr)
+{
+	return static_cast<QMenu*>(ptr)->columnCount();
+}
+
+void QMenu_InitStyleOption(void* ptr, void* option, void* action)
+{
+	static_cast<QMenu*>(ptr)->initStyleOption(static_cast<QStyleOptionMenuItem*>(option), static_cast<QAction*>(action));
+}
+
+void* QMenu___exec_actions_atList3(void* ptr, int i)
+{
+	return const_cast<QAction*>(static_cast<QList<QAction *>*>(ptr)->at(i));
+}
+
+void QMenu___exec_actions_setList3(void* ptr, void* i)
+{
+	static_cast<QList<QAction *>*>(ptr)->append(static_cast<QAction*>(i));
+}
+
+void* QMenu___exec_actions_newList3(void* ptr)
+{
+	return new QList<QAction *>;
+}
+
+class MyQMenuBar: public QMenuBar
+{
+public:
+	MyQMenuBar(QWidget *parent) : QMenuBar(parent) {};
+	void actionEvent(QActionEvent * e) { callbackQWidget_ActionEvent(this, e); };
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void focusInEvent(QFocusEvent * vqf) { callbackQWidget_FocusInEvent(this, vqf); };
+	void focusOutEvent(QFocusEvent * vqf) { callbackQWidget_FocusOutEvent(this, vqf); };
+	void Signal_Hovered(QAction * action) { callbackQMenuBar_Hovered(this, action); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void leaveEvent(QEvent * vqe) { callbackQWidget_LeaveEvent(this, vqe); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * e) { callbackQWidget_PaintEvent(this, e); };
+	void resizeEvent(QResizeEvent * vqr) { callbackQWidget_ResizeEvent(this, vqr); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void Signal_Triggered(QAction * action) { callbackQMenuBar_Triggered(this, action); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	int heightForWidth(int vin) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), vin); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QMenuBar_AddAction(void* ptr, char* text)
+{
+	return static_cast<QMenuBar*>(ptr)->addAction(QString(text));
+}
+
+void* QMenuBar_AddAction2(void* ptr, char* text, void* receiver, char* member)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenuBar*>(ptr)->addAction(QString(text), static_cast<QGraphicsObject*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenuBar*>(ptr)->addAction(QString(text), static_cast<QGraphicsWidget*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenuBar*>(ptr)->addAction(QString(text), static_cast<QLayout*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(receiver))) {
+		return static_cast<QMenuBar*>(ptr)->addAction(QString(text), static_cast<QWidget*>(receiver), const_cast<const char*>(member));
+	} else {
+		return static_cast<QMenuBar*>(ptr)->addAction(QString(text), static_cast<QObject*>(receiver), const_cast<const char*>(member));
+	}
+}
+
+void* QMenuBar_AddMenu(void* ptr, void* menu)
+{
+	return static_cast<QMenuBar*>(ptr)->addMenu(static_cast<QMenu*>(menu));
+}
+
+void* QMenuBar_AddSeparator(void* ptr)
+{
+	return static_cast<QMenuBar*>(ptr)->addSeparator();
+}
+
+void* QMenuBar_InsertMenu(void* ptr, void* before, void* menu)
+{
+	return static_cast<QMenuBar*>(ptr)->insertMenu(static_cast<QAction*>(before), static_cast<QMenu*>(menu));
+}
+
+void* QMenuBar_InsertSeparator(void* ptr, void* before)
+{
+	return static_cast<QMenuBar*>(ptr)->insertSeparator(static_cast<QAction*>(before));
+}
+
+void* QMenuBar_AddMenu3(void* ptr, void* icon, char* title)
+{
+	return static_cast<QMenuBar*>(ptr)->addMenu(*static_cast<QIcon*>(icon), QString(title));
+}
+
+void* QMenuBar_AddMenu2(void* ptr, char* title)
+{
+	return static_cast<QMenuBar*>(ptr)->addMenu(QString(title));
+}
+
+void* QMenuBar_NewQMenuBar(void* parent)
+{
+	return new MyQMenuBar(static_cast<QWidget*>(parent));
+}
+
+void QMenuBar_Clear(void* ptr)
+{
+	static_cast<QMenuBar*>(ptr)->clear();
+}
+
+void QMenuBar_ConnectHovered(void* ptr)
+{
+	QObject::connect(static_cast<QMenuBar*>(ptr), static_cast<void (QMenuBar::*)(QAction *)>(&QMenuBar::hovered), static_cast<MyQMenuBar*>(ptr), static_cast<void (MyQMenuBar::*)(QAction *)>(&MyQMenuBar::Signal_Hovered));
+}
+
+void QMenuBar_DisconnectHovered(void* ptr)
+{
+	QObject::disconnect(static_cast<QMenuBar*>(ptr), static_cast<void (QMenuBar::*)(QAction *)>(&QMenuBar::hovered), static_cast<MyQMenuBar*>(ptr), static_cast<void (MyQMenuBar::*)(QAction *)>(&MyQMenuBar::Signal_Hovered));
+}
+
+void QMenuBar_Hovered(void* ptr, void* action)
+{
+	static_cast<QMenuBar*>(ptr)->hovered(static_cast<QAction*>(action));
+}
+
+void QMenuBar_SetActiveAction(void* ptr, void* act)
+{
+	static_cast<QMenuBar*>(ptr)->setActiveAction(static_cast<QAction*>(act));
+}
+
+void QMenuBar_SetCornerWidget(void* ptr, void* widget, long long corner)
+{
+		static_cast<QMenuBar*>(ptr)->setCornerWidget(static_cast<QWidget*>(widget), static_cast<Qt::Corner>(corner));
+}
+
+void QMenuBar_SetDefaultUp(void* ptr, char vbo)
+{
+	static_cast<QMenuBar*>(ptr)->setDefaultUp(vbo != 0);
+}
+
+void QMenuBar_SetNativeMenuBar(void* ptr, char nativeMenuBar)
+{
+	static_cast<QMenuBar*>(ptr)->setNativeMenuBar(nativeMenuBar != 0);
+}
+
+void QMenuBar_ConnectTriggered(void* ptr)
+{
+	QObject::connect(static_cast<QMenuBar*>(ptr), static_cast<void (QMenuBar::*)(QAction *)>(&QMenuBar::triggered), static_cast<MyQMenuBar*>(ptr), static_cast<void (MyQMenuBar::*)(QAction *)>(&MyQMenuBar::Signal_Triggered));
+}
+
+void QMenuBar_DisconnectTriggered(void* ptr)
+{
+	QObject::disconnect(static_cast<QMenuBar*>(ptr), static_cast<void (QMenuBar::*)(QAction *)>(&QMenuBar::triggered), static_cast<MyQMenuBar*>(ptr), static_cast<void (MyQMenuBar::*)(QAction *)>(&MyQMenuBar::Signal_Triggered));
+}
+
+void QMenuBar_Triggered(void* ptr, void* action)
+{
+	static_cast<QMenuBar*>(ptr)->triggered(static_cast<QAction*>(action));
+}
+
+void QMenuBar_DestroyQMenuBar(void* ptr)
+{
+	static_cast<QMenuBar*>(ptr)->~QMenuBar();
+}
+
+void* QMenuBar_ActionAt(void* ptr, void* pt)
+{
+	return static_cast<QMenuBar*>(ptr)->actionAt(*static_cast<QPoint*>(pt));
+}
+
+void* QMenuBar_ActiveAction(void* ptr)
+{
+	return static_cast<QMenuBar*>(ptr)->activeAction();
+}
+
+void* QMenuBar_ActionGeometry(void* ptr, void* act)
+{
+	return ({ QRect tmpValue = static_cast<QMenuBar*>(ptr)->actionGeometry(static_cast<QAction*>(act)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QMenuBar_CornerWidget(void* ptr, long long corner)
+{
+	return static_cast<QMenuBar*>(ptr)->cornerWidget(static_cast<Qt::Corner>(corner));
+}
+
+char QMenuBar_IsDefaultUp(void* ptr)
+{
+	return static_cast<QMenuBar*>(ptr)->isDefaultUp();
+}
+
+char QMenuBar_IsNativeMenuBar(void* ptr)
+{
+	return static_cast<QMenuBar*>(ptr)->isNativeMenuBar();
+}
+
+void QMenuBar_InitStyleOption(void* ptr, void* option, void* action)
+{
+	static_cast<QMenuBar*>(ptr)->initStyleOption(static_cast<QStyleOptionMenuItem*>(option), static_cast<QAction*>(action));
+}
+
+class MyQMessageBox: public QMessageBox
+{
+public:
+	MyQMessageBox(Icon icon, const QString &title, const QString &text, StandardButtons buttons, QWidget *parent, Qt::WindowFlags f) : QMessageBox(icon, title, text, buttons, parent, f) {};
+	MyQMessageBox(QWidget *parent) : QMessageBox(parent) {};
+	int exec() { return callbackQDialog_Exec(this); };
+	void Signal_ButtonClicked(QAbstractButton * button) { callbackQMessageBox_ButtonClicked(this, button); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void closeEvent(QCloseEvent * e) { callbackQWidget_CloseEvent(this, e); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void showEvent(QShowEvent * e) { callbackQWidget_ShowEvent(this, e); };
+	void accept() { callbackQDialog_Accept(this); };
+	void Signal_Accepted() { callbackQDialog_Accepted(this); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void done(int r) { callbackQDialog_Done(this, r); };
+	void Signal_Finished(int result) { callbackQDialog_Finished(this, result); };
+	void open() { callbackQDialog_Open(this); };
+	void reject() { callbackQDialog_Reject(this); };
+	void Signal_Rejected() { callbackQDialog_Rejected(this); };
+	void setVisible(bool visible) { callbackQDialog_SetVisible(this, visible); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+int QMessageBox_ButtonMask_Type()
+{
+	return QMessageBox::ButtonMask;
+}
+
+void* QMessageBox_NewQMessageBox2(long long icon, char* title, char* text, long long buttons, void* parent, long long f)
+{
+	return new MyQMessageBox(static_cast<QMessageBox::Icon>(icon), QString(title), QString(text), static_cast<QMessageBox::StandardButton>(buttons), static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(f));
+}
+
+void* QMessageBox_NewQMessageBox(void* parent)
+{
+	return new MyQMessageBox(static_cast<QWidget*>(parent));
+}
+
+void* QMessageBox_AddButton3(void* ptr, long long button)
+{
+	return static_cast<QMessageBox*>(ptr)->addButton(static_cast<QMessageBox::StandardButton>(button));
+}
+
+void* QMessageBox_AddButton2(void* ptr, char* text, long long role)
+{
+	return static_cast<QMessageBox*>(ptr)->addButton(QString(text), static_cast<QMessageBox::ButtonRole>(role));
+}
+
+long long QMessageBox_QMessageBox_Critical(void* parent, char* title, char* text, long long buttons, long long defaultButton)
+{
+		return QMessageBox::critical(static_cast<QWidget*>(parent), QString(title), QString(text), static_cast<QMessageBox::StandardButton>(buttons), static_cast<QMessageBox::StandardButton>(defaultButton));
+}
+
+long long QMessageBox_QMessageBox_Information(void* parent, char* title, char* text, long long buttons, long long defaultButton)
+{
+		return QMessageBox::information(static_cast<QWidget*>(parent), QString(title), QString(text), static_cast<QMessageBox::StandardButton>(buttons), static_cast<QMessageBox::StandardButton>(defaultButton));
+}
+
+long long QMessageBox_QMessageBox_Question(void* parent, char* title, char* text, long long buttons, long long defaultButton)
+{
+		return QMessageBox::question(static_cast<QWidget*>(parent), QString(title), QString(text), static_cast<QMessageBox::StandardButton>(buttons), static_cast<QMessageBox::StandardButton>(defaultButton));
+}
+
+long long QMessageBox_QMessageBox_Warning(void* parent, char* title, char* text, long long buttons, long long defaultButton)
+{
+		return QMessageBox::warning(static_cast<QWidget*>(parent), QString(title), QString(text), static_cast<QMessageBox::StandardButton>(buttons), static_cast<QMessageBox::StandardButton>(defaultButton));
+}
+
+void QMessageBox_QMessageBox_About(void* parent, char* title, char* text)
+{
+		QMessageBox::about(static_cast<QWidget*>(parent), QString(title), QString(text));
+}
+
+void QMessageBox_QMessageBox_AboutQt(void* parent, char* title)
+{
+		QMessageBox::aboutQt(static_cast<QWidget*>(parent), QString(title));
+}
+
+void QMessageBox_AddButton(void* ptr, void* button, long long role)
+{
+	static_cast<QMessageBox*>(ptr)->addButton(static_cast<QAbstractButton*>(button), static_cast<QMessageBox::ButtonRole>(role));
+}
+
+void QMessageBox_ConnectButtonClicked(void* ptr)
+{
+	QObject::connect(static_cast<QMessageBox*>(ptr), static_cast<void (QMessageBox::*)(QAbstractButton *)>(&QMessageBox::buttonClicked), static_cast<MyQMessageBox*>(ptr), static_cast<void (MyQMessageBox::*)(QAbstractButton *)>(&MyQMessageBox::Signal_ButtonClicked));
+}
+
+void QMessageBox_DisconnectButtonClicked(void* ptr)
+{
+	QObject::disconnect(static_cast<QMessageBox*>(ptr), static_cast<void (QMessageBox::*)(QAbstractButton *)>(&QMessageBox::buttonClicked), static_cast<MyQMessageBox*>(ptr), static_cast<void (MyQMessageBox::*)(QAbstractButton *)>(&MyQMessageBox::Signal_ButtonClicked));
+}
+
+void QMessageBox_ButtonClicked(void* ptr, void* button)
+{
+	static_cast<QMessageBox*>(ptr)->buttonClicked(static_cast<QAbstractButton*>(button));
+}
+
+void QMessageBox_Open(void* ptr, void* receiver, char* member)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(receiver))) {
+		static_cast<QMessageBox*>(ptr)->open(static_cast<QGraphicsObject*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QMessageBox*>(ptr)->open(static_cast<QGraphicsWidget*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(receiver))) {
+		static_cast<QMessageBox*>(ptr)->open(static_cast<QLayout*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QMessageBox*>(ptr)->open(static_cast<QWidget*>(receiver), const_cast<const char*>(member));
+	} else {
+		static_cast<QMessageBox*>(ptr)->open(static_cast<QObject*>(receiver), const_cast<const char*>(member));
+	}
+}
+
+void QMessageBox_RemoveButton(void* ptr, void* button)
+{
+	static_cast<QMessageBox*>(ptr)->removeButton(static_cast<QAbstractButton*>(button));
+}
+
+void QMessageBox_SetCheckBox(void* ptr, void* cb)
+{
+	static_cast<QMessageBox*>(ptr)->setCheckBox(static_cast<QCheckBox*>(cb));
+}
+
+void QMessageBox_SetDefaultButton(void* ptr, void* button)
+{
+	static_cast<QMessageBox*>(ptr)->setDefaultButton(static_cast<QPushButton*>(button));
+}
+
+void QMessageBox_SetDefaultButton2(void* ptr, long long button)
+{
+	static_cast<QMessageBox*>(ptr)->setDefaultButton(static_cast<QMessageBox::StandardButton>(button));
+}
+
+void QMessageBox_SetDetailedText(void* ptr, char* text)
+{
+	static_cast<QMessageBox*>(ptr)->setDetailedText(QString(text));
+}
+
+void QMessageBox_SetEscapeButton(void* ptr, void* button)
+{
+	static_cast<QMessageBox*>(ptr)->setEscapeButton(static_cast<QAbstractButton*>(button));
+}
+
+void QMessageBox_SetEscapeButton2(void* ptr, long long button)
+{
+	static_cast<QMessageBox*>(ptr)->setEscapeButton(static_cast<QMessageBox::StandardButton>(button));
+}
+
+void QMessageBox_SetIcon(void* ptr, long long vic)
+{
+	static_cast<QMessageBox*>(ptr)->setIcon(static_cast<QMessageBox::Icon>(vic));
+}
+
+void QMessageBox_SetIconPixmap(void* ptr, void* pixmap)
+{
+	static_cast<QMessageBox*>(ptr)->setIconPixmap(*static_cast<QPixmap*>(pixmap));
+}
+
+void QMessageBox_SetInformativeText(void* ptr, char* text)
+{
+	static_cast<QMessageBox*>(ptr)->setInformativeText(QString(text));
+}
+
+void QMessageBox_SetStandardButtons(void* ptr, long long buttons)
+{
+	static_cast<QMessageBox*>(ptr)->setStandardButtons(static_cast<QMessageBox::StandardButton>(buttons));
+}
+
+void QMessageBox_SetText(void* ptr, char* text)
+{
+	static_cast<QMessageBox*>(ptr)->setText(QString(text));
+}
+
+void QMessageBox_SetTextFormat(void* ptr, long long format)
+{
+	static_cast<QMessageBox*>(ptr)->setTextFormat(static_cast<Qt::TextFormat>(format));
+}
+
+void QMessageBox_SetTextInteractionFlags(void* ptr, long long flags)
+{
+	static_cast<QMessageBox*>(ptr)->setTextInteractionFlags(static_cast<Qt::TextInteractionFlag>(flags));
+}
+
+long long QMessageBox_Icon(void* ptr)
+{
+	return static_cast<QMessageBox*>(ptr)->icon();
+}
+
+void* QMessageBox_IconPixmap(void* ptr)
+{
+	return new QPixmap(static_cast<QMessageBox*>(ptr)->iconPixmap());
+}
+
+struct QtWidgets_PackedString QMessageBox_DetailedText(void* ptr)
+{
+	return ({ QByteArray t9d0340 = static_cast<QMessageBox*>(ptr)->detailedText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t9d0340.prepend("WHITESPACE").constData()+10), t9d0340.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QMessageBox_InformativeText(void* ptr)
+{
+	return ({ QByteArray t0d44bc = static_cast<QMessageBox*>(ptr)->informativeText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t0d44bc.prepend("WHITESPACE").constData()+10), t0d44bc.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QMessageBox_Text(void* ptr)
+{
+	return ({ QByteArray te2bb59 = static_cast<QMessageBox*>(ptr)->text().toUtf8(); QtWidgets_PackedString { const_cast<char*>(te2bb59.prepend("WHITESPACE").constData()+10), te2bb59.size()-10 }; });
+}
+
+long long QMessageBox_TextFormat(void* ptr)
+{
+	return static_cast<QMessageBox*>(ptr)->textFormat();
+}
+
+long long QMessageBox_TextInteractionFlags(void* ptr)
+{
+	return static_cast<QMessageBox*>(ptr)->textInteractionFlags();
+}
+
+long long QMessageBox_StandardButtons(void* ptr)
+{
+	return static_cast<QMessageBox*>(ptr)->standardButtons();
+}
+
+void QMessageBox_SetWindowTitle(void* ptr, char* title)
+{
+	static_cast<QMessageBox*>(ptr)->setWindowTitle(QString(title));
+}
+
+void QMessageBox_DestroyQMessageBox(void* ptr)
+{
+	static_cast<QMessageBox*>(ptr)->~QMessageBox();
+}
+
+long long QMessageBox_ButtonRole(void* ptr, void* button)
+{
+	return static_cast<QMessageBox*>(ptr)->buttonRole(static_cast<QAbstractButton*>(button));
+}
+
+void* QMessageBox_Button(void* ptr, long long which)
+{
+	return static_cast<QMessageBox*>(ptr)->button(static_cast<QMessageBox::StandardButton>(which));
+}
+
+void* QMessageBox_ClickedButton(void* ptr)
+{
+	return static_cast<QMessageBox*>(ptr)->clickedButton();
+}
+
+void* QMessageBox_EscapeButton(void* ptr)
+{
+	return static_cast<QMessageBox*>(ptr)->escapeButton();
+}
+
+void* QMessageBox_CheckBox(void* ptr)
+{
+	return static_cast<QMessageBox*>(ptr)->checkBox();
+}
+
+struct QtWidgets_PackedList QMessageBox_Buttons(void* ptr)
+{
+	return ({ QList<QAbstractButton *>* tmpValue = new QList<QAbstractButton *>(static_cast<QMessageBox*>(ptr)->buttons()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QMessageBox_DefaultButton(void* ptr)
+{
+	return static_cast<QMessageBox*>(ptr)->defaultButton();
+}
+
+long long QMessageBox_StandardButton(void* ptr, void* button)
+{
+	return static_cast<QMessageBox*>(ptr)->standardButton(static_cast<QAbstractButton*>(button));
+}
+
+void* QMessageBox___buttons_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractButton*>(static_cast<QList<QAbstractButton *>*>(ptr)->at(i));
+}
+
+void QMessageBox___buttons_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractButton *>*>(ptr)->append(static_cast<QAbstractButton*>(i));
+}
+
+void* QMessageBox___buttons_newList(void* ptr)
+{
+	return new QList<QAbstractButton *>;
+}
+
+class MyQMouseEventTransition: public QMouseEventTransition
+{
+public:
+	MyQMouseEventTransition(QObject *object, QEvent::Type type, Qt::MouseButton button, QState *sourceState) : QMouseEventTransition(object, type, button, sourceState) {};
+	MyQMouseEventTransition(QState *sourceState) : QMouseEventTransition(sourceState) {};
+	bool eventTest(QEvent * event) { return callbackQMouseEventTransition_EventTest(this, event) != 0; };
+	void onTransition(QEvent * event) { callbackQMouseEventTransition_OnTransition(this, event); };
+	bool event(QEvent * e) { return callbackQMouseEventTransition_Event(this, e) != 0; };
+	void Signal_TargetStateChanged() { callbackQMouseEventTransition_TargetStateChanged(this); };
+	void Signal_TargetStatesChanged() { callbackQMouseEventTransition_TargetStatesChanged(this); };
+	void Signal_Triggered() { callbackQMouseEventTransition_Triggered(this); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQMouseEventTransition_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQMouseEventTransition_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQMouseEventTransition_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQMouseEventTransition_CustomEvent(this, event); };
+	void deleteLater() { callbackQMouseEventTransition_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQMouseEventTransition_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQMouseEventTransition_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQMouseEventTransition_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQMouseEventTransition_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQMouseEventTransition_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QMouseEventTransition_NewQMouseEventTransition2(void* object, long long ty, long long button, void* sourceState)
+{
+	return new MyQMouseEventTransition(static_cast<QObject*>(object), static_cast<QEvent::Type>(ty), static_cast<Qt::MouseButton>(button), static_cast<QState*>(sourceState));
+}
+
+void* QMouseEventTransition_NewQMouseEventTransition(void* sourceState)
+{
+	return new MyQMouseEventTransition(static_cast<QState*>(sourceState));
+}
+
+char QMouseEventTransition_EventTestDefault(void* ptr, void* event)
+{
+		return static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::eventTest(static_cast<QEvent*>(event));
+}
+
+void QMouseEventTransition_OnTransitionDefault(void* ptr, void* event)
+{
+		static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::onTransition(static_cast<QEvent*>(event));
+}
+
+void QMouseEventTransition_SetButton(void* ptr, long long button)
+{
+	static_cast<QMouseEventTransition*>(ptr)->setButton(static_cast<Qt::MouseButton>(button));
+}
+
+void QMouseEventTransition_SetHitTestPath(void* ptr, void* path)
+{
+	static_cast<QMouseEventTransition*>(ptr)->setHitTestPath(*static_cast<QPainterPath*>(path));
+}
+
+void QMouseEventTransition_SetModifierMask(void* ptr, long long modifierMask)
+{
+	static_cast<QMouseEventTransition*>(ptr)->setModifierMask(static_cast<Qt::KeyboardModifier>(modifierMask));
+}
+
+void QMouseEventTransition_DestroyQMouseEventTransition(void* ptr)
+{
+	static_cast<QMouseEventTransition*>(ptr)->~QMouseEventTransition();
+}
+
+void* QMouseEventTransition_HitTestPath(void* ptr)
+{
+	return new QPainterPath(static_cast<QMouseEventTransition*>(ptr)->hitTestPath());
+}
+
+long long QMouseEventTransition_ModifierMask(void* ptr)
+{
+	return static_cast<QMouseEventTransition*>(ptr)->modifierMask();
+}
+
+long long QMouseEventTransition_Button(void* ptr)
+{
+	return static_cast<QMouseEventTransition*>(ptr)->button();
+}
+
+void* QMouseEventTransition___setTargetStates_targets_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractState*>(static_cast<QList<QAbstractState *>*>(ptr)->at(i));
+}
+
+void QMouseEventTransition___setTargetStates_targets_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractState *>*>(ptr)->append(static_cast<QAbstractState*>(i));
+}
+
+void* QMouseEventTransition___setTargetStates_targets_newList(void* ptr)
+{
+	return new QList<QAbstractState *>;
+}
+
+void* QMouseEventTransition___animations_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractAnimation*>(static_cast<QList<QAbstractAnimation *>*>(ptr)->at(i));
+}
+
+void QMouseEventTransition___animations_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractAnimation *>*>(ptr)->append(static_cast<QAbstractAnimation*>(i));
+}
+
+void* QMouseEventTransition___animations_newList(void* ptr)
+{
+	return new QList<QAbstractAnimation *>;
+}
+
+void* QMouseEventTransition___targetStates_atList(void* ptr, int i)
+{
+	return const_cast<QAbstractState*>(static_cast<QList<QAbstractState *>*>(ptr)->at(i));
+}
+
+void QMouseEventTransition___targetStates_setList(void* ptr, void* i)
+{
+	static_cast<QList<QAbstractState *>*>(ptr)->append(static_cast<QAbstractState*>(i));
+}
+
+void* QMouseEventTransition___targetStates_newList(void* ptr)
+{
+	return new QList<QAbstractState *>;
+}
+
+void* QMouseEventTransition___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QMouseEventTransition___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QMouseEventTransition___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QMouseEventTransition___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QMouseEventTransition___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QMouseEventTransition___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QMouseEventTransition___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QMouseEventTransition___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QMouseEventTransition___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QMouseEventTransition___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QMouseEventTransition___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QMouseEventTransition___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QMouseEventTransition___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QMouseEventTransition___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QMouseEventTransition___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QMouseEventTransition_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::event(static_cast<QEvent*>(e));
+}
+
+char QMouseEventTransition_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QMouseEventTransition_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QMouseEventTransition_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QMouseEventTransition_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::customEvent(static_cast<QEvent*>(event));
+}
+
+void QMouseEventTransition_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::deleteLater();
+}
+
+void QMouseEventTransition_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QMouseEventTransition_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QMouseEventTransition_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QMouseEventTransition*>(ptr)->QMouseEventTransition::metaObject());
+}
+
+class MyQPanGesture: public QPanGesture
+{
+public:
+	bool event(QEvent * e) { return callbackQGesture_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGesture_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGesture_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGesture_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGesture_CustomEvent(this, event); };
+	void deleteLater() { callbackQGesture_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGesture_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGesture_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGesture_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGesture_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGesture_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QPanGesture_SetAcceleration(void* ptr, double value)
+{
+	static_cast<QPanGesture*>(ptr)->setAcceleration(value);
+}
+
+void QPanGesture_SetLastOffset(void* ptr, void* value)
+{
+	static_cast<QPanGesture*>(ptr)->setLastOffset(*static_cast<QPointF*>(value));
+}
+
+void QPanGesture_SetOffset(void* ptr, void* value)
+{
+	static_cast<QPanGesture*>(ptr)->setOffset(*static_cast<QPointF*>(value));
+}
+
+void QPanGesture_DestroyQPanGesture(void* ptr)
+{
+	static_cast<QPanGesture*>(ptr)->~QPanGesture();
+}
+
+void* QPanGesture_Delta(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QPanGesture*>(ptr)->delta(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QPanGesture_LastOffset(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QPanGesture*>(ptr)->lastOffset(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QPanGesture_Offset(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QPanGesture*>(ptr)->offset(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+double QPanGesture_Acceleration(void* ptr)
+{
+	return static_cast<QPanGesture*>(ptr)->acceleration();
+}
+
+class MyQPinchGesture: public QPinchGesture
+{
+public:
+	bool event(QEvent * e) { return callbackQGesture_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQGesture_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQGesture_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQGesture_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQGesture_CustomEvent(this, event); };
+	void deleteLater() { callbackQGesture_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQGesture_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQGesture_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQGesture_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQGesture_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQGesture_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QPinchGesture_SetCenterPoint(void* ptr, void* value)
+{
+	static_cast<QPinchGesture*>(ptr)->setCenterPoint(*static_cast<QPointF*>(value));
+}
+
+void QPinchGesture_SetChangeFlags(void* ptr, long long value)
+{
+	static_cast<QPinchGesture*>(ptr)->setChangeFlags(static_cast<QPinchGesture::ChangeFlag>(value));
+}
+
+void QPinchGesture_SetLastCenterPoint(void* ptr, void* value)
+{
+	static_cast<QPinchGesture*>(ptr)->setLastCenterPoint(*static_cast<QPointF*>(value));
+}
+
+void QPinchGesture_SetLastRotationAngle(void* ptr, double value)
+{
+	static_cast<QPinchGesture*>(ptr)->setLastRotationAngle(value);
+}
+
+void QPinchGesture_SetLastScaleFactor(void* ptr, double value)
+{
+	static_cast<QPinchGesture*>(ptr)->setLastScaleFactor(value);
+}
+
+void QPinchGesture_SetRotationAngle(void* ptr, double value)
+{
+	static_cast<QPinchGesture*>(ptr)->setRotationAngle(value);
+}
+
+void QPinchGesture_SetScaleFactor(void* ptr, double value)
+{
+	static_cast<QPinchGesture*>(ptr)->setScaleFactor(value);
+}
+
+void QPinchGesture_SetStartCenterPoint(void* ptr, void* value)
+{
+	static_cast<QPinchGesture*>(ptr)->setStartCenterPoint(*static_cast<QPointF*>(value));
+}
+
+void QPinchGesture_SetTotalChangeFlags(void* ptr, long long value)
+{
+	static_cast<QPinchGesture*>(ptr)->setTotalChangeFlags(static_cast<QPinchGesture::ChangeFlag>(value));
+}
+
+void QPinchGesture_SetTotalRotationAngle(void* ptr, double value)
+{
+	static_cast<QPinchGesture*>(ptr)->setTotalRotationAngle(value);
+}
+
+void QPinchGesture_SetTotalScaleFactor(void* ptr, double value)
+{
+	static_cast<QPinchGesture*>(ptr)->setTotalScaleFactor(value);
+}
+
+void QPinchGesture_DestroyQPinchGesture(void* ptr)
+{
+	static_cast<QPinchGesture*>(ptr)->~QPinchGesture();
+}
+
+long long QPinchGesture_ChangeFlags(void* ptr)
+{
+	return static_cast<QPinchGesture*>(ptr)->changeFlags();
+}
+
+long long QPinchGesture_TotalChangeFlags(void* ptr)
+{
+	return static_cast<QPinchGesture*>(ptr)->totalChangeFlags();
+}
+
+void* QPinchGesture_CenterPoint(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QPinchGesture*>(ptr)->centerPoint(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QPinchGesture_LastCenterPoint(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QPinchGesture*>(ptr)->lastCenterPoint(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QPinchGesture_StartCenterPoint(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QPinchGesture*>(ptr)->startCenterPoint(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+double QPinchGesture_LastRotationAngle(void* ptr)
+{
+	return static_cast<QPinchGesture*>(ptr)->lastRotationAngle();
+}
+
+double QPinchGesture_LastScaleFactor(void* ptr)
+{
+	return static_cast<QPinchGesture*>(ptr)->lastScaleFactor();
+}
+
+double QPinchGesture_RotationAngle(void* ptr)
+{
+	return static_cast<QPinchGesture*>(ptr)->rotationAngle();
+}
+
+double QPinchGesture_ScaleFactor(void* ptr)
+{
+	return static_cast<QPinchGesture*>(ptr)->scaleFactor();
+}
+
+double QPinchGesture_TotalRotationAngle(void* ptr)
+{
+	return static_cast<QPinchGesture*>(ptr)->totalRotationAngle();
+}
+
+double QPinchGesture_TotalScaleFactor(void* ptr)
+{
+	return static_cast<QPinchGesture*>(ptr)->totalScaleFactor();
+}
+
+class MyQPlainTextDocumentLayout: public QPlainTextDocumentLayout
+{
+public:
+	MyQPlainTextDocumentLayout(QTextDocument *document) : QPlainTextDocumentLayout(document) {};
+	void documentChanged(int from, int charsRemoved, int charsAdded) { callbackQPlainTextDocumentLayout_DocumentChanged(this, from, charsRemoved, charsAdded); };
+	void draw(QPainter * vqp, const PaintContext & vpa) { callbackQPlainTextDocumentLayout_Draw(this, vqp, const_cast<PaintContext*>(&vpa)); };
+	QRectF blockBoundingRect(const QTextBlock & block) const { return *static_cast<QRectF*>(callbackQPlainTextDocumentLayout_BlockBoundingRect(const_cast<void*>(static_cast<const void*>(this)), const_cast<QTextBlock*>(&block))); };
+	QRectF frameBoundingRect(QTextFrame * vqt) const { return *static_cast<QRectF*>(callbackQPlainTextDocumentLayout_FrameBoundingRect(const_cast<void*>(static_cast<const void*>(this)), vqt)); };
+	QSizeF documentSize() const { return *static_cast<QSizeF*>(callbackQPlainTextDocumentLayout_DocumentSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	int hitTest(const QPointF & vqp, Qt::HitTestAccuracy vqt) const { return callbackQPlainTextDocumentLayout_HitTest(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPointF*>(&vqp), vqt); };
+	int pageCount() const { return callbackQPlainTextDocumentLayout_PageCount(const_cast<void*>(static_cast<const void*>(this))); };
+	void Signal_DocumentSizeChanged(const QSizeF & newSize) { callbackQPlainTextDocumentLayout_DocumentSizeChanged(this, const_cast<QSizeF*>(&newSize)); };
+	
+	void Signal_PageCountChanged(int newPages) { callbackQPlainTextDocumentLayout_PageCountChanged(this, newPages); };
+	
+	
+	void Signal_Update(const QRectF & rect) { callbackQPlainTextDocumentLayout_Update(this, const_cast<QRectF*>(&rect)); };
+	void Signal_UpdateBlock(const QTextBlock & block) { callbackQPlainTextDocumentLayout_UpdateBlock(this, const_cast<QTextBlock*>(&block)); };
+	bool event(QEvent * e) { return callbackQPlainTextDocumentLayout_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQPlainTextDocumentLayout_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQPlainTextDocumentLayout_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQPlainTextDocumentLayout_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQPlainTextDocumentLayout_CustomEvent(this, event); };
+	void deleteLater() { callbackQPlainTextDocumentLayout_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQPlainTextDocumentLayout_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQPlainTextDocumentLayout_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQPlainTextDocumentLayout_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQPlainTextDocumentLayout_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQPlainTextDocumentLayout_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QPlainTextDocumentLayout_NewQPlainTextDocumentLayout(void* document)
+{
+	return new MyQPlainTextDocumentLayout(static_cast<QTextDocument*>(document));
+}
+
+void QPlainTextDocumentLayout_DocumentChanged(void* ptr, int from, int charsRemoved, int charsAdded)
+{
+	static_cast<QPlainTextDocumentLayout*>(ptr)->documentChanged(from, charsRemoved, charsAdded);
+}
+
+void QPlainTextDocumentLayout_DocumentChangedDefault(void* ptr, int from, int charsRemoved, int charsAdded)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::documentChanged(from, charsRemoved, charsAdded);
+}
+
+void QPlainTextDocumentLayout_Draw(void* ptr, void* vqp, void* vpa)
+{
+	static_cast<QPlainTextDocumentLayout*>(ptr)->draw(static_cast<QPainter*>(vqp), *static_cast<QAbstractTextDocumentLayout::PaintContext*>(vpa));
+}
+
+void QPlainTextDocumentLayout_DrawDefault(void* ptr, void* vqp, void* vpa)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::draw(static_cast<QPainter*>(vqp), *static_cast<QAbstractTextDocumentLayout::PaintContext*>(vpa));
+}
+
+void QPlainTextDocumentLayout_RequestUpdate(void* ptr)
+{
+	static_cast<QPlainTextDocumentLayout*>(ptr)->requestUpdate();
+}
+
+void QPlainTextDocumentLayout_SetCursorWidth(void* ptr, int width)
+{
+	static_cast<QPlainTextDocumentLayout*>(ptr)->setCursorWidth(width);
+}
+
+void QPlainTextDocumentLayout_DestroyQPlainTextDocumentLayout(void* ptr)
+{
+	static_cast<QPlainTextDocumentLayout*>(ptr)->~QPlainTextDocumentLayout();
+}
+
+void* QPlainTextDocumentLayout_BlockBoundingRect(void* ptr, void* block)
+{
+	return ({ QRectF tmpValue = static_cast<QPlainTextDocumentLayout*>(ptr)->blockBoundingRect(*static_cast<QTextBlock*>(block)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QPlainTextDocumentLayout_BlockBoundingRectDefault(void* ptr, void* block)
+{
+		return ({ QRectF tmpValue = static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::blockBoundingRect(*static_cast<QTextBlock*>(block)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QPlainTextDocumentLayout_FrameBoundingRect(void* ptr, void* vqt)
+{
+	return ({ QRectF tmpValue = static_cast<QPlainTextDocumentLayout*>(ptr)->frameBoundingRect(static_cast<QTextFrame*>(vqt)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QPlainTextDocumentLayout_FrameBoundingRectDefault(void* ptr, void* vqt)
+{
+		return ({ QRectF tmpValue = static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::frameBoundingRect(static_cast<QTextFrame*>(vqt)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QPlainTextDocumentLayout_DocumentSize(void* ptr)
+{
+	return ({ QSizeF tmpValue = static_cast<QPlainTextDocumentLayout*>(ptr)->documentSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QPlainTextDocumentLayout_DocumentSizeDefault(void* ptr)
+{
+		return ({ QSizeF tmpValue = static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::documentSize(); new QSizeF(tmpValue.width(), tmpValue.height()); });
+}
+
+int QPlainTextDocumentLayout_CursorWidth(void* ptr)
+{
+	return static_cast<QPlainTextDocumentLayout*>(ptr)->cursorWidth();
+}
+
+int QPlainTextDocumentLayout_HitTest(void* ptr, void* vqp, long long vqt)
+{
+	return static_cast<QPlainTextDocumentLayout*>(ptr)->hitTest(*static_cast<QPointF*>(vqp), static_cast<Qt::HitTestAccuracy>(vqt));
+}
+
+int QPlainTextDocumentLayout_HitTestDefault(void* ptr, void* vqp, long long vqt)
+{
+		return static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::hitTest(*static_cast<QPointF*>(vqp), static_cast<Qt::HitTestAccuracy>(vqt));
+}
+
+int QPlainTextDocumentLayout_PageCount(void* ptr)
+{
+	return static_cast<QPlainTextDocumentLayout*>(ptr)->pageCount();
+}
+
+int QPlainTextDocumentLayout_PageCountDefault(void* ptr)
+{
+		return static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::pageCount();
+}
+
+void QPlainTextDocumentLayout_EnsureBlockLayout(void* ptr, void* block)
+{
+	static_cast<QPlainTextDocumentLayout*>(ptr)->ensureBlockLayout(*static_cast<QTextBlock*>(block));
+}
+
+void* QPlainTextDocumentLayout___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QPlainTextDocumentLayout___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QPlainTextDocumentLayout___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QPlainTextDocumentLayout___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPlainTextDocumentLayout___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPlainTextDocumentLayout___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPlainTextDocumentLayout___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPlainTextDocumentLayout___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPlainTextDocumentLayout___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPlainTextDocumentLayout___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QPlainTextDocumentLayout___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPlainTextDocumentLayout___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QPlainTextDocumentLayout___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QPlainTextDocumentLayout___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QPlainTextDocumentLayout___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+void QPlainTextDocumentLayout_DrawInlineObjectDefault(void* ptr, void* painter, void* rect, void* object, int posInDocument, void* format)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::drawInlineObject(static_cast<QPainter*>(painter), *static_cast<QRectF*>(rect), *static_cast<QTextInlineObject*>(object), posInDocument, *static_cast<QTextFormat*>(format));
+}
+
+void QPlainTextDocumentLayout_PositionInlineObjectDefault(void* ptr, void* item, int posInDocument, void* format)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::positionInlineObject(*static_cast<QTextInlineObject*>(item), posInDocument, *static_cast<QTextFormat*>(format));
+}
+
+void QPlainTextDocumentLayout_ResizeInlineObjectDefault(void* ptr, void* item, int posInDocument, void* format)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::resizeInlineObject(*static_cast<QTextInlineObject*>(item), posInDocument, *static_cast<QTextFormat*>(format));
+}
+
+char QPlainTextDocumentLayout_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::event(static_cast<QEvent*>(e));
+}
+
+char QPlainTextDocumentLayout_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QPlainTextDocumentLayout_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QPlainTextDocumentLayout_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QPlainTextDocumentLayout_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::customEvent(static_cast<QEvent*>(event));
+}
+
+void QPlainTextDocumentLayout_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::deleteLater();
+}
+
+void QPlainTextDocumentLayout_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QPlainTextDocumentLayout_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QPlainTextDocumentLayout_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QPlainTextDocumentLayout*>(ptr)->QPlainTextDocumentLayout::metaObject());
+}
+
+class MyQPlainTextEdit: public QPlainTextEdit
+{
+public:
+	MyQPlainTextEdit(QWidget *parent) : QPlainTextEdit(parent) {};
+	MyQPlainTextEdit(const QString &text, QWidget *parent) : QPlainTextEdit(text, parent) {};
+	QVariant loadResource(int ty, const QUrl & name) { return *static_cast<QVariant*>(callbackQPlainTextEdit_LoadResource(this, ty, const_cast<QUrl*>(&name))); };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	void appendHtml(const QString & html) { QByteArray t950a39 = html.toUtf8(); QtWidgets_PackedString htmlPacked = { const_cast<char*>(t950a39.prepend("WHITESPACE").constData()+10), t950a39.size()-10 };callbackQPlainTextEdit_AppendHtml(this, htmlPacked); };
+	void appendPlainText(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQPlainTextEdit_AppendPlainText(this, textPacked); };
+	void Signal_BlockCountChanged(int newBlockCount) { callbackQPlainTextEdit_BlockCountChanged(this, newBlockCount); };
+	void centerCursor() { callbackQPlainTextEdit_CenterCursor(this); };
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void clear() { callbackQPlainTextEdit_Clear(this); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void copy() { callbackQPlainTextEdit_Copy(this); };
+	void Signal_CopyAvailable(bool yes) { callbackQPlainTextEdit_CopyAvailable(this, yes); };
+	void Signal_CursorPositionChanged() { callbackQPlainTextEdit_CursorPositionChanged(this); };
+	void cut() { callbackQPlainTextEdit_Cut(this); };
+	void dragEnterEvent(QDragEnterEvent * e) { callbackQWidget_DragEnterEvent(this, e); };
+	void dragLeaveEvent(QDragLeaveEvent * e) { callbackQWidget_DragLeaveEvent(this, e); };
+	void dragMoveEvent(QDragMoveEvent * e) { callbackQWidget_DragMoveEvent(this, e); };
+	void dropEvent(QDropEvent * e) { callbackQWidget_DropEvent(this, e); };
+	void focusInEvent(QFocusEvent * e) { callbackQWidget_FocusInEvent(this, e); };
+	void focusOutEvent(QFocusEvent * e) { callbackQWidget_FocusOutEvent(this, e); };
+	void inputMethodEvent(QInputMethodEvent * e) { callbackQWidget_InputMethodEvent(this, e); };
+	void insertFromMimeData(const QMimeData * source) { callbackQPlainTextEdit_InsertFromMimeData(this, const_cast<QMimeData*>(source)); };
+	void insertPlainText(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQPlainTextEdit_InsertPlainText(this, textPacked); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void keyReleaseEvent(QKeyEvent * e) { callbackQWidget_KeyReleaseEvent(this, e); };
+	void Signal_ModificationChanged(bool changed) { callbackQPlainTextEdit_ModificationChanged(this, changed); };
+	void mouseDoubleClickEvent(QMouseEvent * e) { callbackQWidget_MouseDoubleClickEvent(this, e); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * e) { callbackQWidget_PaintEvent(this, e); };
+	void paste() { callbackQPlainTextEdit_Paste(this); };
+	void redo() { callbackQPlainTextEdit_Redo(this); };
+	void Signal_RedoAvailable(bool available) { callbackQPlainTextEdit_RedoAvailable(this, available); };
+	void resizeEvent(QResizeEvent * e) { callbackQWidget_ResizeEvent(this, e); };
+	void scrollContentsBy(int dx, int dy) { callbackQAbstractScrollArea_ScrollContentsBy(this, dx, dy); };
+	void selectAll() { callbackQPlainTextEdit_SelectAll(this); };
+	void Signal_SelectionChanged() { callbackQPlainTextEdit_SelectionChanged(this); };
+	void setPlainText(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQPlainTextEdit_SetPlainText(this, textPacked); };
+	void showEvent(QShowEvent * vqs) { callbackQWidget_ShowEvent(this, vqs); };
+	void Signal_TextChanged() { callbackQPlainTextEdit_TextChanged(this); };
+	void undo() { callbackQPlainTextEdit_Undo(this); };
+	void Signal_UndoAvailable(bool available) { callbackQPlainTextEdit_UndoAvailable(this, available); };
+	void Signal_UpdateRequest(const QRect & rect, int dy) { callbackQPlainTextEdit_UpdateRequest(this, const_cast<QRect*>(&rect), dy); };
+	void wheelEvent(QWheelEvent * e) { callbackQWidget_WheelEvent(this, e); };
+	void zoomIn(int ran) { callbackQPlainTextEdit_ZoomIn(this, ran); };
+	void zoomOut(int ran) { callbackQPlainTextEdit_ZoomOut(this, ran); };
+	 ~MyQPlainTextEdit() { callbackQPlainTextEdit_DestroyQPlainTextEdit(this); };
+	QMimeData * createMimeDataFromSelection() const { return static_cast<QMimeData*>(callbackQPlainTextEdit_CreateMimeDataFromSelection(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery property) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), property)); };
+	bool canInsertFromMimeData(const QMimeData * source) const { return callbackQPlainTextEdit_CanInsertFromMimeData(const_cast<void*>(static_cast<const void*>(this)), const_cast<QMimeData*>(source)) != 0; };
+	bool viewportEvent(QEvent * event) { return callbackQAbstractScrollArea_ViewportEvent(this, event) != 0; };
+	void setupViewport(QWidget * viewport) { callbackQAbstractScrollArea_SetupViewport(this, viewport); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize viewportSizeHint() const { return *static_cast<QSize*>(callbackQAbstractScrollArea_ViewportSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QPlainTextEdit_CreateStandardContextMenu(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->createStandardContextMenu();
+}
+
+void* QPlainTextEdit_LoadResource(void* ptr, int ty, void* name)
+{
+	return new QVariant(static_cast<QPlainTextEdit*>(ptr)->loadResource(ty, *static_cast<QUrl*>(name)));
+}
+
+void* QPlainTextEdit_LoadResourceDefault(void* ptr, int ty, void* name)
+{
+		return new QVariant(static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::loadResource(ty, *static_cast<QUrl*>(name)));
+}
+
+char QPlainTextEdit_Find2(void* ptr, void* exp, long long options)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->find(*static_cast<QRegExp*>(exp), static_cast<QTextDocument::FindFlag>(options));
+}
+
+void* QPlainTextEdit_CreateStandardContextMenu2(void* ptr, void* position)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->createStandardContextMenu(*static_cast<QPoint*>(position));
+}
+
+void* QPlainTextEdit_NewQPlainTextEdit(void* parent)
+{
+	return new MyQPlainTextEdit(static_cast<QWidget*>(parent));
+}
+
+void* QPlainTextEdit_NewQPlainTextEdit2(char* text, void* parent)
+{
+	return new MyQPlainTextEdit(QString(text), static_cast<QWidget*>(parent));
+}
+
+char QPlainTextEdit_Find(void* ptr, char* exp, long long options)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->find(QString(exp), static_cast<QTextDocument::FindFlag>(options));
+}
+
+void QPlainTextEdit_AppendHtml(void* ptr, char* html)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "appendHtml", Q_ARG(QString, QString(html)));
+}
+
+void QPlainTextEdit_AppendHtmlDefault(void* ptr, char* html)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::appendHtml(QString(html));
+}
+
+void QPlainTextEdit_AppendPlainText(void* ptr, char* text)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "appendPlainText", Q_ARG(QString, QString(text)));
+}
+
+void QPlainTextEdit_AppendPlainTextDefault(void* ptr, char* text)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::appendPlainText(QString(text));
+}
+
+void QPlainTextEdit_ConnectBlockCountChanged(void* ptr)
+{
+	QObject::connect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(int)>(&QPlainTextEdit::blockCountChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(int)>(&MyQPlainTextEdit::Signal_BlockCountChanged));
+}
+
+void QPlainTextEdit_DisconnectBlockCountChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(int)>(&QPlainTextEdit::blockCountChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(int)>(&MyQPlainTextEdit::Signal_BlockCountChanged));
+}
+
+void QPlainTextEdit_BlockCountChanged(void* ptr, int newBlockCount)
+{
+	static_cast<QPlainTextEdit*>(ptr)->blockCountChanged(newBlockCount);
+}
+
+void QPlainTextEdit_CenterCursor(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "centerCursor");
+}
+
+void QPlainTextEdit_CenterCursorDefault(void* ptr)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::centerCursor();
+}
+
+void QPlainTextEdit_Clear(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "clear");
+}
+
+void QPlainTextEdit_ClearDefault(void* ptr)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::clear();
+}
+
+void QPlainTextEdit_Copy(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "copy");
+}
+
+void QPlainTextEdit_CopyDefault(void* ptr)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::copy();
+}
+
+void QPlainTextEdit_ConnectCopyAvailable(void* ptr)
+{
+	QObject::connect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(bool)>(&QPlainTextEdit::copyAvailable), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(bool)>(&MyQPlainTextEdit::Signal_CopyAvailable));
+}
+
+void QPlainTextEdit_DisconnectCopyAvailable(void* ptr)
+{
+	QObject::disconnect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(bool)>(&QPlainTextEdit::copyAvailable), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(bool)>(&MyQPlainTextEdit::Signal_CopyAvailable));
+}
+
+void QPlainTextEdit_CopyAvailable(void* ptr, char yes)
+{
+	static_cast<QPlainTextEdit*>(ptr)->copyAvailable(yes != 0);
+}
+
+void QPlainTextEdit_ConnectCursorPositionChanged(void* ptr)
+{
+	QObject::connect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)()>(&QPlainTextEdit::cursorPositionChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)()>(&MyQPlainTextEdit::Signal_CursorPositionChanged));
+}
+
+void QPlainTextEdit_DisconnectCursorPositionChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)()>(&QPlainTextEdit::cursorPositionChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)()>(&MyQPlainTextEdit::Signal_CursorPositionChanged));
+}
+
+void QPlainTextEdit_CursorPositionChanged(void* ptr)
+{
+	static_cast<QPlainTextEdit*>(ptr)->cursorPositionChanged();
+}
+
+void QPlainTextEdit_Cut(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "cut");
+}
+
+void QPlainTextEdit_CutDefault(void* ptr)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::cut();
+}
+
+void QPlainTextEdit_EnsureCursorVisible(void* ptr)
+{
+	static_cast<QPlainTextEdit*>(ptr)->ensureCursorVisible();
+}
+
+void QPlainTextEdit_InsertFromMimeData(void* ptr, void* source)
+{
+	static_cast<QPlainTextEdit*>(ptr)->insertFromMimeData(static_cast<QMimeData*>(source));
+}
+
+void QPlainTextEdit_InsertFromMimeDataDefault(void* ptr, void* source)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::insertFromMimeData(static_cast<QMimeData*>(source));
+}
+
+void QPlainTextEdit_InsertPlainText(void* ptr, char* text)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "insertPlainText", Q_ARG(QString, QString(text)));
+}
+
+void QPlainTextEdit_InsertPlainTextDefault(void* ptr, char* text)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::insertPlainText(QString(text));
+}
+
+void QPlainTextEdit_MergeCurrentCharFormat(void* ptr, void* modifier)
+{
+	static_cast<QPlainTextEdit*>(ptr)->mergeCurrentCharFormat(*static_cast<QTextCharFormat*>(modifier));
+}
+
+void QPlainTextEdit_ConnectModificationChanged(void* ptr)
+{
+	QObject::connect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(bool)>(&QPlainTextEdit::modificationChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(bool)>(&MyQPlainTextEdit::Signal_ModificationChanged));
+}
+
+void QPlainTextEdit_DisconnectModificationChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(bool)>(&QPlainTextEdit::modificationChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(bool)>(&MyQPlainTextEdit::Signal_ModificationChanged));
+}
+
+void QPlainTextEdit_ModificationChanged(void* ptr, char changed)
+{
+	static_cast<QPlainTextEdit*>(ptr)->modificationChanged(changed != 0);
+}
+
+void QPlainTextEdit_MoveCursor(void* ptr, long long operation, long long mode)
+{
+	static_cast<QPlainTextEdit*>(ptr)->moveCursor(static_cast<QTextCursor::MoveOperation>(operation), static_cast<QTextCursor::MoveMode>(mode));
+}
+
+void QPlainTextEdit_Paste(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "paste");
+}
+
+void QPlainTextEdit_PasteDefault(void* ptr)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::paste();
+}
+
+void QPlainTextEdit_Redo(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "redo");
+}
+
+void QPlainTextEdit_RedoDefault(void* ptr)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::redo();
+}
+
+void QPlainTextEdit_ConnectRedoAvailable(void* ptr)
+{
+	QObject::connect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(bool)>(&QPlainTextEdit::redoAvailable), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(bool)>(&MyQPlainTextEdit::Signal_RedoAvailable));
+}
+
+void QPlainTextEdit_DisconnectRedoAvailable(void* ptr)
+{
+	QObject::disconnect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(bool)>(&QPlainTextEdit::redoAvailable), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(bool)>(&MyQPlainTextEdit::Signal_RedoAvailable));
+}
+
+void QPlainTextEdit_RedoAvailable(void* ptr, char available)
+{
+	static_cast<QPlainTextEdit*>(ptr)->redoAvailable(available != 0);
+}
+
+void QPlainTextEdit_SelectAll(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "selectAll");
+}
+
+void QPlainTextEdit_SelectAllDefault(void* ptr)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::selectAll();
+}
+
+void QPlainTextEdit_ConnectSelectionChanged(void* ptr)
+{
+	QObject::connect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)()>(&QPlainTextEdit::selectionChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)()>(&MyQPlainTextEdit::Signal_SelectionChanged));
+}
+
+void QPlainTextEdit_DisconnectSelectionChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)()>(&QPlainTextEdit::selectionChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)()>(&MyQPlainTextEdit::Signal_SelectionChanged));
+}
+
+void QPlainTextEdit_SelectionChanged(void* ptr)
+{
+	static_cast<QPlainTextEdit*>(ptr)->selectionChanged();
+}
+
+void QPlainTextEdit_SetBackgroundVisible(void* ptr, char visible)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setBackgroundVisible(visible != 0);
+}
+
+void QPlainTextEdit_SetCenterOnScroll(void* ptr, char enabled)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setCenterOnScroll(enabled != 0);
+}
+
+void QPlainTextEdit_SetCurrentCharFormat(void* ptr, void* format)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setCurrentCharFormat(*static_cast<QTextCharFormat*>(format));
+}
+
+void QPlainTextEdit_SetCursorWidth(void* ptr, int width)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setCursorWidth(width);
+}
+
+void QPlainTextEdit_SetDocument(void* ptr, void* document)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setDocument(static_cast<QTextDocument*>(document));
+}
+
+void QPlainTextEdit_SetDocumentTitle(void* ptr, char* title)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setDocumentTitle(QString(title));
+}
+
+void QPlainTextEdit_SetLineWrapMode(void* ptr, long long mode)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setLineWrapMode(static_cast<QPlainTextEdit::LineWrapMode>(mode));
+}
+
+void QPlainTextEdit_SetMaximumBlockCount(void* ptr, int maximum)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setMaximumBlockCount(maximum);
+}
+
+void QPlainTextEdit_SetOverwriteMode(void* ptr, char overwrite)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setOverwriteMode(overwrite != 0);
+}
+
+void QPlainTextEdit_SetPlaceholderText(void* ptr, char* placeholderText)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setPlaceholderText(QString(placeholderText));
+}
+
+void QPlainTextEdit_SetPlainText(void* ptr, char* text)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "setPlainText", Q_ARG(QString, QString(text)));
+}
+
+void QPlainTextEdit_SetPlainTextDefault(void* ptr, char* text)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::setPlainText(QString(text));
+}
+
+void QPlainTextEdit_SetReadOnly(void* ptr, char ro)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setReadOnly(ro != 0);
+}
+
+void QPlainTextEdit_SetTabChangesFocus(void* ptr, char b)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setTabChangesFocus(b != 0);
+}
+
+void QPlainTextEdit_SetTabStopWidth(void* ptr, int width)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setTabStopWidth(width);
+}
+
+void QPlainTextEdit_SetTextCursor(void* ptr, void* cursor)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setTextCursor(*static_cast<QTextCursor*>(cursor));
+}
+
+void QPlainTextEdit_SetTextInteractionFlags(void* ptr, long long flags)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setTextInteractionFlags(static_cast<Qt::TextInteractionFlag>(flags));
+}
+
+void QPlainTextEdit_SetUndoRedoEnabled(void* ptr, char enable)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setUndoRedoEnabled(enable != 0);
+}
+
+void QPlainTextEdit_SetWordWrapMode(void* ptr, long long policy)
+{
+	static_cast<QPlainTextEdit*>(ptr)->setWordWrapMode(static_cast<QTextOption::WrapMode>(policy));
+}
+
+void QPlainTextEdit_ConnectTextChanged(void* ptr)
+{
+	QObject::connect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)()>(&QPlainTextEdit::textChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)()>(&MyQPlainTextEdit::Signal_TextChanged));
+}
+
+void QPlainTextEdit_DisconnectTextChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)()>(&QPlainTextEdit::textChanged), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)()>(&MyQPlainTextEdit::Signal_TextChanged));
+}
+
+void QPlainTextEdit_TextChanged(void* ptr)
+{
+	static_cast<QPlainTextEdit*>(ptr)->textChanged();
+}
+
+void QPlainTextEdit_Undo(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "undo");
+}
+
+void QPlainTextEdit_UndoDefault(void* ptr)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::undo();
+}
+
+void QPlainTextEdit_ConnectUndoAvailable(void* ptr)
+{
+	QObject::connect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(bool)>(&QPlainTextEdit::undoAvailable), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(bool)>(&MyQPlainTextEdit::Signal_UndoAvailable));
+}
+
+void QPlainTextEdit_DisconnectUndoAvailable(void* ptr)
+{
+	QObject::disconnect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(bool)>(&QPlainTextEdit::undoAvailable), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(bool)>(&MyQPlainTextEdit::Signal_UndoAvailable));
+}
+
+void QPlainTextEdit_UndoAvailable(void* ptr, char available)
+{
+	static_cast<QPlainTextEdit*>(ptr)->undoAvailable(available != 0);
+}
+
+void QPlainTextEdit_ConnectUpdateRequest(void* ptr)
+{
+	QObject::connect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(const QRect &, int)>(&QPlainTextEdit::updateRequest), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(const QRect &, int)>(&MyQPlainTextEdit::Signal_UpdateRequest));
+}
+
+void QPlainTextEdit_DisconnectUpdateRequest(void* ptr)
+{
+	QObject::disconnect(static_cast<QPlainTextEdit*>(ptr), static_cast<void (QPlainTextEdit::*)(const QRect &, int)>(&QPlainTextEdit::updateRequest), static_cast<MyQPlainTextEdit*>(ptr), static_cast<void (MyQPlainTextEdit::*)(const QRect &, int)>(&MyQPlainTextEdit::Signal_UpdateRequest));
+}
+
+void QPlainTextEdit_UpdateRequest(void* ptr, void* rect, int dy)
+{
+	static_cast<QPlainTextEdit*>(ptr)->updateRequest(*static_cast<QRect*>(rect), dy);
+}
+
+void QPlainTextEdit_ZoomIn(void* ptr, int ran)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "zoomIn", Q_ARG(int, ran));
+}
+
+void QPlainTextEdit_ZoomInDefault(void* ptr, int ran)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::zoomIn(ran);
+}
+
+void QPlainTextEdit_ZoomOut(void* ptr, int ran)
+{
+	QMetaObject::invokeMethod(static_cast<QPlainTextEdit*>(ptr), "zoomOut", Q_ARG(int, ran));
+}
+
+void QPlainTextEdit_ZoomOutDefault(void* ptr, int ran)
+{
+		static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::zoomOut(ran);
+}
+
+void QPlainTextEdit_DestroyQPlainTextEdit(void* ptr)
+{
+	static_cast<QPlainTextEdit*>(ptr)->~QPlainTextEdit();
+}
+
+void QPlainTextEdit_DestroyQPlainTextEditDefault(void* ptr)
+{
+
+}
+
+long long QPlainTextEdit_LineWrapMode(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->lineWrapMode();
+}
+
+void* QPlainTextEdit_CreateMimeDataFromSelection(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->createMimeDataFromSelection();
+}
+
+void* QPlainTextEdit_CreateMimeDataFromSelectionDefault(void* ptr)
+{
+		return static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::createMimeDataFromSelection();
+}
+
+void* QPlainTextEdit_ContentOffset(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QPlainTextEdit*>(ptr)->contentOffset(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QPlainTextEdit_CursorRect2(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QPlainTextEdit*>(ptr)->cursorRect(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QPlainTextEdit_CursorRect(void* ptr, void* cursor)
+{
+	return ({ QRect tmpValue = static_cast<QPlainTextEdit*>(ptr)->cursorRect(*static_cast<QTextCursor*>(cursor)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QPlainTextEdit_BlockBoundingGeometry(void* ptr, void* block)
+{
+	return ({ QRectF tmpValue = static_cast<QPlainTextEdit*>(ptr)->blockBoundingGeometry(*static_cast<QTextBlock*>(block)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QPlainTextEdit_BlockBoundingRect(void* ptr, void* block)
+{
+	return ({ QRectF tmpValue = static_cast<QPlainTextEdit*>(ptr)->blockBoundingRect(*static_cast<QTextBlock*>(block)); new QRectF(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+struct QtWidgets_PackedString QPlainTextEdit_AnchorAt(void* ptr, void* pos)
+{
+	return ({ QByteArray t8a0984 = static_cast<QPlainTextEdit*>(ptr)->anchorAt(*static_cast<QPoint*>(pos)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t8a0984.prepend("WHITESPACE").constData()+10), t8a0984.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QPlainTextEdit_DocumentTitle(void* ptr)
+{
+	return ({ QByteArray tba0a66 = static_cast<QPlainTextEdit*>(ptr)->documentTitle().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tba0a66.prepend("WHITESPACE").constData()+10), tba0a66.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QPlainTextEdit_PlaceholderText(void* ptr)
+{
+	return ({ QByteArray tb4d3fc = static_cast<QPlainTextEdit*>(ptr)->placeholderText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tb4d3fc.prepend("WHITESPACE").constData()+10), tb4d3fc.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QPlainTextEdit_ToPlainText(void* ptr)
+{
+	return ({ QByteArray t3c8ca8 = static_cast<QPlainTextEdit*>(ptr)->toPlainText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t3c8ca8.prepend("WHITESPACE").constData()+10), t3c8ca8.size()-10 }; });
+}
+
+void* QPlainTextEdit_FirstVisibleBlock(void* ptr)
+{
+	return new QTextBlock(static_cast<QPlainTextEdit*>(ptr)->firstVisibleBlock());
+}
+
+void* QPlainTextEdit_CurrentCharFormat(void* ptr)
+{
+	return new QTextCharFormat(static_cast<QPlainTextEdit*>(ptr)->currentCharFormat());
+}
+
+void* QPlainTextEdit_CursorForPosition(void* ptr, void* pos)
+{
+	return new QTextCursor(static_cast<QPlainTextEdit*>(ptr)->cursorForPosition(*static_cast<QPoint*>(pos)));
+}
+
+void* QPlainTextEdit_TextCursor(void* ptr)
+{
+	return new QTextCursor(static_cast<QPlainTextEdit*>(ptr)->textCursor());
+}
+
+void* QPlainTextEdit_Document(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->document();
+}
+
+long long QPlainTextEdit_WordWrapMode(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->wordWrapMode();
+}
+
+long long QPlainTextEdit_TextInteractionFlags(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->textInteractionFlags();
+}
+
+char QPlainTextEdit_BackgroundVisible(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->backgroundVisible();
+}
+
+char QPlainTextEdit_CanInsertFromMimeData(void* ptr, void* source)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->canInsertFromMimeData(static_cast<QMimeData*>(source));
+}
+
+char QPlainTextEdit_CanInsertFromMimeDataDefault(void* ptr, void* source)
+{
+		return static_cast<QPlainTextEdit*>(ptr)->QPlainTextEdit::canInsertFromMimeData(static_cast<QMimeData*>(source));
+}
+
+char QPlainTextEdit_CanPaste(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->canPaste();
+}
+
+char QPlainTextEdit_CenterOnScroll(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->centerOnScroll();
+}
+
+char QPlainTextEdit_IsReadOnly(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->isReadOnly();
+}
+
+char QPlainTextEdit_IsUndoRedoEnabled(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->isUndoRedoEnabled();
+}
+
+char QPlainTextEdit_OverwriteMode(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->overwriteMode();
+}
+
+char QPlainTextEdit_TabChangesFocus(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->tabChangesFocus();
+}
+
+int QPlainTextEdit_BlockCount(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->blockCount();
+}
+
+int QPlainTextEdit_CursorWidth(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->cursorWidth();
+}
+
+int QPlainTextEdit_MaximumBlockCount(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->maximumBlockCount();
+}
+
+int QPlainTextEdit_TabStopWidth(void* ptr)
+{
+	return static_cast<QPlainTextEdit*>(ptr)->tabStopWidth();
+}
+
+void QPlainTextEdit_Print(void* ptr, void* printer)
+{
+#ifndef Q_OS_IOS
+	static_cast<QPlainTextEdit*>(ptr)->print(static_cast<QPagedPaintDevice*>(printer));
+#endif
+}
+
+class MyQProgressBar: public QProgressBar
+{
+public:
+	MyQProgressBar(QWidget *parent) : QProgressBar(parent) {};
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	void reset() { callbackQProgressBar_Reset(this); };
+	void setMaximum(int maximum) { callbackQProgressBar_SetMaximum(this, maximum); };
+	void setMinimum(int minimum) { callbackQProgressBar_SetMinimum(this, minimum); };
+	void setOrientation(Qt::Orientation vqt) { callbackQProgressBar_SetOrientation(this, vqt); };
+	void setRange(int minimum, int maximum) { callbackQProgressBar_SetRange(this, minimum, maximum); };
+	void setValue(int value) { callbackQProgressBar_SetValue(this, value); };
+	void Signal_ValueChanged(int value) { callbackQProgressBar_ValueChanged(this, value); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QString text() const { return QString(callbackQProgressBar_Text(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QProgressBar_NewQProgressBar(void* parent)
+{
+	return new MyQProgressBar(static_cast<QWidget*>(parent));
+}
+
+void QProgressBar_Reset(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressBar*>(ptr), "reset");
+}
+
+void QProgressBar_ResetDefault(void* ptr)
+{
+		static_cast<QProgressBar*>(ptr)->QProgressBar::reset();
+}
+
+void QProgressBar_ResetFormat(void* ptr)
+{
+	static_cast<QProgressBar*>(ptr)->resetFormat();
+}
+
+void QProgressBar_SetAlignment(void* ptr, long long alignment)
+{
+	static_cast<QProgressBar*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+void QProgressBar_SetFormat(void* ptr, char* format)
+{
+	static_cast<QProgressBar*>(ptr)->setFormat(QString(format));
+}
+
+void QProgressBar_SetInvertedAppearance(void* ptr, char invert)
+{
+	static_cast<QProgressBar*>(ptr)->setInvertedAppearance(invert != 0);
+}
+
+void QProgressBar_SetMaximum(void* ptr, int maximum)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressBar*>(ptr), "setMaximum", Q_ARG(int, maximum));
+}
+
+void QProgressBar_SetMaximumDefault(void* ptr, int maximum)
+{
+		static_cast<QProgressBar*>(ptr)->QProgressBar::setMaximum(maximum);
+}
+
+void QProgressBar_SetMinimum(void* ptr, int minimum)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressBar*>(ptr), "setMinimum", Q_ARG(int, minimum));
+}
+
+void QProgressBar_SetMinimumDefault(void* ptr, int minimum)
+{
+		static_cast<QProgressBar*>(ptr)->QProgressBar::setMinimum(minimum);
+}
+
+void QProgressBar_SetOrientation(void* ptr, long long vqt)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressBar*>(ptr), "setOrientation", Q_ARG(Qt::Orientation, static_cast<Qt::Orientation>(vqt)));
+}
+
+void QProgressBar_SetOrientationDefault(void* ptr, long long vqt)
+{
+		static_cast<QProgressBar*>(ptr)->QProgressBar::setOrientation(static_cast<Qt::Orientation>(vqt));
+}
+
+void QProgressBar_SetRange(void* ptr, int minimum, int maximum)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressBar*>(ptr), "setRange", Q_ARG(int, minimum), Q_ARG(int, maximum));
+}
+
+void QProgressBar_SetRangeDefault(void* ptr, int minimum, int maximum)
+{
+		static_cast<QProgressBar*>(ptr)->QProgressBar::setRange(minimum, maximum);
+}
+
+void QProgressBar_SetTextDirection(void* ptr, long long textDirection)
+{
+	static_cast<QProgressBar*>(ptr)->setTextDirection(static_cast<QProgressBar::Direction>(textDirection));
+}
+
+void QProgressBar_SetTextVisible(void* ptr, char visible)
+{
+	static_cast<QProgressBar*>(ptr)->setTextVisible(visible != 0);
+}
+
+void QProgressBar_SetValue(void* ptr, int value)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressBar*>(ptr), "setValue", Q_ARG(int, value));
+}
+
+void QProgressBar_SetValueDefault(void* ptr, int value)
+{
+		static_cast<QProgressBar*>(ptr)->QProgressBar::setValue(value);
+}
+
+void QProgressBar_ConnectValueChanged(void* ptr)
+{
+	QObject::connect(static_cast<QProgressBar*>(ptr), static_cast<void (QProgressBar::*)(int)>(&QProgressBar::valueChanged), static_cast<MyQProgressBar*>(ptr), static_cast<void (MyQProgressBar::*)(int)>(&MyQProgressBar::Signal_ValueChanged));
+}
+
+void QProgressBar_DisconnectValueChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QProgressBar*>(ptr), static_cast<void (QProgressBar::*)(int)>(&QProgressBar::valueChanged), static_cast<MyQProgressBar*>(ptr), static_cast<void (MyQProgressBar::*)(int)>(&MyQProgressBar::Signal_ValueChanged));
+}
+
+void QProgressBar_ValueChanged(void* ptr, int value)
+{
+	static_cast<QProgressBar*>(ptr)->valueChanged(value);
+}
+
+void QProgressBar_DestroyQProgressBar(void* ptr)
+{
+	static_cast<QProgressBar*>(ptr)->~QProgressBar();
+}
+
+long long QProgressBar_TextDirection(void* ptr)
+{
+	return static_cast<QProgressBar*>(ptr)->textDirection();
+}
+
+struct QtWidgets_PackedString QProgressBar_Format(void* ptr)
+{
+	return ({ QByteArray tfbdd88 = static_cast<QProgressBar*>(ptr)->format().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tfbdd88.prepend("WHITESPACE").constData()+10), tfbdd88.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QProgressBar_Text(void* ptr)
+{
+	return ({ QByteArray tffaa7f = static_cast<QProgressBar*>(ptr)->text().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tffaa7f.prepend("WHITESPACE").constData()+10), tffaa7f.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QProgressBar_TextDefault(void* ptr)
+{
+		return ({ QByteArray t6f1b9c = static_cast<QProgressBar*>(ptr)->QProgressBar::text().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t6f1b9c.prepend("WHITESPACE").constData()+10), t6f1b9c.size()-10 }; });
+}
+
+long long QProgressBar_Alignment(void* ptr)
+{
+	return static_cast<QProgressBar*>(ptr)->alignment();
+}
+
+long long QProgressBar_Orientation(void* ptr)
+{
+	return static_cast<QProgressBar*>(ptr)->orientation();
+}
+
+char QProgressBar_InvertedAppearance(void* ptr)
+{
+	return static_cast<QProgressBar*>(ptr)->invertedAppearance();
+}
+
+char QProgressBar_IsTextVisible(void* ptr)
+{
+	return static_cast<QProgressBar*>(ptr)->isTextVisible();
+}
+
+int QProgressBar_Maximum(void* ptr)
+{
+	return static_cast<QProgressBar*>(ptr)->maximum();
+}
+
+int QProgressBar_Minimum(void* ptr)
+{
+	return static_cast<QProgressBar*>(ptr)->minimum();
+}
+
+int QProgressBar_Value(void* ptr)
+{
+	return static_cast<QProgressBar*>(ptr)->value();
+}
+
+void QProgressBar_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QProgressBar*>(ptr)->initStyleOption(static_cast<QStyleOptionProgressBar*>(option));
+}
+
+class MyQProgressDialog: public QProgressDialog
+{
+public:
+	MyQProgressDialog(QWidget *parent, Qt::WindowFlags f) : QProgressDialog(parent, f) {};
+	MyQProgressDialog(const QString &labelText, const QString &cancelButtonText, int minimum, int maximum, QWidget *parent, Qt::WindowFlags f) : QProgressDialog(labelText, cancelButtonText, minimum, maximum, parent, f) {};
+	void cancel() { callbackQProgressDialog_Cancel(this); };
+	void Signal_Canceled() { callbackQProgressDialog_Canceled(this); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void closeEvent(QCloseEvent * e) { callbackQWidget_CloseEvent(this, e); };
+	void forceShow() { callbackQProgressDialog_ForceShow(this); };
+	void reset() { callbackQProgressDialog_Reset(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setCancelButtonText(const QString & cancelButtonText) { QByteArray td2e1e2 = cancelButtonText.toUtf8(); QtWidgets_PackedString cancelButtonTextPacked = { const_cast<char*>(td2e1e2.prepend("WHITESPACE").constData()+10), td2e1e2.size()-10 };callbackQProgressDialog_SetCancelButtonText(this, cancelButtonTextPacked); };
+	void setLabelText(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQProgressDialog_SetLabelText(this, textPacked); };
+	void setMaximum(int maximum) { callbackQProgressDialog_SetMaximum(this, maximum); };
+	void setMinimum(int minimum) { callbackQProgressDialog_SetMinimum(this, minimum); };
+	void setMinimumDuration(int ms) { callbackQProgressDialog_SetMinimumDuration(this, ms); };
+	void setRange(int minimum, int maximum) { callbackQProgressDialog_SetRange(this, minimum, maximum); };
+	void setValue(int progress) { callbackQProgressDialog_SetValue(this, progress); };
+	void showEvent(QShowEvent * e) { callbackQWidget_ShowEvent(this, e); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	int exec() { return callbackQDialog_Exec(this); };
+	void accept() { callbackQDialog_Accept(this); };
+	void Signal_Accepted() { callbackQDialog_Accepted(this); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void done(int r) { callbackQDialog_Done(this, r); };
+	void Signal_Finished(int result) { callbackQDialog_Finished(this, result); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void open() { callbackQDialog_Open(this); };
+	void reject() { callbackQDialog_Reject(this); };
+	void Signal_Rejected() { callbackQDialog_Rejected(this); };
+	void setVisible(bool visible) { callbackQDialog_SetVisible(this, visible); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QProgressDialog_NewQProgressDialog(void* parent, long long f)
+{
+	return new MyQProgressDialog(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(f));
+}
+
+void* QProgressDialog_NewQProgressDialog2(char* labelText, char* cancelButtonText, int minimum, int maximum, void* parent, long long f)
+{
+	return new MyQProgressDialog(QString(labelText), QString(cancelButtonText), minimum, maximum, static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(f));
+}
+
+void QProgressDialog_Cancel(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "cancel");
+}
+
+void QProgressDialog_CancelDefault(void* ptr)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::cancel();
+}
+
+void QProgressDialog_ConnectCanceled(void* ptr)
+{
+	QObject::connect(static_cast<QProgressDialog*>(ptr), static_cast<void (QProgressDialog::*)()>(&QProgressDialog::canceled), static_cast<MyQProgressDialog*>(ptr), static_cast<void (MyQProgressDialog::*)()>(&MyQProgressDialog::Signal_Canceled));
+}
+
+void QProgressDialog_DisconnectCanceled(void* ptr)
+{
+	QObject::disconnect(static_cast<QProgressDialog*>(ptr), static_cast<void (QProgressDialog::*)()>(&QProgressDialog::canceled), static_cast<MyQProgressDialog*>(ptr), static_cast<void (MyQProgressDialog::*)()>(&MyQProgressDialog::Signal_Canceled));
+}
+
+void QProgressDialog_Canceled(void* ptr)
+{
+	static_cast<QProgressDialog*>(ptr)->canceled();
+}
+
+void QProgressDialog_ForceShow(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "forceShow");
+}
+
+void QProgressDialog_ForceShowDefault(void* ptr)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::forceShow();
+}
+
+void QProgressDialog_Open(void* ptr, void* receiver, char* member)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(receiver))) {
+		static_cast<QProgressDialog*>(ptr)->open(static_cast<QGraphicsObject*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QProgressDialog*>(ptr)->open(static_cast<QGraphicsWidget*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(receiver))) {
+		static_cast<QProgressDialog*>(ptr)->open(static_cast<QLayout*>(receiver), const_cast<const char*>(member));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(receiver))) {
+		static_cast<QProgressDialog*>(ptr)->open(static_cast<QWidget*>(receiver), const_cast<const char*>(member));
+	} else {
+		static_cast<QProgressDialog*>(ptr)->open(static_cast<QObject*>(receiver), const_cast<const char*>(member));
+	}
+}
+
+void QProgressDialog_Reset(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "reset");
+}
+
+void QProgressDialog_ResetDefault(void* ptr)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::reset();
+}
+
+void QProgressDialog_SetAutoClose(void* ptr, char close)
+{
+	static_cast<QProgressDialog*>(ptr)->setAutoClose(close != 0);
+}
+
+void QProgressDialog_SetAutoReset(void* ptr, char reset)
+{
+	static_cast<QProgressDialog*>(ptr)->setAutoReset(reset != 0);
+}
+
+void QProgressDialog_SetBar(void* ptr, void* bar)
+{
+	static_cast<QProgressDialog*>(ptr)->setBar(static_cast<QProgressBar*>(bar));
+}
+
+void QProgressDialog_SetCancelButton(void* ptr, void* cancelButton)
+{
+	static_cast<QProgressDialog*>(ptr)->setCancelButton(static_cast<QPushButton*>(cancelButton));
+}
+
+void QProgressDialog_SetCancelButtonText(void* ptr, char* cancelButtonText)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "setCancelButtonText", Q_ARG(QString, QString(cancelButtonText)));
+}
+
+void QProgressDialog_SetCancelButtonTextDefault(void* ptr, char* cancelButtonText)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::setCancelButtonText(QString(cancelButtonText));
+}
+
+void QProgressDialog_SetLabel(void* ptr, void* label)
+{
+	static_cast<QProgressDialog*>(ptr)->setLabel(static_cast<QLabel*>(label));
+}
+
+void QProgressDialog_SetLabelText(void* ptr, char* text)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "setLabelText", Q_ARG(QString, QString(text)));
+}
+
+void QProgressDialog_SetLabelTextDefault(void* ptr, char* text)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::setLabelText(QString(text));
+}
+
+void QProgressDialog_SetMaximum(void* ptr, int maximum)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "setMaximum", Q_ARG(int, maximum));
+}
+
+void QProgressDialog_SetMaximumDefault(void* ptr, int maximum)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::setMaximum(maximum);
+}
+
+void QProgressDialog_SetMinimum(void* ptr, int minimum)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "setMinimum", Q_ARG(int, minimum));
+}
+
+void QProgressDialog_SetMinimumDefault(void* ptr, int minimum)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::setMinimum(minimum);
+}
+
+void QProgressDialog_SetMinimumDuration(void* ptr, int ms)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "setMinimumDuration", Q_ARG(int, ms));
+}
+
+void QProgressDialog_SetMinimumDurationDefault(void* ptr, int ms)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::setMinimumDuration(ms);
+}
+
+void QProgressDialog_SetRange(void* ptr, int minimum, int maximum)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "setRange", Q_ARG(int, minimum), Q_ARG(int, maximum));
+}
+
+void QProgressDialog_SetRangeDefault(void* ptr, int minimum, int maximum)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::setRange(minimum, maximum);
+}
+
+void QProgressDialog_SetValue(void* ptr, int progress)
+{
+	QMetaObject::invokeMethod(static_cast<QProgressDialog*>(ptr), "setValue", Q_ARG(int, progress));
+}
+
+void QProgressDialog_SetValueDefault(void* ptr, int progress)
+{
+		static_cast<QProgressDialog*>(ptr)->QProgressDialog::setValue(progress);
+}
+
+void QProgressDialog_DestroyQProgressDialog(void* ptr)
+{
+	static_cast<QProgressDialog*>(ptr)->~QProgressDialog();
+}
+
+struct QtWidgets_PackedString QProgressDialog_LabelText(void* ptr)
+{
+	return ({ QByteArray t2a151b = static_cast<QProgressDialog*>(ptr)->labelText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t2a151b.prepend("WHITESPACE").constData()+10), t2a151b.size()-10 }; });
+}
+
+char QProgressDialog_AutoClose(void* ptr)
+{
+	return static_cast<QProgressDialog*>(ptr)->autoClose();
+}
+
+char QProgressDialog_AutoReset(void* ptr)
+{
+	return static_cast<QProgressDialog*>(ptr)->autoReset();
+}
+
+char QProgressDialog_WasCanceled(void* ptr)
+{
+	return static_cast<QProgressDialog*>(ptr)->wasCanceled();
+}
+
+int QProgressDialog_Maximum(void* ptr)
+{
+	return static_cast<QProgressDialog*>(ptr)->maximum();
+}
+
+int QProgressDialog_Minimum(void* ptr)
+{
+	return static_cast<QProgressDialog*>(ptr)->minimum();
+}
+
+int QProgressDialog_MinimumDuration(void* ptr)
+{
+	return static_cast<QProgressDialog*>(ptr)->minimumDuration();
+}
+
+int QProgressDialog_Value(void* ptr)
+{
+	return static_cast<QProgressDialog*>(ptr)->value();
+}
+
+class MyQProxyStyle: public QProxyStyle
+{
+public:
+	MyQProxyStyle(QStyle *style) : QProxyStyle(style) {};
+	MyQProxyStyle(const QString &key) : QProxyStyle(key) {};
+	void polish(QApplication * app) { callbackQStyle_Polish3(this, app); };
+	void polish(QPalette & pal) { callbackQStyle_Polish2(this, static_cast<QPalette*>(&pal)); };
+	void polish(QWidget * widget) { callbackQStyle_Polish(this, widget); };
+	void unpolish(QApplication * app) { callbackQStyle_Unpolish2(this, app); };
+	void unpolish(QWidget * widget) { callbackQStyle_Unpolish(this, widget); };
+	QIcon standardIcon(QStyle::StandardPixmap standardIcon, const QStyleOption * option, const QWidget * widget) const { return *static_cast<QIcon*>(callbackQProxyStyle_StandardIcon(const_cast<void*>(static_cast<const void*>(this)), standardIcon, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget))); };
+	QPalette standardPalette() const { return *static_cast<QPalette*>(callbackQStyle_StandardPalette(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPixmap generatedIconPixmap(QIcon::Mode iconMode, const QPixmap & pixmap, const QStyleOption * opt) const { return *static_cast<QPixmap*>(callbackQCommonStyle_GeneratedIconPixmap(const_cast<void*>(static_cast<const void*>(this)), iconMode, const_cast<QPixmap*>(&pixmap), const_cast<QStyleOption*>(opt))); };
+	QPixmap standardPixmap(QStyle::StandardPixmap standardPixmap, const QStyleOption * opt, const QWidget * widget) const { return *static_cast<QPixmap*>(callbackQCommonStyle_StandardPixmap(const_cast<void*>(static_cast<const void*>(this)), standardPixmap, const_cast<QStyleOption*>(opt), const_cast<QWidget*>(widget))); };
+	QRect itemPixmapRect(const QRect & r, int flags, const QPixmap & pixmap) const { return *static_cast<QRect*>(callbackQStyle_ItemPixmapRect(const_cast<void*>(static_cast<const void*>(this)), const_cast<QRect*>(&r), flags, const_cast<QPixmap*>(&pixmap))); };
+	QRect itemTextRect(const QFontMetrics & fm, const QRect & r, int flags, bool enabled, const QString & text) const { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };return *static_cast<QRect*>(callbackQStyle_ItemTextRect(const_cast<void*>(static_cast<const void*>(this)), const_cast<QFontMetrics*>(&fm), const_cast<QRect*>(&r), flags, enabled, textPacked)); };
+	QRect subControlRect(QStyle::ComplexControl cc, const QStyleOptionComplex * option, QStyle::SubControl sc, const QWidget * widget) const { return *static_cast<QRect*>(callbackQCommonStyle_SubControlRect(const_cast<void*>(static_cast<const void*>(this)), cc, const_cast<QStyleOptionComplex*>(option), sc, const_cast<QWidget*>(widget))); };
+	QRect subElementRect(QStyle::SubElement element, const QStyleOption * option, const QWidget * widget) const { return *static_cast<QRect*>(callbackQCommonStyle_SubElementRect(const_cast<void*>(static_cast<const void*>(this)), element, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget))); };
+	QSize sizeFromContents(QStyle::ContentsType ty, const QStyleOption * option, const QSize & size, const QWidget * widget) const { return *static_cast<QSize*>(callbackQCommonStyle_SizeFromContents(const_cast<void*>(static_cast<const void*>(this)), ty, const_cast<QStyleOption*>(option), const_cast<QSize*>(&size), const_cast<QWidget*>(widget))); };
+	SubControl hitTestComplexControl(QStyle::ComplexControl control, const QStyleOptionComplex * option, const QPoint & pos, const QWidget * widget) const { return static_cast<QStyle::SubControl>(callbackQCommonStyle_HitTestComplexControl(const_cast<void*>(static_cast<const void*>(this)), control, const_cast<QStyleOptionComplex*>(option), const_cast<QPoint*>(&pos), const_cast<QWidget*>(widget))); };
+	int layoutSpacing(QSizePolicy::ControlType control1, QSizePolicy::ControlType control2, Qt::Orientation orientation, const QStyleOption * option, const QWidget * widget) const { return callbackQCommonStyle_LayoutSpacing(const_cast<void*>(static_cast<const void*>(this)), control1, control2, orientation, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget)); };
+	int pixelMetric(QStyle::PixelMetric metric, const QStyleOption * option, const QWidget * widget) const { return callbackQCommonStyle_PixelMetric(const_cast<void*>(static_cast<const void*>(this)), metric, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget)); };
+	int styleHint(QStyle::StyleHint hint, const QStyleOption * option, const QWidget * widget, QStyleHintReturn * returnData) const { return callbackQCommonStyle_StyleHint(const_cast<void*>(static_cast<const void*>(this)), hint, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget), returnData); };
+	void drawComplexControl(QStyle::ComplexControl control, const QStyleOptionComplex * option, QPainter * painter, const QWidget * widget) const { callbackQCommonStyle_DrawComplexControl(const_cast<void*>(static_cast<const void*>(this)), control, const_cast<QStyleOptionComplex*>(option), painter, const_cast<QWidget*>(widget)); };
+	void drawControl(QStyle::ControlElement element, const QStyleOption * option, QPainter * painter, const QWidget * widget) const { callbackQCommonStyle_DrawControl(const_cast<void*>(static_cast<const void*>(this)), element, const_cast<QStyleOption*>(option), painter, const_cast<QWidget*>(widget)); };
+	void drawItemPixmap(QPainter * painter, const QRect & rect, int alignment, const QPixmap & pixmap) const { callbackQStyle_DrawItemPixmap(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QRect*>(&rect), alignment, const_cast<QPixmap*>(&pixmap)); };
+	void drawItemText(QPainter * painter, const QRect & rect, int flags, const QPalette & pal, bool enabled, const QString & text, QPalette::ColorRole textRole) const { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQStyle_DrawItemText(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QRect*>(&rect), flags, const_cast<QPalette*>(&pal), enabled, textPacked, textRole); };
+	void drawPrimitive(QStyle::PrimitiveElement element, const QStyleOption * option, QPainter * painter, const QWidget * widget) const { callbackQCommonStyle_DrawPrimitive(const_cast<void*>(static_cast<const void*>(this)), element, const_cast<QStyleOption*>(option), painter, const_cast<QWidget*>(widget)); };
+	bool event(QEvent * e) { return callbackQStyle_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQStyle_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQStyle_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQStyle_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQStyle_CustomEvent(this, event); };
+	void deleteLater() { callbackQStyle_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQStyle_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQStyle_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQStyle_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQStyle_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQStyle_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QProxyStyle_NewQProxyStyle(void* style)
+{
+	return new MyQProxyStyle(static_cast<QStyle*>(style));
+}
+
+void* QProxyStyle_NewQProxyStyle2(char* key)
+{
+	return new MyQProxyStyle(QString(key));
+}
+
+void QProxyStyle_SetBaseStyle(void* ptr, void* style)
+{
+	static_cast<QProxyStyle*>(ptr)->setBaseStyle(static_cast<QStyle*>(style));
+}
+
+void QProxyStyle_DestroyQProxyStyle(void* ptr)
+{
+	static_cast<QProxyStyle*>(ptr)->~QProxyStyle();
+}
+
+void* QProxyStyle_StandardIcon(void* ptr, long long standardIcon, void* option, void* widget)
+{
+		return new QIcon(static_cast<QProxyStyle*>(ptr)->standardIcon(static_cast<QStyle::StandardPixmap>(standardIcon), static_cast<QStyleOption*>(option), static_cast<QWidget*>(widget)));
+}
+
+void* QProxyStyle_StandardIconDefault(void* ptr, long long standardIcon, void* option, void* widget)
+{
+		return new QIcon(static_cast<QProxyStyle*>(ptr)->QProxyStyle::standardIcon(static_cast<QStyle::StandardPixmap>(standardIcon), static_cast<QStyleOption*>(option), static_cast<QWidget*>(widget)));
+}
+
+void* QProxyStyle_BaseStyle(void* ptr)
+{
+	return static_cast<QProxyStyle*>(ptr)->baseStyle();
+}
+
+class MyQPushButton: public QPushButton
+{
+public:
+	MyQPushButton(QWidget *parent) : QPushButton(parent) {};
+	MyQPushButton(const QIcon &icon, const QString &text, QWidget *parent) : QPushButton(icon, text, parent) {};
+	MyQPushButton(const QString &text, QWidget *parent) : QPushButton(text, parent) {};
+	void focusInEvent(QFocusEvent * e) { callbackQWidget_FocusInEvent(this, e); };
+	void focusOutEvent(QFocusEvent * e) { callbackQWidget_FocusOutEvent(this, e); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void paintEvent(QPaintEvent * vqp) { callbackQPushButton_PaintEvent(this, vqp); };
+	void showMenu() { callbackQPushButton_ShowMenu(this); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void animateClick(int msec) { callbackQAbstractButton_AnimateClick(this, msec); };
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void checkStateSet() { callbackQAbstractButton_CheckStateSet(this); };
+	void click() { callbackQAbstractButton_Click(this); };
+	void Signal_Clicked(bool checked) { callbackQAbstractButton_Clicked(this, checked); };
+	void keyReleaseEvent(QKeyEvent * e) { callbackQWidget_KeyReleaseEvent(this, e); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void nextCheckState() { callbackQAbstractButton_NextCheckState(this); };
+	void Signal_Pressed() { callbackQAbstractButton_Pressed(this); };
+	void Signal_Released() { callbackQAbstractButton_Released(this); };
+	void setChecked(bool vbo) { callbackQAbstractButton_SetChecked(this, vbo); };
+	void setIconSize(const QSize & size) { callbackQAbstractButton_SetIconSize(this, const_cast<QSize*>(&size)); };
+	void toggle() { callbackQAbstractButton_Toggle(this); };
+	void Signal_Toggled(bool checked) { callbackQAbstractButton_Toggled(this, checked); };
+	bool hitButton(const QPoint & pos) const { return callbackQAbstractButton_HitButton(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPoint*>(&pos)) != 0; };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QPushButton_NewQPushButton(void* parent)
+{
+	return new MyQPushButton(static_cast<QWidget*>(parent));
+}
+
+void* QPushButton_NewQPushButton3(void* icon, char* text, void* parent)
+{
+	return new MyQPushButton(*static_cast<QIcon*>(icon), QString(text), static_cast<QWidget*>(parent));
+}
+
+void* QPushButton_NewQPushButton2(char* text, void* parent)
+{
+	return new MyQPushButton(QString(text), static_cast<QWidget*>(parent));
+}
+
+void QPushButton_PaintEvent(void* ptr, void* vqp)
+{
+	static_cast<QPushButton*>(ptr)->paintEvent(static_cast<QPaintEvent*>(vqp));
+}
+
+void QPushButton_PaintEventDefault(void* ptr, void* vqp)
+{
+	if (dynamic_cast<QCommandLinkButton*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommandLinkButton*>(ptr)->QCommandLinkButton::paintEvent(static_cast<QPaintEvent*>(vqp));
+	} else {
+		static_cast<QPushButton*>(ptr)->QPushButton::paintEvent(static_cast<QPaintEvent*>(vqp));
+	}
+}
+
+void QPushButton_SetAutoDefault(void* ptr, char vbo)
+{
+	static_cast<QPushButton*>(ptr)->setAutoDefault(vbo != 0);
+}
+
+void QPushButton_SetDefault(void* ptr, char vbo)
+{
+	static_cast<QPushButton*>(ptr)->setDefault(vbo != 0);
+}
+
+void QPushButton_SetFlat(void* ptr, char vbo)
+{
+	static_cast<QPushButton*>(ptr)->setFlat(vbo != 0);
+}
+
+void QPushButton_SetMenu(void* ptr, void* menu)
+{
+	static_cast<QPushButton*>(ptr)->setMenu(static_cast<QMenu*>(menu));
+}
+
+void QPushButton_ShowMenu(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QPushButton*>(ptr), "showMenu");
+}
+
+void QPushButton_ShowMenuDefault(void* ptr)
+{
+	if (dynamic_cast<QCommandLinkButton*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommandLinkButton*>(ptr)->QCommandLinkButton::showMenu();
+	} else {
+		static_cast<QPushButton*>(ptr)->QPushButton::showMenu();
+	}
+}
+
+void QPushButton_DestroyQPushButton(void* ptr)
+{
+	static_cast<QPushButton*>(ptr)->~QPushButton();
+}
+
+void* QPushButton_Menu(void* ptr)
+{
+	return static_cast<QPushButton*>(ptr)->menu();
+}
+
+char QPushButton_AutoDefault(void* ptr)
+{
+	return static_cast<QPushButton*>(ptr)->autoDefault();
+}
+
+char QPushButton_IsDefault(void* ptr)
+{
+	return static_cast<QPushButton*>(ptr)->isDefault();
+}
+
+char QPushButton_IsFlat(void* ptr)
+{
+	return static_cast<QPushButton*>(ptr)->isFlat();
+}
+
+void QPushButton_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QPushButton*>(ptr)->initStyleOption(static_cast<QStyleOptionButton*>(option));
+}
+
+class MyQRadioButton: public QRadioButton
+{
+public:
+	MyQRadioButton(QWidget *parent) : QRadioButton(parent) {};
+	MyQRadioButton(const QString &text, QWidget *parent) : QRadioButton(text, parent) {};
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void paintEvent(QPaintEvent * vqp) { callbackQRadioButton_PaintEvent(this, vqp); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hitButton(const QPoint & pos) const { return callbackQAbstractButton_HitButton(const_cast<void*>(static_cast<const void*>(this)), const_cast<QPoint*>(&pos)) != 0; };
+	void animateClick(int msec) { callbackQAbstractButton_AnimateClick(this, msec); };
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void checkStateSet() { callbackQAbstractButton_CheckStateSet(this); };
+	void click() { callbackQAbstractButton_Click(this); };
+	void Signal_Clicked(bool checked) { callbackQAbstractButton_Clicked(this, checked); };
+	void focusInEvent(QFocusEvent * e) { callbackQWidget_FocusInEvent(this, e); };
+	void focusOutEvent(QFocusEvent * e) { callbackQWidget_FocusOutEvent(this, e); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void keyReleaseEvent(QKeyEvent * e) { callbackQWidget_KeyReleaseEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void nextCheckState() { callbackQAbstractButton_NextCheckState(this); };
+	void Signal_Pressed() { callbackQAbstractButton_Pressed(this); };
+	void Signal_Released() { callbackQAbstractButton_Released(this); };
+	void setChecked(bool vbo) { callbackQAbstractButton_SetChecked(this, vbo); };
+	void setIconSize(const QSize & size) { callbackQAbstractButton_SetIconSize(this, const_cast<QSize*>(&size)); };
+	void toggle() { callbackQAbstractButton_Toggle(this); };
+	void Signal_Toggled(bool checked) { callbackQAbstractButton_Toggled(this, checked); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QRadioButton_NewQRadioButton(void* parent)
+{
+	return new MyQRadioButton(static_cast<QWidget*>(parent));
+}
+
+void* QRadioButton_NewQRadioButton2(char* text, void* parent)
+{
+	return new MyQRadioButton(QString(text), static_cast<QWidget*>(parent));
+}
+
+void QRadioButton_PaintEvent(void* ptr, void* vqp)
+{
+	static_cast<QRadioButton*>(ptr)->paintEvent(static_cast<QPaintEvent*>(vqp));
+}
+
+void QRadioButton_PaintEventDefault(void* ptr, void* vqp)
+{
+		static_cast<QRadioButton*>(ptr)->QRadioButton::paintEvent(static_cast<QPaintEvent*>(vqp));
+}
+
+void QRadioButton_DestroyQRadioButton(void* ptr)
+{
+	static_cast<QRadioButton*>(ptr)->~QRadioButton();
+}
+
+void QRadioButton_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QRadioButton*>(ptr)->initStyleOption(static_cast<QStyleOptionButton*>(option));
+}
+
+class MyQRubberBand: public QRubberBand
+{
+public:
+	MyQRubberBand(Shape s, QWidget *p) : QRubberBand(s, p) {};
+	void resizeEvent(QResizeEvent * vqr) { callbackQWidget_ResizeEvent(this, vqr); };
+	void changeEvent(QEvent * e) { callbackQWidget_ChangeEvent(this, e); };
+	void moveEvent(QMoveEvent * vqm) { callbackQWidget_MoveEvent(this, vqm); };
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	void showEvent(QShowEvent * e) { callbackQWidget_ShowEvent(this, e); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QRubberBand_NewQRubberBand(long long s, void* p)
+{
+	return new MyQRubberBand(static_cast<QRubberBand::Shape>(s), static_cast<QWidget*>(p));
+}
+
+void QRubberBand_DestroyQRubberBand(void* ptr)
+{
+	static_cast<QRubberBand*>(ptr)->~QRubberBand();
+}
+
+long long QRubberBand_Shape(void* ptr)
+{
+	return static_cast<QRubberBand*>(ptr)->shape();
+}
+
+void QRubberBand_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QRubberBand*>(ptr)->initStyleOption(static_cast<QStyleOptionRubberBand*>(option));
+}
+
+class MyQScrollArea: public QScrollArea
+{
+public:
+	MyQScrollArea(QWidget *parent) : QScrollArea(parent) {};
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	void resizeEvent(QResizeEvent * vqr) { callbackQWidget_ResizeEvent(this, vqr); };
+	void scrollContentsBy(int dx, int dy) { callbackQAbstractScrollArea_ScrollContentsBy(this, dx, dy); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize viewportSizeHint() const { return *static_cast<QSize*>(callbackQAbstractScrollArea_ViewportSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool viewportEvent(QEvent * event) { return callbackQAbstractScrollArea_ViewportEvent(this, event) != 0; };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void mouseDoubleClickEvent(QMouseEvent * e) { callbackQWidget_MouseDoubleClickEvent(this, e); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void setupViewport(QWidget * viewport) { callbackQAbstractScrollArea_SetupViewport(this, viewport); };
+	void wheelEvent(QWheelEvent * e) { callbackQWidget_WheelEvent(this, e); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QScrollArea_NewQScrollArea(void* parent)
+{
+	return new MyQScrollArea(static_cast<QWidget*>(parent));
+}
+
+void* QScrollArea_TakeWidget(void* ptr)
+{
+	return static_cast<QScrollArea*>(ptr)->takeWidget();
+}
+
+void QScrollArea_EnsureVisible(void* ptr, int x, int y, int xmargin, int ymargin)
+{
+	static_cast<QScrollArea*>(ptr)->ensureVisible(x, y, xmargin, ymargin);
+}
+
+void QScrollArea_EnsureWidgetVisible(void* ptr, void* childWidget, int xmargin, int ymargin)
+{
+		static_cast<QScrollArea*>(ptr)->ensureWidgetVisible(static_cast<QWidget*>(childWidget), xmargin, ymargin);
+}
+
+void QScrollArea_SetAlignment(void* ptr, long long vqt)
+{
+	static_cast<QScrollArea*>(ptr)->setAlignment(static_cast<Qt::AlignmentFlag>(vqt));
+}
+
+void QScrollArea_SetWidget(void* ptr, void* widget)
+{
+		static_cast<QScrollArea*>(ptr)->setWidget(static_cast<QWidget*>(widget));
+}
+
+void QScrollArea_SetWidgetResizable(void* ptr, char resizable)
+{
+	static_cast<QScrollArea*>(ptr)->setWidgetResizable(resizable != 0);
+}
+
+void QScrollArea_DestroyQScrollArea(void* ptr)
+{
+	static_cast<QScrollArea*>(ptr)->~QScrollArea();
+}
+
+void* QScrollArea_Widget(void* ptr)
+{
+	return static_cast<QScrollArea*>(ptr)->widget();
+}
+
+long long QScrollArea_Alignment(void* ptr)
+{
+	return static_cast<QScrollArea*>(ptr)->alignment();
+}
+
+char QScrollArea_WidgetResizable(void* ptr)
+{
+	return static_cast<QScrollArea*>(ptr)->widgetResizable();
+}
+
+class MyQScrollBar: public QScrollBar
+{
+public:
+	MyQScrollBar(QWidget *parent) : QScrollBar(parent) {};
+	MyQScrollBar(Qt::Orientation orientation, QWidget *parent) : QScrollBar(orientation, parent) {};
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void hideEvent(QHideEvent * vqh) { callbackQWidget_HideEvent(this, vqh); };
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	void sliderChange(QAbstractSlider::SliderChange change) { callbackQAbstractSlider_SliderChange(this, change); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void Signal_ActionTriggered(int action) { callbackQAbstractSlider_ActionTriggered(this, action); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void keyPressEvent(QKeyEvent * ev) { callbackQWidget_KeyPressEvent(this, ev); };
+	void Signal_RangeChanged(int min, int max) { callbackQAbstractSlider_RangeChanged(this, min, max); };
+	void setOrientation(Qt::Orientation vqt) { callbackQAbstractSlider_SetOrientation(this, vqt); };
+	void setRange(int min, int max) { callbackQAbstractSlider_SetRange(this, min, max); };
+	void setValue(int vin) { callbackQAbstractSlider_SetValue(this, vin); };
+	void Signal_SliderMoved(int value) { callbackQAbstractSlider_SliderMoved(this, value); };
+	void Signal_SliderPressed() { callbackQAbstractSlider_SliderPressed(this); };
+	void Signal_SliderReleased() { callbackQAbstractSlider_SliderReleased(this); };
+	void Signal_ValueChanged(int value) { callbackQAbstractSlider_ValueChanged(this, value); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QScrollBar_NewQScrollBar(void* parent)
+{
+	return new MyQScrollBar(static_cast<QWidget*>(parent));
+}
+
+void* QScrollBar_NewQScrollBar2(long long orientation, void* parent)
+{
+	return new MyQScrollBar(static_cast<Qt::Orientation>(orientation), static_cast<QWidget*>(parent));
+}
+
+void QScrollBar_DestroyQScrollBar(void* ptr)
+{
+	static_cast<QScrollBar*>(ptr)->~QScrollBar();
+}
+
+void QScrollBar_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QScrollBar*>(ptr)->initStyleOption(static_cast<QStyleOptionSlider*>(option));
+}
+
+class MyQScroller: public QScroller
+{
+public:
+	void ensureVisible(const QRectF & rect, qreal xmargin, qreal ymargin) { callbackQScroller_EnsureVisible(this, const_cast<QRectF*>(&rect), xmargin, ymargin); };
+	void ensureVisible(const QRectF & rect, qreal xmargin, qreal ymargin, int scrollTime) { callbackQScroller_EnsureVisible2(this, const_cast<QRectF*>(&rect), xmargin, ymargin, scrollTime); };
+	void resendPrepareEvent() { callbackQScroller_ResendPrepareEvent(this); };
+	void scrollTo(const QPointF & pos) { callbackQScroller_ScrollTo(this, const_cast<QPointF*>(&pos)); };
+	void scrollTo(const QPointF & pos, int scrollTime) { callbackQScroller_ScrollTo2(this, const_cast<QPointF*>(&pos), scrollTime); };
+	void Signal_ScrollerPropertiesChanged(const QScrollerProperties & newProperties) { callbackQScroller_ScrollerPropertiesChanged(this, const_cast<QScrollerProperties*>(&newProperties)); };
+	void setScrollerProperties(const QScrollerProperties & prop) { callbackQScroller_SetScrollerProperties(this, const_cast<QScrollerProperties*>(&prop)); };
+	void Signal_StateChanged(QScroller::State newState) { callbackQScroller_StateChanged(this, newState); };
+	bool event(QEvent * e) { return callbackQScroller_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQScroller_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQScroller_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQScroller_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQScroller_CustomEvent(this, event); };
+	void deleteLater() { callbackQScroller_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQScroller_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQScroller_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQScroller_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQScroller_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQScroller_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+struct QtWidgets_PackedList QScroller_QScroller_ActiveScrollers()
+{
+	return ({ QList<QScroller *>* tmpValue = new QList<QScroller *>(QScroller::activeScrollers()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QScroller_QScroller_Scroller(void* target)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(target))) {
+		return QScroller::scroller(static_cast<QGraphicsObject*>(target));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(target))) {
+		return QScroller::scroller(static_cast<QGraphicsWidget*>(target));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(target))) {
+		return QScroller::scroller(static_cast<QLayout*>(target));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(target))) {
+		return QScroller::scroller(static_cast<QWidget*>(target));
+	} else {
+		return QScroller::scroller(static_cast<QObject*>(target));
+	}
+}
+
+long long QScroller_QScroller_GrabGesture(void* target, long long scrollGestureType)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(target))) {
+		return QScroller::grabGesture(static_cast<QGraphicsObject*>(target), static_cast<QScroller::ScrollerGestureType>(scrollGestureType));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(target))) {
+		return QScroller::grabGesture(static_cast<QGraphicsWidget*>(target), static_cast<QScroller::ScrollerGestureType>(scrollGestureType));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(target))) {
+		return QScroller::grabGesture(static_cast<QLayout*>(target), static_cast<QScroller::ScrollerGestureType>(scrollGestureType));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(target))) {
+		return QScroller::grabGesture(static_cast<QWidget*>(target), static_cast<QScroller::ScrollerGestureType>(scrollGestureType));
+	} else {
+		return QScroller::grabGesture(static_cast<QObject*>(target), static_cast<QScroller::ScrollerGestureType>(scrollGestureType));
+	}
+}
+
+long long QScroller_QScroller_GrabbedGesture(void* target)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(target))) {
+		return QScroller::grabbedGesture(static_cast<QGraphicsObject*>(target));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(target))) {
+		return QScroller::grabbedGesture(static_cast<QGraphicsWidget*>(target));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(target))) {
+		return QScroller::grabbedGesture(static_cast<QLayout*>(target));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(target))) {
+		return QScroller::grabbedGesture(static_cast<QWidget*>(target));
+	} else {
+		return QScroller::grabbedGesture(static_cast<QObject*>(target));
+	}
+}
+
+char QScroller_HandleInput(void* ptr, long long input, void* position, long long timestamp)
+{
+	return static_cast<QScroller*>(ptr)->handleInput(static_cast<QScroller::Input>(input), *static_cast<QPointF*>(position), timestamp);
+}
+
+char QScroller_QScroller_HasScroller(void* target)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(target))) {
+		return QScroller::hasScroller(static_cast<QGraphicsObject*>(target));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(target))) {
+		return QScroller::hasScroller(static_cast<QGraphicsWidget*>(target));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(target))) {
+		return QScroller::hasScroller(static_cast<QLayout*>(target));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(target))) {
+		return QScroller::hasScroller(static_cast<QWidget*>(target));
+	} else {
+		return QScroller::hasScroller(static_cast<QObject*>(target));
+	}
+}
+
+void* QScroller_QScroller_Scroller2(void* target)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(target))) {
+		return const_cast<QScroller*>(QScroller::scroller(static_cast<QGraphicsObject*>(target)));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(target))) {
+		return const_cast<QScroller*>(QScroller::scroller(static_cast<QGraphicsWidget*>(target)));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(target))) {
+		return const_cast<QScroller*>(QScroller::scroller(static_cast<QLayout*>(target)));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(target))) {
+		return const_cast<QScroller*>(QScroller::scroller(static_cast<QWidget*>(target)));
+	} else {
+		return const_cast<QScroller*>(QScroller::scroller(static_cast<QObject*>(target)));
+	}
+}
+
+void QScroller_EnsureVisible(void* ptr, void* rect, double xmargin, double ymargin)
+{
+	QMetaObject::invokeMethod(static_cast<QScroller*>(ptr), "ensureVisible", Q_ARG(QRectF, *static_cast<QRectF*>(rect)), Q_ARG(qreal, xmargin), Q_ARG(qreal, ymargin));
+}
+
+void QScroller_EnsureVisibleDefault(void* ptr, void* rect, double xmargin, double ymargin)
+{
+		static_cast<QScroller*>(ptr)->QScroller::ensureVisible(*static_cast<QRectF*>(rect), xmargin, ymargin);
+}
+
+void QScroller_EnsureVisible2(void* ptr, void* rect, double xmargin, double ymargin, int scrollTime)
+{
+	QMetaObject::invokeMethod(static_cast<QScroller*>(ptr), "ensureVisible", Q_ARG(QRectF, *static_cast<QRectF*>(rect)), Q_ARG(qreal, xmargin), Q_ARG(qreal, ymargin), Q_ARG(int, scrollTime));
+}
+
+void QScroller_EnsureVisible2Default(void* ptr, void* rect, double xmargin, double ymargin, int scrollTime)
+{
+		static_cast<QScroller*>(ptr)->QScroller::ensureVisible(*static_cast<QRectF*>(rect), xmargin, ymargin, scrollTime);
+}
+
+void QScroller_ResendPrepareEvent(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QScroller*>(ptr), "resendPrepareEvent");
+}
+
+void QScroller_ResendPrepareEventDefault(void* ptr)
+{
+		static_cast<QScroller*>(ptr)->QScroller::resendPrepareEvent();
+}
+
+void QScroller_ScrollTo(void* ptr, void* pos)
+{
+	QMetaObject::invokeMethod(static_cast<QScroller*>(ptr), "scrollTo", Q_ARG(QPointF, *static_cast<QPointF*>(pos)));
+}
+
+void QScroller_ScrollToDefault(void* ptr, void* pos)
+{
+		static_cast<QScroller*>(ptr)->QScroller::scrollTo(*static_cast<QPointF*>(pos));
+}
+
+void QScroller_ScrollTo2(void* ptr, void* pos, int scrollTime)
+{
+	QMetaObject::invokeMethod(static_cast<QScroller*>(ptr), "scrollTo", Q_ARG(QPointF, *static_cast<QPointF*>(pos)), Q_ARG(int, scrollTime));
+}
+
+void QScroller_ScrollTo2Default(void* ptr, void* pos, int scrollTime)
+{
+		static_cast<QScroller*>(ptr)->QScroller::scrollTo(*static_cast<QPointF*>(pos), scrollTime);
+}
+
+void QScroller_ConnectScrollerPropertiesChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScroller*>(ptr), static_cast<void (QScroller::*)(const QScrollerProperties &)>(&QScroller::scrollerPropertiesChanged), static_cast<MyQScroller*>(ptr), static_cast<void (MyQScroller::*)(const QScrollerProperties &)>(&MyQScroller::Signal_ScrollerPropertiesChanged));
+}
+
+void QScroller_DisconnectScrollerPropertiesChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScroller*>(ptr), static_cast<void (QScroller::*)(const QScrollerProperties &)>(&QScroller::scrollerPropertiesChanged), static_cast<MyQScroller*>(ptr), static_cast<void (MyQScroller::*)(const QScrollerProperties &)>(&MyQScroller::Signal_ScrollerPropertiesChanged));
+}
+
+void QScroller_ScrollerPropertiesChanged(void* ptr, void* newProperties)
+{
+	static_cast<QScroller*>(ptr)->scrollerPropertiesChanged(*static_cast<QScrollerProperties*>(newProperties));
+}
+
+void QScroller_SetScrollerProperties(void* ptr, void* prop)
+{
+	QMetaObject::invokeMethod(static_cast<QScroller*>(ptr), "setScrollerProperties", Q_ARG(QScrollerProperties, *static_cast<QScrollerProperties*>(prop)));
+}
+
+void QScroller_SetScrollerPropertiesDefault(void* ptr, void* prop)
+{
+		static_cast<QScroller*>(ptr)->QScroller::setScrollerProperties(*static_cast<QScrollerProperties*>(prop));
+}
+
+void QScroller_SetSnapPositionsX(void* ptr, void* positions)
+{
+	static_cast<QScroller*>(ptr)->setSnapPositionsX(*static_cast<QList<qreal>*>(positions));
+}
+
+void QScroller_SetSnapPositionsX2(void* ptr, double first, double interval)
+{
+	static_cast<QScroller*>(ptr)->setSnapPositionsX(first, interval);
+}
+
+void QScroller_SetSnapPositionsY(void* ptr, void* positions)
+{
+	static_cast<QScroller*>(ptr)->setSnapPositionsY(*static_cast<QList<qreal>*>(positions));
+}
+
+void QScroller_SetSnapPositionsY2(void* ptr, double first, double interval)
+{
+	static_cast<QScroller*>(ptr)->setSnapPositionsY(first, interval);
+}
+
+void QScroller_ConnectStateChanged(void* ptr)
+{
+	QObject::connect(static_cast<QScroller*>(ptr), static_cast<void (QScroller::*)(QScroller::State)>(&QScroller::stateChanged), static_cast<MyQScroller*>(ptr), static_cast<void (MyQScroller::*)(QScroller::State)>(&MyQScroller::Signal_StateChanged));
+}
+
+void QScroller_DisconnectStateChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QScroller*>(ptr), static_cast<void (QScroller::*)(QScroller::State)>(&QScroller::stateChanged), static_cast<MyQScroller*>(ptr), static_cast<void (MyQScroller::*)(QScroller::State)>(&MyQScroller::Signal_StateChanged));
+}
+
+void QScroller_StateChanged(void* ptr, long long newState)
+{
+	static_cast<QScroller*>(ptr)->stateChanged(static_cast<QScroller::State>(newState));
+}
+
+void QScroller_Stop(void* ptr)
+{
+	static_cast<QScroller*>(ptr)->stop();
+}
+
+void QScroller_QScroller_UngrabGesture(void* target)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(target))) {
+		QScroller::ungrabGesture(static_cast<QGraphicsObject*>(target));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(target))) {
+		QScroller::ungrabGesture(static_cast<QGraphicsWidget*>(target));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(target))) {
+		QScroller::ungrabGesture(static_cast<QLayout*>(target));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(target))) {
+		QScroller::ungrabGesture(static_cast<QWidget*>(target));
+	} else {
+		QScroller::ungrabGesture(static_cast<QObject*>(target));
+	}
+}
+
+void* QScroller_Target(void* ptr)
+{
+	return static_cast<QScroller*>(ptr)->target();
+}
+
+void* QScroller_FinalPosition(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QScroller*>(ptr)->finalPosition(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QScroller_PixelPerMeter(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QScroller*>(ptr)->pixelPerMeter(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QScroller_Velocity(void* ptr)
+{
+	return ({ QPointF tmpValue = static_cast<QScroller*>(ptr)->velocity(); new QPointF(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QScroller_ScrollerProperties(void* ptr)
+{
+	return new QScrollerProperties(static_cast<QScroller*>(ptr)->scrollerProperties());
+}
+
+long long QScroller_State(void* ptr)
+{
+	return static_cast<QScroller*>(ptr)->state();
+}
+
+void* QScroller___activeScrollers_atList(void* ptr, int i)
+{
+	return const_cast<QScroller*>(static_cast<QList<QScroller *>*>(ptr)->at(i));
+}
+
+void QScroller___activeScrollers_setList(void* ptr, void* i)
+{
+	static_cast<QList<QScroller *>*>(ptr)->append(static_cast<QScroller*>(i));
+}
+
+void* QScroller___activeScrollers_newList(void* ptr)
+{
+	return new QList<QScroller *>;
+}
+
+double QScroller___setSnapPositionsX_positions_atList(void* ptr, int i)
+{
+	return static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
+void QScroller___setSnapPositionsX_positions_setList(void* ptr, double i)
+{
+	static_cast<QList<qreal>*>(ptr)->append(i);
+}
+
+void* QScroller___setSnapPositionsX_positions_newList(void* ptr)
+{
+	return new QList<qreal>;
+}
+
+void* QScroller___setSnapPositionsX_positions_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<qreal>* tmpList = new QList<qreal>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<double*>(data)[i]); tmpList; });
+}
+
+void QScroller___setSnapPositionsX_positions_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<qreal>*>(ptr)->size(); i++) static_cast<double*>(data)[i] = static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
+double QScroller___setSnapPositionsY_positions_atList(void* ptr, int i)
+{
+	return static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
+void QScroller___setSnapPositionsY_positions_setList(void* ptr, double i)
+{
+	static_cast<QList<qreal>*>(ptr)->append(i);
+}
+
+void* QScroller___setSnapPositionsY_positions_newList(void* ptr)
+{
+	return new QList<qreal>;
+}
+
+void* QScroller___setSnapPositionsY_positions_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<qreal>* tmpList = new QList<qreal>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<double*>(data)[i]); tmpList; });
+}
+
+void QScroller___setSnapPositionsY_positions_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<qreal>*>(ptr)->size(); i++) static_cast<double*>(data)[i] = static_cast<QList<qreal>*>(ptr)->at(i);
+}
+
+void* QScroller___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QScroller___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QScroller___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QScroller___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QScroller___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QScroller___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QScroller___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QScroller___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QScroller___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QScroller___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QScroller___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QScroller___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QScroller___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QScroller___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QScroller___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QScroller_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QScroller*>(ptr)->QScroller::event(static_cast<QEvent*>(e));
+}
+
+char QScroller_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QScroller*>(ptr)->QScroller::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QScroller*>(ptr)->QScroller::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QScroller*>(ptr)->QScroller::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QScroller*>(ptr)->QScroller::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QScroller*>(ptr)->QScroller::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QScroller_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QScroller*>(ptr)->QScroller::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QScroller_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QScroller*>(ptr)->QScroller::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QScroller_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QScroller*>(ptr)->QScroller::customEvent(static_cast<QEvent*>(event));
+}
+
+void QScroller_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QScroller*>(ptr)->QScroller::deleteLater();
+}
+
+void QScroller_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QScroller*>(ptr)->QScroller::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QScroller_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QScroller*>(ptr)->QScroller::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QScroller_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QScroller*>(ptr)->QScroller::metaObject());
+}
+
+class MyQScrollerProperties: public QScrollerProperties
+{
+public:
+	MyQScrollerProperties() : QScrollerProperties() {};
+	MyQScrollerProperties(const QScrollerProperties &sp) : QScrollerProperties(sp) {};
+	 ~MyQScrollerProperties() { callbackQScrollerProperties_DestroyQScrollerProperties(this); };
+};
+
+void* QScrollerProperties_NewQScrollerProperties()
+{
+	return new MyQScrollerProperties();
+}
+
+void* QScrollerProperties_NewQScrollerProperties2(void* sp)
+{
+	return new MyQScrollerProperties(*static_cast<QScrollerProperties*>(sp));
+}
+
+void QScrollerProperties_QScrollerProperties_SetDefaultScrollerProperties(void* sp)
+{
+	QScrollerProperties::setDefaultScrollerProperties(*static_cast<QScrollerProperties*>(sp));
+}
+
+void QScrollerProperties_SetScrollMetric(void* ptr, long long metric, void* value)
+{
+	static_cast<QScrollerProperties*>(ptr)->setScrollMetric(static_cast<QScrollerProperties::ScrollMetric>(metric), *static_cast<QVariant*>(value));
+}
+
+void QScrollerProperties_QScrollerProperties_UnsetDefaultScrollerProperties()
+{
+	QScrollerProperties::unsetDefaultScrollerProperties();
+}
+
+void QScrollerProperties_DestroyQScrollerProperties(void* ptr)
+{
+	static_cast<QScrollerProperties*>(ptr)->~QScrollerProperties();
+}
+
+void QScrollerProperties_DestroyQScrollerPropertiesDefault(void* ptr)
+{
+
+}
+
+void* QScrollerProperties_ScrollMetric(void* ptr, long long metric)
+{
+	return new QVariant(static_cast<QScrollerProperties*>(ptr)->scrollMetric(static_cast<QScrollerProperties::ScrollMetric>(metric)));
+}
+
+class MyQShortcut: public QShortcut
+{
+public:
+	MyQShortcut(QWidget *parent) : QShortcut(parent) {};
+	MyQShortcut(const QKeySequence &key, QWidget *parent, const char *member, const char *ambiguousMember, Qt::ShortcutContext context) : QShortcut(key, parent, member, ambiguousMember, context) {};
+	void Signal_Activated() { callbackQShortcut_Activated(this); };
+	void Signal_ActivatedAmbiguously() { callbackQShortcut_ActivatedAmbiguously(this); };
+	bool event(QEvent * e) { return callbackQShortcut_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQShortcut_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQShortcut_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQShortcut_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQShortcut_CustomEvent(this, event); };
+	void deleteLater() { callbackQShortcut_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQShortcut_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQShortcut_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQShortcut_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQShortcut_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQShortcut_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QShortcut_NewQShortcut(void* parent)
+{
+	return new MyQShortcut(static_cast<QWidget*>(parent));
+}
+
+void* QShortcut_NewQShortcut2(void* key, void* parent, char* member, char* ambiguousMember, long long context)
+{
+	return new MyQShortcut(*static_cast<QKeySequence*>(key), static_cast<QWidget*>(parent), const_cast<const char*>(member), const_cast<const char*>(ambiguousMember), static_cast<Qt::ShortcutContext>(context));
+}
+
+void QShortcut_ConnectActivated(void* ptr)
+{
+	QObject::connect(static_cast<QShortcut*>(ptr), static_cast<void (QShortcut::*)()>(&QShortcut::activated), static_cast<MyQShortcut*>(ptr), static_cast<void (MyQShortcut::*)()>(&MyQShortcut::Signal_Activated));
+}
+
+void QShortcut_DisconnectActivated(void* ptr)
+{
+	QObject::disconnect(static_cast<QShortcut*>(ptr), static_cast<void (QShortcut::*)()>(&QShortcut::activated), static_cast<MyQShortcut*>(ptr), static_cast<void (MyQShortcut::*)()>(&MyQShortcut::Signal_Activated));
+}
+
+void QShortcut_Activated(void* ptr)
+{
+	static_cast<QShortcut*>(ptr)->activated();
+}
+
+void QShortcut_ConnectActivatedAmbiguously(void* ptr)
+{
+	QObject::connect(static_cast<QShortcut*>(ptr), static_cast<void (QShortcut::*)()>(&QShortcut::activatedAmbiguously), static_cast<MyQShortcut*>(ptr), static_cast<void (MyQShortcut::*)()>(&MyQShortcut::Signal_ActivatedAmbiguously));
+}
+
+void QShortcut_DisconnectActivatedAmbiguously(void* ptr)
+{
+	QObject::disconnect(static_cast<QShortcut*>(ptr), static_cast<void (QShortcut::*)()>(&QShortcut::activatedAmbiguously), static_cast<MyQShortcut*>(ptr), static_cast<void (MyQShortcut::*)()>(&MyQShortcut::Signal_ActivatedAmbiguously));
+}
+
+void QShortcut_ActivatedAmbiguously(void* ptr)
+{
+	static_cast<QShortcut*>(ptr)->activatedAmbiguously();
+}
+
+void QShortcut_SetAutoRepeat(void* ptr, char on)
+{
+	static_cast<QShortcut*>(ptr)->setAutoRepeat(on != 0);
+}
+
+void QShortcut_SetContext(void* ptr, long long context)
+{
+	static_cast<QShortcut*>(ptr)->setContext(static_cast<Qt::ShortcutContext>(context));
+}
+
+void QShortcut_SetEnabled(void* ptr, char enable)
+{
+	static_cast<QShortcut*>(ptr)->setEnabled(enable != 0);
+}
+
+void QShortcut_SetKey(void* ptr, void* key)
+{
+	static_cast<QShortcut*>(ptr)->setKey(*static_cast<QKeySequence*>(key));
+}
+
+void QShortcut_SetWhatsThis(void* ptr, char* text)
+{
+	static_cast<QShortcut*>(ptr)->setWhatsThis(QString(text));
+}
+
+void QShortcut_DestroyQShortcut(void* ptr)
+{
+	static_cast<QShortcut*>(ptr)->~QShortcut();
+}
+
+void* QShortcut_Key(void* ptr)
+{
+	return new QKeySequence(static_cast<QShortcut*>(ptr)->key());
+}
+
+struct QtWidgets_PackedString QShortcut_WhatsThis(void* ptr)
+{
+	return ({ QByteArray t714906 = static_cast<QShortcut*>(ptr)->whatsThis().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t714906.prepend("WHITESPACE").constData()+10), t714906.size()-10 }; });
+}
+
+void* QShortcut_ParentWidget(void* ptr)
+{
+	return static_cast<QShortcut*>(ptr)->parentWidget();
+}
+
+long long QShortcut_Context(void* ptr)
+{
+	return static_cast<QShortcut*>(ptr)->context();
+}
+
+char QShortcut_AutoRepeat(void* ptr)
+{
+	return static_cast<QShortcut*>(ptr)->autoRepeat();
+}
+
+char QShortcut_IsEnabled(void* ptr)
+{
+	return static_cast<QShortcut*>(ptr)->isEnabled();
+}
+
+int QShortcut_Id(void* ptr)
+{
+	return static_cast<QShortcut*>(ptr)->id();
+}
+
+void* QShortcut___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QShortcut___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QShortcut___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QShortcut___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QShortcut___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QShortcut___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QShortcut___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QShortcut___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QShortcut___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QShortcut___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QShortcut___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QShortcut___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QShortcut___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QShortcut___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QShortcut___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QShortcut_EventDefault(void* ptr, void* e)
+{
+		return static_cast<QShortcut*>(ptr)->QShortcut::event(static_cast<QEvent*>(e));
+}
+
+char QShortcut_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+		return static_cast<QShortcut*>(ptr)->QShortcut::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QShortcut*>(ptr)->QShortcut::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+		return static_cast<QShortcut*>(ptr)->QShortcut::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+		return static_cast<QShortcut*>(ptr)->QShortcut::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+	} else {
+		return static_cast<QShortcut*>(ptr)->QShortcut::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+	}
+}
+
+void QShortcut_ChildEventDefault(void* ptr, void* event)
+{
+		static_cast<QShortcut*>(ptr)->QShortcut::childEvent(static_cast<QChildEvent*>(event));
+}
+
+void QShortcut_ConnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QShortcut*>(ptr)->QShortcut::connectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QShortcut_CustomEventDefault(void* ptr, void* event)
+{
+		static_cast<QShortcut*>(ptr)->QShortcut::customEvent(static_cast<QEvent*>(event));
+}
+
+void QShortcut_DeleteLaterDefault(void* ptr)
+{
+		static_cast<QShortcut*>(ptr)->QShortcut::deleteLater();
+}
+
+void QShortcut_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+		static_cast<QShortcut*>(ptr)->QShortcut::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+}
+
+void QShortcut_TimerEventDefault(void* ptr, void* event)
+{
+		static_cast<QShortcut*>(ptr)->QShortcut::timerEvent(static_cast<QTimerEvent*>(event));
+}
+
+void* QShortcut_MetaObjectDefault(void* ptr)
+{
+		return const_cast<QMetaObject*>(static_cast<QShortcut*>(ptr)->QShortcut::metaObject());
+}
+
+class MyQSizeGrip: public QSizeGrip
+{
+public:
+	MyQSizeGrip(QWidget *parent) : QSizeGrip(parent) {};
+	void hideEvent(QHideEvent * hideEvent) { callbackQWidget_HideEvent(this, hideEvent); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * mouseEvent) { callbackQWidget_MouseReleaseEvent(this, mouseEvent); };
+	void moveEvent(QMoveEvent * moveEvent) { callbackQWidget_MoveEvent(this, moveEvent); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void setVisible(bool visible) { callbackQSizeGrip_SetVisible(this, visible); };
+	void showEvent(QShowEvent * showEvent) { callbackQWidget_ShowEvent(this, showEvent); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSizeGrip_NewQSizeGrip(void* parent)
+{
+	return new MyQSizeGrip(static_cast<QWidget*>(parent));
+}
+
+void QSizeGrip_SetVisible(void* ptr, char visible)
+{
+	static_cast<QSizeGrip*>(ptr)->setVisible(visible != 0);
+}
+
+void QSizeGrip_SetVisibleDefault(void* ptr, char visible)
+{
+		static_cast<QSizeGrip*>(ptr)->QSizeGrip::setVisible(visible != 0);
+}
+
+void QSizeGrip_DestroyQSizeGrip(void* ptr)
+{
+	static_cast<QSizeGrip*>(ptr)->~QSizeGrip();
+}
+
+void* QSizePolicy_NewQSizePolicy()
+{
+	return new QSizePolicy();
+}
+
+void* QSizePolicy_NewQSizePolicy2(long long horizontal, long long vertical, long long ty)
+{
+	return new QSizePolicy(static_cast<QSizePolicy::Policy>(horizontal), static_cast<QSizePolicy::Policy>(vertical), static_cast<QSizePolicy::ControlType>(ty));
+}
+
+void QSizePolicy_SetControlType(void* ptr, long long ty)
+{
+	static_cast<QSizePolicy*>(ptr)->setControlType(static_cast<QSizePolicy::ControlType>(ty));
+}
+
+void QSizePolicy_SetHeightForWidth(void* ptr, char dependent)
+{
+	static_cast<QSizePolicy*>(ptr)->setHeightForWidth(dependent != 0);
+}
+
+void QSizePolicy_SetHorizontalPolicy(void* ptr, long long policy)
+{
+	static_cast<QSizePolicy*>(ptr)->setHorizontalPolicy(static_cast<QSizePolicy::Policy>(policy));
+}
+
+void QSizePolicy_SetHorizontalStretch(void* ptr, int stretchFactor)
+{
+	static_cast<QSizePolicy*>(ptr)->setHorizontalStretch(stretchFactor);
+}
+
+void QSizePolicy_SetRetainSizeWhenHidden(void* ptr, char retainSize)
+{
+	static_cast<QSizePolicy*>(ptr)->setRetainSizeWhenHidden(retainSize != 0);
+}
+
+void QSizePolicy_SetVerticalPolicy(void* ptr, long long policy)
+{
+	static_cast<QSizePolicy*>(ptr)->setVerticalPolicy(static_cast<QSizePolicy::Policy>(policy));
+}
+
+void QSizePolicy_SetVerticalStretch(void* ptr, int stretchFactor)
+{
+	static_cast<QSizePolicy*>(ptr)->setVerticalStretch(stretchFactor);
+}
+
+void QSizePolicy_SetWidthForHeight(void* ptr, char dependent)
+{
+	static_cast<QSizePolicy*>(ptr)->setWidthForHeight(dependent != 0);
+}
+
+void QSizePolicy_Transpose(void* ptr)
+{
+	static_cast<QSizePolicy*>(ptr)->transpose();
+}
+
+long long QSizePolicy_ControlType(void* ptr)
+{
+	return static_cast<QSizePolicy*>(ptr)->controlType();
+}
+
+long long QSizePolicy_HorizontalPolicy(void* ptr)
+{
+	return static_cast<QSizePolicy*>(ptr)->horizontalPolicy();
+}
+
+long long QSizePolicy_VerticalPolicy(void* ptr)
+{
+	return static_cast<QSizePolicy*>(ptr)->verticalPolicy();
+}
+
+long long QSizePolicy_ExpandingDirections(void* ptr)
+{
+	return static_cast<QSizePolicy*>(ptr)->expandingDirections();
+}
+
+char QSizePolicy_HasHeightForWidth(void* ptr)
+{
+	return static_cast<QSizePolicy*>(ptr)->hasHeightForWidth();
+}
+
+char QSizePolicy_HasWidthForHeight(void* ptr)
+{
+	return static_cast<QSizePolicy*>(ptr)->hasWidthForHeight();
+}
+
+char QSizePolicy_RetainSizeWhenHidden(void* ptr)
+{
+	return static_cast<QSizePolicy*>(ptr)->retainSizeWhenHidden();
+}
+
+int QSizePolicy_HorizontalStretch(void* ptr)
+{
+	return static_cast<QSizePolicy*>(ptr)->horizontalStretch();
+}
+
+int QSizePolicy_VerticalStretch(void* ptr)
+{
+	return static_cast<QSizePolicy*>(ptr)->verticalStretch();
+}
+
+class MyQSlider: public QSlider
+{
+public:
+	MyQSlider(QWidget *parent) : QSlider(parent) {};
+	MyQSlider(Qt::Orientation orientation, QWidget *parent) : QSlider(orientation, parent) {};
+	void mouseMoveEvent(QMouseEvent * ev) { callbackQWidget_MouseMoveEvent(this, ev); };
+	void mousePressEvent(QMouseEvent * ev) { callbackQWidget_MousePressEvent(this, ev); };
+	void mouseReleaseEvent(QMouseEvent * ev) { callbackQWidget_MouseReleaseEvent(this, ev); };
+	void paintEvent(QPaintEvent * ev) { callbackQWidget_PaintEvent(this, ev); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void Signal_ActionTriggered(int action) { callbackQAbstractSlider_ActionTriggered(this, action); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void keyPressEvent(QKeyEvent * ev) { callbackQWidget_KeyPressEvent(this, ev); };
+	void Signal_RangeChanged(int min, int max) { callbackQAbstractSlider_RangeChanged(this, min, max); };
+	void setOrientation(Qt::Orientation vqt) { callbackQAbstractSlider_SetOrientation(this, vqt); };
+	void setRange(int min, int max) { callbackQAbstractSlider_SetRange(this, min, max); };
+	void setValue(int vin) { callbackQAbstractSlider_SetValue(this, vin); };
+	void sliderChange(QAbstractSlider::SliderChange change) { callbackQAbstractSlider_SliderChange(this, change); };
+	void Signal_SliderMoved(int value) { callbackQAbstractSlider_SliderMoved(this, value); };
+	void Signal_SliderPressed() { callbackQAbstractSlider_SliderPressed(this); };
+	void Signal_SliderReleased() { callbackQAbstractSlider_SliderReleased(this); };
+	void Signal_ValueChanged(int value) { callbackQAbstractSlider_ValueChanged(this, value); };
+	void wheelEvent(QWheelEvent * e) { callbackQWidget_WheelEvent(this, e); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void QSlider_SetTickInterval(void* ptr, int ti)
+{
+	static_cast<QSlider*>(ptr)->setTickInterval(ti);
+}
+
+void QSlider_SetTickPosition(void* ptr, long long position)
+{
+	static_cast<QSlider*>(ptr)->setTickPosition(static_cast<QSlider::TickPosition>(position));
+}
+
+void* QSlider_NewQSlider(void* parent)
+{
+	return new MyQSlider(static_cast<QWidget*>(parent));
+}
+
+void* QSlider_NewQSlider2(long long orientation, void* parent)
+{
+	return new MyQSlider(static_cast<Qt::Orientation>(orientation), static_cast<QWidget*>(parent));
+}
+
+void QSlider_DestroyQSlider(void* ptr)
+{
+	static_cast<QSlider*>(ptr)->~QSlider();
+}
+
+long long QSlider_TickPosition(void* ptr)
+{
+	return static_cast<QSlider*>(ptr)->tickPosition();
+}
+
+int QSlider_TickInterval(void* ptr)
+{
+	return static_cast<QSlider*>(ptr)->tickInterval();
+}
+
+void QSlider_InitStyleOption(void* ptr, void* option)
+{
+	static_cast<QSlider*>(ptr)->initStyleOption(static_cast<QStyleOptionSlider*>(option));
+}
+
+class MyQSpacerItem: public QSpacerItem
+{
+public:
+	MyQSpacerItem(int w, int h, QSizePolicy::Policy hPolicy, QSizePolicy::Policy vPolicy) : QSpacerItem(w, h, hPolicy, vPolicy) {};
+	QSpacerItem * spacerItem() { return static_cast<QSpacerItem*>(callbackQLayoutItem_SpacerItem(this)); };
+	void setGeometry(const QRect & r) { callbackQSpacerItem_SetGeometry(this, const_cast<QRect*>(&r)); };
+	QRect geometry() const { return *static_cast<QRect*>(callbackQSpacerItem_Geometry(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize maximumSize() const { return *static_cast<QSize*>(callbackQSpacerItem_MaximumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSize() const { return *static_cast<QSize*>(callbackQSpacerItem_MinimumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQSpacerItem_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::Orientations expandingDirections() const { return static_cast<Qt::Orientation>(callbackQSpacerItem_ExpandingDirections(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool isEmpty() const { return callbackQSpacerItem_IsEmpty(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	QLayout * layout() { return static_cast<QLayout*>(callbackQLayoutItem_Layout(this)); };
+	QWidget * widget() { return static_cast<QWidget*>(callbackQLayoutItem_Widget(this)); };
+	void invalidate() { callbackQLayoutItem_Invalidate(this); };
+	QSizePolicy::ControlTypes controlTypes() const { return static_cast<QSizePolicy::ControlType>(callbackQLayoutItem_ControlTypes(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQLayoutItem_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQLayoutItem_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int minimumHeightForWidth(int w) const { return callbackQLayoutItem_MinimumHeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+};
+
+void* QSpacerItem_NewQSpacerItem(int w, int h, long long hPolicy, long long vPolicy)
+{
+	return new MyQSpacerItem(w, h, static_cast<QSizePolicy::Policy>(hPolicy), static_cast<QSizePolicy::Policy>(vPolicy));
+}
+
+void QSpacerItem_ChangeSize(void* ptr, int w, int h, long long hPolicy, long long vPolicy)
+{
+	static_cast<QSpacerItem*>(ptr)->changeSize(w, h, static_cast<QSizePolicy::Policy>(hPolicy), static_cast<QSizePolicy::Policy>(vPolicy));
+}
+
+void QSpacerItem_SetGeometry(void* ptr, void* r)
+{
+	static_cast<QSpacerItem*>(ptr)->setGeometry(*static_cast<QRect*>(r));
+}
+
+void QSpacerItem_SetGeometryDefault(void* ptr, void* r)
+{
+		static_cast<QSpacerItem*>(ptr)->QSpacerItem::setGeometry(*static_cast<QRect*>(r));
+}
+
+void QSpacerItem_DestroyQSpacerItem(void* ptr)
+{
+	static_cast<QSpacerItem*>(ptr)->~QSpacerItem();
+}
+
+void* QSpacerItem_Geometry(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QSpacerItem*>(ptr)->geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSpacerItem_GeometryDefault(void* ptr)
+{
+		return ({ QRect tmpValue = static_cast<QSpacerItem*>(ptr)->QSpacerItem::geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSpacerItem_MaximumSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QSpacerItem*>(ptr)->maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSpacerItem_MaximumSizeDefault(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QSpacerItem*>(ptr)->QSpacerItem::maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSpacerItem_MinimumSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QSpacerItem*>(ptr)->minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSpacerItem_MinimumSizeDefault(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QSpacerItem*>(ptr)->QSpacerItem::minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSpacerItem_SizeHint(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QSpacerItem*>(ptr)->sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSpacerItem_SizeHintDefault(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QSpacerItem*>(ptr)->QSpacerItem::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QSpacerItem_SizePolicy(void* ptr)
+{
+	return new QSizePolicy(static_cast<QSpacerItem*>(ptr)->sizePolicy());
+}
+
+long long QSpacerItem_ExpandingDirections(void* ptr)
+{
+	return static_cast<QSpacerItem*>(ptr)->expandingDirections();
+}
+
+long long QSpacerItem_ExpandingDirectionsDefault(void* ptr)
+{
+		return static_cast<QSpacerItem*>(ptr)->QSpacerItem::expandingDirections();
+}
+
+char QSpacerItem_IsEmpty(void* ptr)
+{
+	return static_cast<QSpacerItem*>(ptr)->isEmpty();
+}
+
+char QSpacerItem_IsEmptyDefault(void* ptr)
+{
+		return static_cast<QSpacerItem*>(ptr)->QSpacerItem::isEmpty();
+}
+
+class MyQSpinBox: public QSpinBox
+{
+public:
+	MyQSpinBox(QWidget *parent) : QSpinBox(parent) {};
+	void setValue(int val) { callbackQSpinBox_SetValue(this, val); };
+	void Signal_ValueChanged2(const QString & text) { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQSpinBox_ValueChanged2(this, textPacked); };
+	void Signal_ValueChanged(int i) { callbackQSpinBox_ValueChanged(this, i); };
+	QString textFromValue(int value) const { return QString(callbackQSpinBox_TextFromValue(const_cast<void*>(static_cast<const void*>(this)), value)); };
+	QValidator::State validate(QString & text, int & pos) const { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };return static_cast<QValidator::State>(callbackQAbstractSpinBox_Validate(const_cast<void*>(static_cast<const void*>(this)), textPacked, pos)); };
+	int valueFromText(const QString & text) const { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };return callbackQSpinBox_ValueFromText(const_cast<void*>(static_cast<const void*>(this)), textPacked); };
+	void fixup(QString & input) const { QByteArray t140f86 = input.toUtf8(); QtWidgets_PackedString inputPacked = { const_cast<char*>(t140f86.prepend("WHITESPACE").constData()+10), t140f86.size()-10 };callbackQAbstractSpinBox_Fixup(const_cast<void*>(static_cast<const void*>(this)), inputPacked); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void clear() { callbackQAbstractSpinBox_Clear(this); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_EditingFinished() { callbackQAbstractSpinBox_EditingFinished(this); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void selectAll() { callbackQAbstractSpinBox_SelectAll(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void stepBy(int steps) { callbackQAbstractSpinBox_StepBy(this, steps); };
+	void stepDown() { callbackQAbstractSpinBox_StepDown(this); };
+	void stepUp() { callbackQAbstractSpinBox_StepUp(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	StepEnabled stepEnabled() const { return static_cast<QAbstractSpinBox::StepEnabledFlag>(callbackQAbstractSpinBox_StepEnabled(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSpinBox_NewQSpinBox(void* parent)
+{
+	return new MyQSpinBox(static_cast<QWidget*>(parent));
+}
+
+void QSpinBox_SetDisplayIntegerBase(void* ptr, int base)
+{
+	static_cast<QSpinBox*>(ptr)->setDisplayIntegerBase(base);
+}
+
+void QSpinBox_SetMaximum(void* ptr, int max)
+{
+	static_cast<QSpinBox*>(ptr)->setMaximum(max);
+}
+
+void QSpinBox_SetMinimum(void* ptr, int min)
+{
+	static_cast<QSpinBox*>(ptr)->setMinimum(min);
+}
+
+void QSpinBox_SetPrefix(void* ptr, char* prefix)
+{
+	static_cast<QSpinBox*>(ptr)->setPrefix(QString(prefix));
+}
+
+void QSpinBox_SetRange(void* ptr, int minimum, int maximum)
+{
+	static_cast<QSpinBox*>(ptr)->setRange(minimum, maximum);
+}
+
+void QSpinBox_SetSingleStep(void* ptr, int val)
+{
+	static_cast<QSpinBox*>(ptr)->setSingleStep(val);
+}
+
+void QSpinBox_SetSuffix(void* ptr, char* suffix)
+{
+	static_cast<QSpinBox*>(ptr)->setSuffix(QString(suffix));
+}
+
+void QSpinBox_SetValue(void* ptr, int val)
+{
+	QMetaObject::invokeMethod(static_cast<QSpinBox*>(ptr), "setValue", Q_ARG(int, val));
+}
+
+void QSpinBox_SetValueDefault(void* ptr, int val)
+{
+		static_cast<QSpinBox*>(ptr)->QSpinBox::setValue(val);
+}
+
+void QSpinBox_ConnectValueChanged2(void* ptr)
+{
+	QObject::connect(static_cast<QSpinBox*>(ptr), static_cast<void (QSpinBox::*)(const QString &)>(&QSpinBox::valueChanged), static_cast<MyQSpinBox*>(ptr), static_cast<void (MyQSpinBox::*)(const QString &)>(&MyQSpinBox::Signal_ValueChanged2));
+}
+
+void QSpinBox_DisconnectValueChanged2(void* ptr)
+{
+	QObject::disconnect(static_cast<QSpinBox*>(ptr), static_cast<void (QSpinBox::*)(const QString &)>(&QSpinBox::valueChanged), static_cast<MyQSpinBox*>(ptr), static_cast<void (MyQSpinBox::*)(const QString &)>(&MyQSpinBox::Signal_ValueChanged2));
+}
+
+void QSpinBox_ValueChanged2(void* ptr, char* text)
+{
+	static_cast<QSpinBox*>(ptr)->valueChanged(QString(text));
+}
+
+void QSpinBox_ConnectValueChanged(void* ptr)
+{
+	QObject::connect(static_cast<QSpinBox*>(ptr), static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged), static_cast<MyQSpinBox*>(ptr), static_cast<void (MyQSpinBox::*)(int)>(&MyQSpinBox::Signal_ValueChanged));
+}
+
+void QSpinBox_DisconnectValueChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QSpinBox*>(ptr), static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged), static_cast<MyQSpinBox*>(ptr), static_cast<void (MyQSpinBox::*)(int)>(&MyQSpinBox::Signal_ValueChanged));
+}
+
+void QSpinBox_ValueChanged(void* ptr, int i)
+{
+	static_cast<QSpinBox*>(ptr)->valueChanged(i);
+}
+
+void QSpinBox_DestroyQSpinBox(void* ptr)
+{
+	static_cast<QSpinBox*>(ptr)->~QSpinBox();
+}
+
+struct QtWidgets_PackedString QSpinBox_CleanText(void* ptr)
+{
+	return ({ QByteArray t9d04b9 = static_cast<QSpinBox*>(ptr)->cleanText().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t9d04b9.prepend("WHITESPACE").constData()+10), t9d04b9.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QSpinBox_Prefix(void* ptr)
+{
+	return ({ QByteArray t9d23c1 = static_cast<QSpinBox*>(ptr)->prefix().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t9d23c1.prepend("WHITESPACE").constData()+10), t9d23c1.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QSpinBox_Suffix(void* ptr)
+{
+	return ({ QByteArray t38bf82 = static_cast<QSpinBox*>(ptr)->suffix().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t38bf82.prepend("WHITESPACE").constData()+10), t38bf82.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QSpinBox_TextFromValue(void* ptr, int value)
+{
+	return ({ QByteArray tf53a0d = static_cast<QSpinBox*>(ptr)->textFromValue(value).toUtf8(); QtWidgets_PackedString { const_cast<char*>(tf53a0d.prepend("WHITESPACE").constData()+10), tf53a0d.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QSpinBox_TextFromValueDefault(void* ptr, int value)
+{
+		return ({ QByteArray td11815 = static_cast<QSpinBox*>(ptr)->QSpinBox::textFromValue(value).toUtf8(); QtWidgets_PackedString { const_cast<char*>(td11815.prepend("WHITESPACE").constData()+10), td11815.size()-10 }; });
+}
+
+int QSpinBox_DisplayIntegerBase(void* ptr)
+{
+	return static_cast<QSpinBox*>(ptr)->displayIntegerBase();
+}
+
+int QSpinBox_Maximum(void* ptr)
+{
+	return static_cast<QSpinBox*>(ptr)->maximum();
+}
+
+int QSpinBox_Minimum(void* ptr)
+{
+	return static_cast<QSpinBox*>(ptr)->minimum();
+}
+
+int QSpinBox_SingleStep(void* ptr)
+{
+	return static_cast<QSpinBox*>(ptr)->singleStep();
+}
+
+int QSpinBox_Value(void* ptr)
+{
+	return static_cast<QSpinBox*>(ptr)->value();
+}
+
+int QSpinBox_ValueFromText(void* ptr, char* text)
+{
+	return static_cast<QSpinBox*>(ptr)->valueFromText(QString(text));
+}
+
+int QSpinBox_ValueFromTextDefault(void* ptr, char* text)
+{
+		return static_cast<QSpinBox*>(ptr)->QSpinBox::valueFromText(QString(text));
+}
+
+class MyQSplashScreen: public QSplashScreen
+{
+public:
+	MyQSplashScreen(QWidget *parent, const QPixmap &pixmap, Qt::WindowFlags f) : QSplashScreen(parent, pixmap, f) {};
+	MyQSplashScreen(const QPixmap &pixmap, Qt::WindowFlags f) : QSplashScreen(pixmap, f) {};
+	void clearMessage() { callbackQSplashScreen_ClearMessage(this); };
+	void drawContents(QPainter * painter) { callbackQSplashScreen_DrawContents(this, painter); };
+	void Signal_MessageChanged(const QString & message) { QByteArray t6f9b9a = message.toUtf8(); QtWidgets_PackedString messagePacked = { const_cast<char*>(t6f9b9a.prepend("WHITESPACE").constData()+10), t6f9b9a.size()-10 };callbackQSplashScreen_MessageChanged(this, messagePacked); };
+	void mousePressEvent(QMouseEvent * vqm) { callbackQWidget_MousePressEvent(this, vqm); };
+	void showMessage(const QString & message, int alignment, const QColor & color) { QByteArray t6f9b9a = message.toUtf8(); QtWidgets_PackedString messagePacked = { const_cast<char*>(t6f9b9a.prepend("WHITESPACE").constData()+10), t6f9b9a.size()-10 };callbackQSplashScreen_ShowMessage(this, messagePacked, alignment, const_cast<QColor*>(&color)); };
+	 ~MyQSplashScreen() { callbackQSplashScreen_DestroyQSplashScreen(this); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSplashScreen_NewQSplashScreen2(void* parent, void* pixmap, long long f)
+{
+	return new MyQSplashScreen(static_cast<QWidget*>(parent), *static_cast<QPixmap*>(pixmap), static_cast<Qt::WindowType>(f));
+}
+
+void* QSplashScreen_NewQSplashScreen(void* pixmap, long long f)
+{
+	return new MyQSplashScreen(*static_cast<QPixmap*>(pixmap), static_cast<Qt::WindowType>(f));
+}
+
+void QSplashScreen_ClearMessage(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QSplashScreen*>(ptr), "clearMessage");
+}
+
+void QSplashScreen_ClearMessageDefault(void* ptr)
+{
+		static_cast<QSplashScreen*>(ptr)->QSplashScreen::clearMessage();
+}
+
+void QSplashScreen_DrawContents(void* ptr, void* painter)
+{
+	static_cast<QSplashScreen*>(ptr)->drawContents(static_cast<QPainter*>(painter));
+}
+
+void QSplashScreen_DrawContentsDefault(void* ptr, void* painter)
+{
+		static_cast<QSplashScreen*>(ptr)->QSplashScreen::drawContents(static_cast<QPainter*>(painter));
+}
+
+void QSplashScreen_Finish(void* ptr, void* mainWin)
+{
+		static_cast<QSplashScreen*>(ptr)->finish(static_cast<QWidget*>(mainWin));
+}
+
+void QSplashScreen_ConnectMessageChanged(void* ptr)
+{
+	QObject::connect(static_cast<QSplashScreen*>(ptr), static_cast<void (QSplashScreen::*)(const QString &)>(&QSplashScreen::messageChanged), static_cast<MyQSplashScreen*>(ptr), static_cast<void (MyQSplashScreen::*)(const QString &)>(&MyQSplashScreen::Signal_MessageChanged));
+}
+
+void QSplashScreen_DisconnectMessageChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QSplashScreen*>(ptr), static_cast<void (QSplashScreen::*)(const QString &)>(&QSplashScreen::messageChanged), static_cast<MyQSplashScreen*>(ptr), static_cast<void (MyQSplashScreen::*)(const QString &)>(&MyQSplashScreen::Signal_MessageChanged));
+}
+
+void QSplashScreen_MessageChanged(void* ptr, char* message)
+{
+	static_cast<QSplashScreen*>(ptr)->messageChanged(QString(message));
+}
+
+void QSplashScreen_Repaint(void* ptr)
+{
+	static_cast<QSplashScreen*>(ptr)->repaint();
+}
+
+void QSplashScreen_SetPixmap(void* ptr, void* pixmap)
+{
+	static_cast<QSplashScreen*>(ptr)->setPixmap(*static_cast<QPixmap*>(pixmap));
+}
+
+void QSplashScreen_ShowMessage(void* ptr, char* message, int alignment, void* color)
+{
+	QMetaObject::invokeMethod(static_cast<QSplashScreen*>(ptr), "showMessage", Q_ARG(QString, QString(message)), Q_ARG(int, alignment), Q_ARG(QColor, *static_cast<QColor*>(color)));
+}
+
+void QSplashScreen_ShowMessageDefault(void* ptr, char* message, int alignment, void* color)
+{
+		static_cast<QSplashScreen*>(ptr)->QSplashScreen::showMessage(QString(message), alignment, *static_cast<QColor*>(color));
+}
+
+void QSplashScreen_DestroyQSplashScreen(void* ptr)
+{
+	static_cast<QSplashScreen*>(ptr)->~QSplashScreen();
+}
+
+void QSplashScreen_DestroyQSplashScreenDefault(void* ptr)
+{
+
+}
+
+struct QtWidgets_PackedString QSplashScreen_Message(void* ptr)
+{
+	return ({ QByteArray tbae626 = static_cast<QSplashScreen*>(ptr)->message().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tbae626.prepend("WHITESPACE").constData()+10), tbae626.size()-10 }; });
+}
+
+void* QSplashScreen_Pixmap(void* ptr)
+{
+	return new QPixmap(static_cast<QSplashScreen*>(ptr)->pixmap());
+}
+
+class MyQSplitter: public QSplitter
+{
+public:
+	MyQSplitter(QWidget *parent) : QSplitter(parent) {};
+	MyQSplitter(Qt::Orientation orientation, QWidget *parent) : QSplitter(orientation, parent) {};
+	QSplitterHandle * createHandle() { return static_cast<QSplitterHandle*>(callbackQSplitter_CreateHandle(this)); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void resizeEvent(QResizeEvent * vqr) { callbackQWidget_ResizeEvent(this, vqr); };
+	void Signal_SplitterMoved(int pos, int index) { callbackQSplitter_SplitterMoved(this, pos, index); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSplitter_NewQSplitter(void* parent)
+{
+	return new MyQSplitter(static_cast<QWidget*>(parent));
+}
+
+void* QSplitter_NewQSplitter2(long long orientation, void* parent)
+{
+	return new MyQSplitter(static_cast<Qt::Orientation>(orientation), static_cast<QWidget*>(parent));
+}
+
+void* QSplitter_CreateHandle(void* ptr)
+{
+	return static_cast<QSplitter*>(ptr)->createHandle();
+}
+
+void* QSplitter_CreateHandleDefault(void* ptr)
+{
+		return static_cast<QSplitter*>(ptr)->QSplitter::createHandle();
+}
+
+char QSplitter_RestoreState(void* ptr, void* state)
+{
+	return static_cast<QSplitter*>(ptr)->restoreState(*static_cast<QByteArray*>(state));
+}
+
+int QSplitter_ClosestLegalPosition(void* ptr, int pos, int index)
+{
+	return static_cast<QSplitter*>(ptr)->closestLegalPosition(pos, index);
+}
+
+void QSplitter_AddWidget(void* ptr, void* widget)
+{
+		static_cast<QSplitter*>(ptr)->addWidget(static_cast<QWidget*>(widget));
+}
+
+void QSplitter_InsertWidget(void* ptr, int index, void* widget)
+{
+		static_cast<QSplitter*>(ptr)->insertWidget(index, static_cast<QWidget*>(widget));
+}
+
+void QSplitter_MoveSplitter(void* ptr, int pos, int index)
+{
+	static_cast<QSplitter*>(ptr)->moveSplitter(pos, index);
+}
+
+void QSplitter_Refresh(void* ptr)
+{
+	static_cast<QSplitter*>(ptr)->refresh();
+}
+
+void QSplitter_SetChildrenCollapsible(void* ptr, char vbo)
+{
+	static_cast<QSplitter*>(ptr)->setChildrenCollapsible(vbo != 0);
+}
+
+void QSplitter_SetCollapsible(void* ptr, int index, char collapse)
+{
+	static_cast<QSplitter*>(ptr)->setCollapsible(index, collapse != 0);
+}
+
+void QSplitter_SetHandleWidth(void* ptr, int vin)
+{
+	static_cast<QSplitter*>(ptr)->setHandleWidth(vin);
+}
+
+void QSplitter_SetOpaqueResize(void* ptr, char opaque)
+{
+	static_cast<QSplitter*>(ptr)->setOpaqueResize(opaque != 0);
+}
+
+void QSplitter_SetOrientation(void* ptr, long long vqt)
+{
+	static_cast<QSplitter*>(ptr)->setOrientation(static_cast<Qt::Orientation>(vqt));
+}
+
+void QSplitter_SetRubberBand(void* ptr, int pos)
+{
+	static_cast<QSplitter*>(ptr)->setRubberBand(pos);
+}
+
+void QSplitter_SetSizes(void* ptr, void* list)
+{
+	static_cast<QSplitter*>(ptr)->setSizes(*static_cast<QList<int>*>(list));
+}
+
+void QSplitter_SetStretchFactor(void* ptr, int index, int stretch)
+{
+	static_cast<QSplitter*>(ptr)->setStretchFactor(index, stretch);
+}
+
+void QSplitter_ConnectSplitterMoved(void* ptr)
+{
+	QObject::connect(static_cast<QSplitter*>(ptr), static_cast<void (QSplitter::*)(int, int)>(&QSplitter::splitterMoved), static_cast<MyQSplitter*>(ptr), static_cast<void (MyQSplitter::*)(int, int)>(&MyQSplitter::Signal_SplitterMoved));
+}
+
+void QSplitter_DisconnectSplitterMoved(void* ptr)
+{
+	QObject::disconnect(static_cast<QSplitter*>(ptr), static_cast<void (QSplitter::*)(int, int)>(&QSplitter::splitterMoved), static_cast<MyQSplitter*>(ptr), static_cast<void (MyQSplitter::*)(int, int)>(&MyQSplitter::Signal_SplitterMoved));
+}
+
+void QSplitter_SplitterMoved(void* ptr, int pos, int index)
+{
+	static_cast<QSplitter*>(ptr)->splitterMoved(pos, index);
+}
+
+void QSplitter_DestroyQSplitter(void* ptr)
+{
+	static_cast<QSplitter*>(ptr)->~QSplitter();
+}
+
+void* QSplitter_SaveState(void* ptr)
+{
+	return new QByteArray(static_cast<QSplitter*>(ptr)->saveState());
+}
+
+struct QtWidgets_PackedList QSplitter_Sizes(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QSplitter*>(ptr)->sizes()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QSplitter_Handle(void* ptr, int index)
+{
+	return static_cast<QSplitter*>(ptr)->handle(index);
+}
+
+void* QSplitter_Widget(void* ptr, int index)
+{
+	return static_cast<QSplitter*>(ptr)->widget(index);
+}
+
+long long QSplitter_Orientation(void* ptr)
+{
+	return static_cast<QSplitter*>(ptr)->orientation();
+}
+
+char QSplitter_ChildrenCollapsible(void* ptr)
+{
+	return static_cast<QSplitter*>(ptr)->childrenCollapsible();
+}
+
+char QSplitter_IsCollapsible(void* ptr, int index)
+{
+	return static_cast<QSplitter*>(ptr)->isCollapsible(index);
+}
+
+char QSplitter_OpaqueResize(void* ptr)
+{
+	return static_cast<QSplitter*>(ptr)->opaqueResize();
+}
+
+int QSplitter_Count(void* ptr)
+{
+	return static_cast<QSplitter*>(ptr)->count();
+}
+
+int QSplitter_HandleWidth(void* ptr)
+{
+	return static_cast<QSplitter*>(ptr)->handleWidth();
+}
+
+int QSplitter_IndexOf(void* ptr, void* widget)
+{
+		return static_cast<QSplitter*>(ptr)->indexOf(static_cast<QWidget*>(widget));
+}
+
+void QSplitter_GetRange(void* ptr, int index, int min, int max)
+{
+	static_cast<QSplitter*>(ptr)->getRange(index, &min, &max);
+}
+
+int QSplitter___setSizes_list_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QSplitter___setSizes_list_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QSplitter___setSizes_list_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QSplitter___setSizes_list_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QSplitter___setSizes_list_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QSplitter___sizes_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QSplitter___sizes_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QSplitter___sizes_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QSplitter___sizes_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QSplitter___sizes_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+class MyQSplitterHandle: public QSplitterHandle
+{
+public:
+	MyQSplitterHandle(Qt::Orientation orientation, QSplitter *parent) : QSplitterHandle(orientation, parent) {};
+	void mouseMoveEvent(QMouseEvent * e) { callbackQWidget_MouseMoveEvent(this, e); };
+	void mousePressEvent(QMouseEvent * e) { callbackQWidget_MousePressEvent(this, e); };
+	void mouseReleaseEvent(QMouseEvent * e) { callbackQWidget_MouseReleaseEvent(this, e); };
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QSplitterHandle_NewQSplitterHandle(long long orientation, void* parent)
+{
+	return new MyQSplitterHandle(static_cast<Qt::Orientation>(orientation), static_cast<QSplitter*>(parent));
+}
+
+int QSplitterHandle_ClosestLegalPosition(void* ptr, int pos)
+{
+	return static_cast<QSplitterHandle*>(ptr)->closestLegalPosition(pos);
+}
+
+void QSplitterHandle_MoveSplitter(void* ptr, int pos)
+{
+	static_cast<QSplitterHandle*>(ptr)->moveSplitter(pos);
+}
+
+void QSplitterHandle_SetOrientation(void* ptr, long long orientation)
+{
+	static_cast<QSplitterHandle*>(ptr)->setOrientation(static_cast<Qt::Orientation>(orientation));
+}
+
+void QSplitterHandle_DestroyQSplitterHandle(void* ptr)
+{
+	static_cast<QSplitterHandle*>(ptr)->~QSplitterHandle();
+}
+
+void* QSplitterHandle_Splitter(void* ptr)
+{
+	return static_cast<QSplitterHandle*>(ptr)->splitter();
+}
+
+long long QSplitterHandle_Orientation(void* ptr)
+{
+	return static_cast<QSplitterHandle*>(ptr)->orientation();
+}
+
+char QSplitterHandle_OpaqueResize(void* ptr)
+{
+	return static_cast<QSplitterHandle*>(ptr)->opaqueResize();
+}
+
+class MyQStackedLayout: public QStackedLayout
+{
+public:
+	MyQStackedLayout() : QStackedLayout() {};
+	MyQStackedLayout(QLayout *parentLayout) : QStackedLayout(parentLayout) {};
+	MyQStackedLayout(QWidget *parent) : QStackedLayout(parent) {};
+	QLayoutItem * takeAt(int index) { return static_cast<QLayoutItem*>(callbackQStackedLayout_TakeAt(this, index)); };
+	void addItem(QLayoutItem * item) { callbackQStackedLayout_AddItem(this, item); };
+	void Signal_CurrentChanged(int index) { callbackQStackedLayout_CurrentChanged(this, index); };
+	void setCurrentIndex(int index) { callbackQStackedLayout_SetCurrentIndex(this, index); };
+	void setCurrentWidget(QWidget * widget) { callbackQStackedLayout_SetCurrentWidget(this, widget); };
+	void setGeometry(const QRect & rect) { callbackQLayout_SetGeometry(this, const_cast<QRect*>(&rect)); };
+	void Signal_WidgetRemoved(int index) { callbackQStackedLayout_WidgetRemoved(this, index); };
+	QLayoutItem * itemAt(int index) const { return static_cast<QLayoutItem*>(callbackQStackedLayout_ItemAt(const_cast<void*>(static_cast<const void*>(this)), index)); };
+	QSize minimumSize() const { return *static_cast<QSize*>(callbackQLayout_MinimumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQStackedLayout_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQLayoutItem_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int count() const { return callbackQStackedLayout_Count(const_cast<void*>(static_cast<const void*>(this))); };
+	int heightForWidth(int width) const { return callbackQLayoutItem_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), width); };
+	QLayout * layout() { return static_cast<QLayout*>(callbackQLayoutItem_Layout(this)); };
+	void childEvent(QChildEvent * e) { callbackQLayout_ChildEvent(this, e); };
+	void invalidate() { callbackQLayoutItem_Invalidate(this); };
+	QRect geometry() const { return *static_cast<QRect*>(callbackQLayout_Geometry(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize maximumSize() const { return *static_cast<QSize*>(callbackQLayout_MaximumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSizePolicy::ControlTypes controlTypes() const { return static_cast<QSizePolicy::ControlType>(callbackQLayoutItem_ControlTypes(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::Orientations expandingDirections() const { return static_cast<Qt::Orientation>(callbackQLayout_ExpandingDirections(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool isEmpty() const { return callbackQLayout_IsEmpty(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int indexOf(QWidget * widget) const { return callbackQLayout_IndexOf(const_cast<void*>(static_cast<const void*>(this)), widget); };
+	bool event(QEvent * e) { return callbackQLayout_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQLayout_EventFilter(this, watched, event) != 0; };
+	void connectNotify(const QMetaMethod & sign) { callbackQLayout_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQLayout_CustomEvent(this, event); };
+	void deleteLater() { callbackQLayout_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQLayout_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQLayout_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQLayout_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQLayout_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQLayout_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSpacerItem * spacerItem() { return static_cast<QSpacerItem*>(callbackQLayoutItem_SpacerItem(this)); };
+	QWidget * widget() { return static_cast<QWidget*>(callbackQLayoutItem_Widget(this)); };
+	int minimumHeightForWidth(int w) const { return callbackQLayoutItem_MinimumHeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+};
+
+void* QStackedLayout_TakeAt(void* ptr, int index)
+{
+	return static_cast<QStackedLayout*>(ptr)->takeAt(index);
+}
+
+void* QStackedLayout_TakeAtDefault(void* ptr, int index)
+{
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::takeAt(index);
+}
+
+void* QStackedLayout_NewQStackedLayout()
+{
+	return new MyQStackedLayout();
+}
+
+void* QStackedLayout_NewQStackedLayout3(void* parentLayout)
+{
+	return new MyQStackedLayout(static_cast<QLayout*>(parentLayout));
+}
+
+void* QStackedLayout_NewQStackedLayout2(void* parent)
+{
+	return new MyQStackedLayout(static_cast<QWidget*>(parent));
+}
+
+int QStackedLayout_AddWidget(void* ptr, void* widget)
+{
+		return static_cast<QStackedLayout*>(ptr)->addWidget(static_cast<QWidget*>(widget));
+}
+
+int QStackedLayout_InsertWidget(void* ptr, int index, void* widget)
+{
+		return static_cast<QStackedLayout*>(ptr)->insertWidget(index, static_cast<QWidget*>(widget));
+}
+
+void QStackedLayout_AddItem(void* ptr, void* item)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(item))) {
+		static_cast<QStackedLayout*>(ptr)->addItem(static_cast<QLayout*>(item));
+	} else {
+		static_cast<QStackedLayout*>(ptr)->addItem(static_cast<QLayoutItem*>(item));
+	}
+}
+
+void QStackedLayout_AddItemDefault(void* ptr, void* item)
+{
+	if (dynamic_cast<QLayout*>(static_cast<QObject*>(item))) {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::addItem(static_cast<QLayout*>(item));
+	} else {
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::addItem(static_cast<QLayoutItem*>(item));
+	}
+}
+
+void QStackedLayout_ConnectCurrentChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStackedLayout*>(ptr), static_cast<void (QStackedLayout::*)(int)>(&QStackedLayout::currentChanged), static_cast<MyQStackedLayout*>(ptr), static_cast<void (MyQStackedLayout::*)(int)>(&MyQStackedLayout::Signal_CurrentChanged));
+}
+
+void QStackedLayout_DisconnectCurrentChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStackedLayout*>(ptr), static_cast<void (QStackedLayout::*)(int)>(&QStackedLayout::currentChanged), static_cast<MyQStackedLayout*>(ptr), static_cast<void (MyQStackedLayout::*)(int)>(&MyQStackedLayout::Signal_CurrentChanged));
+}
+
+void QStackedLayout_CurrentChanged(void* ptr, int index)
+{
+	static_cast<QStackedLayout*>(ptr)->currentChanged(index);
+}
+
+void QStackedLayout_SetCurrentIndex(void* ptr, int index)
+{
+	QMetaObject::invokeMethod(static_cast<QStackedLayout*>(ptr), "setCurrentIndex", Q_ARG(int, index));
+}
+
+void QStackedLayout_SetCurrentIndexDefault(void* ptr, int index)
+{
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::setCurrentIndex(index);
+}
+
+void QStackedLayout_SetCurrentWidget(void* ptr, void* widget)
+{
+		QMetaObject::invokeMethod(static_cast<QStackedLayout*>(ptr), "setCurrentWidget", Q_ARG(QWidget*, static_cast<QWidget*>(widget)));
+}
+
+void QStackedLayout_SetCurrentWidgetDefault(void* ptr, void* widget)
+{
+		static_cast<QStackedLayout*>(ptr)->QStackedLayout::setCurrentWidget(static_cast<QWidget*>(widget));
+}
+
+void QStackedLayout_SetStackingMode(void* ptr, long long stackingMode)
+{
+	static_cast<QStackedLayout*>(ptr)->setStackingMode(static_cast<QStackedLayout::StackingMode>(stackingMode));
+}
+
+void QStackedLayout_ConnectWidgetRemoved(void* ptr)
+{
+	QObject::connect(static_cast<QStackedLayout*>(ptr), static_cast<void (QStackedLayout::*)(int)>(&QStackedLayout::widgetRemoved), static_cast<MyQStackedLayout*>(ptr), static_cast<void (MyQStackedLayout::*)(int)>(&MyQStackedLayout::Signal_WidgetRemoved));
+}
+
+void QStackedLayout_DisconnectWidgetRemoved(void* ptr)
+{
+	QObject::disconnect(static_cast<QStackedLayout*>(ptr), static_cast<void (QStackedLayout::*)(int)>(&QStackedLayout::widgetRemoved), static_cast<MyQStackedLayout*>(ptr), static_cast<void (MyQStackedLayout::*)(int)>(&MyQStackedLayout::Signal_WidgetRemoved));
+}
+
+void QStackedLayout_WidgetRemoved(void* ptr, int index)
+{
+	static_cast<QStackedLayout*>(ptr)->widgetRemoved(index);
+}
+
+void QStackedLayout_DestroyQStackedLayout(void* ptr)
+{
+	static_cast<QStackedLayout*>(ptr)->~QStackedLayout();
+}
+
+void* QStackedLayout_ItemAt(void* ptr, int index)
+{
+	return static_cast<QStackedLayout*>(ptr)->itemAt(index);
+}
+
+void* QStackedLayout_ItemAtDefault(void* ptr, int index)
+{
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::itemAt(index);
+}
+
+void* QStackedLayout_SizeHint(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QStackedLayout*>(ptr)->sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QStackedLayout_SizeHintDefault(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QStackedLayout*>(ptr)->QStackedLayout::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QStackedLayout_CurrentWidget(void* ptr)
+{
+	return static_cast<QStackedLayout*>(ptr)->currentWidget();
+}
+
+void* QStackedLayout_Widget(void* ptr, int index)
+{
+	return static_cast<QStackedLayout*>(ptr)->widget(index);
+}
+
+long long QStackedLayout_StackingMode(void* ptr)
+{
+	return static_cast<QStackedLayout*>(ptr)->stackingMode();
+}
+
+int QStackedLayout_Count(void* ptr)
+{
+	return static_cast<QStackedLayout*>(ptr)->count();
+}
+
+int QStackedLayout_CountDefault(void* ptr)
+{
+		return static_cast<QStackedLayout*>(ptr)->QStackedLayout::count();
+}
+
+int QStackedLayout_CurrentIndex(void* ptr)
+{
+	return static_cast<QStackedLayout*>(ptr)->currentIndex();
+}
+
+class MyQStackedWidget: public QStackedWidget
+{
+public:
+	MyQStackedWidget(QWidget *parent) : QStackedWidget(parent) {};
+	void Signal_CurrentChanged(int index) { callbackQStackedWidget_CurrentChanged(this, index); };
+	void setCurrentIndex(int index) { callbackQStackedWidget_SetCurrentIndex(this, index); };
+	void setCurrentWidget(QWidget * widget) { callbackQStackedWidget_SetCurrentWidget(this, widget); };
+	void Signal_WidgetRemoved(int index) { callbackQStackedWidget_WidgetRemoved(this, index); };
+	void changeEvent(QEvent * ev) { callbackQWidget_ChangeEvent(this, ev); };
+	void paintEvent(QPaintEvent * vqp) { callbackQWidget_PaintEvent(this, vqp); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QStackedWidget_NewQStackedWidget(void* parent)
+{
+	return new MyQStackedWidget(static_cast<QWidget*>(parent));
+}
+
+int QStackedWidget_AddWidget(void* ptr, void* widget)
+{
+		return static_cast<QStackedWidget*>(ptr)->addWidget(static_cast<QWidget*>(widget));
+}
+
+int QStackedWidget_InsertWidget(void* ptr, int index, void* widget)
+{
+		return static_cast<QStackedWidget*>(ptr)->insertWidget(index, static_cast<QWidget*>(widget));
+}
+
+void QStackedWidget_ConnectCurrentChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStackedWidget*>(ptr), static_cast<void (QStackedWidget::*)(int)>(&QStackedWidget::currentChanged), static_cast<MyQStackedWidget*>(ptr), static_cast<void (MyQStackedWidget::*)(int)>(&MyQStackedWidget::Signal_CurrentChanged));
+}
+
+void QStackedWidget_DisconnectCurrentChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStackedWidget*>(ptr), static_cast<void (QStackedWidget::*)(int)>(&QStackedWidget::currentChanged), static_cast<MyQStackedWidget*>(ptr), static_cast<void (MyQStackedWidget::*)(int)>(&MyQStackedWidget::Signal_CurrentChanged));
+}
+
+void QStackedWidget_CurrentChanged(void* ptr, int index)
+{
+	static_cast<QStackedWidget*>(ptr)->currentChanged(index);
+}
+
+void QStackedWidget_RemoveWidget(void* ptr, void* widget)
+{
+		static_cast<QStackedWidget*>(ptr)->removeWidget(static_cast<QWidget*>(widget));
+}
+
+void QStackedWidget_SetCurrentIndex(void* ptr, int index)
+{
+	QMetaObject::invokeMethod(static_cast<QStackedWidget*>(ptr), "setCurrentIndex", Q_ARG(int, index));
+}
+
+void QStackedWidget_SetCurrentIndexDefault(void* ptr, int index)
+{
+		static_cast<QStackedWidget*>(ptr)->QStackedWidget::setCurrentIndex(index);
+}
+
+void QStackedWidget_SetCurrentWidget(void* ptr, void* widget)
+{
+		QMetaObject::invokeMethod(static_cast<QStackedWidget*>(ptr), "setCurrentWidget", Q_ARG(QWidget*, static_cast<QWidget*>(widget)));
+}
+
+void QStackedWidget_SetCurrentWidgetDefault(void* ptr, void* widget)
+{
+		static_cast<QStackedWidget*>(ptr)->QStackedWidget::setCurrentWidget(static_cast<QWidget*>(widget));
+}
+
+void QStackedWidget_ConnectWidgetRemoved(void* ptr)
+{
+	QObject::connect(static_cast<QStackedWidget*>(ptr), static_cast<void (QStackedWidget::*)(int)>(&QStackedWidget::widgetRemoved), static_cast<MyQStackedWidget*>(ptr), static_cast<void (MyQStackedWidget::*)(int)>(&MyQStackedWidget::Signal_WidgetRemoved));
+}
+
+void QStackedWidget_DisconnectWidgetRemoved(void* ptr)
+{
+	QObject::disconnect(static_cast<QStackedWidget*>(ptr), static_cast<void (QStackedWidget::*)(int)>(&QStackedWidget::widgetRemoved), static_cast<MyQStackedWidget*>(ptr), static_cast<void (MyQStackedWidget::*)(int)>(&MyQStackedWidget::Signal_WidgetRemoved));
+}
+
+void QStackedWidget_WidgetRemoved(void* ptr, int index)
+{
+	static_cast<QStackedWidget*>(ptr)->widgetRemoved(index);
+}
+
+void QStackedWidget_DestroyQStackedWidget(void* ptr)
+{
+	static_cast<QStackedWidget*>(ptr)->~QStackedWidget();
+}
+
+void* QStackedWidget_CurrentWidget(void* ptr)
+{
+	return static_cast<QStackedWidget*>(ptr)->currentWidget();
+}
+
+void* QStackedWidget_Widget(void* ptr, int index)
+{
+	return static_cast<QStackedWidget*>(ptr)->widget(index);
+}
+
+int QStackedWidget_Count(void* ptr)
+{
+	return static_cast<QStackedWidget*>(ptr)->count();
+}
+
+int QStackedWidget_CurrentIndex(void* ptr)
+{
+	return static_cast<QStackedWidget*>(ptr)->currentIndex();
+}
+
+int QStackedWidget_IndexOf(void* ptr, void* widget)
+{
+		return static_cast<QStackedWidget*>(ptr)->indexOf(static_cast<QWidget*>(widget));
+}
+
+class MyQStatusBar: public QStatusBar
+{
+public:
+	MyQStatusBar(QWidget *parent) : QStatusBar(parent) {};
+	void clearMessage() { callbackQStatusBar_ClearMessage(this); };
+	void Signal_MessageChanged(const QString & message) { QByteArray t6f9b9a = message.toUtf8(); QtWidgets_PackedString messagePacked = { const_cast<char*>(t6f9b9a.prepend("WHITESPACE").constData()+10), t6f9b9a.size()-10 };callbackQStatusBar_MessageChanged(this, messagePacked); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void resizeEvent(QResizeEvent * e) { callbackQWidget_ResizeEvent(this, e); };
+	void showEvent(QShowEvent * vqs) { callbackQWidget_ShowEvent(this, vqs); };
+	void showMessage(const QString & message, int timeout) { QByteArray t6f9b9a = message.toUtf8(); QtWidgets_PackedString messagePacked = { const_cast<char*>(t6f9b9a.prepend("WHITESPACE").constData()+10), t6f9b9a.size()-10 };callbackQStatusBar_ShowMessage(this, messagePacked, timeout); };
+	 ~MyQStatusBar() { callbackQStatusBar_DestroyQStatusBar(this); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QStatusBar_NewQStatusBar(void* parent)
+{
+	return new MyQStatusBar(static_cast<QWidget*>(parent));
+}
+
+int QStatusBar_InsertPermanentWidget(void* ptr, int index, void* widget, int stretch)
+{
+		return static_cast<QStatusBar*>(ptr)->insertPermanentWidget(index, static_cast<QWidget*>(widget), stretch);
+}
+
+int QStatusBar_InsertWidget(void* ptr, int index, void* widget, int stretch)
+{
+		return static_cast<QStatusBar*>(ptr)->insertWidget(index, static_cast<QWidget*>(widget), stretch);
+}
+
+void QStatusBar_AddPermanentWidget(void* ptr, void* widget, int stretch)
+{
+		static_cast<QStatusBar*>(ptr)->addPermanentWidget(static_cast<QWidget*>(widget), stretch);
+}
+
+void QStatusBar_AddWidget(void* ptr, void* widget, int stretch)
+{
+		static_cast<QStatusBar*>(ptr)->addWidget(static_cast<QWidget*>(widget), stretch);
+}
+
+void QStatusBar_ClearMessage(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QStatusBar*>(ptr), "clearMessage");
+}
+
+void QStatusBar_ClearMessageDefault(void* ptr)
+{
+		static_cast<QStatusBar*>(ptr)->QStatusBar::clearMessage();
+}
+
+void QStatusBar_HideOrShow(void* ptr)
+{
+	static_cast<QStatusBar*>(ptr)->hideOrShow();
+}
+
+void QStatusBar_ConnectMessageChanged(void* ptr)
+{
+	QObject::connect(static_cast<QStatusBar*>(ptr), static_cast<void (QStatusBar::*)(const QString &)>(&QStatusBar::messageChanged), static_cast<MyQStatusBar*>(ptr), static_cast<void (MyQStatusBar::*)(const QString &)>(&MyQStatusBar::Signal_MessageChanged));
+}
+
+void QStatusBar_DisconnectMessageChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QStatusBar*>(ptr), static_cast<void (QStatusBar::*)(const QString &)>(&QStatusBar::messageChanged), static_cast<MyQStatusBar*>(ptr), static_cast<void (MyQStatusBar::*)(const QString &)>(&MyQStatusBar::Signal_MessageChanged));
+}
+
+void QStatusBar_MessageChanged(void* ptr, char* message)
+{
+	static_cast<QStatusBar*>(ptr)->messageChanged(QString(message));
+}
+
+void QStatusBar_Reformat(void* ptr)
+{
+	static_cast<QStatusBar*>(ptr)->reformat();
+}
+
+void QStatusBar_RemoveWidget(void* ptr, void* widget)
+{
+		static_cast<QStatusBar*>(ptr)->removeWidget(static_cast<QWidget*>(widget));
+}
+
+void QStatusBar_SetSizeGripEnabled(void* ptr, char vbo)
+{
+	static_cast<QStatusBar*>(ptr)->setSizeGripEnabled(vbo != 0);
+}
+
+void QStatusBar_ShowMessage(void* ptr, char* message, int timeout)
+{
+	QMetaObject::invokeMethod(static_cast<QStatusBar*>(ptr), "showMessage", Q_ARG(QString, QString(message)), Q_ARG(int, timeout));
+}
+
+void QStatusBar_ShowMessageDefault(void* ptr, char* message, int timeout)
+{
+		static_cast<QStatusBar*>(ptr)->QStatusBar::showMessage(QString(message), timeout);
+}
+
+void QStatusBar_DestroyQStatusBar(void* ptr)
+{
+	static_cast<QStatusBar*>(ptr)->~QStatusBar();
+}
+
+void QStatusBar_DestroyQStatusBarDefault(void* ptr)
+{
+
+}
+
+struct QtWidgets_PackedString QStatusBar_CurrentMessage(void* ptr)
+{
+	return ({ QByteArray t40367b = static_cast<QStatusBar*>(ptr)->currentMessage().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t40367b.prepend("WHITESPACE").constData()+10), t40367b.size()-10 }; });
+}
+
+char QStatusBar_IsSizeGripEnabled(void* ptr)
+{
+	return static_cast<QStatusBar*>(ptr)->isSizeGripEnabled();
+}
+
+class MyQStyle: public QStyle
+{
+public:
+	MyQStyle() : QStyle() {};
+	void polish(QApplication * application) { callbackQStyle_Polish2(this, application); };
+	void polish(QPalette & palette) { callbackQStyle_Polish3(this, static_cast<QPalette*>(&palette)); };
+	void polish(QWidget * widget) { callbackQStyle_Polish(this, widget); };
+	void unpolish(QApplication * application) { callbackQStyle_Unpolish2(this, application); };
+	void unpolish(QWidget * widget) { callbackQStyle_Unpolish(this, widget); };
+	 ~MyQStyle() { callbackQStyle_DestroyQStyle(this); };
+	QIcon standardIcon(QStyle::StandardPixmap standardIcon, const QStyleOption * option, const QWidget * widget) const { return *static_cast<QIcon*>(callbackQStyle_StandardIcon(const_cast<void*>(static_cast<const void*>(this)), standardIcon, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget))); };
+	QPalette standardPalette() const { return *static_cast<QPalette*>(callbackQStyle_StandardPalette(const_cast<void*>(static_cast<const void*>(this)))); };
+	QPixmap generatedIconPixmap(QIcon::Mode iconMode, const QPixmap & pixmap, const QStyleOption * option) const { return *static_cast<QPixmap*>(callbackQStyle_GeneratedIconPixmap(const_cast<void*>(static_cast<const void*>(this)), iconMode, const_cast<QPixmap*>(&pixmap), const_cast<QStyleOption*>(option))); };
+	QRect itemPixmapRect(const QRect & rectangle, int alignment, const QPixmap & pixmap) const { return *static_cast<QRect*>(callbackQStyle_ItemPixmapRect(const_cast<void*>(static_cast<const void*>(this)), const_cast<QRect*>(&rectangle), alignment, const_cast<QPixmap*>(&pixmap))); };
+	QRect itemTextRect(const QFontMetrics & metrics, const QRect & rectangle, int alignment, bool enabled, const QString & text) const { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };return *static_cast<QRect*>(callbackQStyle_ItemTextRect(const_cast<void*>(static_cast<const void*>(this)), const_cast<QFontMetrics*>(&metrics), const_cast<QRect*>(&rectangle), alignment, enabled, textPacked)); };
+	QRect subControlRect(QStyle::ComplexControl control, const QStyleOptionComplex * option, QStyle::SubControl subControl, const QWidget * widget) const { return *static_cast<QRect*>(callbackQStyle_SubControlRect(const_cast<void*>(static_cast<const void*>(this)), control, const_cast<QStyleOptionComplex*>(option), subControl, const_cast<QWidget*>(widget))); };
+	QRect subElementRect(QStyle::SubElement element, const QStyleOption * option, const QWidget * widget) const { return *static_cast<QRect*>(callbackQStyle_SubElementRect(const_cast<void*>(static_cast<const void*>(this)), element, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget))); };
+	QSize sizeFromContents(QStyle::ContentsType ty, const QStyleOption * option, const QSize & contentsSize, const QWidget * widget) const { return *static_cast<QSize*>(callbackQStyle_SizeFromContents(const_cast<void*>(static_cast<const void*>(this)), ty, const_cast<QStyleOption*>(option), const_cast<QSize*>(&contentsSize), const_cast<QWidget*>(widget))); };
+	SubControl hitTestComplexControl(QStyle::ComplexControl control, const QStyleOptionComplex * option, const QPoint & position, const QWidget * widget) const { return static_cast<QStyle::SubControl>(callbackQStyle_HitTestComplexControl(const_cast<void*>(static_cast<const void*>(this)), control, const_cast<QStyleOptionComplex*>(option), const_cast<QPoint*>(&position), const_cast<QWidget*>(widget))); };
+	int layoutSpacing(QSizePolicy::ControlType control1, QSizePolicy::ControlType control2, Qt::Orientation orientation, const QStyleOption * option, const QWidget * widget) const { return callbackQStyle_LayoutSpacing(const_cast<void*>(static_cast<const void*>(this)), control1, control2, orientation, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget)); };
+	int pixelMetric(QStyle::PixelMetric metric, const QStyleOption * option, const QWidget * widget) const { return callbackQStyle_PixelMetric(const_cast<void*>(static_cast<const void*>(this)), metric, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget)); };
+	int styleHint(QStyle::StyleHint hint, const QStyleOption * option, const QWidget * widget, QStyleHintReturn * returnData) const { return callbackQStyle_StyleHint(const_cast<void*>(static_cast<const void*>(this)), hint, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget), returnData); };
+	void drawComplexControl(QStyle::ComplexControl control, const QStyleOptionComplex * option, QPainter * painter, const QWidget * widget) const { callbackQStyle_DrawComplexControl(const_cast<void*>(static_cast<const void*>(this)), control, const_cast<QStyleOptionComplex*>(option), painter, const_cast<QWidget*>(widget)); };
+	void drawControl(QStyle::ControlElement element, const QStyleOption * option, QPainter * painter, const QWidget * widget) const { callbackQStyle_DrawControl(const_cast<void*>(static_cast<const void*>(this)), element, const_cast<QStyleOption*>(option), painter, const_cast<QWidget*>(widget)); };
+	void drawItemPixmap(QPainter * painter, const QRect & rectangle, int alignment, const QPixmap & pixmap) const { callbackQStyle_DrawItemPixmap(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QRect*>(&rectangle), alignment, const_cast<QPixmap*>(&pixmap)); };
+	void drawItemText(QPainter * painter, const QRect & rectangle, int alignment, const QPalette & palette, bool enabled, const QString & text, QPalette::ColorRole textRole) const { QByteArray t372ea0 = text.toUtf8(); QtWidgets_PackedString textPacked = { const_cast<char*>(t372ea0.prepend("WHITESPACE").constData()+10), t372ea0.size()-10 };callbackQStyle_DrawItemText(const_cast<void*>(static_cast<const void*>(this)), painter, const_cast<QRect*>(&rectangle), alignment, const_cast<QPalette*>(&palette), enabled, textPacked, textRole); };
+	void drawPrimitive(QStyle::PrimitiveElement element, const QStyleOption * option, QPainter * painter, const QWidget * widget) const { callbackQStyle_DrawPrimitive(const_cast<void*>(static_cast<const void*>(this)), element, const_cast<QStyleOption*>(option), painter, const_cast<QWidget*>(widget)); };
+	QPixmap standardPixmap(QStyle::StandardPixmap standardIcon, const QStyleOption * option, const QWidget * widget) const { return *static_cast<QPixmap*>(callbackQStyle_StandardPixmap(const_cast<void*>(static_cast<const void*>(this)), standardIcon, const_cast<QStyleOption*>(option), const_cast<QWidget*>(widget))); };
+	bool event(QEvent * e) { return callbackQStyle_Event(this, e) != 0; };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQStyle_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQStyle_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQStyle_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQStyle_CustomEvent(this, event); };
+	void deleteLater() { callbackQStyle_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQStyle_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQStyle_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQStyle_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQStyle_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQStyle_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+int QStyle_PM_MdiSubWindowMinimizedWidth_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_MdiSubWindowMinimizedWidth;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_HeaderMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_HeaderMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_HeaderMarkSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_HeaderMarkSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_HeaderGripMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_HeaderGripMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TabBarTabShiftHorizontal_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TabBarTabShiftHorizontal;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TabBarTabShiftVertical_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TabBarTabShiftVertical;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TabBarScrollButtonWidth_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TabBarScrollButtonWidth;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ToolBarFrameWidth_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ToolBarFrameWidth;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ToolBarHandleExtent_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ToolBarHandleExtent;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ToolBarItemSpacing_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ToolBarItemSpacing;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ToolBarItemMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ToolBarItemMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ToolBarSeparatorExtent_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ToolBarSeparatorExtent;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ToolBarExtensionExtent_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ToolBarExtensionExtent;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_SpinBoxSliderHeight_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_SpinBoxSliderHeight;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_DefaultTopLevelMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_DefaultTopLevelMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_DefaultChildMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_DefaultChildMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_DefaultLayoutSpacing_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_DefaultLayoutSpacing;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ToolBarIconSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ToolBarIconSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ListViewIconSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ListViewIconSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_IconViewIconSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_IconViewIconSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_SmallIconSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_SmallIconSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_LargeIconSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_LargeIconSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_FocusFrameVMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_FocusFrameVMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_FocusFrameHMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_FocusFrameHMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ToolTipLabelFrameWidth_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ToolTipLabelFrameWidth;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_CheckBoxLabelSpacing_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_CheckBoxLabelSpacing;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TabBarIconSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TabBarIconSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_SizeGripSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_SizeGripSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_DockWidgetTitleMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_DockWidgetTitleMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_MessageBoxIconSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_MessageBoxIconSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ButtonIconSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ButtonIconSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_DockWidgetTitleBarButtonMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_DockWidgetTitleBarButtonMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_RadioButtonLabelSpacing_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_RadioButtonLabelSpacing;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_LayoutLeftMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_LayoutLeftMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_LayoutTopMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_LayoutTopMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_LayoutRightMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_LayoutRightMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_LayoutBottomMargin_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_LayoutBottomMargin;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_LayoutHorizontalSpacing_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_LayoutHorizontalSpacing;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_LayoutVerticalSpacing_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_LayoutVerticalSpacing;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TabBar_ScrollButtonOverlap_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TabBar_ScrollButtonOverlap;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TextCursorWidth_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TextCursorWidth;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TabCloseIndicatorWidth_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TabCloseIndicatorWidth;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TabCloseIndicatorHeight_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TabCloseIndicatorHeight;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ScrollView_ScrollBarSpacing_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ScrollView_ScrollBarSpacing;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_ScrollView_ScrollBarOverlap_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_ScrollView_ScrollBarOverlap;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_SubMenuOverlap_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_SubMenuOverlap;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TreeViewIndentation_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TreeViewIndentation;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_HeaderDefaultSectionSizeHorizontal_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_HeaderDefaultSectionSizeHorizontal;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_HeaderDefaultSectionSizeVertical_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_HeaderDefaultSectionSizeVertical;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TitleBarButtonIconSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TitleBarButtonIconSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PM_TitleBarButtonSize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::PM_TitleBarButtonSize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_FrameTabWidget_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_FrameTabWidget;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_FrameWindow_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_FrameWindow;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_FrameButtonBevel_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_FrameButtonBevel;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_FrameButtonTool_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_FrameButtonTool;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_FrameTabBarBase_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_FrameTabBarBase;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelButtonCommand_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelButtonCommand;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelButtonBevel_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelButtonBevel;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelButtonTool_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelButtonTool;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelMenuBar_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelMenuBar;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelToolBar_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelToolBar;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelLineEdit_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelLineEdit;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorArrowDown_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorArrowDown;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorArrowLeft_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorArrowLeft;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorArrowRight_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorArrowRight;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorArrowUp_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorArrowUp;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorBranch_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorBranch;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorButtonDropDown_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorButtonDropDown;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorViewItemCheck_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorViewItemCheck;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorCheckBox_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorCheckBox;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorDockWidgetResizeHandle_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorDockWidgetResizeHandle;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorHeaderArrow_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorHeaderArrow;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorMenuCheckMark_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorMenuCheckMark;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorProgressChunk_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorProgressChunk;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorRadioButton_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorRadioButton;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorSpinDown_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorSpinDown;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorSpinMinus_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorSpinMinus;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorSpinPlus_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorSpinPlus;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorSpinUp_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorSpinUp;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorToolBarHandle_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorToolBarHandle;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorToolBarSeparator_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorToolBarSeparator;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelTipLabel_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelTipLabel;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorTabTear_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorTabTear;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelScrollAreaCorner_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelScrollAreaCorner;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_Widget_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_Widget;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorColumnViewArrow_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorColumnViewArrow;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorItemViewItemDrop_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorItemViewItemDrop;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelItemViewItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelItemViewItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelItemViewRow_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelItemViewRow;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelStatusBar_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelStatusBar;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorTabClose_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorTabClose;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_PanelMenu_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_PanelMenu;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_PE_IndicatorTabTearRight_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::PE_IndicatorTabTearRight;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_BlinkCursorWhenTextSelected_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_BlinkCursorWhenTextSelected;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_RichText_FullWidthSelection_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_RichText_FullWidthSelection;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_Scrollable_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_Scrollable;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_GroupBox_TextLabelVerticalAlignment_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_GroupBox_TextLabelVerticalAlignment;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_GroupBox_TextLabelColor_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_GroupBox_TextLabelColor;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_SloppySubMenus_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_SloppySubMenus;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Table_GridLineColor_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Table_GridLineColor;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_LineEdit_PasswordCharacter_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_LineEdit_PasswordCharacter;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_DialogButtons_DefaultButton_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_DialogButtons_DefaultButton;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ToolBox_SelectedPageTitleBold_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ToolBox_SelectedPageTitleBold;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_TabBar_PreferNoArrows_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_TabBar_PreferNoArrows;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ScrollBar_LeftClickAbsolutePosition_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ScrollBar_LeftClickAbsolutePosition;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ListViewExpand_SelectMouseType_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ListViewExpand_SelectMouseType;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_UnderlineShortcut_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_UnderlineShortcut;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_SpinBox_AnimateButton_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_SpinBox_AnimateButton;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_SpinBox_KeyPressAutoRepeatRate_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_SpinBox_KeyPressAutoRepeatRate;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_SpinBox_ClickAutoRepeatRate_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_SpinBox_ClickAutoRepeatRate;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_FillScreenWithScroll_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_FillScreenWithScroll;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ToolTipLabel_Opacity_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ToolTipLabel_Opacity;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_DrawMenuBarSeparator_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_DrawMenuBarSeparator;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_TitleBar_ModifyNotification_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_TitleBar_ModifyNotification;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Button_FocusPolicy_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Button_FocusPolicy;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_MessageBox_UseBorderForButtonSpacing_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_MessageBox_UseBorderForButtonSpacing;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_TitleBar_AutoRaise_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_TitleBar_AutoRaise;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ToolButton_PopupDelay_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ToolButton_PopupDelay;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_FocusFrame_Mask_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_FocusFrame_Mask;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_RubberBand_Mask_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_RubberBand_Mask;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_WindowFrame_Mask_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_WindowFrame_Mask;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_SpinControls_DisableOnBounds_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_SpinControls_DisableOnBounds;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Dial_BackgroundRole_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Dial_BackgroundRole;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ComboBox_LayoutDirection_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ComboBox_LayoutDirection;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ItemView_EllipsisLocation_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ItemView_EllipsisLocation;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ItemView_ShowDecorationSelected_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ItemView_ShowDecorationSelected;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ItemView_ActivateItemOnSingleClick_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ItemView_ActivateItemOnSingleClick;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ScrollBar_ContextMenu_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ScrollBar_ContextMenu;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ScrollBar_RollBetweenButtons_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ScrollBar_RollBetweenButtons;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Slider_AbsoluteSetButtons_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Slider_AbsoluteSetButtons;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Slider_PageSetButtons_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Slider_PageSetButtons;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_KeyboardSearch_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_KeyboardSearch;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_TabBar_ElideMode_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_TabBar_ElideMode;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_DialogButtonLayout_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_DialogButtonLayout;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ComboBox_PopupFrameStyle_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ComboBox_PopupFrameStyle;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_MessageBox_TextInteractionFlags_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_MessageBox_TextInteractionFlags;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_DialogButtonBox_ButtonsHaveIcons_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_DialogButtonBox_ButtonsHaveIcons;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_SpellCheckUnderlineStyle_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_SpellCheckUnderlineStyle;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_MessageBox_CenterButtons_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_MessageBox_CenterButtons;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_SelectionWrap_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_SelectionWrap;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ItemView_MovementWithoutUpdatingSelection_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ItemView_MovementWithoutUpdatingSelection;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ToolTip_Mask_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ToolTip_Mask;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_FocusFrame_AboveWidget_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_FocusFrame_AboveWidget;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_TextControl_FocusIndicatorTextCharFormat_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_TextControl_FocusIndicatorTextCharFormat;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_WizardStyle_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_WizardStyle;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ItemView_ArrowKeysNavigateIntoChildren_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ItemView_ArrowKeysNavigateIntoChildren;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_Mask_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_Mask;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_FlashTriggeredItem_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_FlashTriggeredItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_FadeOutOnHide_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_FadeOutOnHide;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_SpinBox_ClickAutoRepeatThreshold_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_SpinBox_ClickAutoRepeatThreshold;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ItemView_PaintAlternatingRowColorsForEmptyArea_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ItemView_PaintAlternatingRowColorsForEmptyArea;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_FormLayoutWrapPolicy_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_FormLayoutWrapPolicy;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_TabWidget_DefaultTabPosition_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_TabWidget_DefaultTabPosition;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ToolBar_Movable_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ToolBar_Movable;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_FormLayoutFieldGrowthPolicy_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_FormLayoutFieldGrowthPolicy;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_FormLayoutFormAlignment_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_FormLayoutFormAlignment;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_FormLayoutLabelAlignment_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_FormLayoutLabelAlignment;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ItemView_DrawDelegateFrame_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ItemView_DrawDelegateFrame;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_TabBar_CloseButtonPosition_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_TabBar_CloseButtonPosition;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_DockWidget_ButtonsHaveFrame_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_DockWidget_ButtonsHaveFrame;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ToolButtonStyle_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ToolButtonStyle;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_RequestSoftwareInputPanel_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_RequestSoftwareInputPanel;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ScrollBar_Transient_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ScrollBar_Transient;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_SupportsSections_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_SupportsSections;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ToolTip_WakeUpDelay_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ToolTip_WakeUpDelay;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ToolTip_FallAsleepDelay_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ToolTip_FallAsleepDelay;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Widget_Animate_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Widget_Animate;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Splitter_OpaqueResize_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Splitter_OpaqueResize;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ComboBox_UseNativePopup_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ComboBox_UseNativePopup;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_LineEdit_PasswordMaskDelay_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_LineEdit_PasswordMaskDelay;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_TabBar_ChangeCurrentDelay_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_TabBar_ChangeCurrentDelay;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_SubMenuUniDirection_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_SubMenuUniDirection;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_SubMenuUniDirectionFailCount_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_SubMenuUniDirectionFailCount;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_SubMenuSloppySelectOtherActions_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_SubMenuSloppySelectOtherActions;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_SubMenuSloppyCloseTimeout_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_SubMenuSloppyCloseTimeout;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_SubMenuResetWhenReenteringParent_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_SubMenuResetWhenReenteringParent;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_Menu_SubMenuDontStartSloppyOnLeave_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_Menu_SubMenuDontStartSloppyOnLeave;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SH_ItemView_ScrollMode_Type()
+{
+	#if QT_VERSION >= 0x056000
+		return QStyle::SH_ItemView_ScrollMode;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_TabBarTearIndicator_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_TabBarTearIndicator;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_TreeViewDisclosureItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_TreeViewDisclosureItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_LineEditContents_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_LineEditContents;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_FrameContents_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_FrameContents;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_DockWidgetCloseButton_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_DockWidgetCloseButton;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_DockWidgetFloatButton_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_DockWidgetFloatButton;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_DockWidgetTitleBarText_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_DockWidgetTitleBarText;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_DockWidgetIcon_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_DockWidgetIcon;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_CheckBoxLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_CheckBoxLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_ComboBoxLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_ComboBoxLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_DateTimeEditLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_DateTimeEditLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_DialogButtonBoxLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_DialogButtonBoxLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_LabelLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_LabelLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_ProgressBarLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_ProgressBarLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_PushButtonLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_PushButtonLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_RadioButtonLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_RadioButtonLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_SliderLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_SliderLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_SpinBoxLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_SpinBoxLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_ToolButtonLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_ToolButtonLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_FrameLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_FrameLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_GroupBoxLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_GroupBoxLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_TabWidgetLayoutItem_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_TabWidgetLayoutItem;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_ItemViewItemDecoration_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_ItemViewItemDecoration;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_ItemViewItemText_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_ItemViewItemText;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_ItemViewItemFocusRect_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_ItemViewItemFocusRect;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_TabBarTabLeftButton_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_TabBarTabLeftButton;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_TabBarTabRightButton_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_TabBarTabRightButton;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_TabBarTabText_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_TabBarTabText;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_ShapedFrameContents_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_ShapedFrameContents;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_ToolBarHandle_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_ToolBarHandle;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_TabBarScrollLeftButton_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_TabBarScrollLeftButton;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_TabBarScrollRightButton_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_TabBarScrollRightButton;
+	#else
+		return 0;
+	#endif
+}
+
+int QStyle_SE_TabBarTearIndicatorRight_Type()
+{
+	#if QT_VERSION >= 0x057000
+		return QStyle::SE_TabBarTearIndicatorRight;
+	#else
+		return 0;
+	#endif
+}
+
+void* QStyle_QStyle_VisualPos(long long direction, void* boundingRectangle, void* logicalPosition)
+{
+	return ({ QPoint tmpValue = QStyle::visualPos(static_cast<Qt::LayoutDirection>(direction), *static_cast<QRect*>(boundingRectangle), *static_cast<QPoint*>(logicalPosition)); new QPoint(tmpValue.x(), tmpValue.y()); });
+}
+
+void* QStyle_QStyle_AlignedRect(long long direction, long long alignment, void* size, void* rectangle)
+{
+	return ({ QRect tmpValue = QStyle::alignedRect(static_cast<Qt::LayoutDirection>(direction), static_cast<Qt::AlignmentFlag>(alignment), *static_cast<QSize*>(size), *static_cast<QRect*>(rectangle)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QStyle_QStyle_VisualRect(long long direction, void* boundingRectangle, void* logicalRectangle)
+{
+	return ({ QRect tmpValue = QStyle::visualRect(static_cast<Qt::LayoutDirection>(direction), *static_cast<QRect*>(boundingRectangle), *static_cast<QRect*>(logicalRectangle)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QStyle_NewQStyle()
+{
+	return new MyQStyle();
+}
+
+long long QStyle_QStyle_VisualAlignment(long long direction, long long alignment)
+{
+	return QStyle::visualAlignment(static_cast<Qt::LayoutDirection>(direction), static_cast<Qt::AlignmentFlag>(alignment));
+}
+
+int QStyle_QStyle_SliderPositionFromValue(int min, int max, int logicalValue, int span, char upsideDown)
+{
+	return QStyle::sliderPositionFromValue(min, max, logicalValue, span, upsideDown != 0);
+}
+
+int QStyle_QStyle_SliderValueFromPosition(int min, int max, int position, int span, char upsideDown)
+{
+	return QStyle::sliderValueFromPosition(min, max, position, span, upsideDown != 0);
+}
+
+void QStyle_Polish2(void* ptr, void* application)
+{
+	static_cast<QStyle*>(ptr)->polish(static_cast<QApplication*>(application));
+}
+
+void QStyle_Polish2Default(void* ptr, void* application)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::polish(static_cast<QApplication*>(application));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::polish(static_cast<QApplication*>(application));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::polish(static_cast<QApplication*>(application));
+	}
+}
+
+void QStyle_Polish3(void* ptr, void* palette)
+{
+	static_cast<QStyle*>(ptr)->polish(*static_cast<QPalette*>(palette));
+}
+
+void QStyle_Polish3Default(void* ptr, void* palette)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::polish(*static_cast<QPalette*>(palette));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::polish(*static_cast<QPalette*>(palette));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::polish(*static_cast<QPalette*>(palette));
+	}
+}
+
+void QStyle_Polish(void* ptr, void* widget)
+{
+		static_cast<QStyle*>(ptr)->polish(static_cast<QWidget*>(widget));
+}
+
+void QStyle_PolishDefault(void* ptr, void* widget)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::polish(static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::polish(static_cast<QWidget*>(widget));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::polish(static_cast<QWidget*>(widget));
+	}
+}
+
+void QStyle_Unpolish2(void* ptr, void* application)
+{
+	static_cast<QStyle*>(ptr)->unpolish(static_cast<QApplication*>(application));
+}
+
+void QStyle_Unpolish2Default(void* ptr, void* application)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::unpolish(static_cast<QApplication*>(application));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::unpolish(static_cast<QApplication*>(application));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::unpolish(static_cast<QApplication*>(application));
+	}
+}
+
+void QStyle_Unpolish(void* ptr, void* widget)
+{
+		static_cast<QStyle*>(ptr)->unpolish(static_cast<QWidget*>(widget));
+}
+
+void QStyle_UnpolishDefault(void* ptr, void* widget)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::unpolish(static_cast<QWidget*>(widget));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::unpolish(static_cast<QWidget*>(widget));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::unpolish(static_cast<QWidget*>(widget));
+	}
+}
+
+void QStyle_DestroyQStyle(void* ptr)
+{
+	static_cast<QStyle*>(ptr)->~QStyle();
+}
+
+void QStyle_DestroyQStyleDefault(void* ptr)
+{
+
+}
+
+void* QStyle_StandardIcon(void* ptr, long long standardIcon, void* option, void* widget)
+{
+		return new QIcon(static_cast<QStyle*>(ptr)->standardIcon(static_cast<QStyle::StandardPixmap>(standardIcon), static_cast<QStyleOption*>(option), static_cast<QWidget*>(widget)));
+}
+
+void* QStyle_StandardPalette(void* ptr)
+{
+	return new QPalette(static_cast<QStyle*>(ptr)->standardPalette());
+}
+
+void* QStyle_StandardPaletteDefault(void* ptr)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		return new QPalette(static_cast<QProxyStyle*>(ptr)->QProxyStyle::standardPalette());
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		return new QPalette(static_cast<QCommonStyle*>(ptr)->QCommonStyle::standardPalette());
+	} else {
+		return new QPalette(static_cast<QStyle*>(ptr)->QStyle::standardPalette());
+	}
+}
+
+void* QStyle_GeneratedIconPixmap(void* ptr, long long iconMode, void* pixmap, void* option)
+{
+	return new QPixmap(static_cast<QStyle*>(ptr)->generatedIconPixmap(static_cast<QIcon::Mode>(iconMode), *static_cast<QPixmap*>(pixmap), static_cast<QStyleOption*>(option)));
+}
+
+void* QStyle_ItemPixmapRect(void* ptr, void* rectangle, int alignment, void* pixmap)
+{
+	return ({ QRect tmpValue = static_cast<QStyle*>(ptr)->itemPixmapRect(*static_cast<QRect*>(rectangle), alignment, *static_cast<QPixmap*>(pixmap)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QStyle_ItemPixmapRectDefault(void* ptr, void* rectangle, int alignment, void* pixmap)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QProxyStyle*>(ptr)->QProxyStyle::itemPixmapRect(*static_cast<QRect*>(rectangle), alignment, *static_cast<QPixmap*>(pixmap)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QCommonStyle*>(ptr)->QCommonStyle::itemPixmapRect(*static_cast<QRect*>(rectangle), alignment, *static_cast<QPixmap*>(pixmap)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRect tmpValue = static_cast<QStyle*>(ptr)->QStyle::itemPixmapRect(*static_cast<QRect*>(rectangle), alignment, *static_cast<QPixmap*>(pixmap)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QStyle_ItemTextRect(void* ptr, void* metrics, void* rectangle, int alignment, char enabled, char* text)
+{
+	return ({ QRect tmpValue = static_cast<QStyle*>(ptr)->itemTextRect(*static_cast<QFontMetrics*>(metrics), *static_cast<QRect*>(rectangle), alignment, enabled != 0, QString(text)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QStyle_ItemTextRectDefault(void* ptr, void* metrics, void* rectangle, int alignment, char enabled, char* text)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QProxyStyle*>(ptr)->QProxyStyle::itemTextRect(*static_cast<QFontMetrics*>(metrics), *static_cast<QRect*>(rectangle), alignment, enabled != 0, QString(text)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		return ({ QRect tmpValue = static_cast<QCommonStyle*>(ptr)->QCommonStyle::itemTextRect(*static_cast<QFontMetrics*>(metrics), *static_cast<QRect*>(rectangle), alignment, enabled != 0, QString(text)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	} else {
+		return ({ QRect tmpValue = static_cast<QStyle*>(ptr)->QStyle::itemTextRect(*static_cast<QFontMetrics*>(metrics), *static_cast<QRect*>(rectangle), alignment, enabled != 0, QString(text)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+	}
+}
+
+void* QStyle_SubControlRect(void* ptr, long long control, void* option, long long subControl, void* widget)
+{
+		return ({ QRect tmpValue = static_cast<QStyle*>(ptr)->subControlRect(static_cast<QStyle::ComplexControl>(control), static_cast<QStyleOptionComplex*>(option), static_cast<QStyle::SubControl>(subControl), static_cast<QWidget*>(widget)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QStyle_SubElementRect(void* ptr, long long element, void* option, void* widget)
+{
+		return ({ QRect tmpValue = static_cast<QStyle*>(ptr)->subElementRect(static_cast<QStyle::SubElement>(element), static_cast<QStyleOption*>(option), static_cast<QWidget*>(widget)); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QStyle_SizeFromContents(void* ptr, long long ty, void* option, void* contentsSize, void* widget)
+{
+		return ({ QSize tmpValue = static_cast<QStyle*>(ptr)->sizeFromContents(static_cast<QStyle::ContentsType>(ty), static_cast<QStyleOption*>(option), *static_cast<QSize*>(contentsSize), static_cast<QWidget*>(widget)); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+long long QStyle_HitTestComplexControl(void* ptr, long long control, void* option, void* position, void* widget)
+{
+		return static_cast<QStyle*>(ptr)->hitTestComplexControl(static_cast<QStyle::ComplexControl>(control), static_cast<QStyleOptionComplex*>(option), *static_cast<QPoint*>(position), static_cast<QWidget*>(widget));
+}
+
+void* QStyle_Proxy(void* ptr)
+{
+	return const_cast<QStyle*>(static_cast<QStyle*>(ptr)->proxy());
+}
+
+int QStyle_CombinedLayoutSpacing(void* ptr, long long controls1, long long controls2, long long orientation, void* option, void* widget)
+{
+		return static_cast<QStyle*>(ptr)->combinedLayoutSpacing(static_cast<QSizePolicy::ControlType>(controls1), static_cast<QSizePolicy::ControlType>(controls2), static_cast<Qt::Orientation>(orientation), static_cast<QStyleOption*>(option), static_cast<QWidget*>(widget));
+}
+
+int QStyle_LayoutSpacing(void* ptr, long long control1, long long control2, long long orientation, void* option, void* widget)
+{
+		return static_cast<QStyle*>(ptr)->layoutSpacing(static_cast<QSizePolicy::ControlType>(control1), static_cast<QSizePolicy::ControlType>(control2), static_cast<Qt::Orientation>(orientation), static_cast<QStyleOption*>(option), static_cast<QWidget*>(widget));
+}
+
+int QStyle_PixelMetric(void* ptr, long long metric, void* option, void* widget)
+{
+		return static_cast<QStyle*>(ptr)->pixelMetric(static_cast<QStyle::PixelMetric>(metric), static_cast<QStyleOption*>(option), static_cast<QWidget*>(widget));
+}
+
+int QStyle_StyleHint(void* ptr, long long hint, void* option, void* widget, void* returnData)
+{
+		return static_cast<QStyle*>(ptr)->styleHint(static_cast<QStyle::StyleHint>(hint), static_cast<QStyleOption*>(option), static_cast<QWidget*>(widget), static_cast<QStyleHintReturn*>(returnData));
+}
+
+void QStyle_DrawComplexControl(void* ptr, long long control, void* option, void* painter, void* widget)
+{
+		static_cast<QStyle*>(ptr)->drawComplexControl(static_cast<QStyle::ComplexControl>(control), static_cast<QStyleOptionComplex*>(option), static_cast<QPainter*>(painter), static_cast<QWidget*>(widget));
+}
+
+void QStyle_DrawControl(void* ptr, long long element, void* option, void* painter, void* widget)
+{
+		static_cast<QStyle*>(ptr)->drawControl(static_cast<QStyle::ControlElement>(element), static_cast<QStyleOption*>(option), static_cast<QPainter*>(painter), static_cast<QWidget*>(widget));
+}
+
+void QStyle_DrawItemPixmap(void* ptr, void* painter, void* rectangle, int alignment, void* pixmap)
+{
+	static_cast<QStyle*>(ptr)->drawItemPixmap(static_cast<QPainter*>(painter), *static_cast<QRect*>(rectangle), alignment, *static_cast<QPixmap*>(pixmap));
+}
+
+void QStyle_DrawItemPixmapDefault(void* ptr, void* painter, void* rectangle, int alignment, void* pixmap)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::drawItemPixmap(static_cast<QPainter*>(painter), *static_cast<QRect*>(rectangle), alignment, *static_cast<QPixmap*>(pixmap));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::drawItemPixmap(static_cast<QPainter*>(painter), *static_cast<QRect*>(rectangle), alignment, *static_cast<QPixmap*>(pixmap));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::drawItemPixmap(static_cast<QPainter*>(painter), *static_cast<QRect*>(rectangle), alignment, *static_cast<QPixmap*>(pixmap));
+	}
+}
+
+void QStyle_DrawItemText(void* ptr, void* painter, void* rectangle, int alignment, void* palette, char enabled, char* text, long long textRole)
+{
+	static_cast<QStyle*>(ptr)->drawItemText(static_cast<QPainter*>(painter), *static_cast<QRect*>(rectangle), alignment, *static_cast<QPalette*>(palette), enabled != 0, QString(text), static_cast<QPalette::ColorRole>(textRole));
+}
+
+void QStyle_DrawItemTextDefault(void* ptr, void* painter, void* rectangle, int alignment, void* palette, char enabled, char* text, long long textRole)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::drawItemText(static_cast<QPainter*>(painter), *static_cast<QRect*>(rectangle), alignment, *static_cast<QPalette*>(palette), enabled != 0, QString(text), static_cast<QPalette::ColorRole>(textRole));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::drawItemText(static_cast<QPainter*>(painter), *static_cast<QRect*>(rectangle), alignment, *static_cast<QPalette*>(palette), enabled != 0, QString(text), static_cast<QPalette::ColorRole>(textRole));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::drawItemText(static_cast<QPainter*>(painter), *static_cast<QRect*>(rectangle), alignment, *static_cast<QPalette*>(palette), enabled != 0, QString(text), static_cast<QPalette::ColorRole>(textRole));
+	}
+}
+
+void QStyle_DrawPrimitive(void* ptr, long long element, void* option, void* painter, void* widget)
+{
+		static_cast<QStyle*>(ptr)->drawPrimitive(static_cast<QStyle::PrimitiveElement>(element), static_cast<QStyleOption*>(option), static_cast<QPainter*>(painter), static_cast<QWidget*>(widget));
+}
+
+void* QStyle_StandardPixmap(void* ptr, long long standardIcon, void* option, void* widget)
+{
+		return new QPixmap(static_cast<QStyle*>(ptr)->standardPixmap(static_cast<QStyle::StandardPixmap>(standardIcon), static_cast<QStyleOption*>(option), static_cast<QWidget*>(widget)));
+}
+
+void* QStyle___dynamicPropertyNames_atList(void* ptr, int i)
+{
+	return new QByteArray(static_cast<QList<QByteArray>*>(ptr)->at(i));
+}
+
+void QStyle___dynamicPropertyNames_setList(void* ptr, void* i)
+{
+	static_cast<QList<QByteArray>*>(ptr)->append(*static_cast<QByteArray*>(i));
+}
+
+void* QStyle___dynamicPropertyNames_newList(void* ptr)
+{
+	return new QList<QByteArray>;
+}
+
+void* QStyle___findChildren_atList2(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QStyle___findChildren_setList2(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStyle___findChildren_newList2(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QStyle___findChildren_atList3(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QStyle___findChildren_setList3(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStyle___findChildren_newList3(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QStyle___findChildren_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject*>*>(ptr)->at(i));
+}
+
+void QStyle___findChildren_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject*>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStyle___findChildren_newList(void* ptr)
+{
+	return new QList<QObject*>;
+}
+
+void* QStyle___children_atList(void* ptr, int i)
+{
+	return const_cast<QObject*>(static_cast<QList<QObject *>*>(ptr)->at(i));
+}
+
+void QStyle___children_setList(void* ptr, void* i)
+{
+	if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsObject*>(i));
+	} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QGraphicsWidget*>(i));
+	} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QLayout*>(i));
+	} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(i))) {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QWidget*>(i));
+	} else {
+		static_cast<QList<QObject *>*>(ptr)->append(static_cast<QObject*>(i));
+	}
+}
+
+void* QStyle___children_newList(void* ptr)
+{
+	return new QList<QObject *>;
+}
+
+char QStyle_EventDefault(void* ptr, void* e)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QProxyStyle*>(ptr)->QProxyStyle::event(static_cast<QEvent*>(e));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		return static_cast<QCommonStyle*>(ptr)->QCommonStyle::event(static_cast<QEvent*>(e));
+	} else {
+		return static_cast<QStyle*>(ptr)->QStyle::event(static_cast<QEvent*>(e));
+	}
+}
+
+char QStyle_EventFilterDefault(void* ptr, void* watched, void* event)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QProxyStyle*>(ptr)->QProxyStyle::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QProxyStyle*>(ptr)->QProxyStyle::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QProxyStyle*>(ptr)->QProxyStyle::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QProxyStyle*>(ptr)->QProxyStyle::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QProxyStyle*>(ptr)->QProxyStyle::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QCommonStyle*>(ptr)->QCommonStyle::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QCommonStyle*>(ptr)->QCommonStyle::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QCommonStyle*>(ptr)->QCommonStyle::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QCommonStyle*>(ptr)->QCommonStyle::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QCommonStyle*>(ptr)->QCommonStyle::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	} else {
+		if (dynamic_cast<QGraphicsObject*>(static_cast<QObject*>(watched))) {
+			return static_cast<QStyle*>(ptr)->QStyle::eventFilter(static_cast<QGraphicsObject*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QGraphicsWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QStyle*>(ptr)->QStyle::eventFilter(static_cast<QGraphicsWidget*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QLayout*>(static_cast<QObject*>(watched))) {
+			return static_cast<QStyle*>(ptr)->QStyle::eventFilter(static_cast<QLayout*>(watched), static_cast<QEvent*>(event));
+		} else if (dynamic_cast<QWidget*>(static_cast<QObject*>(watched))) {
+			return static_cast<QStyle*>(ptr)->QStyle::eventFilter(static_cast<QWidget*>(watched), static_cast<QEvent*>(event));
+		} else {
+			return static_cast<QStyle*>(ptr)->QStyle::eventFilter(static_cast<QObject*>(watched), static_cast<QEvent*>(event));
+		}
+	}
+}
+
+void QStyle_ChildEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::childEvent(static_cast<QChildEvent*>(event));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::childEvent(static_cast<QChildEvent*>(event));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::childEvent(static_cast<QChildEvent*>(event));
+	}
+}
+
+void QStyle_ConnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::connectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::connectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QStyle_CustomEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::customEvent(static_cast<QEvent*>(event));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::customEvent(static_cast<QEvent*>(event));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::customEvent(static_cast<QEvent*>(event));
+	}
+}
+
+void QStyle_DeleteLaterDefault(void* ptr)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::deleteLater();
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::deleteLater();
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::deleteLater();
+	}
+}
+
+void QStyle_DisconnectNotifyDefault(void* ptr, void* sign)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::disconnectNotify(*static_cast<QMetaMethod*>(sign));
+	}
+}
+
+void QStyle_TimerEventDefault(void* ptr, void* event)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QProxyStyle*>(ptr)->QProxyStyle::timerEvent(static_cast<QTimerEvent*>(event));
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		static_cast<QCommonStyle*>(ptr)->QCommonStyle::timerEvent(static_cast<QTimerEvent*>(event));
+	} else {
+		static_cast<QStyle*>(ptr)->QStyle::timerEvent(static_cast<QTimerEvent*>(event));
+	}
+}
+
+void* QStyle_MetaObjectDefault(void* ptr)
+{
+	if (dynamic_cast<QProxyStyle*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QProxyStyle*>(ptr)->QProxyStyle::metaObject());
+	} else if (dynamic_cast<QCommonStyle*>(static_cast<QObject*>(ptr))) {
+		return const_cast<QMetaObject*>(static_cast<QCommonStyle*>(ptr)->QCommonStyle::metaObject());
+	} else {
+		return const_cast<QMetaObject*>(static_cast<QStyle*>(ptr)->QStyle::metaObject());
+	}
+}
+
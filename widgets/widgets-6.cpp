@@ -0,0 +1,984 @@
+// +build !minimal
+
+#define protected public
+#define private public
+
+#include "widgets.h"
+#include "_cgo_export.h"
+
+#include <QAbstractButton>
+#include <QAction>
+#include <QActionEvent>
+#include <QByteArray>
+#include <QChildEvent>
+#include <QCloseEvent>
+#include <QContextMenuEvent>
+#include <QDial>
+#include <QDialog>
+#include <QDrag>
+#include <QDragEnterEvent>
+#include <QDragLeaveEvent>
+#include <QDragMoveEvent>
+#include <QDropEvent>
+#include <QEvent>
+#include <QFocusEvent>
+#include <QHideEvent>
+#include <QIcon>
+#include <QInputMethod>
+#include <QInputMethodEvent>
+#include <QKeyEvent>
+#include <QLayout>
+#include <QLayoutItem>
+#include <QList>
+#include <QMetaMethod>
+#include <QMetaObject>
+#include <QMouseEvent>
+#include <QMoveEvent>
+#include <QObject>
+#include <QPaintDevice>
+#include <QPaintEngine>
+#include <QPaintEvent>
+#include <QPixmap>
+#include <QPoint>
+#include <QRect>
+#include <QResizeEvent>
+#include <QShowEvent>
+#include <QSize>
+#include <QSizePolicy>
+#include <QSpacerItem>
+#include <QString>
+#include <QTabletEvent>
+#include <QTime>
+#include <QTimer>
+#include <QTimerEvent>
+#include <QVariant>
+#include <QWheelEvent>
+#include <QWidget>
+#include <QWidgetAction>
+#include <QWidgetItem>
+#include <QWizard>
+#include <QWizardPage>
+
+class MyQWidgetAction: public QWidgetAction
+{
+public:
+	MyQWidgetAction(QObject *parent) : QWidgetAction(parent) {};
+	QWidget * createWidget(QWidget * parent) { return static_cast<QWidget*>(callbackQWidgetAction_CreateWidget(this, parent)); };
+	bool event(QEvent * event) { return callbackQAction_Event(this, event) != 0; };
+	bool eventFilter(QObject * obj, QEvent * event) { return callbackQAction_EventFilter(this, obj, event) != 0; };
+	void deleteWidget(QWidget * widget) { callbackQWidgetAction_DeleteWidget(this, widget); };
+	 ~MyQWidgetAction() { callbackQWidgetAction_DestroyQWidgetAction(this); };
+	void Signal_Changed() { callbackQAction_Changed(this); };
+	void hover() { callbackQAction_Hover(this); };
+	void Signal_Hovered() { callbackQAction_Hovered(this); };
+	void setChecked(bool vbo) { callbackQAction_SetChecked(this, vbo); };
+	void setDisabled(bool b) { callbackQAction_SetDisabled(this, b); };
+	void setEnabled(bool vbo) { callbackQAction_SetEnabled(this, vbo); };
+	void setVisible(bool vbo) { callbackQAction_SetVisible(this, vbo); };
+	void toggle() { callbackQAction_Toggle(this); };
+	void Signal_Toggled(bool checked) { callbackQAction_Toggled(this, checked); };
+	void trigger() { callbackQAction_Trigger(this); };
+	void Signal_Triggered(bool checked) { callbackQAction_Triggered(this, checked); };
+	void childEvent(QChildEvent * event) { callbackQAction_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQAction_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQAction_CustomEvent(this, event); };
+	void deleteLater() { callbackQAction_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQAction_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQAction_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQAction_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQAction_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQAction_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QWidgetAction_CreateWidget(void* ptr, void* parent)
+{
+		return static_cast<QWidgetAction*>(ptr)->createWidget(static_cast<QWidget*>(parent));
+}
+
+void* QWidgetAction_CreateWidgetDefault(void* ptr, void* parent)
+{
+		return static_cast<QWidgetAction*>(ptr)->QWidgetAction::createWidget(static_cast<QWidget*>(parent));
+}
+
+void* QWidgetAction_RequestWidget(void* ptr, void* parent)
+{
+		return static_cast<QWidgetAction*>(ptr)->requestWidget(static_cast<QWidget*>(parent));
+}
+
+void* QWidgetAction_NewQWidgetAction(void* parent)
+{
+	return new MyQWidgetAction(static_cast<QObject*>(parent));
+}
+
+void QWidgetAction_DeleteWidget(void* ptr, void* widget)
+{
+		static_cast<QWidgetAction*>(ptr)->deleteWidget(static_cast<QWidget*>(widget));
+}
+
+void QWidgetAction_DeleteWidgetDefault(void* ptr, void* widget)
+{
+		static_cast<QWidgetAction*>(ptr)->QWidgetAction::deleteWidget(static_cast<QWidget*>(widget));
+}
+
+void QWidgetAction_ReleaseWidget(void* ptr, void* widget)
+{
+		static_cast<QWidgetAction*>(ptr)->releaseWidget(static_cast<QWidget*>(widget));
+}
+
+void QWidgetAction_SetDefaultWidget(void* ptr, void* widget)
+{
+		static_cast<QWidgetAction*>(ptr)->setDefaultWidget(static_cast<QWidget*>(widget));
+}
+
+void QWidgetAction_DestroyQWidgetAction(void* ptr)
+{
+	static_cast<QWidgetAction*>(ptr)->~QWidgetAction();
+}
+
+void QWidgetAction_DestroyQWidgetActionDefault(void* ptr)
+{
+
+}
+
+struct QtWidgets_PackedList QWidgetAction_CreatedWidgets(void* ptr)
+{
+	return ({ QList<QWidget *>* tmpValue = new QList<QWidget *>(static_cast<QWidgetAction*>(ptr)->createdWidgets()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QWidgetAction_DefaultWidget(void* ptr)
+{
+	return static_cast<QWidgetAction*>(ptr)->defaultWidget();
+}
+
+void* QWidgetAction___createdWidgets_atList(void* ptr, int i)
+{
+	return const_cast<QWidget*>(static_cast<QList<QWidget *>*>(ptr)->at(i));
+}
+
+void QWidgetAction___createdWidgets_setList(void* ptr, void* i)
+{
+		static_cast<QList<QWidget *>*>(ptr)->append(static_cast<QWidget*>(i));
+}
+
+void* QWidgetAction___createdWidgets_newList(void* ptr)
+{
+	return new QList<QWidget *>;
+}
+
+class MyQWidgetItem: public QWidgetItem
+{
+public:
+	MyQWidgetItem(QWidget *widget) : QWidgetItem(widget) {};
+	QWidget * widget() { return static_cast<QWidget*>(callbackQLayoutItem_Widget(this)); };
+	void setGeometry(const QRect & rect) { callbackQWidgetItem_SetGeometry(this, const_cast<QRect*>(&rect)); };
+	QRect geometry() const { return *static_cast<QRect*>(callbackQWidgetItem_Geometry(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize maximumSize() const { return *static_cast<QSize*>(callbackQWidgetItem_MaximumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSize() const { return *static_cast<QSize*>(callbackQWidgetItem_MinimumSize(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidgetItem_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSizePolicy::ControlTypes controlTypes() const { return static_cast<QSizePolicy::ControlType>(callbackQLayoutItem_ControlTypes(const_cast<void*>(static_cast<const void*>(this)))); };
+	Qt::Orientations expandingDirections() const { return static_cast<Qt::Orientation>(callbackQWidgetItem_ExpandingDirections(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool hasHeightForWidth() const { return callbackQLayoutItem_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	bool isEmpty() const { return callbackQWidgetItem_IsEmpty(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQLayoutItem_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	QLayout * layout() { return static_cast<QLayout*>(callbackQLayoutItem_Layout(this)); };
+	QSpacerItem * spacerItem() { return static_cast<QSpacerItem*>(callbackQLayoutItem_SpacerItem(this)); };
+	void invalidate() { callbackQLayoutItem_Invalidate(this); };
+	int minimumHeightForWidth(int w) const { return callbackQLayoutItem_MinimumHeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+};
+
+void* QWidgetItem_NewQWidgetItem(void* widget)
+{
+	return new MyQWidgetItem(static_cast<QWidget*>(widget));
+}
+
+void QWidgetItem_SetGeometry(void* ptr, void* rect)
+{
+	static_cast<QWidgetItem*>(ptr)->setGeometry(*static_cast<QRect*>(rect));
+}
+
+void QWidgetItem_SetGeometryDefault(void* ptr, void* rect)
+{
+		static_cast<QWidgetItem*>(ptr)->QWidgetItem::setGeometry(*static_cast<QRect*>(rect));
+}
+
+void QWidgetItem_DestroyQWidgetItem(void* ptr)
+{
+	static_cast<QWidgetItem*>(ptr)->~QWidgetItem();
+}
+
+void* QWidgetItem_Geometry(void* ptr)
+{
+	return ({ QRect tmpValue = static_cast<QWidgetItem*>(ptr)->geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QWidgetItem_GeometryDefault(void* ptr)
+{
+		return ({ QRect tmpValue = static_cast<QWidgetItem*>(ptr)->QWidgetItem::geometry(); new QRect(tmpValue.x(), tmpValue.y(), tmpValue.width(), tmpValue.height()); });
+}
+
+void* QWidgetItem_MaximumSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QWidgetItem*>(ptr)->maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QWidgetItem_MaximumSizeDefault(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QWidgetItem*>(ptr)->QWidgetItem::maximumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QWidgetItem_MinimumSize(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QWidgetItem*>(ptr)->minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QWidgetItem_MinimumSizeDefault(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QWidgetItem*>(ptr)->QWidgetItem::minimumSize(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QWidgetItem_SizeHint(void* ptr)
+{
+	return ({ QSize tmpValue = static_cast<QWidgetItem*>(ptr)->sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+void* QWidgetItem_SizeHintDefault(void* ptr)
+{
+		return ({ QSize tmpValue = static_cast<QWidgetItem*>(ptr)->QWidgetItem::sizeHint(); new QSize(tmpValue.width(), tmpValue.height()); });
+}
+
+long long QWidgetItem_ExpandingDirections(void* ptr)
+{
+	return static_cast<QWidgetItem*>(ptr)->expandingDirections();
+}
+
+long long QWidgetItem_ExpandingDirectionsDefault(void* ptr)
+{
+		return static_cast<QWidgetItem*>(ptr)->QWidgetItem::expandingDirections();
+}
+
+char QWidgetItem_IsEmpty(void* ptr)
+{
+	return static_cast<QWidgetItem*>(ptr)->isEmpty();
+}
+
+char QWidgetItem_IsEmptyDefault(void* ptr)
+{
+		return static_cast<QWidgetItem*>(ptr)->QWidgetItem::isEmpty();
+}
+
+void* QWidgetItem_Wid(void* ptr)
+{
+	return static_cast<QWidgetItem*>(ptr)->wid;
+}
+
+void QWidgetItem_SetWid(void* ptr, void* vqw)
+{
+		static_cast<QWidgetItem*>(ptr)->wid = static_cast<QWidget*>(vqw);
+}
+
+class MyQWizard: public QWizard
+{
+public:
+	MyQWizard(QWidget *parent, Qt::WindowFlags flags) : QWizard(parent, flags) {};
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	bool validateCurrentPage() { return callbackQWizard_ValidateCurrentPage(this) != 0; };
+	void back() { callbackQWizard_Back(this); };
+	void cleanupPage(int id) { callbackQWizard_CleanupPage(this, id); };
+	void Signal_CurrentIdChanged(int id) { callbackQWizard_CurrentIdChanged(this, id); };
+	void Signal_CustomButtonClicked(int which) { callbackQWizard_CustomButtonClicked(this, which); };
+	void done(int result) { callbackQWizard_Done(this, result); };
+	void Signal_HelpRequested() { callbackQWizard_HelpRequested(this); };
+	void initializePage(int id) { callbackQWizard_InitializePage(this, id); };
+	void next() { callbackQWizard_Next(this); };
+	void Signal_PageAdded(int id) { callbackQWizard_PageAdded(this, id); };
+	void Signal_PageRemoved(int id) { callbackQWizard_PageRemoved(this, id); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void restart() { callbackQWizard_Restart(this); };
+	void setVisible(bool visible) { callbackQDialog_SetVisible(this, visible); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	int nextId() const { return callbackQWizard_NextId(const_cast<void*>(static_cast<const void*>(this))); };
+	int exec() { return callbackQDialog_Exec(this); };
+	void accept() { callbackQDialog_Accept(this); };
+	void Signal_Accepted() { callbackQDialog_Accepted(this); };
+	void closeEvent(QCloseEvent * e) { callbackQWidget_CloseEvent(this, e); };
+	void contextMenuEvent(QContextMenuEvent * e) { callbackQWidget_ContextMenuEvent(this, e); };
+	void Signal_Finished(int result) { callbackQDialog_Finished(this, result); };
+	void keyPressEvent(QKeyEvent * e) { callbackQWidget_KeyPressEvent(this, e); };
+	void open() { callbackQDialog_Open(this); };
+	void reject() { callbackQDialog_Reject(this); };
+	void Signal_Rejected() { callbackQDialog_Rejected(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QWizard_NewQWizard(void* parent, long long flags)
+{
+	return new MyQWizard(static_cast<QWidget*>(parent), static_cast<Qt::WindowType>(flags));
+}
+
+char QWizard_ValidateCurrentPage(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->validateCurrentPage();
+}
+
+char QWizard_ValidateCurrentPageDefault(void* ptr)
+{
+		return static_cast<QWizard*>(ptr)->QWizard::validateCurrentPage();
+}
+
+int QWizard_AddPage(void* ptr, void* page)
+{
+	return static_cast<QWizard*>(ptr)->addPage(static_cast<QWizardPage*>(page));
+}
+
+void QWizard_Back(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QWizard*>(ptr), "back");
+}
+
+void QWizard_BackDefault(void* ptr)
+{
+		static_cast<QWizard*>(ptr)->QWizard::back();
+}
+
+void QWizard_CleanupPage(void* ptr, int id)
+{
+	static_cast<QWizard*>(ptr)->cleanupPage(id);
+}
+
+void QWizard_CleanupPageDefault(void* ptr, int id)
+{
+		static_cast<QWizard*>(ptr)->QWizard::cleanupPage(id);
+}
+
+void QWizard_ConnectCurrentIdChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)(int)>(&QWizard::currentIdChanged), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)(int)>(&MyQWizard::Signal_CurrentIdChanged));
+}
+
+void QWizard_DisconnectCurrentIdChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)(int)>(&QWizard::currentIdChanged), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)(int)>(&MyQWizard::Signal_CurrentIdChanged));
+}
+
+void QWizard_CurrentIdChanged(void* ptr, int id)
+{
+	static_cast<QWizard*>(ptr)->currentIdChanged(id);
+}
+
+void QWizard_ConnectCustomButtonClicked(void* ptr)
+{
+	QObject::connect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)(int)>(&QWizard::customButtonClicked), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)(int)>(&MyQWizard::Signal_CustomButtonClicked));
+}
+
+void QWizard_DisconnectCustomButtonClicked(void* ptr)
+{
+	QObject::disconnect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)(int)>(&QWizard::customButtonClicked), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)(int)>(&MyQWizard::Signal_CustomButtonClicked));
+}
+
+void QWizard_CustomButtonClicked(void* ptr, int which)
+{
+	static_cast<QWizard*>(ptr)->customButtonClicked(which);
+}
+
+void QWizard_Done(void* ptr, int result)
+{
+	static_cast<QWizard*>(ptr)->done(result);
+}
+
+void QWizard_DoneDefault(void* ptr, int result)
+{
+		static_cast<QWizard*>(ptr)->QWizard::done(result);
+}
+
+void QWizard_ConnectHelpRequested(void* ptr)
+{
+	QObject::connect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)()>(&QWizard::helpRequested), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)()>(&MyQWizard::Signal_HelpRequested));
+}
+
+void QWizard_DisconnectHelpRequested(void* ptr)
+{
+	QObject::disconnect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)()>(&QWizard::helpRequested), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)()>(&MyQWizard::Signal_HelpRequested));
+}
+
+void QWizard_HelpRequested(void* ptr)
+{
+	static_cast<QWizard*>(ptr)->helpRequested();
+}
+
+void QWizard_InitializePage(void* ptr, int id)
+{
+	static_cast<QWizard*>(ptr)->initializePage(id);
+}
+
+void QWizard_InitializePageDefault(void* ptr, int id)
+{
+		static_cast<QWizard*>(ptr)->QWizard::initializePage(id);
+}
+
+void QWizard_Next(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QWizard*>(ptr), "next");
+}
+
+void QWizard_NextDefault(void* ptr)
+{
+		static_cast<QWizard*>(ptr)->QWizard::next();
+}
+
+void QWizard_ConnectPageAdded(void* ptr)
+{
+	QObject::connect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)(int)>(&QWizard::pageAdded), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)(int)>(&MyQWizard::Signal_PageAdded));
+}
+
+void QWizard_DisconnectPageAdded(void* ptr)
+{
+	QObject::disconnect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)(int)>(&QWizard::pageAdded), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)(int)>(&MyQWizard::Signal_PageAdded));
+}
+
+void QWizard_PageAdded(void* ptr, int id)
+{
+	static_cast<QWizard*>(ptr)->pageAdded(id);
+}
+
+void QWizard_ConnectPageRemoved(void* ptr)
+{
+	QObject::connect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)(int)>(&QWizard::pageRemoved), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)(int)>(&MyQWizard::Signal_PageRemoved));
+}
+
+void QWizard_DisconnectPageRemoved(void* ptr)
+{
+	QObject::disconnect(static_cast<QWizard*>(ptr), static_cast<void (QWizard::*)(int)>(&QWizard::pageRemoved), static_cast<MyQWizard*>(ptr), static_cast<void (MyQWizard::*)(int)>(&MyQWizard::Signal_PageRemoved));
+}
+
+void QWizard_PageRemoved(void* ptr, int id)
+{
+	static_cast<QWizard*>(ptr)->pageRemoved(id);
+}
+
+void QWizard_RemovePage(void* ptr, int id)
+{
+	static_cast<QWizard*>(ptr)->removePage(id);
+}
+
+void QWizard_Restart(void* ptr)
+{
+	QMetaObject::invokeMethod(static_cast<QWizard*>(ptr), "restart");
+}
+
+void QWizard_RestartDefault(void* ptr)
+{
+		static_cast<QWizard*>(ptr)->QWizard::restart();
+}
+
+void QWizard_SetButton(void* ptr, long long which, void* button)
+{
+	static_cast<QWizard*>(ptr)->setButton(static_cast<QWizard::WizardButton>(which), static_cast<QAbstractButton*>(button));
+}
+
+void QWizard_SetButtonText(void* ptr, long long which, char* text)
+{
+	static_cast<QWizard*>(ptr)->setButtonText(static_cast<QWizard::WizardButton>(which), QString(text));
+}
+
+void QWizard_SetDefaultProperty(void* ptr, char* className, char* property, char* changedSignal)
+{
+	static_cast<QWizard*>(ptr)->setDefaultProperty(const_cast<const char*>(className), const_cast<const char*>(property), const_cast<const char*>(changedSignal));
+}
+
+void QWizard_SetField(void* ptr, char* name, void* value)
+{
+	static_cast<QWizard*>(ptr)->setField(QString(name), *static_cast<QVariant*>(value));
+}
+
+void QWizard_SetOption(void* ptr, long long option, char on)
+{
+	static_cast<QWizard*>(ptr)->setOption(static_cast<QWizard::WizardOption>(option), on != 0);
+}
+
+void QWizard_SetOptions(void* ptr, long long options)
+{
+	static_cast<QWizard*>(ptr)->setOptions(static_cast<QWizard::WizardOption>(options));
+}
+
+void QWizard_SetPage(void* ptr, int id, void* page)
+{
+	static_cast<QWizard*>(ptr)->setPage(id, static_cast<QWizardPage*>(page));
+}
+
+void QWizard_SetWizardStyle(void* ptr, long long style)
+{
+	static_cast<QWizard*>(ptr)->setWizardStyle(static_cast<QWizard::WizardStyle>(style));
+}
+
+void QWizard_SetPixmap(void* ptr, long long which, void* pixmap)
+{
+	static_cast<QWizard*>(ptr)->setPixmap(static_cast<QWizard::WizardPixmap>(which), *static_cast<QPixmap*>(pixmap));
+}
+
+void QWizard_SetSideWidget(void* ptr, void* widget)
+{
+		static_cast<QWizard*>(ptr)->setSideWidget(static_cast<QWidget*>(widget));
+}
+
+void QWizard_SetStartId(void* ptr, int id)
+{
+	static_cast<QWizard*>(ptr)->setStartId(id);
+}
+
+void QWizard_SetSubTitleFormat(void* ptr, long long format)
+{
+	static_cast<QWizard*>(ptr)->setSubTitleFormat(static_cast<Qt::TextFormat>(format));
+}
+
+void QWizard_SetTitleFormat(void* ptr, long long format)
+{
+	static_cast<QWizard*>(ptr)->setTitleFormat(static_cast<Qt::TextFormat>(format));
+}
+
+void QWizard_DestroyQWizard(void* ptr)
+{
+	static_cast<QWizard*>(ptr)->~QWizard();
+}
+
+void* QWizard_Button(void* ptr, long long which)
+{
+	return static_cast<QWizard*>(ptr)->button(static_cast<QWizard::WizardButton>(which));
+}
+
+struct QtWidgets_PackedList QWizard_PageIds(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QWizard*>(ptr)->pageIds()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+struct QtWidgets_PackedList QWizard_VisitedPages(void* ptr)
+{
+	return ({ QList<int>* tmpValue = new QList<int>(static_cast<QWizard*>(ptr)->visitedPages()); QtWidgets_PackedList { tmpValue, tmpValue->size() }; });
+}
+
+void* QWizard_Pixmap(void* ptr, long long which)
+{
+	return new QPixmap(static_cast<QWizard*>(ptr)->pixmap(static_cast<QWizard::WizardPixmap>(which)));
+}
+
+struct QtWidgets_PackedString QWizard_ButtonText(void* ptr, long long which)
+{
+	return ({ QByteArray tdb6a3d = static_cast<QWizard*>(ptr)->buttonText(static_cast<QWizard::WizardButton>(which)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(tdb6a3d.prepend("WHITESPACE").constData()+10), tdb6a3d.size()-10 }; });
+}
+
+void* QWizard_Field(void* ptr, char* name)
+{
+	return new QVariant(static_cast<QWizard*>(ptr)->field(QString(name)));
+}
+
+void* QWizard_SideWidget(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->sideWidget();
+}
+
+void* QWizard_CurrentPage(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->currentPage();
+}
+
+void* QWizard_Page(void* ptr, int id)
+{
+	return static_cast<QWizard*>(ptr)->page(id);
+}
+
+long long QWizard_SubTitleFormat(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->subTitleFormat();
+}
+
+long long QWizard_TitleFormat(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->titleFormat();
+}
+
+long long QWizard_Options(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->options();
+}
+
+long long QWizard_WizardStyle(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->wizardStyle();
+}
+
+char QWizard_HasVisitedPage(void* ptr, int id)
+{
+	return static_cast<QWizard*>(ptr)->hasVisitedPage(id);
+}
+
+char QWizard_TestOption(void* ptr, long long option)
+{
+	return static_cast<QWizard*>(ptr)->testOption(static_cast<QWizard::WizardOption>(option));
+}
+
+int QWizard_CurrentId(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->currentId();
+}
+
+int QWizard_NextId(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->nextId();
+}
+
+int QWizard_NextIdDefault(void* ptr)
+{
+		return static_cast<QWizard*>(ptr)->QWizard::nextId();
+}
+
+int QWizard_StartId(void* ptr)
+{
+	return static_cast<QWizard*>(ptr)->startId();
+}
+
+int QWizard___pageIds_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QWizard___pageIds_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QWizard___pageIds_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QWizard___pageIds_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QWizard___pageIds_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+int QWizard___visitedPages_atList(void* ptr, int i)
+{
+	return static_cast<QList<int>*>(ptr)->at(i);
+}
+
+void QWizard___visitedPages_setList(void* ptr, int i)
+{
+	static_cast<QList<int>*>(ptr)->append(i);
+}
+
+void* QWizard___visitedPages_newList(void* ptr)
+{
+	return new QList<int>;
+}
+
+void* QWizard___visitedPages_newListBuffer(void* ptr, void* data, int count)
+{
+	return ({ QList<int>* tmpList = new QList<int>; tmpList->reserve(count); for (int i = 0; i < count; i++) tmpList->append(static_cast<int*>(data)[i]); tmpList; });
+}
+
+void QWizard___visitedPages_fillList(void* ptr, void* data)
+{
+	for (int i = 0; i < static_cast<QList<int>*>(ptr)->size(); i++) static_cast<int*>(data)[i] = static_cast<QList<int>*>(ptr)->at(i);
+}
+
+class MyQWizardPage: public QWizardPage
+{
+public:
+	MyQWizardPage(QWidget *parent) : QWizardPage(parent) {};
+	bool validatePage() { return callbackQWizardPage_ValidatePage(this) != 0; };
+	void cleanupPage() { callbackQWizardPage_CleanupPage(this); };
+	void Signal_CompleteChanged() { callbackQWizardPage_CompleteChanged(this); };
+	void initializePage() { callbackQWizardPage_InitializePage(this); };
+	bool isComplete() const { return callbackQWizardPage_IsComplete(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int nextId() const { return callbackQWizardPage_NextId(const_cast<void*>(static_cast<const void*>(this))); };
+	bool close() { return callbackQWidget_Close(this) != 0; };
+	bool event(QEvent * event) { return callbackQWidget_Event(this, event) != 0; };
+	bool focusNextPrevChild(bool next) { return callbackQWidget_FocusNextPrevChild(this, next) != 0; };
+	bool nativeEvent(const QByteArray & eventType, void * message, long * result) { return callbackQWidget_NativeEvent(this, const_cast<QByteArray*>(&eventType), message, *result) != 0; };
+	void actionEvent(QActionEvent * event) { callbackQWidget_ActionEvent(this, event); };
+	void changeEvent(QEvent * event) { callbackQWidget_ChangeEvent(this, event); };
+	void closeEvent(QCloseEvent * event) { callbackQWidget_CloseEvent(this, event); };
+	void contextMenuEvent(QContextMenuEvent * event) { callbackQWidget_ContextMenuEvent(this, event); };
+	void Signal_CustomContextMenuRequested(const QPoint & pos) { callbackQWidget_CustomContextMenuRequested(this, const_cast<QPoint*>(&pos)); };
+	void dragEnterEvent(QDragEnterEvent * event) { callbackQWidget_DragEnterEvent(this, event); };
+	void dragLeaveEvent(QDragLeaveEvent * event) { callbackQWidget_DragLeaveEvent(this, event); };
+	void dragMoveEvent(QDragMoveEvent * event) { callbackQWidget_DragMoveEvent(this, event); };
+	void dropEvent(QDropEvent * event) { callbackQWidget_DropEvent(this, event); };
+	void enterEvent(QEvent * event) { callbackQWidget_EnterEvent(this, event); };
+	void focusInEvent(QFocusEvent * event) { callbackQWidget_FocusInEvent(this, event); };
+	void focusOutEvent(QFocusEvent * event) { callbackQWidget_FocusOutEvent(this, event); };
+	void hide() { callbackQWidget_Hide(this); };
+	void hideEvent(QHideEvent * event) { callbackQWidget_HideEvent(this, event); };
+	void inputMethodEvent(QInputMethodEvent * event) { callbackQWidget_InputMethodEvent(this, event); };
+	void keyPressEvent(QKeyEvent * event) { callbackQWidget_KeyPressEvent(this, event); };
+	void keyReleaseEvent(QKeyEvent * event) { callbackQWidget_KeyReleaseEvent(this, event); };
+	void leaveEvent(QEvent * event) { callbackQWidget_LeaveEvent(this, event); };
+	void lower() { callbackQWidget_Lower(this); };
+	void mouseDoubleClickEvent(QMouseEvent * event) { callbackQWidget_MouseDoubleClickEvent(this, event); };
+	void mouseMoveEvent(QMouseEvent * event) { callbackQWidget_MouseMoveEvent(this, event); };
+	void mousePressEvent(QMouseEvent * event) { callbackQWidget_MousePressEvent(this, event); };
+	void mouseReleaseEvent(QMouseEvent * event) { callbackQWidget_MouseReleaseEvent(this, event); };
+	void moveEvent(QMoveEvent * event) { callbackQWidget_MoveEvent(this, event); };
+	void paintEvent(QPaintEvent * event) { callbackQWidget_PaintEvent(this, event); };
+	void raise() { callbackQWidget_Raise(this); };
+	void repaint() { callbackQWidget_Repaint(this); };
+	void resizeEvent(QResizeEvent * event) { callbackQWidget_ResizeEvent(this, event); };
+	void setDisabled(bool disable) { callbackQWidget_SetDisabled(this, disable); };
+	void setEnabled(bool vbo) { callbackQWidget_SetEnabled(this, vbo); };
+	void setFocus() { callbackQWidget_SetFocus2(this); };
+	void setHidden(bool hidden) { callbackQWidget_SetHidden(this, hidden); };
+	void setStyleSheet(const QString & styleSheet) { QByteArray t728ae7 = styleSheet.toUtf8(); QtWidgets_PackedString styleSheetPacked = { const_cast<char*>(t728ae7.prepend("WHITESPACE").constData()+10), t728ae7.size()-10 };callbackQWidget_SetStyleSheet(this, styleSheetPacked); };
+	void setVisible(bool visible) { callbackQWidget_SetVisible(this, visible); };
+	void setWindowModified(bool vbo) { callbackQWidget_SetWindowModified(this, vbo); };
+	void setWindowTitle(const QString & vqs) { QByteArray tda39a3 = vqs.toUtf8(); QtWidgets_PackedString vqsPacked = { const_cast<char*>(tda39a3.prepend("WHITESPACE").constData()+10), tda39a3.size()-10 };callbackQWidget_SetWindowTitle(this, vqsPacked); };
+	void show() { callbackQWidget_Show(this); };
+	void showEvent(QShowEvent * event) { callbackQWidget_ShowEvent(this, event); };
+	void showFullScreen() { callbackQWidget_ShowFullScreen(this); };
+	void showMaximized() { callbackQWidget_ShowMaximized(this); };
+	void showMinimized() { callbackQWidget_ShowMinimized(this); };
+	void showNormal() { callbackQWidget_ShowNormal(this); };
+	void tabletEvent(QTabletEvent * event) { callbackQWidget_TabletEvent(this, event); };
+	void update() { callbackQWidget_Update(this); };
+	void updateMicroFocus() { callbackQWidget_UpdateMicroFocus(this); };
+	void wheelEvent(QWheelEvent * event) { callbackQWidget_WheelEvent(this, event); };
+	void Signal_WindowIconChanged(const QIcon & icon) { callbackQWidget_WindowIconChanged(this, const_cast<QIcon*>(&icon)); };
+	void Signal_WindowTitleChanged(const QString & title) { QByteArray t3c6de1 = title.toUtf8(); QtWidgets_PackedString titlePacked = { const_cast<char*>(t3c6de1.prepend("WHITESPACE").constData()+10), t3c6de1.size()-10 };callbackQWidget_WindowTitleChanged(this, titlePacked); };
+	QPaintEngine * paintEngine() const { return static_cast<QPaintEngine*>(callbackQWidget_PaintEngine(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize minimumSizeHint() const { return *static_cast<QSize*>(callbackQWidget_MinimumSizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QSize sizeHint() const { return *static_cast<QSize*>(callbackQWidget_SizeHint(const_cast<void*>(static_cast<const void*>(this)))); };
+	QVariant inputMethodQuery(Qt::InputMethodQuery query) const { return *static_cast<QVariant*>(callbackQWidget_InputMethodQuery(const_cast<void*>(static_cast<const void*>(this)), query)); };
+	bool hasHeightForWidth() const { return callbackQWidget_HasHeightForWidth(const_cast<void*>(static_cast<const void*>(this))) != 0; };
+	int heightForWidth(int w) const { return callbackQWidget_HeightForWidth(const_cast<void*>(static_cast<const void*>(this)), w); };
+	int metric(QPaintDevice::PaintDeviceMetric m) const { return callbackQWidget_Metric(const_cast<void*>(static_cast<const void*>(this)), m); };
+	bool eventFilter(QObject * watched, QEvent * event) { return callbackQWidget_EventFilter(this, watched, event) != 0; };
+	void childEvent(QChildEvent * event) { callbackQWidget_ChildEvent(this, event); };
+	void connectNotify(const QMetaMethod & sign) { callbackQWidget_ConnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void customEvent(QEvent * event) { callbackQWidget_CustomEvent(this, event); };
+	void deleteLater() { callbackQWidget_DeleteLater(this); };
+	void Signal_Destroyed(QObject * obj) { callbackQWidget_Destroyed(this, obj); };
+	void disconnectNotify(const QMetaMethod & sign) { callbackQWidget_DisconnectNotify(this, const_cast<QMetaMethod*>(&sign)); };
+	void Signal_ObjectNameChanged(const QString & objectName) { QByteArray taa2c4f = objectName.toUtf8(); QtWidgets_PackedString objectNamePacked = { const_cast<char*>(taa2c4f.prepend("WHITESPACE").constData()+10), taa2c4f.size()-10 };callbackQWidget_ObjectNameChanged(this, objectNamePacked); };
+	void timerEvent(QTimerEvent * event) { callbackQWidget_TimerEvent(this, event); };
+	const QMetaObject * metaObject() const { return static_cast<QMetaObject*>(callbackQWidget_MetaObject(const_cast<void*>(static_cast<const void*>(this)))); };
+};
+
+void* QWizardPage_NewQWizardPage(void* parent)
+{
+	return new MyQWizardPage(static_cast<QWidget*>(parent));
+}
+
+char QWizardPage_ValidatePage(void* ptr)
+{
+	return static_cast<QWizardPage*>(ptr)->validatePage();
+}
+
+char QWizardPage_ValidatePageDefault(void* ptr)
+{
+		return static_cast<QWizardPage*>(ptr)->QWizardPage::validatePage();
+}
+
+void QWizardPage_CleanupPage(void* ptr)
+{
+	static_cast<QWizardPage*>(ptr)->cleanupPage();
+}
+
+void QWizardPage_CleanupPageDefault(void* ptr)
+{
+		static_cast<QWizardPage*>(ptr)->QWizardPage::cleanupPage();
+}
+
+void QWizardPage_ConnectCompleteChanged(void* ptr)
+{
+	QObject::connect(static_cast<QWizardPage*>(ptr), static_cast<void (QWizardPage::*)()>(&QWizardPage::completeChanged), static_cast<MyQWizardPage*>(ptr), static_cast<void (MyQWizardPage::*)()>(&MyQWizardPage::Signal_CompleteChanged));
+}
+
+void QWizardPage_DisconnectCompleteChanged(void* ptr)
+{
+	QObject::disconnect(static_cast<QWizardPage*>(ptr), static_cast<void (QWizardPage::*)()>(&QWizardPage::completeChanged), static_cast<MyQWizardPage*>(ptr), static_cast<void (MyQWizardPage::*)()>(&MyQWizardPage::Signal_CompleteChanged));
+}
+
+void QWizardPage_CompleteChanged(void* ptr)
+{
+	static_cast<QWizardPage*>(ptr)->completeChanged();
+}
+
+void QWizardPage_InitializePage(void* ptr)
+{
+	static_cast<QWizardPage*>(ptr)->initializePage();
+}
+
+void QWizardPage_InitializePageDefault(void* ptr)
+{
+		static_cast<QWizardPage*>(ptr)->QWizardPage::initializePage();
+}
+
+void QWizardPage_RegisterField(void* ptr, char* name, void* widget, char* property, char* changedSignal)
+{
+		static_cast<QWizardPage*>(ptr)->registerField(QString(name), static_cast<QWidget*>(widget), const_cast<const char*>(property), const_cast<const char*>(changedSignal));
+}
+
+void QWizardPage_SetButtonText(void* ptr, long long which, char* text)
+{
+	static_cast<QWizardPage*>(ptr)->setButtonText(static_cast<QWizard::WizardButton>(which), QString(text));
+}
+
+void QWizardPage_SetCommitPage(void* ptr, char commitPage)
+{
+	static_cast<QWizardPage*>(ptr)->setCommitPage(commitPage != 0);
+}
+
+void QWizardPage_SetField(void* ptr, char* name, void* value)
+{
+	static_cast<QWizardPage*>(ptr)->setField(QString(name), *static_cast<QVariant*>(value));
+}
+
+void QWizardPage_SetFinalPage(void* ptr, char finalPage)
+{
+	static_cast<QWizardPage*>(ptr)->setFinalPage(finalPage != 0);
+}
+
+void QWizardPage_SetPixmap(void* ptr, long long which, void* pixmap)
+{
+	static_cast<QWizardPage*>(ptr)->setPixmap(static_cast<QWizard::WizardPixmap>(which), *static_cast<QPixmap*>(pixmap));
+}
+
+void QWizardPage_SetSubTitle(void* ptr, char* subTitle)
+{
+	static_cast<QWizardPage*>(ptr)->setSubTitle(QString(subTitle));
+}
+
+void QWizardPage_SetTitle(void* ptr, char* title)
+{
+	static_cast<QWizardPage*>(ptr)->setTitle(QString(title));
+}
+
+void QWizardPage_DestroyQWizardPage(void* ptr)
+{
+	static_cast<QWizardPage*>(ptr)->~QWizardPage();
+}
+
+void* QWizardPage_Pixmap(void* ptr, long long which)
+{
+	return new QPixmap(static_cast<QWizardPage*>(ptr)->pixmap(static_cast<QWizard::WizardPixmap>(which)));
+}
+
+struct QtWidgets_PackedString QWizardPage_ButtonText(void* ptr, long long which)
+{
+	return ({ QByteArray t060d80 = static_cast<QWizardPage*>(ptr)->buttonText(static_cast<QWizard::WizardButton>(which)).toUtf8(); QtWidgets_PackedString { const_cast<char*>(t060d80.prepend("WHITESPACE").constData()+10), t060d80.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QWizardPage_SubTitle(void* ptr)
+{
+	return ({ QByteArray t00cff1 = static_cast<QWizardPage*>(ptr)->subTitle().toUtf8(); QtWidgets_PackedString { const_cast<char*>(t00cff1.prepend("WHITESPACE").constData()+10), t00cff1.size()-10 }; });
+}
+
+struct QtWidgets_PackedString QWizardPage_Title(void* ptr)
+{
+	return ({ QByteArray tf87e47 = static_cast<QWizardPage*>(ptr)->title().toUtf8(); QtWidgets_PackedString { const_cast<char*>(tf87e47.prepend("WHITESPACE").constData()+10), tf87e47.size()-10 }; });
+}
+
+void* QWizardPage_Field(void* ptr, char* name)
+{
+	return new QVariant(static_cast<QWizardPage*>(ptr)->field(QString(name)));
+}
+
+void* QWizardPage_Wizard(void* ptr)
+{
+	return static_cast<QWizardPage*>(ptr)->wizard();
+}
+
+char QWizardPage_IsCommitPage(void* ptr)
+{
+	return static_cast<QWizardPage*>(ptr)->isCommitPage();
+}
+
+char QWizardPage_IsComplete(void* ptr)
+{
+	return static_cast<QWizardPage*>(ptr)->isComplete();
+}
+
+char QWizardPage_IsCompleteDefault(void* ptr)
+{
+		return static_cast<QWizardPage*>(ptr)->QWizardPage::isComplete();
+}
+
+char QWizardPage_IsFinalPage(void* ptr)
+{
+	return static_cast<QWizardPage*>(ptr)->isFinalPage();
+}
+
+int QWizardPage_NextId(void* ptr)
+{
+	return static_cast<QWizardPage*>(ptr)->nextId();
+}
+
+int QWizardPage_NextIdDefault(void* ptr)
+{
+		return static_cast<QWizardPage*>(ptr)->QWizardPage::nextId();
+}
+
@@ -106,6 +106,8 @@ void QAbstractItemDelegate_UpdateEditorGeometryDefault(void* ptr, void* editor,
 int QAbstractItemDelegate___paintingRoles_atList(void* ptr, int i);
 void QAbstractItemDelegate___paintingRoles_setList(void* ptr, int i);
 void* QAbstractItemDelegate___paintingRoles_newList(void* ptr);
+void* QAbstractItemDelegate___paintingRoles_newListBuffer(void* ptr, void* data, int count);
+void QAbstractItemDelegate___paintingRoles_fillList(void* ptr, void* data);
 void* QAbstractItemDelegate___dynamicPropertyNames_atList(void* ptr, int i);
 void QAbstractItemDelegate___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QAbstractItemDelegate___dynamicPropertyNames_newList(void* ptr);
@@ -279,6 +281,8 @@ int QAbstractItemView_VerticalOffset(void* ptr);
 int QAbstractItemView___dataChanged_roles_atList(void* ptr, int i);
 void QAbstractItemView___dataChanged_roles_setList(void* ptr, int i);
 void* QAbstractItemView___dataChanged_roles_newList(void* ptr);
+void* QAbstractItemView___dataChanged_roles_newListBuffer(void* ptr, void* data, int count);
+void QAbstractItemView___dataChanged_roles_fillList(void* ptr, void* data);
 void* QAbstractItemView___selectedIndexes_atList(void* ptr, int i);
 void QAbstractItemView___selectedIndexes_setList(void* ptr, void* i);
 void* QAbstractItemView___selectedIndexes_newList(void* ptr);
@@ -982,9 +986,13 @@ void QColumnView_InitializeColumn(void* ptr, void* column);
 int QColumnView___setColumnWidths_list_atList(void* ptr, int i);
 void QColumnView___setColumnWidths_list_setList(void* ptr, int i);
 void* QColumnView___setColumnWidths_list_newList(void* ptr);
+void* QColumnView___setColumnWidths_list_newListBuffer(void* ptr, void* data, int count);
+void QColumnView___setColumnWidths_list_fillList(void* ptr, void* data);
 int QColumnView___columnWidths_atList(void* ptr, int i);
 void QColumnView___columnWidths_setList(void* ptr, int i);
 void* QColumnView___columnWidths_newList(void* ptr);
+void* QColumnView___columnWidths_newListBuffer(void* ptr, void* data, int count);
+void QColumnView___columnWidths_fillList(void* ptr, void* data);
 void* QComboBox_NewQComboBox(void* parent);
 void QComboBox_ConnectActivated2(void* ptr);
 void QComboBox_DisconnectActivated2(void* ptr);
@@ -1668,6 +1676,7 @@ struct QtWidgets_PackedString QFileSystemModel_MimeTypesDefault(void* ptr);
 struct QtWidgets_PackedString QFileSystemModel_NameFilters(void* ptr);
 void* QFileSystemModel_Data(void* ptr, void* index, int role);
 void* QFileSystemModel_DataDefault(void* ptr, void* index, int role);
+void QFileSystemModel_DataDefaultInto(void* ptr, void* index, int role, void* ret);
 void* QFileSystemModel_HeaderDataDefault(void* ptr, int section, long long orientation, int role);
 void* QFileSystemModel_MyComputer(void* ptr, int role);
 long long QFileSystemModel_SupportedDropActionsDefault(void* ptr);
@@ -1699,6 +1708,8 @@ void* QFileSystemModel___changePersistentIndexList_to_newList(void* ptr);
 int QFileSystemModel___dataChanged_roles_atList(void* ptr, int i);
 void QFileSystemModel___dataChanged_roles_setList(void* ptr, int i);
 void* QFileSystemModel___dataChanged_roles_newList(void* ptr);
+void* QFileSystemModel___dataChanged_roles_newListBuffer(void* ptr, void* data, int count);
+void QFileSystemModel___dataChanged_roles_fillList(void* ptr, void* data);
 void* QFileSystemModel___layoutAboutToBeChanged_parents_atList(void* ptr, int i);
 void QFileSystemModel___layoutAboutToBeChanged_parents_setList(void* ptr, void* i);
 void* QFileSystemModel___layoutAboutToBeChanged_parents_newList(void* ptr);
@@ -1722,18 +1733,28 @@ void* QFileSystemModel___persistentIndexList_newList(void* ptr);
 int QFileSystemModel_____setItemData_keyList_atList(void* ptr, int i);
 void QFileSystemModel_____setItemData_keyList_setList(void* ptr, int i);
 void* QFileSystemModel_____setItemData_keyList_newList(void* ptr);
+void* QFileSystemModel_____setItemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QFileSystemModel_____setItemData_keyList_fillList(void* ptr, void* data);
 int QFileSystemModel_____doSetRoleNames_keyList_atList(void* ptr, int i);
 void QFileSystemModel_____doSetRoleNames_keyList_setList(void* ptr, int i);
 void* QFileSystemModel_____doSetRoleNames_keyList_newList(void* ptr);
+void* QFileSystemModel_____doSetRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QFileSystemModel_____doSetRoleNames_keyList_fillList(void* ptr, void* data);
 int QFileSystemModel_____setRoleNames_keyList_atList(void* ptr, int i);
 void QFileSystemModel_____setRoleNames_keyList_setList(void* ptr, int i);
 void* QFileSystemModel_____setRoleNames_keyList_newList(void* ptr);
+void* QFileSystemModel_____setRoleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QFileSystemModel_____setRoleNames_keyList_fillList(void* ptr, void* data);
 int QFileSystemModel_____roleNames_keyList_atList(void* ptr, int i);
 void QFileSystemModel_____roleNames_keyList_setList(void* ptr, int i);
 void* QFileSystemModel_____roleNames_keyList_newList(void* ptr);
+void* QFileSystemModel_____roleNames_keyList_newListBuffer(void* ptr, void* data, int count);
+void QFileSystemModel_____roleNames_keyList_fillList(void* ptr, void* data);
 int QFileSystemModel_____itemData_keyList_atList(void* ptr, int i);
 void QFileSystemModel_____itemData_keyList_setList(void* ptr, int i);
 void* QFileSystemModel_____itemData_keyList_newList(void* ptr);
+void* QFileSystemModel_____itemData_keyList_newListBuffer(void* ptr, void* data, int count);
+void QFileSystemModel_____itemData_keyList_fillList(void* ptr, void* data);
 void* QFileSystemModel___dynamicPropertyNames_atList(void* ptr, int i);
 void QFileSystemModel___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QFileSystemModel___dynamicPropertyNames_newList(void* ptr);
@@ -2880,6 +2901,8 @@ void* QGraphicsScene___createItemGroup_items_newList(void* ptr);
 void* QGraphicsScene___changed_region_atList(void* ptr, int i);
 void QGraphicsScene___changed_region_setList(void* ptr, void* i);
 void* QGraphicsScene___changed_region_newList(void* ptr);
+void* QGraphicsScene___changed_region_newListBuffer(void* ptr, void* data, int count);
+void QGraphicsScene___changed_region_fillList(void* ptr, void* data);
 void* QGraphicsScene___collidingItems_atList(void* ptr, int i);
 void QGraphicsScene___collidingItems_setList(void* ptr, void* i);
 void* QGraphicsScene___collidingItems_newList(void* ptr);
@@ -3161,6 +3184,8 @@ char QGraphicsView_IsTransformed(void* ptr);
 void* QGraphicsView___updateScene_rects_atList(void* ptr, int i);
 void QGraphicsView___updateScene_rects_setList(void* ptr, void* i);
 void* QGraphicsView___updateScene_rects_newList(void* ptr);
+void* QGraphicsView___updateScene_rects_newListBuffer(void* ptr, void* data, int count);
+void QGraphicsView___updateScene_rects_fillList(void* ptr, void* data);
 void* QGraphicsView___items_atList(void* ptr, int i);
 void QGraphicsView___items_setList(void* ptr, void* i);
 void* QGraphicsView___items_newList(void* ptr);
@@ -4203,6 +4228,8 @@ void* QMainWindow___resizeDocks_docks_newList(void* ptr);
 int QMainWindow___resizeDocks_sizes_atList(void* ptr, int i);
 void QMainWindow___resizeDocks_sizes_setList(void* ptr, int i);
 void* QMainWindow___resizeDocks_sizes_newList(void* ptr);
+void* QMainWindow___resizeDocks_sizes_newListBuffer(void* ptr, void* data, int count);
+void QMainWindow___resizeDocks_sizes_fillList(void* ptr, void* data);
 void* QMainWindow___tabifiedDockWidgets_atList(void* ptr, int i);
 void QMainWindow___tabifiedDockWidgets_setList(void* ptr, void* i);
 void* QMainWindow___tabifiedDockWidgets_newList(void* ptr);
@@ -4823,9 +4850,13 @@ void* QScroller___activeScrollers_newList(void* ptr);
 double QScroller___setSnapPositionsX_positions_atList(void* ptr, int i);
 void QScroller___setSnapPositionsX_positions_setList(void* ptr, double i);
 void* QScroller___setSnapPositionsX_positions_newList(void* ptr);
+void* QScroller___setSnapPositionsX_positions_newListBuffer(void* ptr, void* data, int count);
+void QScroller___setSnapPositionsX_positions_fillList(void* ptr, void* data);
 double QScroller___setSnapPositionsY_positions_atList(void* ptr, int i);
 void QScroller___setSnapPositionsY_positions_setList(void* ptr, double i);
 void* QScroller___setSnapPositionsY_positions_newList(void* ptr);
+void* QScroller___setSnapPositionsY_positions_newListBuffer(void* ptr, void* data, int count);
+void QScroller___setSnapPositionsY_positions_fillList(void* ptr, void* data);
 void* QScroller___dynamicPropertyNames_atList(void* ptr, int i);
 void QScroller___dynamicPropertyNames_setList(void* ptr, void* i);
 void* QScroller___dynamicPropertyNames_newList(void* ptr);
@@ -5037,9 +5068,13 @@ void QSplitter_GetRange(void* ptr, int index, int min, int max);
 int QSplitter___setSizes_list_atList(void* ptr, int i);
 void QSplitter___setSizes_list_setList(void* ptr, int i);
 void* QSplitter___setSizes_list_newList(void* ptr);
+void* QSplitter___setSizes_list_newListBuffer(void* ptr, void* data, int count);
+void QSplitter___setSizes_list_fillList(void* ptr, void* data);
 int QSplitter___sizes_atList(void* ptr, int i);
 void QSplitter___sizes_setList(void* ptr, int i);
 void* QSplitter___sizes_newList(void* ptr);
+void* QSplitter___sizes_newListBuffer(void* ptr, void* data, int count);
+void QSplitter___sizes_fillList(void* ptr, void* data);
 void* QSplitterHandle_NewQSplitterHandle(long long orientation, void* parent);
 int QSplitterHandle_ClosestLegalPosition(void* ptr, int pos);
 void QSplitterHandle_MoveSplitter(void* ptr, int pos);
@@ -5774,21 +5809,33 @@ void* QStylePainter_Style(void* ptr);
 void* QStylePainter___drawLines_lines_atList6(void* ptr, int i);
 void QStylePainter___drawLines_lines_setList6(void* ptr, void* i);
 void* QStylePainter___drawLines_lines_newList6(void* ptr);
+void* QStylePainter___drawLines_lines_newListBuffer6(void* ptr, void* data, int count);
+void QStylePainter___drawLines_lines_fillList6(void* ptr, void* data);
 void* QStylePainter___drawLines_lines_atList2(void* ptr, int i);
 void QStylePainter___drawLines_lines_setList2(void* ptr, void* i);
 void* QStylePainter___drawLines_lines_newList2(void* ptr);
+void* QStylePainter___drawLines_lines_newListBuffer2(void* ptr, void* data, int count);
+void QStylePainter___drawLines_lines_fillList2(void* ptr, void* data);
 void* QStylePainter___drawLines_pointPairs_atList8(void* ptr, int i);
 void QStylePainter___drawLines_pointPairs_setList8(void* ptr, void* i);
 void* QStylePainter___drawLines_pointPairs_newList8(void* ptr);
+void* QStylePainter___drawLines_pointPairs_newListBuffer8(void* ptr, void* data, int count);
+void QStylePainter___drawLines_pointPairs_fillList8(void* ptr, void* data);
 void* QStylePainter___drawLines_pointPairs_atList4(void* ptr, int i);
 void QStylePainter___drawLines_pointPairs_setList4(void* ptr, void* i);
 void* QStylePainter___drawLines_pointPairs_newList4(void* ptr);
+void* QStylePainter___drawLines_pointPairs_newListBuffer4(void* ptr, void* data, int count);
+void QStylePainter___drawLines_pointPairs_fillList4(void* ptr, void* data);
 void* QStylePainter___drawRects_rectangles_atList4(void* ptr, int i);
 void QStylePainter___drawRects_rectangles_setList4(void* ptr, void* i);
 void* QStylePainter___drawRects_rectangles_newList4(void* ptr);
+void* QStylePainter___drawRects_rectangles_newListBuffer4(void* ptr, void* data, int count);
+void QStylePainter___drawRects_rectangles_fillList4(void* ptr, void* data);
 void* QStylePainter___drawRects_rectangles_atList2(void* ptr, int i);
 void QStylePainter___drawRects_rectangles_setList2(void* ptr, void* i);
 void* QStylePainter___drawRects_rectangles_newList2(void* ptr);
+void* QStylePainter___drawRects_rectangles_newListBuffer2(void* ptr, void* data, int count);
+void QStylePainter___drawRects_rectangles_fillList2(void* ptr, void* data);
 void* QStylePlugin_Create(void* ptr, char* key);
 void* QStylePlugin_NewQStylePlugin(void* parent);
 void QStylePlugin_DestroyQStylePlugin(void* ptr);
@@ -7602,9 +7649,13 @@ int QWizard_StartId(void* ptr);
 int QWizard___pageIds_atList(void* ptr, int i);
 void QWizard___pageIds_setList(void* ptr, int i);
 void* QWizard___pageIds_newList(void* ptr);
+void* QWizard___pageIds_newListBuffer(void* ptr, void* data, int count);
+void QWizard___pageIds_fillList(void* ptr, void* data);
 int QWizard___visitedPages_atList(void* ptr, int i);
 void QWizard___visitedPages_setList(void* ptr, int i);
 void* QWizard___visitedPages_newList(void* ptr);
+void* QWizard___visitedPages_newListBuffer(void* ptr, void* data, int count);
+void QWizard___visitedPages_fillList(void* ptr, void* data);
 void* QWizardPage_NewQWizardPage(void* parent);
 char QWizardPage_ValidatePage(void* ptr);
 char QWizardPage_ValidatePageDefault(void* ptr);
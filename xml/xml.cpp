@@ -45,6 +45,42 @@
 #include <QXmlParseException>
 #include <QXmlReader>
 #include <QXmlSimpleReader>
+#include <QList>
+#include <QScopedPointer>
+#include <QStringList>
+#include <cstdlib>
+#include <cstring>
+
+static char* goPackStringList(const QList<QByteArray>& items, long long* len)
+{
+	long long size = 4;
+	for (int i = 0; i < items.size(); i++) {
+		size += 4 + items.at(i).size();
+	}
+	char* out = static_cast<char*>(malloc(size));
+	char* p = out;
+	for (int i = -1; i < items.size(); i++) {
+		quint32 n = i < 0 ? items.size() : items.at(i).size();
+		for (int b = 0; b < 4; b++) {
+			*p++ = static_cast<char>(n >> (8 * b));
+		}
+		if (i >= 0) {
+			memcpy(p, items.at(i).constData(), n);
+			p += n;
+		}
+	}
+	*len = size;
+	return out;
+}
+
+static char* goPackStringList(const QStringList& list, long long* len)
+{
+	QList<QByteArray> items;
+	for (int i = 0; i < list.size(); i++) {
+		items.append(list.at(i).toUtf8());
+	}
+	return goPackStringList(items, len);
+}
 
 void* QDomAttr_NewQDomAttr()
 {
@@ -2184,12 +2220,12 @@ struct QtXml_PackedString QXmlNamespaceSupport_Uri(void* ptr, char* prefix)
 
 struct QtXml_PackedString QXmlNamespaceSupport_Prefixes(void* ptr)
 {
-	return ({ QByteArray t8faa65 = static_cast<QXmlNamespaceSupport*>(ptr)->prefixes().join("|").toUtf8(); QtXml_PackedString { const_cast<char*>(t8faa65.prepend("WHITESPACE").constData()+10), t8faa65.size()-10 }; });
+	return ({ long long t8faa65len; char* t8faa65 = goPackStringList(static_cast<QXmlNamespaceSupport*>(ptr)->prefixes(), &t8faa65len); QtXml_PackedString { t8faa65, t8faa65len }; });
 }
 
 struct QtXml_PackedString QXmlNamespaceSupport_Prefixes2(void* ptr, char* uri)
 {
-	return ({ QByteArray t8e741a = static_cast<QXmlNamespaceSupport*>(ptr)->prefixes(QString(uri)).join("|").toUtf8(); QtXml_PackedString { const_cast<char*>(t8e741a.prepend("WHITESPACE").constData()+10), t8e741a.size()-10 }; });
+	return ({ long long t8e741alen; char* t8e741a = goPackStringList(static_cast<QXmlNamespaceSupport*>(ptr)->prefixes(QString(uri)), &t8e741alen); QtXml_PackedString { t8e741a, t8e741alen }; });
 }
 
 void QXmlNamespaceSupport_ProcessName(void* ptr, char* qname, char isAttribute, char* nsuri, char* localname)
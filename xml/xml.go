@@ -8,11 +8,9 @@ package xml
 //#include "xml.h"
 import "C"
 import (
-	"fmt"
 	"github.com/therecipe/qt"
 	"github.com/therecipe/qt/core"
 	"runtime"
-	"strings"
 	"unsafe"
 )
 
@@ -22,6 +20,43 @@ func cGoUnpackString(s C.struct_QtXml_PackedString) string {
 	}
 	return C.GoStringN(s.data, C.int(s.len))
 }
+func cGoUnpackStringList(s C.struct_QtXml_PackedString) []string {
+	if s.data == nil || s.len < 4 {
+		return make([]string, 0)
+	}
+	var b = C.GoStringN(s.data, C.int(s.len))
+	var out = make([]string, 0, int(uint32(b[0])|uint32(b[1])<<8|uint32(b[2])<<16|uint32(b[3])<<24))
+	for i := 4; i+4 <= len(b); {
+		var n = int(uint32(b[i]) | uint32(b[i+1])<<8 | uint32(b[i+2])<<16 | uint32(b[i+3])<<24)
+		out = append(out, b[i+4:i+4+n])
+		i += 4 + n
+	}
+	return out
+}
+func cGoPackStringList(l []string) *C.char {
+	var n = 4
+	for _, s := range l {
+		n += 4 + len(s)
+	}
+	var p = C.malloc(C.size_t(n))
+	var b, o = qt.UnsafeBytes(p, n), 0
+	for i := -1; i < len(l); i++ {
+		var c = len(l)
+		if i >= 0 {
+			c = len(l[i])
+		}
+		b[o], b[o+1], b[o+2], b[o+3] = byte(c), byte(c>>8), byte(c>>16), byte(c>>24)
+		o += 4
+		if i >= 0 {
+			o += copy(b[o:], l[i])
+		}
+	}
+	return (*C.char)(p)
+}
+func cGoUnpackStringListAndFree(s C.struct_QtXml_PackedString) []string {
+	defer C.free(unsafe.Pointer(s.data))
+	return cGoUnpackStringList(s)
+}
 
 type QDomAttr struct {
 	QDomNode
@@ -2656,7 +2691,7 @@ func NewQXmlAttributes() *QXmlAttributes {
 
 //export callbackQXmlAttributes_DestroyQXmlAttributes
 func callbackQXmlAttributes_DestroyQXmlAttributes(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlAttributes"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlAttributes"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlAttributesFromPointer(ptr).DestroyQXmlAttributesDefault()
@@ -2666,21 +2701,21 @@ func callbackQXmlAttributes_DestroyQXmlAttributes(ptr unsafe.Pointer) {
 func (ptr *QXmlAttributes) ConnectDestroyQXmlAttributes(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlAttributes", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlAttributes", f)
 	}
 }
 
 func (ptr *QXmlAttributes) DisconnectDestroyQXmlAttributes() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlAttributes")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlAttributes")
 	}
 }
 
 func (ptr *QXmlAttributes) DestroyQXmlAttributes() {
 	if ptr.Pointer() != nil {
 		C.QXmlAttributes_DestroyQXmlAttributes(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2688,7 +2723,7 @@ func (ptr *QXmlAttributes) DestroyQXmlAttributes() {
 func (ptr *QXmlAttributes) DestroyQXmlAttributesDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlAttributes_DestroyQXmlAttributesDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -2882,7 +2917,7 @@ func NewQXmlContentHandlerFromPointer(ptr unsafe.Pointer) *QXmlContentHandler {
 
 //export callbackQXmlContentHandler_Characters
 func callbackQXmlContentHandler_Characters(ptr unsafe.Pointer, ch C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "characters"); signal != nil {
+	if signal := qt.GetSignal(ptr, "characters"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(ch)))))
 	}
 
@@ -2892,14 +2927,14 @@ func callbackQXmlContentHandler_Characters(ptr unsafe.Pointer, ch C.struct_QtXml
 func (ptr *QXmlContentHandler) ConnectCharacters(f func(ch string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "characters", f)
+		qt.ConnectSignal(ptr.Pointer(), "characters", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectCharacters() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "characters")
+		qt.DisconnectSignal(ptr.Pointer(), "characters")
 	}
 }
 
@@ -2914,7 +2949,7 @@ func (ptr *QXmlContentHandler) Characters(ch string) bool {
 
 //export callbackQXmlContentHandler_EndDocument
 func callbackQXmlContentHandler_EndDocument(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endDocument"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endDocument"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -2924,14 +2959,14 @@ func callbackQXmlContentHandler_EndDocument(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlContentHandler) ConnectEndDocument(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endDocument", f)
+		qt.ConnectSignal(ptr.Pointer(), "endDocument", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectEndDocument() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endDocument")
+		qt.DisconnectSignal(ptr.Pointer(), "endDocument")
 	}
 }
 
@@ -2944,7 +2979,7 @@ func (ptr *QXmlContentHandler) EndDocument() bool {
 
 //export callbackQXmlContentHandler_EndElement
 func callbackQXmlContentHandler_EndElement(ptr unsafe.Pointer, namespaceURI C.struct_QtXml_PackedString, localName C.struct_QtXml_PackedString, qName C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endElement"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endElement"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string) bool)(cGoUnpackString(namespaceURI), cGoUnpackString(localName), cGoUnpackString(qName)))))
 	}
 
@@ -2954,14 +2989,14 @@ func callbackQXmlContentHandler_EndElement(ptr unsafe.Pointer, namespaceURI C.st
 func (ptr *QXmlContentHandler) ConnectEndElement(f func(namespaceURI string, localName string, qName string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endElement", f)
+		qt.ConnectSignal(ptr.Pointer(), "endElement", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectEndElement() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endElement")
+		qt.DisconnectSignal(ptr.Pointer(), "endElement")
 	}
 }
 
@@ -2980,7 +3015,7 @@ func (ptr *QXmlContentHandler) EndElement(namespaceURI string, localName string,
 
 //export callbackQXmlContentHandler_EndPrefixMapping
 func callbackQXmlContentHandler_EndPrefixMapping(ptr unsafe.Pointer, prefix C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endPrefixMapping"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endPrefixMapping"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(prefix)))))
 	}
 
@@ -2990,14 +3025,14 @@ func callbackQXmlContentHandler_EndPrefixMapping(ptr unsafe.Pointer, prefix C.st
 func (ptr *QXmlContentHandler) ConnectEndPrefixMapping(f func(prefix string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endPrefixMapping", f)
+		qt.ConnectSignal(ptr.Pointer(), "endPrefixMapping", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectEndPrefixMapping() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endPrefixMapping")
+		qt.DisconnectSignal(ptr.Pointer(), "endPrefixMapping")
 	}
 }
 
@@ -3012,7 +3047,7 @@ func (ptr *QXmlContentHandler) EndPrefixMapping(prefix string) bool {
 
 //export callbackQXmlContentHandler_IgnorableWhitespace
 func callbackQXmlContentHandler_IgnorableWhitespace(ptr unsafe.Pointer, ch C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "ignorableWhitespace"); signal != nil {
+	if signal := qt.GetSignal(ptr, "ignorableWhitespace"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(ch)))))
 	}
 
@@ -3022,14 +3057,14 @@ func callbackQXmlContentHandler_IgnorableWhitespace(ptr unsafe.Pointer, ch C.str
 func (ptr *QXmlContentHandler) ConnectIgnorableWhitespace(f func(ch string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "ignorableWhitespace", f)
+		qt.ConnectSignal(ptr.Pointer(), "ignorableWhitespace", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectIgnorableWhitespace() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "ignorableWhitespace")
+		qt.DisconnectSignal(ptr.Pointer(), "ignorableWhitespace")
 	}
 }
 
@@ -3044,7 +3079,7 @@ func (ptr *QXmlContentHandler) IgnorableWhitespace(ch string) bool {
 
 //export callbackQXmlContentHandler_ProcessingInstruction
 func callbackQXmlContentHandler_ProcessingInstruction(ptr unsafe.Pointer, target C.struct_QtXml_PackedString, data C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "processingInstruction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "processingInstruction"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string) bool)(cGoUnpackString(target), cGoUnpackString(data)))))
 	}
 
@@ -3054,14 +3089,14 @@ func callbackQXmlContentHandler_ProcessingInstruction(ptr unsafe.Pointer, target
 func (ptr *QXmlContentHandler) ConnectProcessingInstruction(f func(target string, data string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "processingInstruction", f)
+		qt.ConnectSignal(ptr.Pointer(), "processingInstruction", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectProcessingInstruction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "processingInstruction")
+		qt.DisconnectSignal(ptr.Pointer(), "processingInstruction")
 	}
 }
 
@@ -3078,7 +3113,7 @@ func (ptr *QXmlContentHandler) ProcessingInstruction(target string, data string)
 
 //export callbackQXmlContentHandler_SkippedEntity
 func callbackQXmlContentHandler_SkippedEntity(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "skippedEntity"); signal != nil {
+	if signal := qt.GetSignal(ptr, "skippedEntity"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -3088,14 +3123,14 @@ func callbackQXmlContentHandler_SkippedEntity(ptr unsafe.Pointer, name C.struct_
 func (ptr *QXmlContentHandler) ConnectSkippedEntity(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "skippedEntity", f)
+		qt.ConnectSignal(ptr.Pointer(), "skippedEntity", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectSkippedEntity() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "skippedEntity")
+		qt.DisconnectSignal(ptr.Pointer(), "skippedEntity")
 	}
 }
 
@@ -3110,7 +3145,7 @@ func (ptr *QXmlContentHandler) SkippedEntity(name string) bool {
 
 //export callbackQXmlContentHandler_StartDocument
 func callbackQXmlContentHandler_StartDocument(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startDocument"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startDocument"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3120,14 +3155,14 @@ func callbackQXmlContentHandler_StartDocument(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlContentHandler) ConnectStartDocument(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startDocument", f)
+		qt.ConnectSignal(ptr.Pointer(), "startDocument", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectStartDocument() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startDocument")
+		qt.DisconnectSignal(ptr.Pointer(), "startDocument")
 	}
 }
 
@@ -3140,7 +3175,7 @@ func (ptr *QXmlContentHandler) StartDocument() bool {
 
 //export callbackQXmlContentHandler_StartElement
 func callbackQXmlContentHandler_StartElement(ptr unsafe.Pointer, namespaceURI C.struct_QtXml_PackedString, localName C.struct_QtXml_PackedString, qName C.struct_QtXml_PackedString, atts unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startElement"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startElement"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string, *QXmlAttributes) bool)(cGoUnpackString(namespaceURI), cGoUnpackString(localName), cGoUnpackString(qName), NewQXmlAttributesFromPointer(atts)))))
 	}
 
@@ -3150,14 +3185,14 @@ func callbackQXmlContentHandler_StartElement(ptr unsafe.Pointer, namespaceURI C.
 func (ptr *QXmlContentHandler) ConnectStartElement(f func(namespaceURI string, localName string, qName string, atts *QXmlAttributes) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startElement", f)
+		qt.ConnectSignal(ptr.Pointer(), "startElement", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectStartElement() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startElement")
+		qt.DisconnectSignal(ptr.Pointer(), "startElement")
 	}
 }
 
@@ -3176,7 +3211,7 @@ func (ptr *QXmlContentHandler) StartElement(namespaceURI string, localName strin
 
 //export callbackQXmlContentHandler_StartPrefixMapping
 func callbackQXmlContentHandler_StartPrefixMapping(ptr unsafe.Pointer, prefix C.struct_QtXml_PackedString, uri C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startPrefixMapping"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startPrefixMapping"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string) bool)(cGoUnpackString(prefix), cGoUnpackString(uri)))))
 	}
 
@@ -3186,14 +3221,14 @@ func callbackQXmlContentHandler_StartPrefixMapping(ptr unsafe.Pointer, prefix C.
 func (ptr *QXmlContentHandler) ConnectStartPrefixMapping(f func(prefix string, uri string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startPrefixMapping", f)
+		qt.ConnectSignal(ptr.Pointer(), "startPrefixMapping", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectStartPrefixMapping() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startPrefixMapping")
+		qt.DisconnectSignal(ptr.Pointer(), "startPrefixMapping")
 	}
 }
 
@@ -3210,7 +3245,7 @@ func (ptr *QXmlContentHandler) StartPrefixMapping(prefix string, uri string) boo
 
 //export callbackQXmlContentHandler_SetDocumentLocator
 func callbackQXmlContentHandler_SetDocumentLocator(ptr unsafe.Pointer, locator unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDocumentLocator"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDocumentLocator"); signal != nil {
 		signal.(func(*QXmlLocator))(NewQXmlLocatorFromPointer(locator))
 	}
 
@@ -3219,14 +3254,14 @@ func callbackQXmlContentHandler_SetDocumentLocator(ptr unsafe.Pointer, locator u
 func (ptr *QXmlContentHandler) ConnectSetDocumentLocator(f func(locator *QXmlLocator)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setDocumentLocator", f)
+		qt.ConnectSignal(ptr.Pointer(), "setDocumentLocator", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectSetDocumentLocator() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setDocumentLocator")
+		qt.DisconnectSignal(ptr.Pointer(), "setDocumentLocator")
 	}
 }
 
@@ -3238,7 +3273,7 @@ func (ptr *QXmlContentHandler) SetDocumentLocator(locator QXmlLocator_ITF) {
 
 //export callbackQXmlContentHandler_DestroyQXmlContentHandler
 func callbackQXmlContentHandler_DestroyQXmlContentHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlContentHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlContentHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlContentHandlerFromPointer(ptr).DestroyQXmlContentHandlerDefault()
@@ -3248,21 +3283,21 @@ func callbackQXmlContentHandler_DestroyQXmlContentHandler(ptr unsafe.Pointer) {
 func (ptr *QXmlContentHandler) ConnectDestroyQXmlContentHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlContentHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlContentHandler", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectDestroyQXmlContentHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlContentHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlContentHandler")
 	}
 }
 
 func (ptr *QXmlContentHandler) DestroyQXmlContentHandler() {
 	if ptr.Pointer() != nil {
 		C.QXmlContentHandler_DestroyQXmlContentHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3270,14 +3305,14 @@ func (ptr *QXmlContentHandler) DestroyQXmlContentHandler() {
 func (ptr *QXmlContentHandler) DestroyQXmlContentHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlContentHandler_DestroyQXmlContentHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlContentHandler_ErrorString
 func callbackQXmlContentHandler_ErrorString(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorString"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -3287,14 +3322,14 @@ func callbackQXmlContentHandler_ErrorString(ptr unsafe.Pointer) *C.char {
 func (ptr *QXmlContentHandler) ConnectErrorString(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorString", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorString", f)
 	}
 }
 
 func (ptr *QXmlContentHandler) DisconnectErrorString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorString")
+		qt.DisconnectSignal(ptr.Pointer(), "errorString")
 	}
 }
 
@@ -3345,7 +3380,7 @@ func NewQXmlDTDHandlerFromPointer(ptr unsafe.Pointer) *QXmlDTDHandler {
 
 //export callbackQXmlDTDHandler_NotationDecl
 func callbackQXmlDTDHandler_NotationDecl(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, publicId C.struct_QtXml_PackedString, systemId C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "notationDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "notationDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string) bool)(cGoUnpackString(name), cGoUnpackString(publicId), cGoUnpackString(systemId)))))
 	}
 
@@ -3355,14 +3390,14 @@ func callbackQXmlDTDHandler_NotationDecl(ptr unsafe.Pointer, name C.struct_QtXml
 func (ptr *QXmlDTDHandler) ConnectNotationDecl(f func(name string, publicId string, systemId string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "notationDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "notationDecl", f)
 	}
 }
 
 func (ptr *QXmlDTDHandler) DisconnectNotationDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "notationDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "notationDecl")
 	}
 }
 
@@ -3381,7 +3416,7 @@ func (ptr *QXmlDTDHandler) NotationDecl(name string, publicId string, systemId s
 
 //export callbackQXmlDTDHandler_UnparsedEntityDecl
 func callbackQXmlDTDHandler_UnparsedEntityDecl(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, publicId C.struct_QtXml_PackedString, systemId C.struct_QtXml_PackedString, notationName C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unparsedEntityDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unparsedEntityDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string, string) bool)(cGoUnpackString(name), cGoUnpackString(publicId), cGoUnpackString(systemId), cGoUnpackString(notationName)))))
 	}
 
@@ -3391,14 +3426,14 @@ func callbackQXmlDTDHandler_UnparsedEntityDecl(ptr unsafe.Pointer, name C.struct
 func (ptr *QXmlDTDHandler) ConnectUnparsedEntityDecl(f func(name string, publicId string, systemId string, notationName string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unparsedEntityDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "unparsedEntityDecl", f)
 	}
 }
 
 func (ptr *QXmlDTDHandler) DisconnectUnparsedEntityDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unparsedEntityDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "unparsedEntityDecl")
 	}
 }
 
@@ -3419,7 +3454,7 @@ func (ptr *QXmlDTDHandler) UnparsedEntityDecl(name string, publicId string, syst
 
 //export callbackQXmlDTDHandler_DestroyQXmlDTDHandler
 func callbackQXmlDTDHandler_DestroyQXmlDTDHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlDTDHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlDTDHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlDTDHandlerFromPointer(ptr).DestroyQXmlDTDHandlerDefault()
@@ -3429,21 +3464,21 @@ func callbackQXmlDTDHandler_DestroyQXmlDTDHandler(ptr unsafe.Pointer) {
 func (ptr *QXmlDTDHandler) ConnectDestroyQXmlDTDHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlDTDHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlDTDHandler", f)
 	}
 }
 
 func (ptr *QXmlDTDHandler) DisconnectDestroyQXmlDTDHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlDTDHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlDTDHandler")
 	}
 }
 
 func (ptr *QXmlDTDHandler) DestroyQXmlDTDHandler() {
 	if ptr.Pointer() != nil {
 		C.QXmlDTDHandler_DestroyQXmlDTDHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3451,14 +3486,14 @@ func (ptr *QXmlDTDHandler) DestroyQXmlDTDHandler() {
 func (ptr *QXmlDTDHandler) DestroyQXmlDTDHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlDTDHandler_DestroyQXmlDTDHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlDTDHandler_ErrorString
 func callbackQXmlDTDHandler_ErrorString(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorString"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -3468,14 +3503,14 @@ func callbackQXmlDTDHandler_ErrorString(ptr unsafe.Pointer) *C.char {
 func (ptr *QXmlDTDHandler) ConnectErrorString(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorString", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorString", f)
 	}
 }
 
 func (ptr *QXmlDTDHandler) DisconnectErrorString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorString")
+		qt.DisconnectSignal(ptr.Pointer(), "errorString")
 	}
 }
 
@@ -3526,7 +3561,7 @@ func NewQXmlDeclHandlerFromPointer(ptr unsafe.Pointer) *QXmlDeclHandler {
 
 //export callbackQXmlDeclHandler_AttributeDecl
 func callbackQXmlDeclHandler_AttributeDecl(ptr unsafe.Pointer, eName C.struct_QtXml_PackedString, aName C.struct_QtXml_PackedString, ty C.struct_QtXml_PackedString, valueDefault C.struct_QtXml_PackedString, value C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "attributeDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "attributeDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string, string, string) bool)(cGoUnpackString(eName), cGoUnpackString(aName), cGoUnpackString(ty), cGoUnpackString(valueDefault), cGoUnpackString(value)))))
 	}
 
@@ -3536,14 +3571,14 @@ func callbackQXmlDeclHandler_AttributeDecl(ptr unsafe.Pointer, eName C.struct_Qt
 func (ptr *QXmlDeclHandler) ConnectAttributeDecl(f func(eName string, aName string, ty string, valueDefault string, value string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "attributeDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "attributeDecl", f)
 	}
 }
 
 func (ptr *QXmlDeclHandler) DisconnectAttributeDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "attributeDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "attributeDecl")
 	}
 }
 
@@ -3566,7 +3601,7 @@ func (ptr *QXmlDeclHandler) AttributeDecl(eName string, aName string, ty string,
 
 //export callbackQXmlDeclHandler_ExternalEntityDecl
 func callbackQXmlDeclHandler_ExternalEntityDecl(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, publicId C.struct_QtXml_PackedString, systemId C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "externalEntityDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "externalEntityDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string) bool)(cGoUnpackString(name), cGoUnpackString(publicId), cGoUnpackString(systemId)))))
 	}
 
@@ -3576,14 +3611,14 @@ func callbackQXmlDeclHandler_ExternalEntityDecl(ptr unsafe.Pointer, name C.struc
 func (ptr *QXmlDeclHandler) ConnectExternalEntityDecl(f func(name string, publicId string, systemId string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "externalEntityDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "externalEntityDecl", f)
 	}
 }
 
 func (ptr *QXmlDeclHandler) DisconnectExternalEntityDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "externalEntityDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "externalEntityDecl")
 	}
 }
 
@@ -3602,7 +3637,7 @@ func (ptr *QXmlDeclHandler) ExternalEntityDecl(name string, publicId string, sys
 
 //export callbackQXmlDeclHandler_InternalEntityDecl
 func callbackQXmlDeclHandler_InternalEntityDecl(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, value C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "internalEntityDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "internalEntityDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string) bool)(cGoUnpackString(name), cGoUnpackString(value)))))
 	}
 
@@ -3612,14 +3647,14 @@ func callbackQXmlDeclHandler_InternalEntityDecl(ptr unsafe.Pointer, name C.struc
 func (ptr *QXmlDeclHandler) ConnectInternalEntityDecl(f func(name string, value string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "internalEntityDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "internalEntityDecl", f)
 	}
 }
 
 func (ptr *QXmlDeclHandler) DisconnectInternalEntityDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "internalEntityDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "internalEntityDecl")
 	}
 }
 
@@ -3636,7 +3671,7 @@ func (ptr *QXmlDeclHandler) InternalEntityDecl(name string, value string) bool {
 
 //export callbackQXmlDeclHandler_DestroyQXmlDeclHandler
 func callbackQXmlDeclHandler_DestroyQXmlDeclHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlDeclHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlDeclHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlDeclHandlerFromPointer(ptr).DestroyQXmlDeclHandlerDefault()
@@ -3646,21 +3681,21 @@ func callbackQXmlDeclHandler_DestroyQXmlDeclHandler(ptr unsafe.Pointer) {
 func (ptr *QXmlDeclHandler) ConnectDestroyQXmlDeclHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlDeclHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlDeclHandler", f)
 	}
 }
 
 func (ptr *QXmlDeclHandler) DisconnectDestroyQXmlDeclHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlDeclHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlDeclHandler")
 	}
 }
 
 func (ptr *QXmlDeclHandler) DestroyQXmlDeclHandler() {
 	if ptr.Pointer() != nil {
 		C.QXmlDeclHandler_DestroyQXmlDeclHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -3668,14 +3703,14 @@ func (ptr *QXmlDeclHandler) DestroyQXmlDeclHandler() {
 func (ptr *QXmlDeclHandler) DestroyQXmlDeclHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlDeclHandler_DestroyQXmlDeclHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlDeclHandler_ErrorString
 func callbackQXmlDeclHandler_ErrorString(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorString"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -3685,14 +3720,14 @@ func callbackQXmlDeclHandler_ErrorString(ptr unsafe.Pointer) *C.char {
 func (ptr *QXmlDeclHandler) ConnectErrorString(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorString", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorString", f)
 	}
 }
 
 func (ptr *QXmlDeclHandler) DisconnectErrorString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorString")
+		qt.DisconnectSignal(ptr.Pointer(), "errorString")
 	}
 }
 
@@ -3762,7 +3797,7 @@ func NewQXmlDefaultHandler() *QXmlDefaultHandler {
 
 //export callbackQXmlDefaultHandler_AttributeDecl
 func callbackQXmlDefaultHandler_AttributeDecl(ptr unsafe.Pointer, eName C.struct_QtXml_PackedString, aName C.struct_QtXml_PackedString, ty C.struct_QtXml_PackedString, valueDefault C.struct_QtXml_PackedString, value C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "attributeDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "attributeDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string, string, string) bool)(cGoUnpackString(eName), cGoUnpackString(aName), cGoUnpackString(ty), cGoUnpackString(valueDefault), cGoUnpackString(value)))))
 	}
 
@@ -3772,14 +3807,14 @@ func callbackQXmlDefaultHandler_AttributeDecl(ptr unsafe.Pointer, eName C.struct
 func (ptr *QXmlDefaultHandler) ConnectAttributeDecl(f func(eName string, aName string, ty string, valueDefault string, value string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "attributeDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "attributeDecl", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectAttributeDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "attributeDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "attributeDecl")
 	}
 }
 
@@ -3819,7 +3854,7 @@ func (ptr *QXmlDefaultHandler) AttributeDeclDefault(eName string, aName string,
 
 //export callbackQXmlDefaultHandler_Characters
 func callbackQXmlDefaultHandler_Characters(ptr unsafe.Pointer, ch C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "characters"); signal != nil {
+	if signal := qt.GetSignal(ptr, "characters"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(ch)))))
 	}
 
@@ -3829,14 +3864,14 @@ func callbackQXmlDefaultHandler_Characters(ptr unsafe.Pointer, ch C.struct_QtXml
 func (ptr *QXmlDefaultHandler) ConnectCharacters(f func(ch string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "characters", f)
+		qt.ConnectSignal(ptr.Pointer(), "characters", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectCharacters() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "characters")
+		qt.DisconnectSignal(ptr.Pointer(), "characters")
 	}
 }
 
@@ -3860,7 +3895,7 @@ func (ptr *QXmlDefaultHandler) CharactersDefault(ch string) bool {
 
 //export callbackQXmlDefaultHandler_Comment
 func callbackQXmlDefaultHandler_Comment(ptr unsafe.Pointer, ch C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "comment"); signal != nil {
+	if signal := qt.GetSignal(ptr, "comment"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(ch)))))
 	}
 
@@ -3870,14 +3905,14 @@ func callbackQXmlDefaultHandler_Comment(ptr unsafe.Pointer, ch C.struct_QtXml_Pa
 func (ptr *QXmlDefaultHandler) ConnectComment(f func(ch string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "comment", f)
+		qt.ConnectSignal(ptr.Pointer(), "comment", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectComment() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "comment")
+		qt.DisconnectSignal(ptr.Pointer(), "comment")
 	}
 }
 
@@ -3901,7 +3936,7 @@ func (ptr *QXmlDefaultHandler) CommentDefault(ch string) bool {
 
 //export callbackQXmlDefaultHandler_EndCDATA
 func callbackQXmlDefaultHandler_EndCDATA(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endCDATA"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endCDATA"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3911,14 +3946,14 @@ func callbackQXmlDefaultHandler_EndCDATA(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlDefaultHandler) ConnectEndCDATA(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endCDATA", f)
+		qt.ConnectSignal(ptr.Pointer(), "endCDATA", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectEndCDATA() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endCDATA")
+		qt.DisconnectSignal(ptr.Pointer(), "endCDATA")
 	}
 }
 
@@ -3938,7 +3973,7 @@ func (ptr *QXmlDefaultHandler) EndCDATADefault() bool {
 
 //export callbackQXmlDefaultHandler_EndDTD
 func callbackQXmlDefaultHandler_EndDTD(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endDTD"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endDTD"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3948,14 +3983,14 @@ func callbackQXmlDefaultHandler_EndDTD(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlDefaultHandler) ConnectEndDTD(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endDTD", f)
+		qt.ConnectSignal(ptr.Pointer(), "endDTD", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectEndDTD() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endDTD")
+		qt.DisconnectSignal(ptr.Pointer(), "endDTD")
 	}
 }
 
@@ -3975,7 +4010,7 @@ func (ptr *QXmlDefaultHandler) EndDTDDefault() bool {
 
 //export callbackQXmlDefaultHandler_EndDocument
 func callbackQXmlDefaultHandler_EndDocument(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endDocument"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endDocument"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -3985,14 +4020,14 @@ func callbackQXmlDefaultHandler_EndDocument(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlDefaultHandler) ConnectEndDocument(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endDocument", f)
+		qt.ConnectSignal(ptr.Pointer(), "endDocument", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectEndDocument() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endDocument")
+		qt.DisconnectSignal(ptr.Pointer(), "endDocument")
 	}
 }
 
@@ -4012,7 +4047,7 @@ func (ptr *QXmlDefaultHandler) EndDocumentDefault() bool {
 
 //export callbackQXmlDefaultHandler_EndElement
 func callbackQXmlDefaultHandler_EndElement(ptr unsafe.Pointer, namespaceURI C.struct_QtXml_PackedString, localName C.struct_QtXml_PackedString, qName C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endElement"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endElement"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string) bool)(cGoUnpackString(namespaceURI), cGoUnpackString(localName), cGoUnpackString(qName)))))
 	}
 
@@ -4022,14 +4057,14 @@ func callbackQXmlDefaultHandler_EndElement(ptr unsafe.Pointer, namespaceURI C.st
 func (ptr *QXmlDefaultHandler) ConnectEndElement(f func(namespaceURI string, localName string, qName string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endElement", f)
+		qt.ConnectSignal(ptr.Pointer(), "endElement", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectEndElement() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endElement")
+		qt.DisconnectSignal(ptr.Pointer(), "endElement")
 	}
 }
 
@@ -4061,7 +4096,7 @@ func (ptr *QXmlDefaultHandler) EndElementDefault(namespaceURI string, localName
 
 //export callbackQXmlDefaultHandler_EndEntity
 func callbackQXmlDefaultHandler_EndEntity(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endEntity"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endEntity"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -4071,14 +4106,14 @@ func callbackQXmlDefaultHandler_EndEntity(ptr unsafe.Pointer, name C.struct_QtXm
 func (ptr *QXmlDefaultHandler) ConnectEndEntity(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endEntity", f)
+		qt.ConnectSignal(ptr.Pointer(), "endEntity", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectEndEntity() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endEntity")
+		qt.DisconnectSignal(ptr.Pointer(), "endEntity")
 	}
 }
 
@@ -4102,7 +4137,7 @@ func (ptr *QXmlDefaultHandler) EndEntityDefault(name string) bool {
 
 //export callbackQXmlDefaultHandler_EndPrefixMapping
 func callbackQXmlDefaultHandler_EndPrefixMapping(ptr unsafe.Pointer, prefix C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endPrefixMapping"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endPrefixMapping"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(prefix)))))
 	}
 
@@ -4112,14 +4147,14 @@ func callbackQXmlDefaultHandler_EndPrefixMapping(ptr unsafe.Pointer, prefix C.st
 func (ptr *QXmlDefaultHandler) ConnectEndPrefixMapping(f func(prefix string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endPrefixMapping", f)
+		qt.ConnectSignal(ptr.Pointer(), "endPrefixMapping", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectEndPrefixMapping() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endPrefixMapping")
+		qt.DisconnectSignal(ptr.Pointer(), "endPrefixMapping")
 	}
 }
 
@@ -4143,7 +4178,7 @@ func (ptr *QXmlDefaultHandler) EndPrefixMappingDefault(prefix string) bool {
 
 //export callbackQXmlDefaultHandler_Error
 func callbackQXmlDefaultHandler_Error(ptr unsafe.Pointer, exception unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "error"); signal != nil {
+	if signal := qt.GetSignal(ptr, "error"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlParseException) bool)(NewQXmlParseExceptionFromPointer(exception)))))
 	}
 
@@ -4153,14 +4188,14 @@ func callbackQXmlDefaultHandler_Error(ptr unsafe.Pointer, exception unsafe.Point
 func (ptr *QXmlDefaultHandler) ConnectError(f func(exception *QXmlParseException) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "error", f)
+		qt.ConnectSignal(ptr.Pointer(), "error", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectError() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "error")
+		qt.DisconnectSignal(ptr.Pointer(), "error")
 	}
 }
 
@@ -4180,7 +4215,7 @@ func (ptr *QXmlDefaultHandler) ErrorDefault(exception QXmlParseException_ITF) bo
 
 //export callbackQXmlDefaultHandler_ExternalEntityDecl
 func callbackQXmlDefaultHandler_ExternalEntityDecl(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, publicId C.struct_QtXml_PackedString, systemId C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "externalEntityDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "externalEntityDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string) bool)(cGoUnpackString(name), cGoUnpackString(publicId), cGoUnpackString(systemId)))))
 	}
 
@@ -4190,14 +4225,14 @@ func callbackQXmlDefaultHandler_ExternalEntityDecl(ptr unsafe.Pointer, name C.st
 func (ptr *QXmlDefaultHandler) ConnectExternalEntityDecl(f func(name string, publicId string, systemId string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "externalEntityDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "externalEntityDecl", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectExternalEntityDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "externalEntityDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "externalEntityDecl")
 	}
 }
 
@@ -4229,7 +4264,7 @@ func (ptr *QXmlDefaultHandler) ExternalEntityDeclDefault(name string, publicId s
 
 //export callbackQXmlDefaultHandler_FatalError
 func callbackQXmlDefaultHandler_FatalError(ptr unsafe.Pointer, exception unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fatalError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fatalError"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlParseException) bool)(NewQXmlParseExceptionFromPointer(exception)))))
 	}
 
@@ -4239,14 +4274,14 @@ func callbackQXmlDefaultHandler_FatalError(ptr unsafe.Pointer, exception unsafe.
 func (ptr *QXmlDefaultHandler) ConnectFatalError(f func(exception *QXmlParseException) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fatalError", f)
+		qt.ConnectSignal(ptr.Pointer(), "fatalError", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectFatalError() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fatalError")
+		qt.DisconnectSignal(ptr.Pointer(), "fatalError")
 	}
 }
 
@@ -4266,7 +4301,7 @@ func (ptr *QXmlDefaultHandler) FatalErrorDefault(exception QXmlParseException_IT
 
 //export callbackQXmlDefaultHandler_IgnorableWhitespace
 func callbackQXmlDefaultHandler_IgnorableWhitespace(ptr unsafe.Pointer, ch C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "ignorableWhitespace"); signal != nil {
+	if signal := qt.GetSignal(ptr, "ignorableWhitespace"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(ch)))))
 	}
 
@@ -4276,14 +4311,14 @@ func callbackQXmlDefaultHandler_IgnorableWhitespace(ptr unsafe.Pointer, ch C.str
 func (ptr *QXmlDefaultHandler) ConnectIgnorableWhitespace(f func(ch string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "ignorableWhitespace", f)
+		qt.ConnectSignal(ptr.Pointer(), "ignorableWhitespace", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectIgnorableWhitespace() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "ignorableWhitespace")
+		qt.DisconnectSignal(ptr.Pointer(), "ignorableWhitespace")
 	}
 }
 
@@ -4307,7 +4342,7 @@ func (ptr *QXmlDefaultHandler) IgnorableWhitespaceDefault(ch string) bool {
 
 //export callbackQXmlDefaultHandler_InternalEntityDecl
 func callbackQXmlDefaultHandler_InternalEntityDecl(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, value C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "internalEntityDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "internalEntityDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string) bool)(cGoUnpackString(name), cGoUnpackString(value)))))
 	}
 
@@ -4317,14 +4352,14 @@ func callbackQXmlDefaultHandler_InternalEntityDecl(ptr unsafe.Pointer, name C.st
 func (ptr *QXmlDefaultHandler) ConnectInternalEntityDecl(f func(name string, value string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "internalEntityDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "internalEntityDecl", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectInternalEntityDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "internalEntityDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "internalEntityDecl")
 	}
 }
 
@@ -4352,7 +4387,7 @@ func (ptr *QXmlDefaultHandler) InternalEntityDeclDefault(name string, value stri
 
 //export callbackQXmlDefaultHandler_NotationDecl
 func callbackQXmlDefaultHandler_NotationDecl(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, publicId C.struct_QtXml_PackedString, systemId C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "notationDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "notationDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string) bool)(cGoUnpackString(name), cGoUnpackString(publicId), cGoUnpackString(systemId)))))
 	}
 
@@ -4362,14 +4397,14 @@ func callbackQXmlDefaultHandler_NotationDecl(ptr unsafe.Pointer, name C.struct_Q
 func (ptr *QXmlDefaultHandler) ConnectNotationDecl(f func(name string, publicId string, systemId string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "notationDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "notationDecl", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectNotationDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "notationDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "notationDecl")
 	}
 }
 
@@ -4401,7 +4436,7 @@ func (ptr *QXmlDefaultHandler) NotationDeclDefault(name string, publicId string,
 
 //export callbackQXmlDefaultHandler_ProcessingInstruction
 func callbackQXmlDefaultHandler_ProcessingInstruction(ptr unsafe.Pointer, target C.struct_QtXml_PackedString, data C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "processingInstruction"); signal != nil {
+	if signal := qt.GetSignal(ptr, "processingInstruction"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string) bool)(cGoUnpackString(target), cGoUnpackString(data)))))
 	}
 
@@ -4411,14 +4446,14 @@ func callbackQXmlDefaultHandler_ProcessingInstruction(ptr unsafe.Pointer, target
 func (ptr *QXmlDefaultHandler) ConnectProcessingInstruction(f func(target string, data string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "processingInstruction", f)
+		qt.ConnectSignal(ptr.Pointer(), "processingInstruction", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectProcessingInstruction() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "processingInstruction")
+		qt.DisconnectSignal(ptr.Pointer(), "processingInstruction")
 	}
 }
 
@@ -4446,7 +4481,7 @@ func (ptr *QXmlDefaultHandler) ProcessingInstructionDefault(target string, data
 
 //export callbackQXmlDefaultHandler_SkippedEntity
 func callbackQXmlDefaultHandler_SkippedEntity(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "skippedEntity"); signal != nil {
+	if signal := qt.GetSignal(ptr, "skippedEntity"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -4456,14 +4491,14 @@ func callbackQXmlDefaultHandler_SkippedEntity(ptr unsafe.Pointer, name C.struct_
 func (ptr *QXmlDefaultHandler) ConnectSkippedEntity(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "skippedEntity", f)
+		qt.ConnectSignal(ptr.Pointer(), "skippedEntity", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectSkippedEntity() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "skippedEntity")
+		qt.DisconnectSignal(ptr.Pointer(), "skippedEntity")
 	}
 }
 
@@ -4487,7 +4522,7 @@ func (ptr *QXmlDefaultHandler) SkippedEntityDefault(name string) bool {
 
 //export callbackQXmlDefaultHandler_StartCDATA
 func callbackQXmlDefaultHandler_StartCDATA(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startCDATA"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startCDATA"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -4497,14 +4532,14 @@ func callbackQXmlDefaultHandler_StartCDATA(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlDefaultHandler) ConnectStartCDATA(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startCDATA", f)
+		qt.ConnectSignal(ptr.Pointer(), "startCDATA", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectStartCDATA() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startCDATA")
+		qt.DisconnectSignal(ptr.Pointer(), "startCDATA")
 	}
 }
 
@@ -4524,7 +4559,7 @@ func (ptr *QXmlDefaultHandler) StartCDATADefault() bool {
 
 //export callbackQXmlDefaultHandler_StartDTD
 func callbackQXmlDefaultHandler_StartDTD(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, publicId C.struct_QtXml_PackedString, systemId C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startDTD"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startDTD"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string) bool)(cGoUnpackString(name), cGoUnpackString(publicId), cGoUnpackString(systemId)))))
 	}
 
@@ -4534,14 +4569,14 @@ func callbackQXmlDefaultHandler_StartDTD(ptr unsafe.Pointer, name C.struct_QtXml
 func (ptr *QXmlDefaultHandler) ConnectStartDTD(f func(name string, publicId string, systemId string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startDTD", f)
+		qt.ConnectSignal(ptr.Pointer(), "startDTD", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectStartDTD() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startDTD")
+		qt.DisconnectSignal(ptr.Pointer(), "startDTD")
 	}
 }
 
@@ -4573,7 +4608,7 @@ func (ptr *QXmlDefaultHandler) StartDTDDefault(name string, publicId string, sys
 
 //export callbackQXmlDefaultHandler_StartDocument
 func callbackQXmlDefaultHandler_StartDocument(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startDocument"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startDocument"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -4583,14 +4618,14 @@ func callbackQXmlDefaultHandler_StartDocument(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlDefaultHandler) ConnectStartDocument(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startDocument", f)
+		qt.ConnectSignal(ptr.Pointer(), "startDocument", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectStartDocument() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startDocument")
+		qt.DisconnectSignal(ptr.Pointer(), "startDocument")
 	}
 }
 
@@ -4610,7 +4645,7 @@ func (ptr *QXmlDefaultHandler) StartDocumentDefault() bool {
 
 //export callbackQXmlDefaultHandler_StartElement
 func callbackQXmlDefaultHandler_StartElement(ptr unsafe.Pointer, namespaceURI C.struct_QtXml_PackedString, localName C.struct_QtXml_PackedString, qName C.struct_QtXml_PackedString, atts unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startElement"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startElement"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string, *QXmlAttributes) bool)(cGoUnpackString(namespaceURI), cGoUnpackString(localName), cGoUnpackString(qName), NewQXmlAttributesFromPointer(atts)))))
 	}
 
@@ -4620,14 +4655,14 @@ func callbackQXmlDefaultHandler_StartElement(ptr unsafe.Pointer, namespaceURI C.
 func (ptr *QXmlDefaultHandler) ConnectStartElement(f func(namespaceURI string, localName string, qName string, atts *QXmlAttributes) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startElement", f)
+		qt.ConnectSignal(ptr.Pointer(), "startElement", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectStartElement() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startElement")
+		qt.DisconnectSignal(ptr.Pointer(), "startElement")
 	}
 }
 
@@ -4659,7 +4694,7 @@ func (ptr *QXmlDefaultHandler) StartElementDefault(namespaceURI string, localNam
 
 //export callbackQXmlDefaultHandler_StartEntity
 func callbackQXmlDefaultHandler_StartEntity(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startEntity"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startEntity"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -4669,14 +4704,14 @@ func callbackQXmlDefaultHandler_StartEntity(ptr unsafe.Pointer, name C.struct_Qt
 func (ptr *QXmlDefaultHandler) ConnectStartEntity(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startEntity", f)
+		qt.ConnectSignal(ptr.Pointer(), "startEntity", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectStartEntity() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startEntity")
+		qt.DisconnectSignal(ptr.Pointer(), "startEntity")
 	}
 }
 
@@ -4700,7 +4735,7 @@ func (ptr *QXmlDefaultHandler) StartEntityDefault(name string) bool {
 
 //export callbackQXmlDefaultHandler_StartPrefixMapping
 func callbackQXmlDefaultHandler_StartPrefixMapping(ptr unsafe.Pointer, prefix C.struct_QtXml_PackedString, uri C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startPrefixMapping"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startPrefixMapping"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string) bool)(cGoUnpackString(prefix), cGoUnpackString(uri)))))
 	}
 
@@ -4710,14 +4745,14 @@ func callbackQXmlDefaultHandler_StartPrefixMapping(ptr unsafe.Pointer, prefix C.
 func (ptr *QXmlDefaultHandler) ConnectStartPrefixMapping(f func(prefix string, uri string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startPrefixMapping", f)
+		qt.ConnectSignal(ptr.Pointer(), "startPrefixMapping", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectStartPrefixMapping() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startPrefixMapping")
+		qt.DisconnectSignal(ptr.Pointer(), "startPrefixMapping")
 	}
 }
 
@@ -4745,7 +4780,7 @@ func (ptr *QXmlDefaultHandler) StartPrefixMappingDefault(prefix string, uri stri
 
 //export callbackQXmlDefaultHandler_UnparsedEntityDecl
 func callbackQXmlDefaultHandler_UnparsedEntityDecl(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, publicId C.struct_QtXml_PackedString, systemId C.struct_QtXml_PackedString, notationName C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "unparsedEntityDecl"); signal != nil {
+	if signal := qt.GetSignal(ptr, "unparsedEntityDecl"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string, string) bool)(cGoUnpackString(name), cGoUnpackString(publicId), cGoUnpackString(systemId), cGoUnpackString(notationName)))))
 	}
 
@@ -4755,14 +4790,14 @@ func callbackQXmlDefaultHandler_UnparsedEntityDecl(ptr unsafe.Pointer, name C.st
 func (ptr *QXmlDefaultHandler) ConnectUnparsedEntityDecl(f func(name string, publicId string, systemId string, notationName string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "unparsedEntityDecl", f)
+		qt.ConnectSignal(ptr.Pointer(), "unparsedEntityDecl", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectUnparsedEntityDecl() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "unparsedEntityDecl")
+		qt.DisconnectSignal(ptr.Pointer(), "unparsedEntityDecl")
 	}
 }
 
@@ -4798,7 +4833,7 @@ func (ptr *QXmlDefaultHandler) UnparsedEntityDeclDefault(name string, publicId s
 
 //export callbackQXmlDefaultHandler_Warning
 func callbackQXmlDefaultHandler_Warning(ptr unsafe.Pointer, exception unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "warning"); signal != nil {
+	if signal := qt.GetSignal(ptr, "warning"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlParseException) bool)(NewQXmlParseExceptionFromPointer(exception)))))
 	}
 
@@ -4808,14 +4843,14 @@ func callbackQXmlDefaultHandler_Warning(ptr unsafe.Pointer, exception unsafe.Poi
 func (ptr *QXmlDefaultHandler) ConnectWarning(f func(exception *QXmlParseException) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "warning", f)
+		qt.ConnectSignal(ptr.Pointer(), "warning", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectWarning() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "warning")
+		qt.DisconnectSignal(ptr.Pointer(), "warning")
 	}
 }
 
@@ -4835,7 +4870,7 @@ func (ptr *QXmlDefaultHandler) WarningDefault(exception QXmlParseException_ITF)
 
 //export callbackQXmlDefaultHandler_SetDocumentLocator
 func callbackQXmlDefaultHandler_SetDocumentLocator(ptr unsafe.Pointer, locator unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDocumentLocator"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDocumentLocator"); signal != nil {
 		signal.(func(*QXmlLocator))(NewQXmlLocatorFromPointer(locator))
 	} else {
 		NewQXmlDefaultHandlerFromPointer(ptr).SetDocumentLocatorDefault(NewQXmlLocatorFromPointer(locator))
@@ -4845,14 +4880,14 @@ func callbackQXmlDefaultHandler_SetDocumentLocator(ptr unsafe.Pointer, locator u
 func (ptr *QXmlDefaultHandler) ConnectSetDocumentLocator(f func(locator *QXmlLocator)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setDocumentLocator", f)
+		qt.ConnectSignal(ptr.Pointer(), "setDocumentLocator", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectSetDocumentLocator() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setDocumentLocator")
+		qt.DisconnectSignal(ptr.Pointer(), "setDocumentLocator")
 	}
 }
 
@@ -4870,7 +4905,7 @@ func (ptr *QXmlDefaultHandler) SetDocumentLocatorDefault(locator QXmlLocator_ITF
 
 //export callbackQXmlDefaultHandler_DestroyQXmlDefaultHandler
 func callbackQXmlDefaultHandler_DestroyQXmlDefaultHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlDefaultHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlDefaultHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlDefaultHandlerFromPointer(ptr).DestroyQXmlDefaultHandlerDefault()
@@ -4880,21 +4915,21 @@ func callbackQXmlDefaultHandler_DestroyQXmlDefaultHandler(ptr unsafe.Pointer) {
 func (ptr *QXmlDefaultHandler) ConnectDestroyQXmlDefaultHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlDefaultHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlDefaultHandler", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectDestroyQXmlDefaultHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlDefaultHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlDefaultHandler")
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DestroyQXmlDefaultHandler() {
 	if ptr.Pointer() != nil {
 		C.QXmlDefaultHandler_DestroyQXmlDefaultHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -4902,14 +4937,14 @@ func (ptr *QXmlDefaultHandler) DestroyQXmlDefaultHandler() {
 func (ptr *QXmlDefaultHandler) DestroyQXmlDefaultHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlDefaultHandler_DestroyQXmlDefaultHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlDefaultHandler_ErrorString
 func callbackQXmlDefaultHandler_ErrorString(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorString"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -4919,14 +4954,14 @@ func callbackQXmlDefaultHandler_ErrorString(ptr unsafe.Pointer) *C.char {
 func (ptr *QXmlDefaultHandler) ConnectErrorString(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorString", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorString", f)
 	}
 }
 
 func (ptr *QXmlDefaultHandler) DisconnectErrorString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorString")
+		qt.DisconnectSignal(ptr.Pointer(), "errorString")
 	}
 }
 
@@ -4984,7 +5019,7 @@ func NewQXmlEntityResolverFromPointer(ptr unsafe.Pointer) *QXmlEntityResolver {
 
 //export callbackQXmlEntityResolver_DestroyQXmlEntityResolver
 func callbackQXmlEntityResolver_DestroyQXmlEntityResolver(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlEntityResolver"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlEntityResolver"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlEntityResolverFromPointer(ptr).DestroyQXmlEntityResolverDefault()
@@ -4994,21 +5029,21 @@ func callbackQXmlEntityResolver_DestroyQXmlEntityResolver(ptr unsafe.Pointer) {
 func (ptr *QXmlEntityResolver) ConnectDestroyQXmlEntityResolver(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlEntityResolver", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlEntityResolver", f)
 	}
 }
 
 func (ptr *QXmlEntityResolver) DisconnectDestroyQXmlEntityResolver() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlEntityResolver")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlEntityResolver")
 	}
 }
 
 func (ptr *QXmlEntityResolver) DestroyQXmlEntityResolver() {
 	if ptr.Pointer() != nil {
 		C.QXmlEntityResolver_DestroyQXmlEntityResolver(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5016,14 +5051,14 @@ func (ptr *QXmlEntityResolver) DestroyQXmlEntityResolver() {
 func (ptr *QXmlEntityResolver) DestroyQXmlEntityResolverDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlEntityResolver_DestroyQXmlEntityResolverDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlEntityResolver_ErrorString
 func callbackQXmlEntityResolver_ErrorString(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorString"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5033,14 +5068,14 @@ func callbackQXmlEntityResolver_ErrorString(ptr unsafe.Pointer) *C.char {
 func (ptr *QXmlEntityResolver) ConnectErrorString(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorString", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorString", f)
 	}
 }
 
 func (ptr *QXmlEntityResolver) DisconnectErrorString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorString")
+		qt.DisconnectSignal(ptr.Pointer(), "errorString")
 	}
 }
 
@@ -5091,7 +5126,7 @@ func NewQXmlErrorHandlerFromPointer(ptr unsafe.Pointer) *QXmlErrorHandler {
 
 //export callbackQXmlErrorHandler_Error
 func callbackQXmlErrorHandler_Error(ptr unsafe.Pointer, exception unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "error"); signal != nil {
+	if signal := qt.GetSignal(ptr, "error"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlParseException) bool)(NewQXmlParseExceptionFromPointer(exception)))))
 	}
 
@@ -5101,14 +5136,14 @@ func callbackQXmlErrorHandler_Error(ptr unsafe.Pointer, exception unsafe.Pointer
 func (ptr *QXmlErrorHandler) ConnectError(f func(exception *QXmlParseException) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "error", f)
+		qt.ConnectSignal(ptr.Pointer(), "error", f)
 	}
 }
 
 func (ptr *QXmlErrorHandler) DisconnectError() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "error")
+		qt.DisconnectSignal(ptr.Pointer(), "error")
 	}
 }
 
@@ -5121,7 +5156,7 @@ func (ptr *QXmlErrorHandler) Error(exception QXmlParseException_ITF) bool {
 
 //export callbackQXmlErrorHandler_FatalError
 func callbackQXmlErrorHandler_FatalError(ptr unsafe.Pointer, exception unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fatalError"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fatalError"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlParseException) bool)(NewQXmlParseExceptionFromPointer(exception)))))
 	}
 
@@ -5131,14 +5166,14 @@ func callbackQXmlErrorHandler_FatalError(ptr unsafe.Pointer, exception unsafe.Po
 func (ptr *QXmlErrorHandler) ConnectFatalError(f func(exception *QXmlParseException) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fatalError", f)
+		qt.ConnectSignal(ptr.Pointer(), "fatalError", f)
 	}
 }
 
 func (ptr *QXmlErrorHandler) DisconnectFatalError() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fatalError")
+		qt.DisconnectSignal(ptr.Pointer(), "fatalError")
 	}
 }
 
@@ -5151,7 +5186,7 @@ func (ptr *QXmlErrorHandler) FatalError(exception QXmlParseException_ITF) bool {
 
 //export callbackQXmlErrorHandler_Warning
 func callbackQXmlErrorHandler_Warning(ptr unsafe.Pointer, exception unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "warning"); signal != nil {
+	if signal := qt.GetSignal(ptr, "warning"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlParseException) bool)(NewQXmlParseExceptionFromPointer(exception)))))
 	}
 
@@ -5161,14 +5196,14 @@ func callbackQXmlErrorHandler_Warning(ptr unsafe.Pointer, exception unsafe.Point
 func (ptr *QXmlErrorHandler) ConnectWarning(f func(exception *QXmlParseException) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "warning", f)
+		qt.ConnectSignal(ptr.Pointer(), "warning", f)
 	}
 }
 
 func (ptr *QXmlErrorHandler) DisconnectWarning() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "warning")
+		qt.DisconnectSignal(ptr.Pointer(), "warning")
 	}
 }
 
@@ -5181,7 +5216,7 @@ func (ptr *QXmlErrorHandler) Warning(exception QXmlParseException_ITF) bool {
 
 //export callbackQXmlErrorHandler_DestroyQXmlErrorHandler
 func callbackQXmlErrorHandler_DestroyQXmlErrorHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlErrorHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlErrorHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlErrorHandlerFromPointer(ptr).DestroyQXmlErrorHandlerDefault()
@@ -5191,21 +5226,21 @@ func callbackQXmlErrorHandler_DestroyQXmlErrorHandler(ptr unsafe.Pointer) {
 func (ptr *QXmlErrorHandler) ConnectDestroyQXmlErrorHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlErrorHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlErrorHandler", f)
 	}
 }
 
 func (ptr *QXmlErrorHandler) DisconnectDestroyQXmlErrorHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlErrorHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlErrorHandler")
 	}
 }
 
 func (ptr *QXmlErrorHandler) DestroyQXmlErrorHandler() {
 	if ptr.Pointer() != nil {
 		C.QXmlErrorHandler_DestroyQXmlErrorHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5213,14 +5248,14 @@ func (ptr *QXmlErrorHandler) DestroyQXmlErrorHandler() {
 func (ptr *QXmlErrorHandler) DestroyQXmlErrorHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlErrorHandler_DestroyQXmlErrorHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlErrorHandler_ErrorString
 func callbackQXmlErrorHandler_ErrorString(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorString"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5230,14 +5265,14 @@ func callbackQXmlErrorHandler_ErrorString(ptr unsafe.Pointer) *C.char {
 func (ptr *QXmlErrorHandler) ConnectErrorString(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorString", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorString", f)
 	}
 }
 
 func (ptr *QXmlErrorHandler) DisconnectErrorString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorString")
+		qt.DisconnectSignal(ptr.Pointer(), "errorString")
 	}
 }
 
@@ -5288,7 +5323,7 @@ func NewQXmlInputSourceFromPointer(ptr unsafe.Pointer) *QXmlInputSource {
 
 //export callbackQXmlInputSource_Next
 func callbackQXmlInputSource_Next(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "next"); signal != nil {
+	if signal := qt.GetSignal(ptr, "next"); signal != nil {
 		return core.PointerFromQChar(signal.(func() *core.QChar)())
 	}
 
@@ -5298,14 +5333,14 @@ func callbackQXmlInputSource_Next(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlInputSource) ConnectNext(f func() *core.QChar) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "next", f)
+		qt.ConnectSignal(ptr.Pointer(), "next", f)
 	}
 }
 
 func (ptr *QXmlInputSource) DisconnectNext() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "next")
+		qt.DisconnectSignal(ptr.Pointer(), "next")
 	}
 }
 
@@ -5329,7 +5364,7 @@ func (ptr *QXmlInputSource) NextDefault() *core.QChar {
 
 //export callbackQXmlInputSource_FromRawData
 func callbackQXmlInputSource_FromRawData(ptr unsafe.Pointer, data unsafe.Pointer, beginning C.char) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fromRawData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fromRawData"); signal != nil {
 		return C.CString(signal.(func(*core.QByteArray, bool) string)(core.NewQByteArrayFromPointer(data), int8(beginning) != 0))
 	}
 
@@ -5339,14 +5374,14 @@ func callbackQXmlInputSource_FromRawData(ptr unsafe.Pointer, data unsafe.Pointer
 func (ptr *QXmlInputSource) ConnectFromRawData(f func(data *core.QByteArray, beginning bool) string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fromRawData", f)
+		qt.ConnectSignal(ptr.Pointer(), "fromRawData", f)
 	}
 }
 
 func (ptr *QXmlInputSource) DisconnectFromRawData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fromRawData")
+		qt.DisconnectSignal(ptr.Pointer(), "fromRawData")
 	}
 }
 
@@ -5374,7 +5409,7 @@ func NewQXmlInputSource2(dev core.QIODevice_ITF) *QXmlInputSource {
 
 //export callbackQXmlInputSource_FetchData
 func callbackQXmlInputSource_FetchData(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "fetchData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "fetchData"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlInputSourceFromPointer(ptr).FetchDataDefault()
@@ -5384,14 +5419,14 @@ func callbackQXmlInputSource_FetchData(ptr unsafe.Pointer) {
 func (ptr *QXmlInputSource) ConnectFetchData(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "fetchData", f)
+		qt.ConnectSignal(ptr.Pointer(), "fetchData", f)
 	}
 }
 
 func (ptr *QXmlInputSource) DisconnectFetchData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "fetchData")
+		qt.DisconnectSignal(ptr.Pointer(), "fetchData")
 	}
 }
 
@@ -5409,7 +5444,7 @@ func (ptr *QXmlInputSource) FetchDataDefault() {
 
 //export callbackQXmlInputSource_Reset
 func callbackQXmlInputSource_Reset(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "reset"); signal != nil {
+	if signal := qt.GetSignal(ptr, "reset"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlInputSourceFromPointer(ptr).ResetDefault()
@@ -5419,14 +5454,14 @@ func callbackQXmlInputSource_Reset(ptr unsafe.Pointer) {
 func (ptr *QXmlInputSource) ConnectReset(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "reset", f)
+		qt.ConnectSignal(ptr.Pointer(), "reset", f)
 	}
 }
 
 func (ptr *QXmlInputSource) DisconnectReset() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "reset")
+		qt.DisconnectSignal(ptr.Pointer(), "reset")
 	}
 }
 
@@ -5444,7 +5479,7 @@ func (ptr *QXmlInputSource) ResetDefault() {
 
 //export callbackQXmlInputSource_SetData2
 func callbackQXmlInputSource_SetData2(ptr unsafe.Pointer, dat unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setData2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setData2"); signal != nil {
 		signal.(func(*core.QByteArray))(core.NewQByteArrayFromPointer(dat))
 	} else {
 		NewQXmlInputSourceFromPointer(ptr).SetData2Default(core.NewQByteArrayFromPointer(dat))
@@ -5454,14 +5489,14 @@ func callbackQXmlInputSource_SetData2(ptr unsafe.Pointer, dat unsafe.Pointer) {
 func (ptr *QXmlInputSource) ConnectSetData2(f func(dat *core.QByteArray)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setData2", f)
+		qt.ConnectSignal(ptr.Pointer(), "setData2", f)
 	}
 }
 
 func (ptr *QXmlInputSource) DisconnectSetData2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setData2")
+		qt.DisconnectSignal(ptr.Pointer(), "setData2")
 	}
 }
 
@@ -5479,7 +5514,7 @@ func (ptr *QXmlInputSource) SetData2Default(dat core.QByteArray_ITF) {
 
 //export callbackQXmlInputSource_SetData
 func callbackQXmlInputSource_SetData(ptr unsafe.Pointer, dat C.struct_QtXml_PackedString) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setData"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setData"); signal != nil {
 		signal.(func(string))(cGoUnpackString(dat))
 	} else {
 		NewQXmlInputSourceFromPointer(ptr).SetDataDefault(cGoUnpackString(dat))
@@ -5489,14 +5524,14 @@ func callbackQXmlInputSource_SetData(ptr unsafe.Pointer, dat C.struct_QtXml_Pack
 func (ptr *QXmlInputSource) ConnectSetData(f func(dat string)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setData", f)
+		qt.ConnectSignal(ptr.Pointer(), "setData", f)
 	}
 }
 
 func (ptr *QXmlInputSource) DisconnectSetData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setData")
+		qt.DisconnectSignal(ptr.Pointer(), "setData")
 	}
 }
 
@@ -5518,7 +5553,7 @@ func (ptr *QXmlInputSource) SetDataDefault(dat string) {
 
 //export callbackQXmlInputSource_DestroyQXmlInputSource
 func callbackQXmlInputSource_DestroyQXmlInputSource(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlInputSource"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlInputSource"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlInputSourceFromPointer(ptr).DestroyQXmlInputSourceDefault()
@@ -5528,21 +5563,21 @@ func callbackQXmlInputSource_DestroyQXmlInputSource(ptr unsafe.Pointer) {
 func (ptr *QXmlInputSource) ConnectDestroyQXmlInputSource(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlInputSource", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlInputSource", f)
 	}
 }
 
 func (ptr *QXmlInputSource) DisconnectDestroyQXmlInputSource() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlInputSource")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlInputSource")
 	}
 }
 
 func (ptr *QXmlInputSource) DestroyQXmlInputSource() {
 	if ptr.Pointer() != nil {
 		C.QXmlInputSource_DestroyQXmlInputSource(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5550,14 +5585,14 @@ func (ptr *QXmlInputSource) DestroyQXmlInputSource() {
 func (ptr *QXmlInputSource) DestroyQXmlInputSourceDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlInputSource_DestroyQXmlInputSourceDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlInputSource_Data
 func callbackQXmlInputSource_Data(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "data"); signal != nil {
+	if signal := qt.GetSignal(ptr, "data"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5567,14 +5602,14 @@ func callbackQXmlInputSource_Data(ptr unsafe.Pointer) *C.char {
 func (ptr *QXmlInputSource) ConnectData(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "data", f)
+		qt.ConnectSignal(ptr.Pointer(), "data", f)
 	}
 }
 
 func (ptr *QXmlInputSource) DisconnectData() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "data")
+		qt.DisconnectSignal(ptr.Pointer(), "data")
 	}
 }
 
@@ -5648,7 +5683,7 @@ func NewQXmlLexicalHandlerFromPointer(ptr unsafe.Pointer) *QXmlLexicalHandler {
 
 //export callbackQXmlLexicalHandler_Comment
 func callbackQXmlLexicalHandler_Comment(ptr unsafe.Pointer, ch C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "comment"); signal != nil {
+	if signal := qt.GetSignal(ptr, "comment"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(ch)))))
 	}
 
@@ -5658,14 +5693,14 @@ func callbackQXmlLexicalHandler_Comment(ptr unsafe.Pointer, ch C.struct_QtXml_Pa
 func (ptr *QXmlLexicalHandler) ConnectComment(f func(ch string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "comment", f)
+		qt.ConnectSignal(ptr.Pointer(), "comment", f)
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DisconnectComment() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "comment")
+		qt.DisconnectSignal(ptr.Pointer(), "comment")
 	}
 }
 
@@ -5680,7 +5715,7 @@ func (ptr *QXmlLexicalHandler) Comment(ch string) bool {
 
 //export callbackQXmlLexicalHandler_EndCDATA
 func callbackQXmlLexicalHandler_EndCDATA(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endCDATA"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endCDATA"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5690,14 +5725,14 @@ func callbackQXmlLexicalHandler_EndCDATA(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlLexicalHandler) ConnectEndCDATA(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endCDATA", f)
+		qt.ConnectSignal(ptr.Pointer(), "endCDATA", f)
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DisconnectEndCDATA() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endCDATA")
+		qt.DisconnectSignal(ptr.Pointer(), "endCDATA")
 	}
 }
 
@@ -5710,7 +5745,7 @@ func (ptr *QXmlLexicalHandler) EndCDATA() bool {
 
 //export callbackQXmlLexicalHandler_EndDTD
 func callbackQXmlLexicalHandler_EndDTD(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endDTD"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endDTD"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5720,14 +5755,14 @@ func callbackQXmlLexicalHandler_EndDTD(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlLexicalHandler) ConnectEndDTD(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endDTD", f)
+		qt.ConnectSignal(ptr.Pointer(), "endDTD", f)
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DisconnectEndDTD() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endDTD")
+		qt.DisconnectSignal(ptr.Pointer(), "endDTD")
 	}
 }
 
@@ -5740,7 +5775,7 @@ func (ptr *QXmlLexicalHandler) EndDTD() bool {
 
 //export callbackQXmlLexicalHandler_EndEntity
 func callbackQXmlLexicalHandler_EndEntity(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "endEntity"); signal != nil {
+	if signal := qt.GetSignal(ptr, "endEntity"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -5750,14 +5785,14 @@ func callbackQXmlLexicalHandler_EndEntity(ptr unsafe.Pointer, name C.struct_QtXm
 func (ptr *QXmlLexicalHandler) ConnectEndEntity(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "endEntity", f)
+		qt.ConnectSignal(ptr.Pointer(), "endEntity", f)
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DisconnectEndEntity() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "endEntity")
+		qt.DisconnectSignal(ptr.Pointer(), "endEntity")
 	}
 }
 
@@ -5772,7 +5807,7 @@ func (ptr *QXmlLexicalHandler) EndEntity(name string) bool {
 
 //export callbackQXmlLexicalHandler_StartCDATA
 func callbackQXmlLexicalHandler_StartCDATA(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startCDATA"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startCDATA"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -5782,14 +5817,14 @@ func callbackQXmlLexicalHandler_StartCDATA(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlLexicalHandler) ConnectStartCDATA(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startCDATA", f)
+		qt.ConnectSignal(ptr.Pointer(), "startCDATA", f)
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DisconnectStartCDATA() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startCDATA")
+		qt.DisconnectSignal(ptr.Pointer(), "startCDATA")
 	}
 }
 
@@ -5802,7 +5837,7 @@ func (ptr *QXmlLexicalHandler) StartCDATA() bool {
 
 //export callbackQXmlLexicalHandler_StartDTD
 func callbackQXmlLexicalHandler_StartDTD(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, publicId C.struct_QtXml_PackedString, systemId C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startDTD"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startDTD"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, string, string) bool)(cGoUnpackString(name), cGoUnpackString(publicId), cGoUnpackString(systemId)))))
 	}
 
@@ -5812,14 +5847,14 @@ func callbackQXmlLexicalHandler_StartDTD(ptr unsafe.Pointer, name C.struct_QtXml
 func (ptr *QXmlLexicalHandler) ConnectStartDTD(f func(name string, publicId string, systemId string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startDTD", f)
+		qt.ConnectSignal(ptr.Pointer(), "startDTD", f)
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DisconnectStartDTD() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startDTD")
+		qt.DisconnectSignal(ptr.Pointer(), "startDTD")
 	}
 }
 
@@ -5838,7 +5873,7 @@ func (ptr *QXmlLexicalHandler) StartDTD(name string, publicId string, systemId s
 
 //export callbackQXmlLexicalHandler_StartEntity
 func callbackQXmlLexicalHandler_StartEntity(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "startEntity"); signal != nil {
+	if signal := qt.GetSignal(ptr, "startEntity"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -5848,14 +5883,14 @@ func callbackQXmlLexicalHandler_StartEntity(ptr unsafe.Pointer, name C.struct_Qt
 func (ptr *QXmlLexicalHandler) ConnectStartEntity(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "startEntity", f)
+		qt.ConnectSignal(ptr.Pointer(), "startEntity", f)
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DisconnectStartEntity() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "startEntity")
+		qt.DisconnectSignal(ptr.Pointer(), "startEntity")
 	}
 }
 
@@ -5870,7 +5905,7 @@ func (ptr *QXmlLexicalHandler) StartEntity(name string) bool {
 
 //export callbackQXmlLexicalHandler_DestroyQXmlLexicalHandler
 func callbackQXmlLexicalHandler_DestroyQXmlLexicalHandler(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlLexicalHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlLexicalHandler"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlLexicalHandlerFromPointer(ptr).DestroyQXmlLexicalHandlerDefault()
@@ -5880,21 +5915,21 @@ func callbackQXmlLexicalHandler_DestroyQXmlLexicalHandler(ptr unsafe.Pointer) {
 func (ptr *QXmlLexicalHandler) ConnectDestroyQXmlLexicalHandler(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlLexicalHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlLexicalHandler", f)
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DisconnectDestroyQXmlLexicalHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlLexicalHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlLexicalHandler")
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DestroyQXmlLexicalHandler() {
 	if ptr.Pointer() != nil {
 		C.QXmlLexicalHandler_DestroyQXmlLexicalHandler(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -5902,14 +5937,14 @@ func (ptr *QXmlLexicalHandler) DestroyQXmlLexicalHandler() {
 func (ptr *QXmlLexicalHandler) DestroyQXmlLexicalHandlerDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlLexicalHandler_DestroyQXmlLexicalHandlerDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlLexicalHandler_ErrorString
 func callbackQXmlLexicalHandler_ErrorString(ptr unsafe.Pointer) *C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorString"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorString"); signal != nil {
 		return C.CString(signal.(func() string)())
 	}
 
@@ -5919,14 +5954,14 @@ func callbackQXmlLexicalHandler_ErrorString(ptr unsafe.Pointer) *C.char {
 func (ptr *QXmlLexicalHandler) ConnectErrorString(f func() string) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorString", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorString", f)
 	}
 }
 
 func (ptr *QXmlLexicalHandler) DisconnectErrorString() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorString")
+		qt.DisconnectSignal(ptr.Pointer(), "errorString")
 	}
 }
 
@@ -5980,7 +6015,7 @@ func NewQXmlLocator() *QXmlLocator {
 
 //export callbackQXmlLocator_DestroyQXmlLocator
 func callbackQXmlLocator_DestroyQXmlLocator(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlLocator"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlLocator"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlLocatorFromPointer(ptr).DestroyQXmlLocatorDefault()
@@ -5990,21 +6025,21 @@ func callbackQXmlLocator_DestroyQXmlLocator(ptr unsafe.Pointer) {
 func (ptr *QXmlLocator) ConnectDestroyQXmlLocator(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlLocator", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlLocator", f)
 	}
 }
 
 func (ptr *QXmlLocator) DisconnectDestroyQXmlLocator() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlLocator")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlLocator")
 	}
 }
 
 func (ptr *QXmlLocator) DestroyQXmlLocator() {
 	if ptr.Pointer() != nil {
 		C.QXmlLocator_DestroyQXmlLocator(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6012,14 +6047,14 @@ func (ptr *QXmlLocator) DestroyQXmlLocator() {
 func (ptr *QXmlLocator) DestroyQXmlLocatorDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlLocator_DestroyQXmlLocatorDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlLocator_ColumnNumber
 func callbackQXmlLocator_ColumnNumber(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "columnNumber"); signal != nil {
+	if signal := qt.GetSignal(ptr, "columnNumber"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -6029,14 +6064,14 @@ func callbackQXmlLocator_ColumnNumber(ptr unsafe.Pointer) C.int {
 func (ptr *QXmlLocator) ConnectColumnNumber(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "columnNumber", f)
+		qt.ConnectSignal(ptr.Pointer(), "columnNumber", f)
 	}
 }
 
 func (ptr *QXmlLocator) DisconnectColumnNumber() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "columnNumber")
+		qt.DisconnectSignal(ptr.Pointer(), "columnNumber")
 	}
 }
 
@@ -6049,7 +6084,7 @@ func (ptr *QXmlLocator) ColumnNumber() int {
 
 //export callbackQXmlLocator_LineNumber
 func callbackQXmlLocator_LineNumber(ptr unsafe.Pointer) C.int {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lineNumber"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lineNumber"); signal != nil {
 		return C.int(int32(signal.(func() int)()))
 	}
 
@@ -6059,14 +6094,14 @@ func callbackQXmlLocator_LineNumber(ptr unsafe.Pointer) C.int {
 func (ptr *QXmlLocator) ConnectLineNumber(f func() int) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lineNumber", f)
+		qt.ConnectSignal(ptr.Pointer(), "lineNumber", f)
 	}
 }
 
 func (ptr *QXmlLocator) DisconnectLineNumber() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lineNumber")
+		qt.DisconnectSignal(ptr.Pointer(), "lineNumber")
 	}
 }
 
@@ -6175,7 +6210,7 @@ func (ptr *QXmlNamespaceSupport) Uri(prefix string) string {
 
 func (ptr *QXmlNamespaceSupport) Prefixes() []string {
 	if ptr.Pointer() != nil {
-		return strings.Split(cGoUnpackString(C.QXmlNamespaceSupport_Prefixes(ptr.Pointer())), "|")
+		return cGoUnpackStringListAndFree(C.QXmlNamespaceSupport_Prefixes(ptr.Pointer()))
 	}
 	return make([]string, 0)
 }
@@ -6184,7 +6219,7 @@ func (ptr *QXmlNamespaceSupport) Prefixes2(uri string) []string {
 	if ptr.Pointer() != nil {
 		var uriC = C.CString(uri)
 		defer C.free(unsafe.Pointer(uriC))
-		return strings.Split(cGoUnpackString(C.QXmlNamespaceSupport_Prefixes2(ptr.Pointer(), uriC)), "|")
+		return cGoUnpackStringListAndFree(C.QXmlNamespaceSupport_Prefixes2(ptr.Pointer(), uriC))
 	}
 	return make([]string, 0)
 }
@@ -6350,7 +6385,7 @@ func NewQXmlReaderFromPointer(ptr unsafe.Pointer) *QXmlReader {
 
 //export callbackQXmlReader_Parse
 func callbackQXmlReader_Parse(ptr unsafe.Pointer, input unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parse"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parse"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlInputSource) bool)(NewQXmlInputSourceFromPointer(input)))))
 	}
 
@@ -6360,14 +6395,14 @@ func callbackQXmlReader_Parse(ptr unsafe.Pointer, input unsafe.Pointer) C.char {
 func (ptr *QXmlReader) ConnectParse(f func(input *QXmlInputSource) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parse", f)
+		qt.ConnectSignal(ptr.Pointer(), "parse", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectParse() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parse")
+		qt.DisconnectSignal(ptr.Pointer(), "parse")
 	}
 }
 
@@ -6380,7 +6415,7 @@ func (ptr *QXmlReader) Parse(input QXmlInputSource_ITF) bool {
 
 //export callbackQXmlReader_SetContentHandler
 func callbackQXmlReader_SetContentHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setContentHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setContentHandler"); signal != nil {
 		signal.(func(*QXmlContentHandler))(NewQXmlContentHandlerFromPointer(handler))
 	}
 
@@ -6389,14 +6424,14 @@ func callbackQXmlReader_SetContentHandler(ptr unsafe.Pointer, handler unsafe.Poi
 func (ptr *QXmlReader) ConnectSetContentHandler(f func(handler *QXmlContentHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setContentHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setContentHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectSetContentHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setContentHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setContentHandler")
 	}
 }
 
@@ -6408,7 +6443,7 @@ func (ptr *QXmlReader) SetContentHandler(handler QXmlContentHandler_ITF) {
 
 //export callbackQXmlReader_SetDTDHandler
 func callbackQXmlReader_SetDTDHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDTDHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDTDHandler"); signal != nil {
 		signal.(func(*QXmlDTDHandler))(NewQXmlDTDHandlerFromPointer(handler))
 	}
 
@@ -6417,14 +6452,14 @@ func callbackQXmlReader_SetDTDHandler(ptr unsafe.Pointer, handler unsafe.Pointer
 func (ptr *QXmlReader) ConnectSetDTDHandler(f func(handler *QXmlDTDHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setDTDHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setDTDHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectSetDTDHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setDTDHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setDTDHandler")
 	}
 }
 
@@ -6436,7 +6471,7 @@ func (ptr *QXmlReader) SetDTDHandler(handler QXmlDTDHandler_ITF) {
 
 //export callbackQXmlReader_SetDeclHandler
 func callbackQXmlReader_SetDeclHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDeclHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDeclHandler"); signal != nil {
 		signal.(func(*QXmlDeclHandler))(NewQXmlDeclHandlerFromPointer(handler))
 	}
 
@@ -6445,14 +6480,14 @@ func callbackQXmlReader_SetDeclHandler(ptr unsafe.Pointer, handler unsafe.Pointe
 func (ptr *QXmlReader) ConnectSetDeclHandler(f func(handler *QXmlDeclHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setDeclHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setDeclHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectSetDeclHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setDeclHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setDeclHandler")
 	}
 }
 
@@ -6464,7 +6499,7 @@ func (ptr *QXmlReader) SetDeclHandler(handler QXmlDeclHandler_ITF) {
 
 //export callbackQXmlReader_SetEntityResolver
 func callbackQXmlReader_SetEntityResolver(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEntityResolver"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEntityResolver"); signal != nil {
 		signal.(func(*QXmlEntityResolver))(NewQXmlEntityResolverFromPointer(handler))
 	}
 
@@ -6473,14 +6508,14 @@ func callbackQXmlReader_SetEntityResolver(ptr unsafe.Pointer, handler unsafe.Poi
 func (ptr *QXmlReader) ConnectSetEntityResolver(f func(handler *QXmlEntityResolver)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setEntityResolver", f)
+		qt.ConnectSignal(ptr.Pointer(), "setEntityResolver", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectSetEntityResolver() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setEntityResolver")
+		qt.DisconnectSignal(ptr.Pointer(), "setEntityResolver")
 	}
 }
 
@@ -6492,7 +6527,7 @@ func (ptr *QXmlReader) SetEntityResolver(handler QXmlEntityResolver_ITF) {
 
 //export callbackQXmlReader_SetErrorHandler
 func callbackQXmlReader_SetErrorHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setErrorHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setErrorHandler"); signal != nil {
 		signal.(func(*QXmlErrorHandler))(NewQXmlErrorHandlerFromPointer(handler))
 	}
 
@@ -6501,14 +6536,14 @@ func callbackQXmlReader_SetErrorHandler(ptr unsafe.Pointer, handler unsafe.Point
 func (ptr *QXmlReader) ConnectSetErrorHandler(f func(handler *QXmlErrorHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setErrorHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setErrorHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectSetErrorHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setErrorHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setErrorHandler")
 	}
 }
 
@@ -6520,7 +6555,7 @@ func (ptr *QXmlReader) SetErrorHandler(handler QXmlErrorHandler_ITF) {
 
 //export callbackQXmlReader_SetFeature
 func callbackQXmlReader_SetFeature(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, value C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFeature"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFeature"); signal != nil {
 		signal.(func(string, bool))(cGoUnpackString(name), int8(value) != 0)
 	}
 
@@ -6529,14 +6564,14 @@ func callbackQXmlReader_SetFeature(ptr unsafe.Pointer, name C.struct_QtXml_Packe
 func (ptr *QXmlReader) ConnectSetFeature(f func(name string, value bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFeature", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFeature", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectSetFeature() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFeature")
+		qt.DisconnectSignal(ptr.Pointer(), "setFeature")
 	}
 }
 
@@ -6550,7 +6585,7 @@ func (ptr *QXmlReader) SetFeature(name string, value bool) {
 
 //export callbackQXmlReader_SetLexicalHandler
 func callbackQXmlReader_SetLexicalHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setLexicalHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setLexicalHandler"); signal != nil {
 		signal.(func(*QXmlLexicalHandler))(NewQXmlLexicalHandlerFromPointer(handler))
 	}
 
@@ -6559,14 +6594,14 @@ func callbackQXmlReader_SetLexicalHandler(ptr unsafe.Pointer, handler unsafe.Poi
 func (ptr *QXmlReader) ConnectSetLexicalHandler(f func(handler *QXmlLexicalHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setLexicalHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setLexicalHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectSetLexicalHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setLexicalHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setLexicalHandler")
 	}
 }
 
@@ -6578,7 +6613,7 @@ func (ptr *QXmlReader) SetLexicalHandler(handler QXmlLexicalHandler_ITF) {
 
 //export callbackQXmlReader_SetProperty
 func callbackQXmlReader_SetProperty(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setProperty"); signal != nil {
 		signal.(func(string, unsafe.Pointer))(cGoUnpackString(name), value)
 	}
 
@@ -6587,14 +6622,14 @@ func callbackQXmlReader_SetProperty(ptr unsafe.Pointer, name C.struct_QtXml_Pack
 func (ptr *QXmlReader) ConnectSetProperty(f func(name string, value unsafe.Pointer)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setProperty", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectSetProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setProperty")
 	}
 }
 
@@ -6608,7 +6643,7 @@ func (ptr *QXmlReader) SetProperty(name string, value unsafe.Pointer) {
 
 //export callbackQXmlReader_DestroyQXmlReader
 func callbackQXmlReader_DestroyQXmlReader(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlReader"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlReader"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlReaderFromPointer(ptr).DestroyQXmlReaderDefault()
@@ -6618,21 +6653,21 @@ func callbackQXmlReader_DestroyQXmlReader(ptr unsafe.Pointer) {
 func (ptr *QXmlReader) ConnectDestroyQXmlReader(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlReader", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlReader", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectDestroyQXmlReader() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlReader")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlReader")
 	}
 }
 
 func (ptr *QXmlReader) DestroyQXmlReader() {
 	if ptr.Pointer() != nil {
 		C.QXmlReader_DestroyQXmlReader(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -6640,14 +6675,14 @@ func (ptr *QXmlReader) DestroyQXmlReader() {
 func (ptr *QXmlReader) DestroyQXmlReaderDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlReader_DestroyQXmlReaderDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlReader_ContentHandler
 func callbackQXmlReader_ContentHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentHandler"); signal != nil {
 		return PointerFromQXmlContentHandler(signal.(func() *QXmlContentHandler)())
 	}
 
@@ -6657,14 +6692,14 @@ func callbackQXmlReader_ContentHandler(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlReader) ConnectContentHandler(f func() *QXmlContentHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contentHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "contentHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectContentHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contentHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "contentHandler")
 	}
 }
 
@@ -6677,7 +6712,7 @@ func (ptr *QXmlReader) ContentHandler() *QXmlContentHandler {
 
 //export callbackQXmlReader_DTDHandler
 func callbackQXmlReader_DTDHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "DTDHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "DTDHandler"); signal != nil {
 		return PointerFromQXmlDTDHandler(signal.(func() *QXmlDTDHandler)())
 	}
 
@@ -6687,14 +6722,14 @@ func callbackQXmlReader_DTDHandler(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlReader) ConnectDTDHandler(f func() *QXmlDTDHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "DTDHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "DTDHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectDTDHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "DTDHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "DTDHandler")
 	}
 }
 
@@ -6707,7 +6742,7 @@ func (ptr *QXmlReader) DTDHandler() *QXmlDTDHandler {
 
 //export callbackQXmlReader_DeclHandler
 func callbackQXmlReader_DeclHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "declHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "declHandler"); signal != nil {
 		return PointerFromQXmlDeclHandler(signal.(func() *QXmlDeclHandler)())
 	}
 
@@ -6717,14 +6752,14 @@ func callbackQXmlReader_DeclHandler(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlReader) ConnectDeclHandler(f func() *QXmlDeclHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "declHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "declHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectDeclHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "declHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "declHandler")
 	}
 }
 
@@ -6737,7 +6772,7 @@ func (ptr *QXmlReader) DeclHandler() *QXmlDeclHandler {
 
 //export callbackQXmlReader_EntityResolver
 func callbackQXmlReader_EntityResolver(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "entityResolver"); signal != nil {
+	if signal := qt.GetSignal(ptr, "entityResolver"); signal != nil {
 		return PointerFromQXmlEntityResolver(signal.(func() *QXmlEntityResolver)())
 	}
 
@@ -6747,14 +6782,14 @@ func callbackQXmlReader_EntityResolver(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlReader) ConnectEntityResolver(f func() *QXmlEntityResolver) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "entityResolver", f)
+		qt.ConnectSignal(ptr.Pointer(), "entityResolver", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectEntityResolver() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "entityResolver")
+		qt.DisconnectSignal(ptr.Pointer(), "entityResolver")
 	}
 }
 
@@ -6767,7 +6802,7 @@ func (ptr *QXmlReader) EntityResolver() *QXmlEntityResolver {
 
 //export callbackQXmlReader_ErrorHandler
 func callbackQXmlReader_ErrorHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorHandler"); signal != nil {
 		return PointerFromQXmlErrorHandler(signal.(func() *QXmlErrorHandler)())
 	}
 
@@ -6777,14 +6812,14 @@ func callbackQXmlReader_ErrorHandler(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlReader) ConnectErrorHandler(f func() *QXmlErrorHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectErrorHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "errorHandler")
 	}
 }
 
@@ -6797,7 +6832,7 @@ func (ptr *QXmlReader) ErrorHandler() *QXmlErrorHandler {
 
 //export callbackQXmlReader_LexicalHandler
 func callbackQXmlReader_LexicalHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lexicalHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lexicalHandler"); signal != nil {
 		return PointerFromQXmlLexicalHandler(signal.(func() *QXmlLexicalHandler)())
 	}
 
@@ -6807,14 +6842,14 @@ func callbackQXmlReader_LexicalHandler(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlReader) ConnectLexicalHandler(f func() *QXmlLexicalHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lexicalHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "lexicalHandler", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectLexicalHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lexicalHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "lexicalHandler")
 	}
 }
 
@@ -6827,7 +6862,7 @@ func (ptr *QXmlReader) LexicalHandler() *QXmlLexicalHandler {
 
 //export callbackQXmlReader_Feature
 func callbackQXmlReader_Feature(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, ok C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "feature"); signal != nil {
+	if signal := qt.GetSignal(ptr, "feature"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, bool) bool)(cGoUnpackString(name), int8(ok) != 0))))
 	}
 
@@ -6837,14 +6872,14 @@ func callbackQXmlReader_Feature(ptr unsafe.Pointer, name C.struct_QtXml_PackedSt
 func (ptr *QXmlReader) ConnectFeature(f func(name string, ok bool) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "feature", f)
+		qt.ConnectSignal(ptr.Pointer(), "feature", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectFeature() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "feature")
+		qt.DisconnectSignal(ptr.Pointer(), "feature")
 	}
 }
 
@@ -6859,7 +6894,7 @@ func (ptr *QXmlReader) Feature(name string, ok bool) bool {
 
 //export callbackQXmlReader_HasFeature
 func callbackQXmlReader_HasFeature(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasFeature"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasFeature"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -6869,14 +6904,14 @@ func callbackQXmlReader_HasFeature(ptr unsafe.Pointer, name C.struct_QtXml_Packe
 func (ptr *QXmlReader) ConnectHasFeature(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasFeature", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasFeature", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectHasFeature() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasFeature")
+		qt.DisconnectSignal(ptr.Pointer(), "hasFeature")
 	}
 }
 
@@ -6891,7 +6926,7 @@ func (ptr *QXmlReader) HasFeature(name string) bool {
 
 //export callbackQXmlReader_HasProperty
 func callbackQXmlReader_HasProperty(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -6901,14 +6936,14 @@ func callbackQXmlReader_HasProperty(ptr unsafe.Pointer, name C.struct_QtXml_Pack
 func (ptr *QXmlReader) ConnectHasProperty(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasProperty", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectHasProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "hasProperty")
 	}
 }
 
@@ -6923,7 +6958,7 @@ func (ptr *QXmlReader) HasProperty(name string) bool {
 
 //export callbackQXmlReader_Property
 func callbackQXmlReader_Property(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, ok C.char) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "property"); signal != nil {
+	if signal := qt.GetSignal(ptr, "property"); signal != nil {
 		return signal.(func(string, bool) unsafe.Pointer)(cGoUnpackString(name), int8(ok) != 0)
 	}
 
@@ -6933,14 +6968,14 @@ func callbackQXmlReader_Property(ptr unsafe.Pointer, name C.struct_QtXml_PackedS
 func (ptr *QXmlReader) ConnectProperty(f func(name string, ok bool) unsafe.Pointer) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "property", f)
+		qt.ConnectSignal(ptr.Pointer(), "property", f)
 	}
 }
 
 func (ptr *QXmlReader) DisconnectProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "property")
+		qt.DisconnectSignal(ptr.Pointer(), "property")
 	}
 }
 
@@ -6997,7 +7032,7 @@ func NewQXmlSimpleReader() *QXmlSimpleReader {
 
 //export callbackQXmlSimpleReader_Parse
 func callbackQXmlSimpleReader_Parse(ptr unsafe.Pointer, input unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parse"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parse"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlInputSource) bool)(NewQXmlInputSourceFromPointer(input)))))
 	}
 
@@ -7007,14 +7042,14 @@ func callbackQXmlSimpleReader_Parse(ptr unsafe.Pointer, input unsafe.Pointer) C.
 func (ptr *QXmlSimpleReader) ConnectParse(f func(input *QXmlInputSource) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parse", f)
+		qt.ConnectSignal(ptr.Pointer(), "parse", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectParse() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parse")
+		qt.DisconnectSignal(ptr.Pointer(), "parse")
 	}
 }
 
@@ -7034,7 +7069,7 @@ func (ptr *QXmlSimpleReader) ParseDefault(input QXmlInputSource_ITF) bool {
 
 //export callbackQXmlSimpleReader_Parse2
 func callbackQXmlSimpleReader_Parse2(ptr unsafe.Pointer, input unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parse2"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parse2"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlInputSource) bool)(NewQXmlInputSourceFromPointer(input)))))
 	}
 
@@ -7044,14 +7079,14 @@ func callbackQXmlSimpleReader_Parse2(ptr unsafe.Pointer, input unsafe.Pointer) C
 func (ptr *QXmlSimpleReader) ConnectParse2(f func(input *QXmlInputSource) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parse2", f)
+		qt.ConnectSignal(ptr.Pointer(), "parse2", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectParse2() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parse2")
+		qt.DisconnectSignal(ptr.Pointer(), "parse2")
 	}
 }
 
@@ -7071,7 +7106,7 @@ func (ptr *QXmlSimpleReader) Parse2Default(input QXmlInputSource_ITF) bool {
 
 //export callbackQXmlSimpleReader_Parse3
 func callbackQXmlSimpleReader_Parse3(ptr unsafe.Pointer, input unsafe.Pointer, incremental C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parse3"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parse3"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(*QXmlInputSource, bool) bool)(NewQXmlInputSourceFromPointer(input), int8(incremental) != 0))))
 	}
 
@@ -7081,14 +7116,14 @@ func callbackQXmlSimpleReader_Parse3(ptr unsafe.Pointer, input unsafe.Pointer, i
 func (ptr *QXmlSimpleReader) ConnectParse3(f func(input *QXmlInputSource, incremental bool) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parse3", f)
+		qt.ConnectSignal(ptr.Pointer(), "parse3", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectParse3() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parse3")
+		qt.DisconnectSignal(ptr.Pointer(), "parse3")
 	}
 }
 
@@ -7108,7 +7143,7 @@ func (ptr *QXmlSimpleReader) Parse3Default(input QXmlInputSource_ITF, incrementa
 
 //export callbackQXmlSimpleReader_ParseContinue
 func callbackQXmlSimpleReader_ParseContinue(ptr unsafe.Pointer) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "parseContinue"); signal != nil {
+	if signal := qt.GetSignal(ptr, "parseContinue"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func() bool)())))
 	}
 
@@ -7118,14 +7153,14 @@ func callbackQXmlSimpleReader_ParseContinue(ptr unsafe.Pointer) C.char {
 func (ptr *QXmlSimpleReader) ConnectParseContinue(f func() bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "parseContinue", f)
+		qt.ConnectSignal(ptr.Pointer(), "parseContinue", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectParseContinue() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "parseContinue")
+		qt.DisconnectSignal(ptr.Pointer(), "parseContinue")
 	}
 }
 
@@ -7145,7 +7180,7 @@ func (ptr *QXmlSimpleReader) ParseContinueDefault() bool {
 
 //export callbackQXmlSimpleReader_SetContentHandler
 func callbackQXmlSimpleReader_SetContentHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setContentHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setContentHandler"); signal != nil {
 		signal.(func(*QXmlContentHandler))(NewQXmlContentHandlerFromPointer(handler))
 	} else {
 		NewQXmlSimpleReaderFromPointer(ptr).SetContentHandlerDefault(NewQXmlContentHandlerFromPointer(handler))
@@ -7155,14 +7190,14 @@ func callbackQXmlSimpleReader_SetContentHandler(ptr unsafe.Pointer, handler unsa
 func (ptr *QXmlSimpleReader) ConnectSetContentHandler(f func(handler *QXmlContentHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setContentHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setContentHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectSetContentHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setContentHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setContentHandler")
 	}
 }
 
@@ -7180,7 +7215,7 @@ func (ptr *QXmlSimpleReader) SetContentHandlerDefault(handler QXmlContentHandler
 
 //export callbackQXmlSimpleReader_SetDTDHandler
 func callbackQXmlSimpleReader_SetDTDHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDTDHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDTDHandler"); signal != nil {
 		signal.(func(*QXmlDTDHandler))(NewQXmlDTDHandlerFromPointer(handler))
 	} else {
 		NewQXmlSimpleReaderFromPointer(ptr).SetDTDHandlerDefault(NewQXmlDTDHandlerFromPointer(handler))
@@ -7190,14 +7225,14 @@ func callbackQXmlSimpleReader_SetDTDHandler(ptr unsafe.Pointer, handler unsafe.P
 func (ptr *QXmlSimpleReader) ConnectSetDTDHandler(f func(handler *QXmlDTDHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setDTDHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setDTDHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectSetDTDHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setDTDHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setDTDHandler")
 	}
 }
 
@@ -7215,7 +7250,7 @@ func (ptr *QXmlSimpleReader) SetDTDHandlerDefault(handler QXmlDTDHandler_ITF) {
 
 //export callbackQXmlSimpleReader_SetDeclHandler
 func callbackQXmlSimpleReader_SetDeclHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setDeclHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setDeclHandler"); signal != nil {
 		signal.(func(*QXmlDeclHandler))(NewQXmlDeclHandlerFromPointer(handler))
 	} else {
 		NewQXmlSimpleReaderFromPointer(ptr).SetDeclHandlerDefault(NewQXmlDeclHandlerFromPointer(handler))
@@ -7225,14 +7260,14 @@ func callbackQXmlSimpleReader_SetDeclHandler(ptr unsafe.Pointer, handler unsafe.
 func (ptr *QXmlSimpleReader) ConnectSetDeclHandler(f func(handler *QXmlDeclHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setDeclHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setDeclHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectSetDeclHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setDeclHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setDeclHandler")
 	}
 }
 
@@ -7250,7 +7285,7 @@ func (ptr *QXmlSimpleReader) SetDeclHandlerDefault(handler QXmlDeclHandler_ITF)
 
 //export callbackQXmlSimpleReader_SetEntityResolver
 func callbackQXmlSimpleReader_SetEntityResolver(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setEntityResolver"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setEntityResolver"); signal != nil {
 		signal.(func(*QXmlEntityResolver))(NewQXmlEntityResolverFromPointer(handler))
 	} else {
 		NewQXmlSimpleReaderFromPointer(ptr).SetEntityResolverDefault(NewQXmlEntityResolverFromPointer(handler))
@@ -7260,14 +7295,14 @@ func callbackQXmlSimpleReader_SetEntityResolver(ptr unsafe.Pointer, handler unsa
 func (ptr *QXmlSimpleReader) ConnectSetEntityResolver(f func(handler *QXmlEntityResolver)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setEntityResolver", f)
+		qt.ConnectSignal(ptr.Pointer(), "setEntityResolver", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectSetEntityResolver() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setEntityResolver")
+		qt.DisconnectSignal(ptr.Pointer(), "setEntityResolver")
 	}
 }
 
@@ -7285,7 +7320,7 @@ func (ptr *QXmlSimpleReader) SetEntityResolverDefault(handler QXmlEntityResolver
 
 //export callbackQXmlSimpleReader_SetErrorHandler
 func callbackQXmlSimpleReader_SetErrorHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setErrorHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setErrorHandler"); signal != nil {
 		signal.(func(*QXmlErrorHandler))(NewQXmlErrorHandlerFromPointer(handler))
 	} else {
 		NewQXmlSimpleReaderFromPointer(ptr).SetErrorHandlerDefault(NewQXmlErrorHandlerFromPointer(handler))
@@ -7295,14 +7330,14 @@ func callbackQXmlSimpleReader_SetErrorHandler(ptr unsafe.Pointer, handler unsafe
 func (ptr *QXmlSimpleReader) ConnectSetErrorHandler(f func(handler *QXmlErrorHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setErrorHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setErrorHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectSetErrorHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setErrorHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setErrorHandler")
 	}
 }
 
@@ -7320,7 +7355,7 @@ func (ptr *QXmlSimpleReader) SetErrorHandlerDefault(handler QXmlErrorHandler_ITF
 
 //export callbackQXmlSimpleReader_SetFeature
 func callbackQXmlSimpleReader_SetFeature(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, enable C.char) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setFeature"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setFeature"); signal != nil {
 		signal.(func(string, bool))(cGoUnpackString(name), int8(enable) != 0)
 	} else {
 		NewQXmlSimpleReaderFromPointer(ptr).SetFeatureDefault(cGoUnpackString(name), int8(enable) != 0)
@@ -7330,14 +7365,14 @@ func callbackQXmlSimpleReader_SetFeature(ptr unsafe.Pointer, name C.struct_QtXml
 func (ptr *QXmlSimpleReader) ConnectSetFeature(f func(name string, enable bool)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setFeature", f)
+		qt.ConnectSignal(ptr.Pointer(), "setFeature", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectSetFeature() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setFeature")
+		qt.DisconnectSignal(ptr.Pointer(), "setFeature")
 	}
 }
 
@@ -7359,7 +7394,7 @@ func (ptr *QXmlSimpleReader) SetFeatureDefault(name string, enable bool) {
 
 //export callbackQXmlSimpleReader_SetLexicalHandler
 func callbackQXmlSimpleReader_SetLexicalHandler(ptr unsafe.Pointer, handler unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setLexicalHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setLexicalHandler"); signal != nil {
 		signal.(func(*QXmlLexicalHandler))(NewQXmlLexicalHandlerFromPointer(handler))
 	} else {
 		NewQXmlSimpleReaderFromPointer(ptr).SetLexicalHandlerDefault(NewQXmlLexicalHandlerFromPointer(handler))
@@ -7369,14 +7404,14 @@ func callbackQXmlSimpleReader_SetLexicalHandler(ptr unsafe.Pointer, handler unsa
 func (ptr *QXmlSimpleReader) ConnectSetLexicalHandler(f func(handler *QXmlLexicalHandler)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setLexicalHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "setLexicalHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectSetLexicalHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setLexicalHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "setLexicalHandler")
 	}
 }
 
@@ -7394,7 +7429,7 @@ func (ptr *QXmlSimpleReader) SetLexicalHandlerDefault(handler QXmlLexicalHandler
 
 //export callbackQXmlSimpleReader_SetProperty
 func callbackQXmlSimpleReader_SetProperty(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, value unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "setProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "setProperty"); signal != nil {
 		signal.(func(string, unsafe.Pointer))(cGoUnpackString(name), value)
 	} else {
 		NewQXmlSimpleReaderFromPointer(ptr).SetPropertyDefault(cGoUnpackString(name), value)
@@ -7404,14 +7439,14 @@ func callbackQXmlSimpleReader_SetProperty(ptr unsafe.Pointer, name C.struct_QtXm
 func (ptr *QXmlSimpleReader) ConnectSetProperty(f func(name string, value unsafe.Pointer)) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "setProperty", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectSetProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "setProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "setProperty")
 	}
 }
 
@@ -7433,7 +7468,7 @@ func (ptr *QXmlSimpleReader) SetPropertyDefault(name string, value unsafe.Pointe
 
 //export callbackQXmlSimpleReader_DestroyQXmlSimpleReader
 func callbackQXmlSimpleReader_DestroyQXmlSimpleReader(ptr unsafe.Pointer) {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "~QXmlSimpleReader"); signal != nil {
+	if signal := qt.GetSignal(ptr, "~QXmlSimpleReader"); signal != nil {
 		signal.(func())()
 	} else {
 		NewQXmlSimpleReaderFromPointer(ptr).DestroyQXmlSimpleReaderDefault()
@@ -7443,21 +7478,21 @@ func callbackQXmlSimpleReader_DestroyQXmlSimpleReader(ptr unsafe.Pointer) {
 func (ptr *QXmlSimpleReader) ConnectDestroyQXmlSimpleReader(f func()) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlSimpleReader", f)
+		qt.ConnectSignal(ptr.Pointer(), "~QXmlSimpleReader", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectDestroyQXmlSimpleReader() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "~QXmlSimpleReader")
+		qt.DisconnectSignal(ptr.Pointer(), "~QXmlSimpleReader")
 	}
 }
 
 func (ptr *QXmlSimpleReader) DestroyQXmlSimpleReader() {
 	if ptr.Pointer() != nil {
 		C.QXmlSimpleReader_DestroyQXmlSimpleReader(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
@@ -7465,14 +7500,14 @@ func (ptr *QXmlSimpleReader) DestroyQXmlSimpleReader() {
 func (ptr *QXmlSimpleReader) DestroyQXmlSimpleReaderDefault() {
 	if ptr.Pointer() != nil {
 		C.QXmlSimpleReader_DestroyQXmlSimpleReaderDefault(ptr.Pointer())
-		qt.DisconnectAllSignals(fmt.Sprint(ptr.Pointer()))
+		qt.DisconnectAllSignals(ptr.Pointer())
 		ptr.SetPointer(nil)
 	}
 }
 
 //export callbackQXmlSimpleReader_ContentHandler
 func callbackQXmlSimpleReader_ContentHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "contentHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "contentHandler"); signal != nil {
 		return PointerFromQXmlContentHandler(signal.(func() *QXmlContentHandler)())
 	}
 
@@ -7482,14 +7517,14 @@ func callbackQXmlSimpleReader_ContentHandler(ptr unsafe.Pointer) unsafe.Pointer
 func (ptr *QXmlSimpleReader) ConnectContentHandler(f func() *QXmlContentHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "contentHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "contentHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectContentHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "contentHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "contentHandler")
 	}
 }
 
@@ -7509,7 +7544,7 @@ func (ptr *QXmlSimpleReader) ContentHandlerDefault() *QXmlContentHandler {
 
 //export callbackQXmlSimpleReader_DTDHandler
 func callbackQXmlSimpleReader_DTDHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "DTDHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "DTDHandler"); signal != nil {
 		return PointerFromQXmlDTDHandler(signal.(func() *QXmlDTDHandler)())
 	}
 
@@ -7519,14 +7554,14 @@ func callbackQXmlSimpleReader_DTDHandler(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlSimpleReader) ConnectDTDHandler(f func() *QXmlDTDHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "DTDHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "DTDHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectDTDHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "DTDHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "DTDHandler")
 	}
 }
 
@@ -7546,7 +7581,7 @@ func (ptr *QXmlSimpleReader) DTDHandlerDefault() *QXmlDTDHandler {
 
 //export callbackQXmlSimpleReader_DeclHandler
 func callbackQXmlSimpleReader_DeclHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "declHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "declHandler"); signal != nil {
 		return PointerFromQXmlDeclHandler(signal.(func() *QXmlDeclHandler)())
 	}
 
@@ -7556,14 +7591,14 @@ func callbackQXmlSimpleReader_DeclHandler(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlSimpleReader) ConnectDeclHandler(f func() *QXmlDeclHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "declHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "declHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectDeclHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "declHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "declHandler")
 	}
 }
 
@@ -7583,7 +7618,7 @@ func (ptr *QXmlSimpleReader) DeclHandlerDefault() *QXmlDeclHandler {
 
 //export callbackQXmlSimpleReader_EntityResolver
 func callbackQXmlSimpleReader_EntityResolver(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "entityResolver"); signal != nil {
+	if signal := qt.GetSignal(ptr, "entityResolver"); signal != nil {
 		return PointerFromQXmlEntityResolver(signal.(func() *QXmlEntityResolver)())
 	}
 
@@ -7593,14 +7628,14 @@ func callbackQXmlSimpleReader_EntityResolver(ptr unsafe.Pointer) unsafe.Pointer
 func (ptr *QXmlSimpleReader) ConnectEntityResolver(f func() *QXmlEntityResolver) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "entityResolver", f)
+		qt.ConnectSignal(ptr.Pointer(), "entityResolver", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectEntityResolver() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "entityResolver")
+		qt.DisconnectSignal(ptr.Pointer(), "entityResolver")
 	}
 }
 
@@ -7620,7 +7655,7 @@ func (ptr *QXmlSimpleReader) EntityResolverDefault() *QXmlEntityResolver {
 
 //export callbackQXmlSimpleReader_ErrorHandler
 func callbackQXmlSimpleReader_ErrorHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "errorHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "errorHandler"); signal != nil {
 		return PointerFromQXmlErrorHandler(signal.(func() *QXmlErrorHandler)())
 	}
 
@@ -7630,14 +7665,14 @@ func callbackQXmlSimpleReader_ErrorHandler(ptr unsafe.Pointer) unsafe.Pointer {
 func (ptr *QXmlSimpleReader) ConnectErrorHandler(f func() *QXmlErrorHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "errorHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "errorHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectErrorHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "errorHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "errorHandler")
 	}
 }
 
@@ -7657,7 +7692,7 @@ func (ptr *QXmlSimpleReader) ErrorHandlerDefault() *QXmlErrorHandler {
 
 //export callbackQXmlSimpleReader_LexicalHandler
 func callbackQXmlSimpleReader_LexicalHandler(ptr unsafe.Pointer) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "lexicalHandler"); signal != nil {
+	if signal := qt.GetSignal(ptr, "lexicalHandler"); signal != nil {
 		return PointerFromQXmlLexicalHandler(signal.(func() *QXmlLexicalHandler)())
 	}
 
@@ -7667,14 +7702,14 @@ func callbackQXmlSimpleReader_LexicalHandler(ptr unsafe.Pointer) unsafe.Pointer
 func (ptr *QXmlSimpleReader) ConnectLexicalHandler(f func() *QXmlLexicalHandler) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "lexicalHandler", f)
+		qt.ConnectSignal(ptr.Pointer(), "lexicalHandler", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectLexicalHandler() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "lexicalHandler")
+		qt.DisconnectSignal(ptr.Pointer(), "lexicalHandler")
 	}
 }
 
@@ -7694,7 +7729,7 @@ func (ptr *QXmlSimpleReader) LexicalHandlerDefault() *QXmlLexicalHandler {
 
 //export callbackQXmlSimpleReader_Feature
 func callbackQXmlSimpleReader_Feature(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, ok C.char) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "feature"); signal != nil {
+	if signal := qt.GetSignal(ptr, "feature"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string, bool) bool)(cGoUnpackString(name), int8(ok) != 0))))
 	}
 
@@ -7704,14 +7739,14 @@ func callbackQXmlSimpleReader_Feature(ptr unsafe.Pointer, name C.struct_QtXml_Pa
 func (ptr *QXmlSimpleReader) ConnectFeature(f func(name string, ok bool) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "feature", f)
+		qt.ConnectSignal(ptr.Pointer(), "feature", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectFeature() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "feature")
+		qt.DisconnectSignal(ptr.Pointer(), "feature")
 	}
 }
 
@@ -7735,7 +7770,7 @@ func (ptr *QXmlSimpleReader) FeatureDefault(name string, ok bool) bool {
 
 //export callbackQXmlSimpleReader_HasFeature
 func callbackQXmlSimpleReader_HasFeature(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasFeature"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasFeature"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -7745,14 +7780,14 @@ func callbackQXmlSimpleReader_HasFeature(ptr unsafe.Pointer, name C.struct_QtXml
 func (ptr *QXmlSimpleReader) ConnectHasFeature(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasFeature", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasFeature", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectHasFeature() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasFeature")
+		qt.DisconnectSignal(ptr.Pointer(), "hasFeature")
 	}
 }
 
@@ -7776,7 +7811,7 @@ func (ptr *QXmlSimpleReader) HasFeatureDefault(name string) bool {
 
 //export callbackQXmlSimpleReader_HasProperty
 func callbackQXmlSimpleReader_HasProperty(ptr unsafe.Pointer, name C.struct_QtXml_PackedString) C.char {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "hasProperty"); signal != nil {
+	if signal := qt.GetSignal(ptr, "hasProperty"); signal != nil {
 		return C.char(int8(qt.GoBoolToInt(signal.(func(string) bool)(cGoUnpackString(name)))))
 	}
 
@@ -7786,14 +7821,14 @@ func callbackQXmlSimpleReader_HasProperty(ptr unsafe.Pointer, name C.struct_QtXm
 func (ptr *QXmlSimpleReader) ConnectHasProperty(f func(name string) bool) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "hasProperty", f)
+		qt.ConnectSignal(ptr.Pointer(), "hasProperty", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectHasProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "hasProperty")
+		qt.DisconnectSignal(ptr.Pointer(), "hasProperty")
 	}
 }
 
@@ -7817,7 +7852,7 @@ func (ptr *QXmlSimpleReader) HasPropertyDefault(name string) bool {
 
 //export callbackQXmlSimpleReader_Property
 func callbackQXmlSimpleReader_Property(ptr unsafe.Pointer, name C.struct_QtXml_PackedString, ok C.char) unsafe.Pointer {
-	if signal := qt.GetSignal(fmt.Sprint(ptr), "property"); signal != nil {
+	if signal := qt.GetSignal(ptr, "property"); signal != nil {
 		return signal.(func(string, bool) unsafe.Pointer)(cGoUnpackString(name), int8(ok) != 0)
 	}
 
@@ -7827,14 +7862,14 @@ func callbackQXmlSimpleReader_Property(ptr unsafe.Pointer, name C.struct_QtXml_P
 func (ptr *QXmlSimpleReader) ConnectProperty(f func(name string, ok bool) unsafe.Pointer) {
 	if ptr.Pointer() != nil {
 
-		qt.ConnectSignal(fmt.Sprint(ptr.Pointer()), "property", f)
+		qt.ConnectSignal(ptr.Pointer(), "property", f)
 	}
 }
 
 func (ptr *QXmlSimpleReader) DisconnectProperty() {
 	if ptr.Pointer() != nil {
 
-		qt.DisconnectSignal(fmt.Sprint(ptr.Pointer()), "property")
+		qt.DisconnectSignal(ptr.Pointer(), "property")
 	}
 }
 
@@ -41,6 +41,42 @@
 #include <QXmlSchema>
 #include <QXmlSchemaValidator>
 #include <QXmlSerializer>
+#include <QtEndian>
+#include <cstdlib>
+
+static QList<QByteArray> goUnpackByteArrayList(const char* data)
+{
+	QList<QByteArray> out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QByteArray(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
+
+static QStringList goUnpackStringList(const char* data)
+{
+	QStringList out;
+	if (!data) {
+		return out;
+	}
+	const uchar* p = reinterpret_cast<const uchar*>(data);
+	quint32 count = qFromLittleEndian<quint32>(p);
+	out.reserve(count);
+	for (p += 4; count > 0; count--) {
+		quint32 n = qFromLittleEndian<quint32>(p);
+		out.append(QString::fromUtf8(reinterpret_cast<const char*>(p + 4), n));
+		p += 4 + n;
+	}
+	return out;
+}
 
 class MyQAbstractMessageHandler: public QAbstractMessageHandler
 {
@@ -1138,7 +1174,7 @@ char QXmlQuery_EvaluateTo5(void* ptr, char* output)
 
 char QXmlQuery_EvaluateTo3(void* ptr, char* target)
 {
-	return static_cast<QXmlQuery*>(ptr)->evaluateTo(new QStringList(QString(target).split("|", QString::SkipEmptyParts)));
+	return static_cast<QXmlQuery*>(ptr)->evaluateTo(new QStringList(goUnpackStringList(target)));
 }
 
 char QXmlQuery_IsValid(void* ptr)